@@ -0,0 +1,158 @@
+#!/usr/bin/env python3
+#
+# Benchmark report comparison
+#
+# Compares the JSON reports of Utilities/CPU/periph_bench, Utilities/CPU/
+# isr_bench and Utilities/ETH/eth_bench taken before and after a change: two
+# HAL releases, two driver versions or two boards. Each input is a console
+# capture holding one report per line, other lines are ignored. Cycle counts
+# are converted to microseconds with the core clock of their report.
+#
+# COPYRIGHT(c) 2019 STMicroelectronics
+
+import argparse
+import json
+import sys
+
+# Metrics of each kind of report: name, path in the entry, unit, True when
+# higher is better
+PERIPH_METRICS = (('MB/s', ('throughput',), 'Bps', True),
+                  ('load', ('load',), 'permille', False),
+                  ('latency mean', ('latency', 'mean'), 'cycles', False),
+                  ('latency max', ('latency', 'max'), 'cycles', False))
+ISR_METRICS = (('latency mean', ('latency', 'mean'), 'cycles', False),
+               ('latency max', ('latency', 'max'), 'cycles', False),
+               ('duration mean', ('duration', 'mean'), 'cycles', False),
+               ('duration max', ('duration', 'max'), 'cycles', False))
+ETH_METRICS = (('rx kbit/s', ('rxkbps',), 'kbps', True),
+               ('load', ('cpuload',), 'percent', False),
+               ('latency mean', ('latency', 'mean'), 'ns', False),
+               ('latency max', ('latency', 'max'), 'ns', False))
+
+
+def reports(path):
+    """JSON documents of a capture, one per line."""
+    found = []
+    with open(path, errors='replace') as f:
+        for number, line in enumerate(f, 1):
+            line = line.strip()
+            start = line.find('{')
+            if start < 0:
+                continue
+            try:
+                found.append(json.loads(line[start:]))
+            except ValueError:
+                sys.stderr.write('%s:%d: not a complete report, skipped\n' % (path, number))
+    if not found:
+        sys.exit('%s: no report found' % path)
+    return found
+
+
+def entries(report):
+    """(key, metrics, entry) of each measure of a report."""
+    if report.get('bench') == 'periph':
+        for entry in report['results']:
+            key = '%s %s %s %d' % (entry['name'], entry['dir'], entry['mode'], entry['size'])
+            yield key, PERIPH_METRICS, entry
+    elif 'irqs' in report:
+        for entry in report['irqs']:
+            yield 'irq %s' % entry['name'], ISR_METRICS, entry
+    elif 'role' in report:
+        key = 'eth %s %s %d %d' % (report['role'], report['mode'], report['size'], report['rate'])
+        yield key, ETH_METRICS, report
+
+
+def value(entry, path, unit, core):
+    for name in path:
+        entry = entry[name]
+    if unit == 'cycles':
+        return entry * 1e6 / core if core else float(entry), 'us'
+    if unit == 'ns':
+        return entry / 1000.0, 'us'
+    if unit == 'Bps':
+        return entry / 1e6, 'MB/s'
+    if unit == 'permille':
+        return entry / 10.0, '%'
+    if unit == 'percent':
+        return float(entry), '%'
+    return float(entry), unit
+
+
+def measures(path):
+    """{(key, metric): (value, unit, higher is better)} of a capture, the
+    last report winning, and the header of the first one."""
+    found = {}
+    captured = reports(path)
+    for report in captured:
+        core = report.get('core', 0)
+        for key, metrics, entry in entries(report):
+            for metric, field, unit, higher in metrics:
+                try:
+                    found[(key, metric)] = value(entry, field, unit, core) + (higher,)
+                except KeyError:
+                    pass
+    first = captured[0]
+    header = 'board %s, HAL %s, core %s Hz' % (first.get('board') or '?', first.get('hal', '?'),
+                                               first.get('core', '?'))
+    return found, header
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compare benchmark reports')
+    parser.add_argument('old', help='capture of the reference run')
+    parser.add_argument('new', help='capture of the run compared')
+    parser.add_argument('--threshold', type=float, default=5.0,
+                        help='change in percent reported as a regression (default 5)')
+    parser.add_argument('--all', action='store_true', help='list the unchanged measures too')
+    parser.add_argument('--json', metavar='FILE', help='write the comparison as JSON')
+    parser.add_argument('--strict', action='store_true', help='exit with 1 on a regression')
+    args = parser.parse_args()
+
+    old, old_header = measures(args.old)
+    new, new_header = measures(args.new)
+    print('old: %s' % old_header)
+    print('new: %s' % new_header)
+
+    rows = []
+    regressions = 0
+    for key in sorted(set(old) | set(new)):
+        before = old.get(key)
+        after = new.get(key)
+        row = {'measure': key[0], 'metric': key[1],
+               'old': before[0] if before else None, 'new': after[0] if after else None,
+               'unit': (before or after)[1], 'change': None, 'status': 'missing' if not after else 'new'}
+        if before and after:
+            change = (after[0] - before[0]) * 100.0 / before[0] if before[0] else 0.0
+            worse = -change if before[2] else change
+            row['change'] = change
+            if worse > args.threshold:
+                row['status'] = 'worse'
+                regressions += 1
+            elif -worse > args.threshold:
+                row['status'] = 'better'
+            else:
+                row['status'] = 'same'
+        rows.append(row)
+
+    print('%-36s %-14s %12s %12s %-5s %8s' % ('measure', 'metric', 'old', 'new', 'unit', 'change'))
+    for row in rows:
+        if row['status'] == 'same' and not args.all:
+            continue
+        print('%-36s %-14s %12s %12s %-5s %8s %s' % (
+            row['measure'], row['metric'],
+            '%.3f' % row['old'] if row['old'] is not None else '-',
+            '%.3f' % row['new'] if row['new'] is not None else '-',
+            row['unit'], '%+.1f%%' % row['change'] if row['change'] is not None else '',
+            row['status'] if row['status'] != 'same' else ''))
+    print('%d measures, %d regressions over %.1f%%' % (len(rows), regressions, args.threshold))
+
+    if args.json:
+        with open(args.json, 'w') as f:
+            json.dump({'old': old_header, 'new': new_header, 'threshold': args.threshold,
+                       'regressions': regressions, 'rows': rows}, f, indent=1)
+    if args.strict and regressions:
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,213 @@
+#!/usr/bin/env python3
+#
+# Binary log decoder
+#
+# Rebuilds the messages recorded by Utilities/Log/bin_log: each record of
+# the stream holds the identifier of its format string, a time stamp and
+# the raw arguments. The format strings are read from the .binlog_fmt
+# section of the ELF file of the application, which is not loaded on the
+# device, and the %s arguments from its constant data.
+#
+# COPYRIGHT(c) 2019 STMicroelectronics
+
+import argparse
+import re
+import struct
+import sys
+
+SYNC = 0xA4000000           # BIN_LOG_SYNC
+SYNC_MASK = 0xFC000000      # BIN_LOG_SYNC_MASK
+ID_MASK = 0x000FFFFF        # BIN_LOG_ID_MASK
+ID_DROPPED = ID_MASK        # BIN_LOG_ID_DROPPED
+MAX_ARGS = 8                # BIN_LOG_MAX_ARGS
+LEVELS = {1: 'ERR', 2: 'USR', 3: 'DBG'}
+
+SHT_NOBITS = 8
+SHF_ALLOC = 0x2
+
+CONVERSION = re.compile(r'%([-+ #0]*)(\d*)(?:\.(\d*))?(?:hh|h|ll|l|z|j|t)?([diuxXoscpfFeEgG%])')
+
+
+class Image(object):
+    def __init__(self, path, section):
+        with open(path, 'rb') as f:
+            elf = f.read()
+        if elf[:4] != b'\x7fELF' or elf[5] != 1:
+            sys.exit('%s: not a little endian ELF file' % path)
+        if elf[4] == 1:
+            shoff, = struct.unpack_from('<I', elf, 32)
+            shentsize, shnum, shstrndx = struct.unpack_from('<HHH', elf, 46)
+            fields = '<IIIIII'
+        else:
+            shoff, = struct.unpack_from('<Q', elf, 40)
+            shentsize, shnum, shstrndx = struct.unpack_from('<HHH', elf, 58)
+            fields = '<IIQQQQ'
+        headers = [struct.unpack_from(fields, elf, shoff + i * shentsize) for i in range(shnum)]
+        strtab = headers[shstrndx][4]
+        self.formats = None
+        self.loaded = []
+        for name, kind, flags, address, offset, size in headers:
+            label = elf[strtab + name:elf.index(b'\0', strtab + name)].decode()
+            data = elf[offset:offset + size] if kind != SHT_NOBITS else b''
+            if label == section:
+                self.formats = data
+            elif flags & SHF_ALLOC and data:
+                self.loaded.append((address & 0xFFFFFFFF, data))
+        if self.formats is None:
+            sys.exit('%s: no %s section, link with the linker.tpl rule of bin_log' % (path, section))
+
+    def string(self, data, offset):
+        end = data.find(b'\0', offset)
+        return data[offset:end if end >= 0 else len(data)].decode('utf-8', 'replace')
+
+    def format(self, ident):
+        if ident * 4 >= len(self.formats):
+            return None
+        return self.string(self.formats, ident * 4)
+
+    def constant(self, address):
+        for origin, data in self.loaded:
+            if origin <= address < origin + len(data):
+                return self.string(data, address - origin)
+        return None
+
+
+def signed(value):
+    return value - (1 << 32) if value & 0x80000000 else value
+
+
+def render(image, text, args):
+    """Apply the C format string to the 32-bit arguments of a record."""
+    values = iter(args)
+
+    def conversion(m):
+        flags, width, precision, kind = m.groups()
+        if kind == '%':
+            return '%'
+        value = next(values, 0)
+        spec = '%' + flags + width + ('.' + precision if precision is not None else '')
+        if kind in 'di':
+            return (spec + 'd') % signed(value)
+        if kind in 'uxXo':
+            return (spec + kind) % value
+        if kind == 'c':
+            return (spec + 'c') % chr(value & 0xFF)
+        if kind == 'p':
+            return '0x%08X' % value
+        if kind == 's':
+            string = image.constant(value)
+            return (spec + 's') % (string if string is not None else '<0x%08X>' % value)
+        return (spec + kind) % struct.unpack('<f', struct.pack('<I', value))[0]
+
+    return CONVERSION.sub(conversion, text)
+
+
+def itm_payload(stream, port):
+    """Keep the bytes of the software packets of one ITM stimulus port."""
+    data = bytearray()
+    i = 0
+    while i < len(stream):
+        header = stream[i]
+        i += 1
+        if header in (0x00, 0x80, 0x70):              # Synchronization, overflow
+            continue
+        size = header & 0x03
+        if size == 0:
+            # Time stamp or extension packet, continuation bytes with bit 7
+            if header & 0x80:
+                while i < len(stream) and stream[i] & 0x80:
+                    i += 1
+                i += 1
+            continue
+        size = 4 if size == 3 else size
+        if not header & 0x04 and header >> 3 == port:
+            data += stream[i:i + size]
+        i += size
+    return bytes(data)
+
+
+class Decoder(object):
+    def __init__(self, image, clock, output):
+        self.image = image
+        self.clock = clock
+        self.output = output
+        self.pending = b''
+        self.skipped = 0
+
+    def feed(self, data):
+        self.pending += data
+        position = 0
+        while len(self.pending) - position >= 8:
+            header, = struct.unpack_from('<I', self.pending, position)
+            count = (header >> 20) & 15
+            if header & SYNC_MASK != SYNC or count > MAX_ARGS:
+                position += 1
+                self.skipped += 1
+                continue
+            length = 8 + 4 * count
+            if len(self.pending) - position < length:
+                break
+            words = struct.unpack_from('<%dI' % (2 + count), self.pending, position)
+            position += length
+            self.record(header, words[1], words[2:])
+        self.pending = self.pending[position:]
+
+    def record(self, header, stamp, args):
+        if self.skipped:
+            self.output.write('<%d bytes skipped>\n' % self.skipped)
+            self.skipped = 0
+        ident = header & ID_MASK
+        if ident == ID_DROPPED:
+            text = '<%d records dropped>\n' % (args[0] if args else 0)
+        else:
+            text = self.image.format(ident)
+            text = render(self.image, text, args) if text is not None else '<unknown format %d>\n' % ident
+        when = '%12.6f' % (stamp / float(self.clock)) if self.clock else '%10u' % stamp
+        level = LEVELS.get((header >> 24) & 3, '---')
+        self.output.write('%s %s %s' % (when, level, text if text.endswith('\n') else text + '\n'))
+        self.output.flush()
+
+
+def chunks(args):
+    if args.serial:
+        try:
+            import serial
+        except ImportError:
+            sys.exit('--serial needs pyserial: pip install pyserial')
+        port = serial.Serial(args.serial, args.baud, timeout=0.1)
+        while True:
+            yield port.read(4096)
+    source = sys.stdin.buffer if args.input == '-' else open(args.input, 'rb')
+    while True:
+        data = source.read(4096)
+        if not data:
+            return
+        yield data
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decode a bin_log stream')
+    parser.add_argument('elf', help='ELF file of the application')
+    parser.add_argument('input', nargs='?', default='-',
+                        help='records captured from a UART, the USB CDC class or the SWO output (default stdin)')
+    parser.add_argument('--serial', metavar='PORT', help='read a serial port instead, with pyserial')
+    parser.add_argument('--baud', type=int, default=115200, help='baud rate of --serial (default 115200)')
+    parser.add_argument('--itm', type=int, metavar='PORT',
+                        help='input is an SWO capture, keep the packets of this stimulus port')
+    parser.add_argument('--clock', type=float, default=0,
+                        help='time stamp frequency in Hz, CPU clock or 1000 for HAL ticks (default raw)')
+    parser.add_argument('--section', default='.binlog_fmt', help='section of the format strings')
+    args = parser.parse_args()
+
+    image = Image(args.elf, args.section)
+    decoder = Decoder(image, args.clock, sys.stdout)
+    # ITM packets may be split across reads: decode an SWO capture at once
+    if args.itm is not None:
+        decoder.feed(itm_payload(b''.join(chunks(args)), args.itm))
+        return
+    for data in chunks(args):
+        decoder.feed(data)
+
+
+if __name__ == '__main__':
+    main()
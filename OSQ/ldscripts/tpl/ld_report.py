@@ -0,0 +1,261 @@
+#!/usr/bin/env python3
+#
+# Post-link memory report
+#
+# Reads the map file of a link (-Wl,-Map=firmware.map) and reports the use
+# of each memory region, the output sections and the largest objects in
+# each region, and the code or data meant for a fast memory which landed in
+# a slow one: flash with wait states or an external memory.
+#
+# COPYRIGHT(c) 2019 STMicroelectronics
+
+import argparse
+import fnmatch
+import json
+import os
+import re
+import sys
+
+HEX = r'0x([0-9a-fA-F]+)'
+MEMORY_LINE = re.compile(r'^(\S+)\s+' + HEX + r'\s+' + HEX + r'(?:\s+(\S+))?\s*$')
+OUTPUT_LINE = re.compile(r'^(\S+)\s+' + HEX + r'\s+' + HEX + r'(?:\s+load address\s+' + HEX + r')?\s*$')
+INPUT_LINE = re.compile(r'^ (\S+)\s+' + HEX + r'\s+' + HEX + r'\s+(.+?)\s*$')
+SYMBOL_LINE = re.compile(r'^\s{8,}' + HEX + r'\s+([A-Za-z_.$][\w.$]*)\s*$')
+USED_LINE = re.compile(r'^\s+' + HEX + r'\s+(__\w+_used)\s*=')
+NAME_ONLY = re.compile(r'^ ?(\S+)\s*$')
+NOT_ALLOCATED = re.compile(r'^\.(debug|comment|ARM\.attributes|binlog_fmt|stab|note\.GNU-stack|gnu\.attributes)')
+
+# Input sections placed on purpose in a fast memory by the linker template
+# or the HAL, and GCC hot functions (-freorder-functions): .text.hot.<name>
+FAST_SECTIONS = ('.itcm_text*', '.RamFunc*', '.ram_text*', '.ccmram*', '.dtcm_data*')
+HOT_SECTIONS = ('.text.hot.*',)
+# Zero initialised input sections: a load address but no copy in flash
+NOBITS_SECTIONS = ('.bss*', '.sbss*', 'COMMON', '.noinit*', '.lazy_bss*', '.dma_buffers*', '.tlsf*')
+EXTERNAL_BASE = 0x60000000
+# Region usage symbols of linker.tpl
+USED_SYMBOLS = {'FLASH': '__flash_used', 'RAM': '__ram_used', 'ITCMRAM': '__itcm_used',
+                'DTCMRAM': '__dtcm_used', 'CCMRAM': '__ccmram_used'}
+
+
+class Region(object):
+    def __init__(self, name, origin, length, attributes):
+        self.name = name
+        self.origin = origin
+        self.length = length
+        self.attributes = attributes or ''
+        self.used = 0
+        self.symbol = None
+        self.objects = {}
+
+    def contains(self, address):
+        return self.origin <= address < self.origin + self.length
+
+    @property
+    def slow(self):
+        return self.name.upper().startswith('FLASH') or self.origin >= EXTERNAL_BASE
+
+
+def parse(path):
+    with open(path, errors='replace') as f:
+        text = f.read().splitlines()
+    regions = []
+    i = 0
+    while i < len(text) and not text[i].startswith('Memory Configuration'):
+        i += 1
+    i += 1
+    while i < len(text) and not text[i].startswith('Linker script and memory map'):
+        m = MEMORY_LINE.match(text[i])
+        if m and m.group(1) not in ('Name', '*default*'):
+            regions.append(Region(m.group(1), int(m.group(2), 16), int(m.group(3), 16), m.group(4)))
+        i += 1
+
+    # Join the entries ld wraps when the section name is long
+    lines = []
+    for line in text[i + 1:]:
+        if lines and NAME_ONLY.match(lines[-1]) and re.match(r'^\s+0x', line):
+            lines[-1] = lines[-1].rstrip() + ' ' + line.strip()
+        else:
+            lines.append(line)
+
+    outputs = []
+    inputs = []
+    symbols = []
+    used = {}
+    current = None
+    last_input = None
+    for line in lines:
+        m = USED_LINE.match(line)
+        if m:
+            used[m.group(2)] = int(m.group(1), 16)
+            continue
+        if not line.startswith(' '):
+            m = OUTPUT_LINE.match(line)
+            current = None
+            if m and not NOT_ALLOCATED.match(m.group(1)) and m.group(1) != '/DISCARD/':
+                current = {'name': m.group(1), 'address': int(m.group(2), 16),
+                           'size': int(m.group(3), 16),
+                           'load': int(m.group(4), 16) if m.group(4) else None}
+                outputs.append(current)
+            continue
+        if current is None:
+            continue
+        m = INPUT_LINE.match(line)
+        if m:
+            last_input = {'name': m.group(1), 'address': int(m.group(2), 16),
+                          'size': int(m.group(3), 16), 'object': m.group(4),
+                          'output': current['name'], 'load': current['load']}
+            if matches(last_input['name'], NOBITS_SECTIONS):
+                last_input['load'] = None
+            elif last_input['load'] is not None:
+                last_input['load'] += last_input['address'] - current['address']
+                current['copied'] = True
+            inputs.append(last_input)
+            continue
+        m = SYMBOL_LINE.match(line)
+        if m and last_input is not None:
+            symbols.append({'name': m.group(2), 'address': int(m.group(1), 16),
+                            'section': last_input['name'], 'object': last_input['object']})
+    for section in outputs:
+        if not section.pop('copied', False):
+            section['load'] = None
+    return regions, outputs, inputs, symbols, used
+
+
+def region_of(regions, address):
+    for region in regions:
+        if region.length and region.contains(address):
+            return region
+    return None
+
+
+def short_object(name):
+    m = re.match(r'^(.*?)\((.+)\)$', name)
+    if m:
+        return '%s(%s)' % (os.path.basename(m.group(1)), m.group(2))
+    return os.path.basename(name) if name != '*fill*' else name
+
+
+def matches(name, patterns):
+    return any(fnmatch.fnmatchcase(name, p) for p in patterns)
+
+
+def analyse(args):
+    regions, outputs, inputs, symbols, used = parse(args.map)
+    for entry in inputs:
+        if not entry['size']:
+            continue
+        places = [entry['address']]
+        if entry['load'] is not None and entry['load'] != entry['address']:
+            places.append(entry['load'])
+        for address in places:
+            region = region_of(regions, address)
+            if region:
+                region.used += entry['size']
+                obj = short_object(entry['object'])
+                region.objects[obj] = region.objects.get(obj, 0) + entry['size']
+
+    # Linker template usage symbols, which also count the heap and stack
+    # reservations, take precedence over the sum of the input sections
+    for region in regions:
+        name = USED_SYMBOLS.get(region.name)
+        if name in used:
+            region.symbol = used[name]
+
+    has_itcm = any(r.name.upper().startswith('ITCM') and r.length for r in regions)
+    warnings = []
+    for entry in inputs:
+        if not entry['size']:
+            continue
+        fast = matches(entry['name'], FAST_SECTIONS)
+        hot = matches(entry['name'], HOT_SECTIONS) and has_itcm
+        if not (fast or hot):
+            continue
+        region = region_of(regions, entry['address'])
+        if region is None or region.slow:
+            warnings.append({'name': entry['name'], 'object': short_object(entry['object']),
+                             'address': entry['address'],
+                             'region': region.name if region else None})
+    if args.hot:
+        for symbol in symbols:
+            if matches(symbol['name'], args.hot):
+                region = region_of(regions, symbol['address'])
+                if region is None or region.slow:
+                    warnings.append({'name': symbol['name'], 'object': short_object(symbol['object']),
+                                     'address': symbol['address'],
+                                     'region': region.name if region else None})
+    return regions, outputs, warnings
+
+
+def report(args, regions, outputs, warnings):
+    out = []
+    add = out.append
+    add('Memory regions')
+    add('  %-12s %-10s %10s %10s %10s %6s' % ('Region', 'Origin', 'Length', 'Used', 'Free', 'Use%'))
+    for r in regions:
+        used = r.symbol if r.symbol is not None else r.used
+        add('  %-12s 0x%08X %10d %10d %10d %5.1f%%' %
+            (r.name, r.origin, r.length, used, r.length - used, 100.0 * used / r.length if r.length else 0.0))
+    add('')
+    add('Output sections')
+    add('  %-20s %-12s %-10s %10s  %s' % ('Section', 'Region', 'Address', 'Size', 'Load'))
+    for s in outputs:
+        if not s['size']:
+            continue
+        region = region_of(regions, s['address'])
+        load = ''
+        if s['load'] is not None and s['load'] != s['address']:
+            lregion = region_of(regions, s['load'])
+            load = '0x%08X %s' % (s['load'], lregion.name if lregion else '')
+        add('  %-20s %-12s 0x%08X %10d  %s' % (s['name'], region.name if region else '-',
+                                              s['address'], s['size'], load))
+    add('')
+    add('Largest objects per region')
+    for r in regions:
+        if not r.objects:
+            continue
+        add('  %s' % r.name)
+        for obj, size in sorted(r.objects.items(), key=lambda x: -x[1])[:args.top]:
+            add('    %10d  %s' % (size, obj))
+    add('')
+    add('Hot placement')
+    if not warnings:
+        add('  ok')
+    for w in warnings:
+        add('  WARNING %s (%s) at 0x%08X in %s' %
+            (w['name'], w['object'], w['address'], w['region'] or 'no memory region'))
+    return '\n'.join(out) + '\n'
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Memory usage and hot placement report of a map file')
+    parser.add_argument('map', help='map file written by the linker with -Wl,-Map=FILE')
+    parser.add_argument('-o', '--output', help='report file, default standard output')
+    parser.add_argument('--json', metavar='FILE', help='report in JSON too')
+    parser.add_argument('--top', type=int, default=10, help='objects listed per region')
+    parser.add_argument('--hot', action='append', default=[], metavar='GLOB',
+                        help='symbol expected in a fast memory, e.g. "*_IRQHandler"')
+    parser.add_argument('--strict', action='store_true',
+                        help='exit with an error when hot code or data is in slow memory')
+    args = parser.parse_args()
+
+    regions, outputs, warnings = analyse(args)
+    text = report(args, regions, outputs, warnings)
+    if args.output:
+        with open(args.output, 'w') as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+    if args.json:
+        with open(args.json, 'w') as f:
+            json.dump({'regions': [{'name': r.name, 'origin': r.origin, 'length': r.length,
+                                    'used': r.symbol if r.symbol is not None else r.used,
+                                    'objects': r.objects} for r in regions],
+                       'sections': outputs, 'warnings': warnings}, f, indent=2)
+    for w in warnings:
+        sys.stderr.write('warning: %s (%s) placed in %s\n' %
+                         (w['name'], w['object'], w['region'] or 'no memory region'))
+    sys.exit(1 if warnings and args.strict else 0)
+
+
+if __name__ == '__main__':
+    main()
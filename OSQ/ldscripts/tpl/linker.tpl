@@ -13,14 +13,23 @@ _estack = $stack;    /* end of RAM */
 /* Generate a link error if heap and stack don't fit into RAM */
 _Min_Heap_Size = 0x200;      /* required amount of heap  */
 _Min_Stack_Size = 0x400;     /* required amount of stack */
+/* RAM bytes and external SDRAM given to the TLSF heap, 0 for none */
+_Tlsf_Ram_Size = 0;
+_Tlsf_Sdram_Start = $sdram;  /* FMC SDRAM bank 1, 0xD0000000 for bank 2 */
+_Tlsf_Sdram_Size = 0;
 
 /* Specify the memory areas */
 MEMORY
 {
     RAM (xrw)      : ORIGIN = 0x20000000, LENGTH = $ram
     FLASH (rx)      : ORIGIN = 0x8000000, LENGTH = $flash
+    ITCMRAM (xrw)      : ORIGIN = 0x00000000, LENGTH = $itcm
+    CCMRAM (rw)      : ORIGIN = 0x10000000, LENGTH = $ccmram
 }
 
+/* Size of the DTCM RAM found at the start of RAM, 0 when the part has none */
+_Dtcm_Size = $dtcm;
+
 /* Define output sections */
 SECTIONS
 {
@@ -45,6 +54,25 @@ SECTIONS
     KEEP (*(.init))
     KEEP (*(.fini))
 
+    /* Sections copied from FLASH and zeroed by SystemInit(): {load, start, end}
+       and {start, end}; in .text so that the tables stay read-only */
+    . = ALIGN(4);
+    __copy_table_start__ = .;
+    LONG (_siitcm_text)
+    LONG (_sitcm_text)
+    LONG (_eitcm_text)
+    LONG (_sidtcm_data)
+    LONG (_sdtcm_data)
+    LONG (_edtcm_data)
+    LONG (_siccmram)
+    LONG (_sccmram)
+    LONG (_eccmram)
+    __copy_table_end__ = .;
+    __zero_table_start__ = .;
+    LONG (_sdma_buffers)
+    LONG (_edma_buffers)
+    __zero_table_end__ = .;
+$lazy_table
     . = ALIGN(4);
     _etext = .;        /* define a global symbols at end of code */
   } >FLASH
@@ -86,6 +114,52 @@ SECTIONS
     PROVIDE_HIDDEN (__fini_array_end = .);
   } >FLASH
 
+  /* used by the startup to initialize the ITCM code */
+  _siitcm_text = LOADADDR(.itcm_text);
+
+  /* Code to run from zero-wait-state ITCM RAM, load LMA copy after code */
+  .itcm_text :
+  {
+    . = ALIGN(4);
+    _sitcm_text = .;   /* create a global symbol at ITCM code start */
+    *(.itcm_text)
+    *(.itcm_text*)
+
+    . = ALIGN(4);
+    _eitcm_text = .;   /* define a global symbol at ITCM code end */
+  } >ITCMRAM AT> FLASH
+
+  /* used by the startup to initialize the DTCM data */
+  _sidtcm_data = LOADADDR(.dtcm_data);
+
+  /* Initialized data kept in the DTCM RAM at the start of RAM, ahead of .data */
+  .dtcm_data :
+  {
+    . = ALIGN(4);
+    _sdtcm_data = .;   /* create a global symbol at DTCM data start */
+    *(.dtcm_data)
+    *(.dtcm_data*)
+
+    . = ALIGN(4);
+    _edtcm_data = .;   /* define a global symbol at DTCM data end */
+  } >RAM AT> FLASH
+  ASSERT(_edtcm_data <= ORIGIN(RAM) + _Dtcm_Size, "DTCM RAM overflowed by .dtcm_data")
+
+  /* used by the startup to initialize the CCM RAM data */
+  _siccmram = LOADADDR(.ccmram);
+
+  /* Initialized data in the core coupled memory, not reachable by DMA */
+  .ccmram :
+  {
+    . = ALIGN(4);
+    _sccmram = .;      /* create a global symbol at ccmram start */
+    *(.ccmram)
+    *(.ccmram*)
+
+    . = ALIGN(4);
+    _eccmram = .;      /* create a global symbol at ccmram end */
+  } >CCMRAM AT> FLASH
+
   /* used by the startup to initialize data */
   _sidata = LOADADDR(.data);
 
@@ -96,6 +170,10 @@ SECTIONS
     _sdata = .;        /* create a global symbol at data start */
     *(.data)           /* .data sections */
     *(.data*)          /* .data* sections */
+    *(.RamFunc)        /* HAL __RAM_FUNC code, run from RAM */
+    *(.RamFunc*)
+    *(.ram_text)       /* Power/ram_idle code, run while the flash is powered down */
+    *(.ram_text*)
 
     . = ALIGN(4);
     _edata = .;        /* define a global symbol at data end */
@@ -103,7 +181,7 @@ SECTIONS
   
   /* Uninitialized data section */
   . = ALIGN(4);
-  .bss :
+  .bss (NOLOAD) :
   {
     /* This is used by the startup in order to initialize the .bss secion */
     _sbss = .;         /* define a global symbol at bss start */
@@ -111,12 +189,48 @@ SECTIONS
     *(.bss)
     *(.bss*)
     *(COMMON)
-
+$lazy_in_bss
     . = ALIGN(4);
     _ebss = .;         /* define a global symbol at bss end */
     __bss_end__ = _ebss;
   } >RAM
 
+  /* DMA buffers, cache-line aligned so that maintaining one never touches another */
+  .dma_buffers (NOLOAD) :
+  {
+    . = ALIGN(32);
+    _sdma_buffers = .; /* create a global symbol at DMA buffers start */
+    *(.dma_buffers)
+    *(.dma_buffers*)
+    KEEP(*(.dma_sram))
+
+    . = ALIGN(32);
+    _edma_buffers = .; /* define a global symbol at DMA buffers end */
+  } >RAM
+$lazy_bss
+  /* Data never initialized, kept across a reset */
+  .noinit (NOLOAD) :
+  {
+    . = ALIGN(4);
+    *(.noinit)
+    *(.noinit*)
+    . = ALIGN(4);
+  } >RAM
+
+  /* TLSF heap regions (Utilities/Memory/tlsf_heap): a part of the RAM,
+     the rest of the CCM RAM and the SDRAM */
+  .tlsf_ram (NOLOAD) :
+  {
+    . = ALIGN(32);
+    __tlsf_ram_start = .;
+    . = . + _Tlsf_Ram_Size;
+    __tlsf_ram_end = .;
+  } >RAM
+  __tlsf_ccm_start = ALIGN(ADDR(.ccmram) + SIZEOF(.ccmram), 32);
+  __tlsf_ccm_end = ORIGIN(CCMRAM) + LENGTH(CCMRAM);
+  __tlsf_sdram_start = _Tlsf_Sdram_Start;
+  __tlsf_sdram_end = _Tlsf_Sdram_Start + _Tlsf_Sdram_Size;
+
   /* User_heap_stack section, used to check that there is enough RAM left */
   ._user_heap_stack :
   {
@@ -128,7 +242,13 @@ SECTIONS
     . = ALIGN(4);
   } >RAM
 
-  
+  /* Bytes used in each memory region, for diagnostics and tpl/ld_report.py;
+     RAM includes the _Min_Heap_Size and _Min_Stack_Size reservations */
+  __flash_used = LOADADDR(.data) + SIZEOF(.data) - ORIGIN(FLASH);
+  __ram_used = ADDR(._user_heap_stack) + SIZEOF(._user_heap_stack) - ORIGIN(RAM);
+  __itcm_used = SIZEOF(.itcm_text);
+  __dtcm_used = SIZEOF(.dtcm_data);
+  __ccmram_used = SIZEOF(.ccmram);
 
   /* Remove information from the standard libraries */
   /DISCARD/ :
@@ -138,6 +258,14 @@ SECTIONS
     libgcc.a ( * )
   }
 
+  /* Format strings of Utilities/Log/bin_log, read from the ELF file by
+     tpl/bin_log_decode.py and not loaded */
+  .binlog_fmt 0 (INFO) :
+  {
+    __binlog_fmt_start = .;
+    KEEP(*(.binlog_fmt*))
+  }
+
   .ARM.attributes 0 : { *(.ARM.attributes) }
 }
 
@@ -0,0 +1,248 @@
+#!/usr/bin/env python3
+#
+# QSPI boot image builder
+#
+# Converts the ELF file of an application linked for its execution
+# addresses into the segmented image loaded by Utilities/Storage/qspi_boot
+# of the H7 tree: the sections found in the QSPI memory mapped window stay
+# at their address and execute in place, the other ones (ITCM, DTCM, AXI
+# SRAM, SDRAM) are LZ4 compressed, or stored as is when that is not smaller.
+#
+# COPYRIGHT(c) 2019 STMicroelectronics
+
+import argparse
+import fnmatch
+import struct
+import sys
+import zlib
+
+MAGIC = 0x31494251          # QSPI_BOOT_MAGIC, "QBI1"
+SEGMENT_XIP = 0
+SEGMENT_COPY = 1
+SEGMENT_LZ4 = 2
+TYPE_NAMES = {SEGMENT_XIP: 'xip', SEGMENT_COPY: 'copy', SEGMENT_LZ4: 'lz4'}
+BLOCK_RAW = 0x80000000      # QSPI_BOOT_BLOCK_RAW
+HEADER_SIZE = 20            # QSPI_Boot_HeaderTypeDef
+SEGMENT_SIZE = 20           # QSPI_Boot_SegmentTypeDef
+QSPI_WINDOW = 0x10000000
+
+# Sections closer than this are merged in one segment, the gap zero filled
+MERGE_GAP = 64
+
+# LZ4 block format: minimum match, last literals, last match start
+MIN_MATCH = 4
+LAST_LITERALS = 5
+MF_LIMIT = 12
+MAX_OFFSET = 65535
+
+# Memories of the STM32H7, for the report
+REGIONS = ((0x00000000, 0x00010000, 'ITCM'), (0x20000000, 0x00020000, 'DTCM'),
+           (0x24000000, 0x00080000, 'AXI SRAM'), (0x30000000, 0x00048000, 'D2 SRAM'),
+           (0x38000000, 0x00010000, 'D3 SRAM'), (0xC0000000, 0x20000000, 'SDRAM'))
+
+SHT_NOBITS = 8
+SHF_ALLOC = 0x2
+
+
+class Section(object):
+    def __init__(self, name, address, data):
+        self.name = name
+        self.address = address
+        self.data = data
+
+
+class Segment(object):
+    def __init__(self, kind, address):
+        self.kind = kind
+        self.address = address
+        self.data = bytearray()
+        self.names = []
+        self.stored = b''
+        self.offset = 0
+
+    @property
+    def end(self):
+        return self.address + len(self.data)
+
+
+def read_elf(path):
+    with open(path, 'rb') as f:
+        elf = f.read()
+    if elf[:4] != b'\x7fELF' or elf[4] != 1 or elf[5] != 1:
+        sys.exit('%s: not a 32-bit little endian ELF file' % path)
+    shoff, = struct.unpack_from('<I', elf, 32)
+    shentsize, shnum, shstrndx = struct.unpack_from('<HHH', elf, 46)
+    headers = [struct.unpack_from('<IIIIIIIIII', elf, shoff + i * shentsize) for i in range(shnum)]
+    strtab = headers[shstrndx][4]
+    sections = []
+    for name, kind, flags, address, offset, size in (h[:6] for h in headers):
+        if not flags & SHF_ALLOC or size == 0 or kind == SHT_NOBITS:
+            continue
+        label = elf[strtab + name:elf.index(b'\0', strtab + name)].decode()
+        sections.append(Section(label, address, elf[offset:offset + size]))
+    return sorted(sections, key=lambda s: s.address)
+
+
+def region(address):
+    for origin, length, name in REGIONS:
+        if origin <= address < origin + length:
+            return name
+    return 'RAM'
+
+
+def put_length(out, length):
+    while length >= 255:
+        out.append(255)
+        length -= 255
+    out.append(length)
+
+
+def put_sequence(out, literals, offset=None, match=0):
+    token = min(len(literals), 15) << 4
+    if offset is not None:
+        token |= min(match - MIN_MATCH, 15)
+    out.append(token)
+    if len(literals) >= 15:
+        put_length(out, len(literals) - 15)
+    out += literals
+    if offset is not None:
+        out += struct.pack('<H', offset)
+        if match - MIN_MATCH >= 15:
+            put_length(out, match - MIN_MATCH - 15)
+
+
+def lz4_block(data, start, end, table):
+    """Compress data[start:end] as one LZ4 block. Matches may reach into the
+    previous blocks: qspi_boot decompresses a segment in place."""
+    out = bytearray()
+    anchor = position = start
+    while position < end - MF_LIMIT:
+        key = bytes(data[position:position + MIN_MATCH])
+        candidate = table.get(key)
+        table[key] = position
+        if candidate is None or position - candidate > MAX_OFFSET:
+            position += 1
+            continue
+        length = MIN_MATCH
+        longest = end - LAST_LITERALS - position
+        while length < longest and data[candidate + length] == data[position + length]:
+            length += 1
+        put_sequence(out, data[anchor:position], position - candidate, length)
+        for i in range(position + 1, min(position + length, end - MF_LIMIT)):
+            table[bytes(data[i:i + MIN_MATCH])] = i
+        position += length
+        anchor = position
+    put_sequence(out, data[anchor:end])
+    return out
+
+
+def compress(data, block):
+    """LZ4 segment: blocks of at most block bytes, each with a header of its
+    stored size and padded to 4 bytes."""
+    out = bytearray()
+    table = {}
+    for start in range(0, len(data), block):
+        end = min(start + block, len(data))
+        packed = lz4_block(data, start, end, table)
+        if len(packed) < end - start:
+            out += struct.pack('<I', len(packed)) + packed
+        else:
+            out += struct.pack('<I', (end - start) | BLOCK_RAW) + data[start:end]
+        out += b'\0' * (-len(out) % 4)
+    return bytes(out)
+
+
+def segments(sections, base, raw):
+    result = []
+    for section in sections:
+        if base <= section.address < base + QSPI_WINDOW:
+            kind = SEGMENT_XIP
+        elif any(fnmatch.fnmatch(section.name, pattern) for pattern in raw):
+            kind = SEGMENT_COPY
+        else:
+            kind = SEGMENT_LZ4
+        last = result[-1] if result else None
+        if last is None or last.kind != kind or not 0 <= section.address - last.end <= MERGE_GAP:
+            last = Segment(kind, section.address)
+            result.append(last)
+        last.data += b'\0' * (section.address - last.end) + section.data
+        last.names.append(section.name)
+    return result
+
+
+def build(args):
+    sections = read_elf(args.elf)
+    vectors = [s for s in sections if s.name == args.vectors]
+    if not vectors:
+        sys.exit('%s: no %s section' % (args.elf, args.vectors))
+    result = segments(sections, args.base, args.raw)
+    if len(result) > args.max_segments:
+        sys.exit('%d segments, more than QSPI_BOOT_MAX_SEGMENTS (%d)' % (len(result), args.max_segments))
+
+    table_end = HEADER_SIZE + SEGMENT_SIZE * len(result)
+    image = bytearray(b'\xff' * table_end)
+    for segment in result:
+        if segment.kind != SEGMENT_XIP:
+            continue
+        segment.offset = segment.address - args.base
+        if segment.offset < table_end:
+            sys.exit('%s at 0x%08X overlaps the image header: link the QSPI sections from 0x%08X'
+                     % (segment.names[0], segment.address, args.base + ((table_end + 255) & ~255)))
+        if segment.offset < len(image):
+            sys.exit('%s at 0x%08X overlaps the previous segment' % (segment.names[0], segment.address))
+        image += b'\xff' * (segment.offset - len(image)) + segment.data
+        segment.stored = segment.data
+
+    for segment in result:
+        if segment.kind == SEGMENT_XIP:
+            continue
+        if segment.kind == SEGMENT_LZ4:
+            segment.stored = compress(segment.data, args.block)
+            if len(segment.stored) >= len(segment.data):
+                segment.kind = SEGMENT_COPY
+        if segment.kind == SEGMENT_COPY:
+            segment.stored = bytes(segment.data)
+        image += b'\xff' * (-len(image) % 4)
+        segment.offset = len(image)
+        image += segment.stored
+
+    table = b''.join(struct.pack('<IIIII', s.kind, s.offset, len(s.stored), s.address, len(s.data))
+                     for s in result)
+    image[:table_end] = struct.pack('<IIIII', MAGIC, len(result), vectors[0].address, len(image),
+                                    zlib.crc32(table) & 0xFFFFFFFF) + table
+    with open(args.output, 'wb') as f:
+        f.write(image)
+    return result, image
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Build a qspi_boot image from an ELF file')
+    parser.add_argument('elf', help='application linked for its execution addresses')
+    parser.add_argument('output', help='image, to program at --base')
+    parser.add_argument('--base', type=lambda v: int(v, 0), default=0x90000000,
+                        help='address of the image in the memory mapped region (default 0x90000000)')
+    parser.add_argument('--block', type=lambda v: int(v, 0), default=4096,
+                        help='LZ4 block size, QSPI_BOOT_BLOCK_SIZE (default 4096)')
+    parser.add_argument('--max-segments', type=int, default=32,
+                        help='QSPI_BOOT_MAX_SEGMENTS (default 32)')
+    parser.add_argument('--vectors', default='.isr_vector',
+                        help='section of the vector table (default .isr_vector)')
+    parser.add_argument('--raw', action='append', default=[], metavar='GLOB',
+                        help='sections stored uncompressed, ex. compressed assets')
+    parser.add_argument('-q', '--quiet', action='store_true', help='no segment report')
+    args = parser.parse_args()
+
+    result, image = build(args)
+    if args.quiet:
+        return
+    loaded = 0
+    for s in result:
+        where = 'QSPI' if s.kind == SEGMENT_XIP else region(s.address)
+        print('%-4s 0x%08X %8d -> %8d  %-8s %s' % (TYPE_NAMES[s.kind], s.address, len(s.data),
+                                                  len(s.stored), where, ' '.join(s.names)))
+        loaded += len(s.data)
+    print('image %d bytes for %d bytes of sections' % (len(image), loaded))
+
+
+if __name__ == '__main__':
+    main()
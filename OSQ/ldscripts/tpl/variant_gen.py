@@ -0,0 +1,300 @@
+#!/usr/bin/env python3
+#
+# Board variant generator
+#
+# Renders linker.tpl and the variant_memory.h header of a board from its
+# memory, cache and DMA description in OSQ/variants_meta.json, checks that
+# description, and regenerates the *_DEFAULT.ld scripts from the template.
+#
+# COPYRIGHT(c) 2019 STMicroelectronics
+
+import argparse
+import json
+import os
+import re
+import string
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+OSQ = os.path.normpath(os.path.join(HERE, '..', '..'))
+LDSCRIPTS = os.path.join(OSQ, 'ldscripts')
+TEMPLATE = os.path.join(HERE, 'linker.tpl')
+META = os.path.join(OSQ, 'variants_meta.json')
+SCHEMA = os.path.join(OSQ, 'variants_meta.schema.json')
+REMAP = os.path.join(OSQ, 'variants_remap.json')
+
+ATTRIBUTES = ('dma', 'cacheable', 'fast', 'retained')
+# Same values as TLSF_ATTR_xxx of Utilities/Memory/tlsf_heap.h
+ATTR_FLAGS = (('dma', 'VARIANT_ATTR_DMA', 0x01), ('cacheable', 'VARIANT_ATTR_CACHEABLE', 0x02),
+              ('fast', 'VARIANT_ATTR_FAST', 0x04), ('external', 'VARIANT_ATTR_EXTERNAL', 0x08),
+              ('retained', 'VARIANT_ATTR_RETAINED', 0x10))
+SDRAM_BANKS = {5: 0xC0000000, 6: 0xD0000000}
+DEFAULT_SDRAM = '0xC0000000'
+
+# Families with Utilities/Memory/lazy_init: .lazy_bss is left alone by the
+# startup code and listed in a lazy table. The others keep it in .bss.
+LAZY_FAMILIES = ('STM32F7', 'STM32H7')
+LAZY_TABLE = '''
+    /* Sections zeroed after the startup by Utilities/Memory/lazy_init: {start, end} */
+    __lazy_table_start__ = .;
+    LONG (_slazy_bss)
+    LONG (_elazy_bss)
+    __lazy_table_end__ = .;
+'''
+LAZY_BSS = '''
+  /* Zero-initialized data left alone by the startup code and zeroed once the
+     clocks run at full speed, or on first use, by Utilities/Memory/lazy_init */
+  .lazy_bss (NOLOAD) :
+  {
+    . = ALIGN(32);
+    _slazy_bss = .;    /* create a global symbol at lazy bss start */
+    *(.lazy_bss)
+    *(.lazy_bss*)
+
+    . = ALIGN(32);
+    _elazy_bss = .;    /* define a global symbol at lazy bss end */
+  } >RAM
+'''
+LAZY_IN_BSS = '''    *(.lazy_bss)       /* no lazy_init on this family, zeroed with .bss */
+    *(.lazy_bss*)
+'''
+
+
+def size_of(text):
+    m = re.match(r'^(\d+)([KM]?)$', text)
+    if not m:
+        raise ValueError('bad size %s' % text)
+    return int(m.group(1)) << {'': 0, 'K': 10, 'M': 20}[m.group(2)]
+
+
+def load(path):
+    with open(path) as f:
+        return json.load(f)
+
+
+def check(meta, remap):
+    """Consistency of the description, beyond variants_meta.schema.json:
+    boards and BSP of variants_remap.json, addresses and sizes, and the
+    MEMORY block of the *_FLASH.ld script of the part when there is one."""
+    errors = []
+    try:
+        import jsonschema
+        validator = jsonschema.Draft7Validator(load(SCHEMA))
+        errors += ['%s: %s' % ('/'.join(str(p) for p in e.path), e.message)
+                   for e in validator.iter_errors(meta)]
+    except ImportError:
+        pass
+    for board in sorted(set(remap) ^ set(meta)):
+        errors.append('%s: in only one of variants_remap.json and variants_meta.json' % board)
+    for board, desc in sorted(meta.items()):
+        def error(text):
+            errors.append('%s: %s' % (board, text))
+        if board in remap and remap[board] != desc['bsp']:
+            error('BSP %s, variants_remap.json has %s' % (desc['bsp'], remap[board]))
+        if desc['cache'] and desc['dma']['align'] % desc['cache']['line']:
+            error('DMA alignment is not a multiple of the cache line')
+        regions = dict(desc['memory'])
+        regions.update(desc['external'])
+        for name, region in sorted(regions.items()):
+            try:
+                size_of(region['length'])
+            except ValueError as e:
+                error('%s: %s' % (name, e))
+                continue
+            for attr in region['attributes']:
+                if attr not in ATTRIBUTES:
+                    error('%s: unknown attribute %s' % (name, attr))
+            if 'cacheable' in region['attributes'] and not desc['cache']:
+                error('%s: cacheable on a part without D-cache' % name)
+            if 'dma' in region['attributes'] and not desc['dma']['controllers']:
+                error('%s: DMA reachable on a part without DMA' % name)
+            parent = region.get('within')
+            if parent:
+                outer = desc['memory'].get(parent)
+                if not outer:
+                    error('%s: within unknown region %s' % (name, parent))
+                elif (int(region['origin'], 16) < int(outer['origin'], 16) or
+                      int(region['origin'], 16) + size_of(region['length']) >
+                      int(outer['origin'], 16) + size_of(outer['length'])):
+                    error('%s: outside of %s' % (name, parent))
+        for name, ext in desc['external'].items():
+            if ext['interface'] == 'FMC' and ext.get('bank') in SDRAM_BANKS and \
+                    int(ext['origin'], 16) != SDRAM_BANKS[ext['bank']]:
+                error('%s: origin is not the one of FMC bank %d' % (name, ext['bank']))
+        script = os.path.join(LDSCRIPTS, desc['mcu'] + '_FLASH.ld')
+        if os.path.exists(script):
+            for name, length in linker_memory(script).items():
+                region = desc['memory'].get(name)
+                if region and size_of(region['length']) != size_of(length):
+                    error('%s: %s, %s has %s' % (name, region['length'],
+                                                 os.path.basename(script), length))
+    return errors
+
+
+def linker_memory(path):
+    with open(path) as f:
+        text = f.read()
+    block = re.search(r'^MEMORY\s*\{(.*?)\}', text, re.M | re.S)
+    return dict(re.findall(r'^\s*(\w+)\s*\([^)]*\)\s*:\s*ORIGIN\s*=\s*\w+\s*,\s*LENGTH\s*=\s*(\w+)',
+                           block.group(1), re.M)) if block else {}
+
+
+def render_linker(values):
+    lazy = values['mcu'].startswith(LAZY_FAMILIES)
+    values = dict(values, lazy_table=LAZY_TABLE if lazy else '',
+                  lazy_bss=LAZY_BSS if lazy else '', lazy_in_bss='' if lazy else LAZY_IN_BSS)
+    with open(TEMPLATE) as f:
+        return string.Template(f.read()).substitute(values)
+
+
+def board_values(desc):
+    mem = desc['memory']
+    ram = mem['RAM']
+    sdram = [e for e in desc['external'].values() if e.get('bank') in SDRAM_BANKS]
+    return {
+        'mcu': desc['mcu'],
+        'stack': '0x%08X' % (int(ram['origin'], 16) + size_of(ram['length'])),
+        'ram': ram['length'],
+        'flash': mem['FLASH']['length'],
+        'itcm': mem['ITCMRAM']['length'] if 'ITCMRAM' in mem else '0K',
+        'ccmram': mem['CCMRAM']['length'] if 'CCMRAM' in mem else '0K',
+        'dtcm': mem['DTCMRAM']['length'] if 'DTCMRAM' in mem else '0K',
+        'sdram': sdram[0]['origin'] if sdram else DEFAULT_SDRAM,
+    }
+
+
+def default_values(path):
+    """Values a *_DEFAULT.ld script was rendered with."""
+    with open(path) as f:
+        text = f.read()
+    memory = linker_memory(path)
+    m = re.search(r'^_estack\s*=\s*(\w+)', text, re.M)
+    dtcm = re.search(r'^_Dtcm_Size\s*=\s*(\w+)', text, re.M)
+    sdram = re.search(r'^_Tlsf_Sdram_Start\s*=\s*(\w+)', text, re.M)
+    return {'mcu': os.path.basename(path), 'stack': m.group(1),
+            'ram': memory['RAM'], 'flash': memory['FLASH'],
+            'itcm': memory.get('ITCMRAM', '0K'), 'ccmram': memory.get('CCMRAM', '0K'),
+            'dtcm': dtcm.group(1) if dtcm else '0K',
+            'sdram': sdram.group(1) if sdram else DEFAULT_SDRAM}
+
+
+def attr_expr(attributes):
+    names = [macro for key, macro, _ in ATTR_FLAGS if key in attributes]
+    return '(%s)' % ' | '.join(names) if names else '0U'
+
+
+def render_header(board, desc):
+    lines = []
+    add = lines.append
+
+    def define(name, value, comment=None):
+        text = '#define %-32s %s' % (name, value)
+        if comment:
+            text = '%-60s /* %s */' % (text, comment)
+        add(text)
+
+    add('/**')
+    add('  ******************************************************************************')
+    add('  * @file    variant_memory.h')
+    add('  * @brief   Memory, cache and DMA description of the %s board, generated' % board)
+    add('  *          by variant_gen.py from OSQ/variants_meta.json, do not edit.')
+    add('  ******************************************************************************')
+    add('  */')
+    add('')
+    add('/* Define to prevent recursive inclusion -------------------------------------*/')
+    add('#ifndef _VARIANT_MEMORY_H__')
+    add('#define _VARIANT_MEMORY_H__')
+    add('')
+    add('/* Exported constants --------------------------------------------------------*/')
+    add('/* Region attributes, same values as TLSF_ATTR_xxx */')
+    for _, macro, value in ATTR_FLAGS:
+        define(macro, '0x%02XU' % value)
+    add('')
+    define('VARIANT_BOARD', '"%s"' % board)
+    define('VARIANT_MCU', '"%s"' % desc['mcu'])
+    cache = desc['cache']
+    define('VARIANT_ICACHE_SIZE', '%dU' % (cache['icache'] if cache else 0))
+    define('VARIANT_DCACHE_SIZE', '%dU' % (cache['dcache'] if cache else 0))
+    define('VARIANT_DCACHE_LINE_SIZE', '%dU' % (cache['line'] if cache else 0))
+    define('VARIANT_DMA_ALIGN', '%dU' % desc['dma']['align'], 'Buffer alignment and size granule')
+    for controller in desc['dma']['controllers']:
+        define('VARIANT_HAS_%s' % controller, '1U')
+    add('')
+    for name, region in desc['memory'].items():
+        define('VARIANT_%s_BASE' % name, '0x%08XU' % int(region['origin'], 16))
+        define('VARIANT_%s_SIZE' % name, '0x%08XU' % size_of(region['length']))
+        define('VARIANT_%s_ATTR' % name, attr_expr(region['attributes']))
+    for name, ext in desc['external'].items():
+        define('VARIANT_%s_BASE' % name, '0x%08XU' % int(ext['origin'], 16))
+        define('VARIANT_%s_SIZE' % name, '0x%08XU' % size_of(ext['length']))
+        define('VARIANT_%s_ATTR' % name, attr_expr(ext['attributes'] + ['external']))
+        if 'bank' in ext:
+            define('VARIANT_%s_FMC_BANK' % name, '%dU' % ext['bank'])
+        if 'width' in ext:
+            define('VARIANT_%s_WIDTH' % name, '%dU' % ext['width'])
+    add('')
+    # Utilities settings following from the description, main.h still wins
+    # when it defines them before including this header.
+    overrides = []
+    sdram = [(n, e) for n, e in desc['external'].items() if e.get('bank') in SDRAM_BANKS]
+    if sdram and cache:
+        overrides.append(('PERF_BOOT_SDRAM_ADDR', 'VARIANT_%s_BASE' % sdram[0][0]))
+        overrides.append(('PERF_BOOT_SDRAM_SIZE', 'VARIANT_%s_SIZE' % sdram[0][0]))
+    if 'QSPI' in desc['external'] and cache:
+        overrides.append(('PERF_BOOT_QSPI_SIZE', 'VARIANT_QSPI_SIZE'))
+    if overrides:
+        add('/* Utilities settings following from the memory map, defined first in main.h')
+        add('   to override */')
+        for name, value in overrides:
+            add('#if !defined(%s)' % name)
+            define(name, value)
+            add('#endif')
+        add('')
+    add('#endif /* _VARIANT_MEMORY_H__ */')
+    add('')
+    return '\n'.join(lines)
+
+
+def write(path, text):
+    with open(path, 'w', newline='\n') as f:
+        f.write(text)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generate board files from variants_meta.json')
+    parser.add_argument('board', nargs='?', help='board of variants_remap.json')
+    parser.add_argument('--ld', metavar='FILE', help='linker script rendered from linker.tpl')
+    parser.add_argument('--header', metavar='FILE', help='variant_memory.h header')
+    parser.add_argument('--check', action='store_true', help='check variants_meta.json')
+    parser.add_argument('--defaults', action='store_true',
+                        help='regenerate the *_DEFAULT.ld scripts from linker.tpl')
+    args = parser.parse_args()
+
+    meta = load(META)
+    if args.check:
+        errors = check(meta, load(REMAP))
+        for text in errors:
+            print(text)
+        print('%d boards, %d errors' % (len(meta), len(errors)))
+        sys.exit(1 if errors else 0)
+
+    if args.defaults:
+        for name in sorted(os.listdir(LDSCRIPTS)):
+            if name.endswith('_DEFAULT.ld'):
+                path = os.path.join(LDSCRIPTS, name)
+                write(path, render_linker(default_values(path)))
+        return
+
+    if not args.board or not (args.ld or args.header):
+        parser.error('a board and --ld or --header are required')
+    if args.board not in meta:
+        sys.exit('error: %s is not in variants_meta.json' % args.board)
+    desc = meta[args.board]
+    if args.ld:
+        write(args.ld, render_linker(board_values(desc)))
+    if args.header:
+        write(args.header, render_header(args.board, desc))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,343 @@
+#!/usr/bin/env python3
+#
+# Prebuilt HAL/LL libraries
+#
+# Compiles the HAL and LL drivers of a family once per product line and
+# floating point ABI into static archives, plain objects and optionally LTO
+# objects, so that the application build only compiles its own sources. The
+# archive for a board is selected from its name in variants_remap.json.
+#
+# COPYRIGHT(c) 2019 STMicroelectronics
+
+import argparse
+import concurrent.futures
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+
+ROOT = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..'))
+VARIANTS = os.path.join(ROOT, 'OSQ', 'variants_remap.json')
+META = os.path.join(ROOT, 'OSQ', 'variants_meta.json')
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+# Core and FPU of each family; F7 product lines with a double precision FPU
+# are listed apart.
+FAMILIES = {
+    'f0': {'cpu': 'cortex-m0', 'fpu': None},
+    'f1': {'cpu': 'cortex-m3', 'fpu': None},
+    'f2': {'cpu': 'cortex-m3', 'fpu': None},
+    'f3': {'cpu': 'cortex-m4', 'fpu': 'fpv4-sp-d16'},
+    'f4': {'cpu': 'cortex-m4', 'fpu': 'fpv4-sp-d16'},
+    'f7': {'cpu': 'cortex-m7', 'fpu': 'fpv5-sp-d16', 'fpu_dp': ('STM32F76', 'STM32F77')},
+    'h7': {'cpu': 'cortex-m7', 'fpu': 'fpv5-d16'},
+    'l0': {'cpu': 'cortex-m0plus', 'fpu': None},
+    'l1': {'cpu': 'cortex-m3', 'fpu': None},
+    'l4': {'cpu': 'cortex-m4', 'fpu': 'fpv4-sp-d16'},
+}
+
+# Configuration switches which change the handle layouts or the driver
+# behaviour: the application hal_conf.h must keep the library values.
+CONF_LOCKED = re.compile(r'^\s*#define\s+(USE_\w+|TICK_INT_PRIORITY|PREFETCH_ENABLE|'
+                         r'INSTRUCTION_CACHE_ENABLE|DATA_CACHE_ENABLE|ART_ACCLERATOR_ENABLE|'
+                         r'\w+_BUFFER_SIZE|ETH_[RT]XBUFNB|ETH_[RT]X_BUF_SIZE)\s+(.+?)\s*(/\*.*)?$', re.M)
+CONF_MODULE = re.compile(r'^\s*#define\s+(HAL_\w+_MODULE_ENABLED)\b', re.M)
+DRIVER = re.compile(r'^stm32\w\dxx_(hal|ll)\w*\.c$')
+GUARD = re.compile(r'^#ifdef\s+(HAL_\w+_MODULE_ENABLED)|^#if\s*\(?\s*(USE_HAL_TRACE)\b', re.M)
+
+
+def family_paths(family):
+    upper = family.upper()
+    drivers = os.path.join(ROOT, family, 'Drivers')
+    return {
+        'src': os.path.join(drivers, 'STM32%sxx_HAL_Driver' % upper, 'Src'),
+        'inc': os.path.join(drivers, 'STM32%sxx_HAL_Driver' % upper, 'Inc'),
+        'device': os.path.join(drivers, 'CMSIS', 'Device', 'ST', 'STM32%sxx' % upper, 'Include'),
+        'cmsis': os.path.join(drivers, 'CMSIS', 'Include'),
+        'conf': 'stm32%sxx_hal_conf.h' % family,
+    }
+
+
+def product_lines(family):
+    """Device defines of the family, from the CMSIS device headers:
+    stm32f103xb.h gives STM32F103xB."""
+    device = family_paths(family)['device']
+    if not os.path.isdir(device):
+        return []
+    lines = []
+    for name in sorted(os.listdir(device)):
+        m = re.match(r'^stm32%s(\w+)\.h$' % family, name)
+        if not m or m.group(1) == 'xx':
+            continue
+        lines.append('STM32' + ''.join(c if c == 'x' else c.upper()
+                                       for c in family + m.group(1)))
+    return lines
+
+
+def variant_device(variant, strict=True):
+    """Family and device define of a board of variants_remap.json, from
+    variants_meta.json or else by matching the part number in the board name
+    against the device headers, 'x' in either one matching any character.
+    None when the family of the board has no device headers in this package
+    and strict is False."""
+    if os.path.exists(META):
+        with open(META) as f:
+            desc = json.load(f).get(variant)
+        if desc:
+            family = desc['mcu'][5:7].lower()
+            if desc['device'] in product_lines(family):
+                return family, desc['device']
+            if not strict:
+                return None
+            sys.exit('error: variant %s, no device header for %s' % (variant, desc['device']))
+    parts = variant.split('_')
+    if len(parts) < 2 or not re.match(r'^[fhl]\d', parts[1]):
+        sys.exit('error: no part number in variant %s' % variant)
+    part = parts[1].lower()
+    family = part[:2]
+    if family not in FAMILIES:
+        sys.exit('error: variant %s, family %s is not supported' % (variant, family))
+    lines = product_lines(family)
+    if not lines and not strict:
+        return None
+    found = []
+    for line in lines:
+        stem = line[5:].lower()
+        chip = part.ljust(len(stem), 'x')
+        if len(chip) == len(stem) and all(a == b or 'x' in (a, b) for a, b in zip(chip, stem)):
+            found.append(line)
+    if len(found) != 1:
+        sys.exit('error: variant %s matches %s, use --device' %
+                 (variant, ', '.join(found) if found else 'no device header'))
+    return family, found[0]
+
+
+def fpu_of(family, device):
+    desc = FAMILIES[family]
+    if desc['fpu'] and device.startswith(desc.get('fpu_dp', ('-',))):
+        return 'fpv5-d16'
+    return desc['fpu']
+
+
+def abi_of(family, device, float_abi):
+    return float_abi if fpu_of(family, device) else 'soft'
+
+
+def cpu_flags(family, device, float_abi):
+    flags = ['-mcpu=' + FAMILIES[family]['cpu'], '-mthumb']
+    fpu = fpu_of(family, device)
+    if fpu and float_abi != 'soft':
+        flags += ['-mfpu=' + fpu, '-mfloat-abi=' + float_abi]
+    else:
+        flags += ['-mfloat-abi=soft']
+    return flags
+
+
+def stage_include(family, out):
+    """Include directory delivered with the libraries: hal_prebuilt.h/.c and,
+    for families without a hal_conf.h in their driver directory, the template
+    with every module enabled the libraries are built with. A hal_conf.h next
+    to the HAL headers is always the one used, by the libraries as by the
+    application."""
+    paths = family_paths(family)
+    include = os.path.join(out, family, 'include')
+    os.makedirs(include, exist_ok=True)
+    for name in ('hal_prebuilt.h', 'hal_prebuilt.c'):
+        shutil.copy(os.path.join(HERE, name), include)
+    conf = os.path.join(paths['inc'], paths['conf'])
+    if not os.path.exists(conf):
+        shutil.copy(os.path.join(paths['inc'], paths['conf'].replace('.h', '_template.h')),
+                    os.path.join(include, paths['conf']))
+        conf = os.path.join(include, paths['conf'])
+    with open(conf, errors='replace') as f:
+        return include, f.read()
+
+
+def sources(family):
+    src = family_paths(family)['src']
+    return sorted(n for n in os.listdir(src)
+                  if DRIVER.match(n) and not n.endswith('_template.c'))
+
+
+def module_of(family, name):
+    """Switch compiling a driver in, from its first guard: the archive member
+    is only linked when the application enables it."""
+    if DRIVER.match(name).group(1) == 'll':
+        return 'USE_FULL_LL_DRIVER'
+    with open(os.path.join(family_paths(family)['src'], name), errors='replace') as f:
+        m = GUARD.search(f.read())
+    return (m.group(1) or m.group(2)) if m else 'HAL_MODULE_ENABLED'
+
+
+def conf_values(text):
+    """Locked switches of a hal_conf.h, casts and suffixes removed so that
+    0x0FU and ((uint32_t)0x0F) compare equal."""
+    values = {}
+    for key, value, _ in CONF_LOCKED.findall(text):
+        value = re.sub(r'\(\s*uint\d+_t\s*\)|[()\s]', '', value)
+        value = re.sub(r'(?<=[0-9a-fA-F])[uUlL]+\b', '', value)
+        try:
+            value = str(int(value, 0))
+        except ValueError:
+            pass
+        values[key] = value
+    return values
+
+
+def compile_one(cmd):
+    result = subprocess.run(cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                            universal_newlines=True)
+    return cmd[-1], result.returncode, result.stdout
+
+
+def build(args, family, device, include, conf):
+    paths = family_paths(family)
+    lto = ['', '_lto'] if args.lto else ['']
+    abi = abi_of(family, device, args.float_abi)
+    target = os.path.join(args.out, family, device, abi)
+    os.makedirs(target, exist_ok=True)
+    flags = cpu_flags(family, device, abi) + [
+        '-D' + device, '-DUSE_HAL_DRIVER', '-DUSE_FULL_LL_DRIVER',
+        '-include', 'hal_prebuilt.h',
+        '-I' + include, '-I' + paths['inc'], '-I' + paths['device'], '-I' + paths['cmsis'],
+        '-Os', '-g', '-Wall', '-ffunction-sections', '-fdata-sections'] + args.cflags
+    names = sources(family)
+    report = {'family': family, 'device': device, 'float_abi': abi,
+              'cflags': cpu_flags(family, device, abi) + ['-D' + device],
+              'config': conf_values(conf), 'modules': {}, 'archives': []}
+    for name in names:
+        report['modules'].setdefault(module_of(family, name), []).append(name[:-2] + '.o')
+
+    for suffix in lto:
+        objdir = os.path.join(target, 'obj' + suffix)
+        os.makedirs(objdir, exist_ok=True)
+        extra = ['-flto', '-ffat-lto-objects'] if suffix else []
+        jobs = []
+        for name in names:
+            obj = os.path.join(objdir, name[:-2] + '.o')
+            jobs.append([args.prefix + 'gcc'] + flags + extra +
+                        ['-c', '-o', obj, os.path.join(paths['src'], name)])
+        failed = 0
+        with concurrent.futures.ThreadPoolExecutor(args.jobs) as pool:
+            for name, code, output in pool.map(compile_one, jobs):
+                if output:
+                    sys.stderr.write(output)
+                if code:
+                    failed += 1
+                    sys.stderr.write('error: %s does not compile for %s\n' % (name, device))
+        if failed:
+            sys.exit(1)
+        archive = os.path.join(target, 'libhal%s.a' % suffix)
+        if os.path.exists(archive):
+            os.remove(archive)
+        ar = args.prefix + ('gcc-ar' if suffix else 'ar')
+        subprocess.check_call([ar, 'rcs', archive] +
+                              [os.path.join(objdir, n[:-2] + '.o') for n in names])
+        shutil.rmtree(objdir)
+        report['archives'].append(os.path.basename(archive))
+
+    with open(os.path.join(target, 'hal.json'), 'w') as f:
+        json.dump(report, f, indent=2, sort_keys=True)
+    print('%s %s %s: %d drivers, %s' % (family, device, abi, len(names),
+                                        ', '.join(report['archives'])))
+
+
+def check_conf(args, path):
+    """Compares an application hal_conf.h with the one of the libraries of its
+    family: the locked switches must be equal, the modules may be a subset,
+    the drivers of the others are then never linked."""
+    with open(path) as f:
+        app = f.read()
+    m = re.search(r'"stm32(\w\d)xx_hal_\w+\.h"', app)
+    if not m:
+        sys.exit('error: %s is not a hal_conf.h' % path)
+    with open(os.path.join(args.out, 'variants.json')) as f:
+        variants = json.load(f)
+    libs = sorted(set(v['lib'] for k, v in variants.items()
+                      if v['family'] == m.group(1) and (not args.variant or k in args.variant)))
+    if not libs:
+        sys.exit('error: no %s library built in %s' % (m.group(1), args.out))
+    app_config = conf_values(app)
+    enabled = set(CONF_MODULE.findall(app))
+    status = 0
+    for lib in libs:
+        with open(os.path.join(args.out, lib, 'hal.json')) as f:
+            report = json.load(f)
+        for key, value in sorted(report['config'].items()):
+            if app_config.get(key, value) != value:
+                print('%s: %s is %s, the library is built with %s' %
+                      (lib, key, app_config[key], value))
+                status = 1
+        dropped = sorted(k for k in report['modules']
+                         if k.startswith('HAL_') and k != 'HAL_MODULE_ENABLED' and k not in enabled)
+        if dropped:
+            print('%s: not linked: %s' % (lib, ' '.join(dropped)))
+    return status
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Build the prebuilt HAL/LL libraries')
+    parser.add_argument('-o', '--out', default=os.path.join(ROOT, 'OSQ', 'prebuilt', 'lib'),
+                        help='output directory, default OSQ/prebuilt/lib')
+    parser.add_argument('--variant', action='append', default=[],
+                        help='board of variants_remap.json, default all of them')
+    parser.add_argument('--device', action='append', default=[], metavar='FAMILY:DEFINE',
+                        help='product line not covered by a board, e.g. h7:STM32H750xx')
+    parser.add_argument('--float-abi', choices=('hard', 'softfp', 'soft'), default='hard',
+                        help='ignored, soft, on families without FPU')
+    parser.add_argument('--lto', action='store_true',
+                        help='also build libhal_lto.a of fat LTO objects')
+    parser.add_argument('--prefix', default='arm-none-eabi-', help='toolchain prefix')
+    parser.add_argument('-j', '--jobs', type=int, default=os.cpu_count() or 1)
+    parser.add_argument('--cflags', action='append', default=[], help='extra compiler flag')
+    parser.add_argument('--check-conf', metavar='HAL_CONF',
+                        help='check an application hal_conf.h against built libraries')
+    args = parser.parse_args()
+    args.out = os.path.abspath(args.out)
+
+    if args.check_conf:
+        sys.exit(check_conf(args, args.check_conf))
+
+    with open(VARIANTS) as f:
+        boards = args.variant or sorted(json.load(f))
+    targets = {}
+    selected = {}
+    for board in boards:
+        found = variant_device(board, strict=bool(args.variant))
+        if not found:
+            print('%s: no device headers for this family, skipped' % board)
+            continue
+        targets[found] = True
+        selected[board] = found
+    for item in args.device:
+        family, _, device = item.partition(':')
+        if device not in product_lines(family):
+            sys.exit('error: %s is not a %s product line' % (device, family))
+        targets[(family, device)] = True
+
+    includes = {}
+    for family, device in sorted(targets):
+        if family not in includes:
+            includes[family] = stage_include(family, args.out)
+        build(args, family, device, *includes[family])
+
+    index = os.path.join(args.out, 'variants.json')
+    variants = {}
+    if os.path.exists(index):
+        with open(index) as f:
+            variants = json.load(f)
+    for board, (family, device) in selected.items():
+        abi = abi_of(family, device, args.float_abi)
+        variants[board] = {'family': family, 'device': device,
+                           'include': '%s/include' % family,
+                           'lib': '%s/%s/%s' % (family, device, abi),
+                           'cflags': cpu_flags(family, device, abi) +
+                                     ['-D' + device, '-include', 'hal_prebuilt.h']}
+    with open(index, 'w') as f:
+        json.dump(variants, f, indent=2, sort_keys=True)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,73 @@
+/**
+  ******************************************************************************
+  * @file    hal_prebuilt.c
+  * @author  MCD Application Team
+  * @brief   Oscillator values of the board for the prebuilt HAL/LL libraries
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- compile this file with the application sources, with the include
+   directory of the prebuilt libraries in the include path and the compiler
+   flags given for the board in variants.json (-include hal_prebuilt.h
+   among them), then link libhal.a or libhal_lto.a.
+
+2- set the board oscillators as for a source build: HSE_VALUE and LSE_VALUE
+   on the compiler command line or in hal_conf.h. This file is the only one
+   reading the hal_conf.h values, the other files read the variables below.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "hal_prebuilt.h"
+
+/* hal_conf.h defaults when the command line does not set the values */
+#if defined(HAL_PREBUILT_HSE_VARIABLE)
+#undef HSE_VALUE
+#endif
+#if defined(HAL_PREBUILT_LSE_VARIABLE)
+#undef LSE_VALUE
+#endif
+#include "main.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+const uint32_t HAL_Prebuilt_HseValue = HSE_VALUE;
+const uint32_t HAL_Prebuilt_LseValue = LSE_VALUE;
+
+/* Private function prototypes -----------------------------------------------*/
+/* Functions Definition ------------------------------------------------------*/
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,78 @@
+/**
+  ******************************************************************************
+  * @file    hal_prebuilt.h
+  * @author  MCD Application Team
+  * @brief   Header for hal_prebuilt module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _HAL_PREBUILT_H__
+#define _HAL_PREBUILT_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+/* Exported variables --------------------------------------------------------*/
+/* Oscillator values of the board, defined by hal_prebuilt.c in the
+   application build. The prebuilt drivers read them instead of HSE_VALUE
+   and LSE_VALUE, which are only known once the board is. */
+extern const uint32_t HAL_Prebuilt_HseValue;
+extern const uint32_t HAL_Prebuilt_LseValue;
+
+/* Exported macro ------------------------------------------------------------*/
+/* Force-included (-include hal_prebuilt.h) in the libraries and in the
+   application. A value given on the command line is kept: hal_prebuilt.c
+   copies it in the variable, so that both agree. */
+#if !defined(HSE_VALUE)
+#define HSE_VALUE                   HAL_Prebuilt_HseValue
+#define HAL_PREBUILT_HSE_VARIABLE
+#endif
+#if !defined(LSE_VALUE)
+#define LSE_VALUE                   HAL_Prebuilt_LseValue
+#define HAL_PREBUILT_LSE_VARIABLE
+#endif
+
+/* Exported functions ------------------------------------------------------- */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _HAL_PREBUILT_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -174,6 +174,7 @@ void     st7735_WriteReg(uint8_t LCDReg, uint8_t LCDRegValue);
 uint8_t  st7735_ReadReg(uint8_t LCDReg);
 
 void     st7735_SetDisplayWindow(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
+void     st7735_SetWriteWindow(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
 void     st7735_DrawHLine(uint16_t RGBCode, uint16_t Xpos, uint16_t Ypos, uint16_t Length);
 void     st7735_DrawVLine(uint16_t RGBCode, uint16_t Xpos, uint16_t Ypos, uint16_t Length);
 
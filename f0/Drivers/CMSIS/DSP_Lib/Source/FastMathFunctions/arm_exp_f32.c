@@ -0,0 +1,193 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        21. September 2015
+* $Revision:    V.1.4.5 a
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_exp_f32.c
+*
+* Description:  Fast exponential calculation for floating-point values.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup exp Exponential
+ *
+ * Computes the natural exponential function for floating-point values using
+ * a table of 32 powers of two and a polynomial, as a faster alternative to
+ * the <code>expf()</code> function of the C library.
+ *
+ * The steps used are:
+ *  -# Calculation of the nearest integer <code>k</code> of <code>x * 32 / ln(2)</code>
+ *  -# Calculation of the remainder <code>r = x - k * ln(2) / 32</code>, with
+ *     <code>|r| <= ln(2) / 64</code>
+ *  -# The final result equals <code>2<sup>k / 32</sup> * p(r)</code>, where the
+ *     table gives <code>2<sup>(k % 32) / 32</sup></code>, <code>p(r)</code> is
+ *     the third order Taylor polynomial of <code>exp(r)</code> and the
+ *     integer power of two is added to the exponent.
+ *
+ * The relative error is below 1.8e-7 over the whole range.
+ * Results below <code>exp(-87)</code> are flushed to zero, inputs
+ * above <code>ln(FLT_MAX)</code> return +infinity.
+ *
+ * <code>arm_vexp_f32()</code> processes a whole buffer.
+ */
+
+/**
+ * @addtogroup exp
+ * @{
+ */
+
+/* 32 / ln(2) */
+#define EXP_F32_INV_LN2_32   46.1662407f
+/* ln(2) / 32 in two parts, the first one exact when multiplied by k */
+#define EXP_F32_LN2_32_HI    0.0216598511f
+#define EXP_F32_LN2_32_LO    9.98318280e-07f
+#define EXP_F32_MAX          88.7228317f
+#define EXP_F32_MIN         -87.0f
+
+/**
+ * @brief  Fast approximation to the natural exponential function for floating-point data.
+ * @param[in] x input value.
+ * @return  exp(x).
+ */
+
+float32_t arm_exp_f32(
+  float32_t x)
+{
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } out;                                         /* Result and its bit pattern */
+  float32_t kf, r;                               /* Scaled input, remainder */
+  int32_t k, j;                                  /* Table index */
+
+  if(x > EXP_F32_MAX)
+  {
+    out.i = 0x7F800000;                          /* +infinity */
+    return (out.f);
+  }
+
+  if(!(x >= EXP_F32_MIN))
+  {
+    /* Underflow, NaN is returned as it is */
+    return ((x != x) ? x : 0.0f);
+  }
+
+  /* Nearest integer of x * 32 / ln(2) */
+  kf = x * EXP_F32_INV_LN2_32;
+  k = (int32_t) (kf + ((kf >= 0.0f) ? 0.5f : -0.5f));
+
+  /* Remainder in [-ln(2) / 64, ln(2) / 64] */
+  r = (x - ((float32_t) k * EXP_F32_LN2_32_HI)) - ((float32_t) k * EXP_F32_LN2_32_LO);
+
+  /* 2^(j / 32) * exp(r) */
+  j = k & 31;
+  out.f = expTable_f32[j] * (1.0f + r * (1.0f + r * (0.5f + r * 0.166666672f)));
+
+  /* Multiply by 2^((k - j) / 32) through the exponent */
+  out.i += ((k - j) / 32) << 23;
+
+  return (out.f);
+}
+
+/**
+ * @brief  Natural exponential of the elements of a floating-point vector.
+ * @param[in]  *pSrc points to the input vector
+ * @param[out] *pDst points to the output vector
+ * @param[in]  blockSize number of samples in each vector
+ * @return none.
+ */
+
+void arm_vexp_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* The four evaluations are independent and can be interleaved */
+    pDst[0] = arm_exp_f32(pSrc[0]);
+    pDst[1] = arm_exp_f32(pSrc[1]);
+    pDst[2] = arm_exp_f32(pSrc[2]);
+    pDst[3] = arm_exp_f32(pSrc[3]);
+
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_exp_f32(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of exp group
+ */
@@ -0,0 +1,150 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        21. September 2015
+* $Revision:    V.1.4.5 a
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_tanh_q15.c
+*
+* Description:  Fast hyperbolic tangent calculation for Q15 values.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup tanh
+ * @{
+ */
+
+/**
+ * @brief  Fast approximation to the hyperbolic tangent for Q15 data.
+ * @param[in] x input value in 4.11 format.
+ * @return  tanh(x) in 1.15 format.
+ */
+
+q15_t arm_tanh_q15(
+  q15_t x)
+{
+  q31_t ax, d, T, a1, a;                         /* Absolute value, offset, table value, result */
+  uint32_t i;                                    /* Table index */
+
+  ax = (x < 0) ? -(q31_t) x : (q31_t) x;
+
+  if(ax >= (11 << 11))
+  {
+    a = 0x7FFF;
+  }
+  else
+  {
+    /* Nearest table point, offset in 1.15 format */
+    i = ((uint32_t) ax + 0x40u) >> 7;
+    d = (ax - (q31_t) (i << 7)) << 4;
+
+    /* T + (1 - T^2) d - T (1 - T^2) d^2, in 1.15 format */
+    T = tanhTable_q31[i] >> 16;
+    a1 = 0x7FFF - ((T * T) >> 15);
+    a = T + (((a1 - (((T * a1) >> 15) * d >> 15)) * d) >> 15);
+    a = __SSAT(a, 16);
+  }
+
+  return ((q15_t) ((x < 0) ? -a : a));
+}
+
+/**
+ * @brief  Hyperbolic tangent of the elements of a Q15 vector.
+ * @param[in]  *pSrc points to the input vector
+ * @param[out] *pDst points to the output vector
+ * @param[in]  blockSize number of samples in each vector
+ * @return none.
+ */
+
+void arm_vtanh_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* The four evaluations are independent and can be interleaved */
+    pDst[0] = arm_tanh_q15(pSrc[0]);
+    pDst[1] = arm_tanh_q15(pSrc[1]);
+    pDst[2] = arm_tanh_q15(pSrc[2]);
+    pDst[3] = arm_tanh_q15(pSrc[3]);
+
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_tanh_q15(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of tanh group
+ */
@@ -0,0 +1,193 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_mat_solve_lower_triangular_f32.c    
+*    
+* Description:	Solve of a lower-triangular system by forward substitution.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.    
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixSolve Triangular Solve
+ *
+ * Solves <code>T * X = B</code> for X, T being a square lower- or
+ * upper-triangular matrix and B a matrix of m right-hand sides, by forward
+ * or back substitution:
+ * <pre>
+ *     X(i,:) = (B(i,:) - sum(T(i,k) * X(k,:), k before i)) / T(i,i)
+ * </pre>
+ * The rows of X are updated by multiply-subtract of contiguous rows. The
+ * output may be B itself. Only the triangle of T given by the function
+ * name is read.
+ *
+ * arm_mat_cholesky_solve_f32() and arm_mat_ldlt_solve_f32() solve a symmetric
+ * system <code>A * X = B</code> from the factors of
+ * arm_mat_cholesky_f32() and arm_mat_ldlt_f32(), the transposed factor being
+ * read in place. Solving for X is cheaper and more accurate than
+ * multiplying B by the inverse of A.
+ *
+ * If a diagonal element of T is zero, then the functions return
+ * <code>ARM_MATH_SINGULAR</code>.
+ */
+
+/**
+ * @addtogroup MatrixSolve
+ * @{
+ */
+
+/**
+ * @brief Floating-point solve of a lower-triangular system by forward substitution.
+ * @param[in]       *pT points to the lower-triangular matrix structure
+ * @param[in]       *pSrc points to the right-hand side matrix structure B
+ * @param[out]      *pDst points to the solution matrix structure X, which can be B
+ * @return     		The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if T is not square or if the sizes of B and X do not
+ * match its size. If a diagonal element of T is zero, then the function returns
+ * <code>ARM_MATH_SINGULAR</code>. Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.
+ */
+
+arm_status arm_mat_solve_lower_triangular_f32(
+  const arm_matrix_instance_f32 * pT,
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pIn = pSrc->pData;                  /* right-hand side pointer */
+  float32_t *pOut = pDst->pData;                 /* solution pointer */
+  float32_t *pX, *pY;                            /* rows of the solution */
+  float32_t coef;                                /* element of the triangular matrix */
+  uint32_t n = pT->numRows;                      /* size of the triangular matrix */
+  uint32_t m = pSrc->numCols;                    /* number of right-hand sides */
+  uint32_t i, k, c;                              /* loop counters */
+  arm_status status;                             /* status of the solve */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pT->numRows != pT->numCols) || (pSrc->numRows != pT->numRows)
+     || (pDst->numRows != pSrc->numRows) || (pDst->numCols != pSrc->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    for (i = 0u; (i < n) && (status == ARM_MATH_SUCCESS); i++)
+    {
+      /* X(i,:) = B(i,:) */
+      pX = pOut + (i * m);
+      if(pOut != pIn)
+      {
+        for (c = 0u; c < m; c++)
+        {
+          pX[c] = pIn[(i * m) + c];
+        }
+      }
+
+      /* X(i,:) -= T(i,k) * X(k,:) for the rows already solved */
+      for (k = 0u; k < i; k++)
+      {
+        coef = pT->pData[(i * n) + k];
+        pX = pOut + (i * m);
+        pY = pOut + (k * m);
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+        /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+        /* Loop unrolling */
+        c = m >> 2u;
+        while(c > 0u)
+        {
+          pX[0] -= coef * pY[0];
+          pX[1] -= coef * pY[1];
+          pX[2] -= coef * pY[2];
+          pX[3] -= coef * pY[3];
+          pX += 4u;
+          pY += 4u;
+          c--;
+        }
+
+        /* Remaining 1 to 3 columns */
+        c = m % 0x4u;
+
+#else
+
+        /* Run the below code for Cortex-M0 */
+
+        c = m;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+        while(c > 0u)
+        {
+          *pX++ -= coef * *pY++;
+          c--;
+        }
+      }
+
+      /* X(i,:) /= T(i,i) */
+      coef = pT->pData[(i * n) + i];
+      if(coef == 0.0f)
+      {
+        status = ARM_MATH_SINGULAR;
+      }
+      else
+      {
+        coef = 1.0f / coef;
+        pX = pOut + (i * m);
+        for (c = 0u; c < m; c++)
+        {
+          pX[c] *= coef;
+        }
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixSolve group
+ */
@@ -0,0 +1,136 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_histogram_q15.c  
+*    
+* Description:	Histogram of a Q15 vector.  
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Histogram
+ * @{
+ */
+
+/**
+ * @brief  Histogram of a Q15 vector.
+ * @param[in]     *pSrc points to the input vector.
+ * @param[in]     blockSize length of the input vector.
+ * @param[in]     minValue lower bound of the first bin.
+ * @param[in]     shift base-2 logarithm of the bin width, from 0 to 15.
+ * @param[in]     numBins number of bins.
+ * @param[in,out] *pHist points to the numBins counts, incremented.
+ * @return none.
+ */
+
+void arm_histogram_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t minValue,
+  uint8_t shift,
+  uint16_t numBins,
+  uint32_t * pHist)
+{
+  int32_t last = (int32_t) numBins - 1;          /* Last bin */
+  int32_t b0;                                    /* Bin of a sample */
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  int32_t b1;                                    /* Bin of the next sample */
+  q31_t in;                                      /* Two packed input samples */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 1u;
+
+  /* First part of the processing with loop unrolling.  Compute 2 outputs at a time.
+   ** a second loop below computes the remaining sample. */
+  while(blkCnt > 0u)
+  {
+    /* Read two samples at a time */
+    in = *__SIMD32(pSrc)++;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+    b0 = ((int32_t) (q15_t) in - minValue) >> shift;
+    b1 = ((in >> 16) - minValue) >> shift;
+#else
+    b1 = ((int32_t) (q15_t) in - minValue) >> shift;
+    b0 = ((in >> 16) - minValue) >> shift;
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    /* Samples below the lower bound give negative bins */
+    b0 = (b0 > 0) ? ((b0 < last) ? b0 : last) : 0;
+    b1 = (b1 > 0) ? ((b1 < last) ? b1 : last) : 0;
+
+    pHist[b0]++;
+    pHist[b1]++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is odd, compute the remaining sample here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize & 0x1u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    b0 = ((int32_t) (*pSrc++) - minValue) >> shift;
+    b0 = (b0 > 0) ? ((b0 < last) ? b0 : last) : 0;
+    pHist[b0]++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of Histogram group
+ */
@@ -0,0 +1,274 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_percentile_filter_f32.c  
+*    
+* Description:	Processing function for the floating-point sliding-window percentile filter.  
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup Percentile Sliding-Window Percentile Filter
+ *
+ * Outputs, for each input sample, an order statistic of the last
+ * <code>windowLength</code> samples: the median for spike rejection, or any
+ * other percentile. Each sample costs O(log(windowLength)) comparisons,
+ * instead of the sort of the window for each sample.
+ *
+ * \par Algorithm
+ * The window is split in two heaps of indexes into the window samples: a
+ * max-heap of the <code>rank+1</code> smallest samples, whose root is the
+ * output, and a min-heap of the others. The sample replacing the oldest one
+ * takes its place in its heap and is sifted up or down; when the roots of
+ * the two heaps are then out of order, they are exchanged and sifted down.
+ * The position of each window sample in the heaps is kept, so that the
+ * oldest sample is found without search.
+ * \par
+ * The output is the order statistic of the given <code>rank</code>, from 0 for
+ * the minimum to <code>windowLength-1</code> for the maximum. The median of a
+ * window of odd length is rank <code>(windowLength-1)/2</code>, and the
+ * percentile p of the window is rank <code>round(p*(windowLength-1)/100)</code>.
+ * \par
+ * The window is initially filled with an initial value, usually zero or the
+ * first sample, so that the first outputs are computed over a full window.
+ *
+ * \par Instance Structure
+ * The window samples and the heaps are stored in buffers provided by the
+ * caller: <code>pState</code> of <code>windowLength</code> samples and
+ * <code>pIndex</code> of <code>2*windowLength</code> indexes. A separate
+ * instance and buffers must be used for each filter.
+ *
+ * \par
+ * There are separate functions for floating-point, Q31 and Q15 data types.
+ */
+
+/**
+ * @addtogroup Percentile
+ * @{
+ */
+
+/**
+ * @brief  Exchanges two entries of the heaps and updates their positions.
+ * @param[in,out] *pHeap points to the heaps.
+ * @param[in,out] *pPos points to the positions of the window samples in the heaps.
+ * @param[in]     i position of the first entry.
+ * @param[in]     j position of the second entry.
+ * @return none.
+ */
+
+static void arm_percentile_swap_f32(
+  uint16_t * pHeap,
+  uint16_t * pPos,
+  uint32_t i,
+  uint32_t j)
+{
+  uint16_t t = pHeap[i];                         /* Temporary index */
+
+  pHeap[i] = pHeap[j];
+  pHeap[j] = t;
+  pPos[pHeap[i]] = (uint16_t) i;
+  pPos[pHeap[j]] = (uint16_t) j;
+}
+
+/**
+ * @brief  Moves an entry of the low max-heap to its place.
+ * @param[in,out] *S points to an instance of the floating-point percentile filter structure.
+ * @param[in]     i position of the entry, in [0 rank].
+ * @return none.
+ */
+
+static void arm_percentile_lo_f32(
+  arm_percentile_instance_f32 * S,
+  uint32_t i)
+{
+  const float32_t *pVal = S->pState;             /* Window samples */
+  uint16_t *pHeap = S->pIndex;                   /* Heaps */
+  uint16_t *pPos = S->pIndex + S->windowLength;  /* Positions in the heaps */
+  uint32_t size = (uint32_t) S->rank + 1u;       /* Size of the low heap */
+  uint32_t c;                                    /* Child or parent position */
+
+  /* Up while above the parent */
+  while(i > 0u)
+  {
+    c = (i - 1u) >> 1u;
+    if(pVal[pHeap[i]] <= pVal[pHeap[c]])
+    {
+      break;
+    }
+    arm_percentile_swap_f32(pHeap, pPos, i, c);
+    i = c;
+  }
+
+  /* Down while below the largest child */
+  for (;;)
+  {
+    c = (2u * i) + 1u;
+    if(c >= size)
+    {
+      break;
+    }
+    if(((c + 1u) < size) && (pVal[pHeap[c + 1u]] > pVal[pHeap[c]]))
+    {
+      c++;
+    }
+    if(pVal[pHeap[c]] <= pVal[pHeap[i]])
+    {
+      break;
+    }
+    arm_percentile_swap_f32(pHeap, pPos, i, c);
+    i = c;
+  }
+}
+
+/**
+ * @brief  Moves an entry of the high min-heap to its place.
+ * @param[in,out] *S points to an instance of the floating-point percentile filter structure.
+ * @param[in]     i position of the entry, in [rank+1 windowLength-1].
+ * @return none.
+ */
+
+static void arm_percentile_hi_f32(
+  arm_percentile_instance_f32 * S,
+  uint32_t i)
+{
+  const float32_t *pVal = S->pState;             /* Window samples */
+  uint16_t *pHeap = S->pIndex;                   /* Heaps */
+  uint16_t *pPos = S->pIndex + S->windowLength;  /* Positions in the heaps */
+  uint32_t base = (uint32_t) S->rank + 1u;       /* Position of the root of the high heap */
+  uint32_t end = S->windowLength;                /* End of the high heap */
+  uint32_t c;                                    /* Child or parent position */
+
+  /* Up while below the parent */
+  while(i > base)
+  {
+    c = base + (((i - base) - 1u) >> 1u);
+    if(pVal[pHeap[i]] >= pVal[pHeap[c]])
+    {
+      break;
+    }
+    arm_percentile_swap_f32(pHeap, pPos, i, c);
+    i = c;
+  }
+
+  /* Down while above the smallest child */
+  for (;;)
+  {
+    c = base + (2u * (i - base)) + 1u;
+    if(c >= end)
+    {
+      break;
+    }
+    if(((c + 1u) < end) && (pVal[pHeap[c + 1u]] < pVal[pHeap[c]]))
+    {
+      c++;
+    }
+    if(pVal[pHeap[c]] >= pVal[pHeap[i]])
+    {
+      break;
+    }
+    arm_percentile_swap_f32(pHeap, pPos, i, c);
+    i = c;
+  }
+}
+
+/**
+ * @brief  Processing function for the floating-point sliding-window percentile filter.
+ * @param[in,out] *S points to an instance of the floating-point percentile filter structure.
+ * @param[in]     *pSrc points to the block of input samples.
+ * @param[out]    *pDst points to the block of output samples, which can be pSrc.
+ * @param[in]     blockSize number of samples to process.
+ * @return none.
+ */
+
+void arm_percentile_filter_f32(
+  arm_percentile_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pVal = S->pState;                   /* Window samples */
+  uint16_t *pHeap = S->pIndex;                   /* Heaps */
+  uint16_t *pPos = S->pIndex + S->windowLength;  /* Positions in the heaps */
+  uint32_t base = (uint32_t) S->rank + 1u;       /* Position of the root of the high heap */
+  uint32_t slot = S->index;                      /* Window slot of the oldest sample */
+  float32_t in;                                  /* New sample */
+  uint32_t pos;                                  /* Position of the oldest sample in the heaps */
+
+  while(blockSize > 0u)
+  {
+    /* The new sample replaces the oldest one, in the same heap entry */
+    in = *pSrc++;
+    pVal[slot] = in;
+    pos = pPos[slot];
+
+    if(pos < base)
+    {
+      arm_percentile_lo_f32(S, pos);
+    }
+    else
+    {
+      arm_percentile_hi_f32(S, pos);
+    }
+
+    /* Exchange the roots when the heaps are out of order */
+    if((base < S->windowLength) && (pVal[pHeap[0]] > pVal[pHeap[base]]))
+    {
+      arm_percentile_swap_f32(pHeap, pPos, 0u, base);
+      arm_percentile_lo_f32(S, 0u);
+      arm_percentile_hi_f32(S, base);
+    }
+
+    *pDst++ = pVal[pHeap[0]];
+
+    slot++;
+    if(slot == S->windowLength)
+    {
+      slot = 0u;
+    }
+
+    blockSize--;
+  }
+
+  S->index = (uint16_t) slot;
+}
+
+/**
+ * @} end of Percentile group
+ */
@@ -0,0 +1,97 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_stats_f32.c  
+*    
+* Description:	Mean, variance, root mean square, minimum and maximum of a floating-point vector in a single pass.  
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupStats    
+ */
+
+/**    
+ * @defgroup Stats Batch Statistics    
+ *    
+ * Computes the mean, variance, root mean square, minimum and maximum of a vector in a single    
+ * pass over the data, with the same algorithms as <code>arm_mean</code>, <code>arm_var</code>,    
+ * <code>arm_rms</code>, <code>arm_min</code> and <code>arm_max</code>:    
+ * <pre>    
+ *     mean = sum / blockSize    
+ *     var  = (sumOfSquares - sum<sup>2</sup> / blockSize) / (blockSize - 1)    
+ *     rms  = sqrt(sumOfSquares / blockSize)    
+ * </pre>    
+ * The minimum and maximum are returned with the index of their first occurrence.    
+ *    
+ * The functions can be used in two ways:    
+ * - <code>arm_stats_f32()</code> computes the statistics of one buffer;    
+ * - <code>arm_stats_init_f32()</code>, <code>arm_stats_update_f32()</code> and <code>arm_stats_get_f32()</code>    
+ *   accumulate the sums and extrema across a stream of blocks held in an instance structure,    
+ *   the results being available at any time and the indexes counting from the first sample    
+ *   since the initialization.    
+ *    
+ * There are separate functions for floating point, Q31, and Q15 data types.    
+ */
+
+/**    
+ * @addtogroup Stats    
+ * @{    
+ */
+
+/**    
+ * @brief Statistics of the elements of a floating-point vector.    
+ * @param[in]       *pSrc points to the input vector    
+ * @param[in]       blockSize length of the input vector    
+ * @param[out]      *pResult statistics returned here    
+ * @return none.    
+ */
+
+void arm_stats_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_f32 * pResult)
+{
+  arm_stats_instance_f32 S;                      /* Accumulators */
+
+  arm_stats_init_f32(&S);
+  arm_stats_update_f32(&S, pSrc, blockSize);
+  arm_stats_get_f32(&S, pResult);
+}
+
+/**    
+ * @} end of Stats group    
+ */
@@ -0,0 +1,292 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_psd_f32.c    
+*    
+* Description:	Floating-point Welch PSD and spectrogram.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* -------------------------------------------------------------------- */
+
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup PSD Welch Power Spectral Density
+ *
+ * Estimates the power spectral density of a stream of samples with the
+ * Welch method: overlapping frames are windowed, transformed with the real
+ * FFT, and their periodograms averaged. The same engine outputs the
+ * periodogram of each frame, the rows of a spectrogram.
+ *
+ * \par
+ * The window, the FFT and the magnitude are fused into the frame processing:
+ * the window is applied while reading the frame out of the input ring, and
+ * the squared magnitude of each bin is scaled and accumulated into the
+ * average, and written to the spectrogram row, in a single pass over the
+ * FFT output. No buffer is allocated: the state buffer of
+ * <code>ARM_PSD_STATE_SIZE_F32(fftLen)</code> samples and the average of
+ * <code>fftLen/2+1</code> bins are provided by the caller.
+ *
+ * \par Algorithm
+ * A frame is computed every <code>fftLen - overlap</code> samples, once
+ * <code>fftLen</code> samples have been received. The one-sided periodogram
+ * of a frame is:
+ * <pre>
+ *     P[k] = c[k] * |X[k]|<sup>2</sup> / sum(w[n]<sup>2</sup>),  k = 0..fftLen/2
+ * </pre>
+ * with c[k] = 1 for the DC and Nyquist bins and 2 for the others: the
+ * one-sided density for a unit sampling frequency, which a white noise of
+ * variance s<sup>2</sup> gives as 2*s<sup>2</sup> on average. Divide it by the
+ * sampling frequency for a density per hertz.
+ * \par
+ * The average is either linear, the mean of all the frames since
+ * initialization or arm_psd_reset_f32(), or exponential:
+ * <pre>
+ *     Pavg = (1 - alpha) * Pavg + alpha * P
+ * </pre>
+ * both updated in place, so that the average is valid after each frame.
+ * With ARM_PSD_AVERAGE_NONE, only the spectrogram rows are computed.
+ *
+ * \par Instance Structure
+ * The state and settings are stored in an instance data structure,
+ * initialized by arm_psd_init_f32().
+ */
+
+/**
+ * @addtogroup PSD
+ * @{
+ */
+
+/**
+ * @brief  Computes a frame of the floating-point Welch PSD.
+ * @param[in,out] *S points to an instance of the floating-point Welch PSD structure.
+ * @param[out]    *pFrame points to the periodogram of the frame, or NULL.
+ * @return none.
+ */
+
+static void arm_psd_frame_f32(
+  arm_psd_instance_f32 * S,
+  float32_t * pFrame)
+{
+  float32_t *pScratch = S->pScratch;             /* Windowed frame */
+  float32_t *pOut = S->pScratch + S->fftLen;     /* Spectrum of the frame */
+  float32_t *pAvg = S->pPsd;                     /* Average */
+  const float32_t *pIn;                          /* Input ring pointer */
+  const float32_t *pW = S->pWindow;              /* Window pointer */
+  float32_t frameScale = 2.0f * S->scale;        /* Scale of the periodogram */
+  float32_t avgScale, decay;                     /* Weights of the new frame and of the average */
+  float32_t mag;                                 /* Squared magnitude of a bin */
+  uint32_t numBins = S->fftLen >> 1u;            /* Number of bins, Nyquist excluded */
+  uint32_t n, k, blkCnt;                         /* Loop counters */
+
+  /* Window the frame while reading it out of the ring, from the oldest sample */
+  pIn = S->pInput + S->writeIndex;
+  blkCnt = S->fftLen - S->writeIndex;
+  for (k = 0u; k < 2u; k++)
+  {
+    if(pW != NULL)
+    {
+#ifndef ARM_MATH_CM0_FAMILY
+
+      /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+      n = blkCnt >> 2u;
+      while(n > 0u)
+      {
+        pScratch[0] = pIn[0] * pW[0];
+        pScratch[1] = pIn[1] * pW[1];
+        pScratch[2] = pIn[2] * pW[2];
+        pScratch[3] = pIn[3] * pW[3];
+        pScratch += 4u;
+        pIn += 4u;
+        pW += 4u;
+        n--;
+      }
+      n = blkCnt & 3u;
+
+#else
+
+      /* Run the below code for Cortex-M0 */
+
+      n = blkCnt;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+      while(n > 0u)
+      {
+        *pScratch++ = (*pIn++) * (*pW++);
+        n--;
+      }
+    }
+    else
+    {
+      memcpy(pScratch, pIn, blkCnt * sizeof(float32_t));
+      pScratch += blkCnt;
+    }
+
+    /* Wrap around to the start of the ring */
+    pIn = S->pInput;
+    blkCnt = S->writeIndex;
+  }
+
+  arm_rfft_fast_f32(&S->rfft, S->pScratch, pOut, 0u);
+
+  /* Weights of the new frame in the average */
+  S->frameCount++;
+  if(S->averaging == ARM_PSD_AVERAGE_LINEAR)
+  {
+    decay = 1.0f - (1.0f / (float32_t) S->frameCount);
+  }
+  else if((S->averaging == ARM_PSD_AVERAGE_EXPONENTIAL) && (S->frameCount > 1u))
+  {
+    decay = 1.0f - S->alpha;
+  }
+  else
+  {
+    decay = 0.0f;
+  }
+  avgScale = (1.0f - decay) * frameScale;
+
+  if(S->averaging == ARM_PSD_AVERAGE_NONE)
+  {
+    pAvg = NULL;
+  }
+
+  /* DC and Nyquist bins, packed in the first complex value of the spectrum */
+  mag = pOut[0] * pOut[0];
+  if(pAvg != NULL)
+  {
+    pAvg[0] = (decay * pAvg[0]) + ((0.5f * avgScale) * mag);
+  }
+  if(pFrame != NULL)
+  {
+    pFrame[0] = (0.5f * frameScale) * mag;
+  }
+  mag = pOut[1] * pOut[1];
+  if(pAvg != NULL)
+  {
+    pAvg[numBins] = (decay * pAvg[numBins]) + ((0.5f * avgScale) * mag);
+  }
+  if(pFrame != NULL)
+  {
+    pFrame[numBins] = (0.5f * frameScale) * mag;
+  }
+
+  /* Squared magnitude of the other bins, scaled and accumulated in a single pass */
+  for (k = 1u; k < numBins; k++)
+  {
+    mag = (pOut[(2u * k)] * pOut[(2u * k)]) + (pOut[(2u * k) + 1u] * pOut[(2u * k) + 1u]);
+
+    if(pAvg != NULL)
+    {
+      pAvg[k] = (decay * pAvg[k]) + (avgScale * mag);
+    }
+    if(pFrame != NULL)
+    {
+      pFrame[k] = frameScale * mag;
+    }
+  }
+}
+
+/**
+ * @brief  Processing function for the floating-point Welch PSD.
+ * @param[in,out] *S points to an instance of the floating-point Welch PSD structure.
+ * @param[in]     *pSrc points to the block of input samples.
+ * @param[in]     blockSize number of samples to process.
+ * @param[out]    *pFrame points to the spectrogram rows, fftLen/2+1 values for each frame completed, or NULL.
+ * @return        The function returns the number of frames completed.
+ *
+ * \par
+ * The blocks can be of any size. The averaged PSD is in the buffer given to
+ * arm_psd_init_f32() after each frame. For a spectrogram, <code>pFrame</code>
+ * receives the periodogram of each frame completed, one row after the other:
+ * with blocks of <code>fftLen - overlap</code> samples, one row per call once
+ * the first frame is complete.
+ */
+
+uint32_t arm_psd_f32(
+  arm_psd_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pFrame)
+{
+  uint32_t numFrames = 0u;                       /* Frames completed */
+  uint32_t blkCnt;                               /* Samples copied at once */
+
+  while(blockSize > 0u)
+  {
+    /* Copy up to the end of the frame, of the block or of the ring */
+    blkCnt = S->pending;
+    if(blkCnt > blockSize)
+    {
+      blkCnt = blockSize;
+    }
+    if(blkCnt > ((uint32_t) S->fftLen - S->writeIndex))
+    {
+      blkCnt = (uint32_t) S->fftLen - S->writeIndex;
+    }
+
+    memcpy(S->pInput + S->writeIndex, pSrc, blkCnt * sizeof(float32_t));
+    pSrc += blkCnt;
+    blockSize -= blkCnt;
+    S->pending -= (uint16_t) blkCnt;
+    S->writeIndex += (uint16_t) blkCnt;
+    if(S->writeIndex == S->fftLen)
+    {
+      S->writeIndex = 0u;
+    }
+
+    if(S->pending == 0u)
+    {
+      arm_psd_frame_f32(S, pFrame);
+      numFrames++;
+      S->pending = S->hopSize;
+
+      if(pFrame != NULL)
+      {
+        pFrame += (S->fftLen >> 1u) + 1u;
+      }
+    }
+  }
+
+  return (numFrames);
+}
+
+/**
+ * @} end of PSD group
+ */
@@ -168,6 +168,7 @@
 #define  INSTRUCTION_CACHE_ENABLE     0U
 #define  DATA_CACHE_ENABLE            0U
 #define  USE_SPI_CRC                  1U
+#define  USE_HAL_TRACE                0U /*!< Record HAL driver events in the trace buffer */
 
 /* ########################## Assert Selection ############################## */
 /**
@@ -164,10 +164,12 @@
                                                                               /*  Warning: Must be set to higher priority for HAL_Delay()  */
                                                                               /*  and HAL_GetTick() usage under interrupt context          */
 #define  USE_RTOS                     0U
+/* #define  USE_HAL_LOCK                 HAL_LOCK_NONE */ /* Default: HAL_LOCK_EXCLUSIVE on Cortex-M3/M4/M7, HAL_LOCK_PRIMASK on Cortex-M0/M0+ */
 #define  PREFETCH_ENABLE              1U
 #define  INSTRUCTION_CACHE_ENABLE     0U
 #define  DATA_CACHE_ENABLE            0U
 #define  USE_SPI_CRC                  1U
+#define  USE_HAL_TRACE                0U /*!< Record HAL driver events in the trace buffer */
 
 /* ########################## Assert Selection ############################## */
 /**
@@ -48,6 +48,7 @@
   #include "Legacy/stm32_hal_legacy.h"
 #endif
 #include <stdio.h>
+#include "stm32f0xx_hal_trace.h"
 
 /* Exported types ------------------------------------------------------------*/
 
@@ -106,22 +107,85 @@ typedef enum
 #if (USE_RTOS == 1)
   #error " USE_RTOS should be 0 in the current HAL release "
 #else
+  /* Handle lock implementation, USE_HAL_LOCK (override in stm32xxxx_hal_conf.h):
+     - HAL_LOCK_EXCLUSIVE: LDREXB/STREXB on the Lock field, Cortex-M3/M4/M7
+     - HAL_LOCK_PRIMASK  : test and set with the interrupts masked, Cortex-M0/M0+
+     - HAL_LOCK_NONE     : no lock, handles used from a single context only
+     A lock found taken makes __HAL_LOCK() return HAL_BUSY and is counted in
+     uwHalLockBusy, the contention actually seen by the application. */
+  #define HAL_LOCK_NONE                   0U
+  #define HAL_LOCK_EXCLUSIVE              1U
+  #define HAL_LOCK_PRIMASK                2U
+
+  #if !defined(USE_HAL_LOCK)
+    #if (__CORTEX_M >= 3U)
+      #define USE_HAL_LOCK                HAL_LOCK_EXCLUSIVE
+    #else
+      #define USE_HAL_LOCK                HAL_LOCK_PRIMASK
+    #endif
+  #endif /* USE_HAL_LOCK */
+
+  #if (USE_HAL_LOCK == HAL_LOCK_EXCLUSIVE) && (__CORTEX_M < 3U)
+    #error "HAL_LOCK_EXCLUSIVE needs the LDREX/STREX instructions of a Cortex-M3/M4/M7"
+  #endif
+
+  #if (USE_HAL_LOCK == HAL_LOCK_NONE)
+  #define __HAL_LOCK(__HANDLE__)          do{ }while (0U)
+
+  #define __HAL_UNLOCK(__HANDLE__)        do{ }while (0U)
+  #else
+  extern __IO uint32_t uwHalLockBusy;
+
+  /**
+    * @brief  Take a handle lock atomically.
+    * @param  pLock Pointer to the Lock field of the handle.
+    * @retval HAL_OK when taken, HAL_BUSY when already taken.
+    */
+  __STATIC_INLINE HAL_StatusTypeDef HAL_LockAcquire(__IO HAL_LockTypeDef *pLock)
+  {
+  #if (USE_HAL_LOCK == HAL_LOCK_EXCLUSIVE)
+    /* Byte access: the lock value is in the low byte whatever the enum size */
+    do
+    {
+      if(__LDREXB((__IO uint8_t *)pLock) != (uint8_t)HAL_UNLOCKED)
+      {
+        __CLREX();
+        uwHalLockBusy++;
+        return HAL_BUSY;
+      }
+      /* Retry when an interrupt or another master broke the exclusive access */
+    }while(__STREXB((uint8_t)HAL_LOCKED, (__IO uint8_t *)pLock) != 0U);
+    __DMB();
+  #else
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    if(*pLock != HAL_UNLOCKED)
+    {
+      __set_PRIMASK(primask);
+      uwHalLockBusy++;
+      return HAL_BUSY;
+    }
+    *pLock = HAL_LOCKED;
+    __set_PRIMASK(primask);
+  #endif /* USE_HAL_LOCK */
+    return HAL_OK;
+  }
+
   #define __HAL_LOCK(__HANDLE__)                                           \
                                 do{                                        \
-                                    if((__HANDLE__)->Lock == HAL_LOCKED)   \
+                                    if(HAL_LockAcquire(&(__HANDLE__)->Lock) != HAL_OK) \
                                     {                                      \
                                        return HAL_BUSY;                    \
                                     }                                      \
-                                    else                                   \
-                                    {                                      \
-                                       (__HANDLE__)->Lock = HAL_LOCKED;    \
-                                    }                                      \
-       	                          }while (0)
+                                  }while (0U)
 
   #define __HAL_UNLOCK(__HANDLE__)                                          \
                                   do{                                       \
+                                      __DMB();                              \
                                       (__HANDLE__)->Lock = HAL_UNLOCKED;    \
-                                    }while (0)
+                                    }while (0U)
+  #endif /* USE_HAL_LOCK */
 #endif /* USE_RTOS */
 
 #if  defined ( __GNUC__ )
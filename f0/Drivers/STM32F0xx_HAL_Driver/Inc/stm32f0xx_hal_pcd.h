@@ -148,6 +148,12 @@ typedef struct
 
   uint8_t   doublebuffer;    /*!< Double buffer enable
                                  This parameter can be 0 or 1                                             */    
+
+  uint8_t   db_armed;       /*!< Double buffered endpoint: transfer in progress                            */
+
+  uint8_t   db_queued;      /*!< Double buffered IN endpoint: packets in the PMA not sent yet              */
+
+  uint32_t  db_packets;     /*!< Double buffered IN endpoint: packets not copied to the PMA yet            */
                                 
   uint32_t  maxpacket;      /*!< Endpoint Max packet size
                                  This parameter must be a number between Min_Data = 0 and Max_Data = 64KB */
@@ -356,6 +356,7 @@ HAL_StatusTypeDef HAL_DMA_Start_IT(DMA_HandleTypeDef *hdma, uint32_t SrcAddress,
   {
   	/* Change DMA peripheral state */  
   	hdma->State = HAL_DMA_STATE_BUSY;
+  	__HAL_TRACE(HAL_TRACE_EVT_DMA_START, hdma->Instance);
   	
   	hdma->ErrorCode = HAL_DMA_ERROR_NONE;
   	
@@ -620,6 +621,7 @@ void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
   	
   	if(hdma->XferCpltCallback != NULL)
   	{
+  		__HAL_TRACE(HAL_TRACE_EVT_DMA_CPLT, hdma->Instance);
   		/* Transfer complete callback */
   		hdma->XferCpltCallback(hdma);
   	}
@@ -647,6 +649,7 @@ void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
     
     if(hdma->XferErrorCallback != NULL)
     {
+    	__HAL_TRACE(HAL_TRACE_EVT_DMA_ERROR, hdma->Instance);
     	/* Transfer error callback */
     	hdma->XferErrorCallback(hdma);
     }
@@ -270,6 +270,7 @@
 #define I2C_TIMEOUT_FLAG    (25U)          /*!< 25 ms */
 
 #define MAX_NBYTE_SIZE      255U
+#define I2C_SHORT_XFER_MAX  4U     /*!< Bytes of the short master transfer fast path */
 #define SlaveAddr_SHIFT     7U
 #define SlaveAddr_MSK       0x06U
 
@@ -300,6 +301,10 @@
   */
 
 /* Private macro -------------------------------------------------------------*/
+/* Polling loop iterations in about 1 ms: the short transfer fast path only reads
+   the tick once this budget is spent */
+#define I2C_SHORT_XFER_SPIN()  ((SystemCoreClock / 24U / 1000U) + 1U)
+
 #define I2C_GET_DMA_REMAIN_DATA(__HANDLE__) ((((__HANDLE__)->State) == HAL_I2C_STATE_BUSY_TX)   ? \
                                             ((uint32_t)((__HANDLE__)->hdmatx->Instance->CNDTR)) : \
                                             ((uint32_t)((__HANDLE__)->hdmarx->Instance->CNDTR)))
@@ -353,6 +358,10 @@ static void I2C_Flush_TXDR(I2C_HandleTypeDef *hi2c);
 
 /* Private functions to handle  start, restart or stop a transfer */
 static void I2C_TransferConfig(I2C_HandleTypeDef *hi2c,  uint16_t DevAddress, uint8_t Size, uint32_t Mode, uint32_t Request);
+
+/* Private function to serve the short master transfers */
+static HAL_StatusTypeDef I2C_MasterShortTransfer(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint32_t Request,
+                                                 uint32_t Timeout, uint32_t Tickstart);
 /**
   * @}
   */
@@ -622,6 +631,8 @@ __weak void HAL_I2C_MspDeInit(I2C_HandleTypeDef *hi2c)
   * @param  pData Pointer to data buffer
   * @param  Size Amount of data to be sent
   * @param  Timeout Timeout duration
+  * @note   Transfers of up to I2C_SHORT_XFER_MAX bytes take a fast path without
+  *         tick read for each byte.
   * @retval HAL status
   */
 HAL_StatusTypeDef HAL_I2C_Master_Transmit(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData, uint16_t Size, uint32_t Timeout)
@@ -650,6 +661,12 @@ HAL_StatusTypeDef HAL_I2C_Master_Transmit(I2C_HandleTypeDef *hi2c, uint16_t DevA
     hi2c->XferCount = Size;
     hi2c->XferISR   = NULL;
 
+    /* Short transfer: no tick read for each byte */
+    if (Size <= I2C_SHORT_XFER_MAX)
+    {
+      return I2C_MasterShortTransfer(hi2c, DevAddress, I2C_GENERATE_START_WRITE, Timeout, tickstart);
+    }
+
     /* Send Slave Address */
     /* Set NBYTES to write and reload if hi2c->XferCount > MAX_NBYTE_SIZE and generate RESTART */
     if (hi2c->XferCount > MAX_NBYTE_SIZE)
@@ -746,6 +763,8 @@ HAL_StatusTypeDef HAL_I2C_Master_Transmit(I2C_HandleTypeDef *hi2c, uint16_t DevA
   * @param  pData Pointer to data buffer
   * @param  Size Amount of data to be sent
   * @param  Timeout Timeout duration
+  * @note   Transfers of up to I2C_SHORT_XFER_MAX bytes take a fast path without
+  *         tick read for each byte.
   * @retval HAL status
   */
 HAL_StatusTypeDef HAL_I2C_Master_Receive(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData, uint16_t Size, uint32_t Timeout)
@@ -774,6 +793,12 @@ HAL_StatusTypeDef HAL_I2C_Master_Receive(I2C_HandleTypeDef *hi2c, uint16_t DevAd
     hi2c->XferCount = Size;
     hi2c->XferISR   = NULL;
 
+    /* Short transfer: no tick read for each byte */
+    if (Size <= I2C_SHORT_XFER_MAX)
+    {
+      return I2C_MasterShortTransfer(hi2c, DevAddress, I2C_GENERATE_START_READ, Timeout, tickstart);
+    }
+
     /* Send Slave Address */
     /* Set NBYTES to write and reload if hi2c->XferCount > MAX_NBYTE_SIZE and generate RESTART */
     if (hi2c->XferCount > MAX_NBYTE_SIZE)
@@ -4615,6 +4640,84 @@ static HAL_StatusTypeDef I2C_WaitOnRXNEFlagUntilTimeout(I2C_HandleTypeDef *hi2c,
   return HAL_OK;
 }
 
+/**
+  * @brief  Short master transfer: a single AUTOEND transfer, the data register is
+  *         served as soon as TXIS or RXNE is set. The tick is only read once the
+  *         I2C_SHORT_XFER_SPIN() polling budget is spent, NACK and STOP detection
+  *         are left to the timeout functions.
+  * @param  hi2c Pointer to a I2C_HandleTypeDef structure that contains
+  *                the configuration information for the specified I2C.
+  * @param  DevAddress Target device address
+  * @param  Request I2C_GENERATE_START_WRITE or I2C_GENERATE_START_READ
+  * @param  Timeout Timeout duration
+  * @param  Tickstart Tick start value
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef I2C_MasterShortTransfer(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint32_t Request,
+                                                 uint32_t Timeout, uint32_t Tickstart)
+{
+  uint32_t spin = I2C_SHORT_XFER_SPIN();
+  uint32_t flag = (Request == I2C_GENERATE_START_WRITE) ? I2C_FLAG_TXIS : I2C_FLAG_RXNE;
+  HAL_StatusTypeDef status;
+
+  hi2c->XferSize = hi2c->XferCount;
+  I2C_TransferConfig(hi2c, DevAddress, (uint8_t)hi2c->XferSize, I2C_AUTOEND_MODE, Request);
+
+  while (hi2c->XferCount > 0U)
+  {
+    while (((hi2c->Instance->ISR & (flag | I2C_FLAG_AF | I2C_FLAG_STOPF)) == 0U) && (spin > 0U))
+    {
+      spin--;
+    }
+    if (flag == I2C_FLAG_TXIS)
+    {
+      status = I2C_WaitOnTXISFlagUntilTimeout(hi2c, Timeout, Tickstart);
+      if (status != HAL_OK)
+      {
+        return status;
+      }
+      hi2c->Instance->TXDR = *hi2c->pBuffPtr;
+    }
+    else
+    {
+      status = I2C_WaitOnRXNEFlagUntilTimeout(hi2c, Timeout, Tickstart);
+      if (status != HAL_OK)
+      {
+        return status;
+      }
+      *hi2c->pBuffPtr = (uint8_t)hi2c->Instance->RXDR;
+    }
+    hi2c->pBuffPtr++;
+    hi2c->XferSize--;
+    hi2c->XferCount--;
+  }
+
+  /* STOP generated by AUTOEND */
+  while (((hi2c->Instance->ISR & (I2C_FLAG_AF | I2C_FLAG_STOPF)) == 0U) && (spin > 0U))
+  {
+    spin--;
+  }
+  status = I2C_WaitOnSTOPFlagUntilTimeout(hi2c, Timeout, Tickstart);
+  if (status != HAL_OK)
+  {
+    return status;
+  }
+
+  /* Clear STOP Flag */
+  __HAL_I2C_CLEAR_FLAG(hi2c, I2C_FLAG_STOPF);
+
+  /* Clear Configuration Register 2 */
+  I2C_RESET_CR2(hi2c);
+
+  hi2c->State = HAL_I2C_STATE_READY;
+  hi2c->Mode  = HAL_I2C_MODE_NONE;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hi2c);
+
+  return HAL_OK;
+}
+
 /**
   * @brief  This function handles Acknowledge failed detection during an I2C Communication.
   * @param  hi2c Pointer to a I2C_HandleTypeDef structure that contains
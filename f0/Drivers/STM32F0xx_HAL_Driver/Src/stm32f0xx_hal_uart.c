@@ -174,11 +174,17 @@
   */
 #define UART_CR1_FIELDS  ((uint32_t)(USART_CR1_M | USART_CR1_PCE | USART_CR1_PS | \
                                      USART_CR1_TE | USART_CR1_RE | USART_CR1_OVER8)) /*!< UART or USART CR1 fields of parameters set by UART_SetConfig API */
+#define UART_SHORT_XFER_MAX  4U    /*!< Frames of the short transmit fast path */
+
 /**
   * @}
   */
 
 /* Private macros ------------------------------------------------------------*/
+/* Polling loop iterations in about 1 ms: the short transfer fast path only reads
+   the tick once this budget is spent */
+#define UART_SHORT_XFER_SPIN()  ((SystemCoreClock / 24U / 1000U) + 1U)
+
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
 /** @addtogroup UART_Private_Functions
@@ -186,10 +192,13 @@
   */
 static void UART_EndTxTransfer(UART_HandleTypeDef *huart);
 static void UART_EndRxTransfer(UART_HandleTypeDef *huart);
+static HAL_StatusTypeDef UART_ShortTransmit(UART_HandleTypeDef *huart, uint8_t *pData, uint32_t Timeout,
+                                            uint32_t Tickstart);
 static void UART_DMATransmitCplt(DMA_HandleTypeDef *hdma);
 static void UART_DMATxHalfCplt(DMA_HandleTypeDef *hdma);
 static void UART_DMAReceiveCplt(DMA_HandleTypeDef *hdma);
 static void UART_DMARxHalfCplt(DMA_HandleTypeDef *hdma);
+static void UART_RxToIdleEvent(UART_HandleTypeDef *huart, HAL_UART_RxEventTypeTypeDef EventType);
 static void UART_DMAError(DMA_HandleTypeDef *hdma);
 static void UART_DMAAbortOnError(DMA_HandleTypeDef *hdma);
 static void UART_DMATxAbortCallback(DMA_HandleTypeDef *hdma);
@@ -686,6 +695,8 @@ __weak void HAL_UART_MspDeInit(UART_HandleTypeDef *huart)
   *         address of user data buffer containing data to be sent, should be aligned on a half word frontier (16 bits)
   *         (as sent data will be handled using u16 pointer cast). Depending on compilation chain,
   *         use of specific alignment compilation directives or pragmas might be required to ensure proper alignment for pData.
+  * @note   Transmissions of up to UART_SHORT_XFER_MAX frames of 8 bits or less take
+  *         a fast path without tick read for each frame.
   * @retval HAL status
   */
 HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size, uint32_t Timeout)
@@ -723,6 +734,13 @@ HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart, uint8_t *pData, u
 
     huart->TxXferSize = Size;
     huart->TxXferCount = Size;
+    /* Short transmission: no tick read for each frame */
+    if ((Size <= UART_SHORT_XFER_MAX) &&
+        !((huart->Init.WordLength == UART_WORDLENGTH_9B) && (huart->Init.Parity == UART_PARITY_NONE)))
+    {
+      return UART_ShortTransmit(huart, pData, Timeout, tickstart);
+    }
+
     while(huart->TxXferCount > 0)
     {
       huart->TxXferCount--;
@@ -835,6 +853,7 @@ HAL_StatusTypeDef HAL_UART_Receive(UART_HandleTypeDef *huart, uint8_t *pData, ui
 
     /* At end of Rx process, restore huart->RxState to Ready */
     huart->RxState = HAL_UART_STATE_READY;
+    huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
 
     /* Process Unlocked */
     __HAL_UNLOCK(huart);
@@ -1231,6 +1250,63 @@ HAL_StatusTypeDef HAL_UART_DMAStop(UART_HandleTypeDef *huart)
   return HAL_OK;
 }
 
+/**
+  * @brief Receive data in DMA mode till either the expected number of data
+  *        is received or an IDLE event occurs.
+  * @note   Reception is reported through HAL_UARTEx_RxEventCallback() on IDLE line
+  *         detection, DMA half transfer and DMA transfer complete events, with the
+  *         offset and length of the newly received data in pData: no data is copied
+  *         and HAL_UART_RxCpltCallback()/HAL_UART_RxHalfCpltCallback() are not called.
+  *         HAL_UARTEx_GetRxEventType() returns the event which triggered the callback.
+  * @note   When the Rx DMA channel is configured in DMA_CIRCULAR mode, pData is used
+  *         as a ring buffer and the reception goes on until HAL_UART_DMAStop() or
+  *         HAL_UART_AbortReceive() is called. Data must be consumed before the DMA
+  *         wraps around and overwrites it.
+  * @note   When the UART parity is enabled (PCE = 1), the received data contain
+  *         the parity bit (MSB position).
+  * @param huart UART handle.
+  * @param pData Pointer to data buffer.
+  * @param Size  Amount of data to be received.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size)
+{
+  HAL_StatusTypeDef status;
+
+  /* Check that a Rx process is not already ongoing */
+  if (huart->RxState == HAL_UART_STATE_READY)
+  {
+    if ((pData == NULL) || (Size == 0U) || (huart->hdmarx == NULL))
+    {
+      return HAL_ERROR;
+    }
+
+    /* Clear a pending IDLE flag before the reception starts */
+    __HAL_UART_CLEAR_IDLEFLAG(huart);
+
+    /* Route the DMA events to the Rx Event callback */
+    huart->ReceptionType = HAL_UART_RECEPTION_TOIDLE;
+    huart->RxEventType   = HAL_UART_RXEVENT_TC;
+    huart->RxEventOffset = 0U;
+
+    status = HAL_UART_Receive_DMA(huart, pData, Size);
+    if (status != HAL_OK)
+    {
+      huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+      return status;
+    }
+
+    /* Enable the UART IDLE line detection interrupt */
+    SET_BIT(huart->Instance->CR1, USART_CR1_IDLEIE);
+
+    return HAL_OK;
+  }
+  else
+  {
+    return HAL_BUSY;
+  }
+}
+
 /**
   * @brief  Abort ongoing transfers (blocking mode).
   * @param  huart UART handle.
@@ -1246,7 +1322,7 @@ HAL_StatusTypeDef HAL_UART_DMAStop(UART_HandleTypeDef *huart)
 HAL_StatusTypeDef HAL_UART_Abort(UART_HandleTypeDef *huart)
 {
   /* Disable TXEIE, TCIE, RXNE, PE and ERR (Frame error, noise error, overrun error) interrupts */
-  CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_PEIE | USART_CR1_TXEIE | USART_CR1_TCIE));
+  CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_IDLEIE | USART_CR1_PEIE | USART_CR1_TXEIE | USART_CR1_TCIE));
   CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE);
 
   /* Disable the UART DMA Tx request if enabled */
@@ -1291,6 +1367,7 @@ HAL_StatusTypeDef HAL_UART_Abort(UART_HandleTypeDef *huart)
   /* Restore huart->gState and huart->RxState to Ready */
   huart->gState  = HAL_UART_STATE_READY;
   huart->RxState = HAL_UART_STATE_READY;
+  huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
 
   /* Reset Handle ErrorCode to No Error */
   huart->ErrorCode = HAL_UART_ERROR_NONE;
@@ -1355,7 +1432,7 @@ HAL_StatusTypeDef HAL_UART_AbortTransmit(UART_HandleTypeDef *huart)
 HAL_StatusTypeDef HAL_UART_AbortReceive(UART_HandleTypeDef *huart)
 {
   /* Disable RXNE, PE and ERR (Frame error, noise error, overrun error) interrupts */
-  CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_PEIE));
+  CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_IDLEIE | USART_CR1_PEIE));
   CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE);
 
   /* Disable the UART DMA Rx request if enabled */
@@ -1382,6 +1459,7 @@ HAL_StatusTypeDef HAL_UART_AbortReceive(UART_HandleTypeDef *huart)
 
   /* Restore huart->RxState to Ready */
   huart->RxState = HAL_UART_STATE_READY;
+  huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
 
   return HAL_OK;
 }
@@ -1405,7 +1483,7 @@ HAL_StatusTypeDef HAL_UART_Abort_IT(UART_HandleTypeDef *huart)
   uint32_t abortcplt = 1U;
   
   /* Disable TXEIE, TCIE, RXNE, PE and ERR (Frame error, noise error, overrun error) interrupts */
-  CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_PEIE | USART_CR1_TXEIE | USART_CR1_TCIE));
+  CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_IDLEIE | USART_CR1_PEIE | USART_CR1_TXEIE | USART_CR1_TCIE));
   CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE);
 
   /* If DMA Tx and/or DMA Rx Handles are associated to UART Handle, DMA Abort complete callbacks should be initialised
@@ -1503,6 +1581,7 @@ HAL_StatusTypeDef HAL_UART_Abort_IT(UART_HandleTypeDef *huart)
     /* Restore huart->gState and huart->RxState to Ready */
     huart->gState  = HAL_UART_STATE_READY;
     huart->RxState = HAL_UART_STATE_READY;
+    huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
 
     /* As no DMA to be aborted, call directly user Abort complete callback */
     HAL_UART_AbortCpltCallback(huart);
@@ -1593,7 +1672,7 @@ HAL_StatusTypeDef HAL_UART_AbortTransmit_IT(UART_HandleTypeDef *huart)
 HAL_StatusTypeDef HAL_UART_AbortReceive_IT(UART_HandleTypeDef *huart)
 {
   /* Disable RXNE, PE and ERR (Frame error, noise error, overrun error) interrupts */
-  CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_PEIE));
+  CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_IDLEIE | USART_CR1_PEIE));
   CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE);
 
   /* Disable the UART DMA Rx request if enabled */
@@ -1625,6 +1704,7 @@ HAL_StatusTypeDef HAL_UART_AbortReceive_IT(UART_HandleTypeDef *huart)
 
       /* Restore huart->RxState to Ready */
       huart->RxState = HAL_UART_STATE_READY;
+      huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
 
       /* As no DMA to be aborted, call directly user Abort complete callback */
       HAL_UART_AbortReceiveCpltCallback(huart);
@@ -1640,6 +1720,7 @@ HAL_StatusTypeDef HAL_UART_AbortReceive_IT(UART_HandleTypeDef *huart)
 
     /* Restore huart->RxState to Ready */
     huart->RxState = HAL_UART_STATE_READY;
+    huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
 
     /* As no DMA to be aborted, call directly user Abort complete callback */
     HAL_UART_AbortReceiveCpltCallback(huart);
@@ -1751,12 +1832,14 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
           }
           else
           {
+            __HAL_TRACE(HAL_TRACE_EVT_UART_ERROR, huart->Instance);
             /* Call user error callback */
             HAL_UART_ErrorCallback(huart);
           }
         }
         else
         {
+          __HAL_TRACE(HAL_TRACE_EVT_UART_ERROR, huart->Instance);
           /* Call user error callback */
           HAL_UART_ErrorCallback(huart);
         }
@@ -1765,6 +1848,7 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
       {
         /* Non Blocking error : transfer could go on. 
            Error is notified to user through user error callback */
+        __HAL_TRACE(HAL_TRACE_EVT_UART_ERROR, huart->Instance);
         HAL_UART_ErrorCallback(huart);
         huart->ErrorCode = HAL_UART_ERROR_NONE;
       }
@@ -1773,6 +1857,17 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
 
   } /* End if some error occurs */
 
+  /* UART IDLE line detected during a reception to idle ----------------------*/
+  if (   (huart->ReceptionType == HAL_UART_RECEPTION_TOIDLE)
+      && ((isrflags & USART_ISR_IDLE) != RESET)
+      && ((cr1its & USART_CR1_IDLEIE) != RESET))
+  {
+    __HAL_UART_CLEAR_IDLEFLAG(huart);
+
+    UART_RxToIdleEvent(huart, HAL_UART_RXEVENT_IDLE);
+    return;
+  }
+
 #if !defined(STM32F030x6) && !defined(STM32F030x8)&& !defined(STM32F070xB)&& !defined(STM32F070x6)&& !defined(STM32F030xC)
   /* UART wakeup from Stop mode interrupt occurred ---------------------------*/
   if(((isrflags & USART_ISR_WUF) != RESET) && ((cr3its & USART_CR3_WUFIE) != RESET))
@@ -1781,6 +1876,7 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
     /* Set the UART state ready to be able to start again the process */
     huart->gState  = HAL_UART_STATE_READY;
     huart->RxState = HAL_UART_STATE_READY;
+    huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
     HAL_UARTEx_WakeupCallback(huart);
     return;
   }
@@ -1922,6 +2018,25 @@ __weak void HAL_UART_AbortReceiveCpltCallback (UART_HandleTypeDef *huart)
    */
 }
 
+/**
+  * @brief  Reception Event Callback (Rx event notification called after use of advanced reception service).
+  * @param  huart UART handle
+  * @param  Offset Offset in the reception buffer of the first received byte.
+  * @param  Length Number of bytes received from Offset.
+  * @retval None
+  */
+__weak void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Offset, uint16_t Length)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(huart);
+  UNUSED(Offset);
+  UNUSED(Length);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_UARTEx_RxEventCallback can be implemented in the user file.
+   */
+}
+
 /**
   * @}
   */
@@ -2089,6 +2204,18 @@ uint32_t HAL_UART_GetError(UART_HandleTypeDef *huart)
 {
   return huart->ErrorCode;
 }
+
+/**
+  * @brief  Provide the type of the Rx Event which led to the last call of the
+  *         Rx Event callback of a reception to idle.
+  * @param  huart UART handle.
+  * @retval Rx Event Type (returned value will be a value of @ref UART_RxEvent_Type_Values)
+  */
+HAL_UART_RxEventTypeTypeDef HAL_UARTEx_GetRxEventType(UART_HandleTypeDef *huart)
+{
+  /* Return Rx Event type value, as stored in UART handle */
+  return(huart->RxEventType);
+}
 /**
   * @}
   */
@@ -2330,6 +2457,7 @@ HAL_StatusTypeDef UART_CheckIdleState(UART_HandleTypeDef *huart)
   /* Initialize the UART State */
   huart->gState  = HAL_UART_STATE_READY;
   huart->RxState = HAL_UART_STATE_READY;
+  huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
 
   /* Process Unlocked */
   __HAL_UNLOCK(huart);
@@ -2362,6 +2490,7 @@ HAL_StatusTypeDef UART_WaitOnFlagUntilTimeout(UART_HandleTypeDef *huart, uint32_
 
         huart->gState  = HAL_UART_STATE_READY;
         huart->RxState = HAL_UART_STATE_READY;
+        huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
 
         /* Process Unlocked */
         __HAL_UNLOCK(huart);
@@ -2388,6 +2517,53 @@ static void UART_EndTxTransfer(UART_HandleTypeDef *huart)
 }
 
 
+/**
+  * @brief  Short transmission: TDR is written as soon as TXE is set. The tick is only
+  *         read once the UART_SHORT_XFER_SPIN() polling budget is spent.
+  * @param  huart UART handle.
+  * @param  pData Pointer to data buffer, TxXferCount frames of 8 bits or less.
+  * @param  Timeout Timeout duration.
+  * @param  Tickstart Tick start value.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef UART_ShortTransmit(UART_HandleTypeDef *huart, uint8_t *pData, uint32_t Timeout,
+                                            uint32_t Tickstart)
+{
+  uint32_t spin = UART_SHORT_XFER_SPIN();
+
+  while (huart->TxXferCount > 0U)
+  {
+    while ((__HAL_UART_GET_FLAG(huart, UART_FLAG_TXE) == RESET) && (spin > 0U))
+    {
+      spin--;
+    }
+    if (UART_WaitOnFlagUntilTimeout(huart, UART_FLAG_TXE, RESET, Tickstart, Timeout) != HAL_OK)
+    {
+      return HAL_TIMEOUT;
+    }
+    huart->Instance->TDR = (uint8_t)(*pData & 0xFFU);
+    pData++;
+    huart->TxXferCount--;
+  }
+
+  while ((__HAL_UART_GET_FLAG(huart, UART_FLAG_TC) == RESET) && (spin > 0U))
+  {
+    spin--;
+  }
+  if (UART_WaitOnFlagUntilTimeout(huart, UART_FLAG_TC, RESET, Tickstart, Timeout) != HAL_OK)
+  {
+    return HAL_TIMEOUT;
+  }
+
+  /* At end of Tx process, restore huart->gState to Ready */
+  huart->gState = HAL_UART_STATE_READY;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(huart);
+
+  return HAL_OK;
+}
+
 /**
   * @brief  End ongoing Rx transfer on UART peripheral (following error detection or Reception completion).
   * @param  huart UART handle.
@@ -2396,11 +2572,12 @@ static void UART_EndTxTransfer(UART_HandleTypeDef *huart)
 static void UART_EndRxTransfer(UART_HandleTypeDef *huart)
 {
   /* Disable RXNE, PE and ERR (Frame error, noise error, overrun error) interrupts */
-  CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_PEIE));
+  CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_IDLEIE | USART_CR1_PEIE));
   CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE);
 
   /* At end of Rx process, restore huart->RxState to Ready */
   huart->RxState = HAL_UART_STATE_READY;
+  huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
 }
 
 
@@ -2467,10 +2644,19 @@ static void UART_DMAReceiveCplt(DMA_HandleTypeDef *hdma)
        in the UART CR3 register */
     CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAR);
 
+    /* Disable the IDLE interrupt of a reception to idle */
+    CLEAR_BIT(huart->Instance->CR1, USART_CR1_IDLEIE);
+
     /* At end of Rx process, restore huart->RxState to Ready */
     huart->RxState = HAL_UART_STATE_READY;
   }
 
+  if (huart->ReceptionType == HAL_UART_RECEPTION_TOIDLE)
+  {
+    UART_RxToIdleEvent(huart, HAL_UART_RXEVENT_TC);
+    return;
+  }
+
   HAL_UART_RxCpltCallback(huart);
 }
 
@@ -2483,9 +2669,62 @@ static void UART_DMARxHalfCplt(DMA_HandleTypeDef *hdma)
 {
   UART_HandleTypeDef* huart = (UART_HandleTypeDef*)(hdma->Parent);
 
+  if (huart->ReceptionType == HAL_UART_RECEPTION_TOIDLE)
+  {
+    UART_RxToIdleEvent(huart, HAL_UART_RXEVENT_HT);
+    return;
+  }
+
   HAL_UART_RxHalfCpltCallback(huart);
 }
 
+/**
+  * @brief  Report the data received since the previous Rx Event of a reception to idle.
+  * @note   The reported window [Offset, Offset + Length) is located in the reception
+  *         buffer: no data is copied. A window wrapping around the end of the
+  *         buffer (DMA circular mode) is reported in two calls of the Rx Event callback.
+  * @param  huart UART handle.
+  * @param  EventType Rx Event that triggered the report (IDLE, HT or TC).
+  * @retval None
+  */
+static void UART_RxToIdleEvent(UART_HandleTypeDef *huart, HAL_UART_RxEventTypeTypeDef EventType)
+{
+  uint16_t head = huart->RxXferSize - (uint16_t)__HAL_DMA_GET_COUNTER(huart->hdmarx);
+  uint16_t tail = huart->RxEventOffset;
+  uint16_t length;
+  uint16_t wrapped = 0U;
+
+  if (head >= tail)
+  {
+    length = head - tail;
+  }
+  else
+  {
+    /* DMA has wrapped around the end of the circular buffer */
+    length  = huart->RxXferSize - tail;
+    wrapped = head;
+  }
+
+  huart->RxEventType   = EventType;
+  huart->RxEventOffset = (head == huart->RxXferSize) ? 0U : head;
+
+  /* Reception over (DMA normal mode) : release the reception type before
+     calling the user, who may start a new reception from the callback */
+  if (huart->RxState == HAL_UART_STATE_READY)
+  {
+    huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+  }
+
+  if (length != 0U)
+  {
+    HAL_UARTEx_RxEventCallback(huart, tail, length);
+  }
+  if (wrapped != 0U)
+  {
+    HAL_UARTEx_RxEventCallback(huart, 0U, wrapped);
+  }
+}
+
 /**
   * @brief DMA UART communication error callback.
   * @param hdma DMA handle.
@@ -2566,6 +2805,7 @@ static void UART_DMATxAbortCallback(DMA_HandleTypeDef *hdma)
   /* Restore huart->gState and huart->RxState to Ready */
   huart->gState  = HAL_UART_STATE_READY;
   huart->RxState = HAL_UART_STATE_READY;
+  huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
 
   /* Call user Abort complete callback */
   HAL_UART_AbortCpltCallback(huart);
@@ -2608,6 +2848,7 @@ static void UART_DMARxAbortCallback(DMA_HandleTypeDef *hdma)
   /* Restore huart->gState and huart->RxState to Ready */
   huart->gState  = HAL_UART_STATE_READY;
   huart->RxState = HAL_UART_STATE_READY;
+  huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
 
   /* Call user Abort complete callback */
   HAL_UART_AbortCpltCallback(huart);
@@ -2654,6 +2895,7 @@ static void UART_DMARxOnlyAbortCallback(DMA_HandleTypeDef *hdma)
 
   /* Restore huart->RxState to Ready */
   huart->RxState = HAL_UART_STATE_READY;
+  huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
 
   /* Call user Abort complete callback */
   HAL_UART_AbortReceiveCpltCallback(huart);
@@ -2763,6 +3005,7 @@ HAL_StatusTypeDef UART_Receive_IT(UART_HandleTypeDef *huart)
 
       /* Rx process is completed, restore huart->RxState to Ready */
       huart->RxState = HAL_UART_STATE_READY;
+      huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
 
       HAL_UART_RxCpltCallback(huart);
 
@@ -0,0 +1,426 @@
+/**
+  ******************************************************************************
+  * @file    ll_board.h
+  * @author  MCD Application Team
+  * @brief   Compile time checked board pin map and clock tree, applied
+  *          with a minimal number of register writes over the LL drivers.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- describe the board pins with an X macro taking a context argument, one
+   line per pin:
+     #define BOARD_PINS(X, P) \
+       X(P, LD2,    A,  5, OUTPUT,    PUSHPULL, LOW,  NO, 0) \
+       X(P, VCP_TX, A,  2, ALTERNATE, PUSHPULL, HIGH, NO, 1)
+   the fields are the name, port letter, pin number, the suffixes of the
+   LL_GPIO_MODE_xxx, LL_GPIO_OUTPUT_xxx, LL_GPIO_SPEED_FREQ_xxx and
+   LL_GPIO_PULL_xxx constants and the alternate function number. The maps
+   of the boards of OSQ/variants_remap.json are provided below, named after
+   the variant, e.g. LL_BOARD_PINS_NUCLEO_F072RB.
+
+2- LL_BOARD_CHECK_PINS(BOARD_PINS); at file scope fails the build on a pin
+   number above 15, an alternate function above 7, an alternate function
+   on a pin not in alternate mode, a pull on an analog pin or two lines for
+   the same pin. A port the device does not have does not compile.
+   LL_BOARD_PIN_NAMES(BOARD_PINS); declares LL_BOARD_<name> pin masks for
+   the LL_GPIO_xxx functions.
+
+3- LL_BOARD_GPIO_INIT(BOARD_PINS); enables the clock of the ports used and
+   writes each register of these ports once, masks and values being
+   constants, instead of a HAL_GPIO_Init() loop per pin. The registers of
+   the unused ports and the AFR of ports without alternate pins are not
+   touched.
+
+4- the clock tree is given by the LL_BOARD_SYSCLK_SOURCE, LL_BOARD_PLL_xxx
+   and LL_BOARD_xxx_DIV defines, checked against the device limits when
+   the header is compiled. LL_Board_ClockInit() programs it from the reset
+   configuration: flash latency, oscillator, PLL, prescalers and switch,
+   then updates SystemCoreClock. LL_BOARD_HCLK_HZ and LL_BOARD_PCLK_HZ are
+   constants for LL_Init1msTick() and baud rate computations.
+
+5- the header is C and C++ compatible: the checks are static_assert in
+   C++11, _Static_assert in C11 and an array of negative size otherwise.
+*******************************************************************************/
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _LL_BOARD_H__
+#define _LL_BOARD_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "stm32f0xx_ll_gpio.h"
+#include "stm32f0xx_ll_rcc.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define LL_BOARD_CLK_HSI         0U
+#define LL_BOARD_CLK_HSE         1U
+#define LL_BOARD_CLK_PLL         2U
+
+/* Clock tree, override in main.h. Default: HSI / 2 * 12 = 48 MHz */
+#if !defined(LL_BOARD_SYSCLK_SOURCE)
+#define LL_BOARD_SYSCLK_SOURCE   LL_BOARD_CLK_PLL
+#endif
+#if !defined(LL_BOARD_PLL_SOURCE)
+#define LL_BOARD_PLL_SOURCE      LL_BOARD_CLK_HSI
+#endif
+#if !defined(LL_BOARD_PLL_PREDIV)
+#define LL_BOARD_PLL_PREDIV      2U          /* 1 to 16, 2 for HSI on STM32F030x8/F05x */
+#endif
+#if !defined(LL_BOARD_PLL_MUL)
+#define LL_BOARD_PLL_MUL         12U         /* 2 to 16 */
+#endif
+#if !defined(LL_BOARD_AHB_DIV)
+#define LL_BOARD_AHB_DIV         1U          /* 1, 2, 4, 8, 16, 64, 128, 256, 512 */
+#endif
+#if !defined(LL_BOARD_APB_DIV)
+#define LL_BOARD_APB_DIV         1U          /* 1, 2, 4, 8, 16 */
+#endif
+#if !defined(LL_BOARD_HSE_BYPASS)
+#define LL_BOARD_HSE_BYPASS      0U          /* 1: external clock on OSC_IN */
+#endif
+#if !defined(LL_BOARD_STARTUP_LOOPS)
+#define LL_BOARD_STARTUP_LOOPS   0x50000U    /* Oscillator and PLL ready polling */
+#endif
+
+/* Port numbers, also the bit of the port in RCC_AHBENR from GPIOAEN */
+#define LL_BOARD_PORT_A          0U
+#define LL_BOARD_PORT_B          1U
+#define LL_BOARD_PORT_C          2U
+#if defined(GPIOD)
+#define LL_BOARD_PORT_D          3U
+#endif
+#if defined(GPIOE)
+#define LL_BOARD_PORT_E          4U
+#endif
+#define LL_BOARD_PORT_F          5U
+
+/* Exported macro ------------------------------------------------------------*/
+#if defined(__cplusplus) && (__cplusplus >= 201103L)
+#define LL_BOARD_STATIC_ASSERT(__COND__, __MSG__)  static_assert((__COND__), __MSG__)
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+#define LL_BOARD_STATIC_ASSERT(__COND__, __MSG__)  _Static_assert((__COND__), __MSG__)
+#else
+#define LL_BOARD_STATIC_ASSERT(__COND__, __MSG__)  extern char LL_Board_Check[(__COND__) ? 1 : -1]
+#endif
+
+/* Pin map fields, summed over the pins of port __P__ */
+#define LL_BOARD_X_PINS(__P__, NAME, PORT, PIN, MODE, OTYPE, SPEED, PULL, AF) \
+  + ((LL_BOARD_PORT_##PORT == (__P__)) ? (1UL << (PIN)) : 0U)
+#define LL_BOARD_X_PINS_OR(__P__, NAME, PORT, PIN, MODE, OTYPE, SPEED, PULL, AF) \
+  | ((LL_BOARD_PORT_##PORT == (__P__)) ? (1UL << (PIN)) : 0U)
+#define LL_BOARD_X_MASK2(__P__, NAME, PORT, PIN, MODE, OTYPE, SPEED, PULL, AF) \
+  + ((LL_BOARD_PORT_##PORT == (__P__)) ? (3UL << (2U * (PIN))) : 0U)
+#define LL_BOARD_X_MODER(__P__, NAME, PORT, PIN, MODE, OTYPE, SPEED, PULL, AF) \
+  + ((LL_BOARD_PORT_##PORT == (__P__)) ? (LL_GPIO_MODE_##MODE << (2U * (PIN))) : 0U)
+#define LL_BOARD_X_OTYPER(__P__, NAME, PORT, PIN, MODE, OTYPE, SPEED, PULL, AF) \
+  + ((LL_BOARD_PORT_##PORT == (__P__)) ? (LL_GPIO_OUTPUT_##OTYPE << (PIN)) : 0U)
+#define LL_BOARD_X_OSPEEDR(__P__, NAME, PORT, PIN, MODE, OTYPE, SPEED, PULL, AF) \
+  + ((LL_BOARD_PORT_##PORT == (__P__)) ? (LL_GPIO_SPEED_FREQ_##SPEED << (2U * (PIN))) : 0U)
+#define LL_BOARD_X_PUPDR(__P__, NAME, PORT, PIN, MODE, OTYPE, SPEED, PULL, AF) \
+  + ((LL_BOARD_PORT_##PORT == (__P__)) ? (LL_GPIO_PULL_##PULL << (2U * (PIN))) : 0U)
+#define LL_BOARD_X_AFR_MASK(__P__, NAME, PORT, PIN, MODE, OTYPE, SPEED, PULL, AF) \
+  + (((LL_BOARD_PORT_##PORT == ((__P__) >> 1U)) && (((PIN) >> 3U) == ((__P__) & 1U)) && \
+      (LL_GPIO_MODE_##MODE == LL_GPIO_MODE_ALTERNATE)) ? (0xFUL << (4U * ((PIN) & 7U))) : 0U)
+#define LL_BOARD_X_AFR(__P__, NAME, PORT, PIN, MODE, OTYPE, SPEED, PULL, AF) \
+  + (((LL_BOARD_PORT_##PORT == ((__P__) >> 1U)) && (((PIN) >> 3U) == ((__P__) & 1U)) && \
+      (LL_GPIO_MODE_##MODE == LL_GPIO_MODE_ALTERNATE)) ? ((uint32_t)(AF) << (4U * ((PIN) & 7U))) : 0U)
+#define LL_BOARD_X_CLOCKS(__P__, NAME, PORT, PIN, MODE, OTYPE, SPEED, PULL, AF) \
+  | (RCC_AHBENR_GPIOAEN << LL_BOARD_PORT_##PORT)
+#define LL_BOARD_X_NAME(__P__, NAME, PORT, PIN, MODE, OTYPE, SPEED, PULL, AF) \
+  LL_BOARD_##NAME = (1 << (PIN)),
+
+/* Pin map errors, counted over all the pins */
+#define LL_BOARD_X_BAD_PIN(__P__, NAME, PORT, PIN, MODE, OTYPE, SPEED, PULL, AF) \
+  + (((PIN) > 15U) ? 1U : 0U)
+#define LL_BOARD_X_BAD_AF(__P__, NAME, PORT, PIN, MODE, OTYPE, SPEED, PULL, AF) \
+  + (((AF) > 7U) ? 1U : 0U)
+#define LL_BOARD_X_STRAY_AF(__P__, NAME, PORT, PIN, MODE, OTYPE, SPEED, PULL, AF) \
+  + ((((AF) != 0U) && (LL_GPIO_MODE_##MODE != LL_GPIO_MODE_ALTERNATE)) ? 1U : 0U)
+#define LL_BOARD_X_ANALOG_PULL(__P__, NAME, PORT, PIN, MODE, OTYPE, SPEED, PULL, AF) \
+  + (((LL_GPIO_MODE_##MODE == LL_GPIO_MODE_ANALOG) && (LL_GPIO_PULL_##PULL != LL_GPIO_PULL_NO)) ? 1U : 0U)
+
+#define LL_BOARD_PIN_MASK(__MAP__, __P__)  (0U __MAP__(LL_BOARD_X_PINS, (__P__)))
+#define LL_BOARD_UNIQUE(__MAP__, __P__)    ((0U __MAP__(LL_BOARD_X_PINS, (__P__))) == (0U __MAP__(LL_BOARD_X_PINS_OR, (__P__))))
+
+/**
+  * @brief  Compile time checks of a pin map, at file scope
+  * @param  __MAP__: pin map X macro
+  */
+#define LL_BOARD_CHECK_PINS(__MAP__)                                                                    \
+  LL_BOARD_STATIC_ASSERT((0U __MAP__(LL_BOARD_X_BAD_PIN, 0U)) == 0U, "pin number above 15");             \
+  LL_BOARD_STATIC_ASSERT((0U __MAP__(LL_BOARD_X_BAD_AF, 0U)) == 0U, "alternate function above 7");       \
+  LL_BOARD_STATIC_ASSERT((0U __MAP__(LL_BOARD_X_STRAY_AF, 0U)) == 0U,                                    \
+                         "alternate function on a pin not in alternate mode");                           \
+  LL_BOARD_STATIC_ASSERT((0U __MAP__(LL_BOARD_X_ANALOG_PULL, 0U)) == 0U, "pull on an analog pin");       \
+  LL_BOARD_STATIC_ASSERT(LL_BOARD_UNIQUE(__MAP__, 0U) && LL_BOARD_UNIQUE(__MAP__, 1U) &&                 \
+                         LL_BOARD_UNIQUE(__MAP__, 2U) && LL_BOARD_UNIQUE(__MAP__, 3U) &&                 \
+                         LL_BOARD_UNIQUE(__MAP__, 4U) && LL_BOARD_UNIQUE(__MAP__, 5U),                   \
+                         "pin described twice")
+
+/**
+  * @brief  LL_BOARD_<name> pin masks of a pin map
+  * @param  __MAP__: pin map X macro
+  */
+#define LL_BOARD_PIN_NAMES(__MAP__)  enum { __MAP__(LL_BOARD_X_NAME, 0U) LL_BOARD_PIN_NAMES_END_##__MAP__ }
+
+/* Registers of one port, AFR[0] and AFR[1] as half ports 2 * P and 2 * P + 1 */
+#define LL_BOARD_INIT_PORT(__MAP__, __GPIO__, __P__)                                                    \
+  if (LL_BOARD_PIN_MASK(__MAP__, (__P__)) != 0U)                                                        \
+  {                                                                                                     \
+    if ((0U __MAP__(LL_BOARD_X_AFR_MASK, 2U * (__P__))) != 0U)                                          \
+    {                                                                                                   \
+      MODIFY_REG((__GPIO__)->AFR[0], (0U __MAP__(LL_BOARD_X_AFR_MASK, 2U * (__P__))),                   \
+                 (0U __MAP__(LL_BOARD_X_AFR, 2U * (__P__))));                                           \
+    }                                                                                                   \
+    if ((0U __MAP__(LL_BOARD_X_AFR_MASK, (2U * (__P__)) + 1U)) != 0U)                                   \
+    {                                                                                                   \
+      MODIFY_REG((__GPIO__)->AFR[1], (0U __MAP__(LL_BOARD_X_AFR_MASK, (2U * (__P__)) + 1U)),            \
+                 (0U __MAP__(LL_BOARD_X_AFR, (2U * (__P__)) + 1U)));                                    \
+    }                                                                                                   \
+    MODIFY_REG((__GPIO__)->OTYPER, LL_BOARD_PIN_MASK(__MAP__, (__P__)), (0U __MAP__(LL_BOARD_X_OTYPER, (__P__)))); \
+    MODIFY_REG((__GPIO__)->OSPEEDR, (0U __MAP__(LL_BOARD_X_MASK2, (__P__))), (0U __MAP__(LL_BOARD_X_OSPEEDR, (__P__)))); \
+    MODIFY_REG((__GPIO__)->PUPDR, (0U __MAP__(LL_BOARD_X_MASK2, (__P__))), (0U __MAP__(LL_BOARD_X_PUPDR, (__P__)))); \
+    MODIFY_REG((__GPIO__)->MODER, (0U __MAP__(LL_BOARD_X_MASK2, (__P__))), (0U __MAP__(LL_BOARD_X_MODER, (__P__)))); \
+  }
+
+#if defined(GPIOD)
+#define LL_BOARD_INIT_PORT_D(__MAP__)  LL_BOARD_INIT_PORT(__MAP__, GPIOD, LL_BOARD_PORT_D)
+#else
+#define LL_BOARD_INIT_PORT_D(__MAP__)
+#endif
+#if defined(GPIOE)
+#define LL_BOARD_INIT_PORT_E(__MAP__)  LL_BOARD_INIT_PORT(__MAP__, GPIOE, LL_BOARD_PORT_E)
+#else
+#define LL_BOARD_INIT_PORT_E(__MAP__)
+#endif
+
+/**
+  * @brief  Configure the pins of a pin map and enable the clock of their ports
+  * @param  __MAP__: pin map X macro
+  */
+#define LL_BOARD_GPIO_INIT(__MAP__)                                                                     \
+  do {                                                                                                  \
+    SET_BIT(RCC->AHBENR, (0U __MAP__(LL_BOARD_X_CLOCKS, 0U)));                                          \
+    (void)READ_BIT(RCC->AHBENR, (0U __MAP__(LL_BOARD_X_CLOCKS, 0U)));                                   \
+    LL_BOARD_INIT_PORT(__MAP__, GPIOA, LL_BOARD_PORT_A)                                                 \
+    LL_BOARD_INIT_PORT(__MAP__, GPIOB, LL_BOARD_PORT_B)                                                 \
+    LL_BOARD_INIT_PORT(__MAP__, GPIOC, LL_BOARD_PORT_C)                                                 \
+    LL_BOARD_INIT_PORT_D(__MAP__)                                                                       \
+    LL_BOARD_INIT_PORT_E(__MAP__)                                                                       \
+    LL_BOARD_INIT_PORT(__MAP__, GPIOF, LL_BOARD_PORT_F)                                                 \
+  } while(0)
+
+/* Board pin maps -------------------------------------------------------------*/
+/* STM32F0xx-Nucleo: nucleo_f070rb, nucleo_f072rb, nucleo_f091rc */
+#define LL_BOARD_PINS_NUCLEO_64(X, P)                                  \
+  X(P, LD2,    A,  5, OUTPUT,    PUSHPULL, LOW,  NO, 0)                \
+  X(P, B1,     C, 13, INPUT,     PUSHPULL, LOW,  NO, 0)                \
+  X(P, VCP_TX, A,  2, ALTERNATE, PUSHPULL, HIGH, NO, 1)                \
+  X(P, VCP_RX, A,  3, ALTERNATE, PUSHPULL, HIGH, UP, 1)
+
+/* STM32F0xx_Nucleo_32: nucleo_f031k6, nucleo_f042k6 */
+#define LL_BOARD_PINS_NUCLEO_32(X, P)                                  \
+  X(P, LD3,    B,  3, OUTPUT,    PUSHPULL, LOW,  NO, 0)                \
+  X(P, VCP_TX, A,  2, ALTERNATE, PUSHPULL, HIGH, NO, 1)                \
+  X(P, VCP_RX, A, 15, ALTERNATE, PUSHPULL, HIGH, UP, 1)
+
+/* STM32F0308-Discovery: disco_f030r8 */
+#define LL_BOARD_PINS_DISCO_F030R8(X, P)                               \
+  X(P, LD3,    C,  9, OUTPUT,    PUSHPULL, LOW,  NO, 0)                \
+  X(P, LD4,    C,  8, OUTPUT,    PUSHPULL, LOW,  NO, 0)                \
+  X(P, B1,     A,  0, INPUT,     PUSHPULL, LOW,  NO, 0)
+
+#define LL_BOARD_PINS_NUCLEO_F070RB    LL_BOARD_PINS_NUCLEO_64
+#define LL_BOARD_PINS_NUCLEO_F072RB    LL_BOARD_PINS_NUCLEO_64
+#define LL_BOARD_PINS_NUCLEO_F091RC    LL_BOARD_PINS_NUCLEO_64
+#define LL_BOARD_PINS_NUCLEO_F031K6    LL_BOARD_PINS_NUCLEO_32
+#define LL_BOARD_PINS_NUCLEO_F042K6    LL_BOARD_PINS_NUCLEO_32
+
+/* Clock tree ----------------------------------------------------------------*/
+#if (LL_BOARD_PLL_SOURCE == LL_BOARD_CLK_HSE)
+#define LL_BOARD_PLL_IN_HZ       (HSE_VALUE / LL_BOARD_PLL_PREDIV)
+#define LL_BOARD_PLLSRC          RCC_CFGR_PLLSRC_HSE_PREDIV
+#define LL_BOARD_CFGR2           (LL_BOARD_PLL_PREDIV - 1U)
+#elif defined(RCC_CFGR_PLLSRC_HSI_PREDIV)
+#define LL_BOARD_PLL_IN_HZ       (HSI_VALUE / LL_BOARD_PLL_PREDIV)
+#define LL_BOARD_PLLSRC          RCC_CFGR_PLLSRC_HSI_PREDIV
+#define LL_BOARD_CFGR2           (LL_BOARD_PLL_PREDIV - 1U)
+#else
+#define LL_BOARD_PLL_IN_HZ       (HSI_VALUE / 2U)
+#define LL_BOARD_PLLSRC          RCC_CFGR_PLLSRC_HSI_DIV2
+#define LL_BOARD_CFGR2           0U
+#endif
+
+#if (LL_BOARD_SYSCLK_SOURCE == LL_BOARD_CLK_PLL)
+#define LL_BOARD_SYSCLK_HZ       (LL_BOARD_PLL_IN_HZ * LL_BOARD_PLL_MUL)
+#define LL_BOARD_SW              RCC_CFGR_SW_PLL
+#define LL_BOARD_USES_HSE        (LL_BOARD_PLL_SOURCE == LL_BOARD_CLK_HSE)
+#elif (LL_BOARD_SYSCLK_SOURCE == LL_BOARD_CLK_HSE)
+#define LL_BOARD_SYSCLK_HZ       HSE_VALUE
+#define LL_BOARD_SW              RCC_CFGR_SW_HSE
+#define LL_BOARD_USES_HSE        1
+#elif (LL_BOARD_SYSCLK_SOURCE == LL_BOARD_CLK_HSI)
+#define LL_BOARD_SYSCLK_HZ       HSI_VALUE
+#define LL_BOARD_SW              RCC_CFGR_SW_HSI
+#define LL_BOARD_USES_HSE        0
+#else
+#error "LL_BOARD_SYSCLK_SOURCE must be LL_BOARD_CLK_HSI, LL_BOARD_CLK_HSE or LL_BOARD_CLK_PLL"
+#endif
+
+#define LL_BOARD_HCLK_HZ         (LL_BOARD_SYSCLK_HZ / LL_BOARD_AHB_DIV)
+#define LL_BOARD_PCLK_HZ         (LL_BOARD_HCLK_HZ / LL_BOARD_APB_DIV)
+#define LL_BOARD_FLASH_LATENCY   ((LL_BOARD_SYSCLK_HZ > 24000000U) ? FLASH_ACR_LATENCY : 0U)
+
+#define LL_BOARD_HPRE            ((LL_BOARD_AHB_DIV == 1U)   ? RCC_CFGR_HPRE_DIV1   : \
+                                  (LL_BOARD_AHB_DIV == 2U)   ? RCC_CFGR_HPRE_DIV2   : \
+                                  (LL_BOARD_AHB_DIV == 4U)   ? RCC_CFGR_HPRE_DIV4   : \
+                                  (LL_BOARD_AHB_DIV == 8U)   ? RCC_CFGR_HPRE_DIV8   : \
+                                  (LL_BOARD_AHB_DIV == 16U)  ? RCC_CFGR_HPRE_DIV16  : \
+                                  (LL_BOARD_AHB_DIV == 64U)  ? RCC_CFGR_HPRE_DIV64  : \
+                                  (LL_BOARD_AHB_DIV == 128U) ? RCC_CFGR_HPRE_DIV128 : \
+                                  (LL_BOARD_AHB_DIV == 256U) ? RCC_CFGR_HPRE_DIV256 : RCC_CFGR_HPRE_DIV512)
+#define LL_BOARD_PPRE            ((LL_BOARD_APB_DIV == 1U)   ? RCC_CFGR_PPRE_DIV1   : \
+                                  (LL_BOARD_APB_DIV == 2U)   ? RCC_CFGR_PPRE_DIV2   : \
+                                  (LL_BOARD_APB_DIV == 4U)   ? RCC_CFGR_PPRE_DIV4   : \
+                                  (LL_BOARD_APB_DIV == 8U)   ? RCC_CFGR_PPRE_DIV8   : RCC_CFGR_PPRE_DIV16)
+
+#if (LL_BOARD_SYSCLK_SOURCE == LL_BOARD_CLK_PLL)
+#define LL_BOARD_CFGR            (LL_BOARD_PLLSRC | ((LL_BOARD_PLL_MUL - 2U) << RCC_CFGR_PLLMUL_Pos))
+#else
+#define LL_BOARD_CFGR            0U
+#endif
+
+/* Clock tree checks */
+#if (LL_BOARD_SYSCLK_SOURCE == LL_BOARD_CLK_PLL)
+#if (LL_BOARD_PLL_SOURCE != LL_BOARD_CLK_HSI) && (LL_BOARD_PLL_SOURCE != LL_BOARD_CLK_HSE)
+#error "LL_BOARD_PLL_SOURCE must be LL_BOARD_CLK_HSI or LL_BOARD_CLK_HSE"
+#endif
+#if (LL_BOARD_PLL_SOURCE == LL_BOARD_CLK_HSI) && !defined(RCC_CFGR_PLLSRC_HSI_PREDIV) && (LL_BOARD_PLL_PREDIV != 2U)
+#error "the PLL input is HSI / 2 on this device, LL_BOARD_PLL_PREDIV must be 2"
+#endif
+LL_BOARD_STATIC_ASSERT((LL_BOARD_PLL_MUL >= 2U) && (LL_BOARD_PLL_MUL <= 16U), "LL_BOARD_PLL_MUL out of 2..16");
+LL_BOARD_STATIC_ASSERT((LL_BOARD_PLL_PREDIV >= 1U) && (LL_BOARD_PLL_PREDIV <= 16U), "LL_BOARD_PLL_PREDIV out of 1..16");
+LL_BOARD_STATIC_ASSERT((LL_BOARD_PLL_IN_HZ >= 1000000U) && (LL_BOARD_PLL_IN_HZ <= 24000000U), "PLL input out of 1..24 MHz");
+LL_BOARD_STATIC_ASSERT(LL_BOARD_SYSCLK_HZ >= 16000000U, "PLL output below 16 MHz");
+#endif
+#if LL_BOARD_USES_HSE
+LL_BOARD_STATIC_ASSERT((HSE_VALUE >= 4000000U) && (HSE_VALUE <= 32000000U), "HSE_VALUE out of 4..32 MHz");
+#endif
+LL_BOARD_STATIC_ASSERT(LL_BOARD_SYSCLK_HZ <= 48000000U, "SYSCLK above 48 MHz");
+LL_BOARD_STATIC_ASSERT((LL_BOARD_AHB_DIV == 1U) || (LL_BOARD_AHB_DIV == 2U) || (LL_BOARD_AHB_DIV == 4U) ||
+                       (LL_BOARD_AHB_DIV == 8U) || (LL_BOARD_AHB_DIV == 16U) || (LL_BOARD_AHB_DIV == 64U) ||
+                       (LL_BOARD_AHB_DIV == 128U) || (LL_BOARD_AHB_DIV == 256U) || (LL_BOARD_AHB_DIV == 512U),
+                       "LL_BOARD_AHB_DIV not an AHB prescaler");
+LL_BOARD_STATIC_ASSERT((LL_BOARD_APB_DIV == 1U) || (LL_BOARD_APB_DIV == 2U) || (LL_BOARD_APB_DIV == 4U) ||
+                       (LL_BOARD_APB_DIV == 8U) || (LL_BOARD_APB_DIV == 16U),
+                       "LL_BOARD_APB_DIV not an APB prescaler");
+
+/* Exported functions ------------------------------------------------------- */
+/**
+  * @brief  Wait for a ready flag
+  * @param  pReg: register
+  * @param  Mask: flag bits
+  * @param  Value: expected value of the flag bits
+  * @retval SUCCESS, ERROR after LL_BOARD_STARTUP_LOOPS reads
+  */
+__STATIC_INLINE ErrorStatus LL_Board_WaitFlag(__IO uint32_t *pReg, uint32_t Mask, uint32_t Value)
+{
+  uint32_t count = LL_BOARD_STARTUP_LOOPS;
+
+  while ((*pReg & Mask) != Value)
+  {
+    if (--count == 0U)
+    {
+      return ERROR;
+    }
+  }
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Program the clock tree of the LL_BOARD_xxx defines, from the
+  *         reset configuration (HSI, PLL off)
+  * @retval SUCCESS, ERROR if an oscillator or the PLL does not start
+  */
+__STATIC_INLINE ErrorStatus LL_Board_ClockInit(void)
+{
+  /* Wait states before raising the frequency */
+  WRITE_REG(FLASH->ACR, FLASH_ACR_PRFTBE | LL_BOARD_FLASH_LATENCY);
+
+#if LL_BOARD_USES_HSE
+  if (LL_BOARD_HSE_BYPASS != 0U)
+  {
+    SET_BIT(RCC->CR, RCC_CR_HSEBYP);
+  }
+  SET_BIT(RCC->CR, RCC_CR_HSEON);
+  if (LL_Board_WaitFlag(&RCC->CR, RCC_CR_HSERDY, RCC_CR_HSERDY) != SUCCESS)
+  {
+    return ERROR;
+  }
+#endif
+
+#if (LL_BOARD_SYSCLK_SOURCE == LL_BOARD_CLK_PLL)
+  WRITE_REG(RCC->CFGR2, LL_BOARD_CFGR2);
+  WRITE_REG(RCC->CFGR, LL_BOARD_CFGR);
+  SET_BIT(RCC->CR, RCC_CR_PLLON);
+  if (LL_Board_WaitFlag(&RCC->CR, RCC_CR_PLLRDY, RCC_CR_PLLRDY) != SUCCESS)
+  {
+    return ERROR;
+  }
+#endif
+
+  /* Prescalers and switch in one write */
+  WRITE_REG(RCC->CFGR, LL_BOARD_CFGR | LL_BOARD_HPRE | LL_BOARD_PPRE | LL_BOARD_SW);
+  if (LL_Board_WaitFlag(&RCC->CFGR, RCC_CFGR_SWS, LL_BOARD_SW << 2U) != SUCCESS)
+  {
+    return ERROR;
+  }
+
+  SystemCoreClock = LL_BOARD_HCLK_HZ;
+
+  return SUCCESS;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _LL_BOARD_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
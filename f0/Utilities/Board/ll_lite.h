@@ -0,0 +1,171 @@
+/**
+  ******************************************************************************
+  * @file    ll_lite.h
+  * @author  MCD Application Team
+  * @brief   Header for ll_lite module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _LL_LITE_H__
+#define _LL_LITE_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "ll_board.h"
+#include "stm32f0xx_ll_bus.h"
+#include "stm32f0xx_ll_dma.h"
+#include "stm32f0xx_ll_usart.h"
+#include "stm32f0xx_ll_i2c.h"
+#include "stm32f0xx_ll_adc.h"
+
+/* Exported constants --------------------------------------------------------*/
+/* Services built, 1 to enable. Override in main.h. */
+#if !defined(LL_LITE_UART)
+#define LL_LITE_UART             0
+#endif
+#if !defined(LL_LITE_I2C)
+#define LL_LITE_I2C              0
+#endif
+#if !defined(LL_LITE_ADC)
+#define LL_LITE_ADC              0
+#endif
+
+/* Polling loops before a timeout. Override in main.h. */
+#if !defined(LL_LITE_TIMEOUT_LOOPS)
+#define LL_LITE_TIMEOUT_LOOPS    0x10000U
+#endif
+
+/* UART: USART2 of the Nucleo virtual COM port by default, its RX request on
+   DMA1 channel 5. Override the whole group in main.h. */
+#if !defined(LL_LITE_UART_INSTANCE)
+#define LL_LITE_UART_INSTANCE    USART2
+#define LL_LITE_UART_CLK_ENABLE() LL_APB1_GRP1_EnableClock(LL_APB1_GRP1_PERIPH_USART2)
+#define LL_LITE_UART_CLOCK_HZ    LL_BOARD_PCLK_HZ
+#define LL_LITE_UART_DMA_CHANNEL LL_DMA_CHANNEL_5
+#define LL_LITE_UART_DMA_REQUEST LL_DMA_REQUEST_9
+#endif
+#if !defined(LL_LITE_UART_BAUDRATE)
+#define LL_LITE_UART_BAUDRATE    115200U
+#endif
+/* Bytes of the RX ring, a power of 2 */
+#if !defined(LL_LITE_UART_RING_SIZE)
+#define LL_LITE_UART_RING_SIZE   64U
+#endif
+
+/* I2C: I2C1, 100 kHz by default. Override in main.h. */
+#if !defined(LL_LITE_I2C_INSTANCE)
+#define LL_LITE_I2C_INSTANCE     I2C1
+#define LL_LITE_I2C_CLK_ENABLE() LL_APB1_GRP1_EnableClock(LL_APB1_GRP1_PERIPH_I2C1)
+#define LL_LITE_I2C_CLOCK_HZ     HSI_VALUE   /* I2C1SW reset value */
+#endif
+/* TIMINGR, standard mode from a kernel clock multiple of 4 MHz by default */
+#if !defined(LL_LITE_I2C_TIMING)
+#define LL_LITE_I2C_TIMING       ((((LL_LITE_I2C_CLOCK_HZ / 4000000U) - 1U) << I2C_TIMINGR_PRESC_Pos) | 0x00420F13U)
+#define LL_LITE_I2C_TIMING_AUTO  1
+#endif
+
+/* ADC: LL_ADC_CHANNEL_x masks ORed, converted in channel order. Override
+   in main.h. */
+#if !defined(LL_LITE_ADC_CHANNELS)
+#define LL_LITE_ADC_CHANNELS     (LL_ADC_CHANNEL_0 | LL_ADC_CHANNEL_1)
+#endif
+#if !defined(LL_LITE_ADC_CLOCK)
+#define LL_LITE_ADC_CLOCK        LL_ADC_CLOCK_SYNC_PCLK_DIV4   /* 14 MHz at most */
+#endif
+#if !defined(LL_LITE_ADC_SAMPLING)
+#define LL_LITE_ADC_SAMPLING     LL_ADC_SAMPLINGTIME_13CYCLES_5
+#endif
+/* 1: continuous scan transferred by DMA1 channel 1, 0: polled single scans */
+#if !defined(LL_LITE_ADC_DMA)
+#define LL_LITE_ADC_DMA          1
+#endif
+#if !defined(LL_LITE_ADC_DMA_CHANNEL)
+#define LL_LITE_ADC_DMA_CHANNEL  LL_DMA_CHANNEL_1
+#define LL_LITE_ADC_DMA_REQUEST  LL_DMA_REQUEST_0
+#endif
+
+/* Exported macro ------------------------------------------------------------*/
+/* Number of bits set in the low 20 bits, at compile time */
+#define LL_LITE_BITS4(__X__)     (((__X__) & 1U) + (((__X__) >> 1) & 1U) + (((__X__) >> 2) & 1U) + (((__X__) >> 3) & 1U))
+#define LL_LITE_BITS(__X__)      (LL_LITE_BITS4(__X__) + LL_LITE_BITS4((__X__) >> 4) + LL_LITE_BITS4((__X__) >> 8) + \
+                                  LL_LITE_BITS4((__X__) >> 12) + LL_LITE_BITS4((__X__) >> 16))
+
+/* Number of channels of a scan */
+#define LL_LITE_ADC_CHANNEL_NBR  LL_LITE_BITS(LL_LITE_ADC_CHANNELS & ADC_CHSELR_CHSEL)
+
+/* Configuration checks */
+#if LL_LITE_UART
+LL_BOARD_STATIC_ASSERT((LL_LITE_UART_RING_SIZE & (LL_LITE_UART_RING_SIZE - 1U)) == 0U,
+                       "LL_LITE_UART_RING_SIZE not a power of 2");
+LL_BOARD_STATIC_ASSERT((LL_LITE_UART_CLOCK_HZ / LL_LITE_UART_BAUDRATE) >= 16U, "LL_LITE_UART_BAUDRATE too high");
+#endif
+#if LL_LITE_I2C && defined(LL_LITE_I2C_TIMING_AUTO)
+LL_BOARD_STATIC_ASSERT(((LL_LITE_I2C_CLOCK_HZ % 4000000U) == 0U) && (LL_LITE_I2C_CLOCK_HZ <= 64000000U),
+                       "I2C kernel clock not a multiple of 4 MHz: define LL_LITE_I2C_TIMING");
+#endif
+#if LL_LITE_ADC
+LL_BOARD_STATIC_ASSERT(LL_LITE_ADC_CHANNEL_NBR != 0U, "no channel in LL_LITE_ADC_CHANNELS");
+#endif
+
+/* Exported functions ------------------------------------------------------- */
+#if LL_LITE_UART
+void        LL_Lite_UART_Init(void);
+uint32_t    LL_Lite_UART_Available(void);
+uint32_t    LL_Lite_UART_Read(uint8_t *pData, uint32_t Size);
+void        LL_Lite_UART_Write(const uint8_t *pData, uint32_t Size);
+#endif
+
+#if LL_LITE_I2C
+void        LL_Lite_I2C_Init(void);
+ErrorStatus LL_Lite_I2C_WriteReg(uint8_t Address, uint8_t Reg, const uint8_t *pData, uint32_t Size);
+ErrorStatus LL_Lite_I2C_ReadReg(uint8_t Address, uint8_t Reg, uint8_t *pData, uint32_t Size);
+#endif
+
+#if LL_LITE_ADC
+ErrorStatus LL_Lite_ADC_Init(void);
+#if LL_LITE_ADC_DMA
+void        LL_Lite_ADC_Start(void);
+uint16_t    LL_Lite_ADC_Get(uint32_t Rank);
+#else
+ErrorStatus LL_Lite_ADC_Scan(uint16_t *pValues);
+#endif
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _LL_LITE_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
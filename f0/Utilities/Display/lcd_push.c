@@ -0,0 +1,774 @@
+/**
+  ******************************************************************************
+  * @file    lcd_push.c
+  * @author  MCD Application Team
+  * @brief   DMA push of RAM pixels to the SPI and FMC LCD controllers
+  *          (ili9341, st7735, st7789h2) through a window set once
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- initialize the display with its BSP (BSP_LCD_Init()), then describe the
+   controller and the bus in a LCD_Push_BusTypeDef given to LCD_Push_Init():
+   - SetWriteWindow: ST7789H2_SetWriteWindow, st7735_SetWriteWindow or
+     ili9341_SetWriteWindow. It sets the column and row range once and
+     starts the memory write, all the pixels of the window then follow
+     with no command in between.
+   - SPI bus (st7735, ili9341): the SPI handle of the display, with a Tx
+     DMA in half-words, and the chip select and data/command pins. The
+     SPI is switched to 16-bit frames for the pixels, so RGB565 words are
+     sent MSB first without byte swapping, and back to its data size when
+     the window is complete, for the BSP commands. Call
+     LCD_Push_SPI_TxCpltCallback() and LCD_Push_SPI_ErrorCallback() from
+     HAL_SPI_TxCpltCallback() and HAL_SPI_ErrorCallback().
+   - FMC bus (st7789h2 on the STM32F412G/F413H/F723E/L496G Discovery): a
+     memory to memory DMA (DMA2 on STM32F2/F4/F7) in half-words, source
+     incremented, destination fixed, and the address of the data register
+     of the controller (the RAM field of the BSP LCD_CONTROLLER_TypeDef).
+   Call HAL_DMA_IRQHandler() from the DMA interrupt handler.
+
+2- a rectangle of a RAM frame buffer goes with LCD_Push_Rect(): one window,
+   then one DMA transfer for the whole rectangle when its lines are
+   contiguous (Pitch = Width) or one per line chained from the DMA
+   interrupt. The call returns as soon as the first transfer is started,
+   LCD_Push_XferCpltCallback() is called at the end and LCD_Push_Wait()
+   waits for it.
+
+3- with a full frame buffer, queue what changed with LCD_Push_AddRect() and
+   push it with LCD_Push_Frame(): each rectangle gets its own window, the
+   rest of the panel is not sent. The windows after the first one are set
+   from the DMA interrupt through the BSP, which must not be used from a
+   higher priority interrupt meanwhile. With the DMA2D compositor
+   (STM32F7/H7), give it the rectangles it has just drawn from
+   DMA2D_Comp_FlushCpltCallback():
+     n = DMA2D_Comp_GetDrawnRects(rects, LCD_PUSH_MAX_RECTS);
+     for(i = 0; i < n; i++)
+       LCD_Push_AddRect(rects[i].X, rects[i].Y, rects[i].Width, rects[i].Height);
+     LCD_Push_Frame(frame, width);
+   Rectangles added during a push are kept for the next one.
+
+4- without a frame buffer, render in strips: LCD_Push_Begin() opens the
+   window, then each LCD_Push_Strip() waits for the previous strip to be
+   sent, starts the DMA of the new one and returns. With two strip
+   buffers, the next strip is rendered while the last one is on the bus:
+     LCD_Push_Begin(x, y, w, h);
+     for(line = 0; line < h; line += lines, buf ^= 1)
+     {
+       Render(strip[buf], line, lines);
+       LCD_Push_Strip(strip[buf], w * lines);
+     }
+   The window closes by itself after its last pixel.
+
+5- on STM32F7/H7 the pixels are cleaned from the D-cache before the DMA
+   reads them; the buffers should not be written before the end of their
+   transfer.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "lcd_push.h"
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  uint16_t X0;  /* First column              */
+  uint16_t Y0;  /* First line                */
+  uint16_t X1;  /* Column after the last one */
+  uint16_t Y1;  /* Line after the last one   */
+} LCD_Push_BoxTypeDef;
+
+typedef enum
+{
+  LCD_PUSH_IDLE   = 0U,
+  LCD_PUSH_RECT   = 1U,  /* LCD_Push_Rect()  */
+  LCD_PUSH_FRAME  = 2U,  /* LCD_Push_Frame() */
+  LCD_PUSH_STRIPS = 3U   /* LCD_Push_Begin() */
+} LCD_Push_ModeTypeDef;
+
+/* Private define ------------------------------------------------------------*/
+/* Longest DMA transfer, in pixels */
+#define LCD_PUSH_MAX_XFER         65535U
+
+/* Private macro -------------------------------------------------------------*/
+#define LCD_PUSH_AREA(__BOX__) \
+  ((uint32_t)((__BOX__)->X1 - (__BOX__)->X0) * (uint32_t)((__BOX__)->Y1 - (__BOX__)->Y0))
+
+/* Private variables ---------------------------------------------------------*/
+static const LCD_Push_BusTypeDef *PushBus = NULL;
+
+static LCD_Push_BoxTypeDef   PushQueue[LCD_PUSH_MAX_RECTS];  /* Next frame       */
+static uint32_t              PushQueueCount;
+static LCD_Push_BoxTypeDef   PushRects[LCD_PUSH_MAX_RECTS];  /* Frame being sent */
+static uint32_t              PushRectCount;
+static uint32_t              PushRect;        /* Next rectangle of the frame    */
+static const uint16_t        *PushFrame;
+static uint32_t              PushPitch;
+
+static LCD_Push_ModeTypeDef  PushMode;
+static const uint16_t        *PushSrc;        /* Next pixel to send              */
+static uint32_t              PushRunLength;   /* Contiguous pixels per run       */
+static uint32_t              PushRunSkip;     /* Pixels between two runs         */
+static uint32_t              PushRuns;        /* Runs after the current one      */
+static uint32_t              PushRunLeft;     /* Pixels left in the current run  */
+static uint32_t              PushChunk;       /* Pixels of the current transfer  */
+static uint32_t              PushWindowLeft;  /* Pixels the open window expects  */
+#if defined(HAL_SPI_MODULE_ENABLED)
+static uint32_t              PushDataSize;    /* SPI data size of the BSP        */
+#endif
+static __IO uint32_t         PushBusy;
+static __IO HAL_StatusTypeDef PushStatus;
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t LCD_Push_Clip(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height, LCD_Push_BoxTypeDef *pBox);
+static void     LCD_Push_Open(const LCD_Push_BoxTypeDef *pBox, const uint16_t *pSrc, uint32_t Pitch);
+static void     LCD_Push_Close(void);
+static void     LCD_Push_SetRuns(const uint16_t *pSrc, uint32_t Width, uint32_t Height, uint32_t Pitch);
+static void     LCD_Push_StartRect(void);
+static HAL_StatusTypeDef LCD_Push_Next(void);
+static void     LCD_Push_XferDone(void);
+static void     LCD_Push_Finish(HAL_StatusTypeDef Status);
+static void     LCD_Push_DmaCplt(DMA_HandleTypeDef *hdma);
+static void     LCD_Push_DmaError(DMA_HandleTypeDef *hdma);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Initialize the push on a display
+  * @param  pBus: controller and bus, kept by reference
+  * @retval HAL status
+  */
+HAL_StatusTypeDef LCD_Push_Init(const LCD_Push_BusTypeDef *pBus)
+{
+  uint32_t valid = 0U;
+
+  if((pBus == NULL) || (pBus->SetWriteWindow == NULL) || (pBus->Width == 0U) || (pBus->Height == 0U))
+  {
+    return HAL_ERROR;
+  }
+  if(PushBusy != 0U)
+  {
+    return HAL_BUSY;
+  }
+
+#if defined(HAL_SPI_MODULE_ENABLED)
+  if(pBus->hspi != NULL)
+  {
+    valid = ((pBus->hspi->hdmatx != NULL) &&
+             (pBus->hspi->hdmatx->Init.MemDataAlignment == DMA_MDATAALIGN_HALFWORD) &&
+             (pBus->pCsPort != NULL) && (pBus->pDcPort != NULL)) ? 1U : 0U;
+  }
+  else
+#endif
+  if((pBus->hdma != NULL) && (pBus->hdma->Init.Direction == DMA_MEMORY_TO_MEMORY) &&
+     (pBus->hdma->Init.MemDataAlignment == DMA_MDATAALIGN_HALFWORD) && (pBus->RamAddress != 0U))
+  {
+    pBus->hdma->XferCpltCallback  = LCD_Push_DmaCplt;
+    pBus->hdma->XferErrorCallback = LCD_Push_DmaError;
+    valid = 1U;
+  }
+
+  if(valid == 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  PushBus        = pBus;
+  PushQueueCount = 0U;
+  PushRectCount  = 0U;
+  PushMode       = LCD_PUSH_IDLE;
+  PushWindowLeft = 0U;
+  PushStatus     = HAL_OK;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Send a rectangle of RAM pixels to the display
+  * @note   Returns as soon as the first transfer is started.
+  * @param  Xpos: left column on the display
+  * @param  Ypos: top line on the display
+  * @param  Width: width, in pixels
+  * @param  Height: height, in pixels
+  * @param  pPixels: RGB565 pixel (Xpos, Ypos)
+  * @param  Pitch: distance between two lines of pPixels, in pixels
+  * @retval HAL status
+  */
+HAL_StatusTypeDef LCD_Push_Rect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height, const uint16_t *pPixels, uint32_t Pitch)
+{
+  LCD_Push_BoxTypeDef box;
+
+  if((PushBus == NULL) || (pPixels == NULL) || (Pitch < Width))
+  {
+    return HAL_ERROR;
+  }
+  if((PushBusy != 0U) || (PushMode != LCD_PUSH_IDLE))
+  {
+    return HAL_BUSY;
+  }
+  if(LCD_Push_Clip(Xpos, Ypos, Width, Height, &box) == 0U)
+  {
+    return HAL_OK;
+  }
+
+  PushMode   = LCD_PUSH_RECT;
+  PushStatus = HAL_OK;
+  PushBusy   = 1U;
+  LCD_Push_Open(&box, &pPixels[((uint32_t)(box.Y0 - Ypos) * Pitch) + (uint32_t)(box.X0 - Xpos)], Pitch);
+
+  return LCD_Push_Next();
+}
+
+/**
+  * @brief  Queue an area of the frame buffer for the next LCD_Push_Frame()
+  * @note   Rectangles touching or overlapping are merged when it costs no
+  *         more pixels, the closest ones when the queue is full.
+  * @param  Xpos: left column
+  * @param  Ypos: top line
+  * @param  Width: width, in pixels
+  * @param  Height: height, in pixels
+  * @retval None
+  */
+void LCD_Push_AddRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+  LCD_Push_BoxTypeDef box;
+  LCD_Push_BoxTypeDef join;
+  uint32_t merged = 1U;
+  uint32_t best;
+  uint32_t cost;
+  uint32_t least;
+  uint32_t i;
+
+  if((PushBus == NULL) || (LCD_Push_Clip(Xpos, Ypos, Width, Height, &box) == 0U))
+  {
+    return;
+  }
+
+  /* A union may reach other rectangles, merge until stable */
+  while(merged != 0U)
+  {
+    merged = 0U;
+    for(i = 0U; (i < PushQueueCount) && (merged == 0U); i++)
+    {
+      if((box.X0 <= PushQueue[i].X1) && (PushQueue[i].X0 <= box.X1) &&
+         (box.Y0 <= PushQueue[i].Y1) && (PushQueue[i].Y0 <= box.Y1))
+      {
+        join.X0 = (box.X0 < PushQueue[i].X0) ? box.X0 : PushQueue[i].X0;
+        join.Y0 = (box.Y0 < PushQueue[i].Y0) ? box.Y0 : PushQueue[i].Y0;
+        join.X1 = (box.X1 > PushQueue[i].X1) ? box.X1 : PushQueue[i].X1;
+        join.Y1 = (box.Y1 > PushQueue[i].Y1) ? box.Y1 : PushQueue[i].Y1;
+        if(LCD_PUSH_AREA(&join) <= (LCD_PUSH_AREA(&box) + LCD_PUSH_AREA(&PushQueue[i])))
+        {
+          box = join;
+          PushQueueCount--;
+          PushQueue[i] = PushQueue[PushQueueCount];
+          merged = 1U;
+        }
+      }
+    }
+  }
+
+  if(PushQueueCount >= LCD_PUSH_MAX_RECTS)
+  {
+    /* Full: grow the rectangle that needs the fewest extra pixels */
+    best  = 0U;
+    least = 0xFFFFFFFFU;
+    for(i = 0U; i < PushQueueCount; i++)
+    {
+      join.X0 = (box.X0 < PushQueue[i].X0) ? box.X0 : PushQueue[i].X0;
+      join.Y0 = (box.Y0 < PushQueue[i].Y0) ? box.Y0 : PushQueue[i].Y0;
+      join.X1 = (box.X1 > PushQueue[i].X1) ? box.X1 : PushQueue[i].X1;
+      join.Y1 = (box.Y1 > PushQueue[i].Y1) ? box.Y1 : PushQueue[i].Y1;
+      cost = LCD_PUSH_AREA(&join) - LCD_PUSH_AREA(&PushQueue[i]);
+      if(cost < least)
+      {
+        least = cost;
+        best  = i;
+      }
+    }
+    PushQueue[best].X0 = (box.X0 < PushQueue[best].X0) ? box.X0 : PushQueue[best].X0;
+    PushQueue[best].Y0 = (box.Y0 < PushQueue[best].Y0) ? box.Y0 : PushQueue[best].Y0;
+    PushQueue[best].X1 = (box.X1 > PushQueue[best].X1) ? box.X1 : PushQueue[best].X1;
+    PushQueue[best].Y1 = (box.Y1 > PushQueue[best].Y1) ? box.Y1 : PushQueue[best].Y1;
+  }
+  else
+  {
+    PushQueue[PushQueueCount] = box;
+    PushQueueCount++;
+  }
+}
+
+/**
+  * @brief  Send the queued areas of a frame buffer to the display
+  * @note   Returns as soon as the first transfer is started. The queue is
+  *         emptied, rectangles added from now on go to the next frame.
+  * @param  pFrame: RGB565 pixel (0, 0) of the frame buffer
+  * @param  Pitch: distance between two lines, in pixels
+  * @retval HAL status
+  */
+HAL_StatusTypeDef LCD_Push_Frame(const uint16_t *pFrame, uint32_t Pitch)
+{
+  LCD_Push_BoxTypeDef box;
+  uint32_t i, j;
+
+  if((PushBus == NULL) || (pFrame == NULL) || (Pitch < PushBus->Width))
+  {
+    return HAL_ERROR;
+  }
+  if((PushBusy != 0U) || (PushMode != LCD_PUSH_IDLE))
+  {
+    return HAL_BUSY;
+  }
+  if(PushQueueCount == 0U)
+  {
+    return HAL_OK;
+  }
+
+  /* Top to bottom, as the panel refreshes */
+  for(i = 0U; i < PushQueueCount; i++)
+  {
+    box = PushQueue[i];
+    for(j = i; (j > 0U) && (PushRects[j - 1U].Y0 > box.Y0); j--)
+    {
+      PushRects[j] = PushRects[j - 1U];
+    }
+    PushRects[j] = box;
+  }
+  PushRectCount  = PushQueueCount;
+  PushQueueCount = 0U;
+  PushRect       = 0U;
+  PushFrame      = pFrame;
+  PushPitch      = Pitch;
+
+  PushMode   = LCD_PUSH_FRAME;
+  PushStatus = HAL_OK;
+  PushBusy   = 1U;
+  LCD_Push_StartRect();
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Open a window to be filled by LCD_Push_Strip()
+  * @param  Xpos: left column
+  * @param  Ypos: top line
+  * @param  Width: width, in pixels
+  * @param  Height: height, in pixels
+  * @retval HAL status, HAL_ERROR when the window is not inside the display
+  */
+HAL_StatusTypeDef LCD_Push_Begin(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+  LCD_Push_BoxTypeDef box;
+
+  if((PushBus == NULL) || (Width == 0U) || (Height == 0U) ||
+     (((uint32_t)Xpos + Width) > PushBus->Width) || (((uint32_t)Ypos + Height) > PushBus->Height))
+  {
+    return HAL_ERROR;
+  }
+  if((PushBusy != 0U) || (PushMode != LCD_PUSH_IDLE))
+  {
+    return HAL_BUSY;
+  }
+
+  box.X0 = Xpos;
+  box.Y0 = Ypos;
+  box.X1 = Xpos + Width;
+  box.Y1 = Ypos + Height;
+
+  PushMode   = LCD_PUSH_STRIPS;
+  PushStatus = HAL_OK;
+  LCD_Push_Open(&box, NULL, Width);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Send the next pixels of the window opened by LCD_Push_Begin()
+  * @note   Waits for the previous strip, starts this one and returns: the
+  *         other strip buffer can be rendered meanwhile.
+  * @param  pPixels: RGB565 pixels, row by row
+  * @param  Count: number of pixels, at most what the window still expects
+  * @retval HAL status
+  */
+HAL_StatusTypeDef LCD_Push_Strip(const uint16_t *pPixels, uint32_t Count)
+{
+  HAL_StatusTypeDef status;
+
+  if((pPixels == NULL) || (Count == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  status = LCD_Push_Wait(LCD_PUSH_TIMEOUT);
+  if(status != HAL_OK)
+  {
+    return status;
+  }
+  if((PushMode != LCD_PUSH_STRIPS) || (Count > PushWindowLeft))
+  {
+    return HAL_ERROR;
+  }
+
+  PushBusy = 1U;
+  LCD_Push_SetRuns(pPixels, Count, 1U, Count);
+
+  return LCD_Push_Next();
+}
+
+/**
+  * @brief  Tell whether a transfer is in progress
+  * @param  None
+  * @retval 1 while pixels are being sent, 0 otherwise
+  */
+uint32_t LCD_Push_IsBusy(void)
+{
+  return PushBusy;
+}
+
+/**
+  * @brief  Wait for the end of the transfer in progress
+  * @param  Timeout: maximum time to wait, in ms
+  * @retval HAL status of the last push, or HAL_TIMEOUT
+  */
+HAL_StatusTypeDef LCD_Push_Wait(uint32_t Timeout)
+{
+  uint32_t tickstart = HAL_GetTick();
+
+  while(PushBusy != 0U)
+  {
+    if((HAL_GetTick() - tickstart) > Timeout)
+    {
+      return HAL_TIMEOUT;
+    }
+  }
+  return PushStatus;
+}
+
+#if defined(HAL_SPI_MODULE_ENABLED)
+/**
+  * @brief  SPI transfer completed, call from HAL_SPI_TxCpltCallback()
+  * @param  hspi: SPI handle
+  * @retval None
+  */
+void LCD_Push_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+  if((PushBus != NULL) && (hspi == PushBus->hspi) && (PushBusy != 0U))
+  {
+    LCD_Push_XferDone();
+  }
+}
+
+/**
+  * @brief  SPI error, call from HAL_SPI_ErrorCallback()
+  * @param  hspi: SPI handle
+  * @retval None
+  */
+void LCD_Push_SPI_ErrorCallback(SPI_HandleTypeDef *hspi)
+{
+  if((PushBus != NULL) && (hspi == PushBus->hspi) && (PushBusy != 0U))
+  {
+    LCD_Push_Finish(HAL_ERROR);
+  }
+}
+#endif
+
+/**
+  * @brief  Push complete callback, called from the DMA or SPI interrupt
+  *         when a rectangle, a frame or a strip window is sent
+  * @param  None
+  * @retval None
+  */
+__weak void LCD_Push_XferCpltCallback(void)
+{
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the LCD_Push_XferCpltCallback could be implemented in the user file
+   */
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Clip a rectangle to the display
+  * @param  Xpos: left column
+  * @param  Ypos: top line
+  * @param  Width: width, in pixels
+  * @param  Height: height, in pixels
+  * @param  pBox: clipped rectangle
+  * @retval 1 when something is left, 0 otherwise
+  */
+static uint32_t LCD_Push_Clip(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height, LCD_Push_BoxTypeDef *pBox)
+{
+  uint32_t x1 = (uint32_t)Xpos + Width;
+  uint32_t y1 = (uint32_t)Ypos + Height;
+
+  if((Xpos >= PushBus->Width) || (Ypos >= PushBus->Height) || (Width == 0U) || (Height == 0U))
+  {
+    return 0U;
+  }
+
+  pBox->X0 = Xpos;
+  pBox->Y0 = Ypos;
+  pBox->X1 = (uint16_t)((x1 > PushBus->Width) ? PushBus->Width : x1);
+  pBox->Y1 = (uint16_t)((y1 > PushBus->Height) ? PushBus->Height : y1);
+
+  return 1U;
+}
+
+/**
+  * @brief  Set the window of the controller and select it for the pixels
+  * @param  pBox: window
+  * @param  pSrc: first pixel, NULL for the strips
+  * @param  Pitch: distance between two source lines, in pixels
+  * @retval None
+  */
+static void LCD_Push_Open(const LCD_Push_BoxTypeDef *pBox, const uint16_t *pSrc, uint32_t Pitch)
+{
+  uint32_t width  = (uint32_t)pBox->X1 - pBox->X0;
+  uint32_t height = (uint32_t)pBox->Y1 - pBox->Y0;
+
+  /* Window and memory write command, by the BSP */
+  PushBus->SetWriteWindow(pBox->X0, pBox->Y0, (uint16_t)width, (uint16_t)height);
+  PushWindowLeft = width * height;
+
+#if defined(HAL_SPI_MODULE_ENABLED)
+  if(PushBus->hspi != NULL)
+  {
+    /* 16-bit frames: RGB565 words go MSB first as the controller expects */
+    PushDataSize = PushBus->hspi->Init.DataSize;
+    if(PushDataSize != SPI_DATASIZE_16BIT)
+    {
+      PushBus->hspi->Init.DataSize = SPI_DATASIZE_16BIT;
+      (void)HAL_SPI_Init(PushBus->hspi);
+    }
+    HAL_GPIO_WritePin(PushBus->pDcPort, PushBus->DcPin, GPIO_PIN_SET);
+    HAL_GPIO_WritePin(PushBus->pCsPort, PushBus->CsPin, GPIO_PIN_RESET);
+  }
+#endif
+
+  if(pSrc != NULL)
+  {
+    LCD_Push_SetRuns(pSrc, width, height, Pitch);
+  }
+}
+
+/**
+  * @brief  Deselect the controller once its window is complete
+  * @param  None
+  * @retval None
+  */
+static void LCD_Push_Close(void)
+{
+  PushWindowLeft = 0U;
+
+#if defined(HAL_SPI_MODULE_ENABLED)
+  if(PushBus->hspi != NULL)
+  {
+    HAL_GPIO_WritePin(PushBus->pCsPort, PushBus->CsPin, GPIO_PIN_SET);
+    if(PushDataSize != SPI_DATASIZE_16BIT)
+    {
+      PushBus->hspi->Init.DataSize = PushDataSize;
+      (void)HAL_SPI_Init(PushBus->hspi);
+    }
+  }
+#endif
+}
+
+/**
+  * @brief  Describe the source of the next pixels
+  * @param  pSrc: first pixel
+  * @param  Width: pixels per line
+  * @param  Height: number of lines
+  * @param  Pitch: distance between two lines, in pixels
+  * @retval None
+  */
+static void LCD_Push_SetRuns(const uint16_t *pSrc, uint32_t Width, uint32_t Height, uint32_t Pitch)
+{
+#if (__DCACHE_PRESENT == 1)
+  uint32_t start;
+  uint32_t end;
+#endif
+
+  PushSrc = pSrc;
+  if(Pitch == Width)
+  {
+    PushRunLength = Width * Height;
+    PushRuns      = 0U;
+    PushRunSkip   = 0U;
+  }
+  else
+  {
+    PushRunLength = Width;
+    PushRuns      = Height - 1U;
+    PushRunSkip   = Pitch - Width;
+  }
+  PushRunLeft = PushRunLength;
+
+#if (__DCACHE_PRESENT == 1)
+  /* Write the pixels to memory before the DMA reads them */
+  if((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    start = (uint32_t)pSrc & ~31U;
+    end   = (uint32_t)&pSrc[((Height - 1U) * Pitch) + Width];
+    SCB_CleanDCache_by_Addr((uint32_t *)start, (int32_t)(end - start));
+  }
+#endif
+}
+
+/**
+  * @brief  Start the next rectangle of the frame
+  * @param  None
+  * @retval None
+  */
+static void LCD_Push_StartRect(void)
+{
+  const LCD_Push_BoxTypeDef *pBox = &PushRects[PushRect];
+
+  PushRect++;
+  LCD_Push_Open(pBox, &PushFrame[((uint32_t)pBox->Y0 * PushPitch) + pBox->X0], PushPitch);
+  (void)LCD_Push_Next();
+}
+
+/**
+  * @brief  Start the next transfer, or end the current source
+  * @param  None
+  * @retval HAL status of the start
+  */
+static HAL_StatusTypeDef LCD_Push_Next(void)
+{
+  HAL_StatusTypeDef status;
+
+  if(PushRunLeft == 0U)
+  {
+    if(PushRuns == 0U)
+    {
+      /* Source sent */
+      if(PushWindowLeft == 0U)
+      {
+        LCD_Push_Close();
+      }
+      if((PushMode == LCD_PUSH_FRAME) && (PushRect < PushRectCount))
+      {
+        LCD_Push_StartRect();
+      }
+      else if((PushMode == LCD_PUSH_STRIPS) && (PushWindowLeft != 0U))
+      {
+        /* The window waits for the next strip */
+        PushBusy = 0U;
+      }
+      else
+      {
+        LCD_Push_Finish(HAL_OK);
+      }
+      return HAL_OK;
+    }
+    PushRuns--;
+    PushSrc    += PushRunSkip;
+    PushRunLeft = PushRunLength;
+  }
+
+  PushChunk = (PushRunLeft > LCD_PUSH_MAX_XFER) ? LCD_PUSH_MAX_XFER : PushRunLeft;
+
+#if defined(HAL_SPI_MODULE_ENABLED)
+  if(PushBus->hspi != NULL)
+  {
+    status = HAL_SPI_Transmit_DMA(PushBus->hspi, (uint8_t *)PushSrc, (uint16_t)PushChunk);
+  }
+  else
+#endif
+  {
+    status = HAL_DMA_Start_IT(PushBus->hdma, (uint32_t)PushSrc, PushBus->RamAddress, PushChunk);
+  }
+
+  if(status != HAL_OK)
+  {
+    LCD_Push_Finish(status);
+  }
+  return status;
+}
+
+/**
+  * @brief  Account the transfer just completed and start the next one
+  * @param  None
+  * @retval None
+  */
+static void LCD_Push_XferDone(void)
+{
+  PushSrc        += PushChunk;
+  PushRunLeft    -= PushChunk;
+  PushWindowLeft -= PushChunk;
+  (void)LCD_Push_Next();
+}
+
+/**
+  * @brief  End the push
+  * @param  Status: result
+  * @retval None
+  */
+static void LCD_Push_Finish(HAL_StatusTypeDef Status)
+{
+  if(PushWindowLeft != 0U)
+  {
+    /* Error: the controller gets a new window from the next push */
+    LCD_Push_Close();
+  }
+
+  PushMode   = LCD_PUSH_IDLE;
+  PushStatus = Status;
+  PushBusy   = 0U;
+  LCD_Push_XferCpltCallback();
+}
+
+/**
+  * @brief  Memory to memory DMA transfer complete
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void LCD_Push_DmaCplt(DMA_HandleTypeDef *hdma)
+{
+  UNUSED(hdma);
+
+  LCD_Push_XferDone();
+}
+
+/**
+  * @brief  Memory to memory DMA error
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void LCD_Push_DmaError(DMA_HandleTypeDef *hdma)
+{
+  UNUSED(hdma);
+
+  LCD_Push_Finish(HAL_ERROR);
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -69,6 +69,12 @@
 #if !defined (VERIFY_WRITTENDATA)  
 /* #define VERIFY_WRITTENDATA */
 #endif /* VERIFY_WRITTENDATA */
+
+/* Register writes gathered before being sent to the codec in one batch */
+#define CS43L22_BATCH_SIZE        16
+
+/* Registers held in the shadow cache: 0x00 to CS43L22_REG_CHARGE_PUMP_FREQ */
+#define CS43L22_SHADOW_COUNT      (CS43L22_REG_CHARGE_PUMP_FREQ + 1)
 /**
   * @}
   */ 
@@ -76,7 +82,7 @@
 /** @defgroup CS43L22_Private_Macros
   * @{
   */
-
+#define COUNTOF(__SEQ__)          (sizeof(__SEQ__) / sizeof((__SEQ__)[0]))
 /**
   * @}
   */ 
@@ -108,6 +114,61 @@ static uint8_t Is_cs43l22_Stop = 1;
 
 volatile uint8_t OutputDev = 0;
 
+/* Additional configuration for the CODEC. These configurations are done to reduce
+the time needed for the Codec to power off. If these configurations are removed, 
+then a long delay should be added between powering off the Codec and switching 
+off the I2S peripheral MCLK clock (which is the operating clock for Codec).
+If this delay is not inserted, then the codec will not shut down properly and
+it results in high noise after shut down. */
+static const AUDIO_IO_RegTypeDef PowerOffConfigSeq[] =
+{
+  /* Disable the analog soft ramp */
+  {CS43L22_REG_ANALOG_ZC_SR_SETT, 0x00},
+  /* Disable the digital soft ramp */
+  {CS43L22_REG_MISC_CTL,          0x04},
+  /* Disable the limiter attack level */
+  {CS43L22_REG_LIMIT_CTL1,        0x00},
+  /* Adjust Bass and Treble levels */
+  {CS43L22_REG_TONE_CTL,          0x0F},
+  /* Adjust PCM volume level */
+  {CS43L22_REG_PCMA_VOL,          0x0A},
+  {CS43L22_REG_PCMB_VOL,          0x0A},
+};
+
+/* Set the Speaker Mono mode and the Speaker attenuation level */
+static const AUDIO_IO_RegTypeDef SpeakerSeq[] =
+{
+  {CS43L22_REG_PLAYBACK_CTL2,     0x06},
+  {CS43L22_REG_SPEAKER_A_VOL,     0x00},
+  {CS43L22_REG_SPEAKER_B_VOL,     0x00},
+};
+
+/* Power down the outputs and mute the headphone channels */
+static const AUDIO_IO_RegTypeDef MuteSeq[] =
+{
+  {CS43L22_REG_POWER_CTL2,        0xFF},
+  {CS43L22_REG_HEADPHONE_A_VOL,   0x01},
+  {CS43L22_REG_HEADPHONE_B_VOL,   0x01},
+};
+
+/* Disable the digital soft ramp, power down the DAC and the speaker (PMDAC and PMSPK bits) */
+static const AUDIO_IO_RegTypeDef StopSeq[] =
+{
+  {CS43L22_REG_MISC_CTL,          0x04},
+  {CS43L22_REG_POWER_CTL1,        0x9F},
+};
+
+/* Last value written to each register, valid when its bit is set */
+static uint8_t  ShadowValue[CS43L22_SHADOW_COUNT];
+static uint32_t ShadowValid[(CS43L22_SHADOW_COUNT + 31) / 32];
+
+/* Register writes not sent yet. Two buffers are used in turn, so that one can be
+   filled while AUDIO_IO_WriteBatch() still sends the other one */
+static AUDIO_IO_RegTypeDef Batch[2][CS43L22_BATCH_SIZE];
+static uint16_t BatchCount = 0;
+static uint8_t  BatchIndex = 0;
+static uint8_t  BatchAddr = 0;
+
 /**
   * @}
   */ 
@@ -115,7 +176,10 @@ volatile uint8_t OutputDev = 0;
 /** @defgroup CS43L22_Function_Prototypes
   * @{
   */
-static uint8_t CODEC_IO_Write(uint8_t Addr, uint8_t Reg, uint8_t Value);
+static uint8_t  CODEC_IO_Write(uint8_t Addr, uint8_t Reg, uint8_t Value);
+static uint32_t CODEC_IO_WriteSeq(uint8_t Addr, const AUDIO_IO_RegTypeDef *pSeq, uint32_t Count);
+static uint32_t CODEC_IO_Flush(void);
+static void     CODEC_IO_ShadowReset(void);
 /**
   * @}
   */ 
@@ -138,7 +202,10 @@ uint32_t cs43l22_Init(uint16_t DeviceAddr, uint16_t OutputDevice, uint8_t Volume
   
   /* Initialize the Control interface of the Audio Codec */
   AUDIO_IO_Init();     
-    
+
+  /* The codec registers content is unknown: write them all */
+  CODEC_IO_ShadowReset();
+
   /* Keep Codec powered OFF */
   counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_POWER_CTL1, 0x01);  
   
@@ -180,32 +247,15 @@ uint32_t cs43l22_Init(uint16_t DeviceAddr, uint16_t OutputDevice, uint8_t Volume
   /* If the Speaker is enabled, set the Mono mode and volume attenuation level */
   if(OutputDevice != OUTPUT_DEVICE_HEADPHONE)
   {
-    /* Set the Speaker Mono mode */  
-    counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_PLAYBACK_CTL2, 0x06);
-    
-    /* Set the Speaker attenuation level */  
-    counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_SPEAKER_A_VOL, 0x00);
-    counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_SPEAKER_B_VOL, 0x00);
+    /* Set the Speaker Mono mode and attenuation level */  
+    counter += CODEC_IO_WriteSeq(DeviceAddr, SpeakerSeq, COUNTOF(SpeakerSeq));
   }
   
-  /* Additional configuration for the CODEC. These configurations are done to reduce
-  the time needed for the Codec to power off. If these configurations are removed, 
-  then a long delay should be added between powering off the Codec and switching 
-  off the I2S peripheral MCLK clock (which is the operating clock for Codec).
-  If this delay is not inserted, then the codec will not shut down properly and
-  it results in high noise after shut down. */
-  
-  /* Disable the analog soft ramp */
-  counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_ANALOG_ZC_SR_SETT, 0x00);
-  /* Disable the digital soft ramp */
-  counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_MISC_CTL, 0x04);
-  /* Disable the limiter attack level */
-  counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_LIMIT_CTL1, 0x00);
-  /* Adjust Bass and Treble levels */
-  counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_TONE_CTL, 0x0F);
-  /* Adjust PCM volume level */
-  counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_PCMA_VOL, 0x0A);
-  counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_PCMB_VOL, 0x0A);
+  /* Soft ramps, limiter, tone and PCM volume settings to speed up the power off */
+  counter += CODEC_IO_WriteSeq(DeviceAddr, PowerOffConfigSeq, COUNTOF(PowerOffConfigSeq));
+
+  /* Send the writes left */
+  counter += CODEC_IO_Flush();
   
   /* Return communication control value */
   return counter;  
@@ -259,6 +309,7 @@ uint32_t cs43l22_Play(uint16_t DeviceAddr, uint16_t* pBuffer, uint16_t Size)
     
     /* Power on the Codec */
     counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_POWER_CTL1, 0x9E);  
+    counter += CODEC_IO_Flush();
     Is_cs43l22_Stop = 0;
   }
   
@@ -281,6 +332,7 @@ uint32_t cs43l22_Pause(uint16_t DeviceAddr)
   
   /* Put the Codec in Power save mode */    
   counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_POWER_CTL1, 0x01);
+  counter += CODEC_IO_Flush();
  
   return counter;
 }
@@ -304,6 +356,7 @@ uint32_t cs43l22_Resume(uint16_t DeviceAddr)
 
   /* Exit the Power save mode */
   counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_POWER_CTL1, 0x9E); 
+  counter += CODEC_IO_Flush();
   
   return counter;
 }
@@ -325,11 +378,9 @@ uint32_t cs43l22_Stop(uint16_t DeviceAddr, uint32_t CodecPdwnMode)
   /* Mute the output first */
   counter += cs43l22_SetMute(DeviceAddr, AUDIO_MUTE_ON);
 
-  /* Disable the digital soft ramp */
-  counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_MISC_CTL, 0x04);
-  
-  /* Power down the DAC and the speaker (PMDAC and PMSPK bits)*/
-  counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_POWER_CTL1, 0x9F);
+  /* Disable the digital soft ramp, power down the DAC and the speaker (PMDAC and PMSPK bits)*/
+  counter += CODEC_IO_WriteSeq(DeviceAddr, StopSeq, COUNTOF(StopSeq));
+  counter += CODEC_IO_Flush();
   
   Is_cs43l22_Stop = 1;
   return counter;    
@@ -360,6 +411,8 @@ uint32_t cs43l22_SetVolume(uint16_t DeviceAddr, uint8_t Volume)
     counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_MASTER_B_VOL, convertedvol + 0x19); 
   }
 
+  counter += CODEC_IO_Flush();
+
   return counter;
 }
 
@@ -388,9 +441,7 @@ uint32_t cs43l22_SetMute(uint16_t DeviceAddr, uint32_t Cmd)
   /* Set the Mute mode */
   if(Cmd == AUDIO_MUTE_ON)
   {
-    counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_POWER_CTL2, 0xFF);
-    counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_HEADPHONE_A_VOL, 0x01);
-    counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_HEADPHONE_B_VOL, 0x01);
+    counter += CODEC_IO_WriteSeq(DeviceAddr, MuteSeq, COUNTOF(MuteSeq));
   }
   else /* AUDIO_MUTE_OFF Disable the Mute */
   {
@@ -398,6 +449,7 @@ uint32_t cs43l22_SetMute(uint16_t DeviceAddr, uint32_t Cmd)
     counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_HEADPHONE_B_VOL, 0x00);
     counter += CODEC_IO_Write(DeviceAddr, CS43L22_REG_POWER_CTL2, OutputDev);
   }
+  counter += CODEC_IO_Flush();
   return counter;
 }
 
@@ -405,6 +457,7 @@ uint32_t cs43l22_SetMute(uint16_t DeviceAddr, uint32_t Cmd)
   * @brief Switch dynamically (while audio file is played) the output target 
   *         (speaker or headphone).
   * @note This function modifies a global variable of the audio codec driver: OutputDev.
+  * @note The power control register is only written when the output target changes.
   * @param DeviceAddr: Device address on communication Bus.
   * @param Output: specifies the audio output target: OUTPUT_DEVICE_SPEAKER,
   *         OUTPUT_DEVICE_HEADPHONE, OUTPUT_DEVICE_BOTH or OUTPUT_DEVICE_AUTO 
@@ -441,6 +494,7 @@ uint32_t cs43l22_SetOutputMode(uint16_t DeviceAddr, uint8_t Output)
       OutputDev = 0x05;
       break;
   }  
+  counter += CODEC_IO_Flush();
   return counter;
 }
 
@@ -455,26 +509,116 @@ uint32_t cs43l22_Reset(uint16_t DeviceAddr)
 }
 
 /**
-  * @brief  Writes/Read a single data.
+  * @brief  Queues a register write, unless the shadow cache holds the same value.
+  * @note   The write is sent to the codec by CODEC_IO_Flush().
   * @param  Addr: I2C address
   * @param  Reg: Reg address 
   * @param  Value: Data to be written
-  * @retval None
+  * @retval 0 if correct communication, else wrong communication
   */
 static uint8_t CODEC_IO_Write(uint8_t Addr, uint8_t Reg, uint8_t Value)
 {
   uint32_t result = 0;
-  
-  AUDIO_IO_Write(Addr, Reg, Value);
-  
+
+  if (Reg < CS43L22_SHADOW_COUNT)
+  {
+    if (((ShadowValid[Reg / 32] & (1U << (Reg % 32))) != 0) && (ShadowValue[Reg] == Value))
+    {
+      /* The register already holds this value */
+      return 0;
+    }
+    ShadowValue[Reg] = Value;
+    ShadowValid[Reg / 32] |= (1U << (Reg % 32));
+  }
+
+  if ((BatchCount == CS43L22_BATCH_SIZE) || ((BatchCount != 0) && (BatchAddr != Addr)))
+  {
+    result = CODEC_IO_Flush();
+  }
+
+  BatchAddr = Addr;
+  Batch[BatchIndex][BatchCount].Reg = Reg;
+  Batch[BatchIndex][BatchCount].Value = Value;
+  BatchCount++;
+
+  return result;
+}
+
+/**
+  * @brief  Queues a register sequence.
+  * @param  Addr: I2C address
+  * @param  pSeq: Register sequence
+  * @param  Count: Number of entries in the sequence
+  * @retval 0 if correct communication, else wrong communication
+  */
+static uint32_t CODEC_IO_WriteSeq(uint8_t Addr, const AUDIO_IO_RegTypeDef *pSeq, uint32_t Count)
+{
+  uint32_t counter = 0;
+  uint32_t index = 0;
+
+  for (index = 0; index < Count; index++)
+  {
+    counter += CODEC_IO_Write(Addr, (uint8_t)pSeq[index].Reg, (uint8_t)pSeq[index].Value);
+  }
+
+  return counter;
+}
+
+/**
+  * @brief  Sends the queued writes to the codec.
+  * @note   With AUDIO_IO_BATCH defined, AUDIO_IO_WriteBatch() sends them
+  *         asynchronously; otherwise they are written one by one.
+  * @retval 0 if correct communication, else wrong communication
+  */
+static uint32_t CODEC_IO_Flush(void)
+{
+  uint32_t result = 0;
+#if !defined(AUDIO_IO_BATCH) || defined(VERIFY_WRITTENDATA)
+  uint32_t index = 0;
+#endif
+  AUDIO_IO_RegTypeDef *pRegs = Batch[BatchIndex];
+
+  if (BatchCount != 0)
+  {
+#if defined(AUDIO_IO_BATCH)
+    AUDIO_IO_WriteBatch(BatchAddr, pRegs, BatchCount);
+#else
+    for (index = 0; index < BatchCount; index++)
+    {
+      AUDIO_IO_Write(BatchAddr, (uint8_t)pRegs[index].Reg, (uint8_t)pRegs[index].Value);
+    }
+#endif /* AUDIO_IO_BATCH */
+
 #ifdef VERIFY_WRITTENDATA
-  /* Verify that the data has been correctly written */  
-  result = (AUDIO_IO_Read(Addr, Reg) == Value)? 0:1;
+    /* Verify that the data has been correctly written */  
+    for (index = 0; index < BatchCount; index++)
+    {
+      result += (AUDIO_IO_Read(BatchAddr, (uint8_t)pRegs[index].Reg) == pRegs[index].Value)? 0:1;
+    }
 #endif /* VERIFY_WRITTENDATA */
-  
+
+    /* Queue the next writes in the other buffer */
+    BatchIndex ^= 1;
+    BatchCount = 0;
+  }
+
   return result;
 }
 
+/**
+  * @brief  Invalidates the shadow cache: the next write of each register is sent.
+  * @retval None
+  */
+static void CODEC_IO_ShadowReset(void)
+{
+  uint32_t index = 0;
+
+  for (index = 0; index < COUNTOF(ShadowValid); index++)
+  {
+    ShadowValid[index] = 0;
+  }
+}
+
 /**
   * @}
   */
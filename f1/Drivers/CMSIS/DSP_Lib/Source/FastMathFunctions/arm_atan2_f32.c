@@ -0,0 +1,210 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        21. September 2015
+* $Revision:    V.1.4.5 a
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_atan2_f32.c
+*
+* Description:  Fast arc tangent of two arguments for floating-point values.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup atan2 Arc Tangent of Two Arguments
+ *
+ * Computes the angle of the vector (x, y) in the range [-pi pi] using a table
+ * of 33 segments and a polynomial, as a faster alternative to the
+ * <code>atan2f()</code> function of the C library. There are separate
+ * functions for Q15, Q31, and floating-point data types.
+ *
+ * The steps used are:
+ *  -# Calculation of <code>t = min(|x|, |y|) / max(|x|, |y|)</code> in [0 1]
+ *  -# Calculation of the nearest table point <code>c = i / 32</code> and of
+ *     <code>d = t - c</code>, with <code>|d| <= 1/64</code>
+ *  -# <code>atan(t)</code> is the fourth order Taylor polynomial in <code>d</code>
+ *     around <code>c</code>, whose coefficients are read from the table
+ *  -# The octant is restored from the signs of x and y and their order.
+ *
+ * The Q31 and Q15 inputs are any pair of values of the same format, the
+ * result being in 2.29 and 2.13 format respectively (radians).
+ * The Q31 ratio is computed with the reciprocal of <code>arm_recip_q31()</code>,
+ * the Q15 one with an integer division.
+ *
+ * Error bounds:
+ * - floating-point: absolute error below 3e-7, finite inputs.
+ * - Q31: error below 2 LSB.
+ * - Q15: error below 2 LSB.
+ * atan2(0, 0) returns 0.
+ *
+ * <code>arm_vatan2_f32()</code>, <code>arm_vatan2_q31()</code> and
+ * <code>arm_vatan2_q15()</code> process whole buffers of y and x values.
+ */
+
+/**
+ * @addtogroup atan2
+ * @{
+ */
+
+#define ATAN2_F32_PI_2       1.57079637f
+
+/**
+ * @brief  Fast approximation to the arc tangent of y / x for floating-point data.
+ * @param[in] y y coordinate.
+ * @param[in] x x coordinate.
+ * @return  atan2(y, x) in radians, in the range [-pi pi].
+ */
+
+float32_t arm_atan2_f32(
+  float32_t y,
+  float32_t x)
+{
+  float32_t ax, ay, t, d, a;                     /* Absolute values, ratio, offset, angle */
+  const float32_t *pCoef;                        /* Coefficients of the segment */
+  uint32_t i;                                    /* Table index */
+
+  ax = (x < 0.0f) ? -x : x;
+  ay = (y < 0.0f) ? -y : y;
+
+  if(ay > ax)
+  {
+    t = ax / ay;
+  }
+  else if(ax > 0.0f)
+  {
+    t = ay / ax;
+  }
+  else
+  {
+    /* atan2(0, 0) */
+    return (0.0f);
+  }
+
+  /* Nearest table point and offset */
+  i = (uint32_t) ((t * 32.0f) + 0.5f);
+  d = t - ((float32_t) i * 0.03125f);
+  pCoef = &atanTable_f32[5u * i];
+
+  a = pCoef[0] + d * (pCoef[1] + d * (pCoef[2] + d * (pCoef[3] + d * pCoef[4])));
+
+  /* Restore the octant */
+  if(ay > ax)
+  {
+    a = ATAN2_F32_PI_2 - a;
+  }
+
+  if(x < 0.0f)
+  {
+    a = PI - a;
+  }
+
+  if(y < 0.0f)
+  {
+    a = -a;
+  }
+
+  return (a);
+}
+
+/**
+ * @brief  Arc tangent of the elements of two floating-point vectors.
+ * @param[in]  *pSrcY points to the vector of y coordinates
+ * @param[in]  *pSrcX points to the vector of x coordinates
+ * @param[out] *pDst points to the output vector
+ * @param[in]  blockSize number of samples in each vector
+ * @return none.
+ */
+
+void arm_vatan2_f32(
+  float32_t * pSrcY,
+  float32_t * pSrcX,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* The four evaluations are independent and can be interleaved */
+    pDst[0] = arm_atan2_f32(pSrcY[0], pSrcX[0]);
+    pDst[1] = arm_atan2_f32(pSrcY[1], pSrcX[1]);
+    pDst[2] = arm_atan2_f32(pSrcY[2], pSrcX[2]);
+    pDst[3] = arm_atan2_f32(pSrcY[3], pSrcX[3]);
+
+    pSrcY += 4u;
+    pSrcX += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_atan2_f32(*pSrcY++, *pSrcX++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of atan2 group
+ */
@@ -0,0 +1,184 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        21. September 2015
+* $Revision:    V.1.4.5 a
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_tanh_f32.c
+*
+* Description:  Fast hyperbolic tangent calculation for floating-point values.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup tanh Hyperbolic Tangent
+ *
+ * Computes the hyperbolic tangent using a table and a polynomial, as a
+ * faster alternative to the <code>tanhf()</code> function of the C library.
+ * There are separate functions for Q15, Q31, and floating-point data types.
+ *
+ * The table holds <code>T = tanh(c)</code> at points <code>c</code> spaced
+ * by 1/8 for the floating-point version and by 1/16 for the fixed-point
+ * versions. With <code>d = |x| - c</code>:
+ * - floating-point: <code>tanh(|x|) = (T + tanh(d)) / (1 + T * tanh(d))</code>,
+ *   <code>tanh(d)</code> being its fifth order Taylor polynomial;
+ * - fixed-point: <code>tanh(|x|)</code> is the Taylor polynomial in
+ *   <code>d</code> around <code>c</code>, whose coefficients are computed
+ *   from <code>T</code> (fifth order in Q31, second order in Q15).
+ *
+ * Error bounds:
+ * - floating-point: absolute error below 1.8e-7, relative error below 2.2e-7.
+ * - Q31: input in 5.26 format, output in 1.31 format, error below 2 LSB.
+ * - Q15: input in 4.11 format, output in 1.15 format, error below 3 LSB.
+ * The output saturates to +/-1 for |x| >= 9 (floating-point) or 11 (fixed-point).
+ *
+ * <code>arm_vtanh_f32()</code>, <code>arm_vtanh_q31()</code> and
+ * <code>arm_vtanh_q15()</code> process a whole buffer.
+ */
+
+/**
+ * @addtogroup tanh
+ * @{
+ */
+
+/**
+ * @brief  Fast approximation to the hyperbolic tangent for floating-point data.
+ * @param[in] x input value.
+ * @return  tanh(x).
+ */
+
+float32_t arm_tanh_f32(
+  float32_t x)
+{
+  float32_t ax, d, d2, td, T, a;                 /* Absolute value, offset, tanh(d), table value */
+  uint32_t i;                                    /* Table index */
+
+  if(x != x)
+  {
+    /* NaN */
+    return (x);
+  }
+
+  ax = (x < 0.0f) ? -x : x;
+
+  if(ax >= 9.0f)
+  {
+    a = 1.0f;
+  }
+  else
+  {
+    /* Nearest table point and offset, d being exact */
+    i = (uint32_t) ((ax * 8.0f) + 0.5f);
+    d = ax - ((float32_t) i * 0.125f);
+
+    /* tanh(d) */
+    d2 = d * d;
+    td = d + (d * d2) * (-0.333333343f + d2 * 0.13333334f);
+
+    /* tanh(c + d) */
+    T = tanhTable_f32[i];
+    a = (T + td) / (1.0f + T * td);
+  }
+
+  return ((x < 0.0f) ? -a : a);
+}
+
+/**
+ * @brief  Hyperbolic tangent of the elements of a floating-point vector.
+ * @param[in]  *pSrc points to the input vector
+ * @param[out] *pDst points to the output vector
+ * @param[in]  blockSize number of samples in each vector
+ * @return none.
+ */
+
+void arm_vtanh_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* The four evaluations are independent and can be interleaved */
+    pDst[0] = arm_tanh_f32(pSrc[0]);
+    pDst[1] = arm_tanh_f32(pSrc[1]);
+    pDst[2] = arm_tanh_f32(pSrc[2]);
+    pDst[3] = arm_tanh_f32(pSrc[3]);
+
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_tanh_f32(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of tanh group
+ */
@@ -0,0 +1,142 @@
+/* ----------------------------------------------------------------------  
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.  
+*  
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*  
+* Project: 	    CMSIS DSP Library  
+* Title:	    arm_fir_fft_f32.c  
+*  
+* Description:	Floating-point partitioned FFT FIR filter processing function.  
+*  
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE. 
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**  
+* @ingroup groupFilters  
+*/
+
+/**  
+* @defgroup FIR_FFT Partitioned FFT FIR Filter  
+*  
+* This set of functions implements long floating-point FIR filters by fast convolution.  
+* Each call to the function processes one block of <code>blockSize</code> samples,  
+* <code>blockSize</code> being fixed when the instance is initialized.  
+* The output is identical, to rounding, to the one of <code>arm_fir_f32()</code> with the same coefficients.  
+*  
+* \par Algorithm:  
+* The filter uses uniformly partitioned overlap-save convolution.  
+* The impulse response is cut into <code>numParts = ceil(numTaps / blockSize)</code> partitions of  
+* <code>blockSize</code> taps whose spectra, computed by <code>arm_rfft_fast_f32()</code> on  
+* <code>2*blockSize</code> points, are stored at initialization.  
+* For each block, the spectrum of the last <code>2*blockSize</code> input samples is pushed  
+* into a frequency delay line; the spectra of the partitions are multiplied with the input  
+* spectra of matching delay using <code>arm_cmplx_mult_cmplx_f32()</code> and summed, and the  
+* inverse FFT of the sum gives the output block in its second half.  
+* \par  
+* The cost of a block is two real FFTs of <code>2*blockSize</code> points and  
+* <code>numParts</code> complex multiply-accumulates of <code>blockSize</code> bins, instead of  
+* <code>numTaps*blockSize</code> multiply-accumulates for the direct form. The latency is  
+* one block, as for <code>arm_fir_f32()</code> called with the same block size.  
+*  
+* \par  
+* <code>2*blockSize</code> must be a length supported by <code>arm_rfft_fast_init_f32()</code>.  
+*  
+* \par Instance Structure  
+* The instance keeps pointers into a single state buffer supplied by the caller  
+* at initialization, of <code>ARM_FIR_FFT_STATE_SIZE_F32(numTaps, blockSize)</code> values.  
+* It holds the partition spectra, the frequency delay line, the input window and two  
+* work buffers. A separate instance and state buffer must be used for each filter.  
+*/
+
+/**  
+ * @addtogroup FIR_FFT  
+ * @{  
+ */
+
+/**  
+ * @param[in]  *S    points to an instance of the floating-point partitioned FFT FIR structure.  
+ * @param[in]  *pSrc points to the block of <code>blockSize</code> input samples.  
+ * @param[out] *pDst points to the block of <code>blockSize</code> output samples.  
+ * @return     none.  
+ */
+
+void arm_fir_fft_f32(
+  arm_fir_fft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst)
+{
+  uint32_t blockSize = S->blockSize;             /* Block and partition length */
+  uint32_t fftLen = 2u * blockSize;              /* Length of the real FFT */
+  uint32_t numParts = S->numParts;               /* Number of partitions */
+  uint32_t slot = S->partIndex;                  /* Delay line slot of the newest spectrum */
+  float32_t *pX, *pH, *pP;                       /* Input spectrum, partition spectrum, product */
+  uint32_t k;                                    /* Loop counter */
+
+  /* Slide the input window by one block */
+  arm_copy_f32(S->pInput + blockSize, S->pInput, blockSize);
+  arm_copy_f32(pSrc, S->pInput + blockSize, blockSize);
+
+  /* The real FFT works in place on its input: transform a copy of the window */
+  arm_copy_f32(S->pInput, S->pScratch, fftLen);
+  arm_rfft_fast_f32(&S->rfft, S->pScratch, S->pFdl + (slot * fftLen), 0u);
+
+  /* The partition k is applied to the input spectrum k blocks old */
+  for (k = 0u; k < numParts; k++)
+  {
+    pX = S->pFdl + (slot * fftLen);
+    pH = S->pCoeffsFreq + (k * fftLen);
+    pP = (k == 0u) ? S->pAcc : S->pScratch;
+
+    /* DC and Nyquist bins are packed as two real values in the first bin */
+    pP[0] = pX[0] * pH[0];
+    pP[1] = pX[1] * pH[1];
+    arm_cmplx_mult_cmplx_f32(pX + 2, pH + 2, pP + 2, blockSize - 1u);
+
+    if(k != 0u)
+    {
+      arm_add_f32(S->pAcc, S->pScratch, S->pAcc, fftLen);
+    }
+
+    slot = ((slot + 1u) == numParts) ? 0u : (slot + 1u);
+  }
+
+  /* The second half of the circular convolution is the linear convolution */
+  arm_rfft_fast_f32(&S->rfft, S->pAcc, S->pScratch, 1u);
+  arm_copy_f32(S->pScratch + blockSize, pDst, blockSize);
+
+  /* The next input spectrum goes into the slot preceding the newest */
+  S->partIndex = (S->partIndex == 0u) ? (uint16_t) (numParts - 1u) : (uint16_t) (S->partIndex - 1u);
+}
+
+/**  
+ * @} end of FIR_FFT group  
+ */
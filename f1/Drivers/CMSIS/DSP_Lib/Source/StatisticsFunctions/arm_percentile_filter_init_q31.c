@@ -0,0 +1,96 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_percentile_filter_init_q31.c  
+*    
+* Description:	Initialization function for the Q31 sliding-window percentile filter.  
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Percentile
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 sliding-window percentile filter.
+ * @param[out]    *S points to an instance of the Q31 percentile filter structure.
+ * @param[in]     windowLength number of samples in the window.
+ * @param[in]     rank order statistic output, from 0 (minimum) to windowLength-1 (maximum).
+ * @param[in]     initValue value the window is initially filled with.
+ * @param[in]     *pState points to the window buffer of windowLength samples.
+ * @param[in]     *pIndex points to the heap buffer of 2*windowLength indexes.
+ * @return        The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR
+ * if windowLength is zero or if rank is not below it.
+ */
+
+arm_status arm_percentile_filter_init_q31(
+  arm_percentile_instance_q31 * S,
+  uint16_t windowLength,
+  uint16_t rank,
+  q31_t initValue,
+  q31_t * pState,
+  uint16_t * pIndex)
+{
+  uint32_t i;                                    /* Loop counter */
+
+  if((windowLength == 0u) || (rank >= windowLength))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->windowLength = windowLength;
+  S->rank = rank;
+  S->index = 0u;
+  S->pState = pState;
+  S->pIndex = pIndex;                            /* Equal samples make valid heaps in any order */
+  for (i = 0u; i < windowLength; i++)
+  {
+    pState[i] = initValue;
+    pIndex[i] = (uint16_t) i;
+    pIndex[windowLength + i] = (uint16_t) i;
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Percentile group
+ */
@@ -0,0 +1,239 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_percentile_filter_q31.c  
+*    
+* Description:	Processing function for the Q31 sliding-window percentile filter.  
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Percentile
+ * @{
+ */
+
+/**
+ * @brief  Exchanges two entries of the heaps and updates their positions.
+ * @param[in,out] *pHeap points to the heaps.
+ * @param[in,out] *pPos points to the positions of the window samples in the heaps.
+ * @param[in]     i position of the first entry.
+ * @param[in]     j position of the second entry.
+ * @return none.
+ */
+
+static void arm_percentile_swap_q31(
+  uint16_t * pHeap,
+  uint16_t * pPos,
+  uint32_t i,
+  uint32_t j)
+{
+  uint16_t t = pHeap[i];                         /* Temporary index */
+
+  pHeap[i] = pHeap[j];
+  pHeap[j] = t;
+  pPos[pHeap[i]] = (uint16_t) i;
+  pPos[pHeap[j]] = (uint16_t) j;
+}
+
+/**
+ * @brief  Moves an entry of the low max-heap to its place.
+ * @param[in,out] *S points to an instance of the Q31 percentile filter structure.
+ * @param[in]     i position of the entry, in [0 rank].
+ * @return none.
+ */
+
+static void arm_percentile_lo_q31(
+  arm_percentile_instance_q31 * S,
+  uint32_t i)
+{
+  const q31_t *pVal = S->pState;                 /* Window samples */
+  uint16_t *pHeap = S->pIndex;                   /* Heaps */
+  uint16_t *pPos = S->pIndex + S->windowLength;  /* Positions in the heaps */
+  uint32_t size = (uint32_t) S->rank + 1u;       /* Size of the low heap */
+  uint32_t c;                                    /* Child or parent position */
+
+  /* Up while above the parent */
+  while(i > 0u)
+  {
+    c = (i - 1u) >> 1u;
+    if(pVal[pHeap[i]] <= pVal[pHeap[c]])
+    {
+      break;
+    }
+    arm_percentile_swap_q31(pHeap, pPos, i, c);
+    i = c;
+  }
+
+  /* Down while below the largest child */
+  for (;;)
+  {
+    c = (2u * i) + 1u;
+    if(c >= size)
+    {
+      break;
+    }
+    if(((c + 1u) < size) && (pVal[pHeap[c + 1u]] > pVal[pHeap[c]]))
+    {
+      c++;
+    }
+    if(pVal[pHeap[c]] <= pVal[pHeap[i]])
+    {
+      break;
+    }
+    arm_percentile_swap_q31(pHeap, pPos, i, c);
+    i = c;
+  }
+}
+
+/**
+ * @brief  Moves an entry of the high min-heap to its place.
+ * @param[in,out] *S points to an instance of the Q31 percentile filter structure.
+ * @param[in]     i position of the entry, in [rank+1 windowLength-1].
+ * @return none.
+ */
+
+static void arm_percentile_hi_q31(
+  arm_percentile_instance_q31 * S,
+  uint32_t i)
+{
+  const q31_t *pVal = S->pState;                 /* Window samples */
+  uint16_t *pHeap = S->pIndex;                   /* Heaps */
+  uint16_t *pPos = S->pIndex + S->windowLength;  /* Positions in the heaps */
+  uint32_t base = (uint32_t) S->rank + 1u;       /* Position of the root of the high heap */
+  uint32_t end = S->windowLength;                /* End of the high heap */
+  uint32_t c;                                    /* Child or parent position */
+
+  /* Up while below the parent */
+  while(i > base)
+  {
+    c = base + (((i - base) - 1u) >> 1u);
+    if(pVal[pHeap[i]] >= pVal[pHeap[c]])
+    {
+      break;
+    }
+    arm_percentile_swap_q31(pHeap, pPos, i, c);
+    i = c;
+  }
+
+  /* Down while above the smallest child */
+  for (;;)
+  {
+    c = base + (2u * (i - base)) + 1u;
+    if(c >= end)
+    {
+      break;
+    }
+    if(((c + 1u) < end) && (pVal[pHeap[c + 1u]] < pVal[pHeap[c]]))
+    {
+      c++;
+    }
+    if(pVal[pHeap[c]] >= pVal[pHeap[i]])
+    {
+      break;
+    }
+    arm_percentile_swap_q31(pHeap, pPos, i, c);
+    i = c;
+  }
+}
+
+/**
+ * @brief  Processing function for the Q31 sliding-window percentile filter.
+ * @param[in,out] *S points to an instance of the Q31 percentile filter structure.
+ * @param[in]     *pSrc points to the block of input samples.
+ * @param[out]    *pDst points to the block of output samples, which can be pSrc.
+ * @param[in]     blockSize number of samples to process.
+ * @return none.
+ */
+
+void arm_percentile_filter_q31(
+  arm_percentile_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pVal = S->pState;                       /* Window samples */
+  uint16_t *pHeap = S->pIndex;                   /* Heaps */
+  uint16_t *pPos = S->pIndex + S->windowLength;  /* Positions in the heaps */
+  uint32_t base = (uint32_t) S->rank + 1u;       /* Position of the root of the high heap */
+  uint32_t slot = S->index;                      /* Window slot of the oldest sample */
+  q31_t in;                                      /* New sample */
+  uint32_t pos;                                  /* Position of the oldest sample in the heaps */
+
+  while(blockSize > 0u)
+  {
+    /* The new sample replaces the oldest one, in the same heap entry */
+    in = *pSrc++;
+    pVal[slot] = in;
+    pos = pPos[slot];
+
+    if(pos < base)
+    {
+      arm_percentile_lo_q31(S, pos);
+    }
+    else
+    {
+      arm_percentile_hi_q31(S, pos);
+    }
+
+    /* Exchange the roots when the heaps are out of order */
+    if((base < S->windowLength) && (pVal[pHeap[0]] > pVal[pHeap[base]]))
+    {
+      arm_percentile_swap_q31(pHeap, pPos, 0u, base);
+      arm_percentile_lo_q31(S, 0u);
+      arm_percentile_hi_q31(S, base);
+    }
+
+    *pDst++ = pVal[pHeap[0]];
+
+    slot++;
+    if(slot == S->windowLength)
+    {
+      slot = 0u;
+    }
+
+    blockSize--;
+  }
+
+  S->index = (uint16_t) slot;
+}
+
+/**
+ * @} end of Percentile group
+ */
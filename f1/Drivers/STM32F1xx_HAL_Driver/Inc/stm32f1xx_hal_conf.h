@@ -142,6 +142,7 @@ extern "C" {
 #define  TICK_INT_PRIORITY            0x0FU /*!< tick interrupt priority */
 #define  USE_RTOS                     0U
 #define  PREFETCH_ENABLE              1U
+#define  USE_HAL_TRACE                0U /*!< Record HAL driver events in the trace buffer */
 
 /* ########################## Assert Selection ############################## */
 /**
@@ -936,6 +936,7 @@ void HAL_ETH_IRQHandler(ETH_HandleTypeDef *heth)
   /* Frame received */
   if (__HAL_ETH_DMA_GET_FLAG(heth, ETH_DMA_FLAG_R))
   {
+    __HAL_TRACE(HAL_TRACE_EVT_ETH_RX, heth->Instance);
     /* Receive complete callback */
     HAL_ETH_RxCpltCallback(heth);
 
@@ -0,0 +1,248 @@
+/**
+  ******************************************************************************
+  * @file    stm32f1xx_hal_trace.c
+  * @author  MCD Application Team
+  * @brief   TRACE HAL module driver.
+  *          Lock-free binary event trace buffer fed by the HAL drivers
+  *          and the interrupt handlers.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2016 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */ 
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f1xx_hal.h"
+
+/** @addtogroup STM32F1xx_HAL_Driver
+  * @{
+  */
+
+/** @defgroup TRACE TRACE
+  * @brief HAL trace module driver
+  * @{
+  */
+
+#if (USE_HAL_TRACE == 1U)
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/** @addtogroup TRACE_Private_Constants
+  * @{
+  */
+#if !defined(HAL_TRACE_BUFFER_SIZE)
+#define HAL_TRACE_BUFFER_SIZE    256U   /* Number of events, must be a power of 2 */
+#endif
+/**
+  * @}
+  */
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/** @addtogroup TRACE_Private_Variables
+  * @{
+  */
+static HAL_TRACE_EventTypeDef TraceBuffer[HAL_TRACE_BUFFER_SIZE];
+static __IO uint32_t TraceHead = 0U;     /* Next slot to reserve, moved by the producers */
+static __IO uint32_t TraceTail = 0U;     /* Next slot to read, moved by the consumer     */
+static __IO uint32_t TraceDropped = 0U;  /* Events lost on a full buffer                 */
+/**
+  * @}
+  */
+
+/* Private function prototypes -----------------------------------------------*/
+/* Exported functions --------------------------------------------------------*/
+/** @defgroup TRACE_Exported_Functions TRACE Exported Functions
+  * @brief    Trace recording and readout functions
+  *
+@verbatim
+  ==============================================================================
+                 ##### How to use this driver #####
+  ==============================================================================
+  [..]
+    (#) Set USE_HAL_TRACE to 1U in stm32f1xx_hal_conf.h. The HAL drivers then
+        record an event when they start a DMA transfer and before they call the
+        DMA, UART error, ETH receive and USB start of frame callbacks.
+    (#) Call HAL_TRACE_Init() once, before the first event.
+    (#) Add __HAL_TRACE_IRQ_ENTER() and __HAL_TRACE_IRQ_EXIT() to the interrupt
+        handlers to time, and __HAL_TRACE() with identifiers from
+        HAL_TRACE_EVT_USER for application events.
+    (#) Drain the events from a single context with HAL_TRACE_Read(), to send
+        them for instance over the USB CDC class,
+        or to the SWO output with HAL_TRACE_FlushITM().
+    (#) Recording never blocks nor masks interrupts: when the buffer is
+        full the event is dropped and counted by HAL_TRACE_GetDropped().
+        HAL_TRACE_BUFFER_SIZE sets the buffer depth.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Clear the trace buffer and start the cycle counter used as time base.
+  * @retval None
+  */
+void HAL_TRACE_Init(void)
+{
+  uint32_t i;
+
+  for(i = 0U; i < HAL_TRACE_BUFFER_SIZE; i++)
+  {
+    TraceBuffer[i].Event = 0U;
+  }
+  TraceHead = 0U;
+  TraceTail = 0U;
+  TraceDropped = 0U;
+
+  /* Enable the DWT cycle counter */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/**
+  * @brief  Record one event.
+  * @note   May be called from any context, including nested interrupts.
+  * @param  Event event identifier, a value of @ref TRACE_Events
+  * @param  Arg event argument
+  * @retval None
+  */
+void HAL_TRACE_Record(uint32_t Event, uint32_t Arg)
+{
+  HAL_TRACE_EventTypeDef *pEntry;
+  uint32_t head;
+
+  /* Reserve a slot */
+  do
+  {
+    head = __LDREXW(&TraceHead);
+    if((head - TraceTail) >= HAL_TRACE_BUFFER_SIZE)
+    {
+      __CLREX();
+      do
+      {
+      } while(__STREXW(__LDREXW(&TraceDropped) + 1U, &TraceDropped) != 0U);
+      return;
+    }
+  } while(__STREXW(head + 1U, &TraceHead) != 0U);
+
+  pEntry = &TraceBuffer[head & (HAL_TRACE_BUFFER_SIZE - 1U)];
+  pEntry->TimeStamp = DWT->CYCCNT;
+  pEntry->Arg = Arg;
+  __DMB();
+
+  /* A non zero identifier hands the slot to the consumer */
+  pEntry->Event = Event;
+}
+
+/**
+  * @brief  Copy the oldest recorded events and release their slots.
+  * @note   Only one context may read the trace buffer.
+  * @param  pEvents destination of the events
+  * @param  MaxCount maximum number of events to copy
+  * @retval Number of events copied
+  */
+uint32_t HAL_TRACE_Read(HAL_TRACE_EventTypeDef *pEvents, uint32_t MaxCount)
+{
+  HAL_TRACE_EventTypeDef *pEntry;
+  uint32_t count = 0U;
+
+  while((count < MaxCount) && (TraceTail != TraceHead))
+  {
+    pEntry = &TraceBuffer[TraceTail & (HAL_TRACE_BUFFER_SIZE - 1U)];
+
+    /* Slot reserved by a producer that has not written it yet */
+    if(pEntry->Event == 0U)
+    {
+      break;
+    }
+    __DMB();
+
+    pEvents[count] = *pEntry;
+    pEntry->Event = 0U;
+    __DMB();
+
+    TraceTail++;
+    count++;
+  }
+
+  return count;
+}
+
+/**
+  * @brief  Return the number of events dropped on a full buffer.
+  * @retval Number of dropped events
+  */
+uint32_t HAL_TRACE_GetDropped(void)
+{
+  return TraceDropped;
+}
+
+/**
+  * @brief  Send the recorded events to an ITM stimulus port, three words each.
+  * @note   The ITM and the port must have been enabled by the debugger.
+  * @param  Port ITM stimulus port, 0 to 31
+  * @retval Number of events sent
+  */
+uint32_t HAL_TRACE_FlushITM(uint32_t Port)
+{
+  HAL_TRACE_EventTypeDef event;
+  uint32_t count = 0U;
+
+  if((Port > 31U) || ((ITM->TCR & ITM_TCR_ITMENA_Msk) == 0U) || ((ITM->TER & (1UL << Port)) == 0U))
+  {
+    return 0U;
+  }
+
+  while(HAL_TRACE_Read(&event, 1U) != 0U)
+  {
+    while(ITM->PORT[Port].u32 == 0U) {}
+    ITM->PORT[Port].u32 = event.TimeStamp;
+    while(ITM->PORT[Port].u32 == 0U) {}
+    ITM->PORT[Port].u32 = event.Event;
+    while(ITM->PORT[Port].u32 == 0U) {}
+    ITM->PORT[Port].u32 = event.Arg;
+    count++;
+  }
+
+  return count;
+}
+
+/**
+  * @}
+  */
+
+#endif /* USE_HAL_TRACE */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -1751,6 +1751,9 @@ HAL_StatusTypeDef USB_ActivateEndpoint(USB_TypeDef *USBx, USB_EPTypeDef *ep)
     PCD_SET_EP_DBUF(USBx, ep->num);
     /*Set buffer address for double buffered mode*/
     PCD_SET_EP_DBUF_ADDR(USBx, ep->num,ep->pmaaddr0, ep->pmaaddr1);
+    ep->db_armed = 0U;
+    ep->db_queued = 0U;
+    ep->db_packets = 0U;
     
     if (ep->is_in==0)
     {
@@ -1760,6 +1763,9 @@ HAL_StatusTypeDef USB_ActivateEndpoint(USB_TypeDef *USBx, USB_EPTypeDef *ep)
       
       /* Reset value of the data toggle bits for the endpoint out*/
       PCD_TX_DTOG(USBx, ep->num);
+
+      /* Reception size of both buffers */
+      PCD_SET_EP_DBUF_CNT(USBx, ep->num, ep->is_in, ep->maxpacket);
       
       PCD_SET_EP_RX_STATUS(USBx, ep->num, USB_EP_RX_VALID);
       PCD_SET_EP_TX_STATUS(USBx, ep->num, USB_EP_TX_DIS);
@@ -1769,7 +1775,9 @@ HAL_StatusTypeDef USB_ActivateEndpoint(USB_TypeDef *USBx, USB_EPTypeDef *ep)
       /* Clear the data toggle bits for the endpoint IN/OUT*/
       PCD_CLEAR_RX_DTOG(USBx, ep->num);
       PCD_CLEAR_TX_DTOG(USBx, ep->num);
-      PCD_RX_DTOG(USBx, ep->num);
+
+      /* No packet to send: both buffers empty */
+      PCD_SET_EP_DBUF_CNT(USBx, ep->num, ep->is_in, 0U);
       /* Configure DISABLE status for the Endpoint*/
       PCD_SET_EP_TX_STATUS(USBx, ep->num, USB_EP_TX_DIS);
       PCD_SET_EP_RX_STATUS(USBx, ep->num, USB_EP_RX_DIS);
@@ -213,6 +213,7 @@ void     ili9341_DisplayOn(void);
 void     ili9341_DisplayOff(void);
 uint16_t ili9341_GetLcdPixelWidth(void);
 uint16_t ili9341_GetLcdPixelHeight(void);
+void     ili9341_SetWriteWindow(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
 
 /* LCD driver structure */
 extern LCD_DrvTypeDef   ili9341_drv;
@@ -0,0 +1,99 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_stats_get_f32.c  
+*    
+* Description:	Results of the floating-point batch statistics.  
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupStats    
+ */
+
+/**    
+ * @addtogroup Stats    
+ * @{    
+ */
+
+/**    
+ * @brief Results of the floating-point batch statistics.    
+ * @param[in]       *S points to an instance of the floating-point statistics structure.    
+ * @param[out]      *pResult statistics of the samples accumulated since the initialization    
+ * @return none.    
+ *    
+ * \par    
+ * All results are zero when no sample has been accumulated, and the variance is zero    
+ * for a single sample.    
+ */
+
+void arm_stats_get_f32(
+  const arm_stats_instance_f32 * S,
+  arm_stats_result_f32 * pResult)
+{
+  float32_t count = (float32_t) S->count;        /* Number of samples */
+
+  if(S->count == 0u)
+  {
+    pResult->mean = 0.0f;
+    pResult->var = 0.0f;
+    pResult->rms = 0.0f;
+  }
+  else
+  {
+    pResult->mean = S->sum / count;
+
+    if(S->count == 1u)
+    {
+      pResult->var = 0.0f;
+    }
+    else
+    {
+      pResult->var = (S->sumOfSquares - ((S->sum * S->sum) / count)) / (count - 1.0f);
+    }
+
+    arm_sqrt_f32(S->sumOfSquares / count, &pResult->rms);
+  }
+
+  pResult->min = S->min;
+  pResult->max = S->max;
+  pResult->minIndex = S->minIndex;
+  pResult->maxIndex = S->maxIndex;
+}
+
+/**    
+ * @} end of Stats group    
+ */
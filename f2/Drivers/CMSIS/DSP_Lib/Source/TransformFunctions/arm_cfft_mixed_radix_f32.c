@@ -0,0 +1,309 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_cfft_mixed_radix_f32.c
+*    
+* Description:	Mixed radix-2/3/4/5 Decimation in Frequency CFFT Floating point processing function
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.      
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/* Multiply the complex value (xR, xI) by the conjugate of the twiddle
+   factor stored at pCoef[2*k] (cos, sin) and store it at pDst */
+#define CMPLX_MUL_CONJ_STORE(pDst, xR, xI, pCoef, k)          \
+do {                                                          \
+    float32_t co = (pCoef)[2u * (k)];                         \
+    float32_t si = (pCoef)[2u * (k) + 1u];                    \
+    (pDst)[0] = ((xR) * co) + ((xI) * si);                    \
+    (pDst)[1] = ((xI) * co) - ((xR) * si);                    \
+} while (0)
+
+/**    
+* @brief  Radix-2 stage of the mixed radix CFFT.    
+* @param[in, out] *pSrc      points to the in-place buffer.    
+* @param[in]      fftLen     length of the full FFT.    
+* @param[in]      subLen     length of the sub-transforms processed by this stage.    
+* @param[in]      *pCoef     points to the twiddle coefficient table of the full FFT.    
+* @param[in]      twidStep   twiddle index step, fftLen / subLen.    
+*/
+static void arm_radix2_stage_mixed_f32(
+  float32_t * pSrc,
+  uint32_t fftLen,
+  uint32_t subLen,
+  const float32_t * pCoef,
+  uint32_t twidStep)
+{
+   uint32_t i, j, m = subLen / 2u;
+   float32_t *p0, *p1;
+   float32_t aR, aI, bR, bI;
+
+   for (j = 0u; j < m; j++)
+   {
+      for (i = j; i < fftLen; i += subLen)
+      {
+         p0 = pSrc + (2u * i);
+         p1 = p0 + (2u * m);
+
+         aR = p0[0] + p1[0];
+         aI = p0[1] + p1[1];
+         bR = p0[0] - p1[0];
+         bI = p0[1] - p1[1];
+
+         p0[0] = aR;
+         p0[1] = aI;
+         CMPLX_MUL_CONJ_STORE(p1, bR, bI, pCoef, j * twidStep);
+      }
+   }
+}
+
+/**    
+* @brief  Radix-3 stage of the mixed radix CFFT.    
+* @param[in, out] *pSrc      points to the in-place buffer.    
+* @param[in]      fftLen     length of the full FFT.    
+* @param[in]      subLen     length of the sub-transforms processed by this stage.    
+* @param[in]      *pCoef     points to the twiddle coefficient table of the full FFT.    
+* @param[in]      twidStep   twiddle index step, fftLen / subLen.    
+*/
+static void arm_radix3_stage_mixed_f32(
+  float32_t * pSrc,
+  uint32_t fftLen,
+  uint32_t subLen,
+  const float32_t * pCoef,
+  uint32_t twidStep)
+{
+   const float32_t s3 = 0.866025404f;               /* sin(2*pi/3) */
+   uint32_t i, j, m = subLen / 3u;
+   float32_t *p0, *p1, *p2;
+   float32_t tR, tI, dR, dI, aR, aI;
+
+   for (j = 0u; j < m; j++)
+   {
+      for (i = j; i < fftLen; i += subLen)
+      {
+         p0 = pSrc + (2u * i);
+         p1 = p0 + (2u * m);
+         p2 = p1 + (2u * m);
+
+         tR = p1[0] + p2[0];
+         tI = p1[1] + p2[1];
+         dR = s3 * (p1[0] - p2[0]);
+         dI = s3 * (p1[1] - p2[1]);
+         aR = p0[0] - (0.5f * tR);
+         aI = p0[1] - (0.5f * tI);
+
+         p0[0] = p0[0] + tR;
+         p0[1] = p0[1] + tI;
+         /* y1 = a - i*d, y2 = a + i*d */
+         CMPLX_MUL_CONJ_STORE(p1, aR + dI, aI - dR, pCoef, j * twidStep);
+         CMPLX_MUL_CONJ_STORE(p2, aR - dI, aI + dR, pCoef, 2u * j * twidStep);
+      }
+   }
+}
+
+/**    
+* @brief  Radix-4 stage of the mixed radix CFFT.    
+* @param[in, out] *pSrc      points to the in-place buffer.    
+* @param[in]      fftLen     length of the full FFT.    
+* @param[in]      subLen     length of the sub-transforms processed by this stage.    
+* @param[in]      *pCoef     points to the twiddle coefficient table of the full FFT.    
+* @param[in]      twidStep   twiddle index step, fftLen / subLen.    
+*/
+static void arm_radix4_stage_mixed_f32(
+  float32_t * pSrc,
+  uint32_t fftLen,
+  uint32_t subLen,
+  const float32_t * pCoef,
+  uint32_t twidStep)
+{
+   uint32_t i, j, m = subLen / 4u;
+   float32_t *p0, *p1, *p2, *p3;
+   float32_t aR, aI, bR, bI, cR, cI, dR, dI;
+
+   for (j = 0u; j < m; j++)
+   {
+      for (i = j; i < fftLen; i += subLen)
+      {
+         p0 = pSrc + (2u * i);
+         p1 = p0 + (2u * m);
+         p2 = p1 + (2u * m);
+         p3 = p2 + (2u * m);
+
+         aR = p0[0] + p2[0];
+         aI = p0[1] + p2[1];
+         cR = p0[0] - p2[0];
+         cI = p0[1] - p2[1];
+         bR = p1[0] + p3[0];
+         bI = p1[1] + p3[1];
+         dR = p1[0] - p3[0];
+         dI = p1[1] - p3[1];
+
+         p0[0] = aR + bR;
+         p0[1] = aI + bI;
+         /* y1 = c - i*d, y2 = a - b, y3 = c + i*d */
+         CMPLX_MUL_CONJ_STORE(p1, cR + dI, cI - dR, pCoef, j * twidStep);
+         CMPLX_MUL_CONJ_STORE(p2, aR - bR, aI - bI, pCoef, 2u * j * twidStep);
+         CMPLX_MUL_CONJ_STORE(p3, cR - dI, cI + dR, pCoef, 3u * j * twidStep);
+      }
+   }
+}
+
+/**    
+* @brief  Radix-5 stage of the mixed radix CFFT.    
+* @param[in, out] *pSrc      points to the in-place buffer.    
+* @param[in]      fftLen     length of the full FFT.    
+* @param[in]      subLen     length of the sub-transforms processed by this stage.    
+* @param[in]      *pCoef     points to the twiddle coefficient table of the full FFT.    
+* @param[in]      twidStep   twiddle index step, fftLen / subLen.    
+*/
+static void arm_radix5_stage_mixed_f32(
+  float32_t * pSrc,
+  uint32_t fftLen,
+  uint32_t subLen,
+  const float32_t * pCoef,
+  uint32_t twidStep)
+{
+   const float32_t c1 =  0.309016994f;              /* cos(2*pi/5) */
+   const float32_t c2 = -0.809016994f;              /* cos(4*pi/5) */
+   const float32_t s1 =  0.951056516f;              /* sin(2*pi/5) */
+   const float32_t s2 =  0.587785252f;              /* sin(4*pi/5) */
+   uint32_t i, j, m = subLen / 5u;
+   float32_t *p0, *p1, *p2, *p3, *p4;
+   float32_t t1R, t1I, t2R, t2I, d1R, d1I, d2R, d2I;
+   float32_t a1R, a1I, a2R, a2I, b1R, b1I, b2R, b2I;
+
+   for (j = 0u; j < m; j++)
+   {
+      for (i = j; i < fftLen; i += subLen)
+      {
+         p0 = pSrc + (2u * i);
+         p1 = p0 + (2u * m);
+         p2 = p1 + (2u * m);
+         p3 = p2 + (2u * m);
+         p4 = p3 + (2u * m);
+
+         t1R = p1[0] + p4[0];
+         t1I = p1[1] + p4[1];
+         t2R = p2[0] + p3[0];
+         t2I = p2[1] + p3[1];
+         d1R = p1[0] - p4[0];
+         d1I = p1[1] - p4[1];
+         d2R = p2[0] - p3[0];
+         d2I = p2[1] - p3[1];
+
+         a1R = p0[0] + (c1 * t1R) + (c2 * t2R);
+         a1I = p0[1] + (c1 * t1I) + (c2 * t2I);
+         a2R = p0[0] + (c2 * t1R) + (c1 * t2R);
+         a2I = p0[1] + (c2 * t1I) + (c1 * t2I);
+         b1R = (s1 * d1R) + (s2 * d2R);
+         b1I = (s1 * d1I) + (s2 * d2I);
+         b2R = (s2 * d1R) - (s1 * d2R);
+         b2I = (s2 * d1I) - (s1 * d2I);
+
+         p0[0] = p0[0] + t1R + t2R;
+         p0[1] = p0[1] + t1I + t2I;
+         /* y1 = a1 - i*b1, y2 = a2 - i*b2, y3 = a2 + i*b2, y4 = a1 + i*b1 */
+         CMPLX_MUL_CONJ_STORE(p1, a1R + b1I, a1I - b1R, pCoef, j * twidStep);
+         CMPLX_MUL_CONJ_STORE(p2, a2R + b2I, a2I - b2R, pCoef, 2u * j * twidStep);
+         CMPLX_MUL_CONJ_STORE(p3, a2R - b2I, a2I + b2R, pCoef, 3u * j * twidStep);
+         CMPLX_MUL_CONJ_STORE(p4, a1R - b1I, a1I + b1R, pCoef, 4u * j * twidStep);
+      }
+   }
+}
+
+/**    
+* @ingroup groupTransforms    
+*/
+
+/**    
+* @addtogroup ComplexFFT    
+* @{    
+*/
+
+/**    
+* @details    
+* @brief  Mixed radix decimation in frequency core of the floating-point CFFT.    
+* @param[in]      *S    points to an instance of the floating-point CFFT structure.    
+* @param[in, out] *p1   points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place.    
+* @return none.    
+*    
+* \par    
+* <code>fftLen</code> is split into radix-5, then radix-3, then radix-4 stages, with
+* a final radix-2 stage when an odd power of two remains. The output is left in
+* digit reversed order; the <code>pBitRevTable</code> of the instance holds the swaps
+* that restore natural order, applied by <code>arm_bitreversal_32()</code>.
+* <code>pTwiddle</code> holds <code>fftLen</code> complex twiddle factors.
+* Radix factors other than 2, 3 and 5 are not supported.
+*/
+void arm_cfft_mixed_radix_f32(
+  const arm_cfft_instance_f32 * S,
+  float32_t * p1)
+{
+   uint32_t fftLen = S->fftLen;
+   uint32_t subLen = fftLen;
+   const float32_t *pCoef = S->pTwiddle;
+
+   while (subLen > 1u)
+   {
+      if ((subLen % 5u) == 0u)
+      {
+         arm_radix5_stage_mixed_f32(p1, fftLen, subLen, pCoef, fftLen / subLen);
+         subLen /= 5u;
+      }
+      else if ((subLen % 3u) == 0u)
+      {
+         arm_radix3_stage_mixed_f32(p1, fftLen, subLen, pCoef, fftLen / subLen);
+         subLen /= 3u;
+      }
+      else if ((subLen % 4u) == 0u)
+      {
+         arm_radix4_stage_mixed_f32(p1, fftLen, subLen, pCoef, fftLen / subLen);
+         subLen /= 4u;
+      }
+      else if ((subLen % 2u) == 0u)
+      {
+         arm_radix2_stage_mixed_f32(p1, fftLen, subLen, pCoef, fftLen / subLen);
+         subLen /= 2u;
+      }
+      else
+      {
+         /* Unsupported radix */
+         break;
+      }
+   }
+}
+
+/**    
+* @} end of ComplexFFT group    
+*/
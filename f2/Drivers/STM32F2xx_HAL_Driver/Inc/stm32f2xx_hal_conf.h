@@ -150,6 +150,7 @@
 #define  PREFETCH_ENABLE                   1U
 #define  INSTRUCTION_CACHE_ENABLE          1U
 #define  DATA_CACHE_ENABLE                 1U
+#define  USE_HAL_TRACE                0U /*!< Record HAL driver events in the trace buffer */
 
 /* ########################## Assert Selection ############################## */
 /**
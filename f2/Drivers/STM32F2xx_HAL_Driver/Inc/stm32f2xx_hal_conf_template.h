@@ -147,9 +147,11 @@
 #define  VDD_VALUE                      3300U /*!< Value of VDD in mv */
 #define  TICK_INT_PRIORITY              0x0FU /*!< tick interrupt priority */
 #define  USE_RTOS                          0U
+/* #define  USE_HAL_LOCK                 HAL_LOCK_NONE */ /* Default: HAL_LOCK_EXCLUSIVE on Cortex-M3/M4/M7, HAL_LOCK_PRIMASK on Cortex-M0/M0+ */
 #define  PREFETCH_ENABLE                   1U
 #define  INSTRUCTION_CACHE_ENABLE          1U
 #define  DATA_CACHE_ENABLE                 1U
+#define  USE_HAL_TRACE                0U /*!< Record HAL driver events in the trace buffer */
 
 /* ########################## Assert Selection ############################## */
 /**
@@ -102,6 +102,7 @@
   * @{
   */
 __IO uint32_t uwTick;
+__IO uint32_t uwHalLockBusy;        /* __HAL_LOCK() calls found the handle locked */
 /**
   * @}
   */
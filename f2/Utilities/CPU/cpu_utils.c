@@ -47,16 +47,39 @@ To use this module, the following steps should be followed :
                                          StartIdleMonitor()
       - #define traceTASK_SWITCHED_OUT() extern void EndIdleMonitor(void); \
                                          EndIdleMonitor()
+
+3- call CPU_ProfileInit() before starting the scheduler: the same hooks then
+   also account the cycles run by each task, interrupt time excluded.
+   Cycles are counted by the DWT cycle counter, or on Cortex-M0/M0+ which
+   have none, derived from the RTOS SysTick.
+
+4- to profile an interrupt, call CPU_ProfileIrqEnter(IRQn) first and
+   CPU_ProfileIrqExit(IRQn) last in its handler.
+
+5- read the statistics with CPU_ProfileGetTask() and CPU_ProfileGetIrq() from
+   a task. The readout does not stop the scheduler nor mask interrupts: it is
+   retried when a run completes while the entry is being copied.
 *******************************************************************************/
 
 
 /* Includes ------------------------------------------------------------------*/
 #include "cpu_utils.h"
+#include <string.h>
 
 /* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  __IO uint32_t      Sequence;  /* Odd while the entry is being updated */
+  uint32_t           Start;     /* Cycle count at the start of the run  */
+  CPU_ProfileTypeDef Data;
+} CPU_ProfileSlotTypeDef;
+
 /* Private define ------------------------------------------------------------*/
 /* Private macro -------------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+static void CPU_ProfileRecord (CPU_ProfileSlotTypeDef *pSlot, uint32_t Cycles);
+static uint32_t CPU_ProfileRead (CPU_ProfileSlotTypeDef *pSlot, CPU_ProfileTypeDef *pProfile);
+
 /* Private variables ---------------------------------------------------------*/
 
 xTaskHandle    xIdleHandle = NULL;
@@ -65,6 +88,15 @@ uint32_t       osCPU_IdleStartTime = 0;
 uint32_t       osCPU_IdleSpentTime = 0; 
 uint32_t       osCPU_TotalIdleTime = 0; 
 
+static CPU_ProfileSlotTypeDef CPU_TaskSlots[CPU_PROFILE_MAX_TASKS];
+static CPU_ProfileSlotTypeDef CPU_IrqSlots[CPU_PROFILE_MAX_IRQS];
+static CPU_ProfileSlotTypeDef *CPU_CurrentTask = NULL;
+static uint32_t       CPU_Profiling = 0;
+static uint32_t       CPU_IrqNesting = 0;
+static uint32_t       CPU_IrqStart = 0;
+static __IO uint32_t  CPU_IrqCycles = 0;
+static uint32_t       CPU_TaskIrqCycles = 0;
+
 /* Private functions ---------------------------------------------------------*/
 /**
   * @brief  Application Idle Hook
@@ -109,10 +141,42 @@ void vApplicationTickHook (void)
   */
 void StartIdleMonitor (void)
 {
+  uint32_t id = (uint32_t)xTaskGetCurrentTaskHandle();
+  uint32_t i;
+
   if( xTaskGetCurrentTaskHandle() == xIdleHandle ) 
   {
     osCPU_IdleStartTime = xTaskGetTickCountFromISR();
   }
+
+  if(CPU_Profiling != 0)
+  {
+    CPU_CurrentTask = NULL;
+
+    /* Find the task entry, or take the first free one */
+    for(i = 0; (i < CPU_PROFILE_MAX_TASKS) && (CPU_CurrentTask == NULL); i++)
+    {
+      if(CPU_TaskSlots[i].Data.Id == id)
+      {
+        CPU_CurrentTask = &CPU_TaskSlots[i];
+      }
+      else if(CPU_TaskSlots[i].Data.Id == 0)
+      {
+        CPU_TaskSlots[i].Sequence++;
+        __DMB();
+        CPU_TaskSlots[i].Data.Id = id;
+        __DMB();
+        CPU_TaskSlots[i].Sequence++;
+        CPU_CurrentTask = &CPU_TaskSlots[i];
+      }
+    }
+
+    if(CPU_CurrentTask != NULL)
+    {
+      CPU_TaskIrqCycles = CPU_IrqCycles;
+      CPU_CurrentTask->Start = CPU_ProfileGetCycles();
+    }
+  }
 }
 
 /**
@@ -128,6 +192,14 @@ void EndIdleMonitor (void)
     osCPU_IdleSpentTime = xTaskGetTickCountFromISR() - osCPU_IdleStartTime;
     osCPU_TotalIdleTime += osCPU_IdleSpentTime; 
   }
+
+  if(CPU_CurrentTask != NULL)
+  {
+    /* Interrupt time spent during the run is not charged to the task */
+    CPU_ProfileRecord(CPU_CurrentTask, (CPU_ProfileGetCycles() - CPU_CurrentTask->Start) -
+                                       (CPU_IrqCycles - CPU_TaskIrqCycles));
+    CPU_CurrentTask = NULL;
+  }
 }
 
 /**
@@ -140,5 +212,238 @@ uint16_t osGetCPUUsage (void)
   return (uint16_t)osCPU_Usage;
 }
 
+/**
+  * @brief  Clear the profiler statistics and start the cycle counter. To be
+  *         called before the scheduler is started.
+  * @param  None
+  * @retval None
+  */
+void CPU_ProfileInit (void)
+{
+  uint32_t i;
+
+  CPU_Profiling = 0;
+  CPU_CurrentTask = NULL;
+
+  for(i = 0; i < CPU_PROFILE_MAX_TASKS; i++)
+  {
+    memset(&CPU_TaskSlots[i], 0, sizeof(CPU_ProfileSlotTypeDef));
+  }
+  for(i = 0; i < CPU_PROFILE_MAX_IRQS; i++)
+  {
+    memset(&CPU_IrqSlots[i], 0, sizeof(CPU_ProfileSlotTypeDef));
+  }
+  CPU_IrqNesting = 0;
+  CPU_IrqCycles = 0;
+
+#if (__CORTEX_M >= 3U)
+  /* Enable the DWT cycle counter */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#if (__CORTEX_M == 7U)
+  DWT->LAR = 0xC5ACCE55U;
+#endif
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+  CPU_Profiling = 1;
+}
+
+/**
+  * @brief  Return the free running cycle count used by the profiler
+  * @note   Cortex-M0/M0+ have no DWT cycle counter: the count is rebuilt from
+  *         the RTOS tick count and the SysTick current value.
+  * @param  None
+  * @retval Cycle count, wrapping at 2^32
+  */
+uint32_t CPU_ProfileGetCycles (void)
+{
+#if (__CORTEX_M >= 3U)
+  return DWT->CYCCNT;
+#else
+  uint32_t reload = SysTick->LOAD + 1U;
+  uint32_t ticks;
+  uint32_t value;
+
+  do
+  {
+    ticks = xTaskGetTickCountFromISR();
+    value = SysTick->VAL;
+  } while(ticks != xTaskGetTickCountFromISR());
+
+  return (ticks * reload) + (reload - 1U - value);
+#endif
+}
+
+/**
+  * @brief  Mark the start of an interrupt handler run
+  * @param  IRQn: interrupt number of the handler
+  * @retval None
+  */
+void CPU_ProfileIrqEnter (IRQn_Type IRQn)
+{
+  uint32_t id = (uint32_t)((int32_t)IRQn + 16);
+  uint32_t now = CPU_ProfileGetCycles();
+  uint32_t primask;
+  uint32_t i;
+
+  if(CPU_Profiling == 0)
+  {
+    return;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if(CPU_IrqNesting++ == 0)
+  {
+    CPU_IrqStart = now;
+  }
+
+  for(i = 0; i < CPU_PROFILE_MAX_IRQS; i++)
+  {
+    if(CPU_IrqSlots[i].Data.Id == 0)
+    {
+      CPU_IrqSlots[i].Sequence++;
+      __DMB();
+      CPU_IrqSlots[i].Data.Id = id;
+      __DMB();
+      CPU_IrqSlots[i].Sequence++;
+    }
+    if(CPU_IrqSlots[i].Data.Id == id)
+    {
+      CPU_IrqSlots[i].Start = now;
+      break;
+    }
+  }
+
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Mark the end of an interrupt handler run
+  * @note   The run includes the time spent in the handlers nested in it.
+  * @param  IRQn: interrupt number of the handler
+  * @retval None
+  */
+void CPU_ProfileIrqExit (IRQn_Type IRQn)
+{
+  uint32_t id = (uint32_t)((int32_t)IRQn + 16);
+  uint32_t now = CPU_ProfileGetCycles();
+  uint32_t primask;
+  uint32_t i;
+
+  if(CPU_Profiling == 0)
+  {
+    return;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if((CPU_IrqNesting != 0) && (--CPU_IrqNesting == 0))
+  {
+    CPU_IrqCycles += now - CPU_IrqStart;
+  }
+
+  for(i = 0; i < CPU_PROFILE_MAX_IRQS; i++)
+  {
+    if(CPU_IrqSlots[i].Data.Id == id)
+    {
+      CPU_ProfileRecord(&CPU_IrqSlots[i], now - CPU_IrqSlots[i].Start);
+      break;
+    }
+  }
+
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Copy the statistics of one task
+  * @param  Index: entry index, from 0 to CPU_PROFILE_MAX_TASKS - 1
+  * @param  pProfile: destination of the statistics
+  * @retval 1 when the entry is in use, 0 otherwise
+  */
+uint32_t CPU_ProfileGetTask (uint32_t Index, CPU_ProfileTypeDef *pProfile)
+{
+  if(Index >= CPU_PROFILE_MAX_TASKS)
+  {
+    return 0;
+  }
+  return CPU_ProfileRead(&CPU_TaskSlots[Index], pProfile);
+}
+
+/**
+  * @brief  Copy the statistics of one interrupt
+  * @param  Index: entry index, from 0 to CPU_PROFILE_MAX_IRQS - 1
+  * @param  pProfile: destination of the statistics
+  * @retval 1 when the entry is in use, 0 otherwise
+  */
+uint32_t CPU_ProfileGetIrq (uint32_t Index, CPU_ProfileTypeDef *pProfile)
+{
+  if(Index >= CPU_PROFILE_MAX_IRQS)
+  {
+    return 0;
+  }
+  return CPU_ProfileRead(&CPU_IrqSlots[Index], pProfile);
+}
+
+/**
+  * @brief  Account one run in a profiler entry
+  * @param  pSlot: profiler entry
+  * @param  Cycles: duration of the run
+  * @retval None
+  */
+static void CPU_ProfileRecord (CPU_ProfileSlotTypeDef *pSlot, uint32_t Cycles)
+{
+  uint32_t scaled = Cycles >> CPU_PROFILE_HIST_SHIFT;
+  uint32_t bin = 0;
+
+  if(scaled != 0)
+  {
+    bin = 32U - __CLZ(scaled);
+    if(bin >= CPU_PROFILE_HIST_BINS)
+    {
+      bin = CPU_PROFILE_HIST_BINS - 1U;
+    }
+  }
+
+  /* Readers retry while the sequence is odd or has changed */
+  pSlot->Sequence++;
+  __DMB();
+  pSlot->Data.Count++;
+  pSlot->Data.Cycles += Cycles;
+  if(Cycles > pSlot->Data.MaxCycles)
+  {
+    pSlot->Data.MaxCycles = Cycles;
+  }
+  pSlot->Data.Histogram[bin]++;
+  __DMB();
+  pSlot->Sequence++;
+}
+
+/**
+  * @brief  Take a consistent copy of a profiler entry
+  * @note   Must not be called from a context that preempts the writer of the
+  *         entry, such as an interrupt of higher priority than the profiled one.
+  * @param  pSlot: profiler entry
+  * @param  pProfile: destination of the copy
+  * @retval 1 when the entry is in use, 0 otherwise
+  */
+static uint32_t CPU_ProfileRead (CPU_ProfileSlotTypeDef *pSlot, CPU_ProfileTypeDef *pProfile)
+{
+  uint32_t sequence;
+
+  do
+  {
+    sequence = pSlot->Sequence;
+    __DMB();
+    *pProfile = pSlot->Data;
+    __DMB();
+  } while(((sequence & 1U) != 0) || (sequence != pSlot->Sequence));
+
+  return (pProfile->Id != 0) ? 1U : 0U;
+}
+
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,137 @@
+/**
+  ******************************************************************************
+  * @file    isr_bench.h
+  * @author  MCD Application Team
+  * @brief   Header for isr_bench module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _ISR_BENCH_H__
+#define _ISR_BENCH_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported constants --------------------------------------------------------*/
+/* Number of interrupt handlers followed. Override in main.h. */
+#if !defined(ISR_BENCH_MAX)
+#define ISR_BENCH_MAX              8U
+#endif
+
+/* Histogram bins. Entry latency bin n counts latencies from
+   n * ISR_BENCH_LATENCY_WIDTH cycles, handler duration bin 0 counts runs
+   shorter than 2^ISR_BENCH_DURATION_SHIFT cycles and bin n runs of
+   2^(ISR_BENCH_DURATION_SHIFT+n-1) cycles or more. The last bins have no
+   upper bound. Override in main.h. */
+#if !defined(ISR_BENCH_BINS)
+#define ISR_BENCH_BINS             16U
+#endif
+#if !defined(ISR_BENCH_LATENCY_WIDTH)
+#define ISR_BENCH_LATENCY_WIDTH    4U
+#endif
+#if !defined(ISR_BENCH_DURATION_SHIFT)
+#define ISR_BENCH_DURATION_SHIFT   5U
+#endif
+
+/* Size of the memory load buffer, in 32-bit words, 32 or more. Override in
+   main.h. */
+#if !defined(ISR_BENCH_LOAD_WORDS)
+#define ISR_BENCH_LOAD_WORDS       256U
+#endif
+
+/* Background load run while the interrupt is taken */
+#define ISR_BENCH_LOAD_NONE        0U   /* Polling loop                              */
+#define ISR_BENCH_LOAD_MEMORY      1U   /* Block copy, multiple load/store in flight */
+#define ISR_BENCH_LOAD_DIVIDE      2U   /* Back to back divisions                    */
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  const char *Name;                          /* Reported name, NULL when unused        */
+  IRQn_Type  IRQn;
+  uint32_t   Count;                          /* Handler runs                           */
+  uint32_t   Triggered;                      /* Runs with a known trigger time         */
+  uint32_t   LatencyMin;                     /* Trigger to handler entry, in cycles    */
+  uint32_t   LatencyMax;
+  uint64_t   LatencySum;
+  uint32_t   DurationMin;                    /* Handler entry to exit, in cycles       */
+  uint32_t   DurationMax;
+  uint64_t   DurationSum;
+  uint32_t   LatencyHist[ISR_BENCH_BINS];
+  uint32_t   DurationHist[ISR_BENCH_BINS];
+} ISR_Bench_StatsTypeDef;
+
+typedef struct
+{
+  uint32_t   Iterations;                     /* Interrupts triggered                   */
+  uint32_t   Load;                           /* ISR_BENCH_LOAD_xxx                     */
+  void       (*pTrigger)(uint32_t Id);       /* Raises the interrupt through its
+                                                peripheral and calls ISR_Bench_Arm()
+                                                right before the register write, NULL:
+                                                the interrupt is pended in the NVIC   */
+  uint32_t   Timeout;                        /* Per interrupt, in ms                   */
+} ISR_Bench_RunTypeDef;
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Free running cycle count: the DWT cycle counter, or the SysTick current
+   value on Cortex-M0/M0+ (down counter, intervals shorter than one tick) */
+#if (__CORTEX_M >= 3U)
+#define ISR_BENCH_TIMESTAMP()      (DWT->CYCCNT)
+#else
+#define ISR_BENCH_TIMESTAMP()      (SysTick->VAL)
+#endif
+
+/* First and last statements of a benchmarked interrupt handler */
+#define ISR_BENCH_ENTER(__ID__)    uint32_t isr_bench_entry = ISR_BENCH_TIMESTAMP()
+#define ISR_BENCH_EXIT(__ID__)     ISR_Bench_Record((__ID__), isr_bench_entry)
+
+/* Exported functions ------------------------------------------------------- */
+void              ISR_Bench_Init(void);
+HAL_StatusTypeDef ISR_Bench_Register(uint32_t Id, const char *Name, IRQn_Type IRQn);
+void              ISR_Bench_Reset(uint32_t Id);
+void              ISR_Bench_Arm(uint32_t Id);
+void              ISR_Bench_Record(uint32_t Id, uint32_t Entry);
+HAL_StatusTypeDef ISR_Bench_Run(uint32_t Id, const ISR_Bench_RunTypeDef *pRun);
+HAL_StatusTypeDef ISR_Bench_GetStats(uint32_t Id, ISR_Bench_StatsTypeDef *pStats);
+uint32_t          ISR_Bench_Report(char *pBuffer, uint32_t Size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _ISR_BENCH_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,105 @@
+/**
+  ******************************************************************************
+  * @file    lcd_push.h
+  * @author  MCD Application Team
+  * @brief   Header for lcd_push module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _LCD_PUSH_H__
+#define _LCD_PUSH_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#if !defined(HAL_DMA_MODULE_ENABLED)
+#error "lcd_push requires the HAL DMA driver (HAL_DMA_MODULE_ENABLED)"
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+/* Controller and bus of the display, kept by reference */
+typedef struct
+{
+  /* Window and memory write command of the controller, e.g.
+     ST7789H2_SetWriteWindow, st7735_SetWriteWindow, ili9341_SetWriteWindow */
+  void                (*SetWriteWindow)(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
+  uint16_t            Width;        /* Display width, in pixels                          */
+  uint16_t            Height;       /* Display height, in pixels                         */
+#if defined(HAL_SPI_MODULE_ENABLED)
+  SPI_HandleTypeDef   *hspi;        /* SPI bus with its Tx DMA, NULL for a parallel bus  */
+#endif
+  GPIO_TypeDef        *pCsPort;     /* SPI chip select, active low                       */
+  uint16_t            CsPin;
+  GPIO_TypeDef        *pDcPort;     /* SPI data/command line, high for data              */
+  uint16_t            DcPin;
+  DMA_HandleTypeDef   *hdma;        /* Parallel bus: memory to memory DMA, half-words    */
+  uint32_t            RamAddress;   /* Parallel bus: FMC address of the data register    */
+} LCD_Push_BusTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Rectangles queued by LCD_Push_AddRect() per frame. Override in main.h. */
+#if !defined(LCD_PUSH_MAX_RECTS)
+#define LCD_PUSH_MAX_RECTS        16U
+#endif
+
+/* Longest wait for the previous strip, in ms. Override in main.h. */
+#if !defined(LCD_PUSH_TIMEOUT)
+#define LCD_PUSH_TIMEOUT          100U
+#endif
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef LCD_Push_Init(const LCD_Push_BusTypeDef *pBus);
+HAL_StatusTypeDef LCD_Push_Rect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height, const uint16_t *pPixels, uint32_t Pitch);
+void              LCD_Push_AddRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
+HAL_StatusTypeDef LCD_Push_Frame(const uint16_t *pFrame, uint32_t Pitch);
+HAL_StatusTypeDef LCD_Push_Begin(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
+HAL_StatusTypeDef LCD_Push_Strip(const uint16_t *pPixels, uint32_t Count);
+uint32_t          LCD_Push_IsBusy(void);
+HAL_StatusTypeDef LCD_Push_Wait(uint32_t Timeout);
+#if defined(HAL_SPI_MODULE_ENABLED)
+void              LCD_Push_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi);
+void              LCD_Push_SPI_ErrorCallback(SPI_HandleTypeDef *hspi);
+#endif
+void              LCD_Push_XferCpltCallback(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _LCD_PUSH_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
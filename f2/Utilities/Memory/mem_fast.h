@@ -0,0 +1,106 @@
+/**
+  ******************************************************************************
+  * @file    mem_fast.h
+  * @author  MCD Application Team
+  * @brief   Header for mem_fast module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _MEM_FAST_H__
+#define _MEM_FAST_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported constants --------------------------------------------------------*/
+/* Set to 1 to offload the large copies to a DMA channel (MDMA on STM32H7)
+   given by MEM_Fast_SetDMA(). Override in main.h. */
+#if !defined(MEM_FAST_USE_DMA)
+#define MEM_FAST_USE_DMA          0U
+#endif
+
+/* Copies of this many bytes or more go to the DMA. Override in main.h. */
+#if !defined(MEM_FAST_DMA_THRESHOLD)
+#define MEM_FAST_DMA_THRESHOLD    2048U
+#endif
+
+/* Longest DMA chunk wait, in ms. Override in main.h. */
+#if !defined(MEM_FAST_DMA_TIMEOUT)
+#define MEM_FAST_DMA_TIMEOUT      100U
+#endif
+
+/* Sizes measured by MEM_Fast_Bench(), each with aligned and misaligned
+   source */
+#define MEM_FAST_BENCH_SIZES      6U
+
+#if (MEM_FAST_USE_DMA == 1U)
+#if defined(HAL_MDMA_MODULE_ENABLED)
+#define MEM_FAST_DMA_HandleTypeDef   MDMA_HandleTypeDef
+#elif defined(HAL_DMA_MODULE_ENABLED)
+#define MEM_FAST_DMA_HandleTypeDef   DMA_HandleTypeDef
+#else
+#error "MEM_FAST_USE_DMA requires the DMA or MDMA HAL driver"
+#endif
+#endif /* MEM_FAST_USE_DMA */
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t  Size;          /* Bytes copied or filled                        */
+  uint32_t  Offset;        /* Source misalignment, in bytes                 */
+  uint32_t  LibCopy;       /* C library memcpy(), in cycles                 */
+  uint32_t  FastCopy;      /* MEM_Fast_Copy(), in cycles                    */
+  uint32_t  LibSet;        /* C library memset(), in cycles                 */
+  uint32_t  FastSet;       /* MEM_Fast_Set(), in cycles                     */
+} MEM_Fast_BenchTypeDef;
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+void     *MEM_Fast_Copy(void *pDst, const void *pSrc, uint32_t Size);
+void     *MEM_Fast_Move(void *pDst, const void *pSrc, uint32_t Size);
+void     *MEM_Fast_Set(void *pDst, uint8_t Value, uint32_t Size);
+#if (MEM_FAST_USE_DMA == 1U)
+void     MEM_Fast_SetDMA(MEM_FAST_DMA_HandleTypeDef *hdma);
+#endif
+uint32_t MEM_Fast_Bench(uint8_t *pBuffer, uint32_t Size, MEM_Fast_BenchTypeDef *pResults);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _MEM_FAST_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -67,6 +67,9 @@
 #define CODEC_STANDARD                0x04
 #define I2S_STANDARD                  I2S_STANDARD_PHILIPS
 
+/* Codec register sequences: delay entry, its Value is the delay in ms */
+#define AUDIO_IO_DELAY                ((uint16_t)0xFFFF)
+
 /**
   * @}
   */
@@ -97,6 +100,18 @@ typedef struct
   * @}
   */
 
+/** @defgroup AUDIO_IO_Register_structure  Audio codec register write structure
+  * @{
+  */
+typedef struct
+{
+  uint16_t  Reg;     /* Codec register address, or AUDIO_IO_DELAY */
+  uint16_t  Value;   /* Value written, or delay in ms after AUDIO_IO_DELAY */
+}AUDIO_IO_RegTypeDef;
+/**
+  * @}
+  */
+
 /**
   * @}
   */
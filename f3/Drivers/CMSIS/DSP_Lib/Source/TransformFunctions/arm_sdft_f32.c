@@ -0,0 +1,151 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_sdft_f32.c    
+*    
+* Description:	Floating-point sliding DFT.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* -------------------------------------------------------------------- */
+
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup SDFT
+ * @{
+ */
+
+/**
+ * @brief Per-sample processing function for the floating-point sliding DFT.
+ * @param[in,out] *S points to an instance of the floating-point sliding DFT structure.
+ * @param[in]     x input sample.
+ * @return none.
+ */
+
+void arm_sdft_sample_f32(
+  arm_sdft_instance_f32 * S,
+  float32_t x)
+{
+  float32_t *pState = S->pState;                 /* bin pointer */
+  const float32_t *pCoeffs = S->pCoeffs;         /* coefficient pointer */
+  float32_t d;                                   /* input difference */
+  float32_t re, im;                              /* bin before rotation */
+  uint32_t numBins = S->numBins;                 /* number of bins */
+  uint32_t i;                                    /* loop counter */
+
+  /* Sample entering the window minus the damped one leaving it */
+  d = x - (S->dampingN * S->pDelay[S->index]);
+  S->pDelay[S->index] = x;
+  S->index = ((S->index + 1u) < S->windowLength) ? (S->index + 1u) : 0u;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  float32_t re1, im1;                            /* second bin before rotation */
+
+  /* Two bins at a time */
+  i = numBins >> 1u;
+  while(i > 0u)
+  {
+    re = pState[0] + d;
+    im = pState[1];
+    re1 = pState[2] + d;
+    im1 = pState[3];
+
+    pState[0] = (pCoeffs[0] * re) - (pCoeffs[1] * im);
+    pState[1] = (pCoeffs[1] * re) + (pCoeffs[0] * im);
+    pState[2] = (pCoeffs[2] * re1) - (pCoeffs[3] * im1);
+    pState[3] = (pCoeffs[3] * re1) + (pCoeffs[2] * im1);
+
+    pState += 4u;
+    pCoeffs += 4u;
+    i--;
+  }
+
+  /* Remaining bin */
+  i = numBins & 1u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  i = numBins;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(i > 0u)
+  {
+    re = pState[0] + d;
+    im = pState[1];
+
+    pState[0] = (pCoeffs[0] * re) - (pCoeffs[1] * im);
+    pState[1] = (pCoeffs[1] * re) + (pCoeffs[0] * im);
+
+    pState += 2u;
+    pCoeffs += 2u;
+    i--;
+  }
+}
+
+/**
+ * @brief Processing function for the floating-point sliding DFT.
+ * @param[in,out] *S points to an instance of the floating-point sliding DFT structure.
+ * @param[in]     *pSrc points to the block of input samples.
+ * @param[in]     blockSize number of samples to process.
+ * @return none.
+ *
+ * The bins of the window ending with the last sample of the block are in the
+ * state buffer on return.
+ */
+
+void arm_sdft_f32(
+  arm_sdft_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize)
+{
+  while(blockSize > 0u)
+  {
+    arm_sdft_sample_f32(S, *pSrc++);
+    blockSize--;
+  }
+}
+
+/**
+ * @} end of SDFT group
+ */
@@ -151,6 +151,17 @@ const uint8_t APBPrescTable[8]  = {0, 0, 0, 0, 1, 2, 3, 4};
   * @{
   */
 
+#if defined(__GNUC__)
+  static void SystemInit_Sections(void);
+
+/* Copy and zero tables emitted by the default linker script template, weak so
+   that they resolve to 0 with linker scripts that do not provide them */
+extern const uint32_t __copy_table_start__[] __attribute__((weak));
+extern const uint32_t __copy_table_end__[] __attribute__((weak));
+extern const uint32_t __zero_table_start__[] __attribute__((weak));
+extern const uint32_t __zero_table_end__[] __attribute__((weak));
+#endif /* __GNUC__ */
+
 /**
   * @}
   */
@@ -202,7 +213,50 @@ void SystemInit(void)
 #else
   SCB->VTOR = FLASH_BASE | VECT_TAB_OFFSET; /* Vector Table Relocation in Internal FLASH */
 #endif
+
+#if defined(__GNUC__)
+  /* Initialize the ITCM, DTCM, CCM RAM and DMA buffer sections --------------*/
+  SystemInit_Sections();
+#endif /* __GNUC__ */
+}
+
+#if defined(__GNUC__)
+/**
+  * @brief  Copy the ITCM code, DTCM and CCM RAM data from FLASH and zero the
+  *         DMA buffers, as listed by the linker script copy and zero tables.
+  * @param  None
+  * @retval None
+  */
+static void SystemInit_Sections(void)
+{
+  const uint32_t *table;
+  const uint32_t *src;
+  uint32_t *dst;
+
+  /* Each copy table entry is {load address, start, end} */
+  for (table = __copy_table_start__; table < __copy_table_end__; table += 3)
+  {
+    src = (const uint32_t *)table[0];
+    for (dst = (uint32_t *)table[1]; dst < (uint32_t *)table[2]; dst++)
+    {
+      *dst = *src++;
+    }
+  }
+
+  /* Each zero table entry is {start, end} */
+  for (table = __zero_table_start__; table < __zero_table_end__; table += 2)
+  {
+    for (dst = (uint32_t *)table[0]; dst < (uint32_t *)table[1]; dst++)
+    {
+      *dst = 0U;
+    }
+  }
+
+  /* Code copied to RAM must be visible to instruction fetches */
+  __DSB();
+  __ISB();
 }
+#endif /* __GNUC__ */
 
 /**
    * @brief  Update SystemCoreClock variable according to Clock Register Values.
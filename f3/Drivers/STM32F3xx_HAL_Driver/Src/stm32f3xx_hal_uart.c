@@ -193,6 +193,7 @@ static void UART_DMATransmitCplt(DMA_HandleTypeDef *hdma);
 static void UART_DMATxHalfCplt(DMA_HandleTypeDef *hdma);
 static void UART_DMAReceiveCplt(DMA_HandleTypeDef *hdma);
 static void UART_DMARxHalfCplt(DMA_HandleTypeDef *hdma);
+static void UART_RxToIdleEvent(UART_HandleTypeDef *huart, HAL_UART_RxEventTypeTypeDef EventType);
 static void UART_DMAError(DMA_HandleTypeDef *hdma);
 static void UART_DMAAbortOnError(DMA_HandleTypeDef *hdma);
 static void UART_DMATxAbortCallback(DMA_HandleTypeDef *hdma);
@@ -841,6 +842,7 @@ HAL_StatusTypeDef HAL_UART_Receive(UART_HandleTypeDef *huart, uint8_t *pData, ui
 
     /* At end of Rx process, restore huart->RxState to Ready */
     huart->RxState = HAL_UART_STATE_READY;
+    huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
 
     /* Process Unlocked */
     __HAL_UNLOCK(huart);
@@ -1191,6 +1193,63 @@ HAL_StatusTypeDef HAL_UART_DMAStop(UART_HandleTypeDef *huart)
   return HAL_OK;
 }
 
+/**
+  * @brief Receive data in DMA mode till either the expected number of data
+  *        is received or an IDLE event occurs.
+  * @note   Reception is reported through HAL_UARTEx_RxEventCallback() on IDLE line
+  *         detection, DMA half transfer and DMA transfer complete events, with the
+  *         offset and length of the newly received data in pData: no data is copied
+  *         and HAL_UART_RxCpltCallback()/HAL_UART_RxHalfCpltCallback() are not called.
+  *         HAL_UARTEx_GetRxEventType() returns the event which triggered the callback.
+  * @note   When the Rx DMA channel is configured in DMA_CIRCULAR mode, pData is used
+  *         as a ring buffer and the reception goes on until HAL_UART_DMAStop() or
+  *         HAL_UART_AbortReceive() is called. Data must be consumed before the DMA
+  *         wraps around and overwrites it.
+  * @note   When the UART parity is enabled (PCE = 1), the received data contain
+  *         the parity bit (MSB position).
+  * @param huart UART handle.
+  * @param pData Pointer to data buffer.
+  * @param Size  Amount of data to be received.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size)
+{
+  HAL_StatusTypeDef status;
+
+  /* Check that a Rx process is not already ongoing */
+  if (huart->RxState == HAL_UART_STATE_READY)
+  {
+    if ((pData == NULL) || (Size == 0U) || (huart->hdmarx == NULL))
+    {
+      return HAL_ERROR;
+    }
+
+    /* Clear a pending IDLE flag before the reception starts */
+    __HAL_UART_CLEAR_IDLEFLAG(huart);
+
+    /* Route the DMA events to the Rx Event callback */
+    huart->ReceptionType = HAL_UART_RECEPTION_TOIDLE;
+    huart->RxEventType   = HAL_UART_RXEVENT_TC;
+    huart->RxEventOffset = 0U;
+
+    status = HAL_UART_Receive_DMA(huart, pData, Size);
+    if (status != HAL_OK)
+    {
+      huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+      return status;
+    }
+
+    /* Enable the UART IDLE line detection interrupt */
+    SET_BIT(huart->Instance->CR1, USART_CR1_IDLEIE);
+
+    return HAL_OK;
+  }
+  else
+  {
+    return HAL_BUSY;
+  }
+}
+
 /**
   * @brief  Abort ongoing transfers (blocking mode).
   * @param  huart UART handle.
@@ -1206,7 +1265,7 @@ HAL_StatusTypeDef HAL_UART_DMAStop(UART_HandleTypeDef *huart)
 HAL_StatusTypeDef HAL_UART_Abort(UART_HandleTypeDef *huart)
 {
   /* Disable TXEIE, TCIE, RXNE, PE and ERR (Frame error, noise error, overrun error) interrupts */
-  CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_PEIE | USART_CR1_TXEIE | USART_CR1_TCIE));
+  CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_IDLEIE | USART_CR1_PEIE | USART_CR1_TXEIE | USART_CR1_TCIE));
   CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE);
 
   /* Disable the UART DMA Tx request if enabled */
@@ -1251,6 +1310,7 @@ HAL_StatusTypeDef HAL_UART_Abort(UART_HandleTypeDef *huart)
   /* Restore huart->gState and huart->RxState to Ready */
   huart->gState  = HAL_UART_STATE_READY;
   huart->RxState = HAL_UART_STATE_READY;
+  huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
 
   /* Reset Handle ErrorCode to No Error */
   huart->ErrorCode = HAL_UART_ERROR_NONE;
@@ -1315,7 +1375,7 @@ HAL_StatusTypeDef HAL_UART_AbortTransmit(UART_HandleTypeDef *huart)
 HAL_StatusTypeDef HAL_UART_AbortReceive(UART_HandleTypeDef *huart)
 {
   /* Disable RXNE, PE and ERR (Frame error, noise error, overrun error) interrupts */
-  CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_PEIE));
+  CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_IDLEIE | USART_CR1_PEIE));
   CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE);
 
   /* Disable the UART DMA Rx request if enabled */
@@ -1342,6 +1402,7 @@ HAL_StatusTypeDef HAL_UART_AbortReceive(UART_HandleTypeDef *huart)
 
   /* Restore huart->RxState to Ready */
   huart->RxState = HAL_UART_STATE_READY;
+  huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
 
   return HAL_OK;
 }
@@ -1365,7 +1426,7 @@ HAL_StatusTypeDef HAL_UART_Abort_IT(UART_HandleTypeDef *huart)
   uint32_t abortcplt = 1U;
   
   /* Disable TXEIE, TCIE, RXNE, PE and ERR (Frame error, noise error, overrun error) interrupts */
-  CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_PEIE | USART_CR1_TXEIE | USART_CR1_TCIE));
+  CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_IDLEIE | USART_CR1_PEIE | USART_CR1_TXEIE | USART_CR1_TCIE));
   CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE);
 
   /* If DMA Tx and/or DMA Rx Handles are associated to UART Handle, DMA Abort complete callbacks should be initialised
@@ -1463,6 +1524,7 @@ HAL_StatusTypeDef HAL_UART_Abort_IT(UART_HandleTypeDef *huart)
     /* Restore huart->gState and huart->RxState to Ready */
     huart->gState  = HAL_UART_STATE_READY;
     huart->RxState = HAL_UART_STATE_READY;
+    huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
 
     /* As no DMA to be aborted, call directly user Abort complete callback */
     HAL_UART_AbortCpltCallback(huart);
@@ -1553,7 +1615,7 @@ HAL_StatusTypeDef HAL_UART_AbortTransmit_IT(UART_HandleTypeDef *huart)
 HAL_StatusTypeDef HAL_UART_AbortReceive_IT(UART_HandleTypeDef *huart)
 {
   /* Disable RXNE, PE and ERR (Frame error, noise error, overrun error) interrupts */
-  CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_PEIE));
+  CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_IDLEIE | USART_CR1_PEIE));
   CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE);
 
   /* Disable the UART DMA Rx request if enabled */
@@ -1585,6 +1647,7 @@ HAL_StatusTypeDef HAL_UART_AbortReceive_IT(UART_HandleTypeDef *huart)
 
       /* Restore huart->RxState to Ready */
       huart->RxState = HAL_UART_STATE_READY;
+      huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
 
       /* As no DMA to be aborted, call directly user Abort complete callback */
       HAL_UART_AbortReceiveCpltCallback(huart);
@@ -1600,6 +1663,7 @@ HAL_StatusTypeDef HAL_UART_AbortReceive_IT(UART_HandleTypeDef *huart)
 
     /* Restore huart->RxState to Ready */
     huart->RxState = HAL_UART_STATE_READY;
+    huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
 
     /* As no DMA to be aborted, call directly user Abort complete callback */
     HAL_UART_AbortReceiveCpltCallback(huart);
@@ -1711,12 +1775,14 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
           }
           else
           {
+            __HAL_TRACE(HAL_TRACE_EVT_UART_ERROR, huart->Instance);
             /* Call user error callback */
             HAL_UART_ErrorCallback(huart);
           }
         }
         else
         {
+          __HAL_TRACE(HAL_TRACE_EVT_UART_ERROR, huart->Instance);
           /* Call user error callback */
           HAL_UART_ErrorCallback(huart);
         }
@@ -1725,6 +1791,7 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
       {
         /* Non Blocking error : transfer could go on. 
            Error is notified to user through user error callback */
+        __HAL_TRACE(HAL_TRACE_EVT_UART_ERROR, huart->Instance);
         HAL_UART_ErrorCallback(huart);
         huart->ErrorCode = HAL_UART_ERROR_NONE;
       }
@@ -1733,6 +1800,17 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
 
   } /* End if some error occurs */
 
+  /* UART IDLE line detected during a reception to idle ----------------------*/
+  if (   (huart->ReceptionType == HAL_UART_RECEPTION_TOIDLE)
+      && ((isrflags & USART_ISR_IDLE) != RESET)
+      && ((cr1its & USART_CR1_IDLEIE) != RESET))
+  {
+    __HAL_UART_CLEAR_IDLEFLAG(huart);
+
+    UART_RxToIdleEvent(huart, HAL_UART_RXEVENT_IDLE);
+    return;
+  }
+
   /* UART wakeup from Stop mode interrupt occurred ---------------------------*/
   if(((isrflags & USART_ISR_WUF) != RESET) && ((cr3its & USART_CR3_WUFIE) != RESET))
   {
@@ -1740,6 +1818,7 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
     /* Set the UART state ready to be able to start again the process */
     huart->gState  = HAL_UART_STATE_READY;
     huart->RxState = HAL_UART_STATE_READY;
+    huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
     HAL_UARTEx_WakeupCallback(huart);
     return;
   }
@@ -1880,6 +1959,25 @@ __weak void HAL_UART_AbortReceiveCpltCallback (UART_HandleTypeDef *huart)
    */
 }
 
+/**
+  * @brief  Reception Event Callback (Rx event notification called after use of advanced reception service).
+  * @param  huart UART handle
+  * @param  Offset Offset in the reception buffer of the first received byte.
+  * @param  Length Number of bytes received from Offset.
+  * @retval None
+  */
+__weak void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Offset, uint16_t Length)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(huart);
+  UNUSED(Offset);
+  UNUSED(Length);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_UARTEx_RxEventCallback can be implemented in the user file.
+   */
+}
+
 /**
   * @}
   */
@@ -2076,6 +2174,18 @@ uint32_t HAL_UART_GetError(UART_HandleTypeDef *huart)
 {
   return huart->ErrorCode;
 }
+
+/**
+  * @brief  Provide the type of the Rx Event which led to the last call of the
+  *         Rx Event callback of a reception to idle.
+  * @param  huart UART handle.
+  * @retval Rx Event Type (returned value will be a value of @ref UART_RxEvent_Type_Values)
+  */
+HAL_UART_RxEventTypeTypeDef HAL_UARTEx_GetRxEventType(UART_HandleTypeDef *huart)
+{
+  /* Return Rx Event type value, as stored in UART handle */
+  return(huart->RxEventType);
+}
 /**
   * @}
   */
@@ -2312,6 +2422,7 @@ HAL_StatusTypeDef UART_CheckIdleState(UART_HandleTypeDef *huart)
   /* Initialize the UART State */
   huart->gState  = HAL_UART_STATE_READY;
   huart->RxState = HAL_UART_STATE_READY;
+  huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
 
   /* Process Unlocked */
   __HAL_UNLOCK(huart);
@@ -2344,6 +2455,7 @@ HAL_StatusTypeDef UART_WaitOnFlagUntilTimeout(UART_HandleTypeDef *huart, uint32_
 
         huart->gState  = HAL_UART_STATE_READY;
         huart->RxState = HAL_UART_STATE_READY;
+        huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
 
         /* Process Unlocked */
         __HAL_UNLOCK(huart);
@@ -2378,11 +2490,12 @@ static void UART_EndTxTransfer(UART_HandleTypeDef *huart)
 static void UART_EndRxTransfer(UART_HandleTypeDef *huart)
 {
   /* Disable RXNE, PE and ERR (Frame error, noise error, overrun error) interrupts */
-  CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_PEIE));
+  CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_IDLEIE | USART_CR1_PEIE));
   CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE);
 
   /* At end of Rx process, restore huart->RxState to Ready */
   huart->RxState = HAL_UART_STATE_READY;
+  huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
 }
 
 
@@ -2449,10 +2562,19 @@ static void UART_DMAReceiveCplt(DMA_HandleTypeDef *hdma)
        in the UART CR3 register */
     CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAR);
 
+    /* Disable the IDLE interrupt of a reception to idle */
+    CLEAR_BIT(huart->Instance->CR1, USART_CR1_IDLEIE);
+
     /* At end of Rx process, restore huart->RxState to Ready */
     huart->RxState = HAL_UART_STATE_READY;
   }
 
+  if (huart->ReceptionType == HAL_UART_RECEPTION_TOIDLE)
+  {
+    UART_RxToIdleEvent(huart, HAL_UART_RXEVENT_TC);
+    return;
+  }
+
   HAL_UART_RxCpltCallback(huart);
 }
 
@@ -2465,9 +2587,62 @@ static void UART_DMARxHalfCplt(DMA_HandleTypeDef *hdma)
 {
   UART_HandleTypeDef* huart = (UART_HandleTypeDef*)(hdma->Parent);
 
+  if (huart->ReceptionType == HAL_UART_RECEPTION_TOIDLE)
+  {
+    UART_RxToIdleEvent(huart, HAL_UART_RXEVENT_HT);
+    return;
+  }
+
   HAL_UART_RxHalfCpltCallback(huart);
 }
 
+/**
+  * @brief  Report the data received since the previous Rx Event of a reception to idle.
+  * @note   The reported window [Offset, Offset + Length) is located in the reception
+  *         buffer: no data is copied. A window wrapping around the end of the
+  *         buffer (DMA circular mode) is reported in two calls of the Rx Event callback.
+  * @param  huart UART handle.
+  * @param  EventType Rx Event that triggered the report (IDLE, HT or TC).
+  * @retval None
+  */
+static void UART_RxToIdleEvent(UART_HandleTypeDef *huart, HAL_UART_RxEventTypeTypeDef EventType)
+{
+  uint16_t head = huart->RxXferSize - (uint16_t)__HAL_DMA_GET_COUNTER(huart->hdmarx);
+  uint16_t tail = huart->RxEventOffset;
+  uint16_t length;
+  uint16_t wrapped = 0U;
+
+  if (head >= tail)
+  {
+    length = head - tail;
+  }
+  else
+  {
+    /* DMA has wrapped around the end of the circular buffer */
+    length  = huart->RxXferSize - tail;
+    wrapped = head;
+  }
+
+  huart->RxEventType   = EventType;
+  huart->RxEventOffset = (head == huart->RxXferSize) ? 0U : head;
+
+  /* Reception over (DMA normal mode) : release the reception type before
+     calling the user, who may start a new reception from the callback */
+  if (huart->RxState == HAL_UART_STATE_READY)
+  {
+    huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+  }
+
+  if (length != 0U)
+  {
+    HAL_UARTEx_RxEventCallback(huart, tail, length);
+  }
+  if (wrapped != 0U)
+  {
+    HAL_UARTEx_RxEventCallback(huart, 0U, wrapped);
+  }
+}
+
 /**
   * @brief DMA UART communication error callback.
   * @param hdma DMA handle.
@@ -2548,6 +2723,7 @@ static void UART_DMATxAbortCallback(DMA_HandleTypeDef *hdma)
   /* Restore huart->gState and huart->RxState to Ready */
   huart->gState  = HAL_UART_STATE_READY;
   huart->RxState = HAL_UART_STATE_READY;
+  huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
 
   /* Call user Abort complete callback */
   HAL_UART_AbortCpltCallback(huart);
@@ -2590,6 +2766,7 @@ static void UART_DMARxAbortCallback(DMA_HandleTypeDef *hdma)
   /* Restore huart->gState and huart->RxState to Ready */
   huart->gState  = HAL_UART_STATE_READY;
   huart->RxState = HAL_UART_STATE_READY;
+  huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
 
   /* Call user Abort complete callback */
   HAL_UART_AbortCpltCallback(huart);
@@ -2636,6 +2813,7 @@ static void UART_DMARxOnlyAbortCallback(DMA_HandleTypeDef *hdma)
 
   /* Restore huart->RxState to Ready */
   huart->RxState = HAL_UART_STATE_READY;
+  huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
 
   /* Call user Abort complete callback */
   HAL_UART_AbortReceiveCpltCallback(huart);
@@ -2745,6 +2923,7 @@ HAL_StatusTypeDef UART_Receive_IT(UART_HandleTypeDef *huart)
 
       /* Rx process is completed, restore huart->RxState to Ready */
       huart->RxState = HAL_UART_STATE_READY;
+      huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
 
       HAL_UART_RxCpltCallback(huart);
 
@@ -0,0 +1,454 @@
+/**
+  ******************************************************************************
+  * @file    sdadc_stream.c
+  * @author  MCD Application Team
+  * @brief   Synchronous multi SDADC streaming into per channel blocks with gain
+  *          and offset correction
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- initialize SDADC1, and SDADC2 and/or SDADC3, with HAL_SDADC_Init()
+   (SDADC1 first, it sets the reference), set their channel configurations
+   with HAL_SDADC_PrepareChannelConfig() and HAL_SDADC_AssociateChannelConfig()
+   and run HAL_SDADC_CalibrationStart(). Link a circular DMA channel to each
+   SDADC (DMA2 channels 3, 4 and 5), half-word transfers, all at the same
+   priority, and call HAL_DMA_IRQHandler() from their interrupt handlers:
+   this module implements HAL_SDADC_InjectedConvHalfCpltCallback(),
+   HAL_SDADC_InjectedConvCpltCallback() and HAL_SDADC_ErrorCallback() in
+   their place. For a fixed sample rate, select the SDADC1 trigger (timer
+   compare or TRGO) with HAL_SDADC_SelectInjectedExtTrigger() and use
+   SDADC_EXTERNAL_TRIGGER.
+
+2- SDADC_Stream_Init() sets the injected group of each SDADC, the same
+   number of channels on each, and synchronizes SDADC2 and SDADC3 on the
+   injected conversions of SDADC1: conversion k of every SDADC is sampled
+   at the same time. Channel c of the stream is the c-th injected channel
+   in SDADC order, ascending channel numbers within an SDADC: with 3
+   channels per SDADC, channels 0 to 2 are SDADC1, 3 to 5 SDADC2...
+
+3- SDADC_Stream_Start() starts the DMA rings, SDADC2 and SDADC3 then
+   SDADC1. The DMA can only move one SDADC per channel (JDATA12R and
+   JDATA13R pair SDADC1 with a single other SDADC), so each SDADC fills
+   its own ring with the same timing. Every half ring (BlockSize
+   sequences), when the DMA of the last SDADC completes it, the three rings
+   are de-interleaved into one block per channel and
+   SDADC_Stream_BlockCallback() gets the blocks: channel c at
+   pBlocks[c * Length]. Blocks stay valid until the next callback.
+
+4- calibration: with pCalib, each channel block is corrected in one pass
+   after the de-interleaving: offset removed, then scaled, saturated to
+   16 bits. SDADC_Stream_SetCalib() computes the entry of a channel from
+   two measures, or fill the table from a stored calibration. With
+   SDADC_STREAM_USE_CMSIS_DSP defined in main.h, the pass runs the
+   CMSIS-DSP arm_offset_q15() and arm_scale_q15() kernels, dual 16-bit
+   SIMD on the Cortex-M4, otherwise a plain loop with the same results.
+
+5- Overruns counts the half rings the DMA started rewriting before their
+   processing ended: the blocks delivered then mix two periods.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "sdadc_stream.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Injected channel bits of SDADC_CHANNEL_x */
+#define SDADC_STREAM_CHANNEL_MASK  0x000001FFU
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static SDADC_StreamTypeDef *SdadcStream;
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t SDADC_Stream_Index(SDADC_StreamTypeDef *pStream, SDADC_HandleTypeDef *hsdadc);
+static void     SDADC_Stream_Process(SDADC_StreamTypeDef *pStream, uint32_t Half);
+static void     SDADC_Stream_Correct(const SDADC_Stream_CalibTypeDef *pCalib, int16_t *pData, uint32_t Length);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Set up the injected groups and their synchronization
+  * @param  pStream: engine context, kept by the module
+  * @param  pConfig: SDADCs, rings and blocks, copied
+  * @retval HAL status
+  */
+HAL_StatusTypeDef SDADC_Stream_Init(SDADC_StreamTypeDef *pStream, const SDADC_Stream_ConfigTypeDef *pConfig)
+{
+  SDADC_HandleTypeDef *hsdadc;
+  uint32_t continuous;
+  uint32_t i;
+
+  if ((pStream == NULL) || (pConfig == NULL) || (pConfig->hsdadc[0] == NULL) ||
+      (pConfig->hsdadc[0]->Instance != SDADC1) ||
+      ((pConfig->Trigger != SDADC_SOFTWARE_TRIGGER) && (pConfig->Trigger != SDADC_EXTERNAL_TRIGGER)) ||
+      (pConfig->BlockSize == 0U) || (pConfig->pOut == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  memset(pStream, 0, sizeof(SDADC_StreamTypeDef));
+  pStream->Config = *pConfig;
+
+  /* Continuous conversions when SDADC1 is started by software only, the
+     synchronized SDADCs follow the same mode */
+  continuous = (pConfig->Trigger == SDADC_SOFTWARE_TRIGGER) ? SDADC_CONTINUOUS_CONV_ON : SDADC_CONTINUOUS_CONV_OFF;
+
+  for (i = 0U; i < SDADC_STREAM_MAX_SDADC; i++)
+  {
+    hsdadc = pConfig->hsdadc[i];
+    if (hsdadc == NULL)
+    {
+      continue;
+    }
+    if ((hsdadc->hdma == NULL) || (hsdadc->hdma->Init.Mode != DMA_CIRCULAR) ||
+        (hsdadc->hdma->Init.PeriphDataAlignment != DMA_PDATAALIGN_HALFWORD) ||
+        (pConfig->pRing[i] == NULL) || ((pConfig->Channels[i] & SDADC_STREAM_CHANNEL_MASK) == 0U))
+    {
+      return HAL_ERROR;
+    }
+    if ((HAL_SDADC_InjectedConfigChannel(hsdadc, pConfig->Channels[i], continuous) != HAL_OK) ||
+        (HAL_SDADC_SelectInjectedTrigger(hsdadc, (i == 0U) ? pConfig->Trigger : SDADC_SYNCHRONOUS_TRIGGER) != HAL_OK))
+    {
+      return HAL_ERROR;
+    }
+
+    /* Same sequence length on all the SDADCs keeps their samples aligned */
+    if (pStream->NbSdadc == 0U)
+    {
+      pStream->SeqLength = hsdadc->InjectedChannelsNbr;
+    }
+    else if (hsdadc->InjectedChannelsNbr != pStream->SeqLength)
+    {
+      return HAL_ERROR;
+    }
+    pStream->NbSdadc++;
+    pStream->Last = i;
+  }
+
+  pStream->NbChannels = pStream->NbSdadc * pStream->SeqLength;
+  pStream->RingLength = 2U * pConfig->BlockSize * pStream->SeqLength;
+  if (pStream->RingLength > 0xFFFFU)
+  {
+    return HAL_ERROR;
+  }
+
+  SdadcStream = pStream;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Start the DMA rings and the conversions, SDADC1 last
+  * @param  pStream: engine context
+  * @retval HAL status
+  */
+HAL_StatusTypeDef SDADC_Stream_Start(SDADC_StreamTypeDef *pStream)
+{
+  uint32_t i;
+
+  /* Synchronized SDADCs wait for the first injected conversion of SDADC1 */
+  for (i = SDADC_STREAM_MAX_SDADC - 1U; i > 0U; i--)
+  {
+    if ((pStream->Config.hsdadc[i] != NULL) &&
+        (HAL_SDADC_InjectedStart_DMA(pStream->Config.hsdadc[i], (uint32_t *)pStream->Config.pRing[i],
+                                     pStream->RingLength) != HAL_OK))
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  return HAL_SDADC_InjectedStart_DMA(pStream->Config.hsdadc[0], (uint32_t *)pStream->Config.pRing[0],
+                                     pStream->RingLength);
+}
+
+/**
+  * @brief  Stop the conversions and the DMA rings, SDADC1 first
+  * @param  pStream: engine context
+  * @retval HAL status
+  */
+HAL_StatusTypeDef SDADC_Stream_Stop(SDADC_StreamTypeDef *pStream)
+{
+  HAL_StatusTypeDef status;
+  uint32_t i;
+
+  status = HAL_SDADC_InjectedStop_DMA(pStream->Config.hsdadc[0]);
+  for (i = 1U; i < SDADC_STREAM_MAX_SDADC; i++)
+  {
+    if ((pStream->Config.hsdadc[i] != NULL) && (HAL_SDADC_InjectedStop_DMA(pStream->Config.hsdadc[i]) != HAL_OK))
+    {
+      status = HAL_ERROR;
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Two point calibration of a channel
+  * @param  pStream: engine context, pCalib set
+  * @param  Channel: channel of the stream
+  * @param  RawZero: raw code measured with a zero input
+  * @param  RawRef: raw code measured with the reference input
+  * @param  Ref: output expected for the reference input, q15
+  * @retval HAL_OK, or HAL_ERROR when the gain is out of the q15 range
+  */
+HAL_StatusTypeDef SDADC_Stream_SetCalib(SDADC_StreamTypeDef *pStream, uint32_t Channel,
+                                        int32_t RawZero, int32_t RawRef, int32_t Ref)
+{
+  SDADC_Stream_CalibTypeDef *pcalib;
+  int64_t num = (Ref < 0) ? -(int64_t)Ref : (int64_t)Ref;
+  int64_t den = (int64_t)RawRef - (int64_t)RawZero;
+  int64_t scale;
+  int32_t shift = 0;
+
+  if ((pStream->Config.pCalib == NULL) || (Channel >= pStream->NbChannels) || (den == 0) || (num == 0) ||
+      (RawZero <= -32768) || (RawZero > 32767))
+  {
+    return HAL_ERROR;
+  }
+  if (den < 0)
+  {
+    den = -den;
+  }
+
+  /* Gain = Scale * 2^Shift, Scale in [0.5, 1) for the best resolution */
+  scale = (num << 15) / den;
+  while (scale > 32767)
+  {
+    shift++;
+    scale = (num << 15) / (den << shift);
+  }
+  while ((scale < 16384) && (shift > -15))
+  {
+    shift--;
+    scale = (num << (15 - shift)) / den;
+  }
+  if ((shift > 15) || (scale == 0))
+  {
+    return HAL_ERROR;
+  }
+  if ((Ref < 0) != (((int64_t)RawRef - (int64_t)RawZero) < 0))
+  {
+    scale = -scale;
+  }
+
+  pcalib = &pStream->Config.pCalib[Channel];
+  pcalib->Offset = (int16_t)RawZero;
+  pcalib->Scale  = (int16_t)scale;
+  pcalib->Shift  = (int8_t)shift;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Blocks of a half ring ready
+  * @param  pStream: engine context
+  * @param  pBlocks: channel c at pBlocks[c * Length]
+  * @param  Length: samples per channel
+  * @retval None
+  */
+__weak void SDADC_Stream_BlockCallback(SDADC_StreamTypeDef *pStream, const int16_t *pBlocks, uint32_t Length)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(pStream);
+  UNUSED(pBlocks);
+  UNUSED(Length);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the SDADC_Stream_BlockCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  SDADC overrun or DMA error, the acquisition may have stopped
+  * @param  pStream: engine context
+  * @retval None
+  */
+__weak void SDADC_Stream_ErrorCallback(SDADC_StreamTypeDef *pStream)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(pStream);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the SDADC_Stream_ErrorCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  First half of a ring filled
+  * @param  hsdadc: SDADC handle
+  * @retval None
+  */
+void HAL_SDADC_InjectedConvHalfCpltCallback(SDADC_HandleTypeDef *hsdadc)
+{
+  if ((SdadcStream != NULL) && (SDADC_Stream_Index(SdadcStream, hsdadc) == SdadcStream->Last))
+  {
+    SDADC_Stream_Process(SdadcStream, 0U);
+  }
+}
+
+/**
+  * @brief  Second half of a ring filled
+  * @param  hsdadc: SDADC handle
+  * @retval None
+  */
+void HAL_SDADC_InjectedConvCpltCallback(SDADC_HandleTypeDef *hsdadc)
+{
+  if ((SdadcStream != NULL) && (SDADC_Stream_Index(SdadcStream, hsdadc) == SdadcStream->Last))
+  {
+    SDADC_Stream_Process(SdadcStream, 1U);
+  }
+}
+
+/**
+  * @brief  SDADC or DMA error
+  * @param  hsdadc: SDADC handle
+  * @retval None
+  */
+void HAL_SDADC_ErrorCallback(SDADC_HandleTypeDef *hsdadc)
+{
+  if ((SdadcStream != NULL) && (SDADC_Stream_Index(SdadcStream, hsdadc) < SDADC_STREAM_MAX_SDADC))
+  {
+    SdadcStream->Errors++;
+    SDADC_Stream_ErrorCallback(SdadcStream);
+  }
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  SDADC of the stream
+  * @param  pStream: engine context
+  * @param  hsdadc: SDADC handle
+  * @retval Index in the configuration, SDADC_STREAM_MAX_SDADC when not used
+  */
+static uint32_t SDADC_Stream_Index(SDADC_StreamTypeDef *pStream, SDADC_HandleTypeDef *hsdadc)
+{
+  uint32_t i;
+
+  for (i = 0U; i < SDADC_STREAM_MAX_SDADC; i++)
+  {
+    if (pStream->Config.hsdadc[i] == hsdadc)
+    {
+      return i;
+    }
+  }
+
+  return SDADC_STREAM_MAX_SDADC;
+}
+
+/**
+  * @brief  De-interleave a half ring of each SDADC into the channel blocks,
+  *         then correct them
+  * @param  pStream: engine context
+  * @param  Half: 0 first half, 1 second half
+  * @retval None
+  */
+static void SDADC_Stream_Process(SDADC_StreamTypeDef *pStream, uint32_t Half)
+{
+  const uint32_t stride = pStream->SeqLength;
+  const uint32_t length = pStream->Config.BlockSize;
+  const int16_t *pSrc;
+  int16_t *pDst = pStream->Config.pOut;
+  uint32_t remaining;
+  uint32_t channel = 0U;
+  uint32_t sdadc;
+  uint32_t rank;
+  uint32_t i;
+
+  for (sdadc = 0U; sdadc < SDADC_STREAM_MAX_SDADC; sdadc++)
+  {
+    if (pStream->Config.hsdadc[sdadc] == NULL)
+    {
+      continue;
+    }
+    for (rank = 0U; rank < stride; rank++)
+    {
+      pSrc = &pStream->Config.pRing[sdadc][(Half * length * stride) + rank];
+      for (i = 0U; i < length; i++)
+      {
+        pDst[i] = *pSrc;
+        pSrc += stride;
+      }
+      if (pStream->Config.pCalib != NULL)
+      {
+        SDADC_Stream_Correct(&pStream->Config.pCalib[channel], pDst, length);
+      }
+      pDst += length;
+      channel++;
+    }
+  }
+
+  /* The DMA of SDADC1, the first served, must still be in the other half */
+  remaining = __HAL_DMA_GET_COUNTER(pStream->Config.hsdadc[0]->hdma);
+  if ((Half == 0U) ? (remaining > (pStream->RingLength / 2U)) : (remaining <= (pStream->RingLength / 2U)))
+  {
+    pStream->Overruns++;
+  }
+
+  pStream->Blocks++;
+  SDADC_Stream_BlockCallback(pStream, pStream->Config.pOut, length);
+}
+
+/**
+  * @brief  Offset and gain correction of a channel block, in place
+  * @param  pCalib: channel calibration
+  * @param  pData: samples
+  * @param  Length: samples in the block
+  * @retval None
+  */
+static void SDADC_Stream_Correct(const SDADC_Stream_CalibTypeDef *pCalib, int16_t *pData, uint32_t Length)
+{
+#if defined(SDADC_STREAM_USE_CMSIS_DSP)
+  arm_offset_q15(pData, (q15_t)__SSAT(-(int32_t)pCalib->Offset, 16), pData, Length);
+  arm_scale_q15(pData, pCalib->Scale, pCalib->Shift, pData, Length);
+#else
+  const int32_t offset = pCalib->Offset;
+  const int32_t scale = pCalib->Scale;
+  const uint32_t shift = 15U - (uint32_t)(int32_t)pCalib->Shift;
+  int32_t value;
+  uint32_t i;
+
+  for (i = 0U; i < Length; i++)
+  {
+    value = __SSAT((int32_t)pData[i] - offset, 16);
+    pData[i] = (int16_t)__SSAT((value * scale) >> shift, 16);
+  }
+#endif
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,113 @@
+/**
+  ******************************************************************************
+  * @file    sdadc_stream.h
+  * @author  MCD Application Team
+  * @brief   Header for sdadc_stream module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _SDADC_STREAM_H__
+#define _SDADC_STREAM_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#if !defined(HAL_SDADC_MODULE_ENABLED) || !defined(HAL_DMA_MODULE_ENABLED)
+#error "sdadc_stream requires the HAL SDADC and DMA drivers"
+#endif
+
+#if defined(SDADC_STREAM_USE_CMSIS_DSP)
+#include "arm_math.h"
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+#define SDADC_STREAM_MAX_SDADC        3U
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  int16_t   Offset;           /* Raw code of a zero input, subtracted first          */
+  int16_t   Scale;            /* Gain fraction in q15                                */
+  int8_t    Shift;            /* Gain = Scale * 2^Shift, as arm_scale_q15()          */
+} SDADC_Stream_CalibTypeDef;
+
+typedef struct
+{
+  SDADC_HandleTypeDef        *hsdadc[SDADC_STREAM_MAX_SDADC];   /* SDADC1 to SDADC3: HAL_SDADC_Init(), channel
+                                                                   configurations and calibration done, circular
+                                                                   half-word DMA. SDADC1 required, NULL: unused */
+  uint32_t                   Channels[SDADC_STREAM_MAX_SDADC];  /* Injected channels of each SDADC, SDADC_CHANNEL_x
+                                                                   ORed, the same count on each SDADC          */
+  uint32_t                   Trigger;     /* SDADC1: SDADC_SOFTWARE_TRIGGER, continuous, or SDADC_EXTERNAL_TRIGGER,
+                                             one sequence per trigger of HAL_SDADC_SelectInjectedExtTrigger()    */
+  int16_t                    *pRing[SDADC_STREAM_MAX_SDADC];    /* DMA ring of each SDADC used:
+                                                                   2 * BlockSize * channels half-words         */
+  uint32_t                   BlockSize;   /* Sequences per half ring                                            */
+  int16_t                    *pOut;       /* Channel blocks: channels * BlockSize                               */
+  SDADC_Stream_CalibTypeDef  *pCalib;     /* One per channel, applied to the blocks, NULL: raw codes            */
+} SDADC_Stream_ConfigTypeDef;
+
+typedef struct
+{
+  SDADC_Stream_ConfigTypeDef Config;
+  uint32_t                   NbSdadc;     /* SDADCs converting synchronously                                    */
+  uint32_t                   NbChannels;  /* Channels of all the SDADCs                                         */
+  uint32_t                   SeqLength;   /* Injected channels of each SDADC                                    */
+  uint32_t                   RingLength;  /* DMA transfers in each ring                                         */
+  uint32_t                   Last;        /* Index of the last SDADC used, its DMA ends the half rings          */
+  uint32_t                   Blocks;      /* Blocks delivered                                                   */
+  uint32_t                   Overruns;    /* Half rings rewritten by the DMA while processed                    */
+  uint32_t                   Errors;      /* SDADC or DMA errors                                                */
+} SDADC_StreamTypeDef;
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef SDADC_Stream_Init(SDADC_StreamTypeDef *pStream, const SDADC_Stream_ConfigTypeDef *pConfig);
+HAL_StatusTypeDef SDADC_Stream_Start(SDADC_StreamTypeDef *pStream);
+HAL_StatusTypeDef SDADC_Stream_Stop(SDADC_StreamTypeDef *pStream);
+HAL_StatusTypeDef SDADC_Stream_SetCalib(SDADC_StreamTypeDef *pStream, uint32_t Channel,
+                                        int32_t RawZero, int32_t RawRef, int32_t Ref);
+
+void SDADC_Stream_BlockCallback(SDADC_StreamTypeDef *pStream, const int16_t *pBlocks, uint32_t Length);
+void SDADC_Stream_ErrorCallback(SDADC_StreamTypeDef *pStream);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _SDADC_STREAM_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
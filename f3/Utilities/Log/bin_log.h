@@ -0,0 +1,197 @@
+/**
+  ******************************************************************************
+  * @file    bin_log.h
+  * @author  MCD Application Team
+  * @brief   Header for bin_log module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _BIN_LOG_H__
+#define _BIN_LOG_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported constants --------------------------------------------------------*/
+/* Levels, kept when not above BIN_LOG_LEVEL */
+#define BIN_LOG_LEVEL_ERR        1U
+#define BIN_LOG_LEVEL_USR        2U
+#define BIN_LOG_LEVEL_DBG        3U
+
+/* Most verbose level built. Override in main.h. */
+#if !defined(BIN_LOG_LEVEL)
+#define BIN_LOG_LEVEL            BIN_LOG_LEVEL_DBG
+#endif
+
+/* Words of the ring, a power of 2. Override in main.h. */
+#if !defined(BIN_LOG_BUFFER_SIZE)
+#define BIN_LOG_BUFFER_SIZE      256U
+#endif
+
+/* Section of the format strings: not loaded by default, read from the ELF
+   file by the host decoder. Override in main.h. */
+#if !defined(BIN_LOG_SECTION)
+#define BIN_LOG_SECTION          ".binlog_fmt"
+#endif
+
+/* 1: on-device formatter for lcd_log or a text console, the format strings
+   must then be linked in the flash. Override in main.h. */
+#if !defined(BIN_LOG_FORMAT)
+#define BIN_LOG_FORMAT           0
+#endif
+
+/* 1: BIN_Log_LCD_Process() prints the records with lcd_log. Override in
+   main.h. */
+#if !defined(BIN_LOG_LCD)
+#define BIN_LOG_LCD              0
+#endif
+
+/* Bytes of the UART transmit buffer, a multiple of 32. Override in main.h. */
+#if !defined(BIN_LOG_UART_TX_SIZE)
+#define BIN_LOG_UART_TX_SIZE     128U
+#endif
+
+/* Record time stamp: CPU cycles on the Cortex-M3/M4/M7, HAL ticks on the
+   Cortex-M0/M0+. Override in main.h. */
+#if !defined(BIN_LOG_TIMESTAMP)
+#if (__CORTEX_M >= 3U)
+#define BIN_LOG_TIMESTAMP()      (DWT->CYCCNT)
+#else
+#define BIN_LOG_TIMESTAMP()      HAL_GetTick()
+#endif
+#endif
+
+/* Most arguments of a record */
+#define BIN_LOG_MAX_ARGS         8U
+
+/* Record header word: sync bits 31..26, level bits 25..24, number of
+   arguments bits 23..20, format identifier bits 19..0. The header is
+   followed by the time stamp and the arguments, one word each. */
+#define BIN_LOG_SYNC             0xA4000000U
+#define BIN_LOG_SYNC_MASK        0xFC000000U
+#define BIN_LOG_ID_MASK          0x000FFFFFU
+
+/* Identifier of the record inserted by the readers after dropped records,
+   its argument being the number of records dropped */
+#define BIN_LOG_ID_DROPPED       BIN_LOG_ID_MASK
+
+/* Exported macro ------------------------------------------------------------*/
+#define BIN_LOG_HEADER(__LEVEL__, __NARGS__, __ID__)  (BIN_LOG_SYNC | ((uint32_t)(__LEVEL__) << 24) | \
+                                                      ((uint32_t)(__NARGS__) << 20) | ((__ID__) & BIN_LOG_ID_MASK))
+#define BIN_LOG_HEADER_LEVEL(__HEADER__)   (((__HEADER__) >> 24) & 3U)
+#define BIN_LOG_HEADER_NARGS(__HEADER__)   (((__HEADER__) >> 20) & 15U)
+#define BIN_LOG_HEADER_ID(__HEADER__)      ((__HEADER__) & BIN_LOG_ID_MASK)
+
+/* Number of arguments after the format string, 0 to 8 */
+#define BIN_LOG_NARGS(...)       BIN_LOG_NARGS_(__VA_ARGS__, 8, 7, 6, 5, 4, 3, 2, 1, 0, 0)
+#define BIN_LOG_NARGS_(_f, _1, _2, _3, _4, _5, _6, _7, _8, __N__, ...)  __N__
+#define BIN_LOG_FORMAT_OF(_f, ...)  _f
+
+/* Arguments after the format string, converted to words */
+#define BIN_LOG_W(__X__)         ((uint32_t)(__X__))
+#define BIN_LOG_ARGS_0(_f)
+#define BIN_LOG_ARGS_1(_f, a)                      , BIN_LOG_W(a)
+#define BIN_LOG_ARGS_2(_f, a, b)                   BIN_LOG_ARGS_1(_f, a), BIN_LOG_W(b)
+#define BIN_LOG_ARGS_3(_f, a, b, c)                BIN_LOG_ARGS_2(_f, a, b), BIN_LOG_W(c)
+#define BIN_LOG_ARGS_4(_f, a, b, c, d)             BIN_LOG_ARGS_3(_f, a, b, c), BIN_LOG_W(d)
+#define BIN_LOG_ARGS_5(_f, a, b, c, d, e)          BIN_LOG_ARGS_4(_f, a, b, c, d), BIN_LOG_W(e)
+#define BIN_LOG_ARGS_6(_f, a, b, c, d, e, f)       BIN_LOG_ARGS_5(_f, a, b, c, d, e), BIN_LOG_W(f)
+#define BIN_LOG_ARGS_7(_f, a, b, c, d, e, f, g)    BIN_LOG_ARGS_6(_f, a, b, c, d, e, f), BIN_LOG_W(g)
+#define BIN_LOG_ARGS_8(_f, a, b, c, d, e, f, g, h) BIN_LOG_ARGS_7(_f, a, b, c, d, e, f, g), BIN_LOG_W(h)
+#define BIN_LOG_ARGS(__N__, ...)   BIN_LOG_ARGS__(__N__, __VA_ARGS__)
+#define BIN_LOG_ARGS__(__N__, ...) BIN_LOG_ARGS_##__N__(__VA_ARGS__)
+
+/* Record a message, the format string first: it is kept in BIN_LOG_SECTION,
+   only its identifier and the arguments are written. Arguments are integers,
+   characters, pointers, or floats given with BIN_LOG_FLOAT(). */
+#define BIN_LOG(__LEVEL__, ...)                                                                 \
+  do {                                                                                          \
+    if ((__LEVEL__) <= BIN_LOG_LEVEL)                                                           \
+    {                                                                                           \
+      static const char binlog_format[] __attribute__((section(BIN_LOG_SECTION), aligned(4))) = \
+        BIN_LOG_FORMAT_OF(__VA_ARGS__, 0);                                                      \
+      BIN_Log_Write((__LEVEL__), binlog_format, BIN_LOG_NARGS(__VA_ARGS__)                      \
+                    BIN_LOG_ARGS(BIN_LOG_NARGS(__VA_ARGS__), __VA_ARGS__));                     \
+    }                                                                                           \
+  } while (0)
+
+#define BIN_ErrLog(...)          BIN_LOG(BIN_LOG_LEVEL_ERR, __VA_ARGS__)
+#define BIN_UsrLog(...)          BIN_LOG(BIN_LOG_LEVEL_USR, __VA_ARGS__)
+#define BIN_DbgLog(...)          BIN_LOG(BIN_LOG_LEVEL_DBG, __VA_ARGS__)
+
+/* Float argument of a %f conversion */
+#define BIN_LOG_FLOAT(__X__)     BIN_Log_Float(__X__)
+
+/* Exported functions ------------------------------------------------------- */
+void     BIN_Log_Init(void);
+void     BIN_Log_Write(uint32_t Level, const char *pFormat, uint32_t ArgNbr, ...);
+uint32_t BIN_Log_Read(uint8_t *pData, uint32_t Size);
+uint32_t BIN_Log_GetDropped(void);
+
+#if defined(HAL_UART_MODULE_ENABLED)
+void     BIN_Log_UART_Process(UART_HandleTypeDef *huart);
+#endif
+
+#if (__CORTEX_M >= 3U)
+uint32_t BIN_Log_FlushITM(uint32_t Port);
+#endif
+
+#if (BIN_LOG_FORMAT == 1)
+uint32_t BIN_Log_Format(char *pBuffer, uint32_t Size, uint32_t *pLevel);
+#endif
+
+#if (BIN_LOG_LCD == 1)
+void     BIN_Log_LCD_Process(void);
+#endif
+
+static inline uint32_t BIN_Log_Float(float Value)
+{
+  union
+  {
+    float    f;
+    uint32_t w;
+  } bits;
+
+  bits.f = Value;
+  return bits.w;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _BIN_LOG_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,431 @@
+/**
+  ******************************************************************************
+  * @file    hrtim_loop.c
+  * @author  MCD Application Team
+  * @brief   HRTIM digital power control loop: ADC trigger, injected conversion,
+  *          2P2Z or PID compensator and compare update, with a latency benchmark.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- initialize the HRTIM (timer, outputs, compare units) and the ADC with
+   its injected sequence: rank 1 measures the feedback, external trigger on
+   the HRTIM ADC trigger given in AdcTrigger (ADC_EXTERNALTRIGINJECCONV_HRTIM_TRGx),
+   injected end of sequence interrupt. Call HRTIM_Loop_Init(): it sets the
+   ADC trigger compare and the HRTIM ADC trigger. Set the compensator with
+   HRTIM_Loop_PIDInit() or HRTIM_Loop_2P2ZInit(), output range within
+   [0, 1] (the duty cycle).
+
+2- call HRTIM_Loop_IRQHandler() from the ADC interrupt handler, in place of
+   HAL_ADC_IRQHandler(), at the highest interrupt priority. It reads the
+   injected data, clears the flags, runs the compensator and writes the
+   compare value, with no HAL layer in between: at 500 kHz the whole loop
+   has 144 CPU cycles on a 72 MHz STM32F334.
+
+3- HRTIM_Loop_Start() starts the injected conversions, then start the
+   HRTIM counter and outputs (HAL_HRTIM_WaveformCounterStart(),
+   HAL_HRTIM_WaveformOutputStart()) with the soft start of the application.
+   The compare update is preloaded by the HRTIM: a new duty cycle applies
+   from the next period.
+
+4- BurstDma: the loop writes the compare value to memory and the HRTIM
+   burst DMA copies it to the compare register on the timer DMA request
+   (DMARequests of the timer, DMA handle linked to the HRTIM handle, circular
+   mode, word transfers). The write then lands at a fixed point of the
+   period, whatever the interrupt latency.
+
+5- define HRTIM_LOOP_FASTCODE in main.h to place the loop code in the CCM
+   RAM: no flash wait states in the loop.
+   With HRTIM_LOOP_USE_CMSIS_DSP defined, HRTIM_Loop_PIDInit() takes its
+   coefficients from arm_pid_init_f32().
+
+6- HRTIM_Loop_Benchmark() reports the compensator cost, the longest loop
+   interrupt and the longest delay from the ADC trigger to the compare
+   write, measured while running, and the loop rate the CPU sustains.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "hrtim_loop.h"
+#include <string.h>
+#if defined(HRTIM_LOOP_USE_CMSIS_DSP)
+#include "arm_math.h"
+#endif
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Exception entry and return, FPU context included */
+#define HRTIM_LOOP_IRQ_OVERHEAD  24U
+
+#define HRTIM_LOOP_BENCH_STEPS   32U
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static __IO uint32_t     *HRTIM_Loop_CompareRegister(HRTIM_TypeDef *pHrtim, uint32_t TimerIdx, uint32_t CompareUnit);
+static DMA_HandleTypeDef *HRTIM_Loop_Dma(HRTIM_HandleTypeDef *hhrtim, uint32_t TimerIdx);
+
+/**
+  * @brief  One compensator step
+  * @param  pComp: compensator
+  * @param  Error: reference minus feedback
+  * @retval Output, clamped
+  */
+__STATIC_INLINE float HRTIM_Loop_Compute(HRTIM_Loop_2P2ZTypeDef *pComp, float Error)
+{
+  float u = (pComp->B0 * Error) + (pComp->B1 * pComp->E1) + (pComp->B2 * pComp->E2) +
+            (pComp->A1 * pComp->U1) + (pComp->A2 * pComp->U2);
+
+  if (u > pComp->OutMax)
+  {
+    u = pComp->OutMax;
+  }
+  else if (u < pComp->OutMin)
+  {
+    u = pComp->OutMin;
+  }
+
+  pComp->E2 = pComp->E1;
+  pComp->E1 = Error;
+  pComp->U2 = pComp->U1;
+  pComp->U1 = u;
+
+  return u;
+}
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Set a 2P2Z compensator and clear its state
+  * @param  pComp: compensator
+  * @param  pB: B0, B1, B2
+  * @param  pA: A1, A2
+  * @param  OutMin: lowest output
+  * @param  OutMax: highest output
+  * @retval None
+  */
+void HRTIM_Loop_2P2ZInit(HRTIM_Loop_2P2ZTypeDef *pComp, const float *pB, const float *pA,
+                         float OutMin, float OutMax)
+{
+  memset(pComp, 0, sizeof(HRTIM_Loop_2P2ZTypeDef));
+  pComp->B0 = pB[0];
+  pComp->B1 = pB[1];
+  pComp->B2 = pB[2];
+  pComp->A1 = pA[0];
+  pComp->A2 = pA[1];
+  pComp->OutMin = OutMin;
+  pComp->OutMax = OutMax;
+  pComp->U1 = OutMin;
+  pComp->U2 = OutMin;
+}
+
+/**
+  * @brief  Set a compensator as a discrete PID (incremental form, the 2P2Z
+  *         with A1 = 1 and A2 = 0) and clear its state
+  * @param  pComp: compensator
+  * @param  Kp: proportional gain
+  * @param  Ki: integral gain, per sample
+  * @param  Kd: derivative gain, per sample
+  * @param  OutMin: lowest output
+  * @param  OutMax: highest output
+  * @retval None
+  */
+void HRTIM_Loop_PIDInit(HRTIM_Loop_2P2ZTypeDef *pComp, float Kp, float Ki, float Kd,
+                        float OutMin, float OutMax)
+{
+  float b[3];
+  const float a[2] = {1.0f, 0.0f};
+#if defined(HRTIM_LOOP_USE_CMSIS_DSP)
+  arm_pid_instance_f32 pid;
+
+  pid.Kp = Kp;
+  pid.Ki = Ki;
+  pid.Kd = Kd;
+  arm_pid_init_f32(&pid, 1);
+  b[0] = pid.A0;
+  b[1] = pid.A1;
+  b[2] = pid.A2;
+#else
+  b[0] = Kp + Ki + Kd;
+  b[1] = -(Kp + (2.0f * Kd));
+  b[2] = Kd;
+#endif
+
+  HRTIM_Loop_2P2ZInit(pComp, b, a, OutMin, OutMax);
+}
+
+/**
+  * @brief  One compensator step, for compensators run outside of the loop
+  * @param  pComp: compensator
+  * @param  Error: reference minus feedback
+  * @retval Output, clamped
+  */
+HRTIM_LOOP_FASTCODE float HRTIM_Loop_2P2Z(HRTIM_Loop_2P2ZTypeDef *pComp, float Error)
+{
+  return HRTIM_Loop_Compute(pComp, Error);
+}
+
+/**
+  * @brief  Bind the HRTIM timer, its ADC trigger and the ADC of a loop
+  * @param  pLoop: loop context, the compensator is set afterwards
+  * @param  pConfig: loop configuration, copied
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HRTIM_Loop_Init(HRTIM_LoopTypeDef *pLoop, const HRTIM_Loop_ConfigTypeDef *pConfig)
+{
+  HRTIM_ADCTriggerCfgTypeDef trigger;
+  HRTIM_HandleTypeDef *hhrtim = pConfig->hhrtim;
+  uint32_t burst;
+
+  if ((pLoop == NULL) || (hhrtim == NULL) || (pConfig->hadc == NULL) ||
+      (pConfig->TimerIdx > HRTIM_TIMERINDEX_TIMER_E) || (pConfig->MaxCompare <= pConfig->MinCompare) ||
+      (pConfig->CompareUnit == pConfig->TriggerCompareUnit) ||
+      ((pConfig->BurstDma != 0U) && (HRTIM_Loop_Dma(hhrtim, pConfig->TimerIdx) == NULL)))
+  {
+    return HAL_ERROR;
+  }
+
+  memset(pLoop, 0, sizeof(HRTIM_LoopTypeDef));
+  pLoop->Config   = *pConfig;
+  pLoop->pAdc     = pConfig->hadc->Instance;
+  pLoop->pCompare = HRTIM_Loop_CompareRegister(hhrtim->Instance, pConfig->TimerIdx, pConfig->CompareUnit);
+  pLoop->pCounter = &hhrtim->Instance->sTimerxRegs[pConfig->TimerIdx].CNTxR;
+  pLoop->Period   = __HAL_HRTIM_GETPERIOD(hhrtim, pConfig->TimerIdx);
+  pLoop->Span     = (float)(pConfig->MaxCompare - pConfig->MinCompare);
+
+  __HAL_HRTIM_SETCOMPARE(hhrtim, pConfig->TimerIdx, pConfig->TriggerCompareUnit, pConfig->TriggerTicks);
+  trigger.UpdateSource = pConfig->AdcTriggerUpdate;
+  trigger.Trigger = pConfig->AdcTriggerEvent;
+  if (HAL_HRTIM_ADCTriggerConfig(hhrtim, pConfig->AdcTrigger, &trigger) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  if (pConfig->BurstDma != 0U)
+  {
+    burst = (pConfig->CompareUnit == HRTIM_COMPAREUNIT_1) ? HRTIM_BURSTDMA_CMP1 :
+            (pConfig->CompareUnit == HRTIM_COMPAREUNIT_2) ? HRTIM_BURSTDMA_CMP2 :
+            (pConfig->CompareUnit == HRTIM_COMPAREUNIT_3) ? HRTIM_BURSTDMA_CMP3 : HRTIM_BURSTDMA_CMP4;
+    if (HAL_HRTIM_BurstDMAConfig(hhrtim, pConfig->TimerIdx, burst) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  /* Enable the DWT cycle counter to time the loop */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#if (__CORTEX_M == 7U)
+  DWT->LAR = 0xC5ACCE55U;
+#endif
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Start the injected conversions, and the burst DMA when used.
+  *         The duty cycle starts at the compensator lowest output.
+  * @param  pLoop: loop context
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HRTIM_Loop_Start(HRTIM_LoopTypeDef *pLoop)
+{
+  uint32_t compare = pLoop->Config.MinCompare + (uint32_t)(pLoop->Comp.OutMin * pLoop->Span);
+
+  pLoop->Burst = compare;
+  *pLoop->pCompare = compare;
+
+  if ((pLoop->Config.BurstDma != 0U) &&
+      (HAL_HRTIM_BurstDMATransfer(pLoop->Config.hhrtim, pLoop->Config.TimerIdx, (uint32_t)&pLoop->Burst, 1U) != HAL_OK))
+  {
+    return HAL_ERROR;
+  }
+
+  return HAL_ADCEx_InjectedStart_IT(pLoop->Config.hadc);
+}
+
+/**
+  * @brief  Stop the injected conversions and the burst DMA. The HRTIM
+  *         outputs are left to the application.
+  * @param  pLoop: loop context
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HRTIM_Loop_Stop(HRTIM_LoopTypeDef *pLoop)
+{
+  HAL_StatusTypeDef status = HAL_ADCEx_InjectedStop_IT(pLoop->Config.hadc);
+
+  if (pLoop->Config.BurstDma != 0U)
+  {
+    (void)HAL_DMA_Abort(HRTIM_Loop_Dma(pLoop->Config.hhrtim, pLoop->Config.TimerIdx));
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Change the set point
+  * @param  pLoop: loop context
+  * @param  Reference: set point, in feedback units
+  * @retval None
+  */
+void HRTIM_Loop_SetReference(HRTIM_LoopTypeDef *pLoop, float Reference)
+{
+  pLoop->Config.Reference = Reference;
+}
+
+/**
+  * @brief  Loop cost: compensator step timed here, interrupt duration and
+  *         trigger to update latency taken from the running loop
+  * @param  pLoop: loop context
+  * @param  pResult: benchmark result
+  * @retval None
+  */
+void HRTIM_Loop_Benchmark(HRTIM_LoopTypeDef *pLoop, HRTIM_Loop_BenchmarkTypeDef *pResult)
+{
+  HRTIM_Loop_2P2ZTypeDef comp = pLoop->Comp;
+  float error = 0.001f;
+  uint32_t primask;
+  uint32_t start;
+  uint32_t i;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  start = DWT->CYCCNT;
+  for (i = 0U; i < HRTIM_LOOP_BENCH_STEPS; i++)
+  {
+    error = -HRTIM_Loop_2P2Z(&comp, error);
+  }
+  pResult->CompensatorCycles = (DWT->CYCCNT - start) / HRTIM_LOOP_BENCH_STEPS;
+  __set_PRIMASK(primask);
+
+  pResult->IrqCycles = pLoop->MaxCycles;
+  pResult->LatencyTicks = pLoop->MaxLatency;
+  pResult->MaxRate = SystemCoreClock / (((pLoop->MaxCycles != 0U) ? pLoop->MaxCycles : pResult->CompensatorCycles) +
+                                        HRTIM_LOOP_IRQ_OVERHEAD);
+}
+
+/**
+  * @brief  Loop iteration: injected conversion done, compute and write the
+  *         next compare value. Called from the ADC interrupt handler.
+  * @param  pLoop: loop context
+  * @retval None
+  */
+HRTIM_LOOP_FASTCODE void HRTIM_Loop_IRQHandler(HRTIM_LoopTypeDef *pLoop)
+{
+  uint32_t start = DWT->CYCCNT;
+  uint32_t sample;
+  uint32_t compare;
+  uint32_t counter;
+  uint32_t cycles;
+  float duty;
+
+  sample = pLoop->pAdc->JDR1;
+  pLoop->pAdc->ISR = ADC_ISR_JEOC | ADC_ISR_JEOS;
+
+  duty = HRTIM_Loop_Compute(&pLoop->Comp, pLoop->Config.Reference - ((float)sample * pLoop->Config.Gain));
+  compare = pLoop->Config.MinCompare + (uint32_t)(duty * pLoop->Span);
+  if (pLoop->Config.BurstDma != 0U)
+  {
+    pLoop->Burst = compare;
+  }
+  else
+  {
+    *pLoop->pCompare = compare;
+  }
+
+  /* HRTIM ticks since the ADC trigger, across the period end */
+  counter = *pLoop->pCounter;
+  pLoop->Latency = (counter >= pLoop->Config.TriggerTicks) ? (counter - pLoop->Config.TriggerTicks) :
+                   ((counter + pLoop->Period) - pLoop->Config.TriggerTicks);
+  if (pLoop->Latency > pLoop->MaxLatency)
+  {
+    pLoop->MaxLatency = pLoop->Latency;
+  }
+
+  pLoop->Count++;
+  cycles = DWT->CYCCNT - start;
+  pLoop->Cycles = cycles;
+  if (cycles > pLoop->MaxCycles)
+  {
+    pLoop->MaxCycles = cycles;
+  }
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Compare register of a timer compare unit
+  * @param  pHrtim: HRTIM instance
+  * @param  TimerIdx: HRTIM_TIMERINDEX_TIMER_x
+  * @param  CompareUnit: HRTIM_COMPAREUNIT_x
+  * @retval Register address
+  */
+static __IO uint32_t *HRTIM_Loop_CompareRegister(HRTIM_TypeDef *pHrtim, uint32_t TimerIdx, uint32_t CompareUnit)
+{
+  HRTIM_Timerx_TypeDef *pTimer = &pHrtim->sTimerxRegs[TimerIdx];
+
+  switch (CompareUnit)
+  {
+    case HRTIM_COMPAREUNIT_1:
+      return &pTimer->CMP1xR;
+    case HRTIM_COMPAREUNIT_2:
+      return &pTimer->CMP2xR;
+    case HRTIM_COMPAREUNIT_3:
+      return &pTimer->CMP3xR;
+    default:
+      return &pTimer->CMP4xR;
+  }
+}
+
+/**
+  * @brief  DMA handle of a timer
+  * @param  hhrtim: HRTIM handle
+  * @param  TimerIdx: HRTIM_TIMERINDEX_TIMER_x
+  * @retval DMA handle, NULL if none linked
+  */
+static DMA_HandleTypeDef *HRTIM_Loop_Dma(HRTIM_HandleTypeDef *hhrtim, uint32_t TimerIdx)
+{
+  switch (TimerIdx)
+  {
+    case HRTIM_TIMERINDEX_TIMER_A:
+      return hhrtim->hdmaTimerA;
+    case HRTIM_TIMERINDEX_TIMER_B:
+      return hhrtim->hdmaTimerB;
+    case HRTIM_TIMERINDEX_TIMER_C:
+      return hhrtim->hdmaTimerC;
+    case HRTIM_TIMERINDEX_TIMER_D:
+      return hhrtim->hdmaTimerD;
+    default:
+      return hhrtim->hdmaTimerE;
+  }
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
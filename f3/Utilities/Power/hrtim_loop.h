@@ -0,0 +1,145 @@
+/**
+  ******************************************************************************
+  * @file    hrtim_loop.h
+  * @author  MCD Application Team
+  * @brief   Header for hrtim_loop module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _HRTIM_LOOP_H__
+#define _HRTIM_LOOP_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#if !defined(HAL_HRTIM_MODULE_ENABLED) || !defined(HAL_ADC_MODULE_ENABLED)
+#error "hrtim_loop requires the HAL HRTIM and ADC drivers"
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+/* Placement of the loop code, e.g. __attribute__((section(".ccmram"))) with a
+   linker script copying that section to the CCM RAM. Override in main.h. */
+#if !defined(HRTIM_LOOP_FASTCODE)
+#define HRTIM_LOOP_FASTCODE
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+/* 2 poles 2 zeros compensator:
+   u[n] = B0.e[n] + B1.e[n-1] + B2.e[n-2] + A1.u[n-1] + A2.u[n-2],
+   u clamped to [OutMin, OutMax] before being kept (anti windup). */
+typedef struct
+{
+  float                     B0;
+  float                     B1;
+  float                     B2;
+  float                     A1;
+  float                     A2;
+  float                     OutMin;
+  float                     OutMax;
+  float                     E1;
+  float                     E2;
+  float                     U1;
+  float                     U2;
+} HRTIM_Loop_2P2ZTypeDef;
+
+typedef struct
+{
+  HRTIM_HandleTypeDef       *hhrtim;
+  uint32_t                  TimerIdx;           /* HRTIM_TIMERINDEX_TIMER_x of the power stage  */
+  uint32_t                  CompareUnit;        /* HRTIM_COMPAREUNIT_x set from the duty cycle  */
+  uint32_t                  MinCompare;         /* Compare value of duty cycle 0                */
+  uint32_t                  MaxCompare;         /* Compare value of duty cycle 1                */
+  uint32_t                  TriggerCompareUnit; /* HRTIM_COMPAREUNIT_x of the ADC trigger       */
+  uint32_t                  TriggerTicks;       /* Counter value of the ADC trigger             */
+  uint32_t                  AdcTrigger;         /* HRTIM_ADCTRIGGER_x                           */
+  uint32_t                  AdcTriggerEvent;    /* HRTIM_ADCTRIGGEREVENTx_TIMERy_CMPz matching
+                                                   TimerIdx and TriggerCompareUnit              */
+  uint32_t                  AdcTriggerUpdate;   /* HRTIM_ADCTRIGGERUPDATE_TIMER_x               */
+  ADC_HandleTypeDef         *hadc;              /* Injected rank 1 started by the ADC trigger   */
+  float                     Reference;          /* Set point, in feedback units                 */
+  float                     Gain;               /* Feedback units per ADC code                  */
+  uint32_t                  BurstDma;           /* 1: compare written by the burst DMA          */
+} HRTIM_Loop_ConfigTypeDef;
+
+typedef struct
+{
+  HRTIM_Loop_ConfigTypeDef  Config;
+  HRTIM_Loop_2P2ZTypeDef    Comp;
+  ADC_TypeDef               *pAdc;
+  __IO uint32_t             *pCompare;          /* CMPxR of CompareUnit                         */
+  __IO uint32_t             *pCounter;          /* CNTxR                                        */
+  uint32_t                  Period;
+  float                     Span;               /* MaxCompare - MinCompare                      */
+  __IO uint32_t             Burst;              /* Burst DMA source                             */
+  uint32_t                  Count;              /* Loop iterations                              */
+  uint32_t                  Cycles;             /* Last HRTIM_Loop_IRQHandler() duration        */
+  uint32_t                  MaxCycles;
+  uint32_t                  Latency;            /* Last ADC trigger to compare write, HRTIM ticks */
+  uint32_t                  MaxLatency;
+} HRTIM_LoopTypeDef;
+
+typedef struct
+{
+  uint32_t                  CompensatorCycles;  /* One compensator step                         */
+  uint32_t                  IrqCycles;          /* Longest HRTIM_Loop_IRQHandler()              */
+  uint32_t                  LatencyTicks;       /* Longest ADC trigger to compare write         */
+  uint32_t                  MaxRate;            /* Loop rate the CPU sustains, in Hz            */
+} HRTIM_Loop_BenchmarkTypeDef;
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+void              HRTIM_Loop_2P2ZInit(HRTIM_Loop_2P2ZTypeDef *pComp, const float *pB, const float *pA,
+                                      float OutMin, float OutMax);
+void              HRTIM_Loop_PIDInit(HRTIM_Loop_2P2ZTypeDef *pComp, float Kp, float Ki, float Kd,
+                                     float OutMin, float OutMax);
+float             HRTIM_Loop_2P2Z(HRTIM_Loop_2P2ZTypeDef *pComp, float Error);
+
+HAL_StatusTypeDef HRTIM_Loop_Init(HRTIM_LoopTypeDef *pLoop, const HRTIM_Loop_ConfigTypeDef *pConfig);
+HAL_StatusTypeDef HRTIM_Loop_Start(HRTIM_LoopTypeDef *pLoop);
+HAL_StatusTypeDef HRTIM_Loop_Stop(HRTIM_LoopTypeDef *pLoop);
+void              HRTIM_Loop_SetReference(HRTIM_LoopTypeDef *pLoop, float Reference);
+void              HRTIM_Loop_Benchmark(HRTIM_LoopTypeDef *pLoop, HRTIM_Loop_BenchmarkTypeDef *pResult);
+
+void HRTIM_Loop_IRQHandler(HRTIM_LoopTypeDef *pLoop);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _HRTIM_LOOP_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -327,6 +327,34 @@ uint16_t ili9341_GetLcdPixelHeight(void)
   return ILI9341_LCD_PIXEL_HEIGHT;
 }
 
+/**
+  * @brief  Opens a window for a stream of pixels
+  * @param  Xpos:   specifies the X left position.
+  * @param  Ypos:   specifies the Y top position.
+  * @param  Width:  window width.
+  * @param  Height: window height.
+  * @note   The Width x Height RGB565 pixels that follow, row by row, are
+  *         written in the window (used by the DMA frame push).
+  * @retval None
+  */
+void ili9341_SetWriteWindow(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+  /* Column address set */
+  ili9341_WriteReg(LCD_COLUMN_ADDR);
+  ili9341_WriteData(Xpos >> 8);
+  ili9341_WriteData(Xpos & 0xFF);
+  ili9341_WriteData((Xpos + Width - 1) >> 8);
+  ili9341_WriteData((Xpos + Width - 1) & 0xFF);
+  /* Page address set */
+  ili9341_WriteReg(LCD_PAGE_ADDR);
+  ili9341_WriteData(Ypos >> 8);
+  ili9341_WriteData(Ypos & 0xFF);
+  ili9341_WriteData((Ypos + Height - 1) >> 8);
+  ili9341_WriteData((Ypos + Height - 1) & 0xFF);
+  /* Memory write */
+  ili9341_WriteReg(LCD_GRAM);
+}
+
 /**
   * @}
   */ 
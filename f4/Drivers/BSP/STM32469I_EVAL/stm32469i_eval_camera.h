@@ -126,6 +126,7 @@ uint8_t BSP_CAMERA_Init(uint32_t Resolution);
 uint8_t BSP_CAMERA_DeInit(void);
 void    BSP_CAMERA_ContinuousStart(uint8_t *buff);
 void    BSP_CAMERA_SnapshotStart(uint8_t *buff);
+uint8_t BSP_CAMERA_PreviewStart(uint8_t *buff, uint32_t StripLines, uint32_t Address, uint32_t Pitch, uint32_t ColorMode);
 void    BSP_CAMERA_Suspend(void);
 void    BSP_CAMERA_Resume(void);
 uint8_t BSP_CAMERA_Stop(void);
@@ -105,6 +105,11 @@
 #define   LCD_ERROR      0x01
 #define   LCD_TIMEOUT    0x02
 
+/** 
+  * @brief  Maximum number of frame buffers of the frame presentation  
+  */
+#define LCD_PRESENT_MAX_BUFFERS  3
+
 /** 
   * @brief  LCD Display OTM8009A ID  
   */ 
@@ -325,6 +330,9 @@ void     BSP_LCD_SetYSize(uint32_t imageHeightPixels);
 void     BSP_LCD_LayerDefaultInit(uint16_t LayerIndex, uint32_t FB_Address);
 void     BSP_LCD_SetTransparency(uint32_t LayerIndex, uint8_t Transparency);
 void     BSP_LCD_SetLayerAddress(uint32_t LayerIndex, uint32_t Address);
+uint8_t  BSP_LCD_PresentInit(uint32_t LayerIndex, uint32_t *pAddress, uint32_t Count);
+uint32_t BSP_LCD_Present(void);
+uint8_t  BSP_LCD_IsPresentPending(void);
 void     BSP_LCD_SetColorKeying(uint32_t LayerIndex, uint32_t RGBValue);
 void     BSP_LCD_ResetColorKeying(uint32_t LayerIndex);
 void     BSP_LCD_SetLayerWindow(uint16_t LayerIndex, uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
@@ -345,6 +353,7 @@ void     BSP_LCD_Clear(uint32_t Color);
 void     BSP_LCD_ClearStringLine(uint32_t Line);
 void     BSP_LCD_DisplayStringAtLine(uint16_t Line, uint8_t *ptr);
 void     BSP_LCD_DisplayStringAt(uint16_t Xpos, uint16_t Ypos, uint8_t *Text, Text_AlignModeTypdef Mode);
+void     BSP_LCD_SetFontAtlas(FONT_AtlasTypeDef *pAtlas);
 void     BSP_LCD_DisplayChar(uint16_t Xpos, uint16_t Ypos, uint8_t Ascii);
 
 void     BSP_LCD_DrawHLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length);
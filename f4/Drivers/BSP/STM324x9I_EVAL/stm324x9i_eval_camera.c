@@ -82,6 +82,18 @@
 static DCMI_HandleTypeDef  hdcmi_eval;
        CAMERA_DrvTypeDef   *camera_drv;
 uint32_t current_resolution;
+/* Preview mode: each strip of the capture is converted into the framebuffer */
+static DMA2D_HandleTypeDef hDma2dPreview;
+static uint8_t  *PreviewBuffer;
+static uint32_t PreviewStripSize;
+static uint32_t PreviewStripLines;
+static uint32_t PreviewStripCount;
+static uint32_t PreviewStrip;
+static uint32_t PreviewWidth;
+static uint32_t PreviewAddress;
+static uint32_t PreviewPitch;
+static uint32_t PreviewColorMode;
+static void     (* PreviewXferCplt)(DMA_HandleTypeDef *hdma);
 /**
   * @}
   */ 
@@ -90,6 +102,10 @@ uint32_t current_resolution;
   * @{
   */
 static uint32_t GetSize(uint32_t resolution);
+static uint32_t GetWidth(uint32_t resolution);
+static void     CAMERA_PreviewConvert(uint32_t Half);
+static void     CAMERA_PreviewHalfCplt(DMA_HandleTypeDef *hdma);
+static void     CAMERA_PreviewCplt(DMA_HandleTypeDef *hdma);
 /**
   * @}
   */ 
@@ -176,6 +192,76 @@ void BSP_CAMERA_SnapshotStart(uint8_t *buff)
   HAL_DCMI_Start_DMA(&hdcmi_eval, DCMI_MODE_SNAPSHOT, (uint32_t)buff, GetSize(current_resolution));  
 }
 
+/**
+  * @brief  Starts the camera capture in preview mode.
+  * @note   The frame is captured strip after strip into a buffer holding two
+  *         strips. Each strip is converted by the DMA2D into the framebuffer
+  *         as soon as the DMA has written it, while the next one is captured,
+  *         so no full frame buffer is needed. The DMA2D must not be used by
+  *         the application while the preview runs.
+  * @param  buff: pointer to the strip buffer, 2 * StripLines lines of RGB565 pixels
+  * @param  StripLines: lines per strip, must divide the frame height
+  * @param  Address: framebuffer address of the top left pixel of the preview
+  * @param  Pitch: framebuffer line length in pixels
+  * @param  ColorMode: framebuffer format, DMA2D_OUTPUT_RGB565 or DMA2D_OUTPUT_ARGB8888
+  * @retval Camera status
+  */
+uint8_t BSP_CAMERA_PreviewStart(uint8_t *buff, uint32_t StripLines, uint32_t Address, uint32_t Pitch, uint32_t ColorMode)
+{
+  uint32_t width = GetWidth(current_resolution);
+  uint32_t height;
+
+  if((width == 0) || (StripLines == 0) || (Pitch < width) ||
+     ((ColorMode != DMA2D_OUTPUT_RGB565) && (ColorMode != DMA2D_OUTPUT_ARGB8888)))
+  {
+    return CAMERA_ERROR;
+  }
+
+  /* GetSize() counts 32-bit words, two RGB565 pixels each */
+  height = (GetSize(current_resolution) * 2) / width;
+
+  /* The two strips make one DMA transfer of at most 0xFFFF words */
+  if(((height % StripLines) != 0) || ((StripLines * width) > 0xFFFF))
+  {
+    return CAMERA_ERROR;
+  }
+
+  PreviewBuffer     = buff;
+  PreviewStripLines = StripLines;
+  PreviewStripSize  = StripLines * width * 2;
+  PreviewStripCount = height / StripLines;
+  PreviewStrip      = 0;
+  PreviewWidth      = width;
+  PreviewAddress    = Address;
+  PreviewPitch      = Pitch;
+  PreviewColorMode  = ColorMode;
+
+  /* DMA2D configuration: camera RGB565 to framebuffer format */
+  hDma2dPreview.Instance                    = DMA2D;
+  hDma2dPreview.Init.Mode                   = (ColorMode == DMA2D_OUTPUT_RGB565) ? DMA2D_M2M : DMA2D_M2M_PFC;
+  hDma2dPreview.Init.ColorMode              = ColorMode;
+  hDma2dPreview.Init.OutputOffset           = Pitch - width;
+  hDma2dPreview.LayerCfg[1].InputOffset     = 0;
+  hDma2dPreview.LayerCfg[1].InputColorMode  = DMA2D_INPUT_RGB565;
+  hDma2dPreview.LayerCfg[1].AlphaMode       = DMA2D_NO_MODIF_ALPHA;
+  hDma2dPreview.LayerCfg[1].InputAlpha      = 0xFF;
+
+  /* The DMA half transfer interrupt is only enabled when its callback is set */
+  hdcmi_eval.DMA_Handle->XferHalfCpltCallback = CAMERA_PreviewHalfCplt;
+
+  if(HAL_DCMI_Start_DMA(&hdcmi_eval, DCMI_MODE_CONTINUOUS, (uint32_t)buff, StripLines * width) != HAL_OK)
+  {
+    hdcmi_eval.DMA_Handle->XferHalfCpltCallback = NULL;
+    return CAMERA_ERROR;
+  }
+
+  /* Convert the second strip ahead of the DCMI transfer complete handling */
+  PreviewXferCplt = hdcmi_eval.DMA_Handle->XferCpltCallback;
+  hdcmi_eval.DMA_Handle->XferCpltCallback = CAMERA_PreviewCplt;
+
+  return CAMERA_OK;
+}
+
 /**
   * @brief Suspend the CAMERA capture 
   */
@@ -207,6 +293,9 @@ uint8_t BSP_CAMERA_Stop(void)
   /* Get the DCMI handle structure */
   phdcmi = &hdcmi_eval;
   
+  /* Leave the preview mode */
+  hdcmi_eval.DMA_Handle->XferHalfCpltCallback = NULL;
+
   if(HAL_DCMI_Stop(phdcmi) == HAL_OK)
   {
     ret = CAMERA_OK;
@@ -338,6 +427,84 @@ static uint32_t GetSize(uint32_t resolution)
   return size;
 }
 
+/**
+  * @brief  Get the capture width in pixels unit.
+  * @param  resolution: the current resolution.
+  * @retval capture width in pixels unit.
+  */
+static uint32_t GetWidth(uint32_t resolution)
+{
+  uint32_t width = 0;
+
+  switch (resolution)
+  {
+  case CAMERA_R160x120:
+    width = 160;
+    break;
+  case CAMERA_R320x240:
+    width = 320;
+    break;
+  case CAMERA_R480x272:
+    width = 480;
+    break;
+  case CAMERA_R640x480:
+    width = 640;
+    break;
+  default:
+    break;
+  }
+
+  return width;
+}
+
+/**
+  * @brief  Converts a captured strip into the framebuffer.
+  * @param  Half: 0 for the first strip of the buffer, 1 for the second one
+  * @retval None
+  */
+static void CAMERA_PreviewConvert(uint32_t Half)
+{
+  uint32_t line = PreviewStrip * PreviewStripLines;
+  uint32_t bpp  = (PreviewColorMode == DMA2D_OUTPUT_RGB565) ? 2 : 4;
+
+  /* The previous strip was started one strip time ago: it is normally over */
+  HAL_DMA2D_PollForTransfer(&hDma2dPreview, 10);
+
+  if((HAL_DMA2D_Init(&hDma2dPreview) == HAL_OK) &&
+     (HAL_DMA2D_ConfigLayer(&hDma2dPreview, 1) == HAL_OK))
+  {
+    HAL_DMA2D_Start(&hDma2dPreview, (uint32_t)PreviewBuffer + (Half * PreviewStripSize),
+                    PreviewAddress + (line * PreviewPitch * bpp), PreviewWidth, PreviewStripLines);
+  }
+
+  PreviewStrip = (PreviewStrip + 1) % PreviewStripCount;
+}
+
+/**
+  * @brief  DMA half transfer callback in preview mode: first strip landed.
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void CAMERA_PreviewHalfCplt(DMA_HandleTypeDef *hdma)
+{
+  CAMERA_PreviewConvert(0);
+}
+
+/**
+  * @brief  DMA transfer complete callback in preview mode: second strip landed.
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void CAMERA_PreviewCplt(DMA_HandleTypeDef *hdma)
+{
+  CAMERA_PreviewConvert(1);
+
+  if(PreviewXferCplt != NULL)
+  {
+    PreviewXferCplt(hdma);
+  }
+}
+
 /**
   * @brief  Initializes the DCMI MSP.
   */
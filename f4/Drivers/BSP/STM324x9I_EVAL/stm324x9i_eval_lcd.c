@@ -113,6 +113,16 @@ static uint32_t            PCLK_profile = LCD_MAX_PCLK;
 /* Default LCD configuration with LCD Layer 1 */
 static uint32_t            ActiveLayer = 0;
 static LCD_DrawPropTypeDef DrawProp[MAX_LAYER_NUMBER];
+static FONT_AtlasTypeDef   *pFontAtlas = NULL;
+
+/* Frame presentation state, the buffers are indexes in PresentAddress[] */
+#define LCD_PRESENT_NONE           0xFFFFFFFFU
+static uint32_t            PresentAddress[LCD_PRESENT_MAX_BUFFERS];
+static uint32_t            PresentCount = 0;
+static uint32_t            PresentLayer = 0;
+static uint32_t            PresentFront = 0;
+static uint32_t            PresentPending = LCD_PRESENT_NONE;
+static uint32_t            PresentBack = 0;
 /**
   * @}
   */ 
@@ -122,6 +132,8 @@ static LCD_DrawPropTypeDef DrawProp[MAX_LAYER_NUMBER];
   */ 
 static void MspInit(void);
 static void DrawChar(uint16_t Xpos, uint16_t Ypos, const uint8_t *c);
+static uint8_t LL_DrawGlyph(uint16_t Xpos, uint16_t Ypos, uint8_t Ascii, uint8_t Setup);
+static uint8_t LL_PresentWait(void);
 static void FillTriangle(uint16_t x1, uint16_t x2, uint16_t x3, uint16_t y1, uint16_t y2, uint16_t y3);
 static void LL_FillBuffer(uint32_t LayerIndex, void *pDst, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint32_t ColorIndex);
 static void LL_ConvertLineToARGB8888(void * pSrc, void *pDst, uint32_t xSize, uint32_t ColorMode);
@@ -364,6 +376,103 @@ void BSP_LCD_SetLayerAddress_NoReload(uint32_t LayerIndex, uint32_t Address)
   HAL_LTDC_SetAddress_NoReload(&hltdc_eval, Address, LayerIndex);
 }
 
+/**
+  * @brief  Starts the frame presentation on a layer, with 2 or 3 frame buffers.
+  * @note   The first buffer is shown and the drawing functions draw in the
+  *         second one, until BSP_LCD_Present() is called. Each buffer holds
+  *         a full screen in the pixel format of the layer.
+  * @note   The layer address held by the LTDC handle is the back buffer: the
+  *         functions reloading the layer configuration immediately must not
+  *         be used on this layer while the presentation runs.
+  * @param  LayerIndex: Layer foreground or background
+  * @param  pAddress: Frame buffer addresses
+  * @param  Count: Number of frame buffers, 2 (double) or 3 (triple buffering)
+  * @retval LCD status
+  */
+uint8_t BSP_LCD_PresentInit(uint32_t LayerIndex, uint32_t *pAddress, uint32_t Count)
+{
+  uint32_t index;
+  
+  if((Count < 2) || (Count > LCD_PRESENT_MAX_BUFFERS))
+  {
+    return LCD_ERROR;
+  }
+  
+  for(index = 0; index < Count; index++)
+  {
+    PresentAddress[index] = pAddress[index];
+  }
+  PresentCount   = Count;
+  PresentLayer   = LayerIndex;
+  PresentFront   = 0;
+  PresentPending = LCD_PRESENT_NONE;
+  PresentBack    = 1;
+  
+  HAL_LTDC_SetAddress(&hltdc_eval, PresentAddress[PresentFront], PresentLayer);
+  hltdc_eval.LayerCfg[PresentLayer].FBStartAdress = PresentAddress[PresentBack];
+  
+  return LCD_OK;
+}
+
+/**
+  * @brief  Shows the back buffer at the next vertical blanking and selects the
+  *         buffer the next frame is drawn in.
+  * @note   With triple buffering the call only waits when the previous frame
+  *         is still waiting for its vertical blanking; with double buffering
+  *         it waits until the frame is shown.
+  * @retval Address of the new back buffer, 0 on timeout
+  */
+uint32_t BSP_LCD_Present(void)
+{
+  uint32_t index;
+  
+  /* Only one frame can wait for the vertical blanking */
+  if((PresentCount == 0) || (LL_PresentWait() != LCD_OK))
+  {
+    return 0;
+  }
+  
+  /* The layer shadow address is loaded by hardware on the vertical blanking */
+  LTDC_LAYER(&hltdc_eval, PresentLayer)->CFBAR = PresentAddress[PresentBack];
+  hltdc_eval.Instance->SRCR = LTDC_SRCR_VBR;
+  PresentPending = PresentBack;
+  
+  /* With two buffers, the next back buffer is the one shown until now */
+  if((PresentCount == 2) && (LL_PresentWait() != LCD_OK))
+  {
+    return 0;
+  }
+  
+  /* Draw in a buffer neither shown nor waiting to be shown */
+  for(index = 0; index < PresentCount; index++)
+  {
+    if((index != PresentFront) && (index != PresentPending))
+    {
+      break;
+    }
+  }
+  PresentBack = index;
+  hltdc_eval.LayerCfg[PresentLayer].FBStartAdress = PresentAddress[PresentBack];
+  
+  return PresentAddress[PresentBack];
+}
+
+/**
+  * @brief  Tells whether a presented frame is still waiting for the vertical
+  *         blanking.
+  * @retval 1 if a frame is pending, 0 otherwise
+  */
+uint8_t BSP_LCD_IsPresentPending(void)
+{
+  if((PresentPending != LCD_PRESENT_NONE) && ((hltdc_eval.Instance->SRCR & LTDC_SRCR_VBR) == 0))
+  {
+    PresentFront   = PresentPending;
+    PresentPending = LCD_PRESENT_NONE;
+  }
+  
+  return (PresentPending != LCD_PRESENT_NONE) ? 1 : 0;
+}
+
 /**
   * @brief  Sets display window.
   * @param  LayerIndex: Layer index
@@ -573,6 +682,17 @@ void BSP_LCD_ClearStringLine(uint32_t Line)
   BSP_LCD_SetTextColor(DrawProp[ActiveLayer].TextColor);  
 }
 
+/**
+  * @brief  Sets the glyph atlas used to draw the characters of its font.
+  * @note   The characters of the other fonts are still drawn pixel by pixel.
+  * @param  pAtlas: Glyph atlas built by FONT_AtlasInit(), NULL to disable it
+  * @retval None
+  */
+void BSP_LCD_SetFontAtlas(FONT_AtlasTypeDef *pAtlas)
+{
+  pFontAtlas = pAtlas;
+}
+
 /**
   * @brief  Displays one character.
   * @param  Xpos: Start column address
@@ -582,8 +702,12 @@ void BSP_LCD_ClearStringLine(uint32_t Line)
   */
 void BSP_LCD_DisplayChar(uint16_t Xpos, uint16_t Ypos, uint8_t Ascii)
 {
-  DrawChar(Xpos, Ypos, &DrawProp[ActiveLayer].pFont->table[(Ascii-' ') *\
-    DrawProp[ActiveLayer].pFont->Height * ((DrawProp[ActiveLayer].pFont->Width + 7) / 8)]);
+  /* Blit the glyph with DMA2D when the font has an atlas, else plot it */
+  if(LL_DrawGlyph(Xpos, Ypos, Ascii, 1) != LCD_OK)
+  {
+    DrawChar(Xpos, Ypos, &DrawProp[ActiveLayer].pFont->table[(Ascii-' ') *\
+      DrawProp[ActiveLayer].pFont->Height * ((DrawProp[ActiveLayer].pFont->Width + 7) / 8)]);
+  }
 }
 
 /**
@@ -602,6 +726,7 @@ void BSP_LCD_DisplayStringAt(uint16_t Xpos, uint16_t Ypos, uint8_t *Text, Text_A
   uint16_t refcolumn = 1, i = 0;
   uint32_t size = 0, xsize = 0; 
   uint8_t  *ptr = Text;
+  uint8_t  setup = 1;
   
   /* Get the text size */
   while (*ptr++) size ++ ;
@@ -636,8 +761,16 @@ void BSP_LCD_DisplayStringAt(uint16_t Xpos, uint16_t Ypos, uint8_t *Text, Text_A
   /* Send the string character by character on LCD */
   while ((*Text != 0) & (((BSP_LCD_GetXSize() - (i*DrawProp[ActiveLayer].pFont->Width)) & 0xFFFF) >= DrawProp[ActiveLayer].pFont->Width))
   {
-    /* Display one character on LCD */
-    BSP_LCD_DisplayChar(refcolumn, Ypos, *Text);
+    /* Display one character on LCD, the DMA2D set up is shared by the glyphs */
+    if(LL_DrawGlyph(refcolumn, Ypos, *Text, setup) == LCD_OK)
+    {
+      setup = 0;
+    }
+    else
+    {
+      BSP_LCD_DisplayChar(refcolumn, Ypos, *Text);
+      setup = 1;
+    }
     /* Decrement the column position by 16 */
     refcolumn += DrawProp[ActiveLayer].pFont->Width;
     /* Point on the next character */
@@ -1306,6 +1439,108 @@ static void DrawChar(uint16_t Xpos, uint16_t Ypos, const uint8_t *c)
   }
 }
 
+/**
+  * @brief  Draws a character from the glyph atlas with DMA2D.
+  * @note   The foreground is the glyph coverage in the text color, blended
+  *         over a background of plain back color.
+  * @param  Xpos: Start column address
+  * @param  Ypos: Line where to display the character shape
+  * @param  Ascii: Character ascii code
+  * @param  Setup: 0 to reuse the DMA2D set up of the previous glyph
+  * @retval LCD_OK if the glyph was drawn, LCD_ERROR to draw it pixel by pixel
+  */
+static uint8_t LL_DrawGlyph(uint16_t Xpos, uint16_t Ypos, uint8_t Ascii, uint8_t Setup)
+{
+  sFONT *pfont = DrawProp[ActiveLayer].pFont;
+  const uint8_t *pglyph;
+  uint32_t input_mode, output_mode, bytes;
+  uint32_t address;
+  
+  if((pFontAtlas == NULL) || (pFontAtlas->pFont != pfont))
+  {
+    return LCD_ERROR;
+  }
+  
+  pglyph = FONT_AtlasGetGlyph(pFontAtlas, Ascii);
+  if((pglyph == NULL) || ((Xpos + pfont->Width) > BSP_LCD_GetXSize()) || ((Ypos + pfont->Height) > BSP_LCD_GetYSize()))
+  {
+    return LCD_ERROR;
+  }
+  
+  if(hltdc_eval.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_RGB565)
+  {
+    output_mode = DMA2D_OUTPUT_RGB565;
+    bytes = 2;
+  }
+  else
+  {
+    output_mode = DMA2D_OUTPUT_ARGB8888;
+    bytes = 4;
+  }
+  address = hltdc_eval.LayerCfg[ActiveLayer].FBStartAdress + (bytes * ((Ypos * BSP_LCD_GetXSize()) + Xpos));
+  
+  if(Setup != 0)
+  {
+    input_mode = (pFontAtlas->ColorMode == FONT_ATLAS_A4) ? DMA2D_INPUT_A4 : DMA2D_INPUT_A8;
+    
+    /* Configure the DMA2D Mode, Color Mode and output offset */
+    hdma2d_eval.Init.Mode         = DMA2D_M2M_BLEND;
+    hdma2d_eval.Init.ColorMode    = output_mode;
+    hdma2d_eval.Init.OutputOffset = BSP_LCD_GetXSize() - pfont->Width;
+    
+    /* Foreground Configuration: glyph coverage in the text color */
+    hdma2d_eval.LayerCfg[1].AlphaMode = DMA2D_NO_MODIF_ALPHA;
+    hdma2d_eval.LayerCfg[1].InputAlpha = DrawProp[ActiveLayer].TextColor;
+    hdma2d_eval.LayerCfg[1].InputColorMode = input_mode;
+    hdma2d_eval.LayerCfg[1].InputOffset = 0;
+    
+    /* Background Configuration: back color, the read coverage is replaced */
+    hdma2d_eval.LayerCfg[0].AlphaMode = DMA2D_REPLACE_ALPHA;
+    hdma2d_eval.LayerCfg[0].InputAlpha = DrawProp[ActiveLayer].BackColor;
+    hdma2d_eval.LayerCfg[0].InputColorMode = input_mode;
+    hdma2d_eval.LayerCfg[0].InputOffset = 0;
+    
+    hdma2d_eval.Instance = DMA2D;
+    
+    /* DMA2D Initialization */
+    if((HAL_DMA2D_Init(&hdma2d_eval) != HAL_OK) ||
+       (HAL_DMA2D_ConfigLayer(&hdma2d_eval, 0) != HAL_OK) ||
+       (HAL_DMA2D_ConfigLayer(&hdma2d_eval, 1) != HAL_OK))
+    {
+      return LCD_ERROR;
+    }
+  }
+  
+  if(HAL_DMA2D_BlendingStart(&hdma2d_eval, (uint32_t)pglyph, (uint32_t)pglyph, address, pfont->Width, pfont->Height) != HAL_OK)
+  {
+    return LCD_ERROR;
+  }
+  
+  /* Polling For DMA transfer */
+  HAL_DMA2D_PollForTransfer(&hdma2d_eval, 10);
+  
+  return LCD_OK;
+}
+
+/**
+  * @brief  Waits until the presented frame is shown.
+  * @retval LCD_OK, or LCD_TIMEOUT when no vertical blanking occurred
+  */
+static uint8_t LL_PresentWait(void)
+{
+  uint32_t tickstart = HAL_GetTick();
+  
+  while(BSP_LCD_IsPresentPending() != 0)
+  {
+    if((HAL_GetTick() - tickstart) > 100)
+    {
+      return LCD_TIMEOUT;
+    }
+  }
+  
+  return LCD_OK;
+}
+
 /**
   * @brief  Fills a triangle (between 3 points).
   * @param  x1: Point 1 X position
@@ -114,6 +114,11 @@ typedef enum
 #define   LCD_ERROR      0x01
 #define   LCD_TIMEOUT    0x02
 
+/** 
+  * @brief  Maximum number of frame buffers of the frame presentation  
+  */
+#define LCD_PRESENT_MAX_BUFFERS  3
+
 /** 
   * @brief  LCD FB_StartAddress  
   */
@@ -186,6 +191,9 @@ void     BSP_LCD_SetTransparency(uint32_t LayerIndex, uint8_t Transparency);
 void     BSP_LCD_SetTransparency_NoReload(uint32_t LayerIndex, uint8_t Transparency);
 void     BSP_LCD_SetLayerAddress(uint32_t LayerIndex, uint32_t Address);
 void     BSP_LCD_SetLayerAddress_NoReload(uint32_t LayerIndex, uint32_t Address);
+uint8_t  BSP_LCD_PresentInit(uint32_t LayerIndex, uint32_t *pAddress, uint32_t Count);
+uint32_t BSP_LCD_Present(void);
+uint8_t  BSP_LCD_IsPresentPending(void);
 void     BSP_LCD_SetColorKeying(uint32_t LayerIndex, uint32_t RGBValue);
 void     BSP_LCD_SetColorKeying_NoReload(uint32_t LayerIndex, uint32_t RGBValue);
 void     BSP_LCD_ResetColorKeying(uint32_t LayerIndex);
@@ -210,6 +218,7 @@ void     BSP_LCD_Clear(uint32_t Color);
 void     BSP_LCD_ClearStringLine(uint32_t Line);
 void     BSP_LCD_DisplayStringAtLine(uint16_t Line, uint8_t *ptr);
 void     BSP_LCD_DisplayStringAt(uint16_t Xpos, uint16_t Ypos, uint8_t *Text, Text_AlignModeTypdef Mode);
+void     BSP_LCD_SetFontAtlas(FONT_AtlasTypeDef *pAtlas);
 void     BSP_LCD_DisplayChar(uint16_t Xpos, uint16_t Ypos, uint8_t Ascii);
 
 void     BSP_LCD_DrawHLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length);
@@ -35,6 +35,9 @@
   */
 /* Includes ------------------------------------------------------------------*/
 #include "stm32f4_discovery.h"
+#if defined(AUDIO_IO_BATCH)
+#include "../Components/Common/audio.h"
+#endif /* AUDIO_IO_BATCH */
 
 /** @defgroup BSP BSP
   * @{
@@ -80,6 +83,18 @@
 /** @defgroup STM32F4_DISCOVERY_LOW_LEVEL_Private_Macros STM32F4 DISCOVERY LOW LEVEL Private Macros
   * @{
   */ 
+#if defined(AUDIO_IO_BATCH)
+/* Codec registers sent in one I2C transfer, at consecutive addresses */
+#define AUDIO_IO_BATCH_RUN_MAX        16
+
+/* Codec register writes batch state */
+#define AUDIO_IO_BATCH_IDLE           0
+#define AUDIO_IO_BATCH_BUSY           1
+#define AUDIO_IO_BATCH_ERROR          2
+
+/* CS43L22 register address auto-increment bit */
+#define AUDIO_IO_BATCH_INCR           0x80
+#endif /* AUDIO_IO_BATCH */
 /**
   * @}
   */ 
@@ -105,6 +120,20 @@ uint32_t SpixTimeout = SPIx_TIMEOUT_MAX;    /*<! Value of Timeout when SPI commu
 
 static SPI_HandleTypeDef    SpiHandle;
 static I2C_HandleTypeDef    I2cHandle;
+
+#if defined(AUDIO_IO_BATCH)
+static DMA_HandleTypeDef    I2cDmaTxHandle;
+
+/* Codec register writes batch in progress */
+static AUDIO_IO_RegTypeDef *pAudioBatch;
+static uint16_t AudioBatchCount = 0;
+static uint16_t AudioBatchIndex = 0;
+static uint8_t  AudioBatchAddr = 0;
+static __IO uint32_t AudioBatchState = AUDIO_IO_BATCH_IDLE;
+
+/* I2C transfer of the batch: register address then the values, read by the DMA */
+static uint8_t  AudioBatchFrame[1 + AUDIO_IO_BATCH_RUN_MAX];
+#endif /* AUDIO_IO_BATCH */
 /**
   * @}
   */ 
@@ -124,6 +153,11 @@ static void     I2Cx_WriteData(uint8_t Addr, uint8_t Reg, uint8_t Value);
 static uint8_t  I2Cx_ReadData(uint8_t Addr, uint8_t Reg);
 static void     I2Cx_MspInit(void);
 static void     I2Cx_Error(uint8_t Addr);
+#if defined(AUDIO_IO_BATCH)
+static void     I2Cx_BatchNext(void);
+static void     I2Cx_BatchProcess(void);
+static void     I2Cx_BatchWait(void);
+#endif /* AUDIO_IO_BATCH */
 
 static void     SPIx_Init(void);
 static void     SPIx_MspInit(void);
@@ -141,6 +175,9 @@ void            AUDIO_IO_Init(void);
 void            AUDIO_IO_DeInit(void);
 void            AUDIO_IO_Write(uint8_t Addr, uint8_t Reg, uint8_t Value);
 uint8_t         AUDIO_IO_Read(uint8_t Addr, uint8_t Reg);
+#if defined(AUDIO_IO_BATCH)
+void            AUDIO_IO_WriteBatch(uint8_t Addr, AUDIO_IO_RegTypeDef *pRegs, uint16_t Count);
+#endif /* AUDIO_IO_BATCH */
 /**
   * @}
   */
@@ -415,6 +452,11 @@ static void I2Cx_WriteData(uint8_t Addr, uint8_t Reg, uint8_t Value)
 {
   HAL_StatusTypeDef status = HAL_OK;
   
+#if defined(AUDIO_IO_BATCH)
+  /* The codec register writes batch must be sent first */
+  I2Cx_BatchWait();
+#endif /* AUDIO_IO_BATCH */
+
   status = HAL_I2C_Mem_Write(&I2cHandle, Addr, (uint16_t)Reg, I2C_MEMADD_SIZE_8BIT, &Value, 1, I2cxTimeout); 
 
   /* Check the communication status */
@@ -436,6 +478,11 @@ static uint8_t  I2Cx_ReadData(uint8_t Addr, uint8_t Reg)
   HAL_StatusTypeDef status = HAL_OK;
   uint8_t value = 0;
   
+#if defined(AUDIO_IO_BATCH)
+  /* The codec register writes batch must be sent first */
+  I2Cx_BatchWait();
+#endif /* AUDIO_IO_BATCH */
+
   status = HAL_I2C_Mem_Read(&I2cHandle, Addr, (uint16_t)Reg, I2C_MEMADD_SIZE_8BIT, &value, 1,I2cxTimeout);
   
   /* Check the communication status */
@@ -460,6 +507,112 @@ static void I2Cx_Error(uint8_t Addr)
   I2Cx_Init();
 }
 
+#if defined(AUDIO_IO_BATCH)
+/**
+  * @brief  Starts the I2C DMA transfer of the next codec registers of the batch,
+  *         the ones at consecutive addresses going in the same transfer with
+  *         the register address auto-increment.
+  */
+static void I2Cx_BatchNext(void)
+{
+  uint32_t count = 0;
+  uint8_t reg = 0;
+
+  if(AudioBatchIndex >= AudioBatchCount)
+  {
+    AudioBatchState = AUDIO_IO_BATCH_IDLE;
+  }
+  else
+  {
+    reg = (uint8_t)pAudioBatch[AudioBatchIndex].Reg;
+
+    do
+    {
+      AudioBatchFrame[1 + count] = (uint8_t)pAudioBatch[AudioBatchIndex].Value;
+      AudioBatchIndex++;
+      count++;
+    } while((AudioBatchIndex < AudioBatchCount) && (count < AUDIO_IO_BATCH_RUN_MAX) &&
+            (pAudioBatch[AudioBatchIndex].Reg == (reg + count)));
+
+    AudioBatchFrame[0] = (count > 1)? (reg | AUDIO_IO_BATCH_INCR) : reg;
+
+    if(HAL_I2C_Master_Transmit_DMA(&I2cHandle, AudioBatchAddr, AudioBatchFrame, (uint16_t)(1 + count)) != HAL_OK)
+    {
+      AudioBatchState = AUDIO_IO_BATCH_ERROR;
+    }
+  }
+}
+
+/**
+  * @brief  Goes on with the codec register writes batch once the I2C transfer
+  *         in progress has completed.
+  */
+static void I2Cx_BatchProcess(void)
+{
+  if((AudioBatchState == AUDIO_IO_BATCH_BUSY) && (HAL_I2C_GetState(&I2cHandle) == HAL_I2C_STATE_READY))
+  {
+    if(HAL_I2C_GetError(&I2cHandle) != HAL_I2C_ERROR_NONE)
+    {
+      AudioBatchState = AUDIO_IO_BATCH_ERROR;
+    }
+    else
+    {
+      I2Cx_BatchNext();
+    }
+  }
+}
+
+/**
+  * @brief  Waits for the codec register writes batch to be sent before the I2C
+  *         bus is accessed.
+  */
+static void I2Cx_BatchWait(void)
+{
+  uint32_t tickstart = HAL_GetTick();
+
+  while((AudioBatchState == AUDIO_IO_BATCH_BUSY) && ((HAL_GetTick() - tickstart) < I2cxTimeout))
+  {
+  }
+
+  if(AudioBatchState != AUDIO_IO_BATCH_IDLE)
+  {
+    /* The rest of the batch is dropped */
+    AudioBatchState = AUDIO_IO_BATCH_IDLE;
+    I2Cx_Error(AudioBatchAddr);
+  }
+}
+
+/**
+  * @brief  Handles the I2C event interrupt request.
+  * @note   To be called from DISCOVERY_I2Cx_EV_IRQHandler().
+  */
+void BSP_I2C_EV_IRQHandler(void)
+{
+  HAL_I2C_EV_IRQHandler(&I2cHandle);
+  I2Cx_BatchProcess();
+}
+
+/**
+  * @brief  Handles the I2C error interrupt request.
+  * @note   To be called from DISCOVERY_I2Cx_ER_IRQHandler().
+  */
+void BSP_I2C_ER_IRQHandler(void)
+{
+  HAL_I2C_ER_IRQHandler(&I2cHandle);
+  I2Cx_BatchProcess();
+}
+
+/**
+  * @brief  Handles the I2C DMA Tx interrupt request.
+  * @note   To be called from DISCOVERY_I2Cx_DMAx_TX_IRQHandler().
+  */
+void BSP_I2C_DMA_Tx_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(I2cHandle.hdmatx);
+  I2Cx_BatchProcess();
+}
+#endif /* AUDIO_IO_BATCH */
+
 /**
   * @brief I2C MSP Initialization
   */
@@ -494,6 +647,38 @@ static void I2Cx_MspInit(void)
   /* Enable and set I2Cx Interrupt to the highest priority */
   HAL_NVIC_SetPriority(DISCOVERY_I2Cx_ER_IRQn, 0, 0);
   HAL_NVIC_EnableIRQ(DISCOVERY_I2Cx_ER_IRQn); 
+
+#if defined(AUDIO_IO_BATCH)
+  /* Enable the DMA sending the codec register writes batches */
+  DISCOVERY_I2Cx_DMAx_CLK_ENABLE();
+
+  I2cDmaTxHandle.Instance                 = DISCOVERY_I2Cx_DMAx_TX_STREAM;
+  I2cDmaTxHandle.Init.Channel             = DISCOVERY_I2Cx_DMAx_TX_CHANNEL;
+  I2cDmaTxHandle.Init.Direction           = DMA_MEMORY_TO_PERIPH;
+  I2cDmaTxHandle.Init.PeriphInc           = DMA_PINC_DISABLE;
+  I2cDmaTxHandle.Init.MemInc              = DMA_MINC_ENABLE;
+  I2cDmaTxHandle.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+  I2cDmaTxHandle.Init.MemDataAlignment    = DMA_MDATAALIGN_BYTE;
+  I2cDmaTxHandle.Init.Mode                = DMA_NORMAL;
+  I2cDmaTxHandle.Init.Priority            = DMA_PRIORITY_LOW;
+  I2cDmaTxHandle.Init.FIFOMode            = DMA_FIFOMODE_DISABLE;
+  I2cDmaTxHandle.Init.FIFOThreshold       = DMA_FIFO_THRESHOLD_FULL;
+  I2cDmaTxHandle.Init.MemBurst            = DMA_MBURST_SINGLE;
+  I2cDmaTxHandle.Init.PeriphBurst         = DMA_PBURST_SINGLE;
+
+  /* Associate the DMA handle */
+  __HAL_LINKDMA(&I2cHandle, hdmatx, I2cDmaTxHandle);
+
+  /* Deinitialize the Stream for new transfer */
+  HAL_DMA_DeInit(&I2cDmaTxHandle);
+
+  /* Configure the DMA Stream */
+  HAL_DMA_Init(&I2cDmaTxHandle);
+
+  /* Enable and set the DMA transfer complete interrupt */
+  HAL_NVIC_SetPriority(DISCOVERY_I2Cx_DMAx_TX_IRQn, 0, 0);
+  HAL_NVIC_EnableIRQ(DISCOVERY_I2Cx_DMAx_TX_IRQn);
+#endif /* AUDIO_IO_BATCH */
 }
 
 /*******************************************************************************
@@ -627,6 +812,11 @@ void AUDIO_IO_Init(void)
 {
   GPIO_InitTypeDef  GPIO_InitStruct;
   
+#if defined(AUDIO_IO_BATCH)
+  /* The codec is not reset while register writes are sent */
+  I2Cx_BatchWait();
+#endif /* AUDIO_IO_BATCH */
+
   /* Enable Reset GPIO Clock */
   AUDIO_RESET_GPIO_CLK_ENABLE();
   
@@ -682,6 +872,30 @@ uint8_t AUDIO_IO_Read(uint8_t Addr, uint8_t Reg)
   return I2Cx_ReadData(Addr, Reg);
 }
 
+#if defined(AUDIO_IO_BATCH)
+/**
+  * @brief  Starts sending codec register writes and returns, the I2C and DMA
+  *         interrupts go on with the transfers.
+  * @note   The next AUDIO_IO_xxx() call waits for the writes to be sent.
+  * @param  Addr: I2C address
+  * @param  pRegs: Register writes, not modified until they are sent
+  * @param  Count: Number of register writes
+  */
+void AUDIO_IO_WriteBatch(uint8_t Addr, AUDIO_IO_RegTypeDef *pRegs, uint16_t Count)
+{
+  /* Wait for the previous batch */
+  I2Cx_BatchWait();
+
+  pAudioBatch     = pRegs;
+  AudioBatchCount = Count;
+  AudioBatchIndex = 0;
+  AudioBatchAddr  = Addr;
+  AudioBatchState = AUDIO_IO_BATCH_BUSY;
+
+  I2Cx_BatchNext();
+}
+#endif /* AUDIO_IO_BATCH */
+
 /**
   * @}
   */ 
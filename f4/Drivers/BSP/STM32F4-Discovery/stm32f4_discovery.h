@@ -200,6 +200,15 @@ typedef enum
 /* I2C interrupt requests */                  
 #define DISCOVERY_I2Cx_EV_IRQn                    I2C1_EV_IRQn
 #define DISCOVERY_I2Cx_ER_IRQn                    I2C1_ER_IRQn
+#define DISCOVERY_I2Cx_EV_IRQHandler              I2C1_EV_IRQHandler
+#define DISCOVERY_I2Cx_ER_IRQHandler              I2C1_ER_IRQHandler
+
+/* I2C DMA used to send the codec register writes batches (AUDIO_IO_BATCH defined) */
+#define DISCOVERY_I2Cx_DMAx_CLK_ENABLE()          __HAL_RCC_DMA1_CLK_ENABLE()
+#define DISCOVERY_I2Cx_DMAx_TX_STREAM             DMA1_Stream6
+#define DISCOVERY_I2Cx_DMAx_TX_CHANNEL            DMA_CHANNEL_1
+#define DISCOVERY_I2Cx_DMAx_TX_IRQn               DMA1_Stream6_IRQn
+#define DISCOVERY_I2Cx_DMAx_TX_IRQHandler         DMA1_Stream6_IRQHandler
 
 /* Maximum Timeout values for flags waiting loops. These timeouts are not based
    on accurate values, they just guarantee that the application will not remain
@@ -271,6 +280,11 @@ void     BSP_LED_Off(Led_TypeDef Led);
 void     BSP_LED_Toggle(Led_TypeDef Led);
 void     BSP_PB_Init(Button_TypeDef Button, ButtonMode_TypeDef Mode);
 uint32_t BSP_PB_GetState(Button_TypeDef Button);
+#if defined(AUDIO_IO_BATCH)
+void     BSP_I2C_EV_IRQHandler(void);
+void     BSP_I2C_ER_IRQHandler(void);
+void     BSP_I2C_DMA_Tx_IRQHandler(void);
+#endif /* AUDIO_IO_BATCH */
 
 /**
   * @}
@@ -58,6 +58,12 @@
        using the following functions :
        - LCD_SetTransparency()
        - LCD_SetLayerAddress() 
+     o Use an indexed color layer (L8 or AL44), initialized with its palette by
+       BSP_LCD_LayerIndexedInit(): the colors are then palette indexes. Change
+       palette entries during the vertical blanking with BSP_LCD_SetPalette(), or
+       cycle them for palette animation with BSP_LCD_RotatePalette().
+     o Draw an indexed (L8) image with BSP_LCD_DrawIndexedImage(): it is copied
+       to an indexed layer, or converted by DMA2D with its own palette.
   
   + Display on LCD
       o Clear the hole LCD using LCD_Clear() function or only one specified string
@@ -127,6 +133,19 @@ static RCC_PeriphCLKInitTypeDef  PeriphClkInitStruct;
 /* Default LCD configuration with LCD Layer 1 */
 static uint32_t ActiveLayer = 0;
 static LCD_DrawPropTypeDef DrawProp[MAX_LAYER_NUMBER];
+static FONT_AtlasTypeDef   *pFontAtlas = NULL;
+
+/* Frame presentation state, the buffers are indexes in PresentAddress[] */
+#define LCD_PRESENT_NONE           0xFFFFFFFFU
+static uint32_t            PresentAddress[LCD_PRESENT_MAX_BUFFERS];
+static uint32_t            PresentCount = 0;
+static uint32_t            PresentLayer = 0;
+static uint32_t            PresentFront = 0;
+static uint32_t            PresentPending = LCD_PRESENT_NONE;
+static uint32_t            PresentBack = 0;
+
+/* Palettes of the indexed layers, the LTDC CLUT cannot be read back */
+static uint32_t            LayerClut[MAX_LAYER_NUMBER][LCD_CLUT_MAX_SIZE];
 LCD_DrvTypeDef  *LcdDrv;
 /**
   * @}
@@ -136,7 +155,12 @@ LCD_DrvTypeDef  *LcdDrv;
   * @{
   */ 
 static void DrawChar(uint16_t Xpos, uint16_t Ypos, const uint8_t *c);
+static uint8_t LL_DrawGlyph(uint16_t Xpos, uint16_t Ypos, uint8_t Ascii, uint8_t Setup);
+static uint8_t LL_PresentWait(void);
 static void FillBuffer(uint32_t LayerIndex, void *pDst, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint32_t ColorIndex);
+static uint32_t LL_GetPixelSize(void);
+static uint32_t LL_GetClutSize(uint32_t LayerIndex);
+static uint8_t LL_PaletteWrite(uint32_t LayerIndex, uint32_t StartIndex, uint32_t Count);
 static void ConvertLineToARGB8888(void *pSrc, void *pDst, uint32_t xSize, uint32_t ColorMode);
 /**
   * @}
@@ -283,6 +307,118 @@ void BSP_LCD_LayerDefaultInit(uint16_t LayerIndex, uint32_t FB_Address)
   HAL_LTDC_EnableDither(&LtdcHandler);
 }
 
+/**
+  * @brief  Initializes a LCD layer in indexed color, with its palette.
+  * @note   The text and back colors of the layer are palette indexes, 8-bit
+  *         in L8 and alpha in the 4 MSBs in AL44.
+  * @param  LayerIndex: the layer foreground or background. 
+  * @param  FB_Address: the layer frame buffer, one byte per pixel.
+  * @param  PixelFormat: LCD_PIXEL_FORMAT_L8 or LCD_PIXEL_FORMAT_AL44
+  * @param  pClut: the palette, 256 (L8) or 16 (AL44) RGB888 colors
+  */
+void BSP_LCD_LayerIndexedInit(uint16_t LayerIndex, uint32_t FB_Address, uint32_t PixelFormat, uint32_t *pClut)
+{     
+  LCD_LayerCfgTypeDef   Layercfg;
+  uint32_t index = 0;
+
+ /* Layer Init */
+  Layercfg.WindowX0 = 0;
+  Layercfg.WindowX1 = BSP_LCD_GetXSize();
+  Layercfg.WindowY0 = 0;
+  Layercfg.WindowY1 = BSP_LCD_GetYSize(); 
+  Layercfg.PixelFormat = (PixelFormat == LTDC_PIXEL_FORMAT_AL44) ? LTDC_PIXEL_FORMAT_AL44 : LTDC_PIXEL_FORMAT_L8;
+  Layercfg.FBStartAdress = FB_Address;
+  Layercfg.Alpha = 255;
+  Layercfg.Alpha0 = 0;
+  Layercfg.Backcolor.Blue = 0;
+  Layercfg.Backcolor.Green = 0;
+  Layercfg.Backcolor.Red = 0;
+  Layercfg.BlendingFactor1 = LTDC_BLENDING_FACTOR1_PAxCA;
+  Layercfg.BlendingFactor2 = LTDC_BLENDING_FACTOR2_PAxCA;
+  Layercfg.ImageWidth = BSP_LCD_GetXSize();
+  Layercfg.ImageHeight = BSP_LCD_GetYSize();
+  
+  HAL_LTDC_ConfigLayer(&LtdcHandler, &Layercfg, LayerIndex); 
+
+  /* Palette upload, a copy is kept for the entry updates */
+  for(index = 0; index < LL_GetClutSize(LayerIndex); index++)
+  {
+    LayerClut[LayerIndex][index] = pClut[index];
+  }
+  HAL_LTDC_ConfigCLUT(&LtdcHandler, LayerClut[LayerIndex], LL_GetClutSize(LayerIndex), LayerIndex);
+  HAL_LTDC_EnableCLUT(&LtdcHandler, LayerIndex);
+
+  /* First and last palette entries, opaque */
+  if(Layercfg.PixelFormat == LTDC_PIXEL_FORMAT_AL44)
+  {
+    DrawProp[LayerIndex].BackColor = 0xF0;
+    DrawProp[LayerIndex].TextColor = 0xFF;
+  }
+  else
+  {
+    DrawProp[LayerIndex].BackColor = 0x00;
+    DrawProp[LayerIndex].TextColor = 0xFF;
+  }
+  DrawProp[LayerIndex].pFont     = &Font24;
+}
+
+/**
+  * @brief  Changes palette entries of an indexed layer, during the vertical
+  *         blanking so that the frame shown is not torn.
+  * @param  LayerIndex: the layer foreground or background. 
+  * @param  pClut: the new RGB888 colors
+  * @param  StartIndex: first palette entry changed
+  * @param  Count: number of palette entries changed
+  * @retval LCD_OK, LCD_ERROR if the entries are not in the palette, or
+  *         LCD_TIMEOUT when no vertical blanking occurred
+  */
+uint8_t BSP_LCD_SetPalette(uint32_t LayerIndex, uint32_t *pClut, uint32_t StartIndex, uint32_t Count)
+{
+  uint32_t index = 0;
+  
+  if((StartIndex + Count) > LL_GetClutSize(LayerIndex))
+  {
+    return LCD_ERROR;
+  }
+  
+  for(index = 0; index < Count; index++)
+  {
+    LayerClut[LayerIndex][StartIndex + index] = pClut[index];
+  }
+  
+  return LL_PaletteWrite(LayerIndex, StartIndex, Count);
+}
+
+/**
+  * @brief  Cycles palette entries of an indexed layer by one: the pixels of
+  *         each entry take the color of the previous one, the first one the
+  *         color of the last one. Called once per frame, it animates the
+  *         pixels without redrawing them.
+  * @param  LayerIndex: the layer foreground or background. 
+  * @param  StartIndex: first palette entry cycled
+  * @param  Count: number of palette entries cycled
+  * @retval LCD_OK, LCD_ERROR if the entries are not in the palette, or
+  *         LCD_TIMEOUT when no vertical blanking occurred
+  */
+uint8_t BSP_LCD_RotatePalette(uint32_t LayerIndex, uint32_t StartIndex, uint32_t Count)
+{
+  uint32_t index = 0, last = 0;
+  
+  if((Count == 0) || ((StartIndex + Count) > LL_GetClutSize(LayerIndex)))
+  {
+    return LCD_ERROR;
+  }
+  
+  last = LayerClut[LayerIndex][StartIndex + Count - 1];
+  for(index = StartIndex + Count - 1; index > StartIndex; index--)
+  {
+    LayerClut[LayerIndex][index] = LayerClut[LayerIndex][index - 1];
+  }
+  LayerClut[LayerIndex][StartIndex] = last;
+  
+  return LL_PaletteWrite(LayerIndex, StartIndex, Count);
+}
+
 /**
   * @brief  Selects the LCD Layer.
   * @param  LayerIndex: the Layer foreground or background.
@@ -377,6 +513,103 @@ void BSP_LCD_SetLayerAddress_NoReload(uint32_t LayerIndex, uint32_t Address)
   HAL_LTDC_SetAddress_NoReload(&LtdcHandler, Address, LayerIndex);
 }
 
+/**
+  * @brief  Starts the frame presentation on a layer, with 2 or 3 frame buffers.
+  * @note   The first buffer is shown and the drawing functions draw in the
+  *         second one, until BSP_LCD_Present() is called. Each buffer holds
+  *         a full screen in the pixel format of the layer.
+  * @note   The layer address held by the LTDC handle is the back buffer: the
+  *         functions reloading the layer configuration immediately must not
+  *         be used on this layer while the presentation runs.
+  * @param  LayerIndex: Layer foreground or background
+  * @param  pAddress: Frame buffer addresses
+  * @param  Count: Number of frame buffers, 2 (double) or 3 (triple buffering)
+  * @retval LCD status
+  */
+uint8_t BSP_LCD_PresentInit(uint32_t LayerIndex, uint32_t *pAddress, uint32_t Count)
+{
+  uint32_t index;
+  
+  if((Count < 2) || (Count > LCD_PRESENT_MAX_BUFFERS))
+  {
+    return LCD_ERROR;
+  }
+  
+  for(index = 0; index < Count; index++)
+  {
+    PresentAddress[index] = pAddress[index];
+  }
+  PresentCount   = Count;
+  PresentLayer   = LayerIndex;
+  PresentFront   = 0;
+  PresentPending = LCD_PRESENT_NONE;
+  PresentBack    = 1;
+  
+  HAL_LTDC_SetAddress(&LtdcHandler, PresentAddress[PresentFront], PresentLayer);
+  LtdcHandler.LayerCfg[PresentLayer].FBStartAdress = PresentAddress[PresentBack];
+  
+  return LCD_OK;
+}
+
+/**
+  * @brief  Shows the back buffer at the next vertical blanking and selects the
+  *         buffer the next frame is drawn in.
+  * @note   With triple buffering the call only waits when the previous frame
+  *         is still waiting for its vertical blanking; with double buffering
+  *         it waits until the frame is shown.
+  * @retval Address of the new back buffer, 0 on timeout
+  */
+uint32_t BSP_LCD_Present(void)
+{
+  uint32_t index;
+  
+  /* Only one frame can wait for the vertical blanking */
+  if((PresentCount == 0) || (LL_PresentWait() != LCD_OK))
+  {
+    return 0;
+  }
+  
+  /* The layer shadow address is loaded by hardware on the vertical blanking */
+  LTDC_LAYER(&LtdcHandler, PresentLayer)->CFBAR = PresentAddress[PresentBack];
+  LtdcHandler.Instance->SRCR = LTDC_SRCR_VBR;
+  PresentPending = PresentBack;
+  
+  /* With two buffers, the next back buffer is the one shown until now */
+  if((PresentCount == 2) && (LL_PresentWait() != LCD_OK))
+  {
+    return 0;
+  }
+  
+  /* Draw in a buffer neither shown nor waiting to be shown */
+  for(index = 0; index < PresentCount; index++)
+  {
+    if((index != PresentFront) && (index != PresentPending))
+    {
+      break;
+    }
+  }
+  PresentBack = index;
+  LtdcHandler.LayerCfg[PresentLayer].FBStartAdress = PresentAddress[PresentBack];
+  
+  return PresentAddress[PresentBack];
+}
+
+/**
+  * @brief  Tells whether a presented frame is still waiting for the vertical
+  *         blanking.
+  * @retval 1 if a frame is pending, 0 otherwise
+  */
+uint8_t BSP_LCD_IsPresentPending(void)
+{
+  if((PresentPending != LCD_PRESENT_NONE) && ((LtdcHandler.Instance->SRCR & LTDC_SRCR_VBR) == 0))
+  {
+    PresentFront   = PresentPending;
+    PresentPending = LCD_PRESENT_NONE;
+  }
+  
+  return (PresentPending != LCD_PRESENT_NONE) ? 1 : 0;
+}
+
 /**
   * @brief  Sets the Display window.
   * @param  LayerIndex: layer index
@@ -554,7 +787,7 @@ uint32_t BSP_LCD_ReadPixel(uint16_t Xpos, uint16_t Ypos)
   else
   {
     /* Read data value from SDRAM memory */
-    ret = *(__IO uint8_t*) (LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress + (2*(Ypos*BSP_LCD_GetXSize() + Xpos)));    
+    ret = *(__IO uint8_t*) (LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress + (Ypos*BSP_LCD_GetXSize() + Xpos));    
   }
 
   return ret;
@@ -586,6 +819,17 @@ void BSP_LCD_ClearStringLine(uint32_t Line)
   BSP_LCD_SetTextColor(DrawProp[ActiveLayer].TextColor);  
 }
 
+/**
+  * @brief  Sets the glyph atlas used to draw the characters of its font.
+  * @note   The characters of the other fonts are still drawn pixel by pixel.
+  * @param  pAtlas: Glyph atlas built by FONT_AtlasInit(), NULL to disable it
+  * @retval None
+  */
+void BSP_LCD_SetFontAtlas(FONT_AtlasTypeDef *pAtlas)
+{
+  pFontAtlas = pAtlas;
+}
+
 /**
   * @brief  Displays one character.
   * @param  Xpos: start column address
@@ -594,8 +838,12 @@ void BSP_LCD_ClearStringLine(uint32_t Line)
   */
 void BSP_LCD_DisplayChar(uint16_t Xpos, uint16_t Ypos, uint8_t Ascii)
 {
-  DrawChar(Xpos, Ypos, &DrawProp[ActiveLayer].pFont->table[(Ascii-' ') *\
-              DrawProp[ActiveLayer].pFont->Height * ((DrawProp[ActiveLayer].pFont->Width + 7) / 8)]);
+  /* Blit the glyph with DMA2D when the font has an atlas, else plot it */
+  if(LL_DrawGlyph(Xpos, Ypos, Ascii, 1) != LCD_OK)
+  {
+    DrawChar(Xpos, Ypos, &DrawProp[ActiveLayer].pFont->table[(Ascii-' ') *\
+                DrawProp[ActiveLayer].pFont->Height * ((DrawProp[ActiveLayer].pFont->Width + 7) / 8)]);
+  }
 }
 
 /**
@@ -614,6 +862,7 @@ void BSP_LCD_DisplayStringAt(uint16_t X, uint16_t Y, uint8_t *pText, Text_AlignM
   uint16_t refcolumn = 1, i = 0;
   uint32_t size = 0, xsize = 0; 
   uint8_t  *ptr = pText;
+  uint8_t  setup = 1;
   
   /* Get the text size */
   while (*ptr++) size ++ ;
@@ -648,8 +897,16 @@ void BSP_LCD_DisplayStringAt(uint16_t X, uint16_t Y, uint8_t *pText, Text_AlignM
   /* Send the string character by character on LCD */
   while ((*pText != 0) & (((BSP_LCD_GetXSize() - (i*DrawProp[ActiveLayer].pFont->Width)) & 0xFFFF) >= DrawProp[ActiveLayer].pFont->Width))
   {
-    /* Display one character on LCD */
-    BSP_LCD_DisplayChar(refcolumn, Y, *pText);
+    /* Display one character on LCD, the DMA2D set up is shared by the glyphs */
+    if(LL_DrawGlyph(refcolumn, Y, *pText, setup) == LCD_OK)
+    {
+      setup = 0;
+    }
+    else
+    {
+      BSP_LCD_DisplayChar(refcolumn, Y, *pText);
+      setup = 1;
+    }
     /* Decrement the column position by 16 */
     refcolumn += DrawProp[ActiveLayer].pFont->Width;
     /* Point on the next character */
@@ -679,7 +936,7 @@ void BSP_LCD_DrawHLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length)
   uint32_t xaddress = 0;
   
   /* Get the line address */
-  xaddress = (LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress) + 4*(BSP_LCD_GetXSize()*Ypos + Xpos);
+  xaddress = (LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress) + LL_GetPixelSize()*(BSP_LCD_GetXSize()*Ypos + Xpos);
 
   /* Write line */
   FillBuffer(ActiveLayer, (uint32_t *)xaddress, Length, 1, 0, DrawProp[ActiveLayer].TextColor);
@@ -696,7 +953,7 @@ void BSP_LCD_DrawVLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length)
   uint32_t xaddress = 0;
   
   /* Get the line address */
-  xaddress = (LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress) + 4*(BSP_LCD_GetXSize()*Ypos + Xpos);
+  xaddress = (LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress) + LL_GetPixelSize()*(BSP_LCD_GetXSize()*Ypos + Xpos);
   
   /* Write line */
   FillBuffer(ActiveLayer, (uint32_t *)xaddress, 1, Length, (BSP_LCD_GetXSize() - 1), DrawProp[ActiveLayer].TextColor);
@@ -948,6 +1205,95 @@ void BSP_LCD_DrawBitmap(uint32_t X, uint32_t Y, uint8_t *pBmp)
   }
 }
 
+/**
+  * @brief  Draws an indexed color (L8) image with DMA2D.
+  * @note   On an indexed layer the image indexes are copied, shown with the layer
+  *         palette. On an ARGB8888 or RGB565 layer they are converted with the
+  *         image palette, loaded in the DMA2D foreground CLUT.
+  * @param  Xpos: the X position
+  * @param  Ypos: the Y position
+  * @param  Width: image width
+  * @param  Height: image height
+  * @param  pImage: the image, one index per pixel (AL44 on an AL44 layer)
+  * @param  pClut: the image palette, ARGB8888 colors, unused on an indexed layer
+  * @param  ClutSize: number of colors of the image palette, 1 to 256
+  * @retval LCD_OK, LCD_ERROR if the image cannot be drawn, or LCD_TIMEOUT
+  */
+uint8_t BSP_LCD_DrawIndexedImage(uint32_t Xpos, uint32_t Ypos, uint32_t Width, uint32_t Height, uint8_t *pImage,
+                                 uint32_t *pClut, uint32_t ClutSize)
+{
+  DMA2D_CLUTCfgTypeDef clutcfg;
+  uint32_t bytes = LL_GetPixelSize();
+  uint32_t address = 0;
+  
+  if(((Xpos + Width) > BSP_LCD_GetXSize()) || ((Ypos + Height) > BSP_LCD_GetYSize()) ||
+     ((bytes == 3) || ((bytes == 2) && (LtdcHandler.LayerCfg[ActiveLayer].PixelFormat != LTDC_PIXEL_FORMAT_RGB565))))
+  {
+    return LCD_ERROR;
+  }
+  address = LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress + (bytes * ((Ypos * BSP_LCD_GetXSize()) + Xpos));
+  
+  /* Foreground Configuration */
+  Dma2dHandler.LayerCfg[1].AlphaMode = DMA2D_NO_MODIF_ALPHA;
+  Dma2dHandler.LayerCfg[1].InputAlpha = 0xFF;
+  Dma2dHandler.LayerCfg[1].InputOffset = 0;
+  Dma2dHandler.Init.OutputOffset = BSP_LCD_GetXSize() - Width;
+  
+  if(bytes == 1)
+  {
+    /* Memory to memory: the foreground color mode gives the pixel size */
+    Dma2dHandler.Init.Mode         = DMA2D_M2M;
+    Dma2dHandler.Init.ColorMode    = DMA2D_OUTPUT_ARGB8888;
+    Dma2dHandler.LayerCfg[1].InputColorMode = (LtdcHandler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_AL44) ?
+                                               DMA2D_INPUT_AL44 : DMA2D_INPUT_L8;
+  }
+  else
+  {
+    if((pClut == NULL) || (ClutSize == 0) || (ClutSize > 256))
+    {
+      return LCD_ERROR;
+    }
+    /* Memory to memory with pixel format conversion through the CLUT */
+    Dma2dHandler.Init.Mode         = DMA2D_M2M_PFC;
+    Dma2dHandler.Init.ColorMode    = (bytes == 2) ? DMA2D_OUTPUT_RGB565 : DMA2D_OUTPUT_ARGB8888;
+    Dma2dHandler.LayerCfg[1].InputColorMode = DMA2D_INPUT_L8;
+  }
+  
+  Dma2dHandler.Instance = DMA2D; 
+  
+  /* DMA2D Initialization */
+  if((HAL_DMA2D_Init(&Dma2dHandler) != HAL_OK) || (HAL_DMA2D_ConfigLayer(&Dma2dHandler, 1) != HAL_OK))
+  {
+    return LCD_ERROR;
+  }
+  
+  if(bytes != 1)
+  {
+    /* Load the image palette, the size is the number of entries minus one */
+    clutcfg.pCLUT         = pClut;
+    clutcfg.CLUTColorMode = DMA2D_CCM_ARGB8888;
+    clutcfg.Size          = ClutSize - 1;
+    if((HAL_DMA2D_CLUTLoad(&Dma2dHandler, clutcfg, 1) != HAL_OK) ||
+       (HAL_DMA2D_PollForTransfer(&Dma2dHandler, 10) != HAL_OK))
+    {
+      return LCD_ERROR;
+    }
+  }
+  
+  if(HAL_DMA2D_Start(&Dma2dHandler, (uint32_t)pImage, address, Width, Height) != HAL_OK)
+  {
+    return LCD_ERROR;
+  }
+  
+  /* Polling For DMA transfer */  
+  if(HAL_DMA2D_PollForTransfer(&Dma2dHandler, 100) != HAL_OK)
+  {
+    return LCD_TIMEOUT;
+  }
+  
+  return LCD_OK;
+}
+
 /**
   * @brief  Displays a full rectangle.
   * @param  Xpos: the X position
@@ -963,7 +1309,7 @@ void BSP_LCD_FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Hei
   BSP_LCD_SetTextColor(DrawProp[ActiveLayer].TextColor);
 
   /* Get the rectangle start address */
-  xaddress = (LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress) + 4*(BSP_LCD_GetXSize()*Ypos + Xpos);
+  xaddress = (LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress) + LL_GetPixelSize()*(BSP_LCD_GetXSize()*Ypos + Xpos);
 
   /* Fill the rectangle */
   FillBuffer(ActiveLayer, (uint32_t *)xaddress, Width, Height, (BSP_LCD_GetXSize() - Width), DrawProp[ActiveLayer].TextColor);
@@ -1307,8 +1653,16 @@ __weak void BSP_LCD_MspInit(void)
   */
 void BSP_LCD_DrawPixel(uint16_t Xpos, uint16_t Ypos, uint32_t RGB_Code)
 {
-  /* Write data value to all SDRAM memory */
-  *(__IO uint32_t*) (LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress + (4*(Ypos*BSP_LCD_GetXSize() + Xpos))) = RGB_Code;
+  if(LL_GetPixelSize() == 1)
+  {
+    /* Write the palette index to SDRAM memory */
+    *(__IO uint8_t*) (LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress + (Ypos*BSP_LCD_GetXSize() + Xpos)) = (uint8_t)RGB_Code;
+  }
+  else
+  {
+    /* Write data value to all SDRAM memory */
+    *(__IO uint32_t*) (LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress + (4*(Ypos*BSP_LCD_GetXSize() + Xpos))) = RGB_Code;
+  }
 }
 
 /**
@@ -1365,6 +1719,108 @@ static void DrawChar(uint16_t Xpos, uint16_t Ypos, const uint8_t *c)
   }
 }
 
+/**
+  * @brief  Draws a character from the glyph atlas with DMA2D.
+  * @note   The foreground is the glyph coverage in the text color, blended
+  *         over a background of plain back color.
+  * @param  Xpos: Start column address
+  * @param  Ypos: Line where to display the character shape
+  * @param  Ascii: Character ascii code
+  * @param  Setup: 0 to reuse the DMA2D set up of the previous glyph
+  * @retval LCD_OK if the glyph was drawn, LCD_ERROR to draw it pixel by pixel
+  */
+static uint8_t LL_DrawGlyph(uint16_t Xpos, uint16_t Ypos, uint8_t Ascii, uint8_t Setup)
+{
+  sFONT *pfont = DrawProp[ActiveLayer].pFont;
+  const uint8_t *pglyph;
+  uint32_t input_mode, output_mode, bytes;
+  uint32_t address;
+  
+  if((pFontAtlas == NULL) || (pFontAtlas->pFont != pfont))
+  {
+    return LCD_ERROR;
+  }
+  
+  pglyph = FONT_AtlasGetGlyph(pFontAtlas, Ascii);
+  if((pglyph == NULL) || (LL_GetPixelSize() == 1) || ((Xpos + pfont->Width) > BSP_LCD_GetXSize()) || ((Ypos + pfont->Height) > BSP_LCD_GetYSize()))
+  {
+    return LCD_ERROR;
+  }
+  
+  if(LtdcHandler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_RGB565)
+  {
+    output_mode = DMA2D_OUTPUT_RGB565;
+    bytes = 2;
+  }
+  else
+  {
+    output_mode = DMA2D_OUTPUT_ARGB8888;
+    bytes = 4;
+  }
+  address = LtdcHandler.LayerCfg[ActiveLayer].FBStartAdress + (bytes * ((Ypos * BSP_LCD_GetXSize()) + Xpos));
+  
+  if(Setup != 0)
+  {
+    input_mode = (pFontAtlas->ColorMode == FONT_ATLAS_A4) ? DMA2D_INPUT_A4 : DMA2D_INPUT_A8;
+    
+    /* Configure the DMA2D Mode, Color Mode and output offset */
+    Dma2dHandler.Init.Mode         = DMA2D_M2M_BLEND;
+    Dma2dHandler.Init.ColorMode    = output_mode;
+    Dma2dHandler.Init.OutputOffset = BSP_LCD_GetXSize() - pfont->Width;
+    
+    /* Foreground Configuration: glyph coverage in the text color */
+    Dma2dHandler.LayerCfg[1].AlphaMode = DMA2D_NO_MODIF_ALPHA;
+    Dma2dHandler.LayerCfg[1].InputAlpha = DrawProp[ActiveLayer].TextColor;
+    Dma2dHandler.LayerCfg[1].InputColorMode = input_mode;
+    Dma2dHandler.LayerCfg[1].InputOffset = 0;
+    
+    /* Background Configuration: back color, the read coverage is replaced */
+    Dma2dHandler.LayerCfg[0].AlphaMode = DMA2D_REPLACE_ALPHA;
+    Dma2dHandler.LayerCfg[0].InputAlpha = DrawProp[ActiveLayer].BackColor;
+    Dma2dHandler.LayerCfg[0].InputColorMode = input_mode;
+    Dma2dHandler.LayerCfg[0].InputOffset = 0;
+    
+    Dma2dHandler.Instance = DMA2D;
+    
+    /* DMA2D Initialization */
+    if((HAL_DMA2D_Init(&Dma2dHandler) != HAL_OK) ||
+       (HAL_DMA2D_ConfigLayer(&Dma2dHandler, 0) != HAL_OK) ||
+       (HAL_DMA2D_ConfigLayer(&Dma2dHandler, 1) != HAL_OK))
+    {
+      return LCD_ERROR;
+    }
+  }
+  
+  if(HAL_DMA2D_BlendingStart(&Dma2dHandler, (uint32_t)pglyph, (uint32_t)pglyph, address, pfont->Width, pfont->Height) != HAL_OK)
+  {
+    return LCD_ERROR;
+  }
+  
+  /* Polling For DMA transfer */
+  HAL_DMA2D_PollForTransfer(&Dma2dHandler, 10);
+  
+  return LCD_OK;
+}
+
+/**
+  * @brief  Waits until the presented frame is shown.
+  * @retval LCD_OK, or LCD_TIMEOUT when no vertical blanking occurred
+  */
+static uint8_t LL_PresentWait(void)
+{
+  uint32_t tickstart = HAL_GetTick();
+  
+  while(BSP_LCD_IsPresentPending() != 0)
+  {
+    if((HAL_GetTick() - tickstart) > 100)
+    {
+      return LCD_TIMEOUT;
+    }
+  }
+  
+  return LCD_OK;
+}
+
 /**
   * @brief  Fills buffer.
   * @param  LayerIndex: layer index
@@ -1376,6 +1832,22 @@ static void DrawChar(uint16_t Xpos, uint16_t Ypos, const uint8_t *c)
   */
 static void FillBuffer(uint32_t LayerIndex, void * pDst, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint32_t ColorIndex) 
 {
+  uint8_t *pindex = (uint8_t *)pDst;
+  uint32_t x = 0;
+  
+  if(LL_GetPixelSize() == 1)
+  {
+    /* No DMA2D output color mode for the indexed layers: filled by the CPU */
+    for(; ySize > 0; ySize--)
+    {
+      for(x = 0; x < xSize; x++)
+      {
+        *pindex++ = (uint8_t)ColorIndex;
+      }
+      pindex += OffLine;
+    }
+    return;
+  }
   
   /* Register to memory mode with ARGB8888 as color Mode */ 
   Dma2dHandler.Init.Mode         = DMA2D_R2M;
@@ -1398,6 +1870,86 @@ static void FillBuffer(uint32_t LayerIndex, void * pDst, uint32_t xSize, uint32_
   } 
 }
 
+/**
+  * @brief  Gets the pixel size of the active layer.
+  * @retval Bytes per pixel
+  */
+static uint32_t LL_GetPixelSize(void)
+{
+  switch(LtdcHandler.LayerCfg[ActiveLayer].PixelFormat)
+  {
+  case LTDC_PIXEL_FORMAT_ARGB8888:
+    return 4;
+  case LTDC_PIXEL_FORMAT_RGB888:
+    return 3;
+  case LTDC_PIXEL_FORMAT_L8:
+  case LTDC_PIXEL_FORMAT_AL44:
+    return 1;
+  default:
+    return 2;
+  }
+}
+
+/**
+  * @brief  Gets the palette size of a layer.
+  * @param  LayerIndex: layer index
+  * @retval Number of palette entries, 0 if the layer is not indexed
+  */
+static uint32_t LL_GetClutSize(uint32_t LayerIndex)
+{
+  switch(LtdcHandler.LayerCfg[LayerIndex].PixelFormat)
+  {
+  case LTDC_PIXEL_FORMAT_L8:
+    return LCD_CLUT_MAX_SIZE;
+  case LTDC_PIXEL_FORMAT_AL44:
+    return 16;
+  default:
+    return 0;
+  }
+}
+
+/**
+  * @brief  Writes palette entries of a layer to the LTDC CLUT, at the start of
+  *         the vertical blanking, or at once when the LTDC is disabled.
+  * @param  LayerIndex: layer index
+  * @param  StartIndex: first palette entry
+  * @param  Count: number of palette entries
+  * @retval LCD_OK, or LCD_TIMEOUT when no vertical blanking occurred
+  */
+static uint8_t LL_PaletteWrite(uint32_t LayerIndex, uint32_t StartIndex, uint32_t Count)
+{
+  uint32_t tickstart = HAL_GetTick();
+  uint32_t index = 0, address = 0;
+  
+  if((LtdcHandler.Instance->GCR & LTDC_GCR_LTDCEN) != 0)
+  {
+    /* Wait for the active display, then for the blanking after it */
+    while((LtdcHandler.Instance->CDSR & LTDC_CDSR_VDES) == 0)
+    {
+      if((HAL_GetTick() - tickstart) > 100)
+      {
+        return LCD_TIMEOUT;
+      }
+    }
+    while((LtdcHandler.Instance->CDSR & LTDC_CDSR_VDES) != 0)
+    {
+      if((HAL_GetTick() - tickstart) > 100)
+      {
+        return LCD_TIMEOUT;
+      }
+    }
+  }
+  
+  for(index = StartIndex; index < (StartIndex + Count); index++)
+  {
+    /* Same CLUT addresses as HAL_LTDC_ConfigCLUT() */
+    address = (LtdcHandler.LayerCfg[LayerIndex].PixelFormat == LTDC_PIXEL_FORMAT_AL44) ? (index * 17) : index;
+    LTDC_LAYER(&LtdcHandler, LayerIndex)->CLUTWR = (address << 24) | (LayerClut[LayerIndex][index] & 0x00FFFFFF);
+  }
+  
+  return LCD_OK;
+}
+
 /**
   * @brief  Converts Line to ARGB8888 pixel format.
   * @param  pSrc: pointer to source buffer
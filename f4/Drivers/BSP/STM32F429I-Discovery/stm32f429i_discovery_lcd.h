@@ -72,6 +72,16 @@ typedef enum
   LCD_TIMEOUT = 2
 }LCD_StatusTypeDef;
 
+/** 
+  * @brief  Maximum number of frame buffers of the frame presentation  
+  */
+#define LCD_PRESENT_MAX_BUFFERS  3
+
+/** 
+  * @brief  Colour look-up table entries of the L8 layers, the AL44 layers have 16  
+  */
+#define LCD_CLUT_MAX_SIZE        256
+
 typedef struct 
 { 
   uint32_t  TextColor; 
@@ -187,10 +197,16 @@ uint32_t BSP_LCD_GetYSize(void);
 
 /* functions using the LTDC controller */
 void     BSP_LCD_LayerDefaultInit(uint16_t LayerIndex, uint32_t FrameBuffer);
+void     BSP_LCD_LayerIndexedInit(uint16_t LayerIndex, uint32_t FrameBuffer, uint32_t PixelFormat, uint32_t *pClut);
+uint8_t  BSP_LCD_SetPalette(uint32_t LayerIndex, uint32_t *pClut, uint32_t StartIndex, uint32_t Count);
+uint8_t  BSP_LCD_RotatePalette(uint32_t LayerIndex, uint32_t StartIndex, uint32_t Count);
 void     BSP_LCD_SetTransparency(uint32_t LayerIndex, uint8_t Transparency);
 void     BSP_LCD_SetTransparency_NoReload(uint32_t LayerIndex, uint8_t Transparency);
 void     BSP_LCD_SetLayerAddress(uint32_t LayerIndex, uint32_t Address);
 void     BSP_LCD_SetLayerAddress_NoReload(uint32_t LayerIndex, uint32_t Address);
+uint8_t  BSP_LCD_PresentInit(uint32_t LayerIndex, uint32_t *pAddress, uint32_t Count);
+uint32_t BSP_LCD_Present(void);
+uint8_t  BSP_LCD_IsPresentPending(void);
 void     BSP_LCD_SetColorKeying(uint32_t LayerIndex, uint32_t RGBValue);
 void     BSP_LCD_SetColorKeying_NoReload(uint32_t LayerIndex, uint32_t RGBValue);
 void     BSP_LCD_ResetColorKeying(uint32_t LayerIndex);
@@ -215,6 +231,7 @@ void     BSP_LCD_Clear(uint32_t Color);
 void     BSP_LCD_ClearStringLine(uint32_t Line);
 void     BSP_LCD_DisplayStringAtLine(uint16_t Line, uint8_t *ptr);
 void     BSP_LCD_DisplayStringAt(uint16_t X, uint16_t Y, uint8_t *pText, Text_AlignModeTypdef mode);
+void     BSP_LCD_SetFontAtlas(FONT_AtlasTypeDef *pAtlas);
 void     BSP_LCD_DisplayChar(uint16_t Xpos, uint16_t Ypos, uint8_t Ascii);
 
 void     BSP_LCD_DrawHLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length);
@@ -225,6 +242,8 @@ void     BSP_LCD_DrawCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius);
 void     BSP_LCD_DrawPolygon(pPoint Points, uint16_t PointCount);
 void     BSP_LCD_DrawEllipse(int Xpos, int Ypos, int XRadius, int YRadius);
 void     BSP_LCD_DrawBitmap(uint32_t X, uint32_t Y, uint8_t *pBmp);
+uint8_t  BSP_LCD_DrawIndexedImage(uint32_t Xpos, uint32_t Ypos, uint32_t Width, uint32_t Height, uint8_t *pImage,
+                                  uint32_t *pClut, uint32_t ClutSize);
 
 void     BSP_LCD_FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
 void     BSP_LCD_FillCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius);
@@ -0,0 +1,522 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2018 STMicroelectronics. All rights reserved.
+*
+* Project:       CMSIS DSP Library
+* Title:         arm_fft_benchmark_example.c
+*
+* Description:   Cycle count benchmark of the complex and real FFT kernels
+*                for every transform length, data type and flash/cache
+*                configuration of the device.
+*
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of STMicroelectronics nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+ * -------------------------------------------------------------------- */
+
+/**
+ * @ingroup groupExamples
+ */
+
+/**
+ * @defgroup FFTBenchmark FFT Benchmark Example
+ *
+ * \par Description
+ * \par
+ * Measures the execution time of the complex FFT (arm_cfft_f32,
+ * arm_cfft_q31, arm_cfft_q15) and real FFT (arm_rfft_fast_f32,
+ * arm_rfft_q31, arm_rfft_q15) kernels on the target, for every supported
+ * transform length up to \c BENCH_MAX_FFT_LEN, under each flash
+ * accelerator and cache configuration the device provides.
+ *
+ * \par Algorithm:
+ * \par
+ * Each transform runs \c BENCH_REPEAT times on a freshly generated input
+ * and the smallest cycle count is kept. Cycles are counted with the DWT
+ * cycle counter on Cortex-M3/M4/M7 and with SysTick on Cortex-M0, where
+ * a single call must then stay below 2^24 cycles.
+ * \par
+ * The results are printed as one line per measurement,
+ * <code>kernel;length;config;cycles;time_us</code>, through
+ * \c bench_putchar(). The default implementation writes to ITM stimulus
+ * port 0 (SWO); provide your own (UART) on Cortex-M0 or to redirect it.
+ * The system clock must be configured before \c main() is entered.
+ *
+ * \par Variables Description:
+ * \par
+ * \li \c bench_in, \c bench_out transform buffers
+ * \li \c bench_configs flash/cache configurations measured on this device
+ *
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_cfft_f32(), arm_cfft_q31(), arm_cfft_q15()
+ * - arm_rfft_fast_init_f32(), arm_rfft_fast_f32()
+ * - arm_rfft_init_q31(), arm_rfft_q31()
+ * - arm_rfft_init_q15(), arm_rfft_q15()
+ *
+ * <b> Refer  </b>
+ * \link arm_fft_benchmark_example.c \endlink
+ *
+ */
+
+
+/** \example arm_fft_benchmark_example.c
+  */
+
+#include "stm32f4xx.h"
+#include "arm_math.h"
+#include "arm_const_structs.h"
+
+/* Largest transform measured; the buffers take 16 bytes per point */
+#ifndef BENCH_MAX_FFT_LEN
+#if (__CORTEX_M == 0U)
+#define BENCH_MAX_FFT_LEN   256U
+#else
+#define BENCH_MAX_FFT_LEN   1024U
+#endif
+#endif
+
+/* Runs per measurement, the fastest one is reported */
+#ifndef BENCH_REPEAT
+#define BENCH_REPEAT        4U
+#endif
+
+#ifndef __WEAK
+#if defined(__ICCARM__)
+#define __WEAK              __weak
+#else
+#define __WEAK              __attribute__((weak))
+#endif
+#endif
+
+/* Flash/cache configuration flags */
+#define BENCH_CFG_PREFETCH  0x01U   /* flash prefetch buffer          */
+#define BENCH_CFG_FLASH     0x02U   /* ART accelerator / flash caches */
+#define BENCH_CFG_ICACHE    0x04U   /* Cortex-M7 instruction cache    */
+#define BENCH_CFG_DCACHE    0x08U   /* Cortex-M7 data cache           */
+
+typedef struct
+{
+  const char *name;
+  uint32_t    flags;
+} bench_config_t;
+
+typedef enum
+{
+  BENCH_CFFT_F32 = 0,
+  BENCH_CFFT_Q31,
+  BENCH_CFFT_Q15,
+  BENCH_RFFT_F32,
+  BENCH_RFFT_Q31,
+  BENCH_RFFT_Q15,
+  BENCH_KERNEL_NBR
+} bench_kernel_t;
+
+/* ------------------------------------------------------------------
+* Global variables for FFT Benchmark Example
+* ------------------------------------------------------------------- */
+static const bench_config_t bench_configs[] =
+{
+  { "none",           0U },
+#if defined(FLASH_ACR_PRFTBE) || defined(FLASH_ACR_PRFTEN)
+  { "prefetch",       BENCH_CFG_PREFETCH },
+#endif
+#if defined(FLASH_ACR_ARTEN) || defined(FLASH_ACR_ICEN)
+  { "prefetch+art",   BENCH_CFG_PREFETCH | BENCH_CFG_FLASH },
+#endif
+#if (__CORTEX_M == 7U)
+  { "icache",         BENCH_CFG_PREFETCH | BENCH_CFG_FLASH | BENCH_CFG_ICACHE },
+  { "icache+dcache",  BENCH_CFG_PREFETCH | BENCH_CFG_FLASH | BENCH_CFG_ICACHE | BENCH_CFG_DCACHE },
+#endif
+};
+
+static const char * const bench_names[BENCH_KERNEL_NBR] =
+{
+  "cfft_f32", "cfft_q31", "cfft_q15", "rfft_f32", "rfft_q31", "rfft_q15"
+};
+
+/* Shortest and longest length of each kernel */
+static const uint32_t bench_min_len[BENCH_KERNEL_NBR] = { 16U, 16U, 16U, 32U, 32U, 32U };
+static const uint32_t bench_max_len[BENCH_KERNEL_NBR] = { 4096U, 4096U, 4096U, 4096U, 8192U, 8192U };
+
+static uint32_t bench_in[2U * BENCH_MAX_FFT_LEN];
+static uint32_t bench_out[2U * BENCH_MAX_FFT_LEN];
+static uint32_t bench_seed;
+
+/* ----------------------------------------------------------------------
+* Output
+* ------------------------------------------------------------------- */
+
+/* Send one character of the result table; override to use a UART */
+__WEAK void bench_putchar(char ch)
+{
+#if (__CORTEX_M >= 3U)
+  (void)ITM_SendChar((uint32_t)ch);
+#else
+  (void)ch;
+#endif
+}
+
+static void bench_puts(const char *str)
+{
+  while (*str != '\0')
+  {
+    bench_putchar(*str++);
+  }
+}
+
+/* Print an unsigned value with at least 'digits' digits, a decimal point
+   being inserted before the last 'decimals' digits */
+static void bench_putu(uint32_t value, uint32_t digits, uint32_t decimals)
+{
+  char buf[12];
+  uint32_t n = 0U;
+
+  do
+  {
+    buf[n++] = (char)('0' + (value % 10U));
+    value /= 10U;
+  } while (((value != 0U) || (n < digits)) && (n < sizeof(buf)));
+
+  while (n > 0U)
+  {
+    if ((n == decimals) && (decimals != 0U))
+    {
+      bench_putchar('.');
+    }
+    bench_putchar(buf[--n]);
+  }
+}
+
+/* ----------------------------------------------------------------------
+* Cycle counter
+* ------------------------------------------------------------------- */
+static void bench_timer_init(void)
+{
+#if (__CORTEX_M >= 3U)
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#if (__CORTEX_M == 7U)
+  DWT->LAR = 0xC5ACCE55U;
+#endif
+  DWT->CYCCNT = 0U;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#else
+  SysTick->LOAD = SysTick_LOAD_RELOAD_Msk;
+  SysTick->VAL = 0U;
+  SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+#endif
+}
+
+static __INLINE uint32_t bench_timer_get(void)
+{
+#if (__CORTEX_M >= 3U)
+  return DWT->CYCCNT;
+#else
+  return SysTick->VAL;
+#endif
+}
+
+static __INLINE uint32_t bench_timer_elapsed(uint32_t start, uint32_t end)
+{
+#if (__CORTEX_M >= 3U)
+  return end - start;
+#else
+  /* SysTick counts down on 24 bits */
+  return (start - end) & SysTick_LOAD_RELOAD_Msk;
+#endif
+}
+
+/* ----------------------------------------------------------------------
+* Flash accelerator and caches
+* ------------------------------------------------------------------- */
+static void bench_apply_config(uint32_t flags)
+{
+#if defined(FLASH_ACR_PRFTBE)
+  if ((flags & BENCH_CFG_PREFETCH) != 0U)
+  {
+    FLASH->ACR |= FLASH_ACR_PRFTBE;
+  }
+  else
+  {
+    FLASH->ACR &= ~FLASH_ACR_PRFTBE;
+  }
+#elif defined(FLASH_ACR_PRFTEN)
+  if ((flags & BENCH_CFG_PREFETCH) != 0U)
+  {
+    FLASH->ACR |= FLASH_ACR_PRFTEN;
+  }
+  else
+  {
+    FLASH->ACR &= ~FLASH_ACR_PRFTEN;
+  }
+#endif
+
+#if defined(FLASH_ACR_ARTEN)
+  /* The ART accelerator is reset while disabled, to start cold */
+  FLASH->ACR &= ~FLASH_ACR_ARTEN;
+  FLASH->ACR |= FLASH_ACR_ARTRST;
+  FLASH->ACR &= ~FLASH_ACR_ARTRST;
+  if ((flags & BENCH_CFG_FLASH) != 0U)
+  {
+    FLASH->ACR |= FLASH_ACR_ARTEN;
+  }
+#elif defined(FLASH_ACR_ICEN)
+  FLASH->ACR &= ~(FLASH_ACR_ICEN | FLASH_ACR_DCEN);
+  FLASH->ACR |= (FLASH_ACR_ICRST | FLASH_ACR_DCRST);
+  FLASH->ACR &= ~(FLASH_ACR_ICRST | FLASH_ACR_DCRST);
+  if ((flags & BENCH_CFG_FLASH) != 0U)
+  {
+    FLASH->ACR |= (FLASH_ACR_ICEN | FLASH_ACR_DCEN);
+  }
+#endif
+
+#if (__CORTEX_M == 7U)
+  if ((flags & BENCH_CFG_ICACHE) != 0U)
+  {
+    SCB_EnableICache();
+  }
+  else
+  {
+    SCB_DisableICache();
+  }
+
+  if ((flags & BENCH_CFG_DCACHE) != 0U)
+  {
+    SCB_EnableDCache();
+  }
+  else
+  {
+    SCB_DisableDCache();
+  }
+#endif
+}
+
+/* ----------------------------------------------------------------------
+* Kernels
+* ------------------------------------------------------------------- */
+static uint32_t bench_rand(void)
+{
+  bench_seed = (bench_seed * 1664525U) + 1013904223U;
+  return bench_seed;
+}
+
+/* Fill the input with 'nbr' pseudo-random samples within half scale */
+static void bench_fill(bench_kernel_t kernel, uint32_t nbr)
+{
+  uint32_t i;
+
+  for (i = 0U; i < nbr; i++)
+  {
+    switch (kernel)
+    {
+    case BENCH_CFFT_F32:
+    case BENCH_RFFT_F32:
+      ((float32_t *)bench_in)[i] = (float32_t)((int32_t)bench_rand() >> 8) / 33554432.0f;
+      break;
+
+    case BENCH_CFFT_Q31:
+    case BENCH_RFFT_Q31:
+      ((q31_t *)bench_in)[i] = (q31_t)bench_rand() >> 1;
+      break;
+
+    default:
+      ((q15_t *)bench_in)[i] = (q15_t)((int32_t)bench_rand() >> 17);
+      break;
+    }
+  }
+}
+
+static const arm_cfft_instance_f32 *bench_cfft_f32(uint32_t len)
+{
+  switch (len)
+  {
+  case 16U:   return &arm_cfft_sR_f32_len16;
+  case 32U:   return &arm_cfft_sR_f32_len32;
+  case 64U:   return &arm_cfft_sR_f32_len64;
+  case 128U:  return &arm_cfft_sR_f32_len128;
+  case 256U:  return &arm_cfft_sR_f32_len256;
+  case 512U:  return &arm_cfft_sR_f32_len512;
+  case 1024U: return &arm_cfft_sR_f32_len1024;
+  case 2048U: return &arm_cfft_sR_f32_len2048;
+  default:    return &arm_cfft_sR_f32_len4096;
+  }
+}
+
+static const arm_cfft_instance_q31 *bench_cfft_q31(uint32_t len)
+{
+  switch (len)
+  {
+  case 16U:   return &arm_cfft_sR_q31_len16;
+  case 32U:   return &arm_cfft_sR_q31_len32;
+  case 64U:   return &arm_cfft_sR_q31_len64;
+  case 128U:  return &arm_cfft_sR_q31_len128;
+  case 256U:  return &arm_cfft_sR_q31_len256;
+  case 512U:  return &arm_cfft_sR_q31_len512;
+  case 1024U: return &arm_cfft_sR_q31_len1024;
+  case 2048U: return &arm_cfft_sR_q31_len2048;
+  default:    return &arm_cfft_sR_q31_len4096;
+  }
+}
+
+static const arm_cfft_instance_q15 *bench_cfft_q15(uint32_t len)
+{
+  switch (len)
+  {
+  case 16U:   return &arm_cfft_sR_q15_len16;
+  case 32U:   return &arm_cfft_sR_q15_len32;
+  case 64U:   return &arm_cfft_sR_q15_len64;
+  case 128U:  return &arm_cfft_sR_q15_len128;
+  case 256U:  return &arm_cfft_sR_q15_len256;
+  case 512U:  return &arm_cfft_sR_q15_len512;
+  case 1024U: return &arm_cfft_sR_q15_len1024;
+  case 2048U: return &arm_cfft_sR_q15_len2048;
+  default:    return &arm_cfft_sR_q15_len4096;
+  }
+}
+
+/* Return the best cycle count of a kernel at a given length */
+static uint32_t bench_run(bench_kernel_t kernel, uint32_t len)
+{
+  arm_rfft_fast_instance_f32 rfft_f32;
+  arm_rfft_instance_q31 rfft_q31;
+  arm_rfft_instance_q15 rfft_q15;
+  uint32_t best = 0xFFFFFFFFU;
+  uint32_t start;
+  uint32_t cycles;
+  uint32_t n;
+
+  /* Initialisation is not part of the measurement */
+  if (kernel == BENCH_RFFT_F32)
+  {
+    (void)arm_rfft_fast_init_f32(&rfft_f32, (uint16_t)len);
+  }
+  else if (kernel == BENCH_RFFT_Q31)
+  {
+    (void)arm_rfft_init_q31(&rfft_q31, len, 0U, 1U);
+  }
+  else if (kernel == BENCH_RFFT_Q15)
+  {
+    (void)arm_rfft_init_q15(&rfft_q15, len, 0U, 1U);
+  }
+  else
+  {
+    /* Complex transforms use the constant instances */
+  }
+
+  for (n = 0U; n < BENCH_REPEAT; n++)
+  {
+    /* Complex transforms work in place on 2 * len values */
+    bench_fill(kernel, (kernel <= BENCH_CFFT_Q15) ? (2U * len) : len);
+    start = bench_timer_get();
+
+    switch (kernel)
+    {
+    case BENCH_CFFT_F32:
+      arm_cfft_f32(bench_cfft_f32(len), (float32_t *)bench_in, 0U, 1U);
+      break;
+
+    case BENCH_CFFT_Q31:
+      arm_cfft_q31(bench_cfft_q31(len), (q31_t *)bench_in, 0U, 1U);
+      break;
+
+    case BENCH_CFFT_Q15:
+      arm_cfft_q15(bench_cfft_q15(len), (q15_t *)bench_in, 0U, 1U);
+      break;
+
+    case BENCH_RFFT_F32:
+      arm_rfft_fast_f32(&rfft_f32, (float32_t *)bench_in, (float32_t *)bench_out, 0U);
+      break;
+
+    case BENCH_RFFT_Q31:
+      arm_rfft_q31(&rfft_q31, (q31_t *)bench_in, (q31_t *)bench_out);
+      break;
+
+    default:
+      arm_rfft_q15(&rfft_q15, (q15_t *)bench_in, (q15_t *)bench_out);
+      break;
+    }
+
+    cycles = bench_timer_elapsed(start, bench_timer_get());
+    if (cycles < best)
+    {
+      best = cycles;
+    }
+  }
+
+  return best;
+}
+
+/* ----------------------------------------------------------------------
+* FFT benchmark
+* ------------------------------------------------------------------- */
+
+int32_t main(void)
+{
+  uint32_t cfg;
+  uint32_t kernel;
+  uint32_t len;
+  uint32_t cycles;
+
+  bench_timer_init();
+
+  bench_puts("\r\nCMSIS-DSP FFT benchmark, SystemCoreClock ");
+  bench_putu(SystemCoreClock, 1U, 0U);
+  bench_puts(" Hz\r\nkernel;length;config;cycles;time_us\r\n");
+
+  for (cfg = 0U; cfg < (sizeof(bench_configs) / sizeof(bench_configs[0])); cfg++)
+  {
+    bench_apply_config(bench_configs[cfg].flags);
+
+    for (kernel = 0U; kernel < (uint32_t)BENCH_KERNEL_NBR; kernel++)
+    {
+      for (len = bench_min_len[kernel];
+           (len <= bench_max_len[kernel]) && (len <= BENCH_MAX_FFT_LEN);
+           len <<= 1)
+      {
+        bench_seed = len;
+        cycles = bench_run((bench_kernel_t)kernel, len);
+
+        bench_puts(bench_names[kernel]);
+        bench_putchar(';');
+        bench_putu(len, 1U, 0U);
+        bench_putchar(';');
+        bench_puts(bench_configs[cfg].name);
+        bench_putchar(';');
+        bench_putu(cycles, 1U, 0U);
+        bench_putchar(';');
+        /* time in hundredths of a microsecond */
+        bench_putu((uint32_t)(((uint64_t)cycles * 100000000U) / SystemCoreClock), 3U, 2U);
+        bench_puts("\r\n");
+      }
+    }
+  }
+
+  bench_puts("done\r\n");
+
+  while(1);                             /* main function does not return */
+}
+
+ /** \endlink */
@@ -0,0 +1,164 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_biquad_cascade_mc_df1_q31.c  
+*    
+* Description:	Processing function for the Q31 multichannel Biquad cascade filter.  
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @addtogroup BiquadCascadeDF1    
+ * @{    
+ */
+
+/**    
+ * @brief Processing function for the Q31 multichannel Biquad cascade filter.    
+ * @param[in]  *S         points to an instance of the Q31 multichannel Biquad cascade structure.    
+ * @param[in]  *pSrc      points to the block of interleaved input frames.    
+ * @param[out] *pDst      points to the block of interleaved output frames.    
+ * @param[in]  blockSize  number of frames to process.    
+ * @return none.    
+ *    
+ * \par    
+ * The input and output hold <code>blockSize</code> frames of <code>numChannels</code>    
+ * interleaved samples, and may be the same buffer. All channels are filtered by the    
+ * same cascade, each channel keeping its own state.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * As for <code>arm_biquad_cascade_df1_q31()</code>, the accumulation is performed on 64 bits    
+ * in 2.62 format, shifted by <code>postShift+1</code> bits and truncated to 1.31 format.    
+ * The input must be scaled down by 2 bits to avoid overflows.    
+ */
+
+void arm_biquad_cascade_mc_df1_q31(
+  const arm_biquad_casd_mc_df1_inst_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q63_t acc;                                     /*  accumulator                   */
+  uint32_t uShift = ((uint32_t) S->postShift + 1u);
+  uint32_t lShift = 32u - uShift;                /*  Shift to be applied to the output */
+  q31_t *pIn = pSrc;                             /*  stage input pointer           */
+  q31_t *pI, *pO;                                /*  channel input and output      */
+  q31_t *pState = S->pState;                     /*  pState pointer initialization */
+  q31_t *pCoeffs = S->pCoeffs;                   /*  coeff pointer initialization  */
+  uint32_t numChannels = S->numChannels;         /*  frame length                  */
+  q31_t Xn1, Xn2, Yn1, Yn2;                      /*  Filter state variables        */
+  q31_t b0, b1, b2, a1, a2;                      /*  Filter coefficients           */
+  q31_t Xn;                                      /*  temporary input               */
+  q31_t acc_l, acc_h;                            /*  temporary output variables    */
+  uint32_t sample, ch, stage = S->numStages;     /*  loop counters                 */
+
+  do
+  {
+    /* Reading the coefficients */
+    b0 = pCoeffs[0];
+    b1 = pCoeffs[1];
+    b2 = pCoeffs[2];
+    a1 = pCoeffs[3];
+    a2 = pCoeffs[4];
+
+    for (ch = 0u; ch < numChannels; ch++)
+    {
+      /* Reading the state values of the channel */
+      Xn1 = pState[(4u * ch) + 0u];
+      Xn2 = pState[(4u * ch) + 1u];
+      Yn1 = pState[(4u * ch) + 2u];
+      Yn2 = pState[(4u * ch) + 3u];
+
+      pI = pIn + ch;
+      pO = pDst + ch;
+      sample = blockSize;
+
+      while(sample > 0u)
+      {
+        Xn = *pI;
+
+        /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+        acc = (q63_t) b0 *Xn;
+        acc += (q63_t) b1 *Xn1;
+        acc += (q63_t) b2 *Xn2;
+        acc += (q63_t) a1 *Yn1;
+        acc += (q63_t) a2 *Yn2;
+
+        /* Every time after the output is computed state should be updated. */
+        Xn2 = Xn1;
+        Xn1 = Xn;
+        Yn2 = Yn1;
+
+        /* The result is converted to 1.31 */
+        acc_l = acc & 0xffffffff;
+        acc_h = (acc >> 32) & 0xffffffff;
+        Yn1 = (uint32_t) acc_l >> lShift | acc_h << uShift;
+
+        *pO = Yn1;
+
+        /* Next frame */
+        pI += numChannels;
+        pO += numChannels;
+        sample--;
+      }
+
+      /*  Store the updated state variables back into the pState array */
+      pState[(4u * ch) + 0u] = Xn1;
+      pState[(4u * ch) + 1u] = Xn2;
+      pState[(4u * ch) + 2u] = Yn1;
+      pState[(4u * ch) + 3u] = Yn2;
+    }
+
+    /* Next stage: coefficients, states of all channels */
+    pCoeffs += 5u;
+    pState += 4u * numChannels;
+
+    /*  The current stage input is given as the output to the next stage */
+    pIn = pDst;
+
+    /* decrement the loop counter */
+    stage--;
+
+  } while(stage > 0u);
+}
+
+/**    
+ * @} end of BiquadCascadeDF1 group    
+ */
@@ -0,0 +1,142 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_mat_cholesky_solve_f64.c    
+*    
+* Description:	Solve of a symmetric positive-definite system from its Cholesky factor.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.    
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSolve
+ * @{
+ */
+
+/**
+ * @brief Double-precision floating-point solve of a symmetric positive-definite system from its Cholesky factor.
+ * @param[in]       *pL points to the Cholesky factor L of A, from arm_mat_cholesky_f64()
+ * @param[in]       *pSrc points to the right-hand side matrix structure B
+ * @param[out]      *pDst points to the solution matrix structure X of A * X = B, which can be B
+ * @return     		The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if L is not square or if the sizes of B and X do not
+ * match its size. If a diagonal element of L is zero, then the function returns
+ * <code>ARM_MATH_SINGULAR</code>. Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.
+ */
+
+arm_status arm_mat_cholesky_solve_f64(
+  const arm_matrix_instance_f64 * pL,
+  const arm_matrix_instance_f64 * pSrc,
+  arm_matrix_instance_f64 * pDst)
+{
+  float64_t *pOut = pDst->pData;                 /* solution pointer */
+  float64_t *pX, *pY;                            /* rows of the solution */
+  float64_t coef;                                /* element of the factor */
+  uint32_t n = pL->numRows;                      /* size of the factor */
+  uint32_t m = pSrc->numCols;                    /* number of right-hand sides */
+  uint32_t i, k, c;                              /* loop counters */
+  arm_status status;                             /* status of the solve */
+
+  /* Forward substitution: L * Y = B */
+  status = arm_mat_solve_lower_triangular_f64(pL, pSrc, pDst);
+
+  if(status == ARM_MATH_SUCCESS)
+  {
+
+    /* Back substitution with L^T, whose row i is column i of L */
+    for (i = n; i > 0u; i--)
+    {
+      for (k = i; k < n; k++)
+      {
+        coef = pL->pData[(k * n) + (i - 1u)];
+        pX = pOut + ((i - 1u) * m);
+        pY = pOut + (k * m);
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+        /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+        /* Loop unrolling */
+        c = m >> 2u;
+        while(c > 0u)
+        {
+          pX[0] -= coef * pY[0];
+          pX[1] -= coef * pY[1];
+          pX[2] -= coef * pY[2];
+          pX[3] -= coef * pY[3];
+          pX += 4u;
+          pY += 4u;
+          c--;
+        }
+
+        /* Remaining 1 to 3 columns */
+        c = m % 0x4u;
+
+#else
+
+        /* Run the below code for Cortex-M0 */
+
+        c = m;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+        while(c > 0u)
+        {
+          *pX++ -= coef * *pY++;
+          c--;
+        }
+      }
+
+      /* X(i,:) /= L(i,i) */
+      coef = 1.0 / pL->pData[((i - 1u) * n) + (i - 1u)];
+      pX = pOut + ((i - 1u) * m);
+      for (c = 0u; c < m; c++)
+      {
+        pX[c] *= coef;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixSolve group
+ */
@@ -0,0 +1,113 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_stats_get_q31.c  
+*    
+* Description:	Results of the Q31 batch statistics.  
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupStats    
+ */
+
+/**    
+ * @addtogroup Stats    
+ * @{    
+ */
+
+/**    
+ * @brief Results of the Q31 batch statistics.    
+ * @param[in]       *S points to an instance of the Q31 statistics structure.    
+ * @param[out]      *pResult statistics of the samples accumulated since the initialization    
+ * @return none.    
+ *    
+ * <b>Scaling and Overflow Behavior:</b>    
+ * \par    
+ * The sum is accumulated in 64 bits at full precision, giving the same mean as <code>arm_mean_q31()</code>.    
+ * As in <code>arm_var_q31()</code>, the squares are computed on the inputs truncated to 9.23 format    
+ * and accumulated in 64 bits in 18.46 format, which bounds the number of full scale samples    
+ * accumulated to 2<sup>17</sup>. The variance and the mean square are then converted to 1.31 format,    
+ * and the root mean square is computed by <code>arm_sqrt_q31()</code>.    
+ * \par    
+ * All results are zero when no sample has been accumulated, and the variance is zero    
+ * for a single sample.    
+ */
+
+void arm_stats_get_q31(
+  const arm_stats_instance_q31 * S,
+  arm_stats_result_q31 * pResult)
+{
+  q63_t count = (q63_t) S->count;                /* Number of samples */
+  q63_t sum23;                                   /* Sum of the samples in 9.23 format */
+  q63_t squareOfSum;                             /* Square of the sum divided by the number of samples */
+
+  if(S->count == 0u)
+  {
+    pResult->mean = 0;
+    pResult->var = 0;
+    pResult->rms = 0;
+  }
+  else
+  {
+    pResult->mean = (q31_t) (S->sum / count);
+
+    if(S->count == 1u)
+    {
+      pResult->var = 0;
+    }
+    else
+    {
+      /* The mean is computed first to keep the product in 64 bits: sum * sum / count */
+      sum23 = S->sum >> 8;
+      squareOfSum = (sum23 / count) * sum23;
+
+      /* Convert the result from 18.46 to 1.31 format */
+      pResult->var = (q31_t) (((S->sumOfSquares - squareOfSum) / (count - 1)) >> 15);
+    }
+
+    arm_sqrt_q31(clip_q63_to_q31((S->sumOfSquares / count) >> 15), &pResult->rms);
+  }
+
+  pResult->min = S->min;
+  pResult->max = S->max;
+  pResult->minIndex = S->minIndex;
+  pResult->maxIndex = S->maxIndex;
+}
+
+/**    
+ * @} end of Stats group    
+ */
@@ -0,0 +1,356 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nnfunctions.h
+ * Description:  Public header file for CMSIS NN Library
+ *
+ * $Date:        17. January 2018
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#ifndef _ARM_NNFUNCTIONS_H
+#define _ARM_NNFUNCTIONS_H
+
+#include "arm_nnsupportfunctions.h"
+
+/**
+   \mainpage CMSIS NN Software Library
+   *
+   * Introduction
+   * ------------
+   *
+   * This user manual describes the CMSIS NN software library,
+   * a collection of efficient neural network kernels developed to maximize the
+   * performance and minimize the memory footprint of neural networks on Cortex-M processor cores.
+   *
+   * The library is divided into a number of functions each covering a specific category:
+   * - Convolution Functions
+   * - Activation Functions
+   * - Fully-connected Layer Functions
+   * - Pooling Functions
+   * - Softmax Functions
+   * - Support Functions
+   *
+   * The library has separate functions for operating on different weight and activation data
+   * types including 8-bit integers (q7_t) and 16-bit integers (q15_t). The kernels use the
+   * SIMD instructions of Cortex-M4 and Cortex-M7 (SMLAD on sign-extended q7 pairs) when
+   * ARM_MATH_DSP is available and plain C code on other cores.
+   *
+   * Fixed-point format
+   * ------------
+   *
+   * Weights, biases and activations are power-of-two scaled fixed-point values. Each layer
+   * accumulates its products in 32 bits, the bias being left-shifted by <code>bias_shift</code>
+   * to the accumulator format and the result being rounded, right-shifted by
+   * <code>out_shift</code> and saturated to the output type.
+   *
+   * Scratch buffers
+   * ------------
+   *
+   * The kernels do not allocate memory. Convolutions expand their input patches (im2col) into
+   * a caller-provided q15_t scratch buffer, whose size is given in the description of each
+   * function; a single arena sized for the largest layer may be shared by all the layers of
+   * a network.
+   *
+   * Examples
+   * --------
+   *
+   * The library ships with a benchmark example which measures the cycle count
+   * of every kernel on the target.
+   *
+   * Pre-processor Macros
+   * ------------
+   *
+   * - ARM_MATH_DSP:
+   *
+   * Selects the SIMD code. It is defined automatically for ARM_MATH_CM4 and ARM_MATH_CM7.
+   *
+   * - ARM_MATH_BIG_ENDIAN:
+   *
+   * Define macro ARM_MATH_BIG_ENDIAN to build the library for big endian targets.
+   */
+
+/**
+ * @defgroup groupNN Neural Network Functions
+ * These functions perform basic operations for neural network layers.
+ */
+
+#ifdef __cplusplus
+extern    "C"
+{
+#endif
+
+/**
+ * @defgroup NNConv Neural Network Convolution Functions
+ *
+ * Perform convolution layer
+ *
+ * The convolution is implemented in 2 steps: im2col and GEMM
+ *
+ * im2col is a process of converting each patch of image data into
+ * a column. After im2col, the convolution is computed as matrix-matrix
+ * multiplication.
+ *
+ * To reduce the memory footprint, the im2col is performed partially.
+ * Each iteration, only a few column (i.e., patches) are generated and
+ * computed with GEMM kernels similar to CMSIS-DSP arm_mat_mult functions.
+ *
+ * Images are stored in HWC order: channels are contiguous, then columns, then rows.
+ * Only square images, kernels and strides are supported.
+ */
+
+  /**
+   * @brief Basic Q7 convolution function
+   * @param[in]       Im_in       pointer to input tensor
+   * @param[in]       dim_im_in   input tensor dimension
+   * @param[in]       ch_im_in    number of input tensor channels
+   * @param[in]       wt          pointer to kernel weights
+   * @param[in]       ch_im_out   number of filters, i.e., output tensor channels
+   * @param[in]       dim_kernel  filter kernel size
+   * @param[in]       padding     padding sizes
+   * @param[in]       stride      convolution stride
+   * @param[in]       bias        pointer to bias
+   * @param[in]       bias_shift  amount of left-shift for bias
+   * @param[in]       out_shift   amount of right-shift for output
+   * @param[in,out]   Im_out      pointer to output tensor
+   * @param[in]       dim_im_out  output tensor dimension
+   * @param[in,out]   bufferA     pointer to buffer space for input
+   * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+   *
+   */
+
+  arm_status arm_convolve_HWC_q7_basic(const q7_t * Im_in,
+                                       const uint16_t dim_im_in,
+                                       const uint16_t ch_im_in,
+                                       const q7_t * wt,
+                                       const uint16_t ch_im_out,
+                                       const uint16_t dim_kernel,
+                                       const uint16_t padding,
+                                       const uint16_t stride,
+                                       const q7_t * bias,
+                                       const uint16_t bias_shift,
+                                       const uint16_t out_shift,
+                                       q7_t * Im_out,
+                                       const uint16_t dim_im_out,
+                                       q15_t * bufferA);
+
+  /**
+   * @brief Q7 depthwise separable convolution function
+   * @param[in]       Im_in       pointer to input tensor
+   * @param[in]       dim_im_in   input tensor dimension
+   * @param[in]       ch_im_in    number of input tensor channels
+   * @param[in]       wt          pointer to kernel weights
+   * @param[in]       ch_im_out   number of filters, i.e., output tensor channels
+   * @param[in]       dim_kernel  filter kernel size
+   * @param[in]       padding     padding sizes
+   * @param[in]       stride      convolution stride
+   * @param[in]       bias        pointer to bias
+   * @param[in]       bias_shift  amount of left-shift for bias
+   * @param[in]       out_shift   amount of right-shift for output
+   * @param[in,out]   Im_out      pointer to output tensor
+   * @param[in]       dim_im_out  output tensor dimension
+   * @param[in,out]   bufferA     pointer to buffer space for input
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   *
+   * Each input channel is filtered by its own kernel, so ch_im_in must be
+   * equal to ch_im_out.
+   *
+   */
+
+  arm_status arm_depthwise_separable_conv_HWC_q7(const q7_t * Im_in,
+                                                 const uint16_t dim_im_in,
+                                                 const uint16_t ch_im_in,
+                                                 const q7_t * wt,
+                                                 const uint16_t ch_im_out,
+                                                 const uint16_t dim_kernel,
+                                                 const uint16_t padding,
+                                                 const uint16_t stride,
+                                                 const q7_t * bias,
+                                                 const uint16_t bias_shift,
+                                                 const uint16_t out_shift,
+                                                 q7_t * Im_out,
+                                                 const uint16_t dim_im_out,
+                                                 q15_t * bufferA);
+
+/**
+ * @defgroup FC Fully-connected Layer Functions
+ *
+ * Perform fully-connected layer
+ *
+ * Fully-connected layer is basically a matrix-vector multiplication
+ * with bias. The matrix is the weights and the input/output vectors
+ * are the activation values. Supported {weight, activation} precisions
+ * include {8-bit, 8-bit} and {16-bit, 16-bit}.
+ *
+ */
+
+  /**
+   * @brief Q7 basic fully-connected layer function
+   * @param[in]       pV          pointer to input vector
+   * @param[in]       pM          pointer to matrix weights
+   * @param[in]       dim_vec     length of the vector
+   * @param[in]       num_of_rows number of rows in weight matrix
+   * @param[in]       bias_shift  amount of left-shift for bias
+   * @param[in]       out_shift   amount of right-shift for output
+   * @param[in]       bias        pointer to bias
+   * @param[in,out]   pOut        pointer to output vector
+   * @param[in,out]   vec_buffer  pointer to buffer space for input
+   * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+   *
+   */
+
+  arm_status arm_fully_connected_q7(const q7_t * pV,
+                                    const q7_t * pM,
+                                    const uint16_t dim_vec,
+                                    const uint16_t num_of_rows,
+                                    const uint16_t bias_shift,
+                                    const uint16_t out_shift,
+                                    const q7_t * bias,
+                                    q7_t * pOut,
+                                    q15_t * vec_buffer);
+
+  /**
+   * @brief Q15 basic fully-connected layer function
+   * @param[in]       pV          pointer to input vector
+   * @param[in]       pM          pointer to matrix weights
+   * @param[in]       dim_vec     length of the vector
+   * @param[in]       num_of_rows number of rows in weight matrix
+   * @param[in]       bias_shift  amount of left-shift for bias
+   * @param[in]       out_shift   amount of right-shift for output
+   * @param[in]       bias        pointer to bias
+   * @param[in,out]   pOut        pointer to output vector
+   * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+   *
+   */
+
+  arm_status arm_fully_connected_q15(const q15_t * pV,
+                                     const q15_t * pM,
+                                     const uint16_t dim_vec,
+                                     const uint16_t num_of_rows,
+                                     const uint16_t bias_shift,
+                                     const uint16_t out_shift,
+                                     const q15_t * bias,
+                                     q15_t * pOut);
+
+/**
+ * @defgroup Acti Neural Network Activation Functions
+ *
+ * Perform activation layers, including ReLU (Rectified Linear Unit).
+ *
+ */
+
+  /**
+   * @brief Q7 RELU function
+   * @param[in,out]   data        pointer to input
+   * @param[in]       size        number of elements
+   * @return none.
+   */
+
+  void      arm_relu_q7(q7_t * data, uint16_t size);
+
+  /**
+   * @brief Q15 RELU function
+   * @param[in,out]   data        pointer to input
+   * @param[in]       size        number of elements
+   * @return none.
+   */
+
+  void      arm_relu_q15(q15_t * data, uint16_t size);
+
+/**
+ * @defgroup Pooling Neural Network Pooling Functions
+ *
+ * Perform pooling functions, including max pooling and average pooling
+ *
+ */
+
+  /**
+   * @brief Q7 max pooling function
+   * @param[in]       Im_in       pointer to input tensor
+   * @param[in]       dim_im_in   input tensor dimension
+   * @param[in]       ch_im_in    number of input tensor channels
+   * @param[in]       dim_kernel  filter kernel size
+   * @param[in]       padding     padding sizes
+   * @param[in]       stride      convolution stride
+   * @param[in]       dim_im_out  output tensor dimension
+   * @param[in,out]   Im_out      pointer to output tensor
+   * @return none.
+   *
+   */
+
+  void      arm_maxpool_q7_HWC(const q7_t * Im_in,
+                               const uint16_t dim_im_in,
+                               const uint16_t ch_im_in,
+                               const uint16_t dim_kernel,
+                               const uint16_t padding,
+                               const uint16_t stride,
+                               const uint16_t dim_im_out,
+                               q7_t * Im_out);
+
+  /**
+   * @brief Q7 average pooling function
+   * @param[in]       Im_in       pointer to input tensor
+   * @param[in]       dim_im_in   input tensor dimension
+   * @param[in]       ch_im_in    number of input tensor channels
+   * @param[in]       dim_kernel  filter kernel size
+   * @param[in]       padding     padding sizes
+   * @param[in]       stride      convolution stride
+   * @param[in]       dim_im_out  output tensor dimension
+   * @param[in,out]   Im_out      pointer to output tensor
+   * @return none.
+   *
+   */
+
+  void      arm_avepool_q7_HWC(const q7_t * Im_in,
+                               const uint16_t dim_im_in,
+                               const uint16_t ch_im_in,
+                               const uint16_t dim_kernel,
+                               const uint16_t padding,
+                               const uint16_t stride,
+                               const uint16_t dim_im_out,
+                               q7_t * Im_out);
+
+/**
+ * @defgroup Softmax Softmax Functions
+ *
+ * EXP(2) based softmax function
+ *
+ */
+
+  /**
+   * @brief Q7 softmax function
+   * @param[in]       vec_in      pointer to input vector
+   * @param[in]       dim_vec     input vector dimension
+   * @param[out]      p_out       pointer to output vector
+   * @return none.
+   *
+   */
+
+  void      arm_softmax_q7(const q7_t * vec_in, const uint16_t dim_vec, q7_t * p_out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,238 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_depthwise_separable_conv_HWC_q7.c
+ * Description:  Q7 depthwise separable convolution function
+ *
+ * $Date:        17. January 2018
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+  /**
+   * @brief Q7 depthwise separable convolution function
+   * @param[in]       Im_in       pointer to input tensor
+   * @param[in]       dim_im_in   input tensor dimension
+   * @param[in]       ch_im_in    number of input tensor channels
+   * @param[in]       wt          pointer to kernel weights
+   * @param[in]       ch_im_out   number of filters, i.e., output tensor channels
+   * @param[in]       dim_kernel  filter kernel size
+   * @param[in]       padding     padding sizes
+   * @param[in]       stride      convolution stride
+   * @param[in]       bias        pointer to bias
+   * @param[in]       bias_shift  amount of left-shift for bias
+   * @param[in]       out_shift   amount of right-shift for output
+   * @param[in,out]   Im_out      pointer to output tensor
+   * @param[in]       dim_im_out  output tensor dimension
+   * @param[in,out]   bufferA     pointer to buffer space for input
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   *
+   * @details
+   *
+   * <b>Buffer size:</b>
+   *
+   * bufferA size: 2*ch_im_in*kernel_len, kernel_len being
+   * dim_kernel*dim_kernel rounded up to an even number. The buffer is
+   * only used on Cortex-M4 and Cortex-M7.
+   *
+   * The weights are stored as dim_kernel * dim_kernel pixels of ch_im_in
+   * values, in HWC order like the input tensor: each channel c of the
+   * input is convolved with the values of channel c of the kernel only.
+   *
+   * The products of one output value do not share a channel: the input
+   * patch has to be transposed before SIMD instructions can be applied.
+   * The kernel is therefore first expanded to q15 in bufferA, one channel
+   * after the other, then for every output pixel the input patch is
+   * expanded the same way next to it, so that each output value becomes
+   * a dot product of kernel_len contiguous q15 pairs computed by SMLAD.
+   */
+
+arm_status arm_depthwise_separable_conv_HWC_q7(const q7_t * Im_in,
+                                               const uint16_t dim_im_in,
+                                               const uint16_t ch_im_in,
+                                               const q7_t * wt,
+                                               const uint16_t ch_im_out,
+                                               const uint16_t dim_kernel,
+                                               const uint16_t padding,
+                                               const uint16_t stride,
+                                               const q7_t * bias,
+                                               const uint16_t bias_shift,
+                                               const uint16_t out_shift,
+                                               q7_t * Im_out,
+                                               const uint16_t dim_im_out,
+                                               q15_t * bufferA)
+{
+  int16_t   i_out_y, i_out_x, i_ker_y, i_ker_x;
+  q7_t     *pOut = Im_out;
+  q31_t     sum;
+  uint16_t  i_ch;
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /* length of one channel of the kernel, padded to whole q15 pairs */
+  const uint16_t kernel_len = (uint16_t)((dim_kernel * dim_kernel + 1u) & ~1u);
+  q15_t    *pWt = bufferA;                       /* kernel, channel by channel */
+  q15_t    *pCol = bufferA + ch_im_in * kernel_len;  /* input patch, channel by channel */
+  const q7_t *pIn;
+  const q15_t *pA;
+  const q15_t *pB;
+  uint16_t  i_ker, colCnt;
+
+  /* check if the input dimension meets the constraints */
+  if (ch_im_in != ch_im_out)
+  {
+    return ARM_MATH_SIZE_MISMATCH;
+  }
+
+  /* transpose the kernel; the padding values are kept at zero so that
+     the patch values in front of them do not contribute */
+  memset(bufferA, 0, sizeof(q15_t) * 2 * ch_im_in * kernel_len);
+  for (i_ker = 0; i_ker < dim_kernel * dim_kernel; i_ker++)
+  {
+    for (i_ch = 0; i_ch < ch_im_in; i_ch++)
+    {
+      pWt[i_ch * kernel_len + i_ker] = wt[i_ker * ch_im_in + i_ch];
+    }
+  }
+
+  for (i_out_y = 0; i_out_y < dim_im_out; i_out_y++)
+  {
+    for (i_out_x = 0; i_out_x < dim_im_out; i_out_x++)
+    {
+      /* im2col of the patch, transposed */
+      i_ker = 0u;
+      for (i_ker_y = i_out_y * stride - padding; i_ker_y < i_out_y * stride - padding + dim_kernel; i_ker_y++)
+      {
+        for (i_ker_x = i_out_x * stride - padding; i_ker_x < i_out_x * stride - padding + dim_kernel; i_ker_x++)
+        {
+          if (i_ker_y < 0 || i_ker_y >= dim_im_in || i_ker_x < 0 || i_ker_x >= dim_im_in)
+          {
+            /* Filling 0 for out-of-bound paddings */
+            for (i_ch = 0; i_ch < ch_im_in; i_ch++)
+            {
+              pCol[i_ch * kernel_len + i_ker] = 0;
+            }
+          }
+          else
+          {
+            pIn = Im_in + (i_ker_y * dim_im_in + i_ker_x) * ch_im_in;
+            for (i_ch = 0; i_ch < ch_im_in; i_ch++)
+            {
+              pCol[i_ch * kernel_len + i_ker] = (q15_t) pIn[i_ch];
+            }
+          }
+          i_ker++;
+        }
+      }
+
+      pA = pWt;
+      pB = pCol;
+
+      for (i_ch = 0; i_ch < ch_im_out; i_ch++)
+      {
+        /* Load the accumulator with bias first */
+        sum = ((q31_t) bias[i_ch] << bias_shift) + NN_ROUND(out_shift);
+
+        /* kernel_len is even, 2 products each time */
+        colCnt = kernel_len >> 1;
+
+        while (colCnt > 0u)
+        {
+          sum = __SMLAD(*__SIMD32_CONST(pA), *__SIMD32_CONST(pB), sum);
+          pA += 2;
+          pB += 2;
+
+          colCnt--;
+        }
+
+        *pOut++ = (q7_t) __SSAT((sum >> out_shift), 8);
+      }
+    }
+  }
+
+#else
+
+  /* Run the below code for Cortex-M0 and Cortex-M3 */
+
+  int16_t   in_y, in_x;
+
+  (void)bufferA;
+
+  /* check if the input dimension meets the constraints */
+  if (ch_im_in != ch_im_out)
+  {
+    return ARM_MATH_SIZE_MISMATCH;
+  }
+
+  for (i_out_y = 0; i_out_y < dim_im_out; i_out_y++)
+  {
+    for (i_out_x = 0; i_out_x < dim_im_out; i_out_x++)
+    {
+      for (i_ch = 0; i_ch < ch_im_out; i_ch++)
+      {
+        /* Load the accumulator with bias first */
+        sum = ((q31_t) bias[i_ch] << bias_shift) + NN_ROUND(out_shift);
+
+        for (i_ker_y = 0; i_ker_y < dim_kernel; i_ker_y++)
+        {
+          for (i_ker_x = 0; i_ker_x < dim_kernel; i_ker_x++)
+          {
+            in_y = i_out_y * stride - padding + i_ker_y;
+            in_x = i_out_x * stride - padding + i_ker_x;
+
+            if (in_y >= 0 && in_y < dim_im_in && in_x >= 0 && in_x < dim_im_in)
+            {
+              sum += (q31_t) Im_in[(in_y * dim_im_in + in_x) * ch_im_in + i_ch] *
+                wt[(i_ker_y * dim_kernel + i_ker_x) * ch_im_in + i_ch];
+            }
+          }
+        }
+
+        *pOut++ = (q7_t) __SSAT((sum >> out_shift), 8);
+      }
+    }
+  }
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  /* Return to application */
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of NNConv group
+ */
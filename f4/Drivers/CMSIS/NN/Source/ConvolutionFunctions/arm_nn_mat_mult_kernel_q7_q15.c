@@ -0,0 +1,222 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nn_mat_mult_kernel_q7_q15.c
+ * Description:  Matrix-multiplication function for convolution
+ *
+ * $Date:        17. January 2018
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnfunctions.h"
+
+  /**
+   * @brief Matrix-multiplication function for convolution
+   * @param[in]       pA          pointer to operand A
+   * @param[in]       pInBuffer   pointer to operand B, always consists of 2 vectors
+   * @param[in]       ch_im_out   numRow of A
+   * @param[in]       numCol_A    numCol of A
+   * @param[in]       bias_shift  amount of left-shift for bias
+   * @param[in]       out_shift   amount of right-shift for output
+   * @param[in]       bias        the bias
+   * @param[in,out]   pOut        pointer to output
+   * @return     The function returns the incremented output pointer
+   *
+   * @details
+   *
+   * This function does the matrix multiplication of weight matrix pA
+   * (ch_im_out rows of numCol_A q7 weights) with two columns from im2col
+   * (stored one after the other in pInBuffer as q15) and produces the two
+   * output pixels, i.e. 2 * ch_im_out values starting at pOut.
+   *
+   * Two rows of A are multiplied with the two columns at a time, so that
+   * each of the four q31 accumulators reuses the weight and input words
+   * loaded for the others: four SMLAD per two q7 weight pairs read.
+   */
+
+q7_t     *arm_nn_mat_mult_kernel_q7_q15(const q7_t * pA,
+                                        const q15_t * pInBuffer,
+                                        const uint16_t ch_im_out,
+                                        const uint16_t numCol_A,
+                                        const uint16_t bias_shift,
+                                        const uint16_t out_shift,
+                                        const q7_t * bias,
+                                        q7_t * pOut)
+{
+  /* the second output pixel */
+  q7_t     *pOut2 = pOut + ch_im_out;
+  const q7_t *pBias = bias;
+  const q7_t *pA2;                               /* second row of A */
+  const q15_t *pB;                               /* first column */
+  const q15_t *pB2;                              /* second column */
+  q31_t     sum, sum2, sum3, sum4;               /* accumulators */
+  uint16_t  rowCnt, colCnt;                      /* loop counters */
+#if defined (ARM_MATH_DSP)
+  q31_t     inA11, inA12, inA21, inA22;
+  q31_t     inB1, inB2;
+#endif
+
+  /* Run two rows of A at a time */
+  rowCnt = ch_im_out >> 1;
+
+  while (rowCnt > 0u)
+  {
+    pB = pInBuffer;
+    pB2 = pB + numCol_A;
+    pA2 = pA + numCol_A;
+
+    /* init the sum with bias */
+    sum = ((q31_t)(*pBias++) << bias_shift) + NN_ROUND(out_shift);
+    sum2 = sum;
+    sum3 = ((q31_t)(*pBias++) << bias_shift) + NN_ROUND(out_shift);
+    sum4 = sum3;
+
+#if defined (ARM_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+    colCnt = numCol_A >> 2;
+
+    /* accumulate over the vectors, 4 weights of each row at a time */
+    while (colCnt > 0u)
+    {
+      inB1 = *__SIMD32_CONST(pB);
+      pB += 2;
+      inB2 = *__SIMD32_CONST(pB2);
+      pB2 += 2;
+
+      pA = read_and_pad(pA, &inA11, &inA12);
+      pA2 = read_and_pad(pA2, &inA21, &inA22);
+
+      sum = __SMLAD(inA11, inB1, sum);
+      sum2 = __SMLAD(inA11, inB2, sum2);
+      sum3 = __SMLAD(inA21, inB1, sum3);
+      sum4 = __SMLAD(inA21, inB2, sum4);
+
+      inB1 = *__SIMD32_CONST(pB);
+      pB += 2;
+      inB2 = *__SIMD32_CONST(pB2);
+      pB2 += 2;
+
+      sum = __SMLAD(inA12, inB1, sum);
+      sum2 = __SMLAD(inA12, inB2, sum2);
+      sum3 = __SMLAD(inA22, inB1, sum3);
+      sum4 = __SMLAD(inA22, inB2, sum4);
+
+      colCnt--;
+    }
+
+    colCnt = numCol_A & 0x3u;
+
+#else
+
+    /* Run the below code for Cortex-M0 and Cortex-M3 */
+
+    colCnt = numCol_A;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    while (colCnt > 0u)
+    {
+      sum += (q31_t) pA[0] * pB[0];
+      sum2 += (q31_t) pA[0] * pB2[0];
+      sum3 += (q31_t) pA2[0] * pB[0];
+      sum4 += (q31_t) pA2[0] * pB2[0];
+      pA++;
+      pA2++;
+      pB++;
+      pB2++;
+
+      colCnt--;
+    }
+
+    *pOut++ = (q7_t) __SSAT((sum >> out_shift), 8);
+    *pOut++ = (q7_t) __SSAT((sum3 >> out_shift), 8);
+    *pOut2++ = (q7_t) __SSAT((sum2 >> out_shift), 8);
+    *pOut2++ = (q7_t) __SSAT((sum4 >> out_shift), 8);
+
+    /* skip the row already processed through pA2 */
+    pA += numCol_A;
+
+    rowCnt--;
+  }
+
+  /* compute the last odd numbered row if any */
+  if (ch_im_out & 0x1u)
+  {
+    pB = pInBuffer;
+    pB2 = pB + numCol_A;
+
+    /* load the bias */
+    sum = ((q31_t)(*pBias) << bias_shift) + NN_ROUND(out_shift);
+    sum2 = sum;
+
+#if defined (ARM_MATH_DSP)
+    colCnt = numCol_A >> 2;
+
+    while (colCnt > 0u)
+    {
+      pA = read_and_pad(pA, &inA11, &inA12);
+
+      inB1 = *__SIMD32_CONST(pB);
+      pB += 2;
+      inB2 = *__SIMD32_CONST(pB2);
+      pB2 += 2;
+
+      sum = __SMLAD(inA11, inB1, sum);
+      sum2 = __SMLAD(inA11, inB2, sum2);
+
+      inB1 = *__SIMD32_CONST(pB);
+      pB += 2;
+      inB2 = *__SIMD32_CONST(pB2);
+      pB2 += 2;
+
+      sum = __SMLAD(inA12, inB1, sum);
+      sum2 = __SMLAD(inA12, inB2, sum2);
+
+      colCnt--;
+    }
+
+    colCnt = numCol_A & 0x3u;
+#else
+    colCnt = numCol_A;
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    while (colCnt > 0u)
+    {
+      sum += (q31_t) pA[0] * pB[0];
+      sum2 += (q31_t) pA[0] * pB2[0];
+      pA++;
+      pB++;
+      pB2++;
+
+      colCnt--;
+    }
+
+    *pOut++ = (q7_t) __SSAT((sum >> out_shift), 8);
+    *pOut2++ = (q7_t) __SSAT((sum2 >> out_shift), 8);
+  }
+
+  /* pOut2 now points right after the second pixel */
+  return pOut2;
+}
@@ -0,0 +1,221 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_fully_connected_q7.c
+ * Description:  Q7 basic fully-connected layer function
+ *
+ * $Date:        17. January 2018
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup FC
+ * @{
+ */
+
+  /**
+   * @brief Q7 basic fully-connected layer function
+   * @param[in]       pV          pointer to input vector
+   * @param[in]       pM          pointer to matrix weights
+   * @param[in]       dim_vec     length of the vector
+   * @param[in]       num_of_rows number of rows in weight matrix
+   * @param[in]       bias_shift  amount of left-shift for bias
+   * @param[in]       out_shift   amount of right-shift for output
+   * @param[in]       bias        pointer to bias
+   * @param[in,out]   pOut        pointer to output vector
+   * @param[in,out]   vec_buffer  pointer to buffer space for input
+   * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+   *
+   * @details
+   *
+   * <b>Buffer size:</b>
+   *
+   * vec_buffer size: dim_vec
+   *
+   * The weight matrix is stored row by row, num_of_rows rows of dim_vec
+   * values. The input vector is expanded once to q15 in vec_buffer, in the
+   * order produced by arm_q7_to_q15_reordered_no_shift(), so that the
+   * weights can be sign-extended with a single SXTB16 per pair; two rows
+   * are then processed at a time to share the loads of the vector.
+   */
+
+arm_status
+arm_fully_connected_q7(const q7_t * pV,
+                       const q7_t * pM,
+                       const uint16_t dim_vec,
+                       const uint16_t num_of_rows,
+                       const uint16_t bias_shift,
+                       const uint16_t out_shift,
+                       const q7_t * bias,
+                       q7_t * pOut,
+                       q15_t * vec_buffer)
+{
+  const q7_t *pBias = bias;
+  const q7_t *pA = pM;
+  q31_t     sum;
+  uint16_t  rowCnt, colCnt;
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  const q7_t *pA2;
+  const q15_t *pB;
+  q31_t     sum2;
+  q31_t     inV1, inV2, inM11, inM12, inM21, inM22;
+
+  arm_q7_to_q15_reordered_no_shift(pV, vec_buffer, dim_vec);
+
+  /* Run 2 rows at a time */
+  rowCnt = num_of_rows >> 1;
+
+  while (rowCnt > 0u)
+  {
+    pB = vec_buffer;
+    pA2 = pA + dim_vec;
+
+    sum = ((q31_t)(*pBias++) << bias_shift) + NN_ROUND(out_shift);
+    sum2 = ((q31_t)(*pBias++) << bias_shift) + NN_ROUND(out_shift);
+
+    colCnt = dim_vec >> 2;
+
+    while (colCnt > 0u)
+    {
+      inV1 = *__SIMD32_CONST(pB);
+      pB += 2;
+      inV2 = *__SIMD32_CONST(pB);
+      pB += 2;
+
+      pA = read_and_pad_reordered(pA, &inM11, &inM12);
+      pA2 = read_and_pad_reordered(pA2, &inM21, &inM22);
+
+      sum = __SMLAD(inV1, inM11, sum);
+      sum = __SMLAD(inV2, inM12, sum);
+      sum2 = __SMLAD(inV1, inM21, sum2);
+      sum2 = __SMLAD(inV2, inM22, sum2);
+
+      colCnt--;
+    }
+
+    /* the remaining values of the vector are in order */
+    colCnt = dim_vec & 0x3u;
+
+    while (colCnt > 0u)
+    {
+      sum += (q31_t) * pB * *pA++;
+      sum2 += (q31_t) * pB++ * *pA2++;
+
+      colCnt--;
+    }
+
+    *pOut++ = (q7_t) (__SSAT((sum >> out_shift), 8));
+    *pOut++ = (q7_t) (__SSAT((sum2 >> out_shift), 8));
+
+    /* the next row starts where the second one ends */
+    pA = pA2;
+
+    rowCnt--;
+  }
+
+  /* compute the last odd numbered row if any */
+  if (num_of_rows & 0x1u)
+  {
+    pB = vec_buffer;
+
+    sum = ((q31_t)(*pBias) << bias_shift) + NN_ROUND(out_shift);
+
+    colCnt = dim_vec >> 2;
+
+    while (colCnt > 0u)
+    {
+      inV1 = *__SIMD32_CONST(pB);
+      pB += 2;
+      inV2 = *__SIMD32_CONST(pB);
+      pB += 2;
+
+      pA = read_and_pad_reordered(pA, &inM11, &inM12);
+
+      sum = __SMLAD(inV1, inM11, sum);
+      sum = __SMLAD(inV2, inM12, sum);
+
+      colCnt--;
+    }
+
+    colCnt = dim_vec & 0x3u;
+
+    while (colCnt > 0u)
+    {
+      sum += (q31_t) * pB++ * *pA++;
+
+      colCnt--;
+    }
+
+    *pOut++ = (q7_t) (__SSAT((sum >> out_shift), 8));
+  }
+
+#else
+
+  /* Run the below code for Cortex-M0 and Cortex-M3 */
+
+  const q7_t *pB;
+
+  (void)vec_buffer;
+
+  rowCnt = num_of_rows;
+
+  while (rowCnt > 0u)
+  {
+    pB = pV;
+
+    sum = ((q31_t)(*pBias++) << bias_shift) + NN_ROUND(out_shift);
+
+    colCnt = dim_vec;
+
+    while (colCnt > 0u)
+    {
+      sum += (q31_t) * pB++ * *pA++;
+
+      colCnt--;
+    }
+
+    *pOut++ = (q7_t) (__SSAT((sum >> out_shift), 8));
+
+    rowCnt--;
+  }
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  /* Return to application */
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of FC group
+ */
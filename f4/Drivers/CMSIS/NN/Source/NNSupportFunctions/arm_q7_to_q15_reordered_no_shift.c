@@ -0,0 +1,153 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_q7_to_q15_reordered_no_shift.c
+ * Description:  Converts the elements of the Q7 vector to reordered Q15 vector without left-shift
+ *
+ * $Date:        17. January 2018
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_nnsupportfunctions.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup nndata_convert
+ * @{
+ */
+
+/**
+ * @brief Converts the elements of the Q7 vector to reordered Q15 vector without left-shift
+ * @param[in]       *pSrc points to the Q7 input vector
+ * @param[out]      *pDst points to the Q15 output vector
+ * @param[in]       blockSize length of the input vector
+ * @return none.
+ *
+ * @details
+ *
+ * This function does the q7 to q15 expansion with re-ordering
+ *
+ * <pre>
+ *                          |   A1   |   A2   |   A3   |   A4   |
+ *
+ *                           0      7 8     15 16    23 24    31
+ * </pre>
+ *
+ * is converted into:
+ *
+ * <pre>
+ *  |       A1       |       A3       |   and  |       A2       |       A4       |
+ *
+ *   0             15 16            31          0             15 16            31
+ * </pre>
+ *
+ *
+ * This looks strange but is natural considering how sign-extension is done at
+ * assembly level: a q7 word expanded by read_and_pad_reordered() comes out in
+ * the same order, which saves the two pack instructions per word.
+ *
+ * The remaining values when blockSize is not a multiple of 4 are copied in
+ * order.
+ */
+
+void arm_q7_to_q15_reordered_no_shift(const q7_t * pSrc, q15_t * pDst, uint32_t blockSize)
+{
+  const q7_t *pIn = pSrc;                        /* Src pointer */
+  uint32_t  blkCnt;                              /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+  q31_t     in;
+  q31_t     in1, in2;
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time. */
+  while (blkCnt > 0u)
+  {
+    /* C = (q15_t) A */
+    in = *__SIMD32_CONST(pIn);
+    pIn += 4;
+
+    /* rotate in by 8 and extend bytes 1 and 3 */
+    in1 = __SXTB16(__ROR((uint32_t)in, 8));
+
+    /* extend bytes 0 and 2 */
+    in2 = __SXTB16(in);
+
+#ifndef ARM_MATH_BIG_ENDIAN
+    *__SIMD32(pDst)++ = in2;
+    *__SIMD32(pDst)++ = in1;
+#else
+    *__SIMD32(pDst)++ = in1;
+    *__SIMD32(pDst)++ = in2;
+#endif
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+#else
+
+  /* Run the below code for Cortex-M0 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  while (blkCnt > 0u)
+  {
+    pDst[0] = (q15_t) pIn[0];
+    pDst[1] = (q15_t) pIn[2];
+    pDst[2] = (q15_t) pIn[1];
+    pDst[3] = (q15_t) pIn[3];
+    pIn += 4;
+    pDst += 4;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  /* If the blockSize is not a multiple of 4, copy the remaining values in order */
+  blkCnt = blockSize % 0x4u;
+
+  while (blkCnt > 0u)
+  {
+    /* C = (q15_t) A */
+    *pDst++ = (q15_t) * pIn++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+}
+
+/**
+ * @} end of nndata_convert group
+ */
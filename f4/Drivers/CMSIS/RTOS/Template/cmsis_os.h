@@ -219,6 +219,13 @@ typedef struct os_mailQ_def  {
   void                       *pool;    ///< memory array for mail
 } osMailQDef_t;
  
+#if defined (OS_MAIL_STATIC)
+/// Static storage, in 32-bit words, of a memory pool or a mail queue of \a no items of
+/// \a sz bytes, control block included (Utilities/IPC/os_mail.c).
+#define OS_POOL_WORDS(no, sz)      (4U + ((no) * (((sz) + 3U) / 4U)))
+#define OS_MAILQ_WORDS(no, sz)     (8U + ((no) * (((sz) + 3U) / 4U)) + (4U * (no)))
+#endif
+ 
 /// Event structure contains detailed information about an event.
 /// \note MUST REMAIN UNCHANGED: \b os_event shall be consistent in every CMSIS-RTOS.
 ///       However the struct may be extended at the end.
@@ -537,6 +544,11 @@ osStatus osSemaphoreDelete (osSemaphoreId semaphore_id);
 #if defined (osObjectsExternal)  // object is external
 #define osPoolDef(name, no, type)   \
 extern const osPoolDef_t os_pool_def_##name
+#elif defined (OS_MAIL_STATIC)   // static storage, no heap
+#define osPoolDef(name, no, type)   \
+static uint32_t os_pool_m_##name[OS_POOL_WORDS((no), sizeof(type))]; \
+const osPoolDef_t os_pool_def_##name = \
+{ (no), sizeof(type), os_pool_m_##name }
 #else                            // define the object
 #define osPoolDef(name, no, type)   \
 const osPoolDef_t os_pool_def_##name = \
@@ -642,6 +654,11 @@ osEvent osMessageGet (osMessageQId queue_id, uint32_t millisec);
 #if defined (osObjectsExternal)  // object is external
 #define osMailQDef(name, queue_sz, type) \
 extern const osMailQDef_t os_mailQ_def_##name
+#elif defined (OS_MAIL_STATIC)   // static storage, no heap
+#define osMailQDef(name, queue_sz, type) \
+static uint32_t os_mailQ_m_##name[OS_MAILQ_WORDS((queue_sz), sizeof(type))]; \
+const osMailQDef_t os_mailQ_def_##name =  \
+{ (queue_sz), sizeof (type), os_mailQ_m_##name }
 #else                            // define the object
 #define osMailQDef(name, queue_sz, type) \
 const osMailQDef_t os_mailQ_def_##name =  \
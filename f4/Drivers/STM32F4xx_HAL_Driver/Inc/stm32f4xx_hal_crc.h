@@ -85,16 +85,48 @@ typedef struct
 
   __IO HAL_CRC_StateTypeDef   State;      /*!< CRC communication state */
 
+  DMA_HandleTypeDef           *hdma;      /*!< CRC memory-to-memory DMA handle, NULL when only
+                                               the CPU computation functions are used        */
+
+  uint32_t                    *pDmaBuffer; /*!< Next word to be fed by the DMA               */
+
+  uint32_t                    DmaRemaining; /*!< Words left to be fed by the DMA             */
+
 }CRC_HandleTypeDef;
 /** 
   * @}
   */
 
+/** @defgroup CRC_Exported_Types_Group3 CRC Context Structure definition
+  * @{
+  */
+typedef struct
+{
+  uint32_t                    Crc;        /*!< Running CRC of the logical stream, as read from DR */
+
+  uint8_t                     Idr;        /*!< Independent data register of the logical stream    */
+
+}CRC_ContextTypeDef;
+/** 
+  * @}
+  */
+
 /**
   * @}
   */ 
 
 /* Exported constants --------------------------------------------------------*/
+/** @defgroup CRC_Exported_Constants CRC Exported Constants
+  * @{
+  */
+#define CRC_DEFAULT_CRC32_POLY     0x04C11DB7U   /*!< Fixed generating polynomial of the CRC unit */
+#define CRC_DEFAULT_INITVALUE      0xFFFFFFFFU   /*!< DR value after __HAL_CRC_DR_RESET()         */
+#define CRC_DMA_MAX_LENGTH         0xFFFFU       /*!< Words fed by one DMA transfer, longer buffers
+                                                      are split by the driver                   */
+/**
+  * @}
+  */
+
 /* Exported macro ------------------------------------------------------------*/
 /** @defgroup CRC_Exported_Macros CRC Exported Macros
   * @{
@@ -152,6 +184,15 @@ void HAL_CRC_MspDeInit(CRC_HandleTypeDef *hcrc);
   */
 uint32_t HAL_CRC_Accumulate(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength);
 uint32_t HAL_CRC_Calculate(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength);
+HAL_StatusTypeDef HAL_CRC_Accumulate_DMA(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength);
+HAL_StatusTypeDef HAL_CRC_Calculate_DMA(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength);
+HAL_StatusTypeDef HAL_CRC_Abort_DMA(CRC_HandleTypeDef *hcrc);
+uint32_t HAL_CRC_GetValue(CRC_HandleTypeDef *hcrc);
+HAL_StatusTypeDef HAL_CRC_SaveContext(CRC_HandleTypeDef *hcrc, CRC_ContextTypeDef *pContext);
+HAL_StatusTypeDef HAL_CRC_RestoreContext(CRC_HandleTypeDef *hcrc, const CRC_ContextTypeDef *pContext);
+void HAL_CRC_InitContext(CRC_ContextTypeDef *pContext);
+void HAL_CRC_CpltCallback(CRC_HandleTypeDef *hcrc);
+void HAL_CRC_ErrorCallback(CRC_HandleTypeDef *hcrc);
 /**
   * @}
   */ 
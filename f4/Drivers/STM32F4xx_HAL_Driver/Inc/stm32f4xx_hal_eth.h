@@ -620,6 +620,108 @@ typedef struct
 
 } ETH_DMARxFrameInfos;
 
+/** 
+  * @brief  ETH Rx packet metadata structure definition
+  */
+typedef struct
+{
+  uint32_t                   Length;        /*!< Packet length in bytes, as returned by RxFrameInfos.length */
+
+  uint32_t                   Checksum;      /*!< Hardware checksum verification result.
+                                                 This parameter can be a combination of @ref ETH_Packet_Meta_Checksum */
+
+  uint32_t                   VlanTag;       /*!< Outer VLAN tag control information, 0 if the packet is not tagged */
+
+  uint64_t                   TimeStamp;     /*!< PTP hardware timestamp: seconds in bits [63:32], subseconds
+                                                 in bits [31:0]. 0 if no timestamp was captured */
+
+} ETH_PacketMetaTypeDef;
+
+/** 
+  * @brief  ETH Rx packet metadata ring structure definition
+  */
+typedef struct
+{
+  ETH_PacketMetaTypeDef      *pEntries;     /*!< Ring entries, provided by the application */
+
+  uint32_t                   Size;          /*!< Number of entries of the ring */
+
+  __IO uint32_t              Head;          /*!< Next entry written by the driver */
+
+  __IO uint32_t              Tail;          /*!< Next entry read by the application */
+
+  uint32_t                   Dropped;       /*!< Number of metadata lost because the ring was full */
+
+} ETH_PacketMetaRingTypeDef;
+
+/** 
+  * @brief  ETH Tx buffer structure definition
+  */
+typedef struct __ETH_TxBufferTypeDef
+{
+  uint8_t                    *buffer;       /*!< Buffer address, mapped as is onto a Tx descriptor */
+
+  uint32_t                   len;           /*!< Buffer length in bytes, up to ETH_DMATXDESC_TBS1  */
+
+  struct __ETH_TxBufferTypeDef *next;       /*!< Next buffer of the frame, NULL for the last one   */
+
+} ETH_TxBufferTypeDef;
+
+/** 
+  * @brief  ETH Tx frame structure definition
+  */
+typedef struct __ETH_TxFrameTypeDef
+{
+  ETH_TxBufferTypeDef        *pBuffers;     /*!< Buffers of the frame, one Tx descriptor each        */
+
+  ETH_DMADescTypeDef         *pFirstDesc;   /*!< First Tx descriptor of the frame, set by the driver */
+
+  ETH_DMADescTypeDef         *pLastDesc;    /*!< Last Tx descriptor of the frame, set by the driver  */
+
+  struct __ETH_TxFrameTypeDef *pNext;       /*!< Next frame of the batch, NULL for the last one.
+                                                 Used by the driver while the frame is in flight   */
+
+} ETH_TxFrameTypeDef;
+
+/**
+  * @brief  ETH interrupt moderation structure definition
+  */
+typedef struct
+{
+  uint32_t                   RxFrameCount;  /*!< Rx descriptors completed per receive interrupt, 0 or 1 for
+                                                 an interrupt per descriptor */
+
+  uint32_t                   RxWatchdog;    /*!< Receive status watchdog, in units of 256 HCLK cycles: the
+                                                 receive interrupt is raised this long after a descriptor
+                                                 completed without interrupt request.
+                                                 This parameter can be a value from 0x00 to 0xFF, 0 disables the
+                                                 watchdog. It must not be 0 when RxFrameCount is above 1 */
+
+  uint32_t                   TxFrameCount;  /*!< Frames sent by HAL_ETH_TransmitFrame() per transmit interrupt,
+                                                 0 to leave the transmit interrupt to HAL_ETH_TransmitFrameChain() */
+
+} ETH_ITModerationTypeDef;
+
+/** 
+  * @brief  ETH PHY register transfer structure definition
+  */
+typedef struct __ETH_PHYTransferTypeDef
+{
+  uint32_t                   PHYAddr;       /*!< PHY port address, must be a value from 0 to 31     */
+
+  uint32_t                   PHYReg;        /*!< PHY register address, must be a value from 0 to 31 */
+
+  uint32_t                   RegValue;      /*!< Value to write, or value read once the transfer is completed */
+
+  uint32_t                   Operation;     /*!< Transfer direction, set by the driver.
+                                                 This parameter can be a value of @ref ETH_PHY_Operation */
+
+  __IO HAL_StatusTypeDef     Status;        /*!< HAL_BUSY while queued, then HAL_OK or HAL_TIMEOUT */
+
+  struct __ETH_PHYTransferTypeDef *pNext;   /*!< Queue link, reserved for the driver */
+
+} ETH_PHYTransferTypeDef;
+
 /** 
   * @brief  ETH Handle Structure definition  
   */
@@ -642,6 +744,32 @@ typedef struct
   
   HAL_LockTypeDef            Lock;          /*!< ETH Lock                    */
 
+  ETH_PHYTransferTypeDef     *pPHYXferHead; /*!< PHY register transfer in progress */
+
+  ETH_PHYTransferTypeDef     *pPHYXferTail; /*!< Last queued PHY register transfer */
+
+  uint32_t                   PHYXferTickStart; /*!< Start tick of the transfer  */
+
+  ETH_PHYTransferTypeDef     LinkPollXfer;  /*!< Link poller PHY transfer     */
+
+  uint32_t                   LinkPollPeriod; /*!< Link poll period in ms, 0 when stopped */
+
+  uint32_t                   LinkPollTick;  /*!< Tick of the last link poll   */
+
+  ETH_DMADescTypeDef         *TxDescTab;    /*!< First Tx descriptor of the list */
+
+  uint8_t                    *TxBuffTab;    /*!< Tx buffers given to HAL_ETH_DMATxDescListInit() */
+
+  ETH_TxFrameTypeDef         *pTxFrameHead; /*!< Oldest Tx frame in flight   */
+
+  ETH_TxFrameTypeDef         *pTxFrameTail; /*!< Newest Tx frame in flight   */
+
+  ETH_PacketMetaRingTypeDef  MetaRing;      /*!< Rx packet metadata ring     */
+
+  ETH_ITModerationTypeDef    ITModeration;  /*!< Interrupt moderation, set by HAL_ETH_ConfigITModeration() */
+
+  uint32_t                   TxFramesNoIT;  /*!< Frames sent since the last Tx interrupt request */
+
 } ETH_HandleTypeDef;
 
  /**
@@ -898,6 +1026,21 @@ typedef struct
 
 /* Bit definition of RDES7 register */
 #define ETH_DMAPTPRXDESC_RTSH  0xFFFFFFFFU  /* Receive Time Stamp High */
+
+/* RDES0 bits meaning when the enhanced descriptor format is enabled */
+#define ETH_DMARXDESC_ESA   ETH_DMARXDESC_MAMPCE   /* Extended status available in RDES4 */
+#define ETH_DMARXDESC_TSV   ETH_DMARXDESC_IPV4HCE  /* Time stamp valid in RDES6 and RDES7 */
+/**
+  * @}
+  */
+
+/** @defgroup ETH_Packet_Meta_Checksum ETH Packet Meta Checksum
+  * @{
+  */
+#define ETH_META_CHECKSUM_OK                0x00000000U  /*!< IP header and payload checksums verified by hardware */
+#define ETH_META_CHECKSUM_BYPASSED          0x00000001U  /*!< Not an IP packet, or checksum offload disabled       */
+#define ETH_META_CHECKSUM_IP_HEADER_ERROR   0x00000002U  /*!< IP header checksum error                             */
+#define ETH_META_CHECKSUM_IP_PAYLOAD_ERROR  0x00000004U  /*!< TCP, UDP or ICMP checksum error                      */
 /**
   * @}
   */
@@ -927,6 +1070,24 @@ typedef struct
 /**
   * @}
   */
+/** @defgroup ETH_PHY_Operation ETH PHY Operation
+  * @{
+  */
+#define ETH_PHY_OPERATION_READ     ((uint32_t)0x00000000U)   /*!< PHY register read  */
+#define ETH_PHY_OPERATION_WRITE    ((uint32_t)0x00000001U)   /*!< PHY register write */
+/**
+  * @}
+  */
+
+/** @defgroup ETH_Link_Status ETH Link Status
+  * @{
+  */
+#define ETH_LINK_STATUS_DOWN       ((uint32_t)0x00000000U)   /*!< No valid link   */
+#define ETH_LINK_STATUS_UP         ((uint32_t)0x00000001U)   /*!< Valid link      */
+/**
+  * @}
+  */
+
 /** @defgroup ETH_Rx_Mode ETH Rx Mode
   * @{
   */ 
@@ -2117,17 +2278,30 @@ HAL_StatusTypeDef HAL_ETH_DMARxDescListInit(ETH_HandleTypeDef *heth, ETH_DMADesc
   * @{
   */
 HAL_StatusTypeDef HAL_ETH_TransmitFrame(ETH_HandleTypeDef *heth, uint32_t FrameLength);
+HAL_StatusTypeDef HAL_ETH_TransmitFrameChain(ETH_HandleTypeDef *heth, ETH_TxFrameTypeDef *pFrames);
+void HAL_ETH_ReleaseTxFrames(ETH_HandleTypeDef *heth);
 HAL_StatusTypeDef HAL_ETH_GetReceivedFrame(ETH_HandleTypeDef *heth);
 /* Communication with PHY functions*/
 HAL_StatusTypeDef HAL_ETH_ReadPHYRegister(ETH_HandleTypeDef *heth, uint16_t PHYReg, uint32_t *RegValue);
 HAL_StatusTypeDef HAL_ETH_WritePHYRegister(ETH_HandleTypeDef *heth, uint16_t PHYReg, uint32_t RegValue);
+HAL_StatusTypeDef HAL_ETH_ReadPHYRegister_IT(ETH_HandleTypeDef *heth, ETH_PHYTransferTypeDef *pXfer);
+HAL_StatusTypeDef HAL_ETH_WritePHYRegister_IT(ETH_HandleTypeDef *heth, ETH_PHYTransferTypeDef *pXfer);
+void HAL_ETH_PHY_IRQHandler(ETH_HandleTypeDef *heth);
+HAL_StatusTypeDef HAL_ETH_StartLinkPoll(ETH_HandleTypeDef *heth, uint32_t PHYAddr, uint32_t Period);
+HAL_StatusTypeDef HAL_ETH_StopLinkPoll(ETH_HandleTypeDef *heth);
+uint32_t HAL_ETH_GetLinkStatus(ETH_HandleTypeDef *heth);
 /* Non-Blocking mode: Interrupt */
 HAL_StatusTypeDef HAL_ETH_GetReceivedFrame_IT(ETH_HandleTypeDef *heth);
+HAL_StatusTypeDef HAL_ETH_ConfigPacketMetaRing(ETH_HandleTypeDef *heth, ETH_PacketMetaTypeDef *pEntries, uint32_t Size);
+HAL_StatusTypeDef HAL_ETH_GetPacketMeta(ETH_HandleTypeDef *heth, ETH_PacketMetaTypeDef *pMeta);
 void HAL_ETH_IRQHandler(ETH_HandleTypeDef *heth);
 /* Callback in non blocking modes (Interrupt) */
 void HAL_ETH_TxCpltCallback(ETH_HandleTypeDef *heth);
+void HAL_ETH_TxFrameCpltCallback(ETH_HandleTypeDef *heth, ETH_TxFrameTypeDef *pFrame);
 void HAL_ETH_RxCpltCallback(ETH_HandleTypeDef *heth);
 void HAL_ETH_ErrorCallback(ETH_HandleTypeDef *heth);
+void HAL_ETH_PHYTransferCpltCallback(ETH_HandleTypeDef *heth, ETH_PHYTransferTypeDef *pXfer);
+void HAL_ETH_LinkStatusCallback(ETH_HandleTypeDef *heth);
 /**
   * @}
   */
@@ -2142,6 +2316,7 @@ HAL_StatusTypeDef HAL_ETH_Start(ETH_HandleTypeDef *heth);
 HAL_StatusTypeDef HAL_ETH_Stop(ETH_HandleTypeDef *heth);
 HAL_StatusTypeDef HAL_ETH_ConfigMAC(ETH_HandleTypeDef *heth, ETH_MACInitTypeDef *macconf);
 HAL_StatusTypeDef HAL_ETH_ConfigDMA(ETH_HandleTypeDef *heth, ETH_DMAInitTypeDef *dmaconf);
+HAL_StatusTypeDef HAL_ETH_ConfigITModeration(ETH_HandleTypeDef *heth, ETH_ITModerationTypeDef *pConfig);
 /**
   * @}
   */ 
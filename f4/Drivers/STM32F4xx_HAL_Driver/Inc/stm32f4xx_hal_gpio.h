@@ -86,6 +86,12 @@ typedef enum
   GPIO_PIN_RESET = 0,
   GPIO_PIN_SET
 }GPIO_PinState;
+
+/** 
+  * @brief  GPIO EXTI line callback, given the pin of the line and the context
+  *         registered with it
+  */
+typedef void (*pGPIO_EXTI_CallbackTypeDef)(uint16_t GPIO_Pin, void *pContext);
 /**
   * @}
   */
@@ -122,6 +128,16 @@ typedef enum
   * @}
   */
 
+/** @defgroup GPIO_EXTI_shared_lines GPIO EXTI lines sharing one interrupt
+  * @brief    To be given to HAL_GPIO_EXTI_IRQHandler() from the shared handlers
+  * @{
+  */
+#define GPIO_EXTI_LINES_9_5        ((uint16_t)0x03E0)  /* EXTI9_5_IRQn lines   */
+#define GPIO_EXTI_LINES_15_10      ((uint16_t)0xFC00)  /* EXTI15_10_IRQn lines */
+/**
+  * @}
+  */
+
 /** @defgroup GPIO_mode_define GPIO mode define
   * @brief GPIO Configuration Mode 
   *        Elements values convention: 0xX0yz00YZ
@@ -254,6 +270,8 @@ void HAL_GPIO_TogglePin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin);
 HAL_StatusTypeDef HAL_GPIO_LockPin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin);
 void HAL_GPIO_EXTI_IRQHandler(uint16_t GPIO_Pin);
 void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin);
+HAL_StatusTypeDef HAL_GPIO_EXTI_RegisterCallback(uint16_t GPIO_Pin, pGPIO_EXTI_CallbackTypeDef pCallback, void *pContext);
+HAL_StatusTypeDef HAL_GPIO_EXTI_UnRegisterCallback(uint16_t GPIO_Pin);
 
 /**
   * @}
@@ -279,6 +297,7 @@ void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin);
   */
 #define IS_GPIO_PIN_ACTION(ACTION) (((ACTION) == GPIO_PIN_RESET) || ((ACTION) == GPIO_PIN_SET))
 #define IS_GPIO_PIN(PIN)           ((((PIN) & GPIO_PIN_MASK ) != 0x00U) && (((PIN) & ~GPIO_PIN_MASK) == 0x00U))
+#define IS_GPIO_SINGLE_PIN(PIN)    (IS_GPIO_PIN(PIN) && (((PIN) & ((PIN) - 1U)) == 0x00U))
 #define IS_GPIO_MODE(MODE) (((MODE) == GPIO_MODE_INPUT)              ||\
                             ((MODE) == GPIO_MODE_OUTPUT_PP)          ||\
                             ((MODE) == GPIO_MODE_OUTPUT_OD)          ||\
@@ -0,0 +1,160 @@
+/**
+  ******************************************************************************
+  * @file    stm32f4xx_hal_trace.h
+  * @author  MCD Application Team
+  * @brief   Header file of TRACE HAL module.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2017 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */ 
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32F4xx_HAL_TRACE_H
+#define __STM32F4xx_HAL_TRACE_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32f4xx.h"
+
+/** @addtogroup STM32F4xx_HAL_Driver
+  * @{
+  */
+
+/** @addtogroup TRACE
+  * @{
+  */
+
+/* Exported types ------------------------------------------------------------*/
+/** @defgroup TRACE_Exported_Types TRACE Exported Types
+  * @{
+  */
+
+/**
+  * @brief  HAL trace event record
+  */
+typedef struct
+{
+  uint32_t TimeStamp;  /*!< Cycle counter value when the event was recorded        */
+
+  uint32_t Event;      /*!< Event identifier, a value of @ref TRACE_Events          */
+
+  uint32_t Arg;        /*!< Event argument: peripheral instance or exception number */
+
+} HAL_TRACE_EventTypeDef;
+
+/**
+  * @}
+  */
+
+/* Exported constants --------------------------------------------------------*/
+/** @defgroup TRACE_Exported_Constants TRACE Exported Constants
+  * @{
+  */
+
+/** @defgroup TRACE_Events TRACE Events
+  * @{
+  */
+#define HAL_TRACE_EVT_IRQ_ENTER    0x00000001U  /*!< Interrupt handler entry, Arg is the exception number */
+#define HAL_TRACE_EVT_IRQ_EXIT     0x00000002U  /*!< Interrupt handler exit, Arg is the exception number  */
+#define HAL_TRACE_EVT_DMA_START    0x00000010U  /*!< DMA transfer started, Arg is the stream or channel   */
+#define HAL_TRACE_EVT_DMA_CPLT     0x00000011U  /*!< DMA transfer complete callback                       */
+#define HAL_TRACE_EVT_DMA_ERROR    0x00000012U  /*!< DMA transfer error callback                          */
+#define HAL_TRACE_EVT_UART_ERROR   0x00000020U  /*!< UART error callback, Arg is the UART instance         */
+#define HAL_TRACE_EVT_ETH_RX       0x00000030U  /*!< ETH receive complete callback, Arg is the ETH instance */
+#define HAL_TRACE_EVT_USB_SOF      0x00000040U  /*!< USB start of frame callback, Arg is the USB instance  */
+#define HAL_TRACE_EVT_USER         0x00000100U  /*!< First identifier free for application events         */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/* Exported macro ------------------------------------------------------------*/
+/** @defgroup TRACE_Exported_Macros TRACE Exported Macros
+  * @{
+  */
+
+/**
+  * @brief  Record a trace event, compiled out unless USE_HAL_TRACE is 1.
+  * @param  __EVENT__: event identifier, a value of @ref TRACE_Events
+  * @param  __ARG__: event argument
+  * @retval None
+  */
+#if (USE_HAL_TRACE == 1U)
+#define __HAL_TRACE(__EVENT__, __ARG__)  HAL_TRACE_Record((__EVENT__), (uint32_t)(__ARG__))
+#else
+#define __HAL_TRACE(__EVENT__, __ARG__)
+#endif /* USE_HAL_TRACE */
+
+/**
+  * @brief  Record the entry and the exit of the running interrupt handler,
+  *         to be placed first and last in the handlers to trace.
+  * @retval None
+  */
+#define __HAL_TRACE_IRQ_ENTER()  __HAL_TRACE(HAL_TRACE_EVT_IRQ_ENTER, __get_IPSR())
+#define __HAL_TRACE_IRQ_EXIT()   __HAL_TRACE(HAL_TRACE_EVT_IRQ_EXIT, __get_IPSR())
+
+/**
+  * @}
+  */
+
+#if (USE_HAL_TRACE == 1U)
+/* Exported functions --------------------------------------------------------*/
+/** @addtogroup TRACE_Exported_Functions
+  * @{
+  */
+void     HAL_TRACE_Init(void);
+void     HAL_TRACE_Record(uint32_t Event, uint32_t Arg);
+uint32_t HAL_TRACE_Read(HAL_TRACE_EventTypeDef *pEvents, uint32_t MaxCount);
+uint32_t HAL_TRACE_GetDropped(void);
+uint32_t HAL_TRACE_FlushITM(uint32_t Port);
+/**
+  * @}
+  */
+#endif /* USE_HAL_TRACE */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __STM32F4xx_HAL_TRACE_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
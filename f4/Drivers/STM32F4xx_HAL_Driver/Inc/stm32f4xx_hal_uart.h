@@ -152,6 +152,50 @@ typedef enum
                                                    Value is allowed for gState only */
 }HAL_UART_StateTypeDef;
 
+/**
+  * @brief HAL UART Reception type definition
+  * @note  HAL UART Reception type value aims to identify which type of Reception is ongoing.
+  *        This parameter can be a value of @ref UART_Reception_Type_Values :
+  *           HAL_UART_RECEPTION_STANDARD         = 0x00U,
+  *           HAL_UART_RECEPTION_TOIDLE           = 0x01U,
+  */
+typedef uint32_t HAL_UART_RxTypeTypeDef;
+
+/**
+  * @brief HAL UART Rx Event type definition
+  * @note  HAL UART Rx Event type value aims to identify which type of Event has occurred
+  *        leading to call of the RxEvent callback.
+  *        This parameter can be a value of @ref UART_RxEvent_Type_Values :
+  *           HAL_UART_RXEVENT_TC                 = 0x00U,
+  *           HAL_UART_RXEVENT_HT                 = 0x01U,
+  *           HAL_UART_RXEVENT_IDLE               = 0x02U,
+  */
+typedef uint32_t HAL_UART_RxEventTypeTypeDef;
+
+/**
+  * @brief  UART transmit queue segment structure definition
+  */
+typedef struct
+{
+  uint8_t                       *pData;           /*!< Pointer to the segment data        */
+
+  uint16_t                      Size;             /*!< Segment size in bytes              */
+}UART_TxSegmentTypeDef;
+
+/**
+  * @brief  UART transmit queue descriptor structure definition
+  * @note   The descriptor and the segments it points to belong to the driver from the call
+  *         of HAL_UART_TxQueue_DMA() until HAL_UART_TxQueueCpltCallback() is called for it.
+  */
+typedef struct __UART_TxDescTypeDef
+{
+  UART_TxSegmentTypeDef         *pSegments;       /*!< Segments sent back-to-back         */
+
+  uint32_t                      NbSegments;       /*!< Number of segments in pSegments    */
+
+  struct __UART_TxDescTypeDef   *pNext;           /*!< Queue link, reserved for the driver */
+}UART_TxDescTypeDef;
+
 /** 
   * @brief  UART handle Structure definition  
   */  
@@ -185,6 +229,23 @@ typedef struct
   
   __IO HAL_UART_StateTypeDef    RxState;          /*!< UART state information related to Rx operations.
                                                        This parameter can be a value of @ref HAL_UART_StateTypeDef */
+
+  __IO HAL_UART_RxTypeTypeDef ReceptionType;         /*!< Type of ongoing reception           */
+
+  __IO HAL_UART_RxEventTypeTypeDef RxEventType;      /*!< Type of the last Rx Event reported */
+
+  uint16_t                 RxEventOffset;            /*!< Offset in the Rx buffer of the first byte
+                                                          not yet reported by the Rx Event callback */
+
+  UART_TxDescTypeDef * volatile pTxQueuePending;  /*!< Descriptors queued by the producers, last queued first */
+
+  UART_TxDescTypeDef            *pTxQueueCurrent; /*!< Descriptors being transmitted, first queued first */
+
+  uint32_t                      TxQueueSegment;   /*!< Index of the next segment of pTxQueueCurrent to send */
+
+  __IO uint32_t                 TxQueueLock;      /*!< Transmit queue ownership, taken by exclusive access */
+
+  __IO uint32_t                 TxQueueActive;    /*!< Transmitter used by the transmit queue */
   
   __IO uint32_t                 ErrorCode;        /*!< UART Error code                    */
 
@@ -341,6 +402,25 @@ typedef struct
   * @}
   */
 
+/** @defgroup UART_Reception_Type_Values  UART Reception type values
+  * @{
+  */
+#define HAL_UART_RECEPTION_STANDARD          (0x00000000U)             /*!< Standard reception                       */
+#define HAL_UART_RECEPTION_TOIDLE            (0x00000001U)             /*!< Reception till completion or IDLE event  */
+/**
+  * @}
+  */
+
+/** @defgroup UART_RxEvent_Type_Values  UART RxEvent type values
+  * @{
+  */
+#define HAL_UART_RXEVENT_TC                  (0x00000000U)             /*!< RxEvent linked to Transfer Complete event */
+#define HAL_UART_RXEVENT_HT                  (0x00000001U)             /*!< RxEvent linked to Half Transfer event     */
+#define HAL_UART_RXEVENT_IDLE                (0x00000002U)             /*!< RxEvent linked to IDLE event              */
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -651,6 +731,8 @@ HAL_StatusTypeDef HAL_UART_Receive_DMA(UART_HandleTypeDef *huart, uint8_t *pData
 HAL_StatusTypeDef HAL_UART_DMAPause(UART_HandleTypeDef *huart);
 HAL_StatusTypeDef HAL_UART_DMAResume(UART_HandleTypeDef *huart);
 HAL_StatusTypeDef HAL_UART_DMAStop(UART_HandleTypeDef *huart);
+HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UART_TxQueue_DMA(UART_HandleTypeDef *huart, UART_TxDescTypeDef *pDesc);
 /* Transfer Abort functions */
 HAL_StatusTypeDef HAL_UART_Abort(UART_HandleTypeDef *huart);
 HAL_StatusTypeDef HAL_UART_AbortTransmit(UART_HandleTypeDef *huart);
@@ -668,6 +750,8 @@ void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart);
 void HAL_UART_AbortCpltCallback (UART_HandleTypeDef *huart);
 void HAL_UART_AbortTransmitCpltCallback (UART_HandleTypeDef *huart);
 void HAL_UART_AbortReceiveCpltCallback (UART_HandleTypeDef *huart);
+void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Offset, uint16_t Length);
+void HAL_UART_TxQueueCpltCallback(UART_HandleTypeDef *huart, UART_TxDescTypeDef *pDesc);
 /**
   * @}
   */
@@ -691,6 +775,7 @@ HAL_StatusTypeDef HAL_HalfDuplex_EnableReceiver(UART_HandleTypeDef *huart);
 /* Peripheral State functions  **************************************************/
 HAL_UART_StateTypeDef HAL_UART_GetState(UART_HandleTypeDef *huart);
 uint32_t              HAL_UART_GetError(UART_HandleTypeDef *huart);
+HAL_UART_RxEventTypeTypeDef HAL_UARTEx_GetRxEventType(UART_HandleTypeDef *huart);
 /**
   * @}
   */ 
@@ -175,6 +175,8 @@ typedef struct
 
   uint32_t  xfer_count;     /*!< Partial transfer length in case of multi packet transfer                 */
 
+  uint32_t  xfer_size;      /*!< Transfer size programmed on an OUT endpoint                              */
+
 }USB_OTG_EPTypeDef;
 
 /** 
@@ -108,6 +108,7 @@
   * @{
   */
 __IO uint32_t uwTick;
+__IO uint32_t uwHalLockBusy;        /* __HAL_LOCK() calls found the handle locked */
 uint32_t uwTickPrio   = (1UL << __NVIC_PRIO_BITS); /* Invalid PRIO */
 HAL_TickFreqTypeDef uwTickFreq = HAL_TICK_FREQ_DEFAULT;  /* 1KHz */
 /**
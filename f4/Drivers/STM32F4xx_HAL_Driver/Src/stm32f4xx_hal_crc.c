@@ -7,6 +7,7 @@
   *          functionalities of the Cyclic Redundancy Check (CRC) peripheral:
   *           + Initialization and de-initialization functions
   *           + Peripheral Control functions 
+  *           + DMA computation and context save/restore functions
   *           + Peripheral State functions
   *
   @verbatim
@@ -26,6 +27,26 @@
           a new 32-bit data buffer. This function resets the CRC computation  
           unit before starting the computation to avoid getting wrong CRC values.
 
+      (#) For large buffers, link a DMA2 stream configured in memory-to-memory
+          direction to the handle in HAL_CRC_MspInit() with
+          __HAL_LINKDMA(hcrc, hdma, hdma_crc). The stream is set with
+          PeriphInc = DMA_PINC_ENABLE (source buffer), MemInc = DMA_MINC_DISABLE
+          (destination CRC->DR) and word data alignment on both sides.
+          Then use HAL_CRC_Calculate_DMA() or HAL_CRC_Accumulate_DMA(): the
+          call returns immediately, HAL_CRC_CpltCallback() is called once the
+          whole buffer is fed and HAL_CRC_GetValue() returns the result.
+          Buffers longer than CRC_DMA_MAX_LENGTH words are fed in several DMA
+          transfers chained from the DMA transfer complete interrupt.
+
+      (#) Several logical CRC streams can share the unit: each owner keeps a
+          CRC_ContextTypeDef (set by HAL_CRC_InitContext()), restores it with
+          HAL_CRC_RestoreContext() before feeding data and saves it back with
+          HAL_CRC_SaveContext() afterwards. The CRC unit of this family has no
+          INIT register, the restore preloads DR by feeding it one word computed
+          from the saved CRC, so it costs a 32-step loop and a single DR write.
+          The polynomial is fixed (CRC_DEFAULT_CRC32_POLY) and shared by all
+          streams.
+
   @endverbatim
   ******************************************************************************
   * @attention
@@ -75,6 +96,17 @@
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+/** @addtogroup CRC_Private_Functions
+  * @{
+  */
+static void CRC_DMAStart(CRC_HandleTypeDef *hcrc);
+static void CRC_DMAXferCplt(DMA_HandleTypeDef *hdma);
+static void CRC_DMAError(DMA_HandleTypeDef *hdma);
+static uint32_t CRC_Unshift(uint32_t crc);
+/**
+  * @}
+  */
+
 /* Private functions ---------------------------------------------------------*/
 /* Exported functions --------------------------------------------------------*/
 
@@ -215,6 +247,8 @@ __weak void HAL_CRC_MspDeInit(CRC_HandleTypeDef *hcrc)
           using combination of the previous CRC value and the new one.
       (+) Compute the 32-bit CRC value of 32-bit data buffer,
           independently of the previous CRC value.
+      (+) Feed the buffer by DMA and get the result from HAL_CRC_CpltCallback().
+      (+) Save and restore the state of the unit for several logical CRC streams.
 
 @endverbatim
   * @{
@@ -293,6 +327,197 @@ uint32_t HAL_CRC_Calculate(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t
   return hcrc->Instance->DR;
 }
 
+/**
+  * @brief  Starts the DMA computation of the 32-bit CRC of a 32-bit data buffer
+  *         using combination of the previous CRC value and the new one.
+  * @note   The result is read with HAL_CRC_GetValue() once HAL_CRC_CpltCallback()
+  *         has been called. The buffer must stay untouched until then.
+  * @param  hcrc pointer to a CRC_HandleTypeDef structure that contains
+  *         the configuration information for CRC
+  * @param  pBuffer pointer to the buffer containing the data to be computed
+  * @param  BufferLength length of the buffer to be computed, in words
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CRC_Accumulate_DMA(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength)
+{
+  if((pBuffer == NULL) || (BufferLength == 0U) || (hcrc->hdma == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(hcrc);
+
+  if(hcrc->State != HAL_CRC_STATE_READY)
+  {
+    /* Process Unlocked */
+    __HAL_UNLOCK(hcrc);
+    return HAL_BUSY;
+  }
+
+  /* Change CRC peripheral state */
+  hcrc->State = HAL_CRC_STATE_BUSY;
+
+  hcrc->pDmaBuffer   = pBuffer;
+  hcrc->DmaRemaining = BufferLength;
+
+  hcrc->hdma->XferCpltCallback  = CRC_DMAXferCplt;
+  hcrc->hdma->XferErrorCallback = CRC_DMAError;
+  hcrc->hdma->XferHalfCpltCallback = NULL;
+  hcrc->hdma->XferAbortCallback = NULL;
+
+  CRC_DMAStart(hcrc);
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(hcrc);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Starts the DMA computation of the 32-bit CRC of a 32-bit data buffer
+  *         independently of the previous CRC value.
+  * @note   The result is read with HAL_CRC_GetValue() once HAL_CRC_CpltCallback()
+  *         has been called. The buffer must stay untouched until then.
+  * @param  hcrc pointer to a CRC_HandleTypeDef structure that contains
+  *         the configuration information for CRC
+  * @param  pBuffer pointer to the buffer containing the data to be computed
+  * @param  BufferLength length of the buffer to be computed, in words
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CRC_Calculate_DMA(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength)
+{
+  if(hcrc->State != HAL_CRC_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  /* Reset CRC Calculation Unit */
+  __HAL_CRC_DR_RESET(hcrc);
+
+  return HAL_CRC_Accumulate_DMA(hcrc, pBuffer, BufferLength);
+}
+
+/**
+  * @brief  Aborts an on going DMA computation.
+  * @note   The CRC value then covers the words already fed by the DMA only.
+  * @param  hcrc pointer to a CRC_HandleTypeDef structure that contains
+  *         the configuration information for CRC
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_CRC_Abort_DMA(CRC_HandleTypeDef *hcrc)
+{
+  if(hcrc->State == HAL_CRC_STATE_BUSY)
+  {
+    hcrc->DmaRemaining = 0U;
+    if(HAL_DMA_Abort(hcrc->hdma) != HAL_OK)
+    {
+      hcrc->State = HAL_CRC_STATE_ERROR;
+      return HAL_ERROR;
+    }
+    hcrc->State = HAL_CRC_STATE_READY;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Returns the current CRC value, i.e. the result of the last computation.
+  * @param  hcrc pointer to a CRC_HandleTypeDef structure that contains
+  *         the configuration information for CRC
+  * @retval 32-bit CRC
+  */
+uint32_t HAL_CRC_GetValue(CRC_HandleTypeDef *hcrc)
+{
+  return hcrc->Instance->DR;
+}
+
+/**
+  * @brief  Sets a context to the state of a freshly reset CRC unit.
+  * @param  pContext pointer to the context of a logical CRC stream
+  * @retval None
+  */
+void HAL_CRC_InitContext(CRC_ContextTypeDef *pContext)
+{
+  pContext->Crc = CRC_DEFAULT_INITVALUE;
+  pContext->Idr = 0U;
+}
+
+/**
+  * @brief  Saves the state of the CRC unit in the context of a logical CRC stream.
+  * @param  hcrc pointer to a CRC_HandleTypeDef structure that contains
+  *         the configuration information for CRC
+  * @param  pContext pointer to the context of the logical CRC stream
+  * @retval HAL status, HAL_BUSY if a DMA computation is on going
+  */
+HAL_StatusTypeDef HAL_CRC_SaveContext(CRC_HandleTypeDef *hcrc, CRC_ContextTypeDef *pContext)
+{
+  if(hcrc->State != HAL_CRC_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  pContext->Crc = hcrc->Instance->DR;
+  pContext->Idr = (uint8_t)__HAL_CRC_GET_IDR(hcrc);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Loads the CRC unit with the context of a logical CRC stream.
+  * @note   The next HAL_CRC_Accumulate() or HAL_CRC_Accumulate_DMA() call goes on
+  *         with the CRC saved in the context.
+  * @param  hcrc pointer to a CRC_HandleTypeDef structure that contains
+  *         the configuration information for CRC
+  * @param  pContext pointer to the context of the logical CRC stream
+  * @retval HAL status, HAL_BUSY if a DMA computation is on going
+  */
+HAL_StatusTypeDef HAL_CRC_RestoreContext(CRC_HandleTypeDef *hcrc, const CRC_ContextTypeDef *pContext)
+{
+  if(hcrc->State != HAL_CRC_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  /* From reset, DR = CRC(0xFFFFFFFF ^ Data): feed the word which lands on the saved CRC */
+  __HAL_CRC_DR_RESET(hcrc);
+  hcrc->Instance->DR = CRC_DEFAULT_INITVALUE ^ CRC_Unshift(pContext->Crc);
+
+  __HAL_CRC_SET_IDR(hcrc, pContext->Idr);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  DMA computation complete callback.
+  * @param  hcrc pointer to a CRC_HandleTypeDef structure that contains
+  *         the configuration information for CRC
+  * @retval None
+  */
+__weak void HAL_CRC_CpltCallback(CRC_HandleTypeDef *hcrc)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hcrc);
+  /* NOTE : This function Should not be modified, when the callback is needed,
+            the HAL_CRC_CpltCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  DMA computation error callback.
+  * @param  hcrc pointer to a CRC_HandleTypeDef structure that contains
+  *         the configuration information for CRC
+  * @retval None
+  */
+__weak void HAL_CRC_ErrorCallback(CRC_HandleTypeDef *hcrc)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hcrc);
+  /* NOTE : This function Should not be modified, when the callback is needed,
+            the HAL_CRC_ErrorCallback could be implemented in the user file
+   */
+}
+
 /**
   * @}
   */ 
@@ -328,6 +553,105 @@ HAL_CRC_StateTypeDef HAL_CRC_GetState(CRC_HandleTypeDef *hcrc)
   * @}
   */
 
+/**
+  * @}
+  */
+
+/** @addtogroup CRC_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Feeds the next part of the buffer, at most CRC_DMA_MAX_LENGTH words.
+  * @param  hcrc pointer to a CRC_HandleTypeDef structure that contains
+  *         the configuration information for CRC
+  * @retval None
+  */
+static void CRC_DMAStart(CRC_HandleTypeDef *hcrc)
+{
+  uint32_t length = hcrc->DmaRemaining;
+  uint32_t *pSrc = hcrc->pDmaBuffer;
+
+  if(length > CRC_DMA_MAX_LENGTH)
+  {
+    length = CRC_DMA_MAX_LENGTH;
+  }
+
+  hcrc->pDmaBuffer   += length;
+  hcrc->DmaRemaining -= length;
+
+  if(HAL_DMA_Start_IT(hcrc->hdma, (uint32_t)pSrc, (uint32_t)&hcrc->Instance->DR, length) != HAL_OK)
+  {
+    hcrc->DmaRemaining = 0U;
+    hcrc->State = HAL_CRC_STATE_ERROR;
+    HAL_CRC_ErrorCallback(hcrc);
+  }
+}
+
+/**
+  * @brief  DMA transfer complete callback: chains the next part or ends the computation.
+  * @param  hdma DMA handle
+  * @retval None
+  */
+static void CRC_DMAXferCplt(DMA_HandleTypeDef *hdma)
+{
+  CRC_HandleTypeDef *hcrc = (CRC_HandleTypeDef *)hdma->Parent;
+
+  if(hcrc->DmaRemaining != 0U)
+  {
+    CRC_DMAStart(hcrc);
+  }
+  else
+  {
+    hcrc->State = HAL_CRC_STATE_READY;
+    HAL_CRC_CpltCallback(hcrc);
+  }
+}
+
+/**
+  * @brief  DMA error callback.
+  * @param  hdma DMA handle
+  * @retval None
+  */
+static void CRC_DMAError(DMA_HandleTypeDef *hdma)
+{
+  CRC_HandleTypeDef *hcrc = (CRC_HandleTypeDef *)hdma->Parent;
+
+  /* FIFO errors do not stop the stream */
+  if(HAL_DMA_GetError(hdma) != HAL_DMA_ERROR_FE)
+  {
+    hcrc->DmaRemaining = 0U;
+    hcrc->State = HAL_CRC_STATE_ERROR;
+    HAL_CRC_ErrorCallback(hcrc);
+  }
+}
+
+/**
+  * @brief  Runs 32 steps of the CRC shift register backwards.
+  * @note   The generating polynomial is odd, so the bit shifted out of a forward
+  *         step is given back by the LSB of the result.
+  * @param  crc CRC value to run backwards
+  * @retval Register value which gives crc after 32 forward steps
+  */
+static uint32_t CRC_Unshift(uint32_t crc)
+{
+  uint32_t index;
+
+  for(index = 0U; index < 32U; index++)
+  {
+    if((crc & 1U) != 0U)
+    {
+      crc = ((crc ^ CRC_DEFAULT_CRC32_POLY) >> 1U) | 0x80000000U;
+    }
+    else
+    {
+      crc >>= 1U;
+    }
+  }
+
+  return crc;
+}
+
 /**
   * @}
   */
@@ -21,6 +21,11 @@
      -@-  In Multi (Double) buffer mode, it is possible to update the base address for 
           the AHB memory port on the fly (DMA_SxM0AR or DMA_SxM1AR) when the stream is enabled. 
   
+   (#) Stream an N-deep queue of buffers with the DMA streaming context:
+       HAL_DMAEx_StreamInit(), HAL_DMAEx_StreamPutBuffer() then HAL_DMAEx_StreamStart().
+       The idle memory target is refilled from the transfer complete interrupt,
+       released buffers are got back with HAL_DMAEx_StreamGetBuffer().
+
   @endverbatim
   ******************************************************************************
   * @attention
@@ -75,6 +80,12 @@
   * @{
   */
 static void DMA_MultiBufferSetConfig(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress, uint32_t DataLength);
+static uint32_t DMA_StreamQueuePut(DMA_StreamQueueTypeDef *queue, uint32_t Buffer);
+static uint32_t DMA_StreamQueueGet(DMA_StreamQueueTypeDef *queue, uint32_t *pBuffer);
+static void DMA_StreamSwap(DMA_StreamTypeDef *hstream, HAL_DMA_MemoryTypeDef memory);
+static void DMA_StreamM0Cplt(DMA_HandleTypeDef *hdma);
+static void DMA_StreamM1Cplt(DMA_HandleTypeDef *hdma);
+static void DMA_StreamError(DMA_HandleTypeDef *hdma);
 /**
   * @}
   */
@@ -269,6 +280,150 @@ HAL_StatusTypeDef HAL_DMAEx_ChangeMemory(DMA_HandleTypeDef *hdma, uint32_t Addre
   return HAL_OK;
 }
 
+/**
+  * @brief  Initializes a DMA streaming context on top of the multi buffer mode.
+  *         Buffers are then given with HAL_DMAEx_StreamPutBuffer(), and got
+  *         back in the same order with HAL_DMAEx_StreamGetBuffer(), while the
+  *         idle DMA memory target is refilled from the transfer complete
+  *         interrupt. Callbacks can be set once this function returns.
+  * @param  hstream   pointer to a DMA_StreamTypeDef structure
+  * @param  hdma      pointer to a DMA_HandleTypeDef structure that contains
+  *                     the configuration information for the specified DMA Stream.
+  *                     Its callbacks and Parent are taken over while streaming.
+  * @param  PeriphAddress The peripheral data register address
+  * @param  BufferLength The length of each buffer, in DMA data items
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DMAEx_StreamInit(DMA_StreamTypeDef *hstream, DMA_HandleTypeDef *hdma, uint32_t PeriphAddress, uint32_t BufferLength)
+{
+  /* Check the parameters */
+  assert_param(IS_DMA_BUFFER_SIZE(BufferLength));
+  
+  if ((hstream == NULL) || (hdma == NULL) || (hdma->Init.Direction == DMA_MEMORY_TO_MEMORY))
+  {
+    return HAL_ERROR;
+  }
+  
+  hstream->hdma = hdma;
+  hstream->PeriphAddress = PeriphAddress;
+  hstream->BufferLength = BufferLength;
+  hstream->Parent = NULL;
+  hstream->IdleQueue.In = 0U;
+  hstream->IdleQueue.Out = 0U;
+  hstream->DoneQueue.In = 0U;
+  hstream->DoneQueue.Out = 0U;
+  hstream->Target[0U] = 0U;
+  hstream->Target[1U] = 0U;
+  hstream->Starved = 0U;
+  hstream->BufferCpltCallback = NULL;
+  hstream->ErrorCallback = NULL;
+  
+  return HAL_OK;
+}
+
+/**
+  * @brief  Gives a buffer to the DMA streaming context: an empty buffer to fill
+  *         (peripheral to memory) or a filled buffer to send (memory to peripheral).
+  * @note   Not more than DMA_STREAM_QUEUE_SIZE buffers can circulate in a context.
+  * @param  hstream   pointer to a DMA_StreamTypeDef structure
+  * @param  Buffer    The buffer address
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DMAEx_StreamPutBuffer(DMA_StreamTypeDef *hstream, uint32_t Buffer)
+{
+  if (DMA_StreamQueuePut(&hstream->IdleQueue, Buffer) == 0U)
+  {
+    return HAL_BUSY;
+  }
+  
+  return HAL_OK;
+}
+
+/**
+  * @brief  Gets back the oldest buffer released by the DMA streaming context: a
+  *         filled buffer (peripheral to memory) or a sent buffer (memory to peripheral).
+  * @param  hstream   pointer to a DMA_StreamTypeDef structure
+  * @param  pBuffer   pointer to the buffer address
+  * @retval HAL status: HAL_ERROR if no buffer is available
+  */
+HAL_StatusTypeDef HAL_DMAEx_StreamGetBuffer(DMA_StreamTypeDef *hstream, uint32_t *pBuffer)
+{
+  if (DMA_StreamQueueGet(&hstream->DoneQueue, pBuffer) == 0U)
+  {
+    return HAL_ERROR;
+  }
+  
+  return HAL_OK;
+}
+
+/**
+  * @brief  Starts the DMA streaming on the two first buffers put in the context.
+  *         The peripheral DMA requests are then enabled by the caller.
+  * @param  hstream   pointer to a DMA_StreamTypeDef structure
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DMAEx_StreamStart(DMA_StreamTypeDef *hstream)
+{
+  DMA_HandleTypeDef *hdma = hstream->hdma;
+  HAL_StatusTypeDef status;
+  
+  if ((hstream->IdleQueue.In - hstream->IdleQueue.Out) < 2U)
+  {
+    return HAL_ERROR;
+  }
+  
+  (void)DMA_StreamQueueGet(&hstream->IdleQueue, &hstream->Target[0U]);
+  (void)DMA_StreamQueueGet(&hstream->IdleQueue, &hstream->Target[1U]);
+  
+  /* Take over the DMA callbacks */
+  hstream->Parent = hdma->Parent;
+  hdma->Parent = hstream;
+  hdma->XferCpltCallback = DMA_StreamM0Cplt;
+  hdma->XferM1CpltCallback = DMA_StreamM1Cplt;
+  hdma->XferErrorCallback = DMA_StreamError;
+  hdma->XferHalfCpltCallback = NULL;
+  hdma->XferM1HalfCpltCallback = NULL;
+  hdma->XferAbortCallback = NULL;
+  
+  if (hdma->Init.Direction == DMA_MEMORY_TO_PERIPH)
+  {
+    status = HAL_DMAEx_MultiBufferStart_IT(hdma, hstream->Target[0U], hstream->PeriphAddress, hstream->Target[1U], hstream->BufferLength);
+  }
+  else
+  {
+    status = HAL_DMAEx_MultiBufferStart_IT(hdma, hstream->PeriphAddress, hstream->Target[0U], hstream->Target[1U], hstream->BufferLength);
+  }
+  
+  if (status != HAL_OK)
+  {
+    hdma->Parent = hstream->Parent;
+    (void)DMA_StreamQueuePut(&hstream->IdleQueue, hstream->Target[0U]);
+    (void)DMA_StreamQueuePut(&hstream->IdleQueue, hstream->Target[1U]);
+  }
+  
+  return status;
+}
+
+/**
+  * @brief  Stops the DMA streaming. The two buffers which were DMA targets are
+  *         put back in the idle queue, their content is not valid.
+  * @param  hstream   pointer to a DMA_StreamTypeDef structure
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DMAEx_StreamStop(DMA_StreamTypeDef *hstream)
+{
+  DMA_HandleTypeDef *hdma = hstream->hdma;
+  HAL_StatusTypeDef status;
+  
+  status = HAL_DMA_Abort(hdma);
+  
+  hdma->Parent = hstream->Parent;
+  (void)DMA_StreamQueuePut(&hstream->IdleQueue, hstream->Target[0U]);
+  (void)DMA_StreamQueuePut(&hstream->IdleQueue, hstream->Target[1U]);
+  
+  return status;
+}
+
 /**
   * @}
   */
@@ -315,6 +470,122 @@ static void DMA_MultiBufferSetConfig(DMA_HandleTypeDef *hdma, uint32_t SrcAddres
   }
 }
 
+/**
+  * @brief  Puts a buffer address in a DMA streaming queue.
+  * @param  queue     pointer to a DMA_StreamQueueTypeDef structure
+  * @param  Buffer    The buffer address
+  * @retval 1 if the buffer was added, 0 if the queue is full
+  */
+static uint32_t DMA_StreamQueuePut(DMA_StreamQueueTypeDef *queue, uint32_t Buffer)
+{
+  uint32_t in = queue->In;
+  
+  if ((in - queue->Out) >= DMA_STREAM_QUEUE_SIZE)
+  {
+    return 0U;
+  }
+  
+  queue->Buffer[in & (DMA_STREAM_QUEUE_SIZE - 1U)] = Buffer;
+  
+  /* Publish the entry once written */
+  __DMB();
+  queue->In = in + 1U;
+  
+  return 1U;
+}
+
+/**
+  * @brief  Gets the oldest buffer address from a DMA streaming queue.
+  * @param  queue     pointer to a DMA_StreamQueueTypeDef structure
+  * @param  pBuffer   pointer to the buffer address
+  * @retval 1 if a buffer was got, 0 if the queue is empty
+  */
+static uint32_t DMA_StreamQueueGet(DMA_StreamQueueTypeDef *queue, uint32_t *pBuffer)
+{
+  uint32_t out = queue->Out;
+  
+  if (out == queue->In)
+  {
+    return 0U;
+  }
+  
+  *pBuffer = queue->Buffer[out & (DMA_STREAM_QUEUE_SIZE - 1U)];
+  
+  /* Release the entry once read */
+  __DMB();
+  queue->Out = out + 1U;
+  
+  return 1U;
+}
+
+/**
+  * @brief  Replaces the DMA memory target which just completed by the next
+  *         idle buffer, and releases the completed one.
+  * @param  hstream   pointer to a DMA_StreamTypeDef structure
+  * @param  memory    the memory target which just completed
+  * @retval None
+  */
+static void DMA_StreamSwap(DMA_StreamTypeDef *hstream, HAL_DMA_MemoryTypeDef memory)
+{
+  uint32_t next;
+  
+  if (DMA_StreamQueueGet(&hstream->IdleQueue, &next) == 0U)
+  {
+    /* No buffer to replace the completed one: leave it in place */
+    hstream->Starved++;
+    return;
+  }
+  
+  /* The DMA is now working on the other memory target */
+  (void)HAL_DMAEx_ChangeMemory(hstream->hdma, next, memory);
+  
+  (void)DMA_StreamQueuePut(&hstream->DoneQueue, hstream->Target[memory]);
+  hstream->Target[memory] = next;
+  
+  if (hstream->BufferCpltCallback != NULL)
+  {
+    hstream->BufferCpltCallback(hstream);
+  }
+}
+
+/**
+  * @brief  DMA streaming memory 0 transfer complete callback.
+  * @param  hdma      pointer to a DMA_HandleTypeDef structure that contains
+  *                     the configuration information for the specified DMA Stream.
+  * @retval None
+  */
+static void DMA_StreamM0Cplt(DMA_HandleTypeDef *hdma)
+{
+  DMA_StreamSwap((DMA_StreamTypeDef *)hdma->Parent, MEMORY0);
+}
+
+/**
+  * @brief  DMA streaming memory 1 transfer complete callback.
+  * @param  hdma      pointer to a DMA_HandleTypeDef structure that contains
+  *                     the configuration information for the specified DMA Stream.
+  * @retval None
+  */
+static void DMA_StreamM1Cplt(DMA_HandleTypeDef *hdma)
+{
+  DMA_StreamSwap((DMA_StreamTypeDef *)hdma->Parent, MEMORY1);
+}
+
+/**
+  * @brief  DMA streaming transfer error callback.
+  * @param  hdma      pointer to a DMA_HandleTypeDef structure that contains
+  *                     the configuration information for the specified DMA Stream.
+  * @retval None
+  */
+static void DMA_StreamError(DMA_HandleTypeDef *hdma)
+{
+  DMA_StreamTypeDef *hstream = (DMA_StreamTypeDef *)hdma->Parent;
+  
+  if (hstream->ErrorCallback != NULL)
+  {
+    hstream->ErrorCallback(hstream);
+  }
+}
+
 /**
   * @}
   */
@@ -68,6 +68,17 @@
     (#) In case of external interrupt/event mode selection, configure NVIC IRQ priority 
         mapped to the EXTI line using HAL_NVIC_SetPriority() and enable it using
         HAL_NVIC_EnableIRQ().
+
+    (#) Call HAL_GPIO_EXTI_IRQHandler() from the EXTI interrupt handlers. The
+        handlers of the shared vectors can give all their lines at once
+        (GPIO_EXTI_LINES_9_5, GPIO_EXTI_LINES_15_10): every pending line is
+        then serviced in the same call, the highest one first.
+
+    (#) A line calls HAL_GPIO_EXTI_Callback() with its pin, unless a handler
+        and its context were registered for it with
+        HAL_GPIO_EXTI_RegisterCallback(): that handler is then called instead,
+        through a table indexed by the line, until
+        HAL_GPIO_EXTI_UnRegisterCallback().
          
     (#) To get the level of a pin configured in input mode use HAL_GPIO_ReadPin().
             
@@ -153,6 +164,16 @@
   */
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
+/** @defgroup GPIO_Private_Variables GPIO Private Variables
+  * @{
+  */
+/* Handler and context registered for each EXTI line, HAL_GPIO_EXTI_Callback()
+   being called for the lines without one */
+static pGPIO_EXTI_CallbackTypeDef GPIO_EXTI_Callbacks[GPIO_NUMBER];
+static void *GPIO_EXTI_Contexts[GPIO_NUMBER];
+/**
+  * @}
+  */
 /* Private function prototypes -----------------------------------------------*/
 /* Private functions ---------------------------------------------------------*/
 /* Exported functions --------------------------------------------------------*/
@@ -497,16 +518,39 @@ HAL_StatusTypeDef HAL_GPIO_LockPin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin)
 
 /**
   * @brief  This function handles EXTI interrupt request.
+  * @note   Several lines may be given, as the ones sharing an interrupt
+  *         vector: all those pending and enabled are cleared at once, then
+  *         their handlers are called, the highest line first.
   * @param  GPIO_Pin Specifies the pins connected EXTI line
+  *         This parameter can be any combination of GPIO_PIN_x where x can be (0..15).
   * @retval None
   */
 void HAL_GPIO_EXTI_IRQHandler(uint16_t GPIO_Pin)
 {
+  uint32_t pending;
+  uint32_t line;
+
   /* EXTI line interrupt detected */
-  if(__HAL_GPIO_EXTI_GET_IT(GPIO_Pin) != RESET)
+  pending = __HAL_GPIO_EXTI_GET_IT(GPIO_Pin) & EXTI->IMR;
+  if(pending != 0U)
   {
-    __HAL_GPIO_EXTI_CLEAR_IT(GPIO_Pin);
-    HAL_GPIO_EXTI_Callback(GPIO_Pin);
+    __HAL_GPIO_EXTI_CLEAR_IT(pending);
+
+    do
+    {
+      line = 31U - __CLZ(pending);
+      pending &= ~(1UL << line);
+
+      if(GPIO_EXTI_Callbacks[line] != NULL)
+      {
+        GPIO_EXTI_Callbacks[line]((uint16_t)(1UL << line), GPIO_EXTI_Contexts[line]);
+      }
+      else
+      {
+        HAL_GPIO_EXTI_Callback((uint16_t)(1UL << line));
+      }
+    }
+    while(pending != 0U);
   }
 }
 
@@ -524,6 +568,58 @@ __weak void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
    */
 }
 
+/**
+  * @brief  Register the handler of one EXTI line, called instead of
+  *         HAL_GPIO_EXTI_Callback() for it.
+  * @param  GPIO_Pin Specifies the pin connected to the EXTI line
+  *         This parameter can be GPIO_PIN_x where x can be (0..15).
+  * @param  pCallback handler, called from the EXTI interrupt
+  * @param  pContext context given to the handler
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_GPIO_EXTI_RegisterCallback(uint16_t GPIO_Pin, pGPIO_EXTI_CallbackTypeDef pCallback, void *pContext)
+{
+  uint32_t line;
+
+  if((pCallback == NULL) || !IS_GPIO_SINGLE_PIN(GPIO_Pin))
+  {
+    return HAL_ERROR;
+  }
+
+  line = 31U - __CLZ(GPIO_Pin);
+
+  /* Cleared first, set last: an interrupt in between calls the default
+     callback, never the previous handler with the new context */
+  GPIO_EXTI_Callbacks[line] = NULL;
+  GPIO_EXTI_Contexts[line] = pContext;
+  GPIO_EXTI_Callbacks[line] = pCallback;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Unregister the handler of one EXTI line, HAL_GPIO_EXTI_Callback()
+  *         being called for it again.
+  * @param  GPIO_Pin Specifies the pin connected to the EXTI line
+  *         This parameter can be GPIO_PIN_x where x can be (0..15).
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_GPIO_EXTI_UnRegisterCallback(uint16_t GPIO_Pin)
+{
+  uint32_t line;
+
+  if(!IS_GPIO_SINGLE_PIN(GPIO_Pin))
+  {
+    return HAL_ERROR;
+  }
+
+  line = 31U - __CLZ(GPIO_Pin);
+  GPIO_EXTI_Callbacks[line] = NULL;
+  GPIO_EXTI_Contexts[line] = NULL;
+
+  return HAL_OK;
+}
+
 /**
   * @}
   */
@@ -363,8 +363,8 @@ void HAL_PCD_IRQHandler(PCD_HandleTypeDef *hpcd)
             
             if(hpcd->Init.dma_enable == 1U)
             {
-              hpcd->OUT_ep[epnum].xfer_count = hpcd->OUT_ep[epnum].maxpacket- (USBx_OUTEP(epnum)->DOEPTSIZ & USB_OTG_DOEPTSIZ_XFRSIZ); 
-              hpcd->OUT_ep[epnum].xfer_buff += hpcd->OUT_ep[epnum].maxpacket;            
+              hpcd->OUT_ep[epnum].xfer_count = hpcd->OUT_ep[epnum].xfer_size - (USBx_OUTEP(epnum)->DOEPTSIZ & USB_OTG_DOEPTSIZ_XFRSIZ);
+              hpcd->OUT_ep[epnum].xfer_buff += hpcd->OUT_ep[epnum].xfer_count;
             }
             
             HAL_PCD_DataOutStageCallback(hpcd, epnum);
@@ -674,6 +674,7 @@ void HAL_PCD_IRQHandler(PCD_HandleTypeDef *hpcd)
     /* Handle SOF Interrupt */
     if(__HAL_PCD_GET_FLAG(hpcd, USB_OTG_GINTSTS_SOF))
     {
+      __HAL_TRACE(HAL_TRACE_EVT_USB_SOF, hpcd->Instance);
       HAL_PCD_SOFCallback(hpcd);
       __HAL_PCD_CLEAR_FLAG(hpcd, USB_OTG_GINTSTS_SOF);
     }
@@ -0,0 +1,495 @@
+/**
+  ******************************************************************************
+  * @file    pdm2pcm_open.c
+  * @author  MCD Application Team
+  * @brief   Source implementation of the PDM2PCM conversion API of
+  *          pdm2pcm_glo.h: 4th order sinc decimator followed by a half-band
+  *          decimating FIR, high-pass filter and gain.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+This file replaces the precompiled PDM2PCM library with the same API: define
+PDM2PCM_OPEN in the compiler options, which enlarges the handler internal
+memory, compile this file and do not link the library. The BSP audio drivers
+and the applications calling PDM_Filter_Init(), PDM_Filter_setConfig() and
+PDM_Filter() are unchanged.
+
+Processing of each output sample, for one microphone:
+
+1- the PDM bits are read 8 at a time: each byte indexes 4 tables holding the
+   contributions of its 8 bits to a 4th order sinc filter over the last 4
+   bytes, so that the 1 bit samples are never unpacked. The bits are +1 or
+   -1, MSB or LSB first (bit_order, reversed with RBIT), in bytes swapped in
+   16-bit words when endianness is PDM_FILTER_ENDIANNESS_BE. Stereo and quad
+   interleaved streams from the I2S or SAI are read with a byte stride of
+   in_ptr_channels, one handler per microphone.
+
+2- a 4th order CIC at the byte rate completes the sinc filter down to twice
+   the output rate: decimation / 2 bits per sample. Decimation factors 16,
+   32, 48, 64, 80 and 128 are supported; 24 is not (12 bits per sample).
+
+3- a 39 taps half-band FIR decimates by 2, 10 dual 16-bit multiply-
+   accumulates (SMLAD) per output sample: pass band to 0.4 times the output
+   rate, 67 dB stop band from 0.6 times. The sinc filter droops by about
+   2.3 dB at 0.4 times the output rate.
+
+4- a first order high-pass filter, pole high_pass_tap in Q31 (0 to bypass),
+   then the gain of mic_gain dB, full scale PDM giving full scale PCM at
+   0 dB, and the 16-bit saturation. The output is written with a stride of
+   out_ptr_channels samples.
+
+The processing code can be placed in the ITCM and the tables in the DTCM with
+PDM2PCM_FASTCODE and PDM2PCM_FASTDATA, e.g. with section attributes copied
+there by the linker script.
+*******************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "pdm2pcm_glo.h"
+#include <string.h>
+
+#if defined(PDM2PCM_OPEN)
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  uint16_t  DecimationFactor;       /* PDM_FILTER_DEC_FACTOR_xxx               */
+  uint16_t  OutputSamples;          /* Output samples per PDM_Filter() call    */
+  int16_t   MicGain;                /* dB                                      */
+  uint16_t  Bytes;                  /* PDM bytes per CIC output sample         */
+  int32_t   Norm;                   /* CIC full scale to Q15, mantissa         */
+  uint32_t  NormShift;
+  int32_t   Gain;                   /* Output gain, Q16                        */
+  uint32_t  History;                /* Last 3 PDM bytes, newest in bits 0-7    */
+  int32_t   Integ[4];               /* CIC integrators                         */
+  int32_t   Comb[4];                /* CIC comb delays                         */
+  int32_t   HpIn;                   /* High-pass filter last input and output  */
+  int32_t   HpOut;
+  uint16_t  EvenIndex;              /* Newest even sample in Even              */
+  uint16_t  OddIndex;               /* Newest odd sample in Odd                */
+  int16_t   Even[10];               /* Even samples, for the center tap        */
+  int16_t   Odd[40];                /* Odd samples, written twice              */
+} PDM_Filter_State_t;
+
+/* Private define ------------------------------------------------------------*/
+#define PDM_FILTER_EVEN_LENGTH      10U
+#define PDM_FILTER_ODD_LENGTH       20U
+
+/* Placement of the processing code and tables. Override in main.h. */
+#if !defined(PDM2PCM_FASTCODE)
+#define PDM2PCM_FASTCODE
+#endif
+#if !defined(PDM2PCM_FASTDATA)
+#define PDM2PCM_FASTDATA
+#endif
+
+/* Private macro -------------------------------------------------------------*/
+/* The state must fit the handler internal memory */
+typedef char PDM_Filter_State_Size_Check[(sizeof(PDM_Filter_State_t) <=
+                                          (PDM2PCM_INTERNAL_MEMORY_SIZE * 4U)) ? 1 : -1];
+
+#define PDM_FILTER_STATE(__HANDLER__)   ((PDM_Filter_State_t *)(void *)(__HANDLER__)->pInternalMemory)
+
+/* Private variables ---------------------------------------------------------*/
+/* Contributions of the 8 bits of the newest byte to the 4th order sinc filter
+   over 8 bits, then of the 3 previous bytes. Bit 0 is the newest bit. */
+static const int16_t PDM_Filter_Sinc[4][256] PDM2PCM_FASTDATA =
+{
+  {
+     -330,  -328,  -322,  -320,  -310,  -308,  -302,  -300,  -290,  -288,  -282,  -280,  -270,  -268,  -262,  -260,
+     -260,  -258,  -252,  -250,  -240,  -238,  -232,  -230,  -220,  -218,  -212,  -210,  -200,  -198,  -192,  -190,
+     -218,  -216,  -210,  -208,  -198,  -196,  -190,  -188,  -178,  -176,  -170,  -168,  -158,  -156,  -150,  -148,
+     -148,  -146,  -140,  -138,  -128,  -126,  -120,  -118,  -108,  -106,  -100,   -98,   -88,   -86,   -80,   -78,
+     -162,  -160,  -154,  -152,  -142,  -140,  -134,  -132,  -122,  -120,  -114,  -112,  -102,  -100,   -94,   -92,
+      -92,   -90,   -84,   -82,   -72,   -70,   -64,   -62,   -52,   -50,   -44,   -42,   -32,   -30,   -24,   -22,
+      -50,   -48,   -42,   -40,   -30,   -28,   -22,   -20,   -10,    -8,    -2,     0,    10,    12,    18,    20,
+       20,    22,    28,    30,    40,    42,    48,    50,    60,    62,    68,    70,    80,    82,    88,    90,
+      -90,   -88,   -82,   -80,   -70,   -68,   -62,   -60,   -50,   -48,   -42,   -40,   -30,   -28,   -22,   -20,
+      -20,   -18,   -12,   -10,     0,     2,     8,    10,    20,    22,    28,    30,    40,    42,    48,    50,
+       22,    24,    30,    32,    42,    44,    50,    52,    62,    64,    70,    72,    82,    84,    90,    92,
+       92,    94,   100,   102,   112,   114,   120,   122,   132,   134,   140,   142,   152,   154,   160,   162,
+       78,    80,    86,    88,    98,   100,   106,   108,   118,   120,   126,   128,   138,   140,   146,   148,
+      148,   150,   156,   158,   168,   170,   176,   178,   188,   190,   196,   198,   208,   210,   216,   218,
+      190,   192,   198,   200,   210,   212,   218,   220,   230,   232,   238,   240,   250,   252,   258,   260,
+      260,   262,   268,   270,   280,   282,   288,   290,   300,   302,   308,   310,   320,   322,   328,   330
+  },
+  {
+    -2226, -1904, -1818, -1496, -1734, -1412, -1326, -1004, -1658, -1336, -1250,  -928, -1166,  -844,  -758,  -436,
+    -1596, -1274, -1188,  -866, -1104,  -782,  -696,  -374, -1028,  -706,  -620,  -298,  -536,  -214,  -128,   194,
+    -1554, -1232, -1146,  -824, -1062,  -740,  -654,  -332,  -986,  -664,  -578,  -256,  -494,  -172,   -86,   236,
+     -924,  -602,  -516,  -194,  -432,  -110,   -24,   298,  -356,   -34,    52,   374,   136,   458,   544,   866,
+    -1538, -1216, -1130,  -808, -1046,  -724,  -638,  -316,  -970,  -648,  -562,  -240,  -478,  -156,   -70,   252,
+     -908,  -586,  -500,  -178,  -416,   -94,    -8,   314,  -340,   -18,    68,   390,   152,   474,   560,   882,
+     -866,  -544,  -458,  -136,  -374,   -52,    34,   356,  -298,    24,   110,   432,   194,   516,   602,   924,
+     -236,    86,   172,   494,   256,   578,   664,   986,   332,   654,   740,  1062,   824,  1146,  1232,  1554,
+    -1554, -1232, -1146,  -824, -1062,  -740,  -654,  -332,  -986,  -664,  -578,  -256,  -494,  -172,   -86,   236,
+     -924,  -602,  -516,  -194,  -432,  -110,   -24,   298,  -356,   -34,    52,   374,   136,   458,   544,   866,
+     -882,  -560,  -474,  -152,  -390,   -68,    18,   340,  -314,     8,    94,   416,   178,   500,   586,   908,
+     -252,    70,   156,   478,   240,   562,   648,   970,   316,   638,   724,  1046,   808,  1130,  1216,  1538,
+     -866,  -544,  -458,  -136,  -374,   -52,    34,   356,  -298,    24,   110,   432,   194,   516,   602,   924,
+     -236,    86,   172,   494,   256,   578,   664,   986,   332,   654,   740,  1062,   824,  1146,  1232,  1554,
+     -194,   128,   214,   536,   298,   620,   706,  1028,   374,   696,   782,  1104,   866,  1188,  1274,  1596,
+      436,   758,   844,  1166,   928,  1250,  1336,  1658,  1004,  1326,  1412,  1734,  1496,  1818,  1904,  2226
+  },
+  {
+    -1470,  -840,  -902,  -272,  -978,  -348,  -410,   220, -1062,  -432,  -494,   136,  -570,    60,    -2,   628,
+    -1148,  -518,  -580,    50,  -656,   -26,   -88,   542,  -740,  -110,  -172,   458,  -248,   382,   320,   950,
+    -1230,  -600,  -662,   -32,  -738,  -108,  -170,   460,  -822,  -192,  -254,   376,  -330,   300,   238,   868,
+     -908,  -278,  -340,   290,  -416,   214,   152,   782,  -500,   130,    68,   698,    -8,   622,   560,  1190,
+    -1302,  -672,  -734,  -104,  -810,  -180,  -242,   388,  -894,  -264,  -326,   304,  -402,   228,   166,   796,
+     -980,  -350,  -412,   218,  -488,   142,    80,   710,  -572,    58,    -4,   626,   -80,   550,   488,  1118,
+    -1062,  -432,  -494,   136,  -570,    60,    -2,   628,  -654,   -24,   -86,   544,  -162,   468,   406,  1036,
+     -740,  -110,  -172,   458,  -248,   382,   320,   950,  -332,   298,   236,   866,   160,   790,   728,  1358,
+    -1358,  -728,  -790,  -160,  -866,  -236,  -298,   332,  -950,  -320,  -382,   248,  -458,   172,   110,   740,
+    -1036,  -406,  -468,   162,  -544,    86,    24,   654,  -628,     2,   -60,   570,  -136,   494,   432,  1062,
+    -1118,  -488,  -550,    80,  -626,     4,   -58,   572,  -710,   -80,  -142,   488,  -218,   412,   350,   980,
+     -796,  -166,  -228,   402,  -304,   326,   264,   894,  -388,   242,   180,   810,   104,   734,   672,  1302,
+    -1190,  -560,  -622,     8,  -698,   -68,  -130,   500,  -782,  -152,  -214,   416,  -290,   340,   278,   908,
+     -868,  -238,  -300,   330,  -376,   254,   192,   822,  -460,   170,   108,   738,    32,   662,   600,  1230,
+     -950,  -320,  -382,   248,  -458,   172,   110,   740,  -542,    88,    26,   656,   -50,   580,   518,  1148,
+     -628,     2,   -60,   570,  -136,   494,   432,  1062,  -220,   410,   348,   978,   272,   902,   840,  1470
+  },
+  {
+      -70,     0,   -30,    40,   -50,    20,   -10,    60,   -62,     8,   -22,    48,   -42,    28,    -2,    68,
+      -68,     2,   -28,    42,   -48,    22,    -8,    62,   -60,    10,   -20,    50,   -40,    30,     0,    70,
+      -70,     0,   -30,    40,   -50,    20,   -10,    60,   -62,     8,   -22,    48,   -42,    28,    -2,    68,
+      -68,     2,   -28,    42,   -48,    22,    -8,    62,   -60,    10,   -20,    50,   -40,    30,     0,    70,
+      -70,     0,   -30,    40,   -50,    20,   -10,    60,   -62,     8,   -22,    48,   -42,    28,    -2,    68,
+      -68,     2,   -28,    42,   -48,    22,    -8,    62,   -60,    10,   -20,    50,   -40,    30,     0,    70,
+      -70,     0,   -30,    40,   -50,    20,   -10,    60,   -62,     8,   -22,    48,   -42,    28,    -2,    68,
+      -68,     2,   -28,    42,   -48,    22,    -8,    62,   -60,    10,   -20,    50,   -40,    30,     0,    70,
+      -70,     0,   -30,    40,   -50,    20,   -10,    60,   -62,     8,   -22,    48,   -42,    28,    -2,    68,
+      -68,     2,   -28,    42,   -48,    22,    -8,    62,   -60,    10,   -20,    50,   -40,    30,     0,    70,
+      -70,     0,   -30,    40,   -50,    20,   -10,    60,   -62,     8,   -22,    48,   -42,    28,    -2,    68,
+      -68,     2,   -28,    42,   -48,    22,    -8,    62,   -60,    10,   -20,    50,   -40,    30,     0,    70,
+      -70,     0,   -30,    40,   -50,    20,   -10,    60,   -62,     8,   -22,    48,   -42,    28,    -2,    68,
+      -68,     2,   -28,    42,   -48,    22,    -8,    62,   -60,    10,   -20,    50,   -40,    30,     0,    70,
+      -70,     0,   -30,    40,   -50,    20,   -10,    60,   -62,     8,   -22,    48,   -42,    28,    -2,    68,
+      -68,     2,   -28,    42,   -48,    22,    -8,    62,   -60,    10,   -20,    50,   -40,    30,     0,    70
+  }
+};
+
+/* Half-band taps of the odd samples, Q15, oldest first; the center tap 1/2
+   applies to the even samples */
+static const int16_t PDM_Filter_HalfBand[PDM_FILTER_ODD_LENGTH] PDM2PCM_FASTDATA =
+{
+     -21,    53,  -116,   222,  -389,   648, -1055,  1754, -3268, 10359,
+  10359, -3268,  1754, -1055,   648,  -389,   222,  -116,    53,   -21
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t PDM_Filter_Decimation(uint16_t DecimationFactor);
+static int32_t  PDM_Filter_Read2(const int16_t *pData);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Check the handler and clear the filter state
+  * @param  pHandler: Handler, bit_order, endianness, high_pass_tap,
+  *         in_ptr_channels and out_ptr_channels set
+  * @retval 0, or PDM_FILTER_xxx_ERROR bits
+  */
+uint32_t PDM_Filter_Init(PDM_Filter_Handler_t *pHandler)
+{
+  uint32_t error = 0U;
+
+  if(pHandler->bit_order > PDM_FILTER_BIT_ORDER_MSB)
+  {
+    error |= PDM_FILTER_BIT_ORDER_ERROR;
+  }
+  if(pHandler->endianness > PDM_FILTER_ENDIANNESS_BE)
+  {
+    error |= PDM_FILTER_ENDIANNESS_ERROR;
+  }
+  if((pHandler->in_ptr_channels == 0U) || (pHandler->out_ptr_channels == 0U))
+  {
+    error |= PDM_FILTER_CONFIG_ERROR;
+  }
+
+  memset(pHandler->pInternalMemory, 0, sizeof(pHandler->pInternalMemory));
+  if(error != 0U)
+  {
+    error |= PDM_FILTER_INIT_ERROR;
+  }
+
+  return error;
+}
+
+/**
+  * @brief  Set the decimation factor, the samples per call and the gain,
+  *         clearing the filter state
+  * @param  pHandler: Handler, initialized
+  * @param  pConfig: Configuration
+  * @retval 0, or PDM_FILTER_xxx_ERROR bits
+  */
+uint32_t PDM_Filter_setConfig(PDM_Filter_Handler_t *pHandler, PDM_Filter_Config_t *pConfig)
+{
+  PDM_Filter_State_t *pstate = PDM_FILTER_STATE(pHandler);
+  uint32_t decimation = PDM_Filter_Decimation(pConfig->decimation_factor);
+  uint32_t error = 0U;
+  double mantissa;
+  double half;
+  float gain = 65536.0f;
+  uint32_t shift;
+  int32_t i;
+
+  /* Whole PDM bytes per sinc output, at twice the output rate */
+  if((decimation == 0U) || ((decimation % 16U) != 0U))
+  {
+    error |= PDM_FILTER_DECIMATION_ERROR;
+  }
+  if(pConfig->output_samples_number == 0U)
+  {
+    error |= PDM_FILTER_SAMPLES_NUMBER_ERROR;
+  }
+  if((pConfig->mic_gain < -12) || (pConfig->mic_gain > 51))
+  {
+    error |= PDM_FILTER_GAIN_ERROR;
+  }
+  if(error != 0U)
+  {
+    return error | PDM_FILTER_CONFIG_ERROR;
+  }
+
+  memset(pHandler->pInternalMemory, 0, sizeof(pHandler->pInternalMemory));
+  pstate->DecimationFactor = pConfig->decimation_factor;
+  pstate->OutputSamples    = pConfig->output_samples_number;
+  pstate->MicGain          = pConfig->mic_gain;
+  pstate->Bytes            = (uint16_t)(decimation / 16U);
+
+  /* Sinc full scale (decimation / 2)^4 to Q15 full scale */
+  half = (double)decimation / 2.0;
+  mantissa = 32767.0 / (half * half * half * half);
+  shift = 0U;
+  while(mantissa < 1073741824.0)
+  {
+    mantissa *= 2.0;
+    shift++;
+  }
+  pstate->Norm      = (int32_t)mantissa;
+  pstate->NormShift = shift;
+
+  /* 10^(mic_gain / 20) in Q16 */
+  for(i = 0; i < pConfig->mic_gain; i++)
+  {
+    gain *= 1.12201845f;
+  }
+  for(i = 0; i > pConfig->mic_gain; i--)
+  {
+    gain *= 0.89125094f;
+  }
+  pstate->Gain = (int32_t)(gain + 0.5f);
+
+  return 0U;
+}
+
+/**
+  * @brief  Get the configuration
+  * @param  pHandler: Handler, configured
+  * @param  pConfig: Configuration
+  * @retval 0
+  */
+uint32_t PDM_Filter_getConfig(PDM_Filter_Handler_t *pHandler, PDM_Filter_Config_t *pConfig)
+{
+  PDM_Filter_State_t *pstate = PDM_FILTER_STATE(pHandler);
+
+  pConfig->decimation_factor     = pstate->DecimationFactor;
+  pConfig->output_samples_number = pstate->OutputSamples;
+  pConfig->mic_gain              = pstate->MicGain;
+
+  return 0U;
+}
+
+/**
+  * @brief  Extract the PDM bytes of one microphone from an interleaved stream
+  * @param  pDataIn: First byte of the microphone in the interleaved stream
+  * @param  pDataOut: PDM bytes of the microphone for one PDM_Filter() call,
+  *         output_samples_number * decimation / 8 bytes
+  * @param  pHandler: Handler, configured
+  * @retval 0
+  */
+uint32_t PDM_Filter_deInterleave(void *pDataIn, void *pDataOut, PDM_Filter_Handler_t *pHandler)
+{
+  PDM_Filter_State_t *pstate = PDM_FILTER_STATE(pHandler);
+  const uint8_t *pin = (const uint8_t *)pDataIn;
+  uint8_t *pout = (uint8_t *)pDataOut;
+  uint32_t count = 2U * (uint32_t)pstate->Bytes * pstate->OutputSamples;
+  uint32_t stride = pHandler->in_ptr_channels;
+
+  while(count > 0U)
+  {
+    *pout++ = *pin;
+    pin += stride;
+    count--;
+  }
+
+  return 0U;
+}
+
+/**
+  * @brief  Convert output_samples_number PCM samples of one microphone
+  * @param  pDataIn: First PDM byte of the microphone, the bytes of the
+  *         microphones interleaved by in_ptr_channels
+  * @param  pDataOut: First PCM sample of the microphone, 16-bit, the samples
+  *         interleaved by out_ptr_channels
+  * @param  pHandler: Handler, configured
+  * @retval 0
+  */
+PDM2PCM_FASTCODE uint32_t PDM_Filter(void *pDataIn, void *pDataOut, PDM_Filter_Handler_t *pHandler)
+{
+  PDM_Filter_State_t *pstate = PDM_FILTER_STATE(pHandler);
+  const uint8_t *pin = (const uint8_t *)pDataIn;
+  int16_t *pout = (int16_t *)pDataOut;
+  uint32_t instride = pHandler->in_ptr_channels;
+  uint32_t outstride = pHandler->out_ptr_channels;
+  uint32_t swap = (pHandler->endianness == PDM_FILTER_ENDIANNESS_BE) ? 1U : 0U;
+  uint32_t lsb = (pHandler->bit_order == PDM_FILTER_BIT_ORDER_LSB) ? 1U : 0U;
+  int32_t hptap = (int32_t)pHandler->high_pass_tap;
+  uint32_t history = pstate->History;
+  int32_t i0 = pstate->Integ[0], i1 = pstate->Integ[1], i2 = pstate->Integ[2], i3 = pstate->Integ[3];
+  uint32_t byte = 0U;
+  uint32_t count;
+  uint32_t phase;
+  uint32_t n;
+  uint32_t b;
+  int32_t c, d;
+  int32_t acc;
+  const int16_t *pwin;
+
+  for(count = pstate->OutputSamples; count > 0U; count--)
+  {
+    for(phase = 0U; phase < 2U; phase++)
+    {
+      /* Sinc over 8 bits by tables, then integrators at the byte rate */
+      for(n = pstate->Bytes; n > 0U; n--)
+      {
+        b = pin[(byte ^ swap) * instride];
+        byte++;
+        if(lsb != 0U)
+        {
+          b = __RBIT(b) >> 24;
+        }
+        i0 += PDM_Filter_Sinc[0][b] + PDM_Filter_Sinc[1][history & 0xFFU] +
+              PDM_Filter_Sinc[2][(history >> 8) & 0xFFU] + PDM_Filter_Sinc[3][(history >> 16) & 0xFFU];
+        i1 += i0;
+        i2 += i1;
+        i3 += i2;
+        history = (history << 8) | b;
+      }
+
+      /* Combs at twice the output rate, modulo 2^32 arithmetic */
+      c = i3 - pstate->Comb[0];
+      pstate->Comb[0] = i3;
+      d = c - pstate->Comb[1];
+      pstate->Comb[1] = c;
+      c = d - pstate->Comb[2];
+      pstate->Comb[2] = d;
+      d = c - pstate->Comb[3];
+      pstate->Comb[3] = c;
+      d = __SSAT((int32_t)(((int64_t)d * pstate->Norm) >> pstate->NormShift), 16);
+
+      if(phase == 0U)
+      {
+        pstate->EvenIndex = (pstate->EvenIndex == (PDM_FILTER_EVEN_LENGTH - 1U)) ? 0U : (pstate->EvenIndex + 1U);
+        pstate->Even[pstate->EvenIndex] = (int16_t)d;
+      }
+      else
+      {
+        pstate->OddIndex = (pstate->OddIndex == (PDM_FILTER_ODD_LENGTH - 1U)) ? 0U : (pstate->OddIndex + 1U);
+        pstate->Odd[pstate->OddIndex] = (int16_t)d;
+        pstate->Odd[pstate->OddIndex + PDM_FILTER_ODD_LENGTH] = (int16_t)d;
+      }
+    }
+
+    /* Half-band: center tap on the even sample 9 samples back, the oldest of Even */
+    acc = (int32_t)pstate->Even[(pstate->EvenIndex == (PDM_FILTER_EVEN_LENGTH - 1U)) ? 0U :
+                                (pstate->EvenIndex + 1U)] << 14;
+    pwin = &pstate->Odd[pstate->OddIndex + 1U];
+    for(n = 0U; n < PDM_FILTER_ODD_LENGTH; n += 2U)
+    {
+      acc = (int32_t)__SMLAD((uint32_t)PDM_Filter_Read2(&pwin[n]), (uint32_t)PDM_Filter_Read2(&PDM_Filter_HalfBand[n]),
+                             (uint32_t)acc);
+    }
+    acc >>= 15;
+
+    /* High-pass filter, y = tap * (y' + x - x') */
+    if(hptap != 0)
+    {
+      c = (int32_t)(((int64_t)hptap * (int64_t)(pstate->HpOut + acc - pstate->HpIn)) >> 31);
+      pstate->HpIn = acc;
+      pstate->HpOut = c;
+      acc = c;
+    }
+
+    *pout = (int16_t)__SSAT((int32_t)(((int64_t)acc * pstate->Gain) >> 16), 16);
+    pout += outstride;
+  }
+
+  pstate->History  = history;
+  pstate->Integ[0] = i0;
+  pstate->Integ[1] = i1;
+  pstate->Integ[2] = i2;
+  pstate->Integ[3] = i3;
+
+  return 0U;
+}
+
+/**
+  * @brief  Decimation factor of a PDM_FILTER_DEC_FACTOR_xxx code
+  * @param  DecimationFactor: PDM_FILTER_DEC_FACTOR_xxx
+  * @retval Decimation factor, 0 if unknown
+  */
+static uint32_t PDM_Filter_Decimation(uint16_t DecimationFactor)
+{
+  static const uint8_t factors[8] = { 0U, 48U, 64U, 80U, 128U, 16U, 24U, 32U };
+
+  return (DecimationFactor < 8U) ? factors[DecimationFactor] : 0U;
+}
+
+/**
+  * @brief  Read two 16-bit samples as one word, at any half-word address
+  * @param  pData: First sample, in the low half-word
+  * @retval Samples
+  */
+static int32_t PDM_Filter_Read2(const int16_t *pData)
+{
+  int32_t value;
+
+  /* Single LDR, never merged into an LDRD or LDM needing word alignment */
+  memcpy(&value, pData, sizeof(value));
+
+  return value;
+}
+
+#endif /* PDM2PCM_OPEN */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
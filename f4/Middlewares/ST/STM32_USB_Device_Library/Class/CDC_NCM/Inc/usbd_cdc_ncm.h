@@ -0,0 +1,258 @@
+/**
+  ******************************************************************************
+  * @file    usbd_cdc_ncm.h
+  * @author  MCD Application Team
+  * @brief   header file for the usbd_cdc_ncm.c file.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2015 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __USB_CDC_NCM_H
+#define __USB_CDC_NCM_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include  "usbd_ioreq.h"
+
+/** @addtogroup STM32_USB_DEVICE_LIBRARY
+  * @{
+  */
+
+/** @defgroup usbd_cdc_ncm
+  * @brief This file is the Header file for usbd_cdc_ncm.c
+  * @{
+  */
+
+
+/** @defgroup usbd_cdc_ncm_Exported_Defines
+  * @{
+  */
+#ifndef NCM_IN_EP
+#define NCM_IN_EP                                   0x81U  /* EP1 for data IN */
+#endif /* NCM_IN_EP */
+#ifndef NCM_OUT_EP
+#define NCM_OUT_EP                                  0x01U  /* EP1 for data OUT */
+#endif /* NCM_OUT_EP */
+#ifndef NCM_CMD_EP
+#define NCM_CMD_EP                                  0x82U  /* EP2 for notifications */
+#endif /* NCM_CMD_EP */
+
+#ifndef NCM_HS_BINTERVAL
+  #define NCM_HS_BINTERVAL                          0x08U
+#endif /* NCM_HS_BINTERVAL */
+
+#ifndef NCM_FS_BINTERVAL
+  #define NCM_FS_BINTERVAL                          0x10U
+#endif /* NCM_FS_BINTERVAL */
+
+/* Largest NTB sent to the host and received from it, in bytes: multiples of
+   4, from 2048 to 65532. The host may lower the IN size with
+   SET_NTB_INPUT_SIZE. Larger NTBs carry more datagrams per transfer. */
+#ifndef USBD_CDC_NCM_NTB_IN_SIZE
+#define USBD_CDC_NCM_NTB_IN_SIZE                    8192U
+#endif /* USBD_CDC_NCM_NTB_IN_SIZE */
+#ifndef USBD_CDC_NCM_NTB_OUT_SIZE
+#define USBD_CDC_NCM_NTB_OUT_SIZE                   8192U
+#endif /* USBD_CDC_NCM_NTB_OUT_SIZE */
+
+/* NTB buffers in each direction, 2 at least: one is filled (IN) or held by
+   the application (OUT) while the other one is transferred */
+#ifndef USBD_CDC_NCM_TX_NTB_NBR
+#define USBD_CDC_NCM_TX_NTB_NBR                     2U
+#endif /* USBD_CDC_NCM_TX_NTB_NBR */
+#ifndef USBD_CDC_NCM_RX_NTB_NBR
+#define USBD_CDC_NCM_RX_NTB_NBR                     2U
+#endif /* USBD_CDC_NCM_RX_NTB_NBR */
+
+/* Most datagrams aggregated in one IN NTB */
+#ifndef USBD_CDC_NCM_MAX_DATAGRAMS
+#define USBD_CDC_NCM_MAX_DATAGRAMS                  32U
+#endif /* USBD_CDC_NCM_MAX_DATAGRAMS */
+
+/* String descriptor index of the MAC address of the host interface */
+#ifndef USBD_CDC_NCM_MAC_STR_INDEX
+#define USBD_CDC_NCM_MAC_STR_INDEX                  0x06U
+#endif /* USBD_CDC_NCM_MAC_STR_INDEX */
+
+/* Default MAC address of the host interface: locally administered */
+#ifndef USBD_CDC_NCM_MAC_ADDRESS
+#define USBD_CDC_NCM_MAC_ADDRESS                    { 0x02U, 0x80U, 0xE1U, 0x00U, 0x00U, 0x01U }
+#endif /* USBD_CDC_NCM_MAC_ADDRESS */
+
+/* Largest Ethernet frame, without FCS */
+#define USBD_CDC_NCM_MAX_SEGMENT                    1514U
+
+/* NCM Endpoints parameters */
+#define NCM_DATA_HS_MAX_PACKET_SIZE                 512U  /* Endpoint IN & OUT Packet size */
+#define NCM_DATA_FS_MAX_PACKET_SIZE                 64U  /* Endpoint IN & OUT Packet size */
+#define NCM_CMD_PACKET_SIZE                         16U  /* Notification Endpoint Packet size */
+
+#define USB_CDC_NCM_CONFIG_DESC_SIZ                 86U
+
+/*---------------------------------------------------------------------*/
+/*  CDC NCM definitions                                                */
+/*---------------------------------------------------------------------*/
+#define NCM_SET_ETHERNET_MULTICAST_FILTERS          0x40U
+#define NCM_SET_ETHERNET_PM_PATTERN_FILTER          0x41U
+#define NCM_GET_ETHERNET_PM_PATTERN_FILTER          0x42U
+#define NCM_SET_ETHERNET_PACKET_FILTER              0x43U
+#define NCM_GET_ETHERNET_STATISTIC                  0x44U
+#define NCM_GET_NTB_PARAMETERS                      0x80U
+#define NCM_GET_NET_ADDRESS                         0x81U
+#define NCM_SET_NET_ADDRESS                         0x82U
+#define NCM_GET_NTB_FORMAT                          0x83U
+#define NCM_SET_NTB_FORMAT                          0x84U
+#define NCM_GET_NTB_INPUT_SIZE                      0x85U
+#define NCM_SET_NTB_INPUT_SIZE                      0x86U
+
+#define NCM_NETWORK_CONNECTION                      0x00U
+#define NCM_CONNECTION_SPEED_CHANGE                 0x2AU
+
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_CORE_Exported_TypesDefinitions
+  * @{
+  */
+
+/**
+  * @}
+  */
+typedef struct _USBD_CDC_NCM_Itf
+{
+  int8_t (* Init)          (void);
+  int8_t (* DeInit)        (void);
+  int8_t (* Control)       (uint8_t cmd, uint8_t* pbuf, uint16_t length);
+  int8_t (* Receive)       (uint8_t* pDatagram, uint16_t Length);
+  int8_t (* TxReady)       (void);   /* May be NULL */
+
+}USBD_CDC_NCM_ItfTypeDef;
+
+
+typedef struct
+{
+  uint32_t data[8];                                     /* Class requests, force 32bits alignment */
+  uint32_t Notify[NCM_CMD_PACKET_SIZE / 4U];
+  uint8_t  CmdOpCode;
+  uint8_t  CmdLength;
+  uint8_t  DataAlt;                                     /* Data interface alternate setting */
+  uint8_t  LinkUp;
+  uint32_t BitRate;
+  uint32_t NtbInSize;                                   /* Set by the host, USBD_CDC_NCM_NTB_IN_SIZE at most */
+  __IO uint32_t NotifyPending;
+  __IO uint32_t NotifyState;
+
+  /* IN NTBs: TxTail counts the NTBs sent, TxHead the NTBs closed; the NTB
+     being filled is TxNtb[TxHead % USBD_CDC_NCM_TX_NTB_NBR] */
+  uint32_t TxNtb[USBD_CDC_NCM_TX_NTB_NBR][USBD_CDC_NCM_NTB_IN_SIZE / 4U];
+  uint32_t TxNtbLength[USBD_CDC_NCM_TX_NTB_NBR];
+  __IO uint32_t TxHead;
+  __IO uint32_t TxTail;
+  uint32_t TxLength;                                    /* Bytes used in the NTB being filled */
+  uint32_t TxCount;                                     /* Datagrams in the NTB being filled */
+  uint16_t TxDatagram[USBD_CDC_NCM_MAX_DATAGRAMS][2];   /* Their index and length */
+  uint32_t TxOffset;                                    /* Datagram given by USBD_CDC_NCM_AllocTx() */
+  uint32_t TxReserved;
+  uint16_t TxSequence;
+  __IO uint32_t TxState;
+  __IO uint32_t TxBlocked;
+
+  /* OUT NTBs: datagrams are given in place to the application, each one
+     holding a reference on its NTB until USBD_CDC_NCM_ReleaseRx() */
+  uint32_t RxNtb[USBD_CDC_NCM_RX_NTB_NBR][USBD_CDC_NCM_NTB_OUT_SIZE / 4U];
+  __IO uint32_t RxRef[USBD_CDC_NCM_RX_NTB_NBR];
+  __IO uint32_t RxArmed;                                /* NTB receiving, USBD_CDC_NCM_RX_NTB_NBR: none */
+
+  /* Statistics */
+  uint32_t TxNtbs;
+  uint32_t TxDatagrams;
+  uint32_t RxNtbs;
+  uint32_t RxDatagrams;
+  uint32_t RxDropped;                                   /* Datagrams refused by Receive() */
+  uint32_t RxErrors;                                    /* Malformed NTBs and datagrams */
+}
+USBD_CDC_NCM_HandleTypeDef;
+
+
+
+/** @defgroup USBD_CORE_Exported_Macros
+  * @{
+  */
+
+/**
+  * @}
+  */
+
+/** @defgroup USBD_CORE_Exported_Variables
+  * @{
+  */
+
+extern USBD_ClassTypeDef  USBD_CDC_NCM;
+#define USBD_CDC_NCM_CLASS    &USBD_CDC_NCM
+/**
+  * @}
+  */
+
+/** @defgroup USB_CORE_Exported_Functions
+  * @{
+  */
+uint8_t  USBD_CDC_NCM_RegisterInterface  (USBD_HandleTypeDef   *pdev,
+                                          USBD_CDC_NCM_ItfTypeDef *fops);
+
+uint8_t  USBD_CDC_NCM_SetMACAddress      (USBD_HandleTypeDef *pdev,
+                                          const uint8_t *pMAC);
+
+uint8_t  USBD_CDC_NCM_SetLink            (USBD_HandleTypeDef *pdev,
+                                          uint8_t LinkUp, uint32_t BitRate);
+
+uint8_t  USBD_CDC_NCM_Transmit           (USBD_HandleTypeDef *pdev,
+                                          const uint8_t *pDatagram, uint16_t Length);
+
+uint8_t  *USBD_CDC_NCM_AllocTx           (USBD_HandleTypeDef *pdev,
+                                          uint16_t Length);
+
+uint8_t  USBD_CDC_NCM_CommitTx           (USBD_HandleTypeDef *pdev,
+                                          uint16_t Length);
+
+uint8_t  USBD_CDC_NCM_ReleaseRx          (USBD_HandleTypeDef *pdev,
+                                          const uint8_t *pDatagram);
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __USB_CDC_NCM_H */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
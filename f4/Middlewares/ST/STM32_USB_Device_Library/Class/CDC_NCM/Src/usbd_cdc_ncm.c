@@ -0,0 +1,1610 @@
+/**
+  ******************************************************************************
+  * @file    usbd_cdc_ncm.c
+  * @author  MCD Application Team
+  * @brief   This file provides the high layer firmware functions to manage the
+  *          USB CDC NCM Class: Ethernet datagrams aggregated in NTBs.
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                CDC NCM Class Driver Description
+  *          ===================================================================
+  *           This driver manages the "Universal Serial Bus Communications Class
+  *           Subclass Specification for Network Control Model Devices Revision
+  *           1.0 November 24, 2010" with the 16-bit NTB format:
+  *             - Configuration descriptor management, with the Ethernet
+  *               Networking and NCM functional descriptors
+  *             - Data interface with an empty default setting; the data
+  *               endpoints are opened when the host selects setting 1, which
+  *               also sends the link speed and state notifications
+  *             - NTB parameters, NTB input size and NTB format requests
+  *             - iMACAddress string, when USBD_SUPPORT_USER_STRING is 1 in
+  *               usbd_conf.h (hosts refuse the function without it)
+  *
+  *           Aggregation:
+  *             USBD_CDC_NCM_Transmit() copies a datagram into the NTB being
+  *             filled, USBD_CDC_NCM_AllocTx()/USBD_CDC_NCM_CommitTx() let the
+  *             application build it in place. The NTB is sent as soon as the
+  *             IN endpoint is idle: while a transfer is in flight the
+  *             datagrams accumulate, up to USBD_CDC_NCM_MAX_DATAGRAMS or the
+  *             NTB input size of the host, so the number of transfers and
+  *             interrupts drops as the load rises. OUT NTBs of up to
+  *             USBD_CDC_NCM_NTB_OUT_SIZE bytes are received in
+  *             USBD_CDC_NCM_RX_NTB_NBR buffers and their datagrams given in
+  *             place to the interface Receive() callback; an NTB is received
+  *             again once the application released all its datagrams with
+  *             USBD_CDC_NCM_ReleaseRx(), the host being NAKed meanwhile.
+  *
+  *           The NTB buffers are part of the class data from USBD_malloc():
+  *           place it in memory the USB DMA reaches and, on a Cortex-M7 with
+  *           the D-cache enabled, outside of the cacheable regions. The
+  *           application calls the transmit and release functions at the
+  *           priority of the USB interrupt or from a context it preempts.
+  *
+  *           The device descriptor uses the CDC class code, or the IAD class
+  *           codes in a composite device.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2015 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+  /* BSPDependencies
+  - "stm32xxxxx_{eval}{discovery}{nucleo_144}.c"
+  - "stm32xxxxx_{eval}{discovery}_io.c"
+  EndBSPDependencies */
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbd_cdc_ncm.h"
+#include "usbd_ctlreq.h"
+
+
+/** @addtogroup STM32_USB_DEVICE_LIBRARY
+  * @{
+  */
+
+
+/** @defgroup USBD_CDC_NCM
+  * @brief usbd core module
+  * @{
+  */
+
+/** @defgroup USBD_CDC_NCM_Private_TypesDefinitions
+  * @{
+  */
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_CDC_NCM_Private_Defines
+  * @{
+  */
+#ifndef USBD_memcpy
+#include <string.h>
+#define USBD_memcpy                 memcpy
+#endif /* USBD_memcpy */
+
+#define NCM_NTH16_SIGNATURE         0x484D434EU   /* "NCMH" */
+#define NCM_NDP16_SIGNATURE         0x304D434EU   /* "NCM0", no CRC */
+#define NCM_NTH16_SIZE              12U
+#define NCM_NDP16_SIZE(__N__)       (8U + (4U * ((__N__) + 1U)))
+#define NCM_NTB_PARAMETERS_SIZE     28U
+#define NCM_NTB_MIN_IN_SIZE         2048U
+#define NCM_ALIGNMENT               4U            /* Datagrams and NDPs */
+#define NCM_MAX_NDP                 8U            /* NDPs followed in an OUT NTB */
+#define NCM_COMM_ITF                0x00U
+#define NCM_DATA_ITF                0x01U
+
+#define NCM_NOTIFY_SPEED            0x01U
+#define NCM_NOTIFY_CONNECTION       0x02U
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_CDC_NCM_Private_Macros
+  * @{
+  */
+#define NCM_DATA_MAX_PACKET_SIZE(__PDEV__)  (((__PDEV__)->dev_speed == USBD_SPEED_HIGH) ? \
+                                             NCM_DATA_HS_MAX_PACKET_SIZE : NCM_DATA_FS_MAX_PACKET_SIZE)
+#define NCM_ALIGN(__X__)                    (((__X__) + (NCM_ALIGNMENT - 1U)) & ~(NCM_ALIGNMENT - 1U))
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_CDC_NCM_Private_FunctionPrototypes
+  * @{
+  */
+
+
+static uint8_t  USBD_CDC_NCM_Init (USBD_HandleTypeDef *pdev,
+                                   uint8_t cfgidx);
+
+static uint8_t  USBD_CDC_NCM_DeInit (USBD_HandleTypeDef *pdev,
+                                     uint8_t cfgidx);
+
+static uint8_t  USBD_CDC_NCM_Setup (USBD_HandleTypeDef *pdev,
+                                    USBD_SetupReqTypedef *req);
+
+static uint8_t  USBD_CDC_NCM_DataIn (USBD_HandleTypeDef *pdev,
+                                     uint8_t epnum);
+
+static uint8_t  USBD_CDC_NCM_DataOut (USBD_HandleTypeDef *pdev,
+                                      uint8_t epnum);
+
+static uint8_t  USBD_CDC_NCM_EP0_RxReady (USBD_HandleTypeDef *pdev);
+
+static uint8_t  *USBD_CDC_NCM_GetFSCfgDesc (uint16_t *length);
+
+static uint8_t  *USBD_CDC_NCM_GetHSCfgDesc (uint16_t *length);
+
+static uint8_t  *USBD_CDC_NCM_GetOtherSpeedCfgDesc (uint16_t *length);
+
+#if (USBD_SUPPORT_USER_STRING == 1)
+static uint8_t  *USBD_CDC_NCM_GetUsrStrDescriptor (USBD_HandleTypeDef *pdev,
+                                                   uint8_t index, uint16_t *length);
+#endif
+
+uint8_t  *USBD_CDC_NCM_GetDeviceQualifierDescriptor (uint16_t *length);
+
+static void     USBD_CDC_NCM_SetAlt (USBD_HandleTypeDef *pdev, uint8_t alt);
+
+static void     USBD_CDC_NCM_Notify (USBD_HandleTypeDef *pdev);
+
+static void     USBD_CDC_NCM_CloseNtb (USBD_HandleTypeDef *pdev);
+
+static void     USBD_CDC_NCM_Flush (USBD_HandleTypeDef *pdev);
+
+static void     USBD_CDC_NCM_Arm (USBD_HandleTypeDef *pdev);
+
+static void     USBD_CDC_NCM_Parse (USBD_HandleTypeDef *pdev, uint32_t ntb,
+                                    uint32_t length);
+
+static uint16_t USBD_CDC_NCM_Get16 (const uint8_t *pbuf);
+
+static uint32_t USBD_CDC_NCM_Get32 (const uint8_t *pbuf);
+
+static void     USBD_CDC_NCM_Put16 (uint8_t *pbuf, uint32_t value);
+
+static void     USBD_CDC_NCM_Put32 (uint8_t *pbuf, uint32_t value);
+
+/* USB Standard Device Descriptor */
+__ALIGN_BEGIN static uint8_t USBD_CDC_NCM_DeviceQualifierDesc[USB_LEN_DEV_QUALIFIER_DESC] __ALIGN_END =
+{
+  USB_LEN_DEV_QUALIFIER_DESC,
+  USB_DESC_TYPE_DEVICE_QUALIFIER,
+  0x00,
+  0x02,
+  0x00,
+  0x00,
+  0x00,
+  0x40,
+  0x01,
+  0x00,
+};
+
+/**
+  * @}
+  */
+
+/** @defgroup USBD_CDC_NCM_Private_Variables
+  * @{
+  */
+
+
+/* CDC NCM interface class callbacks structure */
+USBD_ClassTypeDef  USBD_CDC_NCM =
+{
+  USBD_CDC_NCM_Init,
+  USBD_CDC_NCM_DeInit,
+  USBD_CDC_NCM_Setup,
+  NULL,                 /* EP0_TxSent, */
+  USBD_CDC_NCM_EP0_RxReady,
+  USBD_CDC_NCM_DataIn,
+  USBD_CDC_NCM_DataOut,
+  NULL,
+  NULL,
+  NULL,
+  USBD_CDC_NCM_GetHSCfgDesc,
+  USBD_CDC_NCM_GetFSCfgDesc,
+  USBD_CDC_NCM_GetOtherSpeedCfgDesc,
+  USBD_CDC_NCM_GetDeviceQualifierDescriptor,
+#if (USBD_SUPPORT_USER_STRING == 1)
+  USBD_CDC_NCM_GetUsrStrDescriptor,
+#endif
+};
+
+/* USB CDC NCM device Configuration Descriptor */
+__ALIGN_BEGIN uint8_t USBD_CDC_NCM_CfgHSDesc[USB_CDC_NCM_CONFIG_DESC_SIZ] __ALIGN_END =
+{
+  /*Configuration Descriptor*/
+  0x09,   /* bLength: Configuration Descriptor size */
+  USB_DESC_TYPE_CONFIGURATION,      /* bDescriptorType: Configuration */
+  USB_CDC_NCM_CONFIG_DESC_SIZ,            /* wTotalLength:no of returned bytes */
+  0x00,
+  0x02,   /* bNumInterfaces: 2 interface */
+  0x01,   /* bConfigurationValue: Configuration value */
+  0x00,   /* iConfiguration: Index of string descriptor describing the configuration */
+  0xC0,   /* bmAttributes: self powered */
+  0x32,   /* MaxPower 100 mA */
+
+  /*---------------------------------------------------------------------------*/
+
+  /*Communication Interface Descriptor */
+  0x09,   /* bLength: Interface Descriptor size */
+  USB_DESC_TYPE_INTERFACE,  /* bDescriptorType: Interface */
+  0x00,   /* bInterfaceNumber: Number of Interface */
+  0x00,   /* bAlternateSetting: Alternate setting */
+  0x01,   /* bNumEndpoints: One endpoint used */
+  0x02,   /* bInterfaceClass: Communication Interface Class */
+  0x0D,   /* bInterfaceSubClass: Network Control Model */
+  0x00,   /* bInterfaceProtocol: No encapsulated command */
+  0x00,   /* iInterface: */
+
+  /*Header Functional Descriptor*/
+  0x05,   /* bLength: Endpoint Descriptor size */
+  0x24,   /* bDescriptorType: CS_INTERFACE */
+  0x00,   /* bDescriptorSubtype: Header Func Desc */
+  0x10,   /* bcdCDC: spec release number */
+  0x01,
+
+  /*Union Functional Descriptor*/
+  0x05,   /* bFunctionLength */
+  0x24,   /* bDescriptorType: CS_INTERFACE */
+  0x06,   /* bDescriptorSubtype: Union func desc */
+  0x00,   /* bMasterInterface: Communication class interface */
+  0x01,   /* bSlaveInterface0: Data Class Interface */
+
+  /*Ethernet Networking Functional Descriptor*/
+  0x0D,   /* bFunctionLength */
+  0x24,   /* bDescriptorType: CS_INTERFACE */
+  0x0F,   /* bDescriptorSubtype: Ethernet Networking Func Desc */
+  USBD_CDC_NCM_MAC_STR_INDEX,  /* iMACAddress */
+  0x00,   /* bmEthernetStatistics: none */
+  0x00,
+  0x00,
+  0x00,
+  LOBYTE(USBD_CDC_NCM_MAX_SEGMENT),  /* wMaxSegmentSize */
+  HIBYTE(USBD_CDC_NCM_MAX_SEGMENT),
+  0x00,   /* wNumberMCFilters: none */
+  0x00,
+  0x00,   /* bNumberPowerFilters: none */
+
+  /*NCM Functional Descriptor*/
+  0x06,   /* bFunctionLength */
+  0x24,   /* bDescriptorType: CS_INTERFACE */
+  0x1A,   /* bDescriptorSubtype: NCM Func Desc */
+  0x00,   /* bcdNcmVersion: 1.0 */
+  0x01,
+  0x01,   /* bmNetworkCapabilities: SetEthernetPacketFilter */
+
+  /*Endpoint 2 Descriptor*/
+  0x07,                           /* bLength: Endpoint Descriptor size */
+  USB_DESC_TYPE_ENDPOINT,   /* bDescriptorType: Endpoint */
+  NCM_CMD_EP,                     /* bEndpointAddress */
+  0x03,                           /* bmAttributes: Interrupt */
+  LOBYTE(NCM_CMD_PACKET_SIZE),     /* wMaxPacketSize: */
+  HIBYTE(NCM_CMD_PACKET_SIZE),
+  NCM_HS_BINTERVAL,                           /* bInterval: */
+  /*---------------------------------------------------------------------------*/
+
+  /*Data class interface descriptor: no traffic in the default setting*/
+  0x09,   /* bLength: Endpoint Descriptor size */
+  USB_DESC_TYPE_INTERFACE,  /* bDescriptorType: */
+  0x01,   /* bInterfaceNumber: Number of Interface */
+  0x00,   /* bAlternateSetting: Alternate setting */
+  0x00,   /* bNumEndpoints: No endpoint */
+  0x0A,   /* bInterfaceClass: CDC */
+  0x00,   /* bInterfaceSubClass: */
+  0x01,   /* bInterfaceProtocol: Network Transfer Block */
+  0x00,   /* iInterface: */
+
+  /*Data class interface descriptor: operational setting*/
+  0x09,   /* bLength: Endpoint Descriptor size */
+  USB_DESC_TYPE_INTERFACE,  /* bDescriptorType: */
+  0x01,   /* bInterfaceNumber: Number of Interface */
+  0x01,   /* bAlternateSetting: Alternate setting */
+  0x02,   /* bNumEndpoints: Two endpoints used */
+  0x0A,   /* bInterfaceClass: CDC */
+  0x00,   /* bInterfaceSubClass: */
+  0x01,   /* bInterfaceProtocol: Network Transfer Block */
+  0x00,   /* iInterface: */
+
+  /*Endpoint OUT Descriptor*/
+  0x07,   /* bLength: Endpoint Descriptor size */
+  USB_DESC_TYPE_ENDPOINT,      /* bDescriptorType: Endpoint */
+  NCM_OUT_EP,                        /* bEndpointAddress */
+  0x02,                              /* bmAttributes: Bulk */
+  LOBYTE(NCM_DATA_HS_MAX_PACKET_SIZE),  /* wMaxPacketSize: */
+  HIBYTE(NCM_DATA_HS_MAX_PACKET_SIZE),
+  0x00,                              /* bInterval: ignore for Bulk transfer */
+
+  /*Endpoint IN Descriptor*/
+  0x07,   /* bLength: Endpoint Descriptor size */
+  USB_DESC_TYPE_ENDPOINT,      /* bDescriptorType: Endpoint */
+  NCM_IN_EP,                         /* bEndpointAddress */
+  0x02,                              /* bmAttributes: Bulk */
+  LOBYTE(NCM_DATA_HS_MAX_PACKET_SIZE),  /* wMaxPacketSize: */
+  HIBYTE(NCM_DATA_HS_MAX_PACKET_SIZE),
+  0x00                               /* bInterval: ignore for Bulk transfer */
+};
+
+
+/* USB CDC NCM device Configuration Descriptor */
+__ALIGN_BEGIN uint8_t USBD_CDC_NCM_CfgFSDesc[USB_CDC_NCM_CONFIG_DESC_SIZ] __ALIGN_END =
+{
+  /*Configuration Descriptor*/
+  0x09,   /* bLength: Configuration Descriptor size */
+  USB_DESC_TYPE_CONFIGURATION,      /* bDescriptorType: Configuration */
+  USB_CDC_NCM_CONFIG_DESC_SIZ,            /* wTotalLength:no of returned bytes */
+  0x00,
+  0x02,   /* bNumInterfaces: 2 interface */
+  0x01,   /* bConfigurationValue: Configuration value */
+  0x00,   /* iConfiguration: Index of string descriptor describing the configuration */
+  0xC0,   /* bmAttributes: self powered */
+  0x32,   /* MaxPower 100 mA */
+
+  /*---------------------------------------------------------------------------*/
+
+  /*Communication Interface Descriptor */
+  0x09,   /* bLength: Interface Descriptor size */
+  USB_DESC_TYPE_INTERFACE,  /* bDescriptorType: Interface */
+  0x00,   /* bInterfaceNumber: Number of Interface */
+  0x00,   /* bAlternateSetting: Alternate setting */
+  0x01,   /* bNumEndpoints: One endpoint used */
+  0x02,   /* bInterfaceClass: Communication Interface Class */
+  0x0D,   /* bInterfaceSubClass: Network Control Model */
+  0x00,   /* bInterfaceProtocol: No encapsulated command */
+  0x00,   /* iInterface: */
+
+  /*Header Functional Descriptor*/
+  0x05,   /* bLength: Endpoint Descriptor size */
+  0x24,   /* bDescriptorType: CS_INTERFACE */
+  0x00,   /* bDescriptorSubtype: Header Func Desc */
+  0x10,   /* bcdCDC: spec release number */
+  0x01,
+
+  /*Union Functional Descriptor*/
+  0x05,   /* bFunctionLength */
+  0x24,   /* bDescriptorType: CS_INTERFACE */
+  0x06,   /* bDescriptorSubtype: Union func desc */
+  0x00,   /* bMasterInterface: Communication class interface */
+  0x01,   /* bSlaveInterface0: Data Class Interface */
+
+  /*Ethernet Networking Functional Descriptor*/
+  0x0D,   /* bFunctionLength */
+  0x24,   /* bDescriptorType: CS_INTERFACE */
+  0x0F,   /* bDescriptorSubtype: Ethernet Networking Func Desc */
+  USBD_CDC_NCM_MAC_STR_INDEX,  /* iMACAddress */
+  0x00,   /* bmEthernetStatistics: none */
+  0x00,
+  0x00,
+  0x00,
+  LOBYTE(USBD_CDC_NCM_MAX_SEGMENT),  /* wMaxSegmentSize */
+  HIBYTE(USBD_CDC_NCM_MAX_SEGMENT),
+  0x00,   /* wNumberMCFilters: none */
+  0x00,
+  0x00,   /* bNumberPowerFilters: none */
+
+  /*NCM Functional Descriptor*/
+  0x06,   /* bFunctionLength */
+  0x24,   /* bDescriptorType: CS_INTERFACE */
+  0x1A,   /* bDescriptorSubtype: NCM Func Desc */
+  0x00,   /* bcdNcmVersion: 1.0 */
+  0x01,
+  0x01,   /* bmNetworkCapabilities: SetEthernetPacketFilter */
+
+  /*Endpoint 2 Descriptor*/
+  0x07,                           /* bLength: Endpoint Descriptor size */
+  USB_DESC_TYPE_ENDPOINT,   /* bDescriptorType: Endpoint */
+  NCM_CMD_EP,                     /* bEndpointAddress */
+  0x03,                           /* bmAttributes: Interrupt */
+  LOBYTE(NCM_CMD_PACKET_SIZE),     /* wMaxPacketSize: */
+  HIBYTE(NCM_CMD_PACKET_SIZE),
+  NCM_FS_BINTERVAL,                           /* bInterval: */
+  /*---------------------------------------------------------------------------*/
+
+  /*Data class interface descriptor: no traffic in the default setting*/
+  0x09,   /* bLength: Endpoint Descriptor size */
+  USB_DESC_TYPE_INTERFACE,  /* bDescriptorType: */
+  0x01,   /* bInterfaceNumber: Number of Interface */
+  0x00,   /* bAlternateSetting: Alternate setting */
+  0x00,   /* bNumEndpoints: No endpoint */
+  0x0A,   /* bInterfaceClass: CDC */
+  0x00,   /* bInterfaceSubClass: */
+  0x01,   /* bInterfaceProtocol: Network Transfer Block */
+  0x00,   /* iInterface: */
+
+  /*Data class interface descriptor: operational setting*/
+  0x09,   /* bLength: Endpoint Descriptor size */
+  USB_DESC_TYPE_INTERFACE,  /* bDescriptorType: */
+  0x01,   /* bInterfaceNumber: Number of Interface */
+  0x01,   /* bAlternateSetting: Alternate setting */
+  0x02,   /* bNumEndpoints: Two endpoints used */
+  0x0A,   /* bInterfaceClass: CDC */
+  0x00,   /* bInterfaceSubClass: */
+  0x01,   /* bInterfaceProtocol: Network Transfer Block */
+  0x00,   /* iInterface: */
+
+  /*Endpoint OUT Descriptor*/
+  0x07,   /* bLength: Endpoint Descriptor size */
+  USB_DESC_TYPE_ENDPOINT,      /* bDescriptorType: Endpoint */
+  NCM_OUT_EP,                        /* bEndpointAddress */
+  0x02,                              /* bmAttributes: Bulk */
+  LOBYTE(NCM_DATA_FS_MAX_PACKET_SIZE),  /* wMaxPacketSize: */
+  HIBYTE(NCM_DATA_FS_MAX_PACKET_SIZE),
+  0x00,                              /* bInterval: ignore for Bulk transfer */
+
+  /*Endpoint IN Descriptor*/
+  0x07,   /* bLength: Endpoint Descriptor size */
+  USB_DESC_TYPE_ENDPOINT,      /* bDescriptorType: Endpoint */
+  NCM_IN_EP,                         /* bEndpointAddress */
+  0x02,                              /* bmAttributes: Bulk */
+  LOBYTE(NCM_DATA_FS_MAX_PACKET_SIZE),  /* wMaxPacketSize: */
+  HIBYTE(NCM_DATA_FS_MAX_PACKET_SIZE),
+  0x00                               /* bInterval: ignore for Bulk transfer */
+};
+
+
+/* USB CDC NCM device Other Speed Configuration Descriptor */
+__ALIGN_BEGIN uint8_t USBD_CDC_NCM_OtherSpeedCfgDesc[USB_CDC_NCM_CONFIG_DESC_SIZ] __ALIGN_END =
+{
+  /*Configuration Descriptor*/
+  0x09,   /* bLength: Configuration Descriptor size */
+  USB_DESC_TYPE_OTHER_SPEED_CONFIGURATION,      /* bDescriptorType: Configuration */
+  USB_CDC_NCM_CONFIG_DESC_SIZ,            /* wTotalLength:no of returned bytes */
+  0x00,
+  0x02,   /* bNumInterfaces: 2 interface */
+  0x01,   /* bConfigurationValue: Configuration value */
+  0x00,   /* iConfiguration: Index of string descriptor describing the configuration */
+  0xC0,   /* bmAttributes: self powered */
+  0x32,   /* MaxPower 100 mA */
+
+  /*---------------------------------------------------------------------------*/
+
+  /*Communication Interface Descriptor */
+  0x09,   /* bLength: Interface Descriptor size */
+  USB_DESC_TYPE_INTERFACE,  /* bDescriptorType: Interface */
+  0x00,   /* bInterfaceNumber: Number of Interface */
+  0x00,   /* bAlternateSetting: Alternate setting */
+  0x01,   /* bNumEndpoints: One endpoint used */
+  0x02,   /* bInterfaceClass: Communication Interface Class */
+  0x0D,   /* bInterfaceSubClass: Network Control Model */
+  0x00,   /* bInterfaceProtocol: No encapsulated command */
+  0x00,   /* iInterface: */
+
+  /*Header Functional Descriptor*/
+  0x05,   /* bLength: Endpoint Descriptor size */
+  0x24,   /* bDescriptorType: CS_INTERFACE */
+  0x00,   /* bDescriptorSubtype: Header Func Desc */
+  0x10,   /* bcdCDC: spec release number */
+  0x01,
+
+  /*Union Functional Descriptor*/
+  0x05,   /* bFunctionLength */
+  0x24,   /* bDescriptorType: CS_INTERFACE */
+  0x06,   /* bDescriptorSubtype: Union func desc */
+  0x00,   /* bMasterInterface: Communication class interface */
+  0x01,   /* bSlaveInterface0: Data Class Interface */
+
+  /*Ethernet Networking Functional Descriptor*/
+  0x0D,   /* bFunctionLength */
+  0x24,   /* bDescriptorType: CS_INTERFACE */
+  0x0F,   /* bDescriptorSubtype: Ethernet Networking Func Desc */
+  USBD_CDC_NCM_MAC_STR_INDEX,  /* iMACAddress */
+  0x00,   /* bmEthernetStatistics: none */
+  0x00,
+  0x00,
+  0x00,
+  LOBYTE(USBD_CDC_NCM_MAX_SEGMENT),  /* wMaxSegmentSize */
+  HIBYTE(USBD_CDC_NCM_MAX_SEGMENT),
+  0x00,   /* wNumberMCFilters: none */
+  0x00,
+  0x00,   /* bNumberPowerFilters: none */
+
+  /*NCM Functional Descriptor*/
+  0x06,   /* bFunctionLength */
+  0x24,   /* bDescriptorType: CS_INTERFACE */
+  0x1A,   /* bDescriptorSubtype: NCM Func Desc */
+  0x00,   /* bcdNcmVersion: 1.0 */
+  0x01,
+  0x01,   /* bmNetworkCapabilities: SetEthernetPacketFilter */
+
+  /*Endpoint 2 Descriptor*/
+  0x07,                           /* bLength: Endpoint Descriptor size */
+  USB_DESC_TYPE_ENDPOINT,   /* bDescriptorType: Endpoint */
+  NCM_CMD_EP,                     /* bEndpointAddress */
+  0x03,                           /* bmAttributes: Interrupt */
+  LOBYTE(NCM_CMD_PACKET_SIZE),     /* wMaxPacketSize: */
+  HIBYTE(NCM_CMD_PACKET_SIZE),
+  NCM_FS_BINTERVAL,                           /* bInterval: */
+  /*---------------------------------------------------------------------------*/
+
+  /*Data class interface descriptor: no traffic in the default setting*/
+  0x09,   /* bLength: Endpoint Descriptor size */
+  USB_DESC_TYPE_INTERFACE,  /* bDescriptorType: */
+  0x01,   /* bInterfaceNumber: Number of Interface */
+  0x00,   /* bAlternateSetting: Alternate setting */
+  0x00,   /* bNumEndpoints: No endpoint */
+  0x0A,   /* bInterfaceClass: CDC */
+  0x00,   /* bInterfaceSubClass: */
+  0x01,   /* bInterfaceProtocol: Network Transfer Block */
+  0x00,   /* iInterface: */
+
+  /*Data class interface descriptor: operational setting*/
+  0x09,   /* bLength: Endpoint Descriptor size */
+  USB_DESC_TYPE_INTERFACE,  /* bDescriptorType: */
+  0x01,   /* bInterfaceNumber: Number of Interface */
+  0x01,   /* bAlternateSetting: Alternate setting */
+  0x02,   /* bNumEndpoints: Two endpoints used */
+  0x0A,   /* bInterfaceClass: CDC */
+  0x00,   /* bInterfaceSubClass: */
+  0x01,   /* bInterfaceProtocol: Network Transfer Block */
+  0x00,   /* iInterface: */
+
+  /*Endpoint OUT Descriptor*/
+  0x07,   /* bLength: Endpoint Descriptor size */
+  USB_DESC_TYPE_ENDPOINT,      /* bDescriptorType: Endpoint */
+  NCM_OUT_EP,                        /* bEndpointAddress */
+  0x02,                              /* bmAttributes: Bulk */
+  LOBYTE(NCM_DATA_FS_MAX_PACKET_SIZE),  /* wMaxPacketSize: */
+  HIBYTE(NCM_DATA_FS_MAX_PACKET_SIZE),
+  0x00,                              /* bInterval: ignore for Bulk transfer */
+
+  /*Endpoint IN Descriptor*/
+  0x07,   /* bLength: Endpoint Descriptor size */
+  USB_DESC_TYPE_ENDPOINT,      /* bDescriptorType: Endpoint */
+  NCM_IN_EP,                         /* bEndpointAddress */
+  0x02,                              /* bmAttributes: Bulk */
+  LOBYTE(NCM_DATA_FS_MAX_PACKET_SIZE),  /* wMaxPacketSize: */
+  HIBYTE(NCM_DATA_FS_MAX_PACKET_SIZE),
+  0x00                               /* bInterval: ignore for Bulk transfer */
+};
+
+/* MAC address of the host interface */
+static uint8_t USBD_CDC_NCM_MACAddress[6] = USBD_CDC_NCM_MAC_ADDRESS;
+
+#if (USBD_SUPPORT_USER_STRING == 1)
+/* iMACAddress string: 12 hexadecimal digits */
+__ALIGN_BEGIN static uint8_t USBD_CDC_NCM_MACStrDesc[2U + (12U * 2U)] __ALIGN_END;
+#endif
+
+/**
+  * @}
+  */
+
+/** @defgroup USBD_CDC_NCM_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  USBD_CDC_NCM_Init
+  *         Initialize the CDC NCM interface
+  * @note   The data endpoints are opened when the host selects the
+  *         operational setting of the data interface.
+  * @param  pdev: device instance
+  * @param  cfgidx: Configuration index
+  * @retval status
+  */
+static uint8_t  USBD_CDC_NCM_Init (USBD_HandleTypeDef *pdev, uint8_t cfgidx)
+{
+  uint8_t ret = 0U;
+  uint32_t i;
+  USBD_CDC_NCM_HandleTypeDef   *hncm;
+
+  /* Open Command IN EP */
+  USBD_LL_OpenEP(pdev, NCM_CMD_EP, USBD_EP_TYPE_INTR, NCM_CMD_PACKET_SIZE);
+
+  pdev->pClassData = USBD_malloc(sizeof (USBD_CDC_NCM_HandleTypeDef));
+
+  if(pdev->pClassData == NULL)
+  {
+    ret = 1U;
+  }
+  else
+  {
+    hncm = (USBD_CDC_NCM_HandleTypeDef*) pdev->pClassData;
+
+    hncm->CmdOpCode = 0xFFU;
+    hncm->DataAlt = 0U;
+    hncm->LinkUp = 1U;
+    hncm->BitRate = (pdev->dev_speed == USBD_SPEED_HIGH) ? 480000000U : 12000000U;
+    hncm->NtbInSize = USBD_CDC_NCM_NTB_IN_SIZE;
+    hncm->NotifyPending = 0U;
+    hncm->NotifyState = 0U;
+    hncm->TxState = 0U;
+    hncm->RxArmed = USBD_CDC_NCM_RX_NTB_NBR;
+    for(i = 0U; i < USBD_CDC_NCM_RX_NTB_NBR; i++)
+    {
+      hncm->RxRef[i] = 0U;
+    }
+    hncm->TxNtbs = 0U;
+    hncm->TxDatagrams = 0U;
+    hncm->RxNtbs = 0U;
+    hncm->RxDatagrams = 0U;
+    hncm->RxDropped = 0U;
+    hncm->RxErrors = 0U;
+
+    /* Init  physical Interface components */
+    ((USBD_CDC_NCM_ItfTypeDef *)pdev->pUserData)->Init();
+  }
+  return ret;
+}
+
+/**
+  * @brief  USBD_CDC_NCM_DeInit
+  *         DeInitialize the CDC NCM layer
+  * @param  pdev: device instance
+  * @param  cfgidx: Configuration index
+  * @retval status
+  */
+static uint8_t  USBD_CDC_NCM_DeInit (USBD_HandleTypeDef *pdev, uint8_t cfgidx)
+{
+  uint8_t ret = 0U;
+
+  /* Close the data endpoints */
+  if(pdev->pClassData != NULL)
+  {
+    USBD_CDC_NCM_SetAlt(pdev, 0U);
+  }
+
+  /* Close Command IN EP */
+  USBD_LL_CloseEP(pdev, NCM_CMD_EP);
+
+  /* DeInit  physical Interface components: the datagrams still held by the
+     application are lost with the class data */
+  if(pdev->pClassData != NULL)
+  {
+    ((USBD_CDC_NCM_ItfTypeDef *)pdev->pUserData)->DeInit();
+    USBD_free(pdev->pClassData);
+    pdev->pClassData = NULL;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  USBD_CDC_NCM_Setup
+  *         Handle the CDC NCM specific requests
+  * @param  pdev: instance
+  * @param  req: usb requests
+  * @retval status
+  */
+static uint8_t  USBD_CDC_NCM_Setup (USBD_HandleTypeDef *pdev,
+                                    USBD_SetupReqTypedef *req)
+{
+  USBD_CDC_NCM_HandleTypeDef   *hncm = (USBD_CDC_NCM_HandleTypeDef*) pdev->pClassData;
+  uint8_t *pbuf = (uint8_t *)(void *)hncm->data;
+  uint8_t ifalt = 0U;
+  uint16_t status_info = 0U;
+  uint8_t ret = USBD_OK;
+
+  switch (req->bmRequest & USB_REQ_TYPE_MASK)
+  {
+  case USB_REQ_TYPE_CLASS :
+    switch (req->bRequest)
+    {
+    case NCM_GET_NTB_PARAMETERS:
+      USBD_CDC_NCM_Put16(&pbuf[0], NCM_NTB_PARAMETERS_SIZE);    /* wLength */
+      USBD_CDC_NCM_Put16(&pbuf[2], 0x0001U);                    /* bmNtbFormatsSupported: NTB16 */
+      USBD_CDC_NCM_Put32(&pbuf[4], USBD_CDC_NCM_NTB_IN_SIZE);   /* dwNtbInMaxSize */
+      USBD_CDC_NCM_Put16(&pbuf[8], NCM_ALIGNMENT);              /* wNdpInDivisor */
+      USBD_CDC_NCM_Put16(&pbuf[10], 0U);                        /* wNdpInPayloadRemainder */
+      USBD_CDC_NCM_Put16(&pbuf[12], NCM_ALIGNMENT);             /* wNdpInAlignment */
+      USBD_CDC_NCM_Put16(&pbuf[14], 0U);                        /* wReserved */
+      USBD_CDC_NCM_Put32(&pbuf[16], USBD_CDC_NCM_NTB_OUT_SIZE); /* dwNtbOutMaxSize */
+      USBD_CDC_NCM_Put16(&pbuf[20], NCM_ALIGNMENT);             /* wNdpOutDivisor */
+      USBD_CDC_NCM_Put16(&pbuf[22], 0U);                        /* wNdpOutPayloadRemainder */
+      USBD_CDC_NCM_Put16(&pbuf[24], NCM_ALIGNMENT);             /* wNdpOutAlignment */
+      USBD_CDC_NCM_Put16(&pbuf[26], 0U);                        /* wNtbOutMaxDatagrams: no limit */
+      USBD_CtlSendData (pdev, pbuf, MIN(req->wLength, NCM_NTB_PARAMETERS_SIZE));
+      break;
+
+    case NCM_GET_NTB_INPUT_SIZE:
+      USBD_CDC_NCM_Put32(pbuf, hncm->NtbInSize);
+      USBD_CtlSendData (pdev, pbuf, MIN(req->wLength, 4U));
+      break;
+
+    case NCM_GET_NTB_FORMAT:
+      USBD_CDC_NCM_Put16(pbuf, 0U);
+      USBD_CtlSendData (pdev, pbuf, MIN(req->wLength, 2U));
+      break;
+
+    case NCM_SET_NTB_FORMAT:
+      /* NTB16 only */
+      if (req->wValue != 0U)
+      {
+        USBD_CtlError (pdev, req);
+        ret = USBD_FAIL;
+      }
+      break;
+
+    default:
+      if (req->wLength > sizeof (hncm->data))
+      {
+        USBD_CtlError (pdev, req);
+        ret = USBD_FAIL;
+      }
+      else if (req->wLength)
+      {
+        if (req->bmRequest & 0x80U)
+        {
+          ((USBD_CDC_NCM_ItfTypeDef *)pdev->pUserData)->Control(req->bRequest, pbuf,
+                                                                req->wLength);
+
+          USBD_CtlSendData (pdev, pbuf, req->wLength);
+        }
+        else
+        {
+          /* SET_NTB_INPUT_SIZE is handled on EP0 Rx Ready */
+          hncm->CmdOpCode = req->bRequest;
+          hncm->CmdLength = (uint8_t)req->wLength;
+
+          USBD_CtlPrepareRx (pdev, pbuf, req->wLength);
+        }
+      }
+      else
+      {
+        ((USBD_CDC_NCM_ItfTypeDef *)pdev->pUserData)->Control(req->bRequest,
+                                                              (uint8_t *)(void *)req, 0U);
+      }
+      break;
+    }
+    break;
+
+  case USB_REQ_TYPE_STANDARD:
+    switch (req->bRequest)
+    {
+    case USB_REQ_GET_STATUS:
+      if (pdev->dev_state == USBD_STATE_CONFIGURED)
+      {
+        USBD_CtlSendData (pdev, (uint8_t *)(void *)&status_info, 2U);
+      }
+      else
+      {
+        USBD_CtlError (pdev, req);
+        ret = USBD_FAIL;
+      }
+      break;
+
+    case USB_REQ_GET_INTERFACE:
+      if (pdev->dev_state == USBD_STATE_CONFIGURED)
+      {
+        if (LOBYTE(req->wIndex) == NCM_DATA_ITF)
+        {
+          ifalt = hncm->DataAlt;
+        }
+        hncm->data[0] = ifalt;
+        USBD_CtlSendData (pdev, pbuf, 1U);
+      }
+      else
+      {
+        USBD_CtlError (pdev, req);
+        ret = USBD_FAIL;
+      }
+      break;
+
+    case USB_REQ_SET_INTERFACE:
+      if ((pdev->dev_state == USBD_STATE_CONFIGURED) && (LOBYTE(req->wIndex) == NCM_DATA_ITF) &&
+          (req->wValue <= 1U))
+      {
+        USBD_CDC_NCM_SetAlt(pdev, (uint8_t)req->wValue);
+      }
+      else if ((pdev->dev_state != USBD_STATE_CONFIGURED) || (req->wValue != 0U))
+      {
+        USBD_CtlError (pdev, req);
+        ret = USBD_FAIL;
+      }
+      break;
+
+    default:
+      USBD_CtlError (pdev, req);
+      ret = USBD_FAIL;
+      break;
+    }
+    break;
+
+  default:
+    USBD_CtlError (pdev, req);
+    ret = USBD_FAIL;
+    break;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  USBD_CDC_NCM_DataIn
+  *         Data sent on non-control IN endpoint
+  * @param  pdev: device instance
+  * @param  epnum: endpoint number
+  * @retval status
+  */
+static uint8_t  USBD_CDC_NCM_DataIn (USBD_HandleTypeDef *pdev, uint8_t epnum)
+{
+  USBD_CDC_NCM_HandleTypeDef *hncm = (USBD_CDC_NCM_HandleTypeDef*)pdev->pClassData;
+
+  if(pdev->pClassData != NULL)
+  {
+    if(epnum == (NCM_CMD_EP & 0x7FU))
+    {
+      hncm->NotifyState = 0U;
+      USBD_CDC_NCM_Notify(pdev);
+      return USBD_OK;
+    }
+
+    /* Release the NTB sent and send the next one: the datagrams queued in
+       the meantime leave as one NTB */
+    if(hncm->TxState != 0U)
+    {
+      hncm->TxTail++;
+      hncm->TxState = 0U;
+    }
+    USBD_CDC_NCM_Flush(pdev);
+
+    if(hncm->TxBlocked != 0U)
+    {
+      hncm->TxBlocked = 0U;
+      if(((USBD_CDC_NCM_ItfTypeDef *)pdev->pUserData)->TxReady != NULL)
+      {
+        ((USBD_CDC_NCM_ItfTypeDef *)pdev->pUserData)->TxReady();
+      }
+    }
+    return USBD_OK;
+  }
+  else
+  {
+    return USBD_FAIL;
+  }
+}
+
+/**
+  * @brief  USBD_CDC_NCM_DataOut
+  *         Data received on non-control Out endpoint
+  * @param  pdev: device instance
+  * @param  epnum: endpoint number
+  * @retval status
+  */
+static uint8_t  USBD_CDC_NCM_DataOut (USBD_HandleTypeDef *pdev, uint8_t epnum)
+{
+  USBD_CDC_NCM_HandleTypeDef   *hncm = (USBD_CDC_NCM_HandleTypeDef*) pdev->pClassData;
+  uint32_t ntb;
+
+  if(pdev->pClassData != NULL)
+  {
+    ntb = hncm->RxArmed;
+    hncm->RxArmed = USBD_CDC_NCM_RX_NTB_NBR;
+
+    if(ntb < USBD_CDC_NCM_RX_NTB_NBR)
+    {
+      /* The NTB kept the reference taken when it was armed while it is parsed */
+      USBD_CDC_NCM_Parse(pdev, ntb, USBD_LL_GetRxDataSize (pdev, epnum));
+      hncm->RxRef[ntb]--;
+    }
+
+    /* Receive the next NTB in a free buffer, the host is NAKed otherwise
+       until the application releases the datagrams of one */
+    USBD_CDC_NCM_Arm(pdev);
+
+    return USBD_OK;
+  }
+  else
+  {
+    return USBD_FAIL;
+  }
+}
+
+/**
+  * @brief  USBD_CDC_NCM_EP0_RxReady
+  *         Handle EP0 Rx Ready event
+  * @param  pdev: device instance
+  * @retval status
+  */
+static uint8_t  USBD_CDC_NCM_EP0_RxReady (USBD_HandleTypeDef *pdev)
+{
+  USBD_CDC_NCM_HandleTypeDef   *hncm = (USBD_CDC_NCM_HandleTypeDef*) pdev->pClassData;
+  uint32_t size;
+
+  if((pdev->pUserData != NULL) && (hncm->CmdOpCode != 0xFFU))
+  {
+    if((hncm->CmdOpCode == NCM_SET_NTB_INPUT_SIZE) && (hncm->CmdLength >= 4U))
+    {
+      /* Largest NTB the host accepts, the NTBs being filled keep their size */
+      size = USBD_CDC_NCM_Get32((uint8_t *)(void *)hncm->data);
+      if((size >= NCM_NTB_MIN_IN_SIZE) && (size <= USBD_CDC_NCM_NTB_IN_SIZE))
+      {
+        hncm->NtbInSize = size;
+      }
+    }
+    else
+    {
+      ((USBD_CDC_NCM_ItfTypeDef *)pdev->pUserData)->Control(hncm->CmdOpCode,
+                                                            (uint8_t *)(void *)hncm->data,
+                                                            (uint16_t)hncm->CmdLength);
+    }
+    hncm->CmdOpCode = 0xFFU;
+  }
+  return USBD_OK;
+}
+
+/**
+  * @brief  USBD_CDC_NCM_GetFSCfgDesc
+  *         Return configuration descriptor
+  * @param  speed : current device speed
+  * @param  length : pointer data length
+  * @retval pointer to descriptor buffer
+  */
+static uint8_t  *USBD_CDC_NCM_GetFSCfgDesc (uint16_t *length)
+{
+  *length = sizeof (USBD_CDC_NCM_CfgFSDesc);
+  return USBD_CDC_NCM_CfgFSDesc;
+}
+
+/**
+  * @brief  USBD_CDC_NCM_GetHSCfgDesc
+  *         Return configuration descriptor
+  * @param  speed : current device speed
+  * @param  length : pointer data length
+  * @retval pointer to descriptor buffer
+  */
+static uint8_t  *USBD_CDC_NCM_GetHSCfgDesc (uint16_t *length)
+{
+  *length = sizeof (USBD_CDC_NCM_CfgHSDesc);
+  return USBD_CDC_NCM_CfgHSDesc;
+}
+
+/**
+  * @brief  USBD_CDC_NCM_GetOtherSpeedCfgDesc
+  *         Return configuration descriptor
+  * @param  speed : current device speed
+  * @param  length : pointer data length
+  * @retval pointer to descriptor buffer
+  */
+static uint8_t  *USBD_CDC_NCM_GetOtherSpeedCfgDesc (uint16_t *length)
+{
+  *length = sizeof (USBD_CDC_NCM_OtherSpeedCfgDesc);
+  return USBD_CDC_NCM_OtherSpeedCfgDesc;
+}
+
+/**
+* @brief  DeviceQualifierDescriptor
+*         return Device Qualifier descriptor
+* @param  length : pointer data length
+* @retval pointer to descriptor buffer
+*/
+uint8_t  *USBD_CDC_NCM_GetDeviceQualifierDescriptor (uint16_t *length)
+{
+  *length = sizeof (USBD_CDC_NCM_DeviceQualifierDesc);
+  return USBD_CDC_NCM_DeviceQualifierDesc;
+}
+
+#if (USBD_SUPPORT_USER_STRING == 1)
+/**
+  * @brief  USBD_CDC_NCM_GetUsrStrDescriptor
+  *         Return the iMACAddress string descriptor
+  * @param  pdev: device instance
+  * @param  index : string index
+  * @param  length : pointer data length
+  * @retval pointer to descriptor buffer, NULL for other strings
+  */
+static uint8_t  *USBD_CDC_NCM_GetUsrStrDescriptor (USBD_HandleTypeDef *pdev,
+                                                   uint8_t index, uint16_t *length)
+{
+  static const char hex[] = "0123456789ABCDEF";
+  uint32_t i;
+
+  if(index != USBD_CDC_NCM_MAC_STR_INDEX)
+  {
+    *length = 0U;
+    return NULL;
+  }
+
+  USBD_CDC_NCM_MACStrDesc[0] = (uint8_t)sizeof (USBD_CDC_NCM_MACStrDesc);
+  USBD_CDC_NCM_MACStrDesc[1] = USB_DESC_TYPE_STRING;
+  for(i = 0U; i < 6U; i++)
+  {
+    USBD_CDC_NCM_MACStrDesc[2U + (4U * i)] = (uint8_t)hex[USBD_CDC_NCM_MACAddress[i] >> 4];
+    USBD_CDC_NCM_MACStrDesc[3U + (4U * i)] = 0U;
+    USBD_CDC_NCM_MACStrDesc[4U + (4U * i)] = (uint8_t)hex[USBD_CDC_NCM_MACAddress[i] & 0xFU];
+    USBD_CDC_NCM_MACStrDesc[5U + (4U * i)] = 0U;
+  }
+
+  *length = sizeof (USBD_CDC_NCM_MACStrDesc);
+  return USBD_CDC_NCM_MACStrDesc;
+}
+#endif
+
+/**
+  * @brief  USBD_CDC_NCM_SetAlt
+  *         Select the setting of the data interface: the data endpoints are
+  *         opened in the operational setting only
+  * @param  pdev: device instance
+  * @param  alt: alternate setting
+  * @retval None
+  */
+static void  USBD_CDC_NCM_SetAlt (USBD_HandleTypeDef *pdev, uint8_t alt)
+{
+  USBD_CDC_NCM_HandleTypeDef   *hncm = (USBD_CDC_NCM_HandleTypeDef*) pdev->pClassData;
+  uint16_t mps = NCM_DATA_MAX_PACKET_SIZE(pdev);
+
+  if(hncm->DataAlt != 0U)
+  {
+    /* Close EP IN */
+    USBD_LL_CloseEP(pdev, NCM_IN_EP);
+
+    /* Close EP OUT */
+    USBD_LL_CloseEP(pdev, NCM_OUT_EP);
+
+    /* The NTB receiving is released, the ones held by the application stay
+       so until USBD_CDC_NCM_ReleaseRx() */
+    if(hncm->RxArmed < USBD_CDC_NCM_RX_NTB_NBR)
+    {
+      hncm->RxRef[hncm->RxArmed]--;
+      hncm->RxArmed = USBD_CDC_NCM_RX_NTB_NBR;
+    }
+  }
+
+  hncm->DataAlt = alt;
+
+  /* The datagrams not sent are dropped */
+  hncm->TxHead = 0U;
+  hncm->TxTail = 0U;
+  hncm->TxLength = NCM_NTH16_SIZE;
+  hncm->TxCount = 0U;
+  hncm->TxReserved = 0U;
+  hncm->TxSequence = 0U;
+  hncm->TxState = 0U;
+  hncm->TxBlocked = 0U;
+
+  if(alt != 0U)
+  {
+    /* Open EP IN */
+    USBD_LL_OpenEP(pdev, NCM_IN_EP, USBD_EP_TYPE_BULK, mps);
+
+    /* Open EP OUT */
+    USBD_LL_OpenEP(pdev, NCM_OUT_EP, USBD_EP_TYPE_BULK, mps);
+
+    USBD_CDC_NCM_Arm(pdev);
+
+    /* The host expects the link state each time the setting is selected */
+    hncm->NotifyPending = NCM_NOTIFY_SPEED | NCM_NOTIFY_CONNECTION;
+    USBD_CDC_NCM_Notify(pdev);
+  }
+}
+
+/**
+  * @brief  USBD_CDC_NCM_Notify
+  *         Send the next pending notification on the interrupt endpoint
+  * @param  pdev: device instance
+  * @retval None
+  */
+static void  USBD_CDC_NCM_Notify (USBD_HandleTypeDef *pdev)
+{
+  USBD_CDC_NCM_HandleTypeDef   *hncm = (USBD_CDC_NCM_HandleTypeDef*) pdev->pClassData;
+  uint8_t *pbuf = (uint8_t *)(void *)hncm->Notify;
+
+  if((hncm->NotifyState != 0U) || (hncm->DataAlt == 0U) || (hncm->NotifyPending == 0U))
+  {
+    return;
+  }
+
+  pbuf[0] = 0xA1U;                                      /* bmRequestType */
+  USBD_CDC_NCM_Put16(&pbuf[4], NCM_COMM_ITF);           /* wIndex */
+  hncm->NotifyState = 1U;
+
+  if((hncm->NotifyPending & NCM_NOTIFY_SPEED) != 0U)
+  {
+    /* Speed first, as some hosts ignore it once connected */
+    hncm->NotifyPending &= ~NCM_NOTIFY_SPEED;
+    pbuf[1] = NCM_CONNECTION_SPEED_CHANGE;
+    USBD_CDC_NCM_Put16(&pbuf[2], 0U);
+    USBD_CDC_NCM_Put16(&pbuf[6], 8U);
+    USBD_CDC_NCM_Put32(&pbuf[8], hncm->BitRate);        /* DLBitRate */
+    USBD_CDC_NCM_Put32(&pbuf[12], hncm->BitRate);       /* ULBitRate */
+    USBD_LL_Transmit(pdev, NCM_CMD_EP, pbuf, 16U);
+  }
+  else
+  {
+    hncm->NotifyPending &= ~NCM_NOTIFY_CONNECTION;
+    pbuf[1] = NCM_NETWORK_CONNECTION;
+    USBD_CDC_NCM_Put16(&pbuf[2], hncm->LinkUp);
+    USBD_CDC_NCM_Put16(&pbuf[6], 0U);
+    USBD_LL_Transmit(pdev, NCM_CMD_EP, pbuf, 8U);
+  }
+}
+
+/**
+  * @brief  USBD_CDC_NCM_CloseNtb
+  *         Write the header and the datagram pointer table of the NTB being
+  *         filled and queue it
+  * @param  pdev: device instance
+  * @retval None
+  */
+static void  USBD_CDC_NCM_CloseNtb (USBD_HandleTypeDef *pdev)
+{
+  USBD_CDC_NCM_HandleTypeDef   *hncm = (USBD_CDC_NCM_HandleTypeDef*) pdev->pClassData;
+  uint32_t ntb = hncm->TxHead % USBD_CDC_NCM_TX_NTB_NBR;
+  uint8_t *pbuf = (uint8_t *)(void *)hncm->TxNtb[ntb];
+  uint32_t ndp = NCM_ALIGN(hncm->TxLength);
+  uint32_t length = ndp + NCM_NDP16_SIZE(hncm->TxCount);
+  uint32_t i;
+
+  /* NDP16 after the datagrams, ended by a null entry */
+  USBD_CDC_NCM_Put32(&pbuf[ndp], NCM_NDP16_SIGNATURE);
+  USBD_CDC_NCM_Put16(&pbuf[ndp + 4U], NCM_NDP16_SIZE(hncm->TxCount));
+  USBD_CDC_NCM_Put16(&pbuf[ndp + 6U], 0U);
+  for(i = 0U; i <= hncm->TxCount; i++)
+  {
+    USBD_CDC_NCM_Put16(&pbuf[ndp + 8U + (4U * i)], (i < hncm->TxCount) ? hncm->TxDatagram[i][0] : 0U);
+    USBD_CDC_NCM_Put16(&pbuf[ndp + 10U + (4U * i)], (i < hncm->TxCount) ? hncm->TxDatagram[i][1] : 0U);
+  }
+
+  /* A short NTB ending on a packet boundary is padded by one byte rather
+     than followed by a ZLP */
+  if(((length % NCM_DATA_MAX_PACKET_SIZE(pdev)) == 0U) && (length < hncm->NtbInSize))
+  {
+    pbuf[length] = 0U;
+    length++;
+  }
+
+  USBD_CDC_NCM_Put32(&pbuf[0], NCM_NTH16_SIGNATURE);
+  USBD_CDC_NCM_Put16(&pbuf[4], NCM_NTH16_SIZE);
+  USBD_CDC_NCM_Put16(&pbuf[6], hncm->TxSequence);
+  USBD_CDC_NCM_Put16(&pbuf[8], length);
+  USBD_CDC_NCM_Put16(&pbuf[10], ndp);
+
+  hncm->TxSequence++;
+  hncm->TxNtbLength[ntb] = length;
+  hncm->TxDatagrams += hncm->TxCount;
+  hncm->TxLength = NCM_NTH16_SIZE;
+  hncm->TxCount = 0U;
+  hncm->TxHead++;
+}
+
+/**
+  * @brief  USBD_CDC_NCM_Flush
+  *         Send the oldest NTB queued when the IN endpoint is idle, after
+  *         closing the NTB being filled if none is queued
+  * @param  pdev: device instance
+  * @retval None
+  */
+static void  USBD_CDC_NCM_Flush (USBD_HandleTypeDef *pdev)
+{
+  USBD_CDC_NCM_HandleTypeDef   *hncm = (USBD_CDC_NCM_HandleTypeDef*) pdev->pClassData;
+  uint32_t ntb;
+
+  if((hncm->TxState != 0U) || (hncm->DataAlt == 0U))
+  {
+    return;
+  }
+
+  if(hncm->TxHead == hncm->TxTail)
+  {
+    /* Not while the application writes a datagram into it */
+    if((hncm->TxCount == 0U) || (hncm->TxReserved != 0U))
+    {
+      return;
+    }
+    USBD_CDC_NCM_CloseNtb(pdev);
+  }
+
+  ntb = hncm->TxTail % USBD_CDC_NCM_TX_NTB_NBR;
+  hncm->TxState = 1U;
+  hncm->TxNtbs++;
+  USBD_LL_Transmit(pdev, NCM_IN_EP, (uint8_t *)(void *)hncm->TxNtb[ntb],
+                   (uint16_t)hncm->TxNtbLength[ntb]);
+}
+
+/**
+  * @brief  USBD_CDC_NCM_Arm
+  *         Prepare the OUT endpoint to receive an NTB in a free buffer
+  * @param  pdev: device instance
+  * @retval None
+  */
+static void  USBD_CDC_NCM_Arm (USBD_HandleTypeDef *pdev)
+{
+  USBD_CDC_NCM_HandleTypeDef   *hncm = (USBD_CDC_NCM_HandleTypeDef*) pdev->pClassData;
+  uint32_t i;
+
+  if((hncm->DataAlt == 0U) || (hncm->RxArmed < USBD_CDC_NCM_RX_NTB_NBR))
+  {
+    return;
+  }
+
+  for(i = 0U; i < USBD_CDC_NCM_RX_NTB_NBR; i++)
+  {
+    if(hncm->RxRef[i] == 0U)
+    {
+      /* Held until parsed */
+      hncm->RxRef[i] = 1U;
+      hncm->RxArmed = i;
+      USBD_LL_PrepareReceive(pdev, NCM_OUT_EP, (uint8_t *)(void *)hncm->RxNtb[i],
+                             USBD_CDC_NCM_NTB_OUT_SIZE);
+      return;
+    }
+  }
+}
+
+/**
+  * @brief  USBD_CDC_NCM_Parse
+  *         Give the datagrams of an OUT NTB to the application, in place
+  * @param  pdev: device instance
+  * @param  ntb: NTB buffer
+  * @param  length: bytes received
+  * @retval None
+  */
+static void  USBD_CDC_NCM_Parse (USBD_HandleTypeDef *pdev, uint32_t ntb, uint32_t length)
+{
+  USBD_CDC_NCM_HandleTypeDef   *hncm = (USBD_CDC_NCM_HandleTypeDef*) pdev->pClassData;
+  uint8_t *pbuf = (uint8_t *)(void *)hncm->RxNtb[ntb];
+  uint32_t block;
+  uint32_t ndp;
+  uint32_t ndplen;
+  uint32_t entry;
+  uint32_t index;
+  uint32_t size;
+  uint32_t count;
+
+  hncm->RxNtbs++;
+
+  if((length < NCM_NTH16_SIZE) || (USBD_CDC_NCM_Get32(pbuf) != NCM_NTH16_SIGNATURE) ||
+     (USBD_CDC_NCM_Get16(&pbuf[4]) != NCM_NTH16_SIZE))
+  {
+    hncm->RxErrors++;
+    return;
+  }
+
+  /* A null block length: the NTB ends with the transfer */
+  block = USBD_CDC_NCM_Get16(&pbuf[8]);
+  if(block == 0U)
+  {
+    block = length;
+  }
+  if(block > length)
+  {
+    hncm->RxErrors++;
+    return;
+  }
+
+  ndp = USBD_CDC_NCM_Get16(&pbuf[10]);
+  for(count = 0U; (ndp != 0U) && (count < NCM_MAX_NDP); count++)
+  {
+    if((ndp < NCM_NTH16_SIZE) || ((ndp % NCM_ALIGNMENT) != 0U) || ((ndp + 8U) > block))
+    {
+      hncm->RxErrors++;
+      return;
+    }
+
+    ndplen = USBD_CDC_NCM_Get16(&pbuf[ndp + 4U]);
+    if((ndplen < NCM_NDP16_SIZE(1U)) || ((ndplen % 4U) != 0U) || ((ndp + ndplen) > block))
+    {
+      hncm->RxErrors++;
+      return;
+    }
+
+    /* NDPs with CRCs (NCM1) are not supported: skipped */
+    if(USBD_CDC_NCM_Get32(&pbuf[ndp]) != NCM_NDP16_SIGNATURE)
+    {
+      hncm->RxErrors++;
+    }
+    else
+    {
+      for(entry = ndp + 8U; (entry + 4U) <= (ndp + ndplen); entry += 4U)
+      {
+        index = USBD_CDC_NCM_Get16(&pbuf[entry]);
+        size = USBD_CDC_NCM_Get16(&pbuf[entry + 2U]);
+        if((index == 0U) || (size == 0U))
+        {
+          break;
+        }
+        if(((index + size) > block) || (size > USBD_CDC_NCM_MAX_SEGMENT))
+        {
+          hncm->RxErrors++;
+          continue;
+        }
+
+        /* Each datagram kept by the application holds the NTB */
+        hncm->RxRef[ntb]++;
+        hncm->RxDatagrams++;
+        if(((USBD_CDC_NCM_ItfTypeDef *)pdev->pUserData)->Receive(&pbuf[index], (uint16_t)size) != 0)
+        {
+          hncm->RxRef[ntb]--;
+          hncm->RxDropped++;
+        }
+      }
+    }
+
+    ndp = USBD_CDC_NCM_Get16(&pbuf[ndp + 6U]);
+  }
+}
+
+/**
+  * @brief  USBD_CDC_NCM_Get16
+  *         Read a little endian 16-bit field
+  * @param  pbuf: field
+  * @retval value
+  */
+static uint16_t  USBD_CDC_NCM_Get16 (const uint8_t *pbuf)
+{
+  return (uint16_t)((uint16_t)pbuf[0] | ((uint16_t)pbuf[1] << 8));
+}
+
+/**
+  * @brief  USBD_CDC_NCM_Get32
+  *         Read a little endian 32-bit field
+  * @param  pbuf: field
+  * @retval value
+  */
+static uint32_t  USBD_CDC_NCM_Get32 (const uint8_t *pbuf)
+{
+  return ((uint32_t)pbuf[0] | ((uint32_t)pbuf[1] << 8) |
+          ((uint32_t)pbuf[2] << 16) | ((uint32_t)pbuf[3] << 24));
+}
+
+/**
+  * @brief  USBD_CDC_NCM_Put16
+  *         Write a little endian 16-bit field
+  * @param  pbuf: field
+  * @param  value: value
+  * @retval None
+  */
+static void  USBD_CDC_NCM_Put16 (uint8_t *pbuf, uint32_t value)
+{
+  pbuf[0] = (uint8_t)value;
+  pbuf[1] = (uint8_t)(value >> 8);
+}
+
+/**
+  * @brief  USBD_CDC_NCM_Put32
+  *         Write a little endian 32-bit field
+  * @param  pbuf: field
+  * @param  value: value
+  * @retval None
+  */
+static void  USBD_CDC_NCM_Put32 (uint8_t *pbuf, uint32_t value)
+{
+  pbuf[0] = (uint8_t)value;
+  pbuf[1] = (uint8_t)(value >> 8);
+  pbuf[2] = (uint8_t)(value >> 16);
+  pbuf[3] = (uint8_t)(value >> 24);
+}
+
+/**
+* @brief  USBD_CDC_NCM_RegisterInterface
+  * @param  pdev: device instance
+  * @param  fops: CD  Interface callback
+  * @retval status
+  */
+uint8_t  USBD_CDC_NCM_RegisterInterface  (USBD_HandleTypeDef   *pdev,
+                                          USBD_CDC_NCM_ItfTypeDef *fops)
+{
+  uint8_t  ret = USBD_FAIL;
+
+  if(fops != NULL)
+  {
+    pdev->pUserData= fops;
+    ret = USBD_OK;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  USBD_CDC_NCM_SetMACAddress
+  *         Set the MAC address the host gives to its interface, before the
+  *         device is started
+  * @param  pdev: device instance
+  * @param  pMAC: 6 bytes, locally administered unless allocated to the product
+  * @retval status
+  */
+uint8_t  USBD_CDC_NCM_SetMACAddress (USBD_HandleTypeDef *pdev, const uint8_t *pMAC)
+{
+  (void)pdev;
+
+  if(pMAC == NULL)
+  {
+    return USBD_FAIL;
+  }
+
+  (void)USBD_memcpy(USBD_CDC_NCM_MACAddress, pMAC, sizeof (USBD_CDC_NCM_MACAddress));
+  return USBD_OK;
+}
+
+/**
+  * @brief  USBD_CDC_NCM_SetLink
+  *         Report the state of the network behind the device, ex. the
+  *         Ethernet link it bridges
+  * @param  pdev: device instance
+  * @param  LinkUp: 1 when connected
+  * @param  BitRate: link speed in bit/s
+  * @retval status
+  */
+uint8_t  USBD_CDC_NCM_SetLink (USBD_HandleTypeDef *pdev, uint8_t LinkUp, uint32_t BitRate)
+{
+  USBD_CDC_NCM_HandleTypeDef   *hncm = (USBD_CDC_NCM_HandleTypeDef*) pdev->pClassData;
+
+  if(hncm == NULL)
+  {
+    return USBD_FAIL;
+  }
+
+  hncm->LinkUp = (LinkUp != 0U) ? 1U : 0U;
+  hncm->BitRate = BitRate;
+  hncm->NotifyPending = NCM_NOTIFY_SPEED | NCM_NOTIFY_CONNECTION;
+  USBD_CDC_NCM_Notify(pdev);
+
+  return USBD_OK;
+}
+
+/**
+  * @brief  USBD_CDC_NCM_AllocTx
+  *         Reserve room for a datagram in the NTB being filled, the
+  *         application then writes it in place and calls
+  *         USBD_CDC_NCM_CommitTx()
+  * @param  pdev: device instance
+  * @param  Length: largest length of the datagram
+  * @retval Datagram buffer, 4-byte aligned, NULL when every NTB is in use
+  */
+uint8_t  *USBD_CDC_NCM_AllocTx (USBD_HandleTypeDef *pdev, uint16_t Length)
+{
+  USBD_CDC_NCM_HandleTypeDef   *hncm = (USBD_CDC_NCM_HandleTypeDef*) pdev->pClassData;
+  uint32_t offset;
+
+  if((hncm == NULL) || (hncm->DataAlt == 0U) || (Length == 0U) ||
+     (Length > USBD_CDC_NCM_MAX_SEGMENT))
+  {
+    return NULL;
+  }
+
+  /* Keeps the USB interrupt from closing the NTB */
+  hncm->TxReserved = 1U;
+
+  offset = NCM_ALIGN(hncm->TxLength);
+  if((hncm->TxCount == USBD_CDC_NCM_MAX_DATAGRAMS) ||
+     ((offset + Length + NCM_ALIGNMENT + NCM_NDP16_SIZE(hncm->TxCount + 1U)) > hncm->NtbInSize))
+  {
+    /* Full: the datagram starts the next NTB */
+    if((hncm->TxHead - hncm->TxTail) < (USBD_CDC_NCM_TX_NTB_NBR - 1U))
+    {
+      USBD_CDC_NCM_CloseNtb(pdev);
+      offset = NCM_ALIGN(hncm->TxLength);
+    }
+    else
+    {
+      offset = hncm->NtbInSize;
+    }
+  }
+
+  if(offset >= hncm->NtbInSize)
+  {
+    hncm->TxReserved = 0U;
+    hncm->TxBlocked = 1U;
+    USBD_CDC_NCM_Flush(pdev);
+    return NULL;
+  }
+
+  hncm->TxOffset = offset;
+  return (uint8_t *)(void *)hncm->TxNtb[hncm->TxHead % USBD_CDC_NCM_TX_NTB_NBR] + offset;
+}
+
+/**
+  * @brief  USBD_CDC_NCM_CommitTx
+  *         Add the datagram written after USBD_CDC_NCM_AllocTx() to the NTB;
+  *         the NTB is sent at once if the IN endpoint is idle, datagrams
+  *         otherwise accumulate until the current transfer completes
+  * @param  pdev: device instance
+  * @param  Length: length of the datagram, up to the length reserved
+  * @retval status
+  */
+uint8_t  USBD_CDC_NCM_CommitTx (USBD_HandleTypeDef *pdev, uint16_t Length)
+{
+  USBD_CDC_NCM_HandleTypeDef   *hncm = (USBD_CDC_NCM_HandleTypeDef*) pdev->pClassData;
+
+  if((hncm == NULL) || (hncm->TxReserved == 0U))
+  {
+    return USBD_FAIL;
+  }
+
+  if(Length != 0U)
+  {
+    hncm->TxDatagram[hncm->TxCount][0] = (uint16_t)hncm->TxOffset;
+    hncm->TxDatagram[hncm->TxCount][1] = Length;
+    hncm->TxCount++;
+    hncm->TxLength = hncm->TxOffset + Length;
+  }
+  hncm->TxReserved = 0U;
+
+  USBD_CDC_NCM_Flush(pdev);
+
+  return USBD_OK;
+}
+
+/**
+  * @brief  USBD_CDC_NCM_Transmit
+  *         Copy a datagram into the NTB being filled
+  * @param  pdev: device instance
+  * @param  pDatagram: Ethernet frame, without FCS
+  * @param  Length: length of the frame
+  * @retval status: USBD_BUSY when every NTB is in use
+  */
+uint8_t  USBD_CDC_NCM_Transmit (USBD_HandleTypeDef *pdev,
+                                const uint8_t *pDatagram, uint16_t Length)
+{
+  uint8_t *pbuf = USBD_CDC_NCM_AllocTx(pdev, Length);
+
+  if(pbuf == NULL)
+  {
+    return ((pdev->pClassData == NULL) || (Length == 0U) || (Length > USBD_CDC_NCM_MAX_SEGMENT)) ?
+           USBD_FAIL : USBD_BUSY;
+  }
+
+  (void)USBD_memcpy(pbuf, pDatagram, Length);
+  return USBD_CDC_NCM_CommitTx(pdev, Length);
+}
+
+/**
+  * @brief  USBD_CDC_NCM_ReleaseRx
+  *         Give back a datagram received by the interface Receive() callback
+  * @param  pdev: device instance
+  * @param  pDatagram: datagram
+  * @retval status
+  */
+uint8_t  USBD_CDC_NCM_ReleaseRx (USBD_HandleTypeDef *pdev, const uint8_t *pDatagram)
+{
+  USBD_CDC_NCM_HandleTypeDef   *hncm = (USBD_CDC_NCM_HandleTypeDef*) pdev->pClassData;
+  uint32_t i;
+
+  if(hncm == NULL)
+  {
+    return USBD_FAIL;
+  }
+
+  for(i = 0U; i < USBD_CDC_NCM_RX_NTB_NBR; i++)
+  {
+    if((pDatagram >= (const uint8_t *)(void *)hncm->RxNtb[i]) &&
+       (pDatagram < ((const uint8_t *)(void *)hncm->RxNtb[i] + USBD_CDC_NCM_NTB_OUT_SIZE)) &&
+       (hncm->RxRef[i] != 0U))
+    {
+      hncm->RxRef[i]--;
+
+      /* Reception resumes in the NTB freed */
+      USBD_CDC_NCM_Arm(pdev);
+      return USBD_OK;
+    }
+  }
+
+  return USBD_FAIL;
+}
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
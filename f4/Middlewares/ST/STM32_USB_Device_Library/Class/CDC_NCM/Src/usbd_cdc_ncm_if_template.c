@@ -0,0 +1,193 @@
+/**
+  ******************************************************************************
+  * @file    usbd_cdc_ncm_if_template.c
+  * @author  MCD Application Team
+  * @brief   Generic media access Layer.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT 2015 STMicroelectronics</center></h2>
+  *
+  * Licensed under MCD-ST Liberty SW License Agreement V2, (the "License");
+  * You may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at:
+  *
+  *        http://www.st.com/software_license_agreement_liberty_v2
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+  /* BSPDependencies
+  - "stm32xxxxx_{eval}{discovery}{nucleo_144}.c"
+  - "stm32xxxxx_{eval}{discovery}_io.c"
+  EndBSPDependencies */
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbd_cdc_ncm_if_template.h"
+
+/** @addtogroup STM32_USB_DEVICE_LIBRARY
+  * @{
+  */
+
+
+/** @defgroup USBD_CDC_NCM
+  * @brief usbd core module
+  * @{
+  */
+
+/** @defgroup USBD_CDC_NCM_Private_TypesDefinitions
+  * @{
+  */
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_CDC_NCM_Private_Defines
+  * @{
+  */
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_CDC_NCM_Private_Macros
+  * @{
+  */
+
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_CDC_NCM_Private_FunctionPrototypes
+  * @{
+  */
+
+static int8_t TEMPLATE_Init     (void);
+static int8_t TEMPLATE_DeInit   (void);
+static int8_t TEMPLATE_Control  (uint8_t cmd, uint8_t* pbuf, uint16_t length);
+static int8_t TEMPLATE_Receive  (uint8_t* pDatagram, uint16_t Length);
+static int8_t TEMPLATE_TxReady  (void);
+
+USBD_CDC_NCM_ItfTypeDef USBD_CDC_NCM_Template_fops =
+{
+  TEMPLATE_Init,
+  TEMPLATE_DeInit,
+  TEMPLATE_Control,
+  TEMPLATE_Receive,
+  TEMPLATE_TxReady
+};
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  TEMPLATE_Init
+  *         Initializes the CDC NCM media low layer
+  * @param  None
+  * @retval Result of the operation: USBD_OK if all operations are OK else USBD_FAIL
+  */
+static int8_t TEMPLATE_Init(void)
+{
+  /*
+     Add your initialization code here
+  */
+  return (0);
+}
+
+/**
+  * @brief  TEMPLATE_DeInit
+  *         DeInitializes the CDC NCM media low layer
+  * @param  None
+  * @retval Result of the operation: USBD_OK if all operations are OK else USBD_FAIL
+  */
+static int8_t TEMPLATE_DeInit(void)
+{
+  /*
+     Add your deinitialization code here
+  */
+  return (0);
+}
+
+
+/**
+  * @brief  TEMPLATE_Control
+  *         Manage the CDC NCM class requests not handled by the class
+  * @param  Cmd: Command code
+  * @param  Buf: Buffer containing command data (request parameters)
+  * @param  Len: Number of data to be sent (in bytes)
+  * @retval Result of the operation: USBD_OK if all operations are OK else USBD_FAIL
+  */
+static int8_t TEMPLATE_Control  (uint8_t cmd, uint8_t* pbuf, uint16_t length)
+{
+  switch (cmd)
+  {
+  case NCM_SET_ETHERNET_PACKET_FILTER:
+    /* wValue of the request: promiscuous, all multicast, directed, broadcast
+       and multicast bits; pbuf points to the request itself */
+    /* Add your code here */
+    break;
+
+  default:
+    break;
+  }
+
+  return (0);
+}
+
+/**
+  * @brief  TEMPLATE_Receive
+  *         Datagrams received in the OUT NTBs are given one by one, in place,
+  *         through this function.
+  *
+  *         @note
+  *         Returning 0 keeps the datagram in its NTB until it is given back
+  *         with USBD_CDC_NCM_ReleaseRx(): it can be queued for transmission
+  *         without copy, ex. with HAL_ETH_TransmitFrameChain(), and released
+  *         from HAL_ETH_TxFrameCpltCallback(). Any other value gives the
+  *         datagram back at once. Reception pauses while every NTB holds
+  *         datagrams; ReleaseRx() must not preempt the USB interrupt.
+  *
+  * @param  pDatagram: Ethernet frame, without FCS
+  * @param  Length: Length of the frame (in bytes)
+  * @retval 0 when the datagram is kept
+  */
+static int8_t TEMPLATE_Receive (uint8_t* pDatagram, uint16_t Length)
+{
+
+  return (1);
+}
+
+/**
+  * @brief  TEMPLATE_TxReady
+  *         An IN NTB was sent after USBD_CDC_NCM_Transmit() or
+  *         USBD_CDC_NCM_AllocTx() found every NTB in use: datagrams can be
+  *         queued again.
+  * @param  None
+  * @retval Result of the operation: USBD_OK if all operations are OK else USBD_FAIL
+  */
+static int8_t TEMPLATE_TxReady (void)
+{
+
+  return (0);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -50,10 +50,55 @@
   * @{
   */ 
 #define CUSTOM_HID_EPIN_ADDR                 0x81
-#define CUSTOM_HID_EPIN_SIZE                 0x02
+#ifndef CUSTOM_HID_EPIN_SIZE
+  #define CUSTOM_HID_EPIN_SIZE               0x02
+#endif /* CUSTOM_HID_EPIN_SIZE */
 
 #define CUSTOM_HID_EPOUT_ADDR                0x01
-#define CUSTOM_HID_EPOUT_SIZE                0x02
+#ifndef CUSTOM_HID_EPOUT_SIZE
+  #define CUSTOM_HID_EPOUT_SIZE              0x02
+#endif /* CUSTOM_HID_EPOUT_SIZE */
+
+/* Full speed interrupt endpoints are limited to 64 bytes, larger reports
+   take several packets */
+#define CUSTOM_HID_FS_EPIN_SIZE              ((CUSTOM_HID_EPIN_SIZE > 64) ? 64 : CUSTOM_HID_EPIN_SIZE)
+#define CUSTOM_HID_FS_EPOUT_SIZE             ((CUSTOM_HID_EPOUT_SIZE > 64) ? 64 : CUSTOM_HID_EPOUT_SIZE)
+
+/* High speed polling interval: 2^(bInterval - 1) microframes of 125 us,
+   1 polls at 8 kHz */
+#ifndef CUSTOM_HID_HS_BINTERVAL
+  #define CUSTOM_HID_HS_BINTERVAL            0x08
+#endif /* CUSTOM_HID_HS_BINTERVAL */
+
+/* Full speed polling interval, in frames of 1 ms */
+#ifndef CUSTOM_HID_FS_BINTERVAL
+  #define CUSTOM_HID_FS_BINTERVAL            0x20
+#endif /* CUSTOM_HID_FS_BINTERVAL */
+
+/* Largest report given to USBD_CUSTOM_HID_SendReport() */
+#ifndef CUSTOM_HID_IN_REPORT_SIZE
+  #define CUSTOM_HID_IN_REPORT_SIZE          CUSTOM_HID_EPIN_SIZE
+#endif /* CUSTOM_HID_IN_REPORT_SIZE */
+
+/* IN reports queued while one is being sent, the next one is sent from the
+   transfer complete interrupt so that the endpoint is not NAKed while data
+   is pending. 0: a report given while one is being sent is not sent */
+#ifndef CUSTOM_HID_IN_QUEUE_DEPTH
+  #define CUSTOM_HID_IN_QUEUE_DEPTH          0
+#endif /* CUSTOM_HID_IN_QUEUE_DEPTH */
+
+#if (CUSTOM_HID_EPIN_SIZE > 1024) || (CUSTOM_HID_EPOUT_SIZE > 1024)
+  #error "CUSTOM_HID_EPIN_SIZE and CUSTOM_HID_EPOUT_SIZE must not exceed 1024"
+#endif
+#if (CUSTOM_HID_HS_BINTERVAL < 1) || (CUSTOM_HID_HS_BINTERVAL > 16)
+  #error "CUSTOM_HID_HS_BINTERVAL must be 1 to 16"
+#endif
+#if (CUSTOM_HID_FS_BINTERVAL < 1) || (CUSTOM_HID_FS_BINTERVAL > 255)
+  #error "CUSTOM_HID_FS_BINTERVAL must be 1 to 255"
+#endif
+#if (USBD_CUSTOMHID_OUTREPORT_BUF_SIZE < CUSTOM_HID_EPOUT_SIZE)
+  #error "USBD_CUSTOMHID_OUTREPORT_BUF_SIZE must hold a CUSTOM_HID_EPOUT_SIZE packet"
+#endif
 
 #define USB_CUSTOM_HID_CONFIG_DESC_SIZ       41
 #define USB_CUSTOM_HID_DESC_SIZ              9
@@ -102,6 +147,13 @@ typedef struct
   uint32_t             AltSetting;
   uint32_t             IsReportAvailable;  
   CUSTOM_HID_StateTypeDef     state;  
+#if (CUSTOM_HID_IN_QUEUE_DEPTH > 0)
+  uint32_t             InQueue[CUSTOM_HID_IN_QUEUE_DEPTH][(CUSTOM_HID_IN_REPORT_SIZE + 3) / 4];
+  uint16_t             InLength[CUSTOM_HID_IN_QUEUE_DEPTH];
+  __IO uint32_t        InHead;     /* Reports sent, the head one is in flight */
+  __IO uint32_t        InTail;     /* Reports queued                          */
+  uint32_t             InDropped;  /* Reports refused, queue full             */
+#endif
 }
 USBD_CUSTOM_HID_HandleTypeDef; 
 /**
@@ -135,6 +187,7 @@ uint8_t USBD_CUSTOM_HID_SendReport (USBD_HandleTypeDef *pdev,
                                  uint8_t *report,
                                  uint16_t len);
 
+uint32_t USBD_CUSTOM_HID_GetQueueSpace (USBD_HandleTypeDef *pdev);
 
 
 uint8_t  USBD_CUSTOM_HID_RegisterInterface  (USBD_HandleTypeDef   *pdev, 
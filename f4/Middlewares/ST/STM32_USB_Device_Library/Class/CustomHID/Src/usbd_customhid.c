@@ -98,7 +98,11 @@ static uint8_t  USBD_CUSTOM_HID_DeInit (USBD_HandleTypeDef *pdev,
 static uint8_t  USBD_CUSTOM_HID_Setup (USBD_HandleTypeDef *pdev, 
                                 USBD_SetupReqTypedef *req);
 
-static uint8_t  *USBD_CUSTOM_HID_GetCfgDesc (uint16_t *length);
+static uint8_t  *USBD_CUSTOM_HID_GetFSCfgDesc (uint16_t *length);
+
+static uint8_t  *USBD_CUSTOM_HID_GetHSCfgDesc (uint16_t *length);
+
+static uint8_t  *USBD_CUSTOM_HID_GetOtherSpeedCfgDesc (uint16_t *length);
 
 static uint8_t  *USBD_CUSTOM_HID_GetDeviceQualifierDesc (uint16_t *length);
 
@@ -106,6 +110,9 @@ static uint8_t  USBD_CUSTOM_HID_DataIn (USBD_HandleTypeDef *pdev, uint8_t epnum)
 
 static uint8_t  USBD_CUSTOM_HID_DataOut (USBD_HandleTypeDef *pdev, uint8_t epnum);
 static uint8_t  USBD_CUSTOM_HID_EP0_RxReady (USBD_HandleTypeDef  *pdev);
+#if (CUSTOM_HID_IN_QUEUE_DEPTH > 0)
+static void     USBD_CUSTOM_HID_StartIn (USBD_HandleTypeDef *pdev);
+#endif
 /**
   * @}
   */ 
@@ -126,14 +133,14 @@ USBD_ClassTypeDef  USBD_CUSTOM_HID =
   NULL, /*SOF */
   NULL,
   NULL,      
-  USBD_CUSTOM_HID_GetCfgDesc,
-  USBD_CUSTOM_HID_GetCfgDesc, 
-  USBD_CUSTOM_HID_GetCfgDesc,
+  USBD_CUSTOM_HID_GetHSCfgDesc,
+  USBD_CUSTOM_HID_GetFSCfgDesc, 
+  USBD_CUSTOM_HID_GetOtherSpeedCfgDesc,
   USBD_CUSTOM_HID_GetDeviceQualifierDesc,
 };
 
-/* USB CUSTOM_HID device Configuration Descriptor */
-__ALIGN_BEGIN static uint8_t USBD_CUSTOM_HID_CfgDesc[USB_CUSTOM_HID_CONFIG_DESC_SIZ] __ALIGN_END =
+/* USB CUSTOM_HID device FS Configuration Descriptor */
+__ALIGN_BEGIN static uint8_t USBD_CUSTOM_HID_CfgFSDesc[USB_CUSTOM_HID_CONFIG_DESC_SIZ] __ALIGN_END =
 {
   0x09, /* bLength: Configuration Descriptor size */
   USB_DESC_TYPE_CONFIGURATION, /* bDescriptorType: Configuration */
@@ -176,18 +183,136 @@ __ALIGN_BEGIN static uint8_t USBD_CUSTOM_HID_CfgDesc[USB_CUSTOM_HID_CONFIG_DESC_
   
   CUSTOM_HID_EPIN_ADDR,     /*bEndpointAddress: Endpoint Address (IN)*/
   0x03,          /*bmAttributes: Interrupt endpoint*/
-  CUSTOM_HID_EPIN_SIZE, /*wMaxPacketSize: 2 Byte max */
+  LOBYTE(CUSTOM_HID_FS_EPIN_SIZE), /*wMaxPacketSize */
+  HIBYTE(CUSTOM_HID_FS_EPIN_SIZE),
+  CUSTOM_HID_FS_BINTERVAL, /*bInterval: Polling Interval */
+  /* 34 */
+  
+  0x07,	         /* bLength: Endpoint Descriptor size */
+  USB_DESC_TYPE_ENDPOINT,	/* bDescriptorType: */
+  CUSTOM_HID_EPOUT_ADDR,  /*bEndpointAddress: Endpoint Address (OUT)*/
+  0x03,	/* bmAttributes: Interrupt endpoint */
+  LOBYTE(CUSTOM_HID_FS_EPOUT_SIZE),	/* wMaxPacketSize */
+  HIBYTE(CUSTOM_HID_FS_EPOUT_SIZE),
+  CUSTOM_HID_FS_BINTERVAL,	/* bInterval: Polling Interval */
+  /* 41 */
+} ;
+
+/* USB CUSTOM_HID device HS Configuration Descriptor */
+__ALIGN_BEGIN static uint8_t USBD_CUSTOM_HID_CfgHSDesc[USB_CUSTOM_HID_CONFIG_DESC_SIZ] __ALIGN_END =
+{
+  0x09, /* bLength: Configuration Descriptor size */
+  USB_DESC_TYPE_CONFIGURATION, /* bDescriptorType: Configuration */
+  USB_CUSTOM_HID_CONFIG_DESC_SIZ,
+  /* wTotalLength: Bytes returned */
+  0x00,
+  0x01,         /*bNumInterfaces: 1 interface*/
+  0x01,         /*bConfigurationValue: Configuration value*/
+  0x00,         /*iConfiguration: Index of string descriptor describing
+  the configuration*/
+  0xC0,         /*bmAttributes: bus powered */
+  0x32,         /*MaxPower 100 mA: this current is used for detecting Vbus*/
+  
+  /************** Descriptor of CUSTOM HID interface ****************/
+  /* 09 */
+  0x09,         /*bLength: Interface Descriptor size*/
+  USB_DESC_TYPE_INTERFACE,/*bDescriptorType: Interface descriptor type*/
+  0x00,         /*bInterfaceNumber: Number of Interface*/
+  0x00,         /*bAlternateSetting: Alternate setting*/
+  0x02,         /*bNumEndpoints*/
+  0x03,         /*bInterfaceClass: CUSTOM_HID*/
+  0x00,         /*bInterfaceSubClass : 1=BOOT, 0=no boot*/
+  0x00,         /*nInterfaceProtocol : 0=none, 1=keyboard, 2=mouse*/
+  0,            /*iInterface: Index of string descriptor*/
+  /******************** Descriptor of CUSTOM_HID *************************/
+  /* 18 */
+  0x09,         /*bLength: CUSTOM_HID Descriptor size*/
+  CUSTOM_HID_DESCRIPTOR_TYPE, /*bDescriptorType: CUSTOM_HID*/
+  0x11,         /*bCUSTOM_HIDUSTOM_HID: CUSTOM_HID Class Spec release number*/
+  0x01,
+  0x00,         /*bCountryCode: Hardware target country*/
+  0x01,         /*bNumDescriptors: Number of CUSTOM_HID class descriptors to follow*/
+  0x22,         /*bDescriptorType*/
+  USBD_CUSTOM_HID_REPORT_DESC_SIZE,/*wItemLength: Total length of Report descriptor*/
   0x00,
-  0x20,          /*bInterval: Polling Interval (20 ms)*/
+  /******************** Descriptor of Custom HID endpoints ********************/
+  /* 27 */
+  0x07,          /*bLength: Endpoint Descriptor size*/
+  USB_DESC_TYPE_ENDPOINT, /*bDescriptorType:*/
+  
+  CUSTOM_HID_EPIN_ADDR,     /*bEndpointAddress: Endpoint Address (IN)*/
+  0x03,          /*bmAttributes: Interrupt endpoint*/
+  LOBYTE(CUSTOM_HID_EPIN_SIZE), /*wMaxPacketSize */
+  HIBYTE(CUSTOM_HID_EPIN_SIZE),
+  CUSTOM_HID_HS_BINTERVAL, /*bInterval: Polling Interval */
   /* 34 */
   
   0x07,	         /* bLength: Endpoint Descriptor size */
   USB_DESC_TYPE_ENDPOINT,	/* bDescriptorType: */
   CUSTOM_HID_EPOUT_ADDR,  /*bEndpointAddress: Endpoint Address (OUT)*/
   0x03,	/* bmAttributes: Interrupt endpoint */
-  CUSTOM_HID_EPOUT_SIZE,	/* wMaxPacketSize: 2 Bytes max  */
+  LOBYTE(CUSTOM_HID_EPOUT_SIZE),	/* wMaxPacketSize */
+  HIBYTE(CUSTOM_HID_EPOUT_SIZE),
+  CUSTOM_HID_HS_BINTERVAL,	/* bInterval: Polling Interval */
+  /* 41 */
+} ;
+
+/* USB CUSTOM_HID device Other Speed Configuration Descriptor */
+__ALIGN_BEGIN static uint8_t USBD_CUSTOM_HID_OtherSpeedCfgDesc[USB_CUSTOM_HID_CONFIG_DESC_SIZ] __ALIGN_END =
+{
+  0x09, /* bLength: Configuration Descriptor size */
+  USB_DESC_TYPE_CONFIGURATION, /* bDescriptorType: Configuration */
+  USB_CUSTOM_HID_CONFIG_DESC_SIZ,
+  /* wTotalLength: Bytes returned */
   0x00,
-  0x20,	/* bInterval: Polling Interval (20 ms) */
+  0x01,         /*bNumInterfaces: 1 interface*/
+  0x01,         /*bConfigurationValue: Configuration value*/
+  0x00,         /*iConfiguration: Index of string descriptor describing
+  the configuration*/
+  0xC0,         /*bmAttributes: bus powered */
+  0x32,         /*MaxPower 100 mA: this current is used for detecting Vbus*/
+  
+  /************** Descriptor of CUSTOM HID interface ****************/
+  /* 09 */
+  0x09,         /*bLength: Interface Descriptor size*/
+  USB_DESC_TYPE_INTERFACE,/*bDescriptorType: Interface descriptor type*/
+  0x00,         /*bInterfaceNumber: Number of Interface*/
+  0x00,         /*bAlternateSetting: Alternate setting*/
+  0x02,         /*bNumEndpoints*/
+  0x03,         /*bInterfaceClass: CUSTOM_HID*/
+  0x00,         /*bInterfaceSubClass : 1=BOOT, 0=no boot*/
+  0x00,         /*nInterfaceProtocol : 0=none, 1=keyboard, 2=mouse*/
+  0,            /*iInterface: Index of string descriptor*/
+  /******************** Descriptor of CUSTOM_HID *************************/
+  /* 18 */
+  0x09,         /*bLength: CUSTOM_HID Descriptor size*/
+  CUSTOM_HID_DESCRIPTOR_TYPE, /*bDescriptorType: CUSTOM_HID*/
+  0x11,         /*bCUSTOM_HIDUSTOM_HID: CUSTOM_HID Class Spec release number*/
+  0x01,
+  0x00,         /*bCountryCode: Hardware target country*/
+  0x01,         /*bNumDescriptors: Number of CUSTOM_HID class descriptors to follow*/
+  0x22,         /*bDescriptorType*/
+  USBD_CUSTOM_HID_REPORT_DESC_SIZE,/*wItemLength: Total length of Report descriptor*/
+  0x00,
+  /******************** Descriptor of Custom HID endpoints ********************/
+  /* 27 */
+  0x07,          /*bLength: Endpoint Descriptor size*/
+  USB_DESC_TYPE_ENDPOINT, /*bDescriptorType:*/
+  
+  CUSTOM_HID_EPIN_ADDR,     /*bEndpointAddress: Endpoint Address (IN)*/
+  0x03,          /*bmAttributes: Interrupt endpoint*/
+  LOBYTE(CUSTOM_HID_FS_EPIN_SIZE), /*wMaxPacketSize */
+  HIBYTE(CUSTOM_HID_FS_EPIN_SIZE),
+  CUSTOM_HID_FS_BINTERVAL, /*bInterval: Polling Interval */
+  /* 34 */
+  
+  0x07,	         /* bLength: Endpoint Descriptor size */
+  USB_DESC_TYPE_ENDPOINT,	/* bDescriptorType: */
+  CUSTOM_HID_EPOUT_ADDR,  /*bEndpointAddress: Endpoint Address (OUT)*/
+  0x03,	/* bmAttributes: Interrupt endpoint */
+  LOBYTE(CUSTOM_HID_FS_EPOUT_SIZE),	/* wMaxPacketSize */
+  HIBYTE(CUSTOM_HID_FS_EPOUT_SIZE),
+  CUSTOM_HID_FS_BINTERVAL,	/* bInterval: Polling Interval */
   /* 41 */
 } ;
 
@@ -245,13 +370,13 @@ static uint8_t  USBD_CUSTOM_HID_Init (USBD_HandleTypeDef *pdev,
   USBD_LL_OpenEP(pdev,
                  CUSTOM_HID_EPIN_ADDR,
                  USBD_EP_TYPE_INTR,
-                 CUSTOM_HID_EPIN_SIZE);  
+                 (pdev->dev_speed == USBD_SPEED_HIGH) ? CUSTOM_HID_EPIN_SIZE : CUSTOM_HID_FS_EPIN_SIZE);
   
   /* Open EP OUT */
   USBD_LL_OpenEP(pdev,
                  CUSTOM_HID_EPOUT_ADDR,
                  USBD_EP_TYPE_INTR,
-                 CUSTOM_HID_EPOUT_SIZE);
+                 (pdev->dev_speed == USBD_SPEED_HIGH) ? CUSTOM_HID_EPOUT_SIZE : CUSTOM_HID_FS_EPOUT_SIZE);
   
   pdev->pClassData = USBD_malloc(sizeof (USBD_CUSTOM_HID_HandleTypeDef));
   
@@ -264,6 +389,11 @@ static uint8_t  USBD_CUSTOM_HID_Init (USBD_HandleTypeDef *pdev,
     hhid = (USBD_CUSTOM_HID_HandleTypeDef*) pdev->pClassData;
       
     hhid->state = CUSTOM_HID_IDLE;
+#if (CUSTOM_HID_IN_QUEUE_DEPTH > 0)
+    hhid->InHead = 0;
+    hhid->InTail = 0;
+    hhid->InDropped = 0;
+#endif
     ((USBD_CUSTOM_HID_ItfTypeDef *)pdev->pUserData)->Init();
           /* Prepare Out endpoint to receive 1st packet */ 
     USBD_LL_PrepareReceive(pdev, CUSTOM_HID_EPOUT_ADDR, hhid->Report_buf, 
@@ -401,6 +531,34 @@ uint8_t USBD_CUSTOM_HID_SendReport     (USBD_HandleTypeDef  *pdev,
 {
   USBD_CUSTOM_HID_HandleTypeDef     *hhid = (USBD_CUSTOM_HID_HandleTypeDef*)pdev->pClassData;
   
+#if (CUSTOM_HID_IN_QUEUE_DEPTH > 0)
+  uint8_t  *slot;
+  uint16_t i;
+
+  if (pdev->dev_state == USBD_STATE_CONFIGURED )
+  {
+    if (len > CUSTOM_HID_IN_REPORT_SIZE)
+    {
+      return USBD_FAIL;
+    }
+    if ((hhid->InTail - hhid->InHead) >= CUSTOM_HID_IN_QUEUE_DEPTH)
+    {
+      hhid->InDropped++;
+      return USBD_BUSY;
+    }
+
+    /* The report is copied, the caller buffer can be reused on return */
+    slot = (uint8_t *)hhid->InQueue[hhid->InTail % CUSTOM_HID_IN_QUEUE_DEPTH];
+    for (i = 0; i < len; i++)
+    {
+      slot[i] = report[i];
+    }
+    hhid->InLength[hhid->InTail % CUSTOM_HID_IN_QUEUE_DEPTH] = len;
+    hhid->InTail++;
+
+    USBD_CUSTOM_HID_StartIn(pdev);
+  }
+#else
   if (pdev->dev_state == USBD_STATE_CONFIGURED )
   {
     if(hhid->state == CUSTOM_HID_IDLE)
@@ -412,20 +570,68 @@ uint8_t USBD_CUSTOM_HID_SendReport     (USBD_HandleTypeDef  *pdev,
                         len);
     }
   }
+#endif
   return USBD_OK;
 }
 
 /**
-  * @brief  USBD_CUSTOM_HID_GetCfgDesc 
-  *         return configuration descriptor
+  * @brief  USBD_CUSTOM_HID_GetQueueSpace
+  *         Number of IN reports that can be queued
+  * @param  pdev: device instance
+  * @retval Free queue entries, 1 or 0 without queue
+  */
+uint32_t USBD_CUSTOM_HID_GetQueueSpace (USBD_HandleTypeDef *pdev)
+{
+  USBD_CUSTOM_HID_HandleTypeDef     *hhid = (USBD_CUSTOM_HID_HandleTypeDef*)pdev->pClassData;
+
+  if ((hhid == NULL) || (pdev->dev_state != USBD_STATE_CONFIGURED))
+  {
+    return 0;
+  }
+#if (CUSTOM_HID_IN_QUEUE_DEPTH > 0)
+  return CUSTOM_HID_IN_QUEUE_DEPTH - (hhid->InTail - hhid->InHead);
+#else
+  return (hhid->state == CUSTOM_HID_IDLE) ? 1 : 0;
+#endif
+}
+
+/**
+  * @brief  USBD_CUSTOM_HID_GetFSCfgDesc 
+  *         return FS configuration descriptor
+  * @param  speed : current device speed
+  * @param  length : pointer data length
+  * @retval pointer to descriptor buffer
+  */
+static uint8_t  *USBD_CUSTOM_HID_GetFSCfgDesc (uint16_t *length)
+{
+  *length = sizeof (USBD_CUSTOM_HID_CfgFSDesc);
+  return USBD_CUSTOM_HID_CfgFSDesc;
+}
+
+/**
+  * @brief  USBD_CUSTOM_HID_GetHSCfgDesc 
+  *         return HS configuration descriptor
+  * @param  speed : current device speed
+  * @param  length : pointer data length
+  * @retval pointer to descriptor buffer
+  */
+static uint8_t  *USBD_CUSTOM_HID_GetHSCfgDesc (uint16_t *length)
+{
+  *length = sizeof (USBD_CUSTOM_HID_CfgHSDesc);
+  return USBD_CUSTOM_HID_CfgHSDesc;
+}
+
+/**
+  * @brief  USBD_CUSTOM_HID_GetOtherSpeedCfgDesc 
+  *         return other speed configuration descriptor
   * @param  speed : current device speed
   * @param  length : pointer data length
   * @retval pointer to descriptor buffer
   */
-static uint8_t  *USBD_CUSTOM_HID_GetCfgDesc (uint16_t *length)
+static uint8_t  *USBD_CUSTOM_HID_GetOtherSpeedCfgDesc (uint16_t *length)
 {
-  *length = sizeof (USBD_CUSTOM_HID_CfgDesc);
-  return USBD_CUSTOM_HID_CfgDesc;
+  *length = sizeof (USBD_CUSTOM_HID_OtherSpeedCfgDesc);
+  return USBD_CUSTOM_HID_OtherSpeedCfgDesc;
 }
 
 /**
@@ -439,9 +645,18 @@ static uint8_t  USBD_CUSTOM_HID_DataIn (USBD_HandleTypeDef *pdev,
                               uint8_t epnum)
 {
   
+#if (CUSTOM_HID_IN_QUEUE_DEPTH > 0)
+  USBD_CUSTOM_HID_HandleTypeDef     *hhid = (USBD_CUSTOM_HID_HandleTypeDef*)pdev->pClassData;
+
+  /* The head report is sent, send the next one at once */
+  hhid->InHead++;
+  hhid->state = CUSTOM_HID_IDLE;
+  USBD_CUSTOM_HID_StartIn(pdev);
+#else
   /* Ensure that the FIFO is empty before a new transfer, this condition could 
   be caused by  a new transfer before the end of the previous transfer */
   ((USBD_CUSTOM_HID_HandleTypeDef *)pdev->pClassData)->state = CUSTOM_HID_IDLE;
+#endif
 
   return USBD_OK;
 }
@@ -519,6 +734,34 @@ uint8_t  USBD_CUSTOM_HID_RegisterInterface  (USBD_HandleTypeDef   *pdev,
   
   return ret;
 }
+
+#if (CUSTOM_HID_IN_QUEUE_DEPTH > 0)
+/**
+  * @brief  USBD_CUSTOM_HID_StartIn
+  *         Send the head queued report when the endpoint is idle
+  * @param  pdev: device instance
+  * @retval None
+  */
+static void USBD_CUSTOM_HID_StartIn (USBD_HandleTypeDef *pdev)
+{
+  USBD_CUSTOM_HID_HandleTypeDef     *hhid = (USBD_CUSTOM_HID_HandleTypeDef*)pdev->pClassData;
+  uint32_t primask = __get_PRIMASK();
+  uint32_t slot;
+
+  /* Called from the application and from the USB interrupt */
+  __disable_irq();
+
+  if ((hhid->state == CUSTOM_HID_IDLE) && (hhid->InHead != hhid->InTail))
+  {
+    slot = hhid->InHead % CUSTOM_HID_IN_QUEUE_DEPTH;
+    hhid->state = CUSTOM_HID_BUSY;
+    USBD_LL_Transmit (pdev, CUSTOM_HID_EPIN_ADDR, (uint8_t *)hhid->InQueue[slot],
+                      hhid->InLength[slot]);
+  }
+
+  __set_PRIMASK(primask);
+}
+#endif
 /**
   * @}
   */ 
@@ -50,6 +50,12 @@
   * @{
   */ 
     
+/* Set USBD_DFU_PIPELINED to 1 in usbd_conf.h to program a block while the
+   next one is received, with media providing WriteAsync, EraseAsync and Busy */
+#ifndef USBD_DFU_PIPELINED
+#define USBD_DFU_PIPELINED             0
+#endif
+
 #define USB_DFU_CONFIG_DESC_SIZ        (18 + (9 * USBD_DFU_MAX_ITF_NUM))
 #define USB_DFU_DESC_SIZ               9
     
@@ -162,6 +168,14 @@ typedef struct
     uint8_t  d8[USBD_DFU_XFER_SIZE];
   }buffer;
   
+#if (USBD_DFU_PIPELINED == 1)
+  union
+  {
+    uint32_t d32[USBD_DFU_XFER_SIZE/4];
+    uint8_t  d8[USBD_DFU_XFER_SIZE];
+  }prog_buffer;                          /* Block being programmed by the media */
+#endif
+  
   uint8_t              dev_state; 
   uint8_t              dev_status[DFU_STATUS_DEPTH];
   uint8_t              manif_state;    
@@ -184,6 +198,12 @@ typedef struct
   uint16_t (* Write)    (uint8_t *src, uint8_t *dest, uint32_t Len);
   uint8_t* (* Read)     (uint8_t *src, uint8_t *dest, uint32_t Len);
   uint16_t (* GetStatus)(uint32_t Add, uint8_t cmd, uint8_t *buff);  
+#if (USBD_DFU_PIPELINED == 1)
+  /* Optional, NULL to program synchronously with Write and Erase */
+  uint16_t (* WriteAsync)(uint8_t *src, uint8_t *dest, uint32_t Len); /* Start programming, src kept until done */
+  uint16_t (* EraseAsync)(uint32_t Add);                              /* Start erasing the sector of Add        */
+  uint16_t (* Busy)     (void);                                       /* USBD_BUSY, USBD_OK or USBD_FAIL        */
+#endif
 }
 USBD_DFU_MediaTypeDef;
 /**
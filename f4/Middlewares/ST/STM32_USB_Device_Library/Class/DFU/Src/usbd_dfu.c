@@ -59,6 +59,7 @@
 #include "usbd_dfu.h"
 #include "usbd_desc.h"
 #include "usbd_ctlreq.h"
+#include <string.h>
 
 
 /** @addtogroup STM32_USB_DEVICE_LIBRARY
@@ -155,6 +156,12 @@ static void DFU_Abort     (USBD_HandleTypeDef *pdev);
 
 static void DFU_Leave  (USBD_HandleTypeDef *pdev); 
 
+#if (USBD_DFU_PIPELINED == 1)
+static uint8_t DFU_MediaIsAsync (USBD_HandleTypeDef *pdev);
+
+static uint8_t DFU_MediaReady (USBD_HandleTypeDef *pdev);
+#endif
+
 
 /**
   * @}
@@ -530,6 +537,21 @@ static uint8_t  USBD_DFU_EP0_TxReady (USBD_HandleTypeDef *pdev)
         hdfu->data_ptr += hdfu->buffer.d8[3] << 16;
         hdfu->data_ptr += hdfu->buffer.d8[4] << 24;
        
+#if (USBD_DFU_PIPELINED == 1)
+        if (DFU_MediaIsAsync(pdev))
+        {
+          /* Erase in the background once the previous operation is over */
+          if (DFU_MediaReady(pdev) == 0)
+          {
+            return USBD_OK;
+          }
+          if (((USBD_DFU_MediaTypeDef *)pdev->pUserData)->EraseAsync(hdfu->data_ptr) != USBD_OK)
+          {
+            return USBD_FAIL;
+          }
+        }
+        else
+#endif
         if (((USBD_DFU_MediaTypeDef *)pdev->pUserData)->Erase(hdfu->data_ptr) != USBD_OK)
         {
           return USBD_FAIL;
@@ -552,6 +574,23 @@ static uint8_t  USBD_DFU_EP0_TxReady (USBD_HandleTypeDef *pdev)
       /* Decode the required address */
       addr = ((hdfu->wblock_num - 2) * USBD_DFU_XFER_SIZE) + hdfu->data_ptr;
       
+#if (USBD_DFU_PIPELINED == 1)
+      if (DFU_MediaIsAsync(pdev))
+      {
+        /* Program the block in the background, the next block is received
+           in the meantime */
+        if (DFU_MediaReady(pdev) == 0)
+        {
+          return USBD_OK;
+        }
+        memcpy(hdfu->prog_buffer.d8, hdfu->buffer.d8, hdfu->wlength);
+        if (((USBD_DFU_MediaTypeDef *)pdev->pUserData)->WriteAsync(hdfu->prog_buffer.d8, (uint8_t *)addr, hdfu->wlength) != USBD_OK)
+        {
+          return USBD_FAIL;
+        }
+      }
+      else
+#endif
       /* Preform the write operation */
       if (((USBD_DFU_MediaTypeDef *)pdev->pUserData)->Write(hdfu->buffer.d8, (uint8_t *)addr, hdfu->wlength) != USBD_OK)
       {
@@ -573,6 +612,18 @@ static uint8_t  USBD_DFU_EP0_TxReady (USBD_HandleTypeDef *pdev)
   }
   else if (hdfu->dev_state == DFU_STATE_MANIFEST)/* Manifestation in progress*/
   {
+#if (USBD_DFU_PIPELINED == 1)
+    /* The last block must be programmed before leaving */
+    if (DFU_MediaIsAsync(pdev) && (DFU_MediaReady(pdev) == 0))
+    {
+      if (hdfu->dev_state == DFU_STATE_MANIFEST)
+      {
+        hdfu->dev_state = DFU_STATE_MANIFEST_SYNC;
+        hdfu->dev_status[4] = hdfu->dev_state;
+      }
+      return USBD_OK;
+    }
+#endif
     /* Start leaving DFU mode */
     DFU_Leave(pdev);
   }
@@ -743,7 +794,8 @@ static void DFU_Download(USBD_HandleTypeDef *pdev, USBD_SetupReqTypedef *req)
   /* Data setup request */
   if (req->wLength > 0)
   {
-    if ((hdfu->dev_state == DFU_STATE_IDLE) || (hdfu->dev_state == DFU_STATE_DNLOAD_IDLE))
+    if (((hdfu->dev_state == DFU_STATE_IDLE) || (hdfu->dev_state == DFU_STATE_DNLOAD_IDLE)) &&
+        (req->wLength <= USBD_DFU_XFER_SIZE))
     {
       /* Update the global length and block number */
       hdfu->wblock_num = req->wValue;
@@ -834,6 +886,15 @@ static void DFU_Upload(USBD_HandleTypeDef *pdev, USBD_SetupReqTypedef *req)
       }
       else if (hdfu->wblock_num > 1)
       {
+#if (USBD_DFU_PIPELINED == 1)
+        /* Read back only what is programmed */
+        if (DFU_MediaIsAsync(pdev))
+        {
+          while (((USBD_DFU_MediaTypeDef *)pdev->pUserData)->Busy() == USBD_BUSY)
+          {
+          }
+        }
+#endif
         hdfu->dev_state = DFU_STATE_UPLOAD_IDLE ;
         
         hdfu->dev_status[1] = 0;
@@ -1090,6 +1151,67 @@ void DFU_Leave(USBD_HandleTypeDef *pdev)
   }  
 }
 
+#if (USBD_DFU_PIPELINED == 1)
+/**
+  * @brief  DFU_MediaIsAsync
+  *         Tells whether the media programs in the background.
+  * @param  pdev: device instance
+  * @retval 1 when the media provides WriteAsync, EraseAsync and Busy, 0 otherwise
+  */
+static uint8_t DFU_MediaIsAsync(USBD_HandleTypeDef *pdev)
+{
+  USBD_DFU_MediaTypeDef *media = (USBD_DFU_MediaTypeDef *)pdev->pUserData;
+
+  return ((media->WriteAsync != NULL) && (media->EraseAsync != NULL) && (media->Busy != NULL)) ? 1 : 0;
+}
+
+/**
+  * @brief  DFU_MediaReady
+  *         Checks that the previous background operation is over. While it
+  *         is not, the request stays pending: the state goes back to
+  *         DNLOAD-SYNC and the host retries after bwPollTimeout.
+  *         An operation that failed moves the state machine to dfuERROR.
+  * @param  pdev: device instance
+  * @retval 1 when a new operation can be started, 0 otherwise
+  */
+static uint8_t DFU_MediaReady(USBD_HandleTypeDef *pdev)
+{
+  USBD_DFU_HandleTypeDef *hdfu = (USBD_DFU_HandleTypeDef*) pdev->pClassData;
+  uint16_t               status;
+
+  status = ((USBD_DFU_MediaTypeDef *)pdev->pUserData)->Busy();
+
+  if (status == USBD_OK)
+  {
+    return 1;
+  }
+
+  if (status == USBD_BUSY)
+  {
+    /* Keep wlength and wblock_num: the block is taken on the next poll */
+    if (hdfu->dev_state == DFU_STATE_DNLOAD_BUSY)
+    {
+      hdfu->dev_state = DFU_STATE_DNLOAD_SYNC;
+    }
+  }
+  else
+  {
+    hdfu->wlength = 0;
+    hdfu->wblock_num = 0;
+    hdfu->manif_state = DFU_MANIFEST_COMPLETE;
+    hdfu->dev_state = DFU_STATE_ERROR;
+    hdfu->dev_status[0] = DFU_ERROR_PROG;
+  }
+
+  hdfu->dev_status[1] = 0;
+  hdfu->dev_status[2] = 0;
+  hdfu->dev_status[3] = 0;
+  hdfu->dev_status[4] = hdfu->dev_state;
+
+  return 0;
+}
+#endif /* USBD_DFU_PIPELINED */
+
 /**
   * @}
   */ 
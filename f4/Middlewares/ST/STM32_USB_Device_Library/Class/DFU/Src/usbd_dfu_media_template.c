@@ -43,6 +43,11 @@ uint16_t MEM_If_Write (uint8_t *src, uint8_t *dest, uint32_t Len);
 uint8_t *MEM_If_Read  (uint8_t *src, uint8_t *dest, uint32_t Len);
 uint16_t MEM_If_DeInit(void);
 uint16_t MEM_If_GetStatus (uint32_t Add, uint8_t Cmd, uint8_t *buffer);
+#if (USBD_DFU_PIPELINED == 1)
+uint16_t MEM_If_WriteAsync (uint8_t *src, uint8_t *dest, uint32_t Len);
+uint16_t MEM_If_EraseAsync (uint32_t Add);
+uint16_t MEM_If_Busy (void);
+#endif
 
 USBD_DFU_MediaTypeDef USBD_DFU_MEDIA_Template_fops =
 {
@@ -53,6 +58,11 @@ USBD_DFU_MediaTypeDef USBD_DFU_MEDIA_Template_fops =
     MEM_If_Write,
     MEM_If_Read,
     MEM_If_GetStatus,
+#if (USBD_DFU_PIPELINED == 1)
+    MEM_If_WriteAsync,
+    MEM_If_EraseAsync,
+    MEM_If_Busy,
+#endif
   
 };
 /**
@@ -135,5 +145,45 @@ uint16_t MEM_If_GetStatus (uint32_t Add, uint8_t Cmd, uint8_t *buffer)
   }                             
   return  (0); 
 }
+
+#if (USBD_DFU_PIPELINED == 1)
+/**
+  * @brief  MEM_If_WriteAsync
+  *         Start programming a block, e.g. with HAL_FLASH_Program_IT(), and
+  *         return. src stays valid until MEM_If_Busy() returns USBD_OK.
+  *         Erase the sector first when it has not been erased yet.
+  * @param  src: block to program.
+  * @param  dest: Address to be written to.
+  * @param  Len: Number of data to be written (in bytes).
+  * @retval 0 if operation is started, MAL_FAIL else.
+  */
+uint16_t MEM_If_WriteAsync(uint8_t *src, uint8_t *dest, uint32_t Len)
+{
+  return 0;
+}
+
+/**
+  * @brief  MEM_If_EraseAsync
+  *         Start erasing a sector, e.g. with HAL_FLASHEx_Erase_IT(), and
+  *         return.
+  * @param  Add: Address of sector to be erased.
+  * @retval 0 if operation is started, MAL_FAIL else.
+  */
+uint16_t MEM_If_EraseAsync(uint32_t Add)
+{
+  return 0;
+}
+
+/**
+  * @brief  MEM_If_Busy
+  *         Report the state of the last background operation.
+  * @param  None
+  * @retval USBD_BUSY while it runs, USBD_OK when done, USBD_FAIL on error.
+  */
+uint16_t MEM_If_Busy(void)
+{
+  return USBD_OK;
+}
+#endif /* USBD_DFU_PIPELINED */
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
 
@@ -68,6 +68,7 @@
  /* DFU Class Config */
 #define USBD_DFU_MAX_ITF_NUM                   1
 #define USBD_DFU_XFERS_IZE                     1024
+#define USBD_DFU_PIPELINED                     0
 
  /* AUDIO Class Config */
 #define USBD_AUDIO_FREQ                       22100 
@@ -142,6 +142,15 @@
 * @{
 */ 
 
+/* Streaming mode sizes, to be overridden in usbh_conf.h */
+#ifndef USBH_CDC_RX_STREAM_MAX_BUFFERS
+#define USBH_CDC_RX_STREAM_MAX_BUFFERS                          8U
+#endif
+
+#ifndef USBH_CDC_TX_QUEUE_SIZE
+#define USBH_CDC_TX_QUEUE_SIZE                                  8U
+#endif
+
 /* States for CDC State Machine */
 typedef enum
 {
@@ -350,6 +359,34 @@ typedef struct
 }
 CDC_DataItfTypedef ;
 
+/* Bulk IN streaming ring, USBH_CDC_StartRxStream(): Head and Tail count the
+   buffers filled by the class and released by the application */
+typedef struct
+{
+  uint8_t                           *pBuffers;
+  uint32_t                           BufferSize;
+  uint32_t                           Count;
+  __IO uint32_t                      Head;
+  __IO uint32_t                      Tail;
+  __IO uint32_t                      Length[USBH_CDC_RX_STREAM_MAX_BUFFERS];
+  uint32_t                           Throttled;  /* IN pipe left idle, ring full */
+}
+CDC_RxStreamTypeDef;
+
+/* Bulk OUT queue, USBH_CDC_TxQueue(): Head and Tail count the buffers queued
+   by the application and sent by the class */
+typedef struct
+{
+  uint8_t                           *pData[USBH_CDC_TX_QUEUE_SIZE];
+  uint32_t                           Length[USBH_CDC_TX_QUEUE_SIZE];
+  __IO uint32_t                      Head;
+  __IO uint32_t                      Tail;
+  uint32_t                           Offset;     /* Bytes of the oldest buffer sent */
+  uint32_t                           XferLength;
+  uint8_t                            Enabled;
+}
+CDC_TxQueueTypeDef;
+
 /* Structure for CDC process */
 typedef struct _CDC_Process
 {
@@ -366,6 +403,8 @@ typedef struct _CDC_Process
   CDC_DataStateTypeDef              data_tx_state;
   CDC_DataStateTypeDef              data_rx_state; 
   uint8_t                           Rx_Poll;
+  CDC_RxStreamTypeDef               RxStream;
+  CDC_TxQueueTypeDef                TxQueue;
 }
 CDC_HandleTypeDef;
 
@@ -419,6 +458,20 @@ USBH_StatusTypeDef  USBH_CDC_Receive(USBH_HandleTypeDef *phost,
 
 uint16_t            USBH_CDC_GetLastReceivedDataSize(USBH_HandleTypeDef *phost);
 
+USBH_StatusTypeDef  USBH_CDC_StartRxStream(USBH_HandleTypeDef *phost,
+                                           uint8_t *pbuff,
+                                           uint32_t size,
+                                           uint32_t count);
+
+uint32_t            USBH_CDC_RxStreamGet(USBH_HandleTypeDef *phost,
+                                         uint8_t **ppbuff);
+
+void                USBH_CDC_RxStreamRelease(USBH_HandleTypeDef *phost);
+
+USBH_StatusTypeDef  USBH_CDC_TxQueue(USBH_HandleTypeDef *phost,
+                                     uint8_t *pbuff,
+                                     uint32_t length);
+
 USBH_StatusTypeDef  USBH_CDC_Stop(USBH_HandleTypeDef *phost);
 
 void USBH_CDC_LineCodingChanged(USBH_HandleTypeDef *phost);
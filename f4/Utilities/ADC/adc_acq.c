@@ -0,0 +1,427 @@
+/**
+  ******************************************************************************
+  * @file    adc_acq.c
+  * @author  MCD Application Team
+  * @brief   Timer triggered simultaneous multi ADC acquisition into a DMA ring,
+  *          de-interleaved and decimated into per channel blocks.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- initialize ADC1 (master) and optionally ADC2 and ADC3 (slaves) with
+   HAL_ADC_Init(): same resolution and number of regular ranks, scan mode,
+   no continuous mode, DMA continuous requests. The master is triggered by
+   the TRGO of a timer (ExternalTrigConv ADC_EXTERNALTRIGCONV_Tx_TRGO).
+   Link a circular DMA stream to the master: half-word transfers with 1 or
+   3 ADCs (DMA mode 1), word transfers with 2 ADCs (DMA mode 2). Initialize
+   the timer with HAL_TIM_Base_Init(), its period is set here from
+   SampleRate. Call HAL_DMA_IRQHandler() from the DMA interrupt handler:
+   this module implements the HAL_ADC_ConvHalfCpltCallback(),
+   HAL_ADC_ConvCpltCallback() and HAL_ADC_ErrorCallback() functions in its
+   place.
+
+2- ADC_Acq_Init() sets the regular simultaneous multi ADC mode and the
+   timer, ADC_Acq_Start() starts the conversions. Channel c is rank
+   c / NbAdc of ADC c % NbAdc: ADC1 rank 1, ADC2 rank 1, ADC3 rank 1,
+   ADC1 rank 2...
+
+3- every half ring (BlockSize sequences), the samples are de-interleaved
+   in the DMA interrupt into one block per channel, decimated on the way,
+   and ADC_Acq_BlockCallback() gets the blocks: channel c at
+   pBlocks[c * Length]. Blocks stay valid until the next callback.
+
+4- decimation: the average of Decimation raw samples (raw codes). With
+   ADC_ACQ_USE_CMSIS_DSP defined in main.h and pFir set, each channel is
+   converted to q15 around midscale and filtered by its CMSIS-DSP FIR
+   decimator instead (BlockSize multiple of the decimation factor of the
+   instances, see arm_fir_decimate_init_q15()).
+
+5- Overruns counts the half rings the DMA started rewriting before their
+   processing ended: the blocks delivered then mix two periods. The STM32F4
+   ADC has no oversampling hardware, decimation runs on the CPU.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "adc_acq.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Timers on APB2 */
+#if defined(TIM8)
+#define ADC_ACQ_TIM_APB2(__TIM__)  (((__TIM__) == TIM1) || ((__TIM__) == TIM8))
+#else
+#define ADC_ACQ_TIM_APB2(__TIM__)  ((__TIM__) == TIM1)
+#endif
+
+/* Private variables ---------------------------------------------------------*/
+static ADC_AcqTypeDef *AdcAcq;
+
+/* Private function prototypes -----------------------------------------------*/
+static HAL_StatusTypeDef ADC_Acq_TimerInit(ADC_AcqTypeDef *pAcq);
+static void              ADC_Acq_Process(ADC_AcqTypeDef *pAcq, uint32_t Half);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Set up the multi ADC mode and the trigger timer
+  * @param  pAcq: engine context, kept by the module
+  * @param  pConfig: ADCs, timer and buffers, copied
+  * @retval HAL status
+  */
+HAL_StatusTypeDef ADC_Acq_Init(ADC_AcqTypeDef *pAcq, const ADC_Acq_ConfigTypeDef *pConfig)
+{
+  ADC_HandleTypeDef *hadc = pConfig->hadc;
+  ADC_MultiModeTypeDef multimode;
+  uint32_t bits;
+  uint32_t word;
+
+  if ((pAcq == NULL) || (hadc == NULL) || (hadc->DMA_Handle == NULL) ||
+      (hadc->DMA_Handle->Init.Mode != DMA_CIRCULAR) ||
+      (hadc->Init.ContinuousConvMode != DISABLE) || (hadc->Init.DMAContinuousRequests != ENABLE) ||
+      (hadc->Init.ExternalTrigConvEdge == ADC_EXTERNALTRIGCONVEDGE_NONE) ||
+      ((pConfig->hadcSlave[0] == NULL) && (pConfig->hadcSlave[1] != NULL)) ||
+      (pConfig->pRing == NULL) || (pConfig->pOut == NULL) || (pConfig->BlockSize == 0U) ||
+      (pConfig->Decimation == 0U) || ((pConfig->BlockSize % pConfig->Decimation) != 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  memset(pAcq, 0, sizeof(ADC_AcqTypeDef));
+  pAcq->Config = *pConfig;
+  pAcq->NbAdc = 1U + ((pConfig->hadcSlave[0] != NULL) ? 1U : 0U) + ((pConfig->hadcSlave[1] != NULL) ? 1U : 0U);
+  pAcq->NbChannels = pAcq->NbAdc * hadc->Init.NbrOfConversion;
+  pAcq->OutLength = pConfig->BlockSize / pConfig->Decimation;
+
+  /* Dual mode moves both ADCs in one word (DMA mode 2), the others half-words */
+  word = (hadc->DMA_Handle->Init.PeriphDataAlignment == DMA_PDATAALIGN_WORD) ? 1U : 0U;
+  if (word != ((pAcq->NbAdc == 2U) ? 1U : 0U))
+  {
+    return HAL_ERROR;
+  }
+  pAcq->RingLength = (2U * pConfig->BlockSize * pAcq->NbChannels) >> word;
+  if (pAcq->RingLength > 0xFFFFU)
+  {
+    return HAL_ERROR;
+  }
+
+  bits = 12U - (2U * ((hadc->Init.Resolution & ADC_CR1_RES) >> ADC_CR1_RES_Pos));
+  pAcq->Midscale = 1UL << (bits - 1U);
+  pAcq->Shift = 16U - bits;
+
+  if (pAcq->NbAdc > 1U)
+  {
+    multimode.Mode = (pAcq->NbAdc == 2U) ? ADC_DUALMODE_REGSIMULT : ADC_TRIPLEMODE_REGSIMULT;
+    multimode.DMAAccessMode = (pAcq->NbAdc == 2U) ? ADC_DMAACCESSMODE_2 : ADC_DMAACCESSMODE_1;
+    multimode.TwoSamplingDelay = ADC_TWOSAMPLINGDELAY_5CYCLES;
+    if (HAL_ADCEx_MultiModeConfigChannel(hadc, &multimode) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  if ((pConfig->htim != NULL) && (ADC_Acq_TimerInit(pAcq) != HAL_OK))
+  {
+    return HAL_ERROR;
+  }
+
+  AdcAcq = pAcq;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Start the ADCs, the DMA ring and the trigger timer
+  * @param  pAcq: engine context
+  * @retval HAL status
+  */
+HAL_StatusTypeDef ADC_Acq_Start(ADC_AcqTypeDef *pAcq)
+{
+  ADC_HandleTypeDef *hadc = pAcq->Config.hadc;
+  HAL_StatusTypeDef status;
+  uint32_t i;
+
+  if (pAcq->NbAdc == 1U)
+  {
+    status = HAL_ADC_Start_DMA(hadc, (uint32_t *)pAcq->Config.pRing, pAcq->RingLength);
+  }
+  else
+  {
+    /* Slaves enabled first, they convert on the master trigger */
+    for (i = 0U; i < (pAcq->NbAdc - 1U); i++)
+    {
+      if (HAL_ADC_Start(pAcq->Config.hadcSlave[i]) != HAL_OK)
+      {
+        return HAL_ERROR;
+      }
+    }
+    status = HAL_ADCEx_MultiModeStart_DMA(hadc, (uint32_t *)pAcq->Config.pRing, pAcq->RingLength);
+  }
+
+  if ((status == HAL_OK) && (pAcq->Config.htim != NULL))
+  {
+    status = HAL_TIM_Base_Start(pAcq->Config.htim);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Stop the trigger timer, the ADCs and the DMA ring
+  * @param  pAcq: engine context
+  * @retval HAL status
+  */
+HAL_StatusTypeDef ADC_Acq_Stop(ADC_AcqTypeDef *pAcq)
+{
+  HAL_StatusTypeDef status;
+  uint32_t i;
+
+  if (pAcq->Config.htim != NULL)
+  {
+    (void)HAL_TIM_Base_Stop(pAcq->Config.htim);
+  }
+
+  if (pAcq->NbAdc == 1U)
+  {
+    status = HAL_ADC_Stop_DMA(pAcq->Config.hadc);
+  }
+  else
+  {
+    status = HAL_ADCEx_MultiModeStop_DMA(pAcq->Config.hadc);
+    for (i = 0U; i < (pAcq->NbAdc - 1U); i++)
+    {
+      (void)HAL_ADC_Stop(pAcq->Config.hadcSlave[i]);
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Blocks of a half ring ready
+  * @param  pAcq: engine context
+  * @param  pBlocks: channel c at pBlocks[c * Length]
+  * @param  Length: samples per channel
+  * @retval None
+  */
+__weak void ADC_Acq_BlockCallback(ADC_AcqTypeDef *pAcq, const int16_t *pBlocks, uint32_t Length)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(pAcq);
+  UNUSED(pBlocks);
+  UNUSED(Length);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the ADC_Acq_BlockCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  ADC overrun or DMA error, the acquisition may have stopped
+  * @param  pAcq: engine context
+  * @retval None
+  */
+__weak void ADC_Acq_ErrorCallback(ADC_AcqTypeDef *pAcq)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(pAcq);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the ADC_Acq_ErrorCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  First half of the ring filled
+  * @param  hadc: ADC handle
+  * @retval None
+  */
+void HAL_ADC_ConvHalfCpltCallback(ADC_HandleTypeDef *hadc)
+{
+  if ((AdcAcq != NULL) && (AdcAcq->Config.hadc == hadc))
+  {
+    ADC_Acq_Process(AdcAcq, 0U);
+  }
+}
+
+/**
+  * @brief  Second half of the ring filled
+  * @param  hadc: ADC handle
+  * @retval None
+  */
+void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef *hadc)
+{
+  if ((AdcAcq != NULL) && (AdcAcq->Config.hadc == hadc))
+  {
+    ADC_Acq_Process(AdcAcq, 1U);
+  }
+}
+
+/**
+  * @brief  ADC or DMA error
+  * @param  hadc: ADC handle
+  * @retval None
+  */
+void HAL_ADC_ErrorCallback(ADC_HandleTypeDef *hadc)
+{
+  if ((AdcAcq != NULL) && (AdcAcq->Config.hadc == hadc))
+  {
+    AdcAcq->Errors++;
+    ADC_Acq_ErrorCallback(AdcAcq);
+  }
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Timer period from SampleRate and TRGO on update
+  * @param  pAcq: engine context
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef ADC_Acq_TimerInit(ADC_AcqTypeDef *pAcq)
+{
+  TIM_HandleTypeDef *htim = pAcq->Config.htim;
+  TIM_MasterConfigTypeDef master;
+  uint32_t clock;
+  uint32_t ticks;
+  uint32_t prescaler;
+  uint32_t period;
+
+  if (ADC_ACQ_TIM_APB2(htim->Instance))
+  {
+    clock = HAL_RCC_GetPCLK2Freq();
+    clock *= ((RCC->CFGR & RCC_CFGR_PPRE2) == RCC_CFGR_PPRE2_DIV1) ? 1U : 2U;
+  }
+  else
+  {
+    clock = HAL_RCC_GetPCLK1Freq();
+    clock *= ((RCC->CFGR & RCC_CFGR_PPRE1) == RCC_CFGR_PPRE1_DIV1) ? 1U : 2U;
+  }
+
+  if ((pAcq->Config.SampleRate == 0U) || (pAcq->Config.SampleRate > clock))
+  {
+    return HAL_ERROR;
+  }
+
+  ticks = clock / pAcq->Config.SampleRate;
+  prescaler = (ticks - 1U) / 0x10000U;
+  period = (ticks / (prescaler + 1U)) - 1U;
+  if (prescaler > 0xFFFFU)
+  {
+    return HAL_ERROR;
+  }
+
+  __HAL_TIM_SET_PRESCALER(htim, prescaler);
+  __HAL_TIM_SET_AUTORELOAD(htim, period);
+  htim->Init.Prescaler = prescaler;
+  htim->Init.Period = period;
+  pAcq->SampleRate = clock / ((prescaler + 1U) * (period + 1U));
+
+  master.MasterOutputTrigger = TIM_TRGO_UPDATE;
+  master.MasterSlaveMode = TIM_MASTERSLAVEMODE_DISABLE;
+
+  return HAL_TIMEx_MasterConfigSynchronization(htim, &master);
+}
+
+/**
+  * @brief  De-interleave and decimate a half ring into the channel blocks
+  * @param  pAcq: engine context
+  * @param  Half: 0 first half, 1 second half
+  * @retval None
+  */
+static void ADC_Acq_Process(ADC_AcqTypeDef *pAcq, uint32_t Half)
+{
+  const uint32_t stride = pAcq->NbChannels;
+  const uint32_t decimation = pAcq->Config.Decimation;
+  const uint16_t *pHalf = &pAcq->Config.pRing[Half * pAcq->Config.BlockSize * stride];
+  const uint16_t *pSrc;
+  int16_t *pDst;
+  uint32_t remaining;
+  uint32_t channel;
+  uint32_t i;
+  uint32_t k;
+  uint32_t sum;
+
+  for (channel = 0U; channel < stride; channel++)
+  {
+    pSrc = &pHalf[channel];
+    pDst = &pAcq->Config.pOut[channel * pAcq->OutLength];
+
+#if defined(ADC_ACQ_USE_CMSIS_DSP)
+    if (pAcq->Config.pFir != NULL)
+    {
+      for (i = 0U; i < pAcq->Config.BlockSize; i++)
+      {
+        pAcq->Config.pScratch[i] = (q15_t)(((int32_t)*pSrc - (int32_t)pAcq->Midscale) << pAcq->Shift);
+        pSrc += stride;
+      }
+      arm_fir_decimate_q15(&pAcq->Config.pFir[channel], pAcq->Config.pScratch, pDst, pAcq->Config.BlockSize);
+      continue;
+    }
+#endif
+
+    if (decimation == 1U)
+    {
+      for (i = 0U; i < pAcq->OutLength; i++)
+      {
+        pDst[i] = (int16_t)*pSrc;
+        pSrc += stride;
+      }
+    }
+    else
+    {
+      for (i = 0U; i < pAcq->OutLength; i++)
+      {
+        sum = 0U;
+        for (k = 0U; k < decimation; k++)
+        {
+          sum += *pSrc;
+          pSrc += stride;
+        }
+        pDst[i] = (int16_t)(sum / decimation);
+      }
+    }
+  }
+
+  /* The DMA must still be in the other half */
+  remaining = __HAL_DMA_GET_COUNTER(pAcq->Config.hadc->DMA_Handle);
+  if ((Half == 0U) ? (remaining > (pAcq->RingLength / 2U)) : (remaining <= (pAcq->RingLength / 2U)))
+  {
+    pAcq->Overruns++;
+  }
+
+  pAcq->Blocks++;
+  ADC_Acq_BlockCallback(pAcq, pAcq->Config.pOut, pAcq->OutLength);
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,107 @@
+/**
+  ******************************************************************************
+  * @file    adc_acq.h
+  * @author  MCD Application Team
+  * @brief   Header for adc_acq module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _ADC_ACQ_H__
+#define _ADC_ACQ_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#if !defined(HAL_ADC_MODULE_ENABLED) || !defined(HAL_DMA_MODULE_ENABLED) || !defined(HAL_TIM_MODULE_ENABLED)
+#error "adc_acq requires the HAL ADC, DMA and TIM drivers"
+#endif
+
+#if defined(ADC_ACQ_USE_CMSIS_DSP)
+#include "arm_math.h"
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  ADC_HandleTypeDef   *hadc;          /* Master ADC: HAL_ADC_Init() and regular ranks done,
+                                         external trigger, DMA continuous requests          */
+  ADC_HandleTypeDef   *hadcSlave[2];  /* Slave ADCs with the same number of ranks, NULL: none */
+  TIM_HandleTypeDef   *htim;          /* Trigger timer, NULL: trigger started by the user   */
+  uint32_t            SampleRate;     /* Sequences per second, sets up htim                  */
+  uint16_t            *pRing;         /* DMA ring: 2 * BlockSize * channels half-words       */
+  uint32_t            BlockSize;      /* Sequences per half ring                             */
+  uint32_t            Decimation;     /* Samples averaged per output sample, 1: none         */
+  int16_t             *pOut;          /* Channel blocks: channels * BlockSize / Decimation   */
+#if defined(ADC_ACQ_USE_CMSIS_DSP)
+  arm_fir_decimate_instance_q15 *pFir; /* One per channel, used instead of the averaging,
+                                          NULL: averaging                                    */
+  q15_t               *pScratch;      /* BlockSize samples                                   */
+#endif
+} ADC_Acq_ConfigTypeDef;
+
+typedef struct
+{
+  ADC_Acq_ConfigTypeDef Config;
+  uint32_t            NbAdc;          /* ADCs converting simultaneously                      */
+  uint32_t            NbChannels;     /* NbAdc * ranks                                       */
+  uint32_t            OutLength;      /* Output samples per channel and per block            */
+  uint32_t            RingLength;     /* DMA transfers in the ring                           */
+  uint32_t            Midscale;       /* Raw code of 0 in q15                                */
+  uint32_t            Shift;          /* Raw code to q15                                     */
+  uint32_t            SampleRate;     /* Sequences per second set in the timer               */
+  uint32_t            Blocks;         /* Blocks delivered                                    */
+  uint32_t            Overruns;       /* Half rings rewritten by the DMA while processed     */
+  uint32_t            Errors;         /* ADC or DMA errors                                   */
+} ADC_AcqTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef ADC_Acq_Init(ADC_AcqTypeDef *pAcq, const ADC_Acq_ConfigTypeDef *pConfig);
+HAL_StatusTypeDef ADC_Acq_Start(ADC_AcqTypeDef *pAcq);
+HAL_StatusTypeDef ADC_Acq_Stop(ADC_AcqTypeDef *pAcq);
+
+void ADC_Acq_BlockCallback(ADC_AcqTypeDef *pAcq, const int16_t *pBlocks, uint32_t Length);
+void ADC_Acq_ErrorCallback(ADC_AcqTypeDef *pAcq);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _ADC_ACQ_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,118 @@
+/**
+  ******************************************************************************
+  * @file    audio_duplex.h
+  * @author  MCD Application Team
+  * @brief   Header for audio_duplex module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _AUDIO_DUPLEX_H__
+#define _AUDIO_DUPLEX_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#if !defined(SAI1)
+#error "audio_duplex requires a SAI"
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+/* Largest processing block, in frames. Override in main.h. */
+#if !defined(AUDIO_DUPLEX_MAX_BLOCK)
+#define AUDIO_DUPLEX_MAX_BLOCK     64U
+#endif
+/* Largest number of slots (samples) per frame. Override in main.h. */
+#if !defined(AUDIO_DUPLEX_MAX_CHANNELS)
+#define AUDIO_DUPLEX_MAX_CHANNELS  2U
+#endif
+
+/* Latency returned by AUDIO_Duplex_LatencyCallback() when no impulse came back */
+#define AUDIO_DUPLEX_LATENCY_TIMEOUT  0xFFFFFFFFU
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+  AUDIO_DUPLEX_STATE_RESET = 0U,  /* Not initialized                  */
+  AUDIO_DUPLEX_STATE_READY = 1U,  /* Initialized, streaming stopped   */
+  AUDIO_DUPLEX_STATE_BUSY  = 2U,  /* Streaming                        */
+  AUDIO_DUPLEX_STATE_ERROR = 3U   /* SAI or DMA error, stream stopped */
+} AUDIO_Duplex_StateTypeDef;
+
+typedef struct
+{
+  SAI_HandleTypeDef *hsai_tx;   /* Transmitter, master or synchronous, initialized by the user */
+  SAI_HandleTypeDef *hsai_rx;   /* Receiver, synchronous to the transmitter (same frame clock) */
+  uint32_t AudioFreq;           /* Frame rate, in Hz                                            */
+  uint32_t Channels;            /* 16-bit slots per frame, 1 to AUDIO_DUPLEX_MAX_CHANNELS       */
+  uint32_t BlockSize;           /* Frames per processing block, 16 to AUDIO_DUPLEX_MAX_BLOCK    */
+} AUDIO_Duplex_InitTypeDef;
+
+typedef struct
+{
+  uint32_t Blocks;        /* Blocks processed                                            */
+  uint32_t LateBlocks;    /* Blocks whose processing overran the next DMA half           */
+  uint32_t Latency;       /* Input to output frames through the MCU, codec excluded      */
+  uint32_t CyclesLast;    /* CPU cycles of the last processing callback                  */
+  uint32_t CyclesMax;     /* Longest processing callback, in CPU cycles                  */
+  uint32_t CyclesBudget;  /* CPU cycles per block period                                 */
+} AUDIO_Duplex_StatsTypeDef;
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef         AUDIO_Duplex_Init(const AUDIO_Duplex_InitTypeDef *pInit);
+HAL_StatusTypeDef         AUDIO_Duplex_DeInit(void);
+HAL_StatusTypeDef         AUDIO_Duplex_Start(void);
+HAL_StatusTypeDef         AUDIO_Duplex_Stop(void);
+AUDIO_Duplex_StateTypeDef AUDIO_Duplex_GetState(void);
+void                      AUDIO_Duplex_GetStats(AUDIO_Duplex_StatsTypeDef *pStats);
+void                      AUDIO_Duplex_ResetStats(void);
+HAL_StatusTypeDef         AUDIO_Duplex_MeasureLatency(int16_t Threshold);
+
+void AUDIO_Duplex_TX_DMA_IRQHandler(void);
+void AUDIO_Duplex_RX_DMA_IRQHandler(void);
+void AUDIO_Duplex_SAI_IRQHandler(void);
+
+void AUDIO_Duplex_ProcessCallback(const int16_t *pIn, int16_t *pOut, uint32_t FrameNbr);
+void AUDIO_Duplex_LatencyCallback(uint32_t Frames);
+void AUDIO_Duplex_ErrorCallback(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _AUDIO_DUPLEX_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
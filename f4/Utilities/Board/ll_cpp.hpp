@@ -0,0 +1,859 @@
+/**
+  ******************************************************************************
+  * @file    ll_cpp.hpp
+  * @author  MCD Application Team
+  * @brief   Header-only C++17 drivers over the LL: USART, SPI and DMA instances
+  *          resolved at compile time.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- include it from C++17 code, LL drivers enabled (USE_FULL_LL_DRIVER not
+   required: only the static inline LL functions are used). Each driver is
+   a class template whose parameters are the instance base address, the
+   clocks, the pins, the DMA streams and the buffer sizes:
+      using Console = ll::Uart<USART2_BASE, 42000000U, 115200U,
+                               ll::AfPin<GPIOA_BASE, 2U, 7U>,
+                               ll::AfPin<GPIOA_BASE, 3U, 7U>, 256U, 64U>;
+      extern "C" void USART2_IRQHandler(void) { Console::irq(); }
+      ...
+      Console::init();
+      Console::write(msg, len);
+   All the members are static: there is no handle and no virtual call, the
+   register addresses, baud rate divider, IRQ numbers and DMA channels are
+   constants, and the interrupt body is inlined in the handler.
+
+2- static_assert rejects at compile time: a baud rate the clock cannot
+   give, a USART pin on another alternate function than the one of the
+   USART, a ring size not a power of 2, a SPI divider not a power of 2
+   from 2 to 256, and a DMA stream without the request of the peripheral
+   (mapping of RM0090 tables 42 and 43, the STM32F4 lines with other
+   mappings need their own table).
+
+3- Uart: interrupt driven, Tx and Rx rings of TxSize and RxSize bytes.
+   write() and read() never wait and return the bytes taken or given;
+   errors() counts the overruns and the bytes lost on a full Rx ring.
+
+4- UartDma: Rx by circular DMA into a ring of RxSize bytes read with
+   read(), Tx by DMA from the caller buffer, kept untouched until busy()
+   returns false; TxDone::call() is called from the Tx stream interrupt.
+   Wire the Tx DMA stream handler to txIrq().
+
+5- SpiMaster: 8-bit full duplex master with software NSS, polled
+   transfers. SpiDma adds DMA transfers of one SpiMaster: start() never
+   waits, Done::call() is called from the Rx stream interrupt, wired to
+   irq(). A NULL Tx buffer sends 0xFF, a NULL Rx buffer drops the data.
+
+6- DMA buffers must be in SRAM1/SRAM2 (not the CCM RAM), static members of
+   the templates are placed in .bss like any static variable.
+*******************************************************************************/
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _LL_CPP_HPP__
+#define _LL_CPP_HPP__
+
+#if !defined(__cplusplus) || (__cplusplus < 201703L)
+#error "ll_cpp.hpp requires C++17"
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "stm32f4xx_ll_bus.h"
+#include "stm32f4xx_ll_dma.h"
+#include "stm32f4xx_ll_gpio.h"
+#include "stm32f4xx_ll_spi.h"
+#include "stm32f4xx_ll_usart.h"
+
+namespace ll
+{
+
+/* Exported constants --------------------------------------------------------*/
+/* Default NVIC preemption priority of the drivers. Override in main.h. */
+#if !defined(LL_CPP_IRQ_PRIORITY)
+#define LL_CPP_IRQ_PRIORITY      5U
+#endif
+
+/* Private definitions -------------------------------------------------------*/
+namespace detail
+{
+
+constexpr bool IsPow2(uint32_t Value)
+{
+  return (Value != 0U) && ((Value & (Value - 1U)) == 0U);
+}
+
+constexpr uint32_t Log2(uint32_t Value)
+{
+  return (Value <= 1U) ? 0U : (1U + Log2(Value >> 1));
+}
+
+enum class Dir : uint32_t
+{
+  Rx,
+  Tx
+};
+
+struct DmaRoute
+{
+  uint32_t Periph;
+  Dir      Direction;
+  uint32_t Dma;
+  uint32_t Stream;
+  uint32_t Channel;
+};
+
+/* DMA requests, RM0090 tables 42 and 43 */
+constexpr DmaRoute DmaRoutes[] =
+{
+#if defined(SPI3)
+  { SPI3_BASE,   Dir::Rx, DMA1_BASE, 0U, 0U }, { SPI3_BASE,   Dir::Rx, DMA1_BASE, 2U, 0U },
+  { SPI3_BASE,   Dir::Tx, DMA1_BASE, 5U, 0U }, { SPI3_BASE,   Dir::Tx, DMA1_BASE, 7U, 0U },
+#endif
+  { SPI2_BASE,   Dir::Rx, DMA1_BASE, 3U, 0U }, { SPI2_BASE,   Dir::Tx, DMA1_BASE, 4U, 0U },
+#if defined(UART5)
+  { UART5_BASE,  Dir::Rx, DMA1_BASE, 0U, 4U }, { UART5_BASE,  Dir::Tx, DMA1_BASE, 7U, 4U },
+#endif
+#if defined(USART3)
+  { USART3_BASE, Dir::Rx, DMA1_BASE, 1U, 4U }, { USART3_BASE, Dir::Tx, DMA1_BASE, 3U, 4U },
+  { USART3_BASE, Dir::Tx, DMA1_BASE, 4U, 7U },
+#endif
+#if defined(UART4)
+  { UART4_BASE,  Dir::Rx, DMA1_BASE, 2U, 4U }, { UART4_BASE,  Dir::Tx, DMA1_BASE, 4U, 4U },
+#endif
+  { USART2_BASE, Dir::Rx, DMA1_BASE, 5U, 4U }, { USART2_BASE, Dir::Tx, DMA1_BASE, 6U, 4U },
+#if defined(UART7)
+  { UART7_BASE,  Dir::Rx, DMA1_BASE, 3U, 5U }, { UART7_BASE,  Dir::Tx, DMA1_BASE, 1U, 5U },
+#endif
+#if defined(UART8)
+  { UART8_BASE,  Dir::Rx, DMA1_BASE, 6U, 5U }, { UART8_BASE,  Dir::Tx, DMA1_BASE, 0U, 5U },
+#endif
+#if defined(SPI6)
+  { SPI6_BASE,   Dir::Rx, DMA2_BASE, 6U, 1U }, { SPI6_BASE,   Dir::Tx, DMA2_BASE, 5U, 1U },
+#endif
+#if defined(SPI5)
+  { SPI5_BASE,   Dir::Rx, DMA2_BASE, 3U, 2U }, { SPI5_BASE,   Dir::Tx, DMA2_BASE, 4U, 2U },
+  { SPI5_BASE,   Dir::Rx, DMA2_BASE, 6U, 7U }, { SPI5_BASE,   Dir::Tx, DMA2_BASE, 5U, 7U },
+#endif
+  { SPI1_BASE,   Dir::Rx, DMA2_BASE, 0U, 3U }, { SPI1_BASE,   Dir::Rx, DMA2_BASE, 2U, 3U },
+  { SPI1_BASE,   Dir::Tx, DMA2_BASE, 3U, 3U }, { SPI1_BASE,   Dir::Tx, DMA2_BASE, 5U, 3U },
+#if defined(SPI4)
+  { SPI4_BASE,   Dir::Rx, DMA2_BASE, 0U, 4U }, { SPI4_BASE,   Dir::Tx, DMA2_BASE, 1U, 4U },
+  { SPI4_BASE,   Dir::Rx, DMA2_BASE, 3U, 5U }, { SPI4_BASE,   Dir::Tx, DMA2_BASE, 4U, 5U },
+#endif
+  { USART1_BASE, Dir::Rx, DMA2_BASE, 2U, 4U }, { USART1_BASE, Dir::Rx, DMA2_BASE, 5U, 4U },
+  { USART1_BASE, Dir::Tx, DMA2_BASE, 7U, 4U },
+  { USART6_BASE, Dir::Rx, DMA2_BASE, 1U, 5U }, { USART6_BASE, Dir::Rx, DMA2_BASE, 2U, 5U },
+  { USART6_BASE, Dir::Tx, DMA2_BASE, 6U, 5U }, { USART6_BASE, Dir::Tx, DMA2_BASE, 7U, 5U },
+};
+
+/* Channel of a peripheral request on a stream, 0xFF if none */
+constexpr uint32_t DmaChannel(uint32_t Periph, Dir Direction, uint32_t Dma, uint32_t Stream)
+{
+  for (const DmaRoute &route : DmaRoutes)
+  {
+    if ((route.Periph == Periph) && (route.Direction == Direction) &&
+        (route.Dma == Dma) && (route.Stream == Stream))
+    {
+      return route.Channel;
+    }
+  }
+  return 0xFFU;
+}
+
+/* Stream interrupts: DMA1 stream 7 and DMA2 streams 5 to 7 are apart */
+constexpr IRQn_Type DmaIrq(uint32_t Dma, uint32_t Stream)
+{
+  return (Dma == DMA1_BASE) ?
+         ((Stream < 7U) ? static_cast<IRQn_Type>(DMA1_Stream0_IRQn + Stream) : DMA1_Stream7_IRQn) :
+         ((Stream < 5U) ? static_cast<IRQn_Type>(DMA2_Stream0_IRQn + Stream) :
+                          static_cast<IRQn_Type>(DMA2_Stream5_IRQn + (Stream - 5U)));
+}
+
+/* Position of the flags of a stream in LISR/HISR */
+constexpr uint32_t DmaFlagShift(uint32_t Stream)
+{
+  return ((Stream & 3U) == 0U) ? 0U : ((Stream & 3U) == 1U) ? 6U : ((Stream & 3U) == 2U) ? 16U : 22U;
+}
+
+} /* namespace detail */
+
+/* Exported types ------------------------------------------------------------*/
+/* Compile-time callback doing nothing */
+struct NoCallback
+{
+  static void call()
+  {
+  }
+};
+
+/* Pin in alternate function, push-pull */
+template <uint32_t PortBase, uint32_t Pin, uint32_t Af,
+          uint32_t Pull = LL_GPIO_PULL_NO, uint32_t Speed = LL_GPIO_SPEED_FREQ_VERY_HIGH>
+struct AfPin
+{
+  static_assert((PortBase >= GPIOA_BASE) && (((PortBase - GPIOA_BASE) % 0x400U) == 0U) &&
+                (((PortBase - GPIOA_BASE) / 0x400U) < 11U), "not a GPIO port");
+  static_assert(Pin < 16U, "pin number out of range");
+  static_assert(Af < 16U, "alternate function out of range");
+
+  static constexpr uint32_t af   = Af;
+  static constexpr uint32_t mask = 1UL << Pin;
+
+  static GPIO_TypeDef *port()
+  {
+    return reinterpret_cast<GPIO_TypeDef *>(PortBase);
+  }
+
+  static void init()
+  {
+    LL_AHB1_GRP1_EnableClock(LL_AHB1_GRP1_PERIPH_GPIOA << ((PortBase - GPIOA_BASE) / 0x400U));
+    LL_GPIO_SetPinSpeed(port(), mask, Speed);
+    LL_GPIO_SetPinOutputType(port(), mask, LL_GPIO_OUTPUT_PUSHPULL);
+    LL_GPIO_SetPinPull(port(), mask, Pull);
+    if constexpr (Pin < 8U)
+    {
+      LL_GPIO_SetAFPin_0_7(port(), mask, Af);
+    }
+    else
+    {
+      LL_GPIO_SetAFPin_8_15(port(), mask, Af);
+    }
+    LL_GPIO_SetPinMode(port(), mask, LL_GPIO_MODE_ALTERNATE);
+  }
+};
+
+/* Unused signal: receive only UART, transmit only SPI... */
+struct NoPin
+{
+  static constexpr uint32_t af = 0xFFU;
+
+  static void init()
+  {
+  }
+};
+
+/* Single producer, single consumer byte ring, Size a power of 2 */
+template <uint32_t Size>
+class Ring
+{
+  static_assert(detail::IsPow2(Size), "ring size not a power of 2");
+
+public:
+  bool push(uint8_t Data)
+  {
+    uint32_t head = head_;
+
+    if ((head - tail_) == Size)
+    {
+      return false;
+    }
+    buffer_[head & (Size - 1U)] = Data;
+    __DMB();
+    head_ = head + 1U;
+    return true;
+  }
+
+  bool pop(uint8_t &Data)
+  {
+    uint32_t tail = tail_;
+
+    if (head_ == tail)
+    {
+      return false;
+    }
+    Data = buffer_[tail & (Size - 1U)];
+    __DMB();
+    tail_ = tail + 1U;
+    return true;
+  }
+
+  uint32_t count() const
+  {
+    return head_ - tail_;
+  }
+
+private:
+  uint8_t           buffer_[Size] = {};
+  volatile uint32_t head_ = 0U;
+  volatile uint32_t tail_ = 0U;
+};
+
+/* USART instances: clock, interrupt, alternate function */
+template <uint32_t Base>
+struct UsartTraits;   /* Not defined: not a USART of this device */
+
+#define LL_CPP_USART_TRAITS(__NAME__, __BUS__, __AF__)                        \
+  template <>                                                                 \
+  struct UsartTraits<__NAME__##_BASE>                                         \
+  {                                                                           \
+    static constexpr IRQn_Type irqn = __NAME__##_IRQn;                        \
+    static constexpr uint32_t  af   = (__AF__);                               \
+    static void enableClock()                                                 \
+    {                                                                         \
+      LL_##__BUS__##_GRP1_EnableClock(LL_##__BUS__##_GRP1_PERIPH_##__NAME__); \
+    }                                                                         \
+  }
+
+LL_CPP_USART_TRAITS(USART1, APB2, 7U);
+LL_CPP_USART_TRAITS(USART2, APB1, 7U);
+#if defined(USART3)
+LL_CPP_USART_TRAITS(USART3, APB1, 7U);
+#endif
+#if defined(UART4)
+LL_CPP_USART_TRAITS(UART4,  APB1, 8U);
+#endif
+#if defined(UART5)
+LL_CPP_USART_TRAITS(UART5,  APB1, 8U);
+#endif
+LL_CPP_USART_TRAITS(USART6, APB2, 8U);
+#if defined(UART7)
+LL_CPP_USART_TRAITS(UART7,  APB1, 8U);
+#endif
+#if defined(UART8)
+LL_CPP_USART_TRAITS(UART8,  APB1, 8U);
+#endif
+
+#undef LL_CPP_USART_TRAITS
+
+/* SPI instances: clock. The alternate function depends on the pin. */
+template <uint32_t Base>
+struct SpiTraits;     /* Not defined: not a SPI of this device */
+
+#define LL_CPP_SPI_TRAITS(__NAME__, __BUS__)                                  \
+  template <>                                                                 \
+  struct SpiTraits<__NAME__##_BASE>                                           \
+  {                                                                           \
+    static void enableClock()                                                 \
+    {                                                                         \
+      LL_##__BUS__##_GRP1_EnableClock(LL_##__BUS__##_GRP1_PERIPH_##__NAME__); \
+    }                                                                         \
+  }
+
+LL_CPP_SPI_TRAITS(SPI1, APB2);
+LL_CPP_SPI_TRAITS(SPI2, APB1);
+#if defined(SPI3)
+LL_CPP_SPI_TRAITS(SPI3, APB1);
+#endif
+#if defined(SPI4)
+LL_CPP_SPI_TRAITS(SPI4, APB2);
+#endif
+#if defined(SPI5)
+LL_CPP_SPI_TRAITS(SPI5, APB2);
+#endif
+#if defined(SPI6)
+LL_CPP_SPI_TRAITS(SPI6, APB2);
+#endif
+
+#undef LL_CPP_SPI_TRAITS
+
+/* DMA stream */
+template <uint32_t DmaBase, uint32_t Stream>
+struct DmaStream
+{
+  static_assert((DmaBase == DMA1_BASE) || (DmaBase == DMA2_BASE), "not a DMA controller");
+  static_assert(Stream < 8U, "stream number out of range");
+
+  static constexpr uint32_t  dma    = DmaBase;
+  static constexpr uint32_t  stream = Stream;
+  static constexpr IRQn_Type irqn   = detail::DmaIrq(DmaBase, Stream);
+  static constexpr uint32_t  flagTC = DMA_LISR_TCIF0 << detail::DmaFlagShift(Stream);
+  static constexpr uint32_t  flagTE = DMA_LISR_TEIF0 << detail::DmaFlagShift(Stream);
+  static constexpr uint32_t  flags  = (DMA_LISR_FEIF0 | DMA_LISR_DMEIF0 | DMA_LISR_TEIF0 |
+                                       DMA_LISR_HTIF0 | DMA_LISR_TCIF0) << detail::DmaFlagShift(Stream);
+
+  static DMA_TypeDef *regs()
+  {
+    return reinterpret_cast<DMA_TypeDef *>(DmaBase);
+  }
+
+  static void enableClock()
+  {
+    LL_AHB1_GRP1_EnableClock((DmaBase == DMA1_BASE) ? LL_AHB1_GRP1_PERIPH_DMA1 : LL_AHB1_GRP1_PERIPH_DMA2);
+  }
+
+  static uint32_t getFlags()
+  {
+    return ((Stream < 4U) ? READ_REG(regs()->LISR) : READ_REG(regs()->HISR)) & flags;
+  }
+
+  static void clearFlags(uint32_t Flags = flags)
+  {
+    if constexpr (Stream < 4U)
+    {
+      WRITE_REG(regs()->LIFCR, Flags);
+    }
+    else
+    {
+      WRITE_REG(regs()->HIFCR, Flags);
+    }
+  }
+
+  /* Stream disabled, then programmed: Config of LL_DMA_ConfigTransfer() */
+  static void setup(uint32_t Channel, uint32_t Config, uint32_t Periph)
+  {
+    LL_DMA_DisableStream(regs(), Stream);
+    while (LL_DMA_IsEnabledStream(regs(), Stream) != 0U)
+    {
+    }
+    clearFlags();
+    LL_DMA_SetChannelSelection(regs(), Stream, Channel);
+    LL_DMA_ConfigTransfer(regs(), Stream, Config);
+    LL_DMA_SetPeriphAddress(regs(), Stream, Periph);
+  }
+
+  static void start(uint32_t Memory, uint32_t Length)
+  {
+    LL_DMA_SetMemoryAddress(regs(), Stream, Memory);
+    LL_DMA_SetDataLength(regs(), Stream, Length);
+    LL_DMA_EnableStream(regs(), Stream);
+  }
+
+  static uint32_t remaining()
+  {
+    return LL_DMA_GetDataLength(regs(), Stream);
+  }
+};
+
+/* Request of a peripheral on a stream, checked at compile time */
+template <uint32_t Periph, detail::Dir Direction, class Dma>
+struct DmaRequest
+{
+  static constexpr uint32_t number = detail::DmaChannel(Periph, Direction, Dma::dma, Dma::stream);
+  static_assert(number != 0xFFU, "no request of the peripheral on this DMA stream");
+
+  /* LL_DMA_CHANNEL_x */
+  static constexpr uint32_t channel = number << DMA_SxCR_CHSEL_Pos;
+};
+
+/* Interrupt driven UART, 8N1, oversampling by 16 */
+template <uint32_t Base, uint32_t PclkHz, uint32_t Baud, class TxPin, class RxPin,
+          uint32_t TxSize = 64U, uint32_t RxSize = 64U, uint32_t Priority = LL_CPP_IRQ_PRIORITY>
+class Uart
+{
+  using Traits = UsartTraits<Base>;
+
+  static constexpr uint32_t brr = (PclkHz + (Baud / 2U)) / Baud;
+
+  static_assert((Baud != 0U) && ((PclkHz / Baud) >= 16U), "baud rate too high for the USART clock");
+  static_assert(brr <= 0xFFFFU, "baud rate too low for the USART clock");
+  static_assert((TxPin::af == Traits::af) || (TxPin::af == NoPin::af), "TX pin not on the USART alternate function");
+  static_assert((RxPin::af == Traits::af) || (RxPin::af == NoPin::af), "RX pin not on the USART alternate function");
+  static_assert(Priority < (1UL << __NVIC_PRIO_BITS), "interrupt priority out of range");
+
+public:
+  static USART_TypeDef *regs()
+  {
+    return reinterpret_cast<USART_TypeDef *>(Base);
+  }
+
+  static void init()
+  {
+    Traits::enableClock();
+    TxPin::init();
+    RxPin::init();
+
+    LL_USART_Disable(regs());
+    LL_USART_ConfigCharacter(regs(), LL_USART_DATAWIDTH_8B, LL_USART_PARITY_NONE, LL_USART_STOPBITS_1);
+    LL_USART_SetTransferDirection(regs(), LL_USART_DIRECTION_TX_RX);
+    WRITE_REG(regs()->BRR, brr);
+    LL_USART_EnableIT_RXNE(regs());
+
+    NVIC_SetPriority(Traits::irqn, Priority);
+    NVIC_EnableIRQ(Traits::irqn);
+    LL_USART_Enable(regs());
+  }
+
+  /* Bytes queued, up to the free space of the Tx ring */
+  static uint32_t write(const uint8_t *pData, uint32_t Size)
+  {
+    uint32_t count = 0U;
+
+    while ((count < Size) && tx_.push(pData[count]))
+    {
+      count++;
+    }
+    if (count != 0U)
+    {
+      LL_USART_EnableIT_TXE(regs());
+    }
+    return count;
+  }
+
+  /* Bytes received, up to Size */
+  static uint32_t read(uint8_t *pData, uint32_t Size)
+  {
+    uint32_t count = 0U;
+
+    while ((count < Size) && rx_.pop(pData[count]))
+    {
+      count++;
+    }
+    return count;
+  }
+
+  static uint32_t available()
+  {
+    return rx_.count();
+  }
+
+  static uint32_t errors()
+  {
+    return errors_;
+  }
+
+  /* Body of the USART interrupt handler */
+  static void irq()
+  {
+    uint32_t sr = READ_REG(regs()->SR);
+    uint8_t  data;
+
+    /* Reading DR after SR also clears ORE, NE, FE and PE */
+    if ((sr & (USART_SR_RXNE | USART_SR_ORE)) != 0U)
+    {
+      data = LL_USART_ReceiveData8(regs());
+      if (((sr & USART_SR_ORE) != 0U) || !rx_.push(data))
+      {
+        errors_ = errors_ + 1U;
+      }
+    }
+
+    if (((sr & USART_SR_TXE) != 0U) && (LL_USART_IsEnabledIT_TXE(regs()) != 0U))
+    {
+      if (tx_.pop(data))
+      {
+        LL_USART_TransmitData8(regs(), data);
+      }
+      else
+      {
+        LL_USART_DisableIT_TXE(regs());
+      }
+    }
+  }
+
+private:
+  static inline Ring<TxSize>      tx_;
+  static inline Ring<RxSize>      rx_;
+  static inline volatile uint32_t errors_ = 0U;
+};
+
+/* UART with DMA: circular Rx ring, Tx from the caller buffer */
+template <uint32_t Base, uint32_t PclkHz, uint32_t Baud, class TxPin, class RxPin,
+          class TxDma, class RxDma, uint32_t RxSize = 64U, class TxDone = NoCallback,
+          uint32_t Priority = LL_CPP_IRQ_PRIORITY>
+class UartDma
+{
+  using Traits = UsartTraits<Base>;
+  using TxReq  = DmaRequest<Base, detail::Dir::Tx, TxDma>;
+  using RxReq  = DmaRequest<Base, detail::Dir::Rx, RxDma>;
+
+  static constexpr uint32_t brr = (PclkHz + (Baud / 2U)) / Baud;
+
+  static_assert((Baud != 0U) && ((PclkHz / Baud) >= 16U), "baud rate too high for the USART clock");
+  static_assert(brr <= 0xFFFFU, "baud rate too low for the USART clock");
+  static_assert((TxPin::af == Traits::af) || (TxPin::af == NoPin::af), "TX pin not on the USART alternate function");
+  static_assert((RxPin::af == Traits::af) || (RxPin::af == NoPin::af), "RX pin not on the USART alternate function");
+  static_assert(detail::IsPow2(RxSize) && (RxSize <= 0x8000U), "Rx ring size not a power of 2 up to 32 KB");
+  static_assert(Priority < (1UL << __NVIC_PRIO_BITS), "interrupt priority out of range");
+
+public:
+  static USART_TypeDef *regs()
+  {
+    return reinterpret_cast<USART_TypeDef *>(Base);
+  }
+
+  static void init()
+  {
+    uint32_t dr = LL_USART_DMA_GetRegAddr(regs());
+
+    Traits::enableClock();
+    TxPin::init();
+    RxPin::init();
+    TxDma::enableClock();
+    RxDma::enableClock();
+
+    LL_USART_Disable(regs());
+    LL_USART_ConfigCharacter(regs(), LL_USART_DATAWIDTH_8B, LL_USART_PARITY_NONE, LL_USART_STOPBITS_1);
+    LL_USART_SetTransferDirection(regs(), LL_USART_DIRECTION_TX_RX);
+    WRITE_REG(regs()->BRR, brr);
+
+    RxDma::setup(RxReq::channel,
+                 LL_DMA_DIRECTION_PERIPH_TO_MEMORY | LL_DMA_MODE_CIRCULAR | LL_DMA_PERIPH_NOINCREMENT |
+                 LL_DMA_MEMORY_INCREMENT | LL_DMA_PDATAALIGN_BYTE | LL_DMA_MDATAALIGN_BYTE | LL_DMA_PRIORITY_HIGH,
+                 dr);
+    RxDma::start(reinterpret_cast<uint32_t>(rxBuffer_), RxSize);
+
+    TxDma::setup(TxReq::channel,
+                 LL_DMA_DIRECTION_MEMORY_TO_PERIPH | LL_DMA_MODE_NORMAL | LL_DMA_PERIPH_NOINCREMENT |
+                 LL_DMA_MEMORY_INCREMENT | LL_DMA_PDATAALIGN_BYTE | LL_DMA_MDATAALIGN_BYTE | LL_DMA_PRIORITY_LOW,
+                 dr);
+    LL_DMA_EnableIT_TC(TxDma::regs(), TxDma::stream);
+    LL_DMA_EnableIT_TE(TxDma::regs(), TxDma::stream);
+    NVIC_SetPriority(TxDma::irqn, Priority);
+    NVIC_EnableIRQ(TxDma::irqn);
+
+    LL_USART_EnableDMAReq_RX(regs());
+    LL_USART_EnableDMAReq_TX(regs());
+    LL_USART_Enable(regs());
+  }
+
+  /* Start sending Size bytes, false while the previous write is in progress */
+  static bool write(const uint8_t *pData, uint32_t Size)
+  {
+    if ((txBusy_ != 0U) || (Size == 0U) || (Size > 0xFFFFU))
+    {
+      return false;
+    }
+    txBusy_ = 1U;
+    TxDma::start(reinterpret_cast<uint32_t>(pData), Size);
+    return true;
+  }
+
+  static bool busy()
+  {
+    return (txBusy_ != 0U);
+  }
+
+  /* Bytes received and not read. Data older than RxSize bytes is lost. */
+  static uint32_t available()
+  {
+    return ((RxSize - RxDma::remaining()) - rxTail_) & (RxSize - 1U);
+  }
+
+  static uint32_t read(uint8_t *pData, uint32_t Size)
+  {
+    uint32_t count = available();
+
+    if (count > Size)
+    {
+      count = Size;
+    }
+    for (uint32_t i = 0U; i < count; i++)
+    {
+      pData[i] = rxBuffer_[rxTail_];
+      rxTail_ = (rxTail_ + 1U) & (RxSize - 1U);
+    }
+    return count;
+  }
+
+  static uint32_t errors()
+  {
+    return errors_;
+  }
+
+  /* Body of the Tx DMA stream interrupt handler */
+  static void txIrq()
+  {
+    uint32_t flags = TxDma::getFlags();
+
+    TxDma::clearFlags(flags);
+    if ((flags & TxDma::flagTE) != 0U)
+    {
+      errors_ = errors_ + 1U;
+    }
+    if ((flags & (TxDma::flagTC | TxDma::flagTE)) != 0U)
+    {
+      txBusy_ = 0U;
+      TxDone::call();
+    }
+  }
+
+private:
+  static inline uint8_t           rxBuffer_[RxSize] = {};
+  static inline uint32_t          rxTail_ = 0U;
+  static inline volatile uint32_t txBusy_ = 0U;
+  static inline volatile uint32_t errors_ = 0U;
+};
+
+/* SPI master, 8-bit full duplex, software NSS. Mode: CPOL << 1 | CPHA */
+template <uint32_t Base, uint32_t Divider, uint32_t Mode, class SckPin, class MisoPin, class MosiPin>
+class SpiMaster
+{
+  using Traits = SpiTraits<Base>;
+
+  static_assert(detail::IsPow2(Divider) && (Divider >= 2U) && (Divider <= 256U),
+                "SPI clock divider not a power of 2 from 2 to 256");
+  static_assert(Mode < 4U, "SPI mode out of range");
+
+public:
+  static constexpr uint32_t base = Base;
+
+  static SPI_TypeDef *regs()
+  {
+    return reinterpret_cast<SPI_TypeDef *>(Base);
+  }
+
+  static void init()
+  {
+    Traits::enableClock();
+    SckPin::init();
+    MisoPin::init();
+    MosiPin::init();
+
+    LL_SPI_Disable(regs());
+    LL_SPI_SetMode(regs(), LL_SPI_MODE_MASTER);
+    LL_SPI_SetBaudRatePrescaler(regs(), (detail::Log2(Divider) - 1U) << SPI_CR1_BR_Pos);
+    LL_SPI_SetClockPolarity(regs(), ((Mode & 2U) != 0U) ? LL_SPI_POLARITY_HIGH : LL_SPI_POLARITY_LOW);
+    LL_SPI_SetClockPhase(regs(), ((Mode & 1U) != 0U) ? LL_SPI_PHASE_2EDGE : LL_SPI_PHASE_1EDGE);
+    LL_SPI_SetTransferDirection(regs(), LL_SPI_FULL_DUPLEX);
+    LL_SPI_SetDataWidth(regs(), LL_SPI_DATAWIDTH_8BIT);
+    LL_SPI_SetNSSMode(regs(), LL_SPI_NSS_SOFT);
+    LL_SPI_Enable(regs());
+  }
+
+  static uint8_t transfer(uint8_t Data)
+  {
+    while (LL_SPI_IsActiveFlag_TXE(regs()) == 0U)
+    {
+    }
+    LL_SPI_TransmitData8(regs(), Data);
+    while (LL_SPI_IsActiveFlag_RXNE(regs()) == 0U)
+    {
+    }
+    return LL_SPI_ReceiveData8(regs());
+  }
+
+  /* pTx NULL: sends 0xFF, pRx NULL: data dropped */
+  static void transfer(const uint8_t *pTx, uint8_t *pRx, uint32_t Size)
+  {
+    for (uint32_t i = 0U; i < Size; i++)
+    {
+      uint8_t data = transfer((pTx != nullptr) ? pTx[i] : 0xFFU);
+
+      if (pRx != nullptr)
+      {
+        pRx[i] = data;
+      }
+    }
+    while (LL_SPI_IsActiveFlag_BSY(regs()) != 0U)
+    {
+    }
+  }
+};
+
+/* DMA transfers of a SpiMaster */
+template <class Spi, class TxDma, class RxDma, class Done = NoCallback,
+          uint32_t Priority = LL_CPP_IRQ_PRIORITY>
+class SpiDma
+{
+  using TxReq = DmaRequest<Spi::base, detail::Dir::Tx, TxDma>;
+  using RxReq = DmaRequest<Spi::base, detail::Dir::Rx, RxDma>;
+
+  static_assert(Priority < (1UL << __NVIC_PRIO_BITS), "interrupt priority out of range");
+
+  static constexpr uint32_t config = LL_DMA_MODE_NORMAL | LL_DMA_PERIPH_NOINCREMENT |
+                                     LL_DMA_PDATAALIGN_BYTE | LL_DMA_MDATAALIGN_BYTE;
+
+public:
+  static void init()
+  {
+    uint32_t dr = LL_SPI_DMA_GetRegAddr(Spi::regs());
+
+    Spi::init();
+    TxDma::enableClock();
+    RxDma::enableClock();
+    TxDma::setup(TxReq::channel, LL_DMA_DIRECTION_MEMORY_TO_PERIPH | config | LL_DMA_PRIORITY_MEDIUM, dr);
+    RxDma::setup(RxReq::channel, LL_DMA_DIRECTION_PERIPH_TO_MEMORY | config | LL_DMA_PRIORITY_HIGH, dr);
+
+    /* The transfer ends with its last received byte */
+    LL_DMA_EnableIT_TC(RxDma::regs(), RxDma::stream);
+    LL_DMA_EnableIT_TE(RxDma::regs(), RxDma::stream);
+    NVIC_SetPriority(RxDma::irqn, Priority);
+    NVIC_EnableIRQ(RxDma::irqn);
+  }
+
+  /* Start a transfer, false while the previous one is in progress */
+  static bool start(const uint8_t *pTx, uint8_t *pRx, uint32_t Size)
+  {
+    if ((busy_ != 0U) || (Size == 0U) || (Size > 0xFFFFU))
+    {
+      return false;
+    }
+    busy_ = 1U;
+
+    LL_DMA_SetMemoryIncMode(TxDma::regs(), TxDma::stream,
+                            (pTx != nullptr) ? LL_DMA_MEMORY_INCREMENT : LL_DMA_MEMORY_NOINCREMENT);
+    LL_DMA_SetMemoryIncMode(RxDma::regs(), RxDma::stream,
+                            (pRx != nullptr) ? LL_DMA_MEMORY_INCREMENT : LL_DMA_MEMORY_NOINCREMENT);
+    TxDma::clearFlags();
+    RxDma::clearFlags();
+
+    LL_SPI_EnableDMAReq_RX(Spi::regs());
+    RxDma::start((pRx != nullptr) ? reinterpret_cast<uint32_t>(pRx) : reinterpret_cast<uint32_t>(&dummy_), Size);
+    TxDma::start((pTx != nullptr) ? reinterpret_cast<uint32_t>(pTx) : reinterpret_cast<uint32_t>(&fill_), Size);
+    LL_SPI_EnableDMAReq_TX(Spi::regs());
+    return true;
+  }
+
+  static bool busy()
+  {
+    return (busy_ != 0U);
+  }
+
+  static uint32_t errors()
+  {
+    return errors_;
+  }
+
+  /* Body of the Rx DMA stream interrupt handler */
+  static void irq()
+  {
+    uint32_t flags = RxDma::getFlags();
+
+    RxDma::clearFlags(flags);
+    if ((flags & (RxDma::flagTC | RxDma::flagTE)) == 0U)
+    {
+      return;
+    }
+    if ((flags & RxDma::flagTE) != 0U)
+    {
+      errors_ = errors_ + 1U;
+      LL_DMA_DisableStream(TxDma::regs(), TxDma::stream);
+    }
+
+    LL_SPI_DisableDMAReq_TX(Spi::regs());
+    LL_SPI_DisableDMAReq_RX(Spi::regs());
+    busy_ = 0U;
+    Done::call();
+  }
+
+private:
+  static inline const uint8_t     fill_  = 0xFFU;
+  static inline uint8_t           dummy_ = 0U;
+  static inline volatile uint32_t busy_  = 0U;
+  static inline volatile uint32_t errors_ = 0U;
+};
+
+} /* namespace ll */
+
+#endif /* _LL_CPP_HPP__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,688 @@
+/**
+  ******************************************************************************
+  * @file    can_queue.c
+  * @author  MCD Application Team
+  * @brief   Interrupt driven bxCAN transmit queue ordered by identifier priority
+  *          and receive ring with per filter statistics, over the HAL CAN driver.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- initialize the CAN with HAL_CAN_Init(), TransmitFifoPriority DISABLE so
+   that the pending mailboxes are sent in identifier order, configure the
+   filters, then call CAN_Queue_Init() with a CAN_QueueTypeDef per instance
+   and HAL_CAN_Start(). Call HAL_CAN_IRQHandler() from the TX, RX0, RX1 and
+   SCE interrupt handlers of the instance, all at the same preemption
+   priority: this module implements the HAL_CAN_TxMailboxXxxCallback(),
+   HAL_CAN_RxFifoXMsgPendingCallback() and HAL_CAN_ErrorCallback()
+   functions in its place.
+
+2- CAN_Queue_Send() never waits for a mailbox: frames are kept in a queue
+   ordered by arbitration priority (identifier, then standard before
+   extended, data before remote), frames of equal identifier in submission
+   order. Each Tx complete interrupt moves the most urgent frame to the
+   free mailbox.
+
+3- priority inversion: when the 3 mailboxes hold frames of lower priority
+   than the head of the queue, the least urgent mailbox is aborted and its
+   frame goes back to the queue. One abort is in progress at a time; a
+   frame already on the bus completes normally.
+
+4- the Rx FIFOs are emptied in their interrupt into a single producer,
+   single consumer ring read by CAN_Queue_Receive() without masking the
+   interrupts. CAN_Queue_RxCallback() is called from the interrupt when
+   frames were added. Frames are counted per Rx FIFO and filter match
+   index, and dropped frames per filter when the ring is full. Hardware
+   FIFO overruns are counted, their bits are cleared from the handle
+   ErrorCode.
+
+5- with automatic retransmission disabled, a frame losing arbitration or
+   hitting an error is dropped and counted in TxErrors.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "can_queue.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#if ((CAN_QUEUE_RX_SIZE & (CAN_QUEUE_RX_SIZE - 1U)) != 0U) || (CAN_QUEUE_RX_SIZE < 2U)
+#error "CAN_QUEUE_RX_SIZE must be a power of 2"
+#endif
+
+#define CAN_QUEUE_ALL_MAILBOXES  (CAN_TX_MAILBOX0 | CAN_TX_MAILBOX1 | CAN_TX_MAILBOX2)
+
+/* Private macro -------------------------------------------------------------*/
+/* CAN_TX_MAILBOXx bit to mailbox number */
+#define CAN_QUEUE_MAILBOX_INDEX(__BIT__)  ((__BIT__) >> 1U)
+
+/* Private variables ---------------------------------------------------------*/
+static CAN_QueueTypeDef *CanQueues[CAN_QUEUE_INSTANCES];
+
+/* Private function prototypes -----------------------------------------------*/
+static CAN_QueueTypeDef *CAN_Queue_Find(CAN_HandleTypeDef *hcan);
+static uint32_t CAN_Queue_Key(const CAN_Queue_FrameTypeDef *pFrame);
+static uint32_t CAN_Queue_Before(const CAN_Queue_TxEntryTypeDef *pA, const CAN_Queue_TxEntryTypeDef *pB);
+static void     CAN_Queue_Push(CAN_QueueTypeDef *pQueue, const CAN_Queue_TxEntryTypeDef *pEntry);
+static void     CAN_Queue_Pop(CAN_QueueTypeDef *pQueue);
+static void     CAN_Queue_Refill(CAN_QueueTypeDef *pQueue);
+static void     CAN_Queue_Preempt(CAN_QueueTypeDef *pQueue);
+static void     CAN_Queue_TxDone(CAN_HandleTypeDef *hcan, uint32_t Mailbox, uint32_t Aborted);
+static void     CAN_Queue_Drain(CAN_HandleTypeDef *hcan, uint32_t RxFifo);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Attach a queue to an initialized CAN instance
+  * @param  pQueue: queue context, kept by the module until CAN_Queue_DeInit()
+  * @param  hcan: CAN handle, HAL_CAN_Init() done
+  * @retval HAL status
+  */
+HAL_StatusTypeDef CAN_Queue_Init(CAN_QueueTypeDef *pQueue, CAN_HandleTypeDef *hcan)
+{
+  uint32_t i;
+  uint32_t slot = CAN_QUEUE_INSTANCES;
+
+  if ((pQueue == NULL) || (hcan == NULL) || (hcan->Init.TransmitFifoPriority != DISABLE))
+  {
+    return HAL_ERROR;
+  }
+
+  for (i = 0U; i < CAN_QUEUE_INSTANCES; i++)
+  {
+    if ((CanQueues[i] != NULL) && (CanQueues[i]->hcan == hcan))
+    {
+      return HAL_BUSY;
+    }
+    if ((CanQueues[i] == NULL) && (slot == CAN_QUEUE_INSTANCES))
+    {
+      slot = i;
+    }
+  }
+  if (slot == CAN_QUEUE_INSTANCES)
+  {
+    return HAL_ERROR;
+  }
+
+  memset(pQueue, 0, sizeof(CAN_QueueTypeDef));
+  pQueue->hcan = hcan;
+  CanQueues[slot] = pQueue;
+
+  if (HAL_CAN_ActivateNotification(hcan, CAN_IT_TX_MAILBOX_EMPTY |
+                                         CAN_IT_RX_FIFO0_MSG_PENDING | CAN_IT_RX_FIFO0_OVERRUN |
+                                         CAN_IT_RX_FIFO1_MSG_PENDING | CAN_IT_RX_FIFO1_OVERRUN) != HAL_OK)
+  {
+    CanQueues[slot] = NULL;
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Detach a queue from its CAN instance. Queued frames are discarded,
+  *         frames already in the mailboxes are still sent.
+  * @param  pQueue: queue context
+  * @retval HAL status
+  */
+HAL_StatusTypeDef CAN_Queue_DeInit(CAN_QueueTypeDef *pQueue)
+{
+  uint32_t i;
+
+  for (i = 0U; i < CAN_QUEUE_INSTANCES; i++)
+  {
+    if (CanQueues[i] == pQueue)
+    {
+      HAL_CAN_DeactivateNotification(pQueue->hcan, CAN_IT_TX_MAILBOX_EMPTY |
+                                                   CAN_IT_RX_FIFO0_MSG_PENDING | CAN_IT_RX_FIFO0_OVERRUN |
+                                                   CAN_IT_RX_FIFO1_MSG_PENDING | CAN_IT_RX_FIFO1_OVERRUN);
+      CanQueues[i] = NULL;
+      return HAL_OK;
+    }
+  }
+
+  return HAL_ERROR;
+}
+
+/**
+  * @brief  Queue a frame for transmission, by identifier priority
+  * @param  pQueue: queue context
+  * @param  pFrame: frame to send, copied
+  * @retval HAL_OK, HAL_BUSY when the queue is full
+  */
+HAL_StatusTypeDef CAN_Queue_Send(CAN_QueueTypeDef *pQueue, const CAN_Queue_FrameTypeDef *pFrame)
+{
+  CAN_Queue_TxEntryTypeDef entry;
+  uint32_t primask;
+
+  if (pFrame->DLC > 8U)
+  {
+    return HAL_ERROR;
+  }
+
+  entry.Key = CAN_Queue_Key(pFrame);
+  entry.Frame = *pFrame;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if (pQueue->TxCount >= CAN_QUEUE_TX_SIZE)
+  {
+    pQueue->Stats.TxRejected++;
+    __set_PRIMASK(primask);
+    return HAL_BUSY;
+  }
+
+  entry.Seq = pQueue->TxSeq++;
+  CAN_Queue_Push(pQueue, &entry);
+  pQueue->Stats.TxQueued++;
+
+  CAN_Queue_Refill(pQueue);
+  CAN_Queue_Preempt(pQueue);
+
+  __set_PRIMASK(primask);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Take the oldest received frame
+  * @param  pQueue: queue context
+  * @param  pFrame: destination
+  * @retval HAL_OK, HAL_ERROR when no frame is available
+  */
+HAL_StatusTypeDef CAN_Queue_Receive(CAN_QueueTypeDef *pQueue, CAN_Queue_FrameTypeDef *pFrame)
+{
+  uint32_t tail = pQueue->RxTail;
+
+  if (pQueue->RxHead == tail)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Read the slot after the head update it was published with */
+  __DMB();
+  *pFrame = pQueue->RxRing[tail & (CAN_QUEUE_RX_SIZE - 1U)];
+  __DMB();
+
+  pQueue->RxTail = tail + 1U;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Number of received frames waiting
+  * @param  pQueue: queue context
+  * @retval Frames
+  */
+uint32_t CAN_Queue_RxAvailable(CAN_QueueTypeDef *pQueue)
+{
+  return pQueue->RxHead - pQueue->RxTail;
+}
+
+/**
+  * @brief  Number of frames not sent yet, mailboxes included
+  * @param  pQueue: queue context
+  * @retval Frames
+  */
+uint32_t CAN_Queue_TxPending(CAN_QueueTypeDef *pQueue)
+{
+  uint32_t primask;
+  uint32_t pending;
+  uint32_t busy;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  busy = pQueue->MailboxBusy;
+  pending = pQueue->TxCount;
+  __set_PRIMASK(primask);
+
+  for (; busy != 0U; busy &= (busy - 1U))
+  {
+    pending++;
+  }
+
+  return pending;
+}
+
+/**
+  * @brief  Copy the statistics
+  * @param  pQueue: queue context
+  * @param  pStats: destination
+  * @retval None
+  */
+void CAN_Queue_GetStats(CAN_QueueTypeDef *pQueue, CAN_Queue_StatsTypeDef *pStats)
+{
+  uint32_t primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  *pStats = pQueue->Stats;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Frames were added to the Rx ring, called from the CAN interrupt
+  * @param  pQueue: queue context
+  * @retval None
+  */
+__weak void CAN_Queue_RxCallback(CAN_QueueTypeDef *pQueue)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(pQueue);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the CAN_Queue_RxCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  HAL CAN callbacks, routed to the queue of the instance
+  * @param  hcan: CAN handle
+  * @retval None
+  */
+void HAL_CAN_TxMailbox0CompleteCallback(CAN_HandleTypeDef *hcan)
+{
+  CAN_Queue_TxDone(hcan, CAN_TX_MAILBOX0, 0U);
+}
+
+void HAL_CAN_TxMailbox1CompleteCallback(CAN_HandleTypeDef *hcan)
+{
+  CAN_Queue_TxDone(hcan, CAN_TX_MAILBOX1, 0U);
+}
+
+void HAL_CAN_TxMailbox2CompleteCallback(CAN_HandleTypeDef *hcan)
+{
+  CAN_Queue_TxDone(hcan, CAN_TX_MAILBOX2, 0U);
+}
+
+void HAL_CAN_TxMailbox0AbortCallback(CAN_HandleTypeDef *hcan)
+{
+  CAN_Queue_TxDone(hcan, CAN_TX_MAILBOX0, 1U);
+}
+
+void HAL_CAN_TxMailbox1AbortCallback(CAN_HandleTypeDef *hcan)
+{
+  CAN_Queue_TxDone(hcan, CAN_TX_MAILBOX1, 1U);
+}
+
+void HAL_CAN_TxMailbox2AbortCallback(CAN_HandleTypeDef *hcan)
+{
+  CAN_Queue_TxDone(hcan, CAN_TX_MAILBOX2, 1U);
+}
+
+void HAL_CAN_RxFifo0MsgPendingCallback(CAN_HandleTypeDef *hcan)
+{
+  CAN_Queue_Drain(hcan, CAN_RX_FIFO0);
+}
+
+void HAL_CAN_RxFifo1MsgPendingCallback(CAN_HandleTypeDef *hcan)
+{
+  CAN_Queue_Drain(hcan, CAN_RX_FIFO1);
+}
+
+void HAL_CAN_ErrorCallback(CAN_HandleTypeDef *hcan)
+{
+  CAN_QueueTypeDef *pQueue = CAN_Queue_Find(hcan);
+  uint32_t tsr;
+  uint32_t i;
+
+  if (pQueue == NULL)
+  {
+    return;
+  }
+
+  if ((hcan->ErrorCode & HAL_CAN_ERROR_RX_FOV0) != 0U)
+  {
+    pQueue->Stats.RxOverruns++;
+  }
+  if ((hcan->ErrorCode & HAL_CAN_ERROR_RX_FOV1) != 0U)
+  {
+    pQueue->Stats.RxOverruns++;
+  }
+  hcan->ErrorCode &= ~(HAL_CAN_ERROR_RX_FOV0 | HAL_CAN_ERROR_RX_FOV1);
+
+  /* A mailbox that failed (ALSTx, TERRx) gets no callback of its own: it is
+     empty and its RQCPx flag was already cleared by the HAL */
+  tsr = hcan->Instance->TSR;
+  for (i = 0U; i < CAN_QUEUE_TX_MAILBOXES; i++)
+  {
+    if (((pQueue->MailboxBusy & (1UL << i)) != 0U) &&
+        ((tsr & (CAN_TSR_TME0 << i)) != 0U) &&
+        ((tsr & (CAN_TSR_RQCP0 << (8U * i))) == 0U))
+    {
+      pQueue->MailboxBusy &= ~(1UL << i);
+      pQueue->MailboxAborting &= ~(1UL << i);
+      pQueue->Stats.TxErrors++;
+    }
+  }
+
+  CAN_Queue_Refill(pQueue);
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Queue attached to a CAN handle
+  * @param  hcan: CAN handle
+  * @retval Queue, NULL if none
+  */
+static CAN_QueueTypeDef *CAN_Queue_Find(CAN_HandleTypeDef *hcan)
+{
+  uint32_t i;
+
+  for (i = 0U; i < CAN_QUEUE_INSTANCES; i++)
+  {
+    if ((CanQueues[i] != NULL) && (CanQueues[i]->hcan == hcan))
+    {
+      return CanQueues[i];
+    }
+  }
+
+  return NULL;
+}
+
+/**
+  * @brief  Arbitration field as sent on the bus, a lower value wins
+  * @param  pFrame: frame
+  * @retval Key
+  */
+static uint32_t CAN_Queue_Key(const CAN_Queue_FrameTypeDef *pFrame)
+{
+  uint32_t rtr = (pFrame->RTR == CAN_RTR_REMOTE) ? 1U : 0U;
+
+  if (pFrame->IDE == CAN_ID_STD)
+  {
+    /* Base identifier, RTR, IDE dominant */
+    return ((pFrame->Id & 0x7FFU) << 21) | (rtr << 20);
+  }
+
+  /* Base identifier, SRR and IDE recessive, identifier extension, RTR */
+  return (((pFrame->Id >> 18) & 0x7FFU) << 21) | (1UL << 20) | (1UL << 19) |
+         ((pFrame->Id & 0x3FFFFU) << 1) | rtr;
+}
+
+/**
+  * @brief  Order of the queue: arbitration key, then submission order
+  * @param  pA: first entry
+  * @param  pB: second entry
+  * @retval 1 if pA is sent before pB
+  */
+static uint32_t CAN_Queue_Before(const CAN_Queue_TxEntryTypeDef *pA, const CAN_Queue_TxEntryTypeDef *pB)
+{
+  if (pA->Key != pB->Key)
+  {
+    return (pA->Key < pB->Key) ? 1U : 0U;
+  }
+
+  return ((int32_t)(pA->Seq - pB->Seq) < 0) ? 1U : 0U;
+}
+
+/**
+  * @brief  Insert an entry in the binary heap, interrupts masked
+  * @param  pQueue: queue context
+  * @param  pEntry: entry, copied
+  * @retval None
+  */
+static void CAN_Queue_Push(CAN_QueueTypeDef *pQueue, const CAN_Queue_TxEntryTypeDef *pEntry)
+{
+  uint32_t child = pQueue->TxCount++;
+  uint32_t parent;
+
+  while (child > 0U)
+  {
+    parent = (child - 1U) / 2U;
+    if (CAN_Queue_Before(pEntry, &pQueue->TxHeap[parent]) == 0U)
+    {
+      break;
+    }
+    pQueue->TxHeap[child] = pQueue->TxHeap[parent];
+    child = parent;
+  }
+  pQueue->TxHeap[child] = *pEntry;
+}
+
+/**
+  * @brief  Remove the head of the binary heap, interrupts masked
+  * @param  pQueue: queue context
+  * @retval None
+  */
+static void CAN_Queue_Pop(CAN_QueueTypeDef *pQueue)
+{
+  CAN_Queue_TxEntryTypeDef *pLast;
+  uint32_t parent = 0U;
+  uint32_t child;
+
+  pQueue->TxCount--;
+  pLast = &pQueue->TxHeap[pQueue->TxCount];
+
+  for (child = 1U; child < pQueue->TxCount; child = (2U * parent) + 1U)
+  {
+    if (((child + 1U) < pQueue->TxCount) &&
+        (CAN_Queue_Before(&pQueue->TxHeap[child + 1U], &pQueue->TxHeap[child]) != 0U))
+    {
+      child++;
+    }
+    if (CAN_Queue_Before(&pQueue->TxHeap[child], pLast) == 0U)
+    {
+      break;
+    }
+    pQueue->TxHeap[parent] = pQueue->TxHeap[child];
+    parent = child;
+  }
+  pQueue->TxHeap[parent] = *pLast;
+}
+
+/**
+  * @brief  Move the most urgent frames to the free mailboxes, interrupts
+  *         masked or from the CAN interrupt
+  * @param  pQueue: queue context
+  * @retval None
+  */
+static void CAN_Queue_Refill(CAN_QueueTypeDef *pQueue)
+{
+  CAN_TxHeaderTypeDef header;
+  CAN_Queue_TxEntryTypeDef *pHead = &pQueue->TxHeap[0];
+  uint32_t mailbox;
+  uint32_t code;
+  uint32_t tsr;
+
+  header.TransmitGlobalTime = DISABLE;
+
+  while (pQueue->TxCount > 0U)
+  {
+    /* The HAL uses the mailbox given by CODE. A mailbox still marked busy
+       here has its completion interrupt pending: refill from there instead
+       of losing track of its frame. */
+    tsr = pQueue->hcan->Instance->TSR;
+    code = (tsr & CAN_TSR_CODE) >> CAN_TSR_CODE_Pos;
+    if ((code >= CAN_QUEUE_TX_MAILBOXES) || ((tsr & (CAN_TSR_TME0 << code)) == 0U) ||
+        ((pQueue->MailboxBusy & (1UL << code)) != 0U))
+    {
+      break;
+    }
+
+    header.StdId = pHead->Frame.Id;
+    header.ExtId = pHead->Frame.Id;
+    header.IDE = pHead->Frame.IDE;
+    header.RTR = pHead->Frame.RTR;
+    header.DLC = pHead->Frame.DLC;
+    if (HAL_CAN_AddTxMessage(pQueue->hcan, &header, pHead->Frame.Data, &mailbox) != HAL_OK)
+    {
+      break;
+    }
+
+    pQueue->Mailbox[CAN_QUEUE_MAILBOX_INDEX(mailbox)] = *pHead;
+    pQueue->MailboxBusy |= mailbox;
+    CAN_Queue_Pop(pQueue);
+  }
+}
+
+/**
+  * @brief  Abort the least urgent mailbox when the head of the queue would
+  *         win the arbitration against it, interrupts masked
+  * @param  pQueue: queue context
+  * @retval None
+  */
+static void CAN_Queue_Preempt(CAN_QueueTypeDef *pQueue)
+{
+  uint32_t worst = 0U;
+  uint32_t i;
+
+  if ((pQueue->TxCount == 0U) || (pQueue->MailboxAborting != 0U) ||
+      (pQueue->MailboxBusy != CAN_QUEUE_ALL_MAILBOXES))
+  {
+    return;
+  }
+
+  for (i = 1U; i < CAN_QUEUE_TX_MAILBOXES; i++)
+  {
+    if (CAN_Queue_Before(&pQueue->Mailbox[worst], &pQueue->Mailbox[i]) != 0U)
+    {
+      worst = i;
+    }
+  }
+
+  if (CAN_Queue_Before(&pQueue->TxHeap[0], &pQueue->Mailbox[worst]) != 0U)
+  {
+    if (HAL_CAN_AbortTxRequest(pQueue->hcan, 1UL << worst) == HAL_OK)
+    {
+      pQueue->MailboxAborting |= (1UL << worst);
+      pQueue->Stats.TxPreempted++;
+    }
+  }
+}
+
+/**
+  * @brief  Mailbox released, from the CAN interrupt
+  * @param  hcan: CAN handle
+  * @param  Mailbox: CAN_TX_MAILBOXx
+  * @param  Aborted: 1 if the frame was not sent and goes back to the queue
+  * @retval None
+  */
+static void CAN_Queue_TxDone(CAN_HandleTypeDef *hcan, uint32_t Mailbox, uint32_t Aborted)
+{
+  CAN_QueueTypeDef *pQueue = CAN_Queue_Find(hcan);
+
+  if ((pQueue == NULL) || ((pQueue->MailboxBusy & Mailbox) == 0U))
+  {
+    return;
+  }
+
+  pQueue->MailboxBusy &= ~Mailbox;
+  pQueue->MailboxAborting &= ~Mailbox;
+
+  if (Aborted != 0U)
+  {
+    /* The heap has room for the frames of the 3 mailboxes */
+    CAN_Queue_Push(pQueue, &pQueue->Mailbox[CAN_QUEUE_MAILBOX_INDEX(Mailbox)]);
+  }
+  else
+  {
+    pQueue->Stats.TxSent++;
+  }
+
+  CAN_Queue_Refill(pQueue);
+}
+
+/**
+  * @brief  Move the frames of an Rx FIFO to the ring, from the CAN interrupt
+  * @param  hcan: CAN handle
+  * @param  RxFifo: CAN_RX_FIFO0 or CAN_RX_FIFO1
+  * @retval None
+  */
+static void CAN_Queue_Drain(CAN_HandleTypeDef *hcan, uint32_t RxFifo)
+{
+  CAN_QueueTypeDef *pQueue = CAN_Queue_Find(hcan);
+  CAN_Queue_FrameTypeDef *pSlot;
+  CAN_RxHeaderTypeDef header;
+  uint8_t discard[8];
+  uint32_t fifo = (RxFifo == CAN_RX_FIFO0) ? 0U : 1U;
+  uint32_t head;
+  uint32_t full;
+
+  if (pQueue == NULL)
+  {
+    return;
+  }
+
+  head = pQueue->RxHead;
+  while (HAL_CAN_GetRxFifoFillLevel(hcan, RxFifo) > 0U)
+  {
+    full = ((head - pQueue->RxTail) >= CAN_QUEUE_RX_SIZE) ? 1U : 0U;
+    pSlot = &pQueue->RxRing[head & (CAN_QUEUE_RX_SIZE - 1U)];
+
+    /* The payload goes straight to the ring slot */
+    if (HAL_CAN_GetRxMessage(hcan, RxFifo, &header, (full != 0U) ? discard : pSlot->Data) != HAL_OK)
+    {
+      break;
+    }
+
+    if (full != 0U)
+    {
+      pQueue->Stats.RxDropped++;
+      if (header.FilterMatchIndex < CAN_QUEUE_FILTER_NBR)
+      {
+        pQueue->Stats.FilterDrops[fifo][header.FilterMatchIndex]++;
+      }
+      continue;
+    }
+
+    pSlot->Id = (header.IDE == CAN_ID_STD) ? header.StdId : header.ExtId;
+    pSlot->IDE = header.IDE;
+    pSlot->RTR = header.RTR;
+    pSlot->DLC = header.DLC;
+    pSlot->Fifo = RxFifo;
+    pSlot->FilterIndex = header.FilterMatchIndex;
+    pSlot->Timestamp = header.Timestamp;
+
+    pQueue->Stats.RxReceived++;
+    if (header.FilterMatchIndex < CAN_QUEUE_FILTER_NBR)
+    {
+      pQueue->Stats.FilterHits[fifo][header.FilterMatchIndex]++;
+    }
+    head++;
+  }
+
+  if (head != pQueue->RxHead)
+  {
+    /* Publish the slots once they are written */
+    __DMB();
+    pQueue->RxHead = head;
+    CAN_Queue_RxCallback(pQueue);
+  }
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,145 @@
+/**
+  ******************************************************************************
+  * @file    can_queue.h
+  * @author  MCD Application Team
+  * @brief   Header for can_queue module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _CAN_QUEUE_H__
+#define _CAN_QUEUE_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#if !defined(HAL_CAN_MODULE_ENABLED)
+#error "can_queue requires the HAL CAN driver (HAL_CAN_MODULE_ENABLED)"
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+/* Frames waiting for a Tx mailbox. Override in main.h. */
+#if !defined(CAN_QUEUE_TX_SIZE)
+#define CAN_QUEUE_TX_SIZE        32U
+#endif
+
+/* Frames received and not yet read, power of 2. Override in main.h. */
+#if !defined(CAN_QUEUE_RX_SIZE)
+#define CAN_QUEUE_RX_SIZE        64U
+#endif
+
+/* Filter match indexes counted per Rx FIFO. Override in main.h. */
+#if !defined(CAN_QUEUE_FILTER_NBR)
+#define CAN_QUEUE_FILTER_NBR     14U
+#endif
+
+/* CAN instances served at the same time. Override in main.h. */
+#if !defined(CAN_QUEUE_INSTANCES)
+#define CAN_QUEUE_INSTANCES      3U
+#endif
+
+#define CAN_QUEUE_TX_MAILBOXES   3U
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t  Id;             /* Standard or extended identifier                */
+  uint32_t  IDE;            /* CAN_ID_STD or CAN_ID_EXT                       */
+  uint32_t  RTR;            /* CAN_RTR_DATA or CAN_RTR_REMOTE                 */
+  uint32_t  DLC;            /* 0 to 8                                         */
+  uint32_t  Fifo;           /* Rx: CAN_RX_FIFO0 or CAN_RX_FIFO1               */
+  uint32_t  FilterIndex;    /* Rx: filter match index                         */
+  uint32_t  Timestamp;      /* Rx: time stamp, time triggered mode only       */
+  uint8_t   Data[8];
+} CAN_Queue_FrameTypeDef;
+
+typedef struct
+{
+  uint32_t  TxQueued;       /* Frames accepted by CAN_Queue_Send()            */
+  uint32_t  TxSent;
+  uint32_t  TxRejected;     /* Tx queue full                                  */
+  uint32_t  TxErrors;       /* Lost arbitration or error, no retransmission  */
+  uint32_t  TxPreempted;    /* Mailboxes aborted for a higher priority frame  */
+  uint32_t  RxReceived;
+  uint32_t  RxDropped;      /* Rx ring full                                   */
+  uint32_t  RxOverruns;     /* Hardware FIFO overruns                         */
+  uint32_t  FilterHits[2][CAN_QUEUE_FILTER_NBR];   /* Per Rx FIFO and filter  */
+  uint32_t  FilterDrops[2][CAN_QUEUE_FILTER_NBR];
+} CAN_Queue_StatsTypeDef;
+
+/* Tx frame with its arbitration key and submission order */
+typedef struct
+{
+  uint32_t                Key;
+  uint32_t                Seq;
+  CAN_Queue_FrameTypeDef  Frame;
+} CAN_Queue_TxEntryTypeDef;
+
+/* One per CAN instance, owned by the module from CAN_Queue_Init() on */
+typedef struct
+{
+  CAN_HandleTypeDef         *hcan;
+  CAN_Queue_TxEntryTypeDef  TxHeap[CAN_QUEUE_TX_SIZE + CAN_QUEUE_TX_MAILBOXES];
+  uint32_t                  TxCount;
+  uint32_t                  TxSeq;
+  CAN_Queue_TxEntryTypeDef  Mailbox[CAN_QUEUE_TX_MAILBOXES];
+  uint32_t                  MailboxBusy;        /* CAN_TX_MAILBOXx bits       */
+  uint32_t                  MailboxAborting;    /* CAN_TX_MAILBOXx bits       */
+  CAN_Queue_FrameTypeDef    RxRing[CAN_QUEUE_RX_SIZE];
+  __IO uint32_t             RxHead;             /* Written by the interrupt   */
+  __IO uint32_t             RxTail;             /* Written by the reader      */
+  CAN_Queue_StatsTypeDef    Stats;
+} CAN_QueueTypeDef;
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef CAN_Queue_Init(CAN_QueueTypeDef *pQueue, CAN_HandleTypeDef *hcan);
+HAL_StatusTypeDef CAN_Queue_DeInit(CAN_QueueTypeDef *pQueue);
+HAL_StatusTypeDef CAN_Queue_Send(CAN_QueueTypeDef *pQueue, const CAN_Queue_FrameTypeDef *pFrame);
+HAL_StatusTypeDef CAN_Queue_Receive(CAN_QueueTypeDef *pQueue, CAN_Queue_FrameTypeDef *pFrame);
+uint32_t          CAN_Queue_RxAvailable(CAN_QueueTypeDef *pQueue);
+uint32_t          CAN_Queue_TxPending(CAN_QueueTypeDef *pQueue);
+void              CAN_Queue_GetStats(CAN_QueueTypeDef *pQueue, CAN_Queue_StatsTypeDef *pStats);
+
+void CAN_Queue_RxCallback(CAN_QueueTypeDef *pQueue);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _CAN_QUEUE_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,263 @@
+/**
+  ******************************************************************************
+  * @file    hal_dispatch.h
+  * @author  MCD Application Team
+  * @brief   Per-instance HAL callback dispatch bound at compile time
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- copy hal_dispatch_conf_template.h to the application folder, rename it
+   to hal_dispatch_conf.h and include there the headers declaring the
+   application handlers.
+
+2- for each HAL callback the application needs, define its dispatch table
+   with the instances and their handler, e.g. :
+      #define HAL_DISPATCH_UART_TX_CPLT(X)  X(USART1, Console_TxCplt) \
+                                            X(UART4,  Modem_TxCplt)
+   The module then implements that HAL callback with a switch on the
+   handle instance calling the handlers directly. There is no function
+   pointer in the handle and no table in RAM: the compiler sees every
+   handler, inlines the ones declared static inline in the configuration
+   header, and turns the switch into a jump table or a binary search even
+   with many instances. Instances missing from a table are ignored.
+
+3- a HAL callback without dispatch table keeps its weak default from the
+   HAL driver, so the application, or a module such as spi_queue, can
+   still implement it. Do not define a table for a callback implemented
+   elsewhere: the link fails with a duplicate symbol.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "hal_dispatch.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Switch case of a dispatch table entry, on the instance base address */
+#define HAL_DISPATCH_CASE_UART(__INSTANCE__, __HANDLER__)  case __INSTANCE__##_BASE: __HANDLER__(huart); break;
+#define HAL_DISPATCH_CASE_SPI(__INSTANCE__, __HANDLER__)   case __INSTANCE__##_BASE: __HANDLER__(hspi); break;
+
+/* Body of a dispatching callback */
+#define HAL_DISPATCH(__HANDLE__, __TABLE__, __CASE__)  \
+  do {                                                 \
+    switch((uint32_t)(__HANDLE__)->Instance)           \
+    {                                                  \
+      __TABLE__(__CASE__)                              \
+      default:                                         \
+        break;                                         \
+    }                                                  \
+  } while(0)
+
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+/* Functions Definition ------------------------------------------------------*/
+
+#if defined(HAL_UART_MODULE_ENABLED)
+
+#if defined(HAL_DISPATCH_UART_TX_CPLT)
+/**
+  * @brief  Tx Transfer completed callback, dispatched per instance
+  * @param  huart: UART handle
+  * @retval None
+  */
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+{
+  HAL_DISPATCH(huart, HAL_DISPATCH_UART_TX_CPLT, HAL_DISPATCH_CASE_UART);
+}
+#endif
+
+#if defined(HAL_DISPATCH_UART_TX_HALF_CPLT)
+/**
+  * @brief  Tx Half Transfer completed callback, dispatched per instance
+  * @param  huart: UART handle
+  * @retval None
+  */
+void HAL_UART_TxHalfCpltCallback(UART_HandleTypeDef *huart)
+{
+  HAL_DISPATCH(huart, HAL_DISPATCH_UART_TX_HALF_CPLT, HAL_DISPATCH_CASE_UART);
+}
+#endif
+
+#if defined(HAL_DISPATCH_UART_RX_CPLT)
+/**
+  * @brief  Rx Transfer completed callback, dispatched per instance
+  * @param  huart: UART handle
+  * @retval None
+  */
+void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
+{
+  HAL_DISPATCH(huart, HAL_DISPATCH_UART_RX_CPLT, HAL_DISPATCH_CASE_UART);
+}
+#endif
+
+#if defined(HAL_DISPATCH_UART_RX_HALF_CPLT)
+/**
+  * @brief  Rx Half Transfer completed callback, dispatched per instance
+  * @param  huart: UART handle
+  * @retval None
+  */
+void HAL_UART_RxHalfCpltCallback(UART_HandleTypeDef *huart)
+{
+  HAL_DISPATCH(huart, HAL_DISPATCH_UART_RX_HALF_CPLT, HAL_DISPATCH_CASE_UART);
+}
+#endif
+
+#if defined(HAL_DISPATCH_UART_ERROR)
+/**
+  * @brief  UART error callback, dispatched per instance
+  * @param  huart: UART handle
+  * @retval None
+  */
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
+{
+  HAL_DISPATCH(huart, HAL_DISPATCH_UART_ERROR, HAL_DISPATCH_CASE_UART);
+}
+#endif
+
+#if defined(HAL_DISPATCH_UART_ABORT_CPLT)
+/**
+  * @brief  UART Abort Complete callback, dispatched per instance
+  * @param  huart: UART handle
+  * @retval None
+  */
+void HAL_UART_AbortCpltCallback(UART_HandleTypeDef *huart)
+{
+  HAL_DISPATCH(huart, HAL_DISPATCH_UART_ABORT_CPLT, HAL_DISPATCH_CASE_UART);
+}
+#endif
+
+#endif /* HAL_UART_MODULE_ENABLED */
+
+#if defined(HAL_SPI_MODULE_ENABLED)
+
+#if defined(HAL_DISPATCH_SPI_TX_CPLT)
+/**
+  * @brief  Tx Transfer completed callback, dispatched per instance
+  * @param  hspi: SPI handle
+  * @retval None
+  */
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+  HAL_DISPATCH(hspi, HAL_DISPATCH_SPI_TX_CPLT, HAL_DISPATCH_CASE_SPI);
+}
+#endif
+
+#if defined(HAL_DISPATCH_SPI_RX_CPLT)
+/**
+  * @brief  Rx Transfer completed callback, dispatched per instance
+  * @param  hspi: SPI handle
+  * @retval None
+  */
+void HAL_SPI_RxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+  HAL_DISPATCH(hspi, HAL_DISPATCH_SPI_RX_CPLT, HAL_DISPATCH_CASE_SPI);
+}
+#endif
+
+#if defined(HAL_DISPATCH_SPI_TXRX_CPLT)
+/**
+  * @brief  Tx and Rx Transfer completed callback, dispatched per instance
+  * @param  hspi: SPI handle
+  * @retval None
+  */
+void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+  HAL_DISPATCH(hspi, HAL_DISPATCH_SPI_TXRX_CPLT, HAL_DISPATCH_CASE_SPI);
+}
+#endif
+
+#if defined(HAL_DISPATCH_SPI_TX_HALF_CPLT)
+/**
+  * @brief  Tx Half Transfer completed callback, dispatched per instance
+  * @param  hspi: SPI handle
+  * @retval None
+  */
+void HAL_SPI_TxHalfCpltCallback(SPI_HandleTypeDef *hspi)
+{
+  HAL_DISPATCH(hspi, HAL_DISPATCH_SPI_TX_HALF_CPLT, HAL_DISPATCH_CASE_SPI);
+}
+#endif
+
+#if defined(HAL_DISPATCH_SPI_RX_HALF_CPLT)
+/**
+  * @brief  Rx Half Transfer completed callback, dispatched per instance
+  * @param  hspi: SPI handle
+  * @retval None
+  */
+void HAL_SPI_RxHalfCpltCallback(SPI_HandleTypeDef *hspi)
+{
+  HAL_DISPATCH(hspi, HAL_DISPATCH_SPI_RX_HALF_CPLT, HAL_DISPATCH_CASE_SPI);
+}
+#endif
+
+#if defined(HAL_DISPATCH_SPI_TXRX_HALF_CPLT)
+/**
+  * @brief  Tx and Rx Half Transfer callback, dispatched per instance
+  * @param  hspi: SPI handle
+  * @retval None
+  */
+void HAL_SPI_TxRxHalfCpltCallback(SPI_HandleTypeDef *hspi)
+{
+  HAL_DISPATCH(hspi, HAL_DISPATCH_SPI_TXRX_HALF_CPLT, HAL_DISPATCH_CASE_SPI);
+}
+#endif
+
+#if defined(HAL_DISPATCH_SPI_ERROR)
+/**
+  * @brief  SPI error callback, dispatched per instance
+  * @param  hspi: SPI handle
+  * @retval None
+  */
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi)
+{
+  HAL_DISPATCH(hspi, HAL_DISPATCH_SPI_ERROR, HAL_DISPATCH_CASE_SPI);
+}
+#endif
+
+#if defined(HAL_DISPATCH_SPI_ABORT_CPLT)
+/**
+  * @brief  SPI Abort Complete callback, dispatched per instance
+  * @param  hspi: SPI handle
+  * @retval None
+  */
+void HAL_SPI_AbortCpltCallback(SPI_HandleTypeDef *hspi)
+{
+  HAL_DISPATCH(hspi, HAL_DISPATCH_SPI_ABORT_CPLT, HAL_DISPATCH_CASE_SPI);
+}
+#endif
+
+#endif /* HAL_SPI_MODULE_ENABLED */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,77 @@
+/**
+  ******************************************************************************
+  * @file    hal_dispatch_conf_template.h
+  * @author  MCD Application Team
+  * @brief   hal_dispatch configuration template file.
+  *          This file should be copied to the application folder and modified
+  *          as follows:
+  *            - Rename it to 'hal_dispatch_conf.h'.
+  *            - Include the headers declaring the application handlers and
+  *              define the dispatch tables of the callbacks used.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef  __HAL_DISPATCH_CONF_H__
+#define  __HAL_DISPATCH_CONF_H__
+
+/* Includes ------------------------------------------------------------------*/
+/* Headers declaring the handlers, static inline handlers are inlined in the
+   HAL callbacks */
+#include "app_uart.h"   /* replace with the application headers */
+
+/* Exported constants --------------------------------------------------------*/
+/* One table per HAL callback, X(Instance, Handler) for each instance served.
+   Comment a table out to keep the HAL weak callback. */
+
+/* UART */
+#define HAL_DISPATCH_UART_TX_CPLT(X)        X(USART1, Console_TxCplt)   \
+                                            X(USART2, Modem_TxCplt)
+#define HAL_DISPATCH_UART_RX_CPLT(X)        X(USART1, Console_RxCplt)   \
+                                            X(USART2, Modem_RxCplt)
+#define HAL_DISPATCH_UART_ERROR(X)          X(USART1, Console_Error)    \
+                                            X(USART2, Modem_Error)
+/* #define HAL_DISPATCH_UART_TX_HALF_CPLT(X) */
+/* #define HAL_DISPATCH_UART_RX_HALF_CPLT(X) */
+/* #define HAL_DISPATCH_UART_ABORT_CPLT(X)   */
+
+/* SPI */
+/* #define HAL_DISPATCH_SPI_TX_CPLT(X)        */
+/* #define HAL_DISPATCH_SPI_RX_CPLT(X)        */
+/* #define HAL_DISPATCH_SPI_TXRX_CPLT(X)      */
+/* #define HAL_DISPATCH_SPI_TX_HALF_CPLT(X)   */
+/* #define HAL_DISPATCH_SPI_RX_HALF_CPLT(X)   */
+/* #define HAL_DISPATCH_SPI_TXRX_HALF_CPLT(X) */
+/* #define HAL_DISPATCH_SPI_ERROR(X)          */
+/* #define HAL_DISPATCH_SPI_ABORT_CPLT(X)     */
+
+#endif /* __HAL_DISPATCH_CONF_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
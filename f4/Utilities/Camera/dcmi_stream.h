@@ -0,0 +1,139 @@
+/**
+  ******************************************************************************
+  * @file    dcmi_stream.h
+  * @author  MCD Application Team
+  * @brief   Header for dcmi_stream module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _DCMI_STREAM_H__
+#define _DCMI_STREAM_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#if !defined(HAL_DCMI_MODULE_ENABLED) || !defined(HAL_DMA_MODULE_ENABLED)
+#error "dcmi_stream requires the HAL DCMI and DMA drivers"
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+/* Capture blocks of the pool, 32 at most. Override in main.h. */
+#if !defined(DCMI_STREAM_MAX_BLOCKS)
+#define DCMI_STREAM_MAX_BLOCKS    16U
+#endif
+
+/* Regions of interest. Override in main.h. */
+#if !defined(DCMI_STREAM_MAX_ROIS)
+#define DCMI_STREAM_MAX_ROIS      8U
+#endif
+
+/* Block flags */
+#define DCMI_STREAM_FLAG_FIRST    0x01U   /* First block of a frame                          */
+#define DCMI_STREAM_FLAG_LAST     0x02U   /* Last block of a frame, Length up to the frame end */
+#define DCMI_STREAM_FLAG_JPEG     0x04U   /* JPEG stream of the sensor                       */
+#define DCMI_STREAM_FLAG_OVERRUN  0x08U   /* Data of the frame lost, no free block           */
+#define DCMI_STREAM_FLAG_ERROR    0x10U   /* DCMI overrun or synchronization error, DMA error */
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t                  X0;                 /* Crop start, pixel clocks, as HAL_DCMI_ConfigCrop() */
+  uint32_t                  Y0;                 /* Crop start, lines                              */
+  uint32_t                  XSize;              /* Crop width, 0 for the whole frame              */
+  uint32_t                  YSize;              /* Crop height                                    */
+  uint32_t                  Divider;            /* Captured one frame out of Divider, 0: off      */
+} DCMI_Stream_RoiTypeDef;
+
+typedef struct
+{
+  DCMI_HandleTypeDef        *hdcmi;             /* Initialized with HAL_DCMI_Init(), DMA linked   */
+  uint8_t                   *pBlocks;           /* NbBlocks blocks of BlockSize bytes             */
+  uint32_t                  BlockSize;          /* Bytes, multiple of 32, 262140 at most          */
+  uint32_t                  NbBlocks;           /* From 2 to DCMI_STREAM_MAX_BLOCKS               */
+  DCMI_Stream_RoiTypeDef    *pRois;             /* Regions of interest, first ones first served   */
+  uint32_t                  NbRois;             /* Up to DCMI_STREAM_MAX_ROIS                     */
+} DCMI_Stream_ConfigTypeDef;
+
+typedef struct
+{
+  uint8_t                   *pData;
+  uint32_t                  Length;             /* Bytes captured                                 */
+  uint32_t                  Frame;              /* Sensor frame number                            */
+  uint32_t                  Roi;                /* Region of interest of the frame                */
+  uint32_t                  Flags;              /* DCMI_STREAM_FLAG_xxx                           */
+} DCMI_Stream_BlockTypeDef;
+
+typedef struct
+{
+  DCMI_Stream_ConfigTypeDef Config;
+  __IO uint32_t             State;
+  DCMI_Stream_BlockTypeDef  Blocks[DCMI_STREAM_MAX_BLOCKS];
+  uint32_t                  Free;               /* Blocks free, bit n for block n                 */
+  uint8_t                   Ready[DCMI_STREAM_MAX_BLOCKS];  /* Blocks captured, in order          */
+  __IO uint32_t             ReadyHead;
+  __IO uint32_t             ReadyTail;
+  uint32_t                  Active[2];          /* Blocks of the DMA memories 0 and 1             */
+  uint32_t                  Countdown[DCMI_STREAM_MAX_ROIS]; /* Frames before each region is due   */
+  __IO uint32_t             Capturing;          /* Frame being captured                           */
+  uint32_t                  Roi;                /* Region of the frame being captured             */
+  uint32_t                  FrameFlags;         /* Flags of the next block of the frame           */
+  uint32_t                  Frames;             /* Sensor frames seen (VSYNC)                     */
+  uint32_t                  Captured;           /* Frames captured                                */
+  uint32_t                  Skipped;            /* Frames due and not captured, pool empty        */
+  uint32_t                  Overruns;           /* Blocks lost in a frame, pool empty             */
+  uint32_t                  Errors;             /* DCMI and DMA errors                            */
+} DCMI_StreamTypeDef;
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef               DCMI_Stream_Init(DCMI_StreamTypeDef *pStream, const DCMI_Stream_ConfigTypeDef *pConfig);
+HAL_StatusTypeDef               DCMI_Stream_Start(DCMI_StreamTypeDef *pStream);
+HAL_StatusTypeDef               DCMI_Stream_Stop(DCMI_StreamTypeDef *pStream);
+const DCMI_Stream_BlockTypeDef *DCMI_Stream_Get(DCMI_StreamTypeDef *pStream);
+void                            DCMI_Stream_Release(DCMI_StreamTypeDef *pStream, const DCMI_Stream_BlockTypeDef *pBlock);
+
+void DCMI_Stream_IRQHandler(DCMI_StreamTypeDef *pStream);
+
+void DCMI_Stream_BlockCallback(DCMI_StreamTypeDef *pStream, const DCMI_Stream_BlockTypeDef *pBlock);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _DCMI_STREAM_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,238 @@
+/**
+  ******************************************************************************
+  * @file    img_bench.c
+  * @author  MCD Application Team
+  * @brief   This file measures the cycles per pixel of the img_kernels
+  *          image processing kernels.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- call IMG_Bench_Run() with the kernel, the line width and the strip
+   height of the use case: it fills a strip with pseudo-random pixels, then
+   processes it Iterations times, line by line as an application does on
+   DCMI strips, timed with the DWT cycle counter, interrupts enabled. The
+   3x3 kernels replicate the first and last lines of the strip.
+
+2- the result is given in cycles per strip and in cycles per source pixel,
+   which does not depend on the core clock: compare the Cortex-M4 (STM32F4)
+   and Cortex-M7 (STM32F7, STM32H7) figures directly. IMG_Bench_Report()
+   formats the run and its result in one line for a console.
+
+Run it from the memory the application uses for the code, the strips and
+the img_kernels scratch lines: the DTCM, ITCM or CCM RAM change the result.
+*******************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include "img_bench.h"
+#include <stdio.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static const char * const IMG_Bench_Names[IMG_BENCH_KERNELS] =
+{
+  "gray", "threshold", "lut", "box", "gauss", "sobel", "erode", "dilate", "histogram", "resize"
+};
+
+/* Input strip, room for RGB565 pixels */
+static uint32_t          IMG_Bench_In[(IMG_BENCH_MAX_LINES * IMG_MAX_WIDTH * 2U) / 4U];
+static uint32_t          IMG_Bench_Out[(IMG_BENCH_MAX_LINES * IMG_MAX_WIDTH) / 4U];
+static uint32_t          IMG_Bench_Histogram[256];
+static uint8_t           IMG_Bench_Lut[256];
+static IMG_ResizeTypeDef IMG_Bench_Resize;
+
+/* Private function prototypes -----------------------------------------------*/
+static void IMG_Bench_Strip(const IMG_Bench_RunTypeDef *pRun);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Measure a kernel on a strip
+  * @param  pRun: Use case
+  * @param  pResult: Cycles per strip and per pixel
+  * @retval HAL_OK, or HAL_ERROR for a use case out of range
+  */
+HAL_StatusTypeDef IMG_Bench_Run(const IMG_Bench_RunTypeDef *pRun, IMG_Bench_ResultTypeDef *pResult)
+{
+  uint8_t *pIn = (uint8_t *)IMG_Bench_In;
+  uint32_t lfsr = 0xACE1U;
+  uint32_t start;
+  uint32_t cycles;
+  uint64_t sum = 0U;
+  uint32_t i;
+
+  if((pRun->Kernel >= IMG_BENCH_KERNELS) || (pRun->Width < 8U) || ((pRun->Width % 4U) != 0U) ||
+     (pRun->Width > IMG_MAX_WIDTH) || (pRun->Lines < 2U) || (pRun->Lines > IMG_BENCH_MAX_LINES) ||
+     (pRun->Iterations == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Noise, the worst case of the data dependent kernels */
+  for(i = 0U; i < sizeof(IMG_Bench_In); i++)
+  {
+    lfsr = (lfsr >> 1) ^ ((0U - (lfsr & 1U)) & 0xB400U);
+    pIn[i] = (uint8_t)lfsr;
+  }
+  for(i = 0U; i < 256U; i++)
+  {
+    IMG_Bench_Lut[i] = (uint8_t)(255U - i);
+  }
+  if(IMG_Resize_Init(&IMG_Bench_Resize, pRun->Width, pRun->Lines, pRun->Width / 2U, pRun->Lines / 2U) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Enable the DWT cycle counter */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#if (__CORTEX_M == 7U)
+  DWT->LAR = 0xC5ACCE55U;
+#endif
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  pResult->CyclesMin = 0xFFFFFFFFU;
+  pResult->CyclesMax = 0U;
+  for(i = 0U; i < pRun->Iterations; i++)
+  {
+    start = DWT->CYCCNT;
+    IMG_Bench_Strip(pRun);
+    cycles = DWT->CYCCNT - start;
+
+    sum += cycles;
+    if(cycles < pResult->CyclesMin)
+    {
+      pResult->CyclesMin = cycles;
+    }
+    if(cycles > pResult->CyclesMax)
+    {
+      pResult->CyclesMax = cycles;
+    }
+  }
+  pResult->CyclesAvg = (uint32_t)(sum / pRun->Iterations);
+  pResult->CyclesPerPixel = (uint32_t)((sum * 100U) / ((uint64_t)pRun->Iterations * pRun->Width * pRun->Lines));
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Format a run and its result in one line
+  * @param  pRun: Use case
+  * @param  pResult: Result of IMG_Bench_Run()
+  * @param  pBuffer: Text buffer
+  * @param  Size: Text buffer size
+  * @retval Length of the line, longer than Size - 1 when truncated
+  */
+uint32_t IMG_Bench_Report(const IMG_Bench_RunTypeDef *pRun, const IMG_Bench_ResultTypeDef *pResult,
+                          char *pBuffer, uint32_t Size)
+{
+  int written;
+
+  written = snprintf(pBuffer, Size,
+                     "img %s: %lux%lu, %lu cycles/strip (min %lu, max %lu), %lu.%02lu cycles/pixel on Cortex-M%u at %lu Hz\r\n",
+                     IMG_Bench_Names[pRun->Kernel], (unsigned long)pRun->Width, (unsigned long)pRun->Lines,
+                     (unsigned long)pResult->CyclesAvg, (unsigned long)pResult->CyclesMin,
+                     (unsigned long)pResult->CyclesMax, (unsigned long)(pResult->CyclesPerPixel / 100U),
+                     (unsigned long)(pResult->CyclesPerPixel % 100U), (unsigned int)__CORTEX_M,
+                     (unsigned long)SystemCoreClock);
+
+  return (written > 0) ? (uint32_t)written : 0U;
+}
+
+/**
+  * @brief  Run the kernel measured on the whole strip
+  * @param  pRun: Use case
+  * @retval None
+  */
+static void IMG_Bench_Strip(const IMG_Bench_RunTypeDef *pRun)
+{
+  static const IMG_Kernel3x3TypeDef kernels[] =
+  {
+    IMG_Box3x3_Line, IMG_Gauss3x3_Line, IMG_Sobel_Line, IMG_Erode3x3_Line, IMG_Dilate3x3_Line
+  };
+  const uint8_t *pIn = (const uint8_t *)IMG_Bench_In;
+  uint8_t *pOut = (uint8_t *)IMG_Bench_Out;
+  uint32_t width = pRun->Width;
+  uint32_t last = pRun->Lines - 1U;
+  uint32_t line;
+  uint32_t src;
+
+  switch(pRun->Kernel)
+  {
+  case IMG_BENCH_GRAY:
+    for(line = 0U; line <= last; line++)
+    {
+      IMG_RGB565ToGray_Line((const uint16_t *)&pIn[line * width * 2U], &pOut[line * width], width);
+    }
+    break;
+
+  case IMG_BENCH_THRESHOLD:
+    for(line = 0U; line <= last; line++)
+    {
+      IMG_Threshold_Line(&pIn[line * width], &pOut[line * width], width, 128U);
+    }
+    break;
+
+  case IMG_BENCH_LUT:
+    for(line = 0U; line <= last; line++)
+    {
+      IMG_Lut_Line(&pIn[line * width], &pOut[line * width], width, IMG_Bench_Lut);
+    }
+    break;
+
+  case IMG_BENCH_HISTOGRAM:
+    IMG_Histogram(pIn, width, pRun->Lines, width, IMG_Bench_Histogram);
+    break;
+
+  case IMG_BENCH_RESIZE:
+    for(line = 0U; line < (pRun->Lines / 2U); line++)
+    {
+      src = IMG_Resize_SrcLine(&IMG_Bench_Resize, line);
+      IMG_Resize_Line(&IMG_Bench_Resize, &pIn[src * width], &pIn[(src + 1U) * width],
+                      &pOut[line * (width / 2U)], line);
+    }
+    break;
+
+  default:
+    for(line = 0U; line <= last; line++)
+    {
+      kernels[pRun->Kernel - IMG_BENCH_BOX](&pIn[((line > 0U) ? (line - 1U) : 0U) * width], &pIn[line * width],
+                                            &pIn[((line < last) ? (line + 1U) : last) * width],
+                                            &pOut[line * width], width);
+    }
+    break;
+  }
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
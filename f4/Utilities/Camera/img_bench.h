@@ -0,0 +1,98 @@
+/**
+  ******************************************************************************
+  * @file    img_bench.h
+  * @author  MCD Application Team
+  * @brief   Header for img_bench module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _IMG_BENCH_H__
+#define _IMG_BENCH_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "img_kernels.h"
+
+/* Exported constants --------------------------------------------------------*/
+/* Largest strip measured, in lines. Override in main.h. */
+#if !defined(IMG_BENCH_MAX_LINES)
+#define IMG_BENCH_MAX_LINES         16U
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+  IMG_BENCH_GRAY = 0U,                 /* IMG_RGB565ToGray_Line()                 */
+  IMG_BENCH_THRESHOLD,                 /* IMG_Threshold_Line()                    */
+  IMG_BENCH_LUT,                       /* IMG_Lut_Line()                          */
+  IMG_BENCH_BOX,                       /* IMG_Box3x3_Line()                       */
+  IMG_BENCH_GAUSS,                     /* IMG_Gauss3x3_Line()                     */
+  IMG_BENCH_SOBEL,                     /* IMG_Sobel_Line()                        */
+  IMG_BENCH_ERODE,                     /* IMG_Erode3x3_Line()                     */
+  IMG_BENCH_DILATE,                    /* IMG_Dilate3x3_Line()                    */
+  IMG_BENCH_HISTOGRAM,                 /* IMG_Histogram()                         */
+  IMG_BENCH_RESIZE,                    /* IMG_Resize_Line(), half width and height */
+  IMG_BENCH_KERNELS
+} IMG_Bench_KernelTypeDef;
+
+typedef struct
+{
+  IMG_Bench_KernelTypeDef Kernel;
+  uint32_t  Width;                     /* Pixels, multiple of 4, IMG_MAX_WIDTH at most */
+  uint32_t  Lines;                     /* Strip height, 2 to IMG_BENCH_MAX_LINES  */
+  uint32_t  Iterations;                /* Strips processed                        */
+} IMG_Bench_RunTypeDef;
+
+typedef struct
+{
+  uint32_t  CyclesMin;                 /* Per strip                               */
+  uint32_t  CyclesMax;
+  uint32_t  CyclesAvg;
+  uint32_t  CyclesPerPixel;            /* Per source pixel, in 0.01 cycle         */
+} IMG_Bench_ResultTypeDef;
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef IMG_Bench_Run(const IMG_Bench_RunTypeDef *pRun, IMG_Bench_ResultTypeDef *pResult);
+uint32_t          IMG_Bench_Report(const IMG_Bench_RunTypeDef *pRun, const IMG_Bench_ResultTypeDef *pResult,
+                                   char *pBuffer, uint32_t Size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _IMG_BENCH_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,660 @@
+/**
+  ******************************************************************************
+  * @file    img_kernels.c
+  * @author  MCD Application Team
+  * @brief   This file includes integer image processing kernels for the
+  *          8-bit grayscale lines of DCMI frames, written with the SIMD
+  *          instructions of the Cortex-M4 and Cortex-M7.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- the kernels work on 8-bit grayscale lines: convert RGB565 captures with
+   IMG_RGB565ToGray_Line() first. Lines are aligned on 4 bytes and their
+   width is a multiple of 4, IMG_MAX_WIDTH at most. Four pixels are
+   processed per 32-bit word: packed byte compares and selects (USUB8,
+   SEL) for the thresholds and the morphology, two 16-bit lanes (UXTAB16,
+   UADD16, SADD16) for the sums of the filters, dual multiplies (SMUAD) for
+   the resize.
+
+2- the kernels work line by line, so they run on DCMI strips (dcmi_stream
+   blocks of whole lines) as they arrive. A 3x3 kernel writes one line from
+   the lines above, at and below it:
+     - the lines inside a strip are written as soon as it arrives;
+     - the first line of a strip needs the last line of the previous one,
+       and the last line of a strip the first line of the next one: copy
+       the last two lines of a strip before releasing it, and write the
+       line between the two strips when the next strip arrives;
+     - the first and last lines of the frame give their own line as
+       missing neighbour (edges replicated, as for the columns).
+
+3- the 3x3 kernels keep their column sums in static scratch lines of
+   IMG_MAX_WIDTH pixels, reused by every call: they are not reentrant, run
+   them from one context. Place the module data and the lines processed in
+   the DTCM when there is one (first RAM region of the STM32F7 and STM32H7
+   linker scripts, CCM RAM on STM32F4 with IMG_KERNELS_SECTION), so that
+   neither the DMA nor the cache slows the loads down.
+
+4- histogram equalization: accumulate the histogram of the frame strip by
+   strip with IMG_Histogram() (cleared by the application), turn it into a
+   table with IMG_EqualizeLut() and apply it with IMG_Lut_Line(), ex. to the
+   next frame.
+
+5- bilinear resize: IMG_Resize_Init() computes the source columns and
+   weights once. Each output line is interpolated by IMG_Resize_Line() from
+   the source line given by IMG_Resize_SrcLine() and the one below it.
+
+img_bench measures the cycles per pixel of each kernel.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "img_kernels.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Scratch lines of the 3x3 kernels, in 32-bit words: one guard word on each
+   side holds the replicated edge pixels */
+#define IMG_PAIR_WORDS     (((IMG_MAX_WIDTH) / 2U) + 2U)
+#define IMG_QUAD_WORDS     (((IMG_MAX_WIDTH) / 4U) + 2U)
+
+
+/* RGB565 to luma (JFIF), 16.16 fixed point coefficients applied to the 5-bit
+   and 6-bit components */
+#define IMG_Y_R            161185U
+#define IMG_Y_G            155712U
+#define IMG_Y_B            61455U
+
+/* 65536 / 9 rounded up: exact division of the box sums up to 9 * 255 */
+#define IMG_DIV9           7282U
+
+/* Private macro -------------------------------------------------------------*/
+/* Scratch lines placed in IMG_KERNELS_SECTION when main.h defines it, ex.
+   ".ccmram" on STM32F4 */
+#if defined(IMG_KERNELS_SECTION)
+#define IMG_SCRATCH        __attribute__((section(IMG_KERNELS_SECTION)))
+#else
+#define IMG_SCRATCH
+#endif
+
+/* 16-bit lanes of the even and odd bytes of a word */
+#define IMG_EVEN(w)        __UXTB16(w)
+#define IMG_ODD(w)         __UXTB16(__ROR((w), 8U))
+
+/* Private variables ---------------------------------------------------------*/
+static uint32_t ImgPairs[IMG_PAIR_WORDS] IMG_SCRATCH;
+static uint32_t ImgPairs2[IMG_PAIR_WORDS] IMG_SCRATCH;
+static uint32_t ImgQuads[IMG_QUAD_WORDS] IMG_SCRATCH;
+
+/* Private function prototypes -----------------------------------------------*/
+static void     Img_ColumnSums(const uint8_t *pAbove, const uint8_t *pLine, const uint8_t *pBelow,
+                               uint32_t Width, uint32_t Center);
+static void     Img_GuardPairs(uint32_t *pPairs, uint32_t Width);
+static uint32_t Img_Min8(uint32_t a, uint32_t b);
+static uint32_t Img_Max8(uint32_t a, uint32_t b);
+static void     Img_Morphology(const uint8_t *pAbove, const uint8_t *pLine, const uint8_t *pBelow,
+                               uint8_t *pOut, uint32_t Width, uint32_t Dilate);
+static uint32_t Img_Weight(uint32_t Dst, uint32_t DstSize, uint32_t SrcSize, uint32_t *pIndex);
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Convert a line of RGB565 pixels to 8-bit gray
+  * @param  pIn: RGB565 pixels, red in bits 15:11
+  * @param  pOut: gray pixels
+  * @param  Width: pixels, multiple of 4
+  * @retval None
+  */
+void IMG_RGB565ToGray_Line(const uint16_t *pIn, uint8_t *pOut, uint32_t Width)
+{
+  const uint32_t *pIn32 = (const uint32_t *)pIn;
+  uint32_t *pOut32 = (uint32_t *)pOut;
+  uint32_t w0, w1, y0, y1, y2, y3;
+
+  for(; Width > 0U; Width -= 4U)
+  {
+    w0 = *pIn32++;
+    w1 = *pIn32++;
+    y0 = ((IMG_Y_R * ((w0 >> 11) & 0x1FU)) + (IMG_Y_G * ((w0 >> 5) & 0x3FU)) + (IMG_Y_B * (w0 & 0x1FU)) + 32768U) >> 16;
+    y1 = ((IMG_Y_R * (w0 >> 27)) + (IMG_Y_G * ((w0 >> 21) & 0x3FU)) + (IMG_Y_B * ((w0 >> 16) & 0x1FU)) + 32768U) >> 16;
+    y2 = ((IMG_Y_R * ((w1 >> 11) & 0x1FU)) + (IMG_Y_G * ((w1 >> 5) & 0x3FU)) + (IMG_Y_B * (w1 & 0x1FU)) + 32768U) >> 16;
+    y3 = ((IMG_Y_R * (w1 >> 27)) + (IMG_Y_G * ((w1 >> 21) & 0x3FU)) + (IMG_Y_B * ((w1 >> 16) & 0x1FU)) + 32768U) >> 16;
+    *pOut32++ = y0 | (y1 << 8) | (y2 << 16) | (y3 << 24);
+  }
+}
+
+/**
+  * @brief  Binarize a line: 255 from the threshold up, 0 below
+  * @param  pIn: gray pixels
+  * @param  pOut: binary pixels, may be pIn
+  * @param  Width: pixels, multiple of 4
+  * @param  Threshold: lowest value set to 255
+  * @retval None
+  */
+void IMG_Threshold_Line(const uint8_t *pIn, uint8_t *pOut, uint32_t Width, uint8_t Threshold)
+{
+  const uint32_t *pIn32 = (const uint32_t *)pIn;
+  uint32_t *pOut32 = (uint32_t *)pOut;
+  uint32_t threshold = (uint32_t)Threshold * 0x01010101U;
+
+  for(; Width > 0U; Width -= 4U)
+  {
+    /* GE flags set on the bytes at or above the threshold */
+    (void)__USUB8(*pIn32++, threshold);
+    *pOut32++ = __SEL(0xFFFFFFFFU, 0U);
+  }
+}
+
+/**
+  * @brief  Map a line through a 256-entry table
+  * @param  pIn: gray pixels
+  * @param  pOut: mapped pixels, may be pIn
+  * @param  Width: pixels, multiple of 4
+  * @param  pLut: table, ex. from IMG_EqualizeLut()
+  * @retval None
+  */
+void IMG_Lut_Line(const uint8_t *pIn, uint8_t *pOut, uint32_t Width, const uint8_t *pLut)
+{
+  const uint32_t *pIn32 = (const uint32_t *)pIn;
+  uint32_t *pOut32 = (uint32_t *)pOut;
+  uint32_t w;
+
+  for(; Width > 0U; Width -= 4U)
+  {
+    w = *pIn32++;
+    *pOut32++ = (uint32_t)pLut[w & 0xFFU] | ((uint32_t)pLut[(w >> 8) & 0xFFU] << 8) |
+                ((uint32_t)pLut[(w >> 16) & 0xFFU] << 16) | ((uint32_t)pLut[w >> 24] << 24);
+  }
+}
+
+/**
+  * @brief  3x3 box blur of a line
+  * @param  pAbove: line above, pLine on the first line of the image
+  * @param  pLine: line blurred
+  * @param  pBelow: line below, pLine on the last line of the image
+  * @param  pOut: blurred line, not one of the input lines
+  * @param  Width: pixels, multiple of 4, IMG_MAX_WIDTH at most
+  * @retval None
+  */
+void IMG_Box3x3_Line(const uint8_t *pAbove, const uint8_t *pLine, const uint8_t *pBelow,
+                     uint8_t *pOut, uint32_t Width)
+{
+  uint16_t *pOut16 = (uint16_t *)pOut;
+  uint32_t *pPairs = &ImgPairs[1];
+  uint32_t prev, cur, next, sum;
+  uint32_t i;
+
+  Img_ColumnSums(pAbove, pLine, pBelow, Width, 1U);
+
+  cur = pPairs[-1];
+  next = pPairs[0];
+  for(i = 0U; i < (Width / 2U); i++)
+  {
+    prev = cur;
+    cur  = next;
+    next = pPairs[i + 1U];
+
+    /* Columns x-1, x, x+1 of the two pixels added lane by lane */
+    sum = __UADD16(__UADD16((cur << 16) | (prev >> 16), cur), (cur >> 16) | (next << 16));
+    *pOut16++ = (uint16_t)(((((sum & 0xFFFFU) * IMG_DIV9) + 32768U) >> 16) |
+                           (((((sum >> 16) * IMG_DIV9) + 32768U) >> 16) << 8));
+  }
+}
+
+/**
+  * @brief  3x3 Gaussian blur of a line, kernel [1 2 1] x [1 2 1] / 16
+  * @param  pAbove: line above, pLine on the first line of the image
+  * @param  pLine: line blurred
+  * @param  pBelow: line below, pLine on the last line of the image
+  * @param  pOut: blurred line, not one of the input lines
+  * @param  Width: pixels, multiple of 4, IMG_MAX_WIDTH at most
+  * @retval None
+  */
+void IMG_Gauss3x3_Line(const uint8_t *pAbove, const uint8_t *pLine, const uint8_t *pBelow,
+                       uint8_t *pOut, uint32_t Width)
+{
+  uint16_t *pOut16 = (uint16_t *)pOut;
+  uint32_t *pPairs = &ImgPairs[1];
+  uint32_t prev, cur, next, sum;
+  uint32_t i;
+
+  Img_ColumnSums(pAbove, pLine, pBelow, Width, 2U);
+
+  cur = pPairs[-1];
+  next = pPairs[0];
+  for(i = 0U; i < (Width / 2U); i++)
+  {
+    prev = cur;
+    cur  = next;
+    next = pPairs[i + 1U];
+
+    sum = __UADD16(__UADD16((cur << 16) | (prev >> 16), (cur >> 16) | (next << 16)), __UADD16(cur, cur));
+    sum = __UADD16(sum, 0x00080008U) >> 4;
+    *pOut16++ = (uint16_t)((sum & 0xFFU) | ((sum >> 8) & 0xFF00U));
+  }
+}
+
+/**
+  * @brief  Sobel gradient magnitude of a line, |Gx| + |Gy| saturated to 255
+  * @param  pAbove: line above, pLine on the first line of the image
+  * @param  pLine: line filtered
+  * @param  pBelow: line below, pLine on the last line of the image
+  * @param  pOut: magnitude line, not one of the input lines
+  * @param  Width: pixels, multiple of 4, IMG_MAX_WIDTH at most
+  * @retval None
+  */
+void IMG_Sobel_Line(const uint8_t *pAbove, const uint8_t *pLine, const uint8_t *pBelow,
+                    uint8_t *pOut, uint32_t Width)
+{
+  const uint32_t *pA = (const uint32_t *)pAbove;
+  const uint32_t *pB = (const uint32_t *)pBelow;
+  uint16_t *pOut16 = (uint16_t *)pOut;
+  uint32_t *pSums = &ImgPairs[1];
+  uint32_t *pDiffs = &ImgPairs2[1];
+  uint32_t prev, cur, next, dprev, dcur, dnext, gx, gy, even, odd;
+  int32_t x0, x1, y0, y1;
+  uint32_t i;
+
+  /* Columns [1 2 1] for Gx, differences below - above for Gy */
+  Img_ColumnSums(pAbove, pLine, pBelow, Width, 2U);
+  for(i = 0U; i < (Width / 4U); i++)
+  {
+    even = __SSUB16(IMG_EVEN(pB[i]), IMG_EVEN(pA[i]));
+    odd  = __SSUB16(IMG_ODD(pB[i]), IMG_ODD(pA[i]));
+    pDiffs[2U * i]      = __PKHBT(even, odd, 16);
+    pDiffs[2U * i + 1U] = __PKHTB(odd, even, 16);
+  }
+  Img_GuardPairs(ImgPairs2, Width);
+
+  cur = pSums[-1];
+  next = pSums[0];
+  dcur = pDiffs[-1];
+  dnext = pDiffs[0];
+  for(i = 0U; i < (Width / 2U); i++)
+  {
+    prev  = cur;
+    cur   = next;
+    next  = pSums[i + 1U];
+    dprev = dcur;
+    dcur  = dnext;
+    dnext = pDiffs[i + 1U];
+
+    gx = __SSUB16((cur >> 16) | (next << 16), (cur << 16) | (prev >> 16));
+    gy = __SADD16(__SADD16((dcur << 16) | (dprev >> 16), (dcur >> 16) | (dnext << 16)), __SADD16(dcur, dcur));
+
+    x0 = (int16_t)gx;
+    x1 = (int16_t)(gx >> 16);
+    y0 = (int16_t)gy;
+    y1 = (int16_t)(gy >> 16);
+    x0 = ((x0 < 0) ? -x0 : x0) + ((y0 < 0) ? -y0 : y0);
+    x1 = ((x1 < 0) ? -x1 : x1) + ((y1 < 0) ? -y1 : y1);
+    *pOut16++ = (uint16_t)(__USAT(x0, 8) | (__USAT(x1, 8) << 8));
+  }
+}
+
+/**
+  * @brief  3x3 erosion of a line: minimum of the neighbourhood
+  * @param  pAbove: line above, pLine on the first line of the image
+  * @param  pLine: line eroded
+  * @param  pBelow: line below, pLine on the last line of the image
+  * @param  pOut: eroded line, not one of the input lines
+  * @param  Width: pixels, multiple of 4, IMG_MAX_WIDTH at most
+  * @retval None
+  */
+void IMG_Erode3x3_Line(const uint8_t *pAbove, const uint8_t *pLine, const uint8_t *pBelow,
+                       uint8_t *pOut, uint32_t Width)
+{
+  Img_Morphology(pAbove, pLine, pBelow, pOut, Width, 0U);
+}
+
+/**
+  * @brief  3x3 dilation of a line: maximum of the neighbourhood
+  * @param  pAbove: line above, pLine on the first line of the image
+  * @param  pLine: line dilated
+  * @param  pBelow: line below, pLine on the last line of the image
+  * @param  pOut: dilated line, not one of the input lines
+  * @param  Width: pixels, multiple of 4, IMG_MAX_WIDTH at most
+  * @retval None
+  */
+void IMG_Dilate3x3_Line(const uint8_t *pAbove, const uint8_t *pLine, const uint8_t *pBelow,
+                        uint8_t *pOut, uint32_t Width)
+{
+  Img_Morphology(pAbove, pLine, pBelow, pOut, Width, 1U);
+}
+
+/**
+  * @brief  Add the pixels of lines to a histogram
+  * @param  pIn: first line
+  * @param  Width: pixels per line, multiple of 4
+  * @param  Lines: lines
+  * @param  Pitch: bytes from a line to the next, multiple of 4
+  * @param  pHistogram: 256 counters, cleared by the application
+  * @retval None
+  */
+void IMG_Histogram(const uint8_t *pIn, uint32_t Width, uint32_t Lines, uint32_t Pitch,
+                   uint32_t *pHistogram)
+{
+  const uint32_t *pIn32;
+  uint32_t w, i;
+
+  for(; Lines > 0U; Lines--)
+  {
+    pIn32 = (const uint32_t *)pIn;
+    for(i = Width / 4U; i > 0U; i--)
+    {
+      w = *pIn32++;
+      pHistogram[w & 0xFFU]++;
+      pHistogram[(w >> 8) & 0xFFU]++;
+      pHistogram[(w >> 16) & 0xFFU]++;
+      pHistogram[w >> 24]++;
+    }
+    pIn += Pitch;
+  }
+}
+
+/**
+  * @brief  Compute the table equalizing a histogram
+  * @param  pHistogram: 256 counters
+  * @param  pLut: 256-entry table for IMG_Lut_Line()
+  * @retval None
+  */
+void IMG_EqualizeLut(const uint32_t *pHistogram, uint8_t *pLut)
+{
+  uint32_t total = 0U;
+  uint32_t first = 0U;
+  uint32_t cdf = 0U;
+  uint32_t range;
+  uint32_t i;
+
+  for(i = 0U; i < 256U; i++)
+  {
+    total += pHistogram[i];
+  }
+
+  /* Darkest level present mapped to 0, brightest to 255 */
+  for(i = 0U; (i < 256U) && (pHistogram[i] == 0U); i++)
+  {
+  }
+  if(i < 256U)
+  {
+    first = pHistogram[i];
+  }
+  range = total - first;
+
+  for(i = 0U; i < 256U; i++)
+  {
+    cdf += pHistogram[i];
+    if(range == 0U)
+    {
+      pLut[i] = (uint8_t)i;
+    }
+    else
+    {
+      pLut[i] = (cdf <= first) ? 0U :
+                (uint8_t)(((((uint64_t)(cdf - first)) * 255U) + (range / 2U)) / range);
+    }
+  }
+}
+
+/**
+  * @brief  Prepare a bilinear resize
+  * @param  pResize: resize tables
+  * @param  SrcWidth: source width, 2 to 65535 pixels
+  * @param  SrcHeight: source height, 2 lines at least
+  * @param  DstWidth: output width, IMG_MAX_WIDTH at most
+  * @param  DstHeight: output height
+  * @retval HAL status
+  */
+HAL_StatusTypeDef IMG_Resize_Init(IMG_ResizeTypeDef *pResize, uint32_t SrcWidth, uint32_t SrcHeight,
+                                  uint32_t DstWidth, uint32_t DstHeight)
+{
+  uint32_t index;
+  uint32_t x;
+
+  if((pResize == NULL) || (SrcWidth < 2U) || (SrcWidth > 0xFFFFU) || (SrcHeight < 2U) ||
+     (DstWidth == 0U) || (DstWidth > IMG_MAX_WIDTH) || (DstHeight == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  pResize->SrcWidth  = SrcWidth;
+  pResize->SrcHeight = SrcHeight;
+  pResize->DstWidth  = DstWidth;
+  pResize->DstHeight = DstHeight;
+  for(x = 0U; x < DstWidth; x++)
+  {
+    pResize->XWeight[x] = Img_Weight(x, DstWidth, SrcWidth, &index);
+    pResize->XIndex[x]  = (uint16_t)index;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Get the first source line of an output line
+  * @param  pResize: resize tables
+  * @param  DstLine: output line
+  * @retval Source line, the output line also needs the one below it
+  */
+uint32_t IMG_Resize_SrcLine(const IMG_ResizeTypeDef *pResize, uint32_t DstLine)
+{
+  uint32_t index;
+
+  (void)Img_Weight(DstLine, pResize->DstHeight, pResize->SrcHeight, &index);
+  return index;
+}
+
+/**
+  * @brief  Interpolate an output line
+  * @param  pResize: resize tables
+  * @param  pSrc0: source line IMG_Resize_SrcLine(DstLine)
+  * @param  pSrc1: source line below pSrc0
+  * @param  pOut: output line, DstWidth pixels
+  * @param  DstLine: output line
+  * @retval None
+  */
+void IMG_Resize_Line(const IMG_ResizeTypeDef *pResize, const uint8_t *pSrc0, const uint8_t *pSrc1,
+                     uint8_t *pOut, uint32_t DstLine)
+{
+  uint32_t yweight, index, weight, top, bottom;
+  uint32_t x;
+
+  yweight = Img_Weight(DstLine, pResize->DstHeight, pResize->SrcHeight, &index);
+
+  for(x = 0U; x < pResize->DstWidth; x++)
+  {
+    index  = pResize->XIndex[x];
+    weight = pResize->XWeight[x];
+
+    /* Two horizontal interpolations then a vertical one, two products each */
+    top    = __SMUAD((uint32_t)pSrc0[index] | ((uint32_t)pSrc0[index + 1U] << 16), weight);
+    bottom = __SMUAD((uint32_t)pSrc1[index] | ((uint32_t)pSrc1[index + 1U] << 16), weight);
+    pOut[x] = (uint8_t)((__SMUAD(top | (bottom << 16), yweight) + 8192U) >> 14);
+  }
+}
+
+/**
+  * @brief  Fill the scratch pair line with the column sums of three lines
+  * @param  pAbove: line above
+  * @param  pLine: center line
+  * @param  pBelow: line below
+  * @param  Width: pixels
+  * @param  Center: weight of the center line, 1 or 2
+  * @retval None
+  */
+static void Img_ColumnSums(const uint8_t *pAbove, const uint8_t *pLine, const uint8_t *pBelow,
+                           uint32_t Width, uint32_t Center)
+{
+  const uint32_t *pA = (const uint32_t *)pAbove;
+  const uint32_t *pL = (const uint32_t *)pLine;
+  const uint32_t *pB = (const uint32_t *)pBelow;
+  uint32_t *pPairs = &ImgPairs[1];
+  uint32_t a, l, b, even, odd;
+  uint32_t i;
+
+  for(i = 0U; i < (Width / 4U); i++)
+  {
+    a = pA[i];
+    l = pL[i];
+    b = pB[i];
+
+    /* Pixels 0 and 2 in the even lanes, 1 and 3 in the odd lanes */
+    even = __UXTAB16(__UXTAB16(IMG_EVEN(a), l), b);
+    odd  = __UXTAB16(__UXTAB16(IMG_ODD(a), __ROR(l, 8U)), __ROR(b, 8U));
+    if(Center == 2U)
+    {
+      even = __UXTAB16(even, l);
+      odd  = __UXTAB16(odd, __ROR(l, 8U));
+    }
+
+    /* Back to pixel order, two pixels per word */
+    pPairs[2U * i]      = __PKHBT(even, odd, 16);
+    pPairs[2U * i + 1U] = __PKHTB(odd, even, 16);
+  }
+  Img_GuardPairs(ImgPairs, Width);
+}
+
+/**
+  * @brief  Replicate the edge columns of a pair line in its guard words
+  * @param  pPairs: pair line, guard word first
+  * @param  Width: pixels
+  * @retval None
+  */
+static void Img_GuardPairs(uint32_t *pPairs, uint32_t Width)
+{
+  pPairs[0] = pPairs[1] << 16;
+  pPairs[(Width / 2U) + 1U] = pPairs[Width / 2U] >> 16;
+}
+
+/**
+  * @brief  Minimum of four pairs of bytes
+  * @param  a: four bytes
+  * @param  b: four bytes
+  * @retval Smallest byte of each pair
+  */
+static uint32_t Img_Min8(uint32_t a, uint32_t b)
+{
+  (void)__USUB8(a, b);
+  return __SEL(b, a);
+}
+
+/**
+  * @brief  Maximum of four pairs of bytes
+  * @param  a: four bytes
+  * @param  b: four bytes
+  * @retval Largest byte of each pair
+  */
+static uint32_t Img_Max8(uint32_t a, uint32_t b)
+{
+  (void)__USUB8(a, b);
+  return __SEL(a, b);
+}
+
+/**
+  * @brief  3x3 erosion or dilation of a line
+  * @param  pAbove: line above
+  * @param  pLine: center line
+  * @param  pBelow: line below
+  * @param  pOut: output line
+  * @param  Width: pixels
+  * @param  Dilate: 1 for the maximum, 0 for the minimum
+  * @retval None
+  */
+static void Img_Morphology(const uint8_t *pAbove, const uint8_t *pLine, const uint8_t *pBelow,
+                           uint8_t *pOut, uint32_t Width, uint32_t Dilate)
+{
+  const uint32_t *pA = (const uint32_t *)pAbove;
+  const uint32_t *pL = (const uint32_t *)pLine;
+  const uint32_t *pB = (const uint32_t *)pBelow;
+  uint32_t *pOut32 = (uint32_t *)pOut;
+  uint32_t *pQuads = &ImgQuads[1];
+  uint32_t words = Width / 4U;
+  uint32_t prev, cur, next, left, right;
+  uint32_t i;
+
+  /* Vertical pass, four columns per word */
+  for(i = 0U; i < words; i++)
+  {
+    pQuads[i] = (Dilate != 0U) ? Img_Max8(Img_Max8(pA[i], pL[i]), pB[i]) :
+                                 Img_Min8(Img_Min8(pA[i], pL[i]), pB[i]);
+  }
+  ImgQuads[0] = pQuads[0] << 24;
+  ImgQuads[words + 1U] = pQuads[words - 1U] >> 24;
+
+  /* Horizontal pass, the neighbour columns shifted in from the next words */
+  cur = pQuads[-1];
+  next = pQuads[0];
+  for(i = 0U; i < words; i++)
+  {
+    prev  = cur;
+    cur   = next;
+    next  = pQuads[i + 1U];
+    left  = (cur << 8) | (prev >> 24);
+    right = (cur >> 8) | (next << 24);
+    pOut32[i] = (Dilate != 0U) ? Img_Max8(Img_Max8(left, cur), right) :
+                                 Img_Min8(Img_Min8(left, cur), right);
+  }
+}
+
+/**
+  * @brief  Source position of an output pixel or line, pixel centers aligned
+  * @param  Dst: output pixel or line
+  * @param  DstSize: output size
+  * @param  SrcSize: source size
+  * @param  pIndex: first source pixel or line, SrcSize - 2 at most
+  * @retval Q7 weights of the first and second source pixels, in the low
+  *         and high half words
+  */
+static uint32_t Img_Weight(uint32_t Dst, uint32_t DstSize, uint32_t SrcSize, uint32_t *pIndex)
+{
+  int64_t position;
+  uint32_t fraction;
+
+  /* (Dst + 0.5) * SrcSize / DstSize - 0.5, in 16.16 */
+  position = ((((int64_t)((2U * Dst) + 1U) * SrcSize) << 16) / (2U * DstSize)) - 32768;
+  if(position < 0)
+  {
+    position = 0;
+  }
+
+  *pIndex  = (uint32_t)(position >> 16);
+  fraction = ((uint32_t)position >> 9) & 0x7FU;
+  if(*pIndex >= (SrcSize - 1U))
+  {
+    *pIndex  = SrcSize - 2U;
+    fraction = 128U;
+  }
+
+  return (128U - fraction) | (fraction << 16);
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
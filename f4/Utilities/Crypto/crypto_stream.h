@@ -0,0 +1,146 @@
+/**
+  ******************************************************************************
+  * @file    crypto_stream.h
+  * @author  MCD Application Team
+  * @brief   Header for crypto_stream module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _CRYPTO_STREAM_H__
+#define _CRYPTO_STREAM_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#if !defined(HASH) || !defined(CRYP)
+#error "crypto_stream requires a device with the HASH and CRYP processors"
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+  CRYPTO_HASH_SHA1        = 0U,
+  CRYPTO_HASH_SHA224      = 1U,
+  CRYPTO_HASH_SHA256      = 2U,
+  CRYPTO_HASH_MD5         = 3U,
+  CRYPTO_AES_ECB_ENCRYPT  = 4U,
+  CRYPTO_AES_ECB_DECRYPT  = 5U,
+  CRYPTO_AES_CBC_ENCRYPT  = 6U,
+  CRYPTO_AES_CBC_DECRYPT  = 7U,
+  CRYPTO_AES_CTR          = 8U
+} CRYPTO_AlgoTypeDef;
+
+/* Hash (HMAC) or cipher stream. The context of the processor is kept here
+   while other streams use it: streams of several sessions interleave. */
+typedef struct
+{
+  CRYPTO_AlgoTypeDef  Algo;
+  uint32_t            Cr;          /* Processor configuration                     */
+  uint32_t            Hmac;        /* Key given to CRYPTO_Stream_HashInit()       */
+  uint32_t            Started;     /* Hash context valid in Csr[]                 */
+  uint32_t            Carry;       /* Message bytes not yet forming a word        */
+  uint32_t            CarryLen;
+  uint32_t            Imr;         /* Saved HASH context                          */
+  uint32_t            Str;
+  uint32_t            Csr[38];
+  uint32_t            Key[16];     /* HMAC key block, or AES key registers        */
+  uint32_t            Iv[4];       /* AES IV registers                            */
+} CRYPTO_SessionTypeDef;
+
+typedef struct
+{
+  const uint8_t       *pIn;
+  uint8_t             *pOut;       /* Cipher output, unused for hash              */
+  uint32_t            Size;        /* In bytes                                    */
+} CRYPTO_SegmentTypeDef;
+
+/* Owned by the module from CRYPTO_Stream_Submit() until Callback is called */
+typedef struct __CRYPTO_JobTypeDef
+{
+  CRYPTO_SessionTypeDef       *pSession;
+  const CRYPTO_SegmentTypeDef *pSegments;
+  uint32_t                    NbSegments;
+  uint8_t                     *pDigest;    /* Hash: non NULL ends the message   */
+  void                        (*Callback)(struct __CRYPTO_JobTypeDef *pJob);
+  __IO HAL_StatusTypeDef      Status;      /* HAL_BUSY until done                */
+  struct __CRYPTO_JobTypeDef  *pNext;      /* Reserved for the module            */
+} CRYPTO_JobTypeDef;
+
+typedef struct
+{
+  uint32_t            Size;        /* Bytes hashed                                */
+  uint32_t            HwCycles;    /* SHA-256, HASH processor fed by DMA          */
+  uint32_t            SwCycles;    /* SHA-256, software fallback                  */
+} CRYPTO_BenchmarkTypeDef;
+
+typedef struct
+{
+  uint32_t            State[8];
+  uint32_t            Length;
+  uint32_t            BufferLen;
+  uint8_t             Buffer[64];
+} CRYPTO_SW_SHA256TypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Segments shorter than this, in bytes, are fed by the CPU. Override in main.h. */
+#if !defined(CRYPTO_STREAM_DMA_THRESHOLD)
+#define CRYPTO_STREAM_DMA_THRESHOLD   64U
+#endif
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef CRYPTO_Stream_Init(DMA_HandleTypeDef *hdmaHashIn, DMA_HandleTypeDef *hdmaCrypIn,
+                                     DMA_HandleTypeDef *hdmaCrypOut);
+HAL_StatusTypeDef CRYPTO_Stream_HashInit(CRYPTO_SessionTypeDef *pSession, CRYPTO_AlgoTypeDef Algo,
+                                         const uint8_t *pKey, uint32_t KeySize);
+HAL_StatusTypeDef CRYPTO_Stream_CipherInit(CRYPTO_SessionTypeDef *pSession, CRYPTO_AlgoTypeDef Algo,
+                                           const uint8_t *pKey, uint32_t KeySize, const uint8_t *pIv);
+void              CRYPTO_Stream_Release(CRYPTO_SessionTypeDef *pSession);
+HAL_StatusTypeDef CRYPTO_Stream_Submit(CRYPTO_JobTypeDef *pJob);
+uint32_t          CRYPTO_Stream_IsIdle(void);
+HAL_StatusTypeDef CRYPTO_Stream_Benchmark(const uint8_t *pBuffer, uint32_t Size, CRYPTO_BenchmarkTypeDef *pResult);
+
+void CRYPTO_SW_SHA256_Init(CRYPTO_SW_SHA256TypeDef *pCtx);
+void CRYPTO_SW_SHA256_Update(CRYPTO_SW_SHA256TypeDef *pCtx, const uint8_t *pData, uint32_t Size);
+void CRYPTO_SW_SHA256_Finish(CRYPTO_SW_SHA256TypeDef *pCtx, uint8_t *pDigest);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _CRYPTO_STREAM_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,366 @@
+/**
+  ******************************************************************************
+  * @file    rng_pool.c
+  * @author  MCD Application Team
+  * @brief   Interrupt refilled entropy pool over the RNG, with a non blocking
+  *          bulk API and a ChaCha20 based expansion for high throughput.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- select the RNG kernel clock (48 MHz domain) and enable the RNG interrupt.
+   Call RNG_Pool_IRQHandler() from the RNG interrupt handler (HASH_RNG_IRQn
+   on devices sharing it with the HASH) and RNG_Pool_Init() once.
+
+2- the RNG interrupt refills the pool: every DRDY is one word, about 40 RNG
+   clock cycles. The interrupt is masked while the pool is full and enabled
+   again as soon as words are taken, so the RNG only runs when needed.
+
+3- RNG_Pool_Fill() and RNG_Pool_GetWord() serve from the pool and never wait
+   for the RNG: RNG_Pool_Fill() returns the number of bytes actually given,
+   which is less than requested when the pool runs dry.
+
+4- health checks: a seed error (SEIS) restarts the RNG and the next word is
+   dropped; a word equal to the previous one (continuous test) is dropped.
+   Both are counted, see RNG_Pool_GetStats().
+
+5- RNG_Pool_Expand() is the high throughput option: a ChaCha20 generator
+   keyed from the pool. 8 pool words are mixed into the key on each call
+   when available, the first call needs them. The key is replaced by
+   generator output on each call before the bytes are produced (fast key
+   erasure), so bytes already given cannot be recomputed from the state.
+   Only this key update runs with the interrupts masked.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "rng_pool.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#if ((RNG_POOL_SIZE & (RNG_POOL_SIZE - 1U)) != 0U) || (RNG_POOL_SIZE < 16U)
+#error "RNG_POOL_SIZE must be a power of 2, 16 words at least"
+#endif
+
+#define RNG_POOL_SEED_WORDS   8U
+
+/* Private macro -------------------------------------------------------------*/
+#define RNG_ROL(__X__, __N__)  (((__X__) << (__N__)) | ((__X__) >> (32U - (__N__))))
+
+#define RNG_QR(__A__, __B__, __C__, __D__)                               \
+  do {                                                                    \
+    (__A__) += (__B__); (__D__) ^= (__A__); (__D__) = RNG_ROL((__D__), 16U); \
+    (__C__) += (__D__); (__B__) ^= (__C__); (__B__) = RNG_ROL((__B__), 12U); \
+    (__A__) += (__B__); (__D__) ^= (__A__); (__D__) = RNG_ROL((__D__), 8U);  \
+    (__C__) += (__D__); (__B__) ^= (__C__); (__B__) = RNG_ROL((__B__), 7U);  \
+  } while(0)
+
+/* Private variables ---------------------------------------------------------*/
+static uint32_t               Pool[RNG_POOL_SIZE];
+static __IO uint32_t          PoolHead;      /* Written by the RNG interrupt    */
+static __IO uint32_t          PoolTail;      /* Written by the consumers        */
+static uint32_t               PoolLast;
+static uint32_t               PoolDrop;
+static RNG_Pool_StatsTypeDef  PoolStats;
+
+static uint32_t               DrbgKey[8];
+static uint32_t               DrbgCounter;
+static uint32_t               DrbgSeeded;
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t RNG_Pool_Take(uint32_t *pWords, uint32_t Count);
+static void     RNG_Pool_Block(const uint32_t *pKey, uint32_t Counter, uint32_t *pOut);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Enable the RNG clock and start refilling the pool
+  * @retval HAL status
+  */
+HAL_StatusTypeDef RNG_Pool_Init(void)
+{
+  __HAL_RCC_RNG_CLK_ENABLE();
+
+  PoolHead   = 0U;
+  PoolTail   = 0U;
+  PoolDrop   = 1U;   /* First word after enabling */
+  DrbgSeeded = 0U;
+  memset(&PoolStats, 0, sizeof(PoolStats));
+
+  RNG->CR = RNG_CR_RNGEN | RNG_CR_IE;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Copy random bytes from the pool, without waiting for the RNG
+  * @param  pBuffer: destination
+  * @param  Size: bytes requested
+  * @retval Bytes copied, less than Size when the pool is short
+  */
+uint32_t RNG_Pool_Fill(uint8_t *pBuffer, uint32_t Size)
+{
+  uint32_t words[8];
+  uint32_t done = 0U;
+  uint32_t n;
+  uint32_t got;
+
+  while(done < Size)
+  {
+    n = (Size - done + 3U) / 4U;
+    n = (n > 8U) ? 8U : n;
+    got = RNG_Pool_Take(words, n);
+    if(got == 0U)
+    {
+      PoolStats.Underruns++;
+      break;
+    }
+    n = ((4U * got) < (Size - done)) ? (4U * got) : (Size - done);
+    memcpy(&pBuffer[done], words, n);
+    done += n;
+  }
+  memset(words, 0, sizeof(words));
+
+  return done;
+}
+
+/**
+  * @brief  Take one random word from the pool
+  * @param  pWord: destination
+  * @retval HAL_OK, or HAL_BUSY when the pool is empty
+  */
+HAL_StatusTypeDef RNG_Pool_GetWord(uint32_t *pWord)
+{
+  return (RNG_Pool_Take(pWord, 1U) == 1U) ? HAL_OK : HAL_BUSY;
+}
+
+/**
+  * @brief  Number of words in the pool
+  * @retval Words
+  */
+uint32_t RNG_Pool_Available(void)
+{
+  return PoolHead - PoolTail;
+}
+
+/**
+  * @brief  Generate random bytes with the ChaCha20 generator
+  * @param  pBuffer: destination
+  * @param  Size: bytes
+  * @retval HAL_OK, or HAL_BUSY before the generator could be seeded
+  */
+HAL_StatusTypeDef RNG_Pool_Expand(uint8_t *pBuffer, uint32_t Size)
+{
+  uint32_t seed[RNG_POOL_SEED_WORDS];
+  uint32_t key[8];
+  uint32_t block[16];
+  uint32_t counter;
+  uint32_t primask;
+  uint32_t i;
+  uint32_t n;
+
+  /* Reserve a counter range and erase the shared key, then generate unlocked */
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if(RNG_Pool_Take(seed, RNG_POOL_SEED_WORDS) == RNG_POOL_SEED_WORDS)
+  {
+    for(i = 0U; i < 8U; i++)
+    {
+      DrbgKey[i] ^= seed[i];
+    }
+    DrbgSeeded = 1U;
+  }
+  if(DrbgSeeded == 0U)
+  {
+    __set_PRIMASK(primask);
+    return HAL_BUSY;
+  }
+  memcpy(key, DrbgKey, sizeof(key));
+  counter = DrbgCounter;
+  DrbgCounter += (Size + sizeof(block) - 1U) / sizeof(block);
+  RNG_Pool_Block(key, DrbgCounter, block);
+  DrbgCounter++;
+  memcpy(DrbgKey, block, sizeof(DrbgKey));
+  __set_PRIMASK(primask);
+
+  while(Size != 0U)
+  {
+    RNG_Pool_Block(key, counter++, block);
+    n = (Size < sizeof(block)) ? Size : sizeof(block);
+    memcpy(pBuffer, block, n);
+    pBuffer += n;
+    Size    -= n;
+  }
+
+  memset(key, 0, sizeof(key));
+  memset(block, 0, sizeof(block));
+  memset(seed, 0, sizeof(seed));
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Copy the health and usage counters
+  * @param  pStats: destination
+  * @retval None
+  */
+void RNG_Pool_GetStats(RNG_Pool_StatsTypeDef *pStats)
+{
+  *pStats = PoolStats;
+}
+
+/**
+  * @brief  RNG interrupt: store the new word, handle the error flags
+  * @retval None
+  */
+void RNG_Pool_IRQHandler(void)
+{
+  uint32_t sr = RNG->SR;
+  uint32_t word;
+
+  if((sr & RNG_SR_SEIS) != 0U)
+  {
+    RNG->SR = ~RNG_SR_SEIS;
+    PoolStats.SeedErrors++;
+    /* Restart the generator and drop its first word */
+    RNG->CR &= ~RNG_CR_RNGEN;
+    RNG->CR |= RNG_CR_RNGEN;
+    PoolDrop = 1U;
+    return;
+  }
+  if((sr & RNG_SR_CEIS) != 0U)
+  {
+    RNG->SR = ~RNG_SR_CEIS;
+    PoolStats.ClockErrors++;
+  }
+
+  if((sr & (RNG_SR_DRDY | RNG_SR_SECS)) == RNG_SR_DRDY)
+  {
+    word = RNG->DR;
+    if(PoolDrop != 0U)
+    {
+      PoolDrop = 0U;
+    }
+    else if(word == PoolLast)
+    {
+      PoolStats.RepeatErrors++;
+    }
+    else if((PoolHead - PoolTail) < RNG_POOL_SIZE)
+    {
+      Pool[PoolHead & (RNG_POOL_SIZE - 1U)] = word;
+      PoolHead++;
+      PoolStats.Words++;
+    }
+    PoolLast = word;
+  }
+
+  if((PoolHead - PoolTail) >= RNG_POOL_SIZE)
+  {
+    /* Pool full: stop until words are taken */
+    RNG->CR &= ~RNG_CR_IE;
+  }
+}
+
+/**
+  * @brief  Remove words from the pool and restart the refill
+  * @param  pWords: destination
+  * @param  Count: words requested
+  * @retval Words removed
+  */
+static uint32_t RNG_Pool_Take(uint32_t *pWords, uint32_t Count)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint32_t avail;
+  uint32_t i;
+
+  __disable_irq();
+  avail = PoolHead - PoolTail;
+  Count = (Count < avail) ? Count : avail;
+  for(i = 0U; i < Count; i++)
+  {
+    pWords[i] = Pool[(PoolTail + i) & (RNG_POOL_SIZE - 1U)];
+    Pool[(PoolTail + i) & (RNG_POOL_SIZE - 1U)] = 0U;
+  }
+  PoolTail += Count;
+  RNG->CR |= RNG_CR_IE;
+  __set_PRIMASK(primask);
+
+  return Count;
+}
+
+/**
+  * @brief  One ChaCha20 block
+  * @param  pKey: 8 words key
+  * @param  Counter: block counter
+  * @param  pOut: 16 words of output
+  * @retval None
+  */
+static void RNG_Pool_Block(const uint32_t *pKey, uint32_t Counter, uint32_t *pOut)
+{
+  uint32_t x[16];
+  uint32_t i;
+
+  x[0]  = 0x61707865U;
+  x[1]  = 0x3320646eU;
+  x[2]  = 0x79622d32U;
+  x[3]  = 0x6b206574U;
+  for(i = 0U; i < 8U; i++)
+  {
+    x[4U + i] = pKey[i];
+  }
+  x[12] = Counter;
+  x[13] = 0U;
+  x[14] = 0U;
+  x[15] = 0U;
+  memcpy(pOut, x, sizeof(x));
+
+  for(i = 0U; i < 10U; i++)
+  {
+    RNG_QR(x[0], x[4], x[8],  x[12]);
+    RNG_QR(x[1], x[5], x[9],  x[13]);
+    RNG_QR(x[2], x[6], x[10], x[14]);
+    RNG_QR(x[3], x[7], x[11], x[15]);
+    RNG_QR(x[0], x[5], x[10], x[15]);
+    RNG_QR(x[1], x[6], x[11], x[12]);
+    RNG_QR(x[2], x[7], x[8],  x[13]);
+    RNG_QR(x[3], x[4], x[9],  x[14]);
+  }
+
+  for(i = 0U; i < 16U; i++)
+  {
+    pOut[i] += x[i];
+  }
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,85 @@
+/**
+  ******************************************************************************
+  * @file    rng_pool.h
+  * @author  MCD Application Team
+  * @brief   Header for rng_pool module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _RNG_POOL_H__
+#define _RNG_POOL_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#if !defined(RNG)
+#error "rng_pool requires a device with the RNG"
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t  Words;          /* Words delivered by the RNG and kept in the pool   */
+  uint32_t  SeedErrors;     /* Seed errors (SEIS), the RNG was restarted         */
+  uint32_t  ClockErrors;    /* Clock errors (CEIS)                               */
+  uint32_t  RepeatErrors;   /* Words equal to the previous one, discarded        */
+  uint32_t  Underruns;      /* RNG_Pool_Fill() calls served partially            */
+} RNG_Pool_StatsTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Pool size in 32-bit words, power of 2. Override in main.h. */
+#if !defined(RNG_POOL_SIZE)
+#define RNG_POOL_SIZE        64U
+#endif
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef RNG_Pool_Init(void);
+uint32_t          RNG_Pool_Fill(uint8_t *pBuffer, uint32_t Size);
+HAL_StatusTypeDef RNG_Pool_GetWord(uint32_t *pWord);
+uint32_t          RNG_Pool_Available(void);
+HAL_StatusTypeDef RNG_Pool_Expand(uint8_t *pBuffer, uint32_t Size);
+void              RNG_Pool_GetStats(RNG_Pool_StatsTypeDef *pStats);
+
+void RNG_Pool_IRQHandler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RNG_POOL_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,158 @@
+/**
+  ******************************************************************************
+  * @file    font_atlas.c
+  * @author  MCD Application Team
+  * @version V1.0.0
+  * @date    18-February-2014
+  * @brief   This file converts the 1 bit per pixel fonts into A8 or A4
+  *          glyph atlases, drawn by the DMA2D of the LCD drivers.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2014 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stddef.h>
+#include "fonts.h"
+
+/** @addtogroup Utilities
+  * @{
+  */
+  
+/** @addtogroup STM32_EVAL
+  * @{
+  */ 
+
+/** @addtogroup Common
+  * @{
+  */
+
+/** @addtogroup FONTS
+  * @brief      This file converts the fonts into glyph atlases.
+  * @{
+  */  
+
+/** @defgroup FONTS_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Converts a font into a glyph atlas.
+  * @note   Glyph pixels are stored row after row with no padding, so that a
+  *         glyph is read by the DMA2D with a null input offset. In A4 mode
+  *         the first pixel of each byte is in the low nibble.
+  * @param  pAtlas: Atlas to initialize
+  * @param  pFont: Source font
+  * @param  pData: Atlas memory, FONT_ATLAS_SIZE(pFont, ColorMode) bytes,
+  *         reachable by the DMA2D
+  * @param  ColorMode: FONT_ATLAS_A8 or FONT_ATLAS_A4
+  * @retval None
+  */
+void FONT_AtlasInit(FONT_AtlasTypeDef *pAtlas, sFONT *pFont, uint8_t *pData, uint32_t ColorMode)
+{
+  uint32_t glyph, row, column, pixel;
+  uint32_t bytes_per_row = (pFont->Width + 7) / 8;
+  const uint8_t *psrc;
+  uint8_t *pdst;
+  uint8_t on;
+  
+  pAtlas->pFont = pFont;
+  pAtlas->pData = pData;
+  pAtlas->ColorMode = ColorMode;
+  pAtlas->GlyphSize = FONT_ATLAS_GLYPH_SIZE(pFont, ColorMode);
+  
+  for(glyph = 0; glyph < FONT_ATLAS_CHAR_COUNT; glyph++)
+  {
+    psrc = &pFont->table[glyph * pFont->Height * bytes_per_row];
+    pdst = &pData[glyph * pAtlas->GlyphSize];
+    pixel = 0;
+    
+    for(row = 0; row < pFont->Height; row++)
+    {
+      for(column = 0; column < pFont->Width; column++)
+      {
+        /* Font rows are left aligned, most significant bit first */
+        on = (psrc[(row * bytes_per_row) + (column / 8)] & (0x80 >> (column % 8))) != 0;
+        
+        if(ColorMode == FONT_ATLAS_A4)
+        {
+          if((pixel & 1) == 0)
+          {
+            pdst[pixel / 2] = on ? 0x0F : 0x00;
+          }
+          else if(on)
+          {
+            pdst[pixel / 2] |= 0xF0;
+          }
+        }
+        else
+        {
+          pdst[pixel] = on ? 0xFF : 0x00;
+        }
+        pixel++;
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Gets the glyph of a character.
+  * @param  pAtlas: Glyph atlas
+  * @param  Ascii: Character ascii code, from ' ' to '~'
+  * @retval Pointer to the glyph, NULL if the character is not in the atlas
+  */
+const uint8_t *FONT_AtlasGetGlyph(FONT_AtlasTypeDef *pAtlas, uint8_t Ascii)
+{
+  if((Ascii < FONT_ATLAS_FIRST_CHAR) || (Ascii > FONT_ATLAS_LAST_CHAR))
+  {
+    return NULL;
+  }
+  return &pAtlas->pData[(Ascii - FONT_ATLAS_FIRST_CHAR) * pAtlas->GlyphSize];
+}
+
+/**
+  * @}
+  */ 
+
+/**
+  * @}
+  */ 
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
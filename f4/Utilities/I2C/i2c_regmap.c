@@ -0,0 +1,736 @@
+/**
+  ******************************************************************************
+  * @file    i2c_regmap.c
+  * @author  MCD Application Team
+  * @brief   Register map I2C and FMPI2C slave served by DMA, with commit callbacks
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- initialize the I2C (or FMPI2C) with HAL_I2C_Init(), own address set,
+   and link a DMA stream to each direction (hdmarx and hdmatx, normal mode,
+   byte transfers). Call I2C_RegMap_EV_IRQHandler() and
+   I2C_RegMap_ER_IRQHandler() from the I2C event and error interrupt
+   handlers in place of HAL_I2C_EV_IRQHandler() and HAL_I2C_ER_IRQHandler(),
+   and HAL_DMA_IRQHandler() from the DMA stream handlers. The HAL I2C
+   transfer functions must not be used on this handle afterwards.
+
+2- I2C_RegMap_Init() takes the register file: the master writes the
+   register address (AddrSize bytes, MSB first) then the data, and reads
+   from the last address written:
+     write: S addr+W reg data data ... P
+     read:  S addr+W reg Sr addr+R data data ... P (or S addr+R data ... P)
+   The address phase is handled by interrupt, then the data phase runs by
+   DMA straight between the bus and pRegs: no copy, no re-arm per byte, the
+   clock is only stretched for the address bytes.
+
+3- I2C_RegMap_Start() acknowledges the own address. At the end of a write
+   (stop or repeated start), I2C_RegMap_CommitCallback() gets the first
+   register and the number of bytes written: the only callback of the
+   module. Bytes written past WriteLimit are acknowledged and dropped, bytes
+   read past the end of the map are I2C_REGMAP_FILL.
+
+4- the application writes the read only registers in pRegs directly, or
+   with I2C_RegMap_Update() to keep a multi byte value from being read
+   while it changes.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "i2c_regmap.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define I2C_REGMAP_STATE_RESET    0U
+#define I2C_REGMAP_STATE_IDLE     1U  /* Waiting for the own address          */
+#define I2C_REGMAP_STATE_ADDRESS  2U  /* Register address bytes, by interrupt */
+#define I2C_REGMAP_STATE_WRITE    3U  /* Data written by the DMA              */
+#define I2C_REGMAP_STATE_DROP     4U  /* Data written dropped, by interrupt   */
+#define I2C_REGMAP_STATE_READ     5U  /* Data read by the DMA                 */
+#define I2C_REGMAP_STATE_FILL     6U  /* Data read past the map, by interrupt */
+
+/* Data requests of the peripheral */
+#define I2C_REGMAP_REQ_NONE       0U
+#define I2C_REGMAP_REQ_RX_IT      1U
+#define I2C_REGMAP_REQ_TX_IT      2U
+#define I2C_REGMAP_REQ_RX_DMA     3U
+#define I2C_REGMAP_REQ_TX_DMA     4U
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static I2C_RegMapTypeDef *RegMaps[I2C_REGMAP_MAX_INSTANCES];
+
+/* Private function prototypes -----------------------------------------------*/
+static void I2C_RegMap_Request(I2C_RegMapTypeDef *pMap, uint32_t Request);
+static void I2C_RegMap_BeginAddress(I2C_RegMapTypeDef *pMap);
+static void I2C_RegMap_BeginRead(I2C_RegMapTypeDef *pMap);
+static void I2C_RegMap_Receive(I2C_RegMapTypeDef *pMap, uint8_t Data);
+static void I2C_RegMap_End(I2C_RegMapTypeDef *pMap, uint32_t Commit);
+static I2C_RegMapTypeDef *I2C_RegMap_Find(DMA_HandleTypeDef *hdma);
+static void I2C_RegMap_DMARxCplt(DMA_HandleTypeDef *hdma);
+static void I2C_RegMap_DMATxCplt(DMA_HandleTypeDef *hdma);
+static void I2C_RegMap_DMAError(DMA_HandleTypeDef *hdma);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Bind a register file to an I2C or FMPI2C slave
+  * @param  pMap: register map context, kept by the module
+  * @param  pConfig: slave and register file, copied
+  * @retval HAL status
+  */
+HAL_StatusTypeDef I2C_RegMap_Init(I2C_RegMapTypeDef *pMap, const I2C_RegMap_ConfigTypeDef *pConfig)
+{
+  DMA_HandleTypeDef *hdmarx = NULL;
+  DMA_HandleTypeDef *hdmatx = NULL;
+  uint32_t slot = I2C_REGMAP_MAX_INSTANCES;
+  uint32_t i;
+
+  if ((pMap == NULL) || (pConfig == NULL) || (pConfig->pRegs == NULL) ||
+      (pConfig->Size == 0U) || (pConfig->Size > 0xFFFFU) || (pConfig->WriteLimit > pConfig->Size) ||
+      ((pConfig->AddrSize != 1U) && (pConfig->AddrSize != 2U)))
+  {
+    return HAL_ERROR;
+  }
+#if defined(HAL_I2C_MODULE_ENABLED)
+  if (pConfig->hi2c != NULL)
+  {
+    hdmarx = pConfig->hi2c->hdmarx;
+    hdmatx = pConfig->hi2c->hdmatx;
+  }
+#endif
+#if defined(I2C_REGMAP_USE_FMPI2C)
+  if (pConfig->hfmpi2c != NULL)
+  {
+    if (hdmarx != NULL)
+    {
+      return HAL_ERROR;
+    }
+    hdmarx = pConfig->hfmpi2c->hdmarx;
+    hdmatx = pConfig->hfmpi2c->hdmatx;
+  }
+#endif
+  if ((hdmarx == NULL) || (hdmatx == NULL) ||
+      (hdmarx->Init.Mode != DMA_NORMAL) || (hdmatx->Init.Mode != DMA_NORMAL))
+  {
+    return HAL_ERROR;
+  }
+
+  for (i = 0U; i < I2C_REGMAP_MAX_INSTANCES; i++)
+  {
+    if ((RegMaps[i] == pMap) || ((RegMaps[i] == NULL) && (slot == I2C_REGMAP_MAX_INSTANCES)))
+    {
+      slot = i;
+    }
+  }
+  if (slot == I2C_REGMAP_MAX_INSTANCES)
+  {
+    return HAL_ERROR;
+  }
+
+  memset(pMap, 0, sizeof(I2C_RegMapTypeDef));
+  pMap->Config = *pConfig;
+  pMap->hdmarx = hdmarx;
+  pMap->hdmatx = hdmatx;
+
+  hdmarx->XferCpltCallback     = I2C_RegMap_DMARxCplt;
+  hdmarx->XferHalfCpltCallback = NULL;
+  hdmarx->XferErrorCallback    = I2C_RegMap_DMAError;
+  hdmarx->XferAbortCallback    = NULL;
+  hdmatx->XferCpltCallback     = I2C_RegMap_DMATxCplt;
+  hdmatx->XferHalfCpltCallback = NULL;
+  hdmatx->XferErrorCallback    = I2C_RegMap_DMAError;
+  hdmatx->XferAbortCallback    = NULL;
+
+  RegMaps[slot] = pMap;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Release the slave
+  * @param  pMap: register map context
+  * @retval HAL status
+  */
+HAL_StatusTypeDef I2C_RegMap_DeInit(I2C_RegMapTypeDef *pMap)
+{
+  uint32_t i;
+
+  (void)I2C_RegMap_Stop(pMap);
+
+  for (i = 0U; i < I2C_REGMAP_MAX_INSTANCES; i++)
+  {
+    if (RegMaps[i] == pMap)
+    {
+      RegMaps[i] = NULL;
+    }
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Acknowledge the own address and serve the register file
+  * @param  pMap: register map context
+  * @retval HAL status
+  */
+HAL_StatusTypeDef I2C_RegMap_Start(I2C_RegMapTypeDef *pMap)
+{
+  if (pMap->State != I2C_REGMAP_STATE_RESET)
+  {
+    return HAL_BUSY;
+  }
+
+  pMap->State = I2C_REGMAP_STATE_IDLE;
+#if defined(HAL_I2C_MODULE_ENABLED)
+  if (pMap->Config.hi2c != NULL)
+  {
+    I2C_TypeDef *pI2c = pMap->Config.hi2c->Instance;
+
+    pI2c->CR1 |= I2C_CR1_PE | I2C_CR1_ACK;
+    pI2c->CR2 |= I2C_CR2_ITEVTEN | I2C_CR2_ITERREN;
+  }
+#endif
+#if defined(I2C_REGMAP_USE_FMPI2C)
+  if (pMap->Config.hfmpi2c != NULL)
+  {
+    FMPI2C_TypeDef *pI2c = pMap->Config.hfmpi2c->Instance;
+
+    pI2c->CR2 &= ~FMPI2C_CR2_NACK;
+    pI2c->CR1 |= FMPI2C_CR1_ADDRIE | FMPI2C_CR1_NACKIE | FMPI2C_CR1_STOPIE | FMPI2C_CR1_ERRIE;
+  }
+#endif
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop answering the own address, a transfer going on is dropped
+  * @param  pMap: register map context
+  * @retval HAL status
+  */
+HAL_StatusTypeDef I2C_RegMap_Stop(I2C_RegMapTypeDef *pMap)
+{
+#if defined(HAL_I2C_MODULE_ENABLED)
+  if (pMap->Config.hi2c != NULL)
+  {
+    I2C_TypeDef *pI2c = pMap->Config.hi2c->Instance;
+
+    pI2c->CR2 &= ~(I2C_CR2_ITEVTEN | I2C_CR2_ITERREN);
+    pI2c->CR1 &= ~I2C_CR1_ACK;
+  }
+#endif
+#if defined(I2C_REGMAP_USE_FMPI2C)
+  if (pMap->Config.hfmpi2c != NULL)
+  {
+    FMPI2C_TypeDef *pI2c = pMap->Config.hfmpi2c->Instance;
+
+    pI2c->CR1 &= ~(FMPI2C_CR1_ADDRIE | FMPI2C_CR1_NACKIE | FMPI2C_CR1_STOPIE | FMPI2C_CR1_ERRIE);
+    pI2c->CR2 |= FMPI2C_CR2_NACK;
+  }
+#endif
+
+  I2C_RegMap_End(pMap, 0U);
+  pMap->State = I2C_REGMAP_STATE_RESET;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Transaction going on
+  * @param  pMap: register map context
+  * @retval 1 from the own address to the end of the transaction
+  */
+uint32_t I2C_RegMap_IsBusy(I2C_RegMapTypeDef *pMap)
+{
+  return ((pMap->State != I2C_REGMAP_STATE_IDLE) && (pMap->State != I2C_REGMAP_STATE_RESET)) ? 1U : 0U;
+}
+
+/**
+  * @brief  Write registers unless a read of them is going on
+  * @param  pMap: register map context
+  * @param  Reg: first register
+  * @param  pData: register values
+  * @param  Length: bytes
+  * @retval HAL_OK, HAL_BUSY while the master reads from Reg on, HAL_ERROR
+  *         out of the map
+  */
+HAL_StatusTypeDef I2C_RegMap_Update(I2C_RegMapTypeDef *pMap, uint32_t Reg, const uint8_t *pData, uint32_t Length)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t primask;
+
+  if ((Reg >= pMap->Config.Size) || (Length > (pMap->Config.Size - Reg)))
+  {
+    return HAL_ERROR;
+  }
+
+  /* A read starts from the interrupt: no new one during the copy */
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if ((pMap->State == I2C_REGMAP_STATE_READ) && (pMap->Pointer < (Reg + Length)))
+  {
+    status = HAL_BUSY;
+  }
+  else
+  {
+    memcpy(&pMap->Config.pRegs[Reg], pData, Length);
+  }
+  __set_PRIMASK(primask);
+
+  return status;
+}
+
+/**
+  * @brief  I2C event interrupt
+  * @param  pMap: register map context
+  * @retval None
+  */
+void I2C_RegMap_EV_IRQHandler(I2C_RegMapTypeDef *pMap)
+{
+#if defined(HAL_I2C_MODULE_ENABLED)
+  if (pMap->Config.hi2c != NULL)
+  {
+    I2C_TypeDef *pI2c = pMap->Config.hi2c->Instance;
+    uint32_t sr1 = pI2c->SR1;
+    uint32_t bytewise = ((pI2c->CR2 & I2C_CR2_ITBUFEN) != 0U) ? 1U : (sr1 & I2C_SR1_BTF);
+
+    /* Byte transfers: address, dropped and filled bytes, and a byte the
+       DMA missed when it completed */
+    if (((sr1 & I2C_SR1_RXNE) != 0U) && (bytewise != 0U))
+    {
+      I2C_RegMap_Receive(pMap, (uint8_t)pI2c->DR);
+    }
+    else if (((sr1 & I2C_SR1_TXE) != 0U) && (bytewise != 0U) && ((sr1 & I2C_SR1_ADDR) == 0U))
+    {
+      pI2c->DR = I2C_REGMAP_FILL;
+      pMap->Overflows++;
+    }
+
+    if ((sr1 & I2C_SR1_STOPF) != 0U)
+    {
+      /* SR1 read then CR1 write clears STOPF */
+      pI2c->CR1 |= I2C_CR1_PE;
+      I2C_RegMap_End(pMap, 1U);
+    }
+
+    if ((sr1 & I2C_SR1_ADDR) != 0U)
+    {
+      /* A repeated start ends the write of the register address */
+      I2C_RegMap_End(pMap, 1U);
+
+      /* SR1 read then SR2 read clears ADDR, the transfer starts */
+      if ((pI2c->SR2 & I2C_SR2_TRA) != 0U)
+      {
+        I2C_RegMap_BeginRead(pMap);
+      }
+      else
+      {
+        I2C_RegMap_BeginAddress(pMap);
+      }
+    }
+  }
+#endif
+#if defined(I2C_REGMAP_USE_FMPI2C)
+  if (pMap->Config.hfmpi2c != NULL)
+  {
+    FMPI2C_TypeDef *pI2c = pMap->Config.hfmpi2c->Instance;
+    uint32_t isr = pI2c->ISR;
+    uint32_t cr1 = pI2c->CR1;
+
+    if (((isr & FMPI2C_ISR_RXNE) != 0U) && ((cr1 & FMPI2C_CR1_RXIE) != 0U))
+    {
+      I2C_RegMap_Receive(pMap, (uint8_t)pI2c->RXDR);
+    }
+    if (((isr & FMPI2C_ISR_TXIS) != 0U) && ((cr1 & FMPI2C_CR1_TXIE) != 0U))
+    {
+      pI2c->TXDR = I2C_REGMAP_FILL;
+      pMap->Overflows++;
+    }
+
+    /* The master acknowledges all the bytes it reads but the last one */
+    if ((isr & FMPI2C_ISR_NACKF) != 0U)
+    {
+      pI2c->ICR = FMPI2C_ICR_NACKCF;
+      I2C_RegMap_End(pMap, 1U);
+    }
+    if ((isr & FMPI2C_ISR_STOPF) != 0U)
+    {
+      pI2c->ICR = FMPI2C_ICR_STOPCF;
+      I2C_RegMap_End(pMap, 1U);
+    }
+
+    if ((isr & FMPI2C_ISR_ADDR) != 0U)
+    {
+      I2C_RegMap_End(pMap, 1U);
+      if ((isr & FMPI2C_ISR_DIR) != 0U)
+      {
+        /* Flush the byte the DMA wrote ahead in the previous read */
+        pI2c->ISR |= FMPI2C_ISR_TXE;
+        I2C_RegMap_BeginRead(pMap);
+      }
+      else
+      {
+        I2C_RegMap_BeginAddress(pMap);
+      }
+      /* Clock released from here */
+      pI2c->ICR = FMPI2C_ICR_ADDRCF;
+    }
+  }
+#endif
+}
+
+/**
+  * @brief  I2C error interrupt
+  * @param  pMap: register map context
+  * @retval None
+  */
+void I2C_RegMap_ER_IRQHandler(I2C_RegMapTypeDef *pMap)
+{
+#if defined(HAL_I2C_MODULE_ENABLED)
+  if (pMap->Config.hi2c != NULL)
+  {
+    I2C_TypeDef *pI2c = pMap->Config.hi2c->Instance;
+    uint32_t sr1 = pI2c->SR1;
+
+    /* Not acknowledged byte: end of a read, no stop flag follows it */
+    if ((sr1 & I2C_SR1_AF) != 0U)
+    {
+      pI2c->SR1 = ~I2C_SR1_AF;
+      I2C_RegMap_End(pMap, 1U);
+    }
+    if ((sr1 & (I2C_SR1_BERR | I2C_SR1_ARLO | I2C_SR1_OVR)) != 0U)
+    {
+      pI2c->SR1 = ~(sr1 & (I2C_SR1_BERR | I2C_SR1_ARLO | I2C_SR1_OVR));
+      pMap->Errors++;
+      I2C_RegMap_End(pMap, 0U);
+    }
+  }
+#endif
+#if defined(I2C_REGMAP_USE_FMPI2C)
+  if (pMap->Config.hfmpi2c != NULL)
+  {
+    FMPI2C_TypeDef *pI2c = pMap->Config.hfmpi2c->Instance;
+    uint32_t isr = pI2c->ISR & (FMPI2C_ISR_BERR | FMPI2C_ISR_ARLO | FMPI2C_ISR_OVR);
+
+    if (isr != 0U)
+    {
+      pI2c->ICR = isr;
+      pMap->Errors++;
+      I2C_RegMap_End(pMap, 0U);
+    }
+  }
+#endif
+}
+
+/**
+  * @brief  Registers written by the master
+  * @param  pMap: register map context
+  * @param  Reg: first register written
+  * @param  Length: bytes written
+  * @retval None
+  */
+__weak void I2C_RegMap_CommitCallback(I2C_RegMapTypeDef *pMap, uint32_t Reg, uint32_t Length)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(pMap);
+  UNUSED(Reg);
+  UNUSED(Length);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the I2C_RegMap_CommitCallback could be implemented in the user file
+   */
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Select the data requests of the peripheral
+  * @param  pMap: register map context
+  * @param  Request: I2C_REGMAP_REQ_x
+  * @retval None
+  */
+static void I2C_RegMap_Request(I2C_RegMapTypeDef *pMap, uint32_t Request)
+{
+#if defined(HAL_I2C_MODULE_ENABLED)
+  if (pMap->Config.hi2c != NULL)
+  {
+    I2C_TypeDef *pI2c = pMap->Config.hi2c->Instance;
+
+    if ((Request == I2C_REGMAP_REQ_RX_IT) || (Request == I2C_REGMAP_REQ_TX_IT))
+    {
+      pI2c->CR2 = (pI2c->CR2 & ~I2C_CR2_DMAEN) | I2C_CR2_ITBUFEN;
+    }
+    else if (Request == I2C_REGMAP_REQ_NONE)
+    {
+      pI2c->CR2 &= ~(I2C_CR2_DMAEN | I2C_CR2_ITBUFEN);
+    }
+    else
+    {
+      pI2c->CR2 = (pI2c->CR2 & ~I2C_CR2_ITBUFEN) | I2C_CR2_DMAEN;
+    }
+  }
+#endif
+#if defined(I2C_REGMAP_USE_FMPI2C)
+  if (pMap->Config.hfmpi2c != NULL)
+  {
+    FMPI2C_TypeDef *pI2c = pMap->Config.hfmpi2c->Instance;
+    uint32_t cr1 = pI2c->CR1 & ~(FMPI2C_CR1_RXIE | FMPI2C_CR1_TXIE | FMPI2C_CR1_RXDMAEN | FMPI2C_CR1_TXDMAEN);
+
+    switch (Request)
+    {
+      case I2C_REGMAP_REQ_RX_IT:  cr1 |= FMPI2C_CR1_RXIE;    break;
+      case I2C_REGMAP_REQ_TX_IT:  cr1 |= FMPI2C_CR1_TXIE;    break;
+      case I2C_REGMAP_REQ_RX_DMA: cr1 |= FMPI2C_CR1_RXDMAEN; break;
+      case I2C_REGMAP_REQ_TX_DMA: cr1 |= FMPI2C_CR1_TXDMAEN; break;
+      default:                                               break;
+    }
+    pI2c->CR1 = cr1;
+  }
+#endif
+}
+
+/**
+  * @brief  Write addressed: register address bytes by interrupt
+  * @param  pMap: register map context
+  * @retval None
+  */
+static void I2C_RegMap_BeginAddress(I2C_RegMapTypeDef *pMap)
+{
+  pMap->State = I2C_REGMAP_STATE_ADDRESS;
+  pMap->AddrBytes = 0U;
+  pMap->Length = 0U;
+  I2C_RegMap_Request(pMap, I2C_REGMAP_REQ_RX_IT);
+}
+
+/**
+  * @brief  Read addressed: registers from Pointer on by DMA
+  * @param  pMap: register map context
+  * @retval None
+  */
+static void I2C_RegMap_BeginRead(I2C_RegMapTypeDef *pMap)
+{
+  uint32_t txdr;
+
+#if defined(HAL_I2C_MODULE_ENABLED)
+  if (pMap->Config.hi2c != NULL)
+  {
+    txdr = (uint32_t)&pMap->Config.hi2c->Instance->DR;
+  }
+  else
+#endif
+  {
+#if defined(I2C_REGMAP_USE_FMPI2C)
+    txdr = (uint32_t)&pMap->Config.hfmpi2c->Instance->TXDR;
+#else
+    txdr = 0U;
+#endif
+  }
+
+  pMap->Reads++;
+  pMap->Length = 0U;
+  if ((pMap->Pointer < pMap->Config.Size) &&
+      (HAL_DMA_Start_IT(pMap->hdmatx, (uint32_t)&pMap->Config.pRegs[pMap->Pointer], txdr,
+                        pMap->Config.Size - pMap->Pointer) == HAL_OK))
+  {
+    pMap->State = I2C_REGMAP_STATE_READ;
+    I2C_RegMap_Request(pMap, I2C_REGMAP_REQ_TX_DMA);
+  }
+  else
+  {
+    pMap->State = I2C_REGMAP_STATE_FILL;
+    I2C_RegMap_Request(pMap, I2C_REGMAP_REQ_TX_IT);
+  }
+}
+
+/**
+  * @brief  Byte received by interrupt
+  * @param  pMap: register map context
+  * @param  Data: byte
+  * @retval None
+  */
+static void I2C_RegMap_Receive(I2C_RegMapTypeDef *pMap, uint8_t Data)
+{
+  uint32_t rxdr;
+
+  if (pMap->State != I2C_REGMAP_STATE_ADDRESS)
+  {
+    pMap->Overflows++;
+    return;
+  }
+
+  pMap->Pointer = (pMap->AddrBytes == 0U) ? Data : ((pMap->Pointer << 8U) | Data);
+  pMap->AddrBytes++;
+  if (pMap->AddrBytes < pMap->Config.AddrSize)
+  {
+    return;
+  }
+
+#if defined(HAL_I2C_MODULE_ENABLED)
+  if (pMap->Config.hi2c != NULL)
+  {
+    rxdr = (uint32_t)&pMap->Config.hi2c->Instance->DR;
+  }
+  else
+#endif
+  {
+#if defined(I2C_REGMAP_USE_FMPI2C)
+    rxdr = (uint32_t)&pMap->Config.hfmpi2c->Instance->RXDR;
+#else
+    rxdr = 0U;
+#endif
+  }
+
+  /* Data phase straight into the writable registers */
+  if ((pMap->Pointer < pMap->Config.WriteLimit) &&
+      (HAL_DMA_Start_IT(pMap->hdmarx, rxdr, (uint32_t)&pMap->Config.pRegs[pMap->Pointer],
+                        pMap->Config.WriteLimit - pMap->Pointer) == HAL_OK))
+  {
+    pMap->Length = pMap->Config.WriteLimit - pMap->Pointer;
+    pMap->State = I2C_REGMAP_STATE_WRITE;
+    I2C_RegMap_Request(pMap, I2C_REGMAP_REQ_RX_DMA);
+  }
+  else
+  {
+    pMap->State = I2C_REGMAP_STATE_DROP;
+  }
+}
+
+/**
+  * @brief  End of a transaction, or of the address write before a repeated
+  *         start
+  * @param  pMap: register map context
+  * @param  Commit: 1 to report the registers written
+  * @retval None
+  */
+static void I2C_RegMap_End(I2C_RegMapTypeDef *pMap, uint32_t Commit)
+{
+  uint32_t written = pMap->Length;
+
+  if ((pMap->State == I2C_REGMAP_STATE_IDLE) || (pMap->State == I2C_REGMAP_STATE_RESET))
+  {
+    return;
+  }
+
+  I2C_RegMap_Request(pMap, I2C_REGMAP_REQ_NONE);
+  if (pMap->hdmarx->State == HAL_DMA_STATE_BUSY)
+  {
+    written -= __HAL_DMA_GET_COUNTER(pMap->hdmarx);
+    (void)HAL_DMA_Abort(pMap->hdmarx);
+  }
+  if (pMap->hdmatx->State == HAL_DMA_STATE_BUSY)
+  {
+    (void)HAL_DMA_Abort(pMap->hdmatx);
+  }
+
+  if (((pMap->State == I2C_REGMAP_STATE_WRITE) || (pMap->State == I2C_REGMAP_STATE_DROP)) &&
+      (written != 0U) && (Commit != 0U))
+  {
+    pMap->Writes++;
+    pMap->State = I2C_REGMAP_STATE_IDLE;
+    I2C_RegMap_CommitCallback(pMap, pMap->Pointer, written);
+  }
+  pMap->State = I2C_REGMAP_STATE_IDLE;
+  pMap->Length = 0U;
+}
+
+/**
+  * @brief  Register map of a DMA stream
+  * @param  hdma: DMA handle
+  * @retval Register map context, NULL when none
+  */
+static I2C_RegMapTypeDef *I2C_RegMap_Find(DMA_HandleTypeDef *hdma)
+{
+  uint32_t i;
+
+  for (i = 0U; i < I2C_REGMAP_MAX_INSTANCES; i++)
+  {
+    if ((RegMaps[i] != NULL) && ((RegMaps[i]->hdmarx == hdma) || (RegMaps[i]->hdmatx == hdma)))
+    {
+      return RegMaps[i];
+    }
+  }
+
+  return NULL;
+}
+
+/**
+  * @brief  Last writable register written: drop the next bytes
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void I2C_RegMap_DMARxCplt(DMA_HandleTypeDef *hdma)
+{
+  I2C_RegMapTypeDef *pmap = I2C_RegMap_Find(hdma);
+
+  if ((pmap != NULL) && (pmap->State == I2C_REGMAP_STATE_WRITE))
+  {
+    pmap->State = I2C_REGMAP_STATE_DROP;
+    I2C_RegMap_Request(pmap, I2C_REGMAP_REQ_RX_IT);
+  }
+}
+
+/**
+  * @brief  Last register read: fill the next bytes
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void I2C_RegMap_DMATxCplt(DMA_HandleTypeDef *hdma)
+{
+  I2C_RegMapTypeDef *pmap = I2C_RegMap_Find(hdma);
+
+  if ((pmap != NULL) && (pmap->State == I2C_REGMAP_STATE_READ))
+  {
+    pmap->State = I2C_REGMAP_STATE_FILL;
+    I2C_RegMap_Request(pmap, I2C_REGMAP_REQ_TX_IT);
+  }
+}
+
+/**
+  * @brief  DMA error: the transaction ends with the next stop
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void I2C_RegMap_DMAError(DMA_HandleTypeDef *hdma)
+{
+  I2C_RegMapTypeDef *pmap = I2C_RegMap_Find(hdma);
+
+  if (pmap != NULL)
+  {
+    pmap->Errors++;
+  }
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,119 @@
+/**
+  ******************************************************************************
+  * @file    i2c_regmap.h
+  * @author  MCD Application Team
+  * @brief   Header for i2c_regmap module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _I2C_REGMAP_H__
+#define _I2C_REGMAP_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#if !defined(HAL_DMA_MODULE_ENABLED) || (!defined(HAL_I2C_MODULE_ENABLED) && !defined(HAL_FMPI2C_MODULE_ENABLED))
+#error "i2c_regmap requires the HAL DMA driver and the HAL I2C or FMPI2C driver"
+#endif
+
+#if defined(HAL_FMPI2C_MODULE_ENABLED) && defined(FMPI2C1)
+#define I2C_REGMAP_USE_FMPI2C
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+/* Register maps served at the same time. Override in main.h. */
+#if !defined(I2C_REGMAP_MAX_INSTANCES)
+#define I2C_REGMAP_MAX_INSTANCES  2U
+#endif
+
+/* Byte sent past the end of the map. Override in main.h. */
+#if !defined(I2C_REGMAP_FILL)
+#define I2C_REGMAP_FILL           0xFFU
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+#if defined(HAL_I2C_MODULE_ENABLED)
+  I2C_HandleTypeDef         *hi2c;              /* I2C slave, or NULL                             */
+#endif
+#if defined(I2C_REGMAP_USE_FMPI2C)
+  FMPI2C_HandleTypeDef      *hfmpi2c;           /* FMPI2C slave, or NULL                          */
+#endif
+  uint8_t                   *pRegs;             /* Register file, read and written by the DMA     */
+  uint32_t                  Size;               /* Bytes, 65535 at most                           */
+  uint32_t                  WriteLimit;         /* Registers from WriteLimit on are read only     */
+  uint32_t                  AddrSize;           /* Register address bytes, 1 or 2 (MSB first)     */
+} I2C_RegMap_ConfigTypeDef;
+
+typedef struct
+{
+  I2C_RegMap_ConfigTypeDef  Config;
+  DMA_HandleTypeDef         *hdmarx;
+  DMA_HandleTypeDef         *hdmatx;
+  __IO uint32_t             State;
+  uint32_t                  Pointer;            /* Register address of the transfers              */
+  uint32_t                  AddrBytes;          /* Address bytes received in this write           */
+  uint32_t                  Length;             /* Bytes given to the DMA                         */
+  uint32_t                  Writes;             /* Write transactions with data                   */
+  uint32_t                  Reads;              /* Read transactions                              */
+  uint32_t                  Overflows;          /* Bytes out of the map or read only, dropped or
+                                                   filled                                         */
+  uint32_t                  Errors;             /* Bus errors, arbitration losses, overruns       */
+} I2C_RegMapTypeDef;
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef I2C_RegMap_Init(I2C_RegMapTypeDef *pMap, const I2C_RegMap_ConfigTypeDef *pConfig);
+HAL_StatusTypeDef I2C_RegMap_DeInit(I2C_RegMapTypeDef *pMap);
+HAL_StatusTypeDef I2C_RegMap_Start(I2C_RegMapTypeDef *pMap);
+HAL_StatusTypeDef I2C_RegMap_Stop(I2C_RegMapTypeDef *pMap);
+uint32_t          I2C_RegMap_IsBusy(I2C_RegMapTypeDef *pMap);
+HAL_StatusTypeDef I2C_RegMap_Update(I2C_RegMapTypeDef *pMap, uint32_t Reg, const uint8_t *pData, uint32_t Length);
+
+void I2C_RegMap_EV_IRQHandler(I2C_RegMapTypeDef *pMap);
+void I2C_RegMap_ER_IRQHandler(I2C_RegMapTypeDef *pMap);
+
+void I2C_RegMap_CommitCallback(I2C_RegMapTypeDef *pMap, uint32_t Reg, uint32_t Length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _I2C_REGMAP_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,504 @@
+/**
+  ******************************************************************************
+  * @file    io_cache.c
+  * @author  MCD Application Team
+  * @brief   IO expander shadow registers: pin writes are merged into one I2C
+  *          burst per flush, pin reads return the state cached on the
+  *          expander interrupt.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- configure the expander pins with BSP_IO_Init() and BSP_IO_ConfigPin():
+   outputs, and inputs with an interrupt (IO_MODE_IT_xxx) for those read
+   through the cache. Initialize the I2C of the expander with
+   HAL_I2C_Init() and call IO_Cache_Init() with the expander type and
+   IO_I2C_ADDRESS. The BSP uses its own handle of this bus: the BSP IO
+   functions must not be called while the cache is used.
+
+2- IO_Cache_WritePin() and IO_Cache_TogglePin() only update the shadow
+   output register. IO_Cache_Process(), called once per tick or per frame,
+   sends the pins changed since the previous call in one burst: GPSR on the
+   STMPE1600, SET_PIN and CLR_PIN on the STMPE811, GPO_SET then GPO_CLR on
+   the MFXSTM32L152 (one burst per direction). A pin written back to its
+   previous level before the flush costs nothing.
+
+3- call IO_Cache_IRQHandler() from HAL_GPIO_EXTI_Callback() for the
+   expander interrupt output (MFX_IRQOUT_PIN, IO_IT_PIN...): it only marks
+   the cache stale. The next IO_Cache_Process() reads and acknowledges the
+   interrupt status and reads all the input levels in a burst.
+   IO_Cache_ReadPin() returns the cached levels without bus access, and
+   IO_Cache_GetChanged() the pins interrupted since its previous call.
+
+4- IO_Cache_Refresh() reads the input levels at once, for inputs without
+   interrupt. IO_Cache_Flush() sends the pending writes at once.
+
+The shadow registers may be written from interrupts. IO_Cache_Process(),
+IO_Cache_Flush() and IO_Cache_Refresh() use the I2C in polling mode: call
+them from the thread context.
+*******************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include "io_cache.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define MFX_REG_IRQ_GPI_PENDING1    0x0CU
+#define MFX_REG_GPIO_STATE1         0x10U
+#define MFX_REG_IRQ_GPI_ACK1        0x54U
+#define MFX_REG_GPO_SET1            0x6CU
+#define MFX_REG_GPO_CLR1            0x70U
+#define MFX_PINS                    0x00FFFFFFU
+
+#define STMPE1600_REG_ISGPIOR       0x0AU   /* Cleared by the read */
+#define STMPE1600_REG_GPMR          0x10U
+#define STMPE1600_REG_GPSR          0x12U
+#define STMPE1600_PINS              0x0000FFFFU
+
+#define STMPE811_REG_INT_STA        0x0BU
+#define STMPE811_REG_IO_INT_STA     0x0DU
+#define STMPE811_REG_IO_SET_PIN     0x10U
+#define STMPE811_REG_IO_MP_STA      0x12U
+#define STMPE811_GIT_IO             0x80U
+#define STMPE811_PINS               0x000000FFU
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static HAL_StatusTypeDef IO_Cache_Read(IO_CacheTypeDef *pCache, uint8_t Reg, uint8_t *pData, uint16_t Size);
+static HAL_StatusTypeDef IO_Cache_Write(IO_CacheTypeDef *pCache, uint8_t Reg, uint8_t *pData, uint16_t Size);
+static HAL_StatusTypeDef IO_Cache_ReadInputs(IO_CacheTypeDef *pCache, uint32_t Acknowledge);
+static uint32_t          IO_Cache_Unpack(const uint8_t *pData, uint32_t Size);
+static void              IO_Cache_Pack(uint32_t Value, uint8_t *pData, uint32_t Size);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Attach a cache to an expander and read its state
+  * @param  pCache: Cache of the expander
+  * @param  hi2c: I2C handle of the expander bus, initialized
+  * @param  Address: Expander address, 8-bit as the HAL
+  * @param  Expander: IO_CACHE_MFXSTM32L152, IO_CACHE_STMPE1600 or IO_CACHE_STMPE811
+  * @retval HAL status
+  */
+HAL_StatusTypeDef IO_Cache_Init(IO_CacheTypeDef *pCache, I2C_HandleTypeDef *hi2c, uint16_t Address,
+                                uint32_t Expander)
+{
+  uint8_t data[2];
+
+  if((hi2c == NULL) || (Expander > IO_CACHE_STMPE811))
+  {
+    return HAL_ERROR;
+  }
+
+  pCache->hi2c      = hi2c;
+  pCache->Address   = Address;
+  pCache->Expander  = (uint16_t)Expander;
+  pCache->Dirty     = 0U;
+  pCache->Changed   = 0U;
+  pCache->Stale     = 0U;
+  pCache->Transfers = 0U;
+  pCache->Errors    = 0U;
+
+  /* Acknowledge the interrupts pending before the cache existed */
+  if(IO_Cache_ReadInputs(pCache, 1U) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+  pCache->Changed = 0U;
+
+  /* Output levels: GPSR on the STMPE1600, the pin levels otherwise */
+  if(Expander == IO_CACHE_STMPE1600)
+  {
+    if(IO_Cache_Read(pCache, STMPE1600_REG_GPSR, data, 2U) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+    pCache->Output = IO_Cache_Unpack(data, 2U);
+  }
+  else
+  {
+    pCache->Output = pCache->Input;
+  }
+  pCache->Written = pCache->Output;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Set output pins in the shadow register, sent by the next flush
+  * @param  pCache: Cache of the expander
+  * @param  IoPin: IO_PIN_x, several may be combined
+  * @param  PinState: 0 low, other values high
+  * @retval None
+  */
+void IO_Cache_WritePin(IO_CacheTypeDef *pCache, uint32_t IoPin, uint32_t PinState)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  if(PinState != 0U)
+  {
+    pCache->Output |= IoPin;
+  }
+  else
+  {
+    pCache->Output &= ~IoPin;
+  }
+  pCache->Dirty |= IoPin;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Toggle output pins in the shadow register, sent by the next flush
+  * @param  pCache: Cache of the expander
+  * @param  IoPin: IO_PIN_x, several may be combined
+  * @retval None
+  */
+void IO_Cache_TogglePin(IO_CacheTypeDef *pCache, uint32_t IoPin)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  pCache->Output ^= IoPin;
+  pCache->Dirty  |= IoPin;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Read pins from the cache, without bus access
+  * @param  pCache: Cache of the expander
+  * @param  IoPin: IO_PIN_x, several may be combined
+  * @retval Levels of the pins at the last refresh, masked by IoPin
+  */
+uint32_t IO_Cache_ReadPin(IO_CacheTypeDef *pCache, uint32_t IoPin)
+{
+  return pCache->Input & IoPin;
+}
+
+/**
+  * @brief  Get the pins interrupted since the previous call
+  * @param  pCache: Cache of the expander
+  * @retval IO_PIN_x mask
+  */
+uint32_t IO_Cache_GetChanged(IO_CacheTypeDef *pCache)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint32_t changed;
+
+  __disable_irq();
+  changed = pCache->Changed;
+  pCache->Changed = 0U;
+  __set_PRIMASK(primask);
+
+  return changed;
+}
+
+/**
+  * @brief  Expander interrupt, call from HAL_GPIO_EXTI_Callback()
+  * @param  pCache: Cache of the expander
+  * @retval None
+  */
+void IO_Cache_IRQHandler(IO_CacheTypeDef *pCache)
+{
+  pCache->Stale = 1U;
+}
+
+/**
+  * @brief  Serve the expander interrupt and send the pending writes
+  * @param  pCache: Cache of the expander
+  * @retval HAL status
+  */
+HAL_StatusTypeDef IO_Cache_Process(IO_CacheTypeDef *pCache)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if(pCache->Stale != 0U)
+  {
+    /* Cleared first: an interrupt during the read is served next time */
+    pCache->Stale = 0U;
+    if(IO_Cache_ReadInputs(pCache, 1U) != HAL_OK)
+    {
+      pCache->Stale = 1U;
+      status = HAL_ERROR;
+    }
+  }
+
+  if(IO_Cache_Flush(pCache) != HAL_OK)
+  {
+    status = HAL_ERROR;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Send the output pins changed since the previous flush
+  * @param  pCache: Cache of the expander
+  * @retval HAL status, the pins are sent again by the next flush on error
+  */
+HAL_StatusTypeDef IO_Cache_Flush(IO_CacheTypeDef *pCache)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t primask = __get_PRIMASK();
+  uint32_t output, changed, set, clear;
+  uint8_t data[3];
+
+  __disable_irq();
+  output  = pCache->Output;
+  changed = pCache->Dirty & (output ^ pCache->Written);
+  pCache->Dirty = 0U;
+  __set_PRIMASK(primask);
+
+  if(changed == 0U)
+  {
+    return HAL_OK;
+  }
+  set   = output & changed;
+  clear = ~output & changed;
+
+  switch(pCache->Expander)
+  {
+  case IO_CACHE_MFXSTM32L152:
+    if(set != 0U)
+    {
+      IO_Cache_Pack(set, data, 3U);
+      status = IO_Cache_Write(pCache, MFX_REG_GPO_SET1, data, 3U);
+    }
+    if((clear != 0U) && (status == HAL_OK))
+    {
+      IO_Cache_Pack(clear & MFX_PINS, data, 3U);
+      status = IO_Cache_Write(pCache, MFX_REG_GPO_CLR1, data, 3U);
+    }
+    break;
+
+  case IO_CACHE_STMPE1600:
+    /* The output register holds all the pins */
+    IO_Cache_Pack(output & STMPE1600_PINS, data, 2U);
+    status = IO_Cache_Write(pCache, STMPE1600_REG_GPSR, data, 2U);
+    break;
+
+  default:
+    /* IO_SET_PIN then IO_CLR_PIN */
+    data[0] = (uint8_t)(set & STMPE811_PINS);
+    data[1] = (uint8_t)(clear & STMPE811_PINS);
+    status = IO_Cache_Write(pCache, STMPE811_REG_IO_SET_PIN, data, 2U);
+    break;
+  }
+
+  if(status == HAL_OK)
+  {
+    pCache->Written = (pCache->Written & ~changed) | set;
+  }
+  else
+  {
+    __disable_irq();
+    pCache->Dirty |= changed;
+    __set_PRIMASK(primask);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Read the input levels at once
+  * @param  pCache: Cache of the expander
+  * @retval HAL status
+  */
+HAL_StatusTypeDef IO_Cache_Refresh(IO_CacheTypeDef *pCache)
+{
+  return IO_Cache_ReadInputs(pCache, 0U);
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Read expander registers
+  * @param  pCache: Cache of the expander
+  * @param  Reg: First register
+  * @param  pData: Register values
+  * @param  Size: Number of registers
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef IO_Cache_Read(IO_CacheTypeDef *pCache, uint8_t Reg, uint8_t *pData, uint16_t Size)
+{
+  pCache->Transfers++;
+  if(HAL_I2C_Mem_Read(pCache->hi2c, pCache->Address, Reg, I2C_MEMADD_SIZE_8BIT, pData, Size,
+                      IO_CACHE_TIMEOUT) != HAL_OK)
+  {
+    pCache->Errors++;
+    return HAL_ERROR;
+  }
+  return HAL_OK;
+}
+
+/**
+  * @brief  Write expander registers
+  * @param  pCache: Cache of the expander
+  * @param  Reg: First register
+  * @param  pData: Register values
+  * @param  Size: Number of registers
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef IO_Cache_Write(IO_CacheTypeDef *pCache, uint8_t Reg, uint8_t *pData, uint16_t Size)
+{
+  pCache->Transfers++;
+  if(HAL_I2C_Mem_Write(pCache->hi2c, pCache->Address, Reg, I2C_MEMADD_SIZE_8BIT, pData, Size,
+                       IO_CACHE_TIMEOUT) != HAL_OK)
+  {
+    pCache->Errors++;
+    return HAL_ERROR;
+  }
+  return HAL_OK;
+}
+
+/**
+  * @brief  Read the input levels, and the interrupt status
+  * @param  pCache: Cache of the expander
+  * @param  Acknowledge: Read and acknowledge the pin interrupts
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef IO_Cache_ReadInputs(IO_CacheTypeDef *pCache, uint32_t Acknowledge)
+{
+  uint32_t pending = 0U, primask;
+  uint8_t data[3];
+
+  switch(pCache->Expander)
+  {
+  case IO_CACHE_MFXSTM32L152:
+    if(Acknowledge != 0U)
+    {
+      if(IO_Cache_Read(pCache, MFX_REG_IRQ_GPI_PENDING1, data, 3U) != HAL_OK)
+      {
+        return HAL_ERROR;
+      }
+      pending = IO_Cache_Unpack(data, 3U);
+      if((pending != 0U) && (IO_Cache_Write(pCache, MFX_REG_IRQ_GPI_ACK1, data, 3U) != HAL_OK))
+      {
+        return HAL_ERROR;
+      }
+    }
+    if(IO_Cache_Read(pCache, MFX_REG_GPIO_STATE1, data, 3U) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+    pCache->Input = IO_Cache_Unpack(data, 3U);
+    break;
+
+  case IO_CACHE_STMPE1600:
+    if(Acknowledge != 0U)
+    {
+      if(IO_Cache_Read(pCache, STMPE1600_REG_ISGPIOR, data, 2U) != HAL_OK)
+      {
+        return HAL_ERROR;
+      }
+      pending = IO_Cache_Unpack(data, 2U);
+    }
+    if(IO_Cache_Read(pCache, STMPE1600_REG_GPMR, data, 2U) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+    pCache->Input = IO_Cache_Unpack(data, 2U);
+    break;
+
+  default:
+    if(Acknowledge != 0U)
+    {
+      if(IO_Cache_Read(pCache, STMPE811_REG_IO_INT_STA, data, 1U) != HAL_OK)
+      {
+        return HAL_ERROR;
+      }
+      pending = data[0];
+      data[1] = STMPE811_GIT_IO;
+      if(((pending != 0U) && (IO_Cache_Write(pCache, STMPE811_REG_IO_INT_STA, &data[0], 1U) != HAL_OK)) ||
+         (IO_Cache_Write(pCache, STMPE811_REG_INT_STA, &data[1], 1U) != HAL_OK))
+      {
+        return HAL_ERROR;
+      }
+    }
+    if(IO_Cache_Read(pCache, STMPE811_REG_IO_MP_STA, data, 1U) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+    pCache->Input = data[0];
+    break;
+  }
+
+  if(pending != 0U)
+  {
+    primask = __get_PRIMASK();
+    __disable_irq();
+    pCache->Changed |= pending;
+    __set_PRIMASK(primask);
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Pins from consecutive registers, first register for pins 0 to 7
+  * @param  pData: Register values
+  * @param  Size: Number of registers
+  * @retval Pin mask
+  */
+static uint32_t IO_Cache_Unpack(const uint8_t *pData, uint32_t Size)
+{
+  uint32_t value = 0U;
+
+  while(Size > 0U)
+  {
+    Size--;
+    value = (value << 8) | pData[Size];
+  }
+
+  return value;
+}
+
+/**
+  * @brief  Pin mask to consecutive registers, first register for pins 0 to 7
+  * @param  Value: Pin mask
+  * @param  pData: Register values
+  * @param  Size: Number of registers
+  * @retval None
+  */
+static void IO_Cache_Pack(uint32_t Value, uint8_t *pData, uint32_t Size)
+{
+  uint32_t i;
+
+  for(i = 0U; i < Size; i++)
+  {
+    pData[i] = (uint8_t)(Value >> (8U * i));
+  }
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,111 @@
+/**
+  ******************************************************************************
+  * @file    os_mail.h
+  * @author  MCD Application Team
+  * @brief   Header for os_mail module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _OS_MAIL_H__
+#define _OS_MAIL_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#if defined(OS_MAIL_STATIC)
+#include "cmsis_os.h"
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+/* Fixed size block pool, 4 words */
+typedef struct
+{
+  __IO uint32_t       Head;       /* Free list: tag in bits 31:16, first free block in 15:0 */
+  uint32_t            Count;      /* Number of blocks                                        */
+  uint32_t            Stride;     /* Bytes from one block to the next                        */
+  uint8_t             *pBlocks;
+} OS_PoolTypeDef;
+
+typedef struct
+{
+  __IO uint32_t       Seq;        /* Position it can be written at, or position + 1 once written */
+  void                *pMail;
+} OS_MailQ_SlotTypeDef;
+
+/* Mail queue: blocks of a pool passed by pointer, 8 words */
+typedef struct
+{
+  OS_PoolTypeDef      Pool;
+  __IO uint32_t       Head;       /* Next position read                                      */
+  __IO uint32_t       Tail;       /* Next position written                                   */
+  uint32_t            Mask;       /* Slots - 1, slots a power of 2 not below the block count */
+  OS_MailQ_SlotTypeDef *pSlots;
+} OS_MailQTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+#define OS_POOL_MAX_BLOCKS    0xFFFFU
+
+/* Yield while osMailAlloc() or osMailGet() wait for a block or a mail, one
+   kernel tick by default. Override in main.h. */
+#if !defined(OS_MAIL_WAIT)
+#define OS_MAIL_WAIT()        (void)osDelay(1U)
+#endif
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Storage, in 32-bit words, of the blocks of a pool of __COUNT__ items of
+   __SIZE__ bytes, and of the slots of a mail queue of __COUNT__ mails */
+#define OS_POOL_BLOCK_WORDS(__COUNT__, __SIZE__)  ((__COUNT__) * (((__SIZE__) + 3U) / 4U))
+#define OS_MAILQ_SLOT_WORDS(__COUNT__)            (4U * (__COUNT__))
+
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef OS_Pool_Init(OS_PoolTypeDef *pPool, uint32_t *pBlocks, uint32_t Count, uint32_t Size);
+void              *OS_Pool_Alloc(OS_PoolTypeDef *pPool);
+HAL_StatusTypeDef OS_Pool_Free(OS_PoolTypeDef *pPool, void *pBlock);
+
+HAL_StatusTypeDef OS_MailQ_Init(OS_MailQTypeDef *pQueue, uint32_t *pBlocks, uint32_t *pSlots,
+                                uint32_t Count, uint32_t Size);
+void              *OS_MailQ_Alloc(OS_MailQTypeDef *pQueue);
+HAL_StatusTypeDef OS_MailQ_Put(OS_MailQTypeDef *pQueue, void *pMail);
+void              *OS_MailQ_Get(OS_MailQTypeDef *pQueue);
+HAL_StatusTypeDef OS_MailQ_Free(OS_MailQTypeDef *pQueue, void *pMail);
+uint32_t          OS_MailQ_GetCount(OS_MailQTypeDef *pQueue);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _OS_MAIL_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -74,6 +74,22 @@
 #else
  #define     LCD_CACHE_DEPTH     YWINDOW_SIZE
 #endif
+
+#if !defined(LCD_LOG_USE_DMA2D)
+ #define     LCD_LOG_USE_DMA2D   0
+#endif
+
+#if !defined(LCD_LOG_USE_QUEUE)
+ #define     LCD_LOG_USE_QUEUE   0
+#endif
+
+#if (LCD_LOG_USE_DMA2D == 1) && !(defined(DMA2D) && defined(LTDC))
+ #error "LCD_LOG_USE_DMA2D requires a device with LTDC and DMA2D"
+#endif
+
+#if (LCD_LOG_USE_QUEUE == 1) && !defined(LCD_LOG_QUEUE_SIZE)
+ #define     LCD_LOG_QUEUE_SIZE  512
+#endif
 /**
   * @}
   */ 
@@ -140,6 +156,9 @@ void LCD_LOG_UpdateDisplay (void);
  ErrorStatus LCD_LOG_ScrollBack(void);
  ErrorStatus LCD_LOG_ScrollForward(void);
 #endif
+#if (LCD_LOG_USE_QUEUE == 1)
+void LCD_LOG_Process(void);
+#endif
 /**
   * @}
   */ 
@@ -89,6 +89,18 @@
   #error "Wrong YWINDOW SIZE"
 #endif
 
+/* Set to 1 to scroll the text zone with one DMA2D transfer and to redraw only
+   the lines that changed (devices with LTDC and DMA2D only) */
+#define     LCD_LOG_USE_DMA2D       0
+/* LTDC layer holding the text zone: 0 or 1 */
+#define     LCD_LOG_LAYER           0
+
+/* Set to 1 to queue the characters written by printf and draw them later from
+   LCD_LOG_Process(), called by a low priority task */
+#define     LCD_LOG_USE_QUEUE       0
+/* Number of queued characters, must be a power of 2 */
+#define     LCD_LOG_QUEUE_SIZE      512
+
 /* Redirect the printf to the LCD */
 #ifdef __GNUC__
 /* With GCC/RAISONANCE, small printf (option LD Linker->Libraries->Small printf
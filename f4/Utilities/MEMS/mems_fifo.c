@@ -0,0 +1,513 @@
+/**
+  ******************************************************************************
+  * @file    mems_fifo.c
+  * @author  MCD Application Team
+  * @brief   FIFO watermark streaming of MEMS sensors: the whole FIFO is read in
+  *          one DMA burst on the watermark interrupt and delivered as
+  *          timestamped sample blocks.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- configure the sensor output data rate and full scale with the component
+   driver, e.g. BSP_GYRO_Init() or BSP_ACCELERO_Init(). The FIFO lets the
+   sensor run at its highest rates (L3GD20 760 Hz, LIS3DSH 1.6 kHz,
+   LSM303DLHC 5.376 kHz in low power mode) with one bus transaction per
+   Watermark samples instead of one per sample.
+
+2- SPI sensors (L3GD20, LIS3DSH): initialize the SPI and its spi_queue,
+   with DMA handles linked, and give the queue, the chip select pin and the
+   prescaler. The SPI is used in mode 3, supported by both sensors. Other
+   devices of the bus keep using the queue between the bursts.
+   I2C sensor (LSM303DLHC accelerometer): initialize the I2C with a Rx DMA
+   handle linked and call MEMS_FIFO_I2C_RxCpltCallback() and
+   MEMS_FIFO_I2C_ErrorCallback() from HAL_I2C_MemRxCpltCallback() and
+   HAL_I2C_ErrorCallback().
+   LIS302DL has no FIFO and is not supported.
+
+3- configure the sensor interrupt pin as EXTI rising edge and call
+   MEMS_FIFO_IRQHandler() from HAL_GPIO_EXTI_Callback() for this pin:
+   (+) L3GD20: INT2 (GYRO_INT2_PIN on STM32F429I-Discovery)
+   (+) LIS3DSH, LSM303DLHC: INT1
+   The EXTI must have the preemption priority of the bus interrupts.
+
+4- set Watermark and Callback and call MEMS_FIFO_Start(): the FIFO is set
+   in stream mode with its watermark routed to the interrupt pin. On each
+   interrupt the FIFO level is read, then all the stored samples in one
+   burst: the sensors roll the address back from OUT_Z_H to OUT_X_L while
+   the FIFO is enabled. Callback is called from the interrupt with the
+   block, valid until it returns. Levels at or above the watermark are read
+   again at once: the interrupt line stays high until the level falls
+   below the watermark.
+
+5- the block Timestamp is the DWT cycle counter when the level was read,
+   the time of the newest sample. Index numbers the samples, Overrun flags
+   samples lost when the FIFO was full: the sample times are recovered
+   from Index and the output data rate.
+
+The sample buffer is a DMA target: the sensor structure must not be placed
+in the CCM RAM.
+*******************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include "mems_fifo.h"
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  uint8_t   Reg;
+  uint8_t   Set;        /* Bits set by MEMS_FIFO_Start()   */
+  uint8_t   Clear;      /* Bits cleared by MEMS_FIFO_Stop() */
+} MEMS_FIFO_BitsTypeDef;
+
+typedef struct
+{
+  MEMS_FIFO_BitsTypeDef Bits[2];   /* FIFO enable and watermark interrupt */
+  uint8_t               Stream;    /* FIFO_CTRL stream mode               */
+  uint8_t               Read;      /* Read with address increment         */
+} MEMS_FIFO_RegsTypeDef;
+
+/* Private define ------------------------------------------------------------*/
+#define MEMS_FIFO_STATE_IDLE      0U
+#define MEMS_FIFO_STATE_STATUS    1U
+#define MEMS_FIFO_STATE_DATA      2U
+#define MEMS_FIFO_STATE_STOPPED   3U
+
+#define MEMS_REG_OUT_X_L          0x28U
+#define MEMS_REG_FIFO_CTRL        0x2EU
+#define MEMS_REG_FIFO_SRC         0x2FU
+
+#define MEMS_FIFO_SRC_OVRN        0x40U
+#define MEMS_FIFO_SRC_FSS         0x1FU
+#define MEMS_FIFO_DEPTH           32U
+
+/* Private macro -------------------------------------------------------------*/
+#define MEMS_FIFO_IS_SPI(__SENSOR__)  ((__SENSOR__)->Sensor != MEMS_FIFO_LSM303DLHC)
+
+/* Private variables ---------------------------------------------------------*/
+static const MEMS_FIFO_RegsTypeDef MEMS_FIFO_Regs[3] =
+{
+  /* L3GD20: CTRL_REG5 FIFO_EN, CTRL_REG3 I2_WTM, SPI read 0x80 with MS 0x40 */
+  { { { 0x24U, 0x40U, 0x40U }, { 0x22U, 0x04U, 0x04U } }, 0x40U, 0xC0U },
+  /* LIS3DSH: CTRL_REG6 FIFO_EN, ADD_INC and P1_WTM, CTRL_REG3 INT1_EN and IEA */
+  { { { 0x25U, 0x54U, 0x44U }, { 0x23U, 0x48U, 0x08U } }, 0x40U, 0x80U },
+  /* LSM303DLHC: CTRL_REG5_A FIFO_EN, CTRL_REG3_A I1_WTM, I2C sub-address MSB */
+  { { { 0x24U, 0x40U, 0x40U }, { 0x22U, 0x04U, 0x04U } }, 0x80U, 0x80U },
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static HAL_StatusTypeDef MEMS_FIFO_ReadReg(MEMS_FIFO_SensorTypeDef *pSensor, uint8_t Reg, uint8_t *pValue);
+static HAL_StatusTypeDef MEMS_FIFO_WriteReg(MEMS_FIFO_SensorTypeDef *pSensor, uint8_t Reg, uint8_t Value);
+static HAL_StatusTypeDef MEMS_FIFO_SpiTransfer(MEMS_FIFO_SensorTypeDef *pSensor, uint8_t *pRx, uint16_t Size,
+                                               void (*Callback)(SPI_Queue_JobTypeDef *pJob));
+static void              MEMS_FIFO_ReadStatus(MEMS_FIFO_SensorTypeDef *pSensor);
+static void              MEMS_FIFO_Done(MEMS_FIFO_SensorTypeDef *pSensor, HAL_StatusTypeDef Status);
+static void              MEMS_FIFO_Finish(MEMS_FIFO_SensorTypeDef *pSensor);
+static void              MEMS_FIFO_SpiDone(SPI_Queue_JobTypeDef *pJob);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Start the FIFO streaming of a sensor
+  * @param  pSensor: Sensor, its application fields set
+  * @retval HAL status
+  */
+HAL_StatusTypeDef MEMS_FIFO_Start(MEMS_FIFO_SensorTypeDef *pSensor)
+{
+  const MEMS_FIFO_RegsTypeDef *pregs;
+  uint8_t value;
+  uint32_t i;
+
+  if((pSensor->Sensor > MEMS_FIFO_LSM303DLHC) || (pSensor->Callback == NULL) ||
+     (pSensor->Watermark == 0U) || (pSensor->Watermark >= MEMS_FIFO_DEPTH) ||
+     (MEMS_FIFO_IS_SPI(pSensor) ? (pSensor->pSpiQueue == NULL) : (pSensor->hi2c == NULL)))
+  {
+    return HAL_ERROR;
+  }
+  pregs = &MEMS_FIFO_Regs[pSensor->Sensor];
+
+  pSensor->State    = MEMS_FIFO_STATE_STOPPED;
+  pSensor->Pending  = 0U;
+  pSensor->Index    = 0U;
+  pSensor->Overrun  = 0U;
+  pSensor->Bursts   = 0U;
+  pSensor->Overruns = 0U;
+  pSensor->Errors   = 0U;
+
+  /* Timestamps */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  /* Bypass mode empties the FIFO, then stream mode with the watermark */
+  if(MEMS_FIFO_WriteReg(pSensor, MEMS_REG_FIFO_CTRL, 0x00U) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+  for(i = 0U; i < 2U; i++)
+  {
+    if((MEMS_FIFO_ReadReg(pSensor, pregs->Bits[i].Reg, &value) != HAL_OK) ||
+       (MEMS_FIFO_WriteReg(pSensor, pregs->Bits[i].Reg, value | pregs->Bits[i].Set) != HAL_OK))
+    {
+      return HAL_ERROR;
+    }
+  }
+  if(MEMS_FIFO_WriteReg(pSensor, MEMS_REG_FIFO_CTRL, (uint8_t)(pregs->Stream | pSensor->Watermark)) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  pSensor->State = MEMS_FIFO_STATE_IDLE;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the FIFO streaming, the sensor keeps its data rate
+  * @param  pSensor: Sensor
+  * @retval HAL_OK, or HAL_BUSY while a burst is in progress: retry
+  */
+HAL_StatusTypeDef MEMS_FIFO_Stop(MEMS_FIFO_SensorTypeDef *pSensor)
+{
+  const MEMS_FIFO_RegsTypeDef *pregs = &MEMS_FIFO_Regs[pSensor->Sensor];
+  HAL_StatusTypeDef status = HAL_OK;
+  uint8_t value;
+  uint32_t i;
+
+  __disable_irq();
+  if((pSensor->State != MEMS_FIFO_STATE_IDLE) && (pSensor->State != MEMS_FIFO_STATE_STOPPED))
+  {
+    __enable_irq();
+    return HAL_BUSY;
+  }
+  pSensor->State = MEMS_FIFO_STATE_STOPPED;
+  __enable_irq();
+
+  for(i = 0U; i < 2U; i++)
+  {
+    if((MEMS_FIFO_ReadReg(pSensor, pregs->Bits[i].Reg, &value) != HAL_OK) ||
+       (MEMS_FIFO_WriteReg(pSensor, pregs->Bits[i].Reg, value & (uint8_t)~pregs->Bits[i].Clear) != HAL_OK))
+    {
+      status = HAL_ERROR;
+    }
+  }
+  if(MEMS_FIFO_WriteReg(pSensor, MEMS_REG_FIFO_CTRL, 0x00U) != HAL_OK)
+  {
+    status = HAL_ERROR;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Watermark interrupt, call from HAL_GPIO_EXTI_Callback()
+  * @param  pSensor: Sensor
+  * @retval None
+  */
+void MEMS_FIFO_IRQHandler(MEMS_FIFO_SensorTypeDef *pSensor)
+{
+  if(pSensor->State == MEMS_FIFO_STATE_IDLE)
+  {
+    MEMS_FIFO_ReadStatus(pSensor);
+  }
+  else if(pSensor->State != MEMS_FIFO_STATE_STOPPED)
+  {
+    pSensor->Pending = 1U;
+  }
+}
+
+/**
+  * @brief  I2C read completed, call from HAL_I2C_MemRxCpltCallback()
+  * @param  pSensor: Sensor
+  * @param  hi2c: I2C handle
+  * @retval None
+  */
+void MEMS_FIFO_I2C_RxCpltCallback(MEMS_FIFO_SensorTypeDef *pSensor, I2C_HandleTypeDef *hi2c)
+{
+  if((hi2c == pSensor->hi2c) && (pSensor->State != MEMS_FIFO_STATE_IDLE) &&
+     (pSensor->State != MEMS_FIFO_STATE_STOPPED))
+  {
+    MEMS_FIFO_Done(pSensor, HAL_OK);
+  }
+}
+
+/**
+  * @brief  I2C error, call from HAL_I2C_ErrorCallback()
+  * @param  pSensor: Sensor
+  * @param  hi2c: I2C handle
+  * @retval None
+  */
+void MEMS_FIFO_I2C_ErrorCallback(MEMS_FIFO_SensorTypeDef *pSensor, I2C_HandleTypeDef *hi2c)
+{
+  if((hi2c == pSensor->hi2c) && (pSensor->State != MEMS_FIFO_STATE_IDLE) &&
+     (pSensor->State != MEMS_FIFO_STATE_STOPPED))
+  {
+    MEMS_FIFO_Done(pSensor, HAL_ERROR);
+  }
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Read a register, blocking, configuration only
+  * @param  pSensor: Sensor
+  * @param  Reg: Register address
+  * @param  pValue: Register value
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef MEMS_FIFO_ReadReg(MEMS_FIFO_SensorTypeDef *pSensor, uint8_t Reg, uint8_t *pValue)
+{
+  uint8_t *pbuffer = (uint8_t *)pSensor->Samples;
+
+  if(!MEMS_FIFO_IS_SPI(pSensor))
+  {
+    return HAL_I2C_Mem_Read(pSensor->hi2c, pSensor->Address, Reg, I2C_MEMADD_SIZE_8BIT, pValue, 1U,
+                            MEMS_FIFO_TIMEOUT);
+  }
+
+  pSensor->Command = (uint8_t)(0x80U | Reg);
+  if(MEMS_FIFO_SpiTransfer(pSensor, pbuffer, 1U, NULL) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+  *pValue = pbuffer[0];
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Write a register, blocking, configuration only
+  * @param  pSensor: Sensor
+  * @param  Reg: Register address
+  * @param  Value: Register value
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef MEMS_FIFO_WriteReg(MEMS_FIFO_SensorTypeDef *pSensor, uint8_t Reg, uint8_t Value)
+{
+  uint8_t *pbuffer = (uint8_t *)pSensor->Samples;
+
+  if(!MEMS_FIFO_IS_SPI(pSensor))
+  {
+    return HAL_I2C_Mem_Write(pSensor->hi2c, pSensor->Address, Reg, I2C_MEMADD_SIZE_8BIT, &Value, 1U,
+                             MEMS_FIFO_TIMEOUT);
+  }
+
+  /* Receive only segment: the HAL clocks out the buffer content */
+  pSensor->Command = Reg;
+  pbuffer[0] = Value;
+  return MEMS_FIFO_SpiTransfer(pSensor, pbuffer, 1U, NULL);
+}
+
+/**
+  * @brief  Submit the command byte then a receive segment on the SPI queue
+  * @param  pSensor: Sensor
+  * @param  pRx: Receive buffer
+  * @param  Size: Bytes to receive
+  * @param  Callback: Completion callback, NULL to wait for the end
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef MEMS_FIFO_SpiTransfer(MEMS_FIFO_SensorTypeDef *pSensor, uint8_t *pRx, uint16_t Size,
+                                               void (*Callback)(SPI_Queue_JobTypeDef *pJob))
+{
+  uint32_t tickstart;
+
+  pSensor->Segments[0].pTx  = &pSensor->Command;
+  pSensor->Segments[0].pRx  = NULL;
+  pSensor->Segments[0].Size = 1U;
+  pSensor->Segments[1].pTx  = NULL;
+  pSensor->Segments[1].pRx  = pRx;
+  pSensor->Segments[1].Size = Size;
+
+  pSensor->Job.pCsPort           = pSensor->pCsPort;
+  pSensor->Job.CsPin             = pSensor->CsPin;
+  pSensor->Job.CLKPolarity       = SPI_POLARITY_HIGH;
+  pSensor->Job.CLKPhase          = SPI_PHASE_2EDGE;
+  pSensor->Job.BaudRatePrescaler = pSensor->BaudRatePrescaler;
+  pSensor->Job.pSegments         = pSensor->Segments;
+  pSensor->Job.NbSegments        = 2U;
+  pSensor->Job.Callback          = Callback;
+  pSensor->Job.pContext          = pSensor;
+
+  if(SPI_Queue_Submit(pSensor->pSpiQueue, &pSensor->Job) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+  if(Callback != NULL)
+  {
+    return HAL_OK;
+  }
+
+  tickstart = HAL_GetTick();
+  while(pSensor->Job.Status == HAL_BUSY)
+  {
+    if((HAL_GetTick() - tickstart) > MEMS_FIFO_TIMEOUT)
+    {
+      return HAL_TIMEOUT;
+    }
+  }
+
+  return pSensor->Job.Status;
+}
+
+/**
+  * @brief  Start the read of the FIFO level
+  * @param  pSensor: Sensor
+  * @retval None
+  */
+static void MEMS_FIFO_ReadStatus(MEMS_FIFO_SensorTypeDef *pSensor)
+{
+  HAL_StatusTypeDef status;
+
+  pSensor->Pending   = 0U;
+  pSensor->State     = MEMS_FIFO_STATE_STATUS;
+  pSensor->Timestamp = DWT->CYCCNT;
+
+  if(MEMS_FIFO_IS_SPI(pSensor))
+  {
+    pSensor->Command = (uint8_t)(0x80U | MEMS_REG_FIFO_SRC);
+    status = MEMS_FIFO_SpiTransfer(pSensor, &pSensor->Source, 1U, MEMS_FIFO_SpiDone);
+  }
+  else
+  {
+    status = HAL_I2C_Mem_Read_IT(pSensor->hi2c, pSensor->Address, MEMS_REG_FIFO_SRC, I2C_MEMADD_SIZE_8BIT,
+                                 &pSensor->Source, 1U);
+  }
+
+  if(status != HAL_OK)
+  {
+    /* Retried at the next interrupt */
+    pSensor->Errors++;
+    pSensor->State = MEMS_FIFO_STATE_IDLE;
+  }
+}
+
+/**
+  * @brief  Step of a burst completed
+  * @param  pSensor: Sensor
+  * @param  Status: Bus transaction status
+  * @retval None
+  */
+static void MEMS_FIFO_Done(MEMS_FIFO_SensorTypeDef *pSensor, HAL_StatusTypeDef Status)
+{
+  MEMS_FIFO_BlockTypeDef block;
+  uint32_t count;
+
+  if(Status != HAL_OK)
+  {
+    pSensor->Errors++;
+    MEMS_FIFO_Finish(pSensor);
+    return;
+  }
+
+  if(pSensor->State == MEMS_FIFO_STATE_STATUS)
+  {
+    count = pSensor->Source & MEMS_FIFO_SRC_FSS;
+    if((pSensor->Source & MEMS_FIFO_SRC_OVRN) != 0U)
+    {
+      /* Full FIFO, the oldest samples were overwritten */
+      count = MEMS_FIFO_DEPTH;
+      pSensor->Overrun = 1U;
+      pSensor->Overruns++;
+    }
+    if(count == 0U)
+    {
+      MEMS_FIFO_Finish(pSensor);
+      return;
+    }
+
+    pSensor->Count = count;
+    pSensor->State = MEMS_FIFO_STATE_DATA;
+    if(MEMS_FIFO_IS_SPI(pSensor))
+    {
+      pSensor->Command = (uint8_t)(MEMS_FIFO_Regs[pSensor->Sensor].Read | MEMS_REG_OUT_X_L);
+      Status = MEMS_FIFO_SpiTransfer(pSensor, (uint8_t *)pSensor->Samples,
+                                     (uint16_t)(count * sizeof(MEMS_FIFO_SampleTypeDef)), MEMS_FIFO_SpiDone);
+    }
+    else
+    {
+      Status = HAL_I2C_Mem_Read_DMA(pSensor->hi2c, pSensor->Address,
+                                    (uint16_t)(MEMS_FIFO_Regs[pSensor->Sensor].Read | MEMS_REG_OUT_X_L),
+                                    I2C_MEMADD_SIZE_8BIT, (uint8_t *)pSensor->Samples,
+                                    (uint16_t)(count * sizeof(MEMS_FIFO_SampleTypeDef)));
+    }
+    if(Status != HAL_OK)
+    {
+      pSensor->Errors++;
+      MEMS_FIFO_Finish(pSensor);
+    }
+    return;
+  }
+
+  block.Timestamp = pSensor->Timestamp;
+  block.Index     = pSensor->Index;
+  block.Count     = pSensor->Count;
+  block.Overrun   = pSensor->Overrun;
+  block.pSamples  = pSensor->Samples;
+  pSensor->Overrun = 0U;
+  pSensor->Index  += pSensor->Count;
+  pSensor->Bursts++;
+  pSensor->Callback(pSensor, &block);
+
+  /* The interrupt line may have stayed high: no new edge */
+  if(pSensor->Count >= pSensor->Watermark)
+  {
+    pSensor->Pending = 1U;
+  }
+  MEMS_FIFO_Finish(pSensor);
+}
+
+/**
+  * @brief  End of a burst, start the next one if an interrupt occurred
+  * @param  pSensor: Sensor
+  * @retval None
+  */
+static void MEMS_FIFO_Finish(MEMS_FIFO_SensorTypeDef *pSensor)
+{
+  pSensor->State = MEMS_FIFO_STATE_IDLE;
+
+  if(pSensor->Pending != 0U)
+  {
+    MEMS_FIFO_ReadStatus(pSensor);
+  }
+}
+
+/**
+  * @brief  SPI queue job completed
+  * @param  pJob: Job of the sensor
+  * @retval None
+  */
+static void MEMS_FIFO_SpiDone(SPI_Queue_JobTypeDef *pJob)
+{
+  MEMS_FIFO_Done((MEMS_FIFO_SensorTypeDef *)pJob->pContext, pJob->Status);
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
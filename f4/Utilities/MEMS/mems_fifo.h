@@ -0,0 +1,128 @@
+/**
+  ******************************************************************************
+  * @file    mems_fifo.h
+  * @author  MCD Application Team
+  * @brief   Header for mems_fifo module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _MEMS_FIFO_H__
+#define _MEMS_FIFO_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "spi_queue.h"
+
+#if !defined(HAL_I2C_MODULE_ENABLED)
+#error "mems_fifo requires the HAL I2C driver (HAL_I2C_MODULE_ENABLED)"
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+/* Output registers order, little endian as read */
+typedef struct
+{
+  int16_t   X;
+  int16_t   Y;
+  int16_t   Z;
+} MEMS_FIFO_SampleTypeDef;
+
+typedef struct
+{
+  uint32_t                      Timestamp;   /* DWT cycles when the FIFO level was read */
+  uint32_t                      Index;       /* Samples delivered before this block     */
+  uint32_t                      Count;       /* Samples in the block, oldest first      */
+  uint32_t                      Overrun;     /* Samples were lost before this block     */
+  const MEMS_FIFO_SampleTypeDef *pSamples;   /* Valid during the callback only          */
+} MEMS_FIFO_BlockTypeDef;
+
+typedef struct __MEMS_FIFO_SensorTypeDef
+{
+  /* Set by the application */
+  uint32_t                  Sensor;            /* MEMS_FIFO_L3GD20, LIS3DSH or LSM303DLHC  */
+  SPI_QueueTypeDef          *pSpiQueue;        /* SPI sensors: bus queue                   */
+  GPIO_TypeDef              *pCsPort;          /* SPI sensors: chip select, active low     */
+  uint16_t                  CsPin;
+  uint32_t                  BaudRatePrescaler; /* SPI sensors: SPI_BAUDRATEPRESCALER_xxx   */
+  I2C_HandleTypeDef         *hi2c;             /* I2C sensors: bus, Rx DMA linked          */
+  uint16_t                  Address;           /* I2C sensors: 8-bit address as the HAL    */
+  uint32_t                  Watermark;         /* Samples per interrupt, 1 to 31           */
+  void                      (*Callback)(struct __MEMS_FIFO_SensorTypeDef *pSensor,
+                                        const MEMS_FIFO_BlockTypeDef *pBlock);
+  void                      *pContext;         /* Free for the caller                      */
+
+  /* Reserved for the module */
+  __IO uint32_t             State;
+  __IO uint32_t             Pending;           /* Interrupt during a burst                 */
+  uint32_t                  Timestamp;
+  uint32_t                  Index;
+  uint32_t                  Count;
+  uint32_t                  Overrun;
+  uint32_t                  Bursts;            /* Blocks delivered                         */
+  uint32_t                  Overruns;          /* FIFO overruns, samples lost              */
+  uint32_t                  Errors;            /* Bus transactions failed                  */
+  SPI_Queue_JobTypeDef      Job;
+  SPI_Queue_SegmentTypeDef  Segments[2];
+  uint8_t                   Command;
+  uint8_t                   Source;            /* FIFO_SRC register                        */
+  MEMS_FIFO_SampleTypeDef   Samples[32];       /* FIFO content, DMA target                 */
+} MEMS_FIFO_SensorTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+#define MEMS_FIFO_L3GD20          0U   /* Gyroscope, SPI                    */
+#define MEMS_FIFO_LIS3DSH         1U   /* Accelerometer, SPI                */
+#define MEMS_FIFO_LSM303DLHC      2U   /* Accelerometer part, I2C           */
+
+/* Register access timeout in ms during the configuration. Override in main.h. */
+#if !defined(MEMS_FIFO_TIMEOUT)
+#define MEMS_FIFO_TIMEOUT         10U
+#endif
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef MEMS_FIFO_Start(MEMS_FIFO_SensorTypeDef *pSensor);
+HAL_StatusTypeDef MEMS_FIFO_Stop(MEMS_FIFO_SensorTypeDef *pSensor);
+void              MEMS_FIFO_IRQHandler(MEMS_FIFO_SensorTypeDef *pSensor);
+
+void MEMS_FIFO_I2C_RxCpltCallback(MEMS_FIFO_SensorTypeDef *pSensor, I2C_HandleTypeDef *hi2c);
+void MEMS_FIFO_I2C_ErrorCallback(MEMS_FIFO_SensorTypeDef *pSensor, I2C_HandleTypeDef *hi2c);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _MEMS_FIFO_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
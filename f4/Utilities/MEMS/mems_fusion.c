@@ -0,0 +1,660 @@
+/**
+  ******************************************************************************
+  * @file    mems_fusion.c
+  * @author  MCD Application Team
+  * @brief   Orientation of a gyroscope and accelerometer pair, in Q2.30 fixed
+  *          point or float, from the sample blocks of mems_fifo: Madgwick,
+  *          Mahony or complementary filter.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- stream the gyroscope (L3GD20) and the accelerometer (LIS3DSH or
+   LSM303DLHC) with mems_fifo, and call MEMS_FUSION_GyroBlock() and
+   MEMS_FUSION_AccelBlock() from their block callbacks. Both sensors must
+   run at a known output data rate; they need not have the same one.
+
+2- set the algorithm, the gyroscope sensitivity and output data rate, the
+   gains and the accelerometer axes in the gyroscope frame, and call
+   MEMS_FUSION_Init(). The orientation is aligned on gravity with the first
+   accelerometer block:
+   (+) MEMS_FUSION_MADGWICK: Gain is beta in rad/s, 0.03 to 0.1.
+   (+) MEMS_FUSION_MAHONY: Gain is Kp in 1/s, 0.5 to 2, and IntegralGain is
+       Ki in 1/s^2, about 0.01 to 0.1, to cancel the gyroscope bias.
+   (+) MEMS_FUSION_COMPLEMENTARY: Gain is the fraction of the tilt error
+       corrected per accelerometer block, 0.01 to 0.1. The gyroscope
+       samples are only integrated: the cheapest of the three.
+
+3- the gyroscope samples are integrated one by one, at the sensor rate:
+   a quaternion product in 12 multiply-accumulates with 64-bit
+   accumulators. The accelerometer correction is computed once per
+   gyroscope block from the last accelerometer block direction, and the
+   quaternion is renormalized once per block, so that the cost per sample
+   does not depend on the algorithm.
+
+4- read the orientation with MEMS_FUSION_GetQuaternion() or
+   MEMS_FUSION_GetEuler(), from the same interrupt priority as the block
+   callbacks.
+
+The fixed point computations use Q2.30 for the quaternion and the unit
+vectors, and the half rotation angle per gyroscope sample for the rates.
+Define MEMS_FUSION_FLOAT in main.h to compute in float instead. Yaw is not
+observed by the accelerometer and drifts with the gyroscope bias.
+*******************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include "mems_fusion.h"
+#include <math.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define MEMS_FUSION_DEG_TO_RAD      0.0174532925f
+
+/* Private macro -------------------------------------------------------------*/
+#if defined(MEMS_FUSION_FLOAT)
+#define MEMS_FUSION_ONE             1.0f
+#define MEMS_FUSION_MUL(__A__, __B__)   ((__A__) * (__B__))
+#define MEMS_FUSION_HALF(__A__)         ((__A__) * 0.5f)
+#define MEMS_FUSION_TO_FLOAT(__A__)     (__A__)
+#else
+#define MEMS_FUSION_ONE             0x40000000
+#define MEMS_FUSION_MUL(__A__, __B__)   ((int32_t)(((int64_t)(__A__) * (__B__)) >> 30))
+#define MEMS_FUSION_HALF(__A__)         ((__A__) >> 1)
+#define MEMS_FUSION_TO_FLOAT(__A__)     ((float)(__A__) * (1.0f / 1073741824.0f))
+#endif
+
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t                MEMS_FUSION_SetGain(MEMS_FUSION_GainTypeDef *pGain, float Value);
+static MEMS_FUSION_RealTypeDef MEMS_FUSION_Scale(MEMS_FUSION_RealTypeDef Value, const MEMS_FUSION_GainTypeDef *pGain);
+static uint32_t                MEMS_FUSION_Normalize(const MEMS_FUSION_RealTypeDef *pIn, MEMS_FUSION_RealTypeDef *pOut,
+                                                     uint32_t Length);
+static void                    MEMS_FUSION_Gravity(MEMS_FUSION_HandleTypeDef *hfusion, MEMS_FUSION_RealTypeDef *pV);
+static void                    MEMS_FUSION_Error(MEMS_FUSION_HandleTypeDef *hfusion, MEMS_FUSION_RealTypeDef *pErr);
+static void                    MEMS_FUSION_Madgwick(MEMS_FUSION_HandleTypeDef *hfusion);
+static void                    MEMS_FUSION_Rotate(MEMS_FUSION_HandleTypeDef *hfusion, const MEMS_FUSION_RealTypeDef *pH);
+static void                    MEMS_FUSION_Renormalize(MEMS_FUSION_HandleTypeDef *hfusion);
+static void                    MEMS_FUSION_Align(MEMS_FUSION_HandleTypeDef *hfusion);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Initialize the fusion, the orientation is aligned on the first
+  *         accelerometer block
+  * @param  hfusion: Fusion handle, its application fields set
+  * @retval HAL_OK, or HAL_ERROR for a parameter out of range
+  */
+HAL_StatusTypeDef MEMS_FUSION_Init(MEMS_FUSION_HandleTypeDef *hfusion)
+{
+  float corr;
+  uint32_t used = 0U;
+  uint32_t i;
+  int32_t axis;
+
+  if((hfusion->Algorithm > MEMS_FUSION_COMPLEMENTARY) || !(hfusion->GyroSensitivity > 0.0f) ||
+     !(hfusion->GyroRate > 0.0f) || !(hfusion->Gain >= 0.0f) || !(hfusion->IntegralGain >= 0.0f))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Each accelerometer axis once, or the gyroscope axes */
+  if((hfusion->AccelAxes[0] == 0) && (hfusion->AccelAxes[1] == 0) && (hfusion->AccelAxes[2] == 0))
+  {
+    hfusion->AccelAxes[0] = 1;
+    hfusion->AccelAxes[1] = 2;
+    hfusion->AccelAxes[2] = 3;
+  }
+  for(i = 0U; i < 3U; i++)
+  {
+    axis = (hfusion->AccelAxes[i] < 0) ? -hfusion->AccelAxes[i] : hfusion->AccelAxes[i];
+    if((axis < 1) || (axis > 3) || ((used & (1UL << axis)) != 0U))
+    {
+      return HAL_ERROR;
+    }
+    used |= 1UL << axis;
+  }
+
+  /* Gains per gyroscope sample: half angles for the rates */
+  switch(hfusion->Algorithm)
+  {
+  case MEMS_FUSION_MADGWICK:
+    corr = hfusion->Gain / hfusion->GyroRate;
+    break;
+  case MEMS_FUSION_MAHONY:
+    corr = hfusion->Gain / (2.0f * hfusion->GyroRate);
+    break;
+  default:
+    corr = 0.5f * hfusion->Gain;
+    break;
+  }
+  if((MEMS_FUSION_SetGain(&hfusion->GyroGain, hfusion->GyroSensitivity * 0.001f * MEMS_FUSION_DEG_TO_RAD /
+                          (2.0f * hfusion->GyroRate)) != 0U) ||
+     (MEMS_FUSION_SetGain(&hfusion->CorrGain, corr) != 0U) ||
+     (MEMS_FUSION_SetGain(&hfusion->IntGain, (hfusion->Algorithm == MEMS_FUSION_MAHONY) ?
+                          (hfusion->IntegralGain / (2.0f * hfusion->GyroRate * hfusion->GyroRate)) : 0.0f) != 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  hfusion->Q[0] = MEMS_FUSION_ONE;
+  for(i = 0U; i < 3U; i++)
+  {
+    hfusion->Q[i + 1U]     = 0;
+    hfusion->Accel[i]      = 0;
+    hfusion->Omega[i]      = 0;
+    hfusion->Integral[i]   = 0;
+    hfusion->Step[i]       = 0;
+  }
+  hfusion->Step[3]    = 0;
+  hfusion->AccelValid = 0U;
+  hfusion->Samples    = 0U;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Integrate a block of gyroscope samples
+  * @param  hfusion: Fusion handle
+  * @param  pBlock: Gyroscope block, as given to the mems_fifo callback
+  * @retval None
+  */
+void MEMS_FUSION_GyroBlock(MEMS_FUSION_HandleTypeDef *hfusion, const MEMS_FIFO_BlockTypeDef *pBlock)
+{
+  const MEMS_FIFO_SampleTypeDef *psample = pBlock->pSamples;
+  MEMS_FUSION_RealTypeDef q0, q1, q2, q3;
+  MEMS_FUSION_RealTypeDef p0, p1, p2;
+  MEMS_FUSION_RealTypeDef hx, hy, hz;
+  MEMS_FUSION_RealTypeDef cx, cy, cz;
+  MEMS_FUSION_RealTypeDef err[3];
+  uint32_t count = pBlock->Count;
+  uint32_t i;
+#if !defined(MEMS_FUSION_FLOAT)
+  uint32_t shift = hfusion->GyroGain.Shift - 30U;
+#endif
+
+  if(count == 0U)
+  {
+    return;
+  }
+
+  /* Accelerometer correction, constant over the block */
+  if(hfusion->AccelValid != 0U)
+  {
+    if(hfusion->Algorithm == MEMS_FUSION_MADGWICK)
+    {
+      MEMS_FUSION_Madgwick(hfusion);
+    }
+    else if(hfusion->Algorithm == MEMS_FUSION_MAHONY)
+    {
+      MEMS_FUSION_Error(hfusion, err);
+      for(i = 0U; i < 3U; i++)
+      {
+        hfusion->Omega[i] = MEMS_FUSION_Scale(err[i], &hfusion->CorrGain);
+#if defined(MEMS_FUSION_FLOAT)
+        hfusion->Integral[i] += err[i] * hfusion->IntGain * (float)count;
+#else
+        /* Count applied before the shift, the integral gain is small */
+        hfusion->Integral[i] += (int32_t)(((((int64_t)err[i] * hfusion->IntGain.Gain) >> 16) * (int64_t)count) >>
+                                          (hfusion->IntGain.Shift - 16U));
+#endif
+      }
+    }
+  }
+  cx = hfusion->Omega[0] + hfusion->Integral[0];
+  cy = hfusion->Omega[1] + hfusion->Integral[1];
+  cz = hfusion->Omega[2] + hfusion->Integral[2];
+
+  q0 = hfusion->Q[0];
+  q1 = hfusion->Q[1];
+  q2 = hfusion->Q[2];
+  q3 = hfusion->Q[3];
+
+  while(count > 0U)
+  {
+#if defined(MEMS_FUSION_FLOAT)
+    hx = ((float)psample->X * hfusion->GyroGain) + cx;
+    hy = ((float)psample->Y * hfusion->GyroGain) + cy;
+    hz = ((float)psample->Z * hfusion->GyroGain) + cz;
+
+    /* q += q * (0, h) - step */
+    p0 = q0 - (q1 * hx) - (q2 * hy) - (q3 * hz) - hfusion->Step[0];
+    p1 = q1 + (q0 * hx) + (q2 * hz) - (q3 * hy) - hfusion->Step[1];
+    p2 = q2 + (q0 * hy) - (q1 * hz) + (q3 * hx) - hfusion->Step[2];
+    q3 = q3 + (q0 * hz) + (q1 * hy) - (q2 * hx) - hfusion->Step[3];
+#else
+    hx = (int32_t)(((int64_t)psample->X * hfusion->GyroGain.Gain) >> shift) + cx;
+    hy = (int32_t)(((int64_t)psample->Y * hfusion->GyroGain.Gain) >> shift) + cy;
+    hz = (int32_t)(((int64_t)psample->Z * hfusion->GyroGain.Gain) >> shift) + cz;
+
+    /* q += q * (0, h) - step, one rounding per component */
+    p0 = (int32_t)((((int64_t)q0 << 30) - ((int64_t)q1 * hx) - ((int64_t)q2 * hy) - ((int64_t)q3 * hz)) >> 30) -
+         hfusion->Step[0];
+    p1 = (int32_t)((((int64_t)q1 << 30) + ((int64_t)q0 * hx) + ((int64_t)q2 * hz) - ((int64_t)q3 * hy)) >> 30) -
+         hfusion->Step[1];
+    p2 = (int32_t)((((int64_t)q2 << 30) + ((int64_t)q0 * hy) - ((int64_t)q1 * hz) + ((int64_t)q3 * hx)) >> 30) -
+         hfusion->Step[2];
+    q3 = (int32_t)((((int64_t)q3 << 30) + ((int64_t)q0 * hz) + ((int64_t)q1 * hy) - ((int64_t)q2 * hx)) >> 30) -
+         hfusion->Step[3];
+#endif
+    q0 = p0;
+    q1 = p1;
+    q2 = p2;
+
+    psample++;
+    count--;
+  }
+
+  hfusion->Q[0] = q0;
+  hfusion->Q[1] = q1;
+  hfusion->Q[2] = q2;
+  hfusion->Q[3] = q3;
+  MEMS_FUSION_Renormalize(hfusion);
+
+  hfusion->Samples += pBlock->Count;
+}
+
+/**
+  * @brief  Update the gravity direction from a block of accelerometer samples
+  * @param  hfusion: Fusion handle
+  * @param  pBlock: Accelerometer block, as given to the mems_fifo callback
+  * @retval None
+  */
+void MEMS_FUSION_AccelBlock(MEMS_FUSION_HandleTypeDef *hfusion, const MEMS_FIFO_BlockTypeDef *pBlock)
+{
+  const MEMS_FIFO_SampleTypeDef *psample = pBlock->pSamples;
+  MEMS_FUSION_RealTypeDef axes[3];
+  MEMS_FUSION_RealTypeDef mapped[3];
+  MEMS_FUSION_RealTypeDef err[3];
+  int32_t sum[3] = { 0, 0, 0 };
+  uint32_t count = pBlock->Count;
+  uint32_t i;
+  int32_t axis;
+
+  /* Block mean direction, the noise averaged over the block */
+  while(count > 0U)
+  {
+    sum[0] += psample->X;
+    sum[1] += psample->Y;
+    sum[2] += psample->Z;
+    psample++;
+    count--;
+  }
+  for(i = 0U; i < 3U; i++)
+  {
+    axis = hfusion->AccelAxes[i];
+    if(axis < 0)
+    {
+      mapped[i] = (MEMS_FUSION_RealTypeDef)-sum[-axis - 1];
+    }
+    else
+    {
+      mapped[i] = (MEMS_FUSION_RealTypeDef)sum[axis - 1];
+    }
+  }
+  if(MEMS_FUSION_Normalize(mapped, axes, 3U) == 0U)
+  {
+    return;
+  }
+  hfusion->Accel[0] = axes[0];
+  hfusion->Accel[1] = axes[1];
+  hfusion->Accel[2] = axes[2];
+
+  if(hfusion->AccelValid == 0U)
+  {
+    hfusion->AccelValid = 1U;
+    if(hfusion->Samples == 0U)
+    {
+      MEMS_FUSION_Align(hfusion);
+      return;
+    }
+  }
+
+  if(hfusion->Algorithm == MEMS_FUSION_COMPLEMENTARY)
+  {
+    /* Rotate by a fraction of the tilt error */
+    MEMS_FUSION_Error(hfusion, err);
+    for(i = 0U; i < 3U; i++)
+    {
+      err[i] = MEMS_FUSION_Scale(err[i], &hfusion->CorrGain);
+    }
+    MEMS_FUSION_Rotate(hfusion, err);
+    MEMS_FUSION_Renormalize(hfusion);
+  }
+}
+
+/**
+  * @brief  Get the orientation quaternion, from the sensor frame to the
+  *         earth frame
+  * @param  hfusion: Fusion handle
+  * @param  pQ: 4 values, w, x, y, z
+  * @retval None
+  */
+void MEMS_FUSION_GetQuaternion(MEMS_FUSION_HandleTypeDef *hfusion, float *pQ)
+{
+  uint32_t i;
+
+  for(i = 0U; i < 4U; i++)
+  {
+    pQ[i] = MEMS_FUSION_TO_FLOAT(hfusion->Q[i]);
+  }
+}
+
+/**
+  * @brief  Get the orientation as Euler angles, Z-Y-X convention
+  * @param  hfusion: Fusion handle
+  * @param  pRoll: Rotation around X in rad
+  * @param  pPitch: Rotation around Y in rad
+  * @param  pYaw: Rotation around Z in rad
+  * @retval None
+  */
+void MEMS_FUSION_GetEuler(MEMS_FUSION_HandleTypeDef *hfusion, float *pRoll, float *pPitch, float *pYaw)
+{
+  float q[4];
+  float s;
+
+  MEMS_FUSION_GetQuaternion(hfusion, q);
+
+  s = 2.0f * ((q[0] * q[2]) - (q[3] * q[1]));
+  s = (s > 1.0f) ? 1.0f : ((s < -1.0f) ? -1.0f : s);
+
+  *pRoll  = atan2f(2.0f * ((q[0] * q[1]) + (q[2] * q[3])), 1.0f - (2.0f * ((q[1] * q[1]) + (q[2] * q[2]))));
+  *pPitch = asinf(s);
+  *pYaw   = atan2f(2.0f * ((q[0] * q[3]) + (q[1] * q[2])), 1.0f - (2.0f * ((q[2] * q[2]) + (q[3] * q[3]))));
+}
+
+/**
+  * @brief  Convert a gain below 1
+  * @param  pGain: Converted gain
+  * @param  Value: Gain, 0 to 1 excluded
+  * @retval 0, or 1 when out of range
+  */
+static uint32_t MEMS_FUSION_SetGain(MEMS_FUSION_GainTypeDef *pGain, float Value)
+{
+  if(!(Value >= 0.0f) || !(Value < 1.0f))
+  {
+    return 1U;
+  }
+#if defined(MEMS_FUSION_FLOAT)
+  *pGain = Value;
+#else
+  {
+    double mantissa = (double)Value * 1073741824.0;
+    uint32_t shift = 30U;
+
+    /* Mantissa in [2^30, 2^31), the shift is at least 30 */
+    while((mantissa > 0.0) && (mantissa < 1073741824.0) && (shift < 62U))
+    {
+      mantissa *= 2.0;
+      shift++;
+    }
+    pGain->Gain  = (int32_t)mantissa;
+    pGain->Shift = shift;
+  }
+#endif
+
+  return 0U;
+}
+
+/**
+  * @brief  Multiply a value by a gain
+  * @param  Value: Value
+  * @param  pGain: Gain
+  * @retval Product
+  */
+static MEMS_FUSION_RealTypeDef MEMS_FUSION_Scale(MEMS_FUSION_RealTypeDef Value, const MEMS_FUSION_GainTypeDef *pGain)
+{
+#if defined(MEMS_FUSION_FLOAT)
+  return Value * *pGain;
+#else
+  return (int32_t)(((int64_t)Value * pGain->Gain) >> pGain->Shift);
+#endif
+}
+
+/**
+  * @brief  Normalize a vector
+  * @param  pIn: Vector, components up to 2^30 in fixed point
+  * @param  pOut: Unit vector, can be pIn
+  * @param  Length: Number of components, up to 4
+  * @retval 1, or 0 for a null vector, pOut then unchanged
+  */
+static uint32_t MEMS_FUSION_Normalize(const MEMS_FUSION_RealTypeDef *pIn, MEMS_FUSION_RealTypeDef *pOut,
+                                      uint32_t Length)
+{
+  uint32_t i;
+#if defined(MEMS_FUSION_FLOAT)
+  float norm = 0.0f;
+
+  for(i = 0U; i < Length; i++)
+  {
+    norm += pIn[i] * pIn[i];
+  }
+  if(norm == 0.0f)
+  {
+    return 0U;
+  }
+  norm = 1.0f / sqrtf(norm);
+  for(i = 0U; i < Length; i++)
+  {
+    pOut[i] = pIn[i] * norm;
+  }
+#else
+  uint64_t norm = 0U;
+  uint32_t shift;
+  int32_t f;
+  int32_t y;
+
+  for(i = 0U; i < Length; i++)
+  {
+    norm += (uint64_t)((int64_t)pIn[i] * pIn[i]);
+  }
+  if(norm == 0U)
+  {
+    return 0U;
+  }
+
+  /* norm = f * 2^(64 - shift) with f in [1/4, 1) and an even shift */
+  shift = ((uint32_t)(norm >> 32) != 0U) ? __CLZ((uint32_t)(norm >> 32)) : (32U + __CLZ((uint32_t)norm));
+  shift &= ~1U;
+  f = (int32_t)((norm << shift) >> 34);
+
+  /* y = 1 / (2 * sqrt(f)) in (1/2, 1]: linear seed, then Newton iterations
+     y = y * (3 - 4 * f * y^2) / 2 */
+  y = 0x38000000 - MEMS_FUSION_MUL(0x18000000, f);
+  for(i = 0U; i < 4U; i++)
+  {
+    y = (int32_t)(((int64_t)y * (0xC0000000LL - ((int64_t)MEMS_FUSION_MUL(f, MEMS_FUSION_MUL(y, y)) << 2))) >> 31);
+  }
+
+  /* 1 / sqrt(norm) = y * 2^(shift / 2 - 31) */
+  for(i = 0U; i < Length; i++)
+  {
+    pOut[i] = (int32_t)(((int64_t)pIn[i] * y) >> (31U - (shift >> 1)));
+  }
+#endif
+
+  return 1U;
+}
+
+/**
+  * @brief  Gravity direction estimated in the sensor frame
+  * @param  hfusion: Fusion handle
+  * @param  pV: Unit vector
+  * @retval None
+  */
+static void MEMS_FUSION_Gravity(MEMS_FUSION_HandleTypeDef *hfusion, MEMS_FUSION_RealTypeDef *pV)
+{
+  MEMS_FUSION_RealTypeDef *q = hfusion->Q;
+
+  pV[0] = MEMS_FUSION_MUL(q[1], q[3]) - MEMS_FUSION_MUL(q[0], q[2]);
+  pV[1] = MEMS_FUSION_MUL(q[0], q[1]) + MEMS_FUSION_MUL(q[2], q[3]);
+  pV[0] += pV[0];
+  pV[1] += pV[1];
+  pV[2] = MEMS_FUSION_MUL(q[0], q[0]) - MEMS_FUSION_MUL(q[1], q[1]) -
+          MEMS_FUSION_MUL(q[2], q[2]) + MEMS_FUSION_MUL(q[3], q[3]);
+}
+
+/**
+  * @brief  Tilt error, cross product of the measured and estimated gravity
+  * @param  hfusion: Fusion handle
+  * @param  pErr: Rotation axis scaled by the sine of the error angle
+  * @retval None
+  */
+static void MEMS_FUSION_Error(MEMS_FUSION_HandleTypeDef *hfusion, MEMS_FUSION_RealTypeDef *pErr)
+{
+  MEMS_FUSION_RealTypeDef *a = hfusion->Accel;
+  MEMS_FUSION_RealTypeDef v[3];
+
+  MEMS_FUSION_Gravity(hfusion, v);
+
+  pErr[0] = MEMS_FUSION_MUL(a[1], v[2]) - MEMS_FUSION_MUL(a[2], v[1]);
+  pErr[1] = MEMS_FUSION_MUL(a[2], v[0]) - MEMS_FUSION_MUL(a[0], v[2]);
+  pErr[2] = MEMS_FUSION_MUL(a[0], v[1]) - MEMS_FUSION_MUL(a[1], v[0]);
+}
+
+/**
+  * @brief  Madgwick gradient descent step per gyroscope sample
+  * @param  hfusion: Fusion handle
+  * @retval None
+  */
+static void MEMS_FUSION_Madgwick(MEMS_FUSION_HandleTypeDef *hfusion)
+{
+  MEMS_FUSION_RealTypeDef *q = hfusion->Q;
+  MEMS_FUSION_RealTypeDef *a = hfusion->Accel;
+  MEMS_FUSION_RealTypeDef v[3];
+  MEMS_FUSION_RealTypeDef f[3];
+  MEMS_FUSION_RealTypeDef s[4];
+  uint32_t i;
+
+  /* Half of the objective function, gravity estimated minus measured */
+  MEMS_FUSION_Gravity(hfusion, v);
+  for(i = 0U; i < 3U; i++)
+  {
+    f[i] = MEMS_FUSION_HALF(v[i]) - MEMS_FUSION_HALF(a[i]);
+  }
+
+  /* Gradient J^T * f divided by 8, below 2, then 16 */
+  s[0] = MEMS_FUSION_HALF(MEMS_FUSION_MUL(q[1], f[1]) - MEMS_FUSION_MUL(q[2], f[0]));
+  s[1] = MEMS_FUSION_HALF(MEMS_FUSION_MUL(q[3], f[0]) + MEMS_FUSION_MUL(q[0], f[1])) - MEMS_FUSION_MUL(q[1], f[2]);
+  s[2] = MEMS_FUSION_HALF(MEMS_FUSION_MUL(q[3], f[1]) - MEMS_FUSION_MUL(q[0], f[0])) - MEMS_FUSION_MUL(q[2], f[2]);
+  s[3] = MEMS_FUSION_HALF(MEMS_FUSION_MUL(q[1], f[0]) + MEMS_FUSION_MUL(q[2], f[1]));
+  for(i = 0U; i < 4U; i++)
+  {
+    s[i] = MEMS_FUSION_HALF(s[i]);
+  }
+
+  if(MEMS_FUSION_Normalize(s, s, 4U) == 0U)
+  {
+    s[0] = 0;
+    s[1] = 0;
+    s[2] = 0;
+    s[3] = 0;
+  }
+  for(i = 0U; i < 4U; i++)
+  {
+    hfusion->Step[i] = MEMS_FUSION_Scale(s[i], &hfusion->CorrGain);
+  }
+}
+
+/**
+  * @brief  Rotate the orientation, q += q * (0, h)
+  * @param  hfusion: Fusion handle
+  * @param  pH: Half rotation angle around each axis
+  * @retval None
+  */
+static void MEMS_FUSION_Rotate(MEMS_FUSION_HandleTypeDef *hfusion, const MEMS_FUSION_RealTypeDef *pH)
+{
+  MEMS_FUSION_RealTypeDef *q = hfusion->Q;
+  MEMS_FUSION_RealTypeDef p[4];
+
+  p[0] = q[0] - MEMS_FUSION_MUL(q[1], pH[0]) - MEMS_FUSION_MUL(q[2], pH[1]) - MEMS_FUSION_MUL(q[3], pH[2]);
+  p[1] = q[1] + MEMS_FUSION_MUL(q[0], pH[0]) + MEMS_FUSION_MUL(q[2], pH[2]) - MEMS_FUSION_MUL(q[3], pH[1]);
+  p[2] = q[2] + MEMS_FUSION_MUL(q[0], pH[1]) - MEMS_FUSION_MUL(q[1], pH[2]) + MEMS_FUSION_MUL(q[3], pH[0]);
+  p[3] = q[3] + MEMS_FUSION_MUL(q[0], pH[2]) + MEMS_FUSION_MUL(q[1], pH[1]) - MEMS_FUSION_MUL(q[2], pH[0]);
+
+  q[0] = p[0];
+  q[1] = p[1];
+  q[2] = p[2];
+  q[3] = p[3];
+}
+
+/**
+  * @brief  Bring the quaternion norm back to 1, q *= (3 - |q|^2) / 2
+  * @param  hfusion: Fusion handle
+  * @retval None
+  */
+static void MEMS_FUSION_Renormalize(MEMS_FUSION_HandleTypeDef *hfusion)
+{
+  MEMS_FUSION_RealTypeDef *q = hfusion->Q;
+  MEMS_FUSION_RealTypeDef norm;
+  MEMS_FUSION_RealTypeDef scale;
+  uint32_t i;
+
+  /* The norm only drifts by rounding and second order terms over a block */
+  norm = MEMS_FUSION_MUL(q[0], q[0]) + MEMS_FUSION_MUL(q[1], q[1]) +
+         MEMS_FUSION_MUL(q[2], q[2]) + MEMS_FUSION_MUL(q[3], q[3]);
+  scale = MEMS_FUSION_ONE + MEMS_FUSION_HALF(MEMS_FUSION_ONE - norm);
+  for(i = 0U; i < 4U; i++)
+  {
+    q[i] = MEMS_FUSION_MUL(q[i], scale);
+  }
+}
+
+/**
+  * @brief  Align the orientation on the measured gravity, the shortest
+  *         rotation from the vertical
+  * @param  hfusion: Fusion handle
+  * @retval None
+  */
+static void MEMS_FUSION_Align(MEMS_FUSION_HandleTypeDef *hfusion)
+{
+  MEMS_FUSION_RealTypeDef *a = hfusion->Accel;
+  MEMS_FUSION_RealTypeDef q[4];
+
+  /* q = (1 + az, ay, -ax, 0) normalized, halved to stay within 1 */
+  q[0] = MEMS_FUSION_HALF(MEMS_FUSION_ONE) + MEMS_FUSION_HALF(a[2]);
+  q[1] = MEMS_FUSION_HALF(a[1]);
+  q[2] = -MEMS_FUSION_HALF(a[0]);
+  q[3] = 0;
+
+  if(MEMS_FUSION_Normalize(q, hfusion->Q, 4U) == 0U)
+  {
+    /* Upside down: half turn around X */
+    hfusion->Q[0] = 0;
+    hfusion->Q[1] = MEMS_FUSION_ONE;
+    hfusion->Q[2] = 0;
+    hfusion->Q[3] = 0;
+  }
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
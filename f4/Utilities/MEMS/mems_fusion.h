@@ -0,0 +1,109 @@
+/**
+  ******************************************************************************
+  * @file    mems_fusion.h
+  * @author  MCD Application Team
+  * @brief   Header for mems_fusion module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _MEMS_FUSION_H__
+#define _MEMS_FUSION_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "mems_fifo.h"
+
+/* Exported types ------------------------------------------------------------*/
+/* Q2.30 fixed point, or float when MEMS_FUSION_FLOAT is defined in main.h */
+#if defined(MEMS_FUSION_FLOAT)
+typedef float   MEMS_FUSION_RealTypeDef;
+typedef float   MEMS_FUSION_GainTypeDef;
+#else
+typedef int32_t MEMS_FUSION_RealTypeDef;
+
+typedef struct
+{
+  int32_t   Gain;       /* Mantissa, 2^30 to 2^31 - 1, or 0 */
+  uint32_t  Shift;      /* Gain / 2^Shift is the real value  */
+} MEMS_FUSION_GainTypeDef;
+#endif
+
+typedef struct
+{
+  /* Set by the application */
+  uint32_t                  Algorithm;         /* MEMS_FUSION_MADGWICK, MAHONY or COMPLEMENTARY  */
+  float                     GyroSensitivity;   /* mdps per LSB, L3GD20_SENSITIVITY_xxx            */
+  float                     GyroRate;          /* Gyroscope output data rate in Hz                */
+  float                     Gain;              /* Madgwick beta in rad/s, Mahony Kp in 1/s, or
+                                                  complementary tilt fraction corrected per
+                                                  accelerometer block, 0 to 1                    */
+  float                     IntegralGain;      /* Mahony Ki in 1/s^2, 0 for no bias estimation   */
+  int8_t                    AccelAxes[3];      /* Gyroscope X, Y, Z as accelerometer axis 1 to 3,
+                                                  negative when opposite; all 0 for the same axes */
+
+  /* Reserved for the module */
+  MEMS_FUSION_RealTypeDef   Q[4];              /* Orientation quaternion w, x, y, z               */
+  MEMS_FUSION_RealTypeDef   Accel[3];          /* Last accelerometer direction, unit vector       */
+  MEMS_FUSION_RealTypeDef   Omega[3];          /* Correction, half angle per gyroscope sample     */
+  MEMS_FUSION_RealTypeDef   Integral[3];       /* Mahony bias, half angle per gyroscope sample    */
+  MEMS_FUSION_RealTypeDef   Step[4];           /* Madgwick quaternion step per gyroscope sample   */
+  uint32_t                  AccelValid;
+  uint32_t                  Samples;           /* Gyroscope samples integrated                    */
+  MEMS_FUSION_GainTypeDef   GyroGain;          /* LSB to half angle per sample                    */
+  MEMS_FUSION_GainTypeDef   CorrGain;          /* Gain per gyroscope sample or accelerometer block */
+  MEMS_FUSION_GainTypeDef   IntGain;           /* IntegralGain per gyroscope sample squared       */
+} MEMS_FUSION_HandleTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+#define MEMS_FUSION_MADGWICK        0U   /* Gradient descent on the gravity direction */
+#define MEMS_FUSION_MAHONY          1U   /* Proportional-integral rate feedback       */
+#define MEMS_FUSION_COMPLEMENTARY   2U   /* Tilt blending on each accelerometer block */
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef MEMS_FUSION_Init(MEMS_FUSION_HandleTypeDef *hfusion);
+void              MEMS_FUSION_GyroBlock(MEMS_FUSION_HandleTypeDef *hfusion, const MEMS_FIFO_BlockTypeDef *pBlock);
+void              MEMS_FUSION_AccelBlock(MEMS_FUSION_HandleTypeDef *hfusion, const MEMS_FIFO_BlockTypeDef *pBlock);
+void              MEMS_FUSION_GetQuaternion(MEMS_FUSION_HandleTypeDef *hfusion, float *pQ);
+void              MEMS_FUSION_GetEuler(MEMS_FUSION_HandleTypeDef *hfusion, float *pRoll, float *pPitch, float *pYaw);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _MEMS_FUSION_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,265 @@
+/**
+  ******************************************************************************
+  * @file    sdram_tune.c
+  * @author  MCD Application Team
+  * @brief   FMC SDRAM timing and refresh derived from the part datasheet and
+  *          the clock, and bandwidth benchmark.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- fill a SDRAM_Tune_PartTypeDef from the SDRAM datasheet, at the CAS
+   latency programmed in the mode register, and call SDRAM_Tune_Compute()
+   with the FMC kernel clock (HCLK).
+   Use SDClockPeriod and Timing for HAL_SDRAM_Init(), and RefreshCount for
+   the initialization sequence, ex. BSP_SDRAM_Initialization_sequence().
+   The SDRAM clock is the kernel clock divided by 2 when the part allows,
+   by 3 otherwise.
+
+2- the refresh count is in SDRAM clock cycles. When the FMC kernel clock
+   changes at run time, call SDRAM_Tune_SetRefresh() with the lower of the
+   two clocks before the change and with the new clock after it, so rows
+   are never refreshed too late. Timing must be computed at the highest
+   kernel clock used: it stays valid, slightly slower, at lower ones.
+
+3- SDRAM_Tune_Benchmark() checks the result: it writes a pattern over a
+   region, then reads it back and checks it.
+   The region content is lost.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "sdram_tune.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define SDRAM_TUNE_MAX_CYCLES     16U      /* Timing fields limit              */
+#define SDRAM_TUNE_MIN_COUNT      41U      /* Refresh count limits             */
+#define SDRAM_TUNE_MAX_COUNT      0x1FFFU
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t          SDRAM_Tune_Cycles(uint32_t Ns, uint32_t Clock);
+static HAL_StatusTypeDef SDRAM_Tune_Refresh(const SDRAM_Tune_PartTypeDef *pPart, uint32_t Clock, uint32_t *pCount);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Derive the FMC settings of a part
+  * @param  pPart: SDRAM datasheet parameters
+  * @param  KernelClock: FMC kernel clock, in Hz
+  * @param  pConfig: receives the settings
+  * @retval HAL_ERROR when the part cannot run from this clock
+  */
+HAL_StatusTypeDef SDRAM_Tune_Compute(const SDRAM_Tune_PartTypeDef *pPart, uint32_t KernelClock,
+                                     SDRAM_Tune_ConfigTypeDef *pConfig)
+{
+  FMC_SDRAM_TimingTypeDef *pTiming = &pConfig->Timing;
+  uint32_t clock;
+  uint32_t trcd;
+  uint32_t trp;
+  uint32_t twr;
+
+  if ((pPart == NULL) || (pPart->MaxClock == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Fastest SDRAM clock the part takes */
+  if ((uint64_t)KernelClock <= (2ULL * pPart->MaxClock))
+  {
+    pConfig->SDClockPeriod = FMC_SDRAM_CLOCK_PERIOD_2;
+    clock = KernelClock / 2U;
+  }
+  else if ((uint64_t)KernelClock <= (3ULL * pPart->MaxClock))
+  {
+    pConfig->SDClockPeriod = FMC_SDRAM_CLOCK_PERIOD_3;
+    clock = KernelClock / 3U;
+  }
+  else
+  {
+    return HAL_ERROR;
+  }
+  pConfig->Clock = clock;
+
+  trcd = SDRAM_Tune_Cycles(pPart->tRCD, clock);
+  trp  = SDRAM_Tune_Cycles(pPart->tRP, clock);
+  pTiming->RCDDelay             = trcd;
+  pTiming->RPDelay              = trp;
+  pTiming->RowCycleDelay        = SDRAM_Tune_Cycles(pPart->tRC, clock);
+  pTiming->SelfRefreshTime      = SDRAM_Tune_Cycles(pPart->tRAS, clock);
+  pTiming->ExitSelfRefreshDelay = SDRAM_Tune_Cycles(pPart->tXSR, clock);
+  pTiming->LoadToActiveDelay    = (pPart->tMRD != 0U) ? pPart->tMRD : 1U;
+
+  /* The FMC requires TWR >= TRAS - TRCD and TWR >= TRC - TRCD - TRP */
+  twr = SDRAM_Tune_Cycles(pPart->tWR, clock);
+  if ((pTiming->SelfRefreshTime > trcd) && (twr < (pTiming->SelfRefreshTime - trcd)))
+  {
+    twr = pTiming->SelfRefreshTime - trcd;
+  }
+  if ((pTiming->RowCycleDelay > (trcd + trp)) && (twr < (pTiming->RowCycleDelay - trcd - trp)))
+  {
+    twr = pTiming->RowCycleDelay - trcd - trp;
+  }
+  pTiming->WriteRecoveryTime = twr;
+
+  if ((pTiming->RCDDelay > SDRAM_TUNE_MAX_CYCLES) || (pTiming->RPDelay > SDRAM_TUNE_MAX_CYCLES) ||
+      (pTiming->RowCycleDelay > SDRAM_TUNE_MAX_CYCLES) || (pTiming->SelfRefreshTime > SDRAM_TUNE_MAX_CYCLES) ||
+      (pTiming->ExitSelfRefreshDelay > SDRAM_TUNE_MAX_CYCLES) || (pTiming->LoadToActiveDelay > SDRAM_TUNE_MAX_CYCLES) ||
+      (pTiming->WriteRecoveryTime > SDRAM_TUNE_MAX_CYCLES))
+  {
+    return HAL_ERROR;
+  }
+
+  return SDRAM_Tune_Refresh(pPart, clock, &pConfig->RefreshCount);
+}
+
+/**
+  * @brief  Program the refresh count for a new FMC kernel clock
+  * @param  hsdram: SDRAM handle initialized
+  * @param  pPart: SDRAM datasheet parameters
+  * @param  KernelClock: FMC kernel clock, in Hz
+  * @retval HAL status
+  */
+HAL_StatusTypeDef SDRAM_Tune_SetRefresh(SDRAM_HandleTypeDef *hsdram, const SDRAM_Tune_PartTypeDef *pPart,
+                                        uint32_t KernelClock)
+{
+  uint32_t count;
+  uint32_t clock;
+
+  clock = KernelClock / ((hsdram->Init.SDClockPeriod == FMC_SDRAM_CLOCK_PERIOD_2) ? 2U : 3U);
+  if (SDRAM_Tune_Refresh(pPart, clock, &count) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  return HAL_SDRAM_ProgramRefreshRate(hsdram, count);
+}
+
+/**
+  * @brief  Measure the write and read bandwidth of an SDRAM region
+  * @note   The region content is overwritten.
+  * @param  Address: region start, 32 bytes aligned
+  * @param  Size: region size, multiple of 32 bytes
+  * @param  pResult: receives the measures
+  * @retval HAL_ERROR on bad parameters or when words read back differ
+  */
+HAL_StatusTypeDef SDRAM_Tune_Benchmark(uint32_t Address, uint32_t Size, SDRAM_Tune_BenchmarkTypeDef *pResult)
+{
+  __IO uint32_t *pWord;
+  uint32_t      *pEnd = (uint32_t *)(Address + Size);
+  uint32_t      start;
+  uint32_t      errors = 0U;
+
+  if (((Address & 31U) != 0U) || (Size == 0U) || ((Size & 31U) != 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  /* Write, each word its address inverted, up to the SDRAM */
+  start = DWT->CYCCNT;
+  for(pWord = (uint32_t *)Address; pWord < pEnd; pWord += 4)
+  {
+    pWord[0] = ~(uint32_t)&pWord[0];
+    pWord[1] = ~(uint32_t)&pWord[1];
+    pWord[2] = ~(uint32_t)&pWord[2];
+    pWord[3] = ~(uint32_t)&pWord[3];
+  }
+  __DSB();
+  pResult->WriteCycles = DWT->CYCCNT - start;
+
+  /* Read back from the SDRAM and check */
+  start = DWT->CYCCNT;
+  for(pWord = (uint32_t *)Address; pWord < pEnd; pWord += 4)
+  {
+    errors += (pWord[0] != ~(uint32_t)&pWord[0]) ? 1U : 0U;
+    errors += (pWord[1] != ~(uint32_t)&pWord[1]) ? 1U : 0U;
+    errors += (pWord[2] != ~(uint32_t)&pWord[2]) ? 1U : 0U;
+    errors += (pWord[3] != ~(uint32_t)&pWord[3]) ? 1U : 0U;
+  }
+  pResult->ReadCycles = DWT->CYCCNT - start;
+
+  pResult->Size      = Size;
+  pResult->Errors    = errors;
+  pResult->WriteMBps = (uint32_t)(((uint64_t)Size * SystemCoreClock) / ((uint64_t)pResult->WriteCycles * 1000000U));
+  pResult->ReadMBps  = (uint32_t)(((uint64_t)Size * SystemCoreClock) / ((uint64_t)pResult->ReadCycles * 1000000U));
+
+  return (errors == 0U) ? HAL_OK : HAL_ERROR;
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Convert a time to clock cycles, rounded up
+  * @param  Ns: time in ns
+  * @param  Clock: clock in Hz
+  * @retval Cycles, 1 at least
+  */
+static uint32_t SDRAM_Tune_Cycles(uint32_t Ns, uint32_t Clock)
+{
+  uint32_t cycles = (uint32_t)((((uint64_t)Ns * Clock) + 999999999U) / 1000000000U);
+
+  return (cycles != 0U) ? cycles : 1U;
+}
+
+/**
+  * @brief  Refresh count: refresh interval in SDRAM clock cycles minus the
+  *         20 cycles margin of the reference manual
+  * @param  pPart: SDRAM datasheet parameters
+  * @param  Clock: SDRAM clock, in Hz
+  * @param  pCount: receives the count
+  * @retval HAL_ERROR when out of the FMC range
+  */
+static HAL_StatusTypeDef SDRAM_Tune_Refresh(const SDRAM_Tune_PartTypeDef *pPart, uint32_t Clock, uint32_t *pCount)
+{
+  uint64_t count;
+
+  if (pPart->RefreshRows == 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  count = ((uint64_t)pPart->RefreshPeriod * Clock) / (1000ULL * pPart->RefreshRows);
+  if ((count < (SDRAM_TUNE_MIN_COUNT + 20U)) || (count > (SDRAM_TUNE_MAX_COUNT + 20U)))
+  {
+    return HAL_ERROR;
+  }
+  *pCount = (uint32_t)count - 20U;
+
+  return HAL_OK;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,124 @@
+/**
+  ******************************************************************************
+  * @file    tlsf_heap.h
+  * @author  MCD Application Team
+  * @brief   Header for tlsf_heap module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _TLSF_HEAP_H__
+#define _TLSF_HEAP_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t  Attributes;      /* TLSF_ATTR_xxx given to TLSF_Heap_AddRegion()      */
+  uint32_t  TotalSize;       /* Bytes managed, after the region control block     */
+  uint32_t  UsedSize;        /* Bytes in allocated blocks, headers included       */
+  uint32_t  PeakUsed;        /* Highest UsedSize                                  */
+  uint32_t  FreeSize;        /* Bytes in free blocks                              */
+  uint32_t  LargestFree;     /* Largest single allocation possible                */
+  uint32_t  FreeBlocks;      /* Number of free blocks                             */
+  uint32_t  Fragmentation;   /* 0 to 100: 100 - LargestFree * 100 / FreeSize      */
+  uint32_t  Allocs;          /* Allocations served by the region                  */
+  uint32_t  Frees;           /* Blocks given back to the region                   */
+  uint32_t  Failures;        /* Allocations that found no block in the region     */
+  uint32_t  MaxAllocCycles;  /* Longest allocation, in CPU cycles                 */
+  uint32_t  MaxFreeCycles;   /* Longest release, in CPU cycles                    */
+} TLSF_Heap_StatsTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Region attributes, an allocation is served by the first region registered
+   that has all the attributes requested */
+#define TLSF_ATTR_NONE            0x00U
+#define TLSF_ATTR_DMA             0x01U   /* Reachable by DMA1/DMA2               */
+#define TLSF_ATTR_CACHEABLE       0x02U   /* Cached by the L1 D-cache             */
+#define TLSF_ATTR_FAST            0x04U   /* Zero wait state for the CPU (CCM)    */
+#define TLSF_ATTR_EXTERNAL        0x08U   /* Behind the FMC                       */
+
+/* Maximum number of regions. Override in main.h. */
+#if !defined(TLSF_HEAP_MAX_REGIONS)
+#define TLSF_HEAP_MAX_REGIONS     3U
+#endif
+
+/* Log2 of the second level lists per power of 2: 4 keeps the rounding
+   waste below 1/16 of a request. Override in main.h. */
+#if !defined(TLSF_HEAP_SL_LOG2)
+#define TLSF_HEAP_SL_LOG2         4U
+#endif
+
+/* Log2 of the largest block + 1: 28 manages regions up to 256 MBytes,
+   larger ones are truncated. Override in main.h. */
+#if !defined(TLSF_HEAP_FL_MAX)
+#define TLSF_HEAP_FL_MAX          28U
+#endif
+
+/* Exported variables --------------------------------------------------------*/
+/* Regions reserved by the linker script, see the NOTES in tlsf_heap.c */
+extern uint8_t __tlsf_ram_start[];
+extern uint8_t __tlsf_ram_end[];
+extern uint8_t __tlsf_ccm_start[];
+extern uint8_t __tlsf_ccm_end[];
+extern uint8_t __tlsf_sdram_start[];
+extern uint8_t __tlsf_sdram_end[];
+
+/* Exported macro ------------------------------------------------------------*/
+/* Start and size arguments of TLSF_Heap_AddRegion() for the linker script
+   region __NAME__ (ram, ccm or sdram) */
+#define TLSF_HEAP_LINKER_REGION(__NAME__)  ((void *)__tlsf_##__NAME__##_start), \
+                                           ((uint32_t)(__tlsf_##__NAME__##_end - __tlsf_##__NAME__##_start))
+
+/* Exported functions ------------------------------------------------------- */
+void              TLSF_Heap_Init(void);
+HAL_StatusTypeDef TLSF_Heap_AddRegion(void *pStart, uint32_t Size, uint32_t Attributes);
+void              *TLSF_Heap_Alloc(uint32_t Size, uint32_t Attributes);
+void              *TLSF_Heap_AllocAligned(uint32_t Size, uint32_t Alignment, uint32_t Attributes);
+void              TLSF_Heap_Free(void *pBuffer);
+uint32_t          TLSF_Heap_GetSize(const void *pBuffer);
+uint32_t          TLSF_Heap_GetRegionCount(void);
+HAL_StatusTypeDef TLSF_Heap_GetStats(uint32_t Region, TLSF_Heap_StatsTypeDef *pStats);
+void              TLSF_Heap_ResetStats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _TLSF_HEAP_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
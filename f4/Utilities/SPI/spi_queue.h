@@ -0,0 +1,114 @@
+/**
+  ******************************************************************************
+  * @file    spi_queue.h
+  * @author  MCD Application Team
+  * @brief   Header for spi_queue module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _SPI_QUEUE_H__
+#define _SPI_QUEUE_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#if !defined(HAL_SPI_MODULE_ENABLED)
+#error "spi_queue requires the HAL SPI driver (HAL_SPI_MODULE_ENABLED)"
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  const uint8_t             *pTx;        /* NULL: receive only                      */
+  uint8_t                   *pRx;        /* NULL: transmit only                     */
+  uint16_t                  Size;        /* In frames                               */
+} SPI_Queue_SegmentTypeDef;
+
+/* Owned by the module from SPI_Queue_Submit() until Callback is called */
+typedef struct __SPI_Queue_JobTypeDef
+{
+  GPIO_TypeDef                    *pCsPort;          /* NULL: chip select not handled      */
+  uint16_t                        CsPin;             /* Active low                          */
+  uint32_t                        CLKPolarity;       /* SPI_POLARITY_xxx                    */
+  uint32_t                        CLKPhase;          /* SPI_PHASE_xxx                       */
+  uint32_t                        BaudRatePrescaler; /* SPI_BAUDRATEPRESCALER_xxx           */
+  const SPI_Queue_SegmentTypeDef  *pSegments;        /* Sent back-to-back, CS kept asserted */
+  uint32_t                        NbSegments;
+  void                            (*Callback)(struct __SPI_Queue_JobTypeDef *pJob);
+  void                            *pContext;         /* Free for the caller                 */
+  __IO HAL_StatusTypeDef          Status;            /* HAL_BUSY until done                 */
+  struct __SPI_Queue_JobTypeDef   *pNext;            /* Reserved for the module             */
+} SPI_Queue_JobTypeDef;
+
+/* One per SPI instance, owned by the module from SPI_Queue_Init() on */
+typedef struct
+{
+  SPI_HandleTypeDef         *hspi;
+  SPI_Queue_JobTypeDef      *pHead;      /* Job in progress, then the waiting ones  */
+  SPI_Queue_JobTypeDef      *pTail;
+  uint32_t                  Running;     /* A context is starting jobs              */
+  uint32_t                  Segment;     /* Segment of pHead in progress            */
+  uint32_t                  Jobs;        /* Jobs done                               */
+  uint32_t                  Errors;      /* Jobs ended with an error                */
+} SPI_QueueTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Segments shorter than this, in frames, use interrupts instead of the DMA.
+   Override in main.h. */
+#if !defined(SPI_QUEUE_DMA_THRESHOLD)
+#define SPI_QUEUE_DMA_THRESHOLD   8U
+#endif
+
+/* SPI instances served at the same time. Override in main.h. */
+#if !defined(SPI_QUEUE_INSTANCES)
+#define SPI_QUEUE_INSTANCES       3U
+#endif
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef SPI_Queue_Init(SPI_QueueTypeDef *pQueue, SPI_HandleTypeDef *hspi);
+HAL_StatusTypeDef SPI_Queue_DeInit(SPI_QueueTypeDef *pQueue);
+HAL_StatusTypeDef SPI_Queue_Submit(SPI_QueueTypeDef *pQueue, SPI_Queue_JobTypeDef *pJob);
+uint32_t          SPI_Queue_IsIdle(SPI_QueueTypeDef *pQueue);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _SPI_QUEUE_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
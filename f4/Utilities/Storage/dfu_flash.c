@@ -0,0 +1,533 @@
+/**
+  ******************************************************************************
+  * @file    dfu_flash.h
+  * @author  MCD Application Team
+  * @brief   Internal flash DFU media programming in the background
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- set USBD_DFU_PIPELINED to 1 in usbd_conf.h, and USBD_DFU_XFER_SIZE to
+   2048 or more: each block is programmed while the next one is received,
+   the larger the block the less the host waits between blocks.
+
+2- enable the FLASH interrupt and call DFU_Flash_IRQHandler() from
+   FLASH_IRQHandler(). The module implements
+   HAL_FLASH_EndOfOperationCallback() and HAL_FLASH_OperationErrorCallback().
+
+3- register the media with
+      USBD_DFU_RegisterMedia(&USBD_Device, &USBD_DFU_Flash_fops);
+
+4- the class gives each block to WriteAsync: it is programmed word by word
+   with HAL_FLASH_Program_IT(), the next word being started from the FLASH
+   interrupt. A sector is erased with HAL_FLASHEx_Erase_IT() the first time
+   it is written or when the host asks for it, and once a block is
+   programmed the following sector of the image area is erased ahead,
+   while the host sends the next blocks. Each sector is erased once per
+   session. Only the area from DFU_FLASH_START to DFU_FLASH_END is erased
+   or programmed.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "dfu_flash.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define DFU_FLASH_STATE_IDLE      0U
+#define DFU_FLASH_STATE_PROGRAM   1U   /* Block being programmed            */
+#define DFU_FLASH_STATE_ERASE     2U   /* Sector erase asked by the host    */
+#define DFU_FLASH_STATE_ERROR     3U
+
+#define DFU_FLASH_NO_SECTOR       0xFFFFFFFFU
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static __IO uint32_t DfuState = DFU_FLASH_STATE_IDLE;
+static __IO uint32_t DfuBusy = 0U;                      /* Flash operation on going         */
+static uint32_t      DfuErasing = DFU_FLASH_NO_SECTOR;  /* Sector of the erase on going     */
+static uint32_t      DfuErased = 0U;                    /* One bit per sector erased        */
+static const uint8_t *DfuSrc = NULL;
+static uint32_t      DfuAddress = 0U;
+static uint32_t      DfuRemaining = 0U;
+static uint32_t      DfuUnit = 0U;                      /* Bytes of the program on going    */
+
+/* Private function prototypes -----------------------------------------------*/
+static uint16_t DFU_Flash_Init(void);
+static uint16_t DFU_Flash_DeInit(void);
+static uint16_t DFU_Flash_Erase(uint32_t Add);
+static uint16_t DFU_Flash_Write(uint8_t *src, uint8_t *dest, uint32_t Len);
+static uint8_t  *DFU_Flash_Read(uint8_t *src, uint8_t *dest, uint32_t Len);
+static uint16_t DFU_Flash_GetStatus(uint32_t Add, uint8_t Cmd, uint8_t *buffer);
+static uint16_t DFU_Flash_WriteAsync(uint8_t *src, uint8_t *dest, uint32_t Len);
+static uint16_t DFU_Flash_EraseAsync(uint32_t Add);
+static uint16_t DFU_Flash_Busy(void);
+static void     DFU_Flash_Next(void);
+static uint32_t DFU_Flash_GetSector(uint32_t Address);
+static uint32_t DFU_Flash_GetSectorStart(uint32_t Sector);
+static void     DFU_Flash_StartErase(uint32_t Sector);
+
+/* Exported variables --------------------------------------------------------*/
+USBD_DFU_MediaTypeDef USBD_DFU_Flash_fops =
+{
+  (uint8_t *)"@Internal Flash   /0x08000000/04*016Kg,01*064Kg,07*128Kg",
+  DFU_Flash_Init,
+  DFU_Flash_DeInit,
+  DFU_Flash_Erase,
+  DFU_Flash_Write,
+  DFU_Flash_Read,
+  DFU_Flash_GetStatus,
+  DFU_Flash_WriteAsync,
+  DFU_Flash_EraseAsync,
+  DFU_Flash_Busy
+};
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  FLASH interrupt: chain the erase and program operations
+  * @retval None
+  */
+void DFU_Flash_IRQHandler(void)
+{
+  HAL_FLASH_IRQHandler();
+
+  /* The HAL is unlocked once its handler returns */
+  DFU_Flash_Next();
+}
+
+/**
+  * @brief  End of an erase or program operation
+  * @param  ReturnValue: operation dependent
+  * @retval None
+  */
+void HAL_FLASH_EndOfOperationCallback(uint32_t ReturnValue)
+{
+  UNUSED(ReturnValue);
+
+  if(DfuBusy == 0U)
+  {
+    return;
+  }
+
+  if(DfuErasing != DFU_FLASH_NO_SECTOR)
+  {
+    DfuErased |= (1UL << DfuErasing);
+    DfuErasing = DFU_FLASH_NO_SECTOR;
+    if(DfuState == DFU_FLASH_STATE_ERASE)
+    {
+      DfuState = DFU_FLASH_STATE_IDLE;
+    }
+  }
+  else
+  {
+    DfuSrc       += DfuUnit;
+    DfuAddress   += DfuUnit;
+    DfuRemaining -= DfuUnit;
+  }
+  DfuBusy = 0U;
+}
+
+/**
+  * @brief  Erase or program error
+  * @param  ReturnValue: operation dependent
+  * @retval None
+  */
+void HAL_FLASH_OperationErrorCallback(uint32_t ReturnValue)
+{
+  UNUSED(ReturnValue);
+
+  if(DfuBusy != 0U)
+  {
+    DfuBusy      = 0U;
+    DfuErasing   = DFU_FLASH_NO_SECTOR;
+    DfuRemaining = 0U;
+    DfuState     = DFU_FLASH_STATE_ERROR;
+    (void)HAL_FLASH_Lock();
+  }
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Start of a DFU session: no sector erased yet
+  * @retval USBD_OK
+  */
+static uint16_t DFU_Flash_Init(void)
+{
+  DfuErased    = 0U;
+  DfuRemaining = 0U;
+  if(DfuBusy == 0U)
+  {
+    DfuState = DFU_FLASH_STATE_IDLE;
+  }
+  return USBD_OK;
+}
+
+/**
+  * @brief  End of a DFU session, once the last operation is over
+  * @retval USBD_OK
+  */
+static uint16_t DFU_Flash_DeInit(void)
+{
+  while(DfuBusy != 0U)
+  {
+  }
+  (void)HAL_FLASH_Lock();
+  return USBD_OK;
+}
+
+/**
+  * @brief  Erase a sector and wait for the end
+  * @param  Add: address in the sector
+  * @retval USBD_OK, USBD_FAIL
+  */
+static uint16_t DFU_Flash_Erase(uint32_t Add)
+{
+  if(DFU_Flash_EraseAsync(Add) != USBD_OK)
+  {
+    return USBD_FAIL;
+  }
+  while(DFU_Flash_Busy() == USBD_BUSY)
+  {
+  }
+  return DFU_Flash_Busy();
+}
+
+/**
+  * @brief  Program a block and wait for the end
+  * @param  src: block
+  * @param  dest: flash address
+  * @param  Len: block size in bytes
+  * @retval USBD_OK, USBD_FAIL
+  */
+static uint16_t DFU_Flash_Write(uint8_t *src, uint8_t *dest, uint32_t Len)
+{
+  if(DFU_Flash_WriteAsync(src, dest, Len) != USBD_OK)
+  {
+    return USBD_FAIL;
+  }
+  while(DFU_Flash_Busy() == USBD_BUSY)
+  {
+  }
+  return DFU_Flash_Busy();
+}
+
+/**
+  * @brief  Read flash: it is memory mapped
+  * @param  src: flash address
+  * @param  dest: unused
+  * @param  Len: unused
+  * @retval Address of the data
+  */
+static uint8_t *DFU_Flash_Read(uint8_t *src, uint8_t *dest, uint32_t Len)
+{
+  UNUSED(dest);
+  UNUSED(Len);
+
+  return src;
+}
+
+/**
+  * @brief  Poll timeout of the operation about to run
+  * @param  Add: address
+  * @param  Cmd: DFU_MEDIA_PROGRAM or DFU_MEDIA_ERASE
+  * @param  buffer: DFU status, bwPollTimeout in bytes 1 to 3
+  * @retval USBD_OK
+  */
+static uint16_t DFU_Flash_GetStatus(uint32_t Add, uint8_t Cmd, uint8_t *buffer)
+{
+  uint32_t timeout = DFU_FLASH_PROGRAM_TIME;
+
+  if((Cmd == DFU_MEDIA_ERASE) || (DfuErasing != DFU_FLASH_NO_SECTOR) ||
+     ((DfuErased & (1UL << DFU_Flash_GetSector(Add))) == 0U))
+  {
+    timeout = DFU_FLASH_ERASE_TIME;
+  }
+
+  buffer[1] = (uint8_t)timeout;
+  buffer[2] = (uint8_t)(timeout >> 8);
+  buffer[3] = (uint8_t)(timeout >> 16);
+
+  return USBD_OK;
+}
+
+/**
+  * @brief  Start programming a block
+  * @param  src: block, kept until DFU_Flash_Busy() returns USBD_OK
+  * @param  dest: flash address
+  * @param  Len: block size in bytes
+  * @retval USBD_OK, USBD_FAIL
+  */
+static uint16_t DFU_Flash_WriteAsync(uint8_t *src, uint8_t *dest, uint32_t Len)
+{
+  uint32_t address = (uint32_t)dest;
+
+  if((DfuState != DFU_FLASH_STATE_IDLE) || (Len == 0U) ||
+     (address < DFU_FLASH_START) || (address > DFU_FLASH_END) || (Len > (DFU_FLASH_END - address)))
+  {
+    return USBD_FAIL;
+  }
+
+  DfuSrc       = src;
+  DfuAddress   = address;
+  DfuRemaining = Len;
+  DfuState     = DFU_FLASH_STATE_PROGRAM;
+
+  (void)HAL_FLASH_Unlock();
+  DFU_Flash_Next();
+
+  return (DfuState == DFU_FLASH_STATE_ERROR) ? USBD_FAIL : USBD_OK;
+}
+
+/**
+  * @brief  Start erasing a sector, nothing to do when erased in this session
+  * @param  Add: address in the sector
+  * @retval USBD_OK, USBD_FAIL
+  */
+static uint16_t DFU_Flash_EraseAsync(uint32_t Add)
+{
+  uint32_t sector;
+
+  if((DfuState != DFU_FLASH_STATE_IDLE) || (Add < DFU_FLASH_START) || (Add >= DFU_FLASH_END))
+  {
+    return USBD_FAIL;
+  }
+
+  sector = DFU_Flash_GetSector(Add);
+  if(((DfuErased & (1UL << sector)) != 0U) || (DfuErasing == sector))
+  {
+    return USBD_OK;
+  }
+
+  DfuState = DFU_FLASH_STATE_ERASE;
+  (void)HAL_FLASH_Unlock();
+
+  /* An erase ahead may still be running, this one follows it */
+  if(DfuBusy == 0U)
+  {
+    DFU_Flash_StartErase(sector);
+  }
+
+  return (DfuState == DFU_FLASH_STATE_ERROR) ? USBD_FAIL : USBD_OK;
+}
+
+/**
+  * @brief  State of the last operation asked by the class
+  * @retval USBD_BUSY, USBD_OK, USBD_FAIL
+  */
+static uint16_t DFU_Flash_Busy(void)
+{
+  switch(DfuState)
+  {
+    case DFU_FLASH_STATE_IDLE:
+      return USBD_OK;
+
+    case DFU_FLASH_STATE_ERROR:
+      /* Reported once, the host clears the error and starts again */
+      DfuState = DFU_FLASH_STATE_IDLE;
+      return USBD_FAIL;
+
+    default:
+      return USBD_BUSY;
+  }
+}
+
+/**
+  * @brief  Start the next flash operation when the previous one is over
+  * @retval None
+  */
+static void DFU_Flash_Next(void)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint32_t sector;
+  uint32_t next;
+  HAL_StatusTypeDef status;
+
+  __disable_irq();
+
+  if(DfuBusy == 0U)
+  {
+    if(DfuState == DFU_FLASH_STATE_ERASE)
+    {
+      /* Host erase queued behind an erase ahead */
+      if(DfuErasing == DFU_FLASH_NO_SECTOR)
+      {
+        DfuState = DFU_FLASH_STATE_IDLE;
+      }
+    }
+    else if(DfuRemaining != 0U)
+    {
+      sector = DFU_Flash_GetSector(DfuAddress);
+      if((DfuErased & (1UL << sector)) == 0U)
+      {
+        /* First write in this sector */
+        DFU_Flash_StartErase(sector);
+      }
+      else
+      {
+        if(((DfuAddress & 3U) == 0U) && (DfuRemaining >= 4U))
+        {
+          DfuUnit = 4U;
+          status = HAL_FLASH_Program_IT(FLASH_TYPEPROGRAM_WORD, DfuAddress,
+                                        (uint64_t)((uint32_t)DfuSrc[0] | ((uint32_t)DfuSrc[1] << 8) |
+                                                   ((uint32_t)DfuSrc[2] << 16) | ((uint32_t)DfuSrc[3] << 24)));
+        }
+        else
+        {
+          DfuUnit = 1U;
+          status = HAL_FLASH_Program_IT(FLASH_TYPEPROGRAM_BYTE, DfuAddress, (uint64_t)DfuSrc[0]);
+        }
+
+        if(status == HAL_OK)
+        {
+          DfuBusy = 1U;
+        }
+        else
+        {
+          DfuRemaining = 0U;
+          DfuState     = DFU_FLASH_STATE_ERROR;
+          (void)HAL_FLASH_Lock();
+        }
+      }
+    }
+    else if(DfuState == DFU_FLASH_STATE_PROGRAM)
+    {
+      DfuState = DFU_FLASH_STATE_IDLE;
+
+      /* Erase the sector after the one being written while the host sends
+         the next blocks */
+      sector = DFU_Flash_GetSector(DfuAddress);
+      next   = sector + 1U;
+      if((DfuErased & (1UL << sector)) == 0U)
+      {
+        next = sector;
+      }
+      if((next < FLASH_SECTOR_TOTAL) && ((DfuErased & (1UL << next)) == 0U) &&
+         (DFU_Flash_GetSectorStart(next) >= DFU_FLASH_START) &&
+         (DFU_Flash_GetSectorStart(next) < DFU_FLASH_END))
+      {
+        DFU_Flash_StartErase(next);
+      }
+    }
+    else
+    {
+      (void)HAL_FLASH_Lock();
+    }
+  }
+
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Start the erase of one sector
+  * @param  Sector: sector number
+  * @retval None
+  */
+static void DFU_Flash_StartErase(uint32_t Sector)
+{
+  FLASH_EraseInitTypeDef erase;
+
+  erase.TypeErase    = FLASH_TYPEERASE_SECTORS;
+  erase.Banks        = FLASH_BANK_1;
+  erase.Sector       = Sector;
+  erase.NbSectors    = 1U;
+  erase.VoltageRange = DFU_FLASH_VOLTAGE_RANGE;
+
+  DfuErasing = Sector;
+  DfuBusy    = 1U;
+  if(HAL_FLASHEx_Erase_IT(&erase) != HAL_OK)
+  {
+    DfuBusy      = 0U;
+    DfuErasing   = DFU_FLASH_NO_SECTOR;
+    DfuRemaining = 0U;
+    DfuState     = DFU_FLASH_STATE_ERROR;
+    (void)HAL_FLASH_Lock();
+  }
+}
+
+/**
+  * @brief  Sector holding an address: 4 x 16 KB, 64 KB then 128 KB sectors,
+  *         sectors 12 to 23 in the second bank of 2 MB devices
+  * @param  Address: flash address
+  * @retval Sector number
+  */
+static uint32_t DFU_Flash_GetSector(uint32_t Address)
+{
+  uint32_t offset = Address - FLASH_BASE;
+  uint32_t first = 0U;
+
+#if (FLASH_SECTOR_TOTAL == 24U)
+  if(offset >= 0x100000U)
+  {
+    offset -= 0x100000U;
+    first = 12U;
+  }
+#endif
+
+  if(offset < 0x10000U)
+  {
+    return first + (offset >> 14U);
+  }
+  return first + 4U + (offset >> 17U);
+}
+
+/**
+  * @brief  First address of a sector
+  * @param  Sector: sector number
+  * @retval Address
+  */
+static uint32_t DFU_Flash_GetSectorStart(uint32_t Sector)
+{
+  uint32_t base = FLASH_BASE;
+
+#if (FLASH_SECTOR_TOTAL == 24U)
+  if(Sector >= 12U)
+  {
+    Sector -= 12U;
+    base += 0x100000U;
+  }
+#endif
+
+  if(Sector < 4U)
+  {
+    return base + (Sector << 14U);
+  }
+  if(Sector == 4U)
+  {
+    return base + 0x10000U;
+  }
+  return base + ((Sector - 4U) << 17U);
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
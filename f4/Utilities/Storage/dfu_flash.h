@@ -0,0 +1,94 @@
+/**
+  ******************************************************************************
+  * @file    dfu_flash.h
+  * @author  MCD Application Team
+  * @brief   Header for dfu_flash module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _DFU_FLASH_H__
+#define _DFU_FLASH_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "usbd_dfu.h"
+
+#if (USBD_DFU_PIPELINED != 1)
+#error "dfu_flash requires USBD_DFU_PIPELINED set to 1 in usbd_conf.h"
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+/* Flash area the host may erase and program, application image area.
+   Override in main.h. */
+#if !defined(DFU_FLASH_START)
+#if defined(USBD_DFU_APP_DEFAULT_ADD)
+#define DFU_FLASH_START           USBD_DFU_APP_DEFAULT_ADD
+#else
+#define DFU_FLASH_START           0x08008000U
+#endif
+#endif
+#if !defined(DFU_FLASH_END)
+#define DFU_FLASH_END             (FLASH_END + 1U)
+#endif
+
+/* Supply voltage range of the erase. Override in main.h. */
+#if !defined(DFU_FLASH_VOLTAGE_RANGE)
+#define DFU_FLASH_VOLTAGE_RANGE   FLASH_VOLTAGE_RANGE_3
+#endif
+
+/* Poll timeouts reported to the host, in ms: block program, sector erase.
+   Override in main.h. */
+#if !defined(DFU_FLASH_PROGRAM_TIME)
+#define DFU_FLASH_PROGRAM_TIME    1U
+#endif
+#if !defined(DFU_FLASH_ERASE_TIME)
+#define DFU_FLASH_ERASE_TIME      100U
+#endif
+
+/* Exported variables --------------------------------------------------------*/
+extern USBD_DFU_MediaTypeDef USBD_DFU_Flash_fops;
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+void DFU_Flash_IRQHandler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _DFU_FLASH_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,690 @@
+/**
+  ******************************************************************************
+  * @file    eeprom_async.c
+  * @author  MCD Application Team
+  * @brief   Asynchronous I2C EEPROM service: RAM read cache, page write
+  *          combining and acknowledge polling driven by a periodic tick
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- initialize the I2C bus (BSP_EEPROM_Init() or the application), link DMA
+   channels to it for the transfers to run by DMA (IT otherwise) and enable
+   its interrupts. Forward the HAL callbacks of the bus to the module:
+     HAL_I2C_MemTxCpltCallback()  -> EEPROM_Async_I2C_TxCpltCallback()
+     HAL_I2C_MemRxCpltCallback()  -> EEPROM_Async_I2C_RxCpltCallback()
+     HAL_I2C_ErrorCallback()      -> EEPROM_Async_I2C_ErrorCallback()
+   The hooks ignore the events of other I2C handles and transfers, so the
+   bus can be shared with other drivers.
+
+2- fill hi2c, DevAddress, MemAddSize, PageSize (EEPROM_PAGESIZE of the
+   board driver, or the page of the actual memory) and Size, give a Size
+   bytes buffer in pCache and call EEPROM_Async_Init(). The EEPROM is then
+   read into pCache in the background, EEPROM_Async_GetState() returns
+   HAL_BUSY until the end. With 8-bit memory addresses, the address bits
+   above 8 are sent in the device address as the 24C04 to 24C16 expect.
+
+3- EEPROM_Async_Read() is served from pCache, without I2C traffic.
+   EEPROM_Async_Write() updates pCache and marks as dirty the pages where
+   bytes actually changed; the data is copied, the buffer can be reused on
+   return. Several writes to a page before it is written are combined into
+   one page write, writes of unchanged bytes cost nothing.
+
+4- call EEPROM_Async_Tick() every millisecond, from the main loop or from a
+   timer interrupt of lower priority than SysTick and than the I2C. A page
+   write is started when the bus is free; the end of the write cycle is then
+   detected by acknowledge polling, once per tick, instead of waiting
+   EEPROM_WRITE_TIMEOUT. A page not acknowledged within
+   EEPROM_ASYNC_WRITE_TIMEOUT is written again, EEPROM_ASYNC_RETRIES times
+   at most, then given up and counted in Failures.
+
+5- to know when data is in the EEPROM, pass a request to
+   EEPROM_Async_Write(): its Callback is called from EEPROM_Async_Tick(),
+   or from EEPROM_Async_Write() when nothing had to be written, once all
+   the pages of the range are written. Status is then HAL_OK, or HAL_ERROR
+   if a page write was given up in the meantime. EEPROM_Async_IsIdle()
+   tells that no write is pending, before entering a low-power mode for
+   instance.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "eeprom_async.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define EEPROM_STATE_IDLE         0U
+#define EEPROM_STATE_LOAD         1U   /* Reading the EEPROM into the cache     */
+#define EEPROM_STATE_WRITE        2U   /* Page transfer in progress              */
+#define EEPROM_STATE_WAIT         3U   /* Write cycle, polled by the tick        */
+#define EEPROM_STATE_FAILED       4U   /* Page transfer failed, retried by the tick */
+#define EEPROM_STATE_ERROR        5U   /* Cache not loaded                       */
+
+#define EEPROM_NO_PAGE            0xFFFFFFFFU
+
+/* Private macro -------------------------------------------------------------*/
+#define EEPROM_PAGES(__E__)            (((__E__)->Size + (__E__)->PageSize - 1U) / (__E__)->PageSize)
+#define EEPROM_IS_DIRTY(__E__, __P__)  ((((__E__)->Dirty[(__P__) >> 5U]) >> ((__P__) & 31U)) & 1U)
+#define EEPROM_SET_DIRTY(__E__, __P__) ((__E__)->Dirty[(__P__) >> 5U] |= (1UL << ((__P__) & 31U)))
+#define EEPROM_CLR_DIRTY(__E__, __P__) ((__E__)->Dirty[(__P__) >> 5U] &= ~(1UL << ((__P__) & 31U)))
+
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static HAL_StatusTypeDef EEPROM_StartLoad(EEPROM_AsyncTypeDef *pEeprom);
+static void              EEPROM_StartPage(EEPROM_AsyncTypeDef *pEeprom);
+static void              EEPROM_Retry(EEPROM_AsyncTypeDef *pEeprom);
+static void              EEPROM_Complete(EEPROM_AsyncTypeDef *pEeprom);
+static uint32_t          EEPROM_NextDirty(EEPROM_AsyncTypeDef *pEeprom);
+static uint32_t          EEPROM_IsBusy(EEPROM_AsyncTypeDef *pEeprom, uint32_t FirstPage, uint32_t LastPage);
+static uint16_t          EEPROM_DevAddress(EEPROM_AsyncTypeDef *pEeprom, uint32_t Address);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Checks the configuration and starts loading the read cache.
+  * @param  pEeprom: EEPROM handle, application fields filled
+  * @retval HAL status
+  */
+HAL_StatusTypeDef EEPROM_Async_Init(EEPROM_AsyncTypeDef *pEeprom)
+{
+  if ((pEeprom == NULL) || (pEeprom->hi2c == NULL) || (pEeprom->pCache == NULL) || (pEeprom->Size == 0U) ||
+      (pEeprom->PageSize == 0U) || (pEeprom->PageSize > EEPROM_ASYNC_PAGE_MAX) ||
+      ((pEeprom->PageSize & (pEeprom->PageSize - 1U)) != 0U) ||
+      ((pEeprom->MemAddSize != I2C_MEMADD_SIZE_8BIT) && (pEeprom->MemAddSize != I2C_MEMADD_SIZE_16BIT)))
+  {
+    return HAL_ERROR;
+  }
+  if (EEPROM_PAGES(pEeprom) > EEPROM_ASYNC_PAGES_MAX)
+  {
+    return HAL_ERROR;
+  }
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if ((((uint32_t)pEeprom->pCache & 31U) != 0U) || ((pEeprom->Size & 31U) != 0U))
+  {
+    return HAL_ERROR;
+  }
+#endif
+
+  memset(pEeprom->Dirty, 0, sizeof(pEeprom->Dirty));
+  pEeprom->Page       = EEPROM_NO_PAGE;
+  pEeprom->Cursor     = 0U;
+  pEeprom->Loaded     = 0U;
+  pEeprom->Retries    = 0U;
+  pEeprom->Failures   = 0U;
+  pEeprom->PageWrites = 0U;
+  pEeprom->Polls      = 0U;
+  pEeprom->pHead      = NULL;
+  pEeprom->pTail      = NULL;
+  pEeprom->LoadStatus = HAL_BUSY;
+  pEeprom->State      = EEPROM_STATE_LOAD;
+
+  if (EEPROM_StartLoad(pEeprom) != HAL_OK)
+  {
+    pEeprom->LoadStatus = HAL_ERROR;
+    pEeprom->State      = EEPROM_STATE_ERROR;
+    return HAL_ERROR;
+  }
+  return HAL_OK;
+}
+
+/**
+  * @brief  Returns the state of the read cache.
+  * @param  pEeprom: EEPROM handle
+  * @retval HAL_BUSY while loading, HAL_OK once loaded, HAL_ERROR if the
+  *         EEPROM could not be read
+  */
+HAL_StatusTypeDef EEPROM_Async_GetState(EEPROM_AsyncTypeDef *pEeprom)
+{
+  return pEeprom->LoadStatus;
+}
+
+/**
+  * @brief  Reads from the cache.
+  * @param  pEeprom: EEPROM handle
+  * @param  Address: first EEPROM address
+  * @param  pData: destination
+  * @param  Size: bytes to read
+  * @retval HAL status
+  */
+HAL_StatusTypeDef EEPROM_Async_Read(EEPROM_AsyncTypeDef *pEeprom, uint32_t Address, uint8_t *pData, uint32_t Size)
+{
+  if (pEeprom->LoadStatus != HAL_OK)
+  {
+    return pEeprom->LoadStatus;
+  }
+  if ((Address > pEeprom->Size) || (Size > (pEeprom->Size - Address)))
+  {
+    return HAL_ERROR;
+  }
+
+  memcpy(pData, &pEeprom->pCache[Address], Size);
+  return HAL_OK;
+}
+
+/**
+  * @brief  Writes to the cache and schedules the write of the changed pages.
+  * @param  pEeprom: EEPROM handle
+  * @param  Address: first EEPROM address
+  * @param  pData: data, copied before return
+  * @param  Size: bytes to write
+  * @param  pRequest: completion request, Callback and pContext filled, or
+  *         NULL. Owned by the module until Callback is called.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef EEPROM_Async_Write(EEPROM_AsyncTypeDef *pEeprom, uint32_t Address, const uint8_t *pData,
+                                     uint32_t Size, EEPROM_Async_RequestTypeDef *pRequest)
+{
+  uint32_t primask;
+  uint32_t page;
+  uint32_t end;
+  uint32_t chunk;
+  uint32_t i;
+  uint32_t busy;
+
+  if (pEeprom->LoadStatus != HAL_OK)
+  {
+    return pEeprom->LoadStatus;
+  }
+  if ((Size == 0U) || (Address > pEeprom->Size) || (Size > (pEeprom->Size - Address)))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Page by page, so that the tick never copies a page half updated while
+     the interrupts stay enabled most of the time */
+  end = Address + Size;
+  while (Address < end)
+  {
+    page  = Address / pEeprom->PageSize;
+    chunk = ((page + 1U) * pEeprom->PageSize) - Address;
+    if (chunk > (end - Address))
+    {
+      chunk = end - Address;
+    }
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    for (i = 0U; i < chunk; i++)
+    {
+      if (pEeprom->pCache[Address + i] != pData[i])
+      {
+        pEeprom->pCache[Address + i] = pData[i];
+        EEPROM_SET_DIRTY(pEeprom, page);
+      }
+    }
+    __set_PRIMASK(primask);
+
+    Address += chunk;
+    pData   += chunk;
+  }
+
+  if (pRequest == NULL)
+  {
+    return HAL_OK;
+  }
+
+  pRequest->FirstPage = (end - Size) / pEeprom->PageSize;
+  pRequest->LastPage  = (end - 1U) / pEeprom->PageSize;
+  pRequest->Failures  = pEeprom->Failures;
+  pRequest->pNext     = NULL;
+  pRequest->Status    = HAL_BUSY;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  busy = EEPROM_IsBusy(pEeprom, pRequest->FirstPage, pRequest->LastPage);
+  if (busy != 0U)
+  {
+    if (pEeprom->pTail == NULL)
+    {
+      pEeprom->pHead = pRequest;
+    }
+    else
+    {
+      pEeprom->pTail->pNext = pRequest;
+    }
+    pEeprom->pTail = pRequest;
+  }
+  __set_PRIMASK(primask);
+
+  if (busy == 0U)
+  {
+    pRequest->Status = HAL_OK;
+    if (pRequest->Callback != NULL)
+    {
+      pRequest->Callback(pRequest);
+    }
+  }
+  return HAL_OK;
+}
+
+/**
+  * @brief  Tells whether all the writes are done.
+  * @param  pEeprom: EEPROM handle
+  * @retval 1 if no page is dirty or being written, 0 otherwise
+  */
+uint32_t EEPROM_Async_IsIdle(EEPROM_AsyncTypeDef *pEeprom)
+{
+  return ((pEeprom->State != EEPROM_STATE_LOAD) && (pEeprom->State != EEPROM_STATE_WRITE) &&
+          (pEeprom->State != EEPROM_STATE_WAIT) && (pEeprom->State != EEPROM_STATE_FAILED) &&
+          (EEPROM_NextDirty(pEeprom) == EEPROM_NO_PAGE)) ? 1U : 0U;
+}
+
+/**
+  * @brief  Polls the page being written and starts the next page write.
+  *         To be called every millisecond.
+  * @param  pEeprom: EEPROM handle
+  * @retval None
+  */
+void EEPROM_Async_Tick(EEPROM_AsyncTypeDef *pEeprom)
+{
+  if (pEeprom->State == EEPROM_STATE_WAIT)
+  {
+    /* One address byte on the bus: the EEPROM acknowledges once the write
+       cycle is over */
+    pEeprom->Polls++;
+    if (HAL_I2C_IsDeviceReady(pEeprom->hi2c, EEPROM_DevAddress(pEeprom, pEeprom->Page * pEeprom->PageSize),
+                              1U, 1U) == HAL_OK)
+    {
+      pEeprom->PageWrites++;
+      pEeprom->Retries = 0U;
+      pEeprom->Page    = EEPROM_NO_PAGE;
+      pEeprom->State   = EEPROM_STATE_IDLE;
+      EEPROM_Complete(pEeprom);
+    }
+    else if ((HAL_GetTick() - pEeprom->WriteTick) >= EEPROM_ASYNC_WRITE_TIMEOUT)
+    {
+      EEPROM_Retry(pEeprom);
+    }
+  }
+  else if (pEeprom->State == EEPROM_STATE_FAILED)
+  {
+    EEPROM_Retry(pEeprom);
+  }
+
+  if (pEeprom->State == EEPROM_STATE_IDLE)
+  {
+    EEPROM_StartPage(pEeprom);
+  }
+}
+
+/**
+  * @brief  To be called from HAL_I2C_MemTxCpltCallback().
+  * @param  pEeprom: EEPROM handle
+  * @param  hi2c: I2C handle of the callback
+  * @retval None
+  */
+void EEPROM_Async_I2C_TxCpltCallback(EEPROM_AsyncTypeDef *pEeprom, I2C_HandleTypeDef *hi2c)
+{
+  if ((hi2c == pEeprom->hi2c) && (pEeprom->State == EEPROM_STATE_WRITE))
+  {
+    pEeprom->WriteTick = HAL_GetTick();
+    pEeprom->State     = EEPROM_STATE_WAIT;
+  }
+}
+
+/**
+  * @brief  To be called from HAL_I2C_MemRxCpltCallback().
+  * @param  pEeprom: EEPROM handle
+  * @param  hi2c: I2C handle of the callback
+  * @retval None
+  */
+void EEPROM_Async_I2C_RxCpltCallback(EEPROM_AsyncTypeDef *pEeprom, I2C_HandleTypeDef *hi2c)
+{
+  if ((hi2c != pEeprom->hi2c) || (pEeprom->State != EEPROM_STATE_LOAD))
+  {
+    return;
+  }
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if ((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    SCB_InvalidateDCache_by_Addr((uint32_t *)&pEeprom->pCache[pEeprom->Loaded], (int32_t)pEeprom->Chunk);
+  }
+#endif
+
+  pEeprom->Loaded += pEeprom->Chunk;
+  pEeprom->Retries = 0U;
+  if (pEeprom->Loaded >= pEeprom->Size)
+  {
+    pEeprom->State      = EEPROM_STATE_IDLE;
+    pEeprom->LoadStatus = HAL_OK;
+  }
+  else if (EEPROM_StartLoad(pEeprom) != HAL_OK)
+  {
+    pEeprom->State      = EEPROM_STATE_ERROR;
+    pEeprom->LoadStatus = HAL_ERROR;
+  }
+}
+
+/**
+  * @brief  To be called from HAL_I2C_ErrorCallback().
+  * @param  pEeprom: EEPROM handle
+  * @param  hi2c: I2C handle of the callback
+  * @retval None
+  */
+void EEPROM_Async_I2C_ErrorCallback(EEPROM_AsyncTypeDef *pEeprom, I2C_HandleTypeDef *hi2c)
+{
+  if (hi2c != pEeprom->hi2c)
+  {
+    return;
+  }
+
+  if (pEeprom->State == EEPROM_STATE_LOAD)
+  {
+    pEeprom->Retries++;
+    if ((pEeprom->Retries >= EEPROM_ASYNC_RETRIES) || (EEPROM_StartLoad(pEeprom) != HAL_OK))
+    {
+      pEeprom->State      = EEPROM_STATE_ERROR;
+      pEeprom->LoadStatus = HAL_ERROR;
+    }
+  }
+  else if (pEeprom->State == EEPROM_STATE_WRITE)
+  {
+    /* Retried by the tick, out of the interrupt */
+    pEeprom->State = EEPROM_STATE_FAILED;
+  }
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Starts the read of the next part of the cache.
+  * @param  pEeprom: EEPROM handle
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef EEPROM_StartLoad(EEPROM_AsyncTypeDef *pEeprom)
+{
+  uint32_t address = pEeprom->Loaded;
+  uint32_t chunk   = pEeprom->Size - address;
+
+  if (chunk > EEPROM_ASYNC_READ_CHUNK)
+  {
+    chunk = EEPROM_ASYNC_READ_CHUNK;
+  }
+  /* With 8-bit addresses a read must stay in a 256-byte block */
+  if ((pEeprom->MemAddSize == I2C_MEMADD_SIZE_8BIT) && (chunk > (256U - (address & 0xFFU))))
+  {
+    chunk = 256U - (address & 0xFFU);
+  }
+  pEeprom->Chunk = chunk;
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if ((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    SCB_InvalidateDCache_by_Addr((uint32_t *)&pEeprom->pCache[address], (int32_t)chunk);
+  }
+#endif
+
+  if (pEeprom->hi2c->hdmarx != NULL)
+  {
+    return HAL_I2C_Mem_Read_DMA(pEeprom->hi2c, EEPROM_DevAddress(pEeprom, address), (uint16_t)address,
+                                pEeprom->MemAddSize, &pEeprom->pCache[address], (uint16_t)chunk);
+  }
+  return HAL_I2C_Mem_Read_IT(pEeprom->hi2c, EEPROM_DevAddress(pEeprom, address), (uint16_t)address,
+                             pEeprom->MemAddSize, &pEeprom->pCache[address], (uint16_t)chunk);
+}
+
+/**
+  * @brief  Starts the write of the next dirty page, if any.
+  * @param  pEeprom: EEPROM handle
+  * @retval None
+  */
+static void EEPROM_StartPage(EEPROM_AsyncTypeDef *pEeprom)
+{
+  HAL_StatusTypeDef status;
+  uint32_t          primask;
+  uint32_t          page;
+  uint32_t          address;
+  uint32_t          size;
+
+  page = EEPROM_NextDirty(pEeprom);
+  if (page == EEPROM_NO_PAGE)
+  {
+    return;
+  }
+  address = page * pEeprom->PageSize;
+  size    = pEeprom->Size - address;
+  if (size > pEeprom->PageSize)
+  {
+    size = pEeprom->PageSize;
+  }
+
+  /* A write to the page from now on marks it dirty again */
+  primask = __get_PRIMASK();
+  __disable_irq();
+  EEPROM_CLR_DIRTY(pEeprom, page);
+  memcpy(pEeprom->Buffer, &pEeprom->pCache[address], size);
+  __set_PRIMASK(primask);
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if ((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    SCB_CleanDCache_by_Addr((uint32_t *)pEeprom->Buffer, (int32_t)sizeof(pEeprom->Buffer));
+  }
+#endif
+
+  pEeprom->Page   = page;
+  pEeprom->Cursor = ((page + 1U) < EEPROM_PAGES(pEeprom)) ? (page + 1U) : 0U;
+  pEeprom->State  = EEPROM_STATE_WRITE;
+
+  if (pEeprom->hi2c->hdmatx != NULL)
+  {
+    status = HAL_I2C_Mem_Write_DMA(pEeprom->hi2c, EEPROM_DevAddress(pEeprom, address), (uint16_t)address,
+                                   pEeprom->MemAddSize, pEeprom->Buffer, (uint16_t)size);
+  }
+  else
+  {
+    status = HAL_I2C_Mem_Write_IT(pEeprom->hi2c, EEPROM_DevAddress(pEeprom, address), (uint16_t)address,
+                                  pEeprom->MemAddSize, pEeprom->Buffer, (uint16_t)size);
+  }
+
+  if (status == HAL_BUSY)
+  {
+    /* Bus used by another driver: tried again at the next tick */
+    primask = __get_PRIMASK();
+    __disable_irq();
+    EEPROM_SET_DIRTY(pEeprom, page);
+    __set_PRIMASK(primask);
+    pEeprom->Cursor = page;
+    pEeprom->Page   = EEPROM_NO_PAGE;
+    pEeprom->State  = EEPROM_STATE_IDLE;
+  }
+  else if (status != HAL_OK)
+  {
+    pEeprom->State = EEPROM_STATE_FAILED;
+  }
+}
+
+/**
+  * @brief  Writes the current page again or gives it up.
+  * @param  pEeprom: EEPROM handle
+  * @retval None
+  */
+static void EEPROM_Retry(EEPROM_AsyncTypeDef *pEeprom)
+{
+  uint32_t primask;
+
+  pEeprom->Retries++;
+  if (pEeprom->Retries < EEPROM_ASYNC_RETRIES)
+  {
+    primask = __get_PRIMASK();
+    __disable_irq();
+    EEPROM_SET_DIRTY(pEeprom, pEeprom->Page);
+    __set_PRIMASK(primask);
+    pEeprom->Cursor = pEeprom->Page;
+  }
+  else
+  {
+    /* The cache keeps the data: a later write to the page tries again */
+    pEeprom->Failures++;
+    pEeprom->Retries = 0U;
+  }
+  pEeprom->Page  = EEPROM_NO_PAGE;
+  pEeprom->State = EEPROM_STATE_IDLE;
+  EEPROM_Complete(pEeprom);
+}
+
+/**
+  * @brief  Calls back the requests whose pages are all written.
+  * @param  pEeprom: EEPROM handle
+  * @retval None
+  */
+static void EEPROM_Complete(EEPROM_AsyncTypeDef *pEeprom)
+{
+  EEPROM_Async_RequestTypeDef *pRequest;
+  EEPROM_Async_RequestTypeDef *pNext;
+  EEPROM_Async_RequestTypeDef *pDone = NULL;
+  EEPROM_Async_RequestTypeDef *pDoneTail = NULL;
+  uint32_t                    primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  pRequest       = pEeprom->pHead;
+  pEeprom->pHead = NULL;
+  pEeprom->pTail = NULL;
+  while (pRequest != NULL)
+  {
+    pNext           = pRequest->pNext;
+    pRequest->pNext = NULL;
+    if (EEPROM_IsBusy(pEeprom, pRequest->FirstPage, pRequest->LastPage) != 0U)
+    {
+      if (pEeprom->pTail == NULL)
+      {
+        pEeprom->pHead = pRequest;
+      }
+      else
+      {
+        pEeprom->pTail->pNext = pRequest;
+      }
+      pEeprom->pTail = pRequest;
+    }
+    else
+    {
+      if (pDoneTail == NULL)
+      {
+        pDone = pRequest;
+      }
+      else
+      {
+        pDoneTail->pNext = pRequest;
+      }
+      pDoneTail = pRequest;
+    }
+    pRequest = pNext;
+  }
+  __set_PRIMASK(primask);
+
+  /* Out of the critical section, the callbacks may write again */
+  while (pDone != NULL)
+  {
+    pNext = pDone->pNext;
+    pDone->Status = (pDone->Failures != pEeprom->Failures) ? HAL_ERROR : HAL_OK;
+    if (pDone->Callback != NULL)
+    {
+      pDone->Callback(pDone);
+    }
+    pDone = pNext;
+  }
+}
+
+/**
+  * @brief  Finds the next dirty page from the cursor, in address order.
+  * @param  pEeprom: EEPROM handle
+  * @retval Page number, EEPROM_NO_PAGE if none
+  */
+static uint32_t EEPROM_NextDirty(EEPROM_AsyncTypeDef *pEeprom)
+{
+  uint32_t pages = EEPROM_PAGES(pEeprom);
+  uint32_t page  = pEeprom->Cursor;
+  uint32_t n;
+
+  for (n = 0U; n < pages; n++)
+  {
+    if (((page & 31U) == 0U) && ((page + 32U) <= pages) && ((pages - n) >= 32U) &&
+        (pEeprom->Dirty[page >> 5U] == 0U))
+    {
+      /* Whole clean word */
+      n    += 31U;
+      page += 31U;
+    }
+    else if (EEPROM_IS_DIRTY(pEeprom, page) != 0U)
+    {
+      return page;
+    }
+    page = ((page + 1U) < pages) ? (page + 1U) : 0U;
+  }
+  return EEPROM_NO_PAGE;
+}
+
+/**
+  * @brief  Tells whether pages of a range are dirty or being written.
+  * @param  pEeprom: EEPROM handle
+  * @param  FirstPage: first page of the range
+  * @param  LastPage: last page of the range
+  * @retval 1 if busy, 0 otherwise
+  */
+static uint32_t EEPROM_IsBusy(EEPROM_AsyncTypeDef *pEeprom, uint32_t FirstPage, uint32_t LastPage)
+{
+  uint32_t page;
+
+  if ((pEeprom->Page != EEPROM_NO_PAGE) && (pEeprom->Page >= FirstPage) && (pEeprom->Page <= LastPage))
+  {
+    return 1U;
+  }
+  for (page = FirstPage; page <= LastPage; page++)
+  {
+    if (EEPROM_IS_DIRTY(pEeprom, page) != 0U)
+    {
+      return 1U;
+    }
+  }
+  return 0U;
+}
+
+/**
+  * @brief  Device address of a memory address, with the block bits of the
+  *         8-bit addressed EEPROMs.
+  * @param  pEeprom: EEPROM handle
+  * @param  Address: memory address
+  * @retval 8-bit device address
+  */
+static uint16_t EEPROM_DevAddress(EEPROM_AsyncTypeDef *pEeprom, uint32_t Address)
+{
+  if (pEeprom->MemAddSize == I2C_MEMADD_SIZE_8BIT)
+  {
+    return (uint16_t)(pEeprom->DevAddress | ((Address >> 7U) & 0x0EU));
+  }
+  return pEeprom->DevAddress;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,640 @@
+/**
+  ******************************************************************************
+  * @file    enc_service.c
+  * @author  MCD Application Team
+  * @brief   Encoder and hall sensor position service: positions sampled by
+  *          DMA at a fixed rate, unwrapped, index aligned and tracked by an
+  *          alpha-beta velocity estimator in batches.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- ENC_SOURCE_ENCODER: initialize the encoder timer with
+   HAL_TIM_Encoder_Init() (ARR = 0xFFFF, or 0xFFFFFFFF on TIM2/TIM5) and,
+   with an index pulse, its channel 3 or 4 as input capture of the index
+   input with HAL_TIM_IC_ConfigChannel(). ENC_SOURCE_HALL: configure the
+   three hall sensor pins as inputs of one GPIO port.
+
+2- initialize the sampling timer with HAL_TIM_Base_Init(), its period is
+   set here from SampleRate, and link a circular DMA stream to its update
+   request (htimSample->hdma[TIM_DMA_ID_UPDATE]), peripheral to memory,
+   word transfers on both sides. The DMA reads the encoder counter (or the
+   GPIO input register) directly: with an encoder on APB1 and the sampling
+   timer on DMA1, only DMA1 reaches APB1, TIM1/TIM8 on DMA2 reach any
+   encoder timer. Call HAL_DMA_IRQHandler() from the DMA interrupt
+   handler: the module sets the DMA callbacks itself. Neither timer raises
+   an interrupt: no interrupt per count nor per sample.
+
+3- ENC_Service_Start() starts both timers. Every half ring (BatchSize
+   samples) the DMA interrupt unwraps the samples into a 64-bit position
+   (at most half the counter range, or 2 hall sectors, per sample), runs
+   the alpha-beta tracker on each sample, checks the index capture and
+   publishes the state: ENC_Service_BatchCallback() gets it, a servo loop
+   can run from it at SampleRate / BatchSize.
+
+4- the index capture is read once per batch: the first index pulse sets
+   position 0, later ones are checked against CountsPerRev and realign the
+   position when counts were lost (IndexErrors).
+
+5- ENC_Service_GetState() copies the last state without masking
+   interrupts: the DMA interrupt writes it under a sequence counter and the
+   reader retries when it changed under it.
+
+6- tracker: with samples x(k), prediction p = x + v * T, residual
+   r = x(k) - p, then x = p + Alpha * r and v = v + Beta * r / T. Alpha
+   0.1 to 0.5 and Beta = Alpha^2 / (2 - Alpha) give a critically damped
+   response; lower gains smooth more and lag more.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "enc_service.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define ENC_HALL_INVALID     0xFFU
+
+/* Private macro -------------------------------------------------------------*/
+/* Timers on APB2 */
+#define ENC_SERVICE_TIM_APB2(__TIM__)  ((uint32_t)(__TIM__) >= APB2PERIPH_BASE)
+
+/* Capture flag and register of the index channel */
+#define ENC_SERVICE_CC_FLAG(__CHANNEL__)         (TIM_SR_CC1IF << ((__CHANNEL__) >> 2U))
+#define ENC_SERVICE_CCR(__TIM__, __CHANNEL__)    ((&(__TIM__)->CCR1)[(__CHANNEL__) >> 2U])
+
+/* Private variables ---------------------------------------------------------*/
+static ENC_ServiceTypeDef *EncServices[ENC_SERVICE_MAX];
+
+/* Hall state (A | B << 1 | C << 2) to sector, 120 degree sensors */
+static const uint8_t EncHallSector[8] = { ENC_HALL_INVALID, 0U, 2U, 1U, 4U, 5U, 3U, ENC_HALL_INVALID };
+
+/* Private function prototypes -----------------------------------------------*/
+static HAL_StatusTypeDef   ENC_Service_TimerInit(ENC_ServiceTypeDef *pEnc);
+static uint32_t            ENC_Service_HallSector(const ENC_ServiceTypeDef *pEnc, uint32_t Input);
+static int32_t             ENC_Service_Wrap(uint32_t From, uint32_t To, uint32_t Range);
+static void                ENC_Service_Index(ENC_ServiceTypeDef *pEnc);
+static void                ENC_Service_Process(ENC_ServiceTypeDef *pEnc, uint32_t Half);
+static ENC_ServiceTypeDef *ENC_Service_Find(const DMA_HandleTypeDef *hdma);
+static void                ENC_Service_DMAHalfCplt(DMA_HandleTypeDef *hdma);
+static void                ENC_Service_DMACplt(DMA_HandleTypeDef *hdma);
+static void                ENC_Service_DMAError(DMA_HandleTypeDef *hdma);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Check the configuration and set the sampling timer period
+  * @param  pEnc: service context, kept by the module
+  * @param  pConfig: source, timers and ring, copied
+  * @retval HAL status
+  */
+HAL_StatusTypeDef ENC_Service_Init(ENC_ServiceTypeDef *pEnc, const ENC_Service_ConfigTypeDef *pConfig)
+{
+  DMA_HandleTypeDef *hdma;
+
+  if ((pEnc == NULL) || (pConfig->htimSample == NULL) || (pConfig->pRing == NULL) ||
+      (pConfig->BatchSize == 0U) || ((2U * pConfig->BatchSize) > 0xFFFFU) ||
+      (pConfig->Alpha < 0.0f) || (pConfig->Alpha > 1.0f) || (pConfig->Beta < 0.0f) ||
+      (pConfig->Beta > (4.0f - (2.0f * pConfig->Alpha))))
+  {
+    return HAL_ERROR;
+  }
+
+  hdma = pConfig->htimSample->hdma[TIM_DMA_ID_UPDATE];
+  if ((hdma == NULL) || (hdma->Init.Mode != DMA_CIRCULAR) || (hdma->Init.Direction != DMA_PERIPH_TO_MEMORY) ||
+      (hdma->Init.PeriphDataAlignment != DMA_PDATAALIGN_WORD) || (hdma->Init.MemDataAlignment != DMA_MDATAALIGN_WORD))
+  {
+    return HAL_ERROR;
+  }
+
+  if (pConfig->Source == ENC_SOURCE_ENCODER)
+  {
+    if ((pConfig->htimEnc == NULL) ||
+        ((pConfig->IndexChannel != ENC_NO_INDEX) && (pConfig->IndexChannel != TIM_CHANNEL_3) &&
+         (pConfig->IndexChannel != TIM_CHANNEL_4)))
+    {
+      return HAL_ERROR;
+    }
+  }
+  else if (pConfig->Source == ENC_SOURCE_HALL)
+  {
+    if ((pConfig->HallPort == NULL) || (pConfig->HallPins[0] == 0U) || (pConfig->HallPins[1] == 0U) ||
+        (pConfig->HallPins[2] == 0U))
+    {
+      return HAL_ERROR;
+    }
+  }
+  else
+  {
+    return HAL_ERROR;
+  }
+
+  memset(pEnc, 0, sizeof(ENC_ServiceTypeDef));
+  pEnc->Config = *pConfig;
+  if (pConfig->Source == ENC_SOURCE_ENCODER)
+  {
+    pEnc->Range = pConfig->htimEnc->Instance->ARR + 1U;
+  }
+
+  return ENC_Service_TimerInit(pEnc);
+}
+
+/**
+  * @brief  Start the encoder, the DMA ring and the sampling timer
+  * @param  pEnc: service context
+  * @retval HAL status
+  */
+HAL_StatusTypeDef ENC_Service_Start(ENC_ServiceTypeDef *pEnc)
+{
+  TIM_HandleTypeDef *htim = pEnc->Config.htimSample;
+  TIM_HandleTypeDef *henc = pEnc->Config.htimEnc;
+  DMA_HandleTypeDef *hdma = htim->hdma[TIM_DMA_ID_UPDATE];
+  uint32_t source;
+  uint32_t primask;
+  uint32_t slot = ENC_SERVICE_MAX;
+  uint32_t i;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  for (i = 0U; i < ENC_SERVICE_MAX; i++)
+  {
+    if ((EncServices[i] != NULL) && (EncServices[i]->Config.htimSample == htim))
+    {
+      __set_PRIMASK(primask);
+      return HAL_BUSY;
+    }
+    if ((EncServices[i] == NULL) && (slot == ENC_SERVICE_MAX))
+    {
+      slot = i;
+    }
+  }
+  if (slot == ENC_SERVICE_MAX)
+  {
+    __set_PRIMASK(primask);
+    return HAL_ERROR;
+  }
+  EncServices[slot] = pEnc;
+  __set_PRIMASK(primask);
+
+  pEnc->Position = 0;
+  pEnc->Offset = 0;
+  pEnc->TrackInt = 0;
+  pEnc->TrackFrac = 0.0f;
+  pEnc->Velocity = 0.0f;
+  pEnc->Aligned = 0U;
+  pEnc->Batches = 0U;
+  memset(&pEnc->State, 0, sizeof(ENC_Service_StateTypeDef));
+
+  if (pEnc->Config.Source == ENC_SOURCE_ENCODER)
+  {
+    if (HAL_TIM_Encoder_Start(henc, TIM_CHANNEL_ALL) != HAL_OK)
+    {
+      (void)ENC_Service_Stop(pEnc);
+      return HAL_ERROR;
+    }
+    if (pEnc->Config.IndexChannel != ENC_NO_INDEX)
+    {
+      henc->Instance->SR = ~ENC_SERVICE_CC_FLAG(pEnc->Config.IndexChannel);
+      TIM_CCxChannelCmd(henc->Instance, pEnc->Config.IndexChannel, TIM_CCx_ENABLE);
+    }
+    pEnc->Last = henc->Instance->CNT;
+    source = (uint32_t)&henc->Instance->CNT;
+  }
+  else
+  {
+    pEnc->Last = ENC_Service_HallSector(pEnc, pEnc->Config.HallPort->IDR);
+    source = (uint32_t)&pEnc->Config.HallPort->IDR;
+  }
+
+  hdma->XferHalfCpltCallback = ENC_Service_DMAHalfCplt;
+  hdma->XferCpltCallback = ENC_Service_DMACplt;
+  hdma->XferErrorCallback = ENC_Service_DMAError;
+  if (HAL_DMA_Start_IT(hdma, source, (uint32_t)pEnc->Config.pRing, 2U * pEnc->Config.BatchSize) != HAL_OK)
+  {
+    (void)ENC_Service_Stop(pEnc);
+    return HAL_ERROR;
+  }
+
+  __HAL_TIM_ENABLE_DMA(htim, TIM_DMA_UPDATE);
+  __HAL_TIM_ENABLE(htim);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the sampling timer, the DMA ring and the encoder
+  * @param  pEnc: service context
+  * @retval HAL status
+  */
+HAL_StatusTypeDef ENC_Service_Stop(ENC_ServiceTypeDef *pEnc)
+{
+  TIM_HandleTypeDef *htim = pEnc->Config.htimSample;
+  uint32_t i;
+
+  htim->Instance->CR1 &= ~TIM_CR1_CEN;
+  __HAL_TIM_DISABLE_DMA(htim, TIM_DMA_UPDATE);
+  (void)HAL_DMA_Abort(htim->hdma[TIM_DMA_ID_UPDATE]);
+
+  if (pEnc->Config.Source == ENC_SOURCE_ENCODER)
+  {
+    if (pEnc->Config.IndexChannel != ENC_NO_INDEX)
+    {
+      TIM_CCxChannelCmd(pEnc->Config.htimEnc->Instance, pEnc->Config.IndexChannel, TIM_CCx_DISABLE);
+    }
+    (void)HAL_TIM_Encoder_Stop(pEnc->Config.htimEnc, TIM_CHANNEL_ALL);
+  }
+
+  for (i = 0U; i < ENC_SERVICE_MAX; i++)
+  {
+    if (EncServices[i] == pEnc)
+    {
+      EncServices[i] = NULL;
+    }
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Copy the state of the last batch, lock-free
+  * @note   May be called from any context of lower priority than the DMA
+  *         interrupt, which is never delayed by it.
+  * @param  pEnc: service context
+  * @param  pState: copy of the state
+  * @retval None
+  */
+void ENC_Service_GetState(ENC_ServiceTypeDef *pEnc, ENC_Service_StateTypeDef *pState)
+{
+  uint32_t seq;
+
+  do
+  {
+    seq = pEnc->Seq;
+    __DMB();
+    *pState = pEnc->State;
+    __DMB();
+  } while (((seq & 1U) != 0U) || (seq != pEnc->Seq));
+}
+
+/**
+  * @brief  Batch processed, runs in the DMA interrupt
+  * @param  pEnc: service context
+  * @param  pState: state at the last sample of the batch
+  * @retval None
+  */
+__weak void ENC_Service_BatchCallback(ENC_ServiceTypeDef *pEnc, const ENC_Service_StateTypeDef *pState)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(pEnc);
+  UNUSED(pState);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the ENC_Service_BatchCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  DMA error, the sampling has stopped
+  * @param  pEnc: service context
+  * @retval None
+  */
+__weak void ENC_Service_ErrorCallback(ENC_ServiceTypeDef *pEnc)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(pEnc);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the ENC_Service_ErrorCallback could be implemented in the user file
+   */
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Sampling timer period from SampleRate
+  * @param  pEnc: service context
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef ENC_Service_TimerInit(ENC_ServiceTypeDef *pEnc)
+{
+  TIM_HandleTypeDef *htim = pEnc->Config.htimSample;
+  uint32_t clock;
+  uint32_t ticks;
+  uint32_t prescaler;
+  uint32_t period;
+
+  if (ENC_SERVICE_TIM_APB2(htim->Instance))
+  {
+    clock = HAL_RCC_GetPCLK2Freq();
+    clock *= ((RCC->CFGR & RCC_CFGR_PPRE2) == RCC_CFGR_PPRE2_DIV1) ? 1U : 2U;
+  }
+  else
+  {
+    clock = HAL_RCC_GetPCLK1Freq();
+    clock *= ((RCC->CFGR & RCC_CFGR_PPRE1) == RCC_CFGR_PPRE1_DIV1) ? 1U : 2U;
+  }
+
+  if ((pEnc->Config.SampleRate == 0U) || (pEnc->Config.SampleRate > clock))
+  {
+    return HAL_ERROR;
+  }
+
+  ticks = clock / pEnc->Config.SampleRate;
+  prescaler = (ticks - 1U) / 0x10000U;
+  period = (ticks / (prescaler + 1U)) - 1U;
+  if (prescaler > 0xFFFFU)
+  {
+    return HAL_ERROR;
+  }
+
+  __HAL_TIM_SET_PRESCALER(htim, prescaler);
+  __HAL_TIM_SET_AUTORELOAD(htim, period);
+  htim->Init.Prescaler = prescaler;
+  htim->Init.Period = period;
+  pEnc->SampleRate = clock / ((prescaler + 1U) * (period + 1U));
+  pEnc->Period = 1.0f / (float)pEnc->SampleRate;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Hall sector of a GPIO input register value
+  * @param  pEnc: service context
+  * @param  Input: GPIO IDR
+  * @retval Sector 0 to 5, ENC_HALL_INVALID: all sensors at the same level
+  */
+static uint32_t ENC_Service_HallSector(const ENC_ServiceTypeDef *pEnc, uint32_t Input)
+{
+  uint32_t state;
+
+  state = (((Input & pEnc->Config.HallPins[0]) != 0U) ? 1U : 0U) |
+          (((Input & pEnc->Config.HallPins[1]) != 0U) ? 2U : 0U) |
+          (((Input & pEnc->Config.HallPins[2]) != 0U) ? 4U : 0U);
+
+  return EncHallSector[state];
+}
+
+/**
+  * @brief  Signed counter difference, the shortest way round
+  * @param  From: previous counter value
+  * @param  To: new counter value
+  * @param  Range: counter values, 0: 2^32
+  * @retval To - From, between -Range / 2 and Range / 2
+  */
+static int32_t ENC_Service_Wrap(uint32_t From, uint32_t To, uint32_t Range)
+{
+  uint32_t delta;
+
+  if (Range == 0U)
+  {
+    return (int32_t)(To - From);
+  }
+
+  delta = (To >= From) ? (To - From) : ((To + Range) - From);
+
+  return (delta >= (Range / 2U)) ? ((int32_t)delta - (int32_t)Range) : (int32_t)delta;
+}
+
+/**
+  * @brief  Align the position on the index pulse captured, if any
+  * @param  pEnc: service context
+  * @retval None
+  */
+static void ENC_Service_Index(ENC_ServiceTypeDef *pEnc)
+{
+  TIM_TypeDef *tim = pEnc->Config.htimEnc->Instance;
+  const uint32_t channel = pEnc->Config.IndexChannel;
+  const int64_t cpr = (int64_t)pEnc->Config.CountsPerRev;
+  int64_t index;
+  int64_t error;
+
+  if ((tim->SR & ENC_SERVICE_CC_FLAG(channel)) == 0U)
+  {
+    return;
+  }
+
+  /* Reading the capture clears the flag; the pulse is near the last sample */
+  index = pEnc->Position + ENC_Service_Wrap(pEnc->Last, ENC_SERVICE_CCR(tim, channel), pEnc->Range);
+
+  if (pEnc->Aligned == 0U)
+  {
+    pEnc->Offset = -index;
+    pEnc->Aligned = 1U;
+  }
+  else if (cpr != 0)
+  {
+    error = (index + pEnc->Offset) % cpr;
+    if (error > (cpr / 2))
+    {
+      error -= cpr;
+    }
+    else if (error < -(cpr / 2))
+    {
+      error += cpr;
+    }
+    if (error != 0)
+    {
+      pEnc->Offset -= error;
+      pEnc->IndexErrors++;
+    }
+  }
+}
+
+/**
+  * @brief  Unwrap and track a half ring of samples, publish the state
+  * @param  pEnc: service context
+  * @param  Half: 0 first half, 1 second half
+  * @retval None
+  */
+static void ENC_Service_Process(ENC_ServiceTypeDef *pEnc, uint32_t Half)
+{
+  const uint32_t size = pEnc->Config.BatchSize;
+  const uint32_t *pSample = &pEnc->Config.pRing[Half * size];
+  const float alpha = pEnc->Config.Alpha;
+  const float gain = pEnc->Config.Beta * (float)pEnc->SampleRate;
+  const float period = pEnc->Period;
+  DMA_HandleTypeDef *hdma = pEnc->Config.htimSample->hdma[TIM_DMA_ID_UPDATE];
+  int64_t position = pEnc->Position;
+  int64_t track = pEnc->TrackInt;
+  float frac = pEnc->TrackFrac;
+  float velocity = pEnc->Velocity;
+  float residual;
+  uint32_t last = pEnc->Last;
+  uint32_t sector;
+  uint32_t remaining;
+  uint32_t i;
+  int32_t step;
+
+  for (i = 0U; i < size; i++)
+  {
+    if (pEnc->Config.Source == ENC_SOURCE_ENCODER)
+    {
+      position += ENC_Service_Wrap(last, pSample[i], pEnc->Range);
+      last = pSample[i];
+    }
+    else
+    {
+      sector = ENC_Service_HallSector(pEnc, pSample[i]);
+      if (sector == ENC_HALL_INVALID)
+      {
+        pEnc->HallErrors++;
+      }
+      else if (last == ENC_HALL_INVALID)
+      {
+        last = sector;
+      }
+      else
+      {
+        step = (int32_t)sector - (int32_t)last;
+        step += (step > 3) ? -6 : ((step < -2) ? 6 : 0);
+        if (step == 3)
+        {
+          /* Three sectors apart: direction unknown */
+          pEnc->HallErrors++;
+        }
+        else
+        {
+          position += step;
+        }
+        last = sector;
+      }
+    }
+
+    /* Alpha-beta tracker, the integer part kept apart for the precision */
+    frac += velocity * period;
+    step = (int32_t)frac;
+    track += step;
+    frac -= (float)step;
+    residual = (float)(position - track) - frac;
+    frac += alpha * residual;
+    velocity += gain * residual;
+  }
+
+  pEnc->Position = position;
+  pEnc->Last = last;
+  pEnc->TrackInt = track;
+  pEnc->TrackFrac = frac;
+  pEnc->Velocity = velocity;
+  pEnc->Batches++;
+
+  if ((pEnc->Config.Source == ENC_SOURCE_ENCODER) && (pEnc->Config.IndexChannel != ENC_NO_INDEX))
+  {
+    ENC_Service_Index(pEnc);
+  }
+
+  /* The DMA must still be in the other half */
+  remaining = __HAL_DMA_GET_COUNTER(hdma);
+  if ((Half == 0U) ? (remaining > size) : (remaining <= size))
+  {
+    pEnc->Overruns++;
+  }
+
+  pEnc->Seq++;
+  __DMB();
+  pEnc->State.Position = position + pEnc->Offset;
+  pEnc->State.Estimate = (float)(track - position) + frac;
+  pEnc->State.Velocity = velocity;
+  pEnc->State.Batches = pEnc->Batches;
+  pEnc->State.Aligned = pEnc->Aligned;
+  __DMB();
+  pEnc->Seq++;
+
+  ENC_Service_BatchCallback(pEnc, &pEnc->State);
+}
+
+/**
+  * @brief  Service of a DMA handle
+  * @param  hdma: DMA handle
+  * @retval Service, NULL: none
+  */
+static ENC_ServiceTypeDef *ENC_Service_Find(const DMA_HandleTypeDef *hdma)
+{
+  uint32_t i;
+
+  for (i = 0U; i < ENC_SERVICE_MAX; i++)
+  {
+    if ((EncServices[i] != NULL) && (EncServices[i]->Config.htimSample->hdma[TIM_DMA_ID_UPDATE] == hdma))
+    {
+      return EncServices[i];
+    }
+  }
+
+  return NULL;
+}
+
+/**
+  * @brief  First half of the ring sampled
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void ENC_Service_DMAHalfCplt(DMA_HandleTypeDef *hdma)
+{
+  ENC_ServiceTypeDef *pEnc = ENC_Service_Find(hdma);
+
+  if (pEnc != NULL)
+  {
+    ENC_Service_Process(pEnc, 0U);
+  }
+}
+
+/**
+  * @brief  Second half of the ring sampled
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void ENC_Service_DMACplt(DMA_HandleTypeDef *hdma)
+{
+  ENC_ServiceTypeDef *pEnc = ENC_Service_Find(hdma);
+
+  if (pEnc != NULL)
+  {
+    ENC_Service_Process(pEnc, 1U);
+  }
+}
+
+/**
+  * @brief  DMA error on the ring
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void ENC_Service_DMAError(DMA_HandleTypeDef *hdma)
+{
+  ENC_ServiceTypeDef *pEnc = ENC_Service_Find(hdma);
+
+  if (pEnc != NULL)
+  {
+    pEnc->Errors++;
+    ENC_Service_ErrorCallback(pEnc);
+  }
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,135 @@
+/**
+  ******************************************************************************
+  * @file    enc_service.h
+  * @author  MCD Application Team
+  * @brief   Header for enc_service module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _ENC_SERVICE_H__
+#define _ENC_SERVICE_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#if !defined(HAL_TIM_MODULE_ENABLED) || !defined(HAL_DMA_MODULE_ENABLED)
+#error "enc_service requires the HAL TIM and DMA drivers"
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t            Source;         /* ENC_SOURCE_xxx                                      */
+  TIM_HandleTypeDef   *htimSample;    /* Sampling timer: HAL_TIM_Base_Init() done, its period
+                                         set here from SampleRate, with a circular word DMA
+                                         linked in htimSample->hdma[TIM_DMA_ID_UPDATE]       */
+  uint32_t            SampleRate;     /* Position samples per second                         */
+  /* ENC_SOURCE_ENCODER */
+  TIM_HandleTypeDef   *htimEnc;       /* Encoder timer: HAL_TIM_Encoder_Init() done          */
+  uint32_t            IndexChannel;   /* TIM_CHANNEL_3 or TIM_CHANNEL_4 of htimEnc capturing
+                                         the index pulse, ENC_NO_INDEX: none                 */
+  uint32_t            CountsPerRev;   /* Counts between index pulses                         */
+  /* ENC_SOURCE_HALL */
+  GPIO_TypeDef        *HallPort;      /* Port of the three hall sensor inputs                */
+  uint16_t            HallPins[3];    /* GPIO_PIN_x of sensors A, B and C                    */
+  /* Ring and estimator */
+  uint32_t            *pRing;         /* DMA ring: 2 * BatchSize words                       */
+  uint32_t            BatchSize;      /* Samples per half ring, processed together           */
+  float               Alpha;          /* Position gain of the alpha-beta tracker, 0 to 1     */
+  float               Beta;           /* Velocity gain, 0 to 4 - 2 * Alpha                   */
+} ENC_Service_ConfigTypeDef;
+
+typedef struct
+{
+  int64_t             Position;       /* Last sample, unwrapped, in counts (hall: sectors),
+                                         0 at the index once aligned                         */
+  float               Estimate;       /* Tracked position relative to Position, in counts    */
+  float               Velocity;       /* Tracked velocity, in counts per second              */
+  uint32_t            Batches;        /* Batches processed                                   */
+  uint32_t            Aligned;        /* 1: index seen, Position referenced to it            */
+} ENC_Service_StateTypeDef;
+
+typedef struct
+{
+  ENC_Service_ConfigTypeDef Config;
+  uint32_t            SampleRate;     /* Rate set in the sampling timer                      */
+  float               Period;         /* 1 / SampleRate, in seconds                          */
+  uint32_t            Range;          /* Encoder counter values, ARR + 1, 0: 2^32            */
+  uint32_t            Last;           /* Last counter value or hall sector                   */
+  int64_t             Position;       /* Unwrapped, before the index offset                  */
+  int64_t             Offset;         /* Added to Position, from the index                   */
+  int64_t             TrackInt;       /* Tracked position, integer part                      */
+  float               TrackFrac;      /* and fraction                                        */
+  float               Velocity;
+  uint32_t            Aligned;
+  uint32_t            Batches;
+  uint32_t            IndexErrors;    /* Index pulses off the CountsPerRev grid, realigned   */
+  uint32_t            HallErrors;     /* Invalid hall states or skipped sectors              */
+  uint32_t            Overruns;       /* Half rings rewritten by the DMA while processed     */
+  uint32_t            Errors;         /* DMA errors                                          */
+  __IO uint32_t       Seq;            /* Odd while State is written                          */
+  ENC_Service_StateTypeDef State;
+} ENC_ServiceTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+#define ENC_SOURCE_ENCODER   0U   /* Quadrature encoder counter of htimEnc             */
+#define ENC_SOURCE_HALL      1U   /* Three 120 degree hall sensors, 6 sectors a turn   */
+
+#define ENC_NO_INDEX         0xFFFFFFFFU
+
+/* Services running at the same time. Override in main.h. */
+#if !defined(ENC_SERVICE_MAX)
+#define ENC_SERVICE_MAX      4U
+#endif
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef ENC_Service_Init(ENC_ServiceTypeDef *pEnc, const ENC_Service_ConfigTypeDef *pConfig);
+HAL_StatusTypeDef ENC_Service_Start(ENC_ServiceTypeDef *pEnc);
+HAL_StatusTypeDef ENC_Service_Stop(ENC_ServiceTypeDef *pEnc);
+void              ENC_Service_GetState(ENC_ServiceTypeDef *pEnc, ENC_Service_StateTypeDef *pState);
+
+void ENC_Service_BatchCallback(ENC_ServiceTypeDef *pEnc, const ENC_Service_StateTypeDef *pState);
+void ENC_Service_ErrorCallback(ENC_ServiceTypeDef *pEnc);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _ENC_SERVICE_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
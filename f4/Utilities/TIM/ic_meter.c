@@ -0,0 +1,717 @@
+/**
+  ******************************************************************************
+  * @file    ic_meter.c
+  * @author  MCD Application Team
+  * @brief   Input capture measurement engine: circular capture DMA rings
+  *          turned into 64-bit edge timestamps and per block frequency,
+  *          period jitter and duty statistics.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- initialize the timer with HAL_TIM_IC_Init(), counting up, and its input
+   capture channels with HAL_TIM_IC_ConfigChannel(): Channel on the rising
+   edges (direct TI) and, for the duty, DutyChannel on the falling edges of
+   the same input (indirect TI), as for PWM input. Link a circular DMA
+   stream to each channel (htim->hdma[TIM_DMA_ID_CCx]), word transfers in
+   memory, and call HAL_DMA_IRQHandler() from its interrupt handler: the
+   module sets the DMA callbacks itself, the HAL TIM callbacks stay free.
+   Rising and falling streams of a meter must share the same interrupt
+   priority.
+
+2- the timestamps extend the counter with its overflows: call
+   IC_Meter_TIM_IRQHandler() from the timer update interrupt handler instead
+   of HAL_TIM_IRQHandler(). The captures are served by the DMA, the timer
+   raises one interrupt per counter period and none per edge. Several
+   meters (up to IC_METER_MAX) can share one timer, 4 per timer with
+   independent inputs or 2 with duty, their timestamps are then comparable.
+
+3- IC_Meter_Init() then IC_Meter_Start() for each input. Every half ring
+   (BlockSize edges) the captures are turned into timestamps in the DMA
+   interrupt, the block statistics are published and
+   IC_Meter_BlockCallback() gets the raw captures with the timestamp of the
+   first one: edge i is at FirstEdge + sum of the counter differences
+   (modulo ARR + 1) up to i.
+
+4- two consecutive edges must be less than one counter period apart, and
+   the half ring must be processed within one counter period from its last
+   edge: use a 32-bit timer (TIM2, TIM5) with ARR = 0xFFFFFFFF, or a
+   prescaler slowing a 16-bit one below the slowest input. Inputs slower
+   than that are reported through Timeout as stalled.
+
+5- IC_Meter_GetSnapshot() copies the last statistics without masking
+   interrupts: the DMA interrupt writes them under a sequence counter and
+   the reader retries when it changed under it. Stalled is evaluated at
+   the time of the call.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "ic_meter.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Timers on APB2 */
+#define IC_METER_TIM_APB2(__TIM__)  ((uint32_t)(__TIM__) >= APB2PERIPH_BASE)
+
+#define IC_METER_IS_CHANNEL(__CHANNEL__)  (((__CHANNEL__) == TIM_CHANNEL_1) || ((__CHANNEL__) == TIM_CHANNEL_2) || \
+                                           ((__CHANNEL__) == TIM_CHANNEL_3) || ((__CHANNEL__) == TIM_CHANNEL_4))
+
+/* DMA handle index, DMA request and capture register of a channel */
+#define IC_METER_DMA_ID(__CHANNEL__)      ((uint32_t)TIM_DMA_ID_CC1 + ((__CHANNEL__) >> 2U))
+#define IC_METER_DMA_REQ(__CHANNEL__)     ((uint32_t)TIM_DMA_CC1 << ((__CHANNEL__) >> 2U))
+#define IC_METER_CCR(__TIM__, __CHANNEL__) (&(__TIM__)->CCR1 + ((__CHANNEL__) >> 2U))
+
+/* Counter difference from __A__ to __B__ */
+#define IC_METER_DELTA(__A__, __B__, __RANGE__) \
+  (((__B__) >= (__A__)) ? ((__B__) - (__A__)) : (((__B__) + (__RANGE__)) - (__A__)))
+
+/* Private variables ---------------------------------------------------------*/
+static IC_MeterTypeDef *IcMeters[IC_METER_MAX];
+
+/* Private function prototypes -----------------------------------------------*/
+static HAL_StatusTypeDef IC_Meter_StartChannel(IC_MeterTypeDef *pMeter, uint32_t Channel, uint32_t *pRing);
+static void              IC_Meter_StopChannel(IC_MeterTypeDef *pMeter, uint32_t Channel);
+static IC_MeterTypeDef  *IC_Meter_Find(const DMA_HandleTypeDef *hdma, uint32_t *pFall);
+static uint64_t          IC_Meter_Now(IC_MeterTypeDef *pMeter, uint32_t *pCounter);
+static void              IC_Meter_Process(IC_MeterTypeDef *pMeter, uint32_t Fall, uint32_t Half);
+static void              IC_Meter_Duty(IC_MeterTypeDef *pMeter);
+static uint32_t          IC_Meter_Sqrt(uint64_t Value);
+static void              IC_Meter_DMAHalfCplt(DMA_HandleTypeDef *hdma);
+static void              IC_Meter_DMACplt(DMA_HandleTypeDef *hdma);
+static void              IC_Meter_DMAError(DMA_HandleTypeDef *hdma);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Check the configuration and read the timer clock
+  * @param  pMeter: meter context, kept by the module
+  * @param  pConfig: timer, channels and rings, copied
+  * @retval HAL status
+  */
+HAL_StatusTypeDef IC_Meter_Init(IC_MeterTypeDef *pMeter, const IC_Meter_ConfigTypeDef *pConfig)
+{
+  TIM_HandleTypeDef *htim = pConfig->htim;
+  uint32_t clock;
+
+  if ((pMeter == NULL) || (htim == NULL) || (pConfig->pRing == NULL) || (pConfig->BlockSize < 2U) ||
+      ((2U * pConfig->BlockSize) > 0xFFFFU) || !IC_METER_IS_CHANNEL(pConfig->Channel) ||
+      (htim->hdma[IC_METER_DMA_ID(pConfig->Channel)] == NULL) ||
+      (htim->hdma[IC_METER_DMA_ID(pConfig->Channel)]->Init.Mode != DMA_CIRCULAR))
+  {
+    return HAL_ERROR;
+  }
+  if ((pConfig->DutyChannel != IC_METER_NO_DUTY) &&
+      (!IC_METER_IS_CHANNEL(pConfig->DutyChannel) || (pConfig->DutyChannel == pConfig->Channel) ||
+       (htim->hdma[IC_METER_DMA_ID(pConfig->DutyChannel)] == NULL) ||
+       (htim->hdma[IC_METER_DMA_ID(pConfig->DutyChannel)]->Init.Mode != DMA_CIRCULAR)))
+  {
+    return HAL_ERROR;
+  }
+
+  memset(pMeter, 0, sizeof(IC_MeterTypeDef));
+  pMeter->Config = *pConfig;
+
+  if (IC_METER_TIM_APB2(htim->Instance))
+  {
+    clock = HAL_RCC_GetPCLK2Freq();
+    clock *= ((RCC->CFGR & RCC_CFGR_PPRE2) == RCC_CFGR_PPRE2_DIV1) ? 1U : 2U;
+  }
+  else
+  {
+    clock = HAL_RCC_GetPCLK1Freq();
+    clock *= ((RCC->CFGR & RCC_CFGR_PPRE1) == RCC_CFGR_PPRE1_DIV1) ? 1U : 2U;
+  }
+  pMeter->TickFreq = clock / (htim->Instance->PSC + 1U);
+
+  /* A full 32-bit counter wraps at 2^32, Range 0 */
+  pMeter->Range = htim->Instance->ARR + 1U;
+  pMeter->TimeoutTicks = (uint32_t)(((uint64_t)pConfig->Timeout * pMeter->TickFreq) / 1000U);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Start the capture DMA rings, and the timer when not yet running
+  * @param  pMeter: meter context
+  * @retval HAL status
+  */
+HAL_StatusTypeDef IC_Meter_Start(IC_MeterTypeDef *pMeter)
+{
+  TIM_HandleTypeDef *htim = pMeter->Config.htim;
+  uint32_t primask;
+  uint32_t slot = IC_METER_MAX;
+  uint32_t epoch = 0U;
+  uint32_t i;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  for (i = 0U; i < IC_METER_MAX; i++)
+  {
+    if (IcMeters[i] == pMeter)
+    {
+      __set_PRIMASK(primask);
+      return HAL_BUSY;
+    }
+    if (IcMeters[i] == NULL)
+    {
+      slot = (slot == IC_METER_MAX) ? i : slot;
+    }
+    else if (IcMeters[i]->Config.htim == htim)
+    {
+      /* Same time base as the meters already on this timer */
+      epoch = IcMeters[i]->Epoch;
+    }
+  }
+  if (slot == IC_METER_MAX)
+  {
+    __set_PRIMASK(primask);
+    return HAL_ERROR;
+  }
+  pMeter->Epoch = epoch;
+  IcMeters[slot] = pMeter;
+  __set_PRIMASK(primask);
+
+  pMeter->RiseBlocks = 0U;
+  pMeter->FallBlocks = 0U;
+  pMeter->PeriodQ8 = 0U;
+  memset(&pMeter->Snapshot, 0, sizeof(IC_Meter_SnapshotTypeDef));
+
+  if ((htim->Instance->CR1 & TIM_CR1_CEN) == 0U)
+  {
+    htim->Instance->CNT = 0U;
+    __HAL_TIM_CLEAR_FLAG(htim, TIM_FLAG_UPDATE);
+    __HAL_TIM_ENABLE_IT(htim, TIM_IT_UPDATE);
+    __HAL_TIM_ENABLE(htim);
+  }
+
+  if (IC_Meter_StartChannel(pMeter, pMeter->Config.Channel, pMeter->Config.pRing) != HAL_OK)
+  {
+    (void)IC_Meter_Stop(pMeter);
+    return HAL_ERROR;
+  }
+  if ((pMeter->Config.DutyChannel != IC_METER_NO_DUTY) &&
+      (IC_Meter_StartChannel(pMeter, pMeter->Config.DutyChannel,
+                             &pMeter->Config.pRing[2U * pMeter->Config.BlockSize]) != HAL_OK))
+  {
+    (void)IC_Meter_Stop(pMeter);
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the capture DMA rings, and the timer when no other meter uses it
+  * @param  pMeter: meter context
+  * @retval HAL status
+  */
+HAL_StatusTypeDef IC_Meter_Stop(IC_MeterTypeDef *pMeter)
+{
+  TIM_HandleTypeDef *htim = pMeter->Config.htim;
+  uint32_t others = 0U;
+  uint32_t i;
+
+  IC_Meter_StopChannel(pMeter, pMeter->Config.Channel);
+  if (pMeter->Config.DutyChannel != IC_METER_NO_DUTY)
+  {
+    IC_Meter_StopChannel(pMeter, pMeter->Config.DutyChannel);
+  }
+
+  for (i = 0U; i < IC_METER_MAX; i++)
+  {
+    if (IcMeters[i] == pMeter)
+    {
+      IcMeters[i] = NULL;
+    }
+    else if ((IcMeters[i] != NULL) && (IcMeters[i]->Config.htim == htim))
+    {
+      others++;
+    }
+  }
+
+  if (others == 0U)
+  {
+    __HAL_TIM_DISABLE_IT(htim, TIM_IT_UPDATE);
+    htim->Instance->CR1 &= ~TIM_CR1_CEN;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Copy the statistics of the last block, lock-free
+  * @note   May be called from any context of lower priority than the DMA
+  *         interrupts, which are never delayed by it.
+  * @param  pMeter: meter context
+  * @param  pSnapshot: copy of the statistics
+  * @retval None
+  */
+void IC_Meter_GetSnapshot(IC_MeterTypeDef *pMeter, IC_Meter_SnapshotTypeDef *pSnapshot)
+{
+  uint32_t seq;
+  uint64_t now;
+
+  do
+  {
+    seq = pMeter->Seq;
+    __DMB();
+    *pSnapshot = pMeter->Snapshot;
+    __DMB();
+  } while (((seq & 1U) != 0U) || (seq != pMeter->Seq));
+
+  now = IC_Meter_Now(pMeter, NULL);
+  if ((pMeter->TimeoutTicks != 0U) && ((now - pSnapshot->LastEdge) > pMeter->TimeoutTicks))
+  {
+    pSnapshot->Stalled = 1U;
+    pSnapshot->Frequency = 0U;
+  }
+}
+
+/**
+  * @brief  Current time on the timestamp scale
+  * @param  pMeter: meter context
+  * @retval Timer ticks since the timer start
+  */
+uint64_t IC_Meter_GetTime(IC_MeterTypeDef *pMeter)
+{
+  return IC_Meter_Now(pMeter, NULL);
+}
+
+/**
+  * @brief  Count the timer overflows, call from the timer update interrupt
+  * @param  htim: timer handle
+  * @retval None
+  */
+void IC_Meter_TIM_IRQHandler(TIM_HandleTypeDef *htim)
+{
+  uint32_t i;
+
+  if (__HAL_TIM_GET_FLAG(htim, TIM_FLAG_UPDATE) != RESET)
+  {
+    __HAL_TIM_CLEAR_FLAG(htim, TIM_FLAG_UPDATE);
+    for (i = 0U; i < IC_METER_MAX; i++)
+    {
+      if ((IcMeters[i] != NULL) && (IcMeters[i]->Config.htim == htim))
+      {
+        IcMeters[i]->Epoch++;
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Block of rising edges measured
+  * @param  pMeter: meter context
+  * @param  FirstEdge: timestamp of pCaptures[0]
+  * @param  pCaptures: raw capture values, valid until the DMA rewrites them
+  * @param  Count: captures in the block
+  * @retval None
+  */
+__weak void IC_Meter_BlockCallback(IC_MeterTypeDef *pMeter, uint64_t FirstEdge, const uint32_t *pCaptures, uint32_t Count)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(pMeter);
+  UNUSED(FirstEdge);
+  UNUSED(pCaptures);
+  UNUSED(Count);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the IC_Meter_BlockCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  DMA error, the capture stream of the meter has stopped
+  * @param  pMeter: meter context
+  * @retval None
+  */
+__weak void IC_Meter_ErrorCallback(IC_MeterTypeDef *pMeter)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(pMeter);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the IC_Meter_ErrorCallback could be implemented in the user file
+   */
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Start the circular DMA of a capture channel and the channel
+  * @param  pMeter: meter context
+  * @param  Channel: TIM_CHANNEL_x
+  * @param  pRing: 2 * BlockSize words
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef IC_Meter_StartChannel(IC_MeterTypeDef *pMeter, uint32_t Channel, uint32_t *pRing)
+{
+  TIM_HandleTypeDef *htim = pMeter->Config.htim;
+  DMA_HandleTypeDef *hdma = htim->hdma[IC_METER_DMA_ID(Channel)];
+
+  hdma->XferHalfCpltCallback = IC_Meter_DMAHalfCplt;
+  hdma->XferCpltCallback = IC_Meter_DMACplt;
+  hdma->XferErrorCallback = IC_Meter_DMAError;
+
+  if (HAL_DMA_Start_IT(hdma, (uint32_t)IC_METER_CCR(htim->Instance, Channel), (uint32_t)pRing,
+                       2U * pMeter->Config.BlockSize) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  __HAL_TIM_ENABLE_DMA(htim, IC_METER_DMA_REQ(Channel));
+  TIM_CCxChannelCmd(htim->Instance, Channel, TIM_CCx_ENABLE);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop a capture channel and its DMA
+  * @param  pMeter: meter context
+  * @param  Channel: TIM_CHANNEL_x
+  * @retval None
+  */
+static void IC_Meter_StopChannel(IC_MeterTypeDef *pMeter, uint32_t Channel)
+{
+  TIM_HandleTypeDef *htim = pMeter->Config.htim;
+
+  TIM_CCxChannelCmd(htim->Instance, Channel, TIM_CCx_DISABLE);
+  __HAL_TIM_DISABLE_DMA(htim, IC_METER_DMA_REQ(Channel));
+  (void)HAL_DMA_Abort(htim->hdma[IC_METER_DMA_ID(Channel)]);
+}
+
+/**
+  * @brief  Meter and stream of a DMA handle
+  * @param  hdma: DMA handle
+  * @param  pFall: set to 1 for the falling edge stream
+  * @retval Meter, NULL: none
+  */
+static IC_MeterTypeDef *IC_Meter_Find(const DMA_HandleTypeDef *hdma, uint32_t *pFall)
+{
+  IC_MeterTypeDef *pMeter;
+  uint32_t i;
+
+  for (i = 0U; i < IC_METER_MAX; i++)
+  {
+    pMeter = IcMeters[i];
+    if (pMeter == NULL)
+    {
+      continue;
+    }
+    if (pMeter->Config.htim->hdma[IC_METER_DMA_ID(pMeter->Config.Channel)] == hdma)
+    {
+      *pFall = 0U;
+      return pMeter;
+    }
+    if ((pMeter->Config.DutyChannel != IC_METER_NO_DUTY) &&
+        (pMeter->Config.htim->hdma[IC_METER_DMA_ID(pMeter->Config.DutyChannel)] == hdma))
+    {
+      *pFall = 1U;
+      return pMeter;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+  * @brief  Current timestamp, consistent with the overflow count
+  * @param  pMeter: meter context
+  * @param  pCounter: counter value used, NULL: not needed
+  * @retval Timer ticks since the timer start
+  */
+static uint64_t IC_Meter_Now(IC_MeterTypeDef *pMeter, uint32_t *pCounter)
+{
+  TIM_TypeDef *tim = pMeter->Config.htim->Instance;
+  uint64_t range = (pMeter->Range == 0U) ? 0x100000000ULL : pMeter->Range;
+  uint32_t epoch;
+  uint32_t counter;
+  uint32_t pending;
+
+  do
+  {
+    epoch = pMeter->Epoch;
+    counter = tim->CNT;
+    pending = tim->SR & TIM_SR_UIF;
+  } while (epoch != pMeter->Epoch);
+
+  /* Overflow not yet counted by the update interrupt: the flag read after
+     the counter is only relevant when the counter has wrapped */
+  if ((pending != 0U) && ((uint64_t)counter < (range / 2U)))
+  {
+    epoch++;
+  }
+
+  if (pCounter != NULL)
+  {
+    *pCounter = counter;
+  }
+
+  return ((uint64_t)epoch * range) + counter;
+}
+
+/**
+  * @brief  Timestamps and statistics of a half ring
+  * @param  pMeter: meter context
+  * @param  Fall: 0 rising edge stream, 1 falling edge stream
+  * @param  Half: 0 first half, 1 second half
+  * @retval None
+  */
+static void IC_Meter_Process(IC_MeterTypeDef *pMeter, uint32_t Fall, uint32_t Half)
+{
+  const uint32_t size = pMeter->Config.BlockSize;
+  const uint32_t *pCap = &pMeter->Config.pRing[((2U * Fall) + Half) * size];
+  const uint32_t range = pMeter->Range;
+  DMA_HandleTypeDef *hdma;
+  uint64_t last;
+  uint64_t first;
+  uint64_t span = 0U;
+  uint64_t offsets = 0U;
+  uint64_t square = 0U;
+  uint64_t gap = 0U;
+  uint32_t counter;
+  uint32_t remaining;
+  uint32_t period;
+  uint32_t mean;
+  uint32_t min = 0xFFFFFFFFU;
+  uint32_t max = 0U;
+  uint32_t count;
+  uint32_t i;
+  int64_t deviation;
+
+  /* Newest edge first, from the current time, then backwards */
+  last = IC_Meter_Now(pMeter, &counter);
+  last -= IC_METER_DELTA(pCap[size - 1U], counter, range);
+
+  for (i = 1U; i < size; i++)
+  {
+    period = IC_METER_DELTA(pCap[i - 1U], pCap[i], range);
+    span += period;
+    offsets += span;
+    min = (period < min) ? period : min;
+    max = (period > max) ? period : max;
+  }
+  first = last - span;
+
+  hdma = pMeter->Config.htim->hdma[IC_METER_DMA_ID((Fall != 0U) ? pMeter->Config.DutyChannel : pMeter->Config.Channel)];
+  remaining = __HAL_DMA_GET_COUNTER(hdma);
+  if ((Half == 0U) ? (remaining > size) : (remaining <= size))
+  {
+    pMeter->Overruns++;
+  }
+
+  if (Fall != 0U)
+  {
+    pMeter->FallFirst = first;
+    pMeter->FallOffsets = offsets;
+    pMeter->FallBlocks++;
+    IC_Meter_Duty(pMeter);
+    return;
+  }
+
+  /* The period between the blocks, unless the input stalled in between */
+  count = size - 1U;
+  if (pMeter->RiseBlocks != 0U)
+  {
+    gap = first - pMeter->PrevEdge;
+    if ((gap <= 0xFFFFFFFFU) && ((pMeter->TimeoutTicks == 0U) || (gap <= pMeter->TimeoutTicks)))
+    {
+      span += gap;
+      count++;
+      min = ((uint32_t)gap < min) ? (uint32_t)gap : min;
+      max = ((uint32_t)gap > max) ? (uint32_t)gap : max;
+    }
+    else
+    {
+      gap = 0U;
+    }
+  }
+  mean = (uint32_t)(span / count);
+
+  for (i = 1U; i < size; i++)
+  {
+    deviation = (int64_t)IC_METER_DELTA(pCap[i - 1U], pCap[i], range) - (int64_t)mean;
+    square += (uint64_t)(deviation * deviation);
+  }
+  if (gap != 0U)
+  {
+    deviation = (int64_t)gap - (int64_t)mean;
+    square += (uint64_t)(deviation * deviation);
+  }
+
+  pMeter->PrevEdge = last;
+  pMeter->RiseFirst = first;
+  pMeter->RiseOffsets = offsets;
+  pMeter->RiseBlocks++;
+  pMeter->PeriodQ8 = (span << 8U) / count;
+
+  pMeter->Seq++;
+  __DMB();
+  pMeter->Snapshot.LastEdge = last;
+  pMeter->Snapshot.Frequency = (span == 0U) ? 0U : (uint32_t)(((uint64_t)count * pMeter->TickFreq * 1000U) / span);
+  pMeter->Snapshot.Period = mean;
+  pMeter->Snapshot.PeriodMin = min;
+  pMeter->Snapshot.PeriodMax = max;
+  pMeter->Snapshot.Jitter = IC_Meter_Sqrt(square / count);
+  pMeter->Snapshot.Blocks = pMeter->RiseBlocks;
+  pMeter->Snapshot.Stalled = 0U;
+  __DMB();
+  pMeter->Seq++;
+
+  IC_Meter_Duty(pMeter);
+
+  IC_Meter_BlockCallback(pMeter, first, pCap, size);
+}
+
+/**
+  * @brief  Duty from the last blocks of both streams
+  * @note   The mean falling to rising edge offset is reduced modulo the mean
+  *         period: blocks of the two streams need not start on the same
+  *         cycle, nor be the same block.
+  * @param  pMeter: meter context
+  * @retval None
+  */
+static void IC_Meter_Duty(IC_MeterTypeDef *pMeter)
+{
+  int64_t offset;
+  int64_t period = (int64_t)pMeter->PeriodQ8;
+  uint32_t duty;
+
+  if ((pMeter->Config.DutyChannel == IC_METER_NO_DUTY) || (pMeter->FallBlocks == 0U) ||
+      (pMeter->RiseBlocks == 0U) || (period == 0) ||
+      ((pMeter->FallBlocks - pMeter->RiseBlocks + 1U) > 2U))
+  {
+    return;
+  }
+
+  /* Mean of (fall i - rise i), in 1/256 ticks */
+  offset = ((int64_t)(pMeter->FallFirst - pMeter->RiseFirst) * 256) +
+           ((((int64_t)pMeter->FallOffsets - (int64_t)pMeter->RiseOffsets) * 256) /
+            (int64_t)pMeter->Config.BlockSize);
+  offset %= period;
+  if (offset < 0)
+  {
+    offset += period;
+  }
+  duty = (uint32_t)((offset * 10000) / period);
+
+  pMeter->Seq++;
+  __DMB();
+  pMeter->Snapshot.Duty = duty;
+  __DMB();
+  pMeter->Seq++;
+}
+
+/**
+  * @brief  Integer square root
+  * @param  Value: radicand
+  * @retval floor(sqrt(Value))
+  */
+static uint32_t IC_Meter_Sqrt(uint64_t Value)
+{
+  uint64_t root = 0U;
+  uint64_t bit = 1ULL << 62U;
+
+  while (bit > Value)
+  {
+    bit >>= 2U;
+  }
+  while (bit != 0U)
+  {
+    if (Value >= (root + bit))
+    {
+      Value -= root + bit;
+      root = (root >> 1U) + bit;
+    }
+    else
+    {
+      root >>= 1U;
+    }
+    bit >>= 2U;
+  }
+
+  return (uint32_t)root;
+}
+
+/**
+  * @brief  First half of a capture ring filled
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void IC_Meter_DMAHalfCplt(DMA_HandleTypeDef *hdma)
+{
+  uint32_t fall = 0U;
+  IC_MeterTypeDef *pMeter = IC_Meter_Find(hdma, &fall);
+
+  if (pMeter != NULL)
+  {
+    IC_Meter_Process(pMeter, fall, 0U);
+  }
+}
+
+/**
+  * @brief  Second half of a capture ring filled
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void IC_Meter_DMACplt(DMA_HandleTypeDef *hdma)
+{
+  uint32_t fall = 0U;
+  IC_MeterTypeDef *pMeter = IC_Meter_Find(hdma, &fall);
+
+  if (pMeter != NULL)
+  {
+    IC_Meter_Process(pMeter, fall, 1U);
+  }
+}
+
+/**
+  * @brief  DMA error on a capture ring
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void IC_Meter_DMAError(DMA_HandleTypeDef *hdma)
+{
+  uint32_t fall = 0U;
+  IC_MeterTypeDef *pMeter = IC_Meter_Find(hdma, &fall);
+
+  if (pMeter != NULL)
+  {
+    pMeter->Errors++;
+    IC_Meter_ErrorCallback(pMeter);
+  }
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,128 @@
+/**
+  ******************************************************************************
+  * @file    ic_meter.h
+  * @author  MCD Application Team
+  * @brief   Header for ic_meter module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _IC_METER_H__
+#define _IC_METER_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#if !defined(HAL_TIM_MODULE_ENABLED) || !defined(HAL_DMA_MODULE_ENABLED)
+#error "ic_meter requires the HAL TIM and DMA drivers"
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  TIM_HandleTypeDef   *htim;          /* Timer: HAL_TIM_IC_Init() and HAL_TIM_IC_ConfigChannel()
+                                         done, counting up, update interrupt enabled in NVIC */
+  uint32_t            Channel;        /* TIM_CHANNEL_x capturing the rising edges, with a
+                                         circular word DMA linked in htim->hdma[]           */
+  uint32_t            DutyChannel;    /* TIM_CHANNEL_x capturing the falling edges of the same
+                                         input (indirect TI), IC_METER_NO_DUTY: none         */
+  uint32_t            *pRing;         /* DMA rings: 2 * BlockSize words per channel          */
+  uint32_t            BlockSize;      /* Edges per half ring, 2 at least                     */
+  uint32_t            Timeout;        /* Milliseconds without an edge before the input is
+                                         reported stalled, 0: never                          */
+} IC_Meter_ConfigTypeDef;
+
+typedef struct
+{
+  uint64_t            LastEdge;       /* Timestamp of the last rising edge, in ticks          */
+  uint32_t            Frequency;      /* Mean over the last block, in mHz, 0 when stalled     */
+  uint32_t            Period;         /* Mean period, in ticks                               */
+  uint32_t            PeriodMin;      /* Shortest period of the block, in ticks              */
+  uint32_t            PeriodMax;      /* Longest period of the block, in ticks               */
+  uint32_t            Jitter;         /* RMS deviation of the periods from Period, in ticks  */
+  uint32_t            Duty;           /* High time over period, in 0.01 %                    */
+  uint32_t            Blocks;         /* Blocks measured                                     */
+  uint32_t            Stalled;        /* 1: no edge for Timeout milliseconds                 */
+} IC_Meter_SnapshotTypeDef;
+
+typedef struct
+{
+  IC_Meter_ConfigTypeDef Config;
+  uint32_t            TickFreq;       /* Timestamp ticks per second                          */
+  uint32_t            Range;          /* Counter values, ARR + 1                             */
+  uint32_t            TimeoutTicks;
+  __IO uint32_t       Epoch;          /* Counter overflows since the timer start             */
+  uint64_t            PrevEdge;       /* Last rising edge of the previous block              */
+  uint64_t            RiseFirst;      /* First edge of the last block of each stream and     */
+  uint64_t            RiseOffsets;    /* sum of the edge offsets from it, for the duty       */
+  uint64_t            FallFirst;
+  uint64_t            FallOffsets;
+  uint32_t            RiseBlocks;
+  uint32_t            FallBlocks;
+  uint64_t            PeriodQ8;       /* Mean period of the last block, in 1/256 ticks       */
+  uint32_t            Overruns;       /* Half rings rewritten by the DMA while processed     */
+  uint32_t            Errors;         /* DMA errors                                          */
+  __IO uint32_t       Seq;            /* Odd while Snapshot is written                       */
+  IC_Meter_SnapshotTypeDef Snapshot;
+} IC_MeterTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+#define IC_METER_NO_DUTY     0xFFFFFFFFU
+
+/* Meters running at the same time. Override in main.h. */
+#if !defined(IC_METER_MAX)
+#define IC_METER_MAX         8U
+#endif
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef IC_Meter_Init(IC_MeterTypeDef *pMeter, const IC_Meter_ConfigTypeDef *pConfig);
+HAL_StatusTypeDef IC_Meter_Start(IC_MeterTypeDef *pMeter);
+HAL_StatusTypeDef IC_Meter_Stop(IC_MeterTypeDef *pMeter);
+void              IC_Meter_GetSnapshot(IC_MeterTypeDef *pMeter, IC_Meter_SnapshotTypeDef *pSnapshot);
+uint64_t          IC_Meter_GetTime(IC_MeterTypeDef *pMeter);
+
+void IC_Meter_TIM_IRQHandler(TIM_HandleTypeDef *htim);
+
+void IC_Meter_BlockCallback(IC_MeterTypeDef *pMeter, uint64_t FirstEdge, const uint32_t *pCaptures, uint32_t Count);
+void IC_Meter_ErrorCallback(IC_MeterTypeDef *pMeter);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _IC_METER_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
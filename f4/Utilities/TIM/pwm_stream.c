@@ -0,0 +1,609 @@
+/**
+  ******************************************************************************
+  * @file    pwm_stream.c
+  * @author  MCD Application Team
+  * @brief   Timer DMA burst streaming: compare values of up to four channels
+  *          written every period from a DMA ring refilled half by half,
+  *          for waveform PWM and WS2812 style bitstreams.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- initialize the timer with HAL_TIM_PWM_Init(), counting up, its period
+   set (ARR), and channels 1 to Channels with HAL_TIM_PWM_ConfigChannel().
+   Link a circular DMA stream to the update request
+   (htim->hdma[TIM_DMA_ID_UPDATE]), memory to peripheral, word transfers
+   on both sides, and call HAL_DMA_IRQHandler() from its interrupt handler:
+   the module sets the DMA callbacks itself. The compare preload is enabled
+   here.
+
+2- every update event the DMA burst (TIMx_DCR/DMAR) writes the next
+   Channels compare values, CCR1 first. The ring holds 2 * Periods such
+   sets; each half is refilled in the DMA interrupt while the other one
+   plays, so the timer runs without gaps between frames and a half ring
+   must be refilled within Periods timer periods. Values written take
+   effect one period later (compare preload).
+
+3- PWM_STREAM_MODE_CALLBACK: PWM_Stream_FillCallback() writes Periods sets
+   of Channels values, e.g. motor commutation tables.
+   PWM_STREAM_MODE_SINE3: three sines 120 degrees apart on channels 1 to 3
+   from a q15 table, frequency and amplitude set with PWM_Stream_SetSine()
+   at any time (center aligned or edge aligned timer).
+
+4- PWM_STREAM_MODE_BITSTREAM: one bit per period on each channel, Bit1 or
+   Bit0 compare ticks, most significant bit first; e.g. WS2812 at 800 kHz
+   with ARR + 1 = 1.25 us, Bit0 = 0.4 us, Bit1 = 0.8 us, ResetPeriods = 40.
+   PWM_Stream_SubmitFrame() queues a frame of Size bytes per channel
+   (channel c at pData[c * Size]), one frame may wait while another is
+   encoded: PWM_Stream_FrameCallback() hands the buffer back once encoded,
+   the next frame can be submitted from it. Between frames the outputs
+   stay low, ResetPeriods at least.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "pwm_stream.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Phase offsets of the second and third sines, 1/3 and 2/3 of a turn */
+#define PWM_STREAM_PHASE_120     0x55555555U
+#define PWM_STREAM_PHASE_240     0xAAAAAAAAU
+
+/* Private macro -------------------------------------------------------------*/
+/* Timers on APB2 */
+#define PWM_STREAM_TIM_APB2(__TIM__)  ((uint32_t)(__TIM__) >= APB2PERIPH_BASE)
+
+/* Private variables ---------------------------------------------------------*/
+static PWM_StreamTypeDef *PwmStreams[PWM_STREAM_MAX];
+
+static const uint32_t PwmStreamChannels[4] = { TIM_CHANNEL_1, TIM_CHANNEL_2, TIM_CHANNEL_3, TIM_CHANNEL_4 };
+
+/* Private function prototypes -----------------------------------------------*/
+static void              PWM_Stream_Fill(PWM_StreamTypeDef *pStream, uint32_t Half);
+static void              PWM_Stream_Sine(PWM_StreamTypeDef *pStream, uint32_t *pDst, uint32_t Periods);
+static void              PWM_Stream_Encode(PWM_StreamTypeDef *pStream, uint32_t *pDst, uint32_t Periods);
+static PWM_StreamTypeDef *PWM_Stream_Find(const DMA_HandleTypeDef *hdma);
+static void              PWM_Stream_DMAHalfCplt(DMA_HandleTypeDef *hdma);
+static void              PWM_Stream_DMACplt(DMA_HandleTypeDef *hdma);
+static void              PWM_Stream_DMAError(DMA_HandleTypeDef *hdma);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Check the configuration and enable the compare preload
+  * @param  pStream: stream context, kept by the module
+  * @param  pConfig: timer, mode and ring, copied
+  * @retval HAL status
+  */
+HAL_StatusTypeDef PWM_Stream_Init(PWM_StreamTypeDef *pStream, const PWM_Stream_ConfigTypeDef *pConfig)
+{
+  TIM_HandleTypeDef *htim = pConfig->htim;
+  DMA_HandleTypeDef *hdma;
+  uint64_t ticks;
+  uint32_t clock;
+  uint32_t arr;
+
+  if ((pStream == NULL) || (htim == NULL) || (pConfig->pRing == NULL) || (pConfig->Periods == 0U) ||
+      (pConfig->Channels == 0U) || (pConfig->Channels > 4U) ||
+      ((2U * pConfig->Periods * pConfig->Channels) > 0xFFFFU) || !IS_TIM_DMA_INSTANCE(htim->Instance))
+  {
+    return HAL_ERROR;
+  }
+
+  hdma = htim->hdma[TIM_DMA_ID_UPDATE];
+  if ((hdma == NULL) || (hdma->Init.Mode != DMA_CIRCULAR) || (hdma->Init.Direction != DMA_MEMORY_TO_PERIPH) ||
+      (hdma->Init.PeriphDataAlignment != DMA_PDATAALIGN_WORD) || (hdma->Init.MemDataAlignment != DMA_MDATAALIGN_WORD))
+  {
+    return HAL_ERROR;
+  }
+
+  arr = htim->Instance->ARR;
+  switch (pConfig->Mode)
+  {
+    case PWM_STREAM_MODE_CALLBACK:
+      break;
+
+    case PWM_STREAM_MODE_SINE3:
+      if ((pConfig->Channels != 3U) || (pConfig->pTable == NULL) || (pConfig->TableSize < 2U) ||
+          ((pConfig->TableSize & (pConfig->TableSize - 1U)) != 0U))
+      {
+        return HAL_ERROR;
+      }
+      break;
+
+    case PWM_STREAM_MODE_BITSTREAM:
+      if ((pConfig->Bit0 > arr) || (pConfig->Bit1 > arr))
+      {
+        return HAL_ERROR;
+      }
+      break;
+
+    default:
+      return HAL_ERROR;
+  }
+
+  memset(pStream, 0, sizeof(PWM_StreamTypeDef));
+  pStream->Config = *pConfig;
+  pStream->RingLength = 2U * pConfig->Periods * pConfig->Channels;
+
+  if (PWM_STREAM_TIM_APB2(htim->Instance))
+  {
+    clock = HAL_RCC_GetPCLK2Freq();
+    clock *= ((RCC->CFGR & RCC_CFGR_PPRE2) == RCC_CFGR_PPRE2_DIV1) ? 1U : 2U;
+  }
+  else
+  {
+    clock = HAL_RCC_GetPCLK1Freq();
+    clock *= ((RCC->CFGR & RCC_CFGR_PPRE1) == RCC_CFGR_PPRE1_DIV1) ? 1U : 2U;
+  }
+  ticks = ((uint64_t)htim->Instance->PSC + 1U) * ((uint64_t)arr + 1U);
+  if ((htim->Instance->CR1 & TIM_CR1_CMS) != 0U)
+  {
+    /* Center aligned: one update per up and down count */
+    ticks *= 2U;
+  }
+  pStream->PeriodRate = (uint32_t)(clock / ticks);
+
+  pStream->Center = (uint32_t)(((uint64_t)arr + 1U) / 2U);
+  pStream->TableShift = 1U + __CLZ(pConfig->TableSize);
+
+  /* The DMA writes the preload registers, taken at the next update */
+  htim->Instance->CCMR1 |= TIM_CCMR1_OC1PE | ((pConfig->Channels > 1U) ? TIM_CCMR1_OC2PE : 0U);
+  htim->Instance->CCMR2 |= ((pConfig->Channels > 2U) ? TIM_CCMR2_OC3PE : 0U) |
+                           ((pConfig->Channels > 3U) ? TIM_CCMR2_OC4PE : 0U);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Fill the ring and start the timer and its DMA burst
+  * @param  pStream: stream context
+  * @retval HAL status
+  */
+HAL_StatusTypeDef PWM_Stream_Start(PWM_StreamTypeDef *pStream)
+{
+  TIM_HandleTypeDef *htim = pStream->Config.htim;
+  DMA_HandleTypeDef *hdma = htim->hdma[TIM_DMA_ID_UPDATE];
+  uint32_t primask;
+  uint32_t slot = PWM_STREAM_MAX;
+  uint32_t i;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  for (i = 0U; i < PWM_STREAM_MAX; i++)
+  {
+    if ((PwmStreams[i] != NULL) && (PwmStreams[i]->Config.htim == htim))
+    {
+      __set_PRIMASK(primask);
+      return HAL_BUSY;
+    }
+    if ((PwmStreams[i] == NULL) && (slot == PWM_STREAM_MAX))
+    {
+      slot = i;
+    }
+  }
+  if (slot == PWM_STREAM_MAX)
+  {
+    __set_PRIMASK(primask);
+    return HAL_ERROR;
+  }
+  PwmStreams[slot] = pStream;
+  __set_PRIMASK(primask);
+
+  pStream->Phase = 0U;
+  pStream->pFrame = NULL;
+  pStream->ResetLeft = 0U;
+  PWM_Stream_Fill(pStream, 0U);
+  PWM_Stream_Fill(pStream, 1U);
+  pStream->Overruns = 0U;
+
+  /* Until the first burst lands: outputs low for a bitstream, else the first values */
+  for (i = 0U; i < pStream->Config.Channels; i++)
+  {
+    (&htim->Instance->CCR1)[i] = (pStream->Config.Mode == PWM_STREAM_MODE_BITSTREAM) ? 0U : pStream->Config.pRing[i];
+  }
+
+  hdma->XferHalfCpltCallback = PWM_Stream_DMAHalfCplt;
+  hdma->XferCpltCallback = PWM_Stream_DMACplt;
+  hdma->XferErrorCallback = PWM_Stream_DMAError;
+
+  htim->Instance->DCR = TIM_DMABASE_CCR1 | ((pStream->Config.Channels - 1U) << TIM_DCR_DBL_Pos);
+  if (HAL_DMA_Start_IT(hdma, (uint32_t)pStream->Config.pRing, (uint32_t)&htim->Instance->DMAR,
+                       pStream->RingLength) != HAL_OK)
+  {
+    (void)PWM_Stream_Stop(pStream);
+    return HAL_ERROR;
+  }
+
+  htim->Instance->CNT = 0U;
+  __HAL_TIM_ENABLE_DMA(htim, TIM_DMA_UPDATE);
+  for (i = 0U; i < pStream->Config.Channels; i++)
+  {
+    TIM_CCxChannelCmd(htim->Instance, PwmStreamChannels[i], TIM_CCx_ENABLE);
+  }
+  if (IS_TIM_BREAK_INSTANCE(htim->Instance))
+  {
+    __HAL_TIM_MOE_ENABLE(htim);
+  }
+  __HAL_TIM_ENABLE(htim);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the timer, its channels and the DMA burst
+  * @param  pStream: stream context
+  * @retval HAL status
+  */
+HAL_StatusTypeDef PWM_Stream_Stop(PWM_StreamTypeDef *pStream)
+{
+  TIM_HandleTypeDef *htim = pStream->Config.htim;
+  uint32_t i;
+
+  __HAL_TIM_DISABLE_DMA(htim, TIM_DMA_UPDATE);
+  (void)HAL_DMA_Abort(htim->hdma[TIM_DMA_ID_UPDATE]);
+
+  for (i = 0U; i < pStream->Config.Channels; i++)
+  {
+    TIM_CCxChannelCmd(htim->Instance, PwmStreamChannels[i], TIM_CCx_DISABLE);
+  }
+  if (IS_TIM_BREAK_INSTANCE(htim->Instance))
+  {
+    htim->Instance->BDTR &= ~TIM_BDTR_MOE;
+  }
+  htim->Instance->CR1 &= ~TIM_CR1_CEN;
+
+  for (i = 0U; i < PWM_STREAM_MAX; i++)
+  {
+    if (PwmStreams[i] == pStream)
+    {
+      PwmStreams[i] = NULL;
+    }
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Frequency and amplitude of the three-phase sine, taken at the next half ring
+  * @param  pStream: stream context
+  * @param  Frequency: in mHz, below half the period rate
+  * @param  Amplitude: compare swing around the middle of the period, in ticks
+  * @retval HAL status
+  */
+HAL_StatusTypeDef PWM_Stream_SetSine(PWM_StreamTypeDef *pStream, uint32_t Frequency, uint32_t Amplitude)
+{
+  uint64_t step;
+
+  if ((pStream->Config.Mode != PWM_STREAM_MODE_SINE3) || (Amplitude > pStream->Center) ||
+      (pStream->PeriodRate == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  step = ((uint64_t)Frequency << 32U) / ((uint64_t)pStream->PeriodRate * 1000U);
+  if (step >= 0x80000000U)
+  {
+    return HAL_ERROR;
+  }
+
+  pStream->Step = (uint32_t)step;
+  pStream->Amplitude = Amplitude;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Queue a bitstream frame
+  * @param  pStream: stream context
+  * @param  pData: Size bytes per channel, channel c at pData[c * Size], kept
+  *         until PWM_Stream_FrameCallback() returns it
+  * @param  Size: bytes per channel
+  * @retval HAL_BUSY when a frame is already waiting
+  */
+HAL_StatusTypeDef PWM_Stream_SubmitFrame(PWM_StreamTypeDef *pStream, const uint8_t *pData, uint32_t Size)
+{
+  if ((pStream->Config.Mode != PWM_STREAM_MODE_BITSTREAM) || (pData == NULL) || (Size == 0U) ||
+      (Size > (0xFFFFFFFFU / 8U)))
+  {
+    return HAL_ERROR;
+  }
+  if (pStream->pNext != NULL)
+  {
+    return HAL_BUSY;
+  }
+
+  /* Taken by the DMA interrupt once pNext is set */
+  pStream->NextSize = Size;
+  __DMB();
+  pStream->pNext = pData;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Compare values of a half ring, PWM_STREAM_MODE_CALLBACK
+  * @param  pStream: stream context
+  * @param  pDst: Periods sets of Channels values, CCR1 first
+  * @param  Periods: timer periods to fill
+  * @retval None
+  */
+__weak void PWM_Stream_FillCallback(PWM_StreamTypeDef *pStream, uint32_t *pDst, uint32_t Periods)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Periods);
+
+  /* Outputs low */
+  memset(pDst, 0, Periods * pStream->Config.Channels * sizeof(uint32_t));
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the PWM_Stream_FillCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Bitstream frame encoded, its buffer is free
+  * @param  pStream: stream context
+  * @param  pData: frame given to PWM_Stream_SubmitFrame()
+  * @retval None
+  */
+__weak void PWM_Stream_FrameCallback(PWM_StreamTypeDef *pStream, const uint8_t *pData)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(pStream);
+  UNUSED(pData);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the PWM_Stream_FrameCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  DMA error, the stream has stopped
+  * @param  pStream: stream context
+  * @retval None
+  */
+__weak void PWM_Stream_ErrorCallback(PWM_StreamTypeDef *pStream)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(pStream);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the PWM_Stream_ErrorCallback could be implemented in the user file
+   */
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Refill a half ring
+  * @param  pStream: stream context
+  * @param  Half: 0 first half, 1 second half
+  * @retval None
+  */
+static void PWM_Stream_Fill(PWM_StreamTypeDef *pStream, uint32_t Half)
+{
+  const uint32_t periods = pStream->Config.Periods;
+  uint32_t *pDst = &pStream->Config.pRing[Half * periods * pStream->Config.Channels];
+  uint32_t remaining;
+
+  switch (pStream->Config.Mode)
+  {
+    case PWM_STREAM_MODE_SINE3:
+      PWM_Stream_Sine(pStream, pDst, periods);
+      break;
+
+    case PWM_STREAM_MODE_BITSTREAM:
+      PWM_Stream_Encode(pStream, pDst, periods);
+      break;
+
+    default:
+      PWM_Stream_FillCallback(pStream, pDst, periods);
+      break;
+  }
+
+  /* The DMA must still be in the other half */
+  remaining = __HAL_DMA_GET_COUNTER(pStream->Config.htim->hdma[TIM_DMA_ID_UPDATE]);
+  if ((Half == 0U) ? (remaining > (pStream->RingLength / 2U)) : (remaining <= (pStream->RingLength / 2U)))
+  {
+    pStream->Overruns++;
+  }
+}
+
+/**
+  * @brief  Three sines 120 degrees apart
+  * @param  pStream: stream context
+  * @param  pDst: Periods sets of 3 values
+  * @param  Periods: timer periods to fill
+  * @retval None
+  */
+static void PWM_Stream_Sine(PWM_StreamTypeDef *pStream, uint32_t *pDst, uint32_t Periods)
+{
+  const int16_t *pTable = pStream->Config.pTable;
+  const uint32_t shift = pStream->TableShift;
+  const uint32_t step = pStream->Step;
+  const int32_t amplitude = (int32_t)pStream->Amplitude;
+  const int32_t center = (int32_t)pStream->Center;
+  uint32_t phase = pStream->Phase;
+  uint32_t i;
+
+  for (i = 0U; i < Periods; i++)
+  {
+    pDst[0] = (uint32_t)(center + ((pTable[phase >> shift] * amplitude) >> 15));
+    pDst[1] = (uint32_t)(center + ((pTable[(phase + PWM_STREAM_PHASE_120) >> shift] * amplitude) >> 15));
+    pDst[2] = (uint32_t)(center + ((pTable[(phase + PWM_STREAM_PHASE_240) >> shift] * amplitude) >> 15));
+    pDst += 3U;
+    phase += step;
+  }
+
+  pStream->Phase = phase;
+}
+
+/**
+  * @brief  Encode the frames into bit periods, low periods in between
+  * @param  pStream: stream context
+  * @param  pDst: Periods sets of Channels values
+  * @param  Periods: timer periods to fill
+  * @retval None
+  */
+static void PWM_Stream_Encode(PWM_StreamTypeDef *pStream, uint32_t *pDst, uint32_t Periods)
+{
+  const uint32_t lanes = pStream->Config.Channels;
+  const uint32_t bit0 = pStream->Config.Bit0;
+  const uint32_t bit1 = pStream->Config.Bit1;
+  const uint8_t *pFrame;
+  uint32_t size;
+  uint32_t count;
+  uint32_t mask;
+  uint32_t byte;
+  uint32_t lane;
+  uint32_t k;
+
+  while (Periods != 0U)
+  {
+    if (pStream->pFrame == NULL)
+    {
+      if ((pStream->ResetLeft == 0U) && (pStream->pNext != NULL))
+      {
+        pStream->FrameSize = pStream->NextSize;
+        pStream->pFrame = pStream->pNext;
+        pStream->pNext = NULL;
+        pStream->Bit = 0U;
+        continue;
+      }
+
+      /* Latch, or idle until the next frame */
+      count = ((pStream->ResetLeft != 0U) && (pStream->ResetLeft < Periods)) ? pStream->ResetLeft : Periods;
+      pStream->ResetLeft -= (pStream->ResetLeft != 0U) ? count : 0U;
+      memset(pDst, 0, count * lanes * sizeof(uint32_t));
+      pDst += count * lanes;
+      Periods -= count;
+      continue;
+    }
+
+    pFrame = pStream->pFrame;
+    size = pStream->FrameSize;
+    count = (size * 8U) - pStream->Bit;
+    count = (count < Periods) ? count : Periods;
+    Periods -= count;
+
+    for (k = 0U; k < count; k++)
+    {
+      byte = pStream->Bit >> 3U;
+      mask = 0x80U >> (pStream->Bit & 7U);
+      for (lane = 0U; lane < lanes; lane++)
+      {
+        pDst[lane] = ((pFrame[(lane * size) + byte] & mask) != 0U) ? bit1 : bit0;
+      }
+      pDst += lanes;
+      pStream->Bit++;
+    }
+
+    if (pStream->Bit == (size * 8U))
+    {
+      pStream->pFrame = NULL;
+      pStream->ResetLeft = pStream->Config.ResetPeriods;
+      pStream->Frames++;
+      PWM_Stream_FrameCallback(pStream, pFrame);
+    }
+  }
+}
+
+/**
+  * @brief  Stream of a DMA handle
+  * @param  hdma: DMA handle
+  * @retval Stream, NULL: none
+  */
+static PWM_StreamTypeDef *PWM_Stream_Find(const DMA_HandleTypeDef *hdma)
+{
+  uint32_t i;
+
+  for (i = 0U; i < PWM_STREAM_MAX; i++)
+  {
+    if ((PwmStreams[i] != NULL) && (PwmStreams[i]->Config.htim->hdma[TIM_DMA_ID_UPDATE] == hdma))
+    {
+      return PwmStreams[i];
+    }
+  }
+
+  return NULL;
+}
+
+/**
+  * @brief  First half of the ring played
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void PWM_Stream_DMAHalfCplt(DMA_HandleTypeDef *hdma)
+{
+  PWM_StreamTypeDef *pStream = PWM_Stream_Find(hdma);
+
+  if (pStream != NULL)
+  {
+    PWM_Stream_Fill(pStream, 0U);
+  }
+}
+
+/**
+  * @brief  Second half of the ring played
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void PWM_Stream_DMACplt(DMA_HandleTypeDef *hdma)
+{
+  PWM_StreamTypeDef *pStream = PWM_Stream_Find(hdma);
+
+  if (pStream != NULL)
+  {
+    PWM_Stream_Fill(pStream, 1U);
+  }
+}
+
+/**
+  * @brief  DMA error on the ring
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void PWM_Stream_DMAError(DMA_HandleTypeDef *hdma)
+{
+  PWM_StreamTypeDef *pStream = PWM_Stream_Find(hdma);
+
+  if (pStream != NULL)
+  {
+    pStream->Errors++;
+    PWM_Stream_ErrorCallback(pStream);
+  }
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
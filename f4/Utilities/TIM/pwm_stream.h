@@ -0,0 +1,123 @@
+/**
+  ******************************************************************************
+  * @file    pwm_stream.h
+  * @author  MCD Application Team
+  * @brief   Header for pwm_stream module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _PWM_STREAM_H__
+#define _PWM_STREAM_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#if !defined(HAL_TIM_MODULE_ENABLED) || !defined(HAL_DMA_MODULE_ENABLED)
+#error "pwm_stream requires the HAL TIM and DMA drivers"
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  TIM_HandleTypeDef   *htim;          /* Timer: HAL_TIM_PWM_Init() and HAL_TIM_PWM_ConfigChannel()
+                                         done for channels 1 to Channels, counting up, with a
+                                         circular word DMA linked in htim->hdma[TIM_DMA_ID_UPDATE] */
+  uint32_t            Mode;           /* PWM_STREAM_MODE_xxx                                 */
+  uint32_t            Channels;       /* CCR1 to CCRx written every period, 1 to 4           */
+  uint32_t            *pRing;         /* DMA ring: 2 * Periods * Channels words              */
+  uint32_t            Periods;        /* Timer periods per half ring                         */
+  /* PWM_STREAM_MODE_SINE3 */
+  const int16_t       *pTable;        /* One sine period, q15                                */
+  uint32_t            TableSize;      /* Entries in pTable, power of 2                       */
+  /* PWM_STREAM_MODE_BITSTREAM */
+  uint32_t            Bit0;           /* Compare value of a 0 bit, in ticks                  */
+  uint32_t            Bit1;           /* Compare value of a 1 bit, in ticks                  */
+  uint32_t            ResetPeriods;   /* Low periods after a frame, latch of the LEDs        */
+} PWM_Stream_ConfigTypeDef;
+
+typedef struct
+{
+  PWM_Stream_ConfigTypeDef Config;
+  uint32_t            PeriodRate;     /* Timer periods per second                            */
+  uint32_t            RingLength;     /* Words in the ring                                   */
+  /* PWM_STREAM_MODE_SINE3 */
+  uint32_t            Phase;
+  uint32_t            TableShift;     /* Phase to table index                                */
+  __IO uint32_t       Step;           /* Phase increment per period                          */
+  __IO uint32_t       Amplitude;      /* Compare swing around Center, in ticks               */
+  uint32_t            Center;
+  /* PWM_STREAM_MODE_BITSTREAM */
+  const uint8_t       *pFrame;        /* Frame being encoded, NULL: none                     */
+  uint32_t            FrameSize;      /* Bytes per lane                                      */
+  uint32_t            Bit;            /* Next bit of pFrame                                  */
+  const uint8_t       * __IO pNext;   /* Frame submitted, NULL: none                         */
+  uint32_t            NextSize;
+  uint32_t            ResetLeft;
+  /* Statistics */
+  uint32_t            Frames;         /* Frames encoded                                      */
+  uint32_t            Overruns;       /* Half rings rewritten by the DMA while encoded       */
+  uint32_t            Errors;         /* DMA errors                                          */
+} PWM_StreamTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+#define PWM_STREAM_MODE_CALLBACK     0U   /* PWM_Stream_FillCallback() writes the compare values */
+#define PWM_STREAM_MODE_SINE3        1U   /* Three-phase sine on channels 1 to 3              */
+#define PWM_STREAM_MODE_BITSTREAM    2U   /* One bit per period and per channel, WS2812 style */
+
+/* Streams running at the same time, one per timer. Override in main.h. */
+#if !defined(PWM_STREAM_MAX)
+#define PWM_STREAM_MAX               4U
+#endif
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef PWM_Stream_Init(PWM_StreamTypeDef *pStream, const PWM_Stream_ConfigTypeDef *pConfig);
+HAL_StatusTypeDef PWM_Stream_Start(PWM_StreamTypeDef *pStream);
+HAL_StatusTypeDef PWM_Stream_Stop(PWM_StreamTypeDef *pStream);
+HAL_StatusTypeDef PWM_Stream_SetSine(PWM_StreamTypeDef *pStream, uint32_t Frequency, uint32_t Amplitude);
+HAL_StatusTypeDef PWM_Stream_SubmitFrame(PWM_StreamTypeDef *pStream, const uint8_t *pData, uint32_t Size);
+
+void PWM_Stream_FillCallback(PWM_StreamTypeDef *pStream, uint32_t *pDst, uint32_t Periods);
+void PWM_Stream_FrameCallback(PWM_StreamTypeDef *pStream, const uint8_t *pData);
+void PWM_Stream_ErrorCallback(PWM_StreamTypeDef *pStream);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _PWM_STREAM_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
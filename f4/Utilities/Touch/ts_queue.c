@@ -0,0 +1,813 @@
+/**
+  ******************************************************************************
+  * @file    ts_queue.c
+  * @author  MCD Application Team
+  * @brief   Interrupt driven touchscreen sampling: the controller interrupt
+  *          starts an I2C read in interrupt mode, the positions are filtered
+  *          and queued as timestamped touch and gesture events.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- configure the controller and its interrupt line with BSP_TS_Init() and
+   BSP_TS_ITConfig(), or with the component driver Init, Start and EnableIT
+   functions.
+
+2- initialize the I2C of the controller with HAL_I2C_Init() and call
+   HAL_I2C_EV_IRQHandler() and HAL_I2C_ER_IRQHandler() from its interrupt
+   handlers, at the preemption priority of the controller EXTI: this module
+   implements HAL_I2C_MemRxCpltCallback(), HAL_I2C_MemTxCpltCallback() and
+   HAL_I2C_ErrorCallback() in their place. The BSP uses its own handle of
+   this bus: BSP_TS_GetState() and the other BSP functions of the bus (IO
+   expander on STM32F429I-Discovery) must not be called while sampling.
+
+3- fill a TS_Queue_ConfigTypeDef and call TS_Queue_Init(), then call
+   TS_Queue_IRQHandler() from HAL_GPIO_EXTI_Callback() for TS_INT_PIN.
+   Examples:
+   (+) FT6x06 reporting pixels: raw ranges of the panel size, swapped with
+       TS_QUEUE_SWAP_XY when the panel is mounted rotated.
+   (+) STM32F429I-Discovery, STMPE811 reporting 12-bit values: Address
+       TS_I2C_ADDRESS, Width 240, Height 320, raw values from the panel
+       calibration. A decreasing range inverts the axis, e.g. RawXMin 3800
+       and RawXMax 280.
+
+4- each interrupt reads the touch report in one transaction (FT5336,
+   FT6x06), or the touch status then up to TS_QUEUE_STMPE811_SAMPLES FIFO
+   samples, averaged, then acknowledges the interrupt (STMPE811). Nothing
+   is read while nobody touches the screen. An interrupt occurring during a
+   transaction starts another one at its end.
+
+5- the render loop calls TS_Queue_GetEvent() until it returns 0. Contacts
+   produce DOWN, MOVE (TS_QUEUE_MOVE_THRESHOLD pixels or more) and UP
+   events. When the last contact is released, a gesture made with a single
+   contact is reported after UP: TAP, DOUBLE_TAP, or SWIPE in the dominant
+   direction. LONG_PRESS is reported while the contact is held still, and
+   ZOOM_IN or ZOOM_OUT when the distance between two contacts changes by
+   TS_QUEUE_ZOOM_DISTANCE pixels. Events are lost when the queue is full,
+   see TS_Queue_GetStats().
+
+Gestures are detected from the reports: the controller interrupts at its
+report rate while touched, so held contacts are sampled continuously.
+*******************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include "ts_queue.h"
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  uint32_t  Active;
+  int32_t   FiltX;        /* Filtered position, 1/16 pixel */
+  int32_t   FiltY;
+  uint16_t  LastX;        /* Position of the last event    */
+  uint16_t  LastY;
+  uint16_t  StartX;       /* Position at DOWN              */
+  uint16_t  StartY;
+  uint32_t  DownTick;
+  uint32_t  Moved;        /* Left the tap distance         */
+  uint32_t  LongPress;    /* LONG_PRESS reported           */
+} TS_Queue_ContactTypeDef;
+
+/* Private define ------------------------------------------------------------*/
+#define TS_QUEUE_MAX_CONTACTS       5U
+
+#define TS_QUEUE_STATE_IDLE         0U
+#define TS_QUEUE_STATE_FT_REPORT    1U   /* FT5336/FT6x06 report read         */
+#define TS_QUEUE_STATE_STMPE_STATUS 2U   /* STMPE811 TSC_CTRL to FIFO_SIZE    */
+#define TS_QUEUE_STATE_STMPE_DATA   3U   /* STMPE811 FIFO samples             */
+#define TS_QUEUE_STATE_STMPE_ACK    4U   /* STMPE811 INT_STA cleared          */
+
+/* FT5336 and FT6x06 share the report layout: TD_STATUS then 6 bytes per point */
+#define FT_REG_TD_STATUS            0x02U
+#define FT_POINT_SIZE               6U
+#define FT_EVENT_LIFT_UP            1U
+
+#define STMPE811_REG_INT_STA        0x0BU
+#define STMPE811_REG_TSC_CTRL       0x40U
+#define STMPE811_REG_DATA_NON_INC   0xD7U
+#define STMPE811_STATUS_SIZE        13U  /* TSC_CTRL (0x40) to FIFO_SIZE (0x4C) */
+#define STMPE811_TSC_TOUCH_DET      0x80U
+
+#define TS_QUEUE_RX_SIZE            ((4U * TS_QUEUE_STMPE811_SAMPLES) > (1U + (TS_QUEUE_MAX_CONTACTS * FT_POINT_SIZE)) ? \
+                                     (4U * TS_QUEUE_STMPE811_SAMPLES) : (1U + (TS_QUEUE_MAX_CONTACTS * FT_POINT_SIZE)))
+
+/* Private macro -------------------------------------------------------------*/
+#define TS_QUEUE_ABS(__X__)         (((__X__) < 0) ? -(__X__) : (__X__))
+
+/* Private variables ---------------------------------------------------------*/
+static TS_Queue_ConfigTypeDef   TsConfig;
+static TS_Queue_ContactTypeDef  TsContacts[TS_QUEUE_MAX_CONTACTS];
+static TS_Queue_EventTypeDef    TsEvents[TS_QUEUE_SIZE];
+static __IO uint32_t            TsHead;        /* Written by the interrupts  */
+static __IO uint32_t            TsTail;        /* Written by the reader      */
+static TS_Queue_StatsTypeDef    TsStats;
+
+static __IO uint32_t            TsState = TS_QUEUE_STATE_IDLE;
+static __IO uint32_t            TsPending;     /* Interrupt during a read    */
+static uint32_t                 TsEnabled;
+static uint32_t                 TsSampleTick;
+static uint32_t                 TsSamples;     /* STMPE811 samples read      */
+static uint32_t                 TsRemaining;   /* STMPE811 samples left      */
+static uint32_t                 TsTouched;     /* STMPE811 TOUCH_DET         */
+static uint8_t                  TsRx[TS_QUEUE_RX_SIZE];
+static uint8_t                  TsAck = 0xFFU;
+
+static uint32_t                 TsMulti;       /* Two contacts in the gesture */
+static uint32_t                 TsZoomDistance;
+static uint32_t                 TsTapTick;
+static uint16_t                 TsTapX;
+static uint16_t                 TsTapY;
+static uint32_t                 TsTapValid;
+
+/* Private function prototypes -----------------------------------------------*/
+static void     TS_Queue_Start(void);
+static void     TS_Queue_Finish(void);
+static void     TS_Queue_ParseFT(void);
+static void     TS_Queue_ParseSTMPE811(void);
+static void     TS_Queue_Map(uint32_t RawX, uint32_t RawY, int32_t *pX, int32_t *pY);
+static void     TS_Queue_Update(uint32_t Seen, const int32_t *pX, const int32_t *pY);
+static void     TS_Queue_Release(uint32_t Contact);
+static void     TS_Queue_Zoom(void);
+static void     TS_Queue_Push(uint32_t Type, uint32_t Contact, int32_t X, int32_t Y, int32_t DeltaX, int32_t DeltaY,
+                              uint32_t Duration);
+static uint32_t TS_Queue_Sqrt(uint32_t Value);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Start the interrupt driven sampling
+  * @param  pConfig: Controller, bus and screen mapping, copied
+  * @retval HAL_OK, or HAL_ERROR on a wrong configuration
+  */
+HAL_StatusTypeDef TS_Queue_Init(const TS_Queue_ConfigTypeDef *pConfig)
+{
+  uint32_t i;
+
+  if((pConfig == NULL) || (pConfig->hi2c == NULL) || (pConfig->Controller > TS_QUEUE_STMPE811) ||
+     (pConfig->Width == 0U) || (pConfig->Height == 0U) ||
+     (pConfig->RawXMin == pConfig->RawXMax) || (pConfig->RawYMin == pConfig->RawYMax) ||
+     ((TS_QUEUE_SIZE & (TS_QUEUE_SIZE - 1U)) != 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  TsEnabled = 0U;
+  TsConfig  = *pConfig;
+  for(i = 0U; i < TS_QUEUE_MAX_CONTACTS; i++)
+  {
+    TsContacts[i].Active = 0U;
+  }
+  TsHead     = 0U;
+  TsTail     = 0U;
+  TsPending  = 0U;
+  TsMulti    = 0U;
+  TsTapValid = 0U;
+  TsStats.Samples  = 0U;
+  TsStats.Events   = 0U;
+  TsStats.Overruns = 0U;
+  TsStats.Errors   = 0U;
+  TsEnabled = 1U;
+
+  /* Read the current state, the controller may already be interrupting */
+  TS_Queue_IRQHandler();
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the sampling, queued events are kept
+  * @retval HAL_OK, or HAL_BUSY while a transaction is in progress: retry
+  */
+HAL_StatusTypeDef TS_Queue_DeInit(void)
+{
+  TsEnabled = 0U;
+  TsPending = 0U;
+
+  return (TsState == TS_QUEUE_STATE_IDLE) ? HAL_OK : HAL_BUSY;
+}
+
+/**
+  * @brief  Get the oldest event
+  * @param  pEvent: Event
+  * @retval 1 if an event was returned, 0 if the queue is empty
+  */
+uint32_t TS_Queue_GetEvent(TS_Queue_EventTypeDef *pEvent)
+{
+  uint32_t tail = TsTail;
+
+  if(tail == TsHead)
+  {
+    return 0U;
+  }
+
+  *pEvent = TsEvents[tail & (TS_QUEUE_SIZE - 1U)];
+  TsTail = tail + 1U;
+
+  return 1U;
+}
+
+/**
+  * @brief  Get the contacts on the screen at the last report
+  * @retval Bit n set when contact n is active
+  */
+uint32_t TS_Queue_GetContacts(void)
+{
+  uint32_t i, contacts = 0U;
+
+  for(i = 0U; i < TS_QUEUE_MAX_CONTACTS; i++)
+  {
+    if(TsContacts[i].Active != 0U)
+    {
+      contacts |= (1UL << i);
+    }
+  }
+
+  return contacts;
+}
+
+/**
+  * @brief  Get the sampling counters
+  * @param  pStats: Counters
+  * @retval None
+  */
+void TS_Queue_GetStats(TS_Queue_StatsTypeDef *pStats)
+{
+  *pStats = TsStats;
+}
+
+/**
+  * @brief  Controller interrupt, call from HAL_GPIO_EXTI_Callback()
+  * @retval None
+  */
+void TS_Queue_IRQHandler(void)
+{
+  if(TsEnabled == 0U)
+  {
+    return;
+  }
+
+  if(TsState != TS_QUEUE_STATE_IDLE)
+  {
+    TsPending = 1U;
+    return;
+  }
+
+  TS_Queue_Start();
+}
+
+/**
+  * @brief  Memory read completed: next step of the transaction
+  * @param  hi2c: I2C handle
+  * @retval None
+  */
+void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+  uint32_t count;
+
+  if(hi2c != TsConfig.hi2c)
+  {
+    return;
+  }
+
+  switch(TsState)
+  {
+  case TS_QUEUE_STATE_FT_REPORT:
+    TsStats.Samples++;
+    TS_Queue_ParseFT();
+    TS_Queue_Finish();
+    break;
+
+  case TS_QUEUE_STATE_STMPE_STATUS:
+    TsTouched = ((TsRx[0] & STMPE811_TSC_TOUCH_DET) != 0U) ? 1U : 0U;
+    count = TsRx[STMPE811_STATUS_SIZE - 1U];
+    TsSamples   = (count > TS_QUEUE_STMPE811_SAMPLES) ? TS_QUEUE_STMPE811_SAMPLES : count;
+    TsRemaining = count - TsSamples;
+    if(TsSamples != 0U)
+    {
+      TsState = TS_QUEUE_STATE_STMPE_DATA;
+      if(HAL_I2C_Mem_Read_IT(TsConfig.hi2c, TsConfig.Address, STMPE811_REG_DATA_NON_INC, I2C_MEMADD_SIZE_8BIT,
+                             TsRx, (uint16_t)(4U * TsSamples)) != HAL_OK)
+      {
+        HAL_I2C_ErrorCallback(hi2c);
+      }
+      break;
+    }
+    /* No sample: only a release is reported */
+    TS_Queue_ParseSTMPE811();
+    TsState = TS_QUEUE_STATE_STMPE_ACK;
+    if(HAL_I2C_Mem_Write_IT(TsConfig.hi2c, TsConfig.Address, STMPE811_REG_INT_STA, I2C_MEMADD_SIZE_8BIT,
+                            &TsAck, 1U) != HAL_OK)
+    {
+      HAL_I2C_ErrorCallback(hi2c);
+    }
+    break;
+
+  case TS_QUEUE_STATE_STMPE_DATA:
+    TsStats.Samples++;
+    TS_Queue_ParseSTMPE811();
+    TsState = TS_QUEUE_STATE_STMPE_ACK;
+    if(HAL_I2C_Mem_Write_IT(TsConfig.hi2c, TsConfig.Address, STMPE811_REG_INT_STA, I2C_MEMADD_SIZE_8BIT,
+                            &TsAck, 1U) != HAL_OK)
+    {
+      HAL_I2C_ErrorCallback(hi2c);
+    }
+    break;
+
+  default:
+    break;
+  }
+}
+
+/**
+  * @brief  Memory write completed: STMPE811 interrupt acknowledged
+  * @param  hi2c: I2C handle
+  * @retval None
+  */
+void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+  if((hi2c != TsConfig.hi2c) || (TsState != TS_QUEUE_STATE_STMPE_ACK))
+  {
+    return;
+  }
+
+  /* Samples left in the FIFO keep the interrupt line active: no new edge */
+  if(TsRemaining != 0U)
+  {
+    TsPending = 1U;
+  }
+  TS_Queue_Finish();
+}
+
+/**
+  * @brief  I2C error: the transaction is dropped, the next interrupt retries
+  * @param  hi2c: I2C handle
+  * @retval None
+  */
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)
+{
+  if((hi2c != TsConfig.hi2c) || (TsState == TS_QUEUE_STATE_IDLE))
+  {
+    return;
+  }
+
+  TsStats.Errors++;
+  TS_Queue_Finish();
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Start a transaction reading the controller
+  * @retval None
+  */
+static void TS_Queue_Start(void)
+{
+  HAL_StatusTypeDef status;
+  uint32_t size;
+
+  TsPending    = 0U;
+  TsSampleTick = HAL_GetTick();
+
+  if(TsConfig.Controller == TS_QUEUE_STMPE811)
+  {
+    TsState = TS_QUEUE_STATE_STMPE_STATUS;
+    status = HAL_I2C_Mem_Read_IT(TsConfig.hi2c, TsConfig.Address, STMPE811_REG_TSC_CTRL, I2C_MEMADD_SIZE_8BIT,
+                                 TsRx, STMPE811_STATUS_SIZE);
+  }
+  else
+  {
+    size = (TsConfig.Controller == TS_QUEUE_FT5336) ? 5U : 2U;
+    TsState = TS_QUEUE_STATE_FT_REPORT;
+    status = HAL_I2C_Mem_Read_IT(TsConfig.hi2c, TsConfig.Address, FT_REG_TD_STATUS, I2C_MEMADD_SIZE_8BIT,
+                                 TsRx, (uint16_t)(1U + (size * FT_POINT_SIZE)));
+  }
+
+  if(status != HAL_OK)
+  {
+    /* Bus busy or in error: retried at the next interrupt */
+    TsStats.Errors++;
+    TsState = TS_QUEUE_STATE_IDLE;
+  }
+}
+
+/**
+  * @brief  End of a transaction, start the next one if an interrupt occurred
+  * @retval None
+  */
+static void TS_Queue_Finish(void)
+{
+  TsState = TS_QUEUE_STATE_IDLE;
+
+  if((TsPending != 0U) && (TsEnabled != 0U))
+  {
+    TS_Queue_Start();
+  }
+}
+
+/**
+  * @brief  Decode a FT5336/FT6x06 report
+  * @retval None
+  */
+static void TS_Queue_ParseFT(void)
+{
+  int32_t x[TS_QUEUE_MAX_CONTACTS], y[TS_QUEUE_MAX_CONTACTS];
+  uint32_t max = (TsConfig.Controller == TS_QUEUE_FT5336) ? 5U : 2U;
+  uint32_t count = TsRx[0] & 0x0FU;
+  uint32_t seen = 0U, i, id;
+  const uint8_t *ppoint;
+
+  /* TD_STATUS reads 0x0F until the first scan */
+  if(count > max)
+  {
+    count = 0U;
+  }
+
+  for(i = 0U; i < count; i++)
+  {
+    ppoint = &TsRx[1U + (i * FT_POINT_SIZE)];
+    id = (uint32_t)ppoint[2] >> 4;
+    if((id < TS_QUEUE_MAX_CONTACTS) && (((uint32_t)ppoint[0] >> 6) != FT_EVENT_LIFT_UP))
+    {
+      TS_Queue_Map((((uint32_t)ppoint[0] & 0x0FU) << 8) | ppoint[1],
+                   (((uint32_t)ppoint[2] & 0x0FU) << 8) | ppoint[3], &x[id], &y[id]);
+      seen |= (1UL << id);
+    }
+  }
+
+  TS_Queue_Update(seen, x, y);
+}
+
+/**
+  * @brief  Decode the STMPE811 status and FIFO samples, averaged
+  * @retval None
+  */
+static void TS_Queue_ParseSTMPE811(void)
+{
+  int32_t x[TS_QUEUE_MAX_CONTACTS], y[TS_QUEUE_MAX_CONTACTS];
+  uint32_t sum_x = 0U, sum_y = 0U, i;
+  const uint8_t *psample;
+
+  if(TsTouched == 0U)
+  {
+    TS_Queue_Update(0U, NULL, NULL);
+    return;
+  }
+  if(TsSamples == 0U)
+  {
+    return;
+  }
+
+  /* X on 12 bits, Y on 12 bits, then Z */
+  for(i = 0U; i < TsSamples; i++)
+  {
+    psample = &TsRx[4U * i];
+    sum_x += ((uint32_t)psample[0] << 4) | ((uint32_t)psample[1] >> 4);
+    sum_y += (((uint32_t)psample[1] & 0x0FU) << 8) | psample[2];
+  }
+  TS_Queue_Map(sum_x / TsSamples, sum_y / TsSamples, &x[0], &y[0]);
+
+  TS_Queue_Update(1U, x, y);
+}
+
+/**
+  * @brief  Convert controller values to a screen position, 1/16 pixel
+  * @param  RawX: Controller X
+  * @param  RawY: Controller Y
+  * @param  pX: Screen X
+  * @param  pY: Screen Y
+  * @retval None
+  */
+static void TS_Queue_Map(uint32_t RawX, uint32_t RawY, int32_t *pX, int32_t *pY)
+{
+  int32_t u = (int32_t)RawX, v = (int32_t)RawY, t;
+
+  if((TsConfig.Orientation & TS_QUEUE_SWAP_XY) != 0U)
+  {
+    t = u;
+    u = v;
+    v = t;
+  }
+
+  u = ((u - (int32_t)TsConfig.RawXMin) * (int32_t)(TsConfig.Width - 1U) * 16) /
+      ((int32_t)TsConfig.RawXMax - (int32_t)TsConfig.RawXMin);
+  v = ((v - (int32_t)TsConfig.RawYMin) * (int32_t)(TsConfig.Height - 1U) * 16) /
+      ((int32_t)TsConfig.RawYMax - (int32_t)TsConfig.RawYMin);
+
+  u = (u < 0) ? 0 : ((u > ((int32_t)(TsConfig.Width - 1U) * 16)) ? ((int32_t)(TsConfig.Width - 1U) * 16) : u);
+  v = (v < 0) ? 0 : ((v > ((int32_t)(TsConfig.Height - 1U) * 16)) ? ((int32_t)(TsConfig.Height - 1U) * 16) : v);
+
+  if((TsConfig.Orientation & TS_QUEUE_INVERT_X) != 0U)
+  {
+    u = ((int32_t)(TsConfig.Width - 1U) * 16) - u;
+  }
+  if((TsConfig.Orientation & TS_QUEUE_INVERT_Y) != 0U)
+  {
+    v = ((int32_t)(TsConfig.Height - 1U) * 16) - v;
+  }
+
+  *pX = u;
+  *pY = v;
+}
+
+/**
+  * @brief  Update the contacts from a report and queue the events
+  * @param  Seen: Bit n set when contact n is in the report
+  * @param  pX: Screen X of the contacts seen, 1/16 pixel, NULL when Seen is 0
+  * @param  pY: Screen Y of the contacts seen, 1/16 pixel, NULL when Seen is 0
+  * @retval None
+  */
+static void TS_Queue_Update(uint32_t Seen, const int32_t *pX, const int32_t *pY)
+{
+  TS_Queue_ContactTypeDef *pcontact;
+  int32_t x, y, dx, dy;
+  uint32_t i, active = 0U;
+
+  for(i = 0U; i < TS_QUEUE_MAX_CONTACTS; i++)
+  {
+    pcontact = &TsContacts[i];
+
+    if((Seen & (1UL << i)) == 0U)
+    {
+      if(pcontact->Active != 0U)
+      {
+        TS_Queue_Release(i);
+      }
+      continue;
+    }
+
+    if(pcontact->Active == 0U)
+    {
+      pcontact->Active    = 1U;
+      pcontact->FiltX     = pX[i];
+      pcontact->FiltY     = pY[i];
+      pcontact->LastX     = (uint16_t)((pX[i] + 8) >> 4);
+      pcontact->LastY     = (uint16_t)((pY[i] + 8) >> 4);
+      pcontact->StartX    = pcontact->LastX;
+      pcontact->StartY    = pcontact->LastY;
+      pcontact->DownTick  = TsSampleTick;
+      pcontact->Moved     = 0U;
+      pcontact->LongPress = 0U;
+      TS_Queue_Push(TS_QUEUE_EVENT_DOWN, i, pcontact->LastX, pcontact->LastY, 0, 0, 0U);
+      active++;
+      continue;
+    }
+    active++;
+
+    pcontact->FiltX += (pX[i] - pcontact->FiltX) / (1L << TS_QUEUE_FILTER_SHIFT);
+    pcontact->FiltY += (pY[i] - pcontact->FiltY) / (1L << TS_QUEUE_FILTER_SHIFT);
+    x = (pcontact->FiltX + 8) >> 4;
+    y = (pcontact->FiltY + 8) >> 4;
+
+    dx = x - (int32_t)pcontact->LastX;
+    dy = y - (int32_t)pcontact->LastY;
+    if((uint32_t)(TS_QUEUE_ABS(dx) + TS_QUEUE_ABS(dy)) >= TS_QUEUE_MOVE_THRESHOLD)
+    {
+      TS_Queue_Push(TS_QUEUE_EVENT_MOVE, i, x, y, dx, dy, 0U);
+      pcontact->LastX = (uint16_t)x;
+      pcontact->LastY = (uint16_t)y;
+    }
+
+    dx = x - (int32_t)pcontact->StartX;
+    dy = y - (int32_t)pcontact->StartY;
+    if((uint32_t)(TS_QUEUE_ABS(dx) + TS_QUEUE_ABS(dy)) > TS_QUEUE_TAP_DISTANCE)
+    {
+      pcontact->Moved = 1U;
+    }
+
+    if((pcontact->Moved == 0U) && (pcontact->LongPress == 0U) && (TsMulti == 0U) &&
+       ((TsSampleTick - pcontact->DownTick) >= TS_QUEUE_LONG_PRESS_TIME))
+    {
+      pcontact->LongPress = 1U;
+      TS_Queue_Push(TS_QUEUE_EVENT_LONG_PRESS, i, pcontact->StartX, pcontact->StartY, 0, 0,
+                    TsSampleTick - pcontact->DownTick);
+    }
+  }
+
+  if(active >= 2U)
+  {
+    if(TsMulti == 0U)
+    {
+      TsMulti = 1U;
+      TsZoomDistance = 0U;
+    }
+    TS_Queue_Zoom();
+  }
+  else if(active == 0U)
+  {
+    TsMulti = 0U;
+  }
+}
+
+/**
+  * @brief  Contact released: UP, then the single contact gestures
+  * @param  Contact: Contact number
+  * @retval None
+  */
+static void TS_Queue_Release(uint32_t Contact)
+{
+  TS_Queue_ContactTypeDef *pcontact = &TsContacts[Contact];
+  uint32_t duration = TsSampleTick - pcontact->DownTick;
+  int32_t dx, dy;
+  uint32_t i, others = 0U, type = 0U;
+
+  pcontact->Active = 0U;
+  TS_Queue_Push(TS_QUEUE_EVENT_UP, Contact, pcontact->LastX, pcontact->LastY, 0, 0, duration);
+
+  for(i = 0U; i < TS_QUEUE_MAX_CONTACTS; i++)
+  {
+    others |= TsContacts[i].Active;
+  }
+  if((others != 0U) || (TsMulti != 0U) || (pcontact->LongPress != 0U))
+  {
+    return;
+  }
+
+  dx = (int32_t)pcontact->LastX - (int32_t)pcontact->StartX;
+  dy = (int32_t)pcontact->LastY - (int32_t)pcontact->StartY;
+
+  if((pcontact->Moved == 0U) && (duration <= TS_QUEUE_TAP_TIME))
+  {
+    type = TS_QUEUE_EVENT_TAP;
+    if((TsTapValid != 0U) && ((pcontact->DownTick - TsTapTick) <= TS_QUEUE_DOUBLE_TAP_TIME) &&
+       ((uint32_t)(TS_QUEUE_ABS((int32_t)TsTapX - (int32_t)pcontact->StartX) +
+                   TS_QUEUE_ABS((int32_t)TsTapY - (int32_t)pcontact->StartY)) <= (2U * TS_QUEUE_TAP_DISTANCE)))
+    {
+      /* A third tap starts a new pair */
+      type = TS_QUEUE_EVENT_DOUBLE_TAP;
+      TsTapValid = 0U;
+    }
+    else
+    {
+      TsTapValid = 1U;
+      TsTapTick  = TsSampleTick;
+      TsTapX     = pcontact->StartX;
+      TsTapY     = pcontact->StartY;
+    }
+  }
+  else if((pcontact->Moved != 0U) && (duration <= TS_QUEUE_SWIPE_TIME))
+  {
+    if((TS_QUEUE_ABS(dx) >= TS_QUEUE_ABS(dy)) && ((uint32_t)TS_QUEUE_ABS(dx) >= TS_QUEUE_SWIPE_DISTANCE))
+    {
+      type = (dx > 0) ? TS_QUEUE_EVENT_SWIPE_RIGHT : TS_QUEUE_EVENT_SWIPE_LEFT;
+    }
+    else if((TS_QUEUE_ABS(dy) > TS_QUEUE_ABS(dx)) && ((uint32_t)TS_QUEUE_ABS(dy) >= TS_QUEUE_SWIPE_DISTANCE))
+    {
+      type = (dy > 0) ? TS_QUEUE_EVENT_SWIPE_DOWN : TS_QUEUE_EVENT_SWIPE_UP;
+    }
+  }
+
+  if(type != 0U)
+  {
+    TS_Queue_Push(type, Contact, pcontact->StartX, pcontact->StartY, dx, dy, duration);
+  }
+}
+
+/**
+  * @brief  Zoom between the first two active contacts
+  * @retval None
+  */
+static void TS_Queue_Zoom(void)
+{
+  const TS_Queue_ContactTypeDef *pfirst = NULL, *psecond = NULL;
+  int32_t dx, dy, change;
+  uint32_t i, distance;
+
+  for(i = 0U; (i < TS_QUEUE_MAX_CONTACTS) && (psecond == NULL); i++)
+  {
+    if(TsContacts[i].Active != 0U)
+    {
+      if(pfirst == NULL)
+      {
+        pfirst = &TsContacts[i];
+      }
+      else
+      {
+        psecond = &TsContacts[i];
+      }
+    }
+  }
+  if(psecond == NULL)
+  {
+    return;
+  }
+
+  dx = (int32_t)pfirst->LastX - (int32_t)psecond->LastX;
+  dy = (int32_t)pfirst->LastY - (int32_t)psecond->LastY;
+  distance = TS_Queue_Sqrt((uint32_t)((dx * dx) + (dy * dy)));
+
+  if(TsZoomDistance == 0U)
+  {
+    TsZoomDistance = (distance != 0U) ? distance : 1U;
+    return;
+  }
+
+  change = (int32_t)distance - (int32_t)TsZoomDistance;
+  if((uint32_t)TS_QUEUE_ABS(change) >= TS_QUEUE_ZOOM_DISTANCE)
+  {
+    TS_Queue_Push((change > 0) ? TS_QUEUE_EVENT_ZOOM_IN : TS_QUEUE_EVENT_ZOOM_OUT, (uint32_t)(pfirst - TsContacts),
+                  ((int32_t)pfirst->LastX + (int32_t)psecond->LastX) / 2,
+                  ((int32_t)pfirst->LastY + (int32_t)psecond->LastY) / 2, change, 0, 0U);
+    TsZoomDistance = distance;
+  }
+}
+
+/**
+  * @brief  Queue an event, dropped when the queue is full
+  * @param  Type: TS_QUEUE_EVENT_xxx
+  * @param  Contact: Contact number
+  * @param  X: Position
+  * @param  Y: Position
+  * @param  DeltaX: Move or distance change
+  * @param  DeltaY: Move
+  * @param  Duration: Time since DOWN in ms
+  * @retval None
+  */
+static void TS_Queue_Push(uint32_t Type, uint32_t Contact, int32_t X, int32_t Y, int32_t DeltaX, int32_t DeltaY,
+                          uint32_t Duration)
+{
+  TS_Queue_EventTypeDef *pevent;
+  uint32_t head = TsHead;
+
+  if((head - TsTail) >= TS_QUEUE_SIZE)
+  {
+    TsStats.Overruns++;
+    return;
+  }
+
+  pevent = &TsEvents[head & (TS_QUEUE_SIZE - 1U)];
+  pevent->Tick     = TsSampleTick;
+  pevent->X        = (uint16_t)X;
+  pevent->Y        = (uint16_t)Y;
+  pevent->DeltaX   = (int16_t)DeltaX;
+  pevent->DeltaY   = (int16_t)DeltaY;
+  pevent->Type     = (uint8_t)Type;
+  pevent->Contact  = (uint8_t)Contact;
+  pevent->Duration = (uint16_t)((Duration > 0xFFFFU) ? 0xFFFFU : Duration);
+
+  /* The event is complete before the reader sees it */
+  __DMB();
+  TsHead = head + 1U;
+  TsStats.Events++;
+}
+
+/**
+  * @brief  Integer square root
+  * @param  Value: Value
+  * @retval Floor of the square root
+  */
+static uint32_t TS_Queue_Sqrt(uint32_t Value)
+{
+  uint32_t root = 0U, bit = 1UL << 30;
+
+  while(bit > Value)
+  {
+    bit >>= 2;
+  }
+  while(bit != 0U)
+  {
+    if(Value >= (root + bit))
+    {
+      Value -= root + bit;
+      root = (root >> 1) + bit;
+    }
+    else
+    {
+      root >>= 1;
+    }
+    bit >>= 2;
+  }
+
+  return root;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,169 @@
+/**
+  ******************************************************************************
+  * @file    ts_queue.h
+  * @author  MCD Application Team
+  * @brief   Header for ts_queue module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _TS_QUEUE_H__
+#define _TS_QUEUE_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#if !defined(HAL_I2C_MODULE_ENABLED)
+#error "ts_queue requires the HAL I2C driver"
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  I2C_HandleTypeDef   *hi2c;         /* Bus of the controller, initialized       */
+  uint16_t            Address;       /* 8-bit address as the HAL, TS_I2C_ADDRESS */
+  uint16_t            Controller;    /* TS_QUEUE_FT5336, FT6X06 or STMPE811      */
+  uint16_t            Width;         /* Screen size in pixels                    */
+  uint16_t            Height;
+  uint16_t            RawXMin;       /* Controller values at the screen edges,   */
+  uint16_t            RawXMax;       /* along the screen axes (after the swap)   */
+  uint16_t            RawYMin;
+  uint16_t            RawYMax;
+  uint32_t            Orientation;   /* TS_QUEUE_SWAP_XY | INVERT_X | INVERT_Y   */
+} TS_Queue_ConfigTypeDef;
+
+typedef struct
+{
+  uint32_t  Tick;        /* HAL_GetTick() at the controller interrupt              */
+  uint16_t  X;           /* Filtered position in pixels, midpoint for zooms        */
+  uint16_t  Y;
+  int16_t   DeltaX;      /* MOVE: since the previous event of the contact,         */
+  int16_t   DeltaY;      /* SWIPE: since DOWN, ZOOM: distance change in DeltaX     */
+  uint8_t   Type;        /* TS_QUEUE_EVENT_xxx                                     */
+  uint8_t   Contact;     /* Contact number given by the controller                 */
+  uint16_t  Duration;    /* UP, TAP, SWIPE: ms since DOWN, saturated               */
+} TS_Queue_EventTypeDef;
+
+typedef struct
+{
+  uint32_t  Samples;     /* Controller reports read                                */
+  uint32_t  Events;      /* Events queued                                          */
+  uint32_t  Overruns;    /* Events lost, queue full                                */
+  uint32_t  Errors;      /* I2C transactions failed                                */
+} TS_Queue_StatsTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+#define TS_QUEUE_FT5336               0U
+#define TS_QUEUE_FT6X06               1U
+#define TS_QUEUE_STMPE811             2U
+
+#define TS_QUEUE_SWAP_XY              0x01U   /* Controller X is the screen Y    */
+#define TS_QUEUE_INVERT_X             0x02U   /* Screen X from right to left     */
+#define TS_QUEUE_INVERT_Y             0x04U
+
+#define TS_QUEUE_EVENT_DOWN           1U
+#define TS_QUEUE_EVENT_MOVE           2U
+#define TS_QUEUE_EVENT_UP             3U
+#define TS_QUEUE_EVENT_TAP            4U
+#define TS_QUEUE_EVENT_DOUBLE_TAP     5U
+#define TS_QUEUE_EVENT_LONG_PRESS     6U
+#define TS_QUEUE_EVENT_SWIPE_LEFT     7U
+#define TS_QUEUE_EVENT_SWIPE_RIGHT    8U
+#define TS_QUEUE_EVENT_SWIPE_UP       9U
+#define TS_QUEUE_EVENT_SWIPE_DOWN     10U
+#define TS_QUEUE_EVENT_ZOOM_IN        11U
+#define TS_QUEUE_EVENT_ZOOM_OUT       12U
+
+/* Events kept until read, power of 2. Override in main.h. */
+#if !defined(TS_QUEUE_SIZE)
+#define TS_QUEUE_SIZE                 32U
+#endif
+
+/* Position filter: each report moves the position by 1/2^SHIFT of the
+   difference, 0 disables it. Override in main.h. */
+#if !defined(TS_QUEUE_FILTER_SHIFT)
+#define TS_QUEUE_FILTER_SHIFT         1U
+#endif
+
+/* Smallest move in pixels reported by a MOVE event. Override in main.h. */
+#if !defined(TS_QUEUE_MOVE_THRESHOLD)
+#define TS_QUEUE_MOVE_THRESHOLD       3U
+#endif
+
+/* Gestures, distances in pixels and times in ms. Override in main.h. */
+#if !defined(TS_QUEUE_TAP_DISTANCE)
+#define TS_QUEUE_TAP_DISTANCE         10U
+#endif
+#if !defined(TS_QUEUE_TAP_TIME)
+#define TS_QUEUE_TAP_TIME             300U
+#endif
+#if !defined(TS_QUEUE_DOUBLE_TAP_TIME)
+#define TS_QUEUE_DOUBLE_TAP_TIME      400U
+#endif
+#if !defined(TS_QUEUE_LONG_PRESS_TIME)
+#define TS_QUEUE_LONG_PRESS_TIME      800U
+#endif
+#if !defined(TS_QUEUE_SWIPE_DISTANCE)
+#define TS_QUEUE_SWIPE_DISTANCE       60U
+#endif
+#if !defined(TS_QUEUE_SWIPE_TIME)
+#define TS_QUEUE_SWIPE_TIME           500U
+#endif
+#if !defined(TS_QUEUE_ZOOM_DISTANCE)
+#define TS_QUEUE_ZOOM_DISTANCE        20U
+#endif
+
+/* STMPE811 FIFO samples averaged per interrupt. Override in main.h. */
+#if !defined(TS_QUEUE_STMPE811_SAMPLES)
+#define TS_QUEUE_STMPE811_SAMPLES     4U
+#endif
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef TS_Queue_Init(const TS_Queue_ConfigTypeDef *pConfig);
+HAL_StatusTypeDef TS_Queue_DeInit(void);
+uint32_t          TS_Queue_GetEvent(TS_Queue_EventTypeDef *pEvent);
+uint32_t          TS_Queue_GetContacts(void);
+void              TS_Queue_GetStats(TS_Queue_StatsTypeDef *pStats);
+
+void TS_Queue_IRQHandler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _TS_QUEUE_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -66,6 +66,12 @@
 #if !defined (VERIFY_WRITTENDATA)  
 /*#define VERIFY_WRITTENDATA*/
 #endif /* VERIFY_WRITTENDATA */
+
+/* Register writes gathered before being sent to the codec in one batch */
+#define WM8994_BATCH_SIZE             32
+
+/* Registers held in the shadow cache */
+#define WM8994_SHADOW_COUNT           (sizeof(ShadowReg) / sizeof(ShadowReg[0]))
 /**
   * @}
   */ 
@@ -73,7 +79,7 @@
 /** @defgroup WM8994_Private_Macros
   * @{
   */
-
+#define COUNTOF(__SEQ__)              (sizeof(__SEQ__) / sizeof((__SEQ__)[0]))
 /**
   * @}
   */ 
@@ -106,6 +112,273 @@ static uint32_t outputEnabled = 0;
 static uint32_t inputEnabled = 0;
 static uint8_t ColdStartup = 1;
 
+/* wm8994 Errata Work-Arounds */
+static const AUDIO_IO_RegTypeDef ErrataSeq[] =
+{
+  {0x102, 0x0003},
+  {0x817, 0x0000},
+  {0x102, 0x0000},
+  /* Enable VMID soft start (fast), Start-up Bias Current Enabled */
+  {0x39,  0x006C},
+};
+
+/* Enable DAC1 (Left), Enable DAC1 (Right), Disable DAC2 (Left), Disable DAC2 (Right),
+   AIF1 Timeslot 0 to DAC 1 mixer paths, AIF1 Timeslot 1 to DAC 2 mixer paths */
+static const AUDIO_IO_RegTypeDef OutputSpeakerSeq[] =
+{
+  {0x05,  0x0C0C},
+  {0x601, 0x0000},
+  {0x602, 0x0000},
+  {0x604, 0x0002},
+  {0x605, 0x0002},
+};
+
+/* Disable DAC1 (Left), Disable DAC1 (Right), Enable DAC2 (Left), Enable DAC2 (Right),
+   AIF1 Timeslot 0 to DAC 1 mixer paths, AIF1 Timeslot 1 to DAC 2 mixer paths disabled */
+static const AUDIO_IO_RegTypeDef OutputHeadphoneSeq[] =
+{
+  {0x05,  0x0303},
+  {0x601, 0x0001},
+  {0x602, 0x0001},
+  {0x604, 0x0000},
+  {0x605, 0x0000},
+};
+
+/* Enable DAC1 (Left), Enable DAC1 (Right), also Enable DAC2 (Left), Enable DAC2 (Right),
+   AIF1 Timeslot 0 to DAC 1 mixer paths, AIF1 Timeslot 1 to DAC 2 mixer paths */
+static const AUDIO_IO_RegTypeDef OutputBothSeq[] =
+{
+  {0x05,  0x0303 | 0x0C0C},
+  {0x601, 0x0001},
+  {0x602, 0x0001},
+  {0x604, 0x0002},
+  {0x605, 0x0002},
+};
+
+/* Enable DAC1 (Left), Enable DAC1 (Right), also Enable DAC2 (Left), Enable DAC2 (Right),
+   AIF1 Timeslots 0 and 1 to DAC 1 and DAC 2 mixer paths */
+static const AUDIO_IO_RegTypeDef OutputBothMicSeq[] =
+{
+  {0x05,  0x0303 | 0x0C0C},
+  {0x601, 0x0003},
+  {0x602, 0x0003},
+  {0x604, 0x0003},
+  {0x605, 0x0003},
+};
+
+static const AUDIO_IO_RegTypeDef InputDigitalMic2Seq[] =
+{
+  /* Enable AIF1ADC2 (Left), Enable AIF1ADC2 (Right)
+   * Enable DMICDAT2 (Left), Enable DMICDAT2 (Right)
+   * Enable Left ADC, Enable Right ADC */
+  {0x04,  0x0C30},
+  /* Enable AIF1 DRC2 Signal Detect & DRC in AIF1ADC2 Left/Right Timeslot 1 */
+  {0x450, 0x00DB},
+  /* Disable IN1L, IN1R, IN2L, IN2R, Enable Thermal sensor & shutdown */
+  {0x02,  0x6000},
+  /* Enable the DMIC2(Left) to AIF1 Timeslot 1 (Left) mixer path */
+  {0x608, 0x0002},
+  /* Enable the DMIC2(Right) to AIF1 Timeslot 1 (Right) mixer path */
+  {0x609, 0x0002},
+  /* GPIO1 pin configuration GP1_DIR = output, GP1_FN = AIF1 DRC2 signal detect */
+  {0x700, 0x000E},
+};
+
+static const AUDIO_IO_RegTypeDef InputLine1Seq[] =
+{
+  /* IN1LN_TO_IN1L, IN1LP_TO_VMID, IN1RN_TO_IN1R, IN1RP_TO_VMID */
+  {0x28,  0x0011},
+  /* Disable mute on IN1L_TO_MIXINL and +30dB on IN1L PGA output */
+  {0x29,  0x0035},
+  /* Disable mute on IN1R_TO_MIXINL, Gain = +30dB */
+  {0x2A,  0x0035},
+  /* Enable AIF1ADC1 (Left), Enable AIF1ADC1 (Right)
+   * Enable Left ADC, Enable Right ADC */
+  {0x04,  0x0303},
+  /* Enable AIF1 DRC1 Signal Detect & DRC in AIF1ADC1 Left/Right Timeslot 0 */
+  {0x440, 0x00DB},
+  /* Enable IN1L and IN1R, Disable IN2L and IN2R, Enable Thermal sensor & shutdown */
+  {0x02,  0x6350},
+  /* Enable the ADCL(Left) to AIF1 Timeslot 0 (Left) mixer path */
+  {0x606, 0x0002},
+  /* Enable the ADCR(Right) to AIF1 Timeslot 0 (Right) mixer path */
+  {0x607, 0x0002},
+  /* GPIO1 pin configuration GP1_DIR = output, GP1_FN = AIF1 DRC1 signal detect */
+  {0x700, 0x000D},
+};
+
+static const AUDIO_IO_RegTypeDef InputDigitalMic1Seq[] =
+{
+  /* Enable AIF1ADC1 (Left), Enable AIF1ADC1 (Right)
+   * Enable DMICDAT1 (Left), Enable DMICDAT1 (Right)
+   * Enable Left ADC, Enable Right ADC */
+  {0x04,  0x030C},
+  /* Enable AIF1 DRC2 Signal Detect & DRC in AIF1ADC1 Left/Right Timeslot 0 */
+  {0x440, 0x00DB},
+  /* Disable IN1L, IN1R, IN2L, IN2R, Enable Thermal sensor & shutdown */
+  {0x02,  0x6350},
+  /* Enable the DMIC2(Left) to AIF1 Timeslot 0 (Left) mixer path */
+  {0x606, 0x0002},
+  /* Enable the DMIC2(Right) to AIF1 Timeslot 0 (Right) mixer path */
+  {0x607, 0x0002},
+  /* GPIO1 pin configuration GP1_DIR = output, GP1_FN = AIF1 DRC1 signal detect */
+  {0x700, 0x000D},
+};
+
+static const AUDIO_IO_RegTypeDef InputDigitalMic12Seq[] =
+{
+  /* Enable AIF1ADC1 (Left), Enable AIF1ADC1 (Right)
+   * Enable DMICDAT1 (Left), Enable DMICDAT1 (Right)
+   * Enable Left ADC, Enable Right ADC */
+  {0x04,  0x0F3C},
+  /* Enable AIF1 DRC2 Signal Detect & DRC in AIF1ADC2 Left/Right Timeslot 1 */
+  {0x450, 0x00DB},
+  /* Enable AIF1 DRC2 Signal Detect & DRC in AIF1ADC1 Left/Right Timeslot 0 */
+  {0x440, 0x00DB},
+  /* Disable IN1L, IN1R, Enable IN2L, IN2R, Thermal sensor & shutdown */
+  {0x02,  0x63A0},
+  /* Enable the DMIC2(Left) to AIF1 Timeslot 0 (Left) mixer path */
+  {0x606, 0x0002},
+  /* Enable the DMIC2(Right) to AIF1 Timeslot 0 (Right) mixer path */
+  {0x607, 0x0002},
+  /* Enable the DMIC2(Left) to AIF1 Timeslot 1 (Left) mixer path */
+  {0x608, 0x0002},
+  /* Enable the DMIC2(Right) to AIF1 Timeslot 1 (Right) mixer path */
+  {0x609, 0x0002},
+  /* GPIO1 pin configuration GP1_DIR = output, GP1_FN = AIF1 DRC1 signal detect */
+  {0x700, 0x000D},
+};
+
+static const AUDIO_IO_RegTypeDef ClockSeq[] =
+{
+  /* slave mode */
+  {0x302, 0x0000},
+  /* Enable the DSP processing clock for AIF1, Enable the core clock */
+  {0x208, 0x000A},
+  /* Enable AIF1 Clock, AIF1 Clock Source = MCLK1 pin */
+  {0x200, 0x0001},
+};
+
+/* Analog Output Configuration */
+static const AUDIO_IO_RegTypeDef AnalogOutputSeq[] =
+{
+  /* Enable SPKRVOL PGA, Enable SPKMIXR, Enable SPKLVOL PGA, Enable SPKMIXL */
+  {0x03,  0x0300},
+  /* Left Speaker Mixer Volume = 0dB */
+  {0x22,  0x0000},
+  /* Speaker output mode = Class D, Right Speaker Mixer Volume = 0dB ((0x23, 0x0100) = class AB)*/
+  {0x23,  0x0000},
+  /* Unmute DAC2 (Left) to Left Speaker Mixer (SPKMIXL) path,
+  Unmute DAC2 (Right) to Right Speaker Mixer (SPKMIXR) path */
+  {0x36,  0x0300},
+  /* Enable bias generator, Enable VMID, Enable SPKOUTL, Enable SPKOUTR */
+  {0x01,  0x3003},
+};
+
+/* Headphone output stages start-up, with the delays required by the datasheet */
+static const AUDIO_IO_RegTypeDef HeadphoneStartupSeq[] =
+{
+  /* Enable HPOUT1 (Left) and HPOUT1 (Right) intermediate stages */
+  {0x60,  0x0022},
+  /* Enable Charge Pump */
+  {0x4C,  0x9F25},
+  {AUDIO_IO_DELAY, 15},
+  /* Select DAC1 (Left) to Left Headphone Output PGA (HPOUT1LVOL) path */
+  {0x2D,  0x0001},
+  /* Select DAC1 (Right) to Right Headphone Output PGA (HPOUT1RVOL) path */
+  {0x2E,  0x0001},
+  /* Enable Left Output Mixer (MIXOUTL), Enable Right Output Mixer (MIXOUTR) */
+  /* idem for SPKOUTL and SPKOUTR */
+  {0x03,  0x0030 | 0x0300},
+  /* Enable DC Servo and trigger start-up mode on left and right channels */
+  {0x54,  0x0033},
+  {AUDIO_IO_DELAY, 257},
+  /* Enable HPOUT1 (Left) and HPOUT1 (Right) intermediate and output stages. Remove clamps */
+  {0x60,  0x00EE},
+  /* Unmute DAC 1 (Left) */
+  {0x610, 0x00C0},
+  /* Unmute DAC 1 (Right) */
+  {0x611, 0x00C0},
+  /* Unmute the AIF1 Timeslot 0 DAC path */
+  {0x420, 0x0010},
+  /* Unmute DAC 2 (Left) */
+  {0x612, 0x00C0},
+  /* Unmute DAC 2 (Right) */
+  {0x613, 0x00C0},
+  /* Unmute the AIF1 Timeslot 1 DAC2 path */
+  {0x422, 0x0010},
+};
+
+/* Soft Mute the AIF1 Timeslot 0 DAC1 and Timeslot 1 DAC2 paths L&R */
+static const AUDIO_IO_RegTypeDef MuteSeq[] =
+{
+  {0x420, 0x0200},
+  {0x422, 0x0200},
+};
+
+/* Unmute the AIF1 Timeslot 0 DAC1 and Timeslot 1 DAC2 paths L&R */
+static const AUDIO_IO_RegTypeDef UnmuteSeq[] =
+{
+  {0x420, 0x0010},
+  {0x422, 0x0010},
+};
+
+static const AUDIO_IO_RegTypeDef PowerDownSeq[] =
+{
+  /* Mute the AIF1 Timeslot 0 DAC1 path */
+  {0x420, 0x0200},
+  /* Mute the AIF1 Timeslot 1 DAC2 path */
+  {0x422, 0x0200},
+  /* Disable DAC1L_TO_HPOUT1L */
+  {0x2D,  0x0000},
+  /* Disable DAC1R_TO_HPOUT1R */
+  {0x2E,  0x0000},
+  /* Disable DAC1 and DAC2 */
+  {0x05,  0x0000},
+  /* Reset Codec by writing in 0x0000 address register */
+  {0x0000, 0x0000},
+};
+
+/* AIF1 Sample Rate register values, ratio=256 */
+static const AUDIO_IO_RegTypeDef SampleRateSeq[] =
+{
+  {0x210, 0x0003},  /* 8 (KHz) */
+  {0x210, 0x0013},  /* 11.025 (KHz) */
+  {0x210, 0x0033},  /* 16 (KHz) */
+  {0x210, 0x0043},  /* 22.050 (KHz) */
+  {0x210, 0x0063},  /* 32 (KHz) */
+  {0x210, 0x0073},  /* 44.1 (KHz) */
+  {0x210, 0x0083},  /* 48 (KHz) */
+  {0x210, 0x00A3},  /* 96 (KHz) */
+};
+static const uint32_t SampleRateFreq[] =
+{
+  AUDIO_FREQUENCY_8K, AUDIO_FREQUENCY_11K, AUDIO_FREQUENCY_16K, AUDIO_FREQUENCY_22K,
+  AUDIO_FREQUENCY_32K, AUDIO_FREQUENCY_44K, AUDIO_FREQUENCY_48K, AUDIO_FREQUENCY_96K
+};
+
+/* Registers the shadow cache holds, sorted by address. The software reset (0x0000),
+   the errata test registers and the self-clearing write sequencer (0x110) and DC servo
+   (0x54) triggers are left out: they are always written. */
+static const uint16_t ShadowReg[] =
+{
+  0x001, 0x002, 0x003, 0x004, 0x005, 0x018, 0x01A, 0x01C, 0x01D, 0x022, 0x023, 0x026, 0x027,
+  0x028, 0x029, 0x02A, 0x02D, 0x02E, 0x036, 0x039, 0x04C, 0x051, 0x060, 0x200, 0x208, 0x210,
+  0x300, 0x302, 0x400, 0x401, 0x404, 0x405, 0x410, 0x411, 0x420, 0x422, 0x440, 0x450, 0x601,
+  0x602, 0x604, 0x605, 0x606, 0x607, 0x608, 0x609, 0x610, 0x611, 0x612, 0x613, 0x620, 0x700
+};
+
+/* Last value written to each of the ShadowReg registers, valid when its bit is set */
+static uint16_t ShadowValue[WM8994_SHADOW_COUNT];
+static uint32_t ShadowValid[(WM8994_SHADOW_COUNT + 31) / 32];
+
+/* Register writes not sent yet. Two buffers are used in turn, so that one can be
+   filled while AUDIO_IO_WriteBatch() still sends the other one */
+static AUDIO_IO_RegTypeDef Batch[2][WM8994_BATCH_SIZE];
+static uint16_t BatchCount = 0;
+static uint8_t  BatchIndex = 0;
+static uint8_t  BatchAddr = 0;
+
 /**
   * @}
   */ 
@@ -113,7 +386,11 @@ static uint8_t ColdStartup = 1;
 /** @defgroup WM8994_Function_Prototypes
   * @{
   */
-static uint8_t CODEC_IO_Write(uint8_t Addr, uint16_t Reg, uint16_t Value);
+static uint8_t  CODEC_IO_Write(uint8_t Addr, uint16_t Reg, uint16_t Value);
+static uint32_t CODEC_IO_WriteSeq(uint8_t Addr, const AUDIO_IO_RegTypeDef *pSeq, uint32_t Count);
+static uint32_t CODEC_IO_Delay(uint32_t Delay);
+static uint32_t CODEC_IO_Flush(void);
+static void     CODEC_IO_ShadowReset(void);
 /**
   * @}
   */ 
@@ -143,13 +420,12 @@ uint32_t wm8994_Init(uint16_t DeviceAddr, uint16_t OutputInputDevice, uint8_t Vo
   
   /* Initialize the Control interface of the Audio Codec */
   AUDIO_IO_Init();
-  /* wm8994 Errata Work-Arounds */
-  counter += CODEC_IO_Write(DeviceAddr, 0x102, 0x0003);
-  counter += CODEC_IO_Write(DeviceAddr, 0x817, 0x0000);
-  counter += CODEC_IO_Write(DeviceAddr, 0x102, 0x0000);
 
-  /* Enable VMID soft start (fast), Start-up Bias Current Enabled */
-  counter += CODEC_IO_Write(DeviceAddr, 0x39, 0x006C);
+  /* The codec registers content is unknown: write them all */
+  CODEC_IO_ShadowReset();
+
+  /* wm8994 Errata Work-Arounds, VMID soft start */
+  counter += CODEC_IO_WriteSeq(DeviceAddr, ErrataSeq, COUNTOF(ErrataSeq));
 
     /* Enable bias generator, Enable VMID */
   if (input_device > 0)
@@ -162,7 +438,7 @@ uint32_t wm8994_Init(uint16_t DeviceAddr, uint16_t OutputInputDevice, uint8_t Vo
   }
 
   /* Add Delay */
-  AUDIO_IO_Delay(50);
+  counter += CODEC_IO_Delay(50);
 
   /* Path Configurations for output */
   if (output_device > 0)
@@ -172,101 +448,27 @@ uint32_t wm8994_Init(uint16_t DeviceAddr, uint16_t OutputInputDevice, uint8_t Vo
     switch (output_device)
     {
     case OUTPUT_DEVICE_SPEAKER:
-      /* Enable DAC1 (Left), Enable DAC1 (Right),
-      Disable DAC2 (Left), Disable DAC2 (Right)*/
-      counter += CODEC_IO_Write(DeviceAddr, 0x05, 0x0C0C);
-
-      /* Enable the AIF1 Timeslot 0 (Left) to DAC 1 (Left) mixer path */
-      counter += CODEC_IO_Write(DeviceAddr, 0x601, 0x0000);
-
-      /* Enable the AIF1 Timeslot 0 (Right) to DAC 1 (Right) mixer path */
-      counter += CODEC_IO_Write(DeviceAddr, 0x602, 0x0000);
-
-      /* Disable the AIF1 Timeslot 1 (Left) to DAC 2 (Left) mixer path */
-      counter += CODEC_IO_Write(DeviceAddr, 0x604, 0x0002);
-
-      /* Disable the AIF1 Timeslot 1 (Right) to DAC 2 (Right) mixer path */
-      counter += CODEC_IO_Write(DeviceAddr, 0x605, 0x0002);
+      counter += CODEC_IO_WriteSeq(DeviceAddr, OutputSpeakerSeq, COUNTOF(OutputSpeakerSeq));
       break;
 
     case OUTPUT_DEVICE_HEADPHONE:
-      /* Disable DAC1 (Left), Disable DAC1 (Right),
-      Enable DAC2 (Left), Enable DAC2 (Right)*/
-      counter += CODEC_IO_Write(DeviceAddr, 0x05, 0x0303);
-
-      /* Enable the AIF1 Timeslot 0 (Left) to DAC 1 (Left) mixer path */
-      counter += CODEC_IO_Write(DeviceAddr, 0x601, 0x0001);
-
-      /* Enable the AIF1 Timeslot 0 (Right) to DAC 1 (Right) mixer path */
-      counter += CODEC_IO_Write(DeviceAddr, 0x602, 0x0001);
-
-      /* Disable the AIF1 Timeslot 1 (Left) to DAC 2 (Left) mixer path */
-      counter += CODEC_IO_Write(DeviceAddr, 0x604, 0x0000);
-
-      /* Disable the AIF1 Timeslot 1 (Right) to DAC 2 (Right) mixer path */
-      counter += CODEC_IO_Write(DeviceAddr, 0x605, 0x0000);
+      counter += CODEC_IO_WriteSeq(DeviceAddr, OutputHeadphoneSeq, COUNTOF(OutputHeadphoneSeq));
       break;
 
     case OUTPUT_DEVICE_BOTH:
       if (input_device == INPUT_DEVICE_DIGITAL_MIC1_MIC2)
       {
-        /* Enable DAC1 (Left), Enable DAC1 (Right),
-        also Enable DAC2 (Left), Enable DAC2 (Right)*/
-        counter += CODEC_IO_Write(DeviceAddr, 0x05, 0x0303 | 0x0C0C);
-        
-        /* Enable the AIF1 Timeslot 0 (Left) to DAC 1 (Left) mixer path
-        Enable the AIF1 Timeslot 1 (Left) to DAC 1 (Left) mixer path */
-        counter += CODEC_IO_Write(DeviceAddr, 0x601, 0x0003);
-        
-        /* Enable the AIF1 Timeslot 0 (Right) to DAC 1 (Right) mixer path
-        Enable the AIF1 Timeslot 1 (Right) to DAC 1 (Right) mixer path */
-        counter += CODEC_IO_Write(DeviceAddr, 0x602, 0x0003);
-        
-        /* Enable the AIF1 Timeslot 0 (Left) to DAC 2 (Left) mixer path
-        Enable the AIF1 Timeslot 1 (Left) to DAC 2 (Left) mixer path  */
-        counter += CODEC_IO_Write(DeviceAddr, 0x604, 0x0003);
-        
-        /* Enable the AIF1 Timeslot 0 (Right) to DAC 2 (Right) mixer path
-        Enable the AIF1 Timeslot 1 (Right) to DAC 2 (Right) mixer path */
-        counter += CODEC_IO_Write(DeviceAddr, 0x605, 0x0003);
+        counter += CODEC_IO_WriteSeq(DeviceAddr, OutputBothMicSeq, COUNTOF(OutputBothMicSeq));
       }
       else
       {
-        /* Enable DAC1 (Left), Enable DAC1 (Right),
-        also Enable DAC2 (Left), Enable DAC2 (Right)*/
-        counter += CODEC_IO_Write(DeviceAddr, 0x05, 0x0303 | 0x0C0C);
-        
-        /* Enable the AIF1 Timeslot 0 (Left) to DAC 1 (Left) mixer path */
-        counter += CODEC_IO_Write(DeviceAddr, 0x601, 0x0001);
-        
-        /* Enable the AIF1 Timeslot 0 (Right) to DAC 1 (Right) mixer path */
-        counter += CODEC_IO_Write(DeviceAddr, 0x602, 0x0001);
-        
-        /* Enable the AIF1 Timeslot 1 (Left) to DAC 2 (Left) mixer path */
-        counter += CODEC_IO_Write(DeviceAddr, 0x604, 0x0002);
-        
-        /* Enable the AIF1 Timeslot 1 (Right) to DAC 2 (Right) mixer path */
-        counter += CODEC_IO_Write(DeviceAddr, 0x605, 0x0002);      
+        counter += CODEC_IO_WriteSeq(DeviceAddr, OutputBothSeq, COUNTOF(OutputBothSeq));
       }
       break;
 
     case OUTPUT_DEVICE_AUTO :
     default:
-      /* Disable DAC1 (Left), Disable DAC1 (Right),
-      Enable DAC2 (Left), Enable DAC2 (Right)*/
-      counter += CODEC_IO_Write(DeviceAddr, 0x05, 0x0303);
-
-      /* Enable the AIF1 Timeslot 0 (Left) to DAC 1 (Left) mixer path */
-      counter += CODEC_IO_Write(DeviceAddr, 0x601, 0x0001);
-
-      /* Enable the AIF1 Timeslot 0 (Right) to DAC 1 (Right) mixer path */
-      counter += CODEC_IO_Write(DeviceAddr, 0x602, 0x0001);
-
-      /* Disable the AIF1 Timeslot 1 (Left) to DAC 2 (Left) mixer path */
-      counter += CODEC_IO_Write(DeviceAddr, 0x604, 0x0000);
-
-      /* Disable the AIF1 Timeslot 1 (Right) to DAC 2 (Right) mixer path */
-      counter += CODEC_IO_Write(DeviceAddr, 0x605, 0x0000);
+      counter += CODEC_IO_WriteSeq(DeviceAddr, OutputHeadphoneSeq, COUNTOF(OutputHeadphoneSeq));
       break;
     }
   }
@@ -282,107 +484,18 @@ uint32_t wm8994_Init(uint16_t DeviceAddr, uint16_t OutputInputDevice, uint8_t Vo
     switch (input_device)
     {
     case INPUT_DEVICE_DIGITAL_MICROPHONE_2 :
-      /* Enable AIF1ADC2 (Left), Enable AIF1ADC2 (Right)
-       * Enable DMICDAT2 (Left), Enable DMICDAT2 (Right)
-       * Enable Left ADC, Enable Right ADC */
-      counter += CODEC_IO_Write(DeviceAddr, 0x04, 0x0C30);
-
-      /* Enable AIF1 DRC2 Signal Detect & DRC in AIF1ADC2 Left/Right Timeslot 1 */
-      counter += CODEC_IO_Write(DeviceAddr, 0x450, 0x00DB);
-
-      /* Disable IN1L, IN1R, IN2L, IN2R, Enable Thermal sensor & shutdown */
-      counter += CODEC_IO_Write(DeviceAddr, 0x02, 0x6000);
-
-      /* Enable the DMIC2(Left) to AIF1 Timeslot 1 (Left) mixer path */
-      counter += CODEC_IO_Write(DeviceAddr, 0x608, 0x0002);
-
-      /* Enable the DMIC2(Right) to AIF1 Timeslot 1 (Right) mixer path */
-      counter += CODEC_IO_Write(DeviceAddr, 0x609, 0x0002);
-
-      /* GPIO1 pin configuration GP1_DIR = output, GP1_FN = AIF1 DRC2 signal detect */
-      counter += CODEC_IO_Write(DeviceAddr, 0x700, 0x000E);
+      counter += CODEC_IO_WriteSeq(DeviceAddr, InputDigitalMic2Seq, COUNTOF(InputDigitalMic2Seq));
       break;
 
     case INPUT_DEVICE_INPUT_LINE_1 :
-      /* IN1LN_TO_IN1L, IN1LP_TO_VMID, IN1RN_TO_IN1R, IN1RP_TO_VMID */
-      counter += CODEC_IO_Write(DeviceAddr, 0x28, 0x0011);
-
-      /* Disable mute on IN1L_TO_MIXINL and +30dB on IN1L PGA output */
-      counter += CODEC_IO_Write(DeviceAddr, 0x29, 0x0035);
-
-      /* Disable mute on IN1R_TO_MIXINL, Gain = +30dB */
-      counter += CODEC_IO_Write(DeviceAddr, 0x2A, 0x0035);
-
-      /* Enable AIF1ADC1 (Left), Enable AIF1ADC1 (Right)
-       * Enable Left ADC, Enable Right ADC */
-      counter += CODEC_IO_Write(DeviceAddr, 0x04, 0x0303);
-
-      /* Enable AIF1 DRC1 Signal Detect & DRC in AIF1ADC1 Left/Right Timeslot 0 */
-      counter += CODEC_IO_Write(DeviceAddr, 0x440, 0x00DB);
-
-      /* Enable IN1L and IN1R, Disable IN2L and IN2R, Enable Thermal sensor & shutdown */
-      counter += CODEC_IO_Write(DeviceAddr, 0x02, 0x6350);
-
-      /* Enable the ADCL(Left) to AIF1 Timeslot 0 (Left) mixer path */
-      counter += CODEC_IO_Write(DeviceAddr, 0x606, 0x0002);
-
-      /* Enable the ADCR(Right) to AIF1 Timeslot 0 (Right) mixer path */
-      counter += CODEC_IO_Write(DeviceAddr, 0x607, 0x0002);
-
-      /* GPIO1 pin configuration GP1_DIR = output, GP1_FN = AIF1 DRC1 signal detect */
-      counter += CODEC_IO_Write(DeviceAddr, 0x700, 0x000D);
+      counter += CODEC_IO_WriteSeq(DeviceAddr, InputLine1Seq, COUNTOF(InputLine1Seq));
       break;
 
     case INPUT_DEVICE_DIGITAL_MICROPHONE_1 :
-      /* Enable AIF1ADC1 (Left), Enable AIF1ADC1 (Right)
-       * Enable DMICDAT1 (Left), Enable DMICDAT1 (Right)
-       * Enable Left ADC, Enable Right ADC */
-      counter += CODEC_IO_Write(DeviceAddr, 0x04, 0x030C);
-
-      /* Enable AIF1 DRC2 Signal Detect & DRC in AIF1ADC1 Left/Right Timeslot 0 */
-      counter += CODEC_IO_Write(DeviceAddr, 0x440, 0x00DB);
-
-      /* Disable IN1L, IN1R, IN2L, IN2R, Enable Thermal sensor & shutdown */
-      counter += CODEC_IO_Write(DeviceAddr, 0x02, 0x6350);
-
-      /* Enable the DMIC2(Left) to AIF1 Timeslot 0 (Left) mixer path */
-      counter += CODEC_IO_Write(DeviceAddr, 0x606, 0x0002);
-
-      /* Enable the DMIC2(Right) to AIF1 Timeslot 0 (Right) mixer path */
-      counter += CODEC_IO_Write(DeviceAddr, 0x607, 0x0002);
-
-      /* GPIO1 pin configuration GP1_DIR = output, GP1_FN = AIF1 DRC1 signal detect */
-      counter += CODEC_IO_Write(DeviceAddr, 0x700, 0x000D);
+      counter += CODEC_IO_WriteSeq(DeviceAddr, InputDigitalMic1Seq, COUNTOF(InputDigitalMic1Seq));
       break; 
     case INPUT_DEVICE_DIGITAL_MIC1_MIC2 :
-      /* Enable AIF1ADC1 (Left), Enable AIF1ADC1 (Right)
-       * Enable DMICDAT1 (Left), Enable DMICDAT1 (Right)
-       * Enable Left ADC, Enable Right ADC */
-      counter += CODEC_IO_Write(DeviceAddr, 0x04, 0x0F3C);
-
-      /* Enable AIF1 DRC2 Signal Detect & DRC in AIF1ADC2 Left/Right Timeslot 1 */
-      counter += CODEC_IO_Write(DeviceAddr, 0x450, 0x00DB);
-      
-      /* Enable AIF1 DRC2 Signal Detect & DRC in AIF1ADC1 Left/Right Timeslot 0 */
-      counter += CODEC_IO_Write(DeviceAddr, 0x440, 0x00DB);
-
-      /* Disable IN1L, IN1R, Enable IN2L, IN2R, Thermal sensor & shutdown */
-      counter += CODEC_IO_Write(DeviceAddr, 0x02, 0x63A0);
-
-      /* Enable the DMIC2(Left) to AIF1 Timeslot 0 (Left) mixer path */
-      counter += CODEC_IO_Write(DeviceAddr, 0x606, 0x0002);
-
-      /* Enable the DMIC2(Right) to AIF1 Timeslot 0 (Right) mixer path */
-      counter += CODEC_IO_Write(DeviceAddr, 0x607, 0x0002);
-
-      /* Enable the DMIC2(Left) to AIF1 Timeslot 1 (Left) mixer path */
-      counter += CODEC_IO_Write(DeviceAddr, 0x608, 0x0002);
-
-      /* Enable the DMIC2(Right) to AIF1 Timeslot 1 (Right) mixer path */
-      counter += CODEC_IO_Write(DeviceAddr, 0x609, 0x0002);
-      
-      /* GPIO1 pin configuration GP1_DIR = output, GP1_FN = AIF1 DRC1 signal detect */
-      counter += CODEC_IO_Write(DeviceAddr, 0x700, 0x000D);
+      counter += CODEC_IO_WriteSeq(DeviceAddr, InputDigitalMic12Seq, COUNTOF(InputDigitalMic12Seq));
       break;    
     case INPUT_DEVICE_INPUT_LINE_2 :
     default:
@@ -397,53 +510,7 @@ uint32_t wm8994_Init(uint16_t DeviceAddr, uint16_t OutputInputDevice, uint8_t Vo
   }
   
   /*  Clock Configurations */
-  switch (AudioFreq)
-  {
-  case  AUDIO_FREQUENCY_8K:
-    /* AIF1 Sample Rate = 8 (KHz), ratio=256 */ 
-    counter += CODEC_IO_Write(DeviceAddr, 0x210, 0x0003);
-    break;
-    
-  case  AUDIO_FREQUENCY_16K:
-    /* AIF1 Sample Rate = 16 (KHz), ratio=256 */ 
-    counter += CODEC_IO_Write(DeviceAddr, 0x210, 0x0033);
-    break;
-
-  case  AUDIO_FREQUENCY_32K:
-    /* AIF1 Sample Rate = 32 (KHz), ratio=256 */ 
-    counter += CODEC_IO_Write(DeviceAddr, 0x210, 0x0063);
-    break;
-    
-  case  AUDIO_FREQUENCY_48K:
-    /* AIF1 Sample Rate = 48 (KHz), ratio=256 */ 
-    counter += CODEC_IO_Write(DeviceAddr, 0x210, 0x0083);
-    break;
-    
-  case  AUDIO_FREQUENCY_96K:
-    /* AIF1 Sample Rate = 96 (KHz), ratio=256 */ 
-    counter += CODEC_IO_Write(DeviceAddr, 0x210, 0x00A3);
-    break;
-    
-  case  AUDIO_FREQUENCY_11K:
-    /* AIF1 Sample Rate = 11.025 (KHz), ratio=256 */ 
-    counter += CODEC_IO_Write(DeviceAddr, 0x210, 0x0013);
-    break;
-    
-  case  AUDIO_FREQUENCY_22K:
-    /* AIF1 Sample Rate = 22.050 (KHz), ratio=256 */ 
-    counter += CODEC_IO_Write(DeviceAddr, 0x210, 0x0043);
-    break;
-    
-  case  AUDIO_FREQUENCY_44K:
-    /* AIF1 Sample Rate = 44.1 (KHz), ratio=256 */ 
-    counter += CODEC_IO_Write(DeviceAddr, 0x210, 0x0073);
-    break; 
-    
-  default:
-    /* AIF1 Sample Rate = 48 (KHz), ratio=256 */ 
-    counter += CODEC_IO_Write(DeviceAddr, 0x210, 0x0083);
-    break; 
-  }
+  counter += wm8994_SetFrequency(DeviceAddr, AudioFreq);
 
   if(input_device == INPUT_DEVICE_DIGITAL_MIC1_MIC2)
   {
@@ -456,14 +523,8 @@ uint32_t wm8994_Init(uint16_t DeviceAddr, uint16_t OutputInputDevice, uint8_t Vo
   counter += CODEC_IO_Write(DeviceAddr, 0x300, 0x4010);
   }
   
-  /* slave mode */
-  counter += CODEC_IO_Write(DeviceAddr, 0x302, 0x0000);
-  
-  /* Enable the DSP processing clock for AIF1, Enable the core clock */
-  counter += CODEC_IO_Write(DeviceAddr, 0x208, 0x000A);
-  
-  /* Enable AIF1 Clock, AIF1 Clock Source = MCLK1 pin */
-  counter += CODEC_IO_Write(DeviceAddr, 0x200, 0x0001);
+  /* Slave mode, AIF1 and core clocks */
+  counter += CODEC_IO_WriteSeq(DeviceAddr, ClockSeq, COUNTOF(ClockSeq));
 
   if (output_device > 0)  /* Audio output selected */
   {
@@ -482,35 +543,19 @@ uint32_t wm8994_Init(uint16_t DeviceAddr, uint16_t OutputInputDevice, uint8_t Vo
         
         ColdStartup=0;
         /* Add Delay */
-        AUDIO_IO_Delay(300);
+        counter += CODEC_IO_Delay(300);
       }
       else /* Headphone Warm Start-Up */
       { 
         counter += CODEC_IO_Write(DeviceAddr,0x110,0x8108);
         /* Add Delay */
-        AUDIO_IO_Delay(50);
+        counter += CODEC_IO_Delay(50);
       }
 
       /* Soft un-Mute the AIF1 Timeslot 0 DAC1 path L&R */
       counter += CODEC_IO_Write(DeviceAddr, 0x420, 0x0000);
     }
-    /* Analog Output Configuration */
-
-    /* Enable SPKRVOL PGA, Enable SPKMIXR, Enable SPKLVOL PGA, Enable SPKMIXL */
-    counter += CODEC_IO_Write(DeviceAddr, 0x03, 0x0300);
-
-    /* Left Speaker Mixer Volume = 0dB */
-    counter += CODEC_IO_Write(DeviceAddr, 0x22, 0x0000);
-
-    /* Speaker output mode = Class D, Right Speaker Mixer Volume = 0dB ((0x23, 0x0100) = class AB)*/
-    counter += CODEC_IO_Write(DeviceAddr, 0x23, 0x0000);
-
-    /* Unmute DAC2 (Left) to Left Speaker Mixer (SPKMIXL) path,
-    Unmute DAC2 (Right) to Right Speaker Mixer (SPKMIXR) path */
-    counter += CODEC_IO_Write(DeviceAddr, 0x36, 0x0300);
-
-    /* Enable bias generator, Enable VMID, Enable SPKOUTL, Enable SPKOUTR */
-    counter += CODEC_IO_Write(DeviceAddr, 0x01, 0x3003);
+    counter += CODEC_IO_WriteSeq(DeviceAddr, AnalogOutputSeq, COUNTOF(AnalogOutputSeq));
 
     /* Headphone/Speaker Enable */
 
@@ -530,53 +575,8 @@ uint32_t wm8994_Init(uint16_t DeviceAddr, uint16_t OutputInputDevice, uint8_t Vo
     power_mgnt_reg_1 |= 0x0303 | 0x3003;
     counter += CODEC_IO_Write(DeviceAddr, 0x01, power_mgnt_reg_1);
 
-    /* Enable HPOUT1 (Left) and HPOUT1 (Right) intermediate stages */
-    counter += CODEC_IO_Write(DeviceAddr, 0x60, 0x0022);
-
-    /* Enable Charge Pump */
-    counter += CODEC_IO_Write(DeviceAddr, 0x4C, 0x9F25);
-
-    /* Add Delay */
-    AUDIO_IO_Delay(15);
-
-    /* Select DAC1 (Left) to Left Headphone Output PGA (HPOUT1LVOL) path */
-    counter += CODEC_IO_Write(DeviceAddr, 0x2D, 0x0001);
-
-    /* Select DAC1 (Right) to Right Headphone Output PGA (HPOUT1RVOL) path */
-    counter += CODEC_IO_Write(DeviceAddr, 0x2E, 0x0001);
-
-    /* Enable Left Output Mixer (MIXOUTL), Enable Right Output Mixer (MIXOUTR) */
-    /* idem for SPKOUTL and SPKOUTR */
-    counter += CODEC_IO_Write(DeviceAddr, 0x03, 0x0030 | 0x0300);
-
-    /* Enable DC Servo and trigger start-up mode on left and right channels */
-    counter += CODEC_IO_Write(DeviceAddr, 0x54, 0x0033);
-
-    /* Add Delay */
-    AUDIO_IO_Delay(257);
-
-    /* Enable HPOUT1 (Left) and HPOUT1 (Right) intermediate and output stages. Remove clamps */
-    counter += CODEC_IO_Write(DeviceAddr, 0x60, 0x00EE);
-
-    /* Unmutes */
-
-    /* Unmute DAC 1 (Left) */
-    counter += CODEC_IO_Write(DeviceAddr, 0x610, 0x00C0);
-
-    /* Unmute DAC 1 (Right) */
-    counter += CODEC_IO_Write(DeviceAddr, 0x611, 0x00C0);
-
-    /* Unmute the AIF1 Timeslot 0 DAC path */
-    counter += CODEC_IO_Write(DeviceAddr, 0x420, 0x0010);
-
-    /* Unmute DAC 2 (Left) */
-    counter += CODEC_IO_Write(DeviceAddr, 0x612, 0x00C0);
-
-    /* Unmute DAC 2 (Right) */
-    counter += CODEC_IO_Write(DeviceAddr, 0x613, 0x00C0);
-
-    /* Unmute the AIF1 Timeslot 1 DAC2 path */
-    counter += CODEC_IO_Write(DeviceAddr, 0x422, 0x0010);
+    /* Charge pump, DC servo and output stages start-up, then unmutes */
+    counter += CODEC_IO_WriteSeq(DeviceAddr, HeadphoneStartupSeq, COUNTOF(HeadphoneStartupSeq));
     
     /* Volume Control */
     wm8994_SetVolume(DeviceAddr, Volume);
@@ -626,6 +626,10 @@ uint32_t wm8994_Init(uint16_t DeviceAddr, uint16_t OutputInputDevice, uint8_t Vo
     /* Volume Control */
     wm8994_SetVolume(DeviceAddr, Volume);
   }
+
+  /* Send the writes left */
+  counter += CODEC_IO_Flush();
+
   /* Return communication control value */
   return counter;  
 }
@@ -687,6 +691,8 @@ uint32_t wm8994_Pause(uint16_t DeviceAddr)
   /* Put the Codec in Power save mode */
   counter += CODEC_IO_Write(DeviceAddr, 0x02, 0x01);
  
+  counter += CODEC_IO_Flush();
+
   return counter;
 }
 
@@ -734,23 +740,9 @@ uint32_t wm8994_Stop(uint16_t DeviceAddr, uint32_t CodecPdwnMode)
     }
     else /* CODEC_PDWN_HW */
     {
-      /* Mute the AIF1 Timeslot 0 DAC1 path */
-      counter += CODEC_IO_Write(DeviceAddr, 0x420, 0x0200);
-
-      /* Mute the AIF1 Timeslot 1 DAC2 path */
-      counter += CODEC_IO_Write(DeviceAddr, 0x422, 0x0200);
-
-      /* Disable DAC1L_TO_HPOUT1L */
-      counter += CODEC_IO_Write(DeviceAddr, 0x2D, 0x0000);
-
-      /* Disable DAC1R_TO_HPOUT1R */
-      counter += CODEC_IO_Write(DeviceAddr, 0x2E, 0x0000);
-
-      /* Disable DAC1 and DAC2 */
-      counter += CODEC_IO_Write(DeviceAddr, 0x05, 0x0000);
-
-      /* Reset Codec by writing in 0x0000 address register */
-      counter += CODEC_IO_Write(DeviceAddr, 0x0000, 0x0000);
+      /* Mute the DAC paths, disable the DACs and reset the codec */
+      counter += CODEC_IO_WriteSeq(DeviceAddr, PowerDownSeq, COUNTOF(PowerDownSeq));
+      counter += CODEC_IO_Flush();
 
       outputEnabled = 0;
     }
@@ -831,6 +823,9 @@ uint32_t wm8994_SetVolume(uint16_t DeviceAddr, uint8_t Volume)
     /* Right AIF1 ADC2 volume */
     counter += CODEC_IO_Write(DeviceAddr, 0x405, convertedvol | 0x100);
   }
+
+  counter += CODEC_IO_Flush();
+
   return counter;
 }
 
@@ -850,20 +845,15 @@ uint32_t wm8994_SetMute(uint16_t DeviceAddr, uint32_t Cmd)
     /* Set the Mute mode */
     if(Cmd == AUDIO_MUTE_ON)
     {
-      /* Soft Mute the AIF1 Timeslot 0 DAC1 path L&R */
-      counter += CODEC_IO_Write(DeviceAddr, 0x420, 0x0200);
-
-      /* Soft Mute the AIF1 Timeslot 1 DAC2 path L&R */
-      counter += CODEC_IO_Write(DeviceAddr, 0x422, 0x0200);
+      /* Soft Mute the AIF1 Timeslot 0 DAC1 and Timeslot 1 DAC2 paths L&R */
+      counter += CODEC_IO_WriteSeq(DeviceAddr, MuteSeq, COUNTOF(MuteSeq));
     }
     else /* AUDIO_MUTE_OFF Disable the Mute */
     {
-      /* Unmute the AIF1 Timeslot 0 DAC1 path L&R */
-      counter += CODEC_IO_Write(DeviceAddr, 0x420, 0x0010);
-
-      /* Unmute the AIF1 Timeslot 1 DAC2 path L&R */
-      counter += CODEC_IO_Write(DeviceAddr, 0x422, 0x0010);
+      /* Unmute the AIF1 Timeslot 0 DAC1 and Timeslot 1 DAC2 paths L&R */
+      counter += CODEC_IO_WriteSeq(DeviceAddr, UnmuteSeq, COUNTOF(UnmuteSeq));
     }
+    counter += CODEC_IO_Flush();
   }
   return counter;
 }
@@ -871,6 +861,7 @@ uint32_t wm8994_SetMute(uint16_t DeviceAddr, uint32_t Cmd)
 /**
   * @brief Switch dynamically (while audio file is played) the output target 
   *         (speaker or headphone).
+  * @note  Only the registers that differ from the current output path are written.
   * @param DeviceAddr: Device address on communication Bus.
   * @param Output: specifies the audio output target: OUTPUT_DEVICE_SPEAKER,
   *         OUTPUT_DEVICE_HEADPHONE, OUTPUT_DEVICE_BOTH or OUTPUT_DEVICE_AUTO 
@@ -883,77 +874,24 @@ uint32_t wm8994_SetOutputMode(uint16_t DeviceAddr, uint8_t Output)
   switch (Output) 
   {
   case OUTPUT_DEVICE_SPEAKER:
-    /* Enable DAC1 (Left), Enable DAC1 (Right), 
-    Disable DAC2 (Left), Disable DAC2 (Right)*/
-    counter += CODEC_IO_Write(DeviceAddr, 0x05, 0x0C0C);
-    
-    /* Enable the AIF1 Timeslot 0 (Left) to DAC 1 (Left) mixer path */
-    counter += CODEC_IO_Write(DeviceAddr, 0x601, 0x0000);
-    
-    /* Enable the AIF1 Timeslot 0 (Right) to DAC 1 (Right) mixer path */
-    counter += CODEC_IO_Write(DeviceAddr, 0x602, 0x0000);
-    
-    /* Disable the AIF1 Timeslot 1 (Left) to DAC 2 (Left) mixer path */
-    counter += CODEC_IO_Write(DeviceAddr, 0x604, 0x0002);
-    
-    /* Disable the AIF1 Timeslot 1 (Right) to DAC 2 (Right) mixer path */
-    counter += CODEC_IO_Write(DeviceAddr, 0x605, 0x0002);
+    counter += CODEC_IO_WriteSeq(DeviceAddr, OutputSpeakerSeq, COUNTOF(OutputSpeakerSeq));
     break;
     
   case OUTPUT_DEVICE_HEADPHONE:
-    /* Disable DAC1 (Left), Disable DAC1 (Right), 
-    Enable DAC2 (Left), Enable DAC2 (Right)*/
-    counter += CODEC_IO_Write(DeviceAddr, 0x05, 0x0303);
-    
-    /* Enable the AIF1 Timeslot 0 (Left) to DAC 1 (Left) mixer path */
-    counter += CODEC_IO_Write(DeviceAddr, 0x601, 0x0001);
-    
-    /* Enable the AIF1 Timeslot 0 (Right) to DAC 1 (Right) mixer path */
-    counter += CODEC_IO_Write(DeviceAddr, 0x602, 0x0001);
-    
-    /* Disable the AIF1 Timeslot 1 (Left) to DAC 2 (Left) mixer path */
-    counter += CODEC_IO_Write(DeviceAddr, 0x604, 0x0000);
-    
-    /* Disable the AIF1 Timeslot 1 (Right) to DAC 2 (Right) mixer path */
-    counter += CODEC_IO_Write(DeviceAddr, 0x605, 0x0000);
+    counter += CODEC_IO_WriteSeq(DeviceAddr, OutputHeadphoneSeq, COUNTOF(OutputHeadphoneSeq));
     break;
     
   case OUTPUT_DEVICE_BOTH:
-    /* Enable DAC1 (Left), Enable DAC1 (Right), 
-    also Enable DAC2 (Left), Enable DAC2 (Right)*/
-    counter += CODEC_IO_Write(DeviceAddr, 0x05, 0x0303 | 0x0C0C);
-    
-    /* Enable the AIF1 Timeslot 0 (Left) to DAC 1 (Left) mixer path */
-    counter += CODEC_IO_Write(DeviceAddr, 0x601, 0x0001);
-    
-    /* Enable the AIF1 Timeslot 0 (Right) to DAC 1 (Right) mixer path */
-    counter += CODEC_IO_Write(DeviceAddr, 0x602, 0x0001);
-    
-    /* Enable the AIF1 Timeslot 1 (Left) to DAC 2 (Left) mixer path */
-    counter += CODEC_IO_Write(DeviceAddr, 0x604, 0x0002);
-    
-    /* Enable the AIF1 Timeslot 1 (Right) to DAC 2 (Right) mixer path */
-    counter += CODEC_IO_Write(DeviceAddr, 0x605, 0x0002);
+    counter += CODEC_IO_WriteSeq(DeviceAddr, OutputBothSeq, COUNTOF(OutputBothSeq));
     break;
     
   default:
-    /* Disable DAC1 (Left), Disable DAC1 (Right), 
-    Enable DAC2 (Left), Enable DAC2 (Right)*/
-    counter += CODEC_IO_Write(DeviceAddr, 0x05, 0x0303);
-    
-    /* Enable the AIF1 Timeslot 0 (Left) to DAC 1 (Left) mixer path */
-    counter += CODEC_IO_Write(DeviceAddr, 0x601, 0x0001);
-    
-    /* Enable the AIF1 Timeslot 0 (Right) to DAC 1 (Right) mixer path */
-    counter += CODEC_IO_Write(DeviceAddr, 0x602, 0x0001);
-    
-    /* Disable the AIF1 Timeslot 1 (Left) to DAC 2 (Left) mixer path */
-    counter += CODEC_IO_Write(DeviceAddr, 0x604, 0x0000);
-    
-    /* Disable the AIF1 Timeslot 1 (Right) to DAC 2 (Right) mixer path */
-    counter += CODEC_IO_Write(DeviceAddr, 0x605, 0x0000);
+    counter += CODEC_IO_WriteSeq(DeviceAddr, OutputHeadphoneSeq, COUNTOF(OutputHeadphoneSeq));
     break;    
   }  
+
+  counter += CODEC_IO_Flush();
+
   return counter;
 }
 
@@ -966,55 +904,21 @@ uint32_t wm8994_SetOutputMode(uint16_t DeviceAddr, uint8_t Output)
 uint32_t wm8994_SetFrequency(uint16_t DeviceAddr, uint32_t AudioFreq)
 {
   uint32_t counter = 0;
+  uint32_t index = 0;
  
-  /*  Clock Configurations */
-  switch (AudioFreq)
+  /* AIF1 Sample Rate, 48 (KHz) when AudioFreq is not supported */
+  while ((index < COUNTOF(SampleRateFreq)) && (SampleRateFreq[index] != AudioFreq))
   {
-  case  AUDIO_FREQUENCY_8K:
-    /* AIF1 Sample Rate = 8 (KHz), ratio=256 */ 
-    counter += CODEC_IO_Write(DeviceAddr, 0x210, 0x0003);
-    break;
+    index++;
+  }
+  if (index == COUNTOF(SampleRateFreq))
+  {
+    index = 6;
+  }
     
-  case  AUDIO_FREQUENCY_16K:
-    /* AIF1 Sample Rate = 16 (KHz), ratio=256 */ 
-    counter += CODEC_IO_Write(DeviceAddr, 0x210, 0x0033);
-    break;
+  counter += CODEC_IO_WriteSeq(DeviceAddr, &SampleRateSeq[index], 1);
+  counter += CODEC_IO_Flush();
 
-  case  AUDIO_FREQUENCY_32K:
-    /* AIF1 Sample Rate = 32 (KHz), ratio=256 */ 
-    counter += CODEC_IO_Write(DeviceAddr, 0x210, 0x0063);
-    break;
-    
-  case  AUDIO_FREQUENCY_48K:
-    /* AIF1 Sample Rate = 48 (KHz), ratio=256 */ 
-    counter += CODEC_IO_Write(DeviceAddr, 0x210, 0x0083);
-    break;
-    
-  case  AUDIO_FREQUENCY_96K:
-    /* AIF1 Sample Rate = 96 (KHz), ratio=256 */ 
-    counter += CODEC_IO_Write(DeviceAddr, 0x210, 0x00A3);
-    break;
-    
-  case  AUDIO_FREQUENCY_11K:
-    /* AIF1 Sample Rate = 11.025 (KHz), ratio=256 */ 
-    counter += CODEC_IO_Write(DeviceAddr, 0x210, 0x0013);
-    break;
-    
-  case  AUDIO_FREQUENCY_22K:
-    /* AIF1 Sample Rate = 22.050 (KHz), ratio=256 */ 
-    counter += CODEC_IO_Write(DeviceAddr, 0x210, 0x0043);
-    break;
-    
-  case  AUDIO_FREQUENCY_44K:
-    /* AIF1 Sample Rate = 44.1 (KHz), ratio=256 */ 
-    counter += CODEC_IO_Write(DeviceAddr, 0x210, 0x0073);
-    break; 
-    
-  default:
-    /* AIF1 Sample Rate = 48 (KHz), ratio=256 */ 
-    counter += CODEC_IO_Write(DeviceAddr, 0x210, 0x0083);
-    break; 
-  }
   return counter;
 }
 
@@ -1029,6 +933,7 @@ uint32_t wm8994_Reset(uint16_t DeviceAddr)
   
   /* Reset Codec by writing in 0x0000 address register */
   counter = CODEC_IO_Write(DeviceAddr, 0x0000, 0x0000);
+  counter += CODEC_IO_Flush();
   outputEnabled = 0;
   inputEnabled=0;
 
@@ -1036,26 +941,158 @@ uint32_t wm8994_Reset(uint16_t DeviceAddr)
 }
 
 /**
-  * @brief  Writes/Read a single data.
+  * @brief  Queues a register write, unless the shadow cache holds the same value.
+  * @note   The write is sent to the codec by CODEC_IO_Flush().
   * @param  Addr: I2C address
   * @param  Reg: Reg address 
   * @param  Value: Data to be written
-  * @retval None
+  * @retval 0 if correct communication, else wrong communication
   */
 static uint8_t CODEC_IO_Write(uint8_t Addr, uint16_t Reg, uint16_t Value)
 {
   uint32_t result = 0;
+  uint32_t low = 0, high = WM8994_SHADOW_COUNT, mid = 0;
   
- AUDIO_IO_Write(Addr, Reg, Value);
+  /* Look for the register in the shadow cache */
+  while (low < high)
+  {
+    mid = (low + high) / 2;
+    if (ShadowReg[mid] < Reg)
+    {
+      low = mid + 1;
+    }
+    else
+    {
+      high = mid;
+    }
+  }
+
+  if ((low < WM8994_SHADOW_COUNT) && (ShadowReg[low] == Reg))
+  {
+    if (((ShadowValid[low / 32] & (1U << (low % 32))) != 0) && (ShadowValue[low] == Value))
+    {
+      /* The register already holds this value */
+      return 0;
+    }
+    ShadowValue[low] = Value;
+    ShadowValid[low / 32] |= (1U << (low % 32));
+  }
+  else if (Reg == 0x0000)
+  {
+    /* Software reset: the registers get back their default value */
+    CODEC_IO_ShadowReset();
+  }
+
+  if ((BatchCount == WM8994_BATCH_SIZE) || ((BatchCount != 0) && (BatchAddr != Addr)))
+  {
+    result = CODEC_IO_Flush();
+  }
+
+  BatchAddr = Addr;
+  Batch[BatchIndex][BatchCount].Reg = Reg;
+  Batch[BatchIndex][BatchCount].Value = Value;
+  BatchCount++;
+
+  return result;
+}
+
+/**
+  * @brief  Queues a register sequence, the delay entries flush the writes queued
+  *         before them.
+  * @param  Addr: I2C address
+  * @param  pSeq: Register sequence
+  * @param  Count: Number of entries in the sequence
+  * @retval 0 if correct communication, else wrong communication
+  */
+static uint32_t CODEC_IO_WriteSeq(uint8_t Addr, const AUDIO_IO_RegTypeDef *pSeq, uint32_t Count)
+{
+  uint32_t counter = 0;
+  uint32_t index = 0;
+
+  for (index = 0; index < Count; index++)
+  {
+    if (pSeq[index].Reg == AUDIO_IO_DELAY)
+    {
+      counter += CODEC_IO_Delay(pSeq[index].Value);
+    }
+    else
+    {
+      counter += CODEC_IO_Write(Addr, pSeq[index].Reg, pSeq[index].Value);
+    }
+  }
+
+  return counter;
+}
+
+/**
+  * @brief  Sends the queued writes then waits.
+  * @param  Delay: Delay in ms
+  * @retval 0 if correct communication, else wrong communication
+  */
+static uint32_t CODEC_IO_Delay(uint32_t Delay)
+{
+  uint32_t counter = CODEC_IO_Flush();
+
+  AUDIO_IO_Delay(Delay);
+
+  return counter;
+}
+
+/**
+  * @brief  Sends the queued writes to the codec.
+  * @note   With AUDIO_IO_BATCH defined, AUDIO_IO_WriteBatch() sends them
+  *         asynchronously; otherwise they are written one by one.
+  * @retval 0 if correct communication, else wrong communication
+  */
+static uint32_t CODEC_IO_Flush(void)
+{
+  uint32_t result = 0;
+#if !defined(AUDIO_IO_BATCH) || defined(VERIFY_WRITTENDATA)
+  uint32_t index = 0;
+#endif
+  AUDIO_IO_RegTypeDef *pRegs = Batch[BatchIndex];
+
+  if (BatchCount != 0)
+  {
+#if defined(AUDIO_IO_BATCH)
+    AUDIO_IO_WriteBatch(BatchAddr, pRegs, BatchCount);
+#else
+    for (index = 0; index < BatchCount; index++)
+    {
+      AUDIO_IO_Write(BatchAddr, pRegs[index].Reg, pRegs[index].Value);
+    }
+#endif /* AUDIO_IO_BATCH */
   
 #ifdef VERIFY_WRITTENDATA
-  /* Verify that the data has been correctly written */
-  result = (AUDIO_IO_Read(Addr, Reg) == Value)? 0:1;
+    /* Verify that the data has been correctly written */
+    for (index = 0; index < BatchCount; index++)
+    {
+      result += (AUDIO_IO_Read(BatchAddr, pRegs[index].Reg) == pRegs[index].Value)? 0:1;
+    }
 #endif /* VERIFY_WRITTENDATA */
   
+    /* Queue the next writes in the other buffer */
+    BatchIndex ^= 1;
+    BatchCount = 0;
+  }
+
   return result;
 }
 
+/**
+  * @brief  Invalidates the shadow cache: the next write of each register is sent.
+  * @retval None
+  */
+static void CODEC_IO_ShadowReset(void)
+{
+  uint32_t index = 0;
+
+  for (index = 0; index < COUNTOF(ShadowValid); index++)
+  {
+    ShadowValid[index] = 0;
+  }
+}
+
 /**
   * @}
   */
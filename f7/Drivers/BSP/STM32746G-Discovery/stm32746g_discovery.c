@@ -40,10 +40,14 @@
 - stm32f7xx_hal_gpio.c
 - stm32f7xx_hal_uart.c
 - stm32f7xx_hal_i2c.c
+- stm32f7xx_hal_dma.c (AUDIO_IO_BATCH defined)
 EndDependencies */
 
 /* Includes ------------------------------------------------------------------*/
 #include "stm32746g_discovery.h"
+#if defined(AUDIO_IO_BATCH)
+#include "../Components/Common/audio.h"
+#endif /* AUDIO_IO_BATCH */
 
 /** @addtogroup BSP
   * @{
@@ -85,6 +89,15 @@ EndDependencies */
 /** @defgroup STM32746G_DISCOVERY_LOW_LEVEL_Private_Macros STM32746G_DISCOVERY_LOW_LEVEL Private Macros
   * @{
   */
+#if defined(AUDIO_IO_BATCH)
+/* Codec registers sent in one I2C transfer, at consecutive addresses */
+#define AUDIO_IO_BATCH_RUN_MAX        16
+
+/* Codec register writes batch state */
+#define AUDIO_IO_BATCH_IDLE           0
+#define AUDIO_IO_BATCH_BUSY           1
+#define AUDIO_IO_BATCH_ERROR          2
+#endif /* AUDIO_IO_BATCH */
 /**
   * @}
   */
@@ -124,6 +137,21 @@ const uint16_t COM_RX_AF[COMn] = {DISCOVERY_COM1_RX_AF};
 static I2C_HandleTypeDef hI2cAudioHandler = {0};
 static I2C_HandleTypeDef hI2cExtHandler = {0};
 
+#if defined(AUDIO_IO_BATCH)
+static DMA_HandleTypeDef hDmaAudioI2cTx;
+
+/* Codec register writes batch in progress */
+static AUDIO_IO_RegTypeDef *pAudioBatch;
+static uint16_t AudioBatchCount = 0;
+static uint16_t AudioBatchIndex = 0;
+static uint8_t  AudioBatchAddr = 0;
+static __IO uint32_t AudioBatchState = AUDIO_IO_BATCH_IDLE;
+
+/* I2C transfer of the batch: 16-bit register address then the 16-bit values,
+   MSB first, read by the DMA */
+ALIGN_32BYTES(static uint8_t AudioBatchFrame[2 + (2 * AUDIO_IO_BATCH_RUN_MAX)]);
+#endif /* AUDIO_IO_BATCH */
+
 /**
   * @}
   */
@@ -138,6 +166,11 @@ static HAL_StatusTypeDef I2Cx_ReadMultiple(I2C_HandleTypeDef *i2c_handler, uint8
 static HAL_StatusTypeDef I2Cx_WriteMultiple(I2C_HandleTypeDef *i2c_handler, uint8_t Addr, uint16_t Reg, uint16_t MemAddSize, uint8_t *Buffer, uint16_t Length);
 static HAL_StatusTypeDef I2Cx_IsDeviceReady(I2C_HandleTypeDef *i2c_handler, uint16_t DevAddress, uint32_t Trials);
 static void              I2Cx_Error(I2C_HandleTypeDef *i2c_handler, uint8_t Addr);
+#if defined(AUDIO_IO_BATCH)
+static void              I2Cx_BatchNext(void);
+static void              I2Cx_BatchProcess(void);
+static void              I2Cx_BatchWait(I2C_HandleTypeDef *i2c_handler);
+#endif /* AUDIO_IO_BATCH */
 
 /* AUDIO IO functions */
 void            AUDIO_IO_Init(void);
@@ -145,6 +178,9 @@ void            AUDIO_IO_DeInit(void);
 void            AUDIO_IO_Write(uint8_t Addr, uint16_t Reg, uint16_t Value);
 uint16_t        AUDIO_IO_Read(uint8_t Addr, uint16_t Reg);
 void            AUDIO_IO_Delay(uint32_t Delay);
+#if defined(AUDIO_IO_BATCH)
+void            AUDIO_IO_WriteBatch(uint8_t Addr, AUDIO_IO_RegTypeDef *pRegs, uint16_t Count);
+#endif /* AUDIO_IO_BATCH */
 
 /* TOUCHSCREEN IO functions */
 void            TS_IO_Init(void);
@@ -504,6 +540,38 @@ static void I2Cx_MspInit(I2C_HandleTypeDef *i2c_handler)
     /* Enable and set I2Cx Interrupt to a lower priority */
     HAL_NVIC_SetPriority(DISCOVERY_AUDIO_I2Cx_ER_IRQn, 0x0F, 0);
     HAL_NVIC_EnableIRQ(DISCOVERY_AUDIO_I2Cx_ER_IRQn);
+
+#if defined(AUDIO_IO_BATCH)
+    /*** Configure the DMA sending the codec register writes batches ***/
+    DISCOVERY_AUDIO_I2Cx_DMAx_CLK_ENABLE();
+
+    hDmaAudioI2cTx.Instance                 = DISCOVERY_AUDIO_I2Cx_DMAx_TX_STREAM;
+    hDmaAudioI2cTx.Init.Channel             = DISCOVERY_AUDIO_I2Cx_DMAx_TX_CHANNEL;
+    hDmaAudioI2cTx.Init.Direction           = DMA_MEMORY_TO_PERIPH;
+    hDmaAudioI2cTx.Init.PeriphInc           = DMA_PINC_DISABLE;
+    hDmaAudioI2cTx.Init.MemInc              = DMA_MINC_ENABLE;
+    hDmaAudioI2cTx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+    hDmaAudioI2cTx.Init.MemDataAlignment    = DMA_MDATAALIGN_BYTE;
+    hDmaAudioI2cTx.Init.Mode                = DMA_NORMAL;
+    hDmaAudioI2cTx.Init.Priority            = DMA_PRIORITY_LOW;
+    hDmaAudioI2cTx.Init.FIFOMode            = DMA_FIFOMODE_DISABLE;
+    hDmaAudioI2cTx.Init.FIFOThreshold       = DMA_FIFO_THRESHOLD_FULL;
+    hDmaAudioI2cTx.Init.MemBurst            = DMA_MBURST_SINGLE;
+    hDmaAudioI2cTx.Init.PeriphBurst         = DMA_PBURST_SINGLE;
+
+    /* Associate the DMA handle */
+    __HAL_LINKDMA(i2c_handler, hdmatx, hDmaAudioI2cTx);
+
+    /* Deinitialize the Stream for new transfer */
+    HAL_DMA_DeInit(&hDmaAudioI2cTx);
+
+    /* Configure the DMA Stream */
+    HAL_DMA_Init(&hDmaAudioI2cTx);
+
+    /* DMA transfer complete interrupt */
+    HAL_NVIC_SetPriority(DISCOVERY_AUDIO_I2Cx_DMAx_TX_IRQn, 0x0F, 0);
+    HAL_NVIC_EnableIRQ(DISCOVERY_AUDIO_I2Cx_DMAx_TX_IRQn);
+#endif /* AUDIO_IO_BATCH */
   }
   else
   {
@@ -597,6 +665,11 @@ static HAL_StatusTypeDef I2Cx_ReadMultiple(I2C_HandleTypeDef *i2c_handler,
 {
   HAL_StatusTypeDef status = HAL_OK;
 
+#if defined(AUDIO_IO_BATCH)
+  /* The codec register writes batch must be sent first */
+  I2Cx_BatchWait(i2c_handler);
+#endif /* AUDIO_IO_BATCH */
+
   status = HAL_I2C_Mem_Read(i2c_handler, Addr, (uint16_t)Reg, MemAddress, Buffer, Length, 1000);
 
   /* Check the communication status */
@@ -627,6 +700,11 @@ static HAL_StatusTypeDef I2Cx_WriteMultiple(I2C_HandleTypeDef *i2c_handler,
 {
   HAL_StatusTypeDef status = HAL_OK;
   
+#if defined(AUDIO_IO_BATCH)
+  /* The codec register writes batch must be sent first */
+  I2Cx_BatchWait(i2c_handler);
+#endif /* AUDIO_IO_BATCH */
+
   status = HAL_I2C_Mem_Write(i2c_handler, Addr, (uint16_t)Reg, MemAddress, Buffer, Length, 1000);
   
   /* Check the communication status */
@@ -648,6 +726,11 @@ static HAL_StatusTypeDef I2Cx_WriteMultiple(I2C_HandleTypeDef *i2c_handler,
   */
 static HAL_StatusTypeDef I2Cx_IsDeviceReady(I2C_HandleTypeDef *i2c_handler, uint16_t DevAddress, uint32_t Trials)
 { 
+#if defined(AUDIO_IO_BATCH)
+  /* The codec register writes batch must be sent first */
+  I2Cx_BatchWait(i2c_handler);
+#endif /* AUDIO_IO_BATCH */
+
   return (HAL_I2C_IsDeviceReady(i2c_handler, DevAddress, Trials, 1000));
 }
 
@@ -666,6 +749,129 @@ static void I2Cx_Error(I2C_HandleTypeDef *i2c_handler, uint8_t Addr)
   I2Cx_Init(i2c_handler);
 }
 
+#if defined(AUDIO_IO_BATCH)
+/**
+  * @brief  Starts the I2C DMA transfer of the next codec registers of the batch,
+  *         the ones at consecutive addresses going in the same transfer.
+  * @note   The codec increments the register address after each value written.
+  * @retval None
+  */
+static void I2Cx_BatchNext(void)
+{
+  uint32_t count = 0;
+  uint16_t reg = 0;
+
+  if (AudioBatchIndex >= AudioBatchCount)
+  {
+    AudioBatchState = AUDIO_IO_BATCH_IDLE;
+  }
+  else
+  {
+    reg = pAudioBatch[AudioBatchIndex].Reg;
+    AudioBatchFrame[0] = (uint8_t)(reg >> 8);
+    AudioBatchFrame[1] = (uint8_t)(reg);
+
+    do
+    {
+      AudioBatchFrame[2 + (2 * count)] = (uint8_t)(pAudioBatch[AudioBatchIndex].Value >> 8);
+      AudioBatchFrame[3 + (2 * count)] = (uint8_t)(pAudioBatch[AudioBatchIndex].Value);
+      AudioBatchIndex++;
+      count++;
+    } while ((AudioBatchIndex < AudioBatchCount) && (count < AUDIO_IO_BATCH_RUN_MAX) &&
+             (pAudioBatch[AudioBatchIndex].Reg == (reg + count)));
+
+    /* Write the frame to memory before the DMA reads it */
+    if ((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+    {
+      SCB_CleanDCache_by_Addr((uint32_t *)AudioBatchFrame, sizeof(AudioBatchFrame));
+    }
+
+    if (HAL_I2C_Master_Transmit_DMA(&hI2cAudioHandler, AudioBatchAddr, AudioBatchFrame, (uint16_t)(2 + (2 * count))) != HAL_OK)
+    {
+      AudioBatchState = AUDIO_IO_BATCH_ERROR;
+    }
+  }
+}
+
+/**
+  * @brief  Goes on with the codec register writes batch once the I2C transfer
+  *         in progress has completed.
+  * @retval None
+  */
+static void I2Cx_BatchProcess(void)
+{
+  if ((AudioBatchState == AUDIO_IO_BATCH_BUSY) && (HAL_I2C_GetState(&hI2cAudioHandler) == HAL_I2C_STATE_READY))
+  {
+    if (HAL_I2C_GetError(&hI2cAudioHandler) != HAL_I2C_ERROR_NONE)
+    {
+      AudioBatchState = AUDIO_IO_BATCH_ERROR;
+    }
+    else
+    {
+      I2Cx_BatchNext();
+    }
+  }
+}
+
+/**
+  * @brief  Waits for the codec register writes batch to be sent before the I2C
+  *         bus it uses is accessed.
+  * @param  i2c_handler : I2C handler
+  * @retval None
+  */
+static void I2Cx_BatchWait(I2C_HandleTypeDef *i2c_handler)
+{
+  uint32_t tickstart = HAL_GetTick();
+
+  if (i2c_handler == (I2C_HandleTypeDef*)(&hI2cAudioHandler))
+  {
+    while ((AudioBatchState == AUDIO_IO_BATCH_BUSY) && ((HAL_GetTick() - tickstart) < 1000))
+    {
+    }
+
+    if (AudioBatchState != AUDIO_IO_BATCH_IDLE)
+    {
+      /* The rest of the batch is dropped: re-Initiaize the I2C Bus */
+      AudioBatchState = AUDIO_IO_BATCH_IDLE;
+      I2Cx_Error(i2c_handler, AudioBatchAddr);
+    }
+  }
+}
+
+/**
+  * @brief  Handles the audio I2C event interrupt request.
+  * @note   To be called from DISCOVERY_AUDIO_I2Cx_EV_IRQHandler().
+  * @retval None
+  */
+void BSP_AUDIO_I2C_EV_IRQHandler(void)
+{
+  HAL_I2C_EV_IRQHandler(&hI2cAudioHandler);
+  I2Cx_BatchProcess();
+}
+
+/**
+  * @brief  Handles the audio I2C error interrupt request.
+  * @note   To be called from DISCOVERY_AUDIO_I2Cx_ER_IRQHandler().
+  * @retval None
+  */
+void BSP_AUDIO_I2C_ER_IRQHandler(void)
+{
+  HAL_I2C_ER_IRQHandler(&hI2cAudioHandler);
+  I2Cx_BatchProcess();
+}
+
+/**
+  * @brief  Handles the audio I2C DMA Tx interrupt request.
+  * @note   To be called from DISCOVERY_AUDIO_I2Cx_DMAx_TX_IRQHandler().
+  * @retval None
+  */
+void BSP_AUDIO_I2C_DMA_Tx_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(hI2cAudioHandler.hdmatx);
+  I2Cx_BatchProcess();
+}
+#endif /* AUDIO_IO_BATCH */
+
 /*******************************************************************************
                             LINK OPERATIONS
 *******************************************************************************/
@@ -735,9 +941,40 @@ uint16_t AUDIO_IO_Read(uint8_t Addr, uint16_t Reg)
   */
 void AUDIO_IO_Delay(uint32_t Delay)
 {
+#if defined(AUDIO_IO_BATCH)
+  /* The delay starts once the codec register writes are sent */
+  I2Cx_BatchWait(&hI2cAudioHandler);
+#endif /* AUDIO_IO_BATCH */
+
   HAL_Delay(Delay);
 }
 
+#if defined(AUDIO_IO_BATCH)
+/**
+  * @brief  Starts sending codec register writes and returns, the I2C and DMA
+  *         interrupts go on with the transfers.
+  * @note   The next AUDIO_IO_xxx() call, or access to the audio I2C bus, waits
+  *         for the writes to be sent.
+  * @param  Addr: I2C address
+  * @param  pRegs: Register writes, not modified until they are sent
+  * @param  Count: Number of register writes
+  * @retval None
+  */
+void AUDIO_IO_WriteBatch(uint8_t Addr, AUDIO_IO_RegTypeDef *pRegs, uint16_t Count)
+{
+  /* Wait for the previous batch */
+  I2Cx_BatchWait(&hI2cAudioHandler);
+
+  pAudioBatch     = pRegs;
+  AudioBatchCount = Count;
+  AudioBatchIndex = 0;
+  AudioBatchAddr  = Addr;
+  AudioBatchState = AUDIO_IO_BATCH_BUSY;
+
+  I2Cx_BatchNext();
+}
+#endif /* AUDIO_IO_BATCH */
+
 /********************************* LINK CAMERA ********************************/
 
 /**
@@ -256,6 +256,15 @@ typedef enum
 /* I2C interrupt requests */
 #define DISCOVERY_AUDIO_I2Cx_EV_IRQn                     I2C3_EV_IRQn
 #define DISCOVERY_AUDIO_I2Cx_ER_IRQn                     I2C3_ER_IRQn
+#define DISCOVERY_AUDIO_I2Cx_EV_IRQHandler               I2C3_EV_IRQHandler
+#define DISCOVERY_AUDIO_I2Cx_ER_IRQHandler               I2C3_ER_IRQHandler
+
+/* I2C DMA used to send the codec register writes batches (AUDIO_IO_BATCH defined) */
+#define DISCOVERY_AUDIO_I2Cx_DMAx_CLK_ENABLE()           __HAL_RCC_DMA1_CLK_ENABLE()
+#define DISCOVERY_AUDIO_I2Cx_DMAx_TX_STREAM              DMA1_Stream4
+#define DISCOVERY_AUDIO_I2Cx_DMAx_TX_CHANNEL             DMA_CHANNEL_3
+#define DISCOVERY_AUDIO_I2Cx_DMAx_TX_IRQn                DMA1_Stream4_IRQn
+#define DISCOVERY_AUDIO_I2Cx_DMAx_TX_IRQHandler          DMA1_Stream4_IRQHandler
 
 /* Definition for external, camera and Arduino connector I2Cx resources */
 #define DISCOVERY_EXT_I2Cx                               I2C1
@@ -313,6 +322,11 @@ void      BSP_PB_DeInit(Button_TypeDef Button);
 uint32_t  BSP_PB_GetState(Button_TypeDef Button);
 void      BSP_COM_Init(COM_TypeDef COM, UART_HandleTypeDef *husart);
 void      BSP_COM_DeInit(COM_TypeDef COM, UART_HandleTypeDef *huart);
+#if defined(AUDIO_IO_BATCH)
+void      BSP_AUDIO_I2C_EV_IRQHandler(void);
+void      BSP_AUDIO_I2C_ER_IRQHandler(void);
+void      BSP_AUDIO_I2C_DMA_Tx_IRQHandler(void);
+#endif /* AUDIO_IO_BATCH */
 
 /**
   * @}
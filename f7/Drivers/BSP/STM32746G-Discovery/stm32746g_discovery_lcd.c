@@ -33,8 +33,13 @@
          function or a complete string line using the BSP_LCD_DisplayStringAtLine() function.
        o Display a string line on the specified position (x,y in pixel) and align mode
          using the BSP_LCD_DisplayStringAtLine() function.          
+       o Draw a picture read in chunks from a file or an external memory with
+         BSP_LCD_DrawBitmapStream() (BMP) or BSP_LCD_DrawImageStream() (raw pixels):
+         the picture is not loaded in RAM, lines are converted by DMA2D in batches.
        o Draw and fill a basic shapes (dot, line, rectangle, circle, ellipse, .. bitmap) 
          on LCD using the available set of functions.       
+       o Filled circles, ellipses and polygons are scanned row by row: the rows are
+         merged in rectangles filled by DMA2D while the CPU computes the next ones.
   @endverbatim
   ******************************************************************************
   * @attention
@@ -108,6 +113,16 @@ EndDependencies */
 /** @defgroup STM32746G_DISCOVERY_LCD_Private_TypesDefinitions STM32746G_DISCOVERY_LCD Private Types Definitions
   * @{
   */ 
+/** 
+  * @brief  Polygon edge of the scanline fill, X in 16.16 fixed point
+  */
+typedef struct
+{
+  int32_t YTop;     /* First row crossed by the edge */
+  int32_t YEnd;     /* Last row crossed by the edge */
+  int32_t X;        /* X position on the current row */
+  int32_t Slope;    /* X increment from one row to the next */
+}LCD_EdgeTypeDef;
 /**
   * @}
   */ 
@@ -138,6 +153,32 @@ static DMA2D_HandleTypeDef hDma2dHandler;
 /* Default LCD configuration with LCD Layer 1 */
 static uint32_t            ActiveLayer = 0;
 static LCD_DrawPropTypeDef DrawProp[MAX_LAYER_NUMBER];
+static FONT_AtlasTypeDef   *pFontAtlas = NULL;
+
+/* Frame presentation state, the buffers are indexes in PresentAddress[] */
+#define LCD_PRESENT_NONE           0xFFFFFFFFU
+static uint32_t            PresentAddress[LCD_PRESENT_MAX_BUFFERS];
+static uint32_t            PresentCount = 0;
+static uint32_t            PresentLayer = 0;
+static uint32_t            PresentFront = 0;
+static uint32_t            PresentPending = LCD_PRESENT_NONE;
+static uint32_t            PresentBack = 0;
+
+/* Picture stream staging buffer, two halves : one is read while DMA2D converts the other */
+ALIGN_32BYTES(static uint8_t StreamBuffer[LCD_STREAM_BUFFER_SIZE]);
+/* Color look-up table of the 8 bpp pictures */
+static uint32_t            StreamClut[256];
+
+/* Scanline fill: polygon edge table sorted by top row and edges crossing the current row */
+static LCD_EdgeTypeDef     PolyEdge[LCD_POLYGON_MAX_POINTS];
+static LCD_EdgeTypeDef     *PolyActive[LCD_POLYGON_MAX_POINTS];
+/* Rectangle of the merged spans, not filled yet, and DMA2D fill in progress */
+static uint32_t            SpanX = 0;
+static uint32_t            SpanY = 0;
+static uint32_t            SpanWidth = 0;
+static uint32_t            SpanHeight = 0;
+static uint32_t            SpanPixelSize = 0;
+static uint32_t            SpanBusy = 0;
 /**
   * @}
   */ 
@@ -146,9 +187,18 @@ static LCD_DrawPropTypeDef DrawProp[MAX_LAYER_NUMBER];
   * @{
   */ 
 static void DrawChar(uint16_t Xpos, uint16_t Ypos, const uint8_t *c);
-static void FillTriangle(uint16_t x1, uint16_t x2, uint16_t x3, uint16_t y1, uint16_t y2, uint16_t y3);
+static uint8_t LL_DrawGlyph(uint16_t Xpos, uint16_t Ypos, uint8_t Ascii, uint8_t Setup);
+static uint8_t LL_PresentWait(void);
+static uint8_t LL_SpanBegin(void);
+static void LL_SpanAdd(int32_t x1, int32_t x2, int32_t y);
+static void LL_SpanFlush(void);
+static void LL_SpanEnd(void);
 static void LL_FillBuffer(uint32_t LayerIndex, void *pDst, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint32_t ColorIndex);
-static void LL_ConvertLineToARGB8888(void * pSrc, void *pDst, uint32_t xSize, uint32_t ColorMode);
+static uint32_t LL_GetPixelSize(void);
+static uint8_t LL_ConvertInit(uint32_t ColorMode, uint32_t AlphaMode, uint32_t OutputOffset, uint32_t *pClut);
+static uint8_t LL_StreamRead(LCD_StreamReadTypeDef Read, void *pContext, uint8_t *pBuffer, uint32_t Size);
+static uint8_t LL_StreamImage(uint32_t Xpos, uint32_t Ypos, uint32_t Width, uint32_t Height, uint32_t PixelSize,
+                              uint32_t Padding, uint32_t BottomUp, LCD_StreamReadTypeDef Read, void *pContext);
 /**
   * @}
   */ 
@@ -446,6 +496,113 @@ void BSP_LCD_SetLayerAddress_NoReload(uint32_t LayerIndex, uint32_t Address)
   HAL_LTDC_SetAddress_NoReload(&hLtdcHandler, Address, LayerIndex);
 }
 
+/**
+  * @brief  Starts the frame presentation on a layer, with 2 or 3 frame buffers.
+  * @note   The first buffer is shown and the drawing functions draw in the
+  *         second one, until BSP_LCD_Present() is called. Each buffer holds
+  *         a full screen in the pixel format of the layer.
+  * @note   The layer address held by the LTDC handle is the back buffer: the
+  *         functions reloading the layer configuration immediately must not
+  *         be used on this layer while the presentation runs.
+  * @param  LayerIndex: Layer foreground or background
+  * @param  pAddress: Frame buffer addresses
+  * @param  Count: Number of frame buffers, 2 (double) or 3 (triple buffering)
+  * @retval LCD status
+  */
+uint8_t BSP_LCD_PresentInit(uint32_t LayerIndex, uint32_t *pAddress, uint32_t Count)
+{
+  uint32_t index;
+  
+  if((Count < 2) || (Count > LCD_PRESENT_MAX_BUFFERS))
+  {
+    return LCD_ERROR;
+  }
+  
+  for(index = 0; index < Count; index++)
+  {
+    PresentAddress[index] = pAddress[index];
+  }
+  PresentCount   = Count;
+  PresentLayer   = LayerIndex;
+  PresentFront   = 0;
+  PresentPending = LCD_PRESENT_NONE;
+  PresentBack    = 1;
+  
+  HAL_LTDC_SetAddress(&hLtdcHandler, PresentAddress[PresentFront], PresentLayer);
+  hLtdcHandler.LayerCfg[PresentLayer].FBStartAdress = PresentAddress[PresentBack];
+  
+  return LCD_OK;
+}
+
+/**
+  * @brief  Shows the back buffer at the next vertical blanking and selects the
+  *         buffer the next frame is drawn in.
+  * @note   With triple buffering the call only waits when the previous frame
+  *         is still waiting for its vertical blanking; with double buffering
+  *         it waits until the frame is shown.
+  * @retval Address of the new back buffer, 0 on timeout
+  */
+uint32_t BSP_LCD_Present(void)
+{
+  uint32_t index;
+  
+  /* Only one frame can wait for the vertical blanking */
+  if((PresentCount == 0) || (LL_PresentWait() != LCD_OK))
+  {
+    return 0;
+  }
+
+#if (__DCACHE_PRESENT == 1)
+  /* Write the frame to memory before the LTDC reads it */
+  if((SCB->CCR & SCB_CCR_DC_Msk) != 0)
+  {
+    SCB_CleanDCache_by_Addr((uint32_t *)PresentAddress[PresentBack],
+                            BSP_LCD_GetXSize() * BSP_LCD_GetYSize() *
+                            ((hLtdcHandler.LayerCfg[PresentLayer].PixelFormat == LTDC_PIXEL_FORMAT_RGB565) ? 2 : 4));
+  }
+#endif
+  
+  /* The layer shadow address is loaded by hardware on the vertical blanking */
+  LTDC_LAYER(&hLtdcHandler, PresentLayer)->CFBAR = PresentAddress[PresentBack];
+  hLtdcHandler.Instance->SRCR = LTDC_SRCR_VBR;
+  PresentPending = PresentBack;
+  
+  /* With two buffers, the next back buffer is the one shown until now */
+  if((PresentCount == 2) && (LL_PresentWait() != LCD_OK))
+  {
+    return 0;
+  }
+  
+  /* Draw in a buffer neither shown nor waiting to be shown */
+  for(index = 0; index < PresentCount; index++)
+  {
+    if((index != PresentFront) && (index != PresentPending))
+    {
+      break;
+    }
+  }
+  PresentBack = index;
+  hLtdcHandler.LayerCfg[PresentLayer].FBStartAdress = PresentAddress[PresentBack];
+  
+  return PresentAddress[PresentBack];
+}
+
+/**
+  * @brief  Tells whether a presented frame is still waiting for the vertical
+  *         blanking.
+  * @retval 1 if a frame is pending, 0 otherwise
+  */
+uint8_t BSP_LCD_IsPresentPending(void)
+{
+  if((PresentPending != LCD_PRESENT_NONE) && ((hLtdcHandler.Instance->SRCR & LTDC_SRCR_VBR) == 0))
+  {
+    PresentFront   = PresentPending;
+    PresentPending = LCD_PRESENT_NONE;
+  }
+  
+  return (PresentPending != LCD_PRESENT_NONE) ? 1 : 0;
+}
+
 /**
   * @brief  Sets display window.
   * @param  LayerIndex: Layer index
@@ -663,6 +820,17 @@ void BSP_LCD_ClearStringLine(uint32_t Line)
   BSP_LCD_SetTextColor(DrawProp[ActiveLayer].TextColor);  
 }
 
+/**
+  * @brief  Sets the glyph atlas used to draw the characters of its font.
+  * @note   The characters of the other fonts are still drawn pixel by pixel.
+  * @param  pAtlas: Glyph atlas built by FONT_AtlasInit(), NULL to disable it
+  * @retval None
+  */
+void BSP_LCD_SetFontAtlas(FONT_AtlasTypeDef *pAtlas)
+{
+  pFontAtlas = pAtlas;
+}
+
 /**
   * @brief  Displays one character.
   * @param  Xpos: Start column address
@@ -673,8 +841,12 @@ void BSP_LCD_ClearStringLine(uint32_t Line)
   */
 void BSP_LCD_DisplayChar(uint16_t Xpos, uint16_t Ypos, uint8_t Ascii)
 {
-  DrawChar(Xpos, Ypos, &DrawProp[ActiveLayer].pFont->table[(Ascii-' ') *\
-    DrawProp[ActiveLayer].pFont->Height * ((DrawProp[ActiveLayer].pFont->Width + 7) / 8)]);
+  /* Blit the glyph with DMA2D when the font has an atlas, else plot it */
+  if(LL_DrawGlyph(Xpos, Ypos, Ascii, 1) != LCD_OK)
+  {
+    DrawChar(Xpos, Ypos, &DrawProp[ActiveLayer].pFont->table[(Ascii-' ') *\
+      DrawProp[ActiveLayer].pFont->Height * ((DrawProp[ActiveLayer].pFont->Width + 7) / 8)]);
+  }
 }
 
 /**
@@ -694,6 +866,7 @@ void BSP_LCD_DisplayStringAt(uint16_t Xpos, uint16_t Ypos, uint8_t *Text, Text_A
   uint16_t ref_column = 1, i = 0;
   uint32_t size = 0, xsize = 0; 
   uint8_t  *ptr = Text;
+  uint8_t  setup = 1;
   
   /* Get the text size */
   while (*ptr++) size ++ ;
@@ -734,8 +907,16 @@ void BSP_LCD_DisplayStringAt(uint16_t Xpos, uint16_t Ypos, uint8_t *Text, Text_A
   /* Send the string character by character on LCD */
   while ((*Text != 0) & (((BSP_LCD_GetXSize() - (i*DrawProp[ActiveLayer].pFont->Width)) & 0xFFFF) >= DrawProp[ActiveLayer].pFont->Width))
   {
-    /* Display one character on LCD */
-    BSP_LCD_DisplayChar(ref_column, Ypos, *Text);
+    /* Display one character on LCD, the DMA2D set up is shared by the glyphs */
+    if(LL_DrawGlyph(ref_column, Ypos, *Text, setup) == LCD_OK)
+    {
+      setup = 0;
+    }
+    else
+    {
+      BSP_LCD_DisplayChar(ref_column, Ypos, *Text);
+      setup = 1;
+    }
     /* Decrement the column position by 16 */
     ref_column += DrawProp[ActiveLayer].pFont->Width;
     /* Point on the next character */
@@ -1028,7 +1209,8 @@ void BSP_LCD_DrawPixel(uint16_t Xpos, uint16_t Ypos, uint32_t RGB_Code)
 }
 
 /**
-  * @brief  Draws a bitmap picture loaded in the internal Flash in ARGB888 format (32 bits per pixel).
+  * @brief  Draws a bitmap picture loaded in the internal Flash (32, 24 or 16 bits per pixel).
+  * @note   The picture is converted to the pixel format of the active layer.
   * @param  Xpos: Bmp X position in the LCD
   * @param  Ypos: Bmp Y position in the LCD
   * @param  pbmp: Pointer to Bmp picture address in the internal Flash
@@ -1037,7 +1219,7 @@ void BSP_LCD_DrawPixel(uint16_t Xpos, uint16_t Ypos, uint32_t RGB_Code)
 void BSP_LCD_DrawBitmap(uint32_t Xpos, uint32_t Ypos, uint8_t *pbmp)
 {
   uint32_t index = 0, width = 0, height = 0, bit_pixel = 0;
-  uint32_t address;
+  uint32_t address, pixel_size;
   uint32_t input_color_mode = 0;
   
   /* Get bitmap data address offset */
@@ -1053,7 +1235,8 @@ void BSP_LCD_DrawBitmap(uint32_t Xpos, uint32_t Ypos, uint8_t *pbmp)
   bit_pixel = pbmp[28] + (pbmp[29] << 8);  
   
   /* Set the address */
-  address = hLtdcHandler.LayerCfg[ActiveLayer].FBStartAdress + (((BSP_LCD_GetXSize()*Ypos) + Xpos)*(4));
+  pixel_size = LL_GetPixelSize();
+  address = hLtdcHandler.LayerCfg[ActiveLayer].FBStartAdress + (((BSP_LCD_GetXSize()*Ypos) + Xpos)*pixel_size);
   
   /* Get the layer pixel format */    
   if ((bit_pixel/8) == 4)
@@ -1072,18 +1255,203 @@ void BSP_LCD_DrawBitmap(uint32_t Xpos, uint32_t Ypos, uint8_t *pbmp)
   /* Bypass the bitmap header */
   pbmp += (index + (width * (height - 1) * (bit_pixel/8)));  
   
-  /* Convert picture to ARGB8888 pixel format */
+  /* Converted lines are written in the active layer pixel format */
+  if(LL_ConvertInit(input_color_mode, DMA2D_NO_MODIF_ALPHA, 0, NULL) != LCD_OK)
+  {
+    return;
+  }
+  
   for(index=0; index < height; index++)
   {
     /* Pixel format conversion */
-    LL_ConvertLineToARGB8888((uint32_t *)pbmp, (uint32_t *)address, width, input_color_mode);
+    if(HAL_DMA2D_Start(&hDma2dHandler, (uint32_t)pbmp, address, width, 1) == HAL_OK)
+    {
+      /* Polling For DMA transfer */  
+      HAL_DMA2D_PollForTransfer(&hDma2dHandler, 10);
+    }
     
     /* Increment the source and destination buffers */
-    address+=  (BSP_LCD_GetXSize()*4);
+    address+=  (BSP_LCD_GetXSize()*pixel_size);
     pbmp -= width*(bit_pixel/8);
   } 
 }
 
+/**
+  * @brief  Draws a BMP picture read from a stream (file, external memory...) in currently active layer.
+  * @note   The picture is not loaded in RAM : lines are read in batches in the
+  *         staging buffer and converted to the pixel format of the active layer
+  *         by DMA2D, one transfer per batch, while the next batch is read.
+  *         32, 24, 16 (RGB565 bit fields or RGB555) and 8 (palette) bits per pixel
+  *         uncompressed pictures are supported, top-down or bottom-up.
+  * @param  Xpos: Bmp X position in the LCD
+  * @param  Ypos: Bmp Y position in the LCD
+  * @param  Read: Sequential read function, positioned at the start of the BMP file
+  * @param  pContext: Parameter given to Read
+  * @retval LCD_OK, or LCD_ERROR if the picture is not supported, does not fit
+  *         in the display, or in case of read or DMA2D error
+  */
+uint8_t BSP_LCD_DrawBitmapStream(uint32_t Xpos, uint32_t Ypos, LCD_StreamReadTypeDef Read, void *pContext)
+{
+  uint8_t  *pheader = StreamBuffer;
+  uint32_t offset, header_size, width, height, bit_pixel, compression, colors;
+  uint32_t bottom_up, padding, index;
+  uint32_t input_color_mode, alpha_mode = DMA2D_REPLACE_ALPHA;
+  uint32_t *pclut = NULL;
+  int32_t  bmp_height;
+
+  /* File header and bitmap information header */
+  if(LL_StreamRead(Read, pContext, pheader, 54) != LCD_OK)
+  {
+    return LCD_ERROR;
+  }
+  offset      = pheader[10] + (pheader[11] << 8) + (pheader[12] << 16) + (pheader[13] << 24);
+  header_size = pheader[14] + (pheader[15] << 8) + (pheader[16] << 16) + (pheader[17] << 24);
+  width       = pheader[18] + (pheader[19] << 8) + (pheader[20] << 16) + (pheader[21] << 24);
+  bmp_height  = (int32_t)(pheader[22] + (pheader[23] << 8) + (pheader[24] << 16) + ((uint32_t)pheader[25] << 24));
+  bit_pixel   = pheader[28] + (pheader[29] << 8);
+  compression = pheader[30] + (pheader[31] << 8) + (pheader[32] << 16) + (pheader[33] << 24);
+  colors      = pheader[46] + (pheader[47] << 8) + (pheader[48] << 16) + (pheader[49] << 24);
+
+  if((pheader[0] != 'B') || (pheader[1] != 'M') || (offset < 54) || (offset > LCD_STREAM_BUFFER_SIZE))
+  {
+    return LCD_ERROR;
+  }
+
+  /* Rest of the header up to the pixels : bit fields masks and palette */
+  if(LL_StreamRead(Read, pContext, &pheader[54], offset - 54) != LCD_OK)
+  {
+    return LCD_ERROR;
+  }
+
+  /* Positive height is a bottom-up picture */
+  bottom_up = (bmp_height > 0) ? 1 : 0;
+  height    = (bmp_height > 0) ? (uint32_t)bmp_height : (uint32_t)(-bmp_height);
+
+  if((width == 0) || (height == 0) ||
+     ((Xpos + width) > BSP_LCD_GetXSize()) || ((Ypos + height) > BSP_LCD_GetYSize()))
+  {
+    return LCD_ERROR;
+  }
+
+  /* Input color mode, 3 is BI_BITFIELDS with the masks at offset 54 */
+  if((bit_pixel == 32) && ((compression == 0) || (compression == 3)))
+  {
+    input_color_mode = CM_ARGB8888;
+    /* Keep the alpha channel only if the header describes one */
+    if((compression == 3) && (header_size >= 56) && (pheader[69] == 0xFF))
+    {
+      alpha_mode = DMA2D_NO_MODIF_ALPHA;
+    }
+  }
+  else if((bit_pixel == 24) && (compression == 0))
+  {
+    input_color_mode = CM_RGB888;
+  }
+  else if((bit_pixel == 16) && (compression == 3) && (pheader[54] == 0x00) && (pheader[55] == 0xF8))
+  {
+    input_color_mode = CM_RGB565;
+  }
+  else if((bit_pixel == 16) && (compression == 0))
+  {
+    input_color_mode = CM_ARGB1555;
+  }
+  else if((bit_pixel == 8) && (compression == 0))
+  {
+    input_color_mode = CM_L8;
+    colors = ((colors == 0) || (colors > 256)) ? 256 : colors;
+    if((14 + header_size + (colors * 4)) > offset)
+    {
+      return LCD_ERROR;
+    }
+    /* BMP palette entries are B, G, R, 0 : set them opaque */
+    for(index = 0; index < colors; index++)
+    {
+      StreamClut[index] = 0xFF000000 | (pheader[14 + header_size + (index * 4) + 2] << 16) |
+                          (pheader[14 + header_size + (index * 4) + 1] << 8) | pheader[14 + header_size + (index * 4)];
+    }
+    for(; index < 256; index++)
+    {
+      StreamClut[index] = 0xFF000000;
+    }
+    pclut = StreamClut;
+  }
+  else
+  {
+    return LCD_ERROR;
+  }
+
+  /* BMP lines are padded to 4 bytes */
+  padding = (4 - ((width * (bit_pixel / 8)) & 3)) & 3;
+
+  if(LL_ConvertInit(input_color_mode, alpha_mode, BSP_LCD_GetXSize() - width, pclut) != LCD_OK)
+  {
+    return LCD_ERROR;
+  }
+
+  return LL_StreamImage(Xpos, Ypos, width, height, bit_pixel / 8, padding, bottom_up, Read, pContext);
+}
+
+/**
+  * @brief  Draws a raw picture read from a stream (file, external memory...) in currently active layer.
+  * @note   Lines are top-down and not padded. They are read in batches in the
+  *         staging buffer and converted to the pixel format of the active layer
+  *         by DMA2D, one transfer per batch, while the next batch is read.
+  * @param  Xpos: Picture X position in the LCD
+  * @param  Ypos: Picture Y position in the LCD
+  * @param  Width: Picture width
+  * @param  Height: Picture height
+  * @param  ColorMode: Picture color mode, one of CM_ARGB8888, CM_RGB888,
+  *         CM_RGB565, CM_ARGB1555, CM_ARGB4444 or CM_L8
+  * @param  pClut: 256 ARGB8888 colors look-up table for CM_L8, NULL otherwise
+  * @param  Read: Sequential read function, positioned at the first pixel
+  * @param  pContext: Parameter given to Read
+  * @retval LCD_OK, or LCD_ERROR if the picture is not supported, does not fit
+  *         in the display, or in case of read or DMA2D error
+  */
+uint8_t BSP_LCD_DrawImageStream(uint32_t Xpos, uint32_t Ypos, uint32_t Width, uint32_t Height, uint32_t ColorMode,
+                                uint32_t *pClut, LCD_StreamReadTypeDef Read, void *pContext)
+{
+  uint32_t pixel_size;
+
+  if((Width == 0) || (Height == 0) ||
+     ((Xpos + Width) > BSP_LCD_GetXSize()) || ((Ypos + Height) > BSP_LCD_GetYSize()))
+  {
+    return LCD_ERROR;
+  }
+
+  switch(ColorMode)
+  {
+  case CM_ARGB8888:
+    pixel_size = 4;
+    break;
+  case CM_RGB888:
+    pixel_size = 3;
+    break;
+  case CM_RGB565:
+  case CM_ARGB1555:
+  case CM_ARGB4444:
+    pixel_size = 2;
+    break;
+  case CM_L8:
+    if(pClut == NULL)
+    {
+      return LCD_ERROR;
+    }
+    pixel_size = 1;
+    break;
+  default:
+    return LCD_ERROR;
+  }
+
+  if(LL_ConvertInit(ColorMode, DMA2D_NO_MODIF_ALPHA, BSP_LCD_GetXSize() - Width,
+                    (ColorMode == CM_L8) ? pClut : NULL) != LCD_OK)
+  {
+    return LCD_ERROR;
+  }
+
+  return LL_StreamImage(Xpos, Ypos, Width, Height, pixel_size, 0, 0, Read, pContext);
+}
+
 /**
   * @brief  Draws a full rectangle.
   * @param  Xpos: X position
@@ -1121,43 +1489,37 @@ void BSP_LCD_FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Hei
   */
 void BSP_LCD_FillCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius)
 {
-  int32_t  decision;     /* Decision Variable */ 
-  uint32_t  current_x;   /* Current X Value */
-  uint32_t  current_y;   /* Current Y Value */
-  
-  decision = 3 - (Radius << 1);
-  
-  current_x = 0;
-  current_y = Radius;
+  int32_t  current_y;   /* Current row from the center */
+  int32_t  half;        /* Half width of the current row */
+  int32_t  limit = (int32_t)Radius * (Radius + 1);
   
   BSP_LCD_SetTextColor(DrawProp[ActiveLayer].TextColor);
   
-  while (current_x <= current_y)
+  if(LL_SpanBegin() == LCD_OK)
   {
-    if(current_y > 0) 
-    {
-      BSP_LCD_DrawHLine(Xpos - current_y, Ypos + current_x, 2*current_y);
-      BSP_LCD_DrawHLine(Xpos - current_y, Ypos - current_x, 2*current_y);
-    }
-    
-    if(current_x > 0) 
-    {
-      BSP_LCD_DrawHLine(Xpos - current_x, Ypos - current_y, 2*current_x);
-      BSP_LCD_DrawHLine(Xpos - current_x, Ypos + current_y, 2*current_x);
-    }
-    if (decision < 0)
-    { 
-      decision += (current_x << 2) + 6;
-    }
-    else
+    /* Rows from the top, the half width grows up to the center then shrinks */
+    half = 0;
+    for(current_y = -(int32_t)Radius; current_y <= (int32_t)Radius; current_y++)
     {
-      decision += ((current_x - current_y) << 2) + 10;
-      current_y--;
+      if(current_y <= 0)
+      {
+        while(((half + 1) * (half + 1) + current_y * current_y) <= limit)
+        {
+          half++;
+        }
+      }
+      else
+      {
+        while((half * half + current_y * current_y) > limit)
+        {
+          half--;
+        }
+      }
+      LL_SpanAdd(Xpos - half, Xpos + half, Ypos + current_y);
     }
-    current_x++;
+    LL_SpanEnd();
   }
   
-  BSP_LCD_SetTextColor(DrawProp[ActiveLayer].TextColor);
   BSP_LCD_DrawCircle(Xpos, Ypos, Radius);
 }
 
@@ -1169,62 +1531,99 @@ void BSP_LCD_FillCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius)
   */
 void BSP_LCD_FillPolygon(pPoint Points, uint16_t PointCount)
 {
-  int16_t X = 0, Y = 0, X2 = 0, Y2 = 0, X_center = 0, Y_center = 0, X_first = 0, Y_first = 0, pixelX = 0, pixelY = 0, counter = 0;
-  uint16_t  image_left = 0, image_right = 0, image_top = 0, image_bottom = 0;
+  LCD_EdgeTypeDef *edge;
+  int32_t  x1 = 0, y1 = 0, x2 = 0, y2 = 0, y = 0, y_bottom = 0;
+  uint32_t counter = 0, edges = 0, next = 0, active = 0, index = 0;
   
-  image_left = image_right = Points->X;
-  image_top= image_bottom = Points->Y;
+  if((PointCount < 2) || (PointCount > LCD_POLYGON_MAX_POINTS))
+  {
+    return;
+  }
   
+  /* The edges ending on the bottom row fill it as well */
+  y_bottom = POLY_Y(0);
   for(counter = 1; counter < PointCount; counter++)
   {
-    pixelX = POLY_X(counter);
-    if(pixelX < image_left)
+    if(POLY_Y(counter) > y_bottom)
     {
-      image_left = pixelX;
-    }
-    if(pixelX > image_right)
-    {
-      image_right = pixelX;
+      y_bottom = POLY_Y(counter);
     }
+  }
+  
+  /* Edge table sorted by top row, without the horizontal edges */
+  for(counter = 0; counter < PointCount; counter++)
+  {
+    x1 = POLY_X(counter);
+    y1 = POLY_Y(counter);
+    x2 = POLY_X((counter + 1) % PointCount);
+    y2 = POLY_Y((counter + 1) % PointCount);
     
-    pixelY = POLY_Y(counter);
-    if(pixelY < image_top)
-    { 
-      image_top = pixelY;
-    }
-    if(pixelY > image_bottom)
+    if(y1 != y2)
     {
-      image_bottom = pixelY;
+      if(y1 > y2)
+      {
+        x1 = POLY_X((counter + 1) % PointCount);
+        y1 = POLY_Y((counter + 1) % PointCount);
+        x2 = POLY_X(counter);
+        y2 = POLY_Y(counter);
+      }
+      
+      for(index = edges; (index > 0) && (PolyEdge[index - 1].YTop > y1); index--)
+      {
+        PolyEdge[index] = PolyEdge[index - 1];
+      }
+      PolyEdge[index].YTop  = y1;
+      PolyEdge[index].YEnd  = (y2 == y_bottom) ? y2 : (y2 - 1);
+      PolyEdge[index].X     = x1 << 16;
+      PolyEdge[index].Slope = ((x2 - x1) << 16) / (y2 - y1);
+      edges++;
     }
-  }  
+  }
   
-  if(PointCount < 2)
+  if((edges == 0) || (LL_SpanBegin() != LCD_OK))
   {
     return;
   }
   
-  X_center = (image_left + image_right)/2;
-  Y_center = (image_bottom + image_top)/2;
-  
-  X_first = Points->X;
-  Y_first = Points->Y;
-  
-  while(--PointCount)
+  for(y = PolyEdge[0].YTop; (y <= y_bottom) && (y < (int32_t)BSP_LCD_GetYSize()); y++)
   {
-    X = Points->X;
-    Y = Points->Y;
-    Points++;
-    X2 = Points->X;
-    Y2 = Points->Y;    
+    /* Edges starting on this row join the active ones */
+    while((next < edges) && (PolyEdge[next].YTop == y))
+    {
+      PolyActive[active++] = &PolyEdge[next++];
+    }
     
-    FillTriangle(X, X2, X_center, Y, Y2, Y_center);
-    FillTriangle(X, X_center, X2, Y, Y_center, Y2);
-    FillTriangle(X_center, X2, X, Y_center, Y2, Y);   
+    /* Sort the active edges by X, mostly in order from the previous row */
+    for(index = 1; index < active; index++)
+    {
+      edge = PolyActive[index];
+      for(counter = index; (counter > 0) && (PolyActive[counter - 1]->X > edge->X); counter--)
+      {
+        PolyActive[counter] = PolyActive[counter - 1];
+      }
+      PolyActive[counter] = edge;
+    }
+    
+    /* Even-odd rule: fill the pixels between the edge pairs */
+    for(index = 0; (index + 1) < active; index += 2)
+    {
+      LL_SpanAdd((PolyActive[index]->X + 0xFFFF) >> 16, PolyActive[index + 1]->X >> 16, y);
+    }
+    
+    /* Edges ending on this row leave, the others move to the next row */
+    counter = 0;
+    for(index = 0; index < active; index++)
+    {
+      if(PolyActive[index]->YEnd > y)
+      {
+        PolyActive[index]->X += PolyActive[index]->Slope;
+        PolyActive[counter++] = PolyActive[index];
+      }
+    }
+    active = counter;
   }
   
-  FillTriangle(X_first, X2, X_center, Y_first, Y2, Y_center);
-  FillTriangle(X_first, X_center, X2, Y_first, Y_center, Y2);
-  FillTriangle(X_center, X2, X_first, Y_center, Y2, Y_first);   
+  LL_SpanEnd();
 }
 
 /**
@@ -1237,28 +1636,36 @@ void BSP_LCD_FillPolygon(pPoint Points, uint16_t PointCount)
   */
 void BSP_LCD_FillEllipse(int Xpos, int Ypos, int XRadius, int YRadius)
 {
-  int x = 0, y = -YRadius, err = 2-2*XRadius, e2;
-  float k = 0, rad1 = 0, rad2 = 0;
-  
-  rad1 = XRadius;
-  rad2 = YRadius;
+  int32_t current_y = 0, half = 0;
+  int64_t xx = (int64_t)XRadius * XRadius, yy = (int64_t)YRadius * YRadius;
+  int64_t limit = (xx * yy) + ((int64_t)XRadius * YRadius * ((XRadius + YRadius) / 2));
   
-  k = (float)(rad2/rad1);
+  if((XRadius < 0) || (YRadius < 0) || (LL_SpanBegin() != LCD_OK))
+  {
+    return;
+  }
   
-  do 
-  {       
-    BSP_LCD_DrawHLine((Xpos-(uint16_t)(x/k)), (Ypos+y), (2*(uint16_t)(x/k) + 1));
-    BSP_LCD_DrawHLine((Xpos-(uint16_t)(x/k)), (Ypos-y), (2*(uint16_t)(x/k) + 1));
-    
-    e2 = err;
-    if (e2 <= x) 
+  /* Rows from the top, the half width grows up to the center then shrinks */
+  for(current_y = -YRadius; current_y <= YRadius; current_y++)
+  {
+    if(current_y <= 0)
     {
-      err += ++x*2+1;
-      if (-y == x && e2 <= y) e2 = 0;
+      while((half < XRadius) && (((int64_t)(half + 1) * (half + 1) * yy + (int64_t)current_y * current_y * xx) <= limit))
+      {
+        half++;
+      }
+    }
+    else
+    {
+      while((half > 0) && (((int64_t)half * half * yy + (int64_t)current_y * current_y * xx) > limit))
+      {
+        half--;
+      }
     }
-    if (e2 > y) err += ++y*2+1;
+    LL_SpanAdd(Xpos - half, Xpos + half, Ypos + current_y);
   }
-  while (y <= 0);
+  
+  LL_SpanEnd();
 }
 
 /**
@@ -1490,81 +1897,230 @@ static void DrawChar(uint16_t Xpos, uint16_t Ypos, const uint8_t *c)
 }
 
 /**
-  * @brief  Fills a triangle (between 3 points).
-  * @param  x1: Point 1 X position
-  * @param  y1: Point 1 Y position
-  * @param  x2: Point 2 X position
-  * @param  y2: Point 2 Y position
-  * @param  x3: Point 3 X position
-  * @param  y3: Point 3 Y position
-  * @retval None
+  * @brief  Draws a character from the glyph atlas with DMA2D.
+  * @note   The foreground is the glyph coverage in the text color, blended
+  *         over a background of plain back color.
+  * @param  Xpos: Start column address
+  * @param  Ypos: Line where to display the character shape
+  * @param  Ascii: Character ascii code
+  * @param  Setup: 0 to reuse the DMA2D set up of the previous glyph
+  * @retval LCD_OK if the glyph was drawn, LCD_ERROR to draw it pixel by pixel
   */
-static void FillTriangle(uint16_t x1, uint16_t x2, uint16_t x3, uint16_t y1, uint16_t y2, uint16_t y3)
-{ 
-  int16_t deltax = 0, deltay = 0, x = 0, y = 0, xinc1 = 0, xinc2 = 0, 
-  yinc1 = 0, yinc2 = 0, den = 0, num = 0, num_add = 0, num_pixels = 0,
-  curpixel = 0;
+static uint8_t LL_DrawGlyph(uint16_t Xpos, uint16_t Ypos, uint8_t Ascii, uint8_t Setup)
+{
+  sFONT *pfont = DrawProp[ActiveLayer].pFont;
+  const uint8_t *pglyph;
+  uint32_t input_mode, output_mode, bytes;
+  uint32_t address;
   
-  deltax = ABS(x2 - x1);        /* The difference between the x's */
-  deltay = ABS(y2 - y1);        /* The difference between the y's */
-  x = x1;                       /* Start x off at the first pixel */
-  y = y1;                       /* Start y off at the first pixel */
+  if((pFontAtlas == NULL) || (pFontAtlas->pFont != pfont))
+  {
+    return LCD_ERROR;
+  }
   
-  if (x2 >= x1)                 /* The x-values are increasing */
+  pglyph = FONT_AtlasGetGlyph(pFontAtlas, Ascii);
+  if((pglyph == NULL) || ((Xpos + pfont->Width) > BSP_LCD_GetXSize()) || ((Ypos + pfont->Height) > BSP_LCD_GetYSize()))
   {
-    xinc1 = 1;
-    xinc2 = 1;
+    return LCD_ERROR;
   }
-  else                          /* The x-values are decreasing */
+  
+  if(hLtdcHandler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_RGB565)
   {
-    xinc1 = -1;
-    xinc2 = -1;
+    output_mode = DMA2D_OUTPUT_RGB565;
+    bytes = 2;
+  }
+  else
+  {
+    output_mode = DMA2D_OUTPUT_ARGB8888;
+    bytes = 4;
   }
+  address = hLtdcHandler.LayerCfg[ActiveLayer].FBStartAdress + (bytes * ((Ypos * BSP_LCD_GetXSize()) + Xpos));
   
-  if (y2 >= y1)                 /* The y-values are increasing */
+  if(Setup != 0)
   {
-    yinc1 = 1;
-    yinc2 = 1;
+    input_mode = (pFontAtlas->ColorMode == FONT_ATLAS_A4) ? DMA2D_INPUT_A4 : DMA2D_INPUT_A8;
+    
+    /* Configure the DMA2D Mode, Color Mode and output offset */
+    hDma2dHandler.Init.Mode         = DMA2D_M2M_BLEND;
+    hDma2dHandler.Init.ColorMode    = output_mode;
+    hDma2dHandler.Init.OutputOffset = BSP_LCD_GetXSize() - pfont->Width;
+    
+    /* Foreground Configuration: glyph coverage in the text color */
+    hDma2dHandler.LayerCfg[1].AlphaMode = DMA2D_NO_MODIF_ALPHA;
+    hDma2dHandler.LayerCfg[1].InputAlpha = DrawProp[ActiveLayer].TextColor;
+    hDma2dHandler.LayerCfg[1].InputColorMode = input_mode;
+    hDma2dHandler.LayerCfg[1].InputOffset = 0;
+    
+    /* Background Configuration: back color, the read coverage is replaced */
+    hDma2dHandler.LayerCfg[0].AlphaMode = DMA2D_REPLACE_ALPHA;
+    hDma2dHandler.LayerCfg[0].InputAlpha = DrawProp[ActiveLayer].BackColor;
+    hDma2dHandler.LayerCfg[0].InputColorMode = input_mode;
+    hDma2dHandler.LayerCfg[0].InputOffset = 0;
+    
+    hDma2dHandler.Instance = DMA2D;
+    
+    /* DMA2D Initialization */
+    if((HAL_DMA2D_Init(&hDma2dHandler) != HAL_OK) ||
+       (HAL_DMA2D_ConfigLayer(&hDma2dHandler, 0) != HAL_OK) ||
+       (HAL_DMA2D_ConfigLayer(&hDma2dHandler, 1) != HAL_OK))
+    {
+      return LCD_ERROR;
+    }
   }
-  else                          /* The y-values are decreasing */
+  
+  if(HAL_DMA2D_BlendingStart(&hDma2dHandler, (uint32_t)pglyph, (uint32_t)pglyph, address, pfont->Width, pfont->Height) != HAL_OK)
   {
-    yinc1 = -1;
-    yinc2 = -1;
+    return LCD_ERROR;
   }
   
-  if (deltax >= deltay)         /* There is at least one x-value for every y-value */
+  /* Polling For DMA transfer */
+  HAL_DMA2D_PollForTransfer(&hDma2dHandler, 10);
+  
+  return LCD_OK;
+}
+
+/**
+  * @brief  Waits until the presented frame is shown.
+  * @retval LCD_OK, or LCD_TIMEOUT when no vertical blanking occurred
+  */
+static uint8_t LL_PresentWait(void)
+{
+  uint32_t tickstart = HAL_GetTick();
+  
+  while(BSP_LCD_IsPresentPending() != 0)
   {
-    xinc1 = 0;                  /* Don't change the x when numerator >= denominator */
-    yinc2 = 0;                  /* Don't change the y for every iteration */
-    den = deltax;
-    num = deltax / 2;
-    num_add = deltay;
-    num_pixels = deltax;         /* There are more x-values than y-values */
+    if((HAL_GetTick() - tickstart) > 100)
+    {
+      return LCD_TIMEOUT;
+    }
   }
-  else                          /* There is at least one y-value for every x-value */
+  
+  return LCD_OK;
+}
+
+/**
+  * @brief  Starts a filled shape: DMA2D is configured once in register to memory
+  *         mode with the text color, for all the rectangles of the shape.
+  * @retval LCD_OK if DMA2D is configured
+  */
+static uint8_t LL_SpanBegin(void)
+{
+  SpanHeight = 0;
+  SpanBusy   = 0;
+  
+  hDma2dHandler.Init.Mode         = DMA2D_R2M;
+  if(hLtdcHandler.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_RGB565)
+  { /* RGB565 format */ 
+    hDma2dHandler.Init.ColorMode  = DMA2D_RGB565;
+    SpanPixelSize = 2;
+  }
+  else
+  { /* ARGB8888 format */
+    hDma2dHandler.Init.ColorMode  = DMA2D_ARGB8888;
+    SpanPixelSize = 4;
+  }
+  hDma2dHandler.Init.OutputOffset = 0;
+  
+  hDma2dHandler.Instance = DMA2D;
+  
+  if(HAL_DMA2D_Init(&hDma2dHandler) != HAL_OK)
   {
-    xinc2 = 0;                  /* Don't change the x for every iteration */
-    yinc1 = 0;                  /* Don't change the y when numerator >= denominator */
-    den = deltay;
-    num = deltay / 2;
-    num_add = deltax;
-    num_pixels = deltay;         /* There are more y-values than x-values */
+    return LCD_ERROR;
+  }
+  if(HAL_DMA2D_ConfigLayer(&hDma2dHandler, ActiveLayer) != HAL_OK)
+  {
+    return LCD_ERROR;
+  }
+  return LCD_OK;
+}
+
+/**
+  * @brief  Adds a span of a filled shape. It is merged in the rectangle not filled
+  *         yet when it extends it on the same row or on the row below.
+  * @param  x1: First pixel X position
+  * @param  x2: Last pixel X position
+  * @param  y: Row, the span is clipped to the layer
+  * @retval None
+  */
+static void LL_SpanAdd(int32_t x1, int32_t x2, int32_t y)
+{
+  if(x1 < 0)
+  {
+    x1 = 0;
+  }
+  if(x2 >= (int32_t)BSP_LCD_GetXSize())
+  {
+    x2 = (int32_t)BSP_LCD_GetXSize() - 1;
   }
   
-  for (curpixel = 0; curpixel <= num_pixels; curpixel++)
+  if((x1 > x2) || (y < 0) || (y >= (int32_t)BSP_LCD_GetYSize()))
+  {
+    return;
+  }
+  
+  if((SpanHeight != 0) && (SpanX == (uint32_t)x1) && (SpanWidth == (uint32_t)(x2 - x1 + 1)) &&
+     ((SpanY + SpanHeight) == (uint32_t)y))
+  { /* Same span on the row below */
+    SpanHeight++;
+  }
+  else if((SpanHeight == 1) && (SpanY == (uint32_t)y) && ((SpanX + SpanWidth) == (uint32_t)x1))
+  { /* Span next to it on the same row */
+    SpanWidth += (uint32_t)(x2 - x1 + 1);
+  }
+  else
+  {
+    LL_SpanFlush();
+    SpanX      = (uint32_t)x1;
+    SpanY      = (uint32_t)y;
+    SpanWidth  = (uint32_t)(x2 - x1 + 1);
+    SpanHeight = 1;
+  }
+}
+
+/**
+  * @brief  Starts the DMA2D fill of the rectangle of the merged spans. It runs
+  *         while the next spans are computed, only the previous fill is waited for.
+  * @retval None
+  */
+static void LL_SpanFlush(void)
+{
+  uint32_t address = 0;
+  
+  if(SpanHeight != 0)
   {
-    BSP_LCD_DrawLine(x, y, x3, y3);
+    address = hLtdcHandler.LayerCfg[ActiveLayer].FBStartAdress + SpanPixelSize*(BSP_LCD_GetXSize()*SpanY + SpanX);
     
-    num += num_add;              /* Increase the numerator by the top of the fraction */
-    if (num >= den)             /* Check if numerator >= denominator */
+    if(SpanBusy != 0)
     {
-      num -= den;               /* Calculate the new numerator value */
-      x += xinc1;               /* Change the x as appropriate */
-      y += yinc1;               /* Change the y as appropriate */
+      HAL_DMA2D_PollForTransfer(&hDma2dHandler, 10);
+      SpanBusy = 0;
     }
-    x += xinc2;                 /* Change the x as appropriate */
-    y += yinc2;                 /* Change the y as appropriate */
-  } 
+    
+    /* Only the output offset changes in the DMA2D configuration */
+    MODIFY_REG(hDma2dHandler.Instance->OOR, DMA2D_OOR_LO, (BSP_LCD_GetXSize() - SpanWidth));
+    
+    if(HAL_DMA2D_Start(&hDma2dHandler, DrawProp[ActiveLayer].TextColor, address, SpanWidth, SpanHeight) == HAL_OK)
+    {
+      SpanBusy = 1;
+    }
+    SpanHeight = 0;
+  }
+}
+
+/**
+  * @brief  Ends a filled shape once its last rectangle is filled.
+  * @retval None
+  */
+static void LL_SpanEnd(void)
+{
+  LL_SpanFlush();
+  
+  if(SpanBusy != 0)
+  {
+    /* Polling For DMA transfer */  
+    HAL_DMA2D_PollForTransfer(&hDma2dHandler, 10);
+    SpanBusy = 0;
+  }
 }
 
 /**
@@ -1608,22 +2164,52 @@ static void LL_FillBuffer(uint32_t LayerIndex, void *pDst, uint32_t xSize, uint3
 }
 
 /**
-  * @brief  Converts a line to an ARGB8888 pixel format.
-  * @param  pSrc: Pointer to source buffer
-  * @param  pDst: Output color
-  * @param  xSize: Buffer width
-  * @param  ColorMode: Input color mode   
-  * @retval None
+  * @brief  Gets the pixel size of the active layer.
+  * @retval Bytes per pixel, 0 if the pixel format is not a DMA2D output format
   */
-static void LL_ConvertLineToARGB8888(void *pSrc, void *pDst, uint32_t xSize, uint32_t ColorMode)
-{    
+static uint32_t LL_GetPixelSize(void)
+{
+  switch(hLtdcHandler.LayerCfg[ActiveLayer].PixelFormat)
+  {
+  case LTDC_PIXEL_FORMAT_ARGB8888:
+    return 4;
+  case LTDC_PIXEL_FORMAT_RGB888:
+    return 3;
+  case LTDC_PIXEL_FORMAT_RGB565:
+  case LTDC_PIXEL_FORMAT_ARGB1555:
+  case LTDC_PIXEL_FORMAT_ARGB4444:
+    return 2;
+  default:
+    return 0;
+  }
+}
+
+/**
+  * @brief  Configures DMA2D to convert pictures to the active layer pixel format.
+  * @note   LTDC pixel formats ARGB8888 to ARGB4444 have the value of the
+  *         matching DMA2D output color modes.
+  * @param  ColorMode: Input color mode
+  * @param  AlphaMode: Input alpha mode, DMA2D_NO_MODIF_ALPHA or DMA2D_REPLACE_ALPHA (opaque)
+  * @param  OutputOffset: Output line offset in pixels
+  * @param  pClut: ARGB8888 color look-up table of 256 entries, NULL if none
+  * @retval LCD_OK or LCD_ERROR
+  */
+static uint8_t LL_ConvertInit(uint32_t ColorMode, uint32_t AlphaMode, uint32_t OutputOffset, uint32_t *pClut)
+{
+  DMA2D_CLUTCfgTypeDef clut_cfg;
+
+  if(LL_GetPixelSize() == 0)
+  {
+    return LCD_ERROR;
+  }
+
   /* Configure the DMA2D Mode, Color Mode and output offset */
   hDma2dHandler.Init.Mode         = DMA2D_M2M_PFC;
-  hDma2dHandler.Init.ColorMode    = DMA2D_ARGB8888;
-  hDma2dHandler.Init.OutputOffset = 0;     
+  hDma2dHandler.Init.ColorMode    = hLtdcHandler.LayerCfg[ActiveLayer].PixelFormat;
+  hDma2dHandler.Init.OutputOffset = OutputOffset;
   
   /* Foreground Configuration */
-  hDma2dHandler.LayerCfg[1].AlphaMode = DMA2D_NO_MODIF_ALPHA;
+  hDma2dHandler.LayerCfg[1].AlphaMode = AlphaMode;
   hDma2dHandler.LayerCfg[1].InputAlpha = 0xFF;
   hDma2dHandler.LayerCfg[1].InputColorMode = ColorMode;
   hDma2dHandler.LayerCfg[1].InputOffset = 0;
@@ -1631,17 +2217,155 @@ static void LL_ConvertLineToARGB8888(void *pSrc, void *pDst, uint32_t xSize, uin
   hDma2dHandler.Instance = DMA2D; 
   
   /* DMA2D Initialization */
-  if(HAL_DMA2D_Init(&hDma2dHandler) == HAL_OK) 
+  if((HAL_DMA2D_Init(&hDma2dHandler) != HAL_OK) ||
+     (HAL_DMA2D_ConfigLayer(&hDma2dHandler, 1) != HAL_OK))
+  {
+    return LCD_ERROR;
+  }
+
+  /* Load the color look-up table once for the whole picture */
+  if(pClut != NULL)
+  {
+    clut_cfg.pCLUT         = pClut;
+    clut_cfg.CLUTColorMode = DMA2D_CCM_ARGB8888;
+    clut_cfg.Size          = 255;
+    if((HAL_DMA2D_CLUTLoad(&hDma2dHandler, clut_cfg, 1) != HAL_OK) ||
+       (HAL_DMA2D_PollForTransfer(&hDma2dHandler, 10) != HAL_OK))
+    {
+      return LCD_ERROR;
+    }
+  }
+
+  return LCD_OK;
+}
+
+/**
+  * @brief  Reads exactly Size bytes from a picture stream.
+  * @param  Read: Sequential read function
+  * @param  pContext: Parameter given to Read
+  * @param  pBuffer: Pointer to destination buffer
+  * @param  Size: Number of bytes
+  * @retval LCD_OK or LCD_ERROR (end of stream)
+  */
+static uint8_t LL_StreamRead(LCD_StreamReadTypeDef Read, void *pContext, uint8_t *pBuffer, uint32_t Size)
+{
+  uint32_t count;
+
+  while(Size > 0)
   {
-    if(HAL_DMA2D_ConfigLayer(&hDma2dHandler, 1) == HAL_OK) 
+    count = Read(pContext, pBuffer, Size);
+    if((count == 0) || (count > Size))
     {
-      if (HAL_DMA2D_Start(&hDma2dHandler, (uint32_t)pSrc, (uint32_t)pDst, xSize, 1) == HAL_OK)
+      return LCD_ERROR;
+    }
+    pBuffer += count;
+    Size -= count;
+  }
+
+  return LCD_OK;
+}
+
+/**
+  * @brief  Reads the picture lines in batches and converts each batch with one
+  *         DMA2D transfer, the next batch being read during the transfer.
+  * @note   DMA2D must be configured by LL_ConvertInit().
+  * @param  Xpos: Picture X position in the LCD
+  * @param  Ypos: Picture Y position in the LCD
+  * @param  Width: Picture width
+  * @param  Height: Picture height
+  * @param  PixelSize: Input bytes per pixel
+  * @param  Padding: Bytes skipped at the end of each input line
+  * @param  BottomUp: 1 if the last line of the picture comes first
+  * @param  Read: Sequential read function
+  * @param  pContext: Parameter given to Read
+  * @retval LCD_OK or LCD_ERROR
+  */
+static uint8_t LL_StreamImage(uint32_t Xpos, uint32_t Ypos, uint32_t Width, uint32_t Height, uint32_t PixelSize,
+                              uint32_t Padding, uint32_t BottomUp, LCD_StreamReadTypeDef Read, void *pContext)
+{
+  uint32_t line_size = Width * PixelSize;
+  uint32_t batch_lines = (LCD_STREAM_BUFFER_SIZE / 2) / line_size;
+  uint32_t done = 0, count, index, line, address, half = 0, pending = 0;
+  uint8_t  *pbuffer;
+  uint8_t  pad[4];
+  uint8_t  status = LCD_OK;
+
+  /* At least one line in each half of the staging buffer */
+  if(batch_lines == 0)
+  {
+    return LCD_ERROR;
+  }
+
+  while(done < Height)
+  {
+    count = ((Height - done) < batch_lines) ? (Height - done) : batch_lines;
+    pbuffer = &StreamBuffer[half * (LCD_STREAM_BUFFER_SIZE / 2)];
+
+    if((Padding == 0) && (BottomUp == 0))
+    {
+      status = LL_StreamRead(Read, pContext, pbuffer, count * line_size);
+    }
+    else
+    {
+      /* Bottom-up lines are stored in reverse order so that a single
+         transfer writes the batch top-down */
+      for(index = 0; (index < count) && (status == LCD_OK); index++)
       {
-        /* Polling For DMA transfer */  
-        HAL_DMA2D_PollForTransfer(&hDma2dHandler, 10);
+        line = (BottomUp != 0) ? (count - 1 - index) : index;
+        status = LL_StreamRead(Read, pContext, &pbuffer[line * line_size], line_size);
+        if((status == LCD_OK) && (Padding != 0))
+        {
+          status = LL_StreamRead(Read, pContext, pad, Padding);
+        }
       }
     }
-  } 
+
+    /* Wait for the previous batch */
+    if(pending != 0)
+    {
+      pending = 0;
+      if(HAL_DMA2D_PollForTransfer(&hDma2dHandler, 100) != HAL_OK)
+      {
+        status = LCD_ERROR;
+      }
+    }
+    if(status != LCD_OK)
+    {
+      break;
+    }
+
+    /* Display line of the first buffered line */
+    line = (BottomUp != 0) ? (Ypos + Height - done - count) : (Ypos + done);
+    address = hLtdcHandler.LayerCfg[ActiveLayer].FBStartAdress + (LL_GetPixelSize() * ((BSP_LCD_GetXSize() * line) + Xpos));
+
+#if (__DCACHE_PRESENT == 1U)
+    /* Lines written by the CPU must reach the memory before DMA2D reads them */
+    if((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+    {
+      SCB_CleanDCache_by_Addr((uint32_t *)pbuffer, count * line_size);
+    }
+#endif
+
+    if(HAL_DMA2D_Start(&hDma2dHandler, (uint32_t)pbuffer, address, Width, count) != HAL_OK)
+    {
+      status = LCD_ERROR;
+      break;
+    }
+    pending = 1;
+
+    done += count;
+    half ^= 1;
+  }
+
+  if(pending != 0)
+  {
+    if(HAL_DMA2D_PollForTransfer(&hDma2dHandler, 100) != HAL_OK)
+    {
+      status = LCD_ERROR;
+    }
+  }
+
+  return status;
 }
 
 /**
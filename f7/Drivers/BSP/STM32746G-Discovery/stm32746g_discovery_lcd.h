@@ -91,6 +91,12 @@ typedef enum
   LEFT_MODE               = 0x03     /* Left mode   */
 }Text_AlignModeTypdef;
 
+/** 
+  * @brief  Picture stream read function : reads up to Size bytes in pBuffer and
+  *         returns the number of bytes read, 0 at the end of the stream or on error
+  */ 
+typedef uint32_t (*LCD_StreamReadTypeDef)(void *pContext, uint8_t *pBuffer, uint32_t Size);
+
 /**
   * @}
   */ 
@@ -110,6 +116,26 @@ typedef enum
 #define LCD_ERROR              ((uint8_t)0x01)
 #define LCD_TIMEOUT            ((uint8_t)0x02)
 
+/** 
+  * @brief  Maximum number of frame buffers of the frame presentation  
+  */
+#define LCD_PRESENT_MAX_BUFFERS  3
+
+/** 
+  * @brief  Picture stream staging buffer size in bytes, multiple of 64. Each half
+  *         holds at least one picture line and a BMP header with its palette.
+  */
+#if !defined(LCD_STREAM_BUFFER_SIZE)
+#define LCD_STREAM_BUFFER_SIZE   8192
+#endif
+
+/** 
+  * @brief  Maximum number of points of the polygons filled by BSP_LCD_FillPolygon()
+  */
+#if !defined(LCD_POLYGON_MAX_POINTS)
+#define LCD_POLYGON_MAX_POINTS   64
+#endif
+
 /** 
   * @brief  LCD FB_StartAddress  
   */
@@ -193,6 +219,9 @@ void     BSP_LCD_SetTransparency(uint32_t LayerIndex, uint8_t Transparency);
 void     BSP_LCD_SetTransparency_NoReload(uint32_t LayerIndex, uint8_t Transparency);
 void     BSP_LCD_SetLayerAddress(uint32_t LayerIndex, uint32_t Address);
 void     BSP_LCD_SetLayerAddress_NoReload(uint32_t LayerIndex, uint32_t Address);
+uint8_t  BSP_LCD_PresentInit(uint32_t LayerIndex, uint32_t *pAddress, uint32_t Count);
+uint32_t BSP_LCD_Present(void);
+uint8_t  BSP_LCD_IsPresentPending(void);
 void     BSP_LCD_SetColorKeying(uint32_t LayerIndex, uint32_t RGBValue);
 void     BSP_LCD_SetColorKeying_NoReload(uint32_t LayerIndex, uint32_t RGBValue);
 void     BSP_LCD_ResetColorKeying(uint32_t LayerIndex);
@@ -217,6 +246,7 @@ void     BSP_LCD_Clear(uint32_t Color);
 void     BSP_LCD_ClearStringLine(uint32_t Line);
 void     BSP_LCD_DisplayStringAtLine(uint16_t Line, uint8_t *ptr);
 void     BSP_LCD_DisplayStringAt(uint16_t Xpos, uint16_t Ypos, uint8_t *Text, Text_AlignModeTypdef Mode);
+void     BSP_LCD_SetFontAtlas(FONT_AtlasTypeDef *pAtlas);
 void     BSP_LCD_DisplayChar(uint16_t Xpos, uint16_t Ypos, uint8_t Ascii);
 
 void     BSP_LCD_DrawHLine(uint16_t Xpos, uint16_t Ypos, uint16_t Length);
@@ -227,6 +257,9 @@ void     BSP_LCD_DrawCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius);
 void     BSP_LCD_DrawPolygon(pPoint Points, uint16_t PointCount);
 void     BSP_LCD_DrawEllipse(int Xpos, int Ypos, int XRadius, int YRadius);
 void     BSP_LCD_DrawBitmap(uint32_t Xpos, uint32_t Ypos, uint8_t *pbmp);
+uint8_t  BSP_LCD_DrawBitmapStream(uint32_t Xpos, uint32_t Ypos, LCD_StreamReadTypeDef Read, void *pContext);
+uint8_t  BSP_LCD_DrawImageStream(uint32_t Xpos, uint32_t Ypos, uint32_t Width, uint32_t Height, uint32_t ColorMode,
+                                 uint32_t *pClut, LCD_StreamReadTypeDef Read, void *pContext);
 
 void     BSP_LCD_FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
 void     BSP_LCD_FillCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius);
@@ -501,6 +501,29 @@ uint8_t BSP_SD_GetCardState(void)
 {
   return((HAL_SD_GetCardState(&uSdHandle) == HAL_SD_CARD_TRANSFER ) ? SD_TRANSFER_OK : SD_TRANSFER_BUSY);
 }
+
+/**
+  * @brief  Waits for the end of the card programming without blocking, 
+  *         BSP_SD_CardReadyCallback() is called when the card is ready.
+  * @retval SD status
+  */
+uint8_t BSP_SD_WaitCardReady_IT(void)
+{
+  return((HAL_SD_WaitCardReady_IT(&uSdHandle) == HAL_OK) ? MSD_OK : MSD_ERROR);
+}
+
+/**
+  * @brief  Checks once the end of the card programming waited for by 
+  *         BSP_SD_WaitCardReady_IT(). To be called from a periodic timer.
+  * @retval Data transfer state.
+  *          This value can be one of the following values:
+  *            @arg  SD_TRANSFER_OK: Card ready, BSP_SD_CardReadyCallback() called
+  *            @arg  SD_TRANSFER_BUSY: Card still programming
+  */
+uint8_t BSP_SD_PollCardReady(void)
+{
+  return((HAL_SD_PollCardReady(&uSdHandle) == HAL_OK) ? SD_TRANSFER_OK : SD_TRANSFER_BUSY);
+}
   
 
 /**
@@ -544,6 +567,16 @@ void HAL_SD_RxCpltCallback(SD_HandleTypeDef *hsd)
   BSP_SD_ReadCpltCallback();
 }
 
+/**
+  * @brief Card ready callbacks
+  * @param hsd: SD handle
+  * @retval None
+  */
+void HAL_SD_CardReadyCallback(SD_HandleTypeDef *hsd)
+{
+  BSP_SD_CardReadyCallback();
+}
+
 /**
   * @brief BSP SD Abort callbacks
   * @retval None
@@ -571,6 +604,15 @@ __weak void BSP_SD_ReadCpltCallback(void)
 
 }
 
+/**
+  * @brief BSP Card ready callbacks
+  * @retval None
+  */
+__weak void BSP_SD_CardReadyCallback(void)
+{
+
+}
+
 /**
   * @}
   */ 
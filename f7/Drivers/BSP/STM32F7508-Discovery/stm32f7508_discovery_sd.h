@@ -109,6 +109,8 @@ uint8_t BSP_SD_ReadBlocks_DMA(uint32_t *pData, uint32_t ReadAddr, uint32_t NumOf
 uint8_t BSP_SD_WriteBlocks_DMA(uint32_t *pData, uint32_t WriteAddr, uint32_t NumOfBlocks);
 uint8_t BSP_SD_Erase(uint32_t StartAddr, uint32_t EndAddr);
 uint8_t BSP_SD_GetCardState(void);
+uint8_t BSP_SD_WaitCardReady_IT(void);
+uint8_t BSP_SD_PollCardReady(void);
 void    BSP_SD_GetCardInfo(HAL_SD_CardInfoTypeDef *CardInfo);
 uint8_t BSP_SD_IsDetected(void);
 
@@ -120,6 +122,7 @@ void    BSP_SD_MspDeInit(SD_HandleTypeDef *hsd, void *Params);
 void    BSP_SD_AbortCallback(void);
 void    BSP_SD_WriteCpltCallback(void);
 void    BSP_SD_ReadCpltCallback(void);
+void    BSP_SD_CardReadyCallback(void);
 /**
   * @}
   */ 
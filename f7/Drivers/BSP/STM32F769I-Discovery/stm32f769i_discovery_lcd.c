@@ -68,6 +68,21 @@
      o Draw and fill a basic shapes (dot, line, rectangle, circle, ellipse, .. bitmap)
        on LCD using the available set of functions.
 
+  + Adapted command mode (USE_LCD_DSI_CMD_MODE defined)
+     o The LCD is driven in DSI adapted command mode : the panel keeps the image
+       in its own memory and the frame buffer is only sent on demand, on the
+       tearing effect signal (DSI_TE pin PJ2), so that the transfer never
+       overtakes the panel scan.
+     o Call BSP_LCD_Refresh() to send the whole frame buffer, or
+       BSP_LCD_RefreshRect() to send only an area of it : the panel memory
+       window, the LTDC active area and the layers are narrowed to the area.
+     o Or report the areas modified with BSP_LCD_InvalidateRect() and call
+       BSP_LCD_RefreshDirty() to refresh their bounding box.
+     o The frame buffer must not be modified in the area being sent until
+       BSP_LCD_IsFrameBufferAvailable() returns LCD_OK.
+     o Layer windows must cover the whole display. The HDMI output is not
+       supported in this mode.
+
 ------------------------------------------------------------------------------*/
 
 /* Dependencies
@@ -122,6 +137,9 @@ EndDependencies */
 #define LCD_DSI_ID_REG          0xA8
 
 static DSI_VidCfgTypeDef hdsivideo_handle;
+#if defined(USE_LCD_DSI_CMD_MODE)
+static DSI_CmdCfgTypeDef hdsicmd_handle;
+#endif /* USE_LCD_DSI_CMD_MODE */
 /**
   * @}
   */
@@ -247,6 +265,27 @@ static uint32_t  ActiveLayer = LTDC_ACTIVE_LAYER_BACKGROUND;
   * @brief  Current Drawing Layer properties variable
   */
 static LCD_DrawPropTypeDef DrawProp[LTDC_MAX_LAYER_NUMBER];
+static FONT_AtlasTypeDef   *pFontAtlas = NULL;
+
+/* Frame presentation state, the buffers are indexes in PresentAddress[] */
+#define LCD_PRESENT_NONE           0xFFFFFFFFU
+static uint32_t            PresentAddress[LCD_PRESENT_MAX_BUFFERS];
+static uint32_t            PresentCount = 0;
+static uint32_t            PresentLayer = 0;
+static uint32_t            PresentFront = 0;
+static uint32_t            PresentPending = LCD_PRESENT_NONE;
+static uint32_t            PresentBack = 0;
+
+#if defined(USE_LCD_DSI_CMD_MODE)
+/* Frame buffer available (1) or being sent to the panel (0) */
+static __IO uint32_t       FrameBufferAvailable = 1;
+/* Refresh requested, started on the next tearing effect */
+static __IO uint32_t       RefreshPending = 0;
+/* Panel memory window of the last refresh : X, Y, width and height */
+static uint16_t            RefreshArea[4];
+/* Bounding box of the invalidated areas : X0, Y0, X1, Y1 (excluded), empty if X1 = 0 */
+static uint16_t            DirtyArea[4];
+#endif /* USE_LCD_DSI_CMD_MODE */
 /**
   * @}
   */
@@ -255,10 +294,15 @@ static LCD_DrawPropTypeDef DrawProp[LTDC_MAX_LAYER_NUMBER];
   * @{
   */
 static void DrawChar(uint16_t Xpos, uint16_t Ypos, const uint8_t *c);
+static uint8_t LL_DrawGlyph(uint16_t Xpos, uint16_t Ypos, uint8_t Ascii, uint8_t Setup);
+static uint8_t LL_PresentWait(void);
 static void FillTriangle(uint16_t x1, uint16_t x2, uint16_t x3, uint16_t y1, uint16_t y2, uint16_t y3);
 static void LL_FillBuffer(uint32_t LayerIndex, void *pDst, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint32_t ColorIndex);
 static void LL_ConvertLineToARGB8888(void * pSrc, void *pDst, uint32_t xSize, uint32_t ColorMode);
 static uint16_t LCD_IO_GetID(void);
+#if defined(USE_LCD_DSI_CMD_MODE)
+static void LCD_SetRefreshArea(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
+#endif /* USE_LCD_DSI_CMD_MODE */
 /**
   * @}
   */
@@ -292,6 +336,9 @@ uint8_t BSP_LCD_InitEx(LCD_OrientationTypeDef orientation)
   static RCC_PeriphCLKInitTypeDef  PeriphClkInitStruct;
   uint32_t LcdClock  = 27429; /*!< LcdClk = 27429 kHz */
   uint16_t read_id = 0;
+#if defined(USE_LCD_DSI_CMD_MODE)
+  DSI_LPCmdTypeDef LPCmd;
+#endif /* USE_LCD_DSI_CMD_MODE */
 
   uint32_t laneByteClk_kHz = 0;
   uint32_t                   VSA; /*!< Vertical start active time in units of lines */
@@ -380,6 +427,38 @@ uint8_t BSP_LCD_InitEx(LCD_OrientationTypeDef orientation)
   HBP  = OTM8009A_480X800_HBP;          /* 120 */
   HFP  = OTM8009A_480X800_HFP;          /* 120 */   
 
+#if defined(USE_LCD_DSI_CMD_MODE)
+  hdsicmd_handle.VirtualChannelID      = LCD_OTM8009A_ID;
+  hdsicmd_handle.ColorCoding           = LCD_DSI_PIXEL_DATA_FMT_RBG888;
+  hdsicmd_handle.CommandSize           = HACT; /* One write memory command per line */
+  hdsicmd_handle.TearingEffectSource   = DSI_TE_EXTERNAL; /* DSI_TE pin */
+  hdsicmd_handle.TearingEffectPolarity = DSI_TE_RISING_EDGE;
+  hdsicmd_handle.HSPolarity            = DSI_HSYNC_ACTIVE_LOW;
+  hdsicmd_handle.VSPolarity            = DSI_VSYNC_ACTIVE_LOW;
+  hdsicmd_handle.DEPolarity            = DSI_DATA_ENABLE_ACTIVE_HIGH;
+  hdsicmd_handle.VSyncPol              = DSI_VSYNC_FALLING;
+  hdsicmd_handle.AutomaticRefresh      = DSI_AR_DISABLE; /* Refresh started on tearing effect interrupt */
+  hdsicmd_handle.TEAcknowledgeRequest  = DSI_TE_ACKNOWLEDGE_DISABLE;
+
+  /* Configure DSI adapted command mode, enables tearing effect and end of refresh interrupts */
+  HAL_DSI_ConfigAdaptedCommandMode(&hdsi_discovery, &hdsicmd_handle);
+
+  /* OTM8009A initialization commands are sent in LP mode */
+  LPCmd.LPGenShortWriteNoP    = DSI_LP_GSW0P_ENABLE;
+  LPCmd.LPGenShortWriteOneP   = DSI_LP_GSW1P_ENABLE;
+  LPCmd.LPGenShortWriteTwoP   = DSI_LP_GSW2P_ENABLE;
+  LPCmd.LPGenShortReadNoP     = DSI_LP_GSR0P_ENABLE;
+  LPCmd.LPGenShortReadOneP    = DSI_LP_GSR1P_ENABLE;
+  LPCmd.LPGenShortReadTwoP    = DSI_LP_GSR2P_ENABLE;
+  LPCmd.LPGenLongWrite        = DSI_LP_GLW_ENABLE;
+  LPCmd.LPDcsShortWriteNoP    = DSI_LP_DSW0P_ENABLE;
+  LPCmd.LPDcsShortWriteOneP   = DSI_LP_DSW1P_ENABLE;
+  LPCmd.LPDcsShortReadNoP     = DSI_LP_DSR0P_ENABLE;
+  LPCmd.LPDcsLongWrite        = DSI_LP_DLW_ENABLE;
+  LPCmd.LPMaxReadPacket       = DSI_LP_MRDP_ENABLE;
+  LPCmd.AcknowledgeRequest    = DSI_ACKNOWLEDGE_DISABLE;
+  HAL_DSI_ConfigCommand(&hdsi_discovery, &LPCmd);
+#else
   hdsivideo_handle.VirtualChannelID = LCD_OTM8009A_ID;
   hdsivideo_handle.ColorCoding = LCD_DSI_PIXEL_DATA_FMT_RBG888;
   hdsivideo_handle.VSPolarity = DSI_VSYNC_ACTIVE_HIGH;
@@ -419,6 +498,7 @@ uint8_t BSP_LCD_InitEx(LCD_OrientationTypeDef orientation)
 
   /* Configure DSI Video mode timings with settings set above */
   HAL_DSI_ConfigVideoMode(&(hdsi_discovery), &(hdsivideo_handle));
+#endif /* USE_LCD_DSI_CMD_MODE */
 
 /*************************End DSI Initialization*******************************/ 
   
@@ -426,10 +506,22 @@ uint8_t BSP_LCD_InitEx(LCD_OrientationTypeDef orientation)
 /************************LTDC Initialization***********************************/  
 
   /* Timing Configuration */    
+#if defined(USE_LCD_DSI_CMD_MODE)
+  /* Minimal blanking, the panel is timed by its own oscillator */
+  hltdc_discovery.Init.HorizontalSync = 0;
+  hltdc_discovery.Init.AccumulatedHBP = 1;
+  hltdc_discovery.Init.AccumulatedActiveW = (lcd_x_size + 1);
+  hltdc_discovery.Init.TotalWidth = (lcd_x_size + 2);
+  hltdc_discovery.Init.VerticalSync = 0;
+  hltdc_discovery.Init.AccumulatedVBP = 1;
+  hltdc_discovery.Init.AccumulatedActiveH = (lcd_y_size + 1);
+  hltdc_discovery.Init.TotalHeigh = (lcd_y_size + 2);
+#else
   hltdc_discovery.Init.HorizontalSync = (HSA - 1);
   hltdc_discovery.Init.AccumulatedHBP = (HSA + HBP - 1);
   hltdc_discovery.Init.AccumulatedActiveW = (lcd_x_size + HSA + HBP - 1);
   hltdc_discovery.Init.TotalWidth = (lcd_x_size + HSA + HBP + HFP - 1);
+#endif /* USE_LCD_DSI_CMD_MODE */
 
   /* Initialize the LCD pixel width and pixel height */
   hltdc_discovery.LayerCfg->ImageWidth  = lcd_x_size;
@@ -457,7 +549,11 @@ uint8_t BSP_LCD_InitEx(LCD_OrientationTypeDef orientation)
   hltdc_discovery.Instance = LTDC;
 
   /* Get LTDC Configuration from DSI Configuration */
+#if defined(USE_LCD_DSI_CMD_MODE)
+  HAL_LTDC_StructInitFromAdaptedCommandConfig(&(hltdc_discovery), &(hdsicmd_handle));
+#else
   HAL_LTDC_StructInitFromVideoConfig(&(hltdc_discovery), &(hdsivideo_handle));
+#endif /* USE_LCD_DSI_CMD_MODE */
 
   /* Initialize the LTDC */  
   HAL_LTDC_Init(&hltdc_discovery);
@@ -484,6 +580,37 @@ uint8_t BSP_LCD_InitEx(LCD_OrientationTypeDef orientation)
   */
   OTM8009A_Init(OTM8009A_FORMAT_RGB888, orientation);
 
+#if defined(USE_LCD_DSI_CMD_MODE)
+  /* Tearing effect output on the DSI_TE pin, vertical blanking only */
+  HAL_DSI_ShortWrite(&hdsi_discovery, LCD_OTM8009A_ID, DSI_DCS_SHORT_PKT_WRITE_P1,
+                     OTM8009A_CMD_TEEON, OTM8009A_TEEON_TELOM_VBLANKING_INFO_ONLY);
+
+  /* Frame buffer transfers in HS mode */
+  LPCmd.LPGenShortWriteNoP    = DSI_LP_GSW0P_DISABLE;
+  LPCmd.LPGenShortWriteOneP   = DSI_LP_GSW1P_DISABLE;
+  LPCmd.LPGenShortWriteTwoP   = DSI_LP_GSW2P_DISABLE;
+  LPCmd.LPGenShortReadNoP     = DSI_LP_GSR0P_DISABLE;
+  LPCmd.LPGenShortReadOneP    = DSI_LP_GSR1P_DISABLE;
+  LPCmd.LPGenShortReadTwoP    = DSI_LP_GSR2P_DISABLE;
+  LPCmd.LPGenLongWrite        = DSI_LP_GLW_DISABLE;
+  LPCmd.LPDcsShortWriteNoP    = DSI_LP_DSW0P_DISABLE;
+  LPCmd.LPDcsShortWriteOneP   = DSI_LP_DSW1P_DISABLE;
+  LPCmd.LPDcsShortReadNoP     = DSI_LP_DSR0P_DISABLE;
+  LPCmd.LPDcsLongWrite        = DSI_LP_DLW_DISABLE;
+  LPCmd.LPMaxReadPacket       = DSI_LP_MRDP_DISABLE;
+  HAL_DSI_ConfigCommand(&hdsi_discovery, &LPCmd);
+  HAL_DSI_ConfigFlowControl(&hdsi_discovery, DSI_FLOW_CONTROL_BTA);
+
+  /* Panel memory window set to the whole display by OTM8009A_Init() */
+  RefreshArea[0] = 0;
+  RefreshArea[1] = 0;
+  RefreshArea[2] = lcd_x_size;
+  RefreshArea[3] = lcd_y_size;
+  DirtyArea[2] = 0;
+  RefreshPending = 0;
+  FrameBufferAvailable = 1;
+#endif /* USE_LCD_DSI_CMD_MODE */
+
 /***********************End OTM8009A Initialization****************************/ 
 
   return LCD_OK; 
@@ -836,6 +963,113 @@ void BSP_LCD_SetLayerAddress(uint32_t LayerIndex, uint32_t Address)
   
 }
 
+/**
+  * @brief  Starts the frame presentation on a layer, with 2 or 3 frame buffers.
+  * @note   The first buffer is shown and the drawing functions draw in the
+  *         second one, until BSP_LCD_Present() is called. Each buffer holds
+  *         a full screen in the pixel format of the layer.
+  * @note   The layer address held by the LTDC handle is the back buffer: the
+  *         functions reloading the layer configuration immediately must not
+  *         be used on this layer while the presentation runs.
+  * @param  LayerIndex: Layer foreground or background
+  * @param  pAddress: Frame buffer addresses
+  * @param  Count: Number of frame buffers, 2 (double) or 3 (triple buffering)
+  * @retval LCD status
+  */
+uint8_t BSP_LCD_PresentInit(uint32_t LayerIndex, uint32_t *pAddress, uint32_t Count)
+{
+  uint32_t index;
+  
+  if((Count < 2) || (Count > LCD_PRESENT_MAX_BUFFERS))
+  {
+    return LCD_ERROR;
+  }
+  
+  for(index = 0; index < Count; index++)
+  {
+    PresentAddress[index] = pAddress[index];
+  }
+  PresentCount   = Count;
+  PresentLayer   = LayerIndex;
+  PresentFront   = 0;
+  PresentPending = LCD_PRESENT_NONE;
+  PresentBack    = 1;
+  
+  HAL_LTDC_SetAddress(&hltdc_discovery, PresentAddress[PresentFront], PresentLayer);
+  hltdc_discovery.LayerCfg[PresentLayer].FBStartAdress = PresentAddress[PresentBack];
+  
+  return LCD_OK;
+}
+
+/**
+  * @brief  Shows the back buffer at the next vertical blanking and selects the
+  *         buffer the next frame is drawn in.
+  * @note   With triple buffering the call only waits when the previous frame
+  *         is still waiting for its vertical blanking; with double buffering
+  *         it waits until the frame is shown.
+  * @retval Address of the new back buffer, 0 on timeout
+  */
+uint32_t BSP_LCD_Present(void)
+{
+  uint32_t index;
+  
+  /* Only one frame can wait for the vertical blanking */
+  if((PresentCount == 0) || (LL_PresentWait() != LCD_OK))
+  {
+    return 0;
+  }
+
+#if (__DCACHE_PRESENT == 1)
+  /* Write the frame to memory before the LTDC reads it */
+  if((SCB->CCR & SCB_CCR_DC_Msk) != 0)
+  {
+    SCB_CleanDCache_by_Addr((uint32_t *)PresentAddress[PresentBack],
+                            BSP_LCD_GetXSize() * BSP_LCD_GetYSize() *
+                            ((hltdc_discovery.LayerCfg[PresentLayer].PixelFormat == LTDC_PIXEL_FORMAT_RGB565) ? 2 : 4));
+  }
+#endif
+  
+  /* The layer shadow address is loaded by hardware on the vertical blanking */
+  LTDC_LAYER(&hltdc_discovery, PresentLayer)->CFBAR = PresentAddress[PresentBack];
+  hltdc_discovery.Instance->SRCR = LTDC_SRCR_VBR;
+  PresentPending = PresentBack;
+  
+  /* With two buffers, the next back buffer is the one shown until now */
+  if((PresentCount == 2) && (LL_PresentWait() != LCD_OK))
+  {
+    return 0;
+  }
+  
+  /* Draw in a buffer neither shown nor waiting to be shown */
+  for(index = 0; index < PresentCount; index++)
+  {
+    if((index != PresentFront) && (index != PresentPending))
+    {
+      break;
+    }
+  }
+  PresentBack = index;
+  hltdc_discovery.LayerCfg[PresentLayer].FBStartAdress = PresentAddress[PresentBack];
+  
+  return PresentAddress[PresentBack];
+}
+
+/**
+  * @brief  Tells whether a presented frame is still waiting for the vertical
+  *         blanking.
+  * @retval 1 if a frame is pending, 0 otherwise
+  */
+uint8_t BSP_LCD_IsPresentPending(void)
+{
+  if((PresentPending != LCD_PRESENT_NONE) && ((hltdc_discovery.Instance->SRCR & LTDC_SRCR_VBR) == 0))
+  {
+    PresentFront   = PresentPending;
+    PresentPending = LCD_PRESENT_NONE;
+  }
+  
+  return (PresentPending != LCD_PRESENT_NONE) ? 1 : 0;
+}
+
 /**
   * @brief  Sets display window.
   * @param  LayerIndex: Layer index
@@ -992,6 +1226,17 @@ void BSP_LCD_ClearStringLine(uint32_t Line)
   BSP_LCD_SetTextColor(DrawProp[ActiveLayer].TextColor);
 }
 
+/**
+  * @brief  Sets the glyph atlas used to draw the characters of its font.
+  * @note   The characters of the other fonts are still drawn pixel by pixel.
+  * @param  pAtlas: Glyph atlas built by FONT_AtlasInit(), NULL to disable it
+  * @retval None
+  */
+void BSP_LCD_SetFontAtlas(FONT_AtlasTypeDef *pAtlas)
+{
+  pFontAtlas = pAtlas;
+}
+
 /**
   * @brief  Displays one character in currently active layer.
   * @param  Xpos: Start column address
@@ -1001,8 +1246,12 @@ void BSP_LCD_ClearStringLine(uint32_t Line)
   */
 void BSP_LCD_DisplayChar(uint16_t Xpos, uint16_t Ypos, uint8_t Ascii)
 {
-  DrawChar(Xpos, Ypos, &DrawProp[ActiveLayer].pFont->table[(Ascii-' ') *\
-    DrawProp[ActiveLayer].pFont->Height * ((DrawProp[ActiveLayer].pFont->Width + 7) / 8)]);
+  /* Blit the glyph with DMA2D when the font has an atlas, else plot it */
+  if(LL_DrawGlyph(Xpos, Ypos, Ascii, 1) != LCD_OK)
+  {
+    DrawChar(Xpos, Ypos, &DrawProp[ActiveLayer].pFont->table[(Ascii-' ') *\
+      DrawProp[ActiveLayer].pFont->Height * ((DrawProp[ActiveLayer].pFont->Width + 7) / 8)]);
+  }
 }
 
 /**
@@ -1021,6 +1270,7 @@ void BSP_LCD_DisplayStringAt(uint16_t Xpos, uint16_t Ypos, uint8_t *Text, Text_A
   uint16_t refcolumn = 1, i = 0;
   uint32_t size = 0, xsize = 0;
   uint8_t  *ptr = Text;
+  uint8_t  setup = 1;
 
   /* Get the text size */
   while (*ptr++) size ++ ;
@@ -1061,8 +1311,16 @@ void BSP_LCD_DisplayStringAt(uint16_t Xpos, uint16_t Ypos, uint8_t *Text, Text_A
   /* Send the string character by character on LCD */
   while ((*Text != 0) & (((BSP_LCD_GetXSize() - (i*DrawProp[ActiveLayer].pFont->Width)) & 0xFFFF) >= DrawProp[ActiveLayer].pFont->Width))
   {
-    /* Display one character on LCD */
-    BSP_LCD_DisplayChar(refcolumn, Ypos, *Text);
+    /* Display one character on LCD, the DMA2D set up is shared by the glyphs */
+    if(LL_DrawGlyph(refcolumn, Ypos, *Text, setup) == LCD_OK)
+    {
+      setup = 0;
+    }
+    else
+    {
+      BSP_LCD_DisplayChar(refcolumn, Ypos, *Text);
+      setup = 1;
+    }
     /* Decrement the column position by 16 */
     refcolumn += DrawProp[ActiveLayer].pFont->Width;
 
@@ -1605,6 +1863,154 @@ void BSP_LCD_SetBrightness(uint8_t BrightnessValue)
   }  
 }
 
+#if defined(USE_LCD_DSI_CMD_MODE)
+/**
+  * @brief  Refresh the whole display on the next tearing effect.
+  */
+void BSP_LCD_Refresh(void)
+{
+  /* Restore the full display area */
+  LCD_SetRefreshArea(0, 0, lcd_x_size, lcd_y_size);
+
+  /* Set frame buffer busy, the refresh is started by the tearing effect callback */
+  FrameBufferAvailable = 0;
+  RefreshPending = 1;
+}
+
+/**
+  * @brief  Refresh an area of the display on the next tearing effect.
+  * @param  Xpos: X position
+  * @param  Ypos: Y position
+  * @param  Width: Area width
+  * @param  Height: Area height
+  * @retval LCD_OK if the refresh is requested else LCD_ERROR (refresh on going or wrong area)
+  */
+uint8_t BSP_LCD_RefreshRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+  if((Width == 0) || (Height == 0) || ((Xpos + Width) > lcd_x_size) || ((Ypos + Height) > lcd_y_size))
+  {
+    return LCD_ERROR;
+  }
+
+  /* Area registers can't be changed during a refresh */
+  if(FrameBufferAvailable != 1)
+  {
+    return LCD_ERROR;
+  }
+
+  LCD_SetRefreshArea(Xpos, Ypos, Width, Height);
+
+  FrameBufferAvailable = 0;
+  RefreshPending = 1;
+
+  return LCD_OK;
+}
+
+/**
+  * @brief  Add an area modified in the frame buffer to the area refreshed by
+  *         the next BSP_LCD_RefreshDirty() call.
+  * @param  Xpos: X position
+  * @param  Ypos: Y position
+  * @param  Width: Area width
+  * @param  Height: Area height
+  */
+void BSP_LCD_InvalidateRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+  uint32_t x1, y1;
+
+  if((Width == 0) || (Height == 0) || (Xpos >= lcd_x_size) || (Ypos >= lcd_y_size))
+  {
+    return;
+  }
+
+  /* Clip the area to the display */
+  x1 = ((Xpos + Width) > lcd_x_size) ? lcd_x_size : (Xpos + Width);
+  y1 = ((Ypos + Height) > lcd_y_size) ? lcd_y_size : (Ypos + Height);
+
+  if(DirtyArea[2] == 0)
+  {
+    DirtyArea[0] = Xpos;
+    DirtyArea[1] = Ypos;
+    DirtyArea[2] = x1;
+    DirtyArea[3] = y1;
+  }
+  else
+  {
+    DirtyArea[0] = (Xpos < DirtyArea[0]) ? Xpos : DirtyArea[0];
+    DirtyArea[1] = (Ypos < DirtyArea[1]) ? Ypos : DirtyArea[1];
+    DirtyArea[2] = (x1 > DirtyArea[2]) ? x1 : DirtyArea[2];
+    DirtyArea[3] = (y1 > DirtyArea[3]) ? y1 : DirtyArea[3];
+  }
+}
+
+/**
+  * @brief  Refresh the bounding box of the areas given to BSP_LCD_InvalidateRect().
+  * @retval LCD_OK if the refresh is requested or nothing has to be refreshed,
+  *         else LCD_ERROR (refresh on going, the areas are kept)
+  */
+uint8_t BSP_LCD_RefreshDirty(void)
+{
+  uint8_t status = LCD_OK;
+
+  if(DirtyArea[2] != 0)
+  {
+    status = BSP_LCD_RefreshRect(DirtyArea[0], DirtyArea[1],
+                                 DirtyArea[2] - DirtyArea[0], DirtyArea[3] - DirtyArea[1]);
+    if(status == LCD_OK)
+    {
+      DirtyArea[2] = 0;
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Check if frame buffer is available.
+  * @retval LCD_OK if frame buffer is available else LCD_ERROR (frame buffer busy)
+  */
+uint8_t BSP_LCD_IsFrameBufferAvailable(void)
+{
+  return (FrameBufferAvailable == 1) ? LCD_OK : LCD_ERROR;
+}
+
+/**
+  * @brief  Handles DSI interrupt request.
+  * @note   Application can surcharge if needed this function implementation.
+  */
+__weak void BSP_LCD_DSI_IRQHandler(void)
+{
+  HAL_DSI_IRQHandler(&hdsi_discovery);
+}
+
+/**
+  * @brief  Tearing effect DSI callback, starts the requested refresh.
+  * @param  hdsi: pointer to a DSI_HandleTypeDef structure that contains
+  *               the configuration information for the DSI.
+  */
+void HAL_DSI_TearingEffectCallback(DSI_HandleTypeDef *hdsi)
+{
+  if(RefreshPending != 0)
+  {
+    RefreshPending = 0;
+    HAL_DSI_Refresh(hdsi);
+  }
+}
+
+/**
+  * @brief  End of refresh DSI callback.
+  * @param  hdsi: pointer to a DSI_HandleTypeDef structure that contains
+  *               the configuration information for the DSI.
+  */
+void HAL_DSI_EndOfRefreshCallback(DSI_HandleTypeDef *hdsi)
+{
+  UNUSED(hdsi);
+
+  /* Set frame buffer available */
+  FrameBufferAvailable = 1;
+}
+#endif /* USE_LCD_DSI_CMD_MODE */
+
 /**
   * @brief  DCS or Generic short/long write command
   * @param  NbrParams: Number of parameters. It indicates the write command mode:
@@ -1624,6 +2030,93 @@ void DSI_IO_WriteCmd(uint32_t NbrParams, uint8_t *pParams)
   } 
 }
 
+#if defined(USE_LCD_DSI_CMD_MODE)
+/**
+  * @brief  Set the display area updated by the next refresh.
+  * @note   The panel memory window, the LTDC active area and the enabled layers
+  *         are reduced to the area : only its pixels are read from the frame
+  *         buffers and sent on the DSI link. The frame buffer pitch is kept.
+  *         Must be called while no refresh is on going.
+  * @param  Xpos: X position
+  * @param  Ypos: Y position
+  * @param  Width: Area width
+  * @param  Height: Area height
+  */
+static void LCD_SetRefreshArea(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+  uint8_t  Param[4];
+  uint32_t AHBP = hltdc_discovery.Init.AccumulatedHBP;
+  uint32_t AVBP = hltdc_discovery.Init.AccumulatedVBP;
+  uint32_t LayerIndex, PixelSize;
+
+  /* Panel memory window, only sent when it changes */
+  if((RefreshArea[0] != Xpos) || (RefreshArea[1] != Ypos) ||
+     (RefreshArea[2] != Width) || (RefreshArea[3] != Height))
+  {
+    Param[0] = (uint8_t)(Xpos >> 8);
+    Param[1] = (uint8_t)(Xpos);
+    Param[2] = (uint8_t)((Xpos + Width - 1) >> 8);
+    Param[3] = (uint8_t)(Xpos + Width - 1);
+    HAL_DSI_LongWrite(&hdsi_discovery, LCD_OTM8009A_ID, DSI_DCS_LONG_PKT_WRITE, 4, OTM8009A_CMD_CASET, Param);
+    Param[0] = (uint8_t)(Ypos >> 8);
+    Param[1] = (uint8_t)(Ypos);
+    Param[2] = (uint8_t)((Ypos + Height - 1) >> 8);
+    Param[3] = (uint8_t)(Ypos + Height - 1);
+    HAL_DSI_LongWrite(&hdsi_discovery, LCD_OTM8009A_ID, DSI_DCS_LONG_PKT_WRITE, 4, OTM8009A_CMD_PASET, Param);
+
+    RefreshArea[0] = Xpos;
+    RefreshArea[1] = Ypos;
+    RefreshArea[2] = Width;
+    RefreshArea[3] = Height;
+  }
+
+  /* LTDC active area, always written as the LTDC HAL layer functions restore
+     the full window. The layer configurations kept in the handle are not
+     modified : drawing functions still address the whole frame buffers */
+  LTDC->AWCR = ((AHBP + Width) << 16) | (AVBP + Height);
+  LTDC->TWCR = ((AHBP + Width + 1) << 16) | (AVBP + Height + 1);
+
+  for(LayerIndex = 0; LayerIndex < LTDC_MAX_LAYER_NUMBER; LayerIndex++)
+  {
+    if((LTDC_LAYER(&hltdc_discovery, LayerIndex)->CR & LTDC_LxCR_LEN) == 0)
+    {
+      continue;
+    }
+
+    switch(hltdc_discovery.LayerCfg[LayerIndex].PixelFormat)
+    {
+    case LTDC_PIXEL_FORMAT_ARGB8888:
+      PixelSize = 4;
+      break;
+    case LTDC_PIXEL_FORMAT_RGB888:
+      PixelSize = 3;
+      break;
+    case LTDC_PIXEL_FORMAT_RGB565:
+    case LTDC_PIXEL_FORMAT_ARGB1555:
+    case LTDC_PIXEL_FORMAT_ARGB4444:
+    case LTDC_PIXEL_FORMAT_AL88:
+      PixelSize = 2;
+      break;
+    default:
+      PixelSize = 1;
+      break;
+    }
+
+    LTDC_LAYER(&hltdc_discovery, LayerIndex)->WHPCR  = (AHBP + 1) | ((AHBP + Width) << 16);
+    LTDC_LAYER(&hltdc_discovery, LayerIndex)->WVPCR  = (AVBP + 1) | ((AVBP + Height) << 16);
+    LTDC_LAYER(&hltdc_discovery, LayerIndex)->CFBAR  = hltdc_discovery.LayerCfg[LayerIndex].FBStartAdress +
+                                                       PixelSize * ((hltdc_discovery.LayerCfg[LayerIndex].ImageWidth * Ypos) + Xpos);
+    LTDC_LAYER(&hltdc_discovery, LayerIndex)->CFBLR  = ((hltdc_discovery.LayerCfg[LayerIndex].ImageWidth * PixelSize) << 16) |
+                                                       ((Width * PixelSize) + 3);
+    LTDC_LAYER(&hltdc_discovery, LayerIndex)->CFBLNR = Height;
+  }
+  LTDC->SRCR = LTDC_SRCR_IMR;
+
+  /* One DSI write memory command per line */
+  MODIFY_REG(hdsi_discovery.Instance->LCCR, DSI_LCCR_CMDSIZE, Width);
+}
+#endif /* USE_LCD_DSI_CMD_MODE */
+
 /**
   * @brief  Returns the ID of connected screen by checking the HDMI
   *        (adv7533 component) ID or LCD DSI (via TS ID) ID.
@@ -1689,6 +2182,10 @@ __weak void BSP_LCD_MspDeInit(void)
   */
 __weak void BSP_LCD_MspInit(void)
 {
+#if defined(USE_LCD_DSI_CMD_MODE)
+  GPIO_InitTypeDef gpio_init_structure;
+
+#endif /* USE_LCD_DSI_CMD_MODE */
   /** @brief Enable the LTDC clock */
   __HAL_RCC_LTDC_CLK_ENABLE();
 
@@ -1721,6 +2218,17 @@ __weak void BSP_LCD_MspInit(void)
   /** @brief NVIC configuration for DSI interrupt that is now enabled */
   HAL_NVIC_SetPriority(DSI_IRQn, 3, 0);
   HAL_NVIC_EnableIRQ(DSI_IRQn);
+
+#if defined(USE_LCD_DSI_CMD_MODE)
+  /** @brief Tearing effect input : DSI_TE on PJ2 */
+  __HAL_RCC_GPIOJ_CLK_ENABLE();
+  gpio_init_structure.Pin       = GPIO_PIN_2;
+  gpio_init_structure.Mode      = GPIO_MODE_AF_PP;
+  gpio_init_structure.Pull      = GPIO_NOPULL;
+  gpio_init_structure.Speed     = GPIO_SPEED_FREQ_HIGH;
+  gpio_init_structure.Alternate = GPIO_AF13_DSI;
+  HAL_GPIO_Init(GPIOJ, &gpio_init_structure);
+#endif /* USE_LCD_DSI_CMD_MODE */
 }
 
 /**
@@ -1791,6 +2299,108 @@ static void DrawChar(uint16_t Xpos, uint16_t Ypos, const uint8_t *c)
   }
 }
 
+/**
+  * @brief  Draws a character from the glyph atlas with DMA2D.
+  * @note   The foreground is the glyph coverage in the text color, blended
+  *         over a background of plain back color.
+  * @param  Xpos: Start column address
+  * @param  Ypos: Line where to display the character shape
+  * @param  Ascii: Character ascii code
+  * @param  Setup: 0 to reuse the DMA2D set up of the previous glyph
+  * @retval LCD_OK if the glyph was drawn, LCD_ERROR to draw it pixel by pixel
+  */
+static uint8_t LL_DrawGlyph(uint16_t Xpos, uint16_t Ypos, uint8_t Ascii, uint8_t Setup)
+{
+  sFONT *pfont = DrawProp[ActiveLayer].pFont;
+  const uint8_t *pglyph;
+  uint32_t input_mode, output_mode, bytes;
+  uint32_t address;
+  
+  if((pFontAtlas == NULL) || (pFontAtlas->pFont != pfont))
+  {
+    return LCD_ERROR;
+  }
+  
+  pglyph = FONT_AtlasGetGlyph(pFontAtlas, Ascii);
+  if((pglyph == NULL) || ((Xpos + pfont->Width) > BSP_LCD_GetXSize()) || ((Ypos + pfont->Height) > BSP_LCD_GetYSize()))
+  {
+    return LCD_ERROR;
+  }
+  
+  if(hltdc_discovery.LayerCfg[ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_RGB565)
+  {
+    output_mode = DMA2D_OUTPUT_RGB565;
+    bytes = 2;
+  }
+  else
+  {
+    output_mode = DMA2D_OUTPUT_ARGB8888;
+    bytes = 4;
+  }
+  address = hltdc_discovery.LayerCfg[ActiveLayer].FBStartAdress + (bytes * ((Ypos * BSP_LCD_GetXSize()) + Xpos));
+  
+  if(Setup != 0)
+  {
+    input_mode = (pFontAtlas->ColorMode == FONT_ATLAS_A4) ? DMA2D_INPUT_A4 : DMA2D_INPUT_A8;
+    
+    /* Configure the DMA2D Mode, Color Mode and output offset */
+    hdma2d_discovery.Init.Mode         = DMA2D_M2M_BLEND;
+    hdma2d_discovery.Init.ColorMode    = output_mode;
+    hdma2d_discovery.Init.OutputOffset = BSP_LCD_GetXSize() - pfont->Width;
+    
+    /* Foreground Configuration: glyph coverage in the text color */
+    hdma2d_discovery.LayerCfg[1].AlphaMode = DMA2D_NO_MODIF_ALPHA;
+    hdma2d_discovery.LayerCfg[1].InputAlpha = DrawProp[ActiveLayer].TextColor;
+    hdma2d_discovery.LayerCfg[1].InputColorMode = input_mode;
+    hdma2d_discovery.LayerCfg[1].InputOffset = 0;
+    
+    /* Background Configuration: back color, the read coverage is replaced */
+    hdma2d_discovery.LayerCfg[0].AlphaMode = DMA2D_REPLACE_ALPHA;
+    hdma2d_discovery.LayerCfg[0].InputAlpha = DrawProp[ActiveLayer].BackColor;
+    hdma2d_discovery.LayerCfg[0].InputColorMode = input_mode;
+    hdma2d_discovery.LayerCfg[0].InputOffset = 0;
+    
+    hdma2d_discovery.Instance = DMA2D;
+    
+    /* DMA2D Initialization */
+    if((HAL_DMA2D_Init(&hdma2d_discovery) != HAL_OK) ||
+       (HAL_DMA2D_ConfigLayer(&hdma2d_discovery, 0) != HAL_OK) ||
+       (HAL_DMA2D_ConfigLayer(&hdma2d_discovery, 1) != HAL_OK))
+    {
+      return LCD_ERROR;
+    }
+  }
+  
+  if(HAL_DMA2D_BlendingStart(&hdma2d_discovery, (uint32_t)pglyph, (uint32_t)pglyph, address, pfont->Width, pfont->Height) != HAL_OK)
+  {
+    return LCD_ERROR;
+  }
+  
+  /* Polling For DMA transfer */
+  HAL_DMA2D_PollForTransfer(&hdma2d_discovery, 10);
+  
+  return LCD_OK;
+}
+
+/**
+  * @brief  Waits until the presented frame is shown.
+  * @retval LCD_OK, or LCD_TIMEOUT when no vertical blanking occurred
+  */
+static uint8_t LL_PresentWait(void)
+{
+  uint32_t tickstart = HAL_GetTick();
+  
+  while(BSP_LCD_IsPresentPending() != 0)
+  {
+    if((HAL_GetTick() - tickstart) > 100)
+    {
+      return LCD_TIMEOUT;
+    }
+  }
+  
+  return LCD_OK;
+}
+
 /**
   * @brief  Fills a triangle (between 3 points).
   * @param  x1: Point 1 X position
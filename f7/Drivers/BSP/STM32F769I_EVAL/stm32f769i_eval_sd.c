@@ -920,6 +920,54 @@ uint8_t BSP_SD_GetCardStateEx(uint32_t SdCard)
   }
 }
 
+/**
+  * @brief  Waits for the end of the card programming without blocking, 
+  *         BSP_SD_CardReadyCallback() is called when the card is ready.
+  * @retval SD status
+  */
+uint8_t BSP_SD_WaitCardReady_IT(void)
+{
+  return BSP_SD_WaitCardReady_ITEx(SD_CARD1);
+}
+
+/**
+  * @brief  Waits for the end of the card programming without blocking, 
+  *         BSP_SD_CardReadyCallback() is called when the card is ready.
+  * @param  SdCard: SD_CARD1 or SD_CARD2
+  * @retval SD status
+  */
+uint8_t BSP_SD_WaitCardReady_ITEx(uint32_t SdCard)
+{
+  return((HAL_SD_WaitCardReady_IT((SdCard == SD_CARD1) ? &uSdHandle : &uSdHandle2) == HAL_OK) ? MSD_OK : MSD_ERROR);
+}
+
+/**
+  * @brief  Checks once the end of the card programming waited for by 
+  *         BSP_SD_WaitCardReady_IT(). To be called from a periodic timer.
+  * @retval Data transfer state.
+  *          This value can be one of the following values:
+  *            @arg  SD_TRANSFER_OK: Card ready, BSP_SD_CardReadyCallback() called
+  *            @arg  SD_TRANSFER_BUSY: Card still programming
+  */
+uint8_t BSP_SD_PollCardReady(void)
+{
+  return BSP_SD_PollCardReadyEx(SD_CARD1);
+}
+
+/**
+  * @brief  Checks once the end of the card programming waited for by 
+  *         BSP_SD_WaitCardReady_ITEx(). To be called from a periodic timer.
+  * @param  SdCard: SD_CARD1 or SD_CARD2
+  * @retval Data transfer state.
+  *          This value can be one of the following values:
+  *            @arg  SD_TRANSFER_OK: Card ready, BSP_SD_CardReadyCallback() called
+  *            @arg  SD_TRANSFER_BUSY: Card still programming
+  */
+uint8_t BSP_SD_PollCardReadyEx(uint32_t SdCard)
+{
+  return((HAL_SD_PollCardReady((SdCard == SD_CARD1) ? &uSdHandle : &uSdHandle2) == HAL_OK) ? SD_TRANSFER_OK : SD_TRANSFER_BUSY);
+}
+
 /**
   * @brief  Get SD information about specific SD card.
   * @param  CardInfo: Pointer to HAL_SD_CardInfoTypedef structure
@@ -979,6 +1027,16 @@ void HAL_SD_RxCpltCallback(SD_HandleTypeDef *hsd)
   BSP_SD_ReadCpltCallback((hsd == &uSdHandle) ? SD_CARD1 : SD_CARD2);
 }
 
+/**
+  * @brief Card ready callbacks
+  * @param hsd: SD handle
+  * @retval None
+  */
+void HAL_SD_CardReadyCallback(SD_HandleTypeDef *hsd)
+{
+  BSP_SD_CardReadyCallback((hsd == &uSdHandle) ? SD_CARD1 : SD_CARD2);
+}
+
 /**
   * @brief BSP SD Abort callbacks
   * @param SdCard: SD_CARD1 or SD_CARD2
@@ -1007,6 +1065,16 @@ __weak void BSP_SD_WriteCpltCallback(uint32_t SdCard)
 __weak void BSP_SD_ReadCpltCallback(uint32_t SdCard)
 {
 
+}
+
+/**
+  * @brief BSP Card ready callbacks
+  * @param SdCard: SD_CARD1 or SD_CARD2
+  * @retval None
+  */
+__weak void BSP_SD_CardReadyCallback(uint32_t SdCard)
+{
+
 }
 /**
   * @}
@@ -149,6 +149,10 @@ uint8_t BSP_SD_Erase(uint32_t StartAddr, uint32_t EndAddr);
 uint8_t BSP_SD_EraseEx(uint32_t SdCard, uint32_t StartAddr, uint32_t EndAddr);
 uint8_t BSP_SD_GetCardState(void);
 uint8_t BSP_SD_GetCardStateEx(uint32_t SdCard);
+uint8_t BSP_SD_WaitCardReady_IT(void);
+uint8_t BSP_SD_WaitCardReady_ITEx(uint32_t SdCard);
+uint8_t BSP_SD_PollCardReady(void);
+uint8_t BSP_SD_PollCardReadyEx(uint32_t SdCard);
 void    BSP_SD_GetCardInfo(BSP_SD_CardInfo *CardInfo);
 void    BSP_SD_GetCardInfoEx(uint32_t SdCard, BSP_SD_CardInfo *CardInfo);
 uint8_t BSP_SD_IsDetected(void);
@@ -161,6 +165,7 @@ void    BSP_SD_MspDeInit(SD_HandleTypeDef *hsd, void *Params);
 void    BSP_SD_AbortCallback(uint32_t SdCard);
 void    BSP_SD_WriteCpltCallback(uint32_t SdCard);
 void    BSP_SD_ReadCpltCallback(uint32_t SdCard);
+void    BSP_SD_CardReadyCallback(uint32_t SdCard);
 
 /**
   * @}
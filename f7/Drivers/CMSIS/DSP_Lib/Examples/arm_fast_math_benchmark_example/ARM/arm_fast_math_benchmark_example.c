@@ -0,0 +1,508 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2018 STMicroelectronics. All rights reserved.
+*
+* Project:       CMSIS DSP Library
+* Title:         arm_fast_math_benchmark_example.c
+*
+* Description:   Cycle count and accuracy benchmark of the fast math
+*                vector functions against the C library.
+*
+* Target Processor: Cortex-M7/Cortex-M4
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of STMicroelectronics nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+ * -------------------------------------------------------------------- */
+
+/**
+ * @ingroup groupExamples
+ */
+
+/**
+ * @defgroup FastMathBenchmark Fast Math Benchmark Example
+ *
+ * \par Description
+ * \par
+ * Measures the execution time and the accuracy of the fast math vector
+ * functions (exponential, natural logarithm, arc tangent of two arguments,
+ * hyperbolic tangent and inverse square root) on the target, next to the
+ * single precision functions of the C library: expf(), logf(), atan2f(),
+ * tanhf() and 1.0f / sqrtf().
+ *
+ * \par Algorithm:
+ * \par
+ * Each function processes a block of \c BENCH_BLOCK_SIZE pseudo-random
+ * inputs \c BENCH_REPEAT times, the fastest run giving the cycles per
+ * sample. Cycles are counted with the DWT cycle counter. The outputs are
+ * then compared to the double precision functions of the C library.
+ * \par
+ * The results are printed as one line per function,
+ * <code>function;impl;cycles_per_sample;max_error</code>, through
+ * \c bench_putchar(), <code>impl</code> being \c cmsis or \c libm. The
+ * maximum error is given in units of 1e-9 for the floating-point functions
+ * (absolute for atan2, relative for the others) and in LSB for the Q31 and
+ * Q15 ones. The default \c bench_putchar() writes to ITM stimulus port 0
+ * (SWO). The system clock must be configured before \c main() is entered;
+ * on Cortex-M7 the caches are enabled by the example.
+ *
+ * \par Variables Description:
+ * \par
+ * \li \c bench_x, \c bench_y input buffers
+ * \li \c bench_out output buffer
+ *
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_vexp_f32(), arm_vinv_sqrt_f32()
+ * - arm_vlog_f32(), arm_vlog_q31(), arm_vlog_q15()
+ * - arm_vatan2_f32(), arm_vatan2_q31(), arm_vatan2_q15()
+ * - arm_vtanh_f32(), arm_vtanh_q31(), arm_vtanh_q15()
+ *
+ * <b> Refer  </b>
+ * \link arm_fast_math_benchmark_example.c \endlink
+ *
+ */
+
+
+/** \example arm_fast_math_benchmark_example.c
+  */
+
+#include "stm32f7xx.h"
+#include "arm_math.h"
+#include <math.h>
+
+/* Samples per block */
+#ifndef BENCH_BLOCK_SIZE
+#define BENCH_BLOCK_SIZE    256U
+#endif
+
+/* Runs per measurement, the fastest one is reported */
+#ifndef BENCH_REPEAT
+#define BENCH_REPEAT        4U
+#endif
+
+#ifndef __WEAK
+#if defined(__ICCARM__)
+#define __WEAK              __weak
+#else
+#define __WEAK              __attribute__((weak))
+#endif
+#endif
+
+typedef enum
+{
+  BENCH_EXP_F32 = 0,
+  BENCH_LOG_F32,
+  BENCH_ATAN2_F32,
+  BENCH_TANH_F32,
+  BENCH_INV_SQRT_F32,
+  BENCH_LOG_Q31,
+  BENCH_ATAN2_Q31,
+  BENCH_TANH_Q31,
+  BENCH_LOG_Q15,
+  BENCH_ATAN2_Q15,
+  BENCH_TANH_Q15,
+  BENCH_FUNCTION_NBR
+} bench_function_t;
+
+/* ------------------------------------------------------------------
+* Global variables for Fast Math Benchmark Example
+* ------------------------------------------------------------------- */
+static const char * const bench_names[BENCH_FUNCTION_NBR] =
+{
+  "exp_f32", "log_f32", "atan2_f32", "tanh_f32", "inv_sqrt_f32",
+  "log_q31", "atan2_q31", "tanh_q31", "log_q15", "atan2_q15", "tanh_q15"
+};
+
+static uint32_t bench_x[BENCH_BLOCK_SIZE];
+static uint32_t bench_y[BENCH_BLOCK_SIZE];
+static uint32_t bench_out[BENCH_BLOCK_SIZE];
+static uint32_t bench_seed;
+
+/* ----------------------------------------------------------------------
+* Output
+* ------------------------------------------------------------------- */
+
+/* Send one character of the result table; override to use a UART */
+__WEAK void bench_putchar(char ch)
+{
+  (void)ITM_SendChar((uint32_t)ch);
+}
+
+static void bench_puts(const char *str)
+{
+  while (*str != '\0')
+  {
+    bench_putchar(*str++);
+  }
+}
+
+/* Print an unsigned value with at least 'digits' digits, a decimal point
+   being inserted before the last 'decimals' digits */
+static void bench_putu(uint32_t value, uint32_t digits, uint32_t decimals)
+{
+  char buf[12];
+  uint32_t n = 0U;
+
+  do
+  {
+    buf[n++] = (char)('0' + (value % 10U));
+    value /= 10U;
+  } while (((value != 0U) || (n < digits)) && (n < sizeof(buf)));
+
+  while (n > 0U)
+  {
+    if ((n == decimals) && (decimals != 0U))
+    {
+      bench_putchar('.');
+    }
+    bench_putchar(buf[--n]);
+  }
+}
+
+/* ----------------------------------------------------------------------
+* Cycle counter
+* ------------------------------------------------------------------- */
+static void bench_timer_init(void)
+{
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#if (__CORTEX_M == 7U)
+  DWT->LAR = 0xC5ACCE55U;
+#endif
+  DWT->CYCCNT = 0U;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/* ----------------------------------------------------------------------
+* Inputs
+* ------------------------------------------------------------------- */
+static uint32_t bench_rand(void)
+{
+  bench_seed = (bench_seed * 1664525U) + 1013904223U;
+  return bench_seed;
+}
+
+/* Uniform value in [lo hi) */
+static float32_t bench_uniform(float32_t lo, float32_t hi)
+{
+  return lo + ((hi - lo) * ((float32_t)(bench_rand() >> 8) / 16777216.0f));
+}
+
+/* Fill the inputs of a function within its valid range */
+static void bench_fill(bench_function_t function)
+{
+  uint32_t i;
+
+  bench_seed = (uint32_t)function + 1U;
+
+  for (i = 0U; i < BENCH_BLOCK_SIZE; i++)
+  {
+    switch (function)
+    {
+    case BENCH_EXP_F32:
+      ((float32_t *)bench_x)[i] = bench_uniform(-10.0f, 10.0f);
+      break;
+
+    case BENCH_LOG_F32:
+    case BENCH_INV_SQRT_F32:
+      ((float32_t *)bench_x)[i] = bench_uniform(1.0e-3f, 1000.0f);
+      break;
+
+    case BENCH_ATAN2_F32:
+      ((float32_t *)bench_x)[i] = bench_uniform(-1.0f, 1.0f);
+      ((float32_t *)bench_y)[i] = bench_uniform(-1.0f, 1.0f);
+      break;
+
+    case BENCH_TANH_F32:
+      ((float32_t *)bench_x)[i] = bench_uniform(-5.0f, 5.0f);
+      break;
+
+    case BENCH_LOG_Q31:
+      ((q31_t *)bench_x)[i] = (q31_t)(bench_rand() >> 1) | 1;
+      break;
+
+    case BENCH_ATAN2_Q31:
+    case BENCH_TANH_Q31:
+      ((q31_t *)bench_x)[i] = (q31_t)bench_rand();
+      ((q31_t *)bench_y)[i] = (q31_t)bench_rand();
+      break;
+
+    case BENCH_LOG_Q15:
+      ((q15_t *)bench_x)[i] = (q15_t)(bench_rand() >> 17) | 1;
+      break;
+
+    default:
+      ((q15_t *)bench_x)[i] = (q15_t)(bench_rand() >> 16);
+      ((q15_t *)bench_y)[i] = (q15_t)(bench_rand() >> 16);
+      break;
+    }
+  }
+}
+
+/* ----------------------------------------------------------------------
+* Measurements
+* ------------------------------------------------------------------- */
+
+/* Process the block with the fast math function, or with the C library */
+static void bench_process(bench_function_t function, uint32_t libm)
+{
+  float32_t *px = (float32_t *)bench_x;
+  float32_t *py = (float32_t *)bench_y;
+  float32_t *pout = (float32_t *)bench_out;
+  uint32_t i;
+
+  if (libm != 0U)
+  {
+    for (i = 0U; i < BENCH_BLOCK_SIZE; i++)
+    {
+      switch (function)
+      {
+      case BENCH_EXP_F32:   pout[i] = expf(px[i]);           break;
+      case BENCH_LOG_F32:   pout[i] = logf(px[i]);           break;
+      case BENCH_ATAN2_F32: pout[i] = atan2f(py[i], px[i]);  break;
+      case BENCH_TANH_F32:  pout[i] = tanhf(px[i]);          break;
+      default:              pout[i] = 1.0f / sqrtf(px[i]);   break;
+      }
+    }
+    return;
+  }
+
+  switch (function)
+  {
+  case BENCH_EXP_F32:
+    arm_vexp_f32(px, pout, BENCH_BLOCK_SIZE);
+    break;
+
+  case BENCH_LOG_F32:
+    arm_vlog_f32(px, pout, BENCH_BLOCK_SIZE);
+    break;
+
+  case BENCH_ATAN2_F32:
+    arm_vatan2_f32(py, px, pout, BENCH_BLOCK_SIZE);
+    break;
+
+  case BENCH_TANH_F32:
+    arm_vtanh_f32(px, pout, BENCH_BLOCK_SIZE);
+    break;
+
+  case BENCH_INV_SQRT_F32:
+    arm_vinv_sqrt_f32(px, pout, BENCH_BLOCK_SIZE);
+    break;
+
+  case BENCH_LOG_Q31:
+    arm_vlog_q31((q31_t *)bench_x, (q31_t *)bench_out, BENCH_BLOCK_SIZE);
+    break;
+
+  case BENCH_ATAN2_Q31:
+    arm_vatan2_q31((q31_t *)bench_y, (q31_t *)bench_x, (q31_t *)bench_out, BENCH_BLOCK_SIZE);
+    break;
+
+  case BENCH_TANH_Q31:
+    arm_vtanh_q31((q31_t *)bench_x, (q31_t *)bench_out, BENCH_BLOCK_SIZE);
+    break;
+
+  case BENCH_LOG_Q15:
+    arm_vlog_q15((q15_t *)bench_x, (q15_t *)bench_out, BENCH_BLOCK_SIZE);
+    break;
+
+  case BENCH_ATAN2_Q15:
+    arm_vatan2_q15((q15_t *)bench_y, (q15_t *)bench_x, (q15_t *)bench_out, BENCH_BLOCK_SIZE);
+    break;
+
+  default:
+    arm_vtanh_q15((q15_t *)bench_x, (q15_t *)bench_out, BENCH_BLOCK_SIZE);
+    break;
+  }
+}
+
+/* Return the best cycle count of the block, in hundredths of a cycle per sample */
+static uint32_t bench_cycles(bench_function_t function, uint32_t libm)
+{
+  uint32_t best = 0xFFFFFFFFU;
+  uint32_t start;
+  uint32_t cycles;
+  uint32_t n;
+
+  for (n = 0U; n < BENCH_REPEAT; n++)
+  {
+    start = DWT->CYCCNT;
+    bench_process(function, libm);
+    cycles = DWT->CYCCNT - start;
+
+    if (cycles < best)
+    {
+      best = cycles;
+    }
+  }
+
+  return (best * 100U) / BENCH_BLOCK_SIZE;
+}
+
+/* Return the maximum error of the last block against the double precision
+   C library: 1e-9 units for floating-point, LSB for fixed-point */
+static uint32_t bench_error(bench_function_t function)
+{
+  float32_t *px = (float32_t *)bench_x;
+  float32_t *py = (float32_t *)bench_y;
+  float32_t *pout = (float32_t *)bench_out;
+  double ref = 0.0;
+  double out = 0.0;
+  double scale = 1.0e9;
+  double err;
+  double max = 0.0;
+  uint32_t i;
+
+  for (i = 0U; i < BENCH_BLOCK_SIZE; i++)
+  {
+    switch (function)
+    {
+    case BENCH_EXP_F32:
+      ref = exp((double)px[i]);
+      out = pout[i];
+      scale = 1.0e9 / ref;
+      break;
+
+    case BENCH_LOG_F32:
+      ref = log((double)px[i]);
+      out = pout[i];
+      scale = 1.0e9 / fabs(ref);
+      break;
+
+    case BENCH_ATAN2_F32:
+      ref = atan2((double)py[i], (double)px[i]);
+      out = pout[i];
+      break;
+
+    case BENCH_TANH_F32:
+      ref = tanh((double)px[i]);
+      out = pout[i];
+      scale = 1.0e9 / fabs(ref);
+      break;
+
+    case BENCH_INV_SQRT_F32:
+      ref = 1.0 / sqrt((double)px[i]);
+      out = pout[i];
+      scale = 1.0e9 / ref;
+      break;
+
+    case BENCH_LOG_Q31:
+      ref = log((double)((q31_t *)bench_x)[i] / 2147483648.0) * 67108864.0;
+      out = ((q31_t *)bench_out)[i];
+      scale = 1.0;
+      break;
+
+    case BENCH_ATAN2_Q31:
+      ref = atan2((double)((q31_t *)bench_y)[i], (double)((q31_t *)bench_x)[i]) * 536870912.0;
+      out = ((q31_t *)bench_out)[i];
+      scale = 1.0;
+      break;
+
+    case BENCH_TANH_Q31:
+      ref = tanh((double)((q31_t *)bench_x)[i] / 67108864.0) * 2147483648.0;
+      ref = (ref > 2147483647.0) ? 2147483647.0 : ((ref < -2147483647.0) ? -2147483647.0 : ref);
+      out = ((q31_t *)bench_out)[i];
+      scale = 1.0;
+      break;
+
+    case BENCH_LOG_Q15:
+      ref = log((double)((q15_t *)bench_x)[i] / 32768.0) * 2048.0;
+      out = ((q15_t *)bench_out)[i];
+      scale = 1.0;
+      break;
+
+    case BENCH_ATAN2_Q15:
+      ref = atan2((double)((q15_t *)bench_y)[i], (double)((q15_t *)bench_x)[i]) * 8192.0;
+      out = ((q15_t *)bench_out)[i];
+      scale = 1.0;
+      break;
+
+    default:
+      ref = tanh((double)((q15_t *)bench_x)[i] / 2048.0) * 32768.0;
+      ref = (ref > 32767.0) ? 32767.0 : ((ref < -32767.0) ? -32767.0 : ref);
+      out = ((q15_t *)bench_out)[i];
+      scale = 1.0;
+      break;
+    }
+
+    err = fabs(out - ref) * scale;
+    if (err > max)
+    {
+      max = err;
+    }
+  }
+
+  return (max < 4294967295.0) ? (uint32_t)(max + 0.5) : 0xFFFFFFFFU;
+}
+
+static void bench_report(bench_function_t function, uint32_t libm)
+{
+  uint32_t cycles;
+
+  bench_fill(function);
+  cycles = bench_cycles(function, libm);
+
+  bench_puts(bench_names[function]);
+  bench_puts((libm != 0U) ? ";libm;" : ";cmsis;");
+  bench_putu(cycles, 3U, 2U);
+  bench_putchar(';');
+  bench_putu(bench_error(function), 1U, 0U);
+  bench_puts("\r\n");
+}
+
+/* ----------------------------------------------------------------------
+* Fast math benchmark
+* ------------------------------------------------------------------- */
+
+int32_t main(void)
+{
+  uint32_t function;
+
+#if (__CORTEX_M == 7U)
+  SCB_EnableICache();
+  SCB_EnableDCache();
+#endif
+
+  bench_timer_init();
+
+  bench_puts("\r\nCMSIS-DSP fast math benchmark, SystemCoreClock ");
+  bench_putu(SystemCoreClock, 1U, 0U);
+  bench_puts(" Hz\r\nfunction;impl;cycles_per_sample;max_error\r\n");
+
+  for (function = 0U; function < (uint32_t)BENCH_FUNCTION_NBR; function++)
+  {
+    bench_report((bench_function_t)function, 0U);
+
+    /* The C library has single precision versions of the floating-point functions only */
+    if (function <= (uint32_t)BENCH_INV_SQRT_F32)
+    {
+      bench_report((bench_function_t)function, 1U);
+    }
+  }
+
+  bench_puts("done\r\n");
+
+  while(1);                             /* main function does not return */
+}
+
+ /** \endlink */
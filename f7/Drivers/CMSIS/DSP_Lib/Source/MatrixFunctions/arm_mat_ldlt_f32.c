@@ -0,0 +1,192 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_mat_ldlt_f32.c    
+*    
+* Description:	LDL^T decomposition of a symmetric matrix.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.    
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixChol
+ * @{
+ */
+
+/**
+ * @brief Floating-point LDL^T decomposition of a symmetric matrix.
+ * @param[in]       *pSrc points to the input matrix structure, only its lower triangle is read
+ * @param[out]      *pDst points to the output matrix structure: unit lower-triangular factor L
+ * below the diagonal (its unit diagonal is not stored), diagonal factor D on the diagonal,
+ * zeros above the diagonal
+ * @return     		The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the input matrix is not square or if the size
+ * of the output matrix does not match the size of the input matrix.
+ * If a pivot of D is zero, then the function returns
+ * <code>ARM_MATH_DECOMPOSITION_FAILURE</code>. Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.
+ */
+
+arm_status arm_mat_ldlt_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pIn = pSrc->pData;                  /* input data matrix pointer */
+  float32_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  float32_t *pRowI, *pRowJ;                      /* rows i and j of the factor */
+  float32_t w;                                   /* L(i,k) * D(k) */
+  float32_t acc0;                                /* accumulator */
+#ifndef ARM_MATH_CM0_FAMILY
+  float32_t acc1, acc2, acc3;                    /* partial sums */
+#endif
+  uint32_t n = pSrc->numRows;                    /* size of the matrix */
+  uint32_t i, j, k;                              /* loop counters */
+  arm_status status;                             /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pSrc->numCols) || (pDst->numRows != pDst->numCols)
+     || (pSrc->numRows != pDst->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    /* Row by row, in place when pDst == pSrc. Row i first receives
+     * W(i,j) = L(i,j) * D(j), which avoids a triple product in the sums:
+     *
+     *   W(i,j) = A(i,j) - sum(W(i,k) * L(j,k), k < j)               j < i
+     *   L(i,j) = W(i,j) / D(j)                                      j < i
+     *   D(i)   = A(i,i) - sum(W(i,k) * L(i,k), k < i)
+     *
+     * The sums of W are dot products of two contiguous rows. */
+    status = ARM_MATH_SUCCESS;
+
+    for (i = 0u; (i < n) && (status == ARM_MATH_SUCCESS); i++)
+    {
+      for (j = 0u; j < i; j++)
+      {
+        pRowI = pOut + (i * n);
+        pRowJ = pOut + (j * n);
+        acc0 = 0.0f;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+      /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+      /* Four independent partial sums hide the latency of the FPU */
+      acc1 = 0.0f;
+      acc2 = 0.0f;
+      acc3 = 0.0f;
+
+      /* Loop unrolling */
+      k = j >> 2u;
+      while(k > 0u)
+      {
+        acc0 += pRowI[0] * pRowJ[0];
+        acc1 += pRowI[1] * pRowJ[1];
+        acc2 += pRowI[2] * pRowJ[2];
+        acc3 += pRowI[3] * pRowJ[3];
+        pRowI += 4u;
+        pRowJ += 4u;
+        k--;
+      }
+
+      acc0 += (acc1 + acc2) + acc3;
+
+      /* Remaining 1 to 3 products */
+      k = j % 0x4u;
+
+#else
+
+      /* Run the below code for Cortex-M0 */
+
+      k = j;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+      while(k > 0u)
+      {
+        acc0 += *pRowI++ * *pRowJ++;
+        k--;
+      }
+
+        pOut[(i * n) + j] = pIn[(i * n) + j] - acc0;
+      }
+
+      /* L(i,k) from W(i,k), and D(i) */
+      pRowI = pOut + (i * n);
+      acc0 = 0.0f;
+      for (k = 0u; k < i; k++)
+      {
+        w = pRowI[k];
+        pRowI[k] = w / pOut[(k * n) + k];
+        acc0 += w * pRowI[k];
+      }
+
+      acc0 = pIn[(i * n) + i] - acc0;
+
+      if(acc0 != 0.0f)
+      {
+        pRowI[i] = acc0;
+      }
+      else
+      {
+        /* Zero pivot */
+        status = ARM_MATH_DECOMPOSITION_FAILURE;
+      }
+
+      /* Upper triangle of the row */
+      for (j = i + 1u; j < n; j++)
+      {
+        pRowI[j] = 0.0f;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixChol group
+ */
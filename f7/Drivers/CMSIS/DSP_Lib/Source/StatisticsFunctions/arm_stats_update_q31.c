@@ -0,0 +1,217 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_stats_update_q31.c  
+*    
+* Description:	Accumulates a block of a Q31 stream into the batch statistics.  
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupStats    
+ */
+
+/**    
+ * @addtogroup Stats    
+ * @{    
+ */
+
+/**    
+ * @brief Accumulates a block of a Q31 stream into the batch statistics.    
+ * @param[in,out]   *S points to an instance of the Q31 statistics structure.    
+ * @param[in]       *pSrc points to the input vector    
+ * @param[in]       blockSize length of the input vector    
+ * @return none.    
+ */
+
+void arm_stats_update_q31(
+  arm_stats_instance_q31 * S,
+  q31_t * pSrc,
+  uint32_t blockSize)
+{
+  q63_t sum = S->sum;                            /* Sum of the samples */
+  q63_t sumOfSquares = S->sumOfSquares;          /* Sum of squares, in 18.46 format */
+  q31_t minVal, maxVal;                          /* Extrema of the stream */
+  q31_t in23;                                    /* input value in 9.23 format */
+  uint32_t minIdx, maxIdx;                       /* Indexes of the extrema */
+  uint32_t idx = S->count;                       /* Index of the current sample in the stream */
+  q31_t in;                                      /* input value */
+  uint32_t blkCnt;                               /* loop counter */
+
+  if(blockSize == 0u)
+  {
+    return;
+  }
+
+  /* The first sample of the stream initializes the extrema */
+  if(idx == 0u)
+  {
+    S->min = pSrc[0];
+    S->max = pSrc[0];
+  }
+
+  minVal = S->min;
+  maxVal = S->max;
+  minIdx = S->minIndex;
+  maxIdx = S->maxIndex;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.    
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* Accumulate the sum and the sum of squares, and compare with the extrema.    
+     * The squares are computed in 9.23 format, as in arm_var_q31() */
+    in = pSrc[0];
+    in23 = in >> 8;
+    sum += in;
+    sumOfSquares += ((q63_t) in23 * in23);
+    if(in < minVal)
+    {
+      minVal = in;
+      minIdx = idx;
+    }
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIdx = idx;
+    }
+
+    in = pSrc[1];
+    in23 = in >> 8;
+    sum += in;
+    sumOfSquares += ((q63_t) in23 * in23);
+    if(in < minVal)
+    {
+      minVal = in;
+      minIdx = idx + 1u;
+    }
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIdx = idx + 1u;
+    }
+
+    in = pSrc[2];
+    in23 = in >> 8;
+    sum += in;
+    sumOfSquares += ((q63_t) in23 * in23);
+    if(in < minVal)
+    {
+      minVal = in;
+      minIdx = idx + 2u;
+    }
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIdx = idx + 2u;
+    }
+
+    in = pSrc[3];
+    in23 = in >> 8;
+    sum += in;
+    sumOfSquares += ((q63_t) in23 * in23);
+    if(in < minVal)
+    {
+      minVal = in;
+      minIdx = idx + 3u;
+    }
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIdx = idx + 3u;
+    }
+
+    pSrc += 4u;
+    idx += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.    
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+    in23 = in >> 8;
+    sum += in;
+    sumOfSquares += ((q63_t) in23 * in23);
+    if(in < minVal)
+    {
+      minVal = in;
+      minIdx = idx;
+    }
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIdx = idx;
+    }
+
+    idx++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Store the accumulators back into the instance */
+  S->count = idx;
+  S->sum = sum;
+  S->sumOfSquares = sumOfSquares;
+  S->min = minVal;
+  S->max = maxVal;
+  S->minIndex = minIdx;
+  S->maxIndex = maxIdx;
+}
+
+/**    
+ * @} end of Stats group    
+ */
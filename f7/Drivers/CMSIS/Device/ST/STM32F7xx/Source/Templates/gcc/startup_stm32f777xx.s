@@ -77,33 +77,56 @@ defined in linker script */
 Reset_Handler:  
   ldr   sp, =_estack      /* set stack pointer */
 
-/* Copy the data segment initializers from flash to SRAM */  
-  movs  r1, #0
+/* Copy the data segment initializers from flash to SRAM, four words per
+   load/store multiple while 16 bytes or more are left, then word by word */
+  ldr  r0, =_sdata
+  ldr  r1, =_edata
+  ldr  r2, =_sidata
   b  LoopCopyDataInit
 
 CopyDataInit:
-  ldr  r3, =_sidata
-  ldr  r3, [r3, r1]
-  str  r3, [r0, r1]
-  adds  r1, r1, #4
-    
+  ldmia  r2!, {r3, r4, r5, r6}
+  stmia  r0!, {r3, r4, r5, r6}
+
 LoopCopyDataInit:
-  ldr  r0, =_sdata
-  ldr  r3, =_edata
-  adds  r2, r0, r1
-  cmp  r2, r3
-  bcc  CopyDataInit
+  subs  r3, r1, r0
+  cmp  r3, #16
+  bhs  CopyDataInit
+  b  LoopCopyDataWord
+
+CopyDataWord:
+  ldr  r3, [r2], #4
+  str  r3, [r0], #4
+
+LoopCopyDataWord:
+  cmp  r0, r1
+  bcc  CopyDataWord
+
+/* Zero fill the bss segment, four words per store multiple as above.
+   The .lazy_bss section is left to Utilities/Memory/lazy_init. */
   ldr  r2, =_sbss
+  ldr  r1, =_ebss
+  movs  r3, #0
+  movs  r4, #0
+  movs  r5, #0
+  movs  r6, #0
   b  LoopFillZerobss
-/* Zero fill the bss segment. */  
+
 FillZerobss:
-  movs  r3, #0
-  str  r3, [r2], #4
-    
+  stmia  r2!, {r3, r4, r5, r6}
+
 LoopFillZerobss:
-  ldr  r3, = _ebss
-  cmp  r2, r3
-  bcc  FillZerobss
+  subs  r0, r1, r2
+  cmp  r0, #16
+  bhs  FillZerobss
+  b  LoopFillZeroWord
+
+FillZeroWord:
+  str  r3, [r2], #4
+
+LoopFillZeroWord:
+  cmp  r2, r1
+  bcc  FillZeroWord
 
 /* Call the clock system intitialization function.*/
   bl  SystemInit   
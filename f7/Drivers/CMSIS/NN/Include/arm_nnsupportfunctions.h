@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_nnsupportfunctions.h
+ * Description:  Public header file of support functions for CMSIS NN Library
+ *
+ * $Date:        17. January 2018
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#ifndef _ARM_NNSUPPORTFUNCTIONS_H_
+#define _ARM_NNSUPPORTFUNCTIONS_H_
+
+#include "arm_math.h"
+
+#ifdef __cplusplus
+extern    "C"
+{
+#endif
+
+/* Cores providing the SIMD (DSP extension) instructions */
+#if !defined (ARM_MATH_DSP) && (defined (ARM_MATH_CM4) || defined (ARM_MATH_CM7))
+#define ARM_MATH_DSP
+#endif
+
+/* Rounding constant added to an accumulator before a right shift by out_shift */
+#define NN_ROUND(out_shift) ((0x1 << (out_shift)) >> 1)
+
+/**
+ * @defgroup groupSupport Neural Network Support Functions
+ * These functions expand data and compute partial products for the layer functions.
+ */
+
+/**
+ * @defgroup nndata_convert Neural Network Data Conversion Functions
+ *
+ * Perform data type conversion in-between neural network operations
+ *
+ */
+
+/**
+ * @brief Converts the elements of the Q7 vector to Q15 vector without left-shift
+ * @param[in]       *pSrc points to the Q7 input vector
+ * @param[out]      *pDst points to the Q15 output vector
+ * @param[in]       blockSize length of the input vector
+ * @return none.
+ *
+ */
+
+void      arm_q7_to_q15_no_shift(const q7_t * pSrc, q15_t * pDst, uint32_t blockSize);
+
+/**
+ * @brief  Converts the elements of the Q7 vector to reordered Q15 vector without left-shift
+ * @param[in]       *pSrc points to the Q7 input vector
+ * @param[out]      *pDst points to the Q15 output vector
+ * @param[in]       blockSize length of the input vector
+ * @return none.
+ *
+ */
+
+void      arm_q7_to_q15_reordered_no_shift(const q7_t * pSrc, q15_t * pDst, uint32_t blockSize);
+
+/**
+ * @brief Matrix-multiplication function for convolution
+ * @param[in]       pA          pointer to operand A
+ * @param[in]       pInBuffer   pointer to operand B, always consists of 2 vectors
+ * @param[in]       ch_im_out   numRow of A
+ * @param[in]       numCol_A    numCol of A
+ * @param[in]       bias_shift  amount of left-shift for bias
+ * @param[in]       out_shift   amount of right-shift for output
+ * @param[in]       bias        the bias
+ * @param[in,out]   pOut        pointer to output
+ * @return     The function returns the incremented output pointer
+ */
+
+q7_t     *arm_nn_mat_mult_kernel_q7_q15(const q7_t * pA,
+                                        const q15_t * pInBuffer,
+                                        const uint16_t ch_im_out,
+                                        const uint16_t numCol_A,
+                                        const uint16_t bias_shift,
+                                        const uint16_t out_shift,
+                                        const q7_t * bias,
+                                        q7_t * pOut);
+
+#if defined (ARM_MATH_DSP)
+
+/**
+ * @brief read and expand one q7 word into two q15 words
+ *
+ * The four values are returned in order: the first two in out1, the
+ * last two in out2.
+ */
+
+static __INLINE const q7_t *read_and_pad(const q7_t * source, q31_t * out1, q31_t * out2)
+{
+  q31_t     inA = *__SIMD32_CONST(source);
+  q31_t     inAbuf1 = __SXTB16(__ROR((uint32_t)inA, 8));
+  q31_t     inAbuf2 = __SXTB16(inA);
+
+#ifndef ARM_MATH_BIG_ENDIAN
+  *out2 = __PKHTB(inAbuf1, inAbuf2, 16);
+  *out1 = __PKHBT(inAbuf2, inAbuf1, 16);
+#else
+  *out1 = __PKHTB(inAbuf1, inAbuf2, 16);
+  *out2 = __PKHBT(inAbuf2, inAbuf1, 16);
+#endif
+
+  return source + 4;
+}
+
+/**
+ * @brief read and expand one q7 word into two q15 words with reordering
+ *
+ * Values 0 and 2 are returned in out1, values 1 and 3 in out2, which is
+ * the order produced by arm_q7_to_q15_reordered_no_shift().
+ */
+
+static __INLINE const q7_t *read_and_pad_reordered(const q7_t * source, q31_t * out1, q31_t * out2)
+{
+  q31_t     inA = *__SIMD32_CONST(source);
+
+#ifndef ARM_MATH_BIG_ENDIAN
+  *out2 = __SXTB16(__ROR((uint32_t)inA, 8));
+  *out1 = __SXTB16(inA);
+#else
+  *out1 = __SXTB16(__ROR((uint32_t)inA, 8));
+  *out2 = __SXTB16(inA);
+#endif
+
+  return source + 4;
+}
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
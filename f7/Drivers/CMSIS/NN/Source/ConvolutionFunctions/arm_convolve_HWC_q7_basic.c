@@ -0,0 +1,192 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_convolve_HWC_q7_basic.c
+ * Description:  Q7 version of convolution
+ *
+ * $Date:        17. January 2018
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+  /**
+   * @brief Basic Q7 convolution function
+   * @param[in]       Im_in       pointer to input tensor
+   * @param[in]       dim_im_in   input tensor dimension
+   * @param[in]       ch_im_in    number of input tensor channels
+   * @param[in]       wt          pointer to kernel weights
+   * @param[in]       ch_im_out   number of filters, i.e., output tensor channels
+   * @param[in]       dim_kernel  filter kernel size
+   * @param[in]       padding     padding sizes
+   * @param[in]       stride      convolution stride
+   * @param[in]       bias        pointer to bias
+   * @param[in]       bias_shift  amount of left-shift for bias
+   * @param[in]       out_shift   amount of right-shift for output
+   * @param[in,out]   Im_out      pointer to output tensor
+   * @param[in]       dim_im_out  output tensor dimension
+   * @param[in,out]   bufferA     pointer to buffer space for input
+   * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+   *
+   * @details
+   *
+   * <b>Buffer size:</b>
+   *
+   * bufferA size: 2*ch_im_in*dim_kernel*dim_kernel
+   *
+   * The weights are stored as ch_im_out filters of
+   * dim_kernel * dim_kernel * ch_im_in values, each filter in HWC order
+   * like the input tensor.
+   *
+   * This basic version is designed to work for any input tensor and weight
+   * dimension. Two output pixels are computed per pass: their input patches
+   * are expanded to q15 in bufferA (zeros where the patch overlaps the
+   * padding) and multiplied with the weights by arm_nn_mat_mult_kernel_q7_q15().
+   */
+
+arm_status
+arm_convolve_HWC_q7_basic(const q7_t * Im_in,
+                          const uint16_t dim_im_in,
+                          const uint16_t ch_im_in,
+                          const q7_t * wt,
+                          const uint16_t ch_im_out,
+                          const uint16_t dim_kernel,
+                          const uint16_t padding,
+                          const uint16_t stride,
+                          const q7_t * bias,
+                          const uint16_t bias_shift,
+                          const uint16_t out_shift,
+                          q7_t * Im_out,
+                          const uint16_t dim_im_out,
+                          q15_t * bufferA)
+{
+  const uint16_t numCol = ch_im_in * dim_kernel * dim_kernel;  /* length of one column */
+  int16_t   i_out_y, i_out_x, i_ker_y, i_ker_x;
+  q15_t    *pBuffer = bufferA;
+  q7_t     *pOut = Im_out;
+  const q7_t *pA;
+  const q15_t *pB;
+  q31_t     sum;
+  uint16_t  i, colCnt;
+#if defined (ARM_MATH_DSP)
+  q31_t     inA1, inA2, inB1, inB2;
+#endif
+
+  /* This part implements the im2col function */
+  for (i_out_y = 0; i_out_y < dim_im_out; i_out_y++)
+  {
+    for (i_out_x = 0; i_out_x < dim_im_out; i_out_x++)
+    {
+      for (i_ker_y = i_out_y * stride - padding; i_ker_y < i_out_y * stride - padding + dim_kernel; i_ker_y++)
+      {
+        for (i_ker_x = i_out_x * stride - padding; i_ker_x < i_out_x * stride - padding + dim_kernel; i_ker_x++)
+        {
+          if (i_ker_y < 0 || i_ker_y >= dim_im_in || i_ker_x < 0 || i_ker_x >= dim_im_in)
+          {
+            /* Filling 0 for out-of-bound paddings */
+            memset(pBuffer, 0, sizeof(q15_t) * ch_im_in);
+          }
+          else
+          {
+            /* Copying the pixel data to column */
+            arm_q7_to_q15_no_shift(Im_in + (i_ker_y * dim_im_in + i_ker_x) * ch_im_in, pBuffer, ch_im_in);
+          }
+          pBuffer += ch_im_in;
+        }
+      }
+
+      /* Computation is done for every 2 columns */
+      if (pBuffer == bufferA + 2 * numCol)
+      {
+        pOut = arm_nn_mat_mult_kernel_q7_q15(wt, bufferA, ch_im_out, numCol, bias_shift, out_shift, bias, pOut);
+
+        /* counter reset */
+        pBuffer = bufferA;
+      }
+    }
+  }
+
+  /* left-over because odd number of output pixels */
+  if (pBuffer != bufferA)
+  {
+    pA = wt;
+
+    for (i = 0; i < ch_im_out; i++)
+    {
+      /* Load the accumulator with bias first */
+      sum = ((q31_t) bias[i] << bias_shift) + NN_ROUND(out_shift);
+
+      /* Point to the beginning of the im2col buffer */
+      pB = bufferA;
+
+#if defined (ARM_MATH_DSP)
+      /* Each time it processes 4 entries */
+      colCnt = numCol >> 2;
+
+      while (colCnt > 0u)
+      {
+        pA = read_and_pad(pA, &inA1, &inA2);
+
+        inB1 = *__SIMD32_CONST(pB);
+        pB += 2;
+        sum = __SMLAD(inA1, inB1, sum);
+
+        inB2 = *__SIMD32_CONST(pB);
+        pB += 2;
+        sum = __SMLAD(inA2, inB2, sum);
+
+        colCnt--;
+      }
+
+      colCnt = numCol & 0x3u;
+#else
+      colCnt = numCol;
+#endif /* #if defined (ARM_MATH_DSP) */
+
+      while (colCnt > 0u)
+      {
+        sum += (q31_t) * pA++ * *pB++;
+        colCnt--;
+      }
+
+      *pOut++ = (q7_t) __SSAT((sum >> out_shift), 8);
+    }
+  }
+
+  /* Return to application */
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of NNConv group
+ */
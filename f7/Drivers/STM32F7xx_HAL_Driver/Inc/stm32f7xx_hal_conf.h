@@ -163,6 +163,11 @@
 #define  USE_RTOS                     0U
 #define  PREFETCH_ENABLE              1U /* To enable prefetch */
 #define  ART_ACCLERATOR_ENABLE        1U /* To enable ART Accelerator */
+#define  USE_HAL_DMA_CACHE_MAINTENANCE 0U /* To let HAL DMA maintain the D-cache of transfer buffers */
+#define  USE_HAL_DMA_CHECK            0U /* To let HAL DMA check transfer buffers, for debug builds */
+#define  USE_HAL_USB_CACHE_MAINTENANCE 1U /* To let HAL PCD and HCD maintain the D-cache of OTG DMA buffers */
+#define  USE_HAL_HCD_NAK_DEFER        1U /* To let HAL HCD retry NAKed bulk and control transfers on the next SOF */
+#define  USE_HAL_TRACE                0U /* To record HAL driver events in the trace buffer */
 
 /* ########################## Assert Selection ############################## */
 /**
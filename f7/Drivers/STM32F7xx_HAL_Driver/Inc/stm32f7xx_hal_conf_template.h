@@ -161,8 +161,14 @@
 #define  VDD_VALUE                    3300U /*!< Value of VDD in mv */
 #define  TICK_INT_PRIORITY            0x0FU /*!< tick interrupt priority */
 #define  USE_RTOS                     0U
+/* #define  USE_HAL_LOCK                 HAL_LOCK_NONE */ /* Default: HAL_LOCK_EXCLUSIVE on Cortex-M3/M4/M7, HAL_LOCK_PRIMASK on Cortex-M0/M0+ */
 #define  PREFETCH_ENABLE              1U /* To enable prefetch */
 #define  ART_ACCLERATOR_ENABLE        1U /* To enable ART Accelerator */
+#define  USE_HAL_DMA_CACHE_MAINTENANCE 0U /* To let HAL DMA maintain the D-cache of transfer buffers */
+#define  USE_HAL_DMA_CHECK            0U /* To let HAL DMA check transfer buffers, for debug builds */
+#define  USE_HAL_USB_CACHE_MAINTENANCE 1U /* To let HAL PCD and HCD maintain the D-cache of OTG DMA buffers */
+#define  USE_HAL_HCD_NAK_DEFER        1U /* To let HAL HCD retry NAKed bulk and control transfers on the next SOF */
+#define  USE_HAL_TRACE                0U /* To record HAL driver events in the trace buffer */
 
 /* ########################## Assert Selection ############################## */
 /**
@@ -180,6 +180,12 @@ typedef struct __DMA_HandleTypeDef
  uint32_t                    StreamBaseAddress;                                            /*!< DMA Stream Base Address                */
 
  uint32_t                    StreamIndex;                                                  /*!< DMA Stream Index                       */
+
+#if (USE_HAL_DMA_CACHE_MAINTENANCE == 1U)
+ uint32_t                    CacheAddress;                                                 /*!< Destination start for D-cache upkeep   */
+
+ uint32_t                    CacheSize;                                                    /*!< Destination size in bytes              */
+#endif /* USE_HAL_DMA_CACHE_MAINTENANCE */
  
 }DMA_HandleTypeDef;
 
@@ -211,6 +217,24 @@ typedef struct __DMA_HandleTypeDef
   * @}
   */
 
+#if (USE_HAL_DMA_CHECK == 1U)
+/** @defgroup DMA_Check_Violations DMA Check Violations
+  * @brief    Violations reported by HAL_DMA_CheckBuffer()
+  * @{
+  */
+#define HAL_DMA_CHECK_REACH           (0x00000001U)    /*!< Buffer not reachable by the master                 */
+#define HAL_DMA_CHECK_ALIGN_DATA      (0x00000002U)    /*!< Buffer not aligned on the memory data size         */
+#define HAL_DMA_CHECK_ALIGN_CACHE     (0x00000004U)    /*!< Cached buffer written by the master not made of
+                                                            whole D-cache lines                                */
+#define HAL_DMA_CHECK_CACHE           (0x00000008U)    /*!< Cached buffer, without HAL D-cache maintenance     */
+#define HAL_DMA_CHECK_STACK           (0x00000010U)    /*!< Buffer on the main stack                           */
+#define HAL_DMA_CHECK_OVERLAP         (0x00000020U)    /*!< Buffer shared with another ongoing transfer writing
+                                                            either of them                                     */
+/**
+  * @}
+  */
+#endif /* USE_HAL_DMA_CHECK */
+
 /** @defgroup DMA_Data_transfer_direction DMA Data transfer direction
   * @brief    DMA data transfer direction 
   * @{
@@ -386,6 +410,21 @@ typedef struct __DMA_HandleTypeDef
   */
 #define __HAL_DMA_RESET_HANDLE_STATE(__HANDLE__) ((__HANDLE__)->State = HAL_DMA_STATE_RESET)
 
+#if (USE_HAL_DMA_CHECK == 1U)
+/**
+  * @brief  Return address of the running function, given as Caller to the
+  *         DMA check functions. 0 when the compiler has no equivalent.
+  * @retval Address
+  */
+#if defined(__GNUC__)
+#define __HAL_DMA_CALLER_ADDRESS()  ((uint32_t)__builtin_return_address(0))
+#elif defined(__CC_ARM)
+#define __HAL_DMA_CALLER_ADDRESS()  ((uint32_t)__return_address())
+#else
+#define __HAL_DMA_CALLER_ADDRESS()  (0U)
+#endif
+#endif /* USE_HAL_DMA_CHECK */
+
 /**
   * @brief  Return the current DMA Stream FIFO filled level.
   * @param  __HANDLE__ DMA handle
@@ -672,6 +711,19 @@ uint32_t             HAL_DMA_GetError(DMA_HandleTypeDef *hdma);
 /**
   * @}
   */ 
+
+#if (USE_HAL_DMA_CHECK == 1U)
+/** @defgroup DMA_Exported_Functions_Group4 Buffer check functions
+  * @brief    Buffer check functions
+  * @{
+  */
+uint32_t HAL_DMA_CheckBuffer(uint32_t Master, uint32_t Address, uint32_t Size, uint32_t Width, uint32_t Write);
+void     HAL_DMA_CheckReport(uint32_t Master, uint32_t Address, uint32_t Violations, uint32_t Caller);
+void     HAL_DMA_CheckCallback(uint32_t Master, uint32_t Address, uint32_t Violations, uint32_t Caller);
+/**
+  * @}
+  */
+#endif /* USE_HAL_DMA_CHECK */
 /**
   * @}
   */ 
@@ -68,6 +68,59 @@ typedef enum
 
 }HAL_DMA_MemoryTypeDef;
 
+/** 
+  * @brief  Number of buffers which can circulate in a DMA streaming context,
+  *         must be a power of 2. Can be overridden in the HAL configuration file.
+  */ 
+#if !defined(DMA_STREAM_QUEUE_SIZE)
+#define DMA_STREAM_QUEUE_SIZE      8U
+#endif /* DMA_STREAM_QUEUE_SIZE */
+
+/** 
+  * @brief  HAL DMA streaming buffer queue definition
+  */ 
+typedef struct
+{
+  uint32_t                   Buffer[DMA_STREAM_QUEUE_SIZE];  /*!< Buffer addresses                     */
+
+  __IO uint32_t              In;                             /*!< Number of buffers put in the queue   */
+
+  __IO uint32_t              Out;                            /*!< Number of buffers got from the queue */
+
+}DMA_StreamQueueTypeDef;
+
+/** 
+  * @brief  HAL DMA streaming context definition
+  */ 
+typedef struct __DMA_StreamTypeDef
+{
+  DMA_HandleTypeDef          *hdma;          /*!< DMA handle, initialized and linked to the peripheral by its driver */
+
+  uint32_t                   PeriphAddress;  /*!< Peripheral data register address                   */
+
+  uint32_t                   BufferLength;   /*!< Length of each buffer, in DMA data items           */
+
+  void                       *Parent;        /*!< Parent object of the DMA handle, kept for the callbacks */
+
+  DMA_StreamQueueTypeDef     IdleQueue;      /*!< Buffers waiting to become a DMA target: empty buffers
+                                                  to fill (peripheral to memory) or filled buffers to
+                                                  send (memory to peripheral)                            */
+
+  DMA_StreamQueueTypeDef     DoneQueue;      /*!< Buffers released by the DMA: filled buffers (peripheral
+                                                  to memory) or sent buffers (memory to peripheral)      */
+
+  uint32_t                   Target[2];      /*!< Buffers programmed in memory 0 and memory 1         */
+
+  __IO uint32_t              Starved;        /*!< Number of completed buffers which could not be replaced,
+                                                  so were overwritten (peripheral to memory) or sent
+                                                  again (memory to peripheral)                           */
+
+  void                       (* BufferCpltCallback)(struct __DMA_StreamTypeDef * hstream); /*!< Buffer moved to DoneQueue callback */
+
+  void                       (* ErrorCallback)(struct __DMA_StreamTypeDef * hstream);      /*!< DMA transfer error callback        */
+
+}DMA_StreamTypeDef;
+
 /**
   * @}
   */
@@ -128,6 +181,11 @@ typedef enum
 HAL_StatusTypeDef HAL_DMAEx_MultiBufferStart(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress, uint32_t SecondMemAddress, uint32_t DataLength);
 HAL_StatusTypeDef HAL_DMAEx_MultiBufferStart_IT(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress, uint32_t SecondMemAddress, uint32_t DataLength);
 HAL_StatusTypeDef HAL_DMAEx_ChangeMemory(DMA_HandleTypeDef *hdma, uint32_t Address, HAL_DMA_MemoryTypeDef memory);
+HAL_StatusTypeDef HAL_DMAEx_StreamInit(DMA_StreamTypeDef *hstream, DMA_HandleTypeDef *hdma, uint32_t PeriphAddress, uint32_t BufferLength);
+HAL_StatusTypeDef HAL_DMAEx_StreamPutBuffer(DMA_StreamTypeDef *hstream, uint32_t Buffer);
+HAL_StatusTypeDef HAL_DMAEx_StreamGetBuffer(DMA_StreamTypeDef *hstream, uint32_t *pBuffer);
+HAL_StatusTypeDef HAL_DMAEx_StreamStart(DMA_StreamTypeDef *hstream);
+HAL_StatusTypeDef HAL_DMAEx_StreamStop(DMA_StreamTypeDef *hstream);
 
 /**
   * @}
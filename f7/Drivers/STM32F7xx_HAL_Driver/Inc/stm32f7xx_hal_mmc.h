@@ -297,6 +297,7 @@ typedef struct
 #define   MMC_CONTEXT_WRITE_MULTIPLE_BLOCK ((uint32_t)0x00000020U)  /*!< Write multiple blocks operation  */
 #define   MMC_CONTEXT_IT                   ((uint32_t)0x00000008U)  /*!< Process in Interrupt mode        */
 #define   MMC_CONTEXT_DMA                  ((uint32_t)0x00000080U)  /*!< Process in DMA mode              */  
+#define   MMC_CONTEXT_WAIT_READY           ((uint32_t)0x00000200U)  /*!< Wait for the end of programming  */
 
 /**
   * @}
@@ -558,6 +559,10 @@ HAL_StatusTypeDef HAL_MMC_WriteBlocks_IT(MMC_HandleTypeDef *hmmc, uint8_t *pData
 HAL_StatusTypeDef HAL_MMC_ReadBlocks_DMA(MMC_HandleTypeDef *hmmc, uint8_t *pData, uint32_t BlockAdd, uint32_t NumberOfBlocks);
 HAL_StatusTypeDef HAL_MMC_WriteBlocks_DMA(MMC_HandleTypeDef *hmmc, uint8_t *pData, uint32_t BlockAdd, uint32_t NumberOfBlocks);
 
+/* Asynchronous wait for the end of card programming */
+HAL_StatusTypeDef HAL_MMC_WaitCardReady_IT(MMC_HandleTypeDef *hmmc);
+HAL_StatusTypeDef HAL_MMC_PollCardReady(MMC_HandleTypeDef *hmmc);
+
 void HAL_MMC_IRQHandler(MMC_HandleTypeDef *hmmc);
 
 /* Callback in non blocking modes (DMA) */
@@ -565,6 +570,7 @@ void HAL_MMC_TxCpltCallback(MMC_HandleTypeDef *hmmc);
 void HAL_MMC_RxCpltCallback(MMC_HandleTypeDef *hmmc);
 void HAL_MMC_ErrorCallback(MMC_HandleTypeDef *hmmc);
 void HAL_MMC_AbortCallback(MMC_HandleTypeDef *hmmc);
+void HAL_MMC_CardReadyCallback(MMC_HandleTypeDef *hmmc);
 /**
   * @}
   */
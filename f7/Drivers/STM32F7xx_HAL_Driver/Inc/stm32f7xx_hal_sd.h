@@ -124,10 +124,36 @@ typedef struct
 
 }HAL_SD_CardInfoTypeDef;
 
+struct __SD_HandleTypeDef;
+
+/** 
+  * @brief  SD queued transfer request structure definition
+  * @note   The request and its buffer belong to the driver from the call of
+  *         HAL_SD_QueueRequest() until its completion callback is called.
+  */ 
+typedef struct __SD_QueueRequestTypeDef
+{
+  uint8_t                          *pData;           /*!< Word aligned data buffer                          */
+
+  uint32_t                         BlockAdd;         /*!< First block address on the card                   */
+
+  uint32_t                         NumberOfBlocks;   /*!< Number of blocks to transfer                      */
+
+  uint32_t                         Direction;        /*!< Transfer direction, a value of @ref SD_Exported_Constansts_Group5 */
+
+  void                             (* XferCpltCallback)(struct __SD_HandleTypeDef *hsd, struct __SD_QueueRequestTypeDef *pReq);
+                                                     /*!< Completion callback, HAL_SD_QueueCpltCallback() when NULL */
+
+  __IO uint32_t                    ErrorCode;        /*!< Request result, set by the driver before the callback */
+
+  struct __SD_QueueRequestTypeDef  *pNext;           /*!< Queue link, reserved for the driver               */
+
+}SD_QueueRequestTypeDef;
+
 /** 
   * @brief  SD handle Structure definition
   */ 
-typedef struct
+typedef struct __SD_HandleTypeDef
 {
   SD_TypeDef                   *Instance;        /*!< SD registers base address           */
   
@@ -159,6 +185,16 @@ typedef struct
   
   uint32_t                     CID[4];           /*!< SD card identification number table */
   
+  SD_QueueRequestTypeDef       *pQueueHead;      /*!< Queued requests not yet prepared    */
+  
+  SD_QueueRequestTypeDef       *pQueueTail;      /*!< Last queued request                 */
+  
+  SD_QueueRequestTypeDef       *pQueueNext;      /*!< Requests merged for the next command */
+  
+  SD_QueueRequestTypeDef       *pQueueCmd;       /*!< Requests of the running command     */
+  
+  __IO uint32_t                QueueState;       /*!< Queue engine state                  */
+  
 }SD_HandleTypeDef;
 
 /** 
@@ -320,6 +356,8 @@ typedef struct
 #define   SD_CONTEXT_WRITE_MULTIPLE_BLOCK ((uint32_t)0x00000020U)  /*!< Write multiple blocks operation  */
 #define   SD_CONTEXT_IT                   ((uint32_t)0x00000008U)  /*!< Process in Interrupt mode        */
 #define   SD_CONTEXT_DMA                  ((uint32_t)0x00000080U)  /*!< Process in DMA mode              */  
+#define   SD_CONTEXT_WAIT_READY           ((uint32_t)0x00000200U)  /*!< Wait for the end of programming  */
+#define   SD_CONTEXT_QUEUE                ((uint32_t)0x00000100U)  /*!< Process of the request queue     */
 
 /**
   * @}
@@ -344,6 +382,15 @@ typedef struct
 /**
   * @}
   */
+
+/** @defgroup SD_Exported_Constansts_Group5 SD Queued Request Direction
+  * @{
+  */
+#define SD_QUEUE_READ              ((uint32_t)0x00000000U)
+#define SD_QUEUE_WRITE             ((uint32_t)0x00000001U)
+/**
+  * @}
+  */
       
 /**
   * @}
@@ -577,6 +624,14 @@ HAL_StatusTypeDef HAL_SD_WriteBlocks_IT(SD_HandleTypeDef *hsd, uint8_t *pData, u
 HAL_StatusTypeDef HAL_SD_ReadBlocks_DMA(SD_HandleTypeDef *hsd, uint8_t *pData, uint32_t BlockAdd, uint32_t NumberOfBlocks);
 HAL_StatusTypeDef HAL_SD_WriteBlocks_DMA(SD_HandleTypeDef *hsd, uint8_t *pData, uint32_t BlockAdd, uint32_t NumberOfBlocks);
 
+/* Queued transfers */
+HAL_StatusTypeDef HAL_SD_QueueRequest(SD_HandleTypeDef *hsd, SD_QueueRequestTypeDef *pReq);
+HAL_StatusTypeDef HAL_SD_QueueProcess(SD_HandleTypeDef *hsd);
+
+/* Asynchronous wait for the end of card programming */
+HAL_StatusTypeDef HAL_SD_WaitCardReady_IT(SD_HandleTypeDef *hsd);
+HAL_StatusTypeDef HAL_SD_PollCardReady(SD_HandleTypeDef *hsd);
+
 void HAL_SD_IRQHandler(SD_HandleTypeDef *hsd);
 
 /* Callback in non blocking modes (DMA) */
@@ -584,6 +639,8 @@ void HAL_SD_TxCpltCallback(SD_HandleTypeDef *hsd);
 void HAL_SD_RxCpltCallback(SD_HandleTypeDef *hsd);
 void HAL_SD_ErrorCallback(SD_HandleTypeDef *hsd);
 void HAL_SD_AbortCallback(SD_HandleTypeDef *hsd);
+void HAL_SD_CardReadyCallback(SD_HandleTypeDef *hsd);
+void HAL_SD_QueueCpltCallback(SD_HandleTypeDef *hsd, SD_QueueRequestTypeDef *pReq);
 /**
   * @}
   */
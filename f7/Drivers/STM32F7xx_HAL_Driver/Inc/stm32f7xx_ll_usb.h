@@ -89,7 +89,8 @@ typedef enum {
   HC_STALL,
   HC_XACTERR,
   HC_BBLERR,
-  HC_DATATGLERR
+  HC_DATATGLERR,
+  HC_NAK_RETRY       /* NAKed, retried on the next SOF (USE_HAL_HCD_NAK_DEFER) */
 }USB_OTG_HCStateTypeDef;
 
 /**
@@ -164,6 +165,8 @@ typedef struct
   uint32_t  xfer_len;       /*!< Current transfer length                                                  */
 
   uint32_t  xfer_count;     /*!< Partial transfer length in case of multi packet transfer                 */
+
+  uint32_t  xfer_size;      /*!< Transfer size programmed on an OUT endpoint                              */
 }USB_OTG_EPTypeDef;
 
 typedef struct
@@ -382,6 +385,9 @@ typedef struct
 #define USBx_INEP(i)    ((USB_OTG_INEndpointTypeDef *)(USBx_BASE + USB_OTG_IN_ENDPOINT_BASE + ((i) * USB_OTG_EP_REG_SIZE)))
 #define USBx_OUTEP(i)   ((USB_OTG_OUTEndpointTypeDef *)(USBx_BASE + USB_OTG_OUT_ENDPOINT_BASE + ((i) * USB_OTG_EP_REG_SIZE)))
 #define USBx_DFIFO(i)   *(__IO uint32_t *)(USBx_BASE + USB_OTG_FIFO_BASE + ((i) * USB_OTG_FIFO_SIZE))
+#if (USE_HAL_USB_CACHE_MAINTENANCE == 1U)
+#define USB_OTG_CACHE_LINE_SIZE   32U   /* Cortex-M7 D-cache line size in bytes */
+#endif /* USE_HAL_USB_CACHE_MAINTENANCE */
 
 #define USBx_HOST       ((USB_OTG_HostTypeDef *)(USBx_BASE + USB_OTG_HOST_BASE))
 #define USBx_HC(i)      ((USB_OTG_HostChannelTypeDef *)(USBx_BASE + USB_OTG_HOST_CHANNEL_BASE + ((i) * USB_OTG_HOST_CHANNEL_SIZE)))
@@ -56,6 +56,15 @@
 
      (#) Use HAL_DMA_Abort_IT() function to abort the current transfer
 
+     (#) With USE_HAL_DMA_CHECK set to 1 in stm32f7xx_hal_conf.h, meant for debug
+         builds, HAL_DMA_Start() and HAL_DMA_Start_IT() check the memory buffers of
+         each transfer: reachability by the stream, alignment on the memory data
+         size and, for cacheable memory per the MPU, on D-cache lines, cache
+         maintenance, buffers on the main stack and buffers shared with another
+         ongoing transfer. Violations are recorded in the HAL trace buffer with
+         the caller address and given to HAL_DMA_CheckCallback(); the transfer is
+         started anyway. HAL_DMA_CheckBuffer() checks the buffers of other masters.
+
      -@-   In Memory-to-Memory transfer mode, Circular mode is not allowed.
 
      -@-   The FIFO is used mainly to reduce bus usage and to allow data packing/unpacking: it is
@@ -133,6 +142,18 @@ typedef struct
   __IO uint32_t IFCR;  /*!< DMA interrupt flag clear register */
 } DMA_Base_Registers;
 
+#if (USE_HAL_DMA_CHECK == 1U)
+/* Memory buffer of a transfer started, to detect overlaps */
+typedef struct
+{
+  DMA_HandleTypeDef *hdma;     /* Stream, NULL for a free entry             */
+  uint32_t          Address;   /* Start of the buffer                       */
+  uint32_t          Size;      /* Size of the buffer in bytes               */
+  uint32_t          Write;     /* 1 when the stream writes the buffer       */
+  uint32_t          Side;      /* 1 for the destination of memory to memory */
+} DMA_CheckTransferTypeDef;
+#endif /* USE_HAL_DMA_CHECK */
+
 /* Private variables ---------------------------------------------------------*/
 /* Private constants ---------------------------------------------------------*/
 /** @addtogroup DMA_Private_Constants
@@ -142,6 +163,17 @@ typedef struct
 /**
   * @}
   */
+#if (USE_HAL_DMA_CACHE_MAINTENANCE == 1U)
+#define DMA_CACHE_LINE_SIZE    32U      /* Cortex-M7 D-cache line size in bytes */
+#endif /* USE_HAL_DMA_CACHE_MAINTENANCE */
+#if (USE_HAL_DMA_CHECK == 1U)
+#define DMA_CHECK_CACHE_LINE_SIZE       32U   /* Cortex-M7 D-cache line size in bytes         */
+#define DMA_CHECK_TRANSFERS             16U   /* Memory buffers of ongoing transfers followed */
+#define DMA_CHECK_POLICY_NONE           0U    /* Not cached                                   */
+#define DMA_CHECK_POLICY_WRITE_THROUGH  1U    /* Cached, write-through                        */
+#define DMA_CHECK_POLICY_WRITE_BACK     2U    /* Cached, write-back                           */
+#define DMA_ITCM_SIZE                   0x4000U /* ITCM RAM                                     */
+#endif /* USE_HAL_DMA_CHECK */
 /* Private macros ------------------------------------------------------------*/
 /* Private functions ---------------------------------------------------------*/
 /** @addtogroup DMA_Private_Functions
@@ -150,6 +182,15 @@ typedef struct
 static void DMA_SetConfig(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress, uint32_t DataLength);
 static uint32_t DMA_CalcBaseAndBitshift(DMA_HandleTypeDef *hdma);
 static HAL_StatusTypeDef DMA_CheckFifoParam(DMA_HandleTypeDef *hdma);
+#if (USE_HAL_DMA_CACHE_MAINTENANCE == 1U)
+static void DMA_CacheStart(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress, uint32_t DataLength);
+static void DMA_CacheEnd(DMA_HandleTypeDef *hdma, uint32_t Size);
+#endif /* USE_HAL_DMA_CACHE_MAINTENANCE */
+#if (USE_HAL_DMA_CHECK == 1U)
+static void DMA_CheckStart(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress, uint32_t DataLength, uint32_t Caller);
+static uint32_t DMA_CheckOverlap(DMA_HandleTypeDef *hdma, uint32_t Address, uint32_t Size, uint32_t Write, uint32_t Side);
+static uint32_t DMA_CheckCachePolicy(uint32_t Address);
+#endif /* USE_HAL_DMA_CHECK */
 
 /**
   * @}
@@ -440,6 +481,11 @@ HAL_StatusTypeDef HAL_DMA_Start(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, ui
     /* Initialize the error code */
     hdma->ErrorCode = HAL_DMA_ERROR_NONE;
     
+#if (USE_HAL_DMA_CHECK == 1U)
+    /* Check the memory buffers, debug builds */
+    DMA_CheckStart(hdma, SrcAddress, DstAddress, DataLength, __HAL_DMA_CALLER_ADDRESS());
+#endif /* USE_HAL_DMA_CHECK */
+
     /* Configure the source, destination address and the data length */
     DMA_SetConfig(hdma, SrcAddress, DstAddress, DataLength);
 
@@ -483,10 +529,16 @@ HAL_StatusTypeDef HAL_DMA_Start_IT(DMA_HandleTypeDef *hdma, uint32_t SrcAddress,
   {
     /* Change DMA peripheral state */
     hdma->State = HAL_DMA_STATE_BUSY;
+    __HAL_TRACE(HAL_TRACE_EVT_DMA_START, hdma->Instance);
     
     /* Initialize the error code */
     hdma->ErrorCode = HAL_DMA_ERROR_NONE;
     
+#if (USE_HAL_DMA_CHECK == 1U)
+    /* Check the memory buffers, debug builds */
+    DMA_CheckStart(hdma, SrcAddress, DstAddress, DataLength, __HAL_DMA_CALLER_ADDRESS());
+#endif /* USE_HAL_DMA_CHECK */
+
     /* Configure the source, destination address and the data length */
     DMA_SetConfig(hdma, SrcAddress, DstAddress, DataLength);
     
@@ -742,6 +794,11 @@ HAL_StatusTypeDef HAL_DMA_PollForTransfer(DMA_HandleTypeDef *hdma, HAL_DMA_Level
     /* Clear the half transfer and transfer complete flags */
     regs->IFCR = (DMA_FLAG_HTIF0_4 | DMA_FLAG_TCIF0_4) << hdma->StreamIndex;
     
+#if (USE_HAL_DMA_CACHE_MAINTENANCE == 1U)
+    /* Make the destination visible to the CPU */
+    DMA_CacheEnd(hdma, hdma->CacheSize);
+#endif /* USE_HAL_DMA_CACHE_MAINTENANCE */
+
     /* Process Unlocked */
     __HAL_UNLOCK(hdma);
 
@@ -851,6 +908,11 @@ void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
           hdma->Instance->CR  &= ~(DMA_IT_HT);
         }
         
+#if (USE_HAL_DMA_CACHE_MAINTENANCE == 1U)
+        /* Make the first half of the destination visible to the CPU */
+        DMA_CacheEnd(hdma, hdma->CacheSize / 2U);
+#endif /* USE_HAL_DMA_CACHE_MAINTENANCE */
+
         if(hdma->XferHalfCpltCallback != NULL)
         {
           /* Half transfer callback */
@@ -910,6 +972,7 @@ void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
         {
           if(hdma->XferCpltCallback != NULL)
           {
+            __HAL_TRACE(HAL_TRACE_EVT_DMA_CPLT, hdma->Instance);
             /* Transfer complete Callback for memory0 */
             hdma->XferCpltCallback(hdma);
           }
@@ -930,8 +993,14 @@ void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
           hdma->State = HAL_DMA_STATE_READY;
         }
 
+#if (USE_HAL_DMA_CACHE_MAINTENANCE == 1U)
+        /* Make the destination visible to the CPU */
+        DMA_CacheEnd(hdma, hdma->CacheSize);
+#endif /* USE_HAL_DMA_CACHE_MAINTENANCE */
+
         if(hdma->XferCpltCallback != NULL)
         {
+          __HAL_TRACE(HAL_TRACE_EVT_DMA_CPLT, hdma->Instance);
           /* Transfer complete callback */
           hdma->XferCpltCallback(hdma);
         }
@@ -967,6 +1036,7 @@ void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
 
     if(hdma->XferErrorCallback != NULL)
     {
+      __HAL_TRACE(HAL_TRACE_EVT_DMA_ERROR, hdma->Instance);
       /* Transfer error callback */
       hdma->XferErrorCallback(hdma);
     }
@@ -1148,6 +1218,143 @@ uint32_t HAL_DMA_GetError(DMA_HandleTypeDef *hdma)
   * @}
   */
 
+#if (USE_HAL_DMA_CHECK == 1U)
+/** @addtogroup DMA_Exported_Functions_Group4
+  *
+@verbatim
+ ===============================================================================
+                    ##### Buffer check functions #####
+ ===============================================================================
+    [..]
+    This subsection provides functions allowing to
+      (+) Check a transfer buffer against the bus matrix, its alignment, the
+          MPU and D-cache attributes of its memory and the stack
+      (+) Report the violations found in the trace buffer and to the
+          HAL_DMA_CheckCallback()
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Check a memory buffer of a transfer.
+  * @param  Master: register base of the master: DMA stream
+  * @param  Address: start of the buffer
+  * @param  Size: size of the buffer in bytes
+  * @param  Width: size in bytes of the memory accesses of the master, 1, 2 or 4
+  * @param  Write: 1 when the master writes the buffer, 0 when it reads it
+  * @retval Violations, a combination of @ref DMA_Check_Violations
+  */
+uint32_t HAL_DMA_CheckBuffer(uint32_t Master, uint32_t Address, uint32_t Size, uint32_t Width, uint32_t Write)
+{
+  uint32_t violations = 0U;
+  uint32_t policy;
+  uint32_t stacktop;
+
+  UNUSED(Master);
+
+  /* The masters reach the flash over AXI only, not over ITCM */
+  if((Address < (FLASHITCM_BASE + (FLASH_END - FLASHAXI_BASE) + 1U)) && ((Address + Size) > FLASHITCM_BASE))
+  {
+    violations |= HAL_DMA_CHECK_REACH;
+  }
+
+  if((Address & (Width - 1U)) != 0U)
+  {
+    violations |= HAL_DMA_CHECK_ALIGN_DATA;
+  }
+
+  /* D-cache: the master does not see the lines of a write-back buffer the
+     CPU has not cleaned, and the CPU must invalidate the lines of a buffer
+     written by the master without a neighbour sharing them */
+  policy = DMA_CheckCachePolicy(Address);
+  if(policy != DMA_CHECK_POLICY_NONE)
+  {
+    if(Write != 0U)
+    {
+      if(((Address | Size) & (DMA_CHECK_CACHE_LINE_SIZE - 1U)) != 0U)
+      {
+        violations |= HAL_DMA_CHECK_ALIGN_CACHE;
+      }
+#if (USE_HAL_DMA_CACHE_MAINTENANCE != 1U)
+      violations |= HAL_DMA_CHECK_CACHE;
+#endif /* USE_HAL_DMA_CACHE_MAINTENANCE */
+    }
+#if (USE_HAL_DMA_CACHE_MAINTENANCE != 1U)
+    else if(policy == DMA_CHECK_POLICY_WRITE_BACK)
+    {
+      violations |= HAL_DMA_CHECK_CACHE;
+    }
+#endif /* USE_HAL_DMA_CACHE_MAINTENANCE */
+    else
+    {
+      /* Write-through: memory is always up to date */
+    }
+  }
+
+  /* Main stack, from the stack pointer to the initial stack pointer held in
+     the first word of the vector table: the buffer is gone once the caller
+     returns */
+  stacktop = *(__IO uint32_t *)SCB->VTOR;
+  if((Address >= __get_MSP()) && (Address < stacktop))
+  {
+    violations |= HAL_DMA_CHECK_STACK;
+  }
+
+  return violations;
+}
+
+/**
+  * @brief  Report the violations found on a transfer buffer.
+  * @note   Three events are recorded in the trace buffer when USE_HAL_TRACE is
+  *         1: HAL_TRACE_EVT_DMA_CHECK with the caller, HAL_TRACE_EVT_DMA_BUF
+  *         with the buffer and HAL_TRACE_EVT_DMA_VIOL with the violations.
+  * @param  Master: register base of the master
+  * @param  Address: start of the buffer
+  * @param  Violations: combination of @ref DMA_Check_Violations, nothing is
+  *                     reported when 0
+  * @param  Caller: return address of the function starting the transfer
+  * @retval None
+  */
+void HAL_DMA_CheckReport(uint32_t Master, uint32_t Address, uint32_t Violations, uint32_t Caller)
+{
+  if(Violations != 0U)
+  {
+    __HAL_TRACE(HAL_TRACE_EVT_DMA_CHECK, Caller);
+    __HAL_TRACE(HAL_TRACE_EVT_DMA_BUF, Address);
+    __HAL_TRACE(HAL_TRACE_EVT_DMA_VIOL, Violations);
+
+    HAL_DMA_CheckCallback(Master, Address, Violations, Caller);
+  }
+}
+
+/**
+  * @brief  Buffer check violation callback.
+  * @note   This function should not be modified, when the callback is needed,
+  *         the HAL_DMA_CheckCallback could be implemented in the user file,
+  *         ex. to print the violations or to stop on a breakpoint. It is called
+  *         from the function starting the transfer, possibly in interrupt
+  *         context, the transfer being started anyway.
+  * @param  Master: register base of the master
+  * @param  Address: start of the buffer
+  * @param  Violations: combination of @ref DMA_Check_Violations
+  * @param  Caller: return address of the function starting the transfer
+  * @retval None
+  */
+__weak void HAL_DMA_CheckCallback(uint32_t Master, uint32_t Address, uint32_t Violations, uint32_t Caller)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Master);
+  UNUSED(Address);
+  UNUSED(Violations);
+  UNUSED(Caller);
+}
+
+/**
+  * @}
+  */
+#endif /* USE_HAL_DMA_CHECK */
+
 /**
   * @}
   */
@@ -1191,7 +1398,312 @@ static void DMA_SetConfig(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t
     /* Configure DMA Stream destination address */
     hdma->Instance->M0AR = DstAddress;
   }
+#if (USE_HAL_DMA_CACHE_MAINTENANCE == 1U)
+  /* Maintain the D-cache of the memory side of the transfer */
+  DMA_CacheStart(hdma, SrcAddress, DstAddress, DataLength);
+#endif /* USE_HAL_DMA_CACHE_MAINTENANCE */
+}
+
+#if (USE_HAL_DMA_CACHE_MAINTENANCE == 1U)
+/**
+  * @brief  Cleans the D-cache lines of the memory buffers of a transfer before
+  *         the stream is enabled, and records the destination range so that it
+  *         can be invalidated when the transfer completes.
+  * @note   On a destination sharing its first or last cache line with other
+  *         data, those lines are cleaned and invalidated instead of only
+  *         invalidated at completion, which is only safe if the CPU does not
+  *         write the neighbouring data while the transfer is ongoing. Buffers
+  *         taken from Utilities/DMA/dma_pool never share a line.
+  * @param  hdma       pointer to a DMA_HandleTypeDef structure that contains
+  *                     the configuration information for the specified DMA Stream.
+  * @param  SrcAddress The source memory Buffer address
+  * @param  DstAddress The destination memory Buffer address
+  * @param  DataLength The length of data to be transferred from source to destination
+  * @retval None
+  */
+static void DMA_CacheStart(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress, uint32_t DataLength)
+{
+  /* The data length counts items of the peripheral data size */
+  uint32_t size = DataLength << (hdma->Init.PeriphDataAlignment >> DMA_SxCR_PSIZE_Pos);
+  uint32_t start;
+
+  hdma->CacheAddress = 0U;
+  hdma->CacheSize = 0U;
+
+  if((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    if(hdma->Init.Direction != DMA_PERIPH_TO_MEMORY)
+    {
+      /* Write back the source buffer that the DMA is about to read */
+      start = SrcAddress & ~(DMA_CACHE_LINE_SIZE - 1U);
+      SCB_CleanDCache_by_Addr((uint32_t *)start, (int32_t)((SrcAddress + size) - start));
+    }
+
+    if(hdma->Init.Direction != DMA_MEMORY_TO_PERIPH)
+    {
+      /* No dirty line of the destination may be evicted during the transfer */
+      start = DstAddress & ~(DMA_CACHE_LINE_SIZE - 1U);
+      SCB_CleanInvalidateDCache_by_Addr((uint32_t *)start, (int32_t)((DstAddress + size) - start));
+
+      hdma->CacheAddress = DstAddress;
+      hdma->CacheSize = size;
+    }
+  }
+}
+
+/**
+  * @brief  Invalidates the D-cache lines of the first bytes of the destination
+  *         recorded by DMA_CacheStart(), so that the CPU reads what the DMA wrote.
+  * @param  hdma       pointer to a DMA_HandleTypeDef structure that contains
+  *                     the configuration information for the specified DMA Stream.
+  * @param  Size       Number of bytes from the start of the destination
+  * @retval None
+  */
+static void DMA_CacheEnd(DMA_HandleTypeDef *hdma, uint32_t Size)
+{
+  uint32_t start = hdma->CacheAddress;
+  uint32_t end = hdma->CacheAddress + Size;
+
+  if((Size != 0U) && ((SCB->CCR & SCB_CCR_DC_Msk) != 0U))
+  {
+    if(((start | end) & (DMA_CACHE_LINE_SIZE - 1U)) == 0U)
+    {
+      SCB_InvalidateDCache_by_Addr((uint32_t *)start, (int32_t)Size);
+    }
+    else
+    {
+      /* Keep the CPU data sharing the first and last lines */
+      start &= ~(DMA_CACHE_LINE_SIZE - 1U);
+      SCB_CleanInvalidateDCache_by_Addr((uint32_t *)start, (int32_t)(end - start));
+    }
+  }
+}
+#endif /* USE_HAL_DMA_CACHE_MAINTENANCE */
+
+#if (USE_HAL_DMA_CHECK == 1U)
+/**
+  * @brief  Check the memory buffers of a transfer being started, and that they
+  *         do not overlap the buffers of the other ongoing transfers.
+  * @param  hdma:       pointer to a DMA_HandleTypeDef structure that contains
+  *                     the configuration information for the specified DMA Stream.
+  * @param  SrcAddress: The source memory Buffer address
+  * @param  DstAddress: The destination memory Buffer address
+  * @param  DataLength: The length of data to be transferred from source to destination
+  * @param  Caller:     return address of HAL_DMA_Start() or HAL_DMA_Start_IT()
+  * @retval None
+  */
+static void DMA_CheckStart(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress, uint32_t DataLength, uint32_t Caller)
+{
+  uint32_t size = DataLength << (hdma->Init.PeriphDataAlignment >> DMA_SxCR_PSIZE_Pos);
+  uint32_t memwidth = 1UL << (hdma->Init.MemDataAlignment >> DMA_SxCR_MSIZE_Pos);
+  uint32_t violations;
+
+  if(hdma->Init.Direction == DMA_PERIPH_TO_MEMORY)
+  {
+    violations = HAL_DMA_CheckBuffer((uint32_t)hdma->Instance, DstAddress, size, memwidth, 1U);
+    violations |= DMA_CheckOverlap(hdma, DstAddress, size, 1U, 0U);
+    HAL_DMA_CheckReport((uint32_t)hdma->Instance, DstAddress, violations, Caller);
+  }
+  else if(hdma->Init.Direction == DMA_MEMORY_TO_PERIPH)
+  {
+    violations = HAL_DMA_CheckBuffer((uint32_t)hdma->Instance, SrcAddress, size, memwidth, 0U);
+    violations |= DMA_CheckOverlap(hdma, SrcAddress, size, 0U, 0U);
+    HAL_DMA_CheckReport((uint32_t)hdma->Instance, SrcAddress, violations, Caller);
+  }
+  else /* DMA_MEMORY_TO_MEMORY: the source is read through the peripheral port */
+  {
+    violations = HAL_DMA_CheckBuffer((uint32_t)hdma->Instance, SrcAddress, size,
+                                     1UL << (hdma->Init.PeriphDataAlignment >> DMA_SxCR_PSIZE_Pos), 0U);
+    violations |= DMA_CheckOverlap(hdma, SrcAddress, size, 0U, 0U);
+    HAL_DMA_CheckReport((uint32_t)hdma->Instance, SrcAddress, violations, Caller);
+
+    violations = HAL_DMA_CheckBuffer((uint32_t)hdma->Instance, DstAddress, size, memwidth, 1U);
+    violations |= DMA_CheckOverlap(hdma, DstAddress, size, 1U, 1U);
+    if((DstAddress < (SrcAddress + size)) && (SrcAddress < (DstAddress + size)))
+    {
+      violations |= HAL_DMA_CHECK_OVERLAP;
+    }
+    HAL_DMA_CheckReport((uint32_t)hdma->Instance, DstAddress, violations, Caller);
+  }
+}
+
+/**
+  * @brief  Record a buffer of a transfer being started, and check it against the
+  *         buffers of the other ongoing transfers: a buffer written by one of
+  *         them must not be shared.
+  * @note   Entries of transfers no longer ongoing are reused, so that no hook is
+  *         needed at the end of the transfers.
+  * @param  hdma:    pointer to a DMA_HandleTypeDef structure that contains
+  *                  the configuration information for the specified DMA Stream.
+  * @param  Address: start of the buffer
+  * @param  Size:    size of the buffer in bytes
+  * @param  Write:   1 when the stream writes the buffer
+  * @param  Side:    0 for the first memory buffer of the stream, 1 for the
+  *                  destination of a memory to memory transfer
+  * @retval HAL_DMA_CHECK_OVERLAP or 0
+  */
+static uint32_t DMA_CheckOverlap(DMA_HandleTypeDef *hdma, uint32_t Address, uint32_t Size, uint32_t Write, uint32_t Side)
+{
+  static DMA_CheckTransferTypeDef transfers[DMA_CHECK_TRANSFERS];
+  DMA_CheckTransferTypeDef *entry;
+  DMA_CheckTransferTypeDef *slot = NULL;
+  uint32_t violations = 0U;
+  uint32_t primask = __get_PRIMASK();
+  uint32_t i;
+
+  __disable_irq();
+  for(i = 0U; i < DMA_CHECK_TRANSFERS; i++)
+  {
+    entry = &transfers[i];
+    if(entry->hdma == hdma)
+    {
+      /* Buffers of this stream, the source of a memory to memory transfer
+         being checked against its destination by DMA_CheckStart() */
+      if(entry->Side == Side)
+      {
+        slot = entry;
+      }
+    }
+    else if((entry->hdma == NULL) || (entry->hdma->State != HAL_DMA_STATE_BUSY))
+    {
+      if(slot == NULL)
+      {
+        slot = entry;
+      }
+    }
+    else if(((Write != 0U) || (entry->Write != 0U)) &&
+            (Address < (entry->Address + entry->Size)) && (entry->Address < (Address + Size)))
+    {
+      violations = HAL_DMA_CHECK_OVERLAP;
+    }
+    else
+    {
+      /* Ongoing transfer, no conflict */
+    }
+  }
+
+  /* Without a free entry the buffer is not followed */
+  if(slot != NULL)
+  {
+    slot->hdma = hdma;
+    slot->Address = Address;
+    slot->Size = Size;
+    slot->Write = Write;
+    slot->Side = Side;
+  }
+  __set_PRIMASK(primask);
+
+  return violations;
+}
+
+/**
+  * @brief  Get the D-cache policy applied to an address, from the MPU regions or
+  *         the default memory map.
+  * @note   On the Cortex-M7, shareable normal memory is not cached.
+  * @param  Address: address to look up
+  * @retval DMA_CHECK_POLICY_NONE, DMA_CHECK_POLICY_WRITE_THROUGH or
+  *         DMA_CHECK_POLICY_WRITE_BACK
+  */
+static uint32_t DMA_CheckCachePolicy(uint32_t Address)
+{
+  uint32_t policy = DMA_CHECK_POLICY_NONE;
+  uint32_t found = 0U;
+  uint32_t primask;
+  uint32_t rnr;
+  uint32_t rasr;
+  uint32_t base;
+  uint32_t last;
+  uint32_t region;
+  uint32_t tex;
+  uint32_t cb;
+
+  /* D-cache off, or tightly coupled memory, never cached */
+  if(((SCB->CCR & SCB_CCR_DC_Msk) == 0U) ||
+     (Address < (RAMITCM_BASE + DMA_ITCM_SIZE)) ||
+     ((Address >= RAMDTCM_BASE) && (Address < SRAM1_BASE)))
+  {
+    return DMA_CHECK_POLICY_NONE;
+  }
+
+  if((MPU->CTRL & MPU_CTRL_ENABLE_Msk) != 0U)
+  {
+    primask = __get_PRIMASK();
+    __disable_irq();
+    rnr = MPU->RNR;
+
+    /* The highest region number matching the address wins */
+    region = (MPU->TYPE & MPU_TYPE_DREGION_Msk) >> MPU_TYPE_DREGION_Pos;
+    while((region > 0U) && (found == 0U))
+    {
+      region--;
+      MPU->RNR = region;
+      rasr = MPU->RASR;
+      base = MPU->RBAR & MPU_RBAR_ADDR_Msk;
+      last = (2UL << ((rasr & MPU_RASR_SIZE_Msk) >> MPU_RASR_SIZE_Pos)) - 1U;
+
+      if(((rasr & MPU_RASR_ENABLE_Msk) != 0U) && (Address >= base) && ((Address - base) <= last))
+      {
+        /* Eight subregions in regions of 256 bytes or more */
+        if((last < 255U) || ((rasr & (1UL << (MPU_RASR_SRD_Pos + ((Address - base) / ((last / 8U) + 1U))))) == 0U))
+        {
+          found = 1U;
+          tex = (rasr & MPU_RASR_TEX_Msk) >> MPU_RASR_TEX_Pos;
+          cb = (rasr & (MPU_RASR_C_Msk | MPU_RASR_B_Msk)) >> MPU_RASR_B_Pos;
+
+          if((rasr & MPU_RASR_S_Msk) != 0U)
+          {
+            /* Shareable: not cached */
+          }
+          else if((tex & 4U) != 0U)
+          {
+            /* Cacheable memory, inner policy in C and B */
+            policy = (cb == 2U) ? DMA_CHECK_POLICY_WRITE_THROUGH :
+                     ((cb != 0U) ? DMA_CHECK_POLICY_WRITE_BACK : DMA_CHECK_POLICY_NONE);
+          }
+          else if((tex == 0U) && (cb == 2U))
+          {
+            policy = DMA_CHECK_POLICY_WRITE_THROUGH;
+          }
+          else if(((tex == 0U) || (tex == 1U)) && (cb == 3U))
+          {
+            policy = DMA_CHECK_POLICY_WRITE_BACK;
+          }
+          else
+          {
+            /* Device, strongly ordered or non-cacheable */
+          }
+        }
+      }
+    }
+
+    MPU->RNR = rnr;
+    __set_PRIMASK(primask);
+
+    /* Without the background region, other addresses are not accessible */
+    if((found != 0U) || ((MPU->CTRL & MPU_CTRL_PRIVDEFENA_Msk) == 0U))
+    {
+      return policy;
+    }
+  }
+
+  /* Default memory map */
+  if((Address < 0x40000000U) || ((Address >= 0x60000000U) && (Address < 0x80000000U)))
+  {
+    /* Code region write-through, SRAM and external RAM regions write-back */
+    policy = (Address < 0x20000000U) ? DMA_CHECK_POLICY_WRITE_THROUGH : DMA_CHECK_POLICY_WRITE_BACK;
+  }
+  else if((Address >= 0x80000000U) && (Address < 0xA0000000U))
+  {
+    policy = DMA_CHECK_POLICY_WRITE_THROUGH;
+  }
+  else
+  {
+    /* Peripheral, device and system regions */
+  }
+
+  return policy;
 }
+#endif /* USE_HAL_DMA_CHECK */
 
 /**
   * @brief  Returns the DMA Stream base address depending on stream number
@@ -42,6 +42,9 @@
       (#)Prepare ETH DMA TX Descriptors and give the hand to ETH DMA to transfer 
          the frame to MAC TX FIFO:
          (##) HAL_ETH_TransmitFrame();
+         (##) Or map a batch of application buffer chains directly onto the
+              TX Descriptors, without copy: HAL_ETH_TransmitFrameChain();
+              HAL_ETH_TxFrameCpltCallback() is called when each frame is sent
 
       (#)Poll for a received frame in ETH RX DMA Descriptors and get received 
          frame parameters
@@ -50,6 +53,10 @@
       (#) Get a received frame when an ETH RX interrupt occurs:
          (##) HAL_ETH_GetReceivedFrame_IT(); (called in IT mode only)
 
+      (#) Get checksum status, VLAN tag and timestamp of the received frames, in
+          reception order, once the ring is set by HAL_ETH_ConfigPacketMetaRing():
+         (##) HAL_ETH_GetPacketMeta();
+
       (#) Communicate with external PHY device:
          (##) Read a specific register from the PHY  
               HAL_ETH_ReadPHYRegister();
@@ -62,6 +69,12 @@
       (#) Configure the Ethernet DMA after ETH peripheral initialization
           HAL_ETH_ConfigDMA(); all DMA parameters should be filled.
 
+      (#) Moderate the Ethernet interrupts at high frame rates, before HAL_ETH_Start():
+          HAL_ETH_ConfigITModeration(); one Rx descriptor out of RxFrameCount requests
+          the receive interrupt, the receive status watchdog raises it for the ones
+          received after, and one frame out of TxFrameCount sent by
+          HAL_ETH_TransmitFrame() requests the transmit interrupt.
+
   @endverbatim
   ******************************************************************************
   * @attention
@@ -137,6 +150,8 @@ static void ETH_DMATransmissionDisable(ETH_HandleTypeDef *heth);
 static void ETH_DMAReceptionEnable(ETH_HandleTypeDef *heth);
 static void ETH_DMAReceptionDisable(ETH_HandleTypeDef *heth);
 static void ETH_FlushTransmitFIFO(ETH_HandleTypeDef *heth);
+static void ETH_PacketMetaPush(ETH_HandleTypeDef *heth);
+static void ETH_TxFrameITConfig(ETH_HandleTypeDef *heth, ETH_DMADescTypeDef *dmatxdesc);
 
 /**
   * @}
@@ -483,6 +498,12 @@ HAL_StatusTypeDef HAL_ETH_DMATxDescListInit(ETH_HandleTypeDef *heth, ETH_DMADesc
   /* Set the DMATxDescToSet pointer with the first one of the DMATxDescTab list */
   heth->TxDesc = DMATxDescTab;
   
+  /* Keep the list and buffers, to restore the descriptors used by HAL_ETH_TransmitFrameChain() */
+  heth->TxDescTab = DMATxDescTab;
+  heth->TxBuffTab = TxBuff;
+  heth->pTxFrameHead = NULL;
+  heth->pTxFrameTail = NULL;
+  
   /* Fill each DMATxDesc descriptor with the right values */   
   for(i=0; i < TxBuffCount; i++)
   {
@@ -715,6 +736,8 @@ HAL_StatusTypeDef HAL_ETH_TransmitFrame(ETH_HandleTypeDef *heth, uint32_t FrameL
     heth->TxDesc->Status |=ETH_DMATXDESC_FS|ETH_DMATXDESC_LS;
     /* Set frame size */
     heth->TxDesc->ControlBufferSize = (FrameLength & ETH_DMATXDESC_TBS1);
+    /* Request the transmit interrupt when moderated */
+    ETH_TxFrameITConfig(heth, heth->TxDesc);
     /* Set Own bit of the Tx descriptor Status: gives the buffer back to ETHERNET DMA */
     heth->TxDesc->Status |= ETH_DMATXDESC_OWN;
     /* Point to next descriptor */
@@ -724,9 +747,9 @@ HAL_StatusTypeDef HAL_ETH_TransmitFrame(ETH_HandleTypeDef *heth, uint32_t FrameL
   {
     for (i=0; i< bufcount; i++)
     {
-      /* Clear FIRST and LAST segment bits */
-      heth->TxDesc->Status &= ~(ETH_DMATXDESC_FS | ETH_DMATXDESC_LS);
-      
+      /* Clear FIRST and LAST segment and interrupt on completion bits */
+      heth->TxDesc->Status &= ~(ETH_DMATXDESC_FS | ETH_DMATXDESC_LS | ETH_DMATXDESC_IC);
+
       if (i == 0) 
       {
         /* Setting the first segment bit */
@@ -742,6 +765,8 @@ HAL_StatusTypeDef HAL_ETH_TransmitFrame(ETH_HandleTypeDef *heth, uint32_t FrameL
         heth->TxDesc->Status |= ETH_DMATXDESC_LS;
         size = FrameLength - (bufcount-1)*ETH_TX_BUF_SIZE;
         heth->TxDesc->ControlBufferSize = (size & ETH_DMATXDESC_TBS1);
+        /* Request the transmit interrupt when moderated */
+        ETH_TxFrameITConfig(heth, heth->TxDesc);
       }
       
       /* Set Own bit of the Tx descriptor Status: gives the buffer back to ETHERNET DMA */
@@ -770,6 +795,250 @@ HAL_StatusTypeDef HAL_ETH_TransmitFrame(ETH_HandleTypeDef *heth, uint32_t FrameL
   return HAL_OK;
 }
 
+/**
+  * @brief  Sends a batch of Ethernet frames without copy: each buffer of each
+  *         frame is mapped onto its own Tx descriptor, and the DMA is resumed
+  *         once for the whole batch. Only the last descriptor of the batch
+  *         requests the transmit complete interrupt.
+  * @note   The buffers must not be modified until HAL_ETH_TxFrameCpltCallback()
+  *         is called for their frame. Completed frames are released from
+  *         HAL_ETH_IRQHandler(), or by HAL_ETH_ReleaseTxFrames() in polling mode.
+  * @param  heth pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pFrames pointer to the first ETH_TxFrameTypeDef of the batch
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_TransmitFrameChain(ETH_HandleTypeDef *heth, ETH_TxFrameTypeDef *pFrames)
+{
+  ETH_TxFrameTypeDef *frame;
+  ETH_TxBufferTypeDef *txbuffer;
+  ETH_DMADescTypeDef *dmatxdesc, *firstdesc;
+  uint32_t desccount = 0U, i = 0U;
+  uint32_t primask;
+  
+  if ((pFrames == NULL) || (heth->TxDescTab == NULL))
+  {
+    return HAL_ERROR;
+  }
+  
+  /* Give back the descriptors of the frames already sent */
+  HAL_ETH_ReleaseTxFrames(heth);
+  
+  /* Process Locked */
+  __HAL_LOCK(heth);
+  
+  /* Set the ETH peripheral state to BUSY */
+  heth->State = HAL_ETH_STATE_BUSY;
+  
+  /* Get the number of needed Tx descriptors for the batch */
+  for (frame = pFrames; frame != NULL; frame = frame->pNext)
+  {
+    if (frame->pBuffers == NULL)
+    {
+      desccount = 0U;
+      break;
+    }
+    for (txbuffer = frame->pBuffers; txbuffer != NULL; txbuffer = txbuffer->next)
+    {
+      if ((txbuffer->len == 0U) || (txbuffer->len > ETH_DMATXDESC_TBS1))
+      {
+        break;
+      }
+      desccount++;
+    }
+    if (txbuffer != NULL)
+    {
+      desccount = 0U;
+      break;
+    }
+  }
+  
+  if (desccount == 0U)
+  {
+    /* Set ETH HAL state to READY */
+    heth->State = HAL_ETH_STATE_READY;
+    
+    /* Process Unlocked */
+    __HAL_UNLOCK(heth);
+    
+    return HAL_ERROR;
+  }
+  
+  /* Check that the descriptors are owned by the CPU and not used by a frame in flight */
+  dmatxdesc = heth->TxDesc;
+  for (i = 0U; i < desccount; i++)
+  {
+    if (((dmatxdesc->Status & ETH_DMATXDESC_OWN) != (uint32_t)RESET) ||
+        ((heth->pTxFrameHead != NULL) && (dmatxdesc == heth->pTxFrameHead->pFirstDesc)))
+    {
+      /* Set ETH HAL state to READY */
+      heth->State = HAL_ETH_STATE_READY;
+      
+      /* Process Unlocked */
+      __HAL_UNLOCK(heth);
+      
+      return HAL_BUSY;
+    }
+    dmatxdesc = (ETH_DMADescTypeDef *)(dmatxdesc->Buffer2NextDescAddr);
+  }
+  
+  /* The first descriptor of the batch is given to the DMA last, so that the
+     DMA does not start on a partially built batch */
+  firstdesc = heth->TxDesc;
+  dmatxdesc = heth->TxDesc;
+  for (frame = pFrames; frame != NULL; frame = frame->pNext)
+  {
+    frame->pFirstDesc = dmatxdesc;
+    
+    for (txbuffer = frame->pBuffers; txbuffer != NULL; txbuffer = txbuffer->next)
+    {
+#if (__DCACHE_PRESENT == 1U)
+      if ((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+      {
+        /* Write the buffer data back to memory before the DMA reads it */
+        SCB_CleanDCache_by_Addr((uint32_t *)txbuffer->buffer, (int32_t)txbuffer->len);
+      }
+#endif /* __DCACHE_PRESENT */
+      
+      /* Map the buffer onto the descriptor */
+      dmatxdesc->Buffer1Addr = (uint32_t)txbuffer->buffer;
+      dmatxdesc->ControlBufferSize = (txbuffer->len & ETH_DMATXDESC_TBS1);
+      
+      /* Clear FIRST and LAST segment and interrupt on completion bits */
+      dmatxdesc->Status &= ~(ETH_DMATXDESC_FS | ETH_DMATXDESC_LS | ETH_DMATXDESC_IC);
+      
+      if (txbuffer == frame->pBuffers)
+      {
+        /* Setting the first segment bit */
+        dmatxdesc->Status |= ETH_DMATXDESC_FS;
+      }
+      
+      if (txbuffer->next == NULL)
+      {
+        /* Setting the last segment bit */
+        dmatxdesc->Status |= ETH_DMATXDESC_LS;
+        frame->pLastDesc = dmatxdesc;
+        
+        if (frame->pNext == NULL)
+        {
+          /* Interrupt once the whole batch is sent */
+          dmatxdesc->Status |= ETH_DMATXDESC_IC;
+        }
+      }
+      
+      if (dmatxdesc != firstdesc)
+      {
+        /* Set Own bit of the Tx descriptor Status: gives the buffer back to ETHERNET DMA */
+        dmatxdesc->Status |= ETH_DMATXDESC_OWN;
+      }
+      
+      /* Point to next descriptor */
+      dmatxdesc = (ETH_DMADescTypeDef *)(dmatxdesc->Buffer2NextDescAddr);
+    }
+  }
+  
+  /* Append the batch to the frames in flight */
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (heth->pTxFrameTail == NULL)
+  {
+    heth->pTxFrameHead = pFrames;
+  }
+  else
+  {
+    heth->pTxFrameTail->pNext = pFrames;
+  }
+  for (frame = pFrames; frame->pNext != NULL; frame = frame->pNext)
+  {
+  }
+  heth->pTxFrameTail = frame;
+  __set_PRIMASK(primask);
+  
+  heth->TxDesc = dmatxdesc;
+  
+  /* Make sure the descriptors are written before giving the batch to the DMA */
+  __DMB();
+  firstdesc->Status |= ETH_DMATXDESC_OWN;
+  
+  /* When Tx Buffer unavailable flag is set: clear it and resume transmission */
+  if (((heth->Instance)->DMASR & ETH_DMASR_TBUS) != (uint32_t)RESET)
+  {
+    /* Clear TBUS ETHERNET DMA flag */
+    (heth->Instance)->DMASR = ETH_DMASR_TBUS;
+    /* Resume DMA transmission*/
+    (heth->Instance)->DMATPDR = 0U;
+  }
+  
+  /* Set ETH HAL State to Ready */
+  heth->State = HAL_ETH_STATE_READY;
+  
+  /* Process Unlocked */
+  __HAL_UNLOCK(heth);
+  
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Releases the frames sent by HAL_ETH_TransmitFrameChain(): their Tx
+  *         descriptors get back the buffers given to HAL_ETH_DMATxDescListInit()
+  *         and HAL_ETH_TxFrameCpltCallback() is called for each frame.
+  * @note   Called from HAL_ETH_IRQHandler(), to be called by the application
+  *         in polling mode, and before HAL_ETH_TransmitFrame() when both are used.
+  * @param  heth pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @retval None
+  */
+void HAL_ETH_ReleaseTxFrames(ETH_HandleTypeDef *heth)
+{
+  ETH_TxFrameTypeDef *frame;
+  ETH_DMADescTypeDef *dmatxdesc;
+  uint32_t primask;
+  
+  for (;;)
+  {
+    primask = __get_PRIMASK();
+    __disable_irq();
+    frame = heth->pTxFrameHead;
+    if ((frame != NULL) && ((frame->pLastDesc->Status & ETH_DMATXDESC_OWN) == (uint32_t)RESET))
+    {
+      heth->pTxFrameHead = frame->pNext;
+      if (heth->pTxFrameHead == NULL)
+      {
+        heth->pTxFrameTail = NULL;
+      }
+    }
+    else
+    {
+      frame = NULL;
+    }
+    __set_PRIMASK(primask);
+    
+    if (frame == NULL)
+    {
+      break;
+    }
+    
+    /* Restore the driver buffers of the frame descriptors */
+    dmatxdesc = frame->pFirstDesc;
+    for (;;)
+    {
+      dmatxdesc->Buffer1Addr = (uint32_t)(&heth->TxBuffTab[(uint32_t)(dmatxdesc - heth->TxDescTab) * ETH_TX_BUF_SIZE]);
+      dmatxdesc->Status &= ~(ETH_DMATXDESC_FS | ETH_DMATXDESC_LS | ETH_DMATXDESC_IC);
+      if (dmatxdesc == frame->pLastDesc)
+      {
+        break;
+      }
+      dmatxdesc = (ETH_DMADescTypeDef *)(dmatxdesc->Buffer2NextDescAddr);
+    }
+    
+    frame->pNext = NULL;
+    
+    /* Frame transmitted callback */
+    HAL_ETH_TxFrameCpltCallback(heth, frame);
+  }
+}
+
 /**
   * @brief  Checks for received frames. 
   * @param  heth pointer to a ETH_HandleTypeDef structure that contains
@@ -810,6 +1079,9 @@ HAL_StatusTypeDef HAL_ETH_GetReceivedFrame(ETH_HandleTypeDef *heth)
       
       /* Get the address of the buffer start address */
       heth->RxFrameInfos.buffer = ((heth->RxFrameInfos).FSRxDesc)->Buffer1Addr;
+      
+      /* Add the frame metadata to the ring */
+      ETH_PacketMetaPush(heth);
       /* point to next descriptor */
       heth->RxDesc = (ETH_DMADescTypeDef*) ((heth->RxDesc)->Buffer2NextDescAddr);
       
@@ -911,6 +1183,9 @@ HAL_StatusTypeDef HAL_ETH_GetReceivedFrame_IT(ETH_HandleTypeDef *heth)
       /* Get the address of the buffer start address */ 
       heth->RxFrameInfos.buffer =((heth->RxFrameInfos).FSRxDesc)->Buffer1Addr;
       
+      /* Add the frame metadata to the ring */
+      ETH_PacketMetaPush(heth);
+      
       /* Point to next descriptor */      
       heth->RxDesc = (ETH_DMADescTypeDef*) (heth->RxDesc->Buffer2NextDescAddr);
       
@@ -935,6 +1210,66 @@ HAL_StatusTypeDef HAL_ETH_GetReceivedFrame_IT(ETH_HandleTypeDef *heth)
   return HAL_ERROR;
 }
 
+/**
+  * @brief  Configures the Rx packet metadata ring. The driver then fills one
+  *         entry for each received packet, carrying its checksum status, VLAN
+  *         tag and hardware timestamp. A NULL pEntries disables the ring.
+  * @param  heth pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pEntries pointer to the ring entries
+  * @param  Size number of entries, at least 2
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_ConfigPacketMetaRing(ETH_HandleTypeDef *heth, ETH_PacketMetaTypeDef *pEntries, uint32_t Size)
+{
+  if ((pEntries != NULL) && (Size < 2U))
+  {
+    return HAL_ERROR;
+  }
+  
+  heth->MetaRing.pEntries = NULL;
+  heth->MetaRing.Size = Size;
+  heth->MetaRing.Head = 0U;
+  heth->MetaRing.Tail = 0U;
+  heth->MetaRing.Dropped = 0U;
+  heth->MetaRing.pEntries = pEntries;
+  
+  return HAL_OK;
+}
+
+/**
+  * @brief  Gets the metadata of the oldest received packet from the ring.
+  *         Metadata are read in the order the packets were received.
+  * @param  heth pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pMeta pointer to a ETH_PacketMetaTypeDef structure to fill
+  * @retval HAL status: HAL_ERROR if the ring is empty
+  */
+HAL_StatusTypeDef HAL_ETH_GetPacketMeta(ETH_HandleTypeDef *heth, ETH_PacketMetaTypeDef *pMeta)
+{
+  ETH_PacketMetaRingTypeDef *ring = &heth->MetaRing;
+  uint32_t tail = ring->Tail;
+  
+  if ((ring->pEntries == NULL) || (tail == ring->Head))
+  {
+    return HAL_ERROR;
+  }
+  
+  *pMeta = ring->pEntries[tail];
+  
+  tail++;
+  if (tail == ring->Size)
+  {
+    tail = 0U;
+  }
+  
+  /* Release the entry once read */
+  __DMB();
+  ring->Tail = tail;
+  
+  return HAL_OK;
+}
+
 /**
   * @brief  This function handles ETH interrupt request.
   * @param  heth pointer to a ETH_HandleTypeDef structure that contains
@@ -946,6 +1281,7 @@ void HAL_ETH_IRQHandler(ETH_HandleTypeDef *heth)
   /* Frame received */
   if (__HAL_ETH_DMA_GET_FLAG(heth, ETH_DMA_FLAG_R)) 
   {
+    __HAL_TRACE(HAL_TRACE_EVT_ETH_RX, heth->Instance);
     /* Receive complete callback */
     HAL_ETH_RxCpltCallback(heth);
     
@@ -962,6 +1298,9 @@ void HAL_ETH_IRQHandler(ETH_HandleTypeDef *heth)
   /* Frame transmitted */
   else if (__HAL_ETH_DMA_GET_FLAG(heth, ETH_DMA_FLAG_T)) 
   {
+    /* Release the frames sent by HAL_ETH_TransmitFrameChain() */
+    HAL_ETH_ReleaseTxFrames(heth);
+    
     /* Transfer complete callback */
     HAL_ETH_TxCpltCallback(heth);
     
@@ -1011,6 +1350,24 @@ __weak void HAL_ETH_TxCpltCallback(ETH_HandleTypeDef *heth)
   */ 
 }
 
+/**
+  * @brief  Tx frame completed callback, called for each frame sent by
+  *         HAL_ETH_TransmitFrameChain(). Its buffers can be reused.
+  * @param  heth pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pFrame pointer to the sent ETH_TxFrameTypeDef
+  * @retval None
+  */
+__weak void HAL_ETH_TxFrameCpltCallback(ETH_HandleTypeDef *heth, ETH_TxFrameTypeDef *pFrame)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(heth);
+  UNUSED(pFrame);
+  /* NOTE : This function Should not be modified, when the callback is needed,
+  the HAL_ETH_TxFrameCpltCallback could be implemented in the user file
+  */ 
+}
+
 /**
   * @brief  Rx Transfer completed callbacks.
   * @param  heth pointer to a ETH_HandleTypeDef structure that contains
@@ -1544,6 +1901,83 @@ HAL_StatusTypeDef HAL_ETH_ConfigDMA(ETH_HandleTypeDef *heth, ETH_DMAInitTypeDef
    return HAL_OK; 
 }
 
+/**
+  * @brief  Configures the Rx and Tx interrupt moderation.
+  * @note   To be called before HAL_ETH_Start(), once the Rx descriptors are
+  *         initialized. One Rx descriptor out of RxFrameCount then requests the
+  *         receive interrupt, and the receive status watchdog raises it for the
+  *         descriptors completed after. One frame out of TxFrameCount sent by
+  *         HAL_ETH_TransmitFrame() requests the transmit interrupt, which is
+  *         enabled, as well as the frame filling up the Tx descriptors.
+  * @note   As one receive interrupt can cover several frames, the application
+  *         reads them all, until HAL_ETH_GetReceivedFrame_IT() returns HAL_ERROR.
+  * @param  heth pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pConfig pointer to a ETH_ITModerationTypeDef structure that contains
+  *         the interrupt moderation thresholds
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_ConfigITModeration(ETH_HandleTypeDef *heth, ETH_ITModerationTypeDef *pConfig)
+{
+  ETH_DMADescTypeDef *dmarxdesc;
+  uint32_t i = 0U;
+
+  if ((pConfig == NULL) || (heth->RxDesc == NULL) || (pConfig->RxWatchdog > 0xFFU) ||
+      ((pConfig->RxFrameCount > 1U) && (pConfig->RxWatchdog == 0U)))
+  {
+    return HAL_ERROR;
+  }
+
+  /* The Rx descriptors cannot be changed while the DMA reception runs */
+  if (((heth->Instance)->DMAOMR & ETH_DMAOMR_SR) != (uint32_t)RESET)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Process Locked */
+  __HAL_LOCK(heth);
+
+  /* Set the ETH peripheral state to BUSY */
+  heth->State = HAL_ETH_STATE_BUSY;
+
+  heth->ITModeration = *pConfig;
+  heth->TxFramesNoIT = 0U;
+
+  /* Disable the interrupt on completion of all the Rx descriptors but one out of RxFrameCount */
+  dmarxdesc = heth->RxDesc;
+  do
+  {
+    i++;
+    if ((pConfig->RxFrameCount <= 1U) || ((i % pConfig->RxFrameCount) == 0U))
+    {
+      dmarxdesc->ControlBufferSize &= ~ETH_DMARXDESC_DIC;
+    }
+    else
+    {
+      dmarxdesc->ControlBufferSize |= ETH_DMARXDESC_DIC;
+    }
+    dmarxdesc = (ETH_DMADescTypeDef *)(dmarxdesc->Buffer2NextDescAddr);
+  } while (dmarxdesc != heth->RxDesc);
+
+  /* Set the receive status watchdog timer count */
+  (heth->Instance)->DMARSWTR = pConfig->RxWatchdog;
+
+  if (pConfig->TxFrameCount != 0U)
+  {
+    /* Enable the Ethernet Tx Interrupt */
+    __HAL_ETH_DMA_ENABLE_IT((heth), ETH_DMA_IT_NIS | ETH_DMA_IT_T);
+  }
+
+  /* Set the ETH state to Ready */
+  heth->State = HAL_ETH_STATE_READY;
+
+  /* Process Unlocked */
+  __HAL_UNLOCK(heth);
+
+  /* Return function status */
+  return HAL_OK;
+}
+
 /**
   * @}
   */
@@ -2026,6 +2460,107 @@ static void ETH_FlushTransmitFIFO(ETH_HandleTypeDef *heth)
   (heth->Instance)->DMAOMR = tmpreg;
 }
 
+/**
+  * @brief  Sets the interrupt on completion bit of the last Tx descriptor of a
+  *         frame sent by HAL_ETH_TransmitFrame(), once every TxFrameCount frames
+  *         and when the next descriptor is still owned by the DMA.
+  * @param  heth pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  dmatxdesc last Tx descriptor of the frame
+  * @retval None
+  */
+static void ETH_TxFrameITConfig(ETH_HandleTypeDef *heth, ETH_DMADescTypeDef *dmatxdesc)
+{
+  if (heth->ITModeration.TxFrameCount != 0U)
+  {
+    heth->TxFramesNoIT++;
+
+    if ((heth->TxFramesNoIT >= heth->ITModeration.TxFrameCount) ||
+        ((((ETH_DMADescTypeDef *)(dmatxdesc->Buffer2NextDescAddr))->Status & ETH_DMATXDESC_OWN) != (uint32_t)RESET))
+    {
+      heth->TxFramesNoIT = 0U;
+      dmatxdesc->Status |= ETH_DMATXDESC_IC;
+    }
+    else
+    {
+      dmatxdesc->Status &= ~ETH_DMATXDESC_IC;
+    }
+  }
+}
+
+/**
+  * @brief  Adds the metadata of the last received frame to the packet
+  *         metadata ring, from the enhanced Rx descriptor status.
+  * @param  heth pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @retval None
+  */
+static void ETH_PacketMetaPush(ETH_HandleTypeDef *heth)
+{
+  ETH_PacketMetaRingTypeDef *ring = &heth->MetaRing;
+  ETH_DMADescTypeDef *lsdesc = heth->RxFrameInfos.LSRxDesc;
+  ETH_PacketMetaTypeDef meta;
+  uint8_t *frame;
+  uint32_t head;
+  
+  if (ring->pEntries == NULL)
+  {
+    return;
+  }
+  
+  meta.Length = heth->RxFrameInfos.length;
+  meta.Checksum = ETH_META_CHECKSUM_BYPASSED;
+  meta.VlanTag = 0U;
+  meta.TimeStamp = 0U;
+  
+  /* Extended status is available for IP packets when the checksum offload is enabled */
+  if (((lsdesc->Status & ETH_DMARXDESC_ESA) != (uint32_t)RESET) &&
+      ((lsdesc->ExtendedStatus & ETH_DMAPTPRXDESC_IPCB) == (uint32_t)RESET) &&
+      ((lsdesc->ExtendedStatus & (ETH_DMAPTPRXDESC_IPV4PR | ETH_DMAPTPRXDESC_IPV6PR)) != (uint32_t)RESET))
+  {
+    meta.Checksum = ETH_META_CHECKSUM_OK;
+    if ((lsdesc->ExtendedStatus & ETH_DMAPTPRXDESC_IPHE) != (uint32_t)RESET)
+    {
+      meta.Checksum |= ETH_META_CHECKSUM_IP_HEADER_ERROR;
+    }
+    if ((lsdesc->ExtendedStatus & ETH_DMAPTPRXDESC_IPPE) != (uint32_t)RESET)
+    {
+      meta.Checksum |= ETH_META_CHECKSUM_IP_PAYLOAD_ERROR;
+    }
+  }
+  
+  /* The MAC does not strip the tag: read it after the source address */
+  if ((lsdesc->Status & ETH_DMARXDESC_VLAN) != (uint32_t)RESET)
+  {
+    frame = (uint8_t *)heth->RxFrameInfos.buffer;
+    meta.VlanTag = ((uint32_t)frame[14U] << 8U) | (uint32_t)frame[15U];
+  }
+  
+  if ((lsdesc->Status & ETH_DMARXDESC_TSV) != (uint32_t)RESET)
+  {
+    meta.TimeStamp = ((uint64_t)lsdesc->TimeStampHigh << 32U) | (uint64_t)lsdesc->TimeStampLow;
+  }
+  
+  head = ring->Head + 1U;
+  if (head == ring->Size)
+  {
+    head = 0U;
+  }
+  
+  if (head == ring->Tail)
+  {
+    /* Ring is full */
+    ring->Dropped++;
+    return;
+  }
+  
+  ring->pEntries[ring->Head] = meta;
+  
+  /* Publish the entry once written */
+  __DMB();
+  ring->Head = head;
+}
+
 /**
   * @}
   */
@@ -38,6 +38,24 @@
     (#)Enable HCD transmission and reception:
         (##) HAL_HCD_Start();
 
+    (#) With Init.dma_enable set, the OTG internal DMA moves the channel data
+        and USE_HAL_USB_CACHE_MAINTENANCE in hal_conf.h lets the driver keep
+        the D-cache coherent: transmit buffers are cleaned, receive buffers
+        cleaned and invalidated when the transfer starts, and invalidated
+        over the received bytes when it completes. Buffers must be word
+        aligned; receive buffers should start on a 32-byte cache line and
+        span whole lines (for example from the dma_pool utility), so that no
+        CPU data shares their lines.
+
+    (#) With USE_HAL_HCD_NAK_DEFER set in hal_conf.h, a bulk or control
+        channel halted on a NAK is not re-armed from the halt interrupt but
+        on the next SOF, that is one frame (full speed) or microframe (high
+        speed) later. IN channels are re-enabled by the driver; for OUT
+        channels the URB_NOTREADY state is only reported on that SOF, so
+        that the upper layer resending from HAL_HCD_HC_NotifyURBChange_Callback
+        or from its polling loop retries at most once per (micro)frame
+        instead of flooding the core with NAKed transactions.
+
   @endverbatim
   ******************************************************************************
   * @attention
@@ -95,6 +113,13 @@ static void HCD_HC_IN_IRQHandler(HCD_HandleTypeDef *hhcd, uint8_t chnum);
 static void HCD_HC_OUT_IRQHandler(HCD_HandleTypeDef *hhcd, uint8_t chnum);
 static void HCD_RXQLVL_IRQHandler(HCD_HandleTypeDef *hhcd);
 static void HCD_Port_IRQHandler(HCD_HandleTypeDef *hhcd);
+#if (USE_HAL_HCD_NAK_DEFER == 1U)
+static void HCD_NakRetry(HCD_HandleTypeDef *hhcd);
+#endif /* USE_HAL_HCD_NAK_DEFER */
+#if (USE_HAL_USB_CACHE_MAINTENANCE == 1U)
+static void HCD_CacheStart(uint8_t *pBuf, uint32_t len, uint8_t rx);
+static void HCD_CacheEnd(uint8_t *pBuf, uint32_t len);
+#endif /* USE_HAL_USB_CACHE_MAINTENANCE */
 /**
   * @}
   */
@@ -213,6 +238,9 @@ HAL_StatusTypeDef HAL_HCD_HC_Init(HCD_HandleTypeDef *hhcd,
   }
 
   hhcd->hc[ch_num].speed = speed;
+#if (USE_HAL_HCD_NAK_DEFER == 1U)
+  hhcd->hc[ch_num].state = HC_IDLE;
+#endif /* USE_HAL_HCD_NAK_DEFER */
 
   status =  USB_HC_Init(hhcd->Instance,
                         ch_num,
@@ -238,6 +266,13 @@ HAL_StatusTypeDef HAL_HCD_HC_Halt(HCD_HandleTypeDef *hhcd, uint8_t ch_num)
   HAL_StatusTypeDef status = HAL_OK;
 
   __HAL_LOCK(hhcd);
+#if (USE_HAL_HCD_NAK_DEFER == 1U)
+  /* Cancel a pending NAK retry */
+  if (hhcd->hc[ch_num].state == HC_NAK_RETRY)
+  {
+    hhcd->hc[ch_num].state = HC_HALTED;
+  }
+#endif /* USE_HAL_HCD_NAK_DEFER */
   (void)USB_HC_Halt(hhcd->Instance, (uint8_t)ch_num);
   __HAL_UNLOCK(hhcd);
 
@@ -454,6 +489,13 @@ HAL_StatusTypeDef HAL_HCD_HC_SubmitRequest(HCD_HandleTypeDef *hhcd,
   hhcd->hc[ch_num].ch_num = ch_num;
   hhcd->hc[ch_num].state = HC_IDLE;
 
+#if (USE_HAL_USB_CACHE_MAINTENANCE == 1U)
+  if (hhcd->Init.dma_enable == 1U)
+  {
+    HCD_CacheStart(pbuff, length, direction);
+  }
+#endif /* USE_HAL_USB_CACHE_MAINTENANCE */
+
   return USB_HC_StartXfer(hhcd->Instance, &hhcd->hc[ch_num], (uint8_t)hhcd->Init.dma_enable);
 }
 
@@ -524,6 +566,9 @@ void HAL_HCD_IRQHandler(HCD_HandleTypeDef *hhcd)
     /* Handle Host SOF Interrupts */
     if(__HAL_HCD_GET_FLAG(hhcd, USB_OTG_GINTSTS_SOF))
     {
+#if (USE_HAL_HCD_NAK_DEFER == 1U)
+      HCD_NakRetry(hhcd);
+#endif /* USE_HAL_HCD_NAK_DEFER */
       HAL_HCD_SOF_Callback(hhcd);
       __HAL_HCD_CLEAR_FLAG(hhcd, USB_OTG_GINTSTS_SOF);
     }
@@ -891,6 +936,9 @@ static void HCD_HC_IN_IRQHandler (HCD_HandleTypeDef *hhcd, uint8_t chnum)
     {
       hhcd->hc[ch_num].xfer_count = hhcd->hc[ch_num].xfer_len - \
                                (USBx_HC(ch_num)->HCTSIZ & USB_OTG_HCTSIZ_XFRSIZ);
+#if (USE_HAL_USB_CACHE_MAINTENANCE == 1U)
+      HCD_CacheEnd(hhcd->hc[ch_num].xfer_buff, hhcd->hc[ch_num].xfer_count);
+#endif /* USE_HAL_USB_CACHE_MAINTENANCE */
     }
 
     hhcd->hc[ch_num].state = HC_XFRC;
@@ -952,11 +1000,16 @@ static void HCD_HC_IN_IRQHandler (HCD_HandleTypeDef *hhcd, uint8_t chnum)
     else if (hhcd->hc[ch_num].state == HC_NAK)
     {
       hhcd->hc[ch_num].urb_state  = URB_NOTREADY;
+#if (USE_HAL_HCD_NAK_DEFER == 1U)
+      /* re-activate the channel on the next SOF */
+      hhcd->hc[ch_num].state = HC_NAK_RETRY;
+#else
       /* re-activate the channel  */
       tmpreg = USBx_HC(ch_num)->HCCHAR;
       tmpreg &= ~USB_OTG_HCCHAR_CHDIS;
       tmpreg |= USB_OTG_HCCHAR_CHENA;
       USBx_HC(ch_num)->HCCHAR = tmpreg;
+#endif /* USE_HAL_HCD_NAK_DEFER */
     }
     else
     {
@@ -1109,13 +1162,15 @@ static void HCD_HC_OUT_IRQHandler (HCD_HandleTypeDef *hhcd, uint8_t chnum)
         hhcd->hc[ch_num].toggle_out ^= 1U;
       }
     }
-    else if (hhcd->hc[ch_num].state == HC_NAK)
-    {
-      hhcd->hc[ch_num].urb_state = URB_NOTREADY;
-    }
-    else if (hhcd->hc[ch_num].state == HC_NYET)
+    else if ((hhcd->hc[ch_num].state == HC_NAK) ||
+             (hhcd->hc[ch_num].state == HC_NYET))
     {
+#if (USE_HAL_HCD_NAK_DEFER == 1U)
+      /* Report URB_NOTREADY on the next SOF */
+      hhcd->hc[ch_num].state = HC_NAK_RETRY;
+#else
       hhcd->hc[ch_num].urb_state  = URB_NOTREADY;
+#endif /* USE_HAL_HCD_NAK_DEFER */
     }
     else if (hhcd->hc[ch_num].state == HC_STALL)
     {
@@ -1147,7 +1202,12 @@ static void HCD_HC_OUT_IRQHandler (HCD_HandleTypeDef *hhcd, uint8_t chnum)
     }
 
     __HAL_HCD_CLEAR_HC_INT(ch_num, USB_OTG_HCINT_CHH);
-    HAL_HCD_HC_NotifyURBChange_Callback(hhcd, (uint8_t)ch_num, hhcd->hc[ch_num].urb_state);
+#if (USE_HAL_HCD_NAK_DEFER == 1U)
+    if (hhcd->hc[ch_num].state != HC_NAK_RETRY)
+#endif /* USE_HAL_HCD_NAK_DEFER */
+    {
+      HAL_HCD_HC_NotifyURBChange_Callback(hhcd, (uint8_t)ch_num, hhcd->hc[ch_num].urb_state);
+    }
   }
   else
   {
@@ -1289,6 +1349,102 @@ static void HCD_Port_IRQHandler (HCD_HandleTypeDef *hhcd)
   USBx_HPRT0 = hprt0_dup;
 }
 
+#if (USE_HAL_HCD_NAK_DEFER == 1U)
+/**
+  * @brief  Retry the transactions NAKed during the previous (micro)frame.
+  *         Called on SOF: IN channels are re-enabled, OUT channels report
+  *         URB_NOTREADY so that the upper layer sends the data again.
+  * @param  hhcd HCD handle
+  * @retval None
+  */
+static void HCD_NakRetry(HCD_HandleTypeDef *hhcd)
+{
+  USB_OTG_GlobalTypeDef *USBx = hhcd->Instance;
+  uint32_t USBx_BASE = (uint32_t)USBx;
+  uint32_t ch_num;
+  uint32_t tmpreg;
+
+  for (ch_num = 0U; ch_num < hhcd->Init.Host_channels; ch_num++)
+  {
+    if (hhcd->hc[ch_num].state == HC_NAK_RETRY)
+    {
+      if (hhcd->hc[ch_num].ep_is_in != 0U)
+      {
+        hhcd->hc[ch_num].state = HC_IDLE;
+
+        /* re-activate the channel  */
+        tmpreg = USBx_HC(ch_num)->HCCHAR;
+        tmpreg &= ~USB_OTG_HCCHAR_CHDIS;
+        tmpreg |= USB_OTG_HCCHAR_CHENA;
+        USBx_HC(ch_num)->HCCHAR = tmpreg;
+      }
+      else
+      {
+        hhcd->hc[ch_num].state = HC_NAK;
+        hhcd->hc[ch_num].urb_state = URB_NOTREADY;
+        HAL_HCD_HC_NotifyURBChange_Callback(hhcd, (uint8_t)ch_num, hhcd->hc[ch_num].urb_state);
+      }
+    }
+  }
+}
+#endif /* USE_HAL_HCD_NAK_DEFER */
+
+#if (USE_HAL_USB_CACHE_MAINTENANCE == 1U)
+/**
+  * @brief  Maintain the D-cache of a buffer before the OTG DMA transfers it.
+  *         The lines are written back, and also invalidated for a reception
+  *         so that none is evicted over the data written by the DMA.
+  * @param  pBuf transfer buffer
+  * @param  len  number of bytes
+  * @param  rx   1 when the DMA writes the buffer
+  * @retval None
+  */
+static void HCD_CacheStart(uint8_t *pBuf, uint32_t len, uint8_t rx)
+{
+  uint32_t start = (uint32_t)pBuf & ~(USB_OTG_CACHE_LINE_SIZE - 1U);
+  uint32_t end = (uint32_t)pBuf + len;
+
+  if ((len != 0U) && ((SCB->CCR & SCB_CCR_DC_Msk) != 0U))
+  {
+    if (rx == 0U)
+    {
+      SCB_CleanDCache_by_Addr((uint32_t *)start, (int32_t)(end - start));
+    }
+    else
+    {
+      SCB_CleanInvalidateDCache_by_Addr((uint32_t *)start, (int32_t)(end - start));
+    }
+  }
+}
+
+/**
+  * @brief  Drop the D-cache lines of the bytes the OTG DMA has received, so
+  *         that the CPU reads them from memory.
+  * @param  pBuf start of the received data
+  * @param  len  number of bytes received
+  * @retval None
+  */
+static void HCD_CacheEnd(uint8_t *pBuf, uint32_t len)
+{
+  uint32_t start = (uint32_t)pBuf;
+  uint32_t end = (uint32_t)pBuf + len;
+
+  if ((len != 0U) && ((SCB->CCR & SCB_CCR_DC_Msk) != 0U))
+  {
+    if (((start | end) & (USB_OTG_CACHE_LINE_SIZE - 1U)) == 0U)
+    {
+      SCB_InvalidateDCache_by_Addr((uint32_t *)start, (int32_t)len);
+    }
+    else
+    {
+      /* Keep the CPU data sharing the first and last lines */
+      start &= ~(USB_OTG_CACHE_LINE_SIZE - 1U);
+      SCB_CleanInvalidateDCache_by_Addr((uint32_t *)start, (int32_t)(end - start));
+    }
+  }
+}
+#endif /* USE_HAL_USB_CACHE_MAINTENANCE */
+
 /**
   * @}
   */
@@ -150,6 +150,19 @@
         through HAL_MMC_GetCardState() function for MMC card state.
         You could also check the IT transfer process through the MMC Tx interrupt event.
 
+  *** MMC Card programming wait ***
+  =================================
+  [..]
+    (+) After a write, instead of polling HAL_MMC_GetCardState() until the card
+        leaves the programming state, call HAL_MMC_WaitCardReady_IT(). The
+        HAL_MMC_CardReadyCallback() is called once the card is back in transfer
+        state (possibly before HAL_MMC_WaitCardReady_IT() returns), with
+        HAL_MMC_GetError() reporting a status command failure.
+        The SDMMC of this device has no busy detection: call HAL_MMC_PollCardReady()
+        from a periodic timer, each call sends one CMD13.
+    (+) The handle is in HAL_MMC_STATE_PROGRAMMING during the wait, and the
+        read/write/erase functions return HAL_BUSY.
+
   *** MMC card information ***
   =========================== 
   [..]
@@ -1354,6 +1367,71 @@ HAL_StatusTypeDef HAL_MMC_Erase(MMC_HandleTypeDef *hmmc, uint32_t BlockStartAdd,
   }
 }
 
+/**
+  * @brief  Waits for the card to leave the programming state without blocking.
+  *         HAL_MMC_CardReadyCallback() is called once the card is back in
+  *         transfer state.
+  * @note   The end of programming is detected by HAL_MMC_PollCardReady(), to be called
+  *         periodically from a timer.
+  * @note   Call it after the completion of a write or erase operation.
+  * @param  hmmc Pointer to MMC handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_MMC_WaitCardReady_IT(MMC_HandleTypeDef *hmmc)
+{
+  if(hmmc->State != HAL_MMC_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+  
+  hmmc->ErrorCode = HAL_MMC_ERROR_NONE;
+  hmmc->Context = MMC_CONTEXT_WAIT_READY;
+  hmmc->State = HAL_MMC_STATE_PROGRAMMING;
+
+  (void)HAL_MMC_PollCardReady(hmmc);
+  
+  return HAL_OK;
+}
+
+/**
+  * @brief  Checks with one status command whether the card waited for by 
+  *         HAL_MMC_WaitCardReady_IT() has left the programming state, and calls
+  *         HAL_MMC_CardReadyCallback() if so.
+  * @param  hmmc Pointer to MMC handle
+  * @retval HAL status, HAL_BUSY while the card is programming
+  */
+HAL_StatusTypeDef HAL_MMC_PollCardReady(MMC_HandleTypeDef *hmmc)
+{
+  uint32_t cardstate = 0U;
+  uint32_t errorstate;
+  
+  if((hmmc->State != HAL_MMC_STATE_PROGRAMMING) || (hmmc->Context != MMC_CONTEXT_WAIT_READY))
+  {
+    return HAL_OK;
+  }
+
+  errorstate = MMC_SendStatus(hmmc, &cardstate);
+  if(errorstate != HAL_MMC_ERROR_NONE)
+  {
+    hmmc->ErrorCode |= errorstate;
+  }
+  else
+  {
+    cardstate = ((cardstate >> 9U) & 0x0FU);
+    if((cardstate == HAL_MMC_CARD_PROGRAMMING) || (cardstate == HAL_MMC_CARD_RECEIVING))
+    {
+      return HAL_BUSY;
+    }
+  }
+  
+  hmmc->Context = MMC_CONTEXT_NONE;
+  hmmc->State = HAL_MMC_STATE_READY;
+  
+  HAL_MMC_CardReadyCallback(hmmc);
+  
+  return HAL_OK;
+}
+
 /**
   * @brief  This function handles MMC card interrupt request.
   * @param  hmmc Pointer to MMC handle
@@ -1581,6 +1659,21 @@ __weak void HAL_MMC_AbortCallback(MMC_HandleTypeDef *hmmc)
    */ 
 }
 
+/**
+  * @brief Card ready callback, end of the wait started by HAL_MMC_WaitCardReady_IT()
+  * @param hmmc Pointer MMC handle
+  * @retval None
+  */
+__weak void HAL_MMC_CardReadyCallback(MMC_HandleTypeDef *hmmc)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hmmc);
+ 
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_MMC_CardReadyCallback can be implemented in the user file
+   */ 
+}
+
 
 /**
   * @}
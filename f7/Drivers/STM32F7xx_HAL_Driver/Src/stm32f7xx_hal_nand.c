@@ -731,6 +731,7 @@ HAL_StatusTypeDef HAL_NAND_Write_Page_8b(NAND_HandleTypeDef *hnand, NAND_Address
 {
   __IO uint32_t index = 0;
   uint32_t tickstart = 0;
+  uint32_t nandStatus = 0;
   uint32_t deviceAddress = 0, size = 0, numPagesWritten = 0, nandAddress = 0;
   
   /* Process Locked */
@@ -824,13 +825,24 @@ HAL_StatusTypeDef HAL_NAND_Write_Page_8b(NAND_HandleTypeDef *hnand, NAND_Address
    
     *(__IO uint8_t *)((uint32_t)(deviceAddress | CMD_AREA)) = NAND_CMD_WRITE_TRUE1;
     __DSB();
-    
-	/* Get tick */
+
+    /* Get tick */
     tickstart = HAL_GetTick();
-	
-    /* Read status until NAND is ready */
-    while(HAL_NAND_Read_Status(hnand) != NAND_READY)
-    {  
+
+    /* Read status until NAND is ready, a program failure ends the transfer */
+    while((nandStatus = HAL_NAND_Read_Status(hnand)) != NAND_READY)
+    {
+      if(nandStatus == NAND_ERROR)
+      {
+        /* Update the NAND controller state */
+        hnand->State = HAL_NAND_STATE_READY;
+
+        /* Process unlocked */
+        __HAL_UNLOCK(hnand);
+
+        return HAL_ERROR;
+      }
+
       if((HAL_GetTick() - tickstart ) > NAND_WRITE_TIMEOUT)
       {
         return HAL_TIMEOUT; 
@@ -869,6 +881,7 @@ HAL_StatusTypeDef HAL_NAND_Write_Page_16b(NAND_HandleTypeDef *hnand, NAND_Addres
 {
   __IO uint32_t index = 0;
   uint32_t tickstart = 0;
+  uint32_t nandStatus = 0;
   uint32_t deviceAddress = 0, size = 0, numPagesWritten = 0, nandAddress = 0;
   
   /* Process Locked */
@@ -962,13 +975,24 @@ HAL_StatusTypeDef HAL_NAND_Write_Page_16b(NAND_HandleTypeDef *hnand, NAND_Addres
    
     *(__IO uint8_t *)((uint32_t)(deviceAddress | CMD_AREA)) = NAND_CMD_WRITE_TRUE1;
     __DSB();
-    
-	/* Get tick */
+
+    /* Get tick */
     tickstart = HAL_GetTick();
-	  
-    /* Read status until NAND is ready */
-    while(HAL_NAND_Read_Status(hnand) != NAND_READY)
-    {  
+
+    /* Read status until NAND is ready, a program failure ends the transfer */
+    while((nandStatus = HAL_NAND_Read_Status(hnand)) != NAND_READY)
+    {
+      if(nandStatus == NAND_ERROR)
+      {
+        /* Update the NAND controller state */
+        hnand->State = HAL_NAND_STATE_READY;
+
+        /* Process unlocked */
+        __HAL_UNLOCK(hnand);
+
+        return HAL_ERROR;
+      }
+
       if((HAL_GetTick() - tickstart ) > NAND_WRITE_TIMEOUT)
       {
         return HAL_TIMEOUT; 
@@ -1305,6 +1329,7 @@ HAL_StatusTypeDef HAL_NAND_Write_SpareArea_8b(NAND_HandleTypeDef *hnand, NAND_Ad
 {
   __IO uint32_t index = 0;
   uint32_t tickstart = 0;
+  uint32_t nandStatus = 0;
   uint32_t deviceAddress = 0, size = 0, numSpareAreaWritten = 0, nandAddress = 0, columnAddress =0;
 
   /* Process Locked */
@@ -1407,13 +1432,24 @@ HAL_StatusTypeDef HAL_NAND_Write_SpareArea_8b(NAND_HandleTypeDef *hnand, NAND_Ad
    
     *(__IO uint8_t *)((uint32_t)(deviceAddress | CMD_AREA)) = NAND_CMD_WRITE_TRUE1;
     __DSB();
-   
+
     /* Get tick */
     tickstart = HAL_GetTick();
-	
-    /* Read status until NAND is ready */
-    while(HAL_NAND_Read_Status(hnand) != NAND_READY)
-    {  
+
+    /* Read status until NAND is ready, a program failure ends the transfer */
+    while((nandStatus = HAL_NAND_Read_Status(hnand)) != NAND_READY)
+    {
+      if(nandStatus == NAND_ERROR)
+      {
+        /* Update the NAND controller state */
+        hnand->State = HAL_NAND_STATE_READY;
+
+        /* Process unlocked */
+        __HAL_UNLOCK(hnand);
+
+        return HAL_ERROR;
+      }
+
       if((HAL_GetTick() - tickstart ) > NAND_WRITE_TIMEOUT)
       {
         return HAL_TIMEOUT; 
@@ -1452,6 +1488,7 @@ HAL_StatusTypeDef HAL_NAND_Write_SpareArea_16b(NAND_HandleTypeDef *hnand, NAND_A
 {
   __IO uint32_t index = 0;
   uint32_t tickstart = 0;
+  uint32_t nandStatus = 0;
   uint32_t deviceAddress = 0, size = 0, numSpareAreaWritten = 0, nandAddress = 0, columnAddress = 0;
 
   /* Process Locked */
@@ -1554,13 +1591,24 @@ HAL_StatusTypeDef HAL_NAND_Write_SpareArea_16b(NAND_HandleTypeDef *hnand, NAND_A
    
     *(__IO uint8_t *)((uint32_t)(deviceAddress | CMD_AREA)) = NAND_CMD_WRITE_TRUE1;
     __DSB();
-   
+
     /* Get tick */
     tickstart = HAL_GetTick();
-	  
-    /* Read status until NAND is ready */
-    while(HAL_NAND_Read_Status(hnand) != NAND_READY)
-    { 
+
+    /* Read status until NAND is ready, a program failure ends the transfer */
+    while((nandStatus = HAL_NAND_Read_Status(hnand)) != NAND_READY)
+    {
+      if(nandStatus == NAND_ERROR)
+      {
+        /* Update the NAND controller state */
+        hnand->State = HAL_NAND_STATE_READY;
+
+        /* Process unlocked */
+        __HAL_UNLOCK(hnand);
+
+        return HAL_ERROR;
+      }
+
       if((HAL_GetTick() - tickstart ) > NAND_WRITE_TIMEOUT)
       {
         return HAL_TIMEOUT; 
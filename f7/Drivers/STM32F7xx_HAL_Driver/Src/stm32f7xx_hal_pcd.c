@@ -39,6 +39,15 @@
      (#)Enable PCD transmission and reception:
          (##) HAL_PCD_Start();
 
+     (#) With Init.dma_enable set, the OTG internal DMA moves the endpoint data
+         and USE_HAL_USB_CACHE_MAINTENANCE in hal_conf.h lets the driver keep
+         the D-cache coherent: transmit buffers are cleaned, receive buffers
+         cleaned and invalidated when the transfer starts, and invalidated
+         over the received bytes when it completes. Buffers must be word
+         aligned; receive buffers should start on a 32-byte cache line and
+         span whole lines (for example from the dma_pool utility), so that no
+         CPU data shares their lines.
+
   @endverbatim
   ******************************************************************************
   * @attention
@@ -111,6 +120,10 @@
   */
 #if defined (USB_OTG_FS) || defined (USB_OTG_HS)
 static HAL_StatusTypeDef PCD_WriteEmptyTxFifo(PCD_HandleTypeDef *hpcd, uint32_t epnum);
+#if (USE_HAL_USB_CACHE_MAINTENANCE == 1U)
+static void PCD_CacheStart(uint8_t *pBuf, uint32_t len, uint8_t rx);
+static void PCD_CacheEnd(uint8_t *pBuf, uint32_t len);
+#endif /* USE_HAL_USB_CACHE_MAINTENANCE */
 #endif /* USB_OTG_FS || USB_OTG_HS */
 /**
   * @}
@@ -381,8 +394,11 @@ void HAL_PCD_IRQHandler(PCD_HandleTypeDef *hpcd)
 
             if(hpcd->Init.dma_enable == 1U)
             {
-              hpcd->OUT_ep[epnum].xfer_count = hpcd->OUT_ep[epnum].maxpacket- (USBx_OUTEP(epnum)->DOEPTSIZ & USB_OTG_DOEPTSIZ_XFRSIZ);
-              hpcd->OUT_ep[epnum].xfer_buff += hpcd->OUT_ep[epnum].maxpacket;
+              hpcd->OUT_ep[epnum].xfer_count = hpcd->OUT_ep[epnum].xfer_size - (USBx_OUTEP(epnum)->DOEPTSIZ & USB_OTG_DOEPTSIZ_XFRSIZ);
+#if (USE_HAL_USB_CACHE_MAINTENANCE == 1U)
+              PCD_CacheEnd(hpcd->OUT_ep[epnum].xfer_buff, hpcd->OUT_ep[epnum].xfer_count);
+#endif /* USE_HAL_USB_CACHE_MAINTENANCE */
+              hpcd->OUT_ep[epnum].xfer_buff += hpcd->OUT_ep[epnum].xfer_count;
             }
 
             if (gSNPSiD == USB_OTG_CORE_ID_310A)
@@ -433,6 +449,13 @@ void HAL_PCD_IRQHandler(PCD_HandleTypeDef *hpcd)
               }
             }
 
+#if (USE_HAL_USB_CACHE_MAINTENANCE == 1U)
+            if (hpcd->Init.dma_enable == 1U)
+            {
+              PCD_CacheEnd((uint8_t *)hpcd->Setup, sizeof(hpcd->Setup));
+            }
+#endif /* USE_HAL_USB_CACHE_MAINTENANCE */
+
             /* Inform the upper layer that a setup packet is available */
             HAL_PCD_SetupStageCallback(hpcd);
             CLEAR_OUT_EP_INTR(epnum, USB_OTG_DOEPINT_STUP);
@@ -728,6 +751,7 @@ void HAL_PCD_IRQHandler(PCD_HandleTypeDef *hpcd)
     /* Handle SOF Interrupt */
     if(__HAL_PCD_GET_FLAG(hpcd, USB_OTG_GINTSTS_SOF))
     {
+      __HAL_TRACE(HAL_TRACE_EVT_USB_SOF, hpcd->Instance);
       HAL_PCD_SOFCallback(hpcd);
       __HAL_PCD_CLEAR_FLAG(hpcd, USB_OTG_GINTSTS_SOF);
     }
@@ -1099,6 +1123,9 @@ HAL_StatusTypeDef HAL_PCD_EP_Receive(PCD_HandleTypeDef *hpcd, uint8_t ep_addr, u
   if (hpcd->Init.dma_enable == 1U)
   {
     ep->dma_addr = (uint32_t)pBuf;
+#if (USE_HAL_USB_CACHE_MAINTENANCE == 1U)
+    PCD_CacheStart(pBuf, len, 1U);
+#endif /* USE_HAL_USB_CACHE_MAINTENANCE */
   }
 
   if ((ep_addr & 0xFU) == 0U)
@@ -1147,6 +1174,9 @@ HAL_StatusTypeDef HAL_PCD_EP_Transmit(PCD_HandleTypeDef *hpcd, uint8_t ep_addr,
   if (hpcd->Init.dma_enable == 1U)
   {
     ep->dma_addr = (uint32_t)pBuf;
+#if (USE_HAL_USB_CACHE_MAINTENANCE == 1U)
+    PCD_CacheStart(pBuf, len, 0U);
+#endif /* USE_HAL_USB_CACHE_MAINTENANCE */
   }
 
   if ((ep_addr & 0xFU) == 0U)
@@ -1375,6 +1405,62 @@ static HAL_StatusTypeDef PCD_WriteEmptyTxFifo(PCD_HandleTypeDef *hpcd, uint32_t
 
   return HAL_OK;
 }
+
+#if (USE_HAL_USB_CACHE_MAINTENANCE == 1U)
+/**
+  * @brief  Maintain the D-cache of a buffer before the OTG DMA transfers it.
+  *         The lines are written back, and also invalidated for a reception
+  *         so that none is evicted over the data written by the DMA.
+  * @param  pBuf transfer buffer
+  * @param  len  number of bytes
+  * @param  rx   1 when the DMA writes the buffer
+  * @retval None
+  */
+static void PCD_CacheStart(uint8_t *pBuf, uint32_t len, uint8_t rx)
+{
+  uint32_t start = (uint32_t)pBuf & ~(USB_OTG_CACHE_LINE_SIZE - 1U);
+  uint32_t end = (uint32_t)pBuf + len;
+
+  if ((len != 0U) && ((SCB->CCR & SCB_CCR_DC_Msk) != 0U))
+  {
+    if (rx == 0U)
+    {
+      SCB_CleanDCache_by_Addr((uint32_t *)start, (int32_t)(end - start));
+    }
+    else
+    {
+      SCB_CleanInvalidateDCache_by_Addr((uint32_t *)start, (int32_t)(end - start));
+    }
+  }
+}
+
+/**
+  * @brief  Drop the D-cache lines of the bytes the OTG DMA has received, so
+  *         that the CPU reads them from memory.
+  * @param  pBuf start of the received data
+  * @param  len  number of bytes received
+  * @retval None
+  */
+static void PCD_CacheEnd(uint8_t *pBuf, uint32_t len)
+{
+  uint32_t start = (uint32_t)pBuf;
+  uint32_t end = (uint32_t)pBuf + len;
+
+  if ((len != 0U) && ((SCB->CCR & SCB_CCR_DC_Msk) != 0U))
+  {
+    if (((start | end) & (USB_OTG_CACHE_LINE_SIZE - 1U)) == 0U)
+    {
+      SCB_InvalidateDCache_by_Addr((uint32_t *)start, (int32_t)len);
+    }
+    else
+    {
+      /* Keep the CPU data sharing the first and last lines */
+      start &= ~(USB_OTG_CACHE_LINE_SIZE - 1U);
+      SCB_CleanInvalidateDCache_by_Addr((uint32_t *)start, (int32_t)(end - start));
+    }
+  }
+}
+#endif /* USE_HAL_USB_CACHE_MAINTENANCE */
 #endif /* USB_OTG_FS || USB_OTG_HS */
 
 
@@ -149,7 +149,42 @@
         After this, you have to ensure that the transfer is done correctly. The check is done
         through HAL_SD_GetCardState() function for SD card state.
         You could also check the IT transfer process through the SD Tx interrupt event.
-  
+
+  *** SD Card queued transfers ***
+  ================================
+  [..]
+    (+) You can queue read and write requests with HAL_SD_QueueRequest(). The call
+        never returns HAL_BUSY: the request is appended to a queue served in DMA mode
+        and completed through its XferCpltCallback (or HAL_SD_QueueCpltCallback()
+        when it is NULL), with the result in its ErrorCode field.
+    (+) Consecutive requests of the same direction whose blocks are adjacent on the
+        card and whose buffers are adjacent in memory are merged into one CMD18 or
+        CMD25 command. Multiple block writes are preceded by an ACMD23 pre-erase
+        hint giving the number of blocks.
+    (+) The next command is prepared while the card programs the last written
+        blocks, and issued as soon as the card is back in transfer state. Write
+        requests are completed once the card has left the programming state.
+    (+) When the card is still programming at the end of a write, the queue waits
+        for HAL_SD_QueueProcess(), to be called periodically (main loop or timer).
+        HAL_SD_QueueProcess() returns HAL_OK once the queue is empty and the card
+        is idle. It also starts requests queued during a HAL_SD_ReadBlocks_xx() or
+        HAL_SD_WriteBlocks_xx() transfer.
+    (+) A request must not be modified until it is completed. The queue must be
+        empty before calling HAL_SD_Abort() or HAL_SD_DeInit().
+  
+  *** SD Card programming wait ***
+  ================================
+  [..]
+    (+) After a write, instead of polling HAL_SD_GetCardState() until the card
+        leaves the programming state, call HAL_SD_WaitCardReady_IT(). The
+        HAL_SD_CardReadyCallback() is called once the card is back in transfer
+        state (possibly before HAL_SD_WaitCardReady_IT() returns), with
+        HAL_SD_GetError() reporting a status command failure.
+        The SDMMC of this device has no busy detection: call HAL_SD_PollCardReady()
+        from a periodic timer, each call sends one CMD13.
+    (+) The handle is in HAL_SD_STATE_PROGRAMMING during the wait, and the
+        read/write/erase functions return HAL_BUSY.
+
   *** SD card status ***
   ====================== 
   [..]
@@ -241,6 +276,13 @@
 /** @addtogroup SD_Private_Defines
   * @{
   */
+/* Queue engine states */
+#define SD_QUEUE_STATE_IDLE      ((uint32_t)0x00000000U)  /*!< No command, nothing to start           */
+#define SD_QUEUE_STATE_ACTIVE    ((uint32_t)0x00000001U)  /*!< Engine owned by a command in progress  */
+#define SD_QUEUE_STATE_WAIT      ((uint32_t)0x00000002U)  /*!< Card programming, HAL_SD_QueueProcess() */
+
+/* Largest merged command: the DMA stream counts at most 0xFFFF words */
+#define SD_QUEUE_MAX_BLOCKS      ((uint32_t)0x000001FFU)
     
 /**
   * @}
@@ -268,6 +310,12 @@ static void SD_DMAReceiveCplt(DMA_HandleTypeDef *hdma);
 static void SD_DMAError(DMA_HandleTypeDef *hdma);
 static void SD_DMATxAbort(DMA_HandleTypeDef *hdma);
 static void SD_DMARxAbort(DMA_HandleTypeDef *hdma);
+static void SD_QueueBuild(SD_HandleTypeDef *hsd);
+static void SD_QueueStart(SD_HandleTypeDef *hsd);
+static uint32_t SD_QueueIssue(SD_HandleTypeDef *hsd, SD_QueueRequestTypeDef *pCmd);
+static uint32_t SD_QueueCardBusy(SD_HandleTypeDef *hsd);
+static void SD_QueueCmdCplt(SD_HandleTypeDef *hsd);
+static void SD_QueueComplete(SD_HandleTypeDef *hsd);
 /**
   * @}
   */
@@ -333,6 +381,13 @@ HAL_StatusTypeDef HAL_SD_Init(SD_HandleTypeDef *hsd)
   
   /* Initialize the SD operation */
   hsd->Context = SD_CONTEXT_NONE;
+  
+  /* Initialize the request queue */
+  hsd->pQueueHead = NULL;
+  hsd->pQueueTail = NULL;
+  hsd->pQueueNext = NULL;
+  hsd->pQueueCmd  = NULL;
+  hsd->QueueState = SD_QUEUE_STATE_IDLE;
                                                                                      
   /* Initialize the SD state */
   hsd->State = HAL_SD_STATE_READY;
@@ -1367,6 +1422,190 @@ HAL_StatusTypeDef HAL_SD_Erase(SD_HandleTypeDef *hsd, uint32_t BlockStartAdd, ui
   }
 }
 
+/**
+  * @brief  Queues a read or write request served in DMA mode.
+  * @note   Requests adjacent on the card and in memory are merged into one 
+  *         multiple block command. The request is completed through its 
+  *         XferCpltCallback, or HAL_SD_QueueCpltCallback() when it is NULL.
+  * @note   Can be called from interrupt handlers and completion callbacks.
+  * @param  hsd Pointer to SD handle
+  * @param  pReq Pointer to the request, pData, BlockAdd, NumberOfBlocks, 
+  *         Direction and XferCpltCallback fields filled
+  * @retval HAL status, HAL_ERROR with pReq->ErrorCode set if the request is invalid
+  */
+HAL_StatusTypeDef HAL_SD_QueueRequest(SD_HandleTypeDef *hsd, SD_QueueRequestTypeDef *pReq)
+{
+  uint32_t primask;
+  uint32_t start = 0U;
+  
+  if(pReq == NULL)
+  {
+    return HAL_ERROR;
+  }
+  
+  if((pReq->pData == NULL) || (pReq->NumberOfBlocks == 0U) || (pReq->NumberOfBlocks > SD_QUEUE_MAX_BLOCKS) ||
+     ((pReq->Direction != SD_QUEUE_READ) && (pReq->Direction != SD_QUEUE_WRITE)))
+  {
+    pReq->ErrorCode = HAL_SD_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+  
+  if((pReq->BlockAdd + pReq->NumberOfBlocks) > (hsd->SdCard.LogBlockNbr))
+  {
+    pReq->ErrorCode = HAL_SD_ERROR_ADDR_OUT_OF_RANGE;
+    return HAL_ERROR;
+  }
+  
+  if(hsd->State == HAL_SD_STATE_RESET)
+  {
+    pReq->ErrorCode = HAL_SD_ERROR_REQUEST_NOT_APPLICABLE;
+    return HAL_ERROR;
+  }
+  
+  pReq->ErrorCode = HAL_SD_ERROR_NONE;
+  pReq->pNext = NULL;
+  
+  /* Append the request, and take the engine if it is idle */
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if(hsd->pQueueTail == NULL)
+  {
+    hsd->pQueueHead = pReq;
+  }
+  else
+  {
+    hsd->pQueueTail->pNext = pReq;
+  }
+  hsd->pQueueTail = pReq;
+  
+  if((hsd->QueueState == SD_QUEUE_STATE_IDLE) && (hsd->State == HAL_SD_STATE_READY))
+  {
+    hsd->QueueState = SD_QUEUE_STATE_ACTIVE;
+    start = 1U;
+  }
+  __set_PRIMASK(primask);
+  
+  if(start != 0U)
+  {
+    SD_QueueStart(hsd);
+  }
+  
+  return HAL_OK;
+}
+
+/**
+  * @brief  Resumes the request queue. Checks whether the card has finished 
+  *         programming the last written blocks, then completes them and starts
+  *         the next command. Also starts requests queued while a 
+  *         HAL_SD_ReadBlocks_xx()/HAL_SD_WriteBlocks_xx() transfer was ongoing.
+  * @note   To be called periodically while the queue is not empty.
+  * @param  hsd Pointer to SD handle
+  * @retval HAL status, HAL_OK when the queue is empty and idle, HAL_BUSY otherwise
+  */
+HAL_StatusTypeDef HAL_SD_QueueProcess(SD_HandleTypeDef *hsd)
+{
+  uint32_t primask;
+  uint32_t state;
+  uint32_t owner = 0U;
+  
+  /* Take the engine if it waits for the card or has requests to start */
+  primask = __get_PRIMASK();
+  __disable_irq();
+  state = hsd->QueueState;
+  if((state == SD_QUEUE_STATE_WAIT) ||
+     ((state == SD_QUEUE_STATE_IDLE) && (hsd->pQueueHead != NULL) && (hsd->State == HAL_SD_STATE_READY)))
+  {
+    hsd->QueueState = SD_QUEUE_STATE_ACTIVE;
+    owner = 1U;
+  }
+  __set_PRIMASK(primask);
+  
+  if(owner != 0U)
+  {
+    if(state == SD_QUEUE_STATE_WAIT)
+    {
+      if(SD_QueueCardBusy(hsd) != 0U)
+      {
+        hsd->QueueState = SD_QUEUE_STATE_WAIT;
+        return HAL_BUSY;
+      }
+      SD_QueueComplete(hsd);
+    }
+    SD_QueueStart(hsd);
+  }
+  
+  if((hsd->QueueState == SD_QUEUE_STATE_IDLE) && (hsd->pQueueHead == NULL))
+  {
+    return HAL_OK;
+  }
+  return HAL_BUSY;
+}
+
+/**
+  * @brief  Waits for the card to leave the programming state without blocking.
+  *         HAL_SD_CardReadyCallback() is called once the card is back in
+  *         transfer state.
+  * @note   The end of programming is detected by HAL_SD_PollCardReady(), to be called
+  *         periodically from a timer.
+  * @note   Call it after the completion of a write or erase operation.
+  * @param  hsd Pointer to SD handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SD_WaitCardReady_IT(SD_HandleTypeDef *hsd)
+{
+  if(hsd->State != HAL_SD_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+  
+  hsd->ErrorCode = HAL_SD_ERROR_NONE;
+  hsd->Context = SD_CONTEXT_WAIT_READY;
+  hsd->State = HAL_SD_STATE_PROGRAMMING;
+
+  (void)HAL_SD_PollCardReady(hsd);
+  
+  return HAL_OK;
+}
+
+/**
+  * @brief  Checks with one status command whether the card waited for by 
+  *         HAL_SD_WaitCardReady_IT() has left the programming state, and calls
+  *         HAL_SD_CardReadyCallback() if so.
+  * @param  hsd Pointer to SD handle
+  * @retval HAL status, HAL_BUSY while the card is programming
+  */
+HAL_StatusTypeDef HAL_SD_PollCardReady(SD_HandleTypeDef *hsd)
+{
+  uint32_t cardstate = 0U;
+  uint32_t errorstate;
+  
+  if((hsd->State != HAL_SD_STATE_PROGRAMMING) || (hsd->Context != SD_CONTEXT_WAIT_READY))
+  {
+    return HAL_OK;
+  }
+
+  errorstate = SD_SendStatus(hsd, &cardstate);
+  if(errorstate != HAL_SD_ERROR_NONE)
+  {
+    hsd->ErrorCode |= errorstate;
+  }
+  else
+  {
+    cardstate = ((cardstate >> 9U) & 0x0FU);
+    if((cardstate == HAL_SD_CARD_PROGRAMMING) || (cardstate == HAL_SD_CARD_RECEIVING))
+    {
+      return HAL_BUSY;
+    }
+  }
+  
+  hsd->Context = SD_CONTEXT_NONE;
+  hsd->State = HAL_SD_STATE_READY;
+  
+  HAL_SD_CardReadyCallback(hsd);
+  
+  return HAL_OK;
+}
+
 /**
   * @brief  This function handles SD card interrupt request.
   * @param  hsd Pointer to SD handle
@@ -1409,6 +1648,26 @@ void HAL_SD_IRQHandler(SD_HandleTypeDef *hsd)
         HAL_SD_TxCpltCallback(hsd);
       }
     }
+    else if((hsd->Context & SD_CONTEXT_QUEUE) != RESET)
+    {
+      /* Queued reads complete on the DMA transfer complete callback */
+      if((hsd->Context & (SD_CONTEXT_WRITE_SINGLE_BLOCK | SD_CONTEXT_WRITE_MULTIPLE_BLOCK)) != RESET)
+      {
+        if((hsd->Context & SD_CONTEXT_WRITE_MULTIPLE_BLOCK) != RESET)
+        {
+          hsd->ErrorCode |= SDMMC_CmdStopTransfer(hsd->Instance);
+        }
+        
+        /* Disable the DMA transfer for transmit request by setting the DMAEN bit
+        in the SD DCTRL register */
+        hsd->Instance->DCTRL &= (uint32_t)~((uint32_t)SDMMC_DCTRL_DMAEN);
+        
+        /* Clear all the static flags */
+        __HAL_SD_CLEAR_FLAG(hsd, SDMMC_STATIC_FLAGS);
+        
+        SD_QueueCmdCplt(hsd);
+      }
+    }
     else if((hsd->Context & SD_CONTEXT_DMA) != RESET)
     {
       if((hsd->Context & SD_CONTEXT_WRITE_MULTIPLE_BLOCK) != RESET)
@@ -1474,7 +1733,27 @@ void HAL_SD_IRQHandler(SD_HandleTypeDef *hsd)
     __HAL_SD_DISABLE_IT(hsd, SDMMC_IT_DATAEND | SDMMC_IT_DCRCFAIL | SDMMC_IT_DTIMEOUT|\
                              SDMMC_IT_TXUNDERR| SDMMC_IT_RXOVERR);
     
-    if((hsd->Context & SD_CONTEXT_DMA) != RESET)
+    if((hsd->Context & SD_CONTEXT_QUEUE) != RESET)
+    {
+      /* Stop the data path and the DMA stream, then fail the whole command */
+      hsd->Instance->DCTRL = 0U;
+      if((hsd->Context & (SD_CONTEXT_WRITE_SINGLE_BLOCK | SD_CONTEXT_WRITE_MULTIPLE_BLOCK)) != RESET)
+      {
+        (void)HAL_DMA_Abort(hsd->hdmatx);
+      }
+      else
+      {
+        (void)HAL_DMA_Abort(hsd->hdmarx);
+      }
+      if((hsd->Context & (SD_CONTEXT_READ_MULTIPLE_BLOCK | SD_CONTEXT_WRITE_MULTIPLE_BLOCK)) != RESET)
+      {
+        hsd->ErrorCode |= SDMMC_CmdStopTransfer(hsd->Instance);
+      }
+      __HAL_SD_CLEAR_FLAG(hsd, SDMMC_STATIC_FLAGS);
+      
+      SD_QueueCmdCplt(hsd);
+    }
+    else if((hsd->Context & SD_CONTEXT_DMA) != RESET)
     {
       /* Abort the SD DMA Streams */
       if(hsd->hdmatx != NULL)
@@ -1594,6 +1873,39 @@ __weak void HAL_SD_AbortCallback(SD_HandleTypeDef *hsd)
    */ 
 }
 
+/**
+  * @brief Card ready callback, end of the wait started by HAL_SD_WaitCardReady_IT()
+  * @param hsd Pointer SD handle
+  * @retval None
+  */
+__weak void HAL_SD_CardReadyCallback(SD_HandleTypeDef *hsd)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hsd);
+ 
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_SD_CardReadyCallback can be implemented in the user file
+   */ 
+}
+
+/**
+  * @brief Queued request completed callback, called for the requests queued
+  *        with a NULL XferCpltCallback
+  * @param hsd Pointer SD handle
+  * @param pReq Pointer to the completed request, result in pReq->ErrorCode
+  * @retval None
+  */
+__weak void HAL_SD_QueueCpltCallback(SD_HandleTypeDef *hsd, SD_QueueRequestTypeDef *pReq)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hsd);
+  UNUSED(pReq);
+ 
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_SD_QueueCpltCallback can be implemented in the user file
+   */ 
+}
+
 
 /**
   * @}
@@ -2199,6 +2511,21 @@ static void SD_DMAReceiveCplt(DMA_HandleTypeDef *hdma)
   SD_HandleTypeDef* hsd = (SD_HandleTypeDef* )(hdma->Parent);
   uint32_t errorstate = HAL_SD_ERROR_NONE;
   
+  if((hsd->Context & SD_CONTEXT_QUEUE) != RESET)
+  {
+    if((hsd->Context & SD_CONTEXT_READ_MULTIPLE_BLOCK) != RESET)
+    {
+      hsd->ErrorCode |= SDMMC_CmdStopTransfer(hsd->Instance);
+    }
+    
+    __HAL_SD_DISABLE_IT(hsd, SDMMC_IT_DATAEND | SDMMC_IT_DCRCFAIL | SDMMC_IT_DTIMEOUT | SDMMC_IT_RXOVERR);
+    hsd->Instance->DCTRL &= (uint32_t)~((uint32_t)SDMMC_DCTRL_DMAEN);
+    __HAL_SD_CLEAR_FLAG(hsd, SDMMC_STATIC_FLAGS);
+    
+    SD_QueueCmdCplt(hsd);
+    return;
+  }
+  
   /* Send stop command in multiblock write */
   if(hsd->Context == (SD_CONTEXT_READ_MULTIPLE_BLOCK | SD_CONTEXT_DMA))
   {
@@ -2233,7 +2560,22 @@ static void SD_DMAError(DMA_HandleTypeDef *hdma)
   HAL_SD_CardStateTypeDef CardState;
   
   /* if DMA error is FIFO error ignore it */
-  if(HAL_DMA_GetError(hdma) != HAL_DMA_ERROR_FE)
+  if((HAL_DMA_GetError(hdma) != HAL_DMA_ERROR_FE) && ((hsd->Context & SD_CONTEXT_QUEUE) != RESET))
+  {
+    __HAL_SD_DISABLE_IT(hsd, SDMMC_IT_DATAEND | SDMMC_IT_DCRCFAIL | SDMMC_IT_DTIMEOUT|\
+      SDMMC_IT_TXUNDERR| SDMMC_IT_RXOVERR);
+    
+    hsd->ErrorCode |= HAL_SD_ERROR_DMA;
+    hsd->Instance->DCTRL = 0U;
+    if((hsd->Context & (SD_CONTEXT_READ_MULTIPLE_BLOCK | SD_CONTEXT_WRITE_MULTIPLE_BLOCK)) != RESET)
+    {
+      hsd->ErrorCode |= SDMMC_CmdStopTransfer(hsd->Instance);
+    }
+    __HAL_SD_CLEAR_FLAG(hsd, SDMMC_STATIC_FLAGS);
+    
+    SD_QueueCmdCplt(hsd);
+  }
+  else if(HAL_DMA_GetError(hdma) != HAL_DMA_ERROR_FE)
   {
     if((hsd->hdmarx->ErrorCode == HAL_DMA_ERROR_TE) || (hsd->hdmatx->ErrorCode == HAL_DMA_ERROR_TE))
     {
@@ -2900,6 +3242,316 @@ static HAL_StatusTypeDef SD_Write_IT(SD_HandleTypeDef *hsd)
   return HAL_OK;
 }
 
+/**
+  * @brief  Detaches from the queue head the requests of the next command: the 
+  *         first request and the following ones of the same direction that are
+  *         adjacent on the card and in memory.
+  * @note   Called with the interrupts disabled.
+  * @param  hsd Pointer to SD handle
+  * @retval None
+  */
+static void SD_QueueBuild(SD_HandleTypeDef *hsd)
+{
+  SD_QueueRequestTypeDef *first = hsd->pQueueHead;
+  SD_QueueRequestTypeDef *last;
+  SD_QueueRequestTypeDef *next;
+  uint32_t blocks;
+  
+  if((hsd->pQueueNext != NULL) || (first == NULL))
+  {
+    return;
+  }
+  
+  last = first;
+  blocks = first->NumberOfBlocks;
+  next = last->pNext;
+  while((next != NULL) && (next->Direction == first->Direction) &&
+        (next->BlockAdd == (last->BlockAdd + last->NumberOfBlocks)) &&
+        (next->pData == (last->pData + (BLOCKSIZE * last->NumberOfBlocks))) &&
+        ((blocks + next->NumberOfBlocks) <= SD_QUEUE_MAX_BLOCKS))
+  {
+    blocks += next->NumberOfBlocks;
+    last = next;
+    next = last->pNext;
+  }
+  
+  hsd->pQueueHead = next;
+  if(next == NULL)
+  {
+    hsd->pQueueTail = NULL;
+  }
+  last->pNext = NULL;
+  hsd->pQueueNext = first;
+}
+
+/**
+  * @brief  Starts the next queued command, completing the requests of the 
+  *         commands that cannot be issued. Marks the queue idle when empty.
+  * @note   Called by the owner of the queue engine (SD_QUEUE_STATE_ACTIVE).
+  * @param  hsd Pointer to SD handle
+  * @retval None
+  */
+static void SD_QueueStart(SD_HandleTypeDef *hsd)
+{
+  SD_QueueRequestTypeDef *cmd;
+  uint32_t primask;
+  uint32_t errorstate;
+  
+  for(;;)
+  {
+    primask = __get_PRIMASK();
+    __disable_irq();
+    SD_QueueBuild(hsd);
+    cmd = hsd->pQueueNext;
+    hsd->pQueueNext = NULL;
+    if(cmd == NULL)
+    {
+      hsd->Context    = SD_CONTEXT_NONE;
+      hsd->State      = HAL_SD_STATE_READY;
+      hsd->QueueState = SD_QUEUE_STATE_IDLE;
+    }
+    __set_PRIMASK(primask);
+    
+    if(cmd == NULL)
+    {
+      return;
+    }
+    
+    hsd->pQueueCmd = cmd;
+    hsd->ErrorCode = HAL_SD_ERROR_NONE;
+    hsd->State     = HAL_SD_STATE_BUSY;
+    
+    errorstate = SD_QueueIssue(hsd, cmd);
+    if(errorstate == HAL_SD_ERROR_NONE)
+    {
+      return;
+    }
+    
+    hsd->ErrorCode |= errorstate;
+    SD_QueueComplete(hsd);
+  }
+}
+
+/**
+  * @brief  Issues the data command of a list of merged requests in DMA mode.
+  * @param  hsd Pointer to SD handle
+  * @param  pCmd First request of the list
+  * @retval SD Card error state
+  */
+static uint32_t SD_QueueIssue(SD_HandleTypeDef *hsd, SD_QueueRequestTypeDef *pCmd)
+{
+  SDMMC_DataInitTypeDef config;
+  SD_QueueRequestTypeDef *req;
+  uint32_t errorstate = HAL_SD_ERROR_NONE;
+  uint32_t blocks = 0U;
+  uint32_t add = pCmd->BlockAdd;
+  
+  for(req = pCmd; req != NULL; req = req->pNext)
+  {
+    blocks += req->NumberOfBlocks;
+  }
+  
+  if(hsd->SdCard.CardType != CARD_SDHC_SDXC)
+  {
+    add *= 512U;
+    
+    /* Set Block Size for Card, fixed to 512 bytes on SDHC/SDXC cards */
+    errorstate = SDMMC_CmdBlockLength(hsd->Instance, BLOCKSIZE);
+    if(errorstate != HAL_SD_ERROR_NONE)
+    {
+      __HAL_SD_CLEAR_FLAG(hsd, SDMMC_STATIC_FLAGS);
+      return errorstate;
+    }
+  }
+  
+  /* Initialize data control register */
+  hsd->Instance->DCTRL = 0U;
+  
+  config.DataTimeOut   = SDMMC_DATATIMEOUT;
+  config.DataLength    = BLOCKSIZE * blocks;
+  config.DataBlockSize = SDMMC_DATABLOCK_SIZE_512B;
+  config.TransferMode  = SDMMC_TRANSFER_MODE_BLOCK;
+  config.DPSM          = SDMMC_DPSM_ENABLE;
+  
+  if(pCmd->Direction == SD_QUEUE_READ)
+  {
+    hsd->Context = SD_CONTEXT_DMA | SD_CONTEXT_QUEUE |
+                   ((blocks > 1U) ? SD_CONTEXT_READ_MULTIPLE_BLOCK : SD_CONTEXT_READ_SINGLE_BLOCK);
+    
+    __HAL_SD_ENABLE_IT(hsd, (SDMMC_IT_DCRCFAIL | SDMMC_IT_DTIMEOUT | SDMMC_IT_RXOVERR | SDMMC_IT_DATAEND));
+    
+    hsd->hdmarx->XferCpltCallback  = SD_DMAReceiveCplt;
+    hsd->hdmarx->XferErrorCallback = SD_DMAError;
+    hsd->hdmarx->XferAbortCallback = NULL;
+    
+    HAL_DMA_Start_IT(hsd->hdmarx, (uint32_t)&hsd->Instance->FIFO, (uint32_t)pCmd->pData, (uint32_t)(BLOCKSIZE * blocks)/4);
+    __HAL_SD_DMA_ENABLE(hsd);
+    
+    config.TransferDir = SDMMC_TRANSFER_DIR_TO_SDMMC;
+    SDMMC_ConfigData(hsd->Instance, &config);
+    
+    if(blocks > 1U)
+    {
+      errorstate = SDMMC_CmdReadMultiBlock(hsd->Instance, add);
+    }
+    else
+    {
+      errorstate = SDMMC_CmdReadSingleBlock(hsd->Instance, add);
+    }
+    if(errorstate != HAL_SD_ERROR_NONE)
+    {
+      __HAL_SD_DISABLE_IT(hsd, (SDMMC_IT_DCRCFAIL | SDMMC_IT_DTIMEOUT | SDMMC_IT_RXOVERR | SDMMC_IT_DATAEND));
+      hsd->Instance->DCTRL = 0U;
+      (void)HAL_DMA_Abort(hsd->hdmarx);
+    }
+  }
+  else
+  {
+    if(blocks > 1U)
+    {
+      /* Pre-erase hint for the blocks of the command */
+      errorstate = SDMMC_CmdAppCommand(hsd->Instance, (uint32_t)(hsd->SdCard.RelCardAdd << 16U));
+      if(errorstate == HAL_SD_ERROR_NONE)
+      {
+        errorstate = SDMMC_CmdSetWrBlkEraseCount(hsd->Instance, blocks);
+      }
+      if(errorstate != HAL_SD_ERROR_NONE)
+      {
+        __HAL_SD_CLEAR_FLAG(hsd, SDMMC_STATIC_FLAGS);
+        return errorstate;
+      }
+    }
+    
+    hsd->Context = SD_CONTEXT_DMA | SD_CONTEXT_QUEUE |
+                   ((blocks > 1U) ? SD_CONTEXT_WRITE_MULTIPLE_BLOCK : SD_CONTEXT_WRITE_SINGLE_BLOCK);
+    
+    __HAL_SD_ENABLE_IT(hsd, (SDMMC_IT_DCRCFAIL | SDMMC_IT_DTIMEOUT | SDMMC_IT_TXUNDERR));
+    
+    hsd->hdmatx->XferCpltCallback  = SD_DMATransmitCplt;
+    hsd->hdmatx->XferErrorCallback = SD_DMAError;
+    hsd->hdmatx->XferAbortCallback = NULL;
+    
+    if(blocks > 1U)
+    {
+      errorstate = SDMMC_CmdWriteMultiBlock(hsd->Instance, add);
+    }
+    else
+    {
+      errorstate = SDMMC_CmdWriteSingleBlock(hsd->Instance, add);
+    }
+    if(errorstate != HAL_SD_ERROR_NONE)
+    {
+      __HAL_SD_DISABLE_IT(hsd, (SDMMC_IT_DCRCFAIL | SDMMC_IT_DTIMEOUT | SDMMC_IT_TXUNDERR));
+    }
+    else
+    {
+      __HAL_SD_DMA_ENABLE(hsd);
+      HAL_DMA_Start_IT(hsd->hdmatx, (uint32_t)pCmd->pData, (uint32_t)&hsd->Instance->FIFO, (uint32_t)(BLOCKSIZE * blocks)/4);
+      
+      config.TransferDir = SDMMC_TRANSFER_DIR_TO_CARD;
+      SDMMC_ConfigData(hsd->Instance, &config);
+    }
+  }
+  
+  if(errorstate != HAL_SD_ERROR_NONE)
+  {
+    __HAL_SD_CLEAR_FLAG(hsd, SDMMC_STATIC_FLAGS);
+  }
+  
+  return errorstate;
+}
+
+/**
+  * @brief  Checks whether the card is still programming written blocks.
+  * @note   A status error is recorded in the handle error code and ends the wait.
+  * @param  hsd Pointer to SD handle
+  * @retval 1 while the card is programming, 0 otherwise
+  */
+static uint32_t SD_QueueCardBusy(SD_HandleTypeDef *hsd)
+{
+  uint32_t cardstate = 0U;
+  uint32_t errorstate;
+  
+  errorstate = SD_SendStatus(hsd, &cardstate);
+  if(errorstate != HAL_SD_ERROR_NONE)
+  {
+    hsd->ErrorCode |= errorstate;
+    return 0U;
+  }
+  
+  cardstate = ((cardstate >> 9U) & 0x0FU);
+  if((cardstate == HAL_SD_CARD_PROGRAMMING) || (cardstate == HAL_SD_CARD_RECEIVING))
+  {
+    return 1U;
+  }
+  return 0U;
+}
+
+/**
+  * @brief  Ends the running queued command. After a write, prepares the next
+  *         command while the card programs, and waits for HAL_SD_QueueProcess()
+  *         if it is still programming.
+  * @param  hsd Pointer to SD handle
+  * @retval None
+  */
+static void SD_QueueCmdCplt(SD_HandleTypeDef *hsd)
+{
+  uint32_t primask;
+  
+  if((hsd->Context & (SD_CONTEXT_WRITE_SINGLE_BLOCK | SD_CONTEXT_WRITE_MULTIPLE_BLOCK)) != RESET)
+  {
+    hsd->State = HAL_SD_STATE_PROGRAMMING;
+    
+    primask = __get_PRIMASK();
+    __disable_irq();
+    SD_QueueBuild(hsd);
+    __set_PRIMASK(primask);
+    
+    if(SD_QueueCardBusy(hsd) != 0U)
+    {
+      hsd->QueueState = SD_QUEUE_STATE_WAIT;
+      return;
+    }
+  }
+  
+  SD_QueueComplete(hsd);
+  SD_QueueStart(hsd);
+}
+
+/**
+  * @brief  Completes the requests of the running command with the handle 
+  *         error code.
+  * @param  hsd Pointer to SD handle
+  * @retval None
+  */
+static void SD_QueueComplete(SD_HandleTypeDef *hsd)
+{
+  SD_QueueRequestTypeDef *req = hsd->pQueueCmd;
+  SD_QueueRequestTypeDef *next;
+  uint32_t errorstate = hsd->ErrorCode;
+  
+  hsd->pQueueCmd = NULL;
+  hsd->Context   = SD_CONTEXT_NONE;
+  hsd->ErrorCode = HAL_SD_ERROR_NONE;
+  
+  while(req != NULL)
+  {
+    next = req->pNext;
+    req->pNext = NULL;
+    req->ErrorCode = errorstate;
+    
+    if(req->XferCpltCallback != NULL)
+    {
+      req->XferCpltCallback(hsd, req);
+    }
+    else
+    {
+      HAL_SD_QueueCpltCallback(hsd, req);
+    }
+    req = next;
+  }
+}
+
 /**
   * @}
   */
@@ -936,6 +936,31 @@ uint32_t SDMMC_CmdBusWidth(SDMMC_TypeDef *SDMMCx, uint32_t BusWidth)
   return errorstate;
 }
 
+/**
+  * @brief  Send the Set Write Block Erase Count command (ACMD23) and check the 
+  *         response. SDMMC_CmdAppCommand() must be sent first.
+  * @param  SDMMCx Pointer to SDMMC register base 
+  * @param  BlockCount Number of blocks to pre-erase
+  * @retval HAL status
+  */
+uint32_t SDMMC_CmdSetWrBlkEraseCount(SDMMC_TypeDef *SDMMCx, uint32_t BlockCount)
+{
+  SDMMC_CmdInitTypeDef  sdmmc_cmdinit;
+  uint32_t errorstate = SDMMC_ERROR_NONE;
+  
+  sdmmc_cmdinit.Argument         = (uint32_t)BlockCount;
+  sdmmc_cmdinit.CmdIndex         = SDMMC_CMD_SD_APP_SET_WR_BLK_ERASE_COUNT;
+  sdmmc_cmdinit.Response         = SDMMC_RESPONSE_SHORT;
+  sdmmc_cmdinit.WaitForInterrupt = SDMMC_WAIT_NO;
+  sdmmc_cmdinit.CPSM             = SDMMC_CPSM_ENABLE;
+  SDMMC_SendCommand(SDMMCx, &sdmmc_cmdinit);
+  
+  /* Check for error conditions */
+  errorstate = SDMMC_GetCmdResp1(SDMMCx, SDMMC_CMD_SD_APP_SET_WR_BLK_ERASE_COUNT, SDMMC_CMDTIMEOUT);
+
+  return errorstate;
+}
+
 /**
   * @brief  Send the Send SCR command and check the response.
   * @param  SDMMCx Pointer to SDMMC register base 
@@ -60,7 +60,13 @@
 #define PDM_FILTER_DECIMATION_ERROR     ((uint16_t)0x0008)
 #define PDM_FILTER_GAIN_ERROR           ((uint16_t)0x0040)
 #define PDM_FILTER_SAMPLES_NUMBER_ERROR ((uint16_t)0x0080)
+/* The source decimator, pdm2pcm_open.c built with PDM2PCM_OPEN defined in
+   place of the library, keeps a larger state */
+#if defined(PDM2PCM_OPEN)
+#define PDM2PCM_INTERNAL_MEMORY_SIZE 48
+#else
 #define PDM2PCM_INTERNAL_MEMORY_SIZE 16
+#endif
 
 /* Exported types ------------------------------------------------------------*/
 typedef struct{
@@ -76,8 +76,32 @@
 #define USBD_MAX_NUM_INTERFACES                       1U
 #endif /* USBD_AUDIO_FREQ */
 
+/* Set to 1U in usbd_conf.h to run the streaming endpoint in asynchronous mode
+   with an explicit feedback endpoint */
+#ifndef USBD_AUDIO_FEEDBACK
+#define USBD_AUDIO_FEEDBACK                           0U
+#endif /* USBD_AUDIO_FEEDBACK */
+
 #define AUDIO_OUT_EP                                  0x01U
+
+#if (USBD_AUDIO_FEEDBACK == 1U)
+#define AUDIO_FB_EP                                   0x81U
+#define AUDIO_FB_PACKET                               0x03U
+#define USB_AUDIO_CONFIG_DESC_SIZ                     0x76U
+
+/* Feedback refresh period: 2^AUDIO_FB_REFRESH frames (1 to 9) */
+#ifndef AUDIO_FB_REFRESH
+#define AUDIO_FB_REFRESH                              5U
+#endif /* AUDIO_FB_REFRESH */
+
+/* Loop gain: a fill level error of 2^AUDIO_FB_GAIN samples moves the
+   feedback value by one sample per frame */
+#ifndef AUDIO_FB_GAIN
+#define AUDIO_FB_GAIN                                 6U
+#endif /* AUDIO_FB_GAIN */
+#else
 #define USB_AUDIO_CONFIG_DESC_SIZ                     0x6DU
+#endif /* USBD_AUDIO_FEEDBACK */
 #define AUDIO_INTERFACE_DESC_SIZE                     0x09U
 #define USB_AUDIO_DESC_SIZ                            0x09U
 #define AUDIO_STANDARD_ENDPOINT_DESC_SIZE             0x09U
@@ -121,9 +145,23 @@
 #define AUDIO_OUT_PACKET                              (uint16_t)(((USBD_AUDIO_FREQ * 2U * 2U) / 1000U))
 #define AUDIO_DEFAULT_VOLUME                          70U
 
+/* In asynchronous mode the host may send one extra sample per frame */
+#if (USBD_AUDIO_FEEDBACK == 1U)
+#define AUDIO_OUT_MAX_PACKET                          (uint16_t)(AUDIO_OUT_PACKET + 4U)
+#else
+#define AUDIO_OUT_MAX_PACKET                          AUDIO_OUT_PACKET
+#endif /* USBD_AUDIO_FEEDBACK */
+
 /* Number of sub-packets in the audio transfer buffer. You can modify this value but always make sure
-  that it is an even number and higher than 3 */
+  that it is an even number and higher than 3. With the feedback endpoint the fill level is held at
+  half of the buffer, so a few packets are enough. */
+#ifndef AUDIO_OUT_PACKET_NUM
+#if (USBD_AUDIO_FEEDBACK == 1U)
+#define AUDIO_OUT_PACKET_NUM                          8U
+#else
 #define AUDIO_OUT_PACKET_NUM                          80U
+#endif /* USBD_AUDIO_FEEDBACK */
+#endif /* AUDIO_OUT_PACKET_NUM */
 /* Total size of the audio transfer buffer */
 #define AUDIO_TOTAL_BUF_SIZE                          ((uint16_t)(AUDIO_OUT_PACKET * AUDIO_OUT_PACKET_NUM))
 
@@ -172,6 +210,14 @@ typedef struct
   uint16_t                   rd_ptr;
   uint16_t                   wr_ptr;
   USBD_AUDIO_ControlTypeDef control;
+#if (USBD_AUDIO_FEEDBACK == 1U)
+  uint32_t                  fb_value;
+  uint32_t                  fb_level;
+  uint8_t                   packet[AUDIO_OUT_MAX_PACKET];
+  uint8_t                   fb_data[4];
+  uint16_t                  fb_frames;
+  uint16_t                  sof_count;
+#endif /* USBD_AUDIO_FEEDBACK */
 }
 USBD_AUDIO_HandleTypeDef;
 
@@ -185,6 +231,7 @@ typedef struct
     int8_t  (*MuteCtl)      (uint8_t cmd);
     int8_t  (*PeriodicTC)   (uint8_t cmd);
     int8_t  (*GetState)     (void);
+    int8_t  (*GetPlayPos)   (uint32_t *pos);
 }USBD_AUDIO_ItfTypeDef;
 /**
   * @}
@@ -23,6 +23,8 @@
   *             - AudioControl Requests: only SET_CUR and GET_CUR requests are supported (for Mute)
   *             - Audio Feature Unit (limited to Mute control)
   *             - Audio Synchronization type: Asynchronous
+  *             - Optional explicit feedback endpoint driven by the playback buffer
+  *               fill level (USBD_AUDIO_FEEDBACK in usbd_conf.h)
   *             - Single fixed audio sampling rate (configurable in usbd_conf.h file)
   *          The current audio class version supports the following audio features:
   *             - Pulse Coded Modulation (PCM) format
@@ -111,6 +113,12 @@
 /** @defgroup USBD_AUDIO_Private_Defines
   * @{
   */
+#if (USBD_AUDIO_FEEDBACK == 1U)
+/* Nominal number of samples per frame, 10.14 format */
+#define AUDIO_FB_NOMINAL            ((uint32_t)(((uint32_t)USBD_AUDIO_FREQ << 14) / 1000U))
+/* Maximum deviation from the nominal rate: one sample per frame */
+#define AUDIO_FB_MAX_CORRECTION     ((int32_t)1 << 14)
+#endif /* USBD_AUDIO_FEEDBACK */
 /**
   * @}
   */
@@ -167,6 +175,14 @@ static void AUDIO_REQ_GetCurrent(USBD_HandleTypeDef *pdev, USBD_SetupReqTypedef
 
 static void AUDIO_REQ_SetCurrent(USBD_HandleTypeDef *pdev, USBD_SetupReqTypedef *req);
 
+#if (USBD_AUDIO_FEEDBACK == 1U)
+static uint32_t AUDIO_FB_GetLevel(USBD_HandleTypeDef *pdev);
+
+static void AUDIO_FB_Update(USBD_AUDIO_HandleTypeDef *haudio);
+
+static void AUDIO_FB_Transmit(USBD_HandleTypeDef *pdev);
+#endif /* USBD_AUDIO_FEEDBACK */
+
 /**
   * @}
   */
@@ -290,7 +306,11 @@ __ALIGN_BEGIN static uint8_t USBD_AUDIO_CfgDesc[USB_AUDIO_CONFIG_DESC_SIZ] __ALI
   USB_DESC_TYPE_INTERFACE,        /* bDescriptorType */
   0x01,                                 /* bInterfaceNumber */
   0x01,                                 /* bAlternateSetting */
+#if (USBD_AUDIO_FEEDBACK == 1U)
+  0x02,                                 /* bNumEndpoints */
+#else
   0x01,                                 /* bNumEndpoints */
+#endif /* USBD_AUDIO_FEEDBACK */
   USB_DEVICE_CLASS_AUDIO,               /* bInterfaceClass */
   AUDIO_SUBCLASS_AUDIOSTREAMING,        /* bInterfaceSubClass */
   AUDIO_PROTOCOL_UNDEFINED,             /* bInterfaceProtocol */
@@ -323,11 +343,20 @@ __ALIGN_BEGIN static uint8_t USBD_AUDIO_CfgDesc[USB_AUDIO_CONFIG_DESC_SIZ] __ALI
   AUDIO_STANDARD_ENDPOINT_DESC_SIZE,    /* bLength */
   USB_DESC_TYPE_ENDPOINT,               /* bDescriptorType */
   AUDIO_OUT_EP,                         /* bEndpointAddress 1 out endpoint*/
+#if (USBD_AUDIO_FEEDBACK == 1U)
+  USBD_EP_TYPE_ISOC | 0x04U,            /* bmAttributes: isochronous, asynchronous */
+  LOBYTE(AUDIO_OUT_MAX_PACKET),         /* wMaxPacketSize in Bytes ((Freq(Samples)+1)*2(Stereo)*2(HalfWord)) */
+  HIBYTE(AUDIO_OUT_MAX_PACKET),
+  0x01,                                 /* bInterval */
+  0x00,                                 /* bRefresh */
+  AUDIO_FB_EP,                          /* bSynchAddress */
+#else
   USBD_EP_TYPE_ISOC,                    /* bmAttributes */
   AUDIO_PACKET_SZE(USBD_AUDIO_FREQ),    /* wMaxPacketSize in Bytes (Freq(Samples)*2(Stereo)*2(HalfWord)) */
   0x01,                                 /* bInterval */
   0x00,                                 /* bRefresh */
   0x00,                                 /* bSynchAddress */
+#endif /* USBD_AUDIO_FEEDBACK */
   /* 09 byte*/
 
   /* Endpoint - Audio Streaming Descriptor*/
@@ -339,6 +368,20 @@ __ALIGN_BEGIN static uint8_t USBD_AUDIO_CfgDesc[USB_AUDIO_CONFIG_DESC_SIZ] __ALI
   0x00,                                 /* wLockDelay */
   0x00,
   /* 07 byte*/
+
+#if (USBD_AUDIO_FEEDBACK == 1U)
+  /* Endpoint 1 - Standard Descriptor: explicit feedback */
+  AUDIO_STANDARD_ENDPOINT_DESC_SIZE,    /* bLength */
+  USB_DESC_TYPE_ENDPOINT,               /* bDescriptorType */
+  AUDIO_FB_EP,                          /* bEndpointAddress 1 in endpoint*/
+  USBD_EP_TYPE_ISOC,                    /* bmAttributes */
+  AUDIO_FB_PACKET,                      /* wMaxPacketSize: 10.14 format on 3 bytes */
+  0x00,
+  0x01,                                 /* bInterval */
+  AUDIO_FB_REFRESH,                     /* bRefresh: 2^AUDIO_FB_REFRESH ms */
+  0x00,                                 /* bSynchAddress */
+  /* 09 byte*/
+#endif /* USBD_AUDIO_FEEDBACK */
 } ;
 
 /* USB Standard Device Descriptor */
@@ -376,9 +419,15 @@ static uint8_t  USBD_AUDIO_Init (USBD_HandleTypeDef *pdev, uint8_t cfgidx)
   USBD_AUDIO_HandleTypeDef   *haudio;
 
   /* Open EP OUT */
-  USBD_LL_OpenEP(pdev, AUDIO_OUT_EP, USBD_EP_TYPE_ISOC, AUDIO_OUT_PACKET);
+  USBD_LL_OpenEP(pdev, AUDIO_OUT_EP, USBD_EP_TYPE_ISOC, AUDIO_OUT_MAX_PACKET);
   pdev->ep_out[AUDIO_OUT_EP & 0xFU].is_used = 1U;
 
+#if (USBD_AUDIO_FEEDBACK == 1U)
+  /* Open feedback EP IN */
+  USBD_LL_OpenEP(pdev, AUDIO_FB_EP, USBD_EP_TYPE_ISOC, AUDIO_FB_PACKET);
+  pdev->ep_in[AUDIO_FB_EP & 0xFU].is_used = 1U;
+#endif /* USBD_AUDIO_FEEDBACK */
+
   /* Allocate Audio structure */
   pdev->pClassData = USBD_malloc(sizeof (USBD_AUDIO_HandleTypeDef));
 
@@ -394,6 +443,12 @@ static uint8_t  USBD_AUDIO_Init (USBD_HandleTypeDef *pdev, uint8_t cfgidx)
     haudio->wr_ptr = 0U;
     haudio->rd_ptr = 0U;
     haudio->rd_enable = 0U;
+#if (USBD_AUDIO_FEEDBACK == 1U)
+    haudio->fb_level = 0U;
+    haudio->fb_frames = 0U;
+    haudio->sof_count = 0U;
+    AUDIO_FB_Update(haudio);
+#endif /* USBD_AUDIO_FEEDBACK */
 
     /* Initialize the Audio output Hardware layer */
     if (((USBD_AUDIO_ItfTypeDef *)pdev->pUserData)->Init(USBD_AUDIO_FREQ,
@@ -404,8 +459,13 @@ static uint8_t  USBD_AUDIO_Init (USBD_HandleTypeDef *pdev, uint8_t cfgidx)
     }
 
     /* Prepare Out endpoint to receive 1st packet */
+#if (USBD_AUDIO_FEEDBACK == 1U)
+    USBD_LL_PrepareReceive(pdev, AUDIO_OUT_EP, haudio->packet,
+                           AUDIO_OUT_MAX_PACKET);
+#else
     USBD_LL_PrepareReceive(pdev, AUDIO_OUT_EP, haudio->buffer,
                            AUDIO_OUT_PACKET);
+#endif /* USBD_AUDIO_FEEDBACK */
   }
   return USBD_OK;
 }
@@ -425,6 +485,11 @@ static uint8_t  USBD_AUDIO_DeInit (USBD_HandleTypeDef *pdev,
   USBD_LL_CloseEP(pdev, AUDIO_OUT_EP);
   pdev->ep_out[AUDIO_OUT_EP & 0xFU].is_used = 0U;
 
+#if (USBD_AUDIO_FEEDBACK == 1U)
+  USBD_LL_CloseEP(pdev, AUDIO_FB_EP);
+  pdev->ep_in[AUDIO_FB_EP & 0xFU].is_used = 0U;
+#endif /* USBD_AUDIO_FEEDBACK */
+
   /* DeInit  physical Interface components */
   if(pdev->pClassData != NULL)
   {
@@ -517,6 +582,14 @@ static uint8_t  USBD_AUDIO_Setup (USBD_HandleTypeDef *pdev,
          if ((uint8_t)(req->wValue) <= USBD_MAX_NUM_INTERFACES)
          {
            haudio->alt_setting = (uint8_t)(req->wValue);
+#if (USBD_AUDIO_FEEDBACK == 1U)
+           if (haudio->alt_setting == 1U)
+           {
+             /* Streaming starts: queue the first feedback value */
+             USBD_LL_FlushEP(pdev, AUDIO_FB_EP);
+             AUDIO_FB_Transmit(pdev);
+           }
+#endif /* USBD_AUDIO_FEEDBACK */
          }
          else
          {
@@ -571,8 +644,18 @@ static uint8_t  *USBD_AUDIO_GetCfgDesc (uint16_t *length)
 static uint8_t  USBD_AUDIO_DataIn (USBD_HandleTypeDef *pdev,
                               uint8_t epnum)
 {
+#if (USBD_AUDIO_FEEDBACK == 1U)
+  USBD_AUDIO_HandleTypeDef   *haudio;
+  haudio = (USBD_AUDIO_HandleTypeDef*) pdev->pClassData;
+
+  if (((epnum | 0x80U) == AUDIO_FB_EP) && (haudio->alt_setting == 1U))
+  {
+    /* Feedback value read by the host: queue the next one */
+    AUDIO_FB_Transmit(pdev);
+  }
+#endif /* USBD_AUDIO_FEEDBACK */
 
-  /* Only OUT data are processed */
+  /* Only OUT data and feedback are processed */
   return USBD_OK;
 }
 
@@ -619,6 +702,24 @@ static uint8_t  USBD_AUDIO_EP0_TxReady (USBD_HandleTypeDef *pdev)
   */
 static uint8_t  USBD_AUDIO_SOF (USBD_HandleTypeDef *pdev)
 {
+#if (USBD_AUDIO_FEEDBACK == 1U)
+  USBD_AUDIO_HandleTypeDef   *haudio;
+  haudio = (USBD_AUDIO_HandleTypeDef*) pdev->pClassData;
+
+  if ((haudio != NULL) && (haudio->offset != AUDIO_OFFSET_UNKNOWN))
+  {
+    /* Playback running: average the fill level over one refresh period */
+    haudio->sof_count++;
+    haudio->fb_level += AUDIO_FB_GetLevel(pdev);
+    haudio->fb_frames++;
+
+    if (haudio->fb_frames == (1U << AUDIO_FB_REFRESH))
+    {
+      AUDIO_FB_Update(haudio);
+    }
+  }
+#endif /* USBD_AUDIO_FEEDBACK */
+
   return USBD_OK;
 }
 
@@ -635,6 +736,9 @@ void  USBD_AUDIO_Sync (USBD_HandleTypeDef *pdev, AUDIO_OffsetTypeDef offset)
   haudio = (USBD_AUDIO_HandleTypeDef*) pdev->pClassData;
 
   haudio->offset =  offset;
+#if (USBD_AUDIO_FEEDBACK == 1U)
+  haudio->sof_count = 0U;
+#endif /* USBD_AUDIO_FEEDBACK */
 
   if(haudio->rd_enable == 1U)
   {
@@ -694,6 +798,18 @@ void  USBD_AUDIO_Sync (USBD_HandleTypeDef *pdev, AUDIO_OffsetTypeDef offset)
   */
 static uint8_t  USBD_AUDIO_IsoINIncomplete (USBD_HandleTypeDef *pdev, uint8_t epnum)
 {
+#if (USBD_AUDIO_FEEDBACK == 1U)
+  USBD_AUDIO_HandleTypeDef   *haudio;
+  haudio = (USBD_AUDIO_HandleTypeDef*) pdev->pClassData;
+
+  /* The host polls the feedback endpoint every 2^AUDIO_FB_REFRESH frames;
+     a value not read in its frame is flushed and queued again */
+  if ((haudio != NULL) && (haudio->alt_setting == 1U))
+  {
+    USBD_LL_FlushEP(pdev, AUDIO_FB_EP);
+    AUDIO_FB_Transmit(pdev);
+  }
+#endif /* USBD_AUDIO_FEEDBACK */
 
   return USBD_OK;
 }
@@ -724,6 +840,35 @@ static uint8_t  USBD_AUDIO_DataOut (USBD_HandleTypeDef *pdev,
 
   if (epnum == AUDIO_OUT_EP)
   {
+#if (USBD_AUDIO_FEEDBACK == 1U)
+    uint32_t count;
+    uint32_t len;
+
+    /* Packet size follows the feedback value: copy it into the ring buffer */
+    count = MIN(USBD_LL_GetRxDataSize(pdev, epnum), AUDIO_OUT_MAX_PACKET);
+    len = MIN(count, (uint32_t)AUDIO_TOTAL_BUF_SIZE - haudio->wr_ptr);
+
+    memcpy(&haudio->buffer[haudio->wr_ptr], haudio->packet, len);
+    memcpy(&haudio->buffer[0], &haudio->packet[len], count - len);
+    haudio->wr_ptr = (uint16_t)((haudio->wr_ptr + count) % AUDIO_TOTAL_BUF_SIZE);
+
+    /* Start playback once half of the buffer is filled: the feedback
+       endpoint then holds the fill level around this point */
+    if ((haudio->offset == AUDIO_OFFSET_UNKNOWN) &&
+        (haudio->wr_ptr >= (AUDIO_TOTAL_BUF_SIZE / 2U)))
+    {
+      ((USBD_AUDIO_ItfTypeDef *)pdev->pUserData)->AudioCmd(&haudio->buffer[0],
+                                                           AUDIO_TOTAL_BUF_SIZE / 2U,
+                                                           AUDIO_CMD_START);
+      haudio->offset = AUDIO_OFFSET_NONE;
+      haudio->rd_enable = 1U;
+      haudio->sof_count = 0U;
+    }
+
+    /* Prepare Out endpoint to receive next audio packet */
+    USBD_LL_PrepareReceive(pdev, AUDIO_OUT_EP, haudio->packet,
+                           AUDIO_OUT_MAX_PACKET);
+#else
     /* Increment the Buffer pointer or roll it back when all buffers are full */
 
     haudio->wr_ptr += AUDIO_OUT_PACKET;
@@ -753,6 +898,7 @@ static uint8_t  USBD_AUDIO_DataOut (USBD_HandleTypeDef *pdev,
     /* Prepare Out endpoint to receive next audio packet */
     USBD_LL_PrepareReceive(pdev, AUDIO_OUT_EP, &haudio->buffer[haudio->wr_ptr],
                            AUDIO_OUT_PACKET);
+#endif /* USBD_AUDIO_FEEDBACK */
   }
 
   return USBD_OK;
@@ -801,6 +947,90 @@ static void AUDIO_REQ_SetCurrent(USBD_HandleTypeDef *pdev, USBD_SetupReqTypedef
   }
 }
 
+#if (USBD_AUDIO_FEEDBACK == 1U)
+/**
+  * @brief  AUDIO_FB_GetLevel
+  *         Return the number of bytes queued ahead of the playback position.
+  *         The position is read from the interface when GetPlayPos is
+  *         provided (SAI/I2S DMA counter), else it is extrapolated from the
+  *         last half/full transfer event at one packet per frame.
+  * @param  pdev: instance
+  * @retval fill level in bytes
+  */
+static uint32_t AUDIO_FB_GetLevel(USBD_HandleTypeDef *pdev)
+{
+  USBD_AUDIO_HandleTypeDef   *haudio;
+  USBD_AUDIO_ItfTypeDef      *itf;
+  uint32_t rd_pos;
+
+  haudio = (USBD_AUDIO_HandleTypeDef*) pdev->pClassData;
+  itf = (USBD_AUDIO_ItfTypeDef *)pdev->pUserData;
+
+  if ((itf->GetPlayPos == NULL) || (itf->GetPlayPos(&rd_pos) != 0))
+  {
+    rd_pos = haudio->rd_ptr + MIN((uint32_t)haudio->sof_count * AUDIO_OUT_PACKET,
+                                  (uint32_t)AUDIO_TOTAL_BUF_SIZE / 2U);
+  }
+
+  rd_pos %= AUDIO_TOTAL_BUF_SIZE;
+
+  return (haudio->wr_ptr + AUDIO_TOTAL_BUF_SIZE - rd_pos) % AUDIO_TOTAL_BUF_SIZE;
+}
+
+/**
+  * @brief  AUDIO_FB_Update
+  *         Compute the feedback value from the averaged fill level: the
+  *         host is asked for more samples when the buffer drains below half
+  *         and for fewer when it fills above.
+  * @param  haudio: audio class handle
+  * @retval None
+  */
+static void AUDIO_FB_Update(USBD_AUDIO_HandleTypeDef *haudio)
+{
+  int32_t error = 0;
+
+  if (haudio->fb_frames != 0U)
+  {
+    /* Distance to the half-buffer set point, in stereo 16-bit samples */
+    error = ((int32_t)(AUDIO_TOTAL_BUF_SIZE / 2U) -
+             (int32_t)(haudio->fb_level >> AUDIO_FB_REFRESH)) / 4;
+    error *= (int32_t)(1UL << (14U - AUDIO_FB_GAIN));
+
+    if (error > AUDIO_FB_MAX_CORRECTION)
+    {
+      error = AUDIO_FB_MAX_CORRECTION;
+    }
+    else if (error < -AUDIO_FB_MAX_CORRECTION)
+    {
+      error = -AUDIO_FB_MAX_CORRECTION;
+    }
+  }
+
+  haudio->fb_value = (uint32_t)((int32_t)AUDIO_FB_NOMINAL + error);
+  haudio->fb_level = 0U;
+  haudio->fb_frames = 0U;
+
+  /* 10.14 format, little endian on 3 bytes */
+  haudio->fb_data[0] = (uint8_t)(haudio->fb_value);
+  haudio->fb_data[1] = (uint8_t)(haudio->fb_value >> 8);
+  haudio->fb_data[2] = (uint8_t)(haudio->fb_value >> 16);
+}
+
+/**
+  * @brief  AUDIO_FB_Transmit
+  *         Queue the current feedback value on the feedback endpoint.
+  * @param  pdev: instance
+  * @retval None
+  */
+static void AUDIO_FB_Transmit(USBD_HandleTypeDef *pdev)
+{
+  USBD_AUDIO_HandleTypeDef   *haudio;
+  haudio = (USBD_AUDIO_HandleTypeDef*) pdev->pClassData;
+
+  USBD_LL_Transmit(pdev, AUDIO_FB_EP, haudio->fb_data, AUDIO_FB_PACKET);
+}
+#endif /* USBD_AUDIO_FEEDBACK */
+
 
 /**
 * @brief  DeviceQualifierDescriptor
@@ -108,6 +108,7 @@ USBD_AUDIO_ItfTypeDef USBD_AUDIO_Template_fops =
   TEMPLATE_MuteCtl,
   TEMPLATE_PeriodicTC,
   TEMPLATE_GetState,
+  NULL,
 };
 
 /* Private functions ---------------------------------------------------------*/
@@ -0,0 +1,305 @@
+/**
+  ******************************************************************************
+  * @file    usbd_audio2.h
+  * @author  MCD Application Team
+  * @brief   header file for the usbd_audio2.c file.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics International N.V.
+  * All rights reserved.</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without
+  * modification, are permitted, provided that the following conditions are met:
+  *
+  * 1. Redistribution of source code must retain the above copyright notice,
+  *    this list of conditions and the following disclaimer.
+  * 2. Redistributions in binary form must reproduce the above copyright notice,
+  *    this list of conditions and the following disclaimer in the documentation
+  *    and/or other materials provided with the distribution.
+  * 3. Neither the name of STMicroelectronics nor the names of other
+  *    contributors to this software may be used to endorse or promote products
+  *    derived from this software without specific written permission.
+  * 4. This software, including modifications and/or derivative works of this
+  *    software, must execute solely and exclusively on microcontroller or
+  *    microprocessor devices manufactured by or for STMicroelectronics.
+  * 5. Redistribution and use of this software other than as permitted under
+  *    this license is void and will automatically terminate your rights under
+  *    this license.
+  *
+  * THIS SOFTWARE IS PROVIDED BY STMICROELECTRONICS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS, IMPLIED OR STATUTORY WARRANTIES, INCLUDING, BUT NOT
+  * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+  * PARTICULAR PURPOSE AND NON-INFRINGEMENT OF THIRD PARTY INTELLECTUAL PROPERTY
+  * RIGHTS ARE DISCLAIMED TO THE FULLEST EXTENT PERMITTED BY LAW. IN NO EVENT
+  * SHALL STMICROELECTRONICS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+  * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+  * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __USB_AUDIO2_H
+#define __USB_AUDIO2_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include  "usbd_ioreq.h"
+
+/** @addtogroup STM32_USB_DEVICE_LIBRARY
+  * @{
+  */
+
+/** @defgroup USBD_AUDIO2
+  * @brief This file is the Header file for usbd_audio2.c
+  * @{
+  */
+
+
+/** @defgroup USBD_AUDIO2_Exported_Defines
+  * @{
+  */
+/* Channels of the stream, 1 to 16: interleaved in 32-bit subslots */
+#ifndef USBD_AUDIO2_CHANNELS
+#define USBD_AUDIO2_CHANNELS                          8U
+#endif /* USBD_AUDIO2_CHANNELS */
+
+/* Spatial locations of the channels (bmChannelConfig), 0: none */
+#ifndef USBD_AUDIO2_CHANNEL_CONFIG
+#define USBD_AUDIO2_CHANNEL_CONFIG                    0x00000000U
+#endif /* USBD_AUDIO2_CHANNEL_CONFIG */
+
+/* Valid bits in each 32-bit subslot, MSB aligned: 16 to 32 */
+#ifndef USBD_AUDIO2_RESOLUTION
+#define USBD_AUDIO2_RESOLUTION                        24U
+#endif /* USBD_AUDIO2_RESOLUTION */
+
+/* Sampling frequencies offered by the clock source, in Hz and in ascending
+   order (5 at most): USBD_AUDIO2_FREQ_MAX is the last one and sizes the
+   endpoint, USBD_AUDIO2_FREQ_DEFAULT is selected at start-up */
+#ifndef USBD_AUDIO2_FREQ_LIST
+#define USBD_AUDIO2_FREQ_LIST                         44100U, 48000U, 88200U, 96000U
+#endif /* USBD_AUDIO2_FREQ_LIST */
+#ifndef USBD_AUDIO2_FREQ_MAX
+#define USBD_AUDIO2_FREQ_MAX                          96000U
+#endif /* USBD_AUDIO2_FREQ_MAX */
+#ifndef USBD_AUDIO2_FREQ_DEFAULT
+#define USBD_AUDIO2_FREQ_DEFAULT                      48000U
+#endif /* USBD_AUDIO2_FREQ_DEFAULT */
+
+/* Ring shared with the audio DMA, in frames of USBD_AUDIO2_CHANNELS
+   subslots: the feedback endpoint holds its fill level at one half */
+#ifndef USBD_AUDIO2_RING_FRAMES
+#define USBD_AUDIO2_RING_FRAMES                       384U
+#endif /* USBD_AUDIO2_RING_FRAMES */
+
+/* Feedback refresh period: 2^AUDIO2_FB_REFRESH packets, the fill level
+   being averaged over this period */
+#ifndef AUDIO2_FB_REFRESH
+#define AUDIO2_FB_REFRESH                             3U
+#endif /* AUDIO2_FB_REFRESH */
+
+/* Loop gain: a fill level error of 2^AUDIO2_FB_GAIN frames moves the
+   feedback value by one frame per packet */
+#ifndef AUDIO2_FB_GAIN
+#define AUDIO2_FB_GAIN                                8U
+#endif /* AUDIO2_FB_GAIN */
+
+#ifndef AUDIO2_OUT_EP
+#define AUDIO2_OUT_EP                                 0x01U
+#endif /* AUDIO2_OUT_EP */
+#ifndef AUDIO2_FB_EP
+#define AUDIO2_FB_EP                                  0x81U
+#endif /* AUDIO2_FB_EP */
+
+/* Bytes per frame: one 32-bit subslot per channel */
+#define AUDIO2_SUBSLOT_SIZE                           4U
+#define AUDIO2_FRAME_SIZE                             (USBD_AUDIO2_CHANNELS * AUDIO2_SUBSLOT_SIZE)
+#define AUDIO2_RING_SIZE                              (USBD_AUDIO2_RING_FRAMES * AUDIO2_FRAME_SIZE)
+
+/* Largest packet: the frames of one service interval at the highest
+   frequency plus one, for the asynchronous rate adjustment. High speed
+   packets are sent every microframe, full speed packets every frame */
+#define AUDIO2_HS_MAX_PACKET                          ((((USBD_AUDIO2_FREQ_MAX + 7999U) / 8000U) + 1U) * AUDIO2_FRAME_SIZE)
+#define AUDIO2_FS_MAX_PACKET                          ((((USBD_AUDIO2_FREQ_MAX + 999U) / 1000U) + 1U) * AUDIO2_FRAME_SIZE)
+
+/* Feedback: 16.16 frames per microframe at high speed, 10.14 frames per
+   frame on 3 bytes at full speed */
+#define AUDIO2_HS_FB_PACKET                           4U
+#define AUDIO2_FS_FB_PACKET                           3U
+
+/* Feedback polling: 2^(bInterval - 1) microframes (HS) or frames (FS) */
+#define AUDIO2_HS_FB_BINTERVAL                        0x04U
+#define AUDIO2_FS_FB_BINTERVAL                        0x01U
+
+/* A full speed configuration streams only when one frame of the stream
+   fits in an isochronous packet; it has no operational setting otherwise */
+#if (AUDIO2_FS_MAX_PACKET <= 1023U)
+#define AUDIO2_FS_STREAMING                           1U
+#else
+#define AUDIO2_FS_STREAMING                           0U
+#endif
+
+#if (AUDIO2_HS_MAX_PACKET > 1024U)
+#error "USBD_AUDIO2: one microframe of the stream exceeds 1024 bytes"
+#endif
+
+/* Largest packet received at either speed */
+#if (AUDIO2_FS_STREAMING == 1U)
+#define AUDIO2_MAX_PACKET                             AUDIO2_FS_MAX_PACKET
+#else
+#define AUDIO2_MAX_PACKET                             AUDIO2_HS_MAX_PACKET
+#endif
+
+#if (AUDIO2_RING_SIZE < (2U * AUDIO2_MAX_PACKET))
+#error "USBD_AUDIO2: USBD_AUDIO2_RING_FRAMES holds less than two packets"
+#endif
+
+#define USB_AUDIO2_HS_CONFIG_DESC_SIZ                 134U
+#if (AUDIO2_FS_STREAMING == 1U)
+#define USB_AUDIO2_FS_CONFIG_DESC_SIZ                 134U
+#else
+#define USB_AUDIO2_FS_CONFIG_DESC_SIZ                 81U
+#endif
+#define AUDIO2_AC_DESC_SIZ                            46U
+
+/* Entities of the audio function */
+#define AUDIO2_CLOCK_ID                               0x10U
+#define AUDIO2_INPUT_TERMINAL_ID                      0x01U
+#define AUDIO2_OUTPUT_TERMINAL_ID                     0x02U
+
+/*---------------------------------------------------------------------*/
+/*  USB Audio 2.0 definitions                                          */
+/*---------------------------------------------------------------------*/
+#define AUDIO2_CLASS_AUDIO                            0x01U
+#define AUDIO2_SUBCLASS_AUDIOCONTROL                  0x01U
+#define AUDIO2_SUBCLASS_AUDIOSTREAMING                0x02U
+#define AUDIO2_IP_VERSION_02_00                       0x20U
+#define AUDIO2_FUNCTION_PRO_AUDIO                     0x0AU
+
+#define AUDIO2_CS_INTERFACE                           0x24U
+#define AUDIO2_CS_ENDPOINT                            0x25U
+
+#define AUDIO2_AC_HEADER                              0x01U
+#define AUDIO2_AC_INPUT_TERMINAL                      0x02U
+#define AUDIO2_AC_OUTPUT_TERMINAL                     0x03U
+#define AUDIO2_AC_CLOCK_SOURCE                        0x0AU
+#define AUDIO2_AS_GENERAL                             0x01U
+#define AUDIO2_AS_FORMAT_TYPE                         0x02U
+#define AUDIO2_EP_GENERAL                             0x01U
+#define AUDIO2_FORMAT_TYPE_I                          0x01U
+
+#define AUDIO2_REQ_CUR                                0x01U
+#define AUDIO2_REQ_RANGE                              0x02U
+
+#define AUDIO2_CS_SAM_FREQ_CONTROL                    0x01U
+#define AUDIO2_CS_CLOCK_VALID_CONTROL                 0x02U
+
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_CORE_Exported_TypesDefinitions
+  * @{
+  */
+typedef enum
+{
+  AUDIO2_CMD_START = 1,
+  AUDIO2_CMD_STOP,
+}AUDIO2_CMD_TypeDef;
+
+/**
+  * @}
+  */
+typedef struct _USBD_AUDIO2_Itf
+{
+  int8_t  (*Init)         (uint32_t AudioFreq, uint32_t Channels, uint32_t options);
+  int8_t  (*DeInit)       (uint32_t options);
+  int8_t  (*AudioCmd)     (uint8_t *pbuf, uint32_t size, uint8_t cmd);
+  int8_t  (*SetFreq)      (uint32_t AudioFreq);
+  int8_t  (*GetPlayPos)   (uint32_t *pPos);   /* Byte offset read by the audio DMA */
+}USBD_AUDIO2_ItfTypeDef;
+
+
+typedef struct
+{
+  uint32_t data[16];                                    /* Class requests, force 32bits alignment */
+  uint8_t  CmdSelector;                                 /* SET_CUR pending on EP0 */
+  uint8_t  alt_setting;
+  uint32_t freq;
+  uint32_t max_packet;                                  /* OUT packet size at the current speed */
+  uint32_t wr_ptr;
+  __IO uint32_t started;
+
+  /* Asynchronous feedback */
+  uint32_t fb_nominal;
+  uint32_t fb_value;
+  uint32_t fb_level;
+  uint32_t fb_packets;
+  uint8_t  fb_data[4];
+
+  /* Statistics */
+  uint32_t packets;
+  uint32_t xruns;                                       /* Fill level out of the ring */
+  uint32_t errors;                                      /* Packets not made of whole frames */
+
+  /* Interleaved frames read in place by the audio DMA: packets are received
+     at the write position, the part received past the end of the ring is
+     copied back to its start */
+  uint32_t ring[(AUDIO2_RING_SIZE + AUDIO2_MAX_PACKET) / 4U];
+}
+USBD_AUDIO2_HandleTypeDef;
+
+
+
+/** @defgroup USBD_CORE_Exported_Macros
+  * @{
+  */
+
+/**
+  * @}
+  */
+
+/** @defgroup USBD_CORE_Exported_Variables
+  * @{
+  */
+
+extern USBD_ClassTypeDef  USBD_AUDIO2;
+#define USBD_AUDIO2_CLASS    &USBD_AUDIO2
+/**
+  * @}
+  */
+
+/** @defgroup USB_CORE_Exported_Functions
+  * @{
+  */
+uint8_t  USBD_AUDIO2_RegisterInterface  (USBD_HandleTypeDef   *pdev,
+                                         USBD_AUDIO2_ItfTypeDef *fops);
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __USB_AUDIO2_H */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
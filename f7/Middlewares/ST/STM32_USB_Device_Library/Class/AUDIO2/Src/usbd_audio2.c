@@ -0,0 +1,1394 @@
+/**
+  ******************************************************************************
+  * @file    usbd_audio2.c
+  * @author  MCD Application Team
+  * @brief   This file provides the Audio 2.0 core functions.
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                AUDIO 2.0 Class Description
+  *          ===================================================================
+  *           This driver manages the "Universal Serial Bus Device Class
+  *           Definition for Audio Devices Release 2.0 May 31, 2006" for a
+  *           multichannel speaker (playback only):
+  *             - Interface association and class specific descriptors: an
+  *               internal programmable clock source, a USB streaming input
+  *               terminal of USBD_AUDIO2_CHANNELS channels and an output
+  *               terminal
+  *             - Sampling frequency CUR/RANGE and clock validity requests
+  *             - Type I PCM format, 32-bit subslots holding
+  *               USBD_AUDIO2_RESOLUTION valid bits
+  *             - Asynchronous isochronous OUT endpoint, one packet per
+  *               microframe at high speed and per frame at full speed, and
+  *               its explicit feedback endpoint
+  *
+  *           Zero copy:
+  *             The packets are received one after the other in a ring of
+  *             USBD_AUDIO2_RING_FRAMES interleaved frames, which the
+  *             interface AudioCmd(AUDIO2_CMD_START) hands to the audio DMA
+  *             once half filled: a SAI block in TDM with one 32-bit slot per
+  *             channel plays it in place. Only the part of a packet received
+  *             past the end of the ring is copied back to its start. The
+  *             feedback value follows the distance between the write position
+  *             and the DMA position given by GetPlayPos(), so the host holds
+  *             the ring half full at the rate of the codec clock.
+  *
+  *           The ring is part of the class data from USBD_malloc(): place it
+  *           in memory both the USB and the audio DMA reach and, on a
+  *           Cortex-M7 with the D-cache enabled, outside of the cacheable
+  *           regions.
+  *
+  *           At full speed the stream must fit in 1023 bytes per frame: the
+  *           streaming interface has no operational setting otherwise.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics International N.V.
+  * All rights reserved.</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without
+  * modification, are permitted, provided that the following conditions are met:
+  *
+  * 1. Redistribution of source code must retain the above copyright notice,
+  *    this list of conditions and the following disclaimer.
+  * 2. Redistributions in binary form must reproduce the above copyright notice,
+  *    this list of conditions and the following disclaimer in the documentation
+  *    and/or other materials provided with the distribution.
+  * 3. Neither the name of STMicroelectronics nor the names of other
+  *    contributors to this software may be used to endorse or promote products
+  *    derived from this software without specific written permission.
+  * 4. This software, including modifications and/or derivative works of this
+  *    software, must execute solely and exclusively on microcontroller or
+  *    microprocessor devices manufactured by or for STMicroelectronics.
+  * 5. Redistribution and use of this software other than as permitted under
+  *    this license is void and will automatically terminate your rights under
+  *    this license.
+  *
+  * THIS SOFTWARE IS PROVIDED BY STMICROELECTRONICS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS, IMPLIED OR STATUTORY WARRANTIES, INCLUDING, BUT NOT
+  * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+  * PARTICULAR PURPOSE AND NON-INFRINGEMENT OF THIRD PARTY INTELLECTUAL PROPERTY
+  * RIGHTS ARE DISCLAIMED TO THE FULLEST EXTENT PERMITTED BY LAW. IN NO EVENT
+  * SHALL STMICROELECTRONICS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+  * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+  * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+  /* BSPDependencies
+  - "stm32xxxxx_{eval}{discovery}.c"
+  - "stm32xxxxx_{eval}{discovery}_io.c"
+  - "stm32xxxxx_{eval}{discovery}_audio.c"
+  EndBSPDependencies */
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbd_audio2.h"
+#include "usbd_ctlreq.h"
+
+
+/** @addtogroup STM32_USB_DEVICE_LIBRARY
+  * @{
+  */
+
+
+/** @defgroup USBD_AUDIO2
+  * @brief usbd core module
+  * @{
+  */
+
+/** @defgroup USBD_AUDIO2_Private_TypesDefinitions
+  * @{
+  */
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_AUDIO2_Private_Defines
+  * @{
+  */
+#ifndef USBD_memcpy
+#include <string.h>
+#define USBD_memcpy                 memcpy
+#endif /* USBD_memcpy */
+
+#define AUDIO2_AC_ITF               0x00U
+#define AUDIO2_AS_ITF               0x01U
+
+/* Largest correction of the feedback value: 1/64 of the nominal rate */
+#define AUDIO2_FB_MAX_SHIFT         6U
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_AUDIO2_Private_Macros
+  * @{
+  */
+#define AUDIO2_LE32(__X__)          (uint8_t)(__X__), (uint8_t)((__X__) >> 8), \
+                                    (uint8_t)((__X__) >> 16), (uint8_t)((__X__) >> 24)
+
+#define AUDIO2_IS_HS(__PDEV__)      ((__PDEV__)->dev_speed == USBD_SPEED_HIGH)
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_AUDIO2_Private_FunctionPrototypes
+  * @{
+  */
+
+
+static uint8_t  USBD_AUDIO2_Init (USBD_HandleTypeDef *pdev,
+                                  uint8_t cfgidx);
+
+static uint8_t  USBD_AUDIO2_DeInit (USBD_HandleTypeDef *pdev,
+                                    uint8_t cfgidx);
+
+static uint8_t  USBD_AUDIO2_Setup (USBD_HandleTypeDef *pdev,
+                                   USBD_SetupReqTypedef *req);
+
+static uint8_t  USBD_AUDIO2_DataIn (USBD_HandleTypeDef *pdev,
+                                    uint8_t epnum);
+
+static uint8_t  USBD_AUDIO2_DataOut (USBD_HandleTypeDef *pdev,
+                                     uint8_t epnum);
+
+static uint8_t  USBD_AUDIO2_EP0_RxReady (USBD_HandleTypeDef *pdev);
+
+static uint8_t  USBD_AUDIO2_IsoINIncomplete (USBD_HandleTypeDef *pdev,
+                                             uint8_t epnum);
+
+static uint8_t  *USBD_AUDIO2_GetFSCfgDesc (uint16_t *length);
+
+static uint8_t  *USBD_AUDIO2_GetHSCfgDesc (uint16_t *length);
+
+static uint8_t  *USBD_AUDIO2_GetOtherSpeedCfgDesc (uint16_t *length);
+
+uint8_t  *USBD_AUDIO2_GetDeviceQualifierDescriptor (uint16_t *length);
+
+static void     USBD_AUDIO2_ClockRequest (USBD_HandleTypeDef *pdev,
+                                          USBD_SetupReqTypedef *req);
+
+static void     USBD_AUDIO2_SetAlt (USBD_HandleTypeDef *pdev, uint8_t alt);
+
+static uint32_t AUDIO2_FB_GetLevel (USBD_HandleTypeDef *pdev);
+
+static void     AUDIO2_FB_Update (USBD_HandleTypeDef *pdev);
+
+static void     AUDIO2_FB_Transmit (USBD_HandleTypeDef *pdev);
+
+static void     USBD_AUDIO2_Put16 (uint8_t *pbuf, uint32_t value);
+
+static void     USBD_AUDIO2_Put32 (uint8_t *pbuf, uint32_t value);
+
+/* USB Standard Device Descriptor */
+__ALIGN_BEGIN static uint8_t USBD_AUDIO2_DeviceQualifierDesc[USB_LEN_DEV_QUALIFIER_DESC] __ALIGN_END =
+{
+  USB_LEN_DEV_QUALIFIER_DESC,
+  USB_DESC_TYPE_DEVICE_QUALIFIER,
+  0x00,
+  0x02,
+  0x00,
+  0x00,
+  0x00,
+  0x40,
+  0x01,
+  0x00,
+};
+
+/**
+  * @}
+  */
+
+/** @defgroup USBD_AUDIO2_Private_Variables
+  * @{
+  */
+
+
+/* AUDIO 2.0 interface class callbacks structure */
+USBD_ClassTypeDef  USBD_AUDIO2 =
+{
+  USBD_AUDIO2_Init,
+  USBD_AUDIO2_DeInit,
+  USBD_AUDIO2_Setup,
+  NULL,                 /* EP0_TxSent, */
+  USBD_AUDIO2_EP0_RxReady,
+  USBD_AUDIO2_DataIn,
+  USBD_AUDIO2_DataOut,
+  NULL,
+  USBD_AUDIO2_IsoINIncomplete,
+  NULL,
+  USBD_AUDIO2_GetHSCfgDesc,
+  USBD_AUDIO2_GetFSCfgDesc,
+  USBD_AUDIO2_GetOtherSpeedCfgDesc,
+  USBD_AUDIO2_GetDeviceQualifierDescriptor,
+};
+
+/* USB AUDIO 2.0 device Configuration Descriptor */
+__ALIGN_BEGIN static uint8_t USBD_AUDIO2_CfgHSDesc[USB_AUDIO2_HS_CONFIG_DESC_SIZ] __ALIGN_END =
+{
+  /* Configuration 1 */
+  0x09,                                 /* bLength */
+  USB_DESC_TYPE_CONFIGURATION,   /* bDescriptorType */
+  LOBYTE(USB_AUDIO2_HS_CONFIG_DESC_SIZ),  /* wTotalLength */
+  HIBYTE(USB_AUDIO2_HS_CONFIG_DESC_SIZ),
+  0x02,                                 /* bNumInterfaces */
+  0x01,                                 /* bConfigurationValue */
+  0x00,                                 /* iConfiguration */
+  0xC0,                                 /* bmAttributes: self powered */
+  0x32,                                 /* MaxPower 100 mA */
+  /* 09 byte*/
+
+  /* Interface Association Descriptor */
+  0x08,                                 /* bLength */
+  0x0B,                                 /* bDescriptorType: IAD */
+  0x00,                                 /* bFirstInterface */
+  0x02,                                 /* bInterfaceCount */
+  AUDIO2_CLASS_AUDIO,                   /* bFunctionClass */
+  0x00,                                 /* bFunctionSubClass */
+  AUDIO2_IP_VERSION_02_00,              /* bFunctionProtocol */
+  0x00,                                 /* iFunction */
+  /* 08 byte*/
+
+  /* USB Speaker Standard AC Interface Descriptor */
+  0x09,                                 /* bLength */
+  USB_DESC_TYPE_INTERFACE,              /* bDescriptorType */
+  0x00,                                 /* bInterfaceNumber */
+  0x00,                                 /* bAlternateSetting */
+  0x00,                                 /* bNumEndpoints */
+  AUDIO2_CLASS_AUDIO,                   /* bInterfaceClass */
+  AUDIO2_SUBCLASS_AUDIOCONTROL,         /* bInterfaceSubClass */
+  AUDIO2_IP_VERSION_02_00,              /* bInterfaceProtocol */
+  0x00,                                 /* iInterface */
+  /* 09 byte*/
+
+  /* USB Speaker Class-specific AC Interface Descriptor */
+  0x09,                                 /* bLength */
+  AUDIO2_CS_INTERFACE,                  /* bDescriptorType */
+  AUDIO2_AC_HEADER,                     /* bDescriptorSubtype */
+  0x00,                                 /* bcdADC: 2.00 */
+  0x02,
+  AUDIO2_FUNCTION_PRO_AUDIO,            /* bCategory */
+  LOBYTE(AUDIO2_AC_DESC_SIZ),           /* wTotalLength */
+  HIBYTE(AUDIO2_AC_DESC_SIZ),
+  0x00,                                 /* bmControls */
+  /* 09 byte*/
+
+  /* USB Speaker Clock Source Descriptor */
+  0x08,                                 /* bLength */
+  AUDIO2_CS_INTERFACE,                  /* bDescriptorType */
+  AUDIO2_AC_CLOCK_SOURCE,               /* bDescriptorSubtype */
+  AUDIO2_CLOCK_ID,                      /* bClockID */
+  0x03,                                 /* bmAttributes: internal programmable clock */
+  0x07,                                 /* bmControls: frequency read/write, validity read */
+  0x00,                                 /* bAssocTerminal */
+  0x00,                                 /* iClockSource */
+  /* 08 byte*/
+
+  /* USB Speaker Input Terminal Descriptor */
+  0x11,                                 /* bLength */
+  AUDIO2_CS_INTERFACE,                  /* bDescriptorType */
+  AUDIO2_AC_INPUT_TERMINAL,             /* bDescriptorSubtype */
+  AUDIO2_INPUT_TERMINAL_ID,             /* bTerminalID */
+  0x01,                                 /* wTerminalType: USB streaming */
+  0x01,
+  0x00,                                 /* bAssocTerminal */
+  AUDIO2_CLOCK_ID,                      /* bCSourceID */
+  USBD_AUDIO2_CHANNELS,                 /* bNrChannels */
+  AUDIO2_LE32(USBD_AUDIO2_CHANNEL_CONFIG),  /* bmChannelConfig */
+  0x00,                                 /* iChannelNames */
+  0x00,                                 /* bmControls */
+  0x00,
+  0x00,                                 /* iTerminal */
+  /* 17 byte*/
+
+  /* USB Speaker Output Terminal Descriptor */
+  0x0C,                                 /* bLength */
+  AUDIO2_CS_INTERFACE,                  /* bDescriptorType */
+  AUDIO2_AC_OUTPUT_TERMINAL,            /* bDescriptorSubtype */
+  AUDIO2_OUTPUT_TERMINAL_ID,            /* bTerminalID */
+  0x01,                                 /* wTerminalType: speaker */
+  0x03,
+  0x00,                                 /* bAssocTerminal */
+  AUDIO2_INPUT_TERMINAL_ID,             /* bSourceID */
+  AUDIO2_CLOCK_ID,                      /* bCSourceID */
+  0x00,                                 /* bmControls */
+  0x00,
+  0x00,                                 /* iTerminal */
+  /* 12 byte*/
+
+  /* USB Speaker Standard AS Interface Descriptor - Audio Streaming Zero Bandwidth */
+  0x09,                                 /* bLength */
+  USB_DESC_TYPE_INTERFACE,              /* bDescriptorType */
+  0x01,                                 /* bInterfaceNumber */
+  0x00,                                 /* bAlternateSetting */
+  0x00,                                 /* bNumEndpoints */
+  AUDIO2_CLASS_AUDIO,                   /* bInterfaceClass */
+  AUDIO2_SUBCLASS_AUDIOSTREAMING,       /* bInterfaceSubClass */
+  AUDIO2_IP_VERSION_02_00,              /* bInterfaceProtocol */
+  0x00,                                 /* iInterface */
+  /* 09 byte*/
+
+  /* USB Speaker Standard AS Interface Descriptor - Audio Streaming Operational */
+  0x09,                                 /* bLength */
+  USB_DESC_TYPE_INTERFACE,              /* bDescriptorType */
+  0x01,                                 /* bInterfaceNumber */
+  0x01,                                 /* bAlternateSetting */
+  0x02,                                 /* bNumEndpoints: data and feedback */
+  AUDIO2_CLASS_AUDIO,                   /* bInterfaceClass */
+  AUDIO2_SUBCLASS_AUDIOSTREAMING,       /* bInterfaceSubClass */
+  AUDIO2_IP_VERSION_02_00,              /* bInterfaceProtocol */
+  0x00,                                 /* iInterface */
+  /* 09 byte*/
+
+  /* USB Speaker Audio Streaming Interface Descriptor */
+  0x10,                                 /* bLength */
+  AUDIO2_CS_INTERFACE,                  /* bDescriptorType */
+  AUDIO2_AS_GENERAL,                    /* bDescriptorSubtype */
+  AUDIO2_INPUT_TERMINAL_ID,             /* bTerminalLink */
+  0x00,                                 /* bmControls */
+  AUDIO2_FORMAT_TYPE_I,                 /* bFormatType */
+  0x01,                                 /* bmFormats: PCM */
+  0x00,
+  0x00,
+  0x00,
+  USBD_AUDIO2_CHANNELS,                 /* bNrChannels */
+  AUDIO2_LE32(USBD_AUDIO2_CHANNEL_CONFIG),  /* bmChannelConfig */
+  0x00,                                 /* iChannelNames */
+  /* 16 byte*/
+
+  /* USB Speaker Audio Type I Format Interface Descriptor */
+  0x06,                                 /* bLength */
+  AUDIO2_CS_INTERFACE,                  /* bDescriptorType */
+  AUDIO2_AS_FORMAT_TYPE,                /* bDescriptorSubtype */
+  AUDIO2_FORMAT_TYPE_I,                 /* bFormatType */
+  AUDIO2_SUBSLOT_SIZE,                  /* bSubslotSize: 4 bytes per sample */
+  USBD_AUDIO2_RESOLUTION,               /* bBitResolution */
+  /* 06 byte*/
+
+  /* Endpoint 1 - Standard Descriptor */
+  0x07,                                 /* bLength */
+  USB_DESC_TYPE_ENDPOINT,               /* bDescriptorType */
+  AUDIO2_OUT_EP,                        /* bEndpointAddress */
+  0x05,                                 /* bmAttributes: Isochronous, asynchronous */
+  LOBYTE(AUDIO2_HS_MAX_PACKET),  /* wMaxPacketSize */
+  HIBYTE(AUDIO2_HS_MAX_PACKET),
+  0x01,                                 /* bInterval: every (micro)frame */
+  /* 07 byte*/
+
+  /* Endpoint - Audio Streaming Descriptor*/
+  0x08,                                 /* bLength */
+  AUDIO2_CS_ENDPOINT,                   /* bDescriptorType */
+  AUDIO2_EP_GENERAL,                    /* bDescriptor */
+  0x00,                                 /* bmAttributes */
+  0x00,                                 /* bmControls */
+  0x00,                                 /* bLockDelayUnits */
+  0x00,                                 /* wLockDelay */
+  0x00,
+  /* 08 byte*/
+
+  /* Feedback Endpoint - Standard Descriptor */
+  0x07,                                 /* bLength */
+  USB_DESC_TYPE_ENDPOINT,               /* bDescriptorType */
+  AUDIO2_FB_EP,                         /* bEndpointAddress */
+  0x11,                                 /* bmAttributes: Isochronous, feedback */
+  AUDIO2_HS_FB_PACKET,  /* wMaxPacketSize */
+  0x00,
+  AUDIO2_HS_FB_BINTERVAL,               /* bInterval */
+  /* 07 byte*/
+};
+
+/* USB AUDIO 2.0 device Configuration Descriptor */
+__ALIGN_BEGIN static uint8_t USBD_AUDIO2_CfgFSDesc[USB_AUDIO2_FS_CONFIG_DESC_SIZ] __ALIGN_END =
+{
+  /* Configuration 1 */
+  0x09,                                 /* bLength */
+  USB_DESC_TYPE_CONFIGURATION,   /* bDescriptorType */
+  LOBYTE(USB_AUDIO2_FS_CONFIG_DESC_SIZ),  /* wTotalLength */
+  HIBYTE(USB_AUDIO2_FS_CONFIG_DESC_SIZ),
+  0x02,                                 /* bNumInterfaces */
+  0x01,                                 /* bConfigurationValue */
+  0x00,                                 /* iConfiguration */
+  0xC0,                                 /* bmAttributes: self powered */
+  0x32,                                 /* MaxPower 100 mA */
+  /* 09 byte*/
+
+  /* Interface Association Descriptor */
+  0x08,                                 /* bLength */
+  0x0B,                                 /* bDescriptorType: IAD */
+  0x00,                                 /* bFirstInterface */
+  0x02,                                 /* bInterfaceCount */
+  AUDIO2_CLASS_AUDIO,                   /* bFunctionClass */
+  0x00,                                 /* bFunctionSubClass */
+  AUDIO2_IP_VERSION_02_00,              /* bFunctionProtocol */
+  0x00,                                 /* iFunction */
+  /* 08 byte*/
+
+  /* USB Speaker Standard AC Interface Descriptor */
+  0x09,                                 /* bLength */
+  USB_DESC_TYPE_INTERFACE,              /* bDescriptorType */
+  0x00,                                 /* bInterfaceNumber */
+  0x00,                                 /* bAlternateSetting */
+  0x00,                                 /* bNumEndpoints */
+  AUDIO2_CLASS_AUDIO,                   /* bInterfaceClass */
+  AUDIO2_SUBCLASS_AUDIOCONTROL,         /* bInterfaceSubClass */
+  AUDIO2_IP_VERSION_02_00,              /* bInterfaceProtocol */
+  0x00,                                 /* iInterface */
+  /* 09 byte*/
+
+  /* USB Speaker Class-specific AC Interface Descriptor */
+  0x09,                                 /* bLength */
+  AUDIO2_CS_INTERFACE,                  /* bDescriptorType */
+  AUDIO2_AC_HEADER,                     /* bDescriptorSubtype */
+  0x00,                                 /* bcdADC: 2.00 */
+  0x02,
+  AUDIO2_FUNCTION_PRO_AUDIO,            /* bCategory */
+  LOBYTE(AUDIO2_AC_DESC_SIZ),           /* wTotalLength */
+  HIBYTE(AUDIO2_AC_DESC_SIZ),
+  0x00,                                 /* bmControls */
+  /* 09 byte*/
+
+  /* USB Speaker Clock Source Descriptor */
+  0x08,                                 /* bLength */
+  AUDIO2_CS_INTERFACE,                  /* bDescriptorType */
+  AUDIO2_AC_CLOCK_SOURCE,               /* bDescriptorSubtype */
+  AUDIO2_CLOCK_ID,                      /* bClockID */
+  0x03,                                 /* bmAttributes: internal programmable clock */
+  0x07,                                 /* bmControls: frequency read/write, validity read */
+  0x00,                                 /* bAssocTerminal */
+  0x00,                                 /* iClockSource */
+  /* 08 byte*/
+
+  /* USB Speaker Input Terminal Descriptor */
+  0x11,                                 /* bLength */
+  AUDIO2_CS_INTERFACE,                  /* bDescriptorType */
+  AUDIO2_AC_INPUT_TERMINAL,             /* bDescriptorSubtype */
+  AUDIO2_INPUT_TERMINAL_ID,             /* bTerminalID */
+  0x01,                                 /* wTerminalType: USB streaming */
+  0x01,
+  0x00,                                 /* bAssocTerminal */
+  AUDIO2_CLOCK_ID,                      /* bCSourceID */
+  USBD_AUDIO2_CHANNELS,                 /* bNrChannels */
+  AUDIO2_LE32(USBD_AUDIO2_CHANNEL_CONFIG),  /* bmChannelConfig */
+  0x00,                                 /* iChannelNames */
+  0x00,                                 /* bmControls */
+  0x00,
+  0x00,                                 /* iTerminal */
+  /* 17 byte*/
+
+  /* USB Speaker Output Terminal Descriptor */
+  0x0C,                                 /* bLength */
+  AUDIO2_CS_INTERFACE,                  /* bDescriptorType */
+  AUDIO2_AC_OUTPUT_TERMINAL,            /* bDescriptorSubtype */
+  AUDIO2_OUTPUT_TERMINAL_ID,            /* bTerminalID */
+  0x01,                                 /* wTerminalType: speaker */
+  0x03,
+  0x00,                                 /* bAssocTerminal */
+  AUDIO2_INPUT_TERMINAL_ID,             /* bSourceID */
+  AUDIO2_CLOCK_ID,                      /* bCSourceID */
+  0x00,                                 /* bmControls */
+  0x00,
+  0x00,                                 /* iTerminal */
+  /* 12 byte*/
+
+  /* USB Speaker Standard AS Interface Descriptor - Audio Streaming Zero Bandwidth */
+  0x09,                                 /* bLength */
+  USB_DESC_TYPE_INTERFACE,              /* bDescriptorType */
+  0x01,                                 /* bInterfaceNumber */
+  0x00,                                 /* bAlternateSetting */
+  0x00,                                 /* bNumEndpoints */
+  AUDIO2_CLASS_AUDIO,                   /* bInterfaceClass */
+  AUDIO2_SUBCLASS_AUDIOSTREAMING,       /* bInterfaceSubClass */
+  AUDIO2_IP_VERSION_02_00,              /* bInterfaceProtocol */
+  0x00,                                 /* iInterface */
+  /* 09 byte*/
+
+#if (AUDIO2_FS_STREAMING == 1U)
+  /* USB Speaker Standard AS Interface Descriptor - Audio Streaming Operational */
+  0x09,                                 /* bLength */
+  USB_DESC_TYPE_INTERFACE,              /* bDescriptorType */
+  0x01,                                 /* bInterfaceNumber */
+  0x01,                                 /* bAlternateSetting */
+  0x02,                                 /* bNumEndpoints: data and feedback */
+  AUDIO2_CLASS_AUDIO,                   /* bInterfaceClass */
+  AUDIO2_SUBCLASS_AUDIOSTREAMING,       /* bInterfaceSubClass */
+  AUDIO2_IP_VERSION_02_00,              /* bInterfaceProtocol */
+  0x00,                                 /* iInterface */
+  /* 09 byte*/
+
+  /* USB Speaker Audio Streaming Interface Descriptor */
+  0x10,                                 /* bLength */
+  AUDIO2_CS_INTERFACE,                  /* bDescriptorType */
+  AUDIO2_AS_GENERAL,                    /* bDescriptorSubtype */
+  AUDIO2_INPUT_TERMINAL_ID,             /* bTerminalLink */
+  0x00,                                 /* bmControls */
+  AUDIO2_FORMAT_TYPE_I,                 /* bFormatType */
+  0x01,                                 /* bmFormats: PCM */
+  0x00,
+  0x00,
+  0x00,
+  USBD_AUDIO2_CHANNELS,                 /* bNrChannels */
+  AUDIO2_LE32(USBD_AUDIO2_CHANNEL_CONFIG),  /* bmChannelConfig */
+  0x00,                                 /* iChannelNames */
+  /* 16 byte*/
+
+  /* USB Speaker Audio Type I Format Interface Descriptor */
+  0x06,                                 /* bLength */
+  AUDIO2_CS_INTERFACE,                  /* bDescriptorType */
+  AUDIO2_AS_FORMAT_TYPE,                /* bDescriptorSubtype */
+  AUDIO2_FORMAT_TYPE_I,                 /* bFormatType */
+  AUDIO2_SUBSLOT_SIZE,                  /* bSubslotSize: 4 bytes per sample */
+  USBD_AUDIO2_RESOLUTION,               /* bBitResolution */
+  /* 06 byte*/
+
+  /* Endpoint 1 - Standard Descriptor */
+  0x07,                                 /* bLength */
+  USB_DESC_TYPE_ENDPOINT,               /* bDescriptorType */
+  AUDIO2_OUT_EP,                        /* bEndpointAddress */
+  0x05,                                 /* bmAttributes: Isochronous, asynchronous */
+  LOBYTE(AUDIO2_FS_MAX_PACKET),  /* wMaxPacketSize */
+  HIBYTE(AUDIO2_FS_MAX_PACKET),
+  0x01,                                 /* bInterval: every (micro)frame */
+  /* 07 byte*/
+
+  /* Endpoint - Audio Streaming Descriptor*/
+  0x08,                                 /* bLength */
+  AUDIO2_CS_ENDPOINT,                   /* bDescriptorType */
+  AUDIO2_EP_GENERAL,                    /* bDescriptor */
+  0x00,                                 /* bmAttributes */
+  0x00,                                 /* bmControls */
+  0x00,                                 /* bLockDelayUnits */
+  0x00,                                 /* wLockDelay */
+  0x00,
+  /* 08 byte*/
+
+  /* Feedback Endpoint - Standard Descriptor */
+  0x07,                                 /* bLength */
+  USB_DESC_TYPE_ENDPOINT,               /* bDescriptorType */
+  AUDIO2_FB_EP,                         /* bEndpointAddress */
+  0x11,                                 /* bmAttributes: Isochronous, feedback */
+  AUDIO2_FS_FB_PACKET,  /* wMaxPacketSize */
+  0x00,
+  AUDIO2_FS_FB_BINTERVAL,               /* bInterval */
+  /* 07 byte*/
+#endif /* AUDIO2_FS_STREAMING */
+};
+
+/* USB AUDIO 2.0 device Other Speed Configuration Descriptor */
+__ALIGN_BEGIN static uint8_t USBD_AUDIO2_OtherSpeedCfgDesc[USB_AUDIO2_FS_CONFIG_DESC_SIZ] __ALIGN_END =
+{
+  /* Configuration 1 */
+  0x09,                                 /* bLength */
+  USB_DESC_TYPE_OTHER_SPEED_CONFIGURATION,   /* bDescriptorType */
+  LOBYTE(USB_AUDIO2_FS_CONFIG_DESC_SIZ),  /* wTotalLength */
+  HIBYTE(USB_AUDIO2_FS_CONFIG_DESC_SIZ),
+  0x02,                                 /* bNumInterfaces */
+  0x01,                                 /* bConfigurationValue */
+  0x00,                                 /* iConfiguration */
+  0xC0,                                 /* bmAttributes: self powered */
+  0x32,                                 /* MaxPower 100 mA */
+  /* 09 byte*/
+
+  /* Interface Association Descriptor */
+  0x08,                                 /* bLength */
+  0x0B,                                 /* bDescriptorType: IAD */
+  0x00,                                 /* bFirstInterface */
+  0x02,                                 /* bInterfaceCount */
+  AUDIO2_CLASS_AUDIO,                   /* bFunctionClass */
+  0x00,                                 /* bFunctionSubClass */
+  AUDIO2_IP_VERSION_02_00,              /* bFunctionProtocol */
+  0x00,                                 /* iFunction */
+  /* 08 byte*/
+
+  /* USB Speaker Standard AC Interface Descriptor */
+  0x09,                                 /* bLength */
+  USB_DESC_TYPE_INTERFACE,              /* bDescriptorType */
+  0x00,                                 /* bInterfaceNumber */
+  0x00,                                 /* bAlternateSetting */
+  0x00,                                 /* bNumEndpoints */
+  AUDIO2_CLASS_AUDIO,                   /* bInterfaceClass */
+  AUDIO2_SUBCLASS_AUDIOCONTROL,         /* bInterfaceSubClass */
+  AUDIO2_IP_VERSION_02_00,              /* bInterfaceProtocol */
+  0x00,                                 /* iInterface */
+  /* 09 byte*/
+
+  /* USB Speaker Class-specific AC Interface Descriptor */
+  0x09,                                 /* bLength */
+  AUDIO2_CS_INTERFACE,                  /* bDescriptorType */
+  AUDIO2_AC_HEADER,                     /* bDescriptorSubtype */
+  0x00,                                 /* bcdADC: 2.00 */
+  0x02,
+  AUDIO2_FUNCTION_PRO_AUDIO,            /* bCategory */
+  LOBYTE(AUDIO2_AC_DESC_SIZ),           /* wTotalLength */
+  HIBYTE(AUDIO2_AC_DESC_SIZ),
+  0x00,                                 /* bmControls */
+  /* 09 byte*/
+
+  /* USB Speaker Clock Source Descriptor */
+  0x08,                                 /* bLength */
+  AUDIO2_CS_INTERFACE,                  /* bDescriptorType */
+  AUDIO2_AC_CLOCK_SOURCE,               /* bDescriptorSubtype */
+  AUDIO2_CLOCK_ID,                      /* bClockID */
+  0x03,                                 /* bmAttributes: internal programmable clock */
+  0x07,                                 /* bmControls: frequency read/write, validity read */
+  0x00,                                 /* bAssocTerminal */
+  0x00,                                 /* iClockSource */
+  /* 08 byte*/
+
+  /* USB Speaker Input Terminal Descriptor */
+  0x11,                                 /* bLength */
+  AUDIO2_CS_INTERFACE,                  /* bDescriptorType */
+  AUDIO2_AC_INPUT_TERMINAL,             /* bDescriptorSubtype */
+  AUDIO2_INPUT_TERMINAL_ID,             /* bTerminalID */
+  0x01,                                 /* wTerminalType: USB streaming */
+  0x01,
+  0x00,                                 /* bAssocTerminal */
+  AUDIO2_CLOCK_ID,                      /* bCSourceID */
+  USBD_AUDIO2_CHANNELS,                 /* bNrChannels */
+  AUDIO2_LE32(USBD_AUDIO2_CHANNEL_CONFIG),  /* bmChannelConfig */
+  0x00,                                 /* iChannelNames */
+  0x00,                                 /* bmControls */
+  0x00,
+  0x00,                                 /* iTerminal */
+  /* 17 byte*/
+
+  /* USB Speaker Output Terminal Descriptor */
+  0x0C,                                 /* bLength */
+  AUDIO2_CS_INTERFACE,                  /* bDescriptorType */
+  AUDIO2_AC_OUTPUT_TERMINAL,            /* bDescriptorSubtype */
+  AUDIO2_OUTPUT_TERMINAL_ID,            /* bTerminalID */
+  0x01,                                 /* wTerminalType: speaker */
+  0x03,
+  0x00,                                 /* bAssocTerminal */
+  AUDIO2_INPUT_TERMINAL_ID,             /* bSourceID */
+  AUDIO2_CLOCK_ID,                      /* bCSourceID */
+  0x00,                                 /* bmControls */
+  0x00,
+  0x00,                                 /* iTerminal */
+  /* 12 byte*/
+
+  /* USB Speaker Standard AS Interface Descriptor - Audio Streaming Zero Bandwidth */
+  0x09,                                 /* bLength */
+  USB_DESC_TYPE_INTERFACE,              /* bDescriptorType */
+  0x01,                                 /* bInterfaceNumber */
+  0x00,                                 /* bAlternateSetting */
+  0x00,                                 /* bNumEndpoints */
+  AUDIO2_CLASS_AUDIO,                   /* bInterfaceClass */
+  AUDIO2_SUBCLASS_AUDIOSTREAMING,       /* bInterfaceSubClass */
+  AUDIO2_IP_VERSION_02_00,              /* bInterfaceProtocol */
+  0x00,                                 /* iInterface */
+  /* 09 byte*/
+
+#if (AUDIO2_FS_STREAMING == 1U)
+  /* USB Speaker Standard AS Interface Descriptor - Audio Streaming Operational */
+  0x09,                                 /* bLength */
+  USB_DESC_TYPE_INTERFACE,              /* bDescriptorType */
+  0x01,                                 /* bInterfaceNumber */
+  0x01,                                 /* bAlternateSetting */
+  0x02,                                 /* bNumEndpoints: data and feedback */
+  AUDIO2_CLASS_AUDIO,                   /* bInterfaceClass */
+  AUDIO2_SUBCLASS_AUDIOSTREAMING,       /* bInterfaceSubClass */
+  AUDIO2_IP_VERSION_02_00,              /* bInterfaceProtocol */
+  0x00,                                 /* iInterface */
+  /* 09 byte*/
+
+  /* USB Speaker Audio Streaming Interface Descriptor */
+  0x10,                                 /* bLength */
+  AUDIO2_CS_INTERFACE,                  /* bDescriptorType */
+  AUDIO2_AS_GENERAL,                    /* bDescriptorSubtype */
+  AUDIO2_INPUT_TERMINAL_ID,             /* bTerminalLink */
+  0x00,                                 /* bmControls */
+  AUDIO2_FORMAT_TYPE_I,                 /* bFormatType */
+  0x01,                                 /* bmFormats: PCM */
+  0x00,
+  0x00,
+  0x00,
+  USBD_AUDIO2_CHANNELS,                 /* bNrChannels */
+  AUDIO2_LE32(USBD_AUDIO2_CHANNEL_CONFIG),  /* bmChannelConfig */
+  0x00,                                 /* iChannelNames */
+  /* 16 byte*/
+
+  /* USB Speaker Audio Type I Format Interface Descriptor */
+  0x06,                                 /* bLength */
+  AUDIO2_CS_INTERFACE,                  /* bDescriptorType */
+  AUDIO2_AS_FORMAT_TYPE,                /* bDescriptorSubtype */
+  AUDIO2_FORMAT_TYPE_I,                 /* bFormatType */
+  AUDIO2_SUBSLOT_SIZE,                  /* bSubslotSize: 4 bytes per sample */
+  USBD_AUDIO2_RESOLUTION,               /* bBitResolution */
+  /* 06 byte*/
+
+  /* Endpoint 1 - Standard Descriptor */
+  0x07,                                 /* bLength */
+  USB_DESC_TYPE_ENDPOINT,               /* bDescriptorType */
+  AUDIO2_OUT_EP,                        /* bEndpointAddress */
+  0x05,                                 /* bmAttributes: Isochronous, asynchronous */
+  LOBYTE(AUDIO2_FS_MAX_PACKET),  /* wMaxPacketSize */
+  HIBYTE(AUDIO2_FS_MAX_PACKET),
+  0x01,                                 /* bInterval: every (micro)frame */
+  /* 07 byte*/
+
+  /* Endpoint - Audio Streaming Descriptor*/
+  0x08,                                 /* bLength */
+  AUDIO2_CS_ENDPOINT,                   /* bDescriptorType */
+  AUDIO2_EP_GENERAL,                    /* bDescriptor */
+  0x00,                                 /* bmAttributes */
+  0x00,                                 /* bmControls */
+  0x00,                                 /* bLockDelayUnits */
+  0x00,                                 /* wLockDelay */
+  0x00,
+  /* 08 byte*/
+
+  /* Feedback Endpoint - Standard Descriptor */
+  0x07,                                 /* bLength */
+  USB_DESC_TYPE_ENDPOINT,               /* bDescriptorType */
+  AUDIO2_FB_EP,                         /* bEndpointAddress */
+  0x11,                                 /* bmAttributes: Isochronous, feedback */
+  AUDIO2_FS_FB_PACKET,  /* wMaxPacketSize */
+  0x00,
+  AUDIO2_FS_FB_BINTERVAL,               /* bInterval */
+  /* 07 byte*/
+#endif /* AUDIO2_FS_STREAMING */
+};
+
+/* Sampling frequencies of the clock source */
+static const uint32_t USBD_AUDIO2_Freq[] = { USBD_AUDIO2_FREQ_LIST };
+
+#define AUDIO2_FREQ_NBR             (sizeof (USBD_AUDIO2_Freq) / sizeof (USBD_AUDIO2_Freq[0]))
+
+/**
+  * @}
+  */
+
+/** @defgroup USBD_AUDIO2_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  USBD_AUDIO2_Init
+  *         Initialize the AUDIO 2.0 interface
+  * @note   The streaming endpoints are opened when the host selects the
+  *         operational setting of the streaming interface.
+  * @param  pdev: device instance
+  * @param  cfgidx: Configuration index
+  * @retval status
+  */
+static uint8_t  USBD_AUDIO2_Init (USBD_HandleTypeDef *pdev, uint8_t cfgidx)
+{
+  USBD_AUDIO2_HandleTypeDef   *haudio;
+
+  /* Allocate Audio structure */
+  pdev->pClassData = USBD_malloc(sizeof (USBD_AUDIO2_HandleTypeDef));
+
+  if(pdev->pClassData == NULL)
+  {
+    return USBD_FAIL;
+  }
+
+  haudio = (USBD_AUDIO2_HandleTypeDef*) pdev->pClassData;
+  haudio->CmdSelector = 0U;
+  haudio->alt_setting = 0U;
+  haudio->freq = USBD_AUDIO2_FREQ_DEFAULT;
+  haudio->max_packet = AUDIO2_IS_HS(pdev) ? AUDIO2_HS_MAX_PACKET : AUDIO2_FS_MAX_PACKET;
+  haudio->wr_ptr = 0U;
+  haudio->started = 0U;
+  haudio->packets = 0U;
+  haudio->xruns = 0U;
+  haudio->errors = 0U;
+  AUDIO2_FB_Update(pdev);
+
+  /* Initialize the Audio output Hardware layer */
+  if (((USBD_AUDIO2_ItfTypeDef *)pdev->pUserData)->Init(haudio->freq,
+                                                        USBD_AUDIO2_CHANNELS,
+                                                        0U) != 0)
+  {
+    return USBD_FAIL;
+  }
+
+  return USBD_OK;
+}
+
+/**
+  * @brief  USBD_AUDIO2_DeInit
+  *         DeInitialize the AUDIO 2.0 layer
+  * @param  pdev: device instance
+  * @param  cfgidx: Configuration index
+  * @retval status
+  */
+static uint8_t  USBD_AUDIO2_DeInit (USBD_HandleTypeDef *pdev, uint8_t cfgidx)
+{
+  /* Stop the stream and close its endpoints, then DeInit physical
+     Interface components */
+  if(pdev->pClassData != NULL)
+  {
+    USBD_AUDIO2_SetAlt(pdev, 0U);
+    ((USBD_AUDIO2_ItfTypeDef *)pdev->pUserData)->DeInit(0U);
+    USBD_free(pdev->pClassData);
+    pdev->pClassData = NULL;
+  }
+
+  return USBD_OK;
+}
+
+/**
+  * @brief  USBD_AUDIO2_Setup
+  *         Handle the AUDIO 2.0 specific requests
+  * @param  pdev: instance
+  * @param  req: usb requests
+  * @retval status
+  */
+static uint8_t  USBD_AUDIO2_Setup (USBD_HandleTypeDef *pdev,
+                                   USBD_SetupReqTypedef *req)
+{
+  USBD_AUDIO2_HandleTypeDef   *haudio = (USBD_AUDIO2_HandleTypeDef*) pdev->pClassData;
+  uint8_t *pbuf = (uint8_t *)(void *)haudio->data;
+  uint8_t alt_max;
+  uint16_t status_info = 0U;
+  uint8_t ret = USBD_OK;
+
+  switch (req->bmRequest & USB_REQ_TYPE_MASK)
+  {
+  case USB_REQ_TYPE_CLASS :
+    /* Only the clock source has controls */
+    if (HIBYTE(req->wIndex) == AUDIO2_CLOCK_ID)
+    {
+      USBD_AUDIO2_ClockRequest(pdev, req);
+    }
+    else
+    {
+      USBD_CtlError (pdev, req);
+      ret = USBD_FAIL;
+    }
+    break;
+
+  case USB_REQ_TYPE_STANDARD:
+    switch (req->bRequest)
+    {
+    case USB_REQ_GET_STATUS:
+      if (pdev->dev_state == USBD_STATE_CONFIGURED)
+      {
+        USBD_CtlSendData (pdev, (uint8_t *)(void *)&status_info, 2U);
+      }
+      else
+      {
+        USBD_CtlError (pdev, req);
+        ret = USBD_FAIL;
+      }
+      break;
+
+    case USB_REQ_GET_INTERFACE:
+      if (pdev->dev_state == USBD_STATE_CONFIGURED)
+      {
+        pbuf[0] = (LOBYTE(req->wIndex) == AUDIO2_AS_ITF) ? haudio->alt_setting : 0U;
+        USBD_CtlSendData (pdev, pbuf, 1U);
+      }
+      else
+      {
+        USBD_CtlError (pdev, req);
+        ret = USBD_FAIL;
+      }
+      break;
+
+    case USB_REQ_SET_INTERFACE:
+      /* The streaming interface has no operational setting at full speed
+         when the stream does not fit in a frame */
+      alt_max = (AUDIO2_IS_HS(pdev) || (AUDIO2_FS_STREAMING == 1U)) ? 1U : 0U;
+
+      if ((pdev->dev_state == USBD_STATE_CONFIGURED) && (LOBYTE(req->wIndex) == AUDIO2_AS_ITF) &&
+          (req->wValue <= alt_max))
+      {
+        USBD_AUDIO2_SetAlt(pdev, (uint8_t)req->wValue);
+      }
+      else if ((pdev->dev_state != USBD_STATE_CONFIGURED) || (req->wValue != 0U))
+      {
+        USBD_CtlError (pdev, req);
+        ret = USBD_FAIL;
+      }
+      break;
+
+    default:
+      USBD_CtlError (pdev, req);
+      ret = USBD_FAIL;
+      break;
+    }
+    break;
+
+  default:
+    USBD_CtlError (pdev, req);
+    ret = USBD_FAIL;
+    break;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  USBD_AUDIO2_ClockRequest
+  *         Handle the requests to the clock source: current and range of
+  *         the sampling frequency, validity of the clock.
+  * @param  pdev: instance
+  * @param  req: setup class request
+  * @retval None
+  */
+static void  USBD_AUDIO2_ClockRequest (USBD_HandleTypeDef *pdev,
+                                       USBD_SetupReqTypedef *req)
+{
+  USBD_AUDIO2_HandleTypeDef   *haudio = (USBD_AUDIO2_HandleTypeDef*) pdev->pClassData;
+  uint8_t *pbuf = (uint8_t *)(void *)haudio->data;
+  uint8_t selector = HIBYTE(req->wValue);
+  uint32_t count;
+  uint32_t i;
+
+  if ((req->bmRequest & 0x80U) != 0U)
+  {
+    if ((req->bRequest == AUDIO2_REQ_CUR) && (selector == AUDIO2_CS_SAM_FREQ_CONTROL))
+    {
+      USBD_AUDIO2_Put32(pbuf, haudio->freq);
+      USBD_CtlSendData (pdev, pbuf, MIN(req->wLength, 4U));
+    }
+    else if ((req->bRequest == AUDIO2_REQ_CUR) && (selector == AUDIO2_CS_CLOCK_VALID_CONTROL))
+    {
+      pbuf[0] = 1U;
+      USBD_CtlSendData (pdev, pbuf, MIN(req->wLength, 1U));
+    }
+    else if ((req->bRequest == AUDIO2_REQ_RANGE) && (selector == AUDIO2_CS_SAM_FREQ_CONTROL))
+    {
+      /* One sub-range without resolution per frequency */
+      count = MIN(AUDIO2_FREQ_NBR, (sizeof (haudio->data) - 2U) / 12U);
+      USBD_AUDIO2_Put16(pbuf, count);
+      for (i = 0U; i < count; i++)
+      {
+        USBD_AUDIO2_Put32(&pbuf[2U + (12U * i)], USBD_AUDIO2_Freq[i]);
+        USBD_AUDIO2_Put32(&pbuf[6U + (12U * i)], USBD_AUDIO2_Freq[i]);
+        USBD_AUDIO2_Put32(&pbuf[10U + (12U * i)], 0U);
+      }
+      USBD_CtlSendData (pdev, pbuf, MIN(req->wLength, 2U + (12U * count)));
+    }
+    else
+    {
+      USBD_CtlError (pdev, req);
+    }
+  }
+  else if ((req->bRequest == AUDIO2_REQ_CUR) && (selector == AUDIO2_CS_SAM_FREQ_CONTROL) &&
+           (req->wLength == 4U))
+  {
+    /* The new frequency is applied on EP0 Rx Ready */
+    haudio->CmdSelector = selector;
+
+    USBD_CtlPrepareRx (pdev, pbuf, req->wLength);
+  }
+  else
+  {
+    USBD_CtlError (pdev, req);
+  }
+}
+
+/**
+  * @brief  USBD_AUDIO2_EP0_RxReady
+  *         Handle the sampling frequency selected by the host
+  * @param  pdev: device instance
+  * @retval status
+  */
+static uint8_t  USBD_AUDIO2_EP0_RxReady (USBD_HandleTypeDef *pdev)
+{
+  USBD_AUDIO2_HandleTypeDef   *haudio = (USBD_AUDIO2_HandleTypeDef*) pdev->pClassData;
+  USBD_AUDIO2_ItfTypeDef      *itf = (USBD_AUDIO2_ItfTypeDef *)pdev->pUserData;
+  uint8_t *pbuf = (uint8_t *)(void *)haudio->data;
+  uint32_t freq;
+  uint32_t i;
+
+  if ((haudio != NULL) && (haudio->CmdSelector == AUDIO2_CS_SAM_FREQ_CONTROL))
+  {
+    freq = (uint32_t)pbuf[0] | ((uint32_t)pbuf[1] << 8) |
+           ((uint32_t)pbuf[2] << 16) | ((uint32_t)pbuf[3] << 24);
+
+    /* Frequencies out of the list are ignored */
+    for (i = 0U; i < AUDIO2_FREQ_NBR; i++)
+    {
+      if ((USBD_AUDIO2_Freq[i] == freq) && (freq != haudio->freq))
+      {
+        haudio->freq = freq;
+        AUDIO2_FB_Update(pdev);
+
+        if (itf->SetFreq != NULL)
+        {
+          itf->SetFreq(freq);
+        }
+      }
+    }
+
+    haudio->CmdSelector = 0U;
+  }
+
+  return USBD_OK;
+}
+
+/**
+  * @brief  USBD_AUDIO2_DataIn
+  *         Data sent on the feedback endpoint
+  * @param  pdev: device instance
+  * @param  epnum: endpoint number
+  * @retval status
+  */
+static uint8_t  USBD_AUDIO2_DataIn (USBD_HandleTypeDef *pdev, uint8_t epnum)
+{
+  USBD_AUDIO2_HandleTypeDef   *haudio = (USBD_AUDIO2_HandleTypeDef*) pdev->pClassData;
+
+  if (((epnum | 0x80U) == AUDIO2_FB_EP) && (haudio != NULL) && (haudio->alt_setting == 1U))
+  {
+    /* Feedback value read by the host: queue the next one */
+    AUDIO2_FB_Transmit(pdev);
+  }
+
+  return USBD_OK;
+}
+
+/**
+  * @brief  USBD_AUDIO2_IsoINIncomplete
+  *         handle data ISO IN Incomplete event
+  * @param  pdev: device instance
+  * @param  epnum: endpoint index
+  * @retval status
+  */
+static uint8_t  USBD_AUDIO2_IsoINIncomplete (USBD_HandleTypeDef *pdev, uint8_t epnum)
+{
+  USBD_AUDIO2_HandleTypeDef   *haudio = (USBD_AUDIO2_HandleTypeDef*) pdev->pClassData;
+
+  /* A feedback value not read in its (micro)frame is flushed and queued
+     again */
+  if ((haudio != NULL) && (haudio->alt_setting == 1U))
+  {
+    USBD_LL_FlushEP(pdev, AUDIO2_FB_EP);
+    AUDIO2_FB_Transmit(pdev);
+  }
+
+  return USBD_OK;
+}
+
+/**
+  * @brief  USBD_AUDIO2_DataOut
+  *         Packet received in the ring: the next one is received right after
+  *         it, so the frames are never copied but for the part of a packet
+  *         received past the end of the ring.
+  * @param  pdev: device instance
+  * @param  epnum: endpoint number
+  * @retval status
+  */
+static uint8_t  USBD_AUDIO2_DataOut (USBD_HandleTypeDef *pdev, uint8_t epnum)
+{
+  USBD_AUDIO2_HandleTypeDef   *haudio = (USBD_AUDIO2_HandleTypeDef*) pdev->pClassData;
+  uint8_t *ring;
+  uint32_t count;
+  uint32_t level;
+
+  if ((epnum != AUDIO2_OUT_EP) || (haudio == NULL) || (haudio->alt_setting != 1U))
+  {
+    return USBD_OK;
+  }
+
+  ring = (uint8_t *)(void *)haudio->ring;
+  count = MIN(USBD_LL_GetRxDataSize(pdev, epnum), haudio->max_packet);
+
+  /* Whole frames only, the channels would be shifted otherwise */
+  if ((count % AUDIO2_FRAME_SIZE) != 0U)
+  {
+    haudio->errors++;
+    count -= count % AUDIO2_FRAME_SIZE;
+  }
+  haudio->packets++;
+
+  if ((haudio->wr_ptr + count) > AUDIO2_RING_SIZE)
+  {
+    USBD_memcpy(ring, &ring[AUDIO2_RING_SIZE], haudio->wr_ptr + count - AUDIO2_RING_SIZE);
+  }
+  haudio->wr_ptr = (haudio->wr_ptr + count) % AUDIO2_RING_SIZE;
+
+  if (haudio->started == 0U)
+  {
+    /* Start the audio DMA on the ring once half of it is filled: the
+       feedback endpoint then holds the fill level around this point */
+    if (haudio->wr_ptr >= (AUDIO2_RING_SIZE / 2U))
+    {
+      haudio->started = 1U;
+      haudio->fb_level = 0U;
+      haudio->fb_packets = 0U;
+      ((USBD_AUDIO2_ItfTypeDef *)pdev->pUserData)->AudioCmd(ring, AUDIO2_RING_SIZE,
+                                                            AUDIO2_CMD_START);
+    }
+  }
+  else
+  {
+    /* Playback running: average the fill level over one refresh period */
+    level = AUDIO2_FB_GetLevel(pdev);
+    if ((level < haudio->max_packet) || (level > (AUDIO2_RING_SIZE - haudio->max_packet)))
+    {
+      haudio->xruns++;
+    }
+
+    haudio->fb_level += level;
+    haudio->fb_packets++;
+    if (haudio->fb_packets == (1UL << AUDIO2_FB_REFRESH))
+    {
+      AUDIO2_FB_Update(pdev);
+    }
+  }
+
+  /* Prepare Out endpoint to receive next audio packet */
+  USBD_LL_PrepareReceive(pdev, AUDIO2_OUT_EP, &ring[haudio->wr_ptr],
+                         haudio->max_packet);
+
+  return USBD_OK;
+}
+
+/**
+  * @brief  USBD_AUDIO2_GetFSCfgDesc
+  *         Return configuration descriptor
+  * @param  speed : current device speed
+  * @param  length : pointer data length
+  * @retval pointer to descriptor buffer
+  */
+static uint8_t  *USBD_AUDIO2_GetFSCfgDesc (uint16_t *length)
+{
+  *length = sizeof (USBD_AUDIO2_CfgFSDesc);
+  return USBD_AUDIO2_CfgFSDesc;
+}
+
+/**
+  * @brief  USBD_AUDIO2_GetHSCfgDesc
+  *         Return configuration descriptor
+  * @param  speed : current device speed
+  * @param  length : pointer data length
+  * @retval pointer to descriptor buffer
+  */
+static uint8_t  *USBD_AUDIO2_GetHSCfgDesc (uint16_t *length)
+{
+  *length = sizeof (USBD_AUDIO2_CfgHSDesc);
+  return USBD_AUDIO2_CfgHSDesc;
+}
+
+/**
+  * @brief  USBD_AUDIO2_GetOtherSpeedCfgDesc
+  *         Return configuration descriptor
+  * @param  speed : current device speed
+  * @param  length : pointer data length
+  * @retval pointer to descriptor buffer
+  */
+static uint8_t  *USBD_AUDIO2_GetOtherSpeedCfgDesc (uint16_t *length)
+{
+  *length = sizeof (USBD_AUDIO2_OtherSpeedCfgDesc);
+  return USBD_AUDIO2_OtherSpeedCfgDesc;
+}
+
+/**
+* @brief  DeviceQualifierDescriptor
+*         return Device Qualifier descriptor
+* @param  length : pointer data length
+* @retval pointer to descriptor buffer
+*/
+uint8_t  *USBD_AUDIO2_GetDeviceQualifierDescriptor (uint16_t *length)
+{
+  *length = sizeof (USBD_AUDIO2_DeviceQualifierDesc);
+  return USBD_AUDIO2_DeviceQualifierDesc;
+}
+
+/**
+  * @brief  USBD_AUDIO2_SetAlt
+  *         Select the setting of the streaming interface: the endpoints are
+  *         closed and the audio DMA stopped in the zero bandwidth setting,
+  *         the ring is filled again from its start in the operational one.
+  * @param  pdev: device instance
+  * @param  alt: alternate setting
+  * @retval None
+  */
+static void  USBD_AUDIO2_SetAlt (USBD_HandleTypeDef *pdev, uint8_t alt)
+{
+  USBD_AUDIO2_HandleTypeDef   *haudio = (USBD_AUDIO2_HandleTypeDef*) pdev->pClassData;
+
+  if (haudio->alt_setting != 0U)
+  {
+    USBD_LL_CloseEP(pdev, AUDIO2_OUT_EP);
+    pdev->ep_out[AUDIO2_OUT_EP & 0xFU].is_used = 0U;
+    USBD_LL_CloseEP(pdev, AUDIO2_FB_EP);
+    pdev->ep_in[AUDIO2_FB_EP & 0xFU].is_used = 0U;
+
+    if (haudio->started != 0U)
+    {
+      haudio->started = 0U;
+      ((USBD_AUDIO2_ItfTypeDef *)pdev->pUserData)->AudioCmd((uint8_t *)(void *)haudio->ring,
+                                                            0U, AUDIO2_CMD_STOP);
+    }
+  }
+
+  haudio->alt_setting = alt;
+
+  if (alt != 0U)
+  {
+    haudio->max_packet = AUDIO2_IS_HS(pdev) ? AUDIO2_HS_MAX_PACKET : AUDIO2_FS_MAX_PACKET;
+    haudio->wr_ptr = 0U;
+    AUDIO2_FB_Update(pdev);
+
+    USBD_LL_OpenEP(pdev, AUDIO2_OUT_EP, USBD_EP_TYPE_ISOC, (uint16_t)haudio->max_packet);
+    pdev->ep_out[AUDIO2_OUT_EP & 0xFU].is_used = 1U;
+    USBD_LL_OpenEP(pdev, AUDIO2_FB_EP, USBD_EP_TYPE_ISOC,
+                   AUDIO2_IS_HS(pdev) ? AUDIO2_HS_FB_PACKET : AUDIO2_FS_FB_PACKET);
+    pdev->ep_in[AUDIO2_FB_EP & 0xFU].is_used = 1U;
+
+    /* Prepare Out endpoint to receive 1st packet and queue the first
+       feedback value */
+    USBD_LL_PrepareReceive(pdev, AUDIO2_OUT_EP, (uint8_t *)(void *)haudio->ring,
+                           haudio->max_packet);
+    USBD_LL_FlushEP(pdev, AUDIO2_FB_EP);
+    AUDIO2_FB_Transmit(pdev);
+  }
+}
+
+/**
+  * @brief  AUDIO2_FB_GetLevel
+  *         Return the number of bytes queued ahead of the audio DMA.
+  * @note   Without GetPlayPos the level is reported at the set point: the
+  *         feedback stays at the nominal rate.
+  * @param  pdev: instance
+  * @retval fill level in bytes
+  */
+static uint32_t AUDIO2_FB_GetLevel (USBD_HandleTypeDef *pdev)
+{
+  USBD_AUDIO2_HandleTypeDef   *haudio = (USBD_AUDIO2_HandleTypeDef*) pdev->pClassData;
+  USBD_AUDIO2_ItfTypeDef      *itf = (USBD_AUDIO2_ItfTypeDef *)pdev->pUserData;
+  uint32_t rd_pos;
+
+  if ((itf->GetPlayPos == NULL) || (itf->GetPlayPos(&rd_pos) != 0))
+  {
+    return AUDIO2_RING_SIZE / 2U;
+  }
+
+  rd_pos %= AUDIO2_RING_SIZE;
+
+  return (haudio->wr_ptr + AUDIO2_RING_SIZE - rd_pos) % AUDIO2_RING_SIZE;
+}
+
+/**
+  * @brief  AUDIO2_FB_Update
+  *         Compute the feedback value from the averaged fill level: the
+  *         host is asked for more frames when the ring drains below half
+  *         and for fewer when it fills above.
+  * @param  pdev: instance
+  * @retval None
+  */
+static void AUDIO2_FB_Update (USBD_HandleTypeDef *pdev)
+{
+  USBD_AUDIO2_HandleTypeDef   *haudio = (USBD_AUDIO2_HandleTypeDef*) pdev->pClassData;
+  uint32_t shift = AUDIO2_IS_HS(pdev) ? 16U : 14U;
+  int32_t limit;
+  int32_t error = 0;
+
+  /* Frames per microframe in 16.16 format at high speed, per frame in
+     10.14 format at full speed */
+  haudio->fb_nominal = (uint32_t)(((uint64_t)haudio->freq << shift) /
+                                  (AUDIO2_IS_HS(pdev) ? 8000U : 1000U));
+
+  if (haudio->fb_packets != 0U)
+  {
+    /* Distance to the half-ring set point, in frames of the value format */
+    error = (int32_t)((((int64_t)(AUDIO2_RING_SIZE / 2U) -
+                        (int64_t)(haudio->fb_level >> AUDIO2_FB_REFRESH)) * ((int64_t)1 << shift)) /
+                      ((int64_t)AUDIO2_FRAME_SIZE << AUDIO2_FB_GAIN));
+
+    limit = (int32_t)(haudio->fb_nominal >> AUDIO2_FB_MAX_SHIFT);
+    if (error > limit)
+    {
+      error = limit;
+    }
+    else if (error < -limit)
+    {
+      error = -limit;
+    }
+  }
+
+  haudio->fb_value = (uint32_t)((int32_t)haudio->fb_nominal + error);
+  haudio->fb_level = 0U;
+  haudio->fb_packets = 0U;
+
+  /* Little endian, on 4 bytes at high speed and 3 bytes at full speed */
+  USBD_AUDIO2_Put32(haudio->fb_data, haudio->fb_value);
+}
+
+/**
+  * @brief  AUDIO2_FB_Transmit
+  *         Queue the current feedback value on the feedback endpoint.
+  * @param  pdev: instance
+  * @retval None
+  */
+static void AUDIO2_FB_Transmit (USBD_HandleTypeDef *pdev)
+{
+  USBD_AUDIO2_HandleTypeDef   *haudio = (USBD_AUDIO2_HandleTypeDef*) pdev->pClassData;
+
+  USBD_LL_Transmit(pdev, AUDIO2_FB_EP, haudio->fb_data,
+                   AUDIO2_IS_HS(pdev) ? AUDIO2_HS_FB_PACKET : AUDIO2_FS_FB_PACKET);
+}
+
+/**
+  * @brief  USBD_AUDIO2_Put16
+  *         Store a 16-bit value in little endian order
+  * @param  pbuf: destination
+  * @param  value: value stored
+  * @retval None
+  */
+static void  USBD_AUDIO2_Put16 (uint8_t *pbuf, uint32_t value)
+{
+  pbuf[0] = (uint8_t)value;
+  pbuf[1] = (uint8_t)(value >> 8);
+}
+
+/**
+  * @brief  USBD_AUDIO2_Put32
+  *         Store a 32-bit value in little endian order
+  * @param  pbuf: destination
+  * @param  value: value stored
+  * @retval None
+  */
+static void  USBD_AUDIO2_Put32 (uint8_t *pbuf, uint32_t value)
+{
+  pbuf[0] = (uint8_t)value;
+  pbuf[1] = (uint8_t)(value >> 8);
+  pbuf[2] = (uint8_t)(value >> 16);
+  pbuf[3] = (uint8_t)(value >> 24);
+}
+
+/**
+* @brief  USBD_AUDIO2_RegisterInterface
+* @param  fops: Audio interface callback
+* @retval status
+*/
+uint8_t  USBD_AUDIO2_RegisterInterface  (USBD_HandleTypeDef   *pdev,
+                                         USBD_AUDIO2_ItfTypeDef *fops)
+{
+  if(fops != NULL)
+  {
+    pdev->pUserData= fops;
+  }
+  return USBD_OK;
+}
+/**
+  * @}
+  */
+
+
+/**
+  * @}
+  */
+
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,198 @@
+/**
+  ******************************************************************************
+  * @file    usbd_audio2_if_template.c
+  * @author  MCD Application Team
+  * @brief   Generic media access Layer.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics International N.V.
+  * All rights reserved.</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without
+  * modification, are permitted, provided that the following conditions are met:
+  *
+  * 1. Redistribution of source code must retain the above copyright notice,
+  *    this list of conditions and the following disclaimer.
+  * 2. Redistributions in binary form must reproduce the above copyright notice,
+  *    this list of conditions and the following disclaimer in the documentation
+  *    and/or other materials provided with the distribution.
+  * 3. Neither the name of STMicroelectronics nor the names of other
+  *    contributors to this software may be used to endorse or promote products
+  *    derived from this software without specific written permission.
+  * 4. This software, including modifications and/or derivative works of this
+  *    software, must execute solely and exclusively on microcontroller or
+  *    microprocessor devices manufactured by or for STMicroelectronics.
+  * 5. Redistribution and use of this software other than as permitted under
+  *    this license is void and will automatically terminate your rights under
+  *    this license.
+  *
+  * THIS SOFTWARE IS PROVIDED BY STMICROELECTRONICS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS, IMPLIED OR STATUTORY WARRANTIES, INCLUDING, BUT NOT
+  * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+  * PARTICULAR PURPOSE AND NON-INFRINGEMENT OF THIRD PARTY INTELLECTUAL PROPERTY
+  * RIGHTS ARE DISCLAIMED TO THE FULLEST EXTENT PERMITTED BY LAW. IN NO EVENT
+  * SHALL STMICROELECTRONICS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+  * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+  * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+  /* BSPDependencies
+  - "stm32xxxxx_{eval}{discovery}.c"
+  - "stm32xxxxx_{eval}{discovery}_io.c"
+  - "stm32xxxxx_{eval}{discovery}_audio.c"
+  EndBSPDependencies */
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbd_audio2_if_template.h"
+
+/** @addtogroup STM32_USB_DEVICE_LIBRARY
+  * @{
+  */
+
+
+/** @defgroup USBD_AUDIO2
+  * @brief usbd core module
+  * @{
+  */
+
+/** @defgroup USBD_AUDIO2_Private_TypesDefinitions
+  * @{
+  */
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_AUDIO2_Private_Defines
+  * @{
+  */
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_AUDIO2_Private_Macros
+  * @{
+  */
+
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_AUDIO2_Private_FunctionPrototypes
+  * @{
+  */
+
+static int8_t  TEMPLATE_Init         (uint32_t AudioFreq, uint32_t Channels, uint32_t options);
+static int8_t  TEMPLATE_DeInit       (uint32_t options);
+static int8_t  TEMPLATE_AudioCmd     (uint8_t* pbuf, uint32_t size, uint8_t cmd);
+static int8_t  TEMPLATE_SetFreq      (uint32_t AudioFreq);
+static int8_t  TEMPLATE_GetPlayPos   (uint32_t *pPos);
+
+USBD_AUDIO2_ItfTypeDef USBD_AUDIO2_Template_fops =
+{
+  TEMPLATE_Init,
+  TEMPLATE_DeInit,
+  TEMPLATE_AudioCmd,
+  TEMPLATE_SetFreq,
+  TEMPLATE_GetPlayPos,
+};
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  TEMPLATE_Init
+  *         Initializes the AUDIO media low layer: a SAI block in TDM with
+  *         Channels slots of 32 bits per frame and 32-bit data, since the
+  *         samples are MSB aligned in their subslots, and a circular DMA
+  *         stream of words.
+  * @param  AudioFreq: sampling frequency in Hz
+  * @param  Channels: slots per frame
+  * @param  options: Reserved for future use
+  * @retval Result of the operation: USBD_OK if all operations are OK else USBD_FAIL
+  */
+static int8_t TEMPLATE_Init(uint32_t AudioFreq, uint32_t Channels, uint32_t options)
+{
+  /*
+     Add your initialization code here
+  */
+  return (0);
+}
+
+/**
+  * @brief  TEMPLATE_DeInit
+  *         DeInitializes the AUDIO media low layer
+  * @param  options: Reserved for future use
+  * @retval Result of the operation: USBD_OK if all operations are OK else USBD_FAIL
+  */
+static int8_t TEMPLATE_DeInit(uint32_t options)
+{
+  /*
+     Add your deinitialization code here
+  */
+  return (0);
+}
+
+
+/**
+  * @brief  TEMPLATE_AudioCmd
+  *         AUDIO command handler: AUDIO2_CMD_START gives the ring of
+  *         interleaved frames, to be played in place by the circular DMA
+  *         (HAL_SAI_Transmit_DMA() with size / 4 words); AUDIO2_CMD_STOP
+  *         stops it.
+  * @param  pbuf: Ring of interleaved frames
+  * @param  size: Size of the ring (in bytes)
+  * @param  cmd: command opcode
+  * @retval Result of the operation: USBD_OK if all operations are OK else USBD_FAIL
+  */
+static int8_t TEMPLATE_AudioCmd (uint8_t* pbuf, uint32_t size, uint8_t cmd)
+{
+
+  return (0);
+}
+
+/**
+  * @brief  TEMPLATE_SetFreq
+  *         Sampling frequency selected by the host: reprogram the audio clock
+  * @param  AudioFreq: sampling frequency in Hz
+  * @retval Result of the operation: USBD_OK if all operations are OK else USBD_FAIL
+  */
+static int8_t TEMPLATE_SetFreq (uint32_t AudioFreq)
+{
+
+  return (0);
+}
+
+/**
+  * @brief  TEMPLATE_GetPlayPos
+  *         Byte offset in the ring of the next word read by the DMA, from
+  *         its counter: size - (__HAL_DMA_GET_COUNTER() * 4)
+  * @param  pPos: offset returned
+  * @retval Result of the operation: USBD_OK if all operations are OK else USBD_FAIL
+  */
+static int8_t TEMPLATE_GetPlayPos (uint32_t *pPos)
+{
+  *pPos = 0U;
+  return (0);
+}
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
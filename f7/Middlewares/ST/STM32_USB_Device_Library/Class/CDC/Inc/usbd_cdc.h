@@ -67,9 +67,15 @@
 /** @defgroup usbd_cdc_Exported_Defines
   * @{
   */
+#ifndef CDC_IN_EP
 #define CDC_IN_EP                                   0x81U  /* EP1 for data IN */
+#endif /* CDC_IN_EP */
+#ifndef CDC_OUT_EP
 #define CDC_OUT_EP                                  0x01U  /* EP1 for data OUT */
+#endif /* CDC_OUT_EP */
+#ifndef CDC_CMD_EP
 #define CDC_CMD_EP                                  0x82U  /* EP2 for CDC commands */
+#endif /* CDC_CMD_EP */
 
 #ifndef CDC_HS_BINTERVAL
   #define CDC_HS_BINTERVAL                          0x10U
@@ -130,6 +136,8 @@ typedef struct _USBD_CDC_Itf
   int8_t (* DeInit)        (void);
   int8_t (* Control)       (uint8_t cmd, uint8_t* pbuf, uint16_t length);
   int8_t (* Receive)       (uint8_t* Buf, uint32_t *Len);
+  int8_t (* TxReady)       (uint32_t Space);   /* Stream mode, may be NULL */
+  int8_t (* RxReady)       (uint32_t Count);   /* Stream mode, may be NULL */
 
 }USBD_CDC_ItfTypeDef;
 
@@ -146,6 +154,19 @@ typedef struct
 
   __IO uint32_t TxState;
   __IO uint32_t RxState;
+
+  /* Stream mode: single producer / single consumer rings, the indexes run
+     freely and are masked with (Size - 1U) */
+  uint8_t  *TxRing;
+  uint32_t TxRingSize;
+  __IO uint32_t TxHead;                                 /* Written by the application */
+  __IO uint32_t TxTail;                                 /* Written by the USB interrupt */
+  __IO uint32_t TxBlocked;
+  uint8_t  *RxRing;
+  uint32_t RxRingSize;
+  __IO uint32_t RxHead;                                 /* Written by the USB interrupt */
+  __IO uint32_t RxTail;                                 /* Written by the application */
+  uint32_t RxPacket[CDC_DATA_HS_MAX_PACKET_SIZE / 4U];  /* OUT transfer buffer */
 }
 USBD_CDC_HandleTypeDef;
 
@@ -185,6 +206,20 @@ uint8_t  USBD_CDC_SetRxBuffer        (USBD_HandleTypeDef   *pdev,
 uint8_t  USBD_CDC_ReceivePacket      (USBD_HandleTypeDef *pdev);
 
 uint8_t  USBD_CDC_TransmitPacket     (USBD_HandleTypeDef *pdev);
+
+uint8_t  USBD_CDC_StreamInit         (USBD_HandleTypeDef *pdev,
+                                      uint8_t *pTxRing, uint32_t TxSize,
+                                      uint8_t *pRxRing, uint32_t RxSize);
+
+uint32_t USBD_CDC_StreamWrite        (USBD_HandleTypeDef *pdev,
+                                      const uint8_t *pbuff, uint32_t length);
+
+uint32_t USBD_CDC_StreamRead         (USBD_HandleTypeDef *pdev,
+                                      uint8_t *pbuff, uint32_t length);
+
+uint32_t USBD_CDC_StreamGetTxFree    (USBD_HandleTypeDef *pdev);
+
+uint32_t USBD_CDC_StreamGetRxCount   (USBD_HandleTypeDef *pdev);
 /**
   * @}
   */
@@ -26,6 +26,22 @@
   *             - Abstract Control Model compliant
   *             - Union Functional collection (using 1 IN endpoint for control)
   *             - Data interface class
+  *             - Optional stream mode: TX and RX rings managed by the class
+  *
+  *           Stream mode:
+  *             Call USBD_CDC_StreamInit() from the interface Init() callback with
+  *             two rings whose sizes are powers of two, the RX ring holding at
+  *             least two packets. USBD_CDC_StreamWrite() then only copies into
+  *             the TX ring: everything written while a transfer is in flight is
+  *             sent as one transfer of full packets once it completes, and the
+  *             ZLP is only sent when the ring is empty. OUT packets are copied
+  *             into the RX ring; when it cannot hold one more packet the OUT
+  *             endpoint is no longer armed, so the host is NAKed until
+  *             USBD_CDC_StreamRead() frees room. The optional TxReady() and
+  *             RxReady() interface callbacks report room in the TX ring after a
+  *             short write, and new data in the RX ring.
+  *             The rings are lock-free with one writer and one reader; the
+  *             application side must not preempt the USB interrupt.
   *
   *           These aspects may be enriched or modified for a specific user application.
   *
@@ -107,6 +123,10 @@
 /** @defgroup USBD_CDC_Private_Defines
   * @{
   */
+#ifndef USBD_memcpy
+#include <string.h>
+#define USBD_memcpy                 memcpy
+#endif /* USBD_memcpy */
 /**
   * @}
   */
@@ -115,6 +135,8 @@
 /** @defgroup USBD_CDC_Private_Macros
   * @{
   */
+#define CDC_DATA_MAX_PACKET_SIZE(__PDEV__)  (((__PDEV__)->dev_speed == USBD_SPEED_HIGH) ? \
+                                             CDC_DATA_HS_MAX_PACKET_SIZE : CDC_DATA_FS_MAX_PACKET_SIZE)
 
 /**
   * @}
@@ -138,6 +160,10 @@ static uint8_t  USBD_CDC_Setup (USBD_HandleTypeDef *pdev,
 static uint8_t  USBD_CDC_DataIn (USBD_HandleTypeDef *pdev,
                                  uint8_t epnum);
 
+static void     USBD_CDC_StreamTransmit (USBD_HandleTypeDef *pdev);
+
+static void     USBD_CDC_StreamReceive (USBD_HandleTypeDef *pdev);
+
 static uint8_t  USBD_CDC_DataOut (USBD_HandleTypeDef *pdev,
                                  uint8_t epnum);
 
@@ -542,6 +568,10 @@ static uint8_t  USBD_CDC_Init (USBD_HandleTypeDef *pdev, uint8_t cfgidx)
   {
     hcdc = (USBD_CDC_HandleTypeDef*) pdev->pClassData;
 
+    /* Stream mode is enabled by the interface Init() if needed */
+    hcdc->TxRing = NULL;
+    hcdc->RxRing = NULL;
+
     /* Init  physical Interface components */
     ((USBD_CDC_ItfTypeDef *)pdev->pUserData)->Init();
 
@@ -707,7 +737,19 @@ static uint8_t  USBD_CDC_DataIn (USBD_HandleTypeDef *pdev, uint8_t epnum)
 
   if(pdev->pClassData != NULL)
   {
-    if((pdev->ep_in[epnum].total_length > 0U) && ((pdev->ep_in[epnum].total_length % hpcd->IN_ep[epnum].maxpacket) == 0U))
+    if(hcdc->TxRing != NULL)
+    {
+      /* Release the data sent */
+      hcdc->TxTail += hcdc->TxLength;
+      hcdc->TxLength = 0U;
+    }
+
+    if((hcdc->TxRing != NULL) && (hcdc->TxHead != hcdc->TxTail))
+    {
+      /* More data to send: no ZLP needed, the next transfer follows */
+      USBD_CDC_StreamTransmit(pdev);
+    }
+    else if((pdev->ep_in[epnum].total_length > 0U) && ((pdev->ep_in[epnum].total_length % hpcd->IN_ep[epnum].maxpacket) == 0U))
     {
       /* Update the packet total length */
       pdev->ep_in[epnum].total_length = 0U;
@@ -719,6 +761,15 @@ static uint8_t  USBD_CDC_DataIn (USBD_HandleTypeDef *pdev, uint8_t epnum)
     {
       hcdc->TxState = 0U;
     }
+
+    if((hcdc->TxRing != NULL) && (hcdc->TxBlocked != 0U))
+    {
+      hcdc->TxBlocked = 0U;
+      if(((USBD_CDC_ItfTypeDef *)pdev->pUserData)->TxReady != NULL)
+      {
+        ((USBD_CDC_ItfTypeDef *)pdev->pUserData)->TxReady(USBD_CDC_StreamGetTxFree(pdev));
+      }
+    }
     return USBD_OK;
   }
   else
@@ -745,7 +796,27 @@ static uint8_t  USBD_CDC_DataOut (USBD_HandleTypeDef *pdev, uint8_t epnum)
   NAKed till the end of the application Xfer */
   if(pdev->pClassData != NULL)
   {
-    ((USBD_CDC_ItfTypeDef *)pdev->pUserData)->Receive(hcdc->RxBuffer, &hcdc->RxLength);
+    if(hcdc->RxRing != NULL)
+    {
+      /* The ring had room for a whole packet when the endpoint was armed */
+      uint32_t head = hcdc->RxHead & (hcdc->RxRingSize - 1U);
+      uint32_t first = MIN(hcdc->RxLength, hcdc->RxRingSize - head);
+
+      (void)USBD_memcpy(&hcdc->RxRing[head], hcdc->RxBuffer, first);
+      (void)USBD_memcpy(hcdc->RxRing, &hcdc->RxBuffer[first], hcdc->RxLength - first);
+      hcdc->RxHead += hcdc->RxLength;
+
+      USBD_CDC_StreamReceive(pdev);
+
+      if(((USBD_CDC_ItfTypeDef *)pdev->pUserData)->RxReady != NULL)
+      {
+        ((USBD_CDC_ItfTypeDef *)pdev->pUserData)->RxReady(hcdc->RxHead - hcdc->RxTail);
+      }
+    }
+    else
+    {
+      ((USBD_CDC_ItfTypeDef *)pdev->pUserData)->Receive(hcdc->RxBuffer, &hcdc->RxLength);
+    }
 
     return USBD_OK;
   }
@@ -956,6 +1027,201 @@ uint8_t  USBD_CDC_ReceivePacket(USBD_HandleTypeDef *pdev)
     return USBD_FAIL;
   }
 }
+/**
+  * @brief  USBD_CDC_StreamInit
+  *         Enable the stream mode, to be called from the interface Init()
+  * @param  pdev: device instance
+  * @param  pTxRing: TX ring
+  * @param  TxSize: TX ring size, power of two
+  * @param  pRxRing: RX ring
+  * @param  RxSize: RX ring size, power of two of at least two HS packets
+  * @retval status
+  */
+uint8_t  USBD_CDC_StreamInit(USBD_HandleTypeDef *pdev,
+                             uint8_t *pTxRing, uint32_t TxSize,
+                             uint8_t *pRxRing, uint32_t RxSize)
+{
+  USBD_CDC_HandleTypeDef   *hcdc = (USBD_CDC_HandleTypeDef*) pdev->pClassData;
+
+  if((hcdc == NULL) || (pTxRing == NULL) || (pRxRing == NULL) ||
+     (TxSize == 0U) || ((TxSize & (TxSize - 1U)) != 0U) ||
+     (RxSize < (2U * CDC_DATA_HS_MAX_PACKET_SIZE)) || ((RxSize & (RxSize - 1U)) != 0U))
+  {
+    return USBD_FAIL;
+  }
+
+  hcdc->TxRing = pTxRing;
+  hcdc->TxRingSize = TxSize;
+  hcdc->TxHead = 0U;
+  hcdc->TxTail = 0U;
+  hcdc->TxLength = 0U;
+  hcdc->TxBlocked = 0U;
+
+  hcdc->RxRing = pRxRing;
+  hcdc->RxRingSize = RxSize;
+  hcdc->RxHead = 0U;
+  hcdc->RxTail = 0U;
+  hcdc->RxBuffer = (uint8_t *)hcdc->RxPacket;
+
+  return USBD_OK;
+}
+
+/**
+  * @brief  USBD_CDC_StreamWrite
+  *         Queue data for transmission in stream mode
+  * @param  pdev: device instance
+  * @param  pbuff: data
+  * @param  length: data length
+  * @retval Number of bytes queued, less than length when the ring is full
+  */
+uint32_t USBD_CDC_StreamWrite(USBD_HandleTypeDef *pdev,
+                              const uint8_t *pbuff, uint32_t length)
+{
+  USBD_CDC_HandleTypeDef   *hcdc = (USBD_CDC_HandleTypeDef*) pdev->pClassData;
+  uint32_t head;
+  uint32_t first;
+
+  if((hcdc == NULL) || (hcdc->TxRing == NULL))
+  {
+    return 0U;
+  }
+
+  if(length > USBD_CDC_StreamGetTxFree(pdev))
+  {
+    length = USBD_CDC_StreamGetTxFree(pdev);
+    hcdc->TxBlocked = 1U;
+  }
+
+  head = hcdc->TxHead & (hcdc->TxRingSize - 1U);
+  first = MIN(length, hcdc->TxRingSize - head);
+  (void)USBD_memcpy(&hcdc->TxRing[head], pbuff, first);
+  (void)USBD_memcpy(hcdc->TxRing, &pbuff[first], length - first);
+  hcdc->TxHead += length;
+
+  /* Start a transfer if none is in flight, otherwise the data goes with the
+     next one */
+  if((hcdc->TxState == 0U) && (length > 0U))
+  {
+    hcdc->TxState = 1U;
+    USBD_CDC_StreamTransmit(pdev);
+  }
+
+  return length;
+}
+
+/**
+  * @brief  USBD_CDC_StreamRead
+  *         Get received data in stream mode
+  * @param  pdev: device instance
+  * @param  pbuff: destination buffer
+  * @param  length: buffer length
+  * @retval Number of bytes copied
+  */
+uint32_t USBD_CDC_StreamRead(USBD_HandleTypeDef *pdev,
+                             uint8_t *pbuff, uint32_t length)
+{
+  USBD_CDC_HandleTypeDef   *hcdc = (USBD_CDC_HandleTypeDef*) pdev->pClassData;
+  uint32_t tail;
+  uint32_t first;
+
+  if((hcdc == NULL) || (hcdc->RxRing == NULL))
+  {
+    return 0U;
+  }
+
+  length = MIN(length, hcdc->RxHead - hcdc->RxTail);
+  tail = hcdc->RxTail & (hcdc->RxRingSize - 1U);
+  first = MIN(length, hcdc->RxRingSize - tail);
+  (void)USBD_memcpy(pbuff, &hcdc->RxRing[tail], first);
+  (void)USBD_memcpy(&pbuff[first], hcdc->RxRing, length - first);
+  hcdc->RxTail += length;
+
+  /* Reception paused on a full ring: resume it */
+  if(hcdc->RxState != 0U)
+  {
+    USBD_CDC_StreamReceive(pdev);
+  }
+
+  return length;
+}
+
+/**
+  * @brief  USBD_CDC_StreamGetTxFree
+  *         Return the room left in the TX ring
+  * @param  pdev: device instance
+  * @retval Number of bytes
+  */
+uint32_t USBD_CDC_StreamGetTxFree(USBD_HandleTypeDef *pdev)
+{
+  USBD_CDC_HandleTypeDef   *hcdc = (USBD_CDC_HandleTypeDef*) pdev->pClassData;
+
+  if((hcdc == NULL) || (hcdc->TxRing == NULL))
+  {
+    return 0U;
+  }
+  return hcdc->TxRingSize - (hcdc->TxHead - hcdc->TxTail);
+}
+
+/**
+  * @brief  USBD_CDC_StreamGetRxCount
+  *         Return the number of bytes waiting in the RX ring
+  * @param  pdev: device instance
+  * @retval Number of bytes
+  */
+uint32_t USBD_CDC_StreamGetRxCount(USBD_HandleTypeDef *pdev)
+{
+  USBD_CDC_HandleTypeDef   *hcdc = (USBD_CDC_HandleTypeDef*) pdev->pClassData;
+
+  if((hcdc == NULL) || (hcdc->RxRing == NULL))
+  {
+    return 0U;
+  }
+  return hcdc->RxHead - hcdc->RxTail;
+}
+
+/**
+  * @brief  USBD_CDC_StreamTransmit
+  *         Send the data of the TX ring up to its end, TxState is already set
+  * @param  pdev: device instance
+  * @retval None
+  */
+static void  USBD_CDC_StreamTransmit(USBD_HandleTypeDef *pdev)
+{
+  USBD_CDC_HandleTypeDef   *hcdc = (USBD_CDC_HandleTypeDef*) pdev->pClassData;
+  uint32_t tail = hcdc->TxTail & (hcdc->TxRingSize - 1U);
+  uint32_t length = MIN(hcdc->TxHead - hcdc->TxTail, hcdc->TxRingSize - tail);
+
+  /* Transfer size limited to what USBD_LL_Transmit() accepts */
+  length = MIN(length, 0xFFFFU - (0xFFFFU % CDC_DATA_HS_MAX_PACKET_SIZE));
+
+  hcdc->TxLength = length;
+  pdev->ep_in[CDC_IN_EP & 0xFU].total_length = length;
+  USBD_LL_Transmit(pdev, CDC_IN_EP, &hcdc->TxRing[tail], (uint16_t)length);
+}
+
+/**
+  * @brief  USBD_CDC_StreamReceive
+  *         Arm the OUT endpoint when the RX ring can hold one more packet,
+  *         otherwise pause the reception
+  * @param  pdev: device instance
+  * @retval None
+  */
+static void  USBD_CDC_StreamReceive(USBD_HandleTypeDef *pdev)
+{
+  USBD_CDC_HandleTypeDef   *hcdc = (USBD_CDC_HandleTypeDef*) pdev->pClassData;
+  uint32_t mps = CDC_DATA_MAX_PACKET_SIZE(pdev);
+
+  if((hcdc->RxRingSize - (hcdc->RxHead - hcdc->RxTail)) >= mps)
+  {
+    hcdc->RxState = 0U;
+    USBD_LL_PrepareReceive(pdev, CDC_OUT_EP, hcdc->RxBuffer, (uint16_t)mps);
+  }
+  else
+  {
+    hcdc->RxState = 1U;
+  }
+}
+
 /**
   * @}
   */
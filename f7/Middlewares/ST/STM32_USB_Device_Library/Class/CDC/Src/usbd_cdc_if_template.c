@@ -100,7 +100,9 @@ USBD_CDC_ItfTypeDef USBD_CDC_Template_fops =
   TEMPLATE_Init,
   TEMPLATE_DeInit,
   TEMPLATE_Control,
-  TEMPLATE_Receive
+  TEMPLATE_Receive,
+  NULL,
+  NULL
 };
 
 USBD_CDC_LineCodingTypeDef linecoding =
@@ -0,0 +1,149 @@
+/**
+  ******************************************************************************
+  * @file    usbd_composite.h
+  * @author  MCD Application Team
+  * @brief   Header file for the usbd_composite.c file.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics International N.V.
+  * All rights reserved.</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without
+  * modification, are permitted, provided that the following conditions are met:
+  *
+  * 1. Redistribution of source code must retain the above copyright notice,
+  *    this list of conditions and the following disclaimer.
+  * 2. Redistributions in binary form must reproduce the above copyright notice,
+  *    this list of conditions and the following disclaimer in the documentation
+  *    and/or other materials provided with the distribution.
+  * 3. Neither the name of STMicroelectronics nor the names of other
+  *    contributors to this software may be used to endorse or promote products
+  *    derived from this software without specific written permission.
+  * 4. This software, including modifications and/or derivative works of this
+  *    software, must execute solely and exclusively on microcontroller or
+  *    microprocessor devices manufactured by or for STMicroelectronics.
+  * 5. Redistribution and use of this software other than as permitted under
+  *    this license is void and will automatically terminate your rights under
+  *    this license.
+  *
+  * THIS SOFTWARE IS PROVIDED BY STMICROELECTRONICS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS, IMPLIED OR STATUTORY WARRANTIES, INCLUDING, BUT NOT
+  * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+  * PARTICULAR PURPOSE AND NON-INFRINGEMENT OF THIRD PARTY INTELLECTUAL PROPERTY
+  * RIGHTS ARE DISCLAIMED TO THE FULLEST EXTENT PERMITTED BY LAW. IN NO EVENT
+  * SHALL STMICROELECTRONICS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+  * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+  * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __USBD_COMPOSITE_H
+#define __USBD_COMPOSITE_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include  "usbd_ioreq.h"
+
+/** @addtogroup STM32_USB_DEVICE_LIBRARY
+  * @{
+  */
+
+/** @defgroup USBD_COMPOSITE
+  * @brief This file is the header file for usbd_composite.c
+  * @{
+  */
+
+
+/** @defgroup USBD_COMPOSITE_Exported_Defines
+  * @{
+  */
+#ifndef USBD_COMPOSITE_MAX_CLASSES
+#define USBD_COMPOSITE_MAX_CLASSES          4U
+#endif /* USBD_COMPOSITE_MAX_CLASSES */
+
+#ifndef USBD_COMPOSITE_MAX_INTERFACES
+#define USBD_COMPOSITE_MAX_INTERFACES       8U
+#endif /* USBD_COMPOSITE_MAX_INTERFACES */
+
+/* Size of each of the HS, FS and other speed configuration descriptors */
+#ifndef USBD_COMPOSITE_MAX_DESC_SIZ
+#define USBD_COMPOSITE_MAX_DESC_SIZ         256U
+#endif /* USBD_COMPOSITE_MAX_DESC_SIZ */
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_COMPOSITE_Exported_TypesDefinitions
+  * @{
+  */
+typedef struct
+{
+  USBD_ClassTypeDef  *pClass;
+  void               *pUserData;
+  void               *pClassData;
+  uint8_t            FirstInterface;
+  uint8_t            NumInterfaces;
+}
+USBD_COMPOSITE_ItemTypeDef;
+/**
+  * @}
+  */
+
+
+
+/** @defgroup USBD_COMPOSITE_Exported_Macros
+  * @{
+  */
+
+/**
+  * @}
+  */
+
+/** @defgroup USBD_COMPOSITE_Exported_Variables
+  * @{
+  */
+
+extern USBD_ClassTypeDef  USBD_COMPOSITE;
+#define USBD_COMPOSITE_CLASS    &USBD_COMPOSITE
+/**
+  * @}
+  */
+
+/** @defgroup USBD_COMPOSITE_Exported_Functions
+  * @{
+  */
+uint8_t  USBD_COMPOSITE_RegisterClass (USBD_HandleTypeDef *pdev,
+                                       USBD_ClassTypeDef *pclass,
+                                       void *pUserData);
+
+uint8_t  USBD_COMPOSITE_Select        (USBD_HandleTypeDef *pdev,
+                                       USBD_ClassTypeDef *pclass);
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __USBD_COMPOSITE_H */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,929 @@
+/**
+  ******************************************************************************
+  * @file    usbd_composite.c
+  * @author  MCD Application Team
+  * @brief   This file provides the composite class: several device classes
+  *          sharing one USBD_HandleTypeDef.
+  *
+  * @verbatim
+  *
+  *          ===================================================================
+  *                                COMPOSITE Class  Description
+  *          ===================================================================
+  *           The composite class is registered in place of a single class and
+  *           dispatches the core events to the classes registered in it:
+  *             - Interface numbers and the bNumInterfaces/wTotalLength of the
+  *               configuration descriptors are assigned at registration time;
+  *               an Interface Association Descriptor is inserted in front of
+  *               every class having more than one interface and none of its own.
+  *             - Endpoint and interface ownership is kept in lookup tables, so
+  *               DataIn/DataOut/Setup reach their class without searching. Two
+  *               classes using the same endpoint address are refused; the
+  *               endpoint addresses of the classes (e.g. MSC_EPIN_ADDR,
+  *               CDC_IN_EP) can be overridden in usbd_conf.h.
+  *             - With USBD_AUTO_FIFO set to 1U, USBD_Start() sizes the FIFOs
+  *               from the composite configuration descriptors.
+  *
+  *           Usage:
+  *             USBD_Init(&hUsbDevice, &Composite_Desc, 0);
+  *             USBD_COMPOSITE_RegisterClass(&hUsbDevice, USBD_CDC_CLASS, &USBD_CDC_fops);
+  *             USBD_COMPOSITE_RegisterClass(&hUsbDevice, USBD_MSC_CLASS, &USBD_MSC_fops);
+  *             USBD_RegisterClass(&hUsbDevice, USBD_COMPOSITE_CLASS);
+  *             USBD_Start(&hUsbDevice);
+  *
+  *           The class APIs called by the application work on pdev->pClassData:
+  *           call USBD_COMPOSITE_Select() to choose the class they apply to
+  *           before calling them, e.g. before USBD_CDC_TransmitPacket(). The
+  *           selection is kept across the class callbacks run from the USB
+  *           interrupt.
+  *           The device descriptor should use the IAD class codes (0xEF, 0x02,
+  *           0x01) as soon as an IAD is present.
+  *
+  * @note     In HS mode and when the DMA is used, all variables and data structures
+  *           dealing with the DMA during the transaction process should be 32-bit aligned.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics International N.V.
+  * All rights reserved.</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without
+  * modification, are permitted, provided that the following conditions are met:
+  *
+  * 1. Redistribution of source code must retain the above copyright notice,
+  *    this list of conditions and the following disclaimer.
+  * 2. Redistributions in binary form must reproduce the above copyright notice,
+  *    this list of conditions and the following disclaimer in the documentation
+  *    and/or other materials provided with the distribution.
+  * 3. Neither the name of STMicroelectronics nor the names of other
+  *    contributors to this software may be used to endorse or promote products
+  *    derived from this software without specific written permission.
+  * 4. This software, including modifications and/or derivative works of this
+  *    software, must execute solely and exclusively on microcontroller or
+  *    microprocessor devices manufactured by or for STMicroelectronics.
+  * 5. Redistribution and use of this software other than as permitted under
+  *    this license is void and will automatically terminate your rights under
+  *    this license.
+  *
+  * THIS SOFTWARE IS PROVIDED BY STMICROELECTRONICS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS, IMPLIED OR STATUTORY WARRANTIES, INCLUDING, BUT NOT
+  * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+  * PARTICULAR PURPOSE AND NON-INFRINGEMENT OF THIRD PARTY INTELLECTUAL PROPERTY
+  * RIGHTS ARE DISCLAIMED TO THE FULLEST EXTENT PERMITTED BY LAW. IN NO EVENT
+  * SHALL STMICROELECTRONICS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+  * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+  * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbd_composite.h"
+#include "usbd_ctlreq.h"
+
+
+/** @addtogroup STM32_USB_DEVICE_LIBRARY
+  * @{
+  */
+
+
+/** @defgroup USBD_COMPOSITE
+  * @brief usbd core module
+  * @{
+  */
+
+/** @defgroup USBD_COMPOSITE_Private_TypesDefinitions
+  * @{
+  */
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_COMPOSITE_Private_Defines
+  * @{
+  */
+#define USB_DESC_TYPE_IAD                  0x0BU
+#define USB_DESC_TYPE_CS_INTERFACE         0x24U
+#define USB_IAD_DESC_SIZ                   0x08U
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_COMPOSITE_Private_Macros
+  * @{
+  */
+
+/**
+  * @}
+  */
+
+
+
+
+/** @defgroup USBD_COMPOSITE_Private_FunctionPrototypes
+  * @{
+  */
+
+
+static uint8_t  USBD_COMPOSITE_Init (USBD_HandleTypeDef *pdev,
+                                     uint8_t cfgidx);
+
+static uint8_t  USBD_COMPOSITE_DeInit (USBD_HandleTypeDef *pdev,
+                                       uint8_t cfgidx);
+
+static uint8_t  USBD_COMPOSITE_Setup (USBD_HandleTypeDef *pdev,
+                                      USBD_SetupReqTypedef *req);
+
+static uint8_t  USBD_COMPOSITE_EP0_TxSent (USBD_HandleTypeDef *pdev);
+
+static uint8_t  USBD_COMPOSITE_EP0_RxReady (USBD_HandleTypeDef *pdev);
+
+static uint8_t  USBD_COMPOSITE_DataIn (USBD_HandleTypeDef *pdev,
+                                       uint8_t epnum);
+
+static uint8_t  USBD_COMPOSITE_DataOut (USBD_HandleTypeDef *pdev,
+                                        uint8_t epnum);
+
+static uint8_t  USBD_COMPOSITE_SOF (USBD_HandleTypeDef *pdev);
+
+static uint8_t  USBD_COMPOSITE_IsoINIncomplete (USBD_HandleTypeDef *pdev,
+                                                uint8_t epnum);
+
+static uint8_t  USBD_COMPOSITE_IsoOutIncomplete (USBD_HandleTypeDef *pdev,
+                                                 uint8_t epnum);
+
+static uint8_t  *USBD_COMPOSITE_GetHSCfgDesc (uint16_t *length);
+
+static uint8_t  *USBD_COMPOSITE_GetFSCfgDesc (uint16_t *length);
+
+static uint8_t  *USBD_COMPOSITE_GetOtherSpeedCfgDesc (uint16_t *length);
+
+static uint8_t  *USBD_COMPOSITE_GetDeviceQualifierDesc (uint16_t *length);
+
+#if (USBD_SUPPORT_USER_STRING == 1U)
+static uint8_t  *USBD_COMPOSITE_GetUsrStrDesc (USBD_HandleTypeDef *pdev,
+                                               uint8_t index, uint16_t *length);
+#endif
+
+static void     USBD_COMPOSITE_Enter (USBD_HandleTypeDef *pdev, uint8_t idx);
+
+static void     USBD_COMPOSITE_Leave (USBD_HandleTypeDef *pdev, uint8_t idx);
+
+static uint8_t  USBD_COMPOSITE_ParseDesc (uint8_t *pDesc, uint16_t len,
+                                          uint8_t idx, uint8_t *pNumItf,
+                                          uint8_t commit);
+
+static uint16_t USBD_COMPOSITE_AppendDesc (uint8_t *pCfg, uint16_t cfgLen,
+                                           uint8_t *pDesc, uint16_t len,
+                                           uint8_t firstItf, uint8_t numItf);
+
+static void     USBD_COMPOSITE_SetCfgHeader (uint8_t *pCfg, uint16_t cfgLen);
+
+/**
+  * @}
+  */
+
+/** @defgroup USBD_COMPOSITE_Private_Variables
+  * @{
+  */
+
+USBD_ClassTypeDef  USBD_COMPOSITE =
+{
+  USBD_COMPOSITE_Init,
+  USBD_COMPOSITE_DeInit,
+  USBD_COMPOSITE_Setup,
+  USBD_COMPOSITE_EP0_TxSent,
+  USBD_COMPOSITE_EP0_RxReady,
+  USBD_COMPOSITE_DataIn,
+  USBD_COMPOSITE_DataOut,
+  USBD_COMPOSITE_SOF,
+  USBD_COMPOSITE_IsoINIncomplete,
+  USBD_COMPOSITE_IsoOutIncomplete,
+  USBD_COMPOSITE_GetHSCfgDesc,
+  USBD_COMPOSITE_GetFSCfgDesc,
+  USBD_COMPOSITE_GetOtherSpeedCfgDesc,
+  USBD_COMPOSITE_GetDeviceQualifierDesc,
+#if (USBD_SUPPORT_USER_STRING == 1U)
+  USBD_COMPOSITE_GetUsrStrDesc,
+#endif
+};
+
+static USBD_COMPOSITE_ItemTypeDef USBD_COMPOSITE_Items[USBD_COMPOSITE_MAX_CLASSES];
+static uint8_t USBD_COMPOSITE_NumClasses = 0U;
+static uint8_t USBD_COMPOSITE_NumInterfaces = 0U;
+static uint8_t USBD_COMPOSITE_Selected = 0U;
+static uint8_t USBD_COMPOSITE_Ep0Class = 0U;
+
+/* Owner of each endpoint and interface: class index + 1, 0 when unused */
+static uint8_t USBD_COMPOSITE_InEp[16];
+static uint8_t USBD_COMPOSITE_OutEp[16];
+static uint8_t USBD_COMPOSITE_Itf[USBD_COMPOSITE_MAX_INTERFACES];
+
+/* USB composite device Configuration Descriptors, built at registration */
+__ALIGN_BEGIN static uint8_t USBD_COMPOSITE_CfgHSDesc[USBD_COMPOSITE_MAX_DESC_SIZ] __ALIGN_END;
+__ALIGN_BEGIN static uint8_t USBD_COMPOSITE_CfgFSDesc[USBD_COMPOSITE_MAX_DESC_SIZ] __ALIGN_END;
+__ALIGN_BEGIN static uint8_t USBD_COMPOSITE_OtherSpeedCfgDesc[USBD_COMPOSITE_MAX_DESC_SIZ] __ALIGN_END;
+static uint16_t USBD_COMPOSITE_CfgHSDescLen = 0U;
+static uint16_t USBD_COMPOSITE_CfgFSDescLen = 0U;
+static uint16_t USBD_COMPOSITE_OtherSpeedCfgDescLen = 0U;
+
+/* USB Standard Device Descriptor */
+__ALIGN_BEGIN static uint8_t USBD_COMPOSITE_DeviceQualifierDesc[USB_LEN_DEV_QUALIFIER_DESC] __ALIGN_END =
+{
+  USB_LEN_DEV_QUALIFIER_DESC,
+  USB_DESC_TYPE_DEVICE_QUALIFIER,
+  0x00,
+  0x02,
+  0xEF,
+  0x02,
+  0x01,
+  0x40,
+  0x01,
+  0x00,
+};
+
+/**
+  * @}
+  */
+
+/** @defgroup USBD_COMPOSITE_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  USBD_COMPOSITE_Init
+  *         Initialize every registered class
+  * @param  pdev: device instance
+  * @param  cfgidx: Configuration index
+  * @retval status
+  */
+static uint8_t  USBD_COMPOSITE_Init (USBD_HandleTypeDef *pdev, uint8_t cfgidx)
+{
+  uint8_t ret = 0U;
+  uint8_t idx;
+
+  for (idx = 0U; idx < USBD_COMPOSITE_NumClasses; idx++)
+  {
+    USBD_COMPOSITE_Enter(pdev, idx);
+    ret |= USBD_COMPOSITE_Items[idx].pClass->Init(pdev, cfgidx);
+    USBD_COMPOSITE_Leave(pdev, idx);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  USBD_COMPOSITE_DeInit
+  *         DeInitialize every registered class
+  * @param  pdev: device instance
+  * @param  cfgidx: Configuration index
+  * @retval status
+  */
+static uint8_t  USBD_COMPOSITE_DeInit (USBD_HandleTypeDef *pdev, uint8_t cfgidx)
+{
+  uint8_t ret = 0U;
+  uint8_t idx;
+
+  for (idx = 0U; idx < USBD_COMPOSITE_NumClasses; idx++)
+  {
+    USBD_COMPOSITE_Enter(pdev, idx);
+    ret |= USBD_COMPOSITE_Items[idx].pClass->DeInit(pdev, cfgidx);
+    USBD_COMPOSITE_Leave(pdev, idx);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  USBD_COMPOSITE_Setup
+  *         Route a class, vendor or interface request to its class. The
+  *         interface number is translated back to the class numbering.
+  * @param  pdev: device instance
+  * @param  req: usb requests
+  * @retval status
+  */
+static uint8_t  USBD_COMPOSITE_Setup (USBD_HandleTypeDef *pdev,
+                                      USBD_SetupReqTypedef *req)
+{
+  USBD_SetupReqTypedef request = *req;
+  uint8_t owner = 0U;
+  uint8_t index = LOBYTE(req->wIndex);
+  uint8_t ret;
+
+  switch (req->bmRequest & USB_REQ_RECIPIENT_MASK)
+  {
+  case USB_REQ_RECIPIENT_INTERFACE:
+    if (index < USBD_COMPOSITE_MAX_INTERFACES)
+    {
+      owner = USBD_COMPOSITE_Itf[index];
+    }
+    if (owner != 0U)
+    {
+      request.wIndex = (req->wIndex & 0xFF00U) |
+                       (uint16_t)(index - USBD_COMPOSITE_Items[owner - 1U].FirstInterface);
+    }
+    break;
+
+  case USB_REQ_RECIPIENT_ENDPOINT:
+    owner = ((index & 0x80U) == 0x80U) ? USBD_COMPOSITE_InEp[index & 0xFU] :
+                                         USBD_COMPOSITE_OutEp[index & 0xFU];
+    break;
+
+  default:
+    /* Device requests go to the first class */
+    owner = (USBD_COMPOSITE_NumClasses > 0U) ? 1U : 0U;
+    break;
+  }
+
+  if ((owner == 0U) || (USBD_COMPOSITE_Items[owner - 1U].pClass->Setup == NULL))
+  {
+    USBD_CtlError (pdev, req);
+    return USBD_FAIL;
+  }
+
+  USBD_COMPOSITE_Ep0Class = owner;
+  USBD_COMPOSITE_Enter(pdev, owner - 1U);
+  ret = USBD_COMPOSITE_Items[owner - 1U].pClass->Setup(pdev, &request);
+  USBD_COMPOSITE_Leave(pdev, owner - 1U);
+
+  return ret;
+}
+
+/**
+  * @brief  USBD_COMPOSITE_EP0_TxSent
+  *         Handle EP0 TRx Ready event for the class of the last request
+  * @param  pdev: device instance
+  * @retval status
+  */
+static uint8_t  USBD_COMPOSITE_EP0_TxSent (USBD_HandleTypeDef *pdev)
+{
+  uint8_t owner = USBD_COMPOSITE_Ep0Class;
+
+  if ((owner != 0U) && (USBD_COMPOSITE_Items[owner - 1U].pClass->EP0_TxSent != NULL))
+  {
+    USBD_COMPOSITE_Enter(pdev, owner - 1U);
+    (void)USBD_COMPOSITE_Items[owner - 1U].pClass->EP0_TxSent(pdev);
+    USBD_COMPOSITE_Leave(pdev, owner - 1U);
+  }
+  return USBD_OK;
+}
+
+/**
+  * @brief  USBD_COMPOSITE_EP0_RxReady
+  *         Handle EP0 Rx Ready event for the class of the last request
+  * @param  pdev: device instance
+  * @retval status
+  */
+static uint8_t  USBD_COMPOSITE_EP0_RxReady (USBD_HandleTypeDef *pdev)
+{
+  uint8_t owner = USBD_COMPOSITE_Ep0Class;
+
+  if ((owner != 0U) && (USBD_COMPOSITE_Items[owner - 1U].pClass->EP0_RxReady != NULL))
+  {
+    USBD_COMPOSITE_Enter(pdev, owner - 1U);
+    (void)USBD_COMPOSITE_Items[owner - 1U].pClass->EP0_RxReady(pdev);
+    USBD_COMPOSITE_Leave(pdev, owner - 1U);
+  }
+  return USBD_OK;
+}
+
+/**
+  * @brief  USBD_COMPOSITE_DataIn
+  *         Data sent on non-control IN endpoint
+  * @param  pdev: device instance
+  * @param  epnum: endpoint number
+  * @retval status
+  */
+static uint8_t  USBD_COMPOSITE_DataIn (USBD_HandleTypeDef *pdev, uint8_t epnum)
+{
+  uint8_t owner = USBD_COMPOSITE_InEp[epnum & 0xFU];
+  uint8_t ret = USBD_FAIL;
+
+  if ((owner != 0U) && (USBD_COMPOSITE_Items[owner - 1U].pClass->DataIn != NULL))
+  {
+    USBD_COMPOSITE_Enter(pdev, owner - 1U);
+    ret = USBD_COMPOSITE_Items[owner - 1U].pClass->DataIn(pdev, epnum);
+    USBD_COMPOSITE_Leave(pdev, owner - 1U);
+  }
+  return ret;
+}
+
+/**
+  * @brief  USBD_COMPOSITE_DataOut
+  *         Data received on non-control Out endpoint
+  * @param  pdev: device instance
+  * @param  epnum: endpoint number
+  * @retval status
+  */
+static uint8_t  USBD_COMPOSITE_DataOut (USBD_HandleTypeDef *pdev, uint8_t epnum)
+{
+  uint8_t owner = USBD_COMPOSITE_OutEp[epnum & 0xFU];
+  uint8_t ret = USBD_FAIL;
+
+  if ((owner != 0U) && (USBD_COMPOSITE_Items[owner - 1U].pClass->DataOut != NULL))
+  {
+    USBD_COMPOSITE_Enter(pdev, owner - 1U);
+    ret = USBD_COMPOSITE_Items[owner - 1U].pClass->DataOut(pdev, epnum);
+    USBD_COMPOSITE_Leave(pdev, owner - 1U);
+  }
+  return ret;
+}
+
+/**
+  * @brief  USBD_COMPOSITE_SOF
+  *         Start Of Frame event, forwarded to every class handling it
+  * @param  pdev: device instance
+  * @retval status
+  */
+static uint8_t  USBD_COMPOSITE_SOF (USBD_HandleTypeDef *pdev)
+{
+  uint8_t idx;
+
+  for (idx = 0U; idx < USBD_COMPOSITE_NumClasses; idx++)
+  {
+    if (USBD_COMPOSITE_Items[idx].pClass->SOF != NULL)
+    {
+      USBD_COMPOSITE_Enter(pdev, idx);
+      (void)USBD_COMPOSITE_Items[idx].pClass->SOF(pdev);
+      USBD_COMPOSITE_Leave(pdev, idx);
+    }
+  }
+  return USBD_OK;
+}
+
+/**
+  * @brief  USBD_COMPOSITE_IsoINIncomplete
+  *         Incomplete isochronous IN transfer
+  * @param  pdev: device instance
+  * @param  epnum: endpoint number
+  * @retval status
+  */
+static uint8_t  USBD_COMPOSITE_IsoINIncomplete (USBD_HandleTypeDef *pdev, uint8_t epnum)
+{
+  uint8_t owner = USBD_COMPOSITE_InEp[epnum & 0xFU];
+
+  if ((owner != 0U) && (USBD_COMPOSITE_Items[owner - 1U].pClass->IsoINIncomplete != NULL))
+  {
+    USBD_COMPOSITE_Enter(pdev, owner - 1U);
+    (void)USBD_COMPOSITE_Items[owner - 1U].pClass->IsoINIncomplete(pdev, epnum);
+    USBD_COMPOSITE_Leave(pdev, owner - 1U);
+  }
+  return USBD_OK;
+}
+
+/**
+  * @brief  USBD_COMPOSITE_IsoOutIncomplete
+  *         Incomplete isochronous OUT transfer
+  * @param  pdev: device instance
+  * @param  epnum: endpoint number
+  * @retval status
+  */
+static uint8_t  USBD_COMPOSITE_IsoOutIncomplete (USBD_HandleTypeDef *pdev, uint8_t epnum)
+{
+  uint8_t owner = USBD_COMPOSITE_OutEp[epnum & 0xFU];
+
+  if ((owner != 0U) && (USBD_COMPOSITE_Items[owner - 1U].pClass->IsoOUTIncomplete != NULL))
+  {
+    USBD_COMPOSITE_Enter(pdev, owner - 1U);
+    (void)USBD_COMPOSITE_Items[owner - 1U].pClass->IsoOUTIncomplete(pdev, epnum);
+    USBD_COMPOSITE_Leave(pdev, owner - 1U);
+  }
+  return USBD_OK;
+}
+
+/**
+  * @brief  USBD_COMPOSITE_GetHSCfgDesc
+  *         Return configuration descriptor
+  * @param  length : pointer data length
+  * @retval pointer to descriptor buffer
+  */
+static uint8_t  *USBD_COMPOSITE_GetHSCfgDesc (uint16_t *length)
+{
+  *length = USBD_COMPOSITE_CfgHSDescLen;
+  return USBD_COMPOSITE_CfgHSDesc;
+}
+
+/**
+  * @brief  USBD_COMPOSITE_GetFSCfgDesc
+  *         Return configuration descriptor
+  * @param  length : pointer data length
+  * @retval pointer to descriptor buffer
+  */
+static uint8_t  *USBD_COMPOSITE_GetFSCfgDesc (uint16_t *length)
+{
+  *length = USBD_COMPOSITE_CfgFSDescLen;
+  return USBD_COMPOSITE_CfgFSDesc;
+}
+
+/**
+  * @brief  USBD_COMPOSITE_GetOtherSpeedCfgDesc
+  *         Return other speed configuration descriptor
+  * @param  length : pointer data length
+  * @retval pointer to descriptor buffer
+  */
+static uint8_t  *USBD_COMPOSITE_GetOtherSpeedCfgDesc (uint16_t *length)
+{
+  *length = USBD_COMPOSITE_OtherSpeedCfgDescLen;
+  return USBD_COMPOSITE_OtherSpeedCfgDesc;
+}
+
+/**
+  * @brief  USBD_COMPOSITE_GetDeviceQualifierDesc
+  *         return Device Qualifier descriptor
+  * @param  length : pointer data length
+  * @retval pointer to descriptor buffer
+  */
+static uint8_t  *USBD_COMPOSITE_GetDeviceQualifierDesc (uint16_t *length)
+{
+  *length = sizeof (USBD_COMPOSITE_DeviceQualifierDesc);
+  return USBD_COMPOSITE_DeviceQualifierDesc;
+}
+
+#if (USBD_SUPPORT_USER_STRING == 1U)
+/**
+  * @brief  USBD_COMPOSITE_GetUsrStrDesc
+  *         return the user string descriptor of the first class providing one
+  * @param  pdev: device instance
+  * @param  index : string index
+  * @param  length : pointer data length
+  * @retval pointer to descriptor buffer
+  */
+static uint8_t  *USBD_COMPOSITE_GetUsrStrDesc (USBD_HandleTypeDef *pdev,
+                                               uint8_t index, uint16_t *length)
+{
+  uint8_t *pbuf = NULL;
+  uint8_t idx;
+
+  for (idx = 0U; (idx < USBD_COMPOSITE_NumClasses) && (pbuf == NULL); idx++)
+  {
+    if (USBD_COMPOSITE_Items[idx].pClass->GetUsrStrDescriptor != NULL)
+    {
+      USBD_COMPOSITE_Enter(pdev, idx);
+      pbuf = USBD_COMPOSITE_Items[idx].pClass->GetUsrStrDescriptor(pdev, index, length);
+      USBD_COMPOSITE_Leave(pdev, idx);
+    }
+  }
+  return pbuf;
+}
+#endif
+
+/**
+  * @brief  USBD_COMPOSITE_Enter
+  *         Give the device handle the context of a class
+  * @param  pdev: device instance
+  * @param  idx: class index
+  * @retval None
+  */
+static void  USBD_COMPOSITE_Enter (USBD_HandleTypeDef *pdev, uint8_t idx)
+{
+  pdev->pClassData = USBD_COMPOSITE_Items[idx].pClassData;
+  pdev->pUserData  = USBD_COMPOSITE_Items[idx].pUserData;
+}
+
+/**
+  * @brief  USBD_COMPOSITE_Leave
+  *         Save the context of a class and restore the selected one
+  * @param  pdev: device instance
+  * @param  idx: class index
+  * @retval None
+  */
+static void  USBD_COMPOSITE_Leave (USBD_HandleTypeDef *pdev, uint8_t idx)
+{
+  USBD_COMPOSITE_Items[idx].pClassData = pdev->pClassData;
+
+  pdev->pClassData = USBD_COMPOSITE_Items[USBD_COMPOSITE_Selected].pClassData;
+  pdev->pUserData  = USBD_COMPOSITE_Items[USBD_COMPOSITE_Selected].pUserData;
+}
+
+/**
+  * @brief  USBD_COMPOSITE_ParseDesc
+  *         Check, then record, the endpoints and interfaces of a class
+  * @param  pDesc: configuration descriptor of the class
+  * @param  len: descriptor length
+  * @param  idx: class index
+  * @param  pNumItf: returns the number of interfaces of the class
+  * @param  commit: 0 to only check for conflicts, 1 to fill the lookup tables
+  * @retval status
+  */
+static uint8_t  USBD_COMPOSITE_ParseDesc (uint8_t *pDesc, uint16_t len,
+                                          uint8_t idx, uint8_t *pNumItf,
+                                          uint8_t commit)
+{
+  uint16_t pos;
+  uint8_t *pOwner;
+  uint8_t numItf = 0U;
+
+  for (pos = pDesc[0]; ((pos + 1U) < len) && (pDesc[pos] != 0U); pos += pDesc[pos])
+  {
+    if ((pDesc[pos + 1U] == USB_DESC_TYPE_INTERFACE) && (pDesc[pos + 3U] == 0U))
+    {
+      if ((USBD_COMPOSITE_NumInterfaces + numItf) >= USBD_COMPOSITE_MAX_INTERFACES)
+      {
+        return USBD_FAIL;
+      }
+      if (commit != 0U)
+      {
+        USBD_COMPOSITE_Itf[USBD_COMPOSITE_NumInterfaces + numItf] = idx + 1U;
+      }
+      numItf++;
+    }
+    else if (pDesc[pos + 1U] == USB_DESC_TYPE_ENDPOINT)
+    {
+      pOwner = ((pDesc[pos + 2U] & 0x80U) == 0x80U) ? &USBD_COMPOSITE_InEp[pDesc[pos + 2U] & 0xFU] :
+                                                      &USBD_COMPOSITE_OutEp[pDesc[pos + 2U] & 0xFU];
+      if ((*pOwner != 0U) && (*pOwner != (idx + 1U)))
+      {
+        /* Endpoint address already used by another class */
+        return USBD_FAIL;
+      }
+      if (commit != 0U)
+      {
+        *pOwner = idx + 1U;
+      }
+    }
+    else
+    {
+    }
+  }
+
+  *pNumItf = numItf;
+  return USBD_OK;
+}
+
+/**
+  * @brief  USBD_COMPOSITE_AppendDesc
+  *         Append the descriptors of a class to a composite configuration
+  *         descriptor, renumbering its interfaces
+  * @param  pCfg: composite configuration descriptor
+  * @param  cfgLen: current composite descriptor length, 0 for the first class
+  * @param  pDesc: configuration descriptor of the class
+  * @param  len: descriptor length
+  * @param  firstItf: first interface number given to the class
+  * @param  numItf: number of interfaces of the class
+  * @note   The header is updated by USBD_COMPOSITE_SetCfgHeader() once the
+  *         class fits in every descriptor.
+  * @retval New composite descriptor length, 0 when it does not fit
+  */
+static uint16_t USBD_COMPOSITE_AppendDesc (uint8_t *pCfg, uint16_t cfgLen,
+                                           uint8_t *pDesc, uint16_t len,
+                                           uint8_t firstItf, uint8_t numItf)
+{
+  uint16_t pos;
+  uint16_t i;
+  uint8_t *d;
+  uint8_t itfClass = 0U;
+  uint8_t itfSubClass = 0U;
+  uint8_t iad = 0U;
+
+  if (cfgLen == 0U)
+  {
+    /* The first class gives the configuration header */
+    for (i = 0U; i < pDesc[0]; i++)
+    {
+      pCfg[i] = pDesc[i];
+    }
+    cfgLen = pDesc[0];
+  }
+
+  for (pos = pDesc[0]; ((pos + 1U) < len) && (pDesc[pos] != 0U); pos += pDesc[pos])
+  {
+    if (pDesc[pos + 1U] == USB_DESC_TYPE_IAD)
+    {
+      iad = 1U;
+    }
+  }
+
+  for (pos = pDesc[0]; ((pos + 1U) < len) && (pDesc[pos] != 0U); pos += pDesc[pos])
+  {
+    if ((cfgLen + pDesc[pos] + USB_IAD_DESC_SIZ) > USBD_COMPOSITE_MAX_DESC_SIZ)
+    {
+      return 0U;
+    }
+
+    if ((pDesc[pos + 1U] == USB_DESC_TYPE_INTERFACE) && (numItf > 1U) && (iad == 0U))
+    {
+      /* Group the interfaces of the class with an IAD */
+      d = &pCfg[cfgLen];
+      d[0] = USB_IAD_DESC_SIZ;
+      d[1] = USB_DESC_TYPE_IAD;
+      d[2] = firstItf;
+      d[3] = numItf;
+      d[4] = pDesc[pos + 5U];
+      d[5] = pDesc[pos + 6U];
+      d[6] = pDesc[pos + 7U];
+      d[7] = 0x00U;
+      cfgLen += USB_IAD_DESC_SIZ;
+      iad = 1U;
+    }
+
+    d = &pCfg[cfgLen];
+    for (i = 0U; i < pDesc[pos]; i++)
+    {
+      d[i] = pDesc[pos + i];
+    }
+    cfgLen += d[0];
+
+    switch (d[1])
+    {
+    case USB_DESC_TYPE_INTERFACE:
+      itfClass = d[5];
+      itfSubClass = d[6];
+      d[2] += firstItf;
+      break;
+
+    case USB_DESC_TYPE_IAD:
+      d[2] += firstItf;
+      break;
+
+    case USB_DESC_TYPE_CS_INTERFACE:
+      if ((itfClass == 0x02U) && (d[2] == 0x06U))
+      {
+        /* CDC Union: master and slave interfaces */
+        for (i = 3U; i < d[0]; i++)
+        {
+          d[i] += firstItf;
+        }
+      }
+      else if ((itfClass == 0x02U) && (d[2] == 0x01U) && (d[0] >= 5U))
+      {
+        /* CDC Call Management: data interface */
+        d[4] += firstItf;
+      }
+      else if ((itfClass == 0x01U) && (itfSubClass == 0x01U) && (d[2] == 0x01U) && (d[0] >= 8U))
+      {
+        /* Audio Control header: streaming interfaces */
+        for (i = 8U; i < d[0]; i++)
+        {
+          d[i] += firstItf;
+        }
+      }
+      else
+      {
+      }
+      break;
+
+    default:
+      break;
+    }
+  }
+
+  return cfgLen;
+}
+
+/**
+  * @brief  USBD_COMPOSITE_SetCfgHeader
+  *         Update wTotalLength and bNumInterfaces of a configuration descriptor
+  * @param  pCfg: composite configuration descriptor
+  * @param  cfgLen: composite descriptor length
+  * @retval None
+  */
+static void  USBD_COMPOSITE_SetCfgHeader (uint8_t *pCfg, uint16_t cfgLen)
+{
+  if (cfgLen != 0U)
+  {
+    pCfg[2] = LOBYTE(cfgLen);
+    pCfg[3] = HIBYTE(cfgLen);
+    pCfg[4] = USBD_COMPOSITE_NumInterfaces;
+  }
+}
+
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_COMPOSITE_Exported_Functions
+  * @{
+  */
+
+/**
+  * @brief  USBD_COMPOSITE_RegisterClass
+  *         Add a class to the composite device, before USBD_RegisterClass()
+  * @param  pdev: device instance
+  * @param  pclass: class to add
+  * @param  pUserData: interface callbacks of the class (what the class
+  *         USBD_xxx_RegisterInterface/RegisterStorage function would set)
+  * @retval status
+  */
+uint8_t  USBD_COMPOSITE_RegisterClass (USBD_HandleTypeDef *pdev,
+                                       USBD_ClassTypeDef *pclass,
+                                       void *pUserData)
+{
+  uint8_t idx = USBD_COMPOSITE_NumClasses;
+  uint8_t numItf;
+  uint8_t *pDesc;
+  uint16_t len;
+  uint16_t hsLen;
+  uint16_t fsLen;
+  uint16_t osLen;
+
+  if ((pclass == NULL) || (idx >= USBD_COMPOSITE_MAX_CLASSES) ||
+      (pclass->GetFSConfigDescriptor == NULL) || (pclass->GetHSConfigDescriptor == NULL))
+  {
+    return USBD_FAIL;
+  }
+
+  /* Check the endpoints and interfaces first */
+  pDesc = pclass->GetFSConfigDescriptor(&len);
+  if (USBD_COMPOSITE_ParseDesc(pDesc, len, idx, &numItf, 0U) != USBD_OK)
+  {
+    return USBD_FAIL;
+  }
+
+  pDesc = pclass->GetHSConfigDescriptor(&len);
+  hsLen = USBD_COMPOSITE_AppendDesc(USBD_COMPOSITE_CfgHSDesc, USBD_COMPOSITE_CfgHSDescLen,
+                                    pDesc, len, USBD_COMPOSITE_NumInterfaces, numItf);
+  pDesc = pclass->GetFSConfigDescriptor(&len);
+  fsLen = USBD_COMPOSITE_AppendDesc(USBD_COMPOSITE_CfgFSDesc, USBD_COMPOSITE_CfgFSDescLen,
+                                    pDesc, len, USBD_COMPOSITE_NumInterfaces, numItf);
+  osLen = USBD_COMPOSITE_OtherSpeedCfgDescLen;
+  if (pclass->GetOtherSpeedConfigDescriptor != NULL)
+  {
+    pDesc = pclass->GetOtherSpeedConfigDescriptor(&len);
+    osLen = USBD_COMPOSITE_AppendDesc(USBD_COMPOSITE_OtherSpeedCfgDesc, USBD_COMPOSITE_OtherSpeedCfgDescLen,
+                                      pDesc, len, USBD_COMPOSITE_NumInterfaces, numItf);
+  }
+  if ((hsLen == 0U) || (fsLen == 0U) || ((osLen == 0U) && (pclass->GetOtherSpeedConfigDescriptor != NULL)))
+  {
+    /* Does not fit: USBD_COMPOSITE_MAX_DESC_SIZ to be increased */
+    return USBD_FAIL;
+  }
+
+  pDesc = pclass->GetFSConfigDescriptor(&len);
+  (void)USBD_COMPOSITE_ParseDesc(pDesc, len, idx, &numItf, 1U);
+
+  USBD_COMPOSITE_CfgHSDescLen = hsLen;
+  USBD_COMPOSITE_CfgFSDescLen = fsLen;
+  USBD_COMPOSITE_OtherSpeedCfgDescLen = osLen;
+
+  USBD_COMPOSITE_Items[idx].pClass = pclass;
+  USBD_COMPOSITE_Items[idx].pUserData = pUserData;
+  USBD_COMPOSITE_Items[idx].pClassData = NULL;
+  USBD_COMPOSITE_Items[idx].FirstInterface = USBD_COMPOSITE_NumInterfaces;
+  USBD_COMPOSITE_Items[idx].NumInterfaces = numItf;
+  USBD_COMPOSITE_NumInterfaces += numItf;
+  USBD_COMPOSITE_NumClasses++;
+
+  USBD_COMPOSITE_SetCfgHeader(USBD_COMPOSITE_CfgHSDesc, hsLen);
+  USBD_COMPOSITE_SetCfgHeader(USBD_COMPOSITE_CfgFSDesc, fsLen);
+  USBD_COMPOSITE_SetCfgHeader(USBD_COMPOSITE_OtherSpeedCfgDesc, osLen);
+
+  if (idx == 0U)
+  {
+    USBD_COMPOSITE_Selected = 0U;
+    pdev->pUserData = pUserData;
+  }
+
+  return USBD_OK;
+}
+
+/**
+  * @brief  USBD_COMPOSITE_Select
+  *         Select the class the application calls apply to
+  * @param  pdev: device instance
+  * @param  pclass: registered class
+  * @retval status
+  */
+uint8_t  USBD_COMPOSITE_Select (USBD_HandleTypeDef *pdev,
+                                USBD_ClassTypeDef *pclass)
+{
+  uint8_t idx;
+
+  for (idx = 0U; idx < USBD_COMPOSITE_NumClasses; idx++)
+  {
+    if (USBD_COMPOSITE_Items[idx].pClass == pclass)
+    {
+      /* The USB interrupt restores the context of USBD_COMPOSITE_Selected */
+      USBD_COMPOSITE_Selected = idx;
+      pdev->pClassData = USBD_COMPOSITE_Items[idx].pClassData;
+      pdev->pUserData  = USBD_COMPOSITE_Items[idx].pUserData;
+      return USBD_OK;
+    }
+  }
+  return USBD_FAIL;
+}
+
+/**
+  * @}
+  */
+
+
+/**
+  * @}
+  */
+
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
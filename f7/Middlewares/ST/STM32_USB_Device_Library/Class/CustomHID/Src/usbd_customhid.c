@@ -132,6 +132,9 @@ static uint8_t  USBD_CUSTOM_HID_DataIn (USBD_HandleTypeDef *pdev, uint8_t epnum)
 
 static uint8_t  USBD_CUSTOM_HID_DataOut (USBD_HandleTypeDef *pdev, uint8_t epnum);
 static uint8_t  USBD_CUSTOM_HID_EP0_RxReady (USBD_HandleTypeDef  *pdev);
+#if (CUSTOM_HID_IN_QUEUE_DEPTH > 0U)
+static void     USBD_CUSTOM_HID_StartIn (USBD_HandleTypeDef *pdev);
+#endif
 /**
   * @}
   */
@@ -202,8 +205,8 @@ __ALIGN_BEGIN static uint8_t USBD_CUSTOM_HID_CfgFSDesc[USB_CUSTOM_HID_CONFIG_DES
 
   CUSTOM_HID_EPIN_ADDR,     /*bEndpointAddress: Endpoint Address (IN)*/
   0x03,          /*bmAttributes: Interrupt endpoint*/
-  CUSTOM_HID_EPIN_SIZE, /*wMaxPacketSize: 2 Byte max */
-  0x00,
+  LOBYTE(CUSTOM_HID_FS_EPIN_SIZE), /*wMaxPacketSize */
+  HIBYTE(CUSTOM_HID_FS_EPIN_SIZE),
   CUSTOM_HID_FS_BINTERVAL,          /*bInterval: Polling Interval */
   /* 34 */
 
@@ -211,8 +214,8 @@ __ALIGN_BEGIN static uint8_t USBD_CUSTOM_HID_CfgFSDesc[USB_CUSTOM_HID_CONFIG_DES
   USB_DESC_TYPE_ENDPOINT,	/* bDescriptorType: */
   CUSTOM_HID_EPOUT_ADDR,  /*bEndpointAddress: Endpoint Address (OUT)*/
   0x03,	/* bmAttributes: Interrupt endpoint */
-  CUSTOM_HID_EPOUT_SIZE,	/* wMaxPacketSize: 2 Bytes max  */
-  0x00,
+  LOBYTE(CUSTOM_HID_FS_EPOUT_SIZE),	/* wMaxPacketSize */
+  HIBYTE(CUSTOM_HID_FS_EPOUT_SIZE),
   CUSTOM_HID_FS_BINTERVAL,	/* bInterval: Polling Interval */
   /* 41 */
 };
@@ -261,8 +264,8 @@ __ALIGN_BEGIN static uint8_t USBD_CUSTOM_HID_CfgHSDesc[USB_CUSTOM_HID_CONFIG_DES
 
   CUSTOM_HID_EPIN_ADDR,     /*bEndpointAddress: Endpoint Address (IN)*/
   0x03,          /*bmAttributes: Interrupt endpoint*/
-  CUSTOM_HID_EPIN_SIZE, /*wMaxPacketSize: 2 Byte max */
-  0x00,
+  LOBYTE(CUSTOM_HID_EPIN_SIZE), /*wMaxPacketSize */
+  HIBYTE(CUSTOM_HID_EPIN_SIZE),
   CUSTOM_HID_HS_BINTERVAL,          /*bInterval: Polling Interval */
   /* 34 */
 
@@ -270,8 +273,8 @@ __ALIGN_BEGIN static uint8_t USBD_CUSTOM_HID_CfgHSDesc[USB_CUSTOM_HID_CONFIG_DES
   USB_DESC_TYPE_ENDPOINT,	/* bDescriptorType: */
   CUSTOM_HID_EPOUT_ADDR,  /*bEndpointAddress: Endpoint Address (OUT)*/
   0x03,	/* bmAttributes: Interrupt endpoint */
-  CUSTOM_HID_EPOUT_SIZE,	/* wMaxPacketSize: 2 Bytes max  */
-  0x00,
+  LOBYTE(CUSTOM_HID_EPOUT_SIZE),	/* wMaxPacketSize */
+  HIBYTE(CUSTOM_HID_EPOUT_SIZE),
   CUSTOM_HID_HS_BINTERVAL,	/* bInterval: Polling Interval */
   /* 41 */
 };
@@ -320,8 +323,8 @@ __ALIGN_BEGIN static uint8_t USBD_CUSTOM_HID_OtherSpeedCfgDesc[USB_CUSTOM_HID_CO
 
   CUSTOM_HID_EPIN_ADDR,     /*bEndpointAddress: Endpoint Address (IN)*/
   0x03,          /*bmAttributes: Interrupt endpoint*/
-  CUSTOM_HID_EPIN_SIZE, /*wMaxPacketSize: 2 Byte max */
-  0x00,
+  LOBYTE(CUSTOM_HID_FS_EPIN_SIZE), /*wMaxPacketSize */
+  HIBYTE(CUSTOM_HID_FS_EPIN_SIZE),
   CUSTOM_HID_FS_BINTERVAL,          /*bInterval: Polling Interval */
   /* 34 */
 
@@ -329,8 +332,8 @@ __ALIGN_BEGIN static uint8_t USBD_CUSTOM_HID_OtherSpeedCfgDesc[USB_CUSTOM_HID_CO
   USB_DESC_TYPE_ENDPOINT,	/* bDescriptorType: */
   CUSTOM_HID_EPOUT_ADDR,  /*bEndpointAddress: Endpoint Address (OUT)*/
   0x03,	/* bmAttributes: Interrupt endpoint */
-  CUSTOM_HID_EPOUT_SIZE,	/* wMaxPacketSize: 2 Bytes max  */
-  0x00,
+  LOBYTE(CUSTOM_HID_FS_EPOUT_SIZE),	/* wMaxPacketSize */
+  HIBYTE(CUSTOM_HID_FS_EPOUT_SIZE),
   CUSTOM_HID_FS_BINTERVAL,	/* bInterval: Polling Interval */
   /* 41 */
 };
@@ -388,13 +391,13 @@ static uint8_t  USBD_CUSTOM_HID_Init (USBD_HandleTypeDef *pdev,
 
   /* Open EP IN */
   USBD_LL_OpenEP(pdev, CUSTOM_HID_EPIN_ADDR, USBD_EP_TYPE_INTR,
-                 CUSTOM_HID_EPIN_SIZE);
+                 (pdev->dev_speed == USBD_SPEED_HIGH) ? CUSTOM_HID_EPIN_SIZE : CUSTOM_HID_FS_EPIN_SIZE);
 
   pdev->ep_in[CUSTOM_HID_EPIN_ADDR & 0xFU].is_used = 1U;
 
   /* Open EP OUT */
   USBD_LL_OpenEP(pdev, CUSTOM_HID_EPOUT_ADDR, USBD_EP_TYPE_INTR,
-                 CUSTOM_HID_EPOUT_SIZE);
+                 (pdev->dev_speed == USBD_SPEED_HIGH) ? CUSTOM_HID_EPOUT_SIZE : CUSTOM_HID_FS_EPOUT_SIZE);
 
   pdev->ep_out[CUSTOM_HID_EPOUT_ADDR & 0xFU].is_used = 1U;
 
@@ -409,6 +412,11 @@ static uint8_t  USBD_CUSTOM_HID_Init (USBD_HandleTypeDef *pdev,
     hhid = (USBD_CUSTOM_HID_HandleTypeDef*) pdev->pClassData;
 
     hhid->state = CUSTOM_HID_IDLE;
+#if (CUSTOM_HID_IN_QUEUE_DEPTH > 0U)
+    hhid->InHead = 0U;
+    hhid->InTail = 0U;
+    hhid->InDropped = 0U;
+#endif
     ((USBD_CUSTOM_HID_ItfTypeDef *)pdev->pUserData)->Init();
 
     /* Prepare Out endpoint to receive 1st packet */
@@ -581,6 +589,34 @@ uint8_t USBD_CUSTOM_HID_SendReport (USBD_HandleTypeDef  *pdev,
 {
   USBD_CUSTOM_HID_HandleTypeDef     *hhid = (USBD_CUSTOM_HID_HandleTypeDef*)pdev->pClassData;
 
+#if (CUSTOM_HID_IN_QUEUE_DEPTH > 0U)
+  uint8_t  *slot;
+  uint16_t i;
+
+  if (pdev->dev_state == USBD_STATE_CONFIGURED )
+  {
+    if (len > CUSTOM_HID_IN_REPORT_SIZE)
+    {
+      return USBD_FAIL;
+    }
+    if ((hhid->InTail - hhid->InHead) >= CUSTOM_HID_IN_QUEUE_DEPTH)
+    {
+      hhid->InDropped++;
+      return USBD_BUSY;
+    }
+
+    /* The report is copied, the caller buffer can be reused on return */
+    slot = (uint8_t *)hhid->InQueue[hhid->InTail % CUSTOM_HID_IN_QUEUE_DEPTH];
+    for (i = 0U; i < len; i++)
+    {
+      slot[i] = report[i];
+    }
+    hhid->InLength[hhid->InTail % CUSTOM_HID_IN_QUEUE_DEPTH] = len;
+    hhid->InTail++;
+
+    USBD_CUSTOM_HID_StartIn(pdev);
+  }
+#else
   if (pdev->dev_state == USBD_STATE_CONFIGURED )
   {
     if(hhid->state == CUSTOM_HID_IDLE)
@@ -593,9 +629,31 @@ uint8_t USBD_CUSTOM_HID_SendReport (USBD_HandleTypeDef  *pdev,
       return USBD_BUSY;
     }
   }
+#endif
   return USBD_OK;
 }
 
+/**
+  * @brief  USBD_CUSTOM_HID_GetQueueSpace
+  *         Number of IN reports that can be queued
+  * @param  pdev: device instance
+  * @retval Free queue entries, 1 or 0 without queue
+  */
+uint32_t USBD_CUSTOM_HID_GetQueueSpace (USBD_HandleTypeDef *pdev)
+{
+  USBD_CUSTOM_HID_HandleTypeDef     *hhid = (USBD_CUSTOM_HID_HandleTypeDef*)pdev->pClassData;
+
+  if ((hhid == NULL) || (pdev->dev_state != USBD_STATE_CONFIGURED))
+  {
+    return 0U;
+  }
+#if (CUSTOM_HID_IN_QUEUE_DEPTH > 0U)
+  return CUSTOM_HID_IN_QUEUE_DEPTH - (hhid->InTail - hhid->InHead);
+#else
+  return (hhid->state == CUSTOM_HID_IDLE) ? 1U : 0U;
+#endif
+}
+
 /**
   * @brief  USBD_CUSTOM_HID_GetFSCfgDesc
   *         return FS configuration descriptor
@@ -645,9 +703,18 @@ static uint8_t  *USBD_CUSTOM_HID_GetOtherSpeedCfgDesc (uint16_t *length)
 static uint8_t  USBD_CUSTOM_HID_DataIn (USBD_HandleTypeDef *pdev,
                                         uint8_t epnum)
 {
+#if (CUSTOM_HID_IN_QUEUE_DEPTH > 0U)
+  USBD_CUSTOM_HID_HandleTypeDef     *hhid = (USBD_CUSTOM_HID_HandleTypeDef*)pdev->pClassData;
+
+  /* The head report is sent, send the next one at once */
+  hhid->InHead++;
+  hhid->state = CUSTOM_HID_IDLE;
+  USBD_CUSTOM_HID_StartIn(pdev);
+#else
   /* Ensure that the FIFO is empty before a new transfer, this condition could
   be caused by  a new transfer before the end of the previous transfer */
   ((USBD_CUSTOM_HID_HandleTypeDef *)pdev->pClassData)->state = CUSTOM_HID_IDLE;
+#endif
 
   return USBD_OK;
 }
@@ -725,6 +792,34 @@ uint8_t  USBD_CUSTOM_HID_RegisterInterface  (USBD_HandleTypeDef   *pdev,
 
   return ret;
 }
+
+#if (CUSTOM_HID_IN_QUEUE_DEPTH > 0U)
+/**
+  * @brief  USBD_CUSTOM_HID_StartIn
+  *         Send the head queued report when the endpoint is idle
+  * @param  pdev: device instance
+  * @retval None
+  */
+static void USBD_CUSTOM_HID_StartIn (USBD_HandleTypeDef *pdev)
+{
+  USBD_CUSTOM_HID_HandleTypeDef     *hhid = (USBD_CUSTOM_HID_HandleTypeDef*)pdev->pClassData;
+  uint32_t primask = __get_PRIMASK();
+  uint32_t slot;
+
+  /* Called from the application and from the USB interrupt */
+  __disable_irq();
+
+  if ((hhid->state == CUSTOM_HID_IDLE) && (hhid->InHead != hhid->InTail))
+  {
+    slot = hhid->InHead % CUSTOM_HID_IN_QUEUE_DEPTH;
+    hhid->state = CUSTOM_HID_BUSY;
+    USBD_LL_Transmit (pdev, CUSTOM_HID_EPIN_ADDR, (uint8_t *)hhid->InQueue[slot],
+                      hhid->InLength[slot]);
+  }
+
+  __set_PRIMASK(primask);
+}
+#endif
 /**
   * @}
   */
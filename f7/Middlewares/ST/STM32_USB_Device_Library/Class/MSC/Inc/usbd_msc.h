@@ -74,6 +74,12 @@
 #define MSC_MEDIA_PACKET             512U
 #endif /* MSC_MEDIA_PACKET */
 
+/* Number of MSC_MEDIA_PACKET data buffers: with 2 the media access of one
+   packet overlaps the USB transfer of the next one, 1 saves the RAM */
+#ifndef MSC_BOT_DATA_BUFFERS
+#define MSC_BOT_DATA_BUFFERS         2U
+#endif /* MSC_BOT_DATA_BUFFERS */
+
 #define MSC_MAX_FS_PACKET            0x40U
 #define MSC_MAX_HS_PACKET            0x200U
 
@@ -82,8 +88,12 @@
 #define USB_MSC_CONFIG_DESC_SIZ      32
 
 
+#ifndef MSC_EPIN_ADDR
 #define MSC_EPIN_ADDR                0x81U
+#endif /* MSC_EPIN_ADDR */
+#ifndef MSC_EPOUT_ADDR
 #define MSC_EPOUT_ADDR               0x01U
+#endif /* MSC_EPOUT_ADDR */
 
 /**
   * @}
@@ -113,7 +123,7 @@ typedef struct
   uint8_t                  bot_state;
   uint8_t                  bot_status;
   uint16_t                 bot_data_length;
-  uint8_t                  bot_data[MSC_MEDIA_PACKET];
+  uint8_t                  bot_data[MSC_MEDIA_PACKET * MSC_BOT_DATA_BUFFERS];
   USBD_MSC_BOT_CBWTypeDef  cbw;
   USBD_MSC_BOT_CSWTypeDef  csw;
 
@@ -126,6 +136,9 @@ typedef struct
 
   uint32_t                 scsi_blk_addr;
   uint32_t                 scsi_blk_len;
+
+  uint8_t                  bot_data_index;   /* Buffer of the current packet     */
+  uint16_t                 bot_data_ready;   /* Bytes read ahead into the buffer */
 }
 USBD_MSC_BOT_HandleTypeDef;
 
@@ -87,6 +87,8 @@
 /** @defgroup MSC_SCSI_Private_Macros
   * @{
   */
+#define MSC_BOT_DATA_BUFFER(__HMSC__, __INDEX__) \
+  (&(__HMSC__)->bot_data[(uint32_t)(__INDEX__) * MSC_MEDIA_PACKET])
 /**
   * @}
   */
@@ -119,6 +121,7 @@ static int8_t SCSI_CheckAddressRange (USBD_HandleTypeDef *pdev, uint8_t lun,
                                       uint32_t blk_offset, uint32_t blk_nbr);
 
 static int8_t SCSI_ProcessRead (USBD_HandleTypeDef *pdev, uint8_t lun);
+static int8_t SCSI_ReadMedia (USBD_HandleTypeDef *pdev, uint8_t lun);
 static int8_t SCSI_ProcessWrite (USBD_HandleTypeDef *pdev, uint8_t lun);
 /**
   * @}
@@ -520,6 +523,8 @@ static int8_t SCSI_Read10(USBD_HandleTypeDef *pdev, uint8_t lun, uint8_t *params
     hmsc->bot_state = USBD_BOT_DATA_IN;
     hmsc->scsi_blk_addr *= hmsc->scsi_blk_size;
     hmsc->scsi_blk_len  *= hmsc->scsi_blk_size;
+    hmsc->bot_data_index = 0U;
+    hmsc->bot_data_ready = 0U;
 
     /* cases 4,5 : Hi <> Dn */
     if (hmsc->cbw.dDataLength != hmsc->scsi_blk_len)
@@ -597,6 +602,7 @@ static int8_t SCSI_Write10 (USBD_HandleTypeDef  *pdev, uint8_t lun , uint8_t *pa
     len = (uint16_t)MIN(hmsc->scsi_blk_len, MSC_MEDIA_PACKET);
     /* Prepare EP to receive first data packet */
     hmsc->bot_state = USBD_BOT_DATA_OUT;
+    hmsc->bot_data_index = 0U;
     USBD_LL_PrepareReceive (pdev, MSC_EPOUT_ADDR, hmsc->bot_data, len);
   }
   else /* Write Process ongoing */
@@ -666,21 +672,21 @@ static int8_t SCSI_ProcessRead (USBD_HandleTypeDef  *pdev, uint8_t lun)
   USBD_MSC_BOT_HandleTypeDef *hmsc = (USBD_MSC_BOT_HandleTypeDef*)pdev->pClassData;
   uint16_t len;
 
-  len = (uint16_t)MIN(hmsc->scsi_blk_len, MSC_MEDIA_PACKET);
-
-  if( ((USBD_StorageTypeDef *)pdev->pUserData)->Read(lun,
-                              hmsc->bot_data,
-                              hmsc->scsi_blk_addr / hmsc->scsi_blk_size,
-                              len / hmsc->scsi_blk_size) < 0)
+  /* Packet not read ahead while the previous one was sent: read it now */
+  if (hmsc->bot_data_ready == 0U)
   {
-    SCSI_SenseCode(pdev, lun, HARDWARE_ERROR, UNRECOVERED_READ_ERROR);
-    return -1;
+    if (SCSI_ReadMedia(pdev, lun) < 0)
+    {
+      SCSI_SenseCode(pdev, lun, HARDWARE_ERROR, UNRECOVERED_READ_ERROR);
+      return -1;
+    }
   }
 
-  USBD_LL_Transmit (pdev, MSC_EPIN_ADDR, hmsc->bot_data, len);
+  len = hmsc->bot_data_ready;
+  hmsc->bot_data_ready = 0U;
 
-  hmsc->scsi_blk_addr += len;
-  hmsc->scsi_blk_len -= len;
+  USBD_LL_Transmit (pdev, MSC_EPIN_ADDR,
+                    MSC_BOT_DATA_BUFFER(hmsc, hmsc->bot_data_index), len);
 
   /* case 6 : Hi = Di */
   hmsc->csw.dDataResidue -= len;
@@ -689,6 +695,43 @@ static int8_t SCSI_ProcessRead (USBD_HandleTypeDef  *pdev, uint8_t lun)
   {
     hmsc->bot_state = USBD_BOT_LAST_DATA_IN;
   }
+#if (MSC_BOT_DATA_BUFFERS > 1U)
+  else
+  {
+    /* Read the next packet into the other buffer while this one is sent.
+       On failure the read is retried, and reported, on the next IN */
+    hmsc->bot_data_index ^= 1U;
+    (void)SCSI_ReadMedia(pdev, lun);
+  }
+#endif
+  return 0;
+}
+
+/**
+* @brief  SCSI_ReadMedia
+*         Read the next packet from the media into the current buffer
+* @param  lun: Logical unit number
+* @retval status
+*/
+static int8_t SCSI_ReadMedia (USBD_HandleTypeDef  *pdev, uint8_t lun)
+{
+  USBD_MSC_BOT_HandleTypeDef *hmsc = (USBD_MSC_BOT_HandleTypeDef*)pdev->pClassData;
+  uint16_t len;
+
+  len = (uint16_t)MIN(hmsc->scsi_blk_len, MSC_MEDIA_PACKET);
+
+  if( ((USBD_StorageTypeDef *)pdev->pUserData)->Read(lun,
+                              MSC_BOT_DATA_BUFFER(hmsc, hmsc->bot_data_index),
+                              hmsc->scsi_blk_addr / hmsc->scsi_blk_size,
+                              len / hmsc->scsi_blk_size) < 0)
+  {
+    return -1;
+  }
+
+  hmsc->scsi_blk_addr += len;
+  hmsc->scsi_blk_len -= len;
+  hmsc->bot_data_ready = len;
+
   return 0;
 }
 
@@ -702,11 +745,25 @@ static int8_t SCSI_ProcessRead (USBD_HandleTypeDef  *pdev, uint8_t lun)
 static int8_t SCSI_ProcessWrite (USBD_HandleTypeDef  *pdev, uint8_t lun)
 {
   USBD_MSC_BOT_HandleTypeDef *hmsc = (USBD_MSC_BOT_HandleTypeDef*) pdev->pClassData;
+  uint8_t *pbuf;
   uint16_t len;
 
   len = (uint16_t)MIN(hmsc->scsi_blk_len, MSC_MEDIA_PACKET);
+  pbuf = MSC_BOT_DATA_BUFFER(hmsc, hmsc->bot_data_index);
+
+#if (MSC_BOT_DATA_BUFFERS > 1U)
+  if (hmsc->scsi_blk_len > len)
+  {
+    /* Receive the next packet into the other buffer while this one is
+       written to the media */
+    hmsc->bot_data_index ^= 1U;
+    USBD_LL_PrepareReceive (pdev, MSC_EPOUT_ADDR,
+                            MSC_BOT_DATA_BUFFER(hmsc, hmsc->bot_data_index),
+                            (uint16_t)MIN(hmsc->scsi_blk_len - len, MSC_MEDIA_PACKET));
+  }
+#endif
 
-  if(((USBD_StorageTypeDef *)pdev->pUserData)->Write(lun, hmsc->bot_data,
+  if(((USBD_StorageTypeDef *)pdev->pUserData)->Write(lun, pbuf,
                              hmsc->scsi_blk_addr / hmsc->scsi_blk_size,
                              len / hmsc->scsi_blk_size) < 0)
   {
@@ -725,12 +782,14 @@ static int8_t SCSI_ProcessWrite (USBD_HandleTypeDef  *pdev, uint8_t lun)
   {
     MSC_BOT_SendCSW (pdev, USBD_CSW_CMD_PASSED);
   }
+#if (MSC_BOT_DATA_BUFFERS == 1U)
   else
   {
     len = (uint16_t)MIN(hmsc->scsi_blk_len , MSC_MEDIA_PACKET);
     /* Prepare EP to Receive next packet */
     USBD_LL_PrepareReceive (pdev, MSC_EPOUT_ADDR, hmsc->bot_data, len);
   }
+#endif
 
   return 0;
 }
@@ -47,10 +47,17 @@
   - "stm32xxxxx_{eval}{discovery}{nucleo_144}.c"
   - "stm32xxxxx_{eval}{discovery}_io.c"
   - "stm32xxxxx_{eval}{discovery}{adafruit}_sd.c"
+  - "blk_cache.c", "blk_sd.c" when USBD_MSC_USE_BLK_CACHE is defined
   EndBSPDependencies */
 
 /* Includes ------------------------------------------------------------------*/
 #include "usbd_msc_storage_template.h"
+#if defined(USBD_MSC_USE_BLK_CACHE)
+/* Define USBD_MSC_USE_BLK_CACHE in usbd_conf.h to access the SD card through
+   the shared sector cache; the application then calls BLK_Cache_Process()
+   periodically and BLK_Cache_Flush() before the card is removed */
+#include "blk_sd.h"
+#endif
 
 
 /* Private typedef -----------------------------------------------------------*/
@@ -126,7 +133,11 @@ USBD_StorageTypeDef USBD_MSC_Template_fops =
 *******************************************************************************/
 int8_t STORAGE_Init (uint8_t lun)
 {
+#if defined(USBD_MSC_USE_BLK_CACHE)
+  return BLK_Cache_Init(&BLK_SD_Device);
+#else
   return (0);
+#endif
 }
 
 /*******************************************************************************
@@ -138,7 +149,11 @@ int8_t STORAGE_Init (uint8_t lun)
 *******************************************************************************/
 int8_t STORAGE_GetCapacity (uint8_t lun, uint32_t *block_num, uint16_t *block_size)
 {
+#if defined(USBD_MSC_USE_BLK_CACHE)
+  *block_num  = BLK_Cache_GetBlockNbr();
+#else
   *block_num  = STORAGE_BLK_NBR;
+#endif
   *block_size = STORAGE_BLK_SIZ;
   return (0);
 }
@@ -179,7 +194,11 @@ int8_t STORAGE_Read (uint8_t lun,
                  uint32_t blk_addr,
                  uint16_t blk_len)
 {
+#if defined(USBD_MSC_USE_BLK_CACHE)
+  return BLK_Cache_Read(buf, blk_addr, blk_len);
+#else
   return 0;
+#endif
 }
 /*******************************************************************************
 * Function Name  : Write_Memory
@@ -193,7 +212,11 @@ int8_t STORAGE_Write (uint8_t lun,
                   uint32_t blk_addr,
                   uint16_t blk_len)
 {
+#if defined(USBD_MSC_USE_BLK_CACHE)
+  return BLK_Cache_Write(buf, blk_addr, blk_len);
+#else
   return (0);
+#endif
 }
 /*******************************************************************************
 * Function Name  : Write_Memory
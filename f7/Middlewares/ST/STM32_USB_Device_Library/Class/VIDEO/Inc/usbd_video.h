@@ -0,0 +1,299 @@
+/**
+  ******************************************************************************
+  * @file    usbd_video.h
+  * @author  MCD Application Team
+  * @brief   header file for the usbd_video.c file.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics International N.V.
+  * All rights reserved.</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without
+  * modification, are permitted, provided that the following conditions are met:
+  *
+  * 1. Redistribution of source code must retain the above copyright notice,
+  *    this list of conditions and the following disclaimer.
+  * 2. Redistributions in binary form must reproduce the above copyright notice,
+  *    this list of conditions and the following disclaimer in the documentation
+  *    and/or other materials provided with the distribution.
+  * 3. Neither the name of STMicroelectronics nor the names of other
+  *    contributors to this software may be used to endorse or promote products
+  *    derived from this software without specific written permission.
+  * 4. This software, including modifications and/or derivative works of this
+  *    software, must execute solely and exclusively on microcontroller or
+  *    microprocessor devices manufactured by or for STMicroelectronics.
+  * 5. Redistribution and use of this software other than as permitted under
+  *    this license is void and will automatically terminate your rights under
+  *    this license.
+  *
+  * THIS SOFTWARE IS PROVIDED BY STMICROELECTRONICS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS, IMPLIED OR STATUTORY WARRANTIES, INCLUDING, BUT NOT
+  * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+  * PARTICULAR PURPOSE AND NON-INFRINGEMENT OF THIRD PARTY INTELLECTUAL PROPERTY
+  * RIGHTS ARE DISCLAIMED TO THE FULLEST EXTENT PERMITTED BY LAW. IN NO EVENT
+  * SHALL STMICROELECTRONICS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+  * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+  * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __USB_VIDEO_H
+#define __USB_VIDEO_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include  "usbd_ioreq.h"
+
+/** @addtogroup STM32_USB_DEVICE_LIBRARY
+  * @{
+  */
+
+/** @defgroup USBD_VIDEO
+  * @brief This file is the Header file for usbd_video.c
+  * @{
+  */
+
+
+/** @defgroup USBD_VIDEO_Exported_Defines
+  * @{
+  */
+/* Set to 1U in usbd_conf.h to stream on a bulk endpoint: uncompressed VGA
+   at full frame rate needs more than one isochronous packet per microframe */
+#ifndef USBD_VIDEO_BULK
+#define USBD_VIDEO_BULK                               0U
+#endif /* USBD_VIDEO_BULK */
+
+/* Frame of both formats */
+#ifndef USBD_VIDEO_WIDTH
+#define USBD_VIDEO_WIDTH                              640U
+#endif /* USBD_VIDEO_WIDTH */
+#ifndef USBD_VIDEO_HEIGHT
+#define USBD_VIDEO_HEIGHT                             480U
+#endif /* USBD_VIDEO_HEIGHT */
+#ifndef USBD_VIDEO_FPS
+#define USBD_VIDEO_FPS                                30U
+#endif /* USBD_VIDEO_FPS */
+
+/* Largest MJPEG frame, in bytes */
+#ifndef USBD_VIDEO_MJPEG_MAX_FRAME
+#define USBD_VIDEO_MJPEG_MAX_FRAME                    (USBD_VIDEO_WIDTH * USBD_VIDEO_HEIGHT)
+#endif /* USBD_VIDEO_MJPEG_MAX_FRAME */
+
+/* Uncompressed format: YUY2 by default, 16 bits per pixel */
+#ifndef USBD_VIDEO_UNCOMPRESSED_GUID
+#define USBD_VIDEO_UNCOMPRESSED_GUID                  'Y', 'U', 'Y', '2', 0x00, 0x00, 0x10, 0x00, \
+                                                      0x80, 0x00, 0x00, 0xAA, 0x00, 0x38, 0x9B, 0x71
+#endif /* USBD_VIDEO_UNCOMPRESSED_GUID */
+#ifndef USBD_VIDEO_UNCOMPRESSED_BPP
+#define USBD_VIDEO_UNCOMPRESSED_BPP                   16U
+#endif /* USBD_VIDEO_UNCOMPRESSED_BPP */
+
+/* Bulk payload transfer, header included: a multiple of 4 */
+#ifndef USBD_VIDEO_BULK_PAYLOAD
+#define USBD_VIDEO_BULK_PAYLOAD                       16384U
+#endif /* USBD_VIDEO_BULK_PAYLOAD */
+
+/* Chunks queued by USBD_VIDEO_Submit() */
+#ifndef USBD_VIDEO_MAX_CHUNKS
+#define USBD_VIDEO_MAX_CHUNKS                         16U
+#endif /* USBD_VIDEO_MAX_CHUNKS */
+
+#ifndef VIDEO_IN_EP
+#define VIDEO_IN_EP                                   0x81U
+#endif /* VIDEO_IN_EP */
+
+/* Endpoint packet sizes: multiples of 4 so that the payload headers written
+   in place stay word aligned */
+#if (USBD_VIDEO_BULK == 1U)
+#define VIDEO_HS_MAX_PACKET                           512U
+#define VIDEO_FS_MAX_PACKET                           64U
+#else
+#define VIDEO_HS_MAX_PACKET                           1024U
+#define VIDEO_FS_MAX_PACKET                           1020U
+#endif /* USBD_VIDEO_BULK */
+
+/* Payload header: bHeaderLength, bmHeaderInfo and the PTS and SCR fields,
+   left out */
+#define USBD_VIDEO_HEADER_SIZE                        12U
+
+/* Chunk flags */
+#define USBD_VIDEO_CHUNK_EOF                          0x01U  /* Last chunk of the frame */
+#define USBD_VIDEO_CHUNK_HEADROOM                     0x02U  /* USBD_VIDEO_HEADER_SIZE free bytes before the data */
+
+/* Formats and frames */
+#define VIDEO_FORMAT_MJPEG                            0x01U
+#define VIDEO_FORMAT_UNCOMPRESSED                     0x02U
+#define VIDEO_FRAME_INDEX                             0x01U
+
+#define VIDEO_FRAME_INTERVAL                          (10000000U / USBD_VIDEO_FPS)
+#define VIDEO_UNCOMPRESSED_FRAME_SIZE                 ((USBD_VIDEO_WIDTH * USBD_VIDEO_HEIGHT * USBD_VIDEO_UNCOMPRESSED_BPP) / 8U)
+
+#if (USBD_VIDEO_BULK == 1U)
+#define USB_VIDEO_CONFIG_DESC_SIZ                     195U
+#else
+#define USB_VIDEO_CONFIG_DESC_SIZ                     204U
+#endif /* USBD_VIDEO_BULK */
+#define VIDEO_VC_DESC_SIZ                             40U
+#define VIDEO_VS_DESC_SIZ                             113U
+
+/* Entities of the video function */
+#define VIDEO_CAMERA_TERMINAL_ID                      0x01U
+#define VIDEO_OUTPUT_TERMINAL_ID                      0x02U
+
+/*---------------------------------------------------------------------*/
+/*  USB Video Class definitions                                        */
+/*---------------------------------------------------------------------*/
+#define VIDEO_CLASS                                   0x0EU
+#define VIDEO_SUBCLASS_VIDEOCONTROL                   0x01U
+#define VIDEO_SUBCLASS_VIDEOSTREAMING                 0x02U
+#define VIDEO_SUBCLASS_COLLECTION                     0x03U
+
+#define VIDEO_CS_INTERFACE                            0x24U
+
+#define VIDEO_VC_HEADER                               0x01U
+#define VIDEO_VC_INPUT_TERMINAL                       0x02U
+#define VIDEO_VC_OUTPUT_TERMINAL                      0x03U
+#define VIDEO_VS_INPUT_HEADER                         0x01U
+#define VIDEO_VS_FORMAT_UNCOMPRESSED                  0x04U
+#define VIDEO_VS_FRAME_UNCOMPRESSED                   0x05U
+#define VIDEO_VS_FORMAT_MJPEG                         0x06U
+#define VIDEO_VS_FRAME_MJPEG                          0x07U
+
+#define VIDEO_SET_CUR                                 0x01U
+#define VIDEO_GET_CUR                                 0x81U
+#define VIDEO_GET_MIN                                 0x82U
+#define VIDEO_GET_MAX                                 0x83U
+#define VIDEO_GET_RES                                 0x84U
+#define VIDEO_GET_LEN                                 0x85U
+#define VIDEO_GET_INFO                                0x86U
+#define VIDEO_GET_DEF                                 0x87U
+
+#define VIDEO_VS_PROBE_CONTROL                        0x01U
+#define VIDEO_VS_COMMIT_CONTROL                       0x02U
+
+/* Video probe and commit controls, UVC 1.0 */
+#define VIDEO_PROBE_SIZE                              26U
+
+/* Payload header bmHeaderInfo */
+#define VIDEO_HEADER_FID                              0x01U
+#define VIDEO_HEADER_EOF                              0x02U
+#define VIDEO_HEADER_EOH                              0x80U
+
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_CORE_Exported_TypesDefinitions
+  * @{
+  */
+
+/**
+  * @}
+  */
+typedef struct _USBD_VIDEO_Itf
+{
+  int8_t (* Init)          (void);
+  int8_t (* DeInit)        (void);
+  int8_t (* Start)         (uint8_t FormatIndex, uint8_t FrameIndex);
+  int8_t (* Stop)          (void);
+  int8_t (* ChunkDone)     (uint8_t *pData, uint32_t Length);   /* Chunk sent, back to the application */
+
+}USBD_VIDEO_ItfTypeDef;
+
+
+typedef struct
+{
+  uint8_t  *pData;
+  uint32_t Length;
+  uint32_t Flags;                                       /* USBD_VIDEO_CHUNK_xxx */
+} USBD_VIDEO_ChunkTypeDef;
+
+
+typedef struct
+{
+  uint32_t data[12];                                    /* Class requests, force 32bits alignment */
+  uint8_t  Probe[VIDEO_PROBE_SIZE];
+  uint8_t  CmdSelector;                                 /* SET_CUR pending on EP0 */
+  uint8_t  alt_setting;
+  uint8_t  Streaming;
+  uint8_t  Fid;                                         /* Frame identifier, toggled at each frame */
+  uint32_t MaxPayload;                                  /* Payload transfer at the current speed, header included */
+
+  /* Chunks queued, sent from Tail to Head */
+  USBD_VIDEO_ChunkTypeDef Chunks[USBD_VIDEO_MAX_CHUNKS];
+  __IO uint32_t Head;
+  __IO uint32_t Tail;
+  uint32_t Offset;                                      /* Bytes of the Tail chunk sent */
+  uint8_t  *pTx;                                        /* Payload in flight */
+  uint32_t TxSize;                                      /* Its size, header included */
+  uint32_t TxData;                                      /* Its bytes of the chunk */
+  __IO uint32_t TxState;
+
+  /* Statistics */
+  uint32_t Frames;
+  uint32_t Payloads;
+  uint32_t Staged;                                      /* Payloads copied, no headroom */
+  uint32_t Retries;                                     /* Isochronous payloads sent again */
+
+  /* First payload of a chunk without headroom */
+  uint32_t Stage[VIDEO_HS_MAX_PACKET / 4U];
+}
+USBD_VIDEO_HandleTypeDef;
+
+
+
+/** @defgroup USBD_CORE_Exported_Macros
+  * @{
+  */
+
+/**
+  * @}
+  */
+
+/** @defgroup USBD_CORE_Exported_Variables
+  * @{
+  */
+
+extern USBD_ClassTypeDef  USBD_VIDEO;
+#define USBD_VIDEO_CLASS    &USBD_VIDEO
+/**
+  * @}
+  */
+
+/** @defgroup USB_CORE_Exported_Functions
+  * @{
+  */
+uint8_t  USBD_VIDEO_RegisterInterface  (USBD_HandleTypeDef   *pdev,
+                                        USBD_VIDEO_ItfTypeDef *fops);
+
+uint8_t  USBD_VIDEO_Submit             (USBD_HandleTypeDef *pdev, uint8_t *pData,
+                                        uint32_t Length, uint32_t Flags);
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __USB_VIDEO_H */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,1485 @@
+/**
+  ******************************************************************************
+  * @file    usbd_video.c
+  * @author  MCD Application Team
+  * @brief   This file provides the Video core functions.
+  *
+  *  @verbatim
+  *
+  *          ===================================================================
+  *                                VIDEO Class Description
+  *          ===================================================================
+  *           This driver manages the "USB Device Class Definition for Video
+  *           Devices Revision 1.0" for a camera:
+  *             - Interface association, camera and streaming terminals
+  *             - MJPEG and uncompressed formats, one frame each of
+  *               USBD_VIDEO_WIDTH x USBD_VIDEO_HEIGHT at USBD_VIDEO_FPS
+  *             - Probe and commit controls
+  *             - Isochronous streaming in the operational setting of the
+  *               streaming interface, one payload per (micro)frame, or bulk
+  *               streaming from the commit when USBD_VIDEO_BULK is 1
+  *
+  *           Zero copy:
+  *             The application queues its capture buffers (DCMI blocks, JPEG
+  *             codec output buffers) with USBD_VIDEO_Submit() and gets each
+  *             one back with the interface ChunkDone() once sent. Payloads
+  *             are sent in place: the 12-byte header of each one is written
+  *             over the bytes of the chunk already sent, or in the headroom
+  *             of the chunk for its first payload; without headroom the first
+  *             payload is copied to a stage buffer. The frame identifier
+  *             toggles and the end of frame bit is set from the chunk flags.
+  *
+  *           The chunks and the class data from USBD_malloc() must be in
+  *           memory the USB DMA reaches and, on a Cortex-M7 with the D-cache
+  *           enabled, outside of the cacheable regions. USBD_VIDEO_Submit()
+  *           is called at the priority of the USB interrupt or from a context
+  *           it preempts.
+  *
+  *           The device descriptor uses the IAD class codes (0xEF, 0x02,
+  *           0x01).
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics International N.V.
+  * All rights reserved.</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without
+  * modification, are permitted, provided that the following conditions are met:
+  *
+  * 1. Redistribution of source code must retain the above copyright notice,
+  *    this list of conditions and the following disclaimer.
+  * 2. Redistributions in binary form must reproduce the above copyright notice,
+  *    this list of conditions and the following disclaimer in the documentation
+  *    and/or other materials provided with the distribution.
+  * 3. Neither the name of STMicroelectronics nor the names of other
+  *    contributors to this software may be used to endorse or promote products
+  *    derived from this software without specific written permission.
+  * 4. This software, including modifications and/or derivative works of this
+  *    software, must execute solely and exclusively on microcontroller or
+  *    microprocessor devices manufactured by or for STMicroelectronics.
+  * 5. Redistribution and use of this software other than as permitted under
+  *    this license is void and will automatically terminate your rights under
+  *    this license.
+  *
+  * THIS SOFTWARE IS PROVIDED BY STMICROELECTRONICS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS, IMPLIED OR STATUTORY WARRANTIES, INCLUDING, BUT NOT
+  * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+  * PARTICULAR PURPOSE AND NON-INFRINGEMENT OF THIRD PARTY INTELLECTUAL PROPERTY
+  * RIGHTS ARE DISCLAIMED TO THE FULLEST EXTENT PERMITTED BY LAW. IN NO EVENT
+  * SHALL STMICROELECTRONICS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+  * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+  * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+  /* BSPDependencies
+  - "stm32xxxxx_{eval}{discovery}.c"
+  - "stm32xxxxx_{eval}{discovery}_camera.c"
+  EndBSPDependencies */
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbd_video.h"
+#include "usbd_ctlreq.h"
+
+
+/** @addtogroup STM32_USB_DEVICE_LIBRARY
+  * @{
+  */
+
+
+/** @defgroup USBD_VIDEO
+  * @brief usbd core module
+  * @{
+  */
+
+/** @defgroup USBD_VIDEO_Private_TypesDefinitions
+  * @{
+  */
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_VIDEO_Private_Defines
+  * @{
+  */
+#ifndef USBD_memcpy
+#include <string.h>
+#define USBD_memcpy                 memcpy
+#endif /* USBD_memcpy */
+
+#define VIDEO_VC_ITF                0x00U
+#define VIDEO_VS_ITF                0x01U
+
+#if (USBD_VIDEO_BULK == 1U)
+#define VIDEO_EP_ATTRIBUTES         0x02U         /* Bulk */
+#define VIDEO_EP_BINTERVAL          0x00U
+#else
+#define VIDEO_EP_ATTRIBUTES         0x05U         /* Isochronous, asynchronous */
+#define VIDEO_EP_BINTERVAL          0x01U         /* Every (micro)frame */
+#endif /* USBD_VIDEO_BULK */
+
+#define VIDEO_TX_IDLE               0x00U
+#define VIDEO_TX_PAYLOAD            0x01U
+#define VIDEO_TX_ZLP                0x02U
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_VIDEO_Private_Macros
+  * @{
+  */
+#define VIDEO_LE32(__X__)           (uint8_t)(__X__), (uint8_t)((__X__) >> 8), \
+                                    (uint8_t)((__X__) >> 16), (uint8_t)((__X__) >> 24)
+
+#define VIDEO_MAX_PACKET(__PDEV__)  (((__PDEV__)->dev_speed == USBD_SPEED_HIGH) ? \
+                                     VIDEO_HS_MAX_PACKET : VIDEO_FS_MAX_PACKET)
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_VIDEO_Private_FunctionPrototypes
+  * @{
+  */
+
+
+static uint8_t  USBD_VIDEO_Init (USBD_HandleTypeDef *pdev,
+                                 uint8_t cfgidx);
+
+static uint8_t  USBD_VIDEO_DeInit (USBD_HandleTypeDef *pdev,
+                                   uint8_t cfgidx);
+
+static uint8_t  USBD_VIDEO_Setup (USBD_HandleTypeDef *pdev,
+                                  USBD_SetupReqTypedef *req);
+
+static uint8_t  USBD_VIDEO_DataIn (USBD_HandleTypeDef *pdev,
+                                   uint8_t epnum);
+
+static uint8_t  USBD_VIDEO_EP0_RxReady (USBD_HandleTypeDef *pdev);
+
+static uint8_t  USBD_VIDEO_IsoINIncomplete (USBD_HandleTypeDef *pdev,
+                                            uint8_t epnum);
+
+static uint8_t  *USBD_VIDEO_GetFSCfgDesc (uint16_t *length);
+
+static uint8_t  *USBD_VIDEO_GetHSCfgDesc (uint16_t *length);
+
+static uint8_t  *USBD_VIDEO_GetOtherSpeedCfgDesc (uint16_t *length);
+
+uint8_t  *USBD_VIDEO_GetDeviceQualifierDescriptor (uint16_t *length);
+
+static void     USBD_VIDEO_StreamingRequest (USBD_HandleTypeDef *pdev,
+                                             USBD_SetupReqTypedef *req);
+
+static void     USBD_VIDEO_SetProbe (USBD_HandleTypeDef *pdev, uint8_t format);
+
+static void     USBD_VIDEO_Start (USBD_HandleTypeDef *pdev);
+
+static void     USBD_VIDEO_Stop (USBD_HandleTypeDef *pdev);
+
+static void     USBD_VIDEO_Kick (USBD_HandleTypeDef *pdev);
+
+static void     USBD_VIDEO_Put32 (uint8_t *pbuf, uint32_t value);
+
+/* USB Standard Device Descriptor */
+__ALIGN_BEGIN static uint8_t USBD_VIDEO_DeviceQualifierDesc[USB_LEN_DEV_QUALIFIER_DESC] __ALIGN_END =
+{
+  USB_LEN_DEV_QUALIFIER_DESC,
+  USB_DESC_TYPE_DEVICE_QUALIFIER,
+  0x00,
+  0x02,
+  0x00,
+  0x00,
+  0x00,
+  0x40,
+  0x01,
+  0x00,
+};
+
+/**
+  * @}
+  */
+
+/** @defgroup USBD_VIDEO_Private_Variables
+  * @{
+  */
+
+
+/* VIDEO interface class callbacks structure */
+USBD_ClassTypeDef  USBD_VIDEO =
+{
+  USBD_VIDEO_Init,
+  USBD_VIDEO_DeInit,
+  USBD_VIDEO_Setup,
+  NULL,                 /* EP0_TxSent, */
+  USBD_VIDEO_EP0_RxReady,
+  USBD_VIDEO_DataIn,
+  NULL,
+  NULL,
+  USBD_VIDEO_IsoINIncomplete,
+  NULL,
+  USBD_VIDEO_GetHSCfgDesc,
+  USBD_VIDEO_GetFSCfgDesc,
+  USBD_VIDEO_GetOtherSpeedCfgDesc,
+  USBD_VIDEO_GetDeviceQualifierDescriptor,
+};
+
+/* USB VIDEO device Configuration Descriptor */
+__ALIGN_BEGIN static uint8_t USBD_VIDEO_CfgHSDesc[USB_VIDEO_CONFIG_DESC_SIZ] __ALIGN_END =
+{
+  /* Configuration 1 */
+  0x09,                                 /* bLength */
+  USB_DESC_TYPE_CONFIGURATION,   /* bDescriptorType */
+  LOBYTE(USB_VIDEO_CONFIG_DESC_SIZ),    /* wTotalLength */
+  HIBYTE(USB_VIDEO_CONFIG_DESC_SIZ),
+  0x02,                                 /* bNumInterfaces */
+  0x01,                                 /* bConfigurationValue */
+  0x00,                                 /* iConfiguration */
+  0xC0,                                 /* bmAttributes: self powered */
+  0x32,                                 /* MaxPower 100 mA */
+  /* 09 byte*/
+
+  /* Interface Association Descriptor */
+  0x08,                                 /* bLength */
+  0x0B,                                 /* bDescriptorType: IAD */
+  0x00,                                 /* bFirstInterface */
+  0x02,                                 /* bInterfaceCount */
+  VIDEO_CLASS,                          /* bFunctionClass */
+  VIDEO_SUBCLASS_COLLECTION,            /* bFunctionSubClass */
+  0x00,                                 /* bFunctionProtocol */
+  0x00,                                 /* iFunction */
+  /* 08 byte*/
+
+  /* Standard VC Interface Descriptor */
+  0x09,                                 /* bLength */
+  USB_DESC_TYPE_INTERFACE,              /* bDescriptorType */
+  0x00,                                 /* bInterfaceNumber */
+  0x00,                                 /* bAlternateSetting */
+  0x00,                                 /* bNumEndpoints */
+  VIDEO_CLASS,                          /* bInterfaceClass */
+  VIDEO_SUBCLASS_VIDEOCONTROL,          /* bInterfaceSubClass */
+  0x00,                                 /* bInterfaceProtocol */
+  0x00,                                 /* iInterface */
+  /* 09 byte*/
+
+  /* Class-specific VC Interface Header Descriptor */
+  0x0D,                                 /* bLength */
+  VIDEO_CS_INTERFACE,                   /* bDescriptorType */
+  VIDEO_VC_HEADER,                      /* bDescriptorSubtype */
+  0x00,                                 /* bcdUVC: 1.00 */
+  0x01,
+  LOBYTE(VIDEO_VC_DESC_SIZ),            /* wTotalLength */
+  HIBYTE(VIDEO_VC_DESC_SIZ),
+  VIDEO_LE32(48000000U),                /* dwClockFrequency: unused, no PTS nor SCR */
+  0x01,                                 /* bInCollection */
+  0x01,                                 /* baInterfaceNr(1) */
+  /* 13 byte*/
+
+  /* Camera Terminal Descriptor */
+  0x12,                                 /* bLength */
+  VIDEO_CS_INTERFACE,                   /* bDescriptorType */
+  VIDEO_VC_INPUT_TERMINAL,              /* bDescriptorSubtype */
+  VIDEO_CAMERA_TERMINAL_ID,             /* bTerminalID */
+  0x01,                                 /* wTerminalType: ITT_CAMERA */
+  0x02,
+  0x00,                                 /* bAssocTerminal */
+  0x00,                                 /* iTerminal */
+  0x00,                                 /* wObjectiveFocalLengthMin */
+  0x00,
+  0x00,                                 /* wObjectiveFocalLengthMax */
+  0x00,
+  0x00,                                 /* wOcularFocalLength */
+  0x00,
+  0x03,                                 /* bControlSize */
+  0x00,                                 /* bmControls: none */
+  0x00,
+  0x00,
+  /* 18 byte*/
+
+  /* Output Terminal Descriptor */
+  0x09,                                 /* bLength */
+  VIDEO_CS_INTERFACE,                   /* bDescriptorType */
+  VIDEO_VC_OUTPUT_TERMINAL,             /* bDescriptorSubtype */
+  VIDEO_OUTPUT_TERMINAL_ID,             /* bTerminalID */
+  0x01,                                 /* wTerminalType: TT_STREAMING */
+  0x01,
+  0x00,                                 /* bAssocTerminal */
+  VIDEO_CAMERA_TERMINAL_ID,             /* bSourceID */
+  0x00,                                 /* iTerminal */
+  /* 09 byte*/
+
+  /* Standard VS Interface Descriptor - Zero Bandwidth (isochronous) or Operational (bulk) */
+  0x09,                                 /* bLength */
+  USB_DESC_TYPE_INTERFACE,              /* bDescriptorType */
+  0x01,                                 /* bInterfaceNumber */
+  0x00,                                 /* bAlternateSetting */
+  USBD_VIDEO_BULK,                      /* bNumEndpoints */
+  VIDEO_CLASS,                          /* bInterfaceClass */
+  VIDEO_SUBCLASS_VIDEOSTREAMING,        /* bInterfaceSubClass */
+  0x00,                                 /* bInterfaceProtocol */
+  0x00,                                 /* iInterface */
+  /* 09 byte*/
+
+  /* Class-specific VS Input Header Descriptor */
+  0x0F,                                 /* bLength */
+  VIDEO_CS_INTERFACE,                   /* bDescriptorType */
+  VIDEO_VS_INPUT_HEADER,                /* bDescriptorSubtype */
+  0x02,                                 /* bNumFormats */
+  LOBYTE(VIDEO_VS_DESC_SIZ),            /* wTotalLength */
+  HIBYTE(VIDEO_VS_DESC_SIZ),
+  VIDEO_IN_EP,                          /* bEndpointAddress */
+  0x00,                                 /* bmInfo */
+  VIDEO_OUTPUT_TERMINAL_ID,             /* bTerminalLink */
+  0x00,                                 /* bStillCaptureMethod */
+  0x00,                                 /* bTriggerSupport */
+  0x00,                                 /* bTriggerUsage */
+  0x01,                                 /* bControlSize */
+  0x00,                                 /* bmaControls(1) */
+  0x00,                                 /* bmaControls(2) */
+  /* 15 byte*/
+
+  /* MJPEG Format Descriptor */
+  0x0B,                                 /* bLength */
+  VIDEO_CS_INTERFACE,                   /* bDescriptorType */
+  VIDEO_VS_FORMAT_MJPEG,                /* bDescriptorSubtype */
+  VIDEO_FORMAT_MJPEG,                   /* bFormatIndex */
+  0x01,                                 /* bNumFrameDescriptors */
+  0x01,                                 /* bmFlags: fixed size samples */
+  VIDEO_FRAME_INDEX,                    /* bDefaultFrameIndex */
+  0x00,                                 /* bAspectRatioX */
+  0x00,                                 /* bAspectRatioY */
+  0x00,                                 /* bmInterlaceFlags */
+  0x00,                                 /* bCopyProtect */
+  /* 11 byte*/
+
+  /* MJPEG Frame Descriptor */
+  0x1E,                                 /* bLength */
+  VIDEO_CS_INTERFACE,                   /* bDescriptorType */
+  VIDEO_VS_FRAME_MJPEG       ,          /* bDescriptorSubtype */
+  VIDEO_FRAME_INDEX,                    /* bFrameIndex */
+  0x00,                                 /* bmCapabilities */
+  LOBYTE(USBD_VIDEO_WIDTH),             /* wWidth */
+  HIBYTE(USBD_VIDEO_WIDTH),
+  LOBYTE(USBD_VIDEO_HEIGHT),            /* wHeight */
+  HIBYTE(USBD_VIDEO_HEIGHT),
+  VIDEO_LE32(USBD_VIDEO_MJPEG_MAX_FRAME * 8U * USBD_VIDEO_FPS),  /* dwMinBitRate */
+  VIDEO_LE32(USBD_VIDEO_MJPEG_MAX_FRAME * 8U * USBD_VIDEO_FPS),  /* dwMaxBitRate */
+  VIDEO_LE32(USBD_VIDEO_MJPEG_MAX_FRAME),  /* dwMaxVideoFrameBufferSize */
+  VIDEO_LE32(VIDEO_FRAME_INTERVAL),     /* dwDefaultFrameInterval */
+  0x01,                                 /* bFrameIntervalType: one discrete interval */
+  VIDEO_LE32(VIDEO_FRAME_INTERVAL),     /* dwFrameInterval */
+  /* 30 byte*/
+
+  /* Uncompressed Format Descriptor */
+  0x1B,                                 /* bLength */
+  VIDEO_CS_INTERFACE,                   /* bDescriptorType */
+  VIDEO_VS_FORMAT_UNCOMPRESSED,         /* bDescriptorSubtype */
+  VIDEO_FORMAT_UNCOMPRESSED,            /* bFormatIndex */
+  0x01,                                 /* bNumFrameDescriptors */
+  USBD_VIDEO_UNCOMPRESSED_GUID,         /* guidFormat */
+  USBD_VIDEO_UNCOMPRESSED_BPP,          /* bBitsPerPixel */
+  VIDEO_FRAME_INDEX,                    /* bDefaultFrameIndex */
+  0x00,                                 /* bAspectRatioX */
+  0x00,                                 /* bAspectRatioY */
+  0x00,                                 /* bmInterlaceFlags */
+  0x00,                                 /* bCopyProtect */
+  /* 27 byte*/
+
+  /* Uncompressed Frame Descriptor */
+  0x1E,                                 /* bLength */
+  VIDEO_CS_INTERFACE,                   /* bDescriptorType */
+  VIDEO_VS_FRAME_UNCOMPRESSED,          /* bDescriptorSubtype */
+  VIDEO_FRAME_INDEX,                    /* bFrameIndex */
+  0x00,                                 /* bmCapabilities */
+  LOBYTE(USBD_VIDEO_WIDTH),             /* wWidth */
+  HIBYTE(USBD_VIDEO_WIDTH),
+  LOBYTE(USBD_VIDEO_HEIGHT),            /* wHeight */
+  HIBYTE(USBD_VIDEO_HEIGHT),
+  VIDEO_LE32(VIDEO_UNCOMPRESSED_FRAME_SIZE * 8U * USBD_VIDEO_FPS),  /* dwMinBitRate */
+  VIDEO_LE32(VIDEO_UNCOMPRESSED_FRAME_SIZE * 8U * USBD_VIDEO_FPS),  /* dwMaxBitRate */
+  VIDEO_LE32(VIDEO_UNCOMPRESSED_FRAME_SIZE),  /* dwMaxVideoFrameBufferSize */
+  VIDEO_LE32(VIDEO_FRAME_INTERVAL),     /* dwDefaultFrameInterval */
+  0x01,                                 /* bFrameIntervalType: one discrete interval */
+  VIDEO_LE32(VIDEO_FRAME_INTERVAL),     /* dwFrameInterval */
+  /* 30 byte*/
+
+#if (USBD_VIDEO_BULK == 0U)
+  /* Standard VS Interface Descriptor - Operational */
+  0x09,                                 /* bLength */
+  USB_DESC_TYPE_INTERFACE,              /* bDescriptorType */
+  0x01,                                 /* bInterfaceNumber */
+  0x01,                                 /* bAlternateSetting */
+  0x01,                                 /* bNumEndpoints */
+  VIDEO_CLASS,                          /* bInterfaceClass */
+  VIDEO_SUBCLASS_VIDEOSTREAMING,        /* bInterfaceSubClass */
+  0x00,                                 /* bInterfaceProtocol */
+  0x00,                                 /* iInterface */
+  /* 09 byte*/
+#endif /* USBD_VIDEO_BULK */
+
+  /* Endpoint Descriptor */
+  0x07,                                 /* bLength */
+  USB_DESC_TYPE_ENDPOINT,               /* bDescriptorType */
+  VIDEO_IN_EP,                          /* bEndpointAddress */
+  VIDEO_EP_ATTRIBUTES,                  /* bmAttributes */
+  LOBYTE(VIDEO_HS_MAX_PACKET),         /* wMaxPacketSize */
+  HIBYTE(VIDEO_HS_MAX_PACKET),
+  VIDEO_EP_BINTERVAL,                   /* bInterval */
+  /* 07 byte*/
+};
+
+/* USB VIDEO device Configuration Descriptor */
+__ALIGN_BEGIN static uint8_t USBD_VIDEO_CfgFSDesc[USB_VIDEO_CONFIG_DESC_SIZ] __ALIGN_END =
+{
+  /* Configuration 1 */
+  0x09,                                 /* bLength */
+  USB_DESC_TYPE_CONFIGURATION,   /* bDescriptorType */
+  LOBYTE(USB_VIDEO_CONFIG_DESC_SIZ),    /* wTotalLength */
+  HIBYTE(USB_VIDEO_CONFIG_DESC_SIZ),
+  0x02,                                 /* bNumInterfaces */
+  0x01,                                 /* bConfigurationValue */
+  0x00,                                 /* iConfiguration */
+  0xC0,                                 /* bmAttributes: self powered */
+  0x32,                                 /* MaxPower 100 mA */
+  /* 09 byte*/
+
+  /* Interface Association Descriptor */
+  0x08,                                 /* bLength */
+  0x0B,                                 /* bDescriptorType: IAD */
+  0x00,                                 /* bFirstInterface */
+  0x02,                                 /* bInterfaceCount */
+  VIDEO_CLASS,                          /* bFunctionClass */
+  VIDEO_SUBCLASS_COLLECTION,            /* bFunctionSubClass */
+  0x00,                                 /* bFunctionProtocol */
+  0x00,                                 /* iFunction */
+  /* 08 byte*/
+
+  /* Standard VC Interface Descriptor */
+  0x09,                                 /* bLength */
+  USB_DESC_TYPE_INTERFACE,              /* bDescriptorType */
+  0x00,                                 /* bInterfaceNumber */
+  0x00,                                 /* bAlternateSetting */
+  0x00,                                 /* bNumEndpoints */
+  VIDEO_CLASS,                          /* bInterfaceClass */
+  VIDEO_SUBCLASS_VIDEOCONTROL,          /* bInterfaceSubClass */
+  0x00,                                 /* bInterfaceProtocol */
+  0x00,                                 /* iInterface */
+  /* 09 byte*/
+
+  /* Class-specific VC Interface Header Descriptor */
+  0x0D,                                 /* bLength */
+  VIDEO_CS_INTERFACE,                   /* bDescriptorType */
+  VIDEO_VC_HEADER,                      /* bDescriptorSubtype */
+  0x00,                                 /* bcdUVC: 1.00 */
+  0x01,
+  LOBYTE(VIDEO_VC_DESC_SIZ),            /* wTotalLength */
+  HIBYTE(VIDEO_VC_DESC_SIZ),
+  VIDEO_LE32(48000000U),                /* dwClockFrequency: unused, no PTS nor SCR */
+  0x01,                                 /* bInCollection */
+  0x01,                                 /* baInterfaceNr(1) */
+  /* 13 byte*/
+
+  /* Camera Terminal Descriptor */
+  0x12,                                 /* bLength */
+  VIDEO_CS_INTERFACE,                   /* bDescriptorType */
+  VIDEO_VC_INPUT_TERMINAL,              /* bDescriptorSubtype */
+  VIDEO_CAMERA_TERMINAL_ID,             /* bTerminalID */
+  0x01,                                 /* wTerminalType: ITT_CAMERA */
+  0x02,
+  0x00,                                 /* bAssocTerminal */
+  0x00,                                 /* iTerminal */
+  0x00,                                 /* wObjectiveFocalLengthMin */
+  0x00,
+  0x00,                                 /* wObjectiveFocalLengthMax */
+  0x00,
+  0x00,                                 /* wOcularFocalLength */
+  0x00,
+  0x03,                                 /* bControlSize */
+  0x00,                                 /* bmControls: none */
+  0x00,
+  0x00,
+  /* 18 byte*/
+
+  /* Output Terminal Descriptor */
+  0x09,                                 /* bLength */
+  VIDEO_CS_INTERFACE,                   /* bDescriptorType */
+  VIDEO_VC_OUTPUT_TERMINAL,             /* bDescriptorSubtype */
+  VIDEO_OUTPUT_TERMINAL_ID,             /* bTerminalID */
+  0x01,                                 /* wTerminalType: TT_STREAMING */
+  0x01,
+  0x00,                                 /* bAssocTerminal */
+  VIDEO_CAMERA_TERMINAL_ID,             /* bSourceID */
+  0x00,                                 /* iTerminal */
+  /* 09 byte*/
+
+  /* Standard VS Interface Descriptor - Zero Bandwidth (isochronous) or Operational (bulk) */
+  0x09,                                 /* bLength */
+  USB_DESC_TYPE_INTERFACE,              /* bDescriptorType */
+  0x01,                                 /* bInterfaceNumber */
+  0x00,                                 /* bAlternateSetting */
+  USBD_VIDEO_BULK,                      /* bNumEndpoints */
+  VIDEO_CLASS,                          /* bInterfaceClass */
+  VIDEO_SUBCLASS_VIDEOSTREAMING,        /* bInterfaceSubClass */
+  0x00,                                 /* bInterfaceProtocol */
+  0x00,                                 /* iInterface */
+  /* 09 byte*/
+
+  /* Class-specific VS Input Header Descriptor */
+  0x0F,                                 /* bLength */
+  VIDEO_CS_INTERFACE,                   /* bDescriptorType */
+  VIDEO_VS_INPUT_HEADER,                /* bDescriptorSubtype */
+  0x02,                                 /* bNumFormats */
+  LOBYTE(VIDEO_VS_DESC_SIZ),            /* wTotalLength */
+  HIBYTE(VIDEO_VS_DESC_SIZ),
+  VIDEO_IN_EP,                          /* bEndpointAddress */
+  0x00,                                 /* bmInfo */
+  VIDEO_OUTPUT_TERMINAL_ID,             /* bTerminalLink */
+  0x00,                                 /* bStillCaptureMethod */
+  0x00,                                 /* bTriggerSupport */
+  0x00,                                 /* bTriggerUsage */
+  0x01,                                 /* bControlSize */
+  0x00,                                 /* bmaControls(1) */
+  0x00,                                 /* bmaControls(2) */
+  /* 15 byte*/
+
+  /* MJPEG Format Descriptor */
+  0x0B,                                 /* bLength */
+  VIDEO_CS_INTERFACE,                   /* bDescriptorType */
+  VIDEO_VS_FORMAT_MJPEG,                /* bDescriptorSubtype */
+  VIDEO_FORMAT_MJPEG,                   /* bFormatIndex */
+  0x01,                                 /* bNumFrameDescriptors */
+  0x01,                                 /* bmFlags: fixed size samples */
+  VIDEO_FRAME_INDEX,                    /* bDefaultFrameIndex */
+  0x00,                                 /* bAspectRatioX */
+  0x00,                                 /* bAspectRatioY */
+  0x00,                                 /* bmInterlaceFlags */
+  0x00,                                 /* bCopyProtect */
+  /* 11 byte*/
+
+  /* MJPEG Frame Descriptor */
+  0x1E,                                 /* bLength */
+  VIDEO_CS_INTERFACE,                   /* bDescriptorType */
+  VIDEO_VS_FRAME_MJPEG       ,          /* bDescriptorSubtype */
+  VIDEO_FRAME_INDEX,                    /* bFrameIndex */
+  0x00,                                 /* bmCapabilities */
+  LOBYTE(USBD_VIDEO_WIDTH),             /* wWidth */
+  HIBYTE(USBD_VIDEO_WIDTH),
+  LOBYTE(USBD_VIDEO_HEIGHT),            /* wHeight */
+  HIBYTE(USBD_VIDEO_HEIGHT),
+  VIDEO_LE32(USBD_VIDEO_MJPEG_MAX_FRAME * 8U * USBD_VIDEO_FPS),  /* dwMinBitRate */
+  VIDEO_LE32(USBD_VIDEO_MJPEG_MAX_FRAME * 8U * USBD_VIDEO_FPS),  /* dwMaxBitRate */
+  VIDEO_LE32(USBD_VIDEO_MJPEG_MAX_FRAME),  /* dwMaxVideoFrameBufferSize */
+  VIDEO_LE32(VIDEO_FRAME_INTERVAL),     /* dwDefaultFrameInterval */
+  0x01,                                 /* bFrameIntervalType: one discrete interval */
+  VIDEO_LE32(VIDEO_FRAME_INTERVAL),     /* dwFrameInterval */
+  /* 30 byte*/
+
+  /* Uncompressed Format Descriptor */
+  0x1B,                                 /* bLength */
+  VIDEO_CS_INTERFACE,                   /* bDescriptorType */
+  VIDEO_VS_FORMAT_UNCOMPRESSED,         /* bDescriptorSubtype */
+  VIDEO_FORMAT_UNCOMPRESSED,            /* bFormatIndex */
+  0x01,                                 /* bNumFrameDescriptors */
+  USBD_VIDEO_UNCOMPRESSED_GUID,         /* guidFormat */
+  USBD_VIDEO_UNCOMPRESSED_BPP,          /* bBitsPerPixel */
+  VIDEO_FRAME_INDEX,                    /* bDefaultFrameIndex */
+  0x00,                                 /* bAspectRatioX */
+  0x00,                                 /* bAspectRatioY */
+  0x00,                                 /* bmInterlaceFlags */
+  0x00,                                 /* bCopyProtect */
+  /* 27 byte*/
+
+  /* Uncompressed Frame Descriptor */
+  0x1E,                                 /* bLength */
+  VIDEO_CS_INTERFACE,                   /* bDescriptorType */
+  VIDEO_VS_FRAME_UNCOMPRESSED,          /* bDescriptorSubtype */
+  VIDEO_FRAME_INDEX,                    /* bFrameIndex */
+  0x00,                                 /* bmCapabilities */
+  LOBYTE(USBD_VIDEO_WIDTH),             /* wWidth */
+  HIBYTE(USBD_VIDEO_WIDTH),
+  LOBYTE(USBD_VIDEO_HEIGHT),            /* wHeight */
+  HIBYTE(USBD_VIDEO_HEIGHT),
+  VIDEO_LE32(VIDEO_UNCOMPRESSED_FRAME_SIZE * 8U * USBD_VIDEO_FPS),  /* dwMinBitRate */
+  VIDEO_LE32(VIDEO_UNCOMPRESSED_FRAME_SIZE * 8U * USBD_VIDEO_FPS),  /* dwMaxBitRate */
+  VIDEO_LE32(VIDEO_UNCOMPRESSED_FRAME_SIZE),  /* dwMaxVideoFrameBufferSize */
+  VIDEO_LE32(VIDEO_FRAME_INTERVAL),     /* dwDefaultFrameInterval */
+  0x01,                                 /* bFrameIntervalType: one discrete interval */
+  VIDEO_LE32(VIDEO_FRAME_INTERVAL),     /* dwFrameInterval */
+  /* 30 byte*/
+
+#if (USBD_VIDEO_BULK == 0U)
+  /* Standard VS Interface Descriptor - Operational */
+  0x09,                                 /* bLength */
+  USB_DESC_TYPE_INTERFACE,              /* bDescriptorType */
+  0x01,                                 /* bInterfaceNumber */
+  0x01,                                 /* bAlternateSetting */
+  0x01,                                 /* bNumEndpoints */
+  VIDEO_CLASS,                          /* bInterfaceClass */
+  VIDEO_SUBCLASS_VIDEOSTREAMING,        /* bInterfaceSubClass */
+  0x00,                                 /* bInterfaceProtocol */
+  0x00,                                 /* iInterface */
+  /* 09 byte*/
+#endif /* USBD_VIDEO_BULK */
+
+  /* Endpoint Descriptor */
+  0x07,                                 /* bLength */
+  USB_DESC_TYPE_ENDPOINT,               /* bDescriptorType */
+  VIDEO_IN_EP,                          /* bEndpointAddress */
+  VIDEO_EP_ATTRIBUTES,                  /* bmAttributes */
+  LOBYTE(VIDEO_FS_MAX_PACKET),         /* wMaxPacketSize */
+  HIBYTE(VIDEO_FS_MAX_PACKET),
+  VIDEO_EP_BINTERVAL,                   /* bInterval */
+  /* 07 byte*/
+};
+
+/* USB VIDEO device Other Speed Configuration Descriptor */
+__ALIGN_BEGIN static uint8_t USBD_VIDEO_OtherSpeedCfgDesc[USB_VIDEO_CONFIG_DESC_SIZ] __ALIGN_END =
+{
+  /* Configuration 1 */
+  0x09,                                 /* bLength */
+  USB_DESC_TYPE_OTHER_SPEED_CONFIGURATION,   /* bDescriptorType */
+  LOBYTE(USB_VIDEO_CONFIG_DESC_SIZ),    /* wTotalLength */
+  HIBYTE(USB_VIDEO_CONFIG_DESC_SIZ),
+  0x02,                                 /* bNumInterfaces */
+  0x01,                                 /* bConfigurationValue */
+  0x00,                                 /* iConfiguration */
+  0xC0,                                 /* bmAttributes: self powered */
+  0x32,                                 /* MaxPower 100 mA */
+  /* 09 byte*/
+
+  /* Interface Association Descriptor */
+  0x08,                                 /* bLength */
+  0x0B,                                 /* bDescriptorType: IAD */
+  0x00,                                 /* bFirstInterface */
+  0x02,                                 /* bInterfaceCount */
+  VIDEO_CLASS,                          /* bFunctionClass */
+  VIDEO_SUBCLASS_COLLECTION,            /* bFunctionSubClass */
+  0x00,                                 /* bFunctionProtocol */
+  0x00,                                 /* iFunction */
+  /* 08 byte*/
+
+  /* Standard VC Interface Descriptor */
+  0x09,                                 /* bLength */
+  USB_DESC_TYPE_INTERFACE,              /* bDescriptorType */
+  0x00,                                 /* bInterfaceNumber */
+  0x00,                                 /* bAlternateSetting */
+  0x00,                                 /* bNumEndpoints */
+  VIDEO_CLASS,                          /* bInterfaceClass */
+  VIDEO_SUBCLASS_VIDEOCONTROL,          /* bInterfaceSubClass */
+  0x00,                                 /* bInterfaceProtocol */
+  0x00,                                 /* iInterface */
+  /* 09 byte*/
+
+  /* Class-specific VC Interface Header Descriptor */
+  0x0D,                                 /* bLength */
+  VIDEO_CS_INTERFACE,                   /* bDescriptorType */
+  VIDEO_VC_HEADER,                      /* bDescriptorSubtype */
+  0x00,                                 /* bcdUVC: 1.00 */
+  0x01,
+  LOBYTE(VIDEO_VC_DESC_SIZ),            /* wTotalLength */
+  HIBYTE(VIDEO_VC_DESC_SIZ),
+  VIDEO_LE32(48000000U),                /* dwClockFrequency: unused, no PTS nor SCR */
+  0x01,                                 /* bInCollection */
+  0x01,                                 /* baInterfaceNr(1) */
+  /* 13 byte*/
+
+  /* Camera Terminal Descriptor */
+  0x12,                                 /* bLength */
+  VIDEO_CS_INTERFACE,                   /* bDescriptorType */
+  VIDEO_VC_INPUT_TERMINAL,              /* bDescriptorSubtype */
+  VIDEO_CAMERA_TERMINAL_ID,             /* bTerminalID */
+  0x01,                                 /* wTerminalType: ITT_CAMERA */
+  0x02,
+  0x00,                                 /* bAssocTerminal */
+  0x00,                                 /* iTerminal */
+  0x00,                                 /* wObjectiveFocalLengthMin */
+  0x00,
+  0x00,                                 /* wObjectiveFocalLengthMax */
+  0x00,
+  0x00,                                 /* wOcularFocalLength */
+  0x00,
+  0x03,                                 /* bControlSize */
+  0x00,                                 /* bmControls: none */
+  0x00,
+  0x00,
+  /* 18 byte*/
+
+  /* Output Terminal Descriptor */
+  0x09,                                 /* bLength */
+  VIDEO_CS_INTERFACE,                   /* bDescriptorType */
+  VIDEO_VC_OUTPUT_TERMINAL,             /* bDescriptorSubtype */
+  VIDEO_OUTPUT_TERMINAL_ID,             /* bTerminalID */
+  0x01,                                 /* wTerminalType: TT_STREAMING */
+  0x01,
+  0x00,                                 /* bAssocTerminal */
+  VIDEO_CAMERA_TERMINAL_ID,             /* bSourceID */
+  0x00,                                 /* iTerminal */
+  /* 09 byte*/
+
+  /* Standard VS Interface Descriptor - Zero Bandwidth (isochronous) or Operational (bulk) */
+  0x09,                                 /* bLength */
+  USB_DESC_TYPE_INTERFACE,              /* bDescriptorType */
+  0x01,                                 /* bInterfaceNumber */
+  0x00,                                 /* bAlternateSetting */
+  USBD_VIDEO_BULK,                      /* bNumEndpoints */
+  VIDEO_CLASS,                          /* bInterfaceClass */
+  VIDEO_SUBCLASS_VIDEOSTREAMING,        /* bInterfaceSubClass */
+  0x00,                                 /* bInterfaceProtocol */
+  0x00,                                 /* iInterface */
+  /* 09 byte*/
+
+  /* Class-specific VS Input Header Descriptor */
+  0x0F,                                 /* bLength */
+  VIDEO_CS_INTERFACE,                   /* bDescriptorType */
+  VIDEO_VS_INPUT_HEADER,                /* bDescriptorSubtype */
+  0x02,                                 /* bNumFormats */
+  LOBYTE(VIDEO_VS_DESC_SIZ),            /* wTotalLength */
+  HIBYTE(VIDEO_VS_DESC_SIZ),
+  VIDEO_IN_EP,                          /* bEndpointAddress */
+  0x00,                                 /* bmInfo */
+  VIDEO_OUTPUT_TERMINAL_ID,             /* bTerminalLink */
+  0x00,                                 /* bStillCaptureMethod */
+  0x00,                                 /* bTriggerSupport */
+  0x00,                                 /* bTriggerUsage */
+  0x01,                                 /* bControlSize */
+  0x00,                                 /* bmaControls(1) */
+  0x00,                                 /* bmaControls(2) */
+  /* 15 byte*/
+
+  /* MJPEG Format Descriptor */
+  0x0B,                                 /* bLength */
+  VIDEO_CS_INTERFACE,                   /* bDescriptorType */
+  VIDEO_VS_FORMAT_MJPEG,                /* bDescriptorSubtype */
+  VIDEO_FORMAT_MJPEG,                   /* bFormatIndex */
+  0x01,                                 /* bNumFrameDescriptors */
+  0x01,                                 /* bmFlags: fixed size samples */
+  VIDEO_FRAME_INDEX,                    /* bDefaultFrameIndex */
+  0x00,                                 /* bAspectRatioX */
+  0x00,                                 /* bAspectRatioY */
+  0x00,                                 /* bmInterlaceFlags */
+  0x00,                                 /* bCopyProtect */
+  /* 11 byte*/
+
+  /* MJPEG Frame Descriptor */
+  0x1E,                                 /* bLength */
+  VIDEO_CS_INTERFACE,                   /* bDescriptorType */
+  VIDEO_VS_FRAME_MJPEG       ,          /* bDescriptorSubtype */
+  VIDEO_FRAME_INDEX,                    /* bFrameIndex */
+  0x00,                                 /* bmCapabilities */
+  LOBYTE(USBD_VIDEO_WIDTH),             /* wWidth */
+  HIBYTE(USBD_VIDEO_WIDTH),
+  LOBYTE(USBD_VIDEO_HEIGHT),            /* wHeight */
+  HIBYTE(USBD_VIDEO_HEIGHT),
+  VIDEO_LE32(USBD_VIDEO_MJPEG_MAX_FRAME * 8U * USBD_VIDEO_FPS),  /* dwMinBitRate */
+  VIDEO_LE32(USBD_VIDEO_MJPEG_MAX_FRAME * 8U * USBD_VIDEO_FPS),  /* dwMaxBitRate */
+  VIDEO_LE32(USBD_VIDEO_MJPEG_MAX_FRAME),  /* dwMaxVideoFrameBufferSize */
+  VIDEO_LE32(VIDEO_FRAME_INTERVAL),     /* dwDefaultFrameInterval */
+  0x01,                                 /* bFrameIntervalType: one discrete interval */
+  VIDEO_LE32(VIDEO_FRAME_INTERVAL),     /* dwFrameInterval */
+  /* 30 byte*/
+
+  /* Uncompressed Format Descriptor */
+  0x1B,                                 /* bLength */
+  VIDEO_CS_INTERFACE,                   /* bDescriptorType */
+  VIDEO_VS_FORMAT_UNCOMPRESSED,         /* bDescriptorSubtype */
+  VIDEO_FORMAT_UNCOMPRESSED,            /* bFormatIndex */
+  0x01,                                 /* bNumFrameDescriptors */
+  USBD_VIDEO_UNCOMPRESSED_GUID,         /* guidFormat */
+  USBD_VIDEO_UNCOMPRESSED_BPP,          /* bBitsPerPixel */
+  VIDEO_FRAME_INDEX,                    /* bDefaultFrameIndex */
+  0x00,                                 /* bAspectRatioX */
+  0x00,                                 /* bAspectRatioY */
+  0x00,                                 /* bmInterlaceFlags */
+  0x00,                                 /* bCopyProtect */
+  /* 27 byte*/
+
+  /* Uncompressed Frame Descriptor */
+  0x1E,                                 /* bLength */
+  VIDEO_CS_INTERFACE,                   /* bDescriptorType */
+  VIDEO_VS_FRAME_UNCOMPRESSED,          /* bDescriptorSubtype */
+  VIDEO_FRAME_INDEX,                    /* bFrameIndex */
+  0x00,                                 /* bmCapabilities */
+  LOBYTE(USBD_VIDEO_WIDTH),             /* wWidth */
+  HIBYTE(USBD_VIDEO_WIDTH),
+  LOBYTE(USBD_VIDEO_HEIGHT),            /* wHeight */
+  HIBYTE(USBD_VIDEO_HEIGHT),
+  VIDEO_LE32(VIDEO_UNCOMPRESSED_FRAME_SIZE * 8U * USBD_VIDEO_FPS),  /* dwMinBitRate */
+  VIDEO_LE32(VIDEO_UNCOMPRESSED_FRAME_SIZE * 8U * USBD_VIDEO_FPS),  /* dwMaxBitRate */
+  VIDEO_LE32(VIDEO_UNCOMPRESSED_FRAME_SIZE),  /* dwMaxVideoFrameBufferSize */
+  VIDEO_LE32(VIDEO_FRAME_INTERVAL),     /* dwDefaultFrameInterval */
+  0x01,                                 /* bFrameIntervalType: one discrete interval */
+  VIDEO_LE32(VIDEO_FRAME_INTERVAL),     /* dwFrameInterval */
+  /* 30 byte*/
+
+#if (USBD_VIDEO_BULK == 0U)
+  /* Standard VS Interface Descriptor - Operational */
+  0x09,                                 /* bLength */
+  USB_DESC_TYPE_INTERFACE,              /* bDescriptorType */
+  0x01,                                 /* bInterfaceNumber */
+  0x01,                                 /* bAlternateSetting */
+  0x01,                                 /* bNumEndpoints */
+  VIDEO_CLASS,                          /* bInterfaceClass */
+  VIDEO_SUBCLASS_VIDEOSTREAMING,        /* bInterfaceSubClass */
+  0x00,                                 /* bInterfaceProtocol */
+  0x00,                                 /* iInterface */
+  /* 09 byte*/
+#endif /* USBD_VIDEO_BULK */
+
+  /* Endpoint Descriptor */
+  0x07,                                 /* bLength */
+  USB_DESC_TYPE_ENDPOINT,               /* bDescriptorType */
+  VIDEO_IN_EP,                          /* bEndpointAddress */
+  VIDEO_EP_ATTRIBUTES,                  /* bmAttributes */
+  LOBYTE(VIDEO_FS_MAX_PACKET),         /* wMaxPacketSize */
+  HIBYTE(VIDEO_FS_MAX_PACKET),
+  VIDEO_EP_BINTERVAL,                   /* bInterval */
+  /* 07 byte*/
+};
+/**
+  * @}
+  */
+
+/** @defgroup USBD_VIDEO_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  USBD_VIDEO_Init
+  *         Initialize the VIDEO interface
+  * @note   With isochronous streaming the endpoint is opened when the host
+  *         selects the operational setting of the streaming interface.
+  * @param  pdev: device instance
+  * @param  cfgidx: Configuration index
+  * @retval status
+  */
+static uint8_t  USBD_VIDEO_Init (USBD_HandleTypeDef *pdev, uint8_t cfgidx)
+{
+  USBD_VIDEO_HandleTypeDef   *hvideo;
+
+  pdev->pClassData = USBD_malloc(sizeof (USBD_VIDEO_HandleTypeDef));
+
+  if(pdev->pClassData == NULL)
+  {
+    return USBD_FAIL;
+  }
+
+  hvideo = (USBD_VIDEO_HandleTypeDef*) pdev->pClassData;
+  hvideo->CmdSelector = 0U;
+  hvideo->alt_setting = 0U;
+  hvideo->Streaming = 0U;
+  hvideo->TxState = VIDEO_TX_IDLE;
+  hvideo->Frames = 0U;
+  hvideo->Payloads = 0U;
+  hvideo->Staged = 0U;
+  hvideo->Retries = 0U;
+#if (USBD_VIDEO_BULK == 1U)
+  hvideo->MaxPayload = USBD_VIDEO_BULK_PAYLOAD;
+
+  USBD_LL_OpenEP(pdev, VIDEO_IN_EP, USBD_EP_TYPE_BULK, VIDEO_MAX_PACKET(pdev));
+  pdev->ep_in[VIDEO_IN_EP & 0xFU].is_used = 1U;
+#else
+  hvideo->MaxPayload = VIDEO_MAX_PACKET(pdev);
+#endif /* USBD_VIDEO_BULK */
+  USBD_VIDEO_SetProbe(pdev, VIDEO_FORMAT_MJPEG);
+
+  /* Init  physical Interface components */
+  if (((USBD_VIDEO_ItfTypeDef *)pdev->pUserData)->Init() != 0)
+  {
+    return USBD_FAIL;
+  }
+
+  return USBD_OK;
+}
+
+/**
+  * @brief  USBD_VIDEO_DeInit
+  *         DeInitialize the VIDEO layer
+  * @param  pdev: device instance
+  * @param  cfgidx: Configuration index
+  * @retval status
+  */
+static uint8_t  USBD_VIDEO_DeInit (USBD_HandleTypeDef *pdev, uint8_t cfgidx)
+{
+  if(pdev->pClassData != NULL)
+  {
+    USBD_VIDEO_Stop(pdev);
+
+#if (USBD_VIDEO_BULK == 1U)
+    USBD_LL_CloseEP(pdev, VIDEO_IN_EP);
+    pdev->ep_in[VIDEO_IN_EP & 0xFU].is_used = 0U;
+#else
+    if (((USBD_VIDEO_HandleTypeDef*) pdev->pClassData)->alt_setting != 0U)
+    {
+      USBD_LL_CloseEP(pdev, VIDEO_IN_EP);
+      pdev->ep_in[VIDEO_IN_EP & 0xFU].is_used = 0U;
+    }
+#endif /* USBD_VIDEO_BULK */
+
+    ((USBD_VIDEO_ItfTypeDef *)pdev->pUserData)->DeInit();
+    USBD_free(pdev->pClassData);
+    pdev->pClassData = NULL;
+  }
+
+  return USBD_OK;
+}
+
+/**
+  * @brief  USBD_VIDEO_Setup
+  *         Handle the VIDEO specific requests
+  * @param  pdev: instance
+  * @param  req: usb requests
+  * @retval status
+  */
+static uint8_t  USBD_VIDEO_Setup (USBD_HandleTypeDef *pdev,
+                                  USBD_SetupReqTypedef *req)
+{
+  USBD_VIDEO_HandleTypeDef   *hvideo = (USBD_VIDEO_HandleTypeDef*) pdev->pClassData;
+  uint8_t *pbuf = (uint8_t *)(void *)hvideo->data;
+  uint16_t status_info = 0U;
+  uint8_t ret = USBD_OK;
+
+  switch (req->bmRequest & USB_REQ_TYPE_MASK)
+  {
+  case USB_REQ_TYPE_CLASS :
+    /* Only the streaming interface has controls: probe and commit */
+    if ((LOBYTE(req->wIndex) == VIDEO_VS_ITF) &&
+        ((HIBYTE(req->wValue) == VIDEO_VS_PROBE_CONTROL) ||
+         (HIBYTE(req->wValue) == VIDEO_VS_COMMIT_CONTROL)))
+    {
+      USBD_VIDEO_StreamingRequest(pdev, req);
+    }
+    else
+    {
+      USBD_CtlError (pdev, req);
+      ret = USBD_FAIL;
+    }
+    break;
+
+  case USB_REQ_TYPE_STANDARD:
+    switch (req->bRequest)
+    {
+    case USB_REQ_GET_STATUS:
+      if (pdev->dev_state == USBD_STATE_CONFIGURED)
+      {
+        USBD_CtlSendData (pdev, (uint8_t *)(void *)&status_info, 2U);
+      }
+      else
+      {
+        USBD_CtlError (pdev, req);
+        ret = USBD_FAIL;
+      }
+      break;
+
+    case USB_REQ_GET_INTERFACE:
+      if (pdev->dev_state == USBD_STATE_CONFIGURED)
+      {
+        pbuf[0] = (LOBYTE(req->wIndex) == VIDEO_VS_ITF) ? hvideo->alt_setting : 0U;
+        USBD_CtlSendData (pdev, pbuf, 1U);
+      }
+      else
+      {
+        USBD_CtlError (pdev, req);
+        ret = USBD_FAIL;
+      }
+      break;
+
+    case USB_REQ_SET_INTERFACE:
+#if (USBD_VIDEO_BULK == 0U)
+      if ((pdev->dev_state == USBD_STATE_CONFIGURED) && (LOBYTE(req->wIndex) == VIDEO_VS_ITF) &&
+          (req->wValue <= 1U))
+      {
+        /* Isochronous streaming runs in the operational setting */
+        if (hvideo->alt_setting != 0U)
+        {
+          USBD_VIDEO_Stop(pdev);
+          USBD_LL_CloseEP(pdev, VIDEO_IN_EP);
+          pdev->ep_in[VIDEO_IN_EP & 0xFU].is_used = 0U;
+        }
+
+        hvideo->alt_setting = (uint8_t)req->wValue;
+
+        if (hvideo->alt_setting != 0U)
+        {
+          USBD_LL_OpenEP(pdev, VIDEO_IN_EP, USBD_EP_TYPE_ISOC, VIDEO_MAX_PACKET(pdev));
+          pdev->ep_in[VIDEO_IN_EP & 0xFU].is_used = 1U;
+          USBD_VIDEO_Start(pdev);
+        }
+      }
+      else
+#endif /* USBD_VIDEO_BULK */
+      if ((pdev->dev_state != USBD_STATE_CONFIGURED) || (req->wValue != 0U))
+      {
+        USBD_CtlError (pdev, req);
+        ret = USBD_FAIL;
+      }
+      break;
+
+    default:
+      USBD_CtlError (pdev, req);
+      ret = USBD_FAIL;
+      break;
+    }
+    break;
+
+  default:
+    USBD_CtlError (pdev, req);
+    ret = USBD_FAIL;
+    break;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  USBD_VIDEO_StreamingRequest
+  *         Handle the video probe and commit controls. The device has a
+  *         single frame per format: any probe is answered with the fields
+  *         of the format it selects.
+  * @param  pdev: instance
+  * @param  req: setup class request
+  * @retval None
+  */
+static void  USBD_VIDEO_StreamingRequest (USBD_HandleTypeDef *pdev,
+                                          USBD_SetupReqTypedef *req)
+{
+  USBD_VIDEO_HandleTypeDef   *hvideo = (USBD_VIDEO_HandleTypeDef*) pdev->pClassData;
+  uint8_t *pbuf = (uint8_t *)(void *)hvideo->data;
+
+  switch (req->bRequest)
+  {
+  case VIDEO_GET_CUR:
+  case VIDEO_GET_MIN:
+  case VIDEO_GET_MAX:
+  case VIDEO_GET_DEF:
+    USBD_memcpy(pbuf, hvideo->Probe, VIDEO_PROBE_SIZE);
+    USBD_CtlSendData (pdev, pbuf, MIN(req->wLength, VIDEO_PROBE_SIZE));
+    break;
+
+  case VIDEO_GET_LEN:
+    pbuf[0] = VIDEO_PROBE_SIZE;
+    pbuf[1] = 0U;
+    USBD_CtlSendData (pdev, pbuf, MIN(req->wLength, 2U));
+    break;
+
+  case VIDEO_GET_INFO:
+    pbuf[0] = 0x03U;     /* GET and SET supported */
+    USBD_CtlSendData (pdev, pbuf, MIN(req->wLength, 1U));
+    break;
+
+  case VIDEO_SET_CUR:
+    if ((req->wLength >= 3U) && (req->wLength <= sizeof (hvideo->data)))
+    {
+      /* The probe or commit is applied on EP0 Rx Ready */
+      hvideo->CmdSelector = HIBYTE(req->wValue);
+      USBD_CtlPrepareRx (pdev, pbuf, req->wLength);
+    }
+    else
+    {
+      USBD_CtlError (pdev, req);
+    }
+    break;
+
+  default:
+    USBD_CtlError (pdev, req);
+    break;
+  }
+}
+
+/**
+  * @brief  USBD_VIDEO_EP0_RxReady
+  *         Handle the probe or commit sent by the host
+  * @param  pdev: device instance
+  * @retval status
+  */
+static uint8_t  USBD_VIDEO_EP0_RxReady (USBD_HandleTypeDef *pdev)
+{
+  USBD_VIDEO_HandleTypeDef   *hvideo = (USBD_VIDEO_HandleTypeDef*) pdev->pClassData;
+  uint8_t *pbuf;
+
+  if ((hvideo != NULL) && (hvideo->CmdSelector != 0U))
+  {
+    pbuf = (uint8_t *)(void *)hvideo->data;
+
+    /* bFormatIndex: unknown formats keep the current one */
+    if ((pbuf[2] == VIDEO_FORMAT_MJPEG) || (pbuf[2] == VIDEO_FORMAT_UNCOMPRESSED))
+    {
+      USBD_VIDEO_SetProbe(pdev, pbuf[2]);
+    }
+
+#if (USBD_VIDEO_BULK == 1U)
+    /* Bulk streaming starts on commit, again from a new frame when the host
+       commits while streaming */
+    if (hvideo->CmdSelector == VIDEO_VS_COMMIT_CONTROL)
+    {
+      USBD_VIDEO_Stop(pdev);
+      USBD_VIDEO_Start(pdev);
+    }
+#endif /* USBD_VIDEO_BULK */
+
+    hvideo->CmdSelector = 0U;
+  }
+
+  return USBD_OK;
+}
+
+/**
+  * @brief  USBD_VIDEO_DataIn
+  *         Payload sent: the chunk is given back to the application once all
+  *         its bytes are sent, and the next payload is queued
+  * @param  pdev: device instance
+  * @param  epnum: endpoint number
+  * @retval status
+  */
+static uint8_t  USBD_VIDEO_DataIn (USBD_HandleTypeDef *pdev, uint8_t epnum)
+{
+  USBD_VIDEO_HandleTypeDef   *hvideo = (USBD_VIDEO_HandleTypeDef*) pdev->pClassData;
+  USBD_VIDEO_ChunkTypeDef    *chunk;
+
+  if ((hvideo == NULL) || (hvideo->TxState == VIDEO_TX_IDLE))
+  {
+    return USBD_OK;
+  }
+
+#if (USBD_VIDEO_BULK == 1U)
+  /* A payload shorter than the payload transfer size ends with a short
+     packet */
+  if ((hvideo->TxState == VIDEO_TX_PAYLOAD) && (hvideo->TxSize < hvideo->MaxPayload) &&
+      ((hvideo->TxSize % VIDEO_MAX_PACKET(pdev)) == 0U))
+  {
+    hvideo->TxState = VIDEO_TX_ZLP;
+    USBD_LL_Transmit(pdev, VIDEO_IN_EP, NULL, 0U);
+    return USBD_OK;
+  }
+#endif /* USBD_VIDEO_BULK */
+
+  hvideo->TxState = VIDEO_TX_IDLE;
+  hvideo->Payloads++;
+  hvideo->Offset += hvideo->TxData;
+
+  chunk = &hvideo->Chunks[hvideo->Tail % USBD_VIDEO_MAX_CHUNKS];
+  if (hvideo->Offset >= chunk->Length)
+  {
+    hvideo->Offset = 0U;
+    hvideo->Tail++;
+
+    if ((chunk->Flags & USBD_VIDEO_CHUNK_EOF) != 0U)
+    {
+      hvideo->Fid ^= VIDEO_HEADER_FID;
+      hvideo->Frames++;
+    }
+
+    ((USBD_VIDEO_ItfTypeDef *)pdev->pUserData)->ChunkDone(chunk->pData, chunk->Length);
+  }
+
+  USBD_VIDEO_Kick(pdev);
+
+  return USBD_OK;
+}
+
+/**
+  * @brief  USBD_VIDEO_IsoINIncomplete
+  *         handle data ISO IN Incomplete event
+  * @param  pdev: device instance
+  * @param  epnum: endpoint index
+  * @retval status
+  */
+static uint8_t  USBD_VIDEO_IsoINIncomplete (USBD_HandleTypeDef *pdev, uint8_t epnum)
+{
+  USBD_VIDEO_HandleTypeDef   *hvideo = (USBD_VIDEO_HandleTypeDef*) pdev->pClassData;
+
+  /* A payload not read in its (micro)frame is flushed and queued again */
+  if ((USBD_VIDEO_BULK == 0U) && (hvideo != NULL) && (hvideo->TxState == VIDEO_TX_PAYLOAD))
+  {
+    hvideo->Retries++;
+    USBD_LL_FlushEP(pdev, VIDEO_IN_EP);
+    USBD_LL_Transmit(pdev, VIDEO_IN_EP, hvideo->pTx, (uint16_t)hvideo->TxSize);
+  }
+
+  return USBD_OK;
+}
+
+/**
+  * @brief  USBD_VIDEO_GetFSCfgDesc
+  *         Return configuration descriptor
+  * @param  speed : current device speed
+  * @param  length : pointer data length
+  * @retval pointer to descriptor buffer
+  */
+static uint8_t  *USBD_VIDEO_GetFSCfgDesc (uint16_t *length)
+{
+  *length = sizeof (USBD_VIDEO_CfgFSDesc);
+  return USBD_VIDEO_CfgFSDesc;
+}
+
+/**
+  * @brief  USBD_VIDEO_GetHSCfgDesc
+  *         Return configuration descriptor
+  * @param  speed : current device speed
+  * @param  length : pointer data length
+  * @retval pointer to descriptor buffer
+  */
+static uint8_t  *USBD_VIDEO_GetHSCfgDesc (uint16_t *length)
+{
+  *length = sizeof (USBD_VIDEO_CfgHSDesc);
+  return USBD_VIDEO_CfgHSDesc;
+}
+
+/**
+  * @brief  USBD_VIDEO_GetOtherSpeedCfgDesc
+  *         Return configuration descriptor
+  * @param  speed : current device speed
+  * @param  length : pointer data length
+  * @retval pointer to descriptor buffer
+  */
+static uint8_t  *USBD_VIDEO_GetOtherSpeedCfgDesc (uint16_t *length)
+{
+  *length = sizeof (USBD_VIDEO_OtherSpeedCfgDesc);
+  return USBD_VIDEO_OtherSpeedCfgDesc;
+}
+
+/**
+* @brief  DeviceQualifierDescriptor
+*         return Device Qualifier descriptor
+* @param  length : pointer data length
+* @retval pointer to descriptor buffer
+*/
+uint8_t  *USBD_VIDEO_GetDeviceQualifierDescriptor (uint16_t *length)
+{
+  *length = sizeof (USBD_VIDEO_DeviceQualifierDesc);
+  return USBD_VIDEO_DeviceQualifierDesc;
+}
+
+/**
+  * @brief  USBD_VIDEO_SetProbe
+  *         Fill the probe and commit controls for a format
+  * @param  pdev: device instance
+  * @param  format: format index
+  * @retval None
+  */
+static void  USBD_VIDEO_SetProbe (USBD_HandleTypeDef *pdev, uint8_t format)
+{
+  USBD_VIDEO_HandleTypeDef   *hvideo = (USBD_VIDEO_HandleTypeDef*) pdev->pClassData;
+  uint8_t *probe = hvideo->Probe;
+  uint32_t i;
+
+  for (i = 0U; i < VIDEO_PROBE_SIZE; i++)
+  {
+    probe[i] = 0U;
+  }
+
+  probe[2] = format;                                          /* bFormatIndex */
+  probe[3] = VIDEO_FRAME_INDEX;                               /* bFrameIndex */
+  USBD_VIDEO_Put32(&probe[4], VIDEO_FRAME_INTERVAL);          /* dwFrameInterval */
+  USBD_VIDEO_Put32(&probe[18], (format == VIDEO_FORMAT_MJPEG) ?
+                   USBD_VIDEO_MJPEG_MAX_FRAME : VIDEO_UNCOMPRESSED_FRAME_SIZE);  /* dwMaxVideoFrameSize */
+  USBD_VIDEO_Put32(&probe[22], hvideo->MaxPayload);           /* dwMaxPayloadTransferSize */
+}
+
+/**
+  * @brief  USBD_VIDEO_Start
+  *         Start streaming the committed format from a new frame
+  * @param  pdev: device instance
+  * @retval None
+  */
+static void  USBD_VIDEO_Start (USBD_HandleTypeDef *pdev)
+{
+  USBD_VIDEO_HandleTypeDef   *hvideo = (USBD_VIDEO_HandleTypeDef*) pdev->pClassData;
+
+  hvideo->Head = 0U;
+  hvideo->Tail = 0U;
+  hvideo->Offset = 0U;
+  hvideo->TxState = VIDEO_TX_IDLE;
+  hvideo->Fid = 0U;
+  hvideo->Streaming = 1U;
+
+  ((USBD_VIDEO_ItfTypeDef *)pdev->pUserData)->Start(hvideo->Probe[2], hvideo->Probe[3]);
+}
+
+/**
+  * @brief  USBD_VIDEO_Stop
+  *         Stop streaming: the chunks queued are given back to the
+  *         application
+  * @param  pdev: device instance
+  * @retval None
+  */
+static void  USBD_VIDEO_Stop (USBD_HandleTypeDef *pdev)
+{
+  USBD_VIDEO_HandleTypeDef   *hvideo = (USBD_VIDEO_HandleTypeDef*) pdev->pClassData;
+  USBD_VIDEO_ItfTypeDef      *itf = (USBD_VIDEO_ItfTypeDef *)pdev->pUserData;
+  USBD_VIDEO_ChunkTypeDef    *chunk;
+
+  if (hvideo->Streaming == 0U)
+  {
+    return;
+  }
+
+  hvideo->Streaming = 0U;
+  itf->Stop();
+
+  USBD_LL_FlushEP(pdev, VIDEO_IN_EP);
+  hvideo->TxState = VIDEO_TX_IDLE;
+
+  while (hvideo->Tail != hvideo->Head)
+  {
+    chunk = &hvideo->Chunks[hvideo->Tail % USBD_VIDEO_MAX_CHUNKS];
+    hvideo->Tail++;
+    itf->ChunkDone(chunk->pData, chunk->Length);
+  }
+}
+
+/**
+  * @brief  USBD_VIDEO_Kick
+  *         Send the next payload of the chunk queue when the endpoint is
+  *         idle. The payload header is written in the chunk, over bytes
+  *         already sent or in its headroom: only the first payload of a
+  *         chunk without headroom is copied, to the stage buffer.
+  * @param  pdev: device instance
+  * @retval None
+  */
+static void  USBD_VIDEO_Kick (USBD_HandleTypeDef *pdev)
+{
+  USBD_VIDEO_HandleTypeDef   *hvideo = (USBD_VIDEO_HandleTypeDef*) pdev->pClassData;
+  USBD_VIDEO_ChunkTypeDef    *chunk;
+  uint8_t *pbuf;
+  uint32_t length;
+  uint32_t i;
+
+  if ((hvideo->TxState != VIDEO_TX_IDLE) || (hvideo->Tail == hvideo->Head))
+  {
+    return;
+  }
+
+  chunk = &hvideo->Chunks[hvideo->Tail % USBD_VIDEO_MAX_CHUNKS];
+  length = chunk->Length - hvideo->Offset;
+
+  if ((hvideo->Offset == 0U) && ((chunk->Flags & USBD_VIDEO_CHUNK_HEADROOM) == 0U))
+  {
+    length = MIN(length, MIN(sizeof (hvideo->Stage), hvideo->MaxPayload) - USBD_VIDEO_HEADER_SIZE);
+    pbuf = (uint8_t *)(void *)hvideo->Stage;
+    USBD_memcpy(&pbuf[USBD_VIDEO_HEADER_SIZE], chunk->pData, length);
+    hvideo->Staged++;
+  }
+  else
+  {
+    length = MIN(length, hvideo->MaxPayload - USBD_VIDEO_HEADER_SIZE);
+    pbuf = &chunk->pData[hvideo->Offset] - USBD_VIDEO_HEADER_SIZE;
+  }
+
+  pbuf[0] = USBD_VIDEO_HEADER_SIZE;
+  pbuf[1] = VIDEO_HEADER_EOH | hvideo->Fid;
+  if (((chunk->Flags & USBD_VIDEO_CHUNK_EOF) != 0U) && ((hvideo->Offset + length) == chunk->Length))
+  {
+    pbuf[1] |= VIDEO_HEADER_EOF;
+  }
+  for (i = 2U; i < USBD_VIDEO_HEADER_SIZE; i++)
+  {
+    pbuf[i] = 0U;
+  }
+
+  hvideo->pTx = pbuf;
+  hvideo->TxSize = length + USBD_VIDEO_HEADER_SIZE;
+  hvideo->TxData = length;
+  hvideo->TxState = VIDEO_TX_PAYLOAD;
+
+  USBD_LL_Transmit(pdev, VIDEO_IN_EP, pbuf, (uint16_t)hvideo->TxSize);
+}
+
+/**
+  * @brief  USBD_VIDEO_Put32
+  *         Store a 32-bit value in little endian order
+  * @param  pbuf: destination
+  * @param  value: value stored
+  * @retval None
+  */
+static void  USBD_VIDEO_Put32 (uint8_t *pbuf, uint32_t value)
+{
+  pbuf[0] = (uint8_t)value;
+  pbuf[1] = (uint8_t)(value >> 8);
+  pbuf[2] = (uint8_t)(value >> 16);
+  pbuf[3] = (uint8_t)(value >> 24);
+}
+
+/**
+* @brief  USBD_VIDEO_RegisterInterface
+* @param  fops: Video interface callback
+* @retval status
+*/
+uint8_t  USBD_VIDEO_RegisterInterface  (USBD_HandleTypeDef   *pdev,
+                                        USBD_VIDEO_ItfTypeDef *fops)
+{
+  if(fops != NULL)
+  {
+    pdev->pUserData= fops;
+  }
+  return USBD_OK;
+}
+
+/**
+  * @brief  USBD_VIDEO_Submit
+  *         Queue a chunk of the frame being streamed: a DCMI capture block or
+  *         a JPEG codec output buffer, sent in place and given back with the
+  *         interface ChunkDone() once sent.
+  * @note   The USBD_VIDEO_HEADER_SIZE bytes in front of each payload are
+  *         overwritten by its header: the chunk is not kept intact. With
+  *         USBD_VIDEO_CHUNK_HEADROOM the bytes in front of pData are used
+  *         too and no byte is copied; pData must then be word aligned.
+  * @param  pdev: device instance
+  * @param  pData: chunk
+  * @param  Length: chunk length in bytes, a multiple of 4 but for the last
+  *         chunk of a frame
+  * @param  Flags: USBD_VIDEO_CHUNK_EOF for the last chunk of a frame,
+  *         USBD_VIDEO_CHUNK_HEADROOM
+  * @retval USBD_OK, USBD_BUSY when the queue is full, USBD_FAIL when the
+  *         host is not streaming
+  */
+uint8_t  USBD_VIDEO_Submit (USBD_HandleTypeDef *pdev, uint8_t *pData,
+                            uint32_t Length, uint32_t Flags)
+{
+  USBD_VIDEO_HandleTypeDef   *hvideo = (USBD_VIDEO_HandleTypeDef*) pdev->pClassData;
+  USBD_VIDEO_ChunkTypeDef    *chunk;
+
+  if ((hvideo == NULL) || (hvideo->Streaming == 0U))
+  {
+    return USBD_FAIL;
+  }
+
+  if ((hvideo->Head - hvideo->Tail) >= USBD_VIDEO_MAX_CHUNKS)
+  {
+    return USBD_BUSY;
+  }
+
+  chunk = &hvideo->Chunks[hvideo->Head % USBD_VIDEO_MAX_CHUNKS];
+  chunk->pData = pData;
+  chunk->Length = Length;
+  chunk->Flags = Flags;
+  hvideo->Head++;
+
+  USBD_VIDEO_Kick(pdev);
+
+  return USBD_OK;
+}
+/**
+  * @}
+  */
+
+
+/**
+  * @}
+  */
+
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
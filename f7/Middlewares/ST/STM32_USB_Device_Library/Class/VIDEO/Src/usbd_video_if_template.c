@@ -0,0 +1,198 @@
+/**
+  ******************************************************************************
+  * @file    usbd_video_if_template.c
+  * @author  MCD Application Team
+  * @brief   Generic media access Layer.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics International N.V.
+  * All rights reserved.</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without
+  * modification, are permitted, provided that the following conditions are met:
+  *
+  * 1. Redistribution of source code must retain the above copyright notice,
+  *    this list of conditions and the following disclaimer.
+  * 2. Redistributions in binary form must reproduce the above copyright notice,
+  *    this list of conditions and the following disclaimer in the documentation
+  *    and/or other materials provided with the distribution.
+  * 3. Neither the name of STMicroelectronics nor the names of other
+  *    contributors to this software may be used to endorse or promote products
+  *    derived from this software without specific written permission.
+  * 4. This software, including modifications and/or derivative works of this
+  *    software, must execute solely and exclusively on microcontroller or
+  *    microprocessor devices manufactured by or for STMicroelectronics.
+  * 5. Redistribution and use of this software other than as permitted under
+  *    this license is void and will automatically terminate your rights under
+  *    this license.
+  *
+  * THIS SOFTWARE IS PROVIDED BY STMICROELECTRONICS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS, IMPLIED OR STATUTORY WARRANTIES, INCLUDING, BUT NOT
+  * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+  * PARTICULAR PURPOSE AND NON-INFRINGEMENT OF THIRD PARTY INTELLECTUAL PROPERTY
+  * RIGHTS ARE DISCLAIMED TO THE FULLEST EXTENT PERMITTED BY LAW. IN NO EVENT
+  * SHALL STMICROELECTRONICS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+  * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+  * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+  /* BSPDependencies
+  - "stm32xxxxx_{eval}{discovery}.c"
+  - "stm32xxxxx_{eval}{discovery}_camera.c"
+  EndBSPDependencies */
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbd_video_if_template.h"
+
+/** @addtogroup STM32_USB_DEVICE_LIBRARY
+  * @{
+  */
+
+
+/** @defgroup USBD_VIDEO
+  * @brief usbd core module
+  * @{
+  */
+
+/** @defgroup USBD_VIDEO_Private_TypesDefinitions
+  * @{
+  */
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_VIDEO_Private_Defines
+  * @{
+  */
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_VIDEO_Private_Macros
+  * @{
+  */
+
+/**
+  * @}
+  */
+
+
+/** @defgroup USBD_VIDEO_Private_FunctionPrototypes
+  * @{
+  */
+
+static int8_t  TEMPLATE_Init         (void);
+static int8_t  TEMPLATE_DeInit       (void);
+static int8_t  TEMPLATE_Start        (uint8_t FormatIndex, uint8_t FrameIndex);
+static int8_t  TEMPLATE_Stop         (void);
+static int8_t  TEMPLATE_ChunkDone    (uint8_t *pData, uint32_t Length);
+
+USBD_VIDEO_ItfTypeDef USBD_VIDEO_Template_fops =
+{
+  TEMPLATE_Init,
+  TEMPLATE_DeInit,
+  TEMPLATE_Start,
+  TEMPLATE_Stop,
+  TEMPLATE_ChunkDone,
+};
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  TEMPLATE_Init
+  *         Initializes the VIDEO media low layer
+  * @param  None
+  * @retval Result of the operation: USBD_OK if all operations are OK else USBD_FAIL
+  */
+static int8_t TEMPLATE_Init(void)
+{
+  /*
+     Add your initialization code here
+  */
+  return (0);
+}
+
+/**
+  * @brief  TEMPLATE_DeInit
+  *         DeInitializes the VIDEO media low layer
+  * @param  None
+  * @retval Result of the operation: USBD_OK if all operations are OK else USBD_FAIL
+  */
+static int8_t TEMPLATE_DeInit(void)
+{
+  /*
+     Add your deinitialization code here
+  */
+  return (0);
+}
+
+/**
+  * @brief  TEMPLATE_Start
+  *         The host starts streaming: start the capture in the format
+  *         selected. Each capture buffer is then queued with
+  *         USBD_VIDEO_Submit() as it fills:
+  *           - from DCMI_Stream_BlockCallback() for the blocks of
+  *             Utilities/Camera/dcmi_stream, USBD_VIDEO_CHUNK_EOF on the
+  *             block flagged DCMI_STREAM_FLAG_LAST; a sensor in JPEG mode
+  *             gives the MJPEG format directly
+  *           - from HAL_JPEG_DataReadyCallback() for the JPEG codec output
+  *             buffers, USBD_VIDEO_CHUNK_EOF on the last one of the frame:
+  *             with USBD_VIDEO_HEADER_SIZE bytes reserved in front of each
+  *             output buffer (USBD_VIDEO_CHUNK_HEADROOM) no byte is copied
+  * @param  FormatIndex: VIDEO_FORMAT_MJPEG or VIDEO_FORMAT_UNCOMPRESSED
+  * @param  FrameIndex: frame of the format
+  * @retval Result of the operation: USBD_OK if all operations are OK else USBD_FAIL
+  */
+static int8_t TEMPLATE_Start(uint8_t FormatIndex, uint8_t FrameIndex)
+{
+
+  return (0);
+}
+
+/**
+  * @brief  TEMPLATE_Stop
+  *         The host stops streaming: stop the capture
+  * @param  None
+  * @retval Result of the operation: USBD_OK if all operations are OK else USBD_FAIL
+  */
+static int8_t TEMPLATE_Stop(void)
+{
+
+  return (0);
+}
+
+/**
+  * @brief  TEMPLATE_ChunkDone
+  *         A chunk is sent, or dropped on stop: give the capture buffer back
+  *         (DCMI_Stream_Release(), HAL_JPEG_ConfigOutputBuffer())
+  * @param  pData: chunk given to USBD_VIDEO_Submit()
+  * @param  Length: its length
+  * @retval Result of the operation: USBD_OK if all operations are OK else USBD_FAIL
+  */
+static int8_t TEMPLATE_ChunkDone(uint8_t *pData, uint32_t Length)
+{
+
+  return (0);
+}
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
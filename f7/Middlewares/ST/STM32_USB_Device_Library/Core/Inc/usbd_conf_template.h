@@ -76,6 +76,9 @@
 #define USBD_SUPPORT_USER_STRING              0U
 #define USBD_SELF_POWERED                     1U
 #define USBD_DEBUG_LEVEL                      2U
+/* 1U requires USBD_LL_GetFifoSize(), USBD_LL_SetRxFifo() and
+   USBD_LL_SetTxFifo() in usbd_conf.c */
+#define USBD_AUTO_FIFO                        0U
 
 /* MSC Class Config */
 #define MSC_MEDIA_PACKET                       8192U
@@ -113,6 +113,10 @@ USBD_StatusTypeDef USBD_DeInit(USBD_HandleTypeDef *pdev);
 USBD_StatusTypeDef USBD_Start  (USBD_HandleTypeDef *pdev);
 USBD_StatusTypeDef USBD_Stop   (USBD_HandleTypeDef *pdev);
 USBD_StatusTypeDef USBD_RegisterClass(USBD_HandleTypeDef *pdev, USBD_ClassTypeDef *pclass);
+#if (USBD_AUTO_FIFO == 1U)
+USBD_StatusTypeDef USBD_SetupFifo(USBD_HandleTypeDef *pdev);
+USBD_StatusTypeDef USBD_GetFifoLayout(USBD_HandleTypeDef *pdev, USBD_FifoLayoutTypeDef *layout);
+#endif
 
 USBD_StatusTypeDef USBD_RunTestMode (USBD_HandleTypeDef  *pdev);
 USBD_StatusTypeDef USBD_SetClassConfig(USBD_HandleTypeDef  *pdev, uint8_t cfgidx);
@@ -161,6 +165,11 @@ USBD_StatusTypeDef  USBD_LL_PrepareReceive(USBD_HandleTypeDef *pdev,
                                            uint16_t  size);
 
 uint32_t USBD_LL_GetRxDataSize  (USBD_HandleTypeDef *pdev, uint8_t  ep_addr);
+#if (USBD_AUTO_FIFO == 1U)
+uint16_t USBD_LL_GetFifoSize (USBD_HandleTypeDef *pdev);
+USBD_StatusTypeDef  USBD_LL_SetRxFifo (USBD_HandleTypeDef *pdev, uint16_t size);
+USBD_StatusTypeDef  USBD_LL_SetTxFifo (USBD_HandleTypeDef *pdev, uint8_t fifo, uint16_t size);
+#endif
 void  USBD_LL_Delay (uint32_t Delay);
 
 /**
@@ -83,6 +83,13 @@
 #define USBD_LPM_ENABLED                                0U
 #endif /* USBD_LPM_ENABLED */
 
+/* 1U: the FIFOs are sized by USBD_Start() from the class descriptors, the
+   usbd_conf.c must then provide USBD_LL_GetFifoSize(), USBD_LL_SetRxFifo()
+   and USBD_LL_SetTxFifo() */
+#ifndef USBD_AUTO_FIFO
+#define USBD_AUTO_FIFO                                  0U
+#endif /* USBD_AUTO_FIFO */
+
 #ifndef USBD_SELF_POWERED
 #define USBD_SELF_POWERED                               1U
 #endif /*USBD_SELF_POWERED */
@@ -249,6 +256,16 @@ typedef struct
 #endif
 } USBD_DescriptorsTypeDef;
 
+/* USB Device FIFO layout, sizes in 32-bit words */
+typedef struct
+{
+  uint16_t                total;
+  uint16_t                rx_size;
+  uint16_t                tx_size[16];
+  uint16_t                free;
+  uint8_t                 tx_count;
+} USBD_FifoLayoutTypeDef;
+
 /* USB Device handle structure */
 typedef struct
 {
@@ -284,6 +301,9 @@ typedef struct _USBD_HandleTypeDef
   void                    *pClassData;
   void                    *pUserData;
   void                    *pData;
+#if (USBD_AUTO_FIFO == 1U)
+  USBD_FifoLayoutTypeDef  fifo_layout;
+#endif
 } USBD_HandleTypeDef;
 
 /**
@@ -218,6 +218,43 @@ uint32_t USBD_LL_GetRxDataSize(USBD_HandleTypeDef *pdev, uint8_t ep_addr)
   return 0;
 }
 
+#if (USBD_AUTO_FIFO == 1U)
+/**
+  * @brief  Returns the size of the USB FIFO RAM.
+  * @note   OTG_FS: 320 words (1.25 Kbytes), OTG_HS: 1024 words (4 Kbytes).
+  * @param  pdev: Device handle
+  * @retval FIFO RAM size in 32-bit words, 0 to keep the FIFOs set in USBD_LL_Init
+  */
+uint16_t USBD_LL_GetFifoSize(USBD_HandleTypeDef *pdev)
+{
+  return 0;
+}
+
+/**
+  * @brief  Sets the size of the RX FIFO (HAL_PCDEx_SetRxFiFo).
+  * @param  pdev: Device handle
+  * @param  size: Size in 32-bit words
+  * @retval USBD Status
+  */
+USBD_StatusTypeDef USBD_LL_SetRxFifo(USBD_HandleTypeDef *pdev, uint16_t size)
+{
+  return USBD_OK;
+}
+
+/**
+  * @brief  Sets the size of a TX FIFO (HAL_PCDEx_SetTxFiFo), called in
+  *         increasing fifo order.
+  * @param  pdev: Device handle
+  * @param  fifo: IN endpoint number
+  * @param  size: Size in 32-bit words
+  * @retval USBD Status
+  */
+USBD_StatusTypeDef USBD_LL_SetTxFifo(USBD_HandleTypeDef *pdev, uint8_t fifo, uint16_t size)
+{
+  return USBD_OK;
+}
+#endif /* USBD_AUTO_FIFO */
+
 /**
   * @brief  Delays routine for the USB Device Library.
   * @param  Delay: Delay in ms
@@ -67,7 +67,8 @@
 /** @defgroup USBD_CORE_Private_Defines
 * @{
 */
-
+#define USBD_FIFO_FS_SIZE          320U   /* OTG_FS FIFO RAM, in words */
+#define USBD_FIFO_MIN_TX_SIZE      16U    /* Minimum TX FIFO size, in words */
 /**
 * @}
 */
@@ -86,6 +87,11 @@
 /** @defgroup USBD_CORE_Private_FunctionPrototypes
 * @{
 */
+#if (USBD_AUTO_FIFO == 1U)
+static USBD_StatusTypeDef USBD_ComputeFifoLayout(uint8_t *pdesc, uint16_t len,
+                                                 uint16_t total,
+                                                 USBD_FifoLayoutTypeDef *layout);
+#endif
 
 /**
 * @}
@@ -201,6 +207,11 @@ USBD_StatusTypeDef  USBD_RegisterClass(USBD_HandleTypeDef *pdev, USBD_ClassTypeD
   */
 USBD_StatusTypeDef  USBD_Start  (USBD_HandleTypeDef *pdev)
 {
+#if (USBD_AUTO_FIFO == 1U)
+  /* Size the FIFOs from the class descriptors, the layout set in
+     USBD_LL_Init() is kept if it fails */
+  (void)USBD_SetupFifo(pdev);
+#endif
 
   /* Start the low level driver  */
   USBD_LL_Start(pdev);
@@ -208,6 +219,199 @@ USBD_StatusTypeDef  USBD_Start  (USBD_HandleTypeDef *pdev)
   return USBD_OK;
 }
 
+#if (USBD_AUTO_FIFO == 1U)
+/**
+  * @brief  USBD_SetupFifo
+  *         Compute the FIFO layout from the configuration descriptor of the
+  *         registered class and program it.
+  *         The HS descriptor is used on a core with 4 Kbytes of FIFO RAM
+  *         (the FS one if the HS layout does not fit), the FS descriptor
+  *         otherwise.
+  * @param  pdev: Device Handle
+  * @retval USBD Status, USBD_FAIL when the endpoints do not fit in the FIFO RAM
+  */
+USBD_StatusTypeDef  USBD_SetupFifo(USBD_HandleTypeDef *pdev)
+{
+  USBD_FifoLayoutTypeDef layout;
+  USBD_StatusTypeDef ret = USBD_FAIL;
+  uint16_t total = USBD_LL_GetFifoSize(pdev);
+  uint16_t len;
+  uint8_t *pdesc;
+  uint8_t fifo;
+
+  if((pdev->pClass == NULL) || (total == 0U))
+  {
+    return USBD_FAIL;
+  }
+
+  if((total > USBD_FIFO_FS_SIZE) && (pdev->pClass->GetHSConfigDescriptor != NULL))
+  {
+    pdesc = pdev->pClass->GetHSConfigDescriptor(&len);
+    ret = USBD_ComputeFifoLayout(pdesc, len, total, &layout);
+  }
+  if((ret != USBD_OK) && (pdev->pClass->GetFSConfigDescriptor != NULL))
+  {
+    pdesc = pdev->pClass->GetFSConfigDescriptor(&len);
+    ret = USBD_ComputeFifoLayout(pdesc, len, total, &layout);
+  }
+
+  if(ret == USBD_OK)
+  {
+    (void)USBD_LL_SetRxFifo(pdev, layout.rx_size);
+    for(fifo = 0U; fifo < layout.tx_count; fifo++)
+    {
+      (void)USBD_LL_SetTxFifo(pdev, fifo, layout.tx_size[fifo]);
+    }
+    pdev->fifo_layout = layout;
+  }
+#if (USBD_DEBUG_LEVEL > 1U)
+  else
+  {
+    USBD_ErrLog("Endpoints do not fit in the FIFO RAM");
+  }
+#endif
+
+  return ret;
+}
+
+/**
+  * @brief  USBD_GetFifoLayout
+  *         Return the FIFO layout programmed by USBD_SetupFifo()
+  * @param  pdev: Device Handle
+  * @param  layout: returns the layout, sizes in 32-bit words
+  * @retval USBD Status, USBD_FAIL if no layout has been programmed
+  */
+USBD_StatusTypeDef  USBD_GetFifoLayout(USBD_HandleTypeDef *pdev, USBD_FifoLayoutTypeDef *layout)
+{
+  if(pdev->fifo_layout.total == 0U)
+  {
+    return USBD_FAIL;
+  }
+
+  *layout = pdev->fifo_layout;
+  return USBD_OK;
+}
+
+/**
+  * @brief  USBD_ComputeFifoLayout
+  *         Size the FIFOs for the endpoints of a configuration descriptor.
+  *         The RX FIFO holds the SETUP packets, the largest OUT packet with
+  *         its status, the transfer complete status of each OUT endpoint and
+  *         the global NAK status; each TX FIFO one packet of its endpoint.
+  *         Isochronous endpoints get room for two (micro)frames. The space
+  *         left then goes to a second OUT packet and to a second packet for
+  *         each bulk IN endpoint, in endpoint order.
+  * @param  pdesc: configuration descriptor
+  * @param  len: descriptor length
+  * @param  total: FIFO RAM size in 32-bit words
+  * @param  layout: returns the layout
+  * @retval USBD Status
+  */
+static USBD_StatusTypeDef USBD_ComputeFifoLayout(uint8_t *pdesc, uint16_t len,
+                                                 uint16_t total,
+                                                 USBD_FifoLayoutTypeDef *layout)
+{
+  uint16_t pos;
+  uint16_t wmps;
+  uint16_t words;
+  uint16_t used;
+  uint16_t bulk_in = 0U;
+  uint16_t rx_packet = USB_MAX_EP0_SIZE / 4U;
+  uint16_t out_count = 1U;
+  uint8_t  iso_out = 0U;
+  uint8_t  ep;
+
+  for(ep = 0U; ep < 16U; ep++)
+  {
+    layout->tx_size[ep] = 0U;
+  }
+  layout->tx_size[0] = USBD_FIFO_MIN_TX_SIZE;
+  layout->tx_count = 1U;
+
+  for(pos = pdesc[0]; ((pos + 1U) < len) && (pdesc[pos] != 0U); pos += pdesc[pos])
+  {
+    if(pdesc[pos + 1U] != USB_DESC_TYPE_ENDPOINT)
+    {
+      continue;
+    }
+
+    ep = pdesc[pos + 2U] & 0xFU;
+    wmps = (uint16_t)pdesc[pos + 4U] | ((uint16_t)pdesc[pos + 5U] << 8);
+    /* Packet size times the number of transactions per microframe */
+    words = (uint16_t)((((wmps & 0x7FFU) + 3U) / 4U) * (((wmps >> 11) & 0x3U) + 1U));
+
+    if((pdesc[pos + 2U] & 0x80U) == 0x80U)
+    {
+      if((pdesc[pos + 3U] & 0x3U) == USBD_EP_TYPE_ISOC)
+      {
+        words *= 2U;
+      }
+      else if((pdesc[pos + 3U] & 0x3U) == USBD_EP_TYPE_BULK)
+      {
+        bulk_in |= (uint16_t)(1U << ep);
+      }
+      else
+      {
+      }
+      layout->tx_size[ep] = MAX(layout->tx_size[ep], MAX(words, USBD_FIFO_MIN_TX_SIZE));
+      layout->tx_count = MAX(layout->tx_count, ep + 1U);
+    }
+    else
+    {
+      rx_packet = MAX(rx_packet, words);
+      out_count++;
+      if((pdesc[pos + 3U] & 0x3U) == USBD_EP_TYPE_ISOC)
+      {
+        iso_out = 1U;
+      }
+    }
+  }
+
+  /* Endpoints whose number is lower than the last IN endpoint but unused
+     still get the minimum size */
+  for(ep = 1U; ep < layout->tx_count; ep++)
+  {
+    layout->tx_size[ep] = MAX(layout->tx_size[ep], USBD_FIFO_MIN_TX_SIZE);
+  }
+
+  layout->rx_size = (uint16_t)(13U + (rx_packet + 1U) + (2U * out_count) + 1U);
+  if(iso_out != 0U)
+  {
+    layout->rx_size += rx_packet;
+  }
+
+  used = layout->rx_size;
+  for(ep = 0U; ep < layout->tx_count; ep++)
+  {
+    used += layout->tx_size[ep];
+  }
+  if(used > total)
+  {
+    return USBD_FAIL;
+  }
+
+  /* Spare RAM: back to back OUT packets, then double buffered bulk IN */
+  if((iso_out == 0U) && ((used + rx_packet) <= total))
+  {
+    layout->rx_size += rx_packet;
+    used += rx_packet;
+  }
+  for(ep = 1U; ep < layout->tx_count; ep++)
+  {
+    if(((bulk_in & (1U << ep)) != 0U) && ((used + layout->tx_size[ep]) <= total))
+    {
+      used += layout->tx_size[ep];
+      layout->tx_size[ep] *= 2U;
+    }
+  }
+
+  layout->total = total;
+  layout->free = total - used;
+
+  return USBD_OK;
+}
+#endif /* USBD_AUTO_FIFO */
+
 /**
   * @brief  USBD_Stop
   *         Stop the USB Device Core.
@@ -552,10 +756,13 @@ USBD_StatusTypeDef USBD_LL_SOF(USBD_HandleTypeDef  *pdev)
 */
 USBD_StatusTypeDef USBD_LL_IsoINIncomplete(USBD_HandleTypeDef  *pdev, uint8_t epnum)
 {
-  /* Prevent unused arguments compilation warning */
-  UNUSED(pdev);
-  UNUSED(epnum);
-
+  if(pdev->dev_state == USBD_STATE_CONFIGURED)
+  {
+    if(pdev->pClass->IsoINIncomplete != NULL)
+    {
+      pdev->pClass->IsoINIncomplete(pdev, epnum);
+    }
+  }
   return USBD_OK;
 }
 
@@ -567,10 +774,13 @@ USBD_StatusTypeDef USBD_LL_IsoINIncomplete(USBD_HandleTypeDef  *pdev, uint8_t ep
 */
 USBD_StatusTypeDef USBD_LL_IsoOUTIncomplete(USBD_HandleTypeDef  *pdev, uint8_t epnum)
 {
-  /* Prevent unused arguments compilation warning */
-  UNUSED(pdev);
-  UNUSED(epnum);
-
+  if(pdev->dev_state == USBD_STATE_CONFIGURED)
+  {
+    if(pdev->pClass->IsoOUTIncomplete != NULL)
+    {
+      pdev->pClass->IsoOUTIncomplete(pdev, epnum);
+    }
+  }
   return USBD_OK;
 }
 
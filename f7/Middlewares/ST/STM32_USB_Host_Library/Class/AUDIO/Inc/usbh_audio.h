@@ -56,6 +56,25 @@
   * @{
   */
 
+#if (USBH_USE_PIPE_QUEUE == 1U)
+/* Isochronous OUT packets queued ahead on the headphone pipe */
+#ifndef USBH_AUDIO_STREAM_PACKETS
+#define USBH_AUDIO_STREAM_PACKETS                   2U
+#endif
+
+/* Packet buffer size, multiple of 4: 48 kHz 16-bit stereo with one more
+   sample frame per packet for the rate adjustment */
+#ifndef USBH_AUDIO_STREAM_PACKET_SIZE
+#define USBH_AUDIO_STREAM_PACKET_SIZE               196U
+#endif
+
+/* Feedback endpoint polling period, 2^N frames, when the endpoint
+   descriptor gives no bRefresh */
+#ifndef USBH_AUDIO_FEEDBACK_REFRESH
+#define USBH_AUDIO_FEEDBACK_REFRESH                 5U
+#endif
+#endif
+
 /* States for AUDIO State Machine */
 typedef enum
 {
@@ -115,6 +134,9 @@ typedef enum
  AUDIO_PLAYBACK_SET_EP_FREQ,
  AUDIO_PLAYBACK_PLAY,
  AUDIO_PLAYBACK_IDLE,
+#if (USBH_USE_PIPE_QUEUE == 1U)
+ AUDIO_PLAYBACK_STREAM,
+#endif
 }
 AUDIO_PlayStateTypeDef;
 
@@ -171,6 +193,10 @@ typedef struct
   uint8_t              interface;
   uint8_t              valid;
   uint16_t             Poll;
+#if (USBH_USE_PIPE_QUEUE == 1U)
+  uint8_t              FbEp;
+  uint16_t             FbEpSize;
+#endif
 }
 AUDIO_STREAMING_OUT_HandleTypeDef;
 
@@ -218,6 +244,43 @@ typedef struct
 }
 AUDIO_InterfaceStreamPropTypeDef;
 
+#if (USBH_USE_PIPE_QUEUE == 1U)
+/* Isochronous OUT stream, fed from an application ring and scheduled from
+   the HCD interrupt: one packet per frame, sized by the 10.14 samples per
+   frame rate, nominal or read from the feedback endpoint */
+typedef struct
+{
+  uint8_t              *pRing;
+  uint32_t              Size;
+  __IO uint32_t         Head;          /* bytes written by the application */
+  __IO uint32_t         Tail;          /* bytes sent                       */
+
+  uint32_t              Nominal;       /* 10.14 sample frames per frame    */
+  __IO uint32_t         Rate;          /* 10.14 sample frames per frame    */
+  uint32_t              Accum;         /* fraction carried to next packet  */
+  uint16_t              MaxLength;     /* largest packet allowed           */
+  uint8_t               SampleBytes;   /* bytes per sample frame           */
+  __IO uint8_t          Active;
+
+  __IO uint32_t         Packets;
+  __IO uint32_t         Underruns;
+  __IO uint32_t         Errors;
+
+  USBH_PipeReqTypeDef   Req[USBH_AUDIO_STREAM_PACKETS];
+  uint32_t              Packet[USBH_AUDIO_STREAM_PACKETS][USBH_AUDIO_STREAM_PACKET_SIZE / 4U];
+
+  uint8_t               FbEp;
+  uint8_t               FbPipe;
+  uint16_t              FbEpSize;
+  uint8_t               FbRefresh;     /* polled every 2^FbRefresh frames  */
+  __IO uint8_t          FbBusy;
+  uint32_t              FbTimer;
+  USBH_PipeReqTypeDef   FbReq;
+  uint32_t              FbData;
+}
+AUDIO_OutStreamTypeDef;
+#endif
+
 typedef struct
 {
 
@@ -423,6 +486,9 @@ typedef struct _AUDIO_Process
   uint16_t                            mem [8];
   uint8_t                            temp_feature;
   uint8_t                            temp_channels;
+#if (USBH_USE_PIPE_QUEUE == 1U)
+  AUDIO_OutStreamTypeDef             out_stream;
+#endif
 }
 AUDIO_HandleTypeDef;
 
@@ -559,6 +625,15 @@ USBH_StatusTypeDef USBH_AUDIO_SetVolume (USBH_HandleTypeDef *phost, AUDIO_Volume
 USBH_StatusTypeDef USBH_AUDIO_ChangeOutBuffer (USBH_HandleTypeDef *phost, uint8_t *buf);
 int32_t            USBH_AUDIO_GetOutOffset (USBH_HandleTypeDef *phost);
 
+#if (USBH_USE_PIPE_QUEUE == 1U)
+USBH_StatusTypeDef USBH_AUDIO_StartStream (USBH_HandleTypeDef *phost, uint8_t *pRing, uint32_t size);
+USBH_StatusTypeDef USBH_AUDIO_StopStream (USBH_HandleTypeDef *phost);
+uint32_t           USBH_AUDIO_StreamWrite (USBH_HandleTypeDef *phost, uint8_t *pData, uint32_t length);
+uint32_t           USBH_AUDIO_GetStreamLevel (USBH_HandleTypeDef *phost);
+uint32_t           USBH_AUDIO_GetStreamUnderruns (USBH_HandleTypeDef *phost);
+uint32_t           USBH_AUDIO_GetFeedback (USBH_HandleTypeDef *phost);
+#endif
+
 void        USBH_AUDIO_FrequencySet(USBH_HandleTypeDef *phost);
 
 #define     USBH_AUDIO_FrequencySetCallback   USBH_AUDIO_FrequencySet
@@ -150,6 +150,12 @@ static USBH_StatusTypeDef ParseCSDescriptors(AUDIO_ClassSpecificDescTypedef *cla
 
 static USBH_StatusTypeDef USBH_AUDIO_Transmit (USBH_HandleTypeDef *phost);
 
+#if (USBH_USE_PIPE_QUEUE == 1U)
+static void USBH_AUDIO_StreamFill (AUDIO_OutStreamTypeDef *stream, USBH_PipeReqTypeDef *req);
+static void USBH_AUDIO_StreamCallback (USBH_HandleTypeDef *phost, USBH_PipeReqTypeDef *req);
+static void USBH_AUDIO_FeedbackCallback (USBH_HandleTypeDef *phost, USBH_PipeReqTypeDef *req);
+#endif
+
 
 static USBH_StatusTypeDef USBH_AC_SetCur(USBH_HandleTypeDef *phost,
                                          uint8_t subtype,
@@ -274,6 +280,11 @@ static USBH_StatusTypeDef USBH_AUDIO_InterfaceInit (USBH_HandleTypeDef *phost)
             AUDIO_Handle->headphone.EpSize = AUDIO_Handle->stream_out[index].EpSize;
             AUDIO_Handle->headphone.Poll = (uint8_t)AUDIO_Handle->stream_out[index].Poll;
             AUDIO_Handle->headphone.supported = 1U;
+#if (USBH_USE_PIPE_QUEUE == 1U)
+            AUDIO_Handle->out_stream.FbEp = AUDIO_Handle->stream_out[index].FbEp;
+            AUDIO_Handle->out_stream.FbEpSize = AUDIO_Handle->stream_out[index].FbEpSize;
+            AUDIO_Handle->out_stream.FbRefresh = USBH_AUDIO_FEEDBACK_REFRESH;
+#endif
           }
         }
 
@@ -319,6 +330,23 @@ static USBH_StatusTypeDef USBH_AUDIO_InterfaceInit (USBH_HandleTypeDef *phost)
 
         USBH_LL_SetToggle (phost,  AUDIO_Handle->headphone.Pipe, 0U);
 
+#if (USBH_USE_PIPE_QUEUE == 1U)
+        if(AUDIO_Handle->out_stream.FbEp != 0U)
+        {
+          AUDIO_Handle->out_stream.FbPipe = USBH_AllocPipe(phost, AUDIO_Handle->out_stream.FbEp);
+
+          /* Open pipe for feedback IN endpoint */
+          USBH_OpenPipe  (phost,
+                          AUDIO_Handle->out_stream.FbPipe,
+                          AUDIO_Handle->out_stream.FbEp,
+                          phost->device.address,
+                          phost->device.speed,
+                          USB_EP_TYPE_ISOC,
+                          AUDIO_Handle->out_stream.FbEpSize);
+
+          USBH_LL_SetToggle (phost,  AUDIO_Handle->out_stream.FbPipe, 0U);
+        }
+#endif
       }
 
       if(AUDIO_Handle->microphone.supported == 1U)
@@ -383,9 +411,25 @@ static USBH_StatusTypeDef USBH_AUDIO_InterfaceDeInit (USBH_HandleTypeDef *phost)
     AUDIO_Handle->microphone.Pipe = 0U;     /* Reset the pipe as Free */
   }
 
+#if (USBH_USE_PIPE_QUEUE == 1U)
+  /* Stop the stream before its pipes are closed */
+  AUDIO_Handle->out_stream.Active = 0U;
+
+  if( AUDIO_Handle->out_stream.FbPipe != 0x00U)
+  {
+    USBH_ClosePipe(phost,  AUDIO_Handle->out_stream.FbPipe);
+    (void)USBH_CancelRequests(phost, AUDIO_Handle->out_stream.FbPipe);
+    USBH_FreePipe  (phost,  AUDIO_Handle->out_stream.FbPipe);
+    AUDIO_Handle->out_stream.FbPipe = 0U;     /* Reset the pipe as Free */
+  }
+#endif
+
   if( AUDIO_Handle->headphone.Pipe != 0x00U)
   {
     USBH_ClosePipe(phost,  AUDIO_Handle->headphone.Pipe);
+#if (USBH_USE_PIPE_QUEUE == 1U)
+    (void)USBH_CancelRequests(phost, AUDIO_Handle->headphone.Pipe);
+#endif
     USBH_FreePipe  (phost,  AUDIO_Handle->headphone.Pipe);
     AUDIO_Handle->headphone.Pipe = 0U;     /* Reset the pipe as Free */
   }
@@ -698,6 +742,45 @@ static USBH_StatusTypeDef USBH_AUDIO_Process (USBH_HandleTypeDef *phost)
   */
 static USBH_StatusTypeDef USBH_AUDIO_SOFProcess (USBH_HandleTypeDef *phost)
 {
+#if (USBH_USE_PIPE_QUEUE == 1U)
+  AUDIO_HandleTypeDef *AUDIO_Handle =  (AUDIO_HandleTypeDef *)  phost->pActiveClass->pData;
+  AUDIO_OutStreamTypeDef *stream;
+  uint32_t period;
+
+  if (AUDIO_Handle == NULL)
+  {
+    return USBH_OK;
+  }
+
+  stream = &AUDIO_Handle->out_stream;
+
+  /* Poll the feedback endpoint once per refresh period */
+  if ((stream->Active == 1U) && (stream->FbPipe != 0U))
+  {
+    period = 1UL << stream->FbRefresh;
+
+    if ((phost->Timer - stream->FbTimer) >= period)
+    {
+      if (stream->FbBusy != 0U)
+      {
+        /* No answer during the whole period: drop the request */
+        (void)USBH_CancelRequests(phost, stream->FbPipe);
+      }
+
+      stream->FbTimer = phost->Timer;
+      stream->FbBusy = 1U;
+      stream->FbReq.buff = (uint8_t *)(void *)&stream->FbData;
+      stream->FbReq.length = (stream->FbEpSize < 4U) ? stream->FbEpSize : 4U;
+      stream->FbReq.Callback = USBH_AUDIO_FeedbackCallback;
+      stream->FbReq.pContext = AUDIO_Handle;
+
+      if (USBH_SubmitRequest(phost, stream->FbPipe, &stream->FbReq) != USBH_OK)
+      {
+        stream->FbBusy = 0U;
+      }
+    }
+  }
+#endif
   return USBH_OK;
 }
 /**
@@ -771,6 +854,17 @@ static USBH_StatusTypeDef USBH_AUDIO_FindAudioStreamingOUT(USBH_HandleTypeDef *p
         AUDIO_Handle->stream_out[alt_settings].AltSettings = phost->device.CfgDesc.Itf_Desc[interface].bAlternateSetting;
         AUDIO_Handle->stream_out[alt_settings].Poll = phost->device.CfgDesc.Itf_Desc[interface].Ep_Desc[0].bInterval;
         AUDIO_Handle->stream_out[alt_settings].valid = 1U;
+#if (USBH_USE_PIPE_QUEUE == 1U)
+        /* Asynchronous sinks add an isochronous IN feedback endpoint */
+        if((phost->device.CfgDesc.Itf_Desc[interface].bNumEndpoints > 1U) &&
+           (USBH_MAX_NUM_ENDPOINTS > 1U) &&
+           ((phost->device.CfgDesc.Itf_Desc[interface].Ep_Desc[1].bEndpointAddress & 0x80U) != 0U) &&
+           ((phost->device.CfgDesc.Itf_Desc[interface].Ep_Desc[1].bmAttributes & 0x03U) == USB_EP_TYPE_ISOC))
+        {
+          AUDIO_Handle->stream_out[alt_settings].FbEp = phost->device.CfgDesc.Itf_Desc[interface].Ep_Desc[1].bEndpointAddress;
+          AUDIO_Handle->stream_out[alt_settings].FbEpSize = phost->device.CfgDesc.Itf_Desc[interface].Ep_Desc[1].wMaxPacketSize;
+        }
+#endif
         alt_settings++;
       }
     }
@@ -871,6 +965,21 @@ static USBH_StatusTypeDef USBH_AUDIO_ParseCSDescriptors(USBH_HandleTypeDef *phos
       }
       break;
 
+#if (USBH_USE_PIPE_QUEUE == 1U)
+    case USB_DESC_TYPE_ENDPOINT:
+      /* Audio endpoint descriptors carry bRefresh, 2^bRefresh ms */
+      if((pdesc->bLength >= 9U) && (AUDIO_Handle->out_stream.FbEp != 0U) &&
+         (*((uint8_t *)(void *)pdesc + 2U) == AUDIO_Handle->out_stream.FbEp))
+      {
+        alt_setting = *((uint8_t *)(void *)pdesc + 7U);
+        if((alt_setting >= 1U) && (alt_setting <= 9U))
+        {
+          AUDIO_Handle->out_stream.FbRefresh = alt_setting;
+        }
+      }
+      break;
+#endif
+
     default:
       break;
     }
@@ -1684,6 +1793,23 @@ static USBH_StatusTypeDef USBH_AUDIO_OutputStream (USBH_HandleTypeDef *phost)
     status = USBH_OK;
     break;
 
+#if (USBH_USE_PIPE_QUEUE == 1U)
+  case AUDIO_PLAYBACK_STREAM:
+    /* The packets are sent from the HCD interrupt: only the controls remain */
+    if((AUDIO_Handle->control.supported == 1U) &&
+       (( phost->Timer - AUDIO_Handle->headphone.timer) >= AUDIO_Handle->headphone.Poll))
+    {
+      AUDIO_Handle->headphone.timer = phost->Timer;
+      USBH_AUDIO_Control (phost);
+    }
+#if (USBH_USE_OS == 1U)
+    osDelay(1);
+    osMessagePut ( phost->os_event, USBH_CLASS_EVENT, 0U);
+#endif
+    status = USBH_OK;
+    break;
+#endif
+
   default:
     break;
   }
@@ -1822,6 +1948,10 @@ USBH_StatusTypeDef USBH_AUDIO_SetFrequency (USBH_HandleTypeDef *phost,
       {
         AUDIO_Handle->headphone.frequency = SampleRate;
         AUDIO_Handle->headphone.frame_length = (SampleRate * BitPerSample * NbrChannels) / 8000U;
+#if (USBH_USE_PIPE_QUEUE == 1U)
+        AUDIO_Handle->out_stream.SampleBytes = (uint8_t)((BitPerSample * NbrChannels) / 8U);
+        AUDIO_Handle->out_stream.Nominal = ((uint32_t)SampleRate << 14) / 1000U;
+#endif
         AUDIO_Handle->play_state = AUDIO_PLAYBACK_SET_EP;
         Status = USBH_OK;
 
@@ -1896,6 +2026,12 @@ USBH_StatusTypeDef USBH_AUDIO_Suspend (USBH_HandleTypeDef *phost)
       AUDIO_Handle->play_state = AUDIO_PLAYBACK_IDLE;
       Status = USBH_OK;
     }
+#if (USBH_USE_PIPE_QUEUE == 1U)
+    else if(AUDIO_Handle->play_state == AUDIO_PLAYBACK_STREAM)
+    {
+      Status = USBH_AUDIO_StopStream(phost);
+    }
+#endif
   }
   return Status;
 }
@@ -1973,6 +2109,344 @@ USBH_StatusTypeDef USBH_AUDIO_ChangeOutBuffer (USBH_HandleTypeDef *phost, uint8_
   return Status;
 }
 
+#if (USBH_USE_PIPE_QUEUE == 1U)
+/**
+  * @brief  USBH_AUDIO_StartStream
+  *         Start the isochronous playback from a ring buffer, after
+  *         USBH_AUDIO_SetFrequency(). The packets are queued ahead on the
+  *         headphone pipe and refilled from the HCD interrupt, one per frame;
+  *         silence is sent while the ring holds less than a packet.
+  * @param  phost: Host handle
+  * @param  pRing: ring buffer, filled with USBH_AUDIO_StreamWrite()
+  * @param  size: ring buffer size in bytes, a multiple of the sample frame size
+  * @retval USBH Status
+  */
+USBH_StatusTypeDef USBH_AUDIO_StartStream (USBH_HandleTypeDef *phost, uint8_t *pRing, uint32_t size)
+{
+  USBH_StatusTypeDef Status = USBH_FAIL;
+  AUDIO_HandleTypeDef *AUDIO_Handle;
+  AUDIO_OutStreamTypeDef *stream;
+  uint32_t max_length;
+  uint8_t index;
+
+  if((phost->gState == HOST_CLASS) && (pRing != NULL))
+  {
+    AUDIO_Handle =  (AUDIO_HandleTypeDef*) phost->pActiveClass->pData;
+    stream = &AUDIO_Handle->out_stream;
+
+    if((AUDIO_Handle->headphone.supported == 1U) &&
+       (AUDIO_Handle->play_state == AUDIO_PLAYBACK_IDLE) &&
+       (stream->SampleBytes != 0U) && (size >= stream->SampleBytes))
+    {
+      /* Nominal packet plus one sample frame for the rate adjustment */
+      max_length = ((stream->Nominal >> 14) + 2U) * stream->SampleBytes;
+      if(max_length > USBH_AUDIO_STREAM_PACKET_SIZE)
+      {
+        max_length = USBH_AUDIO_STREAM_PACKET_SIZE;
+      }
+      if(max_length > AUDIO_Handle->headphone.EpSize)
+      {
+        max_length = AUDIO_Handle->headphone.EpSize;
+      }
+
+      if(max_length >= (((stream->Nominal + 0x3FFFU) >> 14) * stream->SampleBytes))
+      {
+        stream->pRing = pRing;
+        stream->Size = size - (size % stream->SampleBytes);
+        stream->Head = 0U;
+        stream->Tail = 0U;
+        stream->Rate = stream->Nominal;
+        stream->Accum = 0U;
+        stream->MaxLength = (uint16_t)max_length;
+        stream->Packets = 0U;
+        stream->Underruns = 0U;
+        stream->Errors = 0U;
+        stream->FbBusy = 0U;
+        stream->FbTimer = phost->Timer;
+        stream->Active = 1U;
+
+        AUDIO_Handle->control_state = AUDIO_CONTROL_INIT;
+        AUDIO_Handle->headphone.timer = phost->Timer;
+        AUDIO_Handle->play_state = AUDIO_PLAYBACK_STREAM;
+
+        for(index = 0U; index < USBH_AUDIO_STREAM_PACKETS; index++)
+        {
+          stream->Req[index].buff = (uint8_t *)(void *)stream->Packet[index];
+          stream->Req[index].Callback = USBH_AUDIO_StreamCallback;
+          stream->Req[index].pContext = AUDIO_Handle;
+          USBH_AUDIO_StreamFill(stream, &stream->Req[index]);
+          (void)USBH_SubmitRequest(phost, AUDIO_Handle->headphone.Pipe, &stream->Req[index]);
+        }
+
+        Status = USBH_OK;
+#if (USBH_USE_OS == 1U)
+        osMessagePut ( phost->os_event, USBH_CLASS_EVENT, 0U);
+#endif
+      }
+    }
+  }
+  return Status;
+}
+
+/**
+  * @brief  USBH_AUDIO_StopStream
+  *         Stop the isochronous playback started by USBH_AUDIO_StartStream()
+  * @param  phost: Host handle
+  * @retval USBH Status
+  */
+USBH_StatusTypeDef USBH_AUDIO_StopStream (USBH_HandleTypeDef *phost)
+{
+  USBH_StatusTypeDef Status = USBH_FAIL;
+  AUDIO_HandleTypeDef *AUDIO_Handle;
+
+  if(phost->gState == HOST_CLASS)
+  {
+    AUDIO_Handle =  (AUDIO_HandleTypeDef*) phost->pActiveClass->pData;
+    if(AUDIO_Handle->play_state == AUDIO_PLAYBACK_STREAM)
+    {
+      /* The callbacks stop submitting before the queues are emptied */
+      AUDIO_Handle->out_stream.Active = 0U;
+      (void)USBH_CancelRequests(phost, AUDIO_Handle->headphone.Pipe);
+      if(AUDIO_Handle->out_stream.FbPipe != 0U)
+      {
+        (void)USBH_CancelRequests(phost, AUDIO_Handle->out_stream.FbPipe);
+        AUDIO_Handle->out_stream.FbBusy = 0U;
+      }
+
+      AUDIO_Handle->control_state = AUDIO_CONTROL_IDLE;
+      AUDIO_Handle->play_state = AUDIO_PLAYBACK_IDLE;
+      Status = USBH_OK;
+    }
+  }
+  return Status;
+}
+
+/**
+  * @brief  USBH_AUDIO_StreamWrite
+  *         Copy audio data to the stream ring buffer
+  * @param  phost: Host handle
+  * @param  pData: audio data, whole sample frames
+  * @param  length: data length in bytes
+  * @retval Number of bytes copied, less than length when the ring is full
+  */
+uint32_t USBH_AUDIO_StreamWrite (USBH_HandleTypeDef *phost, uint8_t *pData, uint32_t length)
+{
+  AUDIO_HandleTypeDef *AUDIO_Handle;
+  AUDIO_OutStreamTypeDef *stream;
+  uint32_t space, offset, chunk;
+
+  if(phost->gState != HOST_CLASS)
+  {
+    return 0U;
+  }
+
+  AUDIO_Handle =  (AUDIO_HandleTypeDef*) phost->pActiveClass->pData;
+  stream = &AUDIO_Handle->out_stream;
+
+  if(stream->Active == 0U)
+  {
+    return 0U;
+  }
+
+  space = stream->Size - (stream->Head - stream->Tail);
+  if(length > space)
+  {
+    length = space - (space % stream->SampleBytes);
+  }
+
+  offset = stream->Head % stream->Size;
+  chunk = stream->Size - offset;
+  if(chunk > length)
+  {
+    chunk = length;
+  }
+
+  USBH_memcpy(stream->pRing + offset, pData, chunk);
+  USBH_memcpy(stream->pRing, pData + chunk, length - chunk);
+
+  /* Data visible to the interrupt before the new head */
+  __DMB();
+  stream->Head += length;
+
+  return length;
+}
+
+/**
+  * @brief  USBH_AUDIO_GetStreamLevel
+  *         Return the number of bytes waiting in the stream ring buffer
+  * @param  phost: Host handle
+  * @retval Bytes not yet sent
+  */
+uint32_t USBH_AUDIO_GetStreamLevel (USBH_HandleTypeDef *phost)
+{
+  AUDIO_HandleTypeDef *AUDIO_Handle;
+
+  if(phost->gState == HOST_CLASS)
+  {
+    AUDIO_Handle =  (AUDIO_HandleTypeDef*) phost->pActiveClass->pData;
+    return AUDIO_Handle->out_stream.Head - AUDIO_Handle->out_stream.Tail;
+  }
+  return 0U;
+}
+
+/**
+  * @brief  USBH_AUDIO_GetStreamUnderruns
+  *         Return the number of packets replaced by silence since the stream
+  *         received its first data
+  * @param  phost: Host handle
+  * @retval Underrun count
+  */
+uint32_t USBH_AUDIO_GetStreamUnderruns (USBH_HandleTypeDef *phost)
+{
+  AUDIO_HandleTypeDef *AUDIO_Handle;
+
+  if(phost->gState == HOST_CLASS)
+  {
+    AUDIO_Handle =  (AUDIO_HandleTypeDef*) phost->pActiveClass->pData;
+    return AUDIO_Handle->out_stream.Underruns;
+  }
+  return 0U;
+}
+
+/**
+  * @brief  USBH_AUDIO_GetFeedback
+  *         Return the rate the stream is sent at, in 10.14 sample frames per
+  *         frame: the device feedback when it has one, the nominal rate
+  *         otherwise. The device consumes Rate * 1000 / 16384 samples per
+  *         second, for the application to adjust its own sample rate to.
+  * @param  phost: Host handle
+  * @retval Rate in 10.14 format, 0 when no stream is set up
+  */
+uint32_t USBH_AUDIO_GetFeedback (USBH_HandleTypeDef *phost)
+{
+  AUDIO_HandleTypeDef *AUDIO_Handle;
+
+  if(phost->gState == HOST_CLASS)
+  {
+    AUDIO_Handle =  (AUDIO_HandleTypeDef*) phost->pActiveClass->pData;
+    return AUDIO_Handle->out_stream.Rate;
+  }
+  return 0U;
+}
+
+/**
+  * @brief  USBH_AUDIO_StreamFill
+  *         Fill the next isochronous packet from the ring buffer
+  * @param  stream: OUT stream
+  * @param  req: packet request
+  * @retval None
+  */
+static void USBH_AUDIO_StreamFill (AUDIO_OutStreamTypeDef *stream, USBH_PipeReqTypeDef *req)
+{
+  uint32_t frames, length, offset, chunk;
+
+  /* Whole sample frames this frame, the fraction is carried over */
+  stream->Accum += stream->Rate;
+  frames = stream->Accum >> 14;
+  stream->Accum &= 0x3FFFU;
+
+  length = frames * stream->SampleBytes;
+  if(length > stream->MaxLength)
+  {
+    length = stream->MaxLength - (stream->MaxLength % stream->SampleBytes);
+  }
+
+  if((stream->Head - stream->Tail) >= length)
+  {
+    offset = stream->Tail % stream->Size;
+    chunk = stream->Size - offset;
+    if(chunk > length)
+    {
+      chunk = length;
+    }
+
+    USBH_memcpy(req->buff, stream->pRing + offset, chunk);
+    USBH_memcpy(req->buff + chunk, stream->pRing, length - chunk);
+    stream->Tail += length;
+  }
+  else
+  {
+    /* Keep the device clocked with silence */
+    USBH_memset(req->buff, 0, length);
+    if(stream->Head != 0U)
+    {
+      stream->Underruns++;
+    }
+  }
+
+  req->length = (uint16_t)length;
+}
+
+/**
+  * @brief  USBH_AUDIO_StreamCallback
+  *         Isochronous OUT packet completion, from the HCD interrupt: the
+  *         next queued packet is already on its way, refill this one and
+  *         queue it behind
+  * @param  phost: Host handle
+  * @param  req: completed packet request
+  * @retval None
+  */
+static void USBH_AUDIO_StreamCallback (USBH_HandleTypeDef *phost, USBH_PipeReqTypeDef *req)
+{
+  AUDIO_HandleTypeDef *AUDIO_Handle = (AUDIO_HandleTypeDef *)req->pContext;
+  AUDIO_OutStreamTypeDef *stream = &AUDIO_Handle->out_stream;
+
+  if(stream->Active == 0U)
+  {
+    return;
+  }
+
+  if(req->urb_state == USBH_URB_DONE)
+  {
+    stream->Packets++;
+  }
+  else
+  {
+    stream->Errors++;
+  }
+
+  USBH_AUDIO_StreamFill(stream, req);
+  (void)USBH_SubmitRequest(phost, AUDIO_Handle->headphone.Pipe, req);
+}
+
+/**
+  * @brief  USBH_AUDIO_FeedbackCallback
+  *         Feedback endpoint completion, from the HCD interrupt: 10.14 rate
+  *         on 3 bytes at full speed, some devices send 16.16 on 4 bytes.
+  *         Values more than 1/8 off the nominal rate are ignored.
+  * @param  phost: Host handle
+  * @param  req: completed feedback request
+  * @retval None
+  */
+static void USBH_AUDIO_FeedbackCallback (USBH_HandleTypeDef *phost, USBH_PipeReqTypeDef *req)
+{
+  AUDIO_HandleTypeDef *AUDIO_Handle = (AUDIO_HandleTypeDef *)req->pContext;
+  AUDIO_OutStreamTypeDef *stream = &AUDIO_Handle->out_stream;
+  uint8_t *pbuf = req->buff;
+  uint32_t rate;
+
+  UNUSED(phost);
+
+  if((req->urb_state == USBH_URB_DONE) && (req->xfer_count >= 3U))
+  {
+    rate = (uint32_t)pbuf[0] | ((uint32_t)pbuf[1] << 8) | ((uint32_t)pbuf[2] << 16);
+
+    if(req->xfer_count >= 4U)
+    {
+      rate = (rate | ((uint32_t)pbuf[3] << 24)) >> 2;
+    }
+
+    if((rate >= (stream->Nominal - (stream->Nominal >> 3))) &&
+       (rate <= (stream->Nominal + (stream->Nominal >> 3))))
+    {
+      stream->Rate = rate;
+    }
+  }
+
+  stream->FbBusy = 0U;
+}
+#endif
+
 /**
   * @brief  USBH_AUDIO_SetControlAttribute
   *         Set Control Attribute
@@ -148,6 +148,10 @@ static void CDC_ProcessTransmission(USBH_HandleTypeDef *phost);
 
 static void CDC_ProcessReception(USBH_HandleTypeDef *phost);
 
+static void CDC_ProcessRxStream(USBH_HandleTypeDef *phost);
+
+static void CDC_ProcessTxQueue(USBH_HandleTypeDef *phost);
+
 USBH_ClassTypeDef  CDC_Class =
 {
   "CDC",
@@ -195,6 +199,7 @@ static USBH_StatusTypeDef USBH_CDC_InterfaceInit (USBH_HandleTypeDef *phost)
     USBH_SelectInterface (phost, interface);
     phost->pActiveClass->pData = (CDC_HandleTypeDef *)USBH_malloc (sizeof(CDC_HandleTypeDef));
     CDC_Handle =  (CDC_HandleTypeDef*) phost->pActiveClass->pData;
+    USBH_memset(CDC_Handle, 0, sizeof(CDC_HandleTypeDef));
 
     /*Collect the notification endpoint address and length*/
     if(phost->device.CfgDesc.Itf_Desc[interface].Ep_Desc[0].bEndpointAddress & 0x80U)
@@ -410,8 +415,23 @@ static USBH_StatusTypeDef USBH_CDC_Process (USBH_HandleTypeDef *phost)
     break;
 
   case CDC_TRANSFER_DATA:
-    CDC_ProcessTransmission(phost);
-    CDC_ProcessReception(phost);
+    if (CDC_Handle->TxQueue.Enabled != 0U)
+    {
+      CDC_ProcessTxQueue(phost);
+    }
+    else
+    {
+      CDC_ProcessTransmission(phost);
+    }
+
+    if (CDC_Handle->RxStream.Count != 0U)
+    {
+      CDC_ProcessRxStream(phost);
+    }
+    else
+    {
+      CDC_ProcessReception(phost);
+    }
     break;
 
   case CDC_ERROR_STATE:
@@ -457,6 +477,8 @@ USBH_StatusTypeDef  USBH_CDC_Stop(USBH_HandleTypeDef *phost)
   if(phost->gState == HOST_CLASS)
   {
     CDC_Handle->state = CDC_IDLE_STATE;
+    CDC_Handle->RxStream.Count = 0U;
+    CDC_Handle->TxQueue.Enabled = 0U;
 
     USBH_ClosePipe(phost, CDC_Handle->CommItf.NotifPipe);
     USBH_ClosePipe(phost, CDC_Handle->DataItf.InPipe);
@@ -624,6 +646,153 @@ USBH_StatusTypeDef  USBH_CDC_Receive(USBH_HandleTypeDef *phost, uint8_t *pbuff,
   return Status;
 }
 
+/**
+  * @brief  USBH_CDC_StartRxStream
+  *         Keep the bulk IN pipe armed into a ring of buffers: each transfer
+  *         fills the next free buffer, and the pipe is armed again as soon as
+  *         it completes, without waiting for the application.
+  *         USBH_CDC_ReceiveCallback() is called for each buffer filled, which
+  *         the application reads in place with USBH_CDC_RxStreamGet() and
+  *         gives back with USBH_CDC_RxStreamRelease(). The pipe stays idle, the
+  *         device throttled by NAKs, while all the buffers are filled.
+  *         The stream runs until USBH_CDC_Stop() or the disconnection; do not
+  *         call USBH_CDC_Receive() meanwhile.
+  * @param  phost: Host handle
+  * @param  pbuff: count buffers of size bytes, contiguous, word aligned
+  * @param  size: buffer size, a multiple of the IN endpoint size up to 65535
+  * @param  count: number of buffers, 2 to USBH_CDC_RX_STREAM_MAX_BUFFERS
+  * @retval USBH Status
+  */
+USBH_StatusTypeDef  USBH_CDC_StartRxStream(USBH_HandleTypeDef *phost, uint8_t *pbuff,
+                                           uint32_t size, uint32_t count)
+{
+  USBH_StatusTypeDef Status = USBH_BUSY;
+  CDC_HandleTypeDef *CDC_Handle =  (CDC_HandleTypeDef*) phost->pActiveClass->pData;
+
+  if ((pbuff == NULL) || (count < 2U) || (count > USBH_CDC_RX_STREAM_MAX_BUFFERS) ||
+      (CDC_Handle->DataItf.InEpSize == 0U) || (size == 0U) || (size > 0xFFFFU) ||
+      ((size % CDC_Handle->DataItf.InEpSize) != 0U))
+  {
+    return USBH_FAIL;
+  }
+
+  if(((CDC_Handle->state == CDC_IDLE_STATE) || (CDC_Handle->state == CDC_TRANSFER_DATA)) &&
+     (CDC_Handle->data_rx_state != CDC_RECEIVE_DATA_WAIT))
+  {
+    CDC_Handle->RxStream.pBuffers = pbuff;
+    CDC_Handle->RxStream.BufferSize = size;
+    CDC_Handle->RxStream.Head = 0U;
+    CDC_Handle->RxStream.Tail = 0U;
+    CDC_Handle->RxStream.Throttled = 0U;
+    CDC_Handle->RxStream.Count = count;
+    CDC_Handle->state = CDC_TRANSFER_DATA;
+    CDC_Handle->data_rx_state = CDC_RECEIVE_DATA;
+    Status = USBH_OK;
+#if (USBH_USE_OS == 1U)
+    osMessagePut ( phost->os_event, USBH_CLASS_EVENT, 0);
+#endif
+  }
+  return Status;
+}
+
+/**
+  * @brief  USBH_CDC_RxStreamGet
+  *         Oldest buffer filled by the stream, read in place
+  * @param  phost: Host handle
+  * @param  ppbuff: buffer address
+  * @retval Number of bytes received in the buffer, 0 when none is filled
+  */
+uint32_t  USBH_CDC_RxStreamGet(USBH_HandleTypeDef *phost, uint8_t **ppbuff)
+{
+  CDC_HandleTypeDef *CDC_Handle =  (CDC_HandleTypeDef*) phost->pActiveClass->pData;
+  CDC_RxStreamTypeDef *stream = &CDC_Handle->RxStream;
+  uint32_t index;
+
+  if ((stream->Count == 0U) || (stream->Head == stream->Tail))
+  {
+    return 0U;
+  }
+
+  index = stream->Tail % stream->Count;
+  *ppbuff = &stream->pBuffers[index * stream->BufferSize];
+
+  return stream->Length[index];
+}
+
+/**
+  * @brief  USBH_CDC_RxStreamRelease
+  *         Give the buffer of USBH_CDC_RxStreamGet() back to the stream
+  * @param  phost: Host handle
+  * @retval None
+  */
+void  USBH_CDC_RxStreamRelease(USBH_HandleTypeDef *phost)
+{
+  CDC_HandleTypeDef *CDC_Handle =  (CDC_HandleTypeDef*) phost->pActiveClass->pData;
+  CDC_RxStreamTypeDef *stream = &CDC_Handle->RxStream;
+
+  if ((stream->Count != 0U) && (stream->Head != stream->Tail))
+  {
+    stream->Tail++;
+#if (USBH_USE_OS == 1U)
+    /* The IN pipe may wait for this buffer */
+    osMessagePut ( phost->os_event, USBH_CLASS_EVENT, 0);
+#endif
+  }
+}
+
+/**
+  * @brief  USBH_CDC_TxQueue
+  *         Queue a buffer to send on the bulk OUT pipe. The buffers are sent
+  *         in order, one after the other without waiting for the application,
+  *         and USBH_CDC_TransmitCallback() is called as each one is sent: the
+  *         buffer must stay valid until then. Do not call USBH_CDC_Transmit()
+  *         once the queue is used.
+  * @param  phost: Host handle
+  * @param  pbuff: data to send
+  * @param  length: number of bytes
+  * @retval USBH_BUSY when USBH_CDC_TX_QUEUE_SIZE buffers are queued already
+  */
+USBH_StatusTypeDef  USBH_CDC_TxQueue(USBH_HandleTypeDef *phost, uint8_t *pbuff, uint32_t length)
+{
+  USBH_StatusTypeDef Status = USBH_BUSY;
+  CDC_HandleTypeDef *CDC_Handle =  (CDC_HandleTypeDef*) phost->pActiveClass->pData;
+  CDC_TxQueueTypeDef *queue = &CDC_Handle->TxQueue;
+  uint32_t index;
+
+  if ((pbuff == NULL) || (length == 0U))
+  {
+    return USBH_FAIL;
+  }
+
+  if(((CDC_Handle->state == CDC_IDLE_STATE) || (CDC_Handle->state == CDC_TRANSFER_DATA)) &&
+     ((queue->Head - queue->Tail) < USBH_CDC_TX_QUEUE_SIZE))
+  {
+    if (queue->Enabled == 0U)
+    {
+      if ((CDC_Handle->data_tx_state == CDC_SEND_DATA) || (CDC_Handle->data_tx_state == CDC_SEND_DATA_WAIT))
+      {
+        /* USBH_CDC_Transmit() still running */
+        return USBH_BUSY;
+      }
+      queue->Head = 0U;
+      queue->Tail = 0U;
+      queue->Offset = 0U;
+      queue->Enabled = 1U;
+    }
+
+    index = queue->Head % USBH_CDC_TX_QUEUE_SIZE;
+    queue->pData[index] = pbuff;
+    queue->Length[index] = length;
+    queue->Head++;
+    CDC_Handle->state = CDC_TRANSFER_DATA;
+    Status = USBH_OK;
+#if (USBH_USE_OS == 1U)
+    osMessagePut ( phost->os_event, USBH_CLASS_EVENT, 0);
+#endif
+  }
+  return Status;
+}
+
 /**
 * @brief  The function is responsible for sending data to the device
 *  @param  pdev: Selected device
@@ -760,6 +929,129 @@ static void CDC_ProcessReception(USBH_HandleTypeDef *phost)
   }
 }
 
+/**
+* @brief  Bulk IN streaming into the ring of USBH_CDC_StartRxStream()
+*  @param  pdev: Selected device
+* @retval None
+*/
+static void CDC_ProcessRxStream(USBH_HandleTypeDef *phost)
+{
+  CDC_HandleTypeDef *CDC_Handle =  (CDC_HandleTypeDef*) phost->pActiveClass->pData;
+  CDC_RxStreamTypeDef *stream = &CDC_Handle->RxStream;
+  uint32_t length;
+
+  if (CDC_Handle->data_rx_state == CDC_RECEIVE_DATA_WAIT)
+  {
+    if (USBH_LL_GetURBState(phost, CDC_Handle->DataItf.InPipe) != USBH_URB_DONE)
+    {
+      return;
+    }
+
+    /* A zero length packet leaves the buffer to the next transfer */
+    length = USBH_LL_GetLastXferSize(phost, CDC_Handle->DataItf.InPipe);
+    if (length != 0U)
+    {
+      stream->Length[stream->Head % stream->Count] = length;
+      stream->Head++;
+    }
+    CDC_Handle->data_rx_state = CDC_RECEIVE_DATA;
+
+    if (length != 0U)
+    {
+      USBH_CDC_ReceiveCallback(phost);
+    }
+#if (USBH_USE_OS == 1U)
+    osMessagePut ( phost->os_event, USBH_CLASS_EVENT, 0);
+#endif
+  }
+
+  if (CDC_Handle->data_rx_state == CDC_RECEIVE_DATA)
+  {
+    /* Arm the pipe again at once, into the next free buffer */
+    if ((stream->Head - stream->Tail) < stream->Count)
+    {
+      USBH_BulkReceiveData (phost,
+                            &stream->pBuffers[(stream->Head % stream->Count) * stream->BufferSize],
+                            (uint16_t)stream->BufferSize,
+                            CDC_Handle->DataItf.InPipe);
+
+      CDC_Handle->data_rx_state = CDC_RECEIVE_DATA_WAIT;
+    }
+    else
+    {
+      stream->Throttled++;
+    }
+  }
+}
+
+/**
+* @brief  Bulk OUT transfers of the buffers of USBH_CDC_TxQueue()
+* @note   One packet per transfer, as a NAK restarts the whole transfer: the
+*         next one is started as soon as the previous one completes.
+*  @param  pdev: Selected device
+* @retval None
+*/
+static void CDC_ProcessTxQueue(USBH_HandleTypeDef *phost)
+{
+  CDC_HandleTypeDef *CDC_Handle =  (CDC_HandleTypeDef*) phost->pActiveClass->pData;
+  CDC_TxQueueTypeDef *queue = &CDC_Handle->TxQueue;
+  USBH_URBStateTypeDef URB_Status;
+  uint32_t index;
+
+  if (CDC_Handle->data_tx_state == CDC_SEND_DATA_WAIT)
+  {
+    URB_Status = USBH_LL_GetURBState(phost, CDC_Handle->DataItf.OutPipe);
+
+    if (URB_Status == USBH_URB_DONE)
+    {
+      index = queue->Tail % USBH_CDC_TX_QUEUE_SIZE;
+      queue->Offset += queue->XferLength;
+      CDC_Handle->data_tx_state = CDC_SEND_DATA;
+
+      if (queue->Offset >= queue->Length[index])
+      {
+        queue->Offset = 0U;
+        queue->Tail++;
+        USBH_CDC_TransmitCallback(phost);
+      }
+    }
+    else if (URB_Status == USBH_URB_NOTREADY)
+    {
+      /* Same packet again */
+      CDC_Handle->data_tx_state = CDC_SEND_DATA;
+    }
+    else
+    {
+      return;
+    }
+#if (USBH_USE_OS == 1U)
+    osMessagePut ( phost->os_event, USBH_CLASS_EVENT, 0);
+#endif
+  }
+
+  if ((CDC_Handle->data_tx_state != CDC_SEND_DATA_WAIT) && (queue->Head != queue->Tail))
+  {
+    index = queue->Tail % USBH_CDC_TX_QUEUE_SIZE;
+    queue->XferLength = queue->Length[index] - queue->Offset;
+    if (queue->XferLength > CDC_Handle->DataItf.OutEpSize)
+    {
+      queue->XferLength = CDC_Handle->DataItf.OutEpSize;
+    }
+
+    USBH_BulkSendData (phost,
+                       &queue->pData[index][queue->Offset],
+                       (uint16_t)queue->XferLength,
+                       CDC_Handle->DataItf.OutPipe,
+                       1U);
+
+    CDC_Handle->data_tx_state = CDC_SEND_DATA_WAIT;
+  }
+  else if (CDC_Handle->data_tx_state == CDC_SEND_DATA)
+  {
+    CDC_Handle->data_tx_state = CDC_IDLE;
+  }
+}
+
 /**
 * @brief  The function informs user that data have been received
 *  @param  pdev: Selected device
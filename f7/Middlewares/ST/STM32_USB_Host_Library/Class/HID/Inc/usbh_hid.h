@@ -84,6 +84,14 @@
 #define HID_MAX_NBR_REPORT_FMT                      10U
 #define HID_QUEUE_SIZE                              10U
 
+#ifndef HID_MAX_FIELDS
+#define HID_MAX_FIELDS                              32U
+#endif
+
+#ifndef HID_GENERIC_REPORT_SIZE
+#define HID_GENERIC_REPORT_SIZE                     64U
+#endif
+
 #define  HID_ITEM_LONG                              0xFEU
 
 #define  HID_ITEM_TYPE_MAIN                         0x00U
@@ -156,6 +164,7 @@ typedef enum
 {
   HID_MOUSE    = 0x01,
   HID_KEYBOARD = 0x02,
+  HID_GENERIC  = 0x03,
   HID_UNKNOWN = 0xFF,
 }
 HID_TypeTypeDef;
@@ -207,6 +216,32 @@ typedef  struct  _HID_AppCollectionTypeDef {
 } HID_AppCollectionTypeDef;
 
 
+/* Input field of a report, compiled from the report descriptor */
+typedef struct _HID_FieldTypeDef
+{
+    uint16_t  UsagePage;
+    uint16_t  Usage;        /* Usage of the first element (array: UsageMin)   */
+    uint8_t   ReportID;     /* Report Id, 0 when the device uses none         */
+    uint8_t   Flags;        /* Input item data/variable/relative bits         */
+    uint8_t   Size;         /* Element size in bits (1 to 32)                 */
+    uint8_t   Count;        /* Number of elements                             */
+    uint16_t  BitOffset;    /* First element offset, report ID byte included  */
+    uint8_t   SignShift;    /* 32 - Size for signed fields, 0 otherwise       */
+    uint8_t   ValueIndex;   /* First value slot filled by HID_DecodeReport    */
+    uint32_t  Mask;         /* Element mask, (1 << Size) - 1                  */
+    int32_t   LogMin;
+    int32_t   LogMax;
+} HID_FieldTypeDef;
+
+typedef struct _HID_FieldTableTypeDef
+{
+    HID_FieldTypeDef  Field[HID_MAX_FIELDS];
+    uint8_t           NbrField;
+    uint8_t           NbrValue;
+    uint8_t           UseReportID;
+} HID_FieldTableTypeDef;
+
+
 typedef struct _HIDDescriptor
 {
   uint8_t   bLength;
@@ -248,6 +283,10 @@ typedef struct _HID_Process
   uint8_t              DataReady;
   HID_DescTypeDef      HID_Desc;
   USBH_StatusTypeDef  ( * Init)(USBH_HandleTypeDef *phost);
+  HID_FieldTableTypeDef Fields;
+#if (USBH_USE_PIPE_QUEUE == 1U)
+  USBH_PipeReqTypeDef  InReq;
+#endif
 }
 HID_HandleTypeDef;
 
@@ -331,6 +370,14 @@ void USBH_HID_EventCallback(USBH_HandleTypeDef *phost);
 
 HID_TypeTypeDef USBH_HID_GetDeviceType(USBH_HandleTypeDef *phost);
 
+USBH_StatusTypeDef USBH_HID_GenericInit(USBH_HandleTypeDef *phost);
+
+HID_FieldTableTypeDef *USBH_HID_GetFieldTable(USBH_HandleTypeDef *phost);
+
+USBH_StatusTypeDef USBH_HID_GetGenericReport(USBH_HandleTypeDef *phost,
+                                             int32_t *values,
+                                             uint32_t nbr_values);
+
 uint8_t USBH_HID_GetPollInterval(USBH_HandleTypeDef *phost);
 
 void USBH_HID_FifoInit(FIFO_TypeDef *f, uint8_t *buf, uint16_t size);
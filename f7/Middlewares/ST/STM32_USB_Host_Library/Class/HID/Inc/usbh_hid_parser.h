@@ -95,6 +95,18 @@ HID_Report_ItemTypedef;
 uint32_t HID_ReadItem (HID_Report_ItemTypedef *ri, uint8_t ndx);
 uint32_t HID_WriteItem(HID_Report_ItemTypedef *ri, uint32_t value, uint8_t ndx);
 
+USBH_StatusTypeDef HID_CompileReportDesc(HID_FieldTableTypeDef *table,
+                                         uint8_t *desc,
+                                         uint16_t length);
+uint32_t HID_DecodeReport(HID_FieldTableTypeDef *table,
+                          uint8_t *report,
+                          uint16_t length,
+                          int32_t *values,
+                          uint32_t nbr_values);
+HID_FieldTypeDef *HID_FindField(HID_FieldTableTypeDef *table,
+                                uint16_t usage_page,
+                                uint16_t usage);
+
 
 /**
   * @}
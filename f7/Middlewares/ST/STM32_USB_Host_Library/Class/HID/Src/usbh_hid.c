@@ -113,6 +113,7 @@
 /** @defgroup USBH_HID_CORE_Private_Variables
 * @{
 */
+uint32_t generic_report_data[HID_GENERIC_REPORT_SIZE / 4U];
 
 /**
 * @}
@@ -129,6 +130,10 @@ static USBH_StatusTypeDef USBH_HID_ClassRequest(USBH_HandleTypeDef *phost);
 static USBH_StatusTypeDef USBH_HID_Process(USBH_HandleTypeDef *phost);
 static USBH_StatusTypeDef USBH_HID_SOFProcess(USBH_HandleTypeDef *phost);
 static void  USBH_HID_ParseHIDDesc (HID_DescTypeDef *desc, uint8_t *buf);
+static HID_TypeTypeDef USBH_HID_GetInterfaceType(USBH_HandleTypeDef *phost);
+#if (USBH_USE_PIPE_QUEUE == 1U)
+static void  USBH_HID_InReqCallback (USBH_HandleTypeDef *phost, USBH_PipeReqTypeDef *req);
+#endif
 
 extern USBH_StatusTypeDef USBH_HID_MouseInit(USBH_HandleTypeDef *phost);
 extern USBH_StatusTypeDef USBH_HID_KeybdInit(USBH_HandleTypeDef *phost);
@@ -171,6 +176,12 @@ static USBH_StatusTypeDef USBH_HID_InterfaceInit (USBH_HandleTypeDef *phost)
 
   interface = USBH_FindInterface(phost, phost->pActiveClass->ClassCode, HID_BOOT_CODE, 0xFFU);
 
+  /* No boot interface: fall back to a report protocol only device */
+  if(interface == 0xFFU)
+  {
+    interface = USBH_FindInterface(phost, phost->pActiveClass->ClassCode, 0xFFU, 0xFFU);
+  }
+
   if(interface == 0xFFU) /* No Valid Interface */
   {
     status = USBH_FAIL;
@@ -184,20 +195,21 @@ static USBH_StatusTypeDef USBH_HID_InterfaceInit (USBH_HandleTypeDef *phost)
     HID_Handle->state = HID_ERROR;
 
     /*Decode Bootclass Protocol: Mouse or Keyboard*/
-    if(phost->device.CfgDesc.Itf_Desc[phost->device.current_interface].bInterfaceProtocol == HID_KEYBRD_BOOT_CODE)
+    if(USBH_HID_GetInterfaceType(phost) == HID_KEYBOARD)
     {
       USBH_UsrLog ("KeyBoard device found!");
       HID_Handle->Init =  USBH_HID_KeybdInit;
     }
-    else if(phost->device.CfgDesc.Itf_Desc[phost->device.current_interface].bInterfaceProtocol  == HID_MOUSE_BOOT_CODE)
+    else if(USBH_HID_GetInterfaceType(phost) == HID_MOUSE)
     {
       USBH_UsrLog ("Mouse device found!");
       HID_Handle->Init =  USBH_HID_MouseInit;
     }
     else
     {
-      USBH_UsrLog ("Protocol not supported.");
-      return USBH_FAIL;
+      /* Reports are decoded through the compiled report descriptor */
+      USBH_UsrLog ("Generic HID device found!");
+      HID_Handle->Init =  USBH_HID_GenericInit;
     }
 
     HID_Handle->state     = HID_INIT;
@@ -238,6 +250,10 @@ static USBH_StatusTypeDef USBH_HID_InterfaceInit (USBH_HandleTypeDef *phost)
                         HID_Handle->length);
 
         USBH_LL_SetToggle (phost, HID_Handle->InPipe, 0U);
+#if (USBH_USE_PIPE_QUEUE == 1U)
+        /* Poll the endpoint at its interval from the SOF */
+        USBH_SetPipeInterval(phost, HID_Handle->InPipe, HID_Handle->poll);
+#endif
 
       }
       else
@@ -291,6 +307,7 @@ USBH_StatusTypeDef static USBH_HID_InterfaceDeInit (USBH_HandleTypeDef *phost)
   if(phost->pActiveClass->pData)
   {
     USBH_free (phost->pActiveClass->pData);
+    phost->pActiveClass->pData = 0U;
   }
 
   return USBH_OK;
@@ -331,7 +348,14 @@ static USBH_StatusTypeDef USBH_HID_ClassRequest(USBH_HandleTypeDef *phost)
     /* Get Report Desc */
     if (USBH_HID_GetHIDReportDescriptor(phost, HID_Handle->HID_Desc.wItemLength) == USBH_OK)
     {
-      /* The descriptor is available in phost->device.Data */
+      /* The descriptor is available in phost->device.Data: compile it once
+         into the field table used to decode every report */
+      if (HID_CompileReportDesc(&HID_Handle->Fields, phost->device.Data,
+                                (HID_Handle->HID_Desc.wItemLength < USBH_MAX_DATA_BUFFER) ?
+                                HID_Handle->HID_Desc.wItemLength : (uint16_t)USBH_MAX_DATA_BUFFER) != USBH_OK)
+      {
+        USBH_DbgLog ("HID report descriptor partially compiled.");
+      }
 
       HID_Handle->ctl_state = HID_REQ_SET_IDLE;
     }
@@ -357,8 +381,10 @@ static USBH_StatusTypeDef USBH_HID_ClassRequest(USBH_HandleTypeDef *phost)
     break;
 
   case HID_REQ_SET_PROTOCOL:
-    /* set protocol */
-    if (USBH_HID_SetProtocol (phost, 0U) == USBH_OK)
+    /* set protocol: boot protocol for boot devices, report protocol is
+       the default otherwise */
+    if ((USBH_HID_GetInterfaceType(phost) == HID_GENERIC) ||
+        (USBH_HID_SetProtocol (phost, 0U) == USBH_OK))
     {
       HID_Handle->ctl_state = HID_REQ_IDLE;
 
@@ -437,6 +463,20 @@ static USBH_StatusTypeDef USBH_HID_Process(USBH_HandleTypeDef *phost)
     break;
 
   case HID_GET_DATA:
+#if (USBH_USE_PIPE_QUEUE == 1U)
+    /* Reports are received and the endpoint polled again from the
+       interrupt: the state machine only handles errors from now on */
+    HID_Handle->InReq.buff = HID_Handle->pData;
+    HID_Handle->InReq.length = HID_Handle->length;
+    HID_Handle->InReq.Callback = USBH_HID_InReqCallback;
+    HID_Handle->InReq.pContext = HID_Handle;
+    HID_Handle->DataReady = 0U;
+
+    if (USBH_SubmitRequest(phost, HID_Handle->InPipe, &HID_Handle->InReq) == USBH_OK)
+    {
+      HID_Handle->state = HID_POLL;
+    }
+#else
     USBH_InterruptReceiveData(phost, HID_Handle->pData,
                               (uint8_t)HID_Handle->length,
                               HID_Handle->InPipe);
@@ -444,9 +484,26 @@ static USBH_StatusTypeDef USBH_HID_Process(USBH_HandleTypeDef *phost)
     HID_Handle->state = HID_POLL;
     HID_Handle->timer = phost->Timer;
     HID_Handle->DataReady = 0U;
+#endif
     break;
 
   case HID_POLL:
+#if (USBH_USE_PIPE_QUEUE == 1U)
+    if (HID_Handle->InReq.urb_state == USBH_URB_STALL)
+    {
+      /* Issue Clear Feature on interrupt IN endpoint */
+      if(USBH_ClrFeature(phost, HID_Handle->ep_addr) == USBH_OK)
+      {
+        /* Change state to issue next IN token */
+        HID_Handle->state = HID_GET_DATA;
+      }
+    }
+    else if (HID_Handle->InReq.urb_state == USBH_URB_ERROR)
+    {
+      HID_Handle->state = HID_GET_DATA;
+    }
+    break;
+#endif
     if(USBH_LL_GetURBState(phost , HID_Handle->InPipe) == USBH_URB_DONE)
     {
       if(HID_Handle->DataReady == 0U)
@@ -489,6 +546,7 @@ static USBH_StatusTypeDef USBH_HID_Process(USBH_HandleTypeDef *phost)
   */
 static USBH_StatusTypeDef USBH_HID_SOFProcess(USBH_HandleTypeDef *phost)
 {
+#if (USBH_USE_PIPE_QUEUE == 0U)
   HID_HandleTypeDef *HID_Handle =  (HID_HandleTypeDef *) phost->pActiveClass->pData;
 
   if(HID_Handle->state == HID_POLL)
@@ -501,9 +559,42 @@ static USBH_StatusTypeDef USBH_HID_SOFProcess(USBH_HandleTypeDef *phost)
 #endif
     }
   }
+#endif
   return USBH_OK;
 }
 
+#if (USBH_USE_PIPE_QUEUE == 1U)
+/**
+  * @brief  USBH_HID_InReqCallback
+  *         Interrupt IN request completion, called from the HCD interrupt:
+  *         store the report and poll the endpoint again.
+  * @param  phost: Host handle
+  * @param  req: completed request
+  * @retval None
+  */
+static void  USBH_HID_InReqCallback (USBH_HandleTypeDef *phost, USBH_PipeReqTypeDef *req)
+{
+  HID_HandleTypeDef *HID_Handle = (HID_HandleTypeDef *) req->pContext;
+
+  if (req->urb_state == USBH_URB_DONE)
+  {
+    USBH_HID_FifoWrite(&HID_Handle->fifo, HID_Handle->pData, HID_Handle->length);
+    HID_Handle->DataReady = 1U;
+    USBH_HID_EventCallback(phost);
+
+    (void)USBH_SubmitRequest(phost, HID_Handle->InPipe, req);
+  }
+#if (USBH_USE_OS == 1U)
+  else
+  {
+    /* Stall or error: let the class process recover the endpoint */
+    osMessagePut ( phost->os_event, USBH_URB_EVENT, 0U);
+  }
+#endif
+}
+#endif
+
+
 /**
 * @brief  USBH_Get_HID_ReportDescriptor
   *         Issue report Descriptor command to the device. Once the response
@@ -702,9 +793,26 @@ static void  USBH_HID_ParseHIDDesc (HID_DescTypeDef *desc, uint8_t *buf)
 HID_TypeTypeDef USBH_HID_GetDeviceType(USBH_HandleTypeDef *phost)
 {
   HID_TypeTypeDef   type = HID_UNKNOWN;
-  uint8_t InterfaceProtocol;
 
   if(phost->gState == HOST_CLASS)
+  {
+    type = USBH_HID_GetInterfaceType(phost);
+  }
+  return type;
+}
+
+/**
+  * @brief  USBH_HID_GetInterfaceType
+  *         Return the function of the selected interface.
+  * @param  phost: Host handle
+  * @retval HID function: HID_MOUSE / HID_KEYBOARD / HID_GENERIC
+  */
+static HID_TypeTypeDef USBH_HID_GetInterfaceType(USBH_HandleTypeDef *phost)
+{
+  HID_TypeTypeDef   type = HID_GENERIC;
+  uint8_t InterfaceProtocol;
+
+  if(phost->device.CfgDesc.Itf_Desc[phost->device.current_interface].bInterfaceSubClass == HID_BOOT_CODE)
   {
     InterfaceProtocol = phost->device.CfgDesc.Itf_Desc[phost->device.current_interface].bInterfaceProtocol;
     if(InterfaceProtocol == HID_KEYBRD_BOOT_CODE)
@@ -722,6 +830,84 @@ HID_TypeTypeDef USBH_HID_GetDeviceType(USBH_HandleTypeDef *phost)
   return type;
 }
 
+/**
+  * @brief  USBH_HID_GenericInit
+  *         The function init a report protocol HID device.
+  * @param  phost: Host handle
+  * @retval USBH Status
+  */
+USBH_StatusTypeDef USBH_HID_GenericInit(USBH_HandleTypeDef *phost)
+{
+  HID_HandleTypeDef *HID_Handle =  (HID_HandleTypeDef *) phost->pActiveClass->pData;
+  uint32_t fifo_size;
+
+  USBH_memset(generic_report_data, 0, sizeof(generic_report_data));
+
+  if(HID_Handle->length > sizeof(generic_report_data))
+  {
+    HID_Handle->length = sizeof(generic_report_data);
+  }
+  HID_Handle->pData = (uint8_t *)(void *)generic_report_data;
+
+  /* The FIFO shares phost->device.Data: keep as many reports as fit */
+  fifo_size = (uint32_t)HID_QUEUE_SIZE * HID_Handle->length;
+  if(fifo_size > USBH_MAX_DATA_BUFFER)
+  {
+    fifo_size = ((uint32_t)USBH_MAX_DATA_BUFFER / HID_Handle->length) * HID_Handle->length;
+  }
+  USBH_HID_FifoInit(&HID_Handle->fifo, phost->device.Data, (uint16_t)fifo_size);
+
+  return USBH_OK;
+}
+
+/**
+  * @brief  USBH_HID_GetFieldTable
+  *         Return the fields compiled from the report descriptor.
+  * @param  phost: Host handle
+  * @retval field table, NULL if the class is not active
+  */
+HID_FieldTableTypeDef *USBH_HID_GetFieldTable(USBH_HandleTypeDef *phost)
+{
+  HID_HandleTypeDef *HID_Handle =  (HID_HandleTypeDef *) phost->pActiveClass->pData;
+
+  if(phost->gState != HOST_CLASS)
+  {
+    return NULL;
+  }
+
+  return &HID_Handle->Fields;
+}
+
+/**
+  * @brief  USBH_HID_GetGenericReport
+  *         Decode the oldest received report into the field values.
+  *         values[field->ValueIndex + n] is the n-th element of a field.
+  * @param  phost: Host handle
+  * @param  values: value slots
+  * @param  nbr_values: number of value slots
+  * @retval USBH Status (USBH_FAIL: no report available)
+  */
+USBH_StatusTypeDef USBH_HID_GetGenericReport(USBH_HandleTypeDef *phost,
+                                             int32_t *values,
+                                             uint32_t nbr_values)
+{
+  HID_HandleTypeDef *HID_Handle =  (HID_HandleTypeDef *) phost->pActiveClass->pData;
+
+  if((phost->gState != HOST_CLASS) || (HID_Handle->length == 0U))
+  {
+    return USBH_FAIL;
+  }
+
+  if(USBH_HID_FifoRead(&HID_Handle->fifo, generic_report_data, HID_Handle->length) == HID_Handle->length)
+  {
+    (void)HID_DecodeReport(&HID_Handle->Fields, (uint8_t *)(void *)generic_report_data,
+                           HID_Handle->length, values, nbr_values);
+    return USBH_OK;
+  }
+
+  return USBH_FAIL;
+}
+
 
 /**
   * @brief  USBH_HID_GetPollInterval
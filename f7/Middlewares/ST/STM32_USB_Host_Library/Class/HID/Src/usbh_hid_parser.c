@@ -74,6 +74,25 @@
 /** @defgroup USBH_HID_PARSER_Private_TypesDefinitions
   * @{
   */
+/* Global items, saved by Push and restored by Pop */
+typedef struct
+{
+  uint16_t  UsagePage;
+  uint8_t   ReportID;
+  uint8_t   ReportSize;
+  uint16_t  ReportCount;
+  int32_t   LogMin;
+  int32_t   LogMax;
+}
+HID_GlobalStateTypeDef;
+
+/* Running bit offset of each report */
+typedef struct
+{
+  uint8_t   ReportID;
+  uint16_t  BitOffset;
+}
+HID_ReportOffsetTypeDef;
 /**
   * @}
   */
@@ -82,6 +101,7 @@
 /** @defgroup USBH_HID_PARSER_Private_Defines
   * @{
   */
+#define HID_PARSER_STACK_DEPTH       4U
 /**
   * @}
   */
@@ -97,6 +117,12 @@
 /** @defgroup USBH_HID_PARSER_Private_FunctionPrototypes
   * @{
   */
+static uint8_t HID_AddField(HID_FieldTableTypeDef *table,
+                            HID_GlobalStateTypeDef *global,
+                            uint32_t flags,
+                            uint16_t usage,
+                            uint16_t count,
+                            uint16_t offset);
 
 /**
   * @}
@@ -240,6 +266,368 @@ uint32_t HID_WriteItem(HID_Report_ItemTypedef *ri, uint32_t value, uint8_t ndx)
   return 0U;
 }
 
+/**
+  * @brief  HID_CompileReportDesc
+  *         The function compiles the input items of a report descriptor into
+  *         a field table, so reports are decoded without parsing it again.
+  * @param  table: field table to fill
+  * @param  desc: report descriptor
+  * @param  length: report descriptor length
+  * @retval USBH Status (USBH_FAIL: table too small or descriptor malformed)
+  */
+USBH_StatusTypeDef HID_CompileReportDesc(HID_FieldTableTypeDef *table,
+                                         uint8_t *desc,
+                                         uint16_t length)
+{
+  HID_GlobalStateTypeDef  global;
+  HID_GlobalStateTypeDef  stack[HID_PARSER_STACK_DEPTH];
+  HID_ReportOffsetTypeDef report[HID_MAX_NBR_REPORT_FMT];
+  uint16_t usage[HID_MAX_USAGE];
+  USBH_StatusTypeDef status = USBH_OK;
+  uint32_t nbr_usage = 0U;
+  uint32_t usage_min = 0U;
+  uint32_t nbr_report = 1U;
+  uint32_t cur_report = 0U;
+  uint32_t sp = 0U;
+  uint32_t pos = 0U;
+  uint32_t data;
+  uint32_t size;
+  uint32_t i;
+  uint8_t  type;
+  uint8_t  tag;
+
+  USBH_memset(table, 0, sizeof(HID_FieldTableTypeDef));
+  USBH_memset(&global, 0, sizeof(global));
+  report[0].ReportID = 0U;
+  report[0].BitOffset = 0U;
+
+  while (pos < length)
+  {
+    /* Long items carry no field definition: skip them */
+    if (desc[pos] == HID_ITEM_LONG)
+    {
+      if ((pos + 1U) >= length)
+      {
+        break;
+      }
+      pos += 3U + desc[pos + 1U];
+      continue;
+    }
+
+    size = desc[pos] & 0x03U;
+    size = (size == 3U) ? 4U : size;
+    type = (desc[pos] >> 2) & 0x03U;
+    tag  = desc[pos] >> 4;
+
+    if ((pos + size) >= length)
+    {
+      status = USBH_FAIL;
+      break;
+    }
+
+    /* Item data, little endian */
+    data = 0U;
+    for (i = 0U; i < size; i++)
+    {
+      data |= (uint32_t)desc[pos + 1U + i] << (8U * i);
+    }
+    pos += 1U + size;
+
+    if (type == HID_ITEM_TYPE_MAIN)
+    {
+      if ((tag == HID_MAIN_ITEM_TAG_INPUT) && (global.ReportSize != 0U) && (global.ReportCount != 0U))
+      {
+        if ((data & 0x01U) == 0U)
+        {
+          if (((data & 0x02U) != 0U) && (nbr_usage > 1U))
+          {
+            /* Variable item with a usage list: one field per usage */
+            for (i = 0U; i < global.ReportCount; i++)
+            {
+              if (HID_AddField(table, &global, data,
+                               usage[(i < nbr_usage) ? i : (nbr_usage - 1U)], 1U,
+                               (uint16_t)(report[cur_report].BitOffset + (i * global.ReportSize))) == 0U)
+              {
+                status = USBH_FAIL;
+              }
+            }
+          }
+          else
+          {
+            if (HID_AddField(table, &global, data,
+                             (uint16_t)((nbr_usage != 0U) ? usage[0] : usage_min),
+                             global.ReportCount, report[cur_report].BitOffset) == 0U)
+            {
+              status = USBH_FAIL;
+            }
+          }
+        }
+
+        /* Constant items are padding: they only move the offset */
+        report[cur_report].BitOffset += (uint16_t)(global.ReportSize * global.ReportCount);
+      }
+
+      /* Local items only apply to the next main item */
+      nbr_usage = 0U;
+      usage_min = 0U;
+    }
+    else if (type == HID_ITEM_TYPE_GLOBAL)
+    {
+      switch (tag)
+      {
+      case HID_GLOBAL_ITEM_TAG_USAGE_PAGE:
+        global.UsagePage = (uint16_t)data;
+        break;
+
+      case HID_GLOBAL_ITEM_TAG_LOG_MIN:
+        /* Sign extend the item data */
+        global.LogMin = (size == 1U) ? (int32_t)(int8_t)data :
+                        ((size == 2U) ? (int32_t)(int16_t)data : (int32_t)data);
+        break;
+
+      case HID_GLOBAL_ITEM_TAG_LOG_MAX:
+        global.LogMax = (size == 1U) ? (int32_t)(int8_t)data :
+                        ((size == 2U) ? (int32_t)(int16_t)data : (int32_t)data);
+        break;
+
+      case HID_GLOBAL_ITEM_TAG_REPORT_SIZE:
+        global.ReportSize = (uint8_t)data;
+        break;
+
+      case HID_GLOBAL_ITEM_TAG_REPORT_COUNT:
+        global.ReportCount = (uint16_t)data;
+        break;
+
+      case HID_GLOBAL_ITEM_TAG_REPORT_ID:
+        global.ReportID = (uint8_t)data;
+        table->UseReportID = 1U;
+
+        /* Reports start after their ID byte */
+        for (cur_report = 0U; cur_report < nbr_report; cur_report++)
+        {
+          if (report[cur_report].ReportID == global.ReportID)
+          {
+            break;
+          }
+        }
+
+        if (cur_report == nbr_report)
+        {
+          if (nbr_report == HID_MAX_NBR_REPORT_FMT)
+          {
+            status = USBH_FAIL;
+            cur_report = 0U;
+          }
+          else
+          {
+            nbr_report++;
+            report[cur_report].ReportID = global.ReportID;
+            report[cur_report].BitOffset = 8U;
+          }
+        }
+        break;
+
+      case HID_GLOBAL_ITEM_TAG_PUSH:
+        if (sp < HID_PARSER_STACK_DEPTH)
+        {
+          stack[sp++] = global;
+        }
+        break;
+
+      case HID_GLOBAL_ITEM_TAG_POP:
+        if (sp > 0U)
+        {
+          global = stack[--sp];
+        }
+        break;
+
+      default:
+        break;
+      }
+    }
+    else if (type == HID_ITEM_TYPE_LOCAL)
+    {
+      /* 32-bit usages embed their usage page */
+      if ((size == 4U) && ((tag == HID_LOCAL_ITEM_TAG_USAGE) || (tag == HID_LOCAL_ITEM_TAG_USAGE_MIN)))
+      {
+        global.UsagePage = (uint16_t)(data >> 16);
+      }
+
+      if ((tag == HID_LOCAL_ITEM_TAG_USAGE) && (nbr_usage < HID_MAX_USAGE))
+      {
+        usage[nbr_usage++] = (uint16_t)data;
+      }
+      else if (tag == HID_LOCAL_ITEM_TAG_USAGE_MIN)
+      {
+        usage_min = (uint16_t)data;
+      }
+      else
+      {
+        /* Usage maximum, designators and strings are not kept */
+      }
+    }
+    else
+    {
+      /* Reserved item type */
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  HID_AddField
+  *         Append a field to the table and precompute its extraction data.
+  * @param  table: field table
+  * @param  global: current global items
+  * @param  flags: input item data
+  * @param  usage: usage of the first element
+  * @param  count: number of elements
+  * @param  offset: bit offset of the first element
+  * @retval 1 if the field was added, 0 if the table is full
+  */
+static uint8_t HID_AddField(HID_FieldTableTypeDef *table,
+                            HID_GlobalStateTypeDef *global,
+                            uint32_t flags,
+                            uint16_t usage,
+                            uint16_t count,
+                            uint16_t offset)
+{
+  HID_FieldTypeDef *field;
+
+  if ((table->NbrField >= HID_MAX_FIELDS) ||
+      (((uint32_t)table->NbrValue + count) > 0xFFU) ||
+      (global->ReportSize > 32U))
+  {
+    return 0U;
+  }
+
+  field = &table->Field[table->NbrField++];
+  field->UsagePage  = global->UsagePage;
+  field->Usage      = usage;
+  field->ReportID   = global->ReportID;
+  field->Flags      = (uint8_t)flags;
+  field->Size       = global->ReportSize;
+  field->Count      = (uint8_t)count;
+  field->BitOffset  = offset;
+  field->Mask       = (global->ReportSize == 32U) ? 0xFFFFFFFFU : ((1U << global->ReportSize) - 1U);
+  field->SignShift  = (global->LogMin < 0) ? (uint8_t)(32U - global->ReportSize) : 0U;
+  field->ValueIndex = table->NbrValue;
+  field->LogMin     = global->LogMin;
+  field->LogMax     = global->LogMax;
+
+  table->NbrValue += (uint8_t)count;
+
+  return 1U;
+}
+
+/**
+  * @brief  HID_DecodeReport
+  *         The function extracts every element of a report using the
+  *         compiled field table. values[field->ValueIndex + n] receives the
+  *         n-th element of a field; fields of other reports are left as is.
+  * @param  table: compiled field table
+  * @param  report: report data, report ID included
+  * @param  length: report length
+  * @param  values: value slots, table->NbrValue entries
+  * @param  nbr_values: number of value slots
+  * @retval number of values updated
+  */
+uint32_t HID_DecodeReport(HID_FieldTableTypeDef *table,
+                          uint8_t *report,
+                          uint16_t length,
+                          int32_t *values,
+                          uint32_t nbr_values)
+{
+  HID_FieldTypeDef *field = table->Field;
+  HID_FieldTypeDef *end = &table->Field[table->NbrField];
+  uint32_t nbits = (uint32_t)length * 8U;
+  uint32_t updated = 0U;
+  uint32_t bofs;
+  uint32_t val;
+  uint8_t  id = (table->UseReportID != 0U) ? report[0] : 0U;
+  uint8_t  *data;
+  uint8_t  n;
+
+  for (; field < end; field++)
+  {
+    if (field->ReportID != id)
+    {
+      continue;
+    }
+
+    for (n = 0U; n < field->Count; n++)
+    {
+      bofs = field->BitOffset + ((uint32_t)n * field->Size);
+
+      if (((bofs + field->Size) > nbits) || (((uint32_t)field->ValueIndex + n) >= nbr_values))
+      {
+        break;
+      }
+
+      /* Elements span at most five bytes */
+      data = &report[bofs >> 3];
+      val = (uint32_t)data[0] >> (bofs & 0x7U);
+      if (((bofs & 0x7U) + field->Size) > 8U)
+      {
+        val |= (uint32_t)data[1] << (8U - (bofs & 0x7U));
+      }
+      if (((bofs & 0x7U) + field->Size) > 16U)
+      {
+        val |= (uint32_t)data[2] << (16U - (bofs & 0x7U));
+      }
+      if (((bofs & 0x7U) + field->Size) > 24U)
+      {
+        val |= (uint32_t)data[3] << (24U - (bofs & 0x7U));
+      }
+      if (((bofs & 0x7U) + field->Size) > 32U)
+      {
+        val |= (uint32_t)data[4] << (32U - (bofs & 0x7U));
+      }
+      val &= field->Mask;
+
+      /* Sign extend through the precomputed shift */
+      values[field->ValueIndex + n] = (int32_t)(val << field->SignShift) >> field->SignShift;
+      updated++;
+    }
+  }
+
+  return updated;
+}
+
+/**
+  * @brief  HID_FindField
+  *         The function looks up the field carrying a usage. For a variable
+  *         field declared with a usage range, the usage is reported in
+  *         element (usage - field->Usage).
+  * @param  table: compiled field table
+  * @param  usage_page: usage page
+  * @param  usage: usage
+  * @retval field, or NULL if the device does not report the usage
+  */
+HID_FieldTypeDef *HID_FindField(HID_FieldTableTypeDef *table,
+                                uint16_t usage_page,
+                                uint16_t usage)
+{
+  HID_FieldTypeDef *field;
+  uint32_t i;
+
+  for (i = 0U; i < table->NbrField; i++)
+  {
+    field = &table->Field[i];
+
+    if ((field->UsagePage == usage_page) &&
+        ((field->Usage == usage) ||
+         (((field->Flags & 0x02U) != 0U) && (usage > field->Usage) &&
+          (usage < ((uint32_t)field->Usage + field->Count)))))
+    {
+      return field;
+    }
+  }
+
+  return NULL;
+}
+
 /**
   * @}
   */
@@ -0,0 +1,278 @@
+/**
+  ******************************************************************************
+  * @file    usbh_hub.h
+  * @author  MCD Application Team
+  * @brief   This file contains all the prototypes for the usbh_hub.c
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics International N.V.
+  * All rights reserved.</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without
+  * modification, are permitted, provided that the following conditions are met:
+  *
+  * 1. Redistribution of source code must retain the above copyright notice,
+  *    this list of conditions and the following disclaimer.
+  * 2. Redistributions in binary form must reproduce the above copyright notice,
+  *    this list of conditions and the following disclaimer in the documentation
+  *    and/or other materials provided with the distribution.
+  * 3. Neither the name of STMicroelectronics nor the names of other
+  *    contributors to this software may be used to endorse or promote products
+  *    derived from this software without specific written permission.
+  * 4. This software, including modifications and/or derivative works of this
+  *    software, must execute solely and exclusively on microcontroller or
+  *    microprocessor devices manufactured by or for STMicroelectronics.
+  * 5. Redistribution and use of this software other than as permitted under
+  *    this license is void and will automatically terminate your rights under
+  *    this license.
+  *
+  * THIS SOFTWARE IS PROVIDED BY STMICROELECTRONICS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS, IMPLIED OR STATUTORY WARRANTIES, INCLUDING, BUT NOT
+  * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+  * PARTICULAR PURPOSE AND NON-INFRINGEMENT OF THIRD PARTY INTELLECTUAL PROPERTY
+  * RIGHTS ARE DISCLAIMED TO THE FULLEST EXTENT PERMITTED BY LAW. IN NO EVENT
+  * SHALL STMICROELECTRONICS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+  * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+  * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive  ----------------------------------------------*/
+#ifndef __USBH_HUB_H
+#define __USBH_HUB_H
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbh_core.h"
+
+/** @addtogroup USBH_LIB
+  * @{
+  */
+
+/** @addtogroup USBH_CLASS
+  * @{
+  */
+
+/** @addtogroup USBH_HUB_CLASS
+  * @{
+  */
+
+/** @defgroup USBH_HUB_CORE
+  * @brief This file is the Header file for usbh_hub.c
+  * @{
+  */
+
+
+/** @defgroup USBH_HUB_CORE_Exported_Types
+  * @{
+  */
+
+/* Ports handled, up to 31. Override in usbh_conf.h. */
+#ifndef USBH_HUB_MAX_PORTS
+#define USBH_HUB_MAX_PORTS                            4U
+#endif
+
+/* Connection debounce before the port reset, in ms */
+#ifndef USBH_HUB_DEBOUNCE_MS
+#define USBH_HUB_DEBOUNCE_MS                          100U
+#endif
+
+/* Reset recovery before the enumeration of the device, in ms */
+#ifndef USBH_HUB_RESET_RECOVERY_MS
+#define USBH_HUB_RESET_RECOVERY_MS                    10U
+#endif
+
+/* States for HUB State Machine */
+typedef enum
+{
+  HUB_IDLE = 0U,
+  HUB_GET_DATA,
+  HUB_POLL,
+  HUB_PORT_STATUS,
+  HUB_PORT_CLEAR,
+  HUB_PORT_EVENT,
+  HUB_PORT_DEBOUNCE,
+  HUB_PORT_RESET,
+  HUB_PORT_RESET_WAIT,
+  HUB_PORT_RESET_STATUS,
+  HUB_PORT_RESET_CLEAR,
+  HUB_PORT_RECOVERY,
+  HUB_PORT_ATTACH,
+}
+HUB_StateTypeDef;
+
+typedef enum
+{
+  HUB_REQ_INIT = 0U,
+  HUB_REQ_GET_HUB_DESC,
+  HUB_REQ_SET_POWER,
+  HUB_REQ_POWER_WAIT,
+  HUB_REQ_IDLE,
+}
+HUB_CtlStateTypeDef;
+
+/* Device on a hub port */
+typedef struct
+{
+  USBH_HandleTypeDef   host;          /* host handle of the device          */
+  __IO uint8_t         active;        /* device attached to the port        */
+}
+HUB_PortTypeDef;
+
+/* Structure for HUB process */
+typedef struct _HUB_Process
+{
+  uint8_t              InPipe;
+  uint8_t              InEp;
+  uint16_t             length;
+  uint16_t             poll;          /* status change poll, in SOF         */
+  uint32_t             timer;
+  uint32_t             reset_timer;
+  HUB_StateTypeDef     state;
+  HUB_CtlStateTypeDef  ctl_state;
+  uint8_t              NbrPorts;
+  uint8_t              PwrOn2PwrGood; /* in 2 ms units                      */
+  uint16_t             Characteristics;
+  uint8_t              port;          /* port being serviced, from 1        */
+  uint8_t              EnumPort;      /* port of the device at address 0    */
+  uint16_t             PortStatus;
+  uint16_t             PortChangeBits;
+  uint8_t              ConnectChange;
+  uint32_t             PortChange;    /* ports with a status change to read */
+  uint32_t             PortConnect;   /* ports waiting for their reset      */
+  uint32_t             Buff[2];       /* status change bitmap, port status  */
+  HUB_PortTypeDef      Port[USBH_HUB_MAX_PORTS];
+}
+HUB_HandleTypeDef;
+
+/**
+  * @}
+  */
+
+/** @defgroup USBH_HUB_CORE_Exported_Defines
+  * @{
+  */
+
+/* HUB Class Codes */
+#define USB_HUB_CLASS                                 0x09U
+
+#define USB_DESC_TYPE_HUB                             0x29U
+#define USB_DESC_HUB                       ((USB_DESC_TYPE_HUB << 8) & 0xFF00U)
+#define USB_HUB_DESC_SIZE                             9U
+
+/* Hub class features (USB 2.0, table 11-17) */
+#define HUB_FEATURE_PORT_CONNECTION                   0U
+#define HUB_FEATURE_PORT_ENABLE                       1U
+#define HUB_FEATURE_PORT_SUSPEND                      2U
+#define HUB_FEATURE_PORT_OVER_CURRENT                 3U
+#define HUB_FEATURE_PORT_RESET                        4U
+#define HUB_FEATURE_PORT_POWER                        8U
+#define HUB_FEATURE_PORT_LOW_SPEED                    9U
+#define HUB_FEATURE_C_PORT_CONNECTION                 16U
+#define HUB_FEATURE_C_PORT_ENABLE                     17U
+#define HUB_FEATURE_C_PORT_SUSPEND                    18U
+#define HUB_FEATURE_C_PORT_OVER_CURRENT               19U
+#define HUB_FEATURE_C_PORT_RESET                      20U
+
+/* wPortStatus */
+#define HUB_PORT_STATUS_CONNECTION                    0x0001U
+#define HUB_PORT_STATUS_ENABLE                        0x0002U
+#define HUB_PORT_STATUS_SUSPEND                       0x0004U
+#define HUB_PORT_STATUS_OVER_CURRENT                  0x0008U
+#define HUB_PORT_STATUS_RESET                         0x0010U
+#define HUB_PORT_STATUS_POWER                         0x0100U
+#define HUB_PORT_STATUS_LOW_SPEED                     0x0200U
+#define HUB_PORT_STATUS_HIGH_SPEED                    0x0400U
+
+/* wPortChange */
+#define HUB_PORT_CHANGE_CONNECTION                    0x0001U
+#define HUB_PORT_CHANGE_ENABLE                        0x0002U
+#define HUB_PORT_CHANGE_SUSPEND                       0x0004U
+#define HUB_PORT_CHANGE_OVER_CURRENT                  0x0008U
+#define HUB_PORT_CHANGE_RESET                         0x0010U
+#define HUB_PORT_CHANGE_ALL                           0x001FU
+
+/**
+  * @}
+  */
+
+/** @defgroup USBH_HUB_CORE_Exported_Macros
+  * @{
+  */
+/**
+  * @}
+  */
+
+/** @defgroup USBH_HUB_CORE_Exported_Variables
+  * @{
+  */
+extern USBH_ClassTypeDef  HUB_Class;
+#define USBH_HUB_CLASS    &HUB_Class
+/**
+  * @}
+  */
+
+/** @defgroup USBH_HUB_CORE_Exported_FunctionsPrototype
+  * @{
+  */
+
+USBH_StatusTypeDef USBH_HUB_GetHubDescriptor (USBH_HandleTypeDef *phost,
+                                              uint8_t *buff,
+                                              uint16_t length);
+
+USBH_StatusTypeDef USBH_HUB_GetPortStatus (USBH_HandleTypeDef *phost,
+                                           uint8_t port,
+                                           uint8_t *buff);
+
+USBH_StatusTypeDef USBH_HUB_SetPortFeature (USBH_HandleTypeDef *phost,
+                                            uint8_t port,
+                                            uint16_t feature);
+
+USBH_StatusTypeDef USBH_HUB_ClearPortFeature (USBH_HandleTypeDef *phost,
+                                              uint8_t port,
+                                              uint16_t feature);
+
+uint8_t USBH_HUB_GetPortCount (USBH_HandleTypeDef *phost);
+
+USBH_HandleTypeDef *USBH_HUB_GetPortHost (USBH_HandleTypeDef *phost,
+                                          uint8_t port);
+
+void USBH_HUB_PortCallback (USBH_HandleTypeDef *phost,
+                            uint8_t port,
+                            uint8_t connected);
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __USBH_HUB_H */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
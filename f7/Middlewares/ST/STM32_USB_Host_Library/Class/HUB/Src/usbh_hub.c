@@ -0,0 +1,912 @@
+/**
+  ******************************************************************************
+  * @file    usbh_hub.c
+  * @author  MCD Application Team
+  * @brief   This file is the HUB Layer Handlers for USB Host HUB class.
+  *
+  * @verbatim
+  *
+  *          ===================================================================
+  *                                HUB Class  Description
+  *          ===================================================================
+  *           This module manages the hub class of the "Universal Serial Bus
+  *           Specification Revision 2.0", chapter 11, for a hub on the root
+  *           port:
+  *             - Hub descriptor and port power
+  *             - Status change endpoint polled at its interval
+  *             - Port connection debounce, reset and speed detection
+  *             - Enumeration of the device of each port in its own host
+  *               handle, one port at a time at the default address
+  *
+  *           Devices behind the hub:
+  *             With USBH_USE_HUB set in usbh_conf.h, each device gets a host
+  *             handle of its own, inside the hub class data, with the
+  *             address following the one of the hub (port 1: address 2...).
+  *             The handle runs the classes registered on the root handle,
+  *             except this one, and takes its host channels from the root
+  *             handle, so that a keyboard, a scanner and a flash drive keep
+  *             channels of their own and their transfers are interleaved by
+  *             the core; their state machines run from the hub process and
+  *             their timers from the SOF of the root port. The NAKed bulk
+  *             transfers of a slow device are retried once per frame and
+  *             its interrupt endpoints polled at their interval (see
+  *             USE_HAL_HCD_NAK_DEFER and USBH_SetPipeInterval), so that it
+  *             does not take bandwidth from the other devices; with
+  *             USBH_SHARED_PIPES_NBR, queued endpoints share the channels
+  *             left. The user callback is called with the handle of the
+  *             device, USBH_HUB_GetPortHost() returns it.
+  *
+  *           Limits:
+  *             Full and low speed devices behind a high speed hub need split
+  *             transactions, which the HCD does not issue: such ports are
+  *             left disabled. Hubs behind the hub are not supported. Low
+  *             speed devices behind a full speed hub are reached with the
+  *             preamble sent by the core.
+  *
+  *  @endverbatim
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2017 STMicroelectronics International N.V.
+  * All rights reserved.</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without
+  * modification, are permitted, provided that the following conditions are met:
+  *
+  * 1. Redistribution of source code must retain the above copyright notice,
+  *    this list of conditions and the following disclaimer.
+  * 2. Redistributions in binary form must reproduce the above copyright notice,
+  *    this list of conditions and the following disclaimer in the documentation
+  *    and/or other materials provided with the distribution.
+  * 3. Neither the name of STMicroelectronics nor the names of other
+  *    contributors to this software may be used to endorse or promote products
+  *    derived from this software without specific written permission.
+  * 4. This software, including modifications and/or derivative works of this
+  *    software, must execute solely and exclusively on microcontroller or
+  *    microprocessor devices manufactured by or for STMicroelectronics.
+  * 5. Redistribution and use of this software other than as permitted under
+  *    this license is void and will automatically terminate your rights under
+  *    this license.
+  *
+  * THIS SOFTWARE IS PROVIDED BY STMICROELECTRONICS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS, IMPLIED OR STATUTORY WARRANTIES, INCLUDING, BUT NOT
+  * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+  * PARTICULAR PURPOSE AND NON-INFRINGEMENT OF THIRD PARTY INTELLECTUAL PROPERTY
+  * RIGHTS ARE DISCLAIMED TO THE FULLEST EXTENT PERMITTED BY LAW. IN NO EVENT
+  * SHALL STMICROELECTRONICS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+  * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+  * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+  * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+  * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+  * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "usbh_hub.h"
+
+#if (USBH_USE_HUB != 1U)
+#error "USBH_USE_HUB must be set to 1U in usbh_conf.h for the HUB class"
+#endif
+
+
+/** @addtogroup USBH_LIB
+* @{
+*/
+
+/** @addtogroup USBH_CLASS
+* @{
+*/
+
+/** @addtogroup USBH_HUB_CLASS
+* @{
+*/
+
+/** @defgroup USBH_HUB_CORE
+* @brief    This file includes HUB Layer Handlers for USB Host HUB class.
+* @{
+*/
+
+/** @defgroup USBH_HUB_CORE_Private_TypesDefinitions
+* @{
+*/
+/**
+* @}
+*/
+
+
+/** @defgroup USBH_HUB_CORE_Private_Defines
+* @{
+*/
+/* Port reset timeout, in ms */
+#define HUB_RESET_TIMEOUT_MS                          500U
+/* Port status poll during the reset, in ms */
+#define HUB_RESET_POLL_MS                             10U
+/**
+* @}
+*/
+
+
+/** @defgroup USBH_HUB_CORE_Private_Macros
+* @{
+*/
+/* Timer of the root port: frames at full speed, microframes at high speed */
+#define HUB_MS_TO_SOF(__HOST__, __MS__) (((__HOST__)->device.speed == USBH_SPEED_HIGH) ? \
+                                         ((uint32_t)(__MS__) * 8U) : (uint32_t)(__MS__))
+/**
+* @}
+*/
+
+
+/** @defgroup USBH_HUB_CORE_Private_Variables
+* @{
+*/
+/**
+* @}
+*/
+
+
+/** @defgroup USBH_HUB_CORE_Private_FunctionPrototypes
+* @{
+*/
+
+static USBH_StatusTypeDef USBH_HUB_InterfaceInit  (USBH_HandleTypeDef *phost);
+static USBH_StatusTypeDef USBH_HUB_InterfaceDeInit  (USBH_HandleTypeDef *phost);
+static USBH_StatusTypeDef USBH_HUB_ClassRequest(USBH_HandleTypeDef *phost);
+static USBH_StatusTypeDef USBH_HUB_Process(USBH_HandleTypeDef *phost);
+static USBH_StatusTypeDef USBH_HUB_SOFProcess(USBH_HandleTypeDef *phost);
+static void  USBH_HUB_DetachPort (USBH_HandleTypeDef *phost, uint8_t port);
+static uint8_t  USBH_HUB_LowestPort (uint32_t ports);
+
+USBH_ClassTypeDef  HUB_Class =
+{
+  "HUB",
+  USB_HUB_CLASS,
+  USBH_HUB_InterfaceInit,
+  USBH_HUB_InterfaceDeInit,
+  USBH_HUB_ClassRequest,
+  USBH_HUB_Process,
+  USBH_HUB_SOFProcess,
+  NULL,
+};
+/**
+* @}
+*/
+
+
+/** @defgroup USBH_HUB_CORE_Private_Functions
+* @{
+*/
+
+
+/**
+  * @brief  USBH_HUB_InterfaceInit
+  *         The function init the HUB class.
+  * @param  phost: Host handle
+  * @retval USBH Status
+  */
+static USBH_StatusTypeDef USBH_HUB_InterfaceInit (USBH_HandleTypeDef *phost)
+{
+  uint8_t interface;
+  USBH_EpDescTypeDef *ep;
+  HUB_HandleTypeDef *HUB_Handle;
+
+  interface = USBH_FindInterface(phost, phost->pActiveClass->ClassCode, 0xFFU, 0xFFU);
+
+  if ((interface == 0xFFU) || (phost->pRoot != NULL)) /* No Valid Interface, or behind a hub */
+  {
+    USBH_DbgLog ("Cannot Find the interface for %s class.", phost->pActiveClass->Name);
+    return USBH_FAIL;
+  }
+
+  USBH_SelectInterface (phost, interface);
+  phost->pActiveClass->pData = (HUB_HandleTypeDef *)USBH_malloc (sizeof(HUB_HandleTypeDef));
+  HUB_Handle = (HUB_HandleTypeDef *) phost->pActiveClass->pData;
+
+  if (HUB_Handle == NULL)
+  {
+    return USBH_FAIL;
+  }
+
+  USBH_memset(HUB_Handle, 0, sizeof(HUB_HandleTypeDef));
+
+  /* The status change endpoint is the only endpoint of a hub */
+  ep = &phost->device.CfgDesc.Itf_Desc[phost->device.current_interface].Ep_Desc[0];
+
+  HUB_Handle->InEp = ep->bEndpointAddress;
+  HUB_Handle->length = (ep->wMaxPacketSize < sizeof(HUB_Handle->Buff[0])) ?
+                       ep->wMaxPacketSize : (uint16_t)sizeof(HUB_Handle->Buff[0]);
+
+  /* bInterval: frames at full speed, 2^(bInterval-1) microframes at high speed */
+  if (phost->device.speed == USBH_SPEED_HIGH)
+  {
+    HUB_Handle->poll = (uint16_t)(1U << (((ep->bInterval > 16U) ? 16U : ((ep->bInterval == 0U) ? 1U : ep->bInterval)) - 1U));
+  }
+  else
+  {
+    HUB_Handle->poll = (ep->bInterval != 0U) ? ep->bInterval : 1U;
+  }
+
+  HUB_Handle->state = HUB_IDLE;
+  HUB_Handle->ctl_state = HUB_REQ_INIT;
+
+  HUB_Handle->InPipe = USBH_AllocPipe(phost, HUB_Handle->InEp);
+
+  /* Open pipe for IN endpoint */
+  USBH_OpenPipe  (phost,
+                  HUB_Handle->InPipe,
+                  HUB_Handle->InEp,
+                  phost->device.address,
+                  phost->device.speed,
+                  USB_EP_TYPE_INTR,
+                  ep->wMaxPacketSize);
+
+  USBH_LL_SetToggle (phost, HUB_Handle->InPipe, 0U);
+
+  return USBH_OK;
+}
+
+/**
+  * @brief  USBH_HUB_InterfaceDeInit
+  *         The function DeInit the Pipes used for the HUB class and stops
+  *         the devices behind the hub.
+  * @param  phost: Host handle
+  * @retval USBH Status
+  */
+static USBH_StatusTypeDef USBH_HUB_InterfaceDeInit (USBH_HandleTypeDef *phost)
+{
+  HUB_HandleTypeDef *HUB_Handle =  (HUB_HandleTypeDef *) phost->pActiveClass->pData;
+  uint8_t port;
+
+  if (HUB_Handle == NULL)
+  {
+    return USBH_OK;
+  }
+
+  for (port = 1U; port <= USBH_HUB_MAX_PORTS; port++)
+  {
+    USBH_HUB_DetachPort(phost, port);
+  }
+
+  if(HUB_Handle->InPipe != 0x00U)
+  {
+    USBH_ClosePipe  (phost, HUB_Handle->InPipe);
+    USBH_FreePipe  (phost, HUB_Handle->InPipe);
+    HUB_Handle->InPipe = 0U;     /* Reset the pipe as Free */
+  }
+
+  USBH_free (phost->pActiveClass->pData);
+  phost->pActiveClass->pData = NULL;
+
+  return USBH_OK;
+}
+
+/**
+  * @brief  USBH_HUB_ClassRequest
+  *         The function is responsible for handling Standard requests
+  *         for HUB class: read the hub descriptor and power the ports.
+  * @param  phost: Host handle
+  * @retval USBH Status
+  */
+static USBH_StatusTypeDef USBH_HUB_ClassRequest(USBH_HandleTypeDef *phost)
+{
+  USBH_StatusTypeDef status = USBH_BUSY;
+  HUB_HandleTypeDef *HUB_Handle =  (HUB_HandleTypeDef *) phost->pActiveClass->pData;
+
+  switch (HUB_Handle->ctl_state)
+  {
+  case HUB_REQ_INIT:
+  case HUB_REQ_GET_HUB_DESC:
+    if (USBH_HUB_GetHubDescriptor(phost, phost->device.Data, USB_HUB_DESC_SIZE) == USBH_OK)
+    {
+      HUB_Handle->NbrPorts = phost->device.Data[2];
+      HUB_Handle->Characteristics = LE16(&phost->device.Data[3]);
+      HUB_Handle->PwrOn2PwrGood = phost->device.Data[5];
+
+      if (HUB_Handle->NbrPorts > USBH_HUB_MAX_PORTS)
+      {
+        USBH_UsrLog ("Hub has %d ports, %d handled.", HUB_Handle->NbrPorts, USBH_HUB_MAX_PORTS);
+        HUB_Handle->NbrPorts = USBH_HUB_MAX_PORTS;
+      }
+
+      HUB_Handle->port = 1U;
+      HUB_Handle->ctl_state = (HUB_Handle->NbrPorts != 0U) ? HUB_REQ_SET_POWER : HUB_REQ_IDLE;
+    }
+    break;
+
+  case HUB_REQ_SET_POWER:
+    if (USBH_HUB_SetPortFeature(phost, HUB_Handle->port, HUB_FEATURE_PORT_POWER) == USBH_OK)
+    {
+      HUB_Handle->port++;
+      if (HUB_Handle->port > HUB_Handle->NbrPorts)
+      {
+        HUB_Handle->timer = phost->Timer;
+        HUB_Handle->ctl_state = HUB_REQ_POWER_WAIT;
+      }
+    }
+    break;
+
+  case HUB_REQ_POWER_WAIT:
+    /* Wait for the power to be good on the ports */
+    if ((phost->Timer - HUB_Handle->timer) >=
+        HUB_MS_TO_SOF(phost, 2U * (uint32_t)HUB_Handle->PwrOn2PwrGood))
+    {
+      /* Read the status of every port once */
+      HUB_Handle->PortChange = ((1UL << HUB_Handle->NbrPorts) - 1U) << 1U;
+      HUB_Handle->ctl_state = HUB_REQ_IDLE;
+    }
+    break;
+
+  case HUB_REQ_IDLE:
+  default:
+    HUB_Handle->state = HUB_IDLE;
+    phost->pUser(phost, HOST_USER_CLASS_ACTIVE);
+    status = USBH_OK;
+    break;
+  }
+
+#if (USBH_USE_OS == 1U)
+  osMessagePut ( phost->os_event, USBH_CLASS_EVENT, 0U);
+#endif
+
+  return status;
+}
+
+/**
+  * @brief  USBH_HUB_Process
+  *         The function is for managing state machine for HUB port events,
+  *         then runs the state machines of the devices behind the hub.
+  * @param  phost: Host handle
+  * @retval USBH Status
+  */
+static USBH_StatusTypeDef USBH_HUB_Process(USBH_HandleTypeDef *phost)
+{
+  HUB_HandleTypeDef *HUB_Handle = (HUB_HandleTypeDef *) phost->pActiveClass->pData;
+  USBH_HandleTypeDef *child;
+  USBH_URBStateTypeDef urb_state;
+  USBH_StatusTypeDef status;
+  uint8_t *buff = (uint8_t *)HUB_Handle->Buff;
+  uint32_t ports;
+  uint8_t speed;
+  uint8_t port;
+
+  switch (HUB_Handle->state)
+  {
+  case HUB_IDLE:
+    /* Address 0 is free again once the device being enumerated has its own */
+    if (HUB_Handle->EnumPort != 0U)
+    {
+      child = &HUB_Handle->Port[HUB_Handle->EnumPort - 1U].host;
+      if ((HUB_Handle->Port[HUB_Handle->EnumPort - 1U].active == 0U) ||
+          (child->device.address != 0U) || (child->gState == HOST_ABORT_STATE))
+      {
+        HUB_Handle->EnumPort = 0U;
+      }
+    }
+
+    if (HUB_Handle->PortChange != 0U)
+    {
+      HUB_Handle->port = USBH_HUB_LowestPort(HUB_Handle->PortChange);
+      HUB_Handle->PortChange &= ~(1UL << HUB_Handle->port);
+      HUB_Handle->state = HUB_PORT_STATUS;
+    }
+    else if ((HUB_Handle->PortConnect != 0U) && (HUB_Handle->EnumPort == 0U))
+    {
+      HUB_Handle->port = USBH_HUB_LowestPort(HUB_Handle->PortConnect);
+      HUB_Handle->PortConnect &= ~(1UL << HUB_Handle->port);
+      HUB_Handle->timer = phost->Timer;
+      HUB_Handle->state = HUB_PORT_DEBOUNCE;
+    }
+    else
+    {
+      HUB_Handle->state = HUB_GET_DATA;
+    }
+    break;
+
+  case HUB_GET_DATA:
+    HUB_Handle->Buff[0] = 0U;
+    (void)USBH_InterruptReceiveData(phost, buff, (uint8_t)HUB_Handle->length,
+                                    HUB_Handle->InPipe);
+    HUB_Handle->timer = phost->Timer;
+    HUB_Handle->state = HUB_POLL;
+    break;
+
+  case HUB_POLL:
+    urb_state = USBH_LL_GetURBState(phost, HUB_Handle->InPipe);
+
+    if (urb_state == USBH_URB_DONE)
+    {
+      /* Bit 0 reports a hub change (local power, over-current): the
+         port changes are in bits 1 to NbrPorts */
+      ports = (uint32_t)buff[0] | ((uint32_t)buff[1] << 8) |
+              ((uint32_t)buff[2] << 16) | ((uint32_t)buff[3] << 24);
+      HUB_Handle->PortChange |= ports & (((1UL << HUB_Handle->NbrPorts) - 1U) << 1U);
+      HUB_Handle->state = HUB_IDLE;
+    }
+    else if (urb_state == USBH_URB_STALL)
+    {
+      /* Issue Clear Feature on interrupt IN endpoint */
+      if (USBH_ClrFeature(phost, HUB_Handle->InEp) == USBH_OK)
+      {
+        HUB_Handle->state = HUB_IDLE;
+      }
+    }
+    else if ((phost->Timer - HUB_Handle->timer) >= HUB_Handle->poll)
+    {
+      /* NAKed: poll again, or handle a pending connection */
+      HUB_Handle->state = HUB_IDLE;
+    }
+    else
+    {
+      /* ... */
+    }
+    break;
+
+  case HUB_PORT_STATUS:
+    status = USBH_HUB_GetPortStatus(phost, HUB_Handle->port, buff);
+    if (status == USBH_OK)
+    {
+      HUB_Handle->PortStatus = LE16(&buff[0]);
+      HUB_Handle->PortChangeBits = LE16(&buff[2]) & HUB_PORT_CHANGE_ALL;
+      HUB_Handle->ConnectChange = ((HUB_Handle->PortChangeBits & HUB_PORT_CHANGE_CONNECTION) != 0U) ? 1U : 0U;
+      HUB_Handle->state = HUB_PORT_CLEAR;
+    }
+    else if (status != USBH_BUSY)
+    {
+      HUB_Handle->state = HUB_IDLE;
+    }
+    else
+    {
+      /* ... */
+    }
+    break;
+
+  case HUB_PORT_CLEAR:
+    /* Acknowledge the changes one at a time */
+    if (HUB_Handle->PortChangeBits != 0U)
+    {
+      port = USBH_HUB_LowestPort(HUB_Handle->PortChangeBits);
+      status = USBH_HUB_ClearPortFeature(phost, HUB_Handle->port,
+                                         (uint16_t)(HUB_FEATURE_C_PORT_CONNECTION + port));
+      if (status != USBH_BUSY)
+      {
+        HUB_Handle->PortChangeBits &= (uint16_t)~(1U << port);
+      }
+    }
+    else
+    {
+      HUB_Handle->state = HUB_PORT_EVENT;
+    }
+    break;
+
+  case HUB_PORT_EVENT:
+    port = HUB_Handle->port;
+
+    if ((HUB_Handle->PortStatus & HUB_PORT_STATUS_OVER_CURRENT) != 0U)
+    {
+      USBH_ErrLog ("Hub port %d over-current.", port);
+    }
+
+    /* Removed, or replaced while the change was pending */
+    if (((HUB_Handle->PortStatus & HUB_PORT_STATUS_CONNECTION) == 0U) ||
+        (HUB_Handle->ConnectChange != 0U))
+    {
+      USBH_HUB_DetachPort(phost, port);
+    }
+
+    if (((HUB_Handle->PortStatus & HUB_PORT_STATUS_CONNECTION) != 0U) &&
+        (HUB_Handle->Port[port - 1U].active == 0U))
+    {
+      HUB_Handle->PortConnect |= (1UL << port);
+    }
+
+    HUB_Handle->state = HUB_IDLE;
+    break;
+
+  case HUB_PORT_DEBOUNCE:
+    if ((phost->Timer - HUB_Handle->timer) >= HUB_MS_TO_SOF(phost, USBH_HUB_DEBOUNCE_MS))
+    {
+      HUB_Handle->state = HUB_PORT_RESET;
+    }
+    break;
+
+  case HUB_PORT_RESET:
+    status = USBH_HUB_SetPortFeature(phost, HUB_Handle->port, HUB_FEATURE_PORT_RESET);
+    if (status == USBH_OK)
+    {
+      HUB_Handle->timer = phost->Timer;
+      HUB_Handle->reset_timer = phost->Timer;
+      HUB_Handle->state = HUB_PORT_RESET_WAIT;
+    }
+    else if (status != USBH_BUSY)
+    {
+      HUB_Handle->state = HUB_IDLE;
+    }
+    else
+    {
+      /* ... */
+    }
+    break;
+
+  case HUB_PORT_RESET_WAIT:
+    if ((phost->Timer - HUB_Handle->timer) >= HUB_MS_TO_SOF(phost, HUB_RESET_POLL_MS))
+    {
+      HUB_Handle->state = HUB_PORT_RESET_STATUS;
+    }
+    break;
+
+  case HUB_PORT_RESET_STATUS:
+    status = USBH_HUB_GetPortStatus(phost, HUB_Handle->port, buff);
+    if (status == USBH_OK)
+    {
+      HUB_Handle->PortStatus = LE16(&buff[0]);
+
+      if ((HUB_Handle->PortStatus & HUB_PORT_STATUS_CONNECTION) == 0U)
+      {
+        /* Removed during the reset */
+        HUB_Handle->state = HUB_IDLE;
+      }
+      else if ((HUB_Handle->PortStatus & HUB_PORT_STATUS_RESET) != 0U)
+      {
+        if ((phost->Timer - HUB_Handle->reset_timer) >= HUB_MS_TO_SOF(phost, HUB_RESET_TIMEOUT_MS))
+        {
+          USBH_ErrLog ("Hub port %d reset timeout.", HUB_Handle->port);
+          HUB_Handle->state = HUB_IDLE;
+        }
+        else
+        {
+          HUB_Handle->timer = phost->Timer;
+          HUB_Handle->state = HUB_PORT_RESET_WAIT;
+        }
+      }
+      else
+      {
+        HUB_Handle->state = HUB_PORT_RESET_CLEAR;
+      }
+    }
+    else if (status != USBH_BUSY)
+    {
+      HUB_Handle->state = HUB_IDLE;
+    }
+    else
+    {
+      /* ... */
+    }
+    break;
+
+  case HUB_PORT_RESET_CLEAR:
+    if (USBH_HUB_ClearPortFeature(phost, HUB_Handle->port, HUB_FEATURE_C_PORT_RESET) != USBH_BUSY)
+    {
+      HUB_Handle->timer = phost->Timer;
+      HUB_Handle->state = HUB_PORT_RECOVERY;
+    }
+    break;
+
+  case HUB_PORT_RECOVERY:
+    if ((phost->Timer - HUB_Handle->timer) >= HUB_MS_TO_SOF(phost, USBH_HUB_RESET_RECOVERY_MS))
+    {
+      HUB_Handle->state = HUB_PORT_ATTACH;
+    }
+    break;
+
+  case HUB_PORT_ATTACH:
+    port = HUB_Handle->port;
+    HUB_Handle->state = HUB_IDLE;
+
+    if ((HUB_Handle->PortStatus & HUB_PORT_STATUS_ENABLE) == 0U)
+    {
+      break;
+    }
+
+    if ((HUB_Handle->PortStatus & HUB_PORT_STATUS_HIGH_SPEED) != 0U)
+    {
+      speed = USBH_SPEED_HIGH;
+    }
+    else if ((HUB_Handle->PortStatus & HUB_PORT_STATUS_LOW_SPEED) != 0U)
+    {
+      speed = USBH_SPEED_LOW;
+    }
+    else
+    {
+      speed = USBH_SPEED_FULL;
+    }
+
+    if ((phost->device.speed == USBH_SPEED_HIGH) && (speed != USBH_SPEED_HIGH))
+    {
+      USBH_ErrLog ("Hub port %d: split transactions not supported.", port);
+      break;
+    }
+
+    if (USBH_AttachChild(phost, &HUB_Handle->Port[port - 1U].host, port, speed, &HUB_Class) == USBH_OK)
+    {
+      HUB_Handle->Port[port - 1U].active = 1U;
+      HUB_Handle->EnumPort = port;
+      USBH_UsrLog ("Device attached to hub port %d.", port);
+      USBH_HUB_PortCallback(phost, port, 1U);
+    }
+    break;
+
+  default:
+    break;
+  }
+
+  /* Run the devices behind the hub */
+  for (port = 0U; port < HUB_Handle->NbrPorts; port++)
+  {
+    if (HUB_Handle->Port[port].active != 0U)
+    {
+      (void)USBH_Process(&HUB_Handle->Port[port].host);
+    }
+  }
+
+#if (USBH_USE_OS == 1U)
+  if (HUB_Handle->state != HUB_POLL)
+  {
+    osMessagePut ( phost->os_event, USBH_CLASS_EVENT, 0U);
+  }
+#endif
+
+  return USBH_OK;
+}
+
+/**
+  * @brief  USBH_HUB_SOFProcess
+  *         The function is for managing the SOF Process: the timers of the
+  *         devices behind the hub follow the SOF of the root port.
+  * @param  phost: Host handle
+  * @retval USBH Status
+  */
+static USBH_StatusTypeDef USBH_HUB_SOFProcess(USBH_HandleTypeDef *phost)
+{
+  HUB_HandleTypeDef *HUB_Handle = (HUB_HandleTypeDef *) phost->pActiveClass->pData;
+  uint8_t port;
+
+  for (port = 0U; port < HUB_Handle->NbrPorts; port++)
+  {
+    if (HUB_Handle->Port[port].active != 0U)
+    {
+      USBH_LL_IncTimer(&HUB_Handle->Port[port].host);
+    }
+  }
+
+#if (USBH_USE_OS == 1U)
+  if ((HUB_Handle->state == HUB_POLL) &&
+      ((phost->Timer - HUB_Handle->timer) >= HUB_Handle->poll))
+  {
+    osMessagePut ( phost->os_event, USBH_CLASS_EVENT, 0U);
+  }
+#endif
+
+  return USBH_OK;
+}
+
+/**
+  * @brief  USBH_HUB_DetachPort
+  *         Stop the device of a port and give back its host channels.
+  * @param  phost: Host handle
+  * @param  port: hub port, from 1
+  * @retval None
+  */
+static void  USBH_HUB_DetachPort (USBH_HandleTypeDef *phost, uint8_t port)
+{
+  HUB_HandleTypeDef *HUB_Handle = (HUB_HandleTypeDef *) phost->pActiveClass->pData;
+  HUB_PortTypeDef *hport = &HUB_Handle->Port[port - 1U];
+
+  if (hport->active == 0U)
+  {
+    return;
+  }
+
+  /* Stop the timer of the device before its handle is released */
+  hport->active = 0U;
+  (void)USBH_DetachChild(&hport->host);
+
+  if (HUB_Handle->EnumPort == port)
+  {
+    HUB_Handle->EnumPort = 0U;
+  }
+
+  USBH_UsrLog ("Device detached from hub port %d.", port);
+  USBH_HUB_PortCallback(phost, port, 0U);
+}
+
+/**
+  * @brief  USBH_HUB_LowestPort
+  *         Return the index of the lowest bit set.
+  * @param  ports: bit field, not 0
+  * @retval bit index
+  */
+static uint8_t  USBH_HUB_LowestPort (uint32_t ports)
+{
+  uint8_t idx = 0U;
+
+  while ((ports & 1U) == 0U)
+  {
+    ports >>= 1;
+    idx++;
+  }
+  return idx;
+}
+
+/**
+  * @brief  USBH_HUB_GetHubDescriptor
+  *         Issue Get Hub Descriptor command to the hub.
+  * @param  phost: Host handle
+  * @param  buff: buffer for the descriptor
+  * @param  length: descriptor length to read
+  * @retval USBH Status
+  */
+USBH_StatusTypeDef USBH_HUB_GetHubDescriptor (USBH_HandleTypeDef *phost,
+                                              uint8_t *buff,
+                                              uint16_t length)
+{
+  return USBH_GetDescriptor(phost,
+                            USB_REQ_RECIPIENT_DEVICE | USB_REQ_TYPE_CLASS,
+                            USB_DESC_HUB,
+                            buff,
+                            length);
+}
+
+/**
+  * @brief  USBH_HUB_GetPortStatus
+  *         Issue Get Port Status: wPortStatus then wPortChange.
+  * @param  phost: Host handle
+  * @param  port: hub port, from 1
+  * @param  buff: 4-byte buffer for the status
+  * @retval USBH Status
+  */
+USBH_StatusTypeDef USBH_HUB_GetPortStatus (USBH_HandleTypeDef *phost,
+                                           uint8_t port,
+                                           uint8_t *buff)
+{
+  if (phost->RequestState == CMD_SEND)
+  {
+    phost->Control.setup.b.bmRequestType = USB_D2H | USB_REQ_RECIPIENT_OTHER |\
+      USB_REQ_TYPE_CLASS;
+
+    phost->Control.setup.b.bRequest = USB_REQ_GET_STATUS;
+    phost->Control.setup.b.wValue.w = 0U;
+    phost->Control.setup.b.wIndex.w = port;
+    phost->Control.setup.b.wLength.w = 4U;
+  }
+
+  return USBH_CtlReq(phost, buff, 4U);
+}
+
+/**
+  * @brief  USBH_HUB_SetPortFeature
+  *         Issue Set Port Feature.
+  * @param  phost: Host handle
+  * @param  port: hub port, from 1
+  * @param  feature: HUB_FEATURE_xxx
+  * @retval USBH Status
+  */
+USBH_StatusTypeDef USBH_HUB_SetPortFeature (USBH_HandleTypeDef *phost,
+                                            uint8_t port,
+                                            uint16_t feature)
+{
+  if (phost->RequestState == CMD_SEND)
+  {
+    phost->Control.setup.b.bmRequestType = USB_H2D | USB_REQ_RECIPIENT_OTHER |\
+      USB_REQ_TYPE_CLASS;
+
+    phost->Control.setup.b.bRequest = USB_REQ_SET_FEATURE;
+    phost->Control.setup.b.wValue.w = feature;
+    phost->Control.setup.b.wIndex.w = port;
+    phost->Control.setup.b.wLength.w = 0U;
+  }
+
+  return USBH_CtlReq(phost, 0U, 0U);
+}
+
+/**
+  * @brief  USBH_HUB_ClearPortFeature
+  *         Issue Clear Port Feature.
+  * @param  phost: Host handle
+  * @param  port: hub port, from 1
+  * @param  feature: HUB_FEATURE_xxx
+  * @retval USBH Status
+  */
+USBH_StatusTypeDef USBH_HUB_ClearPortFeature (USBH_HandleTypeDef *phost,
+                                              uint8_t port,
+                                              uint16_t feature)
+{
+  if (phost->RequestState == CMD_SEND)
+  {
+    phost->Control.setup.b.bmRequestType = USB_H2D | USB_REQ_RECIPIENT_OTHER |\
+      USB_REQ_TYPE_CLASS;
+
+    phost->Control.setup.b.bRequest = USB_REQ_CLEAR_FEATURE;
+    phost->Control.setup.b.wValue.w = feature;
+    phost->Control.setup.b.wIndex.w = port;
+    phost->Control.setup.b.wLength.w = 0U;
+  }
+
+  return USBH_CtlReq(phost, 0U, 0U);
+}
+
+/**
+  * @brief  USBH_HUB_GetPortCount
+  *         Return the number of ports handled on the hub.
+  * @param  phost: Host handle
+  * @retval number of ports, 0 if the HUB class is not active
+  */
+uint8_t USBH_HUB_GetPortCount (USBH_HandleTypeDef *phost)
+{
+  HUB_HandleTypeDef *HUB_Handle;
+
+  if ((phost->gState != HOST_CLASS) || (phost->pActiveClass != &HUB_Class))
+  {
+    return 0U;
+  }
+
+  HUB_Handle = (HUB_HandleTypeDef *) phost->pActiveClass->pData;
+  return HUB_Handle->NbrPorts;
+}
+
+/**
+  * @brief  USBH_HUB_GetPortHost
+  *         Return the host handle of the device on a hub port, to be passed
+  *         to the class functions (USBH_MSC_Read, USBH_HID_GetKeybdInfo...).
+  * @param  phost: Host handle
+  * @param  port: hub port, from 1
+  * @retval device host handle, NULL if no device is attached
+  */
+USBH_HandleTypeDef *USBH_HUB_GetPortHost (USBH_HandleTypeDef *phost,
+                                          uint8_t port)
+{
+  HUB_HandleTypeDef *HUB_Handle;
+
+  if ((port == 0U) || (port > USBH_HUB_GetPortCount(phost)))
+  {
+    return NULL;
+  }
+
+  HUB_Handle = (HUB_HandleTypeDef *) phost->pActiveClass->pData;
+  if (HUB_Handle->Port[port - 1U].active == 0U)
+  {
+    return NULL;
+  }
+  return &HUB_Handle->Port[port - 1U].host;
+}
+
+/**
+* @brief  The function informs the application of a device attached to or
+*         detached from a hub port.
+*  @param  phost: Host handle of the hub
+*  @param  port: hub port, from 1
+*  @param  connected: 1 when attached, 0 when detached
+* @retval None
+*/
+__weak void USBH_HUB_PortCallback(USBH_HandleTypeDef *phost,
+                                  uint8_t port,
+                                  uint8_t connected)
+{
+
+}
+/**
+* @}
+*/
+
+/**
+* @}
+*/
+
+/**
+* @}
+*/
+
+
+/**
+* @}
+*/
+
+
+/**
+* @}
+*/
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
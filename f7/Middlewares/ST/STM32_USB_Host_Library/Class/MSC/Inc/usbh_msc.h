@@ -90,6 +90,7 @@ typedef enum
   MSC_WRITE,
   MSC_UNRECOVERED_ERROR,
   MSC_PERIODIC_CHECK,
+  MSC_ASYNC,
 }
 MSC_StateTypeDef;
 
@@ -115,6 +116,26 @@ MSC_ReqStateTypeDef;
     #define MAX_SUPPORTED_LUN       2U
 #endif
 
+/* Largest number of blocks issued by one merged READ10/WRITE10 command */
+#ifndef USBH_MSC_MAX_MERGE_BLOCKS
+    #define USBH_MSC_MAX_MERGE_BLOCKS  128U
+#endif
+
+/* Structure for an asynchronous read/write request */
+typedef struct _MSC_RequestTypeDef
+{
+  uint8_t                     lun;
+  MSC_StateTypeDef            op;
+  uint32_t                    address;
+  uint8_t                     *pbuf;
+  uint32_t                    length;
+  USBH_StatusTypeDef          status;
+  void                        (*Callback)(struct _USBH_HandleTypeDef *phost, struct _MSC_RequestTypeDef *req);
+  void                        *pContext;
+  struct _MSC_RequestTypeDef  *next;
+}
+MSC_RequestTypeDef;
+
 
 /* Structure for LUN */
 typedef struct
@@ -149,6 +170,10 @@ typedef struct _MSC_Process
   uint16_t             current_lun;
   uint16_t             rw_lun;
   uint32_t             timer;
+  MSC_RequestTypeDef   *req_head;
+  MSC_RequestTypeDef   *req_tail;
+  MSC_RequestTypeDef   *batch;
+  uint32_t             batch_len;
 }
 MSC_HandleTypeDef;
 
@@ -219,6 +244,10 @@ USBH_StatusTypeDef USBH_MSC_Write(USBH_HandleTypeDef *phost,
                                      uint32_t address,
                                      uint8_t *pbuf,
                                      uint32_t length);
+
+USBH_StatusTypeDef USBH_MSC_ReadAsync(USBH_HandleTypeDef *phost, MSC_RequestTypeDef *req);
+
+USBH_StatusTypeDef USBH_MSC_WriteAsync(USBH_HandleTypeDef *phost, MSC_RequestTypeDef *req);
 /**
   * @}
   */
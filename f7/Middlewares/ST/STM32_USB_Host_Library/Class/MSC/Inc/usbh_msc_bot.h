@@ -145,6 +145,8 @@ typedef union
 }
 BOT_CSWTypeDef;
 
+struct _MSC_RequestTypeDef;
+
 typedef struct
 {
   uint32_t                   data[16];
@@ -156,6 +158,8 @@ typedef struct
   BOT_CSWTypeDef             csw;
   uint8_t                    Reserved2[3];
   uint8_t                    *pbuf;
+  struct _MSC_RequestTypeDef *seg;
+  uint32_t                   seg_len;
 }
 BOT_HandleTypeDef;
 
@@ -189,6 +193,12 @@ BOT_HandleTypeDef;
 #define BOT_CBW_CB_LENGTH            16U
 
 
+/* Number of max-size packets moved by one data-stage URB. Keep 1U when the
+   HCD runs in slave mode; up to 256U (the OTG channel packet limit) with DMA */
+#ifndef USBH_MSC_BOT_XFER_PACKETS
+#define USBH_MSC_BOT_XFER_PACKETS        1U
+#endif
+
 #define MAX_BULK_STALL_COUNT_LIMIT       0x04U   /* If STALL is seen on Bulk
                                          Endpoint continuously, this means
                                          that device and Host has phase error
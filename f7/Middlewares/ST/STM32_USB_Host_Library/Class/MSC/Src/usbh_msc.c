@@ -133,6 +133,12 @@ static USBH_StatusTypeDef USBH_MSC_SOFProcess(USBH_HandleTypeDef *phost);
 
 static USBH_StatusTypeDef USBH_MSC_RdWrProcess(USBH_HandleTypeDef *phost, uint8_t lun);
 
+static USBH_StatusTypeDef USBH_MSC_QueueRequest(USBH_HandleTypeDef *phost, MSC_RequestTypeDef *req);
+
+static void USBH_MSC_StartBatch(USBH_HandleTypeDef *phost);
+
+static void USBH_MSC_CompleteBatch(USBH_HandleTypeDef *phost, USBH_StatusTypeDef status);
+
 USBH_ClassTypeDef  USBH_msc =
 {
   "MSC",
@@ -218,6 +224,10 @@ static USBH_StatusTypeDef USBH_MSC_InterfaceInit (USBH_HandleTypeDef *phost)
     MSC_Handle->state = MSC_INIT;
     MSC_Handle->error = MSC_OK;
     MSC_Handle->req_state = MSC_REQ_IDLE;
+    MSC_Handle->req_head = NULL;
+    MSC_Handle->req_tail = NULL;
+    MSC_Handle->batch = NULL;
+    MSC_Handle->batch_len = 0U;
     MSC_Handle->OutPipe = USBH_AllocPipe(phost, MSC_Handle->OutEp);
     MSC_Handle->InPipe = USBH_AllocPipe(phost, MSC_Handle->InEp);
 
@@ -259,6 +269,27 @@ static USBH_StatusTypeDef USBH_MSC_InterfaceInit (USBH_HandleTypeDef *phost)
 static USBH_StatusTypeDef USBH_MSC_InterfaceDeInit (USBH_HandleTypeDef *phost)
 {
   MSC_HandleTypeDef *MSC_Handle =  (MSC_HandleTypeDef *) phost->pActiveClass->pData;
+  MSC_RequestTypeDef *req;
+
+  /* Fail the command in progress and every request still queued */
+  if (MSC_Handle->batch != NULL)
+  {
+    USBH_MSC_CompleteBatch(phost, USBH_FAIL);
+  }
+
+  while (MSC_Handle->req_head != NULL)
+  {
+    req = MSC_Handle->req_head;
+    MSC_Handle->req_head = req->next;
+    req->next = NULL;
+    req->status = USBH_FAIL;
+
+    if (req->Callback != NULL)
+    {
+      req->Callback(phost, req);
+    }
+  }
+  MSC_Handle->req_tail = NULL;
 
   if ( MSC_Handle->OutPipe)
   {
@@ -530,6 +561,35 @@ static USBH_StatusTypeDef USBH_MSC_Process(USBH_HandleTypeDef *phost)
 
   case MSC_IDLE:
     error = USBH_OK;
+
+    if (MSC_Handle->req_head != NULL)
+    {
+      USBH_MSC_StartBatch(phost);
+    }
+    break;
+
+  case MSC_ASYNC:
+    scsi_status = USBH_MSC_RdWrProcess(phost, (uint8_t)MSC_Handle->rw_lun);
+
+    if ((scsi_status == USBH_BUSY) &&
+        (((phost->Timer - MSC_Handle->timer) > (10000U * MSC_Handle->batch_len)) ||
+         (phost->device.is_connected == 0U)))
+    {
+      MSC_Handle->unit[MSC_Handle->rw_lun].state = MSC_UNRECOVERED_ERROR;
+      scsi_status = USBH_FAIL;
+    }
+
+    if (scsi_status != USBH_BUSY)
+    {
+      USBH_MSC_CompleteBatch(phost, scsi_status);
+      MSC_Handle->state = MSC_IDLE;
+
+      /* Issue the next command right away to keep the bulk pipes busy */
+      if (MSC_Handle->req_head != NULL)
+      {
+        USBH_MSC_StartBatch(phost);
+      }
+    }
     break;
 
   default:
@@ -538,6 +598,157 @@ static USBH_StatusTypeDef USBH_MSC_Process(USBH_HandleTypeDef *phost)
   return error;
 }
 
+/**
+  * @brief  USBH_MSC_StartBatch
+  *         Take the next request off the queue, merge the requests that
+  *         continue it on the same LUN and issue them as one SCSI command.
+  * @param  phost: Host handle
+  * @retval None
+  */
+static void USBH_MSC_StartBatch(USBH_HandleTypeDef *phost)
+{
+  MSC_HandleTypeDef *MSC_Handle =  (MSC_HandleTypeDef *) phost->pActiveClass->pData;
+  MSC_RequestTypeDef *req = MSC_Handle->req_head;
+  MSC_RequestTypeDef *prev = NULL;
+  MSC_RequestTypeDef *first;
+  MSC_RequestTypeDef *last;
+  MSC_RequestTypeDef *next;
+
+  /* Serve the LUNs in turn: prefer a request for another unit than the
+     one of the previous command */
+  while ((req != NULL) && (req->lun == MSC_Handle->rw_lun))
+  {
+    prev = req;
+    req = req->next;
+  }
+
+  if (req == NULL)
+  {
+    req = MSC_Handle->req_head;
+    prev = NULL;
+  }
+
+  first = req;
+  next = first->next;
+
+  if (prev == NULL)
+  {
+    MSC_Handle->req_head = next;
+  }
+  else
+  {
+    prev->next = next;
+  }
+
+  if (MSC_Handle->req_tail == first)
+  {
+    MSC_Handle->req_tail = prev;
+  }
+
+  first->next = NULL;
+  last = first;
+  MSC_Handle->batch = first;
+  MSC_Handle->batch_len = first->length;
+
+  /* Merge the following requests of the same unit as long as they extend
+     the command; stop at the first one that does not, to keep ordering */
+  req = next;
+  while (req != NULL)
+  {
+    next = req->next;
+
+    if (req->lun == first->lun)
+    {
+      if ((req->op != first->op) ||
+          (req->address != (last->address + last->length)) ||
+          ((MSC_Handle->batch_len + req->length) > USBH_MSC_MAX_MERGE_BLOCKS))
+      {
+        break;
+      }
+
+      if (prev == NULL)
+      {
+        MSC_Handle->req_head = next;
+      }
+      else
+      {
+        prev->next = next;
+      }
+
+      if (MSC_Handle->req_tail == req)
+      {
+        MSC_Handle->req_tail = prev;
+      }
+
+      req->next = NULL;
+      last->next = req;
+      last = req;
+      MSC_Handle->batch_len += req->length;
+    }
+    else
+    {
+      prev = req;
+    }
+    req = next;
+  }
+
+  if (MSC_Handle->unit[first->lun].state != MSC_IDLE)
+  {
+    USBH_MSC_CompleteBatch(phost, USBH_FAIL);
+    return;
+  }
+
+  MSC_Handle->state = MSC_ASYNC;
+  MSC_Handle->unit[first->lun].state = first->op;
+  MSC_Handle->rw_lun = first->lun;
+  MSC_Handle->timer = phost->Timer;
+  MSC_Handle->hbot.seg = first;
+
+  if (first->op == MSC_READ)
+  {
+    USBH_MSC_SCSI_Read(phost, first->lun, first->address, first->pbuf, MSC_Handle->batch_len);
+  }
+  else
+  {
+    USBH_MSC_SCSI_Write(phost, first->lun, first->address, first->pbuf, MSC_Handle->batch_len);
+  }
+
+#if (USBH_USE_OS == 1U)
+  osMessagePut ( phost->os_event, USBH_CLASS_EVENT, 0U);
+#endif
+}
+
+/**
+  * @brief  USBH_MSC_CompleteBatch
+  *         Report the end of the current command to every merged request.
+  * @param  phost: Host handle
+  * @param  status: command status
+  * @retval None
+  */
+static void USBH_MSC_CompleteBatch(USBH_HandleTypeDef *phost, USBH_StatusTypeDef status)
+{
+  MSC_HandleTypeDef *MSC_Handle =  (MSC_HandleTypeDef *) phost->pActiveClass->pData;
+  MSC_RequestTypeDef *req = MSC_Handle->batch;
+  MSC_RequestTypeDef *next;
+
+  MSC_Handle->batch = NULL;
+  MSC_Handle->batch_len = 0U;
+  MSC_Handle->hbot.seg = NULL;
+
+  while (req != NULL)
+  {
+    next = req->next;
+    req->next = NULL;
+    req->status = status;
+
+    if (req->Callback != NULL)
+    {
+      req->Callback(phost, req);
+    }
+    req = next;
+  }
+}
+
 
 /**
   * @brief  USBH_MSC_SOFProcess
@@ -761,6 +972,7 @@ USBH_StatusTypeDef USBH_MSC_Read(USBH_HandleTypeDef *phost,
 
   if ((phost->device.is_connected == 0U) ||
       (phost->gState != HOST_CLASS) ||
+      (MSC_Handle->state != MSC_IDLE) ||
       (MSC_Handle->unit[lun].state != MSC_IDLE))
   {
     return  USBH_FAIL;
@@ -769,6 +981,7 @@ USBH_StatusTypeDef USBH_MSC_Read(USBH_HandleTypeDef *phost,
   MSC_Handle->state = MSC_READ;
   MSC_Handle->unit[lun].state = MSC_READ;
   MSC_Handle->rw_lun = lun;
+  MSC_Handle->hbot.seg = NULL;
 
   USBH_MSC_SCSI_Read(phost, lun, address, pbuf, length);
 
@@ -808,6 +1021,7 @@ USBH_StatusTypeDef USBH_MSC_Write(USBH_HandleTypeDef *phost,
 
   if ((phost->device.is_connected == 0U) ||
       (phost->gState != HOST_CLASS) ||
+      (MSC_Handle->state != MSC_IDLE) ||
       (MSC_Handle->unit[lun].state != MSC_IDLE))
   {
     return  USBH_FAIL;
@@ -816,6 +1030,7 @@ USBH_StatusTypeDef USBH_MSC_Write(USBH_HandleTypeDef *phost,
   MSC_Handle->state = MSC_WRITE;
   MSC_Handle->unit[lun].state = MSC_WRITE;
   MSC_Handle->rw_lun = lun;
+  MSC_Handle->hbot.seg = NULL;
 
   USBH_MSC_SCSI_Write(phost, lun, address, pbuf, length);
 
@@ -832,6 +1047,79 @@ USBH_StatusTypeDef USBH_MSC_Write(USBH_HandleTypeDef *phost,
   return USBH_OK;
 }
 
+/**
+  * @brief  USBH_MSC_ReadAsync
+  *         The function queues a Read operation. Contiguous requests of a
+  *         LUN are merged into one command; req->Callback is called from the
+  *         host process once the data is transferred.
+  * @param  phost: Host handle
+  * @param  req: request with lun, address, pbuf and length (sectors) set
+  * @retval USBH Status
+  */
+USBH_StatusTypeDef USBH_MSC_ReadAsync(USBH_HandleTypeDef *phost, MSC_RequestTypeDef *req)
+{
+  req->op = MSC_READ;
+
+  return USBH_MSC_QueueRequest(phost, req);
+}
+
+/**
+  * @brief  USBH_MSC_WriteAsync
+  *         The function queues a Write operation. Contiguous requests of a
+  *         LUN are merged into one command; req->Callback is called from the
+  *         host process once the data is transferred.
+  * @param  phost: Host handle
+  * @param  req: request with lun, address, pbuf and length (sectors) set
+  * @retval USBH Status
+  */
+USBH_StatusTypeDef USBH_MSC_WriteAsync(USBH_HandleTypeDef *phost, MSC_RequestTypeDef *req)
+{
+  req->op = MSC_WRITE;
+
+  return USBH_MSC_QueueRequest(phost, req);
+}
+
+/**
+  * @brief  USBH_MSC_QueueRequest
+  *         Append a request to the read/write queue.
+  *         The queue is not protected: submit from the host process context.
+  * @param  phost: Host handle
+  * @param  req: request
+  * @retval USBH Status
+  */
+static USBH_StatusTypeDef USBH_MSC_QueueRequest(USBH_HandleTypeDef *phost, MSC_RequestTypeDef *req)
+{
+  MSC_HandleTypeDef *MSC_Handle =  (MSC_HandleTypeDef *) phost->pActiveClass->pData;
+
+  if ((phost->device.is_connected == 0U) ||
+      (phost->gState != HOST_CLASS) ||
+      (req->lun >= MSC_Handle->max_lun) ||
+      (req->length == 0U) ||
+      (req->length > USBH_MSC_MAX_MERGE_BLOCKS))
+  {
+    return  USBH_FAIL;
+  }
+
+  req->status = USBH_BUSY;
+  req->next = NULL;
+
+  if (MSC_Handle->req_tail == NULL)
+  {
+    MSC_Handle->req_head = req;
+  }
+  else
+  {
+    MSC_Handle->req_tail->next = req;
+  }
+  MSC_Handle->req_tail = req;
+
+#if (USBH_USE_OS == 1U)
+  osMessagePut ( phost->os_event, USBH_CLASS_EVENT, 0U);
+#endif
+
+  return USBH_OK;
+}
+
 /**
   * @}
   */
@@ -108,6 +108,8 @@
 */
 static USBH_StatusTypeDef USBH_MSC_BOT_Abort(USBH_HandleTypeDef *phost, uint8_t lun, uint8_t dir);
 static BOT_CSWStatusTypeDef USBH_MSC_DecodeCSW(USBH_HandleTypeDef *phost);
+static uint16_t USBH_MSC_BOT_XferLength(MSC_HandleTypeDef *MSC_Handle, uint16_t ep_size);
+static void USBH_MSC_BOT_Advance(MSC_HandleTypeDef *MSC_Handle, uint8_t lun, uint16_t length);
 /**
 * @}
 */
@@ -182,6 +184,7 @@ USBH_StatusTypeDef USBH_MSC_BOT_Init(USBH_HandleTypeDef *phost)
   MSC_Handle->hbot.cbw.field.Tag = BOT_CBW_TAG;
   MSC_Handle->hbot.state = BOT_SEND_CBW;
   MSC_Handle->hbot.cmd_state = BOT_CMD_SEND;
+  MSC_Handle->hbot.seg = NULL;
 
   return USBH_OK;
 }
@@ -222,6 +225,16 @@ USBH_StatusTypeDef USBH_MSC_BOT_Process (USBH_HandleTypeDef *phost, uint8_t lun)
     {
       if ( MSC_Handle->hbot.cbw.field.DataTransferLength != 0U)
       {
+        /* A queued command scatters its data stage over the merged requests */
+        if (MSC_Handle->hbot.seg != NULL)
+        {
+          MSC_Handle->hbot.seg_len = MSC_Handle->hbot.seg->length * MSC_Handle->unit[lun].capacity.block_size;
+        }
+        else
+        {
+          MSC_Handle->hbot.seg_len = MSC_Handle->hbot.cbw.field.DataTransferLength;
+        }
+
         /* If there is Data Transfer Stage */
         if (((MSC_Handle->hbot.cbw.field.Flags) & USB_REQ_DIR_MASK) == USB_D2H)
         {
@@ -267,7 +280,8 @@ USBH_StatusTypeDef USBH_MSC_BOT_Process (USBH_HandleTypeDef *phost, uint8_t lun)
   case BOT_DATA_IN:
     /* Send first packet */
     USBH_BulkReceiveData (phost, MSC_Handle->hbot.pbuf,
-                          MSC_Handle->InEpSize, MSC_Handle->InPipe);
+                          USBH_MSC_BOT_XferLength(MSC_Handle, MSC_Handle->InEpSize),
+                          MSC_Handle->InPipe);
 
     MSC_Handle->hbot.state = BOT_DATA_IN_WAIT;
 
@@ -280,22 +294,16 @@ USBH_StatusTypeDef USBH_MSC_BOT_Process (USBH_HandleTypeDef *phost, uint8_t lun)
     if(URB_Status == USBH_URB_DONE)
     {
       /* Adjust Data pointer and data length */
-      if(MSC_Handle->hbot.cbw.field.DataTransferLength > MSC_Handle->InEpSize)
-      {
-          MSC_Handle->hbot.pbuf += MSC_Handle->InEpSize;
-          MSC_Handle->hbot.cbw.field.DataTransferLength -= MSC_Handle->InEpSize;
-      }
-      else
-      {
-        MSC_Handle->hbot.cbw.field.DataTransferLength = 0U;
-      }
+      USBH_MSC_BOT_Advance(MSC_Handle, lun,
+                           USBH_MSC_BOT_XferLength(MSC_Handle, MSC_Handle->InEpSize));
 
       /* More Data To be Received */
       if(MSC_Handle->hbot.cbw.field.DataTransferLength > 0U)
       {
         /* Send next packet */
         USBH_BulkReceiveData (phost, MSC_Handle->hbot.pbuf,
-                              MSC_Handle->InEpSize, MSC_Handle->InPipe);
+                              USBH_MSC_BOT_XferLength(MSC_Handle, MSC_Handle->InEpSize),
+                              MSC_Handle->InPipe);
       }
       else
       {
@@ -330,7 +338,8 @@ USBH_StatusTypeDef USBH_MSC_BOT_Process (USBH_HandleTypeDef *phost, uint8_t lun)
   case BOT_DATA_OUT:
 
     USBH_BulkSendData (phost, MSC_Handle->hbot.pbuf,
-                       MSC_Handle->OutEpSize, MSC_Handle->OutPipe, 1U);
+                       USBH_MSC_BOT_XferLength(MSC_Handle, MSC_Handle->OutEpSize),
+                       MSC_Handle->OutPipe, 1U);
 
     MSC_Handle->hbot.state  = BOT_DATA_OUT_WAIT;
     break;
@@ -341,21 +350,15 @@ USBH_StatusTypeDef USBH_MSC_BOT_Process (USBH_HandleTypeDef *phost, uint8_t lun)
     if(URB_Status == USBH_URB_DONE)
     {
       /* Adjust Data pointer and data length */
-      if(MSC_Handle->hbot.cbw.field.DataTransferLength > MSC_Handle->OutEpSize)
-      {
-          MSC_Handle->hbot.pbuf += MSC_Handle->OutEpSize;
-          MSC_Handle->hbot.cbw.field.DataTransferLength -= MSC_Handle->OutEpSize;
-      }
-      else
-      {
-        MSC_Handle->hbot.cbw.field.DataTransferLength = 0U;
-      }
+      USBH_MSC_BOT_Advance(MSC_Handle, lun,
+                           USBH_MSC_BOT_XferLength(MSC_Handle, MSC_Handle->OutEpSize));
 
       /* More Data To be Sent */
       if(MSC_Handle->hbot.cbw.field.DataTransferLength > 0U)
       {
         USBH_BulkSendData (phost, MSC_Handle->hbot.pbuf,
-                           MSC_Handle->OutEpSize, MSC_Handle->OutPipe, 1U);
+                           USBH_MSC_BOT_XferLength(MSC_Handle, MSC_Handle->OutEpSize),
+                           MSC_Handle->OutPipe, 1U);
       }
       else
       {
@@ -635,6 +638,60 @@ static BOT_CSWStatusTypeDef USBH_MSC_DecodeCSW(USBH_HandleTypeDef *phost)
   return status;
 }
 
+/**
+* @brief  USBH_MSC_BOT_XferLength
+*         Return the length of the next data stage URB.
+* @param  MSC_Handle: MSC handle
+* @param  ep_size: max packet size of the data endpoint
+* @retval number of bytes to transfer
+*/
+static uint16_t USBH_MSC_BOT_XferLength(MSC_HandleTypeDef *MSC_Handle, uint16_t ep_size)
+{
+  uint32_t length = (uint32_t)ep_size * USBH_MSC_BOT_XFER_PACKETS;
+
+  /* The URB length is 16-bit wide: keep it a multiple of the packet size */
+  if (length > 0xFFFFU)
+  {
+    length = (0xFFFFU / ep_size) * ep_size;
+  }
+
+  if (length > MSC_Handle->hbot.cbw.field.DataTransferLength)
+  {
+    length = MSC_Handle->hbot.cbw.field.DataTransferLength;
+  }
+
+  if (length > MSC_Handle->hbot.seg_len)
+  {
+    length = MSC_Handle->hbot.seg_len;
+  }
+
+  return (uint16_t)length;
+}
+
+/**
+* @brief  USBH_MSC_BOT_Advance
+*         Move the data stage pointer past a completed URB and step to the
+*         next buffer of a merged command.
+* @param  MSC_Handle: MSC handle
+* @param  lun: Logical Unit Number
+* @param  length: number of bytes transferred
+* @retval None
+*/
+static void USBH_MSC_BOT_Advance(MSC_HandleTypeDef *MSC_Handle, uint8_t lun, uint16_t length)
+{
+  MSC_Handle->hbot.pbuf += length;
+  MSC_Handle->hbot.cbw.field.DataTransferLength -= length;
+  MSC_Handle->hbot.seg_len -= length;
+
+  if ((MSC_Handle->hbot.seg_len == 0U) && (MSC_Handle->hbot.seg != NULL) &&
+      (MSC_Handle->hbot.seg->next != NULL))
+  {
+    MSC_Handle->hbot.seg = MSC_Handle->hbot.seg->next;
+    MSC_Handle->hbot.pbuf = MSC_Handle->hbot.seg->pbuf;
+    MSC_Handle->hbot.seg_len = MSC_Handle->hbot.seg->length * MSC_Handle->unit[lun].capacity.block_size;
+  }
+}
+
 
 /**
 * @}
@@ -234,6 +234,13 @@ USBH_StatusTypeDef USBH_MTP_GetPartialObject(USBH_HandleTypeDef *phost,
                                            uint8_t *object,
                                            uint32_t *len);
 
+USBH_StatusTypeDef USBH_MTP_StreamObject (USBH_HandleTypeDef *phost,
+                                          uint32_t handle,
+                                          uint8_t *buff,
+                                          uint32_t size,
+                                          PTP_StreamSinkTypeDef sink,
+                                          void *pContext);
+
 USBH_StatusTypeDef USBH_MTP_GetObjectPropsSupported (USBH_HandleTypeDef *phost,
                                                      uint16_t ofc,
                                                      uint32_t *propnum,
@@ -224,6 +224,8 @@ typedef enum
   PTP_DATA_OUT_PHASE_WAIT_STATE,
   PTP_DATA_IN_PHASE_STATE,
   PTP_DATA_IN_PHASE_WAIT_STATE,
+  PTP_DATA_STREAM_STATE,
+  PTP_DATA_STREAM_WAIT_STATE,
   PTP_RESPONSE_STATE,
   PTP_RESPONSE_WAIT_STATE,
   PTP_ERROR,
@@ -317,6 +319,12 @@ typedef struct
 }
 PTP_EventContainerTypedef;
 
+/* Sink receiving the payload of a streamed data phase, chunk by chunk */
+typedef USBH_StatusTypeDef (*PTP_StreamSinkTypeDef)(USBH_HandleTypeDef *phost,
+                                                    uint8_t *pbuf,
+                                                    uint32_t length,
+                                                    void *pContext);
+
 /* Structure for PTP Transport process */
 typedef struct
 {
@@ -357,6 +365,26 @@ typedef struct
   /* object pointer */
   uint8_t	*object_ptr;
 
+  /****** Object streaming control *******/
+
+  /* User sink, NULL when the data phase is stored in memory */
+  PTP_StreamSinkTypeDef  stream_sink;
+
+  /* User context passed to the sink */
+  void      *stream_context;
+
+  /* Bounce buffer, used as two halves */
+  uint8_t   *stream_buf;
+
+  /* Length of one half, multiple of the packet size */
+  uint16_t   stream_len;
+
+  /* Half being received */
+  uint8_t    stream_half;
+
+  /* Sink refused data: drain the data phase and fail */
+  uint8_t    stream_error;
+
 }
 PTP_HandleTypeDef;
 
@@ -1009,6 +1037,13 @@ USBH_StatusTypeDef USBH_PTP_GetPartialObject(USBH_HandleTypeDef *phost,
                                            uint32_t maxbytes, uint8_t *object,
                                            uint32_t *len);
 
+USBH_StatusTypeDef USBH_PTP_StreamObject (USBH_HandleTypeDef *phost,
+                                          uint32_t handle,
+                                          uint8_t *buff,
+                                          uint32_t size,
+                                          PTP_StreamSinkTypeDef sink,
+                                          void *pContext);
+
 USBH_StatusTypeDef USBH_PTP_GetObjectPropsSupported (USBH_HandleTypeDef *phost,
                                                      uint16_t ofc,
                                                      uint32_t *propnum,
@@ -787,6 +787,50 @@ USBH_StatusTypeDef USBH_MTP_GetPartialObject(USBH_HandleTypeDef *phost,
   return status;
 }
 
+/**
+  * @brief  USBH_MTP_StreamObject
+  *         Gets an object through a sink, a chunk at a time
+  * @param  phost: Host handle
+  * @param  handle: object handle
+  * @param  buff: bounce buffer, used as two halves received in turn
+  * @param  size: bounce buffer size, at least two max packet sizes
+  * @param  sink: function receiving each chunk of object data
+  * @param  pContext: user context passed to the sink
+  * @retval USBH Status
+  */
+USBH_StatusTypeDef USBH_MTP_StreamObject (USBH_HandleTypeDef *phost,
+                                          uint32_t handle,
+                                          uint8_t *buff,
+                                          uint32_t size,
+                                          PTP_StreamSinkTypeDef sink,
+                                          void *pContext)
+{
+  USBH_StatusTypeDef status = USBH_FAIL;
+  MTP_HandleTypeDef *MTP_Handle =  (MTP_HandleTypeDef *)phost->pActiveClass->pData;
+  uint32_t timeout = phost->Timer;
+  uint32_t chunks = 0U;
+
+  if(MTP_Handle->is_ready)
+  {
+    while ((status = USBH_PTP_StreamObject (phost, handle, buff, size, sink, pContext)) == USBH_BUSY)
+    {
+      /* Objects can be large: time out on a stalled transfer only */
+      if(MTP_Handle->ptp.data_packet_counter != chunks)
+      {
+        chunks = MTP_Handle->ptp.data_packet_counter;
+        timeout = phost->Timer;
+      }
+
+      if(((phost->Timer - timeout) >  5000U) || (phost->device.is_connected == 0U))
+      {
+        MTP_Handle->ptp.stream_sink = NULL;
+        return USBH_FAIL;
+      }
+    }
+  }
+  return status;
+}
+
 /**
   * @brief  USBH_MTP_GetObjectPropsSupported
   *         Gets object partially
@@ -157,6 +157,7 @@ USBH_StatusTypeDef USBH_PTP_Init(USBH_HandleTypeDef *phost)
   /* Set state to idle to be ready for operations */
   MTP_Handle->ptp.state = PTP_IDLE;
   MTP_Handle->ptp.req_state = PTP_REQ_SEND;
+  MTP_Handle->ptp.stream_sink = NULL;
 
   return USBH_OK;
 }
@@ -175,6 +176,8 @@ USBH_StatusTypeDef USBH_PTP_Process (USBH_HandleTypeDef *phost)
   MTP_HandleTypeDef    *MTP_Handle =  (MTP_HandleTypeDef *)phost->pActiveClass->pData;
   PTP_ContainerTypedef  ptp_container;
   uint32_t  len;
+  uint32_t  plen;
+  uint8_t   *payload;
 
   switch (MTP_Handle->ptp.state)
   {
@@ -206,7 +209,14 @@ USBH_StatusTypeDef USBH_PTP_Process (USBH_HandleTypeDef *phost)
        }
        else  if(MTP_Handle->ptp.flags == PTP_DP_GETDATA)
        {
-         MTP_Handle->ptp.state = PTP_DATA_IN_PHASE_STATE;
+         if(MTP_Handle->ptp.stream_sink != NULL)
+         {
+           MTP_Handle->ptp.state = PTP_DATA_STREAM_STATE;
+         }
+         else
+         {
+           MTP_Handle->ptp.state = PTP_DATA_IN_PHASE_STATE;
+         }
        }
        else
        {
@@ -376,6 +386,82 @@ USBH_StatusTypeDef USBH_PTP_Process (USBH_HandleTypeDef *phost)
     }
     break;
 
+  case PTP_DATA_STREAM_STATE:
+    /* Receive the first chunk, starting with the container header */
+    MTP_Handle->ptp.stream_half = 0U;
+    MTP_Handle->ptp.stream_error = 0U;
+    USBH_BulkReceiveData (phost,
+                          MTP_Handle->ptp.stream_buf,
+                          MTP_Handle->ptp.stream_len,
+                          MTP_Handle->DataInPipe);
+
+    MTP_Handle->ptp.state  = PTP_DATA_STREAM_WAIT_STATE;
+    break;
+
+  case PTP_DATA_STREAM_WAIT_STATE:
+    URB_Status = USBH_LL_GetURBState(phost, MTP_Handle->DataInPipe);
+
+    if(URB_Status == USBH_URB_DONE)
+    {
+      payload = MTP_Handle->ptp.stream_buf +
+                ((uint32_t)MTP_Handle->ptp.stream_half * MTP_Handle->ptp.stream_len);
+      len = USBH_LL_GetLastXferSize (phost, MTP_Handle->DataInPipe);
+      plen = len;
+
+      if(MTP_Handle->ptp.data_packet_counter++ == 0U)
+      {
+        /* Container length, header included, comes with the first chunk */
+        MTP_Handle->ptp.data_length = LE32(payload);
+
+        if(len >= PTP_USB_BULK_HDR_LEN)
+        {
+          payload += PTP_USB_BULK_HDR_LEN;
+          plen -= PTP_USB_BULK_HDR_LEN;
+        }
+      }
+
+      MTP_Handle->ptp.data_length = (len < MTP_Handle->ptp.data_length) ?
+                                    (MTP_Handle->ptp.data_length - len) : 0U;
+
+      if((len == MTP_Handle->ptp.stream_len) && (MTP_Handle->ptp.data_length > 0U))
+      {
+        /* Keep the pipe busy: receive into the other half while the sink
+           consumes this one */
+        MTP_Handle->ptp.stream_half ^= 1U;
+        USBH_BulkReceiveData (phost,
+                              MTP_Handle->ptp.stream_buf +
+                              ((uint32_t)MTP_Handle->ptp.stream_half * MTP_Handle->ptp.stream_len),
+                              MTP_Handle->ptp.stream_len,
+                              MTP_Handle->DataInPipe);
+      }
+      else
+      {
+        MTP_Handle->ptp.state = PTP_RESPONSE_STATE;
+#if (USBH_USE_OS == 1U)
+        osMessagePut ( phost->os_event, USBH_URB_EVENT, 0U);
+#endif
+      }
+
+      if((plen > 0U) && (MTP_Handle->ptp.stream_error == 0U))
+      {
+        if(MTP_Handle->ptp.stream_sink(phost, payload, plen, MTP_Handle->ptp.stream_context) != USBH_OK)
+        {
+          MTP_Handle->ptp.stream_error = 1U;
+        }
+      }
+    }
+    else if(URB_Status == USBH_URB_STALL)
+    {
+      MTP_Handle->ptp.state  = PTP_ERROR;
+#if (USBH_USE_OS == 1U)
+      osMessagePut ( phost->os_event, USBH_URB_EVENT, 0U);
+#endif
+    }
+    else
+    {
+    }
+    break;
+
   case PTP_RESPONSE_STATE:
 
     USBH_BulkReceiveData (phost,
@@ -1580,6 +1666,97 @@ USBH_StatusTypeDef USBH_PTP_GetPartialObject(USBH_HandleTypeDef *phost,
   return status;
 }
 
+/**
+  * @brief  USBH_PTP_StreamObject
+  *         Gets an object and hands its data to a sink as it is received,
+  *         so the object is never held in memory as a whole
+  * @param  phost: Host handle
+  * @param  handle: object handle
+  * @param  buff: bounce buffer, used as two halves received in turn
+  * @param  size: bounce buffer size, at least two max packet sizes
+  * @param  sink: function receiving each chunk of object data
+  * @param  pContext: user context passed to the sink
+  * @retval USBH Status
+  */
+USBH_StatusTypeDef USBH_PTP_StreamObject (USBH_HandleTypeDef *phost,
+                                          uint32_t handle,
+                                          uint8_t *buff,
+                                          uint32_t size,
+                                          PTP_StreamSinkTypeDef sink,
+                                          void *pContext)
+{
+  USBH_StatusTypeDef   status = USBH_BUSY;
+  MTP_HandleTypeDef    *MTP_Handle =  (MTP_HandleTypeDef *)phost->pActiveClass->pData;
+  PTP_ContainerTypedef  ptp_container;
+  uint32_t half;
+
+  switch(MTP_Handle->ptp.req_state)
+  {
+  case PTP_REQ_SEND:
+
+    /* Each half is a whole number of packets and fits in one URB */
+    half = size / 2U;
+    if(half > 0xFFFFU)
+    {
+      half = 0xFFFFU;
+    }
+    half -= half % MTP_Handle->DataInEpSize;
+
+    if(half == 0U)
+    {
+      return USBH_FAIL;
+    }
+
+    /* Set operation request type */
+    MTP_Handle->ptp.flags = PTP_DP_GETDATA;
+    MTP_Handle->ptp.data_length = 0U;
+    MTP_Handle->ptp.data_packet_counter = 0U;
+    MTP_Handle->ptp.data_packet = 0U;
+
+    /* set stream control params */
+    MTP_Handle->ptp.stream_sink = sink;
+    MTP_Handle->ptp.stream_context = pContext;
+    MTP_Handle->ptp.stream_buf = buff;
+    MTP_Handle->ptp.stream_len = (uint16_t)half;
+
+    /* Fill operation request params */
+    ptp_container.Code = PTP_OC_GetObject;
+    ptp_container.SessionID = MTP_Handle->ptp.session_id;
+    ptp_container.Transaction_ID = MTP_Handle->ptp.transaction_id ++;
+    ptp_container.Param1 = handle;
+    ptp_container.Nparam = 1U;
+
+    /* convert request packet into USB raw packet*/
+    USBH_PTP_SendRequest (phost, &ptp_container);
+
+    /* Setup State machine and start transfer */
+    MTP_Handle->ptp.state = PTP_OP_REQUEST_STATE;
+    MTP_Handle->ptp.req_state = PTP_REQ_WAIT;
+    status = USBH_BUSY;
+#if (USBH_USE_OS == 1U)
+    osMessagePut ( phost->os_event, USBH_STATE_CHANGED_EVENT, 0U);
+#endif
+    break;
+
+  case PTP_REQ_WAIT:
+    status = USBH_PTP_Process(phost);
+
+    if(status != USBH_BUSY)
+    {
+      if((status == USBH_OK) && (MTP_Handle->ptp.stream_error != 0U))
+      {
+        status = USBH_FAIL;
+      }
+      MTP_Handle->ptp.stream_sink = NULL;
+    }
+    break;
+
+  default:
+    break;
+  }
+  return status;
+}
+
 /**
   * @brief  USBH_PTP_GetObjectPropsSupported
   *         Gets object partially
@@ -79,6 +79,10 @@
 #define USBH_MAX_DATA_BUFFER                  0x200U
 #define USBH_DEBUG_LEVEL                      2U
 #define USBH_USE_OS                           1U
+#define USBH_USE_PIPE_QUEUE                   0U
+#define USBH_MAX_CHANNELS_NBR                 11U
+#define USBH_SHARED_PIPES_NBR                 0U
+#define USBH_USE_HUB                          0U
 
 /** @defgroup USBH_Exported_Macros
   * @{
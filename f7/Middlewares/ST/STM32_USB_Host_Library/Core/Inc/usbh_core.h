@@ -135,6 +135,15 @@ USBH_StatusTypeDef  USBH_Stop             (USBH_HandleTypeDef *phost);
 USBH_StatusTypeDef  USBH_Process          (USBH_HandleTypeDef *phost);
 USBH_StatusTypeDef  USBH_ReEnumerate      (USBH_HandleTypeDef *phost);
 
+#if (USBH_USE_HUB == 1U)
+USBH_StatusTypeDef  USBH_AttachChild      (USBH_HandleTypeDef *phost,
+                                           USBH_HandleTypeDef *pchild,
+                                           uint8_t port,
+                                           uint8_t speed,
+                                           USBH_ClassTypeDef *pExclude);
+USBH_StatusTypeDef  USBH_DetachChild      (USBH_HandleTypeDef *pchild);
+#endif
+
 /* USBH Low Level Driver */
 USBH_StatusTypeDef   USBH_LL_Init         (USBH_HandleTypeDef *phost);
 USBH_StatusTypeDef   USBH_LL_DeInit       (USBH_HandleTypeDef *phost);
@@ -177,6 +186,11 @@ USBH_URBStateTypeDef USBH_LL_GetURBState  (USBH_HandleTypeDef *phost,
 #if (USBH_USE_OS == 1U)
 USBH_StatusTypeDef  USBH_LL_NotifyURBChange (USBH_HandleTypeDef *phost);
 #endif
+#if (USBH_USE_PIPE_QUEUE == 1U)
+USBH_StatusTypeDef  USBH_LL_NotifyURBState (USBH_HandleTypeDef *phost,
+                                            uint8_t pipe,
+                                            USBH_URBStateTypeDef urb_state);
+#endif
 
 USBH_StatusTypeDef USBH_LL_SetToggle (USBH_HandleTypeDef *phost,
                                       uint8_t pipe, uint8_t toggle);
@@ -197,6 +197,53 @@
  #define USBH_MAX_PIPES_NBR                                15U
 #endif /* USBH_MAX_PIPES_NBR */
 
+/* Set to 1U in usbh_conf.h to enable the per-pipe request queues completed
+   from the HCD URB change interrupt (see USBH_SubmitRequest) */
+#ifndef USBH_USE_PIPE_QUEUE
+ #define USBH_USE_PIPE_QUEUE                               0U
+#endif /* USBH_USE_PIPE_QUEUE */
+
+/* Host channels handed out by USBH_AllocPipe: set to the Host_channels of
+   the HCD in usbh_conf.h to use them all */
+#ifndef USBH_MAX_CHANNELS_NBR
+ #define USBH_MAX_CHANNELS_NBR                             11U
+#endif /* USBH_MAX_CHANNELS_NBR */
+
+/* Set in usbh_conf.h to the number of shared pipes: queued pipes that only
+   hold a host channel while they have a transfer in progress
+   (see USBH_AllocSharedPipe). Requires USBH_USE_PIPE_QUEUE. */
+#ifndef USBH_SHARED_PIPES_NBR
+ #define USBH_SHARED_PIPES_NBR                             0U
+#endif /* USBH_SHARED_PIPES_NBR */
+
+#define USBH_PIPES_NBR                  (USBH_MAX_PIPES_NBR + USBH_SHARED_PIPES_NBR)
+
+/* Set to 1U in usbh_conf.h to run the devices behind a hub in their own
+   host handles, sharing the host channels of the root port handle
+   (see the HUB class) */
+#ifndef USBH_USE_HUB
+ #define USBH_USE_HUB                                      0U
+#endif /* USBH_USE_HUB */
+
+#if (USBH_MAX_CHANNELS_NBR > USBH_MAX_PIPES_NBR)
+ #error "USBH_MAX_CHANNELS_NBR exceeds USBH_MAX_PIPES_NBR"
+#endif
+#if (USBH_SHARED_PIPES_NBR > 0U) && (USBH_USE_PIPE_QUEUE == 0U)
+ #error "USBH_SHARED_PIPES_NBR requires USBH_USE_PIPE_QUEUE"
+#endif
+#if (USBH_USE_PIPE_QUEUE == 1U) && (USBH_PIPES_NBR > 32U)
+ #error "The pipe queues support 32 pipes at most"
+#endif
+
+#if (USBH_USE_PIPE_QUEUE == 1U)
+/* The queues are updated from the HCD interrupt: mask it around list updates.
+   Override in usbh_conf.h to use a narrower lock. */
+#ifndef USBH_QUEUE_LOCK
+#define USBH_QUEUE_LOCK(__MASK__)    do { (__MASK__) = __get_PRIMASK(); __disable_irq(); } while (0)
+#define USBH_QUEUE_UNLOCK(__MASK__)  __set_PRIMASK(__MASK__)
+#endif /* USBH_QUEUE_LOCK */
+#endif
+
 #define USBH_DEVICE_ADDRESS_DEFAULT                        0x00U
 #define USBH_DEVICE_ADDRESS                                0x01U
 
@@ -409,6 +456,44 @@ typedef enum {
   USBH_URB_STALL
 }USBH_URBStateTypeDef;
 
+struct _USBH_HandleTypeDef;
+
+/* Pipe request structure, owned by the caller until completion */
+typedef struct _USBH_PipeReqTypeDef
+{
+  uint8_t                       *buff;        /* data buffer                      */
+  uint16_t                       length;      /* data length                      */
+  uint32_t                       xfer_count;  /* bytes transferred, on completion */
+  USBH_URBStateTypeDef           urb_state;   /* final URB state, on completion   */
+  void                         (*Callback)(struct _USBH_HandleTypeDef *phost,
+                                           struct _USBH_PipeReqTypeDef *req);
+  void                          *pContext;    /* caller context                   */
+  struct _USBH_PipeReqTypeDef   *next;
+}
+USBH_PipeReqTypeDef;
+
+/* Pipe request queue */
+typedef struct
+{
+  USBH_PipeReqTypeDef  *head;
+  USBH_PipeReqTypeDef  *tail;
+  uint8_t               ep_type;
+  uint8_t               direction;
+  uint8_t               do_ping;
+  uint16_t              interval;     /* SOF between periodic starts, 0: none */
+  uint32_t              due;          /* Timer value of the next start        */
+#if (USBH_SHARED_PIPES_NBR > 0U)
+  /* Shared pipes: channel bound on demand and its endpoint parameters */
+  uint8_t               channel;      /* 0xFF while unbound                   */
+  uint8_t               ep_addr;
+  uint8_t               dev_address;
+  uint8_t               speed;
+  uint16_t              mps;
+  uint8_t               toggle;       /* data toggle kept while unbound       */
+#endif
+}
+USBH_PipeQueueTypeDef;
+
 typedef enum
 {
   USBH_PORT_EVENT = 1U,
@@ -451,8 +536,6 @@ typedef struct
 
 }USBH_DeviceTypeDef;
 
-struct _USBH_HandleTypeDef;
-
 /* USB Host Class structure */
 typedef struct
 {
@@ -477,12 +560,27 @@ typedef struct _USBH_HandleTypeDef
   USBH_ClassTypeDef*    pClass[USBH_MAX_NUM_SUPPORTED_CLASS];
   USBH_ClassTypeDef*    pActiveClass;
   uint32_t              ClassNumber;
-  uint32_t              Pipes[15];
+  uint32_t              Pipes[USBH_PIPES_NBR];
   __IO uint32_t         Timer;
   uint8_t               id;
   void*                 pData;
   void                 (* pUser )(struct _USBH_HandleTypeDef *pHandle, uint8_t id);
 
+#if (USBH_USE_HUB == 1U)
+  struct _USBH_HandleTypeDef *pRoot;     /* root port handle, NULL on the root port */
+  uint8_t               hub_port;        /* hub port of the device, 0 on the root port */
+  struct _USBH_HandleTypeDef *ChannelHost[USBH_MAX_PIPES_NBR]; /* handle owning each channel, root port only */
+#endif
+
+#if (USBH_USE_PIPE_QUEUE == 1U)
+  USBH_PipeQueueTypeDef PipeQueue[USBH_PIPES_NBR];
+  uint32_t              PipeDeferred;   /* pipes started from the next SOF   */
+  uint8_t               PipeNext;       /* first pipe served on the next SOF */
+#if (USBH_SHARED_PIPES_NBR > 0U)
+  uint8_t               ChannelPipe[USBH_MAX_PIPES_NBR]; /* shared pipe bound to each channel, 0xFF if none */
+#endif
+#endif
+
 #if (USBH_USE_OS == 1U)
   osMessageQId          os_event;
   osThreadId            thread;
@@ -490,6 +588,13 @@ typedef struct _USBH_HandleTypeDef
 
 } USBH_HandleTypeDef;
 
+/* Handle holding the host channels */
+#if (USBH_USE_HUB == 1U)
+#define USBH_ROOT_HOST(__HOST__)  (((__HOST__)->pRoot != NULL) ? (__HOST__)->pRoot : (__HOST__))
+#else
+#define USBH_ROOT_HOST(__HOST__)  (__HOST__)
+#endif
+
 
 #if  defined ( __GNUC__ )
   #ifndef __weak
@@ -159,6 +159,17 @@ USBH_StatusTypeDef USBH_IsocSendData(USBH_HandleTypeDef *phost,
                                 uint8_t *buff,
                                 uint32_t length,
                                 uint8_t pipe_num);
+
+#if (USBH_USE_PIPE_QUEUE == 1U)
+USBH_StatusTypeDef USBH_SubmitRequest(USBH_HandleTypeDef *phost,
+                                uint8_t pipe_num,
+                                USBH_PipeReqTypeDef *req);
+
+USBH_StatusTypeDef USBH_CancelRequests(USBH_HandleTypeDef *phost,
+                                uint8_t pipe_num);
+
+void USBH_ServiceRequests(USBH_HandleTypeDef *phost);
+#endif
 /**
   * @}
   */
@@ -117,6 +117,23 @@ uint8_t USBH_AllocPipe  (USBH_HandleTypeDef *phost,
 USBH_StatusTypeDef USBH_FreePipe  (USBH_HandleTypeDef *phost,
                                    uint8_t idx);
 
+#if (USBH_USE_PIPE_QUEUE == 1U)
+USBH_StatusTypeDef USBH_SetPipeInterval  (USBH_HandleTypeDef *phost,
+                                          uint8_t pipe_num,
+                                          uint16_t interval);
+#endif
+
+#if (USBH_SHARED_PIPES_NBR > 0U)
+uint8_t USBH_AllocSharedPipe  (USBH_HandleTypeDef *phost,
+                               uint8_t ep_addr);
+
+USBH_StatusTypeDef USBH_BindChannel  (USBH_HandleTypeDef *phost,
+                                      uint8_t pipe_num);
+
+void USBH_ReleaseChannel  (USBH_HandleTypeDef *phost,
+                           uint8_t pipe_num);
+#endif
+
 
 
 
@@ -76,6 +76,12 @@
 /** @defgroup USBH_CORE_Private_Macros
   * @{
   */
+/* Devices behind a hub get the address following the one of the hub */
+#if (USBH_USE_HUB == 1U)
+#define USBH_HUB_PORT(__HOST__)   ((__HOST__)->hub_port)
+#else
+#define USBH_HUB_PORT(__HOST__)   0U
+#endif
 /**
   * @}
   */
@@ -183,10 +189,35 @@ static USBH_StatusTypeDef  DeInitStateMachine(USBH_HandleTypeDef *phost)
   uint32_t i = 0U;
 
   /* Clear Pipes flags*/
-  for ( ; i < USBH_MAX_PIPES_NBR; i++)
+  for ( ; i < USBH_PIPES_NBR; i++)
   {
     phost->Pipes[i] = 0U;
+#if (USBH_USE_PIPE_QUEUE == 1U)
+    phost->PipeQueue[i].head = NULL;
+    phost->PipeQueue[i].tail = NULL;
+    phost->PipeQueue[i].ep_type = USBH_EP_CONTROL;
+    phost->PipeQueue[i].interval = 0U;
+#endif
+#if (USBH_SHARED_PIPES_NBR > 0U)
+    phost->PipeQueue[i].channel = 0xFFU;
+    if (i < USBH_MAX_PIPES_NBR)
+    {
+      phost->ChannelPipe[i] = 0xFFU;
+    }
+#endif
+  }
+
+#if (USBH_USE_PIPE_QUEUE == 1U)
+  phost->PipeDeferred = 0U;
+  phost->PipeNext = 0U;
+#endif
+
+#if (USBH_USE_HUB == 1U)
+  for (i = 0U; i < USBH_MAX_PIPES_NBR; i++)
+  {
+    phost->ChannelHost[i] = NULL;
   }
+#endif
 
   for(i = 0U; i< USBH_MAX_DATA_BUFFER; i++)
   {
@@ -407,6 +438,106 @@ USBH_StatusTypeDef  USBH_ReEnumerate   (USBH_HandleTypeDef *phost)
   return USBH_OK;
 }
 
+#if (USBH_USE_HUB == 1U)
+/**
+  * @brief  USBH_AttachChild
+  *         Start the enumeration of a device connected to a hub port, in its
+  *         own host handle. The handle shares the HCD, the host channels,
+  *         the registered classes and the user callback of the root port
+  *         handle; it has no thread and is processed by the hub class.
+  * @param  phost: root port Host Handle
+  * @param  pchild: device Host Handle
+  * @param  port: hub port number, from 1
+  * @param  speed: device speed, USBH_SPEED_xxx
+  * @param  pExclude: class not offered to the device (the hub class itself)
+  * @retval USBH Status
+  */
+USBH_StatusTypeDef  USBH_AttachChild(USBH_HandleTypeDef *phost,
+                                     USBH_HandleTypeDef *pchild,
+                                     uint8_t port,
+                                     uint8_t speed,
+                                     USBH_ClassTypeDef *pExclude)
+{
+  uint32_t idx;
+
+  if ((phost == NULL) || (pchild == NULL) || (phost->pRoot != NULL))
+  {
+    return USBH_FAIL;
+  }
+
+  pchild->id = phost->id;
+  pchild->pData = phost->pData;
+  pchild->pUser = phost->pUser;
+  pchild->pRoot = phost;
+  pchild->hub_port = port;
+  pchild->pActiveClass = NULL;
+  pchild->ClassNumber = 0U;
+
+  for (idx = 0U; idx < phost->ClassNumber; idx++)
+  {
+    if (phost->pClass[idx] != pExclude)
+    {
+      pchild->pClass[pchild->ClassNumber++] = phost->pClass[idx];
+    }
+  }
+
+#if (USBH_USE_OS == 1U)
+  /* Wake up the root port thread, which processes the device */
+  pchild->os_event = phost->os_event;
+  pchild->thread = phost->thread;
+#endif
+
+  DeInitStateMachine(pchild);
+
+  pchild->device.speed = speed;
+  pchild->device.PortEnabled = 1U;
+  pchild->device.is_connected = 1U;
+
+  return USBH_OK;
+}
+
+/**
+  * @brief  USBH_DetachChild
+  *         Stop a device behind a hub: its class is de-initialized and the
+  *         host channels it still holds are halted and given back.
+  * @param  pchild: device Host Handle
+  * @retval USBH Status
+  */
+USBH_StatusTypeDef  USBH_DetachChild(USBH_HandleTypeDef *pchild)
+{
+  USBH_HandleTypeDef *root = pchild->pRoot;
+  uint8_t ch;
+
+  if (root == NULL)
+  {
+    return USBH_FAIL;
+  }
+
+  pchild->device.is_connected = 0U;
+  pchild->device.PortEnabled = 0U;
+
+  /* Run the disconnection: class de-initialization */
+  (void)USBH_Process(pchild);
+
+  for (ch = 0U; ch < USBH_MAX_PIPES_NBR; ch++)
+  {
+    if (root->ChannelHost[ch] == pchild)
+    {
+      (void)USBH_LL_ClosePipe(root, ch);
+      root->Pipes[ch] = 0U;
+      root->ChannelHost[ch] = NULL;
+#if (USBH_SHARED_PIPES_NBR > 0U)
+      root->ChannelPipe[ch] = 0xFFU;
+#endif
+    }
+  }
+
+  pchild->pRoot = NULL;
+
+  return USBH_OK;
+}
+#endif
+
 /**
   * @brief  USBH_Process
   *         Background process of the USB Core.
@@ -431,6 +562,15 @@ USBH_StatusTypeDef  USBH_Process(USBH_HandleTypeDef *phost)
   {
   case HOST_IDLE :
 
+#if (USBH_USE_HUB == 1U)
+    /* Device behind a hub: the port is already reset by the hub class */
+    if ((phost->pRoot != NULL) && (phost->device.is_connected))
+    {
+      phost->gState = HOST_DEV_WAIT_FOR_ATTACHMENT;
+      break;
+    }
+#endif
+
     if (phost->device.is_connected)
     {
       /* Wait for 200 ms after connection */
@@ -455,10 +595,16 @@ USBH_StatusTypeDef  USBH_Process(USBH_HandleTypeDef *phost)
 
     USBH_UsrLog("USB Device Attached");
 
-    /* Wait for 100 ms after Reset */
-    USBH_Delay(100U);
+#if (USBH_USE_HUB == 1U)
+    /* Device behind a hub: speed and reset recovery handled by the hub class */
+    if (phost->pRoot == NULL)
+#endif
+    {
+      /* Wait for 100 ms after Reset */
+      USBH_Delay(100U);
 
-    phost->device.speed = USBH_LL_GetSpeed(phost);
+      phost->device.speed = USBH_LL_GetSpeed(phost);
+    }
 
     phost->gState = HOST_ENUMERATION;
 
@@ -569,8 +715,15 @@ USBH_StatusTypeDef  USBH_Process(USBH_HandleTypeDef *phost)
     {
       phost->pActiveClass = NULL;
 
-      for (idx = 0U; idx < USBH_MAX_NUM_SUPPORTED_CLASS; idx++)
+      for (idx = 0U; idx < phost->ClassNumber; idx++)
       {
+#if (USBH_USE_HUB == 1U)
+        /* The class data lives in the class: a class runs one device at a time */
+        if ((phost->pRoot != NULL) && (phost->pClass[idx]->pData != NULL))
+        {
+          continue;
+        }
+#endif
         if(phost->pClass[idx]->ClassCode == phost->device.CfgDesc.Itf_Desc[0].bInterfaceClass)
         {
           phost->pActiveClass = phost->pClass[idx];
@@ -710,10 +863,10 @@ static USBH_StatusTypeDef USBH_HandleEnum (USBH_HandleTypeDef *phost)
 
   case ENUM_SET_ADDR:
     /* set address */
-    if ( USBH_SetAddress(phost, USBH_DEVICE_ADDRESS) == USBH_OK)
+    if ( USBH_SetAddress(phost, USBH_DEVICE_ADDRESS + USBH_HUB_PORT(phost)) == USBH_OK)
     {
       USBH_Delay(2U);
-      phost->device.address = USBH_DEVICE_ADDRESS;
+      phost->device.address = USBH_DEVICE_ADDRESS + USBH_HUB_PORT(phost);
 
       /* user callback for device address assigned */
       USBH_UsrLog("Address (#%d) assigned.", phost->device.address);
@@ -856,6 +1009,10 @@ void  USBH_LL_SetTimer  (USBH_HandleTypeDef *phost, uint32_t time)
 void  USBH_LL_IncTimer  (USBH_HandleTypeDef *phost)
 {
   phost->Timer ++;
+#if (USBH_USE_PIPE_QUEUE == 1U)
+  /* Retry the NAKed requests, start the periodic ones that are due */
+  USBH_ServiceRequests(phost);
+#endif
   USBH_HandleSof(phost);
 }
 
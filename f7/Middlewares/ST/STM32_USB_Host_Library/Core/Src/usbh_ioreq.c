@@ -95,6 +95,10 @@
 /** @defgroup USBH_IOREQ_Private_FunctionPrototypes
   * @{
   */
+#if (USBH_USE_PIPE_QUEUE == 1U)
+static void USBH_StartRequest(USBH_HandleTypeDef *phost, uint8_t pipe_num);
+static void USBH_DeferRequest(USBH_HandleTypeDef *phost, uint8_t pipe_num);
+#endif
 
 /**
   * @}
@@ -354,6 +358,342 @@ USBH_StatusTypeDef USBH_IsocSendData(USBH_HandleTypeDef *phost,
 
   return USBH_OK;
 }
+
+#if (USBH_USE_PIPE_QUEUE == 1U)
+/**
+  * @brief  USBH_SubmitRequest
+  *         Queue a data request on a bulk, interrupt or isochronous pipe.
+  *         The request is started as soon as the previous ones on the pipe
+  *         are completed, or at the pipe interval (see USBH_SetPipeInterval);
+  *         NAKed transfers are retried on the next SOF, and req->Callback is
+  *         called from the HCD interrupt once the request is done, stalled
+  *         or failed or when it is cancelled.
+  *         The request may be submitted again from its callback.
+  * @param  phost: Host Handle
+  * @param  pipe_num: Pipe Number, opened with USBH_OpenPipe
+  * @param  req: request; buff, length, Callback and pContext are set by the
+  *         caller, the structure must stay valid until it is completed
+  * @retval USBH Status
+  */
+USBH_StatusTypeDef USBH_SubmitRequest(USBH_HandleTypeDef *phost,
+                                uint8_t pipe_num,
+                                USBH_PipeReqTypeDef *req)
+{
+  USBH_PipeQueueTypeDef *queue;
+  uint32_t mask;
+
+  if ((pipe_num >= USBH_PIPES_NBR) || (req == NULL))
+  {
+    return USBH_FAIL;
+  }
+
+  queue = &phost->PipeQueue[pipe_num];
+
+  /* Control transfers are handled by the control state machine */
+  if (queue->ep_type == USBH_EP_CONTROL)
+  {
+    return USBH_NOT_SUPPORTED;
+  }
+
+  req->next = NULL;
+  req->xfer_count = 0U;
+  req->urb_state = USBH_URB_IDLE;
+
+  USBH_QUEUE_LOCK(mask);
+
+  if (queue->head == NULL)
+  {
+    queue->head = req;
+    queue->tail = req;
+    USBH_StartRequest(phost, pipe_num);
+  }
+  else
+  {
+    queue->tail->next = req;
+    queue->tail = req;
+  }
+
+  USBH_QUEUE_UNLOCK(mask);
+
+  return USBH_OK;
+}
+
+/**
+  * @brief  USBH_CancelRequests
+  *         Remove all the requests queued on a pipe and complete them with
+  *         the USBH_URB_ERROR state. The transfer in progress, if any, is
+  *         not halted: close or halt the pipe first.
+  * @param  phost: Host Handle
+  * @param  pipe_num: Pipe Number
+  * @retval USBH Status
+  */
+USBH_StatusTypeDef USBH_CancelRequests(USBH_HandleTypeDef *phost,
+                                uint8_t pipe_num)
+{
+  USBH_PipeReqTypeDef *req;
+  USBH_PipeReqTypeDef *next;
+  uint32_t mask;
+
+  if (pipe_num >= USBH_PIPES_NBR)
+  {
+    return USBH_FAIL;
+  }
+
+  USBH_QUEUE_LOCK(mask);
+  req = phost->PipeQueue[pipe_num].head;
+  phost->PipeQueue[pipe_num].head = NULL;
+  phost->PipeQueue[pipe_num].tail = NULL;
+  phost->PipeDeferred &= ~(1UL << pipe_num);
+  USBH_QUEUE_UNLOCK(mask);
+
+  while (req != NULL)
+  {
+    next = req->next;
+    req->xfer_count = 0U;
+    req->urb_state = USBH_URB_ERROR;
+
+    if (req->Callback != NULL)
+    {
+      req->Callback(phost, req);
+    }
+    req = next;
+  }
+
+  return USBH_OK;
+}
+
+/**
+  * @brief  USBH_LL_NotifyURBState
+  *         Advance the request queue of a pipe. To be called from
+  *         HAL_HCD_HC_NotifyURBChange_Callback() with the channel number
+  *         and the new URB state.
+  * @param  phost: Host Handle
+  * @param  pipe: Channel Number
+  * @param  urb_state: new URB state of the pipe
+  * @retval USBH Status
+  */
+USBH_StatusTypeDef  USBH_LL_NotifyURBState (USBH_HandleTypeDef *phost,
+                                            uint8_t pipe,
+                                            USBH_URBStateTypeDef urb_state)
+{
+  USBH_PipeQueueTypeDef *queue;
+  USBH_PipeReqTypeDef *req;
+  USBH_PipeReqTypeDef *next;
+  uint8_t channel = pipe;
+
+  if (pipe >= USBH_MAX_PIPES_NBR)
+  {
+    return USBH_FAIL;
+  }
+
+#if (USBH_USE_HUB == 1U)
+  /* Channel serving a device behind a hub */
+  if ((phost->ChannelHost[channel] != NULL) && (phost->ChannelHost[channel] != phost))
+  {
+    phost = phost->ChannelHost[channel];
+  }
+#endif
+
+#if (USBH_SHARED_PIPES_NBR > 0U)
+  /* Channel serving a shared pipe */
+  if (USBH_ROOT_HOST(phost)->ChannelPipe[channel] != 0xFFU)
+  {
+    pipe = USBH_ROOT_HOST(phost)->ChannelPipe[channel];
+  }
+#endif
+
+  queue = &phost->PipeQueue[pipe];
+  req = queue->head;
+
+  /* Pipe not driven by the queue */
+  if (req == NULL)
+  {
+    return USBH_OK;
+  }
+
+  switch (urb_state)
+  {
+  case USBH_URB_IDLE:
+    /* Interrupt IN NAKed: the channel is halted, poll again on the next
+       SOF or at the pipe interval */
+    if ((queue->direction != 0U) && (queue->ep_type == USBH_EP_INTERRUPT))
+    {
+#if (USBH_SHARED_PIPES_NBR > 0U)
+      USBH_ReleaseChannel(phost, pipe);
+#endif
+      USBH_DeferRequest(phost, pipe);
+    }
+    break;
+
+  case USBH_URB_NOTREADY:
+  case USBH_URB_NYET:
+    /* OUT NAKed: send the same request again on the next SOF. IN channels
+       are re-enabled by the driver. */
+    if (queue->direction == 0U)
+    {
+      USBH_DeferRequest(phost, pipe);
+    }
+    break;
+
+  case USBH_URB_DONE:
+    if (queue->direction != 0U)
+    {
+      req->xfer_count = USBH_LL_GetLastXferSize(phost, channel);
+    }
+    else
+    {
+      req->xfer_count = req->length;
+    }
+    req->urb_state = USBH_URB_DONE;
+
+    /* Keep the pipe busy with the next request before reporting */
+    queue->head = req->next;
+    if (queue->head == NULL)
+    {
+      queue->tail = NULL;
+#if (USBH_SHARED_PIPES_NBR > 0U)
+      USBH_ReleaseChannel(phost, pipe);
+#endif
+    }
+    else
+    {
+      USBH_StartRequest(phost, pipe);
+    }
+
+    if (req->Callback != NULL)
+    {
+      req->Callback(phost, req);
+    }
+    break;
+
+  case USBH_URB_ERROR:
+  case USBH_URB_STALL:
+  default:
+    /* The following requests cannot proceed: complete them all with the
+       same state, the class recovers the endpoint before submitting again */
+    queue->head = NULL;
+    queue->tail = NULL;
+#if (USBH_SHARED_PIPES_NBR > 0U)
+    USBH_ReleaseChannel(phost, pipe);
+#endif
+
+    while (req != NULL)
+    {
+      next = req->next;
+      req->xfer_count = 0U;
+      req->urb_state = urb_state;
+
+      if (req->Callback != NULL)
+      {
+        req->Callback(phost, req);
+      }
+      req = next;
+    }
+    break;
+  }
+
+  return USBH_OK;
+}
+
+/**
+  * @brief  USBH_ServiceRequests
+  *         Start the requests deferred to this SOF: NAKed transfers, pipes
+  *         waiting for their interval or for a free channel. Called on
+  *         every SOF from USBH_LL_IncTimer(); the first pipe served rotates
+  *         so that shared pipes get the free channels in turn.
+  * @param  phost: Host Handle
+  * @retval None
+  */
+void USBH_ServiceRequests(USBH_HandleTypeDef *phost)
+{
+  uint32_t deferred = phost->PipeDeferred;
+  uint32_t idx;
+  uint8_t pipe;
+
+  if (deferred == 0U)
+  {
+    return;
+  }
+
+  phost->PipeDeferred = 0U;
+  pipe = phost->PipeNext;
+
+  for (idx = 0U; idx < USBH_PIPES_NBR; idx++)
+  {
+    if (((deferred & (1UL << pipe)) != 0U) && (phost->PipeQueue[pipe].head != NULL))
+    {
+      USBH_StartRequest(phost, pipe);
+    }
+
+    pipe++;
+    if (pipe == USBH_PIPES_NBR)
+    {
+      pipe = 0U;
+    }
+  }
+
+  phost->PipeNext = (phost->PipeNext + 1U < USBH_PIPES_NBR) ? (phost->PipeNext + 1U) : 0U;
+}
+
+/**
+  * @brief  USBH_StartRequest
+  *         Submit the request at the head of a pipe queue to the driver.
+  *         Periodic pipes are held until their interval has elapsed and
+  *         shared pipes until a channel is free.
+  * @param  phost: Host Handle
+  * @param  pipe_num: Pipe Number
+  * @retval None
+  */
+static void USBH_StartRequest(USBH_HandleTypeDef *phost, uint8_t pipe_num)
+{
+  USBH_PipeQueueTypeDef *queue = &phost->PipeQueue[pipe_num];
+  uint8_t channel = pipe_num;
+
+  if ((queue->interval != 0U) && ((int32_t)(phost->Timer - queue->due) < 0))
+  {
+    USBH_DeferRequest(phost, pipe_num);
+    return;
+  }
+
+#if (USBH_SHARED_PIPES_NBR > 0U)
+  if (pipe_num >= USBH_MAX_PIPES_NBR)
+  {
+    if (USBH_BindChannel(phost, pipe_num) != USBH_OK)
+    {
+      USBH_DeferRequest(phost, pipe_num);
+      return;
+    }
+    channel = queue->channel;
+  }
+#endif
+
+  if (queue->interval != 0U)
+  {
+    queue->due = phost->Timer + queue->interval;
+  }
+
+  USBH_LL_SubmitURB (phost,                     /* Driver handle    */
+                          channel,              /* Pipe index       */
+                          queue->direction,     /* Direction        */
+                          queue->ep_type,       /* EP type          */
+                          USBH_PID_DATA,        /* Type Data        */
+                          queue->head->buff,    /* data buffer      */
+                          queue->head->length,  /* data length      */
+                          queue->do_ping);
+}
+
+/**
+  * @brief  USBH_DeferRequest
+  *         Start the request at the head of a pipe queue from the next SOF
+  * @param  phost: Host Handle
+  * @param  pipe_num: Pipe Number
+  * @retval None
+  */
+static void USBH_DeferRequest(USBH_HandleTypeDef *phost, uint8_t pipe_num)
+{
+  phost->PipeDeferred |= (1UL << pipe_num);
+}
+#endif
 /**
 * @}
 */
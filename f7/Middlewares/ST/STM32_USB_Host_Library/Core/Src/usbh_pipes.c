@@ -116,14 +116,53 @@ USBH_StatusTypeDef USBH_OpenPipe  (USBH_HandleTypeDef *phost,
                             uint8_t ep_type,
                             uint16_t mps)
 {
+#if (USBH_USE_PIPE_QUEUE == 1U)
+  USBH_PipeQueueTypeDef *queue;
+#endif
 
-  USBH_LL_OpenPipe(phost,
-                        pipe_num,
-                        epnum,
-                        dev_address,
-                        speed,
-                        ep_type,
-                        mps);
+#if (USBH_SHARED_PIPES_NBR > 0U)
+  if (pipe_num >= USBH_MAX_PIPES_NBR)
+  {
+    if (pipe_num >= USBH_PIPES_NBR)
+    {
+      return USBH_FAIL;
+    }
+
+    /* The channel is opened when a request is started */
+    queue = &phost->PipeQueue[pipe_num];
+    USBH_ReleaseChannel(phost, pipe_num);
+    queue->ep_addr = epnum;
+    queue->dev_address = dev_address;
+    queue->speed = speed;
+    queue->mps = mps;
+    queue->toggle = 0U;
+  }
+  else
+#endif
+  {
+    USBH_LL_OpenPipe(phost,
+                          pipe_num,
+                          epnum,
+                          dev_address,
+                          speed,
+                          ep_type,
+                          mps);
+  }
+
+#if (USBH_USE_PIPE_QUEUE == 1U)
+  if (pipe_num < USBH_PIPES_NBR)
+  {
+    /* Keep the transfer parameters used to start queued requests */
+    queue = &phost->PipeQueue[pipe_num];
+    queue->ep_type = ep_type;
+    queue->direction = ((epnum & USB_EP_DIR_MSK) != 0U) ? 1U : 0U;
+    queue->do_ping = ((ep_type == USBH_EP_BULK) &&
+                      ((epnum & USB_EP_DIR_MSK) == 0U) &&
+                      (speed == USBH_SPEED_HIGH)) ? 1U : 0U;
+    queue->interval = 0U;
+    queue->due = phost->Timer;
+  }
+#endif
 
   return USBH_OK;
 
@@ -140,12 +179,59 @@ USBH_StatusTypeDef USBH_ClosePipe  (USBH_HandleTypeDef *phost,
                             uint8_t pipe_num)
 {
 
-  USBH_LL_ClosePipe(phost, pipe_num);
+#if (USBH_SHARED_PIPES_NBR > 0U)
+  if (pipe_num >= USBH_MAX_PIPES_NBR)
+  {
+    /* Halt the channel serving the pipe, if any, and give it back */
+    if ((pipe_num < USBH_PIPES_NBR) && (phost->PipeQueue[pipe_num].channel != 0xFFU))
+    {
+      USBH_LL_ClosePipe(phost, phost->PipeQueue[pipe_num].channel);
+      USBH_ReleaseChannel(phost, pipe_num);
+    }
+  }
+  else
+#endif
+  {
+    USBH_LL_ClosePipe(phost, pipe_num);
+  }
+
+#if (USBH_USE_PIPE_QUEUE == 1U)
+  /* Complete the requests left on the pipe */
+  USBH_CancelRequests(phost, pipe_num);
+#endif
 
   return USBH_OK;
 
 }
 
+#if (USBH_USE_PIPE_QUEUE == 1U)
+/**
+  * @brief  USBH_SetPipeInterval
+  *         Start the queued requests of a periodic pipe at most once every
+  *         interval SOF (frames at full speed, microframes at high speed),
+  *         NAKed polls included. Call after USBH_OpenPipe.
+  * @param  phost: Host Handle
+  * @param  pipe_num: Pipe Number
+  * @param  interval: number of SOF between two starts, 0 to start the
+  *         requests as soon as possible
+  * @retval USBH Status
+  */
+USBH_StatusTypeDef USBH_SetPipeInterval  (USBH_HandleTypeDef *phost,
+                                          uint8_t pipe_num,
+                                          uint16_t interval)
+{
+  if (pipe_num >= USBH_PIPES_NBR)
+  {
+    return USBH_FAIL;
+  }
+
+  phost->PipeQueue[pipe_num].interval = interval;
+  phost->PipeQueue[pipe_num].due = phost->Timer;
+
+  return USBH_OK;
+}
+#endif
+
 /**
   * @brief  USBH_Alloc_Pipe
   *         Allocate a new Pipe
@@ -155,14 +241,29 @@ USBH_StatusTypeDef USBH_ClosePipe  (USBH_HandleTypeDef *phost,
   */
 uint8_t USBH_AllocPipe  (USBH_HandleTypeDef *phost, uint8_t ep_addr)
 {
+  USBH_HandleTypeDef *root = USBH_ROOT_HOST(phost);
   uint16_t pipe;
+#if (USBH_SHARED_PIPES_NBR > 0U)
+  uint32_t mask;
+
+  /* Shared pipes bind channels from the HCD interrupt */
+  USBH_QUEUE_LOCK(mask);
+#endif
 
-  pipe =  USBH_GetFreePipe(phost);
+  /* The channels of the devices behind a hub are taken from the root port */
+  pipe =  USBH_GetFreePipe(root);
 
   if (pipe != 0xFFFFU)
   {
-	phost->Pipes[pipe] = 0x8000U | ep_addr;
+	root->Pipes[pipe] = 0x8000U | ep_addr;
+#if (USBH_USE_HUB == 1U)
+    root->ChannelHost[pipe] = phost;
+#endif
   }
+
+#if (USBH_SHARED_PIPES_NBR > 0U)
+  USBH_QUEUE_UNLOCK(mask);
+#endif
   return (uint8_t)pipe;
 }
 
@@ -175,9 +276,20 @@ uint8_t USBH_AllocPipe  (USBH_HandleTypeDef *phost, uint8_t ep_addr)
   */
 USBH_StatusTypeDef USBH_FreePipe  (USBH_HandleTypeDef *phost, uint8_t idx)
 {
-   if(idx < 11U)
+   if (idx >= USBH_MAX_PIPES_NBR)
    {
-	 phost->Pipes[idx] &= 0x7FFFU;
+     /* Shared pipes belong to the handle */
+     if (idx < USBH_PIPES_NBR)
+     {
+       phost->Pipes[idx] &= 0x7FFFU;
+     }
+   }
+   else
+   {
+     USBH_ROOT_HOST(phost)->Pipes[idx] &= 0x7FFFU;
+#if (USBH_USE_HUB == 1U)
+     USBH_ROOT_HOST(phost)->ChannelHost[idx] = NULL;
+#endif
    }
    return USBH_OK;
 }
@@ -192,7 +304,7 @@ static uint16_t USBH_GetFreePipe (USBH_HandleTypeDef *phost)
 {
   uint8_t idx = 0U;
 
-  for (idx = 0U ; idx < 11U ; idx++)
+  for (idx = 0U ; idx < USBH_MAX_CHANNELS_NBR ; idx++)
   {
 	if ((phost->Pipes[idx] & 0x8000U) == 0U)
 	{
@@ -201,6 +313,111 @@ static uint16_t USBH_GetFreePipe (USBH_HandleTypeDef *phost)
   }
   return 0xFFFFU;
 }
+
+#if (USBH_SHARED_PIPES_NBR > 0U)
+/**
+  * @brief  USBH_AllocSharedPipe
+  *         Allocate a shared pipe for a bulk or interrupt endpoint. The pipe
+  *         is opened with USBH_OpenPipe and driven with USBH_SubmitRequest
+  *         only: a host channel is bound to it when a request is started
+  *         and given back once its queue is empty, a NAKed interrupt IN
+  *         poll waits for its next interval or an error ends the transfer,
+  *         so that more endpoints than channels can be served. The data
+  *         toggle is kept across bindings; shared pipe numbers must not be
+  *         passed to the USBH_LL_ functions nor to the polled transfer
+  *         functions.
+  * @param  phost: Host Handle
+  * @param  ep_addr: End point for which the Pipe to be allocated
+  * @retval Pipe number, 0xFF if none is free
+  */
+uint8_t USBH_AllocSharedPipe  (USBH_HandleTypeDef *phost, uint8_t ep_addr)
+{
+  uint8_t idx;
+
+  for (idx = USBH_MAX_PIPES_NBR; idx < USBH_PIPES_NBR; idx++)
+  {
+    if ((phost->Pipes[idx] & 0x8000U) == 0U)
+    {
+      phost->Pipes[idx] = 0x8000U | ep_addr;
+      phost->PipeQueue[idx].channel = 0xFFU;
+      return idx;
+    }
+  }
+  return 0xFFU;
+}
+
+/**
+  * @brief  USBH_BindChannel
+  *         Bind a free host channel to a shared pipe, if it has none, and
+  *         open it with the pipe endpoint and data toggle. Called with the
+  *         HCD interrupt masked or from it.
+  * @param  phost: Host Handle
+  * @param  pipe_num: shared Pipe Number
+  * @retval USBH_OK when the pipe has a channel, USBH_BUSY if none is free
+  */
+USBH_StatusTypeDef USBH_BindChannel  (USBH_HandleTypeDef *phost, uint8_t pipe_num)
+{
+  USBH_HandleTypeDef *root = USBH_ROOT_HOST(phost);
+  USBH_PipeQueueTypeDef *queue = &phost->PipeQueue[pipe_num];
+  uint8_t ch;
+
+  if (queue->channel != 0xFFU)
+  {
+    return USBH_OK;
+  }
+
+  for (ch = 0U; ch < USBH_MAX_CHANNELS_NBR; ch++)
+  {
+    if ((root->Pipes[ch] & 0x8000U) == 0U)
+    {
+      if (USBH_LL_OpenPipe(phost, ch, queue->ep_addr, queue->dev_address,
+                           queue->speed, queue->ep_type, queue->mps) != USBH_OK)
+      {
+        /* Driver locked by the thread: try again on the next SOF */
+        return USBH_BUSY;
+      }
+
+      root->Pipes[ch] = 0x8000U | queue->ep_addr;
+      root->ChannelPipe[ch] = pipe_num;
+#if (USBH_USE_HUB == 1U)
+      root->ChannelHost[ch] = phost;
+#endif
+      queue->channel = ch;
+      USBH_LL_SetToggle(phost, ch, queue->toggle);
+      return USBH_OK;
+    }
+  }
+  return USBH_BUSY;
+}
+
+/**
+  * @brief  USBH_ReleaseChannel
+  *         Give back the host channel bound to a shared pipe, keeping its
+  *         data toggle for the next binding. The channel must be halted.
+  * @param  phost: Host Handle
+  * @param  pipe_num: Pipe Number, channel pipes are left untouched
+  * @retval None
+  */
+void USBH_ReleaseChannel  (USBH_HandleTypeDef *phost, uint8_t pipe_num)
+{
+  USBH_PipeQueueTypeDef *queue = &phost->PipeQueue[pipe_num];
+  uint8_t ch;
+
+  if ((pipe_num < USBH_MAX_PIPES_NBR) || (queue->channel == 0xFFU))
+  {
+    return;
+  }
+
+  ch = queue->channel;
+  queue->toggle = USBH_LL_GetToggle(phost, ch);
+  queue->channel = 0xFFU;
+  USBH_ROOT_HOST(phost)->ChannelPipe[ch] = 0xFFU;
+  USBH_ROOT_HOST(phost)->Pipes[ch] = 0U;
+#if (USBH_USE_HUB == 1U)
+  USBH_ROOT_HOST(phost)->ChannelHost[ch] = NULL;
+#endif
+}
+#endif
 /**
 * @}
 */
@@ -0,0 +1,157 @@
+/**
+  ******************************************************************************
+  * @file    mic_capture.h
+  * @author  MCD Application Team
+  * @brief   Header for mic_capture module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _MIC_CAPTURE_H__
+#define _MIC_CAPTURE_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported constants --------------------------------------------------------*/
+/* 1 to decimate in software with the PDM library (I2S input), 0 to use the
+   DFSDM filters. Defaults to the DFSDM on the devices which have one. */
+#if !defined(MIC_CAPTURE_USE_PDM_LIB)
+#if defined(DFSDM1_Filter0)
+#define MIC_CAPTURE_USE_PDM_LIB   0U
+#else
+#define MIC_CAPTURE_USE_PDM_LIB   1U
+#endif
+#endif
+
+/* Microphones captured together: one DFSDM filter each, or the two
+   microphones sharing the I2S data line */
+#if (MIC_CAPTURE_USE_PDM_LIB == 0U)
+#if defined(DFSDM1_Filter3)
+#define MIC_CAPTURE_MAX_MICS      4U
+#else
+#define MIC_CAPTURE_MAX_MICS      2U
+#endif
+#else
+#define MIC_CAPTURE_MAX_MICS      2U
+#endif
+
+/* Largest block handed to the application, in frames. Override in main.h. */
+#if !defined(MIC_CAPTURE_MAX_FRAMES)
+#define MIC_CAPTURE_MAX_FRAMES    256U
+#endif
+/* Largest PDM decimation ratio with the PDM library, sizes the PDM buffer.
+   Override in main.h. */
+#if !defined(MIC_CAPTURE_MAX_DECIMATION)
+#define MIC_CAPTURE_MAX_DECIMATION 64U
+#endif
+/* Frames of microphone 0 kept while listening, handed back on wake up.
+   Override in main.h. */
+#if !defined(MIC_CAPTURE_PREROLL_FRAMES)
+#define MIC_CAPTURE_PREROLL_FRAMES 4096U
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+  MIC_CAPTURE_STATE_RESET = 0U,  /* Not initialized               */
+  MIC_CAPTURE_STATE_READY = 1U,  /* Initialized, capture stopped  */
+  MIC_CAPTURE_STATE_BUSY  = 2U,  /* Capture running               */
+  MIC_CAPTURE_STATE_ERROR = 3U,  /* Overrun or transfer error     */
+  MIC_CAPTURE_STATE_LISTEN = 4U  /* Waiting for sound, DFSDM only */
+} MIC_Capture_StateTypeDef;
+
+#if (MIC_CAPTURE_USE_PDM_LIB == 0U)
+typedef struct
+{
+  DFSDM_Channel_TypeDef *Channel;     /* DFSDM1_Channelx sampling the microphone         */
+  uint32_t               ChannelSel;  /* DFSDM_CHANNEL_x of the same channel             */
+  uint32_t               Pins;        /* DFSDM_CHANNEL_SAME_CHANNEL_PINS or
+                                         DFSDM_CHANNEL_FOLLOWING_CHANNEL_PINS            */
+  uint32_t               Edge;        /* DFSDM_CHANNEL_SPI_RISING or _SPI_FALLING: data
+                                         valid edge selected by the microphone L/R pin  */
+} MIC_Capture_MicTypeDef;
+#endif
+
+typedef struct
+{
+  uint32_t AudioFreq;    /* PCM sample rate, in Hz                                  */
+  uint32_t MicNbr;       /* Microphones, 1 to MIC_CAPTURE_MAX_MICS                  */
+  uint32_t FrameNbr;     /* Frames per block, up to MIC_CAPTURE_MAX_FRAMES; a
+                            multiple of AudioFreq / 1000 with the PDM library      */
+  uint32_t Decimation;   /* PDM clock / AudioFreq: 16 to 256 with the DFSDM, 16,
+                            24, 32, 48, 64, 80 or 128 with the PDM library         */
+  int32_t  Gain;         /* Digital gain, in 6 dB steps                             */
+#if (MIC_CAPTURE_USE_PDM_LIB == 0U)
+  uint32_t ClockSource;  /* DFSDM_CHANNEL_OUTPUT_CLOCK_AUDIO or _SYSTEM              */
+  uint32_t ClockFreq;    /* Frequency of that clock, in Hz                          */
+  MIC_Capture_MicTypeDef Mic[MIC_CAPTURE_MAX_MICS];
+#else
+  I2S_HandleTypeDef *hi2s; /* I2S master receiver, 16-bit, clocking the microphones
+                              at AudioFreq * Decimation, initialized by the user   */
+#endif
+} MIC_Capture_InitTypeDef;
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef        MIC_Capture_Init(const MIC_Capture_InitTypeDef *pInit);
+HAL_StatusTypeDef        MIC_Capture_DeInit(void);
+HAL_StatusTypeDef        MIC_Capture_Start(void);
+HAL_StatusTypeDef        MIC_Capture_Stop(void);
+MIC_Capture_StateTypeDef MIC_Capture_GetState(void);
+uint32_t                 MIC_Capture_GetFrameCount(void);
+
+void MIC_Capture_DMA_IRQHandler(uint32_t Mic);
+#if (MIC_CAPTURE_USE_PDM_LIB == 0U)
+void MIC_Capture_DFSDM_IRQHandler(uint32_t Mic);
+
+HAL_StatusTypeDef        MIC_Capture_StartListen(uint16_t Threshold);
+HAL_StatusTypeDef        MIC_Capture_StopListen(void);
+uint32_t                 MIC_Capture_ReadPreroll(int16_t *pPcm, uint32_t FrameNbr);
+#endif
+
+void MIC_Capture_BlockReadyCallback(const int16_t *pPcm, uint32_t FrameNbr);
+void MIC_Capture_ErrorCallback(void);
+#if (MIC_CAPTURE_USE_PDM_LIB == 0U)
+void MIC_Capture_WakeCallback(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _MIC_CAPTURE_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
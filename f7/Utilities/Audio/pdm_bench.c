@@ -0,0 +1,216 @@
+/**
+  ******************************************************************************
+  * @file    pdm_bench.c
+  * @author  MCD Application Team
+  * @brief   Cycle count of the PDM to PCM conversion per 1 ms block, to compare
+  *          the source decimator (PDM2PCM_OPEN) with the PDM2PCM library.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- build the application twice: with the PDM2PCM library linked, then with
+   PDM2PCM_OPEN defined and pdm2pcm_open.c compiled in its place. The
+   results report which of the two is measured.
+
+2- call PDM_Bench_Run() with the decimation factor, the number of
+   interleaved microphones and the output rate of the use case: it converts
+   Iterations blocks of 1 ms of pseudo-random PDM data, one PDM_Filter()
+   call per microphone as the BSP audio drivers do, timed with the DWT
+   cycle counter, interrupts enabled.
+
+3- the CPU load is the average cycles per 1 ms block at SystemCoreClock.
+   PDM_Bench_Report() formats the run and its result in one line for a
+   console.
+
+Run it from the memory the application uses for the conversion code and
+buffers: the ITCM and DTCM on STM32F7 change the result.
+*******************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include "pdm_bench.h"
+#include <stdio.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static PDM_Filter_Handler_t PDM_Bench_Handler[PDM_BENCH_MAX_MICS];
+static PDM_Filter_Config_t  PDM_Bench_Config[PDM_BENCH_MAX_MICS];
+static uint8_t              PDM_Bench_In[PDM_BENCH_MAX_MICS * PDM_BENCH_MAX_SAMPLES * 16U];
+static int16_t              PDM_Bench_Out[PDM_BENCH_MAX_MICS * PDM_BENCH_MAX_SAMPLES];
+
+/* Private function prototypes -----------------------------------------------*/
+static uint16_t PDM_Bench_Factor(uint32_t Decimation);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Measure the conversion of 1 ms blocks
+  * @param  pRun: Use case
+  * @param  pResult: Cycles per block and CPU load
+  * @retval HAL_OK, or HAL_ERROR for a use case out of range or refused by
+  *         the PDM filter
+  */
+HAL_StatusTypeDef PDM_Bench_Run(const PDM_Bench_RunTypeDef *pRun, PDM_Bench_ResultTypeDef *pResult)
+{
+  uint32_t samples = pRun->OutputRate / 1000U;
+  uint32_t bytes;
+  uint32_t lfsr = 0xACE1U;
+  uint32_t start;
+  uint32_t cycles;
+  uint64_t sum = 0U;
+  uint32_t i;
+  uint32_t mic;
+
+  pResult->pImplementation = "library";
+#if defined(PDM2PCM_OPEN)
+  pResult->pImplementation = "open";
+#endif
+
+  if((PDM_Bench_Factor(pRun->Decimation) == 0U) || (pRun->Mics == 0U) || (pRun->Mics > PDM_BENCH_MAX_MICS) ||
+     (samples == 0U) || (samples > PDM_BENCH_MAX_SAMPLES) || ((pRun->OutputRate % 1000U) != 0U) ||
+     (pRun->Iterations == 0U))
+  {
+    return HAL_ERROR;
+  }
+  bytes = samples * pRun->Decimation / 8U;
+
+  /* PDM noise, the cost does not depend on the signal */
+  for(i = 0U; i < (bytes * pRun->Mics); i++)
+  {
+    lfsr = (lfsr >> 1) ^ ((0U - (lfsr & 1U)) & 0xB400U);
+    PDM_Bench_In[i] = (uint8_t)lfsr;
+  }
+
+  for(mic = 0U; mic < pRun->Mics; mic++)
+  {
+    PDM_Bench_Handler[mic].bit_order        = PDM_FILTER_BIT_ORDER_LSB;
+    PDM_Bench_Handler[mic].endianness       = PDM_FILTER_ENDIANNESS_LE;
+    PDM_Bench_Handler[mic].high_pass_tap    = 2122358088U;
+    PDM_Bench_Handler[mic].in_ptr_channels  = (uint16_t)pRun->Mics;
+    PDM_Bench_Handler[mic].out_ptr_channels = (uint16_t)pRun->Mics;
+    PDM_Bench_Config[mic].decimation_factor     = PDM_Bench_Factor(pRun->Decimation);
+    PDM_Bench_Config[mic].output_samples_number = (uint16_t)samples;
+    PDM_Bench_Config[mic].mic_gain              = 24;
+    if((PDM_Filter_Init(&PDM_Bench_Handler[mic]) != 0U) ||
+       (PDM_Filter_setConfig(&PDM_Bench_Handler[mic], &PDM_Bench_Config[mic]) != 0U))
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  /* Enable the DWT cycle counter */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#if (__CORTEX_M == 7U)
+  DWT->LAR = 0xC5ACCE55U;
+#endif
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  pResult->CyclesMin = 0xFFFFFFFFU;
+  pResult->CyclesMax = 0U;
+  for(i = 0U; i < pRun->Iterations; i++)
+  {
+    start = DWT->CYCCNT;
+    for(mic = 0U; mic < pRun->Mics; mic++)
+    {
+      (void)PDM_Filter(&PDM_Bench_In[mic], &PDM_Bench_Out[mic], &PDM_Bench_Handler[mic]);
+    }
+    cycles = DWT->CYCCNT - start;
+
+    sum += cycles;
+    if(cycles < pResult->CyclesMin)
+    {
+      pResult->CyclesMin = cycles;
+    }
+    if(cycles > pResult->CyclesMax)
+    {
+      pResult->CyclesMax = cycles;
+    }
+  }
+  pResult->CyclesAvg = (uint32_t)(sum / pRun->Iterations);
+
+  /* Cycles per ms over cycles available per ms, in 0.01 % */
+  pResult->Load = (uint32_t)(((uint64_t)pResult->CyclesAvg * 10000000U) / SystemCoreClock);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Format a run and its result in one line
+  * @param  pRun: Use case
+  * @param  pResult: Result of PDM_Bench_Run()
+  * @param  pBuffer: Text buffer
+  * @param  Size: Text buffer size
+  * @retval Length of the line, longer than Size - 1 when truncated
+  */
+uint32_t PDM_Bench_Report(const PDM_Bench_RunTypeDef *pRun, const PDM_Bench_ResultTypeDef *pResult,
+                          char *pBuffer, uint32_t Size)
+{
+  int written;
+
+  written = snprintf(pBuffer, Size,
+                     "pdm2pcm %s: decimation %lu, %lu mic, %lu Hz, %lu cycles/ms (min %lu, max %lu), load %lu.%02lu %% at %lu Hz\r\n",
+                     pResult->pImplementation, (unsigned long)pRun->Decimation, (unsigned long)pRun->Mics,
+                     (unsigned long)pRun->OutputRate, (unsigned long)pResult->CyclesAvg,
+                     (unsigned long)pResult->CyclesMin, (unsigned long)pResult->CyclesMax,
+                     (unsigned long)(pResult->Load / 100U), (unsigned long)(pResult->Load % 100U),
+                     (unsigned long)SystemCoreClock);
+
+  return (written > 0) ? (uint32_t)written : 0U;
+}
+
+/**
+  * @brief  PDM_FILTER_DEC_FACTOR_xxx code of a decimation factor
+  * @param  Decimation: Decimation factor
+  * @retval Code, 0 if not supported by the PDM2PCM API
+  */
+static uint16_t PDM_Bench_Factor(uint32_t Decimation)
+{
+  uint16_t factor;
+
+  switch(Decimation)
+  {
+  case 16U:  factor = PDM_FILTER_DEC_FACTOR_16;  break;
+  case 24U:  factor = PDM_FILTER_DEC_FACTOR_24;  break;
+  case 32U:  factor = PDM_FILTER_DEC_FACTOR_32;  break;
+  case 48U:  factor = PDM_FILTER_DEC_FACTOR_48;  break;
+  case 64U:  factor = PDM_FILTER_DEC_FACTOR_64;  break;
+  case 80U:  factor = PDM_FILTER_DEC_FACTOR_80;  break;
+  case 128U: factor = PDM_FILTER_DEC_FACTOR_128; break;
+  default:   factor = 0U;                        break;
+  }
+
+  return factor;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,89 @@
+/**
+  ******************************************************************************
+  * @file    pdm_bench.h
+  * @author  MCD Application Team
+  * @brief   Header for pdm_bench module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _PDM_BENCH_H__
+#define _PDM_BENCH_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "pdm2pcm_glo.h"
+
+/* Exported constants --------------------------------------------------------*/
+/* Largest case measured: microphones, and output samples per ms. Override in
+   main.h. */
+#if !defined(PDM_BENCH_MAX_MICS)
+#define PDM_BENCH_MAX_MICS          4U
+#endif
+#if !defined(PDM_BENCH_MAX_SAMPLES)
+#define PDM_BENCH_MAX_SAMPLES       48U
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t  Decimation;                /* 16, 24, 32, 48, 64, 80 or 128           */
+  uint32_t  Mics;                      /* Interleaved microphones, 1 to 4         */
+  uint32_t  OutputRate;                /* Hz, multiple of 1000                    */
+  uint32_t  Iterations;                /* 1 ms blocks converted                   */
+} PDM_Bench_RunTypeDef;
+
+typedef struct
+{
+  const char *pImplementation;         /* "open" (PDM2PCM_OPEN) or "library"      */
+  uint32_t  CyclesMin;                 /* Per 1 ms block, all the microphones     */
+  uint32_t  CyclesMax;
+  uint32_t  CyclesAvg;
+  uint32_t  Load;                      /* Average CPU load, in 0.01 %             */
+} PDM_Bench_ResultTypeDef;
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef PDM_Bench_Run(const PDM_Bench_RunTypeDef *pRun, PDM_Bench_ResultTypeDef *pResult);
+uint32_t          PDM_Bench_Report(const PDM_Bench_RunTypeDef *pRun, const PDM_Bench_ResultTypeDef *pResult,
+                                   char *pBuffer, uint32_t Size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _PDM_BENCH_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
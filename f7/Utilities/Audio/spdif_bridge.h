@@ -0,0 +1,123 @@
+/**
+  ******************************************************************************
+  * @file    spdif_bridge.h
+  * @author  MCD Application Team
+  * @brief   Header for spdif_bridge module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _SPDIF_BRIDGE_H__
+#define _SPDIF_BRIDGE_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#if !defined(SPDIFRX) || !defined(HAL_SPDIFRX_MODULE_ENABLED) || !defined(HAL_SAI_MODULE_ENABLED)
+#error "spdif_bridge requires the SPDIFRX and a SAI with their HAL modules enabled"
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+  SPDIF_BRIDGE_STATE_RESET = 0U,  /* Not initialized                              */
+  SPDIF_BRIDGE_STATE_READY,       /* Initialized, stopped                         */
+  SPDIF_BRIDGE_STATE_SYNC,        /* Waiting for the receiver to lock             */
+  SPDIF_BRIDGE_STATE_STARTING,    /* Receiving, output started at the next half   */
+  SPDIF_BRIDGE_STATE_STREAM,      /* Input played on the SAI                      */
+  SPDIF_BRIDGE_STATE_ERROR        /* Output clock could not be set                */
+} SPDIF_Bridge_StateTypeDef;
+
+typedef struct
+{
+  SPDIFRX_HandleTypeDef *hspdif;  /* Initialized, with a circular word DMA on hdmaDrRx */
+  SAI_HandleTypeDef     *hsai;    /* Initialized transmitter, master, 24-bit data in
+                                     two 32-bit slots, with a circular word DMA     */
+  uint32_t              Frames;   /* Ring size in stereo frames, multiple of 8, at
+                                     most SPDIF_BRIDGE_MAX_FRAMES. The output runs
+                                     Frames / 2 frames behind the input             */
+} SPDIF_Bridge_InitTypeDef;
+
+typedef struct
+{
+  uint8_t  Bytes[24];     /* IEC 60958 channel status block of channel A          */
+  uint32_t Rate;          /* Sampling rate it tells, 0 when not indicated         */
+  uint8_t  Professional;  /* 1: professional (AES3) format, 0: consumer           */
+  uint8_t  NonAudio;      /* 1: the samples are not linear PCM (ex. IEC 61937)    */
+} SPDIF_Bridge_ChannelStatusTypeDef;
+
+typedef struct
+{
+  uint32_t Rate;          /* Sampling rate the output is clocked for, in Hz       */
+  uint32_t MeasuredRate;  /* Input rate measured by the receiver at lock, in Hz   */
+  uint32_t Lag;           /* Output lag behind the input, in frames               */
+  int32_t  ClockError;    /* Output clock error left by the PLLSAI dividers, ppm  */
+  uint32_t Locks;         /* Receiver synchronizations                            */
+  uint32_t SyncErrors;    /* Synchronization losses and failures                  */
+  uint32_t RateChanges;   /* Output re-clockings                                  */
+  uint32_t Slips;         /* Output restarts, the lag having left its window      */
+} SPDIF_Bridge_StatsTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Largest ring, in stereo frames. Override in main.h. */
+#if !defined(SPDIF_BRIDGE_MAX_FRAMES)
+#define SPDIF_BRIDGE_MAX_FRAMES      128U
+#endif
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef         SPDIF_Bridge_Init(const SPDIF_Bridge_InitTypeDef *pInit);
+HAL_StatusTypeDef         SPDIF_Bridge_Start(void);
+HAL_StatusTypeDef         SPDIF_Bridge_Stop(void);
+void                      SPDIF_Bridge_Process(void);
+SPDIF_Bridge_StateTypeDef SPDIF_Bridge_GetState(void);
+void                      SPDIF_Bridge_GetStats(SPDIF_Bridge_StatsTypeDef *pStats);
+void                      SPDIF_Bridge_GetChannelStatus(SPDIF_Bridge_ChannelStatusTypeDef *pStatus);
+
+void SPDIF_Bridge_RX_DMA_IRQHandler(void);
+void SPDIF_Bridge_TX_DMA_IRQHandler(void);
+void SPDIF_Bridge_SPDIFRX_IRQHandler(void);
+
+void SPDIF_Bridge_RateCallback(uint32_t Rate);
+void SPDIF_Bridge_ChannelStatusCallback(const SPDIF_Bridge_ChannelStatusTypeDef *pStatus);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _SPDIF_BRIDGE_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
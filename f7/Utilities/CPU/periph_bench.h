@@ -0,0 +1,193 @@
+/**
+  ******************************************************************************
+  * @file    periph_bench.h
+  * @author  MCD Application Team
+  * @brief   Header for periph_bench module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _PERIPH_BENCH_H__
+#define _PERIPH_BENCH_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported constants --------------------------------------------------------*/
+/* Transfer sizes in bytes, each run with every mode of a target. Sizes that
+   are not a multiple of the granule of the target, larger than its largest
+   transfer or than the buffer given are skipped. Override in main.h. */
+#if !defined(PERIPH_BENCH_SIZES)
+#define PERIPH_BENCH_SIZES           1U, 16U, 64U, 256U, 512U, 1024U, 4096U, 16384U
+#endif
+
+/* Transfers per size: at least PERIPH_BENCH_MIN_COUNT, then more until
+   PERIPH_BENCH_DURATION ms have elapsed or PERIPH_BENCH_MAX_COUNT are done.
+   Override in main.h. */
+#if !defined(PERIPH_BENCH_MIN_COUNT)
+#define PERIPH_BENCH_MIN_COUNT       4U
+#endif
+#if !defined(PERIPH_BENCH_MAX_COUNT)
+#define PERIPH_BENCH_MAX_COUNT       64U
+#endif
+#if !defined(PERIPH_BENCH_DURATION)
+#define PERIPH_BENCH_DURATION        200U
+#endif
+
+/* Longest transfer, in ms. Override in main.h. */
+#if !defined(PERIPH_BENCH_TIMEOUT)
+#define PERIPH_BENCH_TIMEOUT         5000U
+#endif
+
+/* Results kept for the report, one per target, mode and size. Override in
+   main.h. */
+#if !defined(PERIPH_BENCH_MAX_RESULTS)
+#define PERIPH_BENCH_MAX_RESULTS     96U
+#endif
+
+/* Board name in the report: VARIANT_BOARD of the variant_memory.h header
+   generated by OSQ/ldscripts/tpl/variant_gen.py, when main.h includes it.
+   Override in main.h. */
+#if !defined(PERIPH_BENCH_BOARD)
+#if defined(VARIANT_BOARD)
+#define PERIPH_BENCH_BOARD           VARIANT_BOARD
+#else
+#define PERIPH_BENCH_BOARD           ""
+#endif
+#endif
+
+/* Transfer modes */
+#define PERIPH_BENCH_MODE_POLL       0U   /* Blocking HAL function             */
+#define PERIPH_BENCH_MODE_IT         1U   /* HAL_xxx_IT() function             */
+#define PERIPH_BENCH_MODE_DMA        2U   /* HAL_xxx_DMA() function            */
+
+#define PERIPH_BENCH_MODE_BIT(__MODE__)  (1UL << (__MODE__))
+#define PERIPH_BENCH_MODES_ALL       (PERIPH_BENCH_MODE_BIT(PERIPH_BENCH_MODE_POLL) | \
+                                      PERIPH_BENCH_MODE_BIT(PERIPH_BENCH_MODE_IT)   | \
+                                      PERIPH_BENCH_MODE_BIT(PERIPH_BENCH_MODE_DMA))
+
+/* Transfer directions */
+#define PERIPH_BENCH_DIR_TX          0U   /* Memory to peripheral              */
+#define PERIPH_BENCH_DIR_RX          1U   /* Peripheral to memory              */
+#define PERIPH_BENCH_DIR_TXRX        2U   /* Full duplex, the buffer holds the
+                                             transmitted then the received bytes */
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  /* Start a transfer of Size bytes from or to pData. In polling mode the
+     transfer is over on return, in IT and DMA modes the application calls
+     PERIPH_Bench_Complete() from the HAL complete and error callbacks. */
+  HAL_StatusTypeDef (*pStart)(void *pContext, uint32_t Mode, uint32_t Direction, uint8_t *pData, uint32_t Size);
+  /* Stop a transfer that did not complete in time, NULL when not possible */
+  HAL_StatusTypeDef (*pAbort)(void *pContext, uint32_t Mode);
+  /* Wait for the device to be ready again (SD card programming), counted in
+     the transfer, NULL when not needed */
+  HAL_StatusTypeDef (*pWait)(void *pContext, uint32_t Timeout);
+  uint32_t          Granule;                 /* Sizes are multiples of it              */
+  uint32_t          MaxSize;                 /* Largest transfer in bytes              */
+} PERIPH_Bench_OpsTypeDef;
+
+typedef struct
+{
+  const char                    *Name;       /* Reported name, kept by the module      */
+  const PERIPH_Bench_OpsTypeDef *pOps;
+  void                          *pContext;   /* Given to the operations: HAL handle,
+                                                PERIPH_Bench_QSPITypeDef...            */
+  uint32_t                      Direction;   /* PERIPH_BENCH_DIR_xxx                   */
+  uint32_t                      Modes;       /* PERIPH_BENCH_MODE_BIT() of the modes run */
+} PERIPH_Bench_TargetTypeDef;
+
+typedef struct
+{
+  const char *Name;                          /* Target name                            */
+  uint32_t   Direction;
+  uint32_t   Mode;
+  uint32_t   Size;                           /* Bytes per transfer                     */
+  uint32_t   Count;                          /* Transfers completed                    */
+  uint32_t   Errors;                         /* Transfers failed or timed out          */
+  uint32_t   Throughput;                     /* Bytes per second                       */
+  uint32_t   Load;                           /* CPU busy during the transfers, per mille */
+  uint32_t   LatencyMin;                     /* Start call to completion, in cycles    */
+  uint32_t   LatencyMax;
+  uint32_t   LatencyMean;
+} PERIPH_Bench_ResultTypeDef;
+#if defined(HAL_QSPI_MODULE_ENABLED) && defined(QUADSPI)
+typedef struct
+{
+  QSPI_HandleTypeDef  *hqspi;
+  QSPI_CommandTypeDef Command;               /* Read or program command of the memory,
+                                                NbData is set for each transfer        */
+} PERIPH_Bench_QSPITypeDef;
+#endif
+#if defined(HAL_SD_MODULE_ENABLED) && (defined(SDIO) || defined(SDMMC1))
+typedef struct
+{
+  SD_HandleTypeDef    *hsd;
+  uint32_t            BlockAdd;              /* First block of the card area used,
+                                                overwritten by the TX target           */
+} PERIPH_Bench_SDTypeDef;
+#endif
+
+/* Exported variables --------------------------------------------------------*/
+/* Operations of the HAL drivers, 8-bit frames for SPI and UART */
+#if defined(HAL_SPI_MODULE_ENABLED)
+extern const PERIPH_Bench_OpsTypeDef PERIPH_Bench_SPI;          /* SPI_HandleTypeDef        */
+#endif
+#if defined(HAL_UART_MODULE_ENABLED)
+extern const PERIPH_Bench_OpsTypeDef PERIPH_Bench_UART;         /* UART_HandleTypeDef       */
+#endif
+#if defined(HAL_QSPI_MODULE_ENABLED) && defined(QUADSPI)
+extern const PERIPH_Bench_OpsTypeDef PERIPH_Bench_QSPI;         /* PERIPH_Bench_QSPITypeDef */
+#endif
+#if defined(HAL_SD_MODULE_ENABLED) && (defined(SDIO) || defined(SDMMC1))
+extern const PERIPH_Bench_OpsTypeDef PERIPH_Bench_SD;           /* PERIPH_Bench_SDTypeDef   */
+#endif
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+void              PERIPH_Bench_Init(void);
+void              PERIPH_Bench_Reset(void);
+HAL_StatusTypeDef PERIPH_Bench_Run(const PERIPH_Bench_TargetTypeDef *pTarget, uint8_t *pBuffer, uint32_t Size);
+void              PERIPH_Bench_Complete(HAL_StatusTypeDef Status);
+HAL_StatusTypeDef PERIPH_Bench_GetResult(uint32_t Index, PERIPH_Bench_ResultTypeDef *pResult);
+uint32_t          PERIPH_Bench_Report(char *pBuffer, uint32_t Size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _PERIPH_BENCH_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,577 @@
+/**
+  ******************************************************************************
+  * @file    dcmi_stream.c
+  * @author  MCD Application Team
+  * @brief   DCMI capture in chained DMA blocks with scheduled regions of interest
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- initialize the DCMI with HAL_DCMI_Init() and link its DMA stream
+   (peripheral to memory, word transfers, FIFO enabled). Call
+   DCMI_Stream_IRQHandler() from the DCMI interrupt handler in place of
+   HAL_DCMI_IRQHandler(), HAL_DMA_IRQHandler() from the DMA stream handler,
+   both interrupts at the same priority. The module runs the DCMI in
+   snapshot mode, one frame at a time, the HAL DCMI capture functions must
+   not be used on this handle afterwards.
+
+2- the frame is captured into a pool of blocks (pBlocks, NbBlocks of
+   BlockSize bytes) by the DMA in double buffer mode: when a block is full,
+   the DMA goes on in the other one and the memory address of the full
+   block is set to the next free block. A frame of any size is captured
+   this way, with no copy and no limit of the DMA counter, and the RAM used
+   is the pool only. Each block is handed over as soon as it is full,
+   flagged DCMI_STREAM_FLAG_FIRST and DCMI_STREAM_FLAG_LAST at the frame
+   boundaries, the last one with the bytes up to the end of the frame.
+
+3- regions of interest: each frame is cropped to the region due, a region
+   is due every Divider frames (0 to disable it), the first regions first
+   when several are due. The frames with no region due are not captured.
+   The regions are read at each frame: Divider and the crop window may be
+   changed while the stream runs. With HAL_DCMI_Init() in JPEG mode, the
+   DCMI captures the JPEG stream of the sensor, set in JPEG mode by the
+   application: the crop is not used, and the blocks, flagged
+   DCMI_STREAM_FLAG_JPEG, can be written as they are to a file.
+
+4- DCMI_Stream_Start() and DCMI_Stream_Stop(). The blocks captured are read
+   with DCMI_Stream_Get(), in capture order, and given back with
+   DCMI_Stream_Release() once written to the storage or processed.
+   DCMI_Stream_BlockCallback() is called from the interrupt for each block.
+   A frame due with less than two free blocks is skipped, a block needed in
+   the middle of a frame with no free block is lost and the frame flagged
+   DCMI_STREAM_FLAG_OVERRUN.
+
+5- with the data cache enabled (Cortex-M7), the blocks are invalidated
+   before they are handed over: they must be aligned on 32 bytes and not
+   written by the CPU.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "dcmi_stream.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define DCMI_STREAM_STATE_RESET    0U
+#define DCMI_STREAM_STATE_READY    1U
+#define DCMI_STREAM_STATE_RUNNING  2U
+
+#define DCMI_STREAM_NONE           0xFFFFFFFFU
+
+/* Private macro -------------------------------------------------------------*/
+#define DCMI_STREAM_DMA(__HDMA__)  ((DMA_Stream_TypeDef *)(__HDMA__)->Instance)
+
+/* Private variables ---------------------------------------------------------*/
+/* Stream of the DCMI, found back from the DMA callbacks */
+static DCMI_StreamTypeDef *Stream;
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t DCMI_Stream_Take(DCMI_StreamTypeDef *pStream);
+static void DCMI_Stream_Give(DCMI_StreamTypeDef *pStream, uint32_t Index);
+static void DCMI_Stream_Deliver(DCMI_StreamTypeDef *pStream, uint32_t Index, uint32_t Length);
+static void DCMI_Stream_Arm(DCMI_StreamTypeDef *pStream);
+static void DCMI_Stream_BlockDone(DCMI_StreamTypeDef *pStream, uint32_t Memory);
+static void DCMI_Stream_EndFrame(DCMI_StreamTypeDef *pStream);
+static void DCMI_Stream_DMAM0Cplt(DMA_HandleTypeDef *hdma);
+static void DCMI_Stream_DMAM1Cplt(DMA_HandleTypeDef *hdma);
+static void DCMI_Stream_DMAError(DMA_HandleTypeDef *hdma);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Bind a block pool and regions of interest to the DCMI
+  * @param  pStream: stream context, kept by the module
+  * @param  pConfig: DCMI, pool and regions, copied, regions kept by reference
+  * @retval HAL status
+  */
+HAL_StatusTypeDef DCMI_Stream_Init(DCMI_StreamTypeDef *pStream, const DCMI_Stream_ConfigTypeDef *pConfig)
+{
+  uint32_t i;
+
+  if ((pStream == NULL) || (pConfig == NULL) || (pConfig->hdcmi == NULL) || (pConfig->hdcmi->DMA_Handle == NULL) ||
+      (pConfig->pBlocks == NULL) || (pConfig->BlockSize == 0U) || ((pConfig->BlockSize & 31U) != 0U) ||
+      ((pConfig->BlockSize / 4U) > 0xFFFFU) || (pConfig->NbBlocks < 2U) ||
+      (pConfig->NbBlocks > DCMI_STREAM_MAX_BLOCKS) || (pConfig->NbBlocks > 32U) ||
+      (pConfig->pRois == NULL) || (pConfig->NbRois == 0U) || (pConfig->NbRois > DCMI_STREAM_MAX_ROIS) ||
+      ((Stream != NULL) && (Stream != pStream)))
+  {
+    return HAL_ERROR;
+  }
+
+  pStream->Config = *pConfig;
+  for (i = 0U; i < pConfig->NbBlocks; i++)
+  {
+    pStream->Blocks[i].pData  = &pConfig->pBlocks[i * pConfig->BlockSize];
+    pStream->Blocks[i].Length = 0U;
+    pStream->Blocks[i].Flags  = 0U;
+  }
+  pStream->Free      = (pConfig->NbBlocks == 32U) ? 0xFFFFFFFFU : ((1UL << pConfig->NbBlocks) - 1U);
+  pStream->ReadyHead = 0U;
+  pStream->ReadyTail = 0U;
+  pStream->Capturing = 0U;
+  pStream->Frames    = 0U;
+  pStream->Captured  = 0U;
+  pStream->Skipped   = 0U;
+  pStream->Overruns  = 0U;
+  pStream->Errors    = 0U;
+  pStream->State     = DCMI_STREAM_STATE_READY;
+  Stream = pStream;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Start the stream: frames captured from the next VSYNC on
+  * @param  pStream: stream context
+  * @retval HAL status
+  */
+HAL_StatusTypeDef DCMI_Stream_Start(DCMI_StreamTypeDef *pStream)
+{
+  DCMI_HandleTypeDef *hdcmi;
+  DMA_HandleTypeDef *hdma;
+  uint32_t i;
+
+  if ((pStream == NULL) || (pStream->State != DCMI_STREAM_STATE_READY))
+  {
+    return HAL_ERROR;
+  }
+  hdcmi = pStream->Config.hdcmi;
+  hdma  = hdcmi->DMA_Handle;
+
+  hdma->XferCpltCallback       = DCMI_Stream_DMAM0Cplt;
+  hdma->XferM1CpltCallback     = DCMI_Stream_DMAM1Cplt;
+  hdma->XferErrorCallback      = DCMI_Stream_DMAError;
+  hdma->XferHalfCpltCallback   = NULL;
+  hdma->XferM1HalfCpltCallback = NULL;
+
+  /* Regions due at the first frame */
+  for (i = 0U; i < pStream->Config.NbRois; i++)
+  {
+    pStream->Countdown[i] = 1U;
+  }
+  pStream->Capturing = 0U;
+  pStream->State     = DCMI_STREAM_STATE_RUNNING;
+
+  /* Snapshot mode, the frame tick and the end of capture by interrupt */
+  hdcmi->Instance->CR &= ~(DCMI_CR_CAPTURE | DCMI_CR_CROP);
+  hdcmi->Instance->CR |= DCMI_CR_CM;
+  hdcmi->Instance->ICR = DCMI_IT_FRAME | DCMI_IT_OVR | DCMI_IT_ERR | DCMI_IT_VSYNC | DCMI_IT_LINE;
+  __HAL_DCMI_ENABLE_IT(hdcmi, DCMI_IT_FRAME | DCMI_IT_OVR | DCMI_IT_ERR | DCMI_IT_VSYNC);
+  __HAL_DCMI_ENABLE(hdcmi);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the stream, the frame being captured is dropped
+  * @param  pStream: stream context
+  * @retval HAL status
+  */
+HAL_StatusTypeDef DCMI_Stream_Stop(DCMI_StreamTypeDef *pStream)
+{
+  DCMI_HandleTypeDef *hdcmi;
+
+  if ((pStream == NULL) || (pStream->State != DCMI_STREAM_STATE_RUNNING))
+  {
+    return HAL_ERROR;
+  }
+  hdcmi = pStream->Config.hdcmi;
+
+  __HAL_DCMI_DISABLE_IT(hdcmi, DCMI_IT_FRAME | DCMI_IT_OVR | DCMI_IT_ERR | DCMI_IT_VSYNC);
+  hdcmi->Instance->CR &= ~DCMI_CR_CAPTURE;
+  __HAL_DCMI_DISABLE(hdcmi);
+  if (pStream->Capturing != 0U)
+  {
+    (void)HAL_DMA_Abort(hdcmi->DMA_Handle);
+    DCMI_Stream_Give(pStream, pStream->Active[0]);
+    DCMI_Stream_Give(pStream, pStream->Active[1]);
+    pStream->Capturing = 0U;
+  }
+  pStream->State = DCMI_STREAM_STATE_READY;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Oldest block captured, kept up to DCMI_Stream_Release()
+  * @param  pStream: stream context
+  * @retval Block, NULL when none is pending
+  */
+const DCMI_Stream_BlockTypeDef *DCMI_Stream_Get(DCMI_StreamTypeDef *pStream)
+{
+  uint32_t index;
+
+  if ((pStream == NULL) || (pStream->ReadyHead == pStream->ReadyTail))
+  {
+    return NULL;
+  }
+  index = pStream->Ready[pStream->ReadyTail % DCMI_STREAM_MAX_BLOCKS];
+  pStream->ReadyTail++;
+
+  return &pStream->Blocks[index];
+}
+
+/**
+  * @brief  Give a block back to the pool
+  * @param  pStream: stream context
+  * @param  pBlock: block of DCMI_Stream_Get() or of DCMI_Stream_BlockCallback()
+  * @retval None
+  */
+void DCMI_Stream_Release(DCMI_StreamTypeDef *pStream, const DCMI_Stream_BlockTypeDef *pBlock)
+{
+  uint32_t index;
+
+  if ((pStream == NULL) || (pBlock < &pStream->Blocks[0]) ||
+      (pBlock >= &pStream->Blocks[pStream->Config.NbBlocks]))
+  {
+    return;
+  }
+  index = (uint32_t)(pBlock - &pStream->Blocks[0]);
+  DCMI_Stream_Give(pStream, index);
+}
+
+/**
+  * @brief  DCMI interrupt of the stream, in place of HAL_DCMI_IRQHandler()
+  * @param  pStream: stream context
+  * @retval None
+  */
+void DCMI_Stream_IRQHandler(DCMI_StreamTypeDef *pStream)
+{
+  DCMI_HandleTypeDef *hdcmi = pStream->Config.hdcmi;
+  uint32_t flags = hdcmi->Instance->MISR;
+  uint32_t i;
+
+  hdcmi->Instance->ICR = flags;
+  if (pStream->State != DCMI_STREAM_STATE_RUNNING)
+  {
+    return;
+  }
+
+  if ((flags & (DCMI_IT_OVR | DCMI_IT_ERR)) != 0U)
+  {
+    pStream->Errors++;
+    pStream->FrameFlags |= DCMI_STREAM_FLAG_ERROR;
+  }
+
+  /* End of the capture, seen from the frame flag or from the capture bit
+     cleared by the snapshot mode when the VSYNC is served first */
+  if ((pStream->Capturing != 0U) &&
+      (((flags & DCMI_IT_FRAME) != 0U) || ((hdcmi->Instance->CR & DCMI_CR_CAPTURE) == 0U)))
+  {
+    DCMI_Stream_EndFrame(pStream);
+    hdcmi->Instance->ICR = DCMI_IT_FRAME;
+  }
+
+  /* Start of the vertical blanking: frame tick, next frame armed */
+  if ((flags & DCMI_IT_VSYNC) != 0U)
+  {
+    pStream->Frames++;
+    for (i = 0U; i < pStream->Config.NbRois; i++)
+    {
+      if (pStream->Countdown[i] > 1U)
+      {
+        pStream->Countdown[i]--;
+      }
+    }
+    if (pStream->Capturing == 0U)
+    {
+      DCMI_Stream_Arm(pStream);
+    }
+  }
+}
+
+/**
+  * @brief  Block captured
+  * @param  pStream: stream context
+  * @param  pBlock: block, to give back with DCMI_Stream_Release() once used
+  * @note   Called from the interrupt. The block is also returned by
+  *         DCMI_Stream_Get(): a callback keeping it must not Get it again.
+  * @retval None
+  */
+__weak void DCMI_Stream_BlockCallback(DCMI_StreamTypeDef *pStream, const DCMI_Stream_BlockTypeDef *pBlock)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(pStream);
+  UNUSED(pBlock);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the DCMI_Stream_BlockCallback could be implemented in the user file
+   */
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Take a free block of the pool
+  * @param  pStream: stream context
+  * @retval Block index, DCMI_STREAM_NONE when the pool is empty
+  */
+static uint32_t DCMI_Stream_Take(DCMI_StreamTypeDef *pStream)
+{
+  uint32_t primask;
+  uint32_t index = DCMI_STREAM_NONE;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (pStream->Free != 0U)
+  {
+    index = __CLZ(__RBIT(pStream->Free));
+    pStream->Free &= ~(1UL << index);
+  }
+  __set_PRIMASK(primask);
+
+  return index;
+}
+
+/**
+  * @brief  Give a block back to the pool
+  * @param  pStream: stream context
+  * @param  Index: block index
+  * @retval None
+  */
+static void DCMI_Stream_Give(DCMI_StreamTypeDef *pStream, uint32_t Index)
+{
+  uint32_t primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  pStream->Free |= 1UL << Index;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Hand a block captured over to the application
+  * @param  pStream: stream context
+  * @param  Index: block index
+  * @param  Length: bytes captured
+  * @retval None
+  */
+static void DCMI_Stream_Deliver(DCMI_StreamTypeDef *pStream, uint32_t Index, uint32_t Length)
+{
+  DCMI_Stream_BlockTypeDef *block = &pStream->Blocks[Index];
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  /* Lines of the block fetched before the DMA wrote it */
+  if ((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    SCB_InvalidateDCache_by_Addr((uint32_t *)(uint32_t)block->pData, (int32_t)pStream->Config.BlockSize);
+  }
+#endif
+
+  block->Length = Length;
+  block->Frame  = pStream->Frames;
+  block->Roi    = pStream->Roi;
+  block->Flags  = pStream->FrameFlags;
+  pStream->FrameFlags &= ~DCMI_STREAM_FLAG_FIRST;
+
+  pStream->Ready[pStream->ReadyHead % DCMI_STREAM_MAX_BLOCKS] = (uint8_t)Index;
+  __DMB();
+  pStream->ReadyHead++;
+  DCMI_Stream_BlockCallback(pStream, block);
+}
+
+/**
+  * @brief  Arm the capture of the next frame when a region is due
+  * @param  pStream: stream context
+  * @retval None
+  */
+static void DCMI_Stream_Arm(DCMI_StreamTypeDef *pStream)
+{
+  DCMI_HandleTypeDef *hdcmi = pStream->Config.hdcmi;
+  const DCMI_Stream_RoiTypeDef *roi = NULL;
+  uint32_t first;
+  uint32_t second;
+  uint32_t i;
+
+  for (i = 0U; i < pStream->Config.NbRois; i++)
+  {
+    if ((pStream->Config.pRois[i].Divider != 0U) && (pStream->Countdown[i] <= 1U))
+    {
+      roi = &pStream->Config.pRois[i];
+      break;
+    }
+  }
+  if (roi == NULL)
+  {
+    return;
+  }
+
+  first = DCMI_Stream_Take(pStream);
+  second = (first != DCMI_STREAM_NONE) ? DCMI_Stream_Take(pStream) : DCMI_STREAM_NONE;
+  if (second == DCMI_STREAM_NONE)
+  {
+    /* The region stays due */
+    if (first != DCMI_STREAM_NONE)
+    {
+      DCMI_Stream_Give(pStream, first);
+    }
+    pStream->Skipped++;
+    return;
+  }
+
+  if ((hdcmi->Init.JPEGMode == DCMI_JPEG_ENABLE) || (roi->XSize == 0U))
+  {
+    hdcmi->Instance->CR &= ~DCMI_CR_CROP;
+  }
+  else
+  {
+    hdcmi->Instance->CWSTRTR = roi->X0 | (roi->Y0 << DCMI_CWSTRT_VST_Pos);
+    hdcmi->Instance->CWSIZER = roi->XSize | (roi->YSize << DCMI_CWSIZE_VLINE_Pos);
+    hdcmi->Instance->CR |= DCMI_CR_CROP;
+  }
+
+  pStream->Active[0]  = first;
+  pStream->Active[1]  = second;
+  pStream->Roi        = i;
+  pStream->Countdown[i] = roi->Divider + 1U;
+  pStream->FrameFlags = DCMI_STREAM_FLAG_FIRST;
+  if (hdcmi->Init.JPEGMode == DCMI_JPEG_ENABLE)
+  {
+    pStream->FrameFlags |= DCMI_STREAM_FLAG_JPEG;
+  }
+
+  if (HAL_DMAEx_MultiBufferStart_IT(hdcmi->DMA_Handle, (uint32_t)&hdcmi->Instance->DR,
+                                    (uint32_t)pStream->Blocks[first].pData,
+                                    (uint32_t)pStream->Blocks[second].pData,
+                                    pStream->Config.BlockSize / 4U) != HAL_OK)
+  {
+    DCMI_Stream_Give(pStream, first);
+    DCMI_Stream_Give(pStream, second);
+    pStream->Errors++;
+    return;
+  }
+  pStream->Capturing = 1U;
+  hdcmi->Instance->CR |= DCMI_CR_CAPTURE;
+}
+
+/**
+  * @brief  Block of a DMA memory full: handed over, memory set to a free one
+  * @param  pStream: stream context
+  * @param  Memory: DMA memory, 0 or 1
+  * @retval None
+  */
+static void DCMI_Stream_BlockDone(DCMI_StreamTypeDef *pStream, uint32_t Memory)
+{
+  uint32_t full = pStream->Active[Memory];
+  uint32_t next;
+
+  next = DCMI_Stream_Take(pStream);
+  if (next == DCMI_STREAM_NONE)
+  {
+    /* The DMA writes this block again: its data is lost */
+    pStream->Overruns++;
+    pStream->FrameFlags |= DCMI_STREAM_FLAG_OVERRUN;
+    return;
+  }
+  pStream->Active[Memory] = next;
+  (void)HAL_DMAEx_ChangeMemory(pStream->Config.hdcmi->DMA_Handle, (uint32_t)pStream->Blocks[next].pData,
+                               (Memory == 0U) ? MEMORY0 : MEMORY1);
+  DCMI_Stream_Deliver(pStream, full, pStream->Config.BlockSize);
+}
+
+/**
+  * @brief  End of the capture: last block handed over, the other one freed
+  * @param  pStream: stream context
+  * @retval None
+  */
+static void DCMI_Stream_EndFrame(DCMI_StreamTypeDef *pStream)
+{
+  DMA_HandleTypeDef *hdma = pStream->Config.hdcmi->DMA_Handle;
+  uint32_t current;
+  uint32_t length;
+
+  /* Block completed with the frame, its interrupt not served yet */
+  if (__HAL_DMA_GET_FLAG(hdma, __HAL_DMA_GET_TC_FLAG_INDEX(hdma)) != 0U)
+  {
+    __HAL_DMA_CLEAR_FLAG(hdma, __HAL_DMA_GET_TC_FLAG_INDEX(hdma));
+    DCMI_Stream_BlockDone(pStream, ((DCMI_STREAM_DMA(hdma)->CR & DMA_SxCR_CT) != 0U) ? 0U : 1U);
+  }
+
+  /* Disabling the stream flushes its FIFO to the memory */
+  (void)HAL_DMA_Abort(hdma);
+  current = ((DCMI_STREAM_DMA(hdma)->CR & DMA_SxCR_CT) != 0U) ? 1U : 0U;
+  length  = pStream->Config.BlockSize - (__HAL_DMA_GET_COUNTER(hdma) * 4U);
+
+  pStream->FrameFlags |= DCMI_STREAM_FLAG_LAST;
+  DCMI_Stream_Deliver(pStream, pStream->Active[current], length);
+  DCMI_Stream_Give(pStream, pStream->Active[current ^ 1U]);
+  pStream->Capturing = 0U;
+  pStream->Captured++;
+}
+
+/**
+  * @brief  DMA memory 0 full
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void DCMI_Stream_DMAM0Cplt(DMA_HandleTypeDef *hdma)
+{
+  UNUSED(hdma);
+
+  if ((Stream != NULL) && (Stream->Capturing != 0U))
+  {
+    DCMI_Stream_BlockDone(Stream, 0U);
+  }
+}
+
+/**
+  * @brief  DMA memory 1 full
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void DCMI_Stream_DMAM1Cplt(DMA_HandleTypeDef *hdma)
+{
+  UNUSED(hdma);
+
+  if ((Stream != NULL) && (Stream->Capturing != 0U))
+  {
+    DCMI_Stream_BlockDone(Stream, 1U);
+  }
+}
+
+/**
+  * @brief  DMA error: the frame is flagged, the FIFO errors of the DCMI
+  *         bursts are ignored
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void DCMI_Stream_DMAError(DMA_HandleTypeDef *hdma)
+{
+  if ((Stream != NULL) && ((hdma->ErrorCode & (HAL_DMA_ERROR_TE | HAL_DMA_ERROR_DME)) != 0U))
+  {
+    Stream->Errors++;
+    Stream->FrameFlags |= DCMI_STREAM_FLAG_ERROR;
+  }
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
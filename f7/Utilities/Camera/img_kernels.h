@@ -0,0 +1,105 @@
+/**
+  ******************************************************************************
+  * @file    img_kernels.h
+  * @author  MCD Application Team
+  * @brief   Header for img_kernels module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _IMG_KERNELS_H__
+#define _IMG_KERNELS_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported constants --------------------------------------------------------*/
+/* Widest line processed, in pixels, multiple of 4: size of the scratch lines
+   of the 3x3 kernels and of the resize tables. Override in main.h. */
+#if !defined(IMG_MAX_WIDTH)
+#define IMG_MAX_WIDTH          640U
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+/* 3x3 kernel: output line from the lines above, at and below it. The first
+   and last lines of an image give their own line as missing neighbour. */
+typedef void (*IMG_Kernel3x3TypeDef)(const uint8_t *pAbove, const uint8_t *pLine, const uint8_t *pBelow,
+                                     uint8_t *pOut, uint32_t Width);
+
+typedef struct
+{
+  uint32_t SrcWidth;                    /* Source image, 2 x 2 pixels at least     */
+  uint32_t SrcHeight;
+  uint32_t DstWidth;                    /* Resized image, IMG_MAX_WIDTH at most    */
+  uint32_t DstHeight;
+  uint16_t XIndex[IMG_MAX_WIDTH];       /* Left source pixel of each output pixel  */
+  uint32_t XWeight[IMG_MAX_WIDTH];      /* Q7 weights of the left and right pixels,
+                                           in the low and high half words          */
+} IMG_ResizeTypeDef;
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+void              IMG_RGB565ToGray_Line(const uint16_t *pIn, uint8_t *pOut, uint32_t Width);
+void              IMG_Threshold_Line(const uint8_t *pIn, uint8_t *pOut, uint32_t Width, uint8_t Threshold);
+void              IMG_Lut_Line(const uint8_t *pIn, uint8_t *pOut, uint32_t Width, const uint8_t *pLut);
+
+void              IMG_Box3x3_Line(const uint8_t *pAbove, const uint8_t *pLine, const uint8_t *pBelow,
+                                  uint8_t *pOut, uint32_t Width);
+void              IMG_Gauss3x3_Line(const uint8_t *pAbove, const uint8_t *pLine, const uint8_t *pBelow,
+                                    uint8_t *pOut, uint32_t Width);
+void              IMG_Sobel_Line(const uint8_t *pAbove, const uint8_t *pLine, const uint8_t *pBelow,
+                                 uint8_t *pOut, uint32_t Width);
+void              IMG_Erode3x3_Line(const uint8_t *pAbove, const uint8_t *pLine, const uint8_t *pBelow,
+                                    uint8_t *pOut, uint32_t Width);
+void              IMG_Dilate3x3_Line(const uint8_t *pAbove, const uint8_t *pLine, const uint8_t *pBelow,
+                                     uint8_t *pOut, uint32_t Width);
+
+void              IMG_Histogram(const uint8_t *pIn, uint32_t Width, uint32_t Lines, uint32_t Pitch,
+                                uint32_t *pHistogram);
+void              IMG_EqualizeLut(const uint32_t *pHistogram, uint8_t *pLut);
+
+HAL_StatusTypeDef IMG_Resize_Init(IMG_ResizeTypeDef *pResize, uint32_t SrcWidth, uint32_t SrcHeight,
+                                  uint32_t DstWidth, uint32_t DstHeight);
+uint32_t          IMG_Resize_SrcLine(const IMG_ResizeTypeDef *pResize, uint32_t DstLine);
+void              IMG_Resize_Line(const IMG_ResizeTypeDef *pResize, const uint8_t *pSrc0, const uint8_t *pSrc1,
+                                  uint8_t *pOut, uint32_t DstLine);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _IMG_KERNELS_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
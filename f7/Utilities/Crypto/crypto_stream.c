@@ -0,0 +1,998 @@
+/**
+  ******************************************************************************
+  * @file    crypto_stream.c
+  * @author  MCD Application Team
+  * @brief   Queued, DMA fed hash/HMAC and AES streams over the HASH and CRYP
+  *          processors, with context swapping between sessions.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- enable the HASH and CRYP clocks and configure three DMA streams: HASH IN
+   (memory to peripheral), CRYP IN (memory to peripheral) and CRYP OUT
+   (peripheral to memory), word data size on both sides, memory increment,
+   with their interrupts enabled and HAL_DMA_IRQHandler() called from the
+   stream IRQ handlers. Give them to CRYPTO_Stream_Init().
+
+2- a session is one hash, HMAC or AES stream: CRYPTO_Stream_HashInit() (a
+   key of at most 64 bytes makes it an HMAC) or CRYPTO_Stream_CipherInit().
+   Any number of sessions may exist: when a job of another session is
+   started, the context of the previous one is saved in its session and
+   the context of the new one restored, so TLS records of several
+   connections interleave on the same processors.
+
+3- CRYPTO_Stream_Submit() queues a job: a list of segments processed back
+   to back, i.e. a record split in any number of buffers. The call never
+   blocks and may be done from interrupts. Hash and cipher jobs have their
+   own queue and run in parallel. Job->Callback is called from the DMA
+   interrupt when the job is done; a hash job with pDigest set ends the
+   message and writes the digest.
+
+4- hash segments may have any size and alignment: bytes up to the next word
+   of the message and unaligned segments are written by the CPU, the rest
+   is fed by DMA with the multiple DMA transfer mode (MDMAT) so the digest
+   is only computed at the end of the message. Cipher segments must be
+   multiples of 16 bytes with word aligned input and output.
+   With a data cache, output buffers must be aligned on and a multiple of
+   the 32 byte cache line, or placed in a non cacheable region.
+
+5- CRYPTO_Stream_Benchmark() hashes a buffer with SHA-256 through the queue
+   and with the software fallback CRYPTO_SW_SHA256_xxx() and returns the
+   cycle counts of both. It polls, call it with the queue idle.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "crypto_stream.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  CRYPTO_JobTypeDef      *pHead;      /* Queued jobs, first is on going       */
+  CRYPTO_JobTypeDef      *pTail;
+  CRYPTO_SessionTypeDef  *pLoaded;    /* Session whose context is in the processor */
+  uint32_t               Segment;     /* Position in the on going job         */
+  uint32_t               Offset;
+  uint32_t               Chunk;       /* Bytes of the on going DMA transfer   */
+} CRYPTO_EngineTypeDef;
+
+/* Private define ------------------------------------------------------------*/
+#define CRYPTO_DMA_MAX_WORDS      0xFFFCU   /* Multiple of an AES block       */
+#define CRYPTO_HASH_BLOCK         64U
+#define CRYPTO_HASH_CONTEXT_REGS  38U       /* CSR0 to CSR37, HMAC mode unused */
+
+#define IS_CRYPTO_HASH(__ALGO__)  ((__ALGO__) <= CRYPTO_HASH_MD5)
+
+/* Private macro -------------------------------------------------------------*/
+#define CRYPTO_ROR(__X__, __N__)  (((__X__) >> (__N__)) | ((__X__) << (32U - (__N__))))
+
+/* Private variables ---------------------------------------------------------*/
+static DMA_HandleTypeDef     *hdmaHash;
+static DMA_HandleTypeDef     *hdmaIn;
+static DMA_HandleTypeDef     *hdmaOut;
+static CRYPTO_EngineTypeDef  HashEngine;
+static CRYPTO_EngineTypeDef  CipherEngine;
+
+static const uint32_t HashCr[4] =
+{
+  0U,                                 /* SHA-1   */
+  HASH_CR_ALGO_1,                     /* SHA-224 */
+  HASH_CR_ALGO_1 | HASH_CR_ALGO_0,    /* SHA-256 */
+  HASH_CR_ALGO_0                      /* MD5     */
+};
+
+static const uint8_t HashDigestSize[4] = { 20U, 28U, 32U, 16U };
+
+static const uint32_t CipherCr[5] =
+{
+  CRYP_CR_ALGOMODE_AES_ECB,
+  CRYP_CR_ALGOMODE_AES_ECB | CRYP_CR_ALGODIR,
+  CRYP_CR_ALGOMODE_AES_CBC,
+  CRYP_CR_ALGOMODE_AES_CBC | CRYP_CR_ALGODIR,
+  CRYP_CR_ALGOMODE_AES_CTR
+};
+
+static const uint32_t Sha256K[64] =
+{
+  0x428a2f98U, 0x71374491U, 0xb5c0fbcfU, 0xe9b5dba5U, 0x3956c25bU, 0x59f111f1U, 0x923f82a4U, 0xab1c5ed5U,
+  0xd807aa98U, 0x12835b01U, 0x243185beU, 0x550c7dc3U, 0x72be5d74U, 0x80deb1feU, 0x9bdc06a7U, 0xc19bf174U,
+  0xe49b69c1U, 0xefbe4786U, 0x0fc19dc6U, 0x240ca1ccU, 0x2de92c6fU, 0x4a7484aaU, 0x5cb0a9dcU, 0x76f988daU,
+  0x983e5152U, 0xa831c66dU, 0xb00327c8U, 0xbf597fc7U, 0xc6e00bf3U, 0xd5a79147U, 0x06ca6351U, 0x14292967U,
+  0x27b70a85U, 0x2e1b2138U, 0x4d2c6dfcU, 0x53380d13U, 0x650a7354U, 0x766a0abbU, 0x81c2c92eU, 0x92722c85U,
+  0xa2bfe8a1U, 0xa81a664bU, 0xc24b8b70U, 0xc76c51a3U, 0xd192e819U, 0xd6990624U, 0xf40e3585U, 0x106aa070U,
+  0x19a4c116U, 0x1e376c08U, 0x2748774cU, 0x34b0bcb5U, 0x391c0cb3U, 0x4ed8aa4aU, 0x5b9cca4fU, 0x682e6ff3U,
+  0x748f82eeU, 0x78a5636fU, 0x84c87814U, 0x8cc70208U, 0x90befffaU, 0xa4506cebU, 0xbef9a3f7U, 0xc67178f2U
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static void     CRYPTO_HashRun(void);
+static void     CRYPTO_HashLoad(CRYPTO_SessionTypeDef *pSession);
+static void     CRYPTO_HashFeed(CRYPTO_SessionTypeDef *pSession, const uint8_t *pData, uint32_t Size);
+static void     CRYPTO_HashFinish(CRYPTO_SessionTypeDef *pSession, uint8_t *pDigest);
+static void     CRYPTO_HashDmaCplt(DMA_HandleTypeDef *hdma);
+static void     CRYPTO_CipherRun(void);
+static void     CRYPTO_CipherLoad(CRYPTO_SessionTypeDef *pSession);
+static void     CRYPTO_CipherDmaCplt(DMA_HandleTypeDef *hdma);
+static void     CRYPTO_DmaError(DMA_HandleTypeDef *hdma);
+static void     CRYPTO_Complete(CRYPTO_EngineTypeDef *pEngine, HAL_StatusTypeDef Status);
+static uint32_t CRYPTO_LoadBE(const uint8_t *pData);
+static void     CRYPTO_StoreBE(uint8_t *pData, uint32_t Value);
+static void     CRYPTO_CacheClean(const void *pData, uint32_t Size);
+static void     CRYPTO_CacheInvalidate(void *pData, uint32_t Size);
+static void     CRYPTO_SW_SHA256_Block(CRYPTO_SW_SHA256TypeDef *pCtx, const uint8_t *pBlock);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Register the DMA streams of the HASH and CRYP processors
+  * @param  hdmaHashIn: HASH input stream
+  * @param  hdmaCrypIn: CRYP input stream
+  * @param  hdmaCrypOut: CRYP output stream
+  * @retval HAL status
+  */
+HAL_StatusTypeDef CRYPTO_Stream_Init(DMA_HandleTypeDef *hdmaHashIn, DMA_HandleTypeDef *hdmaCrypIn,
+                                     DMA_HandleTypeDef *hdmaCrypOut)
+{
+  if((hdmaHashIn == NULL) || (hdmaCrypIn == NULL) || (hdmaCrypOut == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  hdmaHash = hdmaHashIn;
+  hdmaIn   = hdmaCrypIn;
+  hdmaOut  = hdmaCrypOut;
+
+  hdmaHash->XferCpltCallback     = CRYPTO_HashDmaCplt;
+  hdmaHash->XferErrorCallback    = CRYPTO_DmaError;
+  hdmaHash->XferHalfCpltCallback = NULL;
+  hdmaIn->XferCpltCallback       = NULL;
+  hdmaIn->XferErrorCallback      = CRYPTO_DmaError;
+  hdmaIn->XferHalfCpltCallback   = NULL;
+  hdmaOut->XferCpltCallback      = CRYPTO_CipherDmaCplt;
+  hdmaOut->XferErrorCallback     = CRYPTO_DmaError;
+  hdmaOut->XferHalfCpltCallback  = NULL;
+
+  memset(&HashEngine, 0, sizeof(HashEngine));
+  memset(&CipherEngine, 0, sizeof(CipherEngine));
+
+  CRYP->CR = 0U;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Start a hash or HMAC stream
+  * @param  pSession: session to initialize
+  * @param  Algo: CRYPTO_HASH_xxx
+  * @param  pKey: HMAC key, NULL for a plain hash
+  * @param  KeySize: HMAC key size in bytes, 64 at most
+  * @retval HAL status
+  */
+HAL_StatusTypeDef CRYPTO_Stream_HashInit(CRYPTO_SessionTypeDef *pSession, CRYPTO_AlgoTypeDef Algo,
+                                         const uint8_t *pKey, uint32_t KeySize)
+{
+  uint8_t *block = (uint8_t *)pSession->Key;
+
+  if(!IS_CRYPTO_HASH(Algo) || (KeySize > CRYPTO_HASH_BLOCK))
+  {
+    return HAL_ERROR;
+  }
+
+  CRYPTO_Stream_Release(pSession);
+  memset(pSession, 0, sizeof(*pSession));
+  pSession->Algo = Algo;
+  pSession->Cr   = HashCr[Algo] | HASH_CR_DATATYPE_1;
+
+  if(pKey != NULL)
+  {
+    pSession->Hmac = 1U;
+    memcpy(block, pKey, KeySize);
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Start an AES stream
+  * @param  pSession: session to initialize
+  * @param  Algo: CRYPTO_AES_xxx
+  * @param  pKey: key
+  * @param  KeySize: 16, 24 or 32 bytes
+  * @param  pIv: initialization vector or initial counter block, unused in ECB
+  * @retval HAL status
+  */
+HAL_StatusTypeDef CRYPTO_Stream_CipherInit(CRYPTO_SessionTypeDef *pSession, CRYPTO_AlgoTypeDef Algo,
+                                           const uint8_t *pKey, uint32_t KeySize, const uint8_t *pIv)
+{
+  uint32_t i;
+  uint32_t first;
+
+  if(IS_CRYPTO_HASH(Algo) || (Algo > CRYPTO_AES_CTR) ||
+     ((KeySize != 16U) && (KeySize != 24U) && (KeySize != 32U)))
+  {
+    return HAL_ERROR;
+  }
+
+  CRYPTO_Stream_Release(pSession);
+  memset(pSession, 0, sizeof(*pSession));
+  pSession->Algo = Algo;
+  pSession->Cr   = CipherCr[Algo - CRYPTO_AES_ECB_ENCRYPT] | CRYP_CR_DATATYPE_1 |
+                   (((KeySize - 16U) / 8U) * CRYP_CR_KEYSIZE_0);
+
+  /* K0LR..K3RR, the key is right aligned */
+  first = (32U - KeySize) / 4U;
+  for(i = 0U; i < (KeySize / 4U); i++)
+  {
+    pSession->Key[first + i] = CRYPTO_LoadBE(&pKey[4U * i]);
+  }
+  if(pIv != NULL)
+  {
+    for(i = 0U; i < 4U; i++)
+    {
+      pSession->Iv[i] = CRYPTO_LoadBE(&pIv[4U * i]);
+    }
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Forget a session whose context may be held by a processor.
+  *         Call it before reusing the memory of an unterminated session.
+  * @param  pSession: session
+  * @retval None
+  */
+void CRYPTO_Stream_Release(CRYPTO_SessionTypeDef *pSession)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  if(HashEngine.pLoaded == pSession)
+  {
+    HashEngine.pLoaded = NULL;
+  }
+  if(CipherEngine.pLoaded == pSession)
+  {
+    CipherEngine.pLoaded = NULL;
+  }
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Queue a job, started at once when its processor is idle
+  * @param  pJob: job, owned by the module until its callback is called
+  * @retval HAL status
+  */
+HAL_StatusTypeDef CRYPTO_Stream_Submit(CRYPTO_JobTypeDef *pJob)
+{
+  CRYPTO_EngineTypeDef *engine;
+  uint32_t primask;
+
+  if((pJob == NULL) || (pJob->pSession == NULL) || (hdmaHash == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  engine = IS_CRYPTO_HASH(pJob->pSession->Algo) ? &HashEngine : &CipherEngine;
+  pJob->Status = HAL_BUSY;
+  pJob->pNext  = NULL;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if(engine->pHead == NULL)
+  {
+    engine->pHead   = pJob;
+    engine->pTail   = pJob;
+    engine->Segment = 0U;
+    engine->Offset  = 0U;
+    if(engine == &HashEngine)
+    {
+      CRYPTO_HashRun();
+    }
+    else
+    {
+      CRYPTO_CipherRun();
+    }
+  }
+  else
+  {
+    engine->pTail->pNext = pJob;
+    engine->pTail        = pJob;
+  }
+  __set_PRIMASK(primask);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Tell whether all the queued jobs are done
+  * @retval 1 when both processors are idle
+  */
+uint32_t CRYPTO_Stream_IsIdle(void)
+{
+  return ((HashEngine.pHead == NULL) && (CipherEngine.pHead == NULL)) ? 1U : 0U;
+}
+
+/**
+  * @brief  Compare the SHA-256 throughput of the HASH processor and of the
+  *         software fallback
+  * @param  pBuffer: data to hash, word aligned for the DMA
+  * @param  Size: size in bytes
+  * @param  pResult: cycle counts
+  * @retval HAL status
+  */
+HAL_StatusTypeDef CRYPTO_Stream_Benchmark(const uint8_t *pBuffer, uint32_t Size, CRYPTO_BenchmarkTypeDef *pResult)
+{
+  CRYPTO_SessionTypeDef   session;
+  CRYPTO_SegmentTypeDef   segment;
+  CRYPTO_JobTypeDef       job;
+  CRYPTO_SW_SHA256TypeDef sw;
+  uint8_t                 hw_digest[32];
+  uint8_t                 sw_digest[32];
+  uint32_t                start;
+
+  if(CRYPTO_Stream_IsIdle() == 0U)
+  {
+    return HAL_BUSY;
+  }
+
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#if (__CORTEX_M == 7U)
+  DWT->LAR = 0xC5ACCE55U;
+#endif
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  segment.pIn  = pBuffer;
+  segment.pOut = NULL;
+  segment.Size = Size;
+  memset(&job, 0, sizeof(job));
+  job.pSession   = &session;
+  job.pSegments  = &segment;
+  job.NbSegments = 1U;
+  job.pDigest    = hw_digest;
+  (void)CRYPTO_Stream_HashInit(&session, CRYPTO_HASH_SHA256, NULL, 0U);
+
+  start = DWT->CYCCNT;
+  if(CRYPTO_Stream_Submit(&job) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+  while(job.Status == HAL_BUSY)
+  {
+  }
+  pResult->HwCycles = DWT->CYCCNT - start;
+
+  start = DWT->CYCCNT;
+  CRYPTO_SW_SHA256_Init(&sw);
+  CRYPTO_SW_SHA256_Update(&sw, pBuffer, Size);
+  CRYPTO_SW_SHA256_Finish(&sw, sw_digest);
+  pResult->SwCycles = DWT->CYCCNT - start;
+  pResult->Size     = Size;
+
+  if((job.Status != HAL_OK) || (memcmp(hw_digest, sw_digest, sizeof(hw_digest)) != 0))
+  {
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Software SHA-256, used where the HASH processor is busy or absent
+  * @param  pCtx: context
+  * @retval None
+  */
+void CRYPTO_SW_SHA256_Init(CRYPTO_SW_SHA256TypeDef *pCtx)
+{
+  pCtx->State[0]  = 0x6a09e667U;
+  pCtx->State[1]  = 0xbb67ae85U;
+  pCtx->State[2]  = 0x3c6ef372U;
+  pCtx->State[3]  = 0xa54ff53aU;
+  pCtx->State[4]  = 0x510e527fU;
+  pCtx->State[5]  = 0x9b05688cU;
+  pCtx->State[6]  = 0x1f83d9abU;
+  pCtx->State[7]  = 0x5be0cd19U;
+  pCtx->Length    = 0U;
+  pCtx->BufferLen = 0U;
+}
+
+/**
+  * @brief  Software SHA-256 update
+  * @param  pCtx: context
+  * @param  pData: data
+  * @param  Size: size in bytes
+  * @retval None
+  */
+void CRYPTO_SW_SHA256_Update(CRYPTO_SW_SHA256TypeDef *pCtx, const uint8_t *pData, uint32_t Size)
+{
+  uint32_t n;
+
+  pCtx->Length += Size;
+  while(Size != 0U)
+  {
+    if((pCtx->BufferLen == 0U) && (Size >= CRYPTO_HASH_BLOCK))
+    {
+      CRYPTO_SW_SHA256_Block(pCtx, pData);
+      pData += CRYPTO_HASH_BLOCK;
+      Size  -= CRYPTO_HASH_BLOCK;
+      continue;
+    }
+    n = CRYPTO_HASH_BLOCK - pCtx->BufferLen;
+    n = (n < Size) ? n : Size;
+    memcpy(&pCtx->Buffer[pCtx->BufferLen], pData, n);
+    pCtx->BufferLen += n;
+    pData += n;
+    Size  -= n;
+    if(pCtx->BufferLen == CRYPTO_HASH_BLOCK)
+    {
+      CRYPTO_SW_SHA256_Block(pCtx, pCtx->Buffer);
+      pCtx->BufferLen = 0U;
+    }
+  }
+}
+
+/**
+  * @brief  Software SHA-256 final padding and digest
+  * @param  pCtx: context
+  * @param  pDigest: 32 bytes digest
+  * @retval None
+  */
+void CRYPTO_SW_SHA256_Finish(CRYPTO_SW_SHA256TypeDef *pCtx, uint8_t *pDigest)
+{
+  uint32_t i;
+  uint32_t bits = pCtx->Length * 8U;
+
+  pCtx->Buffer[pCtx->BufferLen++] = 0x80U;
+  if(pCtx->BufferLen > (CRYPTO_HASH_BLOCK - 8U))
+  {
+    memset(&pCtx->Buffer[pCtx->BufferLen], 0, CRYPTO_HASH_BLOCK - pCtx->BufferLen);
+    CRYPTO_SW_SHA256_Block(pCtx, pCtx->Buffer);
+    pCtx->BufferLen = 0U;
+  }
+  memset(&pCtx->Buffer[pCtx->BufferLen], 0, CRYPTO_HASH_BLOCK - 4U - pCtx->BufferLen);
+  CRYPTO_StoreBE(&pCtx->Buffer[CRYPTO_HASH_BLOCK - 4U], bits);
+  CRYPTO_SW_SHA256_Block(pCtx, pCtx->Buffer);
+
+  for(i = 0U; i < 8U; i++)
+  {
+    CRYPTO_StoreBE(&pDigest[4U * i], pCtx->State[i]);
+  }
+}
+
+/**
+  * @brief  Feed the on going hash job until a DMA transfer is started or the
+  *         job is done. Runs with the queue locked or from the DMA interrupt.
+  * @retval None
+  */
+static void CRYPTO_HashRun(void)
+{
+  CRYPTO_JobTypeDef     *job;
+  CRYPTO_SessionTypeDef *session;
+  const uint8_t         *data;
+  uint32_t              size;
+
+  while((job = HashEngine.pHead) != NULL)
+  {
+    session = job->pSession;
+    if((HashEngine.Segment == 0U) && (HashEngine.Offset == 0U) && (HashEngine.pLoaded != session))
+    {
+      CRYPTO_HashLoad(session);
+    }
+
+    while(HashEngine.Segment < job->NbSegments)
+    {
+      data = job->pSegments[HashEngine.Segment].pIn + HashEngine.Offset;
+      size = job->pSegments[HashEngine.Segment].Size - HashEngine.Offset;
+
+      /* Complete the pending word of the message with the CPU */
+      while((session->CarryLen != 0U) && (size != 0U))
+      {
+        CRYPTO_HashFeed(session, data, 1U);
+        data++;
+        size--;
+        HashEngine.Offset++;
+      }
+
+      if((size >= CRYPTO_STREAM_DMA_THRESHOLD) && (((uint32_t)data & 3U) == 0U))
+      {
+        size = (size / 4U > CRYPTO_DMA_MAX_WORDS) ? CRYPTO_DMA_MAX_WORDS : (size / 4U);
+        HashEngine.Chunk = size * 4U;
+        CRYPTO_CacheClean(data, HashEngine.Chunk);
+        HASH->CR |= HASH_CR_MDMAT;
+        if(HAL_DMA_Start_IT(hdmaHash, (uint32_t)data, (uint32_t)&HASH->DIN, size) != HAL_OK)
+        {
+          CRYPTO_Complete(&HashEngine, HAL_ERROR);
+          break;
+        }
+        HASH->CR |= HASH_CR_DMAE;
+        return;
+      }
+
+      CRYPTO_HashFeed(session, data, size);
+      HashEngine.Segment++;
+      HashEngine.Offset = 0U;
+    }
+
+    if(HashEngine.pHead == job)
+    {
+      if(job->pDigest != NULL)
+      {
+        CRYPTO_HashFinish(session, job->pDigest);
+      }
+      CRYPTO_Complete(&HashEngine, HAL_OK);
+    }
+  }
+}
+
+/**
+  * @brief  Swap the context of the HASH processor to a session
+  * @param  pSession: session of the next job
+  * @retval None
+  */
+static void CRYPTO_HashLoad(CRYPTO_SessionTypeDef *pSession)
+{
+  CRYPTO_SessionTypeDef *previous = HashEngine.pLoaded;
+  uint32_t i;
+  uint32_t ipad[CRYPTO_HASH_BLOCK / 4U];
+
+  if(previous != NULL)
+  {
+    while((HASH->SR & HASH_SR_BUSY) != 0U)
+    {
+    }
+    previous->Imr = HASH->IMR;
+    previous->Str = HASH->STR;
+    for(i = 0U; i < CRYPTO_HASH_CONTEXT_REGS; i++)
+    {
+      previous->Csr[i] = HASH->CSR[i];
+    }
+  }
+
+  if(pSession->Started != 0U)
+  {
+    HASH->IMR = pSession->Imr;
+    HASH->STR = pSession->Str;
+    HASH->CR  = pSession->Cr | HASH_CR_INIT;
+    for(i = 0U; i < CRYPTO_HASH_CONTEXT_REGS; i++)
+    {
+      HASH->CSR[i] = pSession->Csr[i];
+    }
+  }
+  else
+  {
+    HASH->IMR = 0U;
+    HASH->STR = 0U;
+    HASH->CR  = pSession->Cr | HASH_CR_INIT;
+    pSession->Started = 1U;
+    if(pSession->Hmac != 0U)
+    {
+      for(i = 0U; i < (CRYPTO_HASH_BLOCK / 4U); i++)
+      {
+        ipad[i] = pSession->Key[i] ^ 0x36363636U;
+      }
+      CRYPTO_HashFeed(pSession, (const uint8_t *)ipad, CRYPTO_HASH_BLOCK);
+    }
+  }
+
+  HashEngine.pLoaded = pSession;
+}
+
+/**
+  * @brief  Write message bytes to the HASH processor with the CPU
+  * @param  pSession: loaded session
+  * @param  pData: bytes, any alignment
+  * @param  Size: number of bytes
+  * @retval None
+  */
+static void CRYPTO_HashFeed(CRYPTO_SessionTypeDef *pSession, const uint8_t *pData, uint32_t Size)
+{
+  uint32_t word;
+
+  while((pSession->CarryLen != 0U) && (Size != 0U))
+  {
+    pSession->Carry |= (uint32_t)*pData++ << (8U * pSession->CarryLen);
+    Size--;
+    if(++pSession->CarryLen == 4U)
+    {
+      HASH->DIN = pSession->Carry;
+      pSession->Carry    = 0U;
+      pSession->CarryLen = 0U;
+    }
+  }
+
+  while(Size >= 4U)
+  {
+    memcpy(&word, pData, 4U);
+    HASH->DIN = word;
+    pData += 4U;
+    Size  -= 4U;
+  }
+
+  while(Size != 0U)
+  {
+    pSession->Carry |= (uint32_t)*pData++ << (8U * pSession->CarryLen);
+    pSession->CarryLen++;
+    Size--;
+  }
+}
+
+/**
+  * @brief  Pad the message, read the digest and run the HMAC outer hash
+  * @param  pSession: loaded session
+  * @param  pDigest: digest output
+  * @retval None
+  */
+static void CRYPTO_HashFinish(CRYPTO_SessionTypeDef *pSession, uint8_t *pDigest)
+{
+  uint32_t words = HashDigestSize[pSession->Algo] / 4U;
+  uint32_t pass  = (pSession->Hmac != 0U) ? 2U : 1U;
+  uint32_t opad[CRYPTO_HASH_BLOCK / 4U];
+  uint32_t i;
+
+  while(pass-- != 0U)
+  {
+    HASH->STR = 8U * pSession->CarryLen;
+    if(pSession->CarryLen != 0U)
+    {
+      HASH->DIN = pSession->Carry;
+    }
+    HASH->STR |= HASH_STR_DCAL;
+    while((HASH->SR & HASH_SR_DCIS) == 0U)
+    {
+    }
+
+    for(i = 0U; i < words; i++)
+    {
+      CRYPTO_StoreBE(&pDigest[4U * i], (i < 5U) ? HASH->HR[i] : HASH_DIGEST->HR[i]);
+    }
+
+    if(pass != 0U)
+    {
+      /* Outer hash: H((K ^ opad) || inner digest) */
+      for(i = 0U; i < (CRYPTO_HASH_BLOCK / 4U); i++)
+      {
+        opad[i] = pSession->Key[i] ^ 0x5C5C5C5CU;
+      }
+      HASH->CR = pSession->Cr | HASH_CR_INIT;
+      pSession->Carry    = 0U;
+      pSession->CarryLen = 0U;
+      CRYPTO_HashFeed(pSession, (const uint8_t *)opad, CRYPTO_HASH_BLOCK);
+      CRYPTO_HashFeed(pSession, pDigest, 4U * words);
+    }
+  }
+
+  pSession->Started  = 0U;
+  pSession->Carry    = 0U;
+  pSession->CarryLen = 0U;
+  HashEngine.pLoaded = NULL;
+}
+
+/**
+  * @brief  HASH input DMA transfer complete
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void CRYPTO_HashDmaCplt(DMA_HandleTypeDef *hdma)
+{
+  UNUSED(hdma);
+
+  HASH->CR &= ~HASH_CR_DMAE;
+  HashEngine.Offset += HashEngine.Chunk;
+  if(HashEngine.Offset == HashEngine.pHead->pSegments[HashEngine.Segment].Size)
+  {
+    HashEngine.Segment++;
+    HashEngine.Offset = 0U;
+  }
+  CRYPTO_HashRun();
+}
+
+/**
+  * @brief  Start the next DMA transfer of the on going cipher job, or end it.
+  *         Runs with the queue locked or from the DMA interrupt.
+  * @retval None
+  */
+static void CRYPTO_CipherRun(void)
+{
+  CRYPTO_JobTypeDef           *job;
+  CRYPTO_SessionTypeDef       *session;
+  const CRYPTO_SegmentTypeDef *segment;
+  uint32_t                    words;
+
+  while((job = CipherEngine.pHead) != NULL)
+  {
+    session = job->pSession;
+    if((CipherEngine.Segment == 0U) && (CipherEngine.Offset == 0U) && (CipherEngine.pLoaded != session))
+    {
+      CRYPTO_CipherLoad(session);
+    }
+
+    while(CipherEngine.Segment < job->NbSegments)
+    {
+      segment = &job->pSegments[CipherEngine.Segment];
+      if((CipherEngine.Offset == 0U) &&
+         (((segment->Size & 15U) != 0U) || ((((uint32_t)segment->pIn | (uint32_t)segment->pOut) & 3U) != 0U)))
+      {
+        CRYPTO_Complete(&CipherEngine, HAL_ERROR);
+        break;
+      }
+      if(CipherEngine.Offset == segment->Size)
+      {
+        CipherEngine.Segment++;
+        CipherEngine.Offset = 0U;
+        continue;
+      }
+
+      words = (segment->Size - CipherEngine.Offset) / 4U;
+      words = (words > CRYPTO_DMA_MAX_WORDS) ? CRYPTO_DMA_MAX_WORDS : words;
+      CipherEngine.Chunk = words * 4U;
+      CRYPTO_CacheClean(segment->pIn + CipherEngine.Offset, CipherEngine.Chunk);
+      CRYPTO_CacheInvalidate(segment->pOut + CipherEngine.Offset, CipherEngine.Chunk);
+
+      if((HAL_DMA_Start_IT(hdmaOut, (uint32_t)&CRYP->DOUT, (uint32_t)(segment->pOut + CipherEngine.Offset), words) != HAL_OK) ||
+         (HAL_DMA_Start_IT(hdmaIn, (uint32_t)(segment->pIn + CipherEngine.Offset), (uint32_t)&CRYP->DR, words) != HAL_OK))
+      {
+        (void)HAL_DMA_Abort(hdmaOut);
+        CRYPTO_Complete(&CipherEngine, HAL_ERROR);
+        break;
+      }
+      CRYP->DMACR = CRYP_DMACR_DIEN | CRYP_DMACR_DOEN;
+      CRYP->CR   |= CRYP_CR_CRYPEN;
+      return;
+    }
+
+    if(CipherEngine.pHead == job)
+    {
+      /* Keep the chained IV (CBC) or counter (CTR) in the session */
+      while((CRYP->SR & CRYP_SR_BUSY) != 0U)
+      {
+      }
+      CRYP->CR &= ~CRYP_CR_CRYPEN;
+      session->Iv[0] = CRYP->IV0LR;
+      session->Iv[1] = CRYP->IV0RR;
+      session->Iv[2] = CRYP->IV1LR;
+      session->Iv[3] = CRYP->IV1RR;
+      CRYPTO_Complete(&CipherEngine, HAL_OK);
+    }
+  }
+}
+
+/**
+  * @brief  Load the key and IV of a session in the CRYP processor
+  * @param  pSession: session of the next job
+  * @retval None
+  */
+static void CRYPTO_CipherLoad(CRYPTO_SessionTypeDef *pSession)
+{
+  CRYP->CR   = 0U;
+  CRYP->K0LR = pSession->Key[0];
+  CRYP->K0RR = pSession->Key[1];
+  CRYP->K1LR = pSession->Key[2];
+  CRYP->K1RR = pSession->Key[3];
+  CRYP->K2LR = pSession->Key[4];
+  CRYP->K2RR = pSession->Key[5];
+  CRYP->K3LR = pSession->Key[6];
+  CRYP->K3RR = pSession->Key[7];
+
+  if((pSession->Algo == CRYPTO_AES_ECB_DECRYPT) || (pSession->Algo == CRYPTO_AES_CBC_DECRYPT))
+  {
+    /* Decryption key schedule, not readable back: redone on each swap */
+    CRYP->CR = (pSession->Cr & ~(CRYP_CR_ALGOMODE | CRYP_CR_ALGODIR)) | CRYP_CR_ALGOMODE_AES_KEY | CRYP_CR_CRYPEN;
+    while((CRYP->SR & CRYP_SR_BUSY) != 0U)
+    {
+    }
+  }
+
+  CRYP->CR    = pSession->Cr;
+  CRYP->IV0LR = pSession->Iv[0];
+  CRYP->IV0RR = pSession->Iv[1];
+  CRYP->IV1LR = pSession->Iv[2];
+  CRYP->IV1RR = pSession->Iv[3];
+  CRYP->CR   |= CRYP_CR_FFLUSH;
+
+  CipherEngine.pLoaded = pSession;
+}
+
+/**
+  * @brief  CRYP output DMA transfer complete
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void CRYPTO_CipherDmaCplt(DMA_HandleTypeDef *hdma)
+{
+  const CRYPTO_SegmentTypeDef *segment = &CipherEngine.pHead->pSegments[CipherEngine.Segment];
+
+  UNUSED(hdma);
+
+  CRYP->DMACR = 0U;
+  CRYPTO_CacheInvalidate(segment->pOut + CipherEngine.Offset, CipherEngine.Chunk);
+  CipherEngine.Offset += CipherEngine.Chunk;
+  CRYPTO_CipherRun();
+}
+
+/**
+  * @brief  DMA error: fail the on going job and go on with the next one
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void CRYPTO_DmaError(DMA_HandleTypeDef *hdma)
+{
+  if(hdma == hdmaHash)
+  {
+    HASH->CR &= ~HASH_CR_DMAE;
+    CRYPTO_Complete(&HashEngine, HAL_ERROR);
+    CRYPTO_HashRun();
+  }
+  else
+  {
+    (void)HAL_DMA_Abort(hdmaIn);
+    (void)HAL_DMA_Abort(hdmaOut);
+    CRYP->DMACR = 0U;
+    CRYP->CR    = 0U;
+    CRYPTO_Complete(&CipherEngine, HAL_ERROR);
+    CRYPTO_CipherRun();
+  }
+}
+
+/**
+  * @brief  Dequeue the on going job and report it
+  * @param  pEngine: engine
+  * @param  Status: job status
+  * @retval None
+  */
+static void CRYPTO_Complete(CRYPTO_EngineTypeDef *pEngine, HAL_StatusTypeDef Status)
+{
+  CRYPTO_JobTypeDef *job = pEngine->pHead;
+
+  pEngine->pHead   = job->pNext;
+  pEngine->Segment = 0U;
+  pEngine->Offset  = 0U;
+  if(Status != HAL_OK)
+  {
+    /* The session context is lost with the failed message */
+    pEngine->pLoaded = NULL;
+    job->pSession->Started  = 0U;
+    job->pSession->CarryLen = 0U;
+    job->pSession->Carry    = 0U;
+  }
+
+  job->Status = Status;
+  if(job->Callback != NULL)
+  {
+    job->Callback(job);
+  }
+}
+
+/**
+  * @brief  Read a big endian word
+  * @param  pData: 4 bytes
+  * @retval word
+  */
+static uint32_t CRYPTO_LoadBE(const uint8_t *pData)
+{
+  return ((uint32_t)pData[0] << 24) | ((uint32_t)pData[1] << 16) | ((uint32_t)pData[2] << 8) | pData[3];
+}
+
+/**
+  * @brief  Write a big endian word
+  * @param  pData: 4 bytes
+  * @param  Value: word
+  * @retval None
+  */
+static void CRYPTO_StoreBE(uint8_t *pData, uint32_t Value)
+{
+  pData[0] = (uint8_t)(Value >> 24);
+  pData[1] = (uint8_t)(Value >> 16);
+  pData[2] = (uint8_t)(Value >> 8);
+  pData[3] = (uint8_t)Value;
+}
+
+/**
+  * @brief  Write back the data cache lines of a DMA source buffer
+  * @param  pData: buffer
+  * @param  Size: size in bytes
+  * @retval None
+  */
+static void CRYPTO_CacheClean(const void *pData, uint32_t Size)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    uint32_t start = (uint32_t)pData & ~31U;
+    SCB_CleanDCache_by_Addr((uint32_t *)start, (int32_t)(((uint32_t)pData + Size) - start));
+  }
+#else
+  UNUSED(pData);
+  UNUSED(Size);
+#endif
+}
+
+/**
+  * @brief  Drop the data cache lines of a DMA destination buffer
+  * @param  pData: buffer, cache line aligned
+  * @param  Size: size in bytes
+  * @retval None
+  */
+static void CRYPTO_CacheInvalidate(void *pData, uint32_t Size)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    SCB_InvalidateDCache_by_Addr((uint32_t *)pData, (int32_t)Size);
+  }
+#else
+  UNUSED(pData);
+  UNUSED(Size);
+#endif
+}
+
+/**
+  * @brief  Software SHA-256 compression of one block
+  * @param  pCtx: context
+  * @param  pBlock: 64 bytes
+  * @retval None
+  */
+static void CRYPTO_SW_SHA256_Block(CRYPTO_SW_SHA256TypeDef *pCtx, const uint8_t *pBlock)
+{
+  uint32_t w[64];
+  uint32_t a, b, c, d, e, f, g, h;
+  uint32_t t1, t2;
+  uint32_t i;
+
+  for(i = 0U; i < 16U; i++)
+  {
+    w[i] = CRYPTO_LoadBE(&pBlock[4U * i]);
+  }
+  for(i = 16U; i < 64U; i++)
+  {
+    t1 = CRYPTO_ROR(w[i - 2U], 17U) ^ CRYPTO_ROR(w[i - 2U], 19U) ^ (w[i - 2U] >> 10);
+    t2 = CRYPTO_ROR(w[i - 15U], 7U) ^ CRYPTO_ROR(w[i - 15U], 18U) ^ (w[i - 15U] >> 3);
+    w[i] = t1 + w[i - 7U] + t2 + w[i - 16U];
+  }
+
+  a = pCtx->State[0]; b = pCtx->State[1]; c = pCtx->State[2]; d = pCtx->State[3];
+  e = pCtx->State[4]; f = pCtx->State[5]; g = pCtx->State[6]; h = pCtx->State[7];
+
+  for(i = 0U; i < 64U; i++)
+  {
+    t1 = h + (CRYPTO_ROR(e, 6U) ^ CRYPTO_ROR(e, 11U) ^ CRYPTO_ROR(e, 25U)) + ((e & f) ^ (~e & g)) + Sha256K[i] + w[i];
+    t2 = (CRYPTO_ROR(a, 2U) ^ CRYPTO_ROR(a, 13U) ^ CRYPTO_ROR(a, 22U)) + ((a & b) ^ (a & c) ^ (b & c));
+    h = g; g = f; f = e; e = d + t1;
+    d = c; c = b; b = a; a = t1 + t2;
+  }
+
+  pCtx->State[0] += a; pCtx->State[1] += b; pCtx->State[2] += c; pCtx->State[3] += d;
+  pCtx->State[4] += e; pCtx->State[5] += f; pCtx->State[6] += g; pCtx->State[7] += h;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
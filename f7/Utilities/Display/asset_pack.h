@@ -0,0 +1,141 @@
+/**
+  ******************************************************************************
+  * @file    asset_pack.h
+  * @author  MCD Application Team
+  * @brief   Header for asset_pack module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _ASSET_PACK_H__
+#define _ASSET_PACK_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#if !defined(DMA2D)
+#error "asset_pack requires a device with the DMA2D"
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+/* Pack layout, little endian, built by Utilities/PC_Software/AssetPacker:
+   header, Count entries sorted by Code, then for each entry a strip table
+   of (strips + 1) offsets from the pack start followed by the strips. A
+   strip is StripLines lines of Width pixels without padding (A4: two pixels
+   per byte, first one in the low nibble), compressed on its own. */
+typedef struct
+{
+  uint32_t Magic;        /* ASSET_MAGIC                                     */
+  uint16_t Version;      /* ASSET_VERSION                                   */
+  uint16_t Count;        /* Number of entries                               */
+  uint16_t LineHeight;   /* Font line spacing, in lines                     */
+  uint16_t Ascent;       /* Font baseline from the top of a line            */
+} ASSET_HeaderTypeDef;
+
+typedef struct
+{
+  uint32_t Code;         /* Unicode code point, or ASSET_IMAGE(Id)          */
+  uint32_t Offset;       /* Strip table, from the pack start                */
+  uint16_t Width;        /* In pixels                                       */
+  uint16_t Height;       /* In lines                                        */
+  uint16_t StripLines;   /* Lines per strip, the last one may be shorter    */
+  uint8_t  Format;       /* ASSET_FORMAT_xxx                                */
+  uint8_t  Compression;  /* ASSET_COMPRESSION_xxx                           */
+  int8_t   BearingX;     /* Glyph left side from the pen position           */
+  int8_t   BearingY;     /* Glyph top above the baseline                    */
+  uint8_t  Advance;      /* Pen move after the glyph                        */
+  uint8_t  Reserved;
+} ASSET_EntryTypeDef;
+
+typedef struct
+{
+  const uint8_t            *pData;     /* Pack start, flash or memory-mapped QSPI */
+  const ASSET_EntryTypeDef *pEntries;
+  uint32_t                 Count;
+  uint32_t                 LineHeight;
+  uint32_t                 Ascent;
+} ASSET_PackTypeDef;
+
+typedef struct
+{
+  uint32_t Address;      /* Framebuffer address of pixel (0,0)             */
+  uint32_t ColorMode;    /* DMA2D_OUTPUT_RGB565 or DMA2D_OUTPUT_ARGB8888    */
+  uint32_t Pitch;        /* Framebuffer line length, in pixels             */
+  uint32_t Width;        /* Drawing area, assets outside are not drawn     */
+  uint32_t Height;
+} ASSET_TargetTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+#define ASSET_MAGIC                 0x4B505341U   /* "ASPK" */
+#define ASSET_VERSION               1U
+
+#define ASSET_FORMAT_A8             0U   /* Coverage, blended with a color  */
+#define ASSET_FORMAT_A4             1U
+#define ASSET_FORMAT_RGB565         2U   /* Copied                          */
+#define ASSET_FORMAT_ARGB8888       3U   /* Blended with its alpha          */
+
+#define ASSET_COMPRESSION_NONE      0U
+#define ASSET_COMPRESSION_RLE       1U   /* PackBits                        */
+#define ASSET_COMPRESSION_LZ4       2U   /* LZ4 block, one per strip        */
+
+/* Decoded strip size in bytes, multiple of 32: the packer --strip-size
+   must not be larger. Two strips are buffered. Override in main.h. */
+#if !defined(ASSET_STRIP_SIZE)
+#define ASSET_STRIP_SIZE            4096U
+#endif
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Code of the image packed with identifier __ID__, above the Unicode range */
+#define ASSET_IMAGE(__ID__)         (0x00110000U + (uint32_t)(__ID__))
+
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef        ASSET_Init(ASSET_PackTypeDef *pPack, const uint8_t *pData);
+const ASSET_EntryTypeDef *ASSET_Find(const ASSET_PackTypeDef *pPack, uint32_t Code);
+uint32_t                 ASSET_GetStripCount(const ASSET_EntryTypeDef *pEntry);
+uint32_t                 ASSET_Decode(const ASSET_PackTypeDef *pPack, const ASSET_EntryTypeDef *pEntry,
+                                      uint32_t Strip, uint8_t *pBuffer, uint32_t Size);
+HAL_StatusTypeDef        ASSET_Draw(const ASSET_PackTypeDef *pPack, const ASSET_EntryTypeDef *pEntry,
+                                    const ASSET_TargetTypeDef *pTarget, uint32_t Xpos, uint32_t Ypos, uint32_t Color);
+HAL_StatusTypeDef        ASSET_DrawString(const ASSET_PackTypeDef *pPack, const ASSET_TargetTypeDef *pTarget,
+                                          uint32_t Xpos, uint32_t Ypos, const char *pText, uint32_t Color);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _ASSET_PACK_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
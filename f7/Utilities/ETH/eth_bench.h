@@ -0,0 +1,152 @@
+/**
+  ******************************************************************************
+  * @file    eth_bench.h
+  * @author  MCD Application Team
+  * @brief   Header for eth_bench module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _ETH_BENCH_H__
+#define _ETH_BENCH_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#if !defined(HAL_ETH_MODULE_ENABLED)
+#error "eth_bench requires the HAL ETH driver"
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+/* Role of the board */
+#define ETH_BENCH_ROLE_GENERATOR   0U   /* Sends frames, times the ones reflected back */
+#define ETH_BENCH_ROLE_REFLECTOR   1U   /* Sends back the frames received              */
+
+/* Driver path measured, as started by the application */
+#define ETH_BENCH_MODE_POLLING     0U   /* HAL_ETH_Start(), descriptors polled         */
+#define ETH_BENCH_MODE_IT          1U   /* Receive interrupt, ETH_Bench_RxEvent() called
+                                           from HAL_ETH_RxCpltCallback()              */
+
+/* Frame sizes, destination address to the end of the payload, FCS excluded */
+#define ETH_BENCH_FRAME_MIN        60U
+#define ETH_BENCH_FRAME_MAX        1514U
+
+/* EtherType of the benchmark frames: IEEE local experimental. Override in main.h. */
+#if !defined(ETH_BENCH_ETHERTYPE)
+#define ETH_BENCH_ETHERTYPE        0x88B5U
+#endif
+
+/* Time the generator waits for the last frames reflected, in ms. Override in main.h. */
+#if !defined(ETH_BENCH_DRAIN_MS)
+#define ETH_BENCH_DRAIN_MS         20U
+#endif
+
+/* Latency histogram: bin 0 counts round trips shorter than 2^ETH_BENCH_HIST_SHIFT
+   ns, bin n round trips of 2^(ETH_BENCH_HIST_SHIFT+n-1) ns or more, the last
+   bin has no upper bound. Override in main.h. */
+#if !defined(ETH_BENCH_HIST_BINS)
+#define ETH_BENCH_HIST_BINS        16U
+#endif
+#if !defined(ETH_BENCH_HIST_SHIFT)
+#define ETH_BENCH_HIST_SHIFT       10U
+#endif
+
+/* 1: the ETH interrupt cycles counted by the CPU profiler of cpu_utils
+   (CPU_ProfileIrqEnter/Exit around HAL_ETH_IRQHandler()) are added to the CPU
+   load. Override in main.h. */
+#if !defined(ETH_BENCH_PROFILER)
+#define ETH_BENCH_PROFILER         0U
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  ETH_HandleTypeDef         *heth;              /* Initialized and started                        */
+  uint32_t                  Role;               /* ETH_BENCH_ROLE_xxx                             */
+  uint32_t                  Mode;               /* ETH_BENCH_MODE_xxx                             */
+  uint32_t                  FrameSize;          /* ETH_BENCH_FRAME_MIN to ETH_BENCH_FRAME_MAX     */
+  uint32_t                  Rate;               /* Frames per second sent, 0 for line rate        */
+  uint32_t                  Duration;           /* Run time in ms                                 */
+  uint8_t                   PeerAddr[6];        /* Destination of the generator frames            */
+} ETH_Bench_ConfigTypeDef;
+
+typedef struct
+{
+  uint32_t                  TxFrames;           /* Frames sent                                    */
+  uint32_t                  RxFrames;           /* Benchmark frames received                      */
+  uint32_t                  Lost;               /* Generator: frames not reflected back           */
+  uint32_t                  Reordered;          /* Generator: frames back out of sequence         */
+  uint32_t                  Ignored;            /* Other frames received                          */
+  uint32_t                  TxBusy;             /* Sends delayed, no Tx descriptor free           */
+  uint32_t                  Errors;             /* Driver errors, frames over one Rx buffer       */
+  uint32_t                  TxFps;              /* Frames sent per second                         */
+  uint32_t                  RxFps;              /* Frames received per second                     */
+  uint32_t                  RxKbps;             /* Received throughput, FCS excluded, in kbit/s  */
+  uint32_t                  CpuLoad;            /* CPU time spent in the driver, in 1/1000        */
+  uint32_t                  LatencyMin;         /* Generator round trip, in ns                    */
+  uint32_t                  LatencyMax;
+  uint32_t                  LatencyMean;
+  uint32_t                  LatencyHist[ETH_BENCH_HIST_BINS];
+} ETH_Bench_ResultTypeDef;
+
+typedef struct
+{
+  ETH_Bench_ConfigTypeDef   Config;
+  ETH_Bench_ResultTypeDef   Result;
+  __IO uint32_t             RxEvents;           /* Receive interrupts not yet served              */
+  uint32_t                  TxSequence;         /* Sequence number of the next frame sent         */
+  uint32_t                  RxSequence;         /* Next sequence number expected back             */
+  uint64_t                  LatencySum;         /* Round trips, in cycles                         */
+  uint64_t                  RxBytes;            /* Benchmark bytes received                       */
+  uint64_t                  BusyCycles;         /* Cycles spent sending and receiving             */
+} ETH_BenchTypeDef;
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef ETH_Bench_Init(ETH_BenchTypeDef *hbench, const ETH_Bench_ConfigTypeDef *pConfig);
+HAL_StatusTypeDef ETH_Bench_Run(ETH_BenchTypeDef *hbench, ETH_Bench_ResultTypeDef *pResult);
+uint32_t          ETH_Bench_Report(const ETH_BenchTypeDef *hbench, char *pBuffer, uint32_t Size);
+
+void ETH_Bench_RxEvent(ETH_BenchTypeDef *hbench);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _ETH_BENCH_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,146 @@
+/**
+  ******************************************************************************
+  * @file    ptp_clock.h
+  * @author  MCD Application Team
+  * @brief   Header for ptp_clock module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _PTP_CLOCK_H__
+#define _PTP_CLOCK_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#if !defined(HAL_ETH_MODULE_ENABLED)
+#error "ptp_clock requires the HAL ETH driver"
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+/* Servo states returned by PTP_Clock_ServoSample() */
+#define PTP_CLOCK_SERVO_UNLOCKED  0U   /* Frequency tracking, offset out of the lock window */
+#define PTP_CLOCK_SERVO_STEPPED   1U   /* Offset above StepThreshold, time stepped          */
+#define PTP_CLOCK_SERVO_LOCKED    2U   /* PTP_CLOCK_LOCK_SAMPLES offsets in the lock window */
+
+/* Frequency correction range in ppb. Override in main.h. */
+#if !defined(PTP_CLOCK_MAX_PPB)
+#define PTP_CLOCK_MAX_PPB         500000
+#endif
+
+/* Default PI gains in 1/1024 units, for one sample per second. Override in main.h. */
+#if !defined(PTP_CLOCK_KP)
+#define PTP_CLOCK_KP              717
+#endif
+#if !defined(PTP_CLOCK_KI)
+#define PTP_CLOCK_KI              307
+#endif
+
+/* Default offset above which the time is stepped, in ns. Override in main.h. */
+#if !defined(PTP_CLOCK_STEP_NS)
+#define PTP_CLOCK_STEP_NS         1000000
+#endif
+
+/* Lock window in ns, and consecutive offsets in it to report the lock. Override in main.h. */
+#if !defined(PTP_CLOCK_LOCK_NS)
+#define PTP_CLOCK_LOCK_NS         1000
+#endif
+#if !defined(PTP_CLOCK_LOCK_SAMPLES)
+#define PTP_CLOCK_LOCK_SAMPLES    4U
+#endif
+
+/* Polling loops for the MAC to take an addend or a time update. Override in main.h. */
+#if !defined(PTP_CLOCK_UPDATE_LOOPS)
+#define PTP_CLOCK_UPDATE_LOOPS    10000U
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t                  Seconds;
+  uint32_t                  NanoSeconds;        /* 0 to 999999999                                 */
+} PTP_Clock_TimeTypeDef;
+
+typedef struct
+{
+  ETH_HandleTypeDef         *heth;              /* Initialized with HAL_ETH_Init()                */
+  uint32_t                  ClockHz;            /* PTP reference clock, 0 for HCLK                */
+  uint32_t                  RxAllFrames;        /* 1: all received frames timestamped, 0: PTP
+                                                   event messages only                            */
+  uint32_t                  TxTimestamps;       /* 1: all sent frames timestamped                 */
+  int32_t                   Kp;                 /* Proportional gain in 1/1024, 0 for PTP_CLOCK_KP */
+  int32_t                   Ki;                 /* Integral gain in 1/1024, 0 for PTP_CLOCK_KI    */
+  uint32_t                  StepThreshold;      /* Offset stepped in ns, 0 for PTP_CLOCK_STEP_NS  */
+} PTP_Clock_ConfigTypeDef;
+
+typedef struct
+{
+  PTP_Clock_ConfigTypeDef   Config;
+  uint32_t                  Increment;          /* Sub-second increment in ns                     */
+  uint32_t                  BaseAddend;         /* Addend of the nominal frequency                */
+  int32_t                   FreqPpb;            /* Frequency correction applied                   */
+  int64_t                   Integral;           /* Servo integral term, ppb in 1/1024             */
+  uint32_t                  State;              /* PTP_CLOCK_SERVO_xxx                            */
+  uint32_t                  InWindow;           /* Consecutive offsets in the lock window         */
+  uint32_t                  Samples;            /* PTP_Clock_ServoSample() calls                  */
+  uint32_t                  Steps;              /* Time steps                                     */
+  uint32_t                  Timeouts;           /* Updates not taken by the MAC in time           */
+} PTP_ClockTypeDef;
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef PTP_Clock_Init(PTP_ClockTypeDef *hptp, const PTP_Clock_ConfigTypeDef *pConfig,
+                                 const PTP_Clock_TimeTypeDef *pTime);
+HAL_StatusTypeDef PTP_Clock_GetTime(PTP_ClockTypeDef *hptp, PTP_Clock_TimeTypeDef *pTime);
+HAL_StatusTypeDef PTP_Clock_SetTime(PTP_ClockTypeDef *hptp, const PTP_Clock_TimeTypeDef *pTime);
+HAL_StatusTypeDef PTP_Clock_AdjustTime(PTP_ClockTypeDef *hptp, int64_t OffsetNs);
+HAL_StatusTypeDef PTP_Clock_AdjustFreq(PTP_ClockTypeDef *hptp, int32_t Ppb);
+uint32_t          PTP_Clock_ServoSample(PTP_ClockTypeDef *hptp, int64_t OffsetNs);
+void              PTP_Clock_ServoReset(PTP_ClockTypeDef *hptp);
+HAL_StatusTypeDef PTP_Clock_ConfigPPS(PTP_ClockTypeDef *hptp, uint32_t FreqLog2);
+
+HAL_StatusTypeDef PTP_Clock_StampToTime(uint64_t TimeStamp, PTP_Clock_TimeTypeDef *pTime);
+HAL_StatusTypeDef PTP_Clock_GetTxTimestamp(const ETH_DMADescTypeDef *pLastDesc, PTP_Clock_TimeTypeDef *pTime);
+int64_t           PTP_Clock_Diff(const PTP_Clock_TimeTypeDef *pTimeA, const PTP_Clock_TimeTypeDef *pTimeB);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _PTP_CLOCK_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
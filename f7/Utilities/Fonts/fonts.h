@@ -78,6 +78,15 @@ extern sFONT Font20;
 extern sFONT Font16;
 extern sFONT Font12;
 extern sFONT Font8;
+
+typedef struct
+{
+  sFONT    *pFont;       /* Font the glyphs were converted from              */
+  uint8_t  *pData;       /* Glyphs from ' ' to '~', GlyphSize bytes each     */
+  uint32_t ColorMode;    /* FONT_ATLAS_A8 or FONT_ATLAS_A4                   */
+  uint32_t GlyphSize;    /* Size in bytes of one glyph                       */
+
+} FONT_AtlasTypeDef;
 /**
   * @}
   */ 
@@ -87,6 +96,15 @@ extern sFONT Font8;
   */ 
 #define LINE(x) ((x) * (((sFONT *)BSP_LCD_GetFont())->Height))
 
+/* Glyph atlas pixel formats */
+#define FONT_ATLAS_A8           0U   /* One coverage byte per pixel   */
+#define FONT_ATLAS_A4           1U   /* Two coverage pixels per byte  */
+
+/* Characters held by a glyph atlas */
+#define FONT_ATLAS_FIRST_CHAR   ' '
+#define FONT_ATLAS_LAST_CHAR    '~'
+#define FONT_ATLAS_CHAR_COUNT   (FONT_ATLAS_LAST_CHAR - FONT_ATLAS_FIRST_CHAR + 1)
+
 /**
   * @}
   */ 
@@ -94,6 +112,14 @@ extern sFONT Font8;
 /** @defgroup FONTS_Exported_Macros
   * @{
   */ 
+/* Size in bytes of one glyph and of the glyph atlas of a font */
+#define FONT_ATLAS_GLYPH_SIZE(__FONT__, __MODE__) \
+  (((__MODE__) == FONT_ATLAS_A4) ? \
+   ((((uint32_t)(__FONT__)->Width * (__FONT__)->Height) + 1U) / 2U) : \
+   ((uint32_t)(__FONT__)->Width * (__FONT__)->Height))
+
+#define FONT_ATLAS_SIZE(__FONT__, __MODE__) \
+  (FONT_ATLAS_GLYPH_SIZE((__FONT__), (__MODE__)) * FONT_ATLAS_CHAR_COUNT)
 /**
   * @}
   */ 
@@ -101,6 +127,8 @@ extern sFONT Font8;
 /** @defgroup FONTS_Exported_Functions
   * @{
   */ 
+void           FONT_AtlasInit(FONT_AtlasTypeDef *pAtlas, sFONT *pFont, uint8_t *pData, uint32_t ColorMode);
+const uint8_t *FONT_AtlasGetGlyph(FONT_AtlasTypeDef *pAtlas, uint8_t Ascii);
 /**
   * @}
   */
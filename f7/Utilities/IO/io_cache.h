@@ -0,0 +1,99 @@
+/**
+  ******************************************************************************
+  * @file    io_cache.h
+  * @author  MCD Application Team
+  * @brief   Header for io_cache module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _IO_CACHE_H__
+#define _IO_CACHE_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#if !defined(HAL_I2C_MODULE_ENABLED)
+#error "io_cache requires the HAL I2C driver (HAL_I2C_MODULE_ENABLED)"
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+/* One per expander, owned by the module from IO_Cache_Init() on */
+typedef struct
+{
+  I2C_HandleTypeDef   *hi2c;
+  uint16_t            Address;     /* 8-bit address as the HAL, IO_I2C_ADDRESS      */
+  uint16_t            Expander;    /* IO_CACHE_MFXSTM32L152, STMPE1600 or STMPE811  */
+  uint32_t            Output;      /* Levels requested by IO_Cache_WritePin()       */
+  uint32_t            Written;     /* Levels last sent to the expander              */
+  uint32_t            Dirty;       /* Pins written since the last flush             */
+  __IO uint32_t       Input;       /* Levels at the last refresh                    */
+  __IO uint32_t       Changed;     /* Pins interrupted, read by IO_Cache_GetChanged */
+  __IO uint32_t       Stale;       /* Expander interrupt not yet served             */
+  uint32_t            Transfers;   /* I2C transactions                              */
+  uint32_t            Errors;      /* I2C transactions failed                       */
+} IO_CacheTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+#define IO_CACHE_MFXSTM32L152     0U   /* 24 pins: IO_PIN_0 to IO_PIN_23  */
+#define IO_CACHE_STMPE1600        1U   /* 16 pins                         */
+#define IO_CACHE_STMPE811         2U   /* 8 pins                          */
+
+/* I2C transaction timeout in ms. Override in main.h. */
+#if !defined(IO_CACHE_TIMEOUT)
+#define IO_CACHE_TIMEOUT          10U
+#endif
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef IO_Cache_Init(IO_CacheTypeDef *pCache, I2C_HandleTypeDef *hi2c, uint16_t Address,
+                                uint32_t Expander);
+void              IO_Cache_WritePin(IO_CacheTypeDef *pCache, uint32_t IoPin, uint32_t PinState);
+void              IO_Cache_TogglePin(IO_CacheTypeDef *pCache, uint32_t IoPin);
+uint32_t          IO_Cache_ReadPin(IO_CacheTypeDef *pCache, uint32_t IoPin);
+uint32_t          IO_Cache_GetChanged(IO_CacheTypeDef *pCache);
+HAL_StatusTypeDef IO_Cache_Process(IO_CacheTypeDef *pCache);
+HAL_StatusTypeDef IO_Cache_Flush(IO_CacheTypeDef *pCache);
+HAL_StatusTypeDef IO_Cache_Refresh(IO_CacheTypeDef *pCache);
+
+void IO_Cache_IRQHandler(IO_CacheTypeDef *pCache);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _IO_CACHE_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -70,6 +70,13 @@
 /** @defgroup LCD_LOG_Private_Types
 * @{
 */ 
+#if (LCD_LOG_USE_QUEUE == 1)
+typedef struct
+{
+  uint32_t ch;      /* Character, LCD_QUEUE_VALID set once written */
+  uint32_t color;   /* Line color when the character was written   */
+}LCD_LOG_QueueEntry;
+#endif
 /**
 * @}
 */ 
@@ -86,6 +93,12 @@
 /* Define the display window settings */
 #define     YWINDOW_MIN         4
 
+/* Marks a text zone line whose content is unknown */
+#define     LCD_LINE_INVALID    0xFFFF
+
+/* Marks a written queue entry, so that a null character can be queued */
+#define     LCD_QUEUE_VALID     0x100U
+
 /** @defgroup LCD_LOG_Private_Macros
 * @{
 */ 
@@ -113,6 +126,20 @@ FunctionalState LCD_Lock;
 FunctionalState LCD_Scrolled;
 uint16_t LCD_ScrollBackStep;
 
+#if (LCD_LOG_USE_DMA2D == 1)
+/* Cache line sequence, and cache line and sequence drawn on each text line */
+static uint16_t LCD_CacheBuffer_seq[LCD_CACHE_DEPTH];
+static uint16_t LCD_Shown_idx[YWINDOW_SIZE];
+static uint16_t LCD_Shown_seq[YWINDOW_SIZE];
+static DMA2D_HandleTypeDef LCD_Dma2dHandle;
+#endif
+
+#if (LCD_LOG_USE_QUEUE == 1)
+static LCD_LOG_QueueEntry LCD_Queue[LCD_LOG_QUEUE_SIZE];
+static __IO uint32_t LCD_QueueHead;
+static __IO uint32_t LCD_QueueTail;
+#endif
+
 /**
 * @}
 */ 
@@ -121,6 +148,12 @@ uint16_t LCD_ScrollBackStep;
 /** @defgroup LCD_LOG_Private_FunctionPrototypes
 * @{
 */ 
+static void LCD_LOG_PutChar(int ch, uint32_t color);
+static void LCD_LOG_DrawLine(uint16_t row, uint16_t index);
+#if (LCD_LOG_USE_DMA2D == 1)
+static void LCD_LOG_InvalidateLines(void);
+static ErrorStatus LCD_LOG_ScrollUp(void);
+#endif
 
 /**
 * @}
@@ -167,6 +200,15 @@ void LCD_LOG_DeInit(void)
   LCD_Lock = DISABLE;
   LCD_Scrolled = DISABLE;
   LCD_ScrollBackStep = 0;
+
+#if (LCD_LOG_USE_DMA2D == 1)
+  LCD_LOG_InvalidateLines();
+#endif
+
+#if (LCD_LOG_USE_QUEUE == 1)
+  LCD_QueueHead = 0;
+  LCD_QueueTail = 0;
+#endif
 }
 
 /**
@@ -242,7 +284,68 @@ void LCD_LOG_ClearTextZone(void)
  */
 LCD_LOG_PUTCHAR
 {
+#if (LCD_LOG_USE_QUEUE == 1)
+  uint32_t head;
+  
+  /* Reserve an entry, the character is dropped when the queue is full */
+  do
+  {
+    head = __LDREXW(&LCD_QueueHead);
+    if((head - LCD_QueueTail) >= LCD_LOG_QUEUE_SIZE)
+    {
+      __CLREX();
+      return ch;
+    }
+  } while(__STREXW(head + 1, &LCD_QueueHead) != 0);
   
+  LCD_Queue[head & (LCD_LOG_QUEUE_SIZE - 1)].color = LCD_LineColor;
+  __DMB();
+  LCD_Queue[head & (LCD_LOG_QUEUE_SIZE - 1)].ch = ((uint32_t)ch & 0xFF) | LCD_QUEUE_VALID;
+#else
+  LCD_LOG_PutChar(ch, LCD_LineColor);
+#endif
+  return ch;
+}
+
+#if (LCD_LOG_USE_QUEUE == 1)
+/**
+  * @brief  Draw the queued characters on the LCD
+  * @note   To be called from a single task, the display is only accessed here
+  * @param  None
+  * @retval None
+  */
+void LCD_LOG_Process(void)
+{
+  LCD_LOG_QueueEntry *entry;
+  
+  while(LCD_QueueTail != LCD_QueueHead)
+  {
+    entry = &LCD_Queue[LCD_QueueTail & (LCD_LOG_QUEUE_SIZE - 1)];
+    
+    /* Entry reserved but not written yet */
+    if(entry->ch == 0)
+    {
+      break;
+    }
+    __DMB();
+    
+    LCD_LOG_PutChar((int)(entry->ch & 0xFF), entry->color);
+    
+    entry->ch = 0;
+    __DMB();
+    LCD_QueueTail++;
+  }
+}
+#endif /* LCD_LOG_USE_QUEUE */
+
+/**
+  * @brief  Add a character to the LCD cache and update the display on a new line
+  * @param  ch: character to be displayed
+  * @param  color: color of the line when the character ends it
+  * @retval None
+  */
+static void LCD_LOG_PutChar(int ch, uint32_t color)
+{
   sFONT *cFont = BSP_LCD_GetFont();
   uint32_t idx;
   
@@ -286,7 +389,10 @@ LCD_LOG_PUTCHAR
       {
         LCD_CacheBuffer[LCD_CacheBuffer_yptr_bottom].line[LCD_CacheBuffer_xptr++] = ' ';
       }   
-      LCD_CacheBuffer[LCD_CacheBuffer_yptr_bottom].color = LCD_LineColor;  
+      LCD_CacheBuffer[LCD_CacheBuffer_yptr_bottom].color = color;  
+#if (LCD_LOG_USE_DMA2D == 1)
+      LCD_CacheBuffer_seq[LCD_CacheBuffer_yptr_bottom]++;
+#endif
       
       LCD_CacheBuffer_xptr = 0;
       
@@ -308,7 +414,6 @@ LCD_LOG_PUTCHAR
       
     }
   }
-  return ch;
 }
   
 /**
@@ -325,9 +430,7 @@ void LCD_LOG_UpdateDisplay (void)
   if((LCD_CacheBuffer_yptr_bottom  < (YWINDOW_SIZE -1)) && 
      (LCD_CacheBuffer_yptr_bottom  >= LCD_CacheBuffer_yptr_top))
   {
-    BSP_LCD_SetTextColor(LCD_CacheBuffer[cnt + LCD_CacheBuffer_yptr_bottom].color);
-    BSP_LCD_DisplayStringAtLine ((YWINDOW_MIN + LCD_CacheBuffer_yptr_bottom),
-                           (uint8_t *)(LCD_CacheBuffer[cnt + LCD_CacheBuffer_yptr_bottom].line));
+    LCD_LOG_DrawLine(LCD_CacheBuffer_yptr_bottom, cnt + LCD_CacheBuffer_yptr_bottom);
   }
   else
   {
@@ -344,20 +447,128 @@ void LCD_LOG_UpdateDisplay (void)
     
     ptr = length - YWINDOW_SIZE + 1;
     
+#if (LCD_LOG_USE_DMA2D == 1)
+    /* When the text moved up by one line, move the drawn lines with DMA2D */
+    for  (cnt = 0 ; cnt < (YWINDOW_SIZE - 1) ; cnt ++)
+    {
+      index = (cnt + ptr )% LCD_CACHE_DEPTH ;
+      
+      if((LCD_Shown_idx[cnt + 1] != index) ||
+         (LCD_Shown_seq[cnt + 1] != LCD_CacheBuffer_seq[index]))
+      {
+        break;
+      }
+    }
+    
+    if((cnt == (YWINDOW_SIZE - 1)) && (cnt != 0) && (LCD_LOG_ScrollUp() == SUCCESS))
+    {
+      for  (cnt = 0 ; cnt < (YWINDOW_SIZE - 1) ; cnt ++)
+      {
+        LCD_Shown_idx[cnt] = LCD_Shown_idx[cnt + 1];
+        LCD_Shown_seq[cnt] = LCD_Shown_seq[cnt + 1];
+      }
+      LCD_Shown_idx[YWINDOW_SIZE - 1] = LCD_LINE_INVALID;
+    }
+#endif
+    
     for  (cnt = 0 ; cnt < YWINDOW_SIZE ; cnt ++)
     {
       
       index = (cnt + ptr )% LCD_CACHE_DEPTH ;
       
-      BSP_LCD_SetTextColor(LCD_CacheBuffer[index].color);
-      BSP_LCD_DisplayStringAtLine ((cnt + YWINDOW_MIN), 
-                             (uint8_t *)(LCD_CacheBuffer[index].line));
+      LCD_LOG_DrawLine(cnt, index);
       
     }
   }
   
 }
 
+/**
+  * @brief  Draw one cache line on a line of the text zone
+  * @param  row: line of the text zone
+  * @param  index: line of the LCD cache
+  * @retval None
+  */
+static void LCD_LOG_DrawLine(uint16_t row, uint16_t index)
+{
+#if (LCD_LOG_USE_DMA2D == 1)
+  /* Skip the lines already drawn */
+  if((LCD_Shown_idx[row] == index) && 
+     (LCD_Shown_seq[row] == LCD_CacheBuffer_seq[index]))
+  {
+    return;
+  }
+  LCD_Shown_idx[row] = index;
+  LCD_Shown_seq[row] = LCD_CacheBuffer_seq[index];
+#endif
+  
+  BSP_LCD_SetTextColor(LCD_CacheBuffer[index].color);
+  BSP_LCD_DisplayStringAtLine ((row + YWINDOW_MIN), 
+                         (uint8_t *)(LCD_CacheBuffer[index].line));
+}
+
+#if (LCD_LOG_USE_DMA2D == 1)
+/**
+  * @brief  Forget the lines drawn on the text zone, so that all get redrawn
+  * @param  None
+  * @retval None
+  */
+static void LCD_LOG_InvalidateLines(void)
+{
+  uint16_t cnt;
+  
+  for  (cnt = 0 ; cnt < YWINDOW_SIZE ; cnt ++)
+  {
+    LCD_Shown_idx[cnt] = LCD_LINE_INVALID;
+  }
+}
+
+/**
+  * @brief  Move the text zone up by one text line with a DMA2D transfer
+  * @param  None
+  * @retval Status
+  */
+static ErrorStatus LCD_LOG_ScrollUp(void)
+{
+  /* Bytes per pixel of the LTDC pixel formats */
+  static const uint8_t bytes_per_pixel[8] = {4, 3, 2, 2, 2, 1, 1, 2};
+  LTDC_Layer_TypeDef *layer = (LCD_LOG_LAYER == 0) ? LTDC_Layer1 : LTDC_Layer2;
+  uint32_t format = layer->PFCR & LTDC_LxPFCR_PF;
+  uint32_t pitch = (layer->CFBLR & LTDC_LxCFBLR_CFBP) >> LTDC_LxCFBLR_CFBP_Pos;
+  uint32_t xsize = BSP_LCD_GetXSize();
+  uint32_t address;
+  
+  /* DMA2D output is limited to the direct color formats */
+  if((format > DMA2D_OUTPUT_ARGB4444) || (pitch < (xsize * bytes_per_pixel[format])))
+  {
+    return ERROR;
+  }
+  
+  address = layer->CFBAR + (LINE(YWINDOW_MIN) * pitch);
+  
+  LCD_Dma2dHandle.Instance = DMA2D;
+  LCD_Dma2dHandle.Init.Mode = DMA2D_M2M;
+  LCD_Dma2dHandle.Init.ColorMode = format;
+  LCD_Dma2dHandle.Init.OutputOffset = (pitch / bytes_per_pixel[format]) - xsize;
+  LCD_Dma2dHandle.LayerCfg[1].AlphaMode = DMA2D_NO_MODIF_ALPHA;
+  LCD_Dma2dHandle.LayerCfg[1].InputAlpha = 0xFF;
+  LCD_Dma2dHandle.LayerCfg[1].InputColorMode = format;
+  LCD_Dma2dHandle.LayerCfg[1].InputOffset = LCD_Dma2dHandle.Init.OutputOffset;
+  
+  /* The source is below the destination, the forward copy keeps it intact */
+  if((HAL_DMA2D_Init(&LCD_Dma2dHandle) != HAL_OK) ||
+     (HAL_DMA2D_ConfigLayer(&LCD_Dma2dHandle, 1) != HAL_OK) ||
+     (HAL_DMA2D_Start(&LCD_Dma2dHandle, address + (LINE(1) * pitch), address,
+                      xsize, LINE(YWINDOW_SIZE - 1)) != HAL_OK) ||
+     (HAL_DMA2D_PollForTransfer(&LCD_Dma2dHandle, 100) != HAL_OK))
+  {
+    return ERROR;
+  }
+  
+  return SUCCESS;
+}
+#endif /* LCD_LOG_USE_DMA2D */
+
 #if( LCD_SCROLL_ENABLED == 1)
 /**
   * @brief  Display previous text frame
@@ -0,0 +1,359 @@
+/**
+  ******************************************************************************
+  * @file    mdios_regfile.c
+  * @author  MCD Application Team
+  * @brief   MDIO slave register file kept in sync with a shadow block
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- initialize the MDIOS with HAL_MDIOS_Init() (port address, preamble
+   check). With WriteIrq, call MDIOS_RegFile_IRQHandler() from the MDIOS
+   interrupt handler in place of HAL_MDIOS_IRQHandler(); the wake up from
+   Stop by the MDIOS stays with the application.
+
+2- MDIOS_RegFile_Init() takes the shadow block, MDIOS_REGFILE_REGS values
+   the application writes at any time, and MDIOS_RegFile_Start() loads it
+   in the output registers. The master reads these registers directly from
+   the MDIOS: the read interrupt is left off, no read waits for the CPU and
+   a fast polling master costs no CPU time.
+
+3- MDIOS_RegFile_Process(), called on a schedule (timer, task), does all
+   the work in one pass :
+     - the registers written by the master since the last call are read
+       and their flags cleared, the ones in EchoMask copied to pShadow
+     - the shadow registers changed since the last call are written to the
+       output registers (MDIOS_RegFile_Sync() does only this part)
+     - MDIOS_RegFile_WriteCallback() gets the registers written as one
+       mask, their values in In[]: one event per batch of writes, the last
+       value of a register written twice between two calls
+   MDIOS_RegFile_Set() writes one register to pShadow and to the MDIOS at
+   once, ex. for a link status which must be seen before the next call.
+
+4- with WriteIrq, the first write of a batch raises an interrupt, which
+   masks the write interrupt up to the next MDIOS_RegFile_Process() and
+   calls MDIOS_RegFile_WriteEventCallback(), ex. to wake the task calling
+   MDIOS_RegFile_Process() up. Without WriteIrq, no MDIOS interrupt is used.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "mdios_regfile.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define MDIOS_REGFILE_STATE_RESET    0U
+#define MDIOS_REGFILE_STATE_READY    1U
+#define MDIOS_REGFILE_STATE_RUNNING  2U
+
+#define MDIOS_REGFILE_ERRORS      (MDIOS_SR_PERF | MDIOS_SR_SERF | MDIOS_SR_TERF)
+
+/* Private macro -------------------------------------------------------------*/
+/* Input and output data registers, n from 0 to 31 */
+#define MDIOS_REGFILE_DIN(__MDIOS__, __N__)   ((&(__MDIOS__)->DINR0)[(__N__)])
+#define MDIOS_REGFILE_DOUT(__MDIOS__, __N__)  ((&(__MDIOS__)->DOUTR0)[(__N__)])
+
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Bind a shadow register block to the MDIOS
+  * @param  pFile: register file context, kept by the module
+  * @param  pConfig: MDIOS and shadow block, copied
+  * @retval HAL status
+  */
+HAL_StatusTypeDef MDIOS_RegFile_Init(MDIOS_RegFileTypeDef *pFile, const MDIOS_RegFile_ConfigTypeDef *pConfig)
+{
+  uint32_t i;
+
+  if ((pFile == NULL) || (pConfig == NULL) || (pConfig->hmdios == NULL) || (pConfig->pShadow == NULL) ||
+      ((pConfig->EchoMask & ~pConfig->WriteMask) != 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  pFile->Config   = *pConfig;
+  pFile->Pending  = 0U;
+  pFile->Syncs    = 0U;
+  pFile->Batches  = 0U;
+  pFile->Writes   = 0U;
+  pFile->Rejected = 0U;
+  pFile->Errors   = 0U;
+  for (i = 0U; i < MDIOS_REGFILE_REGS; i++)
+  {
+    pFile->Out[i] = 0U;
+    pFile->In[i]  = 0U;
+  }
+  pFile->State = MDIOS_REGFILE_STATE_READY;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Load the shadow block in the output registers and serve the master
+  * @param  pFile: register file context
+  * @retval HAL status
+  */
+HAL_StatusTypeDef MDIOS_RegFile_Start(MDIOS_RegFileTypeDef *pFile)
+{
+  MDIOS_TypeDef *mdios;
+  uint32_t i;
+
+  if ((pFile == NULL) || (pFile->State != MDIOS_REGFILE_STATE_READY))
+  {
+    return HAL_ERROR;
+  }
+  mdios = pFile->Config.hmdios->Instance;
+
+  /* Reads served by the hardware, errors polled */
+  __HAL_MDIOS_DISABLE_IT(pFile->Config.hmdios, MDIOS_IT_READ | MDIOS_IT_ERROR | MDIOS_IT_WRITE);
+  for (i = 0U; i < MDIOS_REGFILE_REGS; i++)
+  {
+    pFile->Out[i] = pFile->Config.pShadow[i];
+    MDIOS_REGFILE_DOUT(mdios, i) = pFile->Out[i];
+  }
+  mdios->CRDFR  = 0xFFFFFFFFU;
+  mdios->CWRFR  = 0xFFFFFFFFU;
+  mdios->CLRFR  = MDIOS_REGFILE_ERRORS;
+  pFile->Pending = 0U;
+  pFile->State   = MDIOS_REGFILE_STATE_RUNNING;
+
+  if (pFile->Config.WriteIrq != 0U)
+  {
+    __HAL_MDIOS_ENABLE_IT(pFile->Config.hmdios, MDIOS_IT_WRITE);
+  }
+  __HAL_MDIOS_ENABLE(pFile->Config.hmdios);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the service, the MDIOS keeps answering with the last values
+  * @param  pFile: register file context
+  * @retval HAL status
+  */
+HAL_StatusTypeDef MDIOS_RegFile_Stop(MDIOS_RegFileTypeDef *pFile)
+{
+  if ((pFile == NULL) || (pFile->State != MDIOS_REGFILE_STATE_RUNNING))
+  {
+    return HAL_ERROR;
+  }
+  __HAL_MDIOS_DISABLE_IT(pFile->Config.hmdios, MDIOS_IT_WRITE);
+  pFile->Pending = 0U;
+  pFile->State   = MDIOS_REGFILE_STATE_READY;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Collect the writes of the master and synchronize the output
+  *         registers with the shadow block
+  * @param  pFile: register file context
+  * @retval Registers written by the master since the last call, in WriteMask
+  */
+uint32_t MDIOS_RegFile_Process(MDIOS_RegFileTypeDef *pFile)
+{
+  MDIOS_TypeDef *mdios;
+  uint32_t written;
+  uint32_t errors;
+  uint32_t mask;
+  uint32_t i;
+
+  if ((pFile == NULL) || (pFile->State != MDIOS_REGFILE_STATE_RUNNING))
+  {
+    return 0U;
+  }
+  mdios = pFile->Config.hmdios->Instance;
+
+  /* Flags cleared before the values are read: a register written again
+     in between is seen with its new value, now or at the next call */
+  written = mdios->WRFR;
+  if (written != 0U)
+  {
+    mdios->CWRFR = written;
+    for (i = 0U; i < MDIOS_REGFILE_REGS; i++)
+    {
+      if ((written & (1UL << i)) != 0U)
+      {
+        pFile->In[i] = (uint16_t)MDIOS_REGFILE_DIN(mdios, i);
+        if ((pFile->Config.EchoMask & (1UL << i)) != 0U)
+        {
+          pFile->Config.pShadow[i] = pFile->In[i];
+        }
+      }
+    }
+  }
+
+  errors = mdios->SR & MDIOS_REGFILE_ERRORS;
+  if (errors != 0U)
+  {
+    mdios->CLRFR = errors;
+    pFile->Errors++;
+  }
+
+  (void)MDIOS_RegFile_Sync(pFile);
+
+  if (pFile->Pending != 0U)
+  {
+    pFile->Pending = 0U;
+    __HAL_MDIOS_ENABLE_IT(pFile->Config.hmdios, MDIOS_IT_WRITE);
+  }
+
+  mask = written & pFile->Config.WriteMask;
+  for (i = written & ~pFile->Config.WriteMask; i != 0U; i &= i - 1U)
+  {
+    pFile->Rejected++;
+  }
+  if (mask != 0U)
+  {
+    for (i = mask; i != 0U; i &= i - 1U)
+    {
+      pFile->Writes++;
+    }
+    pFile->Batches++;
+    MDIOS_RegFile_WriteCallback(pFile, mask);
+  }
+
+  return mask;
+}
+
+/**
+  * @brief  Write the shadow registers changed to the output registers
+  * @param  pFile: register file context
+  * @retval Number of registers updated
+  */
+uint32_t MDIOS_RegFile_Sync(MDIOS_RegFileTypeDef *pFile)
+{
+  MDIOS_TypeDef *mdios;
+  uint32_t count = 0U;
+  uint16_t value;
+  uint32_t i;
+
+  if ((pFile == NULL) || (pFile->State != MDIOS_REGFILE_STATE_RUNNING))
+  {
+    return 0U;
+  }
+  mdios = pFile->Config.hmdios->Instance;
+
+  for (i = 0U; i < MDIOS_REGFILE_REGS; i++)
+  {
+    value = pFile->Config.pShadow[i];
+    if (value != pFile->Out[i])
+    {
+      pFile->Out[i] = value;
+      MDIOS_REGFILE_DOUT(mdios, i) = value;
+      count++;
+    }
+  }
+  pFile->Syncs += count;
+
+  return count;
+}
+
+/**
+  * @brief  Write a register to the shadow block and to the MDIOS at once
+  * @param  pFile: register file context
+  * @param  Reg: register, from 0 to 31
+  * @param  Value: value read by the master
+  * @retval HAL status
+  */
+HAL_StatusTypeDef MDIOS_RegFile_Set(MDIOS_RegFileTypeDef *pFile, uint32_t Reg, uint16_t Value)
+{
+  if ((pFile == NULL) || (Reg >= MDIOS_REGFILE_REGS) || (pFile->State == MDIOS_REGFILE_STATE_RESET))
+  {
+    return HAL_ERROR;
+  }
+  pFile->Config.pShadow[Reg] = Value;
+  if (pFile->State == MDIOS_REGFILE_STATE_RUNNING)
+  {
+    pFile->Out[Reg] = Value;
+    MDIOS_REGFILE_DOUT(pFile->Config.hmdios->Instance, Reg) = Value;
+    pFile->Syncs++;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  MDIOS interrupt, with WriteIrq: first write of a batch
+  * @param  pFile: register file context
+  * @retval None
+  */
+void MDIOS_RegFile_IRQHandler(MDIOS_RegFileTypeDef *pFile)
+{
+  if ((__HAL_MDIOS_GET_IT_SOURCE(pFile->Config.hmdios, MDIOS_IT_WRITE) != 0U) &&
+      (pFile->Config.hmdios->Instance->WRFR != 0U))
+  {
+    /* Following writes left to MDIOS_RegFile_Process() */
+    __HAL_MDIOS_DISABLE_IT(pFile->Config.hmdios, MDIOS_IT_WRITE);
+    pFile->Pending = 1U;
+    MDIOS_RegFile_WriteEventCallback(pFile);
+  }
+}
+
+/**
+  * @brief  First write of a batch, with WriteIrq
+  * @param  pFile: register file context
+  * @note   Called from the interrupt: schedule MDIOS_RegFile_Process().
+  * @retval None
+  */
+__weak void MDIOS_RegFile_WriteEventCallback(MDIOS_RegFileTypeDef *pFile)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(pFile);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the MDIOS_RegFile_WriteEventCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Batch of writes of the master
+  * @param  pFile: register file context
+  * @param  Mask: registers written, bit n for register n, values in In[]
+  * @note   Called from MDIOS_RegFile_Process().
+  * @retval None
+  */
+__weak void MDIOS_RegFile_WriteCallback(MDIOS_RegFileTypeDef *pFile, uint32_t Mask)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(pFile);
+  UNUSED(Mask);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the MDIOS_RegFile_WriteCallback could be implemented in the user file
+   */
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,105 @@
+/**
+  ******************************************************************************
+  * @file    mdios_regfile.h
+  * @author  MCD Application Team
+  * @brief   Header for mdios_regfile module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _MDIOS_REGFILE_H__
+#define _MDIOS_REGFILE_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#if !defined(HAL_MDIOS_MODULE_ENABLED)
+#error "mdios_regfile requires the HAL MDIOS driver"
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+/* Registers of the MDIO slave */
+#define MDIOS_REGFILE_REGS        32U
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  MDIOS_HandleTypeDef       *hmdios;            /* Initialized with HAL_MDIOS_Init()              */
+  uint16_t                  *pShadow;           /* MDIOS_REGFILE_REGS values read by the master,
+                                                   written by the application                     */
+  uint32_t                  WriteMask;          /* Registers the master may write, bit n for
+                                                   register n                                     */
+  uint32_t                  EchoMask;           /* Registers written copied to pShadow, read back
+                                                   by the master as written                       */
+  uint32_t                  WriteIrq;           /* 1: one interrupt per batch of writes, 0: writes
+                                                   only polled by MDIOS_RegFile_Process()         */
+} MDIOS_RegFile_ConfigTypeDef;
+
+typedef struct
+{
+  MDIOS_RegFile_ConfigTypeDef Config;
+  __IO uint32_t             State;
+  __IO uint32_t             Pending;            /* Batch of writes signalled by the interrupt     */
+  uint16_t                  Out[MDIOS_REGFILE_REGS];  /* Values in the output registers          */
+  uint16_t                  In[MDIOS_REGFILE_REGS];   /* Last values written by the master       */
+  uint32_t                  Syncs;              /* Output registers updated                       */
+  uint32_t                  Batches;            /* MDIOS_RegFile_WriteCallback() calls            */
+  uint32_t                  Writes;             /* Registers written, counted once per batch      */
+  uint32_t                  Rejected;           /* Writes to registers out of WriteMask           */
+  uint32_t                  Errors;             /* Preamble, start and turnaround errors          */
+} MDIOS_RegFileTypeDef;
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef MDIOS_RegFile_Init(MDIOS_RegFileTypeDef *pFile, const MDIOS_RegFile_ConfigTypeDef *pConfig);
+HAL_StatusTypeDef MDIOS_RegFile_Start(MDIOS_RegFileTypeDef *pFile);
+HAL_StatusTypeDef MDIOS_RegFile_Stop(MDIOS_RegFileTypeDef *pFile);
+uint32_t          MDIOS_RegFile_Process(MDIOS_RegFileTypeDef *pFile);
+uint32_t          MDIOS_RegFile_Sync(MDIOS_RegFileTypeDef *pFile);
+HAL_StatusTypeDef MDIOS_RegFile_Set(MDIOS_RegFileTypeDef *pFile, uint32_t Reg, uint16_t Value);
+
+void MDIOS_RegFile_IRQHandler(MDIOS_RegFileTypeDef *pFile);
+
+void MDIOS_RegFile_WriteEventCallback(MDIOS_RegFileTypeDef *pFile);
+void MDIOS_RegFile_WriteCallback(MDIOS_RegFileTypeDef *pFile, uint32_t Mask);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _MDIOS_REGFILE_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,282 @@
+#!/usr/bin/env python3
+#
+# Asset packer for Utilities/Display/asset_pack
+#
+# Renders the glyphs of a TrueType font and converts images into the pack
+# layout read by asset_pack.c: header, entries sorted by code, then for each
+# entry a strip table and the strips, each strip compressed on its own.
+#
+# COPYRIGHT(c) 2019 STMicroelectronics
+
+import argparse
+import struct
+import sys
+
+from PIL import Image, ImageFont
+
+ASSET_MAGIC = 0x4B505341
+ASSET_VERSION = 1
+ASSET_IMAGE_BASE = 0x110000
+
+FORMATS = {'A8': 0, 'A4': 1, 'RGB565': 2, 'ARGB8888': 3}
+BYTES_PER_PIXEL = {'A8': 1.0, 'A4': 0.5, 'RGB565': 2.0, 'ARGB8888': 4.0}
+COMPRESSIONS = {'none': 0, 'rle': 1, 'lz4': 2}
+
+HEADER = struct.Struct('<IHHHH')
+ENTRY = struct.Struct('<IIHHHBBbbBB')
+
+
+def compress_rle(data):
+    """PackBits: control < 128 is followed by control + 1 literal bytes,
+    otherwise the next byte is repeated control - 125 times (3 to 130)."""
+    out = bytearray()
+    literals = bytearray()
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and run < 130 and data[i + run] == data[i]:
+            run += 1
+        if run >= 3:
+            while literals:
+                out.append(min(len(literals), 128) - 1)
+                out += literals[:128]
+                literals = literals[128:]
+            out += bytes((run + 125, data[i]))
+            i += run
+        else:
+            literals.append(data[i])
+            i += 1
+    while literals:
+        out.append(min(len(literals), 128) - 1)
+        out += literals[:128]
+        literals = literals[128:]
+    return bytes(out)
+
+
+def _lz4_length(out, length):
+    while length >= 255:
+        out.append(255)
+        length -= 255
+    out.append(length)
+
+
+def compress_lz4(data):
+    """Greedy LZ4 block compressor. Follows the block rules: the last 5 bytes
+    are literals and no match starts in the last 12 bytes."""
+    out = bytearray()
+    table = {}
+    anchor = 0
+    i = 0
+    match_limit = len(data) - 12
+    while i < match_limit:
+        key = data[i:i + 4]
+        candidate = table.get(key)
+        table[key] = i
+        if candidate is None or i - candidate > 0xFFFF:
+            i += 1
+            continue
+        length = 4
+        while i + length < len(data) - 5 and data[candidate + length] == data[i + length]:
+            length += 1
+        literal = i - anchor
+        token = (min(literal, 15) << 4) | min(length - 4, 15)
+        out.append(token)
+        if literal >= 15:
+            _lz4_length(out, literal - 15)
+        out += data[anchor:i]
+        out += struct.pack('<H', i - candidate)
+        if length - 4 >= 15:
+            _lz4_length(out, length - 4 - 15)
+        i += length
+        anchor = i
+    literal = len(data) - anchor
+    out.append(min(literal, 15) << 4)
+    if literal >= 15:
+        _lz4_length(out, literal - 15)
+    out += data[anchor:]
+    return bytes(out)
+
+
+def compress(data, method):
+    if method == 'auto':
+        candidates = [(len(c), COMPRESSIONS[m], c) for m, c in
+                      (('none', data), ('rle', compress_rle(data)), ('lz4', compress_lz4(data)))]
+        return min(candidates, key=lambda c: (c[0], c[1]))[1:]
+    if method == 'rle':
+        return COMPRESSIONS['rle'], compress_rle(data)
+    if method == 'lz4':
+        return COMPRESSIONS['lz4'], compress_lz4(data)
+    return COMPRESSIONS['none'], data
+
+
+def pixels(image, fmt):
+    """Pixel data of an image, lines without padding."""
+    if fmt == 'A8':
+        return image.convert('L').tobytes()
+    if fmt == 'A4':
+        values = image.convert('L').tobytes()
+        nibbles = [v >> 4 for v in values]
+        if len(nibbles) & 1:
+            nibbles.append(0)
+        return bytes(nibbles[k] | (nibbles[k + 1] << 4) for k in range(0, len(nibbles), 2))
+    if fmt == 'RGB565':
+        rgb = image.convert('RGB').tobytes()
+        return b''.join(struct.pack('<H', ((rgb[k] >> 3) << 11) | ((rgb[k + 1] >> 2) << 5) | (rgb[k + 2] >> 3))
+                        for k in range(0, len(rgb), 3))
+    rgba = image.convert('RGBA').tobytes()
+    return b''.join(bytes((rgba[k + 2], rgba[k + 1], rgba[k], rgba[k + 3])) for k in range(0, len(rgba), 4))
+
+
+def strip_lines(width, height, fmt, strip_size):
+    if width == 0 or height == 0:
+        return 0
+    lines = int(strip_size // (width * BYTES_PER_PIXEL[fmt]))
+    # A4 strips start on a byte: an odd width needs an even line count
+    if fmt == 'A4' and (width & 1) and lines < height:
+        lines &= ~1
+    if lines == 0:
+        sys.exit('error: %d pixels wide asset does not fit the strip size' % width)
+    return min(lines, height)
+
+
+class Asset:
+    def __init__(self, code, image, fmt, bearing_x=0, bearing_y=0, advance=0):
+        self.code = code
+        self.image = image
+        self.fmt = fmt
+        self.bearing_x = bearing_x
+        self.bearing_y = bearing_y
+        self.advance = advance
+
+
+def load_glyphs(args):
+    font = ImageFont.truetype(args.font, args.size)
+    ascent, descent = font.getmetrics()
+    chars = set(args.chars)
+    if args.chars_file:
+        with open(args.chars_file, encoding='utf-8') as f:
+            chars |= set(f.read())
+    chars.discard('\n')
+    glyphs = []
+    for char in sorted(chars):
+        advance = int(round(font.getlength(char)))
+        left, top, right, bottom = font.getbbox(char, anchor='ls')
+        width, height = max(0, right - left), max(0, bottom - top)
+        image = Image.new('L', (width, height), 0)
+        if width and height:
+            image.paste(font.getmask(char, mode='L', anchor='ls'), (0, 0))
+        if not (-128 <= left < 128 and -128 <= -top < 128 and advance < 256):
+            sys.exit('error: glyph U+%04X metrics do not fit the entry' % ord(char))
+        glyphs.append(Asset(ord(char), image, args.glyph_format, left, -top, advance))
+    return glyphs, ascent + descent + args.line_gap, ascent
+
+
+def load_images(args):
+    images = []
+    for spec in args.image:
+        ident, _, path = spec.partition('=')
+        path, _, fmt = path.partition(':')
+        fmt = fmt.upper() or 'RGB565'
+        if fmt not in FORMATS or fmt == 'A4':
+            sys.exit('error: image format %s is not supported' % fmt)
+        images.append(Asset(ASSET_IMAGE_BASE + int(ident, 0), Image.open(path), fmt))
+    return images
+
+
+def build(assets, line_height, ascent, strip_size, method):
+    assets = sorted(assets, key=lambda a: a.code)
+    if len(set(a.code for a in assets)) != len(assets):
+        sys.exit('error: duplicate asset code')
+    blob = bytearray(HEADER.pack(ASSET_MAGIC, ASSET_VERSION, len(assets), line_height, ascent))
+    entries_offset = len(blob)
+    blob += bytes(ENTRY.size * len(assets))
+    stats = {}
+    for index, asset in enumerate(assets):
+        width, height = asset.image.size
+        lines = strip_lines(width, height, asset.fmt, strip_size)
+        data = pixels(asset.image, asset.fmt) if lines else b''
+        chunks = []
+        compression = COMPRESSIONS['none']
+        if lines:
+            line_bytes = width * BYTES_PER_PIXEL[asset.fmt]
+            for first in range(0, height, lines):
+                start = int(first * line_bytes)
+                end = int(min(first + lines, height) * line_bytes + 0.5)
+                chunks.append(data[start:end])
+            # One compression for all the strips of an asset, the smallest total
+            if method == 'auto':
+                sizes = {m: sum(len(compress(c, m)[1]) for c in chunks) for m in ('none', 'rle', 'lz4')}
+                chosen = min(sizes, key=lambda m: (sizes[m], COMPRESSIONS[m]))
+            else:
+                chosen = method
+            compression = COMPRESSIONS[chosen]
+            chunks = [compress(c, chosen)[1] for c in chunks]
+            stats[chosen] = stats.get(chosen, 0) + 1
+        while len(blob) & 3:
+            blob.append(0)
+        table = len(blob)
+        offset = table + 4 * (len(chunks) + 1)
+        offsets = [offset]
+        for chunk in chunks:
+            offset += len(chunk)
+            offsets.append(offset)
+        blob += b''.join(struct.pack('<I', o) for o in offsets) if chunks else b''
+        for chunk in chunks:
+            blob += chunk
+        ENTRY.pack_into(blob, entries_offset + index * ENTRY.size, asset.code, table if chunks else 0,
+                        width, height, lines, FORMATS[asset.fmt], compression,
+                        asset.bearing_x, asset.bearing_y, asset.advance, 0)
+    while len(blob) & 3:
+        blob.append(0)
+    return bytes(blob), stats
+
+
+def write_c_array(path, name, blob):
+    with open(path, 'w') as f:
+        f.write('/* Generated by asset_packer.py, %d bytes */\n' % len(blob))
+        f.write('#include <stdint.h>\n\n')
+        f.write('const uint8_t %s[%d] __attribute__((aligned(4))) =\n{\n' % (name, len(blob)))
+        for k in range(0, len(blob), 16):
+            f.write('  ' + ', '.join('0x%02X' % b for b in blob[k:k + 16]) + ',\n')
+        f.write('};\n')
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Build an asset pack for asset_pack.c')
+    parser.add_argument('-o', '--output', required=True, help='pack file (.bin, or .c with --c-array)')
+    parser.add_argument('--font', help='TrueType font')
+    parser.add_argument('--size', type=int, default=16, help='font size in pixels')
+    parser.add_argument('--chars', default=''.join(chr(c) for c in range(0x20, 0x7F)),
+                        help='characters to render, default printable ASCII')
+    parser.add_argument('--chars-file', help='UTF-8 text file, its characters are added')
+    parser.add_argument('--glyph-format', choices=('A4', 'A8'), default='A4')
+    parser.add_argument('--line-gap', type=int, default=0, help='added to the font line height')
+    parser.add_argument('--image', action='append', default=[], metavar='ID=FILE[:FORMAT]',
+                        help='image drawn with ASSET_IMAGE(ID), FORMAT A8, RGB565 (default) or ARGB8888')
+    parser.add_argument('--strip-size', type=int, default=4096,
+                        help='decoded strip size, not larger than ASSET_STRIP_SIZE')
+    parser.add_argument('--compression', choices=('auto', 'none', 'rle', 'lz4'), default='auto')
+    parser.add_argument('--c-array', metavar='NAME', help='output a C array instead of a binary')
+    args = parser.parse_args()
+
+    assets = []
+    line_height = ascent = 0
+    if args.font:
+        glyphs, line_height, ascent = load_glyphs(args)
+        assets += glyphs
+    assets += load_images(args)
+    if not assets:
+        parser.error('nothing to pack, give --font and/or --image')
+
+    blob, stats = build(assets, line_height, ascent, args.strip_size, args.compression)
+    if args.c_array:
+        write_c_array(args.output, args.c_array, blob)
+    else:
+        with open(args.output, 'wb') as f:
+            f.write(blob)
+    print('%d assets, %d bytes, compression %s' %
+          (len(assets), len(blob), ', '.join('%s: %d' % s for s in sorted(stats.items()))))
+
+
+if __name__ == '__main__':
+    main()
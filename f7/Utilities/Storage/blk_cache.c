@@ -0,0 +1,527 @@
+/**
+  ******************************************************************************
+  * @file    blk_cache.c
+  * @author  MCD Application Team
+  * @brief   Block device sector cache with write-back
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- in the linker script place the block buffers in SDRAM or AXI SRAM :
+      .blk_cache (NOLOAD) : { KEEP(*(.blk_cache)) } >SDRAM
+
+2- size the cache in main.h with BLK_CACHE_LINES (one line per 512-byte block)
+   and, when the cache is shared by an interrupt and a task, define
+   BLK_CACHE_LOCK()/BLK_CACHE_UNLOCK()
+
+3- describe the device with a BLK_DeviceTypeDef (see blk_sd.c for the BSP SD
+   driver) and call BLK_Cache_Init()
+
+4- use BLK_Cache_Read()/BLK_Cache_Write() everywhere the device was accessed
+   directly: USB MSC storage callbacks, file system disk I/O, loggers. All of
+   them then see the same data in the same order.
+
+5- call BLK_Cache_Process() periodically: blocks left dirty for more than
+   BLK_CACHE_FLUSH_DELAY ms are written back, which bounds the data lost on a
+   surprise removal. Call BLK_Cache_Flush() before unmount, eject or reset.
+
+6- on a power-fail warning (e.g. from HAL_PWR_PVDCallback()) call
+   BLK_Cache_PowerFail(): every dirty block is written back at once and the
+   cache switches to write-through until BLK_Cache_PowerRestore() is called.
+
+Writes hit the cache and are only sent to the device on eviction, on flush or
+when they get older than BLK_CACHE_FLUSH_DELAY; the line evicted is the least
+recently used one. Dirty blocks are always written back in ascending block
+order. Transfers of BLK_CACHE_BYPASS_BLOCKS blocks or more go straight to the
+device so that large file copies do not evict the file system metadata; the
+cache is kept coherent with them.
+
+When the device moves data by DMA, the device driver is in charge of the
+D-cache maintenance of the buffers it is given; the block buffers are aligned
+on a D-cache line and are a whole number of lines long.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "blk_cache.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  uint32_t Block;       /* Device block held by the line                */
+  uint32_t Stamp;       /* Value of BlkStamp at the last access         */
+  uint32_t DirtyTick;   /* HAL_GetTick() when the line became dirty     */
+  uint32_t Flags;       /* BLK_LINE_xxx                                 */
+} BLK_LineTypeDef;
+
+/* Private define ------------------------------------------------------------*/
+#define BLK_LINE_VALID   0x01U
+#define BLK_LINE_DIRTY   0x02U
+
+/* Private macro -------------------------------------------------------------*/
+#define BLK_IS_DIRTY(__LINE__)  (((__LINE__)->Flags & BLK_LINE_DIRTY) != 0U)
+
+/* Private variables ---------------------------------------------------------*/
+static uint8_t BlkData[BLK_CACHE_LINES][BLK_CACHE_BLOCK_SIZE] __attribute__((section(BLK_CACHE_SECTION), aligned(32)));
+static BLK_LineTypeDef BlkLines[BLK_CACHE_LINES];
+
+static const BLK_DeviceTypeDef *BlkDevice = NULL;
+static uint32_t BlkStamp = 0U;
+static uint32_t BlkDirtyCount = 0U;
+static __IO uint32_t BlkWriteThrough = 0U;
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t BLK_Find(uint32_t Block);
+static uint32_t BLK_Victim(void);
+static int8_t   BLK_WriteBack(uint32_t Line);
+static int8_t   BLK_WriteBackAll(void);
+static void     BLK_Update(uint8_t *pData, uint32_t BlockAdd, uint32_t NumOfBlocks, uint32_t ToCache);
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Attach the cache to a block device and initialize the device
+  * @param  pDevice: block device, must stay valid while the cache is used
+  * @retval BLK_OK or BLK_ERROR
+  */
+int8_t BLK_Cache_Init(const BLK_DeviceTypeDef *pDevice)
+{
+  int8_t status = BLK_OK;
+
+  if((pDevice == NULL) || (pDevice->Read == NULL) || (pDevice->Write == NULL))
+  {
+    return BLK_ERROR;
+  }
+
+  BLK_CACHE_LOCK();
+  BlkDevice = pDevice;
+  memset(BlkLines, 0, sizeof(BlkLines));
+  BlkStamp = 0U;
+  BlkDirtyCount = 0U;
+  BlkWriteThrough = 0U;
+  if(pDevice->Init != NULL)
+  {
+    status = pDevice->Init();
+  }
+  BLK_CACHE_UNLOCK();
+
+  return status;
+}
+
+/**
+  * @brief  Read blocks through the cache
+  * @param  pData: destination buffer
+  * @param  BlockAdd: first block
+  * @param  NumOfBlocks: number of blocks
+  * @retval BLK_OK or BLK_ERROR
+  */
+int8_t BLK_Cache_Read(uint8_t *pData, uint32_t BlockAdd, uint32_t NumOfBlocks)
+{
+  int8_t status = BLK_OK;
+  uint32_t blk;
+  uint32_t line;
+
+  if(BlkDevice == NULL)
+  {
+    return BLK_ERROR;
+  }
+
+  BLK_CACHE_LOCK();
+
+  if(NumOfBlocks >= BLK_CACHE_BYPASS_BLOCKS)
+  {
+    /* Large read: the device content is overridden by the blocks still
+       dirty in the cache */
+    status = BlkDevice->Read(pData, BlockAdd, NumOfBlocks);
+    if(status == BLK_OK)
+    {
+      BLK_Update(pData, BlockAdd, NumOfBlocks, 0U);
+    }
+  }
+  else
+  {
+    for(blk = BlockAdd; (blk < (BlockAdd + NumOfBlocks)) && (status == BLK_OK); blk++)
+    {
+      line = BLK_Find(blk);
+      if(line == BLK_CACHE_LINES)
+      {
+        line = BLK_Victim();
+        status = BLK_WriteBack(line);
+        if(status == BLK_OK)
+        {
+          BlkLines[line].Flags = 0U;
+          status = BlkDevice->Read(BlkData[line], blk, 1U);
+        }
+        if(status == BLK_OK)
+        {
+          BlkLines[line].Block = blk;
+          BlkLines[line].Flags = BLK_LINE_VALID;
+        }
+      }
+      if(status == BLK_OK)
+      {
+        BlkLines[line].Stamp = ++BlkStamp;
+        memcpy(pData, BlkData[line], BLK_CACHE_BLOCK_SIZE);
+        pData += BLK_CACHE_BLOCK_SIZE;
+      }
+    }
+  }
+
+  BLK_CACHE_UNLOCK();
+
+  return status;
+}
+
+/**
+  * @brief  Write blocks through the cache
+  * @param  pData: source buffer
+  * @param  BlockAdd: first block
+  * @param  NumOfBlocks: number of blocks
+  * @retval BLK_OK or BLK_ERROR
+  */
+int8_t BLK_Cache_Write(uint8_t *pData, uint32_t BlockAdd, uint32_t NumOfBlocks)
+{
+  int8_t status = BLK_OK;
+  uint32_t blk;
+  uint32_t line;
+
+  if(BlkDevice == NULL)
+  {
+    return BLK_ERROR;
+  }
+
+  BLK_CACHE_LOCK();
+
+  if((NumOfBlocks >= BLK_CACHE_BYPASS_BLOCKS) || (BlkWriteThrough != 0U))
+  {
+    /* Large or write-through write: the cached copies are refreshed and
+       are clean once the device holds the data */
+    status = BlkDevice->Write(pData, BlockAdd, NumOfBlocks);
+    if(status == BLK_OK)
+    {
+      BLK_Update(pData, BlockAdd, NumOfBlocks, 1U);
+    }
+  }
+  else
+  {
+    for(blk = BlockAdd; (blk < (BlockAdd + NumOfBlocks)) && (status == BLK_OK); blk++)
+    {
+      line = BLK_Find(blk);
+      if(line == BLK_CACHE_LINES)
+      {
+        /* Whole block overwritten: no need to read it first */
+        line = BLK_Victim();
+        status = BLK_WriteBack(line);
+        if(status == BLK_OK)
+        {
+          BlkLines[line].Block = blk;
+          BlkLines[line].Flags = BLK_LINE_VALID;
+        }
+      }
+      if(status == BLK_OK)
+      {
+        memcpy(BlkData[line], pData, BLK_CACHE_BLOCK_SIZE);
+        pData += BLK_CACHE_BLOCK_SIZE;
+        BlkLines[line].Stamp = ++BlkStamp;
+        if(!BLK_IS_DIRTY(&BlkLines[line]))
+        {
+          BlkLines[line].Flags |= BLK_LINE_DIRTY;
+          BlkLines[line].DirtyTick = HAL_GetTick();
+          BlkDirtyCount++;
+        }
+      }
+    }
+  }
+
+  BLK_CACHE_UNLOCK();
+
+  return status;
+}
+
+/**
+  * @brief  Write every dirty block back and wait for the device
+  * @param  None
+  * @retval BLK_OK or BLK_ERROR
+  */
+int8_t BLK_Cache_Flush(void)
+{
+  int8_t status;
+
+  if(BlkDevice == NULL)
+  {
+    return BLK_ERROR;
+  }
+
+  BLK_CACHE_LOCK();
+  status = BLK_WriteBackAll();
+  BLK_CACHE_UNLOCK();
+
+  return status;
+}
+
+/**
+  * @brief  Drop every cached block, dirty ones included
+  * @note   To be used when the medium has been changed or removed.
+  * @param  None
+  * @retval None
+  */
+void BLK_Cache_Invalidate(void)
+{
+  BLK_CACHE_LOCK();
+  memset(BlkLines, 0, sizeof(BlkLines));
+  BlkDirtyCount = 0U;
+  BLK_CACHE_UNLOCK();
+}
+
+/**
+  * @brief  Return the capacity of the device
+  * @param  None
+  * @retval Number of blocks
+  */
+uint32_t BLK_Cache_GetBlockNbr(void)
+{
+  if((BlkDevice == NULL) || (BlkDevice->GetBlockNbr == NULL))
+  {
+    return 0U;
+  }
+  return BlkDevice->GetBlockNbr();
+}
+
+/**
+  * @brief  Return the number of blocks waiting to be written back
+  * @param  None
+  * @retval Number of dirty blocks
+  */
+uint32_t BLK_Cache_GetDirtyCount(void)
+{
+  return BlkDirtyCount;
+}
+
+/**
+  * @brief  Delayed write-back, to be called periodically
+  * @note   As soon as one block is older than BLK_CACHE_FLUSH_DELAY all the
+  *         dirty blocks are written back, in a single pass over the device.
+  * @param  None
+  * @retval None
+  */
+void BLK_Cache_Process(void)
+{
+#if (BLK_CACHE_FLUSH_DELAY > 0U)
+  uint32_t line;
+  uint32_t tick;
+
+  if((BlkDevice == NULL) || (BlkDirtyCount == 0U))
+  {
+    return;
+  }
+
+  BLK_CACHE_LOCK();
+  tick = HAL_GetTick();
+  for(line = 0U; line < BLK_CACHE_LINES; line++)
+  {
+    if(BLK_IS_DIRTY(&BlkLines[line]) && ((tick - BlkLines[line].DirtyTick) >= BLK_CACHE_FLUSH_DELAY))
+    {
+      (void)BLK_WriteBackAll();
+      break;
+    }
+  }
+  BLK_CACHE_UNLOCK();
+#endif
+}
+
+/**
+  * @brief  Power-fail hook: write back every dirty block and switch to
+  *         write-through
+  * @note   Can be called from the power-fail interrupt provided the device
+  *         functions can run at that priority.
+  * @param  None
+  * @retval BLK_OK or BLK_ERROR
+  */
+int8_t BLK_Cache_PowerFail(void)
+{
+  BlkWriteThrough = 1U;
+
+  if(BlkDevice == NULL)
+  {
+    return BLK_ERROR;
+  }
+  return BLK_WriteBackAll();
+}
+
+/**
+  * @brief  Power restored: go back to write-back operation
+  * @param  None
+  * @retval None
+  */
+void BLK_Cache_PowerRestore(void)
+{
+  BlkWriteThrough = 0U;
+}
+
+/**
+  * @brief  Look a block up in the cache
+  * @param  Block: device block
+  * @retval Line holding the block, BLK_CACHE_LINES when not cached
+  */
+static uint32_t BLK_Find(uint32_t Block)
+{
+  uint32_t line;
+
+  for(line = 0U; line < BLK_CACHE_LINES; line++)
+  {
+    if(((BlkLines[line].Flags & BLK_LINE_VALID) != 0U) && (BlkLines[line].Block == Block))
+    {
+      break;
+    }
+  }
+  return line;
+}
+
+/**
+  * @brief  Select the line to reuse: a free line, else the least recently used
+  * @param  None
+  * @retval Line
+  */
+static uint32_t BLK_Victim(void)
+{
+  uint32_t line;
+  uint32_t victim = 0U;
+
+  for(line = 0U; line < BLK_CACHE_LINES; line++)
+  {
+    if((BlkLines[line].Flags & BLK_LINE_VALID) == 0U)
+    {
+      return line;
+    }
+    /* Wrap-around safe comparison of the stamps */
+    if((int32_t)(BlkLines[line].Stamp - BlkLines[victim].Stamp) < 0)
+    {
+      victim = line;
+    }
+  }
+  return victim;
+}
+
+/**
+  * @brief  Write one line back when it is dirty
+  * @param  Line: line
+  * @retval BLK_OK or BLK_ERROR
+  */
+static int8_t BLK_WriteBack(uint32_t Line)
+{
+  int8_t status = BLK_OK;
+
+  if(BLK_IS_DIRTY(&BlkLines[Line]))
+  {
+    status = BlkDevice->Write(BlkData[Line], BlkLines[Line].Block, 1U);
+    if(status == BLK_OK)
+    {
+      BlkLines[Line].Flags &= ~BLK_LINE_DIRTY;
+      BlkDirtyCount--;
+    }
+  }
+  return status;
+}
+
+/**
+  * @brief  Write every dirty line back in ascending block order, then wait
+  *         for the end of the device programming
+  * @param  None
+  * @retval BLK_OK or BLK_ERROR
+  */
+static int8_t BLK_WriteBackAll(void)
+{
+  int8_t status = BLK_OK;
+  uint32_t line;
+  uint32_t next;
+
+  while((BlkDirtyCount > 0U) && (status == BLK_OK))
+  {
+    next = BLK_CACHE_LINES;
+    for(line = 0U; line < BLK_CACHE_LINES; line++)
+    {
+      if(BLK_IS_DIRTY(&BlkLines[line]) &&
+         ((next == BLK_CACHE_LINES) || (BlkLines[line].Block < BlkLines[next].Block)))
+      {
+        next = line;
+      }
+    }
+    status = BLK_WriteBack(next);
+  }
+
+  if((status == BLK_OK) && (BlkDevice->Sync != NULL))
+  {
+    status = BlkDevice->Sync();
+  }
+  return status;
+}
+
+/**
+  * @brief  Keep the cache coherent with a transfer that bypassed it
+  * @param  pData: transfer buffer
+  * @param  BlockAdd: first block
+  * @param  NumOfBlocks: number of blocks
+  * @param  ToCache: 1 after a write, the cached copies take the new data and
+  *         become clean; 0 after a read, the dirty copies replace the data
+  *         read from the device
+  * @retval None
+  */
+static void BLK_Update(uint8_t *pData, uint32_t BlockAdd, uint32_t NumOfBlocks, uint32_t ToCache)
+{
+  uint32_t line;
+  uint8_t *pBlock;
+
+  for(line = 0U; line < BLK_CACHE_LINES; line++)
+  {
+    if(((BlkLines[line].Flags & BLK_LINE_VALID) != 0U) &&
+       (BlkLines[line].Block >= BlockAdd) && (BlkLines[line].Block < (BlockAdd + NumOfBlocks)))
+    {
+      pBlock = &pData[(BlkLines[line].Block - BlockAdd) * BLK_CACHE_BLOCK_SIZE];
+      if(ToCache != 0U)
+      {
+        memcpy(BlkData[line], pBlock, BLK_CACHE_BLOCK_SIZE);
+        if(BLK_IS_DIRTY(&BlkLines[line]))
+        {
+          BlkLines[line].Flags &= ~BLK_LINE_DIRTY;
+          BlkDirtyCount--;
+        }
+      }
+      else if(BLK_IS_DIRTY(&BlkLines[line]))
+      {
+        memcpy(pBlock, BlkData[line], BLK_CACHE_BLOCK_SIZE);
+      }
+    }
+  }
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
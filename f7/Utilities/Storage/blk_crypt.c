@@ -0,0 +1,1021 @@
+/**
+  ******************************************************************************
+  * @file    blk_crypt.c
+  * @author  MCD Application Team
+  * @brief   Block device encryption at rest, AES-XTS or AES-CTR
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+This module ciphers the blocks of a device between the block cache and the
+device driver (SD, eMMC, NAND FTL...) so that the data is only stored
+encrypted :
+
+      BLK_Crypt_Init(&BLK_SD_Device);
+      BLK_Crypt_SetKey(0U, &key);
+      BLK_Cache_Init(&BLK_Crypt_Device);
+
+1- each key slot covers a range of blocks, a volume or a partition, with its
+   own key and mode. Blocks outside every range are refused: nothing is
+   written in the clear by mistake. The contexts of all the slots are kept
+   ready (CRYP registers, key schedules) so that requests on different
+   volumes switch keys without setting them up again. BLK_Crypt_ClearKey()
+   wipes a slot.
+
+2- AES-XTS (IEEE 1619) is the mode to prefer: the data unit is one 512-byte
+   block and its tweak the block number. AES-CTR encrypts the block at
+   offset n of the device with the counter block (nonce, 32 * n): rewriting
+   a block reuses its key stream, so CTR only suits data written once, e.g.
+   logs on fresh blocks.
+
+3- requests are ciphered by BLK_CRYPT_CHUNK_BLOCKS blocks through two bounce
+   buffers: while the device writes chunk N, the CRYP DMA encrypts chunk
+   N + 1; while the device reads chunk N + 1, chunk N is decrypted. Only
+   ciphertext reaches the device, the caller buffer is never modified.
+
+4- with the CRYP (BLK_CRYPT_USE_HW), crypto_stream must be initialized with
+   CRYPTO_Stream_Init() first; other crypto_stream sessions may share the
+   processor. XTS runs the AES in ECB mode on the CRYP while the CPU applies
+   the tweaks. Without the CRYP, the same ciphertext is computed by a
+   software AES, far slower and without overlap.
+
+The functions are called through the block cache, which serialises them.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "blk_crypt.h"
+#if (BLK_CRYPT_USE_HW == 1U)
+#include "crypto_stream.h"
+#endif
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+#if (BLK_CRYPT_USE_HW == 0U)
+typedef struct
+{
+  uint32_t Rounds;
+  uint8_t  RoundKey[240];
+} Crypt_AesTypeDef;
+#endif
+
+typedef struct
+{
+  BLK_Crypt_ModeTypeDef Mode;
+  uint32_t              FirstBlock;
+  uint32_t              BlockNbr;
+  uint32_t              Nonce[2];    /* CTR: first half of the counter block   */
+#if (BLK_CRYPT_USE_HW == 1U)
+  CRYPTO_SessionTypeDef Data;        /* CTR, or XTS data key in ECB encryption */
+  CRYPTO_SessionTypeDef DataDec;     /* XTS data key in ECB decryption         */
+  CRYPTO_SessionTypeDef Tweak;       /* XTS tweak key in ECB encryption        */
+#else
+  Crypt_AesTypeDef      Data;
+  Crypt_AesTypeDef      Tweak;
+#endif
+} Crypt_KeyTypeDef;
+
+/* One chunk of a request */
+typedef struct
+{
+  Crypt_KeyTypeDef      *pKey;
+  uint32_t              Decrypt;     /* 1 when read from the device            */
+  const uint8_t         *pSrc;       /* Write: caller data; read: pBounce      */
+  uint8_t               *pDst;       /* Write: pBounce; read: caller data      */
+  uint8_t               *pBounce;    /* Ciphertext, as on the device           */
+  uint32_t              Block;
+  uint32_t              Count;
+  int8_t                Status;
+#if (BLK_CRYPT_USE_HW == 1U)
+  uint8_t               *pOut;       /* Output of the CRYP job                 */
+  CRYPTO_SegmentTypeDef Segment;
+  CRYPTO_JobTypeDef     Job;
+#endif
+} Crypt_OpTypeDef;
+
+/* Private define ------------------------------------------------------------*/
+#define CRYPT_AES_BLOCK     16U
+#define CRYPT_UNIT_AES      (BLK_CACHE_BLOCK_SIZE / CRYPT_AES_BLOCK)
+/* CTR: the CRYP increments the low 32 bits of the counter only, chunks do
+   not cross a multiple of 2^32 AES blocks */
+#define CRYPT_CTR_SPAN      (0x100000000ULL / CRYPT_UNIT_AES)
+
+/* Private macro -------------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static int8_t   Crypt_Init(void);
+static int8_t   Crypt_Read(uint8_t *pData, uint32_t BlockAdd, uint32_t NumOfBlocks);
+static int8_t   Crypt_Write(uint8_t *pData, uint32_t BlockAdd, uint32_t NumOfBlocks);
+static int8_t   Crypt_Sync(void);
+static uint32_t Crypt_GetBlockNbr(void);
+static int8_t   Crypt_Prepare(Crypt_OpTypeDef *pOp, uint8_t *pData, uint32_t BlockAdd, uint32_t NumOfBlocks,
+                              uint32_t Decrypt, uint32_t Buffer);
+static void     Crypt_Begin(Crypt_OpTypeDef *pOp);
+static int8_t   Crypt_End(Crypt_OpTypeDef *pOp);
+static void     Crypt_XtsTweaks(Crypt_OpTypeDef *pOp);
+static void     Crypt_XtsMask(const uint8_t *pIn, uint8_t *pOut, uint32_t Count);
+static uint32_t Crypt_LoadBE(const uint8_t *pData);
+#if (BLK_CRYPT_USE_HW == 1U)
+static void     Crypt_Submit(Crypt_OpTypeDef *pOp, CRYPTO_SessionTypeDef *pSession, const uint8_t *pIn,
+                             uint8_t *pOut, uint32_t Size);
+static int8_t   Crypt_Wait(Crypt_OpTypeDef *pOp);
+#else
+static void     Crypt_StoreBE(uint8_t *pData, uint32_t Value);
+static void     Crypt_AesCtr(const Crypt_KeyTypeDef *pKey, uint32_t Block, const uint8_t *pIn, uint8_t *pOut,
+                             uint32_t Size);
+static void     Crypt_AesSetKey(Crypt_AesTypeDef *pAes, const uint8_t *pKey, uint32_t KeySize);
+static void     Crypt_AesEncrypt(const Crypt_AesTypeDef *pAes, const uint8_t *pIn, uint8_t *pOut);
+static void     Crypt_AesDecrypt(const Crypt_AesTypeDef *pAes, const uint8_t *pIn, uint8_t *pOut);
+static void     Crypt_AesMixColumns(uint8_t *pState);
+static uint8_t  Crypt_Xtime(uint8_t Value);
+#endif
+
+/* Private variables ---------------------------------------------------------*/
+static uint8_t CryptBounce[2][BLK_CRYPT_CHUNK_BLOCKS * BLK_CACHE_BLOCK_SIZE] __attribute__((section(BLK_CRYPT_SECTION), aligned(32)));
+#if (BLK_CRYPT_USE_HW == 1U)
+static uint8_t CryptTweaks[BLK_CRYPT_CHUNK_BLOCKS][CRYPT_AES_BLOCK] __attribute__((section(BLK_CRYPT_SECTION), aligned(32)));
+#else
+static uint8_t CryptTweaks[BLK_CRYPT_CHUNK_BLOCKS][CRYPT_AES_BLOCK];
+#endif
+
+static Crypt_KeyTypeDef CryptKeys[BLK_CRYPT_KEYS];
+static const BLK_DeviceTypeDef *CryptLower = NULL;
+
+const BLK_DeviceTypeDef BLK_Crypt_Device =
+{
+  Crypt_Init,
+  Crypt_Read,
+  Crypt_Write,
+  Crypt_Sync,
+  Crypt_GetBlockNbr,
+};
+
+#if (BLK_CRYPT_USE_HW == 0U)
+static const uint8_t CryptSbox[256] =
+{
+  0x63U, 0x7cU, 0x77U, 0x7bU, 0xf2U, 0x6bU, 0x6fU, 0xc5U, 0x30U, 0x01U, 0x67U, 0x2bU, 0xfeU, 0xd7U, 0xabU, 0x76U,
+  0xcaU, 0x82U, 0xc9U, 0x7dU, 0xfaU, 0x59U, 0x47U, 0xf0U, 0xadU, 0xd4U, 0xa2U, 0xafU, 0x9cU, 0xa4U, 0x72U, 0xc0U,
+  0xb7U, 0xfdU, 0x93U, 0x26U, 0x36U, 0x3fU, 0xf7U, 0xccU, 0x34U, 0xa5U, 0xe5U, 0xf1U, 0x71U, 0xd8U, 0x31U, 0x15U,
+  0x04U, 0xc7U, 0x23U, 0xc3U, 0x18U, 0x96U, 0x05U, 0x9aU, 0x07U, 0x12U, 0x80U, 0xe2U, 0xebU, 0x27U, 0xb2U, 0x75U,
+  0x09U, 0x83U, 0x2cU, 0x1aU, 0x1bU, 0x6eU, 0x5aU, 0xa0U, 0x52U, 0x3bU, 0xd6U, 0xb3U, 0x29U, 0xe3U, 0x2fU, 0x84U,
+  0x53U, 0xd1U, 0x00U, 0xedU, 0x20U, 0xfcU, 0xb1U, 0x5bU, 0x6aU, 0xcbU, 0xbeU, 0x39U, 0x4aU, 0x4cU, 0x58U, 0xcfU,
+  0xd0U, 0xefU, 0xaaU, 0xfbU, 0x43U, 0x4dU, 0x33U, 0x85U, 0x45U, 0xf9U, 0x02U, 0x7fU, 0x50U, 0x3cU, 0x9fU, 0xa8U,
+  0x51U, 0xa3U, 0x40U, 0x8fU, 0x92U, 0x9dU, 0x38U, 0xf5U, 0xbcU, 0xb6U, 0xdaU, 0x21U, 0x10U, 0xffU, 0xf3U, 0xd2U,
+  0xcdU, 0x0cU, 0x13U, 0xecU, 0x5fU, 0x97U, 0x44U, 0x17U, 0xc4U, 0xa7U, 0x7eU, 0x3dU, 0x64U, 0x5dU, 0x19U, 0x73U,
+  0x60U, 0x81U, 0x4fU, 0xdcU, 0x22U, 0x2aU, 0x90U, 0x88U, 0x46U, 0xeeU, 0xb8U, 0x14U, 0xdeU, 0x5eU, 0x0bU, 0xdbU,
+  0xe0U, 0x32U, 0x3aU, 0x0aU, 0x49U, 0x06U, 0x24U, 0x5cU, 0xc2U, 0xd3U, 0xacU, 0x62U, 0x91U, 0x95U, 0xe4U, 0x79U,
+  0xe7U, 0xc8U, 0x37U, 0x6dU, 0x8dU, 0xd5U, 0x4eU, 0xa9U, 0x6cU, 0x56U, 0xf4U, 0xeaU, 0x65U, 0x7aU, 0xaeU, 0x08U,
+  0xbaU, 0x78U, 0x25U, 0x2eU, 0x1cU, 0xa6U, 0xb4U, 0xc6U, 0xe8U, 0xddU, 0x74U, 0x1fU, 0x4bU, 0xbdU, 0x8bU, 0x8aU,
+  0x70U, 0x3eU, 0xb5U, 0x66U, 0x48U, 0x03U, 0xf6U, 0x0eU, 0x61U, 0x35U, 0x57U, 0xb9U, 0x86U, 0xc1U, 0x1dU, 0x9eU,
+  0xe1U, 0xf8U, 0x98U, 0x11U, 0x69U, 0xd9U, 0x8eU, 0x94U, 0x9bU, 0x1eU, 0x87U, 0xe9U, 0xceU, 0x55U, 0x28U, 0xdfU,
+  0x8cU, 0xa1U, 0x89U, 0x0dU, 0xbfU, 0xe6U, 0x42U, 0x68U, 0x41U, 0x99U, 0x2dU, 0x0fU, 0xb0U, 0x54U, 0xbbU, 0x16U
+};
+
+static const uint8_t CryptInvSbox[256] =
+{
+  0x52U, 0x09U, 0x6aU, 0xd5U, 0x30U, 0x36U, 0xa5U, 0x38U, 0xbfU, 0x40U, 0xa3U, 0x9eU, 0x81U, 0xf3U, 0xd7U, 0xfbU,
+  0x7cU, 0xe3U, 0x39U, 0x82U, 0x9bU, 0x2fU, 0xffU, 0x87U, 0x34U, 0x8eU, 0x43U, 0x44U, 0xc4U, 0xdeU, 0xe9U, 0xcbU,
+  0x54U, 0x7bU, 0x94U, 0x32U, 0xa6U, 0xc2U, 0x23U, 0x3dU, 0xeeU, 0x4cU, 0x95U, 0x0bU, 0x42U, 0xfaU, 0xc3U, 0x4eU,
+  0x08U, 0x2eU, 0xa1U, 0x66U, 0x28U, 0xd9U, 0x24U, 0xb2U, 0x76U, 0x5bU, 0xa2U, 0x49U, 0x6dU, 0x8bU, 0xd1U, 0x25U,
+  0x72U, 0xf8U, 0xf6U, 0x64U, 0x86U, 0x68U, 0x98U, 0x16U, 0xd4U, 0xa4U, 0x5cU, 0xccU, 0x5dU, 0x65U, 0xb6U, 0x92U,
+  0x6cU, 0x70U, 0x48U, 0x50U, 0xfdU, 0xedU, 0xb9U, 0xdaU, 0x5eU, 0x15U, 0x46U, 0x57U, 0xa7U, 0x8dU, 0x9dU, 0x84U,
+  0x90U, 0xd8U, 0xabU, 0x00U, 0x8cU, 0xbcU, 0xd3U, 0x0aU, 0xf7U, 0xe4U, 0x58U, 0x05U, 0xb8U, 0xb3U, 0x45U, 0x06U,
+  0xd0U, 0x2cU, 0x1eU, 0x8fU, 0xcaU, 0x3fU, 0x0fU, 0x02U, 0xc1U, 0xafU, 0xbdU, 0x03U, 0x01U, 0x13U, 0x8aU, 0x6bU,
+  0x3aU, 0x91U, 0x11U, 0x41U, 0x4fU, 0x67U, 0xdcU, 0xeaU, 0x97U, 0xf2U, 0xcfU, 0xceU, 0xf0U, 0xb4U, 0xe6U, 0x73U,
+  0x96U, 0xacU, 0x74U, 0x22U, 0xe7U, 0xadU, 0x35U, 0x85U, 0xe2U, 0xf9U, 0x37U, 0xe8U, 0x1cU, 0x75U, 0xdfU, 0x6eU,
+  0x47U, 0xf1U, 0x1aU, 0x71U, 0x1dU, 0x29U, 0xc5U, 0x89U, 0x6fU, 0xb7U, 0x62U, 0x0eU, 0xaaU, 0x18U, 0xbeU, 0x1bU,
+  0xfcU, 0x56U, 0x3eU, 0x4bU, 0xc6U, 0xd2U, 0x79U, 0x20U, 0x9aU, 0xdbU, 0xc0U, 0xfeU, 0x78U, 0xcdU, 0x5aU, 0xf4U,
+  0x1fU, 0xddU, 0xa8U, 0x33U, 0x88U, 0x07U, 0xc7U, 0x31U, 0xb1U, 0x12U, 0x10U, 0x59U, 0x27U, 0x80U, 0xecU, 0x5fU,
+  0x60U, 0x51U, 0x7fU, 0xa9U, 0x19U, 0xb5U, 0x4aU, 0x0dU, 0x2dU, 0xe5U, 0x7aU, 0x9fU, 0x93U, 0xc9U, 0x9cU, 0xefU,
+  0xa0U, 0xe0U, 0x3bU, 0x4dU, 0xaeU, 0x2aU, 0xf5U, 0xb0U, 0xc8U, 0xebU, 0xbbU, 0x3cU, 0x83U, 0x53U, 0x99U, 0x61U,
+  0x17U, 0x2bU, 0x04U, 0x7eU, 0xbaU, 0x77U, 0xd6U, 0x26U, 0xe1U, 0x69U, 0x14U, 0x63U, 0x55U, 0x21U, 0x0cU, 0x7dU
+};
+#endif
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Attach the ciphering to the device holding the ciphertext
+  * @note   The keys are cleared. The lower device is initialized through
+  *         BLK_Crypt_Device, by BLK_Cache_Init().
+  * @param  pLower: block device, must stay valid while the module is used
+  * @retval BLK_OK or BLK_ERROR
+  */
+int8_t BLK_Crypt_Init(const BLK_DeviceTypeDef *pLower)
+{
+  uint32_t slot;
+
+  if((pLower == NULL) || (pLower->Read == NULL) || (pLower->Write == NULL) || (pLower->GetBlockNbr == NULL))
+  {
+    return BLK_ERROR;
+  }
+
+  for(slot = 0U; slot < BLK_CRYPT_KEYS; slot++)
+  {
+    BLK_Crypt_ClearKey(slot);
+  }
+  CryptLower = pLower;
+
+  return BLK_OK;
+}
+
+/**
+  * @brief  Set the key of a range of blocks
+  * @note   The range must not overlap the range of another slot. The key
+  *         material is copied in the slot context.
+  * @param  Slot: key slot, 0 to BLK_CRYPT_KEYS - 1
+  * @param  pKey: mode, range and key
+  * @retval BLK_OK or BLK_ERROR
+  */
+int8_t BLK_Crypt_SetKey(uint32_t Slot, const BLK_Crypt_KeyTypeDef *pKey)
+{
+  Crypt_KeyTypeDef *pslot;
+  uint32_t s;
+  int8_t status = BLK_OK;
+
+  if((Slot >= BLK_CRYPT_KEYS) || (pKey == NULL) || (pKey->pKey == NULL) || (pKey->BlockNbr == 0U) ||
+     ((pKey->FirstBlock + pKey->BlockNbr) < pKey->FirstBlock))
+  {
+    return BLK_ERROR;
+  }
+  if(pKey->Mode == BLK_CRYPT_MODE_XTS)
+  {
+    if((pKey->KeySize != 16U) && (pKey->KeySize != 32U))
+    {
+      return BLK_ERROR;
+    }
+  }
+  else if(pKey->Mode == BLK_CRYPT_MODE_CTR)
+  {
+    if((pKey->KeySize != 16U) && (pKey->KeySize != 24U) && (pKey->KeySize != 32U))
+    {
+      return BLK_ERROR;
+    }
+  }
+  else
+  {
+    return BLK_ERROR;
+  }
+
+  for(s = 0U; s < BLK_CRYPT_KEYS; s++)
+  {
+    if((s != Slot) && (CryptKeys[s].Mode != BLK_CRYPT_MODE_NONE) &&
+       (pKey->FirstBlock < (CryptKeys[s].FirstBlock + CryptKeys[s].BlockNbr)) &&
+       (CryptKeys[s].FirstBlock < (pKey->FirstBlock + pKey->BlockNbr)))
+    {
+      return BLK_ERROR;
+    }
+  }
+
+  BLK_Crypt_ClearKey(Slot);
+  pslot = &CryptKeys[Slot];
+
+#if (BLK_CRYPT_USE_HW == 1U)
+  if(pKey->Mode == BLK_CRYPT_MODE_XTS)
+  {
+    if((CRYPTO_Stream_CipherInit(&pslot->Data, CRYPTO_AES_ECB_ENCRYPT, pKey->pKey, pKey->KeySize, NULL) != HAL_OK) ||
+       (CRYPTO_Stream_CipherInit(&pslot->DataDec, CRYPTO_AES_ECB_DECRYPT, pKey->pKey, pKey->KeySize, NULL) != HAL_OK) ||
+       (CRYPTO_Stream_CipherInit(&pslot->Tweak, CRYPTO_AES_ECB_ENCRYPT, &pKey->pKey[pKey->KeySize], pKey->KeySize, NULL) != HAL_OK))
+    {
+      status = BLK_ERROR;
+    }
+  }
+  else
+  {
+    /* The counter block is set for each chunk */
+    if(CRYPTO_Stream_CipherInit(&pslot->Data, CRYPTO_AES_CTR, pKey->pKey, pKey->KeySize, NULL) != HAL_OK)
+    {
+      status = BLK_ERROR;
+    }
+  }
+#else
+  Crypt_AesSetKey(&pslot->Data, pKey->pKey, pKey->KeySize);
+  if(pKey->Mode == BLK_CRYPT_MODE_XTS)
+  {
+    Crypt_AesSetKey(&pslot->Tweak, &pKey->pKey[pKey->KeySize], pKey->KeySize);
+  }
+#endif
+
+  if(status != BLK_OK)
+  {
+    BLK_Crypt_ClearKey(Slot);
+    return BLK_ERROR;
+  }
+
+  if(pKey->pNonce != NULL)
+  {
+    pslot->Nonce[0] = Crypt_LoadBE(&pKey->pNonce[0]);
+    pslot->Nonce[1] = Crypt_LoadBE(&pKey->pNonce[4]);
+  }
+  pslot->FirstBlock = pKey->FirstBlock;
+  pslot->BlockNbr   = pKey->BlockNbr;
+  pslot->Mode       = pKey->Mode;
+
+  return BLK_OK;
+}
+
+/**
+  * @brief  Wipe a key slot, its blocks are refused until a key is set again
+  * @param  Slot: key slot
+  * @retval None
+  */
+void BLK_Crypt_ClearKey(uint32_t Slot)
+{
+  if(Slot < BLK_CRYPT_KEYS)
+  {
+#if (BLK_CRYPT_USE_HW == 1U)
+    CRYPTO_Stream_Release(&CryptKeys[Slot].Data);
+    CRYPTO_Stream_Release(&CryptKeys[Slot].DataDec);
+    CRYPTO_Stream_Release(&CryptKeys[Slot].Tweak);
+#endif
+    memset(&CryptKeys[Slot], 0, sizeof(Crypt_KeyTypeDef));
+  }
+}
+
+/**
+  * @brief  Initialize the lower device
+  * @param  None
+  * @retval BLK_OK or BLK_ERROR
+  */
+static int8_t Crypt_Init(void)
+{
+  if(CryptLower == NULL)
+  {
+    return BLK_ERROR;
+  }
+  return (CryptLower->Init != NULL) ? CryptLower->Init() : BLK_OK;
+}
+
+/**
+  * @brief  Read and decrypt blocks, the decryption of a chunk overlapping
+  *         the read of the next one
+  * @param  pData: destination buffer
+  * @param  BlockAdd: first block
+  * @param  NumOfBlocks: number of blocks
+  * @retval BLK_OK or BLK_ERROR
+  */
+static int8_t Crypt_Read(uint8_t *pData, uint32_t BlockAdd, uint32_t NumOfBlocks)
+{
+  Crypt_OpTypeDef op[2];
+  uint32_t cur = 0U;
+  uint32_t done = 0U;
+  uint32_t more;
+  int8_t status;
+
+  if((CryptLower == NULL) || (NumOfBlocks == 0U) ||
+     (Crypt_Prepare(&op[0], pData, BlockAdd, NumOfBlocks, 1U, 0U) != BLK_OK))
+  {
+    return BLK_ERROR;
+  }
+
+  status = CryptLower->Read(op[0].pBounce, op[0].Block, op[0].Count);
+  while(status == BLK_OK)
+  {
+    Crypt_Begin(&op[cur]);
+
+    done += op[cur].Count;
+    more = (done < NumOfBlocks) ? 1U : 0U;
+    if(more != 0U)
+    {
+      if((Crypt_Prepare(&op[cur ^ 1U], &pData[done * BLK_CACHE_BLOCK_SIZE], BlockAdd + done,
+                        NumOfBlocks - done, 1U, cur ^ 1U) != BLK_OK) ||
+         (CryptLower->Read(op[cur ^ 1U].pBounce, op[cur ^ 1U].Block, op[cur ^ 1U].Count) != BLK_OK))
+      {
+        status = BLK_ERROR;
+      }
+    }
+
+    if(Crypt_End(&op[cur]) != BLK_OK)
+    {
+      status = BLK_ERROR;
+    }
+    if(more == 0U)
+    {
+      break;
+    }
+    cur ^= 1U;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Encrypt and write blocks, the encryption of a chunk overlapping
+  *         the write of the previous one
+  * @param  pData: source buffer, left unchanged
+  * @param  BlockAdd: first block
+  * @param  NumOfBlocks: number of blocks
+  * @retval BLK_OK or BLK_ERROR
+  */
+static int8_t Crypt_Write(uint8_t *pData, uint32_t BlockAdd, uint32_t NumOfBlocks)
+{
+  Crypt_OpTypeDef op[2];
+  uint32_t cur = 0U;
+  uint32_t done = 0U;
+  uint32_t more;
+  int8_t status;
+
+  if((CryptLower == NULL) || (NumOfBlocks == 0U) ||
+     (Crypt_Prepare(&op[0], pData, BlockAdd, NumOfBlocks, 0U, 0U) != BLK_OK))
+  {
+    return BLK_ERROR;
+  }
+
+  Crypt_Begin(&op[0]);
+  status = Crypt_End(&op[0]);
+  while(status == BLK_OK)
+  {
+    done += op[cur].Count;
+    more = (done < NumOfBlocks) ? 1U : 0U;
+    if(more != 0U)
+    {
+      if(Crypt_Prepare(&op[cur ^ 1U], &pData[done * BLK_CACHE_BLOCK_SIZE], BlockAdd + done,
+                       NumOfBlocks - done, 0U, cur ^ 1U) != BLK_OK)
+      {
+        return BLK_ERROR;
+      }
+      Crypt_Begin(&op[cur ^ 1U]);
+    }
+
+    status = CryptLower->Write(op[cur].pBounce, op[cur].Block, op[cur].Count);
+
+    if(more == 0U)
+    {
+      break;
+    }
+    if(Crypt_End(&op[cur ^ 1U]) != BLK_OK)
+    {
+      status = BLK_ERROR;
+    }
+    cur ^= 1U;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Wait for the end of programming of the lower device
+  * @param  None
+  * @retval BLK_OK or BLK_ERROR
+  */
+static int8_t Crypt_Sync(void)
+{
+  if((CryptLower == NULL) || (CryptLower->Sync == NULL))
+  {
+    return BLK_OK;
+  }
+  return CryptLower->Sync();
+}
+
+/**
+  * @brief  Return the capacity of the lower device
+  * @param  None
+  * @retval Number of blocks
+  */
+static uint32_t Crypt_GetBlockNbr(void)
+{
+  return (CryptLower != NULL) ? CryptLower->GetBlockNbr() : 0U;
+}
+
+/**
+  * @brief  Set up the next chunk of a request: blocks of one key slot, at
+  *         most BLK_CRYPT_CHUNK_BLOCKS
+  * @param  pOp: chunk
+  * @param  pData: caller data of the first block
+  * @param  BlockAdd: first block
+  * @param  NumOfBlocks: blocks left in the request
+  * @param  Decrypt: 1 for a read
+  * @param  Buffer: bounce buffer, 0 or 1
+  * @retval BLK_OK, BLK_ERROR if the first block has no key
+  */
+static int8_t Crypt_Prepare(Crypt_OpTypeDef *pOp, uint8_t *pData, uint32_t BlockAdd, uint32_t NumOfBlocks,
+                            uint32_t Decrypt, uint32_t Buffer)
+{
+  Crypt_KeyTypeDef *pkey = NULL;
+  uint32_t count = NumOfBlocks;
+  uint32_t slot;
+
+  for(slot = 0U; slot < BLK_CRYPT_KEYS; slot++)
+  {
+    if((CryptKeys[slot].Mode != BLK_CRYPT_MODE_NONE) &&
+       ((BlockAdd - CryptKeys[slot].FirstBlock) < CryptKeys[slot].BlockNbr))
+    {
+      pkey = &CryptKeys[slot];
+      break;
+    }
+  }
+  if(pkey == NULL)
+  {
+    return BLK_ERROR;
+  }
+
+  if(count > BLK_CRYPT_CHUNK_BLOCKS)
+  {
+    count = BLK_CRYPT_CHUNK_BLOCKS;
+  }
+  if(count > ((pkey->FirstBlock + pkey->BlockNbr) - BlockAdd))
+  {
+    count = (pkey->FirstBlock + pkey->BlockNbr) - BlockAdd;
+  }
+  if((pkey->Mode == BLK_CRYPT_MODE_CTR) && (count > ((uint32_t)CRYPT_CTR_SPAN - (BlockAdd % (uint32_t)CRYPT_CTR_SPAN))))
+  {
+    count = (uint32_t)CRYPT_CTR_SPAN - (BlockAdd % (uint32_t)CRYPT_CTR_SPAN);
+  }
+
+  pOp->pKey    = pkey;
+  pOp->Decrypt = Decrypt;
+  pOp->pBounce = CryptBounce[Buffer];
+  pOp->pSrc    = (Decrypt != 0U) ? pOp->pBounce : pData;
+  pOp->pDst    = (Decrypt != 0U) ? pData : pOp->pBounce;
+  pOp->Block   = BlockAdd;
+  pOp->Count   = count;
+  pOp->Status  = BLK_OK;
+
+  return BLK_OK;
+}
+
+/**
+  * @brief  Start ciphering a chunk: queued to the CRYP, or done in software
+  * @param  pOp: chunk
+  * @retval None
+  */
+static void Crypt_Begin(Crypt_OpTypeDef *pOp)
+{
+  Crypt_KeyTypeDef *pkey = pOp->pKey;
+  uint32_t size = pOp->Count * BLK_CACHE_BLOCK_SIZE;
+#if (BLK_CRYPT_USE_HW == 1U)
+  const uint8_t *pin = pOp->pSrc;
+  uint8_t *pout = pOp->pDst;
+
+  if(pkey->Mode == BLK_CRYPT_MODE_XTS)
+  {
+    /* P xor T in the bounce buffer, ECB there, xor T again in Crypt_End() */
+    Crypt_XtsTweaks(pOp);
+    if(pOp->Status != BLK_OK)
+    {
+      return;
+    }
+    Crypt_XtsMask(pOp->pSrc, pOp->pBounce, pOp->Count);
+    Crypt_Submit(pOp, (pOp->Decrypt != 0U) ? &pkey->DataDec : &pkey->Data, pOp->pBounce, pOp->pBounce, size);
+    return;
+  }
+
+  /* The CRYP DMA reads words and writes whole cache lines */
+  if((pOp->Decrypt == 0U) && (((uint32_t)pin & 3U) != 0U))
+  {
+    memcpy(pOp->pBounce, pin, size);
+    pin = pOp->pBounce;
+  }
+  if((pOp->Decrypt != 0U) && (((uint32_t)pout & 31U) != 0U))
+  {
+    pout = pOp->pBounce;
+  }
+
+  /* Counter block of the first block, loaded with the key on the next job */
+  pkey->Data.Iv[0] = pkey->Nonce[0];
+  pkey->Data.Iv[1] = pkey->Nonce[1];
+  pkey->Data.Iv[2] = pOp->Block >> 27;
+  pkey->Data.Iv[3] = pOp->Block * CRYPT_UNIT_AES;
+  CRYPTO_Stream_Release(&pkey->Data);
+  Crypt_Submit(pOp, &pkey->Data, pin, pout, size);
+#else
+  uint32_t offset;
+
+  if(pkey->Mode == BLK_CRYPT_MODE_XTS)
+  {
+    Crypt_XtsTweaks(pOp);
+    Crypt_XtsMask(pOp->pSrc, pOp->pDst, pOp->Count);
+    for(offset = 0U; offset < size; offset += CRYPT_AES_BLOCK)
+    {
+      if(pOp->Decrypt != 0U)
+      {
+        Crypt_AesDecrypt(&pkey->Data, &pOp->pDst[offset], &pOp->pDst[offset]);
+      }
+      else
+      {
+        Crypt_AesEncrypt(&pkey->Data, &pOp->pDst[offset], &pOp->pDst[offset]);
+      }
+    }
+    Crypt_XtsMask(pOp->pDst, pOp->pDst, pOp->Count);
+  }
+  else
+  {
+    Crypt_AesCtr(pkey, pOp->Block, pOp->pSrc, pOp->pDst, size);
+  }
+#endif
+}
+
+/**
+  * @brief  Wait for the ciphering of a chunk and complete it
+  * @param  pOp: chunk
+  * @retval BLK_OK or BLK_ERROR
+  */
+static int8_t Crypt_End(Crypt_OpTypeDef *pOp)
+{
+#if (BLK_CRYPT_USE_HW == 1U)
+  if((pOp->Status != BLK_OK) || (Crypt_Wait(pOp) != BLK_OK))
+  {
+    return BLK_ERROR;
+  }
+
+  if(pOp->pKey->Mode == BLK_CRYPT_MODE_XTS)
+  {
+    Crypt_XtsMask(pOp->pBounce, pOp->pDst, pOp->Count);
+  }
+  else if(pOp->pOut != pOp->pDst)
+  {
+    memcpy(pOp->pDst, pOp->pOut, pOp->Count * BLK_CACHE_BLOCK_SIZE);
+  }
+#endif
+  return pOp->Status;
+}
+
+/**
+  * @brief  Compute the initial tweak of each block of a chunk: the block
+  *         number, little endian, encrypted with the tweak key
+  * @param  pOp: chunk
+  * @retval None
+  */
+static void Crypt_XtsTweaks(Crypt_OpTypeDef *pOp)
+{
+  uint32_t i;
+  uint32_t block;
+
+  for(i = 0U; i < pOp->Count; i++)
+  {
+    block = pOp->Block + i;
+    memset(CryptTweaks[i], 0, CRYPT_AES_BLOCK);
+    CryptTweaks[i][0] = (uint8_t)block;
+    CryptTweaks[i][1] = (uint8_t)(block >> 8);
+    CryptTweaks[i][2] = (uint8_t)(block >> 16);
+    CryptTweaks[i][3] = (uint8_t)(block >> 24);
+#if (BLK_CRYPT_USE_HW == 0U)
+    Crypt_AesEncrypt(&pOp->pKey->Tweak, CryptTweaks[i], CryptTweaks[i]);
+#endif
+  }
+
+#if (BLK_CRYPT_USE_HW == 1U)
+  /* An even number of tweaks: whole cache lines */
+  Crypt_Submit(pOp, &pOp->pKey->Tweak, CryptTweaks[0], CryptTweaks[0],
+               ((pOp->Count + 1U) & ~1U) * CRYPT_AES_BLOCK);
+  pOp->Status = Crypt_Wait(pOp);
+#endif
+}
+
+/**
+  * @brief  Xor the blocks of a chunk with their XTS tweaks, T(j + 1) being
+  *         T(j) multiplied by alpha in GF(2^128)
+  * @param  pIn: blocks, any alignment
+  * @param  pOut: result, may be pIn
+  * @param  Count: blocks of the chunk
+  * @retval None
+  */
+static void Crypt_XtsMask(const uint8_t *pIn, uint8_t *pOut, uint32_t Count)
+{
+  uint32_t tweak[4];
+  uint32_t word;
+  uint32_t carry;
+  uint32_t b;
+  uint32_t j;
+  uint32_t i;
+
+  for(b = 0U; b < Count; b++)
+  {
+    /* Little endian 128-bit value, as the words of a little endian core */
+    memcpy(tweak, CryptTweaks[b], CRYPT_AES_BLOCK);
+    for(j = 0U; j < CRYPT_UNIT_AES; j++)
+    {
+      for(i = 0U; i < 4U; i++)
+      {
+        memcpy(&word, pIn, 4U);
+        word ^= tweak[i];
+        memcpy(pOut, &word, 4U);
+        pIn  += 4;
+        pOut += 4;
+      }
+
+      carry    = tweak[3] >> 31;
+      tweak[3] = (tweak[3] << 1) | (tweak[2] >> 31);
+      tweak[2] = (tweak[2] << 1) | (tweak[1] >> 31);
+      tweak[1] = (tweak[1] << 1) | (tweak[0] >> 31);
+      tweak[0] = (tweak[0] << 1) ^ (carry * 0x87U);
+    }
+  }
+}
+
+/**
+  * @brief  Read a big endian word
+  * @param  pData: 4 bytes
+  * @retval word
+  */
+static uint32_t Crypt_LoadBE(const uint8_t *pData)
+{
+  return ((uint32_t)pData[0] << 24) | ((uint32_t)pData[1] << 16) | ((uint32_t)pData[2] << 8) | (uint32_t)pData[3];
+}
+
+#if (BLK_CRYPT_USE_HW == 1U)
+/**
+  * @brief  Queue one CRYP job of a chunk
+  * @param  pOp: chunk, holding the job
+  * @param  pSession: key context
+  * @param  pIn: input, word aligned
+  * @param  pOut: output, cache line aligned
+  * @param  Size: bytes, multiple of 32
+  * @retval None
+  */
+static void Crypt_Submit(Crypt_OpTypeDef *pOp, CRYPTO_SessionTypeDef *pSession, const uint8_t *pIn,
+                         uint8_t *pOut, uint32_t Size)
+{
+  pOp->Segment.pIn   = pIn;
+  pOp->Segment.pOut  = pOut;
+  pOp->Segment.Size  = Size;
+  pOp->Job.pSession  = pSession;
+  pOp->Job.pSegments = &pOp->Segment;
+  pOp->Job.NbSegments = 1U;
+  pOp->Job.pDigest   = NULL;
+  pOp->Job.Callback  = NULL;
+  pOp->pOut          = pOut;
+
+  if(CRYPTO_Stream_Submit(&pOp->Job) != HAL_OK)
+  {
+    pOp->Job.Status = HAL_ERROR;
+  }
+}
+
+/**
+  * @brief  Wait for the CRYP job of a chunk
+  * @param  pOp: chunk
+  * @retval BLK_OK or BLK_ERROR
+  */
+static int8_t Crypt_Wait(Crypt_OpTypeDef *pOp)
+{
+  while(pOp->Job.Status == HAL_BUSY)
+  {
+  }
+  return (pOp->Job.Status == HAL_OK) ? BLK_OK : BLK_ERROR;
+}
+
+#else
+/**
+  * @brief  Write a big endian word
+  * @param  pData: 4 bytes
+  * @param  Value: word
+  * @retval None
+  */
+static void Crypt_StoreBE(uint8_t *pData, uint32_t Value)
+{
+  pData[0] = (uint8_t)(Value >> 24);
+  pData[1] = (uint8_t)(Value >> 16);
+  pData[2] = (uint8_t)(Value >> 8);
+  pData[3] = (uint8_t)Value;
+}
+
+/**
+  * @brief  AES-CTR in software, the low 32 bits of the counter incremented
+  *         as by the CRYP
+  * @param  pKey: key slot
+  * @param  Block: first block
+  * @param  pIn: input
+  * @param  pOut: output
+  * @param  Size: bytes, multiple of 16
+  * @retval None
+  */
+static void Crypt_AesCtr(const Crypt_KeyTypeDef *pKey, uint32_t Block, const uint8_t *pIn, uint8_t *pOut,
+                         uint32_t Size)
+{
+  uint8_t counter[CRYPT_AES_BLOCK];
+  uint8_t stream[CRYPT_AES_BLOCK];
+  uint32_t low = Block * CRYPT_UNIT_AES;
+  uint32_t offset;
+  uint32_t i;
+
+  Crypt_StoreBE(&counter[0], pKey->Nonce[0]);
+  Crypt_StoreBE(&counter[4], pKey->Nonce[1]);
+  Crypt_StoreBE(&counter[8], Block >> 27);
+
+  for(offset = 0U; offset < Size; offset += CRYPT_AES_BLOCK)
+  {
+    Crypt_StoreBE(&counter[12], low);
+    Crypt_AesEncrypt(&pKey->Data, counter, stream);
+    for(i = 0U; i < CRYPT_AES_BLOCK; i++)
+    {
+      pOut[offset + i] = pIn[offset + i] ^ stream[i];
+    }
+    low++;
+  }
+}
+
+/**
+  * @brief  Expand an AES key (FIPS-197)
+  * @param  pAes: key schedule
+  * @param  pKey: key
+  * @param  KeySize: 16, 24 or 32 bytes
+  * @retval None
+  */
+static void Crypt_AesSetKey(Crypt_AesTypeDef *pAes, const uint8_t *pKey, uint32_t KeySize)
+{
+  uint32_t nk = KeySize / 4U;
+  uint32_t words;
+  uint32_t i;
+  uint32_t j;
+  uint8_t  temp[4];
+  uint8_t  first;
+  uint8_t  rcon = 1U;
+
+  pAes->Rounds = nk + 6U;
+  words = 4U * (pAes->Rounds + 1U);
+  memcpy(pAes->RoundKey, pKey, KeySize);
+
+  for(i = nk; i < words; i++)
+  {
+    memcpy(temp, &pAes->RoundKey[4U * (i - 1U)], 4U);
+    if((i % nk) == 0U)
+    {
+      first   = temp[0];
+      temp[0] = CryptSbox[temp[1]] ^ rcon;
+      temp[1] = CryptSbox[temp[2]];
+      temp[2] = CryptSbox[temp[3]];
+      temp[3] = CryptSbox[first];
+      rcon    = Crypt_Xtime(rcon);
+    }
+    else if((nk > 6U) && ((i % nk) == 4U))
+    {
+      for(j = 0U; j < 4U; j++)
+      {
+        temp[j] = CryptSbox[temp[j]];
+      }
+    }
+    for(j = 0U; j < 4U; j++)
+    {
+      pAes->RoundKey[(4U * i) + j] = pAes->RoundKey[(4U * (i - nk)) + j] ^ temp[j];
+    }
+  }
+}
+
+/**
+  * @brief  Encrypt one AES block
+  * @param  pAes: key schedule
+  * @param  pIn: 16 bytes
+  * @param  pOut: 16 bytes, may be pIn
+  * @retval None
+  */
+static void Crypt_AesEncrypt(const Crypt_AesTypeDef *pAes, const uint8_t *pIn, uint8_t *pOut)
+{
+  uint8_t state[CRYPT_AES_BLOCK];
+  uint8_t temp[CRYPT_AES_BLOCK];
+  uint32_t round;
+  uint32_t c;
+  uint32_t r;
+
+  for(c = 0U; c < CRYPT_AES_BLOCK; c++)
+  {
+    state[c] = pIn[c] ^ pAes->RoundKey[c];
+  }
+
+  for(round = 1U; round <= pAes->Rounds; round++)
+  {
+    /* SubBytes and ShiftRows, the state stored by columns */
+    for(c = 0U; c < 4U; c++)
+    {
+      for(r = 0U; r < 4U; r++)
+      {
+        temp[(4U * c) + r] = CryptSbox[state[(4U * ((c + r) & 3U)) + r]];
+      }
+    }
+    if(round != pAes->Rounds)
+    {
+      Crypt_AesMixColumns(temp);
+    }
+    for(c = 0U; c < CRYPT_AES_BLOCK; c++)
+    {
+      state[c] = temp[c] ^ pAes->RoundKey[(CRYPT_AES_BLOCK * round) + c];
+    }
+  }
+
+  memcpy(pOut, state, CRYPT_AES_BLOCK);
+}
+
+/**
+  * @brief  Decrypt one AES block
+  * @param  pAes: key schedule
+  * @param  pIn: 16 bytes
+  * @param  pOut: 16 bytes, may be pIn
+  * @retval None
+  */
+static void Crypt_AesDecrypt(const Crypt_AesTypeDef *pAes, const uint8_t *pIn, uint8_t *pOut)
+{
+  uint8_t state[CRYPT_AES_BLOCK];
+  uint8_t temp[CRYPT_AES_BLOCK];
+  uint32_t round = pAes->Rounds;
+  uint32_t c;
+  uint32_t r;
+  uint8_t  u;
+  uint8_t  v;
+
+  for(c = 0U; c < CRYPT_AES_BLOCK; c++)
+  {
+    state[c] = pIn[c] ^ pAes->RoundKey[(CRYPT_AES_BLOCK * round) + c];
+  }
+
+  while(round > 0U)
+  {
+    round--;
+
+    /* InvShiftRows and InvSubBytes, then AddRoundKey */
+    for(c = 0U; c < 4U; c++)
+    {
+      for(r = 0U; r < 4U; r++)
+      {
+        temp[(4U * c) + r] = CryptInvSbox[state[(4U * ((c + 4U - r) & 3U)) + r]];
+      }
+    }
+    for(c = 0U; c < CRYPT_AES_BLOCK; c++)
+    {
+      state[c] = temp[c] ^ pAes->RoundKey[(CRYPT_AES_BLOCK * round) + c];
+    }
+
+    /* InvMixColumns: MixColumns of the columns premultiplied by 4x^2 + 5 */
+    if(round != 0U)
+    {
+      for(c = 0U; c < CRYPT_AES_BLOCK; c += 4U)
+      {
+        u = Crypt_Xtime(Crypt_Xtime(state[c] ^ state[c + 2U]));
+        v = Crypt_Xtime(Crypt_Xtime(state[c + 1U] ^ state[c + 3U]));
+        state[c]      ^= u;
+        state[c + 1U] ^= v;
+        state[c + 2U] ^= u;
+        state[c + 3U] ^= v;
+      }
+      Crypt_AesMixColumns(state);
+    }
+  }
+
+  memcpy(pOut, state, CRYPT_AES_BLOCK);
+}
+
+/**
+  * @brief  MixColumns of an AES state
+  * @param  pState: 16 bytes, by columns
+  * @retval None
+  */
+static void Crypt_AesMixColumns(uint8_t *pState)
+{
+  uint8_t a0;
+  uint8_t a1;
+  uint8_t a2;
+  uint8_t a3;
+  uint8_t all;
+  uint32_t c;
+
+  for(c = 0U; c < CRYPT_AES_BLOCK; c += 4U)
+  {
+    a0  = pState[c];
+    a1  = pState[c + 1U];
+    a2  = pState[c + 2U];
+    a3  = pState[c + 3U];
+    all = a0 ^ a1 ^ a2 ^ a3;
+    pState[c]      = a0 ^ all ^ Crypt_Xtime(a0 ^ a1);
+    pState[c + 1U] = a1 ^ all ^ Crypt_Xtime(a1 ^ a2);
+    pState[c + 2U] = a2 ^ all ^ Crypt_Xtime(a2 ^ a3);
+    pState[c + 3U] = a3 ^ all ^ Crypt_Xtime(a3 ^ a0);
+  }
+}
+
+/**
+  * @brief  Multiply by x in GF(2^8)
+  * @param  Value: byte
+  * @retval Value * x
+  */
+static uint8_t Crypt_Xtime(uint8_t Value)
+{
+  return (uint8_t)((uint32_t)Value << 1) ^ (((Value & 0x80U) != 0U) ? 0x1BU : 0x00U);
+}
+#endif
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,302 @@
+/**
+  ******************************************************************************
+  * @file    blk_nor.c
+  * @author  MCD Application Team
+  * @brief   BSP NOR driver and nor_async engine adapter for blk_cache
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+This module maps the board BSP NOR driver (stm32xxxxx_eval_nor.c, included
+through main.h) and the nor_async engine on the BLK_DeviceTypeDef interface :
+
+      BLK_Cache_Init(&BLK_NOR_Device);
+
+NOR_Async_Process(&BLK_NOR_Engine) must be called from a timer and/or from
+the Ready/Busy pin interrupt, as described in nor_async.c.
+
+A write of blocks into a part of an erase block that can be programmed as
+is (bits only cleared) is queued as a buffer program. Otherwise the erase
+block is read in a RAM buffer, updated, then queued for erase and program;
+the buffer is kept, so that the next writes into the same erase block do
+not read it again.
+Write returns once queued; the next write waits until the buffer is free.
+Reads are served from the buffer for the erase block being written, from
+the memory otherwise, suspending the erase in progress: the device stays
+readable while it erases. Sync waits for the end of the queued operations.
+
+The buffer is one erase block long: place it in SDRAM with the linker
+script :
+      .blk_nor (NOLOAD) : { KEEP(*(.blk_nor)) } >SDRAM
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "blk_nor.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#if !defined(BLK_NOR_TIMEOUT)
+#define BLK_NOR_TIMEOUT   (2U * NOR_ASYNC_ERASE_TIMEOUT)
+#endif
+
+#define BLK_NOR_NO_BLOCK  0xFFFFFFFFU
+
+/* Private macro -------------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static int8_t   BLK_NOR_Init(void);
+static int8_t   BLK_NOR_Read(uint8_t *pData, uint32_t BlockAdd, uint32_t NumOfBlocks);
+static int8_t   BLK_NOR_Write(uint8_t *pData, uint32_t BlockAdd, uint32_t NumOfBlocks);
+static int8_t   BLK_NOR_Sync(void);
+static uint32_t BLK_NOR_GetBlockNbr(void);
+static uint32_t BLK_NOR_IsPending(void);
+
+/* Private variables ---------------------------------------------------------*/
+const BLK_DeviceTypeDef BLK_NOR_Device =
+{
+  BLK_NOR_Init,
+  BLK_NOR_Read,
+  BLK_NOR_Write,
+  BLK_NOR_Sync,
+  BLK_NOR_GetBlockNbr,
+};
+
+NOR_AsyncTypeDef BLK_NOR_Engine;
+
+static uint16_t BlkNorBuffer[BLK_NOR_BLOCK_SIZE / 2U] __attribute__((section(BLK_NOR_SECTION), aligned(32)));
+static uint32_t BlkNorBufferBlock = BLK_NOR_NO_BLOCK;   /* Erase block in the buffer */
+static NOR_Async_RequestTypeDef BlkNorErase;
+static NOR_Async_RequestTypeDef BlkNorProgram;
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Initialize the NOR memory and its engine
+  * @param  None
+  * @retval BLK_OK or BLK_ERROR
+  */
+static int8_t BLK_NOR_Init(void)
+{
+  if(BSP_NOR_Init() != NOR_STATUS_OK)
+  {
+    return BLK_ERROR;
+  }
+
+  BLK_NOR_Engine.BaseAddress = NOR_DEVICE_ADDR;
+  BLK_NOR_Engine.Size        = BLK_NOR_SIZE;
+  BLK_NOR_Engine.BlockSize   = BLK_NOR_BLOCK_SIZE;
+  BlkNorBufferBlock          = BLK_NOR_NO_BLOCK;
+  BlkNorErase.Status         = HAL_OK;
+  BlkNorProgram.Status       = HAL_OK;
+  return (NOR_Async_Init(&BLK_NOR_Engine) == HAL_OK) ? BLK_OK : BLK_ERROR;
+}
+
+/**
+  * @brief  Read blocks from the NOR memory
+  * @param  pData: destination buffer, half-word aligned
+  * @param  BlockAdd: first block
+  * @param  NumOfBlocks: number of blocks
+  * @retval BLK_OK or BLK_ERROR
+  */
+static int8_t BLK_NOR_Read(uint8_t *pData, uint32_t BlockAdd, uint32_t NumOfBlocks)
+{
+  uint32_t address;
+  HAL_StatusTypeDef status;
+
+  while(NumOfBlocks > 0U)
+  {
+    address = BlockAdd * BLK_CACHE_BLOCK_SIZE;
+    if((BLK_NOR_IsPending() != 0U) &&
+       ((address & ~(BLK_NOR_BLOCK_SIZE - 1U)) == BlkNorBufferBlock))
+    {
+      /* Being written: the buffer holds the data to come */
+      memcpy(pData, &BlkNorBuffer[(address & (BLK_NOR_BLOCK_SIZE - 1U)) / 2U], BLK_CACHE_BLOCK_SIZE);
+    }
+    else
+    {
+      status = NOR_Async_Read(&BLK_NOR_Engine, address, (uint16_t *)pData, BLK_CACHE_BLOCK_SIZE / 2U);
+      if(status == HAL_BUSY)
+      {
+        /* Erase of this block queued by another user of the engine */
+        if(BLK_NOR_Sync() != BLK_OK)
+        {
+          return BLK_ERROR;
+        }
+        status = NOR_Async_Read(&BLK_NOR_Engine, address, (uint16_t *)pData, BLK_CACHE_BLOCK_SIZE / 2U);
+      }
+      if(status != HAL_OK)
+      {
+        return BLK_ERROR;
+      }
+    }
+    pData += BLK_CACHE_BLOCK_SIZE;
+    BlockAdd++;
+    NumOfBlocks--;
+  }
+  return BLK_OK;
+}
+
+/**
+  * @brief  Write blocks to the NOR memory
+  * @param  pData: source buffer, half-word aligned
+  * @param  BlockAdd: first block
+  * @param  NumOfBlocks: number of blocks
+  * @retval BLK_OK or BLK_ERROR
+  */
+static int8_t BLK_NOR_Write(uint8_t *pData, uint32_t BlockAdd, uint32_t NumOfBlocks)
+{
+  const uint16_t *src;
+  uint32_t address, erase_block, offset, size, words, i;
+  uint32_t in_place;
+
+  while(NumOfBlocks > 0U)
+  {
+    /* Blocks falling in the same erase block */
+    address     = BlockAdd * BLK_CACHE_BLOCK_SIZE;
+    erase_block = address & ~(BLK_NOR_BLOCK_SIZE - 1U);
+    offset      = address - erase_block;
+    size        = BLK_NOR_BLOCK_SIZE - offset;
+    if(size > (NumOfBlocks * BLK_CACHE_BLOCK_SIZE))
+    {
+      size = NumOfBlocks * BLK_CACHE_BLOCK_SIZE;
+    }
+
+    /* The buffer is free once the previous write is programmed */
+    if(BLK_NOR_Sync() != BLK_OK)
+    {
+      return BLK_ERROR;
+    }
+    if(BlkNorBufferBlock != erase_block)
+    {
+      BlkNorBufferBlock = BLK_NOR_NO_BLOCK;
+      if(NOR_Async_Read(&BLK_NOR_Engine, erase_block, BlkNorBuffer, BLK_NOR_BLOCK_SIZE / 2U) != HAL_OK)
+      {
+        return BLK_ERROR;
+      }
+    }
+
+    /* Programming only clears bits */
+    src      = (const uint16_t *)pData;
+    in_place = 1U;
+    for(i = 0U; i < (size / 2U); i++)
+    {
+      if((BlkNorBuffer[(offset / 2U) + i] & src[i]) != src[i])
+      {
+        in_place = 0U;
+        break;
+      }
+    }
+    memcpy(&BlkNorBuffer[offset / 2U], pData, size);
+    BlkNorBufferBlock = erase_block;
+
+    if(in_place != 0U)
+    {
+      if(NOR_Async_Program(&BLK_NOR_Engine, address, &BlkNorBuffer[offset / 2U], size / 2U, &BlkNorProgram) != HAL_OK)
+      {
+        return BLK_ERROR;
+      }
+    }
+    else
+    {
+      /* The erased half-words at the end are not programmed */
+      words = BLK_NOR_BLOCK_SIZE / 2U;
+      while((words > 0U) && (BlkNorBuffer[words - 1U] == 0xFFFFU))
+      {
+        words--;
+      }
+      if(NOR_Async_Erase(&BLK_NOR_Engine, erase_block, &BlkNorErase) != HAL_OK)
+      {
+        return BLK_ERROR;
+      }
+      if((words != 0U) &&
+         (NOR_Async_Program(&BLK_NOR_Engine, erase_block, BlkNorBuffer, words, &BlkNorProgram) != HAL_OK))
+      {
+        return BLK_ERROR;
+      }
+    }
+
+    pData       += size;
+    BlockAdd    += size / BLK_CACHE_BLOCK_SIZE;
+    NumOfBlocks -= size / BLK_CACHE_BLOCK_SIZE;
+  }
+  return BLK_OK;
+}
+
+/**
+  * @brief  Wait for the end of the queued erase and program
+  * @param  None
+  * @retval BLK_OK or BLK_ERROR
+  */
+static int8_t BLK_NOR_Sync(void)
+{
+  uint32_t tickstart = HAL_GetTick();
+
+  while(BLK_NOR_IsPending() != 0U)
+  {
+    /* Also driven from here when no interrupt calls it */
+    NOR_Async_Process(&BLK_NOR_Engine);
+    if((HAL_GetTick() - tickstart) >= BLK_NOR_TIMEOUT)
+    {
+      return BLK_ERROR;
+    }
+  }
+  if((BlkNorErase.Status != HAL_OK) || (BlkNorProgram.Status != HAL_OK))
+  {
+    /* Not written: the erase block is read again on the next write */
+    BlkNorErase.Status   = HAL_OK;
+    BlkNorProgram.Status = HAL_OK;
+    BlkNorBufferBlock    = BLK_NOR_NO_BLOCK;
+    return BLK_ERROR;
+  }
+  return BLK_OK;
+}
+
+/**
+  * @brief  Return the capacity of the NOR memory
+  * @param  None
+  * @retval Number of blocks
+  */
+static uint32_t BLK_NOR_GetBlockNbr(void)
+{
+  return BLK_NOR_SIZE / BLK_CACHE_BLOCK_SIZE;
+}
+
+/**
+  * @brief  Tell whether the write of the buffer is still queued
+  * @param  None
+  * @retval 1 while the erase or the program of the buffer is pending
+  */
+static uint32_t BLK_NOR_IsPending(void)
+{
+  return ((BlkNorErase.Status == HAL_BUSY) || (BlkNorProgram.Status == HAL_BUSY)) ? 1U : 0U;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,83 @@
+/**
+  ******************************************************************************
+  * @file    blk_nor.h
+  * @author  MCD Application Team
+  * @brief   Header for blk_nor module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _BLK_NOR_H__
+#define _BLK_NOR_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "blk_cache.h"
+#include "nor_async.h"
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+/* Bytes of the memory, 16 MBytes for the PC28F128M29EW. Override in main.h. */
+#if !defined(BLK_NOR_SIZE)
+#define BLK_NOR_SIZE          0x01000000U
+#endif
+
+/* Bytes of an erase block. Override in main.h. */
+#if !defined(BLK_NOR_BLOCK_SIZE)
+#define BLK_NOR_BLOCK_SIZE    0x00020000U
+#endif
+
+/* Section of the erase block buffer, to be placed in SDRAM by the linker
+   script. Override in main.h. */
+#if !defined(BLK_NOR_SECTION)
+#define BLK_NOR_SECTION       ".blk_nor"
+#endif
+
+/* Exported variables --------------------------------------------------------*/
+/* BSP NOR driver seen as a block device */
+extern const BLK_DeviceTypeDef BLK_NOR_Device;
+
+/* Engine of the device, for NOR_Async_Process(), NOR_Async_Hold() and the
+   statistics */
+extern NOR_AsyncTypeDef BLK_NOR_Engine;
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _BLK_NOR_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,152 @@
+/**
+  ******************************************************************************
+  * @file    blk_sd.c
+  * @author  MCD Application Team
+  * @brief   Block device interface of the BSP SD driver
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+This module maps the board BSP SD driver (stm32xxxxx_{eval}{discovery}_sd.c,
+included through main.h) on the BLK_DeviceTypeDef interface :
+
+      BLK_Cache_Init(&BLK_SD_Device);
+
+The BSP polling functions are used so that CPU copies, and not DMA, move the
+data: the block buffers need no D-cache maintenance and may be located in
+SDRAM.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "blk_sd.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#if !defined(BLK_SD_TIMEOUT)
+#define BLK_SD_TIMEOUT   SD_DATATIMEOUT
+#endif
+
+/* Private macro -------------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static int8_t   BLK_SD_Init(void);
+static int8_t   BLK_SD_Read(uint8_t *pData, uint32_t BlockAdd, uint32_t NumOfBlocks);
+static int8_t   BLK_SD_Write(uint8_t *pData, uint32_t BlockAdd, uint32_t NumOfBlocks);
+static int8_t   BLK_SD_Sync(void);
+static uint32_t BLK_SD_GetBlockNbr(void);
+
+/* Private variables ---------------------------------------------------------*/
+const BLK_DeviceTypeDef BLK_SD_Device =
+{
+  BLK_SD_Init,
+  BLK_SD_Read,
+  BLK_SD_Write,
+  BLK_SD_Sync,
+  BLK_SD_GetBlockNbr,
+};
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Initialize the SD card
+  * @param  None
+  * @retval BLK_OK or BLK_ERROR
+  */
+static int8_t BLK_SD_Init(void)
+{
+  return (BSP_SD_Init() == MSD_OK) ? BLK_OK : BLK_ERROR;
+}
+
+/**
+  * @brief  Read blocks from the SD card
+  * @param  pData: destination buffer, word aligned
+  * @param  BlockAdd: first block
+  * @param  NumOfBlocks: number of blocks
+  * @retval BLK_OK or BLK_ERROR
+  */
+static int8_t BLK_SD_Read(uint8_t *pData, uint32_t BlockAdd, uint32_t NumOfBlocks)
+{
+  if(BSP_SD_ReadBlocks((uint32_t *)pData, BlockAdd, NumOfBlocks, BLK_SD_TIMEOUT) != MSD_OK)
+  {
+    return BLK_ERROR;
+  }
+  return BLK_SD_Sync();
+}
+
+/**
+  * @brief  Write blocks to the SD card
+  * @param  pData: source buffer, word aligned
+  * @param  BlockAdd: first block
+  * @param  NumOfBlocks: number of blocks
+  * @retval BLK_OK or BLK_ERROR
+  */
+static int8_t BLK_SD_Write(uint8_t *pData, uint32_t BlockAdd, uint32_t NumOfBlocks)
+{
+  /* The card may still be programming the previous write */
+  if(BLK_SD_Sync() != BLK_OK)
+  {
+    return BLK_ERROR;
+  }
+  return (BSP_SD_WriteBlocks((uint32_t *)pData, BlockAdd, NumOfBlocks, BLK_SD_TIMEOUT) == MSD_OK) ? BLK_OK : BLK_ERROR;
+}
+
+/**
+  * @brief  Wait for the card to be back in transfer state
+  * @param  None
+  * @retval BLK_OK or BLK_ERROR
+  */
+static int8_t BLK_SD_Sync(void)
+{
+  uint32_t tickstart = HAL_GetTick();
+
+  while(BSP_SD_GetCardState() != SD_TRANSFER_OK)
+  {
+    if((HAL_GetTick() - tickstart) >= BLK_SD_TIMEOUT)
+    {
+      return BLK_ERROR;
+    }
+  }
+  return BLK_OK;
+}
+
+/**
+  * @brief  Return the capacity of the SD card
+  * @param  None
+  * @retval Number of blocks
+  */
+static uint32_t BLK_SD_GetBlockNbr(void)
+{
+  BSP_SD_CardInfo info;
+
+  BSP_SD_GetCardInfo(&info);
+  return info.LogBlockNbr;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
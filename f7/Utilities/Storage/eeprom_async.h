@@ -0,0 +1,139 @@
+/**
+  ******************************************************************************
+  * @file    eeprom_async.h
+  * @author  MCD Application Team
+  * @brief   Header for eeprom_async module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _EEPROM_ASYNC_H__
+#define _EEPROM_ASYNC_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#if !defined(HAL_I2C_MODULE_ENABLED)
+#error "eeprom_async requires the HAL I2C driver (HAL_I2C_MODULE_ENABLED)"
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+/* Largest EEPROM page, in bytes. Override in main.h. */
+#if !defined(EEPROM_ASYNC_PAGE_MAX)
+#define EEPROM_ASYNC_PAGE_MAX        64U
+#endif
+
+/* Largest number of pages mirrored, multiple of 32. Override in main.h. */
+#if !defined(EEPROM_ASYNC_PAGES_MAX)
+#define EEPROM_ASYNC_PAGES_MAX       2048U
+#endif
+
+/* Write cycle timeout in ms, the page write is then retried. Override in main.h. */
+#if !defined(EEPROM_ASYNC_WRITE_TIMEOUT)
+#define EEPROM_ASYNC_WRITE_TIMEOUT   20U
+#endif
+
+/* Attempts of a page write or a read before reporting an error. Override in main.h. */
+#if !defined(EEPROM_ASYNC_RETRIES)
+#define EEPROM_ASYNC_RETRIES         3U
+#endif
+
+/* Bytes read per transaction while loading the cache. Override in main.h. */
+#if !defined(EEPROM_ASYNC_READ_CHUNK)
+#define EEPROM_ASYNC_READ_CHUNK      256U
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+/* Owned by the module from EEPROM_Async_Write() until Callback is called */
+typedef struct __EEPROM_Async_RequestTypeDef
+{
+  void                                  (*Callback)(struct __EEPROM_Async_RequestTypeDef *pRequest);
+  void                                  *pContext;    /* Free for the caller                  */
+  __IO HAL_StatusTypeDef                Status;       /* HAL_BUSY until written               */
+  uint32_t                              FirstPage;    /* Reserved for the module              */
+  uint32_t                              LastPage;
+  uint32_t                              Failures;
+  struct __EEPROM_Async_RequestTypeDef  *pNext;
+} EEPROM_Async_RequestTypeDef;
+
+typedef struct
+{
+  /* Set by the application before EEPROM_Async_Init() */
+  I2C_HandleTypeDef             *hi2c;         /* Bus, DMA linked or not                     */
+  uint16_t                      DevAddress;    /* 8-bit address as the HAL, EEPROM_ADDRESS   */
+  uint16_t                      MemAddSize;    /* I2C_MEMADD_SIZE_8BIT or _16BIT             */
+  uint32_t                      PageSize;      /* EEPROM_PAGESIZE, power of 2                */
+  uint32_t                      Size;          /* Bytes mirrored from address 0              */
+  uint8_t                       *pCache;       /* Size bytes, the read cache                 */
+
+  /* Reserved for the module */
+  __IO uint32_t                 State;
+  uint32_t                      Page;          /* Page being written                         */
+  uint32_t                      Cursor;        /* Next page to look at                       */
+  uint32_t                      Loaded;        /* Bytes of the cache read                    */
+  uint32_t                      Chunk;         /* Bytes of the read in progress              */
+  uint32_t                      Retries;
+  uint32_t                      WriteTick;     /* Start of the write cycle                   */
+  __IO HAL_StatusTypeDef        LoadStatus;
+  uint32_t                      Failures;      /* Page writes given up                       */
+  uint32_t                      PageWrites;    /* Page writes done                           */
+  uint32_t                      Polls;         /* Acknowledge polls sent                     */
+  EEPROM_Async_RequestTypeDef   *pHead;        /* Requests waiting for their pages           */
+  EEPROM_Async_RequestTypeDef   *pTail;
+  uint32_t                      Dirty[EEPROM_ASYNC_PAGES_MAX / 32U];
+  uint8_t                       Buffer[(EEPROM_ASYNC_PAGE_MAX + 31U) & ~31U] __attribute__((aligned(32)));
+} EEPROM_AsyncTypeDef;
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef EEPROM_Async_Init(EEPROM_AsyncTypeDef *pEeprom);
+HAL_StatusTypeDef EEPROM_Async_GetState(EEPROM_AsyncTypeDef *pEeprom);
+HAL_StatusTypeDef EEPROM_Async_Read(EEPROM_AsyncTypeDef *pEeprom, uint32_t Address, uint8_t *pData, uint32_t Size);
+HAL_StatusTypeDef EEPROM_Async_Write(EEPROM_AsyncTypeDef *pEeprom, uint32_t Address, const uint8_t *pData,
+                                     uint32_t Size, EEPROM_Async_RequestTypeDef *pRequest);
+uint32_t          EEPROM_Async_IsIdle(EEPROM_AsyncTypeDef *pEeprom);
+void              EEPROM_Async_Tick(EEPROM_AsyncTypeDef *pEeprom);
+
+void EEPROM_Async_I2C_TxCpltCallback(EEPROM_AsyncTypeDef *pEeprom, I2C_HandleTypeDef *hi2c);
+void EEPROM_Async_I2C_RxCpltCallback(EEPROM_AsyncTypeDef *pEeprom, I2C_HandleTypeDef *hi2c);
+void EEPROM_Async_I2C_ErrorCallback(EEPROM_AsyncTypeDef *pEeprom, I2C_HandleTypeDef *hi2c);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _EEPROM_ASYNC_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,553 @@
+/**
+  ******************************************************************************
+  * @file    fw_update.c
+  * @author  MCD Application Team
+  * @brief   Firmware update engine for dual bank devices: the new image is
+  *          streamed to the inactive bank under interrupt while the
+  *          application runs from the active bank, then the banks are swapped
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- enable the FLASH interrupt, at a priority lower than the control loop
+   interrupts, and call FW_Update_FLASH_IRQHandler() from FLASH_IRQHandler().
+   The module implements HAL_FLASH_EndOfOperationCallback() and
+   HAL_FLASH_OperationErrorCallback(), and uses the CRC unit.
+   Call FW_Update_Init() once.
+
+2- FW_Update_Begin() starts the erase of the inactive bank under interrupt.
+   FW_Update_Write() then takes the chunks of the image as they arrive (USB
+   DFU or CDC, Ethernet...): they are buffered in RAM and each
+   word
+   is programmed with HAL_FLASH_Program_IT(), the next one
+   being started from the FLASH interrupt. FW_Update_Write() returns HAL_BUSY
+   when the buffer is full: the chunk must be given again later (NAK it on
+   USB). It may be called from the communication interrupt.
+
+3- FW_Update_Finish() gives the CRC of the image: CRC-32/MPEG-2 (polynomial
+   0x04C11DB7, initial value 0xFFFFFFFF, no reflection, no final XOR) of the
+   image taken as little endian 32-bit words, padded with 0xFF to a multiple
+   of 4 bytes. Call FW_Update_Process() from the main loop: once all the
+   chunks are programmed, it checks the CRC of the inactive bank with the
+   CRC unit, FW_UPDATE_VERIFY_STEP bytes per call, then calls
+   FW_Update_EndCallback().
+
+4- FW_Update_Activate() swaps the banks and resets the device: the swap is
+   a single option byte change, so the device boots either the former or
+   the new image. The former image stays in the now inactive bank.
+   The BOOT_ADD0 option selects the bank executed after reset. The banks
+   are not remapped: the image for bank 2 is linked for bank 2
+   (0x08100000 on 2 Mbytes devices) and the images are built for the
+   inactive bank. nDBANK must be cleared (dual bank mode).
+
+5- the application keeps running from the active bank while the inactive
+   one is erased and programmed: no flash stall, no interrupt masked for
+   longer than the start of one program operation.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "fw_update.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Programming granularity, in bytes */
+#define FW_PROGRAM_UNIT    4U
+
+#if ((FW_UPDATE_BUFFER_SIZE % FW_PROGRAM_UNIT) != 0U) || (FW_UPDATE_BUFFER_SIZE < (2U * FW_PROGRAM_UNIT))
+#error "FW_UPDATE_BUFFER_SIZE must be a multiple of the programming unit"
+#endif
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static CRC_HandleTypeDef             FwCrcHandle;
+static __IO FW_Update_StateTypeDef   FwState = FW_UPDATE_STATE_RESET;
+static __IO uint32_t                 FwBusy;        /* Erase or program on going            */
+static uint32_t                      FwActiveBank;  /* 1 or 2                               */
+static uint32_t                      FwBankSize;
+static uint32_t                      FwAddress;     /* Inactive bank address                */
+static uint32_t                      FwImageSize;
+static uint32_t                      FwReceived;
+static __IO uint32_t                 FwHead;        /* Bytes written in the buffer          */
+static __IO uint32_t                 FwTail;        /* Bytes programmed                     */
+static __IO uint32_t                 FwFinishing;
+static uint32_t                      FwCrc;
+static uint32_t                      FwVerified;
+static uint32_t                      FwBuffer[FW_UPDATE_BUFFER_SIZE / 4U];
+
+/* Private function prototypes -----------------------------------------------*/
+static void              FW_Program(void);
+static HAL_StatusTypeDef FW_Swap(void);
+static void              FW_InvalidateCache(uint32_t Address, uint32_t Size);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Locate the banks and initialize the CRC unit
+  * @retval HAL status, HAL_ERROR on a single bank device or configuration
+  */
+HAL_StatusTypeDef FW_Update_Init(void)
+{
+  uint32_t pc = (uint32_t)&FW_Update_Init;
+
+  if((FLASH->OPTCR & FLASH_OPTCR_nDBANK) != 0U)
+  {
+    return HAL_ERROR;
+  }
+  FwBankSize = ((uint32_t)(*(__IO uint16_t *)FLASHSIZE_BASE) * 1024U) / 2U;
+
+  /* Bank executing this code, over the AXIM or the ITCM interface */
+  pc -= (pc >= FLASHAXI_BASE) ? FLASHAXI_BASE : FLASHITCM_BASE;
+  FwActiveBank = (pc >= FwBankSize) ? 2U : 1U;
+  FwAddress    = (FwActiveBank == 1U) ? (FLASH_BASE + FwBankSize) : FLASH_BASE;
+
+  __HAL_RCC_CRC_CLK_ENABLE();
+  FwCrcHandle.Instance = CRC;
+  FwCrcHandle.Init.DefaultPolynomialUse    = DEFAULT_POLYNOMIAL_ENABLE;
+  FwCrcHandle.Init.DefaultInitValueUse     = DEFAULT_INIT_VALUE_ENABLE;
+  FwCrcHandle.Init.InputDataInversionMode  = CRC_INPUTDATA_INVERSION_NONE;
+  FwCrcHandle.Init.OutputDataInversionMode = CRC_OUTPUTDATA_INVERSION_DISABLE;
+  FwCrcHandle.InputDataFormat              = CRC_INPUTDATA_FORMAT_WORDS;
+  if(HAL_CRC_Init(&FwCrcHandle) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  FwBusy  = 0U;
+  FwState = FW_UPDATE_STATE_IDLE;
+  return HAL_OK;
+}
+
+/**
+  * @brief  Start an update: erase of the inactive bank
+  * @param  ImageSize: image size in bytes, up to the bank size
+  * @retval HAL status, HAL_BUSY while a former operation ends
+  */
+HAL_StatusTypeDef FW_Update_Begin(uint32_t ImageSize)
+{
+  FLASH_EraseInitTypeDef erase;
+
+  if((FwState == FW_UPDATE_STATE_RESET) || (ImageSize == 0U) || (ImageSize > FwBankSize))
+  {
+    return HAL_ERROR;
+  }
+  if(FwBusy != 0U)
+  {
+    return HAL_BUSY;
+  }
+
+  FwImageSize = ImageSize;
+  FwReceived  = 0U;
+  FwHead      = 0U;
+  FwTail      = 0U;
+  FwFinishing = 0U;
+
+  erase.TypeErase    = FLASH_TYPEERASE_MASSERASE;
+  erase.Banks        = (FwActiveBank == 1U) ? FLASH_BANK_2 : FLASH_BANK_1;
+  erase.VoltageRange = FLASH_VOLTAGE_RANGE_3;
+
+  if(HAL_FLASH_Unlock() != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  FwBusy  = 1U;
+  FwState = FW_UPDATE_STATE_ERASE;
+  if(HAL_FLASHEx_Erase_IT(&erase) != HAL_OK)
+  {
+    FwBusy  = 0U;
+    FwState = FW_UPDATE_STATE_ERROR;
+    (void)HAL_FLASH_Lock();
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Give the next chunk of the image
+  * @param  pData: chunk
+  * @param  Size: chunk size in bytes
+  * @retval HAL status, HAL_BUSY when the buffer cannot take the chunk yet
+  */
+HAL_StatusTypeDef FW_Update_Write(const uint8_t *pData, uint32_t Size)
+{
+  uint8_t *buffer = (uint8_t *)FwBuffer;
+  uint32_t head = FwHead;
+  uint32_t offset;
+  uint32_t part;
+
+  if(((FwState != FW_UPDATE_STATE_ERASE) && (FwState != FW_UPDATE_STATE_PROGRAM)) ||
+     (FwFinishing != 0U) || (Size > (FwImageSize - FwReceived)))
+  {
+    return HAL_ERROR;
+  }
+  /* One unit is kept free for the padding of the last one */
+  if(Size > (FW_UPDATE_BUFFER_SIZE - FW_PROGRAM_UNIT - (head - FwTail)))
+  {
+    return HAL_BUSY;
+  }
+
+  offset = head % FW_UPDATE_BUFFER_SIZE;
+  part   = FW_UPDATE_BUFFER_SIZE - offset;
+  if(part > Size)
+  {
+    part = Size;
+  }
+  memcpy(&buffer[offset], pData, part);
+  memcpy(buffer, &pData[part], Size - part);
+
+  FwReceived += Size;
+  FwHead      = head + Size;
+
+  FW_Program();
+  return HAL_OK;
+}
+
+/**
+  * @brief  End of the image: programming of the last chunks, then CRC check
+  * @param  Crc: CRC of the image
+  * @retval HAL status
+  */
+HAL_StatusTypeDef FW_Update_Finish(uint32_t Crc)
+{
+  uint8_t *buffer = (uint8_t *)FwBuffer;
+  uint32_t head = FwHead;
+
+  if(((FwState != FW_UPDATE_STATE_ERASE) && (FwState != FW_UPDATE_STATE_PROGRAM)) ||
+     (FwFinishing != 0U) || (FwReceived != FwImageSize))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Last unit padded with the erased value */
+  while((head % FW_PROGRAM_UNIT) != 0U)
+  {
+    buffer[head % FW_UPDATE_BUFFER_SIZE] = 0xFFU;
+    head++;
+  }
+  FwHead      = head;
+  FwCrc       = Crc;
+  FwVerified  = 0U;
+  FwFinishing = 1U;
+
+  FW_Program();
+  return HAL_OK;
+}
+
+/**
+  * @brief  CRC check of the programmed image, step by step
+  * @retval HAL status
+  */
+HAL_StatusTypeDef FW_Update_Process(void)
+{
+  uint32_t words;
+  uint32_t crc;
+
+  if(FwState == FW_UPDATE_STATE_ERROR)
+  {
+    return HAL_ERROR;
+  }
+  if(FwState != FW_UPDATE_STATE_VERIFY)
+  {
+    return HAL_OK;
+  }
+
+  words = (((FwImageSize + 3U) / 4U) * 4U) - FwVerified;
+  if(words > FW_UPDATE_VERIFY_STEP)
+  {
+    words = FW_UPDATE_VERIFY_STEP;
+  }
+  words /= 4U;
+
+  if(FwVerified == 0U)
+  {
+    crc = HAL_CRC_Calculate(&FwCrcHandle, (uint32_t *)FwAddress, words);
+  }
+  else
+  {
+    crc = HAL_CRC_Accumulate(&FwCrcHandle, (uint32_t *)(FwAddress + FwVerified), words);
+  }
+  FwVerified += words * 4U;
+
+  if(FwVerified < FwImageSize)
+  {
+    return HAL_OK;
+  }
+
+  if(crc != FwCrc)
+  {
+    FwState = FW_UPDATE_STATE_ERROR;
+    FW_Update_EndCallback(HAL_ERROR);
+    return HAL_ERROR;
+  }
+
+  FwState = FW_UPDATE_STATE_READY;
+  FW_Update_EndCallback(HAL_OK);
+  return HAL_OK;
+}
+
+/**
+  * @brief  Boot the new image: bank swap and system reset
+  * @retval HAL_ERROR, the function does not return otherwise
+  */
+HAL_StatusTypeDef FW_Update_Activate(void)
+{
+  if(FwState != FW_UPDATE_STATE_READY)
+  {
+    return HAL_ERROR;
+  }
+
+  if(FW_Swap() != HAL_OK)
+  {
+    FwState = FW_UPDATE_STATE_ERROR;
+    return HAL_ERROR;
+  }
+
+  NVIC_SystemReset();
+  return HAL_ERROR;
+}
+
+/**
+  * @brief  Drop the update on going. The running erase or program ends in
+  *         the background.
+  * @retval None
+  */
+void FW_Update_Abort(void)
+{
+  if(FwState != FW_UPDATE_STATE_RESET)
+  {
+    FwState = FW_UPDATE_STATE_IDLE;
+    if(FwBusy == 0U)
+    {
+      (void)HAL_FLASH_Lock();
+    }
+  }
+}
+
+/**
+  * @brief  State of the update
+  * @retval State
+  */
+FW_Update_StateTypeDef FW_Update_GetState(void)
+{
+  return FwState;
+}
+
+/**
+  * @brief  Bytes of the image programmed
+  * @retval Bytes
+  */
+uint32_t FW_Update_GetProgress(void)
+{
+  return (FwTail < FwImageSize) ? FwTail : FwImageSize;
+}
+
+/**
+  * @brief  Bank executing the application
+  * @retval 1 or 2
+  */
+uint32_t FW_Update_GetActiveBank(void)
+{
+  return FwActiveBank;
+}
+
+/**
+  * @brief  FLASH interrupt: chain the program operations
+  * @retval None
+  */
+void FW_Update_FLASH_IRQHandler(void)
+{
+  HAL_FLASH_IRQHandler();
+
+  /* The HAL is unlocked once its handler returns */
+  FW_Program();
+}
+
+/**
+  * @brief  End of an erase or program operation
+  * @param  ReturnValue: operation dependent
+  * @retval None
+  */
+void HAL_FLASH_EndOfOperationCallback(uint32_t ReturnValue)
+{
+  UNUSED(ReturnValue);
+
+  if(FwBusy == 0U)
+  {
+    return;
+  }
+
+  if(FwState == FW_UPDATE_STATE_ERASE)
+  {
+    FW_InvalidateCache(FwAddress, FwBankSize);
+    FwState = FW_UPDATE_STATE_PROGRAM;
+  }
+  else if(FwState == FW_UPDATE_STATE_PROGRAM)
+  {
+    FwTail = FwTail + FW_PROGRAM_UNIT;
+  }
+  else
+  {
+    /* Aborted */
+    (void)HAL_FLASH_Lock();
+  }
+  FwBusy = 0U;
+}
+
+/**
+  * @brief  Erase or program error
+  * @param  ReturnValue: operation dependent
+  * @retval None
+  */
+void HAL_FLASH_OperationErrorCallback(uint32_t ReturnValue)
+{
+  UNUSED(ReturnValue);
+
+  if(FwBusy != 0U)
+  {
+    FwBusy = 0U;
+    (void)HAL_FLASH_Lock();
+    if(FwState != FW_UPDATE_STATE_IDLE)
+    {
+      FwState = FW_UPDATE_STATE_ERROR;
+      FW_Update_EndCallback(HAL_ERROR);
+    }
+  }
+}
+
+/**
+  * @brief  End of the update
+  * @param  Status: HAL_OK when the image is valid
+  * @retval None
+  */
+__weak void FW_Update_EndCallback(HAL_StatusTypeDef Status)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Status);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the FW_Update_EndCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Start the program of the next unit, or the CRC check after the last one
+  * @retval None
+  */
+static void FW_Program(void)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint32_t tail;
+  uint32_t offset;
+  HAL_StatusTypeDef status;
+
+  __disable_irq();
+
+  if((FwBusy == 0U) && (FwState == FW_UPDATE_STATE_PROGRAM))
+  {
+    tail = FwTail;
+    if((FwHead - tail) >= FW_PROGRAM_UNIT)
+    {
+      offset = (tail % FW_UPDATE_BUFFER_SIZE) / 4U;
+      FwBusy = 1U;
+      status = HAL_FLASH_Program_IT(FLASH_TYPEPROGRAM_WORD, FwAddress + tail, FwBuffer[offset]);
+      if(status != HAL_OK)
+      {
+        FwBusy  = 0U;
+        FwState = FW_UPDATE_STATE_ERROR;
+        (void)HAL_FLASH_Lock();
+      }
+    }
+    else if((FwFinishing != 0U) && (FwHead == tail))
+    {
+      (void)HAL_FLASH_Lock();
+      FW_InvalidateCache(FwAddress, tail);
+      FwState = FW_UPDATE_STATE_VERIFY;
+    }
+  }
+
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Select the inactive bank for the next boot
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef FW_Swap(void)
+{
+  FLASH_OBProgramInitTypeDef ob;
+  HAL_StatusTypeDef status;
+
+  ob.OptionType = OPTIONBYTE_BOOTADDR_0;
+  /* Boot address option: bits 29:14 of the address */
+  ob.BootAddr0  = FwAddress >> 14U;
+
+  if((HAL_FLASH_Unlock() != HAL_OK) || (HAL_FLASH_OB_Unlock() != HAL_OK))
+  {
+    return HAL_ERROR;
+  }
+
+  status = HAL_FLASHEx_OBProgram(&ob);
+  if(status == HAL_OK)
+  {
+    /* Option bytes loaded: the device resets on some families */
+    status = HAL_FLASH_OB_Launch();
+  }
+
+  (void)HAL_FLASH_OB_Lock();
+  (void)HAL_FLASH_Lock();
+  return status;
+}
+
+/**
+  * @brief  Drop the D-cache lines of an erased or programmed range
+  * @param  Address: start address
+  * @param  Size: size in bytes
+  * @retval None
+  */
+static void FW_InvalidateCache(uint32_t Address, uint32_t Size)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    SCB_InvalidateDCache_by_Addr((uint32_t *)(Address & ~0x1FU), (int32_t)(Size + (Address & 0x1FU)));
+  }
+#else
+  UNUSED(Address);
+  UNUSED(Size);
+#endif
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,104 @@
+/**
+  ******************************************************************************
+  * @file    kv_store.h
+  * @author  MCD Application Team
+  * @brief   Header for kv_store module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _KV_STORE_H__
+#define _KV_STORE_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t StartAddress;  /* Address of the first area                                   */
+  uint32_t AreaSize;      /* Size of an area, in bytes: one erase unit                   */
+  uint32_t AreaNbr;       /* Number of consecutive areas used in turn, 2 at least        */
+  uint32_t FirstSector;   /* FLASH_SECTOR_x of the first area, one sector per area       */
+} KV_Store_InitTypeDef;
+
+typedef struct
+{
+  uint32_t Keys;          /* Keys stored                                                 */
+  uint32_t LiveSize;      /* Flash used by the last value of each key, in bytes          */
+  uint32_t FreeSize;      /* Free space of the active area, in bytes                     */
+  uint32_t Generation;    /* Number of compactions since the last format                 */
+  uint32_t Erases;        /* Areas erased since KV_Store_Init()                          */
+} KV_Store_StatsTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Size of the RAM index, in keys. Override in main.h. */
+#if !defined(KV_STORE_MAX_KEYS)
+#define KV_STORE_MAX_KEYS          64U
+#endif
+
+/* Largest value, in bytes. Override in main.h. */
+#if !defined(KV_STORE_MAX_VALUE_SIZE)
+#define KV_STORE_MAX_VALUE_SIZE    64U
+#endif
+
+/* Fill level of the active area, in percent, from which KV_Store_Process()
+   compacts it. Override in main.h. */
+#if !defined(KV_STORE_COMPACT_LEVEL)
+#define KV_STORE_COMPACT_LEVEL     75U
+#endif
+
+/* Records copied per KV_Store_Process() call while compacting. Override in main.h. */
+#if !defined(KV_STORE_COMPACT_STEP)
+#define KV_STORE_COMPACT_STEP      4U
+#endif
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef KV_Store_Init(const KV_Store_InitTypeDef *pInit);
+HAL_StatusTypeDef KV_Store_Format(void);
+HAL_StatusTypeDef KV_Store_Set(uint16_t Key, const void *pData, uint16_t Length);
+HAL_StatusTypeDef KV_Store_Get(uint16_t Key, void *pData, uint16_t Size, uint16_t *pLength);
+HAL_StatusTypeDef KV_Store_Delete(uint16_t Key);
+HAL_StatusTypeDef KV_Store_Process(void);
+void              KV_Store_GetStats(KV_Store_StatsTypeDef *pStats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _KV_STORE_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,116 @@
+/**
+  ******************************************************************************
+  * @file    nand_ftl.h
+  * @author  MCD Application Team
+  * @brief   Header for nand_ftl module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _NAND_FTL_H__
+#define _NAND_FTL_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "blk_cache.h"
+
+#if !defined(HAL_NAND_MODULE_ENABLED)
+#error "nand_ftl requires the NAND HAL driver"
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t  BadBlocks;        /* Factory and grown bad blocks                   */
+  uint32_t  FreeBlocks;       /* Blocks holding no data                         */
+  uint32_t  Writes;           /* Pages programmed for the block device          */
+  uint32_t  Moves;            /* Pages copied by the garbage collection         */
+  uint32_t  Collections;      /* Blocks reclaimed by the garbage collection     */
+  uint32_t  Corrected;        /* Pages read with a single bit error, corrected  */
+  uint32_t  Uncorrectable;    /* Pages read with more bit errors                */
+  uint32_t  ProgramErrors;    /* Program failures, block retired                */
+  uint32_t  EraseErrors;      /* Erase failures, block retired                  */
+} NAND_FTL_StatsTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Largest NAND geometry handled: page and spare area in bytes, pages per
+   block and blocks. Override in main.h. */
+#if !defined(NAND_FTL_PAGE_SIZE)
+#define NAND_FTL_PAGE_SIZE         2048U
+#endif
+#if !defined(NAND_FTL_SPARE_SIZE)
+#define NAND_FTL_SPARE_SIZE        64U
+#endif
+#if !defined(NAND_FTL_BLOCK_PAGES)
+#define NAND_FTL_BLOCK_PAGES       64U
+#endif
+#if !defined(NAND_FTL_MAX_BLOCKS)
+#define NAND_FTL_MAX_BLOCKS        1024U
+#endif
+
+/* Blocks kept out of the capacity for bad blocks and garbage collection.
+   Override in main.h. */
+#if !defined(NAND_FTL_RESERVED_BLOCKS)
+#define NAND_FTL_RESERVED_BLOCKS   24U
+#endif
+
+/* NAND_FTL_Process() reclaims blocks while fewer are free. Override in main.h. */
+#if !defined(NAND_FTL_GC_BLOCKS)
+#define NAND_FTL_GC_BLOCKS         4U
+#endif
+
+/* Section of the page mapping table, to be placed in SDRAM or AXI SRAM by the
+   linker script. Override in main.h. */
+#if !defined(NAND_FTL_SECTION)
+#define NAND_FTL_SECTION           ".nand_ftl"
+#endif
+
+/* Exported variables --------------------------------------------------------*/
+/* Flash translation layer seen as a block device */
+extern const BLK_DeviceTypeDef NAND_FTL_Device;
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef NAND_FTL_Init(NAND_HandleTypeDef *hnand);
+HAL_StatusTypeDef NAND_FTL_Format(void);
+void              NAND_FTL_Process(void);
+void              NAND_FTL_GetStats(NAND_FTL_StatsTypeDef *pStats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _NAND_FTL_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,544 @@
+/**
+  ******************************************************************************
+  * @file    nor_async.c
+  * @author  MCD Application Team
+  * @brief   Queued NOR flash engine: buffer programs and block erases
+  *          driven by a periodic tick or the Ready/Busy interrupt, erase
+  *          suspend for the reads
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- initialize the FMC and the memory with the board driver (BSP_NOR_Init()),
+   fill BaseAddress (NOR_DEVICE_ADDR), Size and BlockSize and call
+   NOR_Async_Init(). The memory must be 16-bit wide with the AMD command set,
+   as the PC28F128M29EW of the evaluation boards (16 MBytes, 128-KByte
+   blocks).
+
+2- call NOR_Async_Process() periodically, from a timer interrupt at 1 kHz or
+   more for instance, and from HAL_GPIO_EXTI_Callback() on the rising edge of
+   the Ready/Busy pin (NOR_READY_BUSY_PIN) so that the next operation starts
+   as soon as the memory is ready. It may also be called from the main loop;
+   a call made while another one runs returns at once.
+
+3- NOR_Async_Program() and NOR_Async_Erase() queue a request and return at
+   once; the data of a program is read from pData while it runs and must be
+   kept until the request Callback is called, with Status HAL_OK, HAL_ERROR
+   or HAL_TIMEOUT. Programs are sent by write buffer of up to
+   NOR_ASYNC_BUFFER_WORDS half-words, which programs about 10 times faster
+   than the single half-word program of BSP_NOR_WriteData(). Requests are
+   served in order.
+
+4- NOR_Async_Read() reads the memory while it programs or erases: an erase
+   in progress is suspended for the read and resumed after it, a buffer
+   program is let finish (less than 1 ms). Reading the block being erased
+   returns HAL_BUSY. Code executed or data read directly from the memory
+   must be bracketed the same way by NOR_Async_Hold()/NOR_Async_Release():
+   while held, the memory stays in read mode and no operation starts.
+   Call them from the main loop or an interrupt of lower or equal priority
+   than the ones calling NOR_Async_Process(). An erase progresses only
+   between suspends: holding the memory most of the time delays it.
+
+5- NOR_Async_IsIdle() tells that no request is pending, before a low-power
+   mode or a reset for instance. blk_nor.c maps the module on the block
+   device interface of blk_cache.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "nor_async.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define NOR_ASYNC_STATE_IDLE         0U
+#define NOR_ASYNC_STATE_PROGRAM      1U   /* Buffer program in progress       */
+#define NOR_ASYNC_STATE_ERASE        2U   /* Block erase in progress          */
+#define NOR_ASYNC_STATE_SUSPENDED    3U   /* Block erase suspended            */
+
+#define NOR_POLL_ONGOING             0U
+#define NOR_POLL_DONE                1U
+#define NOR_POLL_ERROR               2U
+
+/* Command addresses of a 16-bit memory, in bytes */
+#define NOR_CMD_ADDRESS_FIRST        (0x0555U * 2U)
+#define NOR_CMD_ADDRESS_SECOND       (0x02AAU * 2U)
+
+#define NOR_CMD_DATA_FIRST           0x00AAU
+#define NOR_CMD_DATA_SECOND          0x0055U
+#define NOR_CMD_DATA_READ_RESET      0x00F0U
+#define NOR_CMD_DATA_ERASE_SETUP     0x0080U
+#define NOR_CMD_DATA_BLOCK_ERASE     0x0030U
+#define NOR_CMD_DATA_BUFFER_PROG     0x0025U
+#define NOR_CMD_DATA_BUFFER_CONFIRM  0x0029U
+#define NOR_CMD_DATA_ERASE_SUSPEND   0x00B0U
+#define NOR_CMD_DATA_ERASE_RESUME    0x0030U
+
+#define NOR_STATUS_DQ5               0x0020U
+#define NOR_STATUS_DQ6               0x0040U
+
+/* Private macro -------------------------------------------------------------*/
+#define NOR_WRITE_CMD(__N__, __OFFSET__, __DATA__)  do{                                                                   \
+                                                      *(__IO uint16_t *)((__N__)->BaseAddress + (__OFFSET__)) = (__DATA__); \
+                                                      __DSB();                                                            \
+                                                    } while(0)
+#define NOR_READ(__N__, __OFFSET__)                 (*(__IO uint16_t *)((__N__)->BaseAddress + (__OFFSET__)))
+
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static HAL_StatusTypeDef NOR_Queue(NOR_AsyncTypeDef *pNor, NOR_Async_RequestTypeDef *pRequest);
+static void              NOR_Start(NOR_AsyncTypeDef *pNor);
+static void              NOR_Complete(NOR_AsyncTypeDef *pNor, HAL_StatusTypeDef Status);
+static uint32_t          NOR_Poll(NOR_AsyncTypeDef *pNor);
+static void              NOR_Reset(NOR_AsyncTypeDef *pNor);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Checks the configuration and puts the memory in read mode.
+  * @param  pNor: NOR handle, application fields filled
+  * @retval HAL status
+  */
+HAL_StatusTypeDef NOR_Async_Init(NOR_AsyncTypeDef *pNor)
+{
+  if ((pNor == NULL) || (pNor->Size == 0U) || (pNor->BlockSize == 0U) ||
+      ((pNor->BlockSize & (pNor->BlockSize - 1U)) != 0U) || ((pNor->Size % pNor->BlockSize) != 0U) ||
+      ((NOR_ASYNC_BUFFER_WORDS & (NOR_ASYNC_BUFFER_WORDS - 1U)) != 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  pNor->State      = NOR_ASYNC_STATE_IDLE;
+  pNor->Holds      = 0U;
+  pNor->Processing = 0U;
+  pNor->pHead      = NULL;
+  pNor->pTail      = NULL;
+  pNor->Programs   = 0U;
+  pNor->Erases     = 0U;
+  pNor->Suspends   = 0U;
+  pNor->Failures   = 0U;
+
+  NOR_Reset(pNor);
+  return HAL_OK;
+}
+
+/**
+  * @brief  Queues the program of half-words. The range must be erased.
+  * @param  pNor: NOR handle
+  * @param  Address: first byte address in the memory, even
+  * @param  pData: data, kept until the request Callback is called
+  * @param  Size: half-words to program
+  * @param  pRequest: request, owned by the module until its Callback is called
+  * @retval HAL status
+  */
+HAL_StatusTypeDef NOR_Async_Program(NOR_AsyncTypeDef *pNor, uint32_t Address, const uint16_t *pData,
+                                    uint32_t Size, NOR_Async_RequestTypeDef *pRequest)
+{
+  if ((pRequest == NULL) || (pData == NULL) || (Size == 0U) || ((Address & 1U) != 0U) ||
+      (Address >= pNor->Size) || (Size > ((pNor->Size - Address) / 2U)))
+  {
+    return HAL_ERROR;
+  }
+
+  pRequest->Operation = NOR_ASYNC_PROGRAM;
+  pRequest->Address   = Address;
+  pRequest->pData     = pData;
+  pRequest->Size      = Size;
+  return NOR_Queue(pNor, pRequest);
+}
+
+/**
+  * @brief  Queues the erase of a block.
+  * @param  pNor: NOR handle
+  * @param  BlockAddress: byte address of the block in the memory
+  * @param  pRequest: request, owned by the module until its Callback is called
+  * @retval HAL status
+  */
+HAL_StatusTypeDef NOR_Async_Erase(NOR_AsyncTypeDef *pNor, uint32_t BlockAddress, NOR_Async_RequestTypeDef *pRequest)
+{
+  if ((pRequest == NULL) || (BlockAddress >= pNor->Size))
+  {
+    return HAL_ERROR;
+  }
+
+  pRequest->Operation = NOR_ASYNC_ERASE;
+  pRequest->Address   = BlockAddress & ~(pNor->BlockSize - 1U);
+  pRequest->pData     = NULL;
+  pRequest->Size      = 0U;
+  return NOR_Queue(pNor, pRequest);
+}
+
+/**
+  * @brief  Reads half-words, suspending the erase in progress if any.
+  * @param  pNor: NOR handle
+  * @param  Address: first byte address in the memory, even
+  * @param  pData: destination
+  * @param  Size: half-words to read
+  * @retval HAL status, HAL_BUSY when the range is being erased
+  */
+HAL_StatusTypeDef NOR_Async_Read(NOR_AsyncTypeDef *pNor, uint32_t Address, uint16_t *pData, uint32_t Size)
+{
+  HAL_StatusTypeDef status;
+  uint32_t i;
+
+  if (((Address & 1U) != 0U) || (Address > pNor->Size) || (Size > ((pNor->Size - Address) / 2U)))
+  {
+    return HAL_ERROR;
+  }
+
+  status = NOR_Async_Hold(pNor);
+  if ((status == HAL_OK) && (pNor->State == NOR_ASYNC_STATE_SUSPENDED) &&
+      (pNor->OpAddress < (Address + (Size * 2U))) && (Address < (pNor->OpAddress + pNor->BlockSize)))
+  {
+    /* The block under erase returns status bits */
+    status = HAL_BUSY;
+  }
+  if (status == HAL_OK)
+  {
+    for (i = 0U; i < Size; i++)
+    {
+      pData[i] = NOR_READ(pNor, Address + (i * 2U));
+    }
+  }
+  NOR_Async_Release(pNor);
+
+  return status;
+}
+
+/**
+  * @brief  Puts the memory in read mode until NOR_Async_Release(): suspends
+  *         the erase in progress, or waits for the end of the buffer program.
+  * @param  pNor: NOR handle
+  * @retval HAL status. NOR_Async_Release() must be called in any case.
+  */
+HAL_StatusTypeDef NOR_Async_Hold(NOR_AsyncTypeDef *pNor)
+{
+  uint32_t tickstart;
+  uint32_t timeout;
+  uint32_t poll;
+
+  pNor->Holds++;
+  if (pNor->Holds != 1U)
+  {
+    return HAL_OK;
+  }
+
+  if (pNor->State == NOR_ASYNC_STATE_ERASE)
+  {
+    NOR_WRITE_CMD(pNor, pNor->OpAddress, NOR_CMD_DATA_ERASE_SUSPEND);
+    pNor->SuspendTick = HAL_GetTick();
+    pNor->State       = NOR_ASYNC_STATE_SUSPENDED;
+    pNor->Suspends++;
+    timeout = NOR_ASYNC_SUSPEND_TIMEOUT;
+  }
+  else if (pNor->State == NOR_ASYNC_STATE_PROGRAM)
+  {
+    timeout = NOR_ASYNC_PROGRAM_TIMEOUT;
+  }
+  else
+  {
+    return HAL_OK;
+  }
+
+  /* DQ6 stops toggling once suspended or programmed. The operation is then
+     completed by NOR_Async_Process(), after the release */
+  tickstart = HAL_GetTick();
+  do
+  {
+    poll = NOR_Poll(pNor);
+    if (poll == NOR_POLL_ERROR)
+    {
+      return HAL_ERROR;
+    }
+    if ((poll == NOR_POLL_ONGOING) && ((HAL_GetTick() - tickstart) > timeout))
+    {
+      return HAL_TIMEOUT;
+    }
+  } while (poll != NOR_POLL_DONE);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Ends a NOR_Async_Hold(): the suspended erase is resumed.
+  * @param  pNor: NOR handle
+  * @retval None
+  */
+void NOR_Async_Release(NOR_AsyncTypeDef *pNor)
+{
+  if (pNor->Holds == 0U)
+  {
+    return;
+  }
+
+  pNor->Holds--;
+  if ((pNor->Holds == 0U) && (pNor->State == NOR_ASYNC_STATE_SUSPENDED))
+  {
+    /* A resume of a completed erase is ignored by the memory */
+    NOR_WRITE_CMD(pNor, pNor->OpAddress, NOR_CMD_DATA_ERASE_RESUME);
+    pNor->StartTick += HAL_GetTick() - pNor->SuspendTick;
+    pNor->State      = NOR_ASYNC_STATE_ERASE;
+  }
+}
+
+/**
+  * @brief  Tells whether requests are pending.
+  * @param  pNor: NOR handle
+  * @retval 1 when no request is pending, 0 otherwise
+  */
+uint32_t NOR_Async_IsIdle(NOR_AsyncTypeDef *pNor)
+{
+  return (pNor->pHead == NULL) ? 1U : 0U;
+}
+
+/**
+  * @brief  Checks the operation in progress and starts the next one.
+  * @param  pNor: NOR handle
+  * @retval None
+  */
+void NOR_Async_Process(NOR_AsyncTypeDef *pNor)
+{
+  NOR_Async_RequestTypeDef *request;
+  uint32_t poll;
+
+  if ((pNor->Processing != 0U) || (pNor->Holds != 0U))
+  {
+    return;
+  }
+  pNor->Processing = 1U;
+
+  if (pNor->State == NOR_ASYNC_STATE_IDLE)
+  {
+    NOR_Start(pNor);
+  }
+  else
+  {
+    poll = NOR_Poll(pNor);
+    if (poll == NOR_POLL_ERROR)
+    {
+      NOR_Reset(pNor);
+      NOR_Complete(pNor, HAL_ERROR);
+    }
+    else if (poll == NOR_POLL_ONGOING)
+    {
+      if ((HAL_GetTick() - pNor->StartTick) >
+          ((pNor->State == NOR_ASYNC_STATE_ERASE) ? NOR_ASYNC_ERASE_TIMEOUT : NOR_ASYNC_PROGRAM_TIMEOUT))
+      {
+        NOR_Reset(pNor);
+        NOR_Complete(pNor, HAL_TIMEOUT);
+      }
+    }
+    else if (pNor->State == NOR_ASYNC_STATE_ERASE)
+    {
+      pNor->Erases++;
+      NOR_Complete(pNor, HAL_OK);
+    }
+    else
+    {
+      /* Next buffer of the program */
+      request = pNor->pHead;
+      request->Address += pNor->Chunk * 2U;
+      request->pData   += pNor->Chunk;
+      request->Size    -= pNor->Chunk;
+      pNor->Programs++;
+      if (request->Size == 0U)
+      {
+        NOR_Complete(pNor, HAL_OK);
+      }
+      else
+      {
+        pNor->State = NOR_ASYNC_STATE_IDLE;
+        NOR_Start(pNor);
+      }
+    }
+  }
+
+  pNor->Processing = 0U;
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Appends a request to the queue.
+  * @param  pNor: NOR handle
+  * @param  pRequest: request, operation filled
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef NOR_Queue(NOR_AsyncTypeDef *pNor, NOR_Async_RequestTypeDef *pRequest)
+{
+  uint32_t primask;
+
+  pRequest->Status = HAL_BUSY;
+  pRequest->pNext  = NULL;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (pNor->pHead == NULL)
+  {
+    pNor->pHead = pRequest;
+  }
+  else
+  {
+    pNor->pTail->pNext = pRequest;
+  }
+  pNor->pTail = pRequest;
+  __set_PRIMASK(primask);
+
+  /* Started at once when the memory is idle */
+  NOR_Async_Process(pNor);
+  return HAL_OK;
+}
+
+/**
+  * @brief  Sends the command of the request at the head of the queue.
+  * @param  pNor: NOR handle
+  * @retval None
+  */
+static void NOR_Start(NOR_AsyncTypeDef *pNor)
+{
+  NOR_Async_RequestTypeDef *request = pNor->pHead;
+  uint32_t word;
+  uint32_t i;
+
+  if (request == NULL)
+  {
+    return;
+  }
+
+  NOR_WRITE_CMD(pNor, NOR_CMD_ADDRESS_FIRST, NOR_CMD_DATA_FIRST);
+  NOR_WRITE_CMD(pNor, NOR_CMD_ADDRESS_SECOND, NOR_CMD_DATA_SECOND);
+
+  if (request->Operation == NOR_ASYNC_ERASE)
+  {
+    NOR_WRITE_CMD(pNor, NOR_CMD_ADDRESS_FIRST, NOR_CMD_DATA_ERASE_SETUP);
+    NOR_WRITE_CMD(pNor, NOR_CMD_ADDRESS_FIRST, NOR_CMD_DATA_FIRST);
+    NOR_WRITE_CMD(pNor, NOR_CMD_ADDRESS_SECOND, NOR_CMD_DATA_SECOND);
+    NOR_WRITE_CMD(pNor, request->Address, NOR_CMD_DATA_BLOCK_ERASE);
+    pNor->OpAddress = request->Address;
+    pNor->State     = NOR_ASYNC_STATE_ERASE;
+  }
+  else
+  {
+    /* Up to the end of the write buffer page */
+    word        = request->Address / 2U;
+    pNor->Chunk = NOR_ASYNC_BUFFER_WORDS - (word & (NOR_ASYNC_BUFFER_WORDS - 1U));
+    if (pNor->Chunk > request->Size)
+    {
+      pNor->Chunk = request->Size;
+    }
+
+    NOR_WRITE_CMD(pNor, request->Address, NOR_CMD_DATA_BUFFER_PROG);
+    NOR_WRITE_CMD(pNor, request->Address, (uint16_t)(pNor->Chunk - 1U));
+    for (i = 0U; i < pNor->Chunk; i++)
+    {
+      *(__IO uint16_t *)(pNor->BaseAddress + request->Address + (i * 2U)) = request->pData[i];
+    }
+    pNor->OpAddress = request->Address + ((pNor->Chunk - 1U) * 2U);
+    NOR_WRITE_CMD(pNor, pNor->OpAddress, NOR_CMD_DATA_BUFFER_CONFIRM);
+    pNor->State = NOR_ASYNC_STATE_PROGRAM;
+  }
+  pNor->StartTick = HAL_GetTick();
+}
+
+/**
+  * @brief  Ends the request at the head of the queue and starts the next one.
+  * @param  pNor: NOR handle
+  * @param  Status: status given to the request
+  * @retval None
+  */
+static void NOR_Complete(NOR_AsyncTypeDef *pNor, HAL_StatusTypeDef Status)
+{
+  NOR_Async_RequestTypeDef *request;
+  uint32_t primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  request     = pNor->pHead;
+  pNor->pHead = request->pNext;
+  __set_PRIMASK(primask);
+
+  pNor->State = NOR_ASYNC_STATE_IDLE;
+  if (Status != HAL_OK)
+  {
+    pNor->Failures++;
+  }
+
+  request->Status = Status;
+  if (request->Callback != NULL)
+  {
+    request->Callback(request);
+  }
+
+  NOR_Start(pNor);
+}
+
+/**
+  * @brief  Reads the toggle bits of the operation in progress.
+  * @param  pNor: NOR handle
+  * @retval NOR_POLL_ONGOING, NOR_POLL_DONE or NOR_POLL_ERROR
+  */
+static uint32_t NOR_Poll(NOR_AsyncTypeDef *pNor)
+{
+  uint16_t sr1;
+  uint16_t sr2;
+
+  sr1 = NOR_READ(pNor, pNor->OpAddress);
+  sr2 = NOR_READ(pNor, pNor->OpAddress);
+  if (((sr1 ^ sr2) & NOR_STATUS_DQ6) == 0U)
+  {
+    return NOR_POLL_DONE;
+  }
+  if ((sr2 & NOR_STATUS_DQ5) == 0U)
+  {
+    return NOR_POLL_ONGOING;
+  }
+
+  /* DQ5 set: failed if still toggling */
+  sr1 = NOR_READ(pNor, pNor->OpAddress);
+  sr2 = NOR_READ(pNor, pNor->OpAddress);
+  return (((sr1 ^ sr2) & NOR_STATUS_DQ6) == 0U) ? NOR_POLL_DONE : NOR_POLL_ERROR;
+}
+
+/**
+  * @brief  Aborts the operation in progress and returns to read mode.
+  * @param  pNor: NOR handle
+  * @retval None
+  */
+static void NOR_Reset(NOR_AsyncTypeDef *pNor)
+{
+  /* The unlocked reset also leaves the write-to-buffer abort state */
+  NOR_WRITE_CMD(pNor, NOR_CMD_ADDRESS_FIRST, NOR_CMD_DATA_FIRST);
+  NOR_WRITE_CMD(pNor, NOR_CMD_ADDRESS_SECOND, NOR_CMD_DATA_SECOND);
+  NOR_WRITE_CMD(pNor, 0U, NOR_CMD_DATA_READ_RESET);
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
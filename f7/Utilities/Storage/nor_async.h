@@ -0,0 +1,129 @@
+/**
+  ******************************************************************************
+  * @file    nor_async.h
+  * @author  MCD Application Team
+  * @brief   Header for nor_async module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _NOR_ASYNC_H__
+#define _NOR_ASYNC_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported constants --------------------------------------------------------*/
+/* Half-words per buffer program, up to the write buffer of the memory and a
+   power of 2. Override in main.h. */
+#if !defined(NOR_ASYNC_BUFFER_WORDS)
+#define NOR_ASYNC_BUFFER_WORDS       256U
+#endif
+
+/* Longest buffer program, in ms. Override in main.h. */
+#if !defined(NOR_ASYNC_PROGRAM_TIMEOUT)
+#define NOR_ASYNC_PROGRAM_TIMEOUT    10U
+#endif
+
+/* Longest block erase, in ms, the suspended time excluded. Override in main.h. */
+#if !defined(NOR_ASYNC_ERASE_TIMEOUT)
+#define NOR_ASYNC_ERASE_TIMEOUT      4000U
+#endif
+
+/* Longest erase suspend latency, in ms. Override in main.h. */
+#if !defined(NOR_ASYNC_SUSPEND_TIMEOUT)
+#define NOR_ASYNC_SUSPEND_TIMEOUT    2U
+#endif
+
+#define NOR_ASYNC_PROGRAM            0U
+#define NOR_ASYNC_ERASE              1U
+
+/* Exported types ------------------------------------------------------------*/
+/* Owned by the module from NOR_Async_Program()/NOR_Async_Erase() until
+   Callback is called */
+typedef struct __NOR_Async_RequestTypeDef
+{
+  void                               (*Callback)(struct __NOR_Async_RequestTypeDef *pRequest); /* May be NULL */
+  void                               *pContext;   /* Free for the caller                       */
+  __IO HAL_StatusTypeDef             Status;      /* HAL_BUSY until done                       */
+  uint32_t                           Operation;   /* Reserved for the module                   */
+  uint32_t                           Address;
+  const uint16_t                     *pData;
+  uint32_t                           Size;        /* Half-words left to program                */
+  struct __NOR_Async_RequestTypeDef  *pNext;
+} NOR_Async_RequestTypeDef;
+
+typedef struct
+{
+  /* Set by the application before NOR_Async_Init() */
+  uint32_t                   BaseAddress;   /* FMC bank of the memory, NOR_DEVICE_ADDR       */
+  uint32_t                   Size;          /* Bytes of the memory                           */
+  uint32_t                   BlockSize;     /* Bytes of an erase block                       */
+
+  /* Reserved for the module */
+  __IO uint32_t              State;
+  __IO uint32_t              Holds;         /* Nested NOR_Async_Hold()                       */
+  __IO uint32_t              Processing;    /* NOR_Async_Process() running                   */
+  uint32_t                   OpAddress;     /* Block erased or last half-word programmed     */
+  uint32_t                   Chunk;         /* Half-words of the buffer program in progress  */
+  uint32_t                   StartTick;     /* Start of the operation, suspended time added  */
+  uint32_t                   SuspendTick;
+  NOR_Async_RequestTypeDef   *pHead;        /* Request in progress, then the queued ones     */
+  NOR_Async_RequestTypeDef   *pTail;
+  uint32_t                   Programs;      /* Buffer programs done                          */
+  uint32_t                   Erases;        /* Block erases done                             */
+  uint32_t                   Suspends;      /* Erases suspended for a read                   */
+  uint32_t                   Failures;      /* Requests ended in error                       */
+} NOR_AsyncTypeDef;
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef NOR_Async_Init(NOR_AsyncTypeDef *pNor);
+HAL_StatusTypeDef NOR_Async_Program(NOR_AsyncTypeDef *pNor, uint32_t Address, const uint16_t *pData,
+                                    uint32_t Size, NOR_Async_RequestTypeDef *pRequest);
+HAL_StatusTypeDef NOR_Async_Erase(NOR_AsyncTypeDef *pNor, uint32_t BlockAddress, NOR_Async_RequestTypeDef *pRequest);
+HAL_StatusTypeDef NOR_Async_Read(NOR_AsyncTypeDef *pNor, uint32_t Address, uint16_t *pData, uint32_t Size);
+HAL_StatusTypeDef NOR_Async_Hold(NOR_AsyncTypeDef *pNor);
+void              NOR_Async_Release(NOR_AsyncTypeDef *pNor);
+uint32_t          NOR_Async_IsIdle(NOR_AsyncTypeDef *pNor);
+void              NOR_Async_Process(NOR_AsyncTypeDef *pNor);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _NOR_ASYNC_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,633 @@
+/**
+  ******************************************************************************
+  * @file    qspi_xip.c
+  * @author  MCD Application Team
+  * @brief   Execute-in-place QSPI manager: memory mapped reads interleaved
+  *          with indirect program and suspended erase
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- initialize the memory with the BSP (BSP_QSPI_Init()), then call
+   QSPI_XIP_Init() with the BSP QSPI handle and the commands of the memory
+   in the mode left by the BSP. For the MX25L512 of the STM32F769I-Discovery
+   (QPI mode, 4-byte address):
+      - CommandLines QSPI_INSTRUCTION_4_LINES, AddressSize QSPI_ADDRESS_32_BITS
+      - ReadInstruction QSPI_READ_4_BYTE_ADDR_CMD, 4-line address and data,
+        ReadDummyCycles MX25L512_DUMMY_CYCLES_READ_QUAD_IO - 2, ModeByte 0xA5
+        (performance enhance mode), ModeByteExit 0xFF
+      - ProgramInstruction QPI_PAGE_PROG_4_BYTE_ADDR_CMD, MX25L512_PAGE_SIZE
+      - EraseInstruction SUBSECTOR_ERASE_4_BYTE_ADDR_CMD, MX25L512_SUBSECTOR_SIZE,
+        MX25L512_SUBSECTOR_ERASE_MAX_TIME, PROG_ERASE_SUSPEND_CMD and
+        PROG_ERASE_RESUME_CMD
+      - WRITE_ENABLE_CMD, READ_STATUS_REG_CMD, MX25L512_SR_WIP, MX25L512_SR_WREN
+   Quad DTR read is selected with ReadDdrMode QSPI_DDR_MODE_ENABLE, the DTR
+   instruction and the DTR dummy cycles of the memory.
+
+2- the memory is then memory mapped at QSPI_BASE. With a mode byte, the
+   memory stays in continuous read mode and the QUADSPI sends the read
+   instruction only once (SIOO): each new access costs the address, mode
+   byte and dummy cycles only.
+   On Cortex-M7, configure the region with the MPU as normal cacheable
+   memory, no further than the size of the memory.
+
+3- QSPI_XIP_Write() programs page by page. Each page is programmed in
+   indirect mode with the interrupts masked, then the memory mapped mode is
+   restored: code and assets in the QSPI memory are stalled for one page
+   program time at most. The data must not be in the QSPI memory.
+
+4- QSPI_XIP_EraseStart() starts the erase of one sector, then
+   QSPI_XIP_Process() must be called until QSPI_XIP_EraseCpltCallback().
+   Each call resumes the erase for QSPI_XIP_ERASE_SLICE_US then suspends
+   it and restores the memory mapped mode, so the application goes on
+   executing in place between the steps. Reads of the sector being erased
+   return HAL_BUSY. Memories without suspend erase in one step.
+
+5- the functions of this module and the QSPI HAL driver must be located in
+   the internal flash or RAM, not in the QSPI memory. The D-cache lines of
+   the programmed and erased areas are invalidated.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "qspi_xip.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Longest erase suspend latency, in us */
+#define XIP_SUSPEND_TIME_US      1000U
+/* Longest write enable latency, in us */
+#define XIP_WEL_TIME_US          100U
+
+/* Private macro -------------------------------------------------------------*/
+#define XIP_US_TO_CYCLES(__US__)  ((SystemCoreClock / 1000000U) * (__US__))
+
+/* Mode byte lines, those of the read address */
+#define XIP_ALTERNATE_LINES(__ADDRESS_MODE__) \
+  (((__ADDRESS_MODE__) == QSPI_ADDRESS_4_LINES) ? QSPI_ALTERNATE_BYTES_4_LINES : \
+   (((__ADDRESS_MODE__) == QSPI_ADDRESS_2_LINES) ? QSPI_ALTERNATE_BYTES_2_LINES : QSPI_ALTERNATE_BYTES_1_LINE))
+
+/* Private variables ---------------------------------------------------------*/
+static QSPI_HandleTypeDef     *XipHandle;
+static QSPI_XIP_DeviceTypeDef  XipDevice;
+static __IO QSPI_XIP_StateTypeDef XipState = QSPI_XIP_STATE_RESET;
+
+static uint32_t XipEraseAddress;  /* Sector being erased                 */
+static uint32_t XipEraseIssued;   /* Erase command sent                  */
+static uint32_t XipEraseSlices;   /* Steps run, to time the erase out    */
+
+/* Private function prototypes -----------------------------------------------*/
+static HAL_StatusTypeDef Xip_Map(void);
+static HAL_StatusTypeDef Xip_Unmap(void);
+static void              Xip_InitCommand(QSPI_CommandTypeDef *pCommand, uint32_t Instruction);
+static HAL_StatusTypeDef Xip_Instruction(uint32_t Instruction, uint32_t WithAddress, uint32_t Address);
+static HAL_StatusTypeDef Xip_WaitStatus(uint32_t Mask, uint32_t Match, uint32_t Cycles);
+static HAL_StatusTypeDef Xip_WriteEnable(void);
+static void              Xip_InvalidateCache(uint32_t Address, uint32_t Size);
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Take over an initialized QSPI memory and map it
+  * @param  hqspi: QSPI handle, initialized with its memory
+  * @param  pDevice: commands of the memory, copied
+  * @retval HAL status
+  */
+HAL_StatusTypeDef QSPI_XIP_Init(QSPI_HandleTypeDef *hqspi, const QSPI_XIP_DeviceTypeDef *pDevice)
+{
+  if((hqspi == NULL) || (pDevice == NULL) || (XipState == QSPI_XIP_STATE_ERASE) ||
+     (pDevice->PageSize == 0U) || (pDevice->EraseSize == 0U) ||
+     ((pDevice->EraseSize & (pDevice->EraseSize - 1U)) != 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  XipHandle = hqspi;
+  XipDevice = *pDevice;
+
+  /* Leave a memory mapped mode set by the BSP, without a mode byte */
+  if(XipHandle->State == HAL_QSPI_STATE_BUSY_MEM_MAPPED)
+  {
+    if(HAL_QSPI_Abort(XipHandle) != HAL_OK)
+    {
+      XipState = QSPI_XIP_STATE_ERROR;
+      return HAL_ERROR;
+    }
+  }
+
+  /* Enable the DWT cycle counter to time the indirect steps */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#if (__CORTEX_M == 7U)
+  DWT->LAR = 0xC5ACCE55U;
+#endif
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  if(Xip_Map() != HAL_OK)
+  {
+    XipState = QSPI_XIP_STATE_ERROR;
+    return HAL_ERROR;
+  }
+  XipState = QSPI_XIP_STATE_MAPPED;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Leave the memory mapped mode, the memory in indirect mode
+  * @note   A pending erase is abandoned in its suspended state.
+  * @param  None
+  * @retval HAL status
+  */
+HAL_StatusTypeDef QSPI_XIP_DeInit(void)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if(XipState == QSPI_XIP_STATE_RESET)
+  {
+    return HAL_OK;
+  }
+
+  if(XipHandle->State == HAL_QSPI_STATE_BUSY_MEM_MAPPED)
+  {
+    status = Xip_Unmap();
+  }
+  XipState = QSPI_XIP_STATE_RESET;
+
+  return status;
+}
+
+/**
+  * @brief  Read the memory through the memory mapped region
+  * @param  Address: memory address
+  * @param  pData: destination
+  * @param  Size: number of bytes
+  * @retval HAL status, HAL_BUSY if the area is being erased
+  */
+HAL_StatusTypeDef QSPI_XIP_Read(uint32_t Address, uint8_t *pData, uint32_t Size)
+{
+  if((XipState != QSPI_XIP_STATE_MAPPED) && (XipState != QSPI_XIP_STATE_ERASE))
+  {
+    return HAL_ERROR;
+  }
+
+  if((XipState == QSPI_XIP_STATE_ERASE) &&
+     (Address < (XipEraseAddress + XipDevice.EraseSize)) && ((Address + Size) > XipEraseAddress))
+  {
+    return HAL_BUSY;
+  }
+
+  memcpy(pData, QSPI_XIP_ADDRESS(Address), Size);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Program the memory page by page, back to memory mapped mode
+  *         between the pages
+  * @param  Address: memory address, erased
+  * @param  pData: source, not in the QSPI memory
+  * @param  Size: number of bytes
+  * @retval HAL status, HAL_BUSY while an erase is pending
+  */
+HAL_StatusTypeDef QSPI_XIP_Write(uint32_t Address, const uint8_t *pData, uint32_t Size)
+{
+  QSPI_CommandTypeDef s_command;
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t primask;
+  uint32_t current_size;
+
+  if(XipState == QSPI_XIP_STATE_ERASE)
+  {
+    return HAL_BUSY;
+  }
+  if(XipState != QSPI_XIP_STATE_MAPPED)
+  {
+    return HAL_ERROR;
+  }
+
+  Xip_InitCommand(&s_command, XipDevice.ProgramInstruction);
+  s_command.AddressMode = XipDevice.ProgramAddressMode;
+  s_command.DataMode    = XipDevice.ProgramDataMode;
+
+  while((Size > 0U) && (status == HAL_OK))
+  {
+    /* Up to the end of the page */
+    current_size = XipDevice.PageSize - (Address % XipDevice.PageSize);
+    if(current_size > Size)
+    {
+      current_size = Size;
+    }
+    s_command.Address = Address;
+    s_command.NbData  = current_size;
+
+    /* No interrupt handler may fetch from the memory meanwhile */
+    primask = __get_PRIMASK();
+    __disable_irq();
+
+    status = Xip_Unmap();
+    if(status == HAL_OK)
+    {
+      status = Xip_WriteEnable();
+    }
+    if(status == HAL_OK)
+    {
+      status = HAL_QSPI_Command(XipHandle, &s_command, HAL_QPSI_TIMEOUT_DEFAULT_VALUE);
+    }
+    if(status == HAL_OK)
+    {
+      status = HAL_QSPI_Transmit(XipHandle, (uint8_t *)pData, HAL_QPSI_TIMEOUT_DEFAULT_VALUE);
+    }
+    if(status == HAL_OK)
+    {
+      status = Xip_WaitStatus(XipDevice.StatusBusyMask, 0U,
+                              XIP_US_TO_CYCLES(XipDevice.PageProgramTime * 1000U));
+    }
+    if(Xip_Map() != HAL_OK)
+    {
+      status = HAL_ERROR;
+    }
+
+    __set_PRIMASK(primask);
+
+    Xip_InvalidateCache(Address, current_size);
+    Address += current_size;
+    pData   += current_size;
+    Size    -= current_size;
+  }
+
+  if(status != HAL_OK)
+  {
+    XipState = QSPI_XIP_STATE_ERROR;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Start the erase of a sector, to be completed by QSPI_XIP_Process()
+  * @param  Address: any memory address in the sector
+  * @retval HAL status, HAL_BUSY while another erase is pending
+  */
+HAL_StatusTypeDef QSPI_XIP_EraseStart(uint32_t Address)
+{
+  if(XipState == QSPI_XIP_STATE_ERASE)
+  {
+    return HAL_BUSY;
+  }
+  if(XipState != QSPI_XIP_STATE_MAPPED)
+  {
+    return HAL_ERROR;
+  }
+
+  XipEraseAddress = Address & ~(XipDevice.EraseSize - 1U);
+  XipEraseIssued  = 0U;
+  XipEraseSlices  = 0U;
+  XipState = QSPI_XIP_STATE_ERASE;
+
+  return QSPI_XIP_Process();
+}
+
+/**
+  * @brief  Run one step of the pending erase
+  * @note   The memory mapped mode is left for QSPI_XIP_ERASE_SLICE_US at
+  *         most, plus the suspend latency, with the interrupts masked.
+  * @param  None
+  * @retval HAL status
+  */
+HAL_StatusTypeDef QSPI_XIP_Process(void)
+{
+  HAL_StatusTypeDef status;
+  uint32_t primask;
+  uint32_t done = 0U;
+
+  if(XipState != QSPI_XIP_STATE_ERASE)
+  {
+    return (XipState == QSPI_XIP_STATE_MAPPED) ? HAL_OK : HAL_ERROR;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  status = Xip_Unmap();
+  if(status == HAL_OK)
+  {
+    if(XipEraseIssued == 0U)
+    {
+      status = Xip_WriteEnable();
+      if(status == HAL_OK)
+      {
+        status = Xip_Instruction(XipDevice.EraseInstruction, 1U, XipEraseAddress);
+      }
+      XipEraseIssued = 1U;
+    }
+    else
+    {
+      status = Xip_Instruction(XipDevice.ResumeInstruction, 0U, 0U);
+    }
+  }
+
+  if(status == HAL_OK)
+  {
+    if(XipDevice.SuspendInstruction == 0U)
+    {
+      /* No suspend: erase in one step */
+      status = Xip_WaitStatus(XipDevice.StatusBusyMask, 0U,
+                              XIP_US_TO_CYCLES(XipDevice.EraseMaxTime * 1000U));
+      done = 1U;
+    }
+    else
+    {
+      status = Xip_WaitStatus(XipDevice.StatusBusyMask, 0U, XIP_US_TO_CYCLES(QSPI_XIP_ERASE_SLICE_US));
+      if(status == HAL_OK)
+      {
+        done = 1U;
+      }
+      else if(status == HAL_TIMEOUT)
+      {
+        /* The memory is ready again once suspended */
+        status = Xip_Instruction(XipDevice.SuspendInstruction, 0U, 0U);
+        if(status == HAL_OK)
+        {
+          status = Xip_WaitStatus(XipDevice.StatusBusyMask, 0U, XIP_US_TO_CYCLES(XIP_SUSPEND_TIME_US));
+        }
+      }
+    }
+  }
+
+  if(Xip_Map() != HAL_OK)
+  {
+    status = HAL_ERROR;
+  }
+
+  __set_PRIMASK(primask);
+
+  XipEraseSlices++;
+  if((status == HAL_OK) && (done == 0U) &&
+     ((XipEraseSlices * QSPI_XIP_ERASE_SLICE_US) > (XipDevice.EraseMaxTime * 1000U)))
+  {
+    status = HAL_TIMEOUT;
+  }
+
+  if(status != HAL_OK)
+  {
+    XipState = QSPI_XIP_STATE_ERROR;
+  }
+  else if(done != 0U)
+  {
+    Xip_InvalidateCache(XipEraseAddress, XipDevice.EraseSize);
+    XipState = QSPI_XIP_STATE_MAPPED;
+    QSPI_XIP_EraseCpltCallback(XipEraseAddress);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Return the manager state
+  * @param  None
+  * @retval Manager state
+  */
+QSPI_XIP_StateTypeDef QSPI_XIP_GetState(void)
+{
+  return XipState;
+}
+
+/**
+  * @brief  Sector erase complete callback
+  * @param  Address: first address of the erased sector
+  * @retval None
+  */
+__weak void QSPI_XIP_EraseCpltCallback(uint32_t Address)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Address);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the QSPI_XIP_EraseCpltCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Enter the memory mapped mode with the continuous read settings
+  * @param  None
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef Xip_Map(void)
+{
+  QSPI_CommandTypeDef      s_command;
+  QSPI_MemoryMappedTypeDef s_mem_mapped_cfg;
+
+  Xip_InitCommand(&s_command, XipDevice.ReadInstruction);
+  s_command.AddressMode      = XipDevice.ReadAddressMode;
+  s_command.DataMode         = XipDevice.ReadDataMode;
+  s_command.DummyCycles      = XipDevice.ReadDummyCycles;
+  s_command.DdrMode          = XipDevice.ReadDdrMode;
+  s_command.DdrHoldHalfCycle = XipDevice.ReadDdrHoldHalfCycle;
+  if(XipDevice.ModeByteEnable != 0U)
+  {
+    /* The memory stays in continuous read: instruction sent only once */
+    s_command.AlternateByteMode  = XIP_ALTERNATE_LINES(XipDevice.ReadAddressMode);
+    s_command.AlternateBytes     = XipDevice.ModeByte;
+    s_command.AlternateBytesSize = QSPI_ALTERNATE_BYTES_8_BITS;
+    s_command.SIOOMode           = QSPI_SIOO_INST_ONLY_FIRST_CMD;
+  }
+
+  s_mem_mapped_cfg.TimeOutActivation = (QSPI_XIP_TIMEOUT_PERIOD != 0U) ? QSPI_TIMEOUT_COUNTER_ENABLE : QSPI_TIMEOUT_COUNTER_DISABLE;
+  s_mem_mapped_cfg.TimeOutPeriod     = QSPI_XIP_TIMEOUT_PERIOD;
+
+  return HAL_QSPI_MemoryMapped(XipHandle, &s_command, &s_mem_mapped_cfg);
+}
+
+/**
+  * @brief  Leave the memory mapped mode and the continuous read mode
+  * @param  None
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef Xip_Unmap(void)
+{
+  QSPI_CommandTypeDef s_command;
+  uint8_t data;
+
+  if(HAL_QSPI_Abort(XipHandle) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  if(XipDevice.ModeByteEnable == 0U)
+  {
+    return HAL_OK;
+  }
+
+  /* The memory expects an address first: one read without instruction
+     and with the exit mode byte */
+  Xip_InitCommand(&s_command, 0U);
+  s_command.InstructionMode    = QSPI_INSTRUCTION_NONE;
+  s_command.AddressMode        = XipDevice.ReadAddressMode;
+  s_command.DataMode           = XipDevice.ReadDataMode;
+  s_command.DummyCycles        = XipDevice.ReadDummyCycles;
+  s_command.DdrMode            = XipDevice.ReadDdrMode;
+  s_command.DdrHoldHalfCycle   = XipDevice.ReadDdrHoldHalfCycle;
+  s_command.AlternateByteMode  = XIP_ALTERNATE_LINES(XipDevice.ReadAddressMode);
+  s_command.AlternateBytes     = XipDevice.ModeByteExit;
+  s_command.AlternateBytesSize = QSPI_ALTERNATE_BYTES_8_BITS;
+  s_command.NbData             = 1U;
+
+  if(HAL_QSPI_Command(XipHandle, &s_command, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  return HAL_QSPI_Receive(XipHandle, &data, HAL_QPSI_TIMEOUT_DEFAULT_VALUE);
+}
+
+/**
+  * @brief  Initialize an indirect command with the command lines of the memory
+  * @param  pCommand: command to initialize
+  * @param  Instruction: instruction
+  * @retval None
+  */
+static void Xip_InitCommand(QSPI_CommandTypeDef *pCommand, uint32_t Instruction)
+{
+  pCommand->InstructionMode    = XipDevice.CommandLines;
+  pCommand->Instruction        = Instruction;
+  pCommand->AddressMode        = QSPI_ADDRESS_NONE;
+  pCommand->AddressSize        = XipDevice.AddressSize;
+  pCommand->Address            = 0U;
+  pCommand->AlternateByteMode  = QSPI_ALTERNATE_BYTES_NONE;
+  pCommand->AlternateBytes     = 0U;
+  pCommand->AlternateBytesSize = QSPI_ALTERNATE_BYTES_8_BITS;
+  pCommand->DataMode           = QSPI_DATA_NONE;
+  pCommand->NbData             = 0U;
+  pCommand->DummyCycles        = 0U;
+  pCommand->DdrMode            = QSPI_DDR_MODE_DISABLE;
+  pCommand->DdrHoldHalfCycle   = QSPI_DDR_HHC_ANALOG_DELAY;
+  pCommand->SIOOMode           = QSPI_SIOO_INST_EVERY_CMD;
+}
+
+/**
+  * @brief  Send an instruction without data
+  * @param  Instruction: instruction
+  * @param  WithAddress: 1 to send Address after the instruction
+  * @param  Address: memory address
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef Xip_Instruction(uint32_t Instruction, uint32_t WithAddress, uint32_t Address)
+{
+  QSPI_CommandTypeDef s_command;
+
+  Xip_InitCommand(&s_command, Instruction);
+  if(WithAddress != 0U)
+  {
+    s_command.AddressMode = (XipDevice.CommandLines == QSPI_INSTRUCTION_4_LINES) ? QSPI_ADDRESS_4_LINES : QSPI_ADDRESS_1_LINE;
+    s_command.Address     = Address;
+  }
+
+  return HAL_QSPI_Command(XipHandle, &s_command, HAL_QPSI_TIMEOUT_DEFAULT_VALUE);
+}
+
+/**
+  * @brief  Poll the status register, timed on the DWT cycle counter since the
+  *         tick does not run with the interrupts masked
+  * @param  Mask: status bits to check
+  * @param  Match: expected value of these bits
+  * @param  Cycles: timeout in CPU cycles
+  * @retval HAL status, HAL_TIMEOUT when the bits did not match in time
+  */
+static HAL_StatusTypeDef Xip_WaitStatus(uint32_t Mask, uint32_t Match, uint32_t Cycles)
+{
+  QSPI_CommandTypeDef s_command;
+  uint32_t start = DWT->CYCCNT;
+  uint8_t reg;
+
+  Xip_InitCommand(&s_command, XipDevice.StatusInstruction);
+  s_command.DataMode = (XipDevice.CommandLines == QSPI_INSTRUCTION_4_LINES) ? QSPI_DATA_4_LINES : QSPI_DATA_1_LINE;
+  s_command.NbData   = 1U;
+
+  for(;;)
+  {
+    if(HAL_QSPI_Command(XipHandle, &s_command, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+    if(HAL_QSPI_Receive(XipHandle, &reg, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+    if(((uint32_t)reg & Mask) == Match)
+    {
+      return HAL_OK;
+    }
+    if((DWT->CYCCNT - start) > Cycles)
+    {
+      return HAL_TIMEOUT;
+    }
+  }
+}
+
+/**
+  * @brief  Send a write enable and wait for the latch
+  * @param  None
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef Xip_WriteEnable(void)
+{
+  if(Xip_Instruction(XipDevice.WriteEnableInstruction, 0U, 0U) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  return Xip_WaitStatus(XipDevice.StatusWelMask, XipDevice.StatusWelMask, XIP_US_TO_CYCLES(XIP_WEL_TIME_US));
+}
+
+/**
+  * @brief  Invalidate the D-cache lines of a memory area
+  * @param  Address: memory address
+  * @param  Size: number of bytes
+  * @retval None
+  */
+static void Xip_InvalidateCache(uint32_t Address, uint32_t Size)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  uint32_t start = (QSPI_BASE + Address) & ~31U;
+
+  if((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    SCB_InvalidateDCache_by_Addr((uint32_t *)start, (int32_t)((QSPI_BASE + Address + Size) - start));
+  }
+#else
+  UNUSED(Address);
+  UNUSED(Size);
+#endif
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
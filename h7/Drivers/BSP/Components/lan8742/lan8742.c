@@ -59,6 +59,8 @@
 #define LAN8742_SW_RESET_TO    ((uint32_t)500U)
 #define LAN8742_INIT_TO        ((uint32_t)2000U)
 #define LAN8742_MAX_DEV_ADDR   ((uint32_t)31U)
+#define LAN8742_LINK_IT        (LAN8742_LINK_DOWN_IT | LAN8742_AUTONEGO_COMPLETE_IT)
+#define LAN8742_FORCED_LINK_IT (LAN8742_LINK_DOWN_IT | LAN8742_ENERGYON_IT)
 /**
   * @}
   */
@@ -96,6 +98,9 @@ int32_t  LAN8742_RegisterBusIO(lan8742_Object_t *pObj, lan8742_IOCtx_t *ioctx)
 
 /**
   * @brief  Initialize the lan8742 and configure the needed hardware resources
+  * @note   Waits 2s after the software reset, for the auto negotiation with
+  *         all the modes of the PHY. LAN8742_InitNoWait() and
+  *         LAN8742_StartLink() bring the link up without blocking.
   * @param  pObj: device object LAN8742_Object_t. 
   * @retval LAN8742_STATUS_OK  if OK
   *         LAN8742_STATUS_ADDRESS_ERROR if cannot find device address
@@ -103,7 +108,38 @@ int32_t  LAN8742_RegisterBusIO(lan8742_Object_t *pObj, lan8742_IOCtx_t *ioctx)
   *         LAN8742_STATUS_WRITE_ERROR if connot write to register
   *         LAN8742_STATUS_RESET_TIMEOUT if cannot perform a software reset
   */
- int32_t LAN8742_Init(lan8742_Object_t *pObj)
+int32_t LAN8742_Init(lan8742_Object_t *pObj)
+{
+  uint32_t tickstart = 0;
+  int32_t status = LAN8742_InitNoWait(pObj);
+
+  if(status == LAN8742_STATUS_OK)
+  {
+    tickstart =  pObj->IO.GetTick();
+
+    /* Wait for 2s to perform initialization */
+    while((pObj->IO.GetTick() - tickstart) <= LAN8742_INIT_TO)
+    {
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Initialize the lan8742 without waiting for the link
+  * @note   Finds the PHY address and resets it. The auto negotiation the PHY
+  *         restarts after the reset runs in the background: configure it with
+  *         LAN8742_StartLink() early in the boot, and check the link once the
+  *         rest of the system is initialized.
+  * @param  pObj: device object LAN8742_Object_t.
+  * @retval LAN8742_STATUS_OK  if OK
+  *         LAN8742_STATUS_ADDRESS_ERROR if cannot find device address
+  *         LAN8742_STATUS_READ_ERROR if connot read register
+  *         LAN8742_STATUS_WRITE_ERROR if connot write to register
+  *         LAN8742_STATUS_RESET_TIMEOUT if cannot perform a software reset
+  */
+ int32_t LAN8742_InitNoWait(lan8742_Object_t *pObj)
  {
    uint32_t tickstart = 0, regvalue = 0, addr = 0;
    int32_t status = LAN8742_STATUS_OK;
@@ -168,6 +204,7 @@ int32_t  LAN8742_RegisterBusIO(lan8742_Object_t *pObj, lan8742_IOCtx_t *ioctx)
              else
              {
                status = LAN8742_STATUS_RESET_TIMEOUT;
+               break;
              }
            } 
          }
@@ -183,14 +220,10 @@ int32_t  LAN8742_RegisterBusIO(lan8742_Object_t *pObj, lan8742_IOCtx_t *ioctx)
      }
    }
       
-   if(status == LAN8742_STATUS_OK)
+   if((status == LAN8742_STATUS_OK) && (pObj->Is_Initialized == 0))
    {
-     tickstart =  pObj->IO.GetTick();
-     
-     /* Wait for 2s to perform initialization */
-     while((pObj->IO.GetTick() - tickstart) <= LAN8742_INIT_TO)
-     {
-     }
+     pObj->LinkState = LAN8742_STATUS_LINK_DOWN;
+     pObj->LinkIT = 0;
      pObj->Is_Initialized = 1;
    }
    
@@ -663,6 +696,150 @@ int32_t LAN8742_GetITStatus(lan8742_Object_t *pObj, uint32_t Interrupt)
   return status;
 }
 
+/**
+  * @brief  Start the link with the given modes, without waiting for it.
+  * @note   The auto negotiation advertises the modes of pConfig only, and a
+  *         forced link state skips it. A forced link partner is needed then:
+  *         one running the auto negotiation detects the speed, not the
+  *         duplex mode, and ends up in half duplex.
+  *         With LinkIT, the PHY interrupt output (nINT) signals the link down,
+  *         the auto negotiation completion or, for a forced link, the energy
+  *         detection: call LAN8742_ProcessIT() on it.
+  * @param  pObj: Pointer to device object.
+  * @param  pConfig: modes advertised or forced, link interrupts.
+  * @retval LAN8742_STATUS_OK  if OK
+  *         LAN8742_STATUS_ERROR  if parameter error
+  *         LAN8742_STATUS_READ_ERROR if connot read register
+  *         LAN8742_STATUS_WRITE_ERROR if connot write to register
+  */
+int32_t LAN8742_StartLink(lan8742_Object_t *pObj, const lan8742_LinkConfig_t *pConfig)
+{
+  uint32_t readval = 0, advertise;
+  int32_t status = LAN8742_STATUS_OK;
+
+  if(pConfig == 0)
+  {
+    return LAN8742_STATUS_ERROR;
+  }
+
+  pObj->LinkState = LAN8742_STATUS_LINK_DOWN;
+
+  if(pConfig->ForcedLinkState != 0)
+  {
+    status = LAN8742_SetLinkState(pObj, (uint32_t)pConfig->ForcedLinkState);
+  }
+  else
+  {
+    advertise = pConfig->Advertise & LAN8742_ANAR_TECH_ABILITY;
+    if(advertise == 0)
+    {
+      advertise = LAN8742_ANAR_TECH_ABILITY;
+    }
+
+    /* Advertise the modes used only, the pause abilities are kept */
+    if(pObj->IO.ReadReg(pObj->DevAddr, LAN8742_ANAR, &readval) < 0)
+    {
+      return LAN8742_STATUS_READ_ERROR;
+    }
+    readval &= ~(LAN8742_ANAR_TECH_ABILITY | LAN8742_ANAR_SELECTOR_FIELD);
+    readval |= advertise | LAN8742_ANAR_SELECTOR_IEEE802_3;
+    if(pObj->IO.WriteReg(pObj->DevAddr, LAN8742_ANAR, readval) < 0)
+    {
+      return LAN8742_STATUS_WRITE_ERROR;
+    }
+
+    /* Restart the auto negotiation with them */
+    if(pObj->IO.ReadReg(pObj->DevAddr, LAN8742_BCR, &readval) < 0)
+    {
+      return LAN8742_STATUS_READ_ERROR;
+    }
+    readval &= ~(LAN8742_BCR_POWER_DOWN | LAN8742_BCR_ISOLATE);
+    readval |= LAN8742_BCR_AUTONEGO_EN | LAN8742_BCR_RESTART_AUTONEGO;
+    if(pObj->IO.WriteReg(pObj->DevAddr, LAN8742_BCR, readval) < 0)
+    {
+      return LAN8742_STATUS_WRITE_ERROR;
+    }
+  }
+
+  if(status != LAN8742_STATUS_OK)
+  {
+    return status;
+  }
+
+  /* Link interrupts: the flags raised before are cleared when read */
+  pObj->LinkIT = 0;
+  status = LAN8742_DisableIT(pObj, LAN8742_LINK_IT | LAN8742_FORCED_LINK_IT);
+  if((status == LAN8742_STATUS_OK) && (pConfig->LinkIT != 0))
+  {
+    status = LAN8742_ClearIT(pObj, LAN8742_LINK_IT | LAN8742_FORCED_LINK_IT);
+    if(status == LAN8742_STATUS_OK)
+    {
+      pObj->LinkIT = (pConfig->ForcedLinkState != 0) ? LAN8742_FORCED_LINK_IT : LAN8742_LINK_IT;
+      status = LAN8742_EnableIT(pObj, pObj->LinkIT);
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Serve the PHY interrupt: update the link state on a link change.
+  * @note   The MDIO accesses take some 50us: call it from a task or the main
+  *         loop woken by the nINT line interrupt rather than from the
+  *         interrupt handler. The link may still be down on the energy
+  *         detection of a forced link: the state is read again on the next
+  *         interrupt or by LAN8742_GetLinkState().
+  * @param  pObj: Pointer to device object.
+  * @retval Link state, as LAN8742_GetLinkState()
+  */
+int32_t LAN8742_ProcessIT(lan8742_Object_t *pObj)
+{
+  uint32_t readval = 0;
+  int32_t linkstate;
+
+  /* Flags cleared when read */
+  if(pObj->IO.ReadReg(pObj->DevAddr, LAN8742_ISFR, &readval) < 0)
+  {
+    return LAN8742_STATUS_READ_ERROR;
+  }
+
+  if((readval & pObj->LinkIT) != 0)
+  {
+    linkstate = LAN8742_GetLinkState(pObj);
+    if(linkstate < 0)
+    {
+      return linkstate;
+    }
+    pObj->LinkState = linkstate;
+  }
+
+  return pObj->LinkState;
+}
+
+/**
+  * @brief  Get the link state without MDIO access when the link interrupts
+  *         are enabled.
+  * @param  pObj: Pointer to device object.
+  * @retval Link state updated by LAN8742_ProcessIT(), or read from the PHY
+  *         when the link interrupts are not used, as LAN8742_GetLinkState()
+  */
+int32_t LAN8742_GetCachedLinkState(lan8742_Object_t *pObj)
+{
+  int32_t linkstate;
+
+  if(pObj->LinkIT == 0)
+  {
+    linkstate = LAN8742_GetLinkState(pObj);
+    if(linkstate < 0)
+    {
+      return linkstate;
+    }
+    pObj->LinkState = linkstate;
+  }
+
+  return pObj->LinkState;
+}
+
 /**
   * @}
   */ 
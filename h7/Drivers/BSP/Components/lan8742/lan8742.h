@@ -161,6 +161,8 @@
 #define LAN8742_ANAR_10BASE_T_FD             ((uint16_t)0x0040U)
 #define LAN8742_ANAR_10BASE_T                ((uint16_t)0x0020U)
 #define LAN8742_ANAR_SELECTOR_FIELD          ((uint16_t)0x000FU)
+#define LAN8742_ANAR_SELECTOR_IEEE802_3      ((uint16_t)0x0001U)
+#define LAN8742_ANAR_TECH_ABILITY            ((uint16_t)0x01E0U)
 /**
   * @}
   */
@@ -408,12 +410,28 @@ typedef struct
 } lan8742_IOCtx_t;  
 
   
+typedef struct 
+{
+  uint32_t            Advertise;        /*!< Modes advertised by the auto negotiation, a combination of
+                                             LAN8742_ANAR_100BASE_TX_FD, LAN8742_ANAR_100BASE_TX,
+                                             LAN8742_ANAR_10BASE_T_FD and LAN8742_ANAR_10BASE_T,
+                                             0 for all of them */
+  int32_t             ForcedLinkState;  /*!< 0 for auto negotiation, or a LAN8742_STATUS_xxMBITS_xxDUPLEX
+                                             link state forced without auto negotiation, such as the one
+                                             saved by the application after a previous link up with a
+                                             link partner forced too */
+  uint32_t            LinkIT;           /*!< 1: link changes raised on the PHY interrupt output and served
+                                             by LAN8742_ProcessIT(), 0: link state polled */
+} lan8742_LinkConfig_t;
+
 typedef struct 
 {
   uint32_t            DevAddr;
   uint32_t            Is_Initialized;
   lan8742_IOCtx_t     IO;
   void               *pData;
+  int32_t             LinkState;        /*!< Last link state read, LAN8742_STATUS_LINK_DOWN before */
+  uint32_t            LinkIT;           /*!< Link interrupts enabled by LAN8742_StartLink() */
 }lan8742_Object_t;
 /**
   * @}
@@ -426,6 +444,7 @@ typedef struct
   */
 int32_t LAN8742_RegisterBusIO(lan8742_Object_t *pObj, lan8742_IOCtx_t *ioctx);
 int32_t LAN8742_Init(lan8742_Object_t *pObj);
+int32_t LAN8742_InitNoWait(lan8742_Object_t *pObj);
 int32_t LAN8742_DeInit(lan8742_Object_t *pObj);
 int32_t LAN8742_DisablePowerDownMode(lan8742_Object_t *pObj);
 int32_t LAN8742_EnablePowerDownMode(lan8742_Object_t *pObj);
@@ -438,6 +457,9 @@ int32_t LAN8742_EnableIT(lan8742_Object_t *pObj, uint32_t Interrupt);
 int32_t LAN8742_DisableIT(lan8742_Object_t *pObj, uint32_t Interrupt);
 int32_t LAN8742_ClearIT(lan8742_Object_t *pObj, uint32_t Interrupt);
 int32_t LAN8742_GetITStatus(lan8742_Object_t *pObj, uint32_t Interrupt);
+int32_t LAN8742_StartLink(lan8742_Object_t *pObj, const lan8742_LinkConfig_t *pConfig);
+int32_t LAN8742_ProcessIT(lan8742_Object_t *pObj);
+int32_t LAN8742_GetCachedLinkState(lan8742_Object_t *pObj);
 /**
   * @}
   */ 
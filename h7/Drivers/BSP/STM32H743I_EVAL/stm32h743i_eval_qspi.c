@@ -33,6 +33,29 @@
             chip by calling the function BSP_QSPI_Erase_Chip().
        (++) The function BSP_QSPI_GetStatus() returns the current status of the QSPI memory.
             (see the QSPI memory data sheet)
+
+   (#) Dual-flash mode
+       (++) The two memories are accessed together, the even bytes in the first one and
+            the odd bytes in the second one: a program operation fills a page of 256 bytes
+            in each memory (512 bytes from an address multiple of 512) and an erase
+            operation erases the same block in both memories (2 x 4 KBytes from an
+            address multiple of 8 KBytes for BSP_QSPI_Erase_Block()). BSP_QSPI_GetInfo()
+            returns this geometry. Addresses and sizes must be even.
+
+   (#) Operation queue
+       (++) BSP_QSPI_Write_IT(), BSP_QSPI_Erase_Block_IT() and BSP_QSPI_Erase_Sector_IT()
+            add an operation to a queue of QSPI_QUEUE_SIZE entries and return at once.
+            The operations run one after the other: the end of each page program or
+            erase is detected by the automatic polling of the status registers in
+            interrupt mode, the next operation being started from the QUADSPI interrupt.
+            BSP_QSPI_IRQHandler() must be called from QUADSPI_IRQHandler().
+       (++) The data of BSP_QSPI_Write_IT() are read by the queue when the page is
+            programmed: the buffer must be kept until the end of the queue.
+       (++) BSP_QSPI_GetQueueStatus() returns QSPI_BUSY while operations are queued, then
+            QSPI_OK, or QSPI_ERROR if an operation failed or exceeded the maximum time of
+            the memory (the queue is then emptied). BSP_QSPI_QueueCpltCallback() is
+            called when the queue gets empty, BSP_QSPI_QueueErrorCallback() on error.
+       (++) The other functions return QSPI_BUSY while the queue is not empty.
   @endverbatim
   ******************************************************************************
   * @attention
@@ -80,6 +103,35 @@
   */
 
 
+/** @defgroup STM32H743I_EVAL_QSPI_Private_TypesDefinitions QSPI Private TypesDefinitions
+  * @{
+  */
+typedef struct
+{
+  uint8_t  Operation;   /* QSPI_OP_xxx                              */
+  uint8_t  *pData;      /* Data left to program, QSPI_OP_PROGRAM    */
+  uint32_t Address;     /* Address of the next page or of the block */
+  uint32_t Size;        /* Bytes left to program, QSPI_OP_PROGRAM   */
+} QSPI_QueueOpTypeDef;
+/**
+  * @}
+  */
+
+/** @defgroup STM32H743I_EVAL_QSPI_Private_Defines QSPI Private Defines
+  * @{
+  */
+/* Dual-flash geometry: the same page or block of both memories */
+#define QSPI_DUAL_PAGE_SIZE        (2U * MT25TL01G_PAGE_SIZE)
+#define QSPI_DUAL_SUBSECTOR_SIZE   (2U * MT25TL01G_SUBSECTOR_SIZE)
+#define QSPI_DUAL_SECTOR_SIZE      (2U * MT25TL01G_SECTOR_SIZE)
+
+#define QSPI_OP_PROGRAM            0U
+#define QSPI_OP_ERASE_SUBSECTOR    1U
+#define QSPI_OP_ERASE_SECTOR       2U
+/**
+  * @}
+  */
+
 /* Private variables ---------------------------------------------------------*/
 
 /** @defgroup STM32H743I_EVAL_QSPI_Private_Variables QSPI Private Variables
@@ -87,6 +139,14 @@
   */
 QSPI_HandleTypeDef QSPIHandle;
 
+static QSPI_QueueOpTypeDef QspiQueue[QSPI_QUEUE_SIZE];
+static __IO uint32_t QspiQueueHead;    /* Operation in progress         */
+static __IO uint32_t QspiQueueCount;   /* Operations queued, running in */
+static __IO uint8_t  QspiQueueError;
+static uint32_t      QspiOpSize;       /* Bytes of the page programmed  */
+static uint32_t      QspiOpTick;       /* Start of the operation        */
+static uint32_t      QspiOpTimeout;    /* Maximum time of the operation */
+
 /**
   * @}
   */
@@ -103,6 +163,10 @@ static uint8_t QSPI_EnterFourBytesAddress(QSPI_HandleTypeDef *hqspi);
 static uint8_t QSPI_DummyCyclesCfg       (QSPI_HandleTypeDef *hqspi);
 static uint8_t QSPI_WriteEnable          (QSPI_HandleTypeDef *hqspi);
 static uint8_t QSPI_AutoPollingMemReady(QSPI_HandleTypeDef *hqspi, uint32_t Timeout);
+static uint8_t QSPI_AutoPollingMemReady_IT(QSPI_HandleTypeDef *hqspi);
+static uint8_t QSPI_Queue_Add(uint8_t Operation, uint8_t* pData, uint32_t Address, uint32_t Size);
+static uint8_t QSPI_Queue_Start(void);
+static void    QSPI_Queue_Fail(void);
 
 /**
   * @}
@@ -197,10 +261,15 @@ uint8_t BSP_QSPI_Read(uint8_t* pData, uint32_t ReadAddr, uint32_t Size)
 {
   QSPI_CommandTypeDef s_command;
 
+  if (QspiQueueCount != 0U)
+  {
+    return QSPI_BUSY;
+  }
+
   /* Initialize the read command */
   s_command.InstructionMode   = QSPI_INSTRUCTION_1_LINE;
-  s_command.Instruction       = QUAD_OUT_FAST_READ_CMD;
-  s_command.AddressMode       = QSPI_ADDRESS_1_LINE;
+  s_command.Instruction       = QUAD_INOUT_FAST_READ_4_BYTE_ADDR_CMD;
+  s_command.AddressMode       = QSPI_ADDRESS_4_LINES;
   s_command.AddressSize       = QSPI_ADDRESS_32_BITS;
   s_command.Address           = ReadAddr;
   s_command.AlternateByteMode = QSPI_ALTERNATE_BYTES_NONE;
@@ -238,8 +307,14 @@ uint8_t BSP_QSPI_Write(uint8_t* pData, uint32_t WriteAddr, uint32_t Size)
   QSPI_CommandTypeDef s_command;
   uint32_t end_addr, current_size, current_addr;
 
-  /* Calculation of the size between the write address and the end of the page */
-  current_size = MT25TL01G_PAGE_SIZE - (WriteAddr % MT25TL01G_PAGE_SIZE);
+  if (QspiQueueCount != 0U)
+  {
+    return QSPI_BUSY;
+  }
+
+  /* Calculation of the size between the write address and the end of the page
+     (a page in each memory) */
+  current_size = QSPI_DUAL_PAGE_SIZE - (WriteAddr % QSPI_DUAL_PAGE_SIZE);
 
   /* Check if the size of the data is less than the remaining place in the page */
   if (current_size > Size)
@@ -296,7 +371,7 @@ uint8_t BSP_QSPI_Write(uint8_t* pData, uint32_t WriteAddr, uint32_t Size)
     /* Update the address and size variables for next page programming */
     current_addr += current_size;
     pData += current_size;
-    current_size = ((current_addr + MT25TL01G_PAGE_SIZE) > end_addr) ? (end_addr - current_addr) : MT25TL01G_PAGE_SIZE;
+    current_size = ((current_addr + QSPI_DUAL_PAGE_SIZE) > end_addr) ? (end_addr - current_addr) : QSPI_DUAL_PAGE_SIZE;
   } while (current_addr < end_addr);
 
   return QSPI_OK;
@@ -311,6 +386,11 @@ uint8_t BSP_QSPI_Erase_Block(uint32_t BlockAddress)
 {
   QSPI_CommandTypeDef s_command;
 
+  if (QspiQueueCount != 0U)
+  {
+    return QSPI_BUSY;
+  }
+
   /* Initialize the erase command */
   s_command.InstructionMode   = QSPI_INSTRUCTION_1_LINE;
   s_command.Instruction       = SUBSECTOR_ERASE_CMD;
@@ -353,6 +433,11 @@ uint8_t BSP_QSPI_Erase_Chip(void)
 {
   QSPI_CommandTypeDef s_command;
 
+  if (QspiQueueCount != 0U)
+  {
+    return QSPI_BUSY;
+  }
+
   /* Initialize the erase command */
   s_command.InstructionMode   = QSPI_INSTRUCTION_1_LINE;
   s_command.Instruction       = DIE_ERASE_CMD;
@@ -394,6 +479,11 @@ uint8_t BSP_QSPI_GetStatus(void)
   QSPI_CommandTypeDef s_command;
   uint16_t reg;
 
+  if (QspiQueueCount != 0U)
+  {
+    return QSPI_BUSY;
+  }
+
   /* Initialize the read flag status register command */
   s_command.InstructionMode   = QSPI_INSTRUCTION_1_LINE;
   s_command.Instruction       = READ_FLAG_STATUS_REG_CMD;
@@ -446,10 +536,10 @@ uint8_t BSP_QSPI_GetInfo(QSPI_Info* pInfo)
 {
   /* Configure the structure with the memory configuration */
   pInfo->FlashSize          = MT25TL01G_FLASH_SIZE;
-  pInfo->EraseSectorSize    = MT25TL01G_SUBSECTOR_SIZE;
-  pInfo->EraseSectorsNumber = (MT25TL01G_FLASH_SIZE/MT25TL01G_SUBSECTOR_SIZE);
-  pInfo->ProgPageSize       = MT25TL01G_PAGE_SIZE;
-  pInfo->ProgPagesNumber    = (MT25TL01G_FLASH_SIZE/MT25TL01G_PAGE_SIZE);
+  pInfo->EraseSectorSize    = QSPI_DUAL_SUBSECTOR_SIZE;
+  pInfo->EraseSectorsNumber = (MT25TL01G_FLASH_SIZE/QSPI_DUAL_SUBSECTOR_SIZE);
+  pInfo->ProgPageSize       = QSPI_DUAL_PAGE_SIZE;
+  pInfo->ProgPagesNumber    = (MT25TL01G_FLASH_SIZE/QSPI_DUAL_PAGE_SIZE);
 
   return QSPI_OK;
 }
@@ -463,10 +553,15 @@ uint8_t BSP_QSPI_EnableMemoryMappedMode(void)
   QSPI_CommandTypeDef      s_command;
   QSPI_MemoryMappedTypeDef s_mem_mapped_cfg;
 
+  if (QspiQueueCount != 0U)
+  {
+    return QSPI_BUSY;
+  }
+
   /* Configure the command for the read instruction */
   s_command.InstructionMode   = QSPI_INSTRUCTION_1_LINE;
-  s_command.Instruction       = QUAD_OUT_FAST_READ_CMD;
-  s_command.AddressMode       = QSPI_ADDRESS_1_LINE;
+  s_command.Instruction       = QUAD_INOUT_FAST_READ_4_BYTE_ADDR_CMD;
+  s_command.AddressMode       = QSPI_ADDRESS_4_LINES;
   s_command.AddressSize       = QSPI_ADDRESS_32_BITS;
   s_command.AlternateByteMode = QSPI_ALTERNATE_BYTES_NONE;
   s_command.DataMode          = QSPI_DATA_4_LINES;
@@ -487,6 +582,165 @@ uint8_t BSP_QSPI_EnableMemoryMappedMode(void)
   return QSPI_OK;
 }
 
+/**
+  * @brief  Queues the programming of an amount of data in the QSPI memory.
+  * @param  pData: Pointer to data to be written, kept until the end of the queue
+  * @param  WriteAddr: Write start address
+  * @param  Size: Size of data to write
+  * @retval QSPI memory status
+  */
+uint8_t BSP_QSPI_Write_IT(uint8_t* pData, uint32_t WriteAddr, uint32_t Size)
+{
+  if (Size == 0U)
+  {
+    return QSPI_OK;
+  }
+
+  return QSPI_Queue_Add(QSPI_OP_PROGRAM, pData, WriteAddr, Size);
+}
+
+/**
+  * @brief  Queues the erase of the specified block of the QSPI memory.
+  * @param  BlockAddress: Block address to erase
+  * @retval QSPI memory status
+  */
+uint8_t BSP_QSPI_Erase_Block_IT(uint32_t BlockAddress)
+{
+  return QSPI_Queue_Add(QSPI_OP_ERASE_SUBSECTOR, NULL, BlockAddress, 0U);
+}
+
+/**
+  * @brief  Queues the erase of the specified sector (64 KBytes in each memory)
+  *         of the QSPI memory.
+  * @param  SectorAddress: Sector address to erase
+  * @retval QSPI memory status
+  */
+uint8_t BSP_QSPI_Erase_Sector_IT(uint32_t SectorAddress)
+{
+  return QSPI_Queue_Add(QSPI_OP_ERASE_SECTOR, NULL, SectorAddress, 0U);
+}
+
+/**
+  * @brief  Reads the state of the operation queue.
+  * @retval QSPI_OK when the queue is empty, QSPI_BUSY while operations run or
+  *         QSPI_ERROR after a failed operation (until the next queued one)
+  */
+uint8_t BSP_QSPI_GetQueueStatus(void)
+{
+  uint8_t status = QSPI_BUSY;
+
+  HAL_NVIC_DisableIRQ(QUADSPI_IRQn);
+  if (QspiQueueError != 0U)
+  {
+    status = QSPI_ERROR;
+  }
+  else if (QspiQueueCount == 0U)
+  {
+    status = QSPI_OK;
+  }
+  else if ((HAL_GetTick() - QspiOpTick) > QspiOpTimeout)
+  {
+    /* The memory did not end the operation in time */
+    (void)HAL_QSPI_Abort(&QSPIHandle);
+    QSPI_Queue_Fail();
+    status = QSPI_ERROR;
+  }
+  else
+  {
+    /* Operations running */
+  }
+  HAL_NVIC_EnableIRQ(QUADSPI_IRQn);
+
+  return status;
+}
+
+/**
+  * @brief  Handles QSPI interrupt request.
+  * @retval None
+  */
+void BSP_QSPI_IRQHandler(void)
+{
+  HAL_QSPI_IRQHandler(&QSPIHandle);
+}
+
+/**
+  * @brief BSP QSPI queue completed callback
+  * @retval None
+  */
+__weak void BSP_QSPI_QueueCpltCallback(void)
+{
+  /* NOTE: This function should not be modified, when the callback is needed,
+           the BSP_QSPI_QueueCpltCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief BSP QSPI queue error callback
+  * @retval None
+  */
+__weak void BSP_QSPI_QueueErrorCallback(void)
+{
+  /* NOTE: This function should not be modified, when the callback is needed,
+           the BSP_QSPI_QueueErrorCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Status match callback: end of the page program or erase in progress.
+  * @param  hqspi: QSPI handle
+  * @retval None
+  */
+void HAL_QSPI_StatusMatchCallback(QSPI_HandleTypeDef *hqspi)
+{
+  QSPI_QueueOpTypeDef *op;
+
+  if (QspiQueueCount == 0U)
+  {
+    return;
+  }
+
+  op = &QspiQueue[QspiQueueHead];
+  if (op->Operation == QSPI_OP_PROGRAM)
+  {
+    op->Address += QspiOpSize;
+    op->pData   += QspiOpSize;
+    op->Size    -= QspiOpSize;
+  }
+
+  if ((op->Operation != QSPI_OP_PROGRAM) || (op->Size == 0U))
+  {
+    /* Operation done */
+    QspiQueueHead = (QspiQueueHead + 1U) % QSPI_QUEUE_SIZE;
+    QspiQueueCount--;
+  }
+
+  if (QspiQueueCount == 0U)
+  {
+    BSP_QSPI_QueueCpltCallback();
+  }
+  else if (QSPI_Queue_Start() != QSPI_OK)
+  {
+    QSPI_Queue_Fail();
+  }
+  else
+  {
+    /* Next page or operation started */
+  }
+}
+
+/**
+  * @brief  Transfer error callback.
+  * @param  hqspi: QSPI handle
+  * @retval None
+  */
+void HAL_QSPI_ErrorCallback(QSPI_HandleTypeDef *hqspi)
+{
+  if (QspiQueueCount != 0U)
+  {
+    QSPI_Queue_Fail();
+  }
+}
+
 
 /**
   * @brief QSPI MSP Initialization
@@ -851,6 +1105,182 @@ static uint8_t QSPI_AutoPollingMemReady(QSPI_HandleTypeDef *hqspi, uint32_t Time
 
   return QSPI_OK;
 }
+
+/**
+  * @brief  This function starts the reading of the SR of both memories in
+  *         interrupt mode: HAL_QSPI_StatusMatchCallback() is called at the EOP.
+  * @param  hqspi: QSPI handle
+  * @retval None
+  */
+static uint8_t QSPI_AutoPollingMemReady_IT(QSPI_HandleTypeDef *hqspi)
+{
+  QSPI_CommandTypeDef     s_command;
+  QSPI_AutoPollingTypeDef s_config;
+
+  s_command.InstructionMode   = QSPI_INSTRUCTION_1_LINE;
+  s_command.Instruction       = READ_STATUS_REG_CMD;
+  s_command.AddressMode       = QSPI_ADDRESS_NONE;
+  s_command.AlternateByteMode = QSPI_ALTERNATE_BYTES_NONE;
+  s_command.DataMode          = QSPI_DATA_1_LINE;
+  s_command.DummyCycles       = 0;
+  s_command.DdrMode           = QSPI_DDR_MODE_DISABLE;
+  s_command.DdrHoldHalfCycle  = QSPI_DDR_HHC_ANALOG_DELAY;
+  s_command.SIOOMode          = QSPI_SIOO_INST_EVERY_CMD;
+
+  s_config.Match           = 0;
+  s_config.MatchMode       = QSPI_MATCH_MODE_AND;
+  s_config.Interval        = 0x10;
+  s_config.AutomaticStop   = QSPI_AUTOMATIC_STOP_ENABLE;
+  s_config.Mask            = MT25TL01G_SR_WIP | (MT25TL01G_SR_WIP <<8);
+  s_config.StatusBytesSize = 2;
+
+  if (HAL_QSPI_AutoPolling_IT(hqspi, &s_command, &s_config) != HAL_OK)
+  {
+    return QSPI_ERROR;
+  }
+
+  return QSPI_OK;
+}
+
+/**
+  * @brief  This function adds an operation to the queue, started at once when
+  *         the queue is empty.
+  * @param  Operation: QSPI_OP_xxx
+  * @param  pData: Data to program
+  * @param  Address: Program or erase address
+  * @param  Size: Size of data to program
+  * @retval QSPI memory status
+  */
+static uint8_t QSPI_Queue_Add(uint8_t Operation, uint8_t* pData, uint32_t Address, uint32_t Size)
+{
+  QSPI_QueueOpTypeDef *op;
+  uint8_t status = QSPI_OK;
+
+  HAL_NVIC_DisableIRQ(QUADSPI_IRQn);
+  if (QspiQueueCount == QSPI_QUEUE_SIZE)
+  {
+    status = QSPI_BUSY;
+  }
+  else if ((QspiQueueCount == 0U) && (HAL_QSPI_GetState(&QSPIHandle) != HAL_QSPI_STATE_READY))
+  {
+    /* Memory-mapped mode or interface not initialized */
+    status = QSPI_ERROR;
+  }
+  else
+  {
+    op = &QspiQueue[(QspiQueueHead + QspiQueueCount) % QSPI_QUEUE_SIZE];
+    op->Operation = Operation;
+    op->pData     = pData;
+    op->Address   = Address;
+    op->Size      = Size;
+
+    QspiQueueCount++;
+    if (QspiQueueCount == 1U)
+    {
+      QspiQueueError = 0U;
+      if (QSPI_Queue_Start() != QSPI_OK)
+      {
+        QSPI_Queue_Fail();
+        status = QSPI_ERROR;
+      }
+    }
+  }
+  HAL_NVIC_EnableIRQ(QUADSPI_IRQn);
+
+  return status;
+}
+
+/**
+  * @brief  This function sends the page program or erase command of the
+  *         operation at the head of the queue and starts the polling of the
+  *         memories in interrupt mode.
+  * @retval QSPI memory status
+  */
+static uint8_t QSPI_Queue_Start(void)
+{
+  QSPI_QueueOpTypeDef *op = &QspiQueue[QspiQueueHead];
+  QSPI_CommandTypeDef s_command;
+
+  s_command.InstructionMode   = QSPI_INSTRUCTION_1_LINE;
+  s_command.AddressMode       = QSPI_ADDRESS_1_LINE;
+  s_command.AddressSize       = QSPI_ADDRESS_32_BITS;
+  s_command.Address           = op->Address;
+  s_command.AlternateByteMode = QSPI_ALTERNATE_BYTES_NONE;
+  s_command.DummyCycles       = 0;
+  s_command.DdrMode           = QSPI_DDR_MODE_DISABLE;
+  s_command.DdrHoldHalfCycle  = QSPI_DDR_HHC_ANALOG_DELAY;
+  s_command.SIOOMode          = QSPI_SIOO_INST_EVERY_CMD;
+
+  if (op->Operation == QSPI_OP_PROGRAM)
+  {
+    /* Up to the end of the page, a page in each memory */
+    QspiOpSize = QSPI_DUAL_PAGE_SIZE - (op->Address % QSPI_DUAL_PAGE_SIZE);
+    if (QspiOpSize > op->Size)
+    {
+      QspiOpSize = op->Size;
+    }
+    QspiOpTimeout = HAL_QPSI_TIMEOUT_DEFAULT_VALUE;
+
+    s_command.Instruction = QUAD_IN_FAST_PROG_CMD;
+    s_command.DataMode    = QSPI_DATA_4_LINES;
+    s_command.NbData      = QspiOpSize;
+  }
+  else
+  {
+    if (op->Operation == QSPI_OP_ERASE_SECTOR)
+    {
+      s_command.Instruction = SECTOR_ERASE_CMD;
+      QspiOpTimeout         = MT25TL01G_SECTOR_ERASE_MAX_TIME;
+    }
+    else
+    {
+      s_command.Instruction = SUBSECTOR_ERASE_CMD;
+      QspiOpTimeout         = MT25TL01G_SUBSECTOR_ERASE_MAX_TIME;
+    }
+    s_command.DataMode = QSPI_DATA_NONE;
+  }
+
+  /* Enable write operations */
+  if (QSPI_WriteEnable(&QSPIHandle) != QSPI_OK)
+  {
+    return QSPI_ERROR;
+  }
+
+  /* Configure the command */
+  if (HAL_QSPI_Command(&QSPIHandle, &s_command, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return QSPI_ERROR;
+  }
+
+  /* Transmission of the page, in the FIFO at the QSPI clock */
+  if (op->Operation == QSPI_OP_PROGRAM)
+  {
+    if (HAL_QSPI_Transmit(&QSPIHandle, op->pData, HAL_QPSI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+    {
+      return QSPI_ERROR;
+    }
+  }
+
+  /* End of program or erase in interrupt mode */
+  QspiOpTick = HAL_GetTick();
+  if (QSPI_AutoPollingMemReady_IT(&QSPIHandle) != QSPI_OK)
+  {
+    return QSPI_ERROR;
+  }
+
+  return QSPI_OK;
+}
+
+/**
+  * @brief  This function empties the queue after a failed operation.
+  * @retval None
+  */
+static void QSPI_Queue_Fail(void)
+{
+  QspiQueueCount = 0U;
+  QspiQueueError = 1U;
+  BSP_QSPI_QueueErrorCallback();
+}
 /**
   * @}
   */
@@ -123,11 +123,17 @@
 /* MT25TL01G Micron memory */
 /* Size of the flash */
 #define QSPI_FLASH_SIZE            26     /* Address bus width to access whole memory space */
-#define QSPI_PAGE_SIZE             256
+#define QSPI_PAGE_SIZE             512    /* A 256 bytes page in each memory */
 
 /* QSPI Base Address */
 #define QSPI_BASE_ADDRESS          0x90000000
 
+/* Operations of the queue (BSP_QSPI_Write_IT(), BSP_QSPI_Erase_xxx_IT()).
+   Can be defined in the compiler preprocessor options. */
+#if !defined(QSPI_QUEUE_SIZE)
+#define QSPI_QUEUE_SIZE            16U
+#endif
+
 /**
   * @}
   */
@@ -164,6 +170,14 @@ uint8_t BSP_QSPI_GetStatus  (void);
 uint8_t BSP_QSPI_GetInfo    (QSPI_Info* pInfo);
 uint8_t BSP_QSPI_EnableMemoryMappedMode(void);
 
+uint8_t BSP_QSPI_Write_IT       (uint8_t* pData, uint32_t WriteAddr, uint32_t Size);
+uint8_t BSP_QSPI_Erase_Block_IT (uint32_t BlockAddress);
+uint8_t BSP_QSPI_Erase_Sector_IT(uint32_t SectorAddress);
+uint8_t BSP_QSPI_GetQueueStatus (void);
+void    BSP_QSPI_IRQHandler     (void);
+void    BSP_QSPI_QueueCpltCallback(void);
+void    BSP_QSPI_QueueErrorCallback(void);
+
 /* These functions can be modified in case the current settings
    need to be changed for specific application needs */
 void BSP_QSPI_MspInit(QSPI_HandleTypeDef *hqspi, void *Params);
@@ -45,6 +45,24 @@
        the number of blocks to erase.
      o The SD runtime status is returned when calling the function BSP_SD_GetStatus().
 
+  + Write stream
+     o BSP_SD_WriteStream_Open() starts a recording of unknown length from a block
+       address: the data go through two buffers of the same size, alternately sent
+       by the SDMMC internal DMA and filled by the producer function, called from
+       the SDMMC interrupt as soon as a buffer is sent. A single write multiple
+       block command stays open for up to 65535 blocks, the segments following
+       each other after the card programming time only.
+     o The stream ends when the producer returns fewer blocks than asked, the last
+       buffer padded with zeros, or on BSP_SD_WriteStream_Close(), after the buffer
+       in flight. BSP_SD_WriteStreamCpltCallback() is called once the card has
+       programmed the last block, BSP_SD_WriteStream_GetBlocks() returns the
+       blocks produced.
+     o The buffers are in a RAM reached by the SDMMC1 internal DMA (AXI SRAM),
+       32-byte aligned when the data cache is enabled: they are cleaned here.
+       The SDMMC1 interrupt must not be delayed by more than a block time on the
+       bus, so that the stream ends on the exact block. The SD card must not be
+       accessed otherwise while a stream runs.
+
   @endverbatim
   ******************************************************************************
   * @attention
@@ -95,6 +113,22 @@
 /** @defgroup STM32H743I_EVAL_SD_Private_TypesDefinitions SD Private TypesDefinitions
   * @{
   */
+typedef struct
+{
+  BSP_SD_StreamProducerTypeDef Producer;
+  uint32_t      *pBuffer[2];
+  uint32_t      BufferBlocks;
+  uint32_t      Address;        /* First block of the stream                       */
+  uint32_t      Limit;          /* Blocks the stream may write                     */
+  uint32_t      SegStart;       /* Stream blocks before the current segment        */
+  uint32_t      SegBlocks;      /* Blocks of the current write command             */
+  uint32_t      Queued;         /* Blocks handed to the internal DMA, padding in   */
+  __IO uint32_t Filled;         /* Blocks returned by the producer                 */
+  __IO uint32_t Done;           /* Blocks of the buffers sent                      */
+  __IO uint8_t  State;
+  __IO uint8_t  CloseRequest;
+  uint8_t       Ending;         /* No buffer will be filled anymore                */
+} SD_StreamTypeDef;
 /**
   * @}
   */
@@ -102,6 +136,7 @@
 /** @defgroup STM32H743I_EVAL_SD_Private_Defines SD Private Defines
   * @{
   */
+#define SD_STREAM_MAX_SEGMENT    (SDMMC_DLEN_DATALENGTH / BLOCKSIZE)
 /**
   * @}
   */
@@ -118,6 +153,7 @@
   */
 SD_HandleTypeDef uSdHandle;
 static uint8_t UseExtiModeDetection = 0;
+static SD_StreamTypeDef SdStream;
 
 /**
   * @}
@@ -126,6 +162,11 @@ static uint8_t UseExtiModeDetection = 0;
 /** @defgroup STM32H743I_EVAL_SD_Private_FunctionPrototypes SD Private FunctionPrototypes
   * @{
   */
+static uint8_t SD_Stream_Start(void);
+static void    SD_Stream_Fill(uint32_t Index);
+static void    SD_Stream_Release(uint32_t Index);
+static void    SD_Stream_SegmentEnd(void);
+static void    SD_Stream_Finish(void);
 /**
   * @}
   */
@@ -347,6 +388,104 @@ uint8_t BSP_SD_Erase(uint32_t StartAddr, uint32_t EndAddr)
   }
 }
 
+/**
+  * @brief  Starts a write stream.
+  * @param  WriteAddr: First block to write
+  * @param  MaxBlocks: Blocks the stream may write, the stream ends there. Rounded
+  *         down to a multiple of 2 x BufferBlocks.
+  * @param  pBuffer0: First buffer, BufferBlocks blocks
+  * @param  pBuffer1: Second buffer, BufferBlocks blocks
+  * @param  BufferBlocks: Size of each buffer, in blocks
+  * @param  Producer: Function filling the buffers, both are filled from here first
+  * @retval SD status
+  */
+uint8_t BSP_SD_WriteStream_Open(uint32_t WriteAddr, uint32_t MaxBlocks, uint32_t *pBuffer0, uint32_t *pBuffer1,
+                                uint32_t BufferBlocks, BSP_SD_StreamProducerTypeDef Producer)
+{
+  uint32_t pair = 2U * BufferBlocks;
+
+  if((SdStream.State == SD_STREAM_RUNNING) || (SdStream.State == SD_STREAM_CLOSING) ||
+     (pBuffer0 == NULL) || (pBuffer1 == NULL) || (Producer == NULL) ||
+     (BufferBlocks == 0U) || (pair > SD_STREAM_MAX_SEGMENT) || (MaxBlocks < pair))
+  {
+    return MSD_ERROR;
+  }
+
+  SdStream.Producer     = Producer;
+  SdStream.pBuffer[0]   = pBuffer0;
+  SdStream.pBuffer[1]   = pBuffer1;
+  SdStream.BufferBlocks = BufferBlocks;
+  SdStream.Address      = WriteAddr;
+  SdStream.Limit        = MaxBlocks - (MaxBlocks % pair);
+  SdStream.SegStart     = 0U;
+  SdStream.Queued       = 0U;
+  SdStream.Filled       = 0U;
+  SdStream.Done         = 0U;
+  SdStream.CloseRequest = 0U;
+  SdStream.Ending       = 0U;
+
+  SD_Stream_Fill(0U);
+  if(SdStream.Ending == 0U)
+  {
+    SD_Stream_Fill(1U);
+  }
+  if(SdStream.Queued == 0U)
+  {
+    /* Nothing to record */
+    SdStream.State = SD_STREAM_IDLE;
+    return MSD_OK;
+  }
+
+  SdStream.State = SD_STREAM_RUNNING;
+  if(SD_Stream_Start() != MSD_OK)
+  {
+    SdStream.State = SD_STREAM_ERROR;
+    return MSD_ERROR;
+  }
+  return MSD_OK;
+}
+
+/**
+  * @brief  Requests the end of the write stream after the buffer in flight.
+  *         BSP_SD_WriteStreamCpltCallback() is called at the end.
+  * @retval SD status
+  */
+uint8_t BSP_SD_WriteStream_Close(void)
+{
+  if(SdStream.State != SD_STREAM_RUNNING)
+  {
+    return MSD_ERROR;
+  }
+  SdStream.CloseRequest = 1U;
+  return MSD_OK;
+}
+
+/**
+  * @brief  Gets the write stream state.
+  * @retval Stream state.
+  *          This value can be one of the following values:
+  *            @arg  SD_STREAM_IDLE: No stream, or the last one completed
+  *            @arg  SD_STREAM_RUNNING: Stream recording
+  *            @arg  SD_STREAM_CLOSING: Stream ended, card programming the last blocks
+  *            @arg  SD_STREAM_ERROR: Stream stopped by a transfer error
+  */
+uint8_t BSP_SD_WriteStream_GetState(void)
+{
+  return SdStream.State;
+}
+
+/**
+  * @brief  Gets the number of blocks of the stream sent to the card.
+  * @retval Number of blocks, the padding of the last buffer excluded
+  */
+uint32_t BSP_SD_WriteStream_GetBlocks(void)
+{
+  uint32_t done = SdStream.Done;
+  uint32_t filled = SdStream.Filled;
+
+  return (done < filled) ? done : filled;
+}
+
 /**
   * @brief  Initializes the SD MSP.
   * @param  hsd: SD handle
@@ -437,6 +576,29 @@ uint8_t BSP_SD_GetCardState(void)
   return((HAL_SD_GetCardState(&uSdHandle) == HAL_SD_CARD_TRANSFER ) ? SD_TRANSFER_OK : SD_TRANSFER_BUSY);
 }
 
+/**
+  * @brief  Waits for the end of the card programming without blocking, 
+  *         BSP_SD_CardReadyCallback() is called when the card is ready.
+  * @retval SD status
+  */
+uint8_t BSP_SD_WaitCardReady_IT(void)
+{
+  return((HAL_SD_WaitCardReady_IT(&uSdHandle) == HAL_OK) ? MSD_OK : MSD_ERROR);
+}
+
+/**
+  * @brief  Checks once the end of the card programming waited for by 
+  *         BSP_SD_WaitCardReady_IT(). To be called from a periodic timer.
+  * @retval Data transfer state.
+  *          This value can be one of the following values:
+  *            @arg  SD_TRANSFER_OK: Card ready, BSP_SD_CardReadyCallback() called
+  *            @arg  SD_TRANSFER_BUSY: Card still programming
+  */
+uint8_t BSP_SD_PollCardReady(void)
+{
+  return((HAL_SD_PollCardReady(&uSdHandle) == HAL_OK) ? SD_TRANSFER_OK : SD_TRANSFER_BUSY);
+}
+
 
 /**
   * @brief  Get SD information about specific SD card.
@@ -476,6 +638,15 @@ __weak void BSP_SD_ReadCpltCallback(void)
 
 }
 
+/**
+  * @brief BSP Card ready callbacks
+  * @retval None
+  */
+__weak void BSP_SD_CardReadyCallback(void)
+{
+
+}
+
 
 /**
   * @brief BSP Error callbacks
@@ -489,6 +660,15 @@ __weak void BSP_SD_ErrorCallback(void)
 
 
 
+/**
+  * @brief BSP write stream completed callbacks
+  * @retval None
+  */
+__weak void BSP_SD_WriteStreamCpltCallback(void)
+{
+
+}
+
 /**
   * @brief  BSP SD Transceiver 1.8V Mode Callback.
   */
@@ -526,7 +706,14 @@ void HAL_SD_AbortCallback(SD_HandleTypeDef *hsd)
   */
 void HAL_SD_TxCpltCallback(SD_HandleTypeDef *hsd)
 {
-  BSP_SD_WriteCpltCallback();
+  if(SdStream.State == SD_STREAM_RUNNING)
+  {
+    SD_Stream_SegmentEnd();
+  }
+  else
+  {
+    BSP_SD_WriteCpltCallback();
+  }
 }
 
 /**
@@ -539,6 +726,42 @@ void HAL_SD_RxCpltCallback(SD_HandleTypeDef *hsd)
   BSP_SD_ReadCpltCallback();
 }
 
+/**
+  * @brief Card ready callbacks
+  * @param hsd: SD handle
+  * @retval None
+  */
+void HAL_SD_CardReadyCallback(SD_HandleTypeDef *hsd)
+{
+  if((SdStream.State == SD_STREAM_RUNNING) || (SdStream.State == SD_STREAM_CLOSING))
+  {
+    if(HAL_SD_GetError(hsd) != HAL_SD_ERROR_NONE)
+    {
+      SdStream.State = SD_STREAM_ERROR;
+      BSP_SD_ErrorCallback();
+    }
+    else if(SdStream.State == SD_STREAM_CLOSING)
+    {
+      SdStream.State = SD_STREAM_IDLE;
+      BSP_SD_WriteStreamCpltCallback();
+    }
+    else if(SD_Stream_Start() != MSD_OK)
+    {
+      /* Next segment */
+      SdStream.State = SD_STREAM_ERROR;
+      BSP_SD_ErrorCallback();
+    }
+    else
+    {
+      /* Nothing to do */
+    }
+  }
+  else
+  {
+    BSP_SD_CardReadyCallback();
+  }
+}
+
 /**
   * @brief Error callbacks
   * @param hsd: SD handle
@@ -546,8 +769,32 @@ void HAL_SD_RxCpltCallback(SD_HandleTypeDef *hsd)
   */
 void HAL_SD_ErrorCallback(SD_HandleTypeDef *hsd)
 {
+  if((SdStream.State == SD_STREAM_RUNNING) || (SdStream.State == SD_STREAM_CLOSING))
+  {
+    SdStream.State = SD_STREAM_ERROR;
+  }
   BSP_SD_ErrorCallback();
 }
+
+/**
+  * @brief Write stream buffer 0 sent callbacks
+  * @param hsd: SD handle
+  * @retval None
+  */
+void HAL_SDEx_Write_DMADoubleBuffer0CpltCallback(SD_HandleTypeDef *hsd)
+{
+  SD_Stream_Release(0U);
+}
+
+/**
+  * @brief Write stream buffer 1 sent callbacks
+  * @param hsd: SD handle
+  * @retval None
+  */
+void HAL_SDEx_Write_DMADoubleBuffer1CpltCallback(SD_HandleTypeDef *hsd)
+{
+  SD_Stream_Release(1U);
+}
   
 /**
   * @brief  Enable the SD Transceiver 1.8V Mode Callback.
@@ -557,6 +804,175 @@ void HAL_SD_DriveTransciver_1_8V_Callback(FlagStatus status)
     BSP_SD_DriveTransciver_1_8V_Callback(status);
 }
   
+/**
+  * @}
+  */
+
+/** @defgroup STM32H743I_EVAL_SD_Private_Functions SD Private Functions
+  * @{
+  */
+
+/**
+  * @brief  Starts the write command of the next stream segment, from buffer 0.
+  * @retval SD status
+  */
+static uint8_t SD_Stream_Start(void)
+{
+  uint32_t pair = 2U * SdStream.BufferBlocks;
+  uint32_t blocks = SdStream.Limit - SdStream.SegStart;
+
+  /* An even number of buffers per segment: the next one starts with buffer 0 */
+  if(blocks > SD_STREAM_MAX_SEGMENT)
+  {
+    blocks = SD_STREAM_MAX_SEGMENT - (SD_STREAM_MAX_SEGMENT % pair);
+  }
+  SdStream.SegBlocks = blocks;
+
+  if(HAL_SDEx_ConfigDMAMultiBuffer(&uSdHandle, SdStream.pBuffer[0], SdStream.pBuffer[1], SdStream.BufferBlocks) != HAL_OK)
+  {
+    return MSD_ERROR;
+  }
+  if(HAL_SDEx_WriteBlocksDMAMultiBuffer(&uSdHandle, SdStream.Address + SdStream.SegStart, blocks) != HAL_OK)
+  {
+    return MSD_ERROR;
+  }
+  return MSD_OK;
+}
+
+/**
+  * @brief  Fills a sent buffer from the producer, unless the stream ends.
+  * @param  Index: Buffer 0 or 1
+  * @retval None
+  */
+static void SD_Stream_Fill(uint32_t Index)
+{
+  uint32_t *pData = SdStream.pBuffer[Index];
+  uint32_t words = SdStream.BufferBlocks * (BLOCKSIZE / 4U);
+  uint32_t blocks = 0U;
+  uint32_t i;
+
+  if((SdStream.CloseRequest == 0U) && (SdStream.Queued < SdStream.Limit))
+  {
+    blocks = SdStream.Producer(pData, SdStream.BufferBlocks);
+    if(blocks > SdStream.BufferBlocks)
+    {
+      blocks = SdStream.BufferBlocks;
+    }
+  }
+
+  if(blocks < SdStream.BufferBlocks)
+  {
+    SdStream.Ending = 1U;
+    /* The stream stops on a buffer end: the last one is padded */
+    for(i = blocks * (BLOCKSIZE / 4U); (blocks != 0U) && (i < words); i++)
+    {
+      pData[i] = 0U;
+    }
+  }
+
+  if(blocks != 0U)
+  {
+    SdStream.Filled += blocks;
+    SdStream.Queued += SdStream.BufferBlocks;
+#if (__DCACHE_PRESENT == 1U)
+    if((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+    {
+      SCB_CleanDCache_by_Addr(pData, (int32_t)(words * 4U));
+    }
+#endif
+  }
+
+  if(SdStream.Queued >= SdStream.Limit)
+  {
+    SdStream.Ending = 1U;
+  }
+}
+
+/**
+  * @brief  Handles a buffer sent by the internal DMA, the other one being sent.
+  * @param  Index: Buffer 0 or 1
+  * @retval None
+  */
+static void SD_Stream_Release(uint32_t Index)
+{
+  if(SdStream.State != SD_STREAM_RUNNING)
+  {
+    return;
+  }
+
+  /* The last buffer of a segment is handled at the data end */
+  if((SdStream.Done + SdStream.BufferBlocks) >= (SdStream.SegStart + SdStream.SegBlocks))
+  {
+    return;
+  }
+  SdStream.Done += SdStream.BufferBlocks;
+
+  if(SdStream.Ending == 0U)
+  {
+    SD_Stream_Fill(Index);
+  }
+  else if(SdStream.Done >= SdStream.Queued)
+  {
+    /* Last buffer sent, the internal DMA already reads the other one */
+    if(HAL_SDEx_StopDMAMultiBuffer(&uSdHandle, SdStream.Done - SdStream.SegStart) != HAL_OK)
+    {
+      SdStream.State = SD_STREAM_ERROR;
+      BSP_SD_ErrorCallback();
+      return;
+    }
+    SD_Stream_Finish();
+  }
+  else
+  {
+    /* Last buffer in flight */
+  }
+}
+
+/**
+  * @brief  Handles the end of a segment, the stop command being sent.
+  * @retval None
+  */
+static void SD_Stream_SegmentEnd(void)
+{
+  SdStream.Done = SdStream.SegStart + SdStream.SegBlocks;
+  SdStream.SegStart = SdStream.Done;
+
+  /* Buffer 1 ends a segment */
+  if(SdStream.Ending == 0U)
+  {
+    SD_Stream_Fill(1U);
+  }
+
+  if((SdStream.Ending != 0U) && (SdStream.Done >= SdStream.Queued))
+  {
+    SD_Stream_Finish();
+  }
+  else if(HAL_SD_WaitCardReady_IT(&uSdHandle) != HAL_OK)
+  {
+    /* The next segment starts once the card programmed this one */
+    SdStream.State = SD_STREAM_ERROR;
+    BSP_SD_ErrorCallback();
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+}
+
+/**
+  * @brief  Waits for the card to program the last blocks of the stream.
+  * @retval None
+  */
+static void SD_Stream_Finish(void)
+{
+  SdStream.State = SD_STREAM_CLOSING;
+  if(HAL_SD_WaitCardReady_IT(&uSdHandle) != HAL_OK)
+  {
+    SdStream.State = SD_STREAM_ERROR;
+    BSP_SD_ErrorCallback();
+  }
+}
+
 /**
   * @}
   */
@@ -68,6 +68,13 @@
   * @brief SD Card information structure
   */
 #define BSP_SD_CardInfo HAL_SD_CardInfoTypeDef
+
+/**
+  * @brief SD write stream producer: fills pData with at most NumOfBlocks blocks
+  *        and returns the number of blocks filled, less than NumOfBlocks to end
+  *        the stream. Called from the SDMMC interrupt.
+  */
+typedef uint32_t (*BSP_SD_StreamProducerTypeDef)(uint32_t *pData, uint32_t NumOfBlocks);
 /**
   * @}
   */
@@ -85,6 +92,14 @@
 #define   SD_TRANSFER_OK                ((uint8_t)0x00)
 #define   SD_TRANSFER_BUSY              ((uint8_t)0x01)
 
+/**
+  * @brief  SD write stream state definition
+  */
+#define   SD_STREAM_IDLE                ((uint8_t)0x00)
+#define   SD_STREAM_RUNNING             ((uint8_t)0x01)
+#define   SD_STREAM_CLOSING             ((uint8_t)0x02)   /* Last blocks programmed by the card */
+#define   SD_STREAM_ERROR               ((uint8_t)0x03)
+
 /** @defgroup STM32H743I_EVAL_SD_Exported_Constants SD Exported Constants
   * @{
   */
@@ -123,9 +138,17 @@ uint8_t BSP_SD_ReadBlocks_DMA(uint32_t *pData, uint32_t ReadAddr, uint32_t NumOf
 uint8_t BSP_SD_WriteBlocks_DMA(uint32_t *pData, uint32_t WriteAddr, uint32_t NumOfBlocks);
 uint8_t BSP_SD_Erase(uint32_t StartAddr, uint32_t EndAddr);
 uint8_t BSP_SD_GetCardState(void);
+uint8_t BSP_SD_WaitCardReady_IT(void);
+uint8_t BSP_SD_PollCardReady(void);
 void    BSP_SD_GetCardInfo(BSP_SD_CardInfo *CardInfo);
 uint8_t BSP_SD_IsDetected(void);
 
+uint8_t  BSP_SD_WriteStream_Open(uint32_t WriteAddr, uint32_t MaxBlocks, uint32_t *pBuffer0, uint32_t *pBuffer1,
+                                 uint32_t BufferBlocks, BSP_SD_StreamProducerTypeDef Producer);
+uint8_t  BSP_SD_WriteStream_Close(void);
+uint8_t  BSP_SD_WriteStream_GetState(void);
+uint32_t BSP_SD_WriteStream_GetBlocks(void);
+
 /* These functions can be modified in case the current settings (e.g. DMA stream)
    need to be changed for specific application needs */
 void    BSP_SD_MspInit(SD_HandleTypeDef *hsd, void *Params);
@@ -133,7 +156,9 @@ void    BSP_SD_MspDeInit(SD_HandleTypeDef *hsd, void *Params);
 void    BSP_SD_AbortCallback(void);
 void    BSP_SD_WriteCpltCallback(void);
 void    BSP_SD_ReadCpltCallback(void);
+void    BSP_SD_CardReadyCallback(void);
 void    BSP_SD_ErrorCallback(void);
+void    BSP_SD_WriteStreamCpltCallback(void);
 void    BSP_SD_DriveTransciver_1_8V_Callback(FlagStatus status);
 
 /**
@@ -31,6 +31,147 @@
 
 #include "arm_math.h"
 
+/* Selection of the FFT tables
+ *
+ * The initialization functions of the FFTs refer to the tables of all the
+ * lengths they support, so that all of them are linked as soon as an FFT is
+ * used. When ARM_DSP_CONFIG_TABLES is defined, only the tables of the lengths
+ * enabled by the macros below are compiled, and the initialization functions
+ * return ARM_MATH_ARGUMENT_ERROR for the other lengths:
+ *   ARM_TABLE_FFT_F32_<n>   arm_cfft_f32() of length n, n = 16 to 4096, 500, 600, 768, 1000, 1200, 1536
+ *   ARM_TABLE_FFT_Q31_<n>   arm_cfft_q31() of length n, n = 16 to 4096, and arm_rfft_q31() of length 2n
+ *   ARM_TABLE_FFT_Q15_<n>   arm_cfft_q15() of length n, n = 16 to 4096, and arm_rfft_q15() of length 2n
+ *   ARM_TABLE_RFFT_F32_<n>  arm_rfft_fast_f32() of length n, n = 32 to 4096, 1000, 1200, 1536,
+ *                           which also enables ARM_TABLE_FFT_F32_<n/2>
+ *   ARM_TABLE_BITREV_1024   bit reversal table of the deprecated radix-2 and radix-4 FFTs, which also
+ *                           need ARM_TABLE_FFT_<type>_4096 for their data type
+ * for instance -DARM_DSP_CONFIG_TABLES -DARM_TABLE_RFFT_F32_1024 for the real
+ * FFT of 1024 points only.
+ *
+ * The tables of the lengths used can be placed in a fast memory, copied from
+ * flash at startup by the sections of the linker template:
+ *   ARM_DSP_TABLES_IN_DTCM    .dtcm_data section, F7 and H7
+ *   ARM_DSP_TABLES_IN_CCMRAM  .ccmram section, F3 and F4 with CCM RAM
+ * or ARM_DSP_TABLE_ATTR can be defined to the attribute of another section.
+ */
+#if defined(ARM_DSP_TABLES_IN_DTCM)
+#define ARM_DSP_TABLE_ATTR __attribute__((section(".dtcm_data.arm_dsp_tables")))
+#elif defined(ARM_DSP_TABLES_IN_CCMRAM)
+#define ARM_DSP_TABLE_ATTR __attribute__((section(".ccmram.arm_dsp_tables")))
+#elif !defined(ARM_DSP_TABLE_ATTR)
+#define ARM_DSP_TABLE_ATTR
+#endif
+
+#if !defined(ARM_DSP_CONFIG_TABLES)
+#define ARM_TABLE_FFT_F32_16
+#define ARM_TABLE_FFT_F32_32
+#define ARM_TABLE_FFT_F32_64
+#define ARM_TABLE_FFT_F32_128
+#define ARM_TABLE_FFT_F32_256
+#define ARM_TABLE_FFT_F32_512
+#define ARM_TABLE_FFT_F32_1024
+#define ARM_TABLE_FFT_F32_2048
+#define ARM_TABLE_FFT_F32_4096
+#define ARM_TABLE_FFT_F32_500
+#define ARM_TABLE_FFT_F32_600
+#define ARM_TABLE_FFT_F32_768
+#define ARM_TABLE_FFT_F32_1000
+#define ARM_TABLE_FFT_F32_1200
+#define ARM_TABLE_FFT_F32_1536
+#define ARM_TABLE_FFT_Q31_16
+#define ARM_TABLE_FFT_Q31_32
+#define ARM_TABLE_FFT_Q31_64
+#define ARM_TABLE_FFT_Q31_128
+#define ARM_TABLE_FFT_Q31_256
+#define ARM_TABLE_FFT_Q31_512
+#define ARM_TABLE_FFT_Q31_1024
+#define ARM_TABLE_FFT_Q31_2048
+#define ARM_TABLE_FFT_Q31_4096
+#define ARM_TABLE_FFT_Q15_16
+#define ARM_TABLE_FFT_Q15_32
+#define ARM_TABLE_FFT_Q15_64
+#define ARM_TABLE_FFT_Q15_128
+#define ARM_TABLE_FFT_Q15_256
+#define ARM_TABLE_FFT_Q15_512
+#define ARM_TABLE_FFT_Q15_1024
+#define ARM_TABLE_FFT_Q15_2048
+#define ARM_TABLE_FFT_Q15_4096
+#define ARM_TABLE_RFFT_F32_32
+#define ARM_TABLE_RFFT_F32_64
+#define ARM_TABLE_RFFT_F32_128
+#define ARM_TABLE_RFFT_F32_256
+#define ARM_TABLE_RFFT_F32_512
+#define ARM_TABLE_RFFT_F32_1024
+#define ARM_TABLE_RFFT_F32_2048
+#define ARM_TABLE_RFFT_F32_4096
+#define ARM_TABLE_RFFT_F32_1000
+#define ARM_TABLE_RFFT_F32_1200
+#define ARM_TABLE_RFFT_F32_1536
+#define ARM_TABLE_BITREV_1024
+#endif
+
+/* Tables needed by the lengths enabled */
+#if defined(ARM_TABLE_RFFT_F32_32) && !defined(ARM_TABLE_FFT_F32_16)
+#define ARM_TABLE_FFT_F32_16
+#endif
+#if defined(ARM_TABLE_RFFT_F32_64) && !defined(ARM_TABLE_FFT_F32_32)
+#define ARM_TABLE_FFT_F32_32
+#endif
+#if defined(ARM_TABLE_RFFT_F32_128) && !defined(ARM_TABLE_FFT_F32_64)
+#define ARM_TABLE_FFT_F32_64
+#endif
+#if defined(ARM_TABLE_RFFT_F32_256) && !defined(ARM_TABLE_FFT_F32_128)
+#define ARM_TABLE_FFT_F32_128
+#endif
+#if defined(ARM_TABLE_RFFT_F32_512) && !defined(ARM_TABLE_FFT_F32_256)
+#define ARM_TABLE_FFT_F32_256
+#endif
+#if defined(ARM_TABLE_RFFT_F32_1024) && !defined(ARM_TABLE_FFT_F32_512)
+#define ARM_TABLE_FFT_F32_512
+#endif
+#if defined(ARM_TABLE_RFFT_F32_2048) && !defined(ARM_TABLE_FFT_F32_1024)
+#define ARM_TABLE_FFT_F32_1024
+#endif
+#if defined(ARM_TABLE_RFFT_F32_4096) && !defined(ARM_TABLE_FFT_F32_2048)
+#define ARM_TABLE_FFT_F32_2048
+#endif
+#if defined(ARM_TABLE_RFFT_F32_1000) && !defined(ARM_TABLE_FFT_F32_500)
+#define ARM_TABLE_FFT_F32_500
+#endif
+#if defined(ARM_TABLE_RFFT_F32_1200) && !defined(ARM_TABLE_FFT_F32_600)
+#define ARM_TABLE_FFT_F32_600
+#endif
+#if defined(ARM_TABLE_RFFT_F32_1536) && !defined(ARM_TABLE_FFT_F32_768)
+#define ARM_TABLE_FFT_F32_768
+#endif
+#if defined(ARM_TABLE_FFT_Q31_16) || defined(ARM_TABLE_FFT_Q15_16)
+#define ARM_TABLE_BITREV_FIXED_16
+#endif
+#if defined(ARM_TABLE_FFT_Q31_32) || defined(ARM_TABLE_FFT_Q15_32)
+#define ARM_TABLE_BITREV_FIXED_32
+#endif
+#if defined(ARM_TABLE_FFT_Q31_64) || defined(ARM_TABLE_FFT_Q15_64)
+#define ARM_TABLE_BITREV_FIXED_64
+#endif
+#if defined(ARM_TABLE_FFT_Q31_128) || defined(ARM_TABLE_FFT_Q15_128)
+#define ARM_TABLE_BITREV_FIXED_128
+#endif
+#if defined(ARM_TABLE_FFT_Q31_256) || defined(ARM_TABLE_FFT_Q15_256)
+#define ARM_TABLE_BITREV_FIXED_256
+#endif
+#if defined(ARM_TABLE_FFT_Q31_512) || defined(ARM_TABLE_FFT_Q15_512)
+#define ARM_TABLE_BITREV_FIXED_512
+#endif
+#if defined(ARM_TABLE_FFT_Q31_1024) || defined(ARM_TABLE_FFT_Q15_1024)
+#define ARM_TABLE_BITREV_FIXED_1024
+#endif
+#if defined(ARM_TABLE_FFT_Q31_2048) || defined(ARM_TABLE_FFT_Q15_2048)
+#define ARM_TABLE_BITREV_FIXED_2048
+#endif
+#if defined(ARM_TABLE_FFT_Q31_4096) || defined(ARM_TABLE_FFT_Q15_4096)
+#define ARM_TABLE_BITREV_FIXED_4096
+#endif
+
 extern const uint16_t armBitRevTable[1024];
 extern const q15_t armRecipTableQ15[64];
 extern const q31_t armRecipTableQ31[64];
@@ -43,6 +184,12 @@ extern const float32_t twiddleCoef_512[1024];
 extern const float32_t twiddleCoef_1024[2048];
 extern const float32_t twiddleCoef_2048[4096];
 extern const float32_t twiddleCoef_4096[8192];
+extern const float32_t twiddleCoef_500[1000];
+extern const float32_t twiddleCoef_600[1200];
+extern const float32_t twiddleCoef_768[1536];
+extern const float32_t twiddleCoef_1000[2000];
+extern const float32_t twiddleCoef_1200[2400];
+extern const float32_t twiddleCoef_1536[3072];
 #define twiddleCoef twiddleCoef_4096
 extern const q31_t twiddleCoef_16_q31[24];
 extern const q31_t twiddleCoef_32_q31[48];
@@ -70,6 +217,9 @@ extern const float32_t twiddleCoef_rfft_512[512];
 extern const float32_t twiddleCoef_rfft_1024[1024];
 extern const float32_t twiddleCoef_rfft_2048[2048];
 extern const float32_t twiddleCoef_rfft_4096[4096];
+extern const float32_t twiddleCoef_rfft_1000[1000];
+extern const float32_t twiddleCoef_rfft_1200[1200];
+extern const float32_t twiddleCoef_rfft_1536[1536];
 
 /* floating-point bit reversal tables */
 #define ARMBITREVINDEXTABLE_16_TABLE_LENGTH ((uint16_t)20)
@@ -82,6 +232,14 @@ extern const float32_t twiddleCoef_rfft_4096[4096];
 #define ARMBITREVINDEXTABLE_2048_TABLE_LENGTH ((uint16_t)3808)
 #define ARMBITREVINDEXTABLE_4096_TABLE_LENGTH ((uint16_t)4032)
 
+/* floating-point digit reversal tables of the mixed radix lengths */
+#define ARMBITREVINDEXTABLE_500_TABLE_LENGTH ((uint16_t)968)
+#define ARMBITREVINDEXTABLE_600_TABLE_LENGTH ((uint16_t)1196)
+#define ARMBITREVINDEXTABLE_768_TABLE_LENGTH ((uint16_t)1520)
+#define ARMBITREVINDEXTABLE_1000_TABLE_LENGTH ((uint16_t)1992)
+#define ARMBITREVINDEXTABLE_1200_TABLE_LENGTH ((uint16_t)2400)
+#define ARMBITREVINDEXTABLE_1536_TABLE_LENGTH ((uint16_t)3020)
+
 extern const uint16_t armBitRevIndexTable16[ARMBITREVINDEXTABLE_16_TABLE_LENGTH];
 extern const uint16_t armBitRevIndexTable32[ARMBITREVINDEXTABLE_32_TABLE_LENGTH];
 extern const uint16_t armBitRevIndexTable64[ARMBITREVINDEXTABLE_64_TABLE_LENGTH];
@@ -91,6 +249,12 @@ extern const uint16_t armBitRevIndexTable512[ARMBITREVINDEXTABLE_512_TABLE_LENGT
 extern const uint16_t armBitRevIndexTable1024[ARMBITREVINDEXTABLE_1024_TABLE_LENGTH];
 extern const uint16_t armBitRevIndexTable2048[ARMBITREVINDEXTABLE_2048_TABLE_LENGTH];
 extern const uint16_t armBitRevIndexTable4096[ARMBITREVINDEXTABLE_4096_TABLE_LENGTH];
+extern const uint16_t armBitRevIndexTable500[ARMBITREVINDEXTABLE_500_TABLE_LENGTH];
+extern const uint16_t armBitRevIndexTable600[ARMBITREVINDEXTABLE_600_TABLE_LENGTH];
+extern const uint16_t armBitRevIndexTable768[ARMBITREVINDEXTABLE_768_TABLE_LENGTH];
+extern const uint16_t armBitRevIndexTable1000[ARMBITREVINDEXTABLE_1000_TABLE_LENGTH];
+extern const uint16_t armBitRevIndexTable1200[ARMBITREVINDEXTABLE_1200_TABLE_LENGTH];
+extern const uint16_t armBitRevIndexTable1536[ARMBITREVINDEXTABLE_1536_TABLE_LENGTH];
 
 /* fixed-point bit reversal tables */
 #define ARMBITREVINDEXTABLE_FIXED_16_TABLE_LENGTH ((uint16_t)12)
@@ -118,4 +282,15 @@ extern const float32_t sinTable_f32[FAST_MATH_TABLE_SIZE + 1];
 extern const q31_t sinTable_q31[FAST_MATH_TABLE_SIZE + 1];
 extern const q15_t sinTable_q15[FAST_MATH_TABLE_SIZE + 1];
 
+/* Tables for Fast Math Exponential, Logarithm, Arc Tangent and Hyperbolic Tangent */
+extern const float32_t expTable_f32[32];
+extern const float32_t logTable_f32[32];
+extern const float32_t logInvTable_f32[32];
+extern const q31_t logTable_q31[33];
+extern const q31_t logInvTable_q31[33];
+extern const float32_t atanTable_f32[165];
+extern const q31_t atanTable_q31[165];
+extern const float32_t tanhTable_f32[73];
+extern const q31_t tanhTable_q31[177];
+
 #endif /*  ARM_COMMON_TABLES_H */
@@ -392,7 +392,8 @@ extern "C"
     ARM_MATH_SIZE_MISMATCH = -3,         /**< Size of matrices is not compatible with the operation. */
     ARM_MATH_NANINF = -4,                /**< Not-a-number (NaN) or infinity is generated */
     ARM_MATH_SINGULAR = -5,              /**< Generated by matrix inversion if the input matrix is singular and cannot be inverted. */
-    ARM_MATH_TEST_FAILURE = -6           /**< Test Failed  */
+    ARM_MATH_TEST_FAILURE = -6,          /**< Test Failed  */
+    ARM_MATH_DECOMPOSITION_FAILURE = -7  /**< Generated by matrix decompositions if the input matrix cannot be factorized. */
   } arm_status;
 
   /**
@@ -2313,6 +2314,438 @@ void arm_rfft_fast_f32(
   float32_t * p, float32_t * pOut,
   uint8_t ifftFlag);
 
+  /**
+   * @brief Instance structure for the floating-point partitioned FFT FIR filter.
+   */
+  typedef struct
+  {
+    arm_rfft_fast_instance_f32 rfft;  /**< real FFT of length 2*blockSize. */
+    uint16_t numTaps;                 /**< number of filter coefficients in the filter. */
+    uint16_t blockSize;               /**< number of samples processed per call, also the partition length. */
+    uint16_t numParts;                /**< number of filter partitions, ceil(numTaps / blockSize). */
+    uint16_t partIndex;               /**< slot of the newest input spectrum in the frequency delay line. */
+    float32_t *pCoeffsFreq;           /**< points to the partition spectra, numParts*2*blockSize values. */
+    float32_t *pFdl;                  /**< points to the frequency delay line, numParts*2*blockSize values. */
+    float32_t *pInput;                /**< points to the input window, 2*blockSize values. */
+    float32_t *pAcc;                  /**< points to the spectrum accumulator, 2*blockSize values. */
+    float32_t *pScratch;              /**< points to the FFT and product work buffer, 2*blockSize values. */
+  } arm_fir_fft_instance_f32;
+
+  /**
+   * @brief Size in samples of the state buffer of a partitioned FFT FIR filter.
+   */
+#define ARM_FIR_FFT_STATE_SIZE_F32(numTaps, blockSize) \
+  ((4u * (((numTaps) + (blockSize) - 1u) / (blockSize)) + 6u) * (blockSize))
+
+  /**
+   * @brief Processing function for the floating-point partitioned FFT FIR filter.
+   * @param[in]  S     points to an instance of the floating-point partitioned FFT FIR structure.
+   * @param[in]  pSrc  points to the block of blockSize input samples.
+   * @param[out] pDst  points to the block of blockSize output samples.
+   */
+  void arm_fir_fft_f32(
+  arm_fir_fft_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst);
+
+  /**
+   * @brief  Initialization function for the floating-point partitioned FFT FIR filter.
+   * @param[in,out] S          points to an instance of the floating-point partitioned FFT FIR structure.
+   * @param[in]     numTaps    Number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients, in time reversed order.
+   * @param[in]     pState     points to the state buffer of ARM_FIR_FFT_STATE_SIZE_F32(numTaps, blockSize) samples.
+   * @param[in]     blockSize  number of samples processed per call; 2*blockSize must be a supported real FFT length.
+   * @return        ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_fir_fft_init_f32(
+  arm_fir_fft_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint16_t blockSize);
+
+  /**
+   * @brief Double-talk hook of the frequency-domain adaptive filter.
+   * @param[in] pContext   context given in the instance.
+   * @param[in] pSrc       points to the block of input samples.
+   * @param[in] pRef       points to the block of reference samples.
+   * @param[in] pErr       points to the block of error samples.
+   * @param[in] blockSize  number of samples in each block.
+   * @return    factor applied to the step for the block, from 0 (adaptation frozen) to 1.
+   */
+  typedef float32_t (*arm_fdaf_double_talk_f32)(
+  void * pContext,
+  float32_t * pSrc,
+  float32_t * pRef,
+  float32_t * pErr,
+  uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the floating-point partitioned frequency-domain adaptive filter.
+   */
+  typedef struct
+  {
+    arm_rfft_fast_instance_f32 rfft;  /**< real FFT of length 2*blockSize. */
+    uint16_t numTaps;                 /**< number of filter coefficients in the filter. */
+    uint16_t blockSize;               /**< number of samples processed per call, also the partition length. */
+    uint16_t numParts;                /**< number of filter partitions, ceil(numTaps / blockSize). */
+    uint16_t partIndex;               /**< slot of the newest input spectrum in the frequency delay line. */
+    uint16_t constrainIndex;          /**< partition constrained at the next block. */
+    float32_t mu;                     /**< step size that controls filter coefficient updates. */
+    float32_t beta;                   /**< smoothing factor of the bin powers. */
+    float32_t delta;                  /**< regularization of the bin powers. */
+    arm_fdaf_double_talk_f32 pDoubleTalk; /**< double-talk hook, or NULL to always adapt. */
+    void *pContext;                   /**< context given to the double-talk hook. */
+    float32_t *pCoeffsFreq;           /**< points to the partition spectra, numParts*2*blockSize values. */
+    float32_t *pFdl;                  /**< points to the frequency delay line, numParts*2*blockSize values. */
+    float32_t *pInput;                /**< points to the input window, 2*blockSize values. */
+    float32_t *pErrFreq;              /**< points to the error spectrum, 2*blockSize values. */
+    float32_t *pAcc;                  /**< points to the output spectrum accumulator, 2*blockSize values. */
+    float32_t *pScratch;              /**< points to the FFT work buffer, 2*blockSize values. */
+    float32_t *pPower;                /**< points to the bin powers, blockSize+1 values. */
+  } arm_fdaf_instance_f32;
+
+  /**
+   * @brief Size in samples of the state buffer of a partitioned frequency-domain adaptive filter.
+   */
+#define ARM_FDAF_STATE_SIZE_F32(numTaps, blockSize) \
+  ((4u * (((numTaps) + (blockSize) - 1u) / (blockSize)) + 9u) * (blockSize) + 1u)
+
+  /**
+   * @brief Processing function for the floating-point partitioned frequency-domain adaptive filter.
+   * @param[in]  S     points to an instance of the floating-point frequency-domain adaptive filter structure.
+   * @param[in]  pSrc  points to the block of blockSize input samples.
+   * @param[in]  pRef  points to the block of blockSize reference samples.
+   * @param[out] pErr  points to the block of blockSize error samples.
+   */
+  void arm_fdaf_f32(
+  arm_fdaf_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pRef,
+  float32_t * pErr);
+
+  /**
+   * @brief  Initialization function for the floating-point partitioned frequency-domain adaptive filter.
+   * @param[in,out] S          points to an instance of the floating-point frequency-domain adaptive filter structure.
+   * @param[in]     numTaps    Number of filter coefficients in the filter.
+   * @param[in]     mu         step size that controls filter coefficient updates.
+   * @param[in]     pState     points to the state buffer of ARM_FDAF_STATE_SIZE_F32(numTaps, blockSize) samples.
+   * @param[in]     blockSize  number of samples processed per call; 2*blockSize must be a supported real FFT length.
+   * @return        ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_fdaf_init_f32(
+  arm_fdaf_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t mu,
+  float32_t * pState,
+  uint16_t blockSize);
+
+  /**
+   * @brief Instance structure for the floating-point multi-bin Goertzel.
+   */
+  typedef struct
+  {
+    uint16_t numBins;                 /**< number of frequencies analyzed. */
+    const float32_t *pCoeffs;         /**< points to the coefficients, 2*cos(w), cos(w) and sin(w) of each bin. */
+    float32_t *pState;                /**< points to the state of the recursions, 2*numBins values. */
+  } arm_goertzel_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 multi-bin Goertzel.
+   */
+  typedef struct
+  {
+    uint16_t numBins;                 /**< number of frequencies analyzed. */
+    uint8_t inputShift;               /**< right shift applied to the input samples. */
+    const q31_t *pCoeffs;             /**< points to the coefficients, cos(w) and sin(w) of each bin in 1.31 format. */
+    q31_t *pState;                    /**< points to the state of the recursions, 2*numBins values. */
+  } arm_goertzel_instance_q31;
+
+  /**
+   * @brief  Initialization function for the floating-point multi-bin Goertzel.
+   * @param[in,out] S        points to an instance of the floating-point Goertzel structure.
+   * @param[in]     numBins  number of frequencies analyzed.
+   * @param[in]     pFreq    points to the numBins normalized frequencies f/fs, in [0 0.5].
+   * @param[in]     pCoeffs  points to the coefficient buffer of 3*numBins values, filled by the function.
+   * @param[in]     pState   points to the state buffer of 2*numBins values.
+   * @return        ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_goertzel_init_f32(
+  arm_goertzel_instance_f32 * S,
+  uint16_t numBins,
+  const float32_t * pFreq,
+  float32_t * pCoeffs,
+  float32_t * pState);
+
+  /**
+   * @brief Processing function for the floating-point multi-bin Goertzel.
+   * @param[in,out] S          points to an instance of the floating-point Goertzel structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_goertzel_f32(
+  arm_goertzel_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize);
+
+  /**
+   * @brief Per-sample processing function for the floating-point multi-bin Goertzel.
+   * @param[in,out] S  points to an instance of the floating-point Goertzel structure.
+   * @param[in]     x  input sample.
+   */
+  void arm_goertzel_sample_f32(
+  arm_goertzel_instance_f32 * S,
+  float32_t x);
+
+  /**
+   * @brief End of block function for the floating-point multi-bin Goertzel.
+   * @param[in,out] S     points to an instance of the floating-point Goertzel structure.
+   * @param[out]    pDst  points to the numBins complex results, in interleaved fashion (real, imag).
+   */
+  void arm_goertzel_get_f32(
+  arm_goertzel_instance_f32 * S,
+  float32_t * pDst);
+
+  /**
+   * @brief  Initialization function for the Q31 multi-bin Goertzel.
+   * @param[in,out] S           points to an instance of the Q31 Goertzel structure.
+   * @param[in]     numBins     number of frequencies analyzed.
+   * @param[in]     pFreq       points to the numBins normalized frequencies f/fs, in 1.31 format, in [0 0.5].
+   * @param[in]     pCoeffs     points to the coefficient buffer of 2*numBins values, filled by the function.
+   * @param[in]     pState      points to the state buffer of 2*numBins values.
+   * @param[in]     inputShift  right shift applied to the input samples.
+   * @return        ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_goertzel_init_q31(
+  arm_goertzel_instance_q31 * S,
+  uint16_t numBins,
+  const q31_t * pFreq,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  uint8_t inputShift);
+
+  /**
+   * @brief Processing function for the Q31 multi-bin Goertzel.
+   * @param[in,out] S          points to an instance of the Q31 Goertzel structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_goertzel_q31(
+  arm_goertzel_instance_q31 * S,
+  q31_t * pSrc,
+  uint32_t blockSize);
+
+  /**
+   * @brief Per-sample processing function for the Q31 multi-bin Goertzel.
+   * @param[in,out] S  points to an instance of the Q31 Goertzel structure.
+   * @param[in]     x  input sample.
+   */
+  void arm_goertzel_sample_q31(
+  arm_goertzel_instance_q31 * S,
+  q31_t x);
+
+  /**
+   * @brief End of block function for the Q31 multi-bin Goertzel.
+   * @param[in,out] S     points to an instance of the Q31 Goertzel structure.
+   * @param[out]    pDst  points to the numBins complex results, in interleaved fashion (real, imag).
+   */
+  void arm_goertzel_get_q31(
+  arm_goertzel_instance_q31 * S,
+  q31_t * pDst);
+
+  /**
+   * @brief Instance structure for the floating-point sliding DFT.
+   */
+  typedef struct
+  {
+    uint16_t numBins;                 /**< number of bins tracked. */
+    uint16_t windowLength;            /**< window length N, in samples. */
+    uint16_t index;                   /**< position of the oldest sample in the delay line. */
+    float32_t dampingN;               /**< damping factor raised to the power N. */
+    const float32_t *pCoeffs;         /**< points to the twiddles, r*cos(w) and r*sin(w) of each bin. */
+    float32_t *pState;                /**< points to the complex bins, 2*numBins values. */
+    float32_t *pDelay;                /**< points to the delay line, windowLength values. */
+  } arm_sdft_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 sliding DFT.
+   */
+  typedef struct
+  {
+    uint16_t numBins;                 /**< number of bins tracked. */
+    uint16_t windowLength;            /**< window length N, in samples. */
+    uint16_t index;                   /**< position of the oldest sample in the delay line. */
+    uint8_t inputShift;               /**< right shift applied to the input samples. */
+    q31_t dampingN;                   /**< damping factor raised to the power N. */
+    const q31_t *pCoeffs;             /**< points to the twiddles, r*cos(w) and r*sin(w) of each bin in 1.31 format. */
+    q31_t *pState;                    /**< points to the complex bins, 2*numBins values. */
+    q31_t *pDelay;                    /**< points to the delay line, windowLength values. */
+  } arm_sdft_instance_q31;
+
+  /**
+   * @brief  Initialization function for the floating-point sliding DFT.
+   * @param[in,out] S             points to an instance of the floating-point sliding DFT structure.
+   * @param[in]     numBins       number of bins tracked.
+   * @param[in]     windowLength  window length N, in samples.
+   * @param[in]     pBins         points to the numBins bin indexes, below N.
+   * @param[in]     damping       damping factor r, in (0 1].
+   * @param[in]     pCoeffs       points to the coefficient buffer of 2*numBins values, filled by the function.
+   * @param[in]     pState        points to the bin buffer of 2*numBins values.
+   * @param[in]     pDelay        points to the delay line of windowLength values.
+   * @return        ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_sdft_init_f32(
+  arm_sdft_instance_f32 * S,
+  uint16_t numBins,
+  uint16_t windowLength,
+  const uint16_t * pBins,
+  float32_t damping,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  float32_t * pDelay);
+
+  /**
+   * @brief Processing function for the floating-point sliding DFT.
+   * @param[in,out] S          points to an instance of the floating-point sliding DFT structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_sdft_f32(
+  arm_sdft_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize);
+
+  /**
+   * @brief Per-sample processing function for the floating-point sliding DFT.
+   * @param[in,out] S  points to an instance of the floating-point sliding DFT structure.
+   * @param[in]     x  input sample.
+   */
+  void arm_sdft_sample_f32(
+  arm_sdft_instance_f32 * S,
+  float32_t x);
+
+  /**
+   * @brief  Initialization function for the Q31 sliding DFT.
+   * @param[in,out] S             points to an instance of the Q31 sliding DFT structure.
+   * @param[in]     numBins       number of bins tracked.
+   * @param[in]     windowLength  window length N, in samples.
+   * @param[in]     pBins         points to the numBins bin indexes, below N.
+   * @param[in]     damping       damping factor r in 1.31 format, above 0.
+   * @param[in]     pCoeffs       points to the coefficient buffer of 2*numBins values, filled by the function.
+   * @param[in]     pState        points to the bin buffer of 2*numBins values.
+   * @param[in]     pDelay        points to the delay line of windowLength values.
+   * @param[in]     inputShift    right shift applied to the input samples.
+   * @return        ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_sdft_init_q31(
+  arm_sdft_instance_q31 * S,
+  uint16_t numBins,
+  uint16_t windowLength,
+  const uint16_t * pBins,
+  q31_t damping,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  q31_t * pDelay,
+  uint8_t inputShift);
+
+  /**
+   * @brief Processing function for the Q31 sliding DFT.
+   * @param[in,out] S          points to an instance of the Q31 sliding DFT structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_sdft_q31(
+  arm_sdft_instance_q31 * S,
+  q31_t * pSrc,
+  uint32_t blockSize);
+
+  /**
+   * @brief Per-sample processing function for the Q31 sliding DFT.
+   * @param[in,out] S  points to an instance of the Q31 sliding DFT structure.
+   * @param[in]     x  input sample.
+   */
+  void arm_sdft_sample_q31(
+  arm_sdft_instance_q31 * S,
+  q31_t x);
+
+  /**
+   * @brief Averaging of the frame spectra of the Welch PSD.
+   */
+  typedef enum
+  {
+    ARM_PSD_AVERAGE_NONE = 0,         /**< no average, spectrogram rows only. */
+    ARM_PSD_AVERAGE_LINEAR = 1,       /**< mean of all the frames. */
+    ARM_PSD_AVERAGE_EXPONENTIAL = 2   /**< exponential average with smoothing factor alpha. */
+  } arm_psd_average_type;
+
+  /**
+   * @brief Instance structure for the floating-point Welch PSD.
+   */
+  typedef struct
+  {
+    arm_rfft_fast_instance_f32 rfft;  /**< real FFT of length fftLen. */
+    uint16_t fftLen;                  /**< length of the frames. */
+    uint16_t hopSize;                 /**< samples between the starts of consecutive frames, fftLen - overlap. */
+    uint16_t writeIndex;              /**< position of the next sample in the input ring. */
+    uint16_t pending;                 /**< samples still needed to complete the next frame. */
+    arm_psd_average_type averaging;   /**< averaging of the frame spectra. */
+    float32_t alpha;                  /**< smoothing factor of the exponential average. */
+    float32_t scale;                  /**< inverse of the power of the window. */
+    uint32_t frameCount;              /**< frames averaged since initialization or reset. */
+    const float32_t *pWindow;         /**< points to the window, fftLen values, or NULL for a rectangular window. */
+    float32_t *pInput;                /**< points to the input ring, fftLen values. */
+    float32_t *pScratch;              /**< points to the windowed frame and its spectrum, 2*fftLen values. */
+    float32_t *pPsd;                  /**< points to the averaged PSD, fftLen/2+1 values. */
+  } arm_psd_instance_f32;
+
+  /**
+   * @brief Size in samples of the state buffer of a Welch PSD.
+   */
+#define ARM_PSD_STATE_SIZE_F32(fftLen) (3u * (fftLen))
+
+  /**
+   * @brief Processing function for the floating-point Welch PSD.
+   * @param[in,out] S          points to an instance of the floating-point Welch PSD structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[in]     blockSize  number of samples to process.
+   * @param[out]    pFrame     points to the spectrogram rows, fftLen/2+1 values for each frame completed, or NULL.
+   * @return        number of frames completed.
+   */
+  uint32_t arm_psd_f32(
+  arm_psd_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pFrame);
+
+  /**
+   * @brief  Initialization function for the floating-point Welch PSD.
+   * @param[in,out] S          points to an instance of the floating-point Welch PSD structure.
+   * @param[in]     fftLen     length of the frames, a supported real FFT length.
+   * @param[in]     overlap    number of samples shared by consecutive frames, below fftLen.
+   * @param[in]     pWindow    points to the fftLen window coefficients, or NULL for a rectangular window.
+   * @param[in]     averaging  averaging of the frame spectra.
+   * @param[in]     alpha      smoothing factor of the exponential average, in (0 1].
+   * @param[in]     pState     points to the state buffer of ARM_PSD_STATE_SIZE_F32(fftLen) samples.
+   * @param[in]     pPsd       points to the averaged PSD, fftLen/2+1 values, NULL without average.
+   * @return        ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_psd_init_f32(
+  arm_psd_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t overlap,
+  const float32_t * pWindow,
+  arm_psd_average_type averaging,
+  float32_t alpha,
+  float32_t * pState,
+  float32_t * pPsd);
+
+  /**
+   * @brief  Restarts the floating-point Welch PSD: clears the average and waits for a full frame.
+   * @param[in,out] S  points to an instance of the floating-point Welch PSD structure.
+   */
+  void arm_psd_reset_f32(
+  arm_psd_instance_f32 * S);
+
   /**
    * @brief Instance structure for the floating-point DCT4/IDCT4 function.
    */
@@ -3627,6 +4060,107 @@ void arm_rfft_fast_f32(
   uint32_t blockSize);
 
 
+  /**
+   * @brief Instance structure for the floating-point rational FIR sample rate converter.
+   */
+  typedef struct
+  {
+    uint16_t L;                    /**< upsample factor, number of polyphase components. */
+    uint16_t M;                    /**< downsample factor. */
+    uint16_t phaseLength;          /**< length of each polyphase filter component. */
+    uint32_t pos;                  /**< position of the next output in the next block, in units of 1/L input sample. */
+    float32_t *pCoeffs;            /**< points to the coefficient array. The array is of length L*phaseLength. */
+    float32_t *pState;             /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } arm_fir_resample_instance_f32;
+
+  /**
+   * @brief Instance structure for the floating-point asynchronous FIR sample rate converter.
+   */
+  typedef struct
+  {
+    uint16_t L;                    /**< number of polyphase components. */
+    uint16_t phaseLength;          /**< length of each polyphase filter component. */
+    float32_t ratio;               /**< input samples consumed per output sample, Fs_in/Fs_out. May be updated between blocks. */
+    float32_t pos;                 /**< position of the next output in the next block, in input samples. */
+    float32_t *pCoeffs;            /**< points to the coefficient array. The array is of length L*phaseLength. */
+    float32_t *pState;             /**< points to the state variable array. The array is of length blockSize+phaseLength. */
+  } arm_fir_resample_async_instance_f32;
+
+
+  /**
+   * @brief Processing function for the floating-point rational FIR sample rate converter.
+   * @param[in,out] S          points to an instance of the floating-point rational sample rate converter structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of input samples to process.
+   * @return        number of output samples written to pDst, at most (blockSize*L+M-1)/M.
+   */
+  uint32_t arm_fir_resample_f32(
+  arm_fir_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point rational FIR sample rate converter.
+   * @param[in,out] S          points to an instance of the floating-point rational sample rate converter structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+   * the filter length <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>.
+   */
+  arm_status arm_fir_resample_init_f32(
+  arm_fir_resample_instance_f32 * S,
+  uint16_t L,
+  uint16_t M,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the floating-point asynchronous FIR sample rate converter.
+   * @param[in,out] S          points to an instance of the floating-point asynchronous sample rate converter structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of input samples to process.
+   * @return        number of output samples written to pDst, at most blockSize/ratio+1.
+   */
+  uint32_t arm_fir_resample_async_f32(
+  arm_fir_resample_async_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point asynchronous FIR sample rate converter.
+   * @param[in,out] S          points to an instance of the floating-point asynchronous sample rate converter structure.
+   * @param[in]     L          number of polyphase components.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     ratio      initial conversion ratio Fs_in/Fs_out.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+   * the filter length <code>numTaps</code> is not a multiple of <code>L</code>.
+   */
+  arm_status arm_fir_resample_async_init_f32(
+  arm_fir_resample_async_instance_f32 * S,
+  uint16_t L,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  float32_t ratio,
+  uint32_t blockSize);
+
+
   /**
    * @brief Instance structure for the high precision Q31 Biquad cascade filter.
    */
@@ -3782,6 +4316,93 @@ void arm_rfft_fast_f32(
   float64_t * pState);
 
 
+  /**
+   * @brief Instance structure for the floating-point multichannel transposed direct form II Biquad cascade filter.
+   */
+  typedef struct
+  {
+    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    uint8_t numChannels;       /**< number of interleaved channels in a frame. */
+    float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages*numChannels. */
+    float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages. */
+  } arm_biquad_cascade_mc_df2T_instance_f32;
+
+
+  /**
+   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter. N interleaved channels
+   * @param[in]  S          points to an instance of the filter data structure.
+   * @param[in]  pSrc       points to the block of interleaved input frames.
+   * @param[out] pDst       points to the block of interleaved output frames.
+   * @param[in]  blockSize  number of frames to process.
+   */
+  void arm_biquad_cascade_mc_df2T_f32(
+  const arm_biquad_cascade_mc_df2T_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point multichannel transposed direct form II Biquad cascade filter.
+   * @param[in,out] S            points to an instance of the filter data structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChannels  number of interleaved channels in a frame.
+   * @param[in]     pCoeffs      points to the filter coefficients.
+   * @param[in]     pState       points to the state buffer.
+   */
+  void arm_biquad_cascade_mc_df2T_init_f32(
+  arm_biquad_cascade_mc_df2T_instance_f32 * S,
+  uint8_t numStages,
+  uint8_t numChannels,
+  float32_t * pCoeffs,
+  float32_t * pState);
+
+
+  /**
+   * @brief Instance structure for the Q31 multichannel Biquad cascade filter.
+   */
+  typedef struct
+  {
+    uint32_t numStages;      /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    uint32_t numChannels;    /**< number of interleaved channels in a frame. */
+    q31_t *pState;           /**< Points to the array of state coefficients.  The array is of length 4*numStages*numChannels. */
+    q31_t *pCoeffs;          /**< Points to the array of coefficients.  The array is of length 5*numStages. */
+    uint8_t postShift;       /**< Additional shift, in bits, applied to each output sample. */
+  } arm_biquad_casd_mc_df1_inst_q31;
+
+
+  /**
+   * @brief Processing function for the Q31 Biquad cascade filter. N interleaved channels
+   * @param[in]  S          points to an instance of the Q31 multichannel Biquad cascade structure.
+   * @param[in]  pSrc       points to the block of interleaved input frames.
+   * @param[out] pDst       points to the block of interleaved output frames.
+   * @param[in]  blockSize  number of frames to process.
+   */
+  void arm_biquad_cascade_mc_df1_q31(
+  const arm_biquad_casd_mc_df1_inst_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q31 multichannel Biquad cascade filter.
+   * @param[in,out] S            points to an instance of the Q31 multichannel Biquad cascade structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChannels  number of interleaved channels in a frame.
+   * @param[in]     pCoeffs      points to the filter coefficients.
+   * @param[in]     pState       points to the state buffer.
+   * @param[in]     postShift    Shift to be applied to the output. Varies according to the coefficients format
+   */
+  void arm_biquad_cascade_mc_df1_init_q31(
+  arm_biquad_casd_mc_df1_inst_q31 * S,
+  uint8_t numStages,
+  uint8_t numChannels,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  int8_t postShift);
+
+
   /**
    * @brief Instance structure for the Q15 FIR lattice filter.
    */
@@ -5009,18 +5630,210 @@ void arm_rfft_fast_f32(
   arm_matrix_instance_f64 * dst);
 
 
+  /**
+   * @brief Floating-point Cholesky decomposition of a symmetric positive-definite matrix.
+   * @param[in]  src   points to the instance of the input matrix structure, only its lower triangle is read.
+   * @param[out] dst   points to the instance of the output lower-triangular factor L, which can be src.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix is not positive definite, then the function returns ARM_MATH_DECOMPOSITION_FAILURE.
+   */
+  arm_status arm_mat_cholesky_f32(
+  const arm_matrix_instance_f32 * src,
+  arm_matrix_instance_f32 * dst);
+
 
   /**
-   * @ingroup groupController
+   * @brief Floating-point LDL^T decomposition of a symmetric matrix.
+   * @param[in]  src   points to the instance of the input matrix structure, only its lower triangle is read.
+   * @param[out] dst   points to the instance of the output factors, which can be src: unit lower-triangular L
+   *                   below the diagonal and D on the diagonal.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a pivot of D is zero, then the function returns ARM_MATH_DECOMPOSITION_FAILURE.
    */
+  arm_status arm_mat_ldlt_f32(
+  const arm_matrix_instance_f32 * src,
+  arm_matrix_instance_f32 * dst);
+
 
   /**
-   * @defgroup clarke Vector Clarke Transform
-   * Forward Clarke transform converts the instantaneous stator phases into a two-coordinate time invariant vector.
-   * Generally the Clarke transform uses three-phase currents <code>Ia, Ib and Ic</code> to calculate currents
-   * in the two-phase orthogonal stator axis <code>Ialpha</code> and <code>Ibeta</code>.
-   * When <code>Ialpha</code> is superposed with <code>Ia</code> as shown in the figure below
-   * \image html clarke.gif Stator current space vector and its components in (a,b).
+   * @brief Floating-point solve of a lower-triangular system T * X = B by forward substitution.
+   * @param[in]  pT    points to the instance of the lower-triangular matrix structure.
+   * @param[in]  src   points to the instance of the right-hand side matrix structure B.
+   * @param[out] dst   points to the instance of the solution matrix structure X, which can be src.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a diagonal element of T is zero, then the function returns ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_solve_lower_triangular_f32(
+  const arm_matrix_instance_f32 * pT,
+  const arm_matrix_instance_f32 * src,
+  arm_matrix_instance_f32 * dst);
+
+
+  /**
+   * @brief Floating-point solve of an upper-triangular system T * X = B by back substitution.
+   * @param[in]  pT    points to the instance of the upper-triangular matrix structure.
+   * @param[in]  src   points to the instance of the right-hand side matrix structure B.
+   * @param[out] dst   points to the instance of the solution matrix structure X, which can be src.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a diagonal element of T is zero, then the function returns ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_solve_upper_triangular_f32(
+  const arm_matrix_instance_f32 * pT,
+  const arm_matrix_instance_f32 * src,
+  arm_matrix_instance_f32 * dst);
+
+
+  /**
+   * @brief Floating-point solve of A * X = B from the Cholesky factor of A.
+   * @param[in]  pL    points to the instance of the Cholesky factor L of A.
+   * @param[in]  src   points to the instance of the right-hand side matrix structure B.
+   * @param[out] dst   points to the instance of the solution matrix structure X, which can be src.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a diagonal element of L is zero, then the function returns ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_cholesky_solve_f32(
+  const arm_matrix_instance_f32 * pL,
+  const arm_matrix_instance_f32 * src,
+  arm_matrix_instance_f32 * dst);
+
+
+  /**
+   * @brief Floating-point solve of A * X = B from the LDL^T factors of A.
+   * @param[in]  pL    points to the instance of the factors of A, from arm_mat_ldlt_f32().
+   * @param[in]  src   points to the instance of the right-hand side matrix structure B.
+   * @param[out] dst   points to the instance of the solution matrix structure X, which can be src.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If an element of D is zero, then the function returns ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_ldlt_solve_f32(
+  const arm_matrix_instance_f32 * pL,
+  const arm_matrix_instance_f32 * src,
+  arm_matrix_instance_f32 * dst);
+
+
+  /**
+   * @brief Floating-point in-place symmetric rank-k update C = beta * C + alpha * A * A^T.
+   * @param[in]     src    points to the instance of the n x k matrix structure A.
+   * @param[in]     alpha  scale of the product A * A^T.
+   * @param[in]     beta   scale of C.
+   * @param[in,out] dst    points to the instance of the n x n symmetric matrix structure C.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   */
+  arm_status arm_mat_syrk_f32(
+  const arm_matrix_instance_f32 * src,
+  float32_t alpha,
+  float32_t beta,
+  arm_matrix_instance_f32 * dst);
+
+
+  /**
+   * @brief Double-precision floating-point Cholesky decomposition of a symmetric positive-definite matrix.
+   * @param[in]  src   points to the instance of the input matrix structure, only its lower triangle is read.
+   * @param[out] dst   points to the instance of the output lower-triangular factor L, which can be src.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix is not positive definite, then the function returns ARM_MATH_DECOMPOSITION_FAILURE.
+   */
+  arm_status arm_mat_cholesky_f64(
+  const arm_matrix_instance_f64 * src,
+  arm_matrix_instance_f64 * dst);
+
+
+  /**
+   * @brief Double-precision floating-point LDL^T decomposition of a symmetric matrix.
+   * @param[in]  src   points to the instance of the input matrix structure, only its lower triangle is read.
+   * @param[out] dst   points to the instance of the output factors, which can be src: unit lower-triangular L
+   *                   below the diagonal and D on the diagonal.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a pivot of D is zero, then the function returns ARM_MATH_DECOMPOSITION_FAILURE.
+   */
+  arm_status arm_mat_ldlt_f64(
+  const arm_matrix_instance_f64 * src,
+  arm_matrix_instance_f64 * dst);
+
+
+  /**
+   * @brief Double-precision floating-point solve of a lower-triangular system T * X = B by forward substitution.
+   * @param[in]  pT    points to the instance of the lower-triangular matrix structure.
+   * @param[in]  src   points to the instance of the right-hand side matrix structure B.
+   * @param[out] dst   points to the instance of the solution matrix structure X, which can be src.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a diagonal element of T is zero, then the function returns ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_solve_lower_triangular_f64(
+  const arm_matrix_instance_f64 * pT,
+  const arm_matrix_instance_f64 * src,
+  arm_matrix_instance_f64 * dst);
+
+
+  /**
+   * @brief Double-precision floating-point solve of an upper-triangular system T * X = B by back substitution.
+   * @param[in]  pT    points to the instance of the upper-triangular matrix structure.
+   * @param[in]  src   points to the instance of the right-hand side matrix structure B.
+   * @param[out] dst   points to the instance of the solution matrix structure X, which can be src.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a diagonal element of T is zero, then the function returns ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_solve_upper_triangular_f64(
+  const arm_matrix_instance_f64 * pT,
+  const arm_matrix_instance_f64 * src,
+  arm_matrix_instance_f64 * dst);
+
+
+  /**
+   * @brief Double-precision floating-point solve of A * X = B from the Cholesky factor of A.
+   * @param[in]  pL    points to the instance of the Cholesky factor L of A.
+   * @param[in]  src   points to the instance of the right-hand side matrix structure B.
+   * @param[out] dst   points to the instance of the solution matrix structure X, which can be src.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a diagonal element of L is zero, then the function returns ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_cholesky_solve_f64(
+  const arm_matrix_instance_f64 * pL,
+  const arm_matrix_instance_f64 * src,
+  arm_matrix_instance_f64 * dst);
+
+
+  /**
+   * @brief Double-precision floating-point solve of A * X = B from the LDL^T factors of A.
+   * @param[in]  pL    points to the instance of the factors of A, from arm_mat_ldlt_f64().
+   * @param[in]  src   points to the instance of the right-hand side matrix structure B.
+   * @param[out] dst   points to the instance of the solution matrix structure X, which can be src.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If an element of D is zero, then the function returns ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_ldlt_solve_f64(
+  const arm_matrix_instance_f64 * pL,
+  const arm_matrix_instance_f64 * src,
+  arm_matrix_instance_f64 * dst);
+
+
+  /**
+   * @brief Double-precision floating-point in-place symmetric rank-k update C = beta * C + alpha * A * A^T.
+   * @param[in]     src    points to the instance of the n x k matrix structure A.
+   * @param[in]     alpha  scale of the product A * A^T.
+   * @param[in]     beta   scale of C.
+   * @param[in,out] dst    points to the instance of the n x n symmetric matrix structure C.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   */
+  arm_status arm_mat_syrk_f64(
+  const arm_matrix_instance_f64 * src,
+  float64_t alpha,
+  float64_t beta,
+  arm_matrix_instance_f64 * dst);
+
+
+
+  /**
+   * @ingroup groupController
+   */
+
+  /**
+   * @defgroup clarke Vector Clarke Transform
+   * Forward Clarke transform converts the instantaneous stator phases into a two-coordinate time invariant vector.
+   * Generally the Clarke transform uses three-phase currents <code>Ia, Ib and Ic</code> to calculate currents
+   * in the two-phase orthogonal stator axis <code>Ialpha</code> and <code>Ibeta</code>.
+   * When <code>Ialpha</code> is superposed with <code>Ia</code> as shown in the figure below
+   * \image html clarke.gif Stator current space vector and its components in (a,b).
    * and <code>Ia + Ib + Ic = 0</code>, in this condition <code>Ialpha</code> and <code>Ibeta</code>
    * can be calculated using only <code>Ia</code> and <code>Ib</code>.
    *
@@ -5768,6 +6581,248 @@ void arm_rfft_fast_f32(
   q15_t arm_cos_q15(
   q15_t x);
 
+  /**
+   * @brief  Fast approximation to the natural exponential function for floating-point data.
+   * @param[in] x  input value.
+   * @return  exp(x).
+   */
+  float32_t arm_exp_f32(
+  float32_t x);
+
+
+  /**
+   * @brief  Natural exponential function of the elements of a floating-point vector.
+   * @param[in]  pSrc       points to the input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
+   */
+  void arm_vexp_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Fast approximation to the natural logarithm for floating-point data.
+   * @param[in] x  input value.
+   * @return  ln(x).
+   */
+  float32_t arm_log_f32(
+  float32_t x);
+
+
+  /**
+   * @brief  Natural logarithm of the elements of a floating-point vector.
+   * @param[in]  pSrc       points to the input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
+   */
+  void arm_vlog_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Fast approximation to the natural logarithm for Q31 data.
+   * @param[in] x  input value in the range (0 +1).
+   * @return  ln(x) in 5.26 format.
+   */
+  q31_t arm_log_q31(
+  q31_t x);
+
+
+  /**
+   * @brief  Natural logarithm of the elements of a Q31 vector.
+   * @param[in]  pSrc       points to the input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
+   */
+  void arm_vlog_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Fast approximation to the natural logarithm for Q15 data.
+   * @param[in] x  input value in the range (0 +1).
+   * @return  ln(x) in 4.11 format.
+   */
+  q15_t arm_log_q15(
+  q15_t x);
+
+
+  /**
+   * @brief  Natural logarithm of the elements of a Q15 vector.
+   * @param[in]  pSrc       points to the input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
+   */
+  void arm_vlog_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Fast approximation to the arc tangent of y / x for floating-point data.
+   * @param[in] y  y coordinate.
+   * @param[in] x  x coordinate.
+   * @return  atan2(y, x) in radians, in the range [-pi pi].
+   */
+  float32_t arm_atan2_f32(
+  float32_t y,
+  float32_t x);
+
+
+  /**
+   * @brief  Arc tangent of the elements of two floating-point vectors.
+   * @param[in]  pSrcY      points to the vector of y coordinates
+   * @param[in]  pSrcX      points to the vector of x coordinates
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
+   */
+  void arm_vatan2_f32(
+  float32_t * pSrcY,
+  float32_t * pSrcX,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Fast approximation to the arc tangent of y / x for Q31 data.
+   * @param[in] y  y coordinate.
+   * @param[in] x  x coordinate.
+   * @return  atan2(y, x) in 2.29 format, in the range [-pi pi].
+   */
+  q31_t arm_atan2_q31(
+  q31_t y,
+  q31_t x);
+
+
+  /**
+   * @brief  Arc tangent of the elements of two Q31 vectors.
+   * @param[in]  pSrcY      points to the vector of y coordinates
+   * @param[in]  pSrcX      points to the vector of x coordinates
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
+   */
+  void arm_vatan2_q31(
+  q31_t * pSrcY,
+  q31_t * pSrcX,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Fast approximation to the arc tangent of y / x for Q15 data.
+   * @param[in] y  y coordinate.
+   * @param[in] x  x coordinate.
+   * @return  atan2(y, x) in 2.13 format, in the range [-pi pi].
+   */
+  q15_t arm_atan2_q15(
+  q15_t y,
+  q15_t x);
+
+
+  /**
+   * @brief  Arc tangent of the elements of two Q15 vectors.
+   * @param[in]  pSrcY      points to the vector of y coordinates
+   * @param[in]  pSrcX      points to the vector of x coordinates
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
+   */
+  void arm_vatan2_q15(
+  q15_t * pSrcY,
+  q15_t * pSrcX,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Fast approximation to the hyperbolic tangent for floating-point data.
+   * @param[in] x  input value.
+   * @return  tanh(x).
+   */
+  float32_t arm_tanh_f32(
+  float32_t x);
+
+
+  /**
+   * @brief  Hyperbolic tangent of the elements of a floating-point vector.
+   * @param[in]  pSrc       points to the input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
+   */
+  void arm_vtanh_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Fast approximation to the hyperbolic tangent for Q31 data.
+   * @param[in] x  input value in 5.26 format.
+   * @return  tanh(x) in 1.31 format.
+   */
+  q31_t arm_tanh_q31(
+  q31_t x);
+
+
+  /**
+   * @brief  Hyperbolic tangent of the elements of a Q31 vector.
+   * @param[in]  pSrc       points to the input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
+   */
+  void arm_vtanh_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Fast approximation to the hyperbolic tangent for Q15 data.
+   * @param[in] x  input value in 4.11 format.
+   * @return  tanh(x) in 1.15 format.
+   */
+  q15_t arm_tanh_q15(
+  q15_t x);
+
+
+  /**
+   * @brief  Hyperbolic tangent of the elements of a Q15 vector.
+   * @param[in]  pSrc       points to the input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
+   */
+  void arm_vtanh_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Fast approximation to the inverse square root for floating-point data.
+   * @param[in] x  input value.
+   * @return  1 / sqrt(x).
+   */
+  float32_t arm_inv_sqrt_f32(
+  float32_t x);
+
+
+  /**
+   * @brief  Inverse square root of the elements of a floating-point vector.
+   * @param[in]  pSrc       points to the input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
+   */
+  void arm_vinv_sqrt_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
 
   /**
    * @ingroup groupFastMath
@@ -6606,6 +7661,406 @@ void arm_rfft_fast_f32(
   uint32_t * pIndex);
 
 
+  /**
+   * @brief Instance structure for the floating-point batch statistics.
+   */
+  typedef struct
+  {
+    uint32_t count;                /**< number of samples accumulated. */
+    float32_t sum;                 /**< sum of the samples. */
+    float32_t sumOfSquares;        /**< sum of the squares of the samples. */
+    float32_t min;                 /**< minimum value. */
+    float32_t max;                 /**< maximum value. */
+    uint32_t minIndex;             /**< index of the minimum value in the stream. */
+    uint32_t maxIndex;             /**< index of the maximum value in the stream. */
+  } arm_stats_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 batch statistics.
+   */
+  typedef struct
+  {
+    uint32_t count;                /**< number of samples accumulated. */
+    q63_t sum;                     /**< sum of the samples, in 33.31 format. */
+    q63_t sumOfSquares;            /**< sum of the squares of the samples, in 18.46 format. */
+    q31_t min;                     /**< minimum value. */
+    q31_t max;                     /**< maximum value. */
+    uint32_t minIndex;             /**< index of the minimum value in the stream. */
+    uint32_t maxIndex;             /**< index of the maximum value in the stream. */
+  } arm_stats_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 batch statistics.
+   */
+  typedef struct
+  {
+    uint32_t count;                /**< number of samples accumulated. */
+    q63_t sum;                     /**< sum of the samples, in 49.15 format. */
+    q63_t sumOfSquares;            /**< sum of the squares of the samples, in 34.30 format. */
+    q15_t min;                     /**< minimum value. */
+    q15_t max;                     /**< maximum value. */
+    uint32_t minIndex;             /**< index of the minimum value in the stream. */
+    uint32_t maxIndex;             /**< index of the maximum value in the stream. */
+  } arm_stats_instance_q15;
+
+  /**
+   * @brief Results of the floating-point batch statistics.
+   */
+  typedef struct
+  {
+    float32_t mean;                /**< mean value. */
+    float32_t var;                 /**< variance. */
+    float32_t rms;                 /**< root mean square value. */
+    float32_t min;                 /**< minimum value. */
+    float32_t max;                 /**< maximum value. */
+    uint32_t minIndex;             /**< index of the minimum value. */
+    uint32_t maxIndex;             /**< index of the maximum value. */
+  } arm_stats_result_f32;
+
+  /**
+   * @brief Results of the Q31 batch statistics.
+   */
+  typedef struct
+  {
+    q31_t mean;                    /**< mean value. */
+    q31_t var;                     /**< variance. */
+    q31_t rms;                     /**< root mean square value. */
+    q31_t min;                     /**< minimum value. */
+    q31_t max;                     /**< maximum value. */
+    uint32_t minIndex;             /**< index of the minimum value. */
+    uint32_t maxIndex;             /**< index of the maximum value. */
+  } arm_stats_result_q31;
+
+  /**
+   * @brief Results of the Q15 batch statistics.
+   */
+  typedef struct
+  {
+    q15_t mean;                    /**< mean value. */
+    q15_t var;                     /**< variance. */
+    q15_t rms;                     /**< root mean square value. */
+    q15_t min;                     /**< minimum value. */
+    q15_t max;                     /**< maximum value. */
+    uint32_t minIndex;             /**< index of the minimum value. */
+    uint32_t maxIndex;             /**< index of the maximum value. */
+  } arm_stats_result_q15;
+
+
+  /**
+   * @brief  Mean, variance, root mean square, minimum and maximum of a floating-point vector in a single pass.
+   * @param[in]  pSrc       is input pointer
+   * @param[in]  blockSize  is the number of samples to process
+   * @param[out] pResult    is output value.
+   */
+  void arm_stats_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_f32 * pResult);
+
+
+  /**
+   * @brief  Initialization function for the floating-point batch statistics.
+   * @param[out] S          points to an instance of the floating-point statistics structure.
+   */
+  void arm_stats_init_f32(
+  arm_stats_instance_f32 * S);
+
+
+  /**
+   * @brief  Accumulates a block of a floating-point stream into the batch statistics.
+   * @param[in,out] S          points to an instance of the floating-point statistics structure.
+   * @param[in]     pSrc       is input pointer
+   * @param[in]     blockSize  is the number of samples to process
+   */
+  void arm_stats_update_f32(
+  arm_stats_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Results of the floating-point batch statistics.
+   * @param[in]  S          points to an instance of the floating-point statistics structure.
+   * @param[out] pResult    is output value.
+   */
+  void arm_stats_get_f32(
+  const arm_stats_instance_f32 * S,
+  arm_stats_result_f32 * pResult);
+
+
+  /**
+   * @brief  Mean, variance, root mean square, minimum and maximum of a Q31 vector in a single pass.
+   * @param[in]  pSrc       is input pointer
+   * @param[in]  blockSize  is the number of samples to process
+   * @param[out] pResult    is output value.
+   */
+  void arm_stats_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_q31 * pResult);
+
+
+  /**
+   * @brief  Initialization function for the Q31 batch statistics.
+   * @param[out] S          points to an instance of the Q31 statistics structure.
+   */
+  void arm_stats_init_q31(
+  arm_stats_instance_q31 * S);
+
+
+  /**
+   * @brief  Accumulates a block of a Q31 stream into the batch statistics.
+   * @param[in,out] S          points to an instance of the Q31 statistics structure.
+   * @param[in]     pSrc       is input pointer
+   * @param[in]     blockSize  is the number of samples to process
+   */
+  void arm_stats_update_q31(
+  arm_stats_instance_q31 * S,
+  q31_t * pSrc,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Results of the Q31 batch statistics.
+   * @param[in]  S          points to an instance of the Q31 statistics structure.
+   * @param[out] pResult    is output value.
+   */
+  void arm_stats_get_q31(
+  const arm_stats_instance_q31 * S,
+  arm_stats_result_q31 * pResult);
+
+
+  /**
+   * @brief  Mean, variance, root mean square, minimum and maximum of a Q15 vector in a single pass.
+   * @param[in]  pSrc       is input pointer
+   * @param[in]  blockSize  is the number of samples to process
+   * @param[out] pResult    is output value.
+   */
+  void arm_stats_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_q15 * pResult);
+
+
+  /**
+   * @brief  Initialization function for the Q15 batch statistics.
+   * @param[out] S          points to an instance of the Q15 statistics structure.
+   */
+  void arm_stats_init_q15(
+  arm_stats_instance_q15 * S);
+
+
+  /**
+   * @brief  Accumulates a block of a Q15 stream into the batch statistics.
+   * @param[in,out] S          points to an instance of the Q15 statistics structure.
+   * @param[in]     pSrc       is input pointer
+   * @param[in]     blockSize  is the number of samples to process
+   */
+  void arm_stats_update_q15(
+  arm_stats_instance_q15 * S,
+  q15_t * pSrc,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Results of the Q15 batch statistics.
+   * @param[in]  S          points to an instance of the Q15 statistics structure.
+   * @param[out] pResult    is output value.
+   */
+  void arm_stats_get_q15(
+  const arm_stats_instance_q15 * S,
+  arm_stats_result_q15 * pResult);
+
+  /**
+   * @brief Instance structure for the floating-point sliding-window percentile filter.
+   */
+  typedef struct
+  {
+    uint16_t windowLength;         /**< number of samples in the window. */
+    uint16_t rank;                 /**< order statistic output, from 0 (minimum) to windowLength-1 (maximum). */
+    uint16_t index;                /**< window slot of the oldest sample. */
+    float32_t *pState;             /**< points to the window samples, windowLength values. */
+    uint16_t *pIndex;              /**< points to the heaps and the positions in the heaps, 2*windowLength values. */
+  } arm_percentile_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 sliding-window percentile filter.
+   */
+  typedef struct
+  {
+    uint16_t windowLength;         /**< number of samples in the window. */
+    uint16_t rank;                 /**< order statistic output, from 0 (minimum) to windowLength-1 (maximum). */
+    uint16_t index;                /**< window slot of the oldest sample. */
+    q31_t *pState;                 /**< points to the window samples, windowLength values. */
+    uint16_t *pIndex;              /**< points to the heaps and the positions in the heaps, 2*windowLength values. */
+  } arm_percentile_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 sliding-window percentile filter.
+   */
+  typedef struct
+  {
+    uint16_t windowLength;         /**< number of samples in the window. */
+    uint16_t rank;                 /**< order statistic output, from 0 (minimum) to windowLength-1 (maximum). */
+    uint16_t index;                /**< window slot of the oldest sample. */
+    q15_t *pState;                 /**< points to the window samples, windowLength values. */
+    uint16_t *pIndex;              /**< points to the heaps and the positions in the heaps, 2*windowLength values. */
+  } arm_percentile_instance_q15;
+
+
+  /**
+   * @brief  Initialization function for the floating-point sliding-window percentile filter.
+   * @param[out] S             points to an instance of the floating-point percentile filter structure.
+   * @param[in]  windowLength  number of samples in the window.
+   * @param[in]  rank          order statistic output, from 0 (minimum) to windowLength-1 (maximum).
+   * @param[in]  initValue     value the window is initially filled with.
+   * @param[in]  pState        points to the window buffer of windowLength samples.
+   * @param[in]  pIndex        points to the heap buffer of 2*windowLength indexes.
+   * @return     ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_percentile_filter_init_f32(
+  arm_percentile_instance_f32 * S,
+  uint16_t windowLength,
+  uint16_t rank,
+  float32_t initValue,
+  float32_t * pState,
+  uint16_t * pIndex);
+
+
+  /**
+   * @brief  Processing function for the floating-point sliding-window percentile filter.
+   * @param[in,out] S          points to an instance of the floating-point percentile filter structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[out]    pDst       points to the block of output samples.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_percentile_filter_f32(
+  arm_percentile_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q31 sliding-window percentile filter.
+   * @param[out] S             points to an instance of the Q31 percentile filter structure.
+   * @param[in]  windowLength  number of samples in the window.
+   * @param[in]  rank          order statistic output, from 0 (minimum) to windowLength-1 (maximum).
+   * @param[in]  initValue     value the window is initially filled with.
+   * @param[in]  pState        points to the window buffer of windowLength samples.
+   * @param[in]  pIndex        points to the heap buffer of 2*windowLength indexes.
+   * @return     ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_percentile_filter_init_q31(
+  arm_percentile_instance_q31 * S,
+  uint16_t windowLength,
+  uint16_t rank,
+  q31_t initValue,
+  q31_t * pState,
+  uint16_t * pIndex);
+
+
+  /**
+   * @brief  Processing function for the Q31 sliding-window percentile filter.
+   * @param[in,out] S          points to an instance of the Q31 percentile filter structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[out]    pDst       points to the block of output samples.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_percentile_filter_q31(
+  arm_percentile_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q15 sliding-window percentile filter.
+   * @param[out] S             points to an instance of the Q15 percentile filter structure.
+   * @param[in]  windowLength  number of samples in the window.
+   * @param[in]  rank          order statistic output, from 0 (minimum) to windowLength-1 (maximum).
+   * @param[in]  initValue     value the window is initially filled with.
+   * @param[in]  pState        points to the window buffer of windowLength samples.
+   * @param[in]  pIndex        points to the heap buffer of 2*windowLength indexes.
+   * @return     ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_percentile_filter_init_q15(
+  arm_percentile_instance_q15 * S,
+  uint16_t windowLength,
+  uint16_t rank,
+  q15_t initValue,
+  q15_t * pState,
+  uint16_t * pIndex);
+
+
+  /**
+   * @brief  Processing function for the Q15 sliding-window percentile filter.
+   * @param[in,out] S          points to an instance of the Q15 percentile filter structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[out]    pDst       points to the block of output samples.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_percentile_filter_q15(
+  arm_percentile_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Histogram of a floating-point vector.
+   * @param[in]     pSrc       points to the input vector.
+   * @param[in]     blockSize  length of the input vector.
+   * @param[in]     minValue   lower bound of the first bin.
+   * @param[in]     maxValue   upper bound of the last bin.
+   * @param[in]     numBins    number of bins.
+   * @param[in,out] pHist      points to the numBins counts, incremented.
+   */
+  void arm_histogram_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t minValue,
+  float32_t maxValue,
+  uint16_t numBins,
+  uint32_t * pHist);
+
+
+  /**
+   * @brief  Histogram of a Q31 vector.
+   * @param[in]     pSrc       points to the input vector.
+   * @param[in]     blockSize  length of the input vector.
+   * @param[in]     minValue   lower bound of the first bin.
+   * @param[in]     shift      base-2 logarithm of the bin width.
+   * @param[in]     numBins    number of bins.
+   * @param[in,out] pHist      points to the numBins counts, incremented.
+   */
+  void arm_histogram_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  q31_t minValue,
+  uint8_t shift,
+  uint16_t numBins,
+  uint32_t * pHist);
+
+
+  /**
+   * @brief  Histogram of a Q15 vector.
+   * @param[in]     pSrc       points to the input vector.
+   * @param[in]     blockSize  length of the input vector.
+   * @param[in]     minValue   lower bound of the first bin.
+   * @param[in]     shift      base-2 logarithm of the bin width.
+   * @param[in]     numBins    number of bins.
+   * @param[in,out] pHist      points to the numBins counts, incremented.
+   */
+  void arm_histogram_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t minValue,
+  uint8_t shift,
+  uint16_t numBins,
+  uint32_t * pHist);
+
+
   /**
    * @brief  Q15 complex-by-complex multiplication
    * @param[in]  pSrcA       points to the first input vector
@@ -6647,6 +8102,33 @@ void arm_rfft_fast_f32(
   float32_t * pDst,
   uint32_t numSamples);
 
+  /**
+   * @brief  Floating-point complex-by-complex multiply-accumulate
+   * @param[in]     pSrcA       points to the first input vector
+   * @param[in]     pSrcB       points to the second input vector
+   * @param[in,out] pDst        points to the accumulation vector
+   * @param[in]     numSamples  number of complex samples in each vector
+   */
+  void arm_cmplx_mac_cmplx_f32(
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  float32_t * pDst,
+  uint32_t numSamples);
+
+
+  /**
+   * @brief  Floating-point conjugate complex-by-complex multiply-accumulate
+   * @param[in]     pSrcA       points to the first input vector, conjugated
+   * @param[in]     pSrcB       points to the second input vector
+   * @param[in,out] pDst        points to the accumulation vector
+   * @param[in]     numSamples  number of complex samples in each vector
+   */
+  void arm_cmplx_conj_mac_cmplx_f32(
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  float32_t * pDst,
+  uint32_t numSamples);
+
 
   /**
    * @brief Converts the elements of the floating-point vector to Q31 vector.
@@ -30,114 +30,204 @@
 #include "arm_const_structs.h"
 
 /* Floating-point structs */
+#if defined(ARM_TABLE_FFT_F32_16)
 const arm_cfft_instance_f32 arm_cfft_sR_f32_len16 = {
 	16, twiddleCoef_16, armBitRevIndexTable16, ARMBITREVINDEXTABLE_16_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_FFT_F32_32)
 const arm_cfft_instance_f32 arm_cfft_sR_f32_len32 = {
 	32, twiddleCoef_32, armBitRevIndexTable32, ARMBITREVINDEXTABLE_32_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_FFT_F32_64)
 const arm_cfft_instance_f32 arm_cfft_sR_f32_len64 = {
 	64, twiddleCoef_64, armBitRevIndexTable64, ARMBITREVINDEXTABLE_64_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_FFT_F32_128)
 const arm_cfft_instance_f32 arm_cfft_sR_f32_len128 = {
 	128, twiddleCoef_128, armBitRevIndexTable128, ARMBITREVINDEXTABLE_128_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_FFT_F32_256)
 const arm_cfft_instance_f32 arm_cfft_sR_f32_len256 = {
 	256, twiddleCoef_256, armBitRevIndexTable256, ARMBITREVINDEXTABLE_256_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_FFT_F32_512)
 const arm_cfft_instance_f32 arm_cfft_sR_f32_len512 = {
 	512, twiddleCoef_512, armBitRevIndexTable512, ARMBITREVINDEXTABLE_512_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_FFT_F32_1024)
 const arm_cfft_instance_f32 arm_cfft_sR_f32_len1024 = {
 	1024, twiddleCoef_1024, armBitRevIndexTable1024, ARMBITREVINDEXTABLE_1024_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_FFT_F32_2048)
 const arm_cfft_instance_f32 arm_cfft_sR_f32_len2048 = {
 	2048, twiddleCoef_2048, armBitRevIndexTable2048, ARMBITREVINDEXTABLE_2048_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_FFT_F32_4096)
 const arm_cfft_instance_f32 arm_cfft_sR_f32_len4096 = {
 	4096, twiddleCoef_4096, armBitRevIndexTable4096, ARMBITREVINDEXTABLE_4096_TABLE_LENGTH
 };
+#endif
+
+#if defined(ARM_TABLE_FFT_F32_500)
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len500 = {
+	500, twiddleCoef_500, armBitRevIndexTable500, ARMBITREVINDEXTABLE_500_TABLE_LENGTH
+};
+#endif
+
+#if defined(ARM_TABLE_FFT_F32_600)
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len600 = {
+	600, twiddleCoef_600, armBitRevIndexTable600, ARMBITREVINDEXTABLE_600_TABLE_LENGTH
+};
+#endif
+
+#if defined(ARM_TABLE_FFT_F32_768)
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len768 = {
+	768, twiddleCoef_768, armBitRevIndexTable768, ARMBITREVINDEXTABLE_768_TABLE_LENGTH
+};
+#endif
+
+#if defined(ARM_TABLE_FFT_F32_1000)
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len1000 = {
+	1000, twiddleCoef_1000, armBitRevIndexTable1000, ARMBITREVINDEXTABLE_1000_TABLE_LENGTH
+};
+#endif
+
+#if defined(ARM_TABLE_FFT_F32_1200)
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len1200 = {
+	1200, twiddleCoef_1200, armBitRevIndexTable1200, ARMBITREVINDEXTABLE_1200_TABLE_LENGTH
+};
+#endif
+
+#if defined(ARM_TABLE_FFT_F32_1536)
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len1536 = {
+	1536, twiddleCoef_1536, armBitRevIndexTable1536, ARMBITREVINDEXTABLE_1536_TABLE_LENGTH
+};
+#endif
 
 /* Fixed-point structs */
+#if defined(ARM_TABLE_FFT_Q31_16)
 const arm_cfft_instance_q31 arm_cfft_sR_q31_len16 = {
 	16, twiddleCoef_16_q31, armBitRevIndexTable_fixed_16, ARMBITREVINDEXTABLE_FIXED_16_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_FFT_Q31_32)
 const arm_cfft_instance_q31 arm_cfft_sR_q31_len32 = {
 	32, twiddleCoef_32_q31, armBitRevIndexTable_fixed_32, ARMBITREVINDEXTABLE_FIXED_32_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_FFT_Q31_64)
 const arm_cfft_instance_q31 arm_cfft_sR_q31_len64 = {
 	64, twiddleCoef_64_q31, armBitRevIndexTable_fixed_64, ARMBITREVINDEXTABLE_FIXED_64_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_FFT_Q31_128)
 const arm_cfft_instance_q31 arm_cfft_sR_q31_len128 = {
 	128, twiddleCoef_128_q31, armBitRevIndexTable_fixed_128, ARMBITREVINDEXTABLE_FIXED_128_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_FFT_Q31_256)
 const arm_cfft_instance_q31 arm_cfft_sR_q31_len256 = {
 	256, twiddleCoef_256_q31, armBitRevIndexTable_fixed_256, ARMBITREVINDEXTABLE_FIXED_256_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_FFT_Q31_512)
 const arm_cfft_instance_q31 arm_cfft_sR_q31_len512 = {
 	512, twiddleCoef_512_q31, armBitRevIndexTable_fixed_512, ARMBITREVINDEXTABLE_FIXED_512_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_FFT_Q31_1024)
 const arm_cfft_instance_q31 arm_cfft_sR_q31_len1024 = {
 	1024, twiddleCoef_1024_q31, armBitRevIndexTable_fixed_1024, ARMBITREVINDEXTABLE_FIXED_1024_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_FFT_Q31_2048)
 const arm_cfft_instance_q31 arm_cfft_sR_q31_len2048 = {
 	2048, twiddleCoef_2048_q31, armBitRevIndexTable_fixed_2048, ARMBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_FFT_Q31_4096)
 const arm_cfft_instance_q31 arm_cfft_sR_q31_len4096 = {
 	4096, twiddleCoef_4096_q31, armBitRevIndexTable_fixed_4096, ARMBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_FFT_Q15_16)
 const arm_cfft_instance_q15 arm_cfft_sR_q15_len16 = {
 	16, twiddleCoef_16_q15, armBitRevIndexTable_fixed_16, ARMBITREVINDEXTABLE_FIXED_16_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_FFT_Q15_32)
 const arm_cfft_instance_q15 arm_cfft_sR_q15_len32 = {
 	32, twiddleCoef_32_q15, armBitRevIndexTable_fixed_32, ARMBITREVINDEXTABLE_FIXED_32_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_FFT_Q15_64)
 const arm_cfft_instance_q15 arm_cfft_sR_q15_len64 = {
 	64, twiddleCoef_64_q15, armBitRevIndexTable_fixed_64, ARMBITREVINDEXTABLE_FIXED_64_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_FFT_Q15_128)
 const arm_cfft_instance_q15 arm_cfft_sR_q15_len128 = {
 	128, twiddleCoef_128_q15, armBitRevIndexTable_fixed_128, ARMBITREVINDEXTABLE_FIXED_128_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_FFT_Q15_256)
 const arm_cfft_instance_q15 arm_cfft_sR_q15_len256 = {
 	256, twiddleCoef_256_q15, armBitRevIndexTable_fixed_256, ARMBITREVINDEXTABLE_FIXED_256_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_FFT_Q15_512)
 const arm_cfft_instance_q15 arm_cfft_sR_q15_len512 = {
 	512, twiddleCoef_512_q15, armBitRevIndexTable_fixed_512, ARMBITREVINDEXTABLE_FIXED_512_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_FFT_Q15_1024)
 const arm_cfft_instance_q15 arm_cfft_sR_q15_len1024 = {
 	1024, twiddleCoef_1024_q15, armBitRevIndexTable_fixed_1024, ARMBITREVINDEXTABLE_FIXED_1024_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_FFT_Q15_2048)
 const arm_cfft_instance_q15 arm_cfft_sR_q15_len2048 = {
 	2048, twiddleCoef_2048_q15, armBitRevIndexTable_fixed_2048, ARMBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH
 };
+#endif
 
+#if defined(ARM_TABLE_FFT_Q15_4096)
 const arm_cfft_instance_q15 arm_cfft_sR_q15_len4096 = {
 	4096, twiddleCoef_4096_q15, armBitRevIndexTable_fixed_4096, ARMBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH
 };
+#endif
 
 /* Structure for real-value inputs */
 /* Floating-point structs */
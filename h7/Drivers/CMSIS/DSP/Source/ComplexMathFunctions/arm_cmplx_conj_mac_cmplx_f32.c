@@ -0,0 +1,139 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cmplx_conj_mac_cmplx_f32.c
+ * Description:  Floating-point conjugate complex-by-complex multiply-accumulate
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupCmplxMath
+ */
+
+/**
+ * @addtogroup CmplxByCmplxMac
+ * @{
+ */
+
+
+/**
+ * @brief  Floating-point conjugate complex-by-complex multiply-accumulate
+ * @param[in]  *pSrcA points to the first input vector, conjugated
+ * @param[in]  *pSrcB points to the second input vector
+ * @param[in,out]  *pDst  points to the accumulation vector
+ * @param[in]  numSamples number of complex samples in each vector
+ * @return none.
+ */
+
+void arm_cmplx_conj_mac_cmplx_f32(
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  float32_t * pDst,
+  uint32_t numSamples)
+{
+  float32_t a1, b1, c1, d1;                      /* Temporary variables to store real and imaginary values */
+  uint32_t blkCnt;                               /* loop counters */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t a2, b2, c2, d2;                      /* Temporary variables to store real and imaginary values */
+  float32_t acc1, acc2, acc3, acc4;              /* Accumulators */
+
+  /* loop Unrolling */
+  blkCnt = numSamples >> 1u;
+
+  /* First part of the processing with loop unrolling.  Compute 2 outputs at a time.
+   ** a second loop below computes the remaining sample. */
+  while(blkCnt > 0u)
+  {
+    a1 = pSrcA[0];
+    b1 = pSrcA[1];
+    a2 = pSrcA[2];
+    b2 = pSrcA[3];
+    c1 = pSrcB[0];
+    d1 = pSrcB[1];
+    c2 = pSrcB[2];
+    d2 = pSrcB[3];
+
+    acc1 = pDst[0];
+    acc2 = pDst[1];
+    acc3 = pDst[2];
+    acc4 = pDst[3];
+
+    /* C[2 * i] += A[2 * i] * B[2 * i] + A[2 * i + 1] * B[2 * i + 1].  */
+    /* C[2 * i + 1] += A[2 * i] * B[2 * i + 1] - A[2 * i + 1] * B[2 * i].  */
+    acc1 += a1 * c1;
+    acc2 += a1 * d1;
+    acc3 += a2 * c2;
+    acc4 += a2 * d2;
+    acc1 += b1 * d1;
+    acc2 -= b1 * c1;
+    acc3 += b2 * d2;
+    acc4 -= b2 * c2;
+
+    pDst[0] = acc1;
+    pDst[1] = acc2;
+    pDst[2] = acc3;
+    pDst[3] = acc4;
+
+    pSrcA += 4u;
+    pSrcB += 4u;
+    pDst += 4u;
+
+    /* Decrement the numSamples loop counter */
+    blkCnt--;
+  }
+
+  /* If the numSamples is odd, compute the remaining output sample here.
+   ** No loop unrolling is used. */
+  blkCnt = numSamples & 0x1u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+  blkCnt = numSamples;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    a1 = *pSrcA++;
+    b1 = *pSrcA++;
+    c1 = *pSrcB++;
+    d1 = *pSrcB++;
+
+    /* accumulate the result in the destination buffer. */
+    *pDst++ += (a1 * c1) + (b1 * d1);
+    *pDst++ += (a1 * d1) - (b1 * c1);
+
+    /* Decrement the numSamples loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of CmplxByCmplxMac group
+ */
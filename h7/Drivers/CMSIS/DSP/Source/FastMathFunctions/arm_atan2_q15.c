@@ -0,0 +1,173 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_atan2_q15.c
+ * Description:  Fast arc tangent of two arguments for Q15 values
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup atan2
+ * @{
+ */
+
+/* pi and pi/2 in 2.13 format */
+#define ATAN2_Q15_PI         0x6488
+#define ATAN2_Q15_PI_2       0x3244
+
+/**
+ * @brief  Fast approximation to the arc tangent of y / x for Q15 data.
+ * @param[in] y y coordinate.
+ * @param[in] x x coordinate.
+ * @return  atan2(y, x) in 2.13 format, in the range [-pi pi].
+ */
+
+q15_t arm_atan2_q15(
+  q15_t y,
+  q15_t x)
+{
+  q31_t ax, ay, mn, mx, t, d, a;                 /* Absolute values, ratio, offset, angle */
+  const q31_t *pCoef;                            /* Coefficients of the segment */
+  uint32_t i;                                    /* Table index */
+
+  ax = (x < 0) ? -(q31_t) x : (q31_t) x;
+  ay = (y < 0) ? -(q31_t) y : (q31_t) y;
+
+  mx = (ay > ax) ? ay : ax;
+  mn = (ay > ax) ? ax : ay;
+
+  if(mx == 0)
+  {
+    /* atan2(0, 0) */
+    return (0);
+  }
+
+  /* t = mn / mx in 1.15 format */
+  t = (mn << 15) / mx;
+
+  /* Nearest table point and offset */
+  i = ((uint32_t) t + 0x200u) >> 10;
+  d = t - (q31_t) (i << 10);
+  pCoef = &atanTable_q31[5u * i];
+
+  /* Second order polynomial with the 1.15 coefficients */
+  a = (pCoef[2] >> 16);
+  a = (pCoef[1] >> 16) + ((a * d) >> 15);
+  a = (pCoef[0] >> 16) + ((a * d) >> 15);
+
+  /* atan(t) in 2.13 format */
+  a = (a + 2) >> 2;
+
+  /* Restore the octant */
+  if(ay > ax)
+  {
+    a = ATAN2_Q15_PI_2 - a;
+  }
+
+  if(x < 0)
+  {
+    a = ATAN2_Q15_PI - a;
+  }
+
+  if(y < 0)
+  {
+    a = -a;
+  }
+
+  return ((q15_t) a);
+}
+
+/**
+ * @brief  Arc tangent of the elements of two Q15 vectors.
+ * @param[in]  *pSrcY points to the vector of y coordinates
+ * @param[in]  *pSrcX points to the vector of x coordinates
+ * @param[out] *pDst points to the output vector
+ * @param[in]  blockSize number of samples in each vector
+ * @return none.
+ */
+
+void arm_vatan2_q15(
+  q15_t * pSrcY,
+  q15_t * pSrcX,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* The four evaluations are independent and can be interleaved */
+    pDst[0] = arm_atan2_q15(pSrcY[0], pSrcX[0]);
+    pDst[1] = arm_atan2_q15(pSrcY[1], pSrcX[1]);
+    pDst[2] = arm_atan2_q15(pSrcY[2], pSrcX[2]);
+    pDst[3] = arm_atan2_q15(pSrcY[3], pSrcX[3]);
+
+    pSrcY += 4u;
+    pSrcX += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_atan2_q15(*pSrcY++, *pSrcX++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of atan2 group
+ */
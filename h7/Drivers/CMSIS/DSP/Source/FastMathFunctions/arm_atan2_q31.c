@@ -0,0 +1,190 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_atan2_q31.c
+ * Description:  Fast arc tangent of two arguments for Q31 values
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup atan2
+ * @{
+ */
+
+/* pi and pi/2 in 2.29 format */
+#define ATAN2_Q31_PI         0x6487ED51
+#define ATAN2_Q31_PI_2       0x3243F6A9
+
+/**
+ * @brief  Fast approximation to the arc tangent of y / x for Q31 data.
+ * @param[in] y y coordinate.
+ * @param[in] x x coordinate.
+ * @return  atan2(y, x) in 2.29 format, in the range [-pi pi].
+ */
+
+q31_t arm_atan2_q31(
+  q31_t y,
+  q31_t x)
+{
+  uint32_t ax, ay, mn, mx, s, i;                 /* Absolute values, shift, table index */
+  q31_t t, d, a, recip;                          /* Ratio, offset, angle, 1 / max */
+  const q31_t *pCoef;                            /* Coefficients of the segment */
+
+  /* Absolute values on 32 bits */
+  ax = (x < 0) ? (0u - (uint32_t) x) : (uint32_t) x;
+  ay = (y < 0) ? (0u - (uint32_t) y) : (uint32_t) y;
+
+  mx = (ay > ax) ? ay : ax;
+  mn = (ay > ax) ? ax : ay;
+
+  if(mx == 0u)
+  {
+    /* atan2(0, 0) */
+    return (0);
+  }
+
+  if(mn == mx)
+  {
+    t = 0x7FFFFFFF;
+  }
+  else
+  {
+    /* Both values normalized, mx in [0.5 1) */
+    s = __CLZ(mx);
+    mx = (mx << s) >> 1;
+    mn = (mn << s) >> 1;
+
+    /* 1 / mx in 2.30 format, with a third Newton-Raphson iteration */
+    (void) arm_recip_q31((q31_t) mx, &recip, (q31_t *) armRecipTableQ31);
+    recip = (q31_t) (((q63_t) recip * (0x7FFFFFFF - (q31_t) (((q63_t) mx * recip) >> 31))) >> 30);
+
+    /* t = mn / mx in 1.31 format */
+    t = clip_q63_to_q31(((q63_t) mn * recip) >> 30);
+  }
+
+  /* Nearest table point and offset */
+  i = ((uint32_t) t + 0x02000000u) >> 26;
+  d = t - (q31_t) (i << 26);
+  pCoef = &atanTable_q31[5u * i];
+
+  a = pCoef[3] + (q31_t) (((q63_t) pCoef[4] * d) >> 31);
+  a = pCoef[2] + (q31_t) (((q63_t) a * d) >> 31);
+  a = pCoef[1] + (q31_t) (((q63_t) a * d) >> 31);
+  a = pCoef[0] + (q31_t) (((q63_t) a * d) >> 31);
+
+  /* atan(t) in 2.29 format */
+  a = (a + 2) >> 2;
+
+  /* Restore the octant */
+  if(ay > ax)
+  {
+    a = ATAN2_Q31_PI_2 - a;
+  }
+
+  if(x < 0)
+  {
+    a = ATAN2_Q31_PI - a;
+  }
+
+  if(y < 0)
+  {
+    a = -a;
+  }
+
+  return (a);
+}
+
+/**
+ * @brief  Arc tangent of the elements of two Q31 vectors.
+ * @param[in]  *pSrcY points to the vector of y coordinates
+ * @param[in]  *pSrcX points to the vector of x coordinates
+ * @param[out] *pDst points to the output vector
+ * @param[in]  blockSize number of samples in each vector
+ * @return none.
+ */
+
+void arm_vatan2_q31(
+  q31_t * pSrcY,
+  q31_t * pSrcX,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* The four evaluations are independent and can be interleaved */
+    pDst[0] = arm_atan2_q31(pSrcY[0], pSrcX[0]);
+    pDst[1] = arm_atan2_q31(pSrcY[1], pSrcX[1]);
+    pDst[2] = arm_atan2_q31(pSrcY[2], pSrcX[2]);
+    pDst[3] = arm_atan2_q31(pSrcY[3], pSrcX[3]);
+
+    pSrcY += 4u;
+    pSrcX += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_atan2_q31(*pSrcY++, *pSrcX++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of atan2 group
+ */
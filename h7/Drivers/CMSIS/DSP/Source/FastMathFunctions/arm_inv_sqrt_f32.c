@@ -0,0 +1,175 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_inv_sqrt_f32.c
+ * Description:  Fast inverse square root calculation for floating-point values
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup invSqrt Inverse Square Root
+ *
+ * Computes <code>1 / sqrt(x)</code> for floating-point values without square
+ * root nor division instruction, as a faster alternative to
+ * <code>1.0f / sqrtf(x)</code>, for vector normalization in particular.
+ *
+ * The first approximation is read from the bit pattern of the input,
+ * whose exponent is halved and negated by an integer subtraction, and
+ * refined by three Newton-Raphson iterations:
+ * <pre>
+ *      y1 = y0 * (1.5 - 0.5 * x * y0 * y0)
+ * </pre>
+ *
+ * The relative error is below 1.8e-7 for positive inputs, denormal
+ * ones included. <code>1 / sqrt(0)</code> returns +infinity, negative inputs
+ * return NaN.
+ *
+ * <code>arm_vinv_sqrt_f32()</code> processes a whole buffer.
+ */
+
+/**
+ * @addtogroup invSqrt
+ * @{
+ */
+
+/**
+ * @brief  Fast approximation to the inverse square root for floating-point data.
+ * @param[in] x input value.
+ * @return  1 / sqrt(x).
+ */
+
+float32_t arm_inv_sqrt_f32(
+  float32_t x)
+{
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } y;                                           /* Estimate and its bit pattern */
+  float32_t half, scale;                         /* x / 2, denormal correction */
+
+  y.f = x;
+
+  if(y.i <= 0)
+  {
+    /* Zero gives +infinity, negative values NaN */
+    y.i = ((y.i & 0x7FFFFFFF) == 0) ? 0x7F800000 : 0x7FC00000;
+    return (y.f);
+  }
+
+  if(y.i >= 0x7F800000)
+  {
+    /* +infinity gives 0, NaN is returned as it is */
+    return ((y.i == 0x7F800000) ? 0.0f : x);
+  }
+
+  scale = 1.0f;
+  if(y.i < 0x00800000)
+  {
+    /* Denormal input: scale by 2^24, the result by 2^12 */
+    x *= 16777216.0f;
+    y.f = x;
+    scale = 4096.0f;
+  }
+
+  half = 0.5f * x;
+
+  /* First approximation and three Newton-Raphson iterations */
+  y.i = 0x5F375A86 - (y.i >> 1);
+  y.f = y.f * (1.5f - (half * y.f * y.f));
+  y.f = y.f * (1.5f - (half * y.f * y.f));
+  y.f = y.f * (1.5f - (half * y.f * y.f));
+
+  return (y.f * scale);
+}
+
+/**
+ * @brief  Inverse square root of the elements of a floating-point vector.
+ * @param[in]  *pSrc points to the input vector
+ * @param[out] *pDst points to the output vector
+ * @param[in]  blockSize number of samples in each vector
+ * @return none.
+ */
+
+void arm_vinv_sqrt_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* The four evaluations are independent and can be interleaved */
+    pDst[0] = arm_inv_sqrt_f32(pSrc[0]);
+    pDst[1] = arm_inv_sqrt_f32(pSrc[1]);
+    pDst[2] = arm_inv_sqrt_f32(pSrc[2]);
+    pDst[3] = arm_inv_sqrt_f32(pSrc[3]);
+
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_inv_sqrt_f32(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of invSqrt group
+ */
@@ -0,0 +1,204 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_log_f32.c
+ * Description:  Fast natural logarithm calculation for floating-point values
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @defgroup log Natural Logarithm
+ *
+ * Computes the natural logarithm using a table of 32 values and a
+ * polynomial, as a faster alternative to the <code>logf()</code> function of
+ * the C library. There are separate functions for Q15, Q31, and
+ * floating-point data types.
+ *
+ * The input is split into a power of two <code>2<sup>e</sup></code> and a
+ * mantissa <code>m</code>. The steps used are:
+ *  -# Calculation of the nearest table point <code>c</code> of the mantissa,
+ *     the table being spaced by 1/32 for the floating-point version (mantissa in
+ *     [1 2)) and by 1/64 for the fixed-point versions (mantissa in [0.5 1))
+ *  -# Calculation of <code>r = (m - c) / c</code> with the table of
+ *     <code>1 / c</code>, with <code>|r| <= 1/64</code>
+ *  -# The final result equals <code>e * ln(2) + ln(c) + p(r)</code>, where
+ *     the table gives <code>ln(c)</code> and <code>p(r)</code> is the fourth
+ *     order Taylor polynomial of <code>ln(1 + r)</code>.
+ *
+ * Error bounds:
+ * - floating-point: error below 1.3e-7, absolute for inputs in [0.5 2] and
+ *   relative outside; <code>log(0)</code> returns -infinity and negative
+ *   inputs return NaN.
+ * - Q31: input in (0 +1), output in 5.26 format, error below 1 LSB.
+ * - Q15: input in (0 +1), output in 4.11 format, error below 1 LSB.
+ * Zero and negative inputs of the fixed-point versions saturate to the most
+ * negative output value.
+ *
+ * <code>arm_vlog_f32()</code>, <code>arm_vlog_q31()</code> and
+ * <code>arm_vlog_q15()</code> process a whole buffer.
+ */
+
+/**
+ * @addtogroup log
+ * @{
+ */
+
+/* ln(2) in two parts, the first one exact when multiplied by the exponent */
+#define LOG_F32_LN2_HI       0.693145752f
+#define LOG_F32_LN2_LO       1.42860677e-06f
+
+/**
+ * @brief  Fast approximation to the natural logarithm for floating-point data.
+ * @param[in] x input value.
+ * @return  ln(x).
+ */
+
+float32_t arm_log_f32(
+  float32_t x)
+{
+  union
+  {
+    float32_t f;
+    int32_t i;
+  } in;                                          /* Input and its bit pattern */
+  float32_t r, p;                                /* Reduced argument, polynomial */
+  int32_t e, i;                                  /* Exponent, table index */
+
+  in.f = x;
+
+  if(in.i <= 0)
+  {
+    /* Zero gives -infinity, negative values NaN */
+    in.i = ((in.i & 0x7FFFFFFF) == 0) ? (int32_t) 0xFF800000 : 0x7FC00000;
+    return (in.f);
+  }
+
+  if(in.i >= 0x7F800000)
+  {
+    /* +infinity and NaN */
+    return (x);
+  }
+
+  e = 0;
+  if(in.i < 0x00800000)
+  {
+    /* Denormal input: normalize */
+    in.f *= 8388608.0f;
+    e = -23;
+  }
+
+  /* Exponent and nearest table point of the mantissa */
+  e += (in.i >> 23) - 127;
+  i = (((in.i & 0x007FFFFF) >> 17) + 1) >> 1;
+
+  /* Mantissa in [1 2) */
+  in.i = (in.i & 0x007FFFFF) | 0x3F800000;
+
+  if(i == 32)
+  {
+    /* Nearest to 2: use the next exponent */
+    in.f *= 0.5f;
+    e++;
+    i = 0;
+  }
+
+  /* r = (m - c) / c, m - c being exact */
+  r = (in.f - (1.0f + (float32_t) i * 0.03125f)) * logInvTable_f32[i];
+
+  /* ln(1 + r) */
+  p = r + (r * r) * (-0.5f + r * (0.333333343f - r * 0.25f));
+
+  return ((((float32_t) e * LOG_F32_LN2_HI) + logTable_f32[i]) + (((float32_t) e * LOG_F32_LN2_LO) + p));
+}
+
+/**
+ * @brief  Natural logarithm of the elements of a floating-point vector.
+ * @param[in]  *pSrc points to the input vector
+ * @param[out] *pDst points to the output vector
+ * @param[in]  blockSize number of samples in each vector
+ * @return none.
+ */
+
+void arm_vlog_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* The four evaluations are independent and can be interleaved */
+    pDst[0] = arm_log_f32(pSrc[0]);
+    pDst[1] = arm_log_f32(pSrc[1]);
+    pDst[2] = arm_log_f32(pSrc[2]);
+    pDst[3] = arm_log_f32(pSrc[3]);
+
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_log_f32(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of log group
+ */
@@ -0,0 +1,142 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_log_q15.c
+ * Description:  Fast natural logarithm calculation for Q15 values
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup log
+ * @{
+ */
+
+/* ln(2) in 16.16 format */
+#define LOG_Q15_LN2          45426
+
+/**
+ * @brief  Fast approximation to the natural logarithm for Q15 data.
+ * @param[in] x input value in the range (0 +1).
+ * @return  ln(x) in 4.11 format.
+ */
+
+q15_t arm_log_q15(
+  q15_t x)
+{
+  q31_t m, d, r, lnm;                            /* Mantissa, offset, reduced argument */
+  uint32_t s, i;                                 /* Shift, table index */
+
+  if(x <= 0)
+  {
+    return ((q15_t) 0x8000);
+  }
+
+  /* Mantissa in [0.5 1) */
+  s = __CLZ((uint32_t) x) - 17u;
+  m = (q31_t) x << s;
+
+  /* Nearest table point c = 0.5 + i / 64 */
+  i = ((uint32_t) (m - 0x4000) + 0x100u) >> 9;
+  d = m - (0x4000 + (q31_t) (i << 9));
+
+  /* r = (m - c) / c in 1.15 format, 1/c being in 3.13 format */
+  r = (d * (logInvTable_q31[i] >> 16)) >> 13;
+
+  /* ln(m) = ln(c) + r - r^2 / 2, in 1.15 format */
+  lnm = (logTable_q31[i] >> 16) + r - ((r * r) >> 16);
+
+  /* ln(x) = ln(m) - s * ln(2) in 16.16 format, rounded to 4.11 */
+  return ((q15_t) (((lnm << 1) - ((q31_t) s * LOG_Q15_LN2) + 16) >> 5));
+}
+
+/**
+ * @brief  Natural logarithm of the elements of a Q15 vector.
+ * @param[in]  *pSrc points to the input vector
+ * @param[out] *pDst points to the output vector
+ * @param[in]  blockSize number of samples in each vector
+ * @return none.
+ */
+
+void arm_vlog_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* The four evaluations are independent and can be interleaved */
+    pDst[0] = arm_log_q15(pSrc[0]);
+    pDst[1] = arm_log_q15(pSrc[1]);
+    pDst[2] = arm_log_q15(pSrc[2]);
+    pDst[3] = arm_log_q15(pSrc[3]);
+
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_log_q15(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of log group
+ */
@@ -0,0 +1,148 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_log_q31.c
+ * Description:  Fast natural logarithm calculation for Q31 values
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup log
+ * @{
+ */
+
+/* ln(2) in 1.31 format, multiplied by the shift in 64 bits */
+#define LOG_Q31_LN2          1488522236
+
+/**
+ * @brief  Fast approximation to the natural logarithm for Q31 data.
+ * @param[in] x input value in the range (0 +1).
+ * @return  ln(x) in 5.26 format.
+ */
+
+q31_t arm_log_q31(
+  q31_t x)
+{
+  q31_t m, d, r, p, lnm;                         /* Mantissa, offset, reduced argument, polynomial */
+  uint32_t s, i;                                 /* Shift, table index */
+
+  if(x <= 0)
+  {
+    return ((q31_t) 0x80000000);
+  }
+
+  /* Mantissa in [0.5 1) */
+  s = __CLZ(x) - 1u;
+  m = x << s;
+
+  /* Nearest table point c = 0.5 + i / 64 */
+  i = ((uint32_t) (m - 0x40000000) + 0x01000000u) >> 25;
+  d = (q31_t) ((uint32_t) m - (0x40000000u + (i << 25)));
+
+  /* r = (m - c) / c, 1/c being in 3.29 format */
+  r = (q31_t) (((q63_t) d * logInvTable_q31[i]) >> 29);
+
+  /* ln(1 + r) = r + r * r * (-1/2 + r * (1/3 - r / 4)) */
+  p = -0x20000000;
+  p = 0x2AAAAAAB + (q31_t) (((q63_t) p * r) >> 31);
+  p = -0x40000000 + (q31_t) (((q63_t) p * r) >> 31);
+  p = (q31_t) (((q63_t) p * r) >> 31);
+  p = r + (q31_t) (((q63_t) p * r) >> 31);
+
+  lnm = logTable_q31[i] + p;
+
+  /* ln(x) = ln(m) - s * ln(2), rounded to 5.26 */
+  return ((q31_t) ((((q63_t) lnm - ((q63_t) s * LOG_Q31_LN2)) + 16) >> 5));
+}
+
+/**
+ * @brief  Natural logarithm of the elements of a Q31 vector.
+ * @param[in]  *pSrc points to the input vector
+ * @param[out] *pDst points to the output vector
+ * @param[in]  blockSize number of samples in each vector
+ * @return none.
+ */
+
+void arm_vlog_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* The four evaluations are independent and can be interleaved */
+    pDst[0] = arm_log_q31(pSrc[0]);
+    pDst[1] = arm_log_q31(pSrc[1]);
+    pDst[2] = arm_log_q31(pSrc[2]);
+    pDst[3] = arm_log_q31(pSrc[3]);
+
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_log_q31(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of log group
+ */
@@ -0,0 +1,138 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_tanh_q15.c
+ * Description:  Fast hyperbolic tangent calculation for Q15 values
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup tanh
+ * @{
+ */
+
+/**
+ * @brief  Fast approximation to the hyperbolic tangent for Q15 data.
+ * @param[in] x input value in 4.11 format.
+ * @return  tanh(x) in 1.15 format.
+ */
+
+q15_t arm_tanh_q15(
+  q15_t x)
+{
+  q31_t ax, d, T, a1, a;                         /* Absolute value, offset, table value, result */
+  uint32_t i;                                    /* Table index */
+
+  ax = (x < 0) ? -(q31_t) x : (q31_t) x;
+
+  if(ax >= (11 << 11))
+  {
+    a = 0x7FFF;
+  }
+  else
+  {
+    /* Nearest table point, offset in 1.15 format */
+    i = ((uint32_t) ax + 0x40u) >> 7;
+    d = (ax - (q31_t) (i << 7)) << 4;
+
+    /* T + (1 - T^2) d - T (1 - T^2) d^2, in 1.15 format */
+    T = tanhTable_q31[i] >> 16;
+    a1 = 0x7FFF - ((T * T) >> 15);
+    a = T + (((a1 - (((T * a1) >> 15) * d >> 15)) * d) >> 15);
+    a = __SSAT(a, 16);
+  }
+
+  return ((q15_t) ((x < 0) ? -a : a));
+}
+
+/**
+ * @brief  Hyperbolic tangent of the elements of a Q15 vector.
+ * @param[in]  *pSrc points to the input vector
+ * @param[out] *pDst points to the output vector
+ * @param[in]  blockSize number of samples in each vector
+ * @return none.
+ */
+
+void arm_vtanh_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* The four evaluations are independent and can be interleaved */
+    pDst[0] = arm_tanh_q15(pSrc[0]);
+    pDst[1] = arm_tanh_q15(pSrc[1]);
+    pDst[2] = arm_tanh_q15(pSrc[2]);
+    pDst[3] = arm_tanh_q15(pSrc[3]);
+
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_tanh_q15(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of tanh group
+ */
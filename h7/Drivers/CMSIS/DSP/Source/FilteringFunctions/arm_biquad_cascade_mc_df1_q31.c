@@ -0,0 +1,152 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_mc_df1_q31.c
+ * Description:  Processing function for the Q31 Biquad cascade filter. N interleaved channels
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF1
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 multichannel Biquad cascade filter.
+ * @param[in]  *S         points to an instance of the Q31 multichannel Biquad cascade structure.
+ * @param[in]  *pSrc      points to the block of interleaved input frames.
+ * @param[out] *pDst      points to the block of interleaved output frames.
+ * @param[in]  blockSize  number of frames to process.
+ * @return none.
+ *
+ * \par
+ * The input and output hold <code>blockSize</code> frames of <code>numChannels</code>
+ * interleaved samples, and may be the same buffer. All channels are filtered by the
+ * same cascade, each channel keeping its own state.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * As for <code>arm_biquad_cascade_df1_q31()</code>, the accumulation is performed on 64 bits
+ * in 2.62 format, shifted by <code>postShift+1</code> bits and truncated to 1.31 format.
+ * The input must be scaled down by 2 bits to avoid overflows.
+ */
+
+void arm_biquad_cascade_mc_df1_q31(
+  const arm_biquad_casd_mc_df1_inst_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q63_t acc;                                     /*  accumulator                   */
+  uint32_t uShift = ((uint32_t) S->postShift + 1u);
+  uint32_t lShift = 32u - uShift;                /*  Shift to be applied to the output */
+  q31_t *pIn = pSrc;                             /*  stage input pointer           */
+  q31_t *pI, *pO;                                /*  channel input and output      */
+  q31_t *pState = S->pState;                     /*  pState pointer initialization */
+  q31_t *pCoeffs = S->pCoeffs;                   /*  coeff pointer initialization  */
+  uint32_t numChannels = S->numChannels;         /*  frame length                  */
+  q31_t Xn1, Xn2, Yn1, Yn2;                      /*  Filter state variables        */
+  q31_t b0, b1, b2, a1, a2;                      /*  Filter coefficients           */
+  q31_t Xn;                                      /*  temporary input               */
+  q31_t acc_l, acc_h;                            /*  temporary output variables    */
+  uint32_t sample, ch, stage = S->numStages;     /*  loop counters                 */
+
+  do
+  {
+    /* Reading the coefficients */
+    b0 = pCoeffs[0];
+    b1 = pCoeffs[1];
+    b2 = pCoeffs[2];
+    a1 = pCoeffs[3];
+    a2 = pCoeffs[4];
+
+    for (ch = 0u; ch < numChannels; ch++)
+    {
+      /* Reading the state values of the channel */
+      Xn1 = pState[(4u * ch) + 0u];
+      Xn2 = pState[(4u * ch) + 1u];
+      Yn1 = pState[(4u * ch) + 2u];
+      Yn2 = pState[(4u * ch) + 3u];
+
+      pI = pIn + ch;
+      pO = pDst + ch;
+      sample = blockSize;
+
+      while(sample > 0u)
+      {
+        Xn = *pI;
+
+        /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+        acc = (q63_t) b0 *Xn;
+        acc += (q63_t) b1 *Xn1;
+        acc += (q63_t) b2 *Xn2;
+        acc += (q63_t) a1 *Yn1;
+        acc += (q63_t) a2 *Yn2;
+
+        /* Every time after the output is computed state should be updated. */
+        Xn2 = Xn1;
+        Xn1 = Xn;
+        Yn2 = Yn1;
+
+        /* The result is converted to 1.31 */
+        acc_l = acc & 0xffffffff;
+        acc_h = (acc >> 32) & 0xffffffff;
+        Yn1 = (uint32_t) acc_l >> lShift | acc_h << uShift;
+
+        *pO = Yn1;
+
+        /* Next frame */
+        pI += numChannels;
+        pO += numChannels;
+        sample--;
+      }
+
+      /*  Store the updated state variables back into the pState array */
+      pState[(4u * ch) + 0u] = Xn1;
+      pState[(4u * ch) + 1u] = Xn2;
+      pState[(4u * ch) + 2u] = Yn1;
+      pState[(4u * ch) + 3u] = Yn2;
+    }
+
+    /* Next stage: coefficients, states of all channels */
+    pCoeffs += 5u;
+    pState += 4u * numChannels;
+
+    /*  The current stage input is given as the output to the next stage */
+    pIn = pDst;
+
+    /* decrement the loop counter */
+    stage--;
+
+  } while(stage > 0u);
+}
+
+/**
+ * @} end of BiquadCascadeDF1 group
+ */
@@ -0,0 +1,212 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_mc_df2T_f32.c
+ * Description:  Processing function for floating-point transposed direct form II Biquad cascade filter. N interleaved channels
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+* @ingroup groupFilters
+*/
+
+/**
+* @addtogroup BiquadCascadeDF2T
+* @{
+*/
+
+/**
+* @brief Processing function for the floating-point multichannel transposed direct form II Biquad cascade filter.
+* @param[in]  *S        points to an instance of the filter data structure.
+* @param[in]  *pSrc     points to the block of interleaved input frames.
+* @param[out] *pDst     points to the block of interleaved output frames.
+* @param[in]  blockSize number of frames to process.
+* @return none.
+*
+* \par
+* The input and output hold <code>blockSize</code> frames of <code>numChannels</code>
+* interleaved samples, as received from a TDM serial audio interface:
+* <pre>
+*     {x0[0], x1[0], ..., xN-1[0], x0[1], x1[1], ...}
+* </pre>
+* All channels are filtered by the same cascade of Biquads, each channel keeping its
+* own state. <code>pSrc</code> and <code>pDst</code> may point to the same buffer for
+* in-place processing.
+* \par
+* Channels are processed four at a time, their state variables staying in registers
+* over the whole block; the remaining channels are processed one at a time.
+*/
+void arm_biquad_cascade_mc_df2T_f32(
+const arm_biquad_cascade_mc_df2T_instance_f32 * S,
+float32_t * pSrc,
+float32_t * pDst,
+uint32_t blockSize)
+{
+    float32_t *pIn = pSrc;                         /*  stage input pointer       */
+    float32_t *pI, *pO;                            /*  channel input and output  */
+    float32_t *pState = S->pState;                 /*  State pointer             */
+    float32_t *pCoeffs = S->pCoeffs;               /*  coefficient pointer       */
+    uint32_t numChannels = S->numChannels;         /*  frame length              */
+    float32_t b0, b1, b2, a1, a2;                  /*  Filter coefficients       */
+    float32_t Xna, Yna, d1a, d2a;                  /*  channel a                 */
+    uint32_t sample, ch, stage = S->numStages;     /*  loop counters             */
+
+#ifndef ARM_MATH_CM0_FAMILY
+    float32_t Xnb, Xnc, Xnd;                       /*  channels b, c, d inputs   */
+    float32_t Ynb, Ync, Ynd;                       /*  channels b, c, d outputs  */
+    float32_t d1b, d2b, d1c, d2c, d1d, d2d;        /*  channels b, c, d states   */
+#endif
+
+    do
+    {
+        /* Reading the coefficients */
+        b0 = pCoeffs[0];
+        b1 = pCoeffs[1];
+        b2 = pCoeffs[2];
+        a1 = pCoeffs[3];
+        a2 = pCoeffs[4];
+
+        ch = 0u;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+        /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+        /* Four channels at a time */
+        while((ch + 4u) <= numChannels)
+        {
+            /* Reading the state values */
+            d1a = pState[(2u * ch) + 0u];
+            d2a = pState[(2u * ch) + 1u];
+            d1b = pState[(2u * ch) + 2u];
+            d2b = pState[(2u * ch) + 3u];
+            d1c = pState[(2u * ch) + 4u];
+            d2c = pState[(2u * ch) + 5u];
+            d1d = pState[(2u * ch) + 6u];
+            d2d = pState[(2u * ch) + 7u];
+
+            pI = pIn + ch;
+            pO = pDst + ch;
+            sample = blockSize;
+
+            while(sample > 0u)
+            {
+                /* Read the inputs of the four channels of the frame */
+                Xna = pI[0];
+                Xnb = pI[1];
+                Xnc = pI[2];
+                Xnd = pI[3];
+
+                /* y[n] = b0 * x[n] + d1 */
+                Yna = (b0 * Xna) + d1a;
+                Ynb = (b0 * Xnb) + d1b;
+                Ync = (b0 * Xnc) + d1c;
+                Ynd = (b0 * Xnd) + d1d;
+
+                /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+                d1a = (b1 * Xna) + (a1 * Yna) + d2a;
+                d1b = (b1 * Xnb) + (a1 * Ynb) + d2b;
+                d1c = (b1 * Xnc) + (a1 * Ync) + d2c;
+                d1d = (b1 * Xnd) + (a1 * Ynd) + d2d;
+
+                /* d2 = b2 * x[n] + a2 * y[n] */
+                d2a = (b2 * Xna) + (a2 * Yna);
+                d2b = (b2 * Xnb) + (a2 * Ynb);
+                d2c = (b2 * Xnc) + (a2 * Ync);
+                d2d = (b2 * Xnd) + (a2 * Ynd);
+
+                pO[0] = Yna;
+                pO[1] = Ynb;
+                pO[2] = Ync;
+                pO[3] = Ynd;
+
+                /* Next frame */
+                pI += numChannels;
+                pO += numChannels;
+                sample--;
+            }
+
+            /* Store the updated state variables back into the state array */
+            pState[(2u * ch) + 0u] = d1a;
+            pState[(2u * ch) + 1u] = d2a;
+            pState[(2u * ch) + 2u] = d1b;
+            pState[(2u * ch) + 3u] = d2b;
+            pState[(2u * ch) + 4u] = d1c;
+            pState[(2u * ch) + 5u] = d2c;
+            pState[(2u * ch) + 6u] = d1d;
+            pState[(2u * ch) + 7u] = d2d;
+
+            ch += 4u;
+        }
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+        /* Remaining channels, one at a time */
+        while(ch < numChannels)
+        {
+            d1a = pState[(2u * ch) + 0u];
+            d2a = pState[(2u * ch) + 1u];
+
+            pI = pIn + ch;
+            pO = pDst + ch;
+            sample = blockSize;
+
+            while(sample > 0u)
+            {
+                Xna = *pI;
+
+                Yna = (b0 * Xna) + d1a;
+                d1a = (b1 * Xna) + (a1 * Yna) + d2a;
+                d2a = (b2 * Xna) + (a2 * Yna);
+
+                *pO = Yna;
+
+                pI += numChannels;
+                pO += numChannels;
+                sample--;
+            }
+
+            pState[(2u * ch) + 0u] = d1a;
+            pState[(2u * ch) + 1u] = d2a;
+
+            ch++;
+        }
+
+        /* Next stage: coefficients, states of all channels */
+        pCoeffs += 5u;
+        pState += 2u * numChannels;
+
+        /* The current stage input is given as the output to the next stage */
+        pIn = pDst;
+
+        /* decrement the loop counter */
+        stage--;
+
+    } while(stage > 0u);
+}
+
+/**
+ * @} end of BiquadCascadeDF2T group
+ */
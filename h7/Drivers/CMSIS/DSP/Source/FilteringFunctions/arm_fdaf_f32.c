@@ -0,0 +1,207 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fdaf_f32.c
+ * Description:  Floating-point partitioned frequency-domain adaptive filter
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FDAF Partitioned Frequency-Domain Adaptive Filter
+ *
+ * This set of functions implements long floating-point adaptive filters in
+ * the frequency domain, such as the echo path models of acoustic echo
+ * cancellers, where the time-domain LMS filters cost <code>2*numTaps</code>
+ * multiply-accumulates per sample.
+ * Each call to the function processes one block of <code>blockSize</code> samples,
+ * <code>blockSize</code> being fixed when the instance is initialized.
+ *
+ * \par Algorithm:
+ * The filter is the multidelay block frequency-domain adaptive filter (MDF):
+ * the same uniformly partitioned overlap-save convolution as the partitioned
+ * FFT FIR filter (see arm_fir_fft_f32()), of <code>numParts = ceil(numTaps / blockSize)</code>
+ * partitions, whose partition spectra W<sub>p</sub> are adapted. For each block:
+ * <pre>
+ *     Y     = sum(W<sub>p</sub> * X<sub>p</sub>)                      filter output spectrum
+ *     e     = d - last blockSize samples of IFFT(Y)       error, the output
+ *     E     = FFT(blockSize zeros, e)
+ *     P[k]  = beta * P[k] + (1 - beta) * |X<sub>0</sub>[k]|<sup>2</sup>        power of each bin
+ *     W<sub>p</sub>[k] += mu * conj(X<sub>p</sub>[k]) * E[k] / (numParts * (P[k] + delta))
+ * </pre>
+ * where X<sub>p</sub> is the spectrum of the input window p blocks old. The
+ * step is normalized per bin by the power of the input, so that all the
+ * frequencies converge at the same rate whatever the spectrum of the input.
+ * The products are accumulated with arm_cmplx_mac_cmplx_f32() and
+ * arm_cmplx_conj_mac_cmplx_f32().
+ * \par
+ * To keep the linear convolution, the time-domain partitions must stay
+ * <code>blockSize</code> long, which costs two FFTs per partition. As in the
+ * alternately constrained MDF, a single partition is constrained per block,
+ * in turn, so that the cost of a block is five real FFTs of <code>2*blockSize</code>
+ * points and <code>2*numParts</code> complex multiply-accumulates of <code>blockSize</code> bins.
+ *
+ * \par Double-Talk Hook:
+ * When the near end talks, the error is no longer the echo residual and the
+ * adaptation must slow down or freeze. When <code>pDoubleTalk</code> is set in
+ * the instance, it is called once the error is computed with the input,
+ * reference and error blocks, and returns the factor applied to the step
+ * for the block, from 0 (adaptation frozen) to 1.
+ *
+ * \par
+ * <code>2*blockSize</code> must be a length supported by <code>arm_rfft_fast_init_f32()</code>.
+ *
+ * \par Instance Structure
+ * The instance keeps pointers into a single state buffer supplied by the caller
+ * at initialization, of <code>ARM_FDAF_STATE_SIZE_F32(numTaps, blockSize)</code> values.
+ * It holds the partition spectra, the frequency delay line, the input window, the
+ * error spectrum, the bin powers and two work buffers. A separate instance and
+ * state buffer must be used for each filter.
+ */
+
+/**
+ * @addtogroup FDAF
+ * @{
+ */
+
+/**
+ * @param[in]  *S    points to an instance of the floating-point frequency-domain adaptive filter structure.
+ * @param[in]  *pSrc points to the block of <code>blockSize</code> input samples, the far-end signal of an echo canceller.
+ * @param[in]  *pRef points to the block of <code>blockSize</code> reference samples, the microphone signal of an echo canceller.
+ * @param[out] *pErr points to the block of <code>blockSize</code> error samples, <code>pRef</code> minus the filter output.
+ * @return     none.
+ */
+
+void arm_fdaf_f32(
+  arm_fdaf_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pRef,
+  float32_t * pErr)
+{
+  uint32_t blockSize = S->blockSize;             /* Block and partition length */
+  uint32_t fftLen = 2u * blockSize;              /* Length of the real FFT */
+  uint32_t numParts = S->numParts;               /* Number of partitions */
+  uint32_t slot = S->partIndex;                  /* Delay line slot of the newest spectrum */
+  float32_t *pX, *pW;                            /* Input spectrum, partition spectrum */
+  float32_t *pE = S->pErrFreq;                   /* Error spectrum */
+  float32_t *pP = S->pPower;                     /* Bin powers */
+  float32_t beta = S->beta;                      /* Power smoothing factor */
+  float32_t step;                                /* Step of the block */
+  float32_t mag, g;                              /* Bin power and step of a bin */
+  uint32_t k;                                    /* Loop counter */
+
+  /* Slide the input window by one block */
+  arm_copy_f32(S->pInput + blockSize, S->pInput, blockSize);
+  arm_copy_f32(pSrc, S->pInput + blockSize, blockSize);
+
+  /* The real FFT works in place on its input: transform a copy of the window */
+  arm_copy_f32(S->pInput, S->pScratch, fftLen);
+  arm_rfft_fast_f32(&S->rfft, S->pScratch, S->pFdl + (slot * fftLen), 0u);
+
+  /* Filter output spectrum, the partition k applied to the input spectrum k blocks old */
+  arm_fill_f32(0.0f, S->pAcc, fftLen);
+  for (k = 0u; k < numParts; k++)
+  {
+    pX = S->pFdl + (slot * fftLen);
+    pW = S->pCoeffsFreq + (k * fftLen);
+
+    /* DC and Nyquist bins are packed as two real values in the first bin */
+    S->pAcc[0] += pX[0] * pW[0];
+    S->pAcc[1] += pX[1] * pW[1];
+    arm_cmplx_mac_cmplx_f32(pX + 2, pW + 2, S->pAcc + 2, blockSize - 1u);
+
+    slot = ((slot + 1u) == numParts) ? 0u : (slot + 1u);
+  }
+
+  /* The second half of the circular convolution is the linear convolution */
+  arm_rfft_fast_f32(&S->rfft, S->pAcc, S->pScratch, 1u);
+  arm_sub_f32(pRef, S->pScratch + blockSize, pErr, blockSize);
+
+  /* Spectrum of the error, preceded by blockSize zeros */
+  arm_fill_f32(0.0f, S->pScratch, blockSize);
+  arm_copy_f32(pErr, S->pScratch + blockSize, blockSize);
+  arm_rfft_fast_f32(&S->rfft, S->pScratch, pE, 0u);
+
+  step = S->mu / (float32_t) numParts;
+  if(S->pDoubleTalk != NULL)
+  {
+    step *= S->pDoubleTalk(S->pContext, pSrc, pRef, pErr, blockSize);
+  }
+
+  /* Per-bin normalized step applied to the error spectrum, from the power of the newest input spectrum */
+  pX = S->pFdl + (S->partIndex * fftLen);
+
+  mag = pX[0] * pX[0];
+  pP[0] = (beta * pP[0]) + ((1.0f - beta) * mag);
+  pE[0] *= step / (pP[0] + S->delta);
+  mag = pX[1] * pX[1];
+  pP[blockSize] = (beta * pP[blockSize]) + ((1.0f - beta) * mag);
+  pE[1] *= step / (pP[blockSize] + S->delta);
+
+  for (k = 1u; k < blockSize; k++)
+  {
+    mag = (pX[(2u * k)] * pX[(2u * k)]) + (pX[(2u * k) + 1u] * pX[(2u * k) + 1u]);
+    pP[k] = (beta * pP[k]) + ((1.0f - beta) * mag);
+    g = step / (pP[k] + S->delta);
+    pE[(2u * k)] *= g;
+    pE[(2u * k) + 1u] *= g;
+  }
+
+  /* Gradient of each partition, from the input spectrum it was applied to */
+  if(step != 0.0f)
+  {
+    slot = S->partIndex;
+    for (k = 0u; k < numParts; k++)
+    {
+      pX = S->pFdl + (slot * fftLen);
+      pW = S->pCoeffsFreq + (k * fftLen);
+
+      pW[0] += pX[0] * pE[0];
+      pW[1] += pX[1] * pE[1];
+      arm_cmplx_conj_mac_cmplx_f32(pX + 2, pE + 2, pW + 2, blockSize - 1u);
+
+      slot = ((slot + 1u) == numParts) ? 0u : (slot + 1u);
+    }
+
+    /* Constrain one partition per block to blockSize taps, in turn */
+    pW = S->pCoeffsFreq + (S->constrainIndex * fftLen);
+    arm_copy_f32(pW, S->pAcc, fftLen);
+    arm_rfft_fast_f32(&S->rfft, S->pAcc, S->pScratch, 1u);
+    arm_fill_f32(0.0f, S->pScratch + blockSize, blockSize);
+    arm_rfft_fast_f32(&S->rfft, S->pScratch, pW, 0u);
+
+    S->constrainIndex = ((S->constrainIndex + 1u) == numParts) ? 0u : (uint16_t) (S->constrainIndex + 1u);
+  }
+
+  /* The next input spectrum goes into the slot preceding the newest */
+  S->partIndex = (S->partIndex == 0u) ? (uint16_t) (numParts - 1u) : (uint16_t) (S->partIndex - 1u);
+}
+
+/**
+ * @} end of FDAF group
+ */
@@ -0,0 +1,111 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fdaf_init_f32.c
+ * Description:  Floating-point frequency-domain adaptive filter initialization function
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FDAF
+ * @{
+ */
+
+/**
+ * @details
+ *
+ * @param[in,out] *S points to an instance of the floating-point frequency-domain adaptive filter structure.
+ * @param[in]     numTaps  Number of filter coefficients in the filter.
+ * @param[in]     mu step size that controls filter coefficient updates, in (0 2).
+ * @param[in]     *pState points to the state buffer.
+ * @param[in]     blockSize number of samples that are processed per call.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+ *                <code>numTaps</code> is zero or <code>2*blockSize</code> is not a supported real FFT length.
+ *
+ * <b>Description:</b>
+ * \par
+ * The coefficients start at zero. <code>pState</code> points to the state buffer of
+ * <code>ARM_FDAF_STATE_SIZE_F32(numTaps, blockSize)</code> samples,
+ * that is <code>(4*numParts + 9)*blockSize + 1</code> with <code>numParts = ceil(numTaps / blockSize)</code>.
+ * \par
+ * The power smoothing factor <code>beta</code> is set to 0.9 and the regularization
+ * <code>delta</code> to <code>2*blockSize*1e-6</code>, the bin power of a white noise
+ * at -60 dBFS. Both, as well as <code>mu</code>, can be changed in the instance
+ * between calls. No double-talk hook is set.
+ */
+
+arm_status arm_fdaf_init_f32(
+  arm_fdaf_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t mu,
+  float32_t * pState,
+  uint16_t blockSize)
+{
+  uint32_t fftLen = 2u * (uint32_t) blockSize;   /* Length of the real FFT */
+  uint32_t numParts;                             /* Number of partitions */
+  arm_status status = ARM_MATH_ARGUMENT_ERROR;
+
+  if((numTaps != 0u) && (fftLen <= 0xFFFFu) &&
+     (arm_rfft_fast_init_f32(&S->rfft, (uint16_t) fftLen) == ARM_MATH_SUCCESS))
+  {
+    numParts = ((uint32_t) numTaps + blockSize - 1u) / blockSize;
+
+    S->numTaps = numTaps;
+    S->blockSize = blockSize;
+    S->numParts = (uint16_t) numParts;
+    S->partIndex = 0u;
+    S->constrainIndex = 0u;
+    S->mu = mu;
+    S->beta = 0.9f;
+    S->delta = (float32_t) fftLen * 1e-6f;
+    S->pDoubleTalk = NULL;
+    S->pContext = NULL;
+
+    /* Carve the state buffer */
+    S->pCoeffsFreq = pState;
+    S->pFdl = S->pCoeffsFreq + (numParts * fftLen);
+    S->pInput = S->pFdl + (numParts * fftLen);
+    S->pErrFreq = S->pInput + fftLen;
+    S->pAcc = S->pErrFreq + fftLen;
+    S->pScratch = S->pAcc + fftLen;
+    S->pPower = S->pScratch + fftLen;
+
+    /* Clear the coefficients, the frequency delay line, the input window and the bin powers */
+    memset(S->pCoeffsFreq, 0, ((2u * numParts) + 1u) * fftLen * sizeof(float32_t));
+    memset(S->pPower, 0, (blockSize + 1u) * sizeof(float32_t));
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of FDAF group
+ */
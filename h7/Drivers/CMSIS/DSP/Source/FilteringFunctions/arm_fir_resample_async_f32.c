@@ -0,0 +1,189 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_async_f32.c
+ * Description:  Processing function for the floating-point asynchronous FIR sample rate converter.
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point asynchronous FIR sample rate converter.
+ * @param[in,out] *S        points to an instance of the floating-point asynchronous sample rate converter structure.
+ * @param[in]     *pSrc     points to the block of input data.
+ * @param[out]    *pDst     points to the block of output data.
+ * @param[in]     blockSize number of input samples to process.
+ * @return        number of output samples written to <code>pDst</code>.
+ *
+ * \par
+ * The number of output samples per call is at most <code>blockSize/ratio+1</code>
+ * and <code>pDst</code> must be able to hold this many values.
+ * \par
+ * <code>S->ratio</code> is the number of input samples consumed per output sample,
+ * <code>Fs_in/Fs_out</code>. It may be modified between two calls to follow the drift
+ * between the input and output clocks, the output phase staying continuous.
+ */
+
+uint32_t arm_fir_resample_async_f32(
+  arm_fir_resample_async_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+  float32_t *px0, *px1;                          /* State pointers of the two polyphase components */
+  float32_t *pb0, *pb1;                          /* Coefficient pointers of the two polyphase components */
+  float32_t sum0, sum1;                          /* Accumulators */
+  float32_t pos = S->pos, ratio = S->ratio;      /* Output position and step, in input samples */
+  float32_t last = (float32_t) blockSize - 1.0f; /* Last position which can be computed in this block */
+  float32_t frac;                                /* Distance between the output and the polyphase component p */
+  uint32_t L = S->L, phaseLen = S->phaseLength;  /* Polyphase parameters */
+  uint32_t p, outCnt = 0u;                       /* Polyphase component and output counter */
+  int32_t n;                                     /* Input index */
+  uint32_t tapCnt, i;                            /* Loop counters */
+
+  /* S->pState buffer contains previous frame phaseLen samples */
+  /* Copy the new input samples after them */
+  arm_copy_f32(pSrc, pState + phaseLen, blockSize);
+
+  while(pos < last)
+  {
+    /* Integer part of the position, pos is never below -1 */
+    n = (int32_t) (pos + 1.0f) - 1;
+
+    /* Fractional part in units of polyphase components */
+    frac = (pos - (float32_t) n) * (float32_t) L;
+    p = (uint32_t) frac;
+
+    if(p >= L)
+    {
+      p = L - 1u;
+    }
+
+    frac -= (float32_t) p;
+
+    /* Polyphase component p applied on x[n], x[n-1], ... */
+    px0 = pState + (n + 1);
+    pb0 = pCoeffs + (L - 1u - p);
+
+    /* Polyphase component p+1, which is component 0 applied on x[n+1] when p is the last one */
+    if(p == (L - 1u))
+    {
+      px1 = px0 + 1;
+      pb1 = pCoeffs + (L - 1u);
+    }
+    else
+    {
+      px1 = px0;
+      pb1 = pb0 - 1;
+    }
+
+    sum0 = 0.0f;
+    sum1 = 0.0f;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Loop unrolling.  Compute 2 taps of both components at a time. */
+    tapCnt = phaseLen >> 1u;
+
+    while(tapCnt > 0u)
+    {
+      sum0 += px0[0] * pb0[0];
+      sum1 += px1[0] * pb1[0];
+      sum0 += px0[1] * pb0[L];
+      sum1 += px1[1] * pb1[L];
+
+      px0 += 2u;
+      px1 += 2u;
+      pb0 += 2u * L;
+      pb1 += 2u * L;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* If the polyphase length is odd, compute the remaining tap here. */
+    tapCnt = phaseLen & 0x1u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    tapCnt = phaseLen;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+    while(tapCnt > 0u)
+    {
+      sum0 += *px0++ * *pb0;
+      sum1 += *px1++ * *pb1;
+
+      pb0 += L;
+      pb1 += L;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* Linear interpolation between the two polyphase components */
+    *pDst++ = sum0 + (frac * (sum1 - sum0));
+    outCnt++;
+
+    /* Advance to the next output position */
+    pos += ratio;
+  }
+
+  /* Save the position of the next output, relative to the next block */
+  S->pos = pos - (float32_t) blockSize;
+
+  /* Processing is complete.
+   ** Now copy the last phaseLen samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+  pStateCurnt = S->pState;
+  pState = S->pState + blockSize;
+
+  for (i = 0u; i < phaseLen; i++)
+  {
+    *pStateCurnt++ = *pState++;
+  }
+
+  return (outCnt);
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
@@ -0,0 +1,218 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_f32.c
+ * Description:  Processing function for the floating-point rational FIR sample rate converter.
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FIR_Resample Finite Impulse Response (FIR) Sample Rate Converter
+ *
+ * These functions convert a signal between two sample rates whose ratio is not an integer,
+ * for example 44.1 kHz USB audio to a 48 kHz codec.
+ * Conceptually, the rational converter is an <code>L</code> times FIR interpolator followed by
+ * a <code>M</code> times decimator, giving an output rate of <code>Fs*L/M</code>:
+ * <pre>
+ *    x[n] --> upsample by L --> lowpass filter --> downsample by M --> y[m]
+ * </pre>
+ * The lowpass filter is designed at the rate <code>Fs*L</code>, with a normalized cutoff frequency
+ * of <code>1/max(L, M)</code> and a passband gain of <code>L</code>.
+ * The user of the function is responsible for providing the filter coefficients.
+ *
+ * The filter is split in <code>L</code> polyphase components of <code>phaseLength=numTaps/L</code> taps
+ * and only the outputs kept by the decimator are computed, each output using one polyphase component:
+ * <pre>
+ *    t = m * M,   n = t / L,   p = t % L
+ *    y[m] = b[p] * x[n] + b[L+p] * x[n-1] + ... + b[L*(phaseLength-1)+p] * x[n-phaseLength+1]
+ * </pre>
+ * The cost is <code>phaseLength</code> multiply-accumulates per output sample whatever the ratio.
+ *
+ * The asynchronous converter uses the same polyphase filter bank as a fine grid of fractional delays
+ * and linearly interpolates between the two polyphase components surrounding the exact output position.
+ * Its ratio <code>Fs_in/Fs_out</code> is a floating-point value which may be updated between blocks,
+ * for instance from the fill level of the audio FIFO or from the USB audio feedback endpoint, to track
+ * the drift between two independent clocks.
+ * For a good image rejection of the linear interpolation, <code>L</code> is typically 32 to 128.
+ *
+ * The functions operate on blocks of input data: <code>pSrc</code> points to <code>blockSize</code>
+ * input values, and the functions return the number of samples written to <code>pDst</code>, which
+ * varies from block to block.
+ * The coefficients are stored in time reversed order, as for the FIR interpolator:
+ * <pre>
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+ * </pre>
+ * so that the same coefficient arrays can be shared with <code>arm_fir_interpolate_f32()</code>.
+ *
+ * \par Instance Structure
+ * The coefficients and state variables for a converter are stored together in an instance data structure.
+ * A separate instance structure must be defined for each converter.
+ * Coefficient arrays may be shared among several instances while state variable array should be allocated separately.
+ *
+ * \par Initialization Functions
+ * There is also an associated initialization function for each converter.
+ * The initialization function performs the following operations:
+ * - Sets the values of the internal structure fields.
+ * - Zeros out the values in the state buffer.
+ * - Checks to make sure that the length of the filter is a multiple of the number of polyphase components.
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point rational FIR sample rate converter.
+ * @param[in,out] *S        points to an instance of the floating-point rational sample rate converter structure.
+ * @param[in]     *pSrc     points to the block of input data.
+ * @param[out]    *pDst     points to the block of output data.
+ * @param[in]     blockSize number of input samples to process.
+ * @return        number of output samples written to <code>pDst</code>.
+ *
+ * \par
+ * The number of output samples per call is at most <code>(blockSize*L+M-1)/M</code>
+ * and <code>pDst</code> must be able to hold this many values.
+ */
+
+uint32_t arm_fir_resample_f32(
+  arm_fir_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+  float32_t *px, *pb;                            /* Temporary pointers for state and coefficient buffers */
+  float32_t sum;                                 /* Accumulator */
+  uint32_t L = S->L, phaseLen = S->phaseLength;  /* Polyphase parameters */
+  uint32_t stepInt, stepFrac;                    /* Decimation step split in input samples and phases */
+  uint32_t n, p, outCnt = 0u;                    /* Input index, phase and output counter */
+  uint32_t tapCnt, i;                            /* Loop counters */
+
+  /* S->pState buffer contains previous frame (phaseLen - 1) samples */
+  /* Copy the new input samples after them */
+  arm_copy_f32(pSrc, pState + (phaseLen - 1u), blockSize);
+
+  /* Position of the next output: input index and polyphase component */
+  n = S->pos / L;
+  p = S->pos % L;
+
+  /* The decimation factor expressed in input samples and phases */
+  stepInt = (uint32_t) S->M / L;
+  stepFrac = (uint32_t) S->M % L;
+
+  while(n < blockSize)
+  {
+    /* x[n-phaseLen+1] is the oldest sample used for this output */
+    px = pState + n;
+
+    /* Coefficients of the polyphase component p, in time reversed order */
+    pb = pCoeffs + (L - 1u - p);
+
+    sum = 0.0f;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Loop unrolling.  Compute 4 taps at a time. */
+    tapCnt = phaseLen >> 2u;
+
+    while(tapCnt > 0u)
+    {
+      sum += px[0] * pb[0];
+      sum += px[1] * pb[L];
+      sum += px[2] * pb[2u * L];
+      sum += px[3] * pb[3u * L];
+
+      px += 4u;
+      pb += 4u * L;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* If the polyphase length is not a multiple of 4, compute the remaining taps here. */
+    tapCnt = phaseLen % 0x4u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    tapCnt = phaseLen;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+    while(tapCnt > 0u)
+    {
+      sum += *px++ * *pb;
+
+      pb += L;
+
+      /* Decrement the loop counter */
+      tapCnt--;
+    }
+
+    /* The result is in the accumulator, store in the destination buffer. */
+    *pDst++ = sum;
+    outCnt++;
+
+    /* Advance to the next output position */
+    n += stepInt;
+    p += stepFrac;
+
+    if(p >= L)
+    {
+      p -= L;
+      n++;
+    }
+  }
+
+  /* Save the position of the next output, relative to the next block */
+  S->pos = ((n - blockSize) * L) + p;
+
+  /* Processing is complete.
+   ** Now copy the last phaseLen - 1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+  pStateCurnt = S->pState;
+  pState = S->pState + blockSize;
+
+  for (i = 0u; i < (phaseLen - 1u); i++)
+  {
+    *pStateCurnt++ = *pState++;
+  }
+
+  return (outCnt);
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
@@ -0,0 +1,198 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_cholesky_f32.c
+ * Description:  Cholesky decomposition of a symmetric positive-definite matrix
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixChol Cholesky and LDL^T Decomposition
+ *
+ * Factorizes a symmetric matrix for the solution of linear systems, as a
+ * cheaper and more accurate alternative to the matrix inverse in estimation
+ * loops (Kalman filter covariance, normal equations of least squares).
+ *
+ * The Cholesky decomposition of a symmetric positive-definite matrix is
+ * <code>A = L * L<sup>T</sup></code>, L being lower triangular with a positive diagonal.
+ * The LDL<sup>T</sup> decomposition is <code>A = L * D * L<sup>T</sup></code>, L being unit
+ * lower triangular and D diagonal; it needs no square root and also accepts
+ * symmetric indefinite matrices whose leading minors are non-zero.
+ *
+ * Only the lower triangle of the input is read, and the output may be the
+ * input matrix itself. A system <code>A * X = B</code> is then solved with
+ * arm_mat_cholesky_solve_f32() or arm_mat_ldlt_solve_f32(), in about
+ * <code>n<sup>3</sup> / 6</code> multiply-accumulates for the decomposition,
+ * against <code>n<sup>3</sup></code> for arm_mat_inverse_f32().
+ *
+ * The functions exist for single and double precision; on Cortex-M7 with a
+ * double-precision FPU the f64 versions run in hardware. Inner products are
+ * computed with four independent accumulators to keep the FPU pipeline busy.
+ *
+ * \par Algorithm
+ * Both decompositions are computed row by row without pivoting, each element
+ * being a dot product of two rows already computed. If a pivot is not
+ * positive (Cholesky) or is zero (LDL<sup>T</sup>), the functions return
+ * <code>ARM_MATH_DECOMPOSITION_FAILURE</code>.
+ */
+
+/**
+ * @addtogroup MatrixChol
+ * @{
+ */
+
+/**
+ * @brief Floating-point Cholesky decomposition of a symmetric positive-definite matrix.
+ * @param[in]       *pSrc points to the input matrix structure, only its lower triangle is read
+ * @param[out]      *pDst points to the output matrix structure, lower-triangular factor L
+ * @return     		The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the input matrix is not square or if the size
+ * of the output matrix does not match the size of the input matrix.
+ * If the input matrix is not positive definite, then the function returns
+ * <code>ARM_MATH_DECOMPOSITION_FAILURE</code>. Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.
+ */
+
+arm_status arm_mat_cholesky_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pIn = pSrc->pData;                  /* input data matrix pointer */
+  float32_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  float32_t *pRowI, *pRowJ;                      /* rows i and j of the factor */
+  float32_t acc0;                                /* accumulator */
+#ifndef ARM_MATH_CM0_FAMILY
+  float32_t acc1, acc2, acc3;                    /* partial sums */
+#endif
+  uint32_t n = pSrc->numRows;                    /* size of the matrix */
+  uint32_t i, j, k;                              /* loop counters */
+  arm_status status;                             /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pSrc->numCols) || (pDst->numRows != pDst->numCols)
+     || (pSrc->numRows != pDst->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    /* Cholesky-Banachiewicz order: row i of L only needs the rows above it,
+     * so the input can be decomposed in place (pDst == pSrc).
+     *
+     *   L(i,j) = (A(i,j) - sum(L(i,k) * L(j,k), k < j)) / L(j,j)   j < i
+     *   L(i,i) = sqrt(A(i,i) - sum(L(i,k) * L(i,k), k < i))
+     *
+     * Both sums are dot products of two contiguous rows. */
+    status = ARM_MATH_SUCCESS;
+
+    for (i = 0u; (i < n) && (status == ARM_MATH_SUCCESS); i++)
+    {
+      for (j = 0u; j <= i; j++)
+      {
+        pRowI = pOut + (i * n);
+        pRowJ = pOut + (j * n);
+        acc0 = 0.0f;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+      /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+      /* Four independent partial sums hide the latency of the FPU */
+      acc1 = 0.0f;
+      acc2 = 0.0f;
+      acc3 = 0.0f;
+
+      /* Loop unrolling */
+      k = j >> 2u;
+      while(k > 0u)
+      {
+        acc0 += pRowI[0] * pRowJ[0];
+        acc1 += pRowI[1] * pRowJ[1];
+        acc2 += pRowI[2] * pRowJ[2];
+        acc3 += pRowI[3] * pRowJ[3];
+        pRowI += 4u;
+        pRowJ += 4u;
+        k--;
+      }
+
+      acc0 += (acc1 + acc2) + acc3;
+
+      /* Remaining 1 to 3 products */
+      k = j % 0x4u;
+
+#else
+
+      /* Run the below code for Cortex-M0 */
+
+      k = j;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+      while(k > 0u)
+      {
+        acc0 += *pRowI++ * *pRowJ++;
+        k--;
+      }
+
+        acc0 = pIn[(i * n) + j] - acc0;
+
+        if(j < i)
+        {
+          pOut[(i * n) + j] = acc0 / pOut[(j * n) + j];
+        }
+        else if(acc0 > 0.0f)
+        {
+          pOut[(i * n) + i] = sqrtf(acc0);
+        }
+        else
+        {
+          /* Not positive definite */
+          status = ARM_MATH_DECOMPOSITION_FAILURE;
+        }
+      }
+
+      /* Upper triangle of the row */
+      for (j = i + 1u; j < n; j++)
+      {
+        pOut[(i * n) + j] = 0.0f;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixChol group
+ */
@@ -46,6 +46,11 @@
  * When matrix size checking is enabled, the functions check: (1) that the inner dimensions of
  * <code>pSrcA</code> and <code>pSrcB</code> are equal; and (2) that the size of the output
  * matrix equals the outer dimensions of <code>pSrcA</code> and <code>pSrcB</code>.
+ *
+ * On cores with the DSP extension, the outputs are computed by blocks held in
+ * registers, 4 x 4 for floating-point and 2 x 2 for Q31 and Q15 data, so that each
+ * element read from memory is used in several multiply-accumulates.
+ * The results are identical to the ones of an output at a time computation.
  */
 
 
@@ -82,8 +87,15 @@ arm_status arm_mat_mult_f32(
 
   /* Run the below code for Cortex-M4 and Cortex-M3 */
 
-  float32_t in1, in2, in3, in4;
-  uint16_t col, i = 0u, j, row = numRowsA, colCnt;      /* loop counters */
+  float32_t *pInA0, *pInA1, *pInA2, *pInA3;      /* pointers to four rows of matrix A */
+  float32_t *pInB;                               /* input data matrix pointer B */
+  float32_t a0, a1, a2, a3;                      /* elements of matrix A */
+  float32_t b0, b1, b2, b3;                      /* elements of matrix B */
+  float32_t c00, c01, c02, c03;                  /* accumulators of the 4 x 4 output block */
+  float32_t c10, c11, c12, c13;
+  float32_t c20, c21, c22, c23;
+  float32_t c30, c31, c32, c33;
+  uint16_t col, row, colCnt;                     /* loop counters */
   arm_status status;                             /* status of matrix multiplication */
 
 #ifdef ARM_MATH_MATRIX_CHECK
@@ -101,86 +113,237 @@ arm_status arm_mat_mult_f32(
 #endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
 
   {
-    /* The following loop performs the dot-product of each row in pSrcA with each column in pSrcB */
-    /* row loop */
-    do
-    {
-      /* Output pointer is set to starting address of the row being processed */
-      px = pOut + i;
+    /* The output is computed by blocks of 4 x 4 elements held in registers.
+     ** Each element of A is then used four times and each row of B is read
+     ** sequentially, which divides the loads from memory by four compared to
+     ** computing the dot-products one output at a time. */
 
-      /* For every row wise process, the column loop counter is to be initiated */
-      col = numColsB;
+    /* Loop over the blocks of 4 rows of pSrcA */
+    row = numRowsA >> 2u;
 
-      /* For every row wise process, the pIn2 pointer is set
-       ** to the starting address of the pSrcB data */
-      pIn2 = pSrcB->pData;
+    while (row > 0u)
+    {
+      /* Output pointer is set to starting address of the rows being processed */
+      px = pOut;
 
-      j = 0u;
+      /* Start from the first column of pSrcB */
+      pInB = pSrcB->pData;
 
-      /* column loop */
-      do
-      {
-        /* Set the variable sum, that acts as accumulator, to zero */
-        sum = 0.0f;
+      /* Loop over the blocks of 4 columns of pSrcB */
+      col = numColsB >> 2u;
 
-        /* Initiate the pointer pIn1 to point to the starting address of the column being processed */
-        pIn1 = pInA;
+      while (col > 0u)
+      {
+        /* Set the accumulators to zero */
+        c00 = c01 = c02 = c03 = 0.0f;
+        c10 = c11 = c12 = c13 = 0.0f;
+        c20 = c21 = c22 = c23 = 0.0f;
+        c30 = c31 = c32 = c33 = 0.0f;
+
+        pInA0 = pInA;
+        pInA1 = pInA0 + numColsA;
+        pInA2 = pInA1 + numColsA;
+        pInA3 = pInA2 + numColsA;
+        pIn2 = pInB;
 
-        /* Apply loop unrolling and compute 4 MACs simultaneously. */
-        colCnt = numColsA >> 2u;
+        colCnt = numColsA;
 
-        /* matrix multiplication        */
         while (colCnt > 0u)
         {
           /* c(m,n) = a(1,1)*b(1,1) + a(1,2) * b(2,1) + .... + a(m,p)*b(p,n) */
-          in3 = *pIn2;
-          pIn2 += numColsB;
-          in1 = pIn1[0];
-          in2 = pIn1[1];
-          sum += in1 * in3;
-          in4 = *pIn2;
+          b0 = pIn2[0];
+          b1 = pIn2[1];
+          b2 = pIn2[2];
+          b3 = pIn2[3];
           pIn2 += numColsB;
-          sum += in2 * in4;
 
-          in3 = *pIn2;
+          a0 = *pInA0++;
+          c00 += a0 * b0;
+          c01 += a0 * b1;
+          c02 += a0 * b2;
+          c03 += a0 * b3;
+
+          a1 = *pInA1++;
+          c10 += a1 * b0;
+          c11 += a1 * b1;
+          c12 += a1 * b2;
+          c13 += a1 * b3;
+
+          a2 = *pInA2++;
+          c20 += a2 * b0;
+          c21 += a2 * b1;
+          c22 += a2 * b2;
+          c23 += a2 * b3;
+
+          a3 = *pInA3++;
+          c30 += a3 * b0;
+          c31 += a3 * b1;
+          c32 += a3 * b2;
+          c33 += a3 * b3;
+
+          /* Decrement the loop counter */
+          colCnt--;
+        }
+
+        /* Store the 4 x 4 block in the destination buffer */
+        px[0] = c00;
+        px[1] = c01;
+        px[2] = c02;
+        px[3] = c03;
+        px[numColsB + 0u] = c10;
+        px[numColsB + 1u] = c11;
+        px[numColsB + 2u] = c12;
+        px[numColsB + 3u] = c13;
+        px[(2u * numColsB) + 0u] = c20;
+        px[(2u * numColsB) + 1u] = c21;
+        px[(2u * numColsB) + 2u] = c22;
+        px[(2u * numColsB) + 3u] = c23;
+        px[(3u * numColsB) + 0u] = c30;
+        px[(3u * numColsB) + 1u] = c31;
+        px[(3u * numColsB) + 2u] = c32;
+        px[(3u * numColsB) + 3u] = c33;
+
+        /* Next block of columns */
+        px += 4u;
+        pInB += 4u;
+
+        /* Decrement the column loop counter */
+        col--;
+      }
+
+      /* If the columns of pSrcB is not a multiple of 4, compute the remaining columns of the 4 rows here. */
+      col = numColsB % 0x4u;
+
+      while (col > 0u)
+      {
+        c00 = c10 = c20 = c30 = 0.0f;
+
+        pInA0 = pInA;
+        pInA1 = pInA0 + numColsA;
+        pInA2 = pInA1 + numColsA;
+        pInA3 = pInA2 + numColsA;
+        pIn2 = pInB;
+
+        colCnt = numColsA;
+
+        while (colCnt > 0u)
+        {
+          b0 = *pIn2;
           pIn2 += numColsB;
-          in1 = pIn1[2];
-          in2 = pIn1[3];
-          sum += in1 * in3;
-          in4 = *pIn2;
+
+          c00 += *pInA0++ * b0;
+          c10 += *pInA1++ * b0;
+          c20 += *pInA2++ * b0;
+          c30 += *pInA3++ * b0;
+
+          /* Decrement the loop counter */
+          colCnt--;
+        }
+
+        px[0] = c00;
+        px[numColsB] = c10;
+        px[2u * numColsB] = c20;
+        px[3u * numColsB] = c30;
+
+        px++;
+        pInB++;
+
+        /* Decrement the column loop counter */
+        col--;
+      }
+
+      /* Update the pointers to the starting address of the next 4 rows */
+      pInA += 4u * numColsA;
+      pOut += 4u * numColsB;
+
+      /* Decrement the row loop counter */
+      row--;
+    }
+
+    /* If the rows of pSrcA is not a multiple of 4, compute the remaining rows here. */
+    row = numRowsA % 0x4u;
+
+    while (row > 0u)
+    {
+      px = pOut;
+      pInB = pSrcB->pData;
+
+      /* Blocks of 4 columns */
+      col = numColsB >> 2u;
+
+      while (col > 0u)
+      {
+        c00 = c01 = c02 = c03 = 0.0f;
+
+        pIn1 = pInA;
+        pIn2 = pInB;
+
+        colCnt = numColsA;
+
+        while (colCnt > 0u)
+        {
+          a0 = *pIn1++;
+          c00 += a0 * pIn2[0];
+          c01 += a0 * pIn2[1];
+          c02 += a0 * pIn2[2];
+          c03 += a0 * pIn2[3];
           pIn2 += numColsB;
-          sum += in2 * in4;
-          pIn1 += 4u;
 
-          /* Decrement the loop count */
+          /* Decrement the loop counter */
           colCnt--;
         }
 
-        /* If the columns of pSrcA is not a multiple of 4, compute any remaining MACs here.
-         ** No loop unrolling is used. */
-        colCnt = numColsA % 0x4u;
+        px[0] = c00;
+        px[1] = c01;
+        px[2] = c02;
+        px[3] = c03;
+
+        px += 4u;
+        pInB += 4u;
+
+        /* Decrement the column loop counter */
+        col--;
+      }
+
+      /* Remaining columns, one dot-product at a time */
+      col = numColsB % 0x4u;
+
+      while (col > 0u)
+      {
+        sum = 0.0f;
+
+        pIn1 = pInA;
+        pIn2 = pInB;
+
+        colCnt = numColsA;
 
         while (colCnt > 0u)
         {
-          /* c(m,n) = a(1,1)*b(1,1) + a(1,2) * b(2,1) + .... + a(m,p)*b(p,n) */
-          sum += *pIn1++ * (*pIn2);
+          sum += *pIn1++ * *pIn2;
           pIn2 += numColsB;
 
           /* Decrement the loop counter */
           colCnt--;
         }
 
-        /* Store the result in the destination buffer */
         *px++ = sum;
-
-        /* Update the pointer pIn2 to point to the  starting address of the next column */
-        j++;
-        pIn2 = pSrcB->pData + j;
+        pInB++;
 
         /* Decrement the column loop counter */
         col--;
+      }
 
-      } while (col > 0u);
+      /* Update the pointers to the starting address of the next row */
+      pInA += numColsA;
+      pOut += numColsB;
+
+      /* Decrement the row loop counter */
+      row--;
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
 
 #else
 
@@ -251,8 +414,6 @@ arm_status arm_mat_mult_f32(
 
       } while (col > 0u);
 
-#endif /* #if defined (ARM_MATH_DSP) */
-
       /* Update the pointer pInA to point to the  starting address of the next row */
       i = i + numColsB;
       pInA = pInA + numColsA;
@@ -265,6 +426,8 @@ arm_status arm_mat_mult_f32(
     status = ARM_MATH_SUCCESS;
   }
 
+#endif /* #if defined (ARM_MATH_DSP) */
+
   /* Return to application */
   return (status);
 }
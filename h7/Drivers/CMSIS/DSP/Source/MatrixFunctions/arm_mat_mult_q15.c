@@ -91,6 +91,8 @@ arm_status arm_mat_mult_q15(
 
   q31_t in;                                      /* Temporary variable to hold the input value */
   q31_t pSourceA1, pSourceB1, pSourceA2, pSourceB2;
+  q15_t *pInA0, *pInA1, *pInB0, *pInB1;          /* pointers to the rows of the 2 x 2 output block */
+  q63_t c00, c01, c10, c11;                      /* accumulators of the 2 x 2 output block */
 
 #else
 
@@ -260,6 +262,167 @@ arm_status arm_mat_mult_q15(
     i = 0u;
     px = pDst->pData;
 
+#ifndef UNALIGNED_SUPPORT_DISABLE
+
+    /* The output is computed by blocks of 2 x 2 elements: two rows of pSrcA against
+     ** two rows of the transposed pSrcB. Each pair of elements loaded feeds two
+     ** dual multiply-accumulates, halving the loads from memory. */
+
+    /* Loop over the pairs of rows of pSrcA */
+    row = numRowsA >> 1u;
+
+    while (row > 0u)
+    {
+      /* Start from the first row of the transposed pSrcB */
+      pInB = pSrcBT;
+
+      /* Loop over the pairs of columns of pSrcB */
+      col = numColsB >> 1u;
+
+      while (col > 0u)
+      {
+        /* Set the accumulators to zero */
+        c00 = 0;
+        c01 = 0;
+        c10 = 0;
+        c11 = 0;
+
+        pInA0 = pSrcA->pData + i;
+        pInA1 = pInA0 + numColsA;
+        pInB0 = pInB;
+        pInB1 = pInB + numColsA;
+
+        /* Compute 2 MACs of each output at a time. */
+        colCnt = numColsA >> 1u;
+
+        while (colCnt > 0u)
+        {
+          /* c(m,n) = a(1,1)*b(1,1) + a(1,2) * b(2,1) + .... + a(m,p)*b(p,n) */
+          pSourceA1 = *__SIMD32(pInA0)++;
+          pSourceA2 = *__SIMD32(pInA1)++;
+          pSourceB1 = *__SIMD32(pInB0)++;
+          pSourceB2 = *__SIMD32(pInB1)++;
+
+          /* Multiply and Accumlates */
+          c00 = __SMLALD(pSourceA1, pSourceB1, c00);
+          c01 = __SMLALD(pSourceA1, pSourceB2, c01);
+          c10 = __SMLALD(pSourceA2, pSourceB1, c10);
+          c11 = __SMLALD(pSourceA2, pSourceB2, c11);
+
+          /* Decrement the loop counter */
+          colCnt--;
+        }
+
+        /* process the last column sample */
+        if ((numColsA & 0x1u) != 0u)
+        {
+          c00 += (q31_t) * pInA0 * *pInB0;
+          c01 += (q31_t) * pInA0 * *pInB1;
+          c10 += (q31_t) * pInA1 * *pInB0;
+          c11 += (q31_t) * pInA1 * *pInB1;
+        }
+
+        /* Saturate and store the results in the destination buffer */
+        px[0] = (q15_t) (__SSAT((c00 >> 15), 16));
+        px[1] = (q15_t) (__SSAT((c01 >> 15), 16));
+        px[numColsB] = (q15_t) (__SSAT((c10 >> 15), 16));
+        px[numColsB + 1u] = (q15_t) (__SSAT((c11 >> 15), 16));
+
+        /* Next pair of columns */
+        px += 2u;
+        pInB += 2u * numColsA;
+
+        /* Decrement the column loop counter */
+        col--;
+      }
+
+      /* If the columns of pSrcB is odd, compute the last column of the 2 rows here. */
+      if ((numColsB & 0x1u) != 0u)
+      {
+        c00 = 0;
+        c10 = 0;
+
+        pInA0 = pSrcA->pData + i;
+        pInA1 = pInA0 + numColsA;
+        pInB0 = pInB;
+
+        colCnt = numColsA >> 1u;
+
+        while (colCnt > 0u)
+        {
+          pSourceA1 = *__SIMD32(pInA0)++;
+          pSourceA2 = *__SIMD32(pInA1)++;
+          pSourceB1 = *__SIMD32(pInB0)++;
+
+          c00 = __SMLALD(pSourceA1, pSourceB1, c00);
+          c10 = __SMLALD(pSourceA2, pSourceB1, c10);
+
+          /* Decrement the loop counter */
+          colCnt--;
+        }
+
+        if ((numColsA & 0x1u) != 0u)
+        {
+          c00 += (q31_t) * pInA0 * *pInB0;
+          c10 += (q31_t) * pInA1 * *pInB0;
+        }
+
+        px[0] = (q15_t) (__SSAT((c00 >> 15), 16));
+        px[numColsB] = (q15_t) (__SSAT((c10 >> 15), 16));
+
+        px++;
+      }
+
+      /* Skip the second row of the block, already computed */
+      px += numColsB;
+      i = i + (2u * numColsA);
+
+      /* Decrement the row loop counter */
+      row--;
+    }
+
+    /* If the rows of pSrcA is odd, compute the last row here. */
+    if ((numRowsA & 0x1u) != 0u)
+    {
+      pInB = pSrcBT;
+
+      col = numColsB;
+
+      while (col > 0u)
+      {
+        /* Set the variable sum, that acts as accumulator, to zero */
+        sum = 0;
+
+        pInA = pSrcA->pData + i;
+
+        colCnt = numColsA >> 1u;
+
+        while (colCnt > 0u)
+        {
+          pSourceA1 = *__SIMD32(pInA)++;
+          pSourceB1 = *__SIMD32(pInB)++;
+
+          sum = __SMLALD(pSourceA1, pSourceB1, sum);
+
+          /* Decrement the loop counter */
+          colCnt--;
+        }
+
+        if ((numColsA & 0x1u) != 0u)
+        {
+          sum += *pInA * *pInB++;
+        }
+
+        /* Saturate and store the result in the destination buffer */
+        *px++ = (q15_t) (__SSAT((sum >> 15), 16));
+
+        /* Decrement the column loop counter */
+        col--;
+      }
+    }
+
+#else
+
     /* The following loop performs the dot-product of each row in pSrcA with each column in pSrcB */
     /* row loop */
     do
@@ -355,6 +518,8 @@ arm_status arm_mat_mult_q15(
 
     } while (row > 0u);
 
+#endif /* #ifndef UNALIGNED_SUPPORT_DISABLE */
+
 #else
 
   /* Run the below code for Cortex-M0 */
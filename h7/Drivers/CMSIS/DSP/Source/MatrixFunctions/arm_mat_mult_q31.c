@@ -82,9 +82,12 @@ arm_status arm_mat_mult_q31(
 
   /* Run the below code for Cortex-M4 and Cortex-M3 */
 
-  uint16_t col, i = 0u, j, row = numRowsA, colCnt;      /* loop counters */
+  q31_t *pInA0, *pInA1;                          /* pointers to two rows of matrix A */
+  q31_t *pInB;                                   /* input data matrix pointer B */
+  q31_t a0, a1, b0, b1;                          /* elements of matrices A and B */
+  q63_t c00, c01, c10, c11;                      /* accumulators of the 2 x 2 output block */
+  uint16_t col, row, colCnt;                     /* loop counters */
   arm_status status;                             /* status of matrix multiplication */
-  q31_t a0, a1, a2, a3, b0, b1, b2, b3;
 
 #ifdef ARM_MATH_MATRIX_CHECK
 
@@ -100,75 +103,129 @@ arm_status arm_mat_mult_q31(
 #endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
 
   {
-    /* The following loop performs the dot-product of each row in pSrcA with each column in pSrcB */
-    /* row loop */
-    do
-    {
-      /* Output pointer is set to starting address of the row being processed */
-      px = pOut + i;
+    /* The output is computed by blocks of 2 x 2 elements held in 64-bit accumulators,
+     ** which is as many as the core registers allow. Each element of A and B loaded
+     ** is used twice, halving the loads from memory compared to computing the
+     ** dot-products one output at a time. */
 
-      /* For every row wise process, the column loop counter is to be initiated */
-      col = numColsB;
+    /* Loop over the pairs of rows of pSrcA */
+    row = numRowsA >> 1u;
 
-      /* For every row wise process, the pIn2 pointer is set
-       ** to the starting address of the pSrcB data */
-      pIn2 = pSrcB->pData;
+    while (row > 0u)
+    {
+      /* Output pointer is set to starting address of the rows being processed */
+      px = pOut;
 
-      j = 0u;
+      /* Start from the first column of pSrcB */
+      pInB = pSrcB->pData;
 
-      /* column loop */
-      do
-      {
-        /* Set the variable sum, that acts as accumulator, to zero */
-        sum = 0;
+      /* Loop over the pairs of columns of pSrcB */
+      col = numColsB >> 1u;
 
-        /* Initiate the pointer pIn1 to point to the starting address of pInA */
-        pIn1 = pInA;
+      while (col > 0u)
+      {
+        /* Set the accumulators to zero */
+        c00 = 0;
+        c01 = 0;
+        c10 = 0;
+        c11 = 0;
 
-        /* Apply loop unrolling and compute 4 MACs simultaneously. */
-        colCnt = numColsA >> 2;
+        pInA0 = pInA;
+        pInA1 = pInA + numColsA;
+        pIn2 = pInB;
 
+        colCnt = numColsA;
 
-        /* matrix multiplication */
         while (colCnt > 0u)
         {
           /* c(m,n) = a(1,1)*b(1,1) + a(1,2) * b(2,1) + .... + a(m,p)*b(p,n) */
-          /* Perform the multiply-accumulates */
-          b0 = *pIn2;
+          b0 = pIn2[0];
+          b1 = pIn2[1];
           pIn2 += numColsB;
 
-          a0 = *pIn1++;
-          a1 = *pIn1++;
+          a0 = *pInA0++;
+          a1 = *pInA1++;
 
-          b1 = *pIn2;
-          pIn2 += numColsB;
-          b2 = *pIn2;
-          pIn2 += numColsB;
+          /* Perform the multiply-accumulates */
+          c00 += (q63_t) a0 *b0;
+          c01 += (q63_t) a0 *b1;
+          c10 += (q63_t) a1 *b0;
+          c11 += (q63_t) a1 *b1;
 
-          sum += (q63_t) a0 *b0;
-          sum += (q63_t) a1 *b1;
+          /* Decrement the loop counter */
+          colCnt--;
+        }
+
+        /* Convert the results from 2.62 to 1.31 format and store in destination buffer */
+        px[0] = (q31_t) (c00 >> 31);
+        px[1] = (q31_t) (c01 >> 31);
+        px[numColsB] = (q31_t) (c10 >> 31);
+        px[numColsB + 1u] = (q31_t) (c11 >> 31);
 
-          a2 = *pIn1++;
-          a3 = *pIn1++;
+        /* Next pair of columns */
+        px += 2u;
+        pInB += 2u;
 
-          b3 = *pIn2;
+        /* Decrement the column loop counter */
+        col--;
+      }
+
+      /* If the columns of pSrcB is odd, compute the last column of the 2 rows here. */
+      if ((numColsB & 0x1u) != 0u)
+      {
+        c00 = 0;
+        c10 = 0;
+
+        pInA0 = pInA;
+        pInA1 = pInA + numColsA;
+        pIn2 = pInB;
+
+        colCnt = numColsA;
+
+        while (colCnt > 0u)
+        {
+          b0 = *pIn2;
           pIn2 += numColsB;
 
-          sum += (q63_t) a2 *b2;
-          sum += (q63_t) a3 *b3;
+          c00 += (q63_t) * pInA0++ * b0;
+          c10 += (q63_t) * pInA1++ * b0;
 
           /* Decrement the loop counter */
           colCnt--;
         }
 
-        /* If the columns of pSrcA is not a multiple of 4, compute any remaining output samples here.
-         ** No loop unrolling is used. */
-        colCnt = numColsA % 0x4u;
+        px[0] = (q31_t) (c00 >> 31);
+        px[numColsB] = (q31_t) (c10 >> 31);
+      }
+
+      /* Update the pointers to the starting address of the next 2 rows */
+      pInA += 2u * numColsA;
+      pOut += 2u * numColsB;
+
+      /* Decrement the row loop counter */
+      row--;
+    }
+
+    /* If the rows of pSrcA is odd, compute the last row here. */
+    if ((numRowsA & 0x1u) != 0u)
+    {
+      px = pOut;
+      pInB = pSrcB->pData;
+
+      col = numColsB;
+
+      while (col > 0u)
+      {
+        /* Set the variable sum, that acts as accumulator, to zero */
+        sum = 0;
+
+        pIn1 = pInA;
+        pIn2 = pInB;
+
+        colCnt = numColsA;
 
         while (colCnt > 0u)
         {
-          /* c(m,n) = a(1,1)*b(1,1) + a(1,2) * b(2,1) + .... + a(m,p)*b(p,n) */
-          /* Perform the multiply-accumulates */
           sum += (q63_t) * pIn1++ * *pIn2;
           pIn2 += numColsB;
 
@@ -178,15 +235,16 @@ arm_status arm_mat_mult_q31(
 
         /* Convert the result from 2.62 to 1.31 format and store in destination buffer */
         *px++ = (q31_t) (sum >> 31);
-
-        /* Update the pointer pIn2 to point to the  starting address of the next column */
-        j++;
-        pIn2 = (pSrcB->pData) + j;
+        pInB++;
 
         /* Decrement the column loop counter */
         col--;
+      }
+    }
 
-      } while (col > 0u);
+    /* set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
 
 #else
 
@@ -259,8 +317,6 @@ arm_status arm_mat_mult_q31(
 
       } while (col > 0u);
 
-#endif
-
       /* Update the pointer pInA to point to the  starting address of the next row */
       i = i + numColsB;
       pInA = pInA + numColsA;
@@ -273,6 +329,9 @@ arm_status arm_mat_mult_q31(
     /* set status as ARM_MATH_SUCCESS */
     status = ARM_MATH_SUCCESS;
   }
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
   /* Return to application */
   return (status);
 }
@@ -0,0 +1,162 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_syrk_f32.c
+ * Description:  In-place symmetric rank-k update
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixSyrk Symmetric Rank-k Update
+ *
+ * Updates a symmetric matrix in place:
+ * <pre>
+ *     C = beta * C + alpha * A * A<sup>T</sup>
+ * </pre>
+ * A being n x k and C n x n, as in the covariance updates of estimation
+ * loops (for instance <code>P = P - K * K<sup>T</sup></code> with
+ * alpha = -1 and beta = 1). Only the lower triangle of C is computed, each
+ * element as the dot product of two rows of A, and copied to the upper
+ * triangle, which keeps C exactly symmetric. C must not overlap A.
+ */
+
+/**
+ * @addtogroup MatrixSyrk
+ * @{
+ */
+
+/**
+ * @brief Floating-point in-place symmetric rank-k update.
+ * @param[in]       *pSrc points to the n x k matrix structure A
+ * @param[in]       alpha scale of the product A * A^T
+ * @param[in]       beta scale of C
+ * @param[in,out]   *pDst points to the n x n symmetric matrix structure C
+ * @return     		The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if C is not square or if its size does not match the
+ * number of rows of A. Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.
+ */
+
+arm_status arm_mat_syrk_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  float32_t alpha,
+  float32_t beta,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pIn = pSrc->pData;                  /* input data matrix pointer */
+  float32_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  float32_t *pRowI, *pRowJ;                      /* rows i and j of A */
+  float32_t acc0;                                /* accumulator */
+#ifndef ARM_MATH_CM0_FAMILY
+  float32_t acc1, acc2, acc3;                    /* partial sums */
+#endif
+  uint32_t n = pSrc->numRows;                    /* size of C */
+  uint32_t kk = pSrc->numCols;                   /* rank of the update */
+  uint32_t i, j, k;                              /* loop counters */
+  arm_status status;                             /* status of the update */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pDst->numRows != pDst->numCols) || (pDst->numRows != pSrc->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    /* C(i,j) = beta * C(i,j) + alpha * (row i of A) . (row j of A), computed
+     * on the lower triangle and mirrored to the upper one. */
+    for (i = 0u; i < n; i++)
+    {
+      for (j = 0u; j <= i; j++)
+      {
+        pRowI = pIn + (i * kk);
+        pRowJ = pIn + (j * kk);
+        acc0 = 0.0f;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+      /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+      /* Four independent partial sums hide the latency of the FPU */
+      acc1 = 0.0f;
+      acc2 = 0.0f;
+      acc3 = 0.0f;
+
+      /* Loop unrolling */
+      k = kk >> 2u;
+      while(k > 0u)
+      {
+        acc0 += pRowI[0] * pRowJ[0];
+        acc1 += pRowI[1] * pRowJ[1];
+        acc2 += pRowI[2] * pRowJ[2];
+        acc3 += pRowI[3] * pRowJ[3];
+        pRowI += 4u;
+        pRowJ += 4u;
+        k--;
+      }
+
+      acc0 += (acc1 + acc2) + acc3;
+
+      /* Remaining 1 to 3 products */
+      k = kk % 0x4u;
+
+#else
+
+      /* Run the below code for Cortex-M0 */
+
+      k = kk;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+      while(k > 0u)
+      {
+        acc0 += *pRowI++ * *pRowJ++;
+        k--;
+      }
+
+        acc0 = (beta * pOut[(i * n) + j]) + (alpha * acc0);
+        pOut[(i * n) + j] = acc0;
+        pOut[(j * n) + i] = acc0;
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixSyrk group
+ */
@@ -0,0 +1,149 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_histogram_f32.c
+ * Description:  Histogram of a floating-point vector.
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup Histogram Histogram
+ *
+ * Counts the samples of a vector in <code>numBins</code> bins of equal width,
+ * adding the counts to a histogram, so that it can be accumulated over the
+ * blocks of a stream. The histogram must be cleared before the first block.
+ *
+ * \par
+ * The samples below the first bin are counted in the first bin, and the
+ * samples above the last bin in the last bin, so that the histogram always
+ * counts all the samples.
+ *
+ * \par
+ * The floating-point function takes the range of the bins. The fixed-point
+ * functions take the lower bound and the base-2 logarithm of the bin width,
+ * so that the bin of a sample is computed with a subtraction and a shift:
+ * <pre>
+ *     bin = (x - minValue) >> shift
+ * </pre>
+ * The Q15 function reads two samples at a time on Cortex-M3/M4/M7.
+ *
+ * \par
+ * There are separate functions for floating-point, Q31 and Q15 data types.
+ */
+
+/**
+ * @addtogroup Histogram
+ * @{
+ */
+
+/**
+ * @brief  Histogram of a floating-point vector.
+ * @param[in]     *pSrc points to the input vector.
+ * @param[in]     blockSize length of the input vector.
+ * @param[in]     minValue lower bound of the first bin.
+ * @param[in]     maxValue upper bound of the last bin, above minValue.
+ * @param[in]     numBins number of bins.
+ * @param[in,out] *pHist points to the numBins counts, incremented.
+ * @return none.
+ */
+
+void arm_histogram_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t minValue,
+  float32_t maxValue,
+  uint16_t numBins,
+  uint32_t * pHist)
+{
+  float32_t scale = (float32_t) numBins / (maxValue - minValue);  /* Bins per unit */
+  float32_t last = (float32_t) numBins - 1.0f;   /* Position of the last bin */
+  float32_t v0;                                  /* Position of a sample */
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t v1, v2, v3;                          /* Positions of the next samples */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* Position of the samples in the bins, clamped to the first and last bins */
+    v0 = (pSrc[0] - minValue) * scale;
+    v1 = (pSrc[1] - minValue) * scale;
+    v2 = (pSrc[2] - minValue) * scale;
+    v3 = (pSrc[3] - minValue) * scale;
+
+    v0 = (v0 > 0.0f) ? ((v0 < last) ? v0 : last) : 0.0f;
+    v1 = (v1 > 0.0f) ? ((v1 < last) ? v1 : last) : 0.0f;
+    v2 = (v2 > 0.0f) ? ((v2 < last) ? v2 : last) : 0.0f;
+    v3 = (v3 > 0.0f) ? ((v3 < last) ? v3 : last) : 0.0f;
+
+    pHist[(uint32_t) v0]++;
+    pHist[(uint32_t) v1]++;
+    pHist[(uint32_t) v2]++;
+    pHist[(uint32_t) v3]++;
+
+    pSrc += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    v0 = ((*pSrc++) - minValue) * scale;
+    v0 = (v0 > 0.0f) ? ((v0 < last) ? v0 : last) : 0.0f;
+    pHist[(uint32_t) v0]++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of Histogram group
+ */
@@ -0,0 +1,124 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_histogram_q15.c
+ * Description:  Histogram of a Q15 vector.
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Histogram
+ * @{
+ */
+
+/**
+ * @brief  Histogram of a Q15 vector.
+ * @param[in]     *pSrc points to the input vector.
+ * @param[in]     blockSize length of the input vector.
+ * @param[in]     minValue lower bound of the first bin.
+ * @param[in]     shift base-2 logarithm of the bin width, from 0 to 15.
+ * @param[in]     numBins number of bins.
+ * @param[in,out] *pHist points to the numBins counts, incremented.
+ * @return none.
+ */
+
+void arm_histogram_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t minValue,
+  uint8_t shift,
+  uint16_t numBins,
+  uint32_t * pHist)
+{
+  int32_t last = (int32_t) numBins - 1;          /* Last bin */
+  int32_t b0;                                    /* Bin of a sample */
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  int32_t b1;                                    /* Bin of the next sample */
+  q31_t in;                                      /* Two packed input samples */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 1u;
+
+  /* First part of the processing with loop unrolling.  Compute 2 outputs at a time.
+   ** a second loop below computes the remaining sample. */
+  while(blkCnt > 0u)
+  {
+    /* Read two samples at a time */
+    in = *__SIMD32(pSrc)++;
+
+#ifndef ARM_MATH_BIG_ENDIAN
+    b0 = ((int32_t) (q15_t) in - minValue) >> shift;
+    b1 = ((in >> 16) - minValue) >> shift;
+#else
+    b1 = ((int32_t) (q15_t) in - minValue) >> shift;
+    b0 = ((in >> 16) - minValue) >> shift;
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    /* Samples below the lower bound give negative bins */
+    b0 = (b0 > 0) ? ((b0 < last) ? b0 : last) : 0;
+    b1 = (b1 > 0) ? ((b1 < last) ? b1 : last) : 0;
+
+    pHist[b0]++;
+    pHist[b1]++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is odd, compute the remaining sample here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize & 0x1u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    b0 = ((int32_t) (*pSrc++) - minValue) >> shift;
+    b0 = (b0 > 0) ? ((b0 < last) ? b0 : last) : 0;
+    pHist[b0]++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of Histogram group
+ */
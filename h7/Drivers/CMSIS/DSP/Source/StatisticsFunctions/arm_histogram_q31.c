@@ -0,0 +1,117 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_histogram_q31.c
+ * Description:  Histogram of a Q31 vector.
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Histogram
+ * @{
+ */
+
+/**
+ * @brief  Histogram of a Q31 vector.
+ * @param[in]     *pSrc points to the input vector.
+ * @param[in]     blockSize length of the input vector.
+ * @param[in]     minValue lower bound of the first bin.
+ * @param[in]     shift base-2 logarithm of the bin width, from 0 to 31.
+ * @param[in]     numBins number of bins.
+ * @param[in,out] *pHist points to the numBins counts, incremented.
+ * @return none.
+ */
+
+void arm_histogram_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  q31_t minValue,
+  uint8_t shift,
+  uint16_t numBins,
+  uint32_t * pHist)
+{
+  uint32_t last = (uint32_t) numBins - 1u;       /* Last bin */
+  uint32_t b0;                                   /* Bin of a sample */
+  q31_t x0;                                      /* Input sample */
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  uint32_t b1;                                   /* Bin of the next sample */
+  q31_t x1;                                      /* Next input sample */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 1u;
+
+  /* First part of the processing with loop unrolling.  Compute 2 outputs at a time.
+   ** a second loop below computes the remaining sample. */
+  while(blkCnt > 0u)
+  {
+    x0 = *pSrc++;
+    x1 = *pSrc++;
+
+    /* The difference is positive when the sample is above the lower bound, and then fits 32 bits unsigned */
+    b0 = (x0 > minValue) ? (((uint32_t) x0 - (uint32_t) minValue) >> shift) : 0u;
+    b1 = (x1 > minValue) ? (((uint32_t) x1 - (uint32_t) minValue) >> shift) : 0u;
+
+    pHist[(b0 < last) ? b0 : last]++;
+    pHist[(b1 < last) ? b1 : last]++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is odd, compute the remaining sample here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize & 0x1u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    x0 = *pSrc++;
+    b0 = (x0 > minValue) ? (((uint32_t) x0 - (uint32_t) minValue) >> shift) : 0u;
+    pHist[(b0 < last) ? b0 : last]++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of Histogram group
+ */
@@ -0,0 +1,84 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_percentile_filter_init_q15.c
+ * Description:  Initialization function for the Q15 sliding-window percentile filter.
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Percentile
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 sliding-window percentile filter.
+ * @param[out]    *S points to an instance of the Q15 percentile filter structure.
+ * @param[in]     windowLength number of samples in the window.
+ * @param[in]     rank order statistic output, from 0 (minimum) to windowLength-1 (maximum).
+ * @param[in]     initValue value the window is initially filled with.
+ * @param[in]     *pState points to the window buffer of windowLength samples.
+ * @param[in]     *pIndex points to the heap buffer of 2*windowLength indexes.
+ * @return        The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR
+ * if windowLength is zero or if rank is not below it.
+ */
+
+arm_status arm_percentile_filter_init_q15(
+  arm_percentile_instance_q15 * S,
+  uint16_t windowLength,
+  uint16_t rank,
+  q15_t initValue,
+  q15_t * pState,
+  uint16_t * pIndex)
+{
+  uint32_t i;                                    /* Loop counter */
+
+  if((windowLength == 0u) || (rank >= windowLength))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->windowLength = windowLength;
+  S->rank = rank;
+  S->index = 0u;
+  S->pState = pState;
+  S->pIndex = pIndex;                            /* Equal samples make valid heaps in any order */
+  for (i = 0u; i < windowLength; i++)
+  {
+    pState[i] = initValue;
+    pIndex[i] = (uint16_t) i;
+    pIndex[windowLength + i] = (uint16_t) i;
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Percentile group
+ */
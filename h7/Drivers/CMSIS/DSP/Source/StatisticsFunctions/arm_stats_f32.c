@@ -0,0 +1,85 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_f32.c
+ * Description:  Mean, variance, root mean square, minimum and maximum of a floating-point vector in a single pass.
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup Stats Batch Statistics
+ *
+ * Computes the mean, variance, root mean square, minimum and maximum of a vector in a single
+ * pass over the data, with the same algorithms as <code>arm_mean</code>, <code>arm_var</code>,
+ * <code>arm_rms</code>, <code>arm_min</code> and <code>arm_max</code>:
+ * <pre>
+ *     mean = sum / blockSize
+ *     var  = (sumOfSquares - sum<sup>2</sup> / blockSize) / (blockSize - 1)
+ *     rms  = sqrt(sumOfSquares / blockSize)
+ * </pre>
+ * The minimum and maximum are returned with the index of their first occurrence.
+ *
+ * The functions can be used in two ways:
+ * - <code>arm_stats_f32()</code> computes the statistics of one buffer;
+ * - <code>arm_stats_init_f32()</code>, <code>arm_stats_update_f32()</code> and <code>arm_stats_get_f32()</code>
+ *   accumulate the sums and extrema across a stream of blocks held in an instance structure,
+ *   the results being available at any time and the indexes counting from the first sample
+ *   since the initialization.
+ *
+ * There are separate functions for floating point, Q31, and Q15 data types.
+ */
+
+/**
+ * @addtogroup Stats
+ * @{
+ */
+
+/**
+ * @brief Statistics of the elements of a floating-point vector.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       blockSize length of the input vector
+ * @param[out]      *pResult statistics returned here
+ * @return none.
+ */
+
+void arm_stats_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_f32 * pResult)
+{
+  arm_stats_instance_f32 S;                      /* Accumulators */
+
+  arm_stats_init_f32(&S);
+  arm_stats_update_f32(&S, pSrc, blockSize);
+  arm_stats_get_f32(&S, pResult);
+}
+
+/**
+ * @} end of Stats group
+ */
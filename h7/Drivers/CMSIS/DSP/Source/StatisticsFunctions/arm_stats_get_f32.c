@@ -0,0 +1,87 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_get_f32.c
+ * Description:  Results of the floating-point batch statistics.
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Stats
+ * @{
+ */
+
+/**
+ * @brief Results of the floating-point batch statistics.
+ * @param[in]       *S points to an instance of the floating-point statistics structure.
+ * @param[out]      *pResult statistics of the samples accumulated since the initialization
+ * @return none.
+ *
+ * \par
+ * All results are zero when no sample has been accumulated, and the variance is zero
+ * for a single sample.
+ */
+
+void arm_stats_get_f32(
+  const arm_stats_instance_f32 * S,
+  arm_stats_result_f32 * pResult)
+{
+  float32_t count = (float32_t) S->count;        /* Number of samples */
+
+  if(S->count == 0u)
+  {
+    pResult->mean = 0.0f;
+    pResult->var = 0.0f;
+    pResult->rms = 0.0f;
+  }
+  else
+  {
+    pResult->mean = S->sum / count;
+
+    if(S->count == 1u)
+    {
+      pResult->var = 0.0f;
+    }
+    else
+    {
+      pResult->var = (S->sumOfSquares - ((S->sum * S->sum) / count)) / (count - 1.0f);
+    }
+
+    arm_sqrt_f32(S->sumOfSquares / count, &pResult->rms);
+  }
+
+  pResult->min = S->min;
+  pResult->max = S->max;
+  pResult->minIndex = S->minIndex;
+  pResult->maxIndex = S->maxIndex;
+}
+
+/**
+ * @} end of Stats group
+ */
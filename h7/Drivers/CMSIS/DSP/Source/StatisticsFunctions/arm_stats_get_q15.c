@@ -0,0 +1,97 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_get_q15.c
+ * Description:  Results of the Q15 batch statistics.
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Stats
+ * @{
+ */
+
+/**
+ * @brief Results of the Q15 batch statistics.
+ * @param[in]       *S points to an instance of the Q15 statistics structure.
+ * @param[out]      *pResult statistics of the samples accumulated since the initialization
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The sum and the sum of squares are accumulated in 64 bits, in 49.15 and 34.30 formats,
+ * and there is no risk of overflow. The variance and the mean square are converted to 1.15
+ * format, and the root mean square is computed by <code>arm_sqrt_q15()</code>.
+ * \par
+ * All results are zero when no sample has been accumulated, and the variance is zero
+ * for a single sample.
+ */
+
+void arm_stats_get_q15(
+  const arm_stats_instance_q15 * S,
+  arm_stats_result_q15 * pResult)
+{
+  q63_t count = (q63_t) S->count;                /* Number of samples */
+  q63_t squareOfSum;                             /* Square of the sum divided by the number of samples */
+
+  if(S->count == 0u)
+  {
+    pResult->mean = 0;
+    pResult->var = 0;
+    pResult->rms = 0;
+  }
+  else
+  {
+    pResult->mean = (q15_t) (S->sum / count);
+
+    if(S->count == 1u)
+    {
+      pResult->var = 0;
+    }
+    else
+    {
+      /* The mean is computed first to keep the product in 64 bits: sum * sum / count */
+      squareOfSum = (S->sum / count) * S->sum;
+
+      /* Convert the result from 34.30 to 1.15 format */
+      pResult->var = (q15_t) __SSAT(((S->sumOfSquares - squareOfSum) / (count - 1)) >> 15, 16);
+    }
+
+    arm_sqrt_q15((q15_t) __SSAT((S->sumOfSquares / count) >> 15, 16), &pResult->rms);
+  }
+
+  pResult->min = S->min;
+  pResult->max = S->max;
+  pResult->minIndex = S->minIndex;
+  pResult->maxIndex = S->maxIndex;
+}
+
+/**
+ * @} end of Stats group
+ */
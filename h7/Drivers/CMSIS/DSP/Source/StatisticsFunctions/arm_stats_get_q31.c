@@ -0,0 +1,101 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_get_q31.c
+ * Description:  Results of the Q31 batch statistics.
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Stats
+ * @{
+ */
+
+/**
+ * @brief Results of the Q31 batch statistics.
+ * @param[in]       *S points to an instance of the Q31 statistics structure.
+ * @param[out]      *pResult statistics of the samples accumulated since the initialization
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The sum is accumulated in 64 bits at full precision, giving the same mean as <code>arm_mean_q31()</code>.
+ * As in <code>arm_var_q31()</code>, the squares are computed on the inputs truncated to 9.23 format
+ * and accumulated in 64 bits in 18.46 format, which bounds the number of full scale samples
+ * accumulated to 2<sup>17</sup>. The variance and the mean square are then converted to 1.31 format,
+ * and the root mean square is computed by <code>arm_sqrt_q31()</code>.
+ * \par
+ * All results are zero when no sample has been accumulated, and the variance is zero
+ * for a single sample.
+ */
+
+void arm_stats_get_q31(
+  const arm_stats_instance_q31 * S,
+  arm_stats_result_q31 * pResult)
+{
+  q63_t count = (q63_t) S->count;                /* Number of samples */
+  q63_t sum23;                                   /* Sum of the samples in 9.23 format */
+  q63_t squareOfSum;                             /* Square of the sum divided by the number of samples */
+
+  if(S->count == 0u)
+  {
+    pResult->mean = 0;
+    pResult->var = 0;
+    pResult->rms = 0;
+  }
+  else
+  {
+    pResult->mean = (q31_t) (S->sum / count);
+
+    if(S->count == 1u)
+    {
+      pResult->var = 0;
+    }
+    else
+    {
+      /* The mean is computed first to keep the product in 64 bits: sum * sum / count */
+      sum23 = S->sum >> 8;
+      squareOfSum = (sum23 / count) * sum23;
+
+      /* Convert the result from 18.46 to 1.31 format */
+      pResult->var = (q31_t) (((S->sumOfSquares - squareOfSum) / (count - 1)) >> 15);
+    }
+
+    arm_sqrt_q31(clip_q63_to_q31((S->sumOfSquares / count) >> 15), &pResult->rms);
+  }
+
+  pResult->min = S->min;
+  pResult->max = S->max;
+  pResult->minIndex = S->minIndex;
+  pResult->maxIndex = S->maxIndex;
+}
+
+/**
+ * @} end of Stats group
+ */
@@ -0,0 +1,61 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_init_q31.c
+ * Description:  Initialization function for the Q31 batch statistics.
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Stats
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 batch statistics.
+ * @param[out]      *S points to an instance of the Q31 statistics structure.
+ * @return none.
+ */
+
+void arm_stats_init_q31(
+  arm_stats_instance_q31 * S)
+{
+  /* Clear the accumulators, the extrema are set by the first sample */
+  S->count = 0u;
+  S->sum = 0;
+  S->sumOfSquares = 0;
+  S->min = 0;
+  S->max = 0;
+  S->minIndex = 0u;
+  S->maxIndex = 0u;
+}
+
+/**
+ * @} end of Stats group
+ */
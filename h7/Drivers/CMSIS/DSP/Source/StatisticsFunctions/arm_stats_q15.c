@@ -0,0 +1,62 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_q15.c
+ * Description:  Mean, variance, root mean square, minimum and maximum of a Q15 vector in a single pass.
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Stats
+ * @{
+ */
+
+/**
+ * @brief Statistics of the elements of a Q15 vector.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       blockSize length of the input vector
+ * @param[out]      *pResult statistics returned here
+ * @return none.
+ */
+
+void arm_stats_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_q15 * pResult)
+{
+  arm_stats_instance_q15 S;                      /* Accumulators */
+
+  arm_stats_init_q15(&S);
+  arm_stats_update_q15(&S, pSrc, blockSize);
+  arm_stats_get_q15(&S, pResult);
+}
+
+/**
+ * @} end of Stats group
+ */
@@ -0,0 +1,62 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_q31.c
+ * Description:  Mean, variance, root mean square, minimum and maximum of a Q31 vector in a single pass.
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Stats
+ * @{
+ */
+
+/**
+ * @brief Statistics of the elements of a Q31 vector.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       blockSize length of the input vector
+ * @param[out]      *pResult statistics returned here
+ * @return none.
+ */
+
+void arm_stats_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  arm_stats_result_q31 * pResult)
+{
+  arm_stats_instance_q31 S;                      /* Accumulators */
+
+  arm_stats_init_q31(&S);
+  arm_stats_update_q31(&S, pSrc, blockSize);
+  arm_stats_get_q31(&S, pResult);
+}
+
+/**
+ * @} end of Stats group
+ */
@@ -0,0 +1,198 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_update_f32.c
+ * Description:  Accumulates a block of a floating-point stream into the batch statistics.
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Stats
+ * @{
+ */
+
+/**
+ * @brief Accumulates a block of a floating-point stream into the batch statistics.
+ * @param[in,out]   *S points to an instance of the floating-point statistics structure.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       blockSize length of the input vector
+ * @return none.
+ */
+
+void arm_stats_update_f32(
+  arm_stats_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize)
+{
+  float32_t sum = S->sum;                        /* Sum of the samples */
+  float32_t sumOfSquares = S->sumOfSquares;      /* Sum of squares */
+  float32_t minVal, maxVal;                      /* Extrema of the stream */
+  uint32_t minIdx, maxIdx;                       /* Indexes of the extrema */
+  uint32_t idx = S->count;                       /* Index of the current sample in the stream */
+  float32_t in;                                  /* input value */
+  uint32_t blkCnt;                               /* loop counter */
+
+  if(blockSize == 0u)
+  {
+    return;
+  }
+
+  /* The first sample of the stream initializes the extrema */
+  if(idx == 0u)
+  {
+    S->min = pSrc[0];
+    S->max = pSrc[0];
+  }
+
+  minVal = S->min;
+  maxVal = S->max;
+  minIdx = S->minIndex;
+  maxIdx = S->maxIndex;
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* Accumulate the sum and the sum of squares, and compare with the extrema */
+    in = pSrc[0];
+    sum += in;
+    sumOfSquares += in * in;
+    if(in < minVal)
+    {
+      minVal = in;
+      minIdx = idx;
+    }
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIdx = idx;
+    }
+
+    in = pSrc[1];
+    sum += in;
+    sumOfSquares += in * in;
+    if(in < minVal)
+    {
+      minVal = in;
+      minIdx = idx + 1u;
+    }
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIdx = idx + 1u;
+    }
+
+    in = pSrc[2];
+    sum += in;
+    sumOfSquares += in * in;
+    if(in < minVal)
+    {
+      minVal = in;
+      minIdx = idx + 2u;
+    }
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIdx = idx + 2u;
+    }
+
+    in = pSrc[3];
+    sum += in;
+    sumOfSquares += in * in;
+    if(in < minVal)
+    {
+      minVal = in;
+      minIdx = idx + 3u;
+    }
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIdx = idx + 3u;
+    }
+
+    pSrc += 4u;
+    idx += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+    sum += in;
+    sumOfSquares += in * in;
+    if(in < minVal)
+    {
+      minVal = in;
+      minIdx = idx;
+    }
+    if(in > maxVal)
+    {
+      maxVal = in;
+      maxIdx = idx;
+    }
+
+    idx++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Store the accumulators back into the instance */
+  S->count = idx;
+  S->sum = sum;
+  S->sumOfSquares = sumOfSquares;
+  S->min = minVal;
+  S->max = maxVal;
+  S->minIndex = minIdx;
+  S->maxIndex = maxIdx;
+}
+
+/**
+ * @} end of Stats group
+ */
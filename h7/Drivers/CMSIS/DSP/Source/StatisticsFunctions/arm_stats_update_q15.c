@@ -0,0 +1,200 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_update_q15.c
+ * Description:  Accumulates a block of a Q15 stream into the batch statistics.
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup Stats
+ * @{
+ */
+
+/**
+ * @brief Accumulates a block of a Q15 stream into the batch statistics.
+ * @param[in,out]   *S points to an instance of the Q15 statistics structure.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       blockSize length of the input vector
+ * @return none.
+ */
+
+void arm_stats_update_q15(
+  arm_stats_instance_q15 * S,
+  q15_t * pSrc,
+  uint32_t blockSize)
+{
+  q63_t sumOfSquares = S->sumOfSquares;          /* Sum of squares, in 34.30 format */
+  q31_t sum = 0;                                 /* Sum of the samples of the block */
+  q15_t minVal, maxVal;                          /* Extrema of the stream */
+  uint32_t minIdx, maxIdx;                       /* Indexes of the extrema */
+  uint32_t idx = S->count;                       /* Index of the current sample in the stream */
+  q15_t in1;                                     /* input value */
+  uint32_t blkCnt;                               /* loop counter */
+
+#if defined (ARM_MATH_DSP)
+  q31_t in;                                      /* two packed input values */
+  q15_t in2;                                     /* input value */
+#endif
+
+  if(blockSize == 0u)
+  {
+    return;
+  }
+
+  /* The first sample of the stream initializes the extrema */
+  if(idx == 0u)
+  {
+    S->min = pSrc[0];
+    S->max = pSrc[0];
+  }
+
+  minVal = S->min;
+  maxVal = S->max;
+  minIdx = S->minIndex;
+  maxIdx = S->maxIndex;
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  blkCnt = blockSize >> 1u;
+
+  /* First part of the processing, two samples at a time with the dual multiply-accumulate.
+   ** The sum of the block stays in 32 bits for up to 65536 samples. */
+  while(blkCnt > 0u)
+  {
+    in = *__SIMD32(pSrc)++;
+
+    /* Sum of squares of both samples */
+    sumOfSquares = __SMLALD(in, in, sumOfSquares);
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+    in1 = (q15_t) in;
+    in2 = (q15_t) (in >> 16);
+
+#else
+
+    in1 = (q15_t) (in >> 16);
+    in2 = (q15_t) in;
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    sum += in1;
+    sum += in2;
+
+    /* Compare with the extrema */
+    if(in1 < minVal)
+    {
+      minVal = in1;
+      minIdx = idx;
+    }
+    if(in1 > maxVal)
+    {
+      maxVal = in1;
+      maxIdx = idx;
+    }
+    if(in2 < minVal)
+    {
+      minVal = in2;
+      minIdx = idx + 1u;
+    }
+    if(in2 > maxVal)
+    {
+      maxVal = in2;
+      maxIdx = idx + 1u;
+    }
+
+    idx += 2u;
+
+    /* Flush the 32-bit sum into the 64-bit accumulator every 16384 pairs */
+    if((blkCnt & 0x3FFFu) == 0u)
+    {
+      S->sum += sum;
+      sum = 0;
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is odd, compute the last sample here. */
+  blkCnt = blockSize & 0x1u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while(blkCnt > 0u)
+  {
+    in1 = *pSrc++;
+    sum += in1;
+    sumOfSquares += ((q31_t) in1 * in1);
+    if(in1 < minVal)
+    {
+      minVal = in1;
+      minIdx = idx;
+    }
+    if(in1 > maxVal)
+    {
+      maxVal = in1;
+      maxIdx = idx;
+    }
+
+    idx++;
+
+    /* Flush the 32-bit sum into the 64-bit accumulator */
+    if((blkCnt & 0xFFFFu) == 0u)
+    {
+      S->sum += sum;
+      sum = 0;
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Store the accumulators back into the instance */
+  S->count = idx;
+  S->sum += sum;
+  S->sumOfSquares = sumOfSquares;
+  S->min = minVal;
+  S->max = maxVal;
+  S->minIndex = minIdx;
+  S->maxIndex = maxIdx;
+}
+
+/**
+ * @} end of Stats group
+ */
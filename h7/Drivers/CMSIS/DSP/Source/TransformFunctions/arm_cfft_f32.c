@@ -35,6 +35,10 @@ extern void arm_radix8_butterfly_f32(
     const float32_t * pCoef,
     uint16_t twidCoefModifier);
 
+extern void arm_cfft_mixed_radix_f32(
+    const arm_cfft_instance_f32 * S,
+    float32_t * p1);
+
 extern void arm_bitreversal_32(
     uint32_t * pSrc,
     const uint16_t bitRevLen,
@@ -71,6 +75,11 @@ extern void arm_bitreversal_32(
 * The algorithm supports lengths of [16, 32, 64, ..., 4096] and each length uses
 * a different twiddle factor table.
 * \par
+* The lengths [500, 600, 768, 1000, 1200, 1536] are computed by radix-2, radix-3,
+* radix-4 and radix-5 stages instead.  They use the same instance structure,
+* <code>pBitRevTable</code> then restoring the natural order of the digit
+* reversed output.
+* \par
 * The function uses the standard FFT definition and output values may grow by a
 * factor of <code>fftLen</code> when computing the forward transform.  The
 * inverse transform includes a scale of <code>1/fftLen</code> as part of the
@@ -596,6 +605,14 @@ void arm_cfft_f32(
     case 4096:
         arm_radix8_butterfly_f32( p1, L, (float32_t *) S->pTwiddle, 1);
         break;
+    case 500:
+    case 600:
+    case 768:
+    case 1000:
+    case 1200:
+    case 1536:
+        arm_cfft_mixed_radix_f32( S, p1);
+        break;
     }
 
     if ( bitReverseFlag )
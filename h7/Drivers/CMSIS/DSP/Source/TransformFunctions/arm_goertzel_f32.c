@@ -0,0 +1,183 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_f32.c
+ * Description:  Floating-point multi-bin Goertzel tone detection
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point multi-bin Goertzel.
+ * @param[in,out] *S points to an instance of the floating-point Goertzel structure.
+ * @param[in]     *pSrc points to the block of input samples.
+ * @param[in]     blockSize number of samples to process.
+ * @return none.
+ *
+ * The state of the recursions is kept between calls, until arm_goertzel_get_f32().
+ */
+
+void arm_goertzel_f32(
+  arm_goertzel_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* state pointer */
+  const float32_t *pCoeffs = S->pCoeffs;         /* coefficient pointer */
+  float32_t s0, s1, s2;                          /* states of a bin */
+  float32_t c0;                                  /* coefficient of a bin */
+  uint32_t numBins = S->numBins;                 /* number of bins */
+  uint32_t i, n;                                 /* loop counters */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  float32_t x;                                   /* input sample */
+  float32_t t0, t1, t2;                          /* states of the second bin */
+  float32_t c1;                                  /* coefficient of the second bin */
+
+  /* Two bins at a time over the whole block, their recursions being
+   * independent, with the states kept in registers */
+  for (i = 0u; (i + 1u) < numBins; i += 2u)
+  {
+    c0 = pCoeffs[(3u * i)];
+    c1 = pCoeffs[(3u * i) + 3u];
+    s1 = pState[(2u * i)];
+    s2 = pState[(2u * i) + 1u];
+    t1 = pState[(2u * i) + 2u];
+    t2 = pState[(2u * i) + 3u];
+
+    for (n = 0u; n < blockSize; n++)
+    {
+      x = pSrc[n];
+      s0 = (x + (c0 * s1)) - s2;
+      t0 = (x + (c1 * t1)) - t2;
+      s2 = s1;
+      s1 = s0;
+      t2 = t1;
+      t1 = t0;
+    }
+
+    pState[(2u * i)] = s1;
+    pState[(2u * i) + 1u] = s2;
+    pState[(2u * i) + 2u] = t1;
+    pState[(2u * i) + 3u] = t2;
+  }
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  i = 0u;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  /* Remaining bin */
+  for (; i < numBins; i++)
+  {
+    c0 = pCoeffs[(3u * i)];
+    s1 = pState[(2u * i)];
+    s2 = pState[(2u * i) + 1u];
+
+    for (n = 0u; n < blockSize; n++)
+    {
+      s0 = (pSrc[n] + (c0 * s1)) - s2;
+      s2 = s1;
+      s1 = s0;
+    }
+
+    pState[(2u * i)] = s1;
+    pState[(2u * i) + 1u] = s2;
+  }
+}
+
+/**
+ * @brief Per-sample processing function for the floating-point multi-bin Goertzel.
+ * @param[in,out] *S points to an instance of the floating-point Goertzel structure.
+ * @param[in]     x input sample.
+ * @return none.
+ */
+
+void arm_goertzel_sample_f32(
+  arm_goertzel_instance_f32 * S,
+  float32_t x)
+{
+  float32_t *pState = S->pState;                 /* state pointer */
+  const float32_t *pCoeffs = S->pCoeffs;         /* coefficient pointer */
+  float32_t s0;                                  /* new state */
+  uint32_t i;                                    /* loop counter */
+
+  for (i = 0u; i < S->numBins; i++)
+  {
+    s0 = (x + (pCoeffs[0] * pState[0])) - pState[1];
+    pState[1] = pState[0];
+    pState[0] = s0;
+    pCoeffs += 3u;
+    pState += 2u;
+  }
+}
+
+/**
+ * @brief End of block function for the floating-point multi-bin Goertzel.
+ * @param[in,out] *S points to an instance of the floating-point Goertzel structure.
+ * @param[out]    *pDst points to the numBins complex results, in interleaved fashion (real, imag).
+ * @return none.
+ *
+ * The state of the recursions is cleared for the next block.
+ */
+
+void arm_goertzel_get_f32(
+  arm_goertzel_instance_f32 * S,
+  float32_t * pDst)
+{
+  float32_t *pState = S->pState;                 /* state pointer */
+  const float32_t *pCoeffs = S->pCoeffs;         /* coefficient pointer */
+  uint32_t i;                                    /* loop counter */
+
+  for (i = 0u; i < S->numBins; i++)
+  {
+    /* X = (cos(w) * s[N-1] - s[N-2]) + j * sin(w) * s[N-1] */
+    pDst[0] = (pCoeffs[1] * pState[0]) - pState[1];
+    pDst[1] = pCoeffs[2] * pState[0];
+    pState[0] = 0.0f;
+    pState[1] = 0.0f;
+    pCoeffs += 3u;
+    pState += 2u;
+    pDst += 2u;
+  }
+}
+
+/**
+ * @} end of Goertzel group
+ */
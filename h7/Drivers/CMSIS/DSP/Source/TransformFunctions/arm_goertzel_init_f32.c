@@ -0,0 +1,133 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_init_f32.c
+ * Description:  Initialization function for the floating-point multi-bin Goertzel
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup Goertzel Goertzel Tone Detection
+ *
+ * Computes a few bins of the discrete Fourier transform of a block of
+ * samples, as a cheaper alternative to a full FFT when only some frequencies
+ * are watched (line harmonics, DTMF, pilot tones). Each bin costs one
+ * multiply-accumulate per sample, and the frequencies need not be
+ * integer bins nor the block length a power of two.
+ *
+ * \par Algorithm
+ * Each bin of normalized frequency <code>f</code> (cycles per sample,
+ * <code>w = 2 * pi * f</code>) runs the second order recursion
+ * <pre>
+ *     s[n] = x[n] + 2 * cos(w) * s[n-1] - s[n-2]
+ * </pre>
+ * over the samples of the block. At the end of the block the result is
+ * <pre>
+ *     X = (cos(w) * s[N-1] - s[N-2]) + j * sin(w) * s[N-1]
+ * </pre>
+ * which equals the DFT <code>sum(x[n] * e<sup>-j*w*n</sup>)</code> multiplied
+ * by <code>e<sup>j*w*N</sup></code>, hence exactly the DFT bin X[k] when
+ * <code>f = k / N</code>. The power of the bin is given by
+ * arm_cmplx_mag_squared_f32() on the results.
+ *
+ * \par
+ * Samples are fed per block with arm_goertzel_f32() or one at a time with
+ * arm_goertzel_sample_f32(), in any number of calls, and the block ends with
+ * arm_goertzel_get_f32(), which writes the bins and restarts the recursion.
+ * All the bins are updated together for each sample, two at a time on
+ * Cortex-M3/M4/M7.
+ *
+ * \par Instance Structure
+ * The coefficients and state of the recursions are stored in an instance
+ * data structure, initialized by arm_goertzel_init_f32() or
+ * arm_goertzel_init_q31().
+ *
+ * \par Fixed-Point Behavior
+ * The Q31 state grows with the block length: the input samples are shifted
+ * right by <code>inputShift</code> bits, which must ensure
+ * <code>N / |sin(w)| * 2<sup>-inputShift</sup> < 1</code> for a full scale
+ * sine input, and the results are in 1.31 format scaled by
+ * <code>2<sup>-inputShift</sup></code>.
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point multi-bin Goertzel.
+ * @param[in,out] *S points to an instance of the floating-point Goertzel structure.
+ * @param[in]     numBins number of frequencies analyzed.
+ * @param[in]     *pFreq points to the numBins normalized frequencies, in cycles per sample, in [0 0.5].
+ * @param[in]     *pCoeffs points to the coefficient buffer of 3*numBins values, filled by the function.
+ * @param[in]     *pState points to the state buffer of 2*numBins values.
+ * @return        The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR
+ * if a frequency is outside [0 0.5].
+ *
+ * The coefficients are computed in double precision with the C library.
+ */
+
+arm_status arm_goertzel_init_f32(
+  arm_goertzel_instance_f32 * S,
+  uint16_t numBins,
+  const float32_t * pFreq,
+  float32_t * pCoeffs,
+  float32_t * pState)
+{
+  float64_t w;                                   /* angular frequency */
+  uint32_t i;                                    /* loop counter */
+
+  for (i = 0u; i < numBins; i++)
+  {
+    if((pFreq[i] < 0.0f) || (pFreq[i] > 0.5f))
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    /* 2 * cos(w), cos(w) and sin(w) of each bin */
+    w = 6.28318530717958647692 * (float64_t) pFreq[i];
+    pCoeffs[(3u * i)] = (float32_t) (2.0 * cos(w));
+    pCoeffs[(3u * i) + 1u] = (float32_t) cos(w);
+    pCoeffs[(3u * i) + 2u] = (float32_t) sin(w);
+  }
+
+  S->numBins = numBins;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+
+  /* Clear the state of the recursions */
+  memset(pState, 0, (2u * numBins) * sizeof(float32_t));
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Goertzel group
+ */
@@ -0,0 +1,97 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_init_q31.c
+ * Description:  Initialization function for the Q31 multi-bin Goertzel
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 multi-bin Goertzel.
+ * @param[in,out] *S points to an instance of the Q31 Goertzel structure.
+ * @param[in]     numBins number of frequencies analyzed.
+ * @param[in]     *pFreq points to the numBins normalized frequencies, in 1.31 format, in [0 0.5].
+ * @param[in]     *pCoeffs points to the coefficient buffer of 2*numBins values, filled by the function.
+ * @param[in]     *pState points to the state buffer of 2*numBins values.
+ * @param[in]     inputShift right shift applied to the input samples.
+ * @return        The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR
+ * if a frequency is outside [0 0.5] or if inputShift is above 31.
+ *
+ * The coefficients cos(w) and sin(w) are computed in double precision with the
+ * C library, in 1.31 format; cos(w) in 1.31 format is also 2 * cos(w) in 2.30 format.
+ */
+
+arm_status arm_goertzel_init_q31(
+  arm_goertzel_instance_q31 * S,
+  uint16_t numBins,
+  const q31_t * pFreq,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  uint8_t inputShift)
+{
+  float64_t w;                                   /* angular frequency */
+  uint32_t i;                                    /* loop counter */
+
+  if(inputShift > 31u)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (i = 0u; i < numBins; i++)
+  {
+    if((pFreq[i] < 0) || (pFreq[i] > 0x40000000))
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    /* cos(w) and sin(w) of each bin, saturated to +1 */
+    w = 6.28318530717958647692 * ((float64_t) pFreq[i] / 2147483648.0);
+    pCoeffs[(2u * i)] = clip_q63_to_q31((q63_t) (cos(w) * 2147483648.0));
+    pCoeffs[(2u * i) + 1u] = clip_q63_to_q31((q63_t) (sin(w) * 2147483648.0));
+  }
+
+  S->numBins = numBins;
+  S->inputShift = inputShift;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+
+  /* Clear the state of the recursions */
+  memset(pState, 0, (2u * numBins) * sizeof(q31_t));
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of Goertzel group
+ */
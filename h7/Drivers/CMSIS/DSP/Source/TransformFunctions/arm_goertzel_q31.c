@@ -0,0 +1,193 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_q31.c
+ * Description:  Q31 multi-bin Goertzel tone detection
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup Goertzel
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 multi-bin Goertzel.
+ * @param[in,out] *S points to an instance of the Q31 Goertzel structure.
+ * @param[in]     *pSrc points to the block of input samples.
+ * @param[in]     blockSize number of samples to process.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The input is shifted right by <code>inputShift</code> bits. The products
+ * by the coefficient 2 * cos(w), in 2.30 format, are computed in 64 bits; the states wrap around
+ * if the headroom given by <code>inputShift</code> is too small.
+ * The state of the recursions is kept between calls, until arm_goertzel_get_q31().
+ */
+
+void arm_goertzel_q31(
+  arm_goertzel_instance_q31 * S,
+  q31_t * pSrc,
+  uint32_t blockSize)
+{
+  q31_t *pState = S->pState;                     /* state pointer */
+  const q31_t *pCoeffs = S->pCoeffs;             /* coefficient pointer */
+  uint32_t shift = S->inputShift;                /* input scaling */
+  q31_t x;                                       /* scaled input sample */
+  q31_t s0, s1, s2;                              /* states of a bin */
+  q31_t c0;                                      /* coefficient of a bin */
+  uint32_t numBins = S->numBins;                 /* number of bins */
+  uint32_t i, n;                                 /* loop counters */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q31_t t0, t1, t2;                              /* states of the second bin */
+  q31_t c1;                                      /* coefficient of the second bin */
+
+  /* Two bins at a time over the whole block, their recursions being
+   * independent, with the states kept in registers */
+  for (i = 0u; (i + 1u) < numBins; i += 2u)
+  {
+    c0 = pCoeffs[(2u * i)];
+    c1 = pCoeffs[(2u * i) + 2u];
+    s1 = pState[(2u * i)];
+    s2 = pState[(2u * i) + 1u];
+    t1 = pState[(2u * i) + 2u];
+    t2 = pState[(2u * i) + 3u];
+
+    for (n = 0u; n < blockSize; n++)
+    {
+      x = pSrc[n] >> shift;
+      s0 = (q31_t) (((q63_t) c0 * s1) >> 30) + (x - s2);
+      t0 = (q31_t) (((q63_t) c1 * t1) >> 30) + (x - t2);
+      s2 = s1;
+      s1 = s0;
+      t2 = t1;
+      t1 = t0;
+    }
+
+    pState[(2u * i)] = s1;
+    pState[(2u * i) + 1u] = s2;
+    pState[(2u * i) + 2u] = t1;
+    pState[(2u * i) + 3u] = t2;
+  }
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  i = 0u;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  /* Remaining bin */
+  for (; i < numBins; i++)
+  {
+    c0 = pCoeffs[(2u * i)];
+    s1 = pState[(2u * i)];
+    s2 = pState[(2u * i) + 1u];
+
+    for (n = 0u; n < blockSize; n++)
+    {
+      x = pSrc[n] >> shift;
+      s0 = (q31_t) (((q63_t) c0 * s1) >> 30) + (x - s2);
+      s2 = s1;
+      s1 = s0;
+    }
+
+    pState[(2u * i)] = s1;
+    pState[(2u * i) + 1u] = s2;
+  }
+}
+
+/**
+ * @brief Per-sample processing function for the Q31 multi-bin Goertzel.
+ * @param[in,out] *S points to an instance of the Q31 Goertzel structure.
+ * @param[in]     x input sample.
+ * @return none.
+ */
+
+void arm_goertzel_sample_q31(
+  arm_goertzel_instance_q31 * S,
+  q31_t x)
+{
+  q31_t *pState = S->pState;                     /* state pointer */
+  const q31_t *pCoeffs = S->pCoeffs;             /* coefficient pointer */
+  q31_t s0;                                      /* new state */
+  uint32_t i;                                    /* loop counter */
+
+  x >>= S->inputShift;
+
+  for (i = 0u; i < S->numBins; i++)
+  {
+    s0 = (q31_t) (((q63_t) pCoeffs[0] * pState[0]) >> 30) + (x - pState[1]);
+    pState[1] = pState[0];
+    pState[0] = s0;
+    pCoeffs += 2u;
+    pState += 2u;
+  }
+}
+
+/**
+ * @brief End of block function for the Q31 multi-bin Goertzel.
+ * @param[in,out] *S points to an instance of the Q31 Goertzel structure.
+ * @param[out]    *pDst points to the numBins complex results, in interleaved fashion (real, imag),
+ * in 1.31 format scaled by 2^-inputShift.
+ * @return none.
+ *
+ * The state of the recursions is cleared for the next block.
+ */
+
+void arm_goertzel_get_q31(
+  arm_goertzel_instance_q31 * S,
+  q31_t * pDst)
+{
+  q31_t *pState = S->pState;                     /* state pointer */
+  const q31_t *pCoeffs = S->pCoeffs;             /* coefficient pointer */
+  uint32_t i;                                    /* loop counter */
+
+  for (i = 0u; i < S->numBins; i++)
+  {
+    /* X = (cos(w) * s[N-1] - s[N-2]) + j * sin(w) * s[N-1] */
+    pDst[0] = clip_q63_to_q31((((q63_t) pCoeffs[0] * pState[0]) >> 31) - pState[1]);
+    pDst[1] = (q31_t) (((q63_t) pCoeffs[1] * pState[0]) >> 31);
+    pState[0] = 0;
+    pState[1] = 0;
+    pCoeffs += 2u;
+    pState += 2u;
+    pDst += 2u;
+  }
+}
+
+/**
+ * @} end of Goertzel group
+ */
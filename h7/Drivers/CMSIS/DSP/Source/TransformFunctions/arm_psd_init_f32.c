@@ -0,0 +1,137 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_psd_init_f32.c
+ * Description:  Initialization function for the floating-point Welch PSD
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup PSD
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point Welch PSD.
+ * @param[in,out] *S points to an instance of the floating-point Welch PSD structure.
+ * @param[in]     fftLen length of the frames, a supported real FFT length.
+ * @param[in]     overlap number of samples shared by consecutive frames, below fftLen.
+ * @param[in]     *pWindow points to the fftLen window coefficients, or NULL for a rectangular window.
+ * @param[in]     averaging averaging of the frame spectra.
+ * @param[in]     alpha smoothing factor of the exponential average, in (0 1].
+ * @param[in]     *pState points to the state buffer of ARM_PSD_STATE_SIZE_F32(fftLen) samples.
+ * @param[in]     *pPsd points to the averaged PSD, fftLen/2+1 values, NULL without average.
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+ *                <code>fftLen</code> is not a supported real FFT length, if <code>overlap</code> is not below it or if
+ *                <code>alpha</code> is outside (0 1] with the exponential average.
+ *
+ * <b>Description:</b>
+ * \par
+ * The window is not copied and must stay valid while the instance is used.
+ * Its power <code>sum(w[n]^2)</code> is computed here for the normalization.
+ * \par
+ * <code>pState</code> points to the state buffer of <code>ARM_PSD_STATE_SIZE_F32(fftLen)</code> samples,
+ * that is <code>3*fftLen</code>: the input ring and the frame being transformed.
+ */
+
+arm_status arm_psd_init_f32(
+  arm_psd_instance_f32 * S,
+  uint16_t fftLen,
+  uint16_t overlap,
+  const float32_t * pWindow,
+  arm_psd_average_type averaging,
+  float32_t alpha,
+  float32_t * pState,
+  float32_t * pPsd)
+{
+  float32_t power = 0.0f;                        /* Power of the window */
+  uint32_t n;                                    /* Loop counter */
+
+  if((overlap >= fftLen) ||
+     ((averaging == ARM_PSD_AVERAGE_EXPONENTIAL) && ((alpha <= 0.0f) || (alpha > 1.0f))) ||
+     (arm_rfft_fast_init_f32(&S->rfft, fftLen) != ARM_MATH_SUCCESS))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  if(pWindow != NULL)
+  {
+    for (n = 0u; n < fftLen; n++)
+    {
+      power += pWindow[n] * pWindow[n];
+    }
+  }
+  else
+  {
+    power = (float32_t) fftLen;
+  }
+
+  S->fftLen = fftLen;
+  S->hopSize = fftLen - overlap;
+  S->averaging = averaging;
+  S->alpha = alpha;
+  S->scale = 1.0f / power;
+  S->pWindow = pWindow;
+  S->pPsd = pPsd;
+
+  /* Carve the state buffer */
+  S->pInput = pState;
+  S->pScratch = pState + fftLen;
+
+  /* Clear the input ring and the average */
+  memset(S->pInput, 0, fftLen * sizeof(float32_t));
+  arm_psd_reset_f32(S);
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @brief  Restarts the floating-point Welch PSD.
+ * @param[in,out] *S points to an instance of the floating-point Welch PSD structure.
+ * @return none.
+ *
+ * The average is cleared and the next frame waits for fftLen new samples.
+ */
+
+void arm_psd_reset_f32(
+  arm_psd_instance_f32 * S)
+{
+  S->writeIndex = 0u;
+  S->pending = S->fftLen;
+  S->frameCount = 0u;
+
+  if(S->pPsd != NULL)
+  {
+    memset(S->pPsd, 0, ((S->fftLen >> 1u) + 1u) * sizeof(float32_t));
+  }
+}
+
+/**
+ * @} end of PSD group
+ */
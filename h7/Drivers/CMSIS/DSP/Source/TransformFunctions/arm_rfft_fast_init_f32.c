@@ -46,7 +46,8 @@
 *
 * \par Description:
 * \par
-* The parameter <code>fftLen</code>	Specifies length of RFFT/CIFFT process. Supported FFT Lengths are 32, 64, 128, 256, 512, 1024, 2048, 4096.
+* The parameter <code>fftLen</code>	Specifies length of RFFT/CIFFT process. Supported FFT Lengths are 32, 64, 128, 256, 512, 1024, 2048, 4096,
+* and the mixed radix lengths 1000, 1200, 1536.
 * \par
 * This Function also initializes Twiddle factor table pointer and Bit reversal table pointer.
 */
@@ -65,6 +66,7 @@ arm_status arm_rfft_fast_init_f32(
   /*  Initializations of structure parameters depending on the FFT length */
   switch (Sint->fftLen)
   {
+#if defined(ARM_TABLE_RFFT_F32_4096)
   case 2048u:
     /*  Initializations of structure parameters for 2048 point FFT */
     /*  Initialise the bit reversal table length */
@@ -75,48 +77,87 @@ arm_status arm_rfft_fast_init_f32(
 		Sint->pTwiddle     = (float32_t *) twiddleCoef_2048;
 		S->pTwiddleRFFT    = (float32_t *) twiddleCoef_rfft_4096;
     break;
+#endif
+#if defined(ARM_TABLE_RFFT_F32_1536)
+  case 768u:
+    Sint->bitRevLength = ARMBITREVINDEXTABLE_768_TABLE_LENGTH;
+    Sint->pBitRevTable = (uint16_t *)armBitRevIndexTable768;
+		Sint->pTwiddle     = (float32_t *) twiddleCoef_768;
+		S->pTwiddleRFFT    = (float32_t *) twiddleCoef_rfft_1536;
+    break;
+#endif
+#if defined(ARM_TABLE_RFFT_F32_1200)
+  case 600u:
+    Sint->bitRevLength = ARMBITREVINDEXTABLE_600_TABLE_LENGTH;
+    Sint->pBitRevTable = (uint16_t *)armBitRevIndexTable600;
+		Sint->pTwiddle     = (float32_t *) twiddleCoef_600;
+		S->pTwiddleRFFT    = (float32_t *) twiddleCoef_rfft_1200;
+    break;
+#endif
+#if defined(ARM_TABLE_RFFT_F32_1000)
+  case 500u:
+    Sint->bitRevLength = ARMBITREVINDEXTABLE_500_TABLE_LENGTH;
+    Sint->pBitRevTable = (uint16_t *)armBitRevIndexTable500;
+		Sint->pTwiddle     = (float32_t *) twiddleCoef_500;
+		S->pTwiddleRFFT    = (float32_t *) twiddleCoef_rfft_1000;
+    break;
+#endif
+#if defined(ARM_TABLE_RFFT_F32_2048)
   case 1024u:
     Sint->bitRevLength = ARMBITREVINDEXTABLE_1024_TABLE_LENGTH;
     Sint->pBitRevTable = (uint16_t *)armBitRevIndexTable1024;
 		Sint->pTwiddle     = (float32_t *) twiddleCoef_1024;
 		S->pTwiddleRFFT    = (float32_t *) twiddleCoef_rfft_2048;
     break;
+#endif
+#if defined(ARM_TABLE_RFFT_F32_1024)
   case 512u:
     Sint->bitRevLength = ARMBITREVINDEXTABLE_512_TABLE_LENGTH;
     Sint->pBitRevTable = (uint16_t *)armBitRevIndexTable512;
 		Sint->pTwiddle     = (float32_t *) twiddleCoef_512;
 		S->pTwiddleRFFT    = (float32_t *) twiddleCoef_rfft_1024;
     break;
+#endif
+#if defined(ARM_TABLE_RFFT_F32_512)
   case 256u:
     Sint->bitRevLength = ARMBITREVINDEXTABLE_256_TABLE_LENGTH;
     Sint->pBitRevTable = (uint16_t *)armBitRevIndexTable256;
 		Sint->pTwiddle     = (float32_t *) twiddleCoef_256;
 		S->pTwiddleRFFT    = (float32_t *) twiddleCoef_rfft_512;
     break;
+#endif
+#if defined(ARM_TABLE_RFFT_F32_256)
   case 128u:
     Sint->bitRevLength = ARMBITREVINDEXTABLE_128_TABLE_LENGTH;
     Sint->pBitRevTable = (uint16_t *)armBitRevIndexTable128;
 		Sint->pTwiddle     = (float32_t *) twiddleCoef_128;
 		S->pTwiddleRFFT    = (float32_t *) twiddleCoef_rfft_256;
     break;
+#endif
+#if defined(ARM_TABLE_RFFT_F32_128)
   case 64u:
     Sint->bitRevLength = ARMBITREVINDEXTABLE_64_TABLE_LENGTH;
     Sint->pBitRevTable = (uint16_t *)armBitRevIndexTable64;
 		Sint->pTwiddle     = (float32_t *) twiddleCoef_64;
 		S->pTwiddleRFFT    = (float32_t *) twiddleCoef_rfft_128;
     break;
+#endif
+#if defined(ARM_TABLE_RFFT_F32_64)
   case 32u:
     Sint->bitRevLength = ARMBITREVINDEXTABLE_32_TABLE_LENGTH;
     Sint->pBitRevTable = (uint16_t *)armBitRevIndexTable32;
 		Sint->pTwiddle     = (float32_t *) twiddleCoef_32;
 		S->pTwiddleRFFT    = (float32_t *) twiddleCoef_rfft_64;
     break;
+#endif
+#if defined(ARM_TABLE_RFFT_F32_32)
   case 16u:
     Sint->bitRevLength = ARMBITREVINDEXTABLE_16_TABLE_LENGTH;
     Sint->pBitRevTable = (uint16_t *)armBitRevIndexTable16;
 		Sint->pTwiddle     = (float32_t *) twiddleCoef_16;
 		S->pTwiddleRFFT    = (float32_t *) twiddleCoef_rfft_32;
     break;
+#endif
   default:
     /*  Reporting argument error if fftSize is not valid value */
     status = ARM_MATH_ARGUMENT_ERROR;
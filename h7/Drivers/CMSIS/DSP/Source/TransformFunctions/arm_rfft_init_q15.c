@@ -2178,42 +2178,60 @@ arm_status arm_rfft_init_q15(
     /*  Initialization of coef modifier depending on the FFT length */
     switch (S->fftLenReal)
     {
+#if defined(ARM_TABLE_FFT_Q15_4096)
     case 8192u:
         S->twidCoefRModifier = 1u;
         S->pCfft = &arm_cfft_sR_q15_len4096;
         break;
+#endif
+#if defined(ARM_TABLE_FFT_Q15_2048)
     case 4096u:
         S->twidCoefRModifier = 2u;
         S->pCfft = &arm_cfft_sR_q15_len2048;
         break;
+#endif
+#if defined(ARM_TABLE_FFT_Q15_1024)
     case 2048u:
         S->twidCoefRModifier = 4u;
         S->pCfft = &arm_cfft_sR_q15_len1024;
         break;
+#endif
+#if defined(ARM_TABLE_FFT_Q15_512)
     case 1024u:
         S->twidCoefRModifier = 8u;
         S->pCfft = &arm_cfft_sR_q15_len512;
         break;
+#endif
+#if defined(ARM_TABLE_FFT_Q15_256)
     case 512u:
         S->twidCoefRModifier = 16u;
         S->pCfft = &arm_cfft_sR_q15_len256;
         break;
+#endif
+#if defined(ARM_TABLE_FFT_Q15_128)
     case 256u:
         S->twidCoefRModifier = 32u;
         S->pCfft = &arm_cfft_sR_q15_len128;
         break;
+#endif
+#if defined(ARM_TABLE_FFT_Q15_64)
     case 128u:
         S->twidCoefRModifier = 64u;
         S->pCfft = &arm_cfft_sR_q15_len64;
         break;
+#endif
+#if defined(ARM_TABLE_FFT_Q15_32)
     case 64u:
         S->twidCoefRModifier = 128u;
         S->pCfft = &arm_cfft_sR_q15_len32;
         break;
+#endif
+#if defined(ARM_TABLE_FFT_Q15_16)
     case 32u:
         S->twidCoefRModifier = 256u;
         S->pCfft = &arm_cfft_sR_q15_len16;
         break;
+#endif
     default:
         /*  Reporting argument error if rfftSize is not valid value */
         status = ARM_MATH_ARGUMENT_ERROR;
@@ -4229,42 +4229,60 @@ arm_status arm_rfft_init_q31(
     /*  Initialization of coef modifier depending on the FFT length */
     switch (S->fftLenReal)
     {
+#if defined(ARM_TABLE_FFT_Q31_4096)
     case 8192u:
         S->twidCoefRModifier = 1u;
         S->pCfft = &arm_cfft_sR_q31_len4096;
         break;
+#endif
+#if defined(ARM_TABLE_FFT_Q31_2048)
     case 4096u:
         S->twidCoefRModifier = 2u;
         S->pCfft = &arm_cfft_sR_q31_len2048;
         break;
+#endif
+#if defined(ARM_TABLE_FFT_Q31_1024)
     case 2048u:
         S->twidCoefRModifier = 4u;
         S->pCfft = &arm_cfft_sR_q31_len1024;
         break;
+#endif
+#if defined(ARM_TABLE_FFT_Q31_512)
     case 1024u:
         S->twidCoefRModifier = 8u;
         S->pCfft = &arm_cfft_sR_q31_len512;
         break;
+#endif
+#if defined(ARM_TABLE_FFT_Q31_256)
     case 512u:
         S->twidCoefRModifier = 16u;
         S->pCfft = &arm_cfft_sR_q31_len256;
         break;
+#endif
+#if defined(ARM_TABLE_FFT_Q31_128)
     case 256u:
         S->twidCoefRModifier = 32u;
         S->pCfft = &arm_cfft_sR_q31_len128;
         break;
+#endif
+#if defined(ARM_TABLE_FFT_Q31_64)
     case 128u:
         S->twidCoefRModifier = 64u;
         S->pCfft = &arm_cfft_sR_q31_len64;
         break;
+#endif
+#if defined(ARM_TABLE_FFT_Q31_32)
     case 64u:
         S->twidCoefRModifier = 128u;
         S->pCfft = &arm_cfft_sR_q31_len32;
         break;
+#endif
+#if defined(ARM_TABLE_FFT_Q31_16)
     case 32u:
         S->twidCoefRModifier = 256u;
         S->pCfft = &arm_cfft_sR_q31_len16;
         break;
+#endif
     default:
         /*  Reporting argument error if rfftSize is not valid value */
         status = ARM_MATH_ARGUMENT_ERROR;
@@ -0,0 +1,138 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sdft_f32.c
+ * Description:  Floating-point sliding DFT
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup SDFT
+ * @{
+ */
+
+/**
+ * @brief Per-sample processing function for the floating-point sliding DFT.
+ * @param[in,out] *S points to an instance of the floating-point sliding DFT structure.
+ * @param[in]     x input sample.
+ * @return none.
+ */
+
+void arm_sdft_sample_f32(
+  arm_sdft_instance_f32 * S,
+  float32_t x)
+{
+  float32_t *pState = S->pState;                 /* bin pointer */
+  const float32_t *pCoeffs = S->pCoeffs;         /* coefficient pointer */
+  float32_t d;                                   /* input difference */
+  float32_t re, im;                              /* bin before rotation */
+  uint32_t numBins = S->numBins;                 /* number of bins */
+  uint32_t i;                                    /* loop counter */
+
+  /* Sample entering the window minus the damped one leaving it */
+  d = x - (S->dampingN * S->pDelay[S->index]);
+  S->pDelay[S->index] = x;
+  S->index = ((S->index + 1u) < S->windowLength) ? (S->index + 1u) : 0u;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  float32_t re1, im1;                            /* second bin before rotation */
+
+  /* Two bins at a time */
+  i = numBins >> 1u;
+  while(i > 0u)
+  {
+    re = pState[0] + d;
+    im = pState[1];
+    re1 = pState[2] + d;
+    im1 = pState[3];
+
+    pState[0] = (pCoeffs[0] * re) - (pCoeffs[1] * im);
+    pState[1] = (pCoeffs[1] * re) + (pCoeffs[0] * im);
+    pState[2] = (pCoeffs[2] * re1) - (pCoeffs[3] * im1);
+    pState[3] = (pCoeffs[3] * re1) + (pCoeffs[2] * im1);
+
+    pState += 4u;
+    pCoeffs += 4u;
+    i--;
+  }
+
+  /* Remaining bin */
+  i = numBins & 1u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  i = numBins;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(i > 0u)
+  {
+    re = pState[0] + d;
+    im = pState[1];
+
+    pState[0] = (pCoeffs[0] * re) - (pCoeffs[1] * im);
+    pState[1] = (pCoeffs[1] * re) + (pCoeffs[0] * im);
+
+    pState += 2u;
+    pCoeffs += 2u;
+    i--;
+  }
+}
+
+/**
+ * @brief Processing function for the floating-point sliding DFT.
+ * @param[in,out] *S points to an instance of the floating-point sliding DFT structure.
+ * @param[in]     *pSrc points to the block of input samples.
+ * @param[in]     blockSize number of samples to process.
+ * @return none.
+ *
+ * The bins of the window ending with the last sample of the block are in the
+ * state buffer on return.
+ */
+
+void arm_sdft_f32(
+  arm_sdft_instance_f32 * S,
+  float32_t * pSrc,
+  uint32_t blockSize)
+{
+  while(blockSize > 0u)
+  {
+    arm_sdft_sample_f32(S, *pSrc++);
+    blockSize--;
+  }
+}
+
+/**
+ * @} end of SDFT group
+ */
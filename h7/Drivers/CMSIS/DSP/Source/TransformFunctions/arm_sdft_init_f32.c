@@ -0,0 +1,140 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sdft_init_f32.c
+ * Description:  Initialization function for the floating-point sliding DFT
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @defgroup SDFT Sliding DFT
+ *
+ * Tracks a few bins of the discrete Fourier transform of the last N samples,
+ * updated at every sample for a few multiply-accumulates per bin, where a
+ * full FFT would be needed per output.
+ *
+ * \par Algorithm
+ * Each bin k of the window of N samples is updated recursively with the
+ * sample entering the window and the one leaving it:
+ * <pre>
+ *     X<sub>k</sub>[n] = r * e<sup>j*2*pi*k/N</sup> * (X<sub>k</sub>[n-1] + x[n] - r<sup>N</sup> * x[n-N])
+ * </pre>
+ * and equals <code>sum(x[n-N+1+m] * e<sup>-j*2*pi*k*m/N</sup>, m = 0..N-1)</code>
+ * for r = 1, the DFT of the window starting with its oldest sample. The damping factor r,
+ * slightly below 1 (0.99999 for instance), keeps the rounding errors of the
+ * recursion from accumulating, at the price of an exponential window.
+ *
+ * \par
+ * arm_sdft_f32() processes a block of samples and arm_sdft_sample_f32() a
+ * single one. The bins of the last window are read in the state buffer
+ * after each call, as numBins complex values in interleaved fashion
+ * (real, imag). All the bins are updated together for each sample, two at
+ * a time on Cortex-M3/M4/M7. A delay line of N samples is shared by the bins.
+ *
+ * \par Instance Structure
+ * The coefficients, state and delay line are stored in an instance data
+ * structure, initialized by arm_sdft_init_f32() or arm_sdft_init_q31().
+ *
+ * \par Fixed-Point Behavior
+ * The Q31 input samples are shifted right by <code>inputShift</code> bits
+ * before entering the window; <code>inputShift = log2(N)</code> rounded up
+ * prevents any overflow, the bins being in 1.31 format scaled by
+ * <code>2<sup>-inputShift</sup></code>.
+ */
+
+/**
+ * @addtogroup SDFT
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point sliding DFT.
+ * @param[in,out] *S points to an instance of the floating-point sliding DFT structure.
+ * @param[in]     numBins number of bins tracked.
+ * @param[in]     windowLength window length N, in samples.
+ * @param[in]     *pBins points to the numBins bin indexes, below N.
+ * @param[in]     damping damping factor r, in (0 1].
+ * @param[in]     *pCoeffs points to the coefficient buffer of 2*numBins values, filled by the function.
+ * @param[in]     *pState points to the bin buffer of 2*numBins values.
+ * @param[in]     *pDelay points to the delay line of windowLength values.
+ * @return        The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR
+ * if windowLength is zero, if a bin index is not below it, or if the damping factor is outside (0 1].
+ *
+ * The coefficients are computed in double precision with the C library.
+ */
+
+arm_status arm_sdft_init_f32(
+  arm_sdft_instance_f32 * S,
+  uint16_t numBins,
+  uint16_t windowLength,
+  const uint16_t * pBins,
+  float32_t damping,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  float32_t * pDelay)
+{
+  float64_t w;                                   /* angular frequency */
+  uint32_t i;                                    /* loop counter */
+
+  if((windowLength == 0u) || (damping <= 0.0f) || (damping > 1.0f))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (i = 0u; i < numBins; i++)
+  {
+    if(pBins[i] >= windowLength)
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    /* r * e^(j*2*pi*k/N) of each bin */
+    w = (6.28318530717958647692 * (float64_t) pBins[i]) / (float64_t) windowLength;
+    pCoeffs[(2u * i)] = (float32_t) ((float64_t) damping * cos(w));
+    pCoeffs[(2u * i) + 1u] = (float32_t) ((float64_t) damping * sin(w));
+  }
+
+  S->numBins = numBins;
+  S->windowLength = windowLength;
+  S->index = 0u;
+  S->dampingN = (float32_t) pow((float64_t) damping, (float64_t) windowLength);
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+  S->pDelay = pDelay;
+
+  /* Clear the bins and the delay line */
+  memset(pState, 0, (2u * numBins) * sizeof(float32_t));
+  memset(pDelay, 0, windowLength * sizeof(float32_t));
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of SDFT group
+ */
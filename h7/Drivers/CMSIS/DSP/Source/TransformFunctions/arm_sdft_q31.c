@@ -0,0 +1,144 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sdft_q31.c
+ * Description:  Q31 sliding DFT
+ *
+ * $Date:        27. January 2017
+ * $Revision:    V.1.5.1
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2017 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup SDFT
+ * @{
+ */
+
+/**
+ * @brief Per-sample processing function for the Q31 sliding DFT.
+ * @param[in,out] *S points to an instance of the Q31 sliding DFT structure.
+ * @param[in]     x input sample.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The input is shifted right by <code>inputShift</code> bits. The rotations
+ * are computed with 64-bit accumulators and saturated to 1.31 format.
+ */
+
+void arm_sdft_sample_q31(
+  arm_sdft_instance_q31 * S,
+  q31_t x)
+{
+  q31_t *pState = S->pState;                     /* bin pointer */
+  const q31_t *pCoeffs = S->pCoeffs;             /* coefficient pointer */
+  q31_t d;                                       /* input difference */
+  q31_t re, im;                                  /* bin before rotation */
+  uint32_t numBins = S->numBins;                 /* number of bins */
+  uint32_t i;                                    /* loop counter */
+
+  /* Sample entering the window minus the damped one leaving it */
+  x >>= S->inputShift;
+  d = x - (q31_t) (((q63_t) S->dampingN * S->pDelay[S->index]) >> 31);
+  S->pDelay[S->index] = x;
+  S->index = ((S->index + 1u) < S->windowLength) ? (S->index + 1u) : 0u;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q31_t re1, im1;                                /* second bin before rotation */
+
+  /* Two bins at a time */
+  i = numBins >> 1u;
+  while(i > 0u)
+  {
+    re = __QADD(pState[0], d);
+    im = pState[1];
+    re1 = __QADD(pState[2], d);
+    im1 = pState[3];
+
+    pState[0] = clip_q63_to_q31((((q63_t) pCoeffs[0] * re) - ((q63_t) pCoeffs[1] * im)) >> 31);
+    pState[1] = clip_q63_to_q31((((q63_t) pCoeffs[1] * re) + ((q63_t) pCoeffs[0] * im)) >> 31);
+    pState[2] = clip_q63_to_q31((((q63_t) pCoeffs[2] * re1) - ((q63_t) pCoeffs[3] * im1)) >> 31);
+    pState[3] = clip_q63_to_q31((((q63_t) pCoeffs[3] * re1) + ((q63_t) pCoeffs[2] * im1)) >> 31);
+
+    pState += 4u;
+    pCoeffs += 4u;
+    i--;
+  }
+
+  /* Remaining bin */
+  i = numBins & 1u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  i = numBins;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(i > 0u)
+  {
+    re = clip_q63_to_q31((q63_t) pState[0] + d);
+    im = pState[1];
+
+    pState[0] = clip_q63_to_q31((((q63_t) pCoeffs[0] * re) - ((q63_t) pCoeffs[1] * im)) >> 31);
+    pState[1] = clip_q63_to_q31((((q63_t) pCoeffs[1] * re) + ((q63_t) pCoeffs[0] * im)) >> 31);
+
+    pState += 2u;
+    pCoeffs += 2u;
+    i--;
+  }
+}
+
+/**
+ * @brief Processing function for the Q31 sliding DFT.
+ * @param[in,out] *S points to an instance of the Q31 sliding DFT structure.
+ * @param[in]     *pSrc points to the block of input samples.
+ * @param[in]     blockSize number of samples to process.
+ * @return none.
+ *
+ * The bins of the window ending with the last sample of the block are in the
+ * state buffer on return.
+ */
+
+void arm_sdft_q31(
+  arm_sdft_instance_q31 * S,
+  q31_t * pSrc,
+  uint32_t blockSize)
+{
+  while(blockSize > 0u)
+  {
+    arm_sdft_sample_q31(S, *pSrc++);
+    blockSize--;
+  }
+}
+
+/**
+ * @} end of SDFT group
+ */
@@ -0,0 +1,531 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2018 STMicroelectronics. All rights reserved.
+*
+* Project:       CMSIS NN Library
+* Title:         arm_nn_benchmark_example.c
+*
+* Description:   Cycle count benchmark of the neural network kernels on
+*                the layers of a small keyword spotting network, for every
+*                flash/cache configuration of the device.
+*
+* Target Processor: Cortex-M7/Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of STMicroelectronics nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+ * -------------------------------------------------------------------- */
+
+/**
+ * @ingroup groupExamples
+ */
+
+/**
+ * @defgroup NNBenchmark Neural Network Kernels Benchmark Example
+ *
+ * \par Description
+ * \par
+ * Measures the execution time of the CMSIS NN kernels on the layers of a
+ * small depthwise separable keyword spotting network (16x16x8 input
+ * feature map), under each flash accelerator and cache configuration the
+ * device provides. The q7 fully-connected layer is also compared with the
+ * same layer computed in floating point with arm_mat_mult_f32(), which is
+ * what a network without fixed-point kernels has to fall back to.
+ *
+ * \par Algorithm:
+ * \par
+ * The weights and activations are pseudo-random: the cycle counts do not
+ * depend on the values. Each layer runs \c BENCH_REPEAT times and the
+ * smallest cycle count is kept. Cycles are counted with the DWT cycle
+ * counter on Cortex-M3/M4/M7 and with SysTick on Cortex-M0.
+ * \par
+ * All the convolutions share one im2col scratch arena, \c bench_scratch,
+ * sized for the largest layer.
+ * \par
+ * The results are printed as one line per measurement,
+ * <code>layer;config;cycles;time_us;macs</code>, through
+ * \c bench_putchar(). The default implementation writes to ITM stimulus
+ * port 0 (SWO); provide your own (UART) on Cortex-M0 or to redirect it.
+ * The system clock must be configured before \c main() is entered.
+ *
+ * \par Variables Description:
+ * \par
+ * \li \c bench_in, \c bench_out activation buffers
+ * \li \c bench_wt weights of the layer being measured
+ * \li \c bench_scratch im2col and vector expansion buffer
+ * \li \c bench_configs flash/cache configurations measured on this device
+ *
+ * \par CMSIS NN Software Library Functions Used:
+ * \par
+ * - arm_convolve_HWC_q7_basic()
+ * - arm_depthwise_separable_conv_HWC_q7()
+ * - arm_maxpool_q7_HWC(), arm_avepool_q7_HWC()
+ * - arm_relu_q7(), arm_relu_q15()
+ * - arm_fully_connected_q7(), arm_fully_connected_q15()
+ * - arm_softmax_q7()
+ *
+ * \par CMSIS DSP Software Library Functions Used:
+ * \par
+ * - arm_mat_init_f32(), arm_mat_mult_f32()
+ *
+ * <b> Refer  </b>
+ * \link arm_nn_benchmark_example.c \endlink
+ *
+ */
+
+
+/** \example arm_nn_benchmark_example.c
+  */
+
+#include "stm32h7xx.h"
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/* Network dimensions: IN_DIM x IN_DIM x IN_CH input feature map */
+#define BENCH_IN_DIM        16U
+#define BENCH_IN_CH         8U
+#define BENCH_CH            16U
+#define BENCH_KERNEL        3U
+#define BENCH_POOL_DIM      (BENCH_IN_DIM / 2U)
+/* Classifier on the 4x4 average of the last feature map */
+#define BENCH_FC_IN         (4U * 4U * BENCH_CH)
+#define BENCH_FC_OUT        12U
+#define BENCH_FC16_IN       256U
+#define BENCH_FC16_OUT      16U
+
+/* Runs per measurement, the fastest one is reported */
+#ifndef BENCH_REPEAT
+#define BENCH_REPEAT        4U
+#endif
+
+#ifndef __WEAK
+#if defined(__ICCARM__)
+#define __WEAK              __weak
+#else
+#define __WEAK              __attribute__((weak))
+#endif
+#endif
+
+/* Flash/cache configuration flags */
+#define BENCH_CFG_PREFETCH  0x01U   /* flash prefetch buffer          */
+#define BENCH_CFG_FLASH     0x02U   /* ART accelerator / flash caches */
+#define BENCH_CFG_ICACHE    0x04U   /* Cortex-M7 instruction cache    */
+#define BENCH_CFG_DCACHE    0x08U   /* Cortex-M7 data cache           */
+
+typedef struct
+{
+  const char *name;
+  uint32_t    flags;
+} bench_config_t;
+
+typedef enum
+{
+  BENCH_CONV = 0,
+  BENCH_DWCONV,
+  BENCH_PWCONV,
+  BENCH_RELU_Q7,
+  BENCH_MAXPOOL,
+  BENCH_AVEPOOL,
+  BENCH_FC_Q7,
+  BENCH_FC_F32,
+  BENCH_FC_Q15,
+  BENCH_RELU_Q15,
+  BENCH_SOFTMAX,
+  BENCH_LAYER_NBR
+} bench_layer_t;
+
+/* ------------------------------------------------------------------
+* Global variables for NN Benchmark Example
+* ------------------------------------------------------------------- */
+static const bench_config_t bench_configs[] =
+{
+  { "none",           0U },
+#if defined(FLASH_ACR_PRFTBE) || defined(FLASH_ACR_PRFTEN)
+  { "prefetch",       BENCH_CFG_PREFETCH },
+#endif
+#if defined(FLASH_ACR_ARTEN) || defined(FLASH_ACR_ICEN)
+  { "prefetch+art",   BENCH_CFG_PREFETCH | BENCH_CFG_FLASH },
+#endif
+#if (__CORTEX_M == 7U)
+  { "icache",         BENCH_CFG_PREFETCH | BENCH_CFG_FLASH | BENCH_CFG_ICACHE },
+  { "icache+dcache",  BENCH_CFG_PREFETCH | BENCH_CFG_FLASH | BENCH_CFG_ICACHE | BENCH_CFG_DCACHE },
+#endif
+};
+
+static const char * const bench_names[BENCH_LAYER_NBR] =
+{
+  "conv3x3_q7", "dwconv3x3_q7", "conv1x1_q7", "relu_q7", "maxpool_q7", "avepool_q7",
+  "fc_q7", "fc_f32", "fc_q15", "relu_q15", "softmax_q7"
+};
+
+/* Multiply-accumulates of each layer, 0 when not a matrix layer */
+static const uint32_t bench_macs[BENCH_LAYER_NBR] =
+{
+  BENCH_IN_DIM * BENCH_IN_DIM * BENCH_CH * BENCH_KERNEL * BENCH_KERNEL * BENCH_IN_CH,
+  BENCH_IN_DIM * BENCH_IN_DIM * BENCH_CH * BENCH_KERNEL * BENCH_KERNEL,
+  BENCH_IN_DIM * BENCH_IN_DIM * BENCH_CH * BENCH_CH,
+  0U, 0U, 0U,
+  BENCH_FC_IN * BENCH_FC_OUT,
+  BENCH_FC_IN * BENCH_FC_OUT,
+  BENCH_FC16_IN * BENCH_FC16_OUT,
+  0U, 0U
+};
+
+/* Activations, 32-bit aligned */
+static uint32_t bench_in[(BENCH_IN_DIM * BENCH_IN_DIM * BENCH_CH) / 4U];
+static uint32_t bench_out[(BENCH_IN_DIM * BENCH_IN_DIM * BENCH_CH) / 4U];
+/* Weights: the floating-point fully-connected layer is the largest */
+static uint32_t bench_wt[BENCH_FC_IN * BENCH_FC_OUT];
+static uint32_t bench_bias[BENCH_CH];
+/* im2col arena shared by the layers, in q15 values; the depthwise
+   convolution needs the most, also enough for the q7 classifier */
+static q15_t bench_scratch[2U * BENCH_CH * (BENCH_KERNEL * BENCH_KERNEL + 1U)];
+static float32_t bench_vec_f32[BENCH_FC_IN];
+static float32_t bench_out_f32[BENCH_FC_OUT];
+static uint32_t bench_seed;
+
+/* ----------------------------------------------------------------------
+* Output
+* ------------------------------------------------------------------- */
+
+/* Send one character of the result table; override to use a UART */
+__WEAK void bench_putchar(char ch)
+{
+#if (__CORTEX_M >= 3U)
+  (void)ITM_SendChar((uint32_t)ch);
+#else
+  (void)ch;
+#endif
+}
+
+static void bench_puts(const char *str)
+{
+  while (*str != '\0')
+  {
+    bench_putchar(*str++);
+  }
+}
+
+/* Print an unsigned value with at least 'digits' digits, a decimal point
+   being inserted before the last 'decimals' digits */
+static void bench_putu(uint32_t value, uint32_t digits, uint32_t decimals)
+{
+  char buf[12];
+  uint32_t n = 0U;
+
+  do
+  {
+    buf[n++] = (char)('0' + (value % 10U));
+    value /= 10U;
+  } while (((value != 0U) || (n < digits)) && (n < sizeof(buf)));
+
+  while (n > 0U)
+  {
+    if ((n == decimals) && (decimals != 0U))
+    {
+      bench_putchar('.');
+    }
+    bench_putchar(buf[--n]);
+  }
+}
+
+/* ----------------------------------------------------------------------
+* Cycle counter
+* ------------------------------------------------------------------- */
+static void bench_timer_init(void)
+{
+#if (__CORTEX_M >= 3U)
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#if (__CORTEX_M == 7U)
+  DWT->LAR = 0xC5ACCE55U;
+#endif
+  DWT->CYCCNT = 0U;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#else
+  SysTick->LOAD = SysTick_LOAD_RELOAD_Msk;
+  SysTick->VAL = 0U;
+  SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+#endif
+}
+
+static __INLINE uint32_t bench_timer_get(void)
+{
+#if (__CORTEX_M >= 3U)
+  return DWT->CYCCNT;
+#else
+  return SysTick->VAL;
+#endif
+}
+
+static __INLINE uint32_t bench_timer_elapsed(uint32_t start, uint32_t end)
+{
+#if (__CORTEX_M >= 3U)
+  return end - start;
+#else
+  /* SysTick counts down on 24 bits */
+  return (start - end) & SysTick_LOAD_RELOAD_Msk;
+#endif
+}
+
+/* ----------------------------------------------------------------------
+* Flash accelerator and caches
+* ------------------------------------------------------------------- */
+static void bench_apply_config(uint32_t flags)
+{
+#if defined(FLASH_ACR_PRFTBE)
+  if ((flags & BENCH_CFG_PREFETCH) != 0U)
+  {
+    FLASH->ACR |= FLASH_ACR_PRFTBE;
+  }
+  else
+  {
+    FLASH->ACR &= ~FLASH_ACR_PRFTBE;
+  }
+#elif defined(FLASH_ACR_PRFTEN)
+  if ((flags & BENCH_CFG_PREFETCH) != 0U)
+  {
+    FLASH->ACR |= FLASH_ACR_PRFTEN;
+  }
+  else
+  {
+    FLASH->ACR &= ~FLASH_ACR_PRFTEN;
+  }
+#endif
+
+#if defined(FLASH_ACR_ARTEN)
+  /* The ART accelerator is reset while disabled, to start cold */
+  FLASH->ACR &= ~FLASH_ACR_ARTEN;
+  FLASH->ACR |= FLASH_ACR_ARTRST;
+  FLASH->ACR &= ~FLASH_ACR_ARTRST;
+  if ((flags & BENCH_CFG_FLASH) != 0U)
+  {
+    FLASH->ACR |= FLASH_ACR_ARTEN;
+  }
+#elif defined(FLASH_ACR_ICEN)
+  FLASH->ACR &= ~(FLASH_ACR_ICEN | FLASH_ACR_DCEN);
+  FLASH->ACR |= (FLASH_ACR_ICRST | FLASH_ACR_DCRST);
+  FLASH->ACR &= ~(FLASH_ACR_ICRST | FLASH_ACR_DCRST);
+  if ((flags & BENCH_CFG_FLASH) != 0U)
+  {
+    FLASH->ACR |= (FLASH_ACR_ICEN | FLASH_ACR_DCEN);
+  }
+#endif
+
+#if (__CORTEX_M == 7U)
+  if ((flags & BENCH_CFG_ICACHE) != 0U)
+  {
+    SCB_EnableICache();
+  }
+  else
+  {
+    SCB_DisableICache();
+  }
+
+  if ((flags & BENCH_CFG_DCACHE) != 0U)
+  {
+    SCB_EnableDCache();
+  }
+  else
+  {
+    SCB_DisableDCache();
+  }
+#endif
+}
+
+/* ----------------------------------------------------------------------
+* Layers
+* ------------------------------------------------------------------- */
+static uint32_t bench_rand(void)
+{
+  bench_seed = (bench_seed * 1664525U) + 1013904223U;
+  return bench_seed;
+}
+
+/* Fill 'nbr' 32-bit words with pseudo-random bytes */
+static void bench_fill(uint32_t *buf, uint32_t nbr)
+{
+  uint32_t i;
+
+  for (i = 0U; i < nbr; i++)
+  {
+    buf[i] = bench_rand();
+  }
+}
+
+/* Fill 'nbr' floats with pseudo-random values within [-1, 1) */
+static void bench_fill_f32(float32_t *buf, uint32_t nbr)
+{
+  uint32_t i;
+
+  for (i = 0U; i < nbr; i++)
+  {
+    buf[i] = (float32_t)((int32_t)bench_rand() >> 8) / 8388608.0f;
+  }
+}
+
+/* Return the best cycle count of a layer */
+static uint32_t bench_run(bench_layer_t layer)
+{
+  arm_matrix_instance_f32 mat_wt;
+  arm_matrix_instance_f32 mat_in;
+  arm_matrix_instance_f32 mat_out;
+  q7_t *in = (q7_t *)bench_in;
+  q7_t *out = (q7_t *)bench_out;
+  q7_t *wt = (q7_t *)bench_wt;
+  q7_t *bias = (q7_t *)bench_bias;
+  uint32_t best = 0xFFFFFFFFU;
+  uint32_t start;
+  uint32_t cycles;
+  uint32_t n;
+
+  /* Data generation is not part of the measurement */
+  bench_fill(bench_in, sizeof(bench_in) / 4U);
+  bench_fill(bench_bias, sizeof(bench_bias) / 4U);
+  if (layer == BENCH_FC_F32)
+  {
+    bench_fill_f32((float32_t *)bench_wt, BENCH_FC_IN * BENCH_FC_OUT);
+    bench_fill_f32(bench_vec_f32, BENCH_FC_IN);
+    arm_mat_init_f32(&mat_wt, BENCH_FC_OUT, BENCH_FC_IN, (float32_t *)bench_wt);
+    arm_mat_init_f32(&mat_in, BENCH_FC_IN, 1U, bench_vec_f32);
+    arm_mat_init_f32(&mat_out, BENCH_FC_OUT, 1U, bench_out_f32);
+  }
+  else
+  {
+    bench_fill(bench_wt, sizeof(bench_wt) / 4U);
+  }
+
+  for (n = 0U; n < BENCH_REPEAT; n++)
+  {
+    start = bench_timer_get();
+
+    switch (layer)
+    {
+    case BENCH_CONV:
+      (void)arm_convolve_HWC_q7_basic(in, BENCH_IN_DIM, BENCH_IN_CH, wt, BENCH_CH,
+                                      BENCH_KERNEL, 1U, 1U, bias, 0U, 7U,
+                                      out, BENCH_IN_DIM, bench_scratch);
+      break;
+
+    case BENCH_DWCONV:
+      (void)arm_depthwise_separable_conv_HWC_q7(in, BENCH_IN_DIM, BENCH_CH, wt, BENCH_CH,
+                                                BENCH_KERNEL, 1U, 1U, bias, 0U, 7U,
+                                                out, BENCH_IN_DIM, bench_scratch);
+      break;
+
+    case BENCH_PWCONV:
+      (void)arm_convolve_HWC_q7_basic(in, BENCH_IN_DIM, BENCH_CH, wt, BENCH_CH,
+                                      1U, 0U, 1U, bias, 0U, 7U,
+                                      out, BENCH_IN_DIM, bench_scratch);
+      break;
+
+    case BENCH_RELU_Q7:
+      arm_relu_q7(in, BENCH_IN_DIM * BENCH_IN_DIM * BENCH_CH);
+      break;
+
+    case BENCH_MAXPOOL:
+      arm_maxpool_q7_HWC(in, BENCH_IN_DIM, BENCH_CH, 2U, 0U, 2U, BENCH_POOL_DIM, out);
+      break;
+
+    case BENCH_AVEPOOL:
+      arm_avepool_q7_HWC(in, BENCH_IN_DIM, BENCH_CH, 2U, 0U, 2U, BENCH_POOL_DIM, out);
+      break;
+
+    case BENCH_FC_Q7:
+      (void)arm_fully_connected_q7(in, wt, BENCH_FC_IN, BENCH_FC_OUT, 0U, 7U, bias,
+                                   out, bench_scratch);
+      break;
+
+    case BENCH_FC_F32:
+      (void)arm_mat_mult_f32(&mat_wt, &mat_in, &mat_out);
+      break;
+
+    case BENCH_FC_Q15:
+      (void)arm_fully_connected_q15((q15_t *)in, (q15_t *)wt, BENCH_FC16_IN, BENCH_FC16_OUT,
+                                    0U, 15U, (q15_t *)bias, (q15_t *)out);
+      break;
+
+    case BENCH_RELU_Q15:
+      arm_relu_q15((q15_t *)in, (BENCH_IN_DIM * BENCH_IN_DIM * BENCH_CH) / 2U);
+      break;
+
+    default:
+      arm_softmax_q7(in, BENCH_FC_OUT, out);
+      break;
+    }
+
+    cycles = bench_timer_elapsed(start, bench_timer_get());
+    if (cycles < best)
+    {
+      best = cycles;
+    }
+  }
+
+  return best;
+}
+
+/* ----------------------------------------------------------------------
+* NN benchmark
+* ------------------------------------------------------------------- */
+
+int32_t main(void)
+{
+  uint32_t cfg;
+  uint32_t layer;
+  uint32_t cycles;
+
+  bench_timer_init();
+
+  bench_puts("\r\nCMSIS-NN kernels benchmark, SystemCoreClock ");
+  bench_putu(SystemCoreClock, 1U, 0U);
+  bench_puts(" Hz\r\nlayer;config;cycles;time_us;macs\r\n");
+
+  for (cfg = 0U; cfg < (sizeof(bench_configs) / sizeof(bench_configs[0])); cfg++)
+  {
+    bench_apply_config(bench_configs[cfg].flags);
+
+    for (layer = 0U; layer < (uint32_t)BENCH_LAYER_NBR; layer++)
+    {
+      bench_seed = layer;
+      cycles = bench_run((bench_layer_t)layer);
+
+      bench_puts(bench_names[layer]);
+      bench_putchar(';');
+      bench_puts(bench_configs[cfg].name);
+      bench_putchar(';');
+      bench_putu(cycles, 1U, 0U);
+      bench_putchar(';');
+      /* time in hundredths of a microsecond */
+      bench_putu((uint32_t)(((uint64_t)cycles * 100000000U) / SystemCoreClock), 3U, 2U);
+      bench_putchar(';');
+      bench_putu(bench_macs[layer], 1U, 0U);
+      bench_puts("\r\n");
+    }
+  }
+
+  bench_puts("done\r\n");
+
+  while(1);                             /* main function does not return */
+}
+
+ /** \endlink */
@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_fully_connected_q15.c
+ * Description:  Q15 basic fully-connected layer function
+ *
+ * $Date:        17. January 2018
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup FC
+ * @{
+ */
+
+  /**
+   * @brief Q15 basic fully-connected layer function
+   * @param[in]       pV          pointer to input vector
+   * @param[in]       pM          pointer to matrix weights
+   * @param[in]       dim_vec     length of the vector
+   * @param[in]       num_of_rows number of rows in weight matrix
+   * @param[in]       bias_shift  amount of left-shift for bias
+   * @param[in]       out_shift   amount of right-shift for output
+   * @param[in]       bias        pointer to bias
+   * @param[in,out]   pOut        pointer to output vector
+   * @return     The function returns <code>ARM_MATH_SUCCESS</code>
+   *
+   * @details
+   *
+   * The weight matrix is stored row by row, num_of_rows rows of dim_vec
+   * values. The products are accumulated in 32 bits: the application has
+   * to choose the formats so that the sum of a row cannot overflow.
+   */
+
+arm_status
+arm_fully_connected_q15(const q15_t * pV,
+                        const q15_t * pM,
+                        const uint16_t dim_vec,
+                        const uint16_t num_of_rows,
+                        const uint16_t bias_shift,
+                        const uint16_t out_shift,
+                        const q15_t * bias,
+                        q15_t * pOut)
+{
+  const q15_t *pBias = bias;
+  const q15_t *pA = pM;
+  const q15_t *pB;
+  q31_t     sum;
+  uint16_t  rowCnt, colCnt;
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+  const q15_t *pA2;
+  q31_t     sum2;
+  q31_t     inV1, inV2, inM11, inM12, inM21, inM22;
+
+  /* Run 2 rows at a time */
+  rowCnt = num_of_rows >> 1;
+
+  while (rowCnt > 0u)
+  {
+    pB = pV;
+    pA2 = pA + dim_vec;
+
+    sum = ((q31_t)(*pBias++) << bias_shift) + NN_ROUND(out_shift);
+    sum2 = ((q31_t)(*pBias++) << bias_shift) + NN_ROUND(out_shift);
+
+    colCnt = dim_vec >> 2;
+
+    while (colCnt > 0u)
+    {
+      inV1 = *__SIMD32_CONST(pB);
+      pB += 2;
+      inV2 = *__SIMD32_CONST(pB);
+      pB += 2;
+
+      inM11 = *__SIMD32_CONST(pA);
+      pA += 2;
+      inM12 = *__SIMD32_CONST(pA);
+      pA += 2;
+      inM21 = *__SIMD32_CONST(pA2);
+      pA2 += 2;
+      inM22 = *__SIMD32_CONST(pA2);
+      pA2 += 2;
+
+      sum = __SMLAD(inV1, inM11, sum);
+      sum = __SMLAD(inV2, inM12, sum);
+      sum2 = __SMLAD(inV1, inM21, sum2);
+      sum2 = __SMLAD(inV2, inM22, sum2);
+
+      colCnt--;
+    }
+
+    colCnt = dim_vec & 0x3u;
+
+    while (colCnt > 0u)
+    {
+      sum += (q31_t) * pB * *pA++;
+      sum2 += (q31_t) * pB++ * *pA2++;
+
+      colCnt--;
+    }
+
+    *pOut++ = (q15_t) (__SSAT((sum >> out_shift), 16));
+    *pOut++ = (q15_t) (__SSAT((sum2 >> out_shift), 16));
+
+    /* the next row starts where the second one ends */
+    pA = pA2;
+
+    rowCnt--;
+  }
+
+  /* compute the last odd numbered row if any */
+  if (num_of_rows & 0x1u)
+  {
+    pB = pV;
+
+    sum = ((q31_t)(*pBias) << bias_shift) + NN_ROUND(out_shift);
+
+    colCnt = dim_vec >> 2;
+
+    while (colCnt > 0u)
+    {
+      inV1 = *__SIMD32_CONST(pB);
+      pB += 2;
+      inV2 = *__SIMD32_CONST(pB);
+      pB += 2;
+
+      inM11 = *__SIMD32_CONST(pA);
+      pA += 2;
+      inM12 = *__SIMD32_CONST(pA);
+      pA += 2;
+
+      sum = __SMLAD(inV1, inM11, sum);
+      sum = __SMLAD(inV2, inM12, sum);
+
+      colCnt--;
+    }
+
+    colCnt = dim_vec & 0x3u;
+
+    while (colCnt > 0u)
+    {
+      sum += (q31_t) * pB++ * *pA++;
+
+      colCnt--;
+    }
+
+    *pOut++ = (q15_t) (__SSAT((sum >> out_shift), 16));
+  }
+
+#else
+
+  /* Run the below code for Cortex-M0 and Cortex-M3 */
+
+  rowCnt = num_of_rows;
+
+  while (rowCnt > 0u)
+  {
+    pB = pV;
+
+    sum = ((q31_t)(*pBias++) << bias_shift) + NN_ROUND(out_shift);
+
+    colCnt = dim_vec;
+
+    while (colCnt > 0u)
+    {
+      sum += (q31_t) * pB++ * *pA++;
+
+      colCnt--;
+    }
+
+    *pOut++ = (q15_t) (__SSAT((sum >> out_shift), 16));
+
+    rowCnt--;
+  }
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  /* Return to application */
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of FC group
+ */
@@ -324,7 +324,7 @@ typedef struct os_semaphore_def {
  
 /// Definition structure for memory block allocation.
 /// \note CAN BE CHANGED: \b os_pool_def is implementation specific in every CMSIS-RTOS.
-#if (osCMSIS < 0x20000U)
+#if (osCMSIS < 0x20000U) || defined (OS_MAIL_STATIC)
 typedef struct os_pool_def {
   uint32_t                   pool_sz;   ///< number of items (elements) in the pool
   uint32_t                   item_sz;   ///< size of an item
@@ -354,7 +354,7 @@ typedef struct os_messageQ_def {
  
 /// Definition structure for mail queue.
 /// \note CAN BE CHANGED: \b os_mailQ_def is implementation specific in every CMSIS-RTOS.
-#if (osCMSIS < 0x20000U)
+#if (osCMSIS < 0x20000U) || defined (OS_MAIL_STATIC)
 typedef struct os_mailQ_def {
   uint32_t                  queue_sz;   ///< number of elements in the queue
   uint32_t                   item_sz;   ///< size of an item
@@ -370,6 +370,13 @@ typedef struct os_mailQ_def {
 } osMailQDef_t;
 #endif
  
+#if defined (OS_MAIL_STATIC)
+/// Static storage, in 32-bit words, of a memory pool or a mail queue of \a no items of
+/// \a sz bytes, control block included (Utilities/IPC/os_mail.c).
+#define OS_POOL_WORDS(no, sz)      (4U + ((no) * (((sz) + 3U) / 4U)))
+#define OS_MAILQ_WORDS(no, sz)     (8U + ((no) * (((sz) + 3U) / 4U)) + (4U * (no)))
+#endif
+ 
  
 /// Event structure contains detailed information about an event.
 typedef struct {
@@ -733,6 +740,11 @@ osStatus osSemaphoreDelete (osSemaphoreId semaphore_id);
 #if defined (osObjectsExternal)  // object is external
 #define osPoolDef(name, no, type) \
 extern const osPoolDef_t os_pool_def_##name
+#elif defined (OS_MAIL_STATIC)   // static storage, no heap
+#define osPoolDef(name, no, type) \
+static uint32_t os_pool_m_##name[OS_POOL_WORDS((no), sizeof(type))]; \
+const osPoolDef_t os_pool_def_##name = \
+{ (no), sizeof(type), os_pool_m_##name }
 #else                            // define the object
 #if (osCMSIS < 0x20000U)
 #define osPoolDef(name, no, type) \
@@ -843,6 +855,11 @@ osEvent osMessageGet (osMessageQId queue_id, uint32_t millisec);
 #if defined (osObjectsExternal)  // object is external
 #define osMailQDef(name, queue_sz, type) \
 extern const osMailQDef_t os_mailQ_def_##name
+#elif defined (OS_MAIL_STATIC)   // static storage, no heap
+#define osMailQDef(name, queue_sz, type) \
+static uint32_t os_mailQ_m_##name[OS_MAILQ_WORDS((queue_sz), sizeof(type))]; \
+const osMailQDef_t os_mailQ_def_##name = \
+{ (queue_sz), sizeof(type), os_mailQ_m_##name }
 #else                            // define the object
 #if (osCMSIS < 0x20000U)
 #define osMailQDef(name, queue_sz, type) \
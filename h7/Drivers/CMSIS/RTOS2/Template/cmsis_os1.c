@@ -152,9 +152,9 @@ int32_t osSemaphoreWait (osSemaphoreId semaphore_id, uint32_t millisec) {
 #endif  // Semaphore
 
 
-// Memory Pool
+// Memory Pool, see Utilities/IPC/os_mail.c for static storage
 
-#if (defined(osFeature_Pool) && (osFeature_Pool != 0))
+#if (defined(osFeature_Pool) && (osFeature_Pool != 0)) && !defined(OS_MAIL_STATIC)
 
 osPoolId osPoolCreate (const osPoolDef_t *pool_def) {
 
@@ -234,9 +234,9 @@ osEvent osMessageGet (osMessageQId queue_id, uint32_t millisec) {
 #endif  // Message Queue
 
 
-// Mail Queue
+// Mail Queue, see Utilities/IPC/os_mail.c for static storage
 
-#if (defined(osFeature_MailQ) && (osFeature_MailQ != 0))
+#if (defined(osFeature_MailQ) && (osFeature_MailQ != 0)) && !defined(OS_MAIL_STATIC)
 
 typedef struct os_mail_queue_s {
   osMemoryPoolId_t   mp_id;
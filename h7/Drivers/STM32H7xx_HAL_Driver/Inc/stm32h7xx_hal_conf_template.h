@@ -166,7 +166,13 @@
 #define  VDD_VALUE                    ((uint32_t)3300) /*!< Value of VDD in mv */
 #define  TICK_INT_PRIORITY            ((uint32_t)0x0F) /*!< tick interrupt priority */
 #define  USE_RTOS                     0
+/* #define  USE_HAL_LOCK                 HAL_LOCK_NONE */ /* Default: HAL_LOCK_EXCLUSIVE on Cortex-M3/M4/M7, HAL_LOCK_PRIMASK on Cortex-M0/M0+ */
 #define  USE_SD_TRANSCEIVER           1U               /*!< use uSD Transceiver */
+#define  USE_HAL_DMA_CACHE_MAINTENANCE 0U               /*!< HAL DMA maintains the D-cache of transfer buffers */
+#define  USE_HAL_DMA_BOUNCE_BUFFER    0U               /*!< HAL DMA and SD stage unreachable buffers in bounce buffers */
+#define  USE_HAL_DMA_CHECK            0U               /*!< HAL DMA and SD check transfer buffers, for debug builds */
+#define  USE_HAL_USB_CACHE_MAINTENANCE 1U               /*!< HAL PCD and HCD maintain the D-cache of OTG DMA buffers */
+#define  USE_HAL_TRACE                0U /*!< Record HAL driver events in the trace buffer */
 
 /* ########################### Ethernet Configuration ######################### */
 #define ETH_TX_DESC_CNT         4  /* number of Ethernet Tx DMA descriptors */
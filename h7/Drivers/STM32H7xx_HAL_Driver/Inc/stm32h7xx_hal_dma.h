@@ -193,6 +193,26 @@ typedef struct __DMA_HandleTypeDef
 
  uint32_t                         DMAmuxRequestGenStatusMask;                                       /*!< DMAMUX request generator Status mask          */
 
+#if (USE_HAL_DMA_CACHE_MAINTENANCE == 1U)
+ uint32_t                         CacheAddress;                                                     /*!< Destination start for D-cache upkeep          */
+
+ uint32_t                         CacheSize;                                                        /*!< Destination size in bytes                     */
+#endif /* USE_HAL_DMA_CACHE_MAINTENANCE */
+
+#if (USE_HAL_DMA_BOUNCE_BUFFER == 1U)
+ void                             *BounceSrc;                                                       /*!< Bounce buffer of the source, NULL if none     */
+
+ void                             *BounceDst;                                                       /*!< Bounce buffer of the destination, NULL if none */
+
+ uint32_t                         BounceSrcAddress;                                                 /*!< Source given by the application               */
+
+ uint32_t                         BounceDstAddress;                                                 /*!< Destination given by the application          */
+
+ uint32_t                         BounceSize;                                                       /*!< Transfer size in bytes                        */
+
+ uint32_t                         BounceDone;                                                       /*!< Destination bytes copied back                 */
+#endif /* USE_HAL_DMA_BOUNCE_BUFFER */
+
 }DMA_HandleTypeDef;
 
 /**
@@ -222,11 +242,30 @@ typedef struct __DMA_HandleTypeDef
 #define HAL_DMA_ERROR_SYNC            (0x00000200U)    /*!< DMAMUX sync overrun  error              */
 #define HAL_DMA_ERROR_REQGEN          (0x00000400U)    /*!< DMAMUX request generator overrun  error */
 #define HAL_DMA_ERROR_BUSY            (0x00000800U)    /*!< DMA Busy                          error */
+#define HAL_DMA_ERROR_BOUNCE          (0x00001000U)    /*!< No bounce buffer for an unreachable buffer */
 
 /**
   * @}
   */
 
+#if (USE_HAL_DMA_CHECK == 1U)
+/** @defgroup DMA_Check_Violations DMA Check Violations
+  * @brief    Violations reported by HAL_DMA_CheckBuffer()
+  * @{
+  */
+#define HAL_DMA_CHECK_REACH           (0x00000001U)    /*!< Buffer not reachable by the master                 */
+#define HAL_DMA_CHECK_ALIGN_DATA      (0x00000002U)    /*!< Buffer not aligned on the memory data size         */
+#define HAL_DMA_CHECK_ALIGN_CACHE     (0x00000004U)    /*!< Cached buffer written by the master not made of
+                                                            whole D-cache lines                                */
+#define HAL_DMA_CHECK_CACHE           (0x00000008U)    /*!< Cached buffer, without HAL D-cache maintenance     */
+#define HAL_DMA_CHECK_STACK           (0x00000010U)    /*!< Buffer on the main stack                           */
+#define HAL_DMA_CHECK_OVERLAP         (0x00000020U)    /*!< Buffer shared with another ongoing transfer writing
+                                                            either of them                                     */
+/**
+  * @}
+  */
+#endif /* USE_HAL_DMA_CHECK */
+
 /** @defgroup DMA_Request_selection DMA Request selection
   * @brief    DMA Request selection
   * @{
@@ -624,6 +663,21 @@ typedef struct __DMA_HandleTypeDef
   */
 #define __HAL_DMA_RESET_HANDLE_STATE(__HANDLE__) ((__HANDLE__)->State = HAL_DMA_STATE_RESET)
 
+#if (USE_HAL_DMA_CHECK == 1U)
+/**
+  * @brief  Return address of the running function, given as Caller to the
+  *         DMA check functions. 0 when the compiler has no equivalent.
+  * @retval Address
+  */
+#if defined(__GNUC__)
+#define __HAL_DMA_CALLER_ADDRESS()  ((uint32_t)__builtin_return_address(0))
+#elif defined(__CC_ARM)
+#define __HAL_DMA_CALLER_ADDRESS()  ((uint32_t)__return_address())
+#else
+#define __HAL_DMA_CALLER_ADDRESS()  (0U)
+#endif
+#endif /* USE_HAL_DMA_CHECK */
+
 /**
   * @brief  Return the current DMA Stream FIFO filled level.
   * @param  __HANDLE__: DMA handle
@@ -1016,6 +1070,41 @@ uint32_t             HAL_DMA_GetError(DMA_HandleTypeDef *hdma);
 /**
   * @}
   */
+
+#if (USE_HAL_DMA_BOUNCE_BUFFER == 1U) || (USE_HAL_DMA_CHECK == 1U)
+/** @defgroup DMA_Exported_Functions_Group4 Bounce buffer functions
+  * @brief    Bounce buffer functions
+  * @{
+  */
+uint32_t HAL_DMA_IsReachable(uint32_t Master, uint32_t Address, uint32_t Size);
+#endif /* USE_HAL_DMA_BOUNCE_BUFFER || USE_HAL_DMA_CHECK */
+#if (USE_HAL_DMA_BOUNCE_BUFFER == 1U)
+void    *HAL_DMA_BounceAlloc(uint32_t Master, uint32_t Address, uint32_t Size);
+void     HAL_DMA_BounceCopyIn(void *pBounce, uint32_t Address, uint32_t Offset, uint32_t Size);
+void     HAL_DMA_BounceCopyOut(void *pBounce, uint32_t Address, uint32_t Offset, uint32_t Size);
+void     HAL_DMA_BounceFree(uint32_t Master, void *pBounce);
+void    *HAL_DMA_BounceAllocCallback(uint32_t Master, uint32_t Address, uint32_t Size);
+void     HAL_DMA_BounceFreeCallback(uint32_t Master, void *pBounce);
+void     HAL_DMA_BounceCopyCallback(void *pDst, const void *pSrc, uint32_t Size);
+#endif /* USE_HAL_DMA_BOUNCE_BUFFER */
+#if (USE_HAL_DMA_BOUNCE_BUFFER == 1U) || (USE_HAL_DMA_CHECK == 1U)
+/**
+  * @}
+  */
+#endif /* USE_HAL_DMA_BOUNCE_BUFFER || USE_HAL_DMA_CHECK */
+
+#if (USE_HAL_DMA_CHECK == 1U)
+/** @defgroup DMA_Exported_Functions_Group5 Buffer check functions
+  * @brief    Buffer check functions
+  * @{
+  */
+uint32_t HAL_DMA_CheckBuffer(uint32_t Master, uint32_t Address, uint32_t Size, uint32_t Width, uint32_t Write);
+void     HAL_DMA_CheckReport(uint32_t Master, uint32_t Address, uint32_t Violations, uint32_t Caller);
+void     HAL_DMA_CheckCallback(uint32_t Master, uint32_t Address, uint32_t Violations, uint32_t Caller);
+/**
+  * @}
+  */
+#endif /* USE_HAL_DMA_CHECK */
 /**
   * @}
   */
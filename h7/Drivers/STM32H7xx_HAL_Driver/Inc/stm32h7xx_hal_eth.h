@@ -110,6 +110,17 @@ typedef struct
   
   uint32_t  CurTxDesc;               /*<! Current Tx descriptor index for packet transmission */
   
+  void      *PacketData[ETH_TX_DESC_CNT]; /*<! pData of the packet ending at each Tx descriptor */
+
+  uint32_t  ReleaseTxDesc;           /*<! Oldest Tx descriptor not yet released */
+
+  uint32_t  TxDescInUse;             /*<! Tx descriptors given to the DMA and not yet released */
+
+  uint32_t  PacketsNoIT;             /*<! Packets sent since the last Tx interrupt request */
+
+  uint64_t  TimeStamp;               /*<! PTP transmit timestamp of the packet given to HAL_ETH_TxPacketCpltCallback():
+                                          seconds in bits [63:32], subseconds in bits [31:0], 0 if none captured */
+
 }ETH_TxDescListTypeDef;
 /** 
   * 
@@ -157,6 +168,9 @@ typedef struct
   uint32_t InnerVlanCtrl;          /*!< Specifies Inner VLAN Tag insertion control only when Inner VLAN is enabled. 
                                         This parameter can be a value of @ref ETH_Tx_Packet_Inner_VLAN_Control   */
   
+  void *pData;                     /*!< Application reference of the packet, given back as is by
+                                        HAL_ETH_TxPacketCpltCallback() once the packet is sent */
+
 }ETH_TxPacketConfig;
 /** 
   * 
@@ -180,6 +194,10 @@ typedef struct
   
   uint32_t ItMode;                      /*<! If 1, DMA will generate the Rx complete interrupt.
                                              If 0, DMA will not generate the Rx complete interrupt. */ 
+  
+  uint32_t RxBuildDescIdx;              /*<! First descriptor waiting for a buffer from HAL_ETH_RxAllocateCallback(). */
+  
+  uint32_t RxBuildDescCnt;              /*<! Number of descriptors waiting for a buffer from HAL_ETH_RxAllocateCallback(). */
 }ETH_RxDescListTypeDef;
 /** 
   * 
@@ -218,6 +236,40 @@ typedef struct
                                  This parameter can be a combination of @ref ETH_Rx_Error_Code */
 
 } ETH_RxPacketInfo;
+
+/** 
+  * @brief  ETH Rx packet metadata structure definition
+  */
+typedef struct
+{
+  uint32_t                   Length;        /*!< Packet length in bytes, as returned by HAL_ETH_GetRxDataLength() */
+
+  uint32_t                   Checksum;      /*!< Hardware checksum verification result.
+                                                 This parameter can be a combination of @ref ETH_Packet_Meta_Checksum */
+
+  uint32_t                   VlanTag;       /*!< Outer VLAN tag control information, 0 if the packet is not tagged */
+
+  uint64_t                   TimeStamp;     /*!< PTP hardware timestamp: seconds in bits [63:32], subseconds
+                                                 in bits [31:0]. 0 if no timestamp was captured */
+
+} ETH_PacketMetaTypeDef;
+
+/** 
+  * @brief  ETH Rx packet metadata ring structure definition
+  */
+typedef struct
+{
+  ETH_PacketMetaTypeDef      *pEntries;     /*!< Ring entries, provided by the application */
+
+  uint32_t                   Size;          /*!< Number of entries of the ring */
+
+  __IO uint32_t              Head;          /*!< Next entry written by the driver */
+
+  __IO uint32_t              Tail;          /*!< Next entry read by the application */
+
+  uint32_t                   Dropped;       /*!< Number of metadata lost because the ring was full */
+
+} ETH_PacketMetaRingTypeDef;
 /** 
   * 
   */
@@ -419,6 +471,45 @@ typedef enum
   * 
   */
 
+/** 
+  * @brief  ETH PHY register transfer structure definition
+  */
+typedef struct __ETH_PHYTransferTypeDef
+{
+  uint32_t                   PHYAddr;       /*!< PHY port address, must be a value from 0 to 31     */
+
+  uint32_t                   PHYReg;        /*!< PHY register address, must be a value from 0 to 31 */
+
+  uint32_t                   RegValue;      /*!< Value to write, or value read once the transfer is completed */
+
+  uint32_t                   Operation;     /*!< Transfer direction, set by the driver.
+                                                 This parameter can be a value of @ref ETH_PHY_Operation */
+
+  __IO HAL_StatusTypeDef     Status;        /*!< HAL_BUSY while queued, then HAL_OK or HAL_TIMEOUT */
+
+  struct __ETH_PHYTransferTypeDef *pNext;   /*!< Queue link, reserved for the driver */
+
+} ETH_PHYTransferTypeDef;
+
+/**
+  * @brief  ETH interrupt moderation structure definition
+  */
+typedef struct
+{
+  uint32_t                   RxPacketCount; /*!< Rx descriptors completed per receive interrupt, 0 or 1 for
+                                                 an interrupt per descriptor */
+
+  uint32_t                   RxWatchdog;    /*!< Receive interrupt watchdog (RIWT), in units of 256 bus clock
+                                                 cycles: the receive interrupt is raised this long after a
+                                                 descriptor completed without interrupt request.
+                                                 This parameter can be a value from 0x0 to 0xFF, 0 disables the
+                                                 watchdog. It must not be 0 when RxPacketCount is above 1 */
+
+  uint32_t                   TxPacketCount; /*!< Packets sent by HAL_ETH_Transmit_IT() per transmit interrupt,
+                                                 0 or 1 for an interrupt per packet */
+
+} ETH_ITModerationTypeDef;
+
 /** 
   * @brief  ETH Handle Structure definition  
   */
@@ -458,6 +549,25 @@ typedef struct
   __IO uint32_t              MACLPIEvent;               /*!< Holds the LPI event when the an LPI status interrupt occurs.
                                                              This parameter can be a value of @ref ETHEx_LPI_Event */
 
+  __IO uint32_t              LinkStatus;                /*!< Link status read by the link poller
+                                                             This parameter can be a value of @ref ETH_Link_Status */
+
+  ETH_PHYTransferTypeDef     *pPHYXferHead;             /*!< PHY register transfer in progress, NULL when idle */
+
+  ETH_PHYTransferTypeDef     *pPHYXferTail;             /*!< Last queued PHY register transfer */
+
+  uint32_t                   PHYXferTickStart;          /*!< Start tick of the PHY register transfer in progress */
+
+  ETH_PHYTransferTypeDef     LinkPollXfer;              /*!< PHY register transfer of the link poller */
+
+  uint32_t                   LinkPollPeriod;            /*!< Link poll period in milliseconds, 0 when stopped */
+
+  uint32_t                   LinkPollTick;              /*!< Tick of the last link poll */
+
+  ETH_PacketMetaRingTypeDef  MetaRing;                  /*!< Rx packet metadata ring */
+
+  ETH_ITModerationTypeDef    ITModeration;              /*!< Rx and Tx interrupt moderation, set by HAL_ETH_ConfigITModeration() */
+
 } ETH_HandleTypeDef;
 /** 
   * 
@@ -874,6 +984,24 @@ typedef struct{
   * @}
   */
 
+/** @defgroup ETH_PHY_Operation ETH PHY Operation
+  * @{
+  */
+#define ETH_PHY_OPERATION_READ     ((uint32_t)0x00000000U)   /*!< PHY register read  */
+#define ETH_PHY_OPERATION_WRITE    ((uint32_t)0x00000001U)   /*!< PHY register write */
+/**
+  * @}
+  */
+
+/** @defgroup ETH_Link_Status ETH Link Status
+  * @{
+  */
+#define ETH_LINK_STATUS_DOWN       ((uint32_t)0x00000000U)   /*!< No valid link   */
+#define ETH_LINK_STATUS_UP         ((uint32_t)0x00000001U)   /*!< Valid link      */
+/**
+  * @}
+  */
+
 /** @defgroup ETH_Tx_Packet_Attributes ETH Tx Packet Attributes
   * @{
   */
@@ -883,6 +1011,7 @@ typedef struct{
 #define ETH_TX_PACKETS_FEATURES_INNERVLANTAG  ((uint32_t)0x00000008)
 #define ETH_TX_PACKETS_FEATURES_TSO           ((uint32_t)0x00000010)
 #define ETH_TX_PACKETS_FEATURES_CRCPAD        ((uint32_t)0x00000020)
+#define ETH_TX_PACKETS_FEATURES_TTSE          ((uint32_t)0x00000040)
 /**
   * @}
   */
@@ -951,6 +1080,17 @@ typedef struct{
   * @}
   */
 
+/** @defgroup ETH_Packet_Meta_Checksum ETH Packet Meta Checksum
+  * @{
+  */
+#define ETH_META_CHECKSUM_OK                ((uint32_t)0x00000000U)  /*!< IP header and payload checksums verified by hardware */
+#define ETH_META_CHECKSUM_BYPASSED          ((uint32_t)0x00000001U)  /*!< Not an IP packet, or checksum offload disabled       */
+#define ETH_META_CHECKSUM_IP_HEADER_ERROR   ((uint32_t)0x00000002U)  /*!< IP header checksum error                             */
+#define ETH_META_CHECKSUM_IP_PAYLOAD_ERROR  ((uint32_t)0x00000004U)  /*!< TCP, UDP or ICMP checksum error                      */
+/**
+  * @}
+  */
+
 /** @defgroup ETH_Rx_IP_Header_Type ETH Rx IP Header Type
   * @{
   */
@@ -1515,22 +1655,36 @@ uint8_t           HAL_ETH_IsRxDataAvailable(ETH_HandleTypeDef *heth);
 HAL_StatusTypeDef HAL_ETH_GetRxDataBuffer(ETH_HandleTypeDef *heth, ETH_BufferTypeDef *pBuffer);
 HAL_StatusTypeDef HAL_ETH_GetRxDataLength(ETH_HandleTypeDef *heth, uint32_t *Length);
 HAL_StatusTypeDef HAL_ETH_GetRxDataInfo(ETH_HandleTypeDef *heth, ETH_RxPacketInfo *RxPacketInfo);
+HAL_StatusTypeDef HAL_ETH_ConfigPacketMetaRing(ETH_HandleTypeDef *heth, ETH_PacketMetaTypeDef *pEntries, uint32_t Size);
+HAL_StatusTypeDef HAL_ETH_GetPacketMeta(ETH_HandleTypeDef *heth, ETH_PacketMetaTypeDef *pMeta);
 HAL_StatusTypeDef HAL_ETH_BuildRxDescriptors(ETH_HandleTypeDef *heth);
+HAL_StatusTypeDef HAL_ETH_RefillRxDescriptors(ETH_HandleTypeDef *heth);
 
 HAL_StatusTypeDef HAL_ETH_Transmit(ETH_HandleTypeDef *heth, ETH_TxPacketConfig *pTxConfig, uint32_t Timeout);
 HAL_StatusTypeDef HAL_ETH_Transmit_IT(ETH_HandleTypeDef *heth, ETH_TxPacketConfig *pTxConfig);
+uint32_t          HAL_ETH_ReleaseTxPackets(ETH_HandleTypeDef *heth);
 
 HAL_StatusTypeDef HAL_ETH_WritePHYRegister(ETH_HandleTypeDef *heth, uint32_t PHYAddr, uint32_t PHYReg, uint32_t RegValue);  
 HAL_StatusTypeDef HAL_ETH_ReadPHYRegister(ETH_HandleTypeDef *heth, uint32_t PHYAddr, uint32_t PHYReg, uint32_t *pRegValue); 
+HAL_StatusTypeDef HAL_ETH_WritePHYRegister_IT(ETH_HandleTypeDef *heth, ETH_PHYTransferTypeDef *pXfer);
+HAL_StatusTypeDef HAL_ETH_ReadPHYRegister_IT(ETH_HandleTypeDef *heth, ETH_PHYTransferTypeDef *pXfer);
+void              HAL_ETH_PHY_IRQHandler(ETH_HandleTypeDef *heth);
+HAL_StatusTypeDef HAL_ETH_StartLinkPoll(ETH_HandleTypeDef *heth, uint32_t PHYAddr, uint32_t Period);
+HAL_StatusTypeDef HAL_ETH_StopLinkPoll(ETH_HandleTypeDef *heth);
+uint32_t          HAL_ETH_GetLinkStatus(ETH_HandleTypeDef *heth);
 
 void              HAL_ETH_IRQHandler(ETH_HandleTypeDef *heth);
 void              HAL_ETH_TxCpltCallback(ETH_HandleTypeDef *heth);
+void              HAL_ETH_TxPacketCpltCallback(ETH_HandleTypeDef *heth, void *pData);
 void              HAL_ETH_RxCpltCallback(ETH_HandleTypeDef *heth);
+uint8_t          *HAL_ETH_RxAllocateCallback(ETH_HandleTypeDef *heth);
 void              HAL_ETH_DMAErrorCallback(ETH_HandleTypeDef *heth);
 void              HAL_ETH_MACErrorCallback(ETH_HandleTypeDef *heth);
 void              HAL_ETH_PMTCallback(ETH_HandleTypeDef *heth);
 void              HAL_ETH_EEECallback(ETH_HandleTypeDef *heth);
 void              HAL_ETH_WakeUpCallback(ETH_HandleTypeDef *heth);
+void              HAL_ETH_PHYTransferCpltCallback(ETH_HandleTypeDef *heth, ETH_PHYTransferTypeDef *pXfer);
+void              HAL_ETH_LinkStatusCallback(ETH_HandleTypeDef *heth);
 /**
   * @}
   */
@@ -1545,6 +1699,7 @@ HAL_StatusTypeDef HAL_ETH_GetDMAConfig(ETH_HandleTypeDef *heth, ETH_DMAConfigTyp
 HAL_StatusTypeDef HAL_ETH_SetMACConfig(ETH_HandleTypeDef *heth, ETH_MACConfigTypeDef *macconf);
 HAL_StatusTypeDef HAL_ETH_SetDMAConfig(ETH_HandleTypeDef *heth, ETH_DMAConfigTypeDef *dmaconf);
 void              HAL_ETH_SetMDIOClockRange(ETH_HandleTypeDef *heth);
+HAL_StatusTypeDef HAL_ETH_ConfigITModeration(ETH_HandleTypeDef *heth, ETH_ITModerationTypeDef *pConfig);
 
 /* MAC VLAN Processing APIs    ************************************************/
 void              HAL_ETH_SetRxVLANIdentifier(ETH_HandleTypeDef *heth, uint32_t ComparisonBits, uint32_t VLANIdentifier);
@@ -119,7 +119,9 @@ typedef struct
                                               This parameter must be a number between 1 and 16             */
 
   uint32_t MessageRAMOffset;             /*!< Specifies the message RAM start address.
-                                              This parameter must be a number between 0 and 2560           */
+                                              This parameter must be a number between 0 and 2560, or
+                                              FDCAN_MESSAGE_RAM_OFFSET_AUTO to let HAL_FDCAN_Init() place
+                                              the blocks next to the area used by the other instance       */
 
   uint32_t StdFiltersNbr;                /*!< Specifies the number of standard Message ID filters.
                                               This parameter must be a number between 0 and 128            */
@@ -735,6 +737,21 @@ typedef struct
 
 }FDCAN_HandleTypeDef;
 
+/**
+  * @brief  FDCAN Rx FIFO batch: consecutive elements read in place in the message RAM
+  */
+typedef struct
+{
+  uint32_t *pElement;     /*!< First element of the batch, at the FIFO get index              */
+
+  uint32_t ElementSize;   /*!< Distance between two elements, in bytes                        */
+
+  uint32_t Count;         /*!< Number of elements, never wrapping around the end of the FIFO  */
+
+  uint32_t GetIndex;      /*!< FIFO index of the first element                                */
+
+}FDCAN_RxBatchTypeDef;
+
 
 /**
   * @}
@@ -849,6 +866,15 @@ typedef struct
   * @}
   */
 
+/** @defgroup FDCAN_Message_RAM FDCAN Message RAM
+  * @{
+  */
+#define FDCAN_MESSAGE_RAM_WORDS        ((uint32_t)2560U)        /*!< Message RAM size shared by the instances, in words */
+#define FDCAN_MESSAGE_RAM_OFFSET_AUTO  ((uint32_t)0xFFFFFFFFU)  /*!< Offset chosen by HAL_FDCAN_Init()                  */
+/**
+  * @}
+  */
+
 /** @defgroup FDCAN_data_field_size FDCAN Data Field Size
   * @{
   */
@@ -1777,6 +1803,20 @@ do{                                                              \
   */
 #define __HAL_FDCAN_GET_IT_SOURCE(__HANDLE__, __INTERRUPT__) (((__INTERRUPT__) < FDCAN_IT_CALIB_WATCHDOG_EVENT) ? ((__HANDLE__)->Instance->IE & (__INTERRUPT__)) : ((FDCAN_CCU->IE << 30) & (__INTERRUPT__)))
 
+/** @brief  Return the address of an element of an Rx FIFO batch.
+  * @param  __BATCH__: pointer to a FDCAN_RxBatchTypeDef structure.
+  * @param  __INDEX__: element index in the batch, lower than (__BATCH__)->Count.
+  * @retval Address of the element in the message RAM
+  */
+#define __HAL_FDCAN_RX_BATCH_ELEMENT(__BATCH__, __INDEX__) \
+  ((const uint32_t *)((uint32_t)(__BATCH__)->pElement + ((__INDEX__) * (__BATCH__)->ElementSize)))
+
+/** @brief  Return the payload address of an Rx element.
+  * @param  __ELEMENT__: element address, as returned by __HAL_FDCAN_RX_BATCH_ELEMENT().
+  * @retval Address of the first data byte
+  */
+#define __HAL_FDCAN_RX_ELEMENT_DATA(__ELEMENT__) ((const uint8_t *)&(__ELEMENT__)[2])
+
 /**
   * @brief  Enable the specified FDCAN TT interrupts.
   * @param  __HANDLE__: FDCAN handle.
@@ -1911,6 +1951,10 @@ HAL_StatusTypeDef HAL_FDCAN_GetErrorCounters(FDCAN_HandleTypeDef *hfdcan, FDCAN_
 uint32_t HAL_FDCAN_IsRxBufferMessageAvailable(FDCAN_HandleTypeDef *hfdcan, uint32_t RxBufferIndex);
 uint32_t HAL_FDCAN_IsTxBufferMessagePending(FDCAN_HandleTypeDef *hfdcan, uint32_t TxBufferIndex);
 uint32_t HAL_FDCAN_GetRxFifoFillLevel(FDCAN_HandleTypeDef *hfdcan, uint32_t RxFifo);
+HAL_StatusTypeDef HAL_FDCAN_GetRxFifoBatch(FDCAN_HandleTypeDef *hfdcan, uint32_t RxFifo, FDCAN_RxBatchTypeDef *pBatch);
+HAL_StatusTypeDef HAL_FDCAN_ReleaseRxFifoBatch(FDCAN_HandleTypeDef *hfdcan, uint32_t RxFifo, FDCAN_RxBatchTypeDef *pBatch, uint32_t Count);
+void HAL_FDCAN_GetRxElementHeader(const uint32_t *pElement, FDCAN_RxHeaderTypeDef *pRxHeader);
+uint32_t HAL_FDCAN_GetMessageRAMSize(FDCAN_InitTypeDef *pInit);
 uint32_t HAL_FDCAN_GetTxFifoFreeLevel(FDCAN_HandleTypeDef *hfdcan);
 uint32_t HAL_FDCAN_IsRestrictedOperationMode(FDCAN_HandleTypeDef *hfdcan);
 HAL_StatusTypeDef HAL_FDCAN_ExitRestrictedOperationMode(FDCAN_HandleTypeDef *hfdcan);
@@ -171,6 +171,21 @@ typedef struct
   
 }MDMA_LinkNodeConfTypeDef;
 
+/** 
+  * @brief  HAL MDMA linked list job structure definition  
+  * @note   used with HAL_MDMA_LinkedList_BuildJob and HAL_MDMA_LinkedList_StartJob_IT functions.
+  *         A job is a chain of transfers (stages) compiled once into linked list nodes,
+  *         the first node being loaded into the channel registers at each start.
+  */
+typedef struct
+{ 
+  MDMA_LinkNodeTypeDef *pNodes;     /*!< Nodes arena provided by the application, one node per stage.
+                                         Must be 8 bytes aligned and reachable by the MDMA (not in ITCM) */
+  uint32_t         NodeCount;       /*!< Number of nodes in the arena                             */
+  uint32_t         StageCount;      /*!< Number of stages compiled in the arena, set by the driver */
+
+}MDMA_LinkedListJobTypeDef;
+
 
 /** 
   * @brief  HAL MDMA State structure definition
@@ -644,6 +659,8 @@ HAL_StatusTypeDef HAL_MDMA_LinkedList_AddNode(MDMA_HandleTypeDef *hmdma, MDMA_Li
 HAL_StatusTypeDef HAL_MDMA_LinkedList_RemoveNode(MDMA_HandleTypeDef *hmdma, MDMA_LinkNodeTypeDef *pNode);
 HAL_StatusTypeDef HAL_MDMA_LinkedList_EnableCircularMode(MDMA_HandleTypeDef *hmdma);
 HAL_StatusTypeDef HAL_MDMA_LinkedList_DisableCircularMode(MDMA_HandleTypeDef *hmdma);
+HAL_StatusTypeDef HAL_MDMA_LinkedList_BuildJob(MDMA_LinkedListJobTypeDef *pJob, MDMA_LinkNodeConfTypeDef *pStages, uint32_t StageCount);
+HAL_StatusTypeDef HAL_MDMA_LinkedList_StartJob_IT(MDMA_HandleTypeDef *hmdma, MDMA_LinkedListJobTypeDef *pJob);
 
 
 /**
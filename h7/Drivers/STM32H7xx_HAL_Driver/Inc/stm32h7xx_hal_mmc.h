@@ -163,6 +163,7 @@ typedef struct __MMC_HandleTypeDef
   void (* Read_DMADblBuf1CpltCallback)    (struct __MMC_HandleTypeDef *hmmc);
   void (* Write_DMADblBuf0CpltCallback)   (struct __MMC_HandleTypeDef *hmmc);
   void (* Write_DMADblBuf1CpltCallback)   (struct __MMC_HandleTypeDef *hmmc);
+  void (* CardReadyCallback)              (struct __MMC_HandleTypeDef *hmmc);
 
   void (* MspInitCallback)                (struct __MMC_HandleTypeDef *hmmc);
   void (* MspDeInitCallback)              (struct __MMC_HandleTypeDef *hmmc);
@@ -257,6 +258,7 @@ typedef enum
   HAL_MMC_READ_DMA_DBL_BUF1_CPLT_CB_ID  = 0x05U,  /*!< MMC Rx DMA Double Buffer 1 Complete Callback ID */
   HAL_MMC_WRITE_DMA_DBL_BUF0_CPLT_CB_ID = 0x06U,  /*!< MMC Tx DMA Double Buffer 0 Complete Callback ID */
   HAL_MMC_WRITE_DMA_DBL_BUF1_CPLT_CB_ID = 0x07U,  /*!< MMC Tx DMA Double Buffer 1 Complete Callback ID */
+  HAL_MMC_CARD_READY_CB_ID              = 0x08U,  /*!< MMC Card Ready Callback ID                      */
 
   HAL_MMC_MSP_INIT_CB_ID                = 0x10U,  /*!< MMC MspInit Callback ID                         */
   HAL_MMC_MSP_DEINIT_CB_ID              = 0x11U   /*!< MMC MspDeInit Callback ID                       */
@@ -341,6 +343,8 @@ typedef void (*pMMC_CallbackTypeDef)           (MMC_HandleTypeDef *hmmc);
 #define   MMC_CONTEXT_WRITE_MULTIPLE_BLOCK ((uint32_t)0x00000020U)  /*!< Write multiple blocks operation  */
 #define   MMC_CONTEXT_IT                   ((uint32_t)0x00000008U)  /*!< Process in Interrupt mode        */
 #define   MMC_CONTEXT_DMA                  ((uint32_t)0x00000080U)  /*!< Process in DMA mode              */  
+#define   MMC_CONTEXT_WAIT_READY           ((uint32_t)0x00000200U)  /*!< Wait for the end of programming  */
+#define   MMC_CONTEXT_CLOSED               ((uint32_t)0x00000400U)  /*!< Block count set by CMD23, no stop */
 
 /**
   * @}
@@ -631,6 +635,10 @@ HAL_StatusTypeDef HAL_MMC_WriteBlocks_IT(MMC_HandleTypeDef *hmmc, uint8_t *pData
 HAL_StatusTypeDef HAL_MMC_ReadBlocks_DMA(MMC_HandleTypeDef *hmmc, uint8_t *pData, uint32_t BlockAdd, uint32_t NumberOfBlocks);
 HAL_StatusTypeDef HAL_MMC_WriteBlocks_DMA(MMC_HandleTypeDef *hmmc, uint8_t *pData, uint32_t BlockAdd, uint32_t NumberOfBlocks);
 
+/* Asynchronous wait for the end of card programming */
+HAL_StatusTypeDef HAL_MMC_WaitCardReady_IT(MMC_HandleTypeDef *hmmc);
+HAL_StatusTypeDef HAL_MMC_PollCardReady(MMC_HandleTypeDef *hmmc);
+
 void HAL_MMC_IRQHandler(MMC_HandleTypeDef *hmmc);
 
 /* Callback in non blocking modes (DMA) */
@@ -638,6 +646,7 @@ void HAL_MMC_TxCpltCallback(MMC_HandleTypeDef *hmmc);
 void HAL_MMC_RxCpltCallback(MMC_HandleTypeDef *hmmc);
 void HAL_MMC_ErrorCallback(MMC_HandleTypeDef *hmmc);
 void HAL_MMC_AbortCallback(MMC_HandleTypeDef *hmmc);
+void HAL_MMC_CardReadyCallback(MMC_HandleTypeDef *hmmc);
 
 #if defined (USE_HAL_MMC_REGISTER_CALLBACKS) && (USE_HAL_MMC_REGISTER_CALLBACKS == 1U)
 /* MMC callback registering/unregistering */
@@ -69,6 +69,23 @@ typedef enum
 }HAL_MMCEx_DMABuffer_MemoryTypeDef;
 
 
+/** 
+  * @}
+  */
+
+/** @defgroup MMCEx_Exported_Types_Group2 MMC Packed write entry structure
+  * @{
+  */
+typedef struct
+{
+  uint32_t BlockAdd;          /*!< Block address of the write                                   */
+
+  uint32_t NumberOfBlocks;    /*!< Blocks written, their data follows the one of the previous entry */
+
+  uint32_t Reliable;          /*!< Reliable write of the entry: ENABLE or DISABLE               */
+
+}HAL_MMCEx_PackedEntryTypeDef;
+
 /** 
   * @}
   */
@@ -77,6 +94,35 @@ typedef enum
   * @}
   */  
 /* Exported constants --------------------------------------------------------*/
+/** @defgroup MMCEx_Exported_Constants MMCEx Exported Constants
+  * @{
+  */
+
+/** @defgroup MMCEx_Speed_Mode MMC Bus speed modes
+  * @{
+  */
+#define MMC_SPEED_MODE_DEFAULT        ((uint32_t)0x00000000U)  /*!< Backward compatible timing, up to 26 MHz        */
+#define MMC_SPEED_MODE_HIGH           ((uint32_t)0x00000001U)  /*!< High speed SDR, up to 52 MHz                    */
+#define MMC_SPEED_MODE_DDR            ((uint32_t)0x00000002U)  /*!< DDR52, both clock edges, 4 or 8-bit bus         */
+#define MMC_SPEED_MODE_HS200          ((uint32_t)0x00000003U)  /*!< HS200, up to 200 MHz, 1.8 V I/O, 4 or 8-bit bus */
+
+#define IS_MMC_SPEED_MODE(MODE)       ((MODE) <= MMC_SPEED_MODE_HS200)
+/**
+  * @}
+  */
+
+/** @defgroup MMCEx_Packed_Write MMC Packed write limits
+  * @{
+  */
+#define MMC_PACKED_MAX_ENTRIES        ((uint32_t)63U)  /*!< Entries of a one block packed header        */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
 /* Exported macro ------------------------------------------------------------*/
 /* Exported functions --------------------------------------------------------*/
 /** @defgroup MMCEx_Exported_Functions MMCEx Exported Functions
@@ -96,6 +142,24 @@ void HAL_MMCEx_Read_DMADoubleBuffer1CpltCallback(MMC_HandleTypeDef *hmmc);
 void HAL_MMCEx_Write_DMADoubleBuffer0CpltCallback(MMC_HandleTypeDef *hmmc);
 void HAL_MMCEx_Write_DMADoubleBuffer1CpltCallback(MMC_HandleTypeDef *hmmc);
 
+/**
+  * @}
+  */
+
+/** @defgroup MMCEx_Exported_Functions_Group2 Bus speed functions
+  * @{
+  */
+HAL_StatusTypeDef HAL_MMCEx_ConfigSpeedBusOperation(MMC_HandleTypeDef *hmmc, uint32_t SpeedMode);
+HAL_StatusTypeDef HAL_MMCEx_ExecuteTuning(MMC_HandleTypeDef *hmmc);
+/**
+  * @}
+  */
+
+/** @defgroup MMCEx_Exported_Functions_Group3 Reliable and packed write functions
+  * @{
+  */
+HAL_StatusTypeDef HAL_MMCEx_WriteBlocksReliable_DMA(MMC_HandleTypeDef *hmmc, uint8_t *pData, uint32_t BlockAdd, uint32_t NumberOfBlocks);
+HAL_StatusTypeDef HAL_MMCEx_WritePacked_DMA(MMC_HandleTypeDef *hmmc, uint8_t *pData, const HAL_MMCEx_PackedEntryTypeDef *pEntries, uint32_t EntryNbr);
 /**
   * @}
   */
@@ -93,7 +93,11 @@ typedef struct
   PCD_EPTypeDef           OUT_ep[16]; /*!< OUT endpoint parameters            */ 
   HAL_LockTypeDef         Lock;       /*!< PCD peripheral status              */
   __IO PCD_StateTypeDef   State;      /*!< PCD communication state            */
+#if (USE_HAL_USB_CACHE_MAINTENANCE == 1U)
+  uint32_t                Setup[16] __attribute__((aligned(32))); /*!< Setup packet buffer, alone on its D-cache lines */
+#else
   uint32_t                Setup[12];  /*!< Setup packet buffer                */
+#endif /* USE_HAL_USB_CACHE_MAINTENANCE */
   PCD_LPM_StateTypeDef    LPM_State;    /*!< LPM State                          */
   uint32_t                BESL;
   uint32_t                lpm_active;   /*!< Enable or disable the Link Power Management .                                  
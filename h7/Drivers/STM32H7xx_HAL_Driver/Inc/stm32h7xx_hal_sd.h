@@ -160,6 +160,14 @@ typedef struct __SD_HandleTypeDef
 
   uint32_t                     CID[4];           /*!< SD card identification number table */
 
+#if (USE_HAL_DMA_BOUNCE_BUFFER == 1U)
+  void                         *BounceBuffer;    /*!< Bounce buffer of the DMA transfer, NULL if none */
+
+  uint32_t                     BounceAddress;    /*!< Buffer given by the application     */
+
+  uint32_t                     BounceSize;       /*!< Size of the bounce buffer in bytes  */
+#endif /* USE_HAL_DMA_BOUNCE_BUFFER */
+
 }SD_HandleTypeDef;
 
 /**
@@ -322,6 +330,7 @@ typedef struct
 #define   SD_CONTEXT_WRITE_MULTIPLE_BLOCK ((uint32_t)0x00000020U)  /*!< Write multiple blocks operation  */
 #define   SD_CONTEXT_IT                   ((uint32_t)0x00000008U)  /*!< Process in Interrupt mode        */
 #define   SD_CONTEXT_DMA                  ((uint32_t)0x00000080U)  /*!< Process in DMA mode              */
+#define   SD_CONTEXT_WAIT_READY           ((uint32_t)0x00000200U)  /*!< Wait for the end of programming  */
 
 /**
   * @}
@@ -603,6 +612,10 @@ HAL_StatusTypeDef HAL_SD_WriteBlocks_IT(SD_HandleTypeDef *hsd, uint8_t *pData, u
 HAL_StatusTypeDef HAL_SD_ReadBlocks_DMA(SD_HandleTypeDef *hsd, uint8_t *pData, uint32_t BlockAdd, uint32_t NumberOfBlocks);
 HAL_StatusTypeDef HAL_SD_WriteBlocks_DMA(SD_HandleTypeDef *hsd, uint8_t *pData, uint32_t BlockAdd, uint32_t NumberOfBlocks);
 
+/* Asynchronous wait for the end of card programming */
+HAL_StatusTypeDef HAL_SD_WaitCardReady_IT(SD_HandleTypeDef *hsd);
+HAL_StatusTypeDef HAL_SD_PollCardReady(SD_HandleTypeDef *hsd);
+
 void HAL_SD_IRQHandler(SD_HandleTypeDef *hsd);
 
 /* Callback in non blocking modes (DMA) */
@@ -610,6 +623,7 @@ void HAL_SD_TxCpltCallback(SD_HandleTypeDef *hsd);
 void HAL_SD_RxCpltCallback(SD_HandleTypeDef *hsd);
 void HAL_SD_ErrorCallback(SD_HandleTypeDef *hsd);
 void HAL_SD_AbortCallback(SD_HandleTypeDef *hsd);
+void HAL_SD_CardReadyCallback(SD_HandleTypeDef *hsd);
 
 #if (USE_SD_TRANSCEIVER != 0U)
 /* Callback to switch in 1.8V mode */
@@ -69,6 +69,7 @@
 
 
 #define DLYB_MAX_UNIT   ((uint32_t)0x00000080U) /*!< Max UNIT value (128)  */
+#define DLYB_MAX_SELECT ((uint32_t)0x0000000CU) /*!< Max SEL value (12)    */
 
 /** @defgroup DLYB_Instance DLYB Instance
   * @{
@@ -90,6 +91,8 @@
   */
 HAL_StatusTypeDef DelayBlock_Enable(DLYB_TypeDef *dlyb);
 HAL_StatusTypeDef DelayBlock_Disable(DLYB_TypeDef *dlyb);
+uint32_t          DelayBlock_GetPhases(DLYB_TypeDef *dlyb);
+HAL_StatusTypeDef DelayBlock_SetPhase(DLYB_TypeDef *dlyb, uint32_t Phase);
 
 /**
   * @}
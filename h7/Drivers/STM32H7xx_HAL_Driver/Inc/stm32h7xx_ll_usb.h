@@ -168,6 +168,8 @@ typedef struct
   
   uint32_t  xfer_count;     /*!< Partial transfer length in case of multi packet transfer                 */
 
+  uint32_t  xfer_size;      /*!< Transfer size programmed on an OUT endpoint                              */
+
 }USB_OTG_EPTypeDef;
 
 typedef struct
@@ -379,6 +381,9 @@ typedef struct
 #define USBx_INEP(i)    ((USB_OTG_INEndpointTypeDef *)((uint32_t)USBx + USB_OTG_IN_ENDPOINT_BASE + (i)*USB_OTG_EP_REG_SIZE))        
 #define USBx_OUTEP(i)   ((USB_OTG_OUTEndpointTypeDef *)((uint32_t)USBx + USB_OTG_OUT_ENDPOINT_BASE + (i)*USB_OTG_EP_REG_SIZE))        
 #define USBx_DFIFO(i)   *(__IO uint32_t *)((uint32_t)USBx + USB_OTG_FIFO_BASE + (i) * USB_OTG_FIFO_SIZE)
+#if (USE_HAL_USB_CACHE_MAINTENANCE == 1U)
+#define USB_OTG_CACHE_LINE_SIZE   32U   /* Cortex-M7 D-cache line size in bytes */
+#endif /* USE_HAL_USB_CACHE_MAINTENANCE */
 
 #define USBx_HOST       ((USB_OTG_HostTypeDef *)((uint32_t )USBx + USB_OTG_HOST_BASE))  
 #define USBx_HC(i)      ((USB_OTG_HostChannelTypeDef *)((uint32_t)USBx + USB_OTG_HOST_CHANNEL_BASE + (i)*USB_OTG_HOST_CHANNEL_SIZE))
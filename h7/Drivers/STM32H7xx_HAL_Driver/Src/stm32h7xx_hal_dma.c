@@ -50,6 +50,25 @@
 
      (#) Use HAL_DMA_Abort() function to abort the current transfer
 
+     (#) With USE_HAL_DMA_BOUNCE_BUFFER set to 1 in stm32h7xx_hal_conf.h, a memory
+         buffer the stream cannot reach (DTCM or ITCM for DMA1/DMA2, anything but
+         SRAM4 and the backup SRAM for BDMA) is staged through a bounce buffer
+         given by HAL_DMA_BounceAllocCallback(): the source is copied into it
+         when the transfer starts, the destination copied back at the half
+         transfer, transfer complete and abort. Without a bounce buffer the
+         transfer fails with HAL_DMA_ERROR_BOUNCE. Utilities/DMA/dma_bounce
+         implements the callbacks over the dma_pool buffers. The double buffer
+         mode of HAL_DMAEx_MultiBufferStart() is not staged.
+
+     (#) With USE_HAL_DMA_CHECK set to 1 in stm32h7xx_hal_conf.h, meant for debug
+         builds, HAL_DMA_Start() and HAL_DMA_Start_IT() check the memory buffers of
+         each transfer: reachability by the stream, alignment on the memory data
+         size and, for cacheable memory per the MPU, on D-cache lines, cache
+         maintenance, buffers on the main stack and buffers shared with another
+         ongoing transfer. Violations are recorded in the HAL trace buffer with
+         the caller address and given to HAL_DMA_CheckCallback(); the transfer is
+         started anyway. HAL_DMA_CheckBuffer() checks the buffers of other masters.
+
      -@-   In Memory-to-Memory transfer mode, Circular mode is not allowed.
 
      -@-   The FIFO is used mainly to reduce bus usage and to allow data packing/unpacking: it is
@@ -130,6 +149,18 @@ typedef struct
   __IO uint32_t IFCR;  /*!< DMA interrupt flag clear register */
 } DMA_Base_Registers;
 
+#if (USE_HAL_DMA_CHECK == 1U)
+/* Memory buffer of a transfer started, to detect overlaps */
+typedef struct
+{
+  DMA_HandleTypeDef *hdma;     /* Stream, NULL for a free entry             */
+  uint32_t          Address;   /* Start of the buffer                       */
+  uint32_t          Size;      /* Size of the buffer in bytes               */
+  uint32_t          Write;     /* 1 when the stream writes the buffer       */
+  uint32_t          Side;      /* 1 for the destination of memory to memory */
+} DMA_CheckTransferTypeDef;
+#endif /* USE_HAL_DMA_CHECK */
+
 /* Private variables ---------------------------------------------------------*/
 /* Private constants ---------------------------------------------------------*/
 /** @addtogroup DMA_Private_Constants
@@ -160,6 +191,23 @@ typedef struct
 /**
   * @}
   */
+#if (USE_HAL_DMA_CACHE_MAINTENANCE == 1U)
+#define DMA_CACHE_LINE_SIZE    32U      /* Cortex-M7 D-cache line size in bytes */
+#endif /* USE_HAL_DMA_CACHE_MAINTENANCE */
+#if (USE_HAL_DMA_BOUNCE_BUFFER == 1U) || (USE_HAL_DMA_CHECK == 1U)
+#define DMA_ITCM_SIZE          0x10000U  /* ITCM RAM, reached by the CPU and MDMA only      */
+#define DMA_DTCM_SIZE          0x20000U  /* DTCM RAM, reached by the CPU and MDMA only      */
+#define DMA_D3_SRAM_SIZE       0x10000U  /* SRAM4, reached by BDMA                          */
+#define DMA_D3_BKPSRAM_SIZE    0x1000U   /* Backup SRAM, reached by BDMA                    */
+#define DMA_AXISRAM_SIZE       0x80000U  /* AXI SRAM, reached by the D1 masters (SDMMC1)    */
+#endif /* USE_HAL_DMA_BOUNCE_BUFFER || USE_HAL_DMA_CHECK */
+#if (USE_HAL_DMA_CHECK == 1U)
+#define DMA_CHECK_CACHE_LINE_SIZE       32U   /* Cortex-M7 D-cache line size in bytes         */
+#define DMA_CHECK_TRANSFERS             16U   /* Memory buffers of ongoing transfers followed */
+#define DMA_CHECK_POLICY_NONE           0U    /* Not cached                                   */
+#define DMA_CHECK_POLICY_WRITE_THROUGH  1U    /* Cached, write-through                        */
+#define DMA_CHECK_POLICY_WRITE_BACK     2U    /* Cached, write-back                           */
+#endif /* USE_HAL_DMA_CHECK */
 /* Private macros ------------------------------------------------------------*/
 /* Private functions ---------------------------------------------------------*/
 /** @addtogroup DMA_Private_Functions
@@ -168,6 +216,22 @@ typedef struct
 static void DMA_SetConfig(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress, uint32_t DataLength);
 static uint32_t DMA_CalcBaseAndBitshift(DMA_HandleTypeDef *hdma);
 static HAL_StatusTypeDef DMA_CheckFifoParam(DMA_HandleTypeDef *hdma);
+#if (USE_HAL_DMA_CACHE_MAINTENANCE == 1U)
+static void DMA_CacheStart(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress, uint32_t DataLength);
+static void DMA_CacheEnd(DMA_HandleTypeDef *hdma, uint32_t Size);
+#endif /* USE_HAL_DMA_CACHE_MAINTENANCE */
+#if (USE_HAL_DMA_BOUNCE_BUFFER == 1U)
+static HAL_StatusTypeDef DMA_BounceStart(DMA_HandleTypeDef *hdma, uint32_t *pSrcAddress, uint32_t *pDstAddress, uint32_t DataLength);
+static void DMA_BounceEnd(DMA_HandleTypeDef *hdma, uint32_t Size);
+static void DMA_BounceRefresh(DMA_HandleTypeDef *hdma, uint32_t Offset, uint32_t Size);
+static void DMA_BounceAbort(DMA_HandleTypeDef *hdma);
+static void DMA_BounceRelease(DMA_HandleTypeDef *hdma);
+#endif /* USE_HAL_DMA_BOUNCE_BUFFER */
+#if (USE_HAL_DMA_CHECK == 1U)
+static void DMA_CheckStart(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress, uint32_t DataLength, uint32_t Caller);
+static uint32_t DMA_CheckOverlap(DMA_HandleTypeDef *hdma, uint32_t Address, uint32_t Size, uint32_t Write, uint32_t Side);
+static uint32_t DMA_CheckCachePolicy(uint32_t Address);
+#endif /* USE_HAL_DMA_CHECK */
 static void DMA_CalcDMAMUXChannelBaseAndMask(DMA_HandleTypeDef *hdma);
 static void DMA_CalcDMAMUXRequestGenBaseAndMask(DMA_HandleTypeDef *hdma);
 
@@ -419,6 +483,12 @@ HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef *hdma)
     hdma->DMAmuxRequestGenStatusMask = 0U;
   }
 
+#if (USE_HAL_DMA_BOUNCE_BUFFER == 1U)
+  /* No bounce buffer in use */
+  hdma->BounceSrc = NULL;
+  hdma->BounceDst = NULL;
+#endif /* USE_HAL_DMA_BOUNCE_BUFFER */
+
   /* Initialize the error code */
   hdma->ErrorCode = HAL_DMA_ERROR_NONE;
 
@@ -457,6 +527,11 @@ HAL_StatusTypeDef HAL_DMA_DeInit(DMA_HandleTypeDef *hdma)
   /* Disable the selected DMA Streamx */
   __HAL_DMA_DISABLE(hdma);
 
+#if (USE_HAL_DMA_BOUNCE_BUFFER == 1U)
+  /* Give back the bounce buffers of an unfinished transfer */
+  DMA_BounceRelease(hdma);
+#endif /* USE_HAL_DMA_BOUNCE_BUFFER */
+
   if(IS_D2_DMA_INSTANCE(hdma) != RESET) /*DMA2/DMA1 stream , D2 domain*/
   {
     /* Reset DMA Streamx control register */
@@ -604,6 +679,25 @@ HAL_StatusTypeDef HAL_DMA_Start(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, ui
     /* Disable the peripheral */
     __HAL_DMA_DISABLE(hdma);
 
+#if (USE_HAL_DMA_CHECK == 1U)
+    /* Check the memory buffers, debug builds */
+    DMA_CheckStart(hdma, SrcAddress, DstAddress, DataLength, __HAL_DMA_CALLER_ADDRESS());
+#endif /* USE_HAL_DMA_CHECK */
+
+#if (USE_HAL_DMA_BOUNCE_BUFFER == 1U)
+    /* Stage the memory buffers the stream cannot reach */
+    if(DMA_BounceStart(hdma, &SrcAddress, &DstAddress, DataLength) != HAL_OK)
+    {
+      hdma->ErrorCode = HAL_DMA_ERROR_BOUNCE;
+      hdma->State = HAL_DMA_STATE_READY;
+
+      /* Process unlocked */
+      __HAL_UNLOCK(hdma);
+
+      return HAL_ERROR;
+    }
+#endif /* USE_HAL_DMA_BOUNCE_BUFFER */
+
     /* Configure the source, destination address and the data length */
     DMA_SetConfig(hdma, SrcAddress, DstAddress, DataLength);
 
@@ -653,6 +747,7 @@ HAL_StatusTypeDef HAL_DMA_Start_IT(DMA_HandleTypeDef *hdma, uint32_t SrcAddress,
   {
     /* Change DMA peripheral state */
     hdma->State = HAL_DMA_STATE_BUSY;
+    __HAL_TRACE(HAL_TRACE_EVT_DMA_START, hdma->Instance);
 
     /* Initialize the error code */
     hdma->ErrorCode = HAL_DMA_ERROR_NONE;
@@ -660,6 +755,25 @@ HAL_StatusTypeDef HAL_DMA_Start_IT(DMA_HandleTypeDef *hdma, uint32_t SrcAddress,
     /* Disable the peripheral */
     __HAL_DMA_DISABLE(hdma);
 
+#if (USE_HAL_DMA_CHECK == 1U)
+    /* Check the memory buffers, debug builds */
+    DMA_CheckStart(hdma, SrcAddress, DstAddress, DataLength, __HAL_DMA_CALLER_ADDRESS());
+#endif /* USE_HAL_DMA_CHECK */
+
+#if (USE_HAL_DMA_BOUNCE_BUFFER == 1U)
+    /* Stage the memory buffers the stream cannot reach */
+    if(DMA_BounceStart(hdma, &SrcAddress, &DstAddress, DataLength) != HAL_OK)
+    {
+      hdma->ErrorCode = HAL_DMA_ERROR_BOUNCE;
+      hdma->State = HAL_DMA_STATE_READY;
+
+      /* Process unlocked */
+      __HAL_UNLOCK(hdma);
+
+      return HAL_ERROR;
+    }
+#endif /* USE_HAL_DMA_BOUNCE_BUFFER */
+
     /* Configure the source, destination address and the data length */
     DMA_SetConfig(hdma, SrcAddress, DstAddress, DataLength);
 
@@ -801,6 +915,11 @@ HAL_StatusTypeDef HAL_DMA_Abort(DMA_HandleTypeDef *hdma)
       }
     }
 
+#if (USE_HAL_DMA_BOUNCE_BUFFER == 1U)
+    /* Copy back what was received and give back the bounce buffers */
+    DMA_BounceAbort(hdma);
+#endif /* USE_HAL_DMA_BOUNCE_BUFFER */
+
     /* Clear all interrupt flags at correct offset within the register */
     if(IS_D2_DMA_INSTANCE(hdma) != RESET) /* D2 Domain DMA : DMA1 or DMA2*/
     {
@@ -870,6 +989,11 @@ HAL_StatusTypeDef HAL_DMA_Abort_IT(DMA_HandleTypeDef *hdma)
       /* Disable the channel */
       __HAL_DMA_DISABLE(hdma);
 
+#if (USE_HAL_DMA_BOUNCE_BUFFER == 1U)
+      /* Copy back what was received and give back the bounce buffers */
+      DMA_BounceAbort(hdma);
+#endif /* USE_HAL_DMA_BOUNCE_BUFFER */
+
       /* disable the DMAMUX sync overrun IT*/
       hdma->DMAmuxChannel->CCR &= ~DMAMUX_CxCR_SOIE;
 
@@ -1126,6 +1250,17 @@ HAL_StatusTypeDef HAL_DMA_PollForTransfer(DMA_HandleTypeDef *hdma, HAL_DMA_Level
       BDMA->IFCR  |= (BDMA_FLAG_TC0 << hdma->StreamIndex);
     }
 
+#if (USE_HAL_DMA_CACHE_MAINTENANCE == 1U)
+    /* Make the destination visible to the CPU */
+    DMA_CacheEnd(hdma, hdma->CacheSize);
+#endif /* USE_HAL_DMA_CACHE_MAINTENANCE */
+
+#if (USE_HAL_DMA_BOUNCE_BUFFER == 1U)
+    /* Copy the staged destination back and give back the bounce buffers */
+    DMA_BounceEnd(hdma, hdma->BounceSize);
+    DMA_BounceRelease(hdma);
+#endif /* USE_HAL_DMA_BOUNCE_BUFFER */
+
     /* Process Unlocked */
     __HAL_UNLOCK(hdma);
 
@@ -1142,6 +1277,11 @@ HAL_StatusTypeDef HAL_DMA_PollForTransfer(DMA_HandleTypeDef *hdma, HAL_DMA_Level
     {
       BDMA->IFCR |= (BDMA_FLAG_HT0 << hdma->StreamIndex);
     }
+
+#if (USE_HAL_DMA_BOUNCE_BUFFER == 1U)
+    /* Copy the first half of the staged destination back */
+    DMA_BounceEnd(hdma, hdma->BounceSize / 2U);
+#endif /* USE_HAL_DMA_BOUNCE_BUFFER */
   }
 
   return status;
@@ -1245,11 +1385,26 @@ void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
             ((DMA_Stream_TypeDef   *)hdma->Instance)->CR  &= ~(DMA_IT_HT);
           }
 
+#if (USE_HAL_DMA_CACHE_MAINTENANCE == 1U)
+          /* Make the first half of the destination visible to the CPU */
+          DMA_CacheEnd(hdma, hdma->CacheSize / 2U);
+#endif /* USE_HAL_DMA_CACHE_MAINTENANCE */
+
+#if (USE_HAL_DMA_BOUNCE_BUFFER == 1U)
+          /* Copy the first half of the staged destination back */
+          DMA_BounceEnd(hdma, hdma->BounceSize / 2U);
+#endif /* USE_HAL_DMA_BOUNCE_BUFFER */
+
           if(hdma->XferHalfCpltCallback != NULL)
           {
             /* Half transfer callback */
             hdma->XferHalfCpltCallback(hdma);
           }
+
+#if (USE_HAL_DMA_BOUNCE_BUFFER == 1U)
+          /* Circular source: stage the first half refilled by the callback */
+          DMA_BounceRefresh(hdma, 0U, hdma->BounceSize / 2U);
+#endif /* USE_HAL_DMA_BOUNCE_BUFFER */
         }
       }
     }
@@ -1275,6 +1430,11 @@ void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
           /* Clear all interrupt flags at correct offset within the register */
           regs->IFCR = 0x3FU << hdma->StreamIndex;
 
+#if (USE_HAL_DMA_BOUNCE_BUFFER == 1U)
+          /* Copy back what was received and give back the bounce buffers */
+          DMA_BounceAbort(hdma);
+#endif /* USE_HAL_DMA_BOUNCE_BUFFER */
+
           /* Process Unlocked */
           __HAL_UNLOCK(hdma);
 
@@ -1304,6 +1464,7 @@ void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
           {
             if(hdma->XferCpltCallback != NULL)
             {
+              __HAL_TRACE(HAL_TRACE_EVT_DMA_CPLT, hdma->Instance);
               /* Transfer complete Callback for memory0 */
               hdma->XferCpltCallback(hdma);
             }
@@ -1324,11 +1485,32 @@ void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
             hdma->State = HAL_DMA_STATE_READY;
           }
 
+#if (USE_HAL_DMA_CACHE_MAINTENANCE == 1U)
+          /* Make the destination visible to the CPU */
+          DMA_CacheEnd(hdma, hdma->CacheSize);
+#endif /* USE_HAL_DMA_CACHE_MAINTENANCE */
+
+#if (USE_HAL_DMA_BOUNCE_BUFFER == 1U)
+          /* Copy the staged destination back, the bounce buffers being given
+             back at the end of a normal mode transfer */
+          DMA_BounceEnd(hdma, hdma->BounceSize);
+          if(hdma->Init.Mode != DMA_CIRCULAR)
+          {
+            DMA_BounceRelease(hdma);
+          }
+#endif /* USE_HAL_DMA_BOUNCE_BUFFER */
+
           if(hdma->XferCpltCallback != NULL)
           {
+            __HAL_TRACE(HAL_TRACE_EVT_DMA_CPLT, hdma->Instance);
             /* Transfer complete callback */
             hdma->XferCpltCallback(hdma);
           }
+
+#if (USE_HAL_DMA_BOUNCE_BUFFER == 1U)
+          /* Circular source: stage the second half refilled by the callback */
+          DMA_BounceRefresh(hdma, hdma->BounceSize / 2U, hdma->BounceSize - (hdma->BounceSize / 2U));
+#endif /* USE_HAL_DMA_BOUNCE_BUFFER */
         }
       }
     }
@@ -1369,6 +1551,7 @@ void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
 
       if(hdma->XferErrorCallback != NULL)
       {
+        __HAL_TRACE(HAL_TRACE_EVT_DMA_ERROR, hdma->Instance);
         /* Transfer error callback */
         hdma->XferErrorCallback(hdma);
       }
@@ -1393,11 +1576,26 @@ void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
         /* DMA peripheral state is not updated in Half Transfer */
         /* but in Transfer Complete case */
 
+#if (USE_HAL_DMA_CACHE_MAINTENANCE == 1U)
+       /* Make the first half of the destination visible to the CPU */
+       DMA_CacheEnd(hdma, hdma->CacheSize / 2U);
+#endif /* USE_HAL_DMA_CACHE_MAINTENANCE */
+
+#if (USE_HAL_DMA_BOUNCE_BUFFER == 1U)
+       /* Copy the first half of the staged destination back */
+       DMA_BounceEnd(hdma, hdma->BounceSize / 2U);
+#endif /* USE_HAL_DMA_BOUNCE_BUFFER */
+
        if(hdma->XferHalfCpltCallback != NULL)
         {
           /* Half transfer callback */
           hdma->XferHalfCpltCallback(hdma);
         }
+
+#if (USE_HAL_DMA_BOUNCE_BUFFER == 1U)
+       /* Circular source: stage the first half refilled by the callback */
+       DMA_BounceRefresh(hdma, 0U, hdma->BounceSize / 2U);
+#endif /* USE_HAL_DMA_BOUNCE_BUFFER */
     }
 
     /* Transfer Complete Interrupt management ***********************************/
@@ -1417,11 +1615,32 @@ void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
       /* Clear the transfer complete flag */
       BDMA->IFCR |= (BDMA_ISR_TCIF0 << hdma->StreamIndex);
 
+#if (USE_HAL_DMA_CACHE_MAINTENANCE == 1U)
+      /* Make the destination visible to the CPU */
+      DMA_CacheEnd(hdma, hdma->CacheSize);
+#endif /* USE_HAL_DMA_CACHE_MAINTENANCE */
+
+#if (USE_HAL_DMA_BOUNCE_BUFFER == 1U)
+      /* Copy the staged destination back, the bounce buffers being given
+         back at the end of a normal mode transfer */
+      DMA_BounceEnd(hdma, hdma->BounceSize);
+      if(hdma->Init.Mode != DMA_CIRCULAR)
+      {
+        DMA_BounceRelease(hdma);
+      }
+#endif /* USE_HAL_DMA_BOUNCE_BUFFER */
+
       if(hdma->XferCpltCallback != NULL)
       {
+        __HAL_TRACE(HAL_TRACE_EVT_DMA_CPLT, hdma->Instance);
         /* Transfer complete callback */
         hdma->XferCpltCallback(hdma);
       }
+
+#if (USE_HAL_DMA_BOUNCE_BUFFER == 1U)
+      /* Circular source: stage the second half refilled by the callback */
+      DMA_BounceRefresh(hdma, hdma->BounceSize / 2U, hdma->BounceSize - (hdma->BounceSize / 2U));
+#endif /* USE_HAL_DMA_BOUNCE_BUFFER */
     }
 
     /* Transfer Error Interrupt management **************************************/
@@ -1446,6 +1665,7 @@ void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma)
 
       if (hdma->XferErrorCallback != NULL)
       {
+        __HAL_TRACE(HAL_TRACE_EVT_DMA_ERROR, hdma->Instance);
         /* Transfer error callback */
         hdma->XferErrorCallback(hdma);
       }
@@ -1640,6 +1860,344 @@ uint32_t HAL_DMA_GetError(DMA_HandleTypeDef *hdma)
   * @}
   */
 
+#if (USE_HAL_DMA_BOUNCE_BUFFER == 1U) || (USE_HAL_DMA_CHECK == 1U)
+/** @addtogroup DMA_Exported_Functions_Group4
+  *
+@verbatim
+ ===============================================================================
+                    ##### Bounce buffer functions #####
+ ===============================================================================
+    [..]
+    This subsection provides functions allowing to
+      (+) Check that a bus master reaches a memory buffer
+      (+) Stage a buffer through a bounce buffer in a memory it reaches; they
+          are used by HAL_DMA and by the HAL drivers with an internal DMA
+      (+) Allocate, free and copy the bounce buffers, through weak callbacks
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Check that a bus master reaches a memory buffer.
+  * @param  Master: register base of the master: DMA stream, BDMA channel or
+  *                 peripheral with an internal DMA (SDMMC1, SDMMC2)
+  * @param  Address: start of the buffer
+  * @param  Size: size of the buffer in bytes
+  * @retval 1 when the whole buffer is reachable, 0 otherwise
+  */
+uint32_t HAL_DMA_IsReachable(uint32_t Master, uint32_t Address, uint32_t Size)
+{
+  uint32_t end = Address + Size;
+
+  if((Master >= (uint32_t)BDMA_Channel0) && (Master <= (uint32_t)BDMA_Channel7))
+  {
+    /* BDMA: D3 domain memories only */
+    return ((((Address >= D3_SRAM_BASE) && (end <= (D3_SRAM_BASE + DMA_D3_SRAM_SIZE))) ||
+             ((Address >= D3_BKPSRAM_BASE) && (end <= (D3_BKPSRAM_BASE + DMA_D3_BKPSRAM_SIZE)))) ? 1U : 0U);
+  }
+
+  if(Master == (uint32_t)SDMMC1)
+  {
+    /* SDMMC1 IDMA on the AXI matrix: AXI SRAM, flash, QUADSPI and FMC */
+    return ((((Address >= D1_AXISRAM_BASE) && (end <= (D1_AXISRAM_BASE + DMA_AXISRAM_SIZE))) ||
+             ((Address >= FLASH_BANK1_BASE) && (end <= (FLASH_BANK1_BASE + FLASH_SIZE))) ||
+             ((Address >= 0x60000000U) && (end <= 0xA0000000U)) ||
+             ((Address >= 0xC0000000U) && (end <= 0xE0000000U))) ? 1U : 0U);
+  }
+
+  /* DMA1, DMA2 and SDMMC2: everything but the tightly coupled memories */
+  return ((((Address < (D1_ITCMRAM_BASE + DMA_ITCM_SIZE)) && (end > D1_ITCMRAM_BASE)) ||
+           ((Address < (D1_DTCMRAM_BASE + DMA_DTCM_SIZE)) && (end > D1_DTCMRAM_BASE))) ? 0U : 1U);
+}
+
+#if (USE_HAL_DMA_BOUNCE_BUFFER == 1U)
+/**
+  * @brief  Get a bounce buffer for a buffer a bus master cannot reach.
+  * @note   The buffer is cleaned and invalidated from the D-cache, so that no
+  *         dirty line is evicted over the data the master writes.
+  * @param  Master: register base of the master
+  * @param  Address: buffer given by the application
+  * @param  Size: size of the buffer in bytes
+  * @retval Bounce buffer, NULL when none is available
+  */
+void *HAL_DMA_BounceAlloc(uint32_t Master, uint32_t Address, uint32_t Size)
+{
+  void *pBounce = HAL_DMA_BounceAllocCallback(Master, Address, Size);
+
+  if((pBounce != NULL) && ((SCB->CCR & SCB_CCR_DC_Msk) != 0U))
+  {
+    SCB_CleanInvalidateDCache_by_Addr((uint32_t *)pBounce, (int32_t)Size);
+  }
+
+  return pBounce;
+}
+
+/**
+  * @brief  Copy part of an application buffer into its bounce buffer, before
+  *         a master reads it.
+  * @param  pBounce: bounce buffer, from HAL_DMA_BounceAlloc()
+  * @param  Address: buffer given by the application
+  * @param  Offset: first byte to copy
+  * @param  Size: number of bytes to copy
+  * @retval None
+  */
+void HAL_DMA_BounceCopyIn(void *pBounce, uint32_t Address, uint32_t Offset, uint32_t Size)
+{
+  uint8_t *pStart = (uint8_t *)pBounce + Offset;
+
+  if(Size != 0U)
+  {
+    HAL_DMA_BounceCopyCallback(pStart, (const void *)(Address + Offset), Size);
+
+    if((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+    {
+      SCB_CleanDCache_by_Addr((uint32_t *)((uint32_t)pStart & ~31U), (int32_t)(Size + ((uint32_t)pStart & 31U)));
+    }
+  }
+}
+
+/**
+  * @brief  Copy part of a bounce buffer back to its application buffer, once
+  *         a master wrote it.
+  * @param  pBounce: bounce buffer, from HAL_DMA_BounceAlloc()
+  * @param  Address: buffer given by the application
+  * @param  Offset: first byte to copy
+  * @param  Size: number of bytes to copy
+  * @retval None
+  */
+void HAL_DMA_BounceCopyOut(void *pBounce, uint32_t Address, uint32_t Offset, uint32_t Size)
+{
+  uint8_t *pStart = (uint8_t *)pBounce + Offset;
+
+  if(Size != 0U)
+  {
+    if((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+    {
+      /* Bounce buffers never share a cache line with other data */
+      SCB_InvalidateDCache_by_Addr((uint32_t *)((uint32_t)pStart & ~31U), (int32_t)(Size + ((uint32_t)pStart & 31U)));
+    }
+
+    HAL_DMA_BounceCopyCallback((void *)(Address + Offset), pStart, Size);
+  }
+}
+
+/**
+  * @brief  Give back a bounce buffer.
+  * @param  Master: register base of the master it was allocated for
+  * @param  pBounce: bounce buffer, from HAL_DMA_BounceAlloc()
+  * @retval None
+  */
+void HAL_DMA_BounceFree(uint32_t Master, void *pBounce)
+{
+  if(pBounce != NULL)
+  {
+    HAL_DMA_BounceFreeCallback(Master, pBounce);
+  }
+}
+
+/**
+  * @brief  Allocate a bounce buffer the master reaches.
+  * @note   This function should not be modified, when the callback is needed,
+  *         the HAL_DMA_BounceAllocCallback could be implemented in the user file.
+  *         Buffers must start on a D-cache line and be rounded up to whole
+  *         lines. It may be called from interrupt handlers.
+  * @param  Master: register base of the master
+  * @param  Address: buffer given by the application, for statistics
+  * @param  Size: size of the buffer in bytes
+  * @retval Bounce buffer, NULL when none is available
+  */
+__weak void *HAL_DMA_BounceAllocCallback(uint32_t Master, uint32_t Address, uint32_t Size)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Master);
+  UNUSED(Address);
+  UNUSED(Size);
+
+  return NULL;
+}
+
+/**
+  * @brief  Free a bounce buffer.
+  * @note   This function should not be modified, when the callback is needed,
+  *         the HAL_DMA_BounceFreeCallback could be implemented in the user file.
+  * @param  Master: register base of the master
+  * @param  pBounce: buffer returned by HAL_DMA_BounceAllocCallback()
+  * @retval None
+  */
+__weak void HAL_DMA_BounceFreeCallback(uint32_t Master, void *pBounce)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Master);
+  UNUSED(pBounce);
+}
+
+/**
+  * @brief  Copy data between a bounce buffer and an application buffer.
+  * @note   This function should not be modified, when the callback is needed,
+  *         the HAL_DMA_BounceCopyCallback could be implemented in the user file,
+  *         ex. to offload large copies to the MDMA, which reaches the DTCM.
+  * @param  pDst: destination
+  * @param  pSrc: source
+  * @param  Size: number of bytes
+  * @retval None
+  */
+__weak void HAL_DMA_BounceCopyCallback(void *pDst, const void *pSrc, uint32_t Size)
+{
+  uint8_t *pOut = (uint8_t *)pDst;
+  const uint8_t *pIn = (const uint8_t *)pSrc;
+
+  while(Size != 0U)
+  {
+    *pOut++ = *pIn++;
+    Size--;
+  }
+}
+#endif /* USE_HAL_DMA_BOUNCE_BUFFER */
+
+/**
+  * @}
+  */
+#endif /* USE_HAL_DMA_BOUNCE_BUFFER || USE_HAL_DMA_CHECK */
+
+#if (USE_HAL_DMA_CHECK == 1U)
+/** @addtogroup DMA_Exported_Functions_Group5
+  *
+@verbatim
+ ===============================================================================
+                    ##### Buffer check functions #####
+ ===============================================================================
+    [..]
+    This subsection provides functions allowing to
+      (+) Check a transfer buffer against the bus matrix, its alignment, the
+          MPU and D-cache attributes of its memory and the stack
+      (+) Report the violations found in the trace buffer and to the
+          HAL_DMA_CheckCallback()
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Check a memory buffer of a transfer.
+  * @param  Master: register base of the master: DMA stream, BDMA channel or
+  *                 peripheral with an internal DMA (SDMMC1, SDMMC2)
+  * @param  Address: start of the buffer
+  * @param  Size: size of the buffer in bytes
+  * @param  Width: size in bytes of the memory accesses of the master, 1, 2 or 4
+  * @param  Write: 1 when the master writes the buffer, 0 when it reads it
+  * @retval Violations, a combination of @ref DMA_Check_Violations
+  */
+uint32_t HAL_DMA_CheckBuffer(uint32_t Master, uint32_t Address, uint32_t Size, uint32_t Width, uint32_t Write)
+{
+  uint32_t violations = 0U;
+  uint32_t policy;
+  uint32_t stacktop;
+
+#if (USE_HAL_DMA_BOUNCE_BUFFER != 1U)
+  /* Staged through a bounce buffer otherwise */
+  if(HAL_DMA_IsReachable(Master, Address, Size) == 0U)
+  {
+    violations |= HAL_DMA_CHECK_REACH;
+  }
+#endif /* USE_HAL_DMA_BOUNCE_BUFFER */
+
+  if((Address & (Width - 1U)) != 0U)
+  {
+    violations |= HAL_DMA_CHECK_ALIGN_DATA;
+  }
+
+  /* D-cache: the master does not see the lines of a write-back buffer the
+     CPU has not cleaned, and the CPU must invalidate the lines of a buffer
+     written by the master without a neighbour sharing them */
+  policy = DMA_CheckCachePolicy(Address);
+  if(policy != DMA_CHECK_POLICY_NONE)
+  {
+    if(Write != 0U)
+    {
+      if(((Address | Size) & (DMA_CHECK_CACHE_LINE_SIZE - 1U)) != 0U)
+      {
+        violations |= HAL_DMA_CHECK_ALIGN_CACHE;
+      }
+#if (USE_HAL_DMA_CACHE_MAINTENANCE != 1U)
+      violations |= HAL_DMA_CHECK_CACHE;
+#endif /* USE_HAL_DMA_CACHE_MAINTENANCE */
+    }
+#if (USE_HAL_DMA_CACHE_MAINTENANCE != 1U)
+    else if(policy == DMA_CHECK_POLICY_WRITE_BACK)
+    {
+      violations |= HAL_DMA_CHECK_CACHE;
+    }
+#endif /* USE_HAL_DMA_CACHE_MAINTENANCE */
+    else
+    {
+      /* Write-through: memory is always up to date */
+    }
+  }
+
+  /* Main stack, from the stack pointer to the initial stack pointer held in
+     the first word of the vector table: the buffer is gone once the caller
+     returns */
+  stacktop = *(__IO uint32_t *)SCB->VTOR;
+  if((Address >= __get_MSP()) && (Address < stacktop))
+  {
+    violations |= HAL_DMA_CHECK_STACK;
+  }
+
+  return violations;
+}
+
+/**
+  * @brief  Report the violations found on a transfer buffer.
+  * @note   Three events are recorded in the trace buffer when USE_HAL_TRACE is
+  *         1: HAL_TRACE_EVT_DMA_CHECK with the caller, HAL_TRACE_EVT_DMA_BUF
+  *         with the buffer and HAL_TRACE_EVT_DMA_VIOL with the violations.
+  * @param  Master: register base of the master
+  * @param  Address: start of the buffer
+  * @param  Violations: combination of @ref DMA_Check_Violations, nothing is
+  *                     reported when 0
+  * @param  Caller: return address of the function starting the transfer
+  * @retval None
+  */
+void HAL_DMA_CheckReport(uint32_t Master, uint32_t Address, uint32_t Violations, uint32_t Caller)
+{
+  if(Violations != 0U)
+  {
+    __HAL_TRACE(HAL_TRACE_EVT_DMA_CHECK, Caller);
+    __HAL_TRACE(HAL_TRACE_EVT_DMA_BUF, Address);
+    __HAL_TRACE(HAL_TRACE_EVT_DMA_VIOL, Violations);
+
+    HAL_DMA_CheckCallback(Master, Address, Violations, Caller);
+  }
+}
+
+/**
+  * @brief  Buffer check violation callback.
+  * @note   This function should not be modified, when the callback is needed,
+  *         the HAL_DMA_CheckCallback could be implemented in the user file,
+  *         ex. to print the violations or to stop on a breakpoint. It is called
+  *         from the function starting the transfer, possibly in interrupt
+  *         context, the transfer being started anyway.
+  * @param  Master: register base of the master
+  * @param  Address: start of the buffer
+  * @param  Violations: combination of @ref DMA_Check_Violations
+  * @param  Caller: return address of the function starting the transfer
+  * @retval None
+  */
+__weak void HAL_DMA_CheckCallback(uint32_t Master, uint32_t Address, uint32_t Violations, uint32_t Caller)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Master);
+  UNUSED(Address);
+  UNUSED(Violations);
+  UNUSED(Caller);
+}
+
+/**
+  * @}
+  */
+#endif /* USE_HAL_DMA_CHECK */
+
 /**
   * @}
   */
@@ -1728,7 +2286,445 @@ static void DMA_SetConfig(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t
       ((BDMA_Channel_TypeDef *)hdma->Instance)->CMAR = DstAddress;
     }
   }
+#if (USE_HAL_DMA_CACHE_MAINTENANCE == 1U)
+  /* Maintain the D-cache of the memory side of the transfer */
+  DMA_CacheStart(hdma, SrcAddress, DstAddress, DataLength);
+#endif /* USE_HAL_DMA_CACHE_MAINTENANCE */
+}
+
+#if (USE_HAL_DMA_CACHE_MAINTENANCE == 1U)
+/**
+  * @brief  Cleans the D-cache lines of the memory buffers of a transfer before
+  *         the stream is enabled, and records the destination range so that it
+  *         can be invalidated when the transfer completes.
+  * @note   On a destination sharing its first or last cache line with other
+  *         data, those lines are cleaned and invalidated instead of only
+  *         invalidated at completion, which is only safe if the CPU does not
+  *         write the neighbouring data while the transfer is ongoing. Buffers
+  *         taken from Utilities/DMA/dma_pool never share a line.
+  * @param  hdma:       pointer to a DMA_HandleTypeDef structure that contains
+  *                     the configuration information for the specified DMA Stream.
+  * @param  SrcAddress: The source memory Buffer address
+  * @param  DstAddress: The destination memory Buffer address
+  * @param  DataLength: The length of data to be transferred from source to destination
+  * @retval None
+  */
+static void DMA_CacheStart(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress, uint32_t DataLength)
+{
+  /* The data length counts items of the peripheral data size */
+  uint32_t size = DataLength << (hdma->Init.PeriphDataAlignment >> DMA_SxCR_PSIZE_Pos);
+  uint32_t start;
+
+  hdma->CacheAddress = 0U;
+  hdma->CacheSize = 0U;
+
+  if((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    if(hdma->Init.Direction != DMA_PERIPH_TO_MEMORY)
+    {
+      /* Write back the source buffer that the DMA is about to read */
+      start = SrcAddress & ~(DMA_CACHE_LINE_SIZE - 1U);
+      SCB_CleanDCache_by_Addr((uint32_t *)start, (int32_t)((SrcAddress + size) - start));
+    }
+
+    if(hdma->Init.Direction != DMA_MEMORY_TO_PERIPH)
+    {
+      /* No dirty line of the destination may be evicted during the transfer */
+      start = DstAddress & ~(DMA_CACHE_LINE_SIZE - 1U);
+      SCB_CleanInvalidateDCache_by_Addr((uint32_t *)start, (int32_t)((DstAddress + size) - start));
+
+      hdma->CacheAddress = DstAddress;
+      hdma->CacheSize = size;
+    }
+  }
+}
+
+/**
+  * @brief  Invalidates the D-cache lines of the first bytes of the destination
+  *         recorded by DMA_CacheStart(), so that the CPU reads what the DMA wrote.
+  * @param  hdma:       pointer to a DMA_HandleTypeDef structure that contains
+  *                     the configuration information for the specified DMA Stream.
+  * @param  Size:       Number of bytes from the start of the destination
+  * @retval None
+  */
+static void DMA_CacheEnd(DMA_HandleTypeDef *hdma, uint32_t Size)
+{
+  uint32_t start = hdma->CacheAddress;
+  uint32_t end = hdma->CacheAddress + Size;
+
+  if((Size != 0U) && ((SCB->CCR & SCB_CCR_DC_Msk) != 0U))
+  {
+    if(((start | end) & (DMA_CACHE_LINE_SIZE - 1U)) == 0U)
+    {
+      SCB_InvalidateDCache_by_Addr((uint32_t *)start, (int32_t)Size);
+    }
+    else
+    {
+      /* Keep the CPU data sharing the first and last lines */
+      start &= ~(DMA_CACHE_LINE_SIZE - 1U);
+      SCB_CleanInvalidateDCache_by_Addr((uint32_t *)start, (int32_t)(end - start));
+    }
+  }
+}
+#endif /* USE_HAL_DMA_CACHE_MAINTENANCE */
+
+#if (USE_HAL_DMA_BOUNCE_BUFFER == 1U)
+/**
+  * @brief  Stage the memory buffers of a transfer the stream cannot reach.
+  * @note   The source is copied into its bounce buffer, the destination is
+  *         copied back by DMA_BounceEnd() and DMA_BounceAbort(). The
+  *         addresses given to the stream are replaced by the bounce buffers.
+  * @param  hdma:        pointer to a DMA_HandleTypeDef structure that contains
+  *                      the configuration information for the specified DMA Stream.
+  * @param  pSrcAddress: The source memory Buffer address, updated
+  * @param  pDstAddress: The destination memory Buffer address, updated
+  * @param  DataLength:  The length of data to be transferred from source to destination
+  * @retval HAL status, HAL_ERROR when no bounce buffer is available
+  */
+static HAL_StatusTypeDef DMA_BounceStart(DMA_HandleTypeDef *hdma, uint32_t *pSrcAddress, uint32_t *pDstAddress, uint32_t DataLength)
+{
+  uint32_t size = DataLength << (hdma->Init.PeriphDataAlignment >> DMA_SxCR_PSIZE_Pos);
+
+  /* Buffers left by a transfer stopped without abort */
+  DMA_BounceRelease(hdma);
+
+  hdma->BounceSize = size;
+  hdma->BounceDone = 0U;
+
+  if((hdma->Init.Direction != DMA_PERIPH_TO_MEMORY) &&
+     (HAL_DMA_IsReachable((uint32_t)hdma->Instance, *pSrcAddress, size) == 0U))
+  {
+    hdma->BounceSrc = HAL_DMA_BounceAlloc((uint32_t)hdma->Instance, *pSrcAddress, size);
+    if(hdma->BounceSrc == NULL)
+    {
+      return HAL_ERROR;
+    }
+    HAL_DMA_BounceCopyIn(hdma->BounceSrc, *pSrcAddress, 0U, size);
+    hdma->BounceSrcAddress = *pSrcAddress;
+    *pSrcAddress = (uint32_t)hdma->BounceSrc;
+  }
+
+  if((hdma->Init.Direction != DMA_MEMORY_TO_PERIPH) &&
+     (HAL_DMA_IsReachable((uint32_t)hdma->Instance, *pDstAddress, size) == 0U))
+  {
+    hdma->BounceDst = HAL_DMA_BounceAlloc((uint32_t)hdma->Instance, *pDstAddress, size);
+    if(hdma->BounceDst == NULL)
+    {
+      DMA_BounceRelease(hdma);
+      return HAL_ERROR;
+    }
+    hdma->BounceDstAddress = *pDstAddress;
+    *pDstAddress = (uint32_t)hdma->BounceDst;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Copy the staged destination back up to a position of the transfer.
+  * @param  hdma: pointer to a DMA_HandleTypeDef structure that contains
+  *               the configuration information for the specified DMA Stream.
+  * @param  Size: bytes received since the start of the buffer
+  * @retval None
+  */
+static void DMA_BounceEnd(DMA_HandleTypeDef *hdma, uint32_t Size)
+{
+  if(hdma->BounceDst != NULL)
+  {
+    if(Size > hdma->BounceDone)
+    {
+      HAL_DMA_BounceCopyOut(hdma->BounceDst, hdma->BounceDstAddress, hdma->BounceDone, Size - hdma->BounceDone);
+    }
+    hdma->BounceDone = Size;
+
+    /* Circular mode: the next lap starts at the beginning of the buffer */
+    if((Size == hdma->BounceSize) && (hdma->Init.Mode == DMA_CIRCULAR))
+    {
+      hdma->BounceDone = 0U;
+    }
+  }
+}
+
+/**
+  * @brief  Stage again part of a circular source, refilled by the application
+  *         in the half transfer or transfer complete callback.
+  * @param  hdma:   pointer to a DMA_HandleTypeDef structure that contains
+  *                 the configuration information for the specified DMA Stream.
+  * @param  Offset: first byte refilled
+  * @param  Size:   bytes refilled
+  * @retval None
+  */
+static void DMA_BounceRefresh(DMA_HandleTypeDef *hdma, uint32_t Offset, uint32_t Size)
+{
+  if((hdma->BounceSrc != NULL) && (hdma->Init.Mode == DMA_CIRCULAR))
+  {
+    HAL_DMA_BounceCopyIn(hdma->BounceSrc, hdma->BounceSrcAddress, Offset, Size);
+  }
+}
+
+/**
+  * @brief  Copy back the part of the staged destination received before an
+  *         abort, then give back the bounce buffers.
+  * @note   The stream must be disabled.
+  * @param  hdma: pointer to a DMA_HandleTypeDef structure that contains
+  *               the configuration information for the specified DMA Stream.
+  * @retval None
+  */
+static void DMA_BounceAbort(DMA_HandleTypeDef *hdma)
+{
+  uint32_t remaining;
+
+  if(hdma->BounceDst != NULL)
+  {
+    remaining = __HAL_DMA_GET_COUNTER(hdma) << (hdma->Init.PeriphDataAlignment >> DMA_SxCR_PSIZE_Pos);
+    if(remaining < hdma->BounceSize)
+    {
+      DMA_BounceEnd(hdma, hdma->BounceSize - remaining);
+    }
+  }
+
+  DMA_BounceRelease(hdma);
+}
+
+/**
+  * @brief  Give back the bounce buffers of the stream.
+  * @param  hdma: pointer to a DMA_HandleTypeDef structure that contains
+  *               the configuration information for the specified DMA Stream.
+  * @retval None
+  */
+static void DMA_BounceRelease(DMA_HandleTypeDef *hdma)
+{
+  HAL_DMA_BounceFree((uint32_t)hdma->Instance, hdma->BounceSrc);
+  HAL_DMA_BounceFree((uint32_t)hdma->Instance, hdma->BounceDst);
+  hdma->BounceSrc = NULL;
+  hdma->BounceDst = NULL;
+}
+#endif /* USE_HAL_DMA_BOUNCE_BUFFER */
+
+#if (USE_HAL_DMA_CHECK == 1U)
+/**
+  * @brief  Check the memory buffers of a transfer being started, and that they
+  *         do not overlap the buffers of the other ongoing transfers.
+  * @param  hdma:       pointer to a DMA_HandleTypeDef structure that contains
+  *                     the configuration information for the specified DMA Stream.
+  * @param  SrcAddress: The source memory Buffer address
+  * @param  DstAddress: The destination memory Buffer address
+  * @param  DataLength: The length of data to be transferred from source to destination
+  * @param  Caller:     return address of HAL_DMA_Start() or HAL_DMA_Start_IT()
+  * @retval None
+  */
+static void DMA_CheckStart(DMA_HandleTypeDef *hdma, uint32_t SrcAddress, uint32_t DstAddress, uint32_t DataLength, uint32_t Caller)
+{
+  uint32_t size = DataLength << (hdma->Init.PeriphDataAlignment >> DMA_SxCR_PSIZE_Pos);
+  uint32_t memwidth = 1UL << (hdma->Init.MemDataAlignment >> DMA_SxCR_MSIZE_Pos);
+  uint32_t violations;
+
+  if(hdma->Init.Direction == DMA_PERIPH_TO_MEMORY)
+  {
+    violations = HAL_DMA_CheckBuffer((uint32_t)hdma->Instance, DstAddress, size, memwidth, 1U);
+    violations |= DMA_CheckOverlap(hdma, DstAddress, size, 1U, 0U);
+    HAL_DMA_CheckReport((uint32_t)hdma->Instance, DstAddress, violations, Caller);
+  }
+  else if(hdma->Init.Direction == DMA_MEMORY_TO_PERIPH)
+  {
+    violations = HAL_DMA_CheckBuffer((uint32_t)hdma->Instance, SrcAddress, size, memwidth, 0U);
+    violations |= DMA_CheckOverlap(hdma, SrcAddress, size, 0U, 0U);
+    HAL_DMA_CheckReport((uint32_t)hdma->Instance, SrcAddress, violations, Caller);
+  }
+  else /* DMA_MEMORY_TO_MEMORY: the source is read through the peripheral port */
+  {
+    violations = HAL_DMA_CheckBuffer((uint32_t)hdma->Instance, SrcAddress, size,
+                                     1UL << (hdma->Init.PeriphDataAlignment >> DMA_SxCR_PSIZE_Pos), 0U);
+    violations |= DMA_CheckOverlap(hdma, SrcAddress, size, 0U, 0U);
+    HAL_DMA_CheckReport((uint32_t)hdma->Instance, SrcAddress, violations, Caller);
+
+    violations = HAL_DMA_CheckBuffer((uint32_t)hdma->Instance, DstAddress, size, memwidth, 1U);
+    violations |= DMA_CheckOverlap(hdma, DstAddress, size, 1U, 1U);
+    if((DstAddress < (SrcAddress + size)) && (SrcAddress < (DstAddress + size)))
+    {
+      violations |= HAL_DMA_CHECK_OVERLAP;
+    }
+    HAL_DMA_CheckReport((uint32_t)hdma->Instance, DstAddress, violations, Caller);
+  }
+}
+
+/**
+  * @brief  Record a buffer of a transfer being started, and check it against the
+  *         buffers of the other ongoing transfers: a buffer written by one of
+  *         them must not be shared.
+  * @note   Entries of transfers no longer ongoing are reused, so that no hook is
+  *         needed at the end of the transfers.
+  * @param  hdma:    pointer to a DMA_HandleTypeDef structure that contains
+  *                  the configuration information for the specified DMA Stream.
+  * @param  Address: start of the buffer
+  * @param  Size:    size of the buffer in bytes
+  * @param  Write:   1 when the stream writes the buffer
+  * @param  Side:    0 for the first memory buffer of the stream, 1 for the
+  *                  destination of a memory to memory transfer
+  * @retval HAL_DMA_CHECK_OVERLAP or 0
+  */
+static uint32_t DMA_CheckOverlap(DMA_HandleTypeDef *hdma, uint32_t Address, uint32_t Size, uint32_t Write, uint32_t Side)
+{
+  static DMA_CheckTransferTypeDef transfers[DMA_CHECK_TRANSFERS];
+  DMA_CheckTransferTypeDef *entry;
+  DMA_CheckTransferTypeDef *slot = NULL;
+  uint32_t violations = 0U;
+  uint32_t primask = __get_PRIMASK();
+  uint32_t i;
+
+  __disable_irq();
+  for(i = 0U; i < DMA_CHECK_TRANSFERS; i++)
+  {
+    entry = &transfers[i];
+    if(entry->hdma == hdma)
+    {
+      /* Buffers of this stream, the source of a memory to memory transfer
+         being checked against its destination by DMA_CheckStart() */
+      if(entry->Side == Side)
+      {
+        slot = entry;
+      }
+    }
+    else if((entry->hdma == NULL) || (entry->hdma->State != HAL_DMA_STATE_BUSY))
+    {
+      if(slot == NULL)
+      {
+        slot = entry;
+      }
+    }
+    else if(((Write != 0U) || (entry->Write != 0U)) &&
+            (Address < (entry->Address + entry->Size)) && (entry->Address < (Address + Size)))
+    {
+      violations = HAL_DMA_CHECK_OVERLAP;
+    }
+    else
+    {
+      /* Ongoing transfer, no conflict */
+    }
+  }
+
+  /* Without a free entry the buffer is not followed */
+  if(slot != NULL)
+  {
+    slot->hdma = hdma;
+    slot->Address = Address;
+    slot->Size = Size;
+    slot->Write = Write;
+    slot->Side = Side;
+  }
+  __set_PRIMASK(primask);
+
+  return violations;
+}
+
+/**
+  * @brief  Get the D-cache policy applied to an address, from the MPU regions or
+  *         the default memory map.
+  * @note   On the Cortex-M7, shareable normal memory is not cached.
+  * @param  Address: address to look up
+  * @retval DMA_CHECK_POLICY_NONE, DMA_CHECK_POLICY_WRITE_THROUGH or
+  *         DMA_CHECK_POLICY_WRITE_BACK
+  */
+static uint32_t DMA_CheckCachePolicy(uint32_t Address)
+{
+  uint32_t policy = DMA_CHECK_POLICY_NONE;
+  uint32_t found = 0U;
+  uint32_t primask;
+  uint32_t rnr;
+  uint32_t rasr;
+  uint32_t base;
+  uint32_t last;
+  uint32_t region;
+  uint32_t tex;
+  uint32_t cb;
+
+  /* D-cache off, or tightly coupled memory, never cached */
+  if(((SCB->CCR & SCB_CCR_DC_Msk) == 0U) ||
+     (Address < (D1_ITCMRAM_BASE + DMA_ITCM_SIZE)) ||
+     ((Address >= D1_DTCMRAM_BASE) && (Address < (D1_DTCMRAM_BASE + DMA_DTCM_SIZE))))
+  {
+    return DMA_CHECK_POLICY_NONE;
+  }
+
+  if((MPU->CTRL & MPU_CTRL_ENABLE_Msk) != 0U)
+  {
+    primask = __get_PRIMASK();
+    __disable_irq();
+    rnr = MPU->RNR;
+
+    /* The highest region number matching the address wins */
+    region = (MPU->TYPE & MPU_TYPE_DREGION_Msk) >> MPU_TYPE_DREGION_Pos;
+    while((region > 0U) && (found == 0U))
+    {
+      region--;
+      MPU->RNR = region;
+      rasr = MPU->RASR;
+      base = MPU->RBAR & MPU_RBAR_ADDR_Msk;
+      last = (2UL << ((rasr & MPU_RASR_SIZE_Msk) >> MPU_RASR_SIZE_Pos)) - 1U;
+
+      if(((rasr & MPU_RASR_ENABLE_Msk) != 0U) && (Address >= base) && ((Address - base) <= last))
+      {
+        /* Eight subregions in regions of 256 bytes or more */
+        if((last < 255U) || ((rasr & (1UL << (MPU_RASR_SRD_Pos + ((Address - base) / ((last / 8U) + 1U))))) == 0U))
+        {
+          found = 1U;
+          tex = (rasr & MPU_RASR_TEX_Msk) >> MPU_RASR_TEX_Pos;
+          cb = (rasr & (MPU_RASR_C_Msk | MPU_RASR_B_Msk)) >> MPU_RASR_B_Pos;
+
+          if((rasr & MPU_RASR_S_Msk) != 0U)
+          {
+            /* Shareable: not cached */
+          }
+          else if((tex & 4U) != 0U)
+          {
+            /* Cacheable memory, inner policy in C and B */
+            policy = (cb == 2U) ? DMA_CHECK_POLICY_WRITE_THROUGH :
+                     ((cb != 0U) ? DMA_CHECK_POLICY_WRITE_BACK : DMA_CHECK_POLICY_NONE);
+          }
+          else if((tex == 0U) && (cb == 2U))
+          {
+            policy = DMA_CHECK_POLICY_WRITE_THROUGH;
+          }
+          else if(((tex == 0U) || (tex == 1U)) && (cb == 3U))
+          {
+            policy = DMA_CHECK_POLICY_WRITE_BACK;
+          }
+          else
+          {
+            /* Device, strongly ordered or non-cacheable */
+          }
+        }
+      }
+    }
+
+    MPU->RNR = rnr;
+    __set_PRIMASK(primask);
+
+    /* Without the background region, other addresses are not accessible */
+    if((found != 0U) || ((MPU->CTRL & MPU_CTRL_PRIVDEFENA_Msk) == 0U))
+    {
+      return policy;
+    }
+  }
+
+  /* Default memory map */
+  if((Address < 0x40000000U) || ((Address >= 0x60000000U) && (Address < 0x80000000U)))
+  {
+    /* Code region write-through, SRAM and external RAM regions write-back */
+    policy = (Address < 0x20000000U) ? DMA_CHECK_POLICY_WRITE_THROUGH : DMA_CHECK_POLICY_WRITE_BACK;
+  }
+  else if((Address >= 0x80000000U) && (Address < 0xA0000000U))
+  {
+    policy = DMA_CHECK_POLICY_WRITE_THROUGH;
+  }
+  else
+  {
+    /* Peripheral, device and system regions */
+  }
+
+  return policy;
 }
+#endif /* USE_HAL_DMA_CHECK */
 
 /**
   * @brief  Returns the DMA Stream base address depending on stream number
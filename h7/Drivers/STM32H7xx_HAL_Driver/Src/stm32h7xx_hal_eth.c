@@ -51,15 +51,47 @@
           (##) HAL_ETH_GetRxDataLength(): Get received frame length
           (##) HAL_ETH_GetRxDataInfo(): Get received frame additional info, 
                please refer to ETH_RxPacketInfo typedef structure 
+          (##) HAL_ETH_GetPacketMeta(): Get checksum status, VLAN tag and timestamp
+               of the received frames, in reception order, once the ring is set
+               by HAL_ETH_ConfigPacketMetaRing()
+          then give the descriptors back to the DMA with one of:
+          (##) HAL_ETH_BuildRxDescriptors(): the same buffers are reused for
+               the next receptions, the application copies the data out first
+          (##) HAL_ETH_RefillRxDescriptors(): the buffers of the frame are handed
+               over to the application (zero-copy) and each descriptor is rearmed
+               with a new buffer returned by HAL_ETH_RxAllocateCallback(), to be
+               implemented on top of the application buffer pool. The received
+               buffers are invalidated from the D-cache, so their data can be read
+               once this function returns. The application gives the buffers back
+               to its pool when done. If the pool is empty, the function returns
+               HAL_BUSY and should be called again once buffers are freed.
                
       (#) For transmission path, two APIs are available:
          (##) HAL_ETH_Transmit(): Transmit an ETH frame in blocking mode
          (##) HAL_ETH_Transmit_IT(): Transmit an ETH frame in interrupt mode,
               HAL_ETH_TxCpltCallback() will be executed when end of transfer occur
+         (##) HAL_ETH_ReleaseTxPackets(): Release the Tx descriptors of the packets
+              sent, HAL_ETH_TxPacketCpltCallback() is executed with the pData of each
+              packet. Called from HAL_ETH_IRQHandler() and before each transmission
+         (##) ETH_TX_PACKETS_FEATURES_TTSE attribute: capture the PTP transmit
+              timestamp of the packet, read from TxDescList.TimeStamp in
+              HAL_ETH_TxPacketCpltCallback()
               
+      (#) Moderate the Ethernet interrupts at high packet rates: call
+          HAL_ETH_ConfigITModeration() before HAL_ETH_Start_IT() to request the
+          receive interrupt once every RxPacketCount Rx descriptors, the RIWT
+          watchdog raising it for the descriptors received after, and the
+          transmit interrupt once every TxPacketCount packets.
+
       (#) Communication with an external PHY device:
          (##) HAL_ETH_ReadPHYRegister(): Read a register from an external PHY                
          (##) HAL_ETH_WritePHYRegister(): Write data to an external RHY register
+         (##) HAL_ETH_ReadPHYRegister_IT() / HAL_ETH_WritePHYRegister_IT(): Queue a PHY
+              register transfer without waiting, HAL_ETH_PHY_IRQHandler() must then be
+              called periodically (from a timer interrupt for instance) and
+              HAL_ETH_PHYTransferCpltCallback() is executed when the transfer is completed
+         (##) HAL_ETH_StartLinkPoll(): Poll the PHY link status from HAL_ETH_PHY_IRQHandler(),
+              HAL_ETH_LinkStatusCallback() is executed on each link status change
 
       (#) Configure the Ethernet MAC after ETH peripheral initialization
           (##) HAL_ETH_GetMACConfig(): Get MAC actual configuration into ETH_MACConfigTypeDef 
@@ -142,6 +174,10 @@
 #define ETH_SWRESET_TIMEOUT                 ((uint32_t)500U)  
 #define ETH_MDIO_BUS_TIMEOUT                ((uint32_t)1000U)
 
+/* IEEE 802.3 clause 22 Basic Status Register, read by the link poller */
+#define ETH_PHY_BSR                         ((uint32_t)0x00000001U)
+#define ETH_PHY_BSR_LINK_STATUS             ((uint32_t)0x00000004U)
+
 #define ETH_DMARXNDESCWBF_ERRORS_MASK ((uint32_t)(ETH_DMARXNDESCWBF_DE | ETH_DMARXNDESCWBF_RE | \
                                                   ETH_DMARXNDESCWBF_OE | ETH_DMARXNDESCWBF_RWT |\
                                                   ETH_DMARXNDESCWBF_GP | ETH_DMARXNDESCWBF_CE))
@@ -168,6 +204,10 @@
           if ((inx) >= ETH_RX_DESC_CNT){\
             (inx) = ((inx) - ETH_RX_DESC_CNT);}\
 } while (0)
+
+/* Interrupt on completion requested by the Rx descriptor of index inx */
+#define ETH_RX_DESC_IOC(heth, inx)  (((heth)->ITModeration.RxPacketCount <= 1U) || \
+                                     ((((inx) + 1U) % (heth)->ITModeration.RxPacketCount) == 0U))
 /**
   * @}
   */
@@ -182,6 +222,9 @@ static void ETH_MACDMAConfig(ETH_HandleTypeDef *heth);
 static void ETH_DMATxDescListInit(ETH_HandleTypeDef *heth);
 static void ETH_DMARxDescListInit(ETH_HandleTypeDef *heth);
 static uint32_t ETH_Prepare_Tx_Descriptors(ETH_HandleTypeDef *heth, ETH_TxPacketConfig *pTxConfig, uint32_t ItMode);
+static void ETH_PHYTransferQueue(ETH_HandleTypeDef *heth, ETH_PHYTransferTypeDef *pXfer);
+static void ETH_PHYTransferStart(ETH_HandleTypeDef *heth, ETH_PHYTransferTypeDef *pXfer);
+static void ETH_PacketMetaPush(ETH_HandleTypeDef *heth, __IO const ETH_DMADescTypeDef *pLastDesc, __IO const ETH_DMADescTypeDef *pContextDesc);
 /**
   * @}
   */
@@ -495,11 +538,18 @@ HAL_StatusTypeDef HAL_ETH_Start_IT(ETH_HandleTypeDef *heth)
   {
     heth->gState = HAL_ETH_STATE_BUSY;
      
-    /* Set IOC bit to all Rx descriptors */
+    /* Set IOC bit to all Rx descriptors, or to one out of ITModeration.RxPacketCount */
     for(counter= 0; counter < ETH_RX_DESC_CNT; counter++)
     {
-      SET_BIT(dmarxdesc->DESC3, ETH_DMARXNDESCRF_IOC);
-      INCR_RX_DESC_INDEX(descindex, 1);
+      if(ETH_RX_DESC_IOC(heth, descindex))
+      {
+        SET_BIT(dmarxdesc->DESC3, ETH_DMARXNDESCRF_IOC);
+      }
+      else
+      {
+        CLEAR_BIT(dmarxdesc->DESC3, ETH_DMARXNDESCRF_IOC);
+      }
+INCR_RX_DESC_INDEX(descindex, 1);
       dmarxdesc = (ETH_DMADescTypeDef *)heth->RxDescList.RxDesc[descindex];
     }
     
@@ -755,6 +805,70 @@ HAL_StatusTypeDef HAL_ETH_Transmit_IT(ETH_HandleTypeDef *heth, ETH_TxPacketConfi
   }
 }
 
+/**
+  * @brief  Releases the Tx descriptors of the packets sent, oldest first, and
+  *         calls HAL_ETH_TxPacketCpltCallback() with the pData of each packet.
+  * @note   Called from HAL_ETH_IRQHandler() on the transmit interrupt and before
+  *         each transmission, so the packets sent under one moderated transmit
+  *         interrupt are released in one batch. The application can call it too,
+  *         from a periodic task for instance, to release the last packets sent
+  *         without interrupt request.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @retval Number of packets released
+  */
+uint32_t HAL_ETH_ReleaseTxPackets(ETH_HandleTypeDef *heth)
+{
+  ETH_TxDescListTypeDef *dmatxdesclist = &heth->TxDescList;
+  const ETH_DMADescTypeDef *dmatxdesc;
+  uint32_t released = 0U, lastdesc, primask;
+  uint64_t timestamp;
+  void *pdata;
+
+  for(;;)
+  {
+    lastdesc = 2U;
+    pdata = NULL;
+    timestamp = 0U;
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    dmatxdesc = (ETH_DMADescTypeDef *)dmatxdesclist->TxDesc[dmatxdesclist->ReleaseTxDesc];
+    if((dmatxdesclist->TxDescInUse != 0U) && (READ_BIT(dmatxdesc->DESC3, ETH_DMATXNDESCWBF_OWN) == 0U))
+    {
+      /* The written back normal descriptor ending a packet has the LD bit set */
+      lastdesc = (READ_BIT(dmatxdesc->DESC3, (ETH_DMATXNDESCWBF_CTXT | ETH_DMATXNDESCWBF_LD)) == ETH_DMATXNDESCWBF_LD) ? 1U : 0U;
+      pdata = dmatxdesclist->PacketData[dmatxdesclist->ReleaseTxDesc];
+
+      /* The transmit timestamp is written back in the last descriptor */
+      if((lastdesc == 1U) && (READ_BIT(dmatxdesc->DESC3, ETH_DMATXNDESCWBF_TTSS) != 0U))
+      {
+        timestamp = ((uint64_t)READ_REG(dmatxdesc->DESC1) << 32U) | (uint64_t)READ_REG(dmatxdesc->DESC0);
+      }
+
+      INCR_TX_DESC_INDEX(dmatxdesclist->ReleaseTxDesc, 1U);
+      dmatxdesclist->TxDescInUse--;
+    }
+    __set_PRIMASK(primask);
+
+    if(lastdesc == 2U)
+    {
+      break;
+    }
+
+    if(lastdesc == 1U)
+    {
+      released++;
+      dmatxdesclist->TimeStamp = timestamp;
+
+      /* Packet sent callback */
+      HAL_ETH_TxPacketCpltCallback(heth, pdata);
+    }
+  }
+
+  return released;
+}
+
 /**
   * @brief  Checks for received Packets. 
   * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
@@ -769,6 +883,7 @@ uint8_t HAL_ETH_IsRxDataAvailable(ETH_HandleTypeDef *heth)
   ETH_DMADescTypeDef *dmarxdesc = (ETH_DMADescTypeDef *)dmarxdesclist->RxDesc[descidx];
   uint32_t descscancnt = 0;
   uint32_t appdesccnt = 0, firstappdescidx = 0;
+  ETH_DMADescTypeDef *lastdesc;
   
   if(dmarxdesclist->AppDescNbr != 0)
   {
@@ -777,7 +892,8 @@ uint8_t HAL_ETH_IsRxDataAvailable(ETH_HandleTypeDef *heth)
   }
   
   /* Check if descriptor is not owned by DMA */
-  while((READ_BIT(dmarxdesc->DESC3, ETH_DMARXNDESCWBF_OWN) == (uint32_t)RESET) && (descscancnt < ETH_RX_DESC_CNT))
+  /* Descriptors still waiting for a buffer from HAL_ETH_RxAllocateCallback() are not scanned */
+  while((READ_BIT(dmarxdesc->DESC3, ETH_DMARXNDESCWBF_OWN) == (uint32_t)RESET) && (descscancnt < (ETH_RX_DESC_CNT - dmarxdesclist->RxBuildDescCnt)))
   {
     descscancnt++;
     
@@ -792,6 +908,8 @@ uint8_t HAL_ETH_IsRxDataAvailable(ETH_HandleTypeDef *heth)
         WRITE_REG(firstappdescidx, descidx);
       }
       
+      lastdesc = (ETH_DMADescTypeDef *)dmarxdesc;
+      
       /* Increment current rx descriptor index */
       INCR_RX_DESC_INDEX(descidx, 1); 
       
@@ -806,6 +924,12 @@ uint8_t HAL_ETH_IsRxDataAvailable(ETH_HandleTypeDef *heth)
         dmarxdesclist->AppContextDesc = 1;
         /* Increment current rx descriptor index */
         INCR_RX_DESC_INDEX(descidx, 1); 
+        
+        ETH_PacketMetaPush(heth, lastdesc, dmarxdesc);
+      }
+      else
+      {
+        ETH_PacketMetaPush(heth, lastdesc, NULL);
       }
       
       /* Fill information to Rx descriptors list */
@@ -860,7 +984,7 @@ uint8_t HAL_ETH_IsRxDataAvailable(ETH_HandleTypeDef *heth)
       
       SET_BIT(dmarxdesc->DESC3, ETH_DMARXNDESCRF_OWN);
       
-      if(dmarxdesclist->ItMode != ((uint32_t)RESET))
+      if((dmarxdesclist->ItMode != ((uint32_t)RESET)) && ETH_RX_DESC_IOC(heth, descidx))
       {
         SET_BIT(dmarxdesc->DESC3, ETH_DMARXNDESCRF_IOC);
       }
@@ -1086,6 +1210,66 @@ HAL_StatusTypeDef HAL_ETH_GetRxDataInfo(ETH_HandleTypeDef *heth, ETH_RxPacketInf
   return HAL_OK;
 }
 
+/**
+  * @brief  Configures the Rx packet metadata ring. The driver then fills one
+  *         entry for each received packet, carrying its checksum status, VLAN
+  *         tag and hardware timestamp. A NULL pEntries disables the ring.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pEntries: pointer to the ring entries
+  * @param  Size: number of entries, at least 2
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_ConfigPacketMetaRing(ETH_HandleTypeDef *heth, ETH_PacketMetaTypeDef *pEntries, uint32_t Size)
+{
+  if ((pEntries != NULL) && (Size < 2U))
+  {
+    return HAL_ERROR;
+  }
+  
+  heth->MetaRing.pEntries = NULL;
+  heth->MetaRing.Size = Size;
+  heth->MetaRing.Head = 0U;
+  heth->MetaRing.Tail = 0U;
+  heth->MetaRing.Dropped = 0U;
+  heth->MetaRing.pEntries = pEntries;
+  
+  return HAL_OK;
+}
+
+/**
+  * @brief  Gets the metadata of the oldest received packet from the ring.
+  *         Metadata are read in the order the packets were received.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pMeta: pointer to a ETH_PacketMetaTypeDef structure to fill
+  * @retval HAL status: HAL_ERROR if the ring is empty
+  */
+HAL_StatusTypeDef HAL_ETH_GetPacketMeta(ETH_HandleTypeDef *heth, ETH_PacketMetaTypeDef *pMeta)
+{
+  ETH_PacketMetaRingTypeDef *ring = &heth->MetaRing;
+  uint32_t tail = ring->Tail;
+  
+  if ((ring->pEntries == NULL) || (tail == ring->Head))
+  {
+    return HAL_ERROR;
+  }
+  
+  *pMeta = ring->pEntries[tail];
+  
+  tail++;
+  if (tail == ring->Size)
+  {
+    tail = 0U;
+  }
+  
+  /* Release the entry once read */
+  __DMB();
+  ring->Tail = tail;
+  
+  return HAL_OK;
+}
+
 /**
 * @brief  This function gives back Rx Desc of the last received Packet
 *         to the DMA, so ETH DMA will be able to use these descriptors
@@ -1128,7 +1312,7 @@ HAL_StatusTypeDef HAL_ETH_BuildRxDescriptors(ETH_HandleTypeDef *heth)
     
     SET_BIT(dmarxdesc->DESC3, ETH_DMARXNDESCRF_OWN);
     
-    if(dmarxdesclist->ItMode != 0U)
+    if((dmarxdesclist->ItMode != 0U) && ETH_RX_DESC_IOC(heth, descindex))
     {
       SET_BIT(dmarxdesc->DESC3, ETH_DMARXNDESCRF_IOC);
     }
@@ -1151,6 +1335,149 @@ HAL_StatusTypeDef HAL_ETH_BuildRxDescriptors(ETH_HandleTypeDef *heth)
   return HAL_OK;
 }
 
+/**
+* @brief  This function hands the buffers of the last received Packet over
+*         to the application and refills its Rx descriptors with new buffers
+*         provided by HAL_ETH_RxAllocateCallback().
+*         Buffers are invalidated from the D-cache, so the Packet data can be
+*         read when this function returns. HAL_ETH_GetRxDataBuffer(),
+*         HAL_ETH_GetRxDataLength() and HAL_ETH_GetRxDataInfo() should be
+*         called before this function.
+*         When called with no received Packet, it retries the descriptors
+*         left without buffer by a previous call.
+* @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+*         the configuration information for ETHERNET module
+* @retval HAL status: HAL_OK if all descriptors are given back to the DMA,
+*         HAL_BUSY if the buffer pool ran empty.
+*/
+HAL_StatusTypeDef HAL_ETH_RefillRxDescriptors(ETH_HandleTypeDef *heth)
+{
+  ETH_RxDescListTypeDef *dmarxdesclist = &heth->RxDescList;
+  __IO ETH_DMADescTypeDef *dmarxdesc;
+  __IO ETH_DMADescTypeDef *lastdesc = NULL;
+  uint32_t descindex = dmarxdesclist->FirstAppDesc;
+  uint32_t totalappdescnbr = dmarxdesclist->AppDescNbr + dmarxdesclist->AppContextDesc;
+  uint32_t descscan;
+  uint8_t *buff;
+  
+  if(dmarxdesclist->AppDescNbr != 0U)
+  {
+    for(descscan = 0; descscan < dmarxdesclist->AppDescNbr; descscan++)
+    {
+      dmarxdesc = (ETH_DMADescTypeDef *)dmarxdesclist->RxDesc[descindex];
+      
+#if (__DCACHE_PRESENT == 1U)
+      if((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+      {
+        /* Drop the lines speculatively cached while the DMA was writing */
+        SCB_InvalidateDCache_by_Addr((uint32_t *)dmarxdesc->BackupAddr0, (int32_t)heth->Init.RxBuffLen);
+        
+        if (READ_REG(dmarxdesc->BackupAddr1) != 0U)
+        {
+          SCB_InvalidateDCache_by_Addr((uint32_t *)dmarxdesc->BackupAddr1, (int32_t)heth->Init.RxBuffLen);
+        }
+      }
+#endif /* __DCACHE_PRESENT */
+      
+      /* The buffers now belong to the application */
+      WRITE_REG(dmarxdesc->BackupAddr0, 0);
+      WRITE_REG(dmarxdesc->BackupAddr1, 0);
+      WRITE_REG(dmarxdesc->DESC3, 0);
+      
+      /* Increment rx descriptor index */
+      INCR_RX_DESC_INDEX(descindex, 1);
+    }
+    
+    if(dmarxdesclist->AppContextDesc != 0U)
+    {
+      /* The context descriptor keeps its buffer */
+      dmarxdesc = (ETH_DMADescTypeDef *)dmarxdesclist->RxDesc[descindex];
+      WRITE_REG(dmarxdesc->DESC3, 0);
+    }
+    
+    /* Append the Packet descriptors to the ones waiting for a buffer, the
+       descriptors rebuilt in between are kept as they are owned by the DMA */
+    if(dmarxdesclist->RxBuildDescCnt == 0U)
+    {
+      dmarxdesclist->RxBuildDescIdx = dmarxdesclist->FirstAppDesc;
+      dmarxdesclist->RxBuildDescCnt = totalappdescnbr;
+    }
+    else
+    {
+      dmarxdesclist->RxBuildDescCnt = ((dmarxdesclist->FirstAppDesc + totalappdescnbr + ETH_RX_DESC_CNT - 
+                                        dmarxdesclist->RxBuildDescIdx - 1U) % ETH_RX_DESC_CNT) + 1U;
+    }
+    
+    /* reset the Application desc number */
+    WRITE_REG(dmarxdesclist->AppDescNbr, 0);
+    WRITE_REG(dmarxdesclist->AppContextDesc, 0);
+  }
+  
+  while(dmarxdesclist->RxBuildDescCnt != 0U)
+  {
+    dmarxdesc = (ETH_DMADescTypeDef *)dmarxdesclist->RxDesc[dmarxdesclist->RxBuildDescIdx];
+    
+    if(READ_REG(dmarxdesc->BackupAddr0) == 0U)
+    {
+      buff = HAL_ETH_RxAllocateCallback(heth);
+      
+      if(buff == NULL)
+      {
+        /* Buffer pool is empty, retry on next call */
+        break;
+      }
+      
+#if (__DCACHE_PRESENT == 1U)
+      if((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+      {
+        /* Discard any dirty line which could be evicted over the received data */
+        SCB_InvalidateDCache_by_Addr((uint32_t *)buff, (int32_t)heth->Init.RxBuffLen);
+      }
+#endif /* __DCACHE_PRESENT */
+      
+      WRITE_REG(dmarxdesc->BackupAddr0, (uint32_t)buff);
+    }
+    
+    if(READ_BIT(dmarxdesc->DESC3, ETH_DMARXNDESCRF_OWN) == 0U)
+    {
+      WRITE_REG(dmarxdesc->DESC0, dmarxdesc->BackupAddr0);
+      WRITE_REG(dmarxdesc->DESC3, ETH_DMARXNDESCRF_BUF1V);
+      
+      if (READ_REG(dmarxdesc->BackupAddr1) != 0U)
+      {
+        WRITE_REG(dmarxdesc->DESC2, dmarxdesc->BackupAddr1);
+        SET_BIT(dmarxdesc->DESC3, ETH_DMARXNDESCRF_BUF2V);
+      }
+      
+      SET_BIT(dmarxdesc->DESC3, ETH_DMARXNDESCRF_OWN);
+      
+      if((dmarxdesclist->ItMode != 0U) && ETH_RX_DESC_IOC(heth, dmarxdesclist->RxBuildDescIdx))
+      {
+        SET_BIT(dmarxdesc->DESC3, ETH_DMARXNDESCRF_IOC);
+      }
+      
+      lastdesc = dmarxdesc;
+    }
+    
+    /* Increment rx descriptor index */
+    INCR_RX_DESC_INDEX(dmarxdesclist->RxBuildDescIdx, 1);
+    dmarxdesclist->RxBuildDescCnt--;
+  }
+  
+  if(lastdesc != NULL)
+  {
+    /* Set the Tail pointer address to the last rx descriptor given back to the DMA */
+    WRITE_REG(heth->Instance->DMACRDTPR, (uint32_t)lastdesc);
+  }
+  
+  if(dmarxdesclist->RxBuildDescCnt != 0U)
+  {
+    return HAL_BUSY;
+  }
+  
+  return HAL_OK;
+}
+
 
 /**
   * @brief  This function handles ETH interrupt request.
@@ -1168,6 +1495,7 @@ void HAL_ETH_IRQHandler(ETH_HandleTypeDef *heth)
       /* Call this function to update handle fields */
       if(HAL_ETH_IsRxDataAvailable(heth) == 1)
       {
+        __HAL_TRACE(HAL_TRACE_EVT_ETH_RX, heth->Instance);
         /* Receive complete callback */
         HAL_ETH_RxCpltCallback(heth);
       }
@@ -1182,6 +1510,9 @@ void HAL_ETH_IRQHandler(ETH_HandleTypeDef *heth)
   {
     if(__HAL_ETH_DMA_GET_IT_SOURCE(heth, ETH_DMACIER_TIE)) 
     {    
+      /* Release the packets sent */
+      (void)HAL_ETH_ReleaseTxPackets(heth);
+
       /* Transfer complete callback */
       HAL_ETH_TxCpltCallback(heth);
       
@@ -1289,6 +1620,24 @@ __weak void HAL_ETH_TxCpltCallback(ETH_HandleTypeDef *heth)
   */ 
 }
 
+/**
+  * @brief  Tx packet sent callback, called by HAL_ETH_ReleaseTxPackets() for
+  *         each packet whose Tx descriptors are released.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pData: pData of the ETH_TxPacketConfig the packet was sent with
+  * @retval None
+  */
+__weak void HAL_ETH_TxPacketCpltCallback(ETH_HandleTypeDef *heth, void *pData)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(heth);
+  UNUSED(pData);
+  /* NOTE : This function Should not be modified, when the callback is needed,
+  the HAL_ETH_TxPacketCpltCallback could be implemented in the user file
+  */
+}
+
 /**
   * @brief  Rx Transfer completed callbacks.
   * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
@@ -1304,6 +1653,23 @@ __weak void HAL_ETH_RxCpltCallback(ETH_HandleTypeDef *heth)
   */ 
 }
 
+/**
+  * @brief  Rx buffer allocation callback, called by HAL_ETH_RefillRxDescriptors()
+  *         to get a new buffer of Init.RxBuffLen bytes for each descriptor.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @retval Pointer to the new buffer, NULL if the buffer pool is empty.
+  */
+__weak uint8_t *HAL_ETH_RxAllocateCallback(ETH_HandleTypeDef *heth)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(heth);
+  /* NOTE : This function Should not be modified, when the callback is needed,
+  the HAL_ETH_RxAllocateCallback could be implemented in the user file
+  */ 
+  return NULL;
+}
+
 /**
   * @brief  Ethernet DMA transfer error callbacks
   * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
@@ -1377,6 +1743,39 @@ __weak void HAL_ETH_WakeUpCallback(ETH_HandleTypeDef *heth)
    */ 
 }
 
+/**
+  * @brief  PHY register transfer completed callback.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pXfer: pointer to a ETH_PHYTransferTypeDef structure that describes
+  *         the PHY register transfer
+  * @retval None
+  */
+__weak void HAL_ETH_PHYTransferCpltCallback(ETH_HandleTypeDef *heth, ETH_PHYTransferTypeDef *pXfer)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(heth);
+  UNUSED(pXfer);
+  /* NOTE : This function Should not be modified, when the callback is needed,
+  the HAL_ETH_PHYTransferCpltCallback could be implemented in the user file
+  */ 
+}
+
+/**
+  * @brief  Link status change callback.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @retval None
+  */
+__weak void HAL_ETH_LinkStatusCallback(ETH_HandleTypeDef *heth)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(heth);
+  /* NOTE : This function Should not be modified, when the callback is needed,
+  the HAL_ETH_LinkStatusCallback could be implemented in the user file
+  */ 
+}
+
 /**
   * @brief  Read a PHY register
   * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
@@ -1389,6 +1788,12 @@ __weak void HAL_ETH_WakeUpCallback(ETH_HandleTypeDef *heth)
 HAL_StatusTypeDef HAL_ETH_ReadPHYRegister(ETH_HandleTypeDef *heth, uint32_t PHYAddr, uint32_t PHYReg, uint32_t *pRegValue)
 {
   uint32_t tmpreg, tickstart;
+
+  /* Check that no PHY register transfer is queued */
+  if(heth->pPHYXferHead != NULL)
+  {
+    return HAL_ERROR;
+  }
   
   /* Check for the Busy flag */
   if(READ_BIT(heth->Instance->MACMDIOAR, ETH_MACMDIOAR_MB))
@@ -1443,6 +1848,12 @@ HAL_StatusTypeDef HAL_ETH_ReadPHYRegister(ETH_HandleTypeDef *heth, uint32_t PHYA
 HAL_StatusTypeDef HAL_ETH_WritePHYRegister(ETH_HandleTypeDef *heth, uint32_t PHYAddr, uint32_t PHYReg, uint32_t RegValue)
 {
   uint32_t tmpreg, tickstart;
+
+  /* Check that no PHY register transfer is queued */
+  if(heth->pPHYXferHead != NULL)
+  {
+    return HAL_ERROR;
+  }
   
   /* Check for the Busy flag */
   if(READ_BIT(heth->Instance->MACMDIOAR, ETH_MACMDIOAR_MB))
@@ -1485,6 +1896,179 @@ HAL_StatusTypeDef HAL_ETH_WritePHYRegister(ETH_HandleTypeDef *heth, uint32_t PHY
   return HAL_OK;
 }
 
+/**
+  * @brief  Queue a read of a PHY register, without waiting for its completion.
+  * @note   The MDIO interface has no completion interrupt: the transfers are
+  *         completed by HAL_ETH_PHY_IRQHandler(), which must be called periodically,
+  *         then reported through HAL_ETH_PHYTransferCpltCallback() with the read value
+  *         in pXfer->RegValue.
+  * @note   pXfer->PHYAddr and pXfer->PHYReg must be set. The structure belongs to the
+  *         driver until the completion callback is called for it.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pXfer: pointer to a ETH_PHYTransferTypeDef structure that describes
+  *         the PHY register transfer
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_ReadPHYRegister_IT(ETH_HandleTypeDef *heth, ETH_PHYTransferTypeDef *pXfer)
+{
+  if(pXfer == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  pXfer->Operation = ETH_PHY_OPERATION_READ;
+  ETH_PHYTransferQueue(heth, pXfer);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Queue a write of a PHY register, without waiting for its completion.
+  * @note   The transfer is completed by HAL_ETH_PHY_IRQHandler() and reported through
+  *         HAL_ETH_PHYTransferCpltCallback().
+  * @note   pXfer->PHYAddr, pXfer->PHYReg and pXfer->RegValue must be set. The structure
+  *         belongs to the driver until the completion callback is called for it.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pXfer: pointer to a ETH_PHYTransferTypeDef structure that describes
+  *         the PHY register transfer
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_WritePHYRegister_IT(ETH_HandleTypeDef *heth, ETH_PHYTransferTypeDef *pXfer)
+{
+  if(pXfer == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  pXfer->Operation = ETH_PHY_OPERATION_WRITE;
+  ETH_PHYTransferQueue(heth, pXfer);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Handle the queued PHY register transfers and the link poller.
+  * @note   This function must be called periodically, typically from a timer
+  *         interrupt handler every millisecond. It never waits: a call completes
+  *         the transfer in progress if the MDIO interface is no longer busy, and
+  *         starts the next queued transfer.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @retval None
+  */
+void HAL_ETH_PHY_IRQHandler(ETH_HandleTypeDef *heth)
+{
+  ETH_PHYTransferTypeDef *pxfer;
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t primask;
+  uint32_t linkstatus;
+
+  /* Poll the link status */
+  if((heth->LinkPollPeriod != 0U) && (heth->LinkPollXfer.Status != HAL_BUSY) && \
+     ((HAL_GetTick() - heth->LinkPollTick) >= heth->LinkPollPeriod))
+  {
+    heth->LinkPollTick = HAL_GetTick();
+    heth->LinkPollXfer.Operation = ETH_PHY_OPERATION_READ;
+    ETH_PHYTransferQueue(heth, &heth->LinkPollXfer);
+  }
+
+  pxfer = heth->pPHYXferHead;
+  if(pxfer == NULL)
+  {
+    return;
+  }
+
+  /* Check for the Busy flag */
+  if(READ_BIT(heth->Instance->MACMDIOAR, ETH_MACMDIOAR_MB) != 0U)
+  {
+    /* Check for the Timeout */
+    if((HAL_GetTick() - heth->PHYXferTickStart) <= ETH_MDIO_BUS_TIMEOUT)
+    {
+      return;
+    }
+    status = HAL_TIMEOUT;
+  }
+  else if(pxfer->Operation == ETH_PHY_OPERATION_READ)
+  {
+    pxfer->RegValue = (uint16_t)heth->Instance->MACMDIODR;
+  }
+
+  /* Remove the completed transfer from the queue and start the next one */
+  primask = __get_PRIMASK();
+  __disable_irq();
+  heth->pPHYXferHead = pxfer->pNext;
+  if(heth->pPHYXferHead == NULL)
+  {
+    heth->pPHYXferTail = NULL;
+  }
+  else
+  {
+    ETH_PHYTransferStart(heth, heth->pPHYXferHead);
+  }
+  __set_PRIMASK(primask);
+
+  pxfer->pNext = NULL;
+  pxfer->Status = status;
+
+  if(pxfer != &heth->LinkPollXfer)
+  {
+    HAL_ETH_PHYTransferCpltCallback(heth, pxfer);
+  }
+  else if(status == HAL_OK)
+  {
+    linkstatus = ((pxfer->RegValue & ETH_PHY_BSR_LINK_STATUS) != 0U) ? ETH_LINK_STATUS_UP : ETH_LINK_STATUS_DOWN;
+    if(linkstatus != heth->LinkStatus)
+    {
+      heth->LinkStatus = linkstatus;
+      HAL_ETH_LinkStatusCallback(heth);
+    }
+  }
+}
+
+/**
+  * @brief  Start the periodic poll of the link status of a PHY.
+  * @note   The PHY Basic Status Register is read through the PHY register transfer
+  *         queue by HAL_ETH_PHY_IRQHandler(). HAL_ETH_LinkStatusCallback() is called
+  *         on each change of the link status.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  PHYAddr: PHY port address, must be a value from 0 to 31
+  * @param  Period: link poll period in milliseconds, must be different from 0
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_StartLinkPoll(ETH_HandleTypeDef *heth, uint32_t PHYAddr, uint32_t Period)
+{
+  if((Period == 0U) || (heth->LinkPollXfer.Status == HAL_BUSY))
+  {
+    return HAL_ERROR;
+  }
+
+  heth->LinkPollXfer.PHYAddr = PHYAddr;
+  heth->LinkPollXfer.PHYReg = ETH_PHY_BSR;
+  heth->LinkStatus = ETH_LINK_STATUS_DOWN;
+
+  /* First poll on next call of HAL_ETH_PHY_IRQHandler() */
+  heth->LinkPollTick = HAL_GetTick() - Period;
+  heth->LinkPollPeriod = Period;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the periodic poll of the link status.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_StopLinkPoll(ETH_HandleTypeDef *heth)
+{
+  heth->LinkPollPeriod = 0U;
+
+  return HAL_OK;
+}
+
 /**
   * @}
   */
@@ -1658,6 +2242,47 @@ HAL_StatusTypeDef HAL_ETH_SetDMAConfig(ETH_HandleTypeDef *heth,  ETH_DMAConfigTy
   }
 }
 
+/**
+  * @brief  Configures the Rx and Tx interrupt moderation.
+  * @note   To be called before HAL_ETH_Start_IT(). The receive interrupt is then
+  *         requested by one Rx descriptor out of RxPacketCount, and raised by the
+  *         RIWT watchdog for the descriptors completed after it. The transmit
+  *         interrupt is requested by one packet out of TxPacketCount sent by
+  *         HAL_ETH_Transmit_IT(), and when the Tx descriptors are all in use.
+  * @note   As one receive interrupt can cover several packets, the application
+  *         reads them all, until HAL_ETH_IsRxDataAvailable() returns 0.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pConfig: pointer to a ETH_ITModerationTypeDef structure that contains
+  *         the interrupt moderation thresholds
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_ConfigITModeration(ETH_HandleTypeDef *heth, ETH_ITModerationTypeDef *pConfig)
+{
+  if((pConfig == NULL) || (pConfig->RxPacketCount > ETH_RX_DESC_CNT) ||
+     (pConfig->RxWatchdog > ETH_DMACRIWTR_RWT) ||
+     ((pConfig->RxPacketCount > 1U) && (pConfig->RxWatchdog == 0U)))
+  {
+    heth->ErrorCode |= HAL_ETH_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  if(heth->RxState == HAL_ETH_STATE_READY)
+  {
+    heth->ITModeration = *pConfig;
+    heth->TxDescList.PacketsNoIT = 0U;
+
+    /* Set the Rx interrupt watchdog timer count */
+    WRITE_REG(heth->Instance->DMACRIWTR, pConfig->RxWatchdog);
+
+    return HAL_OK;
+  }
+  else
+  {
+    return HAL_ERROR;
+  }
+}
+
 /**
   * @brief  Configures the Clock range of ETH MDIO interface.
   * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
@@ -2008,6 +2633,17 @@ uint32_t HAL_ETH_GetMACWakeUpSource(ETH_HandleTypeDef *heth)
   return heth->MACWakeUpEvent;
 }
 
+/**
+  * @brief  Returns the link status read by the link poller.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @retval Link status, a value of @ref ETH_Link_Status
+  */
+uint32_t HAL_ETH_GetLinkStatus(ETH_HandleTypeDef *heth)
+{
+  return heth->LinkStatus;
+}
+
 /**
   * @}
   */
@@ -2278,6 +2914,10 @@ static void ETH_DMATxDescListInit(ETH_HandleTypeDef *heth)
   }
   
   heth->TxDescList.CurTxDesc = 0;
+  heth->TxDescList.ReleaseTxDesc = 0;
+  heth->TxDescList.TxDescInUse = 0;
+  heth->TxDescList.PacketsNoIT = 0;
+  heth->TxDescList.TimeStamp = 0;
   
   /* Set Transmit Descriptor Ring Length */
   WRITE_REG(heth->Instance->DMACTDRLR, (ETH_TX_DESC_CNT -1));
@@ -2321,6 +2961,8 @@ static void ETH_DMARxDescListInit(ETH_HandleTypeDef *heth)
   WRITE_REG(heth->RxDescList.AppDescNbr, 0);
   WRITE_REG(heth->RxDescList.ItMode, 0);
   WRITE_REG(heth->RxDescList.AppContextDesc, 0);
+  WRITE_REG(heth->RxDescList.RxBuildDescIdx, 0);
+  WRITE_REG(heth->RxDescList.RxBuildDescCnt, 0);
   
   /* Set Receive Descriptor Ring Length */
   WRITE_REG(heth->Instance->DMACRDRLR, (ETH_RX_DESC_CNT - 1));
@@ -2346,11 +2988,33 @@ static uint32_t ETH_Prepare_Tx_Descriptors(ETH_HandleTypeDef *heth, ETH_TxPacket
   ETH_TxDescListTypeDef *dmatxdesclist = &heth->TxDescList; 
   uint32_t descidx = dmatxdesclist->CurTxDesc;
   uint32_t firstdescidx = dmatxdesclist->CurTxDesc;
-  uint32_t descnbr = 0, idx;
+  uint32_t descnbr = 0, idx, primask;
   ETH_DMADescTypeDef *dmatxdesc = (ETH_DMADescTypeDef *)dmatxdesclist->TxDesc[descidx];
-  
+
   ETH_BufferTypeDef  *txbuffer = pTxConfig->TxBuffer;
-  
+  const ETH_BufferTypeDef *bufscan;
+
+  /* Give back the descriptors of the packets already sent */
+  (void)HAL_ETH_ReleaseTxPackets(heth);
+
+  /* Two buffers per normal descriptor, plus the optional context descriptor */
+  for(bufscan = txbuffer; bufscan != NULL; bufscan = bufscan->next)
+  {
+    descnbr++;
+  }
+  descnbr = (descnbr + 1U) / 2U;
+  if((READ_BIT(pTxConfig->Attributes, ETH_TX_PACKETS_FEATURES_VLANTAG)) || (READ_BIT(pTxConfig->Attributes, ETH_TX_PACKETS_FEATURES_TSO)))
+  {
+    descnbr++;
+  }
+
+  /* Descriptors sent but not yet released cannot be used either */
+  if(descnbr > (ETH_TX_DESC_CNT - dmatxdesclist->TxDescInUse))
+  {
+    return HAL_ETH_ERROR_BUSY;
+  }
+  descnbr = 0U;
+
   /* Current Tx Descriptor Owned by DMA: cannot be used by the application  */
   if(READ_BIT(dmatxdesc->DESC3, ETH_DMATXNDESCWBF_OWN) == ETH_DMATXNDESCWBF_OWN)
   {
@@ -2477,6 +3141,16 @@ static uint32_t ETH_Prepare_Tx_Descriptors(ETH_HandleTypeDef *heth, ETH_TxPacket
     MODIFY_REG(dmatxdesc->DESC2, ETH_DMATXNDESCRF_VTIR, pTxConfig->VlanCtrl);		
   }
   
+  if(READ_BIT(pTxConfig->Attributes, ETH_TX_PACKETS_FEATURES_TTSE))
+  {
+    /* Capture the transmit timestamp of the packet */
+    SET_BIT(dmatxdesc->DESC2, ETH_DMATXNDESCRF_TTSE);
+  }
+  else
+  {
+    CLEAR_BIT(dmatxdesc->DESC2, ETH_DMATXNDESCRF_TTSE);
+  }
+
   /* Mark it as First Descriptor */
   SET_BIT(dmatxdesc->DESC3, ETH_DMATXNDESCRF_FD);
   /* Mark it as NORMAL descriptor */
@@ -2563,6 +3237,8 @@ static uint32_t ETH_Prepare_Tx_Descriptors(ETH_HandleTypeDef *heth, ETH_TxPacket
       }
     }
     
+    /* Timestamp enable valid in the first descriptor only */
+    CLEAR_BIT(dmatxdesc->DESC2, ETH_DMATXNDESCRF_TTSE);
     /* Set Own bit */
     SET_BIT(dmatxdesc->DESC3, ETH_DMATXNDESCRF_OWN);
     /* Mark it as NORMAL descriptor */
@@ -2571,6 +3247,16 @@ static uint32_t ETH_Prepare_Tx_Descriptors(ETH_HandleTypeDef *heth, ETH_TxPacket
   
   if(ItMode != ((uint32_t)RESET))
   {
+    dmatxdesclist->PacketsNoIT++;
+  }
+
+  /* Request the interrupt once every ITModeration.TxPacketCount packets, and
+     when the descriptors are all in use so that they get released */
+  if((ItMode != ((uint32_t)RESET)) && ((dmatxdesclist->PacketsNoIT >= heth->ITModeration.TxPacketCount) ||
+                                       ((dmatxdesclist->TxDescInUse + descnbr) >= ETH_TX_DESC_CNT)))
+  {
+    dmatxdesclist->PacketsNoIT = 0U;
+
     /* Set Interrupt on completition bit */
     SET_BIT(dmatxdesc->DESC2, ETH_DMATXNDESCRF_IOC);     
   }
@@ -2585,10 +3271,161 @@ static uint32_t ETH_Prepare_Tx_Descriptors(ETH_HandleTypeDef *heth, ETH_TxPacket
   
   dmatxdesclist->CurTxDesc = descidx;
   
+  /* Keep the application reference of the packet for HAL_ETH_TxPacketCpltCallback() */
+  dmatxdesclist->PacketData[descidx] = pTxConfig->pData;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  dmatxdesclist->TxDescInUse += descnbr;
+  __set_PRIMASK(primask);
+
   /* Return function status */
   return HAL_ETH_ERROR_NONE;
 }
 
+/**
+  * @brief  Add a PHY register transfer to the queue, and start it if the queue is idle.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pXfer: pointer to a ETH_PHYTransferTypeDef structure that describes
+  *         the PHY register transfer
+  * @retval None
+  */
+static void ETH_PHYTransferQueue(ETH_HandleTypeDef *heth, ETH_PHYTransferTypeDef *pXfer)
+{
+  uint32_t primask;
+
+  pXfer->pNext = NULL;
+  pXfer->Status = HAL_BUSY;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if(heth->pPHYXferTail == NULL)
+  {
+    heth->pPHYXferHead = pXfer;
+    ETH_PHYTransferStart(heth, pXfer);
+  }
+  else
+  {
+    heth->pPHYXferTail->pNext = pXfer;
+  }
+  heth->pPHYXferTail = pXfer;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Start a PHY register transfer on the MDIO interface.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pXfer: pointer to a ETH_PHYTransferTypeDef structure that describes
+  *         the PHY register transfer
+  * @retval None
+  */
+static void ETH_PHYTransferStart(ETH_HandleTypeDef *heth, ETH_PHYTransferTypeDef *pXfer)
+{
+  uint32_t tmpreg;
+
+  /* Get the MACMDIOAR value */
+  tmpreg = heth->Instance->MACMDIOAR;
+
+  /* Prepare the MDIO Address Register value
+     - Set the PHY device address
+     - Set the PHY register address
+     - Set the read or write mode
+     - Set the MII Busy bit */
+  MODIFY_REG(tmpreg, ETH_MACMDIOAR_PA, (pXfer->PHYAddr << 21));
+  MODIFY_REG(tmpreg, ETH_MACMDIOAR_RDA, (pXfer->PHYReg << 16));
+  if(pXfer->Operation == ETH_PHY_OPERATION_WRITE)
+  {
+    MODIFY_REG(tmpreg, ETH_MACMDIOAR_MOC, ETH_MACMDIOAR_MOC_WR);
+
+    /* Give the value to the MII data register */
+    WRITE_REG(heth->Instance->MACMDIODR, (uint16_t)pXfer->RegValue);
+  }
+  else
+  {
+    MODIFY_REG(tmpreg, ETH_MACMDIOAR_MOC, ETH_MACMDIOAR_MOC_RD);
+  }
+  SET_BIT(tmpreg, ETH_MACMDIOAR_MB);
+
+  /* Write the result value into the MDIO Address register */
+  WRITE_REG(heth->Instance->MACMDIOAR, tmpreg);
+
+  heth->PHYXferTickStart = HAL_GetTick();
+}
+
+/**
+  * @brief  Adds the metadata of the last received Packet to the packet
+  *         metadata ring, from its last and context Rx descriptors.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pLastDesc: last descriptor of the Packet
+  * @param  pContextDesc: context descriptor of the Packet, NULL if none
+  * @retval None
+  */
+static void ETH_PacketMetaPush(ETH_HandleTypeDef *heth, __IO const ETH_DMADescTypeDef *pLastDesc, __IO const ETH_DMADescTypeDef *pContextDesc)
+{
+  ETH_PacketMetaRingTypeDef *ring = &heth->MetaRing;
+  ETH_PacketMetaTypeDef meta;
+  uint32_t head;
+  
+  if (ring->pEntries == NULL)
+  {
+    return;
+  }
+  
+  meta.Length = READ_BIT(pLastDesc->DESC3, ETH_DMARXNDESCWBF_PL);
+  meta.Checksum = ETH_META_CHECKSUM_BYPASSED;
+  meta.VlanTag = 0U;
+  meta.TimeStamp = 0U;
+  
+  if(READ_BIT(pLastDesc->DESC3, ETH_DMARXNDESCWBF_RS0V) != 0U)
+  {
+    meta.VlanTag = READ_BIT(pLastDesc->DESC0, ETH_DMARXNDESCWBF_OVT);
+  }
+  
+  if(READ_BIT(pLastDesc->DESC3, ETH_DMARXNDESCWBF_RS1V) != 0U)
+  {
+    if((READ_BIT(pLastDesc->DESC1, ETH_DMARXNDESCWBF_IPCB) == 0U) &&
+       (READ_BIT(pLastDesc->DESC1, (ETH_DMARXNDESCWBF_IPV4 | ETH_DMARXNDESCWBF_IPV6)) != 0U))
+    {
+      meta.Checksum = ETH_META_CHECKSUM_OK;
+      if(READ_BIT(pLastDesc->DESC1, ETH_DMARXNDESCWBF_IPHE) != 0U)
+      {
+        meta.Checksum |= ETH_META_CHECKSUM_IP_HEADER_ERROR;
+      }
+      if(READ_BIT(pLastDesc->DESC1, ETH_DMARXNDESCWBF_IPCE) != 0U)
+      {
+        meta.Checksum |= ETH_META_CHECKSUM_IP_PAYLOAD_ERROR;
+      }
+    }
+    
+    if((pContextDesc != NULL) && (READ_BIT(pLastDesc->DESC1, ETH_DMARXNDESCWBF_TSA) != 0U))
+    {
+      meta.TimeStamp = ((uint64_t)READ_REG(pContextDesc->DESC1) << 32U) | (uint64_t)READ_REG(pContextDesc->DESC0);
+    }
+  }
+  
+  head = ring->Head + 1U;
+  if (head == ring->Size)
+  {
+    head = 0U;
+  }
+  
+  if (head == ring->Tail)
+  {
+    /* Ring is full */
+    ring->Dropped++;
+    return;
+  }
+  
+  ring->pEntries[ring->Head] = meta;
+  
+  /* Publish the entry once written */
+  __DMB();
+  ring->Head = head;
+}
+
 #endif /* HAL_ETH_MODULE_ENABLED */
 /**
   * @}
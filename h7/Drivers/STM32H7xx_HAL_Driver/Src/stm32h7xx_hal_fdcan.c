@@ -170,10 +170,15 @@
 static const uint8_t DLCtoBytes[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64};
 static const uint8_t CvtEltSize[] = {0, 0, 0, 0, 0, 1, 2, 3, 4, 0, 5, 0, 0, 0, 6, 0, 0, 0, 7};
 
+/* Message RAM area used by each instance, in words (size 0 when not allocated) */
+static uint32_t MsgRamStart[2];
+static uint32_t MsgRamSize[2];
+
 /* Private function prototypes -----------------------------------------------*/
 /** @addtogroup FDCAN_Private_Functions_Prototypes
   * @{
   */
+static HAL_StatusTypeDef FDCAN_AllocateMessageRAM(FDCAN_HandleTypeDef *hfdcan);
 static HAL_StatusTypeDef FDCAN_CalcultateRamBlockAddresses(FDCAN_HandleTypeDef *hfdcan);
 static HAL_StatusTypeDef FDCAN_CopyMessageToRAM(FDCAN_HandleTypeDef *hfdcan, FDCAN_TxHeaderTypeDef *pTxHeader, uint8_t *pTxData, uint32_t BufferIndex);
 /**
@@ -195,6 +200,7 @@ static HAL_StatusTypeDef FDCAN_CopyMessageToRAM(FDCAN_HandleTypeDef *hfdcan, FDC
     [..]  This section provides functions allowing to:
       (+) Initialize and configure the FDCAN.
       (+) De-initialize the FDCAN.
+      (+) Compute the message RAM size needed by a configuration.
       (+) Enter FDCAN peripheral in power down mode.
       (+) Exit power down mode.
 
@@ -447,8 +453,14 @@ HAL_StatusTypeDef HAL_FDCAN_Init(FDCAN_HandleTypeDef* hfdcan)
     CLEAR_BIT(hfdcan->ttcan->TTOCF, FDCAN_TTOCF_OM);
   }
 
-  /* Calculate each RAM block address */
-  FDCAN_CalcultateRamBlockAddresses(hfdcan);
+  /* Place the configuration in the message RAM, then calculate each RAM block address */
+  if((FDCAN_AllocateMessageRAM(hfdcan) != HAL_OK) || (FDCAN_CalcultateRamBlockAddresses(hfdcan) != HAL_OK))
+  {
+    /* Change FDCAN state */
+    hfdcan->State = HAL_FDCAN_STATE_ERROR;
+
+    return HAL_ERROR;
+  }
 
   /* Initialize the error code */
   hfdcan->ErrorCode = HAL_FDCAN_ERROR_NONE;
@@ -483,6 +495,9 @@ HAL_StatusTypeDef HAL_FDCAN_DeInit(FDCAN_HandleTypeDef* hfdcan)
   /* DeInit the low level hardware */
   HAL_FDCAN_MspDeInit(hfdcan);
 
+  /* Release the message RAM area */
+  MsgRamSize[(hfdcan->Instance == FDCAN1) ? 0U : 1U] = 0U;
+
   /* Reset the FDCAN ErrorCode */
   hfdcan->ErrorCode = HAL_FDCAN_ERROR_NONE;
 
@@ -523,6 +538,31 @@ __weak void HAL_FDCAN_MspDeInit(FDCAN_HandleTypeDef* hfdcan)
    */
 }
 
+/**
+  * @brief  Return the message RAM size needed by a configuration.
+  * @param  pInit: pointer to a FDCAN_InitTypeDef structure. Only the filters,
+  *         Rx FIFOs, Rx buffers, Tx event FIFO and Tx buffers fields are used.
+  * @retval Size in words, 0 if an element number exceeds the FDCAN limits.
+  */
+uint32_t HAL_FDCAN_GetMessageRAMSize(FDCAN_InitTypeDef *pInit)
+{
+  if((pInit->StdFiltersNbr > 128U) || (pInit->ExtFiltersNbr > 64U) ||
+     (pInit->RxFifo0ElmtsNbr > 64U) || (pInit->RxFifo1ElmtsNbr > 64U) ||
+     (pInit->RxBuffersNbr > 64U) || (pInit->TxEventsNbr > 32U) ||
+     ((pInit->TxBuffersNbr + pInit->TxFifoQueueElmtsNbr) > 32U))
+  {
+    return 0U;
+  }
+
+  return (pInit->StdFiltersNbr +
+          (pInit->ExtFiltersNbr * 2U) +
+          (pInit->RxFifo0ElmtsNbr * pInit->RxFifo0ElmtSize) +
+          (pInit->RxFifo1ElmtsNbr * pInit->RxFifo1ElmtSize) +
+          (pInit->RxBuffersNbr * pInit->RxBufferSize) +
+          (pInit->TxEventsNbr * 2U) +
+          ((pInit->TxBuffersNbr + pInit->TxFifoQueueElmtsNbr) * pInit->TxElmtSize));
+}
+
 /**
   * @brief  Enter FDCAN peripheral in sleep mode.
   * @param  hfdcan: pointer to an FDCAN_HandleTypeDef structure that contains
@@ -1414,6 +1454,9 @@ HAL_StatusTypeDef HAL_FDCAN_DisableTxDelayCompensation(FDCAN_HandleTypeDef *hfdc
       (+) HAL_FDCAN_IsRxBufferMessageAvailable   : Check if a new message is received in the selected Rx buffer
       (+) HAL_FDCAN_IsTxBufferMessagePending     : Check if a transmission request is pending on the selected Tx buffer
       (+) HAL_FDCAN_GetRxFifoFillLevel           : Return Rx FIFO fill level
+      (+) HAL_FDCAN_GetRxFifoBatch               : Give access in place to the oldest Rx FIFO elements
+      (+) HAL_FDCAN_ReleaseRxFifoBatch           : Acknowledge the Rx FIFO elements of a batch
+      (+) HAL_FDCAN_GetRxElementHeader           : Decode the header of an Rx element
       (+) HAL_FDCAN_GetTxFifoFreeLevel           : Return Tx FIFO free level
       (+) HAL_FDCAN_IsRestrictedOperationMode    : Check if the FDCAN peripheral entered Restricted Operation Mode
       (+) HAL_FDCAN_ExitRestrictedOperationMode  : Exit Restricted Operation Mode
@@ -1785,45 +1828,11 @@ HAL_StatusTypeDef HAL_FDCAN_GetRxMessage(FDCAN_HandleTypeDef *hfdcan, uint32_t R
       }
     }
 
-    /* Retrieve IdType */
-    pRxHeader->IdType = *RxAddress & FDCAN_ELEMENT_MASK_XTD;
-
-    /* Retrieve Identifier */
-    if(pRxHeader->IdType == FDCAN_STANDARD_ID) /* Standard ID element */
-    {
-      pRxHeader->Identifier = ((*RxAddress & FDCAN_ELEMENT_MASK_STDID) >> 18);
-    }
-    else /* Extended ID element */
-    {
-      pRxHeader->Identifier = (*RxAddress & FDCAN_ELEMENT_MASK_EXTID);
-    }
-
-    /* Retrieve RxFrameType */
-    pRxHeader->RxFrameType = (*RxAddress & FDCAN_ELEMENT_MASK_RTR);
-
-    /* Retrieve ErrorStateIndicator */
-    pRxHeader->ErrorStateIndicator = (*RxAddress++ & FDCAN_ELEMENT_MASK_ESI);
-
-    /* Retrieve RxTimestamp */
-    pRxHeader->RxTimestamp = (*RxAddress & FDCAN_ELEMENT_MASK_TS);
-
-    /* Retrieve DataLength */
-    pRxHeader->DataLength = (*RxAddress & FDCAN_ELEMENT_MASK_DLC);
-
-    /* Retrieve BitRateSwitch */
-    pRxHeader->BitRateSwitch = (*RxAddress & FDCAN_ELEMENT_MASK_BRS);
-
-    /* Retrieve FDFormat */
-    pRxHeader->FDFormat = (*RxAddress & FDCAN_ELEMENT_MASK_FDF);
-
-    /* Retrieve FilterIndex */
-    pRxHeader->FilterIndex = ((*RxAddress & FDCAN_ELEMENT_MASK_FIDX) >> 24);
-
-    /* Retrieve NonMatchingFrame */
-    pRxHeader->IsFilterMatchingFrame = ((*RxAddress++ & FDCAN_ELEMENT_MASK_ANMF) >> 31);
+    /* Retrieve Rx header */
+    HAL_FDCAN_GetRxElementHeader(RxAddress, pRxHeader);
 
     /* Retrieve Rx payload */
-    pData = (uint8_t *)RxAddress;
+    pData = (uint8_t *)&RxAddress[2];
     for(ByteCounter = 0; ByteCounter < DLCtoBytes[pRxHeader->DataLength >> 16]; ByteCounter++)
     {
       *pRxData++ = *pData++;
@@ -2116,6 +2125,183 @@ uint32_t HAL_FDCAN_GetRxFifoFillLevel(FDCAN_HandleTypeDef *hfdcan, uint32_t RxFi
   return FillLevel;
 }
 
+/**
+  * @brief  Give access in place to the oldest elements of an Rx FIFO.
+  * @note   The batch holds the elements stored from the FIFO get index up to the
+  *         last received one or the end of the FIFO area, so that they are
+  *         consecutive in the message RAM. The elements stay owned by the
+  *         application until HAL_FDCAN_ReleaseRxFifoBatch() is called: in
+  *         blocking mode the FDCAN does not overwrite them, in overwrite mode
+  *         they may be replaced while being read.
+  * @param  hfdcan: pointer to an FDCAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified FDCAN.
+  * @param  RxFifo: Rx FIFO.
+  *                 This parameter can be one of the following values:
+  *                   @arg FDCAN_RX_FIFO0: Rx FIFO 0
+  *                   @arg FDCAN_RX_FIFO1: Rx FIFO 1
+  * @param  pBatch: pointer to a FDCAN_RxBatchTypeDef structure, Count is 0 if
+  *         the FIFO is empty.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_FDCAN_GetRxFifoBatch(FDCAN_HandleTypeDef *hfdcan, uint32_t RxFifo, FDCAN_RxBatchTypeDef *pBatch)
+{
+  uint32_t Status;
+  uint32_t FifoSize;
+  uint32_t StartAddress;
+  uint32_t ElementSize;
+
+  /* Check function parameters */
+  assert_param(IS_FDCAN_RX_FIFO(RxFifo));
+
+  if((hfdcan->State == HAL_FDCAN_STATE_READY) || (hfdcan->State == HAL_FDCAN_STATE_BUSY))
+  {
+    if(RxFifo == FDCAN_RX_FIFO0)
+    {
+      FifoSize = hfdcan->Init.RxFifo0ElmtsNbr;
+      StartAddress = hfdcan->msgRam.RxFIFO0SA;
+      ElementSize = hfdcan->Init.RxFifo0ElmtSize * 4U;
+      Status = hfdcan->Instance->RXF0S;
+    }
+    else /* RxFifo == FDCAN_RX_FIFO1 */
+    {
+      FifoSize = hfdcan->Init.RxFifo1ElmtsNbr;
+      StartAddress = hfdcan->msgRam.RxFIFO1SA;
+      ElementSize = hfdcan->Init.RxFifo1ElmtSize * 4U;
+      Status = hfdcan->Instance->RXF1S;
+    }
+
+    /* Check that the Rx FIFO has an allocated area into the RAM */
+    if(FifoSize == 0U)
+    {
+      /* Update error code */
+      hfdcan->ErrorCode |= HAL_FDCAN_ERROR_PARAM;
+
+      return HAL_ERROR;
+    }
+
+    /* Get index and fill level fields are at the same position for both FIFOs */
+    pBatch->GetIndex = ((Status & FDCAN_RXF0S_F0GI) >> 8);
+    pBatch->Count = (Status & FDCAN_RXF0S_F0FL);
+    pBatch->ElementSize = ElementSize;
+    pBatch->pElement = (uint32_t *)(StartAddress + (pBatch->GetIndex * ElementSize));
+
+    /* Stop the batch at the end of the FIFO area */
+    if(pBatch->Count > (FifoSize - pBatch->GetIndex))
+    {
+      pBatch->Count = FifoSize - pBatch->GetIndex;
+    }
+
+    /* Return function status */
+    return HAL_OK;
+  }
+  else
+  {
+    /* Update error code */
+    hfdcan->ErrorCode |= HAL_FDCAN_ERROR_NOT_INITIALIZED;
+
+    return HAL_ERROR;
+  }
+}
+
+/**
+  * @brief  Acknowledge the first elements of an Rx FIFO batch.
+  * @note   A single acknowledge write frees all the elements, the batch is
+  *         updated to describe the elements left.
+  * @param  hfdcan: pointer to an FDCAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified FDCAN.
+  * @param  RxFifo: Rx FIFO the batch was taken from.
+  *                 This parameter can be one of the following values:
+  *                   @arg FDCAN_RX_FIFO0: Rx FIFO 0
+  *                   @arg FDCAN_RX_FIFO1: Rx FIFO 1
+  * @param  pBatch: pointer to the FDCAN_RxBatchTypeDef structure filled by
+  *         HAL_FDCAN_GetRxFifoBatch().
+  * @param  Count: number of elements read, from 1 to pBatch->Count.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_FDCAN_ReleaseRxFifoBatch(FDCAN_HandleTypeDef *hfdcan, uint32_t RxFifo, FDCAN_RxBatchTypeDef *pBatch, uint32_t Count)
+{
+  uint32_t LastIndex;
+
+  /* Check function parameters */
+  assert_param(IS_FDCAN_RX_FIFO(RxFifo));
+
+  if((Count == 0U) || (Count > pBatch->Count))
+  {
+    /* Update error code */
+    hfdcan->ErrorCode |= HAL_FDCAN_ERROR_PARAM;
+
+    return HAL_ERROR;
+  }
+
+  /* Acknowledging the last element read frees all the previous ones */
+  LastIndex = pBatch->GetIndex + Count - 1U;
+  if(RxFifo == FDCAN_RX_FIFO0)
+  {
+    hfdcan->Instance->RXF0A = LastIndex;
+  }
+  else /* RxFifo == FDCAN_RX_FIFO1 */
+  {
+    hfdcan->Instance->RXF1A = LastIndex;
+  }
+
+  /* Update the batch */
+  pBatch->GetIndex += Count;
+  pBatch->Count -= Count;
+  pBatch->pElement = (uint32_t *)((uint32_t)pBatch->pElement + (Count * pBatch->ElementSize));
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Decode the header of an Rx element stored in the message RAM.
+  * @param  pElement: address of the element, as given by __HAL_FDCAN_RX_BATCH_ELEMENT().
+  * @param  pRxHeader: pointer to a FDCAN_RxHeaderTypeDef structure.
+  * @retval None
+  */
+void HAL_FDCAN_GetRxElementHeader(const uint32_t *pElement, FDCAN_RxHeaderTypeDef *pRxHeader)
+{
+  uint32_t Word0 = pElement[0];
+  uint32_t Word1 = pElement[1];
+
+  /* Retrieve IdType */
+  pRxHeader->IdType = Word0 & FDCAN_ELEMENT_MASK_XTD;
+
+  /* Retrieve Identifier */
+  if(pRxHeader->IdType == FDCAN_STANDARD_ID) /* Standard ID element */
+  {
+    pRxHeader->Identifier = ((Word0 & FDCAN_ELEMENT_MASK_STDID) >> 18);
+  }
+  else /* Extended ID element */
+  {
+    pRxHeader->Identifier = (Word0 & FDCAN_ELEMENT_MASK_EXTID);
+  }
+
+  /* Retrieve RxFrameType */
+  pRxHeader->RxFrameType = (Word0 & FDCAN_ELEMENT_MASK_RTR);
+
+  /* Retrieve ErrorStateIndicator */
+  pRxHeader->ErrorStateIndicator = (Word0 & FDCAN_ELEMENT_MASK_ESI);
+
+  /* Retrieve RxTimestamp */
+  pRxHeader->RxTimestamp = (Word1 & FDCAN_ELEMENT_MASK_TS);
+
+  /* Retrieve DataLength */
+  pRxHeader->DataLength = (Word1 & FDCAN_ELEMENT_MASK_DLC);
+
+  /* Retrieve BitRateSwitch */
+  pRxHeader->BitRateSwitch = (Word1 & FDCAN_ELEMENT_MASK_BRS);
+
+  /* Retrieve FDFormat */
+  pRxHeader->FDFormat = (Word1 & FDCAN_ELEMENT_MASK_FDF);
+
+  /* Retrieve FilterIndex */
+  pRxHeader->FilterIndex = ((Word1 & FDCAN_ELEMENT_MASK_FIDX) >> 24);
+
+  /* Retrieve NonMatchingFrame */
+  pRxHeader->IsFilterMatchingFrame = ((Word1 & FDCAN_ELEMENT_MASK_ANMF) >> 31);
+}
+
 /**
   * @brief  Return Tx FIFO free level: number of consecutive free Tx FIFO
   *         elements starting from Tx FIFO GetIndex.
@@ -4604,6 +4790,68 @@ uint32_t HAL_FDCAN_GetError(FDCAN_HandleTypeDef *hfdcan)
   * @{
   */
 
+/**
+  * @brief  Check the message RAM area of the configuration against the area
+  *         used by the other instance, or choose it if the offset is
+  *         FDCAN_MESSAGE_RAM_OFFSET_AUTO.
+  * @param  hfdcan: pointer to an FDCAN_HandleTypeDef structure that contains
+  *                 the configuration information for the specified FDCAN.
+  * @retval HAL status
+ */
+static HAL_StatusTypeDef FDCAN_AllocateMessageRAM(FDCAN_HandleTypeDef *hfdcan)
+{
+  uint32_t Index = (hfdcan->Instance == FDCAN1) ? 0U : 1U;
+  uint32_t OtherStart = MsgRamStart[Index ^ 1U];
+  uint32_t OtherEnd = OtherStart + MsgRamSize[Index ^ 1U];
+  uint32_t Size;
+  uint32_t Offset;
+
+  Size = HAL_FDCAN_GetMessageRAMSize(&hfdcan->Init);
+  if((Size == 0U) || (Size > FDCAN_MESSAGE_RAM_WORDS))
+  {
+    /* Update error code */
+    hfdcan->ErrorCode |= HAL_FDCAN_ERROR_PARAM;
+
+    return HAL_ERROR;
+  }
+
+  if(hfdcan->Init.MessageRAMOffset == FDCAN_MESSAGE_RAM_OFFSET_AUTO)
+  {
+    /* First fit: below the other instance area, else right after it */
+    Offset = ((OtherStart == OtherEnd) || (Size <= OtherStart)) ? 0U : OtherEnd;
+  }
+  else
+  {
+    Offset = hfdcan->Init.MessageRAMOffset;
+
+    /* The area must not overlap the one of the other instance */
+    if((OtherStart != OtherEnd) && (Offset < OtherEnd) && (OtherStart < (Offset + Size)))
+    {
+      /* Update error code */
+      hfdcan->ErrorCode |= HAL_FDCAN_ERROR_PARAM;
+
+      return HAL_ERROR;
+    }
+  }
+
+  if((Offset > FDCAN_MESSAGE_RAM_WORDS) || (Size > (FDCAN_MESSAGE_RAM_WORDS - Offset)))
+  {
+    /* Update error code.
+       Message RAM overflow */
+    hfdcan->ErrorCode |= HAL_FDCAN_ERROR_PARAM;
+
+    return HAL_ERROR;
+  }
+
+  /* Record the area; the chosen offset is reported in the Init structure */
+  hfdcan->Init.MessageRAMOffset = Offset;
+  MsgRamStart[Index] = Offset;
+  MsgRamSize[Index] = Size;
+
+  /* Return function status */
+  return HAL_OK;
+}
+
 /**
   * @brief  Calculate each RAM block start address and size
   * @param  hfdcan: pointer to an FDCAN_HandleTypeDef structure that contains
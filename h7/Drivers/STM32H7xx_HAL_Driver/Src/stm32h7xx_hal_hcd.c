@@ -37,6 +37,15 @@
     (#)Enable HCD transmission and reception:
         (##) HAL_HCD_Start();
 
+    (#) With Init.dma_enable set, the OTG internal DMA moves the channel data
+        and USE_HAL_USB_CACHE_MAINTENANCE in hal_conf.h lets the driver keep
+        the D-cache coherent: transmit buffers are cleaned, receive buffers
+        cleaned and invalidated when the transfer starts, and invalidated
+        over the received bytes when it completes. Buffers must be word
+        aligned; receive buffers should start on a 32-byte cache line and
+        span whole lines (for example from the dma_pool utility), so that no
+        CPU data shares their lines.
+
   @endverbatim
   ******************************************************************************
   * @attention
@@ -94,6 +103,10 @@ static void HCD_HC_IN_IRQHandler(HCD_HandleTypeDef *hhcd, uint8_t chnum);
 static void HCD_HC_OUT_IRQHandler(HCD_HandleTypeDef *hhcd, uint8_t chnum); 
 static void HCD_RXQLVL_IRQHandler(HCD_HandleTypeDef *hhcd);
 static void HCD_Port_IRQHandler(HCD_HandleTypeDef *hhcd);
+#if (USE_HAL_USB_CACHE_MAINTENANCE == 1U)
+static void HCD_CacheStart(uint8_t *pBuf, uint32_t len, uint8_t rx);
+static void HCD_CacheEnd(uint8_t *pBuf, uint32_t len);
+#endif /* USE_HAL_USB_CACHE_MAINTENANCE */
 /**
   * @}
   */
@@ -441,6 +454,13 @@ HAL_StatusTypeDef HAL_HCD_HC_SubmitRequest(HCD_HandleTypeDef *hhcd,
   hhcd->hc[ch_num].ch_num = ch_num;
   hhcd->hc[ch_num].state = HC_IDLE;
   
+#if (USE_HAL_USB_CACHE_MAINTENANCE == 1U)
+  if (hhcd->Init.dma_enable == 1U)
+  {
+    HCD_CacheStart(pbuff, length, direction);
+  }
+#endif /* USE_HAL_USB_CACHE_MAINTENANCE */
+
   return USB_HC_StartXfer(hhcd->Instance, &(hhcd->hc[ch_num]), hhcd->Init.dma_enable);
 }
 
@@ -843,6 +863,9 @@ static void HCD_HC_IN_IRQHandler   (HCD_HandleTypeDef *hhcd, uint8_t chnum)
     {
       hhcd->hc[chnum].xfer_count = hhcd->hc[chnum].xfer_len - \
                                (USBx_HC(chnum)->HCTSIZ & USB_OTG_HCTSIZ_XFRSIZ);
+#if (USE_HAL_USB_CACHE_MAINTENANCE == 1U)
+      HCD_CacheEnd(hhcd->hc[chnum].xfer_buff, hhcd->hc[chnum].xfer_count);
+#endif /* USE_HAL_USB_CACHE_MAINTENANCE */
     }
     
     hhcd->hc[chnum].state = HC_XFRC;
@@ -1212,6 +1235,62 @@ static void HCD_Port_IRQHandler  (HCD_HandleTypeDef *hhcd)
   USBx_HPRT0 = hprt0_dup;
 }
 
+#if (USE_HAL_USB_CACHE_MAINTENANCE == 1U)
+/**
+  * @brief  Maintain the D-cache of a buffer before the OTG DMA transfers it.
+  *         The lines are written back, and also invalidated for a reception
+  *         so that none is evicted over the data written by the DMA.
+  * @param  pBuf transfer buffer
+  * @param  len  number of bytes
+  * @param  rx   1 when the DMA writes the buffer
+  * @retval None
+  */
+static void HCD_CacheStart(uint8_t *pBuf, uint32_t len, uint8_t rx)
+{
+  uint32_t start = (uint32_t)pBuf & ~(USB_OTG_CACHE_LINE_SIZE - 1U);
+  uint32_t end = (uint32_t)pBuf + len;
+
+  if ((len != 0U) && ((SCB->CCR & SCB_CCR_DC_Msk) != 0U))
+  {
+    if (rx == 0U)
+    {
+      SCB_CleanDCache_by_Addr((uint32_t *)start, (int32_t)(end - start));
+    }
+    else
+    {
+      SCB_CleanInvalidateDCache_by_Addr((uint32_t *)start, (int32_t)(end - start));
+    }
+  }
+}
+
+/**
+  * @brief  Drop the D-cache lines of the bytes the OTG DMA has received, so
+  *         that the CPU reads them from memory.
+  * @param  pBuf start of the received data
+  * @param  len  number of bytes received
+  * @retval None
+  */
+static void HCD_CacheEnd(uint8_t *pBuf, uint32_t len)
+{
+  uint32_t start = (uint32_t)pBuf;
+  uint32_t end = (uint32_t)pBuf + len;
+
+  if ((len != 0U) && ((SCB->CCR & SCB_CCR_DC_Msk) != 0U))
+  {
+    if (((start | end) & (USB_OTG_CACHE_LINE_SIZE - 1U)) == 0U)
+    {
+      SCB_InvalidateDCache_by_Addr((uint32_t *)start, (int32_t)len);
+    }
+    else
+    {
+      /* Keep the CPU data sharing the first and last lines */
+      start &= ~(USB_OTG_CACHE_LINE_SIZE - 1U);
+      SCB_CleanInvalidateDCache_by_Addr((uint32_t *)start, (int32_t)(end - start));
+    }
+  }
+}
+#endif /* USE_HAL_USB_CACHE_MAINTENANCE */
+
 /**
   * @}
   */
@@ -40,6 +40,15 @@
        the linked list remains circular and node 2 becomes the first one.
        Note that if the linked list is made circular the transfer will loop infinitely (or until aborted by the user).
 
+    [..]
+       (+) A multi-stage copy chain (for instance SDMMC buffer to AXI SRAM then to QSPI) can be described
+           as an array of MDMA_LinkNodeConfTypeDef, one per stage, and compiled once into a nodes arena
+           using HAL_MDMA_LinkedList_BuildJob(). Masked post-requests of each stage are kept in its node.
+       (+) The job is then started, as many times as needed, with HAL_MDMA_LinkedList_StartJob_IT():
+           the first node is loaded into the channel registers, so the handle Init and linked list
+           (from HAL_MDMA_LinkedList_AddNode) are not used, and the channel transfer complete callback
+           is called at the end of the last stage.
+
     [..]
        (+) User can select the transfer trigger mode (parameter TransferTriggerMode) to define the amount of data to be
            transfer upon a request :
@@ -1060,6 +1069,146 @@ HAL_StatusTypeDef HAL_MDMA_LinkedList_DisableCircularMode(MDMA_HandleTypeDef *hm
   return hal_status;  
 }
 
+/**
+  * @brief  Compile a chain of transfers into linked list nodes.
+  * @param  pJob       : Pointer to a MDMA_LinkedListJobTypeDef structure that contains
+  *                      the nodes arena.
+  * @param  pStages    : Pointer to an array of MDMA_LinkNodeConfTypeDef structures,
+  *                      one per stage of the chain, in execution order.
+  * @param  StageCount : Number of stages, from 1 to the number of nodes of the arena.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_MDMA_LinkedList_BuildJob(MDMA_LinkedListJobTypeDef *pJob, MDMA_LinkNodeConfTypeDef *pStages, uint32_t StageCount)
+{
+  uint32_t stage;
+  
+  /* Check the job and stages */
+  if((pJob == NULL) || (pJob->pNodes == NULL) || (pStages == NULL) || (StageCount == 0U) || (StageCount > pJob->NodeCount))
+  {
+    return HAL_ERROR;
+  }
+  
+  pJob->StageCount = 0;
+  
+  for(stage = 0; stage < StageCount; stage++)
+  {
+    if(HAL_MDMA_LinkedList_CreateNode(&pJob->pNodes[stage], &pStages[stage]) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+    
+    if(stage != 0U)
+    {
+      /* Link the previous stage to this one */
+      pJob->pNodes[stage - 1U].CLAR = (uint32_t)&pJob->pNodes[stage];
+    }
+  }
+  
+  pJob->StageCount = StageCount;
+  
+#if (__DCACHE_PRESENT == 1U)  
+  if((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    /* Nodes are read by the MDMA: write them back to memory */
+    SCB_CleanDCache_by_Addr((uint32_t *)pJob->pNodes, (int32_t)(StageCount * sizeof(MDMA_LinkNodeTypeDef)));
+  }
+#endif /* __DCACHE_PRESENT */
+  
+  return HAL_OK;
+}
+
+/**
+  * @brief  Start a compiled linked list job with interrupt enabled.
+  *         The first node is loaded into the channel registers and the following
+  *         ones are fetched by the MDMA, so the whole chain runs without CPU.
+  * @param  hmdma      : Pointer to a MDMA_HandleTypeDef structure that contains
+  *                      the configuration information for the specified MDMA Channel.
+  * @param  pJob       : Pointer to a MDMA_LinkedListJobTypeDef structure built by
+  *                      HAL_MDMA_LinkedList_BuildJob().
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_MDMA_LinkedList_StartJob_IT(MDMA_HandleTypeDef *hmdma, MDMA_LinkedListJobTypeDef *pJob)
+{
+  MDMA_LinkNodeTypeDef *pNode;
+  
+  /* Check the MDMA peripheral handle and the job */
+  if((hmdma == NULL) || (pJob == NULL) || (pJob->StageCount == 0U))
+  {
+    return HAL_ERROR;
+  }
+  
+  pNode = pJob->pNodes;
+  
+  /* Process locked */
+  __HAL_LOCK(hmdma);
+  
+  if(HAL_MDMA_STATE_READY == hmdma->State)
+  {
+    /* Change MDMA peripheral state */
+    hmdma->State = HAL_MDMA_STATE_BUSY;
+    
+    /* Initialize the error code */
+    hmdma->ErrorCode = HAL_MDMA_ERROR_NONE;     
+    
+    /* Disable the peripheral */
+    __HAL_MDMA_DISABLE(hmdma);
+    
+    /* Clear all interrupt flags */
+    __HAL_MDMA_CLEAR_FLAG(hmdma, MDMA_FLAG_TE | MDMA_FLAG_CTC | MDMA_CISR_BRTIF | MDMA_CISR_BTIF | MDMA_CISR_TCIF);  
+    
+    /* Load the first node into the channel registers */
+    hmdma->Instance->CTCR   = pNode->CTCR;
+    hmdma->Instance->CBNDTR = pNode->CBNDTR;
+    hmdma->Instance->CSAR   = pNode->CSAR;
+    hmdma->Instance->CDAR   = pNode->CDAR;
+    hmdma->Instance->CBRUR  = pNode->CBRUR;
+    hmdma->Instance->CLAR   = pNode->CLAR;
+    hmdma->Instance->CTBR   = pNode->CTBR;
+    hmdma->Instance->CMAR   = pNode->CMAR;
+    hmdma->Instance->CMDR   = pNode->CMDR;
+    
+    /* Enable Common interrupts i.e Transfer Error IT and Channel Transfer Complete IT*/
+    __HAL_MDMA_ENABLE_IT(hmdma, (MDMA_IT_TE | MDMA_IT_CTC));
+    
+    if(hmdma->XferBlockCpltCallback != NULL)
+    {
+      /* if Block transfer complete Callback is set enable the corresponding IT*/
+      __HAL_MDMA_ENABLE_IT(hmdma, MDMA_IT_BT);    
+    }
+    
+    if(hmdma->XferRepeatBlockCpltCallback != NULL)
+    {
+      /* if Repeated Block transfer complete Callback is set enable the corresponding IT*/      
+      __HAL_MDMA_ENABLE_IT(hmdma, MDMA_IT_BRT);    
+    }  
+    
+    if(hmdma->XferBufferCpltCallback != NULL)
+    {
+      /* if buffer transfer complete Callback is set enable the corresponding IT*/
+      __HAL_MDMA_ENABLE_IT(hmdma, MDMA_IT_BFTC);
+    }
+    
+    /* Enable the Peripheral */
+    __HAL_MDMA_ENABLE(hmdma);
+    
+    if((pNode->CTCR & MDMA_CTCR_SWRM) != 0U)
+    {
+      /* activate If SW request mode*/
+      hmdma->Instance->CCR |=  MDMA_CCR_SWRQ;
+    }  
+  }
+  else
+  {
+    /* Process unlocked */
+    __HAL_UNLOCK(hmdma);
+    
+    /* Return error status */
+    return HAL_BUSY;
+  }
+  
+  return HAL_OK;
+}
+
 /**
   * @}
   */
@@ -114,6 +114,21 @@
         You can choose either one block read operation or multiple block read operation 
         by adjusting the "NumberOfBlocks" parameter.
   
+  *** MMC Card programming wait ***
+  =================================
+  [..]
+    (+) After a write, instead of polling HAL_MMC_GetCardState() until the card
+        leaves the programming state, call HAL_MMC_WaitCardReady_IT(). The
+        HAL_MMC_CardReadyCallback() is called once the card is back in transfer
+        state (possibly before HAL_MMC_WaitCardReady_IT() returns), with
+        HAL_MMC_GetError() reporting a status command failure.
+        On this device the end of busy is signalled by the SDMMC BUSYD0END
+        interrupt after a busy response (R1b), such as the stop command sent at the
+        end of a write. HAL_MMC_PollCardReady() can still be called from a timer to
+        cover writes ending without a busy response.
+    (+) The handle is in HAL_MMC_STATE_PROGRAMMING during the wait, and the
+        read/write/erase functions return HAL_BUSY.
+
   *** MMC card CID register ***
   ============================
   [..]
@@ -149,6 +164,7 @@
       (+) Read_DMADblBuf1CpltCallback : callback when the DMA reception of second buffer is completed.
       (+) Write_DMADblBuf0CpltCallback : callback when the DMA transmission of first buffer is completed.
       (+) Write_DMADblBuf1CpltCallback : callback when the DMA transmission of second buffer is completed.
+      (+) CardReadyCallback : callback when the card has left the programming state.
       (+) MspInitCallback    : MMC MspInit.
       (+) MspDeInitCallback  : MMC MspDeInit.
     This function takes as parameters the HAL peripheral handle, the Callback ID
@@ -164,6 +180,7 @@
       (+) Read_DMADblBuf1CpltCallback : callback when the DMA reception of second buffer is completed.
       (+) Write_DMADblBuf0CpltCallback : callback when the DMA transmission of first buffer is completed.
       (+) Write_DMADblBuf1CpltCallback : callback when the DMA transmission of second buffer is completed.
+      (+) CardReadyCallback : callback when the card has left the programming state.
       (+) MspInitCallback    : MMC MspInit.
       (+) MspDeInitCallback  : MMC MspDeInit.
     This function) takes as parameters the HAL peripheral handle and the Callback ID.
@@ -257,6 +274,7 @@ static void     MMC_PowerOFF(MMC_HandleTypeDef *hmmc);
 static void     MMC_Write_IT(MMC_HandleTypeDef *hmmc);
 static void     MMC_Read_IT(MMC_HandleTypeDef *hmmc);
 static HAL_StatusTypeDef MMC_ReadExtCSD(MMC_HandleTypeDef *hmmc, uint32_t *pBlockNbr, uint32_t Timeout);
+static uint32_t MMC_CmdBlockLength(MMC_HandleTypeDef *hmmc);
 
 
 /**
@@ -318,6 +336,7 @@ HAL_StatusTypeDef HAL_MMC_Init(MMC_HandleTypeDef *hmmc)
     hmmc->Read_DMADblBuf1CpltCallback = HAL_MMCEx_Read_DMADoubleBuffer1CpltCallback;
     hmmc->Write_DMADblBuf0CpltCallback = HAL_MMCEx_Write_DMADoubleBuffer0CpltCallback;
     hmmc->Write_DMADblBuf1CpltCallback = HAL_MMCEx_Write_DMADoubleBuffer1CpltCallback;
+    hmmc->CardReadyCallback = HAL_MMC_CardReadyCallback;
 
     if(hmmc->MspInitCallback == NULL)
     {
@@ -545,7 +564,7 @@ HAL_StatusTypeDef HAL_MMC_ReadBlocks(MMC_HandleTypeDef *hmmc, uint8_t *pData, ui
     }
     
     /* Set Block Size for Card */
-    errorstate = SDMMC_CmdBlockLength(hmmc->Instance, BLOCKSIZE);
+    errorstate = MMC_CmdBlockLength(hmmc);
     if(errorstate != HAL_MMC_ERROR_NONE)
     {
       /* Clear all the static flags */
@@ -725,7 +744,7 @@ HAL_StatusTypeDef HAL_MMC_WriteBlocks(MMC_HandleTypeDef *hmmc, uint8_t *pData, u
     }
     
     /* Set Block Size for Card */ 
-    errorstate = SDMMC_CmdBlockLength(hmmc->Instance, BLOCKSIZE);
+    errorstate = MMC_CmdBlockLength(hmmc);
     if(errorstate != HAL_MMC_ERROR_NONE)
     {
       /* Clear all the static flags */
@@ -915,7 +934,7 @@ HAL_StatusTypeDef HAL_MMC_ReadBlocks_IT(MMC_HandleTypeDef *hmmc, uint8_t *pData,
     (void)SDMMC_ConfigData(hmmc->Instance, &config);
 
    /* Set Block Size for Card */ 
-    errorstate = SDMMC_CmdBlockLength(hmmc->Instance, BLOCKSIZE);
+    errorstate = MMC_CmdBlockLength(hmmc);
     if(errorstate != HAL_MMC_ERROR_NONE)
     {
      /* Clear all the static flags */
@@ -1013,7 +1032,7 @@ HAL_StatusTypeDef HAL_MMC_WriteBlocks_IT(MMC_HandleTypeDef *hmmc, uint8_t *pData
     }
     
     /* Set Block Size for Card */ 
-    errorstate = SDMMC_CmdBlockLength(hmmc->Instance, BLOCKSIZE);
+    errorstate = MMC_CmdBlockLength(hmmc);
     if(errorstate != HAL_MMC_ERROR_NONE)
     {
       /* Clear all the static flags */
@@ -1124,7 +1143,7 @@ HAL_StatusTypeDef HAL_MMC_ReadBlocks_DMA(MMC_HandleTypeDef *hmmc, uint8_t *pData
     (void)SDMMC_ConfigData(hmmc->Instance, &config);
     
     /* Set Block Size for Card */ 
-    errorstate = SDMMC_CmdBlockLength(hmmc->Instance, BLOCKSIZE);
+    errorstate = MMC_CmdBlockLength(hmmc);
     if(errorstate != HAL_MMC_ERROR_NONE)
     {
       /* Clear all the static flags */
@@ -1223,7 +1242,7 @@ HAL_StatusTypeDef HAL_MMC_WriteBlocks_DMA(MMC_HandleTypeDef *hmmc, uint8_t *pDat
     }
 
     /* Set Block Size for Card */ 
-    errorstate = SDMMC_CmdBlockLength(hmmc->Instance, BLOCKSIZE);
+    errorstate = MMC_CmdBlockLength(hmmc);
     if(errorstate != HAL_MMC_ERROR_NONE)
     {
       /* Clear all the static flags */
@@ -1384,6 +1403,90 @@ HAL_StatusTypeDef HAL_MMC_Erase(MMC_HandleTypeDef *hmmc, uint32_t BlockStartAdd,
   }
 }
 
+/**
+  * @brief  Waits for the card to leave the programming state without blocking.
+  *         HAL_MMC_CardReadyCallback() is called once the card is back in
+  *         transfer state.
+  * @note   The end of programming is detected by the SDMMC busy end interrupt,
+  *         or by HAL_MMC_PollCardReady() if the last command had no busy response.
+  * @note   Call it after the completion of a write or erase operation.
+  * @param  hmmc: Pointer to MMC handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_MMC_WaitCardReady_IT(MMC_HandleTypeDef *hmmc)
+{
+  if(hmmc->State != HAL_MMC_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+  
+  hmmc->ErrorCode = HAL_MMC_ERROR_NONE;
+  hmmc->Context = MMC_CONTEXT_WAIT_READY;
+  hmmc->State = HAL_MMC_STATE_PROGRAMMING;
+
+  /* Busy end is signalled after the busy response of the last command */
+  __HAL_MMC_ENABLE_IT(hmmc, SDMMC_IT_BUSYD0END);
+  if(__HAL_MMC_GET_FLAG(hmmc, SDMMC_FLAG_BUSYD0) != RESET)
+  {
+    return HAL_OK;
+  }
+
+  (void)HAL_MMC_PollCardReady(hmmc);
+  
+  return HAL_OK;
+}
+
+/**
+  * @brief  Checks with one status command whether the card waited for by 
+  *         HAL_MMC_WaitCardReady_IT() has left the programming state, and calls
+  *         HAL_MMC_CardReadyCallback() if so.
+  * @param  hmmc: Pointer to MMC handle
+  * @retval HAL status, HAL_BUSY while the card is programming
+  */
+HAL_StatusTypeDef HAL_MMC_PollCardReady(MMC_HandleTypeDef *hmmc)
+{
+  uint32_t cardstate = 0U;
+  uint32_t errorstate;
+  
+  if((hmmc->State != HAL_MMC_STATE_PROGRAMMING) || (hmmc->Context != MMC_CONTEXT_WAIT_READY))
+  {
+    return HAL_OK;
+  }
+
+  /* The busy end interrupt cannot complete the wait while the status is read */
+  __HAL_MMC_DISABLE_IT(hmmc, SDMMC_IT_BUSYD0END);
+  if((hmmc->State != HAL_MMC_STATE_PROGRAMMING) || (hmmc->Context != MMC_CONTEXT_WAIT_READY))
+  {
+    return HAL_OK;
+  }
+
+  errorstate = MMC_SendStatus(hmmc, &cardstate);
+  if(errorstate != HAL_MMC_ERROR_NONE)
+  {
+    hmmc->ErrorCode |= errorstate;
+  }
+  else
+  {
+    cardstate = ((cardstate >> 9U) & 0x0FU);
+    if((cardstate == HAL_MMC_CARD_PROGRAMMING) || (cardstate == HAL_MMC_CARD_RECEIVING))
+    {
+      __HAL_MMC_ENABLE_IT(hmmc, SDMMC_IT_BUSYD0END);
+      return HAL_BUSY;
+    }
+  }
+  
+  hmmc->Context = MMC_CONTEXT_NONE;
+  hmmc->State = HAL_MMC_STATE_READY;
+  
+#if defined (USE_HAL_MMC_REGISTER_CALLBACKS) && (USE_HAL_MMC_REGISTER_CALLBACKS == 1U)
+  hmmc->CardReadyCallback(hmmc);
+#else
+  HAL_MMC_CardReadyCallback(hmmc);
+#endif
+  
+  return HAL_OK;
+}
+
 /**
   * @brief  This function handles MMC card interrupt request.
   * @param  hmmc: Pointer to MMC handle
@@ -1412,8 +1515,10 @@ void HAL_MMC_IRQHandler(MMC_HandleTypeDef *hmmc)
       hmmc->Instance->DCTRL = 0;
       hmmc->Instance->IDMACTRL = SDMMC_DISABLE_IDMA ;
 
-      /* Stop Transfer for Write Single/Multi blocks or Read Multi blocks */
-      if(((context & MMC_CONTEXT_READ_MULTIPLE_BLOCK) != 0U) || ((context & MMC_CONTEXT_WRITE_MULTIPLE_BLOCK) != 0U))
+      /* Stop Transfer for Write Single/Multi blocks or Read Multi blocks, unless
+         the block count was set by CMD23 */
+      if((((context & MMC_CONTEXT_READ_MULTIPLE_BLOCK) != 0U) || ((context & MMC_CONTEXT_WRITE_MULTIPLE_BLOCK) != 0U)) &&
+         ((context & MMC_CONTEXT_CLOSED) == 0U))
       {
         errorstate = SDMMC_CmdStopTransfer(hmmc->Instance);
         if(errorstate != HAL_MMC_ERROR_NONE)
@@ -1450,7 +1555,8 @@ void HAL_MMC_IRQHandler(MMC_HandleTypeDef *hmmc)
     
     if((context & MMC_CONTEXT_IT) != 0U)
     {
-      if(((context & MMC_CONTEXT_READ_MULTIPLE_BLOCK) != 0U) || ((context & MMC_CONTEXT_WRITE_MULTIPLE_BLOCK) != 0U))
+      if((((context & MMC_CONTEXT_READ_MULTIPLE_BLOCK) != 0U) || ((context & MMC_CONTEXT_WRITE_MULTIPLE_BLOCK) != 0U)) &&
+         ((context & MMC_CONTEXT_CLOSED) == 0U))
       {
         errorstate = SDMMC_CmdStopTransfer(hmmc->Instance);
         if(errorstate != HAL_MMC_ERROR_NONE)
@@ -1598,6 +1704,12 @@ void HAL_MMC_IRQHandler(MMC_HandleTypeDef *hmmc)
     __HAL_MMC_CLEAR_FLAG(hmmc, SDMMC_IT_IDMABTC);
   }
 
+  else if((__HAL_MMC_GET_FLAG(hmmc, SDMMC_FLAG_BUSYD0END) != RESET) && (hmmc->Context == MMC_CONTEXT_WAIT_READY))
+  {
+    __HAL_MMC_CLEAR_FLAG(hmmc, SDMMC_FLAG_BUSYD0END);
+    (void)HAL_MMC_PollCardReady(hmmc);
+  }
+
   else
   {
     /* Nothing to do */
@@ -1685,6 +1797,21 @@ __weak void HAL_MMC_AbortCallback(MMC_HandleTypeDef *hmmc)
    */ 
 }
 
+/**
+  * @brief Card ready callback, end of the wait started by HAL_MMC_WaitCardReady_IT()
+  * @param hmmc: Pointer MMC handle
+  * @retval None
+  */
+__weak void HAL_MMC_CardReadyCallback(MMC_HandleTypeDef *hmmc)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hmmc);
+ 
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_MMC_CardReadyCallback can be implemented in the user file
+   */ 
+}
+
 #if defined (USE_HAL_MMC_REGISTER_CALLBACKS) && (USE_HAL_MMC_REGISTER_CALLBACKS == 1U)
 /**
   * @brief  Register a User MMC Callback
@@ -1700,6 +1827,7 @@ __weak void HAL_MMC_AbortCallback(MMC_HandleTypeDef *hmmc)
   *          @arg @ref HAL_MMC_READ_DMA_DBL_BUF1_CPLT_CB_ID  MMC DMA Rx Double buffer 1 Callback ID
   *          @arg @ref HAL_MMC_WRITE_DMA_DBL_BUF0_CPLT_CB_ID MMC DMA Tx Double buffer 0 Callback ID
   *          @arg @ref HAL_MMC_WRITE_DMA_DBL_BUF1_CPLT_CB_ID MMC DMA Tx Double buffer 1 Callback ID
+  *          @arg @ref HAL_MMC_CARD_READY_CB_ID              MMC Card Ready Callback ID
   *          @arg @ref HAL_MMC_MSP_INIT_CB_ID                MMC MspInit Callback ID 
   *          @arg @ref HAL_MMC_MSP_DEINIT_CB_ID              MMC MspDeInit Callback ID  
   * @param pCallback : pointer to the Callback function
@@ -1747,6 +1875,9 @@ HAL_StatusTypeDef HAL_MMC_RegisterCallback(MMC_HandleTypeDef *hmmc, HAL_MMC_Call
     case HAL_MMC_WRITE_DMA_DBL_BUF1_CPLT_CB_ID :
       hmmc->Write_DMADblBuf1CpltCallback = pCallback;
       break;
+    case HAL_MMC_CARD_READY_CB_ID :
+      hmmc->CardReadyCallback = pCallback;
+      break;
     case HAL_MMC_MSP_INIT_CB_ID :
       hmmc->MspInitCallback = pCallback;
       break;
@@ -1806,6 +1937,7 @@ HAL_StatusTypeDef HAL_MMC_RegisterCallback(MMC_HandleTypeDef *hmmc, HAL_MMC_Call
   *          @arg @ref HAL_MMC_READ_DMA_DBL_BUF1_CPLT_CB_ID  MMC DMA Rx Double buffer 1 Callback ID
   *          @arg @ref HAL_MMC_WRITE_DMA_DBL_BUF0_CPLT_CB_ID MMC DMA Tx Double buffer 0 Callback ID
   *          @arg @ref HAL_MMC_WRITE_DMA_DBL_BUF1_CPLT_CB_ID MMC DMA Tx Double buffer 1 Callback ID
+  *          @arg @ref HAL_MMC_CARD_READY_CB_ID              MMC Card Ready Callback ID
   *          @arg @ref HAL_MMC_MSP_INIT_CB_ID                MMC MspInit Callback ID 
   *          @arg @ref HAL_MMC_MSP_DEINIT_CB_ID              MMC MspDeInit Callback ID  
   * @retval status
@@ -1845,6 +1977,9 @@ HAL_StatusTypeDef HAL_MMC_UnRegisterCallback(MMC_HandleTypeDef *hmmc, HAL_MMC_Ca
     case HAL_MMC_WRITE_DMA_DBL_BUF1_CPLT_CB_ID :
       hmmc->Write_DMADblBuf1CpltCallback = HAL_MMCEx_Write_DMADoubleBuffer1CpltCallback;
       break;
+    case HAL_MMC_CARD_READY_CB_ID :
+      hmmc->CardReadyCallback = HAL_MMC_CardReadyCallback;
+      break;
     case HAL_MMC_MSP_INIT_CB_ID :
       hmmc->MspInitCallback = HAL_MMC_MspInit;
       break;
@@ -2543,7 +2678,7 @@ HAL_StatusTypeDef MMC_ReadExtCSD(MMC_HandleTypeDef *hmmc, uint32_t *pBlockNbr, u
   (void)SDMMC_ConfigData(hmmc->Instance, &config);
   
   /* Set Block Size for Card */
-  errorstate = SDMMC_CmdBlockLength(hmmc->Instance, BLOCKSIZE);
+  errorstate = MMC_CmdBlockLength(hmmc);
   if(errorstate != HAL_MMC_ERROR_NONE)
   {
     /* Clear all the static flags */
@@ -2615,6 +2750,22 @@ HAL_StatusTypeDef MMC_ReadExtCSD(MMC_HandleTypeDef *hmmc, uint32_t *pBlockNbr, u
   return HAL_OK;
 }
 
+/**
+  * @brief  Sets the block length to BLOCKSIZE, except in dual data rate mode
+  *         where CMD16 is illegal and the block length is fixed to 512 bytes.
+  * @param  hmmc: pointer to a MMC_HandleTypeDef structure that contains
+  *              the configuration information.
+  * @retval error state
+  */
+static uint32_t MMC_CmdBlockLength(MMC_HandleTypeDef *hmmc)
+{
+  if((hmmc->Instance->CLKCR & SDMMC_CLKCR_DDR) != 0U)
+  {
+    return HAL_MMC_ERROR_NONE;
+  }
+  return SDMMC_CmdBlockLength(hmmc->Instance, BLOCKSIZE);
+}
+
 /**
   * @brief  Wrap up reading in non-blocking mode.
   * @param  hmmc: pointer to a MMC_HandleTypeDef structure that contains
@@ -6,6 +6,8 @@
   *          This file provides firmware functions to manage the following 
   *          functionalities of the Secure Digital (MMC) peripheral:
   *           + Extended features functions
+  *           + High speed, DDR52 and HS200 bus modes with sampling tuning
+  *           + Reliable and packed writes
   *         
   @verbatim
   ==============================================================================
@@ -64,9 +66,86 @@
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
+/** @defgroup MMCEx_Private_Defines MMCEx Private Defines
+  * @{
+  */
+/* EXT_CSD fields */
+#define MMC_EXT_CSD_BUS_WIDTH           183U
+#define MMC_EXT_CSD_HS_TIMING           185U
+#define MMC_EXT_CSD_DEVICE_TYPE         196U
+#define MMC_EXT_CSD_MAX_PACKED_WRITES   500U
+
+#define MMC_DEVICE_TYPE_HS52            0x02U   /*!< High speed SDR at 52 MHz      */
+#define MMC_DEVICE_TYPE_DDR52           0x04U   /*!< DDR52 at 1.8 V or 3 V I/O      */
+#define MMC_DEVICE_TYPE_HS200           0x10U   /*!< HS200 at 1.8 V I/O             */
+
+#define MMC_HS_TIMING_DEFAULT           0x00U
+#define MMC_HS_TIMING_HIGH              0x01U
+#define MMC_HS_TIMING_HS200             0x02U
+
+#define MMC_BUS_WIDTH_DDR               0x04U   /*!< Added to the SDR bus width code */
+
+/* Bus clocks of the speed modes, in Hz */
+#define MMC_CLOCK_DEFAULT               26000000U
+#define MMC_CLOCK_HIGH                  52000000U
+#define MMC_CLOCK_HS200                 200000000U
+
+/* CMD6 SWITCH, write byte access */
+#define MMC_SWITCH_WRITE_BYTE           0x03000000U
+#define MMC_SWITCH_TIMEOUT              500U    /*!< ms, GENERIC_CMD6_TIME upper bound */
+#define MMC_TUNING_TIMEOUT              10U     /*!< ms, per tuning block             */
+
+/* Card status bits */
+#define MMC_STATUS_SWITCH_ERROR         0x00000080U
+#define MMC_STATUS_READY_FOR_DATA       0x00000100U
+
+/* CMD23 argument flags */
+#define MMC_BLOCK_COUNT_RELIABLE        0x80000000U
+#define MMC_BLOCK_COUNT_PACKED          0x40000000U
+
+/* Packed command header: version, write, then the entries */
+#define MMC_PACKED_VERSION              0x01U
+#define MMC_PACKED_WRITE                0x02U
+/**
+  * @}
+  */
+
 /* Private macro -------------------------------------------------------------*/
+#define MMC_EXT_CSD_BYTE(__HANDLE__, __INDEX__) \
+  ((uint8_t)((__HANDLE__)->Ext_CSD[(__INDEX__) / 4U] >> (((__INDEX__) % 4U) * 8U)))
+
 /* Private variables ---------------------------------------------------------*/
+/* HS200 tuning blocks (JESD84-B50), for the 4-bit and 8-bit buses */
+static const uint8_t MMC_TuningBlock4Bit[64] =
+{
+  0xFFU, 0x0FU, 0xFFU, 0x00U, 0xFFU, 0xCCU, 0xC3U, 0xCCU, 0xC3U, 0x3CU, 0xCCU, 0xFFU, 0xFEU, 0xFFU, 0xFEU, 0xEFU,
+  0xFFU, 0xDFU, 0xFFU, 0xDDU, 0xFFU, 0xFBU, 0xFFU, 0xFBU, 0xBFU, 0xFFU, 0x7FU, 0xFFU, 0x77U, 0xF7U, 0xBDU, 0xEFU,
+  0xFFU, 0xF0U, 0xFFU, 0xF0U, 0x0FU, 0xFCU, 0xCCU, 0x3CU, 0xCCU, 0x33U, 0xCCU, 0xCFU, 0xFFU, 0xEFU, 0xFFU, 0xEEU,
+  0xFFU, 0xFDU, 0xFFU, 0xFDU, 0xDFU, 0xFFU, 0xBFU, 0xFFU, 0xBBU, 0xFFU, 0xF7U, 0xFFU, 0xF7U, 0x7FU, 0x7BU, 0xDEU
+};
+
+static const uint8_t MMC_TuningBlock8Bit[128] =
+{
+  0xFFU, 0xFFU, 0x00U, 0xFFU, 0xFFU, 0xFFU, 0x00U, 0x00U, 0xFFU, 0xFFU, 0xCCU, 0xCCU, 0xCCU, 0x33U, 0xCCU, 0xCCU,
+  0xCCU, 0x33U, 0x33U, 0xCCU, 0xCCU, 0xCCU, 0xFFU, 0xFFU, 0xFFU, 0xEEU, 0xFFU, 0xFFU, 0xFFU, 0xEEU, 0xEEU, 0xFFU,
+  0xFFU, 0xFFU, 0xDDU, 0xFFU, 0xFFU, 0xFFU, 0xDDU, 0xDDU, 0xFFU, 0xFFU, 0xFFU, 0xBBU, 0xFFU, 0xFFU, 0xFFU, 0xBBU,
+  0xBBU, 0xFFU, 0xFFU, 0xFFU, 0x77U, 0xFFU, 0xFFU, 0xFFU, 0x77U, 0x77U, 0xFFU, 0x77U, 0xBBU, 0xDDU, 0xEEU, 0xFFU,
+  0xFFU, 0xFFU, 0xFFU, 0x00U, 0xFFU, 0xFFU, 0xFFU, 0x00U, 0x00U, 0xFFU, 0xFFU, 0xCCU, 0xCCU, 0xCCU, 0x33U, 0xCCU,
+  0xCCU, 0xCCU, 0x33U, 0x33U, 0xCCU, 0xCCU, 0xCCU, 0xFFU, 0xFFU, 0xFFU, 0xEEU, 0xFFU, 0xFFU, 0xFFU, 0xEEU, 0xEEU,
+  0xFFU, 0xFFU, 0xFFU, 0xDDU, 0xFFU, 0xFFU, 0xFFU, 0xDDU, 0xDDU, 0xFFU, 0xFFU, 0xFFU, 0xBBU, 0xFFU, 0xFFU, 0xFFU,
+  0xBBU, 0xBBU, 0xFFU, 0xFFU, 0xFFU, 0x77U, 0xFFU, 0xFFU, 0xFFU, 0x77U, 0x77U, 0xFFU, 0x77U, 0xBBU, 0xDDU, 0xEEU
+};
+
 /* Private function prototypes -----------------------------------------------*/
+static uint32_t MMCEx_ReadExtCSD(MMC_HandleTypeDef *hmmc);
+static uint32_t MMCEx_Switch(MMC_HandleTypeDef *hmmc, uint32_t Index, uint32_t Value);
+static uint32_t MMCEx_WaitSwitch(MMC_HandleTypeDef *hmmc);
+static void     MMCEx_SetBusClock(MMC_HandleTypeDef *hmmc, uint32_t Frequency, uint32_t Ddr, uint32_t Feedback);
+static uint32_t MMCEx_GetKernelClock(void);
+static uint32_t MMCEx_GetBusWidth(MMC_HandleTypeDef *hmmc);
+static uint32_t MMCEx_ReadTuningBlock(MMC_HandleTypeDef *hmmc, uint32_t *pBuffer, uint32_t Size);
+static HAL_StatusTypeDef MMCEx_StartClosedWrite(MMC_HandleTypeDef *hmmc, uint8_t *pData, uint32_t Address,
+                                                uint32_t NumberOfBlocks, uint32_t BlockCountArg);
 /* Private functions ---------------------------------------------------------*/
 /* Exported functions --------------------------------------------------------*/
 /** @addtogroup MMCEx_Exported_Functions
@@ -299,6 +378,753 @@ HAL_StatusTypeDef HAL_MMCEx_ChangeDMABuffer(MMC_HandleTypeDef *hmmc, HAL_MMCEx_D
 }
 
 
+/**
+  * @}
+  */
+
+/** @addtogroup MMCEx_Exported_Functions_Group2
+ *  @brief   Bus speed functions 
+ *
+@verbatim    
+  ==============================================================================
+          ##### Bus speed functions #####
+  ==============================================================================
+  [..]  
+    This section provides functions allowing to switch the card and the SDMMC
+    to the high speed, DDR52 and HS200 bus modes, and to tune the sampling
+    point of the HS200 mode with the DELAYBLOCK.
+    (+) Set the bus width with HAL_MMC_ConfigWideBusOperation() first: it
+        reinitializes the SDMMC clock. DDR52 and HS200 need a 4 or 8-bit bus.
+    (+) HS200 requires 1.8 V I/O on the card side: switch the transceiver or
+        the VCCQ supply before calling HAL_MMCEx_ConfigSpeedBusOperation().
+    (+) The bus clocks are derived from the SDMMC kernel clock (PLL1Q or
+        PLL2R): for HS200 at 200 MHz the kernel clock must be 200 MHz,
+        a lower kernel clock gives a lower bus clock.
+    (+) HAL_MMCEx_ExecuteTuning() can be called again in HS200 mode, after
+        a large temperature change for instance.
+      
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Switches the card and the SDMMC to a bus speed mode.
+  * @note   hmmc->Ext_CSD is refreshed with the card EXT_CSD register.
+  * @param  hmmc: MMC handle
+  * @param  SpeedMode: bus speed mode, a value of @ref MMCEx_Speed_Mode
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_MMCEx_ConfigSpeedBusOperation(MMC_HandleTypeDef *hmmc, uint32_t SpeedMode)
+{
+  uint32_t errorstate;
+  uint32_t width;
+  uint32_t devicetype;
+  uint32_t timing;
+
+  assert_param(IS_MMC_SPEED_MODE(SpeedMode));
+
+  if(hmmc->State != HAL_MMC_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+  hmmc->ErrorCode = HAL_MMC_ERROR_NONE;
+  hmmc->State = HAL_MMC_STATE_BUSY;
+
+  width = MMCEx_GetBusWidth(hmmc);
+  errorstate = MMCEx_ReadExtCSD(hmmc);
+  if(errorstate == HAL_MMC_ERROR_NONE)
+  {
+    devicetype = MMC_EXT_CSD_BYTE(hmmc, MMC_EXT_CSD_DEVICE_TYPE);
+    timing     = MMC_EXT_CSD_BYTE(hmmc, MMC_EXT_CSD_HS_TIMING);
+
+    if(((SpeedMode == MMC_SPEED_MODE_HIGH) && ((devicetype & MMC_DEVICE_TYPE_HS52) == 0U)) ||
+       ((SpeedMode == MMC_SPEED_MODE_DDR) && (((devicetype & MMC_DEVICE_TYPE_DDR52) == 0U) || (width == 0U))) ||
+       ((SpeedMode == MMC_SPEED_MODE_HS200) && (((devicetype & MMC_DEVICE_TYPE_HS200) == 0U) || (width == 0U))))
+    {
+      errorstate = HAL_MMC_ERROR_UNSUPPORTED_FEATURE;
+    }
+  }
+
+  if(errorstate == HAL_MMC_ERROR_NONE)
+  {
+    /* The switches take place at the backward compatible clock, valid in all
+       the timings, with the SDR sampling */
+    MMCEx_SetBusClock(hmmc, MMC_CLOCK_DEFAULT, 0U, 0U);
+
+    /* Back to a SDR bus: leaves DDR52, and HS200 only works with it */
+    errorstate = MMCEx_Switch(hmmc, MMC_EXT_CSD_BUS_WIDTH, width);
+
+    if(errorstate == HAL_MMC_ERROR_NONE)
+    {
+      switch(SpeedMode)
+      {
+        case MMC_SPEED_MODE_HIGH:
+          errorstate = MMCEx_Switch(hmmc, MMC_EXT_CSD_HS_TIMING, MMC_HS_TIMING_HIGH);
+          if(errorstate == HAL_MMC_ERROR_NONE)
+          {
+            MMCEx_SetBusClock(hmmc, MMC_CLOCK_HIGH, 0U, 0U);
+          }
+          break;
+
+        case MMC_SPEED_MODE_DDR:
+          /* DDR52 is entered from the high speed timing */
+          if(timing != MMC_HS_TIMING_HIGH)
+          {
+            errorstate = MMCEx_Switch(hmmc, MMC_EXT_CSD_HS_TIMING, MMC_HS_TIMING_HIGH);
+          }
+          if(errorstate == HAL_MMC_ERROR_NONE)
+          {
+            errorstate = MMCEx_Switch(hmmc, MMC_EXT_CSD_BUS_WIDTH, width + MMC_BUS_WIDTH_DDR);
+          }
+          if(errorstate == HAL_MMC_ERROR_NONE)
+          {
+            MMCEx_SetBusClock(hmmc, MMC_CLOCK_HIGH, 1U, 0U);
+          }
+          break;
+
+        case MMC_SPEED_MODE_HS200:
+          errorstate = MMCEx_Switch(hmmc, MMC_EXT_CSD_HS_TIMING, MMC_HS_TIMING_HS200);
+          if(errorstate == HAL_MMC_ERROR_NONE)
+          {
+            MMCEx_SetBusClock(hmmc, MMC_CLOCK_HS200, 0U, 1U);
+          }
+          break;
+
+        default:
+          errorstate = MMCEx_Switch(hmmc, MMC_EXT_CSD_HS_TIMING, MMC_HS_TIMING_DEFAULT);
+          break;
+      }
+    }
+
+    if(SpeedMode != MMC_SPEED_MODE_HS200)
+    {
+#if defined (DLYB_SDMMC1) || defined (DLYB_SDMMC2)
+      (void)DelayBlock_Disable((hmmc->Instance == SDMMC1) ? DLYB_SDMMC1 : DLYB_SDMMC2);
+#endif /* (DLYB_SDMMC1) || (DLYB_SDMMC2) */
+    }
+  }
+
+  /* Clear all the static flags */
+  __HAL_MMC_CLEAR_FLAG(hmmc, SDMMC_STATIC_FLAGS);
+  hmmc->State = HAL_MMC_STATE_READY;
+
+  if(errorstate != HAL_MMC_ERROR_NONE)
+  {
+    hmmc->ErrorCode |= errorstate;
+    return HAL_ERROR;
+  }
+
+  if(SpeedMode == MMC_SPEED_MODE_HS200)
+  {
+    return HAL_MMCEx_ExecuteTuning(hmmc);
+  }
+  return HAL_OK;
+}
+
+/**
+  * @brief  Tunes the sampling point of the HS200 mode: the tuning block is
+  *         read with each output phase of the DELAYBLOCK, the phase in the
+  *         middle of the longest run of good reads is kept.
+  * @param  hmmc: MMC handle, card in HS200 mode
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_MMCEx_ExecuteTuning(MMC_HandleTypeDef *hmmc)
+{
+#if defined (DLYB_SDMMC1) || defined (DLYB_SDMMC2)
+  DLYB_TypeDef *dlyb = (hmmc->Instance == SDMMC1) ? DLYB_SDMMC1 : DLYB_SDMMC2;
+  uint32_t block[128U / 4U];
+  const uint8_t *pattern;
+  uint32_t size;
+  uint32_t phases;
+  uint32_t phase;
+  uint32_t errorstate;
+  uint32_t i;
+  uint32_t run = 0U;
+  uint32_t best = 0U;
+  uint32_t bestend = 0U;
+
+  if(hmmc->State != HAL_MMC_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+  hmmc->ErrorCode = HAL_MMC_ERROR_NONE;
+  hmmc->State = HAL_MMC_STATE_BUSY;
+
+  if(MMCEx_GetBusWidth(hmmc) == 2U)
+  {
+    pattern = MMC_TuningBlock8Bit;
+    size    = sizeof(MMC_TuningBlock8Bit);
+  }
+  else
+  {
+    pattern = MMC_TuningBlock4Bit;
+    size    = sizeof(MMC_TuningBlock4Bit);
+  }
+
+  /* Unit delay calibrated on the bus clock period */
+  if(DelayBlock_Enable(dlyb) != HAL_OK)
+  {
+    hmmc->ErrorCode |= HAL_MMC_ERROR_GENERAL_UNKNOWN_ERR;
+    hmmc->State = HAL_MMC_STATE_READY;
+    return HAL_ERROR;
+  }
+  phases = DelayBlock_GetPhases(dlyb);
+
+  for(phase = 0U; phase < phases; phase++)
+  {
+    (void)DelayBlock_SetPhase(dlyb, phase);
+    errorstate = MMCEx_ReadTuningBlock(hmmc, block, size);
+    for(i = 0U; (errorstate == HAL_MMC_ERROR_NONE) && (i < size); i++)
+    {
+      if(((uint8_t *)block)[i] != pattern[i])
+      {
+        errorstate = HAL_MMC_ERROR_DATA_CRC_FAIL;
+      }
+    }
+    if(errorstate == HAL_MMC_ERROR_NONE)
+    {
+      run++;
+      if(run > best)
+      {
+        best    = run;
+        bestend = phase;
+      }
+    }
+    else
+    {
+      run = 0U;
+    }
+  }
+
+  __HAL_MMC_CLEAR_FLAG(hmmc, SDMMC_STATIC_FLAGS);
+  hmmc->State = HAL_MMC_STATE_READY;
+
+  if(best == 0U)
+  {
+    (void)DelayBlock_Disable(dlyb);
+    hmmc->ErrorCode |= HAL_MMC_ERROR_DATA_CRC_FAIL;
+    return HAL_ERROR;
+  }
+
+  /* Middle of the window */
+  (void)DelayBlock_SetPhase(dlyb, bestend - ((best - 1U) / 2U));
+  return HAL_OK;
+#else
+  hmmc->ErrorCode |= HAL_MMC_ERROR_UNSUPPORTED_FEATURE;
+  return HAL_ERROR;
+#endif /* (DLYB_SDMMC1) || (DLYB_SDMMC2) */
+}
+
+/**
+  * @}
+  */
+
+/** @addtogroup MMCEx_Exported_Functions_Group3
+ *  @brief   Reliable and packed write functions 
+ *
+@verbatim    
+  ==============================================================================
+          ##### Reliable and packed write functions #####
+  ==============================================================================
+  [..]  
+    This section provides closed-ended writes by the internal DMA: the block
+    count is given by CMD23 beforehand, no stop command ends the transfer.
+    (+) A reliable write keeps the old data of the blocks if the power is lost
+        during the write. Unless the WR_REL_PARAM field of the EXT_CSD tells
+        that the card supports the enhanced definition, the address and the
+        block count must be multiples of REL_WR_SEC_C blocks.
+    (+) A packed write gathers several writes, possibly to distant addresses,
+        in one transfer: the first block of pData holds the packed header,
+        built here, followed by the data of the entries in their order. Up to
+        the MAX_PACKED_WRITES field of the EXT_CSD entries are allowed. After
+        an error the PACKED_COMMAND_STATUS and PACKED_FAILURE_INDEX fields of
+        the EXT_CSD tell which entry failed.
+    (+) The end is reported as for HAL_MMC_WriteBlocks_DMA(), by
+        HAL_MMC_TxCpltCallback(), then HAL_MMC_GetCardState() tells when the
+        card has programmed the data.
+      
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Reliable write of blocks by the internal DMA.
+  * @param  hmmc: MMC handle
+  * @param  pData: data to write, in a RAM the IDMA reaches, cleaned from the
+  *         data cache
+  * @param  BlockAdd: first block address
+  * @param  NumberOfBlocks: blocks to write
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_MMCEx_WriteBlocksReliable_DMA(MMC_HandleTypeDef *hmmc, uint8_t *pData, uint32_t BlockAdd, uint32_t NumberOfBlocks)
+{
+  uint32_t add = BlockAdd;
+
+  if((NULL == pData) || (NumberOfBlocks == 0U) || (NumberOfBlocks >= MMC_BLOCK_COUNT_PACKED))
+  {
+    hmmc->ErrorCode |= HAL_MMC_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  if(hmmc->State != HAL_MMC_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+  hmmc->ErrorCode = HAL_MMC_ERROR_NONE;
+
+  if((BlockAdd + NumberOfBlocks) > (hmmc->MmcCard.LogBlockNbr))
+  {
+    hmmc->ErrorCode |= HAL_MMC_ERROR_ADDR_OUT_OF_RANGE;
+    return HAL_ERROR;
+  }
+
+  if ((hmmc->MmcCard.CardType) != MMC_HIGH_CAPACITY_CARD)
+  {
+    add *= 512U;
+  }
+
+  return MMCEx_StartClosedWrite(hmmc, pData, add, NumberOfBlocks, NumberOfBlocks | MMC_BLOCK_COUNT_RELIABLE);
+}
+
+/**
+  * @brief  Packed write of several block ranges in one transfer by the
+  *         internal DMA.
+  * @param  hmmc: MMC handle
+  * @param  pData: packed header block, filled here, followed by the data of
+  *         the entries; in a RAM the IDMA reaches, the data cleaned from the
+  *         data cache
+  * @param  pEntries: writes to pack
+  * @param  EntryNbr: number of entries, MMC_PACKED_MAX_ENTRIES at most
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_MMCEx_WritePacked_DMA(MMC_HandleTypeDef *hmmc, uint8_t *pData, const HAL_MMCEx_PackedEntryTypeDef *pEntries, uint32_t EntryNbr)
+{
+  uint32_t *pHeader = (uint32_t *)pData;
+  uint32_t maxentries;
+  uint32_t blocks = 1U;
+  uint32_t add;
+  uint32_t i;
+
+  if((NULL == pData) || (NULL == pEntries) || (EntryNbr == 0U) || (EntryNbr > MMC_PACKED_MAX_ENTRIES))
+  {
+    hmmc->ErrorCode |= HAL_MMC_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  if(hmmc->State != HAL_MMC_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+  hmmc->ErrorCode = HAL_MMC_ERROR_NONE;
+
+  /* Limit of the card, when its EXT_CSD was read */
+  maxentries = MMC_EXT_CSD_BYTE(hmmc, MMC_EXT_CSD_MAX_PACKED_WRITES);
+  if((MMC_EXT_CSD_BYTE(hmmc, MMC_EXT_CSD_DEVICE_TYPE) != 0U) && (EntryNbr > maxentries))
+  {
+    hmmc->ErrorCode |= HAL_MMC_ERROR_UNSUPPORTED_FEATURE;
+    return HAL_ERROR;
+  }
+
+  for(i = 0U; i < (BLOCKSIZE / 4U); i++)
+  {
+    pHeader[i] = 0U;
+  }
+  pHeader[0] = MMC_PACKED_VERSION | (MMC_PACKED_WRITE << 8U) | (EntryNbr << 16U);
+  for(i = 0U; i < EntryNbr; i++)
+  {
+    if((pEntries[i].NumberOfBlocks == 0U) ||
+       ((pEntries[i].BlockAdd + pEntries[i].NumberOfBlocks) > (hmmc->MmcCard.LogBlockNbr)))
+    {
+      hmmc->ErrorCode |= HAL_MMC_ERROR_ADDR_OUT_OF_RANGE;
+      return HAL_ERROR;
+    }
+    add = pEntries[i].BlockAdd;
+    if ((hmmc->MmcCard.CardType) != MMC_HIGH_CAPACITY_CARD)
+    {
+      add *= 512U;
+    }
+
+    /* CMD23 then CMD25 arguments of the entry */
+    pHeader[(2U * i) + 2U] = pEntries[i].NumberOfBlocks |
+                             ((pEntries[i].Reliable != (uint32_t)DISABLE) ? MMC_BLOCK_COUNT_RELIABLE : 0U);
+    pHeader[(2U * i) + 3U] = add;
+    blocks += pEntries[i].NumberOfBlocks;
+  }
+
+  if(blocks >= MMC_BLOCK_COUNT_PACKED)
+  {
+    hmmc->ErrorCode |= HAL_MMC_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  /* The header is read by the IDMA */
+  if((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    SCB_CleanDCache_by_Addr(pHeader, (int32_t)BLOCKSIZE);
+  }
+
+  /* CMD25 carries the address of the first entry */
+  return MMCEx_StartClosedWrite(hmmc, pData, pHeader[3], blocks, blocks | MMC_BLOCK_COUNT_PACKED);
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup MMCEx_Private_Functions MMCEx Private Functions
+  * @{
+  */
+
+/**
+  * @brief  Reads the EXT_CSD register of the card into hmmc->Ext_CSD.
+  * @param  hmmc: MMC handle
+  * @retval error state
+  */
+static uint32_t MMCEx_ReadExtCSD(MMC_HandleTypeDef *hmmc)
+{
+  SDMMC_DataInitTypeDef config;
+  uint32_t errorstate;
+  uint32_t tickstart = HAL_GetTick();
+  uint32_t count;
+  uint32_t i = 0U;
+
+  /* Initialize data control register */
+  hmmc->Instance->DCTRL = 0U;
+
+  /* In DDR mode the block length is fixed to 512 bytes and CMD16 is illegal */
+  if((hmmc->Instance->CLKCR & SDMMC_CLKCR_DDR) == 0U)
+  {
+    errorstate = SDMMC_CmdBlockLength(hmmc->Instance, BLOCKSIZE);
+    if(errorstate != HAL_MMC_ERROR_NONE)
+    {
+      return errorstate;
+    }
+  }
+
+  config.DataTimeOut   = SDMMC_DATATIMEOUT;
+  config.DataLength    = BLOCKSIZE;
+  config.DataBlockSize = SDMMC_DATABLOCK_SIZE_512B;
+  config.TransferDir   = SDMMC_TRANSFER_DIR_TO_SDMMC;
+  config.TransferMode  = SDMMC_TRANSFER_MODE_BLOCK;
+  config.DPSM          = SDMMC_DPSM_ENABLE;
+  (void)SDMMC_ConfigData(hmmc->Instance, &config);
+
+  errorstate = SDMMC_CmdSendEXTCSD(hmmc->Instance, 0U);
+  if(errorstate != HAL_MMC_ERROR_NONE)
+  {
+    return errorstate;
+  }
+
+  while(!__HAL_MMC_GET_FLAG(hmmc, SDMMC_FLAG_RXOVERR | SDMMC_FLAG_DCRCFAIL | SDMMC_FLAG_DTIMEOUT | SDMMC_FLAG_DATAEND))
+  {
+    if(__HAL_MMC_GET_FLAG(hmmc, SDMMC_FLAG_RXFIFOHF) && (i < 128U))
+    {
+      for(count = 0U; count < 8U; count++)
+      {
+        hmmc->Ext_CSD[i + count] = SDMMC_ReadFIFO(hmmc->Instance);
+      }
+      i += 8U;
+    }
+    if((HAL_GetTick() - tickstart) >= MMC_SWITCH_TIMEOUT)
+    {
+      return HAL_MMC_ERROR_TIMEOUT;
+    }
+  }
+
+  if(__HAL_MMC_GET_FLAG(hmmc, SDMMC_FLAG_DTIMEOUT))
+  {
+    return HAL_MMC_ERROR_DATA_TIMEOUT;
+  }
+  if(__HAL_MMC_GET_FLAG(hmmc, SDMMC_FLAG_DCRCFAIL))
+  {
+    return HAL_MMC_ERROR_DATA_CRC_FAIL;
+  }
+  if(__HAL_MMC_GET_FLAG(hmmc, SDMMC_FLAG_RXOVERR))
+  {
+    return HAL_MMC_ERROR_RX_OVERRUN;
+  }
+
+  /* Words left in the FIFO */
+  while((i < 128U) && !__HAL_MMC_GET_FLAG(hmmc, SDMMC_FLAG_RXFIFOE))
+  {
+    hmmc->Ext_CSD[i] = SDMMC_ReadFIFO(hmmc->Instance);
+    i++;
+  }
+
+  __HAL_MMC_CLEAR_FLAG(hmmc, SDMMC_STATIC_DATA_FLAGS);
+  return HAL_MMC_ERROR_NONE;
+}
+
+/**
+  * @brief  Writes a byte of the EXT_CSD register with CMD6 and waits for the
+  *         end of the switch.
+  * @param  hmmc: MMC handle
+  * @param  Index: EXT_CSD byte index
+  * @param  Value: new value
+  * @retval error state
+  */
+static uint32_t MMCEx_Switch(MMC_HandleTypeDef *hmmc, uint32_t Index, uint32_t Value)
+{
+  uint32_t errorstate;
+
+  errorstate = SDMMC_CmdSwitch(hmmc->Instance, MMC_SWITCH_WRITE_BYTE | (Index << 16U) | (Value << 8U));
+  if(errorstate == HAL_MMC_ERROR_NONE)
+  {
+    errorstate = MMCEx_WaitSwitch(hmmc);
+  }
+  return errorstate;
+}
+
+/**
+  * @brief  Polls the card status until the card is back in transfer state
+  *         after a switch, and checks the switch result.
+  * @param  hmmc: MMC handle
+  * @retval error state
+  */
+static uint32_t MMCEx_WaitSwitch(MMC_HandleTypeDef *hmmc)
+{
+  uint32_t tickstart = HAL_GetTick();
+  uint32_t errorstate;
+  uint32_t response;
+
+  for(;;)
+  {
+    errorstate = SDMMC_CmdSendStatus(hmmc->Instance, (uint32_t)(((uint32_t)hmmc->MmcCard.RelCardAdd) << 16U));
+    if(errorstate == HAL_MMC_ERROR_NONE)
+    {
+      response = SDMMC_GetResponse(hmmc->Instance, SDMMC_RESP1);
+      if((response & MMC_STATUS_SWITCH_ERROR) != 0U)
+      {
+        return HAL_MMC_ERROR_UNSUPPORTED_FEATURE;
+      }
+      if(((response & MMC_STATUS_READY_FOR_DATA) != 0U) &&
+         (((response >> 9U) & 0x0FU) == (uint32_t)HAL_MMC_CARD_TRANSFER))
+      {
+        return HAL_MMC_ERROR_NONE;
+      }
+    }
+    if((HAL_GetTick() - tickstart) >= MMC_SWITCH_TIMEOUT)
+    {
+      return (errorstate != HAL_MMC_ERROR_NONE) ? errorstate : HAL_MMC_ERROR_TIMEOUT;
+    }
+  }
+}
+
+/**
+  * @brief  Sets the bus clock, at most Frequency, and its sampling.
+  * @param  hmmc: MMC handle
+  * @param  Frequency: highest bus clock, in Hz
+  * @param  Ddr: 1 for dual data rate
+  * @param  Feedback: 1 to sample with the feedback clock through the
+  *         DELAYBLOCK, for HS200
+  * @retval None
+  */
+static void MMCEx_SetBusClock(MMC_HandleTypeDef *hmmc, uint32_t Frequency, uint32_t Ddr, uint32_t Feedback)
+{
+  uint32_t kernel = MMCEx_GetKernelClock();
+  uint32_t clkcr = 0U;
+  uint32_t div = 0U;
+
+  /* SDMMC_CK = kernel clock / (2 x CLKDIV), the kernel clock itself with
+     CLKDIV 0, which is not allowed in DDR mode */
+  if((kernel > Frequency) || (Ddr != 0U))
+  {
+    div = (kernel + (2U * Frequency) - 1U) / (2U * Frequency);
+    if(div == 0U)
+    {
+      div = 1U;
+    }
+    if(div > SDMMC_CLKCR_CLKDIV)
+    {
+      div = SDMMC_CLKCR_CLKDIV;
+    }
+  }
+
+  if(Ddr != 0U)
+  {
+    clkcr |= SDMMC_CLKCR_DDR;
+  }
+  if(Feedback != 0U)
+  {
+    clkcr |= SDMMC_CLKCR_BUSSPEED | SDMMC_CLKCR_SELCLKRX_1;
+  }
+  MODIFY_REG(hmmc->Instance->CLKCR, SDMMC_CLKCR_CLKDIV | SDMMC_CLKCR_DDR | SDMMC_CLKCR_BUSSPEED | SDMMC_CLKCR_SELCLKRX,
+             div | clkcr);
+}
+
+/**
+  * @brief  Returns the SDMMC kernel clock.
+  * @retval Frequency in Hz
+  */
+static uint32_t MMCEx_GetKernelClock(void)
+{
+  PLL1_ClocksTypeDef pll1_clocks;
+  PLL2_ClocksTypeDef pll2_clocks;
+
+  if(__HAL_RCC_GET_SDMMC_SOURCE() == RCC_SDMMCCLKSOURCE_PLL)
+  {
+    HAL_RCCEx_GetPLL1ClockFreq(&pll1_clocks);
+    return pll1_clocks.PLL1_Q_Frequency;
+  }
+  HAL_RCCEx_GetPLL2ClockFreq(&pll2_clocks);
+  return pll2_clocks.PLL2_R_Frequency;
+}
+
+/**
+  * @brief  Returns the bus width set in the SDMMC, as the BUS_WIDTH field
+  *         of the EXT_CSD codes it in SDR mode.
+  * @param  hmmc: MMC handle
+  * @retval 0: 1-bit, 1: 4-bit, 2: 8-bit
+  */
+static uint32_t MMCEx_GetBusWidth(MMC_HandleTypeDef *hmmc)
+{
+  uint32_t widbus = hmmc->Instance->CLKCR & SDMMC_CLKCR_WIDBUS;
+
+  if(widbus == SDMMC_BUS_WIDE_8B)
+  {
+    return 2U;
+  }
+  return (widbus == SDMMC_BUS_WIDE_4B) ? 1U : 0U;
+}
+
+/**
+  * @brief  Reads the HS200 tuning block with CMD21, by polling.
+  * @param  hmmc: MMC handle
+  * @param  pBuffer: destination
+  * @param  Size: 64 bytes on a 4-bit bus, 128 bytes on an 8-bit bus
+  * @retval error state
+  */
+static uint32_t MMCEx_ReadTuningBlock(MMC_HandleTypeDef *hmmc, uint32_t *pBuffer, uint32_t Size)
+{
+  SDMMC_DataInitTypeDef config;
+  uint32_t errorstate;
+  uint32_t tickstart = HAL_GetTick();
+  uint32_t count;
+  uint32_t i = 0U;
+
+  hmmc->Instance->DCTRL = 0U;
+  __HAL_MMC_CLEAR_FLAG(hmmc, SDMMC_STATIC_FLAGS);
+
+  config.DataTimeOut   = SDMMC_DATATIMEOUT;
+  config.DataLength    = Size;
+  config.DataBlockSize = (Size == 128U) ? SDMMC_DATABLOCK_SIZE_128B : SDMMC_DATABLOCK_SIZE_64B;
+  config.TransferDir   = SDMMC_TRANSFER_DIR_TO_SDMMC;
+  config.TransferMode  = SDMMC_TRANSFER_MODE_BLOCK;
+  config.DPSM          = SDMMC_DPSM_ENABLE;
+  (void)SDMMC_ConfigData(hmmc->Instance, &config);
+
+  errorstate = SDMMC_CmdSendTuningBlock(hmmc->Instance);
+  if(errorstate != HAL_MMC_ERROR_NONE)
+  {
+    return errorstate;
+  }
+
+  while(!__HAL_MMC_GET_FLAG(hmmc, SDMMC_FLAG_RXOVERR | SDMMC_FLAG_DCRCFAIL | SDMMC_FLAG_DTIMEOUT | SDMMC_FLAG_DATAEND))
+  {
+    if(__HAL_MMC_GET_FLAG(hmmc, SDMMC_FLAG_RXFIFOHF) && ((i + 8U) <= (Size / 4U)))
+    {
+      for(count = 0U; count < 8U; count++)
+      {
+        pBuffer[i + count] = SDMMC_ReadFIFO(hmmc->Instance);
+      }
+      i += 8U;
+    }
+    if((HAL_GetTick() - tickstart) >= MMC_TUNING_TIMEOUT)
+    {
+      /* No start bit at this phase: the data path is reset */
+      hmmc->Instance->DCTRL |= SDMMC_DCTRL_FIFORST;
+      return HAL_MMC_ERROR_TIMEOUT;
+    }
+  }
+
+  if(__HAL_MMC_GET_FLAG(hmmc, SDMMC_FLAG_RXOVERR | SDMMC_FLAG_DCRCFAIL | SDMMC_FLAG_DTIMEOUT))
+  {
+    hmmc->Instance->DCTRL |= SDMMC_DCTRL_FIFORST;
+    return HAL_MMC_ERROR_DATA_CRC_FAIL;
+  }
+
+  while((i < (Size / 4U)) && !__HAL_MMC_GET_FLAG(hmmc, SDMMC_FLAG_RXFIFOE))
+  {
+    pBuffer[i] = SDMMC_ReadFIFO(hmmc->Instance);
+    i++;
+  }
+  return (i == (Size / 4U)) ? HAL_MMC_ERROR_NONE : HAL_MMC_ERROR_DATA_CRC_FAIL;
+}
+
+/**
+  * @brief  Starts a write by the internal DMA with its block count given
+  *         by CMD23: no stop command is sent at the end.
+  * @param  hmmc: MMC handle, in ready state
+  * @param  pData: data, NumberOfBlocks blocks
+  * @param  Address: CMD25 argument
+  * @param  NumberOfBlocks: blocks transferred
+  * @param  BlockCountArg: CMD23 argument, block count and flags
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef MMCEx_StartClosedWrite(MMC_HandleTypeDef *hmmc, uint8_t *pData, uint32_t Address,
+                                                uint32_t NumberOfBlocks, uint32_t BlockCountArg)
+{
+  SDMMC_DataInitTypeDef config;
+  uint32_t errorstate = HAL_MMC_ERROR_NONE;
+
+  hmmc->State = HAL_MMC_STATE_BUSY;
+
+  /* Initialize data control register */
+  hmmc->Instance->DCTRL = 0U;
+
+  hmmc->pTxBuffPtr = pData;
+  hmmc->TxXferSize = BLOCKSIZE * NumberOfBlocks;
+
+  /* In DDR mode the block length is fixed to 512 bytes and CMD16 is illegal */
+  if((hmmc->Instance->CLKCR & SDMMC_CLKCR_DDR) == 0U)
+  {
+    errorstate = SDMMC_CmdBlockLength(hmmc->Instance, BLOCKSIZE);
+  }
+
+  /* Sent before CMDTRANS is set, it is not a data transfer command */
+  if(errorstate == HAL_MMC_ERROR_NONE)
+  {
+    errorstate = SDMMC_CmdSetBlockCount(hmmc->Instance, BlockCountArg);
+  }
+  if(errorstate != HAL_MMC_ERROR_NONE)
+  {
+    __HAL_MMC_CLEAR_FLAG(hmmc, SDMMC_STATIC_FLAGS);
+    hmmc->ErrorCode |= errorstate;
+    hmmc->State = HAL_MMC_STATE_READY;
+    return HAL_ERROR;
+  }
+
+  /* Configure the MMC DPSM (Data Path State Machine) */
+  config.DataTimeOut   = SDMMC_DATATIMEOUT;
+  config.DataLength    = BLOCKSIZE * NumberOfBlocks;
+  config.DataBlockSize = SDMMC_DATABLOCK_SIZE_512B;
+  config.TransferDir   = SDMMC_TRANSFER_DIR_TO_CARD;
+  config.TransferMode  = SDMMC_TRANSFER_MODE_BLOCK;
+  config.DPSM          = SDMMC_DPSM_DISABLE;
+  (void)SDMMC_ConfigData(hmmc->Instance, &config);
+
+  __HAL_MMC_ENABLE_IT(hmmc, (SDMMC_IT_DCRCFAIL | SDMMC_IT_DTIMEOUT | SDMMC_IT_TXUNDERR | SDMMC_IT_DATAEND));
+
+  __SDMMC_CMDTRANS_ENABLE( hmmc->Instance);
+
+  hmmc->Instance->IDMACTRL  = SDMMC_ENABLE_IDMA_SINGLE_BUFF;
+  hmmc->Instance->IDMABASE0 = (uint32_t) pData;
+
+  hmmc->Context = (MMC_CONTEXT_WRITE_MULTIPLE_BLOCK | MMC_CONTEXT_DMA | MMC_CONTEXT_CLOSED);
+
+  errorstate = SDMMC_CmdWriteMultiBlock(hmmc->Instance, Address);
+  if(errorstate != HAL_MMC_ERROR_NONE)
+  {
+    __HAL_MMC_CLEAR_FLAG(hmmc, SDMMC_STATIC_FLAGS);
+    __HAL_MMC_DISABLE_IT(hmmc, (SDMMC_IT_DCRCFAIL | SDMMC_IT_DTIMEOUT | SDMMC_IT_TXUNDERR | SDMMC_IT_DATAEND));
+    hmmc->ErrorCode |= errorstate;
+    hmmc->State = HAL_MMC_STATE_READY;
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
 /**
   * @}
   */
@@ -734,6 +734,7 @@ HAL_StatusTypeDef HAL_NAND_Write_Page_8b(NAND_HandleTypeDef *hnand, NAND_Address
 {
   __IO uint32_t index = 0;
   uint32_t tickstart = 0;
+  uint32_t nandStatus = 0;
   uint32_t deviceAddress = 0, size = 0, numPagesWritten = 0, nandAddress = 0;
   
   /* Process Locked */
@@ -827,13 +828,24 @@ HAL_StatusTypeDef HAL_NAND_Write_Page_8b(NAND_HandleTypeDef *hnand, NAND_Address
    
     *(__IO uint8_t *)((uint32_t)(deviceAddress | CMD_AREA)) = NAND_CMD_WRITE_TRUE1;
     __DSB();
-    
-    /* Read status until NAND is ready */
-    while(HAL_NAND_Read_Status(hnand) != NAND_READY)
+
+    /* Get tick */
+    tickstart = HAL_GetTick();
+
+    /* Read status until NAND is ready, a program failure ends the transfer */
+    while((nandStatus = HAL_NAND_Read_Status(hnand)) != NAND_READY)
     {
-      /* Get tick */
-      tickstart = HAL_GetTick();
-    
+      if(nandStatus == NAND_ERROR)
+      {
+        /* Update the NAND controller state */
+        hnand->State = HAL_NAND_STATE_READY;
+
+        /* Process unlocked */
+        __HAL_UNLOCK(hnand);
+
+        return HAL_ERROR;
+      }
+
       if((HAL_GetTick() - tickstart ) > NAND_WRITE_TIMEOUT)
       {
         return HAL_TIMEOUT; 
@@ -872,6 +884,7 @@ HAL_StatusTypeDef HAL_NAND_Write_Page_16b(NAND_HandleTypeDef *hnand, NAND_Addres
 {
   __IO uint32_t index = 0;
   uint32_t tickstart = 0;
+  uint32_t nandStatus = 0;
   uint32_t deviceAddress = 0, size = 0, numPagesWritten = 0, nandAddress = 0;
   
   /* Process Locked */
@@ -965,13 +978,24 @@ HAL_StatusTypeDef HAL_NAND_Write_Page_16b(NAND_HandleTypeDef *hnand, NAND_Addres
    
     *(__IO uint8_t *)((uint32_t)(deviceAddress | CMD_AREA)) = NAND_CMD_WRITE_TRUE1;
     __DSB();
-    
-    /* Read status until NAND is ready */
-    while(HAL_NAND_Read_Status(hnand) != NAND_READY)
+
+    /* Get tick */
+    tickstart = HAL_GetTick();
+
+    /* Read status until NAND is ready, a program failure ends the transfer */
+    while((nandStatus = HAL_NAND_Read_Status(hnand)) != NAND_READY)
     {
-      /* Get tick */
-      tickstart = HAL_GetTick();
-    
+      if(nandStatus == NAND_ERROR)
+      {
+        /* Update the NAND controller state */
+        hnand->State = HAL_NAND_STATE_READY;
+
+        /* Process unlocked */
+        __HAL_UNLOCK(hnand);
+
+        return HAL_ERROR;
+      }
+
       if((HAL_GetTick() - tickstart ) > NAND_WRITE_TIMEOUT)
       {
         return HAL_TIMEOUT; 
@@ -1308,6 +1332,7 @@ HAL_StatusTypeDef HAL_NAND_Write_SpareArea_8b(NAND_HandleTypeDef *hnand, NAND_Ad
 {
   __IO uint32_t index = 0;
   uint32_t tickstart = 0;
+  uint32_t nandStatus = 0;
   uint32_t deviceAddress = 0, size = 0, numSpareAreaWritten = 0, nandAddress = 0, columnAddress =0;
 
   /* Process Locked */
@@ -1410,13 +1435,24 @@ HAL_StatusTypeDef HAL_NAND_Write_SpareArea_8b(NAND_HandleTypeDef *hnand, NAND_Ad
    
     *(__IO uint8_t *)((uint32_t)(deviceAddress | CMD_AREA)) = NAND_CMD_WRITE_TRUE1;
     __DSB();
-   
-    /* Read status until NAND is ready */
-    while(HAL_NAND_Read_Status(hnand) != NAND_READY)
+
+    /* Get tick */
+    tickstart = HAL_GetTick();
+
+    /* Read status until NAND is ready, a program failure ends the transfer */
+    while((nandStatus = HAL_NAND_Read_Status(hnand)) != NAND_READY)
     {
-      /* Get tick */
-      tickstart = HAL_GetTick();
-    
+      if(nandStatus == NAND_ERROR)
+      {
+        /* Update the NAND controller state */
+        hnand->State = HAL_NAND_STATE_READY;
+
+        /* Process unlocked */
+        __HAL_UNLOCK(hnand);
+
+        return HAL_ERROR;
+      }
+
       if((HAL_GetTick() - tickstart ) > NAND_WRITE_TIMEOUT)
       {
         return HAL_TIMEOUT; 
@@ -1455,6 +1491,7 @@ HAL_StatusTypeDef HAL_NAND_Write_SpareArea_16b(NAND_HandleTypeDef *hnand, NAND_A
 {
   __IO uint32_t index = 0;
   uint32_t tickstart = 0;
+  uint32_t nandStatus = 0;
   uint32_t deviceAddress = 0, size = 0, numSpareAreaWritten = 0, nandAddress = 0, columnAddress = 0;
 
   /* Process Locked */
@@ -1557,13 +1594,24 @@ HAL_StatusTypeDef HAL_NAND_Write_SpareArea_16b(NAND_HandleTypeDef *hnand, NAND_A
    
     *(__IO uint8_t *)((uint32_t)(deviceAddress | CMD_AREA)) = NAND_CMD_WRITE_TRUE1;
     __DSB();
-   
-    /* Read status until NAND is ready */
-    while(HAL_NAND_Read_Status(hnand) != NAND_READY)
+
+    /* Get tick */
+    tickstart = HAL_GetTick();
+
+    /* Read status until NAND is ready, a program failure ends the transfer */
+    while((nandStatus = HAL_NAND_Read_Status(hnand)) != NAND_READY)
     {
-      /* Get tick */
-      tickstart = HAL_GetTick();
-    
+      if(nandStatus == NAND_ERROR)
+      {
+        /* Update the NAND controller state */
+        hnand->State = HAL_NAND_STATE_READY;
+
+        /* Process unlocked */
+        __HAL_UNLOCK(hnand);
+
+        return HAL_ERROR;
+      }
+
       if((HAL_GetTick() - tickstart ) > NAND_WRITE_TIMEOUT)
       {
         return HAL_TIMEOUT; 
@@ -107,6 +107,34 @@
         You can choose either one block read operation or multiple block read operation
         by adjusting the "NumberOfBlocks" parameter.
 
+  *** SD Card DMA bounce buffers ***
+  ===================================
+  [..]
+    (+) The internal DMA of SDMMC1 only reaches the AXI SRAM, the flash, the
+        QUADSPI and the FMC, the one of SDMMC2 everything but the DTCM and ITCM.
+        With USE_HAL_DMA_BOUNCE_BUFFER set to 1 in stm32h7xx_hal_conf.h,
+        HAL_SD_ReadBlocks_DMA() and HAL_SD_WriteBlocks_DMA() stage other buffers
+        through a bounce buffer given by HAL_DMA_BounceAllocCallback(), copied
+        back before HAL_SD_RxCpltCallback(). They return HAL_ERROR with
+        HAL_SD_ERROR_DMA when no bounce buffer is available.
+    (+) With USE_HAL_DMA_CHECK set to 1, they report the buffer violations
+        found by HAL_DMA_CheckBuffer() through HAL_DMA_CheckReport().
+
+  *** SD Card programming wait ***
+  ================================
+  [..]
+    (+) After a write, instead of polling HAL_SD_GetCardState() until the card
+        leaves the programming state, call HAL_SD_WaitCardReady_IT(). The
+        HAL_SD_CardReadyCallback() is called once the card is back in transfer
+        state (possibly before HAL_SD_WaitCardReady_IT() returns), with
+        HAL_SD_GetError() reporting a status command failure.
+        On this device the end of busy is signalled by the SDMMC BUSYD0END
+        interrupt after a busy response (R1b), such as the stop command sent at the
+        end of a write. HAL_SD_PollCardReady() can still be called from a timer to
+        cover writes ending without a busy response.
+    (+) The handle is in HAL_SD_STATE_PROGRAMMING during the wait, and the
+        read/write/erase functions return HAL_BUSY.
+
   *** SD card status ***
   ======================
   [..]
@@ -198,6 +226,10 @@ static void     SD_PowerOFF(SD_HandleTypeDef *hsd);
 static void     SD_Write_IT(SD_HandleTypeDef *hsd);
 static void     SD_Read_IT(SD_HandleTypeDef *hsd);
 static uint32_t SD_HighSpeed(SD_HandleTypeDef *hsd);
+#if (USE_HAL_DMA_BOUNCE_BUFFER == 1U)
+static HAL_StatusTypeDef SD_BounceStart(SD_HandleTypeDef *hsd, uint8_t *pData, uint32_t Size, uint32_t CopyIn);
+static void     SD_BounceEnd(SD_HandleTypeDef *hsd, uint32_t CopyOut);
+#endif /* USE_HAL_DMA_BOUNCE_BUFFER */
 #if (USE_SD_TRANSCEIVER != 0U)
 static uint32_t SD_UltraHighSpeed(SD_HandleTypeDef *hsd);
 #endif /* USE_SD_TRANSCEIVER */
@@ -259,6 +291,11 @@ HAL_StatusTypeDef HAL_SD_Init(SD_HandleTypeDef *hsd)
     HAL_SD_MspInit(hsd);
   }
 
+#if (USE_HAL_DMA_BOUNCE_BUFFER == 1U)
+  /* No bounce buffer in use */
+  hsd->BounceBuffer = NULL;
+#endif /* USE_HAL_DMA_BOUNCE_BUFFER */
+
   hsd->State = HAL_SD_STATE_BUSY;
 
   /* Initialize the Card parameters */
@@ -1138,6 +1175,16 @@ HAL_StatusTypeDef HAL_SD_ReadBlocks_DMA(SD_HandleTypeDef *hsd, uint8_t *pData, u
       return HAL_ERROR;
     }
 
+#if (USE_HAL_DMA_BOUNCE_BUFFER == 1U)
+    /* Stage a buffer the internal DMA cannot reach */
+    if(SD_BounceStart(hsd, pData, BLOCKSIZE * NumberOfBlocks, 0U) != HAL_OK)
+    {
+      hsd->ErrorCode |= HAL_SD_ERROR_DMA;
+      hsd->State = HAL_SD_STATE_READY;
+      return HAL_ERROR;
+    }
+#endif /* USE_HAL_DMA_BOUNCE_BUFFER */
+
     /* Configure the SD DPSM (Data Path State Machine) */
     config.DataTimeOut   = SDMMC_DATATIMEOUT;
     config.DataLength    = BLOCKSIZE * NumberOfBlocks;
@@ -1150,9 +1197,20 @@ HAL_StatusTypeDef HAL_SD_ReadBlocks_DMA(SD_HandleTypeDef *hsd, uint8_t *pData, u
     /* Enable transfer interrupts */
     __HAL_SD_ENABLE_IT(hsd, (SDMMC_IT_DCRCFAIL | SDMMC_IT_DTIMEOUT | SDMMC_IT_RXOVERR | SDMMC_IT_DATAEND));
 
+#if (USE_HAL_DMA_CHECK == 1U)
+    /* Check the buffer, debug builds */
+    HAL_DMA_CheckReport((uint32_t)hsd->Instance, (uint32_t)pData,
+                        HAL_DMA_CheckBuffer((uint32_t)hsd->Instance, (uint32_t)pData, BLOCKSIZE * NumberOfBlocks, 4U, 1U),
+                        __HAL_DMA_CALLER_ADDRESS());
+#endif /* USE_HAL_DMA_CHECK */
+
     __SDMMC_CMDTRANS_ENABLE( hsd->Instance);
     hsd->Instance->IDMACTRL  = SDMMC_ENABLE_IDMA_SINGLE_BUFF;
+#if (USE_HAL_DMA_BOUNCE_BUFFER == 1U)
+    hsd->Instance->IDMABASE0 = (hsd->BounceBuffer != NULL) ? (uint32_t)hsd->BounceBuffer : (uint32_t) pData ;
+#else
     hsd->Instance->IDMABASE0 = (uint32_t) pData ;
+#endif /* USE_HAL_DMA_BOUNCE_BUFFER */
 
     /* Read Blocks in DMA mode */
     if(NumberOfBlocks > 1U)
@@ -1174,6 +1232,9 @@ HAL_StatusTypeDef HAL_SD_ReadBlocks_DMA(SD_HandleTypeDef *hsd, uint8_t *pData, u
       /* Clear all the static flags */
       __HAL_SD_CLEAR_FLAG(hsd, SDMMC_STATIC_FLAGS);
       __HAL_SD_DISABLE_IT(hsd, (SDMMC_IT_DCRCFAIL | SDMMC_IT_DTIMEOUT | SDMMC_IT_RXOVERR | SDMMC_IT_DATAEND));
+#if (USE_HAL_DMA_BOUNCE_BUFFER == 1U)
+      SD_BounceEnd(hsd, 0U);
+#endif /* USE_HAL_DMA_BOUNCE_BUFFER */
       hsd->ErrorCode |= errorstate;
       hsd->State = HAL_SD_STATE_READY;
       return HAL_ERROR;
@@ -1245,6 +1306,16 @@ HAL_StatusTypeDef HAL_SD_WriteBlocks_DMA(SD_HandleTypeDef *hsd, uint8_t *pData,
       hsd->State = HAL_SD_STATE_READY;
       return HAL_ERROR;
     }
+
+#if (USE_HAL_DMA_BOUNCE_BUFFER == 1U)
+    /* Stage a buffer the internal DMA cannot reach */
+    if(SD_BounceStart(hsd, pData, BLOCKSIZE * NumberOfBlocks, 1U) != HAL_OK)
+    {
+      hsd->ErrorCode |= HAL_SD_ERROR_DMA;
+      hsd->State = HAL_SD_STATE_READY;
+      return HAL_ERROR;
+    }
+#endif /* USE_HAL_DMA_BOUNCE_BUFFER */
     /* Configure the SD DPSM (Data Path State Machine) */
     config.DataTimeOut   = SDMMC_DATATIMEOUT;
     config.DataLength    = BLOCKSIZE * NumberOfBlocks;
@@ -1257,10 +1328,21 @@ HAL_StatusTypeDef HAL_SD_WriteBlocks_DMA(SD_HandleTypeDef *hsd, uint8_t *pData,
     /* Enable transfer interrupts */
     __HAL_SD_ENABLE_IT(hsd, (SDMMC_IT_DCRCFAIL | SDMMC_IT_DTIMEOUT | SDMMC_IT_TXUNDERR | SDMMC_IT_DATAEND));
 
+#if (USE_HAL_DMA_CHECK == 1U)
+    /* Check the buffer, debug builds */
+    HAL_DMA_CheckReport((uint32_t)hsd->Instance, (uint32_t)pData,
+                        HAL_DMA_CheckBuffer((uint32_t)hsd->Instance, (uint32_t)pData, BLOCKSIZE * NumberOfBlocks, 4U, 0U),
+                        __HAL_DMA_CALLER_ADDRESS());
+#endif /* USE_HAL_DMA_CHECK */
+
     __SDMMC_CMDTRANS_ENABLE( hsd->Instance);
 
     hsd->Instance->IDMACTRL  = SDMMC_ENABLE_IDMA_SINGLE_BUFF;
+#if (USE_HAL_DMA_BOUNCE_BUFFER == 1U)
+    hsd->Instance->IDMABASE0 = (hsd->BounceBuffer != NULL) ? (uint32_t)hsd->BounceBuffer : (uint32_t) pData ;
+#else
     hsd->Instance->IDMABASE0 = (uint32_t) pData ;
+#endif /* USE_HAL_DMA_BOUNCE_BUFFER */
 
     /* Write Blocks in Polling mode */
     if(NumberOfBlocks > 1U)
@@ -1282,6 +1364,9 @@ HAL_StatusTypeDef HAL_SD_WriteBlocks_DMA(SD_HandleTypeDef *hsd, uint8_t *pData,
       /* Clear all the static flags */
       __HAL_SD_CLEAR_FLAG(hsd, SDMMC_STATIC_FLAGS);
       __HAL_SD_DISABLE_IT(hsd, (SDMMC_IT_DCRCFAIL | SDMMC_IT_DTIMEOUT | SDMMC_IT_TXUNDERR | SDMMC_IT_DATAEND));
+#if (USE_HAL_DMA_BOUNCE_BUFFER == 1U)
+      SD_BounceEnd(hsd, 0U);
+#endif /* USE_HAL_DMA_BOUNCE_BUFFER */
       hsd->ErrorCode |= errorstate;
       hsd->State = HAL_SD_STATE_READY;
       return HAL_ERROR;
@@ -1401,6 +1486,86 @@ HAL_StatusTypeDef HAL_SD_Erase(SD_HandleTypeDef *hsd, uint32_t BlockStartAdd, ui
   }
 }
 
+/**
+  * @brief  Waits for the card to leave the programming state without blocking.
+  *         HAL_SD_CardReadyCallback() is called once the card is back in
+  *         transfer state.
+  * @note   The end of programming is detected by the SDMMC busy end interrupt,
+  *         or by HAL_SD_PollCardReady() if the last command had no busy response.
+  * @note   Call it after the completion of a write or erase operation.
+  * @param  hsd: Pointer to SD handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SD_WaitCardReady_IT(SD_HandleTypeDef *hsd)
+{
+  if(hsd->State != HAL_SD_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+  
+  hsd->ErrorCode = HAL_SD_ERROR_NONE;
+  hsd->Context = SD_CONTEXT_WAIT_READY;
+  hsd->State = HAL_SD_STATE_PROGRAMMING;
+
+  /* Busy end is signalled after the busy response of the last command */
+  __HAL_SD_ENABLE_IT(hsd, SDMMC_IT_BUSYD0END);
+  if(__HAL_SD_GET_FLAG(hsd, SDMMC_FLAG_BUSYD0) != RESET)
+  {
+    return HAL_OK;
+  }
+
+  (void)HAL_SD_PollCardReady(hsd);
+  
+  return HAL_OK;
+}
+
+/**
+  * @brief  Checks with one status command whether the card waited for by 
+  *         HAL_SD_WaitCardReady_IT() has left the programming state, and calls
+  *         HAL_SD_CardReadyCallback() if so.
+  * @param  hsd: Pointer to SD handle
+  * @retval HAL status, HAL_BUSY while the card is programming
+  */
+HAL_StatusTypeDef HAL_SD_PollCardReady(SD_HandleTypeDef *hsd)
+{
+  uint32_t cardstate = 0U;
+  uint32_t errorstate;
+  
+  if((hsd->State != HAL_SD_STATE_PROGRAMMING) || (hsd->Context != SD_CONTEXT_WAIT_READY))
+  {
+    return HAL_OK;
+  }
+
+  /* The busy end interrupt cannot complete the wait while the status is read */
+  __HAL_SD_DISABLE_IT(hsd, SDMMC_IT_BUSYD0END);
+  if((hsd->State != HAL_SD_STATE_PROGRAMMING) || (hsd->Context != SD_CONTEXT_WAIT_READY))
+  {
+    return HAL_OK;
+  }
+
+  errorstate = SD_SendStatus(hsd, &cardstate);
+  if(errorstate != HAL_SD_ERROR_NONE)
+  {
+    hsd->ErrorCode |= errorstate;
+  }
+  else
+  {
+    cardstate = ((cardstate >> 9U) & 0x0FU);
+    if((cardstate == HAL_SD_CARD_PROGRAMMING) || (cardstate == HAL_SD_CARD_RECEIVING))
+    {
+      __HAL_SD_ENABLE_IT(hsd, SDMMC_IT_BUSYD0END);
+      return HAL_BUSY;
+    }
+  }
+  
+  hsd->Context = SD_CONTEXT_NONE;
+  hsd->State = HAL_SD_STATE_READY;
+  
+  HAL_SD_CardReadyCallback(hsd);
+  
+  return HAL_OK;
+}
+
 /**
   * @brief  This function handles SD card interrupt request.
   * @param  hsd: Pointer to SD handle
@@ -1454,6 +1619,12 @@ void HAL_SD_IRQHandler(SD_HandleTypeDef *hsd)
       hsd->Instance->DCTRL = 0;
       hsd->Instance->IDMACTRL = SDMMC_DISABLE_IDMA;
 
+#if (USE_HAL_DMA_BOUNCE_BUFFER == 1U)
+      /* Copy a staged read back and give back the bounce buffer */
+      SD_BounceEnd(hsd, (((context & SD_CONTEXT_READ_SINGLE_BLOCK) != 0U) ||
+                         ((context & SD_CONTEXT_READ_MULTIPLE_BLOCK) != 0U)) ? 1U : 0U);
+#endif /* USE_HAL_DMA_BOUNCE_BUFFER */
+
       /* Stop Transfer for Write Single/Multi blocks or Read Multi blocks */
       if((context & SD_CONTEXT_READ_SINGLE_BLOCK) == 0U)
       {
@@ -1539,6 +1710,10 @@ void HAL_SD_IRQHandler(SD_HandleTypeDef *hsd)
         __HAL_SD_DISABLE_IT(hsd, SDMMC_IT_IDMABTC);
         hsd->Instance->IDMACTRL = SDMMC_DISABLE_IDMA;
 
+#if (USE_HAL_DMA_BOUNCE_BUFFER == 1U)
+        SD_BounceEnd(hsd, 0U);
+#endif /* USE_HAL_DMA_BOUNCE_BUFFER */
+
         /* Set the SD state to ready to be able to start again the process */
         hsd->State = HAL_SD_STATE_READY;
         HAL_SD_ErrorCallback(hsd);
@@ -1578,6 +1753,11 @@ void HAL_SD_IRQHandler(SD_HandleTypeDef *hsd)
     }
     __HAL_SD_CLEAR_FLAG(hsd, SDMMC_FLAG_IDMABTC);
   }
+  else if((__HAL_SD_GET_FLAG(hsd, SDMMC_FLAG_BUSYD0END) != RESET) && (hsd->Context == SD_CONTEXT_WAIT_READY))
+  {
+    __HAL_SD_CLEAR_FLAG(hsd, SDMMC_FLAG_BUSYD0END);
+    (void)HAL_SD_PollCardReady(hsd);
+  }
   else
   {
     /* Nothing to do */
@@ -1665,6 +1845,21 @@ __weak void HAL_SD_AbortCallback(SD_HandleTypeDef *hsd)
    */
 }
 
+/**
+  * @brief Card ready callback, end of the wait started by HAL_SD_WaitCardReady_IT()
+  * @param hsd: Pointer SD handle
+  * @retval None
+  */
+__weak void HAL_SD_CardReadyCallback(SD_HandleTypeDef *hsd)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hsd);
+ 
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_SD_CardReadyCallback can be implemented in the user file
+   */ 
+}
+
 #if (USE_SD_TRANSCEIVER != 0U)
 /**
   * @brief  Enable/Disable the SD Transceiver 1.8V Mode Callback.
@@ -2060,6 +2255,10 @@ HAL_StatusTypeDef HAL_SD_Abort(SD_HandleTypeDef *hsd)
   /* If IDMA Context, disable Internal DMA */
   hsd->Instance->IDMACTRL = SDMMC_DISABLE_IDMA;
 
+#if (USE_HAL_DMA_BOUNCE_BUFFER == 1U)
+  SD_BounceEnd(hsd, 0U);
+#endif /* USE_HAL_DMA_BOUNCE_BUFFER */
+
   hsd->State = HAL_SD_STATE_READY;
 
   /* Initialize the SD operation */
@@ -2094,6 +2293,10 @@ HAL_StatusTypeDef HAL_SD_Abort_IT(SD_HandleTypeDef *hsd)
   /* If IDMA Context, disable Internal DMA */
   hsd->Instance->IDMACTRL = SDMMC_DISABLE_IDMA;
 
+#if (USE_HAL_DMA_BOUNCE_BUFFER == 1U)
+  SD_BounceEnd(hsd, 0U);
+#endif /* USE_HAL_DMA_BOUNCE_BUFFER */
+
   /* Clear All flags */
   __HAL_SD_CLEAR_FLAG(hsd, SDMMC_STATIC_DATA_FLAGS);
 
@@ -2768,6 +2971,61 @@ static void SD_Write_IT(SD_HandleTypeDef *hsd)
   hsd->pTxBuffPtr = tmp;
 }
 
+#if (USE_HAL_DMA_BOUNCE_BUFFER == 1U)
+/**
+  * @brief  Stage a transfer buffer the internal DMA cannot reach.
+  * @param  hsd: pointer to a SD_HandleTypeDef structure that contains
+  *              the configuration information.
+  * @param  pData: buffer given by the application
+  * @param  Size: size of the buffer in bytes
+  * @param  CopyIn: 1 to copy the buffer into its bounce buffer (write)
+  * @retval HAL status, HAL_ERROR when no bounce buffer is available
+  */
+static HAL_StatusTypeDef SD_BounceStart(SD_HandleTypeDef *hsd, uint8_t *pData, uint32_t Size, uint32_t CopyIn)
+{
+  /* Buffer left by a transfer stopped without abort */
+  SD_BounceEnd(hsd, 0U);
+
+  if(HAL_DMA_IsReachable((uint32_t)hsd->Instance, (uint32_t)pData, Size) == 0U)
+  {
+    hsd->BounceBuffer = HAL_DMA_BounceAlloc((uint32_t)hsd->Instance, (uint32_t)pData, Size);
+    if(hsd->BounceBuffer == NULL)
+    {
+      return HAL_ERROR;
+    }
+    hsd->BounceAddress = (uint32_t)pData;
+    hsd->BounceSize = Size;
+
+    if(CopyIn != 0U)
+    {
+      HAL_DMA_BounceCopyIn(hsd->BounceBuffer, hsd->BounceAddress, 0U, Size);
+    }
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Give back the bounce buffer of a transfer.
+  * @param  hsd: pointer to a SD_HandleTypeDef structure that contains
+  *              the configuration information.
+  * @param  CopyOut: 1 to copy the bounce buffer back first (completed read)
+  * @retval None
+  */
+static void SD_BounceEnd(SD_HandleTypeDef *hsd, uint32_t CopyOut)
+{
+  if(hsd->BounceBuffer != NULL)
+  {
+    if(CopyOut != 0U)
+    {
+      HAL_DMA_BounceCopyOut(hsd->BounceBuffer, hsd->BounceAddress, 0U, hsd->BounceSize);
+    }
+    HAL_DMA_BounceFree((uint32_t)hsd->Instance, hsd->BounceBuffer);
+    hsd->BounceBuffer = NULL;
+  }
+}
+#endif /* USE_HAL_DMA_BOUNCE_BUFFER */
+
 uint32_t SD_HighSpeed(SD_HandleTypeDef *hsd)
 {
   uint32_t errorstate = HAL_SD_ERROR_NONE;
@@ -83,6 +83,10 @@
   [..]  
     This section provides functions allowing to configure the multibuffer mode and start read and write 
     multibuffer mode for SD HAL driver.
+    (+) A multibuffer transfer can be ended before its programmed length, on a block
+        boundary, with HAL_SDEx_StopDMAMultiBuffer(). Called from the buffer complete
+        callbacks, this keeps a single read or write multiple block command open for
+        a stream of unknown length.
       
 @endverbatim
   * @{
@@ -272,7 +276,69 @@ HAL_StatusTypeDef HAL_SDEx_WriteBlocksDMAMultiBuffer(SD_HandleTypeDef *hsd, uint
   }  
 }
 
+
+/**
+  * @brief  Ends a multibuffer transfer after a number of blocks, before its programmed
+  *         length: waits for the data path to pass them, then sends the stop
+  *         transmission command, which aborts the block in progress.
+  * @note   Call it from HAL_SDEx_Write_DMADoubleBufferXCpltCallback() or
+  *         HAL_SDEx_Read_DMADoubleBufferXCpltCallback() of the buffer holding the last
+  *         block: the internal DMA has then moved at most a FIFO of the next buffer,
+  *         and the block left partial is discarded by the card. The SDMMC interrupt
+  *         must not be delayed by more than a block time on the bus.
+  * @note   After a write, the card programs the data: wait for it with
+  *         HAL_SD_WaitCardReady_IT() or HAL_SD_GetCardState().
+  * @param  hsd: SD handle
+  * @param  NumberOfBlocks: Blocks transferred since the start of the transfer
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SDEx_StopDMAMultiBuffer(SD_HandleTypeDef *hsd, uint32_t NumberOfBlocks)
+{
+  uint32_t remaining;
+  uint32_t count = 0U;
+  
+  if((hsd->State != HAL_SD_STATE_BUSY) || ((hsd->Context & SD_CONTEXT_DMA) == 0U))
+  {
+    return HAL_ERROR;
+  }
+  
+  if((BLOCKSIZE * NumberOfBlocks) < hsd->Instance->DLEN)
+  {
+    /* Data left in the FIFO for the last blocks */
+    remaining = hsd->Instance->DLEN - (BLOCKSIZE * NumberOfBlocks);
+    while(hsd->Instance->DCOUNT > remaining)
+    {
+      if(count++ == SDMMC_MAX_TRIAL)
+      {
+        break;
+      }
+    }
+  }
+  
+  __HAL_SD_DISABLE_IT(hsd, SDMMC_IT_DATAEND | SDMMC_IT_DCRCFAIL | SDMMC_IT_DTIMEOUT |\
+                           SDMMC_IT_TXUNDERR| SDMMC_IT_RXOVERR | SDMMC_IT_IDMABTC);
+  
+  __SDMMC_CMDTRANS_DISABLE( hsd->Instance);
+  
+  /* Stop transmission command, aborting the data path */
+  hsd->Instance->CMD |= SDMMC_CMD_CMDSTOP;
+  hsd->ErrorCode |= SDMMC_CmdStopTransfer(hsd->Instance);
+  hsd->Instance->CMD &= ~(SDMMC_CMD_CMDSTOP);
+  
+  hsd->Instance->DCTRL |= SDMMC_DCTRL_FIFORST;
+  hsd->Instance->IDMACTRL = SDMMC_DISABLE_IDMA;
+  __HAL_SD_CLEAR_FLAG(hsd, SDMMC_STATIC_DATA_FLAGS);
   
+  hsd->State = HAL_SD_STATE_READY;
+  hsd->Context = SD_CONTEXT_NONE;
+  
+  if(hsd->ErrorCode != HAL_SD_ERROR_NONE)
+  {
+    return HAL_ERROR;
+  }
+  return HAL_OK;
+}
+
 /**
   * @brief  Change the DMA Buffer0 or Buffer1 address on the fly.
   * @param  hsd:           pointer to a SD_HandleTypeDef structure.
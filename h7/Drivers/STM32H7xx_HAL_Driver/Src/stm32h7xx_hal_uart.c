@@ -140,6 +140,13 @@ static void UART_EndRxTransfer(UART_HandleTypeDef *huart);
 static void UART_DMATransmitCplt(DMA_HandleTypeDef *hdma);
 static void UART_DMAReceiveCplt(DMA_HandleTypeDef *hdma);
 static void UART_DMARxHalfCplt(DMA_HandleTypeDef *hdma);
+static void UART_RxToIdleEvent(UART_HandleTypeDef *huart, HAL_UART_RxEventTypeTypeDef EventType);
+static uint32_t UART_TxQueueTryLock(UART_HandleTypeDef *huart);
+static void UART_TxQueuePush(UART_HandleTypeDef *huart, UART_TxDescTypeDef *pDesc);
+static UART_TxDescTypeDef *UART_TxQueueFetch(UART_HandleTypeDef *huart);
+static uint32_t UART_TxQueueNext(UART_HandleTypeDef *huart);
+static void UART_TxQueueKick(UART_HandleTypeDef *huart);
+static void UART_TxQueueAbort(UART_HandleTypeDef *huart);
 static void UART_DMATxHalfCplt(DMA_HandleTypeDef *hdma);
 static void UART_DMAError(DMA_HandleTypeDef *hdma);
 static void UART_DMAAbortOnError(DMA_HandleTypeDef *hdma);
@@ -776,6 +783,7 @@ HAL_StatusTypeDef HAL_UART_Receive(UART_HandleTypeDef *huart, uint8_t *pData, ui
 
     /* At end of Rx process, restore huart->RxState to Ready */
     huart->RxState = HAL_UART_STATE_READY;
+    huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
 
     /* Process Unlocked */
     __HAL_UNLOCK(huart);
@@ -1134,6 +1142,97 @@ HAL_StatusTypeDef HAL_UART_DMAStop(UART_HandleTypeDef *huart)
   return HAL_OK;
 }
 
+/**
+  * @brief Receive data in DMA mode till either the expected number of data
+  *        is received or an IDLE event occurs.
+  * @note   Reception is reported through HAL_UARTEx_RxEventCallback() on IDLE line
+  *         detection, DMA half transfer and DMA transfer complete events, with the
+  *         offset and length of the newly received data in pData: no data is copied
+  *         and HAL_UART_RxCpltCallback()/HAL_UART_RxHalfCpltCallback() are not called.
+  *         HAL_UARTEx_GetRxEventType() returns the event which triggered the callback.
+  * @note   When the Rx DMA channel is configured in DMA_CIRCULAR mode, pData is used
+  *         as a ring buffer and the reception goes on until HAL_UART_DMAStop() or
+  *         HAL_UART_AbortReceive() is called. Data must be consumed before the DMA
+  *         wraps around and overwrites it.
+  * @note   When the UART parity is enabled (PCE = 1), the received data contain
+  *         the parity bit (MSB position).
+  * @param huart UART handle.
+  * @param pData Pointer to data buffer.
+  * @param Size  Amount of data to be received.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size)
+{
+  HAL_StatusTypeDef status;
+
+  /* Check that a Rx process is not already ongoing */
+  if (huart->RxState == HAL_UART_STATE_READY)
+  {
+    if ((pData == NULL) || (Size == 0U) || (huart->hdmarx == NULL))
+    {
+      return HAL_ERROR;
+    }
+
+    /* Clear a pending IDLE flag before the reception starts */
+    __HAL_UART_CLEAR_IDLEFLAG(huart);
+
+    /* Route the DMA events to the Rx Event callback */
+    huart->ReceptionType = HAL_UART_RECEPTION_TOIDLE;
+    huart->RxEventType   = HAL_UART_RXEVENT_TC;
+    huart->RxEventOffset = 0U;
+
+    status = HAL_UART_Receive_DMA(huart, pData, Size);
+    if (status != HAL_OK)
+    {
+      huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+      return status;
+    }
+
+    /* Enable the UART IDLE line detection interrupt */
+    SET_BIT(huart->Instance->CR1, USART_CR1_IDLEIE);
+
+    return HAL_OK;
+  }
+  else
+  {
+    return HAL_BUSY;
+  }
+}
+
+/**
+  * @brief  Queue a list of buffers for transmission in DMA mode.
+  * @note   The segments of the descriptor are sent back-to-back, after the descriptors
+  *         already queued: the next DMA transfer is started from the DMA transfer complete
+  *         interrupt of the previous one, so that the transmission is not interrupted
+  *         between segments. No data is copied.
+  * @note   This function never waits: it may be called concurrently from several tasks
+  *         and from interrupt handlers, the queue is updated by exclusive accesses
+  *         (LDREX/STREX). HAL_UART_TxQueueCpltCallback() is called once all the segments
+  *         of the descriptor have been read by the DMA, the descriptor and its buffers
+  *         may then be reused.
+  * @note   Other transmit functions must not be called while the queue is transmitting.
+  *         On HAL_UART_Abort(), HAL_UART_AbortTransmit(), HAL_UART_DMAStop() and on DMA
+  *         error, the descriptors under transmission are dropped without call of
+  *         HAL_UART_TxQueueCpltCallback().
+  * @param  huart: UART handle.
+  * @param  pDesc: Pointer to the transmit descriptor.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UART_TxQueue_DMA(UART_HandleTypeDef *huart, UART_TxDescTypeDef *pDesc)
+{
+  if((pDesc == NULL) || (pDesc->pSegments == NULL) || (huart->hdmatx == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  UART_TxQueuePush(huart, pDesc);
+
+  /* Start the transmission if the transmitter is free */
+  UART_TxQueueKick(huart);
+
+  return HAL_OK;
+}
+
 /**
   * @brief  Abort ongoing transfers (blocking mode).
   * @param  huart UART handle.
@@ -1149,7 +1248,7 @@ HAL_StatusTypeDef HAL_UART_DMAStop(UART_HandleTypeDef *huart)
 HAL_StatusTypeDef HAL_UART_Abort(UART_HandleTypeDef *huart)
 {
   /* Disable TXE, TC, RXNE, PE, RXFT, TXFT and ERR (Frame error, noise error, overrun error) interrupts */
-  CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_PEIE | USART_CR1_TXEIE | USART_CR1_TCIE));
+  CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_IDLEIE | USART_CR1_PEIE | USART_CR1_TXEIE | USART_CR1_TCIE));
   CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE | USART_CR3_RXFTIE | USART_CR3_TXFTIE);
 
   /* Disable the UART DMA Tx request if enabled */
@@ -1193,7 +1292,9 @@ HAL_StatusTypeDef HAL_UART_Abort(UART_HandleTypeDef *huart)
 
   /* Restore huart->gState and huart->RxState to Ready */
   huart->gState  = HAL_UART_STATE_READY;
+  UART_TxQueueAbort(huart);
   huart->RxState = HAL_UART_STATE_READY;
+  huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
 
   /* Reset Handle ErrorCode to No Error */
   huart->ErrorCode = HAL_UART_ERROR_NONE;
@@ -1240,6 +1341,7 @@ HAL_StatusTypeDef HAL_UART_AbortTransmit(UART_HandleTypeDef *huart)
 
   /* Restore huart->gState to Ready */
   huart->gState = HAL_UART_STATE_READY;
+  UART_TxQueueAbort(huart);
 
   return HAL_OK;
 }
@@ -1259,7 +1361,7 @@ HAL_StatusTypeDef HAL_UART_AbortTransmit(UART_HandleTypeDef *huart)
 HAL_StatusTypeDef HAL_UART_AbortReceive(UART_HandleTypeDef *huart)
 {
   /* Disable PEIE, EIE, RXNEIE and RXFTIE interrupt */
-  CLEAR_BIT(huart->Instance->CR1, USART_CR1_PEIE | USART_CR1_RXNEIE);
+  CLEAR_BIT(huart->Instance->CR1, USART_CR1_PEIE | USART_CR1_RXNEIE | USART_CR1_IDLEIE);
   CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE | USART_CR3_RXFTIE);
 
   /* Disable the UART DMA Rx request if enabled */
@@ -1286,6 +1388,7 @@ HAL_StatusTypeDef HAL_UART_AbortReceive(UART_HandleTypeDef *huart)
 
   /* Restore huart->RxState to Ready */
   huart->RxState = HAL_UART_STATE_READY;
+  huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
 
   return HAL_OK;
 }
@@ -1309,7 +1412,7 @@ HAL_StatusTypeDef HAL_UART_Abort_IT(UART_HandleTypeDef *huart)
   uint32_t abortcplt = 1U;
 
   /* Disable interrupts */
-  CLEAR_BIT(huart->Instance->CR1, USART_CR1_PEIE | USART_CR1_TCIE | USART_CR1_RXNEIE);
+  CLEAR_BIT(huart->Instance->CR1, USART_CR1_PEIE | USART_CR1_TCIE | USART_CR1_RXNEIE | USART_CR1_IDLEIE);
   CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE | USART_CR3_RXFTIE | USART_CR3_TXFTIE);
 
   /* If DMA Tx and/or DMA Rx Handles are associated to UART Handle, DMA Abort complete callbacks should be initialised
@@ -1406,7 +1509,9 @@ HAL_StatusTypeDef HAL_UART_Abort_IT(UART_HandleTypeDef *huart)
 
     /* Restore huart->gState and huart->RxState to Ready */
     huart->gState  = HAL_UART_STATE_READY;
+    UART_TxQueueAbort(huart);
     huart->RxState = HAL_UART_STATE_READY;
+    huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
 
     /* As no DMA to be aborted, call directly user Abort complete callback */
     HAL_UART_AbortCpltCallback(huart);
@@ -1461,6 +1566,7 @@ HAL_StatusTypeDef HAL_UART_AbortTransmit_IT(UART_HandleTypeDef *huart)
 
       /* Restore huart->gState to Ready */
       huart->gState = HAL_UART_STATE_READY;
+      UART_TxQueueAbort(huart);
 
       /* As no DMA to be aborted, call directly user Abort complete callback */
       HAL_UART_AbortTransmitCpltCallback(huart);
@@ -1473,6 +1579,7 @@ HAL_StatusTypeDef HAL_UART_AbortTransmit_IT(UART_HandleTypeDef *huart)
 
     /* Restore huart->gState to Ready */
     huart->gState = HAL_UART_STATE_READY;
+    UART_TxQueueAbort(huart);
 
     /* As no DMA to be aborted, call directly user Abort complete callback */
     HAL_UART_AbortTransmitCpltCallback(huart);
@@ -1498,7 +1605,7 @@ HAL_StatusTypeDef HAL_UART_AbortTransmit_IT(UART_HandleTypeDef *huart)
 HAL_StatusTypeDef HAL_UART_AbortReceive_IT(UART_HandleTypeDef *huart)
 {
   /* Disable ERR (Frame error, noise error, overrun error) interrupt */
-  CLEAR_BIT(huart->Instance->CR1, USART_CR1_PEIE | USART_CR1_RXNEIE);
+  CLEAR_BIT(huart->Instance->CR1, USART_CR1_PEIE | USART_CR1_RXNEIE | USART_CR1_IDLEIE);
   CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE | USART_CR3_RXFTIE);
 
   /* Disable the UART DMA Rx request if enabled */
@@ -1530,6 +1637,7 @@ HAL_StatusTypeDef HAL_UART_AbortReceive_IT(UART_HandleTypeDef *huart)
 
       /* Restore huart->RxState to Ready */
       huart->RxState = HAL_UART_STATE_READY;
+      huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
 
       /* As no DMA to be aborted, call directly user Abort complete callback */
       HAL_UART_AbortReceiveCpltCallback(huart);
@@ -1545,6 +1653,7 @@ HAL_StatusTypeDef HAL_UART_AbortReceive_IT(UART_HandleTypeDef *huart)
 
     /* Restore huart->RxState to Ready */
     huart->RxState = HAL_UART_STATE_READY;
+    huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
 
     /* As no DMA to be aborted, call directly user Abort complete callback */
     HAL_UART_AbortReceiveCpltCallback(huart);
@@ -1661,12 +1770,14 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
           }
           else
           {
+            __HAL_TRACE(HAL_TRACE_EVT_UART_ERROR, huart->Instance);
             /* Call user error callback */
             HAL_UART_ErrorCallback(huart);
           }
         }
         else
         {
+          __HAL_TRACE(HAL_TRACE_EVT_UART_ERROR, huart->Instance);
           /* Call user error callback */
           HAL_UART_ErrorCallback(huart);
         }
@@ -1675,6 +1786,7 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
       {
         /* Non Blocking error : transfer could go on.
            Error is notified to user through user error callback */
+        __HAL_TRACE(HAL_TRACE_EVT_UART_ERROR, huart->Instance);
         HAL_UART_ErrorCallback(huart);
         huart->ErrorCode = HAL_UART_ERROR_NONE;
       }
@@ -1683,13 +1795,26 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
 
   } /* End if some error occurs */
 
+  /* UART IDLE line detected during a reception to idle ----------------------*/
+  if (   (huart->ReceptionType == HAL_UART_RECEPTION_TOIDLE)
+      && ((isrflags & USART_ISR_IDLE) != RESET)
+      && ((cr1its & USART_CR1_IDLEIE) != RESET))
+  {
+    __HAL_UART_CLEAR_IDLEFLAG(huart);
+
+    UART_RxToIdleEvent(huart, HAL_UART_RXEVENT_IDLE);
+    return;
+  }
+
   /* UART wakeup from Stop mode interrupt occurred ---------------------------*/
   if(((isrflags & USART_ISR_WUF) != RESET) && ((cr3its & USART_CR3_WUFIE) != RESET))
   {
     __HAL_UART_CLEAR_IT(huart, UART_CLEAR_WUF);
     /* Set the UART state ready to be able to start again the process */
     huart->gState  = HAL_UART_STATE_READY;
+    UART_TxQueueAbort(huart);
     huart->RxState = HAL_UART_STATE_READY;
+    huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
     HAL_UARTEx_WakeupCallback(huart);
     return;
   }
@@ -1837,6 +1962,42 @@ __weak void HAL_UART_AbortReceiveCpltCallback (UART_HandleTypeDef *huart)
    */
 }
 
+/**
+  * @brief  Reception Event Callback (Rx event notification called after use of advanced reception service).
+  * @param  huart UART handle
+  * @param  Offset Offset in the reception buffer of the first received byte.
+  * @param  Length Number of bytes received from Offset.
+  * @retval None
+  */
+__weak void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Offset, uint16_t Length)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(huart);
+  UNUSED(Offset);
+  UNUSED(Length);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_UARTEx_RxEventCallback can be implemented in the user file.
+   */
+}
+
+/**
+  * @brief  Transmit queue descriptor completed callback.
+  * @param  huart: UART handle.
+  * @param  pDesc: Pointer to the transmit descriptor.
+  * @retval None
+  */
+__weak void HAL_UART_TxQueueCpltCallback(UART_HandleTypeDef *huart, UART_TxDescTypeDef *pDesc)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(huart);
+  UNUSED(pDesc);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_UART_TxQueueCpltCallback can be implemented in the user file.
+   */
+}
+
 /**
   * @}
   */
@@ -2036,6 +2197,18 @@ uint32_t HAL_UART_GetError(UART_HandleTypeDef *huart)
 {
   return huart->ErrorCode;
 }
+
+/**
+  * @brief  Provide the type of the Rx Event which led to the last call of the
+  *         Rx Event callback of a reception to idle.
+  * @param  huart UART handle.
+  * @retval Rx Event Type (returned value will be a value of @ref UART_RxEvent_Type_Values)
+  */
+HAL_UART_RxEventTypeTypeDef HAL_UARTEx_GetRxEventType(UART_HandleTypeDef *huart)
+{
+  /* Return Rx Event type value, as stored in UART handle */
+  return(huart->RxEventType);
+}
 /**
   * @}
   */
@@ -2433,6 +2606,7 @@ HAL_StatusTypeDef UART_CheckIdleState(UART_HandleTypeDef *huart)
   /* Initialize the UART State */
   huart->gState = HAL_UART_STATE_READY;
   huart->RxState = HAL_UART_STATE_READY;
+  huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
 
   /* Process Unlocked */
   __HAL_UNLOCK(huart);
@@ -2465,6 +2639,7 @@ HAL_StatusTypeDef UART_WaitOnFlagUntilTimeout(UART_HandleTypeDef *huart, uint32_
 
         huart->gState = HAL_UART_STATE_READY;
         huart->RxState = HAL_UART_STATE_READY;
+        huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
 
         /* Process Unlocked */
         __HAL_UNLOCK(huart);
@@ -2489,6 +2664,7 @@ static void UART_EndTxTransfer(UART_HandleTypeDef *huart)
 
   /* At end of Tx process, restore huart->gState to Ready */
   huart->gState = HAL_UART_STATE_READY;
+  UART_TxQueueAbort(huart);
 }
 
 
@@ -2500,11 +2676,12 @@ static void UART_EndTxTransfer(UART_HandleTypeDef *huart)
 static void UART_EndRxTransfer(UART_HandleTypeDef *huart)
 {
   /* Disable RXNE, PE and ERR (Frame error, noise error, overrun error) interrupts */
-  CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_PEIE));
+  CLEAR_BIT(huart->Instance->CR1, (USART_CR1_RXNEIE | USART_CR1_IDLEIE | USART_CR1_PEIE));
   CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE);
 
   /* At end of Rx process, restore huart->RxState to Ready */
   huart->RxState = HAL_UART_STATE_READY;
+  huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
 }
 
 
@@ -2522,6 +2699,12 @@ static void UART_DMATransmitCplt(DMA_HandleTypeDef *hdma)
   {
     huart->TxXferCount = 0U;
 
+    /* Send the next segment of the transmit queue back-to-back */
+    if((huart->TxQueueActive != 0U) && (UART_TxQueueNext(huart) != 0U))
+    {
+      return;
+    }
+
     /* Disable the DMA transfer for transmit request by resetting the DMAT bit
        in the UART CR3 register */
     CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAT);
@@ -2571,10 +2754,19 @@ static void UART_DMAReceiveCplt(DMA_HandleTypeDef *hdma)
        in the UART CR3 register */
     CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAR);
 
+    /* Disable the IDLE interrupt of a reception to idle */
+    CLEAR_BIT(huart->Instance->CR1, USART_CR1_IDLEIE);
+
     /* At end of Rx process, restore huart->RxState to Ready */
     huart->RxState = HAL_UART_STATE_READY;
   }
 
+  if (huart->ReceptionType == HAL_UART_RECEPTION_TOIDLE)
+  {
+    UART_RxToIdleEvent(huart, HAL_UART_RXEVENT_TC);
+    return;
+  }
+
   HAL_UART_RxCpltCallback(huart);
 }
 
@@ -2587,9 +2779,264 @@ static void UART_DMARxHalfCplt(DMA_HandleTypeDef *hdma)
 {
   UART_HandleTypeDef* huart = (UART_HandleTypeDef*)(hdma->Parent);
 
+  if (huart->ReceptionType == HAL_UART_RECEPTION_TOIDLE)
+  {
+    UART_RxToIdleEvent(huart, HAL_UART_RXEVENT_HT);
+    return;
+  }
+
   HAL_UART_RxHalfCpltCallback(huart);
 }
 
+/**
+  * @brief  Report the data received since the previous Rx Event of a reception to idle.
+  * @note   The reported window [Offset, Offset + Length) is located in the reception
+  *         buffer: no data is copied. A window wrapping around the end of the
+  *         buffer (DMA circular mode) is reported in two calls of the Rx Event callback.
+  * @param  huart UART handle.
+  * @param  EventType Rx Event that triggered the report (IDLE, HT or TC).
+  * @retval None
+  */
+static void UART_RxToIdleEvent(UART_HandleTypeDef *huart, HAL_UART_RxEventTypeTypeDef EventType)
+{
+  uint16_t head = huart->RxXferSize - (uint16_t)__HAL_DMA_GET_COUNTER(huart->hdmarx);
+  uint16_t tail = huart->RxEventOffset;
+  uint16_t length;
+  uint16_t wrapped = 0U;
+
+  if (head >= tail)
+  {
+    length = head - tail;
+  }
+  else
+  {
+    /* DMA has wrapped around the end of the circular buffer */
+    length  = huart->RxXferSize - tail;
+    wrapped = head;
+  }
+
+  huart->RxEventType   = EventType;
+  huart->RxEventOffset = (head == huart->RxXferSize) ? 0U : head;
+
+  /* Reception over (DMA normal mode) : release the reception type before
+     calling the user, who may start a new reception from the callback */
+  if (huart->RxState == HAL_UART_STATE_READY)
+  {
+    huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+  }
+
+  if (length != 0U)
+  {
+    HAL_UARTEx_RxEventCallback(huart, tail, length);
+  }
+  if (wrapped != 0U)
+  {
+    HAL_UARTEx_RxEventCallback(huart, 0U, wrapped);
+  }
+}
+
+/**
+  * @brief  Try to take the ownership of the transmit queue.
+  * @param  huart: UART handle.
+  * @retval 0 if the ownership has been taken, 1 if the queue is owned by another context
+  */
+static uint32_t UART_TxQueueTryLock(UART_HandleTypeDef *huart)
+{
+  do
+  {
+    if(__LDREXW(&huart->TxQueueLock) != 0U)
+    {
+      __CLREX();
+      return 1U;
+    }
+  } while(__STREXW(1U, &huart->TxQueueLock) != 0U);
+
+  __DMB();
+
+  return 0U;
+}
+
+/**
+  * @brief  Add a descriptor to the pending descriptors of the transmit queue.
+  * @param  huart: UART handle.
+  * @param  pDesc: Pointer to the transmit descriptor.
+  * @retval None
+  */
+static void UART_TxQueuePush(UART_HandleTypeDef *huart, UART_TxDescTypeDef *pDesc)
+{
+  do
+  {
+    pDesc->pNext = (UART_TxDescTypeDef *)__LDREXW((volatile uint32_t *)&huart->pTxQueuePending);
+  } while(__STREXW((uint32_t)pDesc, (volatile uint32_t *)&huart->pTxQueuePending) != 0U);
+}
+
+/**
+  * @brief  Take all the pending descriptors of the transmit queue.
+  * @param  huart: UART handle.
+  * @retval Pending descriptors, first queued first
+  */
+static UART_TxDescTypeDef *UART_TxQueueFetch(UART_HandleTypeDef *huart)
+{
+  UART_TxDescTypeDef *plist;
+  UART_TxDescTypeDef *pnext;
+  UART_TxDescTypeDef *pfifo = NULL;
+
+  do
+  {
+    plist = (UART_TxDescTypeDef *)__LDREXW((volatile uint32_t *)&huart->pTxQueuePending);
+  } while(__STREXW(0U, (volatile uint32_t *)&huart->pTxQueuePending) != 0U);
+
+  /* Restore the queuing order */
+  while(plist != NULL)
+  {
+    pnext = plist->pNext;
+    plist->pNext = pfifo;
+    pfifo = plist;
+    plist = pnext;
+  }
+
+  return pfifo;
+}
+
+/**
+  * @brief  Start the DMA transfer of the next segment of the transmit queue.
+  * @note   Called by the owner of the transmit queue only. The descriptors whose
+  *         segments have all been sent are reported once the next transfer is started.
+  * @param  huart: UART handle.
+  * @retval 1 if a DMA transfer has been started, 0 if the queue is empty
+  */
+static uint32_t UART_TxQueueNext(UART_HandleTypeDef *huart)
+{
+  UART_TxDescTypeDef *pdesc;
+  UART_TxDescTypeDef *pdone = NULL;
+  UART_TxDescTypeDef *plast = NULL;
+  UART_TxSegmentTypeDef *pseg;
+  uint32_t started = 0U;
+
+  while(started == 0U)
+  {
+    pdesc = huart->pTxQueueCurrent;
+    if(pdesc == NULL)
+    {
+      pdesc = UART_TxQueueFetch(huart);
+      if(pdesc == NULL)
+      {
+        break;
+      }
+      huart->pTxQueueCurrent = pdesc;
+      huart->TxQueueSegment = 0U;
+    }
+
+    if(huart->TxQueueSegment < pdesc->NbSegments)
+    {
+      pseg = &pdesc->pSegments[huart->TxQueueSegment];
+      huart->TxQueueSegment++;
+
+      if(pseg->Size != 0U)
+      {
+        huart->pTxBuffPtr = pseg->pData;
+        huart->TxXferSize = pseg->Size;
+        huart->TxXferCount = pseg->Size;
+
+        HAL_DMA_Start_IT(huart->hdmatx, (uint32_t)pseg->pData, (uint32_t)&huart->Instance->TDR, pseg->Size);
+        started = 1U;
+      }
+    }
+    else
+    {
+      /* All the segments of the descriptor have been read by the DMA */
+      huart->pTxQueueCurrent = pdesc->pNext;
+      huart->TxQueueSegment = 0U;
+
+      pdesc->pNext = NULL;
+      if(plast == NULL)
+      {
+        pdone = pdesc;
+      }
+      else
+      {
+        plast->pNext = pdesc;
+      }
+      plast = pdesc;
+    }
+  }
+
+  while(pdone != NULL)
+  {
+    pdesc = pdone;
+    pdone = pdone->pNext;
+    pdesc->pNext = NULL;
+
+    HAL_UART_TxQueueCpltCallback(huart, pdesc);
+  }
+
+  return started;
+}
+
+/**
+  * @brief  Start the transmission of the pending descriptors if the transmitter is free.
+  * @note   When the transmit queue is owned by another context, this one sends the
+  *         pending descriptors before releasing the queue.
+  * @param  huart: UART handle.
+  * @retval None
+  */
+static void UART_TxQueueKick(UART_HandleTypeDef *huart)
+{
+  while((huart->pTxQueuePending != NULL) && (huart->gState == HAL_UART_STATE_READY))
+  {
+    if(UART_TxQueueTryLock(huart) != 0U)
+    {
+      return;
+    }
+
+    if(huart->gState == HAL_UART_STATE_READY)
+    {
+      huart->ErrorCode = HAL_UART_ERROR_NONE;
+      huart->gState = HAL_UART_STATE_BUSY_TX;
+      huart->TxQueueActive = 1U;
+
+      /* Set the UART DMA callbacks, half transfer events are not used */
+      huart->hdmatx->XferCpltCallback = UART_DMATransmitCplt;
+      huart->hdmatx->XferHalfCpltCallback = NULL;
+      huart->hdmatx->XferErrorCallback = UART_DMAError;
+      huart->hdmatx->XferAbortCallback = NULL;
+
+      huart->pTxQueueCurrent = NULL;
+      if(UART_TxQueueNext(huart) != 0U)
+      {
+        /* Clear the TC flag */
+        __HAL_UART_CLEAR_FLAG(huart, UART_CLEAR_TCF);
+
+        /* Enable the DMA transfer for transmit request by setting the DMAT bit
+           in the UART CR3 register */
+        SET_BIT(huart->Instance->CR3, USART_CR3_DMAT);
+        return;
+      }
+
+      /* Only empty descriptors were pending */
+      huart->TxQueueActive = 0U;
+      huart->gState = HAL_UART_STATE_READY;
+    }
+
+    huart->TxQueueLock = 0U;
+  }
+}
+
+/**
+  * @brief  Release the transmit queue on abort of the transmission.
+  * @param  huart: UART handle.
+  * @retval None
+  */
+static void UART_TxQueueAbort(UART_HandleTypeDef *huart)
+{
+  if(huart->TxQueueActive != 0U)
+  {
+    huart->pTxQueueCurrent = NULL;
+    huart->TxQueueActive = 0U;
+    huart->TxQueueLock = 0U;
+  }
+}
+
 /**
   * @brief DMA UART communication error callback.
   * @param hdma: DMA handle.
@@ -2673,7 +3120,9 @@ static void UART_DMATxAbortCallback(DMA_HandleTypeDef *hdma)
 
   /* Restore huart->gState and huart->RxState to Ready */
   huart->gState  = HAL_UART_STATE_READY;
+  UART_TxQueueAbort(huart);
   huart->RxState = HAL_UART_STATE_READY;
+  huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
 
   /* Call user Abort complete callback */
   HAL_UART_AbortCpltCallback(huart);
@@ -2715,7 +3164,9 @@ static void UART_DMARxAbortCallback(DMA_HandleTypeDef *hdma)
 
   /* Restore huart->gState and huart->RxState to Ready */
   huart->gState  = HAL_UART_STATE_READY;
+  UART_TxQueueAbort(huart);
   huart->RxState = HAL_UART_STATE_READY;
+  huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
 
   /* Call user Abort complete callback */
   HAL_UART_AbortCpltCallback(huart);
@@ -2738,6 +3189,7 @@ static void UART_DMATxOnlyAbortCallback(DMA_HandleTypeDef *hdma)
 
   /* Restore huart->gState to Ready */
   huart->gState = HAL_UART_STATE_READY;
+  UART_TxQueueAbort(huart);
 
   /* Call user Abort complete callback */
   HAL_UART_AbortTransmitCpltCallback(huart);
@@ -2762,6 +3214,7 @@ static void UART_DMARxOnlyAbortCallback(DMA_HandleTypeDef *hdma)
 
   /* Restore huart->RxState to Ready */
   huart->RxState = HAL_UART_STATE_READY;
+  huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
 
   /* Call user Abort complete callback */
   HAL_UART_AbortReceiveCpltCallback(huart);
@@ -2837,7 +3290,19 @@ static HAL_StatusTypeDef UART_EndTransmit_IT(UART_HandleTypeDef *huart)
   /* Tx process is ended, restore huart->gState to Ready */
   huart->gState = HAL_UART_STATE_READY;
 
-  HAL_UART_TxCpltCallback(huart);
+  if(huart->TxQueueActive != 0U)
+  {
+    /* End of the queued transmissions: release the transmit queue */
+    huart->TxQueueActive = 0U;
+    huart->TxQueueLock = 0U;
+  }
+  else
+  {
+    HAL_UART_TxCpltCallback(huart);
+  }
+
+  /* Send the descriptors queued meanwhile */
+  UART_TxQueueKick(huart);
 
   return HAL_OK;
 }
@@ -2881,6 +3346,7 @@ static HAL_StatusTypeDef UART_Receive_IT(UART_HandleTypeDef *huart)
 
       /* Rx process is completed, restore huart->RxState to Ready */
       huart->RxState = HAL_UART_STATE_READY;
+      huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
 
       HAL_UART_RxCpltCallback(huart);
 
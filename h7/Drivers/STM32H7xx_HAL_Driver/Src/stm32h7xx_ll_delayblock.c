@@ -76,7 +76,7 @@
   * @{
   */
 
-#if defined(HAL_SD_MODULE_ENABLED) || defined(HAL_QSPI_MODULE_ENABLED)
+#if defined(HAL_SD_MODULE_ENABLED) || defined(HAL_MMC_MODULE_ENABLED) || defined(HAL_QSPI_MODULE_ENABLED)
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
@@ -168,6 +168,50 @@ HAL_StatusTypeDef DelayBlock_Disable(DLYB_TypeDef *DLYBx)
   return HAL_OK;
 }
 
+/**
+  * @brief  Get the number of output clock phases spanning one input clock
+  *         period, as measured by DelayBlock_Enable().
+  * @param  DLYBx: Pointer to DLYB instance.
+  * @retval Number of phases (SEL values 0 to n-1), 0 if not calibrated
+  */
+uint32_t DelayBlock_GetPhases(DLYB_TypeDef *DLYBx)
+{
+  uint32_t lng;
+  uint32_t N = 10;
+
+  assert_param(IS_DLYB_ALL_INSTANCE(DLYBx));
+
+  lng = (DLYBx->CFGR & DLYB_CFGR_LNG) >> 16;
+  while((N>0) && ((lng >> N) == 0))
+  {
+    N--;
+  }
+  return (N != 0U) ? (N + 1U) : 0U;
+}
+
+/**
+  * @brief  Select the output clock phase of the Delay Block instance,
+  *         once enabled with DelayBlock_Enable().
+  * @param  DLYBx: Pointer to DLYB instance.
+  * @param  Phase: Output clock phase, from 0 to DelayBlock_GetPhases() - 1
+  * @retval HAL status
+  */
+HAL_StatusTypeDef DelayBlock_SetPhase(DLYB_TypeDef *DLYBx, uint32_t Phase)
+{
+  assert_param(IS_DLYB_ALL_INSTANCE(DLYBx));
+
+  if(Phase > DLYB_MAX_SELECT)
+  {
+    return HAL_ERROR;
+  }
+
+  /* The SEL field is written with the sampler enabled, output clock gated */
+  DLYBx->CR = DLYB_CR_DEN | DLYB_CR_SEN;
+  MODIFY_REG(DLYBx->CFGR, DLYB_CFGR_SEL, Phase << DLYB_CFGR_SEL_Pos);
+  DLYBx->CR = DLYB_CR_DEN;
+  return HAL_OK;
+}
+
 /**
   * @}
   */
@@ -176,7 +220,7 @@ HAL_StatusTypeDef DelayBlock_Disable(DLYB_TypeDef *DLYBx)
   * @}
   */
 
-#endif /* (HAL_SD_MODULE_ENABLED) & (HAL_QSPI_MODULE_ENABLED)*/
+#endif /* (HAL_SD_MODULE_ENABLED) & (HAL_MMC_MODULE_ENABLED) & (HAL_QSPI_MODULE_ENABLED)*/
 /**
   * @}
   */
@@ -631,6 +631,7 @@ HAL_StatusTypeDef USB_EPStartXfer(USB_OTG_GlobalTypeDef *USBx , USB_OTG_EPTypeDe
     if (ep->xfer_len == 0)
     {
       USBx_OUTEP(ep->num)->DOEPTSIZ |= (USB_OTG_DOEPTSIZ_XFRSIZ & ep->maxpacket);
+      ep->xfer_size = ep->maxpacket;
       USBx_OUTEP(ep->num)->DOEPTSIZ |= (USB_OTG_DOEPTSIZ_PKTCNT & (1 << 19)) ;      
     }
     else
@@ -638,6 +639,7 @@ HAL_StatusTypeDef USB_EPStartXfer(USB_OTG_GlobalTypeDef *USBx , USB_OTG_EPTypeDe
       pktcnt = (ep->xfer_len + ep->maxpacket -1)/ ep->maxpacket; 
       USBx_OUTEP(ep->num)->DOEPTSIZ |= (USB_OTG_DOEPTSIZ_PKTCNT & (pktcnt << 19));
       USBx_OUTEP(ep->num)->DOEPTSIZ |= (USB_OTG_DOEPTSIZ_XFRSIZ & (ep->maxpacket * pktcnt)); 
+      ep->xfer_size = ep->maxpacket * pktcnt;
     }
 
     if (dma == 1)
@@ -735,6 +737,7 @@ HAL_StatusTypeDef USB_EP0StartXfer(USB_OTG_GlobalTypeDef *USBx , USB_OTG_EPTypeD
     
     USBx_OUTEP(ep->num)->DOEPTSIZ |= (USB_OTG_DOEPTSIZ_PKTCNT & (1U << 19U));
     USBx_OUTEP(ep->num)->DOEPTSIZ |= (USB_OTG_DOEPTSIZ_XFRSIZ & (ep->maxpacket)); 
+    ep->xfer_size = ep->maxpacket;
     
 
     if (dma == 1)
@@ -751,6 +754,7 @@ HAL_StatusTypeDef USB_EP0StartXfer(USB_OTG_GlobalTypeDef *USBx , USB_OTG_EPTypeD
 /**
   * @brief  USB_WritePacket : Writes a packet into the Tx FIFO associated 
   *         with the EP/channel
+  *         Word aligned buffers are copied with an unrolled loop
   * @param  USBx : Selected device           
   * @param  src :  pointer to source buffer
   * @param  ch_ep_num : endpoint or host channel number
@@ -763,23 +767,60 @@ HAL_StatusTypeDef USB_EP0StartXfer(USB_OTG_GlobalTypeDef *USBx , USB_OTG_EPTypeD
   */
 HAL_StatusTypeDef USB_WritePacket(USB_OTG_GlobalTypeDef *USBx, uint8_t *src, uint8_t ch_ep_num, uint16_t len, uint8_t dma)
 {
-  uint32_t count32b= 0 , i= 0;
-  
-  if (dma == 0)
+  __IO uint32_t *pFifo = &USBx_DFIFO((uint32_t)ch_ep_num);
+  uint32_t *pSrc = (uint32_t *)src;
+  uint32_t count32b, i;
+  uint32_t lastword = 0U;
+
+  if (dma == 0U)
   {
-    count32b =  (len + 3) / 4;
-    for (i = 0; i < count32b; i++)
+    count32b = (uint32_t)len / 4U;
+
+    if (((uint32_t)src & 3U) == 0U)
     {
-      USBx_DFIFO(ch_ep_num) = *((__packed uint32_t *)src);
-	  src += 4;
+      /* Word aligned buffer: 16 bytes per iteration */
+      for (i = count32b / 4U; i != 0U; i--)
+      {
+        *pFifo = pSrc[0];
+        *pFifo = pSrc[1];
+        *pFifo = pSrc[2];
+        *pFifo = pSrc[3];
+        pSrc += 4U;
+      }
+      for (i = count32b & 3U; i != 0U; i--)
+      {
+        *pFifo = *pSrc;
+        pSrc++;
+      }
+    }
+    else
+    {
+      for (i = 0U; i < count32b; i++)
+      {
+        *pFifo = *((__packed uint32_t *)pSrc);
+        pSrc++;
+      }
+    }
+
+    /* Last partial word, without reading past the end of the buffer */
+    src += 4U * count32b;
+    for (i = 0U; i < ((uint32_t)len & 3U); i++)
+    {
+      lastword |= (uint32_t)src[i] << (8U * i);
+    }
+    if (((uint32_t)len & 3U) != 0U)
+    {
+      *pFifo = lastword;
     }
   }
+
   return HAL_OK;
 }
 
 /**
   * @brief  USB_ReadPacket : read a packet from the Tx FIFO associated 
   *         with the EP/channel
+  *         Word aligned buffers are copied with an unrolled loop
   * @param  USBx : Selected device  
   * @param  src : source pointer
   * @param  ch_ep_num : endpoint or host channel number
@@ -792,15 +833,50 @@ HAL_StatusTypeDef USB_WritePacket(USB_OTG_GlobalTypeDef *USBx, uint8_t *src, uin
   */
 void *USB_ReadPacket(USB_OTG_GlobalTypeDef *USBx, uint8_t *dest, uint16_t len)
 {
-  uint32_t i=0;
-  uint32_t count32b = (len + 3) / 4;
-  
-  for ( i = 0; i < count32b; i++)
+  __IO uint32_t *pFifo = &USBx_DFIFO(0U);
+  uint32_t *pDest = (uint32_t *)dest;
+  uint32_t count32b = (uint32_t)len / 4U;
+  uint32_t i;
+  uint32_t lastword;
+
+  if (((uint32_t)dest & 3U) == 0U)
   {
-    *(__packed uint32_t *)dest = USBx_DFIFO(0);
-	dest += 4;
-    
+    /* Word aligned buffer: 16 bytes per iteration */
+    for (i = count32b / 4U; i != 0U; i--)
+    {
+      pDest[0] = *pFifo;
+      pDest[1] = *pFifo;
+      pDest[2] = *pFifo;
+      pDest[3] = *pFifo;
+      pDest += 4U;
+    }
+    for (i = count32b & 3U; i != 0U; i--)
+    {
+      *pDest = *pFifo;
+      pDest++;
+    }
+  }
+  else
+  {
+    for (i = 0U; i < count32b; i++)
+    {
+      *(__packed uint32_t *)pDest = *pFifo;
+      pDest++;
+    }
   }
+
+  /* Last partial word, without writing past the end of the buffer */
+  dest += 4U * count32b;
+  if (((uint32_t)len & 3U) != 0U)
+  {
+    lastword = *pFifo;
+    for (i = 0U; i < ((uint32_t)len & 3U); i++)
+    {
+      dest[i] = (uint8_t)(lastword >> (8U * i));
+    }
+    dest += (uint32_t)len & 3U;
+  }
+
   return ((void *)dest);
 }
 
@@ -0,0 +1,528 @@
+/**
+  ******************************************************************************
+  * @file    audio_duplex.c
+  * @author  MCD Application Team
+  * @brief   Full-duplex SAI audio streaming on small blocks, with the input
+  *          and output DMA running on the same frame clock
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- initialize the two blocks of one SAI: the transmitter as master (or
+   synchronous to an external master) and the receiver as SAI_SYNCHRONOUS
+   to it, both with 16-bit data and the same slots, then configure the
+   codec through its component driver (ex. wm8994_drv). Do not link the
+   BSP audio driver: this module implements the HAL_SAI_RxXxxCallback()
+   and HAL_SAI_ErrorCallback() functions in its place.
+   In HAL_SAI_MspInit(), link to each block a DMA channel in circular
+   mode, half-word to half-word, with its interrupt enabled; the two DMA
+   interrupts must share one priority, above the application ones.
+
+2- call AUDIO_Duplex_TX_DMA_IRQHandler() and AUDIO_Duplex_RX_DMA_IRQHandler()
+   from the two DMA interrupt handlers, and AUDIO_Duplex_SAI_IRQHandler()
+   from the SAI one to be told of FIFO overruns and underruns.
+
+3- call AUDIO_Duplex_Init() then AUDIO_Duplex_Start(). Each buffer holds
+   two blocks of BlockSize frames. When the receiver has filled a block,
+   AUDIO_Duplex_ProcessCallback() is called from its DMA interrupt with
+   that block and the output block the transmitter plays next, which must
+   be filled before the current output block is over. The default
+   implementation copies the input to the output.
+
+4- the round trip through the MCU is two blocks: one to receive the input
+   block, one to play the output one. With 32 frames at 48 kHz it is
+   1.33 ms, to which the codec filter delays and the SAI FIFO are added.
+   AUDIO_Duplex_GetStats() tells the latency measured on the DMA pointers,
+   the cycles spent in the processing callback against the block period,
+   and the blocks whose processing came too late (the transmitter had
+   already started playing the output block).
+
+5- AUDIO_Duplex_MeasureLatency() measures the whole round trip, the codec
+   and analog paths included, with the codec output looped back to its
+   input: an impulse is played on slot 0 instead of the processed output,
+   and AUDIO_Duplex_LatencyCallback() is given the number of frames after
+   which slot 0 of the input exceeds the threshold.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "audio_duplex.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+typedef enum
+{
+  DUPLEX_TEST_IDLE = 0U,  /* No latency measure                       */
+  DUPLEX_TEST_ARMED,      /* Impulse played in the next output block  */
+  DUPLEX_TEST_WAIT        /* Waiting for the impulse on the input     */
+} Duplex_TestTypeDef;
+
+/* Private define ------------------------------------------------------------*/
+/* Smallest block: larger than the SAI FIFO, the lead of the transmitter */
+#define DUPLEX_MIN_BLOCK      16U
+/* Amplitude of the latency measure impulse, -6 dBFS */
+#define DUPLEX_TEST_LEVEL     16384
+
+/* Private macro -------------------------------------------------------------*/
+/* Frame a circular DMA is transferring */
+#define DUPLEX_DMA_FRAME(__HDMA__) \
+  (((2U * DuplexHalfSize) - __HAL_DMA_GET_COUNTER(__HDMA__)) / DuplexInit.Channels)
+
+/* Private variables ---------------------------------------------------------*/
+static int16_t DuplexRxBuffer[2U * AUDIO_DUPLEX_MAX_BLOCK * AUDIO_DUPLEX_MAX_CHANNELS] __attribute__((section(".dma_d1"), aligned(32)));
+static int16_t DuplexTxBuffer[2U * AUDIO_DUPLEX_MAX_BLOCK * AUDIO_DUPLEX_MAX_CHANNELS] __attribute__((section(".dma_d1"), aligned(32)));
+
+static AUDIO_Duplex_InitTypeDef  DuplexInit;
+static AUDIO_Duplex_StatsTypeDef DuplexStats;
+static uint32_t DuplexHalfSize;   /* Samples per block */
+static __IO AUDIO_Duplex_StateTypeDef DuplexState = AUDIO_DUPLEX_STATE_RESET;
+
+static __IO Duplex_TestTypeDef DuplexTest = DUPLEX_TEST_IDLE;
+static int16_t  DuplexTestThreshold;
+static uint32_t DuplexTestStart;  /* Input frame the impulse stands for */
+
+/* Private function prototypes -----------------------------------------------*/
+static void Duplex_Process(uint32_t Half);
+static void Duplex_Test(const int16_t *pIn, int16_t *pOut);
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Initialize the streaming engine on an initialized SAI pair
+  * @param  pInit: streaming configuration, copied
+  * @retval HAL status
+  */
+HAL_StatusTypeDef AUDIO_Duplex_Init(const AUDIO_Duplex_InitTypeDef *pInit)
+{
+  if((DuplexState == AUDIO_DUPLEX_STATE_BUSY) || (pInit == NULL) ||
+     (pInit->hsai_tx == NULL) || (pInit->hsai_rx == NULL) ||
+     (pInit->hsai_tx->hdmatx == NULL) || (pInit->hsai_rx->hdmarx == NULL) ||
+     (pInit->AudioFreq == 0U) ||
+     (pInit->Channels == 0U) || (pInit->Channels > AUDIO_DUPLEX_MAX_CHANNELS) ||
+     (pInit->BlockSize < DUPLEX_MIN_BLOCK) || (pInit->BlockSize > AUDIO_DUPLEX_MAX_BLOCK))
+  {
+    return HAL_ERROR;
+  }
+
+  DuplexInit = *pInit;
+  DuplexHalfSize = pInit->BlockSize * pInit->Channels;
+
+  /* Enable the DWT cycle counter to time the processing */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#if (__CORTEX_M == 7U)
+  DWT->LAR = 0xC5ACCE55U;
+#endif
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  AUDIO_Duplex_ResetStats();
+  DuplexState = AUDIO_DUPLEX_STATE_READY;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Release the streaming engine, the SAI is left initialized
+  * @param  None
+  * @retval HAL status
+  */
+HAL_StatusTypeDef AUDIO_Duplex_DeInit(void)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if(DuplexState == AUDIO_DUPLEX_STATE_BUSY)
+  {
+    status = AUDIO_Duplex_Stop();
+  }
+  DuplexState = AUDIO_DUPLEX_STATE_RESET;
+
+  return status;
+}
+
+/**
+  * @brief  Start the input and output streams on the same frame
+  * @param  None
+  * @retval HAL status
+  */
+HAL_StatusTypeDef AUDIO_Duplex_Start(void)
+{
+  if(DuplexState != AUDIO_DUPLEX_STATE_READY)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Play silence until the first block is processed */
+  memset(DuplexTxBuffer, 0, sizeof(DuplexTxBuffer));
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    SCB_CleanDCache_by_Addr((uint32_t *)DuplexTxBuffer, (int32_t)sizeof(DuplexTxBuffer));
+  }
+#endif
+
+  AUDIO_Duplex_ResetStats();
+  DuplexTest = DUPLEX_TEST_IDLE;
+  DuplexState = AUDIO_DUPLEX_STATE_BUSY;
+
+  /* The synchronous receiver waits for the transmitter frame clock: started
+     first, both blocks begin on the same frame */
+  if(HAL_SAI_Receive_DMA(DuplexInit.hsai_rx, (uint8_t *)DuplexRxBuffer, (uint16_t)(2U * DuplexHalfSize)) != HAL_OK)
+  {
+    DuplexState = AUDIO_DUPLEX_STATE_ERROR;
+    return HAL_ERROR;
+  }
+  if(HAL_SAI_Transmit_DMA(DuplexInit.hsai_tx, (uint8_t *)DuplexTxBuffer, (uint16_t)(2U * DuplexHalfSize)) != HAL_OK)
+  {
+    (void)HAL_SAI_DMAStop(DuplexInit.hsai_rx);
+    DuplexState = AUDIO_DUPLEX_STATE_ERROR;
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop both streams
+  * @param  None
+  * @retval HAL status
+  */
+HAL_StatusTypeDef AUDIO_Duplex_Stop(void)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if(DuplexState == AUDIO_DUPLEX_STATE_RESET)
+  {
+    return HAL_ERROR;
+  }
+
+  if(HAL_SAI_DMAStop(DuplexInit.hsai_tx) != HAL_OK)
+  {
+    status = HAL_ERROR;
+  }
+  if(HAL_SAI_DMAStop(DuplexInit.hsai_rx) != HAL_OK)
+  {
+    status = HAL_ERROR;
+  }
+
+  if(DuplexTest != DUPLEX_TEST_IDLE)
+  {
+    DuplexTest = DUPLEX_TEST_IDLE;
+    AUDIO_Duplex_LatencyCallback(AUDIO_DUPLEX_LATENCY_TIMEOUT);
+  }
+  DuplexState = AUDIO_DUPLEX_STATE_READY;
+
+  return status;
+}
+
+/**
+  * @brief  Return the streaming state
+  * @param  None
+  * @retval Streaming state
+  */
+AUDIO_Duplex_StateTypeDef AUDIO_Duplex_GetState(void)
+{
+  return DuplexState;
+}
+
+/**
+  * @brief  Read the streaming statistics
+  * @param  pStats: statistics, copied with the DMA interrupts masked
+  * @retval None
+  */
+void AUDIO_Duplex_GetStats(AUDIO_Duplex_StatsTypeDef *pStats)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  *pStats = DuplexStats;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Clear the block and cycle counters
+  * @param  None
+  * @retval None
+  */
+void AUDIO_Duplex_ResetStats(void)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  DuplexStats.Blocks       = 0U;
+  DuplexStats.LateBlocks   = 0U;
+  DuplexStats.Latency      = 0U;
+  DuplexStats.CyclesLast   = 0U;
+  DuplexStats.CyclesMax    = 0U;
+  DuplexStats.CyclesBudget = (DuplexInit.AudioFreq != 0U) ?
+    (uint32_t)(((uint64_t)SystemCoreClock * DuplexInit.BlockSize) / DuplexInit.AudioFreq) : 0U;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Measure the round trip latency through an external loopback
+  * @note   The processing is suspended until AUDIO_Duplex_LatencyCallback()
+  *         is called, at most one second later. The output is muted but for
+  *         one impulse on slot 0.
+  * @param  Threshold: input level on slot 0 detecting the impulse back
+  * @retval HAL status
+  */
+HAL_StatusTypeDef AUDIO_Duplex_MeasureLatency(int16_t Threshold)
+{
+  if((DuplexState != AUDIO_DUPLEX_STATE_BUSY) || (DuplexTest != DUPLEX_TEST_IDLE) || (Threshold <= 0))
+  {
+    return HAL_ERROR;
+  }
+
+  DuplexTestThreshold = Threshold;
+  DuplexTest = DUPLEX_TEST_ARMED;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Handle the transmitter DMA interrupt
+  * @param  None
+  * @retval None
+  */
+void AUDIO_Duplex_TX_DMA_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(DuplexInit.hsai_tx->hdmatx);
+}
+
+/**
+  * @brief  Handle the receiver DMA interrupt
+  * @param  None
+  * @retval None
+  */
+void AUDIO_Duplex_RX_DMA_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(DuplexInit.hsai_rx->hdmarx);
+}
+
+/**
+  * @brief  Handle the SAI interrupt (FIFO overrun and underrun)
+  * @param  None
+  * @retval None
+  */
+void AUDIO_Duplex_SAI_IRQHandler(void)
+{
+  HAL_SAI_IRQHandler(DuplexInit.hsai_tx);
+  HAL_SAI_IRQHandler(DuplexInit.hsai_rx);
+}
+
+/**
+  * @brief  Process an input block into an output block
+  * @note   Called from the receiver DMA interrupt. Both buffers hold FrameNbr
+  *         frames of Channels interleaved samples; pOut must be filled
+  *         before FrameNbr / AudioFreq seconds.
+  * @param  pIn: input block
+  * @param  pOut: output block
+  * @param  FrameNbr: frames per block
+  * @retval None
+  */
+__weak void AUDIO_Duplex_ProcessCallback(const int16_t *pIn, int16_t *pOut, uint32_t FrameNbr)
+{
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the AUDIO_Duplex_ProcessCallback could be implemented in the user file
+   */
+  memcpy(pOut, pIn, FrameNbr * DuplexInit.Channels * sizeof(int16_t));
+}
+
+/**
+  * @brief  Round trip latency measured
+  * @note   Called from the receiver DMA interrupt.
+  * @param  Frames: latency in frames, or AUDIO_DUPLEX_LATENCY_TIMEOUT
+  * @retval None
+  */
+__weak void AUDIO_Duplex_LatencyCallback(uint32_t Frames)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Frames);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the AUDIO_Duplex_LatencyCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  The streaming stopped on an error
+  * @param  None
+  * @retval None
+  */
+__weak void AUDIO_Duplex_ErrorCallback(void)
+{
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the AUDIO_Duplex_ErrorCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Rx transfer complete callback: second input block received
+  * @param  hsai: SAI handle
+  * @retval None
+  */
+void HAL_SAI_RxCpltCallback(SAI_HandleTypeDef *hsai)
+{
+  if(hsai == DuplexInit.hsai_rx)
+  {
+    Duplex_Process(1U);
+  }
+}
+
+/**
+  * @brief  Rx transfer half complete callback: first input block received
+  * @param  hsai: SAI handle
+  * @retval None
+  */
+void HAL_SAI_RxHalfCpltCallback(SAI_HandleTypeDef *hsai)
+{
+  if(hsai == DuplexInit.hsai_rx)
+  {
+    Duplex_Process(0U);
+  }
+}
+
+/**
+  * @brief  SAI error callback
+  * @param  hsai: SAI handle
+  * @retval None
+  */
+void HAL_SAI_ErrorCallback(SAI_HandleTypeDef *hsai)
+{
+  if((hsai == DuplexInit.hsai_rx) || (hsai == DuplexInit.hsai_tx))
+  {
+    DuplexState = AUDIO_DUPLEX_STATE_ERROR;
+    AUDIO_Duplex_ErrorCallback();
+  }
+}
+
+/**
+  * @brief  Process the input block just received into the output block
+  *         played next
+  * @param  Half: block index in the buffers, 0 or 1
+  * @retval None
+  */
+static void Duplex_Process(uint32_t Half)
+{
+  int16_t *pIn  = &DuplexRxBuffer[Half * DuplexHalfSize];
+  int16_t *pOut = &DuplexTxBuffer[Half * DuplexHalfSize];
+  uint32_t block = DuplexInit.BlockSize;
+  uint32_t start = DWT->CYCCNT;
+  uint32_t frame;
+  uint32_t cycles;
+
+  /* Output block to the frame the transmitter is reading, plus the input
+     block to the frame just received */
+  frame = DUPLEX_DMA_FRAME(DuplexInit.hsai_tx->hdmatx);
+  DuplexStats.Latency = block + (((Half * block) + (2U * block) - frame) % (2U * block));
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  /* The DMA wrote behind the data cache */
+  if((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    SCB_InvalidateDCache_by_Addr((uint32_t *)pIn, (int32_t)(DuplexHalfSize * sizeof(int16_t)));
+  }
+#endif
+
+  if(DuplexTest == DUPLEX_TEST_IDLE)
+  {
+    AUDIO_Duplex_ProcessCallback(pIn, pOut, block);
+  }
+  else
+  {
+    Duplex_Test(pIn, pOut);
+  }
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    SCB_CleanDCache_by_Addr((uint32_t *)pOut, (int32_t)(DuplexHalfSize * sizeof(int16_t)));
+  }
+#endif
+
+  cycles = DWT->CYCCNT - start;
+  DuplexStats.CyclesLast = cycles;
+  if(cycles > DuplexStats.CyclesMax)
+  {
+    DuplexStats.CyclesMax = cycles;
+  }
+
+  /* Late when the transmitter already plays the block just written */
+  if((DUPLEX_DMA_FRAME(DuplexInit.hsai_tx->hdmatx) / block) == Half)
+  {
+    DuplexStats.LateBlocks++;
+  }
+  DuplexStats.Blocks++;
+}
+
+/**
+  * @brief  Play the latency measure impulse and look for it on the input
+  * @param  pIn: input block
+  * @param  pOut: output block
+  * @retval None
+  */
+static void Duplex_Test(const int16_t *pIn, int16_t *pOut)
+{
+  uint32_t first = DuplexStats.Blocks * DuplexInit.BlockSize;
+  uint32_t frame;
+  int16_t  sample;
+
+  memset(pOut, 0, DuplexHalfSize * sizeof(int16_t));
+
+  if(DuplexTest == DUPLEX_TEST_ARMED)
+  {
+    /* The impulse stands for the first frame of this input block, as an
+       input passed through would */
+    pOut[0] = DUPLEX_TEST_LEVEL;
+    DuplexTestStart = first;
+    DuplexTest = DUPLEX_TEST_WAIT;
+    return;
+  }
+
+  for(frame = 0U; frame < DuplexInit.BlockSize; frame++)
+  {
+    sample = pIn[frame * DuplexInit.Channels];
+    if((sample > DuplexTestThreshold) || (sample < -DuplexTestThreshold))
+    {
+      DuplexTest = DUPLEX_TEST_IDLE;
+      AUDIO_Duplex_LatencyCallback(first + frame - DuplexTestStart);
+      return;
+    }
+  }
+
+  if((first - DuplexTestStart) >= DuplexInit.AudioFreq)
+  {
+    DuplexTest = DUPLEX_TEST_IDLE;
+    AUDIO_Duplex_LatencyCallback(AUDIO_DUPLEX_LATENCY_TIMEOUT);
+  }
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,801 @@
+/**
+  ******************************************************************************
+  * @file    audio_mixer.c
+  * @author  MCD Application Team
+  * @brief   Mixer of audio streams with ramped gains and format conversion
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- call AUDIO_Mixer_Init() with the channels and the format of the output:
+   AUDIO_MIXER_FORMAT_S16 for BSP_AUDIO_OUT_Play() or audio_duplex, S24 for a
+   SAI with 24-bit slots.
+
+2- start each sound on a free stream with AUDIO_Mixer_StreamStart(). The
+   source of the stream is called from the mixer for each pass, to write
+   the next frames in int16, 24-bit or float format; a mono stream is sent
+   to all the channels. A stream at another sample rate runs its sample
+   rate converter in its source. When the source returns fewer frames than
+   asked, the stream ends and AUDIO_Mixer_StreamEndCallback() is called.
+
+3- call AUDIO_Mixer_Process() from the audio interrupt, with the output
+   block to fill (ex. from AUDIO_Duplex_ProcessCallback() or
+   BSP_AUDIO_OUT_HalfTransfer_CallBack()). The gains of AUDIO_Mixer_SetGain(),
+   AUDIO_Mixer_SetMasterGain() and AUDIO_Mixer_StreamStop() are taken at the
+   next pass and reached by a linear ramp, so that changing them does not
+   click. AUDIO_Mixer_GetStats() tells the cycles spent per call.
+
+The streams are mixed in a 32-bit bus with 6 dB of headroom, by saturating
+additions, and the mix is saturated to the output format after the master
+gain. Two int16 streams are mixed together with one SMLAD per sample, an
+int16 stream alone, a 24-bit stream or a float stream with one multiply and
+one saturating add per sample. The bus, the source buffers and the stream
+states are in the DTCM, which the linker script must place the section in :
+      .audio_dtcm (NOLOAD) : { *(.audio_dtcm) } >DTCMRAM
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "audio_mixer.h"
+#include <string.h>
+
+#if (AUDIO_MIXER_MAX_STREAMS > 32U)
+#error "audio_mixer supports up to 32 streams"
+#endif
+
+/* Private typedef -----------------------------------------------------------*/
+typedef enum
+{
+  MIXER_REQUEST_NONE = 0U,  /* No change                                    */
+  MIXER_REQUEST_GAIN,       /* Ramp to the requested gain                   */
+  MIXER_REQUEST_STOP        /* Ramp to the requested gain, then stop        */
+} Mixer_RequestTypeDef;
+
+typedef struct
+{
+  int32_t  Value;   /* Current gain, Q15 in the upper half word          */
+  int32_t  Target;  /* Gain at the end of the ramp, same format          */
+  int32_t  Step;    /* Change of Value per frame, 0 out of a ramp        */
+  uint32_t Ramp;    /* Frames left in the ramp                           */
+} Mixer_GainTypeDef;
+
+typedef struct
+{
+  AUDIO_Mixer_StreamTypeDef Config;
+  Mixer_GainTypeDef         Gain;
+  uint32_t                  Stopping;     /* Stopped at the end of the ramp  */
+  __IO uint32_t             Active;
+  __IO Mixer_RequestTypeDef Request;      /* Taken by the next pass          */
+  uint16_t                  RequestGain;
+  uint32_t                  RequestRamp;
+} Mixer_StreamTypeDef;
+
+/* Private define ------------------------------------------------------------*/
+/* Largest float below 2^31, converted to int32_t without overflow */
+#define MIXER_F32_LIMIT   2147483520.0f
+
+/* Private macro -------------------------------------------------------------*/
+#define MIXER_BUS_SIZE    (AUDIO_MIXER_MAX_BLOCK * AUDIO_MIXER_MAX_CHANNELS)
+
+/* Private variables ---------------------------------------------------------*/
+static int32_t             MixerBus[MIXER_BUS_SIZE] __attribute__((section(".audio_dtcm")));
+static uint32_t            MixerSource[2][MIXER_BUS_SIZE] __attribute__((section(".audio_dtcm")));  /* Source frames of a pair of streams */
+static Mixer_StreamTypeDef MixerStreams[AUDIO_MIXER_MAX_STREAMS] __attribute__((section(".audio_dtcm")));
+
+static AUDIO_Mixer_InitTypeDef  MixerInit;
+static AUDIO_Mixer_StatsTypeDef MixerStats;
+static Mixer_GainTypeDef        MixerMaster;
+static __IO uint32_t            MixerMasterRequest;
+static uint16_t                 MixerMasterGain;
+static uint32_t                 MixerMasterRamp;
+
+/* Private function prototypes -----------------------------------------------*/
+static void     Mixer_SetGain(Mixer_GainTypeDef *pGain, uint16_t Gain, uint32_t RampFrames);
+static uint32_t Mixer_GainSpan(const Mixer_GainTypeDef *pGain, uint32_t FrameNbr);
+static void     Mixer_GainAdvance(Mixer_GainTypeDef *pGain, uint32_t FrameNbr);
+static void     Mixer_TakeRequests(void);
+static uint32_t Mixer_Pass(uint32_t FrameNbr);
+static void     Mixer_AddPairS16(Mixer_StreamTypeDef *pStreamA, const int16_t *pInA,
+                                 Mixer_StreamTypeDef *pStreamB, const int16_t *pInB, uint32_t FrameNbr);
+static void     Mixer_AddS16(Mixer_StreamTypeDef *pStream, const int16_t *pIn, uint32_t FrameNbr);
+static void     Mixer_AddS24(Mixer_StreamTypeDef *pStream, const int32_t *pIn, uint32_t FrameNbr);
+static void     Mixer_AddF32(Mixer_StreamTypeDef *pStream, const float *pIn, uint32_t FrameNbr);
+static void     Mixer_Output(void *pOut, uint32_t FrameNbr);
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Initialize the mixer, all the streams stopped
+  * @param  pInit: mixer configuration, copied
+  * @retval HAL status
+  */
+HAL_StatusTypeDef AUDIO_Mixer_Init(const AUDIO_Mixer_InitTypeDef *pInit)
+{
+  if((pInit == NULL) || (pInit->Channels == 0U) || (pInit->Channels > AUDIO_MIXER_MAX_CHANNELS) ||
+     ((pInit->Format != AUDIO_MIXER_FORMAT_S16) && (pInit->Format != AUDIO_MIXER_FORMAT_S24)) ||
+     (pInit->MasterGain > AUDIO_MIXER_GAIN_UNITY))
+  {
+    return HAL_ERROR;
+  }
+
+  memset(MixerStreams, 0, sizeof(MixerStreams));
+  MixerInit          = *pInit;
+  MixerMasterRequest = 0U;
+  Mixer_SetGain(&MixerMaster, pInit->MasterGain, 0U);
+
+  /* Enable the DWT cycle counter to time the mixing */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#if (__CORTEX_M == 7U)
+  DWT->LAR = 0xC5ACCE55U;
+#endif
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  AUDIO_Mixer_ResetStats();
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Start playing a stream
+  * @param  Stream: stream number, 0 to AUDIO_MIXER_MAX_STREAMS - 1
+  * @param  pStream: stream configuration, copied
+  * @retval HAL status, HAL_BUSY when the stream is already playing
+  */
+HAL_StatusTypeDef AUDIO_Mixer_StreamStart(uint32_t Stream, const AUDIO_Mixer_StreamTypeDef *pStream)
+{
+  Mixer_StreamTypeDef *pState;
+
+  if((MixerInit.Channels == 0U) || (Stream >= AUDIO_MIXER_MAX_STREAMS) || (pStream == NULL) ||
+     (pStream->Source == NULL) || (pStream->Format > AUDIO_MIXER_FORMAT_F32) ||
+     ((pStream->Channels != 1U) && (pStream->Channels != MixerInit.Channels)) ||
+     (pStream->Gain > AUDIO_MIXER_GAIN_UNITY))
+  {
+    return HAL_ERROR;
+  }
+  pState = &MixerStreams[Stream];
+  if(pState->Active != 0U)
+  {
+    return HAL_BUSY;
+  }
+
+  pState->Config   = *pStream;
+  pState->Stopping = 0U;
+  pState->Request  = MIXER_REQUEST_NONE;
+  Mixer_SetGain(&pState->Gain, pStream->Gain, 0U);
+
+  /* The state must be complete before the mixer sees the stream */
+  __DMB();
+  pState->Active = 1U;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop a stream, after fading it out
+  * @param  Stream: stream number
+  * @param  RampFrames: fade out length in frames, 0 to stop at once
+  * @retval HAL status
+  */
+HAL_StatusTypeDef AUDIO_Mixer_StreamStop(uint32_t Stream, uint32_t RampFrames)
+{
+  Mixer_StreamTypeDef *pState;
+
+  if(Stream >= AUDIO_MIXER_MAX_STREAMS)
+  {
+    return HAL_ERROR;
+  }
+  pState = &MixerStreams[Stream];
+
+  if(RampFrames == 0U)
+  {
+    pState->Active = 0U;
+  }
+  else
+  {
+    pState->Request     = MIXER_REQUEST_NONE;
+    pState->RequestGain = 0U;
+    pState->RequestRamp = RampFrames;
+    pState->Request     = MIXER_REQUEST_STOP;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Tell whether a stream is playing
+  * @param  Stream: stream number
+  * @retval 1 while the stream plays, its fade out included, 0 otherwise
+  */
+uint32_t AUDIO_Mixer_IsStreamActive(uint32_t Stream)
+{
+  return (Stream < AUDIO_MIXER_MAX_STREAMS) ? MixerStreams[Stream].Active : 0U;
+}
+
+/**
+  * @brief  Change the gain of a stream
+  * @param  Stream: stream number
+  * @param  Gain: new gain, Q15, up to AUDIO_MIXER_GAIN_UNITY
+  * @param  RampFrames: frames to reach the new gain, 0 to change it at once
+  * @retval HAL status
+  */
+HAL_StatusTypeDef AUDIO_Mixer_SetGain(uint32_t Stream, uint16_t Gain, uint32_t RampFrames)
+{
+  Mixer_StreamTypeDef *pState;
+
+  if((Stream >= AUDIO_MIXER_MAX_STREAMS) || (Gain > AUDIO_MIXER_GAIN_UNITY))
+  {
+    return HAL_ERROR;
+  }
+  pState = &MixerStreams[Stream];
+
+  /* Withdraw the request being replaced, the mixer may interrupt this function */
+  pState->Request     = MIXER_REQUEST_NONE;
+  pState->RequestGain = Gain;
+  pState->RequestRamp = RampFrames;
+  pState->Request     = MIXER_REQUEST_GAIN;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Change the gain applied to the mix
+  * @param  Gain: new gain, Q15, up to AUDIO_MIXER_GAIN_UNITY
+  * @param  RampFrames: frames to reach the new gain, 0 to change it at once
+  * @retval HAL status
+  */
+HAL_StatusTypeDef AUDIO_Mixer_SetMasterGain(uint16_t Gain, uint32_t RampFrames)
+{
+  if(Gain > AUDIO_MIXER_GAIN_UNITY)
+  {
+    return HAL_ERROR;
+  }
+
+  MixerMasterRequest = 0U;
+  MixerMasterGain    = Gain;
+  MixerMasterRamp    = RampFrames;
+  MixerMasterRequest = 1U;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Mix the playing streams into an output block
+  * @param  pOut: interleaved output frames, int16_t or int32_t after the
+  *         output format
+  * @param  FrameNbr: number of frames to write
+  * @retval HAL status
+  */
+HAL_StatusTypeDef AUDIO_Mixer_Process(void *pOut, uint32_t FrameNbr)
+{
+  uint32_t start = DWT->CYCCNT;
+  uint32_t done, frames, ended, i, cycles;
+  uint8_t *pDst = (uint8_t *)pOut;
+
+  if((MixerInit.Channels == 0U) || (pOut == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  for(done = 0U; done < FrameNbr; done += frames)
+  {
+    frames = FrameNbr - done;
+    if(frames > AUDIO_MIXER_MAX_BLOCK)
+    {
+      frames = AUDIO_MIXER_MAX_BLOCK;
+    }
+
+    ended = Mixer_Pass(frames);
+    Mixer_Output(pDst, frames);
+    pDst += frames * MixerInit.Channels *
+            ((MixerInit.Format == AUDIO_MIXER_FORMAT_S16) ? sizeof(int16_t) : sizeof(int32_t));
+
+    /* Told once the pass is over, the callback may start a new stream */
+    for(i = 0U; ended != 0U; i++, ended >>= 1U)
+    {
+      if((ended & 1U) != 0U)
+      {
+        AUDIO_Mixer_StreamEndCallback(i);
+      }
+    }
+  }
+
+  cycles = DWT->CYCCNT - start;
+  MixerStats.Frames    += FrameNbr;
+  MixerStats.CyclesLast = cycles;
+  if(cycles > MixerStats.CyclesMax)
+  {
+    MixerStats.CyclesMax = cycles;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Get the mixer statistics
+  * @param  pStats: statistics, copied
+  * @retval None
+  */
+void AUDIO_Mixer_GetStats(AUDIO_Mixer_StatsTypeDef *pStats)
+{
+  if(pStats != NULL)
+  {
+    *pStats = MixerStats;
+  }
+}
+
+/**
+  * @brief  Clear the mixer statistics
+  * @param  None
+  * @retval None
+  */
+void AUDIO_Mixer_ResetStats(void)
+{
+  memset(&MixerStats, 0, sizeof(MixerStats));
+}
+
+/**
+  * @brief  Stream end callback, called from AUDIO_Mixer_Process() when the
+  *         source of a stream ran out or its fade out is over
+  * @param  Stream: stream number, free again
+  * @retval None
+  */
+__weak void AUDIO_Mixer_StreamEndCallback(uint32_t Stream)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Stream);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the AUDIO_Mixer_StreamEndCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Start a gain ramp
+  * @param  pGain: gain state
+  * @param  Gain: gain to reach, Q15
+  * @param  RampFrames: ramp length, 0 to set the gain at once
+  * @retval None
+  */
+static void Mixer_SetGain(Mixer_GainTypeDef *pGain, uint16_t Gain, uint32_t RampFrames)
+{
+  pGain->Target = (int32_t)((uint32_t)Gain << 16U);
+  if(RampFrames == 0U)
+  {
+    pGain->Value = pGain->Target;
+    pGain->Step  = 0;
+    pGain->Ramp  = 0U;
+  }
+  else
+  {
+    pGain->Step = (int32_t)(((int64_t)pGain->Target - pGain->Value) / (int64_t)RampFrames);
+    pGain->Ramp = RampFrames;
+  }
+}
+
+/**
+  * @brief  Get the number of frames over which the gain changes by a constant step
+  * @param  pGain: gain state
+  * @param  FrameNbr: frames left to mix
+  * @retval Frames up to the end of the ramp, at most FrameNbr
+  */
+static uint32_t Mixer_GainSpan(const Mixer_GainTypeDef *pGain, uint32_t FrameNbr)
+{
+  return ((pGain->Ramp != 0U) && (pGain->Ramp < FrameNbr)) ? pGain->Ramp : FrameNbr;
+}
+
+/**
+  * @brief  Move a gain forward by a number of frames
+  * @param  pGain: gain state
+  * @param  FrameNbr: frames mixed, at most Mixer_GainSpan()
+  * @retval None
+  */
+static void Mixer_GainAdvance(Mixer_GainTypeDef *pGain, uint32_t FrameNbr)
+{
+  if(pGain->Ramp != 0U)
+  {
+    pGain->Ramp  -= FrameNbr;
+    pGain->Value += pGain->Step * (int32_t)FrameNbr;
+    if(pGain->Ramp == 0U)
+    {
+      pGain->Value = pGain->Target;
+      pGain->Step  = 0;
+    }
+  }
+}
+
+/**
+  * @brief  Take the gain changes requested since the previous pass
+  * @param  None
+  * @retval None
+  */
+static void Mixer_TakeRequests(void)
+{
+  Mixer_StreamTypeDef *pState;
+  Mixer_RequestTypeDef request;
+  uint32_t i;
+
+  for(i = 0U; i < AUDIO_MIXER_MAX_STREAMS; i++)
+  {
+    pState  = &MixerStreams[i];
+    request = pState->Request;
+    if((pState->Active != 0U) && (request != MIXER_REQUEST_NONE))
+    {
+      pState->Request = MIXER_REQUEST_NONE;
+      Mixer_SetGain(&pState->Gain, pState->RequestGain, pState->RequestRamp);
+      pState->Stopping = (request == MIXER_REQUEST_STOP) ? 1U : 0U;
+    }
+  }
+
+  if(MixerMasterRequest != 0U)
+  {
+    MixerMasterRequest = 0U;
+    Mixer_SetGain(&MixerMaster, MixerMasterGain, MixerMasterRamp);
+  }
+}
+
+/**
+  * @brief  Mix the playing streams in the bus
+  * @param  FrameNbr: frames to mix, at most AUDIO_MIXER_MAX_BLOCK
+  * @retval Streams which ended in this pass, one bit per stream
+  */
+static uint32_t Mixer_Pass(uint32_t FrameNbr)
+{
+  Mixer_StreamTypeDef *pState;
+  Mixer_StreamTypeDef *pPending = NULL;  /* int16 stream waiting for a pair */
+  uint32_t *pSource;
+  uint32_t ended = 0U;
+  uint32_t i, frames, size;
+
+  Mixer_TakeRequests();
+  memset(MixerBus, 0, FrameNbr * MixerInit.Channels * sizeof(int32_t));
+
+  for(i = 0U; i < AUDIO_MIXER_MAX_STREAMS; i++)
+  {
+    pState = &MixerStreams[i];
+    if(pState->Active == 0U)
+    {
+      continue;
+    }
+
+    /* Ask the source for the frames of the pass, silence after its end */
+    pSource = MixerSource[(pPending == NULL) ? 0U : 1U];
+    size    = pState->Config.Channels *
+              ((pState->Config.Format == AUDIO_MIXER_FORMAT_S16) ? sizeof(int16_t) : sizeof(int32_t));
+    frames  = pState->Config.Source(pState->Config.pContext, pSource, FrameNbr);
+    if(frames < FrameNbr)
+    {
+      memset((uint8_t *)pSource + (frames * size), 0, (FrameNbr - frames) * size);
+      ended |= 1UL << i;
+    }
+
+    switch(pState->Config.Format)
+    {
+    case AUDIO_MIXER_FORMAT_S16:
+      if(pPending == NULL)
+      {
+        pPending = pState;
+      }
+      else
+      {
+        Mixer_AddPairS16(pPending, (const int16_t *)MixerSource[0], pState, (const int16_t *)pSource, FrameNbr);
+        pPending = NULL;
+      }
+      break;
+
+    case AUDIO_MIXER_FORMAT_S24:
+      Mixer_AddS24(pState, (const int32_t *)pSource, FrameNbr);
+      break;
+
+    default:
+      Mixer_AddF32(pState, (const float *)pSource, FrameNbr);
+      break;
+    }
+  }
+  if(pPending != NULL)
+  {
+    Mixer_AddS16(pPending, (const int16_t *)MixerSource[0], FrameNbr);
+  }
+
+  /* Drop the streams which ran out or whose fade out is over */
+  for(i = 0U; i < AUDIO_MIXER_MAX_STREAMS; i++)
+  {
+    pState = &MixerStreams[i];
+    if((pState->Active != 0U) && (pState->Stopping != 0U) && (pState->Gain.Ramp == 0U))
+    {
+      ended |= 1UL << i;
+    }
+    if((ended & (1UL << i)) != 0U)
+    {
+      pState->Active = 0U;
+    }
+  }
+
+  return ended;
+}
+
+/**
+  * @brief  Add two int16 streams to the bus, one SMLAD per sample
+  * @param  pStreamA: first stream
+  * @param  pInA: frames of the first stream
+  * @param  pStreamB: second stream
+  * @param  pInB: frames of the second stream
+  * @param  FrameNbr: frames to mix
+  * @retval None
+  */
+static void Mixer_AddPairS16(Mixer_StreamTypeDef *pStreamA, const int16_t *pInA,
+                             Mixer_StreamTypeDef *pStreamB, const int16_t *pInB, uint32_t FrameNbr)
+{
+  int32_t *pBus = MixerBus;
+  uint32_t channels = MixerInit.Channels;
+  uint32_t strideA  = pStreamA->Config.Channels;
+  uint32_t strideB  = pStreamB->Config.Channels;
+  uint32_t incA     = (strideA > 1U) ? 1U : 0U;
+  uint32_t incB     = (strideB > 1U) ? 1U : 0U;
+  uint32_t frames, f, c, gains, a, b;
+  int32_t  gainA, gainB, stepA, stepB;
+
+  while(FrameNbr > 0U)
+  {
+    /* Frames up to the end of the first ramp */
+    frames = Mixer_GainSpan(&pStreamB->Gain, Mixer_GainSpan(&pStreamA->Gain, FrameNbr));
+    gainA  = pStreamA->Gain.Value;
+    stepA  = pStreamA->Gain.Step;
+    gainB  = pStreamB->Gain.Value;
+    stepB  = pStreamB->Gain.Step;
+
+    if((channels == 2U) && (incA != 0U) && (incB != 0U))
+    {
+      /* Stereo: left and right samples of each stream are read in one word */
+      for(f = 0U; f < frames; f++)
+      {
+        gains   = __PKHTB((uint32_t)gainB, (uint32_t)gainA, 16);
+        a       = *(const uint32_t *)pInA;
+        b       = *(const uint32_t *)pInB;
+        pBus[0] = __QADD(pBus[0], (int32_t)__SMLAD(__PKHBT(a, b, 16), gains, 0U));
+        pBus[1] = __QADD(pBus[1], (int32_t)__SMLAD(__PKHTB(b, a, 16), gains, 0U));
+        pInA  += 2;
+        pInB  += 2;
+        pBus  += 2;
+        gainA += stepA;
+        gainB += stepB;
+      }
+    }
+    else
+    {
+      for(f = 0U; f < frames; f++)
+      {
+        gains = __PKHTB((uint32_t)gainB, (uint32_t)gainA, 16);
+        for(c = 0U; c < channels; c++)
+        {
+          a       = (uint16_t)pInA[c * incA];
+          b       = (uint16_t)pInB[c * incB];
+          pBus[c] = __QADD(pBus[c], (int32_t)__SMLAD(__PKHBT(a, b, 16), gains, 0U));
+        }
+        pInA  += strideA;
+        pInB  += strideB;
+        pBus  += channels;
+        gainA += stepA;
+        gainB += stepB;
+      }
+    }
+
+    Mixer_GainAdvance(&pStreamA->Gain, frames);
+    Mixer_GainAdvance(&pStreamB->Gain, frames);
+    FrameNbr -= frames;
+  }
+}
+
+/**
+  * @brief  Add an int16 stream to the bus
+  * @param  pStream: stream
+  * @param  pIn: frames of the stream
+  * @param  FrameNbr: frames to mix
+  * @retval None
+  */
+static void Mixer_AddS16(Mixer_StreamTypeDef *pStream, const int16_t *pIn, uint32_t FrameNbr)
+{
+  int32_t *pBus = MixerBus;
+  uint32_t channels = MixerInit.Channels;
+  uint32_t stride   = pStream->Config.Channels;
+  uint32_t inc      = (stride > 1U) ? 1U : 0U;
+  uint32_t frames, f, c;
+  int32_t  gain, step;
+
+  while(FrameNbr > 0U)
+  {
+    frames = Mixer_GainSpan(&pStream->Gain, FrameNbr);
+    gain   = pStream->Gain.Value;
+    step   = pStream->Gain.Step;
+
+    for(f = 0U; f < frames; f++)
+    {
+      for(c = 0U; c < channels; c++)
+      {
+        pBus[c] = __QADD(pBus[c], (int32_t)pIn[c * inc] * (gain >> 16));
+      }
+      pIn  += stride;
+      pBus += channels;
+      gain += step;
+    }
+
+    Mixer_GainAdvance(&pStream->Gain, frames);
+    FrameNbr -= frames;
+  }
+}
+
+/**
+  * @brief  Add a 24-bit stream to the bus
+  * @param  pStream: stream
+  * @param  pIn: frames of the stream
+  * @param  FrameNbr: frames to mix
+  * @retval None
+  */
+static void Mixer_AddS24(Mixer_StreamTypeDef *pStream, const int32_t *pIn, uint32_t FrameNbr)
+{
+  int32_t *pBus = MixerBus;
+  uint32_t channels = MixerInit.Channels;
+  uint32_t stride   = pStream->Config.Channels;
+  uint32_t inc      = (stride > 1U) ? 1U : 0U;
+  uint32_t frames, f, c;
+  int32_t  gain, step, x;
+
+  while(FrameNbr > 0U)
+  {
+    frames = Mixer_GainSpan(&pStream->Gain, FrameNbr);
+    gain   = pStream->Gain.Value;
+    step   = pStream->Gain.Step;
+
+    for(f = 0U; f < frames; f++)
+    {
+      for(c = 0U; c < channels; c++)
+      {
+        /* The 24 bits to Q31, times the Q31 gain gives the Q30 bus */
+        x       = (int32_t)((uint32_t)pIn[c * inc] << 8U);
+        pBus[c] = __QADD(pBus[c], (int32_t)(((int64_t)x * gain) >> 32));
+      }
+      pIn  += stride;
+      pBus += channels;
+      gain += step;
+    }
+
+    Mixer_GainAdvance(&pStream->Gain, frames);
+    FrameNbr -= frames;
+  }
+}
+
+/**
+  * @brief  Add a float stream to the bus
+  * @param  pStream: stream
+  * @param  pIn: frames of the stream
+  * @param  FrameNbr: frames to mix
+  * @retval None
+  */
+static void Mixer_AddF32(Mixer_StreamTypeDef *pStream, const float *pIn, uint32_t FrameNbr)
+{
+  int32_t *pBus = MixerBus;
+  uint32_t channels = MixerInit.Channels;
+  uint32_t stride   = pStream->Config.Channels;
+  uint32_t inc      = (stride > 1U) ? 1U : 0U;
+  uint32_t frames, f, c;
+  int32_t  gain, step;
+  float    scale, x;
+
+  while(FrameNbr > 0U)
+  {
+    frames = Mixer_GainSpan(&pStream->Gain, FrameNbr);
+    gain   = pStream->Gain.Value;
+    step   = pStream->Gain.Step;
+
+    for(f = 0U; f < frames; f++)
+    {
+      /* Full scale (1.0) at unity gain is 2^30 on the bus */
+      scale = (float)gain * 0.5f;
+      for(c = 0U; c < channels; c++)
+      {
+        x = pIn[c * inc] * scale;
+        if(x > MIXER_F32_LIMIT)
+        {
+          x = MIXER_F32_LIMIT;
+        }
+        else if(x < -MIXER_F32_LIMIT)
+        {
+          x = -MIXER_F32_LIMIT;
+        }
+        pBus[c] = __QADD(pBus[c], (int32_t)x);
+      }
+      pIn  += stride;
+      pBus += channels;
+      gain += step;
+    }
+
+    Mixer_GainAdvance(&pStream->Gain, frames);
+    FrameNbr -= frames;
+  }
+}
+
+/**
+  * @brief  Apply the master gain to the bus and write it in the output format
+  * @param  pOut: output frames
+  * @param  FrameNbr: frames to write
+  * @retval None
+  */
+static void Mixer_Output(void *pOut, uint32_t FrameNbr)
+{
+  const int32_t *pBus = MixerBus;
+  int16_t *pOut16 = (int16_t *)pOut;
+  int32_t *pOut32 = (int32_t *)pOut;
+  uint32_t channels = MixerInit.Channels;
+  uint32_t frames, f, c;
+  int32_t  gain, step, x;
+
+  while(FrameNbr > 0U)
+  {
+    frames = Mixer_GainSpan(&MixerMaster, FrameNbr);
+    gain   = MixerMaster.Value;
+    step   = MixerMaster.Step;
+
+    /* The Q30 bus times the Q31 gain gives full scale at 2^29 */
+    if(MixerInit.Format == AUDIO_MIXER_FORMAT_S16)
+    {
+      for(f = 0U; f < frames; f++)
+      {
+        for(c = 0U; c < channels; c++)
+        {
+          x         = (int32_t)(((int64_t)pBus[c] * gain) >> 32);
+          pOut16[c] = (int16_t)__SSAT(x >> 14, 16);
+        }
+        pBus   += channels;
+        pOut16 += channels;
+        gain   += step;
+      }
+    }
+    else
+    {
+      for(f = 0U; f < frames; f++)
+      {
+        for(c = 0U; c < channels; c++)
+        {
+          x         = (int32_t)(((int64_t)pBus[c] * gain) >> 32);
+          pOut32[c] = __SSAT(x >> 6, 24);
+        }
+        pBus   += channels;
+        pOut32 += channels;
+        gain   += step;
+      }
+    }
+
+    Mixer_GainAdvance(&MixerMaster, frames);
+    FrameNbr -= frames;
+  }
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
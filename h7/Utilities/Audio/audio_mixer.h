@@ -0,0 +1,124 @@
+/**
+  ******************************************************************************
+  * @file    audio_mixer.h
+  * @author  MCD Application Team
+  * @brief   Header for audio_mixer module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _AUDIO_MIXER_H__
+#define _AUDIO_MIXER_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported constants --------------------------------------------------------*/
+/* Number of streams. Override in main.h. */
+#if !defined(AUDIO_MIXER_MAX_STREAMS)
+#define AUDIO_MIXER_MAX_STREAMS    8U
+#endif
+/* Frames mixed in one pass, longer blocks being mixed in several passes.
+   Override in main.h. */
+#if !defined(AUDIO_MIXER_MAX_BLOCK)
+#define AUDIO_MIXER_MAX_BLOCK      128U
+#endif
+/* Largest number of channels per frame. Override in main.h. */
+#if !defined(AUDIO_MIXER_MAX_CHANNELS)
+#define AUDIO_MIXER_MAX_CHANNELS   2U
+#endif
+
+/* Gains are in Q15: 0 mutes, AUDIO_MIXER_GAIN_UNITY leaves the level unchanged */
+#define AUDIO_MIXER_GAIN_UNITY     0x7FFFU
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+  AUDIO_MIXER_FORMAT_S16 = 0U,  /* int16_t samples                                     */
+  AUDIO_MIXER_FORMAT_S24 = 1U,  /* 24-bit samples in the low bits of 32-bit words, as
+                                   the SAI DMA transfers them                          */
+  AUDIO_MIXER_FORMAT_F32 = 2U   /* float samples, full scale at +/-1.0                 */
+} AUDIO_Mixer_FormatTypeDef;
+
+/* Stream source: writes FrameNbr interleaved frames of the stream format in
+   pBuffer and returns the number of frames written. Returning less than
+   FrameNbr ends the stream. A stream at another sample rate runs its sample
+   rate converter (ex. arm_fir_resample_async_f32()) in its source. */
+typedef uint32_t (*AUDIO_Mixer_SourceTypeDef)(void *pContext, void *pBuffer, uint32_t FrameNbr);
+
+typedef struct
+{
+  uint32_t Channels;                /* Channels of the mixer, 1 to AUDIO_MIXER_MAX_CHANNELS */
+  AUDIO_Mixer_FormatTypeDef Format; /* Output format, AUDIO_MIXER_FORMAT_S16 or S24         */
+  uint16_t MasterGain;              /* Gain applied to the mix, Q15                         */
+} AUDIO_Mixer_InitTypeDef;
+
+typedef struct
+{
+  AUDIO_Mixer_SourceTypeDef Source;  /* Called from AUDIO_Mixer_Process() for each pass  */
+  void *pContext;                    /* Passed to Source                                 */
+  AUDIO_Mixer_FormatTypeDef Format;  /* Sample format of the stream                      */
+  uint32_t Channels;                 /* 1 (sent to all the channels) or mixer channels   */
+  uint16_t Gain;                     /* Initial gain, Q15                                */
+} AUDIO_Mixer_StreamTypeDef;
+
+typedef struct
+{
+  uint32_t Frames;      /* Frames mixed                                */
+  uint32_t CyclesLast;  /* CPU cycles of the last AUDIO_Mixer_Process() */
+  uint32_t CyclesMax;   /* Longest AUDIO_Mixer_Process(), in CPU cycles */
+} AUDIO_Mixer_StatsTypeDef;
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef AUDIO_Mixer_Init(const AUDIO_Mixer_InitTypeDef *pInit);
+HAL_StatusTypeDef AUDIO_Mixer_StreamStart(uint32_t Stream, const AUDIO_Mixer_StreamTypeDef *pStream);
+HAL_StatusTypeDef AUDIO_Mixer_StreamStop(uint32_t Stream, uint32_t RampFrames);
+uint32_t          AUDIO_Mixer_IsStreamActive(uint32_t Stream);
+HAL_StatusTypeDef AUDIO_Mixer_SetGain(uint32_t Stream, uint16_t Gain, uint32_t RampFrames);
+HAL_StatusTypeDef AUDIO_Mixer_SetMasterGain(uint16_t Gain, uint32_t RampFrames);
+HAL_StatusTypeDef AUDIO_Mixer_Process(void *pOut, uint32_t FrameNbr);
+void              AUDIO_Mixer_GetStats(AUDIO_Mixer_StatsTypeDef *pStats);
+void              AUDIO_Mixer_ResetStats(void);
+
+void AUDIO_Mixer_StreamEndCallback(uint32_t Stream);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _AUDIO_MIXER_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,942 @@
+/**
+  ******************************************************************************
+  * @file    mic_capture.c
+  * @author  MCD Application Team
+  * @brief   Synchronous multi-microphone PDM capture: DFSDM filters with DMA
+  *          double buffering, or the PDM library where there is no DFSDM
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- with the DFSDM (default when the device has one), each microphone is
+   sampled by its own DFSDM channel and decimated by its own filter, the
+   filter x of microphone x: no CPU time is spent in the PDM to PCM
+   conversion. Two microphones sharing a data line use two channels on the
+   same pins (DFSDM_CHANNEL_FOLLOWING_CHANNEL_PINS for the first one), one
+   on each clock edge.
+   Provide HAL_DFSDM_ChannelMspInit() and HAL_DFSDM_FilterMspInit(): enable
+   the DFSDM clock, configure the CKOUT and DATIN pins, and link to each
+   filter handle a DMA channel in circular mode, word to word, with its
+   interrupt enabled; all the DMA interrupts must share one priority.
+   Call MIC_Capture_DMA_IRQHandler(x) from the DMA interrupt handler of the
+   filter x. The module implements the HAL_DFSDM_FilterXxxCallback()
+   functions, so the DFSDM1 filters are reserved to it.
+
+2- without DFSDM (or with MIC_CAPTURE_USE_PDM_LIB set to 1 in main.h), the
+   PDM bit stream of one or two microphones is received by an I2S master
+   receiver and decimated by the PDM library (pdm2pcm_glo.h), one call per
+   millisecond and microphone. Initialize the I2S (16-bit, audio frequency
+   of AudioFreq * Decimation / 32 for one microphone) with its DMA in
+   circular mode, and call MIC_Capture_DMA_IRQHandler(0) from the DMA
+   interrupt handler. The module implements the HAL_I2S_RxXxxCallback()
+   functions and enables the CRC clock needed by the library.
+
+3- call MIC_Capture_Init() then MIC_Capture_Start(). The capture runs in
+   two halves of FrameNbr frames: while the DMA fills one, the other is
+   converted to 16-bit PCM and handed to MIC_Capture_BlockReadyCallback(),
+   one frame after the other, the samples of a frame in microphone order.
+   The block must be consumed (or copied) before the next one is ready,
+   i.e. within FrameNbr / AudioFreq seconds.
+
+4- on the DFSDM, filter 0 starts the conversions of the other filters
+   (RSYNC) so all microphones are sampled on the same clock edge with the
+   same group delay: the frames are sample-aligned, as needed by delay and
+   sum beamforming or direction of arrival estimation.
+   MIC_Capture_GetFrameCount() tells the number of frames handed to the
+   application since the start, to time stamp the blocks.
+
+5- on the DFSDM, MIC_Capture_StartListen() waits for sound with the CPU
+   free to sleep: filter 0 alone converts microphone 0, its DMA fills a
+   ring of MIC_CAPTURE_PREROLL_FRAMES frames without interrupts, and the
+   analog watchdog of the filter compares each sample with the threshold.
+   Enable the DFSDM filter 0 interrupt and call MIC_Capture_DFSDM_IRQHandler(0)
+   from it, then loop on HAL_PWR_EnterSLEEPMode(): the DFSDM and DMA clocks
+   stay on in sleep mode. The first sample beyond the threshold stops the
+   listening and calls MIC_Capture_WakeCallback(). Start the capture, then
+   get the audio which came before the wake up, oldest first, with
+   MIC_Capture_ReadPreroll(), before the next MIC_Capture_Init().
+   The microphone clock can be lowered for listening by initializing the
+   capture with a lower AudioFreq or Decimation, and initializing it again
+   once the pre-roll is read.
+
+The DFSDM filter order is the highest one (Sinc5 at most) whose output fits
+the 32-bit filter accumulator; the result is then scaled to 16 bits
+according to the decimation ratio and Gain.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "mic_capture.h"
+#include <string.h>
+#if (MIC_CAPTURE_USE_PDM_LIB != 0U)
+#include "pdm2pcm_glo.h"
+#endif
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#if (MIC_CAPTURE_USE_PDM_LIB == 0U)
+/* Bits of the DFSDM filter accumulator */
+#define MIC_FILTER_BITS           31U
+/* Bits of the DFSDM data register, sign included */
+#define MIC_DATA_BITS             24U
+/* Pre-roll ring, in whole data cache lines */
+#define MIC_PREROLL_SIZE          ((MIC_CAPTURE_PREROLL_FRAMES + 7U) & ~7U)
+#else
+/* PDM bytes per microphone and millisecond */
+#define MIC_PDM_MS_BYTES(__FREQ__, __DEC__)  (((__FREQ__) / 1000U) * (__DEC__) / 8U)
+/* PDM buffer half, in 16-bit words */
+#define MIC_PDM_HALF_SIZE  ((MIC_CAPTURE_MAX_FRAMES * MIC_CAPTURE_MAX_DECIMATION * MIC_CAPTURE_MAX_MICS) / 16U)
+/* One millisecond of PDM data at 48 kHz */
+#define MIC_PDM_MS_SIZE    ((48U * MIC_CAPTURE_MAX_DECIMATION * MIC_CAPTURE_MAX_MICS) / 16U)
+#endif
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+#if (MIC_CAPTURE_USE_PDM_LIB == 0U)
+static DFSDM_Channel_HandleTypeDef hMicChannel[MIC_CAPTURE_MAX_MICS];
+static DFSDM_Filter_HandleTypeDef  hMicFilter[MIC_CAPTURE_MAX_MICS];
+
+static DFSDM_Filter_TypeDef * const MicFilterInstance[MIC_CAPTURE_MAX_MICS] =
+{
+  DFSDM1_Filter0,
+  DFSDM1_Filter1,
+#if (MIC_CAPTURE_MAX_MICS > 2U)
+  DFSDM1_Filter2,
+  DFSDM1_Filter3
+#endif
+};
+
+static const uint32_t MicSincOrder[6] =
+{
+  DFSDM_FILTER_FASTSINC_ORDER,  /* not used */
+  DFSDM_FILTER_SINC1_ORDER,
+  DFSDM_FILTER_SINC2_ORDER,
+  DFSDM_FILTER_SINC3_ORDER,
+  DFSDM_FILTER_SINC4_ORDER,
+  DFSDM_FILTER_SINC5_ORDER
+};
+
+/* Filter output, one circular buffer of two halves per microphone */
+static int32_t MicDmaBuffer[MIC_CAPTURE_MAX_MICS][2U * MIC_CAPTURE_MAX_FRAMES] __attribute__((section(".dma_d1"), aligned(32)));
+
+/* Filter 0 output while listening */
+static int32_t MicPreroll[MIC_PREROLL_SIZE] __attribute__((section(".dma_d1"), aligned(32)));
+
+static int32_t  MicShift;        /* Right shift from the 24-bit data to 16 bits */
+static __IO uint32_t MicHalfReady[2]; /* Microphones done with each half        */
+static uint32_t MicPrerollNext;  /* Oldest pre-roll frame not read yet          */
+static uint32_t MicPrerollLeft;  /* Pre-roll frames not read yet                */
+#else
+static PDM_Filter_Handler_t MicPdmHandler[MIC_CAPTURE_MAX_MICS];
+static PDM_Filter_Config_t  MicPdmConfig[MIC_CAPTURE_MAX_MICS];
+
+static uint16_t MicPdmBuffer[2U * MIC_PDM_HALF_SIZE] __attribute__((section(".dma_d1"), aligned(32)));
+static uint16_t MicPdmSwap[MIC_PDM_MS_SIZE];
+
+static uint32_t MicPdmHalfSize;  /* 16-bit words per buffer half    */
+static uint32_t MicPdmMsSize;    /* 16-bit words per millisecond    */
+#endif
+
+static int16_t MicPcm[MIC_CAPTURE_MAX_FRAMES * MIC_CAPTURE_MAX_MICS];
+
+static MIC_Capture_InitTypeDef MicInit;
+static __IO uint32_t MicFrameCount;
+static __IO MIC_Capture_StateTypeDef MicState = MIC_CAPTURE_STATE_RESET;
+
+/* Private function prototypes -----------------------------------------------*/
+static void Mic_BlockDone(uint32_t Half);
+#if (MIC_CAPTURE_USE_PDM_LIB == 0U)
+static void Mic_HalfDone(DFSDM_Filter_HandleTypeDef *hdfsdm_filter, uint32_t Half);
+static int16_t Mic_Scale(int32_t Data);
+#endif
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Initialize the decimation of the microphones
+  * @param  pInit: capture configuration, copied
+  * @retval HAL status
+  */
+HAL_StatusTypeDef MIC_Capture_Init(const MIC_Capture_InitTypeDef *pInit)
+{
+#if (MIC_CAPTURE_USE_PDM_LIB == 0U)
+  uint32_t divider;
+  uint32_t bits;
+  uint32_t log2;
+  uint32_t order;
+  uint32_t shift;
+  uint32_t mic;
+
+  if((MicState == MIC_CAPTURE_STATE_BUSY) || (pInit == NULL) ||
+     (pInit->MicNbr == 0U) || (pInit->MicNbr > MIC_CAPTURE_MAX_MICS) ||
+     (pInit->FrameNbr == 0U) || (pInit->FrameNbr > MIC_CAPTURE_MAX_FRAMES) ||
+     (pInit->AudioFreq == 0U) || (pInit->Decimation < 16U) || (pInit->Decimation > 256U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* The DFSDM clock is divided down to the microphone clock */
+  divider = pInit->ClockFreq / (pInit->AudioFreq * pInit->Decimation);
+  if((divider < 2U) || (divider > 256U) ||
+     ((divider * pInit->AudioFreq * pInit->Decimation) != pInit->ClockFreq))
+  {
+    return HAL_ERROR;
+  }
+
+  if(MicState != MIC_CAPTURE_STATE_RESET)
+  {
+    (void)MIC_Capture_DeInit();
+  }
+  MicInit = *pInit;
+
+  /* A SincN filter of ratio D gives D^N for a full scale input: highest
+     order whose output fits in the accumulator */
+  log2 = 0U;
+  while((1UL << log2) < pInit->Decimation)
+  {
+    log2++;
+  }
+  order = 5U;
+  while((order * log2) > MIC_FILTER_BITS)
+  {
+    order--;
+  }
+  bits = order * log2;
+
+  /* The channel shifts right what does not fit in the data register */
+  shift = (bits > (MIC_DATA_BITS - 1U)) ? (bits - (MIC_DATA_BITS - 1U)) : 0U;
+  bits -= shift;
+
+  /* then the 24-bit data is scaled to 16 bits, less the gain */
+  MicShift = (int32_t)bits - 15 - pInit->Gain;
+  if(MicShift < -7)
+  {
+    return HAL_ERROR;
+  }
+
+  for(mic = 0U; mic < pInit->MicNbr; mic++)
+  {
+    hMicChannel[mic].Instance                      = pInit->Mic[mic].Channel;
+    hMicChannel[mic].Init.OutputClock.Activation   = ENABLE;
+    hMicChannel[mic].Init.OutputClock.Selection    = pInit->ClockSource;
+    hMicChannel[mic].Init.OutputClock.Divider      = divider;
+    hMicChannel[mic].Init.Input.Multiplexer        = DFSDM_CHANNEL_EXTERNAL_INPUTS;
+    hMicChannel[mic].Init.Input.DataPacking        = DFSDM_CHANNEL_STANDARD_MODE;
+    hMicChannel[mic].Init.Input.Pins               = pInit->Mic[mic].Pins;
+    hMicChannel[mic].Init.SerialInterface.Type     = pInit->Mic[mic].Edge;
+    hMicChannel[mic].Init.SerialInterface.SpiClock = DFSDM_CHANNEL_SPI_CLOCK_INTERNAL;
+    hMicChannel[mic].Init.Awd.FilterOrder          = DFSDM_CHANNEL_SINC1_ORDER;
+    hMicChannel[mic].Init.Awd.Oversampling         = 10U;
+    hMicChannel[mic].Init.Offset                   = 0;
+    hMicChannel[mic].Init.RightBitShift            = shift;
+    if(HAL_DFSDM_ChannelInit(&hMicChannel[mic]) != HAL_OK)
+    {
+      (void)MIC_Capture_DeInit();
+      return HAL_ERROR;
+    }
+
+    /* Filter 0 is started by software, it starts the others */
+    hMicFilter[mic].Instance                          = MicFilterInstance[mic];
+    hMicFilter[mic].Init.RegularParam.Trigger         = (mic == 0U) ? DFSDM_FILTER_SW_TRIGGER : DFSDM_FILTER_SYNC_TRIGGER;
+    hMicFilter[mic].Init.RegularParam.FastMode        = ENABLE;
+    hMicFilter[mic].Init.RegularParam.DmaMode         = ENABLE;
+    hMicFilter[mic].Init.InjectedParam.Trigger        = DFSDM_FILTER_SW_TRIGGER;
+    hMicFilter[mic].Init.InjectedParam.ScanMode       = DISABLE;
+    hMicFilter[mic].Init.InjectedParam.DmaMode        = DISABLE;
+    hMicFilter[mic].Init.InjectedParam.ExtTrigger     = DFSDM_FILTER_EXT_TRIG_TIM1_TRGO;
+    hMicFilter[mic].Init.InjectedParam.ExtTriggerEdge = DFSDM_FILTER_EXT_TRIG_RISING_EDGE;
+    hMicFilter[mic].Init.FilterParam.SincOrder        = MicSincOrder[order];
+    hMicFilter[mic].Init.FilterParam.Oversampling     = pInit->Decimation;
+    hMicFilter[mic].Init.FilterParam.IntOversampling  = 1U;
+    if(HAL_DFSDM_FilterInit(&hMicFilter[mic]) != HAL_OK)
+    {
+      (void)MIC_Capture_DeInit();
+      return HAL_ERROR;
+    }
+
+    if(HAL_DFSDM_FilterConfigRegChannel(&hMicFilter[mic], pInit->Mic[mic].ChannelSel,
+                                        DFSDM_CONTINUOUS_CONV_ON) != HAL_OK)
+    {
+      (void)MIC_Capture_DeInit();
+      return HAL_ERROR;
+    }
+  }
+#else
+  uint32_t decimation;
+  int32_t  gain;
+  uint32_t mic;
+
+  if((MicState == MIC_CAPTURE_STATE_BUSY) || (pInit == NULL) || (pInit->hi2s == NULL) ||
+     (pInit->MicNbr == 0U) || (pInit->MicNbr > MIC_CAPTURE_MAX_MICS) ||
+     (pInit->AudioFreq < 1000U) || (pInit->AudioFreq > 48000U) ||
+     (pInit->FrameNbr == 0U) || (pInit->FrameNbr > MIC_CAPTURE_MAX_FRAMES) ||
+     ((pInit->FrameNbr % (pInit->AudioFreq / 1000U)) != 0U) ||
+     (pInit->Decimation > MIC_CAPTURE_MAX_DECIMATION))
+  {
+    return HAL_ERROR;
+  }
+
+  switch(pInit->Decimation)
+  {
+  case 16U:  decimation = PDM_FILTER_DEC_FACTOR_16;  break;
+  case 24U:  decimation = PDM_FILTER_DEC_FACTOR_24;  break;
+  case 32U:  decimation = PDM_FILTER_DEC_FACTOR_32;  break;
+  case 48U:  decimation = PDM_FILTER_DEC_FACTOR_48;  break;
+  case 64U:  decimation = PDM_FILTER_DEC_FACTOR_64;  break;
+  case 80U:  decimation = PDM_FILTER_DEC_FACTOR_80;  break;
+  case 128U: decimation = PDM_FILTER_DEC_FACTOR_128; break;
+  default:   return HAL_ERROR;
+  }
+
+  MicInit = *pInit;
+  MicPdmMsSize   = (MIC_PDM_MS_BYTES(pInit->AudioFreq, pInit->Decimation) * pInit->MicNbr) / 2U;
+  MicPdmHalfSize = MicPdmMsSize * (pInit->FrameNbr / (pInit->AudioFreq / 1000U));
+
+  /* The library takes the gain in dB, from -12 to +51 */
+  gain = pInit->Gain * 6;
+  gain = (gain < -12) ? -12 : ((gain > 51) ? 51 : gain);
+
+  /* Enable CRC peripheral to unlock the PDM library */
+  __HAL_RCC_CRC_CLK_ENABLE();
+
+  for(mic = 0U; mic < pInit->MicNbr; mic++)
+  {
+    MicPdmHandler[mic].bit_order        = PDM_FILTER_BIT_ORDER_LSB;
+    MicPdmHandler[mic].endianness       = PDM_FILTER_ENDIANNESS_LE;
+    MicPdmHandler[mic].high_pass_tap    = 2122358088U;
+    MicPdmHandler[mic].in_ptr_channels  = (uint16_t)pInit->MicNbr;
+    MicPdmHandler[mic].out_ptr_channels = (uint16_t)pInit->MicNbr;
+    if(PDM_Filter_Init(&MicPdmHandler[mic]) != 0U)
+    {
+      return HAL_ERROR;
+    }
+
+    MicPdmConfig[mic].output_samples_number = (uint16_t)(pInit->AudioFreq / 1000U);
+    MicPdmConfig[mic].mic_gain              = (int16_t)gain;
+    MicPdmConfig[mic].decimation_factor     = (uint16_t)decimation;
+    if(PDM_Filter_setConfig(&MicPdmHandler[mic], &MicPdmConfig[mic]) != 0U)
+    {
+      return HAL_ERROR;
+    }
+  }
+#endif
+
+  MicState = MIC_CAPTURE_STATE_READY;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Release the decimation filters
+  * @param  None
+  * @retval HAL status
+  */
+HAL_StatusTypeDef MIC_Capture_DeInit(void)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+#if (MIC_CAPTURE_USE_PDM_LIB == 0U)
+  uint32_t mic;
+#endif
+
+  if(MicState == MIC_CAPTURE_STATE_BUSY)
+  {
+    (void)MIC_Capture_Stop();
+  }
+
+#if (MIC_CAPTURE_USE_PDM_LIB == 0U)
+  if(MicState == MIC_CAPTURE_STATE_LISTEN)
+  {
+    (void)MIC_Capture_StopListen();
+  }
+
+  for(mic = 0U; mic < MicInit.MicNbr; mic++)
+  {
+    if(hMicFilter[mic].State != HAL_DFSDM_FILTER_STATE_RESET)
+    {
+      if(HAL_DFSDM_FilterDeInit(&hMicFilter[mic]) != HAL_OK)
+      {
+        status = HAL_ERROR;
+      }
+    }
+    if(hMicChannel[mic].State != HAL_DFSDM_CHANNEL_STATE_RESET)
+    {
+      if(HAL_DFSDM_ChannelDeInit(&hMicChannel[mic]) != HAL_OK)
+      {
+        status = HAL_ERROR;
+      }
+    }
+  }
+#endif
+
+  MicState = MIC_CAPTURE_STATE_RESET;
+
+  return status;
+}
+
+/**
+  * @brief  Start the synchronous capture of all the microphones
+  * @param  None
+  * @retval HAL status
+  */
+HAL_StatusTypeDef MIC_Capture_Start(void)
+{
+#if (MIC_CAPTURE_USE_PDM_LIB == 0U)
+  uint32_t mic;
+#endif
+
+  if(MicState != MIC_CAPTURE_STATE_READY)
+  {
+    return HAL_ERROR;
+  }
+
+  MicFrameCount = 0U;
+  MicState = MIC_CAPTURE_STATE_BUSY;
+
+#if (MIC_CAPTURE_USE_PDM_LIB == 0U)
+  MicHalfReady[0] = 0U;
+  MicHalfReady[1] = 0U;
+
+  /* The synchronous filters wait for filter 0, started last */
+  mic = MicInit.MicNbr;
+  while(mic > 0U)
+  {
+    mic--;
+    if(HAL_DFSDM_FilterRegularStart_DMA(&hMicFilter[mic], MicDmaBuffer[mic],
+                                        2U * MicInit.FrameNbr) != HAL_OK)
+    {
+      (void)MIC_Capture_Stop();
+      MicState = MIC_CAPTURE_STATE_ERROR;
+      return HAL_ERROR;
+    }
+  }
+#else
+  if(HAL_I2S_Receive_DMA(MicInit.hi2s, MicPdmBuffer, (uint16_t)(2U * MicPdmHalfSize)) != HAL_OK)
+  {
+    MicState = MIC_CAPTURE_STATE_ERROR;
+    return HAL_ERROR;
+  }
+#endif
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the capture
+  * @param  None
+  * @retval HAL status
+  */
+HAL_StatusTypeDef MIC_Capture_Stop(void)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+#if (MIC_CAPTURE_USE_PDM_LIB == 0U)
+  uint32_t mic;
+
+  /* Stopping filter 0 first stops the conversions of all the filters */
+  for(mic = 0U; mic < MicInit.MicNbr; mic++)
+  {
+    if(hMicFilter[mic].State != HAL_DFSDM_FILTER_STATE_READY)
+    {
+      if(HAL_DFSDM_FilterRegularStop_DMA(&hMicFilter[mic]) != HAL_OK)
+      {
+        status = HAL_ERROR;
+      }
+    }
+  }
+#else
+  status = HAL_I2S_DMAStop(MicInit.hi2s);
+#endif
+
+  if(MicState != MIC_CAPTURE_STATE_RESET)
+  {
+    MicState = MIC_CAPTURE_STATE_READY;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Return the capture state
+  * @param  None
+  * @retval Capture state
+  */
+MIC_Capture_StateTypeDef MIC_Capture_GetState(void)
+{
+  return MicState;
+}
+
+/**
+  * @brief  Return the number of frames handed to the application since the
+  *         capture was started
+  * @param  None
+  * @retval Frame count, wraps around
+  */
+uint32_t MIC_Capture_GetFrameCount(void)
+{
+  return MicFrameCount;
+}
+
+/**
+  * @brief  Handle the DMA interrupt of a microphone
+  * @param  Mic: microphone (DFSDM filter) index, 0 with the PDM library
+  * @retval None
+  */
+void MIC_Capture_DMA_IRQHandler(uint32_t Mic)
+{
+#if (MIC_CAPTURE_USE_PDM_LIB == 0U)
+  if(Mic < MIC_CAPTURE_MAX_MICS)
+  {
+    HAL_DMA_IRQHandler(hMicFilter[Mic].hdmaReg);
+  }
+#else
+  (void)Mic;
+  HAL_DMA_IRQHandler(MicInit.hi2s->hdmarx);
+#endif
+}
+
+#if (MIC_CAPTURE_USE_PDM_LIB == 0U)
+/**
+  * @brief  Handle the DFSDM filter interrupt of a microphone (overrun, and
+  *         analog watchdog of filter 0 while listening)
+  * @param  Mic: microphone (DFSDM filter) index
+  * @retval None
+  */
+void MIC_Capture_DFSDM_IRQHandler(uint32_t Mic)
+{
+  if(Mic < MIC_CAPTURE_MAX_MICS)
+  {
+    HAL_DFSDM_IRQHandler(&hMicFilter[Mic]);
+  }
+}
+
+/**
+  * @brief  Wait for sound on microphone 0, keeping the last frames
+  * @param  Threshold: wake up level, in 16-bit PCM units, reached by a
+  *         positive or a negative sample
+  * @retval HAL status
+  */
+HAL_StatusTypeDef MIC_Capture_StartListen(uint16_t Threshold)
+{
+  DFSDM_Filter_AwdParamTypeDef awd;
+  int32_t level;
+
+  if(MicState != MIC_CAPTURE_STATE_READY)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Threshold on the 24-bit filter data, scaled down by MicShift to 16 bits */
+  level = (MicShift >= 0) ? ((int32_t)Threshold << (uint32_t)MicShift)
+                          : ((int32_t)Threshold >> (uint32_t)(-MicShift));
+  if(level > 0x7FFFFF)
+  {
+    level = 0x7FFFFF;
+  }
+
+  /* The ring is silent until the DMA reaches each frame */
+  memset(MicPreroll, 0, sizeof(MicPreroll));
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    SCB_CleanDCache_by_Addr((uint32_t *)MicPreroll, (int32_t)sizeof(MicPreroll));
+  }
+#endif
+  MicPrerollLeft = 0U;
+
+  awd.DataSource      = DFSDM_FILTER_AWD_FILTER_DATA;
+  awd.Channel         = MicInit.Mic[0].ChannelSel;
+  awd.HighThreshold   = level;
+  awd.LowThreshold    = -level;
+  awd.HighBreakSignal = DFSDM_NO_BREAK_SIGNAL;
+  awd.LowBreakSignal  = DFSDM_NO_BREAK_SIGNAL;
+  if(HAL_DFSDM_FilterAwdStart_IT(&hMicFilter[0], &awd) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  MicState = MIC_CAPTURE_STATE_LISTEN;
+
+  /* Filter 0 alone: the synchronous filters are not started */
+  if(HAL_DFSDM_FilterRegularStart_DMA(&hMicFilter[0], MicPreroll, MIC_PREROLL_SIZE) != HAL_OK)
+  {
+    (void)HAL_DFSDM_FilterAwdStop_IT(&hMicFilter[0]);
+    MicState = MIC_CAPTURE_STATE_READY;
+    return HAL_ERROR;
+  }
+  /* Only the watchdog wakes the CPU up */
+  __HAL_DMA_DISABLE_IT(hMicFilter[0].hdmaReg, DMA_IT_HT | DMA_IT_TC);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop listening, the last frames being kept for
+  *         MIC_Capture_ReadPreroll()
+  * @param  None
+  * @retval HAL status
+  */
+HAL_StatusTypeDef MIC_Capture_StopListen(void)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t next;
+
+  if(MicState != MIC_CAPTURE_STATE_LISTEN)
+  {
+    return HAL_ERROR;
+  }
+
+  /* The frame the DMA writes next is the oldest one */
+  next = MIC_PREROLL_SIZE - __HAL_DMA_GET_COUNTER(hMicFilter[0].hdmaReg);
+
+  if(HAL_DFSDM_FilterRegularStop_DMA(&hMicFilter[0]) != HAL_OK)
+  {
+    status = HAL_ERROR;
+  }
+  if(HAL_DFSDM_FilterAwdStop_IT(&hMicFilter[0]) != HAL_OK)
+  {
+    status = HAL_ERROR;
+  }
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  /* The DMA wrote behind the data cache */
+  if((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    SCB_InvalidateDCache_by_Addr((uint32_t *)MicPreroll, (int32_t)sizeof(MicPreroll));
+  }
+#endif
+
+  MicPrerollNext = (next < MIC_PREROLL_SIZE) ? next : 0U;
+  MicPrerollLeft = MIC_PREROLL_SIZE;
+  MicState = MIC_CAPTURE_STATE_READY;
+
+  return status;
+}
+
+/**
+  * @brief  Read the frames of microphone 0 recorded before the end of the
+  *         listening, oldest first
+  * @param  pPcm: 16-bit PCM samples
+  * @param  FrameNbr: largest number of frames to read
+  * @retval Frames read, 0 once the whole pre-roll was read
+  */
+uint32_t MIC_Capture_ReadPreroll(int16_t *pPcm, uint32_t FrameNbr)
+{
+  uint32_t count = (FrameNbr < MicPrerollLeft) ? FrameNbr : MicPrerollLeft;
+  uint32_t frame;
+
+  if((pPcm == NULL) || (MicState == MIC_CAPTURE_STATE_LISTEN))
+  {
+    return 0U;
+  }
+
+  for(frame = 0U; frame < count; frame++)
+  {
+    pPcm[frame] = Mic_Scale(MicPreroll[MicPrerollNext]);
+    MicPrerollNext++;
+    if(MicPrerollNext == MIC_PREROLL_SIZE)
+    {
+      MicPrerollNext = 0U;
+    }
+  }
+  MicPrerollLeft -= count;
+
+  return count;
+}
+#endif
+
+/**
+  * @brief  A block of PCM frames is ready
+  * @param  pPcm: FrameNbr frames of MicNbr samples, valid until the next block
+  * @param  FrameNbr: number of frames
+  * @retval None
+  */
+__weak void MIC_Capture_BlockReadyCallback(const int16_t *pPcm, uint32_t FrameNbr)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(pPcm);
+  UNUSED(FrameNbr);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the MIC_Capture_BlockReadyCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  The capture stopped on an error
+  * @param  None
+  * @retval None
+  */
+__weak void MIC_Capture_ErrorCallback(void)
+{
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the MIC_Capture_ErrorCallback could be implemented in the user file
+   */
+}
+
+#if (MIC_CAPTURE_USE_PDM_LIB == 0U)
+/**
+  * @brief  Sound was heard: the listening stopped, the pre-roll is ready
+  * @param  None
+  * @retval None
+  */
+__weak void MIC_Capture_WakeCallback(void)
+{
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the MIC_Capture_WakeCallback could be implemented in the user file
+   */
+}
+#endif
+
+#if (MIC_CAPTURE_USE_PDM_LIB == 0U)
+/**
+  * @brief  Regular conversion complete callback: second half filled
+  * @param  hdfsdm_filter: DFSDM filter handle
+  * @retval None
+  */
+void HAL_DFSDM_FilterRegConvCpltCallback(DFSDM_Filter_HandleTypeDef *hdfsdm_filter)
+{
+  Mic_HalfDone(hdfsdm_filter, 1U);
+}
+
+/**
+  * @brief  Half regular conversion complete callback: first half filled
+  * @param  hdfsdm_filter: DFSDM filter handle
+  * @retval None
+  */
+void HAL_DFSDM_FilterRegConvHalfCpltCallback(DFSDM_Filter_HandleTypeDef *hdfsdm_filter)
+{
+  Mic_HalfDone(hdfsdm_filter, 0U);
+}
+
+/**
+  * @brief  DFSDM error callback (regular overrun or DMA error)
+  * @param  hdfsdm_filter: DFSDM filter handle
+  * @retval None
+  */
+void HAL_DFSDM_FilterErrorCallback(DFSDM_Filter_HandleTypeDef *hdfsdm_filter)
+{
+  UNUSED(hdfsdm_filter);
+
+  MicState = MIC_CAPTURE_STATE_ERROR;
+  MIC_Capture_ErrorCallback();
+}
+
+/**
+  * @brief  Analog watchdog callback: a sample of filter 0 crossed the
+  *         listening threshold
+  * @param  hdfsdm_filter: DFSDM filter handle
+  * @param  Channel: channel of the sample
+  * @param  Threshold: DFSDM_AWD_HIGH_THRESHOLD or DFSDM_AWD_LOW_THRESHOLD
+  * @retval None
+  */
+void HAL_DFSDM_FilterAwdCallback(DFSDM_Filter_HandleTypeDef *hdfsdm_filter, uint32_t Channel, uint32_t Threshold)
+{
+  UNUSED(Channel);
+  UNUSED(Threshold);
+
+  if((hdfsdm_filter == &hMicFilter[0]) && (MicState == MIC_CAPTURE_STATE_LISTEN))
+  {
+    (void)MIC_Capture_StopListen();
+    MIC_Capture_WakeCallback();
+  }
+}
+
+/**
+  * @brief  Record that a filter filled a half, convert it once all did
+  * @param  hdfsdm_filter: DFSDM filter handle
+  * @param  Half: buffer half filled, 0 or 1
+  * @retval None
+  */
+static void Mic_HalfDone(DFSDM_Filter_HandleTypeDef *hdfsdm_filter, uint32_t Half)
+{
+  uint32_t mic = (uint32_t)(hdfsdm_filter - hMicFilter);
+
+  if(mic >= MicInit.MicNbr)
+  {
+    return;
+  }
+
+  /* The DMA interrupts share one priority: this cannot be preempted by the
+     callback of another filter */
+  MicHalfReady[Half] |= (1UL << mic);
+  if(MicHalfReady[Half] == ((1UL << MicInit.MicNbr) - 1U))
+  {
+    MicHalfReady[Half] = 0U;
+    Mic_BlockDone(Half);
+  }
+}
+
+/**
+  * @brief  Convert a DMA half of all the microphones to interleaved PCM
+  * @param  Half: buffer half, 0 or 1
+  * @retval None
+  */
+static void Mic_BlockDone(uint32_t Half)
+{
+  const int32_t *pSrc;
+  int16_t *pDst;
+  uint32_t mic;
+  uint32_t frame;
+
+  for(mic = 0U; mic < MicInit.MicNbr; mic++)
+  {
+    pSrc = &MicDmaBuffer[mic][Half * MicInit.FrameNbr];
+    pDst = &MicPcm[mic];
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    /* The DMA wrote behind the data cache */
+    if((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+    {
+      SCB_InvalidateDCache_by_Addr((uint32_t *)((uint32_t)pSrc & ~31U),
+                                   (int32_t)(MicInit.FrameNbr * 4U) + 32);
+    }
+#endif
+
+    for(frame = 0U; frame < MicInit.FrameNbr; frame++)
+    {
+      *pDst = Mic_Scale(pSrc[frame]);
+      pDst += MicInit.MicNbr;
+    }
+  }
+
+  MicFrameCount += MicInit.FrameNbr;
+  MIC_Capture_BlockReadyCallback(MicPcm, MicInit.FrameNbr);
+}
+
+/**
+  * @brief  Scale a DFSDM data register value to 16-bit PCM
+  * @param  Data: filter output, 24-bit data in the 24 MSB
+  * @retval PCM sample
+  */
+static int16_t Mic_Scale(int32_t Data)
+{
+  int32_t sample = Data >> 8;
+
+  if(MicShift >= 0)
+  {
+    sample >>= MicShift;
+  }
+  else
+  {
+    sample *= (int32_t)(1UL << (uint32_t)(-MicShift));
+  }
+  return (int16_t)__SSAT(sample, 16U);
+}
+
+#else /* MIC_CAPTURE_USE_PDM_LIB */
+
+/**
+  * @brief  Rx transfer complete callback: second half filled
+  * @param  hi2s: I2S handle
+  * @retval None
+  */
+void HAL_I2S_RxCpltCallback(I2S_HandleTypeDef *hi2s)
+{
+  if(hi2s == MicInit.hi2s)
+  {
+    Mic_BlockDone(1U);
+  }
+}
+
+/**
+  * @brief  Rx transfer half complete callback: first half filled
+  * @param  hi2s: I2S handle
+  * @retval None
+  */
+void HAL_I2S_RxHalfCpltCallback(I2S_HandleTypeDef *hi2s)
+{
+  if(hi2s == MicInit.hi2s)
+  {
+    Mic_BlockDone(0U);
+  }
+}
+
+/**
+  * @brief  I2S error callback
+  * @param  hi2s: I2S handle
+  * @retval None
+  */
+void HAL_I2S_ErrorCallback(I2S_HandleTypeDef *hi2s)
+{
+  if(hi2s == MicInit.hi2s)
+  {
+    MicState = MIC_CAPTURE_STATE_ERROR;
+    MIC_Capture_ErrorCallback();
+  }
+}
+
+/**
+  * @brief  Decimate a PDM half of all the microphones to interleaved PCM
+  * @param  Half: buffer half, 0 or 1
+  * @retval None
+  */
+static void Mic_BlockDone(uint32_t Half)
+{
+  const uint16_t *pSrc = &MicPdmBuffer[Half * MicPdmHalfSize];
+  int16_t *pDst = MicPcm;
+  uint32_t msFrames = MicInit.AudioFreq / 1000U;
+  uint32_t ms;
+  uint32_t index;
+  uint32_t mic;
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  /* The DMA wrote behind the data cache */
+  if((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    SCB_InvalidateDCache_by_Addr((uint32_t *)((uint32_t)pSrc & ~31U),
+                                 (int32_t)(MicPdmHalfSize * 2U) + 32);
+  }
+#endif
+
+  for(ms = 0U; ms < (MicInit.FrameNbr / msFrames); ms++)
+  {
+    /* The I2S receives the bit stream MSB first */
+    for(index = 0U; index < MicPdmMsSize; index++)
+    {
+      MicPdmSwap[index] = (uint16_t)__REV16(pSrc[index]);
+    }
+    pSrc += MicPdmMsSize;
+
+    /* The microphones are interleaved byte by byte */
+    for(mic = 0U; mic < MicInit.MicNbr; mic++)
+    {
+      (void)PDM_Filter(&((uint8_t *)MicPdmSwap)[mic], &pDst[mic], &MicPdmHandler[mic]);
+    }
+    pDst += msFrames * MicInit.MicNbr;
+  }
+
+  MicFrameCount += MicInit.FrameNbr;
+  MIC_Capture_BlockReadyCallback(MicPcm, MicInit.FrameNbr);
+}
+
+#endif /* MIC_CAPTURE_USE_PDM_LIB */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,783 @@
+/**
+  ******************************************************************************
+  * @file    sai_array.c
+  * @author  MCD Application Team
+  * @brief   Capture of several synchronous TDM SAI receivers aggregated in
+  *          one interleaved, timestamped multichannel block per period
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- initialize each SAI block as a TDM receiver (SAI_MODEMASTER_RX or
+   SAI_MODESLAVE_RX), all with the same data size and frame rate:
+     - hsai[0], the reference, asynchronous: master generating the clocks
+       of the array, or slave of an external clock
+     - the other block of the same SAI as SAI_SYNCHRONOUS slave
+     - the blocks of the other SAIs as SAI_SYNCHRONOUS_EXT_SAIx slaves of
+       the SAI of the reference, initialized with SynchroExt set to
+       SAI_SYNCEXT_OUTBLOCKA_ENABLE (or _OUTBLOCKB_) to export its clocks
+   Blocks slaves of an external clock may also be all asynchronous.
+   Do not link the BSP audio driver nor audio_duplex: this module
+   implements the HAL_SAI_RxXxxCallback() and HAL_SAI_ErrorCallback()
+   functions in their place.
+   In HAL_SAI_MspInit(), link to each block a DMA stream in circular mode,
+   half-word (16-bit data) or word (24 or 32-bit data) on both sides, with
+   its interrupt enabled; the DMA interrupts must share one priority.
+   SAI4 is not supported: its BDMA does not reach the capture buffers.
+
+2- call SAI_Array_DMA_IRQHandler() from the DMA interrupt handler of each
+   block with the block index, and SAI_Array_SAI_IRQHandler() from the SAI
+   ones to be told of FIFO overruns.
+
+3- call SAI_Array_Init() with the channel map: each output channel takes
+   one active slot of one block, in any order. Then SAI_Array_Start():
+   the slaves are started first and wait for the frame clock of the
+   reference, started last, so that all blocks receive the same first
+   frame. The frame offsets of the blocks against the reference are
+   measured on their DMA pointers when the first period is complete and
+   compensated for the whole capture: blocks running on an external clock,
+   started on different frames, are aligned as well. An offset over a
+   quarter of the period stops the capture with SAI_ARRAY_STATE_ERROR.
+
+4- each period, from the reference DMA interrupt only, the samples of all
+   blocks are gathered in one pass into an interleaved block of Channels
+   samples per frame (16-bit samples packed by pairs with PKHBT) and
+   handed to SAI_Array_BlockCallback() with its frame index and the DWT
+   cycle count of its last frame. The block stays valid for one more
+   period. The DMA interrupts of the other blocks only report errors: the
+   skew of their callbacks does not matter.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "sai_array.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Smallest period: larger than the SAI FIFO and the offsets compensated */
+#define ARRAY_MIN_FRAMES      16U
+/* Largest DMA transfer, in samples */
+#define ARRAY_MAX_TRANSFER    0xFFFFU
+
+/* Private macro -------------------------------------------------------------*/
+/* Samples of one block in its circular buffer */
+#define ARRAY_BLOCK_SIZE(__BLOCK__)  (2U * ArrayInit.FrameNbr * ArraySlots[__BLOCK__])
+
+/* Private variables ---------------------------------------------------------*/
+static uint32_t ArrayRxBuffer[SAI_ARRAY_MAX_BLOCKS][2U * SAI_ARRAY_MAX_FRAMES * SAI_ARRAY_MAX_SLOTS] __attribute__((section(".dma_d1"), aligned(32)));
+static uint32_t ArrayOutBuffer[2U][SAI_ARRAY_MAX_FRAMES * SAI_ARRAY_MAX_CHANNELS];
+
+static SAI_Array_InitTypeDef  ArrayInit;
+static SAI_Array_StatsTypeDef ArrayStats;
+static uint32_t ArraySlots[SAI_ARRAY_MAX_BLOCKS];   /* Samples per frame of each block          */
+static uint32_t ArrayOffset[SAI_ARRAY_MAX_BLOCKS];  /* Offset of each block, modulo 2 periods   */
+static uint32_t ArraySampleSize;                    /* Bytes per sample, 2 or 4                 */
+static uint32_t ArrayAligned;                       /* Offsets measured                         */
+static uint32_t ArrayOut;                           /* Output buffer filled next                */
+static uint64_t ArrayFrameIndex;                    /* Index of the first frame of the period   */
+static __IO SAI_Array_StateTypeDef ArrayState = SAI_ARRAY_STATE_RESET;
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t     Array_SlotCount(const SAI_HandleTypeDef *hsai);
+static SAI_TypeDef *Array_Parent(const SAI_Block_TypeDef *pBlock);
+static HAL_StatusTypeDef Array_CheckChain(const SAI_Array_InitTypeDef *pInit);
+static HAL_StatusTypeDef Array_Align(void);
+static void Array_Process(uint32_t Half);
+static void Array_Invalidate(uint32_t Block, uint32_t Frame);
+static void Array_Remap16(uint32_t First, uint32_t *pOut);
+static void Array_Remap32(uint32_t First, int32_t *pOut);
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Initialize the aggregation of initialized SAI receivers
+  * @param  pInit: blocks, period and channel map, copied
+  * @retval HAL status
+  */
+HAL_StatusTypeDef SAI_Array_Init(const SAI_Array_InitTypeDef *pInit)
+{
+  uint32_t b;
+  uint32_t c;
+  uint32_t size;
+
+  if((ArrayState == SAI_ARRAY_STATE_BUSY) || (pInit == NULL) ||
+     (pInit->BlockNbr == 0U) || (pInit->BlockNbr > SAI_ARRAY_MAX_BLOCKS) ||
+     (pInit->AudioFreq == 0U) ||
+     (pInit->FrameNbr < ARRAY_MIN_FRAMES) || (pInit->FrameNbr > SAI_ARRAY_MAX_FRAMES) ||
+     (pInit->Channels == 0U) || (pInit->Channels > SAI_ARRAY_MAX_CHANNELS))
+  {
+    return HAL_ERROR;
+  }
+
+  ArraySampleSize = 0U;
+  for(b = 0U; b < pInit->BlockNbr; b++)
+  {
+    if((pInit->hsai[b] == NULL) || (pInit->hsai[b]->hdmarx == NULL))
+    {
+      return HAL_ERROR;
+    }
+
+    switch(pInit->hsai[b]->Init.DataSize)
+    {
+      case SAI_DATASIZE_16:
+        size = 2U;
+        break;
+      case SAI_DATASIZE_24:
+      case SAI_DATASIZE_32:
+        size = 4U;
+        break;
+      default:
+        return HAL_ERROR;
+    }
+    if((ArraySampleSize != 0U) && (size != ArraySampleSize))
+    {
+      return HAL_ERROR;
+    }
+    ArraySampleSize = size;
+
+    ArraySlots[b] = Array_SlotCount(pInit->hsai[b]);
+    if((ArraySlots[b] == 0U) || (ArraySlots[b] > SAI_ARRAY_MAX_SLOTS) ||
+       ((2U * pInit->FrameNbr * ArraySlots[b]) > ARRAY_MAX_TRANSFER))
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  /* Pairs of 16-bit samples are written in one word */
+  if((ArraySampleSize == 2U) && ((pInit->Channels % 2U) != 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  for(c = 0U; c < pInit->Channels; c++)
+  {
+    if((pInit->Map[c].Block >= pInit->BlockNbr) ||
+       (pInit->Map[c].Slot >= ArraySlots[pInit->Map[c].Block]))
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  if(Array_CheckChain(pInit) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  ArrayInit = *pInit;
+
+  /* Enable the DWT cycle counter to timestamp the periods */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#if (__CORTEX_M == 7U)
+  DWT->LAR = 0xC5ACCE55U;
+#endif
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  memset(&ArrayStats, 0, sizeof(ArrayStats));
+  ArrayState = SAI_ARRAY_STATE_READY;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Release the aggregation, the SAI blocks are left initialized
+  * @param  None
+  * @retval HAL status
+  */
+HAL_StatusTypeDef SAI_Array_DeInit(void)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if(ArrayState == SAI_ARRAY_STATE_BUSY)
+  {
+    status = SAI_Array_Stop();
+  }
+  ArrayState = SAI_ARRAY_STATE_RESET;
+
+  return status;
+}
+
+/**
+  * @brief  Start all the blocks on the same frame
+  * @param  None
+  * @retval HAL status
+  */
+HAL_StatusTypeDef SAI_Array_Start(void)
+{
+  uint32_t b;
+
+  if(ArrayState != SAI_ARRAY_STATE_READY)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Frames before the start of a late block read as silence. The lines
+     written here are cleaned before the DMA writes behind them. */
+  memset(ArrayRxBuffer, 0, sizeof(ArrayRxBuffer));
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    SCB_CleanDCache_by_Addr((uint32_t *)ArrayRxBuffer, (int32_t)sizeof(ArrayRxBuffer));
+  }
+#endif
+
+  memset(&ArrayStats, 0, sizeof(ArrayStats));
+  ArrayStats.CyclesBudget = (uint32_t)(((uint64_t)SystemCoreClock * ArrayInit.FrameNbr) / ArrayInit.AudioFreq);
+  ArrayAligned    = 0U;
+  ArrayOut        = 0U;
+  ArrayFrameIndex = 0U;
+  ArrayState      = SAI_ARRAY_STATE_BUSY;
+
+  /* Slaves first: they wait for the frame clock of the reference */
+  for(b = ArrayInit.BlockNbr; b > 0U; b--)
+  {
+    if(HAL_SAI_Receive_DMA(ArrayInit.hsai[b - 1U], (uint8_t *)ArrayRxBuffer[b - 1U],
+                           (uint16_t)ARRAY_BLOCK_SIZE(b - 1U)) != HAL_OK)
+    {
+      while(b < ArrayInit.BlockNbr)
+      {
+        (void)HAL_SAI_DMAStop(ArrayInit.hsai[b]);
+        b++;
+      }
+      ArrayState = SAI_ARRAY_STATE_ERROR;
+      return HAL_ERROR;
+    }
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop all the blocks, the reference first
+  * @param  None
+  * @retval HAL status
+  */
+HAL_StatusTypeDef SAI_Array_Stop(void)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t b;
+
+  if(ArrayState == SAI_ARRAY_STATE_RESET)
+  {
+    return HAL_ERROR;
+  }
+
+  for(b = 0U; b < ArrayInit.BlockNbr; b++)
+  {
+    if(HAL_SAI_DMAStop(ArrayInit.hsai[b]) != HAL_OK)
+    {
+      status = HAL_ERROR;
+    }
+  }
+  ArrayState = SAI_ARRAY_STATE_READY;
+
+  return status;
+}
+
+/**
+  * @brief  Return the capture state
+  * @param  None
+  * @retval Capture state
+  */
+SAI_Array_StateTypeDef SAI_Array_GetState(void)
+{
+  return ArrayState;
+}
+
+/**
+  * @brief  Read the capture statistics
+  * @param  pStats: statistics, copied with the DMA interrupts masked
+  * @retval None
+  */
+void SAI_Array_GetStats(SAI_Array_StatsTypeDef *pStats)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  *pStats = ArrayStats;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Handle the DMA interrupt of a block
+  * @param  Block: index of the block in hsai[]
+  * @retval None
+  */
+void SAI_Array_DMA_IRQHandler(uint32_t Block)
+{
+  if(Block < ArrayInit.BlockNbr)
+  {
+    HAL_DMA_IRQHandler(ArrayInit.hsai[Block]->hdmarx);
+  }
+}
+
+/**
+  * @brief  Handle the SAI interrupts (FIFO overruns)
+  * @param  None
+  * @retval None
+  */
+void SAI_Array_SAI_IRQHandler(void)
+{
+  uint32_t b;
+
+  for(b = 0U; b < ArrayInit.BlockNbr; b++)
+  {
+    HAL_SAI_IRQHandler(ArrayInit.hsai[b]);
+  }
+}
+
+/**
+  * @brief  A period of all the blocks is aggregated
+  * @note   Called from the reference DMA interrupt. The block must be used
+  *         or copied before the end of the next period.
+  * @param  pBlock: interleaved samples, frame index and timestamp
+  * @retval None
+  */
+__weak void SAI_Array_BlockCallback(const SAI_Array_BlockTypeDef *pBlock)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(pBlock);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the SAI_Array_BlockCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  The capture stopped on an error
+  * @param  None
+  * @retval None
+  */
+__weak void SAI_Array_ErrorCallback(void)
+{
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the SAI_Array_ErrorCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Rx transfer complete callback: second period received
+  * @param  hsai: SAI handle
+  * @retval None
+  */
+void HAL_SAI_RxCpltCallback(SAI_HandleTypeDef *hsai)
+{
+  if((hsai == ArrayInit.hsai[0]) && (ArrayState == SAI_ARRAY_STATE_BUSY))
+  {
+    Array_Process(1U);
+  }
+}
+
+/**
+  * @brief  Rx transfer half complete callback: first period received
+  * @param  hsai: SAI handle
+  * @retval None
+  */
+void HAL_SAI_RxHalfCpltCallback(SAI_HandleTypeDef *hsai)
+{
+  if((hsai == ArrayInit.hsai[0]) && (ArrayState == SAI_ARRAY_STATE_BUSY))
+  {
+    Array_Process(0U);
+  }
+}
+
+/**
+  * @brief  SAI error callback
+  * @param  hsai: SAI handle
+  * @retval None
+  */
+void HAL_SAI_ErrorCallback(SAI_HandleTypeDef *hsai)
+{
+  uint32_t b;
+
+  for(b = 0U; b < ArrayInit.BlockNbr; b++)
+  {
+    if(hsai == ArrayInit.hsai[b])
+    {
+      ArrayState = SAI_ARRAY_STATE_ERROR;
+      SAI_Array_ErrorCallback();
+      return;
+    }
+  }
+}
+
+/**
+  * @brief  Count the active slots of a block, the samples of its frames
+  * @param  hsai: SAI handle
+  * @retval Active slots
+  */
+static uint32_t Array_SlotCount(const SAI_HandleTypeDef *hsai)
+{
+  uint32_t active = hsai->SlotInit.SlotActive;
+  uint32_t count = 0U;
+
+  if(hsai->SlotInit.SlotNumber < 16U)
+  {
+    active &= (1UL << hsai->SlotInit.SlotNumber) - 1U;
+  }
+  while(active != 0U)
+  {
+    active &= active - 1U;
+    count++;
+  }
+
+  return count;
+}
+
+/**
+  * @brief  SAI of a block
+  * @param  pBlock: block instance
+  * @retval SAI instance, NULL if not supported
+  */
+static SAI_TypeDef *Array_Parent(const SAI_Block_TypeDef *pBlock)
+{
+  if((pBlock == SAI1_Block_A) || (pBlock == SAI1_Block_B))
+  {
+    return SAI1;
+  }
+#if defined(SAI2)
+  if((pBlock == SAI2_Block_A) || (pBlock == SAI2_Block_B))
+  {
+    return SAI2;
+  }
+#endif
+#if defined(SAI3)
+  if((pBlock == SAI3_Block_A) || (pBlock == SAI3_Block_B))
+  {
+    return SAI3;
+  }
+#endif
+  return NULL;
+}
+
+/**
+  * @brief  Check the blocks form one synchronous chain from the reference
+  * @param  pInit: configuration
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef Array_CheckChain(const SAI_Array_InitTypeDef *pInit)
+{
+  const SAI_HandleTypeDef *hsai;
+  SAI_TypeDef *psource;
+  uint32_t b;
+  uint32_t s;
+  uint32_t found;
+
+  if(pInit->hsai[0]->Init.Synchro != SAI_ASYNCHRONOUS)
+  {
+    return HAL_ERROR;
+  }
+
+  for(b = 0U; b < pInit->BlockNbr; b++)
+  {
+    hsai = pInit->hsai[b];
+    if((Array_Parent(hsai->Instance) == NULL) ||
+       ((hsai->Init.AudioMode != SAI_MODEMASTER_RX) && (hsai->Init.AudioMode != SAI_MODESLAVE_RX)))
+    {
+      return HAL_ERROR;
+    }
+    for(s = 0U; s < b; s++)
+    {
+      if(pInit->hsai[s] == hsai)
+      {
+        return HAL_ERROR;
+      }
+    }
+    if(b == 0U)
+    {
+      continue;
+    }
+
+    /* Slaves of the reference clock, or all slaves of an external one */
+    if((hsai->Init.AudioMode != SAI_MODESLAVE_RX) ||
+       ((hsai->Init.Synchro == SAI_ASYNCHRONOUS) && (pInit->hsai[0]->Init.AudioMode == SAI_MODEMASTER_RX)))
+    {
+      return HAL_ERROR;
+    }
+
+    /* Clocks of another SAI: exported by one of the blocks */
+    if((hsai->Init.Synchro == SAI_SYNCHRONOUS_EXT_SAI1) || (hsai->Init.Synchro == SAI_SYNCHRONOUS_EXT_SAI2))
+    {
+#if defined(SAI2)
+      psource = (hsai->Init.Synchro == SAI_SYNCHRONOUS_EXT_SAI1) ? SAI1 : SAI2;
+#else
+      psource = SAI1;
+#endif
+      found = 0U;
+      for(s = 0U; s < pInit->BlockNbr; s++)
+      {
+        if((Array_Parent(pInit->hsai[s]->Instance) == psource) &&
+           (pInit->hsai[s]->Init.SynchroExt != SAI_SYNCEXT_DISABLE))
+        {
+          found = 1U;
+        }
+      }
+      if(found == 0U)
+      {
+        return HAL_ERROR;
+      }
+    }
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Measure the frame offsets of the blocks against the reference
+  * @note   The DMA pointers are read together, in fractions of frames so
+  *         that blocks in the same frame round to the same offset.
+  * @param  None
+  * @retval HAL_ERROR if a block is off by more than a quarter period
+  */
+static HAL_StatusTypeDef Array_Align(void)
+{
+  uint32_t done[SAI_ARRAY_MAX_BLOCKS];
+  int32_t  span = (int32_t)(2U * ArrayInit.FrameNbr * 256U);
+  int32_t  ref;
+  int32_t  diff;
+  int32_t  offset;
+  uint32_t primask;
+  uint32_t b;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  for(b = 0U; b < ArrayInit.BlockNbr; b++)
+  {
+    done[b] = ARRAY_BLOCK_SIZE(b) - __HAL_DMA_GET_COUNTER(ArrayInit.hsai[b]->hdmarx);
+  }
+  __set_PRIMASK(primask);
+
+  /* Positions in 1/256 frame, modulo two periods */
+  ref = (int32_t)((done[0] * 256U) / ArraySlots[0]);
+  for(b = 0U; b < ArrayInit.BlockNbr; b++)
+  {
+    diff = (int32_t)((done[b] * 256U) / ArraySlots[b]) - ref;
+    if(diff > (span / 2))
+    {
+      diff -= span;
+    }
+    else if(diff < -(span / 2))
+    {
+      diff += span;
+    }
+
+    /* Rounded to the nearest frame */
+    offset = ((diff + span + 128) / 256) - (int32_t)(2U * ArrayInit.FrameNbr);
+    if((offset > (int32_t)(ArrayInit.FrameNbr / 4U)) || (offset < -(int32_t)(ArrayInit.FrameNbr / 4U)))
+    {
+      return HAL_ERROR;
+    }
+    ArrayStats.Offset[b] = offset;
+    ArrayOffset[b] = (uint32_t)(offset + (int32_t)(2U * ArrayInit.FrameNbr)) % (2U * ArrayInit.FrameNbr);
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Aggregate the period the reference just received
+  * @param  Half: period index in the reference buffer, 0 or 1
+  * @retval None
+  */
+static void Array_Process(uint32_t Half)
+{
+  SAI_Array_BlockTypeDef block;
+  uint32_t start = DWT->CYCCNT;
+  uint32_t first = Half * ArrayInit.FrameNbr;
+  uint32_t cycles;
+  uint32_t frame;
+  uint32_t b;
+
+  if(ArrayAligned == 0U)
+  {
+    if(Array_Align() != HAL_OK)
+    {
+      (void)SAI_Array_Stop();
+      ArrayState = SAI_ARRAY_STATE_ERROR;
+      SAI_Array_ErrorCallback();
+      return;
+    }
+    ArrayAligned = 1U;
+  }
+
+  for(b = 0U; b < ArrayInit.BlockNbr; b++)
+  {
+    Array_Invalidate(b, (first + ArrayOffset[b]) % (2U * ArrayInit.FrameNbr));
+  }
+
+  if(ArraySampleSize == 2U)
+  {
+    Array_Remap16(first, ArrayOutBuffer[ArrayOut]);
+  }
+  else
+  {
+    Array_Remap32(first, (int32_t *)ArrayOutBuffer[ArrayOut]);
+  }
+
+  block.pData      = ArrayOutBuffer[ArrayOut];
+  block.FrameNbr   = ArrayInit.FrameNbr;
+  block.Channels   = ArrayInit.Channels;
+  block.FrameIndex = ArrayFrameIndex;
+  block.Timestamp  = start;
+  SAI_Array_BlockCallback(&block);
+
+  ArrayFrameIndex += ArrayInit.FrameNbr;
+  ArrayOut ^= 1U;
+
+  cycles = DWT->CYCCNT - start;
+  ArrayStats.CyclesLast = cycles;
+  if(cycles > ArrayStats.CyclesMax)
+  {
+    ArrayStats.CyclesMax = cycles;
+  }
+
+  /* Late when the reference already writes the period just read */
+  frame = (ARRAY_BLOCK_SIZE(0U) - __HAL_DMA_GET_COUNTER(ArrayInit.hsai[0]->hdmarx)) / ArraySlots[0];
+  if((frame / ArrayInit.FrameNbr) == Half)
+  {
+    ArrayStats.LatePeriods++;
+  }
+  ArrayStats.Periods++;
+}
+
+/**
+  * @brief  Invalidate the data cache over one period of a block
+  * @param  Block: index of the block
+  * @param  Frame: first frame of the period in the block buffer
+  * @retval None
+  */
+static void Array_Invalidate(uint32_t Block, uint32_t Frame)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  uint8_t *pbuffer = (uint8_t *)ArrayRxBuffer[Block];
+  uint32_t frameSize = ArraySlots[Block] * ArraySampleSize;
+  uint32_t frames = 2U * ArrayInit.FrameNbr;
+  uint32_t count = ArrayInit.FrameNbr;
+  uint32_t addr;
+  uint32_t end;
+
+  if((SCB->CCR & SCB_CCR_DC_Msk) == 0U)
+  {
+    return;
+  }
+
+  /* A period of a block with an offset may wrap around its buffer */
+  if((Frame + count) > frames)
+  {
+    count = frames - Frame;
+    SCB_InvalidateDCache_by_Addr((uint32_t *)pbuffer, (int32_t)((ArrayInit.FrameNbr - count) * frameSize));
+  }
+
+  /* Whole lines: the CPU never writes these buffers while capturing */
+  addr = ((uint32_t)pbuffer + (Frame * frameSize)) & ~31U;
+  end  = (uint32_t)pbuffer + ((Frame + count) * frameSize);
+  SCB_InvalidateDCache_by_Addr((uint32_t *)addr, (int32_t)(end - addr));
+#else
+  UNUSED(Block);
+  UNUSED(Frame);
+#endif
+}
+
+/**
+  * @brief  Gather one period of 16-bit samples, two channels per word
+  * @param  First: first frame of the period in the reference buffer
+  * @param  pOut: interleaved output
+  * @retval None
+  */
+static void Array_Remap16(uint32_t First, uint32_t *pOut)
+{
+  const int16_t *prow[SAI_ARRAY_MAX_BLOCKS];
+  uint32_t index[SAI_ARRAY_MAX_BLOCKS];
+  const SAI_Array_MapTypeDef *pmap = ArrayInit.Map;
+  uint32_t frames = 2U * ArrayInit.FrameNbr;
+  uint32_t f;
+  uint32_t c;
+  uint32_t b;
+
+  for(b = 0U; b < ArrayInit.BlockNbr; b++)
+  {
+    index[b] = (First + ArrayOffset[b]) % frames;
+  }
+
+  for(f = 0U; f < ArrayInit.FrameNbr; f++)
+  {
+    for(b = 0U; b < ArrayInit.BlockNbr; b++)
+    {
+      prow[b] = &((const int16_t *)ArrayRxBuffer[b])[index[b] * ArraySlots[b]];
+      index[b] = (index[b] == (frames - 1U)) ? 0U : (index[b] + 1U);
+    }
+
+    for(c = 0U; c < ArrayInit.Channels; c += 2U)
+    {
+      *pOut++ = __PKHBT((uint16_t)prow[pmap[c].Block][pmap[c].Slot],
+                        (uint16_t)prow[pmap[c + 1U].Block][pmap[c + 1U].Slot], 16);
+    }
+  }
+}
+
+/**
+  * @brief  Gather one period of 24 or 32-bit samples
+  * @param  First: first frame of the period in the reference buffer
+  * @param  pOut: interleaved output
+  * @retval None
+  */
+static void Array_Remap32(uint32_t First, int32_t *pOut)
+{
+  const int32_t *prow[SAI_ARRAY_MAX_BLOCKS];
+  uint32_t index[SAI_ARRAY_MAX_BLOCKS];
+  const SAI_Array_MapTypeDef *pmap = ArrayInit.Map;
+  uint32_t frames = 2U * ArrayInit.FrameNbr;
+  uint32_t f;
+  uint32_t c;
+  uint32_t b;
+
+  for(b = 0U; b < ArrayInit.BlockNbr; b++)
+  {
+    index[b] = (First + ArrayOffset[b]) % frames;
+  }
+
+  for(f = 0U; f < ArrayInit.FrameNbr; f++)
+  {
+    for(b = 0U; b < ArrayInit.BlockNbr; b++)
+    {
+      prow[b] = &((const int32_t *)ArrayRxBuffer[b])[index[b] * ArraySlots[b]];
+      index[b] = (index[b] == (frames - 1U)) ? 0U : (index[b] + 1U);
+    }
+
+    for(c = 0U; c < ArrayInit.Channels; c++)
+    {
+      *pOut++ = prow[pmap[c].Block][pmap[c].Slot];
+    }
+  }
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
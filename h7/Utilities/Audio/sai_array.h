@@ -0,0 +1,144 @@
+/**
+  ******************************************************************************
+  * @file    sai_array.h
+  * @author  MCD Application Team
+  * @brief   Header for sai_array module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _SAI_ARRAY_H__
+#define _SAI_ARRAY_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#if !defined(SAI1)
+#error "sai_array requires a SAI"
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+/* Largest number of SAI blocks aggregated. Override in main.h. */
+#if !defined(SAI_ARRAY_MAX_BLOCKS)
+#define SAI_ARRAY_MAX_BLOCKS       4U
+#endif
+/* Largest number of active slots of one block, 16 at most. Override in main.h. */
+#if !defined(SAI_ARRAY_MAX_SLOTS)
+#define SAI_ARRAY_MAX_SLOTS        8U
+#endif
+/* Largest number of channels of the aggregated block. Override in main.h. */
+#if !defined(SAI_ARRAY_MAX_CHANNELS)
+#define SAI_ARRAY_MAX_CHANNELS     32U
+#endif
+/* Largest period, in frames. Override in main.h. */
+#if !defined(SAI_ARRAY_MAX_FRAMES)
+#define SAI_ARRAY_MAX_FRAMES       128U
+#endif
+
+#if (SAI_ARRAY_MAX_SLOTS > 16U)
+#error "SAI_ARRAY_MAX_SLOTS: a SAI frame has 16 slots at most"
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+  SAI_ARRAY_STATE_RESET = 0U,  /* Not initialized                       */
+  SAI_ARRAY_STATE_READY = 1U,  /* Initialized, capture stopped          */
+  SAI_ARRAY_STATE_BUSY  = 2U,  /* Capture running                       */
+  SAI_ARRAY_STATE_ERROR = 3U   /* SAI or DMA error, or blocks misaligned */
+} SAI_Array_StateTypeDef;
+
+typedef struct
+{
+  uint8_t Block;  /* Index of the SAI block in hsai[]                               */
+  uint8_t Slot;   /* Sample in the frame of that block, counting active slots only */
+} SAI_Array_MapTypeDef;
+
+typedef struct
+{
+  SAI_HandleTypeDef *hsai[SAI_ARRAY_MAX_BLOCKS]; /* TDM receivers initialized by the user, hsai[0]
+                                                    asynchronous (master, or slave of an external
+                                                    clock) and the others synchronous to it       */
+  uint32_t BlockNbr;    /* SAI blocks, 1 to SAI_ARRAY_MAX_BLOCKS                                  */
+  uint32_t AudioFreq;   /* Frame rate, in Hz                                                      */
+  uint32_t FrameNbr;    /* Frames per period, 16 to SAI_ARRAY_MAX_FRAMES                          */
+  uint32_t Channels;    /* Channels of the aggregated block, 1 to SAI_ARRAY_MAX_CHANNELS, even
+                           with 16-bit data                                                       */
+  SAI_Array_MapTypeDef Map[SAI_ARRAY_MAX_CHANNELS]; /* Source of each channel                      */
+} SAI_Array_InitTypeDef;
+
+typedef struct
+{
+  const void *pData;    /* FrameNbr frames of Channels interleaved samples: int16_t with 16-bit
+                           data, int32_t left-aligned as received otherwise                      */
+  uint32_t FrameNbr;    /* Frames of the block                                                   */
+  uint32_t Channels;    /* Samples per frame                                                     */
+  uint64_t FrameIndex;  /* Index of the first frame, counted from the start                      */
+  uint32_t Timestamp;   /* DWT cycle counter when the last frame was received                   */
+} SAI_Array_BlockTypeDef;
+
+typedef struct
+{
+  uint32_t Periods;      /* Blocks delivered                                                    */
+  uint32_t LatePeriods;  /* Periods whose processing overran the next DMA half                  */
+  uint32_t CyclesLast;   /* CPU cycles of the last period, remapping and callback               */
+  uint32_t CyclesMax;    /* Longest period, in CPU cycles                                      */
+  uint32_t CyclesBudget; /* CPU cycles per period                                              */
+  int32_t  Offset[SAI_ARRAY_MAX_BLOCKS]; /* Frames each block was ahead of hsai[0] at the start,
+                                            compensated in the aggregation                      */
+} SAI_Array_StatsTypeDef;
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef      SAI_Array_Init(const SAI_Array_InitTypeDef *pInit);
+HAL_StatusTypeDef      SAI_Array_DeInit(void);
+HAL_StatusTypeDef      SAI_Array_Start(void);
+HAL_StatusTypeDef      SAI_Array_Stop(void);
+SAI_Array_StateTypeDef SAI_Array_GetState(void);
+void                   SAI_Array_GetStats(SAI_Array_StatsTypeDef *pStats);
+
+void SAI_Array_DMA_IRQHandler(uint32_t Block);
+void SAI_Array_SAI_IRQHandler(void);
+
+void SAI_Array_BlockCallback(const SAI_Array_BlockTypeDef *pBlock);
+void SAI_Array_ErrorCallback(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _SAI_ARRAY_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,938 @@
+/**
+  ******************************************************************************
+  * @file    spdif_bridge.c
+  * @author  MCD Application Team
+  * @brief   S/PDIF input to SAI output bridge: the receiver and transmitter
+  *          DMA share one ring, the output clock tracks the input rate
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- initialize the SPDIFRX on the input, with WaitForActivity enabled, and
+   link to it a DMA stream for the data flow (hdmaDrRx) in circular mode,
+   word to word. Its kernel clock must be at least 704 times the highest
+   input rate (135.2 MHz for 192 kHz) and must not be taken from PLL2.
+
+2- initialize a SAI block as master transmitter, 24-bit data in two 32-bit
+   slots with the master clock output enabled, and link to it a DMA stream
+   in circular mode, word to word. Its kernel clock must be PLL2 P, given
+   over to this module: PLL2 is re-programmed at 1024 times 44.1 kHz or
+   48 kHz for each rate family, and its fractional part is trimmed while
+   streaming. Do not link the BSP audio driver, which also sets PLL2.
+
+3- call SPDIF_Bridge_RX_DMA_IRQHandler() and SPDIF_Bridge_TX_DMA_IRQHandler()
+   from the two DMA interrupt handlers, and SPDIF_Bridge_SPDIFRX_IRQHandler()
+   from the SPDIFRX one, to be told of synchronization losses.
+
+4- call SPDIF_Bridge_Init() then SPDIF_Bridge_Start(), and SPDIF_Bridge_Process()
+   from the main loop: it waits for the receiver to lock, measures the
+   input rate, re-clocks the SAI when the rate changed (calling
+   SPDIF_Bridge_RateCallback(), ex. to set up the DAC) and starts the
+   reception. After a loss of synchronization, it starts over.
+
+5- the samples are not copied: the receiver writes the ring in its data
+   format 0 (24-bit sample in the LSBs, then the parity, validity, user,
+   channel status bits and preamble type) and the SAI, whose 24-bit slots
+   ignore the upper byte, plays it from the same ring half of it behind.
+   With 64 frames, the lag is 32 frames: 0.67 ms at 48 kHz.
+
+6- the lag between the two DMA pointers is measured on each ring half and
+   a PI loop moves the PLL2 fractional divider (FRACN) to keep it at half
+   the ring: the output follows the input clock and its drift, without
+   resampling. Should the lag still leave its window, the output is
+   restarted half a ring behind (a slip, counted in the statistics).
+
+7- the channel status of channel A is decoded from the ring; on a change,
+   SPDIF_Bridge_ChannelStatusCallback() is called from the DMA interrupt.
+   Non-PCM streams (IEC 61937) are muted, and a new rate in the channel
+   status makes the bridge re-synchronize and re-clock.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "spdif_bridge.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Smallest ring: the window the lag may move in must exceed the SAI FIFO */
+#define BRIDGE_MIN_FRAMES     32U
+/* Lag window limits, from either end of the ring (SAI FIFO and DMA lead) */
+#define BRIDGE_GUARD          6U
+
+/* SPDIFRX_DR fields in data format 0 */
+#define BRIDGE_DR_C           (1UL << 27)
+#define BRIDGE_DR_PT_Pos      28U
+#define BRIDGE_DR_PT_B        1U   /* Channel A, start of a status block */
+#define BRIDGE_DR_PT_W        3U   /* Channel B                          */
+
+/* Channel status block: one bit per frame */
+#define BRIDGE_CS_BITS        192U
+/* Leading status bytes whose change is reported (format, category, rate) */
+#define BRIDGE_CS_COMPARE     6U
+
+/* PLL2: P divider and largest input reference, in Hz */
+#define BRIDGE_PLL2_P         8U
+#define BRIDGE_PLL2_REF_MAX   8000000U
+#define BRIDGE_FRACN_MAX      8191
+/* PLL2 lock timeout, in ms */
+#define BRIDGE_PLL_TIMEOUT    2U
+
+/* Private macro -------------------------------------------------------------*/
+/* Word a circular DMA is transferring */
+#define BRIDGE_DMA_WORD(__HDMA__)  ((2U * BridgeInit.Frames) - __HAL_DMA_GET_COUNTER(__HDMA__))
+
+/* Private variables ---------------------------------------------------------*/
+static uint32_t BridgeRing[2U * SPDIF_BRIDGE_MAX_FRAMES] __attribute__((section(".dma_d1"), aligned(32)));
+
+static const uint32_t BridgeRates[] = { 32000U, 44100U, 48000U, 88200U, 96000U, 176400U, 192000U };
+
+static SPDIF_Bridge_InitTypeDef          BridgeInit;
+static SPDIF_Bridge_StatsTypeDef         BridgeStats;
+static SPDIF_Bridge_ChannelStatusTypeDef BridgeStatus;
+static __IO SPDIF_Bridge_StateTypeDef    BridgeState = SPDIF_BRIDGE_STATE_RESET;
+static __IO uint32_t BridgeRestart;    /* Re-synchronization requested from interrupt */
+
+static uint8_t  BridgeCsBytes[24];
+static uint32_t BridgeCsBit;           /* Next status bit, above BRIDGE_CS_BITS before a block start */
+static uint32_t BridgeStatusValid;     /* BridgeStatus holds a received block */
+
+static uint32_t BridgeFracN;           /* PLL2 FRACN for the nominal rate */
+static int32_t  BridgeErrSum;          /* Lag error summed over the tracking period */
+static int32_t  BridgeIntegral;
+static uint32_t BridgeTrackCount;
+
+/* Private function prototypes -----------------------------------------------*/
+static HAL_StatusTypeDef Bridge_StartSync(void);
+static void              Bridge_Halt(void);
+static void              Bridge_Fail(void);
+static uint32_t          Bridge_MeasureRate(uint32_t Status);
+static HAL_StatusTypeDef Bridge_SetRate(uint32_t Rate);
+static uint32_t          Bridge_GetSpdifClock(void);
+static HAL_StatusTypeDef Bridge_SetClock(uint32_t Rate);
+static void              Bridge_Receive(uint32_t Half);
+static void              Bridge_DecodeStatus(const uint32_t *pWords);
+static void              Bridge_StatusBlock(void);
+static void              Bridge_Track(void);
+static void              Bridge_RxHalfCplt(DMA_HandleTypeDef *hdma);
+static void              Bridge_RxCplt(DMA_HandleTypeDef *hdma);
+static void              Bridge_RxError(DMA_HandleTypeDef *hdma);
+
+/* Functions Definition ------------------------------------------------------*/
+/**
+  * @brief  Initialize the bridge on an initialized SPDIFRX and SAI
+  * @param  pInit: bridge configuration, copied
+  * @retval HAL status
+  */
+HAL_StatusTypeDef SPDIF_Bridge_Init(const SPDIF_Bridge_InitTypeDef *pInit)
+{
+  if((BridgeState > SPDIF_BRIDGE_STATE_READY) && (BridgeState != SPDIF_BRIDGE_STATE_ERROR))
+  {
+    return HAL_BUSY;
+  }
+
+  if((pInit == NULL) || (pInit->hspdif == NULL) || (pInit->hsai == NULL) ||
+     (pInit->hspdif->hdmaDrRx == NULL) || (pInit->hsai->hdmatx == NULL) ||
+     (pInit->Frames < BRIDGE_MIN_FRAMES) || (pInit->Frames > SPDIF_BRIDGE_MAX_FRAMES) ||
+     ((pInit->Frames % 8U) != 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* PLL2 is re-programmed with the output rate */
+  if(__HAL_RCC_GET_SPDIFRX_SOURCE() == RCC_SPDIFRXCLKSOURCE_PLL2)
+  {
+    return HAL_ERROR;
+  }
+
+  BridgeInit = *pInit;
+  BridgeStats.Rate = 0U;
+  BridgeStats.MeasuredRate = 0U;
+  BridgeStats.Lag = 0U;
+  BridgeStats.Trim = 0;
+  BridgeStats.Locks = 0U;
+  BridgeStats.SyncErrors = 0U;
+  BridgeStats.RateChanges = 0U;
+  BridgeStats.Slips = 0U;
+  BridgeStatusValid = 0U;
+  BridgeState = SPDIF_BRIDGE_STATE_READY;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Start waiting for the input, SPDIF_Bridge_Process() does the rest
+  * @param  None
+  * @retval HAL status
+  */
+HAL_StatusTypeDef SPDIF_Bridge_Start(void)
+{
+  if((BridgeState != SPDIF_BRIDGE_STATE_READY) && (BridgeState != SPDIF_BRIDGE_STATE_ERROR))
+  {
+    return HAL_ERROR;
+  }
+
+  return Bridge_StartSync();
+}
+
+/**
+  * @brief  Stop the input and the output
+  * @param  None
+  * @retval HAL status
+  */
+HAL_StatusTypeDef SPDIF_Bridge_Stop(void)
+{
+  if(BridgeState == SPDIF_BRIDGE_STATE_RESET)
+  {
+    return HAL_ERROR;
+  }
+
+  BridgeState = SPDIF_BRIDGE_STATE_READY;
+  Bridge_Halt();
+  BridgeRestart = 0U;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Synchronize to the input and (re)start the bridge
+  * @note   To be called from the main loop. The output clock is set here,
+  *         outside of any interrupt, since PLL2 takes time to lock.
+  * @param  None
+  * @retval None
+  */
+void SPDIF_Bridge_Process(void)
+{
+  SPDIFRX_HandleTypeDef *hspdif = BridgeInit.hspdif;
+  uint32_t status;
+  uint32_t rate;
+
+  switch(BridgeState)
+  {
+  case SPDIF_BRIDGE_STATE_SYNC:
+    status = hspdif->Instance->SR;
+
+    if((BridgeRestart != 0U) ||
+       ((status & (SPDIFRX_SR_FERR | SPDIFRX_SR_SERR | SPDIFRX_SR_TERR)) != 0U))
+    {
+      /* Synchronization failed: wait for the input again */
+      if(BridgeRestart == 0U)
+      {
+        BridgeStats.SyncErrors++;
+      }
+      Bridge_Halt();
+      (void)Bridge_StartSync();
+    }
+    else if((status & SPDIFRX_SR_SYNCD) != 0U)
+    {
+      __HAL_SPDIFRX_CLEAR_IT(hspdif, SPDIFRX_IFCR_SYNCDCF);
+
+      rate = Bridge_MeasureRate(status);
+      if(rate == 0U)
+      {
+        /* Not a standard rate */
+        BridgeStats.SyncErrors++;
+        Bridge_Halt();
+        (void)Bridge_StartSync();
+      }
+      else if((rate != BridgeStats.Rate) && (Bridge_SetRate(rate) != HAL_OK))
+      {
+        Bridge_Halt();
+        BridgeState = SPDIF_BRIDGE_STATE_ERROR;
+      }
+      else
+      {
+        BridgeStats.Locks++;
+
+        /* Receive: the output starts once the first ring half is written */
+        __HAL_SPDIFRX_CLEAR_IT(hspdif, SPDIFRX_IFCR_PERRCF | SPDIFRX_IFCR_OVRCF | SPDIFRX_IFCR_SBDCF);
+        __HAL_SPDIFRX_ENABLE_IT(hspdif, SPDIFRX_IT_IFEIE | SPDIFRX_IT_OVRIE);
+        BridgeState = SPDIF_BRIDGE_STATE_STARTING;
+        __HAL_SPDIFRX_RCV(hspdif);
+      }
+    }
+    else
+    {
+      /* Waiting for the receiver */
+    }
+    break;
+
+  case SPDIF_BRIDGE_STATE_STARTING:
+  case SPDIF_BRIDGE_STATE_STREAM:
+    if(BridgeRestart != 0U)
+    {
+      Bridge_Halt();
+      (void)Bridge_StartSync();
+    }
+    break;
+
+  default:
+    break;
+  }
+}
+
+/**
+  * @brief  Get the bridge state
+  * @param  None
+  * @retval State
+  */
+SPDIF_Bridge_StateTypeDef SPDIF_Bridge_GetState(void)
+{
+  return BridgeState;
+}
+
+/**
+  * @brief  Get the bridge statistics
+  * @param  pStats: statistics, filled
+  * @retval None
+  */
+void SPDIF_Bridge_GetStats(SPDIF_Bridge_StatsTypeDef *pStats)
+{
+  *pStats = BridgeStats;
+}
+
+/**
+  * @brief  Get the last channel status block received
+  * @param  pStatus: channel status, filled (all zero before the first block)
+  * @retval None
+  */
+void SPDIF_Bridge_GetChannelStatus(SPDIF_Bridge_ChannelStatusTypeDef *pStatus)
+{
+  *pStatus = BridgeStatus;
+}
+
+/**
+  * @brief  Handle the receiver DMA interrupt
+  * @param  None
+  * @retval None
+  */
+void SPDIF_Bridge_RX_DMA_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(BridgeInit.hspdif->hdmaDrRx);
+}
+
+/**
+  * @brief  Handle the transmitter DMA interrupt
+  * @param  None
+  * @retval None
+  */
+void SPDIF_Bridge_TX_DMA_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(BridgeInit.hsai->hdmatx);
+}
+
+/**
+  * @brief  Handle the SPDIFRX interrupt (synchronization loss and overrun)
+  * @param  None
+  * @retval None
+  */
+void SPDIF_Bridge_SPDIFRX_IRQHandler(void)
+{
+  SPDIFRX_HandleTypeDef *hspdif = BridgeInit.hspdif;
+  uint32_t status = hspdif->Instance->SR;
+
+  if((status & (SPDIFRX_SR_FERR | SPDIFRX_SR_SERR | SPDIFRX_SR_TERR | SPDIFRX_SR_OVR)) != 0U)
+  {
+    __HAL_SPDIFRX_CLEAR_IT(hspdif, SPDIFRX_IFCR_OVRCF | SPDIFRX_IFCR_PERRCF);
+    BridgeStats.SyncErrors++;
+    Bridge_Fail();
+  }
+}
+
+/**
+  * @brief  Input rate change callback
+  * @note   Called from SPDIF_Bridge_Process() once the SAI is clocked for the
+  *         new rate, before it is started.
+  * @param  Rate: sampling rate, in Hz
+  * @retval None
+  */
+__weak void SPDIF_Bridge_RateCallback(uint32_t Rate)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Rate);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the SPDIF_Bridge_RateCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Channel status change callback
+  * @note   Called from the receiver DMA interrupt.
+  * @param  pStatus: new channel status
+  * @retval None
+  */
+__weak void SPDIF_Bridge_ChannelStatusCallback(const SPDIF_Bridge_ChannelStatusTypeDef *pStatus)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(pStatus);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the SPDIF_Bridge_ChannelStatusCallback could be implemented in the user file
+   */
+}
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Start the reception DMA on the ring and the receiver synchronization
+  * @param  None
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef Bridge_StartSync(void)
+{
+  SPDIFRX_HandleTypeDef *hspdif = BridgeInit.hspdif;
+  SPDIFRX_SetDataFormatTypeDef format;
+
+  BridgeRestart = 0U;
+  BridgeCsBit = BRIDGE_CS_BITS + 1U;
+
+  /* Data format 0 with all the bits the bridge decodes */
+  format.DataFormat        = SPDIFRX_DATAFORMAT_LSB;
+  format.StereoMode        = SPDIFRX_STEREOMODE_ENABLE;
+  format.PreambleTypeMask  = SPDIFRX_PREAMBLETYPEMASK_OFF;
+  format.ChannelStatusMask = SPDIFRX_CHANNELSTATUS_OFF;
+  format.ValidityBitMask   = SPDIFRX_VALIDITYMASK_OFF;
+  format.ParityErrorMask   = SPDIFRX_PARITYERRORMASK_OFF;
+  (void)HAL_SPDIFRX_SetDataFormat(hspdif, format);
+
+  hspdif->hdmaDrRx->XferHalfCpltCallback = Bridge_RxHalfCplt;
+  hspdif->hdmaDrRx->XferCpltCallback     = Bridge_RxCplt;
+  hspdif->hdmaDrRx->XferErrorCallback    = Bridge_RxError;
+
+  if(HAL_DMA_Start_IT(hspdif->hdmaDrRx, (uint32_t)&hspdif->Instance->DR,
+                      (uint32_t)BridgeRing, 2U * BridgeInit.Frames) != HAL_OK)
+  {
+    BridgeState = SPDIF_BRIDGE_STATE_ERROR;
+    return HAL_ERROR;
+  }
+  hspdif->State = HAL_SPDIFRX_STATE_BUSY_RX;
+  hspdif->Instance->CR |= SPDIFRX_CR_RXDMAEN;
+
+  /* SPDIF_Bridge_Process() polls SYNCD, the receiver waits for activity */
+  BridgeState = SPDIF_BRIDGE_STATE_SYNC;
+  __HAL_SPDIFRX_SYNC(hspdif);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the output, the receiver and its DMA
+  * @param  None
+  * @retval None
+  */
+static void Bridge_Halt(void)
+{
+  SPDIFRX_HandleTypeDef *hspdif = BridgeInit.hspdif;
+
+  if(BridgeInit.hsai->State == HAL_SAI_STATE_BUSY_TX)
+  {
+    (void)HAL_SAI_DMAStop(BridgeInit.hsai);
+  }
+
+  __HAL_SPDIFRX_DISABLE_IT(hspdif, SPDIFRX_IT_IFEIE | SPDIFRX_IT_OVRIE);
+  __HAL_SPDIFRX_IDLE(hspdif);
+  hspdif->Instance->CR &= ~SPDIFRX_CR_RXDMAEN;
+  (void)HAL_DMA_Abort(hspdif->hdmaDrRx);
+  hspdif->State = HAL_SPDIFRX_STATE_READY;
+}
+
+/**
+  * @brief  Stop at once on an input error, SPDIF_Bridge_Process() restarts
+  * @param  None
+  * @retval None
+  */
+static void Bridge_Fail(void)
+{
+  if((BridgeState == SPDIF_BRIDGE_STATE_STARTING) || (BridgeState == SPDIF_BRIDGE_STATE_STREAM))
+  {
+    Bridge_Halt();
+    BridgeRestart = 1U;
+    BridgeState = SPDIF_BRIDGE_STATE_SYNC;
+  }
+}
+
+/**
+  * @brief  Measure the input rate from the duration of 5 symbols
+  * @param  Status: SPDIFRX_SR value once synchronized
+  * @retval Nearest standard rate in Hz, 0 when none is within 3%
+  */
+static uint32_t Bridge_MeasureRate(uint32_t Status)
+{
+  uint32_t width5 = (Status & SPDIFRX_SR_WIDTH5) >> SPDIFRX_SR_WIDTH5_Pos;
+  uint32_t measured;
+  uint32_t delta;
+  uint32_t i;
+
+  if(width5 == 0U)
+  {
+    return 0U;
+  }
+
+  /* A frame is 64 symbols: fs = 5 x spdifrx_ker_ck / (WIDTH5 x 64) */
+  measured = (uint32_t)(((uint64_t)Bridge_GetSpdifClock() * 5U) / ((uint64_t)width5 * 64U));
+  BridgeStats.MeasuredRate = measured;
+
+  for(i = 0U; i < (sizeof(BridgeRates) / sizeof(BridgeRates[0])); i++)
+  {
+    delta = (measured > BridgeRates[i]) ? (measured - BridgeRates[i]) : (BridgeRates[i] - measured);
+    if(delta <= (BridgeRates[i] / 32U))
+    {
+      return BridgeRates[i];
+    }
+  }
+
+  return 0U;
+}
+
+/**
+  * @brief  Clock the SAI for a new rate
+  * @param  Rate: sampling rate, in Hz
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef Bridge_SetRate(uint32_t Rate)
+{
+  if(Bridge_SetClock(Rate) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  /* The master clock divider is computed from the new kernel clock */
+  BridgeInit.hsai->Init.AudioFrequency = Rate;
+  if(HAL_SAI_Init(BridgeInit.hsai) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  BridgeStats.Rate = Rate;
+  BridgeStats.RateChanges++;
+  SPDIF_Bridge_RateCallback(Rate);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Get the SPDIFRX kernel clock frequency
+  * @param  None
+  * @retval Frequency, in Hz
+  */
+static uint32_t Bridge_GetSpdifClock(void)
+{
+  PLL1_ClocksTypeDef pll1;
+  PLL2_ClocksTypeDef pll2;
+  PLL3_ClocksTypeDef pll3;
+
+  switch(__HAL_RCC_GET_SPDIFRX_SOURCE())
+  {
+  case RCC_SPDIFRXCLKSOURCE_PLL:
+    HAL_RCCEx_GetPLL1ClockFreq(&pll1);
+    return pll1.PLL1_Q_Frequency;
+
+  case RCC_SPDIFRXCLKSOURCE_PLL2:
+    HAL_RCCEx_GetPLL2ClockFreq(&pll2);
+    return pll2.PLL2_R_Frequency;
+
+  case RCC_SPDIFRXCLKSOURCE_PLL3:
+    HAL_RCCEx_GetPLL3ClockFreq(&pll3);
+    return pll3.PLL3_R_Frequency;
+
+  default:
+    return HSI_VALUE >> (__HAL_RCC_GET_HSI_DIVIDER() >> RCC_CR_HSIDIV_Pos);
+  }
+}
+
+/**
+  * @brief  Program PLL2 P at 1024 times the base rate of the rate family
+  * @note   49.152 MHz or 45.1584 MHz: the SAI master clock divider is then
+  *         exact for every standard rate. The fractional divider gives the
+  *         exact frequency from any reference and is the tracking actuator.
+  * @param  Rate: sampling rate, in Hz
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef Bridge_SetClock(uint32_t Rate)
+{
+  uint32_t source;
+  uint32_t divm;
+  uint32_t reference;
+  uint32_t range;
+  uint32_t vco;
+  uint32_t divn;
+  uint32_t divq = ((RCC->PLL2DIVR & RCC_PLL2DIVR_Q2) >> RCC_PLL2DIVR_Q2_Pos) + 1U;
+  uint32_t divr = ((RCC->PLL2DIVR & RCC_PLL2DIVR_R2) >> RCC_PLL2DIVR_R2_Pos) + 1U;
+  uint32_t tickstart;
+
+  switch(__HAL_RCC_GET_PLL_OSCSOURCE())
+  {
+  case RCC_PLLSOURCE_HSE:
+    source = HSE_VALUE;
+    break;
+  case RCC_PLLSOURCE_CSI:
+    source = CSI_VALUE;
+    break;
+  case RCC_PLLSOURCE_HSI:
+    source = HSI_VALUE >> (__HAL_RCC_GET_HSI_DIVIDER() >> RCC_CR_HSIDIV_Pos);
+    break;
+  default:
+    return HAL_ERROR;
+  }
+
+  divm = (source + BRIDGE_PLL2_REF_MAX - 1U) / BRIDGE_PLL2_REF_MAX;
+  reference = source / divm;
+  if(reference < 2000000U)
+  {
+    /* The wide VCO range needs at least 2 MHz */
+    return HAL_ERROR;
+  }
+  range = (reference < 4000000U) ? RCC_PLL2VCIRANGE_1 :
+          ((reference < 8000000U) ? RCC_PLL2VCIRANGE_2 : RCC_PLL2VCIRANGE_3);
+
+  vco = (((Rate % 11025U) == 0U) ? 44100U : 48000U) * 1024U * BRIDGE_PLL2_P;
+  divn = vco / reference;
+  BridgeFracN = (uint32_t)((((uint64_t)(vco % reference)) << 13) / reference);
+  BridgeStats.Trim = 0;
+
+  __HAL_RCC_PLL2_DISABLE();
+  tickstart = HAL_GetTick();
+  while(__HAL_RCC_GET_FLAG(RCC_FLAG_PLL2RDY) != RESET)
+  {
+    if((HAL_GetTick() - tickstart) > BRIDGE_PLL_TIMEOUT)
+    {
+      return HAL_TIMEOUT;
+    }
+  }
+
+  __HAL_RCC_PLL2_CONFIG(divm, divn, BRIDGE_PLL2_P, divq, divr);
+  __HAL_RCC_PLL2_VCIRANGE(range);
+  __HAL_RCC_PLL2_VCORANGE(RCC_PLL2VCOWIDE);
+  __HAL_RCC_PLL2FRACN_DISABLE();
+  __HAL_RCC_PLL2FRACN_CONFIG(BridgeFracN);
+  __HAL_RCC_PLL2FRACN_ENABLE();
+  __HAL_RCC_PLL2CLKOUT_ENABLE(RCC_PLL2_DIVP);
+  __HAL_RCC_PLL2_ENABLE();
+
+  tickstart = HAL_GetTick();
+  while(__HAL_RCC_GET_FLAG(RCC_FLAG_PLL2RDY) == RESET)
+  {
+    if((HAL_GetTick() - tickstart) > BRIDGE_PLL_TIMEOUT)
+    {
+      return HAL_TIMEOUT;
+    }
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Handle a ring half written by the receiver
+  * @param  Half: 0 for the first half, 1 for the second one
+  * @retval None
+  */
+static void Bridge_Receive(uint32_t Half)
+{
+  const uint32_t *pWords = &BridgeRing[Half * BridgeInit.Frames];
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    SCB_InvalidateDCache_by_Addr((uint32_t *)pWords, (int32_t)(BridgeInit.Frames * sizeof(uint32_t)));
+  }
+#endif
+
+  if(BridgeState == SPDIF_BRIDGE_STATE_STARTING)
+  {
+    /* Stereo pairs must start with channel A */
+    if(((pWords[0] >> BRIDGE_DR_PT_Pos) & 3U) == BRIDGE_DR_PT_W)
+    {
+      BridgeStats.SyncErrors++;
+      Bridge_Fail();
+      return;
+    }
+  }
+
+  Bridge_DecodeStatus(pWords);
+
+  if(BridgeRestart != 0U)
+  {
+    return;
+  }
+
+  if(BridgeState == SPDIF_BRIDGE_STATE_STARTING)
+  {
+    if(Half == 0U)
+    {
+      /* The output reads the half just written: it runs half a ring behind */
+      BridgeErrSum = 0;
+      BridgeIntegral = 0;
+      BridgeTrackCount = 0U;
+      if((BridgeStatusValid != 0U) && (BridgeStatus.NonAudio != 0U))
+      {
+        (void)HAL_SAI_EnableTxMuteMode(BridgeInit.hsai, SAI_ZERO_VALUE);
+      }
+      else
+      {
+        (void)HAL_SAI_DisableTxMuteMode(BridgeInit.hsai);
+      }
+      if(HAL_SAI_Transmit_DMA(BridgeInit.hsai, (uint8_t *)BridgeRing, (uint16_t)(2U * BridgeInit.Frames)) == HAL_OK)
+      {
+        BridgeState = SPDIF_BRIDGE_STATE_STREAM;
+      }
+    }
+  }
+  else if(BridgeState == SPDIF_BRIDGE_STATE_STREAM)
+  {
+    Bridge_Track();
+  }
+  else
+  {
+    /* Stopping */
+  }
+}
+
+/**
+  * @brief  Collect the channel status bits of channel A from a ring half
+  * @param  pWords: ring half, Frames / 2 stereo frames
+  * @retval None
+  */
+static void Bridge_DecodeStatus(const uint32_t *pWords)
+{
+  uint32_t frames = BridgeInit.Frames / 2U;
+  uint32_t word;
+  uint32_t i;
+  uint32_t j;
+
+  for(i = 0U; i < frames; i++)
+  {
+    word = pWords[2U * i];
+
+    if(((word >> BRIDGE_DR_PT_Pos) & 3U) == BRIDGE_DR_PT_B)
+    {
+      if(BridgeCsBit == BRIDGE_CS_BITS)
+      {
+        Bridge_StatusBlock();
+      }
+      BridgeCsBit = 0U;
+      for(j = 0U; j < sizeof(BridgeCsBytes); j++)
+      {
+        BridgeCsBytes[j] = 0U;
+      }
+    }
+
+    if(BridgeCsBit < BRIDGE_CS_BITS)
+    {
+      /* IEC 60958 sends each status byte LSB first */
+      if((word & BRIDGE_DR_C) != 0U)
+      {
+        BridgeCsBytes[BridgeCsBit / 8U] |= (uint8_t)(1U << (BridgeCsBit % 8U));
+      }
+      BridgeCsBit++;
+    }
+  }
+}
+
+/**
+  * @brief  Handle a complete channel status block
+  * @param  None
+  * @retval None
+  */
+static void Bridge_StatusBlock(void)
+{
+  uint32_t previous = BridgeStatus.Rate;
+  uint32_t changed = (BridgeStatusValid == 0U) ? 1U : 0U;
+  uint32_t rate = 0U;
+  uint32_t i;
+
+  for(i = 0U; i < sizeof(BridgeCsBytes); i++)
+  {
+    if((i < BRIDGE_CS_COMPARE) && (BridgeStatus.Bytes[i] != BridgeCsBytes[i]))
+    {
+      changed = 1U;
+    }
+    BridgeStatus.Bytes[i] = BridgeCsBytes[i];
+  }
+
+  if(changed == 0U)
+  {
+    return;
+  }
+
+  BridgeStatus.Professional = BridgeCsBytes[0] & 0x01U;
+  BridgeStatus.NonAudio = (BridgeCsBytes[0] >> 1) & 0x01U;
+
+  if(BridgeStatus.Professional != 0U)
+  {
+    /* Byte 0 bits 6-7 */
+    switch((BridgeCsBytes[0] >> 6) & 0x03U)
+    {
+    case 1U: rate = 48000U; break;
+    case 2U: rate = 44100U; break;
+    case 3U: rate = 32000U; break;
+    default: break;
+    }
+  }
+  else
+  {
+    /* Byte 3 bits 0-3 */
+    switch(BridgeCsBytes[3] & 0x0FU)
+    {
+    case 0x0U: rate = 44100U;  break;
+    case 0x2U: rate = 48000U;  break;
+    case 0x3U: rate = 32000U;  break;
+    case 0x8U: rate = 88200U;  break;
+    case 0xAU: rate = 96000U;  break;
+    case 0xCU: rate = 176400U; break;
+    case 0xEU: rate = 192000U; break;
+    default: break;
+    }
+  }
+  BridgeStatus.Rate = rate;
+
+  if(BridgeState == SPDIF_BRIDGE_STATE_STREAM)
+  {
+    if(BridgeStatus.NonAudio != 0U)
+    {
+      (void)HAL_SAI_EnableTxMuteMode(BridgeInit.hsai, SAI_ZERO_VALUE);
+    }
+    else
+    {
+      (void)HAL_SAI_DisableTxMuteMode(BridgeInit.hsai);
+    }
+  }
+
+  SPDIF_Bridge_ChannelStatusCallback(&BridgeStatus);
+
+  /* The source announces another rate: measure it again */
+  if((BridgeStatusValid != 0U) && (rate != 0U) && (rate != previous) && (rate != BridgeStats.Rate))
+  {
+    BridgeRestart = 1U;
+  }
+  BridgeStatusValid = 1U;
+}
+
+/**
+  * @brief  Measure the output lag and trim PLL2 to keep it at half the ring
+  * @param  None
+  * @retval None
+  */
+static void Bridge_Track(void)
+{
+  uint32_t words = 2U * BridgeInit.Frames;
+  uint32_t lag;
+  int32_t  trim;
+  int32_t  fracn;
+
+  lag = ((BRIDGE_DMA_WORD(BridgeInit.hspdif->hdmaDrRx) + words - BRIDGE_DMA_WORD(BridgeInit.hsai->hdmatx)) % words) / 2U;
+  BridgeStats.Lag = lag;
+
+  if((lag < BRIDGE_GUARD) || (lag > (BridgeInit.Frames - BRIDGE_GUARD)))
+  {
+    /* Slip: restart the output with the next first half */
+    (void)HAL_SAI_DMAStop(BridgeInit.hsai);
+    BridgeStats.Slips++;
+    BridgeState = SPDIF_BRIDGE_STATE_STARTING;
+    return;
+  }
+
+  BridgeErrSum += (int32_t)lag - (int32_t)(BridgeInit.Frames / 2U);
+  BridgeTrackCount++;
+  if(BridgeTrackCount < SPDIF_BRIDGE_TRACK_PERIOD)
+  {
+    return;
+  }
+
+  /* A growing lag means a slow output: raise its clock */
+  BridgeIntegral += BridgeErrSum;
+  trim = ((BridgeErrSum * SPDIF_BRIDGE_TRACK_KP) / (int32_t)SPDIF_BRIDGE_TRACK_PERIOD) +
+         (BridgeIntegral / SPDIF_BRIDGE_TRACK_KI);
+  if((trim > SPDIF_BRIDGE_MAX_TRIM) || (trim < -SPDIF_BRIDGE_MAX_TRIM))
+  {
+    /* Saturated: do not wind up the integral */
+    BridgeIntegral -= BridgeErrSum;
+    trim = (trim > 0) ? SPDIF_BRIDGE_MAX_TRIM : -SPDIF_BRIDGE_MAX_TRIM;
+  }
+  BridgeErrSum = 0;
+  BridgeTrackCount = 0U;
+
+  fracn = (int32_t)BridgeFracN + trim;
+  if(fracn < 0)
+  {
+    fracn = 0;
+  }
+  else if(fracn > BRIDGE_FRACN_MAX)
+  {
+    fracn = BRIDGE_FRACN_MAX;
+  }
+  else
+  {
+    /* In range */
+  }
+
+  /* FRACN is taken into account on the FRACEN rising edge, on the fly */
+  __HAL_RCC_PLL2FRACN_DISABLE();
+  __HAL_RCC_PLL2FRACN_CONFIG((uint32_t)fracn);
+  __HAL_RCC_PLL2FRACN_ENABLE();
+  BridgeStats.Trim = fracn - (int32_t)BridgeFracN;
+}
+
+/**
+  * @brief  Receiver DMA half transfer complete callback
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void Bridge_RxHalfCplt(DMA_HandleTypeDef *hdma)
+{
+  UNUSED(hdma);
+  Bridge_Receive(0U);
+}
+
+/**
+  * @brief  Receiver DMA transfer complete callback
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void Bridge_RxCplt(DMA_HandleTypeDef *hdma)
+{
+  UNUSED(hdma);
+  Bridge_Receive(1U);
+}
+
+/**
+  * @brief  Receiver DMA error callback
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void Bridge_RxError(DMA_HandleTypeDef *hdma)
+{
+  UNUSED(hdma);
+  BridgeStats.SyncErrors++;
+  Bridge_Fail();
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
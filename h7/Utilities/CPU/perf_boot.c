@@ -0,0 +1,565 @@
+/**
+  ******************************************************************************
+  * @file    perf_boot.c
+  * @author  MCD Application Team
+  * @brief   Flash latency, accelerator, cache and MPU bring-up
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- call PERF_Boot_Init() right after SystemClock_Config(). It sets the
+   fewest flash wait states allowed at the current HCLK and supply (VOS on
+   STM32H7, PERF_BOOT_VDD_MV on STM32F4/F7), then enables what the device
+   has of :
+      (++) the flash prefetch buffer and the instruction/data caches of the
+           STM32F4 flash interface,
+      (++) the ART accelerator of the STM32F7,
+      (++) the Cortex-M7 L1 instruction and data caches,
+   and with PERF_BOOT_MPU the default MPU regions :
+      (++) region 0: 0x60000000-0xDFFFFFFF, the FMC and QUADSPI windows,
+           strongly ordered and not executable, so that the Cortex-M7
+           never reads an external memory speculatively,
+      (++) region 1: the SDRAM (PERF_BOOT_SDRAM_ADDR/SIZE), write-back,
+      (++) region 2: the memory-mapped QUADSPI (PERF_BOOT_QSPI_SIZE),
+           write-through and read-only,
+      (++) region 3: the .dma_buffers section of the linker template with
+           PERF_BOOT_DMA_NOCACHE, non-cacheable. Its size must be a power
+           of 2 and its start aligned on its size.
+   Everything else keeps the default memory map.
+
+2- when the clock changes afterwards call PERF_Boot_SetFlashLatency() with
+   the new HCLK before raising the clock, after lowering it.
+
+3- call PERF_Boot_GetReport() to check the configuration reached: the
+   Warnings field flags accelerators left off and wait states that do not
+   match the clock.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "perf_boot.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define PERF_BOOT_MHZ                 1000000U
+
+/* MPU region numbers */
+#define PERF_BOOT_MPU_EXTERNAL        0U
+#define PERF_BOOT_MPU_SDRAM           1U
+#define PERF_BOOT_MPU_QSPI            2U
+#define PERF_BOOT_MPU_DMA             3U
+
+#define PERF_BOOT_MPU_INVALID         0xFFU
+
+#if !defined(QSPI_BASE)
+#define QSPI_BASE                     0x90000000U
+#endif
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+#if defined(FLASH_ACR_WRHIGHFREQ)
+/* Highest AXI clock per wait state and per VOS, in MHz (RM0433) */
+static const uint8_t PERF_Boot_Latency[3][5] =
+{
+  {  70U, 140U, 210U, 225U, 225U },   /* VOS1 */
+  {  55U, 110U, 165U, 225U, 225U },   /* VOS2 */
+  {  45U,  90U, 135U, 180U, 225U },   /* VOS3 */
+};
+
+/* Highest AXI clock per programming delay and per VOS, in MHz */
+static const uint8_t PERF_Boot_Delay[3][3] =
+{
+  {  70U, 185U, 225U },               /* VOS1 */
+  {  55U, 165U, 225U },               /* VOS2 */
+  {  45U, 135U, 225U },               /* VOS3 */
+};
+#endif
+
+#if (PERF_BOOT_DMA_NOCACHE == 1U)
+/* Linker template DMA buffers, weak so that they resolve to 0 with linker
+   scripts that do not provide them */
+extern uint8_t _sdma_buffers[] __attribute__((weak));
+extern uint8_t _edma_buffers[] __attribute__((weak));
+#endif
+
+/* Private function prototypes -----------------------------------------------*/
+#if defined(FLASH_ACR_WRHIGHFREQ)
+static uint32_t PERF_Boot_GetVoltageScale(void);
+#endif
+static uint32_t PERF_Boot_GetAvailable(void);
+static uint32_t PERF_Boot_GetFeatures(void);
+#if (__MPU_PRESENT == 1U)
+static uint8_t  PERF_Boot_MpuSize(uint32_t Address, uint32_t Size);
+#endif
+
+/* Functions Definition ------------------------------------------------------*/
+/**
+  * @brief  Set the flash wait states for the current clock and enable the
+  *         accelerators, the caches and the default MPU regions
+  * @param  None
+  * @retval HAL_ERROR when the wait states or an MPU region could not be set
+  */
+HAL_StatusTypeDef PERF_Boot_Init(void)
+{
+  HAL_StatusTypeDef status;
+
+  status = PERF_Boot_SetFlashLatency(HAL_RCC_GetHCLKFreq());
+
+#if (PERF_BOOT_MPU == 1U) && (__MPU_PRESENT == 1U)
+  /* The MPU goes first so that the D-cache never sees the external
+     memories with the default attributes */
+  if(PERF_Boot_ConfigMPU() != HAL_OK)
+  {
+    status = HAL_ERROR;
+  }
+#endif
+
+  PERF_Boot_EnableCaches();
+
+  return status;
+}
+
+/**
+  * @brief  Fewest flash wait states allowed at a clock
+  * @param  HclkFreq: flash clock (HCLK, AXI clock on STM32H7), in Hz
+  * @retval Wait states
+  */
+uint32_t PERF_Boot_GetFlashLatency(uint32_t HclkFreq)
+{
+  uint32_t latency;
+#if defined(FLASH_ACR_WRHIGHFREQ)
+  uint32_t vos = PERF_Boot_GetVoltageScale() - 1U;
+  uint32_t mhz = (HclkFreq + PERF_BOOT_MHZ - 1U) / PERF_BOOT_MHZ;
+
+  for(latency = 0U; latency < 4U; latency++)
+  {
+    if(mhz <= PERF_Boot_Latency[vos][latency])
+    {
+      break;
+    }
+  }
+#else
+  uint32_t step;
+
+  /* Same steps on STM32F4 and STM32F7 (RM0090, RM0385) */
+  if(PERF_BOOT_VDD_MV >= 2700U)
+  {
+    step = 30U * PERF_BOOT_MHZ;
+  }
+  else if(PERF_BOOT_VDD_MV >= 2400U)
+  {
+    step = 24U * PERF_BOOT_MHZ;
+  }
+  else if(PERF_BOOT_VDD_MV >= 2100U)
+  {
+    step = 22U * PERF_BOOT_MHZ;
+  }
+  else
+  {
+    step = 20U * PERF_BOOT_MHZ;
+  }
+
+  latency = (HclkFreq > 0U) ? ((HclkFreq - 1U) / step) : 0U;
+#endif
+
+  return latency;
+}
+
+/**
+  * @brief  Program the flash wait states for a clock
+  * @note   Call it with the new clock before raising the clock, after lowering it.
+  * @param  HclkFreq: flash clock (HCLK, AXI clock on STM32H7), in Hz
+  * @retval HAL_ERROR when the wait states needed are out of reach
+  */
+HAL_StatusTypeDef PERF_Boot_SetFlashLatency(uint32_t HclkFreq)
+{
+  uint32_t latency = PERF_Boot_GetFlashLatency(HclkFreq);
+#if defined(FLASH_ACR_WRHIGHFREQ)
+  uint32_t vos = PERF_Boot_GetVoltageScale() - 1U;
+  uint32_t mhz = (HclkFreq + PERF_BOOT_MHZ - 1U) / PERF_BOOT_MHZ;
+  uint32_t delay;
+
+  if(mhz > PERF_Boot_Latency[vos][4])
+  {
+    return HAL_ERROR;
+  }
+
+  for(delay = 0U; delay < 2U; delay++)
+  {
+    if(mhz <= PERF_Boot_Delay[vos][delay])
+    {
+      break;
+    }
+  }
+
+  MODIFY_REG(FLASH->ACR, FLASH_ACR_LATENCY | FLASH_ACR_WRHIGHFREQ,
+             (latency << FLASH_ACR_LATENCY_Pos) | (delay << FLASH_ACR_WRHIGHFREQ_Pos));
+#else
+  if(latency > (FLASH_ACR_LATENCY >> FLASH_ACR_LATENCY_Pos))
+  {
+    return HAL_ERROR;
+  }
+
+  MODIFY_REG(FLASH->ACR, FLASH_ACR_LATENCY, latency << FLASH_ACR_LATENCY_Pos);
+#endif
+
+  /* The new wait states apply once read back */
+  if(((FLASH->ACR & FLASH_ACR_LATENCY) >> FLASH_ACR_LATENCY_Pos) != latency)
+  {
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Enable the flash accelerators and the L1 caches the device has
+  * @param  None
+  * @retval None
+  */
+void PERF_Boot_EnableCaches(void)
+{
+#if defined(FLASH_ACR_ICEN)
+  /* The flash caches are reset while disabled */
+  if((FLASH->ACR & (FLASH_ACR_ICEN | FLASH_ACR_DCEN)) != (FLASH_ACR_ICEN | FLASH_ACR_DCEN))
+  {
+    FLASH->ACR &= ~(FLASH_ACR_ICEN | FLASH_ACR_DCEN);
+    FLASH->ACR |= (FLASH_ACR_ICRST | FLASH_ACR_DCRST);
+    FLASH->ACR &= ~(FLASH_ACR_ICRST | FLASH_ACR_DCRST);
+    FLASH->ACR |= (FLASH_ACR_ICEN | FLASH_ACR_DCEN);
+  }
+#endif
+
+#if defined(FLASH_ACR_ARTEN)
+  if((FLASH->ACR & FLASH_ACR_ARTEN) == 0U)
+  {
+    FLASH->ACR |= FLASH_ACR_ARTRST;
+    FLASH->ACR &= ~FLASH_ACR_ARTRST;
+    FLASH->ACR |= FLASH_ACR_ARTEN;
+  }
+#endif
+
+#if defined(FLASH_ACR_PRFTEN)
+  FLASH->ACR |= FLASH_ACR_PRFTEN;
+#endif
+
+#if defined(__ICACHE_PRESENT) && (__ICACHE_PRESENT == 1U) && (PERF_BOOT_ICACHE == 1U)
+  if((SCB->CCR & SCB_CCR_IC_Msk) == 0U)
+  {
+    SCB_EnableICache();
+  }
+#endif
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U) && (PERF_BOOT_DCACHE == 1U)
+  if((SCB->CCR & SCB_CCR_DC_Msk) == 0U)
+  {
+    SCB_EnableDCache();
+  }
+#endif
+}
+
+/**
+  * @brief  Program the default MPU regions, see the NOTES
+  * @param  None
+  * @retval HAL_ERROR when an external memory or the DMA buffers cannot be
+  *         described by one region, the other regions are set all the same
+  */
+HAL_StatusTypeDef PERF_Boot_ConfigMPU(void)
+{
+#if (__MPU_PRESENT == 1U)
+  MPU_Region_InitTypeDef region;
+  HAL_StatusTypeDef status = HAL_OK;
+#if (PERF_BOOT_DMA_NOCACHE == 1U)
+  uint32_t size;
+#endif
+
+  HAL_MPU_Disable();
+
+  /* External windows: strongly ordered, never accessed speculatively */
+  region.Enable           = MPU_REGION_ENABLE;
+  region.Number           = PERF_BOOT_MPU_EXTERNAL;
+  region.BaseAddress      = 0x00000000U;
+  region.Size             = MPU_REGION_SIZE_4GB;
+  region.SubRegionDisable = 0x87U;
+  region.TypeExtField     = MPU_TEX_LEVEL0;
+  region.AccessPermission = MPU_REGION_FULL_ACCESS;
+  region.DisableExec      = MPU_INSTRUCTION_ACCESS_DISABLE;
+  region.IsShareable      = MPU_ACCESS_SHAREABLE;
+  region.IsCacheable      = MPU_ACCESS_NOT_CACHEABLE;
+  region.IsBufferable     = MPU_ACCESS_NOT_BUFFERABLE;
+  HAL_MPU_ConfigRegion(&region);
+
+  /* SDRAM: normal memory, write-back read and write allocate */
+  region.Number           = PERF_BOOT_MPU_SDRAM;
+  region.Enable           = MPU_REGION_DISABLE;
+  region.BaseAddress      = PERF_BOOT_SDRAM_ADDR;
+  region.Size             = PERF_Boot_MpuSize(PERF_BOOT_SDRAM_ADDR, PERF_BOOT_SDRAM_SIZE);
+  region.SubRegionDisable = 0x00U;
+  region.TypeExtField     = MPU_TEX_LEVEL1;
+  region.DisableExec      = MPU_INSTRUCTION_ACCESS_ENABLE;
+  region.IsShareable      = MPU_ACCESS_NOT_SHAREABLE;
+  region.IsCacheable      = MPU_ACCESS_CACHEABLE;
+  region.IsBufferable     = MPU_ACCESS_BUFFERABLE;
+  if(region.Size != PERF_BOOT_MPU_INVALID)
+  {
+    region.Enable = MPU_REGION_ENABLE;
+  }
+  else if(PERF_BOOT_SDRAM_SIZE != 0U)
+  {
+    status = HAL_ERROR;
+  }
+  else
+  {
+    region.Size = MPU_REGION_SIZE_32B;
+  }
+  HAL_MPU_ConfigRegion(&region);
+
+  /* QUADSPI: normal memory, write-through, read-only */
+  region.Number           = PERF_BOOT_MPU_QSPI;
+  region.Enable           = MPU_REGION_DISABLE;
+  region.BaseAddress      = QSPI_BASE;
+  region.Size             = PERF_Boot_MpuSize(QSPI_BASE, PERF_BOOT_QSPI_SIZE);
+  region.TypeExtField     = MPU_TEX_LEVEL0;
+  region.AccessPermission = MPU_REGION_PRIV_RO_URO;
+  region.IsBufferable     = MPU_ACCESS_NOT_BUFFERABLE;
+  if(region.Size != PERF_BOOT_MPU_INVALID)
+  {
+    region.Enable = MPU_REGION_ENABLE;
+  }
+  else if(PERF_BOOT_QSPI_SIZE != 0U)
+  {
+    status = HAL_ERROR;
+  }
+  else
+  {
+    region.Size = MPU_REGION_SIZE_32B;
+  }
+  HAL_MPU_ConfigRegion(&region);
+
+#if (PERF_BOOT_DMA_NOCACHE == 1U)
+  /* DMA buffers: normal memory, not cacheable */
+  size = (uint32_t)(_edma_buffers - _sdma_buffers);
+  region.Number           = PERF_BOOT_MPU_DMA;
+  region.Enable           = MPU_REGION_DISABLE;
+  region.BaseAddress      = (uint32_t)_sdma_buffers;
+  region.Size             = PERF_Boot_MpuSize((uint32_t)_sdma_buffers, size);
+  region.TypeExtField     = MPU_TEX_LEVEL1;
+  region.AccessPermission = MPU_REGION_FULL_ACCESS;
+  region.DisableExec      = MPU_INSTRUCTION_ACCESS_DISABLE;
+  region.IsShareable      = MPU_ACCESS_SHAREABLE;
+  region.IsCacheable      = MPU_ACCESS_NOT_CACHEABLE;
+  region.IsBufferable     = MPU_ACCESS_NOT_BUFFERABLE;
+  if(region.Size != PERF_BOOT_MPU_INVALID)
+  {
+    region.Enable = MPU_REGION_ENABLE;
+  }
+  else
+  {
+    region.BaseAddress = 0x00000000U;
+    region.Size = MPU_REGION_SIZE_32B;
+    if(size != 0U)
+    {
+      status = HAL_ERROR;
+    }
+  }
+  HAL_MPU_ConfigRegion(&region);
+#endif
+
+  /* Default memory map for what the regions do not cover */
+  HAL_MPU_Enable(MPU_PRIVILEGED_DEFAULT);
+
+  return status;
+#else
+  return HAL_ERROR;
+#endif
+}
+
+/**
+  * @brief  Read back the clock, flash, accelerator, cache and MPU settings
+  * @param  pReport: filled with the configuration in force
+  * @retval None
+  */
+void PERF_Boot_GetReport(PERF_Boot_ReportTypeDef *pReport)
+{
+#if (__MPU_PRESENT == 1U)
+  uint32_t number;
+#endif
+
+  pReport->HclkFreq = HAL_RCC_GetHCLKFreq();
+#if defined(FLASH_ACR_WRHIGHFREQ)
+  pReport->VoltageScale = PERF_Boot_GetVoltageScale();
+#else
+  pReport->VoltageScale = 0U;
+#endif
+  pReport->FlashLatency = (FLASH->ACR & FLASH_ACR_LATENCY) >> FLASH_ACR_LATENCY_Pos;
+  pReport->FlashLatencyMin = PERF_Boot_GetFlashLatency(pReport->HclkFreq);
+  pReport->Available = PERF_Boot_GetAvailable();
+  pReport->Features = PERF_Boot_GetFeatures();
+  pReport->MpuRegions = 0U;
+
+#if (__MPU_PRESENT == 1U)
+  if((MPU->CTRL & MPU_CTRL_ENABLE_Msk) != 0U)
+  {
+    for(number = 0U; number < ((MPU->TYPE & MPU_TYPE_DREGION_Msk) >> MPU_TYPE_DREGION_Pos); number++)
+    {
+      MPU->RNR = number;
+      if((MPU->RASR & MPU_RASR_ENABLE_Msk) != 0U)
+      {
+        pReport->MpuRegions++;
+      }
+    }
+  }
+#endif
+
+  pReport->Warnings = pReport->Available & ~pReport->Features & ~PERF_BOOT_FEAT_MPU;
+  if(pReport->FlashLatency > pReport->FlashLatencyMin)
+  {
+    pReport->Warnings |= PERF_BOOT_WARN_LATENCY_HIGH;
+  }
+  else if(pReport->FlashLatency < pReport->FlashLatencyMin)
+  {
+    pReport->Warnings |= PERF_BOOT_WARN_LATENCY_LOW;
+  }
+#if (PERF_BOOT_DMA_NOCACHE == 1U)
+  if(PERF_Boot_MpuSize((uint32_t)_sdma_buffers, (uint32_t)(_edma_buffers - _sdma_buffers)) == PERF_BOOT_MPU_INVALID)
+  {
+    pReport->Warnings |= PERF_BOOT_WARN_MPU_DMA;
+  }
+#endif
+}
+
+/* Private functions ---------------------------------------------------------*/
+#if defined(FLASH_ACR_WRHIGHFREQ)
+/**
+  * @brief  Voltage scale of the STM32H7 core supply
+  * @param  None
+  * @retval VOS 1 to 3
+  */
+static uint32_t PERF_Boot_GetVoltageScale(void)
+{
+  switch(PWR->D3CR & PWR_D3CR_VOS)
+  {
+    case PWR_REGULATOR_VOLTAGE_SCALE3:
+      return 3U;
+    case PWR_REGULATOR_VOLTAGE_SCALE2:
+      return 2U;
+    default:
+      return 1U;
+  }
+}
+#endif
+
+/**
+  * @brief  Accelerators the device has
+  * @param  None
+  * @retval PERF_BOOT_FEAT_xxx bits
+  */
+static uint32_t PERF_Boot_GetAvailable(void)
+{
+  uint32_t available = 0U;
+
+#if defined(FLASH_ACR_PRFTEN)
+  available |= PERF_BOOT_FEAT_PREFETCH;
+#endif
+#if defined(FLASH_ACR_ICEN)
+  available |= PERF_BOOT_FEAT_FLASH_ICACHE | PERF_BOOT_FEAT_FLASH_DCACHE;
+#endif
+#if defined(FLASH_ACR_ARTEN)
+  available |= PERF_BOOT_FEAT_ART;
+#endif
+#if defined(__ICACHE_PRESENT) && (__ICACHE_PRESENT == 1U)
+  available |= PERF_BOOT_FEAT_ICACHE;
+#endif
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  available |= PERF_BOOT_FEAT_DCACHE;
+#endif
+#if (__MPU_PRESENT == 1U)
+  available |= PERF_BOOT_FEAT_MPU;
+#endif
+
+  return available;
+}
+
+/**
+  * @brief  Accelerators enabled
+  * @param  None
+  * @retval PERF_BOOT_FEAT_xxx bits
+  */
+static uint32_t PERF_Boot_GetFeatures(void)
+{
+  uint32_t features = 0U;
+
+#if defined(FLASH_ACR_PRFTEN)
+  features |= ((FLASH->ACR & FLASH_ACR_PRFTEN) != 0U) ? PERF_BOOT_FEAT_PREFETCH : 0U;
+#endif
+#if defined(FLASH_ACR_ICEN)
+  features |= ((FLASH->ACR & FLASH_ACR_ICEN) != 0U) ? PERF_BOOT_FEAT_FLASH_ICACHE : 0U;
+  features |= ((FLASH->ACR & FLASH_ACR_DCEN) != 0U) ? PERF_BOOT_FEAT_FLASH_DCACHE : 0U;
+#endif
+#if defined(FLASH_ACR_ARTEN)
+  features |= ((FLASH->ACR & FLASH_ACR_ARTEN) != 0U) ? PERF_BOOT_FEAT_ART : 0U;
+#endif
+#if defined(__ICACHE_PRESENT) && (__ICACHE_PRESENT == 1U)
+  features |= ((SCB->CCR & SCB_CCR_IC_Msk) != 0U) ? PERF_BOOT_FEAT_ICACHE : 0U;
+#endif
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  features |= ((SCB->CCR & SCB_CCR_DC_Msk) != 0U) ? PERF_BOOT_FEAT_DCACHE : 0U;
+#endif
+#if (__MPU_PRESENT == 1U)
+  features |= ((MPU->CTRL & MPU_CTRL_ENABLE_Msk) != 0U) ? PERF_BOOT_FEAT_MPU : 0U;
+#endif
+
+  return features;
+}
+
+#if (__MPU_PRESENT == 1U)
+/**
+  * @brief  MPU region size field of a memory range
+  * @param  Address: range start
+  * @param  Size: range size in bytes
+  * @retval MPU_REGION_SIZE_xxx, PERF_BOOT_MPU_INVALID when the size is not a
+  *         power of 2 of 32 bytes or more, or the start is not aligned on it
+  */
+static uint8_t PERF_Boot_MpuSize(uint32_t Address, uint32_t Size)
+{
+  if((Size < 32U) || ((Size & (Size - 1U)) != 0U) || ((Address & (Size - 1U)) != 0U))
+  {
+    return PERF_BOOT_MPU_INVALID;
+  }
+
+  /* MPU_REGION_SIZE_xxx is log2(Size) - 1 */
+  return (uint8_t)(30U - __CLZ(Size));
+}
+#endif
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,134 @@
+/**
+  ******************************************************************************
+  * @file    perf_boot.h
+  * @author  MCD Application Team
+  * @brief   Header for perf_boot module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _PERF_BOOT_H__
+#define _PERF_BOOT_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t  HclkFreq;          /* Flash clock (HCLK, AXI clock on STM32H7), in Hz */
+  uint32_t  VoltageScale;      /* STM32H7 VOS 1 to 3, else 0                    */
+  uint32_t  FlashLatency;      /* Wait states programmed                        */
+  uint32_t  FlashLatencyMin;   /* Fewest wait states allowed at HclkFreq        */
+  uint32_t  Features;          /* PERF_BOOT_FEAT_xxx enabled                    */
+  uint32_t  Available;         /* PERF_BOOT_FEAT_xxx the device has             */
+  uint32_t  MpuRegions;        /* MPU regions enabled                           */
+  uint32_t  Warnings;          /* PERF_BOOT_WARN_xxx                            */
+} PERF_Boot_ReportTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Accelerators, Features and Available bits */
+#define PERF_BOOT_FEAT_PREFETCH       0x01U   /* Flash prefetch buffer          */
+#define PERF_BOOT_FEAT_FLASH_ICACHE   0x02U   /* Flash instruction cache (F4)   */
+#define PERF_BOOT_FEAT_FLASH_DCACHE   0x04U   /* Flash data cache (F4)          */
+#define PERF_BOOT_FEAT_ART            0x08U   /* ART accelerator (F7)           */
+#define PERF_BOOT_FEAT_ICACHE         0x10U   /* Cortex-M7 L1 instruction cache */
+#define PERF_BOOT_FEAT_DCACHE         0x20U   /* Cortex-M7 L1 data cache        */
+#define PERF_BOOT_FEAT_MPU            0x40U   /* MPU enabled                    */
+
+/* Warnings: the PERF_BOOT_FEAT_xxx bits of the accelerators left off, plus */
+#define PERF_BOOT_WARN_LATENCY_HIGH   0x0100U /* More wait states than needed   */
+#define PERF_BOOT_WARN_LATENCY_LOW    0x0200U /* Fewer wait states than needed  */
+#define PERF_BOOT_WARN_MPU_DMA        0x0400U /* DMA buffers not a valid region */
+
+/* Supply voltage, in mV, for the wait states of STM32F4/F7. Override in main.h. */
+#if !defined(PERF_BOOT_VDD_MV)
+#define PERF_BOOT_VDD_MV              3300U
+#endif
+
+/* Set to 0 to leave the L1 caches off, as code that does not maintain the
+   D-cache around DMA transfers requires. Override in main.h. */
+#if !defined(PERF_BOOT_ICACHE)
+#define PERF_BOOT_ICACHE              1U
+#endif
+#if !defined(PERF_BOOT_DCACHE)
+#define PERF_BOOT_DCACHE              1U
+#endif
+
+/* Set to 0 to leave the MPU alone. Override in main.h. */
+#if !defined(PERF_BOOT_MPU)
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+#define PERF_BOOT_MPU                 1U
+#else
+#define PERF_BOOT_MPU                 0U
+#endif
+#endif
+
+/* External memories given a cacheable MPU region, size 0 for none. The
+   SDRAM is normal write-back memory, the memory-mapped QUADSPI normal
+   write-through read-only memory. Override in main.h. */
+#if !defined(PERF_BOOT_SDRAM_ADDR)
+#define PERF_BOOT_SDRAM_ADDR          0xC0000000U
+#endif
+#if !defined(PERF_BOOT_SDRAM_SIZE)
+#define PERF_BOOT_SDRAM_SIZE          0U
+#endif
+#if !defined(PERF_BOOT_QSPI_SIZE)
+#define PERF_BOOT_QSPI_SIZE           0U
+#endif
+
+/* Set to 1 to make the linker script .dma_buffers section non-cacheable,
+   instead of maintaining the D-cache around each transfer. Override in main.h. */
+#if !defined(PERF_BOOT_DMA_NOCACHE)
+#define PERF_BOOT_DMA_NOCACHE         0U
+#endif
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef PERF_Boot_Init(void);
+uint32_t          PERF_Boot_GetFlashLatency(uint32_t HclkFreq);
+HAL_StatusTypeDef PERF_Boot_SetFlashLatency(uint32_t HclkFreq);
+void              PERF_Boot_EnableCaches(void);
+HAL_StatusTypeDef PERF_Boot_ConfigMPU(void);
+void              PERF_Boot_GetReport(PERF_Boot_ReportTypeDef *pReport);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _PERF_BOOT_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,788 @@
+/**
+  ******************************************************************************
+  * @file    periph_bench.c
+  * @author  MCD Application Team
+  * @brief   Peripheral throughput, CPU load and latency benchmark of
+  *          the polling, IT and DMA paths of the HAL drivers
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- call PERIPH_Bench_Init() once the HAL and the peripherals benchmarked
+   are initialized. It starts the cycle counter and measures the idle loop
+   the CPU load is computed from.
+
+2- forward the HAL complete and error callbacks of these peripherals to
+   PERIPH_Bench_Complete(), e.g. :
+      void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
+      {
+        PERIPH_Bench_Complete(HAL_OK);
+      }
+      void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi)
+      {
+        PERIPH_Bench_Complete(HAL_ERROR);
+      }
+   and likewise for the RxCplt, TxRxCplt callbacks, HAL_UART_xxx,
+   HAL_QSPI_xxx and HAL_SD_xxx (TxCplt, RxCplt, Error, Abort).
+
+3- describe each peripheral path with a PERIPH_Bench_TargetTypeDef: the
+   operations PERIPH_Bench_SPI, PERIPH_Bench_UART, PERIPH_Bench_QSPI or
+   PERIPH_Bench_SD, those the part and its HAL have, with their HAL handle
+   or context, a direction and the modes to run, e.g. :
+      static const PERIPH_Bench_TargetTypeDef SpiTx =
+        { "spi1", &PERIPH_Bench_SPI, &hspi1, PERIPH_BENCH_DIR_TX, PERIPH_BENCH_MODES_ALL };
+   The receive paths need a sender: UART TX wired to RX or a host
+   sending, QSPI read command of the memory. SD targets use the card area
+   from BlockAdd, overwritten by the TX target. For USB, ETH or any other
+   path, the application gives its own operations: with the CDC class of
+   the USB device library, USBD_CDC_SetTxBuffer() and
+   USBD_CDC_TransmitPacket() as pStart and a pWait polling the TxState of
+   the class back to 0, in IT or DMA mode as the PCD is configured. The
+   ETH frame rate and round trip latency are measured by ETH/eth_bench.
+
+4- call PERIPH_Bench_Run() for each target with a buffer of the largest
+   transfer (twice that for PERIPH_BENCH_DIR_TXRX). Each mode and size of
+   PERIPH_BENCH_SIZES is run a number of times and gives one result:
+   throughput, CPU load and transfer latency (min, mean, max). The buffer
+   is in a memory reached by the DMA controllers of the peripheral; its
+   content is not checked, so on parts with a D-cache no cache
+   maintenance is done.
+
+5- read the results with PERIPH_Bench_GetResult(), or get them all as a
+   JSON document with PERIPH_Bench_Report() to send over a console. The
+   board (VARIANT_BOARD), HAL version and core clock are part of it, so
+   that OSQ/ldscripts/tpl/bench_diff.py compares the reports of two HAL
+   releases or two boards.
+
+   The latency is taken from the start call to the completion callback,
+   or to the end of the pWait operation (SD card programming). The CPU
+   load is the part of that time not spent in the loop waiting for the
+   completion: in polling mode it is 100%, in IT and DMA modes it is the
+   interrupt handlers, the callbacks, the pWait polling and the start and
+   completion overhead. Other interrupts of the application count as load,
+   so they should be quiet during a run.
+   Cortex-M0/M0+ have no DWT cycle counter: the HAL tick and the SysTick
+   current value are combined instead, with a lower resolution.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "periph_bench.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Idle loop runs of the calibration */
+#define PERIPH_BENCH_CALIBRATION     64U
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static PERIPH_Bench_ResultTypeDef PERIPH_Bench_Results[PERIPH_BENCH_MAX_RESULTS];
+static uint32_t                   PERIPH_Bench_Count = 0U;
+static __IO uint32_t              PERIPH_Bench_Done = 0U;
+static __IO HAL_StatusTypeDef     PERIPH_Bench_Status = HAL_OK;
+static uint32_t                   PERIPH_Bench_LoopCycles = 0U;   /* Cycles per idle loop, 24.8 */
+
+static const char * const PERIPH_Bench_ModeName[] = { "poll", "it", "dma" };
+static const char * const PERIPH_Bench_DirName[]  = { "tx", "rx", "txrx" };
+
+/* Private function prototypes -----------------------------------------------*/
+static HAL_StatusTypeDef PERIPH_Bench_Measure(const PERIPH_Bench_TargetTypeDef *pTarget, uint32_t Mode,
+                                              uint8_t *pBuffer, uint32_t Size, PERIPH_Bench_ResultTypeDef *pResult);
+static uint32_t PERIPH_Bench_Idle(uint32_t Limit, uint32_t Timeout);
+static uint32_t PERIPH_Bench_Now(void);
+static void     PERIPH_Bench_Append(char *pBuffer, uint32_t Size, uint32_t *pLength, const char *pFormat, ...);
+
+#if defined(HAL_SPI_MODULE_ENABLED)
+static HAL_StatusTypeDef PERIPH_Bench_SPI_Start(void *pContext, uint32_t Mode, uint32_t Direction, uint8_t *pData, uint32_t Size);
+static HAL_StatusTypeDef PERIPH_Bench_SPI_Abort(void *pContext, uint32_t Mode);
+#endif
+#if defined(HAL_UART_MODULE_ENABLED)
+static HAL_StatusTypeDef PERIPH_Bench_UART_Start(void *pContext, uint32_t Mode, uint32_t Direction, uint8_t *pData, uint32_t Size);
+static HAL_StatusTypeDef PERIPH_Bench_UART_Abort(void *pContext, uint32_t Mode);
+#endif
+#if defined(HAL_QSPI_MODULE_ENABLED) && defined(QUADSPI)
+static HAL_StatusTypeDef PERIPH_Bench_QSPI_Start(void *pContext, uint32_t Mode, uint32_t Direction, uint8_t *pData, uint32_t Size);
+static HAL_StatusTypeDef PERIPH_Bench_QSPI_Abort(void *pContext, uint32_t Mode);
+#endif
+#if defined(HAL_SD_MODULE_ENABLED) && (defined(SDIO) || defined(SDMMC1))
+static HAL_StatusTypeDef PERIPH_Bench_SD_Start(void *pContext, uint32_t Mode, uint32_t Direction, uint8_t *pData, uint32_t Size);
+static HAL_StatusTypeDef PERIPH_Bench_SD_Abort(void *pContext, uint32_t Mode);
+static HAL_StatusTypeDef PERIPH_Bench_SD_Wait(void *pContext, uint32_t Timeout);
+#endif
+
+/* Exported variables --------------------------------------------------------*/
+#if defined(HAL_SPI_MODULE_ENABLED)
+const PERIPH_Bench_OpsTypeDef PERIPH_Bench_SPI =
+{
+  PERIPH_Bench_SPI_Start, PERIPH_Bench_SPI_Abort, NULL, 1U, 0xFFFFU
+};
+#endif
+
+#if defined(HAL_UART_MODULE_ENABLED)
+const PERIPH_Bench_OpsTypeDef PERIPH_Bench_UART =
+{
+  PERIPH_Bench_UART_Start, PERIPH_Bench_UART_Abort, NULL, 1U, 0xFFFFU
+};
+#endif
+
+#if defined(HAL_QSPI_MODULE_ENABLED) && defined(QUADSPI)
+/* DMA transfers up to 65535 bytes */
+const PERIPH_Bench_OpsTypeDef PERIPH_Bench_QSPI =
+{
+  PERIPH_Bench_QSPI_Start, PERIPH_Bench_QSPI_Abort, NULL, 1U, 0xFFFFU
+};
+#endif
+
+#if defined(HAL_SD_MODULE_ENABLED) && (defined(SDIO) || defined(SDMMC1))
+const PERIPH_Bench_OpsTypeDef PERIPH_Bench_SD =
+{
+  PERIPH_Bench_SD_Start, PERIPH_Bench_SD_Abort, PERIPH_Bench_SD_Wait, BLOCKSIZE, 0xFFFFFE00U
+};
+#endif
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Start the cycle counter and measure the idle loop
+  * @param  None
+  * @retval None
+  */
+void PERIPH_Bench_Init(void)
+{
+  uint32_t start;
+  uint32_t cycles;
+  uint32_t i;
+
+#if (__CORTEX_M >= 3U)
+  /* Enable the DWT cycle counter */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#if (__CORTEX_M == 7U)
+  DWT->LAR = 0xC5ACCE55U;
+#endif
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+  /* Shortest of a few runs, the interrupted ones are longer */
+  PERIPH_Bench_Done = 0U;
+  PERIPH_Bench_LoopCycles = 0xFFFFFFFFU;
+  for(i = 0U; i < 8U; i++)
+  {
+    start  = PERIPH_Bench_Now();
+    (void)PERIPH_Bench_Idle(PERIPH_BENCH_CALIBRATION, 0xFFFFFFFFU);
+    cycles = PERIPH_Bench_Now() - start;
+    if(((cycles << 8) / PERIPH_BENCH_CALIBRATION) < PERIPH_Bench_LoopCycles)
+    {
+      PERIPH_Bench_LoopCycles = (cycles << 8) / PERIPH_BENCH_CALIBRATION;
+    }
+  }
+
+  PERIPH_Bench_Reset();
+}
+
+/**
+  * @brief  Clear the results
+  * @param  None
+  * @retval None
+  */
+void PERIPH_Bench_Reset(void)
+{
+  PERIPH_Bench_Count = 0U;
+  memset(PERIPH_Bench_Results, 0, sizeof(PERIPH_Bench_Results));
+}
+
+/**
+  * @brief  Run the modes and sizes of a target, one result each
+  * @param  pTarget: peripheral path, kept by the module for its name
+  * @param  pBuffer: transfer buffer
+  * @param  Size: buffer size in bytes
+  * @retval HAL_OK, HAL_ERROR when the results are full, HAL_TIMEOUT when a
+  *         transfer could not be stopped: the peripheral is left busy
+  */
+HAL_StatusTypeDef PERIPH_Bench_Run(const PERIPH_Bench_TargetTypeDef *pTarget, uint8_t *pBuffer, uint32_t Size)
+{
+  static const uint32_t sizes[] = { PERIPH_BENCH_SIZES };
+  const PERIPH_Bench_OpsTypeDef *ops;
+  HAL_StatusTypeDef             status;
+  uint32_t                      mode;
+  uint32_t                      span;
+  uint32_t                      i;
+
+  if((pTarget == NULL) || (pTarget->Name == NULL) || (pTarget->pOps == NULL) ||
+     (pTarget->pOps->pStart == NULL) || (pTarget->pOps->Granule == 0U) ||
+     (pTarget->Direction > PERIPH_BENCH_DIR_TXRX) || (pBuffer == NULL))
+  {
+    return HAL_ERROR;
+  }
+  ops = pTarget->pOps;
+
+  for(mode = PERIPH_BENCH_MODE_POLL; mode <= PERIPH_BENCH_MODE_DMA; mode++)
+  {
+    if((pTarget->Modes & PERIPH_BENCH_MODE_BIT(mode)) == 0U)
+    {
+      continue;
+    }
+
+    for(i = 0U; i < (sizeof(sizes) / sizeof(sizes[0])); i++)
+    {
+      span = (pTarget->Direction == PERIPH_BENCH_DIR_TXRX) ? (2U * sizes[i]) : sizes[i];
+      if(((sizes[i] % ops->Granule) != 0U) || (sizes[i] > ops->MaxSize) || (span > Size))
+      {
+        continue;
+      }
+      if(PERIPH_Bench_Count >= PERIPH_BENCH_MAX_RESULTS)
+      {
+        return HAL_ERROR;
+      }
+
+      status = PERIPH_Bench_Measure(pTarget, mode, pBuffer, sizes[i], &PERIPH_Bench_Results[PERIPH_Bench_Count]);
+      PERIPH_Bench_Count++;
+      if(status != HAL_OK)
+      {
+        return status;
+      }
+    }
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  End of the transfer in IT and DMA modes, called from the HAL
+  *         complete and error callbacks
+  * @param  Status: HAL_OK on completion, HAL_ERROR on error
+  * @retval None
+  */
+void PERIPH_Bench_Complete(HAL_StatusTypeDef Status)
+{
+  PERIPH_Bench_Status = Status;
+  PERIPH_Bench_Done   = 1U;
+}
+
+/**
+  * @brief  Copy a result
+  * @param  Index: result, from 0 in the order of the runs
+  * @param  pResult: destination of the result
+  * @retval HAL_OK, HAL_ERROR when there is no such result
+  */
+HAL_StatusTypeDef PERIPH_Bench_GetResult(uint32_t Index, PERIPH_Bench_ResultTypeDef *pResult)
+{
+  if((Index >= PERIPH_Bench_Count) || (pResult == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  *pResult = PERIPH_Bench_Results[Index];
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Write every result as JSON
+  * @param  pBuffer: destination, zero terminated
+  * @param  Size: destination size in bytes
+  * @retval Length of the report, 0 when it does not fit
+  */
+uint32_t PERIPH_Bench_Report(char *pBuffer, uint32_t Size)
+{
+  PERIPH_Bench_ResultTypeDef *result;
+  uint32_t                   length = 0U;
+  uint32_t                   i;
+
+  if((pBuffer == NULL) || (Size == 0U))
+  {
+    return 0U;
+  }
+
+  PERIPH_Bench_Append(pBuffer, Size, &length,
+                      "{\"bench\":\"periph\",\"board\":\"%s\",\"hal\":\"0x%08lx\",\"core\":%lu,\"counter\":\"%s\",\"results\":[",
+                      PERIPH_BENCH_BOARD, (unsigned long)HAL_GetHalVersion(), (unsigned long)SystemCoreClock,
+#if (__CORTEX_M >= 3U)
+                      "dwt");
+#else
+                      "systick");
+#endif
+
+  for(i = 0U; i < PERIPH_Bench_Count; i++)
+  {
+    result = &PERIPH_Bench_Results[i];
+    PERIPH_Bench_Append(pBuffer, Size, &length,
+                        "%s{\"name\":\"%s\",\"dir\":\"%s\",\"mode\":\"%s\",\"size\":%lu,\"count\":%lu,\"errors\":%lu,",
+                        (i != 0U) ? "," : "", result->Name, PERIPH_Bench_DirName[result->Direction],
+                        PERIPH_Bench_ModeName[result->Mode], (unsigned long)result->Size,
+                        (unsigned long)result->Count, (unsigned long)result->Errors);
+    PERIPH_Bench_Append(pBuffer, Size, &length,
+                        "\"throughput\":%lu,\"load\":%lu,\"latency\":{\"min\":%lu,\"max\":%lu,\"mean\":%lu}}",
+                        (unsigned long)result->Throughput, (unsigned long)result->Load,
+                        (unsigned long)result->LatencyMin, (unsigned long)result->LatencyMax,
+                        (unsigned long)result->LatencyMean);
+  }
+
+  PERIPH_Bench_Append(pBuffer, Size, &length, "]}\n");
+
+  if(length >= Size)
+  {
+    pBuffer[Size - 1U] = '\0';
+    return 0U;
+  }
+
+  return length;
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Run the transfers of one mode and size
+  * @param  pTarget: peripheral path
+  * @param  Mode: PERIPH_BENCH_MODE_xxx
+  * @param  pBuffer: transfer buffer
+  * @param  Size: bytes per transfer
+  * @param  pResult: result, filled
+  * @retval HAL_OK, HAL_TIMEOUT when a transfer could not be stopped
+  */
+static HAL_StatusTypeDef PERIPH_Bench_Measure(const PERIPH_Bench_TargetTypeDef *pTarget, uint32_t Mode,
+                                              uint8_t *pBuffer, uint32_t Size, PERIPH_Bench_ResultTypeDef *pResult)
+{
+  const PERIPH_Bench_OpsTypeDef *ops = pTarget->pOps;
+  HAL_StatusTypeDef             status;
+  uint64_t                      total = 0U;
+  uint64_t                      idle = 0U;
+  uint32_t                      tickstart = HAL_GetTick();
+  uint32_t                      start;
+  uint32_t                      cycles;
+  uint32_t                      loops;
+  HAL_StatusTypeDef             result = HAL_OK;
+
+  memset(pResult, 0, sizeof(*pResult));
+  pResult->Name       = pTarget->Name;
+  pResult->Direction  = pTarget->Direction;
+  pResult->Mode       = Mode;
+  pResult->Size       = Size;
+  pResult->LatencyMin = 0xFFFFFFFFU;
+
+  while(((pResult->Count + pResult->Errors) < PERIPH_BENCH_MIN_COUNT) ||
+        (((pResult->Count + pResult->Errors) < PERIPH_BENCH_MAX_COUNT) &&
+         ((HAL_GetTick() - tickstart) < PERIPH_BENCH_DURATION)))
+  {
+    loops = 0U;
+    PERIPH_Bench_Done   = 0U;
+    PERIPH_Bench_Status = HAL_OK;
+
+    start  = PERIPH_Bench_Now();
+    status = ops->pStart(pTarget->pContext, Mode, pTarget->Direction, pBuffer, Size);
+    if((status == HAL_OK) && (Mode != PERIPH_BENCH_MODE_POLL))
+    {
+      loops = PERIPH_Bench_Idle(0xFFFFFFFFU, PERIPH_BENCH_TIMEOUT);
+      if(PERIPH_Bench_Done == 0U)
+      {
+        /* No completion: stop the transfer, or leave the peripheral busy */
+        pResult->Errors++;
+        if((ops->pAbort == NULL) || (ops->pAbort(pTarget->pContext, Mode) != HAL_OK))
+        {
+          result = HAL_TIMEOUT;
+          break;
+        }
+        continue;
+      }
+      status = PERIPH_Bench_Status;
+    }
+    if((status == HAL_OK) && (ops->pWait != NULL))
+    {
+      status = ops->pWait(pTarget->pContext, PERIPH_BENCH_TIMEOUT);
+    }
+    cycles = PERIPH_Bench_Now() - start;
+
+    if(status != HAL_OK)
+    {
+      pResult->Errors++;
+      continue;
+    }
+
+    pResult->Count++;
+    total += cycles;
+    idle  += ((uint64_t)loops * PERIPH_Bench_LoopCycles) >> 8;
+    if(cycles < pResult->LatencyMin)
+    {
+      pResult->LatencyMin = cycles;
+    }
+    if(cycles > pResult->LatencyMax)
+    {
+      pResult->LatencyMax = cycles;
+    }
+  }
+
+  if((pResult->Count == 0U) || (total == 0U))
+  {
+    pResult->LatencyMin = 0U;
+  }
+  else
+  {
+    pResult->LatencyMean = (uint32_t)(total / pResult->Count);
+    pResult->Throughput  = (uint32_t)(((uint64_t)Size * pResult->Count * SystemCoreClock) / total);
+    if(idle > total)
+    {
+      idle = total;
+    }
+    pResult->Load = (uint32_t)(((total - idle) * 1000U) / total);
+  }
+
+  return result;
+}
+
+/**
+  * @brief  Wait for the end of a transfer, counting the loops
+  * @note   The CPU load is measured from the cycles of this loop, taken by
+  *         PERIPH_Bench_Init() with the same code.
+  * @param  Limit: most loops
+  * @param  Timeout: in ms
+  * @retval Loops run
+  */
+static uint32_t PERIPH_Bench_Idle(uint32_t Limit, uint32_t Timeout)
+{
+  uint32_t tickstart = HAL_GetTick();
+  uint32_t loops = 0U;
+
+  while((PERIPH_Bench_Done == 0U) && (loops != Limit))
+  {
+    loops++;
+    if((HAL_GetTick() - tickstart) > Timeout)
+    {
+      break;
+    }
+  }
+
+  return loops;
+}
+
+/**
+  * @brief  Free running cycle count
+  * @note   The DWT cycle counter, or on Cortex-M0/M0+ the HAL tick in ms
+  *         plus the SysTick cycles since its last interrupt.
+  * @param  None
+  * @retval Cycle count
+  */
+static uint32_t PERIPH_Bench_Now(void)
+{
+#if (__CORTEX_M >= 3U)
+  return DWT->CYCCNT;
+#else
+  uint32_t tick;
+  uint32_t value;
+  uint32_t scale = ((SysTick->CTRL & SysTick_CTRL_CLKSOURCE_Msk) != 0U) ? 1U : 8U;
+
+  /* Read again when the SysTick interrupt came in between */
+  do
+  {
+    tick  = HAL_GetTick();
+    value = SysTick->VAL;
+  } while(tick != HAL_GetTick());
+
+  return (tick * (SystemCoreClock / 1000U)) + ((SysTick->LOAD - value) * scale);
+#endif
+}
+
+/**
+  * @brief  Append formatted text to the report, counting what does not fit
+  * @param  pBuffer: report buffer
+  * @param  Size: report buffer size
+  * @param  pLength: report length, updated
+  * @param  pFormat: printf format
+  * @retval None
+  */
+static void PERIPH_Bench_Append(char *pBuffer, uint32_t Size, uint32_t *pLength, const char *pFormat, ...)
+{
+  va_list args;
+  int     written;
+
+  va_start(args, pFormat);
+  if(*pLength < Size)
+  {
+    written = vsnprintf(&pBuffer[*pLength], Size - *pLength, pFormat, args);
+  }
+  else
+  {
+    written = vsnprintf(NULL, 0, pFormat, args);
+  }
+  va_end(args);
+
+  if(written > 0)
+  {
+    *pLength += (uint32_t)written;
+  }
+}
+
+#if defined(HAL_SPI_MODULE_ENABLED)
+/**
+  * @brief  Start an SPI transfer
+  * @param  pContext: SPI handle, 8-bit frames
+  * @param  Mode: PERIPH_BENCH_MODE_xxx
+  * @param  Direction: PERIPH_BENCH_DIR_xxx, received bytes after the
+  *                    transmitted ones in full duplex
+  * @param  pData: transfer buffer
+  * @param  Size: bytes per direction
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef PERIPH_Bench_SPI_Start(void *pContext, uint32_t Mode, uint32_t Direction, uint8_t *pData, uint32_t Size)
+{
+  SPI_HandleTypeDef *hspi = (SPI_HandleTypeDef *)pContext;
+
+  if(Direction == PERIPH_BENCH_DIR_TX)
+  {
+    if(Mode == PERIPH_BENCH_MODE_POLL)
+    {
+      return HAL_SPI_Transmit(hspi, pData, (uint16_t)Size, PERIPH_BENCH_TIMEOUT);
+    }
+    return (Mode == PERIPH_BENCH_MODE_IT) ? HAL_SPI_Transmit_IT(hspi, pData, (uint16_t)Size) :
+                                            HAL_SPI_Transmit_DMA(hspi, pData, (uint16_t)Size);
+  }
+
+  if(Direction == PERIPH_BENCH_DIR_RX)
+  {
+    if(Mode == PERIPH_BENCH_MODE_POLL)
+    {
+      return HAL_SPI_Receive(hspi, pData, (uint16_t)Size, PERIPH_BENCH_TIMEOUT);
+    }
+    return (Mode == PERIPH_BENCH_MODE_IT) ? HAL_SPI_Receive_IT(hspi, pData, (uint16_t)Size) :
+                                            HAL_SPI_Receive_DMA(hspi, pData, (uint16_t)Size);
+  }
+
+  if(Mode == PERIPH_BENCH_MODE_POLL)
+  {
+    return HAL_SPI_TransmitReceive(hspi, pData, &pData[Size], (uint16_t)Size, PERIPH_BENCH_TIMEOUT);
+  }
+  return (Mode == PERIPH_BENCH_MODE_IT) ? HAL_SPI_TransmitReceive_IT(hspi, pData, &pData[Size], (uint16_t)Size) :
+                                          HAL_SPI_TransmitReceive_DMA(hspi, pData, &pData[Size], (uint16_t)Size);
+}
+
+/**
+  * @brief  Stop an SPI transfer
+  * @param  pContext: SPI handle
+  * @param  Mode: PERIPH_BENCH_MODE_xxx
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef PERIPH_Bench_SPI_Abort(void *pContext, uint32_t Mode)
+{
+  UNUSED(Mode);
+
+  return HAL_SPI_Abort((SPI_HandleTypeDef *)pContext);
+}
+#endif /* HAL_SPI_MODULE_ENABLED */
+
+#if defined(HAL_UART_MODULE_ENABLED)
+/**
+  * @brief  Start a UART transfer
+  * @param  pContext: UART handle, 8-bit frames
+  * @param  Mode: PERIPH_BENCH_MODE_xxx
+  * @param  Direction: PERIPH_BENCH_DIR_TX or PERIPH_BENCH_DIR_RX
+  * @param  pData: transfer buffer
+  * @param  Size: bytes
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef PERIPH_Bench_UART_Start(void *pContext, uint32_t Mode, uint32_t Direction, uint8_t *pData, uint32_t Size)
+{
+  UART_HandleTypeDef *huart = (UART_HandleTypeDef *)pContext;
+
+  if(Direction == PERIPH_BENCH_DIR_TX)
+  {
+    if(Mode == PERIPH_BENCH_MODE_POLL)
+    {
+      return HAL_UART_Transmit(huart, pData, (uint16_t)Size, PERIPH_BENCH_TIMEOUT);
+    }
+    return (Mode == PERIPH_BENCH_MODE_IT) ? HAL_UART_Transmit_IT(huart, pData, (uint16_t)Size) :
+                                            HAL_UART_Transmit_DMA(huart, pData, (uint16_t)Size);
+  }
+
+  if(Direction == PERIPH_BENCH_DIR_RX)
+  {
+    if(Mode == PERIPH_BENCH_MODE_POLL)
+    {
+      return HAL_UART_Receive(huart, pData, (uint16_t)Size, PERIPH_BENCH_TIMEOUT);
+    }
+    return (Mode == PERIPH_BENCH_MODE_IT) ? HAL_UART_Receive_IT(huart, pData, (uint16_t)Size) :
+                                            HAL_UART_Receive_DMA(huart, pData, (uint16_t)Size);
+  }
+
+  return HAL_ERROR;
+}
+
+/**
+  * @brief  Stop a UART transfer
+  * @param  pContext: UART handle
+  * @param  Mode: PERIPH_BENCH_MODE_xxx
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef PERIPH_Bench_UART_Abort(void *pContext, uint32_t Mode)
+{
+  UNUSED(Mode);
+
+  return HAL_UART_Abort((UART_HandleTypeDef *)pContext);
+}
+#endif /* HAL_UART_MODULE_ENABLED */
+
+#if defined(HAL_QSPI_MODULE_ENABLED) && defined(QUADSPI)
+/**
+  * @brief  Send the command of a QSPI transfer then start its data phase
+  * @param  pContext: PERIPH_Bench_QSPITypeDef
+  * @param  Mode: PERIPH_BENCH_MODE_xxx, the command phase is always polled
+  * @param  Direction: PERIPH_BENCH_DIR_TX or PERIPH_BENCH_DIR_RX, as the
+  *                    command of the context
+  * @param  pData: transfer buffer
+  * @param  Size: bytes
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef PERIPH_Bench_QSPI_Start(void *pContext, uint32_t Mode, uint32_t Direction, uint8_t *pData, uint32_t Size)
+{
+  PERIPH_Bench_QSPITypeDef *qspi = (PERIPH_Bench_QSPITypeDef *)pContext;
+  QSPI_CommandTypeDef      command = qspi->Command;
+
+  if(Direction == PERIPH_BENCH_DIR_TXRX)
+  {
+    return HAL_ERROR;
+  }
+
+  command.NbData = Size;
+  if(HAL_QSPI_Command(qspi->hqspi, &command, PERIPH_BENCH_TIMEOUT) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  if(Direction == PERIPH_BENCH_DIR_TX)
+  {
+    if(Mode == PERIPH_BENCH_MODE_POLL)
+    {
+      return HAL_QSPI_Transmit(qspi->hqspi, pData, PERIPH_BENCH_TIMEOUT);
+    }
+    return (Mode == PERIPH_BENCH_MODE_IT) ? HAL_QSPI_Transmit_IT(qspi->hqspi, pData) :
+                                            HAL_QSPI_Transmit_DMA(qspi->hqspi, pData);
+  }
+
+  if(Mode == PERIPH_BENCH_MODE_POLL)
+  {
+    return HAL_QSPI_Receive(qspi->hqspi, pData, PERIPH_BENCH_TIMEOUT);
+  }
+  return (Mode == PERIPH_BENCH_MODE_IT) ? HAL_QSPI_Receive_IT(qspi->hqspi, pData) :
+                                          HAL_QSPI_Receive_DMA(qspi->hqspi, pData);
+}
+
+/**
+  * @brief  Stop a QSPI transfer
+  * @param  pContext: PERIPH_Bench_QSPITypeDef
+  * @param  Mode: PERIPH_BENCH_MODE_xxx
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef PERIPH_Bench_QSPI_Abort(void *pContext, uint32_t Mode)
+{
+  UNUSED(Mode);
+
+  return HAL_QSPI_Abort(((PERIPH_Bench_QSPITypeDef *)pContext)->hqspi);
+}
+#endif /* HAL_QSPI_MODULE_ENABLED */
+
+#if defined(HAL_SD_MODULE_ENABLED) && (defined(SDIO) || defined(SDMMC1))
+/**
+  * @brief  Start an SD card transfer
+  * @param  pContext: PERIPH_Bench_SDTypeDef
+  * @param  Mode: PERIPH_BENCH_MODE_xxx
+  * @param  Direction: PERIPH_BENCH_DIR_TX (write) or PERIPH_BENCH_DIR_RX (read)
+  * @param  pData: transfer buffer
+  * @param  Size: bytes, a multiple of BLOCKSIZE
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef PERIPH_Bench_SD_Start(void *pContext, uint32_t Mode, uint32_t Direction, uint8_t *pData, uint32_t Size)
+{
+  PERIPH_Bench_SDTypeDef *sd = (PERIPH_Bench_SDTypeDef *)pContext;
+  uint32_t               blocks = Size / BLOCKSIZE;
+
+  if(Direction == PERIPH_BENCH_DIR_TX)
+  {
+    if(Mode == PERIPH_BENCH_MODE_POLL)
+    {
+      return HAL_SD_WriteBlocks(sd->hsd, pData, sd->BlockAdd, blocks, PERIPH_BENCH_TIMEOUT);
+    }
+    return (Mode == PERIPH_BENCH_MODE_IT) ? HAL_SD_WriteBlocks_IT(sd->hsd, pData, sd->BlockAdd, blocks) :
+                                            HAL_SD_WriteBlocks_DMA(sd->hsd, pData, sd->BlockAdd, blocks);
+  }
+
+  if(Direction == PERIPH_BENCH_DIR_RX)
+  {
+    if(Mode == PERIPH_BENCH_MODE_POLL)
+    {
+      return HAL_SD_ReadBlocks(sd->hsd, pData, sd->BlockAdd, blocks, PERIPH_BENCH_TIMEOUT);
+    }
+    return (Mode == PERIPH_BENCH_MODE_IT) ? HAL_SD_ReadBlocks_IT(sd->hsd, pData, sd->BlockAdd, blocks) :
+                                            HAL_SD_ReadBlocks_DMA(sd->hsd, pData, sd->BlockAdd, blocks);
+  }
+
+  return HAL_ERROR;
+}
+
+/**
+  * @brief  Stop an SD card transfer
+  * @param  pContext: PERIPH_Bench_SDTypeDef
+  * @param  Mode: PERIPH_BENCH_MODE_xxx
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef PERIPH_Bench_SD_Abort(void *pContext, uint32_t Mode)
+{
+  UNUSED(Mode);
+
+  return HAL_SD_Abort(((PERIPH_Bench_SDTypeDef *)pContext)->hsd);
+}
+
+/**
+  * @brief  Wait for the card to be back in the transfer state
+  * @param  pContext: PERIPH_Bench_SDTypeDef
+  * @param  Timeout: in ms
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef PERIPH_Bench_SD_Wait(void *pContext, uint32_t Timeout)
+{
+  PERIPH_Bench_SDTypeDef *sd = (PERIPH_Bench_SDTypeDef *)pContext;
+  uint32_t               tickstart = HAL_GetTick();
+
+  while((uint32_t)HAL_SD_GetCardState(sd->hsd) != (uint32_t)HAL_SD_CARD_TRANSFER)
+  {
+    if((HAL_GetTick() - tickstart) > Timeout)
+    {
+      return HAL_TIMEOUT;
+    }
+  }
+
+  return HAL_OK;
+}
+#endif /* HAL_SD_MODULE_ENABLED */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
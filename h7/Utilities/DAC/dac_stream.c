@@ -0,0 +1,751 @@
+/**
+  ******************************************************************************
+  * @file    dac_stream.c
+  * @author  MCD Application Team
+  * @brief   DAC waveform streaming: timer sample clock, DMA ring refilled by half
+  *          from tables (CPU or MDMA copies) or callbacks, table switches.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- initialize the DAC with HAL_DAC_Init(), configure the channel with
+   HAL_DAC_ConfigChannel() triggered by the TRGO of a timer, link a
+   circular DMA stream (half-word, memory increment) to the channel and
+   initialize the timer with HAL_TIM_Base_Init(). Optionally initialize an
+   MDMA channel for memory to memory half-word copies (software request,
+   block transfer). Call DAC_Stream_Init() with a DAC_StreamTypeDef per
+   channel, then DAC_Stream_SetSampleRate() to set up the timer. Call the
+   DMA and MDMA IRQ handlers at the same preemption priority: this module
+   implements the HAL_DAC_ConvHalfCpltCallbackCh1(),
+   HAL_DAC_ConvCpltCallbackCh1(), HAL_DAC_DMAUnderrunCallbackCh1() and the
+   Ch2 ones in their place.
+
+2- the ring holds 2 halves of HalfSize samples: while the DMA plays one
+   half, the other one is refilled from the half transfer or transfer
+   complete interrupt. A half is refilled from the table playing, wrapping
+   at its end when Loop is set, or by DAC_Stream_RefillCallback() when no
+   table is playing (e.g. samples read from a file). The callback returns
+   the samples it wrote, the rest of the half holds the last sample.
+
+3- tables may sit in any memory the CPU reads, memory mapped QSPI flash
+   included. With hmdma given, long table pieces are copied to the ring by
+   the MDMA, the CPU only programs DAC_STREAM_MDMA_PIECES transfers per
+   half ring. The ring must be in a RAM the DMA reaches (not the DTCM).
+   With the data cache enabled, the tables written by the CPU must be
+   cleaned before being played; the ring is cleaned here after CPU copies.
+
+4- DAC_Stream_SetTable() queues the next table: it starts on the first
+   sample of a half ring (DAC_STREAM_SWITCH_BOUNDARY) or right after the
+   last sample of the table playing (DAC_STREAM_SWITCH_PERIOD), the output
+   never holds a mix of both. DAC_Stream_SwitchCallback() is called when
+   the queued table starts being copied, another one may be queued there.
+
+5- Late counts the half rings whose MDMA refill was still running at the
+   next half ring, the refill then falls back to CPU copies. Underruns
+   counts the DAC DMA underruns, reported by DAC_Stream_ErrorCallback():
+   the conversions then stop, restart with DAC_Stream_Stop() and
+   DAC_Stream_Start().
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "dac_stream.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Timers on APB2 */
+#define DAC_STREAM_TIM_APB2(__TIM__)  (((__TIM__) == TIM1) || ((__TIM__) == TIM8) || ((__TIM__) == TIM15))
+
+#define DAC_STREAM_INDEX(__CHANNEL__)  (((__CHANNEL__) == DAC_CHANNEL_1) ? 0U : 1U)
+
+/* Private variables ---------------------------------------------------------*/
+static DAC_StreamTypeDef *DacStreams[2];
+
+/* Private function prototypes -----------------------------------------------*/
+static DAC_StreamTypeDef *DAC_Stream_Find(DAC_HandleTypeDef *hdac, uint32_t Channel);
+static void              DAC_Stream_Switch(DAC_StreamTypeDef *pStream);
+static void              DAC_Stream_Copy(DAC_StreamTypeDef *pStream, uint16_t *pDst, const uint16_t *pSrc,
+                                         uint32_t Count, uint32_t Mdma);
+static void              DAC_Stream_Refill(DAC_StreamTypeDef *pStream, uint32_t Half, uint32_t Mdma);
+static void              DAC_Stream_Half(DAC_HandleTypeDef *hdac, uint32_t Channel, uint32_t Half);
+static void              DAC_Stream_Underrun(DAC_HandleTypeDef *hdac, uint32_t Channel);
+static void              DAC_Stream_MdmaCplt(MDMA_HandleTypeDef *hmdma);
+static void              DAC_Stream_MdmaError(MDMA_HandleTypeDef *hmdma);
+static void              DAC_Stream_CacheClean(const void *pData, uint32_t Size);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Attach a stream to an initialized DAC channel
+  * @param  pStream: stream context, kept by the module until DAC_Stream_DeInit()
+  * @param  hdac: DAC handle, channel configured and DMA linked
+  * @param  Channel: DAC_CHANNEL_1 or DAC_CHANNEL_2
+  * @param  htim: sample clock timer, NULL if set up by the user
+  * @param  hmdma: MDMA channel for the refills, NULL for CPU copies
+  * @param  pRing: 2 * HalfSize samples
+  * @param  HalfSize: samples per half ring
+  * @retval HAL status
+  */
+HAL_StatusTypeDef DAC_Stream_Init(DAC_StreamTypeDef *pStream, DAC_HandleTypeDef *hdac, uint32_t Channel,
+                                  TIM_HandleTypeDef *htim, MDMA_HandleTypeDef *hmdma,
+                                  uint16_t *pRing, uint32_t HalfSize)
+{
+  uint32_t index = DAC_STREAM_INDEX(Channel);
+
+  if ((pStream == NULL) || (hdac == NULL) || (pRing == NULL) || (HalfSize == 0U) ||
+      ((2U * HalfSize) > 0xFFFFU) || (DacStreams[index] != NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  memset(pStream, 0, sizeof(DAC_StreamTypeDef));
+  pStream->hdac     = hdac;
+  pStream->Channel  = Channel;
+  pStream->htim     = htim;
+  pStream->hmdma    = hmdma;
+  pStream->pRing    = pRing;
+  pStream->HalfSize = HalfSize;
+  pStream->Idle     = 0x800U;
+
+  if (hmdma != NULL)
+  {
+    if ((HAL_MDMA_RegisterCallback(hmdma, HAL_MDMA_XFER_CPLT_CB_ID, DAC_Stream_MdmaCplt) != HAL_OK) ||
+        (HAL_MDMA_RegisterCallback(hmdma, HAL_MDMA_XFER_ERROR_CB_ID, DAC_Stream_MdmaError) != HAL_OK))
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  DacStreams[index] = pStream;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Detach a stream from its DAC channel
+  * @param  pStream: stream context
+  * @retval HAL status
+  */
+HAL_StatusTypeDef DAC_Stream_DeInit(DAC_StreamTypeDef *pStream)
+{
+  uint32_t index = DAC_STREAM_INDEX(pStream->Channel);
+
+  if (DacStreams[index] != pStream)
+  {
+    return HAL_ERROR;
+  }
+  if (pStream->Running != 0U)
+  {
+    return HAL_BUSY;
+  }
+
+  DacStreams[index] = NULL;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Set the sample clock timer period and its TRGO on update
+  * @param  pStream: stream context
+  * @param  SampleRate: samples per second, the rate reached is kept in
+  *         pStream->SampleRate
+  * @retval HAL status
+  */
+HAL_StatusTypeDef DAC_Stream_SetSampleRate(DAC_StreamTypeDef *pStream, uint32_t SampleRate)
+{
+  TIM_HandleTypeDef *htim = pStream->htim;
+  TIM_MasterConfigTypeDef master;
+  uint32_t ppre;
+  uint32_t div;
+  uint32_t clock;
+  uint32_t ticks;
+  uint32_t prescaler;
+  uint32_t period;
+
+  if (htim == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  if (DAC_STREAM_TIM_APB2(htim->Instance))
+  {
+    clock = HAL_RCC_GetPCLK2Freq();
+    ppre = (RCC->D2CFGR & RCC_D2CFGR_D2PPRE2) >> POSITION_VAL(RCC_D2CFGR_D2PPRE2);
+  }
+  else
+  {
+    clock = HAL_RCC_GetPCLK1Freq();
+    ppre = (RCC->D2CFGR & RCC_D2CFGR_D2PPRE1) >> POSITION_VAL(RCC_D2CFGR_D2PPRE1);
+  }
+  /* Timer clock: PCLK times the APB divider, at most 2 (4 with TIMPRE) */
+  div = (ppre < 4U) ? 1U : (1UL << (ppre - 3U));
+  if ((RCC->CFGR & RCC_CFGR_TIMPRE) != 0U)
+  {
+    clock *= (div > 4U) ? 4U : div;
+  }
+  else
+  {
+    clock *= (div > 2U) ? 2U : div;
+  }
+
+  if ((SampleRate == 0U) || (SampleRate > clock))
+  {
+    return HAL_ERROR;
+  }
+
+  ticks = clock / SampleRate;
+  prescaler = (ticks - 1U) / 0x10000U;
+  period = (ticks / (prescaler + 1U)) - 1U;
+  if (prescaler > 0xFFFFU)
+  {
+    return HAL_ERROR;
+  }
+
+  __HAL_TIM_SET_PRESCALER(htim, prescaler);
+  __HAL_TIM_SET_AUTORELOAD(htim, period);
+  htim->Init.Prescaler = prescaler;
+  htim->Init.Period = period;
+  pStream->SampleRate = clock / ((prescaler + 1U) * (period + 1U));
+
+  master.MasterOutputTrigger = TIM_TRGO_UPDATE;
+  master.MasterOutputTrigger2 = TIM_TRGO2_RESET;
+  master.MasterSlaveMode = TIM_MASTERSLAVEMODE_DISABLE;
+
+  return HAL_TIMEx_MasterConfigSynchronization(htim, &master);
+}
+
+/**
+  * @brief  Play a table. Stopped: it starts with the stream. Running: it is
+  *         queued and starts at the given switch point.
+  * @param  pStream: stream context
+  * @param  pTable: table, copied; NULL to use DAC_Stream_RefillCallback()
+  * @param  Switch: DAC_STREAM_SWITCH_BOUNDARY or DAC_STREAM_SWITCH_PERIOD
+  * @retval HAL_BUSY when a table is already queued, HAL status otherwise
+  */
+HAL_StatusTypeDef DAC_Stream_SetTable(DAC_StreamTypeDef *pStream, const DAC_Stream_TableTypeDef *pTable,
+                                      uint32_t Switch)
+{
+  static const DAC_Stream_TableTypeDef none = {NULL, 0U, 0U};
+  uint32_t primask;
+
+  if (pTable == NULL)
+  {
+    pTable = &none;
+  }
+  if (((pTable->pData != NULL) && (pTable->Length == 0U)) ||
+      ((Switch != DAC_STREAM_SWITCH_BOUNDARY) && (Switch != DAC_STREAM_SWITCH_PERIOD)))
+  {
+    return HAL_ERROR;
+  }
+
+  if (pStream->Running == 0U)
+  {
+    pStream->Table = *pTable;
+    pStream->Position = 0U;
+    pStream->Switch = DAC_STREAM_SWITCH_NONE;
+    return HAL_OK;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (pStream->Switch != DAC_STREAM_SWITCH_NONE)
+  {
+    __set_PRIMASK(primask);
+    return HAL_BUSY;
+  }
+  pStream->Next = *pTable;
+  pStream->Switch = Switch;
+  __set_PRIMASK(primask);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Fill the ring and start the DMA and the sample clock
+  * @param  pStream: stream context
+  * @retval HAL status
+  */
+HAL_StatusTypeDef DAC_Stream_Start(DAC_StreamTypeDef *pStream)
+{
+  if (pStream->Running != 0U)
+  {
+    return HAL_BUSY;
+  }
+
+  DAC_Stream_Refill(pStream, 0U, 0U);
+  DAC_Stream_Refill(pStream, 1U, 0U);
+
+  if (HAL_DAC_Start_DMA(pStream->hdac, pStream->Channel, (uint32_t *)pStream->pRing,
+                        2U * pStream->HalfSize, DAC_ALIGN_12B_R) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+  pStream->Running = 1U;
+
+  if ((pStream->htim != NULL) && (HAL_TIM_Base_Start(pStream->htim) != HAL_OK))
+  {
+    (void)DAC_Stream_Stop(pStream);
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the sample clock, the DMA and the MDMA refill
+  * @param  pStream: stream context
+  * @retval HAL status
+  */
+HAL_StatusTypeDef DAC_Stream_Stop(DAC_StreamTypeDef *pStream)
+{
+  HAL_StatusTypeDef status;
+
+  if (pStream->htim != NULL)
+  {
+    (void)HAL_TIM_Base_Stop(pStream->htim);
+  }
+  status = HAL_DAC_Stop_DMA(pStream->hdac, pStream->Channel);
+
+  if ((pStream->hmdma != NULL) && (pStream->Copying != 0U))
+  {
+    (void)HAL_MDMA_Abort(pStream->hmdma);
+    pStream->Copying = 0U;
+  }
+  pStream->Running = 0U;
+
+  return status;
+}
+
+/**
+  * @brief  Samples for the ring when no table is playing
+  * @param  pStream: stream context
+  * @param  pBuffer: half ring part to fill
+  * @param  Count: samples wanted
+  * @retval Samples written, the rest is filled with the last sample
+  */
+__weak uint32_t DAC_Stream_RefillCallback(DAC_StreamTypeDef *pStream, uint16_t *pBuffer, uint32_t Count)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(pStream);
+  UNUSED(pBuffer);
+  UNUSED(Count);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the DAC_Stream_RefillCallback could be implemented in the user file
+   */
+  return 0U;
+}
+
+/**
+  * @brief  The queued table started, another one may be queued
+  * @param  pStream: stream context
+  * @retval None
+  */
+__weak void DAC_Stream_SwitchCallback(DAC_StreamTypeDef *pStream)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(pStream);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the DAC_Stream_SwitchCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  DAC DMA underrun, the conversions stopped
+  * @param  pStream: stream context
+  * @retval None
+  */
+__weak void DAC_Stream_ErrorCallback(DAC_StreamTypeDef *pStream)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(pStream);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the DAC_Stream_ErrorCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  First half of the ring played on channel 1
+  * @param  hdac: DAC handle
+  * @retval None
+  */
+void HAL_DAC_ConvHalfCpltCallbackCh1(DAC_HandleTypeDef *hdac)
+{
+  DAC_Stream_Half(hdac, DAC_CHANNEL_1, 0U);
+}
+
+/**
+  * @brief  Second half of the ring played on channel 1
+  * @param  hdac: DAC handle
+  * @retval None
+  */
+void HAL_DAC_ConvCpltCallbackCh1(DAC_HandleTypeDef *hdac)
+{
+  DAC_Stream_Half(hdac, DAC_CHANNEL_1, 1U);
+}
+
+/**
+  * @brief  DMA underrun on channel 1
+  * @param  hdac: DAC handle
+  * @retval None
+  */
+void HAL_DAC_DMAUnderrunCallbackCh1(DAC_HandleTypeDef *hdac)
+{
+  DAC_Stream_Underrun(hdac, DAC_CHANNEL_1);
+}
+
+/**
+  * @brief  First half of the ring played on channel 2
+  * @param  hdac: DAC handle
+  * @retval None
+  */
+void HAL_DACEx_ConvHalfCpltCallbackCh2(DAC_HandleTypeDef *hdac)
+{
+  DAC_Stream_Half(hdac, DAC_CHANNEL_2, 0U);
+}
+
+/**
+  * @brief  Second half of the ring played on channel 2
+  * @param  hdac: DAC handle
+  * @retval None
+  */
+void HAL_DACEx_ConvCpltCallbackCh2(DAC_HandleTypeDef *hdac)
+{
+  DAC_Stream_Half(hdac, DAC_CHANNEL_2, 1U);
+}
+
+/**
+  * @brief  DMA underrun on channel 2
+  * @param  hdac: DAC handle
+  * @retval None
+  */
+void HAL_DACEx_DMAUnderrunCallbackCh2(DAC_HandleTypeDef *hdac)
+{
+  DAC_Stream_Underrun(hdac, DAC_CHANNEL_2);
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Stream attached to a DAC channel
+  * @param  hdac: DAC handle
+  * @param  Channel: DAC_CHANNEL_1 or DAC_CHANNEL_2
+  * @retval Stream, NULL if none
+  */
+static DAC_StreamTypeDef *DAC_Stream_Find(DAC_HandleTypeDef *hdac, uint32_t Channel)
+{
+  DAC_StreamTypeDef *pStream = DacStreams[DAC_STREAM_INDEX(Channel)];
+
+  return ((pStream != NULL) && (pStream->hdac == hdac)) ? pStream : NULL;
+}
+
+/**
+  * @brief  Make the queued table the playing one
+  * @param  pStream: stream context
+  * @retval None
+  */
+static void DAC_Stream_Switch(DAC_StreamTypeDef *pStream)
+{
+  uint32_t primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  pStream->Table = pStream->Next;
+  pStream->Switch = DAC_STREAM_SWITCH_NONE;
+  __set_PRIMASK(primask);
+
+  pStream->Position = 0U;
+  DAC_Stream_SwitchCallback(pStream);
+}
+
+/**
+  * @brief  Copy table samples to the ring, by the MDMA when allowed and
+  *         worth it, by the CPU otherwise
+  * @param  pStream: stream context
+  * @param  pDst: ring
+  * @param  pSrc: table
+  * @param  Count: samples
+  * @param  Mdma: MDMA allowed
+  * @retval None
+  */
+static void DAC_Stream_Copy(DAC_StreamTypeDef *pStream, uint16_t *pDst, const uint16_t *pSrc,
+                            uint32_t Count, uint32_t Mdma)
+{
+  DAC_Stream_PieceTypeDef *pPiece;
+
+  if ((Mdma != 0U) && (pStream->hmdma != NULL) && (Count >= DAC_STREAM_MDMA_THRESHOLD) &&
+      (pStream->NbPieces < DAC_STREAM_MDMA_PIECES))
+  {
+    pPiece = &pStream->Pieces[pStream->NbPieces];
+    pPiece->pSrc  = pSrc;
+    pPiece->pDst  = pDst;
+    pPiece->Count = Count;
+    pStream->NbPieces++;
+  }
+  else
+  {
+    memcpy(pDst, pSrc, Count * sizeof(uint16_t));
+    DAC_Stream_CacheClean(pDst, Count * sizeof(uint16_t));
+  }
+
+  pStream->Idle = pSrc[Count - 1U];
+}
+
+/**
+  * @brief  Refill a half ring from the table playing or the refill callback
+  * @param  pStream: stream context
+  * @param  Half: 0 first half, 1 second half
+  * @param  Mdma: MDMA allowed
+  * @retval None
+  */
+static void DAC_Stream_Refill(DAC_StreamTypeDef *pStream, uint32_t Half, uint32_t Mdma)
+{
+  uint16_t *pDst = &pStream->pRing[Half * pStream->HalfSize];
+  uint32_t remaining = pStream->HalfSize;
+  uint32_t count;
+  uint32_t i;
+  DAC_Stream_PieceTypeDef *pPiece;
+
+  /* Pieces are only reset when no MDMA refill uses them */
+  if (Mdma != 0U)
+  {
+    pStream->NbPieces = 0U;
+    pStream->Piece = 0U;
+  }
+
+  if (pStream->Switch == DAC_STREAM_SWITCH_BOUNDARY)
+  {
+    DAC_Stream_Switch(pStream);
+  }
+
+  while (remaining != 0U)
+  {
+    if (pStream->Table.pData == NULL)
+    {
+      count = DAC_Stream_RefillCallback(pStream, pDst, remaining);
+      if (count > remaining)
+      {
+        count = remaining;
+      }
+      if (count != 0U)
+      {
+        pStream->Idle = pDst[count - 1U];
+      }
+      for (i = count; i < remaining; i++)
+      {
+        pDst[i] = pStream->Idle;
+      }
+      DAC_Stream_CacheClean(pDst, remaining * sizeof(uint16_t));
+      break;
+    }
+
+    count = pStream->Table.Length - pStream->Position;
+    if (count > remaining)
+    {
+      count = remaining;
+    }
+    DAC_Stream_Copy(pStream, pDst, &pStream->Table.pData[pStream->Position], count, Mdma);
+    pDst += count;
+    remaining -= count;
+    pStream->Position += count;
+
+    if (pStream->Position == pStream->Table.Length)
+    {
+      pStream->Position = 0U;
+      if (pStream->Switch != DAC_STREAM_SWITCH_NONE)
+      {
+        DAC_Stream_Switch(pStream);
+      }
+      else if (pStream->Table.Loop == 0U)
+      {
+        pStream->Table.pData = NULL;
+      }
+    }
+  }
+
+  if ((Mdma != 0U) && (pStream->NbPieces != 0U))
+  {
+    pPiece = &pStream->Pieces[0];
+    pStream->Copying = 1U;
+    if (HAL_MDMA_Start_IT(pStream->hmdma, (uint32_t)pPiece->pSrc, (uint32_t)pPiece->pDst,
+                          pPiece->Count * sizeof(uint16_t), 1U) != HAL_OK)
+    {
+      /* Fall back to the CPU */
+      pStream->Copying = 0U;
+      for (i = 0U; i < pStream->NbPieces; i++)
+      {
+        pPiece = &pStream->Pieces[i];
+        memcpy(pPiece->pDst, pPiece->pSrc, pPiece->Count * sizeof(uint16_t));
+        DAC_Stream_CacheClean(pPiece->pDst, pPiece->Count * sizeof(uint16_t));
+      }
+    }
+  }
+
+  pStream->Halves++;
+}
+
+/**
+  * @brief  A half ring was played, refill it
+  * @param  hdac: DAC handle
+  * @param  Channel: DAC_CHANNEL_1 or DAC_CHANNEL_2
+  * @param  Half: 0 first half, 1 second half
+  * @retval None
+  */
+static void DAC_Stream_Half(DAC_HandleTypeDef *hdac, uint32_t Channel, uint32_t Half)
+{
+  DAC_StreamTypeDef *pStream = DAC_Stream_Find(hdac, Channel);
+  uint32_t mdma = 1U;
+
+  if ((pStream == NULL) || (pStream->Running == 0U))
+  {
+    return;
+  }
+
+  /* The pieces of the other half are still in use */
+  if (pStream->Copying != 0U)
+  {
+    pStream->Late++;
+    mdma = 0U;
+  }
+
+  DAC_Stream_Refill(pStream, Half, mdma);
+}
+
+/**
+  * @brief  DAC DMA underrun
+  * @param  hdac: DAC handle
+  * @param  Channel: DAC_CHANNEL_1 or DAC_CHANNEL_2
+  * @retval None
+  */
+static void DAC_Stream_Underrun(DAC_HandleTypeDef *hdac, uint32_t Channel)
+{
+  DAC_StreamTypeDef *pStream = DAC_Stream_Find(hdac, Channel);
+
+  if (pStream != NULL)
+  {
+    pStream->Underruns++;
+    DAC_Stream_ErrorCallback(pStream);
+  }
+}
+
+/**
+  * @brief  MDMA piece copied, start the next one
+  * @param  hmdma: MDMA handle
+  * @retval None
+  */
+static void DAC_Stream_MdmaCplt(MDMA_HandleTypeDef *hmdma)
+{
+  DAC_Stream_PieceTypeDef *pPiece;
+  DAC_StreamTypeDef *pStream;
+  uint32_t i;
+
+  for (i = 0U; i < 2U; i++)
+  {
+    pStream = DacStreams[i];
+    if ((pStream == NULL) || (pStream->hmdma != hmdma) || (pStream->Copying == 0U))
+    {
+      continue;
+    }
+
+    pStream->Piece++;
+    while (pStream->Piece < pStream->NbPieces)
+    {
+      pPiece = &pStream->Pieces[pStream->Piece];
+      if (HAL_MDMA_Start_IT(hmdma, (uint32_t)pPiece->pSrc, (uint32_t)pPiece->pDst,
+                            pPiece->Count * sizeof(uint16_t), 1U) == HAL_OK)
+      {
+        return;
+      }
+      memcpy(pPiece->pDst, pPiece->pSrc, pPiece->Count * sizeof(uint16_t));
+      DAC_Stream_CacheClean(pPiece->pDst, pPiece->Count * sizeof(uint16_t));
+      pStream->Piece++;
+    }
+    pStream->Copying = 0U;
+    return;
+  }
+}
+
+/**
+  * @brief  MDMA error, the piece and the next ones are copied by the CPU
+  * @param  hmdma: MDMA handle
+  * @retval None
+  */
+static void DAC_Stream_MdmaError(MDMA_HandleTypeDef *hmdma)
+{
+  DAC_Stream_PieceTypeDef *pPiece;
+  DAC_StreamTypeDef *pStream;
+  uint32_t i;
+
+  for (i = 0U; i < 2U; i++)
+  {
+    pStream = DacStreams[i];
+    if ((pStream == NULL) || (pStream->hmdma != hmdma) || (pStream->Copying == 0U))
+    {
+      continue;
+    }
+
+    while (pStream->Piece < pStream->NbPieces)
+    {
+      pPiece = &pStream->Pieces[pStream->Piece];
+      memcpy(pPiece->pDst, pPiece->pSrc, pPiece->Count * sizeof(uint16_t));
+      DAC_Stream_CacheClean(pPiece->pDst, pPiece->Count * sizeof(uint16_t));
+      pStream->Piece++;
+    }
+    pStream->Copying = 0U;
+    return;
+  }
+}
+
+/**
+  * @brief  Write back the data cache lines of a DMA source buffer
+  * @param  pData: buffer
+  * @param  Size: size in bytes
+  * @retval None
+  */
+static void DAC_Stream_CacheClean(const void *pData, uint32_t Size)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if ((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    uint32_t start = (uint32_t)pData & ~31U;
+    SCB_CleanDCache_by_Addr((uint32_t *)start, (int32_t)(((uint32_t)pData + Size) - start));
+  }
+#else
+  UNUSED(pData);
+  UNUSED(Size);
+#endif
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
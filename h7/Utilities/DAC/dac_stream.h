@@ -0,0 +1,131 @@
+/**
+  ******************************************************************************
+  * @file    dac_stream.h
+  * @author  MCD Application Team
+  * @brief   Header for dac_stream module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _DAC_STREAM_H__
+#define _DAC_STREAM_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#if !defined(HAL_DAC_MODULE_ENABLED) || !defined(HAL_DMA_MODULE_ENABLED) || !defined(HAL_TIM_MODULE_ENABLED)
+#error "dac_stream requires the HAL DAC, DMA and TIM drivers"
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+/* Pieces of a half ring copied by the MDMA, the others by the CPU.
+   Override in main.h. */
+#if !defined(DAC_STREAM_MDMA_PIECES)
+#define DAC_STREAM_MDMA_PIECES      4U
+#endif
+
+/* Pieces shorter than this, in samples, are copied by the CPU. Override in main.h. */
+#if !defined(DAC_STREAM_MDMA_THRESHOLD)
+#define DAC_STREAM_MDMA_THRESHOLD   64U
+#endif
+
+/* Table switch points */
+#define DAC_STREAM_SWITCH_NONE      0U   /* No table queued                           */
+#define DAC_STREAM_SWITCH_BOUNDARY  1U   /* At the next half ring                     */
+#define DAC_STREAM_SWITCH_PERIOD    2U   /* At the end of the table playing           */
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  const uint16_t            *pData;      /* 12-bit right aligned codes                */
+  uint32_t                  Length;      /* Samples                                   */
+  uint32_t                  Loop;        /* 1: repeated, 0: played once               */
+} DAC_Stream_TableTypeDef;
+
+typedef struct
+{
+  const uint16_t            *pSrc;
+  uint16_t                  *pDst;
+  uint32_t                  Count;
+} DAC_Stream_PieceTypeDef;
+
+typedef struct
+{
+  DAC_HandleTypeDef         *hdac;
+  uint32_t                  Channel;     /* DAC_CHANNEL_1 or DAC_CHANNEL_2            */
+  TIM_HandleTypeDef         *htim;       /* Sample clock, NULL: set up by the user    */
+  MDMA_HandleTypeDef        *hmdma;      /* Ring refills, NULL: CPU copies            */
+  uint16_t                  *pRing;      /* 2 * HalfSize samples                      */
+  uint32_t                  HalfSize;
+  DAC_Stream_TableTypeDef   Table;       /* Playing, pData NULL: refill callback      */
+  uint32_t                  Position;    /* Next sample of Table                      */
+  DAC_Stream_TableTypeDef   Next;        /* Queued                                    */
+  __IO uint32_t             Switch;      /* DAC_STREAM_SWITCH_xxx of Next             */
+  uint16_t                  Idle;        /* Last sample written in the ring           */
+  DAC_Stream_PieceTypeDef   Pieces[DAC_STREAM_MDMA_PIECES];
+  uint32_t                  NbPieces;
+  uint32_t                  Piece;       /* MDMA piece in progress                    */
+  __IO uint32_t             Copying;     /* MDMA refill in progress                   */
+  uint32_t                  Running;
+  uint32_t                  SampleRate;  /* Samples per second set in the timer       */
+  uint32_t                  Halves;      /* Half rings refilled                       */
+  uint32_t                  Late;        /* MDMA refills not done after a half ring   */
+  uint32_t                  Underruns;   /* DAC DMA underruns                         */
+} DAC_StreamTypeDef;
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef DAC_Stream_Init(DAC_StreamTypeDef *pStream, DAC_HandleTypeDef *hdac, uint32_t Channel,
+                                  TIM_HandleTypeDef *htim, MDMA_HandleTypeDef *hmdma,
+                                  uint16_t *pRing, uint32_t HalfSize);
+HAL_StatusTypeDef DAC_Stream_DeInit(DAC_StreamTypeDef *pStream);
+HAL_StatusTypeDef DAC_Stream_SetSampleRate(DAC_StreamTypeDef *pStream, uint32_t SampleRate);
+HAL_StatusTypeDef DAC_Stream_SetTable(DAC_StreamTypeDef *pStream, const DAC_Stream_TableTypeDef *pTable,
+                                      uint32_t Switch);
+HAL_StatusTypeDef DAC_Stream_Start(DAC_StreamTypeDef *pStream);
+HAL_StatusTypeDef DAC_Stream_Stop(DAC_StreamTypeDef *pStream);
+
+uint32_t DAC_Stream_RefillCallback(DAC_StreamTypeDef *pStream, uint16_t *pBuffer, uint32_t Count);
+void     DAC_Stream_SwitchCallback(DAC_StreamTypeDef *pStream);
+void     DAC_Stream_ErrorCallback(DAC_StreamTypeDef *pStream);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _DAC_STREAM_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,841 @@
+/**
+  ******************************************************************************
+  * @file    dma2d_comp.c
+  * @author  MCD Application Team
+  * @brief   Dirty-region compositor running DMA2D batches from its interrupt
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- initialize the compositor with the framebuffer it draws into and call
+   DMA2D_Comp_IRQHandler() from DMA2D_IRQHandler() in stm32h7xx_it.c.
+
+2- for each frame, mark the areas that changed with DMA2D_Comp_Invalidate().
+   The rectangles are snapped to a DMA2D_COMP_TILE_SIZE grid and merged
+   with their neighbours, so the dirty region stays a short list of
+   disjoint rectangles.
+
+3- queue the drawing of the frame, back to front, with DMA2D_Comp_Fill()
+   (R2M), DMA2D_Comp_Copy() (M2M), DMA2D_Comp_Convert() (M2M with PFC) and
+   DMA2D_Comp_Blend() (M2M with blending). Only the dirty part of each
+   command is drawn; DMA2D_Comp_IsDirty() tells whether a widget needs to
+   be queued at all.
+
+4- start the batch with DMA2D_Comp_Flush(). The dirty rectangles are sorted
+   by framebuffer address, so the DMA2D walks the SDRAM from the lowest row
+   to the highest, and each rectangle receives all its commands in queue
+   order before the next rectangle is drawn. Every transfer is started from
+   the transfer complete interrupt of the previous one.
+   DMA2D_Comp_FlushCpltCallback() is called once the batch is done and
+   DMA2D_Comp_WaitForFlush() waits for it.
+
+5- when the target is double buffered (BSP_LCD_Present()), give the new back
+   buffer with DMA2D_Comp_SetTargetAddress() and invalidate the area drawn
+   in the previous frame as well, since it is missing from that buffer.
+
+6- DMA2D_Comp_GetDrawnRects() gives the rectangles of the last batch, to
+   send only them to a display with its own memory (lcd_push module for
+   the SPI and FMC controllers).
+
+Sources in L4 and A4 formats are not supported: a clipped rectangle may
+start in the middle of a byte, which the DMA2D cannot address.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "dma2d_comp.h"
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  uint16_t X0;  /* First column              */
+  uint16_t Y0;  /* First line                */
+  uint16_t X1;  /* Column after the last one */
+  uint16_t Y1;  /* Line after the last one   */
+} DMA2D_Comp_BoxTypeDef;
+
+typedef enum
+{
+  DMA2D_COMP_OP_FILL  = 0U,  /* R2M       */
+  DMA2D_COMP_OP_COPY  = 1U,  /* M2M       */
+  DMA2D_COMP_OP_PFC   = 2U,  /* M2M_PFC   */
+  DMA2D_COMP_OP_BLEND = 3U   /* M2M_BLEND */
+} DMA2D_Comp_OpTypeDef;
+
+typedef struct
+{
+  DMA2D_Comp_OpTypeDef      Op;
+  DMA2D_Comp_BoxTypeDef     Box;      /* Destination, clipped to the target    */
+  DMA2D_Comp_SurfaceTypeDef Src;      /* Source image, unused by a fill        */
+  int32_t                   OffsetX;  /* Source column minus target column     */
+  int32_t                   OffsetY;  /* Source line minus target line         */
+  uint32_t                  Color;    /* Fill color, or A8 source color (RGB)  */
+  uint32_t                  Alpha;    /* Constant alpha of the source          */
+} DMA2D_Comp_CmdTypeDef;
+
+/* Private define ------------------------------------------------------------*/
+#define DMA2D_COMP_NONE  0xFFFFFFFFU
+
+/* Private macro -------------------------------------------------------------*/
+#define DMA2D_COMP_AREA(__BOX__) \
+  ((uint32_t)((__BOX__)->X1 - (__BOX__)->X0) * (uint32_t)((__BOX__)->Y1 - (__BOX__)->Y0))
+
+/* Private variables ---------------------------------------------------------*/
+static DMA2D_HandleTypeDef       hdma2d_comp;
+static DMA2D_Comp_SurfaceTypeDef CompTarget;
+static uint16_t                  CompWidth;
+static uint16_t                  CompHeight;
+
+static DMA2D_Comp_BoxTypeDef     CompRects[DMA2D_COMP_MAX_RECTS];
+static uint32_t                  CompRectCount;
+static DMA2D_Comp_CmdTypeDef     CompCmds[DMA2D_COMP_MAX_CMDS];
+static uint32_t                  CompCmdCount;
+static DMA2D_Comp_BoxTypeDef     CompDrawn[DMA2D_COMP_MAX_RECTS];
+static uint32_t                  CompDrawnCount;
+
+static uint32_t                  CompRect;    /* Rectangle being drawn        */
+static uint32_t                  CompCmd;     /* Next command of CompRect     */
+static __IO uint32_t             CompBusy;
+static __IO HAL_StatusTypeDef    CompStatus;
+
+/* DMA2D mode of each operation */
+static const uint32_t CompModes[] =
+{
+  DMA2D_R2M, DMA2D_M2M, DMA2D_M2M_PFC, DMA2D_M2M_BLEND
+};
+
+/* Bits per pixel of each DMA2D color mode, 0 when not supported */
+static const uint8_t CompBits[] =
+{
+  32U, /* ARGB8888 */  24U, /* RGB888 */  16U, /* RGB565 */  16U, /* ARGB1555 */
+  16U, /* ARGB4444 */   8U, /* L8     */   8U, /* AL44   */  16U, /* AL88     */
+   0U, /* L4       */   8U, /* A8     */   0U  /* A4     */
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t          Comp_GetBits(uint32_t ColorMode);
+static uint32_t          Comp_Clip(const DMA2D_Comp_RectTypeDef *pRect, DMA2D_Comp_BoxTypeDef *pBox);
+static uint32_t          Comp_Intersect(const DMA2D_Comp_BoxTypeDef *pA, const DMA2D_Comp_BoxTypeDef *pB, DMA2D_Comp_BoxTypeDef *pOut);
+static void              Comp_Union(const DMA2D_Comp_BoxTypeDef *pA, const DMA2D_Comp_BoxTypeDef *pB, DMA2D_Comp_BoxTypeDef *pOut);
+static void              Comp_AddBox(DMA2D_Comp_BoxTypeDef Box);
+static uint32_t          Comp_IsBoxDirty(const DMA2D_Comp_BoxTypeDef *pBox);
+static HAL_StatusTypeDef Comp_Queue(DMA2D_Comp_OpTypeDef Op, const DMA2D_Comp_RectTypeDef *pRect,
+                                    const DMA2D_Comp_SurfaceTypeDef *pSrc, uint16_t SrcX, uint16_t SrcY,
+                                    uint32_t Color, uint8_t Alpha);
+static uint32_t          Comp_Address(const DMA2D_Comp_SurfaceTypeDef *pSurface, uint32_t X, uint32_t Y);
+static HAL_StatusTypeDef Comp_Start(const DMA2D_Comp_CmdTypeDef *pCmd, const DMA2D_Comp_BoxTypeDef *pBox);
+static void              Comp_StartNext(void);
+static void              Comp_XferCplt(DMA2D_HandleTypeDef *hdma2d);
+static void              Comp_XferError(DMA2D_HandleTypeDef *hdma2d);
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Initialize the compositor and the DMA2D
+  * @param  pTarget: framebuffer drawn by the compositor, in DMA2D_OUTPUT_xxx format
+  * @param  Width: width of the framebuffer, in pixels
+  * @param  Height: height of the framebuffer, in pixels
+  * @retval HAL status
+  */
+HAL_StatusTypeDef DMA2D_Comp_Init(const DMA2D_Comp_SurfaceTypeDef *pTarget, uint16_t Width, uint16_t Height)
+{
+  if((pTarget == NULL) || (Comp_GetBits(pTarget->ColorMode) == 0U) || (pTarget->ColorMode > DMA2D_OUTPUT_ARGB4444))
+  {
+    return HAL_ERROR;
+  }
+  if(CompBusy != 0U)
+  {
+    return HAL_BUSY;
+  }
+
+  CompTarget    = *pTarget;
+  CompWidth     = Width;
+  CompHeight    = Height;
+  CompRectCount = 0U;
+  CompCmdCount  = 0U;
+  CompStatus    = HAL_OK;
+
+  __HAL_RCC_DMA2D_CLK_ENABLE();
+
+  hdma2d_comp.Instance          = DMA2D;
+  hdma2d_comp.Init.Mode         = DMA2D_R2M;
+  hdma2d_comp.Init.ColorMode    = CompTarget.ColorMode;
+  hdma2d_comp.Init.OutputOffset = 0U;
+  hdma2d_comp.XferCpltCallback  = Comp_XferCplt;
+  hdma2d_comp.XferErrorCallback = Comp_XferError;
+  if(HAL_DMA2D_Init(&hdma2d_comp) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  HAL_NVIC_SetPriority(DMA2D_IRQn, DMA2D_COMP_IRQ_PRIORITY, 0U);
+  HAL_NVIC_EnableIRQ(DMA2D_IRQn);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Change the framebuffer drawn by the next flush
+  * @param  Address: address of pixel (0,0) of the new framebuffer
+  * @retval HAL status
+  */
+HAL_StatusTypeDef DMA2D_Comp_SetTargetAddress(uint32_t Address)
+{
+  if(CompBusy != 0U)
+  {
+    return HAL_BUSY;
+  }
+  CompTarget.Address = Address;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Add an area to the dirty region of the frame
+  * @note   Ignored while a flush is in progress.
+  * @param  pRect: area that changed
+  * @retval None
+  */
+void DMA2D_Comp_Invalidate(const DMA2D_Comp_RectTypeDef *pRect)
+{
+  DMA2D_Comp_BoxTypeDef box;
+
+  if((CompBusy == 0U) && (Comp_Clip(pRect, &box) != 0U))
+  {
+    /* Snap the area to the tile grid */
+    box.X0 = (uint16_t)((box.X0 / DMA2D_COMP_TILE_SIZE) * DMA2D_COMP_TILE_SIZE);
+    box.Y0 = (uint16_t)((box.Y0 / DMA2D_COMP_TILE_SIZE) * DMA2D_COMP_TILE_SIZE);
+    box.X1 = (uint16_t)(((box.X1 + DMA2D_COMP_TILE_SIZE - 1U) / DMA2D_COMP_TILE_SIZE) * DMA2D_COMP_TILE_SIZE);
+    box.Y1 = (uint16_t)(((box.Y1 + DMA2D_COMP_TILE_SIZE - 1U) / DMA2D_COMP_TILE_SIZE) * DMA2D_COMP_TILE_SIZE);
+    if(box.X1 > CompWidth)
+    {
+      box.X1 = CompWidth;
+    }
+    if(box.Y1 > CompHeight)
+    {
+      box.Y1 = CompHeight;
+    }
+    Comp_AddBox(box);
+  }
+}
+
+/**
+  * @brief  Mark the whole framebuffer as dirty
+  * @param  None
+  * @retval None
+  */
+void DMA2D_Comp_InvalidateAll(void)
+{
+  if(CompBusy == 0U)
+  {
+    CompRects[0].X0 = 0U;
+    CompRects[0].Y0 = 0U;
+    CompRects[0].X1 = CompWidth;
+    CompRects[0].Y1 = CompHeight;
+    CompRectCount   = 1U;
+  }
+}
+
+/**
+  * @brief  Tell whether an area intersects the dirty region of the frame
+  * @param  pRect: area to test
+  * @retval 1 when (part of) the area must be redrawn, 0 otherwise
+  */
+uint32_t DMA2D_Comp_IsDirty(const DMA2D_Comp_RectTypeDef *pRect)
+{
+  DMA2D_Comp_BoxTypeDef box;
+
+  if(Comp_Clip(pRect, &box) == 0U)
+  {
+    return 0U;
+  }
+  return Comp_IsBoxDirty(&box);
+}
+
+/**
+  * @brief  Queue a rectangle fill
+  * @param  pRect: area of the target to fill
+  * @param  Color: fill color, in ARGB8888 format
+  * @retval HAL status
+  */
+HAL_StatusTypeDef DMA2D_Comp_Fill(const DMA2D_Comp_RectTypeDef *pRect, uint32_t Color)
+{
+  return Comp_Queue(DMA2D_COMP_OP_FILL, pRect, NULL, 0U, 0U, Color, 0xFFU);
+}
+
+/**
+  * @brief  Queue a copy of an image in the target color mode
+  * @param  pRect: area of the target to draw
+  * @param  pSrc: source image, in the color mode of the target
+  * @param  SrcX: source column drawn at pRect->X
+  * @param  SrcY: source line drawn at pRect->Y
+  * @retval HAL status
+  */
+HAL_StatusTypeDef DMA2D_Comp_Copy(const DMA2D_Comp_RectTypeDef *pRect, const DMA2D_Comp_SurfaceTypeDef *pSrc, uint16_t SrcX, uint16_t SrcY)
+{
+  if((pSrc == NULL) || (pSrc->ColorMode != CompTarget.ColorMode))
+  {
+    return HAL_ERROR;
+  }
+  return Comp_Queue(DMA2D_COMP_OP_COPY, pRect, pSrc, SrcX, SrcY, 0U, 0xFFU);
+}
+
+/**
+  * @brief  Queue a copy of an image converted to the target color mode
+  * @param  pRect: area of the target to draw
+  * @param  pSrc: source image
+  * @param  SrcX: source column drawn at pRect->X
+  * @param  SrcY: source line drawn at pRect->Y
+  * @retval HAL status
+  */
+HAL_StatusTypeDef DMA2D_Comp_Convert(const DMA2D_Comp_RectTypeDef *pRect, const DMA2D_Comp_SurfaceTypeDef *pSrc, uint16_t SrcX, uint16_t SrcY)
+{
+  return Comp_Queue(DMA2D_COMP_OP_PFC, pRect, pSrc, SrcX, SrcY, 0U, 0xFFU);
+}
+
+/**
+  * @brief  Queue the blending of an image over the target
+  * @param  pRect: area of the target to draw
+  * @param  pSrc: source image, blended with its own alpha
+  * @param  SrcX: source column drawn at pRect->X
+  * @param  SrcY: source line drawn at pRect->Y
+  * @param  Color: color of an A8 source (RGB888), unused otherwise
+  * @param  Alpha: constant alpha multiplied with the source alpha
+  * @retval HAL status
+  */
+HAL_StatusTypeDef DMA2D_Comp_Blend(const DMA2D_Comp_RectTypeDef *pRect, const DMA2D_Comp_SurfaceTypeDef *pSrc, uint16_t SrcX, uint16_t SrcY, uint32_t Color, uint8_t Alpha)
+{
+  return Comp_Queue(DMA2D_COMP_OP_BLEND, pRect, pSrc, SrcX, SrcY, Color, Alpha);
+}
+
+/**
+  * @brief  Draw the queued commands over the dirty region
+  * @note   Returns as soon as the first transfer is started. The dirty region
+  *         and the command queue are emptied when the batch completes.
+  * @param  None
+  * @retval HAL status
+  */
+HAL_StatusTypeDef DMA2D_Comp_Flush(void)
+{
+  DMA2D_Comp_BoxTypeDef box;
+  uint32_t i, j;
+
+  if(hdma2d_comp.Instance == NULL)
+  {
+    return HAL_ERROR;
+  }
+  if(CompBusy != 0U)
+  {
+    return HAL_BUSY;
+  }
+
+  /* Sort the rectangles by framebuffer address, lowest first */
+  for(i = 1U; i < CompRectCount; i++)
+  {
+    box = CompRects[i];
+    for(j = i; (j > 0U) && ((CompRects[j - 1U].Y0 > box.Y0) ||
+                            ((CompRects[j - 1U].Y0 == box.Y0) && (CompRects[j - 1U].X0 > box.X0))); j--)
+    {
+      CompRects[j] = CompRects[j - 1U];
+    }
+    CompRects[j] = box;
+  }
+
+#if (__DCACHE_PRESENT == 1)
+  /* Write the sources and the target to memory before the DMA2D reads them */
+  if((SCB->CCR & SCB_CCR_DC_Msk) != 0)
+  {
+    SCB_CleanDCache();
+  }
+#endif
+
+  CompRect   = 0U;
+  CompCmd    = 0U;
+  CompStatus = HAL_OK;
+  CompBusy   = 1U;
+  Comp_StartNext();
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Tell whether a flush is in progress
+  * @param  None
+  * @retval 1 while the batch runs, 0 otherwise
+  */
+uint32_t DMA2D_Comp_IsBusy(void)
+{
+  return CompBusy;
+}
+
+/**
+  * @brief  Wait for the end of the flush in progress
+  * @param  Timeout: maximum time to wait, in ms
+  * @retval HAL status of the batch, or HAL_TIMEOUT
+  */
+HAL_StatusTypeDef DMA2D_Comp_WaitForFlush(uint32_t Timeout)
+{
+  uint32_t tickstart = HAL_GetTick();
+
+  while(CompBusy != 0U)
+  {
+    if((HAL_GetTick() - tickstart) > Timeout)
+    {
+      return HAL_TIMEOUT;
+    }
+  }
+  return CompStatus;
+}
+
+/**
+  * @brief  Get the rectangles drawn by the last completed flush
+  * @note   To be called from DMA2D_Comp_FlushCpltCallback() or after
+  *         DMA2D_Comp_WaitForFlush().
+  * @param  pRects: array receiving the rectangles, sorted by address
+  * @param  MaxRects: size of the array
+  * @retval Number of rectangles written
+  */
+uint32_t DMA2D_Comp_GetDrawnRects(DMA2D_Comp_RectTypeDef *pRects, uint32_t MaxRects)
+{
+  uint32_t i;
+
+  for(i = 0U; (i < CompDrawnCount) && (i < MaxRects); i++)
+  {
+    pRects[i].X      = CompDrawn[i].X0;
+    pRects[i].Y      = CompDrawn[i].Y0;
+    pRects[i].Width  = (uint16_t)(CompDrawn[i].X1 - CompDrawn[i].X0);
+    pRects[i].Height = (uint16_t)(CompDrawn[i].Y1 - CompDrawn[i].Y0);
+  }
+  return i;
+}
+
+/**
+  * @brief  Handle the DMA2D interrupt, to be called from DMA2D_IRQHandler()
+  * @param  None
+  * @retval None
+  */
+void DMA2D_Comp_IRQHandler(void)
+{
+  HAL_DMA2D_IRQHandler(&hdma2d_comp);
+}
+
+/**
+  * @brief  Flush complete callback, called from the DMA2D interrupt
+  * @param  None
+  * @retval None
+  */
+__weak void DMA2D_Comp_FlushCpltCallback(void)
+{
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the DMA2D_Comp_FlushCpltCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Get the number of bits per pixel of a color mode
+  * @param  ColorMode: DMA2D_INPUT_xxx or DMA2D_OUTPUT_xxx
+  * @retval Bits per pixel, 0 when the color mode is not supported
+  */
+static uint32_t Comp_GetBits(uint32_t ColorMode)
+{
+  if(ColorMode >= (sizeof(CompBits) / sizeof(CompBits[0])))
+  {
+    return 0U;
+  }
+  return CompBits[ColorMode];
+}
+
+/**
+  * @brief  Clip a rectangle to the target
+  * @param  pRect: rectangle to clip
+  * @param  pBox: clipped rectangle
+  * @retval 1 when the clipped rectangle is not empty, 0 otherwise
+  */
+static uint32_t Comp_Clip(const DMA2D_Comp_RectTypeDef *pRect, DMA2D_Comp_BoxTypeDef *pBox)
+{
+  uint32_t x1, y1;
+
+  if((pRect == NULL) || (pRect->X >= CompWidth) || (pRect->Y >= CompHeight))
+  {
+    return 0U;
+  }
+  x1 = (uint32_t)pRect->X + pRect->Width;
+  y1 = (uint32_t)pRect->Y + pRect->Height;
+
+  pBox->X0 = pRect->X;
+  pBox->Y0 = pRect->Y;
+  pBox->X1 = (uint16_t)((x1 > CompWidth) ? CompWidth : x1);
+  pBox->Y1 = (uint16_t)((y1 > CompHeight) ? CompHeight : y1);
+
+  return ((pBox->X1 > pBox->X0) && (pBox->Y1 > pBox->Y0)) ? 1U : 0U;
+}
+
+/**
+  * @brief  Intersect two rectangles
+  * @param  pA: first rectangle
+  * @param  pB: second rectangle
+  * @param  pOut: intersection, may be NULL
+  * @retval 1 when the intersection is not empty, 0 otherwise
+  */
+static uint32_t Comp_Intersect(const DMA2D_Comp_BoxTypeDef *pA, const DMA2D_Comp_BoxTypeDef *pB, DMA2D_Comp_BoxTypeDef *pOut)
+{
+  DMA2D_Comp_BoxTypeDef box;
+
+  box.X0 = (pA->X0 > pB->X0) ? pA->X0 : pB->X0;
+  box.Y0 = (pA->Y0 > pB->Y0) ? pA->Y0 : pB->Y0;
+  box.X1 = (pA->X1 < pB->X1) ? pA->X1 : pB->X1;
+  box.Y1 = (pA->Y1 < pB->Y1) ? pA->Y1 : pB->Y1;
+
+  if((box.X1 <= box.X0) || (box.Y1 <= box.Y0))
+  {
+    return 0U;
+  }
+  if(pOut != NULL)
+  {
+    *pOut = box;
+  }
+  return 1U;
+}
+
+/**
+  * @brief  Get the bounding rectangle of two rectangles
+  * @param  pA: first rectangle
+  * @param  pB: second rectangle
+  * @param  pOut: bounding rectangle
+  * @retval None
+  */
+static void Comp_Union(const DMA2D_Comp_BoxTypeDef *pA, const DMA2D_Comp_BoxTypeDef *pB, DMA2D_Comp_BoxTypeDef *pOut)
+{
+  DMA2D_Comp_BoxTypeDef box;
+
+  box.X0 = (pA->X0 < pB->X0) ? pA->X0 : pB->X0;
+  box.Y0 = (pA->Y0 < pB->Y0) ? pA->Y0 : pB->Y0;
+  box.X1 = (pA->X1 > pB->X1) ? pA->X1 : pB->X1;
+  box.Y1 = (pA->Y1 > pB->Y1) ? pA->Y1 : pB->Y1;
+  *pOut = box;
+}
+
+/**
+  * @brief  Add a rectangle to the dirty region
+  * @note   The rectangles of the region never overlap: a rectangle is merged
+  *         with any rectangle it overlaps, and with a rectangle it touches
+  *         when their bounding rectangle adds no more area than it saves.
+  *         When the list is full, the rectangle is merged with the one whose
+  *         bounding rectangle grows the least.
+  * @param  Box: rectangle to add, snapped to the tile grid
+  * @retval None
+  */
+static void Comp_AddBox(DMA2D_Comp_BoxTypeDef Box)
+{
+  DMA2D_Comp_BoxTypeDef join;
+  uint32_t i, merge, cost, best;
+
+  do
+  {
+    merge = DMA2D_COMP_NONE;
+
+    for(i = 0U; (i < CompRectCount) && (merge == DMA2D_COMP_NONE); i++)
+    {
+      if(Comp_Intersect(&Box, &CompRects[i], NULL) != 0U)
+      {
+        merge = i;
+      }
+      else if((Box.X0 <= CompRects[i].X1) && (CompRects[i].X0 <= Box.X1) &&
+              (Box.Y0 <= CompRects[i].Y1) && (CompRects[i].Y0 <= Box.Y1))
+      {
+        Comp_Union(&Box, &CompRects[i], &join);
+        if(DMA2D_COMP_AREA(&join) <= (DMA2D_COMP_AREA(&Box) + DMA2D_COMP_AREA(&CompRects[i])))
+        {
+          merge = i;
+        }
+      }
+    }
+
+    if((merge == DMA2D_COMP_NONE) && (CompRectCount >= DMA2D_COMP_MAX_RECTS))
+    {
+      best = DMA2D_COMP_NONE;
+      for(i = 0U; i < CompRectCount; i++)
+      {
+        Comp_Union(&Box, &CompRects[i], &join);
+        cost = DMA2D_COMP_AREA(&join) - DMA2D_COMP_AREA(&CompRects[i]);
+        if(cost < best)
+        {
+          best  = cost;
+          merge = i;
+        }
+      }
+    }
+
+    if(merge != DMA2D_COMP_NONE)
+    {
+      /* The bounding rectangle may now overlap others: add it again */
+      Comp_Union(&Box, &CompRects[merge], &Box);
+      CompRectCount--;
+      CompRects[merge] = CompRects[CompRectCount];
+    }
+  } while(merge != DMA2D_COMP_NONE);
+
+  CompRects[CompRectCount] = Box;
+  CompRectCount++;
+}
+
+/**
+  * @brief  Tell whether a rectangle intersects the dirty region
+  * @param  pBox: rectangle, clipped to the target
+  * @retval 1 when it does, 0 otherwise
+  */
+static uint32_t Comp_IsBoxDirty(const DMA2D_Comp_BoxTypeDef *pBox)
+{
+  uint32_t i;
+
+  for(i = 0U; i < CompRectCount; i++)
+  {
+    if(Comp_Intersect(pBox, &CompRects[i], NULL) != 0U)
+    {
+      return 1U;
+    }
+  }
+  return 0U;
+}
+
+/**
+  * @brief  Queue a drawing command
+  * @note   A command outside of the dirty region is dropped.
+  * @param  Op: operation
+  * @param  pRect: area of the target to draw
+  * @param  pSrc: source image, NULL for a fill
+  * @param  SrcX: source column drawn at pRect->X
+  * @param  SrcY: source line drawn at pRect->Y
+  * @param  Color: fill color, or color of an A8 source
+  * @param  Alpha: constant alpha of the source
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef Comp_Queue(DMA2D_Comp_OpTypeDef Op, const DMA2D_Comp_RectTypeDef *pRect,
+                                    const DMA2D_Comp_SurfaceTypeDef *pSrc, uint16_t SrcX, uint16_t SrcY,
+                                    uint32_t Color, uint8_t Alpha)
+{
+  DMA2D_Comp_CmdTypeDef *pCmd;
+  DMA2D_Comp_BoxTypeDef box;
+
+  if(CompBusy != 0U)
+  {
+    return HAL_BUSY;
+  }
+  if((Op != DMA2D_COMP_OP_FILL) && ((pSrc == NULL) || (Comp_GetBits(pSrc->ColorMode) == 0U)))
+  {
+    return HAL_ERROR;
+  }
+  if((Comp_Clip(pRect, &box) == 0U) || (Comp_IsBoxDirty(&box) == 0U))
+  {
+    return HAL_OK;
+  }
+  if(CompCmdCount >= DMA2D_COMP_MAX_CMDS)
+  {
+    return HAL_ERROR;
+  }
+
+  pCmd = &CompCmds[CompCmdCount];
+  pCmd->Op    = Op;
+  pCmd->Box   = box;
+  pCmd->Color = Color;
+  pCmd->Alpha = Alpha;
+  if(pSrc != NULL)
+  {
+    pCmd->Src     = *pSrc;
+    pCmd->OffsetX = (int32_t)SrcX - (int32_t)pRect->X;
+    pCmd->OffsetY = (int32_t)SrcY - (int32_t)pRect->Y;
+  }
+  CompCmdCount++;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Get the address of a pixel
+  * @param  pSurface: image
+  * @param  X: column of the pixel
+  * @param  Y: line of the pixel
+  * @retval Address of the pixel
+  */
+static uint32_t Comp_Address(const DMA2D_Comp_SurfaceTypeDef *pSurface, uint32_t X, uint32_t Y)
+{
+  return pSurface->Address + (((Y * pSurface->Pitch) + X) * Comp_GetBits(pSurface->ColorMode)) / 8U;
+}
+
+/**
+  * @brief  Start the DMA2D transfer of one command over one rectangle
+  * @param  pCmd: command
+  * @param  pBox: part of the command to draw
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef Comp_Start(const DMA2D_Comp_CmdTypeDef *pCmd, const DMA2D_Comp_BoxTypeDef *pBox)
+{
+  uint32_t width  = (uint32_t)pBox->X1 - pBox->X0;
+  uint32_t height = (uint32_t)pBox->Y1 - pBox->Y0;
+  uint32_t dst    = Comp_Address(&CompTarget, pBox->X0, pBox->Y0);
+  uint32_t src    = 0U;
+  HAL_StatusTypeDef status;
+
+  hdma2d_comp.Init.Mode         = CompModes[pCmd->Op];
+  hdma2d_comp.Init.ColorMode    = CompTarget.ColorMode;
+  hdma2d_comp.Init.OutputOffset = CompTarget.Pitch - width;
+  status = HAL_DMA2D_Init(&hdma2d_comp);
+
+  /* Foreground layer: the source image */
+  if((status == HAL_OK) && (pCmd->Op != DMA2D_COMP_OP_FILL))
+  {
+    src = Comp_Address(&pCmd->Src, (uint32_t)((int32_t)pBox->X0 + pCmd->OffsetX),
+                                   (uint32_t)((int32_t)pBox->Y0 + pCmd->OffsetY));
+
+    hdma2d_comp.LayerCfg[1].InputOffset    = pCmd->Src.Pitch - width;
+    hdma2d_comp.LayerCfg[1].InputColorMode = pCmd->Src.ColorMode;
+    if(pCmd->Src.ColorMode == DMA2D_INPUT_A8)
+    {
+      hdma2d_comp.LayerCfg[1].AlphaMode  = DMA2D_COMBINE_ALPHA;
+      hdma2d_comp.LayerCfg[1].InputAlpha = (pCmd->Alpha << 24U) | (pCmd->Color & 0x00FFFFFFU);
+    }
+    else
+    {
+      hdma2d_comp.LayerCfg[1].AlphaMode  = (pCmd->Alpha == 0xFFU) ? DMA2D_NO_MODIF_ALPHA : DMA2D_COMBINE_ALPHA;
+      hdma2d_comp.LayerCfg[1].InputAlpha = pCmd->Alpha;
+    }
+    status = HAL_DMA2D_ConfigLayer(&hdma2d_comp, 1U);
+  }
+
+  /* Background layer: the target itself */
+  if((status == HAL_OK) && (pCmd->Op == DMA2D_COMP_OP_BLEND))
+  {
+    hdma2d_comp.LayerCfg[0].InputOffset    = CompTarget.Pitch - width;
+    hdma2d_comp.LayerCfg[0].InputColorMode = CompTarget.ColorMode;
+    hdma2d_comp.LayerCfg[0].AlphaMode      = DMA2D_NO_MODIF_ALPHA;
+    hdma2d_comp.LayerCfg[0].InputAlpha     = 0xFFU;
+    status = HAL_DMA2D_ConfigLayer(&hdma2d_comp, 0U);
+  }
+
+  if(status == HAL_OK)
+  {
+    if(pCmd->Op == DMA2D_COMP_OP_BLEND)
+    {
+      status = HAL_DMA2D_BlendingStart_IT(&hdma2d_comp, src, dst, dst, width, height);
+    }
+    else if(pCmd->Op == DMA2D_COMP_OP_FILL)
+    {
+      status = HAL_DMA2D_Start_IT(&hdma2d_comp, pCmd->Color, dst, width, height);
+    }
+    else
+    {
+      status = HAL_DMA2D_Start_IT(&hdma2d_comp, src, dst, width, height);
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Start the next transfer of the batch, or end the batch
+  * @param  None
+  * @retval None
+  */
+static void Comp_StartNext(void)
+{
+  DMA2D_Comp_CmdTypeDef *pCmd;
+  DMA2D_Comp_BoxTypeDef box;
+  uint32_t started = 0U;
+
+  while((CompRect < CompRectCount) && (started == 0U))
+  {
+    if(CompCmd < CompCmdCount)
+    {
+      pCmd = &CompCmds[CompCmd];
+      CompCmd++;
+      if(Comp_Intersect(&pCmd->Box, &CompRects[CompRect], &box) != 0U)
+      {
+        if(Comp_Start(pCmd, &box) == HAL_OK)
+        {
+          started = 1U;
+        }
+        else
+        {
+          CompStatus = HAL_ERROR;
+          CompRect   = CompRectCount;
+        }
+      }
+    }
+    else
+    {
+      CompRect++;
+      CompCmd = 0U;
+    }
+  }
+
+  if(started == 0U)
+  {
+    for(CompDrawnCount = 0U; CompDrawnCount < CompRectCount; CompDrawnCount++)
+    {
+      CompDrawn[CompDrawnCount] = CompRects[CompDrawnCount];
+    }
+    CompRectCount = 0U;
+    CompCmdCount  = 0U;
+    CompBusy      = 0U;
+    DMA2D_Comp_FlushCpltCallback();
+  }
+}
+
+/**
+  * @brief  DMA2D transfer complete callback
+  * @param  hdma2d: DMA2D handle
+  * @retval None
+  */
+static void Comp_XferCplt(DMA2D_HandleTypeDef *hdma2d)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hdma2d);
+
+  Comp_StartNext();
+}
+
+/**
+  * @brief  DMA2D transfer error callback: the rest of the batch is dropped
+  * @param  hdma2d: DMA2D handle
+  * @retval None
+  */
+static void Comp_XferError(DMA2D_HandleTypeDef *hdma2d)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hdma2d);
+
+  CompStatus = HAL_ERROR;
+  CompRect   = CompRectCount;
+  Comp_StartNext();
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
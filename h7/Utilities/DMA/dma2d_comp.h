@@ -0,0 +1,106 @@
+/**
+  ******************************************************************************
+  * @file    dma2d_comp.h
+  * @author  MCD Application Team
+  * @brief   Header for dma2d_comp module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _DMA2D_COMP_H__
+#define _DMA2D_COMP_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  uint16_t X;       /* Left column, in pixels */
+  uint16_t Y;       /* Top line, in pixels    */
+  uint16_t Width;   /* Width, in pixels       */
+  uint16_t Height;  /* Height, in pixels      */
+} DMA2D_Comp_RectTypeDef;
+
+typedef struct
+{
+  uint32_t Address;    /* Address of pixel (0,0)                               */
+  uint32_t ColorMode;  /* DMA2D_INPUT_xxx (DMA2D_OUTPUT_xxx for the target)    */
+  uint32_t Pitch;      /* Distance between two lines, in pixels                */
+} DMA2D_Comp_SurfaceTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Dirty rectangles are snapped to this grid, in pixels. Override in main.h. */
+#if !defined(DMA2D_COMP_TILE_SIZE)
+#define DMA2D_COMP_TILE_SIZE      16U
+#endif
+/* Disjoint dirty rectangles kept per frame */
+#if !defined(DMA2D_COMP_MAX_RECTS)
+#define DMA2D_COMP_MAX_RECTS      16U
+#endif
+/* Drawing commands queued per frame */
+#if !defined(DMA2D_COMP_MAX_CMDS)
+#define DMA2D_COMP_MAX_CMDS       32U
+#endif
+/* Preemption priority of the DMA2D interrupt */
+#if !defined(DMA2D_COMP_IRQ_PRIORITY)
+#define DMA2D_COMP_IRQ_PRIORITY   0x0FU
+#endif
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef DMA2D_Comp_Init(const DMA2D_Comp_SurfaceTypeDef *pTarget, uint16_t Width, uint16_t Height);
+HAL_StatusTypeDef DMA2D_Comp_SetTargetAddress(uint32_t Address);
+void              DMA2D_Comp_Invalidate(const DMA2D_Comp_RectTypeDef *pRect);
+void              DMA2D_Comp_InvalidateAll(void);
+uint32_t          DMA2D_Comp_IsDirty(const DMA2D_Comp_RectTypeDef *pRect);
+HAL_StatusTypeDef DMA2D_Comp_Fill(const DMA2D_Comp_RectTypeDef *pRect, uint32_t Color);
+HAL_StatusTypeDef DMA2D_Comp_Copy(const DMA2D_Comp_RectTypeDef *pRect, const DMA2D_Comp_SurfaceTypeDef *pSrc, uint16_t SrcX, uint16_t SrcY);
+HAL_StatusTypeDef DMA2D_Comp_Convert(const DMA2D_Comp_RectTypeDef *pRect, const DMA2D_Comp_SurfaceTypeDef *pSrc, uint16_t SrcX, uint16_t SrcY);
+HAL_StatusTypeDef DMA2D_Comp_Blend(const DMA2D_Comp_RectTypeDef *pRect, const DMA2D_Comp_SurfaceTypeDef *pSrc, uint16_t SrcX, uint16_t SrcY, uint32_t Color, uint8_t Alpha);
+HAL_StatusTypeDef DMA2D_Comp_Flush(void);
+uint32_t          DMA2D_Comp_IsBusy(void);
+HAL_StatusTypeDef DMA2D_Comp_WaitForFlush(uint32_t Timeout);
+uint32_t          DMA2D_Comp_GetDrawnRects(DMA2D_Comp_RectTypeDef *pRects, uint32_t MaxRects);
+void              DMA2D_Comp_IRQHandler(void);
+void              DMA2D_Comp_FlushCpltCallback(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _DMA2D_COMP_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,513 @@
+/**
+  ******************************************************************************
+  * @file    dma2d_rot.c
+  * @author  MCD Application Team
+  * @brief   Rotation and mirroring of a frame to the scan-out framebuffer
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- initialize the rotation with the frame the application draws, in its own
+   orientation (e.g. portrait), the scan-out framebuffer of the panel and the
+   orientation of the frame on the panel, DMA2D_ROT_xxx.
+
+2- once the frame is drawn (DMA2D_Comp_WaitForFlush() when the compositor
+   draws it), call DMA2D_Rot_Rect() for each area that changed: only these
+   areas are copied to the framebuffer. DMA2D_Rot_MapRect() gives the area
+   of the framebuffer written for an area of the frame.
+
+3- when the framebuffer is double buffered (BSP_LCD_Present()), give the new
+   back buffer with DMA2D_Rot_SetAddresses().
+
+An area is copied in one of three ways:
+ - DMA2D_ROT_0: one DMA2D transfer, with pixel format conversion when the
+   frame and the framebuffer color modes differ.
+ - DMA2D_ROT_MIRROR_Y: one DMA2D transfer per line, the lines of the
+   framebuffer being written upwards.
+ - the other orientations reverse the pixels of a line or swap the axes,
+   which the DMA2D cannot do. The CPU rotates DMA2D_ROT_TILE_SIZE square
+   tiles of the frame into a staging buffer that stays in the data cache,
+   reading the frame line by line, and the DMA2D writes each rotated tile
+   to the framebuffer, with pixel format conversion, while the CPU rotates
+   the next one.
+
+The frame must be in a color mode of 8, 16 or 32 bits per pixel. The DMA2D is
+used in polling mode: DMA2D_Rot_Rect() returns HAL_BUSY while the compositor
+runs a batch.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "dma2d_rot.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* DMA2D transfer timeout, in ms */
+#define DMA2D_ROT_TIMEOUT  100U
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static DMA2D_HandleTypeDef       hdma2d_rot;
+static DMA2D_Comp_SurfaceTypeDef RotSrc;
+static DMA2D_Comp_SurfaceTypeDef RotDst;
+static uint16_t                  RotWidth;
+static uint16_t                  RotHeight;
+static uint32_t                  RotOrientation;
+
+/* Rotated tiles: the CPU fills one while the DMA2D reads the other */
+ALIGN_32BYTES(static uint32_t RotTile[2][DMA2D_ROT_TILE_SIZE * DMA2D_ROT_TILE_SIZE]);
+
+/* Bytes per pixel of each DMA2D color mode, 0 when not supported */
+static const uint8_t RotBytes[] =
+{
+  4U, /* ARGB8888 */  3U, /* RGB888 */  2U, /* RGB565 */  2U, /* ARGB1555 */
+  2U, /* ARGB4444 */  1U, /* L8     */  1U, /* AL44   */  2U, /* AL88     */
+  0U, /* L4       */  1U, /* A8     */  0U  /* A4     */
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t          Rot_GetBytes(uint32_t ColorMode);
+static uint32_t          Rot_Address(const DMA2D_Comp_SurfaceTypeDef *pSurface, uint32_t X, uint32_t Y);
+static HAL_StatusTypeDef Rot_Config(void);
+static HAL_StatusTypeDef Rot_Start(uint32_t Src, uint32_t SrcOffset, uint32_t Dst, uint32_t Width, uint32_t Height);
+static void              Rot_InvalidateSource(const DMA2D_Comp_RectTypeDef *pRect);
+static void              Rot_Tile(uint32_t X, uint32_t Y, uint32_t Width, uint32_t Height, void *pTile);
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Initialize the rotation of a frame to the scan-out framebuffer
+  * @param  pSrc: frame drawn by the application, in a DMA2D_INPUT_xxx format
+  *         of 8, 16 or 32 bits per pixel
+  * @param  Width: width of the frame, in pixels
+  * @param  Height: height of the frame, in pixels
+  * @param  pDst: framebuffer, in DMA2D_OUTPUT_xxx format, of Height x Width
+  *         pixels when the orientation swaps the axes, Width x Height otherwise
+  * @param  Orientation: orientation of the frame in the framebuffer, DMA2D_ROT_xxx
+  * @retval HAL status
+  */
+HAL_StatusTypeDef DMA2D_Rot_Init(const DMA2D_Comp_SurfaceTypeDef *pSrc, uint16_t Width, uint16_t Height,
+                                 const DMA2D_Comp_SurfaceTypeDef *pDst, uint32_t Orientation)
+{
+  uint32_t bytes;
+
+  if((pSrc == NULL) || (pDst == NULL) || (pDst->ColorMode > DMA2D_OUTPUT_ARGB4444) ||
+     (Orientation > (DMA2D_ROT_SWAP_XY | DMA2D_ROT_MIRROR_X | DMA2D_ROT_MIRROR_Y)))
+  {
+    return HAL_ERROR;
+  }
+  bytes = Rot_GetBytes(pSrc->ColorMode);
+  if((bytes == 0U) || (bytes == 3U))
+  {
+    return HAL_ERROR;
+  }
+  /* The pixel format conversion of indexed and alpha only sources needs a CLUT or a color */
+  if((pSrc->ColorMode != pDst->ColorMode) && (pSrc->ColorMode > DMA2D_INPUT_ARGB4444))
+  {
+    return HAL_ERROR;
+  }
+
+  RotSrc         = *pSrc;
+  RotDst         = *pDst;
+  RotWidth       = Width;
+  RotHeight      = Height;
+  RotOrientation = Orientation;
+
+  __HAL_RCC_DMA2D_CLK_ENABLE();
+
+  hdma2d_rot.Instance = DMA2D;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Change the frame and the framebuffer of the next rotations
+  * @param  SrcAddress: address of pixel (0,0) of the new frame
+  * @param  DstAddress: address of pixel (0,0) of the new framebuffer
+  * @retval HAL status
+  */
+HAL_StatusTypeDef DMA2D_Rot_SetAddresses(uint32_t SrcAddress, uint32_t DstAddress)
+{
+  RotSrc.Address = SrcAddress;
+  RotDst.Address = DstAddress;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Get the area of the framebuffer showing an area of the frame
+  * @param  pRect: area of the frame, inside the frame
+  * @param  pDstRect: area of the framebuffer
+  * @retval None
+  */
+void DMA2D_Rot_MapRect(const DMA2D_Comp_RectTypeDef *pRect, DMA2D_Comp_RectTypeDef *pDstRect)
+{
+  DMA2D_Comp_RectTypeDef rect = *pRect;
+  uint16_t width  = RotWidth;
+  uint16_t height = RotHeight;
+
+  if((RotOrientation & DMA2D_ROT_SWAP_XY) != 0U)
+  {
+    rect.X      = pRect->Y;
+    rect.Y      = pRect->X;
+    rect.Width  = pRect->Height;
+    rect.Height = pRect->Width;
+    width       = RotHeight;
+    height      = RotWidth;
+  }
+  if((RotOrientation & DMA2D_ROT_MIRROR_X) != 0U)
+  {
+    rect.X = (uint16_t)(width - rect.X - rect.Width);
+  }
+  if((RotOrientation & DMA2D_ROT_MIRROR_Y) != 0U)
+  {
+    rect.Y = (uint16_t)(height - rect.Y - rect.Height);
+  }
+  *pDstRect = rect;
+}
+
+/**
+  * @brief  Copy an area of the frame to the framebuffer, in its orientation
+  * @note   Blocking: returns once the area is written to the framebuffer.
+  * @param  pRect: area of the frame, clipped to the frame
+  * @retval HAL status
+  */
+HAL_StatusTypeDef DMA2D_Rot_Rect(const DMA2D_Comp_RectTypeDef *pRect)
+{
+  DMA2D_Comp_RectTypeDef rect, tile, dst;
+  uint32_t x, y, x1, y1;
+  uint32_t buffer = 0U;
+  uint32_t busy   = 0U;
+  HAL_StatusTypeDef status;
+
+  if((pRect == NULL) || (hdma2d_rot.Instance == NULL))
+  {
+    return HAL_ERROR;
+  }
+  if(DMA2D_Comp_IsBusy() != 0U)
+  {
+    return HAL_BUSY;
+  }
+
+  /* Clip the area to the frame */
+  if((pRect->X >= RotWidth) || (pRect->Y >= RotHeight) || (pRect->Width == 0U) || (pRect->Height == 0U))
+  {
+    return HAL_OK;
+  }
+  rect = *pRect;
+  if(((uint32_t)rect.X + rect.Width) > RotWidth)
+  {
+    rect.Width = (uint16_t)(RotWidth - rect.X);
+  }
+  if(((uint32_t)rect.Y + rect.Height) > RotHeight)
+  {
+    rect.Height = (uint16_t)(RotHeight - rect.Y);
+  }
+
+  status = Rot_Config();
+  if(status != HAL_OK)
+  {
+    return status;
+  }
+
+  DMA2D_Rot_MapRect(&rect, &dst);
+
+  if(RotOrientation == DMA2D_ROT_0)
+  {
+    status = Rot_Start(Rot_Address(&RotSrc, rect.X, rect.Y), RotSrc.Pitch - rect.Width,
+                       Rot_Address(&RotDst, dst.X, dst.Y), rect.Width, rect.Height);
+    if(status == HAL_OK)
+    {
+      status = HAL_DMA2D_PollForTransfer(&hdma2d_rot, DMA2D_ROT_TIMEOUT);
+    }
+    return status;
+  }
+
+  if(RotOrientation == DMA2D_ROT_MIRROR_Y)
+  {
+    /* Line y of the area goes to the line of the framebuffer counted from the bottom */
+    for(y = 0U; (y < rect.Height) && (status == HAL_OK); y++)
+    {
+      status = Rot_Start(Rot_Address(&RotSrc, rect.X, rect.Y + y), 0U,
+                         Rot_Address(&RotDst, dst.X, (uint32_t)dst.Y + dst.Height - 1U - y), rect.Width, 1U);
+      if(status == HAL_OK)
+      {
+        status = HAL_DMA2D_PollForTransfer(&hdma2d_rot, DMA2D_ROT_TIMEOUT);
+      }
+    }
+    return status;
+  }
+
+  /* The CPU reads the frame: drop the cache lines the DMA2D made stale */
+  Rot_InvalidateSource(&rect);
+
+  x1 = (uint32_t)rect.X + rect.Width;
+  y1 = (uint32_t)rect.Y + rect.Height;
+  for(y = rect.Y; (y < y1) && (status == HAL_OK); y += DMA2D_ROT_TILE_SIZE)
+  {
+    for(x = rect.X; (x < x1) && (status == HAL_OK); x += DMA2D_ROT_TILE_SIZE)
+    {
+      tile.X      = (uint16_t)x;
+      tile.Y      = (uint16_t)y;
+      tile.Width  = (uint16_t)(((x1 - x) < DMA2D_ROT_TILE_SIZE) ? (x1 - x) : DMA2D_ROT_TILE_SIZE);
+      tile.Height = (uint16_t)(((y1 - y) < DMA2D_ROT_TILE_SIZE) ? (y1 - y) : DMA2D_ROT_TILE_SIZE);
+
+      /* Rotate the tile while the DMA2D writes the previous one */
+      Rot_Tile(x, y, tile.Width, tile.Height, RotTile[buffer]);
+
+#if (__DCACHE_PRESENT == 1)
+      /* Write the rotated tile to memory before the DMA2D reads it */
+      if((SCB->CCR & SCB_CCR_DC_Msk) != 0)
+      {
+        SCB_CleanDCache_by_Addr(RotTile[buffer], (int32_t)sizeof(RotTile[0]));
+      }
+#endif
+
+      if(busy != 0U)
+      {
+        busy   = 0U;
+        status = HAL_DMA2D_PollForTransfer(&hdma2d_rot, DMA2D_ROT_TIMEOUT);
+      }
+      if(status == HAL_OK)
+      {
+        DMA2D_Rot_MapRect(&tile, &dst);
+        status = Rot_Start((uint32_t)RotTile[buffer], 0U, Rot_Address(&RotDst, dst.X, dst.Y), dst.Width, dst.Height);
+        busy   = (status == HAL_OK) ? 1U : 0U;
+      }
+      buffer ^= 1U;
+    }
+  }
+
+  if(busy != 0U)
+  {
+    status = HAL_DMA2D_PollForTransfer(&hdma2d_rot, DMA2D_ROT_TIMEOUT);
+  }
+  return status;
+}
+
+/**
+  * @brief  Get the number of bytes per pixel of a color mode
+  * @param  ColorMode: DMA2D_INPUT_xxx or DMA2D_OUTPUT_xxx
+  * @retval Bytes per pixel, 0 when the color mode is not supported
+  */
+static uint32_t Rot_GetBytes(uint32_t ColorMode)
+{
+  if(ColorMode >= (sizeof(RotBytes) / sizeof(RotBytes[0])))
+  {
+    return 0U;
+  }
+  return RotBytes[ColorMode];
+}
+
+/**
+  * @brief  Get the address of a pixel
+  * @param  pSurface: image
+  * @param  X: column of the pixel
+  * @param  Y: line of the pixel
+  * @retval Address of the pixel
+  */
+static uint32_t Rot_Address(const DMA2D_Comp_SurfaceTypeDef *pSurface, uint32_t X, uint32_t Y)
+{
+  return pSurface->Address + (((Y * pSurface->Pitch) + X) * Rot_GetBytes(pSurface->ColorMode));
+}
+
+/**
+  * @brief  Configure the DMA2D for the copies of the frame to the framebuffer
+  * @note   Rot_Start() only changes the offsets and the addresses afterwards.
+  * @param  None
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef Rot_Config(void)
+{
+  hdma2d_rot.Init.Mode         = (RotSrc.ColorMode == RotDst.ColorMode) ? DMA2D_M2M : DMA2D_M2M_PFC;
+  hdma2d_rot.Init.ColorMode    = RotDst.ColorMode;
+  hdma2d_rot.Init.OutputOffset = 0U;
+  if(HAL_DMA2D_Init(&hdma2d_rot) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  hdma2d_rot.LayerCfg[1].InputOffset    = 0U;
+  hdma2d_rot.LayerCfg[1].InputColorMode = RotSrc.ColorMode;
+  hdma2d_rot.LayerCfg[1].AlphaMode      = DMA2D_NO_MODIF_ALPHA;
+  hdma2d_rot.LayerCfg[1].InputAlpha     = 0xFFU;
+  return HAL_DMA2D_ConfigLayer(&hdma2d_rot, 1U);
+}
+
+/**
+  * @brief  Start the DMA2D transfer of a block to the framebuffer
+  * @param  Src: address of the first pixel of the block
+  * @param  SrcOffset: pixels skipped at the end of each source line
+  * @param  Dst: address of the first pixel written in the framebuffer
+  * @param  Width: width of the block, in pixels
+  * @param  Height: height of the block, in pixels
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef Rot_Start(uint32_t Src, uint32_t SrcOffset, uint32_t Dst, uint32_t Width, uint32_t Height)
+{
+  MODIFY_REG(hdma2d_rot.Instance->FGOR, DMA2D_FGOR_LO, SrcOffset);
+  MODIFY_REG(hdma2d_rot.Instance->OOR, DMA2D_OOR_LO, RotDst.Pitch - Width);
+
+  return HAL_DMA2D_Start(&hdma2d_rot, Src, Dst, Width, Height);
+}
+
+/**
+  * @brief  Clean and invalidate the data cache lines of an area of the frame
+  * @param  pRect: area of the frame
+  * @retval None
+  */
+static void Rot_InvalidateSource(const DMA2D_Comp_RectTypeDef *pRect)
+{
+#if (__DCACHE_PRESENT == 1)
+  uint32_t y, start, end;
+
+  if((SCB->CCR & SCB_CCR_DC_Msk) != 0)
+  {
+    for(y = pRect->Y; y < ((uint32_t)pRect->Y + pRect->Height); y++)
+    {
+      start = Rot_Address(&RotSrc, pRect->X, y) & ~31U;
+      end   = Rot_Address(&RotSrc, (uint32_t)pRect->X + pRect->Width, y);
+      SCB_CleanInvalidateDCache_by_Addr((uint32_t *)start, (int32_t)(end - start));
+    }
+  }
+#else
+  UNUSED(pRect);
+#endif
+}
+
+/**
+  * @brief  Rotate a tile of the frame into a staging buffer
+  * @param  X: first column of the tile in the frame
+  * @param  Y: first line of the tile in the frame
+  * @param  Width: width of the tile, at most DMA2D_ROT_TILE_SIZE
+  * @param  Height: height of the tile, at most DMA2D_ROT_TILE_SIZE
+  * @param  pTile: staging buffer, receiving the lines of the rotated tile
+  *         without gap
+  * @retval None
+  */
+static void Rot_Tile(uint32_t X, uint32_t Y, uint32_t Width, uint32_t Height, void *pTile)
+{
+  uint32_t width  = Width;   /* Size of the rotated tile */
+  uint32_t height = Height;
+  int32_t  start  = 0;       /* Index of pixel (0,0) of the tile in the rotated tile */
+  int32_t  stepx, stepy;     /* Index step to the next column and to the next line   */
+  int32_t  stepu, stepv;
+  int32_t  index;
+  uint32_t i, j;
+
+  if((RotOrientation & DMA2D_ROT_SWAP_XY) != 0U)
+  {
+    width  = Height;
+    height = Width;
+  }
+  stepu = 1;
+  stepv = (int32_t)width;
+  if((RotOrientation & DMA2D_ROT_MIRROR_X) != 0U)
+  {
+    start += (int32_t)width - 1;
+    stepu  = -1;
+  }
+  if((RotOrientation & DMA2D_ROT_MIRROR_Y) != 0U)
+  {
+    start += ((int32_t)height - 1) * (int32_t)width;
+    stepv  = -(int32_t)width;
+  }
+  if((RotOrientation & DMA2D_ROT_SWAP_XY) != 0U)
+  {
+    stepx = stepv;
+    stepy = stepu;
+  }
+  else
+  {
+    stepx = stepu;
+    stepy = stepv;
+  }
+
+  switch(Rot_GetBytes(RotSrc.ColorMode))
+  {
+  case 4U:
+    {
+      const uint32_t *pline = (const uint32_t *)Rot_Address(&RotSrc, X, Y);
+      uint32_t *pdst = (uint32_t *)pTile;
+
+      for(j = 0U; j < Height; j++)
+      {
+        index = start + ((int32_t)j * stepy);
+        for(i = 0U; i < Width; i++)
+        {
+          pdst[index] = pline[i];
+          index += stepx;
+        }
+        pline += RotSrc.Pitch;
+      }
+    }
+    break;
+
+  case 2U:
+    {
+      const uint16_t *pline = (const uint16_t *)Rot_Address(&RotSrc, X, Y);
+      uint16_t *pdst = (uint16_t *)pTile;
+
+      for(j = 0U; j < Height; j++)
+      {
+        index = start + ((int32_t)j * stepy);
+        for(i = 0U; i < Width; i++)
+        {
+          pdst[index] = pline[i];
+          index += stepx;
+        }
+        pline += RotSrc.Pitch;
+      }
+    }
+    break;
+
+  default:
+    {
+      const uint8_t *pline = (const uint8_t *)Rot_Address(&RotSrc, X, Y);
+      uint8_t *pdst = (uint8_t *)pTile;
+
+      for(j = 0U; j < Height; j++)
+      {
+        index = start + ((int32_t)j * stepy);
+        for(i = 0U; i < Width; i++)
+        {
+          pdst[index] = pline[i];
+          index += stepx;
+        }
+        pline += RotSrc.Pitch;
+      }
+    }
+    break;
+  }
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,82 @@
+/**
+  ******************************************************************************
+  * @file    dma2d_rot.h
+  * @author  MCD Application Team
+  * @brief   Header for dma2d_rot module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _DMA2D_ROT_H__
+#define _DMA2D_ROT_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "dma2d_comp.h"
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+/* Orientation of the destination, combination of the elementary transforms
+   applied to the source: axes swap first, then the mirrors */
+#define DMA2D_ROT_SWAP_XY       0x01U   /* Source lines become columns   */
+#define DMA2D_ROT_MIRROR_X      0x02U   /* Columns in reverse order      */
+#define DMA2D_ROT_MIRROR_Y      0x04U   /* Lines in reverse order        */
+
+#define DMA2D_ROT_0             0x00U
+#define DMA2D_ROT_90            (DMA2D_ROT_SWAP_XY | DMA2D_ROT_MIRROR_X)   /* Clockwise */
+#define DMA2D_ROT_180           (DMA2D_ROT_MIRROR_X | DMA2D_ROT_MIRROR_Y)
+#define DMA2D_ROT_270           (DMA2D_ROT_SWAP_XY | DMA2D_ROT_MIRROR_Y)
+
+/* Source tile rotated by the CPU, in pixels: a tile in 32 bits per pixel and
+   its rotated copy must fit in the data cache. Override in main.h. */
+#if !defined(DMA2D_ROT_TILE_SIZE)
+#define DMA2D_ROT_TILE_SIZE     32U
+#endif
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef DMA2D_Rot_Init(const DMA2D_Comp_SurfaceTypeDef *pSrc, uint16_t Width, uint16_t Height,
+                                 const DMA2D_Comp_SurfaceTypeDef *pDst, uint32_t Orientation);
+HAL_StatusTypeDef DMA2D_Rot_SetAddresses(uint32_t SrcAddress, uint32_t DstAddress);
+void              DMA2D_Rot_MapRect(const DMA2D_Comp_RectTypeDef *pRect, DMA2D_Comp_RectTypeDef *pDstRect);
+HAL_StatusTypeDef DMA2D_Rot_Rect(const DMA2D_Comp_RectTypeDef *pRect);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _DMA2D_ROT_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,294 @@
+/**
+  ******************************************************************************
+  * @file    dma_bounce.c
+  * @author  MCD Application Team
+  * @brief   Bounce buffers of the HAL DMA and SD drivers over the dma_pool
+  *          buffers, with staging statistics
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- set USE_HAL_DMA_BOUNCE_BUFFER to 1 in stm32h7xx_hal_conf.h and add the
+   dma_pool module: this module implements the bounce buffer callbacks of
+   the HAL DMA driver over the dma_pool buffers.
+
+2- size the pools in main.h for the largest transfers to stage at once :
+      BDMA                      -> DMA_POOL_RAM_D3
+      SDMMC1                    -> DMA_POOL_RAM_D1
+      DMA1, DMA2 and SDMMC2     -> DMA_POOL_RAM_D2, then DMA_POOL_RAM_D1
+
+3- the buffers of HAL_DMA_Start(), HAL_DMA_Start_IT(), the peripheral drivers
+   built on them, HAL_SD_ReadBlocks_DMA() and HAL_SD_WriteBlocks_DMA() which
+   the master cannot reach (DTCM, ITCM, or outside the D3 domain for the
+   BDMA) are then staged transparently. A transfer fails with
+   HAL_DMA_ERROR_BOUNCE or HAL_SD_ERROR_DMA when the pool is exhausted.
+
+4- each staging costs a copy. DMA_Bounce_GetStats() and DMA_Bounce_GetHot()
+   report the buffers staged most often: move them to a memory the master
+   reaches, ex. with the dma_pool allocator, to avoid the copies.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "dma_bounce.h"
+#include "dma_pool.h"
+#if (DMA_BOUNCE_USE_MEM_FAST == 1U)
+#include "mem_fast.h"
+#else
+#include <string.h>
+#endif
+
+#if (USE_HAL_DMA_BOUNCE_BUFFER != 1U)
+#error "dma_bounce requires USE_HAL_DMA_BOUNCE_BUFFER set to 1 in stm32h7xx_hal_conf.h"
+#endif
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+#define DMA_BOUNCE_IS_BDMA(__MASTER__)  (((__MASTER__) >= (uint32_t)BDMA_Channel0) && \
+                                         ((__MASTER__) <= (uint32_t)BDMA_Channel7))
+
+/* Private function prototypes -----------------------------------------------*/
+static void DMA_Bounce_Record(uint32_t Master, uint32_t Address, uint32_t Size, void *pBuffer);
+
+/* Private variables ---------------------------------------------------------*/
+static DMA_Bounce_StatsTypeDef DMA_Bounce_Stats;
+static DMA_Bounce_HotTypeDef   DMA_Bounce_Hot[DMA_BOUNCE_HOT_SIZE];
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Allocate a bounce buffer in a pool the master reaches
+  * @param  Master: register base of the master
+  * @param  Address: buffer given by the application
+  * @param  Size: size of the buffer in bytes
+  * @retval Bounce buffer, NULL when the pools are exhausted
+  */
+void *HAL_DMA_BounceAllocCallback(uint32_t Master, uint32_t Address, uint32_t Size)
+{
+  void *pBuffer;
+
+  if(DMA_BOUNCE_IS_BDMA(Master))
+  {
+    pBuffer = DMA_Pool_Alloc(DMA_POOL_RAM_D3, Size);
+  }
+  else if(Master == (uint32_t)SDMMC1)
+  {
+    pBuffer = DMA_Pool_Alloc(DMA_POOL_RAM_D1, Size);
+  }
+  else
+  {
+    pBuffer = DMA_Pool_Alloc(DMA_POOL_RAM_D2, Size);
+    if(pBuffer == NULL)
+    {
+      pBuffer = DMA_Pool_Alloc(DMA_POOL_RAM_D1, Size);
+    }
+  }
+
+  DMA_Bounce_Record(Master, Address, Size, pBuffer);
+
+  return pBuffer;
+}
+
+/**
+  * @brief  Give a bounce buffer back to its pool
+  * @param  Master: register base of the master
+  * @param  pBounce: bounce buffer
+  * @retval None
+  */
+void HAL_DMA_BounceFreeCallback(uint32_t Master, void *pBounce)
+{
+  UNUSED(Master);
+
+  DMA_Pool_Free(pBounce);
+}
+
+/**
+  * @brief  Copy data between a bounce buffer and an application buffer
+  * @param  pDst: destination
+  * @param  pSrc: source
+  * @param  Size: number of bytes
+  * @retval None
+  */
+void HAL_DMA_BounceCopyCallback(void *pDst, const void *pSrc, uint32_t Size)
+{
+#if (DMA_BOUNCE_USE_MEM_FAST == 1U)
+  (void)MEM_Fast_Copy(pDst, pSrc, Size);
+#else
+  (void)memcpy(pDst, pSrc, Size);
+#endif
+}
+
+/**
+  * @brief  Get the staging counters
+  * @param  pStats: counters, filled
+  * @retval None
+  */
+void DMA_Bounce_GetStats(DMA_Bounce_StatsTypeDef *pStats)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  *pStats = DMA_Bounce_Stats;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Get the application buffers staged most often
+  * @param  pHot: entries, filled by decreasing count
+  * @param  MaxCount: size of the pHot array
+  * @retval Number of entries filled
+  */
+uint32_t DMA_Bounce_GetHot(DMA_Bounce_HotTypeDef *pHot, uint32_t MaxCount)
+{
+  DMA_Bounce_HotTypeDef hot[DMA_BOUNCE_HOT_SIZE];
+  DMA_Bounce_HotTypeDef entry;
+  uint32_t primask = __get_PRIMASK();
+  uint32_t count = 0U;
+  uint32_t i;
+  uint32_t j;
+
+  __disable_irq();
+  for(i = 0U; i < DMA_BOUNCE_HOT_SIZE; i++)
+  {
+    hot[i] = DMA_Bounce_Hot[i];
+  }
+  __set_PRIMASK(primask);
+
+  /* Insertion sort of the used entries by decreasing count */
+  for(i = 0U; i < DMA_BOUNCE_HOT_SIZE; i++)
+  {
+    if(hot[i].Count != 0U)
+    {
+      entry = hot[i];
+      j = count;
+      while((j > 0U) && (hot[j - 1U].Count < entry.Count))
+      {
+        hot[j] = hot[j - 1U];
+        j--;
+      }
+      hot[j] = entry;
+      count++;
+    }
+  }
+
+  if(count > MaxCount)
+  {
+    count = MaxCount;
+  }
+  for(i = 0U; i < count; i++)
+  {
+    pHot[i] = hot[i];
+  }
+
+  return count;
+}
+
+/**
+  * @brief  Clear the staging counters and the staged buffers
+  * @param  None
+  * @retval None
+  */
+void DMA_Bounce_ResetStats(void)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint32_t i;
+
+  __disable_irq();
+  DMA_Bounce_Stats.Transfers = 0U;
+  DMA_Bounce_Stats.Bytes = 0U;
+  DMA_Bounce_Stats.Failures = 0U;
+  DMA_Bounce_Stats.MaxSize = 0U;
+  for(i = 0U; i < DMA_BOUNCE_HOT_SIZE; i++)
+  {
+    DMA_Bounce_Hot[i].Count = 0U;
+  }
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Account a staging, the least staged buffer making way for a new one
+  * @param  Master: register base of the master
+  * @param  Address: buffer given by the application
+  * @param  Size: size of the buffer in bytes
+  * @param  pBuffer: bounce buffer, NULL on failure
+  * @retval None
+  */
+static void DMA_Bounce_Record(uint32_t Master, uint32_t Address, uint32_t Size, void *pBuffer)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint32_t slot = 0U;
+  uint32_t i;
+
+  __disable_irq();
+  if(pBuffer == NULL)
+  {
+    DMA_Bounce_Stats.Failures++;
+  }
+  else
+  {
+    DMA_Bounce_Stats.Transfers++;
+    DMA_Bounce_Stats.Bytes += Size;
+    if(Size > DMA_Bounce_Stats.MaxSize)
+    {
+      DMA_Bounce_Stats.MaxSize = Size;
+    }
+  }
+
+  for(i = 0U; i < DMA_BOUNCE_HOT_SIZE; i++)
+  {
+    if((DMA_Bounce_Hot[i].Count != 0U) && (DMA_Bounce_Hot[i].Address == Address) &&
+       (DMA_Bounce_Hot[i].Master == Master))
+    {
+      slot = i;
+      break;
+    }
+    if(DMA_Bounce_Hot[i].Count < DMA_Bounce_Hot[slot].Count)
+    {
+      slot = i;
+    }
+  }
+
+  if(i == DMA_BOUNCE_HOT_SIZE)
+  {
+    DMA_Bounce_Hot[slot].Address = Address;
+    DMA_Bounce_Hot[slot].Master = Master;
+    DMA_Bounce_Hot[slot].Count = 0U;
+    DMA_Bounce_Hot[slot].Bytes = 0U;
+  }
+  DMA_Bounce_Hot[slot].Count++;
+  DMA_Bounce_Hot[slot].Bytes += Size;
+  __set_PRIMASK(primask);
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
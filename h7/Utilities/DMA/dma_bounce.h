@@ -0,0 +1,89 @@
+/**
+  ******************************************************************************
+  * @file    dma_bounce.h
+  * @author  MCD Application Team
+  * @brief   Header for dma_bounce module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _DMA_BOUNCE_H__
+#define _DMA_BOUNCE_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported constants --------------------------------------------------------*/
+/* Set to 1 to copy the bounce buffers with MEM_Fast_Copy(), which offloads
+   the large copies to the MDMA with MEM_FAST_USE_DMA. Override in main.h. */
+#if !defined(DMA_BOUNCE_USE_MEM_FAST)
+#define DMA_BOUNCE_USE_MEM_FAST   1U
+#endif
+
+/* Application buffers followed by DMA_Bounce_GetHot(). Override in main.h. */
+#if !defined(DMA_BOUNCE_HOT_SIZE)
+#define DMA_BOUNCE_HOT_SIZE       8U
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t  Transfers;     /* Buffers staged                                */
+  uint32_t  Bytes;         /* Bytes staged                                  */
+  uint32_t  Failures;      /* Buffers not staged, pools exhausted           */
+  uint32_t  MaxSize;       /* Largest buffer staged, in bytes               */
+} DMA_Bounce_StatsTypeDef;
+
+typedef struct
+{
+  uint32_t  Address;       /* Application buffer                            */
+  uint32_t  Master;        /* DMA stream, BDMA channel or SDMMC instance    */
+  uint32_t  Count;         /* Times staged                                  */
+  uint32_t  Bytes;         /* Bytes staged                                  */
+} DMA_Bounce_HotTypeDef;
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+void     DMA_Bounce_GetStats(DMA_Bounce_StatsTypeDef *pStats);
+uint32_t DMA_Bounce_GetHot(DMA_Bounce_HotTypeDef *pHot, uint32_t MaxCount);
+void     DMA_Bounce_ResetStats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _DMA_BOUNCE_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
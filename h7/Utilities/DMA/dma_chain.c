@@ -0,0 +1,444 @@
+/**
+  ******************************************************************************
+  * @file    dma_chain.c
+  * @author  MCD Application Team
+  * @brief   DMAMUX trigger chains between DMA streams
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- initialize every DMA stream of the pipeline with HAL_DMA_Init(), in
+   circular mode for a pipeline that keeps running. A stage driven by a
+   DMAMUX request generator uses DMA_REQUEST_GENERATORx (DMA1/DMA2) or
+   BDMA_REQUEST_GENERATORx (BDMA) as Request.
+
+2- describe the pipeline as an array of DMA_Chain_StageTypeDef. A stage
+   is started by :
+   - its peripheral requests as they come (DMA_CHAIN_TRIGGER_NONE),
+   - its peripheral requests let through Requests at a time on each
+     trigger event (DMA_CHAIN_TRIGGER_SYNC),
+   - Requests requests made by the DMAMUX on each trigger event
+     (DMA_CHAIN_TRIGGER_GENERATOR).
+   The trigger event is Signal (timer TRGO, EXTI, LPTIM output...) when
+   Source is DMA_CHAIN_EXTERNAL, or the event raised by stage Source every
+   Requests of its own requests. For instance TIM12 TRGO -> ADC3 samples
+   to memory -> memory to DAC:
+      { &hdma_adc3, ..., DMA_CHAIN_TRIGGER_SYNC, DMA_CHAIN_EXTERNAL,
+        HAL_DMAMUX1_SYNC_TIM12_TRGO, HAL_DMAMUX_SYNC_RISING, 1 },
+      { &hdma_dac,  ..., DMA_CHAIN_TRIGGER_GENERATOR, 0,
+        0, HAL_DMAMUX_REQ_GEN_RISING, 1 }
+
+3- call DMA_Chain_Init(). The routing is checked against the DMAMUX of
+   the device before anything is written: a stage and its source must sit
+   on the same DMAMUX (DMA1/DMA2 on DMAMUX1, BDMA on DMAMUX2), and only the
+   first DMAMUX channels have their event wired to the trigger inputs
+   (DMA1 Stream0-2 on DMAMUX1, BDMA Channel0-5 for synchronization and
+   0-6 for request generators on DMAMUX2). On error the chain ErrorStage
+   and ErrorCode fields tell which stage was refused and why.
+
+4- call DMA_Chain_Start(): the triggered stages are armed first, then the
+   free-running stages and the external request generators are started.
+   Once running, no interrupt is involved between two stages. Use the
+   HAL DMA callbacks on the last stage for completion, and
+   DMA_Chain_GetOverruns() to check that no trigger event was lost.
+
+5- call DMA_Chain_Stop() to abort every stage and disable the request
+   generators.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "dma_chain.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* DMAMUX channels whose event is wired to the synchronization inputs and to
+   the request generator inputs, with the same signal number as the channel */
+#define DMA_CHAIN_DMAMUX1_SYNC_EVENTS   3U
+#define DMA_CHAIN_DMAMUX1_GEN_EVENTS    3U
+#define DMA_CHAIN_DMAMUX2_SYNC_EVENTS   6U
+#define DMA_CHAIN_DMAMUX2_GEN_EVENTS    7U
+
+#define DMA_CHAIN_GENERATORS            8U
+
+/* Private macro -------------------------------------------------------------*/
+#define DMA_CHAIN_IS_DMAMUX2(__HDMA__)  (IS_D2_DMA_INSTANCE(__HDMA__) == 0U)
+
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t DMA_Chain_MuxChannel(const DMA_HandleTypeDef *hdma);
+static uint32_t DMA_Chain_Check(DMA_ChainTypeDef *pChain, uint32_t Stage);
+static HAL_StatusTypeDef DMA_Chain_StartStage(const DMA_Chain_StageTypeDef *pStage);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Check and program the DMAMUX routing of a DMA chain
+  * @param  pChain: chain handle
+  * @param  pStages: stage array, kept by the chain until DMA_Chain_Stop()
+  * @param  Count: number of stages, up to DMA_CHAIN_MAX_STAGES
+  * @retval HAL_OK, HAL_ERROR with pChain->ErrorStage and ErrorCode set
+  */
+HAL_StatusTypeDef DMA_Chain_Init(DMA_ChainTypeDef *pChain, const DMA_Chain_StageTypeDef *pStages, uint32_t Count)
+{
+  HAL_DMA_MuxSyncConfigTypeDef             sync;
+  HAL_DMA_MuxRequestGeneratorConfigTypeDef generator;
+  const DMA_Chain_StageTypeDef             *stage;
+  uint32_t                                 i;
+  uint32_t                                 error;
+  uint32_t                                 signal;
+
+  if((pChain == NULL) || (pStages == NULL) || (Count == 0U) || (Count > DMA_CHAIN_MAX_STAGES))
+  {
+    return HAL_ERROR;
+  }
+
+  pChain->pStages    = pStages;
+  pChain->Count      = Count;
+  pChain->Events     = 0U;
+  pChain->ErrorStage = 0U;
+  pChain->ErrorCode  = DMA_CHAIN_ERROR_NONE;
+
+  /* Check the whole graph before touching the DMAMUX */
+  for(i = 0U; i < Count; i++)
+  {
+    error = DMA_Chain_Check(pChain, i);
+    if(error != DMA_CHAIN_ERROR_NONE)
+    {
+      pChain->ErrorStage = i;
+      pChain->ErrorCode  = error;
+      return HAL_ERROR;
+    }
+  }
+
+  for(i = 0U; i < Count; i++)
+  {
+    stage = &pStages[i];
+
+    /* The event of a source stage has the number of its DMAMUX channel */
+    if((stage->Trigger == DMA_CHAIN_TRIGGER_NONE) || (stage->Source == DMA_CHAIN_EXTERNAL))
+    {
+      signal = stage->Signal;
+    }
+    else
+    {
+      signal = DMA_Chain_MuxChannel(pStages[stage->Source].hdma);
+    }
+
+    /* Channel synchronization and event output. A source stage raises its
+       event every Requests requests, which also sets how many requests a
+       synchronized stage lets through per trigger. */
+    sync.SyncSignalID  = (stage->Trigger == DMA_CHAIN_TRIGGER_SYNC) ? signal : 0U;
+    sync.SyncPolarity  = (stage->Trigger == DMA_CHAIN_TRIGGER_SYNC) ? stage->Polarity : HAL_DMAMUX_SYNC_NO_EVENT;
+    sync.SyncEnable    = (stage->Trigger == DMA_CHAIN_TRIGGER_SYNC) ? ENABLE : DISABLE;
+    sync.EventEnable   = ((pChain->Events & (1UL << i)) != 0U) ? ENABLE : DISABLE;
+    sync.RequestNumber = stage->Requests;
+    if(HAL_DMAEx_ConfigMuxSync(stage->hdma, &sync) != HAL_OK)
+    {
+      pChain->ErrorStage = i;
+      pChain->ErrorCode  = DMA_CHAIN_ERROR_CONFIG;
+      return HAL_ERROR;
+    }
+
+    if(stage->Trigger == DMA_CHAIN_TRIGGER_GENERATOR)
+    {
+      generator.SignalID      = signal;
+      generator.Polarity      = stage->Polarity;
+      generator.RequestNumber = stage->Requests;
+      if(HAL_DMAEx_ConfigMuxRequestGenerator(stage->hdma, &generator) != HAL_OK)
+      {
+        pChain->ErrorStage = i;
+        pChain->ErrorCode  = DMA_CHAIN_ERROR_CONFIG;
+        return HAL_ERROR;
+      }
+    }
+  }
+
+  /* Start from clean overrun flags */
+  (void)DMA_Chain_GetOverruns(pChain);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Start every stage of a DMA chain
+  * @note   Stages triggered by another stage are armed before their source
+  *         so that no event is lost, external triggers are enabled last.
+  * @param  pChain: chain handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef DMA_Chain_Start(DMA_ChainTypeDef *pChain)
+{
+  const DMA_Chain_StageTypeDef *stage;
+  uint32_t                     pass;
+  uint32_t                     i;
+  uint32_t                     internal;
+
+  if((pChain == NULL) || (pChain->pStages == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Pass 0: stages triggered by another stage,
+     pass 1: stages waiting for an external trigger or free-running */
+  for(pass = 0U; pass < 2U; pass++)
+  {
+    for(i = 0U; i < pChain->Count; i++)
+    {
+      stage    = &pChain->pStages[i];
+      internal = ((stage->Trigger != DMA_CHAIN_TRIGGER_NONE) && (stage->Source != DMA_CHAIN_EXTERNAL)) ? 1U : 0U;
+
+      if(internal == (1U - pass))
+      {
+        if(DMA_Chain_StartStage(stage) != HAL_OK)
+        {
+          (void)DMA_Chain_Stop(pChain);
+          pChain->ErrorStage = i;
+          pChain->ErrorCode  = DMA_CHAIN_ERROR_CONFIG;
+          return HAL_ERROR;
+        }
+      }
+    }
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop every stage of a DMA chain
+  * @param  pChain: chain handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef DMA_Chain_Stop(DMA_ChainTypeDef *pChain)
+{
+  const DMA_Chain_StageTypeDef *stage;
+  uint32_t                     i;
+
+  if((pChain == NULL) || (pChain->pStages == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Cut the external triggers first, then the stages in order */
+  for(i = 0U; i < pChain->Count; i++)
+  {
+    stage = &pChain->pStages[i];
+    if(stage->Trigger == DMA_CHAIN_TRIGGER_GENERATOR)
+    {
+      (void)HAL_DMAEx_DisableMuxRequestGenerator(stage->hdma);
+    }
+  }
+
+  for(i = 0U; i < pChain->Count; i++)
+  {
+    stage = &pChain->pStages[i];
+    if(stage->hdma->State == HAL_DMA_STATE_BUSY)
+    {
+      (void)HAL_DMA_Abort(stage->hdma);
+    }
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Read and clear the DMAMUX overrun flags of a DMA chain
+  * @note   A synchronization overrun means a trigger event came before the
+  *         Requests requests of the previous one were served, a request
+  *         generator overrun that an event came while requests were still
+  *         pending: the pipeline runs faster than a stage can follow.
+  * @param  pChain: chain handle
+  * @retval One bit per stage that overran since the last call
+  */
+uint32_t DMA_Chain_GetOverruns(DMA_ChainTypeDef *pChain)
+{
+  const DMA_Chain_StageTypeDef *stage;
+  DMA_HandleTypeDef            *hdma;
+  uint32_t                     overruns = 0U;
+  uint32_t                     i;
+
+  if((pChain == NULL) || (pChain->pStages == NULL))
+  {
+    return 0U;
+  }
+
+  for(i = 0U; i < pChain->Count; i++)
+  {
+    stage = &pChain->pStages[i];
+    hdma  = stage->hdma;
+
+    if((hdma->DMAmuxChannelStatus->CSR & hdma->DMAmuxChannelStatusMask) != 0U)
+    {
+      hdma->DMAmuxChannelStatus->CFR = hdma->DMAmuxChannelStatusMask;
+      overruns |= (1UL << i);
+    }
+
+    if((stage->Trigger == DMA_CHAIN_TRIGGER_GENERATOR) && (hdma->DMAmuxRequestGen != NULL))
+    {
+      if((hdma->DMAmuxRequestGenStatus->RGSR & hdma->DMAmuxRequestGenStatusMask) != 0U)
+      {
+        hdma->DMAmuxRequestGenStatus->RGCFR = hdma->DMAmuxRequestGenStatusMask;
+        overruns |= (1UL << i);
+      }
+    }
+  }
+
+  return overruns;
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  DMAMUX channel of a DMA stream
+  * @param  hdma: DMA handle
+  * @retval Channel number in its DMAMUX
+  */
+static uint32_t DMA_Chain_MuxChannel(const DMA_HandleTypeDef *hdma)
+{
+  uint32_t base = DMA_CHAIN_IS_DMAMUX2(hdma) ? (uint32_t)DMAMUX2_Channel0 : (uint32_t)DMAMUX1_Channel0;
+
+  return ((uint32_t)hdma->DMAmuxChannel - base) / ((uint32_t)DMAMUX1_Channel1 - (uint32_t)DMAMUX1_Channel0);
+}
+
+/**
+  * @brief  Check one stage of a chain, and mark its source as raising events
+  * @param  pChain: chain handle
+  * @param  Stage: stage index
+  * @retval DMA_CHAIN_ERROR_xxx
+  */
+static uint32_t DMA_Chain_Check(DMA_ChainTypeDef *pChain, uint32_t Stage)
+{
+  const DMA_Chain_StageTypeDef *stage = &pChain->pStages[Stage];
+  const DMA_Chain_StageTypeDef *source;
+  uint32_t                     dmamux2;
+  uint32_t                     channel;
+  uint32_t                     events;
+  uint32_t                     i;
+
+  if((stage->hdma == NULL) || (stage->hdma->DMAmuxChannel == NULL) ||
+     (stage->Trigger > DMA_CHAIN_TRIGGER_GENERATOR) ||
+     (stage->Requests == 0U) || (stage->Requests > 32U))
+  {
+    return DMA_CHAIN_ERROR_PARAM;
+  }
+
+  dmamux2 = DMA_CHAIN_IS_DMAMUX2(stage->hdma) ? 1U : 0U;
+
+  for(i = 0U; i < Stage; i++)
+  {
+    if(pChain->pStages[i].hdma->Instance == stage->hdma->Instance)
+    {
+      return DMA_CHAIN_ERROR_STREAM;
+    }
+
+    /* Each request generator drives a single stream */
+    if((stage->Trigger == DMA_CHAIN_TRIGGER_GENERATOR) &&
+       (pChain->pStages[i].Trigger == DMA_CHAIN_TRIGGER_GENERATOR) &&
+       (pChain->pStages[i].hdma->DMAmuxRequestGen == stage->hdma->DMAmuxRequestGen))
+    {
+      return DMA_CHAIN_ERROR_GENERATOR;
+    }
+  }
+
+  if(stage->Trigger == DMA_CHAIN_TRIGGER_GENERATOR)
+  {
+    if((stage->hdma->Init.Request < 1U) || (stage->hdma->Init.Request > DMA_CHAIN_GENERATORS) ||
+       (stage->hdma->DMAmuxRequestGen == NULL))
+    {
+      return DMA_CHAIN_ERROR_GENERATOR;
+    }
+  }
+
+  if((stage->Trigger == DMA_CHAIN_TRIGGER_NONE) || (stage->Source == DMA_CHAIN_EXTERNAL))
+  {
+    return DMA_CHAIN_ERROR_NONE;
+  }
+
+  if((stage->Source >= pChain->Count) || (stage->Source == Stage))
+  {
+    return DMA_CHAIN_ERROR_SOURCE;
+  }
+
+  source = &pChain->pStages[stage->Source];
+  if((source->hdma == NULL) || (source->hdma->DMAmuxChannel == NULL))
+  {
+    return DMA_CHAIN_ERROR_SOURCE;
+  }
+
+  /* Events do not cross from one DMAMUX to the other */
+  if((DMA_CHAIN_IS_DMAMUX2(source->hdma) ? 1U : 0U) != dmamux2)
+  {
+    return DMA_CHAIN_ERROR_DOMAIN;
+  }
+
+  /* Only the first channels of each DMAMUX have their event routed */
+  channel = DMA_Chain_MuxChannel(source->hdma);
+  if(stage->Trigger == DMA_CHAIN_TRIGGER_SYNC)
+  {
+    events = (dmamux2 != 0U) ? DMA_CHAIN_DMAMUX2_SYNC_EVENTS : DMA_CHAIN_DMAMUX1_SYNC_EVENTS;
+  }
+  else
+  {
+    events = (dmamux2 != 0U) ? DMA_CHAIN_DMAMUX2_GEN_EVENTS : DMA_CHAIN_DMAMUX1_GEN_EVENTS;
+  }
+  if(channel >= events)
+  {
+    return DMA_CHAIN_ERROR_EVENT;
+  }
+
+  pChain->Events |= (1UL << stage->Source);
+
+  return DMA_CHAIN_ERROR_NONE;
+}
+
+/**
+  * @brief  Start the stream of one stage, and its request generator
+  * @param  pStage: stage
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef DMA_Chain_StartStage(const DMA_Chain_StageTypeDef *pStage)
+{
+  if(HAL_DMA_Start(pStage->hdma, pStage->SrcAddress, pStage->DstAddress, pStage->Length) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  if(pStage->Trigger == DMA_CHAIN_TRIGGER_GENERATOR)
+  {
+    return HAL_DMAEx_EnableMuxRequestGenerator(pStage->hdma);
+  }
+
+  return HAL_OK;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
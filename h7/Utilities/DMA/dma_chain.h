@@ -0,0 +1,114 @@
+/**
+  ******************************************************************************
+  * @file    dma_chain.h
+  * @author  MCD Application Team
+  * @brief   Header for dma_chain module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _DMA_CHAIN_H__
+#define _DMA_CHAIN_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#if !defined(HAL_DMA_MODULE_ENABLED)
+#error "dma_chain requires the HAL DMA driver"
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+/* One DMA stream of the chain and what starts its requests */
+typedef struct
+{
+  DMA_HandleTypeDef   *hdma;          /* HAL_DMA_Init() done. Request: the peripheral request,
+                                         or DMA_REQUEST_GENERATORx (BDMA_REQUEST_GENERATORx)
+                                         with DMA_CHAIN_TRIGGER_GENERATOR                     */
+  uint32_t            SrcAddress;
+  uint32_t            DstAddress;
+  uint32_t            Length;         /* Data items, restarted by the DMA in circular mode   */
+  uint32_t            Trigger;        /* DMA_CHAIN_TRIGGER_xxx                               */
+  uint32_t            Source;         /* Index of the stage whose DMAMUX event triggers this
+                                         one, DMA_CHAIN_EXTERNAL: Signal                     */
+  uint32_t            Signal;         /* External HAL_DMAMUXx_SYNC_xxx or HAL_DMAMUXx_REQ_GEN_xxx */
+  uint32_t            Polarity;       /* HAL_DMAMUX_SYNC_xxx or HAL_DMAMUX_REQ_GEN_xxx edge   */
+  uint32_t            Requests;       /* DMA requests let through (sync) or made (generator)
+                                         per trigger event, and between two events raised by
+                                         this stage for the stages it triggers, 1 to 32      */
+} DMA_Chain_StageTypeDef;
+
+typedef struct
+{
+  const DMA_Chain_StageTypeDef *pStages;
+  uint32_t            Count;
+  uint32_t            Events;         /* Stages raising a DMAMUX event, one bit per stage    */
+  uint32_t            ErrorStage;     /* Stage refused by DMA_Chain_Init()                   */
+  uint32_t            ErrorCode;      /* DMA_CHAIN_ERROR_xxx                                 */
+} DMA_ChainTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+#define DMA_CHAIN_TRIGGER_NONE       0U   /* Peripheral requests go through as they come     */
+#define DMA_CHAIN_TRIGGER_SYNC       1U   /* Peripheral requests gated by the trigger event   */
+#define DMA_CHAIN_TRIGGER_GENERATOR  2U   /* Requests made by the DMAMUX on the trigger event */
+
+#define DMA_CHAIN_EXTERNAL           0xFFFFFFFFU
+
+#define DMA_CHAIN_ERROR_NONE         0U
+#define DMA_CHAIN_ERROR_PARAM        1U   /* Missing handle, bad trigger or request count    */
+#define DMA_CHAIN_ERROR_STREAM       2U   /* Stream used by two stages                       */
+#define DMA_CHAIN_ERROR_SOURCE       3U   /* Source stage out of range or the stage itself   */
+#define DMA_CHAIN_ERROR_DOMAIN       4U   /* Source stage on the other DMAMUX                */
+#define DMA_CHAIN_ERROR_EVENT        5U   /* Source stage DMAMUX channel has no event routed
+                                             to this trigger input                           */
+#define DMA_CHAIN_ERROR_GENERATOR    6U   /* Request not a generator, or generator used twice */
+#define DMA_CHAIN_ERROR_CONFIG       7U   /* HAL DMAMUX configuration failed                 */
+
+/* Stages in a chain */
+#define DMA_CHAIN_MAX_STAGES         16U
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef DMA_Chain_Init(DMA_ChainTypeDef *pChain, const DMA_Chain_StageTypeDef *pStages, uint32_t Count);
+HAL_StatusTypeDef DMA_Chain_Start(DMA_ChainTypeDef *pChain);
+HAL_StatusTypeDef DMA_Chain_Stop(DMA_ChainTypeDef *pChain);
+uint32_t          DMA_Chain_GetOverruns(DMA_ChainTypeDef *pChain);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _DMA_CHAIN_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,269 @@
+/**
+  ******************************************************************************
+  * @file    dma_pool.c
+  * @author  MCD Application Team
+  * @brief   Cache-line aligned DMA buffer pools
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- in the linker script place the pool sections in their memory region :
+      .dma_dtcm (NOLOAD) : { KEEP(*(.dma_dtcm)) } >DTCMRAM
+      .dma_d1   (NOLOAD) : { KEEP(*(.dma_d1))   } >RAM_D1
+      .dma_d2   (NOLOAD) : { KEEP(*(.dma_d2))   } >RAM_D2
+      .dma_d3   (NOLOAD) : { KEEP(*(.dma_d3))   } >RAM_D3
+
+2- size each pool in main.h with DMA_POOL_xxx_SIZE (0 removes the pool)
+
+3- get buffers with DMA_Pool_Alloc() and give them back with DMA_Pool_Free().
+   Each buffer starts on a D-cache line and is rounded up to a whole number
+   of lines, so cleaning or invalidating it never touches a neighbour.
+   With USE_HAL_DMA_CACHE_MAINTENANCE set to 1 in stm32h7xx_hal_conf.h the
+   HAL DMA driver then performs the cache maintenance of the exact transfer
+   range by itself.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "dma_pool.h"
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  uint8_t  *pArena;      /* First block of the pool                     */
+  uint32_t BlockCount;   /* Number of blocks in the pool                */
+  uint32_t *pUsed;       /* One bit per block, set when allocated       */
+  uint32_t *pHead;       /* One bit per block, set on first allocated   */
+} DMA_PoolTypeDef;
+
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+#define DMA_POOL_BLOCKS(__SIZE__)  (DMA_POOL_ROUND_SIZE(__SIZE__) / DMA_POOL_BLOCK_SIZE)
+#define DMA_POOL_WORDS(__SIZE__)   ((DMA_POOL_BLOCKS(__SIZE__) + 31U) / 32U)
+
+#define DMA_POOL_TEST(__MAP__, __BLK__)   (((__MAP__)[(__BLK__) >> 5U] & (1UL << ((__BLK__) & 31U))) != 0U)
+#define DMA_POOL_SET(__MAP__, __BLK__)    ((__MAP__)[(__BLK__) >> 5U] |= (1UL << ((__BLK__) & 31U)))
+#define DMA_POOL_CLEAR(__MAP__, __BLK__)  ((__MAP__)[(__BLK__) >> 5U] &= ~(1UL << ((__BLK__) & 31U)))
+
+/* Private function prototypes -----------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+#if (DMA_POOL_DTCM_SIZE > 0U)
+static uint8_t  PoolDtcm[DMA_POOL_ROUND_SIZE(DMA_POOL_DTCM_SIZE)] __attribute__((section(".dma_dtcm"), aligned(32)));
+static uint32_t PoolDtcmUsed[DMA_POOL_WORDS(DMA_POOL_DTCM_SIZE)];
+static uint32_t PoolDtcmHead[DMA_POOL_WORDS(DMA_POOL_DTCM_SIZE)];
+#endif
+#if (DMA_POOL_RAM_D1_SIZE > 0U)
+static uint8_t  PoolRamD1[DMA_POOL_ROUND_SIZE(DMA_POOL_RAM_D1_SIZE)] __attribute__((section(".dma_d1"), aligned(32)));
+static uint32_t PoolRamD1Used[DMA_POOL_WORDS(DMA_POOL_RAM_D1_SIZE)];
+static uint32_t PoolRamD1Head[DMA_POOL_WORDS(DMA_POOL_RAM_D1_SIZE)];
+#endif
+#if (DMA_POOL_RAM_D2_SIZE > 0U)
+static uint8_t  PoolRamD2[DMA_POOL_ROUND_SIZE(DMA_POOL_RAM_D2_SIZE)] __attribute__((section(".dma_d2"), aligned(32)));
+static uint32_t PoolRamD2Used[DMA_POOL_WORDS(DMA_POOL_RAM_D2_SIZE)];
+static uint32_t PoolRamD2Head[DMA_POOL_WORDS(DMA_POOL_RAM_D2_SIZE)];
+#endif
+#if (DMA_POOL_RAM_D3_SIZE > 0U)
+static uint8_t  PoolRamD3[DMA_POOL_ROUND_SIZE(DMA_POOL_RAM_D3_SIZE)] __attribute__((section(".dma_d3"), aligned(32)));
+static uint32_t PoolRamD3Used[DMA_POOL_WORDS(DMA_POOL_RAM_D3_SIZE)];
+static uint32_t PoolRamD3Head[DMA_POOL_WORDS(DMA_POOL_RAM_D3_SIZE)];
+#endif
+
+static DMA_PoolTypeDef DMA_Pools[DMA_POOL_REGION_COUNT] =
+{
+#if (DMA_POOL_DTCM_SIZE > 0U)
+  { PoolDtcm, DMA_POOL_BLOCKS(DMA_POOL_DTCM_SIZE), PoolDtcmUsed, PoolDtcmHead },
+#else
+  { NULL, 0U, NULL, NULL },
+#endif
+#if (DMA_POOL_RAM_D1_SIZE > 0U)
+  { PoolRamD1, DMA_POOL_BLOCKS(DMA_POOL_RAM_D1_SIZE), PoolRamD1Used, PoolRamD1Head },
+#else
+  { NULL, 0U, NULL, NULL },
+#endif
+#if (DMA_POOL_RAM_D2_SIZE > 0U)
+  { PoolRamD2, DMA_POOL_BLOCKS(DMA_POOL_RAM_D2_SIZE), PoolRamD2Used, PoolRamD2Head },
+#else
+  { NULL, 0U, NULL, NULL },
+#endif
+#if (DMA_POOL_RAM_D3_SIZE > 0U)
+  { PoolRamD3, DMA_POOL_BLOCKS(DMA_POOL_RAM_D3_SIZE), PoolRamD3Used, PoolRamD3Head },
+#else
+  { NULL, 0U, NULL, NULL },
+#endif
+};
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Release every buffer of every pool
+  * @param  None
+  * @retval None
+  */
+void DMA_Pool_Init(void)
+{
+  uint32_t region;
+  uint32_t word;
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  for(region = 0U; region < (uint32_t)DMA_POOL_REGION_COUNT; region++)
+  {
+    for(word = 0U; word < ((DMA_Pools[region].BlockCount + 31U) / 32U); word++)
+    {
+      DMA_Pools[region].pUsed[word] = 0U;
+      DMA_Pools[region].pHead[word] = 0U;
+    }
+  }
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Allocate a cache-line aligned buffer from a pool
+  * @param  Region: pool to allocate from
+  * @param  Size: requested size in bytes, rounded up to DMA_POOL_BLOCK_SIZE
+  * @retval Buffer address, NULL when the pool has no free range large enough
+  */
+void *DMA_Pool_Alloc(DMA_PoolRegionTypeDef Region, uint32_t Size)
+{
+  DMA_PoolTypeDef *pool;
+  uint32_t count;
+  uint32_t run = 0U;
+  uint32_t blk;
+  uint32_t first;
+  uint32_t primask;
+  void *pBuffer = NULL;
+
+  if((Region >= DMA_POOL_REGION_COUNT) || (Size == 0U))
+  {
+    return NULL;
+  }
+
+  pool = &DMA_Pools[Region];
+  count = DMA_POOL_ROUND_SIZE(Size) / DMA_POOL_BLOCK_SIZE;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  /* First fit: look for count consecutive free blocks */
+  for(blk = 0U; blk < pool->BlockCount; blk++)
+  {
+    if(DMA_POOL_TEST(pool->pUsed, blk))
+    {
+      run = 0U;
+    }
+    else if(++run == count)
+    {
+      first = blk + 1U - count;
+      DMA_POOL_SET(pool->pHead, first);
+      for(blk = first; blk < (first + count); blk++)
+      {
+        DMA_POOL_SET(pool->pUsed, blk);
+      }
+      pBuffer = &pool->pArena[first * DMA_POOL_BLOCK_SIZE];
+      break;
+    }
+  }
+
+  __set_PRIMASK(primask);
+
+  return pBuffer;
+}
+
+/**
+  * @brief  Give a buffer back to the pool it was allocated from
+  * @param  pBuffer: address returned by DMA_Pool_Alloc()
+  * @retval None
+  */
+void DMA_Pool_Free(void *pBuffer)
+{
+  DMA_PoolTypeDef *pool;
+  uint32_t region;
+  uint32_t blk;
+  uint32_t primask;
+  uint32_t addr = (uint32_t)pBuffer;
+
+  for(region = 0U; region < (uint32_t)DMA_POOL_REGION_COUNT; region++)
+  {
+    pool = &DMA_Pools[region];
+
+    if((pool->BlockCount != 0U) && (addr >= (uint32_t)pool->pArena) &&
+       (addr < ((uint32_t)pool->pArena + (pool->BlockCount * DMA_POOL_BLOCK_SIZE))))
+    {
+      blk = (addr - (uint32_t)pool->pArena) / DMA_POOL_BLOCK_SIZE;
+
+      primask = __get_PRIMASK();
+      __disable_irq();
+
+      /* Only the first block of an allocation can be freed */
+      if(DMA_POOL_TEST(pool->pHead, blk))
+      {
+        DMA_POOL_CLEAR(pool->pHead, blk);
+        do
+        {
+          DMA_POOL_CLEAR(pool->pUsed, blk);
+          blk++;
+        } while((blk < pool->BlockCount) && DMA_POOL_TEST(pool->pUsed, blk) && !DMA_POOL_TEST(pool->pHead, blk));
+      }
+
+      __set_PRIMASK(primask);
+      return;
+    }
+  }
+}
+
+/**
+  * @brief  Return the number of free bytes of a pool
+  * @param  Region: pool to inspect
+  * @retval Free bytes, not necessarily contiguous
+  */
+uint32_t DMA_Pool_GetFreeSize(DMA_PoolRegionTypeDef Region)
+{
+  uint32_t blk;
+  uint32_t count = 0U;
+
+  if(Region >= DMA_POOL_REGION_COUNT)
+  {
+    return 0U;
+  }
+
+  for(blk = 0U; blk < DMA_Pools[Region].BlockCount; blk++)
+  {
+    if(!DMA_POOL_TEST(DMA_Pools[Region].pUsed, blk))
+    {
+      count++;
+    }
+  }
+
+  return count * DMA_POOL_BLOCK_SIZE;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,92 @@
+/**
+  ******************************************************************************
+  * @file    dma_pool.h
+  * @author  MCD Application Team
+  * @brief   Header for dma_pool module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _DMA_POOL_H__
+#define _DMA_POOL_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+  DMA_POOL_DTCM   = 0U,  /* DTCM RAM, not cached, reachable by MDMA only */
+  DMA_POOL_RAM_D1 = 1U,  /* AXI SRAM (D1 domain)                        */
+  DMA_POOL_RAM_D2 = 2U,  /* SRAM1/2/3 (D2 domain), reachable by DMA1/2   */
+  DMA_POOL_RAM_D3 = 3U,  /* SRAM4 (D3 domain), reachable by BDMA        */
+  DMA_POOL_REGION_COUNT
+} DMA_PoolRegionTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Size of one pool block: one Cortex-M7 D-cache line */
+#define DMA_POOL_BLOCK_SIZE   32U
+
+/* Size in bytes of each pool; 0 removes the pool. Override in main.h. */
+#if !defined(DMA_POOL_DTCM_SIZE)
+#define DMA_POOL_DTCM_SIZE    0U
+#endif
+#if !defined(DMA_POOL_RAM_D1_SIZE)
+#define DMA_POOL_RAM_D1_SIZE  0x4000U
+#endif
+#if !defined(DMA_POOL_RAM_D2_SIZE)
+#define DMA_POOL_RAM_D2_SIZE  0x4000U
+#endif
+#if !defined(DMA_POOL_RAM_D3_SIZE)
+#define DMA_POOL_RAM_D3_SIZE  0x1000U
+#endif
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+#define DMA_POOL_ROUND_SIZE(__SIZE__) \
+  (((__SIZE__) + DMA_POOL_BLOCK_SIZE - 1U) & ~(DMA_POOL_BLOCK_SIZE - 1U))
+
+/* Exported functions ------------------------------------------------------- */
+void     DMA_Pool_Init(void);
+void    *DMA_Pool_Alloc(DMA_PoolRegionTypeDef Region, uint32_t Size);
+void     DMA_Pool_Free(void *pBuffer);
+uint32_t DMA_Pool_GetFreeSize(DMA_PoolRegionTypeDef Region);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _DMA_POOL_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,929 @@
+/**
+  ******************************************************************************
+  * @file    asset_cache.c
+  * @author  MCD Application Team
+  * @brief   Decoded glyphs and images of an asset pack kept in SDRAM, keyed by
+  *          code, evicted least recently used first, read from the SD card or
+  *          the QSPI flash through aio_queue.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- open the pack directory with ASSET_Init():
+     - pack memory-mapped (QSPI in memory-mapped mode, internal flash): with
+       the pack address, the strips are decoded in place.
+     - pack on the SD card or in the QSPI flash in indirect mode: with a copy
+       in RAM of its first sizeof(ASSET_HeaderTypeDef) + Count *
+       sizeof(ASSET_EntryTypeDef) bytes, the strips are read through
+       aio_queue (AIO_QUEUE_USE_SD or AIO_QUEUE_USE_QSPI), the device being
+       given in Init.pDev with the pack location in Init.Address.
+
+2- add the SDRAM to the tlsf_heap, then fill Init: MaxSize bounds the bytes
+   of decoded assets kept, Attributes selects their heap region (SDRAM:
+   TLSF_ATTR_EXTERNAL), ReadAttributes the one of the read buffers, reached
+   by the SDMMC or the QSPI DMA (TLSF_ATTR_DMA). Call ASSET_Cache_Init().
+
+3- ASSET_Cache_Prefetch() queues the assets of the next screens. Call
+   ASSET_Cache_Process() from the UI task, once per frame for instance: it
+   takes the completed reads and decodes their assets, starts the next
+   reads, up to ASSET_CACHE_LOADS at once, and for a memory-mapped pack
+   decodes up to ASSET_CACHE_DECODES queued assets.
+
+4- ASSET_Cache_Draw() and ASSET_Cache_DrawString() draw decoded assets in
+   one DMA2D transfer each, without reading the pack. An asset not decoded
+   yet is queued: it is decoded at once for a memory-mapped pack, otherwise
+   not drawn and HAL_BUSY is returned, draw the screen again once it is
+   loaded. ASSET_Cache_Get() gives the decoded lines of an asset for other
+   uses, valid until the next call that decodes an asset.
+
+Assets are decoded into the DMA2D input format of the pack, but A4 assets
+whose strips hold an odd number of pixels are expanded to A8, the lines of
+the strips being contiguous once decoded. When MaxSize or the heap is
+reached, the least recently drawn assets are dropped. The module is used by
+one task, the DMA2D as in asset_pack.
+*******************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include "asset_cache.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define ASSET_CACHE_LINE         32U
+#define ASSET_REPLACEMENT_CHAR   0xFFFDU
+
+/* Private macro -------------------------------------------------------------*/
+#define ASSET_CACHE_ALIGN(__SIZE__)  (((__SIZE__) + (ASSET_CACHE_LINE - 1U)) & ~(ASSET_CACHE_LINE - 1U))
+
+/* Private variables ---------------------------------------------------------*/
+/* A4 strip decoded before its expansion to A8 */
+static uint8_t AssetCacheStrip[ASSET_STRIP_SIZE];
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t Cache_Hash(uint32_t Code);
+static uint32_t Cache_Find(const ASSET_Cache_TypeDef *pCache, uint32_t Code);
+static uint32_t Cache_Lookup(ASSET_Cache_TypeDef *pCache, uint32_t Code, HAL_StatusTypeDef *pStatus);
+static uint32_t Cache_NewSlot(ASSET_Cache_TypeDef *pCache, uint32_t Code, const ASSET_EntryTypeDef *pEntry);
+static void     Cache_Release(ASSET_Cache_TypeDef *pCache, uint32_t Slot);
+static void     Cache_Evict(ASSET_Cache_TypeDef *pCache, uint32_t Slot);
+static void     Cache_Unlink(ASSET_Cache_TypeDef *pCache, uint32_t Slot);
+static void     Cache_PushHead(ASSET_Cache_TypeDef *pCache, uint32_t Slot);
+static void     Cache_Dequeue(ASSET_Cache_TypeDef *pCache, uint32_t Slot);
+static void     *Cache_Alloc(ASSET_Cache_TypeDef *pCache, uint32_t Size, uint32_t Attributes, uint32_t Counted);
+static void     Cache_Decode(ASSET_Cache_TypeDef *pCache, uint32_t Slot, const uint8_t *pStrips);
+#if (ASSET_CACHE_ASYNC == 1U)
+static uint32_t Cache_CheckTable(const ASSET_EntryTypeDef *pEntry, const uint32_t *pTable);
+static HAL_StatusTypeDef Cache_StartLoad(ASSET_Cache_TypeDef *pCache, ASSET_Cache_LoadTypeDef *pLoad,
+                                         uint32_t Start, uint32_t End);
+static void     Cache_LoadDone(ASSET_Cache_TypeDef *pCache, ASSET_Cache_LoadTypeDef *pLoad);
+#endif
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Initialize a cache
+  * @param  pCache: Cache, Init filled
+  * @retval HAL_OK, or HAL_ERROR on a wrong parameter
+  */
+HAL_StatusTypeDef ASSET_Cache_Init(ASSET_Cache_TypeDef *pCache)
+{
+  uint32_t i;
+
+  if((pCache == NULL) || (pCache->Init.pPack == NULL) || (pCache->Init.MaxSize == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  if(pCache->Init.pDev != NULL)
+  {
+#if (ASSET_CACHE_ASYNC == 1U)
+#if (AIO_QUEUE_USE_QSPI == 1U)
+    if((pCache->Init.pDev->Type == AIO_DEVICE_QSPI) && (pCache->Init.pReadCommand == NULL))
+    {
+      return HAL_ERROR;
+    }
+#endif
+    if(((pCache->Init.pDev->Type != AIO_DEVICE_SD) && (pCache->Init.pDev->Type != AIO_DEVICE_QSPI)) ||
+       (AIO_CQ_Init(&pCache->Cq) != HAL_OK))
+    {
+      return HAL_ERROR;
+    }
+    for(i = 0U; i < ASSET_CACHE_LOADS; i++)
+    {
+      pCache->Loads[i].Slot = ASSET_CACHE_NONE;
+    }
+#else
+    return HAL_ERROR;
+#endif
+  }
+
+  /* All the slots free */
+  for(i = 0U; i < ASSET_CACHE_SLOTS; i++)
+  {
+    pCache->Slots[i].State = ASSET_CACHE_FREE;
+    pCache->Slots[i].Next  = (uint16_t)(((i + 1U) < ASSET_CACHE_SLOTS) ? (i + 1U) : ASSET_CACHE_NONE);
+    pCache->Buckets[i]     = ASSET_CACHE_NONE;
+  }
+  pCache->Free       = 0U;
+  pCache->Head       = ASSET_CACHE_NONE;
+  pCache->Tail       = ASSET_CACHE_NONE;
+  pCache->QueueHead  = 0U;
+  pCache->QueueCount = 0U;
+  memset(&pCache->Stats, 0, sizeof(pCache->Stats));
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Release the decoded assets of a cache
+  * @param  pCache: Cache
+  * @retval HAL_OK, or HAL_BUSY while reads are in progress
+  */
+HAL_StatusTypeDef ASSET_Cache_DeInit(ASSET_Cache_TypeDef *pCache)
+{
+#if (ASSET_CACHE_ASYNC == 1U)
+  uint32_t i;
+
+  if(pCache->Init.pDev != NULL)
+  {
+    for(i = 0U; i < ASSET_CACHE_LOADS; i++)
+    {
+      if(pCache->Loads[i].Slot != ASSET_CACHE_NONE)
+      {
+        return HAL_BUSY;
+      }
+    }
+    (void)AIO_CQ_DeInit(&pCache->Cq);
+  }
+#endif
+
+  ASSET_Cache_Flush(pCache);
+  return HAL_OK;
+}
+
+/**
+  * @brief  Get a decoded asset, queue it if not decoded yet
+  * @note   A memory-mapped asset is decoded at once. The lines are valid
+  *         until the next call decoding an asset.
+  * @param  pCache: Cache
+  * @param  Code: Unicode code point of a glyph, or ASSET_IMAGE(Id)
+  * @retval Slot of the decoded asset, NULL if not in the pack or not
+  *         decoded yet
+  */
+const ASSET_Cache_SlotTypeDef *ASSET_Cache_Get(ASSET_Cache_TypeDef *pCache, uint32_t Code)
+{
+  HAL_StatusTypeDef status;
+  uint32_t slot = Cache_Lookup(pCache, Code, &status);
+
+  return (status == HAL_OK) ? &pCache->Slots[slot] : NULL;
+}
+
+/**
+  * @brief  Queue the decoding of an asset
+  * @param  pCache: Cache
+  * @param  Code: Unicode code point of a glyph, or ASSET_IMAGE(Id)
+  * @retval HAL_OK if queued or already there, HAL_ERROR if not in the pack,
+  *         HAL_BUSY if all the slots are queued or loading
+  */
+HAL_StatusTypeDef ASSET_Cache_Prefetch(ASSET_Cache_TypeDef *pCache, uint32_t Code)
+{
+  const ASSET_EntryTypeDef *pentry;
+  uint32_t slot;
+
+  if(Cache_Find(pCache, Code) != ASSET_CACHE_NONE)
+  {
+    return HAL_OK;
+  }
+
+  pentry = ASSET_Find(pCache->Init.pPack, Code);
+  if(pentry == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  slot = Cache_NewSlot(pCache, Code, pentry);
+  if(slot == ASSET_CACHE_NONE)
+  {
+    return HAL_BUSY;
+  }
+
+  pCache->Queue[(pCache->QueueHead + pCache->QueueCount) % ASSET_CACHE_SLOTS] = (uint16_t)slot;
+  pCache->QueueCount++;
+  return HAL_OK;
+}
+
+/**
+  * @brief  Decode the assets read, start the next reads
+  * @param  pCache: Cache
+  * @retval Number of assets decoded
+  */
+uint32_t ASSET_Cache_Process(ASSET_Cache_TypeDef *pCache)
+{
+  uint32_t inserted = pCache->Stats.Inserted;
+  uint32_t slot, decodes = 0U;
+#if (ASSET_CACHE_ASYNC == 1U)
+  AIO_RequestTypeDef *preqs[ASSET_CACHE_LOADS];
+  ASSET_Cache_LoadTypeDef *pload;
+  const ASSET_EntryTypeDef *pentry;
+  uint32_t i, count;
+
+  if(pCache->Init.pDev != NULL)
+  {
+    count = AIO_CQ_Poll(&pCache->Cq, preqs, ASSET_CACHE_LOADS);
+    for(i = 0U; i < count; i++)
+    {
+      Cache_LoadDone(pCache, (ASSET_Cache_LoadTypeDef *)preqs[i]->pContext);
+    }
+
+    /* Strip table first, its size is known from the entry */
+    for(i = 0U; (i < ASSET_CACHE_LOADS) && (pCache->QueueCount != 0U); i++)
+    {
+      pload = &pCache->Loads[i];
+      if(pload->Slot != ASSET_CACHE_NONE)
+      {
+        continue;
+      }
+      slot = pCache->Queue[pCache->QueueHead];
+      pCache->QueueHead = (pCache->QueueHead + 1U) % ASSET_CACHE_SLOTS;
+      pCache->QueueCount--;
+
+      pentry = pCache->Slots[slot].pEntry;
+      if(ASSET_GetStripCount(pentry) == 0U)
+      {
+        Cache_Decode(pCache, slot, NULL);
+        continue;
+      }
+      pload->Slot  = slot;
+      pload->Phase = 0U;
+      pCache->Slots[slot].State = ASSET_CACHE_LOADING;
+      if(Cache_StartLoad(pCache, pload, pentry->Offset,
+                         pentry->Offset + ((ASSET_GetStripCount(pentry) + 1U) * 4U)) != HAL_OK)
+      {
+        pload->Slot = ASSET_CACHE_NONE;
+        Cache_Release(pCache, slot);
+        pCache->Stats.Errors++;
+      }
+    }
+
+    return pCache->Stats.Inserted - inserted;
+  }
+#endif
+
+  while((decodes < ASSET_CACHE_DECODES) && (pCache->QueueCount != 0U))
+  {
+    slot = pCache->Queue[pCache->QueueHead];
+    pCache->QueueHead = (pCache->QueueHead + 1U) % ASSET_CACHE_SLOTS;
+    pCache->QueueCount--;
+    Cache_Decode(pCache, slot, pCache->Init.pPack->pData + pCache->Slots[slot].pEntry->Offset);
+    decodes++;
+  }
+
+  return pCache->Stats.Inserted - inserted;
+}
+
+/**
+  * @brief  Draw a decoded glyph or image
+  * @param  pCache: Cache
+  * @param  Code: Unicode code point of a glyph, or ASSET_IMAGE(Id)
+  * @param  pTarget: Framebuffer
+  * @param  Xpos: Column of the top left corner
+  * @param  Ypos: Line of the top left corner
+  * @param  Color: ARGB8888 color of A8 and A4 assets, unused otherwise
+  * @retval HAL_OK, HAL_BUSY if the asset is not decoded yet, HAL_ERROR if it
+  *         is not in the pack, outside the target area, or on DMA2D error
+  */
+HAL_StatusTypeDef ASSET_Cache_Draw(ASSET_Cache_TypeDef *pCache, uint32_t Code,
+                                   const ASSET_TargetTypeDef *pTarget, uint32_t Xpos,
+                                   uint32_t Ypos, uint32_t Color)
+{
+  const ASSET_Cache_SlotTypeDef *pslot;
+  HAL_StatusTypeDef status;
+  uint32_t slot = Cache_Lookup(pCache, Code, &status);
+
+  if(status != HAL_OK)
+  {
+    return status;
+  }
+
+  pslot = &pCache->Slots[slot];
+  if(pslot->pData == NULL)
+  {
+    return HAL_OK;
+  }
+  return ASSET_DrawDecoded(pslot->pEntry, pslot->Format, pslot->pData, pTarget, Xpos, Ypos, Color);
+}
+
+/**
+  * @brief  Draw a UTF-8 string with the decoded glyphs of the pack
+  * @note   Layout as ASSET_DrawString(). The glyphs not decoded yet are not
+  *         drawn.
+  * @param  pCache: Cache
+  * @param  pTarget: Framebuffer
+  * @param  Xpos: Column of the pen at the start of each line
+  * @param  Ypos: Line of the top of the first text line
+  * @param  pText: Null terminated UTF-8 string
+  * @param  Color: ARGB8888 text color
+  * @retval HAL_OK, HAL_BUSY if glyphs were not decoded yet, HAL_ERROR if a
+  *         character is missing or was not drawn
+  */
+HAL_StatusTypeDef ASSET_Cache_DrawString(ASSET_Cache_TypeDef *pCache, const ASSET_TargetTypeDef *pTarget,
+                                         uint32_t Xpos, uint32_t Ypos, const char *pText,
+                                         uint32_t Color)
+{
+  const ASSET_PackTypeDef *ppack = pCache->Init.pPack;
+  const uint8_t *ptext = (const uint8_t *)pText;
+  const ASSET_EntryTypeDef *pentry;
+  HAL_StatusTypeDef status = HAL_OK, drawn;
+  int32_t pen_x = (int32_t)Xpos;
+  int32_t baseline = (int32_t)(Ypos + ppack->Ascent);
+  int32_t x, y;
+  uint32_t code;
+
+  while(*ptext != 0U)
+  {
+    code = ASSET_NextCodePoint(&ptext);
+
+    if(code == (uint32_t)'\n')
+    {
+      pen_x = (int32_t)Xpos;
+      baseline += (int32_t)ppack->LineHeight;
+      continue;
+    }
+
+    /* Metrics from the directory, in RAM */
+    pentry = ASSET_Find(ppack, code);
+    if(pentry == NULL)
+    {
+      status = HAL_ERROR;
+      pentry = ASSET_Find(ppack, ASSET_REPLACEMENT_CHAR);
+      if(pentry == NULL)
+      {
+        continue;
+      }
+    }
+
+    x = pen_x + pentry->BearingX;
+    y = baseline - pentry->BearingY;
+    drawn = ((x < 0) || (y < 0)) ? HAL_ERROR :
+            ASSET_Cache_Draw(pCache, pentry->Code, pTarget, (uint32_t)x, (uint32_t)y, Color);
+    if((drawn == HAL_ERROR) || ((drawn == HAL_BUSY) && (status == HAL_OK)))
+    {
+      status = drawn;
+    }
+    pen_x += pentry->Advance;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Drop the decoded and queued assets, the reads in progress go on
+  * @param  pCache: Cache
+  * @retval None
+  */
+void ASSET_Cache_Flush(ASSET_Cache_TypeDef *pCache)
+{
+  while(pCache->Tail != ASSET_CACHE_NONE)
+  {
+    Cache_Evict(pCache, pCache->Tail);
+  }
+  while(pCache->QueueCount != 0U)
+  {
+    Cache_Release(pCache, pCache->Queue[pCache->QueueHead]);
+    pCache->QueueHead = (pCache->QueueHead + 1U) % ASSET_CACHE_SLOTS;
+    pCache->QueueCount--;
+  }
+}
+
+/**
+  * @brief  Get the cache statistics
+  * @param  pCache: Cache
+  * @param  pStats: Statistics
+  * @retval None
+  */
+void ASSET_Cache_GetStats(const ASSET_Cache_TypeDef *pCache, ASSET_Cache_StatsTypeDef *pStats)
+{
+  *pStats = pCache->Stats;
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Bucket of a code
+  * @param  Code: Asset code
+  * @retval Bucket index
+  */
+static uint32_t Cache_Hash(uint32_t Code)
+{
+  return (Code ^ (Code >> 16)) % ASSET_CACHE_SLOTS;
+}
+
+/**
+  * @brief  Find the slot of a code
+  * @param  pCache: Cache
+  * @param  Code: Asset code
+  * @retval Slot, ASSET_CACHE_NONE if none
+  */
+static uint32_t Cache_Find(const ASSET_Cache_TypeDef *pCache, uint32_t Code)
+{
+  uint32_t slot = pCache->Buckets[Cache_Hash(Code)];
+
+  while((slot != ASSET_CACHE_NONE) && (pCache->Slots[slot].Code != Code))
+  {
+    slot = pCache->Slots[slot].HashNext;
+  }
+  return slot;
+}
+
+/**
+  * @brief  Find a decoded asset, queue it or decode it if missing
+  * @param  pCache: Cache
+  * @param  Code: Asset code
+  * @param  pStatus: HAL_OK if decoded, HAL_BUSY if queued or loading,
+  *         HAL_ERROR if not in the pack or corrupted
+  * @retval Slot, valid with HAL_OK
+  */
+static uint32_t Cache_Lookup(ASSET_Cache_TypeDef *pCache, uint32_t Code, HAL_StatusTypeDef *pStatus)
+{
+  uint32_t slot = Cache_Find(pCache, Code);
+
+  if((slot != ASSET_CACHE_NONE) && (pCache->Slots[slot].State == ASSET_CACHE_READY))
+  {
+    pCache->Stats.Hits++;
+    if(pCache->Head != slot)
+    {
+      Cache_Unlink(pCache, slot);
+      Cache_PushHead(pCache, slot);
+    }
+    *pStatus = HAL_OK;
+    return slot;
+  }
+
+  pCache->Stats.Misses++;
+  if(slot == ASSET_CACHE_NONE)
+  {
+    *pStatus = ASSET_Cache_Prefetch(pCache, Code);
+    if(*pStatus != HAL_OK)
+    {
+      return ASSET_CACHE_NONE;
+    }
+    slot = Cache_Find(pCache, Code);
+  }
+
+  /* Memory-mapped: decoded now rather than in turn */
+  if((pCache->Init.pDev == NULL) && (pCache->Slots[slot].State == ASSET_CACHE_QUEUED))
+  {
+    Cache_Dequeue(pCache, slot);
+    Cache_Decode(pCache, slot, pCache->Init.pPack->pData + pCache->Slots[slot].pEntry->Offset);
+    slot = Cache_Find(pCache, Code);
+    *pStatus = (slot != ASSET_CACHE_NONE) ? HAL_OK : HAL_ERROR;
+    return slot;
+  }
+
+  *pStatus = HAL_BUSY;
+  return slot;
+}
+
+/**
+  * @brief  Take a slot for a code, evicting the least recently used asset
+  *         if none is free, and queue it
+  * @param  pCache: Cache
+  * @param  Code: Asset code, not in the cache
+  * @param  pEntry: Asset entry
+  * @retval Slot, ASSET_CACHE_NONE if all the slots are queued or loading
+  */
+static uint32_t Cache_NewSlot(ASSET_Cache_TypeDef *pCache, uint32_t Code, const ASSET_EntryTypeDef *pEntry)
+{
+  ASSET_Cache_SlotTypeDef *pslot;
+  uint32_t slot, bucket;
+
+  if((pCache->Free == ASSET_CACHE_NONE) && (pCache->Tail != ASSET_CACHE_NONE))
+  {
+    Cache_Evict(pCache, pCache->Tail);
+  }
+  slot = pCache->Free;
+  if(slot == ASSET_CACHE_NONE)
+  {
+    return ASSET_CACHE_NONE;
+  }
+
+  pslot = &pCache->Slots[slot];
+  pCache->Free = pslot->Next;
+
+  bucket = Cache_Hash(Code);
+  pslot->Code     = Code;
+  pslot->pEntry   = pEntry;
+  pslot->pData    = NULL;
+  pslot->Size     = 0U;
+  pslot->State    = ASSET_CACHE_QUEUED;
+  pslot->Format   = pEntry->Format;
+  pslot->HashNext = pCache->Buckets[bucket];
+  pCache->Buckets[bucket] = (uint16_t)slot;
+
+  return slot;
+}
+
+/**
+  * @brief  Give back a slot not in the LRU list
+  * @param  pCache: Cache
+  * @param  Slot: Slot, removed from its bucket
+  * @retval None
+  */
+static void Cache_Release(ASSET_Cache_TypeDef *pCache, uint32_t Slot)
+{
+  ASSET_Cache_SlotTypeDef *pslot = &pCache->Slots[Slot];
+  uint16_t *plink = &pCache->Buckets[Cache_Hash(pslot->Code)];
+
+  while(*plink != Slot)
+  {
+    plink = &pCache->Slots[*plink].HashNext;
+  }
+  *plink = pslot->HashNext;
+
+  pslot->State = ASSET_CACHE_FREE;
+  pslot->Next  = pCache->Free;
+  pCache->Free = (uint16_t)Slot;
+}
+
+/**
+  * @brief  Drop a decoded asset
+  * @param  pCache: Cache
+  * @param  Slot: Slot, READY
+  * @retval None
+  */
+static void Cache_Evict(ASSET_Cache_TypeDef *pCache, uint32_t Slot)
+{
+  ASSET_Cache_SlotTypeDef *pslot = &pCache->Slots[Slot];
+
+  Cache_Unlink(pCache, Slot);
+  if(pslot->pData != NULL)
+  {
+    TLSF_Heap_Free(pslot->pData);
+    pslot->pData = NULL;
+  }
+  pCache->Stats.UsedSize -= pslot->Size;
+  pCache->Stats.Evicted++;
+  Cache_Release(pCache, Slot);
+}
+
+/**
+  * @brief  Remove a slot from the LRU list
+  * @param  pCache: Cache
+  * @param  Slot: Slot, READY
+  * @retval None
+  */
+static void Cache_Unlink(ASSET_Cache_TypeDef *pCache, uint32_t Slot)
+{
+  ASSET_Cache_SlotTypeDef *pslot = &pCache->Slots[Slot];
+
+  if(pslot->Prev != ASSET_CACHE_NONE)
+  {
+    pCache->Slots[pslot->Prev].Next = pslot->Next;
+  }
+  else
+  {
+    pCache->Head = pslot->Next;
+  }
+  if(pslot->Next != ASSET_CACHE_NONE)
+  {
+    pCache->Slots[pslot->Next].Prev = pslot->Prev;
+  }
+  else
+  {
+    pCache->Tail = pslot->Prev;
+  }
+}
+
+/**
+  * @brief  Insert a slot as the most recently used
+  * @param  pCache: Cache
+  * @param  Slot: Slot, READY
+  * @retval None
+  */
+static void Cache_PushHead(ASSET_Cache_TypeDef *pCache, uint32_t Slot)
+{
+  ASSET_Cache_SlotTypeDef *pslot = &pCache->Slots[Slot];
+
+  pslot->Prev = ASSET_CACHE_NONE;
+  pslot->Next = pCache->Head;
+  if(pCache->Head != ASSET_CACHE_NONE)
+  {
+    pCache->Slots[pCache->Head].Prev = (uint16_t)Slot;
+  }
+  else
+  {
+    pCache->Tail = (uint16_t)Slot;
+  }
+  pCache->Head = (uint16_t)Slot;
+}
+
+/**
+  * @brief  Remove a slot from the decode queue
+  * @param  pCache: Cache
+  * @param  Slot: Slot, QUEUED
+  * @retval None
+  */
+static void Cache_Dequeue(ASSET_Cache_TypeDef *pCache, uint32_t Slot)
+{
+  uint32_t i, from, to, kept = 0U;
+
+  for(i = 0U; i < pCache->QueueCount; i++)
+  {
+    from = (pCache->QueueHead + i) % ASSET_CACHE_SLOTS;
+    if(pCache->Queue[from] != Slot)
+    {
+      to = (pCache->QueueHead + kept) % ASSET_CACHE_SLOTS;
+      pCache->Queue[to] = pCache->Queue[from];
+      kept++;
+    }
+  }
+  pCache->QueueCount = kept;
+}
+
+/**
+  * @brief  Allocate a buffer, evicting the least recently used assets until
+  *         it fits
+  * @param  pCache: Cache
+  * @param  Size: Bytes, multiple of the cache line
+  * @param  Attributes: TLSF_ATTR_xxx
+  * @param  Counted: 1 for a decoded asset, counted in MaxSize
+  * @retval Buffer aligned on a cache line, NULL if it cannot fit
+  */
+static void *Cache_Alloc(ASSET_Cache_TypeDef *pCache, uint32_t Size, uint32_t Attributes, uint32_t Counted)
+{
+  void *pbuffer;
+
+  if((Counted != 0U) && (Size > pCache->Init.MaxSize))
+  {
+    return NULL;
+  }
+
+  for(;;)
+  {
+    if((Counted == 0U) || ((pCache->Stats.UsedSize + Size) <= pCache->Init.MaxSize))
+    {
+      pbuffer = TLSF_Heap_AllocAligned(Size, ASSET_CACHE_LINE, Attributes);
+      if(pbuffer != NULL)
+      {
+        return pbuffer;
+      }
+    }
+    if(pCache->Tail == ASSET_CACHE_NONE)
+    {
+      return NULL;
+    }
+    Cache_Evict(pCache, pCache->Tail);
+  }
+}
+
+/**
+  * @brief  Decode an asset and make it the most recently used
+  * @note   The slot is released on error.
+  * @param  pCache: Cache
+  * @param  Slot: Slot, QUEUED or LOADING
+  * @param  pStrips: Strip table of the asset followed by its strips
+  * @retval None
+  */
+static void Cache_Decode(ASSET_Cache_TypeDef *pCache, uint32_t Slot, const uint8_t *pStrips)
+{
+  ASSET_Cache_SlotTypeDef *pslot = &pCache->Slots[Slot];
+  const ASSET_EntryTypeDef *pentry = pslot->pEntry;
+  uint32_t count = ASSET_GetStripCount(pentry);
+  uint32_t strip, size, out = 0U, decoded, pixels, i;
+  uint8_t *pdata = NULL;
+
+  if(count != 0U)
+  {
+    /* A4 strips of an odd number of pixels end on half a byte */
+    if((pentry->Format == ASSET_FORMAT_A4) && (count > 1U) &&
+       ((((uint32_t)pentry->StripLines * pentry->Width) & 1U) != 0U))
+    {
+      pslot->Format = ASSET_FORMAT_A8;
+    }
+    size  = ASSET_GetDecodedSize(pentry, pslot->Format);
+    pdata = (uint8_t *)Cache_Alloc(pCache, ASSET_CACHE_ALIGN(size), pCache->Init.Attributes, 1U);
+    if(pdata == NULL)
+    {
+      pCache->Stats.Errors++;
+      Cache_Release(pCache, Slot);
+      return;
+    }
+
+    for(strip = 0U; strip < count; strip++)
+    {
+      if(pslot->Format == pentry->Format)
+      {
+        decoded = ASSET_DecodeStrip(pentry, pStrips, strip, &pdata[out], size - out);
+        out += decoded;
+      }
+      else
+      {
+        decoded = ASSET_DecodeStrip(pentry, pStrips, strip, AssetCacheStrip, ASSET_STRIP_SIZE);
+        pixels  = pentry->Height - (strip * pentry->StripLines);
+        pixels  = ((pixels < pentry->StripLines) ? pixels : pentry->StripLines) * pentry->Width;
+        for(i = 0U; (decoded != 0U) && (i < pixels); i++)
+        {
+          pdata[out++] = (uint8_t)((((i & 1U) != 0U) ? (AssetCacheStrip[i / 2U] >> 4) :
+                                                       (AssetCacheStrip[i / 2U] & 0x0FU)) * 0x11U);
+        }
+      }
+      if(decoded == 0U)
+      {
+        TLSF_Heap_Free(pdata);
+        pCache->Stats.Errors++;
+        Cache_Release(pCache, Slot);
+        return;
+      }
+    }
+
+#if (__DCACHE_PRESENT == 1)
+    /* Written by the CPU, read by the DMA2D */
+    if((SCB->CCR & SCB_CCR_DC_Msk) != 0)
+    {
+      SCB_CleanDCache_by_Addr((uint32_t *)pdata, (int32_t)ASSET_CACHE_ALIGN(size));
+    }
+#endif
+    pslot->Size = ASSET_CACHE_ALIGN(size);
+  }
+
+  pslot->pData = pdata;
+  pslot->State = ASSET_CACHE_READY;
+  pCache->Stats.UsedSize += pslot->Size;
+  if(pCache->Stats.UsedSize > pCache->Stats.PeakSize)
+  {
+    pCache->Stats.PeakSize = pCache->Stats.UsedSize;
+  }
+  pCache->Stats.Inserted++;
+  Cache_PushHead(pCache, Slot);
+}
+
+#if (ASSET_CACHE_ASYNC == 1U)
+/**
+  * @brief  Check the strip table of an asset read from the device
+  * @param  pEntry: Asset entry
+  * @param  pTable: Strip table
+  * @retval Pack offset of the end of the last strip, 0 if corrupted
+  */
+static uint32_t Cache_CheckTable(const ASSET_EntryTypeDef *pEntry, const uint32_t *pTable)
+{
+  uint32_t count = ASSET_GetStripCount(pEntry);
+  uint32_t i;
+
+  /* Strips after the table, in order: all inside the bytes read */
+  if(pTable[0] < (pEntry->Offset + ((count + 1U) * 4U)))
+  {
+    return 0U;
+  }
+  for(i = 0U; i < count; i++)
+  {
+    if(pTable[i + 1U] < pTable[i])
+    {
+      return 0U;
+    }
+  }
+  return pTable[count];
+}
+
+/**
+  * @brief  Read pack bytes through aio_queue
+  * @param  pCache: Cache
+  * @param  pLoad: Load, Slot and Phase set
+  * @param  Start: Pack offset of the first byte
+  * @param  End: Pack offset after the last byte
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef Cache_StartLoad(ASSET_Cache_TypeDef *pCache, ASSET_Cache_LoadTypeDef *pLoad,
+                                         uint32_t Start, uint32_t End)
+{
+  AIO_RequestTypeDef *preq = &pLoad->Req;
+  uint32_t unit = ASSET_CACHE_LINE;
+
+#if (AIO_QUEUE_USE_SD == 1U)
+  if(pCache->Init.pDev->Type == AIO_DEVICE_SD)
+  {
+    unit = BLOCKSIZE;
+  }
+#endif
+
+  /* Whole blocks, whole cache lines */
+  pLoad->Start   = Start - (Start % unit);
+  pLoad->Length  = ((End + unit - 1U) - ((End + unit - 1U) % unit)) - pLoad->Start;
+  pLoad->pBuffer = (uint8_t *)Cache_Alloc(pCache, pLoad->Length, pCache->Init.ReadAttributes, 0U);
+  if(pLoad->pBuffer == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  memset(preq, 0, sizeof(*preq));
+  preq->Op       = AIO_OP_READ;
+  preq->pData    = pLoad->pBuffer;
+  preq->pCq      = &pCache->Cq;
+  preq->pContext = pLoad;
+#if (AIO_QUEUE_USE_SD == 1U)
+  if(pCache->Init.pDev->Type == AIO_DEVICE_SD)
+  {
+    preq->Address = pCache->Init.Address + (pLoad->Start / BLOCKSIZE);
+    preq->Size    = pLoad->Length / BLOCKSIZE;
+  }
+#endif
+#if (AIO_QUEUE_USE_QSPI == 1U)
+  if(pCache->Init.pDev->Type == AIO_DEVICE_QSPI)
+  {
+    pLoad->Command         = *pCache->Init.pReadCommand;
+    pLoad->Command.Address = pCache->Init.Address + pLoad->Start;
+    preq->pCommand         = &pLoad->Command;
+    preq->Size             = pLoad->Length;
+  }
+#endif
+
+  if(AIO_Submit(pCache->Init.pDev, preq) != HAL_OK)
+  {
+    TLSF_Heap_Free(pLoad->pBuffer);
+    return HAL_ERROR;
+  }
+  return HAL_OK;
+}
+
+/**
+  * @brief  Handle a completed read: read the strips once the table is
+  *         known, decode the asset once the strips are read
+  * @param  pCache: Cache
+  * @param  pLoad: Load completed
+  * @retval None
+  */
+static void Cache_LoadDone(ASSET_Cache_TypeDef *pCache, ASSET_Cache_LoadTypeDef *pLoad)
+{
+  uint32_t slot = pLoad->Slot;
+  const ASSET_EntryTypeDef *pentry = pCache->Slots[slot].pEntry;
+  const uint8_t *pstrips = pLoad->pBuffer + (pentry->Offset - pLoad->Start);
+  uint32_t end = 0U;
+
+  if(pLoad->Req.Status == HAL_OK)
+  {
+    if(pLoad->Phase != 0U)
+    {
+      Cache_Decode(pCache, slot, pstrips);
+      TLSF_Heap_Free(pLoad->pBuffer);
+      pLoad->Slot = ASSET_CACHE_NONE;
+      return;
+    }
+
+    end = Cache_CheckTable(pentry, (const uint32_t *)pstrips);
+    if((end != 0U) && (end <= (pLoad->Start + pLoad->Length)))
+    {
+      /* Small asset: read with its table */
+      Cache_Decode(pCache, slot, pstrips);
+      TLSF_Heap_Free(pLoad->pBuffer);
+      pLoad->Slot = ASSET_CACHE_NONE;
+      return;
+    }
+  }
+
+  TLSF_Heap_Free(pLoad->pBuffer);
+  if(end != 0U)
+  {
+    pLoad->Phase = 1U;
+    if(Cache_StartLoad(pCache, pLoad, pentry->Offset, end) == HAL_OK)
+    {
+      return;
+    }
+  }
+
+  pLoad->Slot = ASSET_CACHE_NONE;
+  pCache->Stats.Errors++;
+  Cache_Release(pCache, slot);
+}
+#endif /* ASSET_CACHE_ASYNC */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
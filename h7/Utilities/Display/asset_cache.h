@@ -0,0 +1,185 @@
+/**
+  ******************************************************************************
+  * @file    asset_cache.h
+  * @author  MCD Application Team
+  * @brief   Header for asset_cache module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _ASSET_CACHE_H__
+#define _ASSET_CACHE_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "asset_pack.h"
+#include "aio_queue.h"
+#include "tlsf_heap.h"
+
+/* Exported constants --------------------------------------------------------*/
+/* Assets tracked at once, loading or decoded, at most 0xFFFE. Override in
+   main.h. */
+#if !defined(ASSET_CACHE_SLOTS)
+#define ASSET_CACHE_SLOTS              128U
+#endif
+
+#if (ASSET_CACHE_SLOTS > 0xFFFEU)
+#error "ASSET_CACHE_SLOTS is limited to 0xFFFE"
+#endif
+
+/* Reads in progress on the SD or QSPI device at once. Override in main.h. */
+#if !defined(ASSET_CACHE_LOADS)
+#define ASSET_CACHE_LOADS              4U
+#endif
+
+/* Assets decoded in place by ASSET_Cache_Process() for a memory-mapped pack,
+   per call. Override in main.h. */
+#if !defined(ASSET_CACHE_DECODES)
+#define ASSET_CACHE_DECODES            1U
+#endif
+
+/* Assets read through aio_queue: the SD or QSPI driver must be served */
+#if (AIO_QUEUE_USE_SD == 1U) || (AIO_QUEUE_USE_QSPI == 1U)
+#define ASSET_CACHE_ASYNC              1U
+#else
+#define ASSET_CACHE_ASYNC              0U
+#endif
+
+/* Slot states */
+#define ASSET_CACHE_FREE               0U
+#define ASSET_CACHE_QUEUED             1U   /* Waiting for a read or a decode  */
+#define ASSET_CACHE_LOADING            2U   /* Read in progress                */
+#define ASSET_CACHE_READY              3U   /* Decoded, in the LRU list        */
+
+#define ASSET_CACHE_NONE               0xFFFFU
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  const ASSET_PackTypeDef   *pPack;       /* Directory, opened by ASSET_Init()          */
+  AIO_DeviceTypeDef         *pDev;        /* SD or QSPI device, NULL: pPack->pData is
+                                             memory-mapped and decoded in place         */
+  uint32_t                  Address;      /* SD: first block, QSPI: flash address of
+                                             the pack                                   */
+#if (AIO_QUEUE_USE_QSPI == 1U)
+  const QSPI_CommandTypeDef *pReadCommand; /* QSPI: read command, Address and NbData
+                                             set for each read                          */
+#endif
+  uint32_t                  MaxSize;      /* Bytes of decoded assets kept               */
+  uint32_t                  Attributes;   /* TLSF_ATTR_xxx of the decoded assets        */
+  uint32_t                  ReadAttributes; /* TLSF_ATTR_xxx of the read buffers        */
+} ASSET_Cache_InitTypeDef;
+
+typedef struct
+{
+  uint32_t                  Code;         /* Key: code point or ASSET_IMAGE(Id)         */
+  const ASSET_EntryTypeDef  *pEntry;
+  uint8_t                   *pData;       /* Decoded lines, READY only                  */
+  uint32_t                  Size;         /* Bytes allocated                            */
+  uint8_t                   State;        /* ASSET_CACHE_xxx                            */
+  uint8_t                   Format;       /* ASSET_FORMAT_xxx of pData                  */
+  uint16_t                  Prev;         /* LRU list, towards the most recent          */
+  uint16_t                  Next;         /* LRU list towards the oldest, free list     */
+  uint16_t                  HashNext;     /* Same bucket                                */
+} ASSET_Cache_SlotTypeDef;
+
+#if (ASSET_CACHE_ASYNC == 1U)
+typedef struct
+{
+  AIO_RequestTypeDef        Req;
+#if (AIO_QUEUE_USE_QSPI == 1U)
+  QSPI_CommandTypeDef       Command;
+#endif
+  uint8_t                   *pBuffer;     /* Read buffer                                */
+  uint32_t                  Start;        /* Pack offset of pBuffer[0]                  */
+  uint32_t                  Length;       /* Bytes read in pBuffer                      */
+  uint32_t                  Slot;         /* ASSET_CACHE_NONE: unused                   */
+  uint32_t                  Phase;        /* 0: strip table, 1: strips                  */
+} ASSET_Cache_LoadTypeDef;
+#endif
+
+typedef struct
+{
+  uint32_t                  Hits;         /* Lookups of a decoded asset                 */
+  uint32_t                  Misses;       /* Lookups of an asset not decoded yet        */
+  uint32_t                  Inserted;     /* Assets decoded                             */
+  uint32_t                  Evicted;      /* Assets dropped to make room                */
+  uint32_t                  Errors;       /* Reads or decodes failed                    */
+  uint32_t                  UsedSize;     /* Bytes of decoded assets                    */
+  uint32_t                  PeakSize;     /* Highest UsedSize                           */
+} ASSET_Cache_StatsTypeDef;
+
+typedef struct
+{
+  ASSET_Cache_InitTypeDef   Init;
+  ASSET_Cache_SlotTypeDef   Slots[ASSET_CACHE_SLOTS];
+  uint16_t                  Buckets[ASSET_CACHE_SLOTS];
+  uint16_t                  Head;         /* Most recently used                         */
+  uint16_t                  Tail;         /* Least recently used, evicted first         */
+  uint16_t                  Free;         /* Free slots                                 */
+  uint16_t                  Queue[ASSET_CACHE_SLOTS]; /* QUEUED slots, oldest first     */
+  uint32_t                  QueueHead;
+  uint32_t                  QueueCount;
+#if (ASSET_CACHE_ASYNC == 1U)
+  AIO_CQ_TypeDef            Cq;
+  ASSET_Cache_LoadTypeDef   Loads[ASSET_CACHE_LOADS];
+#endif
+  ASSET_Cache_StatsTypeDef  Stats;
+} ASSET_Cache_TypeDef;
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef             ASSET_Cache_Init(ASSET_Cache_TypeDef *pCache);
+HAL_StatusTypeDef             ASSET_Cache_DeInit(ASSET_Cache_TypeDef *pCache);
+const ASSET_Cache_SlotTypeDef *ASSET_Cache_Get(ASSET_Cache_TypeDef *pCache, uint32_t Code);
+HAL_StatusTypeDef             ASSET_Cache_Prefetch(ASSET_Cache_TypeDef *pCache, uint32_t Code);
+uint32_t                      ASSET_Cache_Process(ASSET_Cache_TypeDef *pCache);
+HAL_StatusTypeDef             ASSET_Cache_Draw(ASSET_Cache_TypeDef *pCache, uint32_t Code,
+                                               const ASSET_TargetTypeDef *pTarget, uint32_t Xpos,
+                                               uint32_t Ypos, uint32_t Color);
+HAL_StatusTypeDef             ASSET_Cache_DrawString(ASSET_Cache_TypeDef *pCache, const ASSET_TargetTypeDef *pTarget,
+                                                     uint32_t Xpos, uint32_t Ypos, const char *pText,
+                                                     uint32_t Color);
+void                          ASSET_Cache_Flush(ASSET_Cache_TypeDef *pCache);
+void                          ASSET_Cache_GetStats(const ASSET_Cache_TypeDef *pCache,
+                                                   ASSET_Cache_StatsTypeDef *pStats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _ASSET_CACHE_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
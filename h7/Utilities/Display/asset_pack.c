@@ -0,0 +1,747 @@
+/**
+  ******************************************************************************
+  * @file    asset_pack.c
+  * @author  MCD Application Team
+  * @brief   Compressed font and image assets read in place (internal flash or
+  *          memory-mapped QSPI), decoded by strips and drawn with the DMA2D.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- build the pack on the host with Utilities/PC_Software/AssetPacker:
+   TrueType fonts are rendered to anti-aliased A4 or A8 glyphs for the
+   characters listed, images are converted to A8, RGB565 or ARGB8888. Each
+   asset is cut in strips of at most ASSET_STRIP_SIZE decoded bytes, each
+   strip compressed on its own with RLE or LZ4, whichever is smaller.
+
+2- program the pack in the QSPI flash and map it in memory, or link the C
+   array output by the packer in the internal flash, then call ASSET_Init()
+   with its address. The directory and the strips are read in place (XIP):
+   only the strips being decoded are held in RAM.
+
+3- describe the framebuffer in an ASSET_TargetTypeDef and draw UTF-8 text
+   with ASSET_DrawString(), or one glyph or image found by ASSET_Find()
+   with ASSET_Draw(). The CPU decodes a strip into one half of the strip
+   buffer while the DMA2D draws the previous one: glyphs and A8 images are
+   blended with the given color, ARGB8888 images with their own alpha, and
+   RGB565 images are copied.
+
+4- ASSET_Decode() gives a decoded strip to the application for other uses.
+   ASSET_DecodeStrip() decodes from a copy of the strip table and strips of
+   an asset read from a pack that is not memory-mapped (SD card), and
+   ASSET_DrawDecoded() draws a whole decoded asset in one DMA2D transfer
+   (see asset_cache).
+
+The linker script must place the .dma_d1 section in the AXI SRAM.
+
+Assets not fully inside the target area are not drawn. The DMA2D is used in
+polling mode and must not be used by another module during a drawing.
+*******************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include "asset_pack.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define ASSET_DMA2D_TIMEOUT      100U   /* ms, one strip */
+#define ASSET_REPLACEMENT_CHAR   0xFFFDU
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static DMA2D_HandleTypeDef hdma2d_asset;
+
+/* Decoded strips, one decoded by the CPU while the DMA2D reads the other.
+   The DMA2D is an AXI master: the strips are kept in the D1 domain. */
+static uint8_t AssetStrips[2][ASSET_STRIP_SIZE] __attribute__((section(".dma_d1"), aligned(32)));
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t          Asset_StripLines(const ASSET_EntryTypeDef *pEntry, uint32_t Strip);
+static uint32_t          Asset_StripSize(const ASSET_EntryTypeDef *pEntry, uint32_t Lines);
+static uint32_t          Asset_DecodeRLE(const uint8_t *pSrc, uint32_t SrcSize, uint8_t *pDst, uint32_t DstSize);
+static uint32_t          Asset_DecodeLZ4(const uint8_t *pSrc, uint32_t SrcSize, uint8_t *pDst, uint32_t DstSize);
+static HAL_StatusTypeDef Asset_ConfigDMA2D(uint32_t Format, uint32_t Width, const ASSET_TargetTypeDef *pTarget,
+                                           uint32_t Color);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Open a pack
+  * @param  pPack: Pack descriptor to fill
+  * @param  pData: Pack start, 4 bytes aligned, in flash or memory-mapped QSPI
+  * @retval HAL_OK, or HAL_ERROR if the data is not a pack of this version
+  */
+HAL_StatusTypeDef ASSET_Init(ASSET_PackTypeDef *pPack, const uint8_t *pData)
+{
+  const ASSET_HeaderTypeDef *pheader = (const ASSET_HeaderTypeDef *)pData;
+
+  if((pData == NULL) || (((uint32_t)pData & 3U) != 0U) ||
+     (pheader->Magic != ASSET_MAGIC) || (pheader->Version != ASSET_VERSION))
+  {
+    return HAL_ERROR;
+  }
+
+  pPack->pData      = pData;
+  pPack->pEntries   = (const ASSET_EntryTypeDef *)(pData + sizeof(ASSET_HeaderTypeDef));
+  pPack->Count      = pheader->Count;
+  pPack->LineHeight = pheader->LineHeight;
+  pPack->Ascent     = pheader->Ascent;
+
+  __HAL_RCC_DMA2D_CLK_ENABLE();
+  hdma2d_asset.Instance = DMA2D;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Find an asset
+  * @param  pPack: Pack opened by ASSET_Init()
+  * @param  Code: Unicode code point of a glyph, or ASSET_IMAGE(Id)
+  * @retval Entry of the asset, NULL if not in the pack
+  */
+const ASSET_EntryTypeDef *ASSET_Find(const ASSET_PackTypeDef *pPack, uint32_t Code)
+{
+  uint32_t low = 0U, high = pPack->Count, middle;
+
+  /* Entries are sorted by code */
+  while(low < high)
+  {
+    middle = (low + high) / 2U;
+    if(pPack->pEntries[middle].Code == Code)
+    {
+      return &pPack->pEntries[middle];
+    }
+    if(pPack->pEntries[middle].Code < Code)
+    {
+      low = middle + 1U;
+    }
+    else
+    {
+      high = middle;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+  * @brief  Get the number of strips of an asset
+  * @param  pEntry: Asset entry
+  * @retval Number of strips, 0 for an empty glyph (space)
+  */
+uint32_t ASSET_GetStripCount(const ASSET_EntryTypeDef *pEntry)
+{
+  if((pEntry->Width == 0U) || (pEntry->Height == 0U) || (pEntry->StripLines == 0U))
+  {
+    return 0U;
+  }
+  return (pEntry->Height + pEntry->StripLines - 1U) / pEntry->StripLines;
+}
+
+/**
+  * @brief  Decode one strip of an asset
+  * @param  pPack: Pack opened by ASSET_Init()
+  * @param  pEntry: Asset entry
+  * @param  Strip: Strip index
+  * @param  pBuffer: Decoded strip
+  * @param  Size: Size of pBuffer in bytes
+  * @retval Decoded size in bytes, 0 if the strip is corrupted or does not fit
+  */
+uint32_t ASSET_Decode(const ASSET_PackTypeDef *pPack, const ASSET_EntryTypeDef *pEntry,
+                      uint32_t Strip, uint8_t *pBuffer, uint32_t Size)
+{
+  return ASSET_DecodeStrip(pEntry, pPack->pData + pEntry->Offset, Strip, pBuffer, Size);
+}
+
+/**
+  * @brief  Decode one strip of an asset from its strip table
+  * @param  pEntry: Asset entry
+  * @param  pStrips: Strip table of the asset followed by its strips, as laid
+  *         out in the pack from pEntry->Offset
+  * @param  Strip: Strip index
+  * @param  pBuffer: Decoded strip
+  * @param  Size: Size of pBuffer in bytes
+  * @retval Decoded size in bytes, 0 if the strip is corrupted or does not fit
+  */
+uint32_t ASSET_DecodeStrip(const ASSET_EntryTypeDef *pEntry, const uint8_t *pStrips,
+                           uint32_t Strip, uint8_t *pBuffer, uint32_t Size)
+{
+  const uint32_t *ptable;
+  const uint8_t *psrc;
+  uint32_t expected, decoded, start, end;
+
+  if(Strip >= ASSET_GetStripCount(pEntry))
+  {
+    return 0U;
+  }
+
+  expected = Asset_StripSize(pEntry, Asset_StripLines(pEntry, Strip));
+  if(expected > Size)
+  {
+    return 0U;
+  }
+
+  /* Table offsets are from the pack start */
+  ptable = (const uint32_t *)pStrips;
+  start  = ptable[Strip];
+  end    = ptable[Strip + 1U];
+  if((end < start) || (start < pEntry->Offset))
+  {
+    return 0U;
+  }
+  psrc = pStrips + (start - pEntry->Offset);
+
+  switch(pEntry->Compression)
+  {
+  case ASSET_COMPRESSION_NONE:
+    decoded = end - start;
+    if(decoded == expected)
+    {
+      memcpy(pBuffer, psrc, decoded);
+    }
+    break;
+  case ASSET_COMPRESSION_RLE:
+    decoded = Asset_DecodeRLE(psrc, end - start, pBuffer, expected);
+    break;
+  case ASSET_COMPRESSION_LZ4:
+    decoded = Asset_DecodeLZ4(psrc, end - start, pBuffer, expected);
+    break;
+  default:
+    decoded = 0U;
+    break;
+  }
+
+  return (decoded == expected) ? decoded : 0U;
+}
+
+/**
+  * @brief  Get the size of a whole decoded asset
+  * @param  pEntry: Asset entry
+  * @param  Format: ASSET_FORMAT_xxx of the decoded pixels, the format of the
+  *         entry or ASSET_FORMAT_A8 for an A4 asset expanded
+  * @retval Size in bytes
+  */
+uint32_t ASSET_GetDecodedSize(const ASSET_EntryTypeDef *pEntry, uint32_t Format)
+{
+  uint32_t pixels = (uint32_t)pEntry->Width * pEntry->Height;
+
+  switch(Format)
+  {
+  case ASSET_FORMAT_A4:
+    return (pixels + 1U) / 2U;
+  case ASSET_FORMAT_RGB565:
+    return pixels * 2U;
+  case ASSET_FORMAT_ARGB8888:
+    return pixels * 4U;
+  default:
+    return pixels;
+  }
+}
+
+/**
+  * @brief  Draw a glyph or an image
+  * @param  pPack: Pack opened by ASSET_Init()
+  * @param  pEntry: Asset entry
+  * @param  pTarget: Framebuffer
+  * @param  Xpos: Column of the top left corner
+  * @param  Ypos: Line of the top left corner
+  * @param  Color: ARGB8888 color of A8 and A4 assets, unused otherwise
+  * @retval HAL_OK, or HAL_ERROR if the asset is outside the target area,
+  *         corrupted, or on DMA2D error
+  */
+HAL_StatusTypeDef ASSET_Draw(const ASSET_PackTypeDef *pPack, const ASSET_EntryTypeDef *pEntry,
+                             const ASSET_TargetTypeDef *pTarget, uint32_t Xpos, uint32_t Ypos, uint32_t Color)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t count, strip, size, address;
+  uint32_t pixel_size = (pTarget->ColorMode == DMA2D_OUTPUT_RGB565) ? 2U : 4U;
+  uint32_t half = 0U, pending = 0U;
+
+  count = ASSET_GetStripCount(pEntry);
+  if(count == 0U)
+  {
+    return HAL_OK;
+  }
+
+  if(((Xpos + pEntry->Width) > pTarget->Width) || ((Ypos + pEntry->Height) > pTarget->Height) ||
+     (Asset_ConfigDMA2D(pEntry->Format, pEntry->Width, pTarget, Color) != HAL_OK))
+  {
+    return HAL_ERROR;
+  }
+
+  for(strip = 0U; strip < count; strip++)
+  {
+    size = ASSET_Decode(pPack, pEntry, strip, AssetStrips[half], ASSET_STRIP_SIZE);
+
+    /* Wait for the previous strip */
+    if(pending != 0U)
+    {
+      pending = 0U;
+      if(HAL_DMA2D_PollForTransfer(&hdma2d_asset, ASSET_DMA2D_TIMEOUT) != HAL_OK)
+      {
+        status = HAL_ERROR;
+      }
+    }
+    if((size == 0U) || (status != HAL_OK))
+    {
+      status = HAL_ERROR;
+      break;
+    }
+
+#if (__DCACHE_PRESENT == 1)
+    /* The strip is written by the CPU, read by the DMA2D */
+    if((SCB->CCR & SCB_CCR_DC_Msk) != 0)
+    {
+      SCB_CleanDCache_by_Addr((uint32_t *)AssetStrips[half], (int32_t)size);
+    }
+#endif
+
+    address = pTarget->Address +
+              (pixel_size * ((pTarget->Pitch * (Ypos + (strip * pEntry->StripLines))) + Xpos));
+
+    if(pEntry->Format == ASSET_FORMAT_RGB565)
+    {
+      status = HAL_DMA2D_Start(&hdma2d_asset, (uint32_t)AssetStrips[half], address,
+                               pEntry->Width, Asset_StripLines(pEntry, strip));
+    }
+    else
+    {
+      status = HAL_DMA2D_BlendingStart(&hdma2d_asset, (uint32_t)AssetStrips[half], address, address,
+                                       pEntry->Width, Asset_StripLines(pEntry, strip));
+    }
+    if(status != HAL_OK)
+    {
+      break;
+    }
+    pending = 1U;
+    half ^= 1U;
+  }
+
+  if(pending != 0U)
+  {
+    if(HAL_DMA2D_PollForTransfer(&hdma2d_asset, ASSET_DMA2D_TIMEOUT) != HAL_OK)
+    {
+      status = HAL_ERROR;
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Draw a whole decoded glyph or image in one DMA2D transfer
+  * @param  pEntry: Asset entry
+  * @param  Format: ASSET_FORMAT_xxx of pData
+  * @param  pData: Decoded lines, without padding, cleaned from the D-cache
+  * @param  pTarget: Framebuffer
+  * @param  Xpos: Column of the top left corner
+  * @param  Ypos: Line of the top left corner
+  * @param  Color: ARGB8888 color of A8 and A4 assets, unused otherwise
+  * @retval HAL_OK, or HAL_ERROR if the asset is outside the target area or
+  *         on DMA2D error
+  */
+HAL_StatusTypeDef ASSET_DrawDecoded(const ASSET_EntryTypeDef *pEntry, uint32_t Format, const uint8_t *pData,
+                                    const ASSET_TargetTypeDef *pTarget, uint32_t Xpos, uint32_t Ypos,
+                                    uint32_t Color)
+{
+  HAL_StatusTypeDef status;
+  uint32_t pixel_size = (pTarget->ColorMode == DMA2D_OUTPUT_RGB565) ? 2U : 4U;
+  uint32_t address;
+
+  if((pEntry->Width == 0U) || (pEntry->Height == 0U))
+  {
+    return HAL_OK;
+  }
+
+  if(((Xpos + pEntry->Width) > pTarget->Width) || ((Ypos + pEntry->Height) > pTarget->Height) ||
+     (Asset_ConfigDMA2D(Format, pEntry->Width, pTarget, Color) != HAL_OK))
+  {
+    return HAL_ERROR;
+  }
+
+  address = pTarget->Address + (pixel_size * ((pTarget->Pitch * Ypos) + Xpos));
+  if(Format == ASSET_FORMAT_RGB565)
+  {
+    status = HAL_DMA2D_Start(&hdma2d_asset, (uint32_t)pData, address, pEntry->Width, pEntry->Height);
+  }
+  else
+  {
+    status = HAL_DMA2D_BlendingStart(&hdma2d_asset, (uint32_t)pData, address, address,
+                                     pEntry->Width, pEntry->Height);
+  }
+  if(status == HAL_OK)
+  {
+    status = HAL_DMA2D_PollForTransfer(&hdma2d_asset, ASSET_DMA2D_TIMEOUT * ASSET_GetStripCount(pEntry));
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Draw a UTF-8 string with the glyphs of a pack
+  * @note   '\n' starts a new line. Characters missing in the pack are drawn
+  *         with the U+FFFD glyph when the pack has one.
+  * @param  pPack: Pack opened by ASSET_Init()
+  * @param  pTarget: Framebuffer
+  * @param  Xpos: Column of the pen at the start of each line
+  * @param  Ypos: Line of the top of the first text line
+  * @param  pText: Null terminated UTF-8 string
+  * @param  Color: ARGB8888 text color
+  * @retval HAL_OK, or HAL_ERROR if a character is missing or was not drawn
+  */
+HAL_StatusTypeDef ASSET_DrawString(const ASSET_PackTypeDef *pPack, const ASSET_TargetTypeDef *pTarget,
+                                   uint32_t Xpos, uint32_t Ypos, const char *pText, uint32_t Color)
+{
+  const uint8_t *ptext = (const uint8_t *)pText;
+  const ASSET_EntryTypeDef *pentry;
+  HAL_StatusTypeDef status = HAL_OK;
+  int32_t pen_x = (int32_t)Xpos;
+  int32_t baseline = (int32_t)(Ypos + pPack->Ascent);
+  int32_t x, y;
+  uint32_t code;
+
+  while(*ptext != 0U)
+  {
+    code = ASSET_NextCodePoint(&ptext);
+
+    if(code == (uint32_t)'\n')
+    {
+      pen_x = (int32_t)Xpos;
+      baseline += (int32_t)pPack->LineHeight;
+      continue;
+    }
+
+    pentry = ASSET_Find(pPack, code);
+    if(pentry == NULL)
+    {
+      status = HAL_ERROR;
+      pentry = ASSET_Find(pPack, ASSET_REPLACEMENT_CHAR);
+      if(pentry == NULL)
+      {
+        continue;
+      }
+    }
+
+    x = pen_x + pentry->BearingX;
+    y = baseline - pentry->BearingY;
+    if((x < 0) || (y < 0) ||
+       (ASSET_Draw(pPack, pentry, pTarget, (uint32_t)x, (uint32_t)y, Color) != HAL_OK))
+    {
+      status = HAL_ERROR;
+    }
+    pen_x += pentry->Advance;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Read the next code point of a UTF-8 string
+  * @param  ppText: Pointer to the string position, moved after the character
+  * @retval Code point, U+FFFD for an invalid sequence
+  */
+uint32_t ASSET_NextCodePoint(const uint8_t **ppText)
+{
+  const uint8_t *ptext = *ppText;
+  uint32_t code = *ptext++;
+  uint32_t extra = 0U;
+
+  if(code >= 0xF0U)
+  {
+    code &= 0x07U;
+    extra = 3U;
+  }
+  else if(code >= 0xE0U)
+  {
+    code &= 0x0FU;
+    extra = 2U;
+  }
+  else if(code >= 0xC0U)
+  {
+    code &= 0x1FU;
+    extra = 1U;
+  }
+  else if(code >= 0x80U)
+  {
+    code = ASSET_REPLACEMENT_CHAR;
+  }
+
+  while((extra > 0U) && ((*ptext & 0xC0U) == 0x80U))
+  {
+    code = (code << 6) | (*ptext++ & 0x3FU);
+    extra--;
+  }
+  if(extra != 0U)
+  {
+    code = ASSET_REPLACEMENT_CHAR;
+  }
+
+  *ppText = ptext;
+  return code;
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Number of lines of a strip
+  * @param  pEntry: Asset entry
+  * @param  Strip: Strip index, lower than the strip count
+  * @retval Lines
+  */
+static uint32_t Asset_StripLines(const ASSET_EntryTypeDef *pEntry, uint32_t Strip)
+{
+  uint32_t remaining = pEntry->Height - (Strip * pEntry->StripLines);
+
+  return (remaining < pEntry->StripLines) ? remaining : pEntry->StripLines;
+}
+
+/**
+  * @brief  Decoded size of lines of an asset
+  * @param  pEntry: Asset entry
+  * @param  Lines: Number of lines
+  * @retval Size in bytes
+  */
+static uint32_t Asset_StripSize(const ASSET_EntryTypeDef *pEntry, uint32_t Lines)
+{
+  uint32_t pixels = Lines * pEntry->Width;
+
+  switch(pEntry->Format)
+  {
+  case ASSET_FORMAT_A4:
+    return (pixels + 1U) / 2U;
+  case ASSET_FORMAT_RGB565:
+    return pixels * 2U;
+  case ASSET_FORMAT_ARGB8888:
+    return pixels * 4U;
+  default:
+    return pixels;
+  }
+}
+
+/**
+  * @brief  Decode a PackBits stream: a control byte below 128 is followed by
+  *         (control + 1) literal bytes, otherwise the next byte is repeated
+  *         (control - 125) times
+  * @param  pSrc: Compressed strip
+  * @param  SrcSize: Compressed size
+  * @param  pDst: Decoded strip
+  * @param  DstSize: Size of pDst
+  * @retval Decoded size, 0 on corrupted data
+  */
+static uint32_t Asset_DecodeRLE(const uint8_t *pSrc, uint32_t SrcSize, uint8_t *pDst, uint32_t DstSize)
+{
+  uint32_t in = 0U, out = 0U, count;
+  uint8_t control;
+
+  while(in < SrcSize)
+  {
+    control = pSrc[in++];
+    if(control < 128U)
+    {
+      count = (uint32_t)control + 1U;
+      if((count > (SrcSize - in)) || (count > (DstSize - out)))
+      {
+        return 0U;
+      }
+      memcpy(&pDst[out], &pSrc[in], count);
+      in += count;
+    }
+    else
+    {
+      count = (uint32_t)control - 125U;
+      if((in >= SrcSize) || (count > (DstSize - out)))
+      {
+        return 0U;
+      }
+      memset(&pDst[out], pSrc[in++], count);
+    }
+    out += count;
+  }
+
+  return out;
+}
+
+/**
+  * @brief  Decode an LZ4 block
+  * @param  pSrc: Compressed strip
+  * @param  SrcSize: Compressed size
+  * @param  pDst: Decoded strip
+  * @param  DstSize: Size of pDst
+  * @retval Decoded size, 0 on corrupted data
+  */
+static uint32_t Asset_DecodeLZ4(const uint8_t *pSrc, uint32_t SrcSize, uint8_t *pDst, uint32_t DstSize)
+{
+  const uint8_t *pend = pSrc + SrcSize;
+  uint32_t out = 0U, length, offset;
+  uint8_t token, byte;
+
+  while(pSrc < pend)
+  {
+    token = *pSrc++;
+
+    /* Literals */
+    length = (uint32_t)token >> 4;
+    if(length == 15U)
+    {
+      do
+      {
+        if(pSrc >= pend)
+        {
+          return 0U;
+        }
+        byte = *pSrc++;
+        length += byte;
+      } while(byte == 255U);
+    }
+    if((length > (uint32_t)(pend - pSrc)) || (length > (DstSize - out)))
+    {
+      return 0U;
+    }
+    memcpy(&pDst[out], pSrc, length);
+    pSrc += length;
+    out += length;
+
+    /* The last sequence has no match */
+    if(pSrc == pend)
+    {
+      break;
+    }
+
+    /* Match */
+    if((pend - pSrc) < 2)
+    {
+      return 0U;
+    }
+    offset = (uint32_t)pSrc[0] | ((uint32_t)pSrc[1] << 8);
+    pSrc += 2;
+    if((offset == 0U) || (offset > out))
+    {
+      return 0U;
+    }
+    length = (uint32_t)token & 0x0FU;
+    if(length == 15U)
+    {
+      do
+      {
+        if(pSrc >= pend)
+        {
+          return 0U;
+        }
+        byte = *pSrc++;
+        length += byte;
+      } while(byte == 255U);
+    }
+    length += 4U;
+    if(length > (DstSize - out))
+    {
+      return 0U;
+    }
+
+    /* Byte copy: the match may overlap the bytes it produces */
+    while(length > 0U)
+    {
+      pDst[out] = pDst[out - offset];
+      out++;
+      length--;
+    }
+  }
+
+  return out;
+}
+
+/**
+  * @brief  Configure the DMA2D for the strips of an asset
+  * @param  Format: ASSET_FORMAT_xxx of the decoded pixels
+  * @param  Width: Asset width, in pixels
+  * @param  pTarget: Framebuffer
+  * @param  Color: ARGB8888 color of A8 and A4 assets
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef Asset_ConfigDMA2D(uint32_t Format, uint32_t Width, const ASSET_TargetTypeDef *pTarget,
+                                           uint32_t Color)
+{
+  hdma2d_asset.Init.ColorMode    = pTarget->ColorMode;
+  hdma2d_asset.Init.OutputOffset = pTarget->Pitch - Width;
+
+  /* Foreground: the decoded strip */
+  hdma2d_asset.LayerCfg[1].InputOffset = 0U;
+  hdma2d_asset.LayerCfg[1].AlphaMode   = DMA2D_NO_MODIF_ALPHA;
+  hdma2d_asset.LayerCfg[1].InputAlpha  = 0xFFU;
+  switch(Format)
+  {
+  case ASSET_FORMAT_A8:
+    hdma2d_asset.LayerCfg[1].InputColorMode = DMA2D_INPUT_A8;
+    hdma2d_asset.LayerCfg[1].InputAlpha     = Color;
+    break;
+  case ASSET_FORMAT_A4:
+    hdma2d_asset.LayerCfg[1].InputColorMode = DMA2D_INPUT_A4;
+    hdma2d_asset.LayerCfg[1].InputAlpha     = Color;
+    break;
+  case ASSET_FORMAT_RGB565:
+    hdma2d_asset.LayerCfg[1].InputColorMode = DMA2D_INPUT_RGB565;
+    break;
+  case ASSET_FORMAT_ARGB8888:
+    hdma2d_asset.LayerCfg[1].InputColorMode = DMA2D_INPUT_ARGB8888;
+    break;
+  default:
+    return HAL_ERROR;
+  }
+
+  if(Format == ASSET_FORMAT_RGB565)
+  {
+    hdma2d_asset.Init.Mode = DMA2D_M2M_PFC;
+  }
+  else
+  {
+    /* Background: the framebuffer, input and output color modes share their values */
+    hdma2d_asset.Init.Mode                   = DMA2D_M2M_BLEND;
+    hdma2d_asset.LayerCfg[0].InputOffset     = pTarget->Pitch - Width;
+    hdma2d_asset.LayerCfg[0].InputColorMode  = pTarget->ColorMode;
+    hdma2d_asset.LayerCfg[0].AlphaMode       = DMA2D_NO_MODIF_ALPHA;
+    hdma2d_asset.LayerCfg[0].InputAlpha      = 0xFFU;
+  }
+
+  if((HAL_DMA2D_Init(&hdma2d_asset) != HAL_OK) ||
+     (HAL_DMA2D_ConfigLayer(&hdma2d_asset, 1U) != HAL_OK))
+  {
+    return HAL_ERROR;
+  }
+  if(hdma2d_asset.Init.Mode == DMA2D_M2M_BLEND)
+  {
+    return HAL_DMA2D_ConfigLayer(&hdma2d_asset, 0U);
+  }
+
+  return HAL_OK;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
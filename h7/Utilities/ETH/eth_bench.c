@@ -0,0 +1,692 @@
+/**
+  ******************************************************************************
+  * @file    eth_bench.c
+  * @author  MCD Application Team
+  * @brief   Raw Ethernet throughput and latency benchmark
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- bring the ETH up as the application does (HAL_ETH_Init(), Rx buffers
+   with HAL_ETH_DescAssignMemory(), PHY link through the lan8742 component or
+   the BSP), and start it in the mode measured :
+     - polling: HAL_ETH_Start(), frames sent with HAL_ETH_Transmit()
+     - interrupt: HAL_ETH_Start_IT(), frames sent with HAL_ETH_Transmit_IT()
+       from a pool of ETH_TX_DESC_CNT buffers, and
+       ETH_Bench_RxEvent() called from HAL_ETH_RxCpltCallback()
+   With ETH_BENCH_PROFILER, bracket HAL_ETH_IRQHandler() with
+   CPU_ProfileIrqEnter(ETH_IRQn) and CPU_ProfileIrqExit(ETH_IRQn) (cpu_utils)
+   so that the interrupt time is in the CPU load.
+
+2- on one board, ETH_Bench_Init() with ETH_BENCH_ROLE_REFLECTOR: each frame
+   of EtherType ETH_BENCH_ETHERTYPE received is sent back, addresses
+   swapped. On the other one, ETH_BENCH_ROLE_GENERATOR with the address of
+   the reflector: FrameSize bytes frames are sent at Rate frames per second
+   (0: as fast as Tx descriptors free up), each with a sequence number and
+   the cycle counter value when sent.
+
+3- ETH_Bench_Run() runs for Duration ms (the generator waits
+   ETH_BENCH_DRAIN_MS more for the last frames) and fills the result :
+     - frames per second sent and received, received throughput
+     - CPU load: cycles spent in the driver calls which sent or received a
+       frame, plus the ETH interrupt with ETH_BENCH_PROFILER, over the run
+       time; idle polls are not counted
+     - generator: round trip latency min, mean, max and histogram, frames
+       lost and reordered
+   The run does not return before the end: call it from the main loop or a
+   task of its own, with the same settings on both boards.
+
+4- ETH_Bench_Report() formats the configuration and the result as a JSON
+   document to send over a console and compare between driver changes,
+   descriptor counts or board settings.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "eth_bench.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#if (ETH_BENCH_PROFILER == 1U)
+#include "cpu_utils.h"
+#endif
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Frame layout: addresses, EtherType, then the benchmark header */
+#define ETH_BENCH_OFS_TYPE        12U
+#define ETH_BENCH_OFS_MAGIC       14U
+#define ETH_BENCH_OFS_SEQUENCE    18U
+#define ETH_BENCH_OFS_STAMP       22U
+#define ETH_BENCH_HEADER_SIZE     26U
+
+#define ETH_BENCH_MAGIC           0x45424E43U
+
+/* Private macro -------------------------------------------------------------*/
+#define ETH_BENCH_CYCLES()        (DWT->CYCCNT)
+
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static HAL_StatusTypeDef ETH_Bench_Send(ETH_BenchTypeDef *hbench);
+static void     ETH_Bench_Process(ETH_BenchTypeDef *hbench, const uint8_t *pFrame, uint32_t Length);
+static void     ETH_Bench_Reflect(ETH_BenchTypeDef *hbench, const uint8_t *pFrame, uint32_t Length);
+static void     ETH_Bench_Latency(ETH_BenchTypeDef *hbench, uint32_t Cycles);
+static uint64_t ETH_Bench_IrqCycles(void);
+static void     ETH_Bench_Put32(uint8_t *pDest, uint32_t Value);
+static uint32_t ETH_Bench_Get32(const uint8_t *pSrc);
+static void     ETH_Bench_Append(char *pBuffer, uint32_t Size, uint32_t *pLength, const char *pFormat, ...);
+static uint8_t *ETH_Bench_TxBuffer(ETH_BenchTypeDef *hbench);
+static HAL_StatusTypeDef ETH_Bench_TxSend(ETH_BenchTypeDef *hbench, uint8_t *pFrame, uint32_t Length);
+static uint8_t *ETH_Bench_RxGet(ETH_BenchTypeDef *hbench, uint32_t *pLength);
+static void     ETH_Bench_RxRelease(ETH_BenchTypeDef *hbench);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Check the settings and start the cycle counter
+  * @param  hbench: benchmark context, kept by the module
+  * @param  pConfig: ETH handle, role, mode and traffic, copied
+  * @retval HAL status
+  */
+HAL_StatusTypeDef ETH_Bench_Init(ETH_BenchTypeDef *hbench, const ETH_Bench_ConfigTypeDef *pConfig)
+{
+  if ((hbench == NULL) || (pConfig == NULL) || (pConfig->heth == NULL) || (pConfig->Duration == 0U) ||
+      (pConfig->Role > ETH_BENCH_ROLE_REFLECTOR) || (pConfig->Mode > ETH_BENCH_MODE_IT) ||
+      (pConfig->FrameSize < ETH_BENCH_FRAME_MIN) || (pConfig->FrameSize > ETH_BENCH_FRAME_MAX) ||
+      (pConfig->FrameSize > ETH_BENCH_BUFFER_SIZE) || (pConfig->pTxBuffers == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  memset(hbench, 0, sizeof(ETH_BenchTypeDef));
+  hbench->Config = *pConfig;
+
+  /* Enable the DWT cycle counter */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#if (__CORTEX_M == 7U)
+  DWT->LAR = 0xC5ACCE55U;
+#endif
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Run the benchmark for the configured duration
+  * @param  hbench: benchmark context
+  * @param  pResult: result of the run, may be NULL
+  * @retval HAL status
+  */
+HAL_StatusTypeDef ETH_Bench_Run(ETH_BenchTypeDef *hbench, ETH_Bench_ResultTypeDef *pResult)
+{
+  ETH_Bench_ResultTypeDef *result;
+  const uint8_t *frame;
+  uint64_t elapsed = 0U;
+  uint64_t irqcycles;
+  uint32_t interval = 0U;
+  uint32_t runtime;
+  uint32_t tickstart;
+  uint32_t length;
+  uint32_t next;
+  uint32_t last;
+  uint32_t now;
+  uint32_t start;
+  HAL_StatusTypeDef status;
+
+  if ((hbench == NULL) || (hbench->Config.heth == NULL))
+  {
+    return HAL_ERROR;
+  }
+  result = &hbench->Result;
+
+  memset(result, 0, sizeof(ETH_Bench_ResultTypeDef));
+  result->LatencyMin = 0xFFFFFFFFU;
+  hbench->RxEvents   = 0U;
+  hbench->TxSequence = 0U;
+  hbench->RxSequence = 0U;
+  hbench->TxIndex    = 0U;
+  hbench->LatencySum = 0U;
+  hbench->RxBytes    = 0U;
+  hbench->BusyCycles = 0U;
+
+  if (hbench->Config.Rate != 0U)
+  {
+    interval = SystemCoreClock / hbench->Config.Rate;
+  }
+  runtime = hbench->Config.Duration;
+  if (hbench->Config.Role == ETH_BENCH_ROLE_GENERATOR)
+  {
+    runtime += ETH_BENCH_DRAIN_MS;
+  }
+
+  irqcycles = ETH_Bench_IrqCycles();
+  tickstart = HAL_GetTick();
+  last = ETH_BENCH_CYCLES();
+  next = last;
+
+  while ((HAL_GetTick() - tickstart) < runtime)
+  {
+    now = ETH_BENCH_CYCLES();
+    elapsed += now - last;
+    last = now;
+
+    /* Generator: next frame when due, no burst to catch up a late start */
+    if ((hbench->Config.Role == ETH_BENCH_ROLE_GENERATOR) &&
+        ((HAL_GetTick() - tickstart) < hbench->Config.Duration) &&
+        ((interval == 0U) || ((int32_t)(now - next) >= 0)))
+    {
+      start = ETH_BENCH_CYCLES();
+      status = ETH_Bench_Send(hbench);
+      if (status != HAL_BUSY)
+      {
+        hbench->BusyCycles += ETH_BENCH_CYCLES() - start;
+        next += interval;
+        if ((int32_t)(now - next) > (int32_t)interval)
+        {
+          next = now;
+        }
+      }
+    }
+
+    /* Receive: descriptors polled, or after a receive interrupt */
+    if ((hbench->Config.Mode == ETH_BENCH_MODE_POLLING) || (hbench->RxEvents != 0U))
+    {
+      hbench->RxEvents = 0U;
+      for (;;)
+      {
+        start = ETH_BENCH_CYCLES();
+        frame = ETH_Bench_RxGet(hbench, &length);
+        if (frame == NULL)
+        {
+          break;
+        }
+        ETH_Bench_Process(hbench, frame, length);
+        ETH_Bench_RxRelease(hbench);
+        hbench->BusyCycles += ETH_BENCH_CYCLES() - start;
+      }
+    }
+  }
+  elapsed += ETH_BENCH_CYCLES() - last;
+  irqcycles = ETH_Bench_IrqCycles() - irqcycles;
+
+  /* Rates over the sending time */
+  result->TxFps  = (uint32_t)(((uint64_t)result->TxFrames * 1000U) / hbench->Config.Duration);
+  result->RxFps  = (uint32_t)(((uint64_t)result->RxFrames * 1000U) / hbench->Config.Duration);
+  result->RxKbps = (uint32_t)((hbench->RxBytes * 8U) / hbench->Config.Duration);
+  if (elapsed != 0U)
+  {
+    result->CpuLoad = (uint32_t)(((hbench->BusyCycles + irqcycles) * 1000U) / elapsed);
+  }
+  if (result->CpuLoad > 1000U)
+  {
+    result->CpuLoad = 1000U;
+  }
+
+  if (hbench->Config.Role == ETH_BENCH_ROLE_GENERATOR)
+  {
+    if (result->TxFrames > result->RxFrames)
+    {
+      result->Lost = result->TxFrames - result->RxFrames;
+    }
+    if (result->RxFrames != 0U)
+    {
+      result->LatencyMean = (uint32_t)(((hbench->LatencySum / result->RxFrames) * 1000000000U) / SystemCoreClock);
+    }
+  }
+  if (result->LatencyMin == 0xFFFFFFFFU)
+  {
+    result->LatencyMin = 0U;
+  }
+
+  if (pResult != NULL)
+  {
+    *pResult = *result;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Format the configuration and result of the last run in JSON
+  * @param  hbench: benchmark context
+  * @param  pBuffer: text buffer
+  * @param  Size: size of pBuffer in bytes
+  * @retval Length of the text, 0 when it does not fit
+  */
+uint32_t ETH_Bench_Report(const ETH_BenchTypeDef *hbench, char *pBuffer, uint32_t Size)
+{
+  const ETH_Bench_ResultTypeDef *result;
+  uint32_t length = 0U;
+  uint32_t bin;
+
+  if ((hbench == NULL) || (pBuffer == NULL) || (Size == 0U))
+  {
+    return 0U;
+  }
+  result = &hbench->Result;
+
+  ETH_Bench_Append(pBuffer, Size, &length,
+                   "{\"hal\":\"0x%08lx\",\"core\":%lu,\"role\":\"%s\",\"mode\":\"%s\",\"size\":%lu,\"rate\":%lu,"
+                   "\"duration\":%lu,",
+                   (unsigned long)HAL_GetHalVersion(), (unsigned long)SystemCoreClock,
+                   (hbench->Config.Role == ETH_BENCH_ROLE_GENERATOR) ? "generator" : "reflector",
+                   (hbench->Config.Mode == ETH_BENCH_MODE_IT) ? "it" : "polling",
+                   (unsigned long)hbench->Config.FrameSize, (unsigned long)hbench->Config.Rate,
+                   (unsigned long)hbench->Config.Duration);
+  ETH_Bench_Append(pBuffer, Size, &length,
+                   "\"tx\":%lu,\"rx\":%lu,\"lost\":%lu,\"reordered\":%lu,\"ignored\":%lu,\"txbusy\":%lu,"
+                   "\"errors\":%lu,\"txfps\":%lu,\"rxfps\":%lu,\"rxkbps\":%lu,\"cpuload\":%lu,",
+                   (unsigned long)result->TxFrames, (unsigned long)result->RxFrames,
+                   (unsigned long)result->Lost, (unsigned long)result->Reordered,
+                   (unsigned long)result->Ignored, (unsigned long)result->TxBusy,
+                   (unsigned long)result->Errors, (unsigned long)result->TxFps,
+                   (unsigned long)result->RxFps, (unsigned long)result->RxKbps,
+                   (unsigned long)result->CpuLoad);
+  ETH_Bench_Append(pBuffer, Size, &length,
+                   "\"latency\":{\"min\":%lu,\"max\":%lu,\"mean\":%lu,\"shift\":%lu,\"hist\":[",
+                   (unsigned long)result->LatencyMin, (unsigned long)result->LatencyMax,
+                   (unsigned long)result->LatencyMean, (unsigned long)ETH_BENCH_HIST_SHIFT);
+  for (bin = 0U; bin < ETH_BENCH_HIST_BINS; bin++)
+  {
+    ETH_Bench_Append(pBuffer, Size, &length, "%s%lu", (bin != 0U) ? "," : "",
+                     (unsigned long)result->LatencyHist[bin]);
+  }
+  ETH_Bench_Append(pBuffer, Size, &length, "]}}\n");
+
+  if (length >= Size)
+  {
+    pBuffer[Size - 1U] = '\0';
+    return 0U;
+  }
+
+  return length;
+}
+
+/**
+  * @brief  Receive interrupt notification, in interrupt mode
+  * @note   To be called from HAL_ETH_RxCpltCallback().
+  * @param  hbench: benchmark context
+  * @retval None
+  */
+void ETH_Bench_RxEvent(ETH_BenchTypeDef *hbench)
+{
+  hbench->RxEvents++;
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Send the next generator frame
+  * @param  hbench: benchmark context
+  * @retval HAL_BUSY when no Tx descriptor is free
+  */
+static HAL_StatusTypeDef ETH_Bench_Send(ETH_BenchTypeDef *hbench)
+{
+  uint8_t *frame;
+
+  frame = ETH_Bench_TxBuffer(hbench);
+  if (frame == NULL)
+  {
+    hbench->Result.TxBusy++;
+    return HAL_BUSY;
+  }
+
+  memcpy(&frame[0], hbench->Config.PeerAddr, 6U);
+  memcpy(&frame[6], hbench->Config.heth->Init.MACAddr, 6U);
+  frame[ETH_BENCH_OFS_TYPE]      = (uint8_t)(ETH_BENCH_ETHERTYPE >> 8U);
+  frame[ETH_BENCH_OFS_TYPE + 1U] = (uint8_t)ETH_BENCH_ETHERTYPE;
+  ETH_Bench_Put32(&frame[ETH_BENCH_OFS_MAGIC], ETH_BENCH_MAGIC);
+  ETH_Bench_Put32(&frame[ETH_BENCH_OFS_SEQUENCE], hbench->TxSequence);
+  ETH_Bench_Put32(&frame[ETH_BENCH_OFS_STAMP], ETH_BENCH_CYCLES());
+
+  if (ETH_Bench_TxSend(hbench, frame, hbench->Config.FrameSize) != HAL_OK)
+  {
+    hbench->Result.Errors++;
+    return HAL_ERROR;
+  }
+  hbench->TxSequence++;
+  hbench->Result.TxFrames++;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Account a frame received, reflect it or time it
+  * @param  hbench: benchmark context
+  * @param  pFrame: frame received
+  * @param  Length: frame length, FCS excluded
+  * @retval None
+  */
+static void ETH_Bench_Process(ETH_BenchTypeDef *hbench, const uint8_t *pFrame, uint32_t Length)
+{
+  uint32_t sequence;
+
+  if ((Length < ETH_BENCH_HEADER_SIZE) ||
+      (pFrame[ETH_BENCH_OFS_TYPE] != (uint8_t)(ETH_BENCH_ETHERTYPE >> 8U)) ||
+      (pFrame[ETH_BENCH_OFS_TYPE + 1U] != (uint8_t)ETH_BENCH_ETHERTYPE) ||
+      (ETH_Bench_Get32(&pFrame[ETH_BENCH_OFS_MAGIC]) != ETH_BENCH_MAGIC))
+  {
+    hbench->Result.Ignored++;
+    return;
+  }
+  hbench->Result.RxFrames++;
+  hbench->RxBytes += Length;
+
+  if (hbench->Config.Role == ETH_BENCH_ROLE_REFLECTOR)
+  {
+    ETH_Bench_Reflect(hbench, pFrame, Length);
+    return;
+  }
+
+  ETH_Bench_Latency(hbench, ETH_BENCH_CYCLES() - ETH_Bench_Get32(&pFrame[ETH_BENCH_OFS_STAMP]));
+
+  /* A gap is counted as lost at the end of the run, a frame back after a
+     later one as reordered */
+  sequence = ETH_Bench_Get32(&pFrame[ETH_BENCH_OFS_SEQUENCE]);
+  if ((int32_t)(sequence - hbench->RxSequence) < 0)
+  {
+    hbench->Result.Reordered++;
+  }
+  else
+  {
+    hbench->RxSequence = sequence + 1U;
+  }
+}
+
+/**
+  * @brief  Send a frame back to its source
+  * @param  hbench: benchmark context
+  * @param  pFrame: frame received
+  * @param  Length: frame length, FCS excluded
+  * @retval None
+  */
+static void ETH_Bench_Reflect(ETH_BenchTypeDef *hbench, const uint8_t *pFrame, uint32_t Length)
+{
+  uint8_t *frame;
+
+  frame = ETH_Bench_TxBuffer(hbench);
+  if ((frame == NULL) || (Length > ETH_BENCH_BUFFER_SIZE))
+  {
+    hbench->Result.TxBusy++;
+    return;
+  }
+
+  memcpy(&frame[0], &pFrame[6], 6U);
+  memcpy(&frame[6], hbench->Config.heth->Init.MACAddr, 6U);
+  memcpy(&frame[12], &pFrame[12], Length - 12U);
+
+  if (ETH_Bench_TxSend(hbench, frame, Length) != HAL_OK)
+  {
+    hbench->Result.Errors++;
+    return;
+  }
+  hbench->Result.TxFrames++;
+}
+
+/**
+  * @brief  Account a round trip
+  * @param  hbench: benchmark context
+  * @param  Cycles: round trip in core clock cycles
+  * @retval None
+  */
+static void ETH_Bench_Latency(ETH_BenchTypeDef *hbench, uint32_t Cycles)
+{
+  ETH_Bench_ResultTypeDef *result = &hbench->Result;
+  uint32_t ns = (uint32_t)(((uint64_t)Cycles * 1000000000U) / SystemCoreClock);
+  uint32_t scaled = ns >> ETH_BENCH_HIST_SHIFT;
+  uint32_t bin = 0U;
+
+  hbench->LatencySum += Cycles;
+  if (ns < result->LatencyMin)
+  {
+    result->LatencyMin = ns;
+  }
+  if (ns > result->LatencyMax)
+  {
+    result->LatencyMax = ns;
+  }
+
+  while ((scaled != 0U) && (bin < (ETH_BENCH_HIST_BINS - 1U)))
+  {
+    bin++;
+    scaled >>= 1U;
+  }
+  result->LatencyHist[bin]++;
+}
+
+/**
+  * @brief  Cycles spent in the ETH interrupt, from the CPU profiler
+  * @param  None
+  * @retval Cumulative cycles, 0 without ETH_BENCH_PROFILER
+  */
+static uint64_t ETH_Bench_IrqCycles(void)
+{
+#if (ETH_BENCH_PROFILER == 1U)
+  CPU_ProfileTypeDef profile;
+  uint32_t i;
+
+  for (i = 0U; i < CPU_PROFILE_MAX_IRQS; i++)
+  {
+    if ((CPU_ProfileGetIrq(i, &profile) != 0U) && (profile.Id == (uint32_t)((int32_t)ETH_IRQn + 16)))
+    {
+      return profile.Cycles;
+    }
+  }
+#endif
+
+  return 0U;
+}
+
+/**
+  * @brief  Write a 32-bit value, any alignment
+  * @param  pDest: destination
+  * @param  Value: value
+  * @retval None
+  */
+static void ETH_Bench_Put32(uint8_t *pDest, uint32_t Value)
+{
+  pDest[0] = (uint8_t)Value;
+  pDest[1] = (uint8_t)(Value >> 8U);
+  pDest[2] = (uint8_t)(Value >> 16U);
+  pDest[3] = (uint8_t)(Value >> 24U);
+}
+
+/**
+  * @brief  Read a 32-bit value, any alignment
+  * @param  pSrc: source
+  * @retval Value
+  */
+static uint32_t ETH_Bench_Get32(const uint8_t *pSrc)
+{
+  return (uint32_t)pSrc[0] | ((uint32_t)pSrc[1] << 8U) | ((uint32_t)pSrc[2] << 16U) | ((uint32_t)pSrc[3] << 24U);
+}
+
+/**
+  * @brief  Append formatted text to the report
+  * @param  pBuffer: text buffer
+  * @param  Size: size of pBuffer
+  * @param  pLength: text length so far, updated even when the text overflows
+  * @param  pFormat: printf format
+  * @retval None
+  */
+static void ETH_Bench_Append(char *pBuffer, uint32_t Size, uint32_t *pLength, const char *pFormat, ...)
+{
+  va_list args;
+  int     written;
+
+  va_start(args, pFormat);
+  if (*pLength < Size)
+  {
+    written = vsnprintf(&pBuffer[*pLength], Size - *pLength, pFormat, args);
+  }
+  else
+  {
+    written = vsnprintf(NULL, 0, pFormat, args);
+  }
+  va_end(args);
+
+  if (written > 0)
+  {
+    *pLength += (uint32_t)written;
+  }
+}
+
+/**
+  * @brief  Next Tx buffer of the pool, when the DMA has released it
+  * @note   The buffers are used in turn, one per frame: the next one is the
+  *         oldest, free once less than ETH_TX_DESC_CNT frames are in flight.
+  * @param  hbench: benchmark context
+  * @retval Buffer, NULL when all the Tx descriptors are in use
+  */
+static uint8_t *ETH_Bench_TxBuffer(ETH_BenchTypeDef *hbench)
+{
+  ETH_HandleTypeDef *heth = hbench->Config.heth;
+
+  if (hbench->Config.Mode == ETH_BENCH_MODE_POLLING)
+  {
+    /* HAL_ETH_Transmit() returns once the frame is sent */
+    return hbench->Config.pTxBuffers;
+  }
+
+  (void)HAL_ETH_ReleaseTxPackets(heth);
+  if (heth->TxDescList.TxDescInUse >= ETH_TX_DESC_CNT)
+  {
+    return NULL;
+  }
+
+  return &hbench->Config.pTxBuffers[hbench->TxIndex * ETH_BENCH_BUFFER_SIZE];
+}
+
+/**
+  * @brief  Hand the frame written in the next Tx buffer to the DMA
+  * @param  hbench: benchmark context
+  * @param  pFrame: buffer returned by ETH_Bench_TxBuffer()
+  * @param  Length: frame length, FCS excluded
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef ETH_Bench_TxSend(ETH_BenchTypeDef *hbench, uint8_t *pFrame, uint32_t Length)
+{
+  ETH_TxPacketConfig txconfig;
+  ETH_BufferTypeDef txbuffer;
+  HAL_StatusTypeDef status;
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  SCB_CleanDCache_by_Addr((uint32_t *)((uint32_t)pFrame & ~31U), (int32_t)(Length + ((uint32_t)pFrame & 31U)));
+#endif
+
+  memset(&txconfig, 0, sizeof(txconfig));
+  txbuffer.buffer = pFrame;
+  txbuffer.len    = Length;
+  txbuffer.next   = NULL;
+  txconfig.Attributes   = ETH_TX_PACKETS_FEATURES_CRCPAD;
+  txconfig.CRCPadCtrl   = ETH_CRC_PAD_INSERT;
+  txconfig.Length       = Length;
+  txconfig.TxBuffer     = &txbuffer;
+
+  if (hbench->Config.Mode == ETH_BENCH_MODE_POLLING)
+  {
+    return HAL_ETH_Transmit(hbench->Config.heth, &txconfig, ETH_BENCH_TX_TIMEOUT);
+  }
+
+  status = HAL_ETH_Transmit_IT(hbench->Config.heth, &txconfig);
+  if (status == HAL_OK)
+  {
+    hbench->TxIndex = (hbench->TxIndex + 1U) % ETH_TX_DESC_CNT;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Next frame received
+  * @note   A frame over several Rx buffers is dropped and counted as an error.
+  * @param  hbench: benchmark context
+  * @param  pLength: frame length
+  * @retval Frame, NULL when none is ready
+  */
+static uint8_t *ETH_Bench_RxGet(ETH_BenchTypeDef *hbench, uint32_t *pLength)
+{
+  ETH_HandleTypeDef *heth = hbench->Config.heth;
+  ETH_BufferTypeDef rxbuffer;
+
+  for (;;)
+  {
+    if (HAL_ETH_IsRxDataAvailable(heth) == 0U)
+    {
+      return NULL;
+    }
+
+    /* One buffer given to HAL_ETH_GetRxDataBuffer(): frames of one descriptor only */
+    if (heth->RxDescList.AppDescNbr == 1U)
+    {
+      break;
+    }
+    hbench->Result.Errors++;
+    ETH_Bench_RxRelease(hbench);
+  }
+
+  rxbuffer.next = NULL;
+  if ((HAL_ETH_GetRxDataBuffer(heth, &rxbuffer) != HAL_OK) ||
+      (HAL_ETH_GetRxDataLength(heth, pLength) != HAL_OK))
+  {
+    hbench->Result.Errors++;
+    ETH_Bench_RxRelease(hbench);
+    return NULL;
+  }
+
+  /* Without CRC stripping, the length counts the FCS */
+  if (((heth->Instance->MACCR & ETH_MACCR_CST) == 0U) && (*pLength >= 4U))
+  {
+    *pLength -= 4U;
+  }
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  SCB_InvalidateDCache_by_Addr((uint32_t *)((uint32_t)rxbuffer.buffer & ~31U),
+                               (int32_t)(*pLength + ((uint32_t)rxbuffer.buffer & 31U)));
+#endif
+
+  return rxbuffer.buffer;
+}
+
+/**
+  * @brief  Give the Rx descriptors of the last frame back to the DMA
+  * @param  hbench: benchmark context
+  * @retval None
+  */
+static void ETH_Bench_RxRelease(ETH_BenchTypeDef *hbench)
+{
+  (void)HAL_ETH_BuildRxDescriptors(hbench->Config.heth);
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,432 @@
+/**
+  ******************************************************************************
+  * @file    mcast_filter.c
+  * @author  MCD Application Team
+  * @brief   Multicast group filter on the ETH MAC perfect filter and hash table
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- initialize the ETH with HAL_ETH_Init(), and MCAST_Filter_Init() takes the
+   multicast filtering over: the MAC address registers 1 to 3, the hash
+   table and the pass all multicast, hash multicast and hash or perfect
+   filter bits of MACPFR. HAL_ETH_SetMACFilterConfig(), HAL_ETH_SetHashTable()
+   and HAL_ETH_SetSourceMACAddrMatch() are then no more called by the
+   application. Promiscuous mode stays with the application.
+
+2- MCAST_Filter_Add() and MCAST_Filter_Remove() join and leave multicast
+   groups, one call per user of a group (IGMP, MLD, PTP, industrial
+   protocol stacks...). Each call only writes the registers it changes :
+     - the first groups take the perfect filter slots, an exact match
+     - the next ones set a bit of the 64 bit hash table, the upper 6 bits of
+       the Ethernet CRC of the address: a few unwanted groups sharing the
+       bits may still be received, still far less than in all multicast
+     - a slot freed is given to a group of the hash table, and its hash bit
+       cleared once no more group uses it
+     - beyond MCAST_FILTER_ADDRS groups, all multicast packets are passed
+       until the groups over the limit are removed
+   The packets of other groups are dropped by the MAC, before using an Rx
+   descriptor or raising an interrupt.
+
+3- the module is not reentrant: calls from several tasks are serialized by
+   the application.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "mcast_filter.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define MCAST_FILTER_CRC_POLY     0xEDB88320U   /* Ethernet CRC, reflected */
+
+#define MCAST_FILTER_PFR_MASK     (ETH_MACPFR_PM | ETH_MACPFR_HMC | ETH_MACPFR_HPF)
+
+/* Private macro -------------------------------------------------------------*/
+/* High and low registers of MAC address n, n from 0 to 3 */
+#define MCAST_FILTER_MACAHR(__ETH__, __N__)   ((&(__ETH__)->MACA0HR)[2U * (__N__)])
+#define MCAST_FILTER_MACALR(__ETH__, __N__)   ((&(__ETH__)->MACA0LR)[2U * (__N__)])
+
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static MCAST_Filter_EntryTypeDef *MCAST_Filter_Find(MCAST_FilterTypeDef *hflt, const uint8_t *pAddr);
+static void MCAST_Filter_WriteSlot(MCAST_FilterTypeDef *hflt, uint32_t Slot, const uint8_t *pAddr);
+static void MCAST_Filter_HashSet(MCAST_FilterTypeDef *hflt, MCAST_Filter_EntryTypeDef *pEntry);
+static void MCAST_Filter_HashClear(MCAST_FilterTypeDef *hflt, MCAST_Filter_EntryTypeDef *pEntry);
+static void MCAST_Filter_Apply(MCAST_FilterTypeDef *hflt);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Take the multicast filtering of the MAC over, with no group
+  * @param  hflt: filter context, kept by the module
+  * @param  heth: ETH handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef MCAST_Filter_Init(MCAST_FilterTypeDef *hflt, ETH_HandleTypeDef *heth)
+{
+  if ((hflt == NULL) || (heth == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  hflt->heth = heth;
+  MCAST_Filter_Clear(hflt);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Join a multicast group
+  * @param  hflt: filter context
+  * @param  pAddr: group MAC address, 6 bytes
+  * @retval HAL_ERROR when pAddr is not a multicast address
+  */
+HAL_StatusTypeDef MCAST_Filter_Add(MCAST_FilterTypeDef *hflt, const uint8_t *pAddr)
+{
+  MCAST_Filter_EntryTypeDef *entry;
+  uint32_t i;
+
+  if ((hflt == NULL) || (pAddr == NULL) || ((pAddr[0] & 0x01U) == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  entry = MCAST_Filter_Find(hflt, pAddr);
+  if (entry != NULL)
+  {
+    entry->Users++;
+    return HAL_OK;
+  }
+
+  /* Free entry */
+  for (i = 0U; (i < MCAST_FILTER_ADDRS) && (hflt->Entries[i].Users != 0U); i++)
+  {
+  }
+  if (i == MCAST_FILTER_ADDRS)
+  {
+    hflt->Overflow++;
+    MCAST_Filter_Apply(hflt);
+    return HAL_OK;
+  }
+  entry = &hflt->Entries[i];
+  for (i = 0U; i < 6U; i++)
+  {
+    entry->Addr[i] = pAddr[i];
+  }
+  entry->Users = 1U;
+  entry->Hash  = (uint8_t)MCAST_Filter_Hash(pAddr);
+  entry->Slot  = 0U;
+  hflt->Count++;
+
+  /* Perfect filter slot first, else hash table */
+  for (i = 0U; (i < MCAST_FILTER_SLOTS) && (hflt->SlotUsed[i] != 0U); i++)
+  {
+  }
+  if (i < MCAST_FILTER_SLOTS)
+  {
+    hflt->SlotUsed[i] = 1U;
+    entry->Slot = (uint8_t)(i + 1U);
+    MCAST_Filter_WriteSlot(hflt, entry->Slot, pAddr);
+  }
+  else
+  {
+    MCAST_Filter_HashSet(hflt, entry);
+  }
+  MCAST_Filter_Apply(hflt);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Leave a multicast group
+  * @param  hflt: filter context
+  * @param  pAddr: group MAC address, 6 bytes
+  * @retval HAL_ERROR when the group was not joined
+  */
+HAL_StatusTypeDef MCAST_Filter_Remove(MCAST_FilterTypeDef *hflt, const uint8_t *pAddr)
+{
+  MCAST_Filter_EntryTypeDef *entry;
+  uint32_t slot;
+  uint32_t i;
+
+  if ((hflt == NULL) || (pAddr == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  entry = MCAST_Filter_Find(hflt, pAddr);
+  if (entry == NULL)
+  {
+    /* One of the groups over the limit */
+    if (hflt->Overflow == 0U)
+    {
+      return HAL_ERROR;
+    }
+    hflt->Overflow--;
+    MCAST_Filter_Apply(hflt);
+    return HAL_OK;
+  }
+
+  entry->Users--;
+  if (entry->Users != 0U)
+  {
+    return HAL_OK;
+  }
+  hflt->Count--;
+
+  if (entry->Slot == 0U)
+  {
+    MCAST_Filter_HashClear(hflt, entry);
+  }
+  else
+  {
+    slot = entry->Slot;
+    entry->Slot = 0U;
+
+    /* Slot given to a hashed group, matched by the slot before its hash
+       bit is cleared */
+    for (i = 0U; i < MCAST_FILTER_ADDRS; i++)
+    {
+      if ((hflt->Entries[i].Users != 0U) && (hflt->Entries[i].Slot == 0U))
+      {
+        break;
+      }
+    }
+    if (i < MCAST_FILTER_ADDRS)
+    {
+      hflt->Entries[i].Slot = (uint8_t)slot;
+      MCAST_Filter_WriteSlot(hflt, slot, hflt->Entries[i].Addr);
+      MCAST_Filter_HashClear(hflt, &hflt->Entries[i]);
+    }
+    else
+    {
+      hflt->SlotUsed[slot - 1U] = 0U;
+      MCAST_Filter_WriteSlot(hflt, slot, NULL);
+    }
+  }
+  MCAST_Filter_Apply(hflt);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Leave all the multicast groups
+  * @param  hflt: filter context
+  * @retval None
+  */
+void MCAST_Filter_Clear(MCAST_FilterTypeDef *hflt)
+{
+  uint32_t i;
+
+  for (i = 0U; i < MCAST_FILTER_ADDRS; i++)
+  {
+    hflt->Entries[i].Users = 0U;
+    hflt->Entries[i].Slot  = 0U;
+  }
+  for (i = 0U; i < MCAST_FILTER_HASH_BITS; i++)
+  {
+    hflt->HashUsers[i] = 0U;
+  }
+  for (i = 0U; i < MCAST_FILTER_SLOTS; i++)
+  {
+    hflt->SlotUsed[i] = 0U;
+    MCAST_Filter_WriteSlot(hflt, i + 1U, NULL);
+  }
+  hflt->Count        = 0U;
+  hflt->Hashed       = 0U;
+  hflt->Overflow     = 0U;
+  hflt->HashTable[0] = 0U;
+  hflt->HashTable[1] = 0U;
+  WRITE_REG(hflt->heth->Instance->MACHT0R, 0U);
+  WRITE_REG(hflt->heth->Instance->MACHT1R, 0U);
+  MCAST_Filter_Apply(hflt);
+}
+
+/**
+  * @brief  Hash table bit of an address
+  * @param  pAddr: MAC address, 6 bytes
+  * @retval Bit, 0 to 63: bit 5 selects MACHT1R, bits 4:0 the bit of the register
+  */
+uint32_t MCAST_Filter_Hash(const uint8_t *pAddr)
+{
+  uint32_t crc = 0xFFFFFFFFU;
+  uint32_t i;
+  uint32_t j;
+
+  for (i = 0U; i < 6U; i++)
+  {
+    crc ^= pAddr[i];
+    for (j = 0U; j < 8U; j++)
+    {
+      crc = ((crc & 0x01U) != 0U) ? ((crc >> 1U) ^ MCAST_FILTER_CRC_POLY) : (crc >> 1U);
+    }
+  }
+
+  /* Upper 6 bits of the bit reversed CRC */
+  return __RBIT(~crc) >> 26U;
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Entry of a group joined
+  * @param  hflt: filter context
+  * @param  pAddr: group MAC address
+  * @retval Entry, NULL if not found
+  */
+static MCAST_Filter_EntryTypeDef *MCAST_Filter_Find(MCAST_FilterTypeDef *hflt, const uint8_t *pAddr)
+{
+  MCAST_Filter_EntryTypeDef *entry;
+  uint32_t i;
+  uint32_t j;
+
+  for (i = 0U; i < MCAST_FILTER_ADDRS; i++)
+  {
+    entry = &hflt->Entries[i];
+    if (entry->Users != 0U)
+    {
+      for (j = 0U; (j < 6U) && (entry->Addr[j] == pAddr[j]); j++)
+      {
+      }
+      if (j == 6U)
+      {
+        return entry;
+      }
+    }
+  }
+
+  return NULL;
+}
+
+/**
+  * @brief  Program a perfect filter slot
+  * @param  hflt: filter context
+  * @param  Slot: MAC address register, 1 to MCAST_FILTER_SLOTS
+  * @param  pAddr: destination address matched, NULL to disable the slot
+  * @retval None
+  */
+static void MCAST_Filter_WriteSlot(MCAST_FilterTypeDef *hflt, uint32_t Slot, const uint8_t *pAddr)
+{
+  ETH_TypeDef *eth = hflt->heth->Instance;
+
+  /* The low register is written last, which updates the address */
+  if (pAddr == NULL)
+  {
+    WRITE_REG(MCAST_FILTER_MACAHR(eth, Slot), ETH_MACAHR_MACAH);
+    WRITE_REG(MCAST_FILTER_MACALR(eth, Slot), 0xFFFFFFFFU);
+  }
+  else
+  {
+    WRITE_REG(MCAST_FILTER_MACAHR(eth, Slot), ETH_MACAHR_AE | ((uint32_t)pAddr[5] << 8U) | (uint32_t)pAddr[4]);
+    WRITE_REG(MCAST_FILTER_MACALR(eth, Slot), ((uint32_t)pAddr[3] << 24U) | ((uint32_t)pAddr[2] << 16U) |
+                                              ((uint32_t)pAddr[1] << 8U) | (uint32_t)pAddr[0]);
+  }
+}
+
+/**
+  * @brief  Add a group to the hash table
+  * @param  hflt: filter context
+  * @param  pEntry: group entry
+  * @retval None
+  */
+static void MCAST_Filter_HashSet(MCAST_FilterTypeDef *hflt, MCAST_Filter_EntryTypeDef *pEntry)
+{
+  uint32_t bit = pEntry->Hash;
+
+  hflt->Hashed++;
+  hflt->HashUsers[bit]++;
+  if (hflt->HashUsers[bit] == 1U)
+  {
+    hflt->HashTable[bit >> 5U] |= (1UL << (bit & 0x1FU));
+    if ((bit >> 5U) == 0U)
+    {
+      WRITE_REG(hflt->heth->Instance->MACHT0R, hflt->HashTable[0]);
+    }
+    else
+    {
+      WRITE_REG(hflt->heth->Instance->MACHT1R, hflt->HashTable[1]);
+    }
+  }
+}
+
+/**
+  * @brief  Remove a group from the hash table
+  * @param  hflt: filter context
+  * @param  pEntry: group entry
+  * @retval None
+  */
+static void MCAST_Filter_HashClear(MCAST_FilterTypeDef *hflt, MCAST_Filter_EntryTypeDef *pEntry)
+{
+  uint32_t bit = pEntry->Hash;
+
+  hflt->Hashed--;
+  hflt->HashUsers[bit]--;
+  if (hflt->HashUsers[bit] == 0U)
+  {
+    hflt->HashTable[bit >> 5U] &= ~(1UL << (bit & 0x1FU));
+    if ((bit >> 5U) == 0U)
+    {
+      WRITE_REG(hflt->heth->Instance->MACHT0R, hflt->HashTable[0]);
+    }
+    else
+    {
+      WRITE_REG(hflt->heth->Instance->MACHT1R, hflt->HashTable[1]);
+    }
+  }
+}
+
+/**
+  * @brief  Set the multicast filter mode of MACPFR
+  * @param  hflt: filter context
+  * @retval None
+  */
+static void MCAST_Filter_Apply(MCAST_FilterTypeDef *hflt)
+{
+  uint32_t pfr = 0U;
+
+  if (hflt->Overflow != 0U)
+  {
+    pfr |= ETH_MACPFR_PM;
+  }
+  if (hflt->Hashed != 0U)
+  {
+    /* Hash table for multicast, perfect filter slots still matched */
+    pfr |= ETH_MACPFR_HMC | ETH_MACPFR_HPF;
+  }
+
+  MODIFY_REG(hflt->heth->Instance->MACPFR, MCAST_FILTER_PFR_MASK, pfr);
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
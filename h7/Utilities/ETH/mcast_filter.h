@@ -0,0 +1,101 @@
+/**
+  ******************************************************************************
+  * @file    mcast_filter.h
+  * @author  MCD Application Team
+  * @brief   Header for mcast_filter module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _MCAST_FILTER_H__
+#define _MCAST_FILTER_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#if !defined(HAL_ETH_MODULE_ENABLED)
+#error "mcast_filter requires the HAL ETH driver"
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+/* Multicast addresses kept by the filter. Override in main.h. */
+#if !defined(MCAST_FILTER_ADDRS)
+#define MCAST_FILTER_ADDRS        32U
+#endif
+
+/* Perfect filter slots, MAC address registers 1 to 3 */
+#define MCAST_FILTER_SLOTS        3U
+
+/* Bits of the hash table */
+#define MCAST_FILTER_HASH_BITS    64U
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  uint8_t                   Addr[6];
+  uint8_t                   Slot;               /* 1 to MCAST_FILTER_SLOTS, 0 when hashed         */
+  uint8_t                   Hash;               /* Bit of the hash table                          */
+  uint32_t                  Users;              /* MCAST_Filter_Add() calls not yet removed       */
+} MCAST_Filter_EntryTypeDef;
+
+typedef struct
+{
+  ETH_HandleTypeDef         *heth;              /* Initialized with HAL_ETH_Init()                */
+  MCAST_Filter_EntryTypeDef Entries[MCAST_FILTER_ADDRS];
+  uint32_t                  Count;              /* Entries in use                                 */
+  uint32_t                  Hashed;             /* Entries in the hash table                      */
+  uint32_t                  Overflow;           /* Addresses not kept, all multicast passed       */
+  uint32_t                  HashTable[2];       /* MACHT0R and MACHT1R values                     */
+  uint8_t                   HashUsers[MCAST_FILTER_HASH_BITS];  /* Entries per hash table bit     */
+  uint8_t                   SlotUsed[MCAST_FILTER_SLOTS];       /* Perfect filter slots in use    */
+} MCAST_FilterTypeDef;
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef MCAST_Filter_Init(MCAST_FilterTypeDef *hflt, ETH_HandleTypeDef *heth);
+HAL_StatusTypeDef MCAST_Filter_Add(MCAST_FilterTypeDef *hflt, const uint8_t *pAddr);
+HAL_StatusTypeDef MCAST_Filter_Remove(MCAST_FilterTypeDef *hflt, const uint8_t *pAddr);
+void              MCAST_Filter_Clear(MCAST_FilterTypeDef *hflt);
+uint32_t          MCAST_Filter_Hash(const uint8_t *pAddr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _MCAST_FILTER_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,497 @@
+/**
+  ******************************************************************************
+  * @file    ptp_clock.c
+  * @author  MCD Application Team
+  * @brief   IEEE 1588 clock of the ETH MAC with PI servo and PPS output
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- initialize the ETH with HAL_ETH_Init() and set the Rx packet metadata
+   ring up with HAL_ETH_ConfigPacketMetaRing(): the Rx timestamps come with
+   the metadata of each packet.
+
+2- PTP_Clock_Init() starts the MAC system time at pTime (or 0), counting in
+   ns (digital rollover) and corrected by the fine update addend. With
+   RxAllFrames, all received frames are timestamped, else the PTP event
+   messages only (Sync, Delay_Req, over Ethernet, IPv4 and IPv6).
+
+3- timestamps of a packet :
+     - Rx: PTP_Clock_StampToTime() on the TimeStamp of the metadata returned
+       by HAL_ETH_GetPacketMeta(), with the packet
+     - Tx: send the packet with the ETH_TX_PACKETS_FEATURES_TTSE attribute,
+       and call PTP_Clock_GetTxTimestamp() in HAL_ETH_TxPacketCpltCallback()
+       for this packet
+   No software timestamping and no high priority interrupt is needed: the
+   times are latched by the MAC and read at task level.
+
+4- the PTP stack computes the offset to the master from the timestamps
+   (PTP_Clock_Diff()) and gives it to PTP_Clock_ServoSample() on each Sync,
+   local time minus master time in ns. Above StepThreshold, the time is
+   stepped (coarse update), else a PI servo corrects the frequency (fine
+   update addend, PTP_CLOCK_MAX_PPB at most). The default gains suit one
+   sample per second: scale Ki with the sample interval. PTP_Clock_AdjustTime()
+   and PTP_Clock_AdjustFreq() are also available to other servos.
+
+5- PTP_Clock_ConfigPPS() sets the PPS output frequency: 1 Hz with a 100 ms
+   pulse for FreqLog2 = 0. Higher frequencies are not evenly spaced with
+   the digital rollover. The ETH_PPS_OUT pin (PB5 or PG8) is configured in
+   HAL_ETH_MspInit() by the application.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "ptp_clock.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define PTP_CLOCK_NS_PER_S        1000000000U
+#define PTP_CLOCK_SUBSECONDS      0x7FFFFFFFU
+
+/* MAC timestamp registers fields, not in the CMSIS device header */
+#define PTP_CLOCK_MACTSCR_TSENA       0x00000001U  /* Timestamp enable                    */
+#define PTP_CLOCK_MACTSCR_TSCFUPDT    0x00000002U  /* Fine update                         */
+#define PTP_CLOCK_MACTSCR_TSINIT      0x00000004U  /* Initialize the system time          */
+#define PTP_CLOCK_MACTSCR_TSUPDT      0x00000008U  /* Update the system time              */
+#define PTP_CLOCK_MACTSCR_TSADDREG    0x00000020U  /* Update the addend                   */
+#define PTP_CLOCK_MACTSCR_TSENALL     0x00000100U  /* Timestamp all the packets received  */
+#define PTP_CLOCK_MACTSCR_TSCTRLSSR   0x00000200U  /* Digital rollover, sub-seconds in ns */
+#define PTP_CLOCK_MACTSCR_TSVER2ENA   0x00000400U  /* PTP v2 snooping                     */
+#define PTP_CLOCK_MACTSCR_TSIPENA     0x00000800U  /* PTP over Ethernet                   */
+#define PTP_CLOCK_MACTSCR_TSIPV6ENA   0x00001000U  /* PTP over IPv6                       */
+#define PTP_CLOCK_MACTSCR_TSIPV4ENA   0x00002000U  /* PTP over IPv4                       */
+#define PTP_CLOCK_MACTSCR_TSEVNTENA   0x00004000U  /* Event messages only                 */
+#define PTP_CLOCK_MACSSIR_SSINC_Pos   16U
+#define PTP_CLOCK_MACSSIR_SSINC_Max   0xFFU
+#define PTP_CLOCK_MACSTNUR_ADDSUB     0x80000000U  /* Subtract the update value           */
+#define PTP_CLOCK_MACPPSCR_PPSCTRL    0x0000000FU
+#define PTP_CLOCK_MACPPSCR_PPSEN0     0x00000010U
+
+/* Timestamp snapshot of the PTP v2 messages over Ethernet, IPv4 and IPv6 */
+#define PTP_CLOCK_TSCR_PTP        (PTP_CLOCK_MACTSCR_TSVER2ENA | PTP_CLOCK_MACTSCR_TSIPENA | \
+                                   PTP_CLOCK_MACTSCR_TSIPV4ENA | PTP_CLOCK_MACTSCR_TSIPV6ENA)
+
+/* Private macro -------------------------------------------------------------*/
+
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static HAL_StatusTypeDef PTP_Clock_Update(PTP_ClockTypeDef *hptp, uint32_t Bit);
+static HAL_StatusTypeDef PTP_Clock_WriteAddend(PTP_ClockTypeDef *hptp, uint32_t Addend);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Start the MAC system time with the fine update
+  * @param  hptp: PTP clock context, kept by the module
+  * @param  pConfig: ETH handle, clock and servo settings, copied
+  * @param  pTime: initial time, NULL for 0
+  * @retval HAL status
+  */
+HAL_StatusTypeDef PTP_Clock_Init(PTP_ClockTypeDef *hptp, const PTP_Clock_ConfigTypeDef *pConfig,
+                                 const PTP_Clock_TimeTypeDef *pTime)
+{
+  PTP_Clock_TimeTypeDef zero = {0U, 0U};
+  ETH_TypeDef *eth;
+  uint32_t clock;
+  uint32_t tscr;
+
+  if ((hptp == NULL) || (pConfig == NULL) || (pConfig->heth == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  clock = (pConfig->ClockHz != 0U) ? pConfig->ClockHz : HAL_RCC_GetHCLKFreq();
+  if (clock == 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Sub-second increment of about two clock periods: the addend is near 2^31
+     and the frequency can be corrected both ways */
+  hptp->Increment = ((2U * PTP_CLOCK_NS_PER_S) + clock - 1U) / clock;
+  if (hptp->Increment > PTP_CLOCK_MACSSIR_SSINC_Max)
+  {
+    return HAL_ERROR;
+  }
+  hptp->BaseAddend = (uint32_t)(((uint64_t)PTP_CLOCK_NS_PER_S << 32U) / ((uint64_t)hptp->Increment * clock));
+
+  hptp->Config = *pConfig;
+  if (hptp->Config.Kp == 0)
+  {
+    hptp->Config.Kp = PTP_CLOCK_KP;
+  }
+  if (hptp->Config.Ki == 0)
+  {
+    hptp->Config.Ki = PTP_CLOCK_KI;
+  }
+  if (hptp->Config.StepThreshold == 0U)
+  {
+    hptp->Config.StepThreshold = PTP_CLOCK_STEP_NS;
+  }
+  hptp->FreqPpb  = 0;
+  hptp->Samples  = 0U;
+  hptp->Steps    = 0U;
+  hptp->Timeouts = 0U;
+  PTP_Clock_ServoReset(hptp);
+
+  eth = pConfig->heth->Instance;
+
+  /* System time in ns */
+  tscr = PTP_CLOCK_MACTSCR_TSENA | PTP_CLOCK_MACTSCR_TSCTRLSSR | PTP_CLOCK_TSCR_PTP;
+  tscr |= (pConfig->RxAllFrames != 0U) ? PTP_CLOCK_MACTSCR_TSENALL : PTP_CLOCK_MACTSCR_TSEVNTENA;
+  WRITE_REG(eth->MACTSCR, tscr);
+  WRITE_REG(eth->MACSSIR, hptp->Increment << PTP_CLOCK_MACSSIR_SSINC_Pos);
+
+  /* Nominal addend, then fine update */
+  if (PTP_Clock_WriteAddend(hptp, hptp->BaseAddend) != HAL_OK)
+  {
+    return HAL_TIMEOUT;
+  }
+  SET_BIT(eth->MACTSCR, PTP_CLOCK_MACTSCR_TSCFUPDT);
+
+  if (PTP_Clock_SetTime(hptp, (pTime != NULL) ? pTime : &zero) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Read the system time
+  * @param  hptp: PTP clock context
+  * @param  pTime: time read
+  * @retval HAL status
+  */
+HAL_StatusTypeDef PTP_Clock_GetTime(PTP_ClockTypeDef *hptp, PTP_Clock_TimeTypeDef *pTime)
+{
+  ETH_TypeDef *eth;
+  uint32_t seconds;
+
+  if ((hptp == NULL) || (pTime == NULL))
+  {
+    return HAL_ERROR;
+  }
+  eth = hptp->Config.heth->Instance;
+
+  /* Read again when the seconds rolled over between the two registers */
+  do
+  {
+    seconds = READ_REG(eth->MACSTSR);
+    pTime->NanoSeconds = READ_REG(eth->MACSTNR) & PTP_CLOCK_SUBSECONDS;
+    pTime->Seconds = READ_REG(eth->MACSTSR);
+  } while (pTime->Seconds != seconds);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Initialize the system time
+  * @param  hptp: PTP clock context
+  * @param  pTime: new time
+  * @retval HAL status
+  */
+HAL_StatusTypeDef PTP_Clock_SetTime(PTP_ClockTypeDef *hptp, const PTP_Clock_TimeTypeDef *pTime)
+{
+  ETH_TypeDef *eth;
+
+  if ((hptp == NULL) || (pTime == NULL) || (pTime->NanoSeconds >= PTP_CLOCK_NS_PER_S))
+  {
+    return HAL_ERROR;
+  }
+  eth = hptp->Config.heth->Instance;
+
+  WRITE_REG(eth->MACSTSUR, pTime->Seconds);
+  WRITE_REG(eth->MACSTNUR, pTime->NanoSeconds);
+
+  return PTP_Clock_Update(hptp, PTP_CLOCK_MACTSCR_TSINIT);
+}
+
+/**
+  * @brief  Step the system time (coarse update)
+  * @param  hptp: PTP clock context
+  * @param  OffsetNs: ns added to the system time, subtracted when negative
+  * @retval HAL status
+  */
+HAL_StatusTypeDef PTP_Clock_AdjustTime(PTP_ClockTypeDef *hptp, int64_t OffsetNs)
+{
+  ETH_TypeDef *eth;
+  uint64_t magnitude;
+  uint32_t seconds;
+  uint32_t subseconds;
+
+  if (hptp == NULL)
+  {
+    return HAL_ERROR;
+  }
+  eth = hptp->Config.heth->Instance;
+
+  magnitude = (OffsetNs < 0) ? (uint64_t)(-OffsetNs) : (uint64_t)OffsetNs;
+  if ((magnitude / PTP_CLOCK_NS_PER_S) > 0xFFFFFFFFU)
+  {
+    return HAL_ERROR;
+  }
+
+  seconds    = (uint32_t)(magnitude / PTP_CLOCK_NS_PER_S);
+  subseconds = (uint32_t)(magnitude % PTP_CLOCK_NS_PER_S);
+  if (OffsetNs < 0)
+  {
+    /* Subtracted: programmed as 2^32 - seconds and 10^9 - ns */
+    seconds = 0U - seconds;
+    if (subseconds != 0U)
+    {
+      subseconds = PTP_CLOCK_NS_PER_S - subseconds;
+    }
+    subseconds |= PTP_CLOCK_MACSTNUR_ADDSUB;
+  }
+  WRITE_REG(eth->MACSTSUR, seconds);
+  WRITE_REG(eth->MACSTNUR, subseconds);
+
+  return PTP_Clock_Update(hptp, PTP_CLOCK_MACTSCR_TSUPDT);
+}
+
+/**
+  * @brief  Correct the system time frequency (fine update)
+  * @param  hptp: PTP clock context
+  * @param  Ppb: correction in parts per billion, positive to speed the clock
+  *         up, clamped to PTP_CLOCK_MAX_PPB
+  * @retval HAL status
+  */
+HAL_StatusTypeDef PTP_Clock_AdjustFreq(PTP_ClockTypeDef *hptp, int32_t Ppb)
+{
+  int64_t addend;
+
+  if (hptp == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  if (Ppb > PTP_CLOCK_MAX_PPB)
+  {
+    Ppb = PTP_CLOCK_MAX_PPB;
+  }
+  else if (Ppb < -PTP_CLOCK_MAX_PPB)
+  {
+    Ppb = -PTP_CLOCK_MAX_PPB;
+  }
+
+  addend = (int64_t)hptp->BaseAddend + (((int64_t)hptp->BaseAddend * Ppb) / (int64_t)PTP_CLOCK_NS_PER_S);
+  hptp->FreqPpb = Ppb;
+
+  return PTP_Clock_WriteAddend(hptp, (uint32_t)addend);
+}
+
+/**
+  * @brief  Feed the servo with an offset to the master
+  * @param  hptp: PTP clock context
+  * @param  OffsetNs: local time minus master time, in ns
+  * @retval Servo state, PTP_CLOCK_SERVO_xxx
+  */
+uint32_t PTP_Clock_ServoSample(PTP_ClockTypeDef *hptp, int64_t OffsetNs)
+{
+  int64_t magnitude;
+  int64_t ppb;
+  int64_t limit = (int64_t)PTP_CLOCK_MAX_PPB * 1024;
+
+  hptp->Samples++;
+  magnitude = (OffsetNs < 0) ? -OffsetNs : OffsetNs;
+
+  if (magnitude > (int64_t)hptp->Config.StepThreshold)
+  {
+    /* Too far to slew: step, the frequency learnt is kept */
+    if (PTP_Clock_AdjustTime(hptp, -OffsetNs) == HAL_OK)
+    {
+      hptp->Steps++;
+    }
+    hptp->InWindow = 0U;
+    hptp->State = PTP_CLOCK_SERVO_STEPPED;
+    return hptp->State;
+  }
+
+  /* PI servo, in ppb / 1024: a clock ahead is slowed down */
+  hptp->Integral += (int64_t)hptp->Config.Ki * OffsetNs;
+  if (hptp->Integral > limit)
+  {
+    hptp->Integral = limit;
+  }
+  else if (hptp->Integral < -limit)
+  {
+    hptp->Integral = -limit;
+  }
+  ppb = -(((int64_t)hptp->Config.Kp * OffsetNs) + hptp->Integral) / 1024;
+  if (ppb > PTP_CLOCK_MAX_PPB)
+  {
+    ppb = PTP_CLOCK_MAX_PPB;
+  }
+  else if (ppb < -PTP_CLOCK_MAX_PPB)
+  {
+    ppb = -PTP_CLOCK_MAX_PPB;
+  }
+  (void)PTP_Clock_AdjustFreq(hptp, (int32_t)ppb);
+
+  if (magnitude <= PTP_CLOCK_LOCK_NS)
+  {
+    if (hptp->InWindow < PTP_CLOCK_LOCK_SAMPLES)
+    {
+      hptp->InWindow++;
+    }
+  }
+  else
+  {
+    hptp->InWindow = 0U;
+  }
+  hptp->State = (hptp->InWindow >= PTP_CLOCK_LOCK_SAMPLES) ? PTP_CLOCK_SERVO_LOCKED : PTP_CLOCK_SERVO_UNLOCKED;
+
+  return hptp->State;
+}
+
+/**
+  * @brief  Clear the servo history, ex. on a change of master
+  * @note   The frequency correction applied is kept.
+  * @param  hptp: PTP clock context
+  * @retval None
+  */
+void PTP_Clock_ServoReset(PTP_ClockTypeDef *hptp)
+{
+  hptp->Integral = (int64_t)hptp->FreqPpb * -1024;
+  hptp->InWindow = 0U;
+  hptp->State    = PTP_CLOCK_SERVO_UNLOCKED;
+}
+
+/**
+  * @brief  Set the PPS output frequency
+  * @param  hptp: PTP clock context
+  * @param  FreqLog2: 2^FreqLog2 Hz, 0 to 15. 0 gives 1 Hz with a 100 ms pulse
+  * @retval HAL status
+  */
+HAL_StatusTypeDef PTP_Clock_ConfigPPS(PTP_ClockTypeDef *hptp, uint32_t FreqLog2)
+{
+  if ((hptp == NULL) || (FreqLog2 > PTP_CLOCK_MACPPSCR_PPSCTRL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Fixed frequency PPS, not the flexible PPS mode */
+  MODIFY_REG(hptp->Config.heth->Instance->MACPPSCR, PTP_CLOCK_MACPPSCR_PPSCTRL | PTP_CLOCK_MACPPSCR_PPSEN0, FreqLog2);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Convert a timestamp of the Rx packet metadata
+  * @param  TimeStamp: ETH_PacketMetaTypeDef TimeStamp
+  * @param  pTime: time of the timestamp
+  * @retval HAL_ERROR when the packet was not timestamped
+  */
+HAL_StatusTypeDef PTP_Clock_StampToTime(uint64_t TimeStamp, PTP_Clock_TimeTypeDef *pTime)
+{
+  if ((TimeStamp == 0U) || (pTime == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  pTime->Seconds     = (uint32_t)(TimeStamp >> 32U);
+  pTime->NanoSeconds = (uint32_t)TimeStamp & PTP_CLOCK_SUBSECONDS;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Read the transmit timestamp of a packet sent
+  * @note   Valid in HAL_ETH_TxPacketCpltCallback(), for the packet released.
+  * @param  hptp: PTP clock context
+  * @param  pTime: time the packet was sent
+  * @retval HAL_ERROR when the packet was not timestamped
+  */
+HAL_StatusTypeDef PTP_Clock_GetTxTimestamp(PTP_ClockTypeDef *hptp, PTP_Clock_TimeTypeDef *pTime)
+{
+  if (hptp == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  return PTP_Clock_StampToTime(hptp->Config.heth->TxDescList.TimeStamp, pTime);
+}
+
+/**
+  * @brief  Difference of two times
+  * @param  pTimeA: first time
+  * @param  pTimeB: second time
+  * @retval pTimeA - pTimeB, in ns
+  */
+int64_t PTP_Clock_Diff(const PTP_Clock_TimeTypeDef *pTimeA, const PTP_Clock_TimeTypeDef *pTimeB)
+{
+  return (((int64_t)pTimeA->Seconds - (int64_t)pTimeB->Seconds) * (int64_t)PTP_CLOCK_NS_PER_S) +
+         ((int64_t)pTimeA->NanoSeconds - (int64_t)pTimeB->NanoSeconds);
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Request a system time update and wait until the MAC took it
+  * @param  hptp: PTP clock context
+  * @param  Bit: PTP_CLOCK_MACTSCR_TSINIT, PTP_CLOCK_MACTSCR_TSUPDT or PTP_CLOCK_MACTSCR_TSADDREG
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef PTP_Clock_Update(PTP_ClockTypeDef *hptp, uint32_t Bit)
+{
+  ETH_TypeDef *eth = hptp->Config.heth->Instance;
+  uint32_t loops = PTP_CLOCK_UPDATE_LOOPS;
+
+  SET_BIT(eth->MACTSCR, Bit);
+  while (READ_BIT(eth->MACTSCR, Bit) != 0U)
+  {
+    if (--loops == 0U)
+    {
+      hptp->Timeouts++;
+      return HAL_TIMEOUT;
+    }
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Load a fine update addend
+  * @param  hptp: PTP clock context
+  * @param  Addend: addend value
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef PTP_Clock_WriteAddend(PTP_ClockTypeDef *hptp, uint32_t Addend)
+{
+  WRITE_REG(hptp->Config.heth->Instance->MACTSAR, Addend);
+
+  return PTP_Clock_Update(hptp, PTP_CLOCK_MACTSCR_TSADDREG);
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,1151 @@
+/**
+  ******************************************************************************
+  * @file    udp_fast.c
+  * @author  MCD Application Team
+  * @brief   Zero-copy UDP/IPv4 with ARP and ICMP echo over the ETH DMA descriptors
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- initialize the ETH with HAL_ETH_Init(), receive checksum offload enabled
+   (ChecksumOffload of ETH_MACConfigTypeDef) and Init.RxBuffLen of 1536
+   bytes, then call UDP_Fast_Init() before HAL_ETH_Start_IT(). The pool of
+   buffers given in the configuration feeds the Rx descriptors and holds the
+   datagrams sent: implement the HAL callbacks with the module ones:
+     uint8_t *HAL_ETH_RxAllocateCallback(ETH_HandleTypeDef *heth)
+     { return UDP_Fast_RxAllocate(&hudp); }
+     void HAL_ETH_TxPacketCpltCallback(ETH_HandleTypeDef *heth, void *pData)
+     { UDP_Fast_TxDone(&hudp, pData); }
+
+2- call UDP_Fast_Process() from the network task, on the receive interrupt
+   or periodically: each packet received is handed over by
+   HAL_ETH_RefillRxDescriptors(), its descriptor refilled from the pool, and
+   processed in its buffer:
+     - ARP: requests for the host address answered in place, addresses of
+       the senders learnt
+     - ICMP echo requests answered in place
+     - UDP: queued to the socket bound to the destination port, dropped
+       otherwise. Fragmented datagrams are dropped.
+   Packets with a MAC error, or an IP header or payload checksum error
+   reported by the hardware, are dropped.
+
+3- UDP_Fast_Bind() opens a socket on a local port. UDP_Fast_Recv() takes the
+   datagrams queued, payload in place in the Rx buffer: give each buffer
+   back with UDP_Fast_Release(), or send it back with UDP_Fast_SendTo().
+
+4- to send, take a buffer with UDP_Fast_GetTxBuffer(), write up to
+   UDP_FAST_PAYLOAD_MAX bytes at the pointer returned, then:
+     - UDP_Fast_Send(): a batch of datagrams to the peer of a socket set by
+       UDP_Fast_Connect(), the headers copied from a template built once.
+     - UDP_Fast_SendTo(): one datagram to any address, next hop looked up
+       in the ARP cache.
+   The headers are written in front of the payload, the IPv4 header and UDP
+   checksums inserted by the ETH DMA, no byte of the payload is copied. The
+   buffer belongs to the module once sent, and is given back to the pool by
+   UDP_Fast_TxDone() when the DMA is done. A datagram not sent (HAL_BUSY:
+   next hop not resolved yet or Tx descriptors all in use) is still owned
+   by the application.
+
+5- a destination not resolved yet starts an ARP request, repeated every
+   UDP_FAST_ARP_RETRY ms while UDP_Fast_Connect(), _SendTo() or _Resolve()
+   are called. UDP_Fast_AddStaticArp() sets addresses never requested nor
+   aged, for a deterministic start. A connected socket keeps the peer
+   address of the connection: connect again to follow a change.
+
+The functions other than UDP_Fast_RxAllocate() and UDP_Fast_TxDone() are
+called from one task. Payloads start 2 bytes off a word boundary.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "udp_fast.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Frame layout, IPv4 header without option */
+#define UDP_FAST_OFS_TYPE         12U
+#define UDP_FAST_OFS_IP           14U
+#define UDP_FAST_OFS_UDP          34U
+#define UDP_FAST_ETH_HEADER       14U
+#define UDP_FAST_IP_HEADER        20U
+#define UDP_FAST_UDP_HEADER       8U
+#define UDP_FAST_ARP_SIZE         42U
+
+#define UDP_FAST_TYPE_IPV4        0x0800U
+#define UDP_FAST_TYPE_ARP         0x0806U
+#define UDP_FAST_PROTO_ICMP       1U
+#define UDP_FAST_PROTO_UDP        17U
+#define UDP_FAST_ICMP_ECHO        8U
+#define UDP_FAST_ICMP_ECHO_REPLY  0U
+#define UDP_FAST_ARP_REQUEST      1U
+#define UDP_FAST_ARP_REPLY        2U
+
+/* ARP entry states */
+#define UDP_FAST_ARP_FREE         0U
+#define UDP_FAST_ARP_PENDING      1U
+#define UDP_FAST_ARP_VALID        2U
+#define UDP_FAST_ARP_STATIC       3U
+
+#define UDP_FAST_CACHE_LINE       32U
+
+/* Private macro -------------------------------------------------------------*/
+#define UDP_FAST_LOCK(__PRIMASK__)   do { (__PRIMASK__) = __get_PRIMASK(); __disable_irq(); } while(0)
+#define UDP_FAST_UNLOCK(__PRIMASK__) __set_PRIMASK(__PRIMASK__)
+
+/* Private variables ---------------------------------------------------------*/
+static const uint8_t UdpFastBroadcast[6] = { 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU };
+
+/* Private function prototypes -----------------------------------------------*/
+static uint8_t  *UDP_Fast_Alloc(UDP_FastTypeDef *hudp);
+static void     UDP_Fast_Free(UDP_FastTypeDef *hudp, uint8_t *pBuffer);
+static uint8_t  *UDP_Fast_Base(const UDP_FastTypeDef *hudp, const uint8_t *pData);
+static HAL_StatusTypeDef UDP_Fast_Transmit(UDP_FastTypeDef *hudp, uint8_t *pFrame, uint32_t Length);
+static void     UDP_Fast_Input(UDP_FastTypeDef *hudp, uint8_t *pFrame, uint32_t Length);
+static void     UDP_Fast_ArpInput(UDP_FastTypeDef *hudp, uint8_t *pFrame, uint32_t Length);
+static void     UDP_Fast_IpInput(UDP_FastTypeDef *hudp, uint8_t *pFrame, uint32_t Length);
+static void     UDP_Fast_Learn(UDP_FastTypeDef *hudp, uint32_t Ip, const uint8_t *pMac, uint32_t Insert);
+static UDP_Fast_ArpTypeDef *UDP_Fast_ArpFind(UDP_FastTypeDef *hudp, uint32_t Ip);
+static UDP_Fast_ArpTypeDef *UDP_Fast_ArpNew(UDP_FastTypeDef *hudp, uint32_t Ip);
+static HAL_StatusTypeDef UDP_Fast_Route(UDP_FastTypeDef *hudp, uint32_t Ip, uint8_t *pMac);
+static void     UDP_Fast_ArpRequest(UDP_FastTypeDef *hudp, uint32_t Ip);
+static uint32_t UDP_Fast_IsBroadcast(const UDP_FastTypeDef *hudp, uint32_t Ip);
+static void     UDP_Fast_Header(const UDP_FastTypeDef *hudp, uint8_t *pFrame, const uint8_t *pMac,
+                                uint16_t SrcPort, uint32_t DstIp, uint16_t DstPort);
+static void     UDP_Fast_Finish(UDP_FastTypeDef *hudp, uint8_t *pFrame, uint32_t Length);
+static uint8_t  *UDP_Fast_Frame(const UDP_FastTypeDef *hudp, const UDP_Fast_PacketTypeDef *pPacket);
+static void     UDP_Fast_Put16(uint8_t *pDest, uint32_t Value);
+static void     UDP_Fast_Put32(uint8_t *pDest, uint32_t Value);
+static uint32_t UDP_Fast_Get16(const uint8_t *pSrc);
+static uint32_t UDP_Fast_Get32(const uint8_t *pSrc);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Fill the buffer pool and assign the Rx descriptors buffers
+  * @param  hudp: UDP context, kept by the module
+  * @param  pConfig: ETH handle, addresses and buffer pool, copied
+  * @retval HAL status
+  */
+HAL_StatusTypeDef UDP_Fast_Init(UDP_FastTypeDef *hudp, const UDP_Fast_ConfigTypeDef *pConfig)
+{
+  uint32_t i;
+
+  if ((hudp == NULL) || (pConfig == NULL) || (pConfig->heth == NULL) || (pConfig->pBuffers == NULL) ||
+      (((uint32_t)pConfig->pBuffers % UDP_FAST_CACHE_LINE) != 0U) || (pConfig->IpAddr == 0U) ||
+      (pConfig->BufferCount <= ETH_RX_DESC_CNT) || (pConfig->BufferCount > UDP_FAST_BUFFERS) ||
+      (pConfig->heth->Init.RxBuffLen < (UDP_FAST_HEADER_SIZE + UDP_FAST_PAYLOAD_MAX)) ||
+      ((pConfig->heth->Init.RxBuffLen % UDP_FAST_CACHE_LINE) != 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  memset(hudp, 0, sizeof(UDP_FastTypeDef));
+  hudp->Config     = *pConfig;
+  hudp->BufferSize = pConfig->heth->Init.RxBuffLen;
+
+  for (i = 0U; i < pConfig->BufferCount; i++)
+  {
+    hudp->pFree[i] = &pConfig->pBuffers[i * hudp->BufferSize];
+  }
+  hudp->FreeCount = pConfig->BufferCount;
+
+  for (i = 0U; i < ETH_RX_DESC_CNT; i++)
+  {
+    if (HAL_ETH_DescAssignMemory(pConfig->heth, i, UDP_Fast_Alloc(hudp), NULL) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  /* IPv4 header and UDP/ICMP checksums inserted by the DMA, short frames padded */
+  hudp->TxConfig.Attributes   = ETH_TX_PACKETS_FEATURES_CSUM | ETH_TX_PACKETS_FEATURES_CRCPAD;
+  hudp->TxConfig.ChecksumCtrl = ETH_CHECKSUM_IPHDR_PAYLOAD_INSERT_PHDR_CALC;
+  hudp->TxConfig.CRCPadCtrl   = ETH_CRC_PAD_INSERT;
+  hudp->TxConfig.SrcAddrCtrl  = ETH_SRC_ADDR_CONTROL_DISABLE;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Process the packets received and refill the Rx descriptors
+  * @param  hudp: UDP context
+  * @param  Budget: packets processed at most, 0 for all the packets received
+  * @retval Number of packets processed
+  */
+uint32_t UDP_Fast_Process(UDP_FastTypeDef *hudp, uint32_t Budget)
+{
+  ETH_HandleTypeDef *heth = hudp->Config.heth;
+  ETH_BufferTypeDef buffers[2];
+  ETH_RxPacketInfo info;
+  uint32_t count = 0U, length = 0U;
+
+  while (((Budget == 0U) || (count < Budget)) && (HAL_ETH_IsRxDataAvailable(heth) != 0U))
+  {
+    count++;
+    buffers[0].buffer = NULL;
+    buffers[0].next   = &buffers[1];
+    buffers[1].buffer = NULL;
+    buffers[1].next   = NULL;
+    memset(&info, 0, sizeof(info));
+
+    /* Packets over two buffers: descriptors given back with their buffers */
+    if ((HAL_ETH_GetRxDataBuffer(heth, buffers) != HAL_OK) ||
+        (HAL_ETH_GetRxDataLength(heth, &length) != HAL_OK) ||
+        (HAL_ETH_GetRxDataInfo(heth, &info) != HAL_OK))
+    {
+      (void)HAL_ETH_BuildRxDescriptors(heth);
+      hudp->Stats.RxErrors++;
+      continue;
+    }
+
+    /* The buffers are ours from here */
+    (void)HAL_ETH_RefillRxDescriptors(heth);
+
+    if ((info.SegmentCnt != 1U) || (info.ErrorCode != 0U) ||
+        ((info.Checksum & (ETH_CHECKSUM_IP_HEADER_ERROR | ETH_CHECKSUM_IP_PAYLOAD_ERROR)) != 0U))
+    {
+      UDP_Fast_Free(hudp, buffers[0].buffer);
+      if (buffers[1].buffer != NULL)
+      {
+        UDP_Fast_Free(hudp, buffers[1].buffer);
+      }
+      hudp->Stats.RxErrors++;
+      continue;
+    }
+
+    UDP_Fast_Input(hudp, buffers[0].buffer, length);
+  }
+
+  /* Descriptors left without buffer while the pool was empty */
+  if (heth->RxDescList.RxBuildDescCnt != 0U)
+  {
+    (void)HAL_ETH_RefillRxDescriptors(heth);
+  }
+
+  return count;
+}
+
+/**
+  * @brief  Open a socket on a local port
+  * @param  hudp: UDP context
+  * @param  Port: local port, not 0
+  * @param  pSocket: socket opened
+  * @retval HAL_OK, HAL_BUSY if all the sockets are open, HAL_ERROR if the
+  *         port is bound
+  */
+HAL_StatusTypeDef UDP_Fast_Bind(UDP_FastTypeDef *hudp, uint16_t Port, uint32_t *pSocket)
+{
+  uint32_t i, socket = UDP_FAST_NO_SOCKET;
+
+  if (Port == 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  for (i = 0U; i < UDP_FAST_SOCKETS; i++)
+  {
+    if (hudp->Sockets[i].Port == Port)
+    {
+      return HAL_ERROR;
+    }
+    if ((hudp->Sockets[i].Port == 0U) && (socket == UDP_FAST_NO_SOCKET))
+    {
+      socket = i;
+    }
+  }
+  if (socket == UDP_FAST_NO_SOCKET)
+  {
+    return HAL_BUSY;
+  }
+
+  memset(&hudp->Sockets[socket], 0, sizeof(UDP_Fast_SocketTypeDef));
+  hudp->Sockets[socket].Port = Port;
+  *pSocket = socket;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Close a socket, the datagrams queued are dropped
+  * @param  hudp: UDP context
+  * @param  Socket: socket
+  * @retval HAL status
+  */
+HAL_StatusTypeDef UDP_Fast_Close(UDP_FastTypeDef *hudp, uint32_t Socket)
+{
+  UDP_Fast_SocketTypeDef *psocket;
+
+  if ((Socket >= UDP_FAST_SOCKETS) || (hudp->Sockets[Socket].Port == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  psocket = &hudp->Sockets[Socket];
+  while (psocket->QueueCount != 0U)
+  {
+    UDP_Fast_Free(hudp, psocket->Queue[psocket->QueueHead].pPayload);
+    psocket->QueueHead = (psocket->QueueHead + 1U) % UDP_FAST_SOCKET_QUEUE;
+    psocket->QueueCount--;
+  }
+  psocket->Port      = 0U;
+  psocket->Connected = 0U;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Set the peer of a socket and build the headers of its datagrams
+  * @param  hudp: UDP context
+  * @param  Socket: socket
+  * @param  Ip: peer address, host order
+  * @param  Port: peer port
+  * @retval HAL_OK, HAL_BUSY while the next hop is resolved (call again),
+  *         HAL_ERROR if the address cannot be reached
+  */
+HAL_StatusTypeDef UDP_Fast_Connect(UDP_FastTypeDef *hudp, uint32_t Socket, uint32_t Ip, uint16_t Port)
+{
+  UDP_Fast_SocketTypeDef *psocket;
+  HAL_StatusTypeDef status;
+  uint8_t mac[6];
+
+  if ((Socket >= UDP_FAST_SOCKETS) || (hudp->Sockets[Socket].Port == 0U) || (Port == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  status = UDP_Fast_Route(hudp, Ip, mac);
+  if (status != HAL_OK)
+  {
+    return status;
+  }
+
+  psocket = &hudp->Sockets[Socket];
+  UDP_Fast_Header(hudp, psocket->Header, mac, psocket->Port, Ip, Port);
+  psocket->PeerIp    = Ip;
+  psocket->PeerPort  = Port;
+  psocket->Connected = 1U;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Take a buffer to send a datagram
+  * @param  hudp: UDP context
+  * @retval Payload area of UDP_FAST_PAYLOAD_MAX bytes, NULL if the pool is
+  *         empty
+  */
+uint8_t *UDP_Fast_GetTxBuffer(UDP_FastTypeDef *hudp)
+{
+  uint8_t *pbuffer = UDP_Fast_Alloc(hudp);
+
+  return (pbuffer != NULL) ? &pbuffer[UDP_FAST_HEADER_SIZE] : NULL;
+}
+
+/**
+  * @brief  Send datagrams to the peer of a connected socket
+  * @param  hudp: UDP context
+  * @param  Socket: connected socket
+  * @param  pPackets: payloads and lengths, RemoteIp and RemotePort unused
+  * @param  Count: number of datagrams
+  * @retval Number of datagrams sent, in order; the others are still owned
+  *         by the application
+  */
+uint32_t UDP_Fast_Send(UDP_FastTypeDef *hudp, uint32_t Socket, UDP_Fast_PacketTypeDef *pPackets,
+                       uint32_t Count)
+{
+  const UDP_Fast_SocketTypeDef *psocket;
+  uint8_t *pframe;
+  uint32_t sent;
+
+  if ((Socket >= UDP_FAST_SOCKETS) || (hudp->Sockets[Socket].Connected == 0U))
+  {
+    return 0U;
+  }
+
+  psocket = &hudp->Sockets[Socket];
+  for (sent = 0U; sent < Count; sent++)
+  {
+    pframe = UDP_Fast_Frame(hudp, &pPackets[sent]);
+    if (pframe == NULL)
+    {
+      break;
+    }
+
+    memcpy(pframe, psocket->Header, UDP_FAST_HEADER_SIZE);
+    UDP_Fast_Finish(hudp, pframe, pPackets[sent].Length);
+    if (UDP_Fast_Transmit(hudp, pframe, UDP_FAST_HEADER_SIZE + pPackets[sent].Length) != HAL_OK)
+    {
+      break;
+    }
+  }
+
+  return sent;
+}
+
+/**
+  * @brief  Send one datagram to any destination
+  * @param  hudp: UDP context
+  * @param  Socket: socket, source port
+  * @param  pPacket: payload, length, destination address and port. The
+  *         payload may be the one of a datagram received.
+  * @retval HAL_OK if sent, HAL_BUSY while the next hop is resolved or no Tx
+  *         descriptor is free, HAL_ERROR on a wrong parameter or an address
+  *         that cannot be reached
+  */
+HAL_StatusTypeDef UDP_Fast_SendTo(UDP_FastTypeDef *hudp, uint32_t Socket, UDP_Fast_PacketTypeDef *pPacket)
+{
+  HAL_StatusTypeDef status;
+  uint8_t *pframe;
+  uint8_t mac[6];
+
+  if ((Socket >= UDP_FAST_SOCKETS) || (hudp->Sockets[Socket].Port == 0U) || (pPacket->RemotePort == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  pframe = UDP_Fast_Frame(hudp, pPacket);
+  if (pframe == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  status = UDP_Fast_Route(hudp, pPacket->RemoteIp, mac);
+  if (status != HAL_OK)
+  {
+    return status;
+  }
+
+  UDP_Fast_Header(hudp, pframe, mac, hudp->Sockets[Socket].Port, pPacket->RemoteIp, pPacket->RemotePort);
+  UDP_Fast_Finish(hudp, pframe, pPacket->Length);
+  return UDP_Fast_Transmit(hudp, pframe, UDP_FAST_HEADER_SIZE + pPacket->Length);
+}
+
+/**
+  * @brief  Take the datagrams received by a socket
+  * @param  hudp: UDP context
+  * @param  Socket: socket
+  * @param  pPackets: datagrams, oldest first, payloads in place
+  * @param  Max: size of pPackets
+  * @retval Number of datagrams taken
+  */
+uint32_t UDP_Fast_Recv(UDP_FastTypeDef *hudp, uint32_t Socket, UDP_Fast_PacketTypeDef *pPackets, uint32_t Max)
+{
+  UDP_Fast_SocketTypeDef *psocket;
+  uint32_t count = 0U;
+
+  if (Socket >= UDP_FAST_SOCKETS)
+  {
+    return 0U;
+  }
+
+  psocket = &hudp->Sockets[Socket];
+  while ((count < Max) && (psocket->QueueCount != 0U))
+  {
+    pPackets[count++] = psocket->Queue[psocket->QueueHead];
+    psocket->QueueHead = (psocket->QueueHead + 1U) % UDP_FAST_SOCKET_QUEUE;
+    psocket->QueueCount--;
+  }
+
+  return count;
+}
+
+/**
+  * @brief  Give back the buffer of a datagram received or not sent
+  * @param  hudp: UDP context
+  * @param  pPayload: payload, or any address in the buffer
+  * @retval None
+  */
+void UDP_Fast_Release(UDP_FastTypeDef *hudp, uint8_t *pPayload)
+{
+  if (UDP_Fast_Base(hudp, pPayload) != NULL)
+  {
+    UDP_Fast_Free(hudp, pPayload);
+  }
+}
+
+/**
+  * @brief  Resolve the next hop of an address ahead of the first datagram
+  * @param  hudp: UDP context
+  * @param  Ip: destination address, host order
+  * @retval HAL_OK if resolved, HAL_BUSY while a request is pending,
+  *         HAL_ERROR if the address cannot be reached
+  */
+HAL_StatusTypeDef UDP_Fast_Resolve(UDP_FastTypeDef *hudp, uint32_t Ip)
+{
+  uint8_t mac[6];
+
+  return UDP_Fast_Route(hudp, Ip, mac);
+}
+
+/**
+  * @brief  Set an ARP entry, never requested nor aged
+  * @param  hudp: UDP context
+  * @param  Ip: address, host order
+  * @param  pMac: Ethernet address
+  * @retval HAL_OK, HAL_BUSY if the cache holds static entries only
+  */
+HAL_StatusTypeDef UDP_Fast_AddStaticArp(UDP_FastTypeDef *hudp, uint32_t Ip, const uint8_t *pMac)
+{
+  UDP_Fast_ArpTypeDef *pentry = UDP_Fast_ArpFind(hudp, Ip);
+
+  if (pentry == NULL)
+  {
+    pentry = UDP_Fast_ArpNew(hudp, Ip);
+    if (pentry == NULL)
+    {
+      return HAL_BUSY;
+    }
+  }
+
+  memcpy(pentry->Mac, pMac, 6U);
+  pentry->State = UDP_FAST_ARP_STATIC;
+  pentry->Tick  = HAL_GetTick();
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Get the counters
+  * @param  hudp: UDP context
+  * @param  pStats: counters
+  * @retval None
+  */
+void UDP_Fast_GetStats(const UDP_FastTypeDef *hudp, UDP_Fast_StatsTypeDef *pStats)
+{
+  *pStats = hudp->Stats;
+}
+
+/**
+  * @brief  Give a buffer of the pool to an Rx descriptor
+  * @note   To be called from HAL_ETH_RxAllocateCallback().
+  * @param  hudp: UDP context
+  * @retval Buffer, NULL if the pool is empty
+  */
+uint8_t *UDP_Fast_RxAllocate(UDP_FastTypeDef *hudp)
+{
+  return UDP_Fast_Alloc(hudp);
+}
+
+/**
+  * @brief  Give back the buffer of a packet sent
+  * @note   To be called from HAL_ETH_TxPacketCpltCallback().
+  * @param  hudp: UDP context
+  * @param  pData: pData of the packet
+  * @retval None
+  */
+void UDP_Fast_TxDone(UDP_FastTypeDef *hudp, void *pData)
+{
+  UDP_Fast_Release(hudp, (uint8_t *)pData);
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Take a buffer of the pool
+  * @param  hudp: UDP context
+  * @retval Buffer, NULL if the pool is empty
+  */
+static uint8_t *UDP_Fast_Alloc(UDP_FastTypeDef *hudp)
+{
+  uint8_t *pbuffer = NULL;
+  uint32_t primask;
+
+  UDP_FAST_LOCK(primask);
+  if (hudp->FreeCount != 0U)
+  {
+    hudp->FreeCount--;
+    pbuffer = hudp->pFree[hudp->FreeCount];
+  }
+  UDP_FAST_UNLOCK(primask);
+
+  if (pbuffer == NULL)
+  {
+    hudp->Stats.NoBuffer++;
+  }
+  return pbuffer;
+}
+
+/**
+  * @brief  Give back a buffer to the pool
+  * @param  hudp: UDP context
+  * @param  pBuffer: any address in a buffer of the pool
+  * @retval None
+  */
+static void UDP_Fast_Free(UDP_FastTypeDef *hudp, uint8_t *pBuffer)
+{
+  uint8_t *pbase = UDP_Fast_Base(hudp, pBuffer);
+  uint32_t primask;
+
+  UDP_FAST_LOCK(primask);
+  if (hudp->FreeCount < hudp->Config.BufferCount)
+  {
+    hudp->pFree[hudp->FreeCount] = pbase;
+    hudp->FreeCount++;
+  }
+  UDP_FAST_UNLOCK(primask);
+}
+
+/**
+  * @brief  Start of the pool buffer holding an address
+  * @param  hudp: UDP context
+  * @param  pData: address
+  * @retval Buffer start, NULL if not in the pool
+  */
+static uint8_t *UDP_Fast_Base(const UDP_FastTypeDef *hudp, const uint8_t *pData)
+{
+  uint32_t offset = (uint32_t)pData - (uint32_t)hudp->Config.pBuffers;
+
+  if ((pData == NULL) || (pData < hudp->Config.pBuffers) ||
+      (offset >= (hudp->Config.BufferCount * hudp->BufferSize)))
+  {
+    return NULL;
+  }
+  return &hudp->Config.pBuffers[offset - (offset % hudp->BufferSize)];
+}
+
+/**
+  * @brief  Give a frame to the DMA, its buffer given back once sent
+  * @param  hudp: UDP context
+  * @param  pFrame: frame, in a buffer of the pool
+  * @param  Length: frame length, FCS excluded
+  * @retval HAL_OK, HAL_BUSY if no Tx descriptor is free
+  */
+static HAL_StatusTypeDef UDP_Fast_Transmit(UDP_FastTypeDef *hudp, uint8_t *pFrame, uint32_t Length)
+{
+  ETH_BufferTypeDef txbuffer;
+
+#if (__DCACHE_PRESENT == 1U)
+  if ((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    uint32_t start = (uint32_t)pFrame & ~(UDP_FAST_CACHE_LINE - 1U);
+
+    SCB_CleanDCache_by_Addr((uint32_t *)start, (int32_t)(((uint32_t)pFrame + Length) - start));
+  }
+#endif
+
+  txbuffer.buffer = pFrame;
+  txbuffer.len    = Length;
+  txbuffer.next   = NULL;
+  hudp->TxConfig.Length   = Length;
+  hudp->TxConfig.TxBuffer = &txbuffer;
+  hudp->TxConfig.pData    = pFrame;
+
+  if (HAL_ETH_Transmit_IT(hudp->Config.heth, &hudp->TxConfig) != HAL_OK)
+  {
+    hudp->Stats.TxBusy++;
+    return HAL_BUSY;
+  }
+  return HAL_OK;
+}
+
+/**
+  * @brief  Dispatch a frame received, its buffer is given back, sent or queued
+  * @param  hudp: UDP context
+  * @param  pFrame: frame
+  * @param  Length: frame length
+  * @retval None
+  */
+static void UDP_Fast_Input(UDP_FastTypeDef *hudp, uint8_t *pFrame, uint32_t Length)
+{
+  uint32_t type;
+
+  if (Length < UDP_FAST_ETH_HEADER)
+  {
+    hudp->Stats.RxErrors++;
+    UDP_Fast_Free(hudp, pFrame);
+    return;
+  }
+
+  type = UDP_Fast_Get16(&pFrame[UDP_FAST_OFS_TYPE]);
+  if (type == UDP_FAST_TYPE_ARP)
+  {
+    UDP_Fast_ArpInput(hudp, pFrame, Length);
+  }
+  else if (type == UDP_FAST_TYPE_IPV4)
+  {
+    UDP_Fast_IpInput(hudp, pFrame, Length);
+  }
+  else
+  {
+    hudp->Stats.RxDropped++;
+    UDP_Fast_Free(hudp, pFrame);
+  }
+}
+
+/**
+  * @brief  Learn the sender of an ARP packet, answer the requests for the
+  *         host address in place
+  * @param  hudp: UDP context
+  * @param  pFrame: frame
+  * @param  Length: frame length
+  * @retval None
+  */
+static void UDP_Fast_ArpInput(UDP_FastTypeDef *hudp, uint8_t *pFrame, uint32_t Length)
+{
+  uint8_t *parp = &pFrame[UDP_FAST_OFS_IP];
+  uint32_t sender, target;
+  uint8_t mac[6];
+
+  /* Ethernet and IPv4 addresses only */
+  if ((Length < UDP_FAST_ARP_SIZE) || (UDP_Fast_Get16(&parp[0]) != 1U) ||
+      (UDP_Fast_Get16(&parp[2]) != UDP_FAST_TYPE_IPV4) || (parp[4] != 6U) || (parp[5] != 4U))
+  {
+    hudp->Stats.RxDropped++;
+    UDP_Fast_Free(hudp, pFrame);
+    return;
+  }
+
+  sender = UDP_Fast_Get32(&parp[14]);
+  target = UDP_Fast_Get32(&parp[24]);
+  UDP_Fast_Learn(hudp, sender, &parp[8], (target == hudp->Config.IpAddr) ? 1U : 0U);
+
+  if ((target != hudp->Config.IpAddr) || (UDP_Fast_Get16(&parp[6]) != UDP_FAST_ARP_REQUEST))
+  {
+    UDP_Fast_Free(hudp, pFrame);
+    return;
+  }
+
+  /* Reply: the sender becomes the target */
+  memcpy(mac, &parp[8], 6U);
+  memcpy(&pFrame[0], mac, 6U);
+  memcpy(&pFrame[6], hudp->Config.heth->Init.MACAddr, 6U);
+  UDP_Fast_Put16(&parp[6], UDP_FAST_ARP_REPLY);
+  memcpy(&parp[8], hudp->Config.heth->Init.MACAddr, 6U);
+  UDP_Fast_Put32(&parp[14], hudp->Config.IpAddr);
+  memcpy(&parp[18], mac, 6U);
+  UDP_Fast_Put32(&parp[24], sender);
+
+  if (UDP_Fast_Transmit(hudp, pFrame, UDP_FAST_ARP_SIZE) == HAL_OK)
+  {
+    hudp->Stats.ArpReplies++;
+  }
+  else
+  {
+    UDP_Fast_Free(hudp, pFrame);
+  }
+}
+
+/**
+  * @brief  Queue a UDP datagram to its socket, answer an ICMP echo request
+  *         in place
+  * @param  hudp: UDP context
+  * @param  pFrame: frame
+  * @param  Length: frame length
+  * @retval None
+  */
+static void UDP_Fast_IpInput(UDP_FastTypeDef *hudp, uint8_t *pFrame, uint32_t Length)
+{
+  uint8_t *pip = &pFrame[UDP_FAST_OFS_IP];
+  UDP_Fast_SocketTypeDef *psocket = NULL;
+  uint32_t header, total, source, destination, port, length, i;
+  uint8_t *pl4;
+
+  if (Length < (UDP_FAST_ETH_HEADER + UDP_FAST_IP_HEADER))
+  {
+    hudp->Stats.RxErrors++;
+    UDP_Fast_Free(hudp, pFrame);
+    return;
+  }
+
+  header      = ((uint32_t)pip[0] & 0x0FU) * 4U;
+  total       = UDP_Fast_Get16(&pip[2]);
+  source      = UDP_Fast_Get32(&pip[12]);
+  destination = UDP_Fast_Get32(&pip[16]);
+  pl4         = &pip[header];
+
+  if (((pip[0] >> 4) != 4U) || (header < UDP_FAST_IP_HEADER) || (total < header) ||
+      ((UDP_FAST_ETH_HEADER + total) > Length))
+  {
+    hudp->Stats.RxErrors++;
+    UDP_Fast_Free(hudp, pFrame);
+    return;
+  }
+
+  /* Not for this host, or a fragment */
+  if (((destination != hudp->Config.IpAddr) && (UDP_Fast_IsBroadcast(hudp, destination) == 0U)) ||
+      ((UDP_Fast_Get16(&pip[6]) & 0x3FFFU) != 0U))
+  {
+    hudp->Stats.RxDropped++;
+    UDP_Fast_Free(hudp, pFrame);
+    return;
+  }
+
+  if ((pip[9] == UDP_FAST_PROTO_ICMP) && (destination == hudp->Config.IpAddr) &&
+      ((total - header) >= 8U) && (pl4[0] == UDP_FAST_ICMP_ECHO))
+  {
+    /* Addresses swapped, checksums inserted by the DMA */
+    memcpy(&pFrame[0], &pFrame[6], 6U);
+    memcpy(&pFrame[6], hudp->Config.heth->Init.MACAddr, 6U);
+    pip[8] = UDP_FAST_TTL;
+    UDP_Fast_Put16(&pip[10], 0U);
+    UDP_Fast_Put32(&pip[12], hudp->Config.IpAddr);
+    UDP_Fast_Put32(&pip[16], source);
+    pl4[0] = UDP_FAST_ICMP_ECHO_REPLY;
+    UDP_Fast_Put16(&pl4[2], 0U);
+
+    if (UDP_Fast_Transmit(hudp, pFrame, UDP_FAST_ETH_HEADER + total) == HAL_OK)
+    {
+      hudp->Stats.EchoReplies++;
+    }
+    else
+    {
+      UDP_Fast_Free(hudp, pFrame);
+    }
+    return;
+  }
+
+  if ((pip[9] == UDP_FAST_PROTO_UDP) && ((total - header) >= UDP_FAST_UDP_HEADER))
+  {
+    length = UDP_Fast_Get16(&pl4[4]);
+    if ((length < UDP_FAST_UDP_HEADER) || (length > (total - header)))
+    {
+      hudp->Stats.RxErrors++;
+      UDP_Fast_Free(hudp, pFrame);
+      return;
+    }
+
+    port = UDP_Fast_Get16(&pl4[2]);
+    for (i = 0U; i < UDP_FAST_SOCKETS; i++)
+    {
+      if (hudp->Sockets[i].Port == port)
+      {
+        psocket = &hudp->Sockets[i];
+        break;
+      }
+    }
+
+    if ((psocket != NULL) && (psocket->QueueCount < UDP_FAST_SOCKET_QUEUE))
+    {
+      i = (psocket->QueueHead + psocket->QueueCount) % UDP_FAST_SOCKET_QUEUE;
+      psocket->Queue[i].pPayload   = &pl4[UDP_FAST_UDP_HEADER];
+      psocket->Queue[i].Length     = length - UDP_FAST_UDP_HEADER;
+      psocket->Queue[i].RemoteIp   = source;
+      psocket->Queue[i].RemotePort = (uint16_t)UDP_Fast_Get16(&pl4[0]);
+      psocket->QueueCount++;
+      hudp->Stats.RxPackets++;
+      return;
+    }
+  }
+
+  hudp->Stats.RxDropped++;
+  UDP_Fast_Free(hudp, pFrame);
+}
+
+/**
+  * @brief  Update the ARP entry of an address
+  * @param  hudp: UDP context
+  * @param  Ip: address, host order
+  * @param  pMac: Ethernet address
+  * @param  Insert: 1 to create the entry if missing
+  * @retval None
+  */
+static void UDP_Fast_Learn(UDP_FastTypeDef *hudp, uint32_t Ip, const uint8_t *pMac, uint32_t Insert)
+{
+  UDP_Fast_ArpTypeDef *pentry = UDP_Fast_ArpFind(hudp, Ip);
+
+  if ((pentry == NULL) && (Insert != 0U) && (Ip != 0U))
+  {
+    pentry = UDP_Fast_ArpNew(hudp, Ip);
+  }
+  if ((pentry != NULL) && (pentry->State != UDP_FAST_ARP_STATIC))
+  {
+    memcpy(pentry->Mac, pMac, 6U);
+    pentry->State = UDP_FAST_ARP_VALID;
+    pentry->Tick  = HAL_GetTick();
+  }
+}
+
+/**
+  * @brief  Find the ARP entry of an address
+  * @param  hudp: UDP context
+  * @param  Ip: address, host order
+  * @retval Entry, NULL if none
+  */
+static UDP_Fast_ArpTypeDef *UDP_Fast_ArpFind(UDP_FastTypeDef *hudp, uint32_t Ip)
+{
+  uint32_t i;
+
+  for (i = 0U; i < UDP_FAST_ARP_ENTRIES; i++)
+  {
+    if ((hudp->Arp[i].State != UDP_FAST_ARP_FREE) && (hudp->Arp[i].Ip == Ip))
+    {
+      return &hudp->Arp[i];
+    }
+  }
+  return NULL;
+}
+
+/**
+  * @brief  Take an ARP entry, a free one or the oldest learnt one
+  * @param  hudp: UDP context
+  * @param  Ip: address, host order
+  * @retval Entry PENDING, NULL if all the entries are static
+  */
+static UDP_Fast_ArpTypeDef *UDP_Fast_ArpNew(UDP_FastTypeDef *hudp, uint32_t Ip)
+{
+  UDP_Fast_ArpTypeDef *pentry = NULL;
+  uint32_t i, now = HAL_GetTick();
+
+  for (i = 0U; i < UDP_FAST_ARP_ENTRIES; i++)
+  {
+    if (hudp->Arp[i].State == UDP_FAST_ARP_FREE)
+    {
+      pentry = &hudp->Arp[i];
+      break;
+    }
+    if ((hudp->Arp[i].State != UDP_FAST_ARP_STATIC) &&
+        ((pentry == NULL) || ((now - hudp->Arp[i].Tick) > (now - pentry->Tick))))
+    {
+      pentry = &hudp->Arp[i];
+    }
+  }
+
+  if (pentry != NULL)
+  {
+    memset(pentry, 0, sizeof(UDP_Fast_ArpTypeDef));
+    pentry->Ip          = Ip;
+    pentry->State       = UDP_FAST_ARP_PENDING;
+    pentry->Tick        = now;
+    pentry->RequestTick = now - UDP_FAST_ARP_RETRY;
+  }
+  return pentry;
+}
+
+/**
+  * @brief  Get the Ethernet address of the next hop to an address, request
+  *         it if unknown or aged
+  * @param  hudp: UDP context
+  * @param  Ip: destination, host order
+  * @param  pMac: Ethernet address of the next hop
+  * @retval HAL_OK, HAL_BUSY while resolved, HAL_ERROR if not reachable
+  */
+static HAL_StatusTypeDef UDP_Fast_Route(UDP_FastTypeDef *hudp, uint32_t Ip, uint8_t *pMac)
+{
+  UDP_Fast_ArpTypeDef *pentry;
+  uint32_t hop = Ip, now = HAL_GetTick();
+
+  if (UDP_Fast_IsBroadcast(hudp, Ip) != 0U)
+  {
+    memcpy(pMac, UdpFastBroadcast, 6U);
+    return HAL_OK;
+  }
+
+  if (((Ip ^ hudp->Config.IpAddr) & hudp->Config.NetMask) != 0U)
+  {
+    hop = hudp->Config.Gateway;
+  }
+  if ((hop == 0U) || (hop == hudp->Config.IpAddr))
+  {
+    return HAL_ERROR;
+  }
+
+  pentry = UDP_Fast_ArpFind(hudp, hop);
+  if (pentry == NULL)
+  {
+    pentry = UDP_Fast_ArpNew(hudp, hop);
+    if (pentry == NULL)
+    {
+      return HAL_BUSY;
+    }
+  }
+
+  /* A learnt address keeps being used while it is refreshed */
+  if ((pentry->State == UDP_FAST_ARP_PENDING) ||
+      ((pentry->State == UDP_FAST_ARP_VALID) && ((now - pentry->Tick) >= UDP_FAST_ARP_AGE)))
+  {
+    if ((now - pentry->RequestTick) >= UDP_FAST_ARP_RETRY)
+    {
+      pentry->RequestTick = now;
+      UDP_Fast_ArpRequest(hudp, hop);
+    }
+  }
+
+  if (pentry->State == UDP_FAST_ARP_PENDING)
+  {
+    return HAL_BUSY;
+  }
+  memcpy(pMac, pentry->Mac, 6U);
+  return HAL_OK;
+}
+
+/**
+  * @brief  Broadcast an ARP request
+  * @param  hudp: UDP context
+  * @param  Ip: address requested, host order
+  * @retval None
+  */
+static void UDP_Fast_ArpRequest(UDP_FastTypeDef *hudp, uint32_t Ip)
+{
+  uint8_t *pframe = UDP_Fast_Alloc(hudp);
+  uint8_t *parp;
+
+  if (pframe == NULL)
+  {
+    return;
+  }
+
+  parp = &pframe[UDP_FAST_OFS_IP];
+  memcpy(&pframe[0], UdpFastBroadcast, 6U);
+  memcpy(&pframe[6], hudp->Config.heth->Init.MACAddr, 6U);
+  UDP_Fast_Put16(&pframe[UDP_FAST_OFS_TYPE], UDP_FAST_TYPE_ARP);
+  UDP_Fast_Put16(&parp[0], 1U);
+  UDP_Fast_Put16(&parp[2], UDP_FAST_TYPE_IPV4);
+  parp[4] = 6U;
+  parp[5] = 4U;
+  UDP_Fast_Put16(&parp[6], UDP_FAST_ARP_REQUEST);
+  memcpy(&parp[8], hudp->Config.heth->Init.MACAddr, 6U);
+  UDP_Fast_Put32(&parp[14], hudp->Config.IpAddr);
+  memset(&parp[18], 0, 6U);
+  UDP_Fast_Put32(&parp[24], Ip);
+
+  if (UDP_Fast_Transmit(hudp, pframe, UDP_FAST_ARP_SIZE) == HAL_OK)
+  {
+    hudp->Stats.ArpRequests++;
+  }
+  else
+  {
+    UDP_Fast_Free(hudp, pframe);
+  }
+}
+
+/**
+  * @brief  Check for a broadcast address
+  * @param  hudp: UDP context
+  * @param  Ip: address, host order
+  * @retval 1 for the limited or the subnet broadcast address, 0 otherwise
+  */
+static uint32_t UDP_Fast_IsBroadcast(const UDP_FastTypeDef *hudp, uint32_t Ip)
+{
+  return ((Ip == 0xFFFFFFFFU) || (Ip == (hudp->Config.IpAddr | ~hudp->Config.NetMask))) ? 1U : 0U;
+}
+
+/**
+  * @brief  Write the Ethernet, IPv4 and UDP headers of a datagram, lengths
+  *         and identification excepted
+  * @param  hudp: UDP context
+  * @param  pFrame: UDP_FAST_HEADER_SIZE bytes
+  * @param  pMac: Ethernet address of the next hop
+  * @param  SrcPort: local port
+  * @param  DstIp: destination, host order
+  * @param  DstPort: destination port
+  * @retval None
+  */
+static void UDP_Fast_Header(const UDP_FastTypeDef *hudp, uint8_t *pFrame, const uint8_t *pMac,
+                            uint16_t SrcPort, uint32_t DstIp, uint16_t DstPort)
+{
+  uint8_t *pip  = &pFrame[UDP_FAST_OFS_IP];
+  uint8_t *pudp = &pFrame[UDP_FAST_OFS_UDP];
+
+  memcpy(&pFrame[0], pMac, 6U);
+  memcpy(&pFrame[6], hudp->Config.heth->Init.MACAddr, 6U);
+  UDP_Fast_Put16(&pFrame[UDP_FAST_OFS_TYPE], UDP_FAST_TYPE_IPV4);
+
+  /* Version 4, 5 words, don't fragment, checksum inserted by the DMA */
+  pip[0] = 0x45U;
+  pip[1] = 0U;
+  UDP_Fast_Put16(&pip[2], 0U);
+  UDP_Fast_Put16(&pip[4], 0U);
+  UDP_Fast_Put16(&pip[6], 0x4000U);
+  pip[8] = UDP_FAST_TTL;
+  pip[9] = UDP_FAST_PROTO_UDP;
+  UDP_Fast_Put16(&pip[10], 0U);
+  UDP_Fast_Put32(&pip[12], hudp->Config.IpAddr);
+  UDP_Fast_Put32(&pip[16], DstIp);
+
+  UDP_Fast_Put16(&pudp[0], SrcPort);
+  UDP_Fast_Put16(&pudp[2], DstPort);
+  UDP_Fast_Put16(&pudp[4], 0U);
+  UDP_Fast_Put16(&pudp[6], 0U);
+}
+
+/**
+  * @brief  Write the lengths and the identification of a datagram
+  * @param  hudp: UDP context
+  * @param  pFrame: frame, headers written
+  * @param  Length: payload length
+  * @retval None
+  */
+static void UDP_Fast_Finish(UDP_FastTypeDef *hudp, uint8_t *pFrame, uint32_t Length)
+{
+  UDP_Fast_Put16(&pFrame[UDP_FAST_OFS_IP + 2U], UDP_FAST_IP_HEADER + UDP_FAST_UDP_HEADER + Length);
+  UDP_Fast_Put16(&pFrame[UDP_FAST_OFS_IP + 4U], hudp->IpId);
+  UDP_Fast_Put16(&pFrame[UDP_FAST_OFS_UDP + 4U], UDP_FAST_UDP_HEADER + Length);
+  hudp->IpId++;
+}
+
+/**
+  * @brief  Frame start of a datagram to send
+  * @param  hudp: UDP context
+  * @param  pPacket: payload and length
+  * @retval Frame start, NULL if the payload is not in the pool, too long, or
+  *         without room for the headers in front of it
+  */
+static uint8_t *UDP_Fast_Frame(const UDP_FastTypeDef *hudp, const UDP_Fast_PacketTypeDef *pPacket)
+{
+  uint8_t *pbase = UDP_Fast_Base(hudp, pPacket->pPayload);
+
+  if ((pbase == NULL) || (pPacket->Length > UDP_FAST_PAYLOAD_MAX) ||
+      ((uint32_t)(pPacket->pPayload - pbase) < UDP_FAST_HEADER_SIZE) ||
+      (((uint32_t)(pPacket->pPayload - pbase) + pPacket->Length) > hudp->BufferSize))
+  {
+    return NULL;
+  }
+  return pPacket->pPayload - UDP_FAST_HEADER_SIZE;
+}
+
+static void UDP_Fast_Put16(uint8_t *pDest, uint32_t Value)
+{
+  pDest[0] = (uint8_t)(Value >> 8U);
+  pDest[1] = (uint8_t)Value;
+}
+
+static void UDP_Fast_Put32(uint8_t *pDest, uint32_t Value)
+{
+  pDest[0] = (uint8_t)(Value >> 24U);
+  pDest[1] = (uint8_t)(Value >> 16U);
+  pDest[2] = (uint8_t)(Value >> 8U);
+  pDest[3] = (uint8_t)Value;
+}
+
+static uint32_t UDP_Fast_Get16(const uint8_t *pSrc)
+{
+  return ((uint32_t)pSrc[0] << 8U) | (uint32_t)pSrc[1];
+}
+
+static uint32_t UDP_Fast_Get32(const uint8_t *pSrc)
+{
+  return ((uint32_t)pSrc[0] << 24U) | ((uint32_t)pSrc[1] << 16U) | ((uint32_t)pSrc[2] << 8U) | (uint32_t)pSrc[3];
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,201 @@
+/**
+  ******************************************************************************
+  * @file    udp_fast.h
+  * @author  MCD Application Team
+  * @brief   Header for udp_fast module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _UDP_FAST_H__
+#define _UDP_FAST_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#if !defined(HAL_ETH_MODULE_ENABLED)
+#error "udp_fast requires the HAL ETH driver"
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+/* Local ports bound at once. Override in main.h. */
+#if !defined(UDP_FAST_SOCKETS)
+#define UDP_FAST_SOCKETS           4U
+#endif
+
+/* Datagrams received and not yet read, per socket. Override in main.h. */
+#if !defined(UDP_FAST_SOCKET_QUEUE)
+#define UDP_FAST_SOCKET_QUEUE      16U
+#endif
+
+/* Buffers of the pool given in the configuration, at most. Override in main.h. */
+#if !defined(UDP_FAST_BUFFERS)
+#define UDP_FAST_BUFFERS           32U
+#endif
+
+/* ARP cache entries. Override in main.h. */
+#if !defined(UDP_FAST_ARP_ENTRIES)
+#define UDP_FAST_ARP_ENTRIES       8U
+#endif
+
+/* Age of a learnt address before it is refreshed, and interval between two
+   requests for one address, in ms. Override in main.h. */
+#if !defined(UDP_FAST_ARP_AGE)
+#define UDP_FAST_ARP_AGE           300000U
+#endif
+#if !defined(UDP_FAST_ARP_RETRY)
+#define UDP_FAST_ARP_RETRY         1000U
+#endif
+
+/* Time to live of the datagrams sent. Override in main.h. */
+#if !defined(UDP_FAST_TTL)
+#define UDP_FAST_TTL               64U
+#endif
+
+/* Ethernet, IPv4 (no option) and UDP headers in front of a payload sent */
+#define UDP_FAST_HEADER_SIZE       42U
+#define UDP_FAST_PAYLOAD_MAX       1472U
+
+#define UDP_FAST_NO_SOCKET         0xFFFFFFFFU
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  ETH_HandleTypeDef         *heth;          /* HAL_ETH_Init() done, not started            */
+  uint32_t                  IpAddr;         /* Host order, UDP_FAST_IP(a, b, c, d)         */
+  uint32_t                  NetMask;
+  uint32_t                  Gateway;        /* 0: none, only the local subnet is reached   */
+  uint8_t                   *pBuffers;      /* BufferCount buffers of heth->Init.RxBuffLen
+                                               bytes, contiguous, 32-byte aligned, reached
+                                               by the ETH DMA (AXI or D2 SRAM)             */
+  uint32_t                  BufferCount;    /* ETH_RX_DESC_CNT + 1 to UDP_FAST_BUFFERS     */
+} UDP_Fast_ConfigTypeDef;
+
+/* A datagram: payload in a buffer of the pool */
+typedef struct
+{
+  uint8_t                   *pPayload;
+  uint32_t                  Length;         /* Payload bytes                               */
+  uint32_t                  RemoteIp;       /* Received: source, SendTo: destination       */
+  uint16_t                  RemotePort;
+  uint16_t                  Reserved;
+} UDP_Fast_PacketTypeDef;
+
+typedef struct
+{
+  uint32_t                  RxPackets;      /* Datagrams queued to a socket                */
+  uint32_t                  RxDropped;      /* No socket, queue full, not for this host    */
+  uint32_t                  RxErrors;       /* MAC errors, checksum errors, truncated      */
+  uint32_t                  TxPackets;      /* Datagrams given to the DMA                  */
+  uint32_t                  TxBusy;         /* Sends refused, no Tx descriptor free        */
+  uint32_t                  NoBuffer;       /* Allocations failed, pool empty              */
+  uint32_t                  ArpRequests;    /* ARP requests sent                           */
+  uint32_t                  ArpReplies;     /* ARP replies sent                            */
+  uint32_t                  EchoReplies;    /* ICMP echo replies sent                      */
+} UDP_Fast_StatsTypeDef;
+
+typedef struct
+{
+  uint32_t                  Ip;
+  uint8_t                   Mac[6];
+  uint8_t                   State;          /* Reserved for the module                     */
+  uint8_t                   Reserved;
+  uint32_t                  Tick;           /* Learnt, HAL_GetTick()                       */
+  uint32_t                  RequestTick;    /* Last request sent                           */
+} UDP_Fast_ArpTypeDef;
+
+typedef struct
+{
+  uint16_t                  Port;           /* 0: free                                     */
+  uint16_t                  PeerPort;       /* Connected: destination of UDP_Fast_Send()   */
+  uint32_t                  PeerIp;
+  uint32_t                  Connected;
+  uint8_t                   Header[UDP_FAST_HEADER_SIZE]; /* Connected: headers sent       */
+  UDP_Fast_PacketTypeDef    Queue[UDP_FAST_SOCKET_QUEUE];
+  uint32_t                  QueueHead;
+  uint32_t                  QueueCount;
+} UDP_Fast_SocketTypeDef;
+
+typedef struct
+{
+  UDP_Fast_ConfigTypeDef    Config;
+  UDP_Fast_SocketTypeDef    Sockets[UDP_FAST_SOCKETS];
+  UDP_Fast_ArpTypeDef       Arp[UDP_FAST_ARP_ENTRIES];
+  uint8_t                   *pFree[UDP_FAST_BUFFERS]; /* Free buffers, taken from the end  */
+  __IO uint32_t             FreeCount;
+  uint32_t                  BufferSize;
+  uint16_t                  IpId;           /* Identification of the next datagram         */
+  uint16_t                  Reserved;
+  ETH_TxPacketConfig        TxConfig;
+  UDP_Fast_StatsTypeDef     Stats;
+} UDP_FastTypeDef;
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Host order IPv4 address */
+#define UDP_FAST_IP(__A__, __B__, __C__, __D__)  (((uint32_t)(__A__) << 24) | ((uint32_t)(__B__) << 16) | \
+                                                  ((uint32_t)(__C__) << 8) | (uint32_t)(__D__))
+
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef UDP_Fast_Init(UDP_FastTypeDef *hudp, const UDP_Fast_ConfigTypeDef *pConfig);
+uint32_t          UDP_Fast_Process(UDP_FastTypeDef *hudp, uint32_t Budget);
+
+HAL_StatusTypeDef UDP_Fast_Bind(UDP_FastTypeDef *hudp, uint16_t Port, uint32_t *pSocket);
+HAL_StatusTypeDef UDP_Fast_Close(UDP_FastTypeDef *hudp, uint32_t Socket);
+HAL_StatusTypeDef UDP_Fast_Connect(UDP_FastTypeDef *hudp, uint32_t Socket, uint32_t Ip, uint16_t Port);
+
+uint8_t           *UDP_Fast_GetTxBuffer(UDP_FastTypeDef *hudp);
+uint32_t          UDP_Fast_Send(UDP_FastTypeDef *hudp, uint32_t Socket, UDP_Fast_PacketTypeDef *pPackets,
+                                uint32_t Count);
+HAL_StatusTypeDef UDP_Fast_SendTo(UDP_FastTypeDef *hudp, uint32_t Socket, UDP_Fast_PacketTypeDef *pPacket);
+uint32_t          UDP_Fast_Recv(UDP_FastTypeDef *hudp, uint32_t Socket, UDP_Fast_PacketTypeDef *pPackets,
+                                uint32_t Max);
+void              UDP_Fast_Release(UDP_FastTypeDef *hudp, uint8_t *pPayload);
+
+HAL_StatusTypeDef UDP_Fast_Resolve(UDP_FastTypeDef *hudp, uint32_t Ip);
+HAL_StatusTypeDef UDP_Fast_AddStaticArp(UDP_FastTypeDef *hudp, uint32_t Ip, const uint8_t *pMac);
+void              UDP_Fast_GetStats(const UDP_FastTypeDef *hudp, UDP_Fast_StatsTypeDef *pStats);
+
+/* To be called from the HAL ETH callbacks */
+uint8_t           *UDP_Fast_RxAllocate(UDP_FastTypeDef *hudp);
+void              UDP_Fast_TxDone(UDP_FastTypeDef *hudp, void *pData);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _UDP_FAST_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
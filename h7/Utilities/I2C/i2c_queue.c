@@ -0,0 +1,771 @@
+/**
+  ******************************************************************************
+  * @file    i2c_queue.c
+  * @author  MCD Application Team
+  * @brief   I2C bus scheduler: write then read jobs chained by DMA with repeated
+  *          starts, per device timeouts and bus recovery.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- initialize the I2C with HAL_I2C_Init() (Timing for up to 1 MHz, Fast-mode
+   Plus drive enabled with HAL_I2CEx_EnableFastModePlus() when needed), link
+   a Tx and a Rx DMA stream to the handle, then call I2C_Queue_Init() with
+   an I2C_QueueTypeDef per instance. From then on the module drives the I2C
+   registers: do not use the HAL I2C transfer functions on this instance.
+   Call I2C_Queue_EV_IRQHandler() and I2C_Queue_ER_IRQHandler() from the
+   I2C event and error interrupt handlers, HAL_DMA_IRQHandler() from the DMA
+   ones, all at the same preemption priority.
+
+2- a job writes TxSize bytes (register address, then data) to its device,
+   then reads RxSize bytes after a repeated start, the bus is not released
+   between both. Each phase is moved by the DMA, with reloads of 255 bytes
+   for longer ones: the CPU only handles the phase changes. Jobs of all the
+   devices are served in submission order and the next one is started from
+   the STOP interrupt of the previous one, the bus is never idle while jobs
+   are queued. Jobs may be submitted from interrupts, callbacks included.
+
+3- call I2C_Queue_Tick() every millisecond, from the main loop or from an
+   interrupt of lower priority than the I2C ones. A job running longer than
+   the Timeout of its device is aborted and ends with HAL_TIMEOUT. A NACK
+   ends the job with HAL_ERROR. After a timeout, a bus or DMA error the I2C
+   is reset and, when I2C_Queue_SetRecoveryPins() gave the SCL and SDA pins,
+   up to 9 clock pulses and a STOP are sent while a device holds SDA low.
+   Queued jobs go on after the recovery.
+
+4- DMA buffers must be in a RAM the DMA reaches (not the DTCM). With the
+   data cache enabled the Tx buffers are cleaned and the Rx buffers
+   invalidated here: Rx buffers must start on a cache line and fill whole
+   lines (32 bytes).
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "i2c_queue.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define I2C_QUEUE_IT            (I2C_CR1_TCIE | I2C_CR1_STOPIE | I2C_CR1_NACKIE | I2C_CR1_ERRIE)
+#define I2C_QUEUE_ERRORS        (I2C_ISR_BERR | I2C_ISR_ARLO | I2C_ISR_OVR)
+
+/* Events ending a job */
+#define I2C_QUEUE_WAIT_STOP     0x01U
+#define I2C_QUEUE_WAIT_DMA      0x02U
+
+/* Requests of bus recovery */
+#define I2C_QUEUE_RECOVER_ERROR    0x01U
+#define I2C_QUEUE_RECOVER_TIMEOUT  0x02U
+
+#define I2C_QUEUE_NBYTES_MAX    255U
+
+/* Private macro -------------------------------------------------------------*/
+#define I2C_QUEUE_PIN_HIGH(__PORT__, __PIN__)  ((__PORT__)->BSRRL = (__PIN__))
+#define I2C_QUEUE_PIN_LOW(__PORT__, __PIN__)   ((__PORT__)->BSRRH = (__PIN__))
+
+/* Private variables ---------------------------------------------------------*/
+static I2C_QueueTypeDef *I2cQueues[I2C_QUEUE_INSTANCES];
+
+/* Private function prototypes -----------------------------------------------*/
+static I2C_QueueTypeDef  *I2C_Queue_Find(I2C_HandleTypeDef *hi2c);
+static uint32_t          I2C_Queue_Chunk(I2C_QueueTypeDef *pQueue);
+static HAL_StatusTypeDef I2C_Queue_StartPhase(I2C_QueueTypeDef *pQueue);
+static void              I2C_Queue_Finish(I2C_QueueTypeDef *pQueue, HAL_StatusTypeDef Status);
+static void              I2C_Queue_Run(I2C_QueueTypeDef *pQueue);
+static void              I2C_Queue_Complete(I2C_QueueTypeDef *pQueue, uint32_t Event);
+static void              I2C_Queue_Fail(I2C_QueueTypeDef *pQueue);
+static void              I2C_Queue_StopDma(I2C_QueueTypeDef *pQueue);
+static void              I2C_Queue_Recover(I2C_QueueTypeDef *pQueue);
+static void              I2C_Queue_Delay(void);
+static void              I2C_Queue_DmaRxCplt(DMA_HandleTypeDef *hdma);
+static void              I2C_Queue_DmaError(DMA_HandleTypeDef *hdma);
+static void              I2C_Queue_CacheClean(const void *pData, uint32_t Size);
+static void              I2C_Queue_CacheInvalidate(void *pData, uint32_t Size);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Attach a queue to an initialized I2C instance
+  * @param  pQueue: queue context, kept by the module until I2C_Queue_DeInit()
+  * @param  hi2c: I2C handle, HAL_I2C_Init() done, Tx and Rx DMA linked
+  * @retval HAL status
+  */
+HAL_StatusTypeDef I2C_Queue_Init(I2C_QueueTypeDef *pQueue, I2C_HandleTypeDef *hi2c)
+{
+  uint32_t i;
+  uint32_t slot = I2C_QUEUE_INSTANCES;
+
+  if ((pQueue == NULL) || (hi2c == NULL) || (hi2c->hdmatx == NULL) || (hi2c->hdmarx == NULL) ||
+      (hi2c->Init.AddressingMode != I2C_ADDRESSINGMODE_7BIT))
+  {
+    return HAL_ERROR;
+  }
+
+  for (i = 0U; i < I2C_QUEUE_INSTANCES; i++)
+  {
+    if ((I2cQueues[i] != NULL) && (I2cQueues[i]->hi2c == hi2c))
+    {
+      return HAL_BUSY;
+    }
+    if ((I2cQueues[i] == NULL) && (slot == I2C_QUEUE_INSTANCES))
+    {
+      slot = i;
+    }
+  }
+  if (slot == I2C_QUEUE_INSTANCES)
+  {
+    return HAL_ERROR;
+  }
+
+  memset(pQueue, 0, sizeof(I2C_QueueTypeDef));
+  pQueue->hi2c = hi2c;
+  I2cQueues[slot] = pQueue;
+
+  hi2c->hdmatx->XferCpltCallback     = NULL;
+  hi2c->hdmatx->XferHalfCpltCallback = NULL;
+  hi2c->hdmatx->XferErrorCallback    = I2C_Queue_DmaError;
+  hi2c->hdmatx->XferAbortCallback    = NULL;
+  hi2c->hdmarx->XferCpltCallback     = I2C_Queue_DmaRxCplt;
+  hi2c->hdmarx->XferHalfCpltCallback = NULL;
+  hi2c->hdmarx->XferErrorCallback    = I2C_Queue_DmaError;
+  hi2c->hdmarx->XferAbortCallback    = NULL;
+
+  WRITE_REG(hi2c->Instance->ICR, I2C_ICR_STOPCF | I2C_ICR_NACKCF | I2C_ICR_BERRCF | I2C_ICR_ARLOCF | I2C_ICR_OVRCF);
+  SET_BIT(hi2c->Instance->CR1, I2C_QUEUE_IT);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Detach a queue from its I2C instance
+  * @param  pQueue: queue context
+  * @retval HAL_BUSY while jobs are queued, HAL status otherwise
+  */
+HAL_StatusTypeDef I2C_Queue_DeInit(I2C_QueueTypeDef *pQueue)
+{
+  uint32_t i;
+
+  if (I2C_Queue_IsIdle(pQueue) == 0U)
+  {
+    return HAL_BUSY;
+  }
+
+  for (i = 0U; i < I2C_QUEUE_INSTANCES; i++)
+  {
+    if (I2cQueues[i] == pQueue)
+    {
+      CLEAR_BIT(pQueue->hi2c->Instance->CR1, I2C_QUEUE_IT | I2C_CR1_TXDMAEN | I2C_CR1_RXDMAEN);
+      I2cQueues[i] = NULL;
+      return HAL_OK;
+    }
+  }
+
+  return HAL_ERROR;
+}
+
+/**
+  * @brief  Give the pins used to free a bus held low by a device
+  * @param  pQueue: queue context
+  * @param  pSclPort: SCL GPIO port, NULL to disable the clock pulses
+  * @param  SclPin: SCL GPIO pin
+  * @param  pSdaPort: SDA GPIO port
+  * @param  SdaPin: SDA GPIO pin
+  * @retval None
+  */
+void I2C_Queue_SetRecoveryPins(I2C_QueueTypeDef *pQueue, GPIO_TypeDef *pSclPort, uint16_t SclPin,
+                               GPIO_TypeDef *pSdaPort, uint16_t SdaPin)
+{
+  pQueue->pSclPort = pSclPort;
+  pQueue->SclPin   = SclPin;
+  pQueue->pSdaPort = pSdaPort;
+  pQueue->SdaPin   = SdaPin;
+}
+
+/**
+  * @brief  Queue a job, started at once when the bus is idle
+  * @param  pQueue: queue of the I2C instance the device is on
+  * @param  pJob: job, owned by the module until its Callback is called
+  * @retval HAL status
+  */
+HAL_StatusTypeDef I2C_Queue_Submit(I2C_QueueTypeDef *pQueue, I2C_Queue_JobTypeDef *pJob)
+{
+  uint32_t primask;
+  uint32_t start = 0U;
+
+  if ((pQueue == NULL) || (pQueue->hi2c == NULL) || (pJob == NULL) || (pJob->pDevice == NULL) ||
+      ((pJob->TxSize != 0U) && (pJob->pTx == NULL)) || ((pJob->RxSize != 0U) && (pJob->pRx == NULL)) ||
+      (pJob->TxSize > 0xFFFFU) || (pJob->RxSize > 0xFFFFU))
+  {
+    return HAL_ERROR;
+  }
+
+  pJob->Status = HAL_BUSY;
+  pJob->pNext = NULL;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (pQueue->pTail != NULL)
+  {
+    pQueue->pTail->pNext = pJob;
+  }
+  else
+  {
+    pQueue->pHead = pJob;
+  }
+  pQueue->pTail = pJob;
+  if (pQueue->Running == 0U)
+  {
+    pQueue->Running = 1U;
+    pQueue->Start = HAL_GetTick();
+    start = 1U;
+  }
+  __set_PRIMASK(primask);
+
+  if (start != 0U)
+  {
+    I2C_Queue_Run(pQueue);
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Check that all the submitted jobs are done
+  * @param  pQueue: queue context
+  * @retval 1 when idle, 0 otherwise
+  */
+uint32_t I2C_Queue_IsIdle(I2C_QueueTypeDef *pQueue)
+{
+  return ((pQueue == NULL) || (pQueue->pHead == NULL)) ? 1U : 0U;
+}
+
+/**
+  * @brief  Abort the job running past its timeout and recover the bus after
+  *         an error. Call every millisecond, below the I2C interrupt priority.
+  * @param  pQueue: queue context
+  * @retval None
+  */
+void I2C_Queue_Tick(I2C_QueueTypeDef *pQueue)
+{
+  I2C_Queue_JobTypeDef *pJob;
+  uint32_t timeout;
+  uint32_t recover;
+  uint32_t primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  pJob = pQueue->pHead;
+  if ((pQueue->Recover == 0U) && (pQueue->Running != 0U) && (pJob != NULL))
+  {
+    timeout = (pJob->pDevice->Timeout != 0U) ? pJob->pDevice->Timeout : I2C_QUEUE_TIMEOUT;
+    if ((HAL_GetTick() - pQueue->Start) > timeout)
+    {
+      /* No interrupt of this bus touches the queue from here */
+      CLEAR_BIT(pQueue->hi2c->Instance->CR1, I2C_QUEUE_IT);
+      pQueue->Recover = I2C_QUEUE_RECOVER_TIMEOUT;
+    }
+  }
+  recover = pQueue->Recover;
+  __set_PRIMASK(primask);
+
+  if (recover == 0U)
+  {
+    return;
+  }
+
+  I2C_Queue_StopDma(pQueue);
+  if (recover == I2C_QUEUE_RECOVER_TIMEOUT)
+  {
+    I2C_Queue_Finish(pQueue, HAL_TIMEOUT);
+  }
+  I2C_Queue_Recover(pQueue);
+
+  pQueue->Recover = 0U;
+  SET_BIT(pQueue->hi2c->Instance->CR1, I2C_QUEUE_IT);
+  I2C_Queue_Run(pQueue);
+}
+
+/**
+  * @brief  I2C event interrupt: reloads, repeated start and end of the jobs
+  * @param  pQueue: queue context
+  * @retval None
+  */
+void I2C_Queue_EV_IRQHandler(I2C_QueueTypeDef *pQueue)
+{
+  I2C_TypeDef *i2c = pQueue->hi2c->Instance;
+  uint32_t isr = i2c->ISR;
+
+  if ((pQueue->pHead == NULL) || (pQueue->Recover != 0U))
+  {
+    WRITE_REG(i2c->ICR, I2C_ICR_STOPCF | I2C_ICR_NACKCF);
+    return;
+  }
+
+  if ((isr & I2C_ISR_NACKF) != 0U)
+  {
+    WRITE_REG(i2c->ICR, I2C_ICR_NACKCF);
+    pQueue->Result = HAL_ERROR;
+    if ((i2c->CR2 & I2C_CR2_AUTOEND) == 0U)
+    {
+      SET_BIT(i2c->CR2, I2C_CR2_STOP);
+    }
+  }
+
+  if ((isr & I2C_ISR_STOPF) != 0U)
+  {
+    WRITE_REG(i2c->ICR, I2C_ICR_STOPCF);
+    I2C_Queue_Complete(pQueue, I2C_QUEUE_WAIT_STOP);
+    return;
+  }
+
+  if ((isr & I2C_ISR_TCR) != 0U)
+  {
+    MODIFY_REG(i2c->CR2, I2C_CR2_NBYTES | I2C_CR2_RELOAD | I2C_CR2_AUTOEND, I2C_Queue_Chunk(pQueue));
+  }
+  else if ((isr & I2C_ISR_TC) != 0U)
+  {
+    /* Write phase done, the bus is held: repeated start for the read phase */
+    pQueue->Reading = 1U;
+    if ((pQueue->Result != HAL_OK) || (I2C_Queue_StartPhase(pQueue) != HAL_OK))
+    {
+      pQueue->Result = HAL_ERROR;
+      SET_BIT(i2c->CR2, I2C_CR2_STOP);
+    }
+  }
+}
+
+/**
+  * @brief  I2C error interrupt: bus error, arbitration loss, overrun
+  * @param  pQueue: queue context
+  * @retval None
+  */
+void I2C_Queue_ER_IRQHandler(I2C_QueueTypeDef *pQueue)
+{
+  I2C_TypeDef *i2c = pQueue->hi2c->Instance;
+  uint32_t isr = i2c->ISR;
+
+  WRITE_REG(i2c->ICR, I2C_ICR_BERRCF | I2C_ICR_ARLOCF | I2C_ICR_OVRCF);
+
+  if (((isr & I2C_QUEUE_ERRORS) != 0U) && (pQueue->pHead != NULL) && (pQueue->Recover == 0U))
+  {
+    I2C_Queue_Fail(pQueue);
+  }
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Queue attached to an I2C handle
+  * @param  hi2c: I2C handle
+  * @retval Queue, NULL if none
+  */
+static I2C_QueueTypeDef *I2C_Queue_Find(I2C_HandleTypeDef *hi2c)
+{
+  uint32_t i;
+
+  for (i = 0U; i < I2C_QUEUE_INSTANCES; i++)
+  {
+    if ((I2cQueues[i] != NULL) && (I2cQueues[i]->hi2c == hi2c))
+    {
+      return I2cQueues[i];
+    }
+  }
+
+  return NULL;
+}
+
+/**
+  * @brief  Take the next chunk of the phase, 255 bytes at most
+  * @param  pQueue: queue context
+  * @retval NBYTES, RELOAD and AUTOEND fields of CR2
+  */
+static uint32_t I2C_Queue_Chunk(I2C_QueueTypeDef *pQueue)
+{
+  uint32_t size = (pQueue->Remaining > I2C_QUEUE_NBYTES_MAX) ? I2C_QUEUE_NBYTES_MAX : pQueue->Remaining;
+  uint32_t cr2 = size << I2C_CR2_NBYTES_Pos;
+
+  pQueue->Remaining -= size;
+  if (pQueue->Remaining != 0U)
+  {
+    cr2 |= I2C_CR2_RELOAD;
+  }
+  else if (pQueue->Last != 0U)
+  {
+    cr2 |= I2C_CR2_AUTOEND;
+  }
+
+  return cr2;
+}
+
+/**
+  * @brief  Start the DMA of the current phase of the job at the head of the
+  *         queue, then the (repeated) start condition
+  * @param  pQueue: queue context
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef I2C_Queue_StartPhase(I2C_QueueTypeDef *pQueue)
+{
+  I2C_HandleTypeDef *hi2c = pQueue->hi2c;
+  I2C_Queue_JobTypeDef *pJob = pQueue->pHead;
+  uint32_t size = (pQueue->Reading != 0U) ? pJob->RxSize : pJob->TxSize;
+  uint32_t cr2 = ((uint32_t)pJob->pDevice->Address & I2C_CR2_SADD) | I2C_CR2_START;
+  uint32_t dmaen = 0U;
+
+  pQueue->Last = ((pQueue->Reading != 0U) || (pJob->RxSize == 0U)) ? 1U : 0U;
+  pQueue->Remaining = size;
+  pQueue->Pending = I2C_QUEUE_WAIT_STOP;
+
+  if (pQueue->Reading != 0U)
+  {
+    cr2 |= I2C_CR2_RD_WRN;
+    I2C_Queue_CacheInvalidate(pJob->pRx, size);
+    if (HAL_DMA_Start_IT(hi2c->hdmarx, (uint32_t)&hi2c->Instance->RXDR, (uint32_t)pJob->pRx, size) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+    pQueue->Pending |= I2C_QUEUE_WAIT_DMA;
+    dmaen = I2C_CR1_RXDMAEN;
+  }
+  else if (size != 0U)
+  {
+    I2C_Queue_CacheClean(pJob->pTx, size);
+    if (HAL_DMA_Start_IT(hi2c->hdmatx, (uint32_t)pJob->pTx, (uint32_t)&hi2c->Instance->TXDR, size) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+    dmaen = I2C_CR1_TXDMAEN;
+  }
+
+  MODIFY_REG(hi2c->Instance->CR1, I2C_CR1_TXDMAEN | I2C_CR1_RXDMAEN, dmaen);
+  hi2c->Instance->CR2 = cr2 | I2C_Queue_Chunk(pQueue);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Remove the job at the head of the queue and call its callback
+  * @param  pQueue: queue context
+  * @param  Status: job result
+  * @retval None
+  */
+static void I2C_Queue_Finish(I2C_QueueTypeDef *pQueue, HAL_StatusTypeDef Status)
+{
+  I2C_Queue_JobTypeDef *pJob = pQueue->pHead;
+  uint32_t primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  pQueue->pHead = pJob->pNext;
+  if (pQueue->pHead == NULL)
+  {
+    pQueue->pTail = NULL;
+  }
+  __set_PRIMASK(primask);
+
+  pQueue->Jobs++;
+  if (Status == HAL_TIMEOUT)
+  {
+    pQueue->Errors++;
+    pJob->pDevice->Timeouts++;
+  }
+  else if (Status != HAL_OK)
+  {
+    pQueue->Errors++;
+    pJob->pDevice->Errors++;
+  }
+
+  pJob->pNext = NULL;
+  pJob->Status = Status;
+  if (pJob->Callback != NULL)
+  {
+    pJob->Callback(pJob);
+  }
+}
+
+/**
+  * @brief  Start the job at the head of the queue. Jobs failing to start are
+  *         finished here. Called by the context owning the Running flag,
+  *         which is released once the queue is empty.
+  * @param  pQueue: queue context
+  * @retval None
+  */
+static void I2C_Queue_Run(I2C_QueueTypeDef *pQueue)
+{
+  I2C_Queue_JobTypeDef *pJob;
+  uint32_t primask;
+
+  for (;;)
+  {
+    primask = __get_PRIMASK();
+    __disable_irq();
+    pJob = pQueue->pHead;
+    if (pJob == NULL)
+    {
+      pQueue->Running = 0U;
+    }
+    pQueue->Start = HAL_GetTick();
+    __set_PRIMASK(primask);
+
+    if (pJob == NULL)
+    {
+      return;
+    }
+
+    pQueue->Result  = HAL_OK;
+    pQueue->Reading = ((pJob->TxSize == 0U) && (pJob->RxSize != 0U)) ? 1U : 0U;
+    if (I2C_Queue_StartPhase(pQueue) == HAL_OK)
+    {
+      return;
+    }
+    I2C_Queue_Finish(pQueue, HAL_ERROR);
+  }
+}
+
+/**
+  * @brief  One of the events ending the job occurred: STOP detected, or the
+  *         Rx DMA done. Once all are there, end the job and start the next.
+  * @param  pQueue: queue context
+  * @param  Event: I2C_QUEUE_WAIT_xxx
+  * @retval None
+  */
+static void I2C_Queue_Complete(I2C_QueueTypeDef *pQueue, uint32_t Event)
+{
+  pQueue->Pending &= ~Event;
+
+  /* A NACK leaves the DMA waiting for data that never comes */
+  if ((Event == I2C_QUEUE_WAIT_STOP) && (pQueue->Result != HAL_OK))
+  {
+    I2C_Queue_StopDma(pQueue);
+    pQueue->Pending = 0U;
+  }
+  if (pQueue->Pending != 0U)
+  {
+    return;
+  }
+
+  CLEAR_BIT(pQueue->hi2c->Instance->CR1, I2C_CR1_TXDMAEN | I2C_CR1_RXDMAEN);
+  pQueue->hi2c->Instance->CR2 = 0U;
+
+  /* Flush the byte a NACK left in TXDR, it would start the next write */
+  if ((pQueue->hi2c->Instance->ISR & I2C_ISR_TXE) == 0U)
+  {
+    SET_BIT(pQueue->hi2c->Instance->ISR, I2C_ISR_TXE);
+  }
+
+  if ((pQueue->Result == HAL_OK) && (pQueue->Reading != 0U))
+  {
+    I2C_Queue_CacheInvalidate(pQueue->pHead->pRx, pQueue->pHead->RxSize);
+  }
+
+  I2C_Queue_Finish(pQueue, pQueue->Result);
+  I2C_Queue_Run(pQueue);
+}
+
+/**
+  * @brief  Bus or DMA error: end the job, the bus is recovered by
+  *         I2C_Queue_Tick() before the next one. Interrupt context.
+  * @param  pQueue: queue context
+  * @retval None
+  */
+static void I2C_Queue_Fail(I2C_QueueTypeDef *pQueue)
+{
+  CLEAR_BIT(pQueue->hi2c->Instance->CR1, I2C_CR1_TXDMAEN | I2C_CR1_RXDMAEN);
+  I2C_Queue_StopDma(pQueue);
+  pQueue->Recover = I2C_QUEUE_RECOVER_ERROR;
+  I2C_Queue_Finish(pQueue, HAL_ERROR);
+}
+
+/**
+  * @brief  Abort the DMA streams still running. The abort waits for the
+  *         stream to stop (a few cycles): the next job may start it at once.
+  * @param  pQueue: queue context
+  * @retval None
+  */
+static void I2C_Queue_StopDma(I2C_QueueTypeDef *pQueue)
+{
+  DMA_HandleTypeDef *hdma[2];
+  uint32_t i;
+
+  hdma[0] = pQueue->hi2c->hdmatx;
+  hdma[1] = pQueue->hi2c->hdmarx;
+  for (i = 0U; i < 2U; i++)
+  {
+    if (HAL_DMA_GetState(hdma[i]) == HAL_DMA_STATE_BUSY)
+    {
+      (void)HAL_DMA_Abort(hdma[i]);
+    }
+  }
+}
+
+/**
+  * @brief  Reset the I2C and, while a device holds SDA low, clock it out with
+  *         up to 9 SCL pulses followed by a STOP
+  * @param  pQueue: queue context
+  * @retval None
+  */
+static void I2C_Queue_Recover(I2C_QueueTypeDef *pQueue)
+{
+  I2C_TypeDef *i2c = pQueue->hi2c->Instance;
+  uint32_t scl;
+  uint32_t sda;
+  uint32_t moder_scl;
+  uint32_t moder_sda;
+  uint32_t i;
+
+  /* Software reset: SCL and SDA are released */
+  CLEAR_BIT(i2c->CR1, I2C_CR1_PE | I2C_CR1_TXDMAEN | I2C_CR1_RXDMAEN);
+  i2c->CR2 = 0U;
+
+  if ((pQueue->pSclPort != NULL) && (pQueue->pSdaPort != NULL) &&
+      ((pQueue->pSdaPort->IDR & pQueue->SdaPin) == 0U))
+  {
+    scl = POSITION_VAL(pQueue->SclPin) * 2U;
+    sda = POSITION_VAL(pQueue->SdaPin) * 2U;
+    moder_scl = pQueue->pSclPort->MODER & (GPIO_MODER_MODER0 << scl);
+    moder_sda = pQueue->pSdaPort->MODER & (GPIO_MODER_MODER0 << sda);
+
+    /* Open drain outputs, released */
+    I2C_QUEUE_PIN_HIGH(pQueue->pSclPort, pQueue->SclPin);
+    I2C_QUEUE_PIN_HIGH(pQueue->pSdaPort, pQueue->SdaPin);
+    MODIFY_REG(pQueue->pSclPort->MODER, GPIO_MODER_MODER0 << scl, GPIO_MODE_OUTPUT_PP << scl);
+    MODIFY_REG(pQueue->pSdaPort->MODER, GPIO_MODER_MODER0 << sda, GPIO_MODE_OUTPUT_PP << sda);
+
+    for (i = 0U; (i < 9U) && ((pQueue->pSdaPort->IDR & pQueue->SdaPin) == 0U); i++)
+    {
+      I2C_QUEUE_PIN_LOW(pQueue->pSclPort, pQueue->SclPin);
+      I2C_Queue_Delay();
+      I2C_QUEUE_PIN_HIGH(pQueue->pSclPort, pQueue->SclPin);
+      I2C_Queue_Delay();
+    }
+
+    /* STOP condition */
+    I2C_QUEUE_PIN_LOW(pQueue->pSclPort, pQueue->SclPin);
+    I2C_Queue_Delay();
+    I2C_QUEUE_PIN_LOW(pQueue->pSdaPort, pQueue->SdaPin);
+    I2C_Queue_Delay();
+    I2C_QUEUE_PIN_HIGH(pQueue->pSclPort, pQueue->SclPin);
+    I2C_Queue_Delay();
+    I2C_QUEUE_PIN_HIGH(pQueue->pSdaPort, pQueue->SdaPin);
+    I2C_Queue_Delay();
+
+    MODIFY_REG(pQueue->pSclPort->MODER, GPIO_MODER_MODER0 << scl, moder_scl);
+    MODIFY_REG(pQueue->pSdaPort->MODER, GPIO_MODER_MODER0 << sda, moder_sda);
+  }
+
+  SET_BIT(i2c->CR1, I2C_CR1_PE);
+  WRITE_REG(i2c->ICR, I2C_ICR_STOPCF | I2C_ICR_NACKCF | I2C_ICR_BERRCF | I2C_ICR_ARLOCF | I2C_ICR_OVRCF);
+  pQueue->Recoveries++;
+}
+
+/**
+  * @brief  Wait about I2C_QUEUE_RECOVERY_US
+  * @retval None
+  */
+static void I2C_Queue_Delay(void)
+{
+  __IO uint32_t count = (SystemCoreClock / 4000000U) * I2C_QUEUE_RECOVERY_US;
+
+  while (count != 0U)
+  {
+    count--;
+  }
+}
+
+/**
+  * @brief  Rx DMA done
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void I2C_Queue_DmaRxCplt(DMA_HandleTypeDef *hdma)
+{
+  I2C_QueueTypeDef *pQueue = I2C_Queue_Find((I2C_HandleTypeDef *)hdma->Parent);
+
+  if ((pQueue != NULL) && (pQueue->pHead != NULL) && (pQueue->Recover == 0U))
+  {
+    I2C_Queue_Complete(pQueue, I2C_QUEUE_WAIT_DMA);
+  }
+}
+
+/**
+  * @brief  DMA transfer error
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void I2C_Queue_DmaError(DMA_HandleTypeDef *hdma)
+{
+  I2C_QueueTypeDef *pQueue = I2C_Queue_Find((I2C_HandleTypeDef *)hdma->Parent);
+
+  if ((pQueue != NULL) && (pQueue->pHead != NULL) && (pQueue->Recover == 0U))
+  {
+    I2C_Queue_Fail(pQueue);
+  }
+}
+
+/**
+  * @brief  Write back the data cache lines of a DMA source buffer
+  * @param  pData: buffer
+  * @param  Size: size in bytes
+  * @retval None
+  */
+static void I2C_Queue_CacheClean(const void *pData, uint32_t Size)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if ((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    uint32_t start = (uint32_t)pData & ~31U;
+    SCB_CleanDCache_by_Addr((uint32_t *)start, (int32_t)(((uint32_t)pData + Size) - start));
+  }
+#else
+  UNUSED(pData);
+  UNUSED(Size);
+#endif
+}
+
+/**
+  * @brief  Drop the data cache lines of a DMA destination buffer
+  * @param  pData: buffer, cache line aligned
+  * @param  Size: size in bytes
+  * @retval None
+  */
+static void I2C_Queue_CacheInvalidate(void *pData, uint32_t Size)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if ((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    SCB_InvalidateDCache_by_Addr((uint32_t *)pData, (int32_t)Size);
+  }
+#else
+  UNUSED(pData);
+  UNUSED(Size);
+#endif
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,134 @@
+/**
+  ******************************************************************************
+  * @file    i2c_queue.h
+  * @author  MCD Application Team
+  * @brief   Header for i2c_queue module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _I2C_QUEUE_H__
+#define _I2C_QUEUE_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#if !defined(HAL_I2C_MODULE_ENABLED) || !defined(HAL_DMA_MODULE_ENABLED)
+#error "i2c_queue requires the HAL I2C and DMA drivers"
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  uint16_t                  Address;     /* 7-bit address shifted left by 1, as the HAL */
+  uint32_t                  Timeout;     /* Job timeout in ms, 0: I2C_QUEUE_TIMEOUT      */
+  uint32_t                  Errors;      /* Jobs ended by a NACK or a bus error          */
+  uint32_t                  Timeouts;    /* Jobs aborted on timeout                      */
+} I2C_Queue_DeviceTypeDef;
+
+/* Owned by the module from I2C_Queue_Submit() until Callback is called */
+typedef struct __I2C_Queue_JobTypeDef
+{
+  I2C_Queue_DeviceTypeDef         *pDevice;
+  const uint8_t                   *pTx;        /* Register address then data, sent first */
+  uint32_t                        TxSize;      /* 0: read only                           */
+  uint8_t                         *pRx;        /* Read after a repeated start            */
+  uint32_t                        RxSize;      /* 0: write only                          */
+  void                            (*Callback)(struct __I2C_Queue_JobTypeDef *pJob);
+  void                            *pContext;   /* Free for the caller                    */
+  __IO HAL_StatusTypeDef          Status;      /* HAL_BUSY until done                    */
+  struct __I2C_Queue_JobTypeDef   *pNext;      /* Reserved for the module                */
+} I2C_Queue_JobTypeDef;
+
+/* One per I2C instance, owned by the module from I2C_Queue_Init() on */
+typedef struct
+{
+  I2C_HandleTypeDef         *hi2c;
+  GPIO_TypeDef              *pSclPort;   /* Bus recovery pins, NULL: none           */
+  uint16_t                  SclPin;
+  GPIO_TypeDef              *pSdaPort;
+  uint16_t                  SdaPin;
+  I2C_Queue_JobTypeDef      *pHead;      /* Job in progress, then the waiting ones  */
+  I2C_Queue_JobTypeDef      *pTail;
+  uint32_t                  Running;     /* A context is starting jobs              */
+  uint32_t                  Reading;     /* Read phase of pHead in progress         */
+  uint32_t                  Last;        /* Phase ends with a STOP                  */
+  uint32_t                  Remaining;   /* Bytes of the phase not yet in NBYTES    */
+  uint32_t                  Pending;     /* Events ending the job                   */
+  uint32_t                  Start;       /* Tick of the job start                   */
+  HAL_StatusTypeDef         Result;
+  __IO uint32_t             Recover;     /* Bus recovery requested                  */
+  uint32_t                  Jobs;        /* Jobs done                               */
+  uint32_t                  Errors;      /* Jobs ended with an error or a timeout   */
+  uint32_t                  Recoveries;  /* Bus recoveries                          */
+} I2C_QueueTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Default job timeout in ms. Override in main.h. */
+#if !defined(I2C_QUEUE_TIMEOUT)
+#define I2C_QUEUE_TIMEOUT         10U
+#endif
+
+/* Half period of the recovery clock pulses in us. Override in main.h. */
+#if !defined(I2C_QUEUE_RECOVERY_US)
+#define I2C_QUEUE_RECOVERY_US     5U
+#endif
+
+/* I2C instances served at the same time. Override in main.h. */
+#if !defined(I2C_QUEUE_INSTANCES)
+#define I2C_QUEUE_INSTANCES       4U
+#endif
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef I2C_Queue_Init(I2C_QueueTypeDef *pQueue, I2C_HandleTypeDef *hi2c);
+HAL_StatusTypeDef I2C_Queue_DeInit(I2C_QueueTypeDef *pQueue);
+void              I2C_Queue_SetRecoveryPins(I2C_QueueTypeDef *pQueue, GPIO_TypeDef *pSclPort, uint16_t SclPin,
+                                            GPIO_TypeDef *pSdaPort, uint16_t SdaPin);
+HAL_StatusTypeDef I2C_Queue_Submit(I2C_QueueTypeDef *pQueue, I2C_Queue_JobTypeDef *pJob);
+uint32_t          I2C_Queue_IsIdle(I2C_QueueTypeDef *pQueue);
+void              I2C_Queue_Tick(I2C_QueueTypeDef *pQueue);
+
+void I2C_Queue_EV_IRQHandler(I2C_QueueTypeDef *pQueue);
+void I2C_Queue_ER_IRQHandler(I2C_QueueTypeDef *pQueue);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _I2C_QUEUE_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
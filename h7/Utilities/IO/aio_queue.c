@@ -0,0 +1,1076 @@
+/**
+  ******************************************************************************
+  * @file    aio_queue.c
+  * @author  MCD Application Team
+  * @brief   Asynchronous I/O requests over the HAL DMA drivers: per-device
+  *          request queues chained from the completion interrupts, completions
+  *          posted to queues the tasks poll or wait on.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- enable the drivers served in main.h (AIO_QUEUE_USE_UART, _SPI, _SD,
+   _QSPI): the module implements in their place the HAL completion and
+   error callbacks of the UART (Rx, Tx queue), SD (Rx, Tx, card ready) and
+   QSPI (Rx, Tx, command, timeout) drivers, the SPI ones being implemented
+   by spi_queue. Initialize each instance with the HAL, link its DMA, and
+   attach it with AIO_Device_InitUart(), _InitSd() or _InitQspi(); for
+   SPI, call SPI_Queue_Init() then AIO_Device_InitSpi() for each device on
+   the bus, with its chip select and mode.
+
+2- a request gives its operation, buffers, size, completion queue and a
+   context pointer free for the caller. AIO_Submit() never waits and may be
+   called from tasks and interrupts: the requests of a device are started
+   in submission order, the next one from the completion interrupt of the
+   previous one, before the completion is posted, so that the bus is not
+   left idle while the tasks handle the completions:
+     - UART: WRITE requests are queued on the HAL transmit queue
+       (HAL_UART_TxQueue_DMA()), sent back-to-back; READ requests receive
+       Size bytes with HAL_UART_Receive_DMA().
+     - SPI: requests become jobs of spi_queue, which serves the devices of
+       the bus in submission order. WRITE sends pData, READ receives in
+       pData, TRANSFER does both (pTxData, pData).
+     - SD: READ and WRITE of Size blocks from block Address. A WRITE is done
+       once the card has left the programming state
+       (HAL_SD_WaitCardReady_IT()), the next request then starts at once.
+     - QSPI: pCommand is sent with HAL_QSPI_Command(), NbData set to Size,
+       followed by the DMA data phase; COMMAND sends it without data phase
+       (HAL_QSPI_Command_IT()). Memory-mapped and auto-polling modes are
+       not served.
+
+3- a completion queue (AIO_CQ_TypeDef, AIO_CQ_Init()) collects the done
+   requests of any device, in completion order, Status holding the result.
+   AIO_CQ_Poll() takes up to Max of them at once without waiting,
+   AIO_CQ_Wait() waits for the first one: in a CMSIS-OS2 semaphore with
+   AIO_QUEUE_USE_OS, in WFI otherwise. A queue is read by one task; a task
+   may serve the requests of several devices from one queue. The request,
+   owned by the module from AIO_Submit(), is given back once taken from
+   the queue; without queue (pCq NULL), once Status leaves HAL_BUSY.
+
+4- DMA buffers must be in a RAM the DMA reaches (not the DTCM, SDMMC1 and
+   QSPI: AXI SRAM). With the data cache enabled the buffers written are
+   cleaned and the buffers read invalidated here: read buffers must start
+   on a cache line and fill whole lines (32 bytes).
+
+5- in C++20, co_await aio::submit(&dev, &req) suspends a coroutine until
+   the request is done; aio::dispatch() takes the completions of a queue
+   and resumes the coroutines waiting for them, in the calling task.
+
+6- errors: the request in progress ends with HAL_ERROR and the next one is
+   started. On a UART DMA transmit error the HAL drops its transmit queue:
+   the WRITE requests queued keep their HAL_BUSY status, check the UART
+   error code and abort them in the application.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "aio_queue.h"
+#include <stddef.h>
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define AIO_QUEUE_CACHE_LINE          32U
+
+/* Private macro -------------------------------------------------------------*/
+#define AIO_QUEUE_LOCK(__PRIMASK__)   do { (__PRIMASK__) = __get_PRIMASK(); __disable_irq(); } while(0)
+#define AIO_QUEUE_UNLOCK(__PRIMASK__) __set_PRIMASK(__PRIMASK__)
+
+/* Private variables ---------------------------------------------------------*/
+static AIO_DeviceTypeDef *AioDevices[AIO_QUEUE_DEVICES];
+
+/* Private function prototypes -----------------------------------------------*/
+#if (AIO_QUEUE_USE_UART == 1U) || (AIO_QUEUE_USE_SPI == 1U) || (AIO_QUEUE_USE_SD == 1U) || \
+    (AIO_QUEUE_USE_QSPI == 1U)
+static HAL_StatusTypeDef  AIO_Device_Register(AIO_DeviceTypeDef *pDev, uint32_t Type, void *hdev);
+#endif
+#if (AIO_QUEUE_USE_UART == 1U) || (AIO_QUEUE_USE_SD == 1U) || (AIO_QUEUE_USE_QSPI == 1U)
+static AIO_DeviceTypeDef *AIO_Device_Find(uint32_t Type, const void *hdev);
+static void               AIO_Done(AIO_DeviceTypeDef *pDev, HAL_StatusTypeDef Status);
+#endif
+static HAL_StatusTypeDef  AIO_Check(const AIO_DeviceTypeDef *pDev, const AIO_RequestTypeDef *pReq);
+static HAL_StatusTypeDef  AIO_Start(AIO_DeviceTypeDef *pDev, AIO_RequestTypeDef *pReq);
+static AIO_RequestTypeDef *AIO_Pop(AIO_DeviceTypeDef *pDev);
+static void               AIO_Run(AIO_DeviceTypeDef *pDev);
+static void               AIO_Complete(AIO_RequestTypeDef *pReq, HAL_StatusTypeDef Status);
+static uint32_t           AIO_Bytes(const AIO_RequestTypeDef *pReq);
+#if (AIO_QUEUE_USE_UART == 1U) || (AIO_QUEUE_USE_SPI == 1U)
+static void               AIO_Count(AIO_DeviceTypeDef *pDev, uint32_t Submitted);
+#endif
+#if (AIO_QUEUE_USE_SPI == 1U)
+static void               AIO_SpiDone(SPI_Queue_JobTypeDef *pJob);
+#endif
+static void               AIO_CacheClean(const void *pData, uint32_t Size);
+static void               AIO_CacheInvalidate(void *pData, uint32_t Size);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Initialize a completion queue
+  * @param  pCq: completion queue
+  * @retval HAL status
+  */
+HAL_StatusTypeDef AIO_CQ_Init(AIO_CQ_TypeDef *pCq)
+{
+  if (pCq == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  memset(pCq, 0, sizeof(AIO_CQ_TypeDef));
+
+#if (AIO_QUEUE_USE_OS == 1U)
+  pCq->Sem = osSemaphoreNew(0xFFFFU, 0U, NULL);
+  if (pCq->Sem == NULL)
+  {
+    return HAL_ERROR;
+  }
+#endif
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Release a completion queue, no request pointing to it in progress
+  * @param  pCq: completion queue
+  * @retval HAL status
+  */
+HAL_StatusTypeDef AIO_CQ_DeInit(AIO_CQ_TypeDef *pCq)
+{
+  if (pCq == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+#if (AIO_QUEUE_USE_OS == 1U)
+  if (pCq->Sem != NULL)
+  {
+    (void)osSemaphoreDelete(pCq->Sem);
+    pCq->Sem = NULL;
+  }
+#endif
+  pCq->pHead = NULL;
+  pCq->pTail = NULL;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Take the oldest completions without waiting
+  * @param  pCq: completion queue
+  * @param  ppReq: array receiving the done requests, oldest first
+  * @param  Max: size of ppReq
+  * @retval Number of requests taken
+  */
+uint32_t AIO_CQ_Poll(AIO_CQ_TypeDef *pCq, AIO_RequestTypeDef **ppReq, uint32_t Max)
+{
+  AIO_RequestTypeDef *pReq;
+  uint32_t primask;
+  uint32_t count = 0U;
+
+  if ((pCq == NULL) || (ppReq == NULL))
+  {
+    return 0U;
+  }
+
+  AIO_QUEUE_LOCK(primask);
+  while ((count < Max) && (pCq->pHead != NULL))
+  {
+    pReq = pCq->pHead;
+    pCq->pHead = pReq->pNext;
+    pReq->pNext = NULL;
+    ppReq[count] = pReq;
+    count++;
+  }
+  if (pCq->pHead == NULL)
+  {
+    pCq->pTail = NULL;
+  }
+  AIO_QUEUE_UNLOCK(primask);
+
+  return count;
+}
+
+/**
+  * @brief  Take the oldest completions, waiting for the first one
+  * @param  pCq: completion queue
+  * @param  ppReq: array receiving the done requests, oldest first
+  * @param  Max: size of ppReq
+  * @param  Timeout: in ms, AIO_WAIT_FOREVER
+  * @retval Number of requests taken, 0 on timeout
+  */
+uint32_t AIO_CQ_Wait(AIO_CQ_TypeDef *pCq, AIO_RequestTypeDef **ppReq, uint32_t Max, uint32_t Timeout)
+{
+  uint32_t count;
+#if (AIO_QUEUE_USE_OS == 1U)
+  uint32_t start = osKernelGetTickCount();
+  uint32_t elapsed;
+#else
+  uint32_t start = HAL_GetTick();
+  uint32_t primask;
+#endif
+
+  if ((pCq == NULL) || (ppReq == NULL) || (Max == 0U))
+  {
+    return 0U;
+  }
+
+  for (;;)
+  {
+    count = AIO_CQ_Poll(pCq, ppReq, Max);
+    if (count != 0U)
+    {
+      return count;
+    }
+
+#if (AIO_QUEUE_USE_OS == 1U)
+    /* Tokens of completions taken by a previous poll only cost a loop */
+    elapsed = osKernelGetTickCount() - start;
+    if ((Timeout != AIO_WAIT_FOREVER) && (elapsed >= Timeout))
+    {
+      return 0U;
+    }
+    (void)osSemaphoreAcquire(pCq->Sem, (Timeout == AIO_WAIT_FOREVER) ? osWaitForever : (Timeout - elapsed));
+#else
+    if ((Timeout != AIO_WAIT_FOREVER) && ((HAL_GetTick() - start) >= Timeout))
+    {
+      return 0U;
+    }
+
+    /* A completion posted between the check and WFI still wakes the core */
+    AIO_QUEUE_LOCK(primask);
+    if (pCq->pHead == NULL)
+    {
+      __WFI();
+    }
+    AIO_QUEUE_UNLOCK(primask);
+#endif
+  }
+}
+
+#if (AIO_QUEUE_USE_UART == 1U)
+/**
+  * @brief  Attach a UART instance
+  * @param  pDev: device context, kept by the module until AIO_Device_DeInit()
+  * @param  huart: UART handle, HAL_UART_Init() done, Tx and Rx DMA linked
+  * @retval HAL status
+  */
+HAL_StatusTypeDef AIO_Device_InitUart(AIO_DeviceTypeDef *pDev, UART_HandleTypeDef *huart)
+{
+  if ((huart == NULL) || (huart->hdmatx == NULL) || (huart->hdmarx == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  return AIO_Device_Register(pDev, AIO_DEVICE_UART, huart);
+}
+#endif /* AIO_QUEUE_USE_UART */
+
+#if (AIO_QUEUE_USE_SPI == 1U)
+/**
+  * @brief  Attach a device on a SPI bus served by spi_queue
+  * @param  pDev: device context, kept by the module until AIO_Device_DeInit()
+  * @param  pQueue: queue of the SPI instance, SPI_Queue_Init() done
+  * @param  pCsPort: chip select port, NULL if not handled
+  * @param  CsPin: chip select pin, active low
+  * @param  CLKPolarity: SPI_POLARITY_xxx
+  * @param  CLKPhase: SPI_PHASE_xxx
+  * @param  BaudRatePrescaler: SPI_BAUDRATEPRESCALER_xxx
+  * @retval HAL status
+  */
+HAL_StatusTypeDef AIO_Device_InitSpi(AIO_DeviceTypeDef *pDev, SPI_QueueTypeDef *pQueue,
+                                     GPIO_TypeDef *pCsPort, uint16_t CsPin, uint32_t CLKPolarity,
+                                     uint32_t CLKPhase, uint32_t BaudRatePrescaler)
+{
+  HAL_StatusTypeDef status;
+
+  if ((pQueue == NULL) || (pQueue->hspi == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  status = AIO_Device_Register(pDev, AIO_DEVICE_SPI, pQueue);
+  if (status == HAL_OK)
+  {
+    pDev->pCsPort           = pCsPort;
+    pDev->CsPin             = CsPin;
+    pDev->CLKPolarity       = CLKPolarity;
+    pDev->CLKPhase          = CLKPhase;
+    pDev->BaudRatePrescaler = BaudRatePrescaler;
+  }
+
+  return status;
+}
+#endif /* AIO_QUEUE_USE_SPI */
+
+#if (AIO_QUEUE_USE_SD == 1U)
+/**
+  * @brief  Attach a SD card
+  * @param  pDev: device context, kept by the module until AIO_Device_DeInit()
+  * @param  hsd: SD handle, HAL_SD_Init() done
+  * @retval HAL status
+  */
+HAL_StatusTypeDef AIO_Device_InitSd(AIO_DeviceTypeDef *pDev, SD_HandleTypeDef *hsd)
+{
+  if (hsd == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  return AIO_Device_Register(pDev, AIO_DEVICE_SD, hsd);
+}
+#endif /* AIO_QUEUE_USE_SD */
+
+#if (AIO_QUEUE_USE_QSPI == 1U)
+/**
+  * @brief  Attach a QSPI instance, in indirect mode
+  * @param  pDev: device context, kept by the module until AIO_Device_DeInit()
+  * @param  hqspi: QSPI handle, HAL_QSPI_Init() done, DMA linked
+  * @retval HAL status
+  */
+HAL_StatusTypeDef AIO_Device_InitQspi(AIO_DeviceTypeDef *pDev, QSPI_HandleTypeDef *hqspi)
+{
+  if ((hqspi == NULL) || (hqspi->hmdma == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  return AIO_Device_Register(pDev, AIO_DEVICE_QSPI, hqspi);
+}
+#endif /* AIO_QUEUE_USE_QSPI */
+
+/**
+  * @brief  Detach a device
+  * @param  pDev: device context
+  * @retval HAL_BUSY while requests are in progress, HAL status otherwise
+  */
+HAL_StatusTypeDef AIO_Device_DeInit(AIO_DeviceTypeDef *pDev)
+{
+  uint32_t i;
+
+  if (AIO_Device_IsIdle(pDev) == 0U)
+  {
+    return HAL_BUSY;
+  }
+
+  for (i = 0U; i < AIO_QUEUE_DEVICES; i++)
+  {
+    if (AioDevices[i] == pDev)
+    {
+      AioDevices[i] = NULL;
+      return HAL_OK;
+    }
+  }
+
+  return HAL_ERROR;
+}
+
+/**
+  * @brief  Check that all the submitted requests are done
+  * @param  pDev: device context
+  * @retval 1 when idle, 0 otherwise
+  */
+uint32_t AIO_Device_IsIdle(AIO_DeviceTypeDef *pDev)
+{
+  return ((pDev == NULL) || (pDev->Completed == pDev->Submitted)) ? 1U : 0U;
+}
+
+/**
+  * @brief  Queue a request, started at once when the device is idle
+  * @param  pDev: device context
+  * @param  pReq: request, owned by the module until it is done
+  * @retval HAL status, HAL_ERROR for a request the device does not serve
+  */
+HAL_StatusTypeDef AIO_Submit(AIO_DeviceTypeDef *pDev, AIO_RequestTypeDef *pReq)
+{
+  uint32_t primask;
+  uint32_t start = 0U;
+
+  if ((pDev == NULL) || (pReq == NULL) || (AIO_Check(pDev, pReq) != HAL_OK))
+  {
+    return HAL_ERROR;
+  }
+
+  pReq->Status = HAL_BUSY;
+  pReq->pDevice = pDev;
+  pReq->pNext = NULL;
+
+#if (AIO_QUEUE_USE_UART == 1U)
+  /* The HAL transmit queue chains the writes itself */
+  if ((pDev->Type == AIO_DEVICE_UART) && (pReq->Op == AIO_OP_WRITE))
+  {
+    pReq->Driver.Uart.Segment.pData = pReq->pData;
+    pReq->Driver.Uart.Segment.Size = (uint16_t)pReq->Size;
+    pReq->Driver.Uart.Desc.pSegments = &pReq->Driver.Uart.Segment;
+    pReq->Driver.Uart.Desc.NbSegments = 1U;
+    AIO_CacheClean(pReq->pData, pReq->Size);
+
+    AIO_Count(pDev, 1U);
+    if (HAL_UART_TxQueue_DMA((UART_HandleTypeDef *)pDev->hdev, &pReq->Driver.Uart.Desc) != HAL_OK)
+    {
+      AIO_Complete(pReq, HAL_ERROR);
+    }
+    return HAL_OK;
+  }
+#endif
+
+#if (AIO_QUEUE_USE_SPI == 1U)
+  /* spi_queue serves the devices of the bus in submission order */
+  if (pDev->Type == AIO_DEVICE_SPI)
+  {
+    SPI_Queue_JobTypeDef *pJob = &pReq->Driver.Spi.Job;
+
+    pReq->Driver.Spi.Segment.pTx = (pReq->Op == AIO_OP_WRITE) ? pReq->pData :
+                                   (pReq->Op == AIO_OP_TRANSFER) ? pReq->pTxData : NULL;
+    pReq->Driver.Spi.Segment.pRx = (pReq->Op == AIO_OP_WRITE) ? NULL : pReq->pData;
+    pReq->Driver.Spi.Segment.Size = (uint16_t)pReq->Size;
+
+    memset(pJob, 0, sizeof(SPI_Queue_JobTypeDef));
+    pJob->pCsPort           = pDev->pCsPort;
+    pJob->CsPin             = pDev->CsPin;
+    pJob->CLKPolarity       = pDev->CLKPolarity;
+    pJob->CLKPhase          = pDev->CLKPhase;
+    pJob->BaudRatePrescaler = pDev->BaudRatePrescaler;
+    pJob->pSegments         = &pReq->Driver.Spi.Segment;
+    pJob->NbSegments        = 1U;
+    pJob->Callback          = AIO_SpiDone;
+    pJob->pContext          = pReq;
+
+    AIO_Count(pDev, 1U);
+    if (SPI_Queue_Submit((SPI_QueueTypeDef *)pDev->hdev, pJob) != HAL_OK)
+    {
+      AIO_Complete(pReq, HAL_ERROR);
+    }
+    return HAL_OK;
+  }
+#endif
+
+  AIO_QUEUE_LOCK(primask);
+  if (pDev->pTail != NULL)
+  {
+    pDev->pTail->pNext = pReq;
+  }
+  else
+  {
+    pDev->pHead = pReq;
+  }
+  pDev->pTail = pReq;
+  pDev->Submitted++;
+  if (pDev->Running == 0U)
+  {
+    pDev->Running = 1U;
+    start = 1U;
+  }
+  AIO_QUEUE_UNLOCK(primask);
+
+  if (start != 0U)
+  {
+    AIO_Run(pDev);
+  }
+
+  return HAL_OK;
+}
+
+#if (AIO_QUEUE_USE_UART == 1U)
+/**
+  * @brief  Rx Transfer completed callback, next read
+  * @param  huart: UART handle
+  * @retval None
+  */
+void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
+{
+  AIO_Done(AIO_Device_Find(AIO_DEVICE_UART, huart), HAL_OK);
+}
+
+/**
+  * @brief  Transmit queue descriptor sent callback, completes its write
+  * @param  huart: UART handle
+  * @param  pDesc: descriptor sent
+  * @retval None
+  */
+void HAL_UART_TxQueueCpltCallback(UART_HandleTypeDef *huart, UART_TxDescTypeDef *pDesc)
+{
+  AIO_RequestTypeDef *pReq = (AIO_RequestTypeDef *)(void *)
+                             ((uint8_t *)pDesc - offsetof(AIO_RequestTypeDef, Driver.Uart.Desc));
+
+  UNUSED(huart);
+  AIO_Complete(pReq, HAL_OK);
+}
+
+/**
+  * @brief  UART error callback, a read aborted by the HAL ends with HAL_ERROR
+  * @param  huart: UART handle
+  * @retval None
+  */
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
+{
+  if (huart->RxState == HAL_UART_STATE_READY)
+  {
+    AIO_Done(AIO_Device_Find(AIO_DEVICE_UART, huart), HAL_ERROR);
+  }
+}
+#endif /* AIO_QUEUE_USE_UART */
+
+#if (AIO_QUEUE_USE_SD == 1U)
+/**
+  * @brief  Rx Transfer completed callback, next request
+  * @param  hsd: SD handle
+  * @retval None
+  */
+void HAL_SD_RxCpltCallback(SD_HandleTypeDef *hsd)
+{
+  AIO_DeviceTypeDef *pDev = AIO_Device_Find(AIO_DEVICE_SD, hsd);
+
+  if (pDev != NULL)
+  {
+    AIO_Done(pDev, (pDev->Error == 0U) ? HAL_OK : HAL_ERROR);
+  }
+}
+
+/**
+  * @brief  Tx Transfer completed callback, waits for the end of programming
+  * @param  hsd: SD handle
+  * @retval None
+  */
+void HAL_SD_TxCpltCallback(SD_HandleTypeDef *hsd)
+{
+  AIO_DeviceTypeDef *pDev = AIO_Device_Find(AIO_DEVICE_SD, hsd);
+
+  if (pDev != NULL)
+  {
+    if ((pDev->Error != 0U) || (HAL_SD_WaitCardReady_IT(hsd) != HAL_OK))
+    {
+      AIO_Done(pDev, HAL_ERROR);
+    }
+  }
+}
+
+/**
+  * @brief  Card ready callback, the write is done
+  * @param  hsd: SD handle
+  * @retval None
+  */
+void HAL_SD_CardReadyCallback(SD_HandleTypeDef *hsd)
+{
+  AIO_Done(AIO_Device_Find(AIO_DEVICE_SD, hsd),
+           (HAL_SD_GetError(hsd) == HAL_SD_ERROR_NONE) ? HAL_OK : HAL_ERROR);
+}
+
+/**
+  * @brief  SD error callback. Reported during the transfer, the request ends
+  *         with HAL_ERROR; reported before the completion callback (stop
+  *         command), it ends with HAL_ERROR in that callback.
+  * @param  hsd: SD handle
+  * @retval None
+  */
+void HAL_SD_ErrorCallback(SD_HandleTypeDef *hsd)
+{
+  AIO_DeviceTypeDef *pDev = AIO_Device_Find(AIO_DEVICE_SD, hsd);
+
+  if (pDev != NULL)
+  {
+    if (hsd->State == HAL_SD_STATE_READY)
+    {
+      AIO_Done(pDev, HAL_ERROR);
+    }
+    else
+    {
+      pDev->Error = 1U;
+    }
+  }
+}
+#endif /* AIO_QUEUE_USE_SD */
+
+#if (AIO_QUEUE_USE_QSPI == 1U)
+/**
+  * @brief  Rx Transfer completed callback, next request
+  * @param  hqspi: QSPI handle
+  * @retval None
+  */
+void HAL_QSPI_RxCpltCallback(QSPI_HandleTypeDef *hqspi)
+{
+  AIO_Done(AIO_Device_Find(AIO_DEVICE_QSPI, hqspi), HAL_OK);
+}
+
+/**
+  * @brief  Tx Transfer completed callback, next request
+  * @param  hqspi: QSPI handle
+  * @retval None
+  */
+void HAL_QSPI_TxCpltCallback(QSPI_HandleTypeDef *hqspi)
+{
+  AIO_Done(AIO_Device_Find(AIO_DEVICE_QSPI, hqspi), HAL_OK);
+}
+
+/**
+  * @brief  Command completed callback, next request
+  * @param  hqspi: QSPI handle
+  * @retval None
+  */
+void HAL_QSPI_CmdCpltCallback(QSPI_HandleTypeDef *hqspi)
+{
+  AIO_Done(AIO_Device_Find(AIO_DEVICE_QSPI, hqspi), HAL_OK);
+}
+
+/**
+  * @brief  QSPI error callback, the request in progress ends with HAL_ERROR
+  * @param  hqspi: QSPI handle
+  * @retval None
+  */
+void HAL_QSPI_ErrorCallback(QSPI_HandleTypeDef *hqspi)
+{
+  AIO_Done(AIO_Device_Find(AIO_DEVICE_QSPI, hqspi), HAL_ERROR);
+}
+
+/**
+  * @brief  QSPI timeout callback, the request in progress ends with HAL_ERROR
+  * @param  hqspi: QSPI handle
+  * @retval None
+  */
+void HAL_QSPI_TimeOutCallback(QSPI_HandleTypeDef *hqspi)
+{
+  AIO_Done(AIO_Device_Find(AIO_DEVICE_QSPI, hqspi), HAL_ERROR);
+}
+#endif /* AIO_QUEUE_USE_QSPI */
+
+/* Private functions ---------------------------------------------------------*/
+
+#if (AIO_QUEUE_USE_UART == 1U) || (AIO_QUEUE_USE_SPI == 1U) || (AIO_QUEUE_USE_SD == 1U) || \
+    (AIO_QUEUE_USE_QSPI == 1U)
+/**
+  * @brief  Reset a device context and register it
+  * @param  pDev: device context
+  * @param  Type: AIO_DEVICE_xxx
+  * @param  hdev: HAL handle, SPI: spi_queue context
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef AIO_Device_Register(AIO_DeviceTypeDef *pDev, uint32_t Type, void *hdev)
+{
+  uint32_t i;
+  uint32_t slot = AIO_QUEUE_DEVICES;
+
+  if (pDev == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  for (i = 0U; i < AIO_QUEUE_DEVICES; i++)
+  {
+    /* Devices on a SPI bus share its queue */
+    if ((AioDevices[i] != NULL) &&
+        ((AioDevices[i] == pDev) || ((Type != AIO_DEVICE_SPI) && (AioDevices[i]->hdev == hdev))))
+    {
+      return HAL_BUSY;
+    }
+    if ((AioDevices[i] == NULL) && (slot == AIO_QUEUE_DEVICES))
+    {
+      slot = i;
+    }
+  }
+  if (slot == AIO_QUEUE_DEVICES)
+  {
+    return HAL_ERROR;
+  }
+
+  memset(pDev, 0, sizeof(AIO_DeviceTypeDef));
+  pDev->Type = Type;
+  pDev->hdev = hdev;
+  AioDevices[slot] = pDev;
+
+  return HAL_OK;
+}
+#endif
+
+#if (AIO_QUEUE_USE_UART == 1U) || (AIO_QUEUE_USE_SD == 1U) || (AIO_QUEUE_USE_QSPI == 1U)
+/**
+  * @brief  Device attached to a HAL handle
+  * @param  Type: AIO_DEVICE_xxx
+  * @param  hdev: HAL handle
+  * @retval Device, NULL if none
+  */
+static AIO_DeviceTypeDef *AIO_Device_Find(uint32_t Type, const void *hdev)
+{
+  uint32_t i;
+
+  for (i = 0U; i < AIO_QUEUE_DEVICES; i++)
+  {
+    if ((AioDevices[i] != NULL) && (AioDevices[i]->Type == Type) && (AioDevices[i]->hdev == hdev))
+    {
+      return AioDevices[i];
+    }
+  }
+
+  return NULL;
+}
+#endif
+
+/**
+  * @brief  Check that the device serves a request
+  * @param  pDev: device context
+  * @param  pReq: request
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef AIO_Check(const AIO_DeviceTypeDef *pDev, const AIO_RequestTypeDef *pReq)
+{
+  uint32_t ok = 0U;
+
+  switch (pDev->Type)
+  {
+  case AIO_DEVICE_UART:
+    ok = (((pReq->Op == AIO_OP_READ) || (pReq->Op == AIO_OP_WRITE)) &&
+          (pReq->pData != NULL) && (pReq->Size != 0U) && (pReq->Size <= 0xFFFFU)) ? 1U : 0U;
+    break;
+
+  case AIO_DEVICE_SPI:
+    ok = ((((pReq->Op == AIO_OP_READ) || (pReq->Op == AIO_OP_WRITE)) && (pReq->pData != NULL)) ||
+          ((pReq->Op == AIO_OP_TRANSFER) && ((pReq->pData != NULL) || (pReq->pTxData != NULL)))) ? 1U : 0U;
+    ok = ((ok != 0U) && (pReq->Size != 0U) && (pReq->Size <= 0xFFFFU)) ? 1U : 0U;
+    break;
+
+  case AIO_DEVICE_SD:
+    ok = (((pReq->Op == AIO_OP_READ) || (pReq->Op == AIO_OP_WRITE)) &&
+          (pReq->pData != NULL) && (pReq->Size != 0U)) ? 1U : 0U;
+    break;
+
+  case AIO_DEVICE_QSPI:
+    ok = ((pReq->pCommand != NULL) &&
+          ((pReq->Op == AIO_OP_COMMAND) ||
+           (((pReq->Op == AIO_OP_READ) || (pReq->Op == AIO_OP_WRITE)) &&
+            (pReq->pData != NULL) && (pReq->Size != 0U)))) ? 1U : 0U;
+    break;
+
+  default:
+    break;
+  }
+
+  return (ok != 0U) ? HAL_OK : HAL_ERROR;
+}
+
+/**
+  * @brief  Start a request of a UART (read), SD or QSPI device
+  * @param  pDev: device context
+  * @param  pReq: request at the head of the device queue
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef AIO_Start(AIO_DeviceTypeDef *pDev, AIO_RequestTypeDef *pReq)
+{
+  HAL_StatusTypeDef status = HAL_ERROR;
+
+  pDev->Error = 0U;
+
+  if (pReq->Op == AIO_OP_WRITE)
+  {
+    AIO_CacheClean(pReq->pData, AIO_Bytes(pReq));
+  }
+  else if (pReq->Op == AIO_OP_READ)
+  {
+    AIO_CacheInvalidate(pReq->pData, AIO_Bytes(pReq));
+  }
+  else
+  {
+    /* No data */
+  }
+
+  switch (pDev->Type)
+  {
+#if (AIO_QUEUE_USE_UART == 1U)
+  case AIO_DEVICE_UART:
+    status = HAL_UART_Receive_DMA((UART_HandleTypeDef *)pDev->hdev, pReq->pData, (uint16_t)pReq->Size);
+    break;
+#endif
+
+#if (AIO_QUEUE_USE_SD == 1U)
+  case AIO_DEVICE_SD:
+    status = (pReq->Op == AIO_OP_READ) ?
+             HAL_SD_ReadBlocks_DMA((SD_HandleTypeDef *)pDev->hdev, pReq->pData, pReq->Address, pReq->Size) :
+             HAL_SD_WriteBlocks_DMA((SD_HandleTypeDef *)pDev->hdev, pReq->pData, pReq->Address, pReq->Size);
+    break;
+#endif
+
+#if (AIO_QUEUE_USE_QSPI == 1U)
+  case AIO_DEVICE_QSPI:
+    {
+      QSPI_HandleTypeDef *hqspi = (QSPI_HandleTypeDef *)pDev->hdev;
+      QSPI_CommandTypeDef *pCmd = (QSPI_CommandTypeDef *)pReq->pCommand;
+
+      if (pReq->Op == AIO_OP_COMMAND)
+      {
+        status = HAL_QSPI_Command_IT(hqspi, pCmd);
+      }
+      else
+      {
+        /* The command phase is only programmed: the DMA phase starts it */
+        pCmd->NbData = pReq->Size;
+        status = HAL_QSPI_Command(hqspi, pCmd, HAL_QPSI_TIMEOUT_DEFAULT_VALUE);
+        if (status == HAL_OK)
+        {
+          status = (pReq->Op == AIO_OP_READ) ? HAL_QSPI_Receive_DMA(hqspi, pReq->pData) :
+                                               HAL_QSPI_Transmit_DMA(hqspi, pReq->pData);
+        }
+      }
+    }
+    break;
+#endif
+
+  default:
+    break;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Remove the request at the head of a device queue
+  * @param  pDev: device context
+  * @retval Request, NULL if none
+  */
+static AIO_RequestTypeDef *AIO_Pop(AIO_DeviceTypeDef *pDev)
+{
+  AIO_RequestTypeDef *pReq;
+  uint32_t primask;
+
+  AIO_QUEUE_LOCK(primask);
+  pReq = pDev->pHead;
+  if (pReq != NULL)
+  {
+    pDev->pHead = pReq->pNext;
+    if (pDev->pHead == NULL)
+    {
+      pDev->pTail = NULL;
+    }
+    pReq->pNext = NULL;
+  }
+  AIO_QUEUE_UNLOCK(primask);
+
+  return pReq;
+}
+
+/**
+  * @brief  Start the request at the head of a device queue. Requests failing
+  *         to start are completed here. Called by the context owning the
+  *         Running flag, which is released once the queue is empty.
+  * @param  pDev: device context
+  * @retval None
+  */
+static void AIO_Run(AIO_DeviceTypeDef *pDev)
+{
+  AIO_RequestTypeDef *pReq;
+  uint32_t primask;
+
+  for (;;)
+  {
+    AIO_QUEUE_LOCK(primask);
+    pReq = pDev->pHead;
+    if (pReq == NULL)
+    {
+      pDev->Running = 0U;
+    }
+    AIO_QUEUE_UNLOCK(primask);
+
+    if (pReq == NULL)
+    {
+      return;
+    }
+
+    if (AIO_Start(pDev, pReq) == HAL_OK)
+    {
+      return;
+    }
+
+    (void)AIO_Pop(pDev);
+    AIO_Complete(pReq, HAL_ERROR);
+  }
+}
+
+#if (AIO_QUEUE_USE_UART == 1U) || (AIO_QUEUE_USE_SD == 1U) || (AIO_QUEUE_USE_QSPI == 1U)
+/**
+  * @brief  Request in progress done: start the next one, then post it
+  * @param  pDev: device context, NULL ignored
+  * @param  Status: request result
+  * @retval None
+  */
+static void AIO_Done(AIO_DeviceTypeDef *pDev, HAL_StatusTypeDef Status)
+{
+  AIO_RequestTypeDef *pReq;
+
+  if ((pDev == NULL) || (pDev->Running == 0U))
+  {
+    return;
+  }
+
+  pReq = AIO_Pop(pDev);
+  if (pReq == NULL)
+  {
+    return;
+  }
+
+  /* Lines fetched by speculative reads during the DMA transfer */
+  if ((Status == HAL_OK) && (pReq->Op == AIO_OP_READ))
+  {
+    AIO_CacheInvalidate(pReq->pData, AIO_Bytes(pReq));
+  }
+
+  /* The bus goes on with the next request while the tasks handle this one */
+  AIO_Run(pDev);
+  AIO_Complete(pReq, Status);
+}
+#endif
+
+/**
+  * @brief  Set the result of a request and post it to its completion queue
+  * @param  pReq: request done
+  * @param  Status: request result
+  * @retval None
+  */
+static void AIO_Complete(AIO_RequestTypeDef *pReq, HAL_StatusTypeDef Status)
+{
+  AIO_DeviceTypeDef *pDev = pReq->pDevice;
+  AIO_CQ_TypeDef *pCq = pReq->pCq;
+  uint32_t primask;
+
+  AIO_QUEUE_LOCK(primask);
+  pDev->Completed++;
+  if (Status != HAL_OK)
+  {
+    pDev->Errors++;
+  }
+  pReq->Status = Status;
+  if (pCq != NULL)
+  {
+    pReq->pNext = NULL;
+    if (pCq->pTail != NULL)
+    {
+      pCq->pTail->pNext = pReq;
+    }
+    else
+    {
+      pCq->pHead = pReq;
+    }
+    pCq->pTail = pReq;
+    pCq->Posted++;
+  }
+  AIO_QUEUE_UNLOCK(primask);
+
+#if (AIO_QUEUE_USE_OS == 1U)
+  if (pCq != NULL)
+  {
+    (void)osSemaphoreRelease(pCq->Sem);
+  }
+#endif
+}
+
+/**
+  * @brief  Bytes moved by a request
+  * @param  pReq: request
+  * @retval Size in bytes
+  */
+static uint32_t AIO_Bytes(const AIO_RequestTypeDef *pReq)
+{
+#if (AIO_QUEUE_USE_SD == 1U)
+  if (pReq->pDevice->Type == AIO_DEVICE_SD)
+  {
+    return pReq->Size * BLOCKSIZE;
+  }
+#endif
+  return pReq->Size;
+}
+
+#if (AIO_QUEUE_USE_UART == 1U) || (AIO_QUEUE_USE_SPI == 1U)
+/**
+  * @brief  Count requests handed to a driver queue
+  * @param  pDev: device context
+  * @param  Submitted: requests
+  * @retval None
+  */
+static void AIO_Count(AIO_DeviceTypeDef *pDev, uint32_t Submitted)
+{
+  uint32_t primask;
+
+  AIO_QUEUE_LOCK(primask);
+  pDev->Submitted += Submitted;
+  AIO_QUEUE_UNLOCK(primask);
+}
+#endif
+
+#if (AIO_QUEUE_USE_SPI == 1U)
+/**
+  * @brief  spi_queue job done, completes its request
+  * @param  pJob: job of the request
+  * @retval None
+  */
+static void AIO_SpiDone(SPI_Queue_JobTypeDef *pJob)
+{
+  AIO_Complete((AIO_RequestTypeDef *)pJob->pContext, pJob->Status);
+}
+#endif
+
+/**
+  * @brief  Write back the data cache lines of a DMA source buffer
+  * @param  pData: buffer
+  * @param  Size: size in bytes
+  * @retval None
+  */
+static void AIO_CacheClean(const void *pData, uint32_t Size)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if ((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    uint32_t start = (uint32_t)pData & ~(AIO_QUEUE_CACHE_LINE - 1U);
+    SCB_CleanDCache_by_Addr((uint32_t *)start, (int32_t)(((uint32_t)pData + Size) - start));
+  }
+#else
+  UNUSED(pData);
+  UNUSED(Size);
+#endif
+}
+
+/**
+  * @brief  Drop the data cache lines of a DMA destination buffer
+  * @param  pData: buffer, cache line aligned
+  * @param  Size: size in bytes
+  * @retval None
+  */
+static void AIO_CacheInvalidate(void *pData, uint32_t Size)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if ((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    SCB_InvalidateDCache_by_Addr((uint32_t *)pData, (int32_t)Size);
+  }
+#else
+  UNUSED(pData);
+  UNUSED(Size);
+#endif
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
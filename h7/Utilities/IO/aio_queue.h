@@ -0,0 +1,303 @@
+/**
+  ******************************************************************************
+  * @file    aio_queue.h
+  * @author  MCD Application Team
+  * @brief   Header for aio_queue module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _AIO_QUEUE_H__
+#define _AIO_QUEUE_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported constants --------------------------------------------------------*/
+/* Drivers served, 1 to enable: the module then implements the HAL completion
+   callbacks of the driver. Override in main.h. */
+#if !defined(AIO_QUEUE_USE_UART)
+#define AIO_QUEUE_USE_UART             0U
+#endif
+
+#if !defined(AIO_QUEUE_USE_SPI)
+#define AIO_QUEUE_USE_SPI              0U
+#endif
+
+#if !defined(AIO_QUEUE_USE_SD)
+#define AIO_QUEUE_USE_SD               0U
+#endif
+
+#if !defined(AIO_QUEUE_USE_QSPI)
+#define AIO_QUEUE_USE_QSPI             0U
+#endif
+
+/* 1: AIO_CQ_Wait() blocks on a CMSIS-OS2 semaphore, 0: in WFI. Override in
+   main.h. */
+#if !defined(AIO_QUEUE_USE_OS)
+#define AIO_QUEUE_USE_OS               0U
+#endif
+
+/* Devices served at the same time. Override in main.h. */
+#if !defined(AIO_QUEUE_DEVICES)
+#define AIO_QUEUE_DEVICES              4U
+#endif
+
+#if (AIO_QUEUE_USE_UART == 1U) && !defined(HAL_UART_MODULE_ENABLED)
+#error "AIO_QUEUE_USE_UART requires the HAL UART driver (HAL_UART_MODULE_ENABLED)"
+#endif
+#if (AIO_QUEUE_USE_SD == 1U) && !defined(HAL_SD_MODULE_ENABLED)
+#error "AIO_QUEUE_USE_SD requires the HAL SD driver (HAL_SD_MODULE_ENABLED)"
+#endif
+#if (AIO_QUEUE_USE_QSPI == 1U) && !defined(HAL_QSPI_MODULE_ENABLED)
+#error "AIO_QUEUE_USE_QSPI requires the HAL QSPI driver (HAL_QSPI_MODULE_ENABLED)"
+#endif
+
+#if (AIO_QUEUE_USE_SPI == 1U)
+#include "spi_queue.h"
+#endif
+#if (AIO_QUEUE_USE_OS == 1U)
+#include "cmsis_os2.h"
+#endif
+
+/* Request operations */
+#define AIO_OP_READ                    0U   /* Device to pData                          */
+#define AIO_OP_WRITE                   1U   /* pData to device                          */
+#define AIO_OP_TRANSFER                2U   /* SPI: pTxData out and pData in at once    */
+#define AIO_OP_COMMAND                 3U   /* QSPI: command without data phase         */
+
+/* Device types */
+#define AIO_DEVICE_UART                0U
+#define AIO_DEVICE_SPI                 1U
+#define AIO_DEVICE_SD                  2U
+#define AIO_DEVICE_QSPI                3U
+
+#define AIO_WAIT_FOREVER               0xFFFFFFFFU
+
+/* Exported types ------------------------------------------------------------*/
+struct __AIO_RequestTypeDef;
+struct __AIO_DeviceTypeDef;
+
+/* Completed requests, posted from the interrupts, taken by the tasks */
+typedef struct
+{
+  struct __AIO_RequestTypeDef  *pHead;    /* Oldest completion                       */
+  struct __AIO_RequestTypeDef  *pTail;
+  uint32_t                     Posted;    /* Completions posted                      */
+#if (AIO_QUEUE_USE_OS == 1U)
+  osSemaphoreId_t              Sem;       /* Released on each completion             */
+#endif
+} AIO_CQ_TypeDef;
+
+/* Owned by the module from AIO_Submit() until it is taken from its
+   completion queue, or its Status leaves HAL_BUSY without queue */
+typedef struct __AIO_RequestTypeDef
+{
+  uint32_t                     Op;        /* AIO_OP_xxx                              */
+  uint8_t                      *pData;    /* READ, WRITE, TRANSFER: Rx, may be NULL  */
+  const uint8_t                *pTxData;  /* TRANSFER: Tx, may be NULL               */
+  uint32_t                     Size;      /* Bytes, SPI: frames, SD: blocks          */
+  uint32_t                     Address;   /* SD: first block                         */
+  void                         *pCommand; /* QSPI: QSPI_CommandTypeDef, kept as is   */
+  AIO_CQ_TypeDef               *pCq;      /* Completion queue, NULL: none            */
+  void                         *pContext; /* Free for the caller                     */
+  __IO HAL_StatusTypeDef       Status;    /* HAL_BUSY until done                     */
+  void                         *pAwaiter; /* NULL, set by co_await aio::submit()     */
+  struct __AIO_DeviceTypeDef   *pDevice;  /* Reserved for the module                 */
+  struct __AIO_RequestTypeDef  *pNext;    /* Reserved for the module                 */
+  union
+  {
+#if (AIO_QUEUE_USE_UART == 1U)
+    struct
+    {
+      UART_TxSegmentTypeDef    Segment;
+      UART_TxDescTypeDef       Desc;
+    } Uart;
+#endif
+#if (AIO_QUEUE_USE_SPI == 1U)
+    struct
+    {
+      SPI_Queue_SegmentTypeDef Segment;
+      SPI_Queue_JobTypeDef     Job;
+    } Spi;
+#endif
+    uint32_t                   None;
+  } Driver;                               /* Reserved for the module                 */
+} AIO_RequestTypeDef;
+
+/* One per UART, SD or QSPI instance, one per device on a SPI bus */
+typedef struct __AIO_DeviceTypeDef
+{
+  uint32_t                     Type;      /* AIO_DEVICE_xxx                          */
+  void                         *hdev;     /* HAL handle, SPI: SPI_QueueTypeDef       */
+  GPIO_TypeDef                 *pCsPort;  /* SPI: chip select, NULL: not handled     */
+  uint16_t                     CsPin;
+  uint32_t                     CLKPolarity;       /* SPI: SPI_POLARITY_xxx           */
+  uint32_t                     CLKPhase;          /* SPI: SPI_PHASE_xxx              */
+  uint32_t                     BaudRatePrescaler; /* SPI: SPI_BAUDRATEPRESCALER_xxx  */
+  AIO_RequestTypeDef           *pHead;    /* Request in progress, then waiting ones  */
+  AIO_RequestTypeDef           *pTail;
+  uint32_t                     Running;   /* A context is starting requests          */
+  uint32_t                     Error;     /* SD: error reported before the completion */
+  uint32_t                     Submitted; /* Requests accepted                       */
+  uint32_t                     Completed; /* Requests done                           */
+  uint32_t                     Errors;    /* Requests ended with an error            */
+} AIO_DeviceTypeDef;
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef AIO_CQ_Init(AIO_CQ_TypeDef *pCq);
+HAL_StatusTypeDef AIO_CQ_DeInit(AIO_CQ_TypeDef *pCq);
+uint32_t          AIO_CQ_Poll(AIO_CQ_TypeDef *pCq, AIO_RequestTypeDef **ppReq, uint32_t Max);
+uint32_t          AIO_CQ_Wait(AIO_CQ_TypeDef *pCq, AIO_RequestTypeDef **ppReq, uint32_t Max, uint32_t Timeout);
+
+#if (AIO_QUEUE_USE_UART == 1U)
+HAL_StatusTypeDef AIO_Device_InitUart(AIO_DeviceTypeDef *pDev, UART_HandleTypeDef *huart);
+#endif
+#if (AIO_QUEUE_USE_SPI == 1U)
+HAL_StatusTypeDef AIO_Device_InitSpi(AIO_DeviceTypeDef *pDev, SPI_QueueTypeDef *pQueue,
+                                     GPIO_TypeDef *pCsPort, uint16_t CsPin, uint32_t CLKPolarity,
+                                     uint32_t CLKPhase, uint32_t BaudRatePrescaler);
+#endif
+#if (AIO_QUEUE_USE_SD == 1U)
+HAL_StatusTypeDef AIO_Device_InitSd(AIO_DeviceTypeDef *pDev, SD_HandleTypeDef *hsd);
+#endif
+#if (AIO_QUEUE_USE_QSPI == 1U)
+HAL_StatusTypeDef AIO_Device_InitQspi(AIO_DeviceTypeDef *pDev, QSPI_HandleTypeDef *hqspi);
+#endif
+HAL_StatusTypeDef AIO_Device_DeInit(AIO_DeviceTypeDef *pDev);
+uint32_t          AIO_Device_IsIdle(AIO_DeviceTypeDef *pDev);
+
+HAL_StatusTypeDef AIO_Submit(AIO_DeviceTypeDef *pDev, AIO_RequestTypeDef *pReq);
+
+#ifdef __cplusplus
+}
+#endif
+
+#if defined(__cplusplus) && defined(__cpp_impl_coroutine)
+#include <coroutine>
+
+namespace aio
+{
+
+/* co_await aio::submit(&dev, &req) suspends the coroutine until the request
+   is done and returns its status. The coroutine is resumed by aio::dispatch()
+   on the completion queue of the request, in the task calling it. */
+class SubmitAwaitable
+{
+public:
+  SubmitAwaitable(AIO_DeviceTypeDef *pDev, AIO_RequestTypeDef *pReq) noexcept
+    : pDev_(pDev), pReq_(pReq)
+  {
+  }
+
+  bool await_ready() const noexcept
+  {
+    return false;
+  }
+
+  /* Not suspended when the request is refused. Once submitted, the request
+     may complete and the coroutine resume before this function returns:
+     nothing of *this is used after AIO_Submit(). */
+  bool await_suspend(std::coroutine_handle<> handle) noexcept
+  {
+    AIO_RequestTypeDef *pReq = pReq_;
+
+    if (pReq->pCq == NULL)
+    {
+      pReq->Status = HAL_ERROR;
+      return false;
+    }
+    pReq->pAwaiter = handle.address();
+    if (AIO_Submit(pDev_, pReq) != HAL_OK)
+    {
+      pReq->pAwaiter = NULL;
+      pReq->Status = HAL_ERROR;
+      return false;
+    }
+    return true;
+  }
+
+  HAL_StatusTypeDef await_resume() const noexcept
+  {
+    return pReq_->Status;
+  }
+
+private:
+  AIO_DeviceTypeDef  *pDev_;
+  AIO_RequestTypeDef *pReq_;
+};
+
+inline SubmitAwaitable submit(AIO_DeviceTypeDef *pDev, AIO_RequestTypeDef *pReq) noexcept
+{
+  return SubmitAwaitable(pDev, pReq);
+}
+
+/* Take up to Max completions, waiting up to Timeout ms for the first one (0:
+   poll), resume the coroutines awaiting them and return the other requests
+   in ppReq, their number as result. */
+inline uint32_t dispatch(AIO_CQ_TypeDef *pCq, AIO_RequestTypeDef **ppReq, uint32_t Max,
+                         uint32_t Timeout = 0U) noexcept
+{
+  uint32_t count = (Timeout == 0U) ? AIO_CQ_Poll(pCq, ppReq, Max) : AIO_CQ_Wait(pCq, ppReq, Max, Timeout);
+  uint32_t kept = 0U;
+
+  for (uint32_t i = 0U; i < count; i++)
+  {
+    void *pAwaiter = ppReq[i]->pAwaiter;
+
+    if (pAwaiter != NULL)
+    {
+      /* The coroutine may submit the request again */
+      ppReq[i]->pAwaiter = NULL;
+      std::coroutine_handle<>::from_address(pAwaiter).resume();
+    }
+    else
+    {
+      ppReq[kept++] = ppReq[i];
+    }
+  }
+
+  return kept;
+}
+
+} /* namespace aio */
+#endif /* __cpp_impl_coroutine */
+
+#endif /* _AIO_QUEUE_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,621 @@
+/**
+  ******************************************************************************
+  * @file    hsem_queue.c
+  * @author  MCD Application Team
+  * @brief   Shared memory message queue between bus masters, lock-free for
+  *          a single producer, with hardware semaphore wake-up.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- reserve the shared area in SRAM4 (RAM_D3, reachable by the BDMA and by
+   every bus master), 32-byte aligned, HSEM_QUEUE_SIZE(Slots, SlotSize)
+   bytes: DMA_Pool_Alloc(DMA_POOL_RAM_D3, ...) or a buffer placed in the
+   .dma_d3 section. Each slot header and each payload start on their own
+   D-cache line, as do the producer and consumer indexes: cleaning or
+   invalidating one never touches data written by the other side.
+
+2- HSEM_Queue_Init() formats the area, on one side only. Any other handle
+   on the same area, another producer or the consumer, uses
+   HSEM_Queue_Attach() once it is formatted. A handle serves one context:
+   one handle per producer, a single consumer handle.
+
+3- producers: HSEM_Queue_Send() copies a message, or HSEM_Queue_Reserve()
+   gives the payload of the next slot to fill in place (by the CPU or a
+   BDMA transfer) and HSEM_Queue_Commit() publishes it. With a single
+   producer (LockSem HSEM_QUEUE_NO_SEM) no lock is taken; with several the
+   slot claim, a few instructions, is serialized by the LockSem hardware
+   semaphore and by masking the interrupts of the calling core.
+
+4- consumer: HSEM_Queue_Receive() copies the next message out, or
+   HSEM_Queue_Peek() gives it in place (e.g. as a BDMA source) and
+   HSEM_Queue_Release() frees its slot. Messages come out in claim order.
+
+5- wake-up: with NotifySem set, each commit takes and releases that
+   semaphore. HSEM_Queue_EnableNotification() enables its release
+   interrupt: enable HSEM1_IRQn and call HAL_HSEM_IRQHandler() from
+   HSEM1_IRQHandler(); this module implements HAL_HSEM_FreeCallback(),
+   re-arms the notification and calls HSEM_Queue_NotifyCallback().
+   Notifications coalesce, the consumer empties the queue from there.
+
+6- every shared access is followed or preceded by the matching D-cache
+   clean or invalidate when the D-cache is enabled, so the area may stay
+   cacheable. The devices of this tree have a single Cortex-M7 core and
+   the HAL HSEM driver only handles its notification registers; on the
+   dual core parts, a Cortex-M4 side has no D-cache and only needs its own
+   HSEM interrupt line.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "hsem_queue.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+#define HSEM_QUEUE_LINE_ROUND(__SIZE__)  (((__SIZE__) + 31U) & ~31U)
+
+/* Private variables ---------------------------------------------------------*/
+static HSEM_QueueTypeDef *HsemQueues[HSEM_QUEUE_MAX];
+
+/* Private function prototypes -----------------------------------------------*/
+static HAL_StatusTypeDef       HSEM_Queue_Setup(HSEM_QueueTypeDef *pQueue, const HSEM_Queue_ConfigTypeDef *pConfig);
+static HSEM_Queue_SlotTypeDef *HSEM_Queue_Slot(const HSEM_QueueTypeDef *pQueue, uint32_t Position);
+static uint32_t                HSEM_Queue_Lock(const HSEM_QueueTypeDef *pQueue);
+static void                    HSEM_Queue_Unlock(const HSEM_QueueTypeDef *pQueue, uint32_t Primask);
+static void                    HSEM_Queue_CacheClean(const volatile void *pData, uint32_t Size);
+static void                    HSEM_Queue_CacheRefresh(const volatile void *pData, uint32_t Size);
+static void                    HSEM_Queue_CacheInvalidate(const volatile void *pData, uint32_t Size);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Format the shared area and open a handle on it
+  * @param  pQueue: handle, kept by the module
+  * @param  pConfig: shared area, slots and semaphores, copied
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HSEM_Queue_Init(HSEM_QueueTypeDef *pQueue, const HSEM_Queue_ConfigTypeDef *pConfig)
+{
+  HSEM_Queue_SharedTypeDef *pShared;
+  HSEM_Queue_SlotTypeDef *pSlot;
+  uint32_t i;
+
+  if (HSEM_Queue_Setup(pQueue, pConfig) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  pShared = pQueue->pShared;
+  memset(pShared, 0, sizeof(HSEM_Queue_SharedTypeDef));
+  pShared->Slots = pConfig->Slots;
+  pShared->Stride = pQueue->Stride;
+
+  /* Slot i is free for position i */
+  for (i = 0U; i < pConfig->Slots; i++)
+  {
+    pSlot = HSEM_Queue_Slot(pQueue, i);
+    pSlot->Seq = i;
+    pSlot->Length = 0U;
+    HSEM_Queue_CacheClean(pSlot, sizeof(HSEM_Queue_SlotTypeDef));
+  }
+
+  /* Magic last: the area is usable by Attach() once it is visible */
+  HSEM_Queue_CacheClean(pShared, sizeof(HSEM_Queue_SharedTypeDef));
+  __DSB();
+  pShared->Magic = HSEM_QUEUE_MAGIC;
+  HSEM_Queue_CacheClean(pShared, sizeof(HSEM_Queue_SharedTypeDef));
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Open a handle on an area formatted by HSEM_Queue_Init()
+  * @param  pQueue: handle, kept by the module
+  * @param  pConfig: same configuration as the formatting side
+  * @retval HAL_BUSY while the area is not yet formatted
+  */
+HAL_StatusTypeDef HSEM_Queue_Attach(HSEM_QueueTypeDef *pQueue, const HSEM_Queue_ConfigTypeDef *pConfig)
+{
+  HSEM_Queue_SharedTypeDef *pShared;
+
+  if (HSEM_Queue_Setup(pQueue, pConfig) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  pShared = pQueue->pShared;
+  HSEM_Queue_CacheRefresh(pShared, sizeof(HSEM_Queue_SharedTypeDef));
+  if (pShared->Magic != HSEM_QUEUE_MAGIC)
+  {
+    return HAL_BUSY;
+  }
+  if ((pShared->Slots != pConfig->Slots) || (pShared->Stride != pQueue->Stride))
+  {
+    return HAL_ERROR;
+  }
+  pQueue->Peeked = pShared->Tail;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Claim the next slot, to be filled in place then committed
+  * @param  pQueue: producer handle
+  * @param  ppData: payload of the slot, SlotSize bytes, cache line aligned
+  * @retval HAL_BUSY when the queue is full
+  */
+HAL_StatusTypeDef HSEM_Queue_Reserve(HSEM_QueueTypeDef *pQueue, void **ppData)
+{
+  HSEM_Queue_SharedTypeDef *pShared = pQueue->pShared;
+  HSEM_Queue_SlotTypeDef *pSlot;
+  uint32_t position;
+  uint32_t primask;
+
+  if ((pQueue->State & HSEM_QUEUE_STATE_RESERVED) != 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  primask = HSEM_Queue_Lock(pQueue);
+
+  HSEM_Queue_CacheRefresh(&pShared->Head, sizeof(uint32_t));
+  position = pShared->Head;
+  pSlot = HSEM_Queue_Slot(pQueue, position);
+  HSEM_Queue_CacheRefresh(pSlot, sizeof(HSEM_Queue_SlotTypeDef));
+
+  /* Still holding the message of the previous lap */
+  if (pSlot->Seq != position)
+  {
+    HSEM_Queue_Unlock(pQueue, primask);
+    pQueue->Full++;
+    return HAL_BUSY;
+  }
+
+  pShared->Head = position + 1U;
+  HSEM_Queue_CacheClean(&pShared->Head, sizeof(uint32_t));
+
+  HSEM_Queue_Unlock(pQueue, primask);
+
+  pQueue->Reserved = position;
+  pQueue->State |= HSEM_QUEUE_STATE_RESERVED;
+  *ppData = (uint8_t *)pSlot + sizeof(HSEM_Queue_SlotTypeDef);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Publish the slot reserved, and notify the consumer
+  * @param  pQueue: producer handle
+  * @param  Length: payload bytes written
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HSEM_Queue_Commit(HSEM_QueueTypeDef *pQueue, uint32_t Length)
+{
+  HSEM_Queue_SlotTypeDef *pSlot;
+
+  if (((pQueue->State & HSEM_QUEUE_STATE_RESERVED) == 0U) || (Length > pQueue->Config.SlotSize))
+  {
+    return HAL_ERROR;
+  }
+
+  pSlot = HSEM_Queue_Slot(pQueue, pQueue->Reserved);
+  HSEM_Queue_CacheClean((uint8_t *)pSlot + sizeof(HSEM_Queue_SlotTypeDef), Length);
+
+  /* Payload in memory before the sequence says it is there */
+  pSlot->Length = Length;
+  __DSB();
+  pSlot->Seq = pQueue->Reserved + 1U;
+  HSEM_Queue_CacheClean(pSlot, sizeof(HSEM_Queue_SlotTypeDef));
+
+  pQueue->State &= ~HSEM_QUEUE_STATE_RESERVED;
+
+  if ((pQueue->Config.NotifySem != HSEM_QUEUE_NO_SEM) && (HAL_HSEM_FastTake(pQueue->Config.NotifySem) == HAL_OK))
+  {
+    HAL_HSEM_Release(pQueue->Config.NotifySem, 0U);
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Copy a message into the queue
+  * @param  pQueue: producer handle
+  * @param  pData: message
+  * @param  Length: message bytes, SlotSize at most
+  * @retval HAL_BUSY when the queue is full
+  */
+HAL_StatusTypeDef HSEM_Queue_Send(HSEM_QueueTypeDef *pQueue, const void *pData, uint32_t Length)
+{
+  HAL_StatusTypeDef status;
+  void *pSlot;
+
+  if (Length > pQueue->Config.SlotSize)
+  {
+    return HAL_ERROR;
+  }
+
+  status = HSEM_Queue_Reserve(pQueue, &pSlot);
+  if (status != HAL_OK)
+  {
+    return status;
+  }
+  memcpy(pSlot, pData, Length);
+
+  return HSEM_Queue_Commit(pQueue, Length);
+}
+
+/**
+  * @brief  Next message, in place
+  * @param  pQueue: consumer handle
+  * @param  ppData: message in its slot, cache line aligned, valid until HSEM_Queue_Release()
+  * @param  pLength: message bytes
+  * @retval HAL_BUSY when the queue is empty
+  */
+HAL_StatusTypeDef HSEM_Queue_Peek(HSEM_QueueTypeDef *pQueue, void **ppData, uint32_t *pLength)
+{
+  HSEM_Queue_SlotTypeDef *pSlot = HSEM_Queue_Slot(pQueue, pQueue->Peeked);
+
+  if ((pQueue->State & HSEM_QUEUE_STATE_PEEKED) == 0U)
+  {
+    HSEM_Queue_CacheRefresh(pSlot, sizeof(HSEM_Queue_SlotTypeDef));
+    if (pSlot->Seq != (pQueue->Peeked + 1U))
+    {
+      return HAL_BUSY;
+    }
+    HSEM_Queue_CacheInvalidate((uint8_t *)pSlot + sizeof(HSEM_Queue_SlotTypeDef), pSlot->Length);
+    pQueue->State |= HSEM_QUEUE_STATE_PEEKED;
+  }
+
+  *ppData = (uint8_t *)pSlot + sizeof(HSEM_Queue_SlotTypeDef);
+  *pLength = pSlot->Length;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Free the slot of the message peeked
+  * @param  pQueue: consumer handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HSEM_Queue_Release(HSEM_QueueTypeDef *pQueue)
+{
+  HSEM_Queue_SharedTypeDef *pShared = pQueue->pShared;
+  HSEM_Queue_SlotTypeDef *pSlot;
+
+  if ((pQueue->State & HSEM_QUEUE_STATE_PEEKED) == 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Free for the same slot one lap later */
+  pSlot = HSEM_Queue_Slot(pQueue, pQueue->Peeked);
+  pSlot->Seq = pQueue->Peeked + pQueue->Mask + 1U;
+  HSEM_Queue_CacheClean(pSlot, sizeof(HSEM_Queue_SlotTypeDef));
+
+  pQueue->Peeked++;
+  pShared->Tail = pQueue->Peeked;
+  HSEM_Queue_CacheClean(&pShared->Tail, sizeof(uint32_t));
+
+  pQueue->State &= ~HSEM_QUEUE_STATE_PEEKED;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Copy the next message out of the queue
+  * @param  pQueue: consumer handle
+  * @param  pData: destination
+  * @param  Size: destination size, a longer message is dropped
+  * @param  pLength: message bytes
+  * @retval HAL_BUSY when the queue is empty, HAL_ERROR when the message was dropped
+  */
+HAL_StatusTypeDef HSEM_Queue_Receive(HSEM_QueueTypeDef *pQueue, void *pData, uint32_t Size, uint32_t *pLength)
+{
+  HAL_StatusTypeDef status;
+  void *pSlot;
+
+  status = HSEM_Queue_Peek(pQueue, &pSlot, pLength);
+  if (status != HAL_OK)
+  {
+    return status;
+  }
+
+  if (*pLength <= Size)
+  {
+    memcpy(pData, pSlot, *pLength);
+  }
+  else
+  {
+    status = HAL_ERROR;
+  }
+  (void)HSEM_Queue_Release(pQueue);
+
+  return status;
+}
+
+/**
+  * @brief  Messages claimed and not yet released, reserved ones included
+  * @param  pQueue: any handle
+  * @retval Number of slots in use
+  */
+uint32_t HSEM_Queue_GetCount(HSEM_QueueTypeDef *pQueue)
+{
+  HSEM_Queue_SharedTypeDef *pShared = pQueue->pShared;
+
+  HSEM_Queue_CacheRefresh(&pShared->Head, sizeof(uint32_t));
+  HSEM_Queue_CacheRefresh(&pShared->Tail, sizeof(uint32_t));
+
+  return pShared->Head - pShared->Tail;
+}
+
+/**
+  * @brief  Call HSEM_Queue_NotifyCallback() on each message committed
+  * @param  pQueue: consumer handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HSEM_Queue_EnableNotification(HSEM_QueueTypeDef *pQueue)
+{
+  uint32_t mask;
+  uint32_t primask;
+  uint32_t slot = HSEM_QUEUE_MAX;
+  uint32_t i;
+
+  if (pQueue->Config.NotifySem == HSEM_QUEUE_NO_SEM)
+  {
+    return HAL_ERROR;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  for (i = 0U; i < HSEM_QUEUE_MAX; i++)
+  {
+    if (HsemQueues[i] == pQueue)
+    {
+      slot = i;
+      break;
+    }
+    if ((HsemQueues[i] == NULL) && (slot == HSEM_QUEUE_MAX))
+    {
+      slot = i;
+    }
+  }
+  if (slot == HSEM_QUEUE_MAX)
+  {
+    __set_PRIMASK(primask);
+    return HAL_ERROR;
+  }
+  HsemQueues[slot] = pQueue;
+
+  mask = __HAL_HSEM_SEMID_TO_MASK(pQueue->Config.NotifySem);
+  __HAL_HSEM_CLEAR_FLAG(mask);
+  HAL_HSEM_ActivateNotification(mask);
+  __set_PRIMASK(primask);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the notifications of a consumer handle
+  * @param  pQueue: consumer handle
+  * @retval None
+  */
+void HSEM_Queue_DisableNotification(HSEM_QueueTypeDef *pQueue)
+{
+  uint32_t i;
+
+  for (i = 0U; i < HSEM_QUEUE_MAX; i++)
+  {
+    if (HsemQueues[i] == pQueue)
+    {
+      HAL_HSEM_DeactivateNotification(__HAL_HSEM_SEMID_TO_MASK(pQueue->Config.NotifySem));
+      HsemQueues[i] = NULL;
+    }
+  }
+}
+
+/**
+  * @brief  Message committed, runs in the HSEM interrupt
+  * @param  pQueue: consumer handle
+  * @retval None
+  */
+__weak void HSEM_Queue_NotifyCallback(HSEM_QueueTypeDef *pQueue)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(pQueue);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HSEM_Queue_NotifyCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Semaphores released: re-arm and dispatch the queue notifications
+  * @param  SemMask: mask of the semaphores released
+  * @retval None
+  */
+void HAL_HSEM_FreeCallback(uint32_t SemMask)
+{
+  uint32_t mask;
+  uint32_t i;
+
+  for (i = 0U; i < HSEM_QUEUE_MAX; i++)
+  {
+    if (HsemQueues[i] != NULL)
+    {
+      mask = __HAL_HSEM_SEMID_TO_MASK(HsemQueues[i]->Config.NotifySem);
+      if ((SemMask & mask) != 0U)
+      {
+        HAL_HSEM_ActivateNotification(mask);
+        HSEM_Queue_NotifyCallback(HsemQueues[i]);
+      }
+    }
+  }
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Check the configuration and fill a handle
+  * @param  pQueue: handle
+  * @param  pConfig: queue configuration
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef HSEM_Queue_Setup(HSEM_QueueTypeDef *pQueue, const HSEM_Queue_ConfigTypeDef *pConfig)
+{
+  if ((pQueue == NULL) || (pConfig->pShared == NULL) || (((uint32_t)pConfig->pShared & 31U) != 0U) ||
+      (pConfig->Slots < 2U) || ((pConfig->Slots & (pConfig->Slots - 1U)) != 0U) || (pConfig->SlotSize == 0U) ||
+      ((pConfig->LockSem != HSEM_QUEUE_NO_SEM) && !IS_HSEM_SEMID(pConfig->LockSem)) ||
+      ((pConfig->NotifySem != HSEM_QUEUE_NO_SEM) && !IS_HSEM_SEMID(pConfig->NotifySem)) ||
+      ((pConfig->LockSem == pConfig->NotifySem) && (pConfig->LockSem != HSEM_QUEUE_NO_SEM)))
+  {
+    return HAL_ERROR;
+  }
+
+  memset(pQueue, 0, sizeof(HSEM_QueueTypeDef));
+  pQueue->Config = *pConfig;
+  pQueue->pShared = (HSEM_Queue_SharedTypeDef *)pConfig->pShared;
+  pQueue->pSlots = (uint8_t *)pConfig->pShared + sizeof(HSEM_Queue_SharedTypeDef);
+  pQueue->Stride = HSEM_QUEUE_STRIDE(pConfig->SlotSize);
+  pQueue->Mask = pConfig->Slots - 1U;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Slot header of a position
+  * @param  pQueue: handle
+  * @param  Position: queue position
+  * @retval Slot header
+  */
+static HSEM_Queue_SlotTypeDef *HSEM_Queue_Slot(const HSEM_QueueTypeDef *pQueue, uint32_t Position)
+{
+  return (HSEM_Queue_SlotTypeDef *)&pQueue->pSlots[(Position & pQueue->Mask) * pQueue->Stride];
+}
+
+/**
+  * @brief  Serialize the producers: interrupts of this core, then the other masters
+  * @param  pQueue: producer handle
+  * @retval Previous PRIMASK
+  */
+static uint32_t HSEM_Queue_Lock(const HSEM_QueueTypeDef *pQueue)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  if (pQueue->Config.LockSem != HSEM_QUEUE_NO_SEM)
+  {
+    while (HAL_HSEM_FastTake(pQueue->Config.LockSem) != HAL_OK)
+    {
+    }
+  }
+
+  return primask;
+}
+
+/**
+  * @brief  End of the producer lock
+  * @param  pQueue: producer handle
+  * @param  Primask: value returned by HSEM_Queue_Lock()
+  * @retval None
+  */
+static void HSEM_Queue_Unlock(const HSEM_QueueTypeDef *pQueue, uint32_t Primask)
+{
+  if (pQueue->Config.LockSem != HSEM_QUEUE_NO_SEM)
+  {
+    HAL_HSEM_Release(pQueue->Config.LockSem, 0U);
+  }
+  __set_PRIMASK(Primask);
+}
+
+/**
+  * @brief  Write back the data cache lines of shared data
+  * @param  pData: shared data
+  * @param  Size: size in bytes
+  * @retval None
+  */
+static void HSEM_Queue_CacheClean(const volatile void *pData, uint32_t Size)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if (((SCB->CCR & SCB_CCR_DC_Msk) != 0U) && (Size != 0U))
+  {
+    SCB_CleanDCache_by_Addr((uint32_t *)((uint32_t)pData & ~31U),
+                            (int32_t)HSEM_QUEUE_LINE_ROUND(Size + ((uint32_t)pData & 31U)));
+  }
+#else
+  UNUSED(pData);
+  UNUSED(Size);
+#endif
+}
+
+/**
+  * @brief  Write back then drop the data cache lines of shared data, to read
+  *         what the other side wrote without losing a pending local write
+  * @param  pData: shared data
+  * @param  Size: size in bytes
+  * @retval None
+  */
+static void HSEM_Queue_CacheRefresh(const volatile void *pData, uint32_t Size)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if ((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    SCB_CleanInvalidateDCache_by_Addr((uint32_t *)((uint32_t)pData & ~31U),
+                                      (int32_t)HSEM_QUEUE_LINE_ROUND(Size + ((uint32_t)pData & 31U)));
+  }
+#else
+  UNUSED(pData);
+  UNUSED(Size);
+#endif
+}
+
+/**
+  * @brief  Drop the data cache lines of a payload written by the other side
+  * @param  pData: payload, cache line aligned
+  * @param  Size: size in bytes
+  * @retval None
+  */
+static void HSEM_Queue_CacheInvalidate(const volatile void *pData, uint32_t Size)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if (((SCB->CCR & SCB_CCR_DC_Msk) != 0U) && (Size != 0U))
+  {
+    SCB_InvalidateDCache_by_Addr((uint32_t *)pData, (int32_t)HSEM_QUEUE_LINE_ROUND(Size));
+  }
+#else
+  UNUSED(pData);
+  UNUSED(Size);
+#endif
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,143 @@
+/**
+  ******************************************************************************
+  * @file    hsem_queue.h
+  * @author  MCD Application Team
+  * @brief   Header for hsem_queue module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _HSEM_QUEUE_H__
+#define _HSEM_QUEUE_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#if !defined(HAL_HSEM_MODULE_ENABLED)
+#error "hsem_queue requires the HAL HSEM driver"
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+/* Shared area header, one D-cache line per field written by a different side */
+typedef struct
+{
+  uint32_t            Magic;          /* HSEM_QUEUE_MAGIC once formatted                     */
+  uint32_t            Slots;          /* Number of slots, power of 2                         */
+  uint32_t            Stride;         /* Bytes from one slot to the next                     */
+  uint32_t            Reserved[5];
+  __IO uint32_t       Head;           /* Next position claimed by the producers              */
+  uint32_t            HeadPad[7];
+  __IO uint32_t       Tail;           /* Next position read by the consumer                  */
+  uint32_t            TailPad[7];
+} HSEM_Queue_SharedTypeDef;
+
+/* Slot header, alone in its D-cache line, the payload follows on the next line */
+typedef struct
+{
+  __IO uint32_t       Seq;            /* Position + 1: ready, position + Slots: free again   */
+  uint32_t            Length;         /* Payload bytes                                       */
+  uint32_t            Pad[6];
+} HSEM_Queue_SlotTypeDef;
+
+typedef struct
+{
+  void                *pShared;       /* Shared area, 32-byte aligned, HSEM_QUEUE_SIZE() bytes,
+                                         in RAM_D3 to be reachable by the BDMA                */
+  uint32_t            Slots;          /* Number of slots, power of 2                         */
+  uint32_t            SlotSize;       /* Largest payload, in bytes                           */
+  uint32_t            LockSem;        /* HSEM serializing several producers,
+                                         HSEM_QUEUE_NO_SEM: single producer                  */
+  uint32_t            NotifySem;      /* HSEM released on each message to wake the consumer,
+                                         HSEM_QUEUE_NO_SEM: polled                           */
+} HSEM_Queue_ConfigTypeDef;
+
+typedef struct
+{
+  HSEM_Queue_ConfigTypeDef Config;
+  HSEM_Queue_SharedTypeDef *pShared;
+  uint8_t             *pSlots;        /* First slot                                          */
+  uint32_t            Stride;
+  uint32_t            Mask;           /* Slots - 1                                           */
+  uint32_t            Reserved;       /* Position reserved by this producer handle           */
+  uint32_t            Peeked;         /* Position read by this consumer handle               */
+  uint32_t            State;          /* HSEM_QUEUE_STATE_xxx bits                           */
+  uint32_t            Full;           /* Sends refused, queue full                           */
+} HSEM_QueueTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+#define HSEM_QUEUE_MAGIC             0x51534D48U   /* "HMSQ" */
+#define HSEM_QUEUE_NO_SEM            0xFFFFFFFFU
+
+#define HSEM_QUEUE_STATE_RESERVED    0x01U   /* A slot is reserved, not committed   */
+#define HSEM_QUEUE_STATE_PEEKED      0x02U   /* A slot is peeked, not released      */
+
+/* Consumer handles woken by HSEM notifications. Override in main.h. */
+#if !defined(HSEM_QUEUE_MAX)
+#define HSEM_QUEUE_MAX               4U
+#endif
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Bytes from one slot to the next for a payload of __SIZE__ bytes */
+#define HSEM_QUEUE_STRIDE(__SIZE__)  (sizeof(HSEM_Queue_SlotTypeDef) + (((__SIZE__) + 31U) & ~31U))
+
+/* Shared area size of a queue */
+#define HSEM_QUEUE_SIZE(__SLOTS__, __SIZE__) \
+  (sizeof(HSEM_Queue_SharedTypeDef) + ((__SLOTS__) * HSEM_QUEUE_STRIDE(__SIZE__)))
+
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef HSEM_Queue_Init(HSEM_QueueTypeDef *pQueue, const HSEM_Queue_ConfigTypeDef *pConfig);
+HAL_StatusTypeDef HSEM_Queue_Attach(HSEM_QueueTypeDef *pQueue, const HSEM_Queue_ConfigTypeDef *pConfig);
+
+HAL_StatusTypeDef HSEM_Queue_Reserve(HSEM_QueueTypeDef *pQueue, void **ppData);
+HAL_StatusTypeDef HSEM_Queue_Commit(HSEM_QueueTypeDef *pQueue, uint32_t Length);
+HAL_StatusTypeDef HSEM_Queue_Send(HSEM_QueueTypeDef *pQueue, const void *pData, uint32_t Length);
+
+HAL_StatusTypeDef HSEM_Queue_Peek(HSEM_QueueTypeDef *pQueue, void **ppData, uint32_t *pLength);
+HAL_StatusTypeDef HSEM_Queue_Release(HSEM_QueueTypeDef *pQueue);
+HAL_StatusTypeDef HSEM_Queue_Receive(HSEM_QueueTypeDef *pQueue, void *pData, uint32_t Size, uint32_t *pLength);
+
+uint32_t          HSEM_Queue_GetCount(HSEM_QueueTypeDef *pQueue);
+HAL_StatusTypeDef HSEM_Queue_EnableNotification(HSEM_QueueTypeDef *pQueue);
+void              HSEM_Queue_DisableNotification(HSEM_QueueTypeDef *pQueue);
+
+void HSEM_Queue_NotifyCallback(HSEM_QueueTypeDef *pQueue);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _HSEM_QUEUE_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
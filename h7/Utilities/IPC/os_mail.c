@@ -0,0 +1,596 @@
+/**
+  ******************************************************************************
+  * @file    os_mail.h
+  * @author  MCD Application Team
+  * @brief   Static lock-free memory pool and mail queue for CMSIS-RTOS
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- OS_Pool_xxx and OS_MailQ_xxx are the RTOS independent layer: blocks of
+   a statically allocated array handed out by pointer, never copied. Alloc,
+   free, put and get never block nor mask interrupts on Cortex-M3/M4/M7:
+   the free list and the queue positions are updated with LDREX/STREX, a
+   context interrupted in the middle retries. They may be called from any
+   task or interrupt, e.g. a UART, ETH or ADC callback allocates a block,
+   fills it (or has a DMA fill it) and puts it, a task gets it, processes
+   it and frees it. On Cortex-M0/M0+ the few instructions of each update
+   run with the interrupts masked.
+
+2- define OS_MAIL_STATIC for the whole project (compiler command line) to
+   bind this module to the CMSIS-RTOS API, in place of the pool and mail
+   queue of the RTOS:
+   - osPoolDef() and osMailQDef() of Drivers/CMSIS/RTOS/Template/cmsis_os.h
+     (and, on H7, of the CMSIS-RTOS v1 layer over RTOS2 in
+     Drivers/CMSIS/RTOS2/Template) then reserve a static array holding
+     the control block, the blocks and the queue slots, no heap is used;
+   - osPoolCreate(), osPoolAlloc(), osPoolCAlloc(), osPoolFree(),
+     osMailCreate(), osMailAlloc(), osMailCAlloc(), osMailPut(),
+     osMailGet() and osMailFree() are implemented here; cmsis_os1.c skips
+     its own versions.
+   osMailAlloc() and osMailGet() with a timeout poll, calling OS_MAIL_WAIT()
+   between attempts; from an interrupt the timeout must be 0.
+
+3- a mail given to osMailPut() is the block itself: the receiver gets the
+   same pointer from osMailGet() and gives it back with osMailFree(). A
+   queue holds as many mails as it has blocks, so osMailPut() of a block
+   allocated from the same queue never fails.
+
+4- the queue is lock-free, not wait-free: a mail put by an interrupt while
+   a lower priority context is between claiming a slot and writing it is
+   seen by the receiver once that context resumes. Blocks are 4-byte
+   aligned; use a pool of cache line multiples placed in a non cacheable
+   or cache maintained area for DMA buffers on Cortex-M7.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "os_mail.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define OS_POOL_NIL           0xFFFFU
+#define OS_POOL_TAG           0x00010000U
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t OS_Mail_CompareAndSwap(__IO uint32_t *pValue, uint32_t Expected, uint32_t Desired);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Initialize a pool, all blocks free
+  * @param  pPool: pool
+  * @param  pBlocks: OS_POOL_BLOCK_WORDS(Count, Size) words
+  * @param  Count: number of blocks, up to OS_POOL_MAX_BLOCKS
+  * @param  Size: block size in bytes
+  * @retval HAL status
+  */
+HAL_StatusTypeDef OS_Pool_Init(OS_PoolTypeDef *pPool, uint32_t *pBlocks, uint32_t Count, uint32_t Size)
+{
+  uint32_t i;
+
+  if((pPool == NULL) || (pBlocks == NULL) || (Count == 0U) || (Count > OS_POOL_MAX_BLOCKS) || (Size == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  pPool->Count   = Count;
+  pPool->Stride  = (Size + 3U) & ~3U;
+  pPool->pBlocks = (uint8_t *)pBlocks;
+
+  /* Each free block holds the index of the next one in its first word */
+  for(i = 0U; i < Count; i++)
+  {
+    *(uint32_t *)(pPool->pBlocks + (i * pPool->Stride)) = ((i + 1U) < Count) ? (i + 1U) : OS_POOL_NIL;
+  }
+  pPool->Head = 0U;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Take a block, from any context
+  * @param  pPool: pool
+  * @retval Block, NULL when none is free
+  */
+void *OS_Pool_Alloc(OS_PoolTypeDef *pPool)
+{
+  uint32_t head;
+  uint32_t index;
+  uint32_t next;
+
+  do
+  {
+    head  = pPool->Head;
+    index = head & 0xFFFFU;
+    if(index == OS_POOL_NIL)
+    {
+      return NULL;
+    }
+    /* Stale if the block is taken meanwhile, the tag then fails the swap */
+    next = *(__IO uint32_t *)(pPool->pBlocks + (index * pPool->Stride));
+  } while(OS_Mail_CompareAndSwap(&pPool->Head, head,
+                                 ((head + OS_POOL_TAG) & 0xFFFF0000U) | (next & 0xFFFFU)) == 0U);
+
+  return pPool->pBlocks + (index * pPool->Stride);
+}
+
+/**
+  * @brief  Give a block back, from any context
+  * @param  pPool: pool
+  * @param  pBlock: block from OS_Pool_Alloc()
+  * @retval HAL status, HAL_ERROR when not a block of this pool
+  */
+HAL_StatusTypeDef OS_Pool_Free(OS_PoolTypeDef *pPool, void *pBlock)
+{
+  uint32_t offset = (uint32_t)((uint8_t *)pBlock - pPool->pBlocks);
+  uint32_t index;
+  uint32_t head;
+
+  if(((uint8_t *)pBlock < pPool->pBlocks) || ((offset % pPool->Stride) != 0U) ||
+     ((offset / pPool->Stride) >= pPool->Count))
+  {
+    return HAL_ERROR;
+  }
+  index = offset / pPool->Stride;
+
+  do
+  {
+    head = pPool->Head;
+    *(__IO uint32_t *)pBlock = head & 0xFFFFU;
+  } while(OS_Mail_CompareAndSwap(&pPool->Head, head,
+                                 ((head + OS_POOL_TAG) & 0xFFFF0000U) | index) == 0U);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Initialize a mail queue, all blocks free and no mail queued
+  * @param  pQueue: queue
+  * @param  pBlocks: OS_POOL_BLOCK_WORDS(Count, Size) words
+  * @param  pSlots: OS_MAILQ_SLOT_WORDS(Count) words
+  * @param  Count: number of mails
+  * @param  Size: mail size in bytes
+  * @retval HAL status
+  */
+HAL_StatusTypeDef OS_MailQ_Init(OS_MailQTypeDef *pQueue, uint32_t *pBlocks, uint32_t *pSlots,
+                                uint32_t Count, uint32_t Size)
+{
+  uint32_t slots = 1U;
+  uint32_t i;
+
+  if((pQueue == NULL) || (pSlots == NULL) || (OS_Pool_Init(&pQueue->Pool, pBlocks, Count, Size) != HAL_OK))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Power of 2 at least Count, at most 2 x Count slots */
+  while(slots < Count)
+  {
+    slots <<= 1U;
+  }
+
+  pQueue->pSlots = (OS_MailQ_SlotTypeDef *)pSlots;
+  pQueue->Mask   = slots - 1U;
+  for(i = 0U; i < slots; i++)
+  {
+    pQueue->pSlots[i].Seq   = i;
+    pQueue->pSlots[i].pMail = NULL;
+  }
+  pQueue->Head = 0U;
+  pQueue->Tail = 0U;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Take a free mail block, from any context
+  * @param  pQueue: queue
+  * @retval Block, NULL when none is free
+  */
+void *OS_MailQ_Alloc(OS_MailQTypeDef *pQueue)
+{
+  return OS_Pool_Alloc(&pQueue->Pool);
+}
+
+/**
+  * @brief  Queue a mail block, from any context
+  * @param  pQueue: queue
+  * @param  pMail: block from OS_MailQ_Alloc()
+  * @retval HAL status, HAL_BUSY when the queue is full
+  */
+HAL_StatusTypeDef OS_MailQ_Put(OS_MailQTypeDef *pQueue, void *pMail)
+{
+  OS_MailQ_SlotTypeDef *slot;
+  uint32_t position;
+  int32_t  diff;
+
+  if(pMail == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  for(;;)
+  {
+    position = pQueue->Tail;
+    slot     = &pQueue->pSlots[position & pQueue->Mask];
+    diff     = (int32_t)(slot->Seq - position);
+    if(diff == 0)
+    {
+      /* Slot free for this position: claim it */
+      if(OS_Mail_CompareAndSwap(&pQueue->Tail, position, position + 1U) != 0U)
+      {
+        break;
+      }
+    }
+    else if(diff < 0)
+    {
+      return HAL_BUSY;
+    }
+  }
+
+  slot->pMail = pMail;
+  __DMB();
+  slot->Seq = position + 1U;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Take the oldest mail, from any context
+  * @param  pQueue: queue
+  * @retval Mail, NULL when the queue is empty
+  */
+void *OS_MailQ_Get(OS_MailQTypeDef *pQueue)
+{
+  OS_MailQ_SlotTypeDef *slot;
+  uint32_t position;
+  int32_t  diff;
+  void     *mail;
+
+  for(;;)
+  {
+    position = pQueue->Head;
+    slot     = &pQueue->pSlots[position & pQueue->Mask];
+    diff     = (int32_t)(slot->Seq - (position + 1U));
+    if(diff == 0)
+    {
+      /* Slot written for this position: claim it */
+      if(OS_Mail_CompareAndSwap(&pQueue->Head, position, position + 1U) != 0U)
+      {
+        break;
+      }
+    }
+    else if(diff < 0)
+    {
+      return NULL;
+    }
+  }
+
+  mail = slot->pMail;
+  __DMB();
+  slot->Seq = position + pQueue->Mask + 1U;
+
+  return mail;
+}
+
+/**
+  * @brief  Give a mail block back, from any context
+  * @param  pQueue: queue
+  * @param  pMail: block from OS_MailQ_Get() or OS_MailQ_Alloc()
+  * @retval HAL status
+  */
+HAL_StatusTypeDef OS_MailQ_Free(OS_MailQTypeDef *pQueue, void *pMail)
+{
+  return OS_Pool_Free(&pQueue->Pool, pMail);
+}
+
+/**
+  * @brief  Number of mails queued
+  * @param  pQueue: queue
+  * @retval Mails, approximate while others put or get
+  */
+uint32_t OS_MailQ_GetCount(OS_MailQTypeDef *pQueue)
+{
+  return pQueue->Tail - pQueue->Head;
+}
+
+#if defined(OS_MAIL_STATIC)
+/* CMSIS-RTOS binding, storage laid out by OS_POOL_WORDS() and OS_MAILQ_WORDS():
+   control block, blocks, then the queue slots */
+#if (osCMSIS >= 0x20000U)
+#define OS_MAIL_PUT_CONST     const
+#else
+#define OS_MAIL_PUT_CONST
+#endif
+
+typedef char OS_Pool_CheckSize[(sizeof(OS_PoolTypeDef) == 16U) ? 1 : -1];
+typedef char OS_MailQ_CheckSize[(sizeof(OS_MailQTypeDef) == 32U) ? 1 : -1];
+
+/**
+  * @brief  Create a pool in the storage reserved by osPoolDef()
+  * @param  pool_def: definition referenced with osPool()
+  * @retval Pool ID, NULL on error
+  */
+osPoolId osPoolCreate(const osPoolDef_t *pool_def)
+{
+  OS_PoolTypeDef *pool;
+
+  if((pool_def == NULL) || (pool_def->pool == NULL))
+  {
+    return (osPoolId)NULL;
+  }
+  pool = (OS_PoolTypeDef *)pool_def->pool;
+  if(OS_Pool_Init(pool, (uint32_t *)pool_def->pool + 4U, pool_def->pool_sz, pool_def->item_sz) != HAL_OK)
+  {
+    return (osPoolId)NULL;
+  }
+  return (osPoolId)pool;
+}
+
+/**
+  * @brief  Take a block, from any context
+  * @param  pool_id: pool
+  * @retval Block, NULL when none is free
+  */
+void *osPoolAlloc(osPoolId pool_id)
+{
+  if(pool_id == NULL)
+  {
+    return NULL;
+  }
+  return OS_Pool_Alloc((OS_PoolTypeDef *)pool_id);
+}
+
+/**
+  * @brief  Take a block set to zero, from any context
+  * @param  pool_id: pool
+  * @retval Block, NULL when none is free
+  */
+void *osPoolCAlloc(osPoolId pool_id)
+{
+  void *block = osPoolAlloc(pool_id);
+
+  if(block != NULL)
+  {
+    (void)memset(block, 0, ((OS_PoolTypeDef *)pool_id)->Stride);
+  }
+  return block;
+}
+
+/**
+  * @brief  Give a block back, from any context
+  * @param  pool_id: pool
+  * @param  block: block from osPoolAlloc()
+  * @retval osOK, osErrorParameter, osErrorValue
+  */
+osStatus osPoolFree(osPoolId pool_id, void *block)
+{
+  if(pool_id == NULL)
+  {
+    return osErrorParameter;
+  }
+  return (OS_Pool_Free((OS_PoolTypeDef *)pool_id, block) == HAL_OK) ? osOK : osErrorValue;
+}
+
+/**
+  * @brief  Create a mail queue in the storage reserved by osMailQDef()
+  * @param  queue_def: definition referenced with osMailQ()
+  * @param  thread_id: unused
+  * @retval Mail queue ID, NULL on error
+  */
+osMailQId osMailCreate(const osMailQDef_t *queue_def, osThreadId thread_id)
+{
+  OS_MailQTypeDef *queue;
+  uint32_t        *blocks;
+
+  (void)thread_id;
+
+  if((queue_def == NULL) || (queue_def->pool == NULL))
+  {
+    return (osMailQId)NULL;
+  }
+  queue  = (OS_MailQTypeDef *)queue_def->pool;
+  blocks = (uint32_t *)queue_def->pool + 8U;
+  if(OS_MailQ_Init(queue, blocks, blocks + OS_POOL_BLOCK_WORDS(queue_def->queue_sz, queue_def->item_sz),
+                   queue_def->queue_sz, queue_def->item_sz) != HAL_OK)
+  {
+    return (osMailQId)NULL;
+  }
+  return (osMailQId)queue;
+}
+
+/**
+  * @brief  Take a mail block, waiting up to millisec in a task
+  * @param  queue_id: mail queue
+  * @param  millisec: timeout, 0 from an interrupt
+  * @retval Block, NULL when none is free
+  */
+void *osMailAlloc(osMailQId queue_id, uint32_t millisec)
+{
+  uint32_t tickstart = HAL_GetTick();
+  void     *mail;
+
+  if(queue_id == NULL)
+  {
+    return NULL;
+  }
+
+  for(;;)
+  {
+    mail = OS_MailQ_Alloc((OS_MailQTypeDef *)queue_id);
+    if((mail != NULL) || (millisec == 0U) || (__get_IPSR() != 0U) ||
+       ((millisec != osWaitForever) && ((HAL_GetTick() - tickstart) >= millisec)))
+    {
+      return mail;
+    }
+    OS_MAIL_WAIT();
+  }
+}
+
+/**
+  * @brief  Take a mail block set to zero, waiting up to millisec in a task
+  * @param  queue_id: mail queue
+  * @param  millisec: timeout, 0 from an interrupt
+  * @retval Block, NULL when none is free
+  */
+void *osMailCAlloc(osMailQId queue_id, uint32_t millisec)
+{
+  void *mail = osMailAlloc(queue_id, millisec);
+
+  if(mail != NULL)
+  {
+    (void)memset(mail, 0, ((OS_MailQTypeDef *)queue_id)->Pool.Stride);
+  }
+  return mail;
+}
+
+/**
+  * @brief  Queue a mail block, from any context
+  * @param  queue_id: mail queue
+  * @param  mail: block from osMailAlloc()
+  * @retval osOK, osErrorParameter, osErrorValue, osErrorResource
+  */
+osStatus osMailPut(osMailQId queue_id, OS_MAIL_PUT_CONST void *mail)
+{
+  if(queue_id == NULL)
+  {
+    return osErrorParameter;
+  }
+  if(mail == NULL)
+  {
+    return osErrorValue;
+  }
+  return (OS_MailQ_Put((OS_MailQTypeDef *)queue_id, (void *)mail) == HAL_OK) ? osOK : osErrorResource;
+}
+
+/**
+  * @brief  Take the oldest mail, waiting up to millisec in a task
+  * @param  queue_id: mail queue
+  * @param  millisec: timeout, 0 from an interrupt
+  * @retval Event: osEventMail with the block, osOK when empty, osEventTimeout
+  */
+osEvent osMailGet(osMailQId queue_id, uint32_t millisec)
+{
+  uint32_t tickstart = HAL_GetTick();
+  osEvent  event;
+
+  event.def.mail_id = queue_id;
+  event.value.p     = NULL;
+
+  if(queue_id == NULL)
+  {
+    event.status = osErrorParameter;
+    return event;
+  }
+
+  for(;;)
+  {
+    event.value.p = OS_MailQ_Get((OS_MailQTypeDef *)queue_id);
+    if(event.value.p != NULL)
+    {
+      event.status = osEventMail;
+      return event;
+    }
+    if((millisec == 0U) || (__get_IPSR() != 0U))
+    {
+      event.status = osOK;
+      return event;
+    }
+    if((millisec != osWaitForever) && ((HAL_GetTick() - tickstart) >= millisec))
+    {
+      event.status = osEventTimeout;
+      return event;
+    }
+    OS_MAIL_WAIT();
+  }
+}
+
+/**
+  * @brief  Give a mail block back, from any context
+  * @param  queue_id: mail queue
+  * @param  mail: block from osMailGet()
+  * @retval osOK, osErrorParameter, osErrorValue
+  */
+osStatus osMailFree(osMailQId queue_id, void *mail)
+{
+  if(queue_id == NULL)
+  {
+    return osErrorParameter;
+  }
+  return (OS_MailQ_Free((OS_MailQTypeDef *)queue_id, mail) == HAL_OK) ? osOK : osErrorValue;
+}
+#endif /* OS_MAIL_STATIC */
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Write Desired if the value is still Expected
+  * @param  pValue: shared word
+  * @param  Expected: value read before
+  * @param  Desired: new value
+  * @retval 1 when written, 0 when the value changed
+  */
+static uint32_t OS_Mail_CompareAndSwap(__IO uint32_t *pValue, uint32_t Expected, uint32_t Desired)
+{
+#if (__CORTEX_M >= 3U)
+  do
+  {
+    if(__LDREXW(pValue) != Expected)
+    {
+      __CLREX();
+      return 0U;
+    }
+  } while(__STREXW(Desired, pValue) != 0U);
+
+  return 1U;
+#else
+  uint32_t primask = __get_PRIMASK();
+  uint32_t done = 0U;
+
+  __disable_irq();
+  if(*pValue == Expected)
+  {
+    *pValue = Desired;
+    done = 1U;
+  }
+  __set_PRIMASK(primask);
+
+  return done;
+#endif
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,436 @@
+/**
+  ******************************************************************************
+  * @file    work_queue.h
+  * @author  MCD Application Team
+  * @brief   Deferred interrupt work run by CMSIS-RTOS2 worker threads
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- call WORK_Queue_Init() once the kernel is initialized (after
+   osKernelInitialize()). It creates one worker thread per level, level 0
+   at WORK_QUEUE_THREAD_PRIORITY(0), the highest, and enables the DWT
+   cycle counter used for the latency statistics.
+
+2- from a HAL completion callback, or any interrupt or thread, hand the
+   processing over with WORK_Queue_Submit(Level, Func, pArg, Param), e.g.
+      void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
+      {
+        WORK_Queue_Submit(WORK_PRIORITY_HIGH, UartRxWork, huart, 0U);
+      }
+   The item (function, argument, parameter) is copied into the level
+   queue and the worker of that level is woken with a thread flag. The
+   callback returns at once: the interrupt stays short and no interrupt
+   is masked, the queues are updated with LDREX/STREX.
+
+3- items of a level run in submission order in its worker. A worker with
+   an empty queue steals the items of the lower levels (WORK_QUEUE_STEAL),
+   one at a time and checking its own queue between two, so that a busy
+   low level worker, e.g. preempted by application threads, does not hold
+   work back; an urgent item waits at most for the item its worker is
+   running. An idle higher worker is also woken when the worker of the
+   level an item is submitted to is busy.
+
+4- a work function runs in thread context and may block, but a blocked
+   worker delays the other items of its level (and those it stole).
+   WORK_Queue_Submit() returns HAL_BUSY when the level queue is full: size
+   WORK_QUEUE_DEPTH from WORK_Queue_GetStats() (MaxDepth, Overflows).
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "work_queue.h"
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  __IO uint32_t     Seq;        /* Position it can be written at, or position + 1 once written */
+  WORK_FuncTypeDef  Func;
+  void              *pArg;
+  uint32_t          Param;
+  uint32_t          Stamp;      /* Cycle counter at submission                             */
+} WORK_SlotTypeDef;
+
+typedef struct
+{
+  __IO uint32_t     Head;       /* Next position run                                       */
+  __IO uint32_t     Tail;       /* Next position queued                                    */
+  WORK_SlotTypeDef  Slots[WORK_QUEUE_DEPTH];
+  osThreadId_t      Worker;
+  __IO uint32_t     Idle;       /* Worker waiting for its flag                             */
+  WORK_Queue_StatsTypeDef Stats;
+} WORK_LevelTypeDef;
+
+/* Private define ------------------------------------------------------------*/
+#define WORK_QUEUE_FLAG          0x0001U
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static WORK_LevelTypeDef WorkLevels[WORK_QUEUE_LEVELS];
+static uint64_t          WorkStacks[WORK_QUEUE_LEVELS][WORK_QUEUE_STACK_SIZE / 8U];
+static const char        *WorkNames[] = { "work0", "work1", "work2", "work3", "work4", "work5", "work6", "work7" };
+
+/* Private function prototypes -----------------------------------------------*/
+static void     WORK_Queue_Worker(void *argument);
+static uint32_t WORK_Queue_RunOne(WORK_LevelTypeDef *pLevel, uint32_t Stolen);
+static uint32_t WORK_Queue_CompareAndSwap(__IO uint32_t *pValue, uint32_t Expected, uint32_t Desired);
+static void     WORK_Queue_Add(uint32_t *pValue, uint32_t Value);
+static void     WORK_Queue_Max(uint32_t *pValue, uint32_t Value);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Create the worker threads
+  * @retval HAL status
+  */
+HAL_StatusTypeDef WORK_Queue_Init(void)
+{
+  osThreadAttr_t attr;
+  uint32_t level;
+  uint32_t i;
+
+  if(WORK_QUEUE_LEVELS > (sizeof(WorkNames) / sizeof(WorkNames[0])))
+  {
+    return HAL_ERROR;
+  }
+
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#if (__CORTEX_M == 7U)
+  DWT->LAR = 0xC5ACCE55U;
+#endif
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  for(level = 0U; level < WORK_QUEUE_LEVELS; level++)
+  {
+    for(i = 0U; i < WORK_QUEUE_DEPTH; i++)
+    {
+      WorkLevels[level].Slots[i].Seq = i;
+    }
+    WorkLevels[level].Head = 0U;
+    WorkLevels[level].Tail = 0U;
+    WorkLevels[level].Idle = 1U;
+
+    attr.name       = WorkNames[level];
+    attr.attr_bits  = osThreadDetached;
+    attr.cb_mem     = NULL;
+    attr.cb_size    = 0U;
+    attr.stack_mem  = WorkStacks[level];
+    attr.stack_size = sizeof(WorkStacks[level]);
+    attr.priority   = WORK_QUEUE_THREAD_PRIORITY(level);
+    attr.tz_module  = 0U;
+    attr.reserved   = 0U;
+
+    WorkLevels[level].Worker = osThreadNew(WORK_Queue_Worker, &WorkLevels[level], &attr);
+    if(WorkLevels[level].Worker == NULL)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Queue work, from an interrupt or a thread
+  * @param  Level: WORK_PRIORITY_xxx, 0 to WORK_QUEUE_LEVELS - 1
+  * @param  Func: work function
+  * @param  pArg: its argument
+  * @param  Param: its parameter
+  * @retval HAL status, HAL_BUSY when the level queue is full
+  */
+HAL_StatusTypeDef WORK_Queue_Submit(uint32_t Level, WORK_FuncTypeDef Func, void *pArg, uint32_t Param)
+{
+  WORK_LevelTypeDef *lvl;
+  WORK_SlotTypeDef  *slot;
+  uint32_t position;
+  uint32_t other;
+  int32_t  diff;
+
+  if((Level >= WORK_QUEUE_LEVELS) || (Func == NULL))
+  {
+    return HAL_ERROR;
+  }
+  lvl = &WorkLevels[Level];
+
+  for(;;)
+  {
+    position = lvl->Tail;
+    slot     = &lvl->Slots[position & (WORK_QUEUE_DEPTH - 1U)];
+    diff     = (int32_t)(slot->Seq - position);
+    if(diff == 0)
+    {
+      if(WORK_Queue_CompareAndSwap(&lvl->Tail, position, position + 1U) != 0U)
+      {
+        break;
+      }
+    }
+    else if(diff < 0)
+    {
+      WORK_Queue_Add(&lvl->Stats.Overflows, 1U);
+      return HAL_BUSY;
+    }
+  }
+
+  slot->Func  = Func;
+  slot->pArg  = pArg;
+  slot->Param = Param;
+  slot->Stamp = DWT->CYCCNT;
+  __DMB();
+  slot->Seq = position + 1U;
+
+  WORK_Queue_Add(&lvl->Stats.Submitted, 1U);
+  WORK_Queue_Max(&lvl->Stats.MaxDepth, (position + 1U) - lvl->Head);
+
+  (void)osThreadFlagsSet(lvl->Worker, WORK_QUEUE_FLAG);
+
+#if (WORK_QUEUE_STEAL == 1U)
+  /* Worker busy: wake the closest idle worker above, it steals the item */
+  if(lvl->Idle == 0U)
+  {
+    for(other = Level; other > 0U; other--)
+    {
+      if(WorkLevels[other - 1U].Idle != 0U)
+      {
+        (void)osThreadFlagsSet(WorkLevels[other - 1U].Worker, WORK_QUEUE_FLAG);
+        break;
+      }
+    }
+  }
+#else
+  UNUSED(other);
+#endif
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Number of items waiting at a level
+  * @param  Level: 0 to WORK_QUEUE_LEVELS - 1
+  * @retval Items, approximate while items are submitted or run
+  */
+uint32_t WORK_Queue_GetPending(uint32_t Level)
+{
+  if(Level >= WORK_QUEUE_LEVELS)
+  {
+    return 0U;
+  }
+  return WorkLevels[Level].Tail - WorkLevels[Level].Head;
+}
+
+/**
+  * @brief  Statistics of a level
+  * @param  Level: 0 to WORK_QUEUE_LEVELS - 1
+  * @param  pStats: filled with the counters since the last reset
+  * @retval None
+  */
+void WORK_Queue_GetStats(uint32_t Level, WORK_Queue_StatsTypeDef *pStats)
+{
+  if(Level < WORK_QUEUE_LEVELS)
+  {
+    *pStats = WorkLevels[Level].Stats;
+  }
+}
+
+/**
+  * @brief  Clear the statistics of all levels
+  * @retval None
+  */
+void WORK_Queue_ResetStats(void)
+{
+  uint32_t level;
+
+  for(level = 0U; level < WORK_QUEUE_LEVELS; level++)
+  {
+    WorkLevels[level].Stats.Submitted  = 0U;
+    WorkLevels[level].Stats.Executed   = 0U;
+    WorkLevels[level].Stats.Stolen     = 0U;
+    WorkLevels[level].Stats.Overflows  = 0U;
+    WorkLevels[level].Stats.MaxDepth   = 0U;
+    WorkLevels[level].Stats.MaxLatency = 0U;
+  }
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Worker thread: run its level, then steal from the lower ones
+  * @param  argument: level
+  * @retval None
+  */
+static void WORK_Queue_Worker(void *argument)
+{
+  WORK_LevelTypeDef *lvl = (WORK_LevelTypeDef *)argument;
+  uint32_t level = (uint32_t)(lvl - WorkLevels);
+  uint32_t other;
+  uint32_t ran;
+
+  for(;;)
+  {
+    (void)osThreadFlagsWait(WORK_QUEUE_FLAG, osFlagsWaitAny, osWaitForever);
+    lvl->Idle = 0U;
+
+    do
+    {
+      ran = WORK_Queue_RunOne(lvl, 0U);
+#if (WORK_QUEUE_STEAL == 1U)
+      /* One item of the first lower level with work, then back to our own */
+      for(other = level + 1U; (ran == 0U) && (other < WORK_QUEUE_LEVELS); other++)
+      {
+        ran = WORK_Queue_RunOne(&WorkLevels[other], 1U);
+      }
+#else
+      UNUSED(other);
+      UNUSED(level);
+#endif
+      if(ran == 0U)
+      {
+        /* Idle before the last check: a submission from now on wakes us */
+        lvl->Idle = 1U;
+        ran = WORK_Queue_RunOne(lvl, 0U);
+        if(ran != 0U)
+        {
+          lvl->Idle = 0U;
+        }
+      }
+    } while(ran != 0U);
+  }
+}
+
+/**
+  * @brief  Run the oldest item of a level
+  * @param  pLevel: level
+  * @param  Stolen: 1 when run by the worker of another level
+  * @retval 1 when an item was run, 0 when the level is empty
+  */
+static uint32_t WORK_Queue_RunOne(WORK_LevelTypeDef *pLevel, uint32_t Stolen)
+{
+  WORK_SlotTypeDef *slot;
+  WORK_FuncTypeDef func;
+  void     *arg;
+  uint32_t param;
+  uint32_t stamp;
+  uint32_t position;
+  int32_t  diff;
+
+  for(;;)
+  {
+    position = pLevel->Head;
+    slot     = &pLevel->Slots[position & (WORK_QUEUE_DEPTH - 1U)];
+    diff     = (int32_t)(slot->Seq - (position + 1U));
+    if(diff == 0)
+    {
+      if(WORK_Queue_CompareAndSwap(&pLevel->Head, position, position + 1U) != 0U)
+      {
+        break;
+      }
+    }
+    else if(diff < 0)
+    {
+      return 0U;
+    }
+  }
+
+  func  = slot->Func;
+  arg   = slot->pArg;
+  param = slot->Param;
+  stamp = slot->Stamp;
+  __DMB();
+  slot->Seq = position + WORK_QUEUE_DEPTH;
+
+  WORK_Queue_Max(&pLevel->Stats.MaxLatency, DWT->CYCCNT - stamp);
+  func(arg, param);
+
+  WORK_Queue_Add(&pLevel->Stats.Executed, 1U);
+  if(Stolen != 0U)
+  {
+    WORK_Queue_Add(&pLevel->Stats.Stolen, 1U);
+  }
+
+  return 1U;
+}
+
+/**
+  * @brief  Write Desired if the value is still Expected
+  * @param  pValue: shared word
+  * @param  Expected: value read before
+  * @param  Desired: new value
+  * @retval 1 when written, 0 when the value changed
+  */
+static uint32_t WORK_Queue_CompareAndSwap(__IO uint32_t *pValue, uint32_t Expected, uint32_t Desired)
+{
+  do
+  {
+    if(__LDREXW(pValue) != Expected)
+    {
+      __CLREX();
+      return 0U;
+    }
+  } while(__STREXW(Desired, pValue) != 0U);
+
+  return 1U;
+}
+
+/**
+  * @brief  Add to a counter shared with interrupts
+  * @param  pValue: counter
+  * @param  Value: increment
+  * @retval None
+  */
+static void WORK_Queue_Add(uint32_t *pValue, uint32_t Value)
+{
+  do
+  {
+  } while(__STREXW(__LDREXW(pValue) + Value, pValue) != 0U);
+}
+
+/**
+  * @brief  Raise a maximum shared with interrupts
+  * @param  pValue: maximum
+  * @param  Value: new sample
+  * @retval None
+  */
+static void WORK_Queue_Max(uint32_t *pValue, uint32_t Value)
+{
+  uint32_t current;
+
+  do
+  {
+    current = *pValue;
+    if(Value <= current)
+    {
+      return;
+    }
+  } while(WORK_Queue_CompareAndSwap((__IO uint32_t *)pValue, current, Value) == 0U);
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
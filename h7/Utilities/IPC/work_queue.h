@@ -0,0 +1,114 @@
+/**
+  ******************************************************************************
+  * @file    work_queue.h
+  * @author  MCD Application Team
+  * @brief   Header for work_queue module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _WORK_QUEUE_H__
+#define _WORK_QUEUE_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "cmsis_os2.h"
+
+/* Exported types ------------------------------------------------------------*/
+/* Deferred work: runs in a worker thread with the argument and parameter
+   given at submission */
+typedef void (*WORK_FuncTypeDef)(void *pArg, uint32_t Param);
+
+typedef struct
+{
+  uint32_t  Submitted;      /* Items queued                                      */
+  uint32_t  Executed;       /* Items run                                         */
+  uint32_t  Stolen;         /* Items run by the worker of a higher level         */
+  uint32_t  Overflows;      /* Submissions refused, queue full                   */
+  uint32_t  MaxDepth;       /* Highest number of items waiting                   */
+  uint32_t  MaxLatency;     /* Longest submission to start of run, in CPU cycles */
+} WORK_Queue_StatsTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Priority levels, 0 the most urgent, one queue and one worker thread each.
+   Override in main.h. */
+#if !defined(WORK_QUEUE_LEVELS)
+#define WORK_QUEUE_LEVELS              3U
+#endif
+
+/* Items per level queue, power of 2. Override in main.h. */
+#if !defined(WORK_QUEUE_DEPTH)
+#define WORK_QUEUE_DEPTH               16U
+#endif
+
+/* Worker thread stack, in bytes. Override in main.h. */
+#if !defined(WORK_QUEUE_STACK_SIZE)
+#define WORK_QUEUE_STACK_SIZE          1024U
+#endif
+
+/* RTOS priority of the worker of level __LEVEL__. Override in main.h. */
+#if !defined(WORK_QUEUE_THREAD_PRIORITY)
+#define WORK_QUEUE_THREAD_PRIORITY(__LEVEL__)  ((osPriority_t)((int32_t)osPriorityHigh - (8 * (int32_t)(__LEVEL__))))
+#endif
+
+/* 1: a worker with an empty queue runs the items of the lower levels, one
+   at a time, checking its own queue in between. Override in main.h. */
+#if !defined(WORK_QUEUE_STEAL)
+#define WORK_QUEUE_STEAL               1U
+#endif
+
+#define WORK_PRIORITY_HIGH             0U
+#define WORK_PRIORITY_NORMAL           1U
+#define WORK_PRIORITY_LOW              2U
+
+#if ((WORK_QUEUE_DEPTH & (WORK_QUEUE_DEPTH - 1U)) != 0U)
+#error "WORK_QUEUE_DEPTH must be a power of 2"
+#endif
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef WORK_Queue_Init(void);
+HAL_StatusTypeDef WORK_Queue_Submit(uint32_t Level, WORK_FuncTypeDef Func, void *pArg, uint32_t Param);
+uint32_t          WORK_Queue_GetPending(uint32_t Level);
+void              WORK_Queue_GetStats(uint32_t Level, WORK_Queue_StatsTypeDef *pStats);
+void              WORK_Queue_ResetStats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _WORK_QUEUE_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,901 @@
+/**
+  ******************************************************************************
+  * @file    jpeg_enc.c
+  * @author  MCD Application Team
+  * @brief   This file includes the hardware JPEG encoding pipeline: camera
+  *          strips converted to YCbCr MCUs, encoded by the JPEG codec and
+  *          streamed out in chunks.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- in the linker script place the .dma_d1 section in the AXI SRAM (see
+   dma_pool.c); the MCU row buffers and the output chunks live there, where
+   the MDMA reaches them. Size them with JPEG_ENC_MAX_WIDTH,
+   JPEG_ENC_OUT_BUFFERS and JPEG_ENC_OUT_SIZE in main.h.
+
+2- call JPEG_Enc_Init(), then call JPEG_Enc_JPEG_IRQHandler() and
+   JPEG_Enc_MDMA_IRQHandler() from the JPEG_IRQHandler() and
+   MDMA_IRQHandler() of stm32h7xx_it.c. The module implements the
+   HAL_JPEG_xxxCallback() functions, so the JPEG codec is reserved to it:
+   it cannot be linked together with jpeg_pipe.
+
+3- start the encoding of a frame with JPEG_Enc_Start(), then push the frame
+   from top to bottom in strips of JPEG_Enc_GetStripHeight() lines (8 lines
+   in 4:2:2, 16 lines in 4:2:0) with JPEG_Enc_PushStrip(); the last strip
+   holds the lines left. Each strip is converted by the CPU into a free MCU
+   row buffer and can be reused as soon as JPEG_Enc_PushStrip() returns,
+   while the codec encodes the previous row by MDMA. HAL_BUSY is returned
+   when every row buffer waits for the codec: push again later, or check
+   JPEG_Enc_GetFreeStripCount() first. With dcmi_stream, blocks of one
+   strip (Pitch * strip height bytes) are pushed and released one by one.
+
+4- the JPEG stream is written by the codec into JPEG_ENC_OUT_BUFFERS chunks
+   of JPEG_ENC_OUT_SIZE bytes, handed over in order by
+   JPEG_Enc_OutputCallback(). Give each one back with
+   JPEG_Enc_ReleaseOutput(), in the same order: from the callback once
+   copied or written to the SD card, or later once sent (USB video). The
+   codec pauses while no chunk is free. JPEG_ENC_OUT_HEADROOM bytes are
+   free in front of each chunk for the header of a transport (e.g.
+   USBD_VIDEO_CHUNK_HEADROOM); apart from them the chunks must not be
+   written by the CPU.
+
+5- JPEG_Enc_EncodeCpltCallback() is called after the last chunk, with the
+   size of the JPEG image; for motion JPEG, call JPEG_Enc_Start() again for
+   the next frame once the chunks are released.
+
+The strips are RGB565 or YCbCr 4:2:2 (YUYV or UYVY) as captured by the DCMI.
+The DMA2D converts from YCbCr but not to YCbCr, so the conversion runs on
+the CPU: fixed point, two pixels per 32-bit word read, no table.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "jpeg_enc.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* RGB565 to YCbCr (JFIF), 16.16 fixed point coefficients applied to the 5-bit
+   and 6-bit components: each one is the 8-bit coefficient times 255/31 or
+   255/63 */
+#define ENC_Y_R     161185
+#define ENC_Y_G     155712
+#define ENC_Y_B      61455
+#define ENC_CB_R   (-90969)
+#define ENC_CB_G   (-87870)
+#define ENC_CB_B    269542
+#define ENC_CR_R    269542
+#define ENC_CR_G  (-111062)
+#define ENC_CR_B   (-43835)
+#define ENC_ROUND    32768
+#define ENC_C_BIAS (ENC_ROUND + (128 << 16))
+
+/* Output chunks start on a cache line, the headroom in front of them */
+#define JPEG_ENC_OUT_OFFSET      (((JPEG_ENC_OUT_HEADROOM) + 31U) & ~31U)
+
+/* Private macro -------------------------------------------------------------*/
+/* Luma of one pixel, chroma of the sum of 1 << (sh) pixels */
+#define ENC_Y(r, g, b)       ((uint8_t)(((ENC_Y_R * (r)) + (ENC_Y_G * (g)) + (ENC_Y_B * (b)) + ENC_ROUND) >> 16))
+#define ENC_CB(r, g, b, sh)  ((uint8_t)(((ENC_CB_R * (r)) + (ENC_CB_G * (g)) + (ENC_CB_B * (b)) + (ENC_C_BIAS << (sh))) >> (16 + (sh))))
+#define ENC_CR(r, g, b, sh)  ((uint8_t)(((ENC_CR_R * (r)) + (ENC_CR_G * (g)) + (ENC_CR_B * (b)) + (ENC_C_BIAS << (sh))) >> (16 + (sh))))
+
+/* Private variables ---------------------------------------------------------*/
+static JPEG_HandleTypeDef  hjpeg_enc;
+static MDMA_HandleTypeDef  hmdma_enc_in;
+static MDMA_HandleTypeDef  hmdma_enc_out;
+
+static uint8_t EncRows[JPEG_ENC_IN_BUFFERS][JPEG_ENC_ROW_SIZE] __attribute__((section(".dma_d1"), aligned(32)));
+static uint8_t EncOut[JPEG_ENC_OUT_BUFFERS][JPEG_ENC_OUT_OFFSET + JPEG_ENC_OUT_SIZE] __attribute__((section(".dma_d1"), aligned(32)));
+
+static uint32_t                 EncWidth;        /* Image width, in pixels          */
+static uint32_t                 EncPitch;        /* Bytes per strip line            */
+static uint32_t                 EncFormat;
+static uint32_t                 EncSubsampling;
+static uint32_t                 EncStripHeight;  /* Lines per MCU row               */
+static uint32_t                 EncMcuSize;      /* Bytes per MCU                   */
+static uint32_t                 EncMcus;         /* MCUs per row                    */
+static uint32_t                 EncRowSize;      /* Bytes per MCU row               */
+static uint32_t                 EncLastPair;     /* Last pixel pair of a line       */
+static uint32_t                 EncLinesLeft;    /* Lines not pushed yet            */
+static uint32_t                 EncRowsLeft;     /* MCU rows not read by the codec  */
+static uint32_t                 EncStarted;      /* Codec started on the first row  */
+
+static uint32_t                 EncInWrite;      /* Next free row buffer            */
+static uint32_t                 EncInRead;       /* Row buffer read by the codec    */
+static __IO uint32_t            EncInCount;      /* Row buffers queued              */
+static uint32_t                 EncInFill;       /* Bytes of it read by the codec   */
+static uint32_t                 EncInPaused;     /* Codec input paused, no row      */
+
+static uint32_t                 EncOutWrite;     /* Chunk written by the codec      */
+static uint32_t                 EncOutRead;      /* Oldest chunk held by the user   */
+static __IO uint32_t            EncOutCount;     /* Chunks held by the user         */
+static uint32_t                 EncOutPaused;    /* Codec output paused, no chunk   */
+static uint32_t                 EncSize;         /* Bytes of the image so far       */
+
+static __IO JPEG_Enc_StateTypeDef EncState = JPEG_ENC_STATE_RESET;
+
+/* Private function prototypes -----------------------------------------------*/
+static void Enc_Convert(uint8_t *pRow, const uint8_t *pStrip, uint32_t NbLines);
+static void Enc_Rgb565_422(uint8_t *pRow, const uint32_t *pLine, uint32_t Line);
+static void Enc_Rgb565_420(uint8_t *pRow, const uint32_t *pLine0, const uint32_t *pLine1, uint32_t Line);
+static void Enc_Yuv_422(uint8_t *pRow, const uint32_t *pLine, uint32_t Line);
+static void Enc_Yuv_420(uint8_t *pRow, const uint32_t *pLine0, const uint32_t *pLine1, uint32_t Line);
+static void Enc_Fail(void);
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Initialize the JPEG codec and its MDMA channels
+  * @param  None
+  * @retval HAL status
+  */
+HAL_StatusTypeDef JPEG_Enc_Init(void)
+{
+  __HAL_RCC_JPGDECEN_CLK_ENABLE();
+  __HAL_RCC_MDMA_CLK_ENABLE();
+
+  /* Input MDMA: one 32-byte buffer per input FIFO threshold */
+  hmdma_enc_in.Instance                      = MDMA_Channel7;
+  hmdma_enc_in.Init.Request                  = MDMA_REQUEST_JPEG_INFIFO_TH;
+  hmdma_enc_in.Init.TransferTriggerMode      = MDMA_BUFFER_TRANSFER;
+  hmdma_enc_in.Init.Priority                 = MDMA_PRIORITY_HIGH;
+  hmdma_enc_in.Init.Endianness               = MDMA_LITTLE_ENDIANNESS_PRESERVE;
+  hmdma_enc_in.Init.SourceInc                = MDMA_SRC_INC_BYTE;
+  hmdma_enc_in.Init.DestinationInc           = MDMA_DEST_INC_DISABLE;
+  hmdma_enc_in.Init.SourceDataSize           = MDMA_SRC_DATASIZE_BYTE;
+  hmdma_enc_in.Init.DestDataSize             = MDMA_DEST_DATASIZE_WORD;
+  hmdma_enc_in.Init.DataAlignment            = MDMA_DATAALIGN_PACKENABLE;
+  hmdma_enc_in.Init.BufferTransferLength     = 32U;
+  hmdma_enc_in.Init.SourceBurst              = MDMA_SOURCE_BURST_32BEATS;
+  hmdma_enc_in.Init.DestBurst                = MDMA_DEST_BURST_16BEATS;
+  hmdma_enc_in.Init.SourceBlockAddressOffset = 0;
+  hmdma_enc_in.Init.DestBlockAddressOffset   = 0;
+  __HAL_LINKDMA(&hjpeg_enc, hdmain, hmdma_enc_in);
+  if(HAL_MDMA_Init(&hmdma_enc_in) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Output MDMA: one 32-byte buffer per output FIFO threshold */
+  hmdma_enc_out.Instance                      = MDMA_Channel6;
+  hmdma_enc_out.Init.Request                  = MDMA_REQUEST_JPEG_OUTFIFO_TH;
+  hmdma_enc_out.Init.TransferTriggerMode      = MDMA_BUFFER_TRANSFER;
+  hmdma_enc_out.Init.Priority                 = MDMA_PRIORITY_VERY_HIGH;
+  hmdma_enc_out.Init.Endianness               = MDMA_LITTLE_ENDIANNESS_PRESERVE;
+  hmdma_enc_out.Init.SourceInc                = MDMA_SRC_INC_DISABLE;
+  hmdma_enc_out.Init.DestinationInc           = MDMA_DEST_INC_BYTE;
+  hmdma_enc_out.Init.SourceDataSize           = MDMA_SRC_DATASIZE_WORD;
+  hmdma_enc_out.Init.DestDataSize             = MDMA_DEST_DATASIZE_BYTE;
+  hmdma_enc_out.Init.DataAlignment            = MDMA_DATAALIGN_PACKENABLE;
+  hmdma_enc_out.Init.BufferTransferLength     = 32U;
+  hmdma_enc_out.Init.SourceBurst              = MDMA_SOURCE_BURST_32BEATS;
+  hmdma_enc_out.Init.DestBurst                = MDMA_DEST_BURST_32BEATS;
+  hmdma_enc_out.Init.SourceBlockAddressOffset = 0;
+  hmdma_enc_out.Init.DestBlockAddressOffset   = 0;
+  __HAL_LINKDMA(&hjpeg_enc, hdmaout, hmdma_enc_out);
+  if(HAL_MDMA_Init(&hmdma_enc_out) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  hjpeg_enc.Instance = JPEG;
+  if(HAL_JPEG_Init(&hjpeg_enc) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Same preemption priority: the interrupts never preempt each other */
+  HAL_NVIC_SetPriority(JPEG_IRQn, JPEG_ENC_IRQ_PRIORITY, 0U);
+  HAL_NVIC_SetPriority(MDMA_IRQn, JPEG_ENC_IRQ_PRIORITY, 0U);
+  HAL_NVIC_EnableIRQ(JPEG_IRQn);
+  HAL_NVIC_EnableIRQ(MDMA_IRQn);
+
+  EncInCount  = 0U;
+  EncOutCount = 0U;
+  EncState    = JPEG_ENC_STATE_READY;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Configure the codec for a frame; the encoding starts with the
+  *         first strip pushed
+  * @param  pConf: frame geometry, pixel format and quality
+  * @retval HAL status, HAL_BUSY when a frame is encoded or chunks are held
+  */
+HAL_StatusTypeDef JPEG_Enc_Start(const JPEG_Enc_ConfTypeDef *pConf)
+{
+  JPEG_ConfTypeDef conf;
+  uint32_t pitch;
+
+  if(pConf == NULL)
+  {
+    return HAL_ERROR;
+  }
+  pitch = (pConf->Pitch != 0U) ? pConf->Pitch : (pConf->Width * 2U);
+  if((pConf->Width == 0U) || ((pConf->Width & 1U) != 0U) || (pConf->Width > JPEG_ENC_MAX_WIDTH) ||
+     (pConf->Height == 0U) || (pConf->Height > 0xFFFFU) ||
+     ((pitch & 3U) != 0U) || (pitch < (pConf->Width * 2U)) ||
+     (pConf->Format > JPEG_ENC_FORMAT_UYVY) ||
+     ((pConf->Subsampling != JPEG_422_SUBSAMPLING) && (pConf->Subsampling != JPEG_420_SUBSAMPLING)) ||
+     (pConf->Quality < 1U) || (pConf->Quality > 100U))
+  {
+    return HAL_ERROR;
+  }
+  if((EncState == JPEG_ENC_STATE_BUSY) || (EncOutCount != 0U))
+  {
+    return HAL_BUSY;
+  }
+  if(EncState == JPEG_ENC_STATE_RESET)
+  {
+    return HAL_ERROR;
+  }
+
+  conf.ColorSpace        = JPEG_YCBCR_COLORSPACE;
+  conf.ChromaSubsampling = pConf->Subsampling;
+  conf.ImageWidth        = pConf->Width;
+  conf.ImageHeight       = pConf->Height;
+  conf.ImageQuality      = pConf->Quality;
+  if(HAL_JPEG_ConfigEncoding(&hjpeg_enc, &conf) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  EncWidth       = pConf->Width;
+  EncPitch       = pitch;
+  EncFormat      = pConf->Format;
+  EncSubsampling = pConf->Subsampling;
+  EncStripHeight = (EncSubsampling == JPEG_420_SUBSAMPLING) ? 16U : 8U;
+  EncMcuSize     = (EncSubsampling == JPEG_420_SUBSAMPLING) ? 384U : 256U;
+  EncMcus        = (EncWidth + 15U) / 16U;
+  EncRowSize     = EncMcus * EncMcuSize;
+  EncLastPair    = (EncWidth / 2U) - 1U;
+  EncLinesLeft   = pConf->Height;
+  EncRowsLeft    = (pConf->Height + EncStripHeight - 1U) / EncStripHeight;
+  EncStarted     = 0U;
+
+  EncInWrite   = 0U;
+  EncInRead    = 0U;
+  EncInCount   = 0U;
+  EncInFill    = 0U;
+  EncInPaused  = 0U;
+  EncOutWrite  = 0U;
+  EncOutRead   = 0U;
+  EncOutPaused = 0U;
+  EncSize      = 0U;
+  EncState     = JPEG_ENC_STATE_BUSY;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Convert the next strip of the frame and queue it to the codec
+  * @note   The strip can be reused as soon as the function returns. Not to be
+  *         called from the JPEG or DMA interrupts.
+  * @param  pStrip: first line of the strip, aligned on 4 bytes
+  * @param  NbLines: lines in the strip, JPEG_Enc_GetStripHeight() but for
+  *         the last strip of the frame, which holds the lines left
+  * @retval HAL status, HAL_BUSY when no MCU row buffer is free
+  */
+HAL_StatusTypeDef JPEG_Enc_PushStrip(const uint8_t *pStrip, uint32_t NbLines)
+{
+  uint8_t *pRow;
+  uint32_t primask;
+
+  if(EncState != JPEG_ENC_STATE_BUSY)
+  {
+    return HAL_ERROR;
+  }
+  if((pStrip == NULL) || (((uint32_t)pStrip & 3U) != 0U) || (NbLines == 0U) ||
+     (NbLines != ((EncLinesLeft < EncStripHeight) ? EncLinesLeft : EncStripHeight)))
+  {
+    return HAL_ERROR;
+  }
+  if(EncInCount >= JPEG_ENC_IN_BUFFERS)
+  {
+    return HAL_BUSY;
+  }
+
+  /* The row buffer is free: the codec only reads the ones queued */
+  pRow = EncRows[EncInWrite];
+  Enc_Convert(pRow, pStrip, NbLines);
+
+#if (__DCACHE_PRESENT == 1)
+  /* Write the MCU row to memory before the DMA reads it */
+  if((SCB->CCR & SCB_CCR_DC_Msk) != 0)
+  {
+    SCB_CleanDCache_by_Addr((uint32_t *)pRow, (int32_t)EncRowSize);
+  }
+#endif
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if(EncState != JPEG_ENC_STATE_BUSY)
+  {
+    __set_PRIMASK(primask);
+    return HAL_ERROR;
+  }
+
+  EncInWrite = (EncInWrite + 1U) % JPEG_ENC_IN_BUFFERS;
+  EncInCount++;
+  EncLinesLeft -= NbLines;
+
+  if(EncStarted == 0U)
+  {
+    EncStarted = 1U;
+    if(HAL_JPEG_Encode_DMA(&hjpeg_enc, pRow, EncRowSize,
+                           &EncOut[0][JPEG_ENC_OUT_OFFSET], JPEG_ENC_OUT_SIZE) != HAL_OK)
+    {
+      EncState = JPEG_ENC_STATE_ERROR;
+      __set_PRIMASK(primask);
+      return HAL_ERROR;
+    }
+  }
+  else if(EncInPaused != 0U)
+  {
+    /* The codec waits for this row */
+    EncInPaused = 0U;
+    HAL_JPEG_ConfigInputBuffer(&hjpeg_enc, pRow, EncRowSize);
+    HAL_JPEG_Resume(&hjpeg_enc, JPEG_PAUSE_RESUME_INPUT);
+  }
+
+  __set_PRIMASK(primask);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Get the number of lines of a strip
+  * @param  None
+  * @retval Lines per strip of the frame started, 8 or 16
+  */
+uint32_t JPEG_Enc_GetStripHeight(void)
+{
+  return EncStripHeight;
+}
+
+/**
+  * @brief  Get the number of strips that can be pushed without waiting
+  * @param  None
+  * @retval Number of free MCU row buffers
+  */
+uint32_t JPEG_Enc_GetFreeStripCount(void)
+{
+  return JPEG_ENC_IN_BUFFERS - EncInCount;
+}
+
+/**
+  * @brief  Give an output chunk back to the codec
+  * @param  pData: oldest chunk given by JPEG_Enc_OutputCallback()
+  * @retval HAL status, HAL_ERROR when pData is not the oldest chunk held
+  */
+HAL_StatusTypeDef JPEG_Enc_ReleaseOutput(uint8_t *pData)
+{
+  uint32_t primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if((EncOutCount == 0U) || (pData != &EncOut[EncOutRead][JPEG_ENC_OUT_OFFSET]))
+  {
+    __set_PRIMASK(primask);
+    return HAL_ERROR;
+  }
+
+  EncOutRead = (EncOutRead + 1U) % JPEG_ENC_OUT_BUFFERS;
+  EncOutCount--;
+
+  /* The codec waits for this chunk */
+  if((EncOutPaused != 0U) && (EncState == JPEG_ENC_STATE_BUSY))
+  {
+    EncOutPaused = 0U;
+    HAL_JPEG_ConfigOutputBuffer(&hjpeg_enc, &EncOut[EncOutWrite][JPEG_ENC_OUT_OFFSET], JPEG_ENC_OUT_SIZE);
+    HAL_JPEG_Resume(&hjpeg_enc, JPEG_PAUSE_RESUME_OUTPUT);
+  }
+
+  __set_PRIMASK(primask);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the encoding in progress; the chunks held are dropped
+  * @param  None
+  * @retval HAL status
+  */
+HAL_StatusTypeDef JPEG_Enc_Abort(void)
+{
+  if(EncState == JPEG_ENC_STATE_RESET)
+  {
+    return HAL_ERROR;
+  }
+
+  HAL_NVIC_DisableIRQ(JPEG_IRQn);
+  HAL_NVIC_DisableIRQ(MDMA_IRQn);
+
+  if((EncState == JPEG_ENC_STATE_BUSY) && (EncStarted != 0U))
+  {
+    HAL_JPEG_Abort(&hjpeg_enc);
+  }
+  EncInCount  = 0U;
+  EncOutCount = 0U;
+  EncState    = JPEG_ENC_STATE_READY;
+
+  HAL_NVIC_EnableIRQ(JPEG_IRQn);
+  HAL_NVIC_EnableIRQ(MDMA_IRQn);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Get the state of the pipeline
+  * @param  None
+  * @retval JPEG_Enc_StateTypeDef
+  */
+JPEG_Enc_StateTypeDef JPEG_Enc_GetState(void)
+{
+  return EncState;
+}
+
+/**
+  * @brief  Wait for the end of the encoding in progress
+  * @param  Timeout: maximum time to wait, in ms
+  * @retval HAL_OK when the image is encoded, HAL_ERROR or HAL_TIMEOUT otherwise
+  */
+HAL_StatusTypeDef JPEG_Enc_WaitForEncode(uint32_t Timeout)
+{
+  uint32_t tickstart = HAL_GetTick();
+
+  while(EncState == JPEG_ENC_STATE_BUSY)
+  {
+    if((HAL_GetTick() - tickstart) > Timeout)
+    {
+      return HAL_TIMEOUT;
+    }
+  }
+  return (EncState == JPEG_ENC_STATE_READY) ? HAL_OK : HAL_ERROR;
+}
+
+/**
+  * @brief  Handle the JPEG interrupt, to be called from JPEG_IRQHandler()
+  * @param  None
+  * @retval None
+  */
+void JPEG_Enc_JPEG_IRQHandler(void)
+{
+  HAL_JPEG_IRQHandler(&hjpeg_enc);
+}
+
+/**
+  * @brief  Handle the MDMA interrupt, to be called from MDMA_IRQHandler()
+  * @param  None
+  * @retval None
+  */
+void JPEG_Enc_MDMA_IRQHandler(void)
+{
+  HAL_MDMA_IRQHandler(&hmdma_enc_in);
+  HAL_MDMA_IRQHandler(&hmdma_enc_out);
+}
+/**
+  * @brief  Output chunk callback: the chunk is given back with
+  *         JPEG_Enc_ReleaseOutput(), from this callback or later
+  * @param  pData: chunk, JPEG_ENC_OUT_HEADROOM bytes free in front of it
+  * @param  Length: bytes of the JPEG stream in the chunk
+  * @retval None
+  */
+__weak void JPEG_Enc_OutputCallback(uint8_t *pData, uint32_t Length)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Length);
+
+  /* Chunks dropped by default, the codec never stalls */
+  JPEG_Enc_ReleaseOutput(pData);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the JPEG_Enc_OutputCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Image encoded callback, called after the last output chunk
+  * @param  Size: size of the JPEG image in bytes
+  * @retval None
+  */
+__weak void JPEG_Enc_EncodeCpltCallback(uint32_t Size)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Size);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the JPEG_Enc_EncodeCpltCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Encoding error callback
+  * @param  None
+  * @retval None
+  */
+__weak void JPEG_Enc_ErrorCallback(void)
+{
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the JPEG_Enc_ErrorCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  JPEG input buffer consumed: give the codec the next MCU row
+  * @param  hjpeg: JPEG handle
+  * @param  NbEncodedData: bytes of the current row read by the codec
+  * @retval None
+  */
+void HAL_JPEG_GetDataCallback(JPEG_HandleTypeDef *hjpeg, uint32_t NbEncodedData)
+{
+  if(EncState != JPEG_ENC_STATE_BUSY)
+  {
+    return;
+  }
+
+  EncInFill += NbEncodedData;
+  if(EncInFill < EncRowSize)
+  {
+    /* Feed the tail of the row */
+    HAL_JPEG_ConfigInputBuffer(hjpeg, &EncRows[EncInRead][EncInFill], EncRowSize - EncInFill);
+    return;
+  }
+
+  EncInFill = 0U;
+  EncInRead = (EncInRead + 1U) % JPEG_ENC_IN_BUFFERS;
+  EncInCount--;
+  EncRowsLeft--;
+
+  if(EncRowsLeft == 0U)
+  {
+    /* Whole frame read, the codec ends on its own */
+    HAL_JPEG_ConfigInputBuffer(hjpeg, EncRows[EncInRead], 0U);
+  }
+  else if(EncInCount > 0U)
+  {
+    HAL_JPEG_ConfigInputBuffer(hjpeg, EncRows[EncInRead], EncRowSize);
+  }
+  else
+  {
+    /* Resumed by JPEG_Enc_PushStrip() */
+    HAL_JPEG_Pause(hjpeg, JPEG_PAUSE_RESUME_INPUT);
+    EncInPaused = 1U;
+  }
+}
+
+/**
+  * @brief  JPEG output buffer full: hand the chunk over, move to the next one
+  * @param  hjpeg: JPEG handle
+  * @param  pDataOut: output buffer
+  * @param  OutDataLength: bytes written in the output buffer
+  * @retval None
+  */
+void HAL_JPEG_DataReadyCallback(JPEG_HandleTypeDef *hjpeg, uint8_t *pDataOut, uint32_t OutDataLength)
+{
+  if(EncState != JPEG_ENC_STATE_BUSY)
+  {
+    return;
+  }
+
+#if (__DCACHE_PRESENT == 1)
+  /* Drop the lines of the chunk the CPU may hold, the DMA wrote it */
+  if((SCB->CCR & SCB_CCR_DC_Msk) != 0)
+  {
+    SCB_InvalidateDCache_by_Addr((uint32_t *)pDataOut, (int32_t)((OutDataLength + 31U) & ~31U));
+  }
+#endif
+
+  EncSize    += OutDataLength;
+  EncOutWrite = (EncOutWrite + 1U) % JPEG_ENC_OUT_BUFFERS;
+  EncOutCount++;
+
+  if(EncOutCount >= JPEG_ENC_OUT_BUFFERS)
+  {
+    /* Resumed by JPEG_Enc_ReleaseOutput() */
+    HAL_JPEG_Pause(hjpeg, JPEG_PAUSE_RESUME_OUTPUT);
+    EncOutPaused = 1U;
+  }
+  else
+  {
+    HAL_JPEG_ConfigOutputBuffer(hjpeg, &EncOut[EncOutWrite][JPEG_ENC_OUT_OFFSET], JPEG_ENC_OUT_SIZE);
+  }
+
+  JPEG_Enc_OutputCallback(pDataOut, OutDataLength);
+}
+
+/**
+  * @brief  JPEG encoding complete
+  * @param  hjpeg: JPEG handle
+  * @retval None
+  */
+void HAL_JPEG_EncodeCpltCallback(JPEG_HandleTypeDef *hjpeg)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hjpeg);
+
+  if(EncState == JPEG_ENC_STATE_BUSY)
+  {
+    EncOutPaused = 0U;
+    EncState     = JPEG_ENC_STATE_READY;
+    JPEG_Enc_EncodeCpltCallback(EncSize);
+  }
+}
+
+/**
+  * @brief  JPEG encoding error
+  * @param  hjpeg: JPEG handle
+  * @retval None
+  */
+void HAL_JPEG_ErrorCallback(JPEG_HandleTypeDef *hjpeg)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hjpeg);
+
+  Enc_Fail();
+}
+
+/**
+  * @brief  Convert a strip into one MCU row
+  * @param  pRow: MCU row buffer
+  * @param  pStrip: first line of the strip
+  * @param  NbLines: lines in the strip, the last one is repeated below
+  * @retval None
+  */
+static void Enc_Convert(uint8_t *pRow, const uint8_t *pStrip, uint32_t NbLines)
+{
+  const uint32_t *pLine0;
+  const uint32_t *pLine1;
+  uint32_t line;
+
+  for(line = 0U; line < EncStripHeight; line++)
+  {
+    pLine0 = (const uint32_t *)(pStrip + (((line < NbLines) ? line : (NbLines - 1U)) * EncPitch));
+
+    if(EncSubsampling == JPEG_422_SUBSAMPLING)
+    {
+      if(EncFormat == JPEG_ENC_FORMAT_RGB565)
+      {
+        Enc_Rgb565_422(pRow, pLine0, line);
+      }
+      else
+      {
+        Enc_Yuv_422(pRow, pLine0, line);
+      }
+    }
+    else
+    {
+      /* Two lines for each chroma line */
+      line++;
+      pLine1 = (const uint32_t *)(pStrip + (((line < NbLines) ? line : (NbLines - 1U)) * EncPitch));
+      if(EncFormat == JPEG_ENC_FORMAT_RGB565)
+      {
+        Enc_Rgb565_420(pRow, pLine0, pLine1, line - 1U);
+      }
+      else
+      {
+        Enc_Yuv_420(pRow, pLine0, pLine1, line - 1U);
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Convert one RGB565 line into 4:2:2 MCUs
+  * @note   A 4:2:2 MCU is 16x8 pixels: Y left, Y right, Cb and Cr 8x8 blocks.
+  *         Each word holds a pixel pair, the pairs past the image width
+  *         repeat the last one.
+  * @param  pRow: MCU row buffer
+  * @param  pLine: line of pixels
+  * @param  Line: line in the MCU, 0 to 7
+  * @retval None
+  */
+static void Enc_Rgb565_422(uint8_t *pRow, const uint32_t *pLine, uint32_t Line)
+{
+  uint8_t *pY = pRow + (Line * 8U);
+  uint8_t *pCb = pRow + 128U + (Line * 8U);
+  uint32_t mcu, pair, index, offset, word;
+  int32_t r0, g0, b0, r1, g1, b1;
+
+  for(mcu = 0U; mcu < EncMcus; mcu++)
+  {
+    for(pair = 0U; pair < 8U; pair++)
+    {
+      index = (mcu * 8U) + pair;
+      word = pLine[(index < EncLastPair) ? index : EncLastPair];
+
+      r0 = (int32_t)((word >> 11) & 0x1FU);
+      g0 = (int32_t)((word >> 5) & 0x3FU);
+      b0 = (int32_t)(word & 0x1FU);
+      r1 = (int32_t)(word >> 27);
+      g1 = (int32_t)((word >> 21) & 0x3FU);
+      b1 = (int32_t)((word >> 16) & 0x1FU);
+
+      offset = ((pair & 4U) << 4) + ((pair & 3U) << 1);
+      pY[offset]      = ENC_Y(r0, g0, b0);
+      pY[offset + 1U] = ENC_Y(r1, g1, b1);
+      pCb[pair]       = ENC_CB(r0 + r1, g0 + g1, b0 + b1, 1);
+      pCb[pair + 64U] = ENC_CR(r0 + r1, g0 + g1, b0 + b1, 1);
+    }
+    pY  += 256U;
+    pCb += 256U;
+  }
+}
+
+/**
+  * @brief  Convert two RGB565 lines into 4:2:0 MCUs
+  * @note   A 4:2:0 MCU is 16x16 pixels: four Y blocks (top left, top right,
+  *         bottom left, bottom right), Cb and Cr 8x8 blocks.
+  * @param  pRow: MCU row buffer
+  * @param  pLine0: even line of pixels
+  * @param  pLine1: odd line of pixels, below pLine0
+  * @param  Line: line of pLine0 in the MCU, 0 to 14
+  * @retval None
+  */
+static void Enc_Rgb565_420(uint8_t *pRow, const uint32_t *pLine0, const uint32_t *pLine1, uint32_t Line)
+{
+  uint8_t *pY = pRow + ((Line & 8U) << 4) + ((Line & 7U) * 8U);
+  uint8_t *pCb = pRow + 256U + ((Line >> 1) * 8U);
+  uint32_t mcu, pair, index, offset, word0, word1;
+  int32_t r0, g0, b0, r1, g1, b1, r2, g2, b2, r3, g3, b3;
+
+  for(mcu = 0U; mcu < EncMcus; mcu++)
+  {
+    for(pair = 0U; pair < 8U; pair++)
+    {
+      index = (mcu * 8U) + pair;
+      index = (index < EncLastPair) ? index : EncLastPair;
+      word0 = pLine0[index];
+      word1 = pLine1[index];
+
+      r0 = (int32_t)((word0 >> 11) & 0x1FU);
+      g0 = (int32_t)((word0 >> 5) & 0x3FU);
+      b0 = (int32_t)(word0 & 0x1FU);
+      r1 = (int32_t)(word0 >> 27);
+      g1 = (int32_t)((word0 >> 21) & 0x3FU);
+      b1 = (int32_t)((word0 >> 16) & 0x1FU);
+      r2 = (int32_t)((word1 >> 11) & 0x1FU);
+      g2 = (int32_t)((word1 >> 5) & 0x3FU);
+      b2 = (int32_t)(word1 & 0x1FU);
+      r3 = (int32_t)(word1 >> 27);
+      g3 = (int32_t)((word1 >> 21) & 0x3FU);
+      b3 = (int32_t)((word1 >> 16) & 0x1FU);
+
+      offset = ((pair & 4U) << 4) + ((pair & 3U) << 1);
+      pY[offset]           = ENC_Y(r0, g0, b0);
+      pY[offset + 1U]      = ENC_Y(r1, g1, b1);
+      pY[offset + 8U]      = ENC_Y(r2, g2, b2);
+      pY[offset + 9U]      = ENC_Y(r3, g3, b3);
+      r0 += r1 + r2 + r3;
+      g0 += g1 + g2 + g3;
+      b0 += b1 + b2 + b3;
+      pCb[pair]       = ENC_CB(r0, g0, b0, 2);
+      pCb[pair + 64U] = ENC_CR(r0, g0, b0, 2);
+    }
+    pY  += 384U;
+    pCb += 384U;
+  }
+}
+
+/**
+  * @brief  Reorder one YCbCr 4:2:2 line into 4:2:2 MCUs
+  * @param  pRow: MCU row buffer
+  * @param  pLine: line of pixels, YUYV or UYVY
+  * @param  Line: line in the MCU, 0 to 7
+  * @retval None
+  */
+static void Enc_Yuv_422(uint8_t *pRow, const uint32_t *pLine, uint32_t Line)
+{
+  uint8_t *pY = pRow + (Line * 8U);
+  uint8_t *pCb = pRow + 128U + (Line * 8U);
+  uint32_t shift = (EncFormat == JPEG_ENC_FORMAT_UYVY) ? 8U : 0U;
+  uint32_t mcu, pair, index, offset, word;
+
+  for(mcu = 0U; mcu < EncMcus; mcu++)
+  {
+    for(pair = 0U; pair < 8U; pair++)
+    {
+      index = (mcu * 8U) + pair;
+      word = pLine[(index < EncLastPair) ? index : EncLastPair];
+
+      offset = ((pair & 4U) << 4) + ((pair & 3U) << 1);
+      pY[offset]      = (uint8_t)(word >> shift);
+      pY[offset + 1U] = (uint8_t)(word >> (shift + 16U));
+      pCb[pair]       = (uint8_t)(word >> (8U - shift));
+      pCb[pair + 64U] = (uint8_t)(word >> (24U - shift));
+    }
+    pY  += 256U;
+    pCb += 256U;
+  }
+}
+
+/**
+  * @brief  Reorder two YCbCr 4:2:2 lines into 4:2:0 MCUs, averaging chroma
+  * @param  pRow: MCU row buffer
+  * @param  pLine0: even line of pixels, YUYV or UYVY
+  * @param  pLine1: odd line of pixels, below pLine0
+  * @param  Line: line of pLine0 in the MCU, 0 to 14
+  * @retval None
+  */
+static void Enc_Yuv_420(uint8_t *pRow, const uint32_t *pLine0, const uint32_t *pLine1, uint32_t Line)
+{
+  uint8_t *pY = pRow + ((Line & 8U) << 4) + ((Line & 7U) * 8U);
+  uint8_t *pCb = pRow + 256U + ((Line >> 1) * 8U);
+  uint32_t shift = (EncFormat == JPEG_ENC_FORMAT_UYVY) ? 8U : 0U;
+  uint32_t mcu, pair, index, offset, word0, word1, chroma;
+
+  for(mcu = 0U; mcu < EncMcus; mcu++)
+  {
+    for(pair = 0U; pair < 8U; pair++)
+    {
+      index = (mcu * 8U) + pair;
+      index = (index < EncLastPair) ? index : EncLastPair;
+      word0 = pLine0[index];
+      word1 = pLine1[index];
+
+      offset = ((pair & 4U) << 4) + ((pair & 3U) << 1);
+      pY[offset]      = (uint8_t)(word0 >> shift);
+      pY[offset + 1U] = (uint8_t)(word0 >> (shift + 16U));
+      pY[offset + 8U] = (uint8_t)(word1 >> shift);
+      pY[offset + 9U] = (uint8_t)(word1 >> (shift + 16U));
+
+      /* Cb and Cr of both lines added in parallel, 9 bits each */
+      chroma = ((word0 >> (8U - shift)) & 0x00FF00FFU) + ((word1 >> (8U - shift)) & 0x00FF00FFU) + 0x00010001U;
+      pCb[pair]       = (uint8_t)(chroma >> 1);
+      pCb[pair + 64U] = (uint8_t)(chroma >> 17);
+    }
+    pY  += 384U;
+    pCb += 384U;
+  }
+}
+
+/**
+  * @brief  Stop the encoding in progress on error
+  * @param  None
+  * @retval None
+  */
+static void Enc_Fail(void)
+{
+  if(EncState == JPEG_ENC_STATE_BUSY)
+  {
+    EncState = JPEG_ENC_STATE_ERROR;
+    HAL_JPEG_Abort(&hjpeg_enc);
+    EncInCount  = 0U;
+    EncOutCount = 0U;
+    JPEG_Enc_ErrorCallback();
+  }
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
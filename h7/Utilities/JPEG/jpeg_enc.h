@@ -0,0 +1,127 @@
+/**
+  ******************************************************************************
+  * @file    jpeg_enc.h
+  * @author  MCD Application Team
+  * @brief   Header for jpeg_enc module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _JPEG_ENC_H__
+#define _JPEG_ENC_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+  JPEG_ENC_STATE_RESET = 0U,  /* Not initialized                 */
+  JPEG_ENC_STATE_READY = 1U,  /* Initialized, no encoding        */
+  JPEG_ENC_STATE_BUSY  = 2U,  /* Encoding in progress            */
+  JPEG_ENC_STATE_ERROR = 3U   /* Last encoding failed or aborted */
+} JPEG_Enc_StateTypeDef;
+
+typedef struct
+{
+  uint32_t Width;        /* Image width, in pixels, even                          */
+  uint32_t Height;       /* Image height, in lines                                */
+  uint32_t Pitch;        /* Bytes between two lines of a strip, multiple of 4,
+                            0 for Width * 2                                       */
+  uint32_t Format;       /* Pixels of the strips, JPEG_ENC_FORMAT_xxx             */
+  uint32_t Subsampling;  /* JPEG_422_SUBSAMPLING or JPEG_420_SUBSAMPLING          */
+  uint32_t Quality;      /* From 1 to 100                                         */
+} JPEG_Enc_ConfTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Pixel formats of the strips, as captured by the DCMI */
+#define JPEG_ENC_FORMAT_RGB565   0U   /* 16-bit little endian words, red in bits 15:11 */
+#define JPEG_ENC_FORMAT_YUYV     1U   /* Bytes Y0 Cb Y1 Cr                             */
+#define JPEG_ENC_FORMAT_UYVY     2U   /* Bytes Cb Y0 Cr Y1                             */
+
+/* Widest image encoded, in pixels. Override in main.h. */
+#if !defined(JPEG_ENC_MAX_WIDTH)
+#define JPEG_ENC_MAX_WIDTH       800U
+#endif
+/* MCU row buffers between the conversion and the codec (at least 2) */
+#if !defined(JPEG_ENC_IN_BUFFERS)
+#define JPEG_ENC_IN_BUFFERS      2U
+#endif
+/* Output chunks written by the codec (at least 2) */
+#if !defined(JPEG_ENC_OUT_BUFFERS)
+#define JPEG_ENC_OUT_BUFFERS     4U
+#endif
+/* Size of one output chunk in bytes, multiple of 32 */
+#if !defined(JPEG_ENC_OUT_SIZE)
+#define JPEG_ENC_OUT_SIZE        4096U
+#endif
+/* Bytes free in front of each output chunk, for the header of a transport */
+#if !defined(JPEG_ENC_OUT_HEADROOM)
+#define JPEG_ENC_OUT_HEADROOM    0U
+#endif
+/* Preemption priority shared by the JPEG and MDMA interrupts */
+#if !defined(JPEG_ENC_IRQ_PRIORITY)
+#define JPEG_ENC_IRQ_PRIORITY    0x07U
+#endif
+
+/* Size of one MCU row buffer: 24 bytes per column covers 4:2:2 and 4:2:0 */
+#define JPEG_ENC_ROW_SIZE        ((((JPEG_ENC_MAX_WIDTH) + 15U) & ~15U) * 24U)
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef     JPEG_Enc_Init(void);
+HAL_StatusTypeDef     JPEG_Enc_Start(const JPEG_Enc_ConfTypeDef *pConf);
+HAL_StatusTypeDef     JPEG_Enc_PushStrip(const uint8_t *pStrip, uint32_t NbLines);
+uint32_t              JPEG_Enc_GetStripHeight(void);
+uint32_t              JPEG_Enc_GetFreeStripCount(void);
+HAL_StatusTypeDef     JPEG_Enc_ReleaseOutput(uint8_t *pData);
+HAL_StatusTypeDef     JPEG_Enc_Abort(void);
+JPEG_Enc_StateTypeDef JPEG_Enc_GetState(void);
+HAL_StatusTypeDef     JPEG_Enc_WaitForEncode(uint32_t Timeout);
+
+void JPEG_Enc_JPEG_IRQHandler(void);
+void JPEG_Enc_MDMA_IRQHandler(void);
+
+void JPEG_Enc_OutputCallback(uint8_t *pData, uint32_t Length);
+void JPEG_Enc_EncodeCpltCallback(uint32_t Size);
+void JPEG_Enc_ErrorCallback(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _JPEG_ENC_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
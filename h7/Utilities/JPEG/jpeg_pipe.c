@@ -0,0 +1,816 @@
+/**
+  ******************************************************************************
+  * @file    jpeg_pipe.c
+  * @author  MCD Application Team
+  * @brief   Streaming JPEG decoder: JPEG codec with MDMA, DMA2D YCbCr to RGB
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- in the linker script place the .dma_d1 section in the AXI SRAM (see
+   dma_pool.c); the MCU row buffers live there, where both the MDMA and
+   the DMA2D reach them. Size them with JPEG_PIPE_MAX_WIDTH in main.h.
+
+2- call JPEG_Pipe_Init(), then call JPEG_Pipe_JPEG_IRQHandler(),
+   JPEG_Pipe_MDMA_IRQHandler() and JPEG_Pipe_DMA2D_IRQHandler() from the
+   JPEG_IRQHandler(), MDMA_IRQHandler() and DMA2D_IRQHandler() of
+   stm32h7xx_it.c. The module implements the HAL_JPEG_xxxCallback()
+   functions, so the JPEG codec is reserved to it.
+
+3- hand the compressed stream over in chunks with JPEG_Pipe_PushInput(),
+   then start the decoding of the image with JPEG_Pipe_Start(). Keep
+   reading the next chunks (from QSPI, SD...) into the buffers given back
+   by JPEG_Pipe_InputReleasedCallback() and push them as they come: the
+   codec pauses when it runs out of data and resumes on the next push.
+   Every chunk must hold at least 32 bytes; pad the last one if needed,
+   the codec stops on the end of image marker.
+
+4- each MCU row decoded by the codec is converted from YCbCr to RGB565 or
+   ARGB8888 by the DMA2D straight into the framebuffer, while the codec
+   decodes the next row into the other buffer.
+   JPEG_Pipe_DecodeCpltCallback() is called once the last row is drawn,
+   the chunks still queued are then released.
+
+5- for motion JPEG, start each frame in its own chunk and call
+   JPEG_Pipe_Start() again from (or after) the complete callback, with the
+   back buffer given by BSP_LCD_Present() as output address.
+
+Only YCbCr images with 4:4:4, 4:2:2 or 4:2:0 chroma subsampling can be
+converted by the DMA2D; other images end with JPEG_Pipe_ErrorCallback().
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "jpeg_pipe.h"
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  uint8_t  *pBase;  /* Chunk as pushed, given back when consumed */
+  uint8_t  *pData;  /* First byte not read by the codec yet      */
+  uint32_t Size;    /* Bytes not read by the codec yet           */
+} JPEG_Pipe_ChunkTypeDef;
+
+/* Private define ------------------------------------------------------------*/
+/* The output MDMA is started before the header is parsed: its first transfer
+   is kept to one MDMA buffer, the rest of the first MCU row is requested
+   once the image geometry is known */
+#define JPEG_PIPE_FIRST_CHUNK   32U
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static JPEG_HandleTypeDef  hjpeg_pipe;
+static MDMA_HandleTypeDef  hmdma_pipe_in;
+static MDMA_HandleTypeDef  hmdma_pipe_out;
+static DMA2D_HandleTypeDef hdma2d_pipe;
+
+static uint8_t PipeRows[JPEG_PIPE_OUT_BUFFERS][JPEG_PIPE_ROW_SIZE] __attribute__((section(".dma_d1"), aligned(32)));
+
+static JPEG_Pipe_ChunkTypeDef   PipeIn[JPEG_PIPE_IN_BUFFERS];
+static uint32_t                 PipeInRead;      /* Chunk read by the codec         */
+static uint32_t                 PipeInWrite;     /* Next free chunk descriptor      */
+static __IO uint32_t            PipeInCount;     /* Chunks queued                   */
+static uint32_t                 PipeInPaused;    /* Codec input paused, no chunk    */
+
+static JPEG_Pipe_OutputTypeDef  PipeOutput;
+static uint32_t                 PipeWidth;       /* Image width, in pixels          */
+static uint32_t                 PipeHeight;      /* Image height, in lines          */
+static uint32_t                 PipeRowSize;     /* Bytes per MCU row               */
+static uint32_t                 PipeMcuHeight;   /* Lines per MCU row               */
+static uint32_t                 PipeInputOffset; /* Padding pixels per MCU row line */
+static uint32_t                 PipeCss;         /* DMA2D chroma subsampling        */
+static uint32_t                 PipeInfoReady;
+
+static uint32_t                 PipeOutWrite;    /* Row buffer filled by the codec  */
+static uint32_t                 PipeOutFill;     /* Bytes already in it             */
+static uint32_t                 PipeOutRead;     /* Oldest full row buffer          */
+static uint32_t                 PipeOutCount;    /* Full row buffers                */
+static uint32_t                 PipeOutPaused;   /* Codec output paused, no buffer  */
+static uint32_t                 PipeRowConvert;  /* MCU row held by PipeOutRead     */
+static uint32_t                 PipeDma2dBusy;
+static uint32_t                 PipeDecodeDone;
+
+static __IO JPEG_Pipe_StateTypeDef PipeState = JPEG_PIPE_STATE_RESET;
+
+/* Private function prototypes -----------------------------------------------*/
+static void Pipe_ReleaseInput(void);
+static void Pipe_FlushInput(void);
+static void Pipe_Convert(void);
+static void Pipe_ReleaseRow(void);
+static void Pipe_CheckEnd(void);
+static void Pipe_Fail(void);
+static void Pipe_ConvertCplt(DMA2D_HandleTypeDef *hdma2d);
+static void Pipe_ConvertError(DMA2D_HandleTypeDef *hdma2d);
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Initialize the JPEG codec, its MDMA channels and the DMA2D
+  * @param  None
+  * @retval HAL status
+  */
+HAL_StatusTypeDef JPEG_Pipe_Init(void)
+{
+  __HAL_RCC_JPGDECEN_CLK_ENABLE();
+  __HAL_RCC_MDMA_CLK_ENABLE();
+  __HAL_RCC_DMA2D_CLK_ENABLE();
+
+  /* Input MDMA: one 32-byte buffer per input FIFO threshold */
+  hmdma_pipe_in.Instance                      = MDMA_Channel7;
+  hmdma_pipe_in.Init.Request                  = MDMA_REQUEST_JPEG_INFIFO_TH;
+  hmdma_pipe_in.Init.TransferTriggerMode      = MDMA_BUFFER_TRANSFER;
+  hmdma_pipe_in.Init.Priority                 = MDMA_PRIORITY_HIGH;
+  hmdma_pipe_in.Init.Endianness               = MDMA_LITTLE_ENDIANNESS_PRESERVE;
+  hmdma_pipe_in.Init.SourceInc                = MDMA_SRC_INC_BYTE;
+  hmdma_pipe_in.Init.DestinationInc           = MDMA_DEST_INC_DISABLE;
+  hmdma_pipe_in.Init.SourceDataSize           = MDMA_SRC_DATASIZE_BYTE;
+  hmdma_pipe_in.Init.DestDataSize             = MDMA_DEST_DATASIZE_WORD;
+  hmdma_pipe_in.Init.DataAlignment            = MDMA_DATAALIGN_PACKENABLE;
+  hmdma_pipe_in.Init.BufferTransferLength     = 32U;
+  hmdma_pipe_in.Init.SourceBurst              = MDMA_SOURCE_BURST_32BEATS;
+  hmdma_pipe_in.Init.DestBurst                = MDMA_DEST_BURST_16BEATS;
+  hmdma_pipe_in.Init.SourceBlockAddressOffset = 0;
+  hmdma_pipe_in.Init.DestBlockAddressOffset   = 0;
+  __HAL_LINKDMA(&hjpeg_pipe, hdmain, hmdma_pipe_in);
+  if(HAL_MDMA_Init(&hmdma_pipe_in) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Output MDMA: one 32-byte buffer per output FIFO threshold */
+  hmdma_pipe_out.Instance                      = MDMA_Channel6;
+  hmdma_pipe_out.Init.Request                  = MDMA_REQUEST_JPEG_OUTFIFO_TH;
+  hmdma_pipe_out.Init.TransferTriggerMode      = MDMA_BUFFER_TRANSFER;
+  hmdma_pipe_out.Init.Priority                 = MDMA_PRIORITY_VERY_HIGH;
+  hmdma_pipe_out.Init.Endianness               = MDMA_LITTLE_ENDIANNESS_PRESERVE;
+  hmdma_pipe_out.Init.SourceInc                = MDMA_SRC_INC_DISABLE;
+  hmdma_pipe_out.Init.DestinationInc           = MDMA_DEST_INC_BYTE;
+  hmdma_pipe_out.Init.SourceDataSize           = MDMA_SRC_DATASIZE_WORD;
+  hmdma_pipe_out.Init.DestDataSize             = MDMA_DEST_DATASIZE_BYTE;
+  hmdma_pipe_out.Init.DataAlignment            = MDMA_DATAALIGN_PACKENABLE;
+  hmdma_pipe_out.Init.BufferTransferLength     = 32U;
+  hmdma_pipe_out.Init.SourceBurst              = MDMA_SOURCE_BURST_32BEATS;
+  hmdma_pipe_out.Init.DestBurst                = MDMA_DEST_BURST_32BEATS;
+  hmdma_pipe_out.Init.SourceBlockAddressOffset = 0;
+  hmdma_pipe_out.Init.DestBlockAddressOffset   = 0;
+  __HAL_LINKDMA(&hjpeg_pipe, hdmaout, hmdma_pipe_out);
+  if(HAL_MDMA_Init(&hmdma_pipe_out) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  hjpeg_pipe.Instance = JPEG;
+  if(HAL_JPEG_Init(&hjpeg_pipe) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  hdma2d_pipe.Instance          = DMA2D;
+  hdma2d_pipe.XferCpltCallback  = Pipe_ConvertCplt;
+  hdma2d_pipe.XferErrorCallback = Pipe_ConvertError;
+
+  /* Same preemption priority: the three interrupts never preempt each other */
+  HAL_NVIC_SetPriority(JPEG_IRQn, JPEG_PIPE_IRQ_PRIORITY, 0U);
+  HAL_NVIC_SetPriority(MDMA_IRQn, JPEG_PIPE_IRQ_PRIORITY, 0U);
+  HAL_NVIC_SetPriority(DMA2D_IRQn, JPEG_PIPE_IRQ_PRIORITY, 0U);
+  HAL_NVIC_EnableIRQ(JPEG_IRQn);
+  HAL_NVIC_EnableIRQ(MDMA_IRQn);
+  HAL_NVIC_EnableIRQ(DMA2D_IRQn);
+
+  PipeInRead  = 0U;
+  PipeInWrite = 0U;
+  PipeInCount = 0U;
+  PipeState   = JPEG_PIPE_STATE_READY;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Queue a chunk of the compressed stream
+  * @note   The chunk must stay untouched until JPEG_Pipe_InputReleasedCallback()
+  *         gives it back.
+  * @param  pData: chunk
+  * @param  Size: size of the chunk in bytes, at least 32
+  * @retval HAL status, HAL_BUSY when JPEG_PIPE_IN_BUFFERS chunks are queued
+  */
+HAL_StatusTypeDef JPEG_Pipe_PushInput(uint8_t *pData, uint32_t Size)
+{
+  uint32_t primask;
+
+  if((pData == NULL) || (Size < 32U) || (PipeState == JPEG_PIPE_STATE_RESET))
+  {
+    return HAL_ERROR;
+  }
+
+#if (__DCACHE_PRESENT == 1)
+  /* Write the chunk to memory before the MDMA reads it */
+  if((SCB->CCR & SCB_CCR_DC_Msk) != 0)
+  {
+    SCB_CleanDCache_by_Addr((uint32_t *)((uint32_t)pData & ~31U), (int32_t)(Size + ((uint32_t)pData & 31U)));
+  }
+#endif
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if(PipeInCount >= JPEG_PIPE_IN_BUFFERS)
+  {
+    __set_PRIMASK(primask);
+    return HAL_BUSY;
+  }
+
+  PipeIn[PipeInWrite].pBase = pData;
+  PipeIn[PipeInWrite].pData = pData;
+  PipeIn[PipeInWrite].Size  = Size;
+  PipeInWrite = (PipeInWrite + 1U) % JPEG_PIPE_IN_BUFFERS;
+  PipeInCount++;
+
+  /* The codec waits for this chunk */
+  if(PipeInPaused != 0U)
+  {
+    PipeInPaused = 0U;
+    HAL_JPEG_ConfigInputBuffer(&hjpeg_pipe, pData, Size);
+    HAL_JPEG_Resume(&hjpeg_pipe, JPEG_PAUSE_RESUME_INPUT);
+  }
+
+  __set_PRIMASK(primask);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Get the number of chunks that can still be queued
+  * @param  None
+  * @retval Number of free chunk descriptors
+  */
+uint32_t JPEG_Pipe_GetFreeInputCount(void)
+{
+  return JPEG_PIPE_IN_BUFFERS - PipeInCount;
+}
+
+/**
+  * @brief  Start the decoding of an image from the queued chunks
+  * @param  pOutput: framebuffer and position of the image
+  * @retval HAL status
+  */
+HAL_StatusTypeDef JPEG_Pipe_Start(const JPEG_Pipe_OutputTypeDef *pOutput)
+{
+  if((pOutput == NULL) ||
+     ((pOutput->ColorMode != DMA2D_OUTPUT_RGB565) && (pOutput->ColorMode != DMA2D_OUTPUT_ARGB8888)))
+  {
+    return HAL_ERROR;
+  }
+  if(PipeState == JPEG_PIPE_STATE_BUSY)
+  {
+    return HAL_BUSY;
+  }
+  if((PipeState == JPEG_PIPE_STATE_RESET) || (PipeInCount == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  PipeOutput     = *pOutput;
+  PipeInfoReady  = 0U;
+  PipeInPaused   = 0U;
+  PipeOutWrite   = 0U;
+  PipeOutFill    = 0U;
+  PipeOutRead    = 0U;
+  PipeOutCount   = 0U;
+  PipeOutPaused  = 0U;
+  PipeRowConvert = 0U;
+  PipeDma2dBusy  = 0U;
+  PipeDecodeDone = 0U;
+  PipeState      = JPEG_PIPE_STATE_BUSY;
+
+  if(HAL_JPEG_Decode_DMA(&hjpeg_pipe, PipeIn[PipeInRead].pData, PipeIn[PipeInRead].Size,
+                         PipeRows[0], JPEG_PIPE_FIRST_CHUNK) != HAL_OK)
+  {
+    PipeState = JPEG_PIPE_STATE_ERROR;
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the decoding in progress and release the queued chunks
+  * @param  None
+  * @retval HAL status
+  */
+HAL_StatusTypeDef JPEG_Pipe_Abort(void)
+{
+  if(PipeState == JPEG_PIPE_STATE_RESET)
+  {
+    return HAL_ERROR;
+  }
+
+  HAL_NVIC_DisableIRQ(JPEG_IRQn);
+  HAL_NVIC_DisableIRQ(MDMA_IRQn);
+  HAL_NVIC_DisableIRQ(DMA2D_IRQn);
+
+  if(PipeState == JPEG_PIPE_STATE_BUSY)
+  {
+    HAL_JPEG_Abort(&hjpeg_pipe);
+    if(PipeDma2dBusy != 0U)
+    {
+      HAL_DMA2D_Abort(&hdma2d_pipe);
+      PipeDma2dBusy = 0U;
+    }
+  }
+  Pipe_FlushInput();
+  PipeState = JPEG_PIPE_STATE_READY;
+
+  HAL_NVIC_EnableIRQ(JPEG_IRQn);
+  HAL_NVIC_EnableIRQ(MDMA_IRQn);
+  HAL_NVIC_EnableIRQ(DMA2D_IRQn);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Get the state of the pipeline
+  * @param  None
+  * @retval JPEG_Pipe_StateTypeDef
+  */
+JPEG_Pipe_StateTypeDef JPEG_Pipe_GetState(void)
+{
+  return PipeState;
+}
+
+/**
+  * @brief  Wait for the end of the decoding in progress
+  * @param  Timeout: maximum time to wait, in ms
+  * @retval HAL_OK when the image is drawn, HAL_ERROR or HAL_TIMEOUT otherwise
+  */
+HAL_StatusTypeDef JPEG_Pipe_WaitForDecode(uint32_t Timeout)
+{
+  uint32_t tickstart = HAL_GetTick();
+
+  while(PipeState == JPEG_PIPE_STATE_BUSY)
+  {
+    if((HAL_GetTick() - tickstart) > Timeout)
+    {
+      return HAL_TIMEOUT;
+    }
+  }
+  return (PipeState == JPEG_PIPE_STATE_READY) ? HAL_OK : HAL_ERROR;
+}
+
+/**
+  * @brief  Handle the JPEG interrupt, to be called from JPEG_IRQHandler()
+  * @param  None
+  * @retval None
+  */
+void JPEG_Pipe_JPEG_IRQHandler(void)
+{
+  HAL_JPEG_IRQHandler(&hjpeg_pipe);
+}
+
+/**
+  * @brief  Handle the MDMA interrupt, to be called from MDMA_IRQHandler()
+  * @param  None
+  * @retval None
+  */
+void JPEG_Pipe_MDMA_IRQHandler(void)
+{
+  HAL_MDMA_IRQHandler(&hmdma_pipe_in);
+  HAL_MDMA_IRQHandler(&hmdma_pipe_out);
+}
+
+/**
+  * @brief  Handle the DMA2D interrupt, to be called from DMA2D_IRQHandler()
+  * @param  None
+  * @retval None
+  */
+void JPEG_Pipe_DMA2D_IRQHandler(void)
+{
+  HAL_DMA2D_IRQHandler(&hdma2d_pipe);
+}
+
+/**
+  * @brief  Image header parsed callback
+  * @note   The output position may be changed here, e.g. to center the image.
+  * @param  pInfo: image information
+  * @param  pOutput: framebuffer and position of the image
+  * @retval None
+  */
+__weak void JPEG_Pipe_InfoReadyCallback(JPEG_ConfTypeDef *pInfo, JPEG_Pipe_OutputTypeDef *pOutput)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(pInfo);
+  UNUSED(pOutput);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the JPEG_Pipe_InfoReadyCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Chunk consumed callback: the buffer can be refilled
+  * @param  pData: chunk given to JPEG_Pipe_PushInput()
+  * @retval None
+  */
+__weak void JPEG_Pipe_InputReleasedCallback(uint8_t *pData)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(pData);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the JPEG_Pipe_InputReleasedCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Image drawn callback
+  * @param  None
+  * @retval None
+  */
+__weak void JPEG_Pipe_DecodeCpltCallback(void)
+{
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the JPEG_Pipe_DecodeCpltCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Decoding error callback
+  * @param  None
+  * @retval None
+  */
+__weak void JPEG_Pipe_ErrorCallback(void)
+{
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the JPEG_Pipe_ErrorCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  JPEG header parsed: compute the MCU row geometry
+  * @param  hjpeg: JPEG handle
+  * @param  pInfo: image information
+  * @retval None
+  */
+void HAL_JPEG_InfoReadyCallback(JPEG_HandleTypeDef *hjpeg, JPEG_ConfTypeDef *pInfo)
+{
+  uint32_t mcu_width;
+  uint32_t mcu_size;
+
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hjpeg);
+
+  JPEG_Pipe_InfoReadyCallback(pInfo, &PipeOutput);
+
+  switch(pInfo->ChromaSubsampling)
+  {
+  case JPEG_420_SUBSAMPLING:
+    mcu_width     = 16U;
+    PipeMcuHeight = 16U;
+    mcu_size      = 384U;
+    PipeCss       = DMA2D_CSS_420;
+    break;
+  case JPEG_422_SUBSAMPLING:
+    mcu_width     = 16U;
+    PipeMcuHeight = 8U;
+    mcu_size      = 256U;
+    PipeCss       = DMA2D_CSS_422;
+    break;
+  default:
+    mcu_width     = 8U;
+    PipeMcuHeight = 8U;
+    mcu_size      = 192U;
+    PipeCss       = DMA2D_NO_CSS;
+    break;
+  }
+
+  PipeWidth       = pInfo->ImageWidth;
+  PipeHeight      = pInfo->ImageHeight;
+  PipeRowSize     = ((PipeWidth + mcu_width - 1U) / mcu_width) * mcu_size;
+  PipeInputOffset = (mcu_width - (PipeWidth % mcu_width)) % mcu_width;
+
+  if((pInfo->ColorSpace != JPEG_YCBCR_COLORSPACE) ||
+     ((pInfo->ChromaSubsampling != JPEG_420_SUBSAMPLING) &&
+      (pInfo->ChromaSubsampling != JPEG_422_SUBSAMPLING) &&
+      (pInfo->ChromaSubsampling != JPEG_444_SUBSAMPLING)) ||
+     (PipeWidth == 0U) || (PipeWidth > JPEG_PIPE_MAX_WIDTH) ||
+     ((PipeOutput.X + PipeWidth) > PipeOutput.Pitch))
+  {
+    Pipe_Fail();
+  }
+  else
+  {
+    PipeInfoReady = 1U;
+  }
+}
+
+/**
+  * @brief  JPEG input buffer consumed: give the codec the next chunk
+  * @param  hjpeg: JPEG handle
+  * @param  NbDecodedData: bytes of the current chunk read by the codec
+  * @retval None
+  */
+void HAL_JPEG_GetDataCallback(JPEG_HandleTypeDef *hjpeg, uint32_t NbDecodedData)
+{
+  JPEG_Pipe_ChunkTypeDef *pChunk = &PipeIn[PipeInRead];
+
+  if(PipeState != JPEG_PIPE_STATE_BUSY)
+  {
+    return;
+  }
+
+  if(NbDecodedData < pChunk->Size)
+  {
+    /* The MDMA moves whole 32-byte buffers: feed the tail of the chunk */
+    pChunk->pData += NbDecodedData;
+    pChunk->Size  -= NbDecodedData;
+    HAL_JPEG_ConfigInputBuffer(hjpeg, pChunk->pData, pChunk->Size);
+  }
+  else
+  {
+    Pipe_ReleaseInput();
+    if(PipeInCount > 0U)
+    {
+      HAL_JPEG_ConfigInputBuffer(hjpeg, PipeIn[PipeInRead].pData, PipeIn[PipeInRead].Size);
+    }
+    else
+    {
+      /* Resumed by JPEG_Pipe_PushInput() */
+      HAL_JPEG_Pause(hjpeg, JPEG_PAUSE_RESUME_INPUT);
+      PipeInPaused = 1U;
+    }
+  }
+}
+
+/**
+  * @brief  JPEG output buffer full: convert the MCU row once complete
+  * @param  hjpeg: JPEG handle
+  * @param  pDataOut: output buffer
+  * @param  OutDataLength: bytes written in the output buffer
+  * @retval None
+  */
+void HAL_JPEG_DataReadyCallback(JPEG_HandleTypeDef *hjpeg, uint8_t *pDataOut, uint32_t OutDataLength)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(pDataOut);
+
+  if(PipeState != JPEG_PIPE_STATE_BUSY)
+  {
+    return;
+  }
+  if(PipeInfoReady == 0U)
+  {
+    Pipe_Fail();
+    return;
+  }
+
+  PipeOutFill += OutDataLength;
+  if(PipeOutFill < PipeRowSize)
+  {
+    HAL_JPEG_ConfigOutputBuffer(hjpeg, &PipeRows[PipeOutWrite][PipeOutFill], PipeRowSize - PipeOutFill);
+  }
+  else
+  {
+    PipeOutFill  = 0U;
+    PipeOutWrite = (PipeOutWrite + 1U) % JPEG_PIPE_OUT_BUFFERS;
+    PipeOutCount++;
+
+    if(PipeOutCount >= JPEG_PIPE_OUT_BUFFERS)
+    {
+      /* Resumed when the DMA2D releases a row buffer */
+      HAL_JPEG_Pause(hjpeg, JPEG_PAUSE_RESUME_OUTPUT);
+      PipeOutPaused = 1U;
+    }
+    else
+    {
+      HAL_JPEG_ConfigOutputBuffer(hjpeg, PipeRows[PipeOutWrite], PipeRowSize);
+    }
+    Pipe_Convert();
+  }
+}
+
+/**
+  * @brief  JPEG decoding complete
+  * @param  hjpeg: JPEG handle
+  * @retval None
+  */
+void HAL_JPEG_DecodeCpltCallback(JPEG_HandleTypeDef *hjpeg)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hjpeg);
+
+  PipeDecodeDone = 1U;
+  Pipe_CheckEnd();
+}
+
+/**
+  * @brief  JPEG decoding error
+  * @param  hjpeg: JPEG handle
+  * @retval None
+  */
+void HAL_JPEG_ErrorCallback(JPEG_HandleTypeDef *hjpeg)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hjpeg);
+
+  Pipe_Fail();
+}
+
+/**
+  * @brief  Give the chunk read by the codec back to the application
+  * @param  None
+  * @retval None
+  */
+static void Pipe_ReleaseInput(void)
+{
+  uint8_t *pBase = PipeIn[PipeInRead].pBase;
+
+  PipeInRead = (PipeInRead + 1U) % JPEG_PIPE_IN_BUFFERS;
+  PipeInCount--;
+  JPEG_Pipe_InputReleasedCallback(pBase);
+}
+
+/**
+  * @brief  Give all the queued chunks back to the application
+  * @param  None
+  * @retval None
+  */
+static void Pipe_FlushInput(void)
+{
+  PipeInPaused = 0U;
+  while(PipeInCount > 0U)
+  {
+    Pipe_ReleaseInput();
+  }
+}
+
+/**
+  * @brief  Start the DMA2D conversion of the oldest full row buffer
+  * @param  None
+  * @retval None
+  */
+static void Pipe_Convert(void)
+{
+  uint32_t line, height, address;
+
+  while((PipeState == JPEG_PIPE_STATE_BUSY) && (PipeDma2dBusy == 0U) && (PipeOutCount > 0U))
+  {
+    line   = PipeRowConvert * PipeMcuHeight;
+    height = PipeMcuHeight;
+
+    /* Drop the padding lines of the last MCU row and the lines out of the framebuffer */
+    if((line + height) > PipeHeight)
+    {
+      height = (line < PipeHeight) ? (PipeHeight - line) : 0U;
+    }
+    if((PipeOutput.Y + line + height) > PipeOutput.Height)
+    {
+      height = ((PipeOutput.Y + line) < PipeOutput.Height) ? (PipeOutput.Height - PipeOutput.Y - line) : 0U;
+    }
+    if(height == 0U)
+    {
+      Pipe_ReleaseRow();
+      continue;
+    }
+
+    address = PipeOutput.Address + ((((PipeOutput.Y + line) * PipeOutput.Pitch) + PipeOutput.X) *
+                                    ((PipeOutput.ColorMode == DMA2D_OUTPUT_RGB565) ? 2U : 4U));
+
+    hdma2d_pipe.Init.Mode         = DMA2D_M2M_PFC;
+    hdma2d_pipe.Init.ColorMode    = PipeOutput.ColorMode;
+    hdma2d_pipe.Init.OutputOffset = PipeOutput.Pitch - PipeWidth;
+
+    hdma2d_pipe.LayerCfg[1].InputOffset       = PipeInputOffset;
+    hdma2d_pipe.LayerCfg[1].InputColorMode    = DMA2D_INPUT_YCBCR;
+    hdma2d_pipe.LayerCfg[1].ChromaSubSampling = PipeCss;
+    hdma2d_pipe.LayerCfg[1].AlphaMode         = DMA2D_REPLACE_ALPHA;
+    hdma2d_pipe.LayerCfg[1].InputAlpha        = 0xFFU;
+
+    PipeDma2dBusy = 1U;
+    if((HAL_DMA2D_Init(&hdma2d_pipe) != HAL_OK) ||
+       (HAL_DMA2D_ConfigLayer(&hdma2d_pipe, 1U) != HAL_OK) ||
+       (HAL_DMA2D_Start_IT(&hdma2d_pipe, (uint32_t)PipeRows[PipeOutRead], address, PipeWidth, height) != HAL_OK))
+    {
+      PipeDma2dBusy = 0U;
+      Pipe_Fail();
+    }
+  }
+}
+
+/**
+  * @brief  Release the oldest full row buffer and resume the codec output
+  * @param  None
+  * @retval None
+  */
+static void Pipe_ReleaseRow(void)
+{
+  PipeOutRead = (PipeOutRead + 1U) % JPEG_PIPE_OUT_BUFFERS;
+  PipeOutCount--;
+  PipeRowConvert++;
+
+  if(PipeOutPaused != 0U)
+  {
+    PipeOutPaused = 0U;
+    HAL_JPEG_ConfigOutputBuffer(&hjpeg_pipe, PipeRows[PipeOutWrite], PipeRowSize);
+    HAL_JPEG_Resume(&hjpeg_pipe, JPEG_PAUSE_RESUME_OUTPUT);
+  }
+}
+
+/**
+  * @brief  End the decoding once the codec is done and every row is drawn
+  * @param  None
+  * @retval None
+  */
+static void Pipe_CheckEnd(void)
+{
+  if((PipeState == JPEG_PIPE_STATE_BUSY) && (PipeDecodeDone != 0U) &&
+     (PipeOutCount == 0U) && (PipeDma2dBusy == 0U))
+  {
+    Pipe_FlushInput();
+    PipeState = JPEG_PIPE_STATE_READY;
+    JPEG_Pipe_DecodeCpltCallback();
+  }
+}
+
+/**
+  * @brief  Stop the decoding in progress on error
+  * @param  None
+  * @retval None
+  */
+static void Pipe_Fail(void)
+{
+  if(PipeState == JPEG_PIPE_STATE_BUSY)
+  {
+    PipeState = JPEG_PIPE_STATE_ERROR;
+    HAL_JPEG_Abort(&hjpeg_pipe);
+    if(PipeDma2dBusy != 0U)
+    {
+      HAL_DMA2D_Abort(&hdma2d_pipe);
+      PipeDma2dBusy = 0U;
+    }
+    Pipe_FlushInput();
+    JPEG_Pipe_ErrorCallback();
+  }
+}
+
+/**
+  * @brief  DMA2D conversion complete: draw the next row
+  * @param  hdma2d: DMA2D handle
+  * @retval None
+  */
+static void Pipe_ConvertCplt(DMA2D_HandleTypeDef *hdma2d)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hdma2d);
+
+  PipeDma2dBusy = 0U;
+  if(PipeState == JPEG_PIPE_STATE_BUSY)
+  {
+    Pipe_ReleaseRow();
+    Pipe_Convert();
+    Pipe_CheckEnd();
+  }
+}
+
+/**
+  * @brief  DMA2D conversion error
+  * @param  hdma2d: DMA2D handle
+  * @retval None
+  */
+static void Pipe_ConvertError(DMA2D_HandleTypeDef *hdma2d)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hdma2d);
+
+  PipeDma2dBusy = 0U;
+  Pipe_Fail();
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,113 @@
+/**
+  ******************************************************************************
+  * @file    jpeg_pipe.h
+  * @author  MCD Application Team
+  * @brief   Header for jpeg_pipe module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _JPEG_PIPE_H__
+#define _JPEG_PIPE_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+  JPEG_PIPE_STATE_RESET = 0U,  /* Not initialized                 */
+  JPEG_PIPE_STATE_READY = 1U,  /* Initialized, no decoding        */
+  JPEG_PIPE_STATE_BUSY  = 2U,  /* Decoding in progress            */
+  JPEG_PIPE_STATE_ERROR = 3U   /* Last decoding failed or aborted */
+} JPEG_Pipe_StateTypeDef;
+
+typedef struct
+{
+  uint32_t Address;    /* Framebuffer address of pixel (0,0)             */
+  uint32_t ColorMode;  /* DMA2D_OUTPUT_RGB565 or DMA2D_OUTPUT_ARGB8888    */
+  uint32_t Pitch;      /* Framebuffer line length, in pixels             */
+  uint32_t Height;     /* Framebuffer height, lines below are not drawn  */
+  uint32_t X;          /* Column of the top left corner of the image     */
+  uint32_t Y;          /* Line of the top left corner of the image       */
+} JPEG_Pipe_OutputTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Widest image decoded, in pixels. Override in main.h. */
+#if !defined(JPEG_PIPE_MAX_WIDTH)
+#define JPEG_PIPE_MAX_WIDTH      800U
+#endif
+/* MCU row buffers between the codec and the DMA2D (at least 2) */
+#if !defined(JPEG_PIPE_OUT_BUFFERS)
+#define JPEG_PIPE_OUT_BUFFERS    2U
+#endif
+/* Compressed chunks queued ahead of the codec */
+#if !defined(JPEG_PIPE_IN_BUFFERS)
+#define JPEG_PIPE_IN_BUFFERS     4U
+#endif
+/* Preemption priority shared by the JPEG, MDMA and DMA2D interrupts */
+#if !defined(JPEG_PIPE_IRQ_PRIORITY)
+#define JPEG_PIPE_IRQ_PRIORITY   0x07U
+#endif
+
+/* Size of one MCU row buffer: 24 bytes per column covers 4:4:4, 4:2:2 and 4:2:0 */
+#define JPEG_PIPE_ROW_SIZE       ((((JPEG_PIPE_MAX_WIDTH) + 15U) & ~15U) * 24U)
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef      JPEG_Pipe_Init(void);
+HAL_StatusTypeDef      JPEG_Pipe_PushInput(uint8_t *pData, uint32_t Size);
+uint32_t               JPEG_Pipe_GetFreeInputCount(void);
+HAL_StatusTypeDef      JPEG_Pipe_Start(const JPEG_Pipe_OutputTypeDef *pOutput);
+HAL_StatusTypeDef      JPEG_Pipe_Abort(void);
+JPEG_Pipe_StateTypeDef JPEG_Pipe_GetState(void);
+HAL_StatusTypeDef      JPEG_Pipe_WaitForDecode(uint32_t Timeout);
+
+void JPEG_Pipe_JPEG_IRQHandler(void);
+void JPEG_Pipe_MDMA_IRQHandler(void);
+void JPEG_Pipe_DMA2D_IRQHandler(void);
+
+void JPEG_Pipe_InfoReadyCallback(JPEG_ConfTypeDef *pInfo, JPEG_Pipe_OutputTypeDef *pOutput);
+void JPEG_Pipe_InputReleasedCallback(uint8_t *pData);
+void JPEG_Pipe_DecodeCpltCallback(void);
+void JPEG_Pipe_ErrorCallback(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _JPEG_PIPE_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
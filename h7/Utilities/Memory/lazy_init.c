@@ -0,0 +1,363 @@
+/**
+  ******************************************************************************
+  * @file    lazy_init.c
+  * @author  MCD Application Team
+  * @brief   Deferred zeroing of the .lazy_bss sections, by DMA or on first use
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- put the large zero-initialized buffers, the ones that need not be zero
+   before main() or that are in slow memory, in .lazy_bss :
+      static uint8_t FrameBuffer[480 * 272 * 2] LAZY_BSS;
+   The startup code zeroes .bss only, with four word store multiples, and
+   the linker script lists .lazy_bss in its lazy table (__lazy_table_start__,
+   {start, end} words, 32-byte aligned). Data in .noinit (NO_INIT) is never
+   touched and survives a reset.
+
+2- once the clocks run at full speed call LAZY_Init_Start() with a memory
+   to memory channel: the sections are zeroed in the background, 64 KBytes
+   per transfer, while the application brings its I/O up. The channel is
+   initialized by the application :
+      (++) MDMA on STM32H7: MDMA_REQUEST_SW, MDMA_BLOCK_TRANSFER,
+           MDMA_SRC_INC_DISABLE, MDMA_DEST_INC_WORD, word data sizes, its
+           interrupt enabled and calling HAL_MDMA_IRQHandler().
+      (++) DMA2 on STM32F7: DMA_MEMORY_TO_MEMORY, DMA_PINC_DISABLE,
+           DMA_MINC_ENABLE, word alignments, FIFO enabled, its interrupt
+           enabled and calling HAL_DMA_IRQHandler().
+   The module takes over the transfer callbacks of the channel until all
+   the sections are zero. With NULL the sections are zeroed by the CPU
+   before LAZY_Init_Start() returns.
+
+3- before the first use of a lazy buffer call LAZY_Init_Wait() with its
+   address: it returns at once when its section is already zero, waits for
+   the DMA when the section is in progress, and zeroes the section with the
+   CPU when LAZY_Init_Start() was not called or the DMA failed. NULL waits
+   for every section.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "lazy_init.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define LAZY_INIT_IDLE            0xFFFFFFFFU
+
+#if (LAZY_INIT_MAX_REGIONS > 32U)
+#error "LAZY_INIT_MAX_REGIONS must not exceed 32"
+#endif
+
+/* Bytes zeroed per DMA transfer: MDMA block length, DMA NDTR of words */
+#if defined(HAL_MDMA_MODULE_ENABLED)
+#define LAZY_INIT_CHUNK           65536U
+#else
+#define LAZY_INIT_CHUNK           (65535U * 4U)
+#endif
+
+/* Private macro -------------------------------------------------------------*/
+#define LAZY_INIT_START(__R__)    (LAZY_Table[2U * (__R__)])
+#define LAZY_INIT_END(__R__)      (LAZY_Table[(2U * (__R__)) + 1U])
+
+/* Private variables ---------------------------------------------------------*/
+/* Lazy table emitted by the linker script, weak so that it resolves to 0
+   with linker scripts that do not provide it */
+extern const uint32_t __lazy_table_start__[] __attribute__((weak));
+extern const uint32_t __lazy_table_end__[] __attribute__((weak));
+
+/* Fixed DMA source */
+static const uint32_t LAZY_Zero = 0U;
+
+static const uint32_t *LAZY_Table = NULL;
+static uint32_t       LAZY_Count = 0U;
+static volatile uint32_t LAZY_Done = 0U;             /* One bit per section  */
+static volatile uint32_t LAZY_Current = LAZY_INIT_IDLE;  /* Section on the DMA */
+static volatile uint32_t LAZY_Offset = 0U;           /* Bytes done in it     */
+static uint32_t       LAZY_Chunk = 0U;
+#if defined(HAL_MDMA_MODULE_ENABLED) || defined(HAL_DMA_MODULE_ENABLED)
+static LAZY_INIT_DMA_HandleTypeDef *LAZY_hdma = NULL;
+#endif
+
+/* Private function prototypes -----------------------------------------------*/
+static void     LAZY_Init_Table(void);
+static void     LAZY_Init_Zero(uint32_t Region);
+#if defined(HAL_MDMA_MODULE_ENABLED) || defined(HAL_DMA_MODULE_ENABLED)
+static void     LAZY_Init_Next(void);
+static void     LAZY_Init_XferCplt(LAZY_INIT_DMA_HandleTypeDef *hdma);
+static void     LAZY_Init_XferError(LAZY_INIT_DMA_HandleTypeDef *hdma);
+#endif
+
+/* Functions Definition ------------------------------------------------------*/
+/**
+  * @brief  Start zeroing the lazy sections
+  * @param  hdma: memory to memory channel, see the NOTES, NULL to zero the
+  *         sections with the CPU before returning
+  * @retval HAL_BUSY when already started, HAL_ERROR when the table is too large
+  */
+HAL_StatusTypeDef LAZY_Init_Start(LAZY_INIT_DMA_HandleTypeDef *hdma)
+{
+  uint32_t region;
+
+  if(LAZY_Current != LAZY_INIT_IDLE)
+  {
+    return HAL_BUSY;
+  }
+
+  LAZY_Init_Table();
+  if(LAZY_Count > LAZY_INIT_MAX_REGIONS)
+  {
+    return HAL_ERROR;
+  }
+
+#if defined(HAL_MDMA_MODULE_ENABLED) || defined(HAL_DMA_MODULE_ENABLED)
+  if(hdma != NULL)
+  {
+    LAZY_hdma = hdma;
+    hdma->XferCpltCallback  = LAZY_Init_XferCplt;
+    hdma->XferErrorCallback = LAZY_Init_XferError;
+    LAZY_Init_Next();
+    return HAL_OK;
+  }
+#else
+  (void)hdma;
+#endif
+
+  for(region = 0U; region < LAZY_Count; region++)
+  {
+    LAZY_Init_Zero(region);
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Make sure the section holding an address is zero
+  * @param  pAddress: address in a lazy section, NULL for all the sections
+  * @param  Timeout: longest wait for the DMA, in ms
+  * @retval HAL_TIMEOUT when the DMA did not reach the section in time
+  */
+HAL_StatusTypeDef LAZY_Init_Wait(const void *pAddress, uint32_t Timeout)
+{
+  uint32_t address = (uint32_t)pAddress;
+  uint32_t tickstart = HAL_GetTick();
+  uint32_t mask = 0U;
+  uint32_t region;
+
+  LAZY_Init_Table();
+  for(region = 0U; (region < LAZY_Count) && (region < LAZY_INIT_MAX_REGIONS); region++)
+  {
+    if((pAddress == NULL) || ((address >= LAZY_INIT_START(region)) && (address < LAZY_INIT_END(region))))
+    {
+      mask |= (1UL << region);
+    }
+  }
+
+  while((LAZY_Done & mask) != mask)
+  {
+    if(LAZY_Current == LAZY_INIT_IDLE)
+    {
+      /* No DMA at work: first use, zero the sections now */
+      for(region = 0U; region < LAZY_Count; region++)
+      {
+        if(((mask & (1UL << region)) != 0U) && ((LAZY_Done & (1UL << region)) == 0U))
+        {
+          LAZY_Init_Zero(region);
+        }
+      }
+    }
+    else if((HAL_GetTick() - tickstart) > Timeout)
+    {
+      return HAL_TIMEOUT;
+    }
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Bytes of the lazy sections not zeroed yet
+  * @param  None
+  * @retval Size in bytes
+  */
+uint32_t LAZY_Init_GetPending(void)
+{
+  uint32_t pending = 0U;
+  uint32_t region;
+  uint32_t primask = __get_PRIMASK();
+
+  LAZY_Init_Table();
+  __disable_irq();
+  for(region = 0U; (region < LAZY_Count) && (region < LAZY_INIT_MAX_REGIONS); region++)
+  {
+    if((LAZY_Done & (1UL << region)) == 0U)
+    {
+      pending += LAZY_INIT_END(region) - LAZY_INIT_START(region);
+      if(region == LAZY_Current)
+      {
+        pending -= LAZY_Offset;
+      }
+    }
+  }
+  __set_PRIMASK(primask);
+
+  return pending;
+}
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Locate the linker script lazy table
+  * @param  None
+  * @retval None
+  */
+static void LAZY_Init_Table(void)
+{
+  if(LAZY_Table == NULL)
+  {
+    LAZY_Table = __lazy_table_start__;
+    LAZY_Count = (uint32_t)(__lazy_table_end__ - __lazy_table_start__) / 2U;
+  }
+}
+
+/**
+  * @brief  Zero a section with the CPU, eight words per iteration
+  * @param  Region: section index in the lazy table
+  * @retval None
+  */
+static void LAZY_Init_Zero(uint32_t Region)
+{
+  uint64_t *dst = (uint64_t *)LAZY_INIT_START(Region);
+  uint64_t *end = (uint64_t *)LAZY_INIT_END(Region);
+
+  /* The sections are 32-byte aligned at both ends */
+  while(dst < end)
+  {
+    dst[0] = 0U;
+    dst[1] = 0U;
+    dst[2] = 0U;
+    dst[3] = 0U;
+    dst += 4U;
+  }
+
+  if(Region < LAZY_INIT_MAX_REGIONS)
+  {
+    LAZY_Done |= (1UL << Region);
+  }
+}
+
+#if defined(HAL_MDMA_MODULE_ENABLED) || defined(HAL_DMA_MODULE_ENABLED)
+/**
+  * @brief  Start the next DMA transfer, or go idle when every section is zero
+  * @param  None
+  * @retval None
+  */
+static void LAZY_Init_Next(void)
+{
+  uint32_t region = LAZY_Current;
+  uint32_t size;
+  HAL_StatusTypeDef status;
+
+  if((region == LAZY_INIT_IDLE) || (LAZY_Offset >= (LAZY_INIT_END(region) - LAZY_INIT_START(region))))
+  {
+    /* Next section not zeroed by the CPU meanwhile */
+    for(region = 0U; region < LAZY_Count; region++)
+    {
+      if(((LAZY_Done & (1UL << region)) == 0U) && (LAZY_INIT_END(region) > LAZY_INIT_START(region)))
+      {
+        break;
+      }
+      LAZY_Done |= (1UL << region);
+    }
+    if(region >= LAZY_Count)
+    {
+      LAZY_Current = LAZY_INIT_IDLE;
+      return;
+    }
+    LAZY_Offset = 0U;
+  }
+
+  size = LAZY_INIT_END(region) - LAZY_INIT_START(region) - LAZY_Offset;
+  LAZY_Chunk = (size < LAZY_INIT_CHUNK) ? size : LAZY_INIT_CHUNK;
+  LAZY_Current = region;
+
+#if defined(HAL_MDMA_MODULE_ENABLED)
+  status = HAL_MDMA_Start_IT(LAZY_hdma, (uint32_t)&LAZY_Zero, LAZY_INIT_START(region) + LAZY_Offset, LAZY_Chunk, 1U);
+#else
+  status = HAL_DMA_Start_IT(LAZY_hdma, (uint32_t)&LAZY_Zero, LAZY_INIT_START(region) + LAZY_Offset, LAZY_Chunk / 4U);
+#endif
+  if(status != HAL_OK)
+  {
+    /* LAZY_Init_Wait() finishes with the CPU */
+    LAZY_Current = LAZY_INIT_IDLE;
+  }
+}
+
+/**
+  * @brief  DMA transfer complete: account for the chunk and chain the next one
+  * @param  hdma: lazy init channel
+  * @retval None
+  */
+static void LAZY_Init_XferCplt(LAZY_INIT_DMA_HandleTypeDef *hdma)
+{
+  uint32_t region = LAZY_Current;
+
+  (void)hdma;
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  /* Drop any line speculatively loaded while the DMA was writing */
+  if((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    SCB_InvalidateDCache_by_Addr((uint32_t *)(LAZY_INIT_START(region) + LAZY_Offset), (int32_t)LAZY_Chunk);
+  }
+#endif
+
+  LAZY_Offset += LAZY_Chunk;
+  if(LAZY_Offset >= (LAZY_INIT_END(region) - LAZY_INIT_START(region)))
+  {
+    LAZY_Done |= (1UL << region);
+  }
+  LAZY_Init_Next();
+}
+
+/**
+  * @brief  DMA transfer error: leave the rest to LAZY_Init_Wait()
+  * @param  hdma: lazy init channel
+  * @retval None
+  */
+static void LAZY_Init_XferError(LAZY_INIT_DMA_HandleTypeDef *hdma)
+{
+  (void)hdma;
+  LAZY_Current = LAZY_INIT_IDLE;
+}
+#endif /* HAL_MDMA_MODULE_ENABLED || HAL_DMA_MODULE_ENABLED */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
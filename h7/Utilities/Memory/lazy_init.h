@@ -0,0 +1,83 @@
+/**
+  ******************************************************************************
+  * @file    lazy_init.h
+  * @author  MCD Application Team
+  * @brief   Header for lazy_init module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _LAZY_INIT_H__
+#define _LAZY_INIT_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported constants --------------------------------------------------------*/
+/* Largest number of {start, end} entries in the linker script lazy table.
+   Override in main.h. */
+#if !defined(LAZY_INIT_MAX_REGIONS)
+#define LAZY_INIT_MAX_REGIONS     8U
+#endif
+
+#if defined(HAL_MDMA_MODULE_ENABLED)
+#define LAZY_INIT_DMA_HandleTypeDef   MDMA_HandleTypeDef
+#elif defined(HAL_DMA_MODULE_ENABLED)
+#define LAZY_INIT_DMA_HandleTypeDef   DMA_HandleTypeDef
+#else
+#define LAZY_INIT_DMA_HandleTypeDef   void
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Place a zero-initialized variable in the deferred section */
+#define LAZY_BSS                  __attribute__((section(".lazy_bss")))
+
+/* Place a variable in the section the startup never touches */
+#define NO_INIT                   __attribute__((section(".noinit")))
+
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef LAZY_Init_Start(LAZY_INIT_DMA_HandleTypeDef *hdma);
+HAL_StatusTypeDef LAZY_Init_Wait(const void *pAddress, uint32_t Timeout);
+uint32_t          LAZY_Init_GetPending(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _LAZY_INIT_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,637 @@
+/**
+  ******************************************************************************
+  * @file    mem_fast.h
+  * @author  MCD Application Team
+  * @brief   Copy and fill kernels tuned per Cortex-M core
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- call MEM_Fast_Copy(), MEM_Fast_Move() and MEM_Fast_Set() in place of
+   memcpy(), memmove() and memset() on the hot paths (USB MSC buffers,
+   display line copies...). The kernel is selected at compile time from
+   the core :
+   - Cortex-M0/M0+ : 16-byte load/store multiple bursts,
+   - Cortex-M3/M4  : 32-byte load/store multiple bursts,
+   - Cortex-M7     : 32-byte bursts of 64-bit LDRD/STRD on the AXI bus.
+   Short prologues align the destination, a source with another alignment
+   is read by aligned words merged with shifts, never by byte loops.
+
+2- to offload large copies, set MEM_FAST_USE_DMA to 1 in main.h, set up a
+   memory to memory DMA channel with word data size and incremented
+   addresses (an MDMA channel with software request on STM32H7) and give
+   it with MEM_Fast_SetDMA(). Copies of MEM_FAST_DMA_THRESHOLD bytes or
+   more then move their cache line aligned middle part by DMA, with the
+   D-cache maintenance done here, and the head and tail by the CPU. The
+   call still returns once the copy is complete. Copies the DMA cannot
+   reach (source and destination with different word alignment, busy
+   channel) fall back to the CPU.
+
+3- MEM_Fast_Bench() compares these kernels with the C library on a
+   scratch buffer and returns the cycle counts, to be checked on each
+   family and compiler.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "mem_fast.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Words moved per burst */
+#if (__CORTEX_M >= 3U)
+#define MEM_FAST_BURST_WORDS      8U
+#else
+#define MEM_FAST_BURST_WORDS      4U
+#endif
+#define MEM_FAST_BURST_SIZE       (MEM_FAST_BURST_WORDS * 4U)
+
+/* Below this size the byte loop is shorter than the prologues */
+#define MEM_FAST_SMALL            16U
+
+/* DMA chunks, in bytes */
+#if defined(HAL_MDMA_MODULE_ENABLED)
+#define MEM_FAST_DMA_CHUNK        65536U
+#else
+#define MEM_FAST_DMA_CHUNK        (65535U * 4U)
+#endif
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+#if (MEM_FAST_USE_DMA == 1U)
+static MEM_FAST_DMA_HandleTypeDef *MEM_Fast_hdma = NULL;
+#endif
+
+static const uint32_t MEM_Fast_BenchSizes[MEM_FAST_BENCH_SIZES] = {16U, 64U, 256U, 1024U, 4096U, 16384U};
+
+/* Private function prototypes -----------------------------------------------*/
+static void     MEM_Fast_CopyForward(uint8_t *pDst, const uint8_t *pSrc, uint32_t Size);
+static void     MEM_Fast_CopyBackward(uint8_t *pDst, const uint8_t *pSrc, uint32_t Size);
+#if (MEM_FAST_USE_DMA == 1U)
+static uint32_t MEM_Fast_Offload(uint8_t *pDst, const uint8_t *pSrc, uint32_t Size);
+#endif
+static void     MEM_Fast_TimerStart(void);
+static uint32_t MEM_Fast_Timestamp(void);
+static uint32_t MEM_Fast_Elapsed(uint32_t From, uint32_t To);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Copy a memory area, the areas must not overlap
+  * @param  pDst: destination
+  * @param  pSrc: source
+  * @param  Size: number of bytes
+  * @retval pDst
+  */
+void *MEM_Fast_Copy(void *pDst, const void *pSrc, uint32_t Size)
+{
+#if (MEM_FAST_USE_DMA == 1U)
+  if((Size >= MEM_FAST_DMA_THRESHOLD) && (MEM_Fast_Offload((uint8_t *)pDst, (const uint8_t *)pSrc, Size) != 0U))
+  {
+    return pDst;
+  }
+#endif
+
+  MEM_Fast_CopyForward((uint8_t *)pDst, (const uint8_t *)pSrc, Size);
+
+  return pDst;
+}
+
+/**
+  * @brief  Copy a memory area, the areas may overlap
+  * @param  pDst: destination
+  * @param  pSrc: source
+  * @param  Size: number of bytes
+  * @retval pDst
+  */
+void *MEM_Fast_Move(void *pDst, const void *pSrc, uint32_t Size)
+{
+  uint32_t dst = (uint32_t)pDst;
+  uint32_t src = (uint32_t)pSrc;
+
+  /* Forward unless the destination starts inside the source */
+  if((dst <= src) || (dst >= (src + Size)))
+  {
+    MEM_Fast_CopyForward((uint8_t *)pDst, (const uint8_t *)pSrc, Size);
+  }
+  else
+  {
+    MEM_Fast_CopyBackward((uint8_t *)pDst, (const uint8_t *)pSrc, Size);
+  }
+
+  return pDst;
+}
+
+/**
+  * @brief  Fill a memory area
+  * @param  pDst: destination
+  * @param  Value: byte written
+  * @param  Size: number of bytes
+  * @retval pDst
+  */
+void *MEM_Fast_Set(void *pDst, uint8_t Value, uint32_t Size)
+{
+  uint8_t  *dst = (uint8_t *)pDst;
+  uint32_t pattern = (uint32_t)Value * 0x01010101U;
+  uint32_t *word;
+
+  if(Size >= MEM_FAST_SMALL)
+  {
+    /* Align the destination on a word */
+    while(((uint32_t)dst & 3U) != 0U)
+    {
+      *dst++ = Value;
+      Size--;
+    }
+
+#if (__CORTEX_M == 7U)
+    /* Then on a double word for STRD */
+    if(((uint32_t)dst & 4U) != 0U)
+    {
+      *(uint32_t *)dst = pattern;
+      dst += 4U;
+      Size -= 4U;
+    }
+    {
+      uint64_t pattern64 = ((uint64_t)pattern << 32U) | pattern;
+      uint64_t *dword = (uint64_t *)dst;
+
+      while(Size >= MEM_FAST_BURST_SIZE)
+      {
+        dword[0] = pattern64;
+        dword[1] = pattern64;
+        dword[2] = pattern64;
+        dword[3] = pattern64;
+        dword += 4U;
+        Size -= MEM_FAST_BURST_SIZE;
+      }
+      dst = (uint8_t *)dword;
+    }
+#else
+    word = (uint32_t *)dst;
+    while(Size >= MEM_FAST_BURST_SIZE)
+    {
+      word[0] = pattern;
+      word[1] = pattern;
+      word[2] = pattern;
+      word[3] = pattern;
+#if (MEM_FAST_BURST_WORDS == 8U)
+      word[4] = pattern;
+      word[5] = pattern;
+      word[6] = pattern;
+      word[7] = pattern;
+#endif
+      word += MEM_FAST_BURST_WORDS;
+      Size -= MEM_FAST_BURST_SIZE;
+    }
+    dst = (uint8_t *)word;
+#endif
+
+    word = (uint32_t *)dst;
+    while(Size >= 4U)
+    {
+      *word++ = pattern;
+      Size -= 4U;
+    }
+    dst = (uint8_t *)word;
+  }
+
+  while(Size != 0U)
+  {
+    *dst++ = Value;
+    Size--;
+  }
+
+  return pDst;
+}
+
+#if (MEM_FAST_USE_DMA == 1U)
+/**
+  * @brief  Give the DMA channel used for the large copies
+  * @param  hdma: memory to memory channel, initialized, NULL to stop offloading
+  * @retval None
+  */
+void MEM_Fast_SetDMA(MEM_FAST_DMA_HandleTypeDef *hdma)
+{
+  MEM_Fast_hdma = hdma;
+}
+#endif
+
+/**
+  * @brief  Measure the kernels against the C library
+  * @note   Each measure is the shortest of three runs. On Cortex-M0/M0+ the
+  *         SysTick is the time base: sizes taking more than one tick period
+  *         are not measured.
+  * @param  pBuffer: scratch area, word aligned, overwritten
+  * @param  Size: scratch area size, twice the largest size measured plus 4
+  * @param  pResults: MEM_FAST_BENCH_SIZES * 2 results
+  * @retval Number of results written
+  */
+uint32_t MEM_Fast_Bench(uint8_t *pBuffer, uint32_t Size, MEM_Fast_BenchTypeDef *pResults)
+{
+  MEM_Fast_BenchTypeDef *result;
+  uint8_t               *src;
+  uint8_t               *dst;
+  uint32_t              count = 0U;
+  uint32_t              size;
+  uint32_t              offset;
+  uint32_t              run;
+  uint32_t              start;
+  uint32_t              cycles[4];
+  uint32_t              i;
+  uint32_t              k;
+
+  if((pBuffer == NULL) || (pResults == NULL))
+  {
+    return 0U;
+  }
+
+  MEM_Fast_TimerStart();
+
+  for(i = 0U; i < MEM_FAST_BENCH_SIZES; i++)
+  {
+    size = MEM_Fast_BenchSizes[i];
+    if(((2U * size) + 4U) > Size)
+    {
+      break;
+    }
+#if (__CORTEX_M < 3U)
+    /* Byte copy at 4 cycles per byte must fit in one SysTick period */
+    if((size * 4U) > (SysTick->LOAD + 1U))
+    {
+      break;
+    }
+#endif
+
+    for(offset = 0U; offset < 2U; offset++)
+    {
+      src = pBuffer + offset;
+      dst = pBuffer + size + 4U;
+
+      for(k = 0U; k < 4U; k++)
+      {
+        cycles[k] = 0xFFFFFFFFU;
+      }
+
+      for(run = 0U; run < 3U; run++)
+      {
+        start = MEM_Fast_Timestamp();
+        (void)memcpy(dst, src, size);
+        k = MEM_Fast_Elapsed(start, MEM_Fast_Timestamp());
+        cycles[0] = (k < cycles[0]) ? k : cycles[0];
+
+        start = MEM_Fast_Timestamp();
+        (void)MEM_Fast_Copy(dst, src, size);
+        k = MEM_Fast_Elapsed(start, MEM_Fast_Timestamp());
+        cycles[1] = (k < cycles[1]) ? k : cycles[1];
+
+        start = MEM_Fast_Timestamp();
+        (void)memset(dst, (int)run, size);
+        k = MEM_Fast_Elapsed(start, MEM_Fast_Timestamp());
+        cycles[2] = (k < cycles[2]) ? k : cycles[2];
+
+        start = MEM_Fast_Timestamp();
+        (void)MEM_Fast_Set(dst, (uint8_t)run, size);
+        k = MEM_Fast_Elapsed(start, MEM_Fast_Timestamp());
+        cycles[3] = (k < cycles[3]) ? k : cycles[3];
+      }
+
+      result = &pResults[count++];
+      result->Size     = size;
+      result->Offset   = offset;
+      result->LibCopy  = cycles[0];
+      result->FastCopy = cycles[1];
+      result->LibSet   = cycles[2];
+      result->FastSet  = cycles[3];
+    }
+  }
+
+  return count;
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Copy a memory area upwards
+  * @param  pDst: destination
+  * @param  pSrc: source
+  * @param  Size: number of bytes
+  * @retval None
+  */
+static void MEM_Fast_CopyForward(uint8_t *pDst, const uint8_t *pSrc, uint32_t Size)
+{
+  const uint32_t *src;
+  uint32_t       *dst;
+  uint32_t       offset;
+  uint32_t       current;
+  uint32_t       next;
+
+  if(Size >= MEM_FAST_SMALL)
+  {
+    /* Align the destination on a word */
+    while(((uint32_t)pDst & 3U) != 0U)
+    {
+      *pDst++ = *pSrc++;
+      Size--;
+    }
+
+    offset = (uint32_t)pSrc & 3U;
+    if(offset == 0U)
+    {
+#if (__CORTEX_M == 7U)
+      /* Both on the same double word alignment: 64-bit bursts */
+      if((((uint32_t)pDst ^ (uint32_t)pSrc) & 4U) == 0U)
+      {
+        const uint64_t *src64;
+        uint64_t       *dst64;
+        uint64_t       a, b, c, d;
+
+        if(((uint32_t)pDst & 4U) != 0U)
+        {
+          *(uint32_t *)pDst = *(const uint32_t *)pSrc;
+          pDst += 4U;
+          pSrc += 4U;
+          Size -= 4U;
+        }
+
+        src64 = (const uint64_t *)pSrc;
+        dst64 = (uint64_t *)pDst;
+        while(Size >= MEM_FAST_BURST_SIZE)
+        {
+          a = src64[0];
+          b = src64[1];
+          c = src64[2];
+          d = src64[3];
+          dst64[0] = a;
+          dst64[1] = b;
+          dst64[2] = c;
+          dst64[3] = d;
+          src64 += 4U;
+          dst64 += 4U;
+          Size -= MEM_FAST_BURST_SIZE;
+        }
+        pSrc = (const uint8_t *)src64;
+        pDst = (uint8_t *)dst64;
+      }
+#endif
+
+      /* Load all the burst words before storing them: LDM/STM */
+      src = (const uint32_t *)pSrc;
+      dst = (uint32_t *)pDst;
+      while(Size >= MEM_FAST_BURST_SIZE)
+      {
+        uint32_t w0 = src[0];
+        uint32_t w1 = src[1];
+        uint32_t w2 = src[2];
+        uint32_t w3 = src[3];
+#if (MEM_FAST_BURST_WORDS == 8U)
+        uint32_t w4 = src[4];
+        uint32_t w5 = src[5];
+        uint32_t w6 = src[6];
+        uint32_t w7 = src[7];
+#endif
+        dst[0] = w0;
+        dst[1] = w1;
+        dst[2] = w2;
+        dst[3] = w3;
+#if (MEM_FAST_BURST_WORDS == 8U)
+        dst[4] = w4;
+        dst[5] = w5;
+        dst[6] = w6;
+        dst[7] = w7;
+#endif
+        src += MEM_FAST_BURST_WORDS;
+        dst += MEM_FAST_BURST_WORDS;
+        Size -= MEM_FAST_BURST_SIZE;
+      }
+      while(Size >= 4U)
+      {
+        *dst++ = *src++;
+        Size -= 4U;
+      }
+      pSrc = (const uint8_t *)src;
+      pDst = (uint8_t *)dst;
+    }
+    else
+    {
+      /* Aligned source words merged with shifts, little endian. The last
+         word read may extend past the source end, never past its word. */
+      src = (const uint32_t *)(pSrc - offset);
+      dst = (uint32_t *)pDst;
+      offset *= 8U;
+      current = *src++;
+      while(Size >= 4U)
+      {
+        next = *src++;
+        *dst++ = (current >> offset) | (next << (32U - offset));
+        current = next;
+        Size -= 4U;
+      }
+      pSrc = (const uint8_t *)(src - 1U) + (offset / 8U);
+      pDst = (uint8_t *)dst;
+    }
+  }
+
+  while(Size != 0U)
+  {
+    *pDst++ = *pSrc++;
+    Size--;
+  }
+}
+
+/**
+  * @brief  Copy a memory area downwards, for a destination above the source
+  * @param  pDst: destination
+  * @param  pSrc: source
+  * @param  Size: number of bytes
+  * @retval None
+  */
+static void MEM_Fast_CopyBackward(uint8_t *pDst, const uint8_t *pSrc, uint32_t Size)
+{
+  const uint32_t *src;
+  uint32_t       *dst;
+
+  pDst += Size;
+  pSrc += Size;
+
+  if((Size >= MEM_FAST_SMALL) && ((((uint32_t)pDst ^ (uint32_t)pSrc) & 3U) == 0U))
+  {
+    while(((uint32_t)pDst & 3U) != 0U)
+    {
+      *--pDst = *--pSrc;
+      Size--;
+    }
+
+    src = (const uint32_t *)pSrc;
+    dst = (uint32_t *)pDst;
+    while(Size >= 4U)
+    {
+      *--dst = *--src;
+      Size -= 4U;
+    }
+    pSrc = (const uint8_t *)src;
+    pDst = (uint8_t *)dst;
+  }
+
+  while(Size != 0U)
+  {
+    *--pDst = *--pSrc;
+    Size--;
+  }
+}
+
+#if (MEM_FAST_USE_DMA == 1U)
+/**
+  * @brief  Copy the cache line aligned middle of an area by DMA
+  * @param  pDst: destination
+  * @param  pSrc: source
+  * @param  Size: number of bytes
+  * @retval 1 when the copy is done, 0 when the CPU must do it
+  */
+static uint32_t MEM_Fast_Offload(uint8_t *pDst, const uint8_t *pSrc, uint32_t Size)
+{
+  MEM_FAST_DMA_HandleTypeDef *hdma = MEM_Fast_hdma;
+  uint32_t                   head;
+  uint32_t                   body;
+  uint32_t                   chunk;
+  uint32_t                   done;
+
+  if((hdma == NULL) || ((((uint32_t)pDst ^ (uint32_t)pSrc) & 3U) != 0U))
+  {
+    return 0U;
+  }
+#if defined(HAL_MDMA_MODULE_ENABLED)
+  if(hdma->State != HAL_MDMA_STATE_READY)
+#else
+  if((hdma->State != HAL_DMA_STATE_READY) || (hdma->Init.PeriphDataAlignment != DMA_PDATAALIGN_WORD))
+#endif
+  {
+    return 0U;
+  }
+
+  /* Destination body on whole cache lines, so that its maintenance does
+     not touch the bytes around it */
+  head = (32U - ((uint32_t)pDst & 0x1FU)) & 0x1FU;
+  body = (Size - head) & ~0x1FU;
+
+  MEM_Fast_CopyForward(pDst, pSrc, head);
+  pDst += head;
+  pSrc += head;
+  Size -= head;
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    SCB_CleanDCache_by_Addr((uint32_t *)((uint32_t)pSrc & ~0x1FU), (int32_t)(body + ((uint32_t)pSrc & 0x1FU)));
+    SCB_InvalidateDCache_by_Addr((uint32_t *)pDst, (int32_t)body);
+  }
+#endif
+
+  for(done = 0U; done < body; done += chunk)
+  {
+    chunk = ((body - done) > MEM_FAST_DMA_CHUNK) ? MEM_FAST_DMA_CHUNK : (body - done);
+#if defined(HAL_MDMA_MODULE_ENABLED)
+    if((HAL_MDMA_Start(hdma, (uint32_t)&pSrc[done], (uint32_t)&pDst[done], chunk, 1U) != HAL_OK) ||
+       (HAL_MDMA_PollForTransfer(hdma, HAL_MDMA_FULL_TRANSFER, MEM_FAST_DMA_TIMEOUT) != HAL_OK))
+#else
+    if((HAL_DMA_Start(hdma, (uint32_t)&pSrc[done], (uint32_t)&pDst[done], chunk / 4U) != HAL_OK) ||
+       (HAL_DMA_PollForTransfer(hdma, HAL_DMA_FULL_TRANSFER, MEM_FAST_DMA_TIMEOUT) != HAL_OK))
+#endif
+    {
+      /* Finish on the CPU from the chunk that failed */
+      break;
+    }
+  }
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    /* Lines fetched speculatively during the transfer */
+    SCB_InvalidateDCache_by_Addr((uint32_t *)pDst, (int32_t)body);
+  }
+#endif
+
+  MEM_Fast_CopyForward(&pDst[done], &pSrc[done], Size - done);
+
+  return 1U;
+}
+#endif /* MEM_FAST_USE_DMA */
+
+/**
+  * @brief  Start the cycle counter used by the benchmark
+  * @param  None
+  * @retval None
+  */
+static void MEM_Fast_TimerStart(void)
+{
+#if (__CORTEX_M >= 3U)
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#if (__CORTEX_M == 7U)
+  DWT->LAR = 0xC5ACCE55U;
+#endif
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+/**
+  * @brief  Read the cycle counter
+  * @param  None
+  * @retval DWT cycle count, or SysTick current value on Cortex-M0/M0+
+  */
+static uint32_t MEM_Fast_Timestamp(void)
+{
+#if (__CORTEX_M >= 3U)
+  return DWT->CYCCNT;
+#else
+  return SysTick->VAL;
+#endif
+}
+
+/**
+  * @brief  Cycles between two counter reads
+  * @param  From: first read
+  * @param  To: second read
+  * @retval Elapsed cycles
+  */
+static uint32_t MEM_Fast_Elapsed(uint32_t From, uint32_t To)
+{
+#if (__CORTEX_M >= 3U)
+  return To - From;
+#else
+  /* SysTick counts down from LOAD to 0 */
+  return (From >= To) ? (From - To) : (From + SysTick->LOAD + 1U - To);
+#endif
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,114 @@
+/**
+  ******************************************************************************
+  * @file    sdram_tune.h
+  * @author  MCD Application Team
+  * @brief   Header for sdram_tune module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _SDRAM_TUNE_H__
+#define _SDRAM_TUNE_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#if !defined(HAL_SDRAM_MODULE_ENABLED)
+#error "sdram_tune requires the SDRAM HAL driver"
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+/* SDRAM part, from its datasheet, at the CAS latency used */
+typedef struct
+{
+  uint32_t  MaxClock;        /* Highest clock, in Hz                                 */
+  uint32_t  tRCD;            /* Active to read/write, in ns                          */
+  uint32_t  tRP;             /* Precharge to active, in ns                           */
+  uint32_t  tWR;             /* Write recovery, in ns                                */
+  uint32_t  tRC;             /* Active to active, refresh to active, in ns           */
+  uint32_t  tRAS;            /* Active to precharge, in ns                           */
+  uint32_t  tXSR;            /* Exit self refresh to active, in ns                   */
+  uint32_t  tMRD;            /* Load mode register to active, in clock cycles        */
+  uint32_t  RefreshPeriod;   /* All rows refreshed within, in ms (usually 64)        */
+  uint32_t  RefreshRows;     /* Refresh commands per period (usually 4096 or 8192)   */
+} SDRAM_Tune_PartTypeDef;
+
+/* Controller settings derived for a part and an FMC kernel clock */
+typedef struct
+{
+  uint32_t                 SDClockPeriod;   /* For SDRAM_HandleTypeDef Init.SDClockPeriod */
+  uint32_t                 Clock;           /* SDRAM clock, in Hz                         */
+  FMC_SDRAM_TimingTypeDef  Timing;          /* For HAL_SDRAM_Init()                       */
+  uint32_t                 RefreshCount;    /* For HAL_SDRAM_ProgramRefreshRate()         */
+} SDRAM_Tune_ConfigTypeDef;
+
+/* Use of an SDRAM region, selecting its cache policy */
+typedef enum
+{
+  SDRAM_TUNE_FRAMEBUFFER = 0U,   /* Write-through, read allocate: the display controller
+                                    reads what the CPU wrote without cache maintenance     */
+  SDRAM_TUNE_HEAP        = 1U,   /* Write-back, read and write allocate: CPU data          */
+  SDRAM_TUNE_DMA         = 2U    /* Not cacheable: buffers shared with DMA masters         */
+} SDRAM_Tune_UseTypeDef;
+
+typedef struct
+{
+  uint32_t  Size;          /* Bytes per pass                                 */
+  uint32_t  WriteCycles;   /* CPU cycles to write, cache clean included      */
+  uint32_t  ReadCycles;    /* CPU cycles to read, from an invalidated cache  */
+  uint32_t  WriteMBps;     /* Write bandwidth, in MB/s                       */
+  uint32_t  ReadMBps;      /* Read bandwidth, in MB/s                        */
+  uint32_t  Errors;        /* Words read back different from written         */
+} SDRAM_Tune_BenchmarkTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef SDRAM_Tune_Compute(const SDRAM_Tune_PartTypeDef *pPart, uint32_t KernelClock,
+                                     SDRAM_Tune_ConfigTypeDef *pConfig);
+HAL_StatusTypeDef SDRAM_Tune_SetRefresh(SDRAM_HandleTypeDef *hsdram, const SDRAM_Tune_PartTypeDef *pPart,
+                                        uint32_t KernelClock);
+HAL_StatusTypeDef SDRAM_Tune_ConfigRegion(uint32_t Number, uint32_t BaseAddress, uint32_t Size,
+                                          SDRAM_Tune_UseTypeDef Use);
+HAL_StatusTypeDef SDRAM_Tune_Benchmark(uint32_t Address, uint32_t Size, SDRAM_Tune_BenchmarkTypeDef *pResult);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _SDRAM_TUNE_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
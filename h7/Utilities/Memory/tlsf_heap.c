@@ -0,0 +1,900 @@
+/**
+  ******************************************************************************
+  * @file    tlsf_heap.c
+  * @author  MCD Application Team
+  * @brief   Two-level segregated fit heap over several memory regions
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- in the linker script reserve the heap regions and export their bounds,
+   the rest of each D-domain RAM and a sized part of the DTCM :
+      __tlsf_d1_start = ALIGN(ADDR(.dma_d1) + SIZEOF(.dma_d1), 32);
+      __tlsf_d1_end   = ORIGIN(RAM_D1) + LENGTH(RAM_D1);
+      .tlsf_dtcm (NOLOAD) : { __tlsf_dtcm_start = .; . = . + _Tlsf_Dtcm_Size;
+                              __tlsf_dtcm_end = .; } >DTCMRAM
+   STM32H743ZI_FLASH.ld already does so. The SDRAM region is empty until
+   _Tlsf_Sdram_Size is set to the memory fitted on the board.
+
+2- call TLSF_Heap_Init() then register the regions, fastest first, with the
+   attributes of their memory, once the memory is up (SDRAM after the FMC
+   initialization, D2 SRAM after its clock is enabled) :
+      TLSF_Heap_AddRegion(TLSF_HEAP_LINKER_REGION(dtcm), TLSF_ATTR_FAST);
+      TLSF_Heap_AddRegion(TLSF_HEAP_LINKER_REGION(d1),
+                          TLSF_ATTR_DMA | TLSF_ATTR_CACHEABLE);
+      TLSF_Heap_AddRegion(TLSF_HEAP_LINKER_REGION(sdram),
+                          TLSF_ATTR_DMA | TLSF_ATTR_CACHEABLE | TLSF_ATTR_EXTERNAL);
+   Each region keeps its own control block, about 1.5 KBytes with the
+   default TLSF_HEAP_FL_MAX and TLSF_HEAP_SL_LOG2, at its start.
+
+3- get buffers with TLSF_Heap_Alloc(Size, Attributes) and give them back
+   with TLSF_Heap_Free(), from any context including interrupts. Both run in
+   a bounded number of steps whatever the heap state: two bitmap searches
+   with CLZ and a constant amount of list work, under PRIMASK. Buffers are
+   4-byte aligned, TLSF_Heap_AllocAligned() gives larger alignments.
+   A TLSF_ATTR_DMA request served by a TLSF_ATTR_CACHEABLE region starts on
+   a D-cache line and is rounded up to a whole number of lines, as with
+   Utilities/DMA/dma_pool.
+
+4- TLSF_Heap_GetStats() walks a region to report its free space, largest
+   block, fragmentation and the longest allocation and release measured
+   with the DWT cycle counter. It checks the block chain on the way and
+   returns HAL_ERROR when it is corrupted. The walk is not bounded, keep it
+   out of time critical code.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "tlsf_heap.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Block header. pPrevPhys is the last word of the previous block and only
+   valid while that block is free, the free list links are the first words
+   of the payload and only valid while this block is free: an allocated
+   block costs one word, Size. */
+typedef struct TLSF_Block
+{
+  struct TLSF_Block *pPrevPhys;   /* Previous block in memory, when free    */
+  uint32_t          Size;         /* Payload bytes | TLSF_BLOCK_xxx flags    */
+  struct TLSF_Block *pNextFree;   /* Free list links                         */
+  struct TLSF_Block *pPrevFree;
+} TLSF_BlockTypeDef;
+
+/* Private define ------------------------------------------------------------*/
+#define TLSF_ALIGN_LOG2        2U
+#define TLSF_ALIGN_SIZE        (1UL << TLSF_ALIGN_LOG2)
+#define TLSF_SL_COUNT          (1UL << TLSF_HEAP_SL_LOG2)
+#define TLSF_FL_SHIFT          (TLSF_HEAP_SL_LOG2 + TLSF_ALIGN_LOG2)
+#define TLSF_FL_COUNT          (TLSF_HEAP_FL_MAX - TLSF_FL_SHIFT + 1U)
+#define TLSF_SMALL_BLOCK       (1UL << TLSF_FL_SHIFT)
+
+#define TLSF_BLOCK_FREE        0x1U
+#define TLSF_BLOCK_PREV_FREE   0x2U
+#define TLSF_BLOCK_FLAGS       (TLSF_BLOCK_FREE | TLSF_BLOCK_PREV_FREE)
+
+#define TLSF_BLOCK_OVERHEAD    4U     /* Size word of an allocated block      */
+#define TLSF_BLOCK_START       8U     /* Payload offset from the header       */
+#define TLSF_BLOCK_SIZE_MIN    12U    /* Room for the links and pPrevPhys     */
+#define TLSF_BLOCK_SIZE_MAX    (1UL << TLSF_HEAP_FL_MAX)
+
+/* Smallest leading gap an aligned allocation can give back as a block */
+#define TLSF_GAP_MIN           16U
+
+#define TLSF_CACHE_LINE        32U
+
+#if ((TLSF_HEAP_SL_LOG2 < 1U) || (TLSF_HEAP_SL_LOG2 > 5U))
+#error "TLSF_HEAP_SL_LOG2 must be 1 to 5"
+#endif
+#if ((TLSF_FL_COUNT < 2U) || (TLSF_FL_COUNT > 31U) || (TLSF_HEAP_FL_MAX > 31U))
+#error "TLSF_HEAP_FL_MAX out of range"
+#endif
+
+/* Private macro -------------------------------------------------------------*/
+#define TLSF_ALIGN_UP(__X__, __A__)    (((__X__) + ((__A__) - 1U)) & ~((__A__) - 1U))
+#define TLSF_ALIGN_DOWN(__X__, __A__)  ((__X__) & ~((__A__) - 1U))
+
+#define TLSF_SIZE(__BLK__)             ((__BLK__)->Size & ~TLSF_BLOCK_FLAGS)
+#define TLSF_TO_PTR(__BLK__)           ((void *)((uint8_t *)(__BLK__) + TLSF_BLOCK_START))
+#define TLSF_FROM_PTR(__PTR__)         ((TLSF_BlockTypeDef *)((uint8_t *)(__PTR__) - TLSF_BLOCK_START))
+
+/* Private variables ---------------------------------------------------------*/
+typedef struct
+{
+  TLSF_BlockTypeDef Null;                                 /* Empty list end  */
+  uint32_t          FlBitmap;                             /* Non-empty rows  */
+  uint32_t          SlBitmap[TLSF_FL_COUNT];              /* Non-empty lists */
+  TLSF_BlockTypeDef *pHeads[TLSF_FL_COUNT][TLSF_SL_COUNT];
+} TLSF_ControlTypeDef;
+
+typedef struct
+{
+  TLSF_ControlTypeDef *pControl;
+  TLSF_BlockTypeDef   *pFirst;       /* First block, for the statistics walk */
+  uint32_t            Start;         /* Payload address range                */
+  uint32_t            End;
+  uint32_t            Attributes;
+  uint32_t            TotalSize;
+  uint32_t            UsedSize;
+  uint32_t            PeakUsed;
+  uint32_t            Allocs;
+  uint32_t            Frees;
+  uint32_t            Failures;
+  uint32_t            MaxAllocCycles;
+  uint32_t            MaxFreeCycles;
+} TLSF_RegionTypeDef;
+
+static TLSF_RegionTypeDef TLSF_Regions[TLSF_HEAP_MAX_REGIONS];
+static uint32_t           TLSF_RegionCount = 0U;
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t          TLSF_Fls(uint32_t Word);
+static uint32_t          TLSF_Ffs(uint32_t Word);
+static void              TLSF_MappingInsert(uint32_t Size, uint32_t *pFl, uint32_t *pSl);
+static void              TLSF_MappingSearch(uint32_t Size, uint32_t *pFl, uint32_t *pSl);
+static TLSF_BlockTypeDef *TLSF_Next(const TLSF_BlockTypeDef *pBlock);
+static TLSF_BlockTypeDef *TLSF_LinkNext(TLSF_BlockTypeDef *pBlock);
+static void              TLSF_MarkFree(TLSF_BlockTypeDef *pBlock);
+static void              TLSF_MarkUsed(TLSF_BlockTypeDef *pBlock);
+static void              TLSF_RemoveFree(TLSF_ControlTypeDef *pCtrl, TLSF_BlockTypeDef *pBlock, uint32_t Fl, uint32_t Sl);
+static void              TLSF_InsertFree(TLSF_ControlTypeDef *pCtrl, TLSF_BlockTypeDef *pBlock, uint32_t Fl, uint32_t Sl);
+static void              TLSF_Remove(TLSF_ControlTypeDef *pCtrl, TLSF_BlockTypeDef *pBlock);
+static void              TLSF_Insert(TLSF_ControlTypeDef *pCtrl, TLSF_BlockTypeDef *pBlock);
+static TLSF_BlockTypeDef *TLSF_Split(TLSF_BlockTypeDef *pBlock, uint32_t Size);
+static TLSF_BlockTypeDef *TLSF_Absorb(TLSF_BlockTypeDef *pPrev, TLSF_BlockTypeDef *pBlock);
+static uint32_t          TLSF_AdjustSize(uint32_t Size, uint32_t Align);
+static TLSF_BlockTypeDef *TLSF_Locate(TLSF_ControlTypeDef *pCtrl, uint32_t Size);
+static TLSF_BlockTypeDef *TLSF_Memalign(TLSF_ControlTypeDef *pCtrl, uint32_t Size, uint32_t Align);
+static void              TLSF_Release(TLSF_ControlTypeDef *pCtrl, TLSF_BlockTypeDef *pBlock);
+
+/* Functions Definition ------------------------------------------------------*/
+/**
+  * @brief  Forget every region and enable the DWT cycle counter
+  * @param  None
+  * @retval None
+  */
+void TLSF_Heap_Init(void)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#if (__CORTEX_M == 7U)
+  DWT->LAR = 0xC5ACCE55U;
+#endif
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  __disable_irq();
+  TLSF_RegionCount = 0U;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Add a memory range to the heap as a new region
+  * @param  pStart: first byte of the range
+  * @param  Size: range size in bytes, the region control block included
+  * @param  Attributes: TLSF_ATTR_xxx of the memory, matched by the allocations
+  * @retval HAL_ERROR when all the regions are used or the range is too small
+  */
+HAL_StatusTypeDef TLSF_Heap_AddRegion(void *pStart, uint32_t Size, uint32_t Attributes)
+{
+  TLSF_RegionTypeDef  *region;
+  TLSF_ControlTypeDef *ctrl;
+  TLSF_BlockTypeDef   *block;
+  uint32_t start = TLSF_ALIGN_UP((uint32_t)pStart, TLSF_ALIGN_SIZE);
+  uint32_t end = TLSF_ALIGN_DOWN((uint32_t)pStart + Size, TLSF_ALIGN_SIZE);
+  uint32_t pool;
+  uint32_t bytes;
+  uint32_t fl;
+  uint32_t sl;
+  uint32_t primask;
+
+  if((pStart == NULL) || (Size == 0U) || (end <= start) || (TLSF_RegionCount >= TLSF_HEAP_MAX_REGIONS))
+  {
+    return HAL_ERROR;
+  }
+
+  pool = start + TLSF_ALIGN_UP((uint32_t)sizeof(TLSF_ControlTypeDef), TLSF_ALIGN_SIZE);
+  if((end <= pool) || ((end - pool) < (TLSF_BLOCK_SIZE_MIN + (2U * TLSF_BLOCK_OVERHEAD))))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Payload of the single free block, followed by the size word of an
+     empty allocated block that stops the merges at the region end */
+  bytes = TLSF_ALIGN_DOWN(end - pool - (2U * TLSF_BLOCK_OVERHEAD), TLSF_ALIGN_SIZE);
+  if(bytes >= TLSF_BLOCK_SIZE_MAX)
+  {
+    bytes = TLSF_BLOCK_SIZE_MAX - TLSF_ALIGN_SIZE;
+  }
+
+  ctrl = (TLSF_ControlTypeDef *)start;
+  ctrl->Null.pNextFree = &ctrl->Null;
+  ctrl->Null.pPrevFree = &ctrl->Null;
+  ctrl->FlBitmap = 0U;
+  for(fl = 0U; fl < TLSF_FL_COUNT; fl++)
+  {
+    ctrl->SlBitmap[fl] = 0U;
+    for(sl = 0U; sl < TLSF_SL_COUNT; sl++)
+    {
+      ctrl->pHeads[fl][sl] = &ctrl->Null;
+    }
+  }
+
+  /* The first header starts one word early, its pPrevPhys is never read */
+  block = (TLSF_BlockTypeDef *)(pool - TLSF_BLOCK_OVERHEAD);
+  block->Size = bytes | TLSF_BLOCK_FREE;
+  TLSF_Insert(ctrl, block);
+  TLSF_LinkNext(block)->Size = TLSF_BLOCK_PREV_FREE;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  region = &TLSF_Regions[TLSF_RegionCount];
+  region->pControl = ctrl;
+  region->pFirst = block;
+  region->Start = start;
+  region->End = end;
+  region->Attributes = Attributes;
+  region->TotalSize = bytes + TLSF_BLOCK_OVERHEAD;
+  region->UsedSize = 0U;
+  region->PeakUsed = 0U;
+  region->Allocs = 0U;
+  region->Frees = 0U;
+  region->Failures = 0U;
+  region->MaxAllocCycles = 0U;
+  region->MaxFreeCycles = 0U;
+  TLSF_RegionCount++;
+  __set_PRIMASK(primask);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Allocate a buffer from the first region with the attributes
+  * @param  Size: buffer size in bytes
+  * @param  Attributes: TLSF_ATTR_xxx the region must have, TLSF_ATTR_NONE for any
+  * @retval Buffer, 4-byte aligned, or NULL when no region can serve it
+  */
+void *TLSF_Heap_Alloc(uint32_t Size, uint32_t Attributes)
+{
+  return TLSF_Heap_AllocAligned(Size, TLSF_ALIGN_SIZE, Attributes);
+}
+
+/**
+  * @brief  Allocate an aligned buffer from the first region with the attributes
+  * @param  Size: buffer size in bytes
+  * @param  Alignment: buffer alignment in bytes, power of 2
+  * @param  Attributes: TLSF_ATTR_xxx the region must have, TLSF_ATTR_NONE for any
+  * @retval Buffer or NULL when no region can serve it
+  */
+void *TLSF_Heap_AllocAligned(uint32_t Size, uint32_t Alignment, uint32_t Attributes)
+{
+  TLSF_RegionTypeDef *region = NULL;
+  TLSF_BlockTypeDef  *block = NULL;
+  uint32_t align;
+  uint32_t size;
+  uint32_t index;
+  uint32_t cycles;
+  uint32_t primask;
+
+  if((Size == 0U) || ((Alignment & (Alignment - 1U)) != 0U))
+  {
+    return NULL;
+  }
+  if(Alignment < TLSF_ALIGN_SIZE)
+  {
+    Alignment = TLSF_ALIGN_SIZE;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  cycles = DWT->CYCCNT;
+  for(index = 0U; (index < TLSF_RegionCount) && (block == NULL); index++)
+  {
+    region = &TLSF_Regions[index];
+    if((region->Attributes & Attributes) != Attributes)
+    {
+      continue;
+    }
+
+    align = Alignment;
+    size = Size;
+    if(((Attributes & TLSF_ATTR_DMA) != 0U) && ((region->Attributes & TLSF_ATTR_CACHEABLE) != 0U))
+    {
+      /* Keep the D-cache maintenance of the buffer off its neighbours */
+      align = (align < TLSF_CACHE_LINE) ? TLSF_CACHE_LINE : align;
+      size = TLSF_ALIGN_UP(size, TLSF_CACHE_LINE);
+    }
+
+    block = TLSF_Memalign(region->pControl, size, align);
+    if(block == NULL)
+    {
+      region->Failures++;
+    }
+  }
+
+  if(block != NULL)
+  {
+    region->Allocs++;
+    region->UsedSize += TLSF_SIZE(block) + TLSF_BLOCK_OVERHEAD;
+    if(region->UsedSize > region->PeakUsed)
+    {
+      region->PeakUsed = region->UsedSize;
+    }
+    cycles = DWT->CYCCNT - cycles;
+    if(cycles > region->MaxAllocCycles)
+    {
+      region->MaxAllocCycles = cycles;
+    }
+  }
+  __set_PRIMASK(primask);
+
+  return (block != NULL) ? TLSF_TO_PTR(block) : NULL;
+}
+
+/**
+  * @brief  Give a buffer back to its region
+  * @param  pBuffer: buffer from TLSF_Heap_Alloc() or TLSF_Heap_AllocAligned(),
+  *         NULL is ignored
+  * @retval None
+  */
+void TLSF_Heap_Free(void *pBuffer)
+{
+  TLSF_RegionTypeDef *region;
+  TLSF_BlockTypeDef  *block;
+  uint32_t address = (uint32_t)pBuffer;
+  uint32_t index;
+  uint32_t cycles;
+  uint32_t primask;
+
+  if(pBuffer == NULL)
+  {
+    return;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  cycles = DWT->CYCCNT;
+  for(index = 0U; index < TLSF_RegionCount; index++)
+  {
+    region = &TLSF_Regions[index];
+    if((address >= region->Start) && (address < region->End))
+    {
+      block = TLSF_FROM_PTR(pBuffer);
+      region->Frees++;
+      region->UsedSize -= TLSF_SIZE(block) + TLSF_BLOCK_OVERHEAD;
+      TLSF_Release(region->pControl, block);
+
+      cycles = DWT->CYCCNT - cycles;
+      if(cycles > region->MaxFreeCycles)
+      {
+        region->MaxFreeCycles = cycles;
+      }
+      break;
+    }
+  }
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Usable size of an allocated buffer
+  * @param  pBuffer: buffer from TLSF_Heap_Alloc() or TLSF_Heap_AllocAligned()
+  * @retval Size in bytes, at least the size requested
+  */
+uint32_t TLSF_Heap_GetSize(const void *pBuffer)
+{
+  return (pBuffer != NULL) ? TLSF_SIZE(TLSF_FROM_PTR(pBuffer)) : 0U;
+}
+
+/**
+  * @brief  Number of regions registered
+  * @param  None
+  * @retval Region count, the regions are numbered in registration order
+  */
+uint32_t TLSF_Heap_GetRegionCount(void)
+{
+  return TLSF_RegionCount;
+}
+
+/**
+  * @brief  Walk a region and report its usage
+  * @param  Region: region number, 0 to TLSF_Heap_GetRegionCount() - 1
+  * @param  pStats: filled with the region statistics
+  * @retval HAL_ERROR on a bad region number or a corrupted block chain
+  */
+HAL_StatusTypeDef TLSF_Heap_GetStats(uint32_t Region, TLSF_Heap_StatsTypeDef *pStats)
+{
+  TLSF_RegionTypeDef *region;
+  TLSF_BlockTypeDef  *block;
+  TLSF_BlockTypeDef  *next;
+  HAL_StatusTypeDef  status = HAL_OK;
+  uint32_t prevfree = 0U;
+  uint32_t primask;
+
+  if((Region >= TLSF_RegionCount) || (pStats == NULL))
+  {
+    return HAL_ERROR;
+  }
+  region = &TLSF_Regions[Region];
+
+  pStats->FreeSize = 0U;
+  pStats->LargestFree = 0U;
+  pStats->FreeBlocks = 0U;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  pStats->Attributes = region->Attributes;
+  pStats->TotalSize = region->TotalSize;
+  pStats->UsedSize = region->UsedSize;
+  pStats->PeakUsed = region->PeakUsed;
+  pStats->Allocs = region->Allocs;
+  pStats->Frees = region->Frees;
+  pStats->Failures = region->Failures;
+  pStats->MaxAllocCycles = region->MaxAllocCycles;
+  pStats->MaxFreeCycles = region->MaxFreeCycles;
+
+  for(block = region->pFirst; TLSF_SIZE(block) != 0U; block = next)
+  {
+    next = TLSF_Next(block);
+    if(((uint32_t)next >= region->End) ||
+       (((block->Size & TLSF_BLOCK_PREV_FREE) != 0U) != (prevfree != 0U)))
+    {
+      status = HAL_ERROR;
+      break;
+    }
+
+    prevfree = block->Size & TLSF_BLOCK_FREE;
+    if(prevfree != 0U)
+    {
+      /* Two free neighbours would have been merged */
+      if((next->Size & TLSF_BLOCK_FREE) != 0U)
+      {
+        status = HAL_ERROR;
+        break;
+      }
+      pStats->FreeSize += TLSF_SIZE(block);
+      pStats->FreeBlocks++;
+      if(TLSF_SIZE(block) > pStats->LargestFree)
+      {
+        pStats->LargestFree = TLSF_SIZE(block);
+      }
+    }
+  }
+  __set_PRIMASK(primask);
+
+  pStats->Fragmentation = (pStats->FreeSize != 0U) ?
+    (100U - (uint32_t)(((uint64_t)pStats->LargestFree * 100U) / pStats->FreeSize)) : 0U;
+
+  return status;
+}
+
+/**
+  * @brief  Clear the counters, the peak usage and the longest timings of every region
+  * @param  None
+  * @retval None
+  */
+void TLSF_Heap_ResetStats(void)
+{
+  uint32_t index;
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  for(index = 0U; index < TLSF_RegionCount; index++)
+  {
+    TLSF_Regions[index].PeakUsed = TLSF_Regions[index].UsedSize;
+    TLSF_Regions[index].Allocs = 0U;
+    TLSF_Regions[index].Frees = 0U;
+    TLSF_Regions[index].Failures = 0U;
+    TLSF_Regions[index].MaxAllocCycles = 0U;
+    TLSF_Regions[index].MaxFreeCycles = 0U;
+  }
+  __set_PRIMASK(primask);
+}
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Index of the most significant bit set
+  * @param  Word: non-zero word
+  * @retval Bit index, 0 to 31
+  */
+static uint32_t TLSF_Fls(uint32_t Word)
+{
+  return 31U - (uint32_t)__CLZ(Word);
+}
+
+/**
+  * @brief  Index of the least significant bit set
+  * @param  Word: non-zero word
+  * @retval Bit index, 0 to 31
+  */
+static uint32_t TLSF_Ffs(uint32_t Word)
+{
+  return 31U - (uint32_t)__CLZ(Word & (0U - Word));
+}
+
+/**
+  * @brief  Free list holding the blocks of a size
+  * @param  Size: block size in bytes
+  * @param  pFl: first level index
+  * @param  pSl: second level index
+  * @retval None
+  */
+static void TLSF_MappingInsert(uint32_t Size, uint32_t *pFl, uint32_t *pSl)
+{
+  uint32_t fl;
+
+  if(Size < TLSF_SMALL_BLOCK)
+  {
+    /* Linear lists of TLSF_ALIGN_SIZE steps below the first power of 2 */
+    *pFl = 0U;
+    *pSl = Size / (TLSF_SMALL_BLOCK / TLSF_SL_COUNT);
+  }
+  else
+  {
+    fl = TLSF_Fls(Size);
+    *pSl = (Size >> (fl - TLSF_HEAP_SL_LOG2)) ^ TLSF_SL_COUNT;
+    *pFl = fl - (TLSF_FL_SHIFT - 1U);
+  }
+}
+
+/**
+  * @brief  First free list whose blocks all fit a size
+  * @param  Size: requested size in bytes
+  * @param  pFl: first level index, TLSF_FL_COUNT or more when too large
+  * @param  pSl: second level index
+  * @retval None
+  */
+static void TLSF_MappingSearch(uint32_t Size, uint32_t *pFl, uint32_t *pSl)
+{
+  if(Size >= TLSF_SMALL_BLOCK)
+  {
+    Size += (1UL << (TLSF_Fls(Size) - TLSF_HEAP_SL_LOG2)) - 1U;
+  }
+  TLSF_MappingInsert(Size, pFl, pSl);
+}
+
+/**
+  * @brief  Next block in memory
+  * @param  pBlock: block
+  * @retval Next block header
+  */
+static TLSF_BlockTypeDef *TLSF_Next(const TLSF_BlockTypeDef *pBlock)
+{
+  return (TLSF_BlockTypeDef *)((uint8_t *)TLSF_TO_PTR(pBlock) + TLSF_SIZE(pBlock) - TLSF_BLOCK_OVERHEAD);
+}
+
+/**
+  * @brief  Point the next block in memory back to a block
+  * @param  pBlock: block
+  * @retval Next block header
+  */
+static TLSF_BlockTypeDef *TLSF_LinkNext(TLSF_BlockTypeDef *pBlock)
+{
+  TLSF_BlockTypeDef *next = TLSF_Next(pBlock);
+
+  next->pPrevPhys = pBlock;
+  return next;
+}
+
+/**
+  * @brief  Flag a block free, in its header and in the next one
+  * @param  pBlock: block
+  * @retval None
+  */
+static void TLSF_MarkFree(TLSF_BlockTypeDef *pBlock)
+{
+  TLSF_LinkNext(pBlock)->Size |= TLSF_BLOCK_PREV_FREE;
+  pBlock->Size |= TLSF_BLOCK_FREE;
+}
+
+/**
+  * @brief  Flag a block allocated, in its header and in the next one
+  * @param  pBlock: block
+  * @retval None
+  */
+static void TLSF_MarkUsed(TLSF_BlockTypeDef *pBlock)
+{
+  TLSF_Next(pBlock)->Size &= ~TLSF_BLOCK_PREV_FREE;
+  pBlock->Size &= ~TLSF_BLOCK_FREE;
+}
+
+/**
+  * @brief  Unlink a block from a free list
+  * @param  pCtrl: region control block
+  * @param  pBlock: free block
+  * @param  Fl: first level index of the list
+  * @param  Sl: second level index of the list
+  * @retval None
+  */
+static void TLSF_RemoveFree(TLSF_ControlTypeDef *pCtrl, TLSF_BlockTypeDef *pBlock, uint32_t Fl, uint32_t Sl)
+{
+  TLSF_BlockTypeDef *prev = pBlock->pPrevFree;
+  TLSF_BlockTypeDef *next = pBlock->pNextFree;
+
+  next->pPrevFree = prev;
+  prev->pNextFree = next;
+
+  if(pCtrl->pHeads[Fl][Sl] == pBlock)
+  {
+    pCtrl->pHeads[Fl][Sl] = next;
+    if(next == &pCtrl->Null)
+    {
+      pCtrl->SlBitmap[Fl] &= ~(1UL << Sl);
+      if(pCtrl->SlBitmap[Fl] == 0U)
+      {
+        pCtrl->FlBitmap &= ~(1UL << Fl);
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Push a block on a free list
+  * @param  pCtrl: region control block
+  * @param  pBlock: free block
+  * @param  Fl: first level index of the list
+  * @param  Sl: second level index of the list
+  * @retval None
+  */
+static void TLSF_InsertFree(TLSF_ControlTypeDef *pCtrl, TLSF_BlockTypeDef *pBlock, uint32_t Fl, uint32_t Sl)
+{
+  TLSF_BlockTypeDef *head = pCtrl->pHeads[Fl][Sl];
+
+  pBlock->pNextFree = head;
+  pBlock->pPrevFree = &pCtrl->Null;
+  head->pPrevFree = pBlock;
+  pCtrl->pHeads[Fl][Sl] = pBlock;
+  pCtrl->FlBitmap |= (1UL << Fl);
+  pCtrl->SlBitmap[Fl] |= (1UL << Sl);
+}
+
+/**
+  * @brief  Unlink a free block from the list of its size
+  * @param  pCtrl: region control block
+  * @param  pBlock: free block
+  * @retval None
+  */
+static void TLSF_Remove(TLSF_ControlTypeDef *pCtrl, TLSF_BlockTypeDef *pBlock)
+{
+  uint32_t fl;
+  uint32_t sl;
+
+  TLSF_MappingInsert(TLSF_SIZE(pBlock), &fl, &sl);
+  TLSF_RemoveFree(pCtrl, pBlock, fl, sl);
+}
+
+/**
+  * @brief  Push a free block on the list of its size
+  * @param  pCtrl: region control block
+  * @param  pBlock: free block
+  * @retval None
+  */
+static void TLSF_Insert(TLSF_ControlTypeDef *pCtrl, TLSF_BlockTypeDef *pBlock)
+{
+  uint32_t fl;
+  uint32_t sl;
+
+  TLSF_MappingInsert(TLSF_SIZE(pBlock), &fl, &sl);
+  TLSF_InsertFree(pCtrl, pBlock, fl, sl);
+}
+
+/**
+  * @brief  Cut the tail of a block off as a new free block
+  * @param  pBlock: block, at least sizeof(TLSF_BlockTypeDef) + Size long
+  * @param  Size: payload bytes kept in pBlock
+  * @retval Tail block, flagged free, its TLSF_BLOCK_PREV_FREE left to the caller
+  */
+static TLSF_BlockTypeDef *TLSF_Split(TLSF_BlockTypeDef *pBlock, uint32_t Size)
+{
+  TLSF_BlockTypeDef *tail = (TLSF_BlockTypeDef *)((uint8_t *)TLSF_TO_PTR(pBlock) + Size - TLSF_BLOCK_OVERHEAD);
+
+  tail->Size = TLSF_SIZE(pBlock) - (Size + TLSF_BLOCK_OVERHEAD);
+  pBlock->Size = Size | (pBlock->Size & TLSF_BLOCK_FLAGS);
+  TLSF_MarkFree(tail);
+
+  return tail;
+}
+
+/**
+  * @brief  Merge a block into the previous one in memory
+  * @param  pPrev: previous block
+  * @param  pBlock: block
+  * @retval Merged block
+  */
+static TLSF_BlockTypeDef *TLSF_Absorb(TLSF_BlockTypeDef *pPrev, TLSF_BlockTypeDef *pBlock)
+{
+  pPrev->Size += TLSF_SIZE(pBlock) + TLSF_BLOCK_OVERHEAD;
+  (void)TLSF_LinkNext(pPrev);
+
+  return pPrev;
+}
+
+/**
+  * @brief  Block size serving a request
+  * @param  Size: requested size in bytes
+  * @param  Align: size granularity, power of 2
+  * @retval Block size, 0 when the request cannot be served
+  */
+static uint32_t TLSF_AdjustSize(uint32_t Size, uint32_t Align)
+{
+  uint32_t adjust;
+
+  if((Size == 0U) || (Size >= (TLSF_BLOCK_SIZE_MAX - Align)))
+  {
+    return 0U;
+  }
+  adjust = TLSF_ALIGN_UP(Size, Align);
+
+  return (adjust < TLSF_BLOCK_SIZE_MIN) ? TLSF_BLOCK_SIZE_MIN : adjust;
+}
+
+/**
+  * @brief  Take a free block of at least a size off its list, in O(1)
+  * @param  pCtrl: region control block
+  * @param  Size: block size from TLSF_AdjustSize()
+  * @retval Block or NULL
+  */
+static TLSF_BlockTypeDef *TLSF_Locate(TLSF_ControlTypeDef *pCtrl, uint32_t Size)
+{
+  TLSF_BlockTypeDef *block;
+  uint32_t fl;
+  uint32_t sl;
+  uint32_t map;
+
+  if(Size == 0U)
+  {
+    return NULL;
+  }
+
+  TLSF_MappingSearch(Size, &fl, &sl);
+  if(fl >= TLSF_FL_COUNT)
+  {
+    return NULL;
+  }
+
+  /* Same row, same or larger list, else the first larger row */
+  map = pCtrl->SlBitmap[fl] & (~0UL << sl);
+  if(map == 0U)
+  {
+    map = pCtrl->FlBitmap & (~0UL << (fl + 1U));
+    if(map == 0U)
+    {
+      return NULL;
+    }
+    fl = TLSF_Ffs(map);
+    map = pCtrl->SlBitmap[fl];
+  }
+  sl = TLSF_Ffs(map);
+
+  block = pCtrl->pHeads[fl][sl];
+  TLSF_RemoveFree(pCtrl, block, fl, sl);
+
+  return block;
+}
+
+/**
+  * @brief  Allocate an aligned block in a region
+  * @param  pCtrl: region control block
+  * @param  Size: requested size in bytes
+  * @param  Align: payload alignment, power of 2, TLSF_ALIGN_SIZE or more
+  * @retval Allocated block or NULL
+  */
+static TLSF_BlockTypeDef *TLSF_Memalign(TLSF_ControlTypeDef *pCtrl, uint32_t Size, uint32_t Align)
+{
+  TLSF_BlockTypeDef *block;
+  TLSF_BlockTypeDef *tail;
+  uint32_t adjust = TLSF_AdjustSize(Size, TLSF_ALIGN_SIZE);
+  uint32_t request = adjust;
+  uint32_t payload;
+  uint32_t aligned;
+  uint32_t gap;
+
+  if(adjust == 0U)
+  {
+    return NULL;
+  }
+
+  /* Room to give a leading gap back as a block of its own */
+  if(Align > TLSF_ALIGN_SIZE)
+  {
+    request = TLSF_AdjustSize(adjust + Align + TLSF_GAP_MIN, Align);
+  }
+
+  block = TLSF_Locate(pCtrl, request);
+  if(block == NULL)
+  {
+    return NULL;
+  }
+
+  if(Align > TLSF_ALIGN_SIZE)
+  {
+    payload = (uint32_t)TLSF_TO_PTR(block);
+    aligned = TLSF_ALIGN_UP(payload, Align);
+    gap = aligned - payload;
+    if((gap != 0U) && (gap < TLSF_GAP_MIN))
+    {
+      aligned = TLSF_ALIGN_UP(aligned + ((TLSF_GAP_MIN - gap) > Align ? (TLSF_GAP_MIN - gap) : Align), Align);
+      gap = aligned - payload;
+    }
+
+    if(gap != 0U)
+    {
+      /* Free the leading gap, the block now starts at the aligned payload */
+      tail = TLSF_Split(block, gap - TLSF_BLOCK_OVERHEAD);
+      tail->Size |= TLSF_BLOCK_PREV_FREE;
+      (void)TLSF_LinkNext(block);
+      TLSF_Insert(pCtrl, block);
+      block = tail;
+    }
+  }
+
+  /* Give the tail back when it can hold a block */
+  if(TLSF_SIZE(block) >= (sizeof(TLSF_BlockTypeDef) + adjust))
+  {
+    tail = TLSF_Split(block, adjust);
+    tail->Size |= TLSF_BLOCK_PREV_FREE;
+    (void)TLSF_LinkNext(block);
+    TLSF_Insert(pCtrl, tail);
+  }
+  TLSF_MarkUsed(block);
+
+  return block;
+}
+
+/**
+  * @brief  Free a block and merge it with its free neighbours
+  * @param  pCtrl: region control block
+  * @param  pBlock: allocated block
+  * @retval None
+  */
+static void TLSF_Release(TLSF_ControlTypeDef *pCtrl, TLSF_BlockTypeDef *pBlock)
+{
+  TLSF_BlockTypeDef *next;
+
+  TLSF_MarkFree(pBlock);
+
+  if((pBlock->Size & TLSF_BLOCK_PREV_FREE) != 0U)
+  {
+    TLSF_Remove(pCtrl, pBlock->pPrevPhys);
+    pBlock = TLSF_Absorb(pBlock->pPrevPhys, pBlock);
+  }
+
+  next = TLSF_Next(pBlock);
+  if((next->Size & TLSF_BLOCK_FREE) != 0U)
+  {
+    TLSF_Remove(pCtrl, next);
+    pBlock = TLSF_Absorb(pBlock, next);
+  }
+
+  TLSF_Insert(pCtrl, pBlock);
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,480 @@
+/**
+  ******************************************************************************
+  * @file    comp_protect.c
+  * @author  MCD Application Team
+  * @brief   Comparator, DAC threshold and timer break over-current protection with a
+  *          DMA event log and retry policies
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- initialize the power stage timer (advanced timer, PWM channels), the
+   comparators (non inverting input on the sense signal, inverting input on
+   a DAC channel or a fixed reference, output to the timer break input:
+   COMP_OUTPUT_TIM1BKIN and the like on the F3) and the DAC channels.
+   COMP_Protect_Init() sets the DAC thresholds, the break and dead time
+   configuration, the comparator break input sources of the L4 and H7
+   (BreakInput and BreakSource) and the OCREF_CLR of ClearChannels: a
+   comparator trip then turns the outputs off in hardware, within
+   nanoseconds, whatever the CPU load.
+
+2- event log: a free running 32 bits timer (TIM2, TIM5) with a channel in
+   input capture on a comparator output (COMP_OUTPUT_TIM2IC4 on the F3,
+   HAL_TIMEx_RemapConfig() on the L4, HAL_TIMEx_TISelection() on the H7)
+   and a circular word DMA: each trip edge writes its timestamp to pLog
+   with no interrupt. COMP_Protect_Process() hands the new entries to
+   COMP_Protect_EventCallback(), out of any interrupt. The ring must be
+   read before LogLength trips, older entries are then overwritten.
+
+3- COMP_Protect_Start() starts the DAC, the comparators and the log, before
+   the PWM outputs are started (HAL_TIM_PWM_Start(),
+   HAL_TIMEx_PWMN_Start()). COMP_Protect_Stop() turns the outputs off.
+
+4- call COMP_Protect_Process() periodically from the main loop or a low
+   priority task, each millisecond for the retry delays. It counts the
+   break flags and applies the policy:
+   (+) COMP_PROTECT_POLICY_LATCH: outputs off until COMP_Protect_Rearm(),
+       which fails while a comparator is still in fault.
+   (+) COMP_PROTECT_POLICY_CYCLE: automatic output enable, the outputs are
+       back at the next update event, a cycle by cycle current limit.
+   (+) COMP_PROTECT_POLICY_RETRY: outputs back RetryDelay ms after the
+       trip, once all the comparators are released.
+   With RetryMax, more than RetryMax trips within RetryWindow ms lock the
+   outputs off and call COMP_Protect_LockoutCallback().
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "comp_protect.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#if defined(TIM_SR_B2IF)
+#define COMP_PROTECT_BREAK_FLAGS  ((uint32_t)(TIM_FLAG_BREAK | TIM_FLAG_BREAK2))
+#else
+#define COMP_PROTECT_BREAK_FLAGS  ((uint32_t)TIM_FLAG_BREAK)
+#endif
+
+/* Private macro -------------------------------------------------------------*/
+/* DMA handle of a capture channel */
+#define COMP_PROTECT_DMA(__HTIM__, __CHANNEL__)  ((__HTIM__)->hdma[TIM_DMA_ID_CC1 + ((__CHANNEL__) >> 2U)])
+
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static void COMP_Protect_Trip(COMP_ProtectTypeDef *pProt, uint32_t Tick);
+static void COMP_Protect_Lockout(COMP_ProtectTypeDef *pProt);
+static void COMP_Protect_ReadLog(COMP_ProtectTypeDef *pProt);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Set the thresholds, the break path and the clear inputs
+  * @param  pProt: protection context
+  * @param  pConfig: protection configuration, copied
+  * @retval HAL status
+  */
+HAL_StatusTypeDef COMP_Protect_Init(COMP_ProtectTypeDef *pProt, const COMP_Protect_ConfigTypeDef *pConfig)
+{
+  TIM_BreakDeadTimeConfigTypeDef brk;
+  TIM_ClearInputConfigTypeDef clear;
+  const COMP_Protect_SenseTypeDef *psense;
+  uint32_t i;
+
+  if ((pProt == NULL) || (pConfig == NULL) || (pConfig->htim == NULL) ||
+      (pConfig->NbSense == 0U) || (pConfig->NbSense > COMP_PROTECT_MAX_SENSE) ||
+      (pConfig->Policy > COMP_PROTECT_POLICY_RETRY) ||
+      ((pConfig->RetryMax != 0U) && (pConfig->RetryWindow == 0U)))
+  {
+    return HAL_ERROR;
+  }
+  if ((pConfig->htimLog != NULL) &&
+      ((pConfig->pLog == NULL) || (pConfig->LogLength == 0U) || (pConfig->LogLength > 0xFFFFU) ||
+       (COMP_PROTECT_DMA(pConfig->htimLog, pConfig->LogChannel) == NULL) ||
+       (COMP_PROTECT_DMA(pConfig->htimLog, pConfig->LogChannel)->Init.Mode != DMA_CIRCULAR)))
+  {
+    return HAL_ERROR;
+  }
+
+  memset(pProt, 0, sizeof(COMP_ProtectTypeDef));
+  pProt->Config = *pConfig;
+
+  for (i = 0U; i < pConfig->NbSense; i++)
+  {
+    psense = &pConfig->Sense[i];
+    if (psense->hcomp == NULL)
+    {
+      return HAL_ERROR;
+    }
+    if ((psense->hdac != NULL) &&
+        (HAL_DAC_SetValue(psense->hdac, psense->DacChannel, DAC_ALIGN_12B_R, psense->Threshold) != HAL_OK))
+    {
+      return HAL_ERROR;
+    }
+#if defined(TIM_BREAKINPUTSOURCE_COMP1)
+    if (psense->BreakInput != 0U)
+    {
+      TIMEx_BreakInputConfigTypeDef input;
+
+      input.Source   = psense->BreakSource;
+      input.Enable   = TIM_BREAKINPUTSOURCE_ENABLE;
+      input.Polarity = (psense->TripLevel == COMP_PROTECT_LEVEL_HIGH) ? TIM_BREAKINPUTSOURCE_POLARITY_HIGH :
+                                                                       TIM_BREAKINPUTSOURCE_POLARITY_LOW;
+      if (HAL_TIMEx_ConfigBreakInput(pConfig->htim, psense->BreakInput, &input) != HAL_OK)
+      {
+        return HAL_ERROR;
+      }
+    }
+#endif
+  }
+
+  /* Only the CYCLE policy lets the hardware set MOE again */
+  brk = pConfig->Break;
+  brk.AutomaticOutput = (pConfig->Policy == COMP_PROTECT_POLICY_CYCLE) ? TIM_AUTOMATICOUTPUT_ENABLE :
+                                                                        TIM_AUTOMATICOUTPUT_DISABLE;
+  if (HAL_TIMEx_ConfigBreakDeadTime(pConfig->htim, &brk) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  clear = pConfig->Clear;
+  clear.ClearInputState = ENABLE;
+  for (i = 0U; i < 4U; i++)
+  {
+    if (((pConfig->ClearChannels & (1UL << i)) != 0U) &&
+        (HAL_TIM_ConfigOCrefClear(pConfig->htim, &clear, TIM_CHANNEL_1 + (i << 2U)) != HAL_OK))
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Start the thresholds, the comparators and the event log, to call
+  *         before the PWM outputs are started
+  * @param  pProt: protection context
+  * @retval HAL status
+  */
+HAL_StatusTypeDef COMP_Protect_Start(COMP_ProtectTypeDef *pProt)
+{
+  const COMP_Protect_SenseTypeDef *psense;
+  uint32_t i;
+
+  for (i = 0U; i < pProt->Config.NbSense; i++)
+  {
+    psense = &pProt->Config.Sense[i];
+    if (((psense->hdac != NULL) && (HAL_DAC_Start(psense->hdac, psense->DacChannel) != HAL_OK)) ||
+        (HAL_COMP_Start(psense->hcomp) != HAL_OK))
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  if (pProt->Config.htimLog != NULL)
+  {
+    pProt->LogRead = 0U;
+    if (HAL_TIM_IC_Start_DMA(pProt->Config.htimLog, pProt->Config.LogChannel, pProt->Config.pLog,
+                             (uint16_t)pProt->Config.LogLength) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  __HAL_TIM_CLEAR_FLAG(pProt->Config.htim, COMP_PROTECT_BREAK_FLAGS);
+  pProt->State = COMP_PROTECT_STATE_ARMED;
+  pProt->WindowTick = HAL_GetTick();
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Turn the outputs off, stop the event log and the comparators
+  * @param  pProt: protection context
+  * @retval HAL status
+  */
+HAL_StatusTypeDef COMP_Protect_Stop(COMP_ProtectTypeDef *pProt)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t i;
+
+  pProt->Config.htim->Instance->BDTR &= ~(TIM_BDTR_AOE | TIM_BDTR_MOE);
+  pProt->State = COMP_PROTECT_STATE_RESET;
+
+  if ((pProt->Config.htimLog != NULL) &&
+      (HAL_TIM_IC_Stop_DMA(pProt->Config.htimLog, pProt->Config.LogChannel) != HAL_OK))
+  {
+    status = HAL_ERROR;
+  }
+  for (i = 0U; i < pProt->Config.NbSense; i++)
+  {
+    if (HAL_COMP_Stop(pProt->Config.Sense[i].hcomp) != HAL_OK)
+    {
+      status = HAL_ERROR;
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Change the trip threshold of a comparator
+  * @param  pProt: protection context
+  * @param  Sense: comparator index in the configuration
+  * @param  Threshold: DAC code, 12 bits right aligned
+  * @retval HAL status
+  */
+HAL_StatusTypeDef COMP_Protect_SetThreshold(COMP_ProtectTypeDef *pProt, uint32_t Sense, uint32_t Threshold)
+{
+  COMP_Protect_SenseTypeDef *psense;
+
+  if ((Sense >= pProt->Config.NbSense) || (pProt->Config.Sense[Sense].hdac == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  psense = &pProt->Config.Sense[Sense];
+  psense->Threshold = Threshold;
+
+  return HAL_DAC_SetValue(psense->hdac, psense->DacChannel, DAC_ALIGN_12B_R, Threshold);
+}
+
+/**
+  * @brief  Turn the outputs on again after a trip or a lockout
+  * @param  pProt: protection context
+  * @retval HAL_OK, or HAL_ERROR while a comparator is in fault
+  */
+HAL_StatusTypeDef COMP_Protect_Rearm(COMP_ProtectTypeDef *pProt)
+{
+  TIM_HandleTypeDef *htim = pProt->Config.htim;
+
+  if ((pProt->State == COMP_PROTECT_STATE_RESET) || (COMP_Protect_IsReleased(pProt) == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* MOE only sets once the break flags are cleared and the inputs inactive */
+  __HAL_TIM_CLEAR_FLAG(htim, COMP_PROTECT_BREAK_FLAGS);
+  if (pProt->Config.Policy == COMP_PROTECT_POLICY_CYCLE)
+  {
+    htim->Instance->BDTR |= TIM_BDTR_AOE;
+  }
+  __HAL_TIM_MOE_ENABLE(htim);
+  if ((htim->Instance->BDTR & TIM_BDTR_MOE) == 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  if (pProt->State == COMP_PROTECT_STATE_LOCKED)
+  {
+    pProt->WindowTick = HAL_GetTick();
+    pProt->WindowTrips = 0U;
+  }
+  pProt->State = COMP_PROTECT_STATE_ARMED;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Read the event log, count the trips and apply the policy, out of
+  *         any interrupt
+  * @param  pProt: protection context
+  * @retval COMP_PROTECT_STATE_x
+  */
+uint32_t COMP_Protect_Process(COMP_ProtectTypeDef *pProt)
+{
+  TIM_HandleTypeDef *htim = pProt->Config.htim;
+  uint32_t tick = HAL_GetTick();
+
+  if (pProt->State == COMP_PROTECT_STATE_RESET)
+  {
+    return pProt->State;
+  }
+
+  if (pProt->Config.htimLog != NULL)
+  {
+    COMP_Protect_ReadLog(pProt);
+  }
+
+  /* Break flags set again while the break input is active: one trip per
+     call at most and none while the outputs are off, the log has the exact
+     trip count */
+  if ((htim->Instance->SR & COMP_PROTECT_BREAK_FLAGS) != 0U)
+  {
+    __HAL_TIM_CLEAR_FLAG(htim, COMP_PROTECT_BREAK_FLAGS);
+    if (pProt->State == COMP_PROTECT_STATE_ARMED)
+    {
+      COMP_Protect_Trip(pProt, tick);
+    }
+  }
+
+  if ((pProt->State == COMP_PROTECT_STATE_TRIPPED) &&
+      (pProt->Config.Policy == COMP_PROTECT_POLICY_RETRY) &&
+      ((tick - pProt->TripTick) >= pProt->Config.RetryDelay) &&
+      (COMP_Protect_Rearm(pProt) == HAL_OK))
+  {
+    pProt->Retries++;
+  }
+
+  return pProt->State;
+}
+
+/**
+  * @brief  Comparators out of fault
+  * @param  pProt: protection context
+  * @retval 1 when no comparator output is at its trip level
+  */
+uint32_t COMP_Protect_IsReleased(COMP_ProtectTypeDef *pProt)
+{
+  uint32_t i;
+
+  for (i = 0U; i < pProt->Config.NbSense; i++)
+  {
+    if (HAL_COMP_GetOutputLevel(pProt->Config.Sense[i].hcomp) == pProt->Config.Sense[i].TripLevel)
+    {
+      return 0U;
+    }
+  }
+
+  return 1U;
+}
+
+/**
+  * @brief  Trip logged by the capture timer
+  * @param  pProt: protection context
+  * @param  Timestamp: counter of the log timer at the trip edge
+  * @retval None
+  */
+__weak void COMP_Protect_EventCallback(COMP_ProtectTypeDef *pProt, uint32_t Timestamp)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(pProt);
+  UNUSED(Timestamp);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the COMP_Protect_EventCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Outputs locked off after RetryMax trips within RetryWindow
+  * @param  pProt: protection context
+  * @retval None
+  */
+__weak void COMP_Protect_LockoutCallback(COMP_ProtectTypeDef *pProt)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(pProt);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the COMP_Protect_LockoutCallback could be implemented in the user file
+   */
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Count a trip and apply the policy
+  * @param  pProt: protection context
+  * @param  Tick: HAL_GetTick() of the trip
+  * @retval None
+  */
+static void COMP_Protect_Trip(COMP_ProtectTypeDef *pProt, uint32_t Tick)
+{
+  pProt->Trips++;
+  pProt->TripTick = Tick;
+
+  if ((Tick - pProt->WindowTick) >= pProt->Config.RetryWindow)
+  {
+    pProt->WindowTick = Tick;
+    pProt->WindowTrips = 0U;
+  }
+  pProt->WindowTrips++;
+
+  if ((pProt->Config.RetryMax != 0U) && (pProt->WindowTrips > pProt->Config.RetryMax))
+  {
+    COMP_Protect_Lockout(pProt);
+  }
+  else if (pProt->Config.Policy != COMP_PROTECT_POLICY_CYCLE)
+  {
+    pProt->State = COMP_PROTECT_STATE_TRIPPED;
+  }
+}
+
+/**
+  * @brief  Lock the outputs off
+  * @param  pProt: protection context
+  * @retval None
+  */
+static void COMP_Protect_Lockout(COMP_ProtectTypeDef *pProt)
+{
+  if (pProt->State == COMP_PROTECT_STATE_LOCKED)
+  {
+    return;
+  }
+
+  /* Clearing AOE first keeps the next update event from setting MOE */
+  pProt->Config.htim->Instance->BDTR &= ~TIM_BDTR_AOE;
+  __HAL_TIM_MOE_DISABLE_UNCONDITIONALLY(pProt->Config.htim);
+  pProt->State = COMP_PROTECT_STATE_LOCKED;
+  pProt->Lockouts++;
+
+  COMP_Protect_LockoutCallback(pProt);
+}
+
+/**
+  * @brief  Hand the new entries of the log ring to the event callback
+  * @param  pProt: protection context
+  * @retval None
+  */
+static void COMP_Protect_ReadLog(COMP_ProtectTypeDef *pProt)
+{
+  const uint32_t length = pProt->Config.LogLength;
+  uint32_t write = length - __HAL_DMA_GET_COUNTER(COMP_PROTECT_DMA(pProt->Config.htimLog,
+                                                                   pProt->Config.LogChannel));
+
+  if (write >= length)
+  {
+    write = 0U;
+  }
+  while (pProt->LogRead != write)
+  {
+    COMP_Protect_EventCallback(pProt, pProt->Config.pLog[pProt->LogRead]);
+    pProt->Events++;
+    pProt->LogRead = (pProt->LogRead + 1U < length) ? (pProt->LogRead + 1U) : 0U;
+  }
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
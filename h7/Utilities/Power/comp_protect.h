@@ -0,0 +1,156 @@
+/**
+  ******************************************************************************
+  * @file    comp_protect.h
+  * @author  MCD Application Team
+  * @brief   Header for comp_protect module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _COMP_PROTECT_H__
+#define _COMP_PROTECT_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#if !defined(HAL_COMP_MODULE_ENABLED) || !defined(HAL_TIM_MODULE_ENABLED) || \
+    !defined(HAL_DAC_MODULE_ENABLED) || !defined(HAL_DMA_MODULE_ENABLED)
+#error "comp_protect requires the HAL COMP, TIM, DAC and DMA drivers"
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+/* Comparators of a protection. Override in main.h. */
+#if !defined(COMP_PROTECT_MAX_SENSE)
+#define COMP_PROTECT_MAX_SENSE      4U
+#endif
+
+/* Fault response policies, the shutdown itself is always the timer break */
+#define COMP_PROTECT_POLICY_LATCH   0U  /* Outputs off until COMP_Protect_Rearm()                  */
+#define COMP_PROTECT_POLICY_CYCLE   1U  /* Outputs back at the next update event (AOE), cycle by
+                                           cycle limit                                           */
+#define COMP_PROTECT_POLICY_RETRY   2U  /* Outputs back RetryDelay ms after the trip once the
+                                           comparators are released                              */
+
+/* Protection states */
+#define COMP_PROTECT_STATE_RESET    0U
+#define COMP_PROTECT_STATE_ARMED    1U
+#define COMP_PROTECT_STATE_TRIPPED  2U  /* Outputs off, waiting for the retry or COMP_Protect_Rearm() */
+#define COMP_PROTECT_STATE_LOCKED   3U  /* Too many trips, outputs off until COMP_Protect_Rearm()  */
+
+/* Channels of ClearChannels */
+#define COMP_PROTECT_CLEAR_CH1      0x01U
+#define COMP_PROTECT_CLEAR_CH2      0x02U
+#define COMP_PROTECT_CLEAR_CH3      0x04U
+#define COMP_PROTECT_CLEAR_CH4      0x08U
+
+/* Comparator output levels, the HAL names differ between families */
+#if defined(COMP_OUTPUT_LEVEL_HIGH)
+#define COMP_PROTECT_LEVEL_LOW      COMP_OUTPUT_LEVEL_LOW
+#define COMP_PROTECT_LEVEL_HIGH     COMP_OUTPUT_LEVEL_HIGH
+#else
+#define COMP_PROTECT_LEVEL_LOW      COMP_OUTPUTLEVEL_LOW
+#define COMP_PROTECT_LEVEL_HIGH     COMP_OUTPUTLEVEL_HIGH
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  COMP_HandleTypeDef        *hcomp;             /* Initialized, inverting input on the DAC channel
+                                                   or a fixed reference                           */
+  DAC_HandleTypeDef         *hdac;              /* Threshold DAC, NULL for a fixed reference      */
+  uint32_t                  DacChannel;         /* DAC_CHANNEL_x                                  */
+  uint32_t                  Threshold;          /* DAC code, 12 bits right aligned                */
+  uint32_t                  TripLevel;          /* COMP_PROTECT_LEVEL_x of the output in fault    */
+  uint32_t                  BreakInput;         /* TIM_BREAKINPUT_BRK or _BRK2 fed by the output,
+                                                   0 when routed by the COMP initialization       */
+  uint32_t                  BreakSource;        /* TIM_BREAKINPUTSOURCE_COMPx of BreakInput       */
+} COMP_Protect_SenseTypeDef;
+
+typedef struct
+{
+  COMP_Protect_SenseTypeDef Sense[COMP_PROTECT_MAX_SENSE];
+  uint32_t                  NbSense;
+  TIM_HandleTypeDef         *htim;              /* Power stage timer, break and dead time set here */
+  TIM_BreakDeadTimeConfigTypeDef Break;         /* AutomaticOutput is set from Policy             */
+  uint32_t                  ClearChannels;      /* COMP_PROTECT_CLEAR_CHx cleared by the OCREF_CLR
+                                                   input, 0 for none                              */
+  TIM_ClearInputConfigTypeDef Clear;            /* OCREF_CLR source, ClearInputState is set here  */
+  TIM_HandleTypeDef         *htimLog;           /* Free running timer capturing the trips, NULL
+                                                   for no event log                               */
+  uint32_t                  LogChannel;         /* TIM_CHANNEL_x, input on a comparator output    */
+  uint32_t                  *pLog;              /* Circular DMA ring of the capture timestamps    */
+  uint32_t                  LogLength;          /* Entries, 65535 at most                         */
+  uint32_t                  Policy;             /* COMP_PROTECT_POLICY_x                          */
+  uint32_t                  RetryDelay;         /* ms from the trip to the retry                  */
+  uint32_t                  RetryMax;           /* Trips in RetryWindow before the lockout, 0 for
+                                                   no lockout                                     */
+  uint32_t                  RetryWindow;        /* ms                                             */
+} COMP_Protect_ConfigTypeDef;
+
+typedef struct
+{
+  COMP_Protect_ConfigTypeDef Config;
+  uint32_t                  State;              /* COMP_PROTECT_STATE_x                           */
+  uint32_t                  TripTick;           /* HAL_GetTick() of the last trip                 */
+  uint32_t                  WindowTick;         /* Start of the retry window                      */
+  uint32_t                  WindowTrips;        /* Trips in the retry window                      */
+  uint32_t                  Trips;              /* Break flags seen                               */
+  uint32_t                  Retries;            /* Outputs enabled again by the RETRY policy      */
+  uint32_t                  Lockouts;
+  uint32_t                  LogRead;            /* Next log entry to read                         */
+  uint32_t                  Events;             /* Log entries read                               */
+} COMP_ProtectTypeDef;
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef COMP_Protect_Init(COMP_ProtectTypeDef *pProt, const COMP_Protect_ConfigTypeDef *pConfig);
+HAL_StatusTypeDef COMP_Protect_Start(COMP_ProtectTypeDef *pProt);
+HAL_StatusTypeDef COMP_Protect_Stop(COMP_ProtectTypeDef *pProt);
+HAL_StatusTypeDef COMP_Protect_SetThreshold(COMP_ProtectTypeDef *pProt, uint32_t Sense, uint32_t Threshold);
+HAL_StatusTypeDef COMP_Protect_Rearm(COMP_ProtectTypeDef *pProt);
+uint32_t          COMP_Protect_Process(COMP_ProtectTypeDef *pProt);
+uint32_t          COMP_Protect_IsReleased(COMP_ProtectTypeDef *pProt);
+
+void COMP_Protect_EventCallback(COMP_ProtectTypeDef *pProt, uint32_t Timestamp);
+void COMP_Protect_LockoutCallback(COMP_ProtectTypeDef *pProt);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _COMP_PROTECT_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,332 @@
+/**
+  ******************************************************************************
+  * @file    d3_logger.c
+  * @author  MCD Application Team
+  * @brief   Autonomous D3 domain acquisition: an LPTIM paced BDMA ring in
+  *          SRAM4 keeps capturing while the D1 domain is stopped.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- initialize the source, a D3 peripheral: ADC3 triggered by the LPTIM
+   output in DMA circular mode, LPUART1 or SPI6 receiving with their DMA
+   request enabled, or any register (a GPIO input register...) read on the
+   DMAMUX2 request generator. Initialize a BDMA channel with HAL_DMA_Init():
+   circular, peripheral to memory, memory increment, Request the peripheral
+   request or BDMA_REQUEST_GENERATORx, and call HAL_DMA_IRQHandler() from
+   its BDMA_ChannelX_IRQHandler(): the module sets the DMA callbacks itself.
+   The ring must be in SRAM4, the only RAM the BDMA reaches, e.g. from
+   DMA_Pool_Alloc(DMA_POOL_RAM_D3, ...).
+
+2- with hlptim, initialize LPTIM2/3 (or LPTIM4/5 as ADC3 trigger) with
+   HAL_LPTIM_Init(), clocked by the LSE or the LSI so that it runs with
+   the D1 domain stopped: D3_Logger_Start() starts its PWM output with
+   Period, which paces the ADC3 conversions or the request generator
+   (SignalID HAL_DMAMUX2_REQ_GEN_LPTIMx_OUT, one BDMA request per period).
+
+3- D3_Logger_Init() enables the D3 autonomous mode of the BDMA, SRAM4 and
+   the Autonomous peripherals (RCC D3AMR) and keeps the D3 domain running
+   when the CPU stops (HAL_PWREx_ConfigD3Domain(PWR_D3_DOMAIN_RUN)).
+
+4- D3_Logger_Sleep() from the idle loop stops the D1 domain with SysTick
+   suspended. The D3 domain keeps the system clock running, so nothing has
+   to be restored on wake-up. Only the BDMA interrupts, once per half ring
+   of Length items, wake the CPU: D3_Logger_BlockCallback() gets the half
+   just filled, its D-cache lines dropped, and must be done with it before
+   the BDMA comes back to it.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "d3_logger.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define D3_LOGGER_SRAM4_SIZE     0x10000U
+
+/* Private macro -------------------------------------------------------------*/
+#define D3_LOGGER_IS_BDMA(__INSTANCE__) (((uint32_t)(__INSTANCE__) >= (uint32_t)BDMA_Channel0) && \
+                                         ((uint32_t)(__INSTANCE__) <= (uint32_t)BDMA_Channel7))
+
+#define D3_LOGGER_IS_GENERATOR(__REQUEST__) (((__REQUEST__) >= BDMA_REQUEST_GENERATOR0) && \
+                                             ((__REQUEST__) <= BDMA_REQUEST_GENERATOR7))
+
+/* Private variables ---------------------------------------------------------*/
+static D3_LoggerTypeDef *D3Logger;
+
+/* Private function prototypes -----------------------------------------------*/
+static void D3_Logger_Process(D3_LoggerTypeDef *pLog, uint32_t Half);
+static void D3_Logger_DMAHalfCplt(DMA_HandleTypeDef *hdma);
+static void D3_Logger_DMACplt(DMA_HandleTypeDef *hdma);
+static void D3_Logger_DMAError(DMA_HandleTypeDef *hdma);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Check the configuration and set up the D3 autonomous mode
+  * @param  pLog: logger context, kept by the module
+  * @param  pConfig: BDMA channel, ring and trigger, copied
+  * @retval HAL status
+  */
+HAL_StatusTypeDef D3_Logger_Init(D3_LoggerTypeDef *pLog, const D3_Logger_ConfigTypeDef *pConfig)
+{
+  DMA_HandleTypeDef *hdma = pConfig->hdma;
+  uint32_t ring = (uint32_t)pConfig->pRing;
+  uint32_t size;
+
+  if ((pLog == NULL) || (hdma == NULL) || !D3_LOGGER_IS_BDMA(hdma->Instance) ||
+      (hdma->Init.Mode != DMA_CIRCULAR) || (hdma->Init.Direction != DMA_PERIPH_TO_MEMORY) ||
+      (pConfig->Length == 0U) || ((2U * pConfig->Length) > 0xFFFFU) || ((ring & 31U) != 0U) ||
+      ((pConfig->hlptim != NULL) && (pConfig->Period == 0U)))
+  {
+    return HAL_ERROR;
+  }
+
+  switch (hdma->Init.MemDataAlignment)
+  {
+    case DMA_MDATAALIGN_BYTE:
+      size = 1U;
+      break;
+    case DMA_MDATAALIGN_HALFWORD:
+      size = 2U;
+      break;
+    default:
+      size = 4U;
+      break;
+  }
+
+  /* SRAM4 only */
+  if ((ring < D3_SRAM_BASE) || ((ring + (2U * pConfig->Length * size)) > (D3_SRAM_BASE + D3_LOGGER_SRAM4_SIZE)))
+  {
+    return HAL_ERROR;
+  }
+
+  pLog->Config = *pConfig;
+  pLog->ItemSize = size;
+  pLog->Blocks = 0U;
+  pLog->Overruns = 0U;
+  pLog->Errors = 0U;
+
+  RCC->D3AMR |= RCC_D3AMR_BDMAAMEN | RCC_D3AMR_SRAM4AMEN | pConfig->Autonomous;
+  HAL_PWREx_ConfigD3Domain(PWR_D3_DOMAIN_RUN);
+
+  D3Logger = pLog;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Start the BDMA ring, the request generator and the trigger LPTIM
+  * @param  pLog: logger context
+  * @retval HAL status
+  */
+HAL_StatusTypeDef D3_Logger_Start(D3_LoggerTypeDef *pLog)
+{
+  DMA_HandleTypeDef *hdma = pLog->Config.hdma;
+  HAL_DMA_MuxRequestGeneratorConfigTypeDef generator;
+
+  if (D3_LOGGER_IS_GENERATOR(hdma->Init.Request))
+  {
+    generator.SignalID = pLog->Config.SignalID;
+    generator.Polarity = HAL_DMAMUX_REQ_GEN_RISING;
+    generator.RequestNumber = 1U;
+    if (HAL_DMAEx_ConfigMuxRequestGenerator(hdma, &generator) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  hdma->XferHalfCpltCallback = D3_Logger_DMAHalfCplt;
+  hdma->XferCpltCallback = D3_Logger_DMACplt;
+  hdma->XferErrorCallback = D3_Logger_DMAError;
+  if (HAL_DMA_Start_IT(hdma, pLog->Config.PeriphAddress, (uint32_t)pLog->Config.pRing,
+                       2U * pLog->Config.Length) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  if (D3_LOGGER_IS_GENERATOR(hdma->Init.Request) && (HAL_DMAEx_EnableMuxRequestGenerator(hdma) != HAL_OK))
+  {
+    (void)HAL_DMA_Abort(hdma);
+    return HAL_ERROR;
+  }
+
+  if ((pLog->Config.hlptim != NULL) &&
+      (HAL_LPTIM_PWM_Start(pLog->Config.hlptim, pLog->Config.Period - 1U, (pLog->Config.Period - 1U) / 2U) != HAL_OK))
+  {
+    (void)D3_Logger_Stop(pLog);
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop the trigger LPTIM, the request generator and the BDMA ring
+  * @param  pLog: logger context
+  * @retval HAL status
+  */
+HAL_StatusTypeDef D3_Logger_Stop(D3_LoggerTypeDef *pLog)
+{
+  DMA_HandleTypeDef *hdma = pLog->Config.hdma;
+
+  if (pLog->Config.hlptim != NULL)
+  {
+    (void)HAL_LPTIM_PWM_Stop(pLog->Config.hlptim);
+  }
+  if (D3_LOGGER_IS_GENERATOR(hdma->Init.Request))
+  {
+    (void)HAL_DMAEx_DisableMuxRequestGenerator(hdma);
+  }
+
+  return HAL_DMA_Abort(hdma);
+}
+
+/**
+  * @brief  Stop the D1 domain until an interrupt, the D3 domain keeps running
+  * @retval None
+  */
+void D3_Logger_Sleep(void)
+{
+  HAL_SuspendTick();
+  HAL_PWREx_EnterSTOPMode(PWR_LOWPOWERREGULATOR_ON, PWR_STOPENTRY_WFI, PWR_D1_DOMAIN);
+  HAL_ResumeTick();
+}
+
+/**
+  * @brief  Half ring filled, runs in the BDMA interrupt
+  * @param  pLog: logger context
+  * @param  pBlock: Length items, valid until the BDMA comes back to them
+  * @param  Length: items in the block
+  * @retval None
+  */
+__weak void D3_Logger_BlockCallback(D3_LoggerTypeDef *pLog, const void *pBlock, uint32_t Length)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(pLog);
+  UNUSED(pBlock);
+  UNUSED(Length);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the D3_Logger_BlockCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  BDMA error, the acquisition has stopped
+  * @param  pLog: logger context
+  * @retval None
+  */
+__weak void D3_Logger_ErrorCallback(D3_LoggerTypeDef *pLog)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(pLog);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the D3_Logger_ErrorCallback could be implemented in the user file
+   */
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Deliver a half ring
+  * @param  pLog: logger context
+  * @param  Half: 0 first half, 1 second half
+  * @retval None
+  */
+static void D3_Logger_Process(D3_LoggerTypeDef *pLog, uint32_t Half)
+{
+  const uint32_t bytes = pLog->Config.Length * pLog->ItemSize;
+  uint8_t *pBlock = (uint8_t *)pLog->Config.pRing + (Half * bytes);
+  uint32_t remaining;
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if ((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    SCB_InvalidateDCache_by_Addr((uint32_t *)((uint32_t)pBlock & ~31U),
+                                 (int32_t)((bytes + ((uint32_t)pBlock & 31U) + 31U) & ~31U));
+  }
+#endif
+
+  pLog->Blocks++;
+  D3_Logger_BlockCallback(pLog, pBlock, pLog->Config.Length);
+
+  /* The BDMA must still be in the other half */
+  remaining = __HAL_DMA_GET_COUNTER(pLog->Config.hdma);
+  if ((Half == 0U) ? (remaining > pLog->Config.Length) : (remaining <= pLog->Config.Length))
+  {
+    pLog->Overruns++;
+  }
+}
+
+/**
+  * @brief  First half of the ring filled
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void D3_Logger_DMAHalfCplt(DMA_HandleTypeDef *hdma)
+{
+  if ((D3Logger != NULL) && (D3Logger->Config.hdma == hdma))
+  {
+    D3_Logger_Process(D3Logger, 0U);
+  }
+}
+
+/**
+  * @brief  Second half of the ring filled
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void D3_Logger_DMACplt(DMA_HandleTypeDef *hdma)
+{
+  if ((D3Logger != NULL) && (D3Logger->Config.hdma == hdma))
+  {
+    D3_Logger_Process(D3Logger, 1U);
+  }
+}
+
+/**
+  * @brief  BDMA error
+  * @param  hdma: DMA handle
+  * @retval None
+  */
+static void D3_Logger_DMAError(DMA_HandleTypeDef *hdma)
+{
+  if ((D3Logger != NULL) && (D3Logger->Config.hdma == hdma))
+  {
+    D3Logger->Errors++;
+    D3_Logger_ErrorCallback(D3Logger);
+  }
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,98 @@
+/**
+  ******************************************************************************
+  * @file    d3_logger.h
+  * @author  MCD Application Team
+  * @brief   Header for d3_logger module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _D3_LOGGER_H__
+#define _D3_LOGGER_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#if !defined(HAL_DMA_MODULE_ENABLED) || !defined(HAL_LPTIM_MODULE_ENABLED)
+#error "d3_logger requires the HAL DMA and LPTIM drivers"
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  DMA_HandleTypeDef   *hdma;          /* BDMA channel: HAL_DMA_Init() done, circular, peripheral
+                                         to memory, Request a D3 peripheral (BDMA_REQUEST_ADC3,
+                                         _LPUART1_RX, _SPI6_RX...) or BDMA_REQUEST_GENERATORx */
+  uint32_t            PeriphAddress;  /* Register read on each request                       */
+  void                *pRing;         /* DMA ring in SRAM4 (RAM_D3), 32-byte aligned,
+                                         2 * Length items                                    */
+  uint32_t            Length;         /* Items per half ring                                 */
+  LPTIM_HandleTypeDef *hlptim;        /* Trigger LPTIM (LPTIM2 to LPTIM5): HAL_LPTIM_Init()
+                                         done, clocked by LSE/LSI to run in D1 Stop,
+                                         NULL: the source paces itself                       */
+  uint32_t            Period;         /* LPTIM period, in LPTIM clock ticks                  */
+  uint32_t            SignalID;       /* HAL_DMAMUX2_REQ_GEN_xxx with BDMA_REQUEST_GENERATORx,
+                                         e.g. HAL_DMAMUX2_REQ_GEN_LPTIM2_OUT                  */
+  uint32_t            Autonomous;     /* RCC_D3AMR_xxxAMEN of the source and trigger
+                                         peripherals, BDMA and SRAM4 are always set          */
+} D3_Logger_ConfigTypeDef;
+
+typedef struct
+{
+  D3_Logger_ConfigTypeDef Config;
+  uint32_t            ItemSize;       /* Bytes per item                                      */
+  uint32_t            Blocks;         /* Half rings delivered                                */
+  uint32_t            Overruns;       /* Half rings rewritten by the BDMA while processed    */
+  uint32_t            Errors;         /* BDMA errors                                         */
+} D3_LoggerTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef D3_Logger_Init(D3_LoggerTypeDef *pLog, const D3_Logger_ConfigTypeDef *pConfig);
+HAL_StatusTypeDef D3_Logger_Start(D3_LoggerTypeDef *pLog);
+HAL_StatusTypeDef D3_Logger_Stop(D3_LoggerTypeDef *pLog);
+void              D3_Logger_Sleep(void);
+
+void D3_Logger_BlockCallback(D3_LoggerTypeDef *pLog, const void *pBlock, uint32_t Length);
+void D3_Logger_ErrorCallback(D3_LoggerTypeDef *pLog);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _D3_LOGGER_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
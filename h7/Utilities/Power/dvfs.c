@@ -0,0 +1,329 @@
+/**
+  ******************************************************************************
+  * @file    dvfs.c
+  * @author  MCD Application Team
+  * @brief   Dynamic voltage and frequency scaling: operating point changes
+  *          with the voltage scale, Flash latency and driver re-timing.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- describe each operating point in a DVFS_PointTypeDef, ex. 400 MHz on
+   PLL1 at PWR_REGULATOR_VOLTAGE_SCALE1 for the bursts and 64 MHz on the HSI
+   at PWR_REGULATOR_VOLTAGE_SCALE3, PLL1 off, when idle (race to idle).
+   Call DVFS_Init() with the point set by SystemClock_Config().
+
+2- register a DVFS_ClientTypeDef for each driver whose timing derives from
+   the bus clocks. DVFS_PrepareUart() and DVFS_RetimeUart() serve the UARTs,
+   pContext being the UART handle: the change waits for the end of the
+   transmission and the baud rate is computed again from the new clocks.
+
+3- DVFS_SetPoint(), from thread mode :
+      - calls every Prepare(), any refusal cancels the change
+      - raises the voltage scale first when the new point needs more
+      - moves the system clock to the HSI while PLL1 is configured again
+      - sets the system clock and prescalers with HAL_RCC_ClockConfig(),
+        which orders the Flash latency change around the frequency change
+        and sets the SysTick period again through HAL_InitTick()
+      - lowers the voltage scale last when the new point needs less
+      - calls every Retime() with the interrupts masked: no driver
+        interrupt sees half re-timed peripherals
+   The HSI must stay enabled for the PLL1 changes.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "dvfs.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static const DVFS_PointTypeDef  *DvfsPoint;
+static DVFS_ClientTypeDef       *DvfsClients;
+static DVFS_StatsTypeDef        DvfsStats;
+
+/* Private function prototypes -----------------------------------------------*/
+static HAL_StatusTypeDef DVFS_Switch(const DVFS_PointTypeDef *pPoint);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Record the operating point the clocks are set to
+  * @param  pCurrent: point configured by the application, kept by reference
+  * @retval HAL status
+  */
+HAL_StatusTypeDef DVFS_Init(const DVFS_PointTypeDef *pCurrent)
+{
+  if (pCurrent == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  DvfsPoint   = pCurrent;
+  DvfsClients = NULL;
+  memset(&DvfsStats, 0, sizeof(DvfsStats));
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Add a driver to the clients of the clock changes
+  * @param  pClient: client, kept by reference until unregistered
+  * @retval HAL status
+  */
+HAL_StatusTypeDef DVFS_Register(DVFS_ClientTypeDef *pClient)
+{
+  uint32_t primask;
+
+  if (pClient == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  pClient->pNext = DvfsClients;
+  DvfsClients    = pClient;
+  __set_PRIMASK(primask);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Remove a driver from the clients
+  * @param  pClient: client registered
+  * @retval None
+  */
+void DVFS_Unregister(DVFS_ClientTypeDef *pClient)
+{
+  DVFS_ClientTypeDef **ppLink;
+  uint32_t           primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  for(ppLink = &DvfsClients; *ppLink != NULL; ppLink = &(*ppLink)->pNext)
+  {
+    if (*ppLink == pClient)
+    {
+      *ppLink = pClient->pNext;
+      break;
+    }
+  }
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Change the operating point
+  * @note   Not to be called from an interrupt: the RCC and PWR timeouts use
+  *         HAL_GetTick().
+  * @param  pPoint: new point, kept by reference
+  * @retval HAL_OK, HAL_BUSY when a client refused, HAL_ERROR when the RCC
+  *         or PWR configuration failed
+  */
+HAL_StatusTypeDef DVFS_SetPoint(const DVFS_PointTypeDef *pPoint)
+{
+  DVFS_ClientTypeDef *pClient;
+  DVFS_ClientTypeDef *pRefused = NULL;
+  HAL_StatusTypeDef  status    = HAL_OK;
+  uint32_t           primask;
+
+  if ((pPoint == NULL) || (DvfsPoint == NULL))
+  {
+    return HAL_ERROR;
+  }
+  if (pPoint == DvfsPoint)
+  {
+    return HAL_OK;
+  }
+
+  for(pClient = DvfsClients; pClient != NULL; pClient = pClient->pNext)
+  {
+    if ((pClient->Prepare != NULL) && (pClient->Prepare(pClient, pPoint) != HAL_OK))
+    {
+      pRefused = pClient;
+      status   = HAL_BUSY;
+      break;
+    }
+  }
+
+  if (status == HAL_OK)
+  {
+    status = DVFS_Switch(pPoint);
+  }
+
+  /* The clients prepared resume, on the new clocks or on the previous ones */
+  primask = __get_PRIMASK();
+  __disable_irq();
+  for(pClient = DvfsClients; pClient != pRefused; pClient = pClient->pNext)
+  {
+    if (pClient->Retime != NULL)
+    {
+      pClient->Retime(pClient);
+    }
+  }
+  __set_PRIMASK(primask);
+
+  if (status == HAL_OK)
+  {
+    DvfsStats.Changes++;
+  }
+  else if (status == HAL_BUSY)
+  {
+    DvfsStats.Refusals++;
+  }
+  else
+  {
+    DvfsStats.Errors++;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Current operating point
+  * @retval Point given to DVFS_Init() or to the last successful DVFS_SetPoint()
+  */
+const DVFS_PointTypeDef *DVFS_GetPoint(void)
+{
+  return DvfsPoint;
+}
+
+/**
+  * @brief  Copy the statistics
+  * @param  pStats: destination
+  * @retval None
+  */
+void DVFS_GetStats(DVFS_StatsTypeDef *pStats)
+{
+  *pStats = DvfsStats;
+}
+
+#if defined(HAL_UART_MODULE_ENABLED)
+/**
+  * @brief  UART client: refuse the change while a transmission runs
+  * @param  pClient: client, pContext being the UART handle
+  * @param  pPoint: new point
+  * @retval HAL_OK, HAL_BUSY while transmitting
+  */
+HAL_StatusTypeDef DVFS_PrepareUart(DVFS_ClientTypeDef *pClient, const DVFS_PointTypeDef *pPoint)
+{
+  UART_HandleTypeDef *huart = (UART_HandleTypeDef *)pClient->pContext;
+
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(pPoint);
+
+  return (huart->gState == HAL_UART_STATE_READY) ? HAL_OK : HAL_BUSY;
+}
+
+/**
+  * @brief  UART client: baud rate computed again from the new kernel clock
+  * @note   A frame being received while the UART is disabled is lost.
+  * @param  pClient: client, pContext being the UART handle
+  * @retval None
+  */
+void DVFS_RetimeUart(DVFS_ClientTypeDef *pClient)
+{
+  UART_HandleTypeDef *huart = (UART_HandleTypeDef *)pClient->pContext;
+
+  __HAL_UART_DISABLE(huart);
+  (void)UART_SetConfig(huart);
+  __HAL_UART_ENABLE(huart);
+}
+#endif /* HAL_UART_MODULE_ENABLED */
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Set the voltage scale, PLL1 and system clock of a point
+  * @param  pPoint: new point
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef DVFS_Switch(const DVFS_PointTypeDef *pPoint)
+{
+  RCC_OscInitTypeDef osc;
+  RCC_ClkInitTypeDef clk;
+  uint32_t           vos = PWR->D3CR & PWR_D3CR_VOS;
+
+  /* Higher VOS values are higher voltages: up before the frequency */
+  if (pPoint->VoltageScaling > vos)
+  {
+    if (HAL_PWREx_ControlVoltageScaling(pPoint->VoltageScaling) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  if ((pPoint->Pll.PLLState != RCC_PLL_NONE) &&
+      (memcmp(&pPoint->Pll, &DvfsPoint->Pll, sizeof(RCC_PLLInitTypeDef)) != 0))
+  {
+    if (__HAL_RCC_GET_SYSCLK_SOURCE() == RCC_CFGR_SWS_PLL1)
+    {
+      /* PLL1 cannot be configured while it clocks the system */
+      clk.ClockType    = RCC_CLOCKTYPE_SYSCLK;
+      clk.SYSCLKSource = RCC_SYSCLKSOURCE_HSI;
+      if (HAL_RCC_ClockConfig(&clk, __HAL_FLASH_GET_LATENCY()) != HAL_OK)
+      {
+        return HAL_ERROR;
+      }
+    }
+
+    memset(&osc, 0, sizeof(osc));
+    osc.OscillatorType = RCC_OSCILLATORTYPE_NONE;
+    osc.PLL            = pPoint->Pll;
+    if (HAL_RCC_OscConfig(&osc) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  clk = pPoint->Clk;
+  if (HAL_RCC_ClockConfig(&clk, pPoint->FLatency) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+  DvfsPoint = pPoint;
+
+  /* Down after the frequency */
+  if (pPoint->VoltageScaling < vos)
+  {
+    if (HAL_PWREx_ControlVoltageScaling(pPoint->VoltageScaling) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  return HAL_OK;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
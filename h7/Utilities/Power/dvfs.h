@@ -0,0 +1,102 @@
+/**
+  ******************************************************************************
+  * @file    dvfs.h
+  * @author  MCD Application Team
+  * @brief   Header for dvfs module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _DVFS_H__
+#define _DVFS_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported types ------------------------------------------------------------*/
+/* Operating point: the system clock configuration, with the voltage scale
+   and the Flash latency it requires */
+typedef struct
+{
+  uint32_t            VoltageScaling;  /* PWR_REGULATOR_VOLTAGE_SCALEx                  */
+  uint32_t            FLatency;        /* FLASH_LATENCY_x at this VOS and frequency     */
+  RCC_PLLInitTypeDef  Pll;             /* PLL1, PLLState RCC_PLL_NONE leaves it as is   */
+  RCC_ClkInitTypeDef  Clk;             /* SYSCLK source and bus prescalers              */
+} DVFS_PointTypeDef;
+
+/* Driver following the clock changes */
+typedef struct __DVFS_ClientTypeDef
+{
+  /* Optional. Called before the change, stops the driver activity that
+     cannot go through it. Any status but HAL_OK refuses the change. */
+  HAL_StatusTypeDef             (*Prepare)(struct __DVFS_ClientTypeDef *pClient, const DVFS_PointTypeDef *pPoint);
+  /* Optional. Called with the interrupts masked once the clocks are set,
+     after a refused or failed change too: recomputes baud rates and
+     prescalers and resumes the activity. */
+  void                          (*Retime)(struct __DVFS_ClientTypeDef *pClient);
+  void                          *pContext;   /* Driver handle                  */
+  struct __DVFS_ClientTypeDef   *pNext;      /* Reserved for the module        */
+} DVFS_ClientTypeDef;
+
+typedef struct
+{
+  uint32_t  Changes;     /* Operating points set           */
+  uint32_t  Refusals;    /* Changes refused by a client    */
+  uint32_t  Errors;      /* Changes failed in the RCC/PWR  */
+} DVFS_StatsTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef        DVFS_Init(const DVFS_PointTypeDef *pCurrent);
+HAL_StatusTypeDef        DVFS_Register(DVFS_ClientTypeDef *pClient);
+void                     DVFS_Unregister(DVFS_ClientTypeDef *pClient);
+HAL_StatusTypeDef        DVFS_SetPoint(const DVFS_PointTypeDef *pPoint);
+const DVFS_PointTypeDef *DVFS_GetPoint(void);
+void                     DVFS_GetStats(DVFS_StatsTypeDef *pStats);
+
+#if defined(HAL_UART_MODULE_ENABLED)
+HAL_StatusTypeDef DVFS_PrepareUart(DVFS_ClientTypeDef *pClient, const DVFS_PointTypeDef *pPoint);
+void              DVFS_RetimeUart(DVFS_ClientTypeDef *pClient);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _DVFS_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
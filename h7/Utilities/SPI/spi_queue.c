@@ -0,0 +1,532 @@
+/**
+  ******************************************************************************
+  * @file    spi_queue.c
+  * @author  MCD Application Team
+  * @brief   SPI bus transaction queue: jobs of Tx/Rx segments with chip select
+  *          and mode handling, chained from the SPI interrupts over the HAL driver.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- initialize the SPI as master with HAL_SPI_Init(), link the Tx and Rx DMA
+   handles (optional) and call SPI_Queue_Init() with a SPI_QueueTypeDef per
+   instance. Call HAL_SPI_IRQHandler() and HAL_DMA_IRQHandler() from the SPI
+   and DMA interrupt handlers, all at the same preemption priority: this
+   module implements the HAL_SPI_TxCpltCallback(), HAL_SPI_RxCpltCallback(),
+   HAL_SPI_TxRxCpltCallback() and HAL_SPI_ErrorCallback() functions in its
+   place.
+
+2- a job addresses one device: its chip select pin, driven low for the whole
+   job and high after the last segment, its clock polarity, phase and
+   prescaler, and a list of segments sent back-to-back. The SPI is
+   reconfigured only when the mode or the prescaler differs from the
+   previous job. Use a GPIO chip select (NSS soft): the hardware NSS only
+   frames a whole job when it is made of a single segment.
+
+3- SPI_Queue_Submit() never waits: jobs of all the devices on the bus are
+   served in submission order, the next segment or job is started from the
+   completion interrupt of the previous one. Jobs may be submitted from
+   interrupts, callbacks included, e.g. a timer submitting periodic sensor
+   reads. The job and its segments stay untouched until Callback is called
+   from the interrupt, Status then holds the result.
+
+4- a segment with both buffers is full duplex, without Rx buffer transmit
+   only. A segment without Tx buffer is receive only: in full duplex master
+   mode the HAL clocks out the content of the Rx buffer, fill it with the
+   idle pattern the device expects (usually 0x00 or 0xFF).
+
+5- segments of SPI_QUEUE_DMA_THRESHOLD frames or more use the DMA when both
+   DMA handles are linked, shorter ones the SPI interrupts: a register read
+   of 2 bytes costs less than programming 2 DMA streams. DMA buffers must be
+   in a RAM the DMA reaches (not the DTCM). With the data cache enabled the
+   Tx buffers are cleaned and the Rx buffers invalidated here: Rx buffers
+   must start on a cache line and fill whole lines (32 bytes).
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "spi_queue.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+#define SPI_QUEUE_CS_ASSERT(__JOB__)    ((__JOB__)->pCsPort->BSRRH = (__JOB__)->CsPin)
+#define SPI_QUEUE_CS_RELEASE(__JOB__)   ((__JOB__)->pCsPort->BSRRL = (__JOB__)->CsPin)
+
+/* Bytes of a segment, frames of up to 32 bits */
+#define SPI_QUEUE_BYTES(__HSPI__, __SIZE__)  ((uint32_t)(__SIZE__) *                                  \
+                                              (((__HSPI__)->Init.DataSize > SPI_DATASIZE_16BIT) ? 4U : \
+                                               ((__HSPI__)->Init.DataSize > SPI_DATASIZE_8BIT) ? 2U : 1U))
+
+/* Private variables ---------------------------------------------------------*/
+static SPI_QueueTypeDef *SpiQueues[SPI_QUEUE_INSTANCES];
+
+/* Private function prototypes -----------------------------------------------*/
+static SPI_QueueTypeDef *SPI_Queue_Find(SPI_HandleTypeDef *hspi);
+static void              SPI_Queue_Configure(SPI_HandleTypeDef *hspi, const SPI_Queue_JobTypeDef *pJob);
+static HAL_StatusTypeDef SPI_Queue_StartSegment(SPI_QueueTypeDef *pQueue);
+static void              SPI_Queue_Finish(SPI_QueueTypeDef *pQueue, HAL_StatusTypeDef Status);
+static void              SPI_Queue_Run(SPI_QueueTypeDef *pQueue);
+static void              SPI_Queue_Next(SPI_HandleTypeDef *hspi, HAL_StatusTypeDef Status);
+static void              SPI_Queue_CacheClean(const void *pData, uint32_t Size);
+static void              SPI_Queue_CacheInvalidate(void *pData, uint32_t Size);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Attach a queue to an initialized SPI instance
+  * @param  pQueue: queue context, kept by the module until SPI_Queue_DeInit()
+  * @param  hspi: SPI handle, HAL_SPI_Init() done in master mode
+  * @retval HAL status
+  */
+HAL_StatusTypeDef SPI_Queue_Init(SPI_QueueTypeDef *pQueue, SPI_HandleTypeDef *hspi)
+{
+  uint32_t i;
+  uint32_t slot = SPI_QUEUE_INSTANCES;
+
+  if ((pQueue == NULL) || (hspi == NULL) || (hspi->Init.Mode != SPI_MODE_MASTER))
+  {
+    return HAL_ERROR;
+  }
+
+  for (i = 0U; i < SPI_QUEUE_INSTANCES; i++)
+  {
+    if ((SpiQueues[i] != NULL) && (SpiQueues[i]->hspi == hspi))
+    {
+      return HAL_BUSY;
+    }
+    if ((SpiQueues[i] == NULL) && (slot == SPI_QUEUE_INSTANCES))
+    {
+      slot = i;
+    }
+  }
+  if (slot == SPI_QUEUE_INSTANCES)
+  {
+    return HAL_ERROR;
+  }
+
+  memset(pQueue, 0, sizeof(SPI_QueueTypeDef));
+  pQueue->hspi = hspi;
+  SpiQueues[slot] = pQueue;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Detach a queue from its SPI instance
+  * @param  pQueue: queue context
+  * @retval HAL_BUSY while jobs are queued, HAL status otherwise
+  */
+HAL_StatusTypeDef SPI_Queue_DeInit(SPI_QueueTypeDef *pQueue)
+{
+  uint32_t i;
+
+  if (SPI_Queue_IsIdle(pQueue) == 0U)
+  {
+    return HAL_BUSY;
+  }
+
+  for (i = 0U; i < SPI_QUEUE_INSTANCES; i++)
+  {
+    if (SpiQueues[i] == pQueue)
+    {
+      SpiQueues[i] = NULL;
+      return HAL_OK;
+    }
+  }
+
+  return HAL_ERROR;
+}
+
+/**
+  * @brief  Queue a job, started at once when the bus is idle
+  * @param  pQueue: queue of the SPI instance the device is on
+  * @param  pJob: job, owned by the module until its Callback is called
+  * @retval HAL status
+  */
+HAL_StatusTypeDef SPI_Queue_Submit(SPI_QueueTypeDef *pQueue, SPI_Queue_JobTypeDef *pJob)
+{
+  uint32_t primask;
+  uint32_t start = 0U;
+  uint32_t i;
+
+  if ((pQueue == NULL) || (pQueue->hspi == NULL) || (pJob == NULL) ||
+      ((pJob->NbSegments != 0U) && (pJob->pSegments == NULL)))
+  {
+    return HAL_ERROR;
+  }
+  for (i = 0U; i < pJob->NbSegments; i++)
+  {
+    if ((pJob->pSegments[i].Size == 0U) ||
+        ((pJob->pSegments[i].pTx == NULL) && (pJob->pSegments[i].pRx == NULL)))
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  pJob->Status = HAL_BUSY;
+  pJob->pNext = NULL;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (pQueue->pTail != NULL)
+  {
+    pQueue->pTail->pNext = pJob;
+  }
+  else
+  {
+    pQueue->pHead = pJob;
+  }
+  pQueue->pTail = pJob;
+  if (pQueue->Running == 0U)
+  {
+    pQueue->Running = 1U;
+    start = 1U;
+  }
+  __set_PRIMASK(primask);
+
+  if (start != 0U)
+  {
+    SPI_Queue_Run(pQueue);
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Check that all the submitted jobs are done
+  * @param  pQueue: queue context
+  * @retval 1 when idle, 0 otherwise
+  */
+uint32_t SPI_Queue_IsIdle(SPI_QueueTypeDef *pQueue)
+{
+  return ((pQueue == NULL) || (pQueue->pHead == NULL)) ? 1U : 0U;
+}
+
+/**
+  * @brief  Tx Transfer completed callback, next segment or job
+  * @param  hspi: SPI handle
+  * @retval None
+  */
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+  SPI_Queue_Next(hspi, HAL_OK);
+}
+
+/**
+  * @brief  Rx Transfer completed callback, next segment or job
+  * @param  hspi: SPI handle
+  * @retval None
+  */
+void HAL_SPI_RxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+  SPI_Queue_Next(hspi, HAL_OK);
+}
+
+/**
+  * @brief  Tx and Rx Transfer completed callback, next segment or job
+  * @param  hspi: SPI handle
+  * @retval None
+  */
+void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+  SPI_Queue_Next(hspi, HAL_OK);
+}
+
+/**
+  * @brief  SPI error callback, the job in progress ends with HAL_ERROR
+  * @param  hspi: SPI handle
+  * @retval None
+  */
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi)
+{
+  SPI_Queue_Next(hspi, HAL_ERROR);
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Queue attached to a SPI handle
+  * @param  hspi: SPI handle
+  * @retval Queue, NULL if none
+  */
+static SPI_QueueTypeDef *SPI_Queue_Find(SPI_HandleTypeDef *hspi)
+{
+  uint32_t i;
+
+  for (i = 0U; i < SPI_QUEUE_INSTANCES; i++)
+  {
+    if ((SpiQueues[i] != NULL) && (SpiQueues[i]->hspi == hspi))
+    {
+      return SpiQueues[i];
+    }
+  }
+
+  return NULL;
+}
+
+/**
+  * @brief  Apply the clock mode and prescaler of a job when they differ from
+  *         the current ones. The SPI is idle here.
+  * @param  hspi: SPI handle
+  * @param  pJob: job about to start
+  * @retval None
+  */
+static void SPI_Queue_Configure(SPI_HandleTypeDef *hspi, const SPI_Queue_JobTypeDef *pJob)
+{
+  if ((hspi->Init.CLKPolarity == pJob->CLKPolarity) &&
+      (hspi->Init.CLKPhase == pJob->CLKPhase) &&
+      (hspi->Init.BaudRatePrescaler == pJob->BaudRatePrescaler))
+  {
+    return;
+  }
+
+  __HAL_SPI_DISABLE(hspi);
+  MODIFY_REG(hspi->Instance->CFG1, SPI_CFG1_MBR, pJob->BaudRatePrescaler);
+  MODIFY_REG(hspi->Instance->CFG2, SPI_CFG2_CPOL | SPI_CFG2_CPHA, pJob->CLKPolarity | pJob->CLKPhase);
+
+  hspi->Init.CLKPolarity       = pJob->CLKPolarity;
+  hspi->Init.CLKPhase          = pJob->CLKPhase;
+  hspi->Init.BaudRatePrescaler = pJob->BaudRatePrescaler;
+}
+
+/**
+  * @brief  Start the current segment of the job at the head of the queue
+  * @param  pQueue: queue context
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef SPI_Queue_StartSegment(SPI_QueueTypeDef *pQueue)
+{
+  SPI_HandleTypeDef *hspi = pQueue->hspi;
+  const SPI_Queue_SegmentTypeDef *pSegment = &pQueue->pHead->pSegments[pQueue->Segment];
+  uint8_t *pTx = (uint8_t *)(uint32_t)pSegment->pTx;
+  uint32_t dma = ((hspi->hdmatx != NULL) && (hspi->hdmarx != NULL) &&
+                  (pSegment->Size >= SPI_QUEUE_DMA_THRESHOLD)) ? 1U : 0U;
+
+  if (dma != 0U)
+  {
+    if (pTx != NULL)
+    {
+      SPI_Queue_CacheClean(pTx, SPI_QUEUE_BYTES(hspi, pSegment->Size));
+    }
+    if (pSegment->pRx != NULL)
+    {
+      SPI_Queue_CacheInvalidate(pSegment->pRx, SPI_QUEUE_BYTES(hspi, pSegment->Size));
+    }
+  }
+
+  if ((pTx != NULL) && (pSegment->pRx != NULL))
+  {
+    return (dma != 0U) ? HAL_SPI_TransmitReceive_DMA(hspi, pTx, pSegment->pRx, pSegment->Size)
+                       : HAL_SPI_TransmitReceive_IT(hspi, pTx, pSegment->pRx, pSegment->Size);
+  }
+  if (pTx != NULL)
+  {
+    return (dma != 0U) ? HAL_SPI_Transmit_DMA(hspi, pTx, pSegment->Size)
+                       : HAL_SPI_Transmit_IT(hspi, pTx, pSegment->Size);
+  }
+  return (dma != 0U) ? HAL_SPI_Receive_DMA(hspi, pSegment->pRx, pSegment->Size)
+                     : HAL_SPI_Receive_IT(hspi, pSegment->pRx, pSegment->Size);
+}
+
+/**
+  * @brief  End the job at the head of the queue: release its chip select,
+  *         remove it and call its callback
+  * @param  pQueue: queue context
+  * @param  Status: job result
+  * @retval None
+  */
+static void SPI_Queue_Finish(SPI_QueueTypeDef *pQueue, HAL_StatusTypeDef Status)
+{
+  SPI_Queue_JobTypeDef *pJob = pQueue->pHead;
+  uint32_t primask;
+
+  if (pJob->pCsPort != NULL)
+  {
+    SPI_QUEUE_CS_RELEASE(pJob);
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  pQueue->pHead = pJob->pNext;
+  if (pQueue->pHead == NULL)
+  {
+    pQueue->pTail = NULL;
+  }
+  __set_PRIMASK(primask);
+
+  pQueue->Jobs++;
+  if (Status != HAL_OK)
+  {
+    pQueue->Errors++;
+  }
+
+  pJob->pNext = NULL;
+  pJob->Status = Status;
+  if (pJob->Callback != NULL)
+  {
+    pJob->Callback(pJob);
+  }
+}
+
+/**
+  * @brief  Start the job at the head of the queue. Jobs failing to start, or
+  *         without segments, are finished here. Called by the context owning
+  *         the Running flag, which is released once the queue is empty.
+  * @param  pQueue: queue context
+  * @retval None
+  */
+static void SPI_Queue_Run(SPI_QueueTypeDef *pQueue)
+{
+  SPI_Queue_JobTypeDef *pJob;
+  uint32_t primask;
+
+  for (;;)
+  {
+    primask = __get_PRIMASK();
+    __disable_irq();
+    pJob = pQueue->pHead;
+    if (pJob == NULL)
+    {
+      pQueue->Running = 0U;
+    }
+    __set_PRIMASK(primask);
+
+    if (pJob == NULL)
+    {
+      return;
+    }
+
+    SPI_Queue_Configure(pQueue->hspi, pJob);
+    if (pJob->pCsPort != NULL)
+    {
+      SPI_QUEUE_CS_ASSERT(pJob);
+    }
+
+    pQueue->Segment = 0U;
+    if (pJob->NbSegments == 0U)
+    {
+      SPI_Queue_Finish(pQueue, HAL_OK);
+    }
+    else if (SPI_Queue_StartSegment(pQueue) == HAL_OK)
+    {
+      return;
+    }
+    else
+    {
+      SPI_Queue_Finish(pQueue, HAL_ERROR);
+    }
+  }
+}
+
+/**
+  * @brief  Segment done: start the next segment of the job, or end the job
+  *         and start the next one
+  * @param  hspi: SPI handle
+  * @param  Status: segment result
+  * @retval None
+  */
+static void SPI_Queue_Next(SPI_HandleTypeDef *hspi, HAL_StatusTypeDef Status)
+{
+  SPI_QueueTypeDef *pQueue = SPI_Queue_Find(hspi);
+  const SPI_Queue_SegmentTypeDef *pSegment;
+
+  if ((pQueue == NULL) || (pQueue->pHead == NULL))
+  {
+    return;
+  }
+
+  if (Status == HAL_OK)
+  {
+    /* Lines fetched by speculative reads during the DMA transfer */
+    pSegment = &pQueue->pHead->pSegments[pQueue->Segment];
+    if ((pSegment->pRx != NULL) && (hspi->hdmarx != NULL) && (pSegment->Size >= SPI_QUEUE_DMA_THRESHOLD))
+    {
+      SPI_Queue_CacheInvalidate(pSegment->pRx, SPI_QUEUE_BYTES(hspi, pSegment->Size));
+    }
+
+    pQueue->Segment++;
+    if (pQueue->Segment < pQueue->pHead->NbSegments)
+    {
+      if (SPI_Queue_StartSegment(pQueue) == HAL_OK)
+      {
+        return;
+      }
+      Status = HAL_ERROR;
+    }
+  }
+
+  SPI_Queue_Finish(pQueue, Status);
+  SPI_Queue_Run(pQueue);
+}
+
+/**
+  * @brief  Write back the data cache lines of a DMA source buffer
+  * @param  pData: buffer
+  * @param  Size: size in bytes
+  * @retval None
+  */
+static void SPI_Queue_CacheClean(const void *pData, uint32_t Size)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if ((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    uint32_t start = (uint32_t)pData & ~31U;
+    SCB_CleanDCache_by_Addr((uint32_t *)start, (int32_t)(((uint32_t)pData + Size) - start));
+  }
+#else
+  UNUSED(pData);
+  UNUSED(Size);
+#endif
+}
+
+/**
+  * @brief  Drop the data cache lines of a DMA destination buffer
+  * @param  pData: buffer, cache line aligned
+  * @param  Size: size in bytes
+  * @retval None
+  */
+static void SPI_Queue_CacheInvalidate(void *pData, uint32_t Size)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if ((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    SCB_InvalidateDCache_by_Addr((uint32_t *)pData, (int32_t)Size);
+  }
+#else
+  UNUSED(pData);
+  UNUSED(Size);
+#endif
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
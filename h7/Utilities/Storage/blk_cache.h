@@ -0,0 +1,120 @@
+/**
+  ******************************************************************************
+  * @file    blk_cache.h
+  * @author  MCD Application Team
+  * @brief   Header for blk_cache module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _BLK_CACHE_H__
+#define _BLK_CACHE_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+  BLK_OK    = 0,
+  BLK_ERROR = -1
+} BLK_StatusTypeDef;
+
+/* Block device seen through the cache. All functions work on whole blocks
+   of BLK_CACHE_BLOCK_SIZE bytes and return BLK_OK on success. */
+typedef struct
+{
+  int8_t   (*Init)(void);
+  int8_t   (*Read)(uint8_t *pData, uint32_t BlockAdd, uint32_t NumOfBlocks);
+  int8_t   (*Write)(uint8_t *pData, uint32_t BlockAdd, uint32_t NumOfBlocks);
+  int8_t   (*Sync)(void);          /* Wait for the end of programming, may be NULL */
+  uint32_t (*GetBlockNbr)(void);
+} BLK_DeviceTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Size of one cached block: one SD/eMMC sector */
+#define BLK_CACHE_BLOCK_SIZE       512U
+
+/* Number of cached blocks. Override in main.h. */
+#if !defined(BLK_CACHE_LINES)
+#define BLK_CACHE_LINES            32U
+#endif
+
+/* Section of the block buffers, to be placed in SDRAM or AXI SRAM by the
+   linker script. Override in main.h. */
+#if !defined(BLK_CACHE_SECTION)
+#define BLK_CACHE_SECTION          ".blk_cache"
+#endif
+
+/* Transfers of at least this number of blocks go straight to the device.
+   Override in main.h. */
+#if !defined(BLK_CACHE_BYPASS_BLOCKS)
+#define BLK_CACHE_BYPASS_BLOCKS    8U
+#endif
+
+/* Delay in ms after which BLK_Cache_Process() writes a dirty block back,
+   0 disables the delayed write-back. Override in main.h. */
+#if !defined(BLK_CACHE_FLUSH_DELAY)
+#define BLK_CACHE_FLUSH_DELAY      1000U
+#endif
+
+/* Serialisation of the callers (USB MSC interrupt, application task).
+   Override in main.h, e.g. with an RTOS mutex. */
+#if !defined(BLK_CACHE_LOCK)
+#define BLK_CACHE_LOCK()
+#define BLK_CACHE_UNLOCK()
+#endif
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+int8_t   BLK_Cache_Init(const BLK_DeviceTypeDef *pDevice);
+int8_t   BLK_Cache_Read(uint8_t *pData, uint32_t BlockAdd, uint32_t NumOfBlocks);
+int8_t   BLK_Cache_Write(uint8_t *pData, uint32_t BlockAdd, uint32_t NumOfBlocks);
+int8_t   BLK_Cache_Flush(void);
+void     BLK_Cache_Invalidate(void);
+uint32_t BLK_Cache_GetBlockNbr(void);
+uint32_t BLK_Cache_GetDirtyCount(void);
+void     BLK_Cache_Process(void);
+int8_t   BLK_Cache_PowerFail(void);
+void     BLK_Cache_PowerRestore(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _BLK_CACHE_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,112 @@
+/**
+  ******************************************************************************
+  * @file    blk_crypt.h
+  * @author  MCD Application Team
+  * @brief   Header for blk_crypt module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _BLK_CRYPT_H__
+#define _BLK_CRYPT_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "blk_cache.h"
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+  BLK_CRYPT_MODE_NONE = 0U,  /* Key slot unused                                       */
+  BLK_CRYPT_MODE_XTS  = 1U,  /* AES-XTS (IEEE 1619), data unit of one block            */
+  BLK_CRYPT_MODE_CTR  = 2U   /* AES-CTR, counter block of the nonce and the block offset */
+} BLK_Crypt_ModeTypeDef;
+
+typedef struct
+{
+  BLK_Crypt_ModeTypeDef Mode;
+  uint32_t       FirstBlock;  /* First block ciphered with this key                      */
+  uint32_t       BlockNbr;    /* Blocks ciphered with this key                           */
+  const uint8_t *pKey;        /* CTR: KeySize bytes; XTS: data key then tweak key        */
+  uint32_t       KeySize;     /* Bytes of one key: 16 or 32, 24 also allowed with CTR    */
+  const uint8_t *pNonce;      /* CTR: 8 bytes unique to the volume, NULL for zeros       */
+} BLK_Crypt_KeyTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Key slots: volumes or partitions each ciphered with its own key. Override
+   in main.h. */
+#if !defined(BLK_CRYPT_KEYS)
+#define BLK_CRYPT_KEYS             2U
+#endif
+
+/* Blocks ciphered in one pass: two bounce buffers of this size let the
+   ciphering of a pass overlap the device transfer of the previous one.
+   Override in main.h. */
+#if !defined(BLK_CRYPT_CHUNK_BLOCKS)
+#define BLK_CRYPT_CHUNK_BLOCKS     8U
+#endif
+
+/* Section of the bounce buffers, reachable by the DMA of the device and of
+   the CRYP. Override in main.h. */
+#if !defined(BLK_CRYPT_SECTION)
+#define BLK_CRYPT_SECTION          BLK_CACHE_SECTION
+#endif
+
+/* 1 to cipher with the CRYP processor through crypto_stream, 0 for the
+   software AES. Defaults to the CRYP on the devices which have one.
+   Override in main.h. */
+#if !defined(BLK_CRYPT_USE_HW)
+#if defined(CRYP) && defined(HASH)
+#define BLK_CRYPT_USE_HW           1U
+#else
+#define BLK_CRYPT_USE_HW           0U
+#endif
+#endif
+
+/* Exported variables --------------------------------------------------------*/
+/* Lower device seen through the ciphering, to be given to BLK_Cache_Init() */
+extern const BLK_DeviceTypeDef BLK_Crypt_Device;
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+int8_t BLK_Crypt_Init(const BLK_DeviceTypeDef *pLower);
+int8_t BLK_Crypt_SetKey(uint32_t Slot, const BLK_Crypt_KeyTypeDef *pKey);
+void   BLK_Crypt_ClearKey(uint32_t Slot);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _BLK_CRYPT_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
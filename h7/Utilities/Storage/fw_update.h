@@ -0,0 +1,102 @@
+/**
+  ******************************************************************************
+  * @file    fw_update.h
+  * @author  MCD Application Team
+  * @brief   Header for fw_update module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _FW_UPDATE_H__
+#define _FW_UPDATE_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#if !defined(FLASH_OPTCR_SWAP_BANK)
+#error "fw_update requires a dual bank device"
+#endif
+#if !defined(HAL_CRC_MODULE_ENABLED)
+#error "fw_update requires the CRC HAL driver"
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+  FW_UPDATE_STATE_RESET   = 0U,  /* Not initialized                                */
+  FW_UPDATE_STATE_IDLE    = 1U,  /* No update on going                             */
+  FW_UPDATE_STATE_ERASE   = 2U,  /* Inactive bank being erased, chunks buffered    */
+  FW_UPDATE_STATE_PROGRAM = 3U,  /* Chunks being programmed                        */
+  FW_UPDATE_STATE_VERIFY  = 4U,  /* Image programmed, CRC being checked            */
+  FW_UPDATE_STATE_READY   = 5U,  /* Image valid, FW_Update_Activate() may be called */
+  FW_UPDATE_STATE_ERROR   = 6U   /* Erase, program or CRC error                    */
+} FW_Update_StateTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Chunk buffer, in bytes: absorbs the chunks received during the erase.
+   Override in main.h. */
+#if !defined(FW_UPDATE_BUFFER_SIZE)
+#define FW_UPDATE_BUFFER_SIZE   4096U
+#endif
+
+/* Bytes checked per FW_Update_Process() call. Override in main.h. */
+#if !defined(FW_UPDATE_VERIFY_STEP)
+#define FW_UPDATE_VERIFY_STEP   4096U
+#endif
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef      FW_Update_Init(void);
+HAL_StatusTypeDef      FW_Update_Begin(uint32_t ImageSize);
+HAL_StatusTypeDef      FW_Update_Write(const uint8_t *pData, uint32_t Size);
+HAL_StatusTypeDef      FW_Update_Finish(uint32_t Crc);
+HAL_StatusTypeDef      FW_Update_Process(void);
+HAL_StatusTypeDef      FW_Update_Activate(void);
+void                   FW_Update_Abort(void);
+FW_Update_StateTypeDef FW_Update_GetState(void);
+uint32_t               FW_Update_GetProgress(void);
+uint32_t               FW_Update_GetActiveBank(void);
+
+void FW_Update_FLASH_IRQHandler(void);
+
+void FW_Update_EndCallback(HAL_StatusTypeDef Status);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _FW_UPDATE_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
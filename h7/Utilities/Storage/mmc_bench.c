@@ -0,0 +1,344 @@
+/**
+  ******************************************************************************
+  * @file    mmc_bench.c
+  * @author  MCD Application Team
+  * @brief   eMMC throughput benchmark over the HAL MMC driver: multiple
+  *          block, reliable and packed writes and reads by the internal DMA,
+  *          in each bus speed mode of the card.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- bring the card up with HAL_MMC_Init() and set the bus width with
+   HAL_MMC_ConfigWideBusOperation(). The SDMMC interrupt must call
+   HAL_MMC_IRQHandler(): the transfers use the internal DMA.
+
+2- on the STM32H743I-EVAL the eMMC sits on the microSD connector, an eMMC
+   to microSD adapter, on SDMMC1 with a 4-bit bus. The level translator
+   switches the card I/O to 1.8 V, needed by HS200, once BSP_IO_Init() ran:
+      BSP_IO_WritePin(SD_LDO_SEL_PIN, BSP_IO_PIN_SET);
+   Set it before MMC_Bench_RunModes() reaches HAL_MMCEx_ConfigSpeedBusOperation()
+   with MMC_SPEED_MODE_HS200, the card stays at 3.3 V otherwise and the
+   HS200 pass fails. Feed the SDMMC kernel clock with 200 MHz (PLL1Q or
+   PLL2R) for the 200 MHz bus clock.
+
+3- pBuffer holds MMC_BENCH_BUFFER_SIZE(NumberOfBlocks) bytes, 32-byte
+   aligned, in a RAM the SDMMC1 IDMA reaches (AXI SRAM, not the DTCM).
+   The D-cache maintenance is done here.
+
+4- MMC_Bench_Run() measures the current mode: it writes NumberOfBlocks
+   blocks from BlockAdd, reads them back and checks them, then writes them
+   reliably, then in a packed write of MMC_BENCH_PACKED_ENTRIES entries.
+   The card content in the range is lost. MMC_Bench_RunModes() runs it in
+   each speed mode the card accepts, from the default one to HS200, and
+   leaves the card in the last of them.
+
+5- the times, taken on the DWT cycle counter, include the commands and the
+   card programming time, up to the card being back in transfer state: use
+   at least 1 MB per transfer so that they reflect the bus throughput.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "mmc_bench.h"
+
+/* Private typedef -----------------------------------------------------------*/
+typedef enum
+{
+  MMC_BENCH_WRITE    = 0U,
+  MMC_BENCH_READ     = 1U,
+  MMC_BENCH_RELIABLE = 2U,
+  MMC_BENCH_PACKED   = 3U
+} MMC_Bench_PassTypeDef;
+
+/* Private define ------------------------------------------------------------*/
+#define MMC_BENCH_BLOCK_SIZE     512U
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static HAL_StatusTypeDef MMC_Bench_Transfer(MMC_HandleTypeDef *hmmc, MMC_Bench_PassTypeDef Pass, uint32_t BlockAdd,
+                                            uint32_t NumberOfBlocks, uint8_t *pBuffer, uint32_t *pKBps);
+static HAL_StatusTypeDef MMC_Bench_Wait(MMC_HandleTypeDef *hmmc);
+static uint32_t          MMC_Bench_GetClock(MMC_HandleTypeDef *hmmc);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Measure the transfers in the current bus speed mode
+  * @param  hmmc: MMC handle, card initialized
+  * @param  BlockAdd: first block of the range used, its content is lost
+  * @param  NumberOfBlocks: blocks per transfer, MMC_BENCH_PACKED_ENTRIES
+  *         at least
+  * @param  pBuffer: MMC_BENCH_BUFFER_SIZE(NumberOfBlocks) bytes, 32-byte aligned
+  * @param  pResult: receives the throughputs, SpeedMode is left to the caller
+  * @retval HAL_ERROR when a transfer failed or data were read back wrong
+  */
+HAL_StatusTypeDef MMC_Bench_Run(MMC_HandleTypeDef *hmmc, uint32_t BlockAdd, uint32_t NumberOfBlocks,
+                                uint8_t *pBuffer, MMC_Bench_ResultTypeDef *pResult)
+{
+  uint32_t *pData = (uint32_t *)(pBuffer + MMC_BENCH_BLOCK_SIZE);
+  uint32_t words = (NumberOfBlocks * MMC_BENCH_BLOCK_SIZE) / 4U;
+  uint32_t errors = 0U;
+  uint32_t i;
+
+  if ((((uint32_t)pBuffer & 31U) != 0U) || (NumberOfBlocks < MMC_BENCH_PACKED_ENTRIES))
+  {
+    return HAL_ERROR;
+  }
+
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->LAR = 0xC5ACCE55U;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  pResult->Clock = MMC_Bench_GetClock(hmmc);
+  pResult->Size  = NumberOfBlocks * MMC_BENCH_BLOCK_SIZE;
+
+  /* Each word its index inverted, so a shifted or repeated block is seen */
+  for (i = 0U; i < words; i++)
+  {
+    pData[i] = ~(i + BlockAdd);
+  }
+
+  if (MMC_Bench_Transfer(hmmc, MMC_BENCH_WRITE, BlockAdd, NumberOfBlocks, pBuffer, &pResult->WriteKBps) != HAL_OK)
+  {
+    errors++;
+  }
+
+  for (i = 0U; i < words; i++)
+  {
+    pData[i] = 0U;
+  }
+  if (MMC_Bench_Transfer(hmmc, MMC_BENCH_READ, BlockAdd, NumberOfBlocks, pBuffer, &pResult->ReadKBps) != HAL_OK)
+  {
+    errors++;
+  }
+  for (i = 0U; i < words; i++)
+  {
+    errors += (pData[i] != ~(i + BlockAdd)) ? 1U : 0U;
+  }
+
+  if (MMC_Bench_Transfer(hmmc, MMC_BENCH_RELIABLE, BlockAdd, NumberOfBlocks, pBuffer, &pResult->ReliableKBps) != HAL_OK)
+  {
+    errors++;
+  }
+  if (MMC_Bench_Transfer(hmmc, MMC_BENCH_PACKED, BlockAdd, NumberOfBlocks, pBuffer, &pResult->PackedKBps) != HAL_OK)
+  {
+    errors++;
+  }
+
+  pResult->Errors = errors;
+  return (errors == 0U) ? HAL_OK : HAL_ERROR;
+}
+
+/**
+  * @brief  Run MMC_Bench_Run() in each bus speed mode the card accepts
+  * @param  hmmc: MMC handle, card initialized, bus width set
+  * @param  BlockAdd: first block of the range used, its content is lost
+  * @param  NumberOfBlocks: blocks per transfer
+  * @param  pBuffer: MMC_BENCH_BUFFER_SIZE(NumberOfBlocks) bytes, 32-byte aligned
+  * @param  pResults: receives one result per mode measured, 4 at most
+  * @param  pCount: receives the number of results
+  * @retval HAL_ERROR when a pass in a mode the card switched to failed
+  */
+HAL_StatusTypeDef MMC_Bench_RunModes(MMC_HandleTypeDef *hmmc, uint32_t BlockAdd, uint32_t NumberOfBlocks,
+                                     uint8_t *pBuffer, MMC_Bench_ResultTypeDef *pResults, uint32_t *pCount)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t mode;
+  uint32_t count = 0U;
+
+  for (mode = MMC_SPEED_MODE_DEFAULT; mode <= MMC_SPEED_MODE_HS200; mode++)
+  {
+    /* Modes the card or the bus does not support are skipped */
+    if (HAL_MMCEx_ConfigSpeedBusOperation(hmmc, mode) != HAL_OK)
+    {
+      continue;
+    }
+    pResults[count].SpeedMode = mode;
+    if (MMC_Bench_Run(hmmc, BlockAdd, NumberOfBlocks, pBuffer, &pResults[count]) != HAL_OK)
+    {
+      status = HAL_ERROR;
+    }
+    count++;
+  }
+
+  *pCount = count;
+  return (count != 0U) ? status : HAL_ERROR;
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Time one transfer, up to the card back in transfer state
+  * @param  hmmc: MMC handle
+  * @param  Pass: transfer to run
+  * @param  BlockAdd: first block
+  * @param  NumberOfBlocks: blocks transferred
+  * @param  pBuffer: packed header block followed by the data
+  * @param  pKBps: receives the throughput, 0 on error
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef MMC_Bench_Transfer(MMC_HandleTypeDef *hmmc, MMC_Bench_PassTypeDef Pass, uint32_t BlockAdd,
+                                            uint32_t NumberOfBlocks, uint8_t *pBuffer, uint32_t *pKBps)
+{
+  HAL_MMCEx_PackedEntryTypeDef entries[MMC_BENCH_PACKED_ENTRIES];
+  uint8_t *pData = pBuffer + MMC_BENCH_BLOCK_SIZE;
+  uint32_t size = NumberOfBlocks * MMC_BENCH_BLOCK_SIZE;
+  uint32_t chunk = NumberOfBlocks / MMC_BENCH_PACKED_ENTRIES;
+  HAL_StatusTypeDef status;
+  uint32_t cycles;
+  uint32_t start;
+  uint32_t i;
+
+  *pKBps = 0U;
+
+  if (Pass == MMC_BENCH_PACKED)
+  {
+    /* Entries in reverse address order, the last one takes the remainder */
+    for (i = 0U; i < MMC_BENCH_PACKED_ENTRIES; i++)
+    {
+      entries[i].BlockAdd       = BlockAdd + ((MMC_BENCH_PACKED_ENTRIES - 1U - i) * chunk);
+      entries[i].NumberOfBlocks = chunk;
+      entries[i].Reliable       = (uint32_t)DISABLE;
+    }
+    entries[0].NumberOfBlocks = NumberOfBlocks - ((MMC_BENCH_PACKED_ENTRIES - 1U) * chunk);
+  }
+
+  if ((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    if (Pass == MMC_BENCH_READ)
+    {
+      /* No dirty line left to be evicted over the received data */
+      SCB_CleanInvalidateDCache_by_Addr((uint32_t *)pData, (int32_t)size);
+    }
+    else
+    {
+      SCB_CleanDCache_by_Addr((uint32_t *)pData, (int32_t)size);
+    }
+  }
+
+  start = DWT->CYCCNT;
+  switch (Pass)
+  {
+    case MMC_BENCH_READ:
+      status = HAL_MMC_ReadBlocks_DMA(hmmc, pData, BlockAdd, NumberOfBlocks);
+      break;
+    case MMC_BENCH_RELIABLE:
+      status = HAL_MMCEx_WriteBlocksReliable_DMA(hmmc, pData, BlockAdd, NumberOfBlocks);
+      break;
+    case MMC_BENCH_PACKED:
+      /* The header is built and cleaned from the cache by the driver */
+      status = HAL_MMCEx_WritePacked_DMA(hmmc, pBuffer, entries, MMC_BENCH_PACKED_ENTRIES);
+      break;
+    default:
+      status = HAL_MMC_WriteBlocks_DMA(hmmc, pData, BlockAdd, NumberOfBlocks);
+      break;
+  }
+  if (status == HAL_OK)
+  {
+    status = MMC_Bench_Wait(hmmc);
+  }
+  cycles = DWT->CYCCNT - start;
+
+  if ((Pass == MMC_BENCH_READ) && ((SCB->CCR & SCB_CCR_DC_Msk) != 0U))
+  {
+    SCB_InvalidateDCache_by_Addr((uint32_t *)pData, (int32_t)size);
+  }
+
+  if ((status == HAL_OK) && (cycles != 0U))
+  {
+    *pKBps = (uint32_t)(((uint64_t)size * SystemCoreClock) / ((uint64_t)cycles * 1000U));
+  }
+  return status;
+}
+
+/**
+  * @brief  Wait for the end of the DMA transfer and of the card programming
+  * @param  hmmc: MMC handle
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef MMC_Bench_Wait(MMC_HandleTypeDef *hmmc)
+{
+  uint32_t tickstart = HAL_GetTick();
+
+  while (hmmc->State != HAL_MMC_STATE_READY)
+  {
+    if ((HAL_GetTick() - tickstart) >= MMC_BENCH_TIMEOUT)
+    {
+      (void)HAL_MMC_Abort(hmmc);
+      return HAL_TIMEOUT;
+    }
+  }
+  if (hmmc->ErrorCode != HAL_MMC_ERROR_NONE)
+  {
+    return HAL_ERROR;
+  }
+
+  while (HAL_MMC_GetCardState(hmmc) != HAL_MMC_CARD_TRANSFER)
+  {
+    if ((HAL_GetTick() - tickstart) >= MMC_BENCH_TIMEOUT)
+    {
+      return HAL_TIMEOUT;
+    }
+  }
+  return HAL_OK;
+}
+
+/**
+  * @brief  Bus clock set in the SDMMC
+  * @param  hmmc: MMC handle
+  * @retval Frequency in Hz
+  */
+static uint32_t MMC_Bench_GetClock(MMC_HandleTypeDef *hmmc)
+{
+  PLL1_ClocksTypeDef pll1_clocks;
+  PLL2_ClocksTypeDef pll2_clocks;
+  uint32_t kernel;
+  uint32_t div = hmmc->Instance->CLKCR & SDMMC_CLKCR_CLKDIV;
+
+  if (__HAL_RCC_GET_SDMMC_SOURCE() == RCC_SDMMCCLKSOURCE_PLL)
+  {
+    HAL_RCCEx_GetPLL1ClockFreq(&pll1_clocks);
+    kernel = pll1_clocks.PLL1_Q_Frequency;
+  }
+  else
+  {
+    HAL_RCCEx_GetPLL2ClockFreq(&pll2_clocks);
+    kernel = pll2_clocks.PLL2_R_Frequency;
+  }
+
+  return (div == 0U) ? kernel : (kernel / (2U * div));
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,94 @@
+/**
+  ******************************************************************************
+  * @file    mmc_bench.h
+  * @author  MCD Application Team
+  * @brief   Header for mmc_bench module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _MMC_BENCH_H__
+#define _MMC_BENCH_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#if !defined(HAL_MMC_MODULE_ENABLED)
+#error "mmc_bench requires the MMC HAL driver"
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t  SpeedMode;      /* MMC_SPEED_MODE_xxx the pass ran in                    */
+  uint32_t  Clock;          /* Bus clock, in Hz                                      */
+  uint32_t  Size;           /* Bytes per transfer                                    */
+  uint32_t  WriteKBps;      /* Multiple block write, CMD25 then CMD12, in KB/s       */
+  uint32_t  ReadKBps;       /* Multiple block read, CMD18 then CMD12, in KB/s        */
+  uint32_t  ReliableKBps;   /* Reliable write, CMD23 then CMD25, in KB/s             */
+  uint32_t  PackedKBps;     /* Packed write of MMC_BENCH_PACKED_ENTRIES, in KB/s     */
+  uint32_t  Errors;         /* Failed transfers and words read back different        */
+} MMC_Bench_ResultTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Writes gathered by the packed write pass. Override in main.h. */
+#if !defined(MMC_BENCH_PACKED_ENTRIES)
+#define MMC_BENCH_PACKED_ENTRIES     4U
+#endif
+
+/* Longest transfer, card programming included, in ms. Override in main.h. */
+#if !defined(MMC_BENCH_TIMEOUT)
+#define MMC_BENCH_TIMEOUT            5000U
+#endif
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Buffer size in bytes for transfers of __BLOCKS__ blocks: a packed header
+   block is added */
+#define MMC_BENCH_BUFFER_SIZE(__BLOCKS__)   (((__BLOCKS__) + 1U) * 512U)
+
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef MMC_Bench_Run(MMC_HandleTypeDef *hmmc, uint32_t BlockAdd, uint32_t NumberOfBlocks,
+                                uint8_t *pBuffer, MMC_Bench_ResultTypeDef *pResult);
+HAL_StatusTypeDef MMC_Bench_RunModes(MMC_HandleTypeDef *hmmc, uint32_t BlockAdd, uint32_t NumberOfBlocks,
+                                     uint8_t *pBuffer, MMC_Bench_ResultTypeDef *pResults, uint32_t *pCount);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _MMC_BENCH_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
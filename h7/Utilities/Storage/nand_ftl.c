@@ -0,0 +1,962 @@
+/**
+  ******************************************************************************
+  * @file    nand_ftl.c
+  * @author  MCD Application Team
+  * @brief   Log-structured flash translation layer for raw NAND on the FMC,
+  *          with hardware ECC, bad block management and garbage collection.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- initialize the NAND with HAL_NAND_Init(): Init.ECCPageSize must be the
+   page size of the device, the FMC ECC then covers whole pages and corrects
+   one bit error per page. Fill hnand->Config with the device geometry.
+
+2- in the linker script place the page mapping table in SDRAM or AXI SRAM :
+      .nand_ftl (NOLOAD) : { KEEP(*(.nand_ftl)) } >SDRAM
+   and size it in main.h with NAND_FTL_MAX_BLOCKS and NAND_FTL_BLOCK_PAGES.
+
+3- call NAND_FTL_Init(): the spare areas of all the pages are scanned to
+   rebuild the mapping. Call NAND_FTL_Format() once on a new device, or
+   when NAND_FTL_Init() fails.
+
+4- give NAND_FTL_Device to the block cache, whose interface the USB MSC
+   storage and the file system use :
+      BLK_Cache_Init(&NAND_FTL_Device);
+
+5- call NAND_FTL_Process() from the idle loop: blocks are reclaimed ahead of
+   the writes, which then do not wait for the garbage collection.
+
+Logical pages are never rewritten in place: each write programs the next
+free page of the active block and the page mapping table (one word per
+logical page) is updated. The 512-byte blocks of a partly written page are
+merged with its current content, the last page read or written is kept to
+make sequential accesses cheap. The spare area of each page holds its
+logical page number, a sequence number, the ECC of its data and a check
+word; byte 0 is left erased as it is the bad block marker.
+
+Blocks marked bad by the manufacturer are skipped. A block that fails to
+program is retired once its valid pages are moved out, a block that fails
+to erase is retired at once; both are then marked bad. NAND_FTL_RESERVED_BLOCKS
+blocks are kept out of the capacity for them and for the garbage collection,
+which reclaims the block holding the fewest valid pages. A page read with a
+corrected bit error is written again to a fresh page.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "nand_ftl.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define FTL_NONE              0xFFFFFFFFU
+
+#define FTL_BLOCK_FREE        0U        /* No data, erased when allocated       */
+#define FTL_BLOCK_USED        1U
+#define FTL_BLOCK_ACTIVE      2U        /* Pages being programmed               */
+#define FTL_BLOCK_RETIRED     3U        /* Program failed, to be moved out      */
+#define FTL_BLOCK_BAD         4U
+
+#define FTL_SPARE_MARKER      0U        /* Spare area layout, in bytes          */
+#define FTL_SPARE_LPN         4U
+#define FTL_SPARE_SEQ         8U
+#define FTL_SPARE_ECC         12U
+#define FTL_SPARE_CHECK       16U
+#define FTL_SPARE_USED        20U
+
+#define FTL_CHECK_KEY         0x4E465446U
+#define FTL_CORRECTED         1
+#define FTL_PROGRAM_TRIES     3U
+#define FTL_TIMEOUT           10U       /* ms, ECC and block erase              */
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static uint32_t FtlMap[NAND_FTL_MAX_BLOCKS * NAND_FTL_BLOCK_PAGES] __attribute__((section(NAND_FTL_SECTION)));
+static uint16_t FtlValid[NAND_FTL_MAX_BLOCKS];
+static uint8_t  FtlState[NAND_FTL_MAX_BLOCKS];
+static uint8_t  FtlPage[NAND_FTL_PAGE_SIZE] __attribute__((aligned(4)));
+static uint8_t  FtlGcPage[NAND_FTL_PAGE_SIZE] __attribute__((aligned(4)));
+static uint8_t  FtlSpare[NAND_FTL_SPARE_SIZE] __attribute__((aligned(4)));
+
+static NAND_HandleTypeDef *FtlNand = NULL;
+static uint32_t FtlMounted = 0U;
+static uint32_t FtlBlocks = 0U;
+static uint32_t FtlBlockPages = 0U;
+static uint32_t FtlPages = 0U;               /* Logical pages                    */
+static uint32_t FtlSectors = 0U;             /* Device blocks per page           */
+static uint32_t FtlEccBits = 0U;
+static uint32_t FtlPageLpn = FTL_NONE;       /* Logical page held by FtlPage     */
+static uint32_t FtlActive = FTL_NONE;
+static uint32_t FtlActivePage = 0U;
+static uint32_t FtlNextFree = 0U;
+static uint32_t FtlFree = 0U;
+static uint32_t FtlRetired = 0U;
+static uint32_t FtlSeq = 0U;
+static uint32_t FtlInGc = 0U;
+static NAND_FTL_StatsTypeDef FtlStats;
+
+/* Private function prototypes -----------------------------------------------*/
+static int8_t   NAND_FTL_DevInit(void);
+static int8_t   NAND_FTL_DevRead(uint8_t *pData, uint32_t BlockAdd, uint32_t NumOfBlocks);
+static int8_t   NAND_FTL_DevWrite(uint8_t *pData, uint32_t BlockAdd, uint32_t NumOfBlocks);
+static uint32_t NAND_FTL_DevGetBlockNbr(void);
+
+static HAL_StatusTypeDef NAND_FTL_Mount(void);
+static void     NAND_FTL_Address(uint32_t Ppn, NAND_AddressTypeDef *pAddress);
+static uint32_t NAND_FTL_Get32(uint32_t Offset);
+static void     NAND_FTL_Put32(uint32_t Offset, uint32_t Value);
+static int8_t   NAND_FTL_ReadSpare(uint32_t Ppn);
+static int8_t   NAND_FTL_ReadPage(uint32_t Ppn, uint8_t *pData);
+static int8_t   NAND_FTL_ProgramPage(uint32_t Ppn, uint32_t Lpn, uint8_t *pData);
+static int8_t   NAND_FTL_Correct(uint8_t *pData, uint32_t Stored, uint32_t Computed);
+static uint32_t NAND_FTL_IsFactoryBad(uint32_t Block);
+static int8_t   NAND_FTL_Erase(uint32_t Block);
+static void     NAND_FTL_MarkBad(uint32_t Block);
+static int8_t   NAND_FTL_Allocate(void);
+static uint32_t NAND_FTL_Victim(void);
+static int8_t   NAND_FTL_Collect(void);
+static int8_t   NAND_FTL_Program(uint32_t Lpn, uint8_t *pData);
+static int8_t   NAND_FTL_Load(uint32_t Lpn);
+
+const BLK_DeviceTypeDef NAND_FTL_Device =
+{
+  NAND_FTL_DevInit,
+  NAND_FTL_DevRead,
+  NAND_FTL_DevWrite,
+  NULL,
+  NAND_FTL_DevGetBlockNbr,
+};
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Check the NAND geometry and rebuild the mapping from the device
+  * @param  hnand: NAND handle initialized
+  * @retval HAL_ERROR when the geometry is not handled or the device is not
+  *         formatted
+  */
+HAL_StatusTypeDef NAND_FTL_Init(NAND_HandleTypeDef *hnand)
+{
+  NAND_DeviceConfigTypeDef *pConfig = &hnand->Config;
+  uint32_t eccsize;
+
+  FtlMounted = 0U;
+
+  eccsize = 256U << ((hnand->Init.ECCPageSize & FMC_PCR_ECCPS_Msk) >> FMC_PCR_ECCPS_Pos);
+  if ((pConfig->PageSize > NAND_FTL_PAGE_SIZE) || (pConfig->PageSize != eccsize) ||
+      ((pConfig->PageSize % BLK_CACHE_BLOCK_SIZE) != 0U) ||
+      (pConfig->SpareAreaSize < FTL_SPARE_USED) || (pConfig->SpareAreaSize > NAND_FTL_SPARE_SIZE) ||
+      (pConfig->BlockSize == 0U) || (pConfig->BlockSize > NAND_FTL_BLOCK_PAGES) ||
+      (pConfig->BlockNbr > NAND_FTL_MAX_BLOCKS) || (pConfig->BlockNbr <= (NAND_FTL_RESERVED_BLOCKS + 2U)) ||
+      (pConfig->PlaneSize == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  FtlNand       = hnand;
+  FtlBlocks     = pConfig->BlockNbr;
+  FtlBlockPages = pConfig->BlockSize;
+  FtlPages      = (FtlBlocks - NAND_FTL_RESERVED_BLOCKS) * FtlBlockPages;
+  FtlSectors    = pConfig->PageSize / BLK_CACHE_BLOCK_SIZE;
+  /* Hamming code: 2 bits per address bit of the page bits */
+  FtlEccBits    = 2U * (31U - __CLZ(pConfig->PageSize * 8U));
+
+  return NAND_FTL_Mount();
+}
+
+/**
+  * @brief  Erase all the blocks not marked bad, losing all the data
+  * @param  None
+  * @retval HAL status
+  */
+HAL_StatusTypeDef NAND_FTL_Format(void)
+{
+  uint32_t block;
+
+  if (FtlNand == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  for (block = 0U; block < FtlBlocks; block++)
+  {
+    if (NAND_FTL_IsFactoryBad(block) == 0U)
+    {
+      if (NAND_FTL_Erase(block) != BLK_OK)
+      {
+        NAND_FTL_MarkBad(block);
+      }
+    }
+  }
+
+  return NAND_FTL_Mount();
+}
+
+/**
+  * @brief  Reclaim one block when few are free or a block is to be retired
+  * @param  None
+  * @retval None
+  */
+void NAND_FTL_Process(void)
+{
+  BLK_CACHE_LOCK();
+
+  if ((FtlMounted != 0U) && ((FtlFree < NAND_FTL_GC_BLOCKS) || (FtlRetired != 0U)))
+  {
+    (void)NAND_FTL_Collect();
+  }
+
+  BLK_CACHE_UNLOCK();
+}
+
+/**
+  * @brief  Return the counters of the translation layer
+  * @param  pStats: receives the counters
+  * @retval None
+  */
+void NAND_FTL_GetStats(NAND_FTL_StatsTypeDef *pStats)
+{
+  *pStats = FtlStats;
+  pStats->FreeBlocks = FtlFree;
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Block device initialization, done by NAND_FTL_Init()
+  * @param  None
+  * @retval BLK_OK when the device is mounted
+  */
+static int8_t NAND_FTL_DevInit(void)
+{
+  return (FtlMounted != 0U) ? BLK_OK : BLK_ERROR;
+}
+
+/**
+  * @brief  Read blocks
+  * @param  pData: destination buffer
+  * @param  BlockAdd: first block
+  * @param  NumOfBlocks: number of blocks
+  * @retval BLK_OK or BLK_ERROR
+  */
+static int8_t NAND_FTL_DevRead(uint8_t *pData, uint32_t BlockAdd, uint32_t NumOfBlocks)
+{
+  uint32_t lpn;
+  uint32_t offset;
+  uint32_t count;
+
+  if ((FtlMounted == 0U) || (BlockAdd > NAND_FTL_DevGetBlockNbr()) ||
+      (NumOfBlocks > (NAND_FTL_DevGetBlockNbr() - BlockAdd)))
+  {
+    return BLK_ERROR;
+  }
+
+  while (NumOfBlocks != 0U)
+  {
+    lpn    = BlockAdd / FtlSectors;
+    offset = BlockAdd % FtlSectors;
+    count  = FtlSectors - offset;
+    if (count > NumOfBlocks)
+    {
+      count = NumOfBlocks;
+    }
+
+    if (NAND_FTL_Load(lpn) != BLK_OK)
+    {
+      return BLK_ERROR;
+    }
+    memcpy(pData, &FtlPage[offset * BLK_CACHE_BLOCK_SIZE], count * BLK_CACHE_BLOCK_SIZE);
+
+    pData       += count * BLK_CACHE_BLOCK_SIZE;
+    BlockAdd    += count;
+    NumOfBlocks -= count;
+  }
+
+  return BLK_OK;
+}
+
+/**
+  * @brief  Write blocks, each page written goes to a new location
+  * @param  pData: source buffer
+  * @param  BlockAdd: first block
+  * @param  NumOfBlocks: number of blocks
+  * @retval BLK_OK or BLK_ERROR
+  */
+static int8_t NAND_FTL_DevWrite(uint8_t *pData, uint32_t BlockAdd, uint32_t NumOfBlocks)
+{
+  uint32_t lpn;
+  uint32_t offset;
+  uint32_t count;
+
+  if ((FtlMounted == 0U) || (BlockAdd > NAND_FTL_DevGetBlockNbr()) ||
+      (NumOfBlocks > (NAND_FTL_DevGetBlockNbr() - BlockAdd)))
+  {
+    return BLK_ERROR;
+  }
+
+  while (NumOfBlocks != 0U)
+  {
+    lpn    = BlockAdd / FtlSectors;
+    offset = BlockAdd % FtlSectors;
+    count  = FtlSectors - offset;
+    if (count > NumOfBlocks)
+    {
+      count = NumOfBlocks;
+    }
+
+    /* Merge with the current content unless the whole page is written */
+    if (count != FtlSectors)
+    {
+      if (NAND_FTL_Load(lpn) != BLK_OK)
+      {
+        return BLK_ERROR;
+      }
+    }
+    memcpy(&FtlPage[offset * BLK_CACHE_BLOCK_SIZE], pData, count * BLK_CACHE_BLOCK_SIZE);
+    FtlPageLpn = lpn;
+
+    if (NAND_FTL_Program(lpn, FtlPage) != BLK_OK)
+    {
+      FtlPageLpn = FTL_NONE;
+      return BLK_ERROR;
+    }
+    FtlStats.Writes++;
+
+    pData       += count * BLK_CACHE_BLOCK_SIZE;
+    BlockAdd    += count;
+    NumOfBlocks -= count;
+  }
+
+  return BLK_OK;
+}
+
+/**
+  * @brief  Return the capacity
+  * @param  None
+  * @retval Number of blocks
+  */
+static uint32_t NAND_FTL_DevGetBlockNbr(void)
+{
+  return FtlPages * FtlSectors;
+}
+
+/**
+  * @brief  Rebuild the mapping table and the block states from the spare areas
+  * @param  None
+  * @retval HAL_ERROR when a page is mapped out of the capacity: the device
+  *         holds another format
+  */
+static HAL_StatusTypeDef NAND_FTL_Mount(void)
+{
+  uint32_t block;
+  uint32_t page;
+  uint32_t ppn;
+  uint32_t lpn;
+  uint32_t seq;
+  uint32_t old;
+
+  FtlMounted = 0U;
+  FtlPageLpn = FTL_NONE;
+  FtlActive  = FTL_NONE;
+  FtlFree    = 0U;
+  FtlRetired = 0U;
+  FtlSeq     = 0U;
+  FtlInGc    = 0U;
+  memset(&FtlStats, 0, sizeof(FtlStats));
+
+  for (lpn = 0U; lpn < FtlPages; lpn++)
+  {
+    FtlMap[lpn] = FTL_NONE;
+  }
+
+  for (block = 0U; block < FtlBlocks; block++)
+  {
+    FtlValid[block] = 0U;
+
+    if (NAND_FTL_IsFactoryBad(block) != 0U)
+    {
+      FtlState[block] = FTL_BLOCK_BAD;
+      FtlStats.BadBlocks++;
+      continue;
+    }
+
+    FtlState[block] = FTL_BLOCK_FREE;
+
+    /* Pages are programmed in order: stop at the first erased spare area */
+    for (page = 0U; page < FtlBlockPages; page++)
+    {
+      ppn = (block * FtlBlockPages) + page;
+      if (NAND_FTL_ReadSpare(ppn) != BLK_OK)
+      {
+        return HAL_ERROR;
+      }
+      lpn = NAND_FTL_Get32(FTL_SPARE_LPN);
+      if (lpn == FTL_NONE)
+      {
+        break;
+      }
+      FtlState[block] = FTL_BLOCK_USED;
+
+      seq = NAND_FTL_Get32(FTL_SPARE_SEQ);
+      if (NAND_FTL_Get32(FTL_SPARE_CHECK) != (lpn ^ seq ^ NAND_FTL_Get32(FTL_SPARE_ECC) ^ FTL_CHECK_KEY))
+      {
+        /* Program interrupted */
+        continue;
+      }
+      if (lpn >= FtlPages)
+      {
+        return HAL_ERROR;
+      }
+      if (seq >= FtlSeq)
+      {
+        FtlSeq = seq + 1U;
+      }
+
+      /* The latest copy of a logical page wins */
+      old = FtlMap[lpn];
+      if (old != FTL_NONE)
+      {
+        if ((NAND_FTL_ReadSpare(old) != BLK_OK) || (NAND_FTL_Get32(FTL_SPARE_SEQ) > seq))
+        {
+          continue;
+        }
+      }
+      FtlMap[lpn] = ppn;
+    }
+
+    if (FtlState[block] == FTL_BLOCK_FREE)
+    {
+      FtlFree++;
+    }
+  }
+
+  for (lpn = 0U; lpn < FtlPages; lpn++)
+  {
+    if (FtlMap[lpn] != FTL_NONE)
+    {
+      FtlValid[FtlMap[lpn] / FtlBlockPages]++;
+    }
+  }
+
+  FtlMounted = 1U;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Convert a physical page number to a NAND address
+  * @param  Ppn: physical page number
+  * @param  pAddress: receives the address
+  * @retval None
+  */
+static void NAND_FTL_Address(uint32_t Ppn, NAND_AddressTypeDef *pAddress)
+{
+  uint32_t block = Ppn / FtlBlockPages;
+
+  pAddress->Page  = (uint16_t)(Ppn % FtlBlockPages);
+  pAddress->Plane = (uint16_t)(block / FtlNand->Config.PlaneSize);
+  pAddress->Block = (uint16_t)(block % FtlNand->Config.PlaneSize);
+}
+
+/**
+  * @brief  Get a little endian word of the spare area buffer
+  * @param  Offset: offset in the spare area
+  * @retval Word
+  */
+static uint32_t NAND_FTL_Get32(uint32_t Offset)
+{
+  return (uint32_t)FtlSpare[Offset] | ((uint32_t)FtlSpare[Offset + 1U] << 8) |
+         ((uint32_t)FtlSpare[Offset + 2U] << 16) | ((uint32_t)FtlSpare[Offset + 3U] << 24);
+}
+
+/**
+  * @brief  Put a little endian word in the spare area buffer
+  * @param  Offset: offset in the spare area
+  * @param  Value: word
+  * @retval None
+  */
+static void NAND_FTL_Put32(uint32_t Offset, uint32_t Value)
+{
+  FtlSpare[Offset]      = (uint8_t)Value;
+  FtlSpare[Offset + 1U] = (uint8_t)(Value >> 8);
+  FtlSpare[Offset + 2U] = (uint8_t)(Value >> 16);
+  FtlSpare[Offset + 3U] = (uint8_t)(Value >> 24);
+}
+
+/**
+  * @brief  Read the spare area of a page in FtlSpare
+  * @param  Ppn: physical page number
+  * @retval BLK_OK or BLK_ERROR
+  */
+static int8_t NAND_FTL_ReadSpare(uint32_t Ppn)
+{
+  NAND_AddressTypeDef address;
+
+  NAND_FTL_Address(Ppn, &address);
+  return (HAL_NAND_Read_SpareArea_8b(FtlNand, &address, FtlSpare, 1U) == HAL_OK) ? BLK_OK : BLK_ERROR;
+}
+
+/**
+  * @brief  Read a page, check and correct it with the ECC of its spare area
+  * @param  Ppn: physical page number
+  * @param  pData: destination buffer
+  * @retval BLK_OK, FTL_CORRECTED or BLK_ERROR
+  */
+static int8_t NAND_FTL_ReadPage(uint32_t Ppn, uint8_t *pData)
+{
+  NAND_AddressTypeDef address;
+  uint32_t ecc = 0U;
+  int8_t   status;
+
+  NAND_FTL_Address(Ppn, &address);
+
+  /* Toggling ECCEN clears the ECC of the previous page */
+  (void)HAL_NAND_ECC_Disable(FtlNand);
+  (void)HAL_NAND_ECC_Enable(FtlNand);
+  if ((HAL_NAND_Read_Page_8b(FtlNand, &address, pData, 1U) != HAL_OK) ||
+      (HAL_NAND_GetECC(FtlNand, &ecc, FTL_TIMEOUT) != HAL_OK))
+  {
+    (void)HAL_NAND_ECC_Disable(FtlNand);
+    return BLK_ERROR;
+  }
+  (void)HAL_NAND_ECC_Disable(FtlNand);
+
+  if (NAND_FTL_ReadSpare(Ppn) != BLK_OK)
+  {
+    return BLK_ERROR;
+  }
+
+  status = NAND_FTL_Correct(pData, NAND_FTL_Get32(FTL_SPARE_ECC), ecc);
+  if (status == FTL_CORRECTED)
+  {
+    FtlStats.Corrected++;
+  }
+  else if (status != BLK_OK)
+  {
+    FtlStats.Uncorrectable++;
+  }
+  return status;
+}
+
+/**
+  * @brief  Program a page and its spare area
+  * @param  Ppn: physical page number, erased
+  * @param  Lpn: logical page number
+  * @param  pData: page data
+  * @retval BLK_OK or BLK_ERROR
+  */
+static int8_t NAND_FTL_ProgramPage(uint32_t Ppn, uint32_t Lpn, uint8_t *pData)
+{
+  NAND_AddressTypeDef address;
+  uint32_t ecc = 0U;
+
+  NAND_FTL_Address(Ppn, &address);
+
+  (void)HAL_NAND_ECC_Disable(FtlNand);
+  (void)HAL_NAND_ECC_Enable(FtlNand);
+  if ((HAL_NAND_Write_Page_8b(FtlNand, &address, pData, 1U) != HAL_OK) ||
+      (HAL_NAND_GetECC(FtlNand, &ecc, FTL_TIMEOUT) != HAL_OK))
+  {
+    (void)HAL_NAND_ECC_Disable(FtlNand);
+    return BLK_ERROR;
+  }
+  (void)HAL_NAND_ECC_Disable(FtlNand);
+
+  /* The spare area is programmed last: a page without it is ignored */
+  memset(FtlSpare, 0xFF, FtlNand->Config.SpareAreaSize);
+  NAND_FTL_Put32(FTL_SPARE_LPN, Lpn);
+  NAND_FTL_Put32(FTL_SPARE_SEQ, FtlSeq);
+  NAND_FTL_Put32(FTL_SPARE_ECC, ecc);
+  NAND_FTL_Put32(FTL_SPARE_CHECK, Lpn ^ FtlSeq ^ ecc ^ FTL_CHECK_KEY);
+  FtlSeq++;
+
+  return (HAL_NAND_Write_SpareArea_8b(FtlNand, &address, FtlSpare, 1U) == HAL_OK) ? BLK_OK : BLK_ERROR;
+}
+
+/**
+  * @brief  Correct a page from the ECC stored when programmed and the ECC
+  *         computed when read
+  * @param  pData: page data
+  * @param  Stored: ECC read from the spare area
+  * @param  Computed: ECC computed by the FMC
+  * @retval BLK_OK, FTL_CORRECTED or BLK_ERROR
+  */
+static int8_t NAND_FTL_Correct(uint8_t *pData, uint32_t Stored, uint32_t Computed)
+{
+  uint32_t mask = (FtlEccBits < 32U) ? ((1UL << FtlEccBits) - 1U) : 0xFFFFFFFFU;
+  uint32_t pairs = 0x55555555U & mask;
+  uint32_t syndrome = (Stored ^ Computed) & mask;
+  uint32_t position = 0U;
+  uint32_t i;
+
+  if (syndrome == 0U)
+  {
+    return BLK_OK;
+  }
+
+  /* A single data bit error flips one bit of each parity pair: the odd
+     bits give the position of the bit */
+  if (((syndrome ^ (syndrome >> 1)) & pairs) == pairs)
+  {
+    for (i = 0U; i < (FtlEccBits / 2U); i++)
+    {
+      position |= ((syndrome >> ((2U * i) + 1U)) & 1U) << i;
+    }
+    pData[position >> 3] ^= (uint8_t)(1U << (position & 7U));
+    return FTL_CORRECTED;
+  }
+
+  /* A single bit error in the stored ECC, the data is right */
+  if ((syndrome & (syndrome - 1U)) == 0U)
+  {
+    return FTL_CORRECTED;
+  }
+
+  return BLK_ERROR;
+}
+
+/**
+  * @brief  Check the bad block marker of the first two pages of a block
+  * @param  Block: block number
+  * @retval 1 when the block is marked bad
+  */
+static uint32_t NAND_FTL_IsFactoryBad(uint32_t Block)
+{
+  uint32_t page;
+
+  for (page = 0U; page < 2U; page++)
+  {
+    if ((NAND_FTL_ReadSpare((Block * FtlBlockPages) + page) != BLK_OK) || (FtlSpare[FTL_SPARE_MARKER] != 0xFFU))
+    {
+      return 1U;
+    }
+  }
+  return 0U;
+}
+
+/**
+  * @brief  Erase a block and wait for the result
+  * @param  Block: block number
+  * @retval BLK_OK or BLK_ERROR
+  */
+static int8_t NAND_FTL_Erase(uint32_t Block)
+{
+  NAND_AddressTypeDef address;
+  uint32_t tickstart;
+  uint32_t status;
+
+  NAND_FTL_Address(Block * FtlBlockPages, &address);
+  if (HAL_NAND_Erase_Block(FtlNand, &address) != HAL_OK)
+  {
+    return BLK_ERROR;
+  }
+
+  /* HAL_NAND_Erase_Block() does not wait for the end of the erase */
+  tickstart = HAL_GetTick();
+  while ((status = HAL_NAND_Read_Status(FtlNand)) == NAND_BUSY)
+  {
+    if ((HAL_GetTick() - tickstart) > FTL_TIMEOUT)
+    {
+      return BLK_ERROR;
+    }
+  }
+
+  return (status == NAND_READY) ? BLK_OK : BLK_ERROR;
+}
+
+/**
+  * @brief  Retire a block and write its bad block marker
+  * @param  Block: block number
+  * @retval None
+  */
+static void NAND_FTL_MarkBad(uint32_t Block)
+{
+  NAND_AddressTypeDef address;
+
+  FtlState[Block] = FTL_BLOCK_BAD;
+  FtlStats.BadBlocks++;
+
+  memset(FtlSpare, 0xFF, FtlNand->Config.SpareAreaSize);
+  FtlSpare[FTL_SPARE_MARKER] = 0x00U;
+  NAND_FTL_Address(Block * FtlBlockPages, &address);
+  (void)HAL_NAND_Write_SpareArea_8b(FtlNand, &address, FtlSpare, 1U);
+}
+
+/**
+  * @brief  Make an erased block the active one, reclaiming blocks first when
+  *         few are free
+  * @param  None
+  * @retval BLK_OK or BLK_ERROR when the device is full
+  */
+static int8_t NAND_FTL_Allocate(void)
+{
+  uint32_t block;
+  uint32_t i;
+
+  /* Keep one free block for the pages moved by the garbage collection */
+  for (i = 0U; (FtlInGc == 0U) && (FtlFree < 2U) && (i < FtlBlocks); i++)
+  {
+    if (NAND_FTL_Collect() != BLK_OK)
+    {
+      break;
+    }
+  }
+
+  /* The garbage collection may have opened a block with pages left */
+  if ((FtlActive != FTL_NONE) && (FtlActivePage < FtlBlockPages))
+  {
+    return BLK_OK;
+  }
+
+  if ((FtlActive != FTL_NONE) && (FtlState[FtlActive] == FTL_BLOCK_ACTIVE))
+  {
+    FtlState[FtlActive] = FTL_BLOCK_USED;
+  }
+  FtlActive = FTL_NONE;
+
+  /* Free blocks are taken in turn to spread the erase cycles */
+  for (i = 0U; (i < FtlBlocks) && (FtlFree != 0U); i++)
+  {
+    block = FtlNextFree;
+    FtlNextFree = (FtlNextFree + 1U) % FtlBlocks;
+
+    if (FtlState[block] != FTL_BLOCK_FREE)
+    {
+      continue;
+    }
+    FtlFree--;
+    if (NAND_FTL_Erase(block) != BLK_OK)
+    {
+      FtlStats.EraseErrors++;
+      NAND_FTL_MarkBad(block);
+      continue;
+    }
+
+    FtlState[block] = FTL_BLOCK_ACTIVE;
+    FtlValid[block] = 0U;
+    FtlActive       = block;
+    FtlActivePage   = 0U;
+    return BLK_OK;
+  }
+
+  return BLK_ERROR;
+}
+
+/**
+  * @brief  Select the block to reclaim: a retired block, else the used block
+  *         with the fewest valid pages
+  * @param  None
+  * @retval Block number, FTL_NONE when no block is worth reclaiming
+  */
+static uint32_t NAND_FTL_Victim(void)
+{
+  uint32_t victim = FTL_NONE;
+  uint32_t valid = FtlBlockPages;
+  uint32_t block;
+
+  for (block = 0U; block < FtlBlocks; block++)
+  {
+    if (FtlState[block] == FTL_BLOCK_RETIRED)
+    {
+      return block;
+    }
+    if ((FtlState[block] == FTL_BLOCK_USED) && (FtlValid[block] < valid))
+    {
+      victim = block;
+      valid  = FtlValid[block];
+    }
+  }
+  return victim;
+}
+
+/**
+  * @brief  Move the valid pages of the victim block and free it
+  * @param  None
+  * @retval BLK_OK or BLK_ERROR
+  */
+static int8_t NAND_FTL_Collect(void)
+{
+  uint32_t victim = NAND_FTL_Victim();
+  uint32_t page;
+  uint32_t ppn;
+  uint32_t lpn;
+  int8_t   status = BLK_OK;
+
+  if (victim == FTL_NONE)
+  {
+    return BLK_ERROR;
+  }
+
+  FtlInGc = 1U;
+
+  for (page = 0U; (page < FtlBlockPages) && (FtlValid[victim] != 0U); page++)
+  {
+    ppn = (victim * FtlBlockPages) + page;
+    if (NAND_FTL_ReadSpare(ppn) != BLK_OK)
+    {
+      status = BLK_ERROR;
+      break;
+    }
+    lpn = NAND_FTL_Get32(FTL_SPARE_LPN);
+    if ((lpn >= FtlPages) || (FtlMap[lpn] != ppn))
+    {
+      continue;
+    }
+
+    if (NAND_FTL_ReadPage(ppn, FtlGcPage) == BLK_ERROR)
+    {
+      /* Data lost: the logical page reads as erased from now on */
+      FtlMap[lpn] = FTL_NONE;
+      FtlValid[victim]--;
+      if (FtlPageLpn == lpn)
+      {
+        FtlPageLpn = FTL_NONE;
+      }
+      continue;
+    }
+    if (NAND_FTL_Program(lpn, FtlGcPage) != BLK_OK)
+    {
+      status = BLK_ERROR;
+      break;
+    }
+    FtlStats.Moves++;
+  }
+
+  if (status == BLK_OK)
+  {
+    if (FtlState[victim] == FTL_BLOCK_RETIRED)
+    {
+      FtlRetired--;
+      NAND_FTL_MarkBad(victim);
+    }
+    else
+    {
+      /* Erased when allocated */
+      FtlState[victim] = FTL_BLOCK_FREE;
+      FtlFree++;
+    }
+    FtlStats.Collections++;
+  }
+
+  FtlInGc = 0U;
+
+  return status;
+}
+
+/**
+  * @brief  Program a logical page to the next free page
+  * @param  Lpn: logical page number
+  * @param  pData: page data
+  * @retval BLK_OK or BLK_ERROR
+  */
+static int8_t NAND_FTL_Program(uint32_t Lpn, uint8_t *pData)
+{
+  uint32_t ppn;
+  uint32_t old;
+  uint32_t tries;
+
+  for (tries = 0U; tries < FTL_PROGRAM_TRIES; tries++)
+  {
+    if ((FtlActive == FTL_NONE) || (FtlActivePage == FtlBlockPages))
+    {
+      if (NAND_FTL_Allocate() != BLK_OK)
+      {
+        return BLK_ERROR;
+      }
+    }
+
+    ppn = (FtlActive * FtlBlockPages) + FtlActivePage;
+    FtlActivePage++;
+
+    if (NAND_FTL_ProgramPage(ppn, Lpn, pData) == BLK_OK)
+    {
+      old = FtlMap[Lpn];
+      if (old != FTL_NONE)
+      {
+        FtlValid[old / FtlBlockPages]--;
+      }
+      FtlMap[Lpn] = ppn;
+      FtlValid[FtlActive]++;
+      return BLK_OK;
+    }
+
+    /* Program failure: the block is retired once its valid pages are moved */
+    FtlStats.ProgramErrors++;
+    FtlState[FtlActive] = FTL_BLOCK_RETIRED;
+    FtlRetired++;
+    FtlActive = FTL_NONE;
+  }
+
+  return BLK_ERROR;
+}
+
+/**
+  * @brief  Get the content of a logical page in FtlPage
+  * @param  Lpn: logical page number
+  * @retval BLK_OK or BLK_ERROR
+  */
+static int8_t NAND_FTL_Load(uint32_t Lpn)
+{
+  int8_t status;
+
+  if (FtlPageLpn == Lpn)
+  {
+    return BLK_OK;
+  }
+  FtlPageLpn = FTL_NONE;
+
+  if (FtlMap[Lpn] == FTL_NONE)
+  {
+    memset(FtlPage, 0xFF, FtlNand->Config.PageSize);
+    FtlPageLpn = Lpn;
+    return BLK_OK;
+  }
+
+  status = NAND_FTL_ReadPage(FtlMap[Lpn], FtlPage);
+  if (status == BLK_ERROR)
+  {
+    return BLK_ERROR;
+  }
+  FtlPageLpn = Lpn;
+
+  /* Scrub: write the corrected page to a fresh one before more bits flip */
+  if (status == FTL_CORRECTED)
+  {
+    (void)NAND_FTL_Program(Lpn, FtlPage);
+  }
+
+  return BLK_OK;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
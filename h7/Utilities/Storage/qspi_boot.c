@@ -0,0 +1,646 @@
+/**
+  ******************************************************************************
+  * @file    qspi_boot.c
+  * @author  MCD Application Team
+  * @brief   Boot stage loading a segmented image from the memory mapped
+  *          QSPI memory: LZ4 segments staged by the MDMA and decompressed
+  *          into ITCM, AXI SRAM or SDRAM, XIP segments left in place
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- link the application with each output section at its execution address,
+   without AT> load address: hot code and data in ITCM, DTCM or AXI SRAM
+   (.itcm_text, .dtcm_data, .data), cold code and data in SDRAM, and what
+   is executed in place in the QSPI window, after the room of the image
+   header. Then build the image with OSQ/ldscripts/tpl/qspi_image.py :
+      python qspi_image.py firmware.elf firmware.qbi --base 0x90000000
+   Sections in the QSPI window are kept at their address (XIP segments),
+   the other ones are LZ4 compressed in blocks of QSPI_BOOT_BLOCK_SIZE,
+   or stored as is when that is not smaller (COPY segments). The startup
+   code of the application then finds its sections in place: its copy
+   loops copy them onto themselves and it zeroes its .bss as usual.
+
+2- the boot stage runs from the internal flash, with its stack, variables
+   and staging buffers in a RAM the image does not load, ex. the D2 SRAM :
+      .qspi_boot (NOLOAD) : { KEEP(*(.qspi_boot)) } >RAM_D2
+   It sets up the clocks, the SDRAM when the image loads into it, the
+   memory mapped mode of the QSPI memory (BSP_QSPI_Init(), then
+   BSP_QSPI_EnableMemoryMappedMode()) and an MDMA channel for memory to
+   memory transfers :
+      - Request MDMA_REQUEST_SW, TransferTriggerMode MDMA_FULL_TRANSFER
+      - SourceInc MDMA_SRC_INC_WORD, DestinationInc MDMA_DEST_INC_WORD
+      - SourceDataSize MDMA_SRC_DATASIZE_WORD, DestDataSize
+        MDMA_DEST_DATASIZE_WORD, DataAlignment MDMA_DATAALIGN_PACKENABLE
+      - BufferTransferLength 128, SourceBurst MDMA_SOURCE_BURST_SINGLE,
+        DestBurst MDMA_DEST_BURST_SINGLE
+
+3- QSPI_Boot_Load() checks the header and the segments of the image, then
+   loads them and returns the address of the vector table :
+      - the blocks of an LZ4 segment are staged by the MDMA from the memory
+        mapped region, the next block being read while the CPU decompresses
+        the current one into the segment
+      - a COPY segment is transferred by the MDMA to its address
+   With hmdma NULL, the CPU reads the memory mapped region directly.
+   Nothing is written before the whole segment table is checked.
+
+4- QSPI_Boot_Jump() masks and clears the interrupts, cleans the D-cache,
+   invalidates the I-cache and starts the application with the memory
+   mapped mode kept for its XIP segments. The SystemInit() of the
+   application must keep the clocks, the FMC and the QUADSPI set up by the
+   boot stage: the SDRAM refresh and the QSPI timings depend on them.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "qspi_boot.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Longest MDMA block transfer */
+#define BOOT_MDMA_MAX_LENGTH  65536U
+/* Size of the QSPI memory mapped region */
+#define BOOT_QSPI_WINDOW      0x10000000U
+
+/* LZ4 minimum match length */
+#define BOOT_LZ4_MIN_MATCH    4U
+
+/* Private macro -------------------------------------------------------------*/
+#define BOOT_ALIGN4(__SIZE__)   (((__SIZE__) + 3U) & ~3U)
+#define BOOT_ALIGN32(__SIZE__)  (((__SIZE__) + 31U) & ~31U)
+
+/* Private variables ---------------------------------------------------------*/
+static MDMA_HandleTypeDef     *BootMdma;
+static QSPI_Boot_StatsTypeDef  BootStats;
+
+/* Double buffer of the staged blocks */
+static uint8_t BootStage[2][BOOT_ALIGN32(QSPI_BOOT_BLOCK_SIZE)] __attribute__((section(QSPI_BOOT_SECTION), aligned(32)));
+
+/* Private function prototypes -----------------------------------------------*/
+static HAL_StatusTypeDef Boot_CheckSegment(const QSPI_Boot_SegmentTypeDef *pSegment, uint32_t ImageSize);
+static HAL_StatusTypeDef Boot_LoadCopy(const QSPI_Boot_SegmentTypeDef *pSegment, uint32_t Image);
+static HAL_StatusTypeDef Boot_LoadLz4(const QSPI_Boot_SegmentTypeDef *pSegment, uint32_t Image);
+static HAL_StatusTypeDef Boot_BlockHeader(uint32_t Address, uint32_t End, uint32_t *pHeader);
+static HAL_StatusTypeDef Boot_Lz4Block(const uint8_t *pIn, uint32_t Size, uint8_t *pBase, uint8_t **ppOut, uint8_t *pEnd);
+static uint32_t          Boot_Crc32(const uint8_t *pData, uint32_t Size);
+static void              Boot_CleanInvalidateCache(uint32_t Address, uint32_t Size);
+static void              Boot_InvalidateCache(uint32_t Address, uint32_t Size);
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Check and load an image from the memory mapped QSPI memory
+  * @param  ImageAddress: address of the image header in the memory mapped
+  *         region, 4-byte aligned
+  * @param  hmdma: MDMA handle initialized for software triggered memory to
+  *         memory transfers, or NULL to load with the CPU
+  * @param  pVectorTable: address of the vector table of the application
+  * @retval HAL status, HAL_ERROR on an invalid image
+  */
+HAL_StatusTypeDef QSPI_Boot_Load(uint32_t ImageAddress, MDMA_HandleTypeDef *hmdma, uint32_t *pVectorTable)
+{
+  const QSPI_Boot_HeaderTypeDef  *pHeader = (const QSPI_Boot_HeaderTypeDef *)ImageAddress;
+  const QSPI_Boot_SegmentTypeDef *pSegment = (const QSPI_Boot_SegmentTypeDef *)(ImageAddress + sizeof(QSPI_Boot_HeaderTypeDef));
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t start;
+  uint32_t i;
+
+  if((pVectorTable == NULL) || ((ImageAddress & 3U) != 0U))
+  {
+    return HAL_ERROR;
+  }
+  if((hmdma != NULL) &&
+     ((hmdma->Init.Request != MDMA_REQUEST_SW) || (hmdma->Init.TransferTriggerMode != MDMA_FULL_TRANSFER)))
+  {
+    return HAL_ERROR;
+  }
+
+  if((pHeader->Magic != QSPI_BOOT_MAGIC) ||
+     (pHeader->SegmentNbr == 0U) || (pHeader->SegmentNbr > QSPI_BOOT_MAX_SEGMENTS) ||
+     ((pHeader->VectorTable & 0x7FU) != 0U) ||
+     (Boot_Crc32((const uint8_t *)pSegment, pHeader->SegmentNbr * sizeof(QSPI_Boot_SegmentTypeDef)) != pHeader->Crc))
+  {
+    return HAL_ERROR;
+  }
+
+  for(i = 0U; i < pHeader->SegmentNbr; i++)
+  {
+    if(Boot_CheckSegment(&pSegment[i], pHeader->ImageSize) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  /* Enable the DWT cycle counter to time the load */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#if (__CORTEX_M == 7U)
+  DWT->LAR = 0xC5ACCE55U;
+#endif
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  memset(&BootStats, 0, sizeof(BootStats));
+  BootMdma = hmdma;
+  start = DWT->CYCCNT;
+
+  for(i = 0U; (i < pHeader->SegmentNbr) && (status == HAL_OK); i++)
+  {
+    switch(pSegment[i].Type)
+    {
+    case QSPI_BOOT_SEGMENT_COPY:
+      status = Boot_LoadCopy(&pSegment[i], ImageAddress);
+      break;
+
+    case QSPI_BOOT_SEGMENT_LZ4:
+      status = Boot_LoadLz4(&pSegment[i], ImageAddress);
+      break;
+
+    default:
+      /* Executed in place */
+      continue;
+    }
+    BootStats.Segments++;
+    BootStats.Stored += pSegment[i].Size;
+    BootStats.Loaded += pSegment[i].Length;
+  }
+
+  if((status != HAL_OK) && (BootMdma != NULL))
+  {
+    (void)HAL_MDMA_Abort(BootMdma);
+  }
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  /* Write back the decompressed code and data */
+  if((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    SCB_CleanDCache();
+  }
+#endif
+
+  BootStats.Cycles = DWT->CYCCNT - start;
+  if(status == HAL_OK)
+  {
+    *pVectorTable = pHeader->VectorTable;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Start a loaded application
+  * @note   Does not return. The QSPI memory stays memory mapped.
+  * @param  VectorTable: address of the vector table of the application
+  * @retval None
+  */
+void QSPI_Boot_Jump(uint32_t VectorTable)
+{
+  const uint32_t *pVectors = (const uint32_t *)VectorTable;
+  uint32_t i;
+
+  __disable_irq();
+
+  /* No interrupt of the boot stage may reach the application */
+  SysTick->CTRL = 0U;
+  for(i = 0U; i < (sizeof(NVIC->ICER) / sizeof(NVIC->ICER[0])); i++)
+  {
+    NVIC->ICER[i] = 0xFFFFFFFFU;
+    NVIC->ICPR[i] = 0xFFFFFFFFU;
+  }
+
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    SCB_CleanDCache();
+  }
+#endif
+#if defined(__ICACHE_PRESENT) && (__ICACHE_PRESENT == 1U)
+  if((SCB->CCR & SCB_CCR_IC_Msk) != 0U)
+  {
+    SCB_InvalidateICache();
+  }
+#endif
+
+  SCB->VTOR = VectorTable;
+  __DSB();
+  __ISB();
+
+  __set_MSP(pVectors[0]);
+  __enable_irq();
+  ((void (*)(void))pVectors[1])();
+
+  for(;;)
+  {
+  }
+}
+
+/**
+  * @brief  Get the statistics of the last QSPI_Boot_Load()
+  * @param  pStats: statistics
+  * @retval None
+  */
+void QSPI_Boot_GetStats(QSPI_Boot_StatsTypeDef *pStats)
+{
+  *pStats = BootStats;
+}
+
+/**
+  * @brief  Check a segment descriptor
+  * @param  pSegment: segment
+  * @param  ImageSize: bytes of the image
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef Boot_CheckSegment(const QSPI_Boot_SegmentTypeDef *pSegment, uint32_t ImageSize)
+{
+  uint32_t stage = (uint32_t)BootStage;
+
+  if(pSegment->Type == QSPI_BOOT_SEGMENT_XIP)
+  {
+    return HAL_OK;
+  }
+  if(((pSegment->Type != QSPI_BOOT_SEGMENT_COPY) && (pSegment->Type != QSPI_BOOT_SEGMENT_LZ4)) ||
+     ((pSegment->Offset & 3U) != 0U) || (pSegment->Size == 0U) || (pSegment->Length == 0U) ||
+     (pSegment->Offset > ImageSize) || (pSegment->Size > (ImageSize - pSegment->Offset)) ||
+     (pSegment->Address > (0xFFFFFFFFU - pSegment->Length)))
+  {
+    return HAL_ERROR;
+  }
+  if((pSegment->Type == QSPI_BOOT_SEGMENT_COPY) && (pSegment->Size != pSegment->Length))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Not into the QSPI memory nor the staging buffers */
+  if(((pSegment->Address + pSegment->Length) > QSPI_BASE) &&
+     (pSegment->Address < (QSPI_BASE + BOOT_QSPI_WINDOW)))
+  {
+    return HAL_ERROR;
+  }
+  if(((pSegment->Address + pSegment->Length) > stage) &&
+     (pSegment->Address < (stage + sizeof(BootStage))))
+  {
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Load a segment stored as is
+  * @param  pSegment: segment
+  * @param  Image: address of the image
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef Boot_LoadCopy(const QSPI_Boot_SegmentTypeDef *pSegment, uint32_t Image)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t source = Image + pSegment->Offset;
+  uint32_t address = pSegment->Address;
+  uint32_t remaining = pSegment->Length;
+  uint32_t size;
+
+  if((BootMdma != NULL) && ((address & 3U) == 0U) && (remaining >= 4U))
+  {
+    /* No dirty line may be written back over the transferred data */
+    Boot_CleanInvalidateCache(address, remaining & ~3U);
+
+    while((remaining >= 4U) && (status == HAL_OK))
+    {
+      size = remaining & ~3U;
+      if(size > BOOT_MDMA_MAX_LENGTH)
+      {
+        size = BOOT_MDMA_MAX_LENGTH;
+      }
+
+      status = HAL_MDMA_Start(BootMdma, source, address, size, 1U);
+      if(status == HAL_OK)
+      {
+        status = HAL_MDMA_PollForTransfer(BootMdma, HAL_MDMA_FULL_TRANSFER, QSPI_BOOT_MDMA_TIMEOUT);
+      }
+      source += size;
+      address += size;
+      remaining -= size;
+    }
+
+    Boot_InvalidateCache(pSegment->Address, pSegment->Length & ~3U);
+  }
+
+  if((status == HAL_OK) && (remaining != 0U))
+  {
+    memcpy((void *)address, (const void *)source, remaining);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Load an LZ4 compressed segment
+  * @note   The matches of a block may reach into the previous blocks of
+  *         the segment, decompressed in place.
+  * @param  pSegment: segment
+  * @param  Image: address of the image
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef Boot_LoadLz4(const QSPI_Boot_SegmentTypeDef *pSegment, uint32_t Image)
+{
+  HAL_StatusTypeDef status;
+  uint32_t source = Image + pSegment->Offset;
+  uint32_t end = source + pSegment->Size;
+  uint8_t *pBase = (uint8_t *)pSegment->Address;
+  uint8_t *pOut = pBase;
+  uint8_t *pEnd = pBase + pSegment->Length;
+  const uint8_t *pBlock;
+  uint32_t header = 0U;
+  uint32_t next = 0U;
+  uint32_t size;
+  uint32_t stage = 0U;
+
+  status = Boot_BlockHeader(source, end, &header);
+  if((status == HAL_OK) && (BootMdma != NULL))
+  {
+    status = HAL_MDMA_Start(BootMdma, source + 4U, (uint32_t)BootStage[0],
+                            BOOT_ALIGN4(header & ~QSPI_BOOT_BLOCK_RAW), 1U);
+  }
+
+  while((status == HAL_OK) && (source < end))
+  {
+    size = header & ~QSPI_BOOT_BLOCK_RAW;
+    pBlock = (const uint8_t *)(source + 4U);
+    source += 4U + BOOT_ALIGN4(size);
+
+    if(BootMdma != NULL)
+    {
+      status = HAL_MDMA_PollForTransfer(BootMdma, HAL_MDMA_FULL_TRANSFER, QSPI_BOOT_MDMA_TIMEOUT);
+      pBlock = BootStage[stage];
+      Boot_InvalidateCache((uint32_t)pBlock, BOOT_ALIGN32(size));
+
+      /* Stage the next block while this one is decompressed */
+      if((status == HAL_OK) && (source < end))
+      {
+        status = Boot_BlockHeader(source, end, &next);
+        if(status == HAL_OK)
+        {
+          status = HAL_MDMA_Start(BootMdma, source + 4U, (uint32_t)BootStage[stage ^ 1U],
+                                  BOOT_ALIGN4(next & ~QSPI_BOOT_BLOCK_RAW), 1U);
+        }
+      }
+      stage ^= 1U;
+    }
+    else if(source < end)
+    {
+      status = Boot_BlockHeader(source, end, &next);
+    }
+
+    if(status == HAL_OK)
+    {
+      if((header & QSPI_BOOT_BLOCK_RAW) != 0U)
+      {
+        if(size > (uint32_t)(pEnd - pOut))
+        {
+          status = HAL_ERROR;
+        }
+        else
+        {
+          memcpy(pOut, pBlock, size);
+          pOut += size;
+        }
+      }
+      else
+      {
+        status = Boot_Lz4Block(pBlock, size, pBase, &pOut, pEnd);
+      }
+    }
+    header = next;
+  }
+
+  if((status == HAL_OK) && (pOut != pEnd))
+  {
+    status = HAL_ERROR;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Read and check the header of a block
+  * @param  Address: address of the block header
+  * @param  End: end of the segment data
+  * @param  pHeader: block header
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef Boot_BlockHeader(uint32_t Address, uint32_t End, uint32_t *pHeader)
+{
+  uint32_t size;
+
+  if((End - Address) < 4U)
+  {
+    return HAL_ERROR;
+  }
+
+  *pHeader = *(const uint32_t *)Address;
+  size = *pHeader & ~QSPI_BOOT_BLOCK_RAW;
+  if((size == 0U) || (size > QSPI_BOOT_BLOCK_SIZE) || (BOOT_ALIGN4(size) > (End - Address - 4U)))
+  {
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Decompress an LZ4 block
+  * @param  pIn: compressed block
+  * @param  Size: bytes of the compressed block
+  * @param  pBase: start of the segment, the farthest a match may reach
+  * @param  ppOut: decompression pointer, updated
+  * @param  pEnd: end of the segment
+  * @retval HAL status, HAL_ERROR on a corrupted block
+  */
+static HAL_StatusTypeDef Boot_Lz4Block(const uint8_t *pIn, uint32_t Size, uint8_t *pBase, uint8_t **ppOut, uint8_t *pEnd)
+{
+  const uint8_t *pInEnd = pIn + Size;
+  const uint8_t *pMatch;
+  uint8_t *pOut = *ppOut;
+  uint32_t token;
+  uint32_t length;
+  uint32_t offset;
+  uint32_t byte;
+
+  while(pIn < pInEnd)
+  {
+    token = *pIn++;
+
+    /* Literals */
+    length = token >> 4;
+    if(length == 15U)
+    {
+      do
+      {
+        if(pIn >= pInEnd)
+        {
+          return HAL_ERROR;
+        }
+        byte = *pIn++;
+        length += byte;
+      } while(byte == 255U);
+    }
+    if((length > (uint32_t)(pInEnd - pIn)) || (length > (uint32_t)(pEnd - pOut)))
+    {
+      return HAL_ERROR;
+    }
+    memcpy(pOut, pIn, length);
+    pOut += length;
+    pIn += length;
+
+    /* The last sequence has no match */
+    if(pIn == pInEnd)
+    {
+      break;
+    }
+
+    /* Match */
+    if((pInEnd - pIn) < 2)
+    {
+      return HAL_ERROR;
+    }
+    offset = (uint32_t)pIn[0] | ((uint32_t)pIn[1] << 8);
+    pIn += 2;
+    if((offset == 0U) || (offset > (uint32_t)(pOut - pBase)))
+    {
+      return HAL_ERROR;
+    }
+
+    length = token & 15U;
+    if(length == 15U)
+    {
+      do
+      {
+        if(pIn >= pInEnd)
+        {
+          return HAL_ERROR;
+        }
+        byte = *pIn++;
+        length += byte;
+      } while(byte == 255U);
+    }
+    length += BOOT_LZ4_MIN_MATCH;
+    if(length > (uint32_t)(pEnd - pOut))
+    {
+      return HAL_ERROR;
+    }
+
+    pMatch = pOut - offset;
+    if(offset >= length)
+    {
+      memcpy(pOut, pMatch, length);
+      pOut += length;
+    }
+    else
+    {
+      /* Overlapping match: repeats the last offset bytes */
+      while(length-- != 0U)
+      {
+        *pOut++ = *pMatch++;
+      }
+    }
+  }
+
+  *ppOut = pOut;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  CRC-32 (zlib) of a buffer
+  * @param  pData: data
+  * @param  Size: number of bytes
+  * @retval CRC
+  */
+static uint32_t Boot_Crc32(const uint8_t *pData, uint32_t Size)
+{
+  uint32_t crc = 0xFFFFFFFFU;
+  uint32_t bit;
+
+  while(Size-- != 0U)
+  {
+    crc ^= *pData++;
+    for(bit = 0U; bit < 8U; bit++)
+    {
+      crc = (crc >> 1) ^ (0xEDB88320U & (0U - (crc & 1U)));
+    }
+  }
+
+  return ~crc;
+}
+
+/**
+  * @brief  Clean and invalidate the D-cache lines of an area
+  * @param  Address: start of the area
+  * @param  Size: number of bytes
+  * @retval None
+  */
+static void Boot_CleanInvalidateCache(uint32_t Address, uint32_t Size)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  uint32_t start = Address & ~31U;
+
+  if(((SCB->CCR & SCB_CCR_DC_Msk) != 0U) && (Size != 0U))
+  {
+    SCB_CleanInvalidateDCache_by_Addr((uint32_t *)start, (int32_t)((Address + Size) - start));
+  }
+#else
+  UNUSED(Address);
+  UNUSED(Size);
+#endif
+}
+
+/**
+  * @brief  Invalidate the D-cache lines of an area written by the MDMA
+  * @param  Address: start of the area
+  * @param  Size: number of bytes
+  * @retval None
+  */
+static void Boot_InvalidateCache(uint32_t Address, uint32_t Size)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  uint32_t start = Address & ~31U;
+
+  if(((SCB->CCR & SCB_CCR_DC_Msk) != 0U) && (Size != 0U))
+  {
+    SCB_InvalidateDCache_by_Addr((uint32_t *)start, (int32_t)((Address + Size) - start));
+  }
+#else
+  UNUSED(Address);
+  UNUSED(Size);
+#endif
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
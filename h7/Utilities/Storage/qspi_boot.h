@@ -0,0 +1,125 @@
+/**
+  ******************************************************************************
+  * @file    qspi_boot.h
+  * @author  MCD Application Team
+  * @brief   Header for qspi_boot module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _QSPI_BOOT_H__
+#define _QSPI_BOOT_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported constants --------------------------------------------------------*/
+/* Largest block of a compressed segment, before and after compression, as
+   given to qspi_image.py --block. Override in main.h. */
+#if !defined(QSPI_BOOT_BLOCK_SIZE)
+#define QSPI_BOOT_BLOCK_SIZE      4096U
+#endif
+
+/* Largest number of segments of an image. Override in main.h. */
+#if !defined(QSPI_BOOT_MAX_SEGMENTS)
+#define QSPI_BOOT_MAX_SEGMENTS    32U
+#endif
+
+/* Section of the staging buffers, in a RAM the image does not load and the
+   MDMA reaches: DTCM or D2 SRAM. Override in main.h. */
+#if !defined(QSPI_BOOT_SECTION)
+#define QSPI_BOOT_SECTION         ".qspi_boot"
+#endif
+
+/* Timeout of one MDMA transfer, in ms. Override in main.h. */
+#if !defined(QSPI_BOOT_MDMA_TIMEOUT)
+#define QSPI_BOOT_MDMA_TIMEOUT    100U
+#endif
+
+/* Image header magic, "QBI1" */
+#define QSPI_BOOT_MAGIC           0x31494251U
+
+/* Segment types */
+#define QSPI_BOOT_SEGMENT_XIP     0U  /* Executed in place, nothing to load   */
+#define QSPI_BOOT_SEGMENT_COPY    1U  /* Stored as is, copied                 */
+#define QSPI_BOOT_SEGMENT_LZ4     2U  /* LZ4 blocks, decompressed             */
+#define QSPI_BOOT_SEGMENT_ZERO    3U  /* Not stored, zeroed                   */
+
+/* Block header of a QSPI_BOOT_SEGMENT_LZ4 segment: stored size of the block,
+   with QSPI_BOOT_BLOCK_RAW when the block is stored uncompressed. Blocks
+   are 4-byte aligned in the image. */
+#define QSPI_BOOT_BLOCK_RAW       0x80000000U
+
+/* Exported types ------------------------------------------------------------*/
+/* Image header, followed by SegmentNbr segment descriptors */
+typedef struct
+{
+  uint32_t Magic;        /* QSPI_BOOT_MAGIC                                      */
+  uint32_t SegmentNbr;   /* Number of segments                                   */
+  uint32_t VectorTable;  /* Address of the application vector table, once loaded */
+  uint32_t ImageSize;    /* Bytes of the image, header included                  */
+  uint32_t Crc;          /* CRC-32 (zlib) of the segment descriptors             */
+} QSPI_Boot_HeaderTypeDef;
+
+typedef struct
+{
+  uint32_t Type;     /* QSPI_BOOT_SEGMENT_xxx                                */
+  uint32_t Offset;   /* Offset of the stored data from the image start       */
+  uint32_t Size;     /* Bytes stored in the image                            */
+  uint32_t Address;  /* Execution address                                    */
+  uint32_t Length;   /* Bytes at the execution address                       */
+} QSPI_Boot_SegmentTypeDef;
+
+typedef struct
+{
+  uint32_t Segments;  /* Segments loaded, XIP segments excluded     */
+  uint32_t Stored;    /* Bytes read from the QSPI memory            */
+  uint32_t Loaded;    /* Bytes written at the execution addresses   */
+  uint32_t Cycles;    /* CPU cycles of QSPI_Boot_Load()             */
+} QSPI_Boot_StatsTypeDef;
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef QSPI_Boot_Load(uint32_t ImageAddress, MDMA_HandleTypeDef *hmdma, uint32_t *pVectorTable);
+void              QSPI_Boot_Jump(uint32_t VectorTable);
+void              QSPI_Boot_GetStats(QSPI_Boot_StatsTypeDef *pStats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _QSPI_BOOT_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
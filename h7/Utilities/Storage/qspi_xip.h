@@ -0,0 +1,133 @@
+/**
+  ******************************************************************************
+  * @file    qspi_xip.h
+  * @author  MCD Application Team
+  * @brief   Header for qspi_xip module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _QSPI_XIP_H__
+#define _QSPI_XIP_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+  QSPI_XIP_STATE_RESET  = 0U,  /* Not initialized                              */
+  QSPI_XIP_STATE_MAPPED = 1U,  /* Memory mapped, no erase pending              */
+  QSPI_XIP_STATE_ERASE  = 2U,  /* Memory mapped, an erase is suspended         */
+  QSPI_XIP_STATE_ERROR  = 3U   /* A command failed, memory mapped mode left    */
+} QSPI_XIP_StateTypeDef;
+
+/* Commands of the memory, in the mode set up by its BSP_QSPI_Init() */
+typedef struct
+{
+  uint32_t CommandLines;        /* QSPI_INSTRUCTION_1_LINE, or _4_LINES in QPI mode:
+                                   lines of the instruction, address and data of
+                                   the status, write enable and erase commands     */
+  uint32_t AddressSize;         /* QSPI_ADDRESS_24_BITS or _32_BITS                */
+
+  /* Memory mapped read */
+  uint32_t ReadInstruction;     /* Quad I/O fast read, STR or DTR                  */
+  uint32_t ReadAddressMode;     /* QSPI_ADDRESS_x_LINES                            */
+  uint32_t ReadDataMode;        /* QSPI_DATA_x_LINES                               */
+  uint32_t ReadDummyCycles;     /* Dummy cycles after the mode byte                */
+  uint32_t ReadDdrMode;         /* QSPI_DDR_MODE_DISABLE or _ENABLE                */
+  uint32_t ReadDdrHoldHalfCycle;/* QSPI_DDR_HHC_ANALOG_DELAY or _HALF_CLK_DELAY    */
+  uint32_t ModeByteEnable;      /* 1 to send a mode byte with each read            */
+  uint32_t ModeByte;            /* Mode byte keeping the continuous read mode: the
+                                   instruction is then sent once (SIOO)           */
+  uint32_t ModeByteExit;        /* Mode byte leaving the continuous read mode      */
+
+  /* Program */
+  uint32_t ProgramInstruction;
+  uint32_t ProgramAddressMode;  /* QSPI_ADDRESS_x_LINES                            */
+  uint32_t ProgramDataMode;     /* QSPI_DATA_x_LINES                               */
+  uint32_t PageSize;            /* Program page size, in bytes                     */
+  uint32_t PageProgramTime;     /* Maximum page program time, in ms                */
+
+  /* Erase */
+  uint32_t EraseInstruction;    /* Erase of one sector or subsector                */
+  uint32_t EraseSize;           /* Size of the erased area, in bytes               */
+  uint32_t EraseMaxTime;        /* Maximum erase time, in ms                       */
+  uint32_t SuspendInstruction;  /* Program/erase suspend, 0 when not supported     */
+  uint32_t ResumeInstruction;   /* Program/erase resume                            */
+
+  /* Status */
+  uint32_t WriteEnableInstruction;
+  uint32_t StatusInstruction;   /* Read status register                            */
+  uint32_t StatusBusyMask;      /* Write in progress bit                           */
+  uint32_t StatusWelMask;       /* Write enable latch bit                          */
+} QSPI_XIP_DeviceTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Longest time the memory mapped mode may be left by an erase step, in us.
+   Interrupts are masked meanwhile. Override in main.h. */
+#if !defined(QSPI_XIP_ERASE_SLICE_US)
+#define QSPI_XIP_ERASE_SLICE_US   1000U
+#endif
+
+/* Memory mapped mode timeout, in QSPI clock cycles: nCS is released after
+   that long without access. 0 keeps it low for the prefetch to go on.
+   Override in main.h. */
+#if !defined(QSPI_XIP_TIMEOUT_PERIOD)
+#define QSPI_XIP_TIMEOUT_PERIOD   0U
+#endif
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Address in the memory mapped region of an address of the memory */
+#define QSPI_XIP_ADDRESS(__ADDR__)  ((uint8_t *)(QSPI_BASE + (__ADDR__)))
+
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef     QSPI_XIP_Init(QSPI_HandleTypeDef *hqspi, const QSPI_XIP_DeviceTypeDef *pDevice);
+HAL_StatusTypeDef     QSPI_XIP_DeInit(void);
+HAL_StatusTypeDef     QSPI_XIP_Read(uint32_t Address, uint8_t *pData, uint32_t Size);
+HAL_StatusTypeDef     QSPI_XIP_Write(uint32_t Address, const uint8_t *pData, uint32_t Size);
+HAL_StatusTypeDef     QSPI_XIP_EraseStart(uint32_t Address);
+HAL_StatusTypeDef     QSPI_XIP_Process(void);
+QSPI_XIP_StateTypeDef QSPI_XIP_GetState(void);
+
+void QSPI_XIP_EraseCpltCallback(uint32_t Address);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _QSPI_XIP_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,135 @@
+/**
+  ******************************************************************************
+  * @file    rs485_bus.h
+  * @author  MCD Application Team
+  * @brief   Header for rs485_bus module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _RS485_BUS_H__
+#define _RS485_BUS_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#if !defined(HAL_UART_MODULE_ENABLED) || !defined(HAL_DMA_MODULE_ENABLED)
+#error "rs485_bus requires the HAL UART and DMA drivers"
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+/* Largest frame, in bytes: 256 for a Modbus RTU ADU. Override in main.h. */
+#if !defined(RS485_BUS_MAX_FRAME)
+#define RS485_BUS_MAX_FRAME       256U
+#endif
+
+/* Received frames waiting for the application. Override in main.h. */
+#if !defined(RS485_BUS_RX_FRAMES)
+#define RS485_BUS_RX_FRAMES       4U
+#endif
+
+/* Frame gap computed from the baud rate, FrameGap = 0: 3.5 characters up to
+   19200 bit/s, RS485_BUS_FIXED_GAP_US above, as for Modbus RTU. Override in
+   main.h. */
+#if !defined(RS485_BUS_FIXED_GAP_US)
+#define RS485_BUS_FIXED_GAP_US    1750U
+#endif
+
+/* Largest receiver timeout of the USART, in bit times */
+#define RS485_BUS_MAX_GAP         0x00FFFFFFU
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  UART_HandleTypeDef        *huart;             /* USART set by HAL_RS485Ex_Init(), hdmarx
+                                                   circular, hdmatx normal, byte transfers */
+  uint8_t                   *pRing;             /* Reception ring of the circular DMA        */
+  uint32_t                  RingSize;           /* Bytes, 2 frames at least, 65535 at most   */
+  uint32_t                  FrameGap;           /* Silence closing a frame, in bit times,
+                                                   0 for the Modbus RTU t3.5                 */
+  uint32_t                  EchoSuppress;       /* 1 to disable the receiver while sending,
+                                                   transceiver receiving its own frames      */
+} RS485_Bus_ConfigTypeDef;
+
+typedef struct
+{
+  uint32_t                  Length;             /* Bytes                                     */
+  uint8_t                   Data[RS485_BUS_MAX_FRAME];
+} RS485_Bus_FrameTypeDef;
+
+typedef struct
+{
+  RS485_Bus_ConfigTypeDef   Config;
+  __IO uint32_t             State;
+  uint32_t                  Gap;                /* Receiver timeout programmed, bit times    */
+  RS485_Bus_FrameTypeDef    RxQueue[RS485_BUS_RX_FRAMES];
+  __IO uint32_t             RxHead;             /* Frames received                           */
+  __IO uint32_t             RxTail;             /* Frames released by the application       */
+  uint32_t                  RxOffset;           /* Ring offset of the next frame             */
+  uint32_t                  RxError;            /* Line error in the frame being received    */
+  uint32_t                  TxLength;           /* Bytes of the frame in TxBuffer            */
+  uint32_t                  TxBuffer[(RS485_BUS_MAX_FRAME + 3U) / 4U];
+  __IO uint32_t             TxState;            /* Idle, waiting for the bus or sending      */
+  uint32_t                  RxFrames;           /* Frames received and queued                */
+  uint32_t                  TxFrames;           /* Frames sent                               */
+  uint32_t                  LengthErrors;       /* Frames longer than RS485_BUS_MAX_FRAME    */
+  uint32_t                  LineErrors;         /* Frames with a parity, framing, noise or
+                                                   overrun error                             */
+  uint32_t                  Dropped;            /* Valid frames lost, RxQueue full           */
+  uint32_t                  TxErrors;           /* Frames not sent, DMA start failed         */
+} RS485_BusTypeDef;
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef RS485_Bus_Init(RS485_BusTypeDef *pBus, const RS485_Bus_ConfigTypeDef *pConfig);
+HAL_StatusTypeDef RS485_Bus_Start(RS485_BusTypeDef *pBus);
+HAL_StatusTypeDef RS485_Bus_Stop(RS485_BusTypeDef *pBus);
+HAL_StatusTypeDef RS485_Bus_Send(RS485_BusTypeDef *pBus, const uint8_t *pData, uint32_t Length);
+const uint8_t    *RS485_Bus_Peek(RS485_BusTypeDef *pBus, uint32_t *pLength);
+void              RS485_Bus_Release(RS485_BusTypeDef *pBus);
+uint32_t          RS485_Bus_GetPending(RS485_BusTypeDef *pBus);
+void              RS485_Bus_IRQHandler(RS485_BusTypeDef *pBus);
+
+void RS485_Bus_RxCallback(RS485_BusTypeDef *pBus);
+void RS485_Bus_TxCpltCallback(RS485_BusTypeDef *pBus);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RS485_BUS_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
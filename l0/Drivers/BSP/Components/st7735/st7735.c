@@ -338,6 +338,23 @@ void st7735_SetDisplayWindow(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint1
   LCD_IO_WriteMultipleData(&data, 1);
 }
 
+/**
+  * @brief  Opens a window for a stream of pixels
+  * @param  Xpos:   specifies the X left position.
+  * @param  Ypos:   specifies the Y top position.
+  * @param  Width:  window width.
+  * @param  Height: window height.
+  * @note   The Width x Height RGB565 pixels that follow, row by row, are
+  *         written in the window (used by the DMA frame push).
+  * @retval None
+  */
+void st7735_SetWriteWindow(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+  st7735_SetDisplayWindow(Xpos, Ypos, Width, Height);
+  /* Memory write */
+  LCD_IO_WriteReg(LCD_REG_44);
+}
+
 /**
   * @brief  Draws horizontal line.
   * @param  RGBCode: Specifies the RGB color   
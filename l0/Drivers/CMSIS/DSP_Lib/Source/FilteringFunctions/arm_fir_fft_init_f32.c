@@ -0,0 +1,129 @@
+/* ----------------------------------------------------------------------  
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.  
+*  
+* $Date:        19. March 2015
+* $Revision: 	V.1.4.5
+*  
+* Project: 	    CMSIS DSP Library  
+* Title:	    arm_fir_fft_init_f32.c  
+*  
+* Description:	Floating-point partitioned FFT FIR filter initialization function.  
+*  
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE. 
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupFilters    
+ */
+
+/**    
+ * @addtogroup FIR_FFT    
+ * @{    
+ */
+
+/**    
+ * @details    
+ *    
+ * @param[in,out] *S points to an instance of the floating-point partitioned FFT FIR structure.    
+ * @param[in] 	  numTaps  Number of filter coefficients in the filter.    
+ * @param[in]     *pCoeffs points to the filter coefficients buffer.    
+ * @param[in]     *pState points to the state buffer.    
+ * @param[in] 	  blockSize number of samples that are processed per call.    
+ * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if    
+ *                <code>numTaps</code> is zero or <code>2*blockSize</code> is not a supported real FFT length.    
+ *    
+ * <b>Description:</b>    
+ * \par    
+ * <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order,    
+ * as for <code>arm_fir_init_f32()</code>:    
+ * <pre>    
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}    
+ * </pre>    
+ * The spectra of the coefficients are computed into the state buffer, so the coefficient    
+ * array is not needed after initialization.    
+ * \par    
+ * <code>pState</code> points to the state buffer of <code>ARM_FIR_FFT_STATE_SIZE_F32(numTaps, blockSize)</code> samples,    
+ * that is <code>(4*numParts + 6)*blockSize</code> with <code>numParts = ceil(numTaps / blockSize)</code>.    
+ */
+
+arm_status arm_fir_fft_init_f32(
+  arm_fir_fft_instance_f32 * S,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint16_t blockSize)
+{
+  uint32_t fftLen = 2u * (uint32_t) blockSize;   /* Length of the real FFT */
+  uint32_t numParts;                             /* Number of partitions */
+  uint32_t k, n, idx;                            /* Loop counters */
+  arm_status status = ARM_MATH_ARGUMENT_ERROR;
+
+  if((numTaps != 0u) && (fftLen <= 0xFFFFu) &&
+     (arm_rfft_fast_init_f32(&S->rfft, (uint16_t) fftLen) == ARM_MATH_SUCCESS))
+  {
+    numParts = ((uint32_t) numTaps + blockSize - 1u) / blockSize;
+
+    S->numTaps = numTaps;
+    S->blockSize = blockSize;
+    S->numParts = (uint16_t) numParts;
+    S->partIndex = 0u;
+
+    /* Carve the state buffer */
+    S->pCoeffsFreq = pState;
+    S->pFdl = S->pCoeffsFreq + (numParts * fftLen);
+    S->pInput = S->pFdl + (numParts * fftLen);
+    S->pAcc = S->pInput + fftLen;
+    S->pScratch = S->pAcc + fftLen;
+
+    /* Clear the frequency delay line and the input window */
+    memset(S->pFdl, 0, ((numParts + 1u) * fftLen) * sizeof(float32_t));
+
+    /* Spectrum of each partition, zero padded to the FFT length */
+    for (k = 0u; k < numParts; k++)
+    {
+      for (n = 0u; n < fftLen; n++)
+      {
+        idx = (k * blockSize) + n;
+        S->pScratch[n] = ((n < blockSize) && (idx < numTaps)) ? pCoeffs[numTaps - 1u - idx] : 0.0f;
+      }
+
+      arm_rfft_fast_f32(&S->rfft, S->pScratch, S->pCoeffsFreq + (k * fftLen), 0u);
+    }
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**    
+ * @} end of FIR_FFT group    
+ */
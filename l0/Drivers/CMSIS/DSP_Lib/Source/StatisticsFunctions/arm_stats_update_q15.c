@@ -0,0 +1,212 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_stats_update_q15.c  
+*    
+* Description:	Accumulates a block of a Q15 stream into the batch statistics.  
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**    
+ * @ingroup groupStats    
+ */
+
+/**    
+ * @addtogroup Stats    
+ * @{    
+ */
+
+/**    
+ * @brief Accumulates a block of a Q15 stream into the batch statistics.    
+ * @param[in,out]   *S points to an instance of the Q15 statistics structure.    
+ * @param[in]       *pSrc points to the input vector    
+ * @param[in]       blockSize length of the input vector    
+ * @return none.    
+ */
+
+void arm_stats_update_q15(
+  arm_stats_instance_q15 * S,
+  q15_t * pSrc,
+  uint32_t blockSize)
+{
+  q63_t sumOfSquares = S->sumOfSquares;          /* Sum of squares, in 34.30 format */
+  q31_t sum = 0;                                 /* Sum of the samples of the block */
+  q15_t minVal, maxVal;                          /* Extrema of the stream */
+  uint32_t minIdx, maxIdx;                       /* Indexes of the extrema */
+  uint32_t idx = S->count;                       /* Index of the current sample in the stream */
+  q15_t in1;                                     /* input value */
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+  q31_t in;                                      /* two packed input values */
+  q15_t in2;                                     /* input value */
+#endif
+
+  if(blockSize == 0u)
+  {
+    return;
+  }
+
+  /* The first sample of the stream initializes the extrema */
+  if(idx == 0u)
+  {
+    S->min = pSrc[0];
+    S->max = pSrc[0];
+  }
+
+  minVal = S->min;
+  maxVal = S->max;
+  minIdx = S->minIndex;
+  maxIdx = S->maxIndex;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  blkCnt = blockSize >> 1u;
+
+  /* First part of the processing, two samples at a time with the dual multiply-accumulate.    
+   ** The sum of the block stays in 32 bits for up to 65536 samples. */
+  while(blkCnt > 0u)
+  {
+    in = *__SIMD32(pSrc)++;
+
+    /* Sum of squares of both samples */
+    sumOfSquares = __SMLALD(in, in, sumOfSquares);
+
+#ifndef ARM_MATH_BIG_ENDIAN
+
+    in1 = (q15_t) in;
+    in2 = (q15_t) (in >> 16);
+
+#else
+
+    in1 = (q15_t) (in >> 16);
+    in2 = (q15_t) in;
+
+#endif /* #ifndef ARM_MATH_BIG_ENDIAN */
+
+    sum += in1;
+    sum += in2;
+
+    /* Compare with the extrema */
+    if(in1 < minVal)
+    {
+      minVal = in1;
+      minIdx = idx;
+    }
+    if(in1 > maxVal)
+    {
+      maxVal = in1;
+      maxIdx = idx;
+    }
+    if(in2 < minVal)
+    {
+      minVal = in2;
+      minIdx = idx + 1u;
+    }
+    if(in2 > maxVal)
+    {
+      maxVal = in2;
+      maxIdx = idx + 1u;
+    }
+
+    idx += 2u;
+
+    /* Flush the 32-bit sum into the 64-bit accumulator every 16384 pairs */
+    if((blkCnt & 0x3FFFu) == 0u)
+    {
+      S->sum += sum;
+      sum = 0;
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is odd, compute the last sample here. */
+  blkCnt = blockSize & 0x1u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    in1 = *pSrc++;
+    sum += in1;
+    sumOfSquares += ((q31_t) in1 * in1);
+    if(in1 < minVal)
+    {
+      minVal = in1;
+      minIdx = idx;
+    }
+    if(in1 > maxVal)
+    {
+      maxVal = in1;
+      maxIdx = idx;
+    }
+
+    idx++;
+
+    /* Flush the 32-bit sum into the 64-bit accumulator */
+    if((blkCnt & 0xFFFFu) == 0u)
+    {
+      S->sum += sum;
+      sum = 0;
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Store the accumulators back into the instance */
+  S->count = idx;
+  S->sum += sum;
+  S->sumOfSquares = sumOfSquares;
+  S->min = minVal;
+  S->max = maxVal;
+  S->minIndex = minIdx;
+  S->maxIndex = maxIdx;
+}
+
+/**    
+ * @} end of Stats group    
+ */
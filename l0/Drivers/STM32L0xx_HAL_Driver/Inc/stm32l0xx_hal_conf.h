@@ -142,6 +142,7 @@
 #define  PREFETCH_ENABLE              1U              
 #define  PREREAD_ENABLE               0U
 #define  BUFFER_CACHE_DISABLE         0U
+#define  USE_HAL_TRACE                0U /*!< Record HAL driver events in the trace buffer */
 
 /* ########################## Assert Selection ############################## */
 /**
@@ -223,11 +223,22 @@
   * @{
   */
 #define SPI_DEFAULT_TIMEOUT 100U
+#define SPI_SHORT_XFER_MAX  4U    /*!< Frames of the short transfer fast path */
 /**
   * @}
   */
 
 /* Private macros ------------------------------------------------------------*/
+/* Polling loop iterations in about 1 ms: the short transfer fast path only reads
+   the tick once this budget is spent */
+#define SPI_SHORT_XFER_SPIN()  ((SystemCoreClock / 24U / 1000U) + 1U)
+
+/* Master 2-lines transfer of a few 8-bit frames without CRC */
+#define SPI_IS_SHORT_XFER(__HANDLE__, __SIZE__) (((__SIZE__) <= SPI_SHORT_XFER_MAX)                          && \
+                                                ((__HANDLE__)->Init.Mode == SPI_MODE_MASTER)                && \
+                                                ((__HANDLE__)->Init.Direction == SPI_DIRECTION_2LINES)      && \
+                                                ((__HANDLE__)->Init.DataSize == SPI_DATASIZE_8BIT)         && \
+                                                ((__HANDLE__)->Init.CRCCalculation == SPI_CRCCALCULATION_DISABLE))
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
 /** @defgroup SPI_Private_Functions SPI Private Functions
@@ -266,6 +277,8 @@ static void SPI_CloseRx_ISR(SPI_HandleTypeDef *hspi);
 static void SPI_CloseTx_ISR(SPI_HandleTypeDef *hspi);
 static HAL_StatusTypeDef SPI_EndRxTransaction(SPI_HandleTypeDef *hspi, uint32_t Timeout, uint32_t Tickstart);
 static HAL_StatusTypeDef SPI_EndRxTxTransaction(SPI_HandleTypeDef *hspi, uint32_t Timeout, uint32_t Tickstart);
+static HAL_StatusTypeDef SPI_ShortTransfer(SPI_HandleTypeDef *hspi, uint8_t *pTxData, uint8_t *pRxData, uint16_t Size,
+                                           uint32_t Timeout, uint32_t Tickstart);
 /**
   * @}
   */
@@ -746,6 +759,8 @@ HAL_StatusTypeDef HAL_SPI_UnRegisterCallback(SPI_HandleTypeDef *hspi, HAL_SPI_Ca
   * @param  pData pointer to data buffer
   * @param  Size amount of data to be sent
   * @param  Timeout Timeout duration
+  * @note   Master 2-lines transfers of up to SPI_SHORT_XFER_MAX 8-bit frames without CRC
+  *         take a fast path without tick read for each frame.
   * @retval HAL status
   */
 HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size, uint32_t Timeout)
@@ -818,6 +833,13 @@ HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, uint8_t *pData, uint
     __HAL_SPI_ENABLE(hspi);
   }
 
+  /* Short transfer: no tick read for each frame */
+  if (SPI_IS_SHORT_XFER(hspi, Size))
+  {
+    errorcode = SPI_ShortTransfer(hspi, pData, NULL, Size, Timeout, tickstart);
+    goto error;
+  }
+
   /* Transmit data in 16 Bit mode */
   if (hspi->Init.DataSize == SPI_DATASIZE_16BIT)
   {
@@ -1114,6 +1136,8 @@ error :
   * @param  pRxData pointer to reception data buffer
   * @param  Size amount of data to be sent and received
   * @param  Timeout Timeout duration
+  * @note   Master 2-lines transfers of up to SPI_SHORT_XFER_MAX 8-bit frames without CRC
+  *         take a fast path without tick read for each frame.
   * @retval HAL status
   */
 HAL_StatusTypeDef HAL_SPI_TransmitReceive(SPI_HandleTypeDef *hspi, uint8_t *pTxData, uint8_t *pRxData, uint16_t Size,
@@ -1197,6 +1221,13 @@ HAL_StatusTypeDef HAL_SPI_TransmitReceive(SPI_HandleTypeDef *hspi, uint8_t *pTxD
     __HAL_SPI_ENABLE(hspi);
   }
 
+  /* Short transfer: no tick read for each frame */
+  if (SPI_IS_SHORT_XFER(hspi, Size))
+  {
+    errorcode = SPI_ShortTransfer(hspi, pTxData, pRxData, Size, Timeout, tickstart);
+    goto error;
+  }
+
   /* Transmit and Receive data in 16 Bit mode */
   if (hspi->Init.DataSize == SPI_DATASIZE_16BIT)
   {
@@ -3535,6 +3566,68 @@ static HAL_StatusTypeDef SPI_EndRxTransaction(SPI_HandleTypeDef *hspi,  uint32_t
   return HAL_OK;
 }
 
+/**
+  * @brief  Short master transfer: each frame is written as soon as TXE is set and
+  *         read as soon as RXNE is set. The tick is only read once the
+  *         SPI_SHORT_XFER_SPIN() polling budget is spent.
+  * @param  hspi pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @param  pTxData pointer to transmission data buffer
+  * @param  pRxData pointer to reception data buffer, NULL to drop the received frames
+  * @param  Size amount of frames, SPI_SHORT_XFER_MAX at most
+  * @param  Timeout Timeout duration
+  * @param  Tickstart tick start value
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef SPI_ShortTransfer(SPI_HandleTypeDef *hspi, uint8_t *pTxData, uint8_t *pRxData, uint16_t Size,
+                                           uint32_t Timeout, uint32_t Tickstart)
+{
+  uint32_t spin = SPI_SHORT_XFER_SPIN();
+  uint16_t i;
+  uint8_t  data;
+
+  for (i = 0U; i < Size; i++)
+  {
+    while ((__HAL_SPI_GET_FLAG(hspi, SPI_FLAG_TXE) == RESET) && (spin > 0U))
+    {
+      spin--;
+    }
+    if (SPI_WaitFlagStateUntilTimeout(hspi, SPI_FLAG_TXE, SET, Timeout, Tickstart) != HAL_OK)
+    {
+      return HAL_TIMEOUT;
+    }
+    *((__IO uint8_t *)&hspi->Instance->DR) = pTxData[i];
+
+    /* No overrun: the next frame is only sent once this one is read */
+    while ((__HAL_SPI_GET_FLAG(hspi, SPI_FLAG_RXNE) == RESET) && (spin > 0U))
+    {
+      spin--;
+    }
+    if (SPI_WaitFlagStateUntilTimeout(hspi, SPI_FLAG_RXNE, SET, Timeout, Tickstart) != HAL_OK)
+    {
+      return HAL_TIMEOUT;
+    }
+    data = *((__IO uint8_t *)&hspi->Instance->DR);
+    if (pRxData != NULL)
+    {
+      pRxData[i] = data;
+    }
+  }
+  hspi->TxXferCount = 0U;
+  hspi->RxXferCount = 0U;
+
+  /* Last frame received, wait for the end of the busy period */
+  while ((__HAL_SPI_GET_FLAG(hspi, SPI_FLAG_BSY) != RESET) && (spin > 0U))
+  {
+    spin--;
+  }
+  if (SPI_WaitFlagStateUntilTimeout(hspi, SPI_FLAG_BSY, RESET, Timeout, Tickstart) != HAL_OK)
+  {
+    return HAL_TIMEOUT;
+  }
+  return HAL_OK;
+}
+
 /**
   * @brief  Handle the check of the RXTX or TX transaction complete.
   * @param  hspi SPI handle
@@ -0,0 +1,477 @@
+/**
+  ******************************************************************************
+  * @file    ll_board.h
+  * @author  MCD Application Team
+  * @brief   Compile time checked board pin map and clock tree, applied
+  *          with a minimal number of register writes over the LL drivers.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- describe the board pins with an X macro taking a context argument, one
+   line per pin:
+     #define BOARD_PINS(X, P) \
+       X(P, LD2,    A,  5, OUTPUT,    PUSHPULL, LOW,  NO, 0) \
+       X(P, VCP_TX, A,  2, ALTERNATE, PUSHPULL, HIGH, NO, 4)
+   the fields are the name, port letter, pin number, the suffixes of the
+   LL_GPIO_MODE_xxx, LL_GPIO_OUTPUT_xxx, LL_GPIO_SPEED_FREQ_xxx and
+   LL_GPIO_PULL_xxx constants and the alternate function number. The maps
+   of the boards of OSQ/variants_remap.json are provided below, named after
+   the variant, e.g. LL_BOARD_PINS_NUCLEO_L073RZ.
+
+2- LL_BOARD_CHECK_PINS(BOARD_PINS); at file scope fails the build on a pin
+   number above 15, an alternate function above 7, an alternate function
+   on a pin not in alternate mode, a pull on an analog pin or two lines for
+   the same pin. A port the device does not have does not compile.
+   LL_BOARD_PIN_NAMES(BOARD_PINS); declares LL_BOARD_<name> pin masks for
+   the LL_GPIO_xxx functions.
+
+3- LL_BOARD_GPIO_INIT(BOARD_PINS); enables the clock of the ports used and
+   writes each register of these ports once, masks and values being
+   constants, instead of a HAL_GPIO_Init() loop per pin. The registers of
+   the unused ports and the AFR of ports without alternate pins are not
+   touched.
+
+4- the clock tree is given by the LL_BOARD_SYSCLK_SOURCE, LL_BOARD_PLL_xxx
+   and LL_BOARD_xxx_DIV defines, checked against the device limits when
+   the header is compiled. The voltage range is the lowest one allowing
+   the PLL and system frequencies. LL_Board_ClockInit() programs the tree
+   from the reset configuration (MSI): voltage range, flash latency,
+   oscillator, PLL, prescalers and switch, then updates SystemCoreClock.
+   LL_BOARD_HCLK_HZ and LL_BOARD_PCLKx_HZ are constants for LL_Init1msTick()
+   and baud rate computations.
+
+5- the header is C and C++ compatible: the checks are static_assert in
+   C++11, _Static_assert in C11 and an array of negative size otherwise.
+*******************************************************************************/
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _LL_BOARD_H__
+#define _LL_BOARD_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "stm32l0xx_ll_gpio.h"
+#include "stm32l0xx_ll_rcc.h"
+
+/* Exported constants --------------------------------------------------------*/
+#define LL_BOARD_CLK_HSI         0U
+#define LL_BOARD_CLK_HSE         1U
+#define LL_BOARD_CLK_PLL         2U
+
+/* Clock tree, override in main.h. Default: HSI16 * 4 / 2 = 32 MHz */
+#if !defined(LL_BOARD_SYSCLK_SOURCE)
+#define LL_BOARD_SYSCLK_SOURCE   LL_BOARD_CLK_PLL
+#endif
+#if !defined(LL_BOARD_PLL_SOURCE)
+#define LL_BOARD_PLL_SOURCE      LL_BOARD_CLK_HSI
+#endif
+#if !defined(LL_BOARD_PLL_MUL)
+#define LL_BOARD_PLL_MUL         4U          /* 3, 4, 6, 8, 12, 16, 24, 32, 48 */
+#endif
+#if !defined(LL_BOARD_PLL_DIV)
+#define LL_BOARD_PLL_DIV         2U          /* 2, 3, 4 */
+#endif
+#if !defined(LL_BOARD_AHB_DIV)
+#define LL_BOARD_AHB_DIV         1U          /* 1, 2, 4, 8, 16, 64, 128, 256, 512 */
+#endif
+#if !defined(LL_BOARD_APB1_DIV)
+#define LL_BOARD_APB1_DIV        1U          /* 1, 2, 4, 8, 16 */
+#endif
+#if !defined(LL_BOARD_APB2_DIV)
+#define LL_BOARD_APB2_DIV        1U          /* 1, 2, 4, 8, 16 */
+#endif
+#if !defined(LL_BOARD_HSE_BYPASS)
+#define LL_BOARD_HSE_BYPASS      0U          /* 1: external clock on OSC_IN */
+#endif
+#if !defined(LL_BOARD_STARTUP_LOOPS)
+#define LL_BOARD_STARTUP_LOOPS   0x50000U    /* Oscillator, PLL and regulator ready polling */
+#endif
+
+/* Port numbers, also the bit of the port in RCC_IOPENR */
+#define LL_BOARD_PORT_A          0U
+#define LL_BOARD_PORT_B          1U
+#define LL_BOARD_PORT_C          2U
+#if defined(GPIOD)
+#define LL_BOARD_PORT_D          3U
+#endif
+#if defined(GPIOE)
+#define LL_BOARD_PORT_E          4U
+#endif
+#if defined(GPIOH)
+#define LL_BOARD_PORT_H          7U
+#endif
+
+/* Exported macro ------------------------------------------------------------*/
+#if defined(__cplusplus) && (__cplusplus >= 201103L)
+#define LL_BOARD_STATIC_ASSERT(__COND__, __MSG__)  static_assert((__COND__), __MSG__)
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+#define LL_BOARD_STATIC_ASSERT(__COND__, __MSG__)  _Static_assert((__COND__), __MSG__)
+#else
+#define LL_BOARD_STATIC_ASSERT(__COND__, __MSG__)  extern char LL_Board_Check[(__COND__) ? 1 : -1]
+#endif
+
+/* Pin map fields, summed over the pins of port __P__ */
+#define LL_BOARD_X_PINS(__P__, NAME, PORT, PIN, MODE, OTYPE, SPEED, PULL, AF) \
+  + ((LL_BOARD_PORT_##PORT == (__P__)) ? (1UL << (PIN)) : 0U)
+#define LL_BOARD_X_PINS_OR(__P__, NAME, PORT, PIN, MODE, OTYPE, SPEED, PULL, AF) \
+  | ((LL_BOARD_PORT_##PORT == (__P__)) ? (1UL << (PIN)) : 0U)
+#define LL_BOARD_X_MASK2(__P__, NAME, PORT, PIN, MODE, OTYPE, SPEED, PULL, AF) \
+  + ((LL_BOARD_PORT_##PORT == (__P__)) ? (3UL << (2U * (PIN))) : 0U)
+#define LL_BOARD_X_MODER(__P__, NAME, PORT, PIN, MODE, OTYPE, SPEED, PULL, AF) \
+  + ((LL_BOARD_PORT_##PORT == (__P__)) ? (LL_GPIO_MODE_##MODE << (2U * (PIN))) : 0U)
+#define LL_BOARD_X_OTYPER(__P__, NAME, PORT, PIN, MODE, OTYPE, SPEED, PULL, AF) \
+  + ((LL_BOARD_PORT_##PORT == (__P__)) ? (LL_GPIO_OUTPUT_##OTYPE << (PIN)) : 0U)
+#define LL_BOARD_X_OSPEEDR(__P__, NAME, PORT, PIN, MODE, OTYPE, SPEED, PULL, AF) \
+  + ((LL_BOARD_PORT_##PORT == (__P__)) ? (LL_GPIO_SPEED_FREQ_##SPEED << (2U * (PIN))) : 0U)
+#define LL_BOARD_X_PUPDR(__P__, NAME, PORT, PIN, MODE, OTYPE, SPEED, PULL, AF) \
+  + ((LL_BOARD_PORT_##PORT == (__P__)) ? (LL_GPIO_PULL_##PULL << (2U * (PIN))) : 0U)
+#define LL_BOARD_X_AFR_MASK(__P__, NAME, PORT, PIN, MODE, OTYPE, SPEED, PULL, AF) \
+  + (((LL_BOARD_PORT_##PORT == ((__P__) >> 1U)) && (((PIN) >> 3U) == ((__P__) & 1U)) && \
+      (LL_GPIO_MODE_##MODE == LL_GPIO_MODE_ALTERNATE)) ? (0xFUL << (4U * ((PIN) & 7U))) : 0U)
+#define LL_BOARD_X_AFR(__P__, NAME, PORT, PIN, MODE, OTYPE, SPEED, PULL, AF) \
+  + (((LL_BOARD_PORT_##PORT == ((__P__) >> 1U)) && (((PIN) >> 3U) == ((__P__) & 1U)) && \
+      (LL_GPIO_MODE_##MODE == LL_GPIO_MODE_ALTERNATE)) ? ((uint32_t)(AF) << (4U * ((PIN) & 7U))) : 0U)
+#define LL_BOARD_X_CLOCKS(__P__, NAME, PORT, PIN, MODE, OTYPE, SPEED, PULL, AF) \
+  | (RCC_IOPENR_IOPAEN << LL_BOARD_PORT_##PORT)
+#define LL_BOARD_X_NAME(__P__, NAME, PORT, PIN, MODE, OTYPE, SPEED, PULL, AF) \
+  LL_BOARD_##NAME = (1 << (PIN)),
+
+/* Pin map errors, counted over all the pins */
+#define LL_BOARD_X_BAD_PIN(__P__, NAME, PORT, PIN, MODE, OTYPE, SPEED, PULL, AF) \
+  + (((PIN) > 15U) ? 1U : 0U)
+#define LL_BOARD_X_BAD_AF(__P__, NAME, PORT, PIN, MODE, OTYPE, SPEED, PULL, AF) \
+  + (((AF) > 7U) ? 1U : 0U)
+#define LL_BOARD_X_STRAY_AF(__P__, NAME, PORT, PIN, MODE, OTYPE, SPEED, PULL, AF) \
+  + ((((AF) != 0U) && (LL_GPIO_MODE_##MODE != LL_GPIO_MODE_ALTERNATE)) ? 1U : 0U)
+#define LL_BOARD_X_ANALOG_PULL(__P__, NAME, PORT, PIN, MODE, OTYPE, SPEED, PULL, AF) \
+  + (((LL_GPIO_MODE_##MODE == LL_GPIO_MODE_ANALOG) && (LL_GPIO_PULL_##PULL != LL_GPIO_PULL_NO)) ? 1U : 0U)
+
+#define LL_BOARD_PIN_MASK(__MAP__, __P__)  (0U __MAP__(LL_BOARD_X_PINS, (__P__)))
+#define LL_BOARD_UNIQUE(__MAP__, __P__)    ((0U __MAP__(LL_BOARD_X_PINS, (__P__))) == (0U __MAP__(LL_BOARD_X_PINS_OR, (__P__))))
+
+/**
+  * @brief  Compile time checks of a pin map, at file scope
+  * @param  __MAP__: pin map X macro
+  */
+#define LL_BOARD_CHECK_PINS(__MAP__)                                                                    \
+  LL_BOARD_STATIC_ASSERT((0U __MAP__(LL_BOARD_X_BAD_PIN, 0U)) == 0U, "pin number above 15");             \
+  LL_BOARD_STATIC_ASSERT((0U __MAP__(LL_BOARD_X_BAD_AF, 0U)) == 0U, "alternate function above 7");       \
+  LL_BOARD_STATIC_ASSERT((0U __MAP__(LL_BOARD_X_STRAY_AF, 0U)) == 0U,                                    \
+                         "alternate function on a pin not in alternate mode");                           \
+  LL_BOARD_STATIC_ASSERT((0U __MAP__(LL_BOARD_X_ANALOG_PULL, 0U)) == 0U, "pull on an analog pin");       \
+  LL_BOARD_STATIC_ASSERT(LL_BOARD_UNIQUE(__MAP__, 0U) && LL_BOARD_UNIQUE(__MAP__, 1U) &&                 \
+                         LL_BOARD_UNIQUE(__MAP__, 2U) && LL_BOARD_UNIQUE(__MAP__, 3U) &&                 \
+                         LL_BOARD_UNIQUE(__MAP__, 4U) && LL_BOARD_UNIQUE(__MAP__, 7U),                   \
+                         "pin described twice")
+
+/**
+  * @brief  LL_BOARD_<name> pin masks of a pin map
+  * @param  __MAP__: pin map X macro
+  */
+#define LL_BOARD_PIN_NAMES(__MAP__)  enum { __MAP__(LL_BOARD_X_NAME, 0U) LL_BOARD_PIN_NAMES_END_##__MAP__ }
+
+/* Registers of one port, AFR[0] and AFR[1] as half ports 2 * P and 2 * P + 1 */
+#define LL_BOARD_INIT_PORT(__MAP__, __GPIO__, __P__)                                                    \
+  if (LL_BOARD_PIN_MASK(__MAP__, (__P__)) != 0U)                                                        \
+  {                                                                                                     \
+    if ((0U __MAP__(LL_BOARD_X_AFR_MASK, 2U * (__P__))) != 0U)                                          \
+    {                                                                                                   \
+      MODIFY_REG((__GPIO__)->AFR[0], (0U __MAP__(LL_BOARD_X_AFR_MASK, 2U * (__P__))),                   \
+                 (0U __MAP__(LL_BOARD_X_AFR, 2U * (__P__))));                                           \
+    }                                                                                                   \
+    if ((0U __MAP__(LL_BOARD_X_AFR_MASK, (2U * (__P__)) + 1U)) != 0U)                                   \
+    {                                                                                                   \
+      MODIFY_REG((__GPIO__)->AFR[1], (0U __MAP__(LL_BOARD_X_AFR_MASK, (2U * (__P__)) + 1U)),            \
+                 (0U __MAP__(LL_BOARD_X_AFR, (2U * (__P__)) + 1U)));                                    \
+    }                                                                                                   \
+    MODIFY_REG((__GPIO__)->OTYPER, LL_BOARD_PIN_MASK(__MAP__, (__P__)), (0U __MAP__(LL_BOARD_X_OTYPER, (__P__)))); \
+    MODIFY_REG((__GPIO__)->OSPEEDR, (0U __MAP__(LL_BOARD_X_MASK2, (__P__))), (0U __MAP__(LL_BOARD_X_OSPEEDR, (__P__)))); \
+    MODIFY_REG((__GPIO__)->PUPDR, (0U __MAP__(LL_BOARD_X_MASK2, (__P__))), (0U __MAP__(LL_BOARD_X_PUPDR, (__P__)))); \
+    MODIFY_REG((__GPIO__)->MODER, (0U __MAP__(LL_BOARD_X_MASK2, (__P__))), (0U __MAP__(LL_BOARD_X_MODER, (__P__)))); \
+  }
+
+#if defined(GPIOD)
+#define LL_BOARD_INIT_PORT_D(__MAP__)  LL_BOARD_INIT_PORT(__MAP__, GPIOD, LL_BOARD_PORT_D)
+#else
+#define LL_BOARD_INIT_PORT_D(__MAP__)
+#endif
+#if defined(GPIOE)
+#define LL_BOARD_INIT_PORT_E(__MAP__)  LL_BOARD_INIT_PORT(__MAP__, GPIOE, LL_BOARD_PORT_E)
+#else
+#define LL_BOARD_INIT_PORT_E(__MAP__)
+#endif
+#if defined(GPIOH)
+#define LL_BOARD_INIT_PORT_H(__MAP__)  LL_BOARD_INIT_PORT(__MAP__, GPIOH, LL_BOARD_PORT_H)
+#else
+#define LL_BOARD_INIT_PORT_H(__MAP__)
+#endif
+
+/**
+  * @brief  Configure the pins of a pin map and enable the clock of their ports
+  * @param  __MAP__: pin map X macro
+  */
+#define LL_BOARD_GPIO_INIT(__MAP__)                                                                     \
+  do {                                                                                                  \
+    SET_BIT(RCC->IOPENR, (0U __MAP__(LL_BOARD_X_CLOCKS, 0U)));                                          \
+    (void)READ_BIT(RCC->IOPENR, (0U __MAP__(LL_BOARD_X_CLOCKS, 0U)));                                   \
+    LL_BOARD_INIT_PORT(__MAP__, GPIOA, LL_BOARD_PORT_A)                                                 \
+    LL_BOARD_INIT_PORT(__MAP__, GPIOB, LL_BOARD_PORT_B)                                                 \
+    LL_BOARD_INIT_PORT(__MAP__, GPIOC, LL_BOARD_PORT_C)                                                 \
+    LL_BOARD_INIT_PORT_D(__MAP__)                                                                       \
+    LL_BOARD_INIT_PORT_E(__MAP__)                                                                       \
+    LL_BOARD_INIT_PORT_H(__MAP__)                                                                       \
+  } while(0)
+
+/* Board pin maps -------------------------------------------------------------*/
+/* STM32L0xx_Nucleo: nucleo_l053r8, nucleo_l073rz */
+#define LL_BOARD_PINS_NUCLEO_64(X, P)                                  \
+  X(P, LD2,    A,  5, OUTPUT,    PUSHPULL, LOW,  NO, 0)                \
+  X(P, B1,     C, 13, INPUT,     PUSHPULL, LOW,  NO, 0)                \
+  X(P, VCP_TX, A,  2, ALTERNATE, PUSHPULL, HIGH, NO, 4)                \
+  X(P, VCP_RX, A,  3, ALTERNATE, PUSHPULL, HIGH, UP, 4)
+
+/* STM32L0xx_Nucleo_32: nucleo_l011k4, nucleo_l031k6 */
+#define LL_BOARD_PINS_NUCLEO_32(X, P)                                  \
+  X(P, LD3,    B,  3, OUTPUT,    PUSHPULL, LOW,  NO, 0)                \
+  X(P, VCP_TX, A,  2, ALTERNATE, PUSHPULL, HIGH, NO, 4)                \
+  X(P, VCP_RX, A, 15, ALTERNATE, PUSHPULL, HIGH, UP, 4)
+
+/* STM32L0538-Discovery: disco_l053c8 */
+#define LL_BOARD_PINS_DISCO_L053C8(X, P)                               \
+  X(P, LD3,    B,  4, OUTPUT,    PUSHPULL, LOW,  NO, 0)                \
+  X(P, LD4,    A,  5, OUTPUT,    PUSHPULL, LOW,  NO, 0)                \
+  X(P, B1,     A,  0, INPUT,     PUSHPULL, LOW,  NO, 0)
+
+#define LL_BOARD_PINS_NUCLEO_L053R8    LL_BOARD_PINS_NUCLEO_64
+#define LL_BOARD_PINS_NUCLEO_L073RZ    LL_BOARD_PINS_NUCLEO_64
+#define LL_BOARD_PINS_NUCLEO_L011K4    LL_BOARD_PINS_NUCLEO_32
+#define LL_BOARD_PINS_NUCLEO_L031K6    LL_BOARD_PINS_NUCLEO_32
+
+/* Clock tree ----------------------------------------------------------------*/
+#if (LL_BOARD_PLL_SOURCE == LL_BOARD_CLK_HSE)
+#define LL_BOARD_PLL_IN_HZ       HSE_VALUE
+#define LL_BOARD_PLLSRC          RCC_CFGR_PLLSRC_HSE
+#elif (LL_BOARD_PLL_SOURCE == LL_BOARD_CLK_HSI)
+#define LL_BOARD_PLL_IN_HZ       HSI_VALUE
+#define LL_BOARD_PLLSRC          RCC_CFGR_PLLSRC_HSI
+#else
+#error "LL_BOARD_PLL_SOURCE must be LL_BOARD_CLK_HSI or LL_BOARD_CLK_HSE"
+#endif
+#define LL_BOARD_PLL_VCO_HZ      (LL_BOARD_PLL_IN_HZ * LL_BOARD_PLL_MUL)
+
+#if (LL_BOARD_SYSCLK_SOURCE == LL_BOARD_CLK_PLL)
+#define LL_BOARD_SYSCLK_HZ       (LL_BOARD_PLL_VCO_HZ / LL_BOARD_PLL_DIV)
+#define LL_BOARD_VCO_HZ          LL_BOARD_PLL_VCO_HZ
+#define LL_BOARD_SW              RCC_CFGR_SW_PLL
+#define LL_BOARD_USES_HSE        (LL_BOARD_PLL_SOURCE == LL_BOARD_CLK_HSE)
+#elif (LL_BOARD_SYSCLK_SOURCE == LL_BOARD_CLK_HSE)
+#define LL_BOARD_SYSCLK_HZ       HSE_VALUE
+#define LL_BOARD_VCO_HZ          0U
+#define LL_BOARD_SW              RCC_CFGR_SW_HSE
+#define LL_BOARD_USES_HSE        1
+#elif (LL_BOARD_SYSCLK_SOURCE == LL_BOARD_CLK_HSI)
+#define LL_BOARD_SYSCLK_HZ       HSI_VALUE
+#define LL_BOARD_VCO_HZ          0U
+#define LL_BOARD_SW              RCC_CFGR_SW_HSI
+#define LL_BOARD_USES_HSE        0
+#else
+#error "LL_BOARD_SYSCLK_SOURCE must be LL_BOARD_CLK_HSI, LL_BOARD_CLK_HSE or LL_BOARD_CLK_PLL"
+#endif
+
+#define LL_BOARD_HCLK_HZ         (LL_BOARD_SYSCLK_HZ / LL_BOARD_AHB_DIV)
+#define LL_BOARD_PCLK1_HZ        (LL_BOARD_HCLK_HZ / LL_BOARD_APB1_DIV)
+#define LL_BOARD_PCLK2_HZ        (LL_BOARD_HCLK_HZ / LL_BOARD_APB2_DIV)
+
+/* Range 2 (reset value) up to 16 MHz and a 48 MHz VCO, range 1 above */
+#define LL_BOARD_VOS             (((LL_BOARD_SYSCLK_HZ > 16000000U) || (LL_BOARD_VCO_HZ > 48000000U)) ? \
+                                  PWR_CR_VOS_0 : PWR_CR_VOS_1)
+#define LL_BOARD_FLASH_LATENCY   ((LL_BOARD_HCLK_HZ > ((LL_BOARD_VOS == PWR_CR_VOS_0) ? 16000000U : 8000000U)) ? \
+                                  FLASH_ACR_LATENCY : 0U)
+
+#define LL_BOARD_HPRE            ((LL_BOARD_AHB_DIV == 1U)   ? RCC_CFGR_HPRE_DIV1   : \
+                                  (LL_BOARD_AHB_DIV == 2U)   ? RCC_CFGR_HPRE_DIV2   : \
+                                  (LL_BOARD_AHB_DIV == 4U)   ? RCC_CFGR_HPRE_DIV4   : \
+                                  (LL_BOARD_AHB_DIV == 8U)   ? RCC_CFGR_HPRE_DIV8   : \
+                                  (LL_BOARD_AHB_DIV == 16U)  ? RCC_CFGR_HPRE_DIV16  : \
+                                  (LL_BOARD_AHB_DIV == 64U)  ? RCC_CFGR_HPRE_DIV64  : \
+                                  (LL_BOARD_AHB_DIV == 128U) ? RCC_CFGR_HPRE_DIV128 : \
+                                  (LL_BOARD_AHB_DIV == 256U) ? RCC_CFGR_HPRE_DIV256 : RCC_CFGR_HPRE_DIV512)
+#define LL_BOARD_PPRE1           ((LL_BOARD_APB1_DIV == 1U)  ? RCC_CFGR_PPRE1_DIV1  : \
+                                  (LL_BOARD_APB1_DIV == 2U)  ? RCC_CFGR_PPRE1_DIV2  : \
+                                  (LL_BOARD_APB1_DIV == 4U)  ? RCC_CFGR_PPRE1_DIV4  : \
+                                  (LL_BOARD_APB1_DIV == 8U)  ? RCC_CFGR_PPRE1_DIV8  : RCC_CFGR_PPRE1_DIV16)
+#define LL_BOARD_PPRE2           ((LL_BOARD_APB2_DIV == 1U)  ? RCC_CFGR_PPRE2_DIV1  : \
+                                  (LL_BOARD_APB2_DIV == 2U)  ? RCC_CFGR_PPRE2_DIV2  : \
+                                  (LL_BOARD_APB2_DIV == 4U)  ? RCC_CFGR_PPRE2_DIV4  : \
+                                  (LL_BOARD_APB2_DIV == 8U)  ? RCC_CFGR_PPRE2_DIV8  : RCC_CFGR_PPRE2_DIV16)
+#define LL_BOARD_PLLMUL          ((LL_BOARD_PLL_MUL == 3U)   ? RCC_CFGR_PLLMUL3     : \
+                                  (LL_BOARD_PLL_MUL == 4U)   ? RCC_CFGR_PLLMUL4     : \
+                                  (LL_BOARD_PLL_MUL == 6U)   ? RCC_CFGR_PLLMUL6     : \
+                                  (LL_BOARD_PLL_MUL == 8U)   ? RCC_CFGR_PLLMUL8     : \
+                                  (LL_BOARD_PLL_MUL == 12U)  ? RCC_CFGR_PLLMUL12    : \
+                                  (LL_BOARD_PLL_MUL == 16U)  ? RCC_CFGR_PLLMUL16    : \
+                                  (LL_BOARD_PLL_MUL == 24U)  ? RCC_CFGR_PLLMUL24    : \
+                                  (LL_BOARD_PLL_MUL == 32U)  ? RCC_CFGR_PLLMUL32    : RCC_CFGR_PLLMUL48)
+
+#if (LL_BOARD_SYSCLK_SOURCE == LL_BOARD_CLK_PLL)
+#define LL_BOARD_CFGR            (LL_BOARD_PLLSRC | LL_BOARD_PLLMUL | ((LL_BOARD_PLL_DIV - 1U) << RCC_CFGR_PLLDIV_Pos))
+#else
+#define LL_BOARD_CFGR            0U
+#endif
+
+/* Clock tree checks */
+#if (LL_BOARD_SYSCLK_SOURCE == LL_BOARD_CLK_PLL)
+LL_BOARD_STATIC_ASSERT((LL_BOARD_PLL_MUL == 3U) || (LL_BOARD_PLL_MUL == 4U) || (LL_BOARD_PLL_MUL == 6U) ||
+                       (LL_BOARD_PLL_MUL == 8U) || (LL_BOARD_PLL_MUL == 12U) || (LL_BOARD_PLL_MUL == 16U) ||
+                       (LL_BOARD_PLL_MUL == 24U) || (LL_BOARD_PLL_MUL == 32U) || (LL_BOARD_PLL_MUL == 48U),
+                       "LL_BOARD_PLL_MUL not a PLL multiplication factor");
+LL_BOARD_STATIC_ASSERT((LL_BOARD_PLL_DIV >= 2U) && (LL_BOARD_PLL_DIV <= 4U), "LL_BOARD_PLL_DIV out of 2..4");
+LL_BOARD_STATIC_ASSERT((LL_BOARD_PLL_IN_HZ >= 2000000U) && (LL_BOARD_PLL_IN_HZ <= 24000000U), "PLL input out of 2..24 MHz");
+LL_BOARD_STATIC_ASSERT(LL_BOARD_PLL_VCO_HZ <= 96000000U, "PLL VCO above 96 MHz");
+#endif
+#if LL_BOARD_USES_HSE
+LL_BOARD_STATIC_ASSERT((HSE_VALUE >= 1000000U) && (HSE_VALUE <= 24000000U), "HSE_VALUE out of 1..24 MHz");
+#endif
+LL_BOARD_STATIC_ASSERT(LL_BOARD_SYSCLK_HZ <= 32000000U, "SYSCLK above 32 MHz");
+LL_BOARD_STATIC_ASSERT((LL_BOARD_AHB_DIV == 1U) || (LL_BOARD_AHB_DIV == 2U) || (LL_BOARD_AHB_DIV == 4U) ||
+                       (LL_BOARD_AHB_DIV == 8U) || (LL_BOARD_AHB_DIV == 16U) || (LL_BOARD_AHB_DIV == 64U) ||
+                       (LL_BOARD_AHB_DIV == 128U) || (LL_BOARD_AHB_DIV == 256U) || (LL_BOARD_AHB_DIV == 512U),
+                       "LL_BOARD_AHB_DIV not an AHB prescaler");
+LL_BOARD_STATIC_ASSERT((LL_BOARD_APB1_DIV == 1U) || (LL_BOARD_APB1_DIV == 2U) || (LL_BOARD_APB1_DIV == 4U) ||
+                       (LL_BOARD_APB1_DIV == 8U) || (LL_BOARD_APB1_DIV == 16U),
+                       "LL_BOARD_APB1_DIV not an APB prescaler");
+LL_BOARD_STATIC_ASSERT((LL_BOARD_APB2_DIV == 1U) || (LL_BOARD_APB2_DIV == 2U) || (LL_BOARD_APB2_DIV == 4U) ||
+                       (LL_BOARD_APB2_DIV == 8U) || (LL_BOARD_APB2_DIV == 16U),
+                       "LL_BOARD_APB2_DIV not an APB prescaler");
+
+/* Exported functions ------------------------------------------------------- */
+/**
+  * @brief  Wait for a ready flag
+  * @param  pReg: register
+  * @param  Mask: flag bits
+  * @param  Value: expected value of the flag bits
+  * @retval SUCCESS, ERROR after LL_BOARD_STARTUP_LOOPS reads
+  */
+__STATIC_INLINE ErrorStatus LL_Board_WaitFlag(__IO uint32_t *pReg, uint32_t Mask, uint32_t Value)
+{
+  uint32_t count = LL_BOARD_STARTUP_LOOPS;
+
+  while ((*pReg & Mask) != Value)
+  {
+    if (--count == 0U)
+    {
+      return ERROR;
+    }
+  }
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Program the clock tree of the LL_BOARD_xxx defines, from the
+  *         reset configuration (MSI, range 2, PLL off)
+  * @retval SUCCESS, ERROR if an oscillator or the PLL does not start
+  */
+__STATIC_INLINE ErrorStatus LL_Board_ClockInit(void)
+{
+  /* Voltage range before raising the frequency */
+  if (LL_BOARD_VOS != PWR_CR_VOS_1)
+  {
+    SET_BIT(RCC->APB1ENR, RCC_APB1ENR_PWREN);
+    (void)READ_BIT(RCC->APB1ENR, RCC_APB1ENR_PWREN);
+    MODIFY_REG(PWR->CR, PWR_CR_VOS, LL_BOARD_VOS);
+    if (LL_Board_WaitFlag(&PWR->CSR, PWR_CSR_VOSF, 0U) != SUCCESS)
+    {
+      return ERROR;
+    }
+  }
+
+  /* Wait states, checked before the frequency is raised */
+  MODIFY_REG(FLASH->ACR, FLASH_ACR_LATENCY | FLASH_ACR_PRFTEN,
+             LL_BOARD_FLASH_LATENCY | ((LL_BOARD_FLASH_LATENCY != 0U) ? FLASH_ACR_PRFTEN : 0U));
+  if (LL_Board_WaitFlag(&FLASH->ACR, FLASH_ACR_LATENCY, LL_BOARD_FLASH_LATENCY) != SUCCESS)
+  {
+    return ERROR;
+  }
+
+#if LL_BOARD_USES_HSE
+  if (LL_BOARD_HSE_BYPASS != 0U)
+  {
+    SET_BIT(RCC->CR, RCC_CR_HSEBYP);
+  }
+  SET_BIT(RCC->CR, RCC_CR_HSEON);
+  if (LL_Board_WaitFlag(&RCC->CR, RCC_CR_HSERDY, RCC_CR_HSERDY) != SUCCESS)
+  {
+    return ERROR;
+  }
+#else
+  SET_BIT(RCC->CR, RCC_CR_HSION);
+  if (LL_Board_WaitFlag(&RCC->CR, RCC_CR_HSIRDY, RCC_CR_HSIRDY) != SUCCESS)
+  {
+    return ERROR;
+  }
+#endif
+
+#if (LL_BOARD_SYSCLK_SOURCE == LL_BOARD_CLK_PLL)
+  WRITE_REG(RCC->CFGR, LL_BOARD_CFGR);
+  SET_BIT(RCC->CR, RCC_CR_PLLON);
+  if (LL_Board_WaitFlag(&RCC->CR, RCC_CR_PLLRDY, RCC_CR_PLLRDY) != SUCCESS)
+  {
+    return ERROR;
+  }
+#endif
+
+  /* Prescalers and switch in one write */
+  WRITE_REG(RCC->CFGR, LL_BOARD_CFGR | LL_BOARD_HPRE | LL_BOARD_PPRE1 | LL_BOARD_PPRE2 | LL_BOARD_SW);
+  if (LL_Board_WaitFlag(&RCC->CFGR, RCC_CFGR_SWS, LL_BOARD_SW << 2U) != SUCCESS)
+  {
+    return ERROR;
+  }
+
+  SystemCoreClock = LL_BOARD_HCLK_HZ;
+
+  return SUCCESS;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _LL_BOARD_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,440 @@
+/**
+  ******************************************************************************
+  * @file    ll_lite.c
+  * @author  MCD Application Team
+  * @brief   Size optimized UART, I2C and ADC services over the LL drivers:
+  *          compile time configuration, no handle
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- enable the services in main.h (LL_LITE_UART, LL_LITE_I2C, LL_LITE_ADC)
+   and override the instance, DMA channel and clock groups when the
+   defaults of ll_lite.h do not fit the part, ex. for the STM32F030F4,
+   which has no USART2 :
+      #define LL_LITE_UART             1
+      #define LL_LITE_UART_INSTANCE    USART1
+      #define LL_LITE_UART_CLK_ENABLE() LL_APB1_GRP2_EnableClock(LL_APB1_GRP2_PERIPH_USART1)
+      #define LL_LITE_UART_CLOCK_HZ    LL_BOARD_PCLK_HZ
+      #define LL_LITE_UART_DMA_CHANNEL LL_DMA_CHANNEL_3
+   The pins are configured by the board pin map of ll_board.h
+   (LL_BOARD_GPIO_INIT()) and the clocks by LL_Board_ClockInit(): the
+   baud rate, the I2C timing and the checks are computed from its
+   constants at compile time. There is no handle: each function works on
+   the configured instance, with constant register addresses.
+
+2- UART: LL_Lite_UART_Init() starts the reception into a ring of
+   LL_LITE_UART_RING_SIZE bytes by a circular DMA transfer. No interrupt
+   is used: LL_Lite_UART_Available() and LL_Lite_UART_Read() compute the
+   write position from the DMA counter. The ring must be read before
+   LL_LITE_UART_RING_SIZE more bytes arrive. LL_Lite_UART_Write() sends
+   by polling.
+
+3- I2C: LL_Lite_I2C_WriteReg() and LL_Lite_I2C_ReadReg() access up to 254
+   or 255 bytes from a register of an 8-bit register address device,
+   Address being the 7-bit device address. They return ERROR on a NACK or
+   after LL_LITE_TIMEOUT_LOOPS polling loops.
+
+4- ADC: LL_Lite_ADC_Init() calibrates and enables the ADC on the
+   LL_LITE_ADC_CHANNELS sequence. With LL_LITE_ADC_DMA, LL_Lite_ADC_Start()
+   starts continuous scans written by a circular DMA transfer and
+   LL_Lite_ADC_Get() returns the last value of a rank, 0 for the lowest
+   channel. Otherwise LL_Lite_ADC_Scan() converts the sequence once.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "ll_lite.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+#if LL_LITE_UART
+static uint8_t  LiteUartRing[LL_LITE_UART_RING_SIZE];
+static uint32_t LiteUartTail;
+#endif
+
+#if LL_LITE_ADC && LL_LITE_ADC_DMA
+static __IO uint16_t LiteAdcValues[LL_LITE_ADC_CHANNEL_NBR];
+#endif
+
+/* Private function prototypes -----------------------------------------------*/
+#if LL_LITE_I2C
+static ErrorStatus Lite_I2C_Wait(uint32_t Flag);
+static ErrorStatus Lite_I2C_Stop(void);
+#endif
+
+/* Private functions ---------------------------------------------------------*/
+#if LL_LITE_UART
+/**
+  * @brief  Start the UART and its DMA reception
+  * @retval None
+  */
+void LL_Lite_UART_Init(void)
+{
+  LL_LITE_UART_CLK_ENABLE();
+  LL_AHB1_GRP1_EnableClock(LL_AHB1_GRP1_PERIPH_DMA1);
+
+  LL_DMA_ConfigTransfer(DMA1, LL_LITE_UART_DMA_CHANNEL,
+                        LL_DMA_DIRECTION_PERIPH_TO_MEMORY | LL_DMA_MODE_CIRCULAR |
+                        LL_DMA_PERIPH_NOINCREMENT | LL_DMA_MEMORY_INCREMENT |
+                        LL_DMA_PDATAALIGN_BYTE | LL_DMA_MDATAALIGN_BYTE | LL_DMA_PRIORITY_HIGH);
+  LL_DMA_SetPeriphAddress(DMA1, LL_LITE_UART_DMA_CHANNEL, (uint32_t)&LL_LITE_UART_INSTANCE->RDR);
+  LL_DMA_SetMemoryAddress(DMA1, LL_LITE_UART_DMA_CHANNEL, (uint32_t)LiteUartRing);
+  LL_DMA_SetDataLength(DMA1, LL_LITE_UART_DMA_CHANNEL, LL_LITE_UART_RING_SIZE);
+  LL_DMA_SetPeriphRequest(DMA1, LL_LITE_UART_DMA_CHANNEL, LL_LITE_UART_DMA_REQUEST);
+  LL_DMA_EnableChannel(DMA1, LL_LITE_UART_DMA_CHANNEL);
+  LiteUartTail = 0U;
+
+  /* 8N1, oversampling by 16; an overrun does not stop the reception */
+  WRITE_REG(LL_LITE_UART_INSTANCE->BRR, (LL_LITE_UART_CLOCK_HZ + (LL_LITE_UART_BAUDRATE / 2U)) / LL_LITE_UART_BAUDRATE);
+  WRITE_REG(LL_LITE_UART_INSTANCE->CR3, USART_CR3_DMAR | USART_CR3_OVRDIS);
+  WRITE_REG(LL_LITE_UART_INSTANCE->CR1, USART_CR1_UE | USART_CR1_RE | USART_CR1_TE);
+}
+
+/**
+  * @brief  Number of received bytes not read yet
+  * @retval Number of bytes
+  */
+uint32_t LL_Lite_UART_Available(void)
+{
+  uint32_t head = LL_LITE_UART_RING_SIZE - LL_DMA_GetDataLength(DMA1, LL_LITE_UART_DMA_CHANNEL);
+
+  return (head - LiteUartTail) & (LL_LITE_UART_RING_SIZE - 1U);
+}
+
+/**
+  * @brief  Read received bytes
+  * @param  pData: destination
+  * @param  Size: largest number of bytes
+  * @retval Number of bytes read
+  */
+uint32_t LL_Lite_UART_Read(uint8_t *pData, uint32_t Size)
+{
+  uint32_t count = LL_Lite_UART_Available();
+  uint32_t i;
+
+  if (count > Size)
+  {
+    count = Size;
+  }
+  for (i = 0U; i < count; i++)
+  {
+    pData[i] = LiteUartRing[LiteUartTail];
+    LiteUartTail = (LiteUartTail + 1U) & (LL_LITE_UART_RING_SIZE - 1U);
+  }
+
+  return count;
+}
+
+/**
+  * @brief  Send bytes, returns once the last one is in the transmit register
+  * @param  pData: data
+  * @param  Size: number of bytes
+  * @retval None
+  */
+void LL_Lite_UART_Write(const uint8_t *pData, uint32_t Size)
+{
+  while (Size-- != 0U)
+  {
+    while (!LL_USART_IsActiveFlag_TXE(LL_LITE_UART_INSTANCE))
+    {
+    }
+    LL_USART_TransmitData8(LL_LITE_UART_INSTANCE, *pData++);
+  }
+}
+#endif /* LL_LITE_UART */
+
+#if LL_LITE_I2C
+/**
+  * @brief  Enable the I2C in master mode
+  * @retval None
+  */
+void LL_Lite_I2C_Init(void)
+{
+  LL_LITE_I2C_CLK_ENABLE();
+
+  CLEAR_BIT(LL_LITE_I2C_INSTANCE->CR1, I2C_CR1_PE);
+  WRITE_REG(LL_LITE_I2C_INSTANCE->TIMINGR, LL_LITE_I2C_TIMING);
+  WRITE_REG(LL_LITE_I2C_INSTANCE->CR1, I2C_CR1_PE);
+}
+
+/**
+  * @brief  Write registers of a device
+  * @param  Address: 7-bit device address
+  * @param  Reg: first register
+  * @param  pData: data
+  * @param  Size: number of bytes, up to 254
+  * @retval SUCCESS, ERROR on a NACK or a timeout
+  */
+ErrorStatus LL_Lite_I2C_WriteReg(uint8_t Address, uint8_t Reg, const uint8_t *pData, uint32_t Size)
+{
+  if (Size > 254U)
+  {
+    return ERROR;
+  }
+
+  WRITE_REG(LL_LITE_I2C_INSTANCE->CR2, ((uint32_t)Address << 1) | ((Size + 1U) << I2C_CR2_NBYTES_Pos) |
+                                       I2C_CR2_AUTOEND | I2C_CR2_START);
+  if (Lite_I2C_Wait(I2C_ISR_TXIS) != SUCCESS)
+  {
+    return ERROR;
+  }
+  LL_I2C_TransmitData8(LL_LITE_I2C_INSTANCE, Reg);
+
+  while (Size-- != 0U)
+  {
+    if (Lite_I2C_Wait(I2C_ISR_TXIS) != SUCCESS)
+    {
+      return ERROR;
+    }
+    LL_I2C_TransmitData8(LL_LITE_I2C_INSTANCE, *pData++);
+  }
+
+  return Lite_I2C_Stop();
+}
+
+/**
+  * @brief  Read registers of a device
+  * @param  Address: 7-bit device address
+  * @param  Reg: first register
+  * @param  pData: destination
+  * @param  Size: number of bytes, 1 to 255
+  * @retval SUCCESS, ERROR on a NACK or a timeout
+  */
+ErrorStatus LL_Lite_I2C_ReadReg(uint8_t Address, uint8_t Reg, uint8_t *pData, uint32_t Size)
+{
+  if ((Size == 0U) || (Size > 255U))
+  {
+    return ERROR;
+  }
+
+  /* Register address, then a repeated start */
+  WRITE_REG(LL_LITE_I2C_INSTANCE->CR2, ((uint32_t)Address << 1) | (1U << I2C_CR2_NBYTES_Pos) | I2C_CR2_START);
+  if (Lite_I2C_Wait(I2C_ISR_TXIS) != SUCCESS)
+  {
+    return ERROR;
+  }
+  LL_I2C_TransmitData8(LL_LITE_I2C_INSTANCE, Reg);
+  if (Lite_I2C_Wait(I2C_ISR_TC) != SUCCESS)
+  {
+    return ERROR;
+  }
+
+  WRITE_REG(LL_LITE_I2C_INSTANCE->CR2, ((uint32_t)Address << 1) | (Size << I2C_CR2_NBYTES_Pos) |
+                                       I2C_CR2_RD_WRN | I2C_CR2_AUTOEND | I2C_CR2_START);
+  while (Size-- != 0U)
+  {
+    if (Lite_I2C_Wait(I2C_ISR_RXNE) != SUCCESS)
+    {
+      return ERROR;
+    }
+    *pData++ = LL_I2C_ReceiveData8(LL_LITE_I2C_INSTANCE);
+  }
+
+  return Lite_I2C_Stop();
+}
+
+/**
+  * @brief  Wait for a transfer flag
+  * @param  Flag: I2C_ISR_xxx flag
+  * @retval SUCCESS, ERROR on a NACK or a timeout
+  */
+static ErrorStatus Lite_I2C_Wait(uint32_t Flag)
+{
+  uint32_t count = LL_LITE_TIMEOUT_LOOPS;
+  uint32_t isr;
+
+  do
+  {
+    isr = READ_REG(LL_LITE_I2C_INSTANCE->ISR);
+    if ((isr & I2C_ISR_NACKF) != 0U)
+    {
+      /* The stop condition follows the NACK */
+      (void)Lite_I2C_Stop();
+      WRITE_REG(LL_LITE_I2C_INSTANCE->ICR, I2C_ICR_NACKCF);
+      return ERROR;
+    }
+    if ((isr & Flag) != 0U)
+    {
+      return SUCCESS;
+    }
+  } while (--count != 0U);
+
+  /* Reset the peripheral out of a stuck transfer */
+  CLEAR_BIT(LL_LITE_I2C_INSTANCE->CR1, I2C_CR1_PE);
+  SET_BIT(LL_LITE_I2C_INSTANCE->CR1, I2C_CR1_PE);
+
+  return ERROR;
+}
+
+/**
+  * @brief  Wait for the stop condition of a transfer and clear it
+  * @retval SUCCESS, ERROR on a timeout
+  */
+static ErrorStatus Lite_I2C_Stop(void)
+{
+  uint32_t count = LL_LITE_TIMEOUT_LOOPS;
+
+  while (!LL_I2C_IsActiveFlag_STOP(LL_LITE_I2C_INSTANCE))
+  {
+    if (--count == 0U)
+    {
+      return ERROR;
+    }
+  }
+  WRITE_REG(LL_LITE_I2C_INSTANCE->ICR, I2C_ICR_STOPCF);
+  /* Flush a data byte left by a NACK */
+  WRITE_REG(LL_LITE_I2C_INSTANCE->ISR, I2C_ISR_TXE);
+
+  return SUCCESS;
+}
+#endif /* LL_LITE_I2C */
+
+#if LL_LITE_ADC
+/**
+  * @brief  Calibrate and enable the ADC on the LL_LITE_ADC_CHANNELS sequence
+  * @retval SUCCESS, ERROR on a timeout
+  */
+ErrorStatus LL_Lite_ADC_Init(void)
+{
+  uint32_t count = LL_LITE_TIMEOUT_LOOPS;
+
+  LL_APB2_GRP1_EnableClock(LL_APB2_GRP1_PERIPH_ADC1);
+  LL_ADC_SetClock(ADC1, LL_LITE_ADC_CLOCK);
+
+  /* Voltage regulator start-up time */
+  LL_ADC_EnableInternalRegulator(ADC1);
+  for (count = (LL_ADC_DELAY_INTERNAL_REGUL_STAB_US * (LL_BOARD_HCLK_HZ / 1000000U)) / 4U; count != 0U; count--)
+  {
+    __NOP();
+  }
+  count = LL_LITE_TIMEOUT_LOOPS;
+
+  LL_ADC_StartCalibration(ADC1);
+  while (LL_ADC_IsCalibrationOnGoing(ADC1) != 0U)
+  {
+    if (--count == 0U)
+    {
+      return ERROR;
+    }
+  }
+
+  LL_ADC_SetSamplingTimeCommonChannels(ADC1, LL_LITE_ADC_SAMPLING);
+  LL_ADC_REG_SetSequencerChannels(ADC1, LL_LITE_ADC_CHANNELS);
+#if LL_LITE_ADC_DMA
+  LL_AHB1_GRP1_EnableClock(LL_AHB1_GRP1_PERIPH_DMA1);
+  LL_DMA_ConfigTransfer(DMA1, LL_LITE_ADC_DMA_CHANNEL,
+                        LL_DMA_DIRECTION_PERIPH_TO_MEMORY | LL_DMA_MODE_CIRCULAR |
+                        LL_DMA_PERIPH_NOINCREMENT | LL_DMA_MEMORY_INCREMENT |
+                        LL_DMA_PDATAALIGN_HALFWORD | LL_DMA_MDATAALIGN_HALFWORD | LL_DMA_PRIORITY_LOW);
+  LL_DMA_SetPeriphAddress(DMA1, LL_LITE_ADC_DMA_CHANNEL, (uint32_t)&ADC1->DR);
+  LL_DMA_SetMemoryAddress(DMA1, LL_LITE_ADC_DMA_CHANNEL, (uint32_t)LiteAdcValues);
+  LL_DMA_SetDataLength(DMA1, LL_LITE_ADC_DMA_CHANNEL, LL_LITE_ADC_CHANNEL_NBR);
+  LL_DMA_SetPeriphRequest(DMA1, LL_LITE_ADC_DMA_CHANNEL, LL_LITE_ADC_DMA_REQUEST);
+  LL_DMA_EnableChannel(DMA1, LL_LITE_ADC_DMA_CHANNEL);
+
+  /* Continuous scans, the data register overwritten when the DMA is late */
+  WRITE_REG(ADC1->CFGR1, ADC_CFGR1_CONT | ADC_CFGR1_OVRMOD | ADC_CFGR1_DMACFG | ADC_CFGR1_DMAEN);
+#else
+  WRITE_REG(ADC1->CFGR1, ADC_CFGR1_OVRMOD);
+#endif
+
+  LL_ADC_ClearFlag_ADRDY(ADC1);
+  LL_ADC_Enable(ADC1);
+  count = LL_LITE_TIMEOUT_LOOPS;
+  while (LL_ADC_IsActiveFlag_ADRDY(ADC1) == 0U)
+  {
+    if (--count == 0U)
+    {
+      return ERROR;
+    }
+  }
+
+  return SUCCESS;
+}
+
+#if LL_LITE_ADC_DMA
+/**
+  * @brief  Start the continuous scans
+  * @retval None
+  */
+void LL_Lite_ADC_Start(void)
+{
+  LL_ADC_REG_StartConversion(ADC1);
+}
+
+/**
+  * @brief  Last conversion of a rank of the sequence
+  * @param  Rank: rank, 0 for the lowest channel of LL_LITE_ADC_CHANNELS
+  * @retval Conversion
+  */
+uint16_t LL_Lite_ADC_Get(uint32_t Rank)
+{
+  return LiteAdcValues[Rank];
+}
+#else
+/**
+  * @brief  Convert the sequence once
+  * @param  pValues: LL_LITE_ADC_CHANNEL_NBR conversions, by channel order
+  * @retval SUCCESS, ERROR on a timeout
+  */
+ErrorStatus LL_Lite_ADC_Scan(uint16_t *pValues)
+{
+  uint32_t rank;
+  uint32_t count;
+
+  LL_ADC_ClearFlag_EOS(ADC1);
+  LL_ADC_REG_StartConversion(ADC1);
+  for (rank = 0U; rank < LL_LITE_ADC_CHANNEL_NBR; rank++)
+  {
+    count = LL_LITE_TIMEOUT_LOOPS;
+    while (LL_ADC_IsActiveFlag_EOC(ADC1) == 0U)
+    {
+      if (--count == 0U)
+      {
+        LL_ADC_REG_StopConversion(ADC1);
+        return ERROR;
+      }
+    }
+    /* Reading the data clears EOC */
+    pValues[rank] = LL_ADC_REG_ReadConversionData12(ADC1);
+  }
+
+  return SUCCESS;
+}
+#endif /* LL_LITE_ADC_DMA */
+#endif /* LL_LITE_ADC */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
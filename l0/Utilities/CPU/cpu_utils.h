@@ -46,8 +46,35 @@
 /* Includes ------------------------------------------------------------------*/
 #include "main.h"
 
-/* Exported types ------------------------------------------------------------*/
 /* Exported constants --------------------------------------------------------*/
+/* Number of tasks and interrupts followed by the profiler. Override in main.h. */
+#if !defined(CPU_PROFILE_MAX_TASKS)
+#define CPU_PROFILE_MAX_TASKS     8U
+#endif
+#if !defined(CPU_PROFILE_MAX_IRQS)
+#define CPU_PROFILE_MAX_IRQS      8U
+#endif
+
+/* Histogram bin 0 counts runs shorter than 2^CPU_PROFILE_HIST_SHIFT cycles,
+   bin n counts runs of 2^(CPU_PROFILE_HIST_SHIFT+n-1) cycles or more, the last
+   bin has no upper bound. */
+#if !defined(CPU_PROFILE_HIST_BINS)
+#define CPU_PROFILE_HIST_BINS     16U
+#endif
+#if !defined(CPU_PROFILE_HIST_SHIFT)
+#define CPU_PROFILE_HIST_SHIFT    6U
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t Id;                                /* Task handle, or exception number (IRQn + 16), 0 when unused */
+  uint32_t Count;                             /* Number of runs                                               */
+  uint64_t Cycles;                            /* Cumulative cycles                                            */
+  uint32_t MaxCycles;                         /* Longest run in cycles                                        */
+  uint32_t Histogram[CPU_PROFILE_HIST_BINS];  /* Number of runs per duration bin                              */
+} CPU_ProfileTypeDef;
+
 /* Exported variables --------------------------------------------------------*/
 /* Exported macro ------------------------------------------------------------*/
 #define CALCULATION_PERIOD    1000
@@ -55,6 +82,13 @@
 /* Exported functions ------------------------------------------------------- */
 uint16_t osGetCPUUsage (void);
 
+void     CPU_ProfileInit (void);
+uint32_t CPU_ProfileGetCycles (void);
+void     CPU_ProfileIrqEnter (IRQn_Type IRQn);
+void     CPU_ProfileIrqExit (IRQn_Type IRQn);
+uint32_t CPU_ProfileGetTask (uint32_t Index, CPU_ProfileTypeDef *pProfile);
+uint32_t CPU_ProfileGetIrq (uint32_t Index, CPU_ProfileTypeDef *pProfile);
+
 #ifdef __cplusplus
 }
 #endif
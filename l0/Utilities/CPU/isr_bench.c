@@ -0,0 +1,533 @@
+/**
+  ******************************************************************************
+  * @file    isr_bench.h
+  * @author  MCD Application Team
+  * @brief   Interrupt handler latency and duration benchmark
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- call ISR_Bench_Init() once the HAL is initialized, then
+   ISR_Bench_Register() for each handler benchmarked, e.g. :
+      ISR_Bench_Register(0, "UART", USART2_IRQn);
+      ISR_Bench_Register(1, "DMA",  DMA1_Stream6_IRQn);
+
+2- in stm32xxx_it.c, bracket the HAL handler of each of them :
+      void USART2_IRQHandler(void)
+      {
+        ISR_BENCH_ENTER(0);
+        HAL_UART_IRQHandler(&huart2);
+        ISR_BENCH_EXIT(0);
+      }
+   Each run records the handler duration. When the interrupt was raised
+   through ISR_Bench_Run() or after ISR_Bench_Arm(), it also records the
+   entry latency, from the trigger to the first handler instruction.
+
+3- call ISR_Bench_Run() from thread mode to raise the interrupt a number
+   of times while the CPU runs a controlled background load (polling,
+   block copy or divisions), at a pseudo-random point of the load so that
+   the entry jitter covers the instructions being interrupted. Without
+   pTrigger, the interrupt is pended in the NVIC and the handler runs the
+   HAL code with no flag set: the HAL dispatch cost. With pTrigger, the
+   application raises it through the peripheral (UART TXE enable, DMA
+   memory to memory start, SPI loopback...) and measures the full path.
+
+4- read the statistics with ISR_Bench_GetStats(), or get them all as a
+   JSON document with ISR_Bench_Report() to send over a console and
+   compare between HAL releases. Counts are in core clock cycles, less
+   the cost of reading the counter measured by ISR_Bench_Init().
+   Cortex-M0/M0+ have no DWT cycle counter: the SysTick current value is
+   used instead, so a measure must not span more than one SysTick period.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "isr_bench.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static ISR_Bench_StatsTypeDef ISR_Bench_Stats[ISR_BENCH_MAX];
+static __IO uint32_t          ISR_Bench_TriggerTime[ISR_BENCH_MAX];
+static __IO uint32_t          ISR_Bench_Armed[ISR_BENCH_MAX];
+static __IO uint32_t          ISR_Bench_Done[ISR_BENCH_MAX];
+static uint32_t               ISR_Bench_Overhead = 0U;
+static uint32_t               ISR_Bench_Random = 0x2545F491U;
+static uint32_t               ISR_Bench_Load[2][ISR_BENCH_LOAD_WORDS];
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t ISR_Bench_Elapsed(uint32_t From, uint32_t To);
+static uint32_t ISR_Bench_Correct(uint32_t Cycles);
+static void     ISR_Bench_RunLoad(uint32_t Id, const ISR_Bench_RunTypeDef *pRun, uint32_t TriggerAt);
+static void     ISR_Bench_Append(char *pBuffer, uint32_t Size, uint32_t *pLength, const char *pFormat, ...);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Start the cycle counter and measure the cost of reading it
+  * @param  None
+  * @retval None
+  */
+void ISR_Bench_Init(void)
+{
+  uint32_t first;
+  uint32_t second;
+  uint32_t i;
+
+  memset(ISR_Bench_Stats, 0, sizeof(ISR_Bench_Stats));
+
+#if (__CORTEX_M >= 3U)
+  /* Enable the DWT cycle counter */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#if (__CORTEX_M == 7U)
+  DWT->LAR = 0xC5ACCE55U;
+#endif
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+  /* Two reads back to back, the shortest of a few tries */
+  ISR_Bench_Overhead = 0xFFFFFFFFU;
+  for(i = 0U; i < 8U; i++)
+  {
+    first  = ISR_BENCH_TIMESTAMP();
+    second = ISR_BENCH_TIMESTAMP();
+    if(ISR_Bench_Elapsed(first, second) < ISR_Bench_Overhead)
+    {
+      ISR_Bench_Overhead = ISR_Bench_Elapsed(first, second);
+    }
+  }
+}
+
+/**
+  * @brief  Declare a benchmarked interrupt handler
+  * @param  Id: benchmark entry, from 0 to ISR_BENCH_MAX - 1
+  * @param  Name: name in the report, kept by the module
+  * @param  IRQn: interrupt of the handler
+  * @retval HAL status
+  */
+HAL_StatusTypeDef ISR_Bench_Register(uint32_t Id, const char *Name, IRQn_Type IRQn)
+{
+  if((Id >= ISR_BENCH_MAX) || (Name == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  ISR_Bench_Stats[Id].Name = Name;
+  ISR_Bench_Stats[Id].IRQn = IRQn;
+  ISR_Bench_Reset(Id);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Clear the statistics of a benchmark entry
+  * @param  Id: benchmark entry
+  * @retval None
+  */
+void ISR_Bench_Reset(uint32_t Id)
+{
+  ISR_Bench_StatsTypeDef *stats;
+  uint32_t               primask;
+
+  if(Id >= ISR_BENCH_MAX)
+  {
+    return;
+  }
+
+  stats = &ISR_Bench_Stats[Id];
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  stats->Count       = 0U;
+  stats->Triggered   = 0U;
+  stats->LatencyMin  = 0xFFFFFFFFU;
+  stats->LatencyMax  = 0U;
+  stats->LatencySum  = 0U;
+  stats->DurationMin = 0xFFFFFFFFU;
+  stats->DurationMax = 0U;
+  stats->DurationSum = 0U;
+  memset(stats->LatencyHist, 0, sizeof(stats->LatencyHist));
+  memset(stats->DurationHist, 0, sizeof(stats->DurationHist));
+  ISR_Bench_Armed[Id] = 0U;
+
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Take the trigger time of the next run of a handler
+  * @note   Call it right before the register write raising the interrupt.
+  * @param  Id: benchmark entry
+  * @retval None
+  */
+void ISR_Bench_Arm(uint32_t Id)
+{
+  if(Id < ISR_BENCH_MAX)
+  {
+    ISR_Bench_Armed[Id]       = 1U;
+    ISR_Bench_TriggerTime[Id] = ISR_BENCH_TIMESTAMP();
+  }
+}
+
+/**
+  * @brief  Account one handler run, called by ISR_BENCH_EXIT()
+  * @param  Id: benchmark entry
+  * @param  Entry: cycle count taken by ISR_BENCH_ENTER()
+  * @retval None
+  */
+void ISR_Bench_Record(uint32_t Id, uint32_t Entry)
+{
+  uint32_t               now = ISR_BENCH_TIMESTAMP();
+  ISR_Bench_StatsTypeDef *stats;
+  uint32_t               cycles;
+  uint32_t               bin;
+
+  if((Id >= ISR_BENCH_MAX) || (ISR_Bench_Stats[Id].Name == NULL))
+  {
+    return;
+  }
+  stats = &ISR_Bench_Stats[Id];
+
+  /* Handler duration, log2 bins */
+  cycles = ISR_Bench_Correct(ISR_Bench_Elapsed(Entry, now));
+  stats->Count++;
+  stats->DurationSum += cycles;
+  if(cycles < stats->DurationMin)
+  {
+    stats->DurationMin = cycles;
+  }
+  if(cycles > stats->DurationMax)
+  {
+    stats->DurationMax = cycles;
+  }
+  bin = 0U;
+  cycles >>= ISR_BENCH_DURATION_SHIFT;
+  while((cycles != 0U) && (bin < (ISR_BENCH_BINS - 1U)))
+  {
+    cycles >>= 1U;
+    bin++;
+  }
+  stats->DurationHist[bin]++;
+
+  /* Entry latency, linear bins */
+  if(ISR_Bench_Armed[Id] != 0U)
+  {
+    ISR_Bench_Armed[Id] = 0U;
+
+    cycles = ISR_Bench_Correct(ISR_Bench_Elapsed(ISR_Bench_TriggerTime[Id], Entry));
+    stats->Triggered++;
+    stats->LatencySum += cycles;
+    if(cycles < stats->LatencyMin)
+    {
+      stats->LatencyMin = cycles;
+    }
+    if(cycles > stats->LatencyMax)
+    {
+      stats->LatencyMax = cycles;
+    }
+    bin = cycles / ISR_BENCH_LATENCY_WIDTH;
+    if(bin > (ISR_BENCH_BINS - 1U))
+    {
+      bin = ISR_BENCH_BINS - 1U;
+    }
+    stats->LatencyHist[bin]++;
+  }
+
+  ISR_Bench_Done[Id] = 1U;
+}
+
+/**
+  * @brief  Raise a benchmarked interrupt repeatedly under a background load
+  * @param  Id: benchmark entry
+  * @param  pRun: run parameters
+  * @retval HAL_OK, HAL_TIMEOUT when the handler did not run in time
+  */
+HAL_StatusTypeDef ISR_Bench_Run(uint32_t Id, const ISR_Bench_RunTypeDef *pRun)
+{
+  uint32_t tickstart;
+  uint32_t i;
+
+  if((Id >= ISR_BENCH_MAX) || (ISR_Bench_Stats[Id].Name == NULL) || (pRun == NULL) ||
+     ((pRun->pTrigger == NULL) && ((int32_t)ISR_Bench_Stats[Id].IRQn < 0)))
+  {
+    return HAL_ERROR;
+  }
+
+  for(i = 0U; i < pRun->Iterations; i++)
+  {
+    /* xorshift32, trigger point in the load */
+    ISR_Bench_Random ^= ISR_Bench_Random << 13U;
+    ISR_Bench_Random ^= ISR_Bench_Random >> 17U;
+    ISR_Bench_Random ^= ISR_Bench_Random << 5U;
+
+    ISR_Bench_Done[Id] = 0U;
+    ISR_Bench_RunLoad(Id, pRun, ISR_Bench_Random % ISR_BENCH_LOAD_WORDS);
+
+    tickstart = HAL_GetTick();
+    while(ISR_Bench_Done[Id] == 0U)
+    {
+      if((HAL_GetTick() - tickstart) > pRun->Timeout)
+      {
+        ISR_Bench_Armed[Id] = 0U;
+        return HAL_TIMEOUT;
+      }
+    }
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Copy the statistics of a benchmark entry
+  * @param  Id: benchmark entry
+  * @param  pStats: destination of the statistics
+  * @retval HAL_OK, HAL_ERROR when the entry is not registered
+  */
+HAL_StatusTypeDef ISR_Bench_GetStats(uint32_t Id, ISR_Bench_StatsTypeDef *pStats)
+{
+  uint32_t primask;
+
+  if((Id >= ISR_BENCH_MAX) || (ISR_Bench_Stats[Id].Name == NULL) || (pStats == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  *pStats = ISR_Bench_Stats[Id];
+  __set_PRIMASK(primask);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Write the statistics of every registered handler as JSON
+  * @param  pBuffer: destination, zero terminated
+  * @param  Size: destination size in bytes
+  * @retval Length of the report, 0 when it does not fit
+  */
+uint32_t ISR_Bench_Report(char *pBuffer, uint32_t Size)
+{
+  ISR_Bench_StatsTypeDef stats;
+  uint32_t               length = 0U;
+  uint32_t               first = 1U;
+  uint32_t               id;
+  uint32_t               bin;
+
+  if((pBuffer == NULL) || (Size == 0U))
+  {
+    return 0U;
+  }
+
+  ISR_Bench_Append(pBuffer, Size, &length,
+                   "{\"hal\":\"0x%08lx\",\"core\":%lu,\"counter\":\"%s\",\"overhead\":%lu,\"irqs\":[",
+                   (unsigned long)HAL_GetHalVersion(), (unsigned long)SystemCoreClock,
+#if (__CORTEX_M >= 3U)
+                   "dwt",
+#else
+                   "systick",
+#endif
+                   (unsigned long)ISR_Bench_Overhead);
+
+  for(id = 0U; id < ISR_BENCH_MAX; id++)
+  {
+    if(ISR_Bench_GetStats(id, &stats) != HAL_OK)
+    {
+      continue;
+    }
+
+    ISR_Bench_Append(pBuffer, Size, &length,
+                     "%s{\"name\":\"%s\",\"irqn\":%d,\"count\":%lu,\"triggered\":%lu,",
+                     (first != 0U) ? "" : ",", stats.Name, (int)stats.IRQn,
+                     (unsigned long)stats.Count, (unsigned long)stats.Triggered);
+    first = 0U;
+
+    if(stats.Triggered == 0U)
+    {
+      stats.LatencyMin = 0U;
+    }
+    ISR_Bench_Append(pBuffer, Size, &length,
+                     "\"latency\":{\"min\":%lu,\"max\":%lu,\"mean\":%lu,\"jitter\":%lu,\"width\":%lu,\"hist\":[",
+                     (unsigned long)stats.LatencyMin, (unsigned long)stats.LatencyMax,
+                     (unsigned long)((stats.Triggered != 0U) ? (stats.LatencySum / stats.Triggered) : 0U),
+                     (unsigned long)(stats.LatencyMax - stats.LatencyMin),
+                     (unsigned long)ISR_BENCH_LATENCY_WIDTH);
+    for(bin = 0U; bin < ISR_BENCH_BINS; bin++)
+    {
+      ISR_Bench_Append(pBuffer, Size, &length, "%s%lu", (bin != 0U) ? "," : "",
+                       (unsigned long)stats.LatencyHist[bin]);
+    }
+
+    if(stats.Count == 0U)
+    {
+      stats.DurationMin = 0U;
+    }
+    ISR_Bench_Append(pBuffer, Size, &length,
+                     "]},\"duration\":{\"min\":%lu,\"max\":%lu,\"mean\":%lu,\"shift\":%lu,\"hist\":[",
+                     (unsigned long)stats.DurationMin, (unsigned long)stats.DurationMax,
+                     (unsigned long)((stats.Count != 0U) ? (stats.DurationSum / stats.Count) : 0U),
+                     (unsigned long)ISR_BENCH_DURATION_SHIFT);
+    for(bin = 0U; bin < ISR_BENCH_BINS; bin++)
+    {
+      ISR_Bench_Append(pBuffer, Size, &length, "%s%lu", (bin != 0U) ? "," : "",
+                       (unsigned long)stats.DurationHist[bin]);
+    }
+    ISR_Bench_Append(pBuffer, Size, &length, "]}}");
+  }
+
+  ISR_Bench_Append(pBuffer, Size, &length, "]}\n");
+
+  if(length >= Size)
+  {
+    pBuffer[Size - 1U] = '\0';
+    return 0U;
+  }
+
+  return length;
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Cycles between two counter reads
+  * @param  From: first read
+  * @param  To: second read
+  * @retval Elapsed cycles
+  */
+static uint32_t ISR_Bench_Elapsed(uint32_t From, uint32_t To)
+{
+#if (__CORTEX_M >= 3U)
+  return To - From;
+#else
+  /* SysTick counts down from LOAD to 0 */
+  uint32_t reload = SysTick->LOAD + 1U;
+
+  return (From >= To) ? (From - To) : (From + reload - To);
+#endif
+}
+
+/**
+  * @brief  Remove the counter read cost from a measure
+  * @param  Cycles: measure
+  * @retval Corrected measure
+  */
+static uint32_t ISR_Bench_Correct(uint32_t Cycles)
+{
+  return (Cycles > ISR_Bench_Overhead) ? (Cycles - ISR_Bench_Overhead) : 0U;
+}
+
+/**
+  * @brief  Run the background load and raise the interrupt in its middle
+  * @param  Id: benchmark entry
+  * @param  pRun: run parameters
+  * @param  TriggerAt: load step at which the interrupt is raised
+  * @retval None
+  */
+static void ISR_Bench_RunLoad(uint32_t Id, const ISR_Bench_RunTypeDef *pRun, uint32_t TriggerAt)
+{
+  __IO uint32_t sink = 0U;
+  uint32_t      acc = 0xFFFFFFFFU;
+  uint32_t      i;
+
+  for(i = 0U; i < ISR_BENCH_LOAD_WORDS; i++)
+  {
+    if(i == TriggerAt)
+    {
+      if(pRun->pTrigger != NULL)
+      {
+        pRun->pTrigger(Id);
+      }
+      else
+      {
+        ISR_Bench_Arm(Id);
+        NVIC_SetPendingIRQ(ISR_Bench_Stats[Id].IRQn);
+      }
+    }
+
+    switch(pRun->Load)
+    {
+      case ISR_BENCH_LOAD_MEMORY:
+        /* Block copies go through load/store multiple */
+        memcpy(&ISR_Bench_Load[1][0], &ISR_Bench_Load[0][0], (i & 7U) * 16U + 16U);
+        break;
+
+      case ISR_BENCH_LOAD_DIVIDE:
+        acc = (acc / (i | 3U)) + 0x9E3779B9U;
+        break;
+
+      default:
+        sink = ISR_Bench_Done[Id];
+        break;
+    }
+  }
+
+  sink = acc;
+  (void)sink;
+}
+
+/**
+  * @brief  Append formatted text to the report, counting what does not fit
+  * @param  pBuffer: report buffer
+  * @param  Size: report buffer size
+  * @param  pLength: report length, updated
+  * @param  pFormat: printf format
+  * @retval None
+  */
+static void ISR_Bench_Append(char *pBuffer, uint32_t Size, uint32_t *pLength, const char *pFormat, ...)
+{
+  va_list args;
+  int     written;
+
+  va_start(args, pFormat);
+  if(*pLength < Size)
+  {
+    written = vsnprintf(&pBuffer[*pLength], Size - *pLength, pFormat, args);
+  }
+  else
+  {
+    written = vsnprintf(NULL, 0, pFormat, args);
+  }
+  va_end(args);
+
+  if(written > 0)
+  {
+    *pLength += (uint32_t)written;
+  }
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
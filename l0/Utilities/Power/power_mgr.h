@@ -0,0 +1,101 @@
+/**
+  ******************************************************************************
+  * @file    power_mgr.h
+  * @author  MCD Application Team
+  * @brief   Header for power_mgr module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _POWER_MGR_H__
+#define _POWER_MGR_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported types ------------------------------------------------------------*/
+/* From the lightest to the deepest mode */
+typedef enum
+{
+  PWR_MGR_MODE_RUN     = 0U,  /* No low power mode                              */
+  PWR_MGR_MODE_SLEEP   = 1U,  /* CPU clock stopped, peripherals and DMA running */
+  PWR_MGR_MODE_STOP_MR = 2U,  /* Stop, main regulator kept on: faster wake up   */
+  PWR_MGR_MODE_STOP    = 3U   /* Stop, low power regulator                      */
+} PWR_Mgr_ModeTypeDef;
+
+typedef struct
+{
+  uint32_t  Entries[PWR_MGR_MODE_STOP + 1U];   /* Calls to PWR_Mgr_Enter() per mode entered */
+  uint32_t  Locked;                            /* Entries made lighter by a lock             */
+  uint32_t  Short;                             /* Entries made lighter by the idle time      */
+} PWR_Mgr_StatsTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* Lock identifiers, one per driver or activity, are 0 to PWR_MGR_MAX_LOCKS-1 */
+#define PWR_MGR_MAX_LOCKS         32U
+
+/* Idle time, in microseconds, below which a Stop mode does not pay back its
+   entry and wake up. Override in main.h. */
+#if !defined(PWR_MGR_STOP_MR_MIN_US)
+#define PWR_MGR_STOP_MR_MIN_US    50U
+#endif
+#if !defined(PWR_MGR_STOP_MIN_US)
+#define PWR_MGR_STOP_MIN_US       500U
+#endif
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+void                PWR_Mgr_Init(void);
+HAL_StatusTypeDef   PWR_Mgr_Lock(uint32_t Id, PWR_Mgr_ModeTypeDef Deepest);
+void                PWR_Mgr_Unlock(uint32_t Id);
+PWR_Mgr_ModeTypeDef PWR_Mgr_GetDeepest(void);
+uint32_t            PWR_Mgr_GetLocks(PWR_Mgr_ModeTypeDef Mode);
+PWR_Mgr_ModeTypeDef PWR_Mgr_Enter(uint64_t Us);
+void                PWR_Mgr_GetStats(PWR_Mgr_StatsTypeDef *pStats);
+#if defined(HAL_UART_MODULE_ENABLED)
+HAL_StatusTypeDef   PWR_Mgr_ArmUart(UART_HandleTypeDef *huart);
+#endif
+
+void PWR_Mgr_SuspendCallback(PWR_Mgr_ModeTypeDef Mode);
+void PWR_Mgr_ResumeCallback(PWR_Mgr_ModeTypeDef Mode);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _POWER_MGR_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,478 @@
+/**
+  ******************************************************************************
+  * @file    power_prof.c
+  * @author  MCD Application Team
+  * @brief   Power mode residency and energy estimation per subsystem.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- describe the subsystems in a constant table: the RCC enable register and
+   bits of the peripheral clock, with the "peripheral current consumption"
+   of the datasheet in nA per MHz, and the current drawn while it is active,
+   ex. the ADC analog part during a burst, or the radio behind a UART. An
+   entry without RCC register is an activity only. Then call
+   PWR_Prof_Init(pTable, Count), the table index being the subsystem Id.
+
+2- mark the events, each one closing the current interval :
+      - PWR_Prof_Update() after a peripheral clock is enabled or disabled,
+        ex. at the end of the HAL_PPP_MspInit() and HAL_PPP_MspDeInit()
+        hooks: the RCC enable registers are read back at each event
+      - PWR_Prof_Begin(Id) and PWR_Prof_End(Id) around an activity
+      - PWR_Prof_EnterMode(Mode, Blockers) just before the WFI, interrupts
+        masked, and PWR_Prof_ExitMode() once the clocks are restored.
+   With power_mgr, define PWR_MGR_USE_PROFILER in main.h: PWR_Mgr_Enter()
+   then makes these two calls, the blockers being the locks keeping the
+   deepest Stop mode away.
+
+3- the time stamp must count through the Stop modes: with lptim_timebase, define
+   PWR_PROF_USE_TIMEBASE in main.h for TIMEBASE_GetUs(), or override
+   PWR_PROF_TIMESTAMP_US().
+   The default HAL_GetTick() stops with the SysTick in Stop, and has a 1 ms
+   resolution.
+
+4- PWR_Prof_GetStats() gives the residency and the core energy per mode,
+   and the time spent in a lighter mode than the deepest one per blocker.
+   PWR_Prof_GetSubsystem() gives the clocked time, the active time and the
+   charge of a subsystem. PWR_Prof_Report() formats them one line per call,
+   for a console or lcd_log. With bin_log, define PWR_PROF_USE_BIN_LOG in
+   main.h to also record each event in a binary record of a few words.
+
+The energy is estimated from the core current of the mode plus the current
+of each subsystem clocked or active, at PWR_PROF_VDD_MV: replace the typical
+values by the board measurements for an absolute figure. An event costs
+about a hundred cycles plus a few cycles per subsystem.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "power_prof.h"
+#if defined(PWR_PROF_USE_TIMEBASE)
+#include "lptim_timebase.h"
+#endif
+#if defined(PWR_PROF_USE_BIN_LOG)
+#include "bin_log.h"
+#endif
+#include <stdio.h>
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Report lines: total, modes, subsystems, short idle, then the blockers */
+#define PWR_PROF_LINE_MODES       1U
+#define PWR_PROF_LINE_SUBSYSTEMS  (PWR_PROF_LINE_MODES + PWR_PROF_MODES)
+
+/* Private macro -------------------------------------------------------------*/
+/* Charge in pC to energy in uJ */
+#define PWR_PROF_UJ(__PC__)       (((__PC__) / 1000U) * PWR_PROF_VDD_MV / 1000000U)
+
+/* Private variables ---------------------------------------------------------*/
+static const PWR_Prof_SubsystemTypeDef *ProfTable;
+static uint32_t                         ProfCount;
+static PWR_Prof_ModeTypeDef             ProfMode;
+static uint32_t                         ProfBlockers;
+static uint64_t                         ProfLast;
+static uint32_t                         ProfClocked;          /* One bit per subsystem clocked in Run   */
+static uint32_t                         ProfSleepClocked;     /* Same in Sleep                          */
+static uint32_t                         ProfActive;           /* Between PWR_Prof_Begin() and _End()   */
+static PWR_Prof_StatsTypeDef            ProfStats;
+static PWR_Prof_SubsystemStatsTypeDef   ProfSubsystem[PWR_PROF_MAX_SUBSYSTEMS];
+
+static const char * const              ProfModeName[PWR_PROF_MODES] =
+{
+  "run", "sleep", "stop mr", "stop"
+};
+static const uint32_t                   ProfModeNa[PWR_PROF_MODES] =
+{
+  PWR_PROF_RUN_NA_PER_MHZ, PWR_PROF_SLEEP_NA_PER_MHZ, PWR_PROF_STOP_MR_NA, PWR_PROF_STOP_NA
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static void     PWR_Prof_Integrate(void);
+static uint32_t PWR_Prof_Ms(uint64_t Us);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Clear the statistics and start in Run mode
+  * @param  pTable: subsystems, kept by the module
+  * @param  Count: entries of pTable, PWR_PROF_MAX_SUBSYSTEMS at most
+  * @retval HAL status
+  */
+HAL_StatusTypeDef PWR_Prof_Init(const PWR_Prof_SubsystemTypeDef *pTable, uint32_t Count)
+{
+  uint32_t primask;
+
+  if ((Count > PWR_PROF_MAX_SUBSYSTEMS) || ((pTable == NULL) && (Count != 0U)))
+  {
+    return HAL_ERROR;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  ProfTable    = pTable;
+  ProfCount    = Count;
+  ProfMode     = PWR_PROF_MODE_RUN;
+  ProfBlockers = 0U;
+  ProfActive   = 0U;
+  memset(&ProfStats, 0, sizeof(ProfStats));
+  memset(ProfSubsystem, 0, sizeof(ProfSubsystem));
+  ProfLast = PWR_PROF_TIMESTAMP_US();
+  PWR_Prof_Integrate();
+  __set_PRIMASK(primask);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Account the time since the last event and read back the
+  *         peripheral clock enables
+  * @retval None
+  */
+void PWR_Prof_Update(void)
+{
+  uint32_t primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  PWR_Prof_Integrate();
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Start an activity of a subsystem
+  * @param  Id: index of the subsystem in the table
+  * @retval None
+  */
+void PWR_Prof_Begin(uint32_t Id)
+{
+  uint32_t primask;
+
+  if (Id >= ProfCount)
+  {
+    return;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  PWR_Prof_Integrate();
+  ProfActive |= (1UL << Id);
+  __set_PRIMASK(primask);
+#if defined(PWR_PROF_USE_BIN_LOG)
+  BIN_DbgLog("pwr begin %u at %u us", Id, (uint32_t)ProfLast);
+#endif
+}
+
+/**
+  * @brief  End an activity of a subsystem
+  * @param  Id: index of the subsystem in the table
+  * @retval None
+  */
+void PWR_Prof_End(uint32_t Id)
+{
+  uint32_t primask;
+
+  if (Id >= ProfCount)
+  {
+    return;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  PWR_Prof_Integrate();
+  ProfActive &= ~(1UL << Id);
+  __set_PRIMASK(primask);
+#if defined(PWR_PROF_USE_BIN_LOG)
+  BIN_DbgLog("pwr end %u at %u us", Id, (uint32_t)ProfLast);
+#endif
+}
+
+/**
+  * @brief  About to enter a low power mode
+  * @note   Called with the interrupts masked, just before the WFI.
+  * @param  Mode: mode entered
+  * @param  Blockers: one bit per reason keeping the deepest mode away, ex.
+  *         the power_mgr locks, 0 when the idle time is too short
+  * @retval None
+  */
+void PWR_Prof_EnterMode(PWR_Prof_ModeTypeDef Mode, uint32_t Blockers)
+{
+  if (Mode >= PWR_PROF_MODES)
+  {
+    return;
+  }
+
+  PWR_Prof_Integrate();
+  ProfMode     = Mode;
+  ProfBlockers = Blockers;
+  ProfStats.Entries[Mode]++;
+#if defined(PWR_PROF_USE_BIN_LOG)
+  BIN_DbgLog("pwr enter %u blockers 0x%08x at %u us", Mode, Blockers, (uint32_t)ProfLast);
+#endif
+}
+
+/**
+  * @brief  Back in Run mode, clocks restored
+  * @note   Called with the interrupts masked.
+  * @retval None
+  */
+void PWR_Prof_ExitMode(void)
+{
+  PWR_Prof_Integrate();
+  ProfMode     = PWR_PROF_MODE_RUN;
+  ProfBlockers = 0U;
+#if defined(PWR_PROF_USE_BIN_LOG)
+  BIN_DbgLog("pwr exit at %u us", (uint32_t)ProfLast);
+#endif
+}
+
+/**
+  * @brief  Copy the statistics, accounted up to now
+  * @param  pStats: destination
+  * @retval None
+  */
+void PWR_Prof_GetStats(PWR_Prof_StatsTypeDef *pStats)
+{
+  uint32_t primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  PWR_Prof_Integrate();
+  *pStats = ProfStats;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Copy the statistics of a subsystem, accounted up to now
+  * @param  Id: index of the subsystem in the table
+  * @param  pStats: destination
+  * @retval HAL status
+  */
+HAL_StatusTypeDef PWR_Prof_GetSubsystem(uint32_t Id, PWR_Prof_SubsystemStatsTypeDef *pStats)
+{
+  uint32_t primask;
+
+  if (Id >= ProfCount)
+  {
+    return HAL_ERROR;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  PWR_Prof_Integrate();
+  *pStats = ProfSubsystem[Id];
+  __set_PRIMASK(primask);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Format one line of the statistics: the total, then one line per
+  *         mode, per subsystem, the short idle time and one line per
+  *         blocker seen
+  * @param  Line: line number, from 0
+  * @param  pBuffer: text buffer
+  * @param  Size: text buffer size
+  * @retval Length of the line, 0 after the last one
+  */
+uint32_t PWR_Prof_Report(uint32_t Line, char *pBuffer, uint32_t Size)
+{
+  PWR_Prof_StatsTypeDef          stats;
+  PWR_Prof_SubsystemStatsTypeDef subsystem;
+  uint64_t                       uj;
+  uint32_t                       total;
+  uint32_t                       id;
+  int                            written;
+
+  PWR_Prof_GetStats(&stats);
+  total = PWR_Prof_Ms(stats.TotalUs);
+
+  if (Line == 0U)
+  {
+    uj = 0U;
+    for (id = 0U; id < PWR_PROF_MODES; id++)
+    {
+      uj += PWR_PROF_UJ(stats.ModeCharge[id]);
+    }
+    for (id = 0U; id < ProfCount; id++)
+    {
+      (void)PWR_Prof_GetSubsystem(id, &subsystem);
+      uj += PWR_PROF_UJ(subsystem.Charge);
+    }
+    written = snprintf(pBuffer, Size, "pwr total: %lu ms, %lu.%03lu mJ at %lu mV\r\n",
+                       (unsigned long)total, (unsigned long)(uj / 1000U), (unsigned long)(uj % 1000U),
+                       (unsigned long)PWR_PROF_VDD_MV);
+  }
+  else if (Line < PWR_PROF_LINE_SUBSYSTEMS)
+  {
+    id = Line - PWR_PROF_LINE_MODES;
+    uj = PWR_PROF_UJ(stats.ModeCharge[id]);
+    written = snprintf(pBuffer, Size, "pwr %s: %lu entries, %lu ms (%lu%%), %lu.%03lu mJ\r\n",
+                       ProfModeName[id], (unsigned long)stats.Entries[id],
+                       (unsigned long)PWR_Prof_Ms(stats.ModeUs[id]),
+                       (unsigned long)((stats.TotalUs > 0U) ? ((stats.ModeUs[id] * 100U) / stats.TotalUs) : 0U),
+                       (unsigned long)(uj / 1000U), (unsigned long)(uj % 1000U));
+  }
+  else if (Line < (PWR_PROF_LINE_SUBSYSTEMS + ProfCount))
+  {
+    id = Line - PWR_PROF_LINE_SUBSYSTEMS;
+    (void)PWR_Prof_GetSubsystem(id, &subsystem);
+    uj = PWR_PROF_UJ(subsystem.Charge);
+    written = snprintf(pBuffer, Size, "pwr %s: clocked %lu ms, active %lu ms, %lu.%03lu mJ\r\n",
+                       ProfTable[id].Name, (unsigned long)PWR_Prof_Ms(subsystem.ClockedUs),
+                       (unsigned long)PWR_Prof_Ms(subsystem.ActiveUs),
+                       (unsigned long)(uj / 1000U), (unsigned long)(uj % 1000U));
+  }
+  else if (Line == (PWR_PROF_LINE_SUBSYSTEMS + ProfCount))
+  {
+    written = snprintf(pBuffer, Size, "pwr short idle: %lu ms out of %s\r\n",
+                       (unsigned long)PWR_Prof_Ms(stats.ShortUs), ProfModeName[PWR_PROF_DEEPEST]);
+  }
+  else
+  {
+    /* Blockers seen, skipping the others */
+    Line -= PWR_PROF_LINE_SUBSYSTEMS + ProfCount + 1U;
+    for (id = 0U; id < PWR_PROF_MAX_BLOCKERS; id++)
+    {
+      if (stats.BlockedUs[id] != 0U)
+      {
+        if (Line == 0U)
+        {
+          break;
+        }
+        Line--;
+      }
+    }
+    if (id == PWR_PROF_MAX_BLOCKERS)
+    {
+      return 0U;
+    }
+    written = snprintf(pBuffer, Size, "pwr blocker %lu: %lu ms out of %s\r\n",
+                       (unsigned long)id, (unsigned long)PWR_Prof_Ms(stats.BlockedUs[id]),
+                       ProfModeName[PWR_PROF_DEEPEST]);
+  }
+
+  return (written > 0) ? (uint32_t)written : 0U;
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Account the interval since the last event in the state it had,
+  *         then read back the peripheral clock enables
+  * @note   Called with the interrupts masked.
+  * @retval None
+  */
+static void PWR_Prof_Integrate(void)
+{
+  uint64_t now = PWR_PROF_TIMESTAMP_US();
+  uint64_t dt  = now - ProfLast;
+  uint32_t mhz = SystemCoreClock / 1000000U;
+  uint32_t clocked;
+  uint32_t na;
+  uint32_t id;
+
+  ProfLast = now;
+
+  if (dt != 0U)
+  {
+    ProfStats.TotalUs += dt;
+    ProfStats.ModeUs[ProfMode] += dt;
+    na = (ProfMode <= PWR_PROF_MODE_SLEEP) ? (ProfModeNa[ProfMode] * mhz) : ProfModeNa[ProfMode];
+    ProfStats.ModeCharge[ProfMode] += (na * dt) / 1000U;
+
+    /* Lighter than the deepest mode: charged to the blockers */
+    if ((ProfMode != PWR_PROF_MODE_RUN) && (ProfMode != PWR_PROF_DEEPEST))
+    {
+      if (ProfBlockers == 0U)
+      {
+        ProfStats.ShortUs += dt;
+      }
+      for (id = 0U; id < PWR_PROF_MAX_BLOCKERS; id++)
+      {
+        if ((ProfBlockers & (1UL << id)) != 0U)
+        {
+          ProfStats.BlockedUs[id] += dt;
+        }
+      }
+    }
+
+    /* Peripheral clocks are stopped in Stop */
+    clocked = (ProfMode == PWR_PROF_MODE_RUN)   ? ProfClocked :
+              (ProfMode == PWR_PROF_MODE_SLEEP) ? ProfSleepClocked : 0U;
+    for (id = 0U; id < ProfCount; id++)
+    {
+      na = 0U;
+      if ((clocked & (1UL << id)) != 0U)
+      {
+        ProfSubsystem[id].ClockedUs += dt;
+        na = ProfTable[id].NaPerMhz * mhz;
+      }
+      if ((ProfActive & (1UL << id)) != 0U)
+      {
+        ProfSubsystem[id].ActiveUs += dt;
+        na += (ProfMode <= PWR_PROF_MODE_SLEEP) ? ProfTable[id].ActiveNa : ProfTable[id].StopNa;
+      }
+      ProfSubsystem[id].Charge += (na * dt) / 1000U;
+    }
+  }
+
+  /* Clock enables for the next interval */
+  ProfClocked      = 0U;
+  ProfSleepClocked = 0U;
+  for (id = 0U; id < ProfCount; id++)
+  {
+    if ((ProfTable[id].pEnable != NULL) && ((*ProfTable[id].pEnable & ProfTable[id].Mask) == ProfTable[id].Mask))
+    {
+      ProfClocked |= (1UL << id);
+      if ((ProfTable[id].pSleepEnable == NULL) ||
+          ((*ProfTable[id].pSleepEnable & ProfTable[id].Mask) == ProfTable[id].Mask))
+      {
+        ProfSleepClocked |= (1UL << id);
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Microseconds to milliseconds, saturated to 32 bits
+  * @param  Us: time in microseconds
+  * @retval Time in milliseconds
+  */
+static uint32_t PWR_Prof_Ms(uint64_t Us)
+{
+  uint64_t ms = Us / 1000U;
+
+  return (ms > 0xFFFFFFFFU) ? 0xFFFFFFFFU : (uint32_t)ms;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,94 @@
+/**
+  ******************************************************************************
+  * @file    lptim_timebase.h
+  * @author  MCD Application Team
+  * @brief   Header for lptim_timebase module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _LPTIM_TIMEBASE_H__
+#define _LPTIM_TIMEBASE_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#if !defined(LPTIM1)
+#error "lptim_timebase requires a device with the LPTIM1"
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+/* LPTIM1 kernel clock and its frequency in Hz. Override in main.h. */
+#if !defined(TIMEBASE_CLKSOURCE)
+#define TIMEBASE_CLKSOURCE      RCC_LPTIM1CLKSOURCE_LSE
+#endif
+#if !defined(TIMEBASE_CLOCK_HZ)
+#define TIMEBASE_CLOCK_HZ       LSE_VALUE
+#endif
+/* Non zero once the kernel clock runs. Override in main.h. */
+#if !defined(TIMEBASE_CLOCK_READY)
+#define TIMEBASE_CLOCK_READY()  __HAL_RCC_GET_FLAG(RCC_FLAG_LSERDY)
+#endif
+
+/* LPTIM1 prescaler is 2^TIMEBASE_PRESCALER, 0 to 7: the counter wraps, and
+   wakes the CPU, every 65536 counts. Override in main.h. */
+#if !defined(TIMEBASE_PRESCALER)
+#define TIMEBASE_PRESCALER      0U
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+uint32_t          TIMEBASE_IsRunning(void);
+uint64_t          TIMEBASE_GetUs(void);
+void              TIMEBASE_DelayUs(uint32_t Delay);
+void              TIMEBASE_WaitUntil(uint64_t Us);
+uint64_t          TIMEBASE_Sleep(uint64_t MaxUs);
+HAL_StatusTypeDef TIMEBASE_SetAlarm(uint64_t Us);
+void              TIMEBASE_CancelAlarm(void);
+
+void TIMEBASE_AlarmCallback(void);
+void TIMEBASE_EnterLowPowerCallback(uint64_t Us);
+
+void TIMEBASE_IRQHandler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _LPTIM_TIMEBASE_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,191 @@
+/**
+  ******************************************************************************
+  * @file    tsc_scan.h
+  * @author  MCD Application Team
+  * @brief   Header for tsc_scan module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _TSC_SCAN_H__
+#define _TSC_SCAN_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#if !defined(HAL_TSC_MODULE_ENABLED)
+#error "tsc_scan requires the HAL TSC driver"
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+#define TSC_SCAN_KEY                  0U
+#define TSC_SCAN_SLIDER               1U
+#define TSC_SCAN_WHEEL                2U
+
+#define TSC_SCAN_MODE_CONTINUOUS      0U   /* Cycles back to back              */
+#define TSC_SCAN_MODE_TRIGGERED       1U   /* One cycle per TSC_Scan_Trigger() */
+
+#define TSC_SCAN_EVENT_TOUCH          1U
+#define TSC_SCAN_EVENT_MOVE           2U   /* Slider and wheel only            */
+#define TSC_SCAN_EVENT_RELEASE        3U
+
+/* Electrodes of a slider or a wheel */
+#define TSC_SCAN_SENSOR_CHANNELS      8U
+
+/* Channels and banks of the configuration. Override in main.h. */
+#if !defined(TSC_SCAN_MAX_CHANNELS)
+#define TSC_SCAN_MAX_CHANNELS         24U
+#endif
+#if !defined(TSC_SCAN_MAX_BANKS)
+#define TSC_SCAN_MAX_BANKS            8U
+#endif
+
+/* Events kept until read, power of 2. Override in main.h. */
+#if !defined(TSC_SCAN_QUEUE_SIZE)
+#define TSC_SCAN_QUEUE_SIZE           16U
+#endif
+
+/* Cycles averaged for the initial baselines. Override in main.h. */
+#if !defined(TSC_SCAN_CALIBRATION_CYCLES)
+#define TSC_SCAN_CALIBRATION_CYCLES   8U
+#endif
+
+/* Baseline drift: each cycle without touch moves the baseline by
+   1/2^SHIFT of the difference with the count. Override in main.h. */
+#if !defined(TSC_SCAN_BASELINE_SHIFT)
+#define TSC_SCAN_BASELINE_SHIFT       6U
+#endif
+
+/* Consecutive cycles confirming a touch or a release. Override in main.h. */
+#if !defined(TSC_SCAN_DEBOUNCE)
+#define TSC_SCAN_DEBOUNCE             2U
+#endif
+
+/* Slider and wheel position filter: each cycle moves the position by
+   1/2^SHIFT of the difference, 0 disables it. Override in main.h. */
+#if !defined(TSC_SCAN_POSITION_SHIFT)
+#define TSC_SCAN_POSITION_SHIFT       2U
+#endif
+
+/* Smallest position change, out of 256, reported by a MOVE event.
+   Override in main.h. */
+#if !defined(TSC_SCAN_MOVE_THRESHOLD)
+#define TSC_SCAN_MOVE_THRESHOLD       4U
+#endif
+
+/* Discharge of the sampling capacitors between two banks, in microseconds.
+   Override in main.h. */
+#if !defined(TSC_SCAN_DISCHARGE_US)
+#define TSC_SCAN_DISCHARGE_US         5U
+#endif
+
+/* Lock of power_mgr held during a cycle, with TSC_SCAN_USE_POWER_MGR.
+   Override in main.h. */
+#if !defined(TSC_SCAN_PWR_LOCK)
+#define TSC_SCAN_PWR_LOCK             30U
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  uint32_t  ChannelIOs;      /* TSC_GROUPx_IOy acquired together, one per group */
+  uint32_t  SamplingIOs;     /* Sampling IO of each group of ChannelIOs        */
+} TSC_Scan_BankTypeDef;
+
+typedef struct
+{
+  uint8_t   Type;            /* TSC_SCAN_KEY, SLIDER or WHEEL                  */
+  uint8_t   Channels;        /* 1 for a key, 2 to 8 for a slider or a wheel    */
+  uint8_t   Channel[TSC_SCAN_SENSOR_CHANNELS];  /* In order along the sensor   */
+  uint16_t  Threshold;       /* Touch: count decrease from the baseline        */
+  uint16_t  Hysteresis;      /* Release: decrease below Threshold - Hysteresis */
+} TSC_Scan_SensorTypeDef;
+
+typedef struct
+{
+  TSC_HandleTypeDef             *htsc;           /* Initialized, IODefaultMode TSC_IODEF_OUT_PP_LOW */
+  const TSC_Scan_BankTypeDef    *pBanks;         /* Acquired in turn                     */
+  uint32_t                      Banks;
+  uint32_t                      ShieldIOs;       /* Driven during every acquisition      */
+  const TSC_Scan_SensorTypeDef  *pSensors;
+  uint32_t                      Sensors;         /* 32 at most                           */
+  uint32_t                      Mode;            /* TSC_SCAN_MODE_xxx at start           */
+  uint32_t                      LowPowerPeriod;  /* ms between triggered cycles, with
+                                                    TSC_SCAN_USE_TIMEBASE               */
+  uint32_t                      LowPowerIdle;    /* ms without touch before CONTINUOUS
+                                                    falls back to TRIGGERED, 0: never   */
+} TSC_Scan_ConfigTypeDef;
+
+typedef struct
+{
+  uint32_t  Tick;            /* HAL_GetTick() at the end of the cycle          */
+  uint8_t   Type;            /* TSC_SCAN_EVENT_xxx                             */
+  uint8_t   Sensor;          /* Index in pSensors                              */
+  uint8_t   Position;        /* Slider: 0 to 255 from Channel[0] to the last
+                                one, wheel: 0 to 255 for a turn, key: 0        */
+  int8_t    Move;            /* MOVE: change since the previous event          */
+  int16_t   Delta;           /* Count decrease of the strongest channel        */
+} TSC_Scan_EventTypeDef;
+
+typedef struct
+{
+  uint32_t  Cycles;          /* Acquisitions of all the banks                  */
+  uint32_t  Events;          /* Events queued                                  */
+  uint32_t  Overruns;        /* Events lost, queue full                        */
+  uint32_t  Errors;          /* Groups stopped by the max count error          */
+  uint32_t  Busy;            /* Triggers during a cycle, ignored               */
+} TSC_Scan_StatsTypeDef;
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef TSC_Scan_Init(const TSC_Scan_ConfigTypeDef *pConfig);
+HAL_StatusTypeDef TSC_Scan_DeInit(void);
+HAL_StatusTypeDef TSC_Scan_SetMode(uint32_t Mode);
+uint32_t          TSC_Scan_GetMode(void);
+HAL_StatusTypeDef TSC_Scan_Trigger(void);
+uint32_t          TSC_Scan_GetEvent(TSC_Scan_EventTypeDef *pEvent);
+uint32_t          TSC_Scan_GetTouched(void);
+int32_t           TSC_Scan_GetDelta(uint32_t Channel);
+void              TSC_Scan_GetStats(TSC_Scan_StatsTypeDef *pStats);
+
+void TSC_Scan_EventCallback(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _TSC_SCAN_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
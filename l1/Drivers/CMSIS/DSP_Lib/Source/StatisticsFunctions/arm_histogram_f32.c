@@ -0,0 +1,161 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_histogram_f32.c  
+*    
+* Description:	Histogram of a floating-point vector.  
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup Histogram Histogram
+ *
+ * Counts the samples of a vector in <code>numBins</code> bins of equal width,
+ * adding the counts to a histogram, so that it can be accumulated over the
+ * blocks of a stream. The histogram must be cleared before the first block.
+ *
+ * \par
+ * The samples below the first bin are counted in the first bin, and the
+ * samples above the last bin in the last bin, so that the histogram always
+ * counts all the samples.
+ *
+ * \par
+ * The floating-point function takes the range of the bins. The fixed-point
+ * functions take the lower bound and the base-2 logarithm of the bin width,
+ * so that the bin of a sample is computed with a subtraction and a shift:
+ * <pre>
+ *     bin = (x - minValue) >> shift
+ * </pre>
+ * The Q15 function reads two samples at a time on Cortex-M3/M4/M7.
+ *
+ * \par
+ * There are separate functions for floating-point, Q31 and Q15 data types.
+ */
+
+/**
+ * @addtogroup Histogram
+ * @{
+ */
+
+/**
+ * @brief  Histogram of a floating-point vector.
+ * @param[in]     *pSrc points to the input vector.
+ * @param[in]     blockSize length of the input vector.
+ * @param[in]     minValue lower bound of the first bin.
+ * @param[in]     maxValue upper bound of the last bin, above minValue.
+ * @param[in]     numBins number of bins.
+ * @param[in,out] *pHist points to the numBins counts, incremented.
+ * @return none.
+ */
+
+void arm_histogram_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t minValue,
+  float32_t maxValue,
+  uint16_t numBins,
+  uint32_t * pHist)
+{
+  float32_t scale = (float32_t) numBins / (maxValue - minValue);  /* Bins per unit */
+  float32_t last = (float32_t) numBins - 1.0f;   /* Position of the last bin */
+  float32_t v0;                                  /* Position of a sample */
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+  float32_t v1, v2, v3;                          /* Positions of the next samples */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* Position of the samples in the bins, clamped to the first and last bins */
+    v0 = (pSrc[0] - minValue) * scale;
+    v1 = (pSrc[1] - minValue) * scale;
+    v2 = (pSrc[2] - minValue) * scale;
+    v3 = (pSrc[3] - minValue) * scale;
+
+    v0 = (v0 > 0.0f) ? ((v0 < last) ? v0 : last) : 0.0f;
+    v1 = (v1 > 0.0f) ? ((v1 < last) ? v1 : last) : 0.0f;
+    v2 = (v2 > 0.0f) ? ((v2 < last) ? v2 : last) : 0.0f;
+    v3 = (v3 > 0.0f) ? ((v3 < last) ? v3 : last) : 0.0f;
+
+    pHist[(uint32_t) v0]++;
+    pHist[(uint32_t) v1]++;
+    pHist[(uint32_t) v2]++;
+    pHist[(uint32_t) v3]++;
+
+    pSrc += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    v0 = ((*pSrc++) - minValue) * scale;
+    v0 = (v0 > 0.0f) ? ((v0 < last) ? v0 : last) : 0.0f;
+    pHist[(uint32_t) v0]++;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of Histogram group
+ */
@@ -0,0 +1,123 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_sdft_init_q31.c    
+*    
+* Description:	Initialization function for the Q31 sliding DFT.    
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* -------------------------------------------------------------------- */
+
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup SDFT
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q31 sliding DFT.
+ * @param[in,out] *S points to an instance of the Q31 sliding DFT structure.
+ * @param[in]     numBins number of bins tracked.
+ * @param[in]     windowLength window length N, in samples.
+ * @param[in]     *pBins points to the numBins bin indexes, below N.
+ * @param[in]     damping damping factor r in 1.31 format, above 0.
+ * @param[in]     *pCoeffs points to the coefficient buffer of 2*numBins values, filled by the function.
+ * @param[in]     *pState points to the bin buffer of 2*numBins values.
+ * @param[in]     *pDelay points to the delay line of windowLength values.
+ * @param[in]     inputShift right shift applied to the input samples.
+ * @return        The function returns ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR
+ * if windowLength is zero, if a bin index is not below it, if the damping factor is not
+ * positive or if inputShift is above 31.
+ *
+ * The coefficients are computed in double precision with the C library, in 1.31 format.
+ */
+
+arm_status arm_sdft_init_q31(
+  arm_sdft_instance_q31 * S,
+  uint16_t numBins,
+  uint16_t windowLength,
+  const uint16_t * pBins,
+  q31_t damping,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  q31_t * pDelay,
+  uint8_t inputShift)
+{
+  float64_t w, r;                                /* angular frequency, damping */
+  uint32_t i;                                    /* loop counter */
+
+  if((windowLength == 0u) || (damping <= 0) || (inputShift > 31u))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  r = (float64_t) damping / 2147483648.0;
+
+  for (i = 0u; i < numBins; i++)
+  {
+    if(pBins[i] >= windowLength)
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    /* r * e^(j*2*pi*k/N) of each bin, saturated to +1 */
+    w = (6.28318530717958647692 * (float64_t) pBins[i]) / (float64_t) windowLength;
+    pCoeffs[(2u * i)] = clip_q63_to_q31((q63_t) (r * cos(w) * 2147483648.0));
+    pCoeffs[(2u * i) + 1u] = clip_q63_to_q31((q63_t) (r * sin(w) * 2147483648.0));
+  }
+
+  S->numBins = numBins;
+  S->windowLength = windowLength;
+  S->index = 0u;
+  S->inputShift = inputShift;
+  S->dampingN = clip_q63_to_q31((q63_t) (pow(r, (float64_t) windowLength) * 2147483648.0));
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+  S->pDelay = pDelay;
+
+  /* Clear the bins and the delay line */
+  memset(pState, 0, (2u * numBins) * sizeof(q31_t));
+  memset(pDelay, 0, windowLength * sizeof(q31_t));
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of SDFT group
+ */
@@ -55,6 +55,12 @@
    extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len1024;
    extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len2048;
    extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len4096;
+   extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len500;
+   extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len600;
+   extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len768;
+   extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len1000;
+   extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len1200;
+   extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len1536;
 
    extern const arm_cfft_instance_q31 arm_cfft_sR_q31_len16;
    extern const arm_cfft_instance_q31 arm_cfft_sR_q31_len32;
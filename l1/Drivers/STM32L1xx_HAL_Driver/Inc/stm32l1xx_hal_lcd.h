@@ -726,6 +726,10 @@ void                  HAL_LCD_MspDeInit(LCD_HandleTypeDef *hlcd);
 HAL_StatusTypeDef     HAL_LCD_Write(LCD_HandleTypeDef *hlcd, uint32_t RAMRegisterIndex, uint32_t RAMRegisterMask, uint32_t Data);
 HAL_StatusTypeDef     HAL_LCD_Clear(LCD_HandleTypeDef *hlcd);
 HAL_StatusTypeDef     HAL_LCD_UpdateDisplayRequest(LCD_HandleTypeDef *hlcd);
+HAL_StatusTypeDef     HAL_LCD_UpdateDisplayRequest_IT(LCD_HandleTypeDef *hlcd);
+void                  HAL_LCD_IRQHandler(LCD_HandleTypeDef *hlcd);
+void                  HAL_LCD_UpdateDisplayDoneCallback(LCD_HandleTypeDef *hlcd);
+void                  HAL_LCD_StartOfFrameCallback(LCD_HandleTypeDef *hlcd);
 
 /**
   * @}
@@ -54,6 +54,12 @@
       (#) When LCD RAM memory is updated enable the update display request using
           the HAL_LCD_UpdateDisplayRequest() API.
 
+      (#) Alternatively, HAL_LCD_UpdateDisplayRequest_IT() requests the update and
+          returns at once: the LCD stays busy until the Update Display Done interrupt,
+          HAL_LCD_IRQHandler() called from LCD_IRQHandler() then calls
+          HAL_LCD_UpdateDisplayDoneCallback(). The LCD RAM is write protected
+          meanwhile, HAL_LCD_Write() must not be called before the callback.
+
       [..] LCD and low power modes:
            (#) The LCD remain active during STOP mode.
 
@@ -535,6 +541,107 @@ HAL_StatusTypeDef HAL_LCD_UpdateDisplayRequest(LCD_HandleTypeDef *hlcd)
   return HAL_OK;
 }
 
+/**
+  * @brief  Enables the Update Display Request in interrupt mode.
+  * @param  hlcd LCD handle
+  * @note   Same as HAL_LCD_UpdateDisplayRequest() without waiting for the
+  *         update: HAL_LCD_UpdateDisplayDoneCallback() is called from
+  *         HAL_LCD_IRQHandler() once the LCD_DISPLAY is updated, the LCD stays
+  *         locked and busy until then.
+  * @note   If the device is in STOP mode (PCLK not provided) the update is
+  *         done but its interrupt only occurs after the wake up.
+  * @retval HAL status, HAL_BUSY while a previous update is in progress
+  */
+HAL_StatusTypeDef HAL_LCD_UpdateDisplayRequest_IT(LCD_HandleTypeDef *hlcd)
+{
+  if(__HAL_LCD_GET_FLAG(hlcd, LCD_FLAG_UDR) != RESET)
+  {
+    return HAL_BUSY;
+  }
+
+  if(hlcd->State == HAL_LCD_STATE_READY)
+  {
+    /* Process Locked */
+    __HAL_LOCK(hlcd);
+    hlcd->State = HAL_LCD_STATE_BUSY;
+  }
+  else if(hlcd->State != HAL_LCD_STATE_BUSY)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Clear the Update Display Done flag before starting the update display request */
+  __HAL_LCD_CLEAR_FLAG(hlcd, LCD_FLAG_UDD);
+
+  /* Enable the Update Display Done interrupt */
+  __HAL_LCD_ENABLE_IT(hlcd, LCD_IT_UDD);
+
+  /* Enable the display request */
+  hlcd->Instance->SR |= LCD_SR_UDR;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Handles the LCD interrupt request.
+  * @param  hlcd LCD handle
+  * @retval None
+  */
+void HAL_LCD_IRQHandler(LCD_HandleTypeDef *hlcd)
+{
+  /* Update Display Done */
+  if((__HAL_LCD_GET_FLAG(hlcd, LCD_FLAG_UDD) != RESET) && (__HAL_LCD_GET_IT_SOURCE(hlcd, LCD_IT_UDD) != RESET))
+  {
+    __HAL_LCD_DISABLE_IT(hlcd, LCD_IT_UDD);
+    __HAL_LCD_CLEAR_FLAG(hlcd, LCD_FLAG_UDD);
+
+    hlcd->State = HAL_LCD_STATE_READY;
+
+    /* Process Unlocked */
+    __HAL_UNLOCK(hlcd);
+
+    HAL_LCD_UpdateDisplayDoneCallback(hlcd);
+  }
+
+  /* Start of Frame */
+  if((__HAL_LCD_GET_FLAG(hlcd, LCD_FLAG_SOF) != RESET) && (__HAL_LCD_GET_IT_SOURCE(hlcd, LCD_IT_SOF) != RESET))
+  {
+    __HAL_LCD_CLEAR_FLAG(hlcd, LCD_FLAG_SOF);
+
+    HAL_LCD_StartOfFrameCallback(hlcd);
+  }
+}
+
+/**
+  * @brief  Update Display Done callback.
+  * @param  hlcd LCD handle
+  * @retval None
+  */
+__weak void HAL_LCD_UpdateDisplayDoneCallback(LCD_HandleTypeDef *hlcd)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hlcd);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_LCD_UpdateDisplayDoneCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Start of Frame callback.
+  * @param  hlcd LCD handle
+  * @retval None
+  */
+__weak void HAL_LCD_StartOfFrameCallback(LCD_HandleTypeDef *hlcd)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hlcd);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_LCD_StartOfFrameCallback could be implemented in the user file
+   */
+}
+
 /**
   * @}
   */
@@ -665,6 +665,7 @@ void HAL_PCD_IRQHandler(PCD_HandleTypeDef *hpcd)
   if (__HAL_PCD_GET_FLAG (hpcd, USB_ISTR_SOF))
   {
     __HAL_PCD_CLEAR_FLAG(hpcd, USB_ISTR_SOF); 
+    __HAL_TRACE(HAL_TRACE_EVT_USB_SOF, hpcd->Instance);
     HAL_PCD_SOFCallback(hpcd);
   }
 
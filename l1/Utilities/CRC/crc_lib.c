@@ -0,0 +1,609 @@
+/**
+  ******************************************************************************
+  * @file    crc_lib.c
+  * @author  MCD Application Team
+  * @brief   CRC-8/16/32 of any polynomial, by the programmable CRC unit or
+  *          by slicing-by-8 tables
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- pick the algorithm : one of the CRC_Lib_xxx parameter sets or a
+   CRC_Lib_ParamTypeDef of your own, in the catalogue form (normal
+   polynomial without the top term, Init, XorOut, Width, Reflected).
+
+2- call CRC_Lib_Init() with either :
+   - pTable = NULL, to run on the CRC unit. This needs a programmable unit
+     (CRC_POL register : STM32F0x1/F0x2/F0x8/F09x, F3, F7, H7, L0, L4),
+     a width of 7, 8, 16 or 32 bits and an odd polynomial. The unit is
+     reprogrammed (POL, CR, INIT) on each call, so several algorithms
+     share it, and its clock must be enabled by the application
+     (__HAL_RCC_CRC_CLK_ENABLE()). Calls from several contexts, or next to
+     the HAL CRC driver, need CRC_LIB_LOCK()/CRC_LIB_UNLOCK() in main.h.
+   - pTable = a CRC_LIB_TABLE_WORDS word buffer, to run on the CPU. Init
+     fills it with CRC_LIB_SLICES tables (8 KB for slicing-by-8, 4 KB for
+     slicing-by-4, 1 KB byte by byte) which then eat 8 or 4 bytes per
+     step with aligned word loads. This covers any width from 1 to 32
+     bits, the polynomials the unit cannot do and the families whose unit
+     is fixed on CRC-32/MPEG-2 (F1, F2, F4, L1). The table is read at
+     random on every byte : place it in CCM, DTCM or SRAM, not in flash
+     behind wait states nor in external memory.
+
+3- CRC_Lib_Compute() returns the CRC of a buffer. Streams go through
+   CRC_Lib_Begin(), CRC_Lib_Update() per chunk and CRC_Lib_End(); the
+   state is a plain word the caller keeps, chunks may have any length and
+   alignment.
+
+4- CRC_Lib_Combine() gives the CRC of A followed by B from CRC(A), CRC(B)
+   and the length of B, in O(log(length)) without the data, to merge
+   chunks computed apart (DMA halves, several cores, files in parts).
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "crc_lib.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Table k entry i */
+#define CRC_LIB_T(k, i)           pTable[((k) * 256U) + (i)]
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Check value of each set : CRC of the ASCII "123456789" */
+const CRC_Lib_ParamTypeDef CRC_Lib_Crc8        = {0x07U,       0x00U,       0x00U,       8U,  0U}; /* 0xF4       */
+const CRC_Lib_ParamTypeDef CRC_Lib_Crc8Maxim   = {0x31U,       0x00U,       0x00U,       8U,  1U}; /* 0xA1       */
+const CRC_Lib_ParamTypeDef CRC_Lib_Crc8Sae     = {0x1DU,       0xFFU,       0xFFU,       8U,  0U}; /* 0x4B       */
+const CRC_Lib_ParamTypeDef CRC_Lib_Crc16Ccitt  = {0x1021U,     0xFFFFU,     0x0000U,     16U, 0U}; /* 0x29B1     */
+const CRC_Lib_ParamTypeDef CRC_Lib_Crc16Xmodem = {0x1021U,     0x0000U,     0x0000U,     16U, 0U}; /* 0x31C3     */
+const CRC_Lib_ParamTypeDef CRC_Lib_Crc16Kermit = {0x1021U,     0x0000U,     0x0000U,     16U, 1U}; /* 0x2189     */
+const CRC_Lib_ParamTypeDef CRC_Lib_Crc16Modbus = {0x8005U,     0xFFFFU,     0x0000U,     16U, 1U}; /* 0x4B37     */
+const CRC_Lib_ParamTypeDef CRC_Lib_Crc32       = {0x04C11DB7U, 0xFFFFFFFFU, 0xFFFFFFFFU, 32U, 1U}; /* 0xCBF43926 */
+const CRC_Lib_ParamTypeDef CRC_Lib_Crc32C      = {0x1EDC6F41U, 0xFFFFFFFFU, 0xFFFFFFFFU, 32U, 1U}; /* 0xE3069283 */
+const CRC_Lib_ParamTypeDef CRC_Lib_Crc32Mpeg2  = {0x04C11DB7U, 0xFFFFFFFFU, 0x00000000U, 32U, 0U}; /* 0x0376E6E7 */
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t CRC_Lib_Reflect(uint32_t Value, uint32_t Width);
+static uint32_t CRC_Lib_State(const CRC_Lib_HandleTypeDef *hcrc, uint32_t Crc);
+static uint32_t CRC_Lib_SoftReflected(const uint32_t *pTable, uint32_t Crc, const uint8_t *pData, uint32_t Length);
+static uint32_t CRC_Lib_SoftNormal(const uint32_t *pTable, uint32_t Crc, const uint8_t *pData, uint32_t Length);
+#if (CRC_LIB_HW_PROGRAMMABLE == 1U)
+static uint32_t CRC_Lib_Hard(const CRC_Lib_HandleTypeDef *hcrc, uint32_t State, const uint8_t *pData, uint32_t Length);
+#endif
+static uint32_t CRC_Lib_Gf2Times(const uint32_t *pMat, uint32_t Vec);
+static void     CRC_Lib_Gf2Square(uint32_t *pSquare, const uint32_t *pMat);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Set up a CRC algorithm on the CRC unit or on the CPU
+  * @param  hcrc: handle
+  * @param  pParam: algorithm, kept by reference
+  * @param  pTable: CRC_LIB_TABLE_WORDS words for the CPU tables, NULL for
+  *         the CRC unit
+  * @retval HAL_OK, HAL_ERROR on a bad algorithm or one the CRC unit cannot do
+  */
+HAL_StatusTypeDef CRC_Lib_Init(CRC_Lib_HandleTypeDef *hcrc, const CRC_Lib_ParamTypeDef *pParam, uint32_t *pTable)
+{
+  uint32_t width;
+  uint32_t i;
+  uint32_t k;
+  uint32_t c;
+
+  if((hcrc == NULL) || (pParam == NULL) || (pParam->Width == 0U) || (pParam->Width > 32U))
+  {
+    return HAL_ERROR;
+  }
+
+  width = pParam->Width;
+  if((width < 32U) && ((pParam->Poly >> width) != 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  if(pTable == NULL)
+  {
+#if (CRC_LIB_HW_PROGRAMMABLE == 1U)
+    if(((width != 7U) && (width != 8U) && (width != 16U) && (width != 32U)) || ((pParam->Poly & 1U) == 0U))
+    {
+      return HAL_ERROR;
+    }
+#else
+    return HAL_ERROR;
+#endif
+  }
+
+  hcrc->pParam = pParam;
+  hcrc->pTable = pTable;
+  hcrc->Shift  = 32U - width;
+  hcrc->Poly   = (pParam->Reflected != 0U) ? CRC_Lib_Reflect(pParam->Poly, width) : (pParam->Poly << hcrc->Shift);
+  hcrc->Init   = (pParam->Reflected != 0U) ? CRC_Lib_Reflect(pParam->Init, width) : (pParam->Init << hcrc->Shift);
+
+  if(pTable == NULL)
+  {
+    return HAL_OK;
+  }
+
+  /* Table 0 : one byte through the register, tables k : k more zero bytes */
+  for(i = 0U; i < 256U; i++)
+  {
+    if(pParam->Reflected != 0U)
+    {
+      c = i;
+      for(k = 0U; k < 8U; k++)
+      {
+        c = ((c & 1U) != 0U) ? ((c >> 1) ^ hcrc->Poly) : (c >> 1);
+      }
+    }
+    else
+    {
+      c = i << 24;
+      for(k = 0U; k < 8U; k++)
+      {
+        c = ((c & 0x80000000U) != 0U) ? ((c << 1) ^ hcrc->Poly) : (c << 1);
+      }
+    }
+    CRC_LIB_T(0U, i) = c;
+  }
+
+  for(k = 1U; k < CRC_LIB_SLICES; k++)
+  {
+    for(i = 0U; i < 256U; i++)
+    {
+      c = CRC_LIB_T(k - 1U, i);
+      if(pParam->Reflected != 0U)
+      {
+        CRC_LIB_T(k, i) = (c >> 8) ^ CRC_LIB_T(0U, c & 0xFFU);
+      }
+      else
+      {
+        CRC_LIB_T(k, i) = (c << 8) ^ CRC_LIB_T(0U, c >> 24);
+      }
+    }
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  CRC of a buffer
+  * @param  hcrc: handle
+  * @param  pData: data, any alignment
+  * @param  Length: number of bytes
+  * @retval CRC
+  */
+uint32_t CRC_Lib_Compute(const CRC_Lib_HandleTypeDef *hcrc, const uint8_t *pData, uint32_t Length)
+{
+  return CRC_Lib_End(hcrc, CRC_Lib_Update(hcrc, hcrc->Init, pData, Length));
+}
+
+/**
+  * @brief  Start a stream
+  * @param  hcrc: handle
+  * @retval State to give to CRC_Lib_Update()
+  */
+uint32_t CRC_Lib_Begin(const CRC_Lib_HandleTypeDef *hcrc)
+{
+  return hcrc->Init;
+}
+
+/**
+  * @brief  Feed a chunk of a stream
+  * @param  hcrc: handle
+  * @param  State: state from CRC_Lib_Begin() or the previous update
+  * @param  pData: data, any alignment
+  * @param  Length: number of bytes
+  * @retval New state
+  */
+uint32_t CRC_Lib_Update(const CRC_Lib_HandleTypeDef *hcrc, uint32_t State, const uint8_t *pData, uint32_t Length)
+{
+  if(Length == 0U)
+  {
+    return State;
+  }
+
+#if (CRC_LIB_HW_PROGRAMMABLE == 1U)
+  if(hcrc->pTable == NULL)
+  {
+    return CRC_Lib_Hard(hcrc, State, pData, Length);
+  }
+#endif
+
+  if(hcrc->pParam->Reflected != 0U)
+  {
+    return CRC_Lib_SoftReflected(hcrc->pTable, State, pData, Length);
+  }
+
+  return CRC_Lib_SoftNormal(hcrc->pTable, State, pData, Length);
+}
+
+/**
+  * @brief  End a stream
+  * @param  hcrc: handle
+  * @param  State: state from the last update
+  * @retval CRC
+  */
+uint32_t CRC_Lib_End(const CRC_Lib_HandleTypeDef *hcrc, uint32_t State)
+{
+  if(hcrc->pParam->Reflected != 0U)
+  {
+    return State ^ hcrc->pParam->XorOut;
+  }
+
+  return (State >> hcrc->Shift) ^ hcrc->pParam->XorOut;
+}
+
+/**
+  * @brief  CRC of two buffers one after the other from their own CRCs
+  * @param  hcrc: handle
+  * @param  Crc1: CRC of the first buffer
+  * @param  Crc2: CRC of the second buffer
+  * @param  Length2: number of bytes of the second buffer
+  * @retval CRC of the first buffer followed by the second
+  */
+uint32_t CRC_Lib_Combine(const CRC_Lib_HandleTypeDef *hcrc, uint32_t Crc1, uint32_t Crc2, uint32_t Length2)
+{
+  uint32_t even[32];
+  uint32_t odd[32];
+  uint32_t state;
+  uint32_t i;
+
+  if(Length2 == 0U)
+  {
+    return Crc1;
+  }
+
+  /* CRC(A.B) register = Z^n(register(A) ^ Init) ^ register(B), Z^n being
+     the register through n zero bytes, a linear map built by squaring */
+  state = CRC_Lib_State(hcrc, Crc1) ^ hcrc->Init;
+
+  /* One zero bit */
+  if(hcrc->pParam->Reflected != 0U)
+  {
+    odd[0] = hcrc->Poly;
+    for(i = 1U; i < 32U; i++)
+    {
+      odd[i] = 1UL << (i - 1U);
+    }
+  }
+  else
+  {
+    for(i = 0U; i < 31U; i++)
+    {
+      odd[i] = 1UL << (i + 1U);
+    }
+    odd[31] = hcrc->Poly;
+  }
+
+  /* Two, then four zero bits */
+  CRC_Lib_Gf2Square(even, odd);
+  CRC_Lib_Gf2Square(odd, even);
+
+  /* One zero byte, then each power of two of bytes on the bits of Length2 */
+  do
+  {
+    CRC_Lib_Gf2Square(even, odd);
+    if((Length2 & 1U) != 0U)
+    {
+      state = CRC_Lib_Gf2Times(even, state);
+    }
+    Length2 >>= 1;
+
+    if(Length2 == 0U)
+    {
+      break;
+    }
+
+    CRC_Lib_Gf2Square(odd, even);
+    if((Length2 & 1U) != 0U)
+    {
+      state = CRC_Lib_Gf2Times(odd, state);
+    }
+    Length2 >>= 1;
+  } while(Length2 != 0U);
+
+  return CRC_Lib_End(hcrc, state ^ CRC_Lib_State(hcrc, Crc2));
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Reverse the low bits of a word
+  * @param  Value: bits to reverse
+  * @param  Width: number of low bits, 1 to 32
+  * @retval Reversed bits
+  */
+static uint32_t CRC_Lib_Reflect(uint32_t Value, uint32_t Width)
+{
+#if (__CORTEX_M >= 3U)
+  return __RBIT(Value) >> (32U - Width);
+#else
+  uint32_t result = 0U;
+  uint32_t i;
+
+  for(i = 0U; i < Width; i++)
+  {
+    result = (result << 1) | ((Value >> i) & 1U);
+  }
+
+  return result;
+#endif
+}
+
+/**
+  * @brief  Register holding a CRC result
+  * @param  hcrc: handle
+  * @param  Crc: CRC
+  * @retval Register
+  */
+static uint32_t CRC_Lib_State(const CRC_Lib_HandleTypeDef *hcrc, uint32_t Crc)
+{
+  if(hcrc->pParam->Reflected != 0U)
+  {
+    return Crc ^ hcrc->pParam->XorOut;
+  }
+
+  return (Crc ^ hcrc->pParam->XorOut) << hcrc->Shift;
+}
+
+/**
+  * @brief  Reflected CRC on the CPU, register in the low bits
+  * @param  pTable: tables
+  * @param  Crc: register
+  * @param  pData: data
+  * @param  Length: number of bytes, not 0
+  * @retval Register
+  */
+static uint32_t CRC_Lib_SoftReflected(const uint32_t *pTable, uint32_t Crc, const uint8_t *pData, uint32_t Length)
+{
+#if (CRC_LIB_SLICES > 1U)
+  uint32_t a;
+#endif
+#if (CRC_LIB_SLICES == 8U)
+  uint32_t b;
+#endif
+
+  /* Bytes up to a word boundary, Cortex-M0 has no unaligned loads */
+  while((Length != 0U) && (((uint32_t)pData & 3U) != 0U))
+  {
+    Crc = (Crc >> 8) ^ CRC_LIB_T(0U, (Crc ^ *pData++) & 0xFFU);
+    Length--;
+  }
+
+#if (CRC_LIB_SLICES == 8U)
+  while(Length >= 8U)
+  {
+    a = Crc ^ ((const uint32_t *)pData)[0];
+    b = ((const uint32_t *)pData)[1];
+    Crc = CRC_LIB_T(7U, a & 0xFFU)         ^ CRC_LIB_T(6U, (a >> 8) & 0xFFU) ^
+          CRC_LIB_T(5U, (a >> 16) & 0xFFU) ^ CRC_LIB_T(4U, a >> 24)          ^
+          CRC_LIB_T(3U, b & 0xFFU)         ^ CRC_LIB_T(2U, (b >> 8) & 0xFFU) ^
+          CRC_LIB_T(1U, (b >> 16) & 0xFFU) ^ CRC_LIB_T(0U, b >> 24);
+    pData  += 8U;
+    Length -= 8U;
+  }
+#elif (CRC_LIB_SLICES == 4U)
+  while(Length >= 4U)
+  {
+    a = Crc ^ ((const uint32_t *)pData)[0];
+    Crc = CRC_LIB_T(3U, a & 0xFFU)         ^ CRC_LIB_T(2U, (a >> 8) & 0xFFU) ^
+          CRC_LIB_T(1U, (a >> 16) & 0xFFU) ^ CRC_LIB_T(0U, a >> 24);
+    pData  += 4U;
+    Length -= 4U;
+  }
+#endif
+
+  while(Length != 0U)
+  {
+    Crc = (Crc >> 8) ^ CRC_LIB_T(0U, (Crc ^ *pData++) & 0xFFU);
+    Length--;
+  }
+
+  return Crc;
+}
+
+/**
+  * @brief  Normal CRC on the CPU, register in the high bits
+  * @param  pTable: tables
+  * @param  Crc: register
+  * @param  pData: data
+  * @param  Length: number of bytes, not 0
+  * @retval Register
+  */
+static uint32_t CRC_Lib_SoftNormal(const uint32_t *pTable, uint32_t Crc, const uint8_t *pData, uint32_t Length)
+{
+#if (CRC_LIB_SLICES > 1U)
+  uint32_t a;
+#endif
+#if (CRC_LIB_SLICES == 8U)
+  uint32_t b;
+#endif
+
+  while((Length != 0U) && (((uint32_t)pData & 3U) != 0U))
+  {
+    Crc = (Crc << 8) ^ CRC_LIB_T(0U, (Crc >> 24) ^ *pData++);
+    Length--;
+  }
+
+  /* First byte of the word in the top bits */
+#if (CRC_LIB_SLICES == 8U)
+  while(Length >= 8U)
+  {
+    a = Crc ^ __REV(((const uint32_t *)pData)[0]);
+    b = __REV(((const uint32_t *)pData)[1]);
+    Crc = CRC_LIB_T(7U, a >> 24)         ^ CRC_LIB_T(6U, (a >> 16) & 0xFFU) ^
+          CRC_LIB_T(5U, (a >> 8) & 0xFFU) ^ CRC_LIB_T(4U, a & 0xFFU)         ^
+          CRC_LIB_T(3U, b >> 24)         ^ CRC_LIB_T(2U, (b >> 16) & 0xFFU) ^
+          CRC_LIB_T(1U, (b >> 8) & 0xFFU) ^ CRC_LIB_T(0U, b & 0xFFU);
+    pData  += 8U;
+    Length -= 8U;
+  }
+#elif (CRC_LIB_SLICES == 4U)
+  while(Length >= 4U)
+  {
+    a = Crc ^ __REV(((const uint32_t *)pData)[0]);
+    Crc = CRC_LIB_T(3U, a >> 24)         ^ CRC_LIB_T(2U, (a >> 16) & 0xFFU) ^
+          CRC_LIB_T(1U, (a >> 8) & 0xFFU) ^ CRC_LIB_T(0U, a & 0xFFU);
+    pData  += 4U;
+    Length -= 4U;
+  }
+#endif
+
+  while(Length != 0U)
+  {
+    Crc = (Crc << 8) ^ CRC_LIB_T(0U, (Crc >> 24) ^ *pData++);
+    Length--;
+  }
+
+  return Crc;
+}
+
+#if (CRC_LIB_HW_PROGRAMMABLE == 1U)
+/**
+  * @brief  CRC on the CRC unit
+  * @note   The unit works MSB first : reflected algorithms reverse the
+  *         input bits per byte and the register around the computation.
+  *         Words are written byte swapped so that their first byte goes
+  *         first.
+  * @param  hcrc: handle
+  * @param  State: register
+  * @param  pData: data
+  * @param  Length: number of bytes, not 0
+  * @retval Register
+  */
+static uint32_t CRC_Lib_Hard(const CRC_Lib_HandleTypeDef *hcrc, uint32_t State, const uint8_t *pData, uint32_t Length)
+{
+  uint32_t width = hcrc->pParam->Width;
+  uint32_t reflected = hcrc->pParam->Reflected;
+  uint32_t cr;
+  uint32_t result;
+
+  switch(width)
+  {
+    case 7U:
+      cr = CRC_CR_POLYSIZE_1 | CRC_CR_POLYSIZE_0;
+      break;
+    case 8U:
+      cr = CRC_CR_POLYSIZE_1;
+      break;
+    case 16U:
+      cr = CRC_CR_POLYSIZE_0;
+      break;
+    default:
+      cr = 0U;
+      break;
+  }
+  if(reflected != 0U)
+  {
+    cr |= CRC_CR_REV_IN_0;
+  }
+
+  CRC_LIB_LOCK();
+
+  CRC->POL  = hcrc->pParam->Poly;
+  CRC->CR   = cr;
+  CRC->INIT = (reflected != 0U) ? CRC_Lib_Reflect(State, width) : (State >> hcrc->Shift);
+  CRC->CR   = cr | CRC_CR_RESET;
+
+  while((Length != 0U) && (((uint32_t)pData & 3U) != 0U))
+  {
+    *(__IO uint8_t *)(__IO void *)(&CRC->DR) = *pData++;
+    Length--;
+  }
+
+  while(Length >= 4U)
+  {
+    CRC->DR = __REV(*(const uint32_t *)pData);
+    pData  += 4U;
+    Length -= 4U;
+  }
+
+  while(Length != 0U)
+  {
+    *(__IO uint8_t *)(__IO void *)(&CRC->DR) = *pData++;
+    Length--;
+  }
+
+  result = CRC->DR;
+
+  CRC_LIB_UNLOCK();
+
+  if(width < 32U)
+  {
+    result &= (1UL << width) - 1U;
+  }
+
+  return (reflected != 0U) ? CRC_Lib_Reflect(result, width) : (result << hcrc->Shift);
+}
+#endif
+
+/**
+  * @brief  GF(2) matrix times vector
+  * @param  pMat: 32 columns
+  * @param  Vec: vector
+  * @retval Product
+  */
+static uint32_t CRC_Lib_Gf2Times(const uint32_t *pMat, uint32_t Vec)
+{
+  uint32_t sum = 0U;
+
+  while(Vec != 0U)
+  {
+    if((Vec & 1U) != 0U)
+    {
+      sum ^= *pMat;
+    }
+    Vec >>= 1;
+    pMat++;
+  }
+
+  return sum;
+}
+
+/**
+  * @brief  GF(2) matrix squared
+  * @param  pSquare: 32 columns out
+  * @param  pMat: 32 columns in
+  * @retval None
+  */
+static void CRC_Lib_Gf2Square(uint32_t *pSquare, const uint32_t *pMat)
+{
+  uint32_t i;
+
+  for(i = 0U; i < 32U; i++)
+  {
+    pSquare[i] = CRC_Lib_Gf2Times(pMat, pMat[i]);
+  }
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
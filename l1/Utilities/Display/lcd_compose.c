@@ -0,0 +1,453 @@
+/**
+  ******************************************************************************
+  * @file    lcd_compose.c
+  * @author  MCD Application Team
+  * @brief   Segment LCD frame composer: glyph maps, shadow frame and interrupt
+  *          driven update of the LCD RAM
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- initialize the LCD with HAL_LCD_Init(), enable the LCD interrupt and call
+   HAL_LCD_IRQHandler() from LCD_IRQHandler(): this module implements
+   HAL_LCD_UpdateDisplayDoneCallback().
+
+2- describe the character positions of the glass: the segment of each glyph
+   bit, LCD_COMPOSE_SEG(COM, SEG) with the terminal numbers of the glass
+   datasheet, e.g. for a 7 segment digit on COM0 to COM3:
+     { LCD_COMPOSE_SEG(0, 1), LCD_COMPOSE_SEG(1, 1), ...   segments a to g
+       LCD_COMPOSE_NO_SEG, ...                             bits 7 to 14
+       LCD_COMPOSE_SEG(3, 0) }                             decimal point
+   Characters use LCD_Compose_Font7, or the font given in the
+   configuration for 14 segment glasses, one glyph per character.
+
+3- fill a LCD_Compose_ConfigTypeDef and call LCD_Compose_Init(), then for
+   each screen:
+   (+) compose the frame in the shadow buffer with LCD_Compose_Clear(),
+       LCD_Compose_PutString(), LCD_Compose_SetGlyph() and
+       LCD_Compose_SetSegment() for the icons. Nothing reaches the LCD.
+   (+) call LCD_Compose_Commit(): the frame is copied, the LCD RAM
+       registers which changed are written and the update requested, then
+       the function returns without waiting for the end of frame. A frame
+       identical to the displayed one is dropped, without callback.
+
+4- LCD_Compose_DoneCallback() is called from the LCD interrupt once the
+   last committed frame is on the glass. A commit made during an update
+   is applied when it ends, the latest one replacing those not applied
+   yet: composing the next frame never waits.
+
+5- the LCD keeps running in Stop mode and applies the update at the next
+   frame, but the Update Display Done interrupt needs the APB clock: it is
+   served after the wake up. With Utilities/Power/power_mgr, define
+   LCD_COMPOSE_USE_POWER_MGR in main.h to allow only Sleep mode while an
+   update is in progress (one or two frames) when the completion must be
+   reported on time, lock LCD_COMPOSE_PWR_LOCK.
+*******************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include "lcd_compose.h"
+#if defined(LCD_COMPOSE_USE_POWER_MGR)
+#include "power_mgr.h"
+#endif
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define LCD_COMPOSE_RAM_REGISTERS   16U     /* COM n on registers 2n and 2n+1 */
+#define LCD_COMPOSE_MAX_COM         7U
+#define LCD_COMPOSE_MAX_SEG         63U
+
+/* Private macro -------------------------------------------------------------*/
+#define LCD_COMPOSE_REGISTER(__SEGMENT__)  ((((__SEGMENT__) >> 8) * 2U) + (((__SEGMENT__) & 0xFFU) / 32U))
+#define LCD_COMPOSE_BIT(__SEGMENT__)       (1UL << ((__SEGMENT__) & 0x1FU))
+
+/* Private variables ---------------------------------------------------------*/
+static LCD_Compose_ConfigTypeDef  ComposeConfig;
+static uint32_t                   ComposeShadow[LCD_COMPOSE_RAM_REGISTERS];  /* Frame being composed     */
+static uint32_t                   ComposeNext[LCD_COMPOSE_RAM_REGISTERS];    /* Last committed frame     */
+static uint32_t                   ComposeShown[LCD_COMPOSE_RAM_REGISTERS];   /* Content of the LCD RAM   */
+static __IO uint32_t              ComposeBusy;      /* Update in progress                  */
+static __IO uint32_t              ComposePending;   /* Commit waiting for the update end   */
+static uint32_t                   ComposeEnabled;
+static LCD_Compose_StatsTypeDef   ComposeStats;
+
+/* Exported variables --------------------------------------------------------*/
+/* 7 segment glyphs, bit 0 to 6 for segments a to g, of ' ' to '_': lower
+   case letters use the upper case glyphs */
+const uint16_t LCD_Compose_Font7[] =
+{
+  0x0000U, 0x8006U, 0x0022U, 0x0000U, 0x006DU, 0x0000U, 0x0000U, 0x0002U,   /*   ! " # $ % & '  */
+  0x0039U, 0x000FU, 0x0000U, 0x0000U, 0x8000U, 0x0040U, 0x8000U, 0x0052U,   /* ( ) * + , - . /  */
+  0x003FU, 0x0006U, 0x005BU, 0x004FU, 0x0066U, 0x006DU, 0x007DU, 0x0007U,   /* 0 1 2 3 4 5 6 7  */
+  0x007FU, 0x006FU, 0x4000U, 0x0000U, 0x0000U, 0x0048U, 0x0000U, 0x0053U,   /* 8 9 : ; < = > ?  */
+  0x0000U, 0x0077U, 0x007CU, 0x0039U, 0x005EU, 0x0079U, 0x0071U, 0x003DU,   /* @ A B C D E F G  */
+  0x0076U, 0x0006U, 0x001EU, 0x0075U, 0x0038U, 0x0055U, 0x0054U, 0x003FU,   /* H I J K L M N O  */
+  0x0073U, 0x0067U, 0x0050U, 0x006DU, 0x0078U, 0x003EU, 0x001CU, 0x006AU,   /* P Q R S T U V W  */
+  0x0076U, 0x006EU, 0x005BU, 0x0039U, 0x0064U, 0x000FU, 0x0023U, 0x0008U    /* X Y Z [ \ ] ^ _  */
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t LCD_Compose_Glyph(char Char);
+static uint32_t LCD_Compose_Start(void);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Check the glass description and clear the shadow frame
+  * @param  pConfig: LCD handle, positions and font, copied, the positions
+  *         and font arrays are kept
+  * @retval HAL_OK, or HAL_ERROR on a wrong configuration
+  */
+HAL_StatusTypeDef LCD_Compose_Init(const LCD_Compose_ConfigTypeDef *pConfig)
+{
+  uint32_t d, n, segment;
+
+  if((pConfig == NULL) || (pConfig->hlcd == NULL) || ((pConfig->Digits != 0U) && (pConfig->pDigits == NULL)) ||
+     ((pConfig->pFont != NULL) && (pConfig->FontLast < pConfig->FontFirst)) ||
+     (pConfig->hlcd->State == HAL_LCD_STATE_RESET))
+  {
+    return HAL_ERROR;
+  }
+
+  for(d = 0U; d < pConfig->Digits; d++)
+  {
+    for(n = 0U; n < LCD_COMPOSE_GLYPH_SEGMENTS; n++)
+    {
+      segment = pConfig->pDigits[d].Segment[n];
+      if((segment != LCD_COMPOSE_NO_SEG) &&
+         (((segment >> 8) > LCD_COMPOSE_MAX_COM) || ((segment & 0xFFU) > LCD_COMPOSE_MAX_SEG)))
+      {
+        return HAL_ERROR;
+      }
+    }
+  }
+
+  ComposeEnabled = 0U;
+  ComposeConfig  = *pConfig;
+  if(ComposeConfig.pFont == NULL)
+  {
+    ComposeConfig.pFont     = LCD_Compose_Font7;
+    ComposeConfig.FontFirst = (uint8_t)LCD_COMPOSE_FONT7_FIRST;
+    ComposeConfig.FontLast  = (uint8_t)LCD_COMPOSE_FONT7_LAST;
+  }
+
+  /* The LCD RAM keeps the frame written before: commits only write the
+     registers changed since */
+  for(n = 0U; n < LCD_COMPOSE_RAM_REGISTERS; n++)
+  {
+    ComposeShown[n]  = pConfig->hlcd->Instance->RAM[n];
+    ComposeShadow[n] = 0U;
+    ComposeNext[n]   = ComposeShown[n];
+  }
+  ComposeBusy    = 0U;
+  ComposePending = 0U;
+  ComposeStats.Commits   = 0U;
+  ComposeStats.Updates   = 0U;
+  ComposeStats.Unchanged = 0U;
+  ComposeStats.Replaced  = 0U;
+  ComposeStats.Errors    = 0U;
+  ComposeEnabled = 1U;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Turn off all the segments of the shadow frame
+  * @retval None
+  */
+void LCD_Compose_Clear(void)
+{
+  uint32_t n;
+
+  for(n = 0U; n < LCD_COMPOSE_RAM_REGISTERS; n++)
+  {
+    ComposeShadow[n] = 0U;
+  }
+}
+
+/**
+  * @brief  Turn a segment of the shadow frame on or off, for the icons
+  * @param  Segment: LCD_COMPOSE_SEG(COM, SEG)
+  * @param  On: 1 to turn the segment on, 0 to turn it off
+  * @retval None
+  */
+void LCD_Compose_SetSegment(uint32_t Segment, uint32_t On)
+{
+  uint32_t reg;
+
+  if(Segment == LCD_COMPOSE_NO_SEG)
+  {
+    return;
+  }
+
+  reg = LCD_COMPOSE_REGISTER(Segment);
+  if(reg >= LCD_COMPOSE_RAM_REGISTERS)
+  {
+    return;
+  }
+  if(On != 0U)
+  {
+    ComposeShadow[reg] |= LCD_COMPOSE_BIT(Segment);
+  }
+  else
+  {
+    ComposeShadow[reg] &= ~LCD_COMPOSE_BIT(Segment);
+  }
+}
+
+/**
+  * @brief  Draw a glyph at a character position of the shadow frame
+  * @param  Digit: position, 0 on the left
+  * @param  Glyph: segments turned on, bit n for Segment[n] of the position,
+  *         the other segments of the position are turned off
+  * @retval None
+  */
+void LCD_Compose_SetGlyph(uint32_t Digit, uint32_t Glyph)
+{
+  const LCD_Compose_DigitTypeDef *pdigit;
+  uint32_t n;
+
+  if(Digit >= ComposeConfig.Digits)
+  {
+    return;
+  }
+
+  pdigit = &ComposeConfig.pDigits[Digit];
+  for(n = 0U; n < LCD_COMPOSE_GLYPH_SEGMENTS; n++)
+  {
+    LCD_Compose_SetSegment(pdigit->Segment[n], (Glyph >> n) & 1U);
+  }
+}
+
+/**
+  * @brief  Draw a string from a character position of the shadow frame
+  * @note   A '.' or ':' following a character turns on the decimal point
+  *         or colon of its position instead of using the next one.
+  * @param  Digit: first position, 0 on the left
+  * @param  pText: string, cut at the last position
+  * @retval Positions drawn
+  */
+uint32_t LCD_Compose_PutString(uint32_t Digit, const char *pText)
+{
+  uint32_t d = Digit, glyph;
+
+  while((*pText != '\0') && (d < ComposeConfig.Digits))
+  {
+    glyph = LCD_Compose_Glyph(*pText);
+    pText++;
+    while((*pText == '.') || (*pText == ':'))
+    {
+      glyph |= (*pText == '.') ? LCD_COMPOSE_DP : LCD_COMPOSE_COLON;
+      pText++;
+    }
+    LCD_Compose_SetGlyph(d, glyph);
+    d++;
+  }
+
+  return d - Digit;
+}
+
+/**
+  * @brief  Commit the shadow frame: the LCD RAM registers changed are
+  *         written and the update requested, without waiting for it
+  * @note   During an update, the frame is kept and applied when it ends.
+  * @retval HAL_OK, HAL_ERROR when not initialized, or the status of the LCD
+  *         RAM write
+  */
+HAL_StatusTypeDef LCD_Compose_Commit(void)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t primask, n;
+
+  if(ComposeEnabled == 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  ComposeStats.Commits++;
+  for(n = 0U; n < LCD_COMPOSE_RAM_REGISTERS; n++)
+  {
+    ComposeNext[n] = ComposeShadow[n];
+  }
+  if(ComposeBusy != 0U)
+  {
+    if(ComposePending != 0U)
+    {
+      ComposeStats.Replaced++;
+    }
+    ComposePending = 1U;
+  }
+  else if(LCD_Compose_Start() != 0U)
+  {
+    status = HAL_ERROR;
+  }
+  __set_PRIMASK(primask);
+
+  return status;
+}
+
+/**
+  * @brief  Tell whether an update is in progress
+  * @retval 1 until the last committed frame is on the glass, 0 otherwise
+  */
+uint32_t LCD_Compose_IsBusy(void)
+{
+  return ComposeBusy;
+}
+
+/**
+  * @brief  Get the commit counters
+  * @param  pStats: Counters
+  * @retval None
+  */
+void LCD_Compose_GetStats(LCD_Compose_StatsTypeDef *pStats)
+{
+  *pStats = ComposeStats;
+}
+
+/**
+  * @brief  Update display done: apply the frame committed meanwhile
+  * @param  hlcd: LCD handle
+  * @retval None
+  */
+void HAL_LCD_UpdateDisplayDoneCallback(LCD_HandleTypeDef *hlcd)
+{
+  if((hlcd != ComposeConfig.hlcd) || (ComposeBusy == 0U))
+  {
+    return;
+  }
+
+  ComposeBusy = 0U;
+  if(ComposePending != 0U)
+  {
+    ComposePending = 0U;
+    (void)LCD_Compose_Start();
+  }
+#if defined(LCD_COMPOSE_USE_POWER_MGR)
+  if(ComposeBusy == 0U)
+  {
+    PWR_Mgr_Unlock(LCD_COMPOSE_PWR_LOCK);
+  }
+#endif
+
+  if(ComposeBusy == 0U)
+  {
+    LCD_Compose_DoneCallback();
+  }
+}
+
+/**
+  * @brief  Last committed frame on the glass, called from the LCD interrupt
+  * @retval None
+  */
+__weak void LCD_Compose_DoneCallback(void)
+{
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the LCD_Compose_DoneCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Glyph of a character
+  * @param  Char: character
+  * @retval Glyph, 0 when the font has none
+  */
+static uint32_t LCD_Compose_Glyph(char Char)
+{
+  uint32_t c = (uint8_t)Char;
+
+  if(((c < ComposeConfig.FontFirst) || (c > ComposeConfig.FontLast)) && (c >= 'a') && (c <= 'z'))
+  {
+    c -= 'a' - 'A';
+  }
+  if((c < ComposeConfig.FontFirst) || (c > ComposeConfig.FontLast))
+  {
+    return 0U;
+  }
+
+  return ComposeConfig.pFont[c - ComposeConfig.FontFirst];
+}
+
+/**
+  * @brief  Write the committed frame in the LCD RAM and request the update,
+  *         called with the interrupts masked or from the LCD interrupt
+  * @retval 0 when started or unchanged, 1 on a write error
+  */
+static uint32_t LCD_Compose_Start(void)
+{
+  uint32_t n, written = 0U;
+
+  for(n = 0U; n < LCD_COMPOSE_RAM_REGISTERS; n++)
+  {
+    if(ComposeNext[n] == ComposeShown[n])
+    {
+      continue;
+    }
+    /* The first write waits for the end of a synchronous update and locks
+       the LCD until the update display done interrupt */
+    if(HAL_LCD_Write(ComposeConfig.hlcd, n, 0U, ComposeNext[n]) != HAL_OK)
+    {
+      ComposeStats.Errors++;
+      return 1U;
+    }
+    ComposeShown[n] = ComposeNext[n];
+    written++;
+  }
+
+  if(written == 0U)
+  {
+    ComposeStats.Unchanged++;
+    return 0U;
+  }
+
+  ComposeBusy = 1U;
+#if defined(LCD_COMPOSE_USE_POWER_MGR)
+  (void)PWR_Mgr_Lock(LCD_COMPOSE_PWR_LOCK, PWR_MGR_MODE_SLEEP);
+#endif
+  if(HAL_LCD_UpdateDisplayRequest_IT(ComposeConfig.hlcd) != HAL_OK)
+  {
+    ComposeBusy = 0U;
+#if defined(LCD_COMPOSE_USE_POWER_MGR)
+    PWR_Mgr_Unlock(LCD_COMPOSE_PWR_LOCK);
+#endif
+    ComposeStats.Errors++;
+    return 1U;
+  }
+  ComposeStats.Updates++;
+
+  return 0U;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
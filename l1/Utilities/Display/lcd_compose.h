@@ -0,0 +1,121 @@
+/**
+  ******************************************************************************
+  * @file    lcd_compose.h
+  * @author  MCD Application Team
+  * @brief   Header for lcd_compose module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _LCD_COMPOSE_H__
+#define _LCD_COMPOSE_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#if !defined(HAL_LCD_MODULE_ENABLED)
+#error "lcd_compose requires the HAL LCD driver"
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+/* Segment of the glass: its common and segment terminals */
+#define LCD_COMPOSE_SEG(__COM__, __SEG__)  ((uint16_t)(((uint32_t)(__COM__) << 8) | (uint32_t)(__SEG__)))
+#define LCD_COMPOSE_NO_SEG            0xFFFFU
+
+/* Glyph bits: a to g for a 7 segment digit, free for other glasses, with
+   the decimal point and colon of the position in the two upper bits */
+#define LCD_COMPOSE_GLYPH_SEGMENTS    16U
+#define LCD_COMPOSE_COLON             0x4000U
+#define LCD_COMPOSE_DP                0x8000U
+
+/* LCD_Compose_Font7 range */
+#define LCD_COMPOSE_FONT7_FIRST       ' '
+#define LCD_COMPOSE_FONT7_LAST        '_'
+
+/* Lock of power_mgr held during an update, with LCD_COMPOSE_USE_POWER_MGR.
+   Override in main.h. */
+#if !defined(LCD_COMPOSE_PWR_LOCK)
+#define LCD_COMPOSE_PWR_LOCK          29U
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct
+{
+  uint16_t  Segment[LCD_COMPOSE_GLYPH_SEGMENTS];  /* LCD_COMPOSE_SEG() of each glyph bit,
+                                                     LCD_COMPOSE_NO_SEG when absent */
+} LCD_Compose_DigitTypeDef;
+
+typedef struct
+{
+  LCD_HandleTypeDef               *hlcd;       /* Initialized                          */
+  const LCD_Compose_DigitTypeDef  *pDigits;    /* Character positions, left to right   */
+  uint32_t                        Digits;
+  const uint16_t                  *pFont;      /* Glyph of each character from
+                                                  FontFirst, NULL for LCD_Compose_Font7 */
+  uint8_t                         FontFirst;
+  uint8_t                         FontLast;
+} LCD_Compose_ConfigTypeDef;
+
+typedef struct
+{
+  uint32_t  Commits;      /* Calls to LCD_Compose_Commit()                         */
+  uint32_t  Updates;      /* Update display requests                               */
+  uint32_t  Unchanged;    /* Commits of the image already displayed, dropped      */
+  uint32_t  Replaced;     /* Commits replaced by a newer one before their update  */
+  uint32_t  Errors;       /* LCD RAM writes failed                                 */
+} LCD_Compose_StatsTypeDef;
+
+/* Exported variables --------------------------------------------------------*/
+extern const uint16_t LCD_Compose_Font7[];
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef LCD_Compose_Init(const LCD_Compose_ConfigTypeDef *pConfig);
+void              LCD_Compose_Clear(void);
+void              LCD_Compose_SetSegment(uint32_t Segment, uint32_t On);
+void              LCD_Compose_SetGlyph(uint32_t Digit, uint32_t Glyph);
+uint32_t          LCD_Compose_PutString(uint32_t Digit, const char *pText);
+HAL_StatusTypeDef LCD_Compose_Commit(void);
+uint32_t          LCD_Compose_IsBusy(void);
+void              LCD_Compose_GetStats(LCD_Compose_StatsTypeDef *pStats);
+
+void LCD_Compose_DoneCallback(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _LCD_COMPOSE_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,642 @@
+/**
+  ******************************************************************************
+  * @file    bin_log.c
+  * @author  MCD Application Team
+  * @brief   Deferred-format binary logging: format string identifiers
+  *          and raw arguments recorded in a lock-free ring, drained to a
+  *          UART, the ITM, the USB CDC class or lcd_log
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- keep the format strings out of the loaded image: the linker script
+   collects them in a section with no load address, as linker.tpl does :
+      .binlog_fmt 0 (INFO) : { __binlog_fmt_start = .; KEEP(*(.binlog_fmt*)) }
+   The identifier of a message is the word offset of its format string in
+   this section. With BIN_LOG_FORMAT set, the strings are read on the device
+   and must be linked in the flash instead :
+      .binlog_fmt : { . = ALIGN(4); __binlog_fmt_start = .; KEEP(*(.binlog_fmt*)) } >FLASH
+
+2- call BIN_Log_Init() once, then record the messages from any context,
+   interrupts included, with BIN_ErrLog(), BIN_UsrLog() and BIN_DbgLog() :
+      BIN_UsrLog("adc %u: %d mV, %f C", channel, mv, BIN_LOG_FLOAT(t));
+   A record is a header word, a time stamp and the arguments, one word
+   each: nothing is formatted on the device. At most 8 arguments; %s
+   arguments are addresses, printed by the host decoder when they point
+   to a constant string of the image. Messages above BIN_LOG_LEVEL are
+   removed at build time.
+
+3- drain the ring from a single context, ex. the main loop, with one of :
+      - BIN_Log_UART_Process(&huart), sending the records over a UART by
+        DMA, or by interrupt when the UART has no DMA channel
+      - BIN_Log_FlushITM(0), sending the records to the SWO output
+        (Cortex-M3/M4/M7, the ITM being enabled by the debugger)
+      - BIN_Log_Read(), copying whole records, ex. for the USB CDC class :
+           n = BIN_Log_Read(buffer, sizeof(buffer));
+           if (n != 0U) { CDC_Transmit_FS(buffer, n); }
+      - BIN_Log_LCD_Process() with BIN_LOG_FORMAT and BIN_LOG_LCD set,
+        formatting the records on the device and printing them with the
+        LCD_ErrLog(), LCD_UsrLog() and LCD_DbgLog() macros of lcd_log
+
+4- decode the stream on the host with OSQ/ldscripts/tpl/bin_log_decode.py
+   and the ELF file of the application :
+      python bin_log_decode.py firmware.elf --serial COM3 --baud 921600
+   Recording never blocks: when the ring is full the record is dropped and
+   counted by BIN_Log_GetDropped(), and the readers insert a record telling
+   how many were lost. BIN_LOG_BUFFER_SIZE sets the ring depth, in words.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "bin_log.h"
+#include <stdarg.h>
+#include <string.h>
+#if (BIN_LOG_LCD == 1)
+#include "lcd_log.h"
+#endif
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Words of a record without its arguments */
+#define LOG_RECORD_WORDS      2U
+
+#if (BIN_LOG_LCD == 1) && (BIN_LOG_FORMAT == 0)
+ #error "BIN_LOG_LCD requires BIN_LOG_FORMAT"
+#endif
+
+/* Private macro -------------------------------------------------------------*/
+#define LOG_WORD(__INDEX__)   BinLogBuffer[(__INDEX__) & (BIN_LOG_BUFFER_SIZE - 1U)]
+
+/* Private variables ---------------------------------------------------------*/
+/* Start of the format string section, from the linker script */
+extern const char __binlog_fmt_start[];
+
+static uint32_t      BinLogBuffer[BIN_LOG_BUFFER_SIZE];
+static __IO uint32_t BinLogHead = 0U;      /* Next word to reserve, moved by the producers */
+static __IO uint32_t BinLogTail = 0U;      /* Next word to read, moved by the reader       */
+static __IO uint32_t BinLogDropped = 0U;   /* Records lost on a full ring                  */
+static uint32_t      BinLogReported = 0U;  /* Dropped records already reported             */
+
+#if defined(HAL_UART_MODULE_ENABLED)
+static uint8_t BinLogTx[BIN_LOG_UART_TX_SIZE] __attribute__((aligned(32)));
+#endif
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t Log_Next(uint32_t *pRecord, uint32_t MaxWords);
+#if (BIN_LOG_FORMAT == 1)
+static char    *Log_Number(char *pOut, char *pEnd, uint32_t Value, uint32_t Base, uint32_t Negative,
+                           uint32_t Flags, uint32_t Width, int32_t Precision);
+static char    *Log_Float(char *pOut, char *pEnd, float Value, uint32_t Flags, uint32_t Width, int32_t Precision);
+#endif
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Clear the ring and start the time base of the records.
+  * @retval None
+  */
+void BIN_Log_Init(void)
+{
+  memset(BinLogBuffer, 0, sizeof(BinLogBuffer));
+  BinLogHead = 0U;
+  BinLogTail = 0U;
+  BinLogDropped = 0U;
+  BinLogReported = 0U;
+
+#if (__CORTEX_M >= 3U)
+  /* Enable the DWT cycle counter */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+/**
+  * @brief  Record one message, called by the BIN_LOG() macros.
+  * @note   May be called from any context, including nested interrupts.
+  * @param  Level BIN_LOG_LEVEL_ERR, BIN_LOG_LEVEL_USR or BIN_LOG_LEVEL_DBG
+  * @param  pFormat format string, in BIN_LOG_SECTION
+  * @param  ArgNbr number of uint32_t arguments that follow, at most 8
+  * @retval None
+  */
+void BIN_Log_Write(uint32_t Level, const char *pFormat, uint32_t ArgNbr, ...)
+{
+  va_list  args;
+  uint32_t length = ArgNbr + LOG_RECORD_WORDS;
+  uint32_t head;
+  uint32_t i;
+#if (__CORTEX_M < 3U)
+  uint32_t primask;
+#endif
+
+  /* Reserve the words of the record */
+#if (__CORTEX_M >= 3U)
+  do
+  {
+    head = __LDREXW(&BinLogHead);
+    if ((head + length - BinLogTail) > BIN_LOG_BUFFER_SIZE)
+    {
+      __CLREX();
+      do
+      {
+      } while (__STREXW(__LDREXW(&BinLogDropped) + 1U, &BinLogDropped) != 0U);
+      return;
+    }
+  } while (__STREXW(head + length, &BinLogHead) != 0U);
+#else
+  primask = __get_PRIMASK();
+  __disable_irq();
+  head = BinLogHead;
+  if ((head + length - BinLogTail) > BIN_LOG_BUFFER_SIZE)
+  {
+    BinLogDropped++;
+    __set_PRIMASK(primask);
+    return;
+  }
+  BinLogHead = head + length;
+  __set_PRIMASK(primask);
+#endif
+
+  LOG_WORD(head + 1U) = BIN_LOG_TIMESTAMP();
+  va_start(args, ArgNbr);
+  for (i = 0U; i < ArgNbr; i++)
+  {
+    LOG_WORD(head + LOG_RECORD_WORDS + i) = va_arg(args, uint32_t);
+  }
+  va_end(args);
+  __DMB();
+
+  /* A non zero header hands the record to the reader */
+  LOG_WORD(head) = BIN_LOG_HEADER(Level, ArgNbr, ((uint32_t)pFormat - (uint32_t)__binlog_fmt_start) >> 2);
+}
+
+/**
+  * @brief  Take the oldest record out of the ring.
+  * @note   Reports the dropped records first, with a BIN_LOG_ID_DROPPED record.
+  * @param  pRecord destination of the record
+  * @param  MaxWords size of pRecord in words, the record being left in the
+  *         ring when it does not fit
+  * @retval Number of words of the record, 0 when none is complete or fits
+  */
+static uint32_t Log_Next(uint32_t *pRecord, uint32_t MaxWords)
+{
+  uint32_t dropped = BinLogDropped;
+  uint32_t length;
+  uint32_t i;
+
+  if ((dropped != BinLogReported) && (MaxWords >= 3U))
+  {
+    pRecord[0] = BIN_LOG_HEADER(BIN_LOG_LEVEL_ERR, 1U, BIN_LOG_ID_DROPPED);
+    pRecord[1] = BIN_LOG_TIMESTAMP();
+    pRecord[2] = dropped - BinLogReported;
+    BinLogReported = dropped;
+    return 3U;
+  }
+
+  /* Record reserved by a producer that has not written it yet */
+  if ((BinLogTail == BinLogHead) || (LOG_WORD(BinLogTail) == 0U))
+  {
+    return 0U;
+  }
+  __DMB();
+
+  length = BIN_LOG_HEADER_NARGS(LOG_WORD(BinLogTail)) + LOG_RECORD_WORDS;
+  if (length > MaxWords)
+  {
+    return 0U;
+  }
+  for (i = 0U; i < length; i++)
+  {
+    pRecord[i] = LOG_WORD(BinLogTail + i);
+    LOG_WORD(BinLogTail + i) = 0U;
+  }
+  __DMB();
+  BinLogTail += length;
+
+  return length;
+}
+
+/**
+  * @brief  Copy the oldest records and release their words.
+  * @note   Only one context may read the ring. Records are copied whole,
+  *         little endian, as long as they fit.
+  * @param  pData destination of the records, 4-byte aligned
+  * @param  Size size of pData in bytes
+  * @retval Number of bytes copied
+  */
+uint32_t BIN_Log_Read(uint8_t *pData, uint32_t Size)
+{
+  uint32_t *pOut = (uint32_t *)pData;
+  uint32_t count = 0U;
+  uint32_t length;
+
+  while ((length = Log_Next(&pOut[count], (Size / 4U) - count)) != 0U)
+  {
+    count += length;
+  }
+
+  return count * 4U;
+}
+
+/**
+  * @brief  Return the number of records dropped on a full ring.
+  * @retval Number of dropped records
+  */
+uint32_t BIN_Log_GetDropped(void)
+{
+  return BinLogDropped;
+}
+
+#if defined(HAL_UART_MODULE_ENABLED)
+/**
+  * @brief  Send the next records over a UART once its previous transmission
+  *         is complete.
+  * @note   Call it from the main loop. The records are sent by DMA when the
+  *         UART has a transmit DMA channel, by interrupt otherwise.
+  * @param  huart UART handle, initialized
+  * @retval None
+  */
+void BIN_Log_UART_Process(UART_HandleTypeDef *huart)
+{
+  uint32_t size;
+
+  /* The L1 UART has a single state for both directions */
+  if ((huart->State != HAL_UART_STATE_READY) && (huart->State != HAL_UART_STATE_BUSY_RX))
+  {
+    return;
+  }
+
+  size = BIN_Log_Read(BinLogTx, sizeof(BinLogTx));
+  if (size == 0U)
+  {
+    return;
+  }
+
+  if (huart->hdmatx != NULL)
+  {
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    SCB_CleanDCache_by_Addr((uint32_t *)BinLogTx, sizeof(BinLogTx));
+#endif
+    HAL_UART_Transmit_DMA(huart, BinLogTx, (uint16_t)size);
+  }
+  else
+  {
+    HAL_UART_Transmit_IT(huart, BinLogTx, (uint16_t)size);
+  }
+}
+#endif /* HAL_UART_MODULE_ENABLED */
+
+#if (__CORTEX_M >= 3U)
+/**
+  * @brief  Send the records to an ITM stimulus port, one word at a time.
+  * @note   The ITM and the port must have been enabled by the debugger.
+  * @param  Port ITM stimulus port, 0 to 31
+  * @retval Number of records sent
+  */
+uint32_t BIN_Log_FlushITM(uint32_t Port)
+{
+  uint32_t record[BIN_LOG_MAX_ARGS + LOG_RECORD_WORDS];
+  uint32_t count = 0U;
+  uint32_t length;
+  uint32_t i;
+
+  if ((Port > 31U) || ((ITM->TCR & ITM_TCR_ITMENA_Msk) == 0U) || ((ITM->TER & (1UL << Port)) == 0U))
+  {
+    return 0U;
+  }
+
+  while ((length = Log_Next(record, BIN_LOG_MAX_ARGS + LOG_RECORD_WORDS)) != 0U)
+  {
+    for (i = 0U; i < length; i++)
+    {
+      while (ITM->PORT[Port].u32 == 0U) {}
+      ITM->PORT[Port].u32 = record[i];
+    }
+    count++;
+  }
+
+  return count;
+}
+#endif /* __CORTEX_M >= 3U */
+
+#if (BIN_LOG_FORMAT == 1)
+/* Conversion flags */
+#define LOG_FLAG_LEFT   1U
+#define LOG_FLAG_ZERO   2U
+#define LOG_FLAG_UPPER  4U
+
+/**
+  * @brief  Write a number of a conversion.
+  * @retval Next character of pOut
+  */
+static char *Log_Number(char *pOut, char *pEnd, uint32_t Value, uint32_t Base, uint32_t Negative,
+                        uint32_t Flags, uint32_t Width, int32_t Precision)
+{
+  const char *digits = ((Flags & LOG_FLAG_UPPER) != 0U) ? "0123456789ABCDEF" : "0123456789abcdef";
+  char     text[12];
+  uint32_t length = 0U;
+  uint32_t size;
+  char     pad = (((Flags & (LOG_FLAG_ZERO | LOG_FLAG_LEFT)) == LOG_FLAG_ZERO) && (Precision < 0)) ? '0' : ' ';
+
+  do
+  {
+    text[length++] = digits[Value % Base];
+    Value /= Base;
+  } while (Value != 0U);
+  while ((int32_t)length < Precision)
+  {
+    text[length++] = '0';
+  }
+
+  size = length + Negative;
+  if ((pad == '0') && (Negative != 0U) && (pOut < pEnd))
+  {
+    *pOut++ = '-';
+    Negative = 0U;
+  }
+  while (((Flags & LOG_FLAG_LEFT) == 0U) && (size < Width) && (pOut < pEnd))
+  {
+    *pOut++ = pad;
+    Width--;
+  }
+  if ((Negative != 0U) && (pOut < pEnd))
+  {
+    *pOut++ = '-';
+  }
+  while ((length != 0U) && (pOut < pEnd))
+  {
+    *pOut++ = text[--length];
+  }
+  while ((size < Width) && (pOut < pEnd))
+  {
+    *pOut++ = ' ';
+    Width--;
+  }
+
+  return pOut;
+}
+
+/**
+  * @brief  Write a float of a conversion, at most 9 decimals.
+  * @retval Next character of pOut
+  */
+static char *Log_Float(char *pOut, char *pEnd, float Value, uint32_t Flags, uint32_t Width, int32_t Precision)
+{
+  const char *pText;
+  char    *pStart = pOut;
+  uint32_t negative = (Value < 0.0f) ? 1U : 0U;
+  uint32_t digits = (Precision < 0) ? 6U : (((uint32_t)Precision > 9U) ? 9U : (uint32_t)Precision);
+  uint32_t scale = 1U;
+  uint32_t integer;
+  uint32_t fraction;
+  uint32_t i;
+
+  if (negative != 0U)
+  {
+    Value = -Value;
+  }
+
+  /* Not a number, or out of the 32-bit range of the integer part */
+  if ((Value != Value) || (Value >= 4294967296.0f))
+  {
+    for (pText = (Value != Value) ? "nan" : ((negative != 0U) ? "-inf" : "inf"); (*pText != '\0') && (pOut < pEnd); )
+    {
+      *pOut++ = *pText++;
+    }
+    return pOut;
+  }
+
+  for (i = 0U; i < digits; i++)
+  {
+    scale *= 10U;
+  }
+  integer = (uint32_t)Value;
+  fraction = (uint32_t)(((Value - (float)integer) * (float)scale) + 0.5f);
+  if (fraction >= scale)
+  {
+    integer++;
+    fraction -= scale;
+  }
+
+  /* Width of the integer part, the padding of a left justified float
+     being added after its decimals */
+  i = digits + ((digits != 0U) ? 1U : 0U);
+  pOut = Log_Number(pOut, pEnd, integer, 10U, negative, Flags & ~LOG_FLAG_LEFT,
+                    (((Flags & LOG_FLAG_LEFT) == 0U) && (Width > i)) ? (Width - i) : 0U, -1);
+  if ((digits != 0U) && (pOut < pEnd))
+  {
+    *pOut++ = '.';
+    pOut = Log_Number(pOut, pEnd, fraction, 10U, 0U, 0U, 0U, (int32_t)digits);
+  }
+  while (((uint32_t)(pOut - pStart) < Width) && (pOut < pEnd))
+  {
+    *pOut++ = ' ';
+  }
+
+  return pOut;
+}
+
+/**
+  * @brief  Take the oldest record out of the ring and format it.
+  * @note   Only one context may read the ring. Supports the d, i, u, x, X,
+  *         c, s, p, f and % conversions with the -, 0, width and precision
+  *         options; length modifiers are ignored, arguments are 32-bit.
+  * @param  pBuffer destination of the text, NUL terminated
+  * @param  Size size of pBuffer in bytes
+  * @param  pLevel level of the record, may be NULL
+  * @retval Number of characters written, 0 when no record is complete
+  */
+uint32_t BIN_Log_Format(char *pBuffer, uint32_t Size, uint32_t *pLevel)
+{
+  uint32_t record[BIN_LOG_MAX_ARGS + LOG_RECORD_WORDS];
+  const char *pFormat;
+  const char *pString;
+  char    *pOut = pBuffer;
+  char    *pEnd = pBuffer + Size - 1U;
+  uint32_t arg = LOG_RECORD_WORDS;
+  uint32_t length;
+  uint32_t value;
+  uint32_t flags;
+  uint32_t width;
+  int32_t  precision;
+  union
+  {
+    float    f;
+    uint32_t w;
+  } bits;
+
+  if ((Size == 0U) || ((length = Log_Next(record, BIN_LOG_MAX_ARGS + LOG_RECORD_WORDS)) == 0U))
+  {
+    return 0U;
+  }
+  if (pLevel != NULL)
+  {
+    *pLevel = BIN_LOG_HEADER_LEVEL(record[0]);
+  }
+
+  if (BIN_LOG_HEADER_ID(record[0]) == BIN_LOG_ID_DROPPED)
+  {
+    pFormat = "%u records dropped\n";
+  }
+  else
+  {
+    pFormat = &__binlog_fmt_start[BIN_LOG_HEADER_ID(record[0]) * 4U];
+  }
+
+  while ((*pFormat != '\0') && (pOut < pEnd))
+  {
+    if (*pFormat != '%')
+    {
+      *pOut++ = *pFormat++;
+      continue;
+    }
+    pFormat++;
+
+    /* Flags, width and precision */
+    flags = 0U;
+    width = 0U;
+    precision = -1;
+    for (; (*pFormat == '-') || (*pFormat == '0'); pFormat++)
+    {
+      flags |= (*pFormat == '-') ? LOG_FLAG_LEFT : LOG_FLAG_ZERO;
+    }
+    for (; (*pFormat >= '0') && (*pFormat <= '9'); pFormat++)
+    {
+      width = (width * 10U) + (uint32_t)(*pFormat - '0');
+    }
+    if (*pFormat == '.')
+    {
+      for (precision = 0, pFormat++; (*pFormat >= '0') && (*pFormat <= '9'); pFormat++)
+      {
+        precision = (precision * 10) + (*pFormat - '0');
+      }
+    }
+    while ((*pFormat == 'l') || (*pFormat == 'h') || (*pFormat == 'z'))
+    {
+      pFormat++;
+    }
+
+    if (*pFormat == '%')
+    {
+      *pOut++ = *pFormat++;
+      continue;
+    }
+    if (*pFormat == '\0')
+    {
+      break;
+    }
+    value = (arg < length) ? record[arg] : 0U;
+    arg++;
+
+    switch (*pFormat++)
+    {
+      case 'd':
+      case 'i':
+        pOut = Log_Number(pOut, pEnd, ((int32_t)value < 0) ? (0U - value) : value, 10U,
+                          ((int32_t)value < 0) ? 1U : 0U, flags, width, precision);
+        break;
+
+      case 'u':
+        pOut = Log_Number(pOut, pEnd, value, 10U, 0U, flags, width, precision);
+        break;
+
+      case 'X':
+        flags |= LOG_FLAG_UPPER;
+        pOut = Log_Number(pOut, pEnd, value, 16U, 0U, flags, width, precision);
+        break;
+
+      case 'x':
+        pOut = Log_Number(pOut, pEnd, value, 16U, 0U, flags, width, precision);
+        break;
+
+      case 'p':
+        pOut = Log_Number(pOut, pEnd, value, 16U, 0U, LOG_FLAG_ZERO | LOG_FLAG_UPPER, 8U, -1);
+        break;
+
+      case 'c':
+        *pOut++ = (char)value;
+        break;
+
+      case 's':
+        pString = (const char *)value;
+        if (pString == NULL)
+        {
+          pString = "(null)";
+        }
+        for (; (*pString != '\0') && (precision != 0) && (pOut < pEnd); precision--)
+        {
+          *pOut++ = *pString++;
+        }
+        break;
+
+      case 'f':
+        bits.w = value;
+        pOut = Log_Float(pOut, pEnd, bits.f, flags, width, precision);
+        break;
+
+      default:
+        break;
+    }
+  }
+
+  *pOut = '\0';
+  return (uint32_t)(pOut - pBuffer);
+}
+#endif /* BIN_LOG_FORMAT == 1 */
+
+#if (BIN_LOG_LCD == 1)
+/**
+  * @brief  Print the records with lcd_log, the line color set by their level.
+  * @note   Call it from the main loop, the only reader of the ring.
+  * @retval None
+  */
+void BIN_Log_LCD_Process(void)
+{
+  char     line[128];
+  uint32_t level;
+
+  while (BIN_Log_Format(line, sizeof(line), &level) != 0U)
+  {
+    if (level == BIN_LOG_LEVEL_ERR)
+    {
+      LCD_ErrLog("%s", line);
+    }
+    else if (level == BIN_LOG_LEVEL_DBG)
+    {
+      LCD_DbgLog("%s", line);
+    }
+    else
+    {
+      LCD_UsrLog("%s", line);
+    }
+  }
+}
+#endif /* BIN_LOG_LCD == 1 */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,143 @@
+/**
+  ******************************************************************************
+  * @file    power_prof.h
+  * @author  MCD Application Team
+  * @brief   Header for power_prof module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _POWER_PROF_H__
+#define _POWER_PROF_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported constants --------------------------------------------------------*/
+/* Entries of the subsystem table, 32 at most. Override in main.h. */
+#if !defined(PWR_PROF_MAX_SUBSYSTEMS)
+#define PWR_PROF_MAX_SUBSYSTEMS   16U
+#endif
+
+/* Blockers of PWR_Prof_EnterMode(), one bit each */
+#define PWR_PROF_MAX_BLOCKERS     32U
+
+/* Supply voltage in mV, for the energy. Override in main.h. */
+#if !defined(PWR_PROF_VDD_MV)
+#define PWR_PROF_VDD_MV           3000U
+#endif
+
+/* Core consumption, typical values of the datasheet to replace with the
+   board measurements: Run and Sleep in nA per MHz of HCLK, Stop in nA.
+   Override in main.h. */
+#if !defined(PWR_PROF_RUN_NA_PER_MHZ)
+#define PWR_PROF_RUN_NA_PER_MHZ   230000U
+#endif
+#if !defined(PWR_PROF_SLEEP_NA_PER_MHZ)
+#define PWR_PROF_SLEEP_NA_PER_MHZ 50000U
+#endif
+#if !defined(PWR_PROF_STOP_NA)
+#define PWR_PROF_STOP_NA          500U
+#endif
+
+/* Time stamp in microseconds, counting through the Stop modes. Override in
+   main.h. */
+#if !defined(PWR_PROF_TIMESTAMP_US)
+#define PWR_PROF_TIMESTAMP_US()   ((uint64_t)HAL_GetTick() * 1000U)
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+/* From the lightest to the deepest mode */
+typedef enum
+{
+  PWR_PROF_MODE_RUN   = 0U,  /* No low power mode */
+  PWR_PROF_MODE_SLEEP = 1U,  /* CPU clock stopped */
+  PWR_PROF_MODE_STOP  = 2U   /* Stop, low power regulator */
+} PWR_Prof_ModeTypeDef;
+
+#define PWR_PROF_MODES            3U
+#define PWR_PROF_DEEPEST          PWR_PROF_MODE_STOP
+
+typedef struct
+{
+  const char     *Name;
+  __IO uint32_t  *pEnable;       /* RCC clock enable register, NULL for an activity only    */
+  uint32_t        Mask;          /* Clock enable bits, clocked when all of them are set     */
+  __IO uint32_t  *pSleepEnable;  /* RCC Sleep mode enable register, same bits as pEnable,
+                                    NULL when clocked in Sleep as in Run                    */
+  uint32_t        NaPerMhz;      /* Clocked, in nA per MHz of HCLK                          */
+  uint32_t        ActiveNa;      /* Between PWR_Prof_Begin() and PWR_Prof_End() in Run and
+                                    Sleep, in nA: analog part, external device              */
+  uint32_t        StopNa;        /* Same, through the Stop modes, in nA                     */
+} PWR_Prof_SubsystemTypeDef;
+
+typedef struct
+{
+  uint64_t  ClockedUs;           /* Time clocked                                            */
+  uint64_t  ActiveUs;            /* Time between PWR_Prof_Begin() and PWR_Prof_End()        */
+  uint64_t  Charge;              /* In pC (uA.us)                                           */
+} PWR_Prof_SubsystemStatsTypeDef;
+
+typedef struct
+{
+  uint64_t  TotalUs;                            /* Since PWR_Prof_Init()                      */
+  uint64_t  ModeUs[PWR_PROF_MODES];             /* Residency per mode                         */
+  uint32_t  Entries[PWR_PROF_MODES];            /* PWR_Prof_EnterMode() calls per mode        */
+  uint64_t  ModeCharge[PWR_PROF_MODES];         /* Core consumption per mode, in pC           */
+  uint64_t  BlockedUs[PWR_PROF_MAX_BLOCKERS];   /* Time in a mode lighter than the deepest one,
+                                                   per blocker of PWR_Prof_EnterMode()        */
+  uint64_t  ShortUs;                            /* Same without blocker: idle time too short  */
+} PWR_Prof_StatsTypeDef;
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef PWR_Prof_Init(const PWR_Prof_SubsystemTypeDef *pTable, uint32_t Count);
+void              PWR_Prof_Update(void);
+void              PWR_Prof_Begin(uint32_t Id);
+void              PWR_Prof_End(uint32_t Id);
+void              PWR_Prof_EnterMode(PWR_Prof_ModeTypeDef Mode, uint32_t Blockers);
+void              PWR_Prof_ExitMode(void);
+void              PWR_Prof_GetStats(PWR_Prof_StatsTypeDef *pStats);
+HAL_StatusTypeDef PWR_Prof_GetSubsystem(uint32_t Id, PWR_Prof_SubsystemStatsTypeDef *pStats);
+uint32_t          PWR_Prof_Report(uint32_t Line, char *pBuffer, uint32_t Size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _POWER_PROF_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,272 @@
+/**
+  ******************************************************************************
+  * @file    ram_idle.c
+  * @author  MCD Application Team
+  * @brief   Idle wait run from RAM with the flash powered down.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- link with linker.tpl, or add the RAM_IDLE_SECTION input section to the
+   .data output section of the linker script: the startup copies it to RAM
+   with the initialized data. Call RAM_Idle_Init() once: the vector table
+   is copied to RAM and SCB->VTOR points to the copy.
+
+2- write the short interrupt handlers that must run during the wait with
+   RAM_IDLE_CODE, ex. a DMA half/complete transfer handler setting a flag,
+   and install them with RAM_Idle_SetHandler(IRQn, Handler). They, and the
+   functions they call, must not touch the flash: no HAL function, no
+   constant tables, no PendSV request of an RTOS. The handler of an
+   exception (SysTick_IRQn) can be installed the same way.
+
+3- RAM_Idle_Wait(Mode, pFlags, Mask), called from the flash, runs its loop
+   from RAM with the flash powered down, in Sleep between the interrupts,
+   until a RAM handler sets one of the Mask bits of *pFlags :
+      - RAM_IDLE_SLEEP_PD: the flash is powered down in Sleep only, and
+        powered up by the hardware at each wake up. Every interrupt is
+        served, the handlers in flash after the flash wake up.
+      - RAM_IDLE_RUN_PD: the flash stays powered down for the whole wait.
+        The interrupts with a handler in flash are disabled, stay pending,
+        wake the CPU through SEVONPEND and end the wait: they are served
+        once the flash is back, and RAM_Idle_Wait() then returns 0. The
+        SysTick interrupt is suspended unless its handler is in RAM, one
+        tick being delivered at the end of the wait when it elapsed.
+   Both modes also apply in Low-power run and Low-power sleep, entered with
+   HAL_PWREx_EnableLowPowerRunMode() once the system clock is the MSI at
+   131 kHz at most.
+   The flash wake up, RAM_IDLE_FLASH_WAKEUP_US, is waited for in RAM at
+   the end of the wait: it adds to the latency of the first interrupt
+   handler in flash.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "ram_idle.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define RAM_IDLE_IRQ_WORDS        (((RAM_IDLE_VECTORS - 16U) + 31U) / 32U)
+
+/* SCB->VTOR needs the table aligned on its size rounded up to a power of 2 */
+#if (RAM_IDLE_VECTORS > 128U)
+#error "RAM_IDLE_VECTORS above 128 requires a larger alignment of RamIdleVectors"
+#endif
+
+/* Private macro -------------------------------------------------------------*/
+/* Handler address in the flash, 0x08000000 to 0x0FFFFFFF */
+#define RAM_IDLE_IN_FLASH(__ADDR__)  (((uint32_t)(__ADDR__) & 0xF8000000U) == FLASH_BASE)
+
+/* Private variables ---------------------------------------------------------*/
+static uint32_t RamIdleVectors[RAM_IDLE_VECTORS] __attribute__((aligned(512)));
+static uint32_t RamIdleMask[RAM_IDLE_IRQ_WORDS];     /* Interrupts with a handler in RAM */
+static uint32_t RamIdleEnabled[RAM_IDLE_IRQ_WORDS];  /* NVIC enables saved by the wait   */
+static uint32_t RamIdleSysTick;                      /* SysTick handler in RAM           */
+
+/* Private function prototypes -----------------------------------------------*/
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Move the vector table to RAM
+  * @note   The handlers stay the same until RAM_Idle_SetHandler() is called.
+  * @retval None
+  */
+void RAM_Idle_Init(void)
+{
+  const uint32_t *pTable = (const uint32_t *)SCB->VTOR;
+  uint32_t        primask;
+  uint32_t        i;
+
+  if (pTable == RamIdleVectors)
+  {
+    return;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  for (i = 0U; i < RAM_IDLE_VECTORS; i++)
+  {
+    RamIdleVectors[i] = pTable[i];
+  }
+  for (i = 0U; i < RAM_IDLE_IRQ_WORDS; i++)
+  {
+    RamIdleMask[i] = 0U;
+  }
+  RamIdleSysTick = 0U;
+  __DMB();
+  SCB->VTOR = (uint32_t)RamIdleVectors;
+  __DSB();
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Install an interrupt or exception handler in the RAM vector table
+  * @param  IRQn: interrupt number, SysTick_IRQn and the other exceptions
+  *         being negative
+  * @param  pHandler: handler, RAM_IDLE_CODE to run during a RAM_IDLE_RUN_PD
+  *         wait, or the original handler in flash
+  * @retval HAL status
+  */
+HAL_StatusTypeDef RAM_Idle_SetHandler(IRQn_Type IRQn, void (*pHandler)(void))
+{
+  int32_t  vector = (int32_t)IRQn + 16;
+  uint32_t primask;
+
+  if ((SCB->VTOR != (uint32_t)RamIdleVectors) || (pHandler == NULL) ||
+      (vector < 2) || (vector >= (int32_t)RAM_IDLE_VECTORS))
+  {
+    return HAL_ERROR;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  RamIdleVectors[vector] = (uint32_t)pHandler;
+  if ((int32_t)IRQn >= 0)
+  {
+    if (RAM_IDLE_IN_FLASH(pHandler))
+    {
+      RamIdleMask[(uint32_t)IRQn >> 5] &= ~(1UL << ((uint32_t)IRQn & 0x1FU));
+    }
+    else
+    {
+      RamIdleMask[(uint32_t)IRQn >> 5] |= (1UL << ((uint32_t)IRQn & 0x1FU));
+    }
+  }
+  else if (IRQn == SysTick_IRQn)
+  {
+    RamIdleSysTick = RAM_IDLE_IN_FLASH(pHandler) ? 0U : 1U;
+  }
+  __DSB();
+  __set_PRIMASK(primask);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Wait from RAM, the flash powered down, for flags set by the RAM
+  *         interrupt handlers
+  * @param  Mode: RAM_IDLE_SLEEP_PD or RAM_IDLE_RUN_PD
+  * @param  pFlags: flags set by the interrupt handlers
+  * @param  Mask: flags ending the wait
+  * @retval Flags of Mask found set, 0 when an interrupt handler in flash
+  *         ended a RAM_IDLE_RUN_PD wait
+  */
+RAM_IDLE_CODE uint32_t RAM_Idle_Wait(RAM_Idle_ModeTypeDef Mode, volatile uint32_t *pFlags, uint32_t Mask)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint32_t scr     = SCB->SCR;
+  uint32_t tick    = 0U;
+  uint32_t flags;
+  uint32_t pending;
+  uint32_t cycles;
+  uint32_t i;
+
+  __disable_irq();
+  CLEAR_BIT(SCB->SCR, SCB_SCR_SLEEPDEEP_Msk);
+
+  if (Mode == RAM_IDLE_SLEEP_PD)
+  {
+    __HAL_FLASH_SLEEP_POWERDOWN_ENABLE();
+    while ((flags = (*pFlags & Mask)) == 0U)
+    {
+      /* Woken up by a pending interrupt, served once unmasked */
+      __DSB();
+      __WFI();
+      __enable_irq();
+      __ISB();
+      __disable_irq();
+    }
+    __HAL_FLASH_SLEEP_POWERDOWN_DISABLE();
+    SCB->SCR = scr;
+    __set_PRIMASK(primask);
+    return flags;
+  }
+
+  /* Handlers in flash kept pending, each pending transition waking the WFE */
+  for (i = 0U; i < RAM_IDLE_IRQ_WORDS; i++)
+  {
+    RamIdleEnabled[i] = NVIC->ISER[i];
+    NVIC->ICER[i]     = RamIdleEnabled[i] & ~RamIdleMask[i];
+  }
+  if (RamIdleSysTick == 0U)
+  {
+    tick = SysTick->CTRL & SysTick_CTRL_TICKINT_Msk;
+    CLEAR_BIT(SysTick->CTRL, SysTick_CTRL_TICKINT_Msk);
+  }
+  SET_BIT(SCB->SCR, SCB_SCR_SEVONPEND_Msk);
+  __DSB();
+  __ISB();
+
+  __HAL_FLASH_POWER_DOWN_ENABLE();
+  __enable_irq();
+  do
+  {
+    flags   = *pFlags & Mask;
+    pending = 0U;
+    for (i = 0U; i < RAM_IDLE_IRQ_WORDS; i++)
+    {
+      pending |= NVIC->ISPR[i] & RamIdleEnabled[i] & ~RamIdleMask[i];
+    }
+    if ((flags == 0U) && (pending == 0U))
+    {
+      __WFE();
+    }
+  } while ((flags == 0U) && (pending == 0U));
+  __disable_irq();
+  __HAL_FLASH_POWER_DOWN_DISABLE();
+
+  /* Flash wake up, about 4 cycles per iteration */
+  cycles = (((SystemCoreClock / 1000000U) * RAM_IDLE_FLASH_WAKEUP_US) / 4U) + 1U;
+  while (cycles > 0U)
+  {
+    __NOP();
+    cycles--;
+  }
+
+  SCB->SCR = scr;
+  if (tick != 0U)
+  {
+    if ((SysTick->CTRL & SysTick_CTRL_COUNTFLAG_Msk) != 0U)
+    {
+      SCB->ICSR = SCB_ICSR_PENDSTSET_Msk;
+    }
+    SET_BIT(SysTick->CTRL, SysTick_CTRL_TICKINT_Msk);
+  }
+  for (i = 0U; i < RAM_IDLE_IRQ_WORDS; i++)
+  {
+    NVIC->ISER[i] = RamIdleEnabled[i];
+  }
+  __set_PRIMASK(primask);
+
+  return flags;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,94 @@
+/**
+  ******************************************************************************
+  * @file    ram_idle.h
+  * @author  MCD Application Team
+  * @brief   Header for ram_idle module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _RAM_IDLE_H__
+#define _RAM_IDLE_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported constants --------------------------------------------------------*/
+/* Section of the code run with the flash powered down, copied to RAM with
+   .data by the startup: linker.tpl places it. Override in main.h. */
+#if !defined(RAM_IDLE_SECTION)
+#define RAM_IDLE_SECTION          ".ram_text"
+#endif
+
+/* Entries of the RAM vector table: the 16 exceptions and the interrupts of
+   the device. Override in main.h. */
+#if !defined(RAM_IDLE_VECTORS)
+#define RAM_IDLE_VECTORS          (16U + 57U)
+#endif
+
+/* Flash wake up time from power down, in microseconds: waited for in RAM
+   before the code returns to the flash. Override in main.h. */
+#if !defined(RAM_IDLE_FLASH_WAKEUP_US)
+#define RAM_IDLE_FLASH_WAKEUP_US  10U
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+  RAM_IDLE_SLEEP_PD = 0U,      /* Flash powered down in Sleep only, powered up at each wake up: every
+                                  interrupt is served, the ones in flash after the flash wake up */
+  RAM_IDLE_RUN_PD   = 1U       /* Flash powered down for the whole wait, in Run or Low-power run and in
+                                  Sleep: only the RAM interrupt handlers are served, another interrupt
+                                  ends the wait */
+} RAM_Idle_ModeTypeDef;
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Code run from RAM: the interrupt handlers given to RAM_Idle_SetHandler()
+   and the functions they call */
+#define RAM_IDLE_CODE             __attribute__((section(RAM_IDLE_SECTION), noinline))
+
+/* Exported functions ------------------------------------------------------- */
+void              RAM_Idle_Init(void);
+HAL_StatusTypeDef RAM_Idle_SetHandler(IRQn_Type IRQn, void (*pHandler)(void));
+uint32_t          RAM_Idle_Wait(RAM_Idle_ModeTypeDef Mode, volatile uint32_t *pFlags, uint32_t Mask);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RAM_IDLE_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
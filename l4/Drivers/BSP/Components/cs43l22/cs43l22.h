@@ -203,6 +203,11 @@ void      AUDIO_IO_Init(void);
 void      AUDIO_IO_DeInit(void);
 void      AUDIO_IO_Write(uint8_t Addr, uint8_t Reg, uint8_t Value);
 uint8_t   AUDIO_IO_Read(uint8_t Addr, uint8_t Reg);
+#if defined(AUDIO_IO_BATCH)
+/* Starts sending Count register writes and returns, the next AUDIO_IO_xxx() call
+   waits for them to be sent. pRegs is not modified until then. */
+void      AUDIO_IO_WriteBatch(uint8_t Addr, AUDIO_IO_RegTypeDef *pRegs, uint16_t Count);
+#endif /* AUDIO_IO_BATCH */
 
 /* Audio driver structure */
 extern AUDIO_DrvTypeDef   cs43l22_drv;
@@ -519,6 +519,35 @@ void ST7789H2_SetDisplayWindow(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uin
   }
 }
 
+/**
+  * @brief  Opens a window for a stream of pixels
+  * @param  Xpos:   specifies the X left position.
+  * @param  Ypos:   specifies the Y top position.
+  * @param  Width:  window width.
+  * @param  Height: window height.
+  * @note   The Width x Height RGB565 pixels that follow, row by row, are
+  *         written in the window (used by the DMA frame push).
+  * @retval None
+  */
+void ST7789H2_SetWriteWindow(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+  uint8_t   parameter[4];
+  /* CASET: Column Address Set */
+  parameter[0] = (uint8_t)(Xpos >> 8);
+  parameter[1] = (uint8_t)(Xpos);
+  parameter[2] = (uint8_t)((Xpos + Width - 1) >> 8);
+  parameter[3] = (uint8_t)(Xpos + Width - 1);
+  ST7789H2_WriteReg(ST7789H2_CASET, parameter, 4);
+  /* RASET: Row Address Set */
+  parameter[0] = (uint8_t)(Ypos >> 8);
+  parameter[1] = (uint8_t)(Ypos);
+  parameter[2] = (uint8_t)((Ypos + Height - 1) >> 8);
+  parameter[3] = (uint8_t)(Ypos + Height - 1);
+  ST7789H2_WriteReg(ST7789H2_RASET, parameter, 4);
+  /* Prepare to write to LCD RAM */
+  ST7789H2_WriteReg(ST7789H2_WRITE_RAM, (uint8_t*)NULL, 0);   /* RAM write data command */
+}
+
 /**
   * @brief  Draw vertical line.
   * @param  RGBCode: Specifies the RGB color in RGB565 format
@@ -79,6 +79,13 @@
 
      o Call BSP_LCD_Refresh() to refresh LCD display.
 
+  + Partial refresh
+     o Call BSP_LCD_RefreshRect() to send only an area of the frame buffer to the
+       display: the panel memory window, the LTDC active area and the layer are
+       narrowed to the area and the transfer starts on the next tearing effect.
+     o Or report the areas modified with BSP_LCD_InvalidateRect() and call
+       BSP_LCD_RefreshDirty() to refresh their bounding box.
+
 ------------------------------------------------------------------------------*/
 
 /* Includes ------------------------------------------------------------------*/
@@ -152,6 +159,10 @@ __align(16) uint32_t  PhysFrameBuffer[121680];
 
 /* Global variable used to know if frame buffer is available (1) or not because refresh is on going (0) */
 __IO uint32_t FrameBufferAvailable = 1;
+/* Panel memory window of the last refresh : X, Y, width and height */
+static uint16_t RefreshArea[4] = {0, 0, 390, 390};
+/* Bounding box of the invalidated areas : X0, Y0, X1, Y1 (excluded), empty if X1 = 0 */
+static uint16_t DirtyArea[4] = {0, 0, 0, 0};
 /* LCD size */
 uint32_t lcd_x_size = 390;
 uint32_t lcd_y_size = 390;
@@ -168,6 +179,7 @@ DSI_HandleTypeDef    hdsi_discovery;
   */
 static void LCD_PowerOn(void);
 static void LCD_PowerOff(void);
+static void LCD_SetRefreshArea(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
 static void DrawChar(uint16_t Xpos, uint16_t Ypos, const uint8_t *c);
 static void FillTriangle(uint16_t x1, uint16_t x2, uint16_t x3, uint16_t y1, uint16_t y2, uint16_t y3);
 static void LL_FillBuffer(uint32_t LayerIndex, void *pDst, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint32_t ColorIndex);
@@ -545,6 +557,10 @@ uint8_t BSP_LCD_Init(void)
     HAL_DSI_LongWrite(&hdsi_discovery, 0, DSI_DCS_LONG_PKT_WRITE, 4, DSI_SET_COLUMN_ADDRESS, InitParam1);
     uint8_t InitParam2[4]= {0x00, 0x00, 0x01, 0x85};
     HAL_DSI_LongWrite(&hdsi_discovery, 0, DSI_DCS_LONG_PKT_WRITE, 4, DSI_SET_PAGE_ADDRESS, InitParam2);
+    RefreshArea[0] = 0;
+    RefreshArea[1] = 0;
+    RefreshArea[2] = 390;
+    RefreshArea[3] = 390;
 
     /* Sleep out */
     HAL_DSI_ShortWrite(&hdsi_discovery, 0, DSI_DCS_SHORT_PKT_WRITE_P0, DSI_EXIT_SLEEP_MODE, 0x0);
@@ -1470,6 +1486,9 @@ void BSP_LCD_DisplayOff(void)
   */
 void BSP_LCD_Refresh(void)
 {
+  /* Restore the full display area */
+  LCD_SetRefreshArea(0, 0, 390, 390);
+
   /* Set frame buffer busy */
   FrameBufferAvailable = 0;
 
@@ -1477,6 +1496,97 @@ void BSP_LCD_Refresh(void)
   HAL_DSI_ShortWrite(&hdsi_discovery, 0, DSI_DCS_SHORT_PKT_WRITE_P1, DSI_SET_TEAR_ON, 0x0);
 }
 
+/**
+  * @brief  Refresh an area of the display.
+  * @param  Xpos: X position
+  * @param  Ypos: Y position
+  * @param  Width: Area width
+  * @param  Height: Area height
+  * @retval LCD_OK if the refresh is started else LCD_ERROR (refresh on going or wrong area)
+  */
+uint8_t BSP_LCD_RefreshRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+  if((Width == 0) || (Height == 0) || ((Xpos + Width) > 390) || ((Ypos + Height) > 390))
+  {
+    return(LCD_ERROR);
+  }
+
+  /* Area registers can't be changed during a refresh */
+  if(FrameBufferAvailable != 1)
+  {
+    return(LCD_ERROR);
+  }
+
+  LCD_SetRefreshArea(Xpos, Ypos, Width, Height);
+
+  /* Set frame buffer busy */
+  FrameBufferAvailable = 0;
+
+  /* Set tear on, the area is sent on the next tearing effect */
+  HAL_DSI_ShortWrite(&hdsi_discovery, 0, DSI_DCS_SHORT_PKT_WRITE_P1, DSI_SET_TEAR_ON, 0x0);
+
+  return(LCD_OK);
+}
+
+/**
+  * @brief  Add an area modified in the frame buffer to the area refreshed by
+  *         the next BSP_LCD_RefreshDirty() call.
+  * @param  Xpos: X position
+  * @param  Ypos: Y position
+  * @param  Width: Area width
+  * @param  Height: Area height
+  */
+void BSP_LCD_InvalidateRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+  uint32_t x1, y1;
+
+  if((Width == 0) || (Height == 0) || (Xpos >= 390) || (Ypos >= 390))
+  {
+    return;
+  }
+
+  /* Clip the area to the display */
+  x1 = ((Xpos + Width) > 390) ? 390 : (Xpos + Width);
+  y1 = ((Ypos + Height) > 390) ? 390 : (Ypos + Height);
+
+  if(DirtyArea[2] == 0)
+  {
+    DirtyArea[0] = Xpos;
+    DirtyArea[1] = Ypos;
+    DirtyArea[2] = x1;
+    DirtyArea[3] = y1;
+  }
+  else
+  {
+    DirtyArea[0] = (Xpos < DirtyArea[0]) ? Xpos : DirtyArea[0];
+    DirtyArea[1] = (Ypos < DirtyArea[1]) ? Ypos : DirtyArea[1];
+    DirtyArea[2] = (x1 > DirtyArea[2]) ? x1 : DirtyArea[2];
+    DirtyArea[3] = (y1 > DirtyArea[3]) ? y1 : DirtyArea[3];
+  }
+}
+
+/**
+  * @brief  Refresh the bounding box of the areas given to BSP_LCD_InvalidateRect().
+  * @retval LCD_OK if the refresh is started or nothing has to be refreshed,
+  *         else LCD_ERROR (refresh on going, the areas are kept)
+  */
+uint8_t BSP_LCD_RefreshDirty(void)
+{
+  uint8_t status = LCD_OK;
+
+  if(DirtyArea[2] != 0)
+  {
+    status = BSP_LCD_RefreshRect(DirtyArea[0], DirtyArea[1],
+                                 DirtyArea[2] - DirtyArea[0], DirtyArea[3] - DirtyArea[1]);
+    if(status == LCD_OK)
+    {
+      DirtyArea[2] = 0;
+    }
+  }
+
+  return(status);
+}
+
 /**
   * @brief  Check if frame buffer is available.
   * @retval LCD_OK if frame buffer is available else LCD_ERROR (frame buffer busy)
@@ -1706,6 +1816,61 @@ void HAL_DSI_EndOfRefreshCallback(DSI_HandleTypeDef *hdsi)
   FrameBufferAvailable = 1;
 }
 
+/**
+  * @brief  Set the display area updated by the next refresh.
+  * @note   The panel memory window, the LTDC active area and the layer window
+  *         are reduced to the area : only its pixels are read from the frame
+  *         buffer and sent on the DSI link. The frame buffer pitch is kept.
+  *         Must be called while no refresh is on going.
+  * @param  Xpos: X position
+  * @param  Ypos: Y position
+  * @param  Width: Area width
+  * @param  Height: Area height
+  */
+static void LCD_SetRefreshArea(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+  uint8_t  Param[4];
+  uint32_t Column = Xpos + 4; /* First visible column of the panel is 4 */
+  uint32_t AHBP   = hltdc_discovery.Init.AccumulatedHBP;
+  uint32_t AVBP   = hltdc_discovery.Init.AccumulatedVBP;
+
+  /* Panel memory window, only sent when it changes */
+  if((RefreshArea[0] != Xpos) || (RefreshArea[1] != Ypos) ||
+     (RefreshArea[2] != Width) || (RefreshArea[3] != Height))
+  {
+    Param[0] = (uint8_t)(Column >> 8);
+    Param[1] = (uint8_t)(Column);
+    Param[2] = (uint8_t)((Column + Width - 1) >> 8);
+    Param[3] = (uint8_t)(Column + Width - 1);
+    HAL_DSI_LongWrite(&hdsi_discovery, 0, DSI_DCS_LONG_PKT_WRITE, 4, DSI_SET_COLUMN_ADDRESS, Param);
+    Param[0] = (uint8_t)(Ypos >> 8);
+    Param[1] = (uint8_t)(Ypos);
+    Param[2] = (uint8_t)((Ypos + Height - 1) >> 8);
+    Param[3] = (uint8_t)(Ypos + Height - 1);
+    HAL_DSI_LongWrite(&hdsi_discovery, 0, DSI_DCS_LONG_PKT_WRITE, 4, DSI_SET_PAGE_ADDRESS, Param);
+
+    RefreshArea[0] = Xpos;
+    RefreshArea[1] = Ypos;
+    RefreshArea[2] = Width;
+    RefreshArea[3] = Height;
+  }
+
+  /* LTDC active area, always written as the LTDC HAL layer functions restore
+     the full window. The layer configuration kept in the handle is not
+     modified : drawing functions still address the whole frame buffer */
+  LTDC->AWCR = ((AHBP + Width) << 16) | (AVBP + Height);
+  LTDC->TWCR = ((AHBP + Width + 1) << 16) | (AVBP + Height + 1);
+  LTDC_LAYER(&hltdc_discovery, 0)->WHPCR  = (AHBP + 1) | ((AHBP + Width) << 16);
+  LTDC_LAYER(&hltdc_discovery, 0)->WVPCR  = (AVBP + 1) | ((AVBP + Height) << 16);
+  LTDC_LAYER(&hltdc_discovery, 0)->CFBAR  = hltdc_discovery.LayerCfg[0].FBStartAdress + 4*(768*Ypos + Xpos);
+  LTDC_LAYER(&hltdc_discovery, 0)->CFBLR  = ((768 * 4) << 16) | ((Width * 4) + 3);
+  LTDC_LAYER(&hltdc_discovery, 0)->CFBLNR = Height;
+  LTDC->SRCR = LTDC_SRCR_IMR;
+
+  /* One DSI write memory command per line */
+  MODIFY_REG(hdsi_discovery.Instance->LCCR, DSI_LCCR_CMDSIZE, Width);
+}
+
 /**
   * @brief  LCD power on
   *         Power on LCD.
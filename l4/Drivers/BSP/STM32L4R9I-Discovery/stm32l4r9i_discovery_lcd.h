@@ -237,6 +237,9 @@ void     BSP_LCD_DisplayOff(void);
 void     BSP_LCD_DisplayOn(void);
 
 void     BSP_LCD_Refresh(void);
+uint8_t  BSP_LCD_RefreshRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
+void     BSP_LCD_InvalidateRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
+uint8_t  BSP_LCD_RefreshDirty(void);
 uint8_t  BSP_LCD_IsFrameBufferAvailable(void);
 
 void     BSP_LCD_SetBrightness(uint8_t BrightnessValue);
@@ -77,7 +77,8 @@
 /*    
 * @brief  Table for bit reversal process    
 */
-const uint16_t armBitRevTable[1024] = {
+#if defined(ARM_TABLE_BITREV_1024)
+const uint16_t armBitRevTable[1024] ARM_DSP_TABLE_ATTR = {
    0x400, 0x200, 0x600, 0x100, 0x500, 0x300, 0x700, 0x80, 0x480, 0x280, 
    0x680, 0x180, 0x580, 0x380, 0x780, 0x40, 0x440, 0x240, 0x640, 0x140, 
    0x540, 0x340, 0x740, 0xc0, 0x4c0, 0x2c0, 0x6c0, 0x1c0, 0x5c0, 0x3c0, 
@@ -182,6 +183,7 @@ const uint16_t armBitRevTable[1024] = {
    0x67e, 0x17e, 0x57e, 0x37e, 0x77e, 0xfe, 0x4fe, 0x2fe, 0x6fe, 0x1fe, 
    0x5fe, 0x3fe, 0x7fe, 0x1 
 };
+#endif
 
 
 /*    
@@ -203,7 +205,8 @@ const uint16_t armBitRevTable[1024] = {
 * Cos and Sin values are in interleaved fashion    
 *     
 */
-const float32_t twiddleCoef_16[32] = {
+#if defined(ARM_TABLE_FFT_F32_16)
+const float32_t twiddleCoef_16[32] ARM_DSP_TABLE_ATTR = {
     1.000000000f,  0.000000000f,
     0.923879533f,  0.382683432f,
     0.707106781f,  0.707106781f,
@@ -221,6 +224,7 @@ const float32_t twiddleCoef_16[32] = {
     0.707106781f, -0.707106781f,
     0.923879533f, -0.382683432f
 };
+#endif
 
 /**    
 * \par    
@@ -237,7 +241,8 @@ const float32_t twiddleCoef_16[32] = {
 * Cos and Sin values are in interleaved fashion    
 *     
 */
-const float32_t twiddleCoef_32[64] = {
+#if defined(ARM_TABLE_FFT_F32_32)
+const float32_t twiddleCoef_32[64] ARM_DSP_TABLE_ATTR = {
     1.000000000f,  0.000000000f,
     0.980785280f,  0.195090322f,
     0.923879533f,  0.382683432f,
@@ -271,6 +276,7 @@ const float32_t twiddleCoef_32[64] = {
     0.923879533f, -0.382683432f,
     0.980785280f, -0.195090322f
 };
+#endif
 
 /**    
 * \par    
@@ -287,7 +293,8 @@ const float32_t twiddleCoef_32[64] = {
 * Cos and Sin values are in interleaved fashion    
 *     
 */
-const float32_t twiddleCoef_64[128] = {
+#if defined(ARM_TABLE_FFT_F32_64)
+const float32_t twiddleCoef_64[128] ARM_DSP_TABLE_ATTR = {
     1.000000000f,  0.000000000f,
     0.995184727f,  0.098017140f,
     0.980785280f,  0.195090322f,
@@ -353,6 +360,7 @@ const float32_t twiddleCoef_64[128] = {
     0.980785280f, -0.195090322f,
     0.995184727f, -0.098017140f
 };
+#endif
 
 /**    
 * \par    
@@ -370,7 +378,8 @@ const float32_t twiddleCoef_64[128] = {
 *     
 */
 
-const float32_t twiddleCoef_128[256] = {
+#if defined(ARM_TABLE_FFT_F32_128)
+const float32_t twiddleCoef_128[256] ARM_DSP_TABLE_ATTR = {
     1.000000000f	,	0.000000000f	,
     0.998795456f	,	0.049067674f	,
     0.995184727f	,	0.098017140f	,
@@ -500,6 +509,7 @@ const float32_t twiddleCoef_128[256] = {
     0.995184727f	,	-0.098017140f	,
     0.998795456f	,	-0.049067674f
 };
+#endif
 
 /**    
 * \par    
@@ -516,7 +526,8 @@ const float32_t twiddleCoef_128[256] = {
 * Cos and Sin values are in interleaved fashion    
 *     
 */
-const float32_t twiddleCoef_256[512] = {
+#if defined(ARM_TABLE_FFT_F32_256)
+const float32_t twiddleCoef_256[512] ARM_DSP_TABLE_ATTR = {
     1.000000000f,  0.000000000f,
     0.999698819f,  0.024541229f,
     0.998795456f,  0.049067674f,
@@ -774,6 +785,7 @@ const float32_t twiddleCoef_256[512] = {
     0.998795456f, -0.049067674f,
     0.999698819f, -0.024541229f
 };
+#endif
 
 /**    
 * \par    
@@ -790,7 +802,8 @@ const float32_t twiddleCoef_256[512] = {
 * Cos and Sin values are in interleaved fashion    
 *     
 */
-const float32_t twiddleCoef_512[1024] = {
+#if defined(ARM_TABLE_FFT_F32_512)
+const float32_t twiddleCoef_512[1024] ARM_DSP_TABLE_ATTR = {
     1.000000000f,  0.000000000f,
     0.999924702f,  0.012271538f,
     0.999698819f,  0.024541229f,
@@ -1304,6 +1317,7 @@ const float32_t twiddleCoef_512[1024] = {
     0.999698819f, -0.024541229f,
     0.999924702f, -0.012271538f
 };
+#endif
 /**    
 * \par    
 * Example code for Floating-point Twiddle factors Generation:    
@@ -1319,7 +1333,8 @@ const float32_t twiddleCoef_512[1024] = {
 * Cos and Sin values are in interleaved fashion    
 *     
 */
-const float32_t twiddleCoef_1024[2048] = {
+#if defined(ARM_TABLE_FFT_F32_1024)
+const float32_t twiddleCoef_1024[2048] ARM_DSP_TABLE_ATTR = {
 1.000000000f	,	0.000000000f	,
 0.999981175f	,	0.006135885f	,
 0.999924702f	,	0.012271538f	,
@@ -2345,6 +2360,7 @@ const float32_t twiddleCoef_1024[2048] = {
 0.999924702f	,	-0.012271538f	,
 0.999981175f	,	-0.006135885f
 };
+#endif
 
 /**    
 * \par    
@@ -2361,7 +2377,8 @@ const float32_t twiddleCoef_1024[2048] = {
 * Cos and Sin values are in interleaved fashion    
 *     
 */
-const float32_t twiddleCoef_2048[4096] = {
+#if defined(ARM_TABLE_FFT_F32_2048)
+const float32_t twiddleCoef_2048[4096] ARM_DSP_TABLE_ATTR = {
     1.000000000f,  0.000000000f,
     0.999995294f,  0.003067957f,
     0.999981175f,  0.006135885f,
@@ -4411,6 +4428,7 @@ const float32_t twiddleCoef_2048[4096] = {
     0.999981175f, -0.006135885f,
     0.999995294f, -0.003067957f
 };
+#endif
 
 /**    
 * \par    
@@ -4427,7 +4445,8 @@ const float32_t twiddleCoef_2048[4096] = {
 * Cos and Sin values are in interleaved fashion    
 *     
 */
-const float32_t twiddleCoef_4096[8192] = {
+#if defined(ARM_TABLE_FFT_F32_4096)
+const float32_t twiddleCoef_4096[8192] ARM_DSP_TABLE_ATTR = {
     1.000000000f,  0.000000000f,
     0.999998823f,  0.001533980f,
     0.999995294f,  0.003067957f,
@@ -8525,6 +8544,5731 @@ const float32_t twiddleCoef_4096[8192] = {
     0.999995294f, -0.003067957f,
     0.999998823f, -0.001533980f
 };
+#endif
+
+/**    
+* \par    
+* Example code for Floating-point Twiddle factors Generation:    
+* \par    
+* <pre>for(i = 0; i< N/; i++)    
+* {    
+*	twiddleCoef[2*i]= cos(i * 2*PI/(float)N);    
+*	twiddleCoef[2*i+1]= sin(i * 2*PI/(float)N);    
+* } </pre>    
+* \par    
+* where N = 500	and PI = 3.14159265358979    
+* \par    
+* Cos and Sin values are in interleaved fashion    
+*     
+*/
+#if defined(ARM_TABLE_FFT_F32_500)
+const float32_t twiddleCoef_500[1000] ARM_DSP_TABLE_ATTR = {
+    1.000000000f,  0.000000000f,
+    0.999921044f,  0.012566040f,
+    0.999684189f,  0.025130095f,
+    0.999289473f,  0.037690183f,
+    0.998736957f,  0.050244318f,
+    0.998026728f,  0.062790520f,
+    0.997158900f,  0.075326806f,
+    0.996133609f,  0.087851197f,
+    0.994951017f,  0.100361715f,
+    0.993611311f,  0.112856385f,
+    0.992114701f,  0.125333234f,
+    0.990461426f,  0.137790291f,
+    0.988651745f,  0.150225589f,
+    0.986685944f,  0.162637165f,
+    0.984564335f,  0.175023059f,
+    0.982287251f,  0.187381315f,
+    0.979855052f,  0.199709981f,
+    0.977268124f,  0.212007110f,
+    0.974526873f,  0.224270761f,
+    0.971631733f,  0.236498997f,
+    0.968583161f,  0.248689887f,
+    0.965381639f,  0.260841506f,
+    0.962027672f,  0.272951936f,
+    0.958521789f,  0.285019262f,
+    0.954864545f,  0.297041582f,
+    0.951056516f,  0.309016994f,
+    0.947098305f,  0.320943610f,
+    0.942990536f,  0.332819545f,
+    0.938733858f,  0.344642923f,
+    0.934328942f,  0.356411879f,
+    0.929776486f,  0.368124553f,
+    0.925077207f,  0.379779096f,
+    0.920231847f,  0.391373667f,
+    0.915241173f,  0.402906436f,
+    0.910105971f,  0.414375581f,
+    0.904827052f,  0.425779292f,
+    0.899405252f,  0.437115767f,
+    0.893841424f,  0.448383216f,
+    0.888136449f,  0.459579861f,
+    0.882291226f,  0.470703932f,
+    0.876306680f,  0.481753674f,
+    0.870183755f,  0.492727342f,
+    0.863923417f,  0.503623202f,
+    0.857526656f,  0.514439534f,
+    0.850994482f,  0.525174630f,
+    0.844327926f,  0.535826795f,
+    0.837528040f,  0.546394347f,
+    0.830595899f,  0.556875616f,
+    0.823532598f,  0.567268949f,
+    0.816339251f,  0.577572703f,
+    0.809016994f,  0.587785252f,
+    0.801566985f,  0.597904983f,
+    0.793990399f,  0.607930298f,
+    0.786288432f,  0.617859613f,
+    0.778462302f,  0.627691361f,
+    0.770513243f,  0.637423990f,
+    0.762442511f,  0.647055962f,
+    0.754251381f,  0.656585756f,
+    0.745941145f,  0.666011867f,
+    0.737513117f,  0.675332808f,
+    0.728968627f,  0.684547106f,
+    0.720309025f,  0.693653306f,
+    0.711535677f,  0.702649970f,
+    0.702649970f,  0.711535677f,
+    0.693653306f,  0.720309025f,
+    0.684547106f,  0.728968627f,
+    0.675332808f,  0.737513117f,
+    0.666011867f,  0.745941145f,
+    0.656585756f,  0.754251381f,
+    0.647055962f,  0.762442511f,
+    0.637423990f,  0.770513243f,
+    0.627691361f,  0.778462302f,
+    0.617859613f,  0.786288432f,
+    0.607930298f,  0.793990399f,
+    0.597904983f,  0.801566985f,
+    0.587785252f,  0.809016994f,
+    0.577572703f,  0.816339251f,
+    0.567268949f,  0.823532598f,
+    0.556875616f,  0.830595899f,
+    0.546394347f,  0.837528040f,
+    0.535826795f,  0.844327926f,
+    0.525174630f,  0.850994482f,
+    0.514439534f,  0.857526656f,
+    0.503623202f,  0.863923417f,
+    0.492727342f,  0.870183755f,
+    0.481753674f,  0.876306680f,
+    0.470703932f,  0.882291226f,
+    0.459579861f,  0.888136449f,
+    0.448383216f,  0.893841424f,
+    0.437115767f,  0.899405252f,
+    0.425779292f,  0.904827052f,
+    0.414375581f,  0.910105971f,
+    0.402906436f,  0.915241173f,
+    0.391373667f,  0.920231847f,
+    0.379779096f,  0.925077207f,
+    0.368124553f,  0.929776486f,
+    0.356411879f,  0.934328942f,
+    0.344642923f,  0.938733858f,
+    0.332819545f,  0.942990536f,
+    0.320943610f,  0.947098305f,
+    0.309016994f,  0.951056516f,
+    0.297041582f,  0.954864545f,
+    0.285019262f,  0.958521789f,
+    0.272951936f,  0.962027672f,
+    0.260841506f,  0.965381639f,
+    0.248689887f,  0.968583161f,
+    0.236498997f,  0.971631733f,
+    0.224270761f,  0.974526873f,
+    0.212007110f,  0.977268124f,
+    0.199709981f,  0.979855052f,
+    0.187381315f,  0.982287251f,
+    0.175023059f,  0.984564335f,
+    0.162637165f,  0.986685944f,
+    0.150225589f,  0.988651745f,
+    0.137790291f,  0.990461426f,
+    0.125333234f,  0.992114701f,
+    0.112856385f,  0.993611311f,
+    0.100361715f,  0.994951017f,
+    0.087851197f,  0.996133609f,
+    0.075326806f,  0.997158900f,
+    0.062790520f,  0.998026728f,
+    0.050244318f,  0.998736957f,
+    0.037690183f,  0.999289473f,
+    0.025130095f,  0.999684189f,
+    0.012566040f,  0.999921044f,
+    0.000000000f,  1.000000000f,
+   -0.012566040f,  0.999921044f,
+   -0.025130095f,  0.999684189f,
+   -0.037690183f,  0.999289473f,
+   -0.050244318f,  0.998736957f,
+   -0.062790520f,  0.998026728f,
+   -0.075326806f,  0.997158900f,
+   -0.087851197f,  0.996133609f,
+   -0.100361715f,  0.994951017f,
+   -0.112856385f,  0.993611311f,
+   -0.125333234f,  0.992114701f,
+   -0.137790291f,  0.990461426f,
+   -0.150225589f,  0.988651745f,
+   -0.162637165f,  0.986685944f,
+   -0.175023059f,  0.984564335f,
+   -0.187381315f,  0.982287251f,
+   -0.199709981f,  0.979855052f,
+   -0.212007110f,  0.977268124f,
+   -0.224270761f,  0.974526873f,
+   -0.236498997f,  0.971631733f,
+   -0.248689887f,  0.968583161f,
+   -0.260841506f,  0.965381639f,
+   -0.272951936f,  0.962027672f,
+   -0.285019262f,  0.958521789f,
+   -0.297041582f,  0.954864545f,
+   -0.309016994f,  0.951056516f,
+   -0.320943610f,  0.947098305f,
+   -0.332819545f,  0.942990536f,
+   -0.344642923f,  0.938733858f,
+   -0.356411879f,  0.934328942f,
+   -0.368124553f,  0.929776486f,
+   -0.379779096f,  0.925077207f,
+   -0.391373667f,  0.920231847f,
+   -0.402906436f,  0.915241173f,
+   -0.414375581f,  0.910105971f,
+   -0.425779292f,  0.904827052f,
+   -0.437115767f,  0.899405252f,
+   -0.448383216f,  0.893841424f,
+   -0.459579861f,  0.888136449f,
+   -0.470703932f,  0.882291226f,
+   -0.481753674f,  0.876306680f,
+   -0.492727342f,  0.870183755f,
+   -0.503623202f,  0.863923417f,
+   -0.514439534f,  0.857526656f,
+   -0.525174630f,  0.850994482f,
+   -0.535826795f,  0.844327926f,
+   -0.546394347f,  0.837528040f,
+   -0.556875616f,  0.830595899f,
+   -0.567268949f,  0.823532598f,
+   -0.577572703f,  0.816339251f,
+   -0.587785252f,  0.809016994f,
+   -0.597904983f,  0.801566985f,
+   -0.607930298f,  0.793990399f,
+   -0.617859613f,  0.786288432f,
+   -0.627691361f,  0.778462302f,
+   -0.637423990f,  0.770513243f,
+   -0.647055962f,  0.762442511f,
+   -0.656585756f,  0.754251381f,
+   -0.666011867f,  0.745941145f,
+   -0.675332808f,  0.737513117f,
+   -0.684547106f,  0.728968627f,
+   -0.693653306f,  0.720309025f,
+   -0.702649970f,  0.711535677f,
+   -0.711535677f,  0.702649970f,
+   -0.720309025f,  0.693653306f,
+   -0.728968627f,  0.684547106f,
+   -0.737513117f,  0.675332808f,
+   -0.745941145f,  0.666011867f,
+   -0.754251381f,  0.656585756f,
+   -0.762442511f,  0.647055962f,
+   -0.770513243f,  0.637423990f,
+   -0.778462302f,  0.627691361f,
+   -0.786288432f,  0.617859613f,
+   -0.793990399f,  0.607930298f,
+   -0.801566985f,  0.597904983f,
+   -0.809016994f,  0.587785252f,
+   -0.816339251f,  0.577572703f,
+   -0.823532598f,  0.567268949f,
+   -0.830595899f,  0.556875616f,
+   -0.837528040f,  0.546394347f,
+   -0.844327926f,  0.535826795f,
+   -0.850994482f,  0.525174630f,
+   -0.857526656f,  0.514439534f,
+   -0.863923417f,  0.503623202f,
+   -0.870183755f,  0.492727342f,
+   -0.876306680f,  0.481753674f,
+   -0.882291226f,  0.470703932f,
+   -0.888136449f,  0.459579861f,
+   -0.893841424f,  0.448383216f,
+   -0.899405252f,  0.437115767f,
+   -0.904827052f,  0.425779292f,
+   -0.910105971f,  0.414375581f,
+   -0.915241173f,  0.402906436f,
+   -0.920231847f,  0.391373667f,
+   -0.925077207f,  0.379779096f,
+   -0.929776486f,  0.368124553f,
+   -0.934328942f,  0.356411879f,
+   -0.938733858f,  0.344642923f,
+   -0.942990536f,  0.332819545f,
+   -0.947098305f,  0.320943610f,
+   -0.951056516f,  0.309016994f,
+   -0.954864545f,  0.297041582f,
+   -0.958521789f,  0.285019262f,
+   -0.962027672f,  0.272951936f,
+   -0.965381639f,  0.260841506f,
+   -0.968583161f,  0.248689887f,
+   -0.971631733f,  0.236498997f,
+   -0.974526873f,  0.224270761f,
+   -0.977268124f,  0.212007110f,
+   -0.979855052f,  0.199709981f,
+   -0.982287251f,  0.187381315f,
+   -0.984564335f,  0.175023059f,
+   -0.986685944f,  0.162637165f,
+   -0.988651745f,  0.150225589f,
+   -0.990461426f,  0.137790291f,
+   -0.992114701f,  0.125333234f,
+   -0.993611311f,  0.112856385f,
+   -0.994951017f,  0.100361715f,
+   -0.996133609f,  0.087851197f,
+   -0.997158900f,  0.075326806f,
+   -0.998026728f,  0.062790520f,
+   -0.998736957f,  0.050244318f,
+   -0.999289473f,  0.037690183f,
+   -0.999684189f,  0.025130095f,
+   -0.999921044f,  0.012566040f,
+   -1.000000000f,  0.000000000f,
+   -0.999921044f, -0.012566040f,
+   -0.999684189f, -0.025130095f,
+   -0.999289473f, -0.037690183f,
+   -0.998736957f, -0.050244318f,
+   -0.998026728f, -0.062790520f,
+   -0.997158900f, -0.075326806f,
+   -0.996133609f, -0.087851197f,
+   -0.994951017f, -0.100361715f,
+   -0.993611311f, -0.112856385f,
+   -0.992114701f, -0.125333234f,
+   -0.990461426f, -0.137790291f,
+   -0.988651745f, -0.150225589f,
+   -0.986685944f, -0.162637165f,
+   -0.984564335f, -0.175023059f,
+   -0.982287251f, -0.187381315f,
+   -0.979855052f, -0.199709981f,
+   -0.977268124f, -0.212007110f,
+   -0.974526873f, -0.224270761f,
+   -0.971631733f, -0.236498997f,
+   -0.968583161f, -0.248689887f,
+   -0.965381639f, -0.260841506f,
+   -0.962027672f, -0.272951936f,
+   -0.958521789f, -0.285019262f,
+   -0.954864545f, -0.297041582f,
+   -0.951056516f, -0.309016994f,
+   -0.947098305f, -0.320943610f,
+   -0.942990536f, -0.332819545f,
+   -0.938733858f, -0.344642923f,
+   -0.934328942f, -0.356411879f,
+   -0.929776486f, -0.368124553f,
+   -0.925077207f, -0.379779096f,
+   -0.920231847f, -0.391373667f,
+   -0.915241173f, -0.402906436f,
+   -0.910105971f, -0.414375581f,
+   -0.904827052f, -0.425779292f,
+   -0.899405252f, -0.437115767f,
+   -0.893841424f, -0.448383216f,
+   -0.888136449f, -0.459579861f,
+   -0.882291226f, -0.470703932f,
+   -0.876306680f, -0.481753674f,
+   -0.870183755f, -0.492727342f,
+   -0.863923417f, -0.503623202f,
+   -0.857526656f, -0.514439534f,
+   -0.850994482f, -0.525174630f,
+   -0.844327926f, -0.535826795f,
+   -0.837528040f, -0.546394347f,
+   -0.830595899f, -0.556875616f,
+   -0.823532598f, -0.567268949f,
+   -0.816339251f, -0.577572703f,
+   -0.809016994f, -0.587785252f,
+   -0.801566985f, -0.597904983f,
+   -0.793990399f, -0.607930298f,
+   -0.786288432f, -0.617859613f,
+   -0.778462302f, -0.627691361f,
+   -0.770513243f, -0.637423990f,
+   -0.762442511f, -0.647055962f,
+   -0.754251381f, -0.656585756f,
+   -0.745941145f, -0.666011867f,
+   -0.737513117f, -0.675332808f,
+   -0.728968627f, -0.684547106f,
+   -0.720309025f, -0.693653306f,
+   -0.711535677f, -0.702649970f,
+   -0.702649970f, -0.711535677f,
+   -0.693653306f, -0.720309025f,
+   -0.684547106f, -0.728968627f,
+   -0.675332808f, -0.737513117f,
+   -0.666011867f, -0.745941145f,
+   -0.656585756f, -0.754251381f,
+   -0.647055962f, -0.762442511f,
+   -0.637423990f, -0.770513243f,
+   -0.627691361f, -0.778462302f,
+   -0.617859613f, -0.786288432f,
+   -0.607930298f, -0.793990399f,
+   -0.597904983f, -0.801566985f,
+   -0.587785252f, -0.809016994f,
+   -0.577572703f, -0.816339251f,
+   -0.567268949f, -0.823532598f,
+   -0.556875616f, -0.830595899f,
+   -0.546394347f, -0.837528040f,
+   -0.535826795f, -0.844327926f,
+   -0.525174630f, -0.850994482f,
+   -0.514439534f, -0.857526656f,
+   -0.503623202f, -0.863923417f,
+   -0.492727342f, -0.870183755f,
+   -0.481753674f, -0.876306680f,
+   -0.470703932f, -0.882291226f,
+   -0.459579861f, -0.888136449f,
+   -0.448383216f, -0.893841424f,
+   -0.437115767f, -0.899405252f,
+   -0.425779292f, -0.904827052f,
+   -0.414375581f, -0.910105971f,
+   -0.402906436f, -0.915241173f,
+   -0.391373667f, -0.920231847f,
+   -0.379779096f, -0.925077207f,
+   -0.368124553f, -0.929776486f,
+   -0.356411879f, -0.934328942f,
+   -0.344642923f, -0.938733858f,
+   -0.332819545f, -0.942990536f,
+   -0.320943610f, -0.947098305f,
+   -0.309016994f, -0.951056516f,
+   -0.297041582f, -0.954864545f,
+   -0.285019262f, -0.958521789f,
+   -0.272951936f, -0.962027672f,
+   -0.260841506f, -0.965381639f,
+   -0.248689887f, -0.968583161f,
+   -0.236498997f, -0.971631733f,
+   -0.224270761f, -0.974526873f,
+   -0.212007110f, -0.977268124f,
+   -0.199709981f, -0.979855052f,
+   -0.187381315f, -0.982287251f,
+   -0.175023059f, -0.984564335f,
+   -0.162637165f, -0.986685944f,
+   -0.150225589f, -0.988651745f,
+   -0.137790291f, -0.990461426f,
+   -0.125333234f, -0.992114701f,
+   -0.112856385f, -0.993611311f,
+   -0.100361715f, -0.994951017f,
+   -0.087851197f, -0.996133609f,
+   -0.075326806f, -0.997158900f,
+   -0.062790520f, -0.998026728f,
+   -0.050244318f, -0.998736957f,
+   -0.037690183f, -0.999289473f,
+   -0.025130095f, -0.999684189f,
+   -0.012566040f, -0.999921044f,
+   -0.000000000f, -1.000000000f,
+    0.012566040f, -0.999921044f,
+    0.025130095f, -0.999684189f,
+    0.037690183f, -0.999289473f,
+    0.050244318f, -0.998736957f,
+    0.062790520f, -0.998026728f,
+    0.075326806f, -0.997158900f,
+    0.087851197f, -0.996133609f,
+    0.100361715f, -0.994951017f,
+    0.112856385f, -0.993611311f,
+    0.125333234f, -0.992114701f,
+    0.137790291f, -0.990461426f,
+    0.150225589f, -0.988651745f,
+    0.162637165f, -0.986685944f,
+    0.175023059f, -0.984564335f,
+    0.187381315f, -0.982287251f,
+    0.199709981f, -0.979855052f,
+    0.212007110f, -0.977268124f,
+    0.224270761f, -0.974526873f,
+    0.236498997f, -0.971631733f,
+    0.248689887f, -0.968583161f,
+    0.260841506f, -0.965381639f,
+    0.272951936f, -0.962027672f,
+    0.285019262f, -0.958521789f,
+    0.297041582f, -0.954864545f,
+    0.309016994f, -0.951056516f,
+    0.320943610f, -0.947098305f,
+    0.332819545f, -0.942990536f,
+    0.344642923f, -0.938733858f,
+    0.356411879f, -0.934328942f,
+    0.368124553f, -0.929776486f,
+    0.379779096f, -0.925077207f,
+    0.391373667f, -0.920231847f,
+    0.402906436f, -0.915241173f,
+    0.414375581f, -0.910105971f,
+    0.425779292f, -0.904827052f,
+    0.437115767f, -0.899405252f,
+    0.448383216f, -0.893841424f,
+    0.459579861f, -0.888136449f,
+    0.470703932f, -0.882291226f,
+    0.481753674f, -0.876306680f,
+    0.492727342f, -0.870183755f,
+    0.503623202f, -0.863923417f,
+    0.514439534f, -0.857526656f,
+    0.525174630f, -0.850994482f,
+    0.535826795f, -0.844327926f,
+    0.546394347f, -0.837528040f,
+    0.556875616f, -0.830595899f,
+    0.567268949f, -0.823532598f,
+    0.577572703f, -0.816339251f,
+    0.587785252f, -0.809016994f,
+    0.597904983f, -0.801566985f,
+    0.607930298f, -0.793990399f,
+    0.617859613f, -0.786288432f,
+    0.627691361f, -0.778462302f,
+    0.637423990f, -0.770513243f,
+    0.647055962f, -0.762442511f,
+    0.656585756f, -0.754251381f,
+    0.666011867f, -0.745941145f,
+    0.675332808f, -0.737513117f,
+    0.684547106f, -0.728968627f,
+    0.693653306f, -0.720309025f,
+    0.702649970f, -0.711535677f,
+    0.711535677f, -0.702649970f,
+    0.720309025f, -0.693653306f,
+    0.728968627f, -0.684547106f,
+    0.737513117f, -0.675332808f,
+    0.745941145f, -0.666011867f,
+    0.754251381f, -0.656585756f,
+    0.762442511f, -0.647055962f,
+    0.770513243f, -0.637423990f,
+    0.778462302f, -0.627691361f,
+    0.786288432f, -0.617859613f,
+    0.793990399f, -0.607930298f,
+    0.801566985f, -0.597904983f,
+    0.809016994f, -0.587785252f,
+    0.816339251f, -0.577572703f,
+    0.823532598f, -0.567268949f,
+    0.830595899f, -0.556875616f,
+    0.837528040f, -0.546394347f,
+    0.844327926f, -0.535826795f,
+    0.850994482f, -0.525174630f,
+    0.857526656f, -0.514439534f,
+    0.863923417f, -0.503623202f,
+    0.870183755f, -0.492727342f,
+    0.876306680f, -0.481753674f,
+    0.882291226f, -0.470703932f,
+    0.888136449f, -0.459579861f,
+    0.893841424f, -0.448383216f,
+    0.899405252f, -0.437115767f,
+    0.904827052f, -0.425779292f,
+    0.910105971f, -0.414375581f,
+    0.915241173f, -0.402906436f,
+    0.920231847f, -0.391373667f,
+    0.925077207f, -0.379779096f,
+    0.929776486f, -0.368124553f,
+    0.934328942f, -0.356411879f,
+    0.938733858f, -0.344642923f,
+    0.942990536f, -0.332819545f,
+    0.947098305f, -0.320943610f,
+    0.951056516f, -0.309016994f,
+    0.954864545f, -0.297041582f,
+    0.958521789f, -0.285019262f,
+    0.962027672f, -0.272951936f,
+    0.965381639f, -0.260841506f,
+    0.968583161f, -0.248689887f,
+    0.971631733f, -0.236498997f,
+    0.974526873f, -0.224270761f,
+    0.977268124f, -0.212007110f,
+    0.979855052f, -0.199709981f,
+    0.982287251f, -0.187381315f,
+    0.984564335f, -0.175023059f,
+    0.986685944f, -0.162637165f,
+    0.988651745f, -0.150225589f,
+    0.990461426f, -0.137790291f,
+    0.992114701f, -0.125333234f,
+    0.993611311f, -0.112856385f,
+    0.994951017f, -0.100361715f,
+    0.996133609f, -0.087851197f,
+    0.997158900f, -0.075326806f,
+    0.998026728f, -0.062790520f,
+    0.998736957f, -0.050244318f,
+    0.999289473f, -0.037690183f,
+    0.999684189f, -0.025130095f,
+    0.999921044f, -0.012566040f
+};
+#endif
+
+/**    
+* \par    
+* Example code for Floating-point Twiddle factors Generation:    
+* \par    
+* <pre>for(i = 0; i< N/; i++)    
+* {    
+*	twiddleCoef[2*i]= cos(i * 2*PI/(float)N);    
+*	twiddleCoef[2*i+1]= sin(i * 2*PI/(float)N);    
+* } </pre>    
+* \par    
+* where N = 600	and PI = 3.14159265358979    
+* \par    
+* Cos and Sin values are in interleaved fashion    
+*     
+*/
+#if defined(ARM_TABLE_FFT_F32_600)
+const float32_t twiddleCoef_600[1200] ARM_DSP_TABLE_ATTR = {
+    1.000000000f,  0.000000000f,
+    0.999945169f,  0.010471784f,
+    0.999780683f,  0.020942420f,
+    0.999506560f,  0.031410759f,
+    0.999122830f,  0.041875654f,
+    0.998629535f,  0.052335956f,
+    0.998026728f,  0.062790520f,
+    0.997314477f,  0.073238197f,
+    0.996492859f,  0.083677843f,
+    0.995561965f,  0.094108313f,
+    0.994521895f,  0.104528463f,
+    0.993372766f,  0.114937150f,
+    0.992114701f,  0.125333234f,
+    0.990747840f,  0.135715572f,
+    0.989272333f,  0.146083029f,
+    0.987688341f,  0.156434465f,
+    0.985996037f,  0.166768747f,
+    0.984195608f,  0.177084740f,
+    0.982287251f,  0.187381315f,
+    0.980271175f,  0.197657340f,
+    0.978147601f,  0.207911691f,
+    0.975916762f,  0.218143241f,
+    0.973578903f,  0.228350870f,
+    0.971134280f,  0.238533458f,
+    0.968583161f,  0.248689887f,
+    0.965925826f,  0.258819045f,
+    0.963162567f,  0.268919821f,
+    0.960293686f,  0.278991106f,
+    0.957319498f,  0.289031797f,
+    0.954240329f,  0.299040792f,
+    0.951056516f,  0.309016994f,
+    0.947768410f,  0.318959309f,
+    0.944376370f,  0.328866647f,
+    0.940880769f,  0.338737920f,
+    0.937281989f,  0.348572047f,
+    0.933580426f,  0.358367950f,
+    0.929776486f,  0.368124553f,
+    0.925870585f,  0.377840787f,
+    0.921863152f,  0.387515586f,
+    0.917754626f,  0.397147891f,
+    0.913545458f,  0.406736643f,
+    0.909236109f,  0.416280792f,
+    0.904827052f,  0.425779292f,
+    0.900318771f,  0.435231099f,
+    0.895711760f,  0.444635179f,
+    0.891006524f,  0.453990500f,
+    0.886203579f,  0.463296035f,
+    0.881303452f,  0.472550765f,
+    0.876306680f,  0.481753674f,
+    0.871213811f,  0.490903754f,
+    0.866025404f,  0.500000000f,
+    0.860742027f,  0.509041416f,
+    0.855364260f,  0.518027009f,
+    0.849892693f,  0.526955795f,
+    0.844327926f,  0.535826795f,
+    0.838670568f,  0.544639035f,
+    0.832921241f,  0.553391549f,
+    0.827080574f,  0.562083378f,
+    0.821149209f,  0.570713568f,
+    0.815127796f,  0.579281172f,
+    0.809016994f,  0.587785252f,
+    0.802817475f,  0.596224875f,
+    0.796529918f,  0.604599115f,
+    0.790155012f,  0.612907054f,
+    0.783693457f,  0.621147780f,
+    0.777145961f,  0.629320391f,
+    0.770513243f,  0.637423990f,
+    0.763796029f,  0.645457688f,
+    0.756995056f,  0.653420604f,
+    0.750111070f,  0.661311865f,
+    0.743144825f,  0.669130606f,
+    0.736097087f,  0.676875970f,
+    0.728968627f,  0.684547106f,
+    0.721760228f,  0.692143174f,
+    0.714472680f,  0.699663341f,
+    0.707106781f,  0.707106781f,
+    0.699663341f,  0.714472680f,
+    0.692143174f,  0.721760228f,
+    0.684547106f,  0.728968627f,
+    0.676875970f,  0.736097087f,
+    0.669130606f,  0.743144825f,
+    0.661311865f,  0.750111070f,
+    0.653420604f,  0.756995056f,
+    0.645457688f,  0.763796029f,
+    0.637423990f,  0.770513243f,
+    0.629320391f,  0.777145961f,
+    0.621147780f,  0.783693457f,
+    0.612907054f,  0.790155012f,
+    0.604599115f,  0.796529918f,
+    0.596224875f,  0.802817475f,
+    0.587785252f,  0.809016994f,
+    0.579281172f,  0.815127796f,
+    0.570713568f,  0.821149209f,
+    0.562083378f,  0.827080574f,
+    0.553391549f,  0.832921241f,
+    0.544639035f,  0.838670568f,
+    0.535826795f,  0.844327926f,
+    0.526955795f,  0.849892693f,
+    0.518027009f,  0.855364260f,
+    0.509041416f,  0.860742027f,
+    0.500000000f,  0.866025404f,
+    0.490903754f,  0.871213811f,
+    0.481753674f,  0.876306680f,
+    0.472550765f,  0.881303452f,
+    0.463296035f,  0.886203579f,
+    0.453990500f,  0.891006524f,
+    0.444635179f,  0.895711760f,
+    0.435231099f,  0.900318771f,
+    0.425779292f,  0.904827052f,
+    0.416280792f,  0.909236109f,
+    0.406736643f,  0.913545458f,
+    0.397147891f,  0.917754626f,
+    0.387515586f,  0.921863152f,
+    0.377840787f,  0.925870585f,
+    0.368124553f,  0.929776486f,
+    0.358367950f,  0.933580426f,
+    0.348572047f,  0.937281989f,
+    0.338737920f,  0.940880769f,
+    0.328866647f,  0.944376370f,
+    0.318959309f,  0.947768410f,
+    0.309016994f,  0.951056516f,
+    0.299040792f,  0.954240329f,
+    0.289031797f,  0.957319498f,
+    0.278991106f,  0.960293686f,
+    0.268919821f,  0.963162567f,
+    0.258819045f,  0.965925826f,
+    0.248689887f,  0.968583161f,
+    0.238533458f,  0.971134280f,
+    0.228350870f,  0.973578903f,
+    0.218143241f,  0.975916762f,
+    0.207911691f,  0.978147601f,
+    0.197657340f,  0.980271175f,
+    0.187381315f,  0.982287251f,
+    0.177084740f,  0.984195608f,
+    0.166768747f,  0.985996037f,
+    0.156434465f,  0.987688341f,
+    0.146083029f,  0.989272333f,
+    0.135715572f,  0.990747840f,
+    0.125333234f,  0.992114701f,
+    0.114937150f,  0.993372766f,
+    0.104528463f,  0.994521895f,
+    0.094108313f,  0.995561965f,
+    0.083677843f,  0.996492859f,
+    0.073238197f,  0.997314477f,
+    0.062790520f,  0.998026728f,
+    0.052335956f,  0.998629535f,
+    0.041875654f,  0.999122830f,
+    0.031410759f,  0.999506560f,
+    0.020942420f,  0.999780683f,
+    0.010471784f,  0.999945169f,
+    0.000000000f,  1.000000000f,
+   -0.010471784f,  0.999945169f,
+   -0.020942420f,  0.999780683f,
+   -0.031410759f,  0.999506560f,
+   -0.041875654f,  0.999122830f,
+   -0.052335956f,  0.998629535f,
+   -0.062790520f,  0.998026728f,
+   -0.073238197f,  0.997314477f,
+   -0.083677843f,  0.996492859f,
+   -0.094108313f,  0.995561965f,
+   -0.104528463f,  0.994521895f,
+   -0.114937150f,  0.993372766f,
+   -0.125333234f,  0.992114701f,
+   -0.135715572f,  0.990747840f,
+   -0.146083029f,  0.989272333f,
+   -0.156434465f,  0.987688341f,
+   -0.166768747f,  0.985996037f,
+   -0.177084740f,  0.984195608f,
+   -0.187381315f,  0.982287251f,
+   -0.197657340f,  0.980271175f,
+   -0.207911691f,  0.978147601f,
+   -0.218143241f,  0.975916762f,
+   -0.228350870f,  0.973578903f,
+   -0.238533458f,  0.971134280f,
+   -0.248689887f,  0.968583161f,
+   -0.258819045f,  0.965925826f,
+   -0.268919821f,  0.963162567f,
+   -0.278991106f,  0.960293686f,
+   -0.289031797f,  0.957319498f,
+   -0.299040792f,  0.954240329f,
+   -0.309016994f,  0.951056516f,
+   -0.318959309f,  0.947768410f,
+   -0.328866647f,  0.944376370f,
+   -0.338737920f,  0.940880769f,
+   -0.348572047f,  0.937281989f,
+   -0.358367950f,  0.933580426f,
+   -0.368124553f,  0.929776486f,
+   -0.377840787f,  0.925870585f,
+   -0.387515586f,  0.921863152f,
+   -0.397147891f,  0.917754626f,
+   -0.406736643f,  0.913545458f,
+   -0.416280792f,  0.909236109f,
+   -0.425779292f,  0.904827052f,
+   -0.435231099f,  0.900318771f,
+   -0.444635179f,  0.895711760f,
+   -0.453990500f,  0.891006524f,
+   -0.463296035f,  0.886203579f,
+   -0.472550765f,  0.881303452f,
+   -0.481753674f,  0.876306680f,
+   -0.490903754f,  0.871213811f,
+   -0.500000000f,  0.866025404f,
+   -0.509041416f,  0.860742027f,
+   -0.518027009f,  0.855364260f,
+   -0.526955795f,  0.849892693f,
+   -0.535826795f,  0.844327926f,
+   -0.544639035f,  0.838670568f,
+   -0.553391549f,  0.832921241f,
+   -0.562083378f,  0.827080574f,
+   -0.570713568f,  0.821149209f,
+   -0.579281172f,  0.815127796f,
+   -0.587785252f,  0.809016994f,
+   -0.596224875f,  0.802817475f,
+   -0.604599115f,  0.796529918f,
+   -0.612907054f,  0.790155012f,
+   -0.621147780f,  0.783693457f,
+   -0.629320391f,  0.777145961f,
+   -0.637423990f,  0.770513243f,
+   -0.645457688f,  0.763796029f,
+   -0.653420604f,  0.756995056f,
+   -0.661311865f,  0.750111070f,
+   -0.669130606f,  0.743144825f,
+   -0.676875970f,  0.736097087f,
+   -0.684547106f,  0.728968627f,
+   -0.692143174f,  0.721760228f,
+   -0.699663341f,  0.714472680f,
+   -0.707106781f,  0.707106781f,
+   -0.714472680f,  0.699663341f,
+   -0.721760228f,  0.692143174f,
+   -0.728968627f,  0.684547106f,
+   -0.736097087f,  0.676875970f,
+   -0.743144825f,  0.669130606f,
+   -0.750111070f,  0.661311865f,
+   -0.756995056f,  0.653420604f,
+   -0.763796029f,  0.645457688f,
+   -0.770513243f,  0.637423990f,
+   -0.777145961f,  0.629320391f,
+   -0.783693457f,  0.621147780f,
+   -0.790155012f,  0.612907054f,
+   -0.796529918f,  0.604599115f,
+   -0.802817475f,  0.596224875f,
+   -0.809016994f,  0.587785252f,
+   -0.815127796f,  0.579281172f,
+   -0.821149209f,  0.570713568f,
+   -0.827080574f,  0.562083378f,
+   -0.832921241f,  0.553391549f,
+   -0.838670568f,  0.544639035f,
+   -0.844327926f,  0.535826795f,
+   -0.849892693f,  0.526955795f,
+   -0.855364260f,  0.518027009f,
+   -0.860742027f,  0.509041416f,
+   -0.866025404f,  0.500000000f,
+   -0.871213811f,  0.490903754f,
+   -0.876306680f,  0.481753674f,
+   -0.881303452f,  0.472550765f,
+   -0.886203579f,  0.463296035f,
+   -0.891006524f,  0.453990500f,
+   -0.895711760f,  0.444635179f,
+   -0.900318771f,  0.435231099f,
+   -0.904827052f,  0.425779292f,
+   -0.909236109f,  0.416280792f,
+   -0.913545458f,  0.406736643f,
+   -0.917754626f,  0.397147891f,
+   -0.921863152f,  0.387515586f,
+   -0.925870585f,  0.377840787f,
+   -0.929776486f,  0.368124553f,
+   -0.933580426f,  0.358367950f,
+   -0.937281989f,  0.348572047f,
+   -0.940880769f,  0.338737920f,
+   -0.944376370f,  0.328866647f,
+   -0.947768410f,  0.318959309f,
+   -0.951056516f,  0.309016994f,
+   -0.954240329f,  0.299040792f,
+   -0.957319498f,  0.289031797f,
+   -0.960293686f,  0.278991106f,
+   -0.963162567f,  0.268919821f,
+   -0.965925826f,  0.258819045f,
+   -0.968583161f,  0.248689887f,
+   -0.971134280f,  0.238533458f,
+   -0.973578903f,  0.228350870f,
+   -0.975916762f,  0.218143241f,
+   -0.978147601f,  0.207911691f,
+   -0.980271175f,  0.197657340f,
+   -0.982287251f,  0.187381315f,
+   -0.984195608f,  0.177084740f,
+   -0.985996037f,  0.166768747f,
+   -0.987688341f,  0.156434465f,
+   -0.989272333f,  0.146083029f,
+   -0.990747840f,  0.135715572f,
+   -0.992114701f,  0.125333234f,
+   -0.993372766f,  0.114937150f,
+   -0.994521895f,  0.104528463f,
+   -0.995561965f,  0.094108313f,
+   -0.996492859f,  0.083677843f,
+   -0.997314477f,  0.073238197f,
+   -0.998026728f,  0.062790520f,
+   -0.998629535f,  0.052335956f,
+   -0.999122830f,  0.041875654f,
+   -0.999506560f,  0.031410759f,
+   -0.999780683f,  0.020942420f,
+   -0.999945169f,  0.010471784f,
+   -1.000000000f,  0.000000000f,
+   -0.999945169f, -0.010471784f,
+   -0.999780683f, -0.020942420f,
+   -0.999506560f, -0.031410759f,
+   -0.999122830f, -0.041875654f,
+   -0.998629535f, -0.052335956f,
+   -0.998026728f, -0.062790520f,
+   -0.997314477f, -0.073238197f,
+   -0.996492859f, -0.083677843f,
+   -0.995561965f, -0.094108313f,
+   -0.994521895f, -0.104528463f,
+   -0.993372766f, -0.114937150f,
+   -0.992114701f, -0.125333234f,
+   -0.990747840f, -0.135715572f,
+   -0.989272333f, -0.146083029f,
+   -0.987688341f, -0.156434465f,
+   -0.985996037f, -0.166768747f,
+   -0.984195608f, -0.177084740f,
+   -0.982287251f, -0.187381315f,
+   -0.980271175f, -0.197657340f,
+   -0.978147601f, -0.207911691f,
+   -0.975916762f, -0.218143241f,
+   -0.973578903f, -0.228350870f,
+   -0.971134280f, -0.238533458f,
+   -0.968583161f, -0.248689887f,
+   -0.965925826f, -0.258819045f,
+   -0.963162567f, -0.268919821f,
+   -0.960293686f, -0.278991106f,
+   -0.957319498f, -0.289031797f,
+   -0.954240329f, -0.299040792f,
+   -0.951056516f, -0.309016994f,
+   -0.947768410f, -0.318959309f,
+   -0.944376370f, -0.328866647f,
+   -0.940880769f, -0.338737920f,
+   -0.937281989f, -0.348572047f,
+   -0.933580426f, -0.358367950f,
+   -0.929776486f, -0.368124553f,
+   -0.925870585f, -0.377840787f,
+   -0.921863152f, -0.387515586f,
+   -0.917754626f, -0.397147891f,
+   -0.913545458f, -0.406736643f,
+   -0.909236109f, -0.416280792f,
+   -0.904827052f, -0.425779292f,
+   -0.900318771f, -0.435231099f,
+   -0.895711760f, -0.444635179f,
+   -0.891006524f, -0.453990500f,
+   -0.886203579f, -0.463296035f,
+   -0.881303452f, -0.472550765f,
+   -0.876306680f, -0.481753674f,
+   -0.871213811f, -0.490903754f,
+   -0.866025404f, -0.500000000f,
+   -0.860742027f, -0.509041416f,
+   -0.855364260f, -0.518027009f,
+   -0.849892693f, -0.526955795f,
+   -0.844327926f, -0.535826795f,
+   -0.838670568f, -0.544639035f,
+   -0.832921241f, -0.553391549f,
+   -0.827080574f, -0.562083378f,
+   -0.821149209f, -0.570713568f,
+   -0.815127796f, -0.579281172f,
+   -0.809016994f, -0.587785252f,
+   -0.802817475f, -0.596224875f,
+   -0.796529918f, -0.604599115f,
+   -0.790155012f, -0.612907054f,
+   -0.783693457f, -0.621147780f,
+   -0.777145961f, -0.629320391f,
+   -0.770513243f, -0.637423990f,
+   -0.763796029f, -0.645457688f,
+   -0.756995056f, -0.653420604f,
+   -0.750111070f, -0.661311865f,
+   -0.743144825f, -0.669130606f,
+   -0.736097087f, -0.676875970f,
+   -0.728968627f, -0.684547106f,
+   -0.721760228f, -0.692143174f,
+   -0.714472680f, -0.699663341f,
+   -0.707106781f, -0.707106781f,
+   -0.699663341f, -0.714472680f,
+   -0.692143174f, -0.721760228f,
+   -0.684547106f, -0.728968627f,
+   -0.676875970f, -0.736097087f,
+   -0.669130606f, -0.743144825f,
+   -0.661311865f, -0.750111070f,
+   -0.653420604f, -0.756995056f,
+   -0.645457688f, -0.763796029f,
+   -0.637423990f, -0.770513243f,
+   -0.629320391f, -0.777145961f,
+   -0.621147780f, -0.783693457f,
+   -0.612907054f, -0.790155012f,
+   -0.604599115f, -0.796529918f,
+   -0.596224875f, -0.802817475f,
+   -0.587785252f, -0.809016994f,
+   -0.579281172f, -0.815127796f,
+   -0.570713568f, -0.821149209f,
+   -0.562083378f, -0.827080574f,
+   -0.553391549f, -0.832921241f,
+   -0.544639035f, -0.838670568f,
+   -0.535826795f, -0.844327926f,
+   -0.526955795f, -0.849892693f,
+   -0.518027009f, -0.855364260f,
+   -0.509041416f, -0.860742027f,
+   -0.500000000f, -0.866025404f,
+   -0.490903754f, -0.871213811f,
+   -0.481753674f, -0.876306680f,
+   -0.472550765f, -0.881303452f,
+   -0.463296035f, -0.886203579f,
+   -0.453990500f, -0.891006524f,
+   -0.444635179f, -0.895711760f,
+   -0.435231099f, -0.900318771f,
+   -0.425779292f, -0.904827052f,
+   -0.416280792f, -0.909236109f,
+   -0.406736643f, -0.913545458f,
+   -0.397147891f, -0.917754626f,
+   -0.387515586f, -0.921863152f,
+   -0.377840787f, -0.925870585f,
+   -0.368124553f, -0.929776486f,
+   -0.358367950f, -0.933580426f,
+   -0.348572047f, -0.937281989f,
+   -0.338737920f, -0.940880769f,
+   -0.328866647f, -0.944376370f,
+   -0.318959309f, -0.947768410f,
+   -0.309016994f, -0.951056516f,
+   -0.299040792f, -0.954240329f,
+   -0.289031797f, -0.957319498f,
+   -0.278991106f, -0.960293686f,
+   -0.268919821f, -0.963162567f,
+   -0.258819045f, -0.965925826f,
+   -0.248689887f, -0.968583161f,
+   -0.238533458f, -0.971134280f,
+   -0.228350870f, -0.973578903f,
+   -0.218143241f, -0.975916762f,
+   -0.207911691f, -0.978147601f,
+   -0.197657340f, -0.980271175f,
+   -0.187381315f, -0.982287251f,
+   -0.177084740f, -0.984195608f,
+   -0.166768747f, -0.985996037f,
+   -0.156434465f, -0.987688341f,
+   -0.146083029f, -0.989272333f,
+   -0.135715572f, -0.990747840f,
+   -0.125333234f, -0.992114701f,
+   -0.114937150f, -0.993372766f,
+   -0.104528463f, -0.994521895f,
+   -0.094108313f, -0.995561965f,
+   -0.083677843f, -0.996492859f,
+   -0.073238197f, -0.997314477f,
+   -0.062790520f, -0.998026728f,
+   -0.052335956f, -0.998629535f,
+   -0.041875654f, -0.999122830f,
+   -0.031410759f, -0.999506560f,
+   -0.020942420f, -0.999780683f,
+   -0.010471784f, -0.999945169f,
+   -0.000000000f, -1.000000000f,
+    0.010471784f, -0.999945169f,
+    0.020942420f, -0.999780683f,
+    0.031410759f, -0.999506560f,
+    0.041875654f, -0.999122830f,
+    0.052335956f, -0.998629535f,
+    0.062790520f, -0.998026728f,
+    0.073238197f, -0.997314477f,
+    0.083677843f, -0.996492859f,
+    0.094108313f, -0.995561965f,
+    0.104528463f, -0.994521895f,
+    0.114937150f, -0.993372766f,
+    0.125333234f, -0.992114701f,
+    0.135715572f, -0.990747840f,
+    0.146083029f, -0.989272333f,
+    0.156434465f, -0.987688341f,
+    0.166768747f, -0.985996037f,
+    0.177084740f, -0.984195608f,
+    0.187381315f, -0.982287251f,
+    0.197657340f, -0.980271175f,
+    0.207911691f, -0.978147601f,
+    0.218143241f, -0.975916762f,
+    0.228350870f, -0.973578903f,
+    0.238533458f, -0.971134280f,
+    0.248689887f, -0.968583161f,
+    0.258819045f, -0.965925826f,
+    0.268919821f, -0.963162567f,
+    0.278991106f, -0.960293686f,
+    0.289031797f, -0.957319498f,
+    0.299040792f, -0.954240329f,
+    0.309016994f, -0.951056516f,
+    0.318959309f, -0.947768410f,
+    0.328866647f, -0.944376370f,
+    0.338737920f, -0.940880769f,
+    0.348572047f, -0.937281989f,
+    0.358367950f, -0.933580426f,
+    0.368124553f, -0.929776486f,
+    0.377840787f, -0.925870585f,
+    0.387515586f, -0.921863152f,
+    0.397147891f, -0.917754626f,
+    0.406736643f, -0.913545458f,
+    0.416280792f, -0.909236109f,
+    0.425779292f, -0.904827052f,
+    0.435231099f, -0.900318771f,
+    0.444635179f, -0.895711760f,
+    0.453990500f, -0.891006524f,
+    0.463296035f, -0.886203579f,
+    0.472550765f, -0.881303452f,
+    0.481753674f, -0.876306680f,
+    0.490903754f, -0.871213811f,
+    0.500000000f, -0.866025404f,
+    0.509041416f, -0.860742027f,
+    0.518027009f, -0.855364260f,
+    0.526955795f, -0.849892693f,
+    0.535826795f, -0.844327926f,
+    0.544639035f, -0.838670568f,
+    0.553391549f, -0.832921241f,
+    0.562083378f, -0.827080574f,
+    0.570713568f, -0.821149209f,
+    0.579281172f, -0.815127796f,
+    0.587785252f, -0.809016994f,
+    0.596224875f, -0.802817475f,
+    0.604599115f, -0.796529918f,
+    0.612907054f, -0.790155012f,
+    0.621147780f, -0.783693457f,
+    0.629320391f, -0.777145961f,
+    0.637423990f, -0.770513243f,
+    0.645457688f, -0.763796029f,
+    0.653420604f, -0.756995056f,
+    0.661311865f, -0.750111070f,
+    0.669130606f, -0.743144825f,
+    0.676875970f, -0.736097087f,
+    0.684547106f, -0.728968627f,
+    0.692143174f, -0.721760228f,
+    0.699663341f, -0.714472680f,
+    0.707106781f, -0.707106781f,
+    0.714472680f, -0.699663341f,
+    0.721760228f, -0.692143174f,
+    0.728968627f, -0.684547106f,
+    0.736097087f, -0.676875970f,
+    0.743144825f, -0.669130606f,
+    0.750111070f, -0.661311865f,
+    0.756995056f, -0.653420604f,
+    0.763796029f, -0.645457688f,
+    0.770513243f, -0.637423990f,
+    0.777145961f, -0.629320391f,
+    0.783693457f, -0.621147780f,
+    0.790155012f, -0.612907054f,
+    0.796529918f, -0.604599115f,
+    0.802817475f, -0.596224875f,
+    0.809016994f, -0.587785252f,
+    0.815127796f, -0.579281172f,
+    0.821149209f, -0.570713568f,
+    0.827080574f, -0.562083378f,
+    0.832921241f, -0.553391549f,
+    0.838670568f, -0.544639035f,
+    0.844327926f, -0.535826795f,
+    0.849892693f, -0.526955795f,
+    0.855364260f, -0.518027009f,
+    0.860742027f, -0.509041416f,
+    0.866025404f, -0.500000000f,
+    0.871213811f, -0.490903754f,
+    0.876306680f, -0.481753674f,
+    0.881303452f, -0.472550765f,
+    0.886203579f, -0.463296035f,
+    0.891006524f, -0.453990500f,
+    0.895711760f, -0.444635179f,
+    0.900318771f, -0.435231099f,
+    0.904827052f, -0.425779292f,
+    0.909236109f, -0.416280792f,
+    0.913545458f, -0.406736643f,
+    0.917754626f, -0.397147891f,
+    0.921863152f, -0.387515586f,
+    0.925870585f, -0.377840787f,
+    0.929776486f, -0.368124553f,
+    0.933580426f, -0.358367950f,
+    0.937281989f, -0.348572047f,
+    0.940880769f, -0.338737920f,
+    0.944376370f, -0.328866647f,
+    0.947768410f, -0.318959309f,
+    0.951056516f, -0.309016994f,
+    0.954240329f, -0.299040792f,
+    0.957319498f, -0.289031797f,
+    0.960293686f, -0.278991106f,
+    0.963162567f, -0.268919821f,
+    0.965925826f, -0.258819045f,
+    0.968583161f, -0.248689887f,
+    0.971134280f, -0.238533458f,
+    0.973578903f, -0.228350870f,
+    0.975916762f, -0.218143241f,
+    0.978147601f, -0.207911691f,
+    0.980271175f, -0.197657340f,
+    0.982287251f, -0.187381315f,
+    0.984195608f, -0.177084740f,
+    0.985996037f, -0.166768747f,
+    0.987688341f, -0.156434465f,
+    0.989272333f, -0.146083029f,
+    0.990747840f, -0.135715572f,
+    0.992114701f, -0.125333234f,
+    0.993372766f, -0.114937150f,
+    0.994521895f, -0.104528463f,
+    0.995561965f, -0.094108313f,
+    0.996492859f, -0.083677843f,
+    0.997314477f, -0.073238197f,
+    0.998026728f, -0.062790520f,
+    0.998629535f, -0.052335956f,
+    0.999122830f, -0.041875654f,
+    0.999506560f, -0.031410759f,
+    0.999780683f, -0.020942420f,
+    0.999945169f, -0.010471784f
+};
+#endif
+
+/**    
+* \par    
+* Example code for Floating-point Twiddle factors Generation:    
+* \par    
+* <pre>for(i = 0; i< N/; i++)    
+* {    
+*	twiddleCoef[2*i]= cos(i * 2*PI/(float)N);    
+*	twiddleCoef[2*i+1]= sin(i * 2*PI/(float)N);    
+* } </pre>    
+* \par    
+* where N = 768	and PI = 3.14159265358979    
+* \par    
+* Cos and Sin values are in interleaved fashion    
+*     
+*/
+#if defined(ARM_TABLE_FFT_F32_768)
+const float32_t twiddleCoef_768[1536] ARM_DSP_TABLE_ATTR = {
+    1.000000000f,  0.000000000f,
+    0.999966534f,  0.008181140f,
+    0.999866138f,  0.016361732f,
+    0.999698819f,  0.024541229f,
+    0.999464587f,  0.032719083f,
+    0.999163460f,  0.040894747f,
+    0.998795456f,  0.049067674f,
+    0.998360601f,  0.057237317f,
+    0.997858923f,  0.065403129f,
+    0.997290457f,  0.073564564f,
+    0.996655239f,  0.081721074f,
+    0.995953314f,  0.089872115f,
+    0.995184727f,  0.098017140f,
+    0.994349530f,  0.106155605f,
+    0.993447779f,  0.114286965f,
+    0.992479535f,  0.122410675f,
+    0.991444861f,  0.130526192f,
+    0.990343829f,  0.138632973f,
+    0.989176510f,  0.146730474f,
+    0.987942984f,  0.154818155f,
+    0.986643332f,  0.162895473f,
+    0.985277642f,  0.170961889f,
+    0.983846006f,  0.179016861f,
+    0.982348519f,  0.187059852f,
+    0.980785280f,  0.195090322f,
+    0.979156396f,  0.203107734f,
+    0.977461975f,  0.211111552f,
+    0.975702130f,  0.219101240f,
+    0.973876979f,  0.227076263f,
+    0.971986645f,  0.235036087f,
+    0.970031253f,  0.242980180f,
+    0.968010935f,  0.250908009f,
+    0.965925826f,  0.258819045f,
+    0.963776066f,  0.266712757f,
+    0.961561798f,  0.274588618f,
+    0.959283170f,  0.282446100f,
+    0.956940336f,  0.290284677f,
+    0.954533451f,  0.298103825f,
+    0.952062678f,  0.305903020f,
+    0.949528181f,  0.313681740f,
+    0.946930129f,  0.321439465f,
+    0.944268698f,  0.329175676f,
+    0.941544065f,  0.336889853f,
+    0.938756412f,  0.344581482f,
+    0.935905927f,  0.352250048f,
+    0.932992799f,  0.359895037f,
+    0.930017224f,  0.367515937f,
+    0.926979400f,  0.375112238f,
+    0.923879533f,  0.382683432f,
+    0.920717827f,  0.390229013f,
+    0.917494496f,  0.397748475f,
+    0.914209756f,  0.405241314f,
+    0.910863825f,  0.412707030f,
+    0.907456928f,  0.420145122f,
+    0.903989293f,  0.427555093f,
+    0.900461152f,  0.434936447f,
+    0.896872742f,  0.442288690f,
+    0.893224301f,  0.449611330f,
+    0.889516075f,  0.456903876f,
+    0.885748312f,  0.464165840f,
+    0.881921264f,  0.471396737f,
+    0.878035187f,  0.478596082f,
+    0.874090342f,  0.485763394f,
+    0.870086991f,  0.492898192f,
+    0.866025404f,  0.500000000f,
+    0.861905852f,  0.507068342f,
+    0.857728610f,  0.514102744f,
+    0.853493959f,  0.521102737f,
+    0.849202182f,  0.528067851f,
+    0.844853565f,  0.534997620f,
+    0.840448401f,  0.541891581f,
+    0.835986984f,  0.548749271f,
+    0.831469612f,  0.555570233f,
+    0.826896589f,  0.562354009f,
+    0.822268219f,  0.569100146f,
+    0.817584813f,  0.575808191f,
+    0.812846685f,  0.582477697f,
+    0.808054150f,  0.589108216f,
+    0.803207531f,  0.595699304f,
+    0.798307152f,  0.602250522f,
+    0.793353340f,  0.608761429f,
+    0.788346428f,  0.615231591f,
+    0.783286749f,  0.621660573f,
+    0.778174644f,  0.628047947f,
+    0.773010453f,  0.634393284f,
+    0.767794524f,  0.640696160f,
+    0.762527204f,  0.646956153f,
+    0.757208847f,  0.653172843f,
+    0.751839807f,  0.659345815f,
+    0.746420446f,  0.665474656f,
+    0.740951125f,  0.671558955f,
+    0.735432211f,  0.677598305f,
+    0.729864073f,  0.683592302f,
+    0.724247083f,  0.689540545f,
+    0.718581618f,  0.695442635f,
+    0.712868056f,  0.701298178f,
+    0.707106781f,  0.707106781f,
+    0.701298178f,  0.712868056f,
+    0.695442635f,  0.718581618f,
+    0.689540545f,  0.724247083f,
+    0.683592302f,  0.729864073f,
+    0.677598305f,  0.735432211f,
+    0.671558955f,  0.740951125f,
+    0.665474656f,  0.746420446f,
+    0.659345815f,  0.751839807f,
+    0.653172843f,  0.757208847f,
+    0.646956153f,  0.762527204f,
+    0.640696160f,  0.767794524f,
+    0.634393284f,  0.773010453f,
+    0.628047947f,  0.778174644f,
+    0.621660573f,  0.783286749f,
+    0.615231591f,  0.788346428f,
+    0.608761429f,  0.793353340f,
+    0.602250522f,  0.798307152f,
+    0.595699304f,  0.803207531f,
+    0.589108216f,  0.808054150f,
+    0.582477697f,  0.812846685f,
+    0.575808191f,  0.817584813f,
+    0.569100146f,  0.822268219f,
+    0.562354009f,  0.826896589f,
+    0.555570233f,  0.831469612f,
+    0.548749271f,  0.835986984f,
+    0.541891581f,  0.840448401f,
+    0.534997620f,  0.844853565f,
+    0.528067851f,  0.849202182f,
+    0.521102737f,  0.853493959f,
+    0.514102744f,  0.857728610f,
+    0.507068342f,  0.861905852f,
+    0.500000000f,  0.866025404f,
+    0.492898192f,  0.870086991f,
+    0.485763394f,  0.874090342f,
+    0.478596082f,  0.878035187f,
+    0.471396737f,  0.881921264f,
+    0.464165840f,  0.885748312f,
+    0.456903876f,  0.889516075f,
+    0.449611330f,  0.893224301f,
+    0.442288690f,  0.896872742f,
+    0.434936447f,  0.900461152f,
+    0.427555093f,  0.903989293f,
+    0.420145122f,  0.907456928f,
+    0.412707030f,  0.910863825f,
+    0.405241314f,  0.914209756f,
+    0.397748475f,  0.917494496f,
+    0.390229013f,  0.920717827f,
+    0.382683432f,  0.923879533f,
+    0.375112238f,  0.926979400f,
+    0.367515937f,  0.930017224f,
+    0.359895037f,  0.932992799f,
+    0.352250048f,  0.935905927f,
+    0.344581482f,  0.938756412f,
+    0.336889853f,  0.941544065f,
+    0.329175676f,  0.944268698f,
+    0.321439465f,  0.946930129f,
+    0.313681740f,  0.949528181f,
+    0.305903020f,  0.952062678f,
+    0.298103825f,  0.954533451f,
+    0.290284677f,  0.956940336f,
+    0.282446100f,  0.959283170f,
+    0.274588618f,  0.961561798f,
+    0.266712757f,  0.963776066f,
+    0.258819045f,  0.965925826f,
+    0.250908009f,  0.968010935f,
+    0.242980180f,  0.970031253f,
+    0.235036087f,  0.971986645f,
+    0.227076263f,  0.973876979f,
+    0.219101240f,  0.975702130f,
+    0.211111552f,  0.977461975f,
+    0.203107734f,  0.979156396f,
+    0.195090322f,  0.980785280f,
+    0.187059852f,  0.982348519f,
+    0.179016861f,  0.983846006f,
+    0.170961889f,  0.985277642f,
+    0.162895473f,  0.986643332f,
+    0.154818155f,  0.987942984f,
+    0.146730474f,  0.989176510f,
+    0.138632973f,  0.990343829f,
+    0.130526192f,  0.991444861f,
+    0.122410675f,  0.992479535f,
+    0.114286965f,  0.993447779f,
+    0.106155605f,  0.994349530f,
+    0.098017140f,  0.995184727f,
+    0.089872115f,  0.995953314f,
+    0.081721074f,  0.996655239f,
+    0.073564564f,  0.997290457f,
+    0.065403129f,  0.997858923f,
+    0.057237317f,  0.998360601f,
+    0.049067674f,  0.998795456f,
+    0.040894747f,  0.999163460f,
+    0.032719083f,  0.999464587f,
+    0.024541229f,  0.999698819f,
+    0.016361732f,  0.999866138f,
+    0.008181140f,  0.999966534f,
+    0.000000000f,  1.000000000f,
+   -0.008181140f,  0.999966534f,
+   -0.016361732f,  0.999866138f,
+   -0.024541229f,  0.999698819f,
+   -0.032719083f,  0.999464587f,
+   -0.040894747f,  0.999163460f,
+   -0.049067674f,  0.998795456f,
+   -0.057237317f,  0.998360601f,
+   -0.065403129f,  0.997858923f,
+   -0.073564564f,  0.997290457f,
+   -0.081721074f,  0.996655239f,
+   -0.089872115f,  0.995953314f,
+   -0.098017140f,  0.995184727f,
+   -0.106155605f,  0.994349530f,
+   -0.114286965f,  0.993447779f,
+   -0.122410675f,  0.992479535f,
+   -0.130526192f,  0.991444861f,
+   -0.138632973f,  0.990343829f,
+   -0.146730474f,  0.989176510f,
+   -0.154818155f,  0.987942984f,
+   -0.162895473f,  0.986643332f,
+   -0.170961889f,  0.985277642f,
+   -0.179016861f,  0.983846006f,
+   -0.187059852f,  0.982348519f,
+   -0.195090322f,  0.980785280f,
+   -0.203107734f,  0.979156396f,
+   -0.211111552f,  0.977461975f,
+   -0.219101240f,  0.975702130f,
+   -0.227076263f,  0.973876979f,
+   -0.235036087f,  0.971986645f,
+   -0.242980180f,  0.970031253f,
+   -0.250908009f,  0.968010935f,
+   -0.258819045f,  0.965925826f,
+   -0.266712757f,  0.963776066f,
+   -0.274588618f,  0.961561798f,
+   -0.282446100f,  0.959283170f,
+   -0.290284677f,  0.956940336f,
+   -0.298103825f,  0.954533451f,
+   -0.305903020f,  0.952062678f,
+   -0.313681740f,  0.949528181f,
+   -0.321439465f,  0.946930129f,
+   -0.329175676f,  0.944268698f,
+   -0.336889853f,  0.941544065f,
+   -0.344581482f,  0.938756412f,
+   -0.352250048f,  0.935905927f,
+   -0.359895037f,  0.932992799f,
+   -0.367515937f,  0.930017224f,
+   -0.375112238f,  0.926979400f,
+   -0.382683432f,  0.923879533f,
+   -0.390229013f,  0.920717827f,
+   -0.397748475f,  0.917494496f,
+   -0.405241314f,  0.914209756f,
+   -0.412707030f,  0.910863825f,
+   -0.420145122f,  0.907456928f,
+   -0.427555093f,  0.903989293f,
+   -0.434936447f,  0.900461152f,
+   -0.442288690f,  0.896872742f,
+   -0.449611330f,  0.893224301f,
+   -0.456903876f,  0.889516075f,
+   -0.464165840f,  0.885748312f,
+   -0.471396737f,  0.881921264f,
+   -0.478596082f,  0.878035187f,
+   -0.485763394f,  0.874090342f,
+   -0.492898192f,  0.870086991f,
+   -0.500000000f,  0.866025404f,
+   -0.507068342f,  0.861905852f,
+   -0.514102744f,  0.857728610f,
+   -0.521102737f,  0.853493959f,
+   -0.528067851f,  0.849202182f,
+   -0.534997620f,  0.844853565f,
+   -0.541891581f,  0.840448401f,
+   -0.548749271f,  0.835986984f,
+   -0.555570233f,  0.831469612f,
+   -0.562354009f,  0.826896589f,
+   -0.569100146f,  0.822268219f,
+   -0.575808191f,  0.817584813f,
+   -0.582477697f,  0.812846685f,
+   -0.589108216f,  0.808054150f,
+   -0.595699304f,  0.803207531f,
+   -0.602250522f,  0.798307152f,
+   -0.608761429f,  0.793353340f,
+   -0.615231591f,  0.788346428f,
+   -0.621660573f,  0.783286749f,
+   -0.628047947f,  0.778174644f,
+   -0.634393284f,  0.773010453f,
+   -0.640696160f,  0.767794524f,
+   -0.646956153f,  0.762527204f,
+   -0.653172843f,  0.757208847f,
+   -0.659345815f,  0.751839807f,
+   -0.665474656f,  0.746420446f,
+   -0.671558955f,  0.740951125f,
+   -0.677598305f,  0.735432211f,
+   -0.683592302f,  0.729864073f,
+   -0.689540545f,  0.724247083f,
+   -0.695442635f,  0.718581618f,
+   -0.701298178f,  0.712868056f,
+   -0.707106781f,  0.707106781f,
+   -0.712868056f,  0.701298178f,
+   -0.718581618f,  0.695442635f,
+   -0.724247083f,  0.689540545f,
+   -0.729864073f,  0.683592302f,
+   -0.735432211f,  0.677598305f,
+   -0.740951125f,  0.671558955f,
+   -0.746420446f,  0.665474656f,
+   -0.751839807f,  0.659345815f,
+   -0.757208847f,  0.653172843f,
+   -0.762527204f,  0.646956153f,
+   -0.767794524f,  0.640696160f,
+   -0.773010453f,  0.634393284f,
+   -0.778174644f,  0.628047947f,
+   -0.783286749f,  0.621660573f,
+   -0.788346428f,  0.615231591f,
+   -0.793353340f,  0.608761429f,
+   -0.798307152f,  0.602250522f,
+   -0.803207531f,  0.595699304f,
+   -0.808054150f,  0.589108216f,
+   -0.812846685f,  0.582477697f,
+   -0.817584813f,  0.575808191f,
+   -0.822268219f,  0.569100146f,
+   -0.826896589f,  0.562354009f,
+   -0.831469612f,  0.555570233f,
+   -0.835986984f,  0.548749271f,
+   -0.840448401f,  0.541891581f,
+   -0.844853565f,  0.534997620f,
+   -0.849202182f,  0.528067851f,
+   -0.853493959f,  0.521102737f,
+   -0.857728610f,  0.514102744f,
+   -0.861905852f,  0.507068342f,
+   -0.866025404f,  0.500000000f,
+   -0.870086991f,  0.492898192f,
+   -0.874090342f,  0.485763394f,
+   -0.878035187f,  0.478596082f,
+   -0.881921264f,  0.471396737f,
+   -0.885748312f,  0.464165840f,
+   -0.889516075f,  0.456903876f,
+   -0.893224301f,  0.449611330f,
+   -0.896872742f,  0.442288690f,
+   -0.900461152f,  0.434936447f,
+   -0.903989293f,  0.427555093f,
+   -0.907456928f,  0.420145122f,
+   -0.910863825f,  0.412707030f,
+   -0.914209756f,  0.405241314f,
+   -0.917494496f,  0.397748475f,
+   -0.920717827f,  0.390229013f,
+   -0.923879533f,  0.382683432f,
+   -0.926979400f,  0.375112238f,
+   -0.930017224f,  0.367515937f,
+   -0.932992799f,  0.359895037f,
+   -0.935905927f,  0.352250048f,
+   -0.938756412f,  0.344581482f,
+   -0.941544065f,  0.336889853f,
+   -0.944268698f,  0.329175676f,
+   -0.946930129f,  0.321439465f,
+   -0.949528181f,  0.313681740f,
+   -0.952062678f,  0.305903020f,
+   -0.954533451f,  0.298103825f,
+   -0.956940336f,  0.290284677f,
+   -0.959283170f,  0.282446100f,
+   -0.961561798f,  0.274588618f,
+   -0.963776066f,  0.266712757f,
+   -0.965925826f,  0.258819045f,
+   -0.968010935f,  0.250908009f,
+   -0.970031253f,  0.242980180f,
+   -0.971986645f,  0.235036087f,
+   -0.973876979f,  0.227076263f,
+   -0.975702130f,  0.219101240f,
+   -0.977461975f,  0.211111552f,
+   -0.979156396f,  0.203107734f,
+   -0.980785280f,  0.195090322f,
+   -0.982348519f,  0.187059852f,
+   -0.983846006f,  0.179016861f,
+   -0.985277642f,  0.170961889f,
+   -0.986643332f,  0.162895473f,
+   -0.987942984f,  0.154818155f,
+   -0.989176510f,  0.146730474f,
+   -0.990343829f,  0.138632973f,
+   -0.991444861f,  0.130526192f,
+   -0.992479535f,  0.122410675f,
+   -0.993447779f,  0.114286965f,
+   -0.994349530f,  0.106155605f,
+   -0.995184727f,  0.098017140f,
+   -0.995953314f,  0.089872115f,
+   -0.996655239f,  0.081721074f,
+   -0.997290457f,  0.073564564f,
+   -0.997858923f,  0.065403129f,
+   -0.998360601f,  0.057237317f,
+   -0.998795456f,  0.049067674f,
+   -0.999163460f,  0.040894747f,
+   -0.999464587f,  0.032719083f,
+   -0.999698819f,  0.024541229f,
+   -0.999866138f,  0.016361732f,
+   -0.999966534f,  0.008181140f,
+   -1.000000000f,  0.000000000f,
+   -0.999966534f, -0.008181140f,
+   -0.999866138f, -0.016361732f,
+   -0.999698819f, -0.024541229f,
+   -0.999464587f, -0.032719083f,
+   -0.999163460f, -0.040894747f,
+   -0.998795456f, -0.049067674f,
+   -0.998360601f, -0.057237317f,
+   -0.997858923f, -0.065403129f,
+   -0.997290457f, -0.073564564f,
+   -0.996655239f, -0.081721074f,
+   -0.995953314f, -0.089872115f,
+   -0.995184727f, -0.098017140f,
+   -0.994349530f, -0.106155605f,
+   -0.993447779f, -0.114286965f,
+   -0.992479535f, -0.122410675f,
+   -0.991444861f, -0.130526192f,
+   -0.990343829f, -0.138632973f,
+   -0.989176510f, -0.146730474f,
+   -0.987942984f, -0.154818155f,
+   -0.986643332f, -0.162895473f,
+   -0.985277642f, -0.170961889f,
+   -0.983846006f, -0.179016861f,
+   -0.982348519f, -0.187059852f,
+   -0.980785280f, -0.195090322f,
+   -0.979156396f, -0.203107734f,
+   -0.977461975f, -0.211111552f,
+   -0.975702130f, -0.219101240f,
+   -0.973876979f, -0.227076263f,
+   -0.971986645f, -0.235036087f,
+   -0.970031253f, -0.242980180f,
+   -0.968010935f, -0.250908009f,
+   -0.965925826f, -0.258819045f,
+   -0.963776066f, -0.266712757f,
+   -0.961561798f, -0.274588618f,
+   -0.959283170f, -0.282446100f,
+   -0.956940336f, -0.290284677f,
+   -0.954533451f, -0.298103825f,
+   -0.952062678f, -0.305903020f,
+   -0.949528181f, -0.313681740f,
+   -0.946930129f, -0.321439465f,
+   -0.944268698f, -0.329175676f,
+   -0.941544065f, -0.336889853f,
+   -0.938756412f, -0.344581482f,
+   -0.935905927f, -0.352250048f,
+   -0.932992799f, -0.359895037f,
+   -0.930017224f, -0.367515937f,
+   -0.926979400f, -0.375112238f,
+   -0.923879533f, -0.382683432f,
+   -0.920717827f, -0.390229013f,
+   -0.917494496f, -0.397748475f,
+   -0.914209756f, -0.405241314f,
+   -0.910863825f, -0.412707030f,
+   -0.907456928f, -0.420145122f,
+   -0.903989293f, -0.427555093f,
+   -0.900461152f, -0.434936447f,
+   -0.896872742f, -0.442288690f,
+   -0.893224301f, -0.449611330f,
+   -0.889516075f, -0.456903876f,
+   -0.885748312f, -0.464165840f,
+   -0.881921264f, -0.471396737f,
+   -0.878035187f, -0.478596082f,
+   -0.874090342f, -0.485763394f,
+   -0.870086991f, -0.492898192f,
+   -0.866025404f, -0.500000000f,
+   -0.861905852f, -0.507068342f,
+   -0.857728610f, -0.514102744f,
+   -0.853493959f, -0.521102737f,
+   -0.849202182f, -0.528067851f,
+   -0.844853565f, -0.534997620f,
+   -0.840448401f, -0.541891581f,
+   -0.835986984f, -0.548749271f,
+   -0.831469612f, -0.555570233f,
+   -0.826896589f, -0.562354009f,
+   -0.822268219f, -0.569100146f,
+   -0.817584813f, -0.575808191f,
+   -0.812846685f, -0.582477697f,
+   -0.808054150f, -0.589108216f,
+   -0.803207531f, -0.595699304f,
+   -0.798307152f, -0.602250522f,
+   -0.793353340f, -0.608761429f,
+   -0.788346428f, -0.615231591f,
+   -0.783286749f, -0.621660573f,
+   -0.778174644f, -0.628047947f,
+   -0.773010453f, -0.634393284f,
+   -0.767794524f, -0.640696160f,
+   -0.762527204f, -0.646956153f,
+   -0.757208847f, -0.653172843f,
+   -0.751839807f, -0.659345815f,
+   -0.746420446f, -0.665474656f,
+   -0.740951125f, -0.671558955f,
+   -0.735432211f, -0.677598305f,
+   -0.729864073f, -0.683592302f,
+   -0.724247083f, -0.689540545f,
+   -0.718581618f, -0.695442635f,
+   -0.712868056f, -0.701298178f,
+   -0.707106781f, -0.707106781f,
+   -0.701298178f, -0.712868056f,
+   -0.695442635f, -0.718581618f,
+   -0.689540545f, -0.724247083f,
+   -0.683592302f, -0.729864073f,
+   -0.677598305f, -0.735432211f,
+   -0.671558955f, -0.740951125f,
+   -0.665474656f, -0.746420446f,
+   -0.659345815f, -0.751839807f,
+   -0.653172843f, -0.757208847f,
+   -0.646956153f, -0.762527204f,
+   -0.640696160f, -0.767794524f,
+   -0.634393284f, -0.773010453f,
+   -0.628047947f, -0.778174644f,
+   -0.621660573f, -0.783286749f,
+   -0.615231591f, -0.788346428f,
+   -0.608761429f, -0.793353340f,
+   -0.602250522f, -0.798307152f,
+   -0.595699304f, -0.803207531f,
+   -0.589108216f, -0.808054150f,
+   -0.582477697f, -0.812846685f,
+   -0.575808191f, -0.817584813f,
+   -0.569100146f, -0.822268219f,
+   -0.562354009f, -0.826896589f,
+   -0.555570233f, -0.831469612f,
+   -0.548749271f, -0.835986984f,
+   -0.541891581f, -0.840448401f,
+   -0.534997620f, -0.844853565f,
+   -0.528067851f, -0.849202182f,
+   -0.521102737f, -0.853493959f,
+   -0.514102744f, -0.857728610f,
+   -0.507068342f, -0.861905852f,
+   -0.500000000f, -0.866025404f,
+   -0.492898192f, -0.870086991f,
+   -0.485763394f, -0.874090342f,
+   -0.478596082f, -0.878035187f,
+   -0.471396737f, -0.881921264f,
+   -0.464165840f, -0.885748312f,
+   -0.456903876f, -0.889516075f,
+   -0.449611330f, -0.893224301f,
+   -0.442288690f, -0.896872742f,
+   -0.434936447f, -0.900461152f,
+   -0.427555093f, -0.903989293f,
+   -0.420145122f, -0.907456928f,
+   -0.412707030f, -0.910863825f,
+   -0.405241314f, -0.914209756f,
+   -0.397748475f, -0.917494496f,
+   -0.390229013f, -0.920717827f,
+   -0.382683432f, -0.923879533f,
+   -0.375112238f, -0.926979400f,
+   -0.367515937f, -0.930017224f,
+   -0.359895037f, -0.932992799f,
+   -0.352250048f, -0.935905927f,
+   -0.344581482f, -0.938756412f,
+   -0.336889853f, -0.941544065f,
+   -0.329175676f, -0.944268698f,
+   -0.321439465f, -0.946930129f,
+   -0.313681740f, -0.949528181f,
+   -0.305903020f, -0.952062678f,
+   -0.298103825f, -0.954533451f,
+   -0.290284677f, -0.956940336f,
+   -0.282446100f, -0.959283170f,
+   -0.274588618f, -0.961561798f,
+   -0.266712757f, -0.963776066f,
+   -0.258819045f, -0.965925826f,
+   -0.250908009f, -0.968010935f,
+   -0.242980180f, -0.970031253f,
+   -0.235036087f, -0.971986645f,
+   -0.227076263f, -0.973876979f,
+   -0.219101240f, -0.975702130f,
+   -0.211111552f, -0.977461975f,
+   -0.203107734f, -0.979156396f,
+   -0.195090322f, -0.980785280f,
+   -0.187059852f, -0.982348519f,
+   -0.179016861f, -0.983846006f,
+   -0.170961889f, -0.985277642f,
+   -0.162895473f, -0.986643332f,
+   -0.154818155f, -0.987942984f,
+   -0.146730474f, -0.989176510f,
+   -0.138632973f, -0.990343829f,
+   -0.130526192f, -0.991444861f,
+   -0.122410675f, -0.992479535f,
+   -0.114286965f, -0.993447779f,
+   -0.106155605f, -0.994349530f,
+   -0.098017140f, -0.995184727f,
+   -0.089872115f, -0.995953314f,
+   -0.081721074f, -0.996655239f,
+   -0.073564564f, -0.997290457f,
+   -0.065403129f, -0.997858923f,
+   -0.057237317f, -0.998360601f,
+   -0.049067674f, -0.998795456f,
+   -0.040894747f, -0.999163460f,
+   -0.032719083f, -0.999464587f,
+   -0.024541229f, -0.999698819f,
+   -0.016361732f, -0.999866138f,
+   -0.008181140f, -0.999966534f,
+   -0.000000000f, -1.000000000f,
+    0.008181140f, -0.999966534f,
+    0.016361732f, -0.999866138f,
+    0.024541229f, -0.999698819f,
+    0.032719083f, -0.999464587f,
+    0.040894747f, -0.999163460f,
+    0.049067674f, -0.998795456f,
+    0.057237317f, -0.998360601f,
+    0.065403129f, -0.997858923f,
+    0.073564564f, -0.997290457f,
+    0.081721074f, -0.996655239f,
+    0.089872115f, -0.995953314f,
+    0.098017140f, -0.995184727f,
+    0.106155605f, -0.994349530f,
+    0.114286965f, -0.993447779f,
+    0.122410675f, -0.992479535f,
+    0.130526192f, -0.991444861f,
+    0.138632973f, -0.990343829f,
+    0.146730474f, -0.989176510f,
+    0.154818155f, -0.987942984f,
+    0.162895473f, -0.986643332f,
+    0.170961889f, -0.985277642f,
+    0.179016861f, -0.983846006f,
+    0.187059852f, -0.982348519f,
+    0.195090322f, -0.980785280f,
+    0.203107734f, -0.979156396f,
+    0.211111552f, -0.977461975f,
+    0.219101240f, -0.975702130f,
+    0.227076263f, -0.973876979f,
+    0.235036087f, -0.971986645f,
+    0.242980180f, -0.970031253f,
+    0.250908009f, -0.968010935f,
+    0.258819045f, -0.965925826f,
+    0.266712757f, -0.963776066f,
+    0.274588618f, -0.961561798f,
+    0.282446100f, -0.959283170f,
+    0.290284677f, -0.956940336f,
+    0.298103825f, -0.954533451f,
+    0.305903020f, -0.952062678f,
+    0.313681740f, -0.949528181f,
+    0.321439465f, -0.946930129f,
+    0.329175676f, -0.944268698f,
+    0.336889853f, -0.941544065f,
+    0.344581482f, -0.938756412f,
+    0.352250048f, -0.935905927f,
+    0.359895037f, -0.932992799f,
+    0.367515937f, -0.930017224f,
+    0.375112238f, -0.926979400f,
+    0.382683432f, -0.923879533f,
+    0.390229013f, -0.920717827f,
+    0.397748475f, -0.917494496f,
+    0.405241314f, -0.914209756f,
+    0.412707030f, -0.910863825f,
+    0.420145122f, -0.907456928f,
+    0.427555093f, -0.903989293f,
+    0.434936447f, -0.900461152f,
+    0.442288690f, -0.896872742f,
+    0.449611330f, -0.893224301f,
+    0.456903876f, -0.889516075f,
+    0.464165840f, -0.885748312f,
+    0.471396737f, -0.881921264f,
+    0.478596082f, -0.878035187f,
+    0.485763394f, -0.874090342f,
+    0.492898192f, -0.870086991f,
+    0.500000000f, -0.866025404f,
+    0.507068342f, -0.861905852f,
+    0.514102744f, -0.857728610f,
+    0.521102737f, -0.853493959f,
+    0.528067851f, -0.849202182f,
+    0.534997620f, -0.844853565f,
+    0.541891581f, -0.840448401f,
+    0.548749271f, -0.835986984f,
+    0.555570233f, -0.831469612f,
+    0.562354009f, -0.826896589f,
+    0.569100146f, -0.822268219f,
+    0.575808191f, -0.817584813f,
+    0.582477697f, -0.812846685f,
+    0.589108216f, -0.808054150f,
+    0.595699304f, -0.803207531f,
+    0.602250522f, -0.798307152f,
+    0.608761429f, -0.793353340f,
+    0.615231591f, -0.788346428f,
+    0.621660573f, -0.783286749f,
+    0.628047947f, -0.778174644f,
+    0.634393284f, -0.773010453f,
+    0.640696160f, -0.767794524f,
+    0.646956153f, -0.762527204f,
+    0.653172843f, -0.757208847f,
+    0.659345815f, -0.751839807f,
+    0.665474656f, -0.746420446f,
+    0.671558955f, -0.740951125f,
+    0.677598305f, -0.735432211f,
+    0.683592302f, -0.729864073f,
+    0.689540545f, -0.724247083f,
+    0.695442635f, -0.718581618f,
+    0.701298178f, -0.712868056f,
+    0.707106781f, -0.707106781f,
+    0.712868056f, -0.701298178f,
+    0.718581618f, -0.695442635f,
+    0.724247083f, -0.689540545f,
+    0.729864073f, -0.683592302f,
+    0.735432211f, -0.677598305f,
+    0.740951125f, -0.671558955f,
+    0.746420446f, -0.665474656f,
+    0.751839807f, -0.659345815f,
+    0.757208847f, -0.653172843f,
+    0.762527204f, -0.646956153f,
+    0.767794524f, -0.640696160f,
+    0.773010453f, -0.634393284f,
+    0.778174644f, -0.628047947f,
+    0.783286749f, -0.621660573f,
+    0.788346428f, -0.615231591f,
+    0.793353340f, -0.608761429f,
+    0.798307152f, -0.602250522f,
+    0.803207531f, -0.595699304f,
+    0.808054150f, -0.589108216f,
+    0.812846685f, -0.582477697f,
+    0.817584813f, -0.575808191f,
+    0.822268219f, -0.569100146f,
+    0.826896589f, -0.562354009f,
+    0.831469612f, -0.555570233f,
+    0.835986984f, -0.548749271f,
+    0.840448401f, -0.541891581f,
+    0.844853565f, -0.534997620f,
+    0.849202182f, -0.528067851f,
+    0.853493959f, -0.521102737f,
+    0.857728610f, -0.514102744f,
+    0.861905852f, -0.507068342f,
+    0.866025404f, -0.500000000f,
+    0.870086991f, -0.492898192f,
+    0.874090342f, -0.485763394f,
+    0.878035187f, -0.478596082f,
+    0.881921264f, -0.471396737f,
+    0.885748312f, -0.464165840f,
+    0.889516075f, -0.456903876f,
+    0.893224301f, -0.449611330f,
+    0.896872742f, -0.442288690f,
+    0.900461152f, -0.434936447f,
+    0.903989293f, -0.427555093f,
+    0.907456928f, -0.420145122f,
+    0.910863825f, -0.412707030f,
+    0.914209756f, -0.405241314f,
+    0.917494496f, -0.397748475f,
+    0.920717827f, -0.390229013f,
+    0.923879533f, -0.382683432f,
+    0.926979400f, -0.375112238f,
+    0.930017224f, -0.367515937f,
+    0.932992799f, -0.359895037f,
+    0.935905927f, -0.352250048f,
+    0.938756412f, -0.344581482f,
+    0.941544065f, -0.336889853f,
+    0.944268698f, -0.329175676f,
+    0.946930129f, -0.321439465f,
+    0.949528181f, -0.313681740f,
+    0.952062678f, -0.305903020f,
+    0.954533451f, -0.298103825f,
+    0.956940336f, -0.290284677f,
+    0.959283170f, -0.282446100f,
+    0.961561798f, -0.274588618f,
+    0.963776066f, -0.266712757f,
+    0.965925826f, -0.258819045f,
+    0.968010935f, -0.250908009f,
+    0.970031253f, -0.242980180f,
+    0.971986645f, -0.235036087f,
+    0.973876979f, -0.227076263f,
+    0.975702130f, -0.219101240f,
+    0.977461975f, -0.211111552f,
+    0.979156396f, -0.203107734f,
+    0.980785280f, -0.195090322f,
+    0.982348519f, -0.187059852f,
+    0.983846006f, -0.179016861f,
+    0.985277642f, -0.170961889f,
+    0.986643332f, -0.162895473f,
+    0.987942984f, -0.154818155f,
+    0.989176510f, -0.146730474f,
+    0.990343829f, -0.138632973f,
+    0.991444861f, -0.130526192f,
+    0.992479535f, -0.122410675f,
+    0.993447779f, -0.114286965f,
+    0.994349530f, -0.106155605f,
+    0.995184727f, -0.098017140f,
+    0.995953314f, -0.089872115f,
+    0.996655239f, -0.081721074f,
+    0.997290457f, -0.073564564f,
+    0.997858923f, -0.065403129f,
+    0.998360601f, -0.057237317f,
+    0.998795456f, -0.049067674f,
+    0.999163460f, -0.040894747f,
+    0.999464587f, -0.032719083f,
+    0.999698819f, -0.024541229f,
+    0.999866138f, -0.016361732f,
+    0.999966534f, -0.008181140f
+};
+#endif
+
+/**    
+* \par    
+* Example code for Floating-point Twiddle factors Generation:    
+* \par    
+* <pre>for(i = 0; i< N/; i++)    
+* {    
+*	twiddleCoef[2*i]= cos(i * 2*PI/(float)N);    
+*	twiddleCoef[2*i+1]= sin(i * 2*PI/(float)N);    
+* } </pre>    
+* \par    
+* where N = 1000	and PI = 3.14159265358979    
+* \par    
+* Cos and Sin values are in interleaved fashion    
+*     
+*/
+#if defined(ARM_TABLE_FFT_F32_1000)
+const float32_t twiddleCoef_1000[2000] ARM_DSP_TABLE_ATTR = {
+    1.000000000f,  0.000000000f,
+    0.999980261f,  0.006283144f,
+    0.999921044f,  0.012566040f,
+    0.999822352f,  0.018848440f,
+    0.999684189f,  0.025130095f,
+    0.999506560f,  0.031410759f,
+    0.999289473f,  0.037690183f,
+    0.999032935f,  0.043968118f,
+    0.998736957f,  0.050244318f,
+    0.998401550f,  0.056518534f,
+    0.998026728f,  0.062790520f,
+    0.997612506f,  0.069060026f,
+    0.997158900f,  0.075326806f,
+    0.996665928f,  0.081590612f,
+    0.996133609f,  0.087851197f,
+    0.995561965f,  0.094108313f,
+    0.994951017f,  0.100361715f,
+    0.994300790f,  0.106611154f,
+    0.993611311f,  0.112856385f,
+    0.992882605f,  0.119097160f,
+    0.992114701f,  0.125333234f,
+    0.991307631f,  0.131564359f,
+    0.990461426f,  0.137790291f,
+    0.989576119f,  0.144010783f,
+    0.988651745f,  0.150225589f,
+    0.987688341f,  0.156434465f,
+    0.986685944f,  0.162637165f,
+    0.985644595f,  0.168833445f,
+    0.984564335f,  0.175023059f,
+    0.983445205f,  0.181205764f,
+    0.982287251f,  0.187381315f,
+    0.981090517f,  0.193549468f,
+    0.979855052f,  0.199709981f,
+    0.978580904f,  0.205862609f,
+    0.977268124f,  0.212007110f,
+    0.975916762f,  0.218143241f,
+    0.974526873f,  0.224270761f,
+    0.973098511f,  0.230389427f,
+    0.971631733f,  0.236498997f,
+    0.970126596f,  0.242599231f,
+    0.968583161f,  0.248689887f,
+    0.967001488f,  0.254770726f,
+    0.965381639f,  0.260841506f,
+    0.963723678f,  0.266901989f,
+    0.962027672f,  0.272951936f,
+    0.960293686f,  0.278991106f,
+    0.958521789f,  0.285019262f,
+    0.956712052f,  0.291036167f,
+    0.954864545f,  0.297041582f,
+    0.952979342f,  0.303035270f,
+    0.951056516f,  0.309016994f,
+    0.949096145f,  0.314986520f,
+    0.947098305f,  0.320943610f,
+    0.945063075f,  0.326888030f,
+    0.942990536f,  0.332819545f,
+    0.940880769f,  0.338737920f,
+    0.938733858f,  0.344642923f,
+    0.936549887f,  0.350534320f,
+    0.934328942f,  0.356411879f,
+    0.932071112f,  0.362275367f,
+    0.929776486f,  0.368124553f,
+    0.927445153f,  0.373959206f,
+    0.925077207f,  0.379779096f,
+    0.922672740f,  0.385583992f,
+    0.920231847f,  0.391373667f,
+    0.917754626f,  0.397147891f,
+    0.915241173f,  0.402906436f,
+    0.912691587f,  0.408649075f,
+    0.910105971f,  0.414375581f,
+    0.907484425f,  0.420085728f,
+    0.904827052f,  0.425779292f,
+    0.902133959f,  0.431456046f,
+    0.899405252f,  0.437115767f,
+    0.896641037f,  0.442758231f,
+    0.893841424f,  0.448383216f,
+    0.891006524f,  0.453990500f,
+    0.888136449f,  0.459579861f,
+    0.885231311f,  0.465151078f,
+    0.882291226f,  0.470703932f,
+    0.879316310f,  0.476238204f,
+    0.876306680f,  0.481753674f,
+    0.873262455f,  0.487250126f,
+    0.870183755f,  0.492727342f,
+    0.867070701f,  0.498185105f,
+    0.863923417f,  0.503623202f,
+    0.860742027f,  0.509041416f,
+    0.857526656f,  0.514439534f,
+    0.854277432f,  0.519817343f,
+    0.850994482f,  0.525174630f,
+    0.847677936f,  0.530511184f,
+    0.844327926f,  0.535826795f,
+    0.840944582f,  0.541121252f,
+    0.837528040f,  0.546394347f,
+    0.834078434f,  0.551645871f,
+    0.830595899f,  0.556875616f,
+    0.827080574f,  0.562083378f,
+    0.823532598f,  0.567268949f,
+    0.819952109f,  0.572432126f,
+    0.816339251f,  0.577572703f,
+    0.812694164f,  0.582690480f,
+    0.809016994f,  0.587785252f,
+    0.805307886f,  0.592856820f,
+    0.801566985f,  0.597904983f,
+    0.797794440f,  0.602929542f,
+    0.793990399f,  0.607930298f,
+    0.790155012f,  0.612907054f,
+    0.786288432f,  0.617859613f,
+    0.782390811f,  0.622787780f,
+    0.778462302f,  0.627691361f,
+    0.774503060f,  0.632570162f,
+    0.770513243f,  0.637423990f,
+    0.766493007f,  0.642252653f,
+    0.762442511f,  0.647055962f,
+    0.758361915f,  0.651833725f,
+    0.754251381f,  0.656585756f,
+    0.750111070f,  0.661311865f,
+    0.745941145f,  0.666011867f,
+    0.741741773f,  0.670685577f,
+    0.737513117f,  0.675332808f,
+    0.733255346f,  0.679953379f,
+    0.728968627f,  0.684547106f,
+    0.724653130f,  0.689113808f,
+    0.720309025f,  0.693653306f,
+    0.715936483f,  0.698165419f,
+    0.711535677f,  0.702649970f,
+    0.707106781f,  0.707106781f,
+    0.702649970f,  0.711535677f,
+    0.698165419f,  0.715936483f,
+    0.693653306f,  0.720309025f,
+    0.689113808f,  0.724653130f,
+    0.684547106f,  0.728968627f,
+    0.679953379f,  0.733255346f,
+    0.675332808f,  0.737513117f,
+    0.670685577f,  0.741741773f,
+    0.666011867f,  0.745941145f,
+    0.661311865f,  0.750111070f,
+    0.656585756f,  0.754251381f,
+    0.651833725f,  0.758361915f,
+    0.647055962f,  0.762442511f,
+    0.642252653f,  0.766493007f,
+    0.637423990f,  0.770513243f,
+    0.632570162f,  0.774503060f,
+    0.627691361f,  0.778462302f,
+    0.622787780f,  0.782390811f,
+    0.617859613f,  0.786288432f,
+    0.612907054f,  0.790155012f,
+    0.607930298f,  0.793990399f,
+    0.602929542f,  0.797794440f,
+    0.597904983f,  0.801566985f,
+    0.592856820f,  0.805307886f,
+    0.587785252f,  0.809016994f,
+    0.582690480f,  0.812694164f,
+    0.577572703f,  0.816339251f,
+    0.572432126f,  0.819952109f,
+    0.567268949f,  0.823532598f,
+    0.562083378f,  0.827080574f,
+    0.556875616f,  0.830595899f,
+    0.551645871f,  0.834078434f,
+    0.546394347f,  0.837528040f,
+    0.541121252f,  0.840944582f,
+    0.535826795f,  0.844327926f,
+    0.530511184f,  0.847677936f,
+    0.525174630f,  0.850994482f,
+    0.519817343f,  0.854277432f,
+    0.514439534f,  0.857526656f,
+    0.509041416f,  0.860742027f,
+    0.503623202f,  0.863923417f,
+    0.498185105f,  0.867070701f,
+    0.492727342f,  0.870183755f,
+    0.487250126f,  0.873262455f,
+    0.481753674f,  0.876306680f,
+    0.476238204f,  0.879316310f,
+    0.470703932f,  0.882291226f,
+    0.465151078f,  0.885231311f,
+    0.459579861f,  0.888136449f,
+    0.453990500f,  0.891006524f,
+    0.448383216f,  0.893841424f,
+    0.442758231f,  0.896641037f,
+    0.437115767f,  0.899405252f,
+    0.431456046f,  0.902133959f,
+    0.425779292f,  0.904827052f,
+    0.420085728f,  0.907484425f,
+    0.414375581f,  0.910105971f,
+    0.408649075f,  0.912691587f,
+    0.402906436f,  0.915241173f,
+    0.397147891f,  0.917754626f,
+    0.391373667f,  0.920231847f,
+    0.385583992f,  0.922672740f,
+    0.379779096f,  0.925077207f,
+    0.373959206f,  0.927445153f,
+    0.368124553f,  0.929776486f,
+    0.362275367f,  0.932071112f,
+    0.356411879f,  0.934328942f,
+    0.350534320f,  0.936549887f,
+    0.344642923f,  0.938733858f,
+    0.338737920f,  0.940880769f,
+    0.332819545f,  0.942990536f,
+    0.326888030f,  0.945063075f,
+    0.320943610f,  0.947098305f,
+    0.314986520f,  0.949096145f,
+    0.309016994f,  0.951056516f,
+    0.303035270f,  0.952979342f,
+    0.297041582f,  0.954864545f,
+    0.291036167f,  0.956712052f,
+    0.285019262f,  0.958521789f,
+    0.278991106f,  0.960293686f,
+    0.272951936f,  0.962027672f,
+    0.266901989f,  0.963723678f,
+    0.260841506f,  0.965381639f,
+    0.254770726f,  0.967001488f,
+    0.248689887f,  0.968583161f,
+    0.242599231f,  0.970126596f,
+    0.236498997f,  0.971631733f,
+    0.230389427f,  0.973098511f,
+    0.224270761f,  0.974526873f,
+    0.218143241f,  0.975916762f,
+    0.212007110f,  0.977268124f,
+    0.205862609f,  0.978580904f,
+    0.199709981f,  0.979855052f,
+    0.193549468f,  0.981090517f,
+    0.187381315f,  0.982287251f,
+    0.181205764f,  0.983445205f,
+    0.175023059f,  0.984564335f,
+    0.168833445f,  0.985644595f,
+    0.162637165f,  0.986685944f,
+    0.156434465f,  0.987688341f,
+    0.150225589f,  0.988651745f,
+    0.144010783f,  0.989576119f,
+    0.137790291f,  0.990461426f,
+    0.131564359f,  0.991307631f,
+    0.125333234f,  0.992114701f,
+    0.119097160f,  0.992882605f,
+    0.112856385f,  0.993611311f,
+    0.106611154f,  0.994300790f,
+    0.100361715f,  0.994951017f,
+    0.094108313f,  0.995561965f,
+    0.087851197f,  0.996133609f,
+    0.081590612f,  0.996665928f,
+    0.075326806f,  0.997158900f,
+    0.069060026f,  0.997612506f,
+    0.062790520f,  0.998026728f,
+    0.056518534f,  0.998401550f,
+    0.050244318f,  0.998736957f,
+    0.043968118f,  0.999032935f,
+    0.037690183f,  0.999289473f,
+    0.031410759f,  0.999506560f,
+    0.025130095f,  0.999684189f,
+    0.018848440f,  0.999822352f,
+    0.012566040f,  0.999921044f,
+    0.006283144f,  0.999980261f,
+    0.000000000f,  1.000000000f,
+   -0.006283144f,  0.999980261f,
+   -0.012566040f,  0.999921044f,
+   -0.018848440f,  0.999822352f,
+   -0.025130095f,  0.999684189f,
+   -0.031410759f,  0.999506560f,
+   -0.037690183f,  0.999289473f,
+   -0.043968118f,  0.999032935f,
+   -0.050244318f,  0.998736957f,
+   -0.056518534f,  0.998401550f,
+   -0.062790520f,  0.998026728f,
+   -0.069060026f,  0.997612506f,
+   -0.075326806f,  0.997158900f,
+   -0.081590612f,  0.996665928f,
+   -0.087851197f,  0.996133609f,
+   -0.094108313f,  0.995561965f,
+   -0.100361715f,  0.994951017f,
+   -0.106611154f,  0.994300790f,
+   -0.112856385f,  0.993611311f,
+   -0.119097160f,  0.992882605f,
+   -0.125333234f,  0.992114701f,
+   -0.131564359f,  0.991307631f,
+   -0.137790291f,  0.990461426f,
+   -0.144010783f,  0.989576119f,
+   -0.150225589f,  0.988651745f,
+   -0.156434465f,  0.987688341f,
+   -0.162637165f,  0.986685944f,
+   -0.168833445f,  0.985644595f,
+   -0.175023059f,  0.984564335f,
+   -0.181205764f,  0.983445205f,
+   -0.187381315f,  0.982287251f,
+   -0.193549468f,  0.981090517f,
+   -0.199709981f,  0.979855052f,
+   -0.205862609f,  0.978580904f,
+   -0.212007110f,  0.977268124f,
+   -0.218143241f,  0.975916762f,
+   -0.224270761f,  0.974526873f,
+   -0.230389427f,  0.973098511f,
+   -0.236498997f,  0.971631733f,
+   -0.242599231f,  0.970126596f,
+   -0.248689887f,  0.968583161f,
+   -0.254770726f,  0.967001488f,
+   -0.260841506f,  0.965381639f,
+   -0.266901989f,  0.963723678f,
+   -0.272951936f,  0.962027672f,
+   -0.278991106f,  0.960293686f,
+   -0.285019262f,  0.958521789f,
+   -0.291036167f,  0.956712052f,
+   -0.297041582f,  0.954864545f,
+   -0.303035270f,  0.952979342f,
+   -0.309016994f,  0.951056516f,
+   -0.314986520f,  0.949096145f,
+   -0.320943610f,  0.947098305f,
+   -0.326888030f,  0.945063075f,
+   -0.332819545f,  0.942990536f,
+   -0.338737920f,  0.940880769f,
+   -0.344642923f,  0.938733858f,
+   -0.350534320f,  0.936549887f,
+   -0.356411879f,  0.934328942f,
+   -0.362275367f,  0.932071112f,
+   -0.368124553f,  0.929776486f,
+   -0.373959206f,  0.927445153f,
+   -0.379779096f,  0.925077207f,
+   -0.385583992f,  0.922672740f,
+   -0.391373667f,  0.920231847f,
+   -0.397147891f,  0.917754626f,
+   -0.402906436f,  0.915241173f,
+   -0.408649075f,  0.912691587f,
+   -0.414375581f,  0.910105971f,
+   -0.420085728f,  0.907484425f,
+   -0.425779292f,  0.904827052f,
+   -0.431456046f,  0.902133959f,
+   -0.437115767f,  0.899405252f,
+   -0.442758231f,  0.896641037f,
+   -0.448383216f,  0.893841424f,
+   -0.453990500f,  0.891006524f,
+   -0.459579861f,  0.888136449f,
+   -0.465151078f,  0.885231311f,
+   -0.470703932f,  0.882291226f,
+   -0.476238204f,  0.879316310f,
+   -0.481753674f,  0.876306680f,
+   -0.487250126f,  0.873262455f,
+   -0.492727342f,  0.870183755f,
+   -0.498185105f,  0.867070701f,
+   -0.503623202f,  0.863923417f,
+   -0.509041416f,  0.860742027f,
+   -0.514439534f,  0.857526656f,
+   -0.519817343f,  0.854277432f,
+   -0.525174630f,  0.850994482f,
+   -0.530511184f,  0.847677936f,
+   -0.535826795f,  0.844327926f,
+   -0.541121252f,  0.840944582f,
+   -0.546394347f,  0.837528040f,
+   -0.551645871f,  0.834078434f,
+   -0.556875616f,  0.830595899f,
+   -0.562083378f,  0.827080574f,
+   -0.567268949f,  0.823532598f,
+   -0.572432126f,  0.819952109f,
+   -0.577572703f,  0.816339251f,
+   -0.582690480f,  0.812694164f,
+   -0.587785252f,  0.809016994f,
+   -0.592856820f,  0.805307886f,
+   -0.597904983f,  0.801566985f,
+   -0.602929542f,  0.797794440f,
+   -0.607930298f,  0.793990399f,
+   -0.612907054f,  0.790155012f,
+   -0.617859613f,  0.786288432f,
+   -0.622787780f,  0.782390811f,
+   -0.627691361f,  0.778462302f,
+   -0.632570162f,  0.774503060f,
+   -0.637423990f,  0.770513243f,
+   -0.642252653f,  0.766493007f,
+   -0.647055962f,  0.762442511f,
+   -0.651833725f,  0.758361915f,
+   -0.656585756f,  0.754251381f,
+   -0.661311865f,  0.750111070f,
+   -0.666011867f,  0.745941145f,
+   -0.670685577f,  0.741741773f,
+   -0.675332808f,  0.737513117f,
+   -0.679953379f,  0.733255346f,
+   -0.684547106f,  0.728968627f,
+   -0.689113808f,  0.724653130f,
+   -0.693653306f,  0.720309025f,
+   -0.698165419f,  0.715936483f,
+   -0.702649970f,  0.711535677f,
+   -0.707106781f,  0.707106781f,
+   -0.711535677f,  0.702649970f,
+   -0.715936483f,  0.698165419f,
+   -0.720309025f,  0.693653306f,
+   -0.724653130f,  0.689113808f,
+   -0.728968627f,  0.684547106f,
+   -0.733255346f,  0.679953379f,
+   -0.737513117f,  0.675332808f,
+   -0.741741773f,  0.670685577f,
+   -0.745941145f,  0.666011867f,
+   -0.750111070f,  0.661311865f,
+   -0.754251381f,  0.656585756f,
+   -0.758361915f,  0.651833725f,
+   -0.762442511f,  0.647055962f,
+   -0.766493007f,  0.642252653f,
+   -0.770513243f,  0.637423990f,
+   -0.774503060f,  0.632570162f,
+   -0.778462302f,  0.627691361f,
+   -0.782390811f,  0.622787780f,
+   -0.786288432f,  0.617859613f,
+   -0.790155012f,  0.612907054f,
+   -0.793990399f,  0.607930298f,
+   -0.797794440f,  0.602929542f,
+   -0.801566985f,  0.597904983f,
+   -0.805307886f,  0.592856820f,
+   -0.809016994f,  0.587785252f,
+   -0.812694164f,  0.582690480f,
+   -0.816339251f,  0.577572703f,
+   -0.819952109f,  0.572432126f,
+   -0.823532598f,  0.567268949f,
+   -0.827080574f,  0.562083378f,
+   -0.830595899f,  0.556875616f,
+   -0.834078434f,  0.551645871f,
+   -0.837528040f,  0.546394347f,
+   -0.840944582f,  0.541121252f,
+   -0.844327926f,  0.535826795f,
+   -0.847677936f,  0.530511184f,
+   -0.850994482f,  0.525174630f,
+   -0.854277432f,  0.519817343f,
+   -0.857526656f,  0.514439534f,
+   -0.860742027f,  0.509041416f,
+   -0.863923417f,  0.503623202f,
+   -0.867070701f,  0.498185105f,
+   -0.870183755f,  0.492727342f,
+   -0.873262455f,  0.487250126f,
+   -0.876306680f,  0.481753674f,
+   -0.879316310f,  0.476238204f,
+   -0.882291226f,  0.470703932f,
+   -0.885231311f,  0.465151078f,
+   -0.888136449f,  0.459579861f,
+   -0.891006524f,  0.453990500f,
+   -0.893841424f,  0.448383216f,
+   -0.896641037f,  0.442758231f,
+   -0.899405252f,  0.437115767f,
+   -0.902133959f,  0.431456046f,
+   -0.904827052f,  0.425779292f,
+   -0.907484425f,  0.420085728f,
+   -0.910105971f,  0.414375581f,
+   -0.912691587f,  0.408649075f,
+   -0.915241173f,  0.402906436f,
+   -0.917754626f,  0.397147891f,
+   -0.920231847f,  0.391373667f,
+   -0.922672740f,  0.385583992f,
+   -0.925077207f,  0.379779096f,
+   -0.927445153f,  0.373959206f,
+   -0.929776486f,  0.368124553f,
+   -0.932071112f,  0.362275367f,
+   -0.934328942f,  0.356411879f,
+   -0.936549887f,  0.350534320f,
+   -0.938733858f,  0.344642923f,
+   -0.940880769f,  0.338737920f,
+   -0.942990536f,  0.332819545f,
+   -0.945063075f,  0.326888030f,
+   -0.947098305f,  0.320943610f,
+   -0.949096145f,  0.314986520f,
+   -0.951056516f,  0.309016994f,
+   -0.952979342f,  0.303035270f,
+   -0.954864545f,  0.297041582f,
+   -0.956712052f,  0.291036167f,
+   -0.958521789f,  0.285019262f,
+   -0.960293686f,  0.278991106f,
+   -0.962027672f,  0.272951936f,
+   -0.963723678f,  0.266901989f,
+   -0.965381639f,  0.260841506f,
+   -0.967001488f,  0.254770726f,
+   -0.968583161f,  0.248689887f,
+   -0.970126596f,  0.242599231f,
+   -0.971631733f,  0.236498997f,
+   -0.973098511f,  0.230389427f,
+   -0.974526873f,  0.224270761f,
+   -0.975916762f,  0.218143241f,
+   -0.977268124f,  0.212007110f,
+   -0.978580904f,  0.205862609f,
+   -0.979855052f,  0.199709981f,
+   -0.981090517f,  0.193549468f,
+   -0.982287251f,  0.187381315f,
+   -0.983445205f,  0.181205764f,
+   -0.984564335f,  0.175023059f,
+   -0.985644595f,  0.168833445f,
+   -0.986685944f,  0.162637165f,
+   -0.987688341f,  0.156434465f,
+   -0.988651745f,  0.150225589f,
+   -0.989576119f,  0.144010783f,
+   -0.990461426f,  0.137790291f,
+   -0.991307631f,  0.131564359f,
+   -0.992114701f,  0.125333234f,
+   -0.992882605f,  0.119097160f,
+   -0.993611311f,  0.112856385f,
+   -0.994300790f,  0.106611154f,
+   -0.994951017f,  0.100361715f,
+   -0.995561965f,  0.094108313f,
+   -0.996133609f,  0.087851197f,
+   -0.996665928f,  0.081590612f,
+   -0.997158900f,  0.075326806f,
+   -0.997612506f,  0.069060026f,
+   -0.998026728f,  0.062790520f,
+   -0.998401550f,  0.056518534f,
+   -0.998736957f,  0.050244318f,
+   -0.999032935f,  0.043968118f,
+   -0.999289473f,  0.037690183f,
+   -0.999506560f,  0.031410759f,
+   -0.999684189f,  0.025130095f,
+   -0.999822352f,  0.018848440f,
+   -0.999921044f,  0.012566040f,
+   -0.999980261f,  0.006283144f,
+   -1.000000000f,  0.000000000f,
+   -0.999980261f, -0.006283144f,
+   -0.999921044f, -0.012566040f,
+   -0.999822352f, -0.018848440f,
+   -0.999684189f, -0.025130095f,
+   -0.999506560f, -0.031410759f,
+   -0.999289473f, -0.037690183f,
+   -0.999032935f, -0.043968118f,
+   -0.998736957f, -0.050244318f,
+   -0.998401550f, -0.056518534f,
+   -0.998026728f, -0.062790520f,
+   -0.997612506f, -0.069060026f,
+   -0.997158900f, -0.075326806f,
+   -0.996665928f, -0.081590612f,
+   -0.996133609f, -0.087851197f,
+   -0.995561965f, -0.094108313f,
+   -0.994951017f, -0.100361715f,
+   -0.994300790f, -0.106611154f,
+   -0.993611311f, -0.112856385f,
+   -0.992882605f, -0.119097160f,
+   -0.992114701f, -0.125333234f,
+   -0.991307631f, -0.131564359f,
+   -0.990461426f, -0.137790291f,
+   -0.989576119f, -0.144010783f,
+   -0.988651745f, -0.150225589f,
+   -0.987688341f, -0.156434465f,
+   -0.986685944f, -0.162637165f,
+   -0.985644595f, -0.168833445f,
+   -0.984564335f, -0.175023059f,
+   -0.983445205f, -0.181205764f,
+   -0.982287251f, -0.187381315f,
+   -0.981090517f, -0.193549468f,
+   -0.979855052f, -0.199709981f,
+   -0.978580904f, -0.205862609f,
+   -0.977268124f, -0.212007110f,
+   -0.975916762f, -0.218143241f,
+   -0.974526873f, -0.224270761f,
+   -0.973098511f, -0.230389427f,
+   -0.971631733f, -0.236498997f,
+   -0.970126596f, -0.242599231f,
+   -0.968583161f, -0.248689887f,
+   -0.967001488f, -0.254770726f,
+   -0.965381639f, -0.260841506f,
+   -0.963723678f, -0.266901989f,
+   -0.962027672f, -0.272951936f,
+   -0.960293686f, -0.278991106f,
+   -0.958521789f, -0.285019262f,
+   -0.956712052f, -0.291036167f,
+   -0.954864545f, -0.297041582f,
+   -0.952979342f, -0.303035270f,
+   -0.951056516f, -0.309016994f,
+   -0.949096145f, -0.314986520f,
+   -0.947098305f, -0.320943610f,
+   -0.945063075f, -0.326888030f,
+   -0.942990536f, -0.332819545f,
+   -0.940880769f, -0.338737920f,
+   -0.938733858f, -0.344642923f,
+   -0.936549887f, -0.350534320f,
+   -0.934328942f, -0.356411879f,
+   -0.932071112f, -0.362275367f,
+   -0.929776486f, -0.368124553f,
+   -0.927445153f, -0.373959206f,
+   -0.925077207f, -0.379779096f,
+   -0.922672740f, -0.385583992f,
+   -0.920231847f, -0.391373667f,
+   -0.917754626f, -0.397147891f,
+   -0.915241173f, -0.402906436f,
+   -0.912691587f, -0.408649075f,
+   -0.910105971f, -0.414375581f,
+   -0.907484425f, -0.420085728f,
+   -0.904827052f, -0.425779292f,
+   -0.902133959f, -0.431456046f,
+   -0.899405252f, -0.437115767f,
+   -0.896641037f, -0.442758231f,
+   -0.893841424f, -0.448383216f,
+   -0.891006524f, -0.453990500f,
+   -0.888136449f, -0.459579861f,
+   -0.885231311f, -0.465151078f,
+   -0.882291226f, -0.470703932f,
+   -0.879316310f, -0.476238204f,
+   -0.876306680f, -0.481753674f,
+   -0.873262455f, -0.487250126f,
+   -0.870183755f, -0.492727342f,
+   -0.867070701f, -0.498185105f,
+   -0.863923417f, -0.503623202f,
+   -0.860742027f, -0.509041416f,
+   -0.857526656f, -0.514439534f,
+   -0.854277432f, -0.519817343f,
+   -0.850994482f, -0.525174630f,
+   -0.847677936f, -0.530511184f,
+   -0.844327926f, -0.535826795f,
+   -0.840944582f, -0.541121252f,
+   -0.837528040f, -0.546394347f,
+   -0.834078434f, -0.551645871f,
+   -0.830595899f, -0.556875616f,
+   -0.827080574f, -0.562083378f,
+   -0.823532598f, -0.567268949f,
+   -0.819952109f, -0.572432126f,
+   -0.816339251f, -0.577572703f,
+   -0.812694164f, -0.582690480f,
+   -0.809016994f, -0.587785252f,
+   -0.805307886f, -0.592856820f,
+   -0.801566985f, -0.597904983f,
+   -0.797794440f, -0.602929542f,
+   -0.793990399f, -0.607930298f,
+   -0.790155012f, -0.612907054f,
+   -0.786288432f, -0.617859613f,
+   -0.782390811f, -0.622787780f,
+   -0.778462302f, -0.627691361f,
+   -0.774503060f, -0.632570162f,
+   -0.770513243f, -0.637423990f,
+   -0.766493007f, -0.642252653f,
+   -0.762442511f, -0.647055962f,
+   -0.758361915f, -0.651833725f,
+   -0.754251381f, -0.656585756f,
+   -0.750111070f, -0.661311865f,
+   -0.745941145f, -0.666011867f,
+   -0.741741773f, -0.670685577f,
+   -0.737513117f, -0.675332808f,
+   -0.733255346f, -0.679953379f,
+   -0.728968627f, -0.684547106f,
+   -0.724653130f, -0.689113808f,
+   -0.720309025f, -0.693653306f,
+   -0.715936483f, -0.698165419f,
+   -0.711535677f, -0.702649970f,
+   -0.707106781f, -0.707106781f,
+   -0.702649970f, -0.711535677f,
+   -0.698165419f, -0.715936483f,
+   -0.693653306f, -0.720309025f,
+   -0.689113808f, -0.724653130f,
+   -0.684547106f, -0.728968627f,
+   -0.679953379f, -0.733255346f,
+   -0.675332808f, -0.737513117f,
+   -0.670685577f, -0.741741773f,
+   -0.666011867f, -0.745941145f,
+   -0.661311865f, -0.750111070f,
+   -0.656585756f, -0.754251381f,
+   -0.651833725f, -0.758361915f,
+   -0.647055962f, -0.762442511f,
+   -0.642252653f, -0.766493007f,
+   -0.637423990f, -0.770513243f,
+   -0.632570162f, -0.774503060f,
+   -0.627691361f, -0.778462302f,
+   -0.622787780f, -0.782390811f,
+   -0.617859613f, -0.786288432f,
+   -0.612907054f, -0.790155012f,
+   -0.607930298f, -0.793990399f,
+   -0.602929542f, -0.797794440f,
+   -0.597904983f, -0.801566985f,
+   -0.592856820f, -0.805307886f,
+   -0.587785252f, -0.809016994f,
+   -0.582690480f, -0.812694164f,
+   -0.577572703f, -0.816339251f,
+   -0.572432126f, -0.819952109f,
+   -0.567268949f, -0.823532598f,
+   -0.562083378f, -0.827080574f,
+   -0.556875616f, -0.830595899f,
+   -0.551645871f, -0.834078434f,
+   -0.546394347f, -0.837528040f,
+   -0.541121252f, -0.840944582f,
+   -0.535826795f, -0.844327926f,
+   -0.530511184f, -0.847677936f,
+   -0.525174630f, -0.850994482f,
+   -0.519817343f, -0.854277432f,
+   -0.514439534f, -0.857526656f,
+   -0.509041416f, -0.860742027f,
+   -0.503623202f, -0.863923417f,
+   -0.498185105f, -0.867070701f,
+   -0.492727342f, -0.870183755f,
+   -0.487250126f, -0.873262455f,
+   -0.481753674f, -0.876306680f,
+   -0.476238204f, -0.879316310f,
+   -0.470703932f, -0.882291226f,
+   -0.465151078f, -0.885231311f,
+   -0.459579861f, -0.888136449f,
+   -0.453990500f, -0.891006524f,
+   -0.448383216f, -0.893841424f,
+   -0.442758231f, -0.896641037f,
+   -0.437115767f, -0.899405252f,
+   -0.431456046f, -0.902133959f,
+   -0.425779292f, -0.904827052f,
+   -0.420085728f, -0.907484425f,
+   -0.414375581f, -0.910105971f,
+   -0.408649075f, -0.912691587f,
+   -0.402906436f, -0.915241173f,
+   -0.397147891f, -0.917754626f,
+   -0.391373667f, -0.920231847f,
+   -0.385583992f, -0.922672740f,
+   -0.379779096f, -0.925077207f,
+   -0.373959206f, -0.927445153f,
+   -0.368124553f, -0.929776486f,
+   -0.362275367f, -0.932071112f,
+   -0.356411879f, -0.934328942f,
+   -0.350534320f, -0.936549887f,
+   -0.344642923f, -0.938733858f,
+   -0.338737920f, -0.940880769f,
+   -0.332819545f, -0.942990536f,
+   -0.326888030f, -0.945063075f,
+   -0.320943610f, -0.947098305f,
+   -0.314986520f, -0.949096145f,
+   -0.309016994f, -0.951056516f,
+   -0.303035270f, -0.952979342f,
+   -0.297041582f, -0.954864545f,
+   -0.291036167f, -0.956712052f,
+   -0.285019262f, -0.958521789f,
+   -0.278991106f, -0.960293686f,
+   -0.272951936f, -0.962027672f,
+   -0.266901989f, -0.963723678f,
+   -0.260841506f, -0.965381639f,
+   -0.254770726f, -0.967001488f,
+   -0.248689887f, -0.968583161f,
+   -0.242599231f, -0.970126596f,
+   -0.236498997f, -0.971631733f,
+   -0.230389427f, -0.973098511f,
+   -0.224270761f, -0.974526873f,
+   -0.218143241f, -0.975916762f,
+   -0.212007110f, -0.977268124f,
+   -0.205862609f, -0.978580904f,
+   -0.199709981f, -0.979855052f,
+   -0.193549468f, -0.981090517f,
+   -0.187381315f, -0.982287251f,
+   -0.181205764f, -0.983445205f,
+   -0.175023059f, -0.984564335f,
+   -0.168833445f, -0.985644595f,
+   -0.162637165f, -0.986685944f,
+   -0.156434465f, -0.987688341f,
+   -0.150225589f, -0.988651745f,
+   -0.144010783f, -0.989576119f,
+   -0.137790291f, -0.990461426f,
+   -0.131564359f, -0.991307631f,
+   -0.125333234f, -0.992114701f,
+   -0.119097160f, -0.992882605f,
+   -0.112856385f, -0.993611311f,
+   -0.106611154f, -0.994300790f,
+   -0.100361715f, -0.994951017f,
+   -0.094108313f, -0.995561965f,
+   -0.087851197f, -0.996133609f,
+   -0.081590612f, -0.996665928f,
+   -0.075326806f, -0.997158900f,
+   -0.069060026f, -0.997612506f,
+   -0.062790520f, -0.998026728f,
+   -0.056518534f, -0.998401550f,
+   -0.050244318f, -0.998736957f,
+   -0.043968118f, -0.999032935f,
+   -0.037690183f, -0.999289473f,
+   -0.031410759f, -0.999506560f,
+   -0.025130095f, -0.999684189f,
+   -0.018848440f, -0.999822352f,
+   -0.012566040f, -0.999921044f,
+   -0.006283144f, -0.999980261f,
+   -0.000000000f, -1.000000000f,
+    0.006283144f, -0.999980261f,
+    0.012566040f, -0.999921044f,
+    0.018848440f, -0.999822352f,
+    0.025130095f, -0.999684189f,
+    0.031410759f, -0.999506560f,
+    0.037690183f, -0.999289473f,
+    0.043968118f, -0.999032935f,
+    0.050244318f, -0.998736957f,
+    0.056518534f, -0.998401550f,
+    0.062790520f, -0.998026728f,
+    0.069060026f, -0.997612506f,
+    0.075326806f, -0.997158900f,
+    0.081590612f, -0.996665928f,
+    0.087851197f, -0.996133609f,
+    0.094108313f, -0.995561965f,
+    0.100361715f, -0.994951017f,
+    0.106611154f, -0.994300790f,
+    0.112856385f, -0.993611311f,
+    0.119097160f, -0.992882605f,
+    0.125333234f, -0.992114701f,
+    0.131564359f, -0.991307631f,
+    0.137790291f, -0.990461426f,
+    0.144010783f, -0.989576119f,
+    0.150225589f, -0.988651745f,
+    0.156434465f, -0.987688341f,
+    0.162637165f, -0.986685944f,
+    0.168833445f, -0.985644595f,
+    0.175023059f, -0.984564335f,
+    0.181205764f, -0.983445205f,
+    0.187381315f, -0.982287251f,
+    0.193549468f, -0.981090517f,
+    0.199709981f, -0.979855052f,
+    0.205862609f, -0.978580904f,
+    0.212007110f, -0.977268124f,
+    0.218143241f, -0.975916762f,
+    0.224270761f, -0.974526873f,
+    0.230389427f, -0.973098511f,
+    0.236498997f, -0.971631733f,
+    0.242599231f, -0.970126596f,
+    0.248689887f, -0.968583161f,
+    0.254770726f, -0.967001488f,
+    0.260841506f, -0.965381639f,
+    0.266901989f, -0.963723678f,
+    0.272951936f, -0.962027672f,
+    0.278991106f, -0.960293686f,
+    0.285019262f, -0.958521789f,
+    0.291036167f, -0.956712052f,
+    0.297041582f, -0.954864545f,
+    0.303035270f, -0.952979342f,
+    0.309016994f, -0.951056516f,
+    0.314986520f, -0.949096145f,
+    0.320943610f, -0.947098305f,
+    0.326888030f, -0.945063075f,
+    0.332819545f, -0.942990536f,
+    0.338737920f, -0.940880769f,
+    0.344642923f, -0.938733858f,
+    0.350534320f, -0.936549887f,
+    0.356411879f, -0.934328942f,
+    0.362275367f, -0.932071112f,
+    0.368124553f, -0.929776486f,
+    0.373959206f, -0.927445153f,
+    0.379779096f, -0.925077207f,
+    0.385583992f, -0.922672740f,
+    0.391373667f, -0.920231847f,
+    0.397147891f, -0.917754626f,
+    0.402906436f, -0.915241173f,
+    0.408649075f, -0.912691587f,
+    0.414375581f, -0.910105971f,
+    0.420085728f, -0.907484425f,
+    0.425779292f, -0.904827052f,
+    0.431456046f, -0.902133959f,
+    0.437115767f, -0.899405252f,
+    0.442758231f, -0.896641037f,
+    0.448383216f, -0.893841424f,
+    0.453990500f, -0.891006524f,
+    0.459579861f, -0.888136449f,
+    0.465151078f, -0.885231311f,
+    0.470703932f, -0.882291226f,
+    0.476238204f, -0.879316310f,
+    0.481753674f, -0.876306680f,
+    0.487250126f, -0.873262455f,
+    0.492727342f, -0.870183755f,
+    0.498185105f, -0.867070701f,
+    0.503623202f, -0.863923417f,
+    0.509041416f, -0.860742027f,
+    0.514439534f, -0.857526656f,
+    0.519817343f, -0.854277432f,
+    0.525174630f, -0.850994482f,
+    0.530511184f, -0.847677936f,
+    0.535826795f, -0.844327926f,
+    0.541121252f, -0.840944582f,
+    0.546394347f, -0.837528040f,
+    0.551645871f, -0.834078434f,
+    0.556875616f, -0.830595899f,
+    0.562083378f, -0.827080574f,
+    0.567268949f, -0.823532598f,
+    0.572432126f, -0.819952109f,
+    0.577572703f, -0.816339251f,
+    0.582690480f, -0.812694164f,
+    0.587785252f, -0.809016994f,
+    0.592856820f, -0.805307886f,
+    0.597904983f, -0.801566985f,
+    0.602929542f, -0.797794440f,
+    0.607930298f, -0.793990399f,
+    0.612907054f, -0.790155012f,
+    0.617859613f, -0.786288432f,
+    0.622787780f, -0.782390811f,
+    0.627691361f, -0.778462302f,
+    0.632570162f, -0.774503060f,
+    0.637423990f, -0.770513243f,
+    0.642252653f, -0.766493007f,
+    0.647055962f, -0.762442511f,
+    0.651833725f, -0.758361915f,
+    0.656585756f, -0.754251381f,
+    0.661311865f, -0.750111070f,
+    0.666011867f, -0.745941145f,
+    0.670685577f, -0.741741773f,
+    0.675332808f, -0.737513117f,
+    0.679953379f, -0.733255346f,
+    0.684547106f, -0.728968627f,
+    0.689113808f, -0.724653130f,
+    0.693653306f, -0.720309025f,
+    0.698165419f, -0.715936483f,
+    0.702649970f, -0.711535677f,
+    0.707106781f, -0.707106781f,
+    0.711535677f, -0.702649970f,
+    0.715936483f, -0.698165419f,
+    0.720309025f, -0.693653306f,
+    0.724653130f, -0.689113808f,
+    0.728968627f, -0.684547106f,
+    0.733255346f, -0.679953379f,
+    0.737513117f, -0.675332808f,
+    0.741741773f, -0.670685577f,
+    0.745941145f, -0.666011867f,
+    0.750111070f, -0.661311865f,
+    0.754251381f, -0.656585756f,
+    0.758361915f, -0.651833725f,
+    0.762442511f, -0.647055962f,
+    0.766493007f, -0.642252653f,
+    0.770513243f, -0.637423990f,
+    0.774503060f, -0.632570162f,
+    0.778462302f, -0.627691361f,
+    0.782390811f, -0.622787780f,
+    0.786288432f, -0.617859613f,
+    0.790155012f, -0.612907054f,
+    0.793990399f, -0.607930298f,
+    0.797794440f, -0.602929542f,
+    0.801566985f, -0.597904983f,
+    0.805307886f, -0.592856820f,
+    0.809016994f, -0.587785252f,
+    0.812694164f, -0.582690480f,
+    0.816339251f, -0.577572703f,
+    0.819952109f, -0.572432126f,
+    0.823532598f, -0.567268949f,
+    0.827080574f, -0.562083378f,
+    0.830595899f, -0.556875616f,
+    0.834078434f, -0.551645871f,
+    0.837528040f, -0.546394347f,
+    0.840944582f, -0.541121252f,
+    0.844327926f, -0.535826795f,
+    0.847677936f, -0.530511184f,
+    0.850994482f, -0.525174630f,
+    0.854277432f, -0.519817343f,
+    0.857526656f, -0.514439534f,
+    0.860742027f, -0.509041416f,
+    0.863923417f, -0.503623202f,
+    0.867070701f, -0.498185105f,
+    0.870183755f, -0.492727342f,
+    0.873262455f, -0.487250126f,
+    0.876306680f, -0.481753674f,
+    0.879316310f, -0.476238204f,
+    0.882291226f, -0.470703932f,
+    0.885231311f, -0.465151078f,
+    0.888136449f, -0.459579861f,
+    0.891006524f, -0.453990500f,
+    0.893841424f, -0.448383216f,
+    0.896641037f, -0.442758231f,
+    0.899405252f, -0.437115767f,
+    0.902133959f, -0.431456046f,
+    0.904827052f, -0.425779292f,
+    0.907484425f, -0.420085728f,
+    0.910105971f, -0.414375581f,
+    0.912691587f, -0.408649075f,
+    0.915241173f, -0.402906436f,
+    0.917754626f, -0.397147891f,
+    0.920231847f, -0.391373667f,
+    0.922672740f, -0.385583992f,
+    0.925077207f, -0.379779096f,
+    0.927445153f, -0.373959206f,
+    0.929776486f, -0.368124553f,
+    0.932071112f, -0.362275367f,
+    0.934328942f, -0.356411879f,
+    0.936549887f, -0.350534320f,
+    0.938733858f, -0.344642923f,
+    0.940880769f, -0.338737920f,
+    0.942990536f, -0.332819545f,
+    0.945063075f, -0.326888030f,
+    0.947098305f, -0.320943610f,
+    0.949096145f, -0.314986520f,
+    0.951056516f, -0.309016994f,
+    0.952979342f, -0.303035270f,
+    0.954864545f, -0.297041582f,
+    0.956712052f, -0.291036167f,
+    0.958521789f, -0.285019262f,
+    0.960293686f, -0.278991106f,
+    0.962027672f, -0.272951936f,
+    0.963723678f, -0.266901989f,
+    0.965381639f, -0.260841506f,
+    0.967001488f, -0.254770726f,
+    0.968583161f, -0.248689887f,
+    0.970126596f, -0.242599231f,
+    0.971631733f, -0.236498997f,
+    0.973098511f, -0.230389427f,
+    0.974526873f, -0.224270761f,
+    0.975916762f, -0.218143241f,
+    0.977268124f, -0.212007110f,
+    0.978580904f, -0.205862609f,
+    0.979855052f, -0.199709981f,
+    0.981090517f, -0.193549468f,
+    0.982287251f, -0.187381315f,
+    0.983445205f, -0.181205764f,
+    0.984564335f, -0.175023059f,
+    0.985644595f, -0.168833445f,
+    0.986685944f, -0.162637165f,
+    0.987688341f, -0.156434465f,
+    0.988651745f, -0.150225589f,
+    0.989576119f, -0.144010783f,
+    0.990461426f, -0.137790291f,
+    0.991307631f, -0.131564359f,
+    0.992114701f, -0.125333234f,
+    0.992882605f, -0.119097160f,
+    0.993611311f, -0.112856385f,
+    0.994300790f, -0.106611154f,
+    0.994951017f, -0.100361715f,
+    0.995561965f, -0.094108313f,
+    0.996133609f, -0.087851197f,
+    0.996665928f, -0.081590612f,
+    0.997158900f, -0.075326806f,
+    0.997612506f, -0.069060026f,
+    0.998026728f, -0.062790520f,
+    0.998401550f, -0.056518534f,
+    0.998736957f, -0.050244318f,
+    0.999032935f, -0.043968118f,
+    0.999289473f, -0.037690183f,
+    0.999506560f, -0.031410759f,
+    0.999684189f, -0.025130095f,
+    0.999822352f, -0.018848440f,
+    0.999921044f, -0.012566040f,
+    0.999980261f, -0.006283144f
+};
+#endif
+
+/**    
+* \par    
+* Example code for Floating-point Twiddle factors Generation:    
+* \par    
+* <pre>for(i = 0; i< N/; i++)    
+* {    
+*	twiddleCoef[2*i]= cos(i * 2*PI/(float)N);    
+*	twiddleCoef[2*i+1]= sin(i * 2*PI/(float)N);    
+* } </pre>    
+* \par    
+* where N = 1200	and PI = 3.14159265358979    
+* \par    
+* Cos and Sin values are in interleaved fashion    
+*     
+*/
+#if defined(ARM_TABLE_FFT_F32_1200)
+const float32_t twiddleCoef_1200[2400] ARM_DSP_TABLE_ATTR = {
+    1.000000000f,  0.000000000f,
+    0.999986292f,  0.005235964f,
+    0.999945169f,  0.010471784f,
+    0.999876632f,  0.015707317f,
+    0.999780683f,  0.020942420f,
+    0.999657325f,  0.026176948f,
+    0.999506560f,  0.031410759f,
+    0.999328394f,  0.036643709f,
+    0.999122830f,  0.041875654f,
+    0.998889875f,  0.047106451f,
+    0.998629535f,  0.052335956f,
+    0.998341817f,  0.057564027f,
+    0.998026728f,  0.062790520f,
+    0.997684279f,  0.068015291f,
+    0.997314477f,  0.073238197f,
+    0.996917334f,  0.078459096f,
+    0.996492859f,  0.083677843f,
+    0.996041065f,  0.088894297f,
+    0.995561965f,  0.094108313f,
+    0.995055570f,  0.099319750f,
+    0.994521895f,  0.104528463f,
+    0.993960955f,  0.109734311f,
+    0.993372766f,  0.114937150f,
+    0.992757342f,  0.120136839f,
+    0.992114701f,  0.125333234f,
+    0.991444861f,  0.130526192f,
+    0.990747840f,  0.135715572f,
+    0.990023658f,  0.140901232f,
+    0.989272333f,  0.146083029f,
+    0.988493887f,  0.151260820f,
+    0.987688341f,  0.156434465f,
+    0.986855716f,  0.161603821f,
+    0.985996037f,  0.166768747f,
+    0.985109326f,  0.171929100f,
+    0.984195608f,  0.177084740f,
+    0.983254908f,  0.182235525f,
+    0.982287251f,  0.187381315f,
+    0.981292664f,  0.192521967f,
+    0.980271175f,  0.197657340f,
+    0.979222811f,  0.202787295f,
+    0.978147601f,  0.207911691f,
+    0.977045574f,  0.213030386f,
+    0.975916762f,  0.218143241f,
+    0.974761194f,  0.223250116f,
+    0.973578903f,  0.228350870f,
+    0.972369920f,  0.233445364f,
+    0.971134280f,  0.238533458f,
+    0.969872015f,  0.243615012f,
+    0.968583161f,  0.248689887f,
+    0.967267753f,  0.253757945f,
+    0.965925826f,  0.258819045f,
+    0.964557418f,  0.263873050f,
+    0.963162567f,  0.268919821f,
+    0.961741310f,  0.273959219f,
+    0.960293686f,  0.278991106f,
+    0.958819735f,  0.284015345f,
+    0.957319498f,  0.289031797f,
+    0.955793015f,  0.294040325f,
+    0.954240329f,  0.299040792f,
+    0.952661481f,  0.304033061f,
+    0.951056516f,  0.309016994f,
+    0.949425478f,  0.313992456f,
+    0.947768410f,  0.318959309f,
+    0.946085359f,  0.323917418f,
+    0.944376370f,  0.328866647f,
+    0.942641491f,  0.333806859f,
+    0.940880769f,  0.338737920f,
+    0.939094252f,  0.343659695f,
+    0.937281989f,  0.348572047f,
+    0.935444031f,  0.353474844f,
+    0.933580426f,  0.358367950f,
+    0.931691228f,  0.363251230f,
+    0.929776486f,  0.368124553f,
+    0.927836254f,  0.372987783f,
+    0.925870585f,  0.377840787f,
+    0.923879533f,  0.382683432f,
+    0.921863152f,  0.387515586f,
+    0.919821497f,  0.392337117f,
+    0.917754626f,  0.397147891f,
+    0.915662593f,  0.401947777f,
+    0.913545458f,  0.406736643f,
+    0.911403277f,  0.411514359f,
+    0.909236109f,  0.416280792f,
+    0.907044014f,  0.421035813f,
+    0.904827052f,  0.425779292f,
+    0.902585284f,  0.430511097f,
+    0.900318771f,  0.435231099f,
+    0.898027576f,  0.439939170f,
+    0.895711760f,  0.444635179f,
+    0.893371388f,  0.449318999f,
+    0.891006524f,  0.453990500f,
+    0.888617233f,  0.458649554f,
+    0.886203579f,  0.463296035f,
+    0.883765630f,  0.467929814f,
+    0.881303452f,  0.472550765f,
+    0.878817113f,  0.477158760f,
+    0.876306680f,  0.481753674f,
+    0.873772223f,  0.486335380f,
+    0.871213811f,  0.490903754f,
+    0.868631514f,  0.495458668f,
+    0.866025404f,  0.500000000f,
+    0.863395551f,  0.504527624f,
+    0.860742027f,  0.509041416f,
+    0.858064906f,  0.513541252f,
+    0.855364260f,  0.518027009f,
+    0.852640164f,  0.522498565f,
+    0.849892693f,  0.526955795f,
+    0.847121921f,  0.531398580f,
+    0.844327926f,  0.535826795f,
+    0.841510782f,  0.540240320f,
+    0.838670568f,  0.544639035f,
+    0.835807361f,  0.549022818f,
+    0.832921241f,  0.553391549f,
+    0.830012285f,  0.557745109f,
+    0.827080574f,  0.562083378f,
+    0.824126189f,  0.566406237f,
+    0.821149209f,  0.570713568f,
+    0.818149717f,  0.575005252f,
+    0.815127796f,  0.579281172f,
+    0.812083527f,  0.583541211f,
+    0.809016994f,  0.587785252f,
+    0.805928282f,  0.592013179f,
+    0.802817475f,  0.596224875f,
+    0.799684658f,  0.600420225f,
+    0.796529918f,  0.604599115f,
+    0.793353340f,  0.608761429f,
+    0.790155012f,  0.612907054f,
+    0.786935022f,  0.617035875f,
+    0.783693457f,  0.621147780f,
+    0.780430407f,  0.625242656f,
+    0.777145961f,  0.629320391f,
+    0.773840210f,  0.633380873f,
+    0.770513243f,  0.637423990f,
+    0.767165152f,  0.641449632f,
+    0.763796029f,  0.645457688f,
+    0.760405966f,  0.649448048f,
+    0.756995056f,  0.653420604f,
+    0.753563392f,  0.657375246f,
+    0.750111070f,  0.661311865f,
+    0.746638182f,  0.665230355f,
+    0.743144825f,  0.669130606f,
+    0.739631095f,  0.673012514f,
+    0.736097087f,  0.676875970f,
+    0.732542899f,  0.680720869f,
+    0.728968627f,  0.684547106f,
+    0.725374371f,  0.688354576f,
+    0.721760228f,  0.692143174f,
+    0.718126298f,  0.695912797f,
+    0.714472680f,  0.699663341f,
+    0.710799474f,  0.703394703f,
+    0.707106781f,  0.707106781f,
+    0.703394703f,  0.710799474f,
+    0.699663341f,  0.714472680f,
+    0.695912797f,  0.718126298f,
+    0.692143174f,  0.721760228f,
+    0.688354576f,  0.725374371f,
+    0.684547106f,  0.728968627f,
+    0.680720869f,  0.732542899f,
+    0.676875970f,  0.736097087f,
+    0.673012514f,  0.739631095f,
+    0.669130606f,  0.743144825f,
+    0.665230355f,  0.746638182f,
+    0.661311865f,  0.750111070f,
+    0.657375246f,  0.753563392f,
+    0.653420604f,  0.756995056f,
+    0.649448048f,  0.760405966f,
+    0.645457688f,  0.763796029f,
+    0.641449632f,  0.767165152f,
+    0.637423990f,  0.770513243f,
+    0.633380873f,  0.773840210f,
+    0.629320391f,  0.777145961f,
+    0.625242656f,  0.780430407f,
+    0.621147780f,  0.783693457f,
+    0.617035875f,  0.786935022f,
+    0.612907054f,  0.790155012f,
+    0.608761429f,  0.793353340f,
+    0.604599115f,  0.796529918f,
+    0.600420225f,  0.799684658f,
+    0.596224875f,  0.802817475f,
+    0.592013179f,  0.805928282f,
+    0.587785252f,  0.809016994f,
+    0.583541211f,  0.812083527f,
+    0.579281172f,  0.815127796f,
+    0.575005252f,  0.818149717f,
+    0.570713568f,  0.821149209f,
+    0.566406237f,  0.824126189f,
+    0.562083378f,  0.827080574f,
+    0.557745109f,  0.830012285f,
+    0.553391549f,  0.832921241f,
+    0.549022818f,  0.835807361f,
+    0.544639035f,  0.838670568f,
+    0.540240320f,  0.841510782f,
+    0.535826795f,  0.844327926f,
+    0.531398580f,  0.847121921f,
+    0.526955795f,  0.849892693f,
+    0.522498565f,  0.852640164f,
+    0.518027009f,  0.855364260f,
+    0.513541252f,  0.858064906f,
+    0.509041416f,  0.860742027f,
+    0.504527624f,  0.863395551f,
+    0.500000000f,  0.866025404f,
+    0.495458668f,  0.868631514f,
+    0.490903754f,  0.871213811f,
+    0.486335380f,  0.873772223f,
+    0.481753674f,  0.876306680f,
+    0.477158760f,  0.878817113f,
+    0.472550765f,  0.881303452f,
+    0.467929814f,  0.883765630f,
+    0.463296035f,  0.886203579f,
+    0.458649554f,  0.888617233f,
+    0.453990500f,  0.891006524f,
+    0.449318999f,  0.893371388f,
+    0.444635179f,  0.895711760f,
+    0.439939170f,  0.898027576f,
+    0.435231099f,  0.900318771f,
+    0.430511097f,  0.902585284f,
+    0.425779292f,  0.904827052f,
+    0.421035813f,  0.907044014f,
+    0.416280792f,  0.909236109f,
+    0.411514359f,  0.911403277f,
+    0.406736643f,  0.913545458f,
+    0.401947777f,  0.915662593f,
+    0.397147891f,  0.917754626f,
+    0.392337117f,  0.919821497f,
+    0.387515586f,  0.921863152f,
+    0.382683432f,  0.923879533f,
+    0.377840787f,  0.925870585f,
+    0.372987783f,  0.927836254f,
+    0.368124553f,  0.929776486f,
+    0.363251230f,  0.931691228f,
+    0.358367950f,  0.933580426f,
+    0.353474844f,  0.935444031f,
+    0.348572047f,  0.937281989f,
+    0.343659695f,  0.939094252f,
+    0.338737920f,  0.940880769f,
+    0.333806859f,  0.942641491f,
+    0.328866647f,  0.944376370f,
+    0.323917418f,  0.946085359f,
+    0.318959309f,  0.947768410f,
+    0.313992456f,  0.949425478f,
+    0.309016994f,  0.951056516f,
+    0.304033061f,  0.952661481f,
+    0.299040792f,  0.954240329f,
+    0.294040325f,  0.955793015f,
+    0.289031797f,  0.957319498f,
+    0.284015345f,  0.958819735f,
+    0.278991106f,  0.960293686f,
+    0.273959219f,  0.961741310f,
+    0.268919821f,  0.963162567f,
+    0.263873050f,  0.964557418f,
+    0.258819045f,  0.965925826f,
+    0.253757945f,  0.967267753f,
+    0.248689887f,  0.968583161f,
+    0.243615012f,  0.969872015f,
+    0.238533458f,  0.971134280f,
+    0.233445364f,  0.972369920f,
+    0.228350870f,  0.973578903f,
+    0.223250116f,  0.974761194f,
+    0.218143241f,  0.975916762f,
+    0.213030386f,  0.977045574f,
+    0.207911691f,  0.978147601f,
+    0.202787295f,  0.979222811f,
+    0.197657340f,  0.980271175f,
+    0.192521967f,  0.981292664f,
+    0.187381315f,  0.982287251f,
+    0.182235525f,  0.983254908f,
+    0.177084740f,  0.984195608f,
+    0.171929100f,  0.985109326f,
+    0.166768747f,  0.985996037f,
+    0.161603821f,  0.986855716f,
+    0.156434465f,  0.987688341f,
+    0.151260820f,  0.988493887f,
+    0.146083029f,  0.989272333f,
+    0.140901232f,  0.990023658f,
+    0.135715572f,  0.990747840f,
+    0.130526192f,  0.991444861f,
+    0.125333234f,  0.992114701f,
+    0.120136839f,  0.992757342f,
+    0.114937150f,  0.993372766f,
+    0.109734311f,  0.993960955f,
+    0.104528463f,  0.994521895f,
+    0.099319750f,  0.995055570f,
+    0.094108313f,  0.995561965f,
+    0.088894297f,  0.996041065f,
+    0.083677843f,  0.996492859f,
+    0.078459096f,  0.996917334f,
+    0.073238197f,  0.997314477f,
+    0.068015291f,  0.997684279f,
+    0.062790520f,  0.998026728f,
+    0.057564027f,  0.998341817f,
+    0.052335956f,  0.998629535f,
+    0.047106451f,  0.998889875f,
+    0.041875654f,  0.999122830f,
+    0.036643709f,  0.999328394f,
+    0.031410759f,  0.999506560f,
+    0.026176948f,  0.999657325f,
+    0.020942420f,  0.999780683f,
+    0.015707317f,  0.999876632f,
+    0.010471784f,  0.999945169f,
+    0.005235964f,  0.999986292f,
+    0.000000000f,  1.000000000f,
+   -0.005235964f,  0.999986292f,
+   -0.010471784f,  0.999945169f,
+   -0.015707317f,  0.999876632f,
+   -0.020942420f,  0.999780683f,
+   -0.026176948f,  0.999657325f,
+   -0.031410759f,  0.999506560f,
+   -0.036643709f,  0.999328394f,
+   -0.041875654f,  0.999122830f,
+   -0.047106451f,  0.998889875f,
+   -0.052335956f,  0.998629535f,
+   -0.057564027f,  0.998341817f,
+   -0.062790520f,  0.998026728f,
+   -0.068015291f,  0.997684279f,
+   -0.073238197f,  0.997314477f,
+   -0.078459096f,  0.996917334f,
+   -0.083677843f,  0.996492859f,
+   -0.088894297f,  0.996041065f,
+   -0.094108313f,  0.995561965f,
+   -0.099319750f,  0.995055570f,
+   -0.104528463f,  0.994521895f,
+   -0.109734311f,  0.993960955f,
+   -0.114937150f,  0.993372766f,
+   -0.120136839f,  0.992757342f,
+   -0.125333234f,  0.992114701f,
+   -0.130526192f,  0.991444861f,
+   -0.135715572f,  0.990747840f,
+   -0.140901232f,  0.990023658f,
+   -0.146083029f,  0.989272333f,
+   -0.151260820f,  0.988493887f,
+   -0.156434465f,  0.987688341f,
+   -0.161603821f,  0.986855716f,
+   -0.166768747f,  0.985996037f,
+   -0.171929100f,  0.985109326f,
+   -0.177084740f,  0.984195608f,
+   -0.182235525f,  0.983254908f,
+   -0.187381315f,  0.982287251f,
+   -0.192521967f,  0.981292664f,
+   -0.197657340f,  0.980271175f,
+   -0.202787295f,  0.979222811f,
+   -0.207911691f,  0.978147601f,
+   -0.213030386f,  0.977045574f,
+   -0.218143241f,  0.975916762f,
+   -0.223250116f,  0.974761194f,
+   -0.228350870f,  0.973578903f,
+   -0.233445364f,  0.972369920f,
+   -0.238533458f,  0.971134280f,
+   -0.243615012f,  0.969872015f,
+   -0.248689887f,  0.968583161f,
+   -0.253757945f,  0.967267753f,
+   -0.258819045f,  0.965925826f,
+   -0.263873050f,  0.964557418f,
+   -0.268919821f,  0.963162567f,
+   -0.273959219f,  0.961741310f,
+   -0.278991106f,  0.960293686f,
+   -0.284015345f,  0.958819735f,
+   -0.289031797f,  0.957319498f,
+   -0.294040325f,  0.955793015f,
+   -0.299040792f,  0.954240329f,
+   -0.304033061f,  0.952661481f,
+   -0.309016994f,  0.951056516f,
+   -0.313992456f,  0.949425478f,
+   -0.318959309f,  0.947768410f,
+   -0.323917418f,  0.946085359f,
+   -0.328866647f,  0.944376370f,
+   -0.333806859f,  0.942641491f,
+   -0.338737920f,  0.940880769f,
+   -0.343659695f,  0.939094252f,
+   -0.348572047f,  0.937281989f,
+   -0.353474844f,  0.935444031f,
+   -0.358367950f,  0.933580426f,
+   -0.363251230f,  0.931691228f,
+   -0.368124553f,  0.929776486f,
+   -0.372987783f,  0.927836254f,
+   -0.377840787f,  0.925870585f,
+   -0.382683432f,  0.923879533f,
+   -0.387515586f,  0.921863152f,
+   -0.392337117f,  0.919821497f,
+   -0.397147891f,  0.917754626f,
+   -0.401947777f,  0.915662593f,
+   -0.406736643f,  0.913545458f,
+   -0.411514359f,  0.911403277f,
+   -0.416280792f,  0.909236109f,
+   -0.421035813f,  0.907044014f,
+   -0.425779292f,  0.904827052f,
+   -0.430511097f,  0.902585284f,
+   -0.435231099f,  0.900318771f,
+   -0.439939170f,  0.898027576f,
+   -0.444635179f,  0.895711760f,
+   -0.449318999f,  0.893371388f,
+   -0.453990500f,  0.891006524f,
+   -0.458649554f,  0.888617233f,
+   -0.463296035f,  0.886203579f,
+   -0.467929814f,  0.883765630f,
+   -0.472550765f,  0.881303452f,
+   -0.477158760f,  0.878817113f,
+   -0.481753674f,  0.876306680f,
+   -0.486335380f,  0.873772223f,
+   -0.490903754f,  0.871213811f,
+   -0.495458668f,  0.868631514f,
+   -0.500000000f,  0.866025404f,
+   -0.504527624f,  0.863395551f,
+   -0.509041416f,  0.860742027f,
+   -0.513541252f,  0.858064906f,
+   -0.518027009f,  0.855364260f,
+   -0.522498565f,  0.852640164f,
+   -0.526955795f,  0.849892693f,
+   -0.531398580f,  0.847121921f,
+   -0.535826795f,  0.844327926f,
+   -0.540240320f,  0.841510782f,
+   -0.544639035f,  0.838670568f,
+   -0.549022818f,  0.835807361f,
+   -0.553391549f,  0.832921241f,
+   -0.557745109f,  0.830012285f,
+   -0.562083378f,  0.827080574f,
+   -0.566406237f,  0.824126189f,
+   -0.570713568f,  0.821149209f,
+   -0.575005252f,  0.818149717f,
+   -0.579281172f,  0.815127796f,
+   -0.583541211f,  0.812083527f,
+   -0.587785252f,  0.809016994f,
+   -0.592013179f,  0.805928282f,
+   -0.596224875f,  0.802817475f,
+   -0.600420225f,  0.799684658f,
+   -0.604599115f,  0.796529918f,
+   -0.608761429f,  0.793353340f,
+   -0.612907054f,  0.790155012f,
+   -0.617035875f,  0.786935022f,
+   -0.621147780f,  0.783693457f,
+   -0.625242656f,  0.780430407f,
+   -0.629320391f,  0.777145961f,
+   -0.633380873f,  0.773840210f,
+   -0.637423990f,  0.770513243f,
+   -0.641449632f,  0.767165152f,
+   -0.645457688f,  0.763796029f,
+   -0.649448048f,  0.760405966f,
+   -0.653420604f,  0.756995056f,
+   -0.657375246f,  0.753563392f,
+   -0.661311865f,  0.750111070f,
+   -0.665230355f,  0.746638182f,
+   -0.669130606f,  0.743144825f,
+   -0.673012514f,  0.739631095f,
+   -0.676875970f,  0.736097087f,
+   -0.680720869f,  0.732542899f,
+   -0.684547106f,  0.728968627f,
+   -0.688354576f,  0.725374371f,
+   -0.692143174f,  0.721760228f,
+   -0.695912797f,  0.718126298f,
+   -0.699663341f,  0.714472680f,
+   -0.703394703f,  0.710799474f,
+   -0.707106781f,  0.707106781f,
+   -0.710799474f,  0.703394703f,
+   -0.714472680f,  0.699663341f,
+   -0.718126298f,  0.695912797f,
+   -0.721760228f,  0.692143174f,
+   -0.725374371f,  0.688354576f,
+   -0.728968627f,  0.684547106f,
+   -0.732542899f,  0.680720869f,
+   -0.736097087f,  0.676875970f,
+   -0.739631095f,  0.673012514f,
+   -0.743144825f,  0.669130606f,
+   -0.746638182f,  0.665230355f,
+   -0.750111070f,  0.661311865f,
+   -0.753563392f,  0.657375246f,
+   -0.756995056f,  0.653420604f,
+   -0.760405966f,  0.649448048f,
+   -0.763796029f,  0.645457688f,
+   -0.767165152f,  0.641449632f,
+   -0.770513243f,  0.637423990f,
+   -0.773840210f,  0.633380873f,
+   -0.777145961f,  0.629320391f,
+   -0.780430407f,  0.625242656f,
+   -0.783693457f,  0.621147780f,
+   -0.786935022f,  0.617035875f,
+   -0.790155012f,  0.612907054f,
+   -0.793353340f,  0.608761429f,
+   -0.796529918f,  0.604599115f,
+   -0.799684658f,  0.600420225f,
+   -0.802817475f,  0.596224875f,
+   -0.805928282f,  0.592013179f,
+   -0.809016994f,  0.587785252f,
+   -0.812083527f,  0.583541211f,
+   -0.815127796f,  0.579281172f,
+   -0.818149717f,  0.575005252f,
+   -0.821149209f,  0.570713568f,
+   -0.824126189f,  0.566406237f,
+   -0.827080574f,  0.562083378f,
+   -0.830012285f,  0.557745109f,
+   -0.832921241f,  0.553391549f,
+   -0.835807361f,  0.549022818f,
+   -0.838670568f,  0.544639035f,
+   -0.841510782f,  0.540240320f,
+   -0.844327926f,  0.535826795f,
+   -0.847121921f,  0.531398580f,
+   -0.849892693f,  0.526955795f,
+   -0.852640164f,  0.522498565f,
+   -0.855364260f,  0.518027009f,
+   -0.858064906f,  0.513541252f,
+   -0.860742027f,  0.509041416f,
+   -0.863395551f,  0.504527624f,
+   -0.866025404f,  0.500000000f,
+   -0.868631514f,  0.495458668f,
+   -0.871213811f,  0.490903754f,
+   -0.873772223f,  0.486335380f,
+   -0.876306680f,  0.481753674f,
+   -0.878817113f,  0.477158760f,
+   -0.881303452f,  0.472550765f,
+   -0.883765630f,  0.467929814f,
+   -0.886203579f,  0.463296035f,
+   -0.888617233f,  0.458649554f,
+   -0.891006524f,  0.453990500f,
+   -0.893371388f,  0.449318999f,
+   -0.895711760f,  0.444635179f,
+   -0.898027576f,  0.439939170f,
+   -0.900318771f,  0.435231099f,
+   -0.902585284f,  0.430511097f,
+   -0.904827052f,  0.425779292f,
+   -0.907044014f,  0.421035813f,
+   -0.909236109f,  0.416280792f,
+   -0.911403277f,  0.411514359f,
+   -0.913545458f,  0.406736643f,
+   -0.915662593f,  0.401947777f,
+   -0.917754626f,  0.397147891f,
+   -0.919821497f,  0.392337117f,
+   -0.921863152f,  0.387515586f,
+   -0.923879533f,  0.382683432f,
+   -0.925870585f,  0.377840787f,
+   -0.927836254f,  0.372987783f,
+   -0.929776486f,  0.368124553f,
+   -0.931691228f,  0.363251230f,
+   -0.933580426f,  0.358367950f,
+   -0.935444031f,  0.353474844f,
+   -0.937281989f,  0.348572047f,
+   -0.939094252f,  0.343659695f,
+   -0.940880769f,  0.338737920f,
+   -0.942641491f,  0.333806859f,
+   -0.944376370f,  0.328866647f,
+   -0.946085359f,  0.323917418f,
+   -0.947768410f,  0.318959309f,
+   -0.949425478f,  0.313992456f,
+   -0.951056516f,  0.309016994f,
+   -0.952661481f,  0.304033061f,
+   -0.954240329f,  0.299040792f,
+   -0.955793015f,  0.294040325f,
+   -0.957319498f,  0.289031797f,
+   -0.958819735f,  0.284015345f,
+   -0.960293686f,  0.278991106f,
+   -0.961741310f,  0.273959219f,
+   -0.963162567f,  0.268919821f,
+   -0.964557418f,  0.263873050f,
+   -0.965925826f,  0.258819045f,
+   -0.967267753f,  0.253757945f,
+   -0.968583161f,  0.248689887f,
+   -0.969872015f,  0.243615012f,
+   -0.971134280f,  0.238533458f,
+   -0.972369920f,  0.233445364f,
+   -0.973578903f,  0.228350870f,
+   -0.974761194f,  0.223250116f,
+   -0.975916762f,  0.218143241f,
+   -0.977045574f,  0.213030386f,
+   -0.978147601f,  0.207911691f,
+   -0.979222811f,  0.202787295f,
+   -0.980271175f,  0.197657340f,
+   -0.981292664f,  0.192521967f,
+   -0.982287251f,  0.187381315f,
+   -0.983254908f,  0.182235525f,
+   -0.984195608f,  0.177084740f,
+   -0.985109326f,  0.171929100f,
+   -0.985996037f,  0.166768747f,
+   -0.986855716f,  0.161603821f,
+   -0.987688341f,  0.156434465f,
+   -0.988493887f,  0.151260820f,
+   -0.989272333f,  0.146083029f,
+   -0.990023658f,  0.140901232f,
+   -0.990747840f,  0.135715572f,
+   -0.991444861f,  0.130526192f,
+   -0.992114701f,  0.125333234f,
+   -0.992757342f,  0.120136839f,
+   -0.993372766f,  0.114937150f,
+   -0.993960955f,  0.109734311f,
+   -0.994521895f,  0.104528463f,
+   -0.995055570f,  0.099319750f,
+   -0.995561965f,  0.094108313f,
+   -0.996041065f,  0.088894297f,
+   -0.996492859f,  0.083677843f,
+   -0.996917334f,  0.078459096f,
+   -0.997314477f,  0.073238197f,
+   -0.997684279f,  0.068015291f,
+   -0.998026728f,  0.062790520f,
+   -0.998341817f,  0.057564027f,
+   -0.998629535f,  0.052335956f,
+   -0.998889875f,  0.047106451f,
+   -0.999122830f,  0.041875654f,
+   -0.999328394f,  0.036643709f,
+   -0.999506560f,  0.031410759f,
+   -0.999657325f,  0.026176948f,
+   -0.999780683f,  0.020942420f,
+   -0.999876632f,  0.015707317f,
+   -0.999945169f,  0.010471784f,
+   -0.999986292f,  0.005235964f,
+   -1.000000000f,  0.000000000f,
+   -0.999986292f, -0.005235964f,
+   -0.999945169f, -0.010471784f,
+   -0.999876632f, -0.015707317f,
+   -0.999780683f, -0.020942420f,
+   -0.999657325f, -0.026176948f,
+   -0.999506560f, -0.031410759f,
+   -0.999328394f, -0.036643709f,
+   -0.999122830f, -0.041875654f,
+   -0.998889875f, -0.047106451f,
+   -0.998629535f, -0.052335956f,
+   -0.998341817f, -0.057564027f,
+   -0.998026728f, -0.062790520f,
+   -0.997684279f, -0.068015291f,
+   -0.997314477f, -0.073238197f,
+   -0.996917334f, -0.078459096f,
+   -0.996492859f, -0.083677843f,
+   -0.996041065f, -0.088894297f,
+   -0.995561965f, -0.094108313f,
+   -0.995055570f, -0.099319750f,
+   -0.994521895f, -0.104528463f,
+   -0.993960955f, -0.109734311f,
+   -0.993372766f, -0.114937150f,
+   -0.992757342f, -0.120136839f,
+   -0.992114701f, -0.125333234f,
+   -0.991444861f, -0.130526192f,
+   -0.990747840f, -0.135715572f,
+   -0.990023658f, -0.140901232f,
+   -0.989272333f, -0.146083029f,
+   -0.988493887f, -0.151260820f,
+   -0.987688341f, -0.156434465f,
+   -0.986855716f, -0.161603821f,
+   -0.985996037f, -0.166768747f,
+   -0.985109326f, -0.171929100f,
+   -0.984195608f, -0.177084740f,
+   -0.983254908f, -0.182235525f,
+   -0.982287251f, -0.187381315f,
+   -0.981292664f, -0.192521967f,
+   -0.980271175f, -0.197657340f,
+   -0.979222811f, -0.202787295f,
+   -0.978147601f, -0.207911691f,
+   -0.977045574f, -0.213030386f,
+   -0.975916762f, -0.218143241f,
+   -0.974761194f, -0.223250116f,
+   -0.973578903f, -0.228350870f,
+   -0.972369920f, -0.233445364f,
+   -0.971134280f, -0.238533458f,
+   -0.969872015f, -0.243615012f,
+   -0.968583161f, -0.248689887f,
+   -0.967267753f, -0.253757945f,
+   -0.965925826f, -0.258819045f,
+   -0.964557418f, -0.263873050f,
+   -0.963162567f, -0.268919821f,
+   -0.961741310f, -0.273959219f,
+   -0.960293686f, -0.278991106f,
+   -0.958819735f, -0.284015345f,
+   -0.957319498f, -0.289031797f,
+   -0.955793015f, -0.294040325f,
+   -0.954240329f, -0.299040792f,
+   -0.952661481f, -0.304033061f,
+   -0.951056516f, -0.309016994f,
+   -0.949425478f, -0.313992456f,
+   -0.947768410f, -0.318959309f,
+   -0.946085359f, -0.323917418f,
+   -0.944376370f, -0.328866647f,
+   -0.942641491f, -0.333806859f,
+   -0.940880769f, -0.338737920f,
+   -0.939094252f, -0.343659695f,
+   -0.937281989f, -0.348572047f,
+   -0.935444031f, -0.353474844f,
+   -0.933580426f, -0.358367950f,
+   -0.931691228f, -0.363251230f,
+   -0.929776486f, -0.368124553f,
+   -0.927836254f, -0.372987783f,
+   -0.925870585f, -0.377840787f,
+   -0.923879533f, -0.382683432f,
+   -0.921863152f, -0.387515586f,
+   -0.919821497f, -0.392337117f,
+   -0.917754626f, -0.397147891f,
+   -0.915662593f, -0.401947777f,
+   -0.913545458f, -0.406736643f,
+   -0.911403277f, -0.411514359f,
+   -0.909236109f, -0.416280792f,
+   -0.907044014f, -0.421035813f,
+   -0.904827052f, -0.425779292f,
+   -0.902585284f, -0.430511097f,
+   -0.900318771f, -0.435231099f,
+   -0.898027576f, -0.439939170f,
+   -0.895711760f, -0.444635179f,
+   -0.893371388f, -0.449318999f,
+   -0.891006524f, -0.453990500f,
+   -0.888617233f, -0.458649554f,
+   -0.886203579f, -0.463296035f,
+   -0.883765630f, -0.467929814f,
+   -0.881303452f, -0.472550765f,
+   -0.878817113f, -0.477158760f,
+   -0.876306680f, -0.481753674f,
+   -0.873772223f, -0.486335380f,
+   -0.871213811f, -0.490903754f,
+   -0.868631514f, -0.495458668f,
+   -0.866025404f, -0.500000000f,
+   -0.863395551f, -0.504527624f,
+   -0.860742027f, -0.509041416f,
+   -0.858064906f, -0.513541252f,
+   -0.855364260f, -0.518027009f,
+   -0.852640164f, -0.522498565f,
+   -0.849892693f, -0.526955795f,
+   -0.847121921f, -0.531398580f,
+   -0.844327926f, -0.535826795f,
+   -0.841510782f, -0.540240320f,
+   -0.838670568f, -0.544639035f,
+   -0.835807361f, -0.549022818f,
+   -0.832921241f, -0.553391549f,
+   -0.830012285f, -0.557745109f,
+   -0.827080574f, -0.562083378f,
+   -0.824126189f, -0.566406237f,
+   -0.821149209f, -0.570713568f,
+   -0.818149717f, -0.575005252f,
+   -0.815127796f, -0.579281172f,
+   -0.812083527f, -0.583541211f,
+   -0.809016994f, -0.587785252f,
+   -0.805928282f, -0.592013179f,
+   -0.802817475f, -0.596224875f,
+   -0.799684658f, -0.600420225f,
+   -0.796529918f, -0.604599115f,
+   -0.793353340f, -0.608761429f,
+   -0.790155012f, -0.612907054f,
+   -0.786935022f, -0.617035875f,
+   -0.783693457f, -0.621147780f,
+   -0.780430407f, -0.625242656f,
+   -0.777145961f, -0.629320391f,
+   -0.773840210f, -0.633380873f,
+   -0.770513243f, -0.637423990f,
+   -0.767165152f, -0.641449632f,
+   -0.763796029f, -0.645457688f,
+   -0.760405966f, -0.649448048f,
+   -0.756995056f, -0.653420604f,
+   -0.753563392f, -0.657375246f,
+   -0.750111070f, -0.661311865f,
+   -0.746638182f, -0.665230355f,
+   -0.743144825f, -0.669130606f,
+   -0.739631095f, -0.673012514f,
+   -0.736097087f, -0.676875970f,
+   -0.732542899f, -0.680720869f,
+   -0.728968627f, -0.684547106f,
+   -0.725374371f, -0.688354576f,
+   -0.721760228f, -0.692143174f,
+   -0.718126298f, -0.695912797f,
+   -0.714472680f, -0.699663341f,
+   -0.710799474f, -0.703394703f,
+   -0.707106781f, -0.707106781f,
+   -0.703394703f, -0.710799474f,
+   -0.699663341f, -0.714472680f,
+   -0.695912797f, -0.718126298f,
+   -0.692143174f, -0.721760228f,
+   -0.688354576f, -0.725374371f,
+   -0.684547106f, -0.728968627f,
+   -0.680720869f, -0.732542899f,
+   -0.676875970f, -0.736097087f,
+   -0.673012514f, -0.739631095f,
+   -0.669130606f, -0.743144825f,
+   -0.665230355f, -0.746638182f,
+   -0.661311865f, -0.750111070f,
+   -0.657375246f, -0.753563392f,
+   -0.653420604f, -0.756995056f,
+   -0.649448048f, -0.760405966f,
+   -0.645457688f, -0.763796029f,
+   -0.641449632f, -0.767165152f,
+   -0.637423990f, -0.770513243f,
+   -0.633380873f, -0.773840210f,
+   -0.629320391f, -0.777145961f,
+   -0.625242656f, -0.780430407f,
+   -0.621147780f, -0.783693457f,
+   -0.617035875f, -0.786935022f,
+   -0.612907054f, -0.790155012f,
+   -0.608761429f, -0.793353340f,
+   -0.604599115f, -0.796529918f,
+   -0.600420225f, -0.799684658f,
+   -0.596224875f, -0.802817475f,
+   -0.592013179f, -0.805928282f,
+   -0.587785252f, -0.809016994f,
+   -0.583541211f, -0.812083527f,
+   -0.579281172f, -0.815127796f,
+   -0.575005252f, -0.818149717f,
+   -0.570713568f, -0.821149209f,
+   -0.566406237f, -0.824126189f,
+   -0.562083378f, -0.827080574f,
+   -0.557745109f, -0.830012285f,
+   -0.553391549f, -0.832921241f,
+   -0.549022818f, -0.835807361f,
+   -0.544639035f, -0.838670568f,
+   -0.540240320f, -0.841510782f,
+   -0.535826795f, -0.844327926f,
+   -0.531398580f, -0.847121921f,
+   -0.526955795f, -0.849892693f,
+   -0.522498565f, -0.852640164f,
+   -0.518027009f, -0.855364260f,
+   -0.513541252f, -0.858064906f,
+   -0.509041416f, -0.860742027f,
+   -0.504527624f, -0.863395551f,
+   -0.500000000f, -0.866025404f,
+   -0.495458668f, -0.868631514f,
+   -0.490903754f, -0.871213811f,
+   -0.486335380f, -0.873772223f,
+   -0.481753674f, -0.876306680f,
+   -0.477158760f, -0.878817113f,
+   -0.472550765f, -0.881303452f,
+   -0.467929814f, -0.883765630f,
+   -0.463296035f, -0.886203579f,
+   -0.458649554f, -0.888617233f,
+   -0.453990500f, -0.891006524f,
+   -0.449318999f, -0.893371388f,
+   -0.444635179f, -0.895711760f,
+   -0.439939170f, -0.898027576f,
+   -0.435231099f, -0.900318771f,
+   -0.430511097f, -0.902585284f,
+   -0.425779292f, -0.904827052f,
+   -0.421035813f, -0.907044014f,
+   -0.416280792f, -0.909236109f,
+   -0.411514359f, -0.911403277f,
+   -0.406736643f, -0.913545458f,
+   -0.401947777f, -0.915662593f,
+   -0.397147891f, -0.917754626f,
+   -0.392337117f, -0.919821497f,
+   -0.387515586f, -0.921863152f,
+   -0.382683432f, -0.923879533f,
+   -0.377840787f, -0.925870585f,
+   -0.372987783f, -0.927836254f,
+   -0.368124553f, -0.929776486f,
+   -0.363251230f, -0.931691228f,
+   -0.358367950f, -0.933580426f,
+   -0.353474844f, -0.935444031f,
+   -0.348572047f, -0.937281989f,
+   -0.343659695f, -0.939094252f,
+   -0.338737920f, -0.940880769f,
+   -0.333806859f, -0.942641491f,
+   -0.328866647f, -0.944376370f,
+   -0.323917418f, -0.946085359f,
+   -0.318959309f, -0.947768410f,
+   -0.313992456f, -0.949425478f,
+   -0.309016994f, -0.951056516f,
+   -0.304033061f, -0.952661481f,
+   -0.299040792f, -0.954240329f,
+   -0.294040325f, -0.955793015f,
+   -0.289031797f, -0.957319498f,
+   -0.284015345f, -0.958819735f,
+   -0.278991106f, -0.960293686f,
+   -0.273959219f, -0.961741310f,
+   -0.268919821f, -0.963162567f,
+   -0.263873050f, -0.964557418f,
+   -0.258819045f, -0.965925826f,
+   -0.253757945f, -0.967267753f,
+   -0.248689887f, -0.968583161f,
+   -0.243615012f, -0.969872015f,
+   -0.238533458f, -0.971134280f,
+   -0.233445364f, -0.972369920f,
+   -0.228350870f, -0.973578903f,
+   -0.223250116f, -0.974761194f,
+   -0.218143241f, -0.975916762f,
+   -0.213030386f, -0.977045574f,
+   -0.207911691f, -0.978147601f,
+   -0.202787295f, -0.979222811f,
+   -0.197657340f, -0.980271175f,
+   -0.192521967f, -0.981292664f,
+   -0.187381315f, -0.982287251f,
+   -0.182235525f, -0.983254908f,
+   -0.177084740f, -0.984195608f,
+   -0.171929100f, -0.985109326f,
+   -0.166768747f, -0.985996037f,
+   -0.161603821f, -0.986855716f,
+   -0.156434465f, -0.987688341f,
+   -0.151260820f, -0.988493887f,
+   -0.146083029f, -0.989272333f,
+   -0.140901232f, -0.990023658f,
+   -0.135715572f, -0.990747840f,
+   -0.130526192f, -0.991444861f,
+   -0.125333234f, -0.992114701f,
+   -0.120136839f, -0.992757342f,
+   -0.114937150f, -0.993372766f,
+   -0.109734311f, -0.993960955f,
+   -0.104528463f, -0.994521895f,
+   -0.099319750f, -0.995055570f,
+   -0.094108313f, -0.995561965f,
+   -0.088894297f, -0.996041065f,
+   -0.083677843f, -0.996492859f,
+   -0.078459096f, -0.996917334f,
+   -0.073238197f, -0.997314477f,
+   -0.068015291f, -0.997684279f,
+   -0.062790520f, -0.998026728f,
+   -0.057564027f, -0.998341817f,
+   -0.052335956f, -0.998629535f,
+   -0.047106451f, -0.998889875f,
+   -0.041875654f, -0.999122830f,
+   -0.036643709f, -0.999328394f,
+   -0.031410759f, -0.999506560f,
+   -0.026176948f, -0.999657325f,
+   -0.020942420f, -0.999780683f,
+   -0.015707317f, -0.999876632f,
+   -0.010471784f, -0.999945169f,
+   -0.005235964f, -0.999986292f,
+   -0.000000000f, -1.000000000f,
+    0.005235964f, -0.999986292f,
+    0.010471784f, -0.999945169f,
+    0.015707317f, -0.999876632f,
+    0.020942420f, -0.999780683f,
+    0.026176948f, -0.999657325f,
+    0.031410759f, -0.999506560f,
+    0.036643709f, -0.999328394f,
+    0.041875654f, -0.999122830f,
+    0.047106451f, -0.998889875f,
+    0.052335956f, -0.998629535f,
+    0.057564027f, -0.998341817f,
+    0.062790520f, -0.998026728f,
+    0.068015291f, -0.997684279f,
+    0.073238197f, -0.997314477f,
+    0.078459096f, -0.996917334f,
+    0.083677843f, -0.996492859f,
+    0.088894297f, -0.996041065f,
+    0.094108313f, -0.995561965f,
+    0.099319750f, -0.995055570f,
+    0.104528463f, -0.994521895f,
+    0.109734311f, -0.993960955f,
+    0.114937150f, -0.993372766f,
+    0.120136839f, -0.992757342f,
+    0.125333234f, -0.992114701f,
+    0.130526192f, -0.991444861f,
+    0.135715572f, -0.990747840f,
+    0.140901232f, -0.990023658f,
+    0.146083029f, -0.989272333f,
+    0.151260820f, -0.988493887f,
+    0.156434465f, -0.987688341f,
+    0.161603821f, -0.986855716f,
+    0.166768747f, -0.985996037f,
+    0.171929100f, -0.985109326f,
+    0.177084740f, -0.984195608f,
+    0.182235525f, -0.983254908f,
+    0.187381315f, -0.982287251f,
+    0.192521967f, -0.981292664f,
+    0.197657340f, -0.980271175f,
+    0.202787295f, -0.979222811f,
+    0.207911691f, -0.978147601f,
+    0.213030386f, -0.977045574f,
+    0.218143241f, -0.975916762f,
+    0.223250116f, -0.974761194f,
+    0.228350870f, -0.973578903f,
+    0.233445364f, -0.972369920f,
+    0.238533458f, -0.971134280f,
+    0.243615012f, -0.969872015f,
+    0.248689887f, -0.968583161f,
+    0.253757945f, -0.967267753f,
+    0.258819045f, -0.965925826f,
+    0.263873050f, -0.964557418f,
+    0.268919821f, -0.963162567f,
+    0.273959219f, -0.961741310f,
+    0.278991106f, -0.960293686f,
+    0.284015345f, -0.958819735f,
+    0.289031797f, -0.957319498f,
+    0.294040325f, -0.955793015f,
+    0.299040792f, -0.954240329f,
+    0.304033061f, -0.952661481f,
+    0.309016994f, -0.951056516f,
+    0.313992456f, -0.949425478f,
+    0.318959309f, -0.947768410f,
+    0.323917418f, -0.946085359f,
+    0.328866647f, -0.944376370f,
+    0.333806859f, -0.942641491f,
+    0.338737920f, -0.940880769f,
+    0.343659695f, -0.939094252f,
+    0.348572047f, -0.937281989f,
+    0.353474844f, -0.935444031f,
+    0.358367950f, -0.933580426f,
+    0.363251230f, -0.931691228f,
+    0.368124553f, -0.929776486f,
+    0.372987783f, -0.927836254f,
+    0.377840787f, -0.925870585f,
+    0.382683432f, -0.923879533f,
+    0.387515586f, -0.921863152f,
+    0.392337117f, -0.919821497f,
+    0.397147891f, -0.917754626f,
+    0.401947777f, -0.915662593f,
+    0.406736643f, -0.913545458f,
+    0.411514359f, -0.911403277f,
+    0.416280792f, -0.909236109f,
+    0.421035813f, -0.907044014f,
+    0.425779292f, -0.904827052f,
+    0.430511097f, -0.902585284f,
+    0.435231099f, -0.900318771f,
+    0.439939170f, -0.898027576f,
+    0.444635179f, -0.895711760f,
+    0.449318999f, -0.893371388f,
+    0.453990500f, -0.891006524f,
+    0.458649554f, -0.888617233f,
+    0.463296035f, -0.886203579f,
+    0.467929814f, -0.883765630f,
+    0.472550765f, -0.881303452f,
+    0.477158760f, -0.878817113f,
+    0.481753674f, -0.876306680f,
+    0.486335380f, -0.873772223f,
+    0.490903754f, -0.871213811f,
+    0.495458668f, -0.868631514f,
+    0.500000000f, -0.866025404f,
+    0.504527624f, -0.863395551f,
+    0.509041416f, -0.860742027f,
+    0.513541252f, -0.858064906f,
+    0.518027009f, -0.855364260f,
+    0.522498565f, -0.852640164f,
+    0.526955795f, -0.849892693f,
+    0.531398580f, -0.847121921f,
+    0.535826795f, -0.844327926f,
+    0.540240320f, -0.841510782f,
+    0.544639035f, -0.838670568f,
+    0.549022818f, -0.835807361f,
+    0.553391549f, -0.832921241f,
+    0.557745109f, -0.830012285f,
+    0.562083378f, -0.827080574f,
+    0.566406237f, -0.824126189f,
+    0.570713568f, -0.821149209f,
+    0.575005252f, -0.818149717f,
+    0.579281172f, -0.815127796f,
+    0.583541211f, -0.812083527f,
+    0.587785252f, -0.809016994f,
+    0.592013179f, -0.805928282f,
+    0.596224875f, -0.802817475f,
+    0.600420225f, -0.799684658f,
+    0.604599115f, -0.796529918f,
+    0.608761429f, -0.793353340f,
+    0.612907054f, -0.790155012f,
+    0.617035875f, -0.786935022f,
+    0.621147780f, -0.783693457f,
+    0.625242656f, -0.780430407f,
+    0.629320391f, -0.777145961f,
+    0.633380873f, -0.773840210f,
+    0.637423990f, -0.770513243f,
+    0.641449632f, -0.767165152f,
+    0.645457688f, -0.763796029f,
+    0.649448048f, -0.760405966f,
+    0.653420604f, -0.756995056f,
+    0.657375246f, -0.753563392f,
+    0.661311865f, -0.750111070f,
+    0.665230355f, -0.746638182f,
+    0.669130606f, -0.743144825f,
+    0.673012514f, -0.739631095f,
+    0.676875970f, -0.736097087f,
+    0.680720869f, -0.732542899f,
+    0.684547106f, -0.728968627f,
+    0.688354576f, -0.725374371f,
+    0.692143174f, -0.721760228f,
+    0.695912797f, -0.718126298f,
+    0.699663341f, -0.714472680f,
+    0.703394703f, -0.710799474f,
+    0.707106781f, -0.707106781f,
+    0.710799474f, -0.703394703f,
+    0.714472680f, -0.699663341f,
+    0.718126298f, -0.695912797f,
+    0.721760228f, -0.692143174f,
+    0.725374371f, -0.688354576f,
+    0.728968627f, -0.684547106f,
+    0.732542899f, -0.680720869f,
+    0.736097087f, -0.676875970f,
+    0.739631095f, -0.673012514f,
+    0.743144825f, -0.669130606f,
+    0.746638182f, -0.665230355f,
+    0.750111070f, -0.661311865f,
+    0.753563392f, -0.657375246f,
+    0.756995056f, -0.653420604f,
+    0.760405966f, -0.649448048f,
+    0.763796029f, -0.645457688f,
+    0.767165152f, -0.641449632f,
+    0.770513243f, -0.637423990f,
+    0.773840210f, -0.633380873f,
+    0.777145961f, -0.629320391f,
+    0.780430407f, -0.625242656f,
+    0.783693457f, -0.621147780f,
+    0.786935022f, -0.617035875f,
+    0.790155012f, -0.612907054f,
+    0.793353340f, -0.608761429f,
+    0.796529918f, -0.604599115f,
+    0.799684658f, -0.600420225f,
+    0.802817475f, -0.596224875f,
+    0.805928282f, -0.592013179f,
+    0.809016994f, -0.587785252f,
+    0.812083527f, -0.583541211f,
+    0.815127796f, -0.579281172f,
+    0.818149717f, -0.575005252f,
+    0.821149209f, -0.570713568f,
+    0.824126189f, -0.566406237f,
+    0.827080574f, -0.562083378f,
+    0.830012285f, -0.557745109f,
+    0.832921241f, -0.553391549f,
+    0.835807361f, -0.549022818f,
+    0.838670568f, -0.544639035f,
+    0.841510782f, -0.540240320f,
+    0.844327926f, -0.535826795f,
+    0.847121921f, -0.531398580f,
+    0.849892693f, -0.526955795f,
+    0.852640164f, -0.522498565f,
+    0.855364260f, -0.518027009f,
+    0.858064906f, -0.513541252f,
+    0.860742027f, -0.509041416f,
+    0.863395551f, -0.504527624f,
+    0.866025404f, -0.500000000f,
+    0.868631514f, -0.495458668f,
+    0.871213811f, -0.490903754f,
+    0.873772223f, -0.486335380f,
+    0.876306680f, -0.481753674f,
+    0.878817113f, -0.477158760f,
+    0.881303452f, -0.472550765f,
+    0.883765630f, -0.467929814f,
+    0.886203579f, -0.463296035f,
+    0.888617233f, -0.458649554f,
+    0.891006524f, -0.453990500f,
+    0.893371388f, -0.449318999f,
+    0.895711760f, -0.444635179f,
+    0.898027576f, -0.439939170f,
+    0.900318771f, -0.435231099f,
+    0.902585284f, -0.430511097f,
+    0.904827052f, -0.425779292f,
+    0.907044014f, -0.421035813f,
+    0.909236109f, -0.416280792f,
+    0.911403277f, -0.411514359f,
+    0.913545458f, -0.406736643f,
+    0.915662593f, -0.401947777f,
+    0.917754626f, -0.397147891f,
+    0.919821497f, -0.392337117f,
+    0.921863152f, -0.387515586f,
+    0.923879533f, -0.382683432f,
+    0.925870585f, -0.377840787f,
+    0.927836254f, -0.372987783f,
+    0.929776486f, -0.368124553f,
+    0.931691228f, -0.363251230f,
+    0.933580426f, -0.358367950f,
+    0.935444031f, -0.353474844f,
+    0.937281989f, -0.348572047f,
+    0.939094252f, -0.343659695f,
+    0.940880769f, -0.338737920f,
+    0.942641491f, -0.333806859f,
+    0.944376370f, -0.328866647f,
+    0.946085359f, -0.323917418f,
+    0.947768410f, -0.318959309f,
+    0.949425478f, -0.313992456f,
+    0.951056516f, -0.309016994f,
+    0.952661481f, -0.304033061f,
+    0.954240329f, -0.299040792f,
+    0.955793015f, -0.294040325f,
+    0.957319498f, -0.289031797f,
+    0.958819735f, -0.284015345f,
+    0.960293686f, -0.278991106f,
+    0.961741310f, -0.273959219f,
+    0.963162567f, -0.268919821f,
+    0.964557418f, -0.263873050f,
+    0.965925826f, -0.258819045f,
+    0.967267753f, -0.253757945f,
+    0.968583161f, -0.248689887f,
+    0.969872015f, -0.243615012f,
+    0.971134280f, -0.238533458f,
+    0.972369920f, -0.233445364f,
+    0.973578903f, -0.228350870f,
+    0.974761194f, -0.223250116f,
+    0.975916762f, -0.218143241f,
+    0.977045574f, -0.213030386f,
+    0.978147601f, -0.207911691f,
+    0.979222811f, -0.202787295f,
+    0.980271175f, -0.197657340f,
+    0.981292664f, -0.192521967f,
+    0.982287251f, -0.187381315f,
+    0.983254908f, -0.182235525f,
+    0.984195608f, -0.177084740f,
+    0.985109326f, -0.171929100f,
+    0.985996037f, -0.166768747f,
+    0.986855716f, -0.161603821f,
+    0.987688341f, -0.156434465f,
+    0.988493887f, -0.151260820f,
+    0.989272333f, -0.146083029f,
+    0.990023658f, -0.140901232f,
+    0.990747840f, -0.135715572f,
+    0.991444861f, -0.130526192f,
+    0.992114701f, -0.125333234f,
+    0.992757342f, -0.120136839f,
+    0.993372766f, -0.114937150f,
+    0.993960955f, -0.109734311f,
+    0.994521895f, -0.104528463f,
+    0.995055570f, -0.099319750f,
+    0.995561965f, -0.094108313f,
+    0.996041065f, -0.088894297f,
+    0.996492859f, -0.083677843f,
+    0.996917334f, -0.078459096f,
+    0.997314477f, -0.073238197f,
+    0.997684279f, -0.068015291f,
+    0.998026728f, -0.062790520f,
+    0.998341817f, -0.057564027f,
+    0.998629535f, -0.052335956f,
+    0.998889875f, -0.047106451f,
+    0.999122830f, -0.041875654f,
+    0.999328394f, -0.036643709f,
+    0.999506560f, -0.031410759f,
+    0.999657325f, -0.026176948f,
+    0.999780683f, -0.020942420f,
+    0.999876632f, -0.015707317f,
+    0.999945169f, -0.010471784f,
+    0.999986292f, -0.005235964f
+};
+#endif
+
+/**    
+* \par    
+* Example code for Floating-point Twiddle factors Generation:    
+* \par    
+* <pre>for(i = 0; i< N/; i++)    
+* {    
+*	twiddleCoef[2*i]= cos(i * 2*PI/(float)N);    
+*	twiddleCoef[2*i+1]= sin(i * 2*PI/(float)N);    
+* } </pre>    
+* \par    
+* where N = 1536	and PI = 3.14159265358979    
+* \par    
+* Cos and Sin values are in interleaved fashion    
+*     
+*/
+#if defined(ARM_TABLE_FFT_F32_1536)
+const float32_t twiddleCoef_1536[3072] ARM_DSP_TABLE_ATTR = {
+    1.000000000f,  0.000000000f,
+    0.999991633f,  0.004090604f,
+    0.999966534f,  0.008181140f,
+    0.999924702f,  0.012271538f,
+    0.999866138f,  0.016361732f,
+    0.999790843f,  0.020451651f,
+    0.999698819f,  0.024541229f,
+    0.999590066f,  0.028630395f,
+    0.999464587f,  0.032719083f,
+    0.999322385f,  0.036807223f,
+    0.999163460f,  0.040894747f,
+    0.998987816f,  0.044981587f,
+    0.998795456f,  0.049067674f,
+    0.998586383f,  0.053152941f,
+    0.998360601f,  0.057237317f,
+    0.998118113f,  0.061320736f,
+    0.997858923f,  0.065403129f,
+    0.997583036f,  0.069484428f,
+    0.997290457f,  0.073564564f,
+    0.996981189f,  0.077643468f,
+    0.996655239f,  0.081721074f,
+    0.996312612f,  0.085797312f,
+    0.995953314f,  0.089872115f,
+    0.995577350f,  0.093945414f,
+    0.995184727f,  0.098017140f,
+    0.994775451f,  0.102087227f,
+    0.994349530f,  0.106155605f,
+    0.993906970f,  0.110222207f,
+    0.993447779f,  0.114286965f,
+    0.992971965f,  0.118349810f,
+    0.992479535f,  0.122410675f,
+    0.991970497f,  0.126469492f,
+    0.991444861f,  0.130526192f,
+    0.990902635f,  0.134580709f,
+    0.990343829f,  0.138632973f,
+    0.989768450f,  0.142682917f,
+    0.989176510f,  0.146730474f,
+    0.988568018f,  0.150775576f,
+    0.987942984f,  0.154818155f,
+    0.987301418f,  0.158858143f,
+    0.986643332f,  0.162895473f,
+    0.985968736f,  0.166930078f,
+    0.985277642f,  0.170961889f,
+    0.984570062f,  0.174990839f,
+    0.983846006f,  0.179016861f,
+    0.983105487f,  0.183039888f,
+    0.982348519f,  0.187059852f,
+    0.981575112f,  0.191076686f,
+    0.980785280f,  0.195090322f,
+    0.979979037f,  0.199100694f,
+    0.979156396f,  0.203107734f,
+    0.978317371f,  0.207111376f,
+    0.977461975f,  0.211111552f,
+    0.976590223f,  0.215108196f,
+    0.975702130f,  0.219101240f,
+    0.974797710f,  0.223090618f,
+    0.973876979f,  0.227076263f,
+    0.972939952f,  0.231058108f,
+    0.971986645f,  0.235036087f,
+    0.971017073f,  0.239010133f,
+    0.970031253f,  0.242980180f,
+    0.969029202f,  0.246946161f,
+    0.968010935f,  0.250908009f,
+    0.966976471f,  0.254865660f,
+    0.965925826f,  0.258819045f,
+    0.964859019f,  0.262768100f,
+    0.963776066f,  0.266712757f,
+    0.962676986f,  0.270652952f,
+    0.961561798f,  0.274588618f,
+    0.960430519f,  0.278519689f,
+    0.959283170f,  0.282446100f,
+    0.958119769f,  0.286367785f,
+    0.956940336f,  0.290284677f,
+    0.955744890f,  0.294196713f,
+    0.954533451f,  0.298103825f,
+    0.953306040f,  0.302005949f,
+    0.952062678f,  0.305903020f,
+    0.950803384f,  0.309794972f,
+    0.949528181f,  0.313681740f,
+    0.948237089f,  0.317563260f,
+    0.946930129f,  0.321439465f,
+    0.945607325f,  0.325310292f,
+    0.944268698f,  0.329175676f,
+    0.942914271f,  0.333035551f,
+    0.941544065f,  0.336889853f,
+    0.940158105f,  0.340738519f,
+    0.938756412f,  0.344581482f,
+    0.937339012f,  0.348418680f,
+    0.935905927f,  0.352250048f,
+    0.934457181f,  0.356075521f,
+    0.932992799f,  0.359895037f,
+    0.931512805f,  0.363708530f,
+    0.930017224f,  0.367515937f,
+    0.928506080f,  0.371317194f,
+    0.926979400f,  0.375112238f,
+    0.925437209f,  0.378901005f,
+    0.923879533f,  0.382683432f,
+    0.922306396f,  0.386459456f,
+    0.920717827f,  0.390229013f,
+    0.919113852f,  0.393992040f,
+    0.917494496f,  0.397748475f,
+    0.915859789f,  0.401498253f,
+    0.914209756f,  0.405241314f,
+    0.912544425f,  0.408977594f,
+    0.910863825f,  0.412707030f,
+    0.909167983f,  0.416429560f,
+    0.907456928f,  0.420145122f,
+    0.905730688f,  0.423853654f,
+    0.903989293f,  0.427555093f,
+    0.902232771f,  0.431249379f,
+    0.900461152f,  0.434936447f,
+    0.898674466f,  0.438616239f,
+    0.896872742f,  0.442288690f,
+    0.895056010f,  0.445953741f,
+    0.893224301f,  0.449611330f,
+    0.891377646f,  0.453261395f,
+    0.889516075f,  0.456903876f,
+    0.887639620f,  0.460538711f,
+    0.885748312f,  0.464165840f,
+    0.883842183f,  0.467785202f,
+    0.881921264f,  0.471396737f,
+    0.879985588f,  0.475000384f,
+    0.878035187f,  0.478596082f,
+    0.876070094f,  0.482183772f,
+    0.874090342f,  0.485763394f,
+    0.872095963f,  0.489334887f,
+    0.870086991f,  0.492898192f,
+    0.868063460f,  0.496453250f,
+    0.866025404f,  0.500000000f,
+    0.863972856f,  0.503538384f,
+    0.861905852f,  0.507068342f,
+    0.859824425f,  0.510589815f,
+    0.857728610f,  0.514102744f,
+    0.855618443f,  0.517607071f,
+    0.853493959f,  0.521102737f,
+    0.851355193f,  0.524589683f,
+    0.849202182f,  0.528067851f,
+    0.847034960f,  0.531537182f,
+    0.844853565f,  0.534997620f,
+    0.842658033f,  0.538449105f,
+    0.840448401f,  0.541891581f,
+    0.838224706f,  0.545324988f,
+    0.835986984f,  0.548749271f,
+    0.833735274f,  0.552164372f,
+    0.831469612f,  0.555570233f,
+    0.829190038f,  0.558966798f,
+    0.826896589f,  0.562354009f,
+    0.824589303f,  0.565731811f,
+    0.822268219f,  0.569100146f,
+    0.819933376f,  0.572458958f,
+    0.817584813f,  0.575808191f,
+    0.815222569f,  0.579147790f,
+    0.812846685f,  0.582477697f,
+    0.810457198f,  0.585797857f,
+    0.808054150f,  0.589108216f,
+    0.805637581f,  0.592408717f,
+    0.803207531f,  0.595699304f,
+    0.800764041f,  0.598979925f,
+    0.798307152f,  0.602250522f,
+    0.795836905f,  0.605511041f,
+    0.793353340f,  0.608761429f,
+    0.790856501f,  0.612001630f,
+    0.788346428f,  0.615231591f,
+    0.785823163f,  0.618451256f,
+    0.783286749f,  0.621660573f,
+    0.780737229f,  0.624859488f,
+    0.778174644f,  0.628047947f,
+    0.775599038f,  0.631225897f,
+    0.773010453f,  0.634393284f,
+    0.770408934f,  0.637550056f,
+    0.767794524f,  0.640696160f,
+    0.765167266f,  0.643831543f,
+    0.762527204f,  0.646956153f,
+    0.759874383f,  0.650069937f,
+    0.757208847f,  0.653172843f,
+    0.754530640f,  0.656264820f,
+    0.751839807f,  0.659345815f,
+    0.749136395f,  0.662415778f,
+    0.746420446f,  0.665474656f,
+    0.743692008f,  0.668522399f,
+    0.740951125f,  0.671558955f,
+    0.738197844f,  0.674584274f,
+    0.735432211f,  0.677598305f,
+    0.732654272f,  0.680600998f,
+    0.729864073f,  0.683592302f,
+    0.727061661f,  0.686572168f,
+    0.724247083f,  0.689540545f,
+    0.721420386f,  0.692497384f,
+    0.718581618f,  0.695442635f,
+    0.715730825f,  0.698376249f,
+    0.712868056f,  0.701298178f,
+    0.709993359f,  0.704208371f,
+    0.707106781f,  0.707106781f,
+    0.704208371f,  0.709993359f,
+    0.701298178f,  0.712868056f,
+    0.698376249f,  0.715730825f,
+    0.695442635f,  0.718581618f,
+    0.692497384f,  0.721420386f,
+    0.689540545f,  0.724247083f,
+    0.686572168f,  0.727061661f,
+    0.683592302f,  0.729864073f,
+    0.680600998f,  0.732654272f,
+    0.677598305f,  0.735432211f,
+    0.674584274f,  0.738197844f,
+    0.671558955f,  0.740951125f,
+    0.668522399f,  0.743692008f,
+    0.665474656f,  0.746420446f,
+    0.662415778f,  0.749136395f,
+    0.659345815f,  0.751839807f,
+    0.656264820f,  0.754530640f,
+    0.653172843f,  0.757208847f,
+    0.650069937f,  0.759874383f,
+    0.646956153f,  0.762527204f,
+    0.643831543f,  0.765167266f,
+    0.640696160f,  0.767794524f,
+    0.637550056f,  0.770408934f,
+    0.634393284f,  0.773010453f,
+    0.631225897f,  0.775599038f,
+    0.628047947f,  0.778174644f,
+    0.624859488f,  0.780737229f,
+    0.621660573f,  0.783286749f,
+    0.618451256f,  0.785823163f,
+    0.615231591f,  0.788346428f,
+    0.612001630f,  0.790856501f,
+    0.608761429f,  0.793353340f,
+    0.605511041f,  0.795836905f,
+    0.602250522f,  0.798307152f,
+    0.598979925f,  0.800764041f,
+    0.595699304f,  0.803207531f,
+    0.592408717f,  0.805637581f,
+    0.589108216f,  0.808054150f,
+    0.585797857f,  0.810457198f,
+    0.582477697f,  0.812846685f,
+    0.579147790f,  0.815222569f,
+    0.575808191f,  0.817584813f,
+    0.572458958f,  0.819933376f,
+    0.569100146f,  0.822268219f,
+    0.565731811f,  0.824589303f,
+    0.562354009f,  0.826896589f,
+    0.558966798f,  0.829190038f,
+    0.555570233f,  0.831469612f,
+    0.552164372f,  0.833735274f,
+    0.548749271f,  0.835986984f,
+    0.545324988f,  0.838224706f,
+    0.541891581f,  0.840448401f,
+    0.538449105f,  0.842658033f,
+    0.534997620f,  0.844853565f,
+    0.531537182f,  0.847034960f,
+    0.528067851f,  0.849202182f,
+    0.524589683f,  0.851355193f,
+    0.521102737f,  0.853493959f,
+    0.517607071f,  0.855618443f,
+    0.514102744f,  0.857728610f,
+    0.510589815f,  0.859824425f,
+    0.507068342f,  0.861905852f,
+    0.503538384f,  0.863972856f,
+    0.500000000f,  0.866025404f,
+    0.496453250f,  0.868063460f,
+    0.492898192f,  0.870086991f,
+    0.489334887f,  0.872095963f,
+    0.485763394f,  0.874090342f,
+    0.482183772f,  0.876070094f,
+    0.478596082f,  0.878035187f,
+    0.475000384f,  0.879985588f,
+    0.471396737f,  0.881921264f,
+    0.467785202f,  0.883842183f,
+    0.464165840f,  0.885748312f,
+    0.460538711f,  0.887639620f,
+    0.456903876f,  0.889516075f,
+    0.453261395f,  0.891377646f,
+    0.449611330f,  0.893224301f,
+    0.445953741f,  0.895056010f,
+    0.442288690f,  0.896872742f,
+    0.438616239f,  0.898674466f,
+    0.434936447f,  0.900461152f,
+    0.431249379f,  0.902232771f,
+    0.427555093f,  0.903989293f,
+    0.423853654f,  0.905730688f,
+    0.420145122f,  0.907456928f,
+    0.416429560f,  0.909167983f,
+    0.412707030f,  0.910863825f,
+    0.408977594f,  0.912544425f,
+    0.405241314f,  0.914209756f,
+    0.401498253f,  0.915859789f,
+    0.397748475f,  0.917494496f,
+    0.393992040f,  0.919113852f,
+    0.390229013f,  0.920717827f,
+    0.386459456f,  0.922306396f,
+    0.382683432f,  0.923879533f,
+    0.378901005f,  0.925437209f,
+    0.375112238f,  0.926979400f,
+    0.371317194f,  0.928506080f,
+    0.367515937f,  0.930017224f,
+    0.363708530f,  0.931512805f,
+    0.359895037f,  0.932992799f,
+    0.356075521f,  0.934457181f,
+    0.352250048f,  0.935905927f,
+    0.348418680f,  0.937339012f,
+    0.344581482f,  0.938756412f,
+    0.340738519f,  0.940158105f,
+    0.336889853f,  0.941544065f,
+    0.333035551f,  0.942914271f,
+    0.329175676f,  0.944268698f,
+    0.325310292f,  0.945607325f,
+    0.321439465f,  0.946930129f,
+    0.317563260f,  0.948237089f,
+    0.313681740f,  0.949528181f,
+    0.309794972f,  0.950803384f,
+    0.305903020f,  0.952062678f,
+    0.302005949f,  0.953306040f,
+    0.298103825f,  0.954533451f,
+    0.294196713f,  0.955744890f,
+    0.290284677f,  0.956940336f,
+    0.286367785f,  0.958119769f,
+    0.282446100f,  0.959283170f,
+    0.278519689f,  0.960430519f,
+    0.274588618f,  0.961561798f,
+    0.270652952f,  0.962676986f,
+    0.266712757f,  0.963776066f,
+    0.262768100f,  0.964859019f,
+    0.258819045f,  0.965925826f,
+    0.254865660f,  0.966976471f,
+    0.250908009f,  0.968010935f,
+    0.246946161f,  0.969029202f,
+    0.242980180f,  0.970031253f,
+    0.239010133f,  0.971017073f,
+    0.235036087f,  0.971986645f,
+    0.231058108f,  0.972939952f,
+    0.227076263f,  0.973876979f,
+    0.223090618f,  0.974797710f,
+    0.219101240f,  0.975702130f,
+    0.215108196f,  0.976590223f,
+    0.211111552f,  0.977461975f,
+    0.207111376f,  0.978317371f,
+    0.203107734f,  0.979156396f,
+    0.199100694f,  0.979979037f,
+    0.195090322f,  0.980785280f,
+    0.191076686f,  0.981575112f,
+    0.187059852f,  0.982348519f,
+    0.183039888f,  0.983105487f,
+    0.179016861f,  0.983846006f,
+    0.174990839f,  0.984570062f,
+    0.170961889f,  0.985277642f,
+    0.166930078f,  0.985968736f,
+    0.162895473f,  0.986643332f,
+    0.158858143f,  0.987301418f,
+    0.154818155f,  0.987942984f,
+    0.150775576f,  0.988568018f,
+    0.146730474f,  0.989176510f,
+    0.142682917f,  0.989768450f,
+    0.138632973f,  0.990343829f,
+    0.134580709f,  0.990902635f,
+    0.130526192f,  0.991444861f,
+    0.126469492f,  0.991970497f,
+    0.122410675f,  0.992479535f,
+    0.118349810f,  0.992971965f,
+    0.114286965f,  0.993447779f,
+    0.110222207f,  0.993906970f,
+    0.106155605f,  0.994349530f,
+    0.102087227f,  0.994775451f,
+    0.098017140f,  0.995184727f,
+    0.093945414f,  0.995577350f,
+    0.089872115f,  0.995953314f,
+    0.085797312f,  0.996312612f,
+    0.081721074f,  0.996655239f,
+    0.077643468f,  0.996981189f,
+    0.073564564f,  0.997290457f,
+    0.069484428f,  0.997583036f,
+    0.065403129f,  0.997858923f,
+    0.061320736f,  0.998118113f,
+    0.057237317f,  0.998360601f,
+    0.053152941f,  0.998586383f,
+    0.049067674f,  0.998795456f,
+    0.044981587f,  0.998987816f,
+    0.040894747f,  0.999163460f,
+    0.036807223f,  0.999322385f,
+    0.032719083f,  0.999464587f,
+    0.028630395f,  0.999590066f,
+    0.024541229f,  0.999698819f,
+    0.020451651f,  0.999790843f,
+    0.016361732f,  0.999866138f,
+    0.012271538f,  0.999924702f,
+    0.008181140f,  0.999966534f,
+    0.004090604f,  0.999991633f,
+    0.000000000f,  1.000000000f,
+   -0.004090604f,  0.999991633f,
+   -0.008181140f,  0.999966534f,
+   -0.012271538f,  0.999924702f,
+   -0.016361732f,  0.999866138f,
+   -0.020451651f,  0.999790843f,
+   -0.024541229f,  0.999698819f,
+   -0.028630395f,  0.999590066f,
+   -0.032719083f,  0.999464587f,
+   -0.036807223f,  0.999322385f,
+   -0.040894747f,  0.999163460f,
+   -0.044981587f,  0.998987816f,
+   -0.049067674f,  0.998795456f,
+   -0.053152941f,  0.998586383f,
+   -0.057237317f,  0.998360601f,
+   -0.061320736f,  0.998118113f,
+   -0.065403129f,  0.997858923f,
+   -0.069484428f,  0.997583036f,
+   -0.073564564f,  0.997290457f,
+   -0.077643468f,  0.996981189f,
+   -0.081721074f,  0.996655239f,
+   -0.085797312f,  0.996312612f,
+   -0.089872115f,  0.995953314f,
+   -0.093945414f,  0.995577350f,
+   -0.098017140f,  0.995184727f,
+   -0.102087227f,  0.994775451f,
+   -0.106155605f,  0.994349530f,
+   -0.110222207f,  0.993906970f,
+   -0.114286965f,  0.993447779f,
+   -0.118349810f,  0.992971965f,
+   -0.122410675f,  0.992479535f,
+   -0.126469492f,  0.991970497f,
+   -0.130526192f,  0.991444861f,
+   -0.134580709f,  0.990902635f,
+   -0.138632973f,  0.990343829f,
+   -0.142682917f,  0.989768450f,
+   -0.146730474f,  0.989176510f,
+   -0.150775576f,  0.988568018f,
+   -0.154818155f,  0.987942984f,
+   -0.158858143f,  0.987301418f,
+   -0.162895473f,  0.986643332f,
+   -0.166930078f,  0.985968736f,
+   -0.170961889f,  0.985277642f,
+   -0.174990839f,  0.984570062f,
+   -0.179016861f,  0.983846006f,
+   -0.183039888f,  0.983105487f,
+   -0.187059852f,  0.982348519f,
+   -0.191076686f,  0.981575112f,
+   -0.195090322f,  0.980785280f,
+   -0.199100694f,  0.979979037f,
+   -0.203107734f,  0.979156396f,
+   -0.207111376f,  0.978317371f,
+   -0.211111552f,  0.977461975f,
+   -0.215108196f,  0.976590223f,
+   -0.219101240f,  0.975702130f,
+   -0.223090618f,  0.974797710f,
+   -0.227076263f,  0.973876979f,
+   -0.231058108f,  0.972939952f,
+   -0.235036087f,  0.971986645f,
+   -0.239010133f,  0.971017073f,
+   -0.242980180f,  0.970031253f,
+   -0.246946161f,  0.969029202f,
+   -0.250908009f,  0.968010935f,
+   -0.254865660f,  0.966976471f,
+   -0.258819045f,  0.965925826f,
+   -0.262768100f,  0.964859019f,
+   -0.266712757f,  0.963776066f,
+   -0.270652952f,  0.962676986f,
+   -0.274588618f,  0.961561798f,
+   -0.278519689f,  0.960430519f,
+   -0.282446100f,  0.959283170f,
+   -0.286367785f,  0.958119769f,
+   -0.290284677f,  0.956940336f,
+   -0.294196713f,  0.955744890f,
+   -0.298103825f,  0.954533451f,
+   -0.302005949f,  0.953306040f,
+   -0.305903020f,  0.952062678f,
+   -0.309794972f,  0.950803384f,
+   -0.313681740f,  0.949528181f,
+   -0.317563260f,  0.948237089f,
+   -0.321439465f,  0.946930129f,
+   -0.325310292f,  0.945607325f,
+   -0.329175676f,  0.944268698f,
+   -0.333035551f,  0.942914271f,
+   -0.336889853f,  0.941544065f,
+   -0.340738519f,  0.940158105f,
+   -0.344581482f,  0.938756412f,
+   -0.348418680f,  0.937339012f,
+   -0.352250048f,  0.935905927f,
+   -0.356075521f,  0.934457181f,
+   -0.359895037f,  0.932992799f,
+   -0.363708530f,  0.931512805f,
+   -0.367515937f,  0.930017224f,
+   -0.371317194f,  0.928506080f,
+   -0.375112238f,  0.926979400f,
+   -0.378901005f,  0.925437209f,
+   -0.382683432f,  0.923879533f,
+   -0.386459456f,  0.922306396f,
+   -0.390229013f,  0.920717827f,
+   -0.393992040f,  0.919113852f,
+   -0.397748475f,  0.917494496f,
+   -0.401498253f,  0.915859789f,
+   -0.405241314f,  0.914209756f,
+   -0.408977594f,  0.912544425f,
+   -0.412707030f,  0.910863825f,
+   -0.416429560f,  0.909167983f,
+   -0.420145122f,  0.907456928f,
+   -0.423853654f,  0.905730688f,
+   -0.427555093f,  0.903989293f,
+   -0.431249379f,  0.902232771f,
+   -0.434936447f,  0.900461152f,
+   -0.438616239f,  0.898674466f,
+   -0.442288690f,  0.896872742f,
+   -0.445953741f,  0.895056010f,
+   -0.449611330f,  0.893224301f,
+   -0.453261395f,  0.891377646f,
+   -0.456903876f,  0.889516075f,
+   -0.460538711f,  0.887639620f,
+   -0.464165840f,  0.885748312f,
+   -0.467785202f,  0.883842183f,
+   -0.471396737f,  0.881921264f,
+   -0.475000384f,  0.879985588f,
+   -0.478596082f,  0.878035187f,
+   -0.482183772f,  0.876070094f,
+   -0.485763394f,  0.874090342f,
+   -0.489334887f,  0.872095963f,
+   -0.492898192f,  0.870086991f,
+   -0.496453250f,  0.868063460f,
+   -0.500000000f,  0.866025404f,
+   -0.503538384f,  0.863972856f,
+   -0.507068342f,  0.861905852f,
+   -0.510589815f,  0.859824425f,
+   -0.514102744f,  0.857728610f,
+   -0.517607071f,  0.855618443f,
+   -0.521102737f,  0.853493959f,
+   -0.524589683f,  0.851355193f,
+   -0.528067851f,  0.849202182f,
+   -0.531537182f,  0.847034960f,
+   -0.534997620f,  0.844853565f,
+   -0.538449105f,  0.842658033f,
+   -0.541891581f,  0.840448401f,
+   -0.545324988f,  0.838224706f,
+   -0.548749271f,  0.835986984f,
+   -0.552164372f,  0.833735274f,
+   -0.555570233f,  0.831469612f,
+   -0.558966798f,  0.829190038f,
+   -0.562354009f,  0.826896589f,
+   -0.565731811f,  0.824589303f,
+   -0.569100146f,  0.822268219f,
+   -0.572458958f,  0.819933376f,
+   -0.575808191f,  0.817584813f,
+   -0.579147790f,  0.815222569f,
+   -0.582477697f,  0.812846685f,
+   -0.585797857f,  0.810457198f,
+   -0.589108216f,  0.808054150f,
+   -0.592408717f,  0.805637581f,
+   -0.595699304f,  0.803207531f,
+   -0.598979925f,  0.800764041f,
+   -0.602250522f,  0.798307152f,
+   -0.605511041f,  0.795836905f,
+   -0.608761429f,  0.793353340f,
+   -0.612001630f,  0.790856501f,
+   -0.615231591f,  0.788346428f,
+   -0.618451256f,  0.785823163f,
+   -0.621660573f,  0.783286749f,
+   -0.624859488f,  0.780737229f,
+   -0.628047947f,  0.778174644f,
+   -0.631225897f,  0.775599038f,
+   -0.634393284f,  0.773010453f,
+   -0.637550056f,  0.770408934f,
+   -0.640696160f,  0.767794524f,
+   -0.643831543f,  0.765167266f,
+   -0.646956153f,  0.762527204f,
+   -0.650069937f,  0.759874383f,
+   -0.653172843f,  0.757208847f,
+   -0.656264820f,  0.754530640f,
+   -0.659345815f,  0.751839807f,
+   -0.662415778f,  0.749136395f,
+   -0.665474656f,  0.746420446f,
+   -0.668522399f,  0.743692008f,
+   -0.671558955f,  0.740951125f,
+   -0.674584274f,  0.738197844f,
+   -0.677598305f,  0.735432211f,
+   -0.680600998f,  0.732654272f,
+   -0.683592302f,  0.729864073f,
+   -0.686572168f,  0.727061661f,
+   -0.689540545f,  0.724247083f,
+   -0.692497384f,  0.721420386f,
+   -0.695442635f,  0.718581618f,
+   -0.698376249f,  0.715730825f,
+   -0.701298178f,  0.712868056f,
+   -0.704208371f,  0.709993359f,
+   -0.707106781f,  0.707106781f,
+   -0.709993359f,  0.704208371f,
+   -0.712868056f,  0.701298178f,
+   -0.715730825f,  0.698376249f,
+   -0.718581618f,  0.695442635f,
+   -0.721420386f,  0.692497384f,
+   -0.724247083f,  0.689540545f,
+   -0.727061661f,  0.686572168f,
+   -0.729864073f,  0.683592302f,
+   -0.732654272f,  0.680600998f,
+   -0.735432211f,  0.677598305f,
+   -0.738197844f,  0.674584274f,
+   -0.740951125f,  0.671558955f,
+   -0.743692008f,  0.668522399f,
+   -0.746420446f,  0.665474656f,
+   -0.749136395f,  0.662415778f,
+   -0.751839807f,  0.659345815f,
+   -0.754530640f,  0.656264820f,
+   -0.757208847f,  0.653172843f,
+   -0.759874383f,  0.650069937f,
+   -0.762527204f,  0.646956153f,
+   -0.765167266f,  0.643831543f,
+   -0.767794524f,  0.640696160f,
+   -0.770408934f,  0.637550056f,
+   -0.773010453f,  0.634393284f,
+   -0.775599038f,  0.631225897f,
+   -0.778174644f,  0.628047947f,
+   -0.780737229f,  0.624859488f,
+   -0.783286749f,  0.621660573f,
+   -0.785823163f,  0.618451256f,
+   -0.788346428f,  0.615231591f,
+   -0.790856501f,  0.612001630f,
+   -0.793353340f,  0.608761429f,
+   -0.795836905f,  0.605511041f,
+   -0.798307152f,  0.602250522f,
+   -0.800764041f,  0.598979925f,
+   -0.803207531f,  0.595699304f,
+   -0.805637581f,  0.592408717f,
+   -0.808054150f,  0.589108216f,
+   -0.810457198f,  0.585797857f,
+   -0.812846685f,  0.582477697f,
+   -0.815222569f,  0.579147790f,
+   -0.817584813f,  0.575808191f,
+   -0.819933376f,  0.572458958f,
+   -0.822268219f,  0.569100146f,
+   -0.824589303f,  0.565731811f,
+   -0.826896589f,  0.562354009f,
+   -0.829190038f,  0.558966798f,
+   -0.831469612f,  0.555570233f,
+   -0.833735274f,  0.552164372f,
+   -0.835986984f,  0.548749271f,
+   -0.838224706f,  0.545324988f,
+   -0.840448401f,  0.541891581f,
+   -0.842658033f,  0.538449105f,
+   -0.844853565f,  0.534997620f,
+   -0.847034960f,  0.531537182f,
+   -0.849202182f,  0.528067851f,
+   -0.851355193f,  0.524589683f,
+   -0.853493959f,  0.521102737f,
+   -0.855618443f,  0.517607071f,
+   -0.857728610f,  0.514102744f,
+   -0.859824425f,  0.510589815f,
+   -0.861905852f,  0.507068342f,
+   -0.863972856f,  0.503538384f,
+   -0.866025404f,  0.500000000f,
+   -0.868063460f,  0.496453250f,
+   -0.870086991f,  0.492898192f,
+   -0.872095963f,  0.489334887f,
+   -0.874090342f,  0.485763394f,
+   -0.876070094f,  0.482183772f,
+   -0.878035187f,  0.478596082f,
+   -0.879985588f,  0.475000384f,
+   -0.881921264f,  0.471396737f,
+   -0.883842183f,  0.467785202f,
+   -0.885748312f,  0.464165840f,
+   -0.887639620f,  0.460538711f,
+   -0.889516075f,  0.456903876f,
+   -0.891377646f,  0.453261395f,
+   -0.893224301f,  0.449611330f,
+   -0.895056010f,  0.445953741f,
+   -0.896872742f,  0.442288690f,
+   -0.898674466f,  0.438616239f,
+   -0.900461152f,  0.434936447f,
+   -0.902232771f,  0.431249379f,
+   -0.903989293f,  0.427555093f,
+   -0.905730688f,  0.423853654f,
+   -0.907456928f,  0.420145122f,
+   -0.909167983f,  0.416429560f,
+   -0.910863825f,  0.412707030f,
+   -0.912544425f,  0.408977594f,
+   -0.914209756f,  0.405241314f,
+   -0.915859789f,  0.401498253f,
+   -0.917494496f,  0.397748475f,
+   -0.919113852f,  0.393992040f,
+   -0.920717827f,  0.390229013f,
+   -0.922306396f,  0.386459456f,
+   -0.923879533f,  0.382683432f,
+   -0.925437209f,  0.378901005f,
+   -0.926979400f,  0.375112238f,
+   -0.928506080f,  0.371317194f,
+   -0.930017224f,  0.367515937f,
+   -0.931512805f,  0.363708530f,
+   -0.932992799f,  0.359895037f,
+   -0.934457181f,  0.356075521f,
+   -0.935905927f,  0.352250048f,
+   -0.937339012f,  0.348418680f,
+   -0.938756412f,  0.344581482f,
+   -0.940158105f,  0.340738519f,
+   -0.941544065f,  0.336889853f,
+   -0.942914271f,  0.333035551f,
+   -0.944268698f,  0.329175676f,
+   -0.945607325f,  0.325310292f,
+   -0.946930129f,  0.321439465f,
+   -0.948237089f,  0.317563260f,
+   -0.949528181f,  0.313681740f,
+   -0.950803384f,  0.309794972f,
+   -0.952062678f,  0.305903020f,
+   -0.953306040f,  0.302005949f,
+   -0.954533451f,  0.298103825f,
+   -0.955744890f,  0.294196713f,
+   -0.956940336f,  0.290284677f,
+   -0.958119769f,  0.286367785f,
+   -0.959283170f,  0.282446100f,
+   -0.960430519f,  0.278519689f,
+   -0.961561798f,  0.274588618f,
+   -0.962676986f,  0.270652952f,
+   -0.963776066f,  0.266712757f,
+   -0.964859019f,  0.262768100f,
+   -0.965925826f,  0.258819045f,
+   -0.966976471f,  0.254865660f,
+   -0.968010935f,  0.250908009f,
+   -0.969029202f,  0.246946161f,
+   -0.970031253f,  0.242980180f,
+   -0.971017073f,  0.239010133f,
+   -0.971986645f,  0.235036087f,
+   -0.972939952f,  0.231058108f,
+   -0.973876979f,  0.227076263f,
+   -0.974797710f,  0.223090618f,
+   -0.975702130f,  0.219101240f,
+   -0.976590223f,  0.215108196f,
+   -0.977461975f,  0.211111552f,
+   -0.978317371f,  0.207111376f,
+   -0.979156396f,  0.203107734f,
+   -0.979979037f,  0.199100694f,
+   -0.980785280f,  0.195090322f,
+   -0.981575112f,  0.191076686f,
+   -0.982348519f,  0.187059852f,
+   -0.983105487f,  0.183039888f,
+   -0.983846006f,  0.179016861f,
+   -0.984570062f,  0.174990839f,
+   -0.985277642f,  0.170961889f,
+   -0.985968736f,  0.166930078f,
+   -0.986643332f,  0.162895473f,
+   -0.987301418f,  0.158858143f,
+   -0.987942984f,  0.154818155f,
+   -0.988568018f,  0.150775576f,
+   -0.989176510f,  0.146730474f,
+   -0.989768450f,  0.142682917f,
+   -0.990343829f,  0.138632973f,
+   -0.990902635f,  0.134580709f,
+   -0.991444861f,  0.130526192f,
+   -0.991970497f,  0.126469492f,
+   -0.992479535f,  0.122410675f,
+   -0.992971965f,  0.118349810f,
+   -0.993447779f,  0.114286965f,
+   -0.993906970f,  0.110222207f,
+   -0.994349530f,  0.106155605f,
+   -0.994775451f,  0.102087227f,
+   -0.995184727f,  0.098017140f,
+   -0.995577350f,  0.093945414f,
+   -0.995953314f,  0.089872115f,
+   -0.996312612f,  0.085797312f,
+   -0.996655239f,  0.081721074f,
+   -0.996981189f,  0.077643468f,
+   -0.997290457f,  0.073564564f,
+   -0.997583036f,  0.069484428f,
+   -0.997858923f,  0.065403129f,
+   -0.998118113f,  0.061320736f,
+   -0.998360601f,  0.057237317f,
+   -0.998586383f,  0.053152941f,
+   -0.998795456f,  0.049067674f,
+   -0.998987816f,  0.044981587f,
+   -0.999163460f,  0.040894747f,
+   -0.999322385f,  0.036807223f,
+   -0.999464587f,  0.032719083f,
+   -0.999590066f,  0.028630395f,
+   -0.999698819f,  0.024541229f,
+   -0.999790843f,  0.020451651f,
+   -0.999866138f,  0.016361732f,
+   -0.999924702f,  0.012271538f,
+   -0.999966534f,  0.008181140f,
+   -0.999991633f,  0.004090604f,
+   -1.000000000f,  0.000000000f,
+   -0.999991633f, -0.004090604f,
+   -0.999966534f, -0.008181140f,
+   -0.999924702f, -0.012271538f,
+   -0.999866138f, -0.016361732f,
+   -0.999790843f, -0.020451651f,
+   -0.999698819f, -0.024541229f,
+   -0.999590066f, -0.028630395f,
+   -0.999464587f, -0.032719083f,
+   -0.999322385f, -0.036807223f,
+   -0.999163460f, -0.040894747f,
+   -0.998987816f, -0.044981587f,
+   -0.998795456f, -0.049067674f,
+   -0.998586383f, -0.053152941f,
+   -0.998360601f, -0.057237317f,
+   -0.998118113f, -0.061320736f,
+   -0.997858923f, -0.065403129f,
+   -0.997583036f, -0.069484428f,
+   -0.997290457f, -0.073564564f,
+   -0.996981189f, -0.077643468f,
+   -0.996655239f, -0.081721074f,
+   -0.996312612f, -0.085797312f,
+   -0.995953314f, -0.089872115f,
+   -0.995577350f, -0.093945414f,
+   -0.995184727f, -0.098017140f,
+   -0.994775451f, -0.102087227f,
+   -0.994349530f, -0.106155605f,
+   -0.993906970f, -0.110222207f,
+   -0.993447779f, -0.114286965f,
+   -0.992971965f, -0.118349810f,
+   -0.992479535f, -0.122410675f,
+   -0.991970497f, -0.126469492f,
+   -0.991444861f, -0.130526192f,
+   -0.990902635f, -0.134580709f,
+   -0.990343829f, -0.138632973f,
+   -0.989768450f, -0.142682917f,
+   -0.989176510f, -0.146730474f,
+   -0.988568018f, -0.150775576f,
+   -0.987942984f, -0.154818155f,
+   -0.987301418f, -0.158858143f,
+   -0.986643332f, -0.162895473f,
+   -0.985968736f, -0.166930078f,
+   -0.985277642f, -0.170961889f,
+   -0.984570062f, -0.174990839f,
+   -0.983846006f, -0.179016861f,
+   -0.983105487f, -0.183039888f,
+   -0.982348519f, -0.187059852f,
+   -0.981575112f, -0.191076686f,
+   -0.980785280f, -0.195090322f,
+   -0.979979037f, -0.199100694f,
+   -0.979156396f, -0.203107734f,
+   -0.978317371f, -0.207111376f,
+   -0.977461975f, -0.211111552f,
+   -0.976590223f, -0.215108196f,
+   -0.975702130f, -0.219101240f,
+   -0.974797710f, -0.223090618f,
+   -0.973876979f, -0.227076263f,
+   -0.972939952f, -0.231058108f,
+   -0.971986645f, -0.235036087f,
+   -0.971017073f, -0.239010133f,
+   -0.970031253f, -0.242980180f,
+   -0.969029202f, -0.246946161f,
+   -0.968010935f, -0.250908009f,
+   -0.966976471f, -0.254865660f,
+   -0.965925826f, -0.258819045f,
+   -0.964859019f, -0.262768100f,
+   -0.963776066f, -0.266712757f,
+   -0.962676986f, -0.270652952f,
+   -0.961561798f, -0.274588618f,
+   -0.960430519f, -0.278519689f,
+   -0.959283170f, -0.282446100f,
+   -0.958119769f, -0.286367785f,
+   -0.956940336f, -0.290284677f,
+   -0.955744890f, -0.294196713f,
+   -0.954533451f, -0.298103825f,
+   -0.953306040f, -0.302005949f,
+   -0.952062678f, -0.305903020f,
+   -0.950803384f, -0.309794972f,
+   -0.949528181f, -0.313681740f,
+   -0.948237089f, -0.317563260f,
+   -0.946930129f, -0.321439465f,
+   -0.945607325f, -0.325310292f,
+   -0.944268698f, -0.329175676f,
+   -0.942914271f, -0.333035551f,
+   -0.941544065f, -0.336889853f,
+   -0.940158105f, -0.340738519f,
+   -0.938756412f, -0.344581482f,
+   -0.937339012f, -0.348418680f,
+   -0.935905927f, -0.352250048f,
+   -0.934457181f, -0.356075521f,
+   -0.932992799f, -0.359895037f,
+   -0.931512805f, -0.363708530f,
+   -0.930017224f, -0.367515937f,
+   -0.928506080f, -0.371317194f,
+   -0.926979400f, -0.375112238f,
+   -0.925437209f, -0.378901005f,
+   -0.923879533f, -0.382683432f,
+   -0.922306396f, -0.386459456f,
+   -0.920717827f, -0.390229013f,
+   -0.919113852f, -0.393992040f,
+   -0.917494496f, -0.397748475f,
+   -0.915859789f, -0.401498253f,
+   -0.914209756f, -0.405241314f,
+   -0.912544425f, -0.408977594f,
+   -0.910863825f, -0.412707030f,
+   -0.909167983f, -0.416429560f,
+   -0.907456928f, -0.420145122f,
+   -0.905730688f, -0.423853654f,
+   -0.903989293f, -0.427555093f,
+   -0.902232771f, -0.431249379f,
+   -0.900461152f, -0.434936447f,
+   -0.898674466f, -0.438616239f,
+   -0.896872742f, -0.442288690f,
+   -0.895056010f, -0.445953741f,
+   -0.893224301f, -0.449611330f,
+   -0.891377646f, -0.453261395f,
+   -0.889516075f, -0.456903876f,
+   -0.887639620f, -0.460538711f,
+   -0.885748312f, -0.464165840f,
+   -0.883842183f, -0.467785202f,
+   -0.881921264f, -0.471396737f,
+   -0.879985588f, -0.475000384f,
+   -0.878035187f, -0.478596082f,
+   -0.876070094f, -0.482183772f,
+   -0.874090342f, -0.485763394f,
+   -0.872095963f, -0.489334887f,
+   -0.870086991f, -0.492898192f,
+   -0.868063460f, -0.496453250f,
+   -0.866025404f, -0.500000000f,
+   -0.863972856f, -0.503538384f,
+   -0.861905852f, -0.507068342f,
+   -0.859824425f, -0.510589815f,
+   -0.857728610f, -0.514102744f,
+   -0.855618443f, -0.517607071f,
+   -0.853493959f, -0.521102737f,
+   -0.851355193f, -0.524589683f,
+   -0.849202182f, -0.528067851f,
+   -0.847034960f, -0.531537182f,
+   -0.844853565f, -0.534997620f,
+   -0.842658033f, -0.538449105f,
+   -0.840448401f, -0.541891581f,
+   -0.838224706f, -0.545324988f,
+   -0.835986984f, -0.548749271f,
+   -0.833735274f, -0.552164372f,
+   -0.831469612f, -0.555570233f,
+   -0.829190038f, -0.558966798f,
+   -0.826896589f, -0.562354009f,
+   -0.824589303f, -0.565731811f,
+   -0.822268219f, -0.569100146f,
+   -0.819933376f, -0.572458958f,
+   -0.817584813f, -0.575808191f,
+   -0.815222569f, -0.579147790f,
+   -0.812846685f, -0.582477697f,
+   -0.810457198f, -0.585797857f,
+   -0.808054150f, -0.589108216f,
+   -0.805637581f, -0.592408717f,
+   -0.803207531f, -0.595699304f,
+   -0.800764041f, -0.598979925f,
+   -0.798307152f, -0.602250522f,
+   -0.795836905f, -0.605511041f,
+   -0.793353340f, -0.608761429f,
+   -0.790856501f, -0.612001630f,
+   -0.788346428f, -0.615231591f,
+   -0.785823163f, -0.618451256f,
+   -0.783286749f, -0.621660573f,
+   -0.780737229f, -0.624859488f,
+   -0.778174644f, -0.628047947f,
+   -0.775599038f, -0.631225897f,
+   -0.773010453f, -0.634393284f,
+   -0.770408934f, -0.637550056f,
+   -0.767794524f, -0.640696160f,
+   -0.765167266f, -0.643831543f,
+   -0.762527204f, -0.646956153f,
+   -0.759874383f, -0.650069937f,
+   -0.757208847f, -0.653172843f,
+   -0.754530640f, -0.656264820f,
+   -0.751839807f, -0.659345815f,
+   -0.749136395f, -0.662415778f,
+   -0.746420446f, -0.665474656f,
+   -0.743692008f, -0.668522399f,
+   -0.740951125f, -0.671558955f,
+   -0.738197844f, -0.674584274f,
+   -0.735432211f, -0.677598305f,
+   -0.732654272f, -0.680600998f,
+   -0.729864073f, -0.683592302f,
+   -0.727061661f, -0.686572168f,
+   -0.724247083f, -0.689540545f,
+   -0.721420386f, -0.692497384f,
+   -0.718581618f, -0.695442635f,
+   -0.715730825f, -0.698376249f,
+   -0.712868056f, -0.701298178f,
+   -0.709993359f, -0.704208371f,
+   -0.707106781f, -0.707106781f,
+   -0.704208371f, -0.709993359f,
+   -0.701298178f, -0.712868056f,
+   -0.698376249f, -0.715730825f,
+   -0.695442635f, -0.718581618f,
+   -0.692497384f, -0.721420386f,
+   -0.689540545f, -0.724247083f,
+   -0.686572168f, -0.727061661f,
+   -0.683592302f, -0.729864073f,
+   -0.680600998f, -0.732654272f,
+   -0.677598305f, -0.735432211f,
+   -0.674584274f, -0.738197844f,
+   -0.671558955f, -0.740951125f,
+   -0.668522399f, -0.743692008f,
+   -0.665474656f, -0.746420446f,
+   -0.662415778f, -0.749136395f,
+   -0.659345815f, -0.751839807f,
+   -0.656264820f, -0.754530640f,
+   -0.653172843f, -0.757208847f,
+   -0.650069937f, -0.759874383f,
+   -0.646956153f, -0.762527204f,
+   -0.643831543f, -0.765167266f,
+   -0.640696160f, -0.767794524f,
+   -0.637550056f, -0.770408934f,
+   -0.634393284f, -0.773010453f,
+   -0.631225897f, -0.775599038f,
+   -0.628047947f, -0.778174644f,
+   -0.624859488f, -0.780737229f,
+   -0.621660573f, -0.783286749f,
+   -0.618451256f, -0.785823163f,
+   -0.615231591f, -0.788346428f,
+   -0.612001630f, -0.790856501f,
+   -0.608761429f, -0.793353340f,
+   -0.605511041f, -0.795836905f,
+   -0.602250522f, -0.798307152f,
+   -0.598979925f, -0.800764041f,
+   -0.595699304f, -0.803207531f,
+   -0.592408717f, -0.805637581f,
+   -0.589108216f, -0.808054150f,
+   -0.585797857f, -0.810457198f,
+   -0.582477697f, -0.812846685f,
+   -0.579147790f, -0.815222569f,
+   -0.575808191f, -0.817584813f,
+   -0.572458958f, -0.819933376f,
+   -0.569100146f, -0.822268219f,
+   -0.565731811f, -0.824589303f,
+   -0.562354009f, -0.826896589f,
+   -0.558966798f, -0.829190038f,
+   -0.555570233f, -0.831469612f,
+   -0.552164372f, -0.833735274f,
+   -0.548749271f, -0.835986984f,
+   -0.545324988f, -0.838224706f,
+   -0.541891581f, -0.840448401f,
+   -0.538449105f, -0.842658033f,
+   -0.534997620f, -0.844853565f,
+   -0.531537182f, -0.847034960f,
+   -0.528067851f, -0.849202182f,
+   -0.524589683f, -0.851355193f,
+   -0.521102737f, -0.853493959f,
+   -0.517607071f, -0.855618443f,
+   -0.514102744f, -0.857728610f,
+   -0.510589815f, -0.859824425f,
+   -0.507068342f, -0.861905852f,
+   -0.503538384f, -0.863972856f,
+   -0.500000000f, -0.866025404f,
+   -0.496453250f, -0.868063460f,
+   -0.492898192f, -0.870086991f,
+   -0.489334887f, -0.872095963f,
+   -0.485763394f, -0.874090342f,
+   -0.482183772f, -0.876070094f,
+   -0.478596082f, -0.878035187f,
+   -0.475000384f, -0.879985588f,
+   -0.471396737f, -0.881921264f,
+   -0.467785202f, -0.883842183f,
+   -0.464165840f, -0.885748312f,
+   -0.460538711f, -0.887639620f,
+   -0.456903876f, -0.889516075f,
+   -0.453261395f, -0.891377646f,
+   -0.449611330f, -0.893224301f,
+   -0.445953741f, -0.895056010f,
+   -0.442288690f, -0.896872742f,
+   -0.438616239f, -0.898674466f,
+   -0.434936447f, -0.900461152f,
+   -0.431249379f, -0.902232771f,
+   -0.427555093f, -0.903989293f,
+   -0.423853654f, -0.905730688f,
+   -0.420145122f, -0.907456928f,
+   -0.416429560f, -0.909167983f,
+   -0.412707030f, -0.910863825f,
+   -0.408977594f, -0.912544425f,
+   -0.405241314f, -0.914209756f,
+   -0.401498253f, -0.915859789f,
+   -0.397748475f, -0.917494496f,
+   -0.393992040f, -0.919113852f,
+   -0.390229013f, -0.920717827f,
+   -0.386459456f, -0.922306396f,
+   -0.382683432f, -0.923879533f,
+   -0.378901005f, -0.925437209f,
+   -0.375112238f, -0.926979400f,
+   -0.371317194f, -0.928506080f,
+   -0.367515937f, -0.930017224f,
+   -0.363708530f, -0.931512805f,
+   -0.359895037f, -0.932992799f,
+   -0.356075521f, -0.934457181f,
+   -0.352250048f, -0.935905927f,
+   -0.348418680f, -0.937339012f,
+   -0.344581482f, -0.938756412f,
+   -0.340738519f, -0.940158105f,
+   -0.336889853f, -0.941544065f,
+   -0.333035551f, -0.942914271f,
+   -0.329175676f, -0.944268698f,
+   -0.325310292f, -0.945607325f,
+   -0.321439465f, -0.946930129f,
+   -0.317563260f, -0.948237089f,
+   -0.313681740f, -0.949528181f,
+   -0.309794972f, -0.950803384f,
+   -0.305903020f, -0.952062678f,
+   -0.302005949f, -0.953306040f,
+   -0.298103825f, -0.954533451f,
+   -0.294196713f, -0.955744890f,
+   -0.290284677f, -0.956940336f,
+   -0.286367785f, -0.958119769f,
+   -0.282446100f, -0.959283170f,
+   -0.278519689f, -0.960430519f,
+   -0.274588618f, -0.961561798f,
+   -0.270652952f, -0.962676986f,
+   -0.266712757f, -0.963776066f,
+   -0.262768100f, -0.964859019f,
+   -0.258819045f, -0.965925826f,
+   -0.254865660f, -0.966976471f,
+   -0.250908009f, -0.968010935f,
+   -0.246946161f, -0.969029202f,
+   -0.242980180f, -0.970031253f,
+   -0.239010133f, -0.971017073f,
+   -0.235036087f, -0.971986645f,
+   -0.231058108f, -0.972939952f,
+   -0.227076263f, -0.973876979f,
+   -0.223090618f, -0.974797710f,
+   -0.219101240f, -0.975702130f,
+   -0.215108196f, -0.976590223f,
+   -0.211111552f, -0.977461975f,
+   -0.207111376f, -0.978317371f,
+   -0.203107734f, -0.979156396f,
+   -0.199100694f, -0.979979037f,
+   -0.195090322f, -0.980785280f,
+   -0.191076686f, -0.981575112f,
+   -0.187059852f, -0.982348519f,
+   -0.183039888f, -0.983105487f,
+   -0.179016861f, -0.983846006f,
+   -0.174990839f, -0.984570062f,
+   -0.170961889f, -0.985277642f,
+   -0.166930078f, -0.985968736f,
+   -0.162895473f, -0.986643332f,
+   -0.158858143f, -0.987301418f,
+   -0.154818155f, -0.987942984f,
+   -0.150775576f, -0.988568018f,
+   -0.146730474f, -0.989176510f,
+   -0.142682917f, -0.989768450f,
+   -0.138632973f, -0.990343829f,
+   -0.134580709f, -0.990902635f,
+   -0.130526192f, -0.991444861f,
+   -0.126469492f, -0.991970497f,
+   -0.122410675f, -0.992479535f,
+   -0.118349810f, -0.992971965f,
+   -0.114286965f, -0.993447779f,
+   -0.110222207f, -0.993906970f,
+   -0.106155605f, -0.994349530f,
+   -0.102087227f, -0.994775451f,
+   -0.098017140f, -0.995184727f,
+   -0.093945414f, -0.995577350f,
+   -0.089872115f, -0.995953314f,
+   -0.085797312f, -0.996312612f,
+   -0.081721074f, -0.996655239f,
+   -0.077643468f, -0.996981189f,
+   -0.073564564f, -0.997290457f,
+   -0.069484428f, -0.997583036f,
+   -0.065403129f, -0.997858923f,
+   -0.061320736f, -0.998118113f,
+   -0.057237317f, -0.998360601f,
+   -0.053152941f, -0.998586383f,
+   -0.049067674f, -0.998795456f,
+   -0.044981587f, -0.998987816f,
+   -0.040894747f, -0.999163460f,
+   -0.036807223f, -0.999322385f,
+   -0.032719083f, -0.999464587f,
+   -0.028630395f, -0.999590066f,
+   -0.024541229f, -0.999698819f,
+   -0.020451651f, -0.999790843f,
+   -0.016361732f, -0.999866138f,
+   -0.012271538f, -0.999924702f,
+   -0.008181140f, -0.999966534f,
+   -0.004090604f, -0.999991633f,
+   -0.000000000f, -1.000000000f,
+    0.004090604f, -0.999991633f,
+    0.008181140f, -0.999966534f,
+    0.012271538f, -0.999924702f,
+    0.016361732f, -0.999866138f,
+    0.020451651f, -0.999790843f,
+    0.024541229f, -0.999698819f,
+    0.028630395f, -0.999590066f,
+    0.032719083f, -0.999464587f,
+    0.036807223f, -0.999322385f,
+    0.040894747f, -0.999163460f,
+    0.044981587f, -0.998987816f,
+    0.049067674f, -0.998795456f,
+    0.053152941f, -0.998586383f,
+    0.057237317f, -0.998360601f,
+    0.061320736f, -0.998118113f,
+    0.065403129f, -0.997858923f,
+    0.069484428f, -0.997583036f,
+    0.073564564f, -0.997290457f,
+    0.077643468f, -0.996981189f,
+    0.081721074f, -0.996655239f,
+    0.085797312f, -0.996312612f,
+    0.089872115f, -0.995953314f,
+    0.093945414f, -0.995577350f,
+    0.098017140f, -0.995184727f,
+    0.102087227f, -0.994775451f,
+    0.106155605f, -0.994349530f,
+    0.110222207f, -0.993906970f,
+    0.114286965f, -0.993447779f,
+    0.118349810f, -0.992971965f,
+    0.122410675f, -0.992479535f,
+    0.126469492f, -0.991970497f,
+    0.130526192f, -0.991444861f,
+    0.134580709f, -0.990902635f,
+    0.138632973f, -0.990343829f,
+    0.142682917f, -0.989768450f,
+    0.146730474f, -0.989176510f,
+    0.150775576f, -0.988568018f,
+    0.154818155f, -0.987942984f,
+    0.158858143f, -0.987301418f,
+    0.162895473f, -0.986643332f,
+    0.166930078f, -0.985968736f,
+    0.170961889f, -0.985277642f,
+    0.174990839f, -0.984570062f,
+    0.179016861f, -0.983846006f,
+    0.183039888f, -0.983105487f,
+    0.187059852f, -0.982348519f,
+    0.191076686f, -0.981575112f,
+    0.195090322f, -0.980785280f,
+    0.199100694f, -0.979979037f,
+    0.203107734f, -0.979156396f,
+    0.207111376f, -0.978317371f,
+    0.211111552f, -0.977461975f,
+    0.215108196f, -0.976590223f,
+    0.219101240f, -0.975702130f,
+    0.223090618f, -0.974797710f,
+    0.227076263f, -0.973876979f,
+    0.231058108f, -0.972939952f,
+    0.235036087f, -0.971986645f,
+    0.239010133f, -0.971017073f,
+    0.242980180f, -0.970031253f,
+    0.246946161f, -0.969029202f,
+    0.250908009f, -0.968010935f,
+    0.254865660f, -0.966976471f,
+    0.258819045f, -0.965925826f,
+    0.262768100f, -0.964859019f,
+    0.266712757f, -0.963776066f,
+    0.270652952f, -0.962676986f,
+    0.274588618f, -0.961561798f,
+    0.278519689f, -0.960430519f,
+    0.282446100f, -0.959283170f,
+    0.286367785f, -0.958119769f,
+    0.290284677f, -0.956940336f,
+    0.294196713f, -0.955744890f,
+    0.298103825f, -0.954533451f,
+    0.302005949f, -0.953306040f,
+    0.305903020f, -0.952062678f,
+    0.309794972f, -0.950803384f,
+    0.313681740f, -0.949528181f,
+    0.317563260f, -0.948237089f,
+    0.321439465f, -0.946930129f,
+    0.325310292f, -0.945607325f,
+    0.329175676f, -0.944268698f,
+    0.333035551f, -0.942914271f,
+    0.336889853f, -0.941544065f,
+    0.340738519f, -0.940158105f,
+    0.344581482f, -0.938756412f,
+    0.348418680f, -0.937339012f,
+    0.352250048f, -0.935905927f,
+    0.356075521f, -0.934457181f,
+    0.359895037f, -0.932992799f,
+    0.363708530f, -0.931512805f,
+    0.367515937f, -0.930017224f,
+    0.371317194f, -0.928506080f,
+    0.375112238f, -0.926979400f,
+    0.378901005f, -0.925437209f,
+    0.382683432f, -0.923879533f,
+    0.386459456f, -0.922306396f,
+    0.390229013f, -0.920717827f,
+    0.393992040f, -0.919113852f,
+    0.397748475f, -0.917494496f,
+    0.401498253f, -0.915859789f,
+    0.405241314f, -0.914209756f,
+    0.408977594f, -0.912544425f,
+    0.412707030f, -0.910863825f,
+    0.416429560f, -0.909167983f,
+    0.420145122f, -0.907456928f,
+    0.423853654f, -0.905730688f,
+    0.427555093f, -0.903989293f,
+    0.431249379f, -0.902232771f,
+    0.434936447f, -0.900461152f,
+    0.438616239f, -0.898674466f,
+    0.442288690f, -0.896872742f,
+    0.445953741f, -0.895056010f,
+    0.449611330f, -0.893224301f,
+    0.453261395f, -0.891377646f,
+    0.456903876f, -0.889516075f,
+    0.460538711f, -0.887639620f,
+    0.464165840f, -0.885748312f,
+    0.467785202f, -0.883842183f,
+    0.471396737f, -0.881921264f,
+    0.475000384f, -0.879985588f,
+    0.478596082f, -0.878035187f,
+    0.482183772f, -0.876070094f,
+    0.485763394f, -0.874090342f,
+    0.489334887f, -0.872095963f,
+    0.492898192f, -0.870086991f,
+    0.496453250f, -0.868063460f,
+    0.500000000f, -0.866025404f,
+    0.503538384f, -0.863972856f,
+    0.507068342f, -0.861905852f,
+    0.510589815f, -0.859824425f,
+    0.514102744f, -0.857728610f,
+    0.517607071f, -0.855618443f,
+    0.521102737f, -0.853493959f,
+    0.524589683f, -0.851355193f,
+    0.528067851f, -0.849202182f,
+    0.531537182f, -0.847034960f,
+    0.534997620f, -0.844853565f,
+    0.538449105f, -0.842658033f,
+    0.541891581f, -0.840448401f,
+    0.545324988f, -0.838224706f,
+    0.548749271f, -0.835986984f,
+    0.552164372f, -0.833735274f,
+    0.555570233f, -0.831469612f,
+    0.558966798f, -0.829190038f,
+    0.562354009f, -0.826896589f,
+    0.565731811f, -0.824589303f,
+    0.569100146f, -0.822268219f,
+    0.572458958f, -0.819933376f,
+    0.575808191f, -0.817584813f,
+    0.579147790f, -0.815222569f,
+    0.582477697f, -0.812846685f,
+    0.585797857f, -0.810457198f,
+    0.589108216f, -0.808054150f,
+    0.592408717f, -0.805637581f,
+    0.595699304f, -0.803207531f,
+    0.598979925f, -0.800764041f,
+    0.602250522f, -0.798307152f,
+    0.605511041f, -0.795836905f,
+    0.608761429f, -0.793353340f,
+    0.612001630f, -0.790856501f,
+    0.615231591f, -0.788346428f,
+    0.618451256f, -0.785823163f,
+    0.621660573f, -0.783286749f,
+    0.624859488f, -0.780737229f,
+    0.628047947f, -0.778174644f,
+    0.631225897f, -0.775599038f,
+    0.634393284f, -0.773010453f,
+    0.637550056f, -0.770408934f,
+    0.640696160f, -0.767794524f,
+    0.643831543f, -0.765167266f,
+    0.646956153f, -0.762527204f,
+    0.650069937f, -0.759874383f,
+    0.653172843f, -0.757208847f,
+    0.656264820f, -0.754530640f,
+    0.659345815f, -0.751839807f,
+    0.662415778f, -0.749136395f,
+    0.665474656f, -0.746420446f,
+    0.668522399f, -0.743692008f,
+    0.671558955f, -0.740951125f,
+    0.674584274f, -0.738197844f,
+    0.677598305f, -0.735432211f,
+    0.680600998f, -0.732654272f,
+    0.683592302f, -0.729864073f,
+    0.686572168f, -0.727061661f,
+    0.689540545f, -0.724247083f,
+    0.692497384f, -0.721420386f,
+    0.695442635f, -0.718581618f,
+    0.698376249f, -0.715730825f,
+    0.701298178f, -0.712868056f,
+    0.704208371f, -0.709993359f,
+    0.707106781f, -0.707106781f,
+    0.709993359f, -0.704208371f,
+    0.712868056f, -0.701298178f,
+    0.715730825f, -0.698376249f,
+    0.718581618f, -0.695442635f,
+    0.721420386f, -0.692497384f,
+    0.724247083f, -0.689540545f,
+    0.727061661f, -0.686572168f,
+    0.729864073f, -0.683592302f,
+    0.732654272f, -0.680600998f,
+    0.735432211f, -0.677598305f,
+    0.738197844f, -0.674584274f,
+    0.740951125f, -0.671558955f,
+    0.743692008f, -0.668522399f,
+    0.746420446f, -0.665474656f,
+    0.749136395f, -0.662415778f,
+    0.751839807f, -0.659345815f,
+    0.754530640f, -0.656264820f,
+    0.757208847f, -0.653172843f,
+    0.759874383f, -0.650069937f,
+    0.762527204f, -0.646956153f,
+    0.765167266f, -0.643831543f,
+    0.767794524f, -0.640696160f,
+    0.770408934f, -0.637550056f,
+    0.773010453f, -0.634393284f,
+    0.775599038f, -0.631225897f,
+    0.778174644f, -0.628047947f,
+    0.780737229f, -0.624859488f,
+    0.783286749f, -0.621660573f,
+    0.785823163f, -0.618451256f,
+    0.788346428f, -0.615231591f,
+    0.790856501f, -0.612001630f,
+    0.793353340f, -0.608761429f,
+    0.795836905f, -0.605511041f,
+    0.798307152f, -0.602250522f,
+    0.800764041f, -0.598979925f,
+    0.803207531f, -0.595699304f,
+    0.805637581f, -0.592408717f,
+    0.808054150f, -0.589108216f,
+    0.810457198f, -0.585797857f,
+    0.812846685f, -0.582477697f,
+    0.815222569f, -0.579147790f,
+    0.817584813f, -0.575808191f,
+    0.819933376f, -0.572458958f,
+    0.822268219f, -0.569100146f,
+    0.824589303f, -0.565731811f,
+    0.826896589f, -0.562354009f,
+    0.829190038f, -0.558966798f,
+    0.831469612f, -0.555570233f,
+    0.833735274f, -0.552164372f,
+    0.835986984f, -0.548749271f,
+    0.838224706f, -0.545324988f,
+    0.840448401f, -0.541891581f,
+    0.842658033f, -0.538449105f,
+    0.844853565f, -0.534997620f,
+    0.847034960f, -0.531537182f,
+    0.849202182f, -0.528067851f,
+    0.851355193f, -0.524589683f,
+    0.853493959f, -0.521102737f,
+    0.855618443f, -0.517607071f,
+    0.857728610f, -0.514102744f,
+    0.859824425f, -0.510589815f,
+    0.861905852f, -0.507068342f,
+    0.863972856f, -0.503538384f,
+    0.866025404f, -0.500000000f,
+    0.868063460f, -0.496453250f,
+    0.870086991f, -0.492898192f,
+    0.872095963f, -0.489334887f,
+    0.874090342f, -0.485763394f,
+    0.876070094f, -0.482183772f,
+    0.878035187f, -0.478596082f,
+    0.879985588f, -0.475000384f,
+    0.881921264f, -0.471396737f,
+    0.883842183f, -0.467785202f,
+    0.885748312f, -0.464165840f,
+    0.887639620f, -0.460538711f,
+    0.889516075f, -0.456903876f,
+    0.891377646f, -0.453261395f,
+    0.893224301f, -0.449611330f,
+    0.895056010f, -0.445953741f,
+    0.896872742f, -0.442288690f,
+    0.898674466f, -0.438616239f,
+    0.900461152f, -0.434936447f,
+    0.902232771f, -0.431249379f,
+    0.903989293f, -0.427555093f,
+    0.905730688f, -0.423853654f,
+    0.907456928f, -0.420145122f,
+    0.909167983f, -0.416429560f,
+    0.910863825f, -0.412707030f,
+    0.912544425f, -0.408977594f,
+    0.914209756f, -0.405241314f,
+    0.915859789f, -0.401498253f,
+    0.917494496f, -0.397748475f,
+    0.919113852f, -0.393992040f,
+    0.920717827f, -0.390229013f,
+    0.922306396f, -0.386459456f,
+    0.923879533f, -0.382683432f,
+    0.925437209f, -0.378901005f,
+    0.926979400f, -0.375112238f,
+    0.928506080f, -0.371317194f,
+    0.930017224f, -0.367515937f,
+    0.931512805f, -0.363708530f,
+    0.932992799f, -0.359895037f,
+    0.934457181f, -0.356075521f,
+    0.935905927f, -0.352250048f,
+    0.937339012f, -0.348418680f,
+    0.938756412f, -0.344581482f,
+    0.940158105f, -0.340738519f,
+    0.941544065f, -0.336889853f,
+    0.942914271f, -0.333035551f,
+    0.944268698f, -0.329175676f,
+    0.945607325f, -0.325310292f,
+    0.946930129f, -0.321439465f,
+    0.948237089f, -0.317563260f,
+    0.949528181f, -0.313681740f,
+    0.950803384f, -0.309794972f,
+    0.952062678f, -0.305903020f,
+    0.953306040f, -0.302005949f,
+    0.954533451f, -0.298103825f,
+    0.955744890f, -0.294196713f,
+    0.956940336f, -0.290284677f,
+    0.958119769f, -0.286367785f,
+    0.959283170f, -0.282446100f,
+    0.960430519f, -0.278519689f,
+    0.961561798f, -0.274588618f,
+    0.962676986f, -0.270652952f,
+    0.963776066f, -0.266712757f,
+    0.964859019f, -0.262768100f,
+    0.965925826f, -0.258819045f,
+    0.966976471f, -0.254865660f,
+    0.968010935f, -0.250908009f,
+    0.969029202f, -0.246946161f,
+    0.970031253f, -0.242980180f,
+    0.971017073f, -0.239010133f,
+    0.971986645f, -0.235036087f,
+    0.972939952f, -0.231058108f,
+    0.973876979f, -0.227076263f,
+    0.974797710f, -0.223090618f,
+    0.975702130f, -0.219101240f,
+    0.976590223f, -0.215108196f,
+    0.977461975f, -0.211111552f,
+    0.978317371f, -0.207111376f,
+    0.979156396f, -0.203107734f,
+    0.979979037f, -0.199100694f,
+    0.980785280f, -0.195090322f,
+    0.981575112f, -0.191076686f,
+    0.982348519f, -0.187059852f,
+    0.983105487f, -0.183039888f,
+    0.983846006f, -0.179016861f,
+    0.984570062f, -0.174990839f,
+    0.985277642f, -0.170961889f,
+    0.985968736f, -0.166930078f,
+    0.986643332f, -0.162895473f,
+    0.987301418f, -0.158858143f,
+    0.987942984f, -0.154818155f,
+    0.988568018f, -0.150775576f,
+    0.989176510f, -0.146730474f,
+    0.989768450f, -0.142682917f,
+    0.990343829f, -0.138632973f,
+    0.990902635f, -0.134580709f,
+    0.991444861f, -0.130526192f,
+    0.991970497f, -0.126469492f,
+    0.992479535f, -0.122410675f,
+    0.992971965f, -0.118349810f,
+    0.993447779f, -0.114286965f,
+    0.993906970f, -0.110222207f,
+    0.994349530f, -0.106155605f,
+    0.994775451f, -0.102087227f,
+    0.995184727f, -0.098017140f,
+    0.995577350f, -0.093945414f,
+    0.995953314f, -0.089872115f,
+    0.996312612f, -0.085797312f,
+    0.996655239f, -0.081721074f,
+    0.996981189f, -0.077643468f,
+    0.997290457f, -0.073564564f,
+    0.997583036f, -0.069484428f,
+    0.997858923f, -0.065403129f,
+    0.998118113f, -0.061320736f,
+    0.998360601f, -0.057237317f,
+    0.998586383f, -0.053152941f,
+    0.998795456f, -0.049067674f,
+    0.998987816f, -0.044981587f,
+    0.999163460f, -0.040894747f,
+    0.999322385f, -0.036807223f,
+    0.999464587f, -0.032719083f,
+    0.999590066f, -0.028630395f,
+    0.999698819f, -0.024541229f,
+    0.999790843f, -0.020451651f,
+    0.999866138f, -0.016361732f,
+    0.999924702f, -0.012271538f,
+    0.999966534f, -0.008181140f,
+    0.999991633f, -0.004090604f
+};
+#endif
 
 /*    
 * @brief  Q31 Twiddle factors Table    
@@ -8549,7 +14293,8 @@ const float32_t twiddleCoef_4096[8192] = {
 *	round(twiddleCoefQ31(i) * pow(2, 31))    
 *    
 */
-const q31_t twiddleCoef_16_q31[24] = {
+#if defined(ARM_TABLE_FFT_Q31_16)
+const q31_t twiddleCoef_16_q31[24] ARM_DSP_TABLE_ATTR = {
     0x7FFFFFFF, 0x00000000,
     0x7641AF3C, 0x30FBC54D,
     0x5A82799A, 0x5A82799A,
@@ -8563,6 +14308,7 @@ const q31_t twiddleCoef_16_q31[24] = {
     0xA57D8666, 0xA57D8666,
     0xCF043AB2, 0x89BE50C3
 };
+#endif
 
 /**    
 * \par   
@@ -8582,7 +14328,8 @@ const q31_t twiddleCoef_16_q31[24] = {
 *	round(twiddleCoefQ31(i) * pow(2, 31))    
 *    
 */
-const q31_t twiddleCoef_32_q31[48] = {
+#if defined(ARM_TABLE_FFT_Q31_32)
+const q31_t twiddleCoef_32_q31[48] ARM_DSP_TABLE_ATTR = {
     0x7FFFFFFF, 0x00000000,
     0x7D8A5F3F, 0x18F8B83C,
     0x7641AF3C, 0x30FBC54D,
@@ -8608,6 +14355,7 @@ const q31_t twiddleCoef_32_q31[48] = {
     0xCF043AB2, 0x89BE50C3,
     0xE70747C3, 0x8275A0C0
 };
+#endif
 
 /**    
 * \par   
@@ -8627,7 +14375,8 @@ const q31_t twiddleCoef_32_q31[48] = {
 *	round(twiddleCoefQ31(i) * pow(2, 31))    
 *    
 */
-const q31_t twiddleCoef_64_q31[96] = {
+#if defined(ARM_TABLE_FFT_Q31_64)
+const q31_t twiddleCoef_64_q31[96] ARM_DSP_TABLE_ATTR = {
     0x7FFFFFFF, 0x00000000,
     0x7F62368F, 0x0C8BD35E,
     0x7D8A5F3F, 0x18F8B83C,
@@ -8677,6 +14426,7 @@ const q31_t twiddleCoef_64_q31[96] = {
     0xE70747C3, 0x8275A0C0,
     0xF3742CA1, 0x809DC970
 };
+#endif
 
 /**    
 * \par   
@@ -8696,7 +14446,8 @@ const q31_t twiddleCoef_64_q31[96] = {
 *	round(twiddleCoefQ31(i) * pow(2, 31))    
 *    
 */
-const q31_t twiddleCoef_128_q31[192] = {
+#if defined(ARM_TABLE_FFT_Q31_128)
+const q31_t twiddleCoef_128_q31[192] ARM_DSP_TABLE_ATTR = {
     0x7FFFFFFF, 0x00000000,
     0x7FD8878D, 0x0647D97C,
     0x7F62368F, 0x0C8BD35E,
@@ -8794,6 +14545,7 @@ const q31_t twiddleCoef_128_q31[192] = {
     0xF3742CA1, 0x809DC970,
     0xF9B82683, 0x80277872
 };
+#endif
 
 /**    
 * \par   
@@ -8813,7 +14565,8 @@ const q31_t twiddleCoef_128_q31[192] = {
 *	round(twiddleCoefQ31(i) * pow(2, 31))    
 *    
 */
-const q31_t twiddleCoef_256_q31[384] = {
+#if defined(ARM_TABLE_FFT_Q31_256)
+const q31_t twiddleCoef_256_q31[384] ARM_DSP_TABLE_ATTR = {
     0x7FFFFFFF, 0x00000000,
     0x7FF62182, 0x03242ABF,
     0x7FD8878D, 0x0647D97C,
@@ -9007,6 +14760,7 @@ const q31_t twiddleCoef_256_q31[384] = {
     0xF9B82683, 0x80277872,
     0xFCDBD541, 0x8009DE7D
 };
+#endif
 
 /**    
 * \par   
@@ -9026,7 +14780,8 @@ const q31_t twiddleCoef_256_q31[384] = {
 *	round(twiddleCoefQ31(i) * pow(2, 31))    
 *    
 */
-const q31_t twiddleCoef_512_q31[768] = {
+#if defined(ARM_TABLE_FFT_Q31_512)
+const q31_t twiddleCoef_512_q31[768] ARM_DSP_TABLE_ATTR = {
     0x7FFFFFFF, 0x00000000,
     0x7FFD885A, 0x01921D1F,
     0x7FF62182, 0x03242ABF,
@@ -9412,6 +15167,7 @@ const q31_t twiddleCoef_512_q31[768] = {
     0xFCDBD541, 0x8009DE7D,
     0xFE6DE2E0, 0x800277A5
 };
+#endif
 
 /**    
 * \par   
@@ -9431,7 +15187,8 @@ const q31_t twiddleCoef_512_q31[768] = {
 *	round(twiddleCoefQ31(i) * pow(2, 31))    
 *    
 */
-const q31_t twiddleCoef_1024_q31[1536] = {
+#if defined(ARM_TABLE_FFT_Q31_1024)
+const q31_t twiddleCoef_1024_q31[1536] ARM_DSP_TABLE_ATTR = {
     0x7FFFFFFF, 0x00000000,
     0x7FFF6216, 0x00C90F88,
     0x7FFD885A, 0x01921D1F,
@@ -10201,6 +15958,7 @@ const q31_t twiddleCoef_1024_q31[1536] = {
     0xFE6DE2E0, 0x800277A5,
     0xFF36F078, 0x80009DE9
 };
+#endif
 
 /**    
 * \par   
@@ -10220,7 +15978,8 @@ const q31_t twiddleCoef_1024_q31[1536] = {
 *	round(twiddleCoefQ31(i) * pow(2, 31))    
 *    
 */
-const q31_t twiddleCoef_2048_q31[3072] = {
+#if defined(ARM_TABLE_FFT_Q31_2048)
+const q31_t twiddleCoef_2048_q31[3072] ARM_DSP_TABLE_ATTR = {
     0x7FFFFFFF, 0x00000000,
     0x7FFFD885, 0x006487E3,
     0x7FFF6216, 0x00C90F88,
@@ -11758,6 +17517,7 @@ const q31_t twiddleCoef_2048_q31[3072] = {
     0xFF36F078, 0x80009DE9,
     0xFF9B781D, 0x8000277A
 };
+#endif
 
 /**    
 * \par   
@@ -11777,7 +17537,8 @@ const q31_t twiddleCoef_2048_q31[3072] = {
 *	round(twiddleCoefQ31(i) * pow(2, 31))    
 *    
 */
-const q31_t twiddleCoef_4096_q31[6144] = 
+#if defined(ARM_TABLE_FFT_Q31_4096)
+const q31_t twiddleCoef_4096_q31[6144] ARM_DSP_TABLE_ATTR = 
 {
     0x7FFFFFFF, 0x00000000,
     0x7FFFF621, 0x003243F5,
@@ -14852,6 +20613,7 @@ const q31_t twiddleCoef_4096_q31[6144] =
     0xFF9B781D, 0x8000277A,
     0xFFCDBC0A, 0x800009DE
 };
+#endif
 
 
 
@@ -14878,7 +20640,8 @@ const q31_t twiddleCoef_4096_q31[6144] =
 *	round(twiddleCoefq15(i) * pow(2, 15))    
 *    
 */
-const q15_t twiddleCoef_16_q15[24] = {
+#if defined(ARM_TABLE_FFT_Q15_16)
+const q15_t twiddleCoef_16_q15[24] ARM_DSP_TABLE_ATTR = {
     0x7FFF, 0x0000,
     0x7641, 0x30FB,
     0x5A82, 0x5A82,
@@ -14892,6 +20655,7 @@ const q15_t twiddleCoef_16_q15[24] = {
     0xA57D, 0xA57D,
     0xCF04, 0x89BE
 };
+#endif
 
 /**    
 * \par   
@@ -14911,7 +20675,8 @@ const q15_t twiddleCoef_16_q15[24] = {
 *	round(twiddleCoefq15(i) * pow(2, 15))    
 *    
 */
-const q15_t twiddleCoef_32_q15[48] = {
+#if defined(ARM_TABLE_FFT_Q15_32)
+const q15_t twiddleCoef_32_q15[48] ARM_DSP_TABLE_ATTR = {
     0x7FFF, 0x0000,
     0x7D8A, 0x18F8,
     0x7641, 0x30FB,
@@ -14937,6 +20702,7 @@ const q15_t twiddleCoef_32_q15[48] = {
     0xCF04, 0x89BE,
     0xE707, 0x8275
 };
+#endif
 
 /**    
 * \par   
@@ -14956,7 +20722,8 @@ const q15_t twiddleCoef_32_q15[48] = {
 *	round(twiddleCoefq15(i) * pow(2, 15))    
 *    
 */
-const q15_t twiddleCoef_64_q15[96] = {
+#if defined(ARM_TABLE_FFT_Q15_64)
+const q15_t twiddleCoef_64_q15[96] ARM_DSP_TABLE_ATTR = {
     0x7FFF, 0x0000,
     0x7F62, 0x0C8B,
     0x7D8A, 0x18F8,
@@ -15006,6 +20773,7 @@ const q15_t twiddleCoef_64_q15[96] = {
     0xE707, 0x8275,
     0xF374, 0x809D
 };
+#endif
 
 /**    
 * \par   
@@ -15025,7 +20793,8 @@ const q15_t twiddleCoef_64_q15[96] = {
 *	round(twiddleCoefq15(i) * pow(2, 15))    
 *    
 */
-const q15_t twiddleCoef_128_q15[192] = {
+#if defined(ARM_TABLE_FFT_Q15_128)
+const q15_t twiddleCoef_128_q15[192] ARM_DSP_TABLE_ATTR = {
     0x7FFF, 0x0000,
     0x7FD8, 0x0647,
     0x7F62, 0x0C8B,
@@ -15123,6 +20892,7 @@ const q15_t twiddleCoef_128_q15[192] = {
     0xF374, 0x809D,
     0xF9B8, 0x8027
 };
+#endif
 
 /**    
 * \par   
@@ -15142,7 +20912,8 @@ const q15_t twiddleCoef_128_q15[192] = {
 *	round(twiddleCoefq15(i) * pow(2, 15))    
 *    
 */
-const q15_t twiddleCoef_256_q15[384] = {
+#if defined(ARM_TABLE_FFT_Q15_256)
+const q15_t twiddleCoef_256_q15[384] ARM_DSP_TABLE_ATTR = {
     0x7FFF, 0x0000,
     0x7FF6, 0x0324,
     0x7FD8, 0x0647,
@@ -15336,6 +21107,7 @@ const q15_t twiddleCoef_256_q15[384] = {
     0xF9B8, 0x8027,
     0xFCDB, 0x8009
 };
+#endif
 
 /**    
 * \par   
@@ -15355,7 +21127,8 @@ const q15_t twiddleCoef_256_q15[384] = {
 *	round(twiddleCoefq15(i) * pow(2, 15))    
 *    
 */
-const q15_t twiddleCoef_512_q15[768] = {
+#if defined(ARM_TABLE_FFT_Q15_512)
+const q15_t twiddleCoef_512_q15[768] ARM_DSP_TABLE_ATTR = {
     0x7FFF, 0x0000,
     0x7FFD, 0x0192,
     0x7FF6, 0x0324,
@@ -15741,6 +21514,7 @@ const q15_t twiddleCoef_512_q15[768] = {
     0xFCDB, 0x8009,
     0xFE6D, 0x8002
 };
+#endif
 
 /**    
 * \par   
@@ -15760,7 +21534,8 @@ const q15_t twiddleCoef_512_q15[768] = {
 *	round(twiddleCoefq15(i) * pow(2, 15))    
 *    
 */
-const q15_t twiddleCoef_1024_q15[1536] = {
+#if defined(ARM_TABLE_FFT_Q15_1024)
+const q15_t twiddleCoef_1024_q15[1536] ARM_DSP_TABLE_ATTR = {
     0x7FFF, 0x0000,
     0x7FFF, 0x00C9,
     0x7FFD, 0x0192,
@@ -16530,6 +22305,7 @@ const q15_t twiddleCoef_1024_q15[1536] = {
     0xFE6D, 0x8002,
     0xFF36, 0x8000
 };
+#endif
 
 /**    
 * \par   
@@ -16549,7 +22325,8 @@ const q15_t twiddleCoef_1024_q15[1536] = {
 *	round(twiddleCoefq15(i) * pow(2, 15))    
 *    
 */
-const q15_t twiddleCoef_2048_q15[3072] = {
+#if defined(ARM_TABLE_FFT_Q15_2048)
+const q15_t twiddleCoef_2048_q15[3072] ARM_DSP_TABLE_ATTR = {
     0x7FFF, 0x0000,
     0x7FFF, 0x0064,
     0x7FFF, 0x00C9,
@@ -18087,6 +23864,7 @@ const q15_t twiddleCoef_2048_q15[3072] = {
     0xFF36, 0x8000,
     0xFF9B, 0x8000
 };
+#endif
 
 /**    
 * \par   
@@ -18106,7 +23884,8 @@ const q15_t twiddleCoef_2048_q15[3072] = {
 *	round(twiddleCoefq15(i) * pow(2, 15))    
 *    
 */
-const q15_t twiddleCoef_4096_q15[6144] = 
+#if defined(ARM_TABLE_FFT_Q15_4096)
+const q15_t twiddleCoef_4096_q15[6144] ARM_DSP_TABLE_ATTR = 
 {
     0x7FFF, 0x0000,
     0x7FFF, 0x0032,
@@ -21181,6 +26960,7 @@ const q15_t twiddleCoef_4096_q15[6144] =
     0xFF9B, 0x8000,
     0xFFCD, 0x8000
 };
+#endif
 
 
 /**    
@@ -21221,21 +27001,26 @@ const q31_t armRecipTableQ31[64] = {
   0x41CCDDB6, 0x4146A3C6, 0x40C28923, 0x40408102
 };
 
-const uint16_t armBitRevIndexTable16[ARMBITREVINDEXTABLE__16_TABLE_LENGTH] = 
+#if defined(ARM_TABLE_FFT_F32_16)
+const uint16_t armBitRevIndexTable16[ARMBITREVINDEXTABLE__16_TABLE_LENGTH] ARM_DSP_TABLE_ATTR = 
 {
    //8x2, size 20
    8,64, 24,72, 16,64, 40,80, 32,64, 56,88, 48,72, 88,104, 72,96, 104,112
 };
+#endif
 
-const uint16_t armBitRevIndexTable32[ARMBITREVINDEXTABLE__32_TABLE_LENGTH] = 
+#if defined(ARM_TABLE_FFT_F32_32)
+const uint16_t armBitRevIndexTable32[ARMBITREVINDEXTABLE__32_TABLE_LENGTH] ARM_DSP_TABLE_ATTR = 
 {
    //8x4, size 48
    8,64, 16,128, 24,192, 32,64, 40,72, 48,136, 56,200, 64,128, 72,80, 88,208,
    80,144, 96,192, 104,208, 112,152, 120,216, 136,192, 144,160, 168,208,
    152,224, 176,208, 184,232, 216,240, 200,224, 232,240
 };
+#endif
 
-const uint16_t armBitRevIndexTable64[ARMBITREVINDEXTABLE__64_TABLE_LENGTH] = 
+#if defined(ARM_TABLE_FFT_F32_64)
+const uint16_t armBitRevIndexTable64[ARMBITREVINDEXTABLE__64_TABLE_LENGTH] ARM_DSP_TABLE_ATTR = 
 {   
    //radix 8, size 56
    8,64, 16,128, 24,192, 32,256, 40,320, 48,384, 56,448, 80,136, 88,200, 
@@ -21243,8 +27028,10 @@ const uint16_t armBitRevIndexTable64[ARMBITREVINDEXTABLE__64_TABLE_LENGTH] =
    184,464, 224,280, 232,344, 240,408, 248,472, 296,352, 304,416, 312,480, 
    368,424, 376,488, 440,496
 };
+#endif
 
-const uint16_t armBitRevIndexTable128[ARMBITREVINDEXTABLE_128_TABLE_LENGTH] = 
+#if defined(ARM_TABLE_FFT_F32_128)
+const uint16_t armBitRevIndexTable128[ARMBITREVINDEXTABLE_128_TABLE_LENGTH] ARM_DSP_TABLE_ATTR = 
 {
    //8x2, size 208
    8,512, 16,64, 24,576, 32,128, 40,640, 48,192, 56,704, 64,256, 72,768, 
@@ -21261,8 +27048,10 @@ const uint16_t armBitRevIndexTable128[ARMBITREVINDEXTABLE_128_TABLE_LENGTH] =
    792,864, 808,904, 816,864, 824,920, 840,864, 856,880, 872,944, 888,1008, 
    904,928, 912,960, 920,992, 944,968, 952,1000, 968,992, 984,1008
 };
+#endif
 
-const uint16_t armBitRevIndexTable256[ARMBITREVINDEXTABLE_256_TABLE_LENGTH] = 
+#if defined(ARM_TABLE_FFT_F32_256)
+const uint16_t armBitRevIndexTable256[ARMBITREVINDEXTABLE_256_TABLE_LENGTH] ARM_DSP_TABLE_ATTR = 
 {
    //8x4, size 440
    8,512, 16,1024, 24,1536, 32,64, 40,576, 48,1088, 56,1600, 64,128, 72,640, 
@@ -21299,8 +27088,10 @@ const uint16_t armBitRevIndexTable256[ARMBITREVINDEXTABLE_256_TABLE_LENGTH] =
    1880,1904, 1888,1984, 1896,2000, 1912,2032, 1904,2016, 1976,2032,
    1960,1968, 2008,2032, 1992,2016, 2024,2032
 };
+#endif
 
-const uint16_t armBitRevIndexTable512[ARMBITREVINDEXTABLE_512_TABLE_LENGTH] = 
+#if defined(ARM_TABLE_FFT_F32_512)
+const uint16_t armBitRevIndexTable512[ARMBITREVINDEXTABLE_512_TABLE_LENGTH] ARM_DSP_TABLE_ATTR = 
 {
    //radix 8, size 448
    8,512, 16,1024, 24,1536, 32,2048, 40,2560, 48,3072, 56,3584, 72,576, 
@@ -21339,8 +27130,10 @@ const uint16_t armBitRevIndexTable512[ARMBITREVINDEXTABLE_512_TABLE_LENGTH] =
    3064,4072, 3128,3632, 3192,3696, 3256,3760, 3320,3824, 3384,3888, 
    3448,3952, 3512,4016, 3576,4080
 };
+#endif
 
-const uint16_t armBitRevIndexTable1024[ARMBITREVINDEXTABLE1024_TABLE_LENGTH] = 
+#if defined(ARM_TABLE_FFT_F32_1024)
+const uint16_t armBitRevIndexTable1024[ARMBITREVINDEXTABLE1024_TABLE_LENGTH] ARM_DSP_TABLE_ATTR = 
 {
    //8x2, size 1800
    8,4096, 16,512, 24,4608, 32,1024, 40,5120, 48,1536, 56,5632, 64,2048, 
@@ -21491,8 +27284,10 @@ const uint16_t armBitRevIndexTable1024[ARMBITREVINDEXTABLE1024_TABLE_LENGTH] =
    8008,8032, 8024,8048, 8056,8120, 8072,8096, 8080,8128, 8088,8160, 
    8112,8136, 8120,8168, 8136,8160, 8152,8176
 };
+#endif
 
-const uint16_t armBitRevIndexTable2048[ARMBITREVINDEXTABLE2048_TABLE_LENGTH] = 
+#if defined(ARM_TABLE_FFT_F32_2048)
+const uint16_t armBitRevIndexTable2048[ARMBITREVINDEXTABLE2048_TABLE_LENGTH] ARM_DSP_TABLE_ATTR = 
 {
    //8x2, size 3808
    8,4096, 16,8192, 24,12288, 32,512, 40,4608, 48,8704, 56,12800, 64,1024, 
@@ -21833,8 +27628,10 @@ const uint16_t armBitRevIndexTable2048[ARMBITREVINDEXTABLE2048_TABLE_LENGTH] =
    16248,16368, 16264,16288, 16280,16296, 16296,16304, 16344,16368,
    16328,16352, 16360,16368
 };
+#endif
 
-const uint16_t armBitRevIndexTable4096[ARMBITREVINDEXTABLE4096_TABLE_LENGTH] = 
+#if defined(ARM_TABLE_FFT_F32_4096)
+const uint16_t armBitRevIndexTable4096[ARMBITREVINDEXTABLE4096_TABLE_LENGTH] ARM_DSP_TABLE_ATTR = 
 {
    //radix 8, size 4032
    8,4096, 16,8192, 24,12288, 32,16384, 40,20480, 48,24576, 56,28672, 64,512, 
@@ -22204,30 +28001,775 @@ const uint16_t armBitRevIndexTable4096[ARMBITREVINDEXTABLE4096_TABLE_LENGTH] =
    31096,31544, 31160,32056, 31224,32568, 31672,32120, 31736,32632, 
    32248,32696
 };
+#endif
+
+#if defined(ARM_TABLE_FFT_F32_500)
+const uint16_t armBitRevIndexTable500[ARMBITREVINDEXTABLE_500_TABLE_LENGTH] ARM_DSP_TABLE_ATTR = 
+{
+   //radix 5-5-5-4, size 968
+   8,800, 16,1600, 24,2400, 32,3200, 40,160, 48,960, 56,1760, 64,2560,
+   72,3360, 80,320, 88,1120, 96,1920, 104,2720, 112,3520, 120,480, 128,1280,
+   136,2080, 144,2880, 152,3680, 160,640, 168,1440, 176,2240, 184,3040, 192,3840,
+   200,3200, 208,832, 216,1632, 224,2432, 232,3232, 240,3840, 248,992, 256,1792,
+   264,2592, 272,3392, 280,352, 288,1152, 296,1952, 304,2752, 312,3552, 320,512,
+   328,1312, 336,2112, 344,2912, 352,3712, 360,672, 368,1472, 376,2272, 384,3072,
+   392,3872, 400,2560, 408,864, 416,1664, 424,2464, 432,3264, 440,2432, 448,1024,
+   456,1824, 464,2624, 472,3424, 480,3072, 488,1184, 496,1984, 504,2784, 512,3584,
+   520,544, 528,1344, 536,2144, 544,2944, 552,3744, 560,704, 568,1504, 576,2304,
+   584,3104, 592,3904, 600,1920, 608,896, 616,1696, 624,2496, 632,3296, 640,1792,
+   648,1056, 656,1856, 664,2656, 672,3456, 680,1664, 688,1216, 696,2016, 704,2816,
+   712,3616, 720,2304, 728,1376, 736,2176, 744,2976, 752,3776, 760,2176, 768,1536,
+   776,2336, 784,3136, 792,3936, 800,1280, 808,928, 816,1728, 824,2528, 832,3328,
+   840,1152, 848,1088, 856,1888, 864,2688, 872,3488, 880,1024, 888,1248, 896,2048,
+   904,2848, 912,3648, 920,2048, 928,1408, 936,2208, 944,3008, 952,3808, 960,1536,
+   968,1568, 976,2368, 984,3168, 992,3968, 1000,1280, 1008,1408, 1016,1608, 1024,2408,
+   1032,3208, 1040,1440, 1048,1568, 1056,1768, 1064,2568, 1072,3368, 1080,1312, 1088,1128,
+   1096,1928, 1104,2728, 1112,3528, 1120,1184, 1128,1288, 1136,2088, 1144,2888, 1152,3688,
+   1160,1768, 1168,1448, 1176,2248, 1184,3048, 1192,3848, 1200,1792, 1208,3688, 1216,1640,
+   1224,2440, 1232,3240, 1240,3200, 1248,1280, 1256,1800, 1264,2600, 1272,3400, 1280,3456,
+   1288,1768, 1296,1960, 1304,2760, 1312,3560, 1320,2944, 0,0, 1328,2944, 1336,2120,
+   1344,2920, 1352,3720, 1360,1664, 1368,1480, 1376,2280, 1384,3080, 1392,3880, 1400,3360,
+   1408,3488, 1416,1672, 1424,2472, 1432,3272, 1440,3232, 1448,3208, 1456,1832, 1464,2632,
+   1472,3432, 1480,3872, 1488,3848, 1496,1992, 1504,2792, 1512,3592, 1520,3744, 1528,3720,
+   1536,2152, 1544,2952, 1552,3752, 1560,3616, 1568,3592, 1576,2312, 1584,3112, 1592,3912,
+   1600,2720, 1608,2848, 1616,1704, 1624,2504, 1632,3304, 1640,2592, 1648,2568, 1656,1864,
+   1664,2664, 1672,3464, 1680,2464, 1688,2440, 1696,2024, 1704,2824, 1712,3624, 1720,3104,
+   1728,3080, 1736,2184, 1744,2984, 1752,3784, 1760,2976, 1768,2952, 1776,2344, 1784,3144,
+   1792,3944, 1800,2080, 1808,2208, 1816,2184, 1824,2536, 1832,3336, 1840,1952, 1848,1928,
+   1856,1896, 1864,2696, 1872,3496, 1880,2536, 1888,2080, 1896,2056, 1904,2856, 1912,3656,
+   1920,2024, 1928,3464, 1936,2216, 1944,3016, 1952,3816, 1960,2336, 1968,2312, 1976,2376,
+   1984,3176, 1992,3976, 2000,2720, 2008,3080, 2016,2824, 2024,2416, 2032,3216, 2040,2240,
+   2048,2368, 2056,2344, 2064,2576, 2072,3376, 2080,2112, 2096,2216, 2104,2736, 2112,3536,
+   2120,3176, 2128,2336, 2136,2216, 2144,2896, 2152,3696, 2160,2344, 2168,3336, 2176,2256,
+   2184,3056, 2192,3856, 2200,3696, 2208,2952, 2216,2568, 2224,2448, 2232,3248, 2240,3328,
+   2248,3488, 2256,2952, 2264,2608, 2272,3408, 2280,3432, 2288,3208, 2296,2312, 2304,2768,
+   2312,3568, 2320,2920, 2328,2944, 2344,2928, 2352,3728, 2360,2592, 2368,3848, 2376,3208,
+   2384,3088, 2392,3888, 2400,3584, 2416,2464, 2424,2480, 2432,3280, 2440,3840, 2448,3232,
+   2456,3816, 2464,2640, 2472,3440, 2480,2560, 2488,3944, 2496,2720, 2504,2800, 2512,3600,
+   2520,2816, 2528,2664, 2536,2928, 2544,2960, 2552,3760, 2560,2768, 2568,3744, 2576,2920,
+   2584,3120, 2592,3920, 2600,3520, 2608,3648, 2616,3624, 2624,3600, 2632,3312, 2640,3392,
+   2648,3368, 2656,3496, 2664,2672, 0,0, 2672,3472, 2680,3264, 2688,3240, 2696,3216,
+   2704,2832, 2712,3632, 2720,3904, 2728,3880, 2736,3856, 2744,2992, 2752,3792, 2760,3776,
+   2768,3752, 2776,3728, 2784,3152, 2792,3952, 2800,2880, 2808,3008, 2816,2984, 2824,2960,
+   2832,3344, 2840,3792, 2848,3880, 2864,3344, 2872,3504, 2880,3600, 2888,3520, 2896,2920,
+   2904,3344, 2912,3664, 2920,3904, 2928,3440, 2936,3232, 2944,3024, 2952,3824, 2960,3136,
+   2968,3112, 2976,3088, 2984,3184, 2992,3984, 3000,3584, 3008,3472, 3016,3600, 3024,3752,
+   3032,3224, 3048,3168, 3056,3144, 3064,3120, 3072,3384, 3080,3664, 3088,3520, 3096,3600,
+   3104,3984, 3112,3544, 3120,3152, 3128,3776, 3136,3856, 3144,3344, 3152,3704, 3160,3496,
+   3168,3312, 3176,3648, 3184,3704, 3192,3864, 3200,3520, 3208,3536, 3224,3816, 3232,3256,
+   3240,3304, 3248,3880, 3256,3344, 3264,3624, 3272,3416, 3280,3408, 3288,3488, 3296,3536,
+   3304,3728, 3312,3576, 3320,3904, 3328,3648, 3336,3744, 3352,3736, 3360,3856, 3368,3976,
+   3376,3568, 3384,3600, 3392,3896, 3400,3576, 3408,3456, 3416,3840, 3424,3944, 3432,3488,
+   3440,3968, 3448,3592, 3456,3464, 0,0, 3464,3976, 3472,3592, 3480,3728, 3488,3688,
+   3496,3664, 3504,3592, 3512,3608, 3520,3952, 3528,3872, 3536,3744, 3552,3768, 3560,3688,
+   3568,3720, 3576,3752, 3584,3776, 3592,3928, 3608,3848, 3616,3984, 3624,3704, 3632,3904,
+   3640,3712, 3648,3688, 3656,3968, 3664,3704, 3672,3728, 3680,3976, 3688,3952, 0,0,
+   3696,3952, 3704,3792, 3720,3896, 3728,3856, 3736,3952, 3744,3776, 3752,3800, 3760,3824,
+   3768,3984, 3776,3920, 3784,3792, 0,0, 3792,3960, 3800,3976, 3816,3960, 3832,3952,
+   3840,3984, 3848,3872, 3856,3968, 3864,3904, 3880,3944, 3888,3976, 3904,3928, 3912,3968,
+   3928,3984, 3936,3944, 3944,3960, 0,0
+};
+#endif
+
+#if defined(ARM_TABLE_FFT_F32_600)
+const uint16_t armBitRevIndexTable600[ARMBITREVINDEXTABLE_600_TABLE_LENGTH] ARM_DSP_TABLE_ATTR = 
+{
+   //radix 5-5-3-4-2, size 1196
+   8,960, 16,1920, 24,2880, 32,3840, 40,192, 48,1152, 56,2112, 64,3072,
+   72,4032, 80,384, 88,1344, 96,2304, 104,3264, 112,4224, 120,576, 128,1536,
+   136,2496, 144,3456, 152,4416, 160,768, 168,1728, 176,2688, 184,3648, 192,4608,
+   200,3072, 208,1024, 216,1984, 224,2944, 232,3904, 240,256, 248,1216, 256,2176,
+   264,3136, 272,4096, 280,448, 288,1408, 296,2368, 304,3328, 312,4288, 320,640,
+   328,1600, 336,2560, 344,3520, 352,4480, 360,832, 368,1792, 376,2752, 384,3712,
+   392,4672, 400,1536, 408,1088, 416,2048, 424,3008, 432,3968, 440,640, 448,1280,
+   456,2240, 464,3200, 472,4160, 480,512, 488,1472, 496,2432, 504,3392, 512,4352,
+   520,704, 528,1664, 536,2624, 544,3584, 552,4544, 560,896, 568,1856, 576,2816,
+   584,3776, 592,4736, 600,1920, 608,976, 616,1936, 624,2896, 632,3856, 640,1024,
+   648,1168, 656,2128, 664,3088, 672,4048, 680,1536, 688,1360, 696,2320, 704,3280,
+   712,4240, 720,4736, 728,1552, 736,2512, 744,3472, 752,4432, 760,784, 768,1744,
+   776,2704, 784,3664, 792,4624, 800,3712, 808,1040, 816,2000, 824,2960, 832,3920,
+   840,4096, 848,1232, 856,2192, 864,3152, 872,4112, 880,3200, 888,1424, 896,2384,
+   904,3344, 912,4304, 920,2128, 928,1616, 936,2576, 944,3536, 952,4496, 960,1232,
+   968,1808, 976,2768, 984,3728, 992,4688, 1000,3456, 1008,1104, 1016,2064, 1024,3024,
+   1032,3984, 1040,2560, 1048,1296, 1056,2256, 1064,3216, 1072,4176, 1080,1664, 1088,1488,
+   1096,2448, 1104,3408, 1112,4368, 1120,4736, 1128,1680, 1136,2640, 1144,3600, 1152,4560,
+   1160,4304, 1168,1872, 1176,2832, 1184,3792, 1192,4752, 1200,3840, 1208,4688, 1216,1952,
+   1224,2912, 1232,3872, 1240,2944, 1248,3792, 1256,2144, 1264,3104, 1272,4064, 1280,2048,
+   1288,1376, 1296,2336, 1304,3296, 1312,4256, 1320,2768, 1328,1568, 1336,2528, 1344,3488,
+   1352,4448, 1360,3712, 1368,1760, 1376,2720, 1384,3680, 1392,4640, 1400,2304, 1408,2256,
+   1416,2016, 1424,2976, 1432,3936, 1440,2256, 1448,3792, 1456,2208, 1464,3168, 1472,4128,
+   1480,4352, 1488,2256, 1496,2400, 1504,3360, 1512,4320, 1520,4048, 1528,1632, 1536,2592,
+   1544,3552, 1552,4512, 1560,3152, 1568,1824, 1576,2784, 1584,3744, 1592,4704, 1600,1744,
+   1608,4736, 1616,2080, 1624,3040, 1632,4000, 1640,4480, 1648,4256, 1656,2272, 1664,3232,
+   1672,4192, 1680,3584, 1688,3360, 1696,2464, 1704,3424, 1712,4384, 1720,2512, 1728,2464,
+   1736,2656, 1744,3616, 1752,4576, 1760,2080, 1768,1888, 1776,2848, 1784,3808, 1792,4768,
+   1800,4560, 1808,3408, 1816,1968, 1824,2928, 1832,3888, 1840,2176, 1848,3840, 1856,2160,
+   1864,3120, 1872,4080, 1880,3968, 1888,4640, 1896,2352, 1904,3312, 1912,4272, 1920,2896,
+   1928,3744, 1936,2544, 1944,3504, 1952,4464, 1960,2000, 1968,2848, 1976,2736, 1984,3696,
+   1992,4656, 2000,4224, 2008,4176, 2016,2032, 2024,2992, 2032,3952, 2040,3328, 2048,3104,
+   2056,2224, 2064,3184, 2072,4144, 2080,2432, 2088,2208, 2096,2416, 2104,3376, 2112,4336,
+   2120,3712, 2128,4256, 2136,2608, 2144,3568, 2152,4528, 2160,3200, 2168,2176, 0,0,
+   2176,2800, 2184,3760, 2192,4720, 2200,2688, 2208,2640, 2216,2416, 2224,3056, 2232,4016,
+   2240,4768, 2248,2928, 2256,2288, 2264,3248, 2272,4208, 2280,2384, 2288,4048, 2296,2480,
+   2304,3440, 2312,4400, 2320,4432, 2328,4384, 2336,2672, 2344,3632, 2352,4592, 2360,3536,
+   2368,3312, 2376,2864, 2384,3824, 2392,4784, 2400,3872, 2408,3408, 2416,3744, 2424,2888,
+   2432,3848, 2440,3072, 2448,4304, 2456,3712, 2464,3080, 2472,4040, 2480,4672, 2488,4448,
+   2496,4400, 2504,3272, 2512,4232, 2520,3776, 2528,3552, 2536,3272, 2544,3464, 2552,4424,
+   2560,2704, 2568,2656, 2576,2696, 2584,3656, 2592,4616, 2600,4032, 2608,3984, 2616,4656,
+   2624,2952, 2632,3912, 2640,3136, 2648,2912, 2656,3760, 2664,3144, 2672,4104, 2680,4768,
+   2688,3952, 2696,2864, 2704,3336, 2712,4296, 2720,4080, 2728,4736, 2736,3760, 2744,3528,
+   2752,4488, 2760,4096, 2768,4560, 2776,4096, 2784,3720, 2792,4680, 2800,4400, 2808,4304,
+   2816,3056, 2824,3016, 2832,3976, 2840,3616, 2848,4080, 2856,2928, 2864,3208, 2872,4168,
+   2880,3280, 2888,4352, 2896,3072, 2904,3400, 2912,4360, 2920,4240, 2928,4192, 2936,3912,
+   2944,3592, 2952,4552, 2960,3344, 2968,3120, 2976,3016, 2984,3784, 2992,4744, 3000,3280,
+   3008,3728, 3016,3504, 3024,3400, 3032,3864, 3040,3696, 3048,3976, 3056,3984, 3064,3096,
+   3072,4056, 3080,4048, 3088,3848, 3096,4384, 3104,3288, 3112,4248, 3120,4056, 3128,3152,
+   3136,3776, 3144,3480, 3152,4440, 3160,4624, 3168,4576, 3176,4296, 3184,3672, 3192,4632,
+   3200,3488, 3208,4104, 3216,4176, 3224,4056, 3232,3928, 3240,3288, 3248,3592, 3256,3952,
+   3264,4624, 3272,4120, 3280,4160, 3288,3936, 3296,4784, 3304,3352, 3312,4312, 3320,3848,
+   3328,3696, 3336,3656, 3344,3544, 3352,4504, 3360,4720, 3368,4080, 3376,4096, 3384,3736,
+   3392,4696, 3400,4416, 3408,4368, 3416,4144, 3424,3864, 3432,3992, 3440,3520, 3448,4784,
+   3456,3592, 3464,4056, 3472,4184, 3480,4552, 3488,3872, 3496,3712, 3504,4144, 3512,4376,
+   3520,4512, 3528,4720, 3536,4360, 3544,3608, 3552,4568, 3560,4256, 3568,3968, 3576,3616,
+   3584,3800, 3592,4760, 3600,4608, 3608,4760, 3616,4224, 3624,4240, 3632,3880, 3640,3904,
+   3648,4752, 3656,4528, 3664,4248, 3672,4072, 3680,3728, 0,0, 3688,3728, 3696,3880,
+   3704,4504, 3712,4264, 3720,4056, 0,0, 3728,4056, 3736,4120, 3744,4264, 3752,4456,
+   3760,4528, 3768,4640, 3776,4736, 3784,4056, 3792,4648, 3800,4624, 3808,4176, 3816,4744,
+   3824,4056, 3832,3944, 3840,4312, 3848,3968, 3856,4264, 3864,4296, 3872,4136, 3880,4128,
+   3888,4648, 3896,4368, 3904,4080, 3912,4328, 3920,4616, 3928,4480, 3936,4032, 3944,4256,
+   3952,4520, 3960,4112, 3968,4648, 3976,4680, 3984,4456, 3992,4712, 4000,4048, 4008,4624,
+   4016,4736, 4024,4680, 4032,4624, 4040,4616, 4048,4560, 4064,4624, 4072,4200, 4080,4544,
+   4088,4320, 4096,4616, 4104,4712, 4112,4392, 4120,4184, 4128,4296, 4136,4552, 4144,4240,
+   4152,4584, 4160,4712, 4168,4592, 4176,4192, 4184,4744, 4192,4776, 4200,4336, 0,0,
+   4208,4336, 4216,4528, 4224,4328, 4232,4368, 4240,4464, 4248,4688, 4256,4400, 4264,4440,
+   4272,4320, 4280,4416, 4288,4512, 4296,4360, 4304,4648, 4312,4416, 4320,4440, 4328,4704,
+   4336,4424, 4344,4376, 4352,4472, 4360,4760, 4368,4776, 4376,4720, 4384,4504, 4392,4664,
+   4400,4456, 4408,4480, 4416,4760, 4424,4712, 4432,4664, 4440,4512, 4448,4624, 4456,4736,
+   4464,4632, 4472,4584, 4480,4696, 4488,4576, 4496,4584, 4504,4744, 4512,4720, 4520,4664,
+   4528,4712, 4536,4656, 4544,4704, 4552,4656, 4560,4632, 4568,4760, 4576,4648, 4584,4640,
+   4592,4728, 4600,4752, 4624,4744, 4632,4680, 4640,4648, 0,0, 4648,4760, 4656,4672,
+   4672,4712, 0,0, 4680,4712, 0,0, 4688,4712, 4696,4744, 4704,4784, 4712,4744,
+   4720,4744, 4728,4776, 4736,4768, 4744,4784, 4768,4784, 0,0
+};
+#endif
+
+#if defined(ARM_TABLE_FFT_F32_768)
+const uint16_t armBitRevIndexTable768[ARMBITREVINDEXTABLE_768_TABLE_LENGTH] ARM_DSP_TABLE_ATTR = 
+{
+   //radix 3-4-4-4-4, size 1520
+   8,2048, 16,4096, 24,512, 32,2560, 40,4608, 48,1024, 56,3072, 64,5120,
+   72,1536, 80,3584, 88,5632, 96,128, 104,2176, 112,4224, 120,640, 128,2688,
+   136,4736, 144,1152, 152,3200, 160,5248, 168,1664, 176,3712, 184,5760, 192,256,
+   200,2304, 208,4352, 216,768, 224,2816, 232,4864, 240,1280, 248,3328, 256,5376,
+   264,1792, 272,3840, 280,5888, 288,384, 296,2432, 304,4480, 312,896, 320,2944,
+   328,4992, 336,1408, 344,3456, 352,5504, 360,1920, 368,3968, 376,6016, 384,2560,
+   392,2080, 400,4128, 408,544, 416,2592, 424,4640, 432,1056, 440,3104, 448,5152,
+   456,1568, 464,3616, 472,5664, 480,5248, 488,2208, 496,4256, 504,672, 512,2720,
+   520,4768, 528,1184, 536,3232, 544,5280, 552,1696, 560,3744, 568,5792, 576,2560,
+   584,2336, 592,4384, 600,800, 608,2848, 616,4896, 624,1312, 632,3360, 640,5408,
+   648,1824, 656,3872, 664,5920, 672,2592, 680,2464, 688,4512, 696,928, 704,2976,
+   712,5024, 720,1440, 728,3488, 736,5536, 744,1952, 752,4000, 760,6048, 768,5120,
+   776,2112, 784,4160, 792,2560, 800,2624, 808,4672, 816,1088, 824,3136, 832,5184,
+   840,1600, 848,3648, 856,5696, 864,5376, 872,2240, 880,4288, 888,2976, 896,2752,
+   904,4800, 912,1216, 920,3264, 928,5312, 936,1728, 944,3776, 952,5824, 960,2944,
+   968,2368, 976,4416, 984,5184, 992,2880, 1000,4928, 1008,1344, 1016,3392, 1024,5440,
+   1032,1856, 1040,3904, 1048,5952, 1056,5152, 1064,2496, 1072,4544, 1080,2944, 1088,3008,
+   1096,5056, 1104,1472, 1112,3520, 1120,5568, 1128,1984, 1136,4032, 1144,6080, 1152,2688,
+   1160,2144, 1168,4192, 1176,2848, 1184,2656, 1192,4704, 1200,5568, 1208,3168, 1216,5216,
+   1224,1632, 1232,3680, 1240,5728, 1248,2816, 1256,2272, 1264,4320, 1272,5536, 1280,2784,
+   1288,4832, 1296,2816, 1304,3296, 1312,5344, 1320,1760, 1328,3808, 1336,5856, 1344,5504,
+   1352,2400, 1360,4448, 1368,5376, 1376,2912, 1384,4960, 1392,2912, 1400,3424, 1408,5472,
+   1416,1888, 1424,3936, 1432,5984, 1440,5248, 1448,2528, 1456,4576, 1464,2880, 1472,3040,
+   1480,5088, 1488,1504, 1496,3552, 1504,5600, 1512,2016, 1520,4064, 1528,6112, 1536,2048,
+   1544,2056, 1552,4104, 1560,4768, 1568,2568, 1576,4616, 1584,1856, 1592,3080, 1600,5128,
+   1608,2056, 1616,3592, 1624,5640, 1632,4736, 1640,2184, 1648,4232, 1656,1824, 1664,2696,
+   1672,4744, 1680,2144, 1688,3208, 1696,5256, 1704,4744, 1712,3720, 1720,5768, 1728,1792,
+   1736,2312, 1744,4360, 1752,2112, 1760,2824, 1768,4872, 1776,4832, 1784,3336, 1792,5384,
+   1808,3848, 1816,5896, 1824,2080, 1832,2440, 1840,4488, 1848,4800, 1856,2952, 1864,5000,
+   1872,1888, 1880,3464, 1888,5512, 1896,1928, 1904,3976, 1912,6024, 1920,4608, 1928,2088,
+   1936,4136, 1944,5256, 1952,2600, 1960,4648, 1968,2496, 1976,3112, 1984,5160, 1992,4616,
+   2000,3624, 2008,5672, 2016,2696, 2024,2216, 2032,4264, 2040,2464, 2048,2728, 2056,4776,
+   2064,4704, 2072,3240, 2080,5288, 2088,4744, 2096,3752, 2104,5800, 2112,2432, 2120,2344,
+   2128,4392, 2136,4672, 2144,2856, 2152,4904, 2160,2824, 2168,3368, 2176,5416, 2184,2440,
+   2192,3880, 2200,5928, 2208,4640, 2216,2472, 2224,4520, 2232,5384, 2240,2984, 2248,5032,
+   2256,2528, 2264,3496, 2272,5544, 2280,4648, 2288,4008, 2296,6056, 2304,2728, 2312,2344,
+   2320,4168, 2328,2336, 2336,2632, 2344,4680, 2352,5056, 2360,3144, 2368,5192, 2376,4776,
+   2384,3656, 2392,5704, 2400,2728, 2408,5032, 2416,4296, 2424,5024, 2432,2760, 2440,4808,
+   2448,4736, 2456,3272, 2464,5320, 2472,4680, 2480,3784, 2488,5832, 2496,4992, 2504,4776,
+   2512,4424, 2520,5128, 2528,2888, 2536,4936, 2544,2728, 2552,3400, 2560,5448, 2568,5000,
+   2576,3912, 2584,5960, 2592,5000, 2600,4776, 2608,4552, 2616,5192, 2624,3016, 2632,5064,
+   2640,5088, 2648,3528, 2656,5576, 2664,4616, 2672,4040, 2680,6088, 2688,5416, 2696,4904,
+   2704,4200, 2712,4896, 2720,4616, 2728,4712, 2736,5160, 2744,3176, 2752,5224, 2760,4808,
+   2768,3688, 2776,5736, 2784,4864, 2792,4648, 2800,4328, 2808,4776, 2816,4648, 2824,4840,
+   2832,5544, 2840,3304, 2848,5352, 2856,4872, 2864,3816, 2872,5864, 2880,4608, 2888,5032,
+   2896,4456, 2904,2984, 2912,2920, 0,0, 2920,4968, 2928,4960, 2936,3432, 2944,5480,
+   2952,4744, 2960,3944, 2968,5992, 2976,4640, 2984,4936, 2992,4584, 3000,4928, 3008,3048,
+   3016,5096, 3024,4904, 3032,3560, 3040,5608, 3048,4680, 3056,4072, 3064,6120, 3072,4096,
+   3080,4704, 3088,4112, 3096,5576, 3104,3912, 3112,4624, 3120,3904, 3128,4112, 3136,5136,
+   3144,4104, 3152,3600, 3160,5648, 3168,5416, 3176,3880, 3184,4240, 3192,3872, 3200,4200,
+   3208,4752, 3216,4192, 3224,4192, 3232,5264, 3240,4872, 3248,3728, 3256,5776, 3264,3840,
+   3272,4168, 3280,4368, 3288,4160, 3296,5544, 3304,4880, 3312,4648, 3320,3344, 3328,5392,
+   3336,3848, 3344,3856, 3352,5904, 3360,4128, 3368,4736, 3376,4496, 3384,5216, 3392,3944,
+   3400,5008, 3408,3936, 3416,3472, 3424,5520, 3432,4136, 3440,3984, 3448,6032, 3456,5440,
+   3464,3752, 3472,4144, 3480,3744, 3488,4552, 3496,4656, 3504,4544, 3512,3904, 3520,5168,
+   3528,4744, 3536,3632, 3544,5680, 3552,3712, 3560,4520, 3568,4272, 3576,4512, 3584,5160,
+   3592,4784, 3600,5568, 3608,3728, 3616,5296, 3624,3720, 3632,3760, 3640,5808, 3648,4480,
+   3656,5056, 3664,4400, 3672,4680, 3680,3816, 3688,4912, 3696,3808, 3704,4496, 3712,5424,
+   3720,4488, 3728,3888, 3736,5936, 3744,5152, 3752,3784, 3760,4528, 3768,3776, 0,0,
+   3776,4584, 3784,5040, 3792,4576, 3800,4544, 3808,5552, 3816,4992, 3824,4016, 3832,6064,
+   3840,5160, 3848,4392, 3856,4176, 3864,4384, 3872,5088, 3880,4688, 3888,5608, 3896,5568,
+   3904,5200, 3912,4784, 3920,4400, 3928,5712, 3936,4352, 3944,5032, 3952,4304, 3960,5248,
+   3968,4912, 3976,4816, 3984,4992, 3992,4368, 4000,5328, 4008,4360, 4016,4576, 4024,5840,
+   4032,5472, 4040,5056, 4048,4432, 4056,4480, 4064,4456, 4072,4944, 4080,4448, 4088,4352,
+   4096,5456, 4104,5512, 4112,4400, 4120,5968, 4128,5296, 4136,4424, 4144,4560, 4152,4416,
+   4160,4904, 4168,5072, 4176,5600, 4184,4528, 4192,5584, 4200,4488, 4208,4432, 4216,6096,
+   4232,4840, 4240,4432, 4248,5344, 4256,5056, 4264,4720, 4272,5472, 4280,4432, 4288,5232,
+   4296,4840, 4304,5552, 4312,5744, 4320,4864, 4328,4360, 4344,5328, 4352,4360, 0,0,
+   4360,4848, 4368,4864, 4376,4648, 4384,5360, 4392,4832, 4400,4576, 4408,5872, 4416,4912,
+   4424,4840, 4432,4464, 4440,5232, 4448,4960, 4456,4976, 4464,4968, 4472,4992, 4480,5488,
+   4488,4816, 4496,5552, 4504,6000, 4512,5056, 4520,4712, 4528,4592, 4536,5504, 4544,4944,
+   4552,5104, 4560,4976, 4568,5472, 4576,5616, 4584,4720, 4592,4960, 4600,6128, 4608,4616,
+   4616,4872, 4624,5968, 4632,5264, 4640,5960, 4648,5264, 4656,5952, 4664,5576, 4672,5144,
+   4680,4768, 4688,5608, 4696,5656, 4704,4816, 4712,5928, 4720,5344, 4728,5920, 4736,4896,
+   4744,4760, 4752,5352, 4760,5584, 4768,5272, 4776,5352, 4784,5936, 4792,5784, 4800,5888,
+   4808,5064, 4816,5264, 4824,5448, 4832,4880, 4840,4888, 4848,5544, 4856,5904, 4864,5400,
+   4872,5896, 4880,5360, 4888,5912, 4896,5280, 4904,5072, 4912,6000, 4920,5160, 4928,5992,
+   4936,5016, 4944,5984, 4952,5152, 4960,5528, 4968,5256, 4976,5400, 4984,6040, 4992,5456,
+   5000,5800, 5008,6000, 5016,5792, 5024,5192, 5032,5576, 5040,5480, 5048,5616, 5056,5176,
+   5064,5264, 5072,5808, 5080,5688, 5088,5760, 5096,5384, 5104,5256, 5112,5312, 5120,5608,
+   5128,5784, 5136,5416, 5144,5776, 5152,5304, 5160,5768, 5168,5344, 5176,5816, 5184,5224,
+   5192,5512, 5200,5872, 5208,5416, 5216,5864, 5224,5768, 5232,5856, 5240,5864, 5248,5432,
+   5256,5888, 5264,5568, 5272,5944, 5280,5936, 5288,5832, 5296,5504, 5304,5824, 5312,5992,
+   5320,5616, 5328,5896, 5336,5872, 5344,5560, 5352,5968, 5360,5840, 5368,6072, 5376,5632,
+   5384,5776, 5392,5528, 5400,5776, 5408,5584, 5416,5656, 5424,5560, 5432,5648, 5440,5656,
+   5448,5640, 5456,5944, 5464,5720, 5472,5608, 5480,5952, 5488,5744, 5496,5888, 5504,5736,
+   5512,5640, 5520,5728, 5528,5808, 5536,5872, 5544,5568, 5552,5984, 5560,5848, 5568,5656,
+   5576,5704, 5584,5856, 5592,5696, 5600,5792, 5608,5824, 5616,5632, 5624,5776, 5632,5720,
+   5640,5952, 5648,5712, 5656,5976, 5672,5784, 5680,5824, 5688,5768, 5696,5928, 5704,5768,
+   5712,5848, 5720,5824, 5728,5928, 5736,5784, 5752,6104, 5760,5856, 5768,5936, 5776,6096,
+   5792,6088, 5800,5920, 5808,6080, 5816,5856, 5824,5864, 5840,5984, 5848,6104, 5856,6080,
+   5864,6056, 5872,5896, 5880,6048, 5888,5968, 5896,5904, 5912,6088, 5920,6072, 5928,5984,
+   5936,6064, 5944,6048, 5952,6016, 0,0, 5960,6016, 5968,6048, 5976,6016, 5984,6088,
+   5992,6040, 6000,6088, 6008,6032, 6016,6048, 6032,6104, 0,0, 6040,6104, 6048,6072,
+   6056,6088, 6064,6128, 6072,6128, 6080,6120, 6088,6104, 6096,6112, 6104,6120, 0,0
+};
+#endif
+
+#if defined(ARM_TABLE_FFT_F32_1000)
+const uint16_t armBitRevIndexTable1000[ARMBITREVINDEXTABLE1000_TABLE_LENGTH] ARM_DSP_TABLE_ATTR = 
+{
+   //radix 5-5-5-4-2, size 1992
+   8,1600, 16,3200, 24,4800, 32,6400, 40,320, 48,1920, 56,3520, 64,5120,
+   72,6720, 80,640, 88,2240, 96,3840, 104,5440, 112,7040, 120,960, 128,2560,
+   136,4160, 144,5760, 152,7360, 160,1280, 168,2880, 176,4480, 184,6080, 192,7680,
+   200,5120, 208,1664, 216,3264, 224,4864, 232,6464, 240,384, 248,1984, 256,3584,
+   264,5184, 272,6784, 280,704, 288,2304, 296,3904, 304,5504, 312,7104, 320,1024,
+   328,2624, 336,4224, 344,5824, 352,7424, 360,1344, 368,2944, 376,4544, 384,6144,
+   392,7744, 400,2560, 408,1728, 416,3328, 424,4928, 432,6528, 440,448, 0,0,
+   448,2048, 456,3648, 464,5248, 472,6848, 480,768, 488,2368, 496,3968, 504,5568,
+   512,7168, 520,1088, 528,2688, 536,4288, 544,5888, 552,7488, 560,1408, 568,3008,
+   576,4608, 584,6208, 592,7808, 600,7680, 608,1792, 616,3392, 624,4992, 632,6592,
+   640,7168, 648,2112, 656,3712, 664,5312, 672,6912, 680,832, 688,2432, 696,4032,
+   704,5632, 712,7232, 720,1152, 728,2752, 736,4352, 744,5952, 752,7552, 760,1472,
+   768,3072, 776,4672, 784,6272, 792,7872, 800,3584, 808,1856, 816,3456, 824,5056,
+   832,6656, 840,4608, 848,2176, 856,3776, 864,5376, 872,6976, 880,896, 888,2496,
+   896,4096, 904,5696, 912,7296, 920,1216, 928,2816, 936,4416, 944,6016, 952,7616,
+   960,1536, 968,3136, 976,4736, 984,6336, 992,7936, 1000,3200, 1008,1616, 1016,3216,
+   1024,4816, 1032,6416, 1040,4224, 1048,1936, 1056,3536, 1064,5136, 1072,6736, 1080,3712,
+   1088,2256, 1096,3856, 1104,5456, 1112,7056, 1120,4736, 1128,2576, 1136,4176, 1144,5776,
+   1152,7376, 1160,1296, 1168,2896, 1176,4496, 1184,6096, 1192,7696, 1200,7168, 1208,1680,
+   1216,3280, 1224,4880, 1232,6480, 1240,2560, 1248,2000, 1256,3600, 1264,5200, 1272,6800,
+   1280,7376, 1288,2320, 1296,3920, 1304,5520, 1312,7120, 1320,4224, 1328,2640, 1336,4240,
+   1344,5840, 1352,7440, 1368,2960, 1376,4560, 1384,6160, 1392,7760, 1400,5760, 1408,1744,
+   1416,3344, 1424,4944, 1432,6544, 1440,5248, 1448,2064, 1456,3664, 1464,5264, 1472,6864,
+   1480,6272, 1488,2384, 1496,3984, 1504,5584, 1512,7184, 1520,5456, 1528,2704, 1536,4304,
+   1544,5904, 1552,7504, 1560,4944, 1568,3024, 1576,4624, 1584,6224, 1592,7824, 1600,1664,
+   1608,1808, 1616,3408, 1624,5008, 1632,6608, 1640,2688, 1648,2128, 1656,3728, 1664,5328,
+   1672,6928, 1680,2176, 1688,2448, 1696,4048, 1704,5648, 1712,7248, 1720,2896, 1728,2768,
+   1736,4368, 1744,5968, 1752,7568, 1760,2384, 1768,3088, 1776,4688, 1784,6288, 1792,7888,
+   1800,6784, 1808,1872, 1816,3472, 1824,5072, 1832,6672, 1840,7808, 1848,2192, 1856,3792,
+   1864,5392, 1872,6992, 1880,7296, 1888,2512, 1896,4112, 1904,5712, 1912,7312, 1920,6480,
+   1928,2832, 1936,4432, 1944,6032, 1952,7632, 1960,7504, 1968,3152, 1976,4752, 1984,6352,
+   1992,7952, 2000,6400, 2008,6608, 2016,3232, 2024,4832, 2032,6432, 2040,7424, 2048,7632,
+   2056,3552, 2064,5152, 2072,6752, 2080,6912, 2088,2272, 2096,3872, 2104,5472, 2112,7072,
+   2120,7936, 2128,2592, 2136,4192, 2144,5792, 2152,7392, 2160,7120, 2168,2912, 2176,4512,
+   2184,6112, 2192,7712, 2200,3840, 2208,4048, 2216,3296, 2224,4896, 2232,6496, 2240,3328,
+   2248,3232, 2256,3616, 2264,5216, 2272,6816, 2280,4352, 2288,2336, 2296,3936, 2304,5536,
+   2312,7136, 2320,3536, 2328,2656, 2336,4256, 2344,5856, 2352,7456, 2360,4560, 2368,2976,
+   2376,4576, 2384,6176, 2392,7776, 2400,7376, 2408,6176, 2416,3360, 2424,4960, 2432,6560,
+   2440,3072, 2448,6912, 2456,3680, 2464,5280, 2472,6880, 2480,3584, 2488,7376, 2496,4000,
+   2504,5600, 2512,7200, 2520,4736, 2528,2720, 2536,4320, 2544,5920, 2552,7520, 2560,5248,
+   2568,3040, 2576,4640, 2584,6240, 2592,7840, 2600,4864, 2608,5072, 2616,3424, 2624,5024,
+   2632,6624, 2640,5888, 2648,5792, 2656,3744, 2664,5344, 2672,6944, 2680,5376, 2688,5280,
+   2696,4064, 2704,5664, 2712,7264, 2720,6096, 2728,2784, 2736,4384, 2744,5984, 2752,7584,
+   2760,5584, 2768,3104, 2776,4704, 2784,6304, 2792,7904, 2800,5536, 2808,7200, 2816,3488,
+   2824,5088, 2832,6688, 2840,7888, 2848,4048, 2856,3808, 2864,5408, 2872,7008, 2880,3488,
+   2888,6096, 2896,4128, 2904,5728, 2912,7328, 2920,6400, 2928,4048, 2936,4448, 2944,6048,
+   2952,7648, 2960,3024, 2968,3168, 2976,4768, 2984,6368, 2992,7968, 3000,6480, 3008,7840,
+   3016,3248, 3024,4848, 3032,6448, 3040,6048, 3048,3152, 3056,3568, 3064,5168, 3072,6768,
+   3080,6560, 3088,4256, 3096,3888, 3104,5488, 3112,7088, 3120,3408, 3128,5072, 3136,4208,
+   3144,5808, 3152,7408, 3160,5888, 3168,4048, 3176,4528, 3184,6128, 3192,7728, 3200,7040,
+   3208,7248, 3216,3312, 3224,4912, 3232,6512, 3240,6528, 3248,6432, 3256,3632, 3264,5232,
+   3272,6832, 3280,7552, 3288,7456, 3296,3952, 3304,5552, 3312,7152, 3320,6736, 3328,6944,
+   3336,4272, 3344,5872, 3352,7472, 3360,7760, 3368,7968, 3376,4592, 3384,6192, 3392,7792,
+   3400,4480, 3408,4688, 3416,4592, 3424,4976, 3432,6576, 3440,3968, 3448,3872, 3456,3696,
+   3464,5296, 3472,6896, 3480,3696, 3488,7760, 3496,4016, 3504,5616, 3512,7216, 3520,4176,
+   3528,4384, 3536,4336, 3544,5936, 3552,7536, 3560,3664, 3576,4656, 3584,6256, 3592,7856,
+   3600,6144, 3608,7808, 3616,3968, 3624,5040, 3632,6640, 3640,5968, 3648,7120, 3656,3760,
+   3664,5360, 3672,6960, 3680,4096, 3688,6256, 3696,4080, 3704,5680, 3712,7280, 3720,7168,
+   3728,5536, 3736,4400, 3744,6000, 3752,7600, 3760,5456, 3768,4688, 3776,4720, 3784,6320,
+   3792,7920, 3800,5504, 3808,5712, 3816,5616, 3824,5104, 3832,6704, 3840,4992, 3848,4896,
+   3856,5104, 3864,5424, 3872,7024, 3880,6016, 3888,5920, 3896,4144, 3904,5744, 3912,7344,
+   3920,5200, 3928,5408, 3936,4464, 3944,6064, 3952,7664, 3960,6224, 3968,6128, 3976,4784,
+   3984,6384, 3992,7984, 4000,5328, 4008,6992, 4016,7248, 4024,4808, 4032,6408, 4040,5024,
+   4048,6688, 4056,4384, 4064,5128, 4072,6728, 4080,7072, 4088,6512, 4096,4896, 4104,5448,
+   4112,7048, 4120,4208, 4128,6048, 4136,4168, 4144,5768, 4152,7368, 4160,4336, 4168,6096,
+   4176,4488, 4184,6088, 4192,7688, 4200,6720, 4208,6928, 4216,6832, 4224,4872, 4232,6472,
+   4240,7744, 4248,7952, 4256,7856, 4264,5192, 4272,6792, 4280,7232, 4288,7136, 4296,7344,
+   4304,5512, 4312,7112, 4320,6416, 4328,6624, 4336,6472, 4344,5832, 4352,7432, 4360,7440,
+   4368,7648, 4376,4552, 4384,6152, 4392,7752, 4400,6472, 4408,7648, 4416,6792, 4424,4936,
+   4432,6536, 4440,7120, 4448,7536, 4456,5456, 4464,5256, 4472,6856, 4480,4672, 4488,4576,
+   4496,4784, 4504,5576, 4512,7176, 4520,5104, 4528,5128, 4536,7344, 4544,5896, 4552,7496,
+   4560,5872, 4568,6432, 4576,4616, 4584,6216, 4592,7816, 4600,5120, 4608,6784, 4616,4672,
+   4624,5000, 4632,6600, 4640,6128, 4648,7936, 4656,7168, 4664,5320, 4672,6920, 4680,6784,
+   4688,6768, 4696,5024, 4704,5640, 4712,7240, 4720,5200, 4728,5584, 4736,7440, 4744,5960,
+   4752,7560, 4760,6272, 4768,6560, 4776,6784, 4784,6280, 4792,7880, 4800,5184, 4808,5392,
+   4816,5296, 4824,5064, 4832,6664, 4840,6208, 4848,6112, 4856,6320, 4864,5384, 4872,6984,
+   4880,5696, 4888,5600, 4896,5448, 4904,5704, 4912,7304, 4920,5696, 4928,5088, 4944,6024,
+   4952,7624, 4960,5904, 4968,5808, 4976,5960, 4984,6344, 4992,7944, 5000,5184, 5016,7304,
+   5024,5064, 5032,6424, 5040,5824, 5048,6032, 5056,5936, 5064,5144, 5072,6744, 5080,5312,
+   5088,5216, 5096,5424, 5104,5464, 5112,7064, 5120,6336, 5128,6240, 5136,6088, 5144,5784,
+   5152,7384, 5160,5520, 5168,5728, 5176,5576, 5184,6104, 5192,7704, 5200,6944, 5208,6912,
+   5216,7456, 5224,5600, 5232,6488, 5240,5488, 5248,6608, 5256,7808, 5264,6912, 5272,6808,
+   5280,7584, 5288,6000, 5296,5408, 5304,5528, 5312,7128, 5320,6536, 5328,5792, 5336,7952,
+   5344,5848, 5352,7448, 5360,6112, 5368,6688, 5376,6432, 5384,6168, 5392,7768, 5400,7360,
+   5408,7568, 5416,7472, 5424,7624, 5432,6552, 5440,6848, 5448,6752, 5456,6960, 5464,6808,
+   5472,6872, 5480,7872, 5488,7776, 5496,7984, 5504,5592, 5512,7192, 5520,7056, 5528,7264,
+   5536,7112, 5544,5912, 5552,7512, 5560,6544, 5568,6448, 5576,6600, 5584,6232, 5592,7832,
+   5600,6488, 5608,6896, 5616,7816, 5624,7304, 5632,6616, 5640,7136, 5648,7688, 5656,6472,
+   5664,7952, 5672,6936, 5680,6944, 5688,6752, 5696,6152, 5704,6472, 5712,7256, 5720,6280,
+   5728,7136, 5736,7496, 5744,5976, 5752,7576, 5760,6384, 5768,5920, 5776,5784, 0,0,
+   5784,6296, 5792,7896, 5800,6616, 5808,7296, 5816,7072, 5824,7128, 5832,6680, 5840,7680,
+   5848,7944, 5856,7832, 5864,7360, 5872,7000, 5880,7552, 5888,7440, 5896,6928, 5904,6280,
+   5912,7320, 5920,6608, 5928,7888, 5936,7120, 5944,6040, 5952,7640, 5960,6024, 5968,7440,
+   5976,6272, 5984,6360, 5992,7960, 6000,7568, 6008,7584, 6016,6528, 6024,6208, 6032,6440,
+   6040,7680, 6048,7504, 6056,6112, 6064,7056, 6072,6760, 6080,6656, 6088,7432, 6096,6528,
+   6104,7872, 6112,7080, 6120,7040, 6128,6168, 6136,6720, 6144,6616, 6152,7400, 6160,6984,
+   6168,6400, 6176,6808, 6184,7040, 6192,7720, 6200,6848, 6208,7688, 6216,7512, 6224,6472,
+   6232,6504, 6240,7456, 6248,6664, 6256,7128, 6264,6488, 6272,6824, 6280,7640, 6288,7832,
+   6296,7056, 6304,7320, 6312,7144, 6320,7432, 6328,7944, 6336,7704, 6344,7360, 6352,7464,
+   6360,6984, 6376,7512, 6384,7040, 6392,7784, 6400,7760, 6408,7856, 6416,7968, 6424,7296,
+   6432,6568, 6440,6560, 6448,6816, 6456,7128, 6464,7568, 6472,6888, 6480,7920, 6488,6808,
+   6496,6992, 6504,6896, 6512,7208, 6520,7760, 6528,7320, 6536,6624, 6544,7888, 6552,7528,
+   6560,7384, 6568,7408, 6576,7936, 6584,6664, 6592,7848, 6600,7568, 6608,6672, 6616,7936,
+   6624,7296, 6640,7488, 6648,7392, 6656,7600, 6664,7448, 6672,6952, 6680,6976, 6688,6880,
+   6696,6728, 6704,6936, 6712,7272, 6720,7696, 6728,7904, 6736,7752, 6744,7960, 6752,7592,
+   6760,7184, 6768,7088, 6776,7240, 6784,7144, 6792,7912, 6800,6824, 6808,7048, 6816,7248,
+   6824,7624, 6832,7904, 6840,7792, 6848,7664, 6856,7816, 6864,7472, 6872,7016, 6880,7912,
+   6888,7968, 6896,7320, 6904,7496, 6912,7336, 6920,7936, 6928,7256, 6936,6960, 6944,7080,
+   6952,7656, 6960,7872, 6968,7456, 6976,7144, 6984,7512, 6992,7976, 7000,7936, 7008,7112,
+   7016,7488, 7024,7432, 7032,7128, 7040,7256, 7048,7560, 7056,7168, 7064,7568, 7072,7240,
+   7080,7856, 7088,7808, 7096,7656, 7104,7984, 7112,7656, 7120,7152, 7128,7688, 7136,7904,
+   7144,7240, 7152,7416, 7160,7744, 7168,7536, 7176,7344, 7184,7696, 7192,7736, 0,0,
+   7200,7736, 7208,7504, 7216,7752, 7224,7400, 7232,7760, 7240,7632, 7248,7424, 7256,7440,
+   7264,7776, 7272,7792, 7280,7472, 7288,7936, 7296,7968, 7304,7888, 7312,7744, 7320,7472,
+   7328,7408, 7336,7760, 7344,7552, 7352,7480, 7360,7440, 7368,7920, 7376,7704, 7384,7664,
+   7392,7800, 7400,7600, 7408,7832, 7416,7720, 7424,7440, 7432,7448, 7448,7488, 7456,7856,
+   7464,7776, 7472,7496, 7480,7720, 7488,7640, 7496,7768, 7504,7888, 7512,7600, 7520,7536,
+   7528,7600, 7536,7632, 7544,7680, 0,0, 7552,7680, 7560,7760, 7568,7904, 7576,7968,
+   7584,7760, 7592,7864, 7600,7776, 7608,7712, 7616,7640, 7624,7664, 7632,7800, 7640,7840,
+   7648,7832, 7656,7808, 7664,7912, 7672,7856, 7680,7896, 7688,7704, 7696,7888, 7704,7864,
+   7712,7936, 7720,7896, 7728,7736, 0,0, 7736,7832, 7744,7760, 7752,7936, 7760,7952,
+   7768,7960, 0,0, 7776,7960, 7784,7944, 7792,7928, 7800,7984, 7808,7952, 7816,7936,
+   7824,7904, 7832,7928, 7840,7848, 0,0, 7848,7976, 7856,7872, 7864,7960, 0,0,
+   7872,7960, 7880,7976, 7888,7984, 7896,7920, 7904,7968, 7912,7920, 7928,7952, 7944,7984,
+   7952,7960, 0,0, 7960,7968, 0,0
+};
+#endif
+
+#if defined(ARM_TABLE_FFT_F32_1200)
+const uint16_t armBitRevIndexTable1200[ARMBITREVINDEXTABLE1200_TABLE_LENGTH] ARM_DSP_TABLE_ATTR = 
+{
+   //radix 5-5-3-4-4, size 2400
+   8,1920, 16,3840, 24,5760, 32,7680, 40,384, 48,2304, 56,4224, 64,6144,
+   72,8064, 80,768, 88,2688, 96,4608, 104,6528, 112,8448, 120,1152, 128,3072,
+   136,4992, 144,6912, 152,8832, 160,1536, 168,3456, 176,5376, 184,7296, 192,9216,
+   200,3072, 208,2048, 216,3968, 224,5888, 232,7808, 240,512, 248,2432, 256,4352,
+   264,6272, 272,8192, 280,896, 288,2816, 296,4736, 304,6656, 312,8576, 320,1280,
+   328,3200, 336,5120, 344,7040, 352,8960, 360,1664, 368,3584, 376,5504, 384,7424,
+   392,9344, 400,4352, 408,2176, 416,4096, 424,6016, 432,7936, 440,640, 448,2560,
+   456,4480, 464,6400, 472,8320, 480,1024, 488,2944, 496,4864, 504,6784, 512,8704,
+   520,1408, 528,3328, 536,5248, 544,7168, 552,9088, 560,1792, 568,3712, 576,5632,
+   584,7552, 592,9472, 600,7680, 608,1952, 616,3872, 624,5792, 632,7712, 640,4096,
+   648,2336, 656,4256, 664,6176, 672,8096, 680,800, 688,2720, 696,4640, 704,6560,
+   712,8480, 720,1184, 728,3104, 736,5024, 744,6944, 752,8864, 760,1568, 768,3488,
+   776,5408, 784,7328, 792,9248, 800,1536, 808,2080, 816,4000, 824,5920, 832,7840,
+   840,7168, 848,2464, 856,4384, 864,6304, 872,8224, 880,928, 888,2848, 896,4768,
+   904,6688, 912,8608, 920,1312, 928,3232, 936,5152, 944,7072, 952,8992, 960,1696,
+   968,3616, 976,5536, 984,7456, 992,9376, 1000,2816, 1008,2208, 1016,4128, 1024,6048,
+   1032,7968, 1040,8096, 1048,2592, 1056,4512, 1064,6432, 1072,8352, 1080,4512, 1088,2976,
+   1096,4896, 1104,6816, 1112,8736, 1120,1440, 1128,3360, 1136,5280, 1144,7200, 1152,9120,
+   1160,1824, 1168,3744, 1176,5664, 1184,7584, 1192,9504, 1200,6144, 1208,1984, 1216,3904,
+   1224,5824, 1232,7744, 1240,2560, 1248,2368, 1256,4288, 1264,6208, 1272,8128, 1280,7840,
+   1288,2752, 1296,4672, 1304,6592, 1312,8512, 1320,3904, 1328,3136, 1336,5056, 1344,6976,
+   1352,8896, 1360,1600, 1368,3520, 1376,5440, 1384,7360, 1392,9280, 1400,9216, 1408,2112,
+   1416,4032, 1424,5952, 1432,7872, 1440,5632, 1448,2496, 1456,4416, 1464,6336, 1472,8256,
+   1480,1696, 1488,2880, 1496,4800, 1504,6720, 1512,8640, 1520,6976, 1528,3264, 1536,5184,
+   1544,7104, 1552,9024, 1560,1728, 1568,3648, 1576,5568, 1584,7488, 1592,9408, 1600,7840,
+   1608,2240, 1616,4160, 1624,6080, 1632,8000, 1640,6560, 1648,2624, 1656,4544, 1664,6464,
+   1672,8384, 1680,2976, 1688,3008, 1696,4928, 1704,6848, 1712,8768, 1720,8256, 1728,3392,
+   1736,5312, 1744,7232, 1752,9152, 1760,1856, 1768,3776, 1776,5696, 1784,7616, 1792,9536,
+   1800,4608, 1808,2016, 1816,3936, 1824,5856, 1832,7776, 1840,6048, 1848,2400, 1856,4320,
+   1864,6240, 1872,8160, 1880,6304, 1888,2784, 1896,4704, 1904,6624, 1912,8544, 1920,2368,
+   1928,3168, 1936,5088, 1944,7008, 1952,8928, 1960,8000, 1968,3552, 1976,5472, 1984,7392,
+   1992,9312, 2000,5888, 2008,2144, 2016,4064, 2024,5984, 2032,7904, 2040,8928, 2048,2528,
+   2056,4448, 2064,6368, 2072,8288, 2080,9376, 2088,2912, 2096,4832, 2104,6752, 2112,8672,
+   2120,5440, 2128,3296, 2136,5216, 2144,7136, 2152,9056, 2160,4320, 2168,3680, 2176,5600,
+   2184,7520, 2192,9440, 2200,8960, 2208,2272, 2216,4192, 2224,6112, 2232,8032, 2240,5024,
+   2248,2656, 2256,4576, 2264,6496, 2272,8416, 2280,5632, 2288,3040, 2296,4960, 2304,6880,
+   2312,8800, 2320,6720, 2328,3424, 2336,5344, 2344,7264, 2352,9184, 2360,2784, 2368,3808,
+   2376,5728, 2384,7648, 2392,9568, 2400,3808, 2408,3168, 2416,3848, 2424,5768, 2432,7688,
+   2440,9344, 2448,8800, 2456,4232, 2464,6152, 2472,8072, 2480,5408, 2488,2696, 2496,4616,
+   2504,6536, 2512,8456, 2520,5856, 2528,3080, 2536,5000, 2544,6920, 2552,8840, 2560,7104,
+   2568,3464, 2576,5384, 2584,7304, 2592,9224, 2600,4992, 2608,4448, 2616,3976, 2624,5896,
+   2632,7816, 2640,8672, 2648,9344, 2656,4360, 2664,6280, 2672,8200, 2680,6688, 2688,2824,
+   2696,4744, 2704,6664, 2712,8584, 2720,2752, 2728,3208, 2736,5128, 2744,7048, 2752,8968,
+   2760,8384, 2768,3592, 2776,5512, 2784,7432, 2792,9352, 2800,6272, 2808,7520, 2816,4104,
+   2824,6024, 2832,7944, 2840,5344, 2848,3464, 2856,4488, 2864,6408, 2872,8328, 2880,7968,
+   2888,2952, 2896,4872, 2904,6792, 2912,8712, 2920,4032, 2928,3336, 2936,5256, 2944,7176,
+   2952,9096, 2960,4608, 2968,3720, 2976,5640, 2984,7560, 2992,9480, 3000,7424, 3008,8000,
+   3016,3880, 3024,5800, 3032,7720, 3040,6016, 3048,7264, 3056,4264, 3064,6184, 3072,8104,
+   3080,9376, 3088,3208, 3096,4648, 3104,6568, 3112,8488, 3120,9504, 3128,8488, 3136,5032,
+   3144,6952, 3152,8872, 3160,5568, 3168,3496, 3176,5416, 3184,7336, 3192,9256, 3200,3456,
+   3208,8712, 3216,4008, 3224,5928, 3232,7848, 3240,9088, 3248,8072, 3256,4392, 3264,6312,
+   3272,8232, 3280,5152, 3288,4488, 3296,4776, 3304,6696, 3312,8616, 3320,3904, 3328,9088,
+   3336,5160, 3344,7080, 3352,9000, 3360,6848, 3368,3624, 3376,5544, 3384,7464, 3392,9384,
+   3400,4736, 3408,4192, 3416,4136, 3424,6056, 3432,7976, 3440,5184, 3448,4992, 3456,4520,
+   3464,6440, 3472,8360, 3480,6432, 3488,7560, 3496,4904, 3504,6824, 3512,8744, 3520,4616,
+   3528,3624, 3536,5288, 3544,7208, 3552,9128, 3560,7776, 3568,3752, 3576,5672, 3584,7592,
+   3592,9512, 3600,8064, 3608,9312, 3616,3912, 3624,5832, 3632,7752, 3640,4480, 3648,5728,
+   3656,4296, 3664,6216, 3672,8136, 3680,7168, 3688,8384, 3696,4680, 3704,6600, 3712,8520,
+   3720,5824, 3728,6952, 3736,5064, 3744,6984, 3752,8904, 3760,5024, 3768,5832, 3776,5448,
+   3784,7368, 3792,9288, 3800,8104, 3808,5440, 3816,4040, 3824,5960, 3832,7880, 3840,7552,
+   3848,6536, 3856,4424, 3864,6344, 3872,8264, 3880,3912, 3888,9096, 3896,4808, 3904,6728,
+   3912,8648, 3920,8896, 3928,8232, 3936,5192, 3944,7112, 3952,9032, 3960,5312, 3968,4296,
+   3976,5576, 3984,7496, 3992,9416, 4000,4520, 4008,4360, 4016,4168, 4024,6088, 4032,8008,
+   4040,8480, 4048,7816, 4056,4552, 4064,6472, 4072,8392, 4080,4896, 4088,8648, 4096,4936,
+   4104,6856, 4112,8776, 4120,4928, 4128,4736, 4136,5320, 4144,7240, 4152,9160, 4160,6240,
+   4168,7368, 4176,5704, 4184,7624, 4192,9544, 4200,6528, 4208,5984, 4216,7112, 4224,5864,
+   4232,7784, 4240,7176, 4248,4904, 4256,4328, 4264,6248, 4272,8168, 4280,8224, 4288,9352,
+   4296,4712, 4304,6632, 4312,8552, 4320,9352, 4328,5416, 4336,5096, 4344,7016, 4352,8936,
+   4360,6560, 4368,7776, 4376,5480, 4384,7400, 4392,9320, 4400,7808, 4408,9056, 4416,8392,
+   4424,5992, 4432,7912, 4440,8264, 4448,5000, 4464,6376, 4472,8296, 4480,6856, 4488,8008,
+   4496,4840, 4504,6760, 4512,8680, 4520,7360, 4528,6696, 4536,5224, 4544,7144, 4552,9064,
+   4560,5448, 4568,8384, 4576,5608, 4584,7528, 4592,9448, 4600,6464, 4608,5632, 4616,6528,
+   4624,6120, 4632,8040, 4640,6944, 4648,6280, 4656,7528, 4664,6504, 4672,8424, 4680,6848,
+   4688,7264, 4696,4968, 4704,6888, 4712,8808, 4720,8640, 4728,7976, 4736,5352, 4744,7272,
+   4752,9192, 4760,6888, 4768,8480, 4776,5736, 4784,7656, 4792,9576, 4800,7552, 4808,5088,
+   4816,5992, 4824,5776, 4832,7696, 4840,8936, 4848,6720, 4856,7176, 4864,6160, 4872,8080,
+   4880,7328, 4888,6664, 4896,6120, 4904,6544, 4912,8464, 4920,6984, 4928,8712, 4936,5008,
+   4944,6928, 4952,8848, 4960,9024, 4968,8360, 4976,5392, 4984,7312, 4992,9232, 5000,6912,
+   5008,6368, 5016,7496, 5024,5904, 5032,7824, 5040,9088, 5048,8800, 5056,7776, 5064,6288,
+   5072,8208, 5080,8608, 5088,7944, 5096,9192, 5104,6672, 5112,8592, 5120,8424, 5128,6560,
+   5144,7056, 5152,8976, 5160,5640, 5168,8064, 5176,5520, 5184,7440, 5192,9360, 5200,8192,
+   5208,9440, 5216,8776, 5224,6032, 5232,7952, 5240,5416, 5248,5384, 5256,8936, 5264,6416,
+   5272,8336, 5280,8096, 5288,5632, 5296,7328, 5304,6800, 5312,8720, 5320,5952, 5328,7080,
+   5336,6416, 5344,7184, 5352,9104, 5360,6472, 5368,6952, 5376,5648, 5384,7568, 5392,9488,
+   5400,6880, 5408,9128, 5416,9096, 5424,5808, 5432,7728, 5440,7936, 5448,9184, 5456,8168,
+   5464,6192, 5472,8112, 5480,7360, 5488,6560, 5496,7528, 5504,6576, 5512,8496, 5520,6144,
+   5528,9504, 5536,9088, 5544,6960, 5552,8880, 5560,7488, 5568,6824, 5576,5808, 5584,7344,
+   5592,9264, 5600,5648, 5608,7696, 5616,7368, 5624,5936, 5632,7856, 5640,9536, 5648,9128,
+   5656,7808, 5664,6320, 5672,8240, 5680,7072, 5688,6408, 5696,7656, 5704,6704, 5712,8624,
+   5720,7824, 5728,8072, 5736,8064, 5744,7088, 5752,9008, 5760,8768, 5768,7752, 5776,8880,
+   5784,7472, 5792,9392, 5800,6656, 5808,6112, 5816,7240, 5824,6064, 5832,7984, 5840,8968,
+   5848,6912, 5856,6696, 5864,6448, 5872,8368, 5880,8352, 5888,9480, 5896,8464, 5904,6832,
+   5912,8752, 5920,8392, 5928,6960, 5936,7328, 5944,7216, 5952,9136, 5960,6048, 5968,6832,
+   5976,7072, 5984,7600, 5992,9520, 6000,7560, 6008,9480, 6016,8896, 6024,8968, 6032,7760,
+   6040,6400, 6048,7648, 6056,6632, 6064,6224, 6072,8144, 6080,6152, 6088,9512, 6096,7264,
+   6104,6608, 6112,8528, 6120,7744, 6128,8872, 6136,8208, 6144,6992, 6152,8912, 6160,6240,
+   6168,7856, 6176,8168, 6184,7376, 6192,9296, 6200,9376, 6208,8064, 6216,7816, 6224,6832,
+   6232,7888, 6240,9472, 6248,8456, 6256,7912, 6264,6352, 6272,8272, 6280,9088, 6288,8080,
+   6296,9520, 6304,6736, 6312,8656, 6320,7840, 6328,8976, 6336,8192, 6344,7120, 6352,9040,
+   6360,7232, 6368,7816, 6376,7344, 6384,7504, 6392,9424, 6400,8424, 6408,7696, 6416,6704,
+   6424,7264, 6432,8016, 6440,7584, 6448,8672, 6456,9184, 6464,6480, 6472,8400, 6480,6816,
+   6488,6656, 6496,6928, 6504,6864, 6512,8784, 6520,7968, 6528,9544, 6536,7080, 6544,7248,
+   6552,9168, 6560,8160, 6568,9288, 6576,8624, 6584,7632, 6592,9552, 6600,8448, 6608,7904,
+   6616,9032, 6624,8368, 6632,7792, 6640,9472, 6648,7080, 6656,9192, 6664,7912, 6672,8176,
+   6680,7848, 6688,8272, 6696,8640, 6704,9472, 6712,8560, 6720,8064, 6728,7336, 6736,8176,
+   6744,7024, 6752,8944, 6760,8464, 6768,8904, 6776,8160, 6784,7408, 6792,9328, 6800,8704,
+   6808,9352, 6816,7744, 6824,7560, 6832,7920, 6840,9392, 6848,6920, 6856,7344, 6864,7504,
+   6872,8304, 6880,8416, 6888,9536, 6896,8064, 6904,8904, 6912,8688, 6920,9280, 6928,8616,
+   6936,7952, 6944,7152, 6952,9072, 6960,7656, 6968,9280, 6976,7368, 6984,7536, 6992,9456,
+   7000,7592, 7008,8896, 7016,7600, 7024,8872, 7032,8048, 7040,8864, 7048,8200, 7056,9448,
+   7064,8784, 7072,8432, 7080,8096, 7088,8456, 7096,9488, 7104,8064, 7112,8816, 7120,7368,
+   7128,7440, 7136,8400, 7144,7280, 7152,9200, 7160,8368, 7168,7648, 7176,8456, 7184,7664,
+   7192,9584, 7200,8768, 7208,8896, 7216,7368, 7224,7472, 7232,7704, 7240,9128, 7248,7792,
+   7256,7792, 7264,7856, 7272,8088, 7280,9248, 7288,8584, 7296,8040, 7304,9168, 7312,8472,
+   7320,7840, 7328,9088, 7336,7496, 7344,7952, 7352,8856, 7360,9384, 7368,8016, 7376,8416,
+   7384,7840, 7392,9240, 7400,8832, 7408,8288, 7416,9416, 7424,8752, 7432,7832, 7440,7568,
+   7448,7784, 7456,9384, 7464,9520, 7472,8216, 7480,8512, 7488,7664, 7496,9536, 7504,7848,
+   7512,8600, 7520,9552, 7528,7656, 7536,9448, 7544,8784, 7552,8984, 7560,8000, 7568,9312,
+   7576,9504, 7584,7784, 7592,9368, 7600,8480, 7608,8960, 7616,8712, 7624,8424, 7632,7960,
+   7640,8168, 7648,9168, 7656,8464, 7664,7856, 7672,8344, 7680,9224, 7688,7920, 7696,7912,
+   7704,9352, 7712,8728, 7720,7872, 7728,9000, 7736,8336, 7744,9584, 7752,9112, 7760,9360,
+   7768,8080, 7776,7808, 7784,9504, 7792,9496, 7800,8672, 7808,8112, 7816,7944, 7824,9128,
+   7832,8336, 7840,7944, 7848,8336, 7856,8224, 7864,9376, 7872,8120, 7880,8392, 7888,8200,
+   7896,8336, 7904,7960, 7912,8504, 7920,9240, 7928,8488, 7936,8800, 7944,9280, 7952,8888,
+   7960,9408, 7968,8744, 7976,9000, 7984,8856, 7992,9272, 8000,8040, 8008,8944, 8016,9512,
+   8024,9512, 8032,9376, 8040,8520, 8048,8088, 8056,9056, 8064,8976, 8072,8248, 8080,8992,
+   8088,8328, 8096,9576, 8104,8560, 8112,8632, 8120,8632, 8128,9320, 8136,9456, 8144,9488,
+   8152,9016, 8160,8256, 8168,8888, 8176,8224, 8184,8512, 8192,9400, 8200,8576, 8208,9376,
+   8216,9160, 8224,9488, 8232,9272, 8240,9200, 8248,8528, 8256,9360, 8264,9184, 8272,8376,
+   8280,8680, 8288,8752, 8296,9448, 8304,9392, 8312,8760, 8320,9400, 8328,9520, 8336,8704,
+   8344,9160, 8352,9144, 8360,8800, 8368,8856, 8376,8504, 8384,8960, 8392,9528, 8400,8968,
+   8408,8968, 8416,9272, 8424,8688, 8432,8992, 8440,9400, 8448,9568, 8456,8552, 8464,8576,
+   8472,9016, 8480,8832, 8488,8496, 0,0, 8496,8800, 8504,9032, 8512,8536, 8520,8976,
+   8528,8976, 8536,8608, 8544,9368, 8552,8920, 8560,8912, 8568,8896, 8576,9296, 8584,9280,
+   8592,9304, 8600,8808, 8608,8776, 8616,9064, 8624,8992, 8632,8704, 8640,9224, 0,0,
+   8648,9224, 8656,9184, 8664,9352, 8672,8680, 8680,9384, 8688,9328, 8696,8880, 8704,8872,
+   8712,9352, 8720,9544, 8728,8944, 8736,9440, 8744,9312, 8752,9048, 8760,9152, 8768,9456,
+   8776,9264, 8784,8808, 8792,9432, 8800,8864, 8808,9064, 8816,9328, 8824,9408, 8832,9512,
+   8840,9288, 8848,9344, 8856,8960, 8864,9192, 8872,8968, 8880,9440, 8888,8968, 8896,9344,
+   8904,9392, 8912,9432, 8920,8984, 8928,9136, 8936,9472, 8944,9496, 8952,9176, 8960,9488,
+   8968,9432, 8976,9128, 8984,9432, 8992,9560, 9000,9120, 9008,9136, 9016,9544, 9024,9144,
+   9032,9384, 9040,9048, 9048,9112, 9056,9512, 9064,9112, 9072,9264, 9080,9504, 9088,9552,
+   9096,9120, 9104,9576, 9112,9344, 9120,9320, 9128,9256, 9136,9304, 9144,9520, 9152,9176,
+   9160,9248, 9168,9200, 9176,9296, 9184,9416, 9192,9336, 9200,9240, 9208,9240, 9216,9224,
+   9224,9480, 9232,9336, 9240,9496, 9248,9288, 9256,9448, 9264,9424, 9272,9296, 9280,9576,
+   9288,9472, 9296,9432, 9304,9360, 9312,9440, 9320,9480, 9328,9536, 9336,9480, 9344,9488,
+   9352,9504, 0,0, 9360,9504, 9368,9568, 9376,9552, 9384,9488, 9392,9464, 9400,9560,
+   9408,9520, 9416,9536, 9424,9552, 9432,9512, 9440,9448, 0,0, 9448,9488, 9456,9584,
+   9464,9488, 9472,9560, 9480,9584, 9488,9512, 9496,9544, 9504,9512, 9512,9520, 0,0,
+   9520,9536, 9528,9584, 9536,9552, 9544,9576, 9552,9576, 9560,9568, 9568,9584, 0,0
+};
+#endif
+
+#if defined(ARM_TABLE_FFT_F32_1536)
+const uint16_t armBitRevIndexTable1536[ARMBITREVINDEXTABLE1536_TABLE_LENGTH] ARM_DSP_TABLE_ATTR = 
+{
+   //radix 3-4-4-4-4-2, size 3020
+   8,4096, 16,8192, 24,1024, 32,5120, 40,9216, 48,2048, 56,6144, 64,10240,
+   72,3072, 80,7168, 88,11264, 96,256, 104,4352, 112,8448, 120,1280, 128,5376,
+   136,9472, 144,2304, 152,6400, 160,10496, 168,3328, 176,7424, 184,11520, 192,512,
+   200,4608, 208,8704, 216,1536, 224,5632, 232,9728, 240,2560, 248,6656, 256,10752,
+   264,3584, 272,7680, 280,11776, 288,768, 296,4864, 304,8960, 312,1792, 320,5888,
+   328,9984, 336,2816, 344,6912, 352,11008, 360,3840, 368,7936, 376,12032, 384,10240,
+   392,4160, 400,8256, 408,1088, 416,5184, 424,9280, 432,2112, 440,6208, 448,10304,
+   456,3136, 464,7232, 472,11328, 480,5888, 488,4416, 496,8512, 504,1344, 512,5440,
+   520,9536, 528,2368, 536,6464, 544,10560, 552,3392, 560,7488, 568,11584, 584,4672,
+   592,8768, 600,1600, 608,5696, 616,9792, 624,2624, 632,6720, 640,10816, 648,3648,
+   656,7744, 664,11840, 672,832, 680,4928, 688,9024, 696,1856, 704,5952, 712,10048,
+   720,2880, 728,6976, 736,11072, 744,3904, 752,8000, 760,12096, 768,5376, 776,4224,
+   784,8320, 792,1152, 800,5248, 808,9344, 816,2176, 824,6272, 832,10368, 840,3200,
+   848,7296, 856,11392, 864,10240, 872,4480, 880,8576, 888,1408, 896,5504, 904,9600,
+   912,2432, 920,6528, 928,10624, 936,3456, 944,7552, 952,11648, 960,10816, 968,4736,
+   976,8832, 984,1664, 992,5760, 1000,9856, 1008,2688, 1016,6784, 1024,10880, 1032,3712,
+   1040,7808, 1048,11904, 1056,5504, 1064,4992, 1072,9088, 1080,1920, 1088,6016, 1096,10112,
+   1104,2944, 1112,7040, 1120,11136, 1128,3968, 1136,8064, 1144,12160, 1152,5440, 1160,4288,
+   1168,8384, 1176,1216, 1184,5312, 1192,9408, 1200,2240, 1208,6336, 1216,10432, 1224,3264,
+   1232,7360, 1240,11456, 1248,10304, 1256,4544, 1264,8640, 1272,1472, 1280,5568, 1288,9664,
+   1296,2496, 1304,6592, 1312,10688, 1320,3520, 1328,7616, 1336,11712, 1344,5952, 1352,4800,
+   1360,8896, 1368,1728, 1376,5824, 1384,9920, 1392,2752, 1400,6848, 1408,10944, 1416,3776,
+   1424,7872, 1432,11968, 1440,10816, 1448,5056, 1456,9152, 1464,1984, 1472,6080, 1480,10176,
+   1488,3008, 1496,7104, 1504,11200, 1512,4032, 1520,8128, 1528,12224, 1536,8192, 1544,4112,
+   1552,8208, 1560,7808, 1568,5136, 1576,9232, 1584,2064, 1592,6160, 1600,10256, 1608,3088,
+   1616,7184, 1624,11280, 1632,7680, 1640,4368, 1648,8464, 1656,2496, 1664,5392, 1672,9488,
+   1680,2320, 1688,6416, 1696,10512, 1704,3344, 1712,7440, 1720,11536, 1728,2368, 1736,4624,
+   1744,8720, 1752,8208, 1760,5648, 1768,9744, 1776,2576, 1784,6672, 1792,10768, 1800,3600,
+   1808,7696, 1816,11792, 1824,8320, 1832,4880, 1840,8976, 1848,7696, 1856,5904, 1864,10000,
+   1872,2832, 1880,6928, 1888,11024, 1896,3856, 1904,7952, 1912,12048, 1920,7168, 1928,4176,
+   1936,8272, 1944,2944, 1952,5200, 1960,9296, 1968,2128, 1976,6224, 1984,10320, 1992,3152,
+   2000,7248, 2008,11344, 2016,2816, 2024,4432, 2032,8528, 2040,8896, 2048,5456, 2056,9552,
+   2064,2384, 2072,6480, 2080,10576, 2088,3408, 2096,7504, 2104,11600, 2112,8768, 2120,4688,
+   2128,8784, 2136,7184, 2144,5712, 2152,9808, 2160,2640, 2168,6736, 2176,10832, 2184,3664,
+   2192,7760, 2200,11856, 2208,7296, 2216,4944, 2224,9040, 2232,2832, 2240,5968, 2248,10064,
+   2256,2896, 2264,6992, 2272,11088, 2280,3920, 2288,8016, 2296,12112, 2312,4240, 2320,8336,
+   2328,8384, 2336,5264, 2344,9360, 2352,7760, 2360,6288, 2368,10384, 2376,3216, 2384,7312,
+   2392,11408, 2400,8256, 2408,4496, 2416,8592, 2424,7872, 2432,5520, 2440,9616, 2456,6544,
+   2464,10640, 2472,3472, 2480,7568, 2488,11664, 2496,7744, 2504,4752, 2512,8848, 2520,8336,
+   2528,5776, 2536,9872, 2544,2704, 2552,6800, 2560,10896, 2568,3728, 2576,7824, 2584,11920,
+   2592,5520, 2600,5008, 2608,9104, 2616,8272, 2624,6032, 2632,10128, 2640,2960, 2648,7056,
+   2656,11152, 2664,3984, 2672,8080, 2680,12176, 2688,8704, 2696,4304, 2704,8400, 2712,7360,
+   2720,5328, 2728,9424, 2736,2896, 2744,6352, 2752,10448, 2760,3280, 2768,7376, 2776,11472,
+   2784,7232, 2792,4560, 2800,8656, 2808,3008, 2816,5584, 2824,9680, 2832,8848, 2840,6608,
+   2848,10704, 2856,3536, 2864,7632, 2872,11728, 2888,4816, 2896,8912, 2904,8720, 2912,5840,
+   2920,9936, 2928,7376, 2936,6864, 2944,10960, 2952,3792, 2960,7888, 2968,11984, 2976,8832,
+   2984,5072, 2992,9168, 3000,7248, 3008,6096, 3016,10192, 3032,7120, 3040,11216, 3048,4048,
+   3056,8144, 3064,12240, 3072,5120, 3080,4128, 3088,8224, 3096,5504, 3104,5152, 3112,9248,
+   3120,10576, 3128,6176, 3136,10272, 3144,5152, 3152,7200, 3160,11296, 3168,5376, 3176,4384,
+   3184,8480, 3192,10688, 3200,5408, 3208,9504, 3216,5264, 3224,6432, 3232,10528, 3240,3360,
+   3248,7456, 3256,11552, 3264,10560, 3272,4640, 3280,8736, 3288,5136, 3296,5664, 3304,9760,
+   3312,5520, 3320,6688, 3328,10784, 3336,3616, 3344,7712, 3352,11808, 3360,5248, 3368,4896,
+   3376,8992, 3384,8320, 3392,5920, 3400,10016, 3408,10704, 3416,6944, 3424,11040, 3432,3872,
+   3440,7968, 3448,12064, 3456,10752, 3464,4192, 3472,8288, 3480,11136, 3488,5216, 3496,9312,
+   3504,5712, 3512,6240, 3520,10336, 3528,5376, 3536,7264, 3544,11360, 3552,11008, 3560,4448,
+   3568,8544, 3576,5824, 3584,5472, 3592,9568, 3600,8256, 3608,6496, 3616,10592, 3624,11040,
+   3632,7520, 3640,11616, 3648,5696, 3656,4704, 3664,8800, 3672,7680, 3680,5728, 3688,9824,
+   3696,11152, 3704,6752, 3712,10848, 3720,5728, 3728,7776, 3736,11872, 3744,10240, 3752,4960,
+   3760,9056, 3768,11024, 3776,5984, 3784,10080, 3792,5840, 3800,7008, 3808,11104, 3816,3936,
+   3824,8032, 3832,12128, 3840,10496, 3848,4256, 3856,8352, 3864,5312, 3872,5280, 3880,9376,
+   3888,7296, 3896,6304, 3904,10400, 3912,10528, 3920,7328, 3928,11424, 3936,5184, 3944,4512,
+   3952,8608, 3960,10816, 3968,5536, 3976,9632, 3984,10640, 3992,6560, 4000,10656, 4008,5216,
+   4016,7584, 4024,11680, 4032,10368, 4040,4768, 4048,8864, 4056,10512, 4064,5792, 4072,9888,
+   4080,5328, 4088,6816, 4096,10912, 4104,10240, 4112,7840, 4120,11936, 4128,10624, 4136,5024,
+   4144,9120, 4152,5200, 4160,6048, 4168,10144, 4176,8832, 4184,7072, 4192,11168, 4200,10656,
+   4208,8096, 4216,12192, 4224,5632, 4232,4320, 4240,8416, 4248,10304, 4256,5344, 4264,9440,
+   4272,11088, 4280,6368, 4288,10464, 4296,5664, 4304,7392, 4312,11488, 4320,5888, 4328,4576,
+   4336,8672, 4344,11200, 4352,5600, 4360,9696, 4368,5776, 4376,6624, 4384,10720, 4392,11008,
+   4400,7648, 4408,11744, 4416,11072, 4424,4832, 4432,8928, 4440,5648, 4448,5856, 4456,9952,
+   4464,7232, 4472,6880, 4480,10976, 4488,11104, 4496,7904, 4504,12000, 4512,5760, 4520,5088,
+   4528,9184, 4536,5584, 4544,6112, 4552,10208, 4560,11216, 4568,7136, 4576,11232, 4584,5792,
+   4592,8160, 4600,12256, 4608,5456, 4616,9120, 4624,8240, 4632,9088, 4640,5168, 4648,9264,
+   4656,7504, 4664,6192, 4672,10288, 4680,10576, 4688,7216, 4696,11312, 4704,8960, 4712,7648,
+   4720,8496, 4728,7616, 4736,5424, 4744,9520, 4752,7760, 4760,6448, 4768,10544, 4776,8992,
+   4784,7472, 4792,11568, 4800,7488, 4808,7504, 4816,8752, 4824,7312, 4832,5680, 4840,9776,
+   4848,9104, 4856,6704, 4864,10800, 4872,7520, 4880,7728, 4888,11824, 4896,10832, 4904,4912,
+   4912,9008, 4920,8976, 4928,5936, 4936,10032, 4944,7632, 4952,6960, 4960,11056, 4968,7296,
+   4976,7984, 4984,12080, 4992,8448, 5000,8096, 5008,8304, 5016,8064, 5024,5232, 5032,9328,
+   5040,7888, 5048,6256, 5056,10352, 5064,8480, 5072,7280, 5080,11376, 5088,7936, 5096,7232,
+   5104,8560, 5112,10448, 5120,5488, 5128,9584, 5136,8592, 5144,6512, 5152,10608, 5160,7968,
+   5168,7536, 5176,11632, 5184,6032, 5192,8496, 5200,8816, 5208,8464, 5216,5744, 5224,9840,
+   5232,8080, 5240,6768, 5248,10864, 5256,11152, 5264,7792, 5272,11888, 5280,8576, 5288,7984,
+   5296,9072, 5304,7952, 5312,6000, 5320,10096, 5328,7376, 5336,7024, 5344,11120, 5352,8608,
+   5360,8048, 5368,12144, 5376,7424, 5384,11088, 5392,8368, 5400,5968, 5408,9072, 5416,9392,
+   5424,9040, 5432,6320, 5440,10416, 5448,7456, 5456,7344, 5464,11440, 5472,8768, 5480,9184,
+   5488,8624, 5496,9152, 5504,5552, 5512,9648, 5520,7568, 5528,6576, 5536,10672, 5544,5712,
+   5552,7600, 5560,11696, 5568,9024, 5576,7472, 5584,8880, 5592,7440, 5600,5808, 5608,9904,
+   5616,8912, 5624,6832, 5632,10928, 5640,9056, 5648,7856, 5656,11952, 5664,7552, 5672,7888,
+   5680,9136, 5688,8784, 5696,6064, 5704,10160, 5712,9168, 5720,7088, 5728,11184, 5736,7584,
+   5744,8112, 5752,12208, 5760,10896, 5768,8672, 5776,8432, 5784,8640, 5792,8048, 5800,9456,
+   5808,8016, 5816,6384, 5824,10480, 5832,7568, 5840,7408, 5848,11504, 5856,8512, 5864,8160,
+   5872,8688, 5880,8128, 5888,8912, 5896,9712, 5904,8400, 5912,6640, 5920,10736, 5928,8544,
+   5936,7664, 5944,11760, 5952,8000, 5960,9104, 5968,8944, 5976,7824, 5984,8688, 5992,9968,
+   6000,8656, 6008,6896, 6016,10992, 6024,8032, 6032,7920, 6040,12016, 6048,8704, 6056,8560,
+   6064,9200, 6072,8528, 6080,6128, 6088,10224, 6096,8144, 6104,7152, 6112,11248, 6120,7376,
+   6128,8176, 6136,12272, 6144,10912, 6152,10240, 6160,8200, 6168,10848, 6176,9584, 6184,9224,
+   6192,9552, 6200,10240, 6208,10248, 6216,10624, 6224,7176, 6232,11272, 6240,8768, 6248,9696,
+   6256,8456, 6264,9664, 6272,11088, 6280,9480, 6288,8416, 6296,6408, 6304,10504, 6312,10592,
+   6320,7432, 6328,11528, 6336,9536, 6344,9120, 6352,8712, 6360,7840, 6368,9056, 6376,9736,
+   6384,7776, 6392,6664, 6400,10760, 6408,9568, 6416,7688, 6424,11784, 6432,10928, 6440,7520,
+   6448,8968, 6456,8256, 6464,9712, 6472,9992, 6480,9680, 6488,6920, 6496,11016, 6504,11120,
+   6512,7944, 6520,12040, 6528,8624, 6536,10144, 6544,8264, 6552,10112, 6560,8496, 6568,9288,
+   6576,7216, 6584,10624, 6592,10312, 6600,10608, 6608,7240, 6616,11336, 6624,9984, 6632,9136,
+   6640,8520, 6648,7488, 6656,7456, 6664,9544, 6672,7792, 6680,9992, 6688,10568, 6696,10016,
+   6704,7496, 6712,11592, 6720,10288, 6728,10576, 6736,8776, 6744,8224, 6752,10160, 6760,9800,
+   6768,10128, 6776,10576, 6784,10824, 6792,8960, 6800,7752, 6808,11848, 6816,9072, 6824,10032,
+   6832,9032, 6840,10000, 6848,9104, 6856,10056, 6864,8752, 6872,6984, 6880,11080, 6888,10528,
+   6896,8008, 6904,12104, 6912,9472, 6920,8912, 6928,8328, 6936,10464, 6944,11152, 6952,9352,
+   6960,8800, 6968,9480, 6976,10376, 6984,9504, 6992,7304, 7000,11400, 7008,8704, 7016,11104,
+   7024,8584, 7032,8688, 7040,9648, 7048,9608, 7056,9616, 7064,10144, 7072,10632, 7080,11168,
+   7088,7560, 7096,11656, 7104,9200, 7112,9520, 7120,8840, 7128,9488, 7136,8672, 7144,9864,
+   7152,7392, 7160,8960, 7168,10888, 7176,11184, 7184,7816, 7192,11912, 7200,9600, 7208,8096,
+   7216,9096, 7224,8832, 7232,8032, 7240,10120, 7248,7408, 7256,9608, 7264,11144, 7272,9632,
+   7280,8072, 7288,12168, 7296,7344, 7304,7552, 7312,8392, 7320,10560, 7328,10096, 7336,9416,
+   7344,10064, 7352,9120, 7360,10440, 7368,7536, 7376,7536, 7384,11464, 7392,10272, 7400,10208,
+   7408,8648, 7416,10176, 7424,7472, 7432,9672, 7440,7760, 7448,10608, 7456,10696, 7464,7472,
+   7472,7624, 7480,11720, 7488,10048, 7496,7504, 7504,8904, 7512,8240, 7520,7568, 7528,9928,
+   7536,8736, 7544,10056, 7552,10952, 7560,10080, 7568,7880, 7576,11976, 7584,9040, 7592,8480,
+   7600,9160, 7608,9600, 7616,10224, 7624,10184, 7632,10192, 7640,9520, 7648,11208, 7656,10544,
+   7664,8136, 7672,12232, 7680,10880, 7688,11936, 7696,8216, 7704,11904, 7712,7944, 7720,9240,
+   7728,9680, 7736,10848, 7744,10264, 7752,9160, 7760,11912, 7768,11288, 7776,11776, 7784,9984,
+   7792,8472, 7800,10312, 7808,8944, 7816,9496, 7824,8384, 7832,11784, 7840,10520, 7848,11808,
+   7856,10608, 7864,11544, 7872,9712, 7880,9088, 7888,8728, 7896,8944, 7904,11952, 7912,9752,
+   7920,11920, 7928,9992, 7936,10776, 7944,11016, 7952,11904, 7960,11800, 7968,10416, 7976,11824,
+   7984,8984, 7992,11792, 8000,8520, 8008,10008, 8016,10120, 8024,10464, 8032,11032, 8040,8656,
+   8048,11800, 8056,12056, 8064,11264, 8072,10632, 8080,8280, 8088,9648, 8096,8464, 8104,9304,
+   8112,9496, 8120,11272, 8128,10328, 8136,11296, 8144,9608, 8152,11352, 8160,9472, 8168,10608,
+   8176,8536, 8184,10384, 8192,11440, 8200,9560, 8208,11408, 8216,8912, 8224,10584, 8232,11152,
+   8248,11608, 8256,10256, 8264,11312, 8272,8792, 8280,11280, 8288,10080, 8296,9816, 8304,9616,
+   8312,10584, 8320,10840, 8328,10880, 8336,11288, 8344,11864, 8352,11392, 8360,8800, 8368,9048,
+   8376,10880, 8392,10072, 8400,8720, 8408,11400, 8416,11096, 8424,11424, 8432,10464, 8440,12120,
+   8448,10760, 8456,10304, 8464,11864, 8472,10432, 8480,11888, 8488,9368, 8496,11856, 8504,9568,
+   8512,10392, 8520,10928, 8528,10560, 8536,11416, 8544,10992, 8552,12000, 8560,8600, 8568,11968,
+   8576,9096, 8584,9624, 8592,11312, 8600,10112, 8608,10648, 8616,11136, 8624,11976, 8632,11672,
+   8640,11840, 8648,8968, 8656,8856, 8664,11936, 8672,11840, 8680,9880, 8688,10440, 8696,11848,
+   8704,10904, 8712,11872, 8720,11784, 8728,11928, 8736,11976, 8744,11264, 8752,9112, 8760,10960,
+   8768,12016, 8776,10136, 8784,11984, 8792,10144, 8800,11160, 8808,11856, 8816,9648, 8824,12184,
+   8832,11440, 8840,11488, 8848,11400, 8856,11456, 8864,9624, 8872,9432, 8880,10952, 8888,10520,
+   8896,10456, 8904,11312, 8912,11464, 8920,11480, 8928,11328, 8936,11840, 8944,11936, 8952,9200,
+   8960,11912, 8968,9688, 8976,11288, 8984,11336, 8992,10712, 9000,11360, 9008,9520, 9016,11736,
+   9024,10376, 9032,10072, 9040,11480, 9048,11408, 9056,11504, 9064,9944, 9072,11472, 9080,9504,
+   9088,10968, 9096,10904, 9104,11936, 9112,11992, 9120,11408, 9128,11376, 9136,9176, 9144,11344,
+   9152,10272, 9160,10200, 9168,11488, 9176,9488, 9184,11224, 9192,10512, 9200,11352, 9208,12248,
+   9224,11280, 9232,11152, 9240,10760, 9248,10416, 9264,10704, 9272,11280, 9280,10280, 9288,10416,
+   9296,11864, 9304,11304, 9312,10800, 9320,11008, 9328,9368, 9336,10336, 9344,9392, 9352,9512,
+   9368,10968, 9376,10536, 9384,10832, 9392,10184, 9400,11560, 9408,10736, 9416,10704, 9424,11264,
+   9432,11152, 9440,11928, 9448,9768, 9456,9616, 9464,10016, 9472,10792, 9480,11040, 9488,10760,
+   9496,11816, 9504,10184, 9512,9520, 0,0, 9520,11360, 9528,9680, 9536,10992, 9544,10024,
+   9552,11144, 9560,11360, 9568,11048, 9576,10536, 9584,11824, 9592,12072, 9600,10120, 9608,10656,
+   9616,9816, 9624,10672, 9632,9840, 9640,11008, 9648,9808, 9656,9696, 9664,10344, 9672,10720,
+   9680,9840, 9688,11368, 9696,10496, 9704,9952, 9712,12000, 9720,9920, 9728,11224, 9736,10536,
+   9744,11952, 9752,11120, 9760,10600, 9768,10904, 9776,9928, 9784,11624, 9800,11208, 9808,11856,
+   9816,10464, 9824,11480, 9840,10640, 9848,11208, 9856,10856, 9864,11480, 9872,9984, 9880,11880,
+   9888,10976, 9896,10064, 9904,9944, 9912,11392, 9920,9968, 9928,10088, 9944,11104, 9952,11112,
+   9960,10896, 9968,11456, 9976,12136, 9984,10784, 9992,11928, 10000,11160, 10008,10736, 10016,11336,
+   10024,10832, 10032,10192, 10040,10592, 10048,10408, 10056,10864, 10064,10704, 10072,11432, 10080,10280,
+   10088,10776, 10096,11136, 10104,10352, 10112,11488, 10120,11008, 10128,10280, 10136,10416, 10144,10664,
+   10152,10800, 10160,11888, 10168,11688, 10176,11296, 10184,10712, 10192,11152, 10200,11016, 10208,10464,
+   10216,10704, 10224,11264, 10232,11152, 10240,10920, 10248,11056, 10256,11808, 10264,11944, 10272,10752,
+   10280,10968, 10288,11376, 10296,11864, 10304,11488, 10312,10800, 10320,10632, 10328,11168, 10336,11176,
+   10344,11816, 10352,11304, 10360,12200, 10368,11224, 10376,11232, 10384,11424, 10392,11248, 10400,10648,
+   10408,10904, 10416,11136, 10424,10536, 10432,10472, 10440,10600, 10448,10464, 10456,11496, 10464,11072,
+   10472,11800, 10480,11880, 10488,11224, 10496,11104, 10504,11112, 10512,10784, 10520,10760, 10528,10728,
+   10536,11248, 10552,11752, 10560,10648, 10568,10776, 10576,11840, 10584,11952, 10592,10792, 10600,10896,
+   10608,11216, 10616,10728, 10624,10984, 10632,11920, 10640,11120, 10648,12008, 10656,10856, 10664,11032,
+   10672,10784, 10680,11328, 10688,11976, 10696,10704, 10704,10784, 10712,11480, 10720,11240, 10728,10976,
+   10736,11216, 10744,12264, 10752,10912, 10760,11856, 10768,11608, 10776,10888, 10784,11632, 10792,11280,
+   10800,11600, 10808,10920, 10816,11864, 10824,11824, 10832,11440, 10840,11320, 10848,11608, 10856,11744,
+   10864,11048, 10872,11712, 10880,11240, 10888,11120, 10896,11096, 10904,11808, 10912,11752, 10920,11320,
+   10928,11720, 10936,11576, 10944,11584, 10952,11144, 10968,11360, 10976,11984, 10984,11624, 10992,11032,
+   11000,11592, 11008,11320, 11016,11616, 11024,11608, 11032,11832, 11040,11088, 11048,11288, 11056,11736,
+   11064,11464, 11072,11760, 11080,11280, 11088,11728, 11096,11728, 11104,11464, 11120,11792, 11128,12088,
+   11136,11232, 11144,12192, 11152,11952, 11160,12160, 11168,11360, 11184,11232, 11192,11816, 11200,12200,
+   11208,11976, 11216,12168, 11224,11384, 11232,12032, 11240,11280, 11248,11968, 11256,11936, 11264,11752,
+   11272,12072, 11280,12000, 11288,12040, 11296,11984, 11304,12064, 11312,12040, 11320,11640, 11328,11376,
+   11336,11752, 11344,12184, 11352,11944, 11360,12208, 11368,11976, 11376,12176, 11384,11840, 11392,11712,
+   11400,11888, 11408,11600, 11416,11896, 11424,11584, 11432,12080, 11440,11480, 11448,12048, 11456,12168,
+   11464,12064, 11472,11992, 11480,11728, 11488,12088, 11496,11864, 11504,12056, 11512,12152, 11528,12056,
+   11536,12000, 11544,11832, 11552,11904, 11568,11888, 11576,12056, 11584,11968, 11592,11904, 11608,12048,
+   11616,11736, 11624,12192, 11632,11672, 11640,11920, 11648,11696, 11656,12064, 11672,12192, 11680,12176,
+   11688,12016, 11696,11920, 11712,11784, 11720,11888, 11728,11856, 11736,12000, 11744,11776, 11752,11784,
+   11760,11872, 11768,12160, 11776,12056, 11784,12048, 11792,11832, 11800,11960, 11808,11920, 11816,12088,
+   11824,12184, 11832,12032, 11840,12008, 11848,12016, 11856,11976, 11864,12064, 11872,12088, 11880,12176,
+   11888,12072, 11896,12216, 11904,12192, 11912,12200, 11920,12120, 11928,12216, 11936,12144, 11944,12048,
+   11952,12112, 11960,11976, 11968,12008, 11976,12032, 11992,12152, 12000,12072, 12008,12256, 12024,12224,
+   12032,12080, 12040,12168, 12048,12072, 12056,12120, 12064,12264, 12072,12176, 12080,12232, 12088,12160,
+   12104,12168, 12112,12176, 12120,12232, 12128,12208, 12144,12232, 12152,12168, 12160,12192, 12168,12208,
+   12176,12216, 12184,12224, 12192,12224, 0,0, 12200,12224, 12208,12248, 12216,12264, 12224,12272,
+   12232,12264, 12248,12272, 12256,12264, 0,0, 12264,12272, 0,0
+};
+#endif
 
 
-const uint16_t armBitRevIndexTable_fixed_16[ARMBITREVINDEXTABLE_FIXED___16_TABLE_LENGTH] = 
+#if defined(ARM_TABLE_BITREV_FIXED_16)
+const uint16_t armBitRevIndexTable_fixed_16[ARMBITREVINDEXTABLE_FIXED___16_TABLE_LENGTH] ARM_DSP_TABLE_ATTR = 
 {
    //radix 4, size 12
    8,64, 16,32, 24,96, 40,80, 56,112, 88,104
 };
+#endif
 
-const uint16_t armBitRevIndexTable_fixed_32[ARMBITREVINDEXTABLE_FIXED___32_TABLE_LENGTH] = 
+#if defined(ARM_TABLE_BITREV_FIXED_32)
+const uint16_t armBitRevIndexTable_fixed_32[ARMBITREVINDEXTABLE_FIXED___32_TABLE_LENGTH] ARM_DSP_TABLE_ATTR = 
 {
    //4x2, size 24
    8,128, 16,64, 24,192, 40,160, 48,96, 56,224, 72,144,
    88,208, 104,176, 120,240, 152,200, 184,232
 };
+#endif
 
-const uint16_t armBitRevIndexTable_fixed_64[ARMBITREVINDEXTABLE_FIXED___64_TABLE_LENGTH] = 
+#if defined(ARM_TABLE_BITREV_FIXED_64)
+const uint16_t armBitRevIndexTable_fixed_64[ARMBITREVINDEXTABLE_FIXED___64_TABLE_LENGTH] ARM_DSP_TABLE_ATTR = 
 {   
    //radix 4, size 56
    8,256, 16,128, 24,384, 32,64, 40,320, 48,192, 56,448, 72,288, 80,160, 88,416, 104,352,
    112,224, 120,480, 136,272, 152,400, 168,336, 176,208, 184,464, 200,304, 216,432,
    232,368, 248,496, 280,392, 296,328, 312,456, 344,424, 376,488, 440,472
 };
+#endif
 
-const uint16_t armBitRevIndexTable_fixed_128[ARMBITREVINDEXTABLE_FIXED__128_TABLE_LENGTH] = 
+#if defined(ARM_TABLE_BITREV_FIXED_128)
+const uint16_t armBitRevIndexTable_fixed_128[ARMBITREVINDEXTABLE_FIXED__128_TABLE_LENGTH] ARM_DSP_TABLE_ATTR = 
 {
    //4x2, size 112
    8,512, 16,256, 24,768, 32,128, 40,640, 48,384, 56,896, 72,576, 80,320, 88,832, 96,192,
@@ -22237,8 +28779,10 @@ const uint16_t armBitRevIndexTable_fixed_128[ARMBITREVINDEXTABLE_FIXED__128_TABL
    472,880, 488,752, 504,1008, 536,776, 552,648, 568,904, 600,840, 616,712, 632,968,
    664,808, 696,936, 728,872, 760,1000, 824,920, 888,984
 };
+#endif
 
-const uint16_t armBitRevIndexTable_fixed_256[ARMBITREVINDEXTABLE_FIXED__256_TABLE_LENGTH] = 
+#if defined(ARM_TABLE_BITREV_FIXED_256)
+const uint16_t armBitRevIndexTable_fixed_256[ARMBITREVINDEXTABLE_FIXED__256_TABLE_LENGTH] ARM_DSP_TABLE_ATTR = 
 {
    //radix 4, size 240
    8,1024, 16,512, 24,1536, 32,256, 40,1280, 48,768, 56,1792, 64,128, 72,1152, 80,640,
@@ -22256,8 +28800,10 @@ const uint16_t armBitRevIndexTable_fixed_256[ARMBITREVINDEXTABLE_FIXED__256_TABL
    1368,1704, 1384,1448, 1400,1960, 1432,1640, 1464,1896, 1496,1768, 1528,2024, 1592,1816,
    1624,1688, 1656,1944, 1720,1880, 1784,2008, 1912,1976
 };
+#endif
 
-const uint16_t armBitRevIndexTable_fixed_512[ARMBITREVINDEXTABLE_FIXED__512_TABLE_LENGTH] = 
+#if defined(ARM_TABLE_BITREV_FIXED_512)
+const uint16_t armBitRevIndexTable_fixed_512[ARMBITREVINDEXTABLE_FIXED__512_TABLE_LENGTH] ARM_DSP_TABLE_ATTR = 
 {
    //4x2, size 480
    8,2048, 16,1024, 24,3072, 32,512, 40,2560, 48,1536, 56,3584, 64,256, 72,2304, 80,1280,
@@ -22290,8 +28836,10 @@ const uint16_t armBitRevIndexTable_fixed_512[ARMBITREVINDEXTABLE_FIXED__512_TABL
    3128,3608, 3160,3352, 3192,3864, 3256,3736, 3288,3480, 3320,3992, 3384,3672, 3448,3928,
    3512,3800, 3576,4056, 3704,3896, 3832,4024
 };
+#endif
 
-const uint16_t armBitRevIndexTable_fixed_1024[ARMBITREVINDEXTABLE_FIXED_1024_TABLE_LENGTH] = 
+#if defined(ARM_TABLE_BITREV_FIXED_1024)
+const uint16_t armBitRevIndexTable_fixed_1024[ARMBITREVINDEXTABLE_FIXED_1024_TABLE_LENGTH] ARM_DSP_TABLE_ATTR = 
 {
     //radix 4, size 992
     8,4096, 16,2048, 24,6144, 32,1024, 40,5120, 48,3072, 56,7168, 64,512, 72,4608, 
@@ -22364,8 +28912,10 @@ const uint16_t armBitRevIndexTable_fixed_1024[ARMBITREVINDEXTABLE_FIXED_1024_TAB
     6872,7000, 6904,8024, 6968,7384, 7032,7896, 7096,7640, 7160,8152, 7288,7736, 
     7352,7480, 7416,7992, 7544,7864, 7672,8120, 7928,8056 
 };
+#endif
 
-const uint16_t armBitRevIndexTable_fixed_2048[ARMBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH] = 
+#if defined(ARM_TABLE_BITREV_FIXED_2048)
+const uint16_t armBitRevIndexTable_fixed_2048[ARMBITREVINDEXTABLE_FIXED_2048_TABLE_LENGTH] ARM_DSP_TABLE_ATTR = 
 {
     //4x2, size 1984
     8,8192, 16,4096, 24,12288, 32,2048, 40,10240, 48,6144, 56,14336, 64,1024, 
@@ -22520,8 +29070,10 @@ const uint16_t armBitRevIndexTable_fixed_2048[ARMBITREVINDEXTABLE_FIXED_2048_TAB
     14456,15416, 14520,14904, 14584,15928, 14712,15672, 14776,15160, 14840,16184, 
     14968,15544, 15096,16056, 15224,15800, 15352,16312, 15608,15992, 15864,16248 
 };
+#endif
 
-const uint16_t armBitRevIndexTable_fixed_4096[ARMBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH] = 
+#if defined(ARM_TABLE_BITREV_FIXED_4096)
+const uint16_t armBitRevIndexTable_fixed_4096[ARMBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH] ARM_DSP_TABLE_ATTR = 
 {
     //radix 4, size 4032
     8,16384, 16,8192, 24,24576, 32,4096, 40,20480, 48,12288, 56,28672, 64,2048, 
@@ -22858,6 +29410,7 @@ const uint16_t armBitRevIndexTable_fixed_4096[ARMBITREVINDEXTABLE_FIXED_4096_TAB
     30456,32184, 30584,31672, 30712,32696, 30968,31864, 31096,31352, 31224,32376, 
     31480,32120, 31736,32632, 32248,32504 
 };
+#endif
 
 /**    
 * \par    
@@ -22867,7 +29420,8 @@ const uint16_t armBitRevIndexTable_fixed_4096[ARMBITREVINDEXTABLE_FIXED_4096_TAB
 * \par    
 * Real and Imag values are in interleaved fashion    
 */
-const float32_t twiddleCoef_rfft_32[32] = {
+#if defined(ARM_TABLE_RFFT_F32_32)
+const float32_t twiddleCoef_rfft_32[32] ARM_DSP_TABLE_ATTR = {
 0.0f			,	1.0f			,
 0.195090322f	,	0.98078528f 	,
 0.382683432f	,	0.923879533f	,
@@ -22885,8 +29439,10 @@ const float32_t twiddleCoef_rfft_32[32] = {
 0.382683432f	,	-0.923879533f	,
 0.195090322f	,	-0.98078528f	
 };
+#endif
 
-const float32_t twiddleCoef_rfft_64[64] = {
+#if defined(ARM_TABLE_RFFT_F32_64)
+const float32_t twiddleCoef_rfft_64[64] ARM_DSP_TABLE_ATTR = {
 0.0f,	1.0f,
 0.098017140329561f,	0.995184726672197f,
 0.195090322016128f,	0.98078528040323f,
@@ -22920,4056 +29476,5952 @@ const float32_t twiddleCoef_rfft_64[64] = {
 0.195090322016129f,	-0.98078528040323f,
 0.098017140329561f,	-0.995184726672197f
 };
+#endif
+
+#if defined(ARM_TABLE_RFFT_F32_128)
+const float32_t twiddleCoef_rfft_128[128] ARM_DSP_TABLE_ATTR = {
+    0.000000000f,  1.000000000f,
+    0.049067674f,  0.998795456f,
+    0.098017140f,  0.995184727f,
+    0.146730474f,  0.989176510f,
+    0.195090322f,  0.980785280f,
+    0.242980180f,  0.970031253f,
+    0.290284677f,  0.956940336f,
+    0.336889853f,  0.941544065f,
+    0.382683432f,  0.923879533f,
+    0.427555093f,  0.903989293f,
+    0.471396737f,  0.881921264f,
+    0.514102744f,  0.857728610f,
+    0.555570233f,  0.831469612f,
+    0.595699304f,  0.803207531f,
+    0.634393284f,  0.773010453f,
+    0.671558955f,  0.740951125f,
+    0.707106781f,  0.707106781f,
+    0.740951125f,  0.671558955f,
+    0.773010453f,  0.634393284f,
+    0.803207531f,  0.595699304f,
+    0.831469612f,  0.555570233f,
+    0.857728610f,  0.514102744f,
+    0.881921264f,  0.471396737f,
+    0.903989293f,  0.427555093f,
+    0.923879533f,  0.382683432f,
+    0.941544065f,  0.336889853f,
+    0.956940336f,  0.290284677f,
+    0.970031253f,  0.242980180f,
+    0.980785280f,  0.195090322f,
+    0.989176510f,  0.146730474f,
+    0.995184727f,  0.098017140f,
+    0.998795456f,  0.049067674f,
+    1.000000000f,  0.000000000f,
+    0.998795456f, -0.049067674f,
+    0.995184727f, -0.098017140f,
+    0.989176510f, -0.146730474f,
+    0.980785280f, -0.195090322f,
+    0.970031253f, -0.242980180f,
+    0.956940336f, -0.290284677f,
+    0.941544065f, -0.336889853f,
+    0.923879533f, -0.382683432f,
+    0.903989293f, -0.427555093f,
+    0.881921264f, -0.471396737f,
+    0.857728610f, -0.514102744f,
+    0.831469612f, -0.555570233f,
+    0.803207531f, -0.595699304f,
+    0.773010453f, -0.634393284f,
+    0.740951125f, -0.671558955f,
+    0.707106781f, -0.707106781f,
+    0.671558955f, -0.740951125f,
+    0.634393284f, -0.773010453f,
+    0.595699304f, -0.803207531f,
+    0.555570233f, -0.831469612f,
+    0.514102744f, -0.857728610f,
+    0.471396737f, -0.881921264f,
+    0.427555093f, -0.903989293f,
+    0.382683432f, -0.923879533f,
+    0.336889853f, -0.941544065f,
+    0.290284677f, -0.956940336f,
+    0.242980180f, -0.970031253f,
+    0.195090322f, -0.980785280f,
+    0.146730474f, -0.989176510f,
+    0.098017140f, -0.995184727f,
+    0.049067674f, -0.998795456f
+};
+#endif
 
-const float32_t twiddleCoef_rfft_128[128] = {
+#if defined(ARM_TABLE_RFFT_F32_256)
+const float32_t twiddleCoef_rfft_256[256] ARM_DSP_TABLE_ATTR = {
     0.000000000f,  1.000000000f,
+    0.024541229f,  0.999698819f,
     0.049067674f,  0.998795456f,
+    0.073564564f,  0.997290457f,
     0.098017140f,  0.995184727f,
+    0.122410675f,  0.992479535f,
     0.146730474f,  0.989176510f,
+    0.170961889f,  0.985277642f,
     0.195090322f,  0.980785280f,
+    0.219101240f,  0.975702130f,
     0.242980180f,  0.970031253f,
+    0.266712757f,  0.963776066f,
     0.290284677f,  0.956940336f,
+    0.313681740f,  0.949528181f,
     0.336889853f,  0.941544065f,
+    0.359895037f,  0.932992799f,
     0.382683432f,  0.923879533f,
+    0.405241314f,  0.914209756f,
     0.427555093f,  0.903989293f,
+    0.449611330f,  0.893224301f,
     0.471396737f,  0.881921264f,
+    0.492898192f,  0.870086991f,
     0.514102744f,  0.857728610f,
+    0.534997620f,  0.844853565f,
     0.555570233f,  0.831469612f,
+    0.575808191f,  0.817584813f,
     0.595699304f,  0.803207531f,
+    0.615231591f,  0.788346428f,
     0.634393284f,  0.773010453f,
+    0.653172843f,  0.757208847f,
     0.671558955f,  0.740951125f,
+    0.689540545f,  0.724247083f,
     0.707106781f,  0.707106781f,
+    0.724247083f,  0.689540545f,
     0.740951125f,  0.671558955f,
+    0.757208847f,  0.653172843f,
     0.773010453f,  0.634393284f,
+    0.788346428f,  0.615231591f,
     0.803207531f,  0.595699304f,
+    0.817584813f,  0.575808191f,
     0.831469612f,  0.555570233f,
+    0.844853565f,  0.534997620f,
     0.857728610f,  0.514102744f,
+    0.870086991f,  0.492898192f,
     0.881921264f,  0.471396737f,
+    0.893224301f,  0.449611330f,
     0.903989293f,  0.427555093f,
+    0.914209756f,  0.405241314f,
     0.923879533f,  0.382683432f,
+    0.932992799f,  0.359895037f,
     0.941544065f,  0.336889853f,
+    0.949528181f,  0.313681740f,
     0.956940336f,  0.290284677f,
+    0.963776066f,  0.266712757f,
     0.970031253f,  0.242980180f,
+    0.975702130f,  0.219101240f,
     0.980785280f,  0.195090322f,
+    0.985277642f,  0.170961889f,
     0.989176510f,  0.146730474f,
+    0.992479535f,  0.122410675f,
     0.995184727f,  0.098017140f,
+    0.997290457f,  0.073564564f,
     0.998795456f,  0.049067674f,
+    0.999698819f,  0.024541229f,
     1.000000000f,  0.000000000f,
+    0.999698819f, -0.024541229f,
     0.998795456f, -0.049067674f,
+    0.997290457f, -0.073564564f,
     0.995184727f, -0.098017140f,
+    0.992479535f, -0.122410675f,
     0.989176510f, -0.146730474f,
+    0.985277642f, -0.170961889f,
     0.980785280f, -0.195090322f,
+    0.975702130f, -0.219101240f,
     0.970031253f, -0.242980180f,
+    0.963776066f, -0.266712757f,
     0.956940336f, -0.290284677f,
+    0.949528181f, -0.313681740f,
     0.941544065f, -0.336889853f,
+    0.932992799f, -0.359895037f,
     0.923879533f, -0.382683432f,
+    0.914209756f, -0.405241314f,
     0.903989293f, -0.427555093f,
+    0.893224301f, -0.449611330f,
     0.881921264f, -0.471396737f,
+    0.870086991f, -0.492898192f,
     0.857728610f, -0.514102744f,
+    0.844853565f, -0.534997620f,
     0.831469612f, -0.555570233f,
+    0.817584813f, -0.575808191f,
     0.803207531f, -0.595699304f,
+    0.788346428f, -0.615231591f,
     0.773010453f, -0.634393284f,
+    0.757208847f, -0.653172843f,
     0.740951125f, -0.671558955f,
+    0.724247083f, -0.689540545f,
     0.707106781f, -0.707106781f,
+    0.689540545f, -0.724247083f,
     0.671558955f, -0.740951125f,
+    0.653172843f, -0.757208847f,
     0.634393284f, -0.773010453f,
+    0.615231591f, -0.788346428f,
     0.595699304f, -0.803207531f,
+    0.575808191f, -0.817584813f,
     0.555570233f, -0.831469612f,
+    0.534997620f, -0.844853565f,
     0.514102744f, -0.857728610f,
+    0.492898192f, -0.870086991f,
     0.471396737f, -0.881921264f,
+    0.449611330f, -0.893224301f,
     0.427555093f, -0.903989293f,
+    0.405241314f, -0.914209756f,
     0.382683432f, -0.923879533f,
+    0.359895037f, -0.932992799f,
     0.336889853f, -0.941544065f,
+    0.313681740f, -0.949528181f,
     0.290284677f, -0.956940336f,
+    0.266712757f, -0.963776066f,
     0.242980180f, -0.970031253f,
+    0.219101240f, -0.975702130f,
     0.195090322f, -0.980785280f,
+    0.170961889f, -0.985277642f,
     0.146730474f, -0.989176510f,
+    0.122410675f, -0.992479535f,
     0.098017140f, -0.995184727f,
-    0.049067674f, -0.998795456f
+    0.073564564f, -0.997290457f,
+    0.049067674f, -0.998795456f,
+    0.024541229f, -0.999698819f
 };
+#endif
 
-const float32_t twiddleCoef_rfft_256[256] = {
+#if defined(ARM_TABLE_RFFT_F32_512)
+const float32_t twiddleCoef_rfft_512[512] ARM_DSP_TABLE_ATTR = {
     0.000000000f,  1.000000000f,
+    0.012271538f,  0.999924702f,
     0.024541229f,  0.999698819f,
+    0.036807223f,  0.999322385f,
     0.049067674f,  0.998795456f,
+    0.061320736f,  0.998118113f,
     0.073564564f,  0.997290457f,
+    0.085797312f,  0.996312612f,
     0.098017140f,  0.995184727f,
+    0.110222207f,  0.993906970f,
     0.122410675f,  0.992479535f,
+    0.134580709f,  0.990902635f,
     0.146730474f,  0.989176510f,
+    0.158858143f,  0.987301418f,
     0.170961889f,  0.985277642f,
+    0.183039888f,  0.983105487f,
     0.195090322f,  0.980785280f,
+    0.207111376f,  0.978317371f,
     0.219101240f,  0.975702130f,
+    0.231058108f,  0.972939952f,
     0.242980180f,  0.970031253f,
+    0.254865660f,  0.966976471f,
     0.266712757f,  0.963776066f,
+    0.278519689f,  0.960430519f,
     0.290284677f,  0.956940336f,
+    0.302005949f,  0.953306040f,
     0.313681740f,  0.949528181f,
+    0.325310292f,  0.945607325f,
     0.336889853f,  0.941544065f,
+    0.348418680f,  0.937339012f,
     0.359895037f,  0.932992799f,
+    0.371317194f,  0.928506080f,
     0.382683432f,  0.923879533f,
+    0.393992040f,  0.919113852f,
     0.405241314f,  0.914209756f,
+    0.416429560f,  0.909167983f,
     0.427555093f,  0.903989293f,
+    0.438616239f,  0.898674466f,
     0.449611330f,  0.893224301f,
+    0.460538711f,  0.887639620f,
     0.471396737f,  0.881921264f,
+    0.482183772f,  0.876070094f,
     0.492898192f,  0.870086991f,
+    0.503538384f,  0.863972856f,
     0.514102744f,  0.857728610f,
+    0.524589683f,  0.851355193f,
     0.534997620f,  0.844853565f,
+    0.545324988f,  0.838224706f,
     0.555570233f,  0.831469612f,
+    0.565731811f,  0.824589303f,
     0.575808191f,  0.817584813f,
+    0.585797857f,  0.810457198f,
     0.595699304f,  0.803207531f,
+    0.605511041f,  0.795836905f,
     0.615231591f,  0.788346428f,
+    0.624859488f,  0.780737229f,
     0.634393284f,  0.773010453f,
+    0.643831543f,  0.765167266f,
     0.653172843f,  0.757208847f,
+    0.662415778f,  0.749136395f,
     0.671558955f,  0.740951125f,
+    0.680600998f,  0.732654272f,
     0.689540545f,  0.724247083f,
+    0.698376249f,  0.715730825f,
     0.707106781f,  0.707106781f,
+    0.715730825f,  0.698376249f,
     0.724247083f,  0.689540545f,
+    0.732654272f,  0.680600998f,
     0.740951125f,  0.671558955f,
+    0.749136395f,  0.662415778f,
     0.757208847f,  0.653172843f,
+    0.765167266f,  0.643831543f,
     0.773010453f,  0.634393284f,
+    0.780737229f,  0.624859488f,
     0.788346428f,  0.615231591f,
+    0.795836905f,  0.605511041f,
     0.803207531f,  0.595699304f,
+    0.810457198f,  0.585797857f,
     0.817584813f,  0.575808191f,
+    0.824589303f,  0.565731811f,
     0.831469612f,  0.555570233f,
+    0.838224706f,  0.545324988f,
     0.844853565f,  0.534997620f,
+    0.851355193f,  0.524589683f,
     0.857728610f,  0.514102744f,
+    0.863972856f,  0.503538384f,
     0.870086991f,  0.492898192f,
+    0.876070094f,  0.482183772f,
     0.881921264f,  0.471396737f,
+    0.887639620f,  0.460538711f,
     0.893224301f,  0.449611330f,
+    0.898674466f,  0.438616239f,
     0.903989293f,  0.427555093f,
+    0.909167983f,  0.416429560f,
     0.914209756f,  0.405241314f,
+    0.919113852f,  0.393992040f,
     0.923879533f,  0.382683432f,
+    0.928506080f,  0.371317194f,
     0.932992799f,  0.359895037f,
+    0.937339012f,  0.348418680f,
     0.941544065f,  0.336889853f,
+    0.945607325f,  0.325310292f,
     0.949528181f,  0.313681740f,
+    0.953306040f,  0.302005949f,
     0.956940336f,  0.290284677f,
+    0.960430519f,  0.278519689f,
     0.963776066f,  0.266712757f,
+    0.966976471f,  0.254865660f,
     0.970031253f,  0.242980180f,
+    0.972939952f,  0.231058108f,
     0.975702130f,  0.219101240f,
+    0.978317371f,  0.207111376f,
     0.980785280f,  0.195090322f,
+    0.983105487f,  0.183039888f,
     0.985277642f,  0.170961889f,
+    0.987301418f,  0.158858143f,
     0.989176510f,  0.146730474f,
+    0.990902635f,  0.134580709f,
     0.992479535f,  0.122410675f,
+    0.993906970f,  0.110222207f,
     0.995184727f,  0.098017140f,
+    0.996312612f,  0.085797312f,
     0.997290457f,  0.073564564f,
+    0.998118113f,  0.061320736f,
     0.998795456f,  0.049067674f,
+    0.999322385f,  0.036807223f,
     0.999698819f,  0.024541229f,
+    0.999924702f,  0.012271538f,
     1.000000000f,  0.000000000f,
+    0.999924702f, -0.012271538f,
     0.999698819f, -0.024541229f,
+    0.999322385f, -0.036807223f,
     0.998795456f, -0.049067674f,
+    0.998118113f, -0.061320736f,
     0.997290457f, -0.073564564f,
+    0.996312612f, -0.085797312f,
     0.995184727f, -0.098017140f,
+    0.993906970f, -0.110222207f,
     0.992479535f, -0.122410675f,
+    0.990902635f, -0.134580709f,
     0.989176510f, -0.146730474f,
+    0.987301418f, -0.158858143f,
     0.985277642f, -0.170961889f,
+    0.983105487f, -0.183039888f,
     0.980785280f, -0.195090322f,
+    0.978317371f, -0.207111376f,
     0.975702130f, -0.219101240f,
+    0.972939952f, -0.231058108f,
     0.970031253f, -0.242980180f,
+    0.966976471f, -0.254865660f,
     0.963776066f, -0.266712757f,
+    0.960430519f, -0.278519689f,
     0.956940336f, -0.290284677f,
+    0.953306040f, -0.302005949f,
     0.949528181f, -0.313681740f,
+    0.945607325f, -0.325310292f,
     0.941544065f, -0.336889853f,
+    0.937339012f, -0.348418680f,
     0.932992799f, -0.359895037f,
+    0.928506080f, -0.371317194f,
     0.923879533f, -0.382683432f,
+    0.919113852f, -0.393992040f,
     0.914209756f, -0.405241314f,
+    0.909167983f, -0.416429560f,
     0.903989293f, -0.427555093f,
+    0.898674466f, -0.438616239f,
     0.893224301f, -0.449611330f,
+    0.887639620f, -0.460538711f,
     0.881921264f, -0.471396737f,
+    0.876070094f, -0.482183772f,
     0.870086991f, -0.492898192f,
+    0.863972856f, -0.503538384f,
     0.857728610f, -0.514102744f,
+    0.851355193f, -0.524589683f,
     0.844853565f, -0.534997620f,
+    0.838224706f, -0.545324988f,
     0.831469612f, -0.555570233f,
+    0.824589303f, -0.565731811f,
     0.817584813f, -0.575808191f,
+    0.810457198f, -0.585797857f,
     0.803207531f, -0.595699304f,
+    0.795836905f, -0.605511041f,
     0.788346428f, -0.615231591f,
+    0.780737229f, -0.624859488f,
     0.773010453f, -0.634393284f,
+    0.765167266f, -0.643831543f,
     0.757208847f, -0.653172843f,
+    0.749136395f, -0.662415778f,
     0.740951125f, -0.671558955f,
+    0.732654272f, -0.680600998f,
     0.724247083f, -0.689540545f,
+    0.715730825f, -0.698376249f,
     0.707106781f, -0.707106781f,
+    0.698376249f, -0.715730825f,
     0.689540545f, -0.724247083f,
+    0.680600998f, -0.732654272f,
     0.671558955f, -0.740951125f,
+    0.662415778f, -0.749136395f,
     0.653172843f, -0.757208847f,
+    0.643831543f, -0.765167266f,
     0.634393284f, -0.773010453f,
+    0.624859488f, -0.780737229f,
     0.615231591f, -0.788346428f,
+    0.605511041f, -0.795836905f,
     0.595699304f, -0.803207531f,
+    0.585797857f, -0.810457198f,
     0.575808191f, -0.817584813f,
+    0.565731811f, -0.824589303f,
     0.555570233f, -0.831469612f,
+    0.545324988f, -0.838224706f,
     0.534997620f, -0.844853565f,
+    0.524589683f, -0.851355193f,
     0.514102744f, -0.857728610f,
+    0.503538384f, -0.863972856f,
     0.492898192f, -0.870086991f,
+    0.482183772f, -0.876070094f,
     0.471396737f, -0.881921264f,
+    0.460538711f, -0.887639620f,
     0.449611330f, -0.893224301f,
+    0.438616239f, -0.898674466f,
     0.427555093f, -0.903989293f,
+    0.416429560f, -0.909167983f,
     0.405241314f, -0.914209756f,
+    0.393992040f, -0.919113852f,
     0.382683432f, -0.923879533f,
+    0.371317194f, -0.928506080f,
     0.359895037f, -0.932992799f,
+    0.348418680f, -0.937339012f,
     0.336889853f, -0.941544065f,
+    0.325310292f, -0.945607325f,
     0.313681740f, -0.949528181f,
+    0.302005949f, -0.953306040f,
     0.290284677f, -0.956940336f,
+    0.278519689f, -0.960430519f,
     0.266712757f, -0.963776066f,
+    0.254865660f, -0.966976471f,
     0.242980180f, -0.970031253f,
+    0.231058108f, -0.972939952f,
     0.219101240f, -0.975702130f,
+    0.207111376f, -0.978317371f,
     0.195090322f, -0.980785280f,
+    0.183039888f, -0.983105487f,
     0.170961889f, -0.985277642f,
+    0.158858143f, -0.987301418f,
     0.146730474f, -0.989176510f,
+    0.134580709f, -0.990902635f,
     0.122410675f, -0.992479535f,
+    0.110222207f, -0.993906970f,
     0.098017140f, -0.995184727f,
+    0.085797312f, -0.996312612f,
     0.073564564f, -0.997290457f,
+    0.061320736f, -0.998118113f,
     0.049067674f, -0.998795456f,
-    0.024541229f, -0.999698819f
+    0.036807223f, -0.999322385f,
+    0.024541229f, -0.999698819f,
+    0.012271538f, -0.999924702f
 };
+#endif
 
-const float32_t twiddleCoef_rfft_512[512] = {
+#if defined(ARM_TABLE_RFFT_F32_1024)
+const float32_t twiddleCoef_rfft_1024[1024] ARM_DSP_TABLE_ATTR = {
     0.000000000f,  1.000000000f,
+    0.006135885f,  0.999981175f,
     0.012271538f,  0.999924702f,
+    0.018406730f,  0.999830582f,
     0.024541229f,  0.999698819f,
+    0.030674803f,  0.999529418f,
     0.036807223f,  0.999322385f,
+    0.042938257f,  0.999077728f,
     0.049067674f,  0.998795456f,
+    0.055195244f,  0.998475581f,
     0.061320736f,  0.998118113f,
+    0.067443920f,  0.997723067f,
     0.073564564f,  0.997290457f,
+    0.079682438f,  0.996820299f,
     0.085797312f,  0.996312612f,
+    0.091908956f,  0.995767414f,
     0.098017140f,  0.995184727f,
+    0.104121634f,  0.994564571f,
     0.110222207f,  0.993906970f,
+    0.116318631f,  0.993211949f,
     0.122410675f,  0.992479535f,
+    0.128498111f,  0.991709754f,
     0.134580709f,  0.990902635f,
+    0.140658239f,  0.990058210f,
     0.146730474f,  0.989176510f,
+    0.152797185f,  0.988257568f,
     0.158858143f,  0.987301418f,
+    0.164913120f,  0.986308097f,
     0.170961889f,  0.985277642f,
+    0.177004220f,  0.984210092f,
     0.183039888f,  0.983105487f,
+    0.189068664f,  0.981963869f,
     0.195090322f,  0.980785280f,
+    0.201104635f,  0.979569766f,
     0.207111376f,  0.978317371f,
+    0.213110320f,  0.977028143f,
     0.219101240f,  0.975702130f,
+    0.225083911f,  0.974339383f,
     0.231058108f,  0.972939952f,
+    0.237023606f,  0.971503891f,
     0.242980180f,  0.970031253f,
+    0.248927606f,  0.968522094f,
     0.254865660f,  0.966976471f,
+    0.260794118f,  0.965394442f,
     0.266712757f,  0.963776066f,
+    0.272621355f,  0.962121404f,
     0.278519689f,  0.960430519f,
+    0.284407537f,  0.958703475f,
     0.290284677f,  0.956940336f,
+    0.296150888f,  0.955141168f,
     0.302005949f,  0.953306040f,
+    0.307849640f,  0.951435021f,
     0.313681740f,  0.949528181f,
+    0.319502031f,  0.947585591f,
     0.325310292f,  0.945607325f,
+    0.331106306f,  0.943593458f,
     0.336889853f,  0.941544065f,
+    0.342660717f,  0.939459224f,
     0.348418680f,  0.937339012f,
+    0.354163525f,  0.935183510f,
     0.359895037f,  0.932992799f,
+    0.365612998f,  0.930766961f,
     0.371317194f,  0.928506080f,
+    0.377007410f,  0.926210242f,
     0.382683432f,  0.923879533f,
+    0.388345047f,  0.921514039f,
     0.393992040f,  0.919113852f,
+    0.399624200f,  0.916679060f,
     0.405241314f,  0.914209756f,
+    0.410843171f,  0.911706032f,
     0.416429560f,  0.909167983f,
+    0.422000271f,  0.906595705f,
     0.427555093f,  0.903989293f,
+    0.433093819f,  0.901348847f,
     0.438616239f,  0.898674466f,
+    0.444122145f,  0.895966250f,
     0.449611330f,  0.893224301f,
+    0.455083587f,  0.890448723f,
     0.460538711f,  0.887639620f,
+    0.465976496f,  0.884797098f,
     0.471396737f,  0.881921264f,
+    0.476799230f,  0.879012226f,
     0.482183772f,  0.876070094f,
+    0.487550160f,  0.873094978f,
     0.492898192f,  0.870086991f,
+    0.498227667f,  0.867046246f,
     0.503538384f,  0.863972856f,
+    0.508830143f,  0.860866939f,
     0.514102744f,  0.857728610f,
+    0.519355990f,  0.854557988f,
     0.524589683f,  0.851355193f,
+    0.529803625f,  0.848120345f,
     0.534997620f,  0.844853565f,
+    0.540171473f,  0.841554977f,
     0.545324988f,  0.838224706f,
+    0.550457973f,  0.834862875f,
     0.555570233f,  0.831469612f,
+    0.560661576f,  0.828045045f,
     0.565731811f,  0.824589303f,
+    0.570780746f,  0.821102515f,
     0.575808191f,  0.817584813f,
+    0.580813958f,  0.814036330f,
     0.585797857f,  0.810457198f,
+    0.590759702f,  0.806847554f,
     0.595699304f,  0.803207531f,
+    0.600616479f,  0.799537269f,
     0.605511041f,  0.795836905f,
+    0.610382806f,  0.792106577f,
     0.615231591f,  0.788346428f,
+    0.620057212f,  0.784556597f,
     0.624859488f,  0.780737229f,
+    0.629638239f,  0.776888466f,
     0.634393284f,  0.773010453f,
+    0.639124445f,  0.769103338f,
     0.643831543f,  0.765167266f,
+    0.648514401f,  0.761202385f,
     0.653172843f,  0.757208847f,
+    0.657806693f,  0.753186799f,
     0.662415778f,  0.749136395f,
+    0.666999922f,  0.745057785f,
     0.671558955f,  0.740951125f,
+    0.676092704f,  0.736816569f,
     0.680600998f,  0.732654272f,
+    0.685083668f,  0.728464390f,
     0.689540545f,  0.724247083f,
+    0.693971461f,  0.720002508f,
     0.698376249f,  0.715730825f,
+    0.702754744f,  0.711432196f,
     0.707106781f,  0.707106781f,
+    0.711432196f,  0.702754744f,
     0.715730825f,  0.698376249f,
+    0.720002508f,  0.693971461f,
     0.724247083f,  0.689540545f,
+    0.728464390f,  0.685083668f,
     0.732654272f,  0.680600998f,
+    0.736816569f,  0.676092704f,
     0.740951125f,  0.671558955f,
+    0.745057785f,  0.666999922f,
     0.749136395f,  0.662415778f,
+    0.753186799f,  0.657806693f,
     0.757208847f,  0.653172843f,
+    0.761202385f,  0.648514401f,
     0.765167266f,  0.643831543f,
+    0.769103338f,  0.639124445f,
     0.773010453f,  0.634393284f,
+    0.776888466f,  0.629638239f,
     0.780737229f,  0.624859488f,
+    0.784556597f,  0.620057212f,
     0.788346428f,  0.615231591f,
+    0.792106577f,  0.610382806f,
     0.795836905f,  0.605511041f,
+    0.799537269f,  0.600616479f,
     0.803207531f,  0.595699304f,
+    0.806847554f,  0.590759702f,
     0.810457198f,  0.585797857f,
+    0.814036330f,  0.580813958f,
     0.817584813f,  0.575808191f,
+    0.821102515f,  0.570780746f,
     0.824589303f,  0.565731811f,
+    0.828045045f,  0.560661576f,
     0.831469612f,  0.555570233f,
+    0.834862875f,  0.550457973f,
     0.838224706f,  0.545324988f,
+    0.841554977f,  0.540171473f,
     0.844853565f,  0.534997620f,
+    0.848120345f,  0.529803625f,
     0.851355193f,  0.524589683f,
+    0.854557988f,  0.519355990f,
     0.857728610f,  0.514102744f,
+    0.860866939f,  0.508830143f,
     0.863972856f,  0.503538384f,
+    0.867046246f,  0.498227667f,
     0.870086991f,  0.492898192f,
+    0.873094978f,  0.487550160f,
     0.876070094f,  0.482183772f,
+    0.879012226f,  0.476799230f,
     0.881921264f,  0.471396737f,
+    0.884797098f,  0.465976496f,
     0.887639620f,  0.460538711f,
+    0.890448723f,  0.455083587f,
     0.893224301f,  0.449611330f,
+    0.895966250f,  0.444122145f,
     0.898674466f,  0.438616239f,
+    0.901348847f,  0.433093819f,
     0.903989293f,  0.427555093f,
+    0.906595705f,  0.422000271f,
     0.909167983f,  0.416429560f,
+    0.911706032f,  0.410843171f,
     0.914209756f,  0.405241314f,
+    0.916679060f,  0.399624200f,
     0.919113852f,  0.393992040f,
+    0.921514039f,  0.388345047f,
     0.923879533f,  0.382683432f,
+    0.926210242f,  0.377007410f,
     0.928506080f,  0.371317194f,
+    0.930766961f,  0.365612998f,
     0.932992799f,  0.359895037f,
+    0.935183510f,  0.354163525f,
     0.937339012f,  0.348418680f,
+    0.939459224f,  0.342660717f,
     0.941544065f,  0.336889853f,
+    0.943593458f,  0.331106306f,
     0.945607325f,  0.325310292f,
+    0.947585591f,  0.319502031f,
     0.949528181f,  0.313681740f,
+    0.951435021f,  0.307849640f,
     0.953306040f,  0.302005949f,
+    0.955141168f,  0.296150888f,
     0.956940336f,  0.290284677f,
+    0.958703475f,  0.284407537f,
     0.960430519f,  0.278519689f,
+    0.962121404f,  0.272621355f,
     0.963776066f,  0.266712757f,
+    0.965394442f,  0.260794118f,
     0.966976471f,  0.254865660f,
+    0.968522094f,  0.248927606f,
     0.970031253f,  0.242980180f,
+    0.971503891f,  0.237023606f,
     0.972939952f,  0.231058108f,
+    0.974339383f,  0.225083911f,
     0.975702130f,  0.219101240f,
+    0.977028143f,  0.213110320f,
     0.978317371f,  0.207111376f,
+    0.979569766f,  0.201104635f,
     0.980785280f,  0.195090322f,
+    0.981963869f,  0.189068664f,
     0.983105487f,  0.183039888f,
+    0.984210092f,  0.177004220f,
     0.985277642f,  0.170961889f,
+    0.986308097f,  0.164913120f,
     0.987301418f,  0.158858143f,
+    0.988257568f,  0.152797185f,
     0.989176510f,  0.146730474f,
+    0.990058210f,  0.140658239f,
     0.990902635f,  0.134580709f,
+    0.991709754f,  0.128498111f,
     0.992479535f,  0.122410675f,
+    0.993211949f,  0.116318631f,
     0.993906970f,  0.110222207f,
+    0.994564571f,  0.104121634f,
     0.995184727f,  0.098017140f,
+    0.995767414f,  0.091908956f,
     0.996312612f,  0.085797312f,
+    0.996820299f,  0.079682438f,
     0.997290457f,  0.073564564f,
+    0.997723067f,  0.067443920f,
     0.998118113f,  0.061320736f,
+    0.998475581f,  0.055195244f,
     0.998795456f,  0.049067674f,
+    0.999077728f,  0.042938257f,
     0.999322385f,  0.036807223f,
+    0.999529418f,  0.030674803f,
     0.999698819f,  0.024541229f,
+    0.999830582f,  0.018406730f,
     0.999924702f,  0.012271538f,
+    0.999981175f,  0.006135885f,
     1.000000000f,  0.000000000f,
+    0.999981175f, -0.006135885f,
     0.999924702f, -0.012271538f,
+    0.999830582f, -0.018406730f,
     0.999698819f, -0.024541229f,
+    0.999529418f, -0.030674803f,
     0.999322385f, -0.036807223f,
+    0.999077728f, -0.042938257f,
     0.998795456f, -0.049067674f,
+    0.998475581f, -0.055195244f,
     0.998118113f, -0.061320736f,
+    0.997723067f, -0.067443920f,
     0.997290457f, -0.073564564f,
+    0.996820299f, -0.079682438f,
     0.996312612f, -0.085797312f,
+    0.995767414f, -0.091908956f,
     0.995184727f, -0.098017140f,
+    0.994564571f, -0.104121634f,
     0.993906970f, -0.110222207f,
+    0.993211949f, -0.116318631f,
     0.992479535f, -0.122410675f,
+    0.991709754f, -0.128498111f,
     0.990902635f, -0.134580709f,
+    0.990058210f, -0.140658239f,
     0.989176510f, -0.146730474f,
+    0.988257568f, -0.152797185f,
     0.987301418f, -0.158858143f,
+    0.986308097f, -0.164913120f,
     0.985277642f, -0.170961889f,
+    0.984210092f, -0.177004220f,
     0.983105487f, -0.183039888f,
+    0.981963869f, -0.189068664f,
     0.980785280f, -0.195090322f,
+    0.979569766f, -0.201104635f,
     0.978317371f, -0.207111376f,
+    0.977028143f, -0.213110320f,
     0.975702130f, -0.219101240f,
+    0.974339383f, -0.225083911f,
     0.972939952f, -0.231058108f,
+    0.971503891f, -0.237023606f,
     0.970031253f, -0.242980180f,
+    0.968522094f, -0.248927606f,
     0.966976471f, -0.254865660f,
+    0.965394442f, -0.260794118f,
     0.963776066f, -0.266712757f,
+    0.962121404f, -0.272621355f,
     0.960430519f, -0.278519689f,
+    0.958703475f, -0.284407537f,
     0.956940336f, -0.290284677f,
+    0.955141168f, -0.296150888f,
     0.953306040f, -0.302005949f,
+    0.951435021f, -0.307849640f,
     0.949528181f, -0.313681740f,
+    0.947585591f, -0.319502031f,
     0.945607325f, -0.325310292f,
+    0.943593458f, -0.331106306f,
     0.941544065f, -0.336889853f,
+    0.939459224f, -0.342660717f,
     0.937339012f, -0.348418680f,
+    0.935183510f, -0.354163525f,
     0.932992799f, -0.359895037f,
+    0.930766961f, -0.365612998f,
     0.928506080f, -0.371317194f,
+    0.926210242f, -0.377007410f,
     0.923879533f, -0.382683432f,
+    0.921514039f, -0.388345047f,
     0.919113852f, -0.393992040f,
+    0.916679060f, -0.399624200f,
     0.914209756f, -0.405241314f,
+    0.911706032f, -0.410843171f,
     0.909167983f, -0.416429560f,
+    0.906595705f, -0.422000271f,
     0.903989293f, -0.427555093f,
+    0.901348847f, -0.433093819f,
     0.898674466f, -0.438616239f,
+    0.895966250f, -0.444122145f,
     0.893224301f, -0.449611330f,
+    0.890448723f, -0.455083587f,
     0.887639620f, -0.460538711f,
+    0.884797098f, -0.465976496f,
     0.881921264f, -0.471396737f,
+    0.879012226f, -0.476799230f,
     0.876070094f, -0.482183772f,
+    0.873094978f, -0.487550160f,
     0.870086991f, -0.492898192f,
+    0.867046246f, -0.498227667f,
     0.863972856f, -0.503538384f,
+    0.860866939f, -0.508830143f,
     0.857728610f, -0.514102744f,
+    0.854557988f, -0.519355990f,
     0.851355193f, -0.524589683f,
+    0.848120345f, -0.529803625f,
     0.844853565f, -0.534997620f,
+    0.841554977f, -0.540171473f,
     0.838224706f, -0.545324988f,
+    0.834862875f, -0.550457973f,
     0.831469612f, -0.555570233f,
+    0.828045045f, -0.560661576f,
     0.824589303f, -0.565731811f,
+    0.821102515f, -0.570780746f,
     0.817584813f, -0.575808191f,
+    0.814036330f, -0.580813958f,
     0.810457198f, -0.585797857f,
+    0.806847554f, -0.590759702f,
     0.803207531f, -0.595699304f,
+    0.799537269f, -0.600616479f,
     0.795836905f, -0.605511041f,
+    0.792106577f, -0.610382806f,
     0.788346428f, -0.615231591f,
+    0.784556597f, -0.620057212f,
     0.780737229f, -0.624859488f,
+    0.776888466f, -0.629638239f,
     0.773010453f, -0.634393284f,
+    0.769103338f, -0.639124445f,
     0.765167266f, -0.643831543f,
+    0.761202385f, -0.648514401f,
     0.757208847f, -0.653172843f,
+    0.753186799f, -0.657806693f,
     0.749136395f, -0.662415778f,
+    0.745057785f, -0.666999922f,
     0.740951125f, -0.671558955f,
+    0.736816569f, -0.676092704f,
     0.732654272f, -0.680600998f,
+    0.728464390f, -0.685083668f,
     0.724247083f, -0.689540545f,
+    0.720002508f, -0.693971461f,
     0.715730825f, -0.698376249f,
+    0.711432196f, -0.702754744f,
     0.707106781f, -0.707106781f,
+    0.702754744f, -0.711432196f,
     0.698376249f, -0.715730825f,
+    0.693971461f, -0.720002508f,
     0.689540545f, -0.724247083f,
+    0.685083668f, -0.728464390f,
     0.680600998f, -0.732654272f,
+    0.676092704f, -0.736816569f,
     0.671558955f, -0.740951125f,
+    0.666999922f, -0.745057785f,
     0.662415778f, -0.749136395f,
+    0.657806693f, -0.753186799f,
     0.653172843f, -0.757208847f,
+    0.648514401f, -0.761202385f,
     0.643831543f, -0.765167266f,
+    0.639124445f, -0.769103338f,
     0.634393284f, -0.773010453f,
+    0.629638239f, -0.776888466f,
     0.624859488f, -0.780737229f,
+    0.620057212f, -0.784556597f,
     0.615231591f, -0.788346428f,
+    0.610382806f, -0.792106577f,
     0.605511041f, -0.795836905f,
+    0.600616479f, -0.799537269f,
     0.595699304f, -0.803207531f,
+    0.590759702f, -0.806847554f,
     0.585797857f, -0.810457198f,
+    0.580813958f, -0.814036330f,
     0.575808191f, -0.817584813f,
+    0.570780746f, -0.821102515f,
     0.565731811f, -0.824589303f,
+    0.560661576f, -0.828045045f,
     0.555570233f, -0.831469612f,
+    0.550457973f, -0.834862875f,
     0.545324988f, -0.838224706f,
+    0.540171473f, -0.841554977f,
     0.534997620f, -0.844853565f,
+    0.529803625f, -0.848120345f,
     0.524589683f, -0.851355193f,
+    0.519355990f, -0.854557988f,
     0.514102744f, -0.857728610f,
+    0.508830143f, -0.860866939f,
     0.503538384f, -0.863972856f,
+    0.498227667f, -0.867046246f,
     0.492898192f, -0.870086991f,
+    0.487550160f, -0.873094978f,
     0.482183772f, -0.876070094f,
+    0.476799230f, -0.879012226f,
     0.471396737f, -0.881921264f,
+    0.465976496f, -0.884797098f,
     0.460538711f, -0.887639620f,
+    0.455083587f, -0.890448723f,
     0.449611330f, -0.893224301f,
+    0.444122145f, -0.895966250f,
     0.438616239f, -0.898674466f,
+    0.433093819f, -0.901348847f,
     0.427555093f, -0.903989293f,
+    0.422000271f, -0.906595705f,
     0.416429560f, -0.909167983f,
+    0.410843171f, -0.911706032f,
     0.405241314f, -0.914209756f,
+    0.399624200f, -0.916679060f,
     0.393992040f, -0.919113852f,
+    0.388345047f, -0.921514039f,
     0.382683432f, -0.923879533f,
+    0.377007410f, -0.926210242f,
     0.371317194f, -0.928506080f,
+    0.365612998f, -0.930766961f,
     0.359895037f, -0.932992799f,
+    0.354163525f, -0.935183510f,
     0.348418680f, -0.937339012f,
+    0.342660717f, -0.939459224f,
     0.336889853f, -0.941544065f,
+    0.331106306f, -0.943593458f,
     0.325310292f, -0.945607325f,
+    0.319502031f, -0.947585591f,
     0.313681740f, -0.949528181f,
+    0.307849640f, -0.951435021f,
     0.302005949f, -0.953306040f,
+    0.296150888f, -0.955141168f,
     0.290284677f, -0.956940336f,
+    0.284407537f, -0.958703475f,
     0.278519689f, -0.960430519f,
+    0.272621355f, -0.962121404f,
     0.266712757f, -0.963776066f,
+    0.260794118f, -0.965394442f,
     0.254865660f, -0.966976471f,
+    0.248927606f, -0.968522094f,
     0.242980180f, -0.970031253f,
+    0.237023606f, -0.971503891f,
     0.231058108f, -0.972939952f,
+    0.225083911f, -0.974339383f,
     0.219101240f, -0.975702130f,
+    0.213110320f, -0.977028143f,
     0.207111376f, -0.978317371f,
+    0.201104635f, -0.979569766f,
     0.195090322f, -0.980785280f,
+    0.189068664f, -0.981963869f,
     0.183039888f, -0.983105487f,
+    0.177004220f, -0.984210092f,
     0.170961889f, -0.985277642f,
+    0.164913120f, -0.986308097f,
     0.158858143f, -0.987301418f,
+    0.152797185f, -0.988257568f,
     0.146730474f, -0.989176510f,
+    0.140658239f, -0.990058210f,
     0.134580709f, -0.990902635f,
+    0.128498111f, -0.991709754f,
     0.122410675f, -0.992479535f,
+    0.116318631f, -0.993211949f,
     0.110222207f, -0.993906970f,
+    0.104121634f, -0.994564571f,
     0.098017140f, -0.995184727f,
+    0.091908956f, -0.995767414f,
     0.085797312f, -0.996312612f,
+    0.079682438f, -0.996820299f,
     0.073564564f, -0.997290457f,
+    0.067443920f, -0.997723067f,
     0.061320736f, -0.998118113f,
+    0.055195244f, -0.998475581f,
     0.049067674f, -0.998795456f,
+    0.042938257f, -0.999077728f,
     0.036807223f, -0.999322385f,
+    0.030674803f, -0.999529418f,
     0.024541229f, -0.999698819f,
-    0.012271538f, -0.999924702f
+    0.018406730f, -0.999830582f,
+    0.012271538f, -0.999924702f,
+    0.006135885f, -0.999981175f
 };
+#endif
 
-const float32_t twiddleCoef_rfft_1024[1024] = {
+#if defined(ARM_TABLE_RFFT_F32_2048)
+const float32_t twiddleCoef_rfft_2048[2048] ARM_DSP_TABLE_ATTR = {
     0.000000000f,  1.000000000f,
+    0.003067957f,  0.999995294f,
     0.006135885f,  0.999981175f,
+    0.009203755f,  0.999957645f,
     0.012271538f,  0.999924702f,
+    0.015339206f,  0.999882347f,
     0.018406730f,  0.999830582f,
+    0.021474080f,  0.999769405f,
     0.024541229f,  0.999698819f,
+    0.027608146f,  0.999618822f,
     0.030674803f,  0.999529418f,
+    0.033741172f,  0.999430605f,
     0.036807223f,  0.999322385f,
+    0.039872928f,  0.999204759f,
     0.042938257f,  0.999077728f,
+    0.046003182f,  0.998941293f,
     0.049067674f,  0.998795456f,
+    0.052131705f,  0.998640218f,
     0.055195244f,  0.998475581f,
+    0.058258265f,  0.998301545f,
     0.061320736f,  0.998118113f,
+    0.064382631f,  0.997925286f,
     0.067443920f,  0.997723067f,
+    0.070504573f,  0.997511456f,
     0.073564564f,  0.997290457f,
+    0.076623861f,  0.997060070f,
     0.079682438f,  0.996820299f,
+    0.082740265f,  0.996571146f,
     0.085797312f,  0.996312612f,
+    0.088853553f,  0.996044701f,
     0.091908956f,  0.995767414f,
+    0.094963495f,  0.995480755f,
     0.098017140f,  0.995184727f,
+    0.101069863f,  0.994879331f,
     0.104121634f,  0.994564571f,
+    0.107172425f,  0.994240449f,
     0.110222207f,  0.993906970f,
+    0.113270952f,  0.993564136f,
     0.116318631f,  0.993211949f,
+    0.119365215f,  0.992850414f,
     0.122410675f,  0.992479535f,
+    0.125454983f,  0.992099313f,
     0.128498111f,  0.991709754f,
+    0.131540029f,  0.991310860f,
     0.134580709f,  0.990902635f,
+    0.137620122f,  0.990485084f,
     0.140658239f,  0.990058210f,
+    0.143695033f,  0.989622017f,
     0.146730474f,  0.989176510f,
+    0.149764535f,  0.988721692f,
     0.152797185f,  0.988257568f,
+    0.155828398f,  0.987784142f,
     0.158858143f,  0.987301418f,
+    0.161886394f,  0.986809402f,
     0.164913120f,  0.986308097f,
+    0.167938295f,  0.985797509f,
     0.170961889f,  0.985277642f,
+    0.173983873f,  0.984748502f,
     0.177004220f,  0.984210092f,
+    0.180022901f,  0.983662419f,
     0.183039888f,  0.983105487f,
+    0.186055152f,  0.982539302f,
     0.189068664f,  0.981963869f,
+    0.192080397f,  0.981379193f,
     0.195090322f,  0.980785280f,
+    0.198098411f,  0.980182136f,
     0.201104635f,  0.979569766f,
+    0.204108966f,  0.978948175f,
     0.207111376f,  0.978317371f,
+    0.210111837f,  0.977677358f,
     0.213110320f,  0.977028143f,
+    0.216106797f,  0.976369731f,
     0.219101240f,  0.975702130f,
+    0.222093621f,  0.975025345f,
     0.225083911f,  0.974339383f,
+    0.228072083f,  0.973644250f,
     0.231058108f,  0.972939952f,
+    0.234041959f,  0.972226497f,
     0.237023606f,  0.971503891f,
+    0.240003022f,  0.970772141f,
     0.242980180f,  0.970031253f,
+    0.245955050f,  0.969281235f,
     0.248927606f,  0.968522094f,
+    0.251897818f,  0.967753837f,
     0.254865660f,  0.966976471f,
+    0.257831102f,  0.966190003f,
     0.260794118f,  0.965394442f,
+    0.263754679f,  0.964589793f,
     0.266712757f,  0.963776066f,
+    0.269668326f,  0.962953267f,
     0.272621355f,  0.962121404f,
+    0.275571819f,  0.961280486f,
     0.278519689f,  0.960430519f,
+    0.281464938f,  0.959571513f,
     0.284407537f,  0.958703475f,
+    0.287347460f,  0.957826413f,
     0.290284677f,  0.956940336f,
+    0.293219163f,  0.956045251f,
     0.296150888f,  0.955141168f,
+    0.299079826f,  0.954228095f,
     0.302005949f,  0.953306040f,
+    0.304929230f,  0.952375013f,
     0.307849640f,  0.951435021f,
+    0.310767153f,  0.950486074f,
     0.313681740f,  0.949528181f,
+    0.316593376f,  0.948561350f,
     0.319502031f,  0.947585591f,
+    0.322407679f,  0.946600913f,
     0.325310292f,  0.945607325f,
+    0.328209844f,  0.944604837f,
     0.331106306f,  0.943593458f,
+    0.333999651f,  0.942573198f,
     0.336889853f,  0.941544065f,
+    0.339776884f,  0.940506071f,
     0.342660717f,  0.939459224f,
+    0.345541325f,  0.938403534f,
     0.348418680f,  0.937339012f,
+    0.351292756f,  0.936265667f,
     0.354163525f,  0.935183510f,
+    0.357030961f,  0.934092550f,
     0.359895037f,  0.932992799f,
+    0.362755724f,  0.931884266f,
     0.365612998f,  0.930766961f,
+    0.368466830f,  0.929640896f,
     0.371317194f,  0.928506080f,
+    0.374164063f,  0.927362526f,
     0.377007410f,  0.926210242f,
+    0.379847209f,  0.925049241f,
     0.382683432f,  0.923879533f,
+    0.385516054f,  0.922701128f,
     0.388345047f,  0.921514039f,
+    0.391170384f,  0.920318277f,
     0.393992040f,  0.919113852f,
+    0.396809987f,  0.917900776f,
     0.399624200f,  0.916679060f,
+    0.402434651f,  0.915448716f,
     0.405241314f,  0.914209756f,
+    0.408044163f,  0.912962190f,
     0.410843171f,  0.911706032f,
+    0.413638312f,  0.910441292f,
     0.416429560f,  0.909167983f,
+    0.419216888f,  0.907886116f,
     0.422000271f,  0.906595705f,
+    0.424779681f,  0.905296759f,
     0.427555093f,  0.903989293f,
+    0.430326481f,  0.902673318f,
     0.433093819f,  0.901348847f,
+    0.435857080f,  0.900015892f,
     0.438616239f,  0.898674466f,
+    0.441371269f,  0.897324581f,
     0.444122145f,  0.895966250f,
+    0.446868840f,  0.894599486f,
     0.449611330f,  0.893224301f,
+    0.452349587f,  0.891840709f,
     0.455083587f,  0.890448723f,
+    0.457813304f,  0.889048356f,
     0.460538711f,  0.887639620f,
+    0.463259784f,  0.886222530f,
     0.465976496f,  0.884797098f,
+    0.468688822f,  0.883363339f,
     0.471396737f,  0.881921264f,
+    0.474100215f,  0.880470889f,
     0.476799230f,  0.879012226f,
+    0.479493758f,  0.877545290f,
     0.482183772f,  0.876070094f,
+    0.484869248f,  0.874586652f,
     0.487550160f,  0.873094978f,
+    0.490226483f,  0.871595087f,
     0.492898192f,  0.870086991f,
+    0.495565262f,  0.868570706f,
     0.498227667f,  0.867046246f,
+    0.500885383f,  0.865513624f,
     0.503538384f,  0.863972856f,
+    0.506186645f,  0.862423956f,
     0.508830143f,  0.860866939f,
+    0.511468850f,  0.859301818f,
     0.514102744f,  0.857728610f,
+    0.516731799f,  0.856147328f,
     0.519355990f,  0.854557988f,
+    0.521975293f,  0.852960605f,
     0.524589683f,  0.851355193f,
+    0.527199135f,  0.849741768f,
     0.529803625f,  0.848120345f,
+    0.532403128f,  0.846490939f,
     0.534997620f,  0.844853565f,
+    0.537587076f,  0.843208240f,
     0.540171473f,  0.841554977f,
+    0.542750785f,  0.839893794f,
     0.545324988f,  0.838224706f,
+    0.547894059f,  0.836547727f,
     0.550457973f,  0.834862875f,
+    0.553016706f,  0.833170165f,
     0.555570233f,  0.831469612f,
+    0.558118531f,  0.829761234f,
     0.560661576f,  0.828045045f,
+    0.563199344f,  0.826321063f,
     0.565731811f,  0.824589303f,
+    0.568258953f,  0.822849781f,
     0.570780746f,  0.821102515f,
+    0.573297167f,  0.819347520f,
     0.575808191f,  0.817584813f,
+    0.578313796f,  0.815814411f,
     0.580813958f,  0.814036330f,
+    0.583308653f,  0.812250587f,
     0.585797857f,  0.810457198f,
+    0.588281548f,  0.808656182f,
     0.590759702f,  0.806847554f,
+    0.593232295f,  0.805031331f,
     0.595699304f,  0.803207531f,
+    0.598160707f,  0.801376172f,
     0.600616479f,  0.799537269f,
+    0.603066599f,  0.797690841f,
     0.605511041f,  0.795836905f,
+    0.607949785f,  0.793975478f,
     0.610382806f,  0.792106577f,
+    0.612810082f,  0.790230221f,
     0.615231591f,  0.788346428f,
+    0.617647308f,  0.786455214f,
     0.620057212f,  0.784556597f,
+    0.622461279f,  0.782650596f,
     0.624859488f,  0.780737229f,
+    0.627251815f,  0.778816512f,
     0.629638239f,  0.776888466f,
+    0.632018736f,  0.774953107f,
     0.634393284f,  0.773010453f,
+    0.636761861f,  0.771060524f,
     0.639124445f,  0.769103338f,
+    0.641481013f,  0.767138912f,
     0.643831543f,  0.765167266f,
+    0.646176013f,  0.763188417f,
     0.648514401f,  0.761202385f,
+    0.650846685f,  0.759209189f,
     0.653172843f,  0.757208847f,
+    0.655492853f,  0.755201377f,
     0.657806693f,  0.753186799f,
+    0.660114342f,  0.751165132f,
     0.662415778f,  0.749136395f,
+    0.664710978f,  0.747100606f,
     0.666999922f,  0.745057785f,
+    0.669282588f,  0.743007952f,
     0.671558955f,  0.740951125f,
+    0.673829000f,  0.738887324f,
     0.676092704f,  0.736816569f,
+    0.678350043f,  0.734738878f,
     0.680600998f,  0.732654272f,
+    0.682845546f,  0.730562769f,
     0.685083668f,  0.728464390f,
+    0.687315341f,  0.726359155f,
     0.689540545f,  0.724247083f,
+    0.691759258f,  0.722128194f,
     0.693971461f,  0.720002508f,
+    0.696177131f,  0.717870045f,
     0.698376249f,  0.715730825f,
+    0.700568794f,  0.713584869f,
     0.702754744f,  0.711432196f,
+    0.704934080f,  0.709272826f,
     0.707106781f,  0.707106781f,
+    0.709272826f,  0.704934080f,
     0.711432196f,  0.702754744f,
+    0.713584869f,  0.700568794f,
     0.715730825f,  0.698376249f,
+    0.717870045f,  0.696177131f,
     0.720002508f,  0.693971461f,
+    0.722128194f,  0.691759258f,
     0.724247083f,  0.689540545f,
+    0.726359155f,  0.687315341f,
     0.728464390f,  0.685083668f,
+    0.730562769f,  0.682845546f,
     0.732654272f,  0.680600998f,
+    0.734738878f,  0.678350043f,
     0.736816569f,  0.676092704f,
+    0.738887324f,  0.673829000f,
     0.740951125f,  0.671558955f,
+    0.743007952f,  0.669282588f,
     0.745057785f,  0.666999922f,
+    0.747100606f,  0.664710978f,
     0.749136395f,  0.662415778f,
+    0.751165132f,  0.660114342f,
     0.753186799f,  0.657806693f,
+    0.755201377f,  0.655492853f,
     0.757208847f,  0.653172843f,
+    0.759209189f,  0.650846685f,
     0.761202385f,  0.648514401f,
+    0.763188417f,  0.646176013f,
     0.765167266f,  0.643831543f,
+    0.767138912f,  0.641481013f,
     0.769103338f,  0.639124445f,
+    0.771060524f,  0.636761861f,
     0.773010453f,  0.634393284f,
+    0.774953107f,  0.632018736f,
     0.776888466f,  0.629638239f,
+    0.778816512f,  0.627251815f,
     0.780737229f,  0.624859488f,
+    0.782650596f,  0.622461279f,
     0.784556597f,  0.620057212f,
+    0.786455214f,  0.617647308f,
     0.788346428f,  0.615231591f,
+    0.790230221f,  0.612810082f,
     0.792106577f,  0.610382806f,
+    0.793975478f,  0.607949785f,
     0.795836905f,  0.605511041f,
+    0.797690841f,  0.603066599f,
     0.799537269f,  0.600616479f,
+    0.801376172f,  0.598160707f,
     0.803207531f,  0.595699304f,
+    0.805031331f,  0.593232295f,
     0.806847554f,  0.590759702f,
+    0.808656182f,  0.588281548f,
     0.810457198f,  0.585797857f,
+    0.812250587f,  0.583308653f,
     0.814036330f,  0.580813958f,
+    0.815814411f,  0.578313796f,
     0.817584813f,  0.575808191f,
+    0.819347520f,  0.573297167f,
     0.821102515f,  0.570780746f,
+    0.822849781f,  0.568258953f,
     0.824589303f,  0.565731811f,
+    0.826321063f,  0.563199344f,
     0.828045045f,  0.560661576f,
+    0.829761234f,  0.558118531f,
     0.831469612f,  0.555570233f,
+    0.833170165f,  0.553016706f,
     0.834862875f,  0.550457973f,
+    0.836547727f,  0.547894059f,
     0.838224706f,  0.545324988f,
+    0.839893794f,  0.542750785f,
     0.841554977f,  0.540171473f,
+    0.843208240f,  0.537587076f,
     0.844853565f,  0.534997620f,
+    0.846490939f,  0.532403128f,
     0.848120345f,  0.529803625f,
+    0.849741768f,  0.527199135f,
     0.851355193f,  0.524589683f,
+    0.852960605f,  0.521975293f,
     0.854557988f,  0.519355990f,
+    0.856147328f,  0.516731799f,
     0.857728610f,  0.514102744f,
+    0.859301818f,  0.511468850f,
     0.860866939f,  0.508830143f,
+    0.862423956f,  0.506186645f,
     0.863972856f,  0.503538384f,
+    0.865513624f,  0.500885383f,
     0.867046246f,  0.498227667f,
+    0.868570706f,  0.495565262f,
     0.870086991f,  0.492898192f,
+    0.871595087f,  0.490226483f,
     0.873094978f,  0.487550160f,
+    0.874586652f,  0.484869248f,
     0.876070094f,  0.482183772f,
+    0.877545290f,  0.479493758f,
     0.879012226f,  0.476799230f,
+    0.880470889f,  0.474100215f,
     0.881921264f,  0.471396737f,
+    0.883363339f,  0.468688822f,
     0.884797098f,  0.465976496f,
+    0.886222530f,  0.463259784f,
     0.887639620f,  0.460538711f,
+    0.889048356f,  0.457813304f,
     0.890448723f,  0.455083587f,
+    0.891840709f,  0.452349587f,
     0.893224301f,  0.449611330f,
+    0.894599486f,  0.446868840f,
     0.895966250f,  0.444122145f,
+    0.897324581f,  0.441371269f,
     0.898674466f,  0.438616239f,
+    0.900015892f,  0.435857080f,
     0.901348847f,  0.433093819f,
+    0.902673318f,  0.430326481f,
     0.903989293f,  0.427555093f,
+    0.905296759f,  0.424779681f,
     0.906595705f,  0.422000271f,
+    0.907886116f,  0.419216888f,
     0.909167983f,  0.416429560f,
+    0.910441292f,  0.413638312f,
     0.911706032f,  0.410843171f,
+    0.912962190f,  0.408044163f,
     0.914209756f,  0.405241314f,
+    0.915448716f,  0.402434651f,
     0.916679060f,  0.399624200f,
+    0.917900776f,  0.396809987f,
     0.919113852f,  0.393992040f,
+    0.920318277f,  0.391170384f,
     0.921514039f,  0.388345047f,
+    0.922701128f,  0.385516054f,
     0.923879533f,  0.382683432f,
+    0.925049241f,  0.379847209f,
     0.926210242f,  0.377007410f,
+    0.927362526f,  0.374164063f,
     0.928506080f,  0.371317194f,
+    0.929640896f,  0.368466830f,
     0.930766961f,  0.365612998f,
+    0.931884266f,  0.362755724f,
     0.932992799f,  0.359895037f,
+    0.934092550f,  0.357030961f,
     0.935183510f,  0.354163525f,
+    0.936265667f,  0.351292756f,
     0.937339012f,  0.348418680f,
+    0.938403534f,  0.345541325f,
     0.939459224f,  0.342660717f,
+    0.940506071f,  0.339776884f,
     0.941544065f,  0.336889853f,
+    0.942573198f,  0.333999651f,
     0.943593458f,  0.331106306f,
+    0.944604837f,  0.328209844f,
     0.945607325f,  0.325310292f,
+    0.946600913f,  0.322407679f,
     0.947585591f,  0.319502031f,
+    0.948561350f,  0.316593376f,
     0.949528181f,  0.313681740f,
+    0.950486074f,  0.310767153f,
     0.951435021f,  0.307849640f,
+    0.952375013f,  0.304929230f,
     0.953306040f,  0.302005949f,
+    0.954228095f,  0.299079826f,
     0.955141168f,  0.296150888f,
+    0.956045251f,  0.293219163f,
     0.956940336f,  0.290284677f,
+    0.957826413f,  0.287347460f,
     0.958703475f,  0.284407537f,
+    0.959571513f,  0.281464938f,
     0.960430519f,  0.278519689f,
+    0.961280486f,  0.275571819f,
     0.962121404f,  0.272621355f,
+    0.962953267f,  0.269668326f,
     0.963776066f,  0.266712757f,
+    0.964589793f,  0.263754679f,
     0.965394442f,  0.260794118f,
+    0.966190003f,  0.257831102f,
     0.966976471f,  0.254865660f,
+    0.967753837f,  0.251897818f,
     0.968522094f,  0.248927606f,
+    0.969281235f,  0.245955050f,
     0.970031253f,  0.242980180f,
+    0.970772141f,  0.240003022f,
     0.971503891f,  0.237023606f,
+    0.972226497f,  0.234041959f,
     0.972939952f,  0.231058108f,
+    0.973644250f,  0.228072083f,
     0.974339383f,  0.225083911f,
+    0.975025345f,  0.222093621f,
     0.975702130f,  0.219101240f,
+    0.976369731f,  0.216106797f,
     0.977028143f,  0.213110320f,
+    0.977677358f,  0.210111837f,
     0.978317371f,  0.207111376f,
+    0.978948175f,  0.204108966f,
     0.979569766f,  0.201104635f,
+    0.980182136f,  0.198098411f,
     0.980785280f,  0.195090322f,
+    0.981379193f,  0.192080397f,
     0.981963869f,  0.189068664f,
+    0.982539302f,  0.186055152f,
     0.983105487f,  0.183039888f,
+    0.983662419f,  0.180022901f,
     0.984210092f,  0.177004220f,
+    0.984748502f,  0.173983873f,
     0.985277642f,  0.170961889f,
+    0.985797509f,  0.167938295f,
     0.986308097f,  0.164913120f,
+    0.986809402f,  0.161886394f,
     0.987301418f,  0.158858143f,
+    0.987784142f,  0.155828398f,
     0.988257568f,  0.152797185f,
+    0.988721692f,  0.149764535f,
     0.989176510f,  0.146730474f,
+    0.989622017f,  0.143695033f,
     0.990058210f,  0.140658239f,
+    0.990485084f,  0.137620122f,
     0.990902635f,  0.134580709f,
+    0.991310860f,  0.131540029f,
     0.991709754f,  0.128498111f,
+    0.992099313f,  0.125454983f,
     0.992479535f,  0.122410675f,
+    0.992850414f,  0.119365215f,
     0.993211949f,  0.116318631f,
+    0.993564136f,  0.113270952f,
     0.993906970f,  0.110222207f,
+    0.994240449f,  0.107172425f,
     0.994564571f,  0.104121634f,
+    0.994879331f,  0.101069863f,
     0.995184727f,  0.098017140f,
+    0.995480755f,  0.094963495f,
     0.995767414f,  0.091908956f,
+    0.996044701f,  0.088853553f,
     0.996312612f,  0.085797312f,
+    0.996571146f,  0.082740265f,
     0.996820299f,  0.079682438f,
+    0.997060070f,  0.076623861f,
     0.997290457f,  0.073564564f,
+    0.997511456f,  0.070504573f,
     0.997723067f,  0.067443920f,
+    0.997925286f,  0.064382631f,
     0.998118113f,  0.061320736f,
+    0.998301545f,  0.058258265f,
     0.998475581f,  0.055195244f,
+    0.998640218f,  0.052131705f,
     0.998795456f,  0.049067674f,
+    0.998941293f,  0.046003182f,
     0.999077728f,  0.042938257f,
+    0.999204759f,  0.039872928f,
     0.999322385f,  0.036807223f,
+    0.999430605f,  0.033741172f,
     0.999529418f,  0.030674803f,
+    0.999618822f,  0.027608146f,
     0.999698819f,  0.024541229f,
+    0.999769405f,  0.021474080f,
     0.999830582f,  0.018406730f,
+    0.999882347f,  0.015339206f,
     0.999924702f,  0.012271538f,
+    0.999957645f,  0.009203755f,
     0.999981175f,  0.006135885f,
+    0.999995294f,  0.003067957f,
     1.000000000f,  0.000000000f,
+    0.999995294f, -0.003067957f,
     0.999981175f, -0.006135885f,
+    0.999957645f, -0.009203755f,
     0.999924702f, -0.012271538f,
+    0.999882347f, -0.015339206f,
     0.999830582f, -0.018406730f,
+    0.999769405f, -0.021474080f,
     0.999698819f, -0.024541229f,
+    0.999618822f, -0.027608146f,
     0.999529418f, -0.030674803f,
+    0.999430605f, -0.033741172f,
     0.999322385f, -0.036807223f,
+    0.999204759f, -0.039872928f,
     0.999077728f, -0.042938257f,
+    0.998941293f, -0.046003182f,
     0.998795456f, -0.049067674f,
+    0.998640218f, -0.052131705f,
     0.998475581f, -0.055195244f,
+    0.998301545f, -0.058258265f,
     0.998118113f, -0.061320736f,
+    0.997925286f, -0.064382631f,
     0.997723067f, -0.067443920f,
+    0.997511456f, -0.070504573f,
     0.997290457f, -0.073564564f,
+    0.997060070f, -0.076623861f,
     0.996820299f, -0.079682438f,
+    0.996571146f, -0.082740265f,
     0.996312612f, -0.085797312f,
+    0.996044701f, -0.088853553f,
     0.995767414f, -0.091908956f,
+    0.995480755f, -0.094963495f,
     0.995184727f, -0.098017140f,
+    0.994879331f, -0.101069863f,
     0.994564571f, -0.104121634f,
+    0.994240449f, -0.107172425f,
     0.993906970f, -0.110222207f,
+    0.993564136f, -0.113270952f,
     0.993211949f, -0.116318631f,
+    0.992850414f, -0.119365215f,
     0.992479535f, -0.122410675f,
+    0.992099313f, -0.125454983f,
     0.991709754f, -0.128498111f,
+    0.991310860f, -0.131540029f,
     0.990902635f, -0.134580709f,
+    0.990485084f, -0.137620122f,
     0.990058210f, -0.140658239f,
+    0.989622017f, -0.143695033f,
     0.989176510f, -0.146730474f,
+    0.988721692f, -0.149764535f,
     0.988257568f, -0.152797185f,
+    0.987784142f, -0.155828398f,
     0.987301418f, -0.158858143f,
+    0.986809402f, -0.161886394f,
     0.986308097f, -0.164913120f,
+    0.985797509f, -0.167938295f,
     0.985277642f, -0.170961889f,
+    0.984748502f, -0.173983873f,
     0.984210092f, -0.177004220f,
+    0.983662419f, -0.180022901f,
     0.983105487f, -0.183039888f,
+    0.982539302f, -0.186055152f,
     0.981963869f, -0.189068664f,
+    0.981379193f, -0.192080397f,
     0.980785280f, -0.195090322f,
+    0.980182136f, -0.198098411f,
     0.979569766f, -0.201104635f,
+    0.978948175f, -0.204108966f,
     0.978317371f, -0.207111376f,
+    0.977677358f, -0.210111837f,
     0.977028143f, -0.213110320f,
+    0.976369731f, -0.216106797f,
     0.975702130f, -0.219101240f,
+    0.975025345f, -0.222093621f,
     0.974339383f, -0.225083911f,
+    0.973644250f, -0.228072083f,
     0.972939952f, -0.231058108f,
+    0.972226497f, -0.234041959f,
     0.971503891f, -0.237023606f,
+    0.970772141f, -0.240003022f,
     0.970031253f, -0.242980180f,
+    0.969281235f, -0.245955050f,
     0.968522094f, -0.248927606f,
+    0.967753837f, -0.251897818f,
     0.966976471f, -0.254865660f,
+    0.966190003f, -0.257831102f,
     0.965394442f, -0.260794118f,
+    0.964589793f, -0.263754679f,
     0.963776066f, -0.266712757f,
+    0.962953267f, -0.269668326f,
     0.962121404f, -0.272621355f,
+    0.961280486f, -0.275571819f,
     0.960430519f, -0.278519689f,
+    0.959571513f, -0.281464938f,
     0.958703475f, -0.284407537f,
+    0.957826413f, -0.287347460f,
     0.956940336f, -0.290284677f,
+    0.956045251f, -0.293219163f,
     0.955141168f, -0.296150888f,
+    0.954228095f, -0.299079826f,
     0.953306040f, -0.302005949f,
+    0.952375013f, -0.304929230f,
     0.951435021f, -0.307849640f,
+    0.950486074f, -0.310767153f,
     0.949528181f, -0.313681740f,
+    0.948561350f, -0.316593376f,
     0.947585591f, -0.319502031f,
+    0.946600913f, -0.322407679f,
     0.945607325f, -0.325310292f,
+    0.944604837f, -0.328209844f,
     0.943593458f, -0.331106306f,
+    0.942573198f, -0.333999651f,
     0.941544065f, -0.336889853f,
+    0.940506071f, -0.339776884f,
     0.939459224f, -0.342660717f,
+    0.938403534f, -0.345541325f,
     0.937339012f, -0.348418680f,
+    0.936265667f, -0.351292756f,
     0.935183510f, -0.354163525f,
+    0.934092550f, -0.357030961f,
     0.932992799f, -0.359895037f,
+    0.931884266f, -0.362755724f,
     0.930766961f, -0.365612998f,
+    0.929640896f, -0.368466830f,
     0.928506080f, -0.371317194f,
+    0.927362526f, -0.374164063f,
     0.926210242f, -0.377007410f,
+    0.925049241f, -0.379847209f,
     0.923879533f, -0.382683432f,
+    0.922701128f, -0.385516054f,
     0.921514039f, -0.388345047f,
+    0.920318277f, -0.391170384f,
     0.919113852f, -0.393992040f,
+    0.917900776f, -0.396809987f,
     0.916679060f, -0.399624200f,
+    0.915448716f, -0.402434651f,
     0.914209756f, -0.405241314f,
+    0.912962190f, -0.408044163f,
     0.911706032f, -0.410843171f,
+    0.910441292f, -0.413638312f,
     0.909167983f, -0.416429560f,
+    0.907886116f, -0.419216888f,
     0.906595705f, -0.422000271f,
+    0.905296759f, -0.424779681f,
     0.903989293f, -0.427555093f,
+    0.902673318f, -0.430326481f,
     0.901348847f, -0.433093819f,
+    0.900015892f, -0.435857080f,
     0.898674466f, -0.438616239f,
+    0.897324581f, -0.441371269f,
     0.895966250f, -0.444122145f,
+    0.894599486f, -0.446868840f,
     0.893224301f, -0.449611330f,
+    0.891840709f, -0.452349587f,
     0.890448723f, -0.455083587f,
+    0.889048356f, -0.457813304f,
     0.887639620f, -0.460538711f,
+    0.886222530f, -0.463259784f,
     0.884797098f, -0.465976496f,
+    0.883363339f, -0.468688822f,
     0.881921264f, -0.471396737f,
+    0.880470889f, -0.474100215f,
     0.879012226f, -0.476799230f,
+    0.877545290f, -0.479493758f,
     0.876070094f, -0.482183772f,
+    0.874586652f, -0.484869248f,
     0.873094978f, -0.487550160f,
+    0.871595087f, -0.490226483f,
     0.870086991f, -0.492898192f,
+    0.868570706f, -0.495565262f,
     0.867046246f, -0.498227667f,
+    0.865513624f, -0.500885383f,
     0.863972856f, -0.503538384f,
+    0.862423956f, -0.506186645f,
     0.860866939f, -0.508830143f,
+    0.859301818f, -0.511468850f,
     0.857728610f, -0.514102744f,
+    0.856147328f, -0.516731799f,
     0.854557988f, -0.519355990f,
+    0.852960605f, -0.521975293f,
     0.851355193f, -0.524589683f,
+    0.849741768f, -0.527199135f,
     0.848120345f, -0.529803625f,
+    0.846490939f, -0.532403128f,
     0.844853565f, -0.534997620f,
+    0.843208240f, -0.537587076f,
     0.841554977f, -0.540171473f,
+    0.839893794f, -0.542750785f,
     0.838224706f, -0.545324988f,
+    0.836547727f, -0.547894059f,
     0.834862875f, -0.550457973f,
+    0.833170165f, -0.553016706f,
     0.831469612f, -0.555570233f,
+    0.829761234f, -0.558118531f,
     0.828045045f, -0.560661576f,
+    0.826321063f, -0.563199344f,
     0.824589303f, -0.565731811f,
+    0.822849781f, -0.568258953f,
     0.821102515f, -0.570780746f,
+    0.819347520f, -0.573297167f,
     0.817584813f, -0.575808191f,
+    0.815814411f, -0.578313796f,
     0.814036330f, -0.580813958f,
+    0.812250587f, -0.583308653f,
     0.810457198f, -0.585797857f,
+    0.808656182f, -0.588281548f,
     0.806847554f, -0.590759702f,
+    0.805031331f, -0.593232295f,
     0.803207531f, -0.595699304f,
+    0.801376172f, -0.598160707f,
     0.799537269f, -0.600616479f,
+    0.797690841f, -0.603066599f,
     0.795836905f, -0.605511041f,
+    0.793975478f, -0.607949785f,
     0.792106577f, -0.610382806f,
+    0.790230221f, -0.612810082f,
     0.788346428f, -0.615231591f,
+    0.786455214f, -0.617647308f,
     0.784556597f, -0.620057212f,
+    0.782650596f, -0.622461279f,
     0.780737229f, -0.624859488f,
+    0.778816512f, -0.627251815f,
     0.776888466f, -0.629638239f,
+    0.774953107f, -0.632018736f,
     0.773010453f, -0.634393284f,
+    0.771060524f, -0.636761861f,
     0.769103338f, -0.639124445f,
+    0.767138912f, -0.641481013f,
     0.765167266f, -0.643831543f,
+    0.763188417f, -0.646176013f,
     0.761202385f, -0.648514401f,
+    0.759209189f, -0.650846685f,
     0.757208847f, -0.653172843f,
+    0.755201377f, -0.655492853f,
     0.753186799f, -0.657806693f,
+    0.751165132f, -0.660114342f,
     0.749136395f, -0.662415778f,
+    0.747100606f, -0.664710978f,
     0.745057785f, -0.666999922f,
+    0.743007952f, -0.669282588f,
     0.740951125f, -0.671558955f,
+    0.738887324f, -0.673829000f,
     0.736816569f, -0.676092704f,
+    0.734738878f, -0.678350043f,
     0.732654272f, -0.680600998f,
+    0.730562769f, -0.682845546f,
     0.728464390f, -0.685083668f,
+    0.726359155f, -0.687315341f,
     0.724247083f, -0.689540545f,
+    0.722128194f, -0.691759258f,
     0.720002508f, -0.693971461f,
+    0.717870045f, -0.696177131f,
     0.715730825f, -0.698376249f,
+    0.713584869f, -0.700568794f,
     0.711432196f, -0.702754744f,
+    0.709272826f, -0.704934080f,
     0.707106781f, -0.707106781f,
+    0.704934080f, -0.709272826f,
     0.702754744f, -0.711432196f,
+    0.700568794f, -0.713584869f,
     0.698376249f, -0.715730825f,
+    0.696177131f, -0.717870045f,
     0.693971461f, -0.720002508f,
+    0.691759258f, -0.722128194f,
     0.689540545f, -0.724247083f,
+    0.687315341f, -0.726359155f,
     0.685083668f, -0.728464390f,
+    0.682845546f, -0.730562769f,
     0.680600998f, -0.732654272f,
+    0.678350043f, -0.734738878f,
     0.676092704f, -0.736816569f,
+    0.673829000f, -0.738887324f,
     0.671558955f, -0.740951125f,
+    0.669282588f, -0.743007952f,
     0.666999922f, -0.745057785f,
+    0.664710978f, -0.747100606f,
     0.662415778f, -0.749136395f,
+    0.660114342f, -0.751165132f,
     0.657806693f, -0.753186799f,
+    0.655492853f, -0.755201377f,
     0.653172843f, -0.757208847f,
+    0.650846685f, -0.759209189f,
     0.648514401f, -0.761202385f,
+    0.646176013f, -0.763188417f,
     0.643831543f, -0.765167266f,
+    0.641481013f, -0.767138912f,
     0.639124445f, -0.769103338f,
+    0.636761861f, -0.771060524f,
     0.634393284f, -0.773010453f,
+    0.632018736f, -0.774953107f,
     0.629638239f, -0.776888466f,
+    0.627251815f, -0.778816512f,
     0.624859488f, -0.780737229f,
+    0.622461279f, -0.782650596f,
     0.620057212f, -0.784556597f,
+    0.617647308f, -0.786455214f,
     0.615231591f, -0.788346428f,
+    0.612810082f, -0.790230221f,
     0.610382806f, -0.792106577f,
+    0.607949785f, -0.793975478f,
     0.605511041f, -0.795836905f,
+    0.603066599f, -0.797690841f,
     0.600616479f, -0.799537269f,
+    0.598160707f, -0.801376172f,
     0.595699304f, -0.803207531f,
+    0.593232295f, -0.805031331f,
     0.590759702f, -0.806847554f,
+    0.588281548f, -0.808656182f,
     0.585797857f, -0.810457198f,
+    0.583308653f, -0.812250587f,
     0.580813958f, -0.814036330f,
+    0.578313796f, -0.815814411f,
     0.575808191f, -0.817584813f,
+    0.573297167f, -0.819347520f,
     0.570780746f, -0.821102515f,
+    0.568258953f, -0.822849781f,
     0.565731811f, -0.824589303f,
+    0.563199344f, -0.826321063f,
     0.560661576f, -0.828045045f,
+    0.558118531f, -0.829761234f,
     0.555570233f, -0.831469612f,
+    0.553016706f, -0.833170165f,
     0.550457973f, -0.834862875f,
+    0.547894059f, -0.836547727f,
     0.545324988f, -0.838224706f,
+    0.542750785f, -0.839893794f,
     0.540171473f, -0.841554977f,
+    0.537587076f, -0.843208240f,
     0.534997620f, -0.844853565f,
+    0.532403128f, -0.846490939f,
     0.529803625f, -0.848120345f,
+    0.527199135f, -0.849741768f,
     0.524589683f, -0.851355193f,
+    0.521975293f, -0.852960605f,
     0.519355990f, -0.854557988f,
+    0.516731799f, -0.856147328f,
     0.514102744f, -0.857728610f,
+    0.511468850f, -0.859301818f,
     0.508830143f, -0.860866939f,
+    0.506186645f, -0.862423956f,
     0.503538384f, -0.863972856f,
+    0.500885383f, -0.865513624f,
     0.498227667f, -0.867046246f,
+    0.495565262f, -0.868570706f,
     0.492898192f, -0.870086991f,
+    0.490226483f, -0.871595087f,
     0.487550160f, -0.873094978f,
+    0.484869248f, -0.874586652f,
     0.482183772f, -0.876070094f,
+    0.479493758f, -0.877545290f,
     0.476799230f, -0.879012226f,
+    0.474100215f, -0.880470889f,
     0.471396737f, -0.881921264f,
+    0.468688822f, -0.883363339f,
     0.465976496f, -0.884797098f,
+    0.463259784f, -0.886222530f,
     0.460538711f, -0.887639620f,
+    0.457813304f, -0.889048356f,
     0.455083587f, -0.890448723f,
+    0.452349587f, -0.891840709f,
     0.449611330f, -0.893224301f,
+    0.446868840f, -0.894599486f,
     0.444122145f, -0.895966250f,
+    0.441371269f, -0.897324581f,
     0.438616239f, -0.898674466f,
+    0.435857080f, -0.900015892f,
     0.433093819f, -0.901348847f,
+    0.430326481f, -0.902673318f,
     0.427555093f, -0.903989293f,
+    0.424779681f, -0.905296759f,
     0.422000271f, -0.906595705f,
+    0.419216888f, -0.907886116f,
     0.416429560f, -0.909167983f,
+    0.413638312f, -0.910441292f,
     0.410843171f, -0.911706032f,
+    0.408044163f, -0.912962190f,
     0.405241314f, -0.914209756f,
+    0.402434651f, -0.915448716f,
     0.399624200f, -0.916679060f,
+    0.396809987f, -0.917900776f,
     0.393992040f, -0.919113852f,
+    0.391170384f, -0.920318277f,
     0.388345047f, -0.921514039f,
+    0.385516054f, -0.922701128f,
     0.382683432f, -0.923879533f,
+    0.379847209f, -0.925049241f,
     0.377007410f, -0.926210242f,
+    0.374164063f, -0.927362526f,
     0.371317194f, -0.928506080f,
+    0.368466830f, -0.929640896f,
     0.365612998f, -0.930766961f,
+    0.362755724f, -0.931884266f,
     0.359895037f, -0.932992799f,
+    0.357030961f, -0.934092550f,
     0.354163525f, -0.935183510f,
+    0.351292756f, -0.936265667f,
     0.348418680f, -0.937339012f,
+    0.345541325f, -0.938403534f,
     0.342660717f, -0.939459224f,
+    0.339776884f, -0.940506071f,
     0.336889853f, -0.941544065f,
+    0.333999651f, -0.942573198f,
     0.331106306f, -0.943593458f,
+    0.328209844f, -0.944604837f,
     0.325310292f, -0.945607325f,
+    0.322407679f, -0.946600913f,
     0.319502031f, -0.947585591f,
+    0.316593376f, -0.948561350f,
     0.313681740f, -0.949528181f,
+    0.310767153f, -0.950486074f,
     0.307849640f, -0.951435021f,
+    0.304929230f, -0.952375013f,
     0.302005949f, -0.953306040f,
+    0.299079826f, -0.954228095f,
     0.296150888f, -0.955141168f,
+    0.293219163f, -0.956045251f,
     0.290284677f, -0.956940336f,
+    0.287347460f, -0.957826413f,
     0.284407537f, -0.958703475f,
+    0.281464938f, -0.959571513f,
     0.278519689f, -0.960430519f,
+    0.275571819f, -0.961280486f,
     0.272621355f, -0.962121404f,
+    0.269668326f, -0.962953267f,
     0.266712757f, -0.963776066f,
+    0.263754679f, -0.964589793f,
     0.260794118f, -0.965394442f,
+    0.257831102f, -0.966190003f,
     0.254865660f, -0.966976471f,
+    0.251897818f, -0.967753837f,
     0.248927606f, -0.968522094f,
+    0.245955050f, -0.969281235f,
     0.242980180f, -0.970031253f,
+    0.240003022f, -0.970772141f,
     0.237023606f, -0.971503891f,
+    0.234041959f, -0.972226497f,
     0.231058108f, -0.972939952f,
+    0.228072083f, -0.973644250f,
     0.225083911f, -0.974339383f,
+    0.222093621f, -0.975025345f,
     0.219101240f, -0.975702130f,
+    0.216106797f, -0.976369731f,
     0.213110320f, -0.977028143f,
+    0.210111837f, -0.977677358f,
     0.207111376f, -0.978317371f,
+    0.204108966f, -0.978948175f,
     0.201104635f, -0.979569766f,
+    0.198098411f, -0.980182136f,
     0.195090322f, -0.980785280f,
+    0.192080397f, -0.981379193f,
     0.189068664f, -0.981963869f,
+    0.186055152f, -0.982539302f,
     0.183039888f, -0.983105487f,
+    0.180022901f, -0.983662419f,
     0.177004220f, -0.984210092f,
+    0.173983873f, -0.984748502f,
     0.170961889f, -0.985277642f,
+    0.167938295f, -0.985797509f,
     0.164913120f, -0.986308097f,
+    0.161886394f, -0.986809402f,
     0.158858143f, -0.987301418f,
+    0.155828398f, -0.987784142f,
     0.152797185f, -0.988257568f,
+    0.149764535f, -0.988721692f,
     0.146730474f, -0.989176510f,
+    0.143695033f, -0.989622017f,
     0.140658239f, -0.990058210f,
+    0.137620122f, -0.990485084f,
     0.134580709f, -0.990902635f,
+    0.131540029f, -0.991310860f,
     0.128498111f, -0.991709754f,
+    0.125454983f, -0.992099313f,
     0.122410675f, -0.992479535f,
+    0.119365215f, -0.992850414f,
     0.116318631f, -0.993211949f,
+    0.113270952f, -0.993564136f,
     0.110222207f, -0.993906970f,
+    0.107172425f, -0.994240449f,
     0.104121634f, -0.994564571f,
+    0.101069863f, -0.994879331f,
     0.098017140f, -0.995184727f,
+    0.094963495f, -0.995480755f,
     0.091908956f, -0.995767414f,
+    0.088853553f, -0.996044701f,
     0.085797312f, -0.996312612f,
+    0.082740265f, -0.996571146f,
     0.079682438f, -0.996820299f,
+    0.076623861f, -0.997060070f,
     0.073564564f, -0.997290457f,
+    0.070504573f, -0.997511456f,
     0.067443920f, -0.997723067f,
+    0.064382631f, -0.997925286f,
     0.061320736f, -0.998118113f,
+    0.058258265f, -0.998301545f,
     0.055195244f, -0.998475581f,
+    0.052131705f, -0.998640218f,
     0.049067674f, -0.998795456f,
+    0.046003182f, -0.998941293f,
     0.042938257f, -0.999077728f,
+    0.039872928f, -0.999204759f,
     0.036807223f, -0.999322385f,
+    0.033741172f, -0.999430605f,
     0.030674803f, -0.999529418f,
+    0.027608146f, -0.999618822f,
     0.024541229f, -0.999698819f,
+    0.021474080f, -0.999769405f,
     0.018406730f, -0.999830582f,
+    0.015339206f, -0.999882347f,
     0.012271538f, -0.999924702f,
-    0.006135885f, -0.999981175f
+    0.009203755f, -0.999957645f,
+    0.006135885f, -0.999981175f,
+    0.003067957f, -0.999995294f
 };
+#endif
 
-const float32_t twiddleCoef_rfft_2048[2048] = {
+#if defined(ARM_TABLE_RFFT_F32_4096)
+const float32_t twiddleCoef_rfft_4096[4096] ARM_DSP_TABLE_ATTR = {
     0.000000000f,  1.000000000f,
+    0.001533980f,  0.999998823f,
     0.003067957f,  0.999995294f,
+    0.004601926f,  0.999989411f,
     0.006135885f,  0.999981175f,
+    0.007669829f,  0.999970586f,
     0.009203755f,  0.999957645f,
+    0.010737659f,  0.999942350f,
     0.012271538f,  0.999924702f,
+    0.013805389f,  0.999904701f,
     0.015339206f,  0.999882347f,
+    0.016872988f,  0.999857641f,
     0.018406730f,  0.999830582f,
+    0.019940429f,  0.999801170f,
     0.021474080f,  0.999769405f,
+    0.023007681f,  0.999735288f,
     0.024541229f,  0.999698819f,
+    0.026074718f,  0.999659997f,
     0.027608146f,  0.999618822f,
+    0.029141509f,  0.999575296f,
     0.030674803f,  0.999529418f,
+    0.032208025f,  0.999481187f,
     0.033741172f,  0.999430605f,
+    0.035274239f,  0.999377670f,
     0.036807223f,  0.999322385f,
+    0.038340120f,  0.999264747f,
     0.039872928f,  0.999204759f,
+    0.041405641f,  0.999142419f,
     0.042938257f,  0.999077728f,
+    0.044470772f,  0.999010686f,
     0.046003182f,  0.998941293f,
+    0.047535484f,  0.998869550f,
     0.049067674f,  0.998795456f,
+    0.050599749f,  0.998719012f,
     0.052131705f,  0.998640218f,
+    0.053663538f,  0.998559074f,
     0.055195244f,  0.998475581f,
+    0.056726821f,  0.998389737f,
     0.058258265f,  0.998301545f,
+    0.059789571f,  0.998211003f,
     0.061320736f,  0.998118113f,
+    0.062851758f,  0.998022874f,
     0.064382631f,  0.997925286f,
+    0.065913353f,  0.997825350f,
     0.067443920f,  0.997723067f,
+    0.068974328f,  0.997618435f,
     0.070504573f,  0.997511456f,
+    0.072034653f,  0.997402130f,
     0.073564564f,  0.997290457f,
+    0.075094301f,  0.997176437f,
     0.076623861f,  0.997060070f,
+    0.078153242f,  0.996941358f,
     0.079682438f,  0.996820299f,
+    0.081211447f,  0.996696895f,
     0.082740265f,  0.996571146f,
+    0.084268888f,  0.996443051f,
     0.085797312f,  0.996312612f,
+    0.087325535f,  0.996179829f,
     0.088853553f,  0.996044701f,
+    0.090381361f,  0.995907229f,
     0.091908956f,  0.995767414f,
+    0.093436336f,  0.995625256f,
     0.094963495f,  0.995480755f,
+    0.096490431f,  0.995333912f,
     0.098017140f,  0.995184727f,
+    0.099543619f,  0.995033199f,
     0.101069863f,  0.994879331f,
+    0.102595869f,  0.994723121f,
     0.104121634f,  0.994564571f,
+    0.105647154f,  0.994403680f,
     0.107172425f,  0.994240449f,
+    0.108697444f,  0.994074879f,
     0.110222207f,  0.993906970f,
+    0.111746711f,  0.993736722f,
     0.113270952f,  0.993564136f,
+    0.114794927f,  0.993389211f,
     0.116318631f,  0.993211949f,
+    0.117842062f,  0.993032350f,
     0.119365215f,  0.992850414f,
+    0.120888087f,  0.992666142f,
     0.122410675f,  0.992479535f,
+    0.123932975f,  0.992290591f,
     0.125454983f,  0.992099313f,
+    0.126976696f,  0.991905700f,
     0.128498111f,  0.991709754f,
+    0.130019223f,  0.991511473f,
     0.131540029f,  0.991310860f,
+    0.133060525f,  0.991107914f,
     0.134580709f,  0.990902635f,
+    0.136100575f,  0.990695025f,
     0.137620122f,  0.990485084f,
+    0.139139344f,  0.990272812f,
     0.140658239f,  0.990058210f,
+    0.142176804f,  0.989841278f,
     0.143695033f,  0.989622017f,
+    0.145212925f,  0.989400428f,
     0.146730474f,  0.989176510f,
+    0.148247679f,  0.988950265f,
     0.149764535f,  0.988721692f,
+    0.151281038f,  0.988490793f,
     0.152797185f,  0.988257568f,
+    0.154312973f,  0.988022017f,
     0.155828398f,  0.987784142f,
+    0.157343456f,  0.987543942f,
     0.158858143f,  0.987301418f,
+    0.160372457f,  0.987056571f,
     0.161886394f,  0.986809402f,
+    0.163399949f,  0.986559910f,
     0.164913120f,  0.986308097f,
+    0.166425904f,  0.986053963f,
     0.167938295f,  0.985797509f,
+    0.169450291f,  0.985538735f,
     0.170961889f,  0.985277642f,
+    0.172473084f,  0.985014231f,
     0.173983873f,  0.984748502f,
+    0.175494253f,  0.984480455f,
     0.177004220f,  0.984210092f,
+    0.178513771f,  0.983937413f,
     0.180022901f,  0.983662419f,
+    0.181531608f,  0.983385110f,
     0.183039888f,  0.983105487f,
+    0.184547737f,  0.982823551f,
     0.186055152f,  0.982539302f,
+    0.187562129f,  0.982252741f,
     0.189068664f,  0.981963869f,
+    0.190574755f,  0.981672686f,
     0.192080397f,  0.981379193f,
+    0.193585587f,  0.981083391f,
     0.195090322f,  0.980785280f,
+    0.196594598f,  0.980484862f,
     0.198098411f,  0.980182136f,
+    0.199601758f,  0.979877104f,
     0.201104635f,  0.979569766f,
+    0.202607039f,  0.979260123f,
     0.204108966f,  0.978948175f,
+    0.205610413f,  0.978633924f,
     0.207111376f,  0.978317371f,
+    0.208611852f,  0.977998515f,
     0.210111837f,  0.977677358f,
+    0.211611327f,  0.977353900f,
     0.213110320f,  0.977028143f,
+    0.214608811f,  0.976700086f,
     0.216106797f,  0.976369731f,
+    0.217604275f,  0.976037079f,
     0.219101240f,  0.975702130f,
+    0.220597690f,  0.975364885f,
     0.222093621f,  0.975025345f,
+    0.223589029f,  0.974683511f,
     0.225083911f,  0.974339383f,
+    0.226578264f,  0.973992962f,
     0.228072083f,  0.973644250f,
+    0.229565366f,  0.973293246f,
     0.231058108f,  0.972939952f,
+    0.232550307f,  0.972584369f,
     0.234041959f,  0.972226497f,
+    0.235533059f,  0.971866337f,
     0.237023606f,  0.971503891f,
+    0.238513595f,  0.971139158f,
     0.240003022f,  0.970772141f,
+    0.241491885f,  0.970402839f,
     0.242980180f,  0.970031253f,
+    0.244467903f,  0.969657385f,
     0.245955050f,  0.969281235f,
+    0.247441619f,  0.968902805f,
     0.248927606f,  0.968522094f,
+    0.250413007f,  0.968139105f,
     0.251897818f,  0.967753837f,
+    0.253382037f,  0.967366292f,
     0.254865660f,  0.966976471f,
+    0.256348682f,  0.966584374f,
     0.257831102f,  0.966190003f,
+    0.259312915f,  0.965793359f,
     0.260794118f,  0.965394442f,
+    0.262274707f,  0.964993253f,
     0.263754679f,  0.964589793f,
+    0.265234030f,  0.964184064f,
     0.266712757f,  0.963776066f,
+    0.268190857f,  0.963365800f,
     0.269668326f,  0.962953267f,
+    0.271145160f,  0.962538468f,
     0.272621355f,  0.962121404f,
+    0.274096910f,  0.961702077f,
     0.275571819f,  0.961280486f,
+    0.277046080f,  0.960856633f,
     0.278519689f,  0.960430519f,
+    0.279992643f,  0.960002146f,
     0.281464938f,  0.959571513f,
+    0.282936570f,  0.959138622f,
     0.284407537f,  0.958703475f,
+    0.285877835f,  0.958266071f,
     0.287347460f,  0.957826413f,
+    0.288816408f,  0.957384501f,
     0.290284677f,  0.956940336f,
+    0.291752263f,  0.956493919f,
     0.293219163f,  0.956045251f,
+    0.294685372f,  0.955594334f,
     0.296150888f,  0.955141168f,
+    0.297615707f,  0.954685755f,
     0.299079826f,  0.954228095f,
+    0.300543241f,  0.953768190f,
     0.302005949f,  0.953306040f,
+    0.303467947f,  0.952841648f,
     0.304929230f,  0.952375013f,
+    0.306389795f,  0.951906137f,
     0.307849640f,  0.951435021f,
+    0.309308760f,  0.950961666f,
     0.310767153f,  0.950486074f,
+    0.312224814f,  0.950008245f,
     0.313681740f,  0.949528181f,
+    0.315137929f,  0.949045882f,
     0.316593376f,  0.948561350f,
+    0.318048077f,  0.948074586f,
     0.319502031f,  0.947585591f,
+    0.320955232f,  0.947094366f,
     0.322407679f,  0.946600913f,
+    0.323859367f,  0.946105232f,
     0.325310292f,  0.945607325f,
+    0.326760452f,  0.945107193f,
     0.328209844f,  0.944604837f,
+    0.329658463f,  0.944100258f,
     0.331106306f,  0.943593458f,
+    0.332553370f,  0.943084437f,
     0.333999651f,  0.942573198f,
+    0.335445147f,  0.942059740f,
     0.336889853f,  0.941544065f,
+    0.338333767f,  0.941026175f,
     0.339776884f,  0.940506071f,
+    0.341219202f,  0.939983753f,
     0.342660717f,  0.939459224f,
+    0.344101426f,  0.938932484f,
     0.345541325f,  0.938403534f,
+    0.346980411f,  0.937872376f,
     0.348418680f,  0.937339012f,
+    0.349856130f,  0.936803442f,
     0.351292756f,  0.936265667f,
+    0.352728556f,  0.935725689f,
     0.354163525f,  0.935183510f,
+    0.355597662f,  0.934639130f,
     0.357030961f,  0.934092550f,
+    0.358463421f,  0.933543773f,
     0.359895037f,  0.932992799f,
+    0.361325806f,  0.932439629f,
     0.362755724f,  0.931884266f,
+    0.364184790f,  0.931326709f,
     0.365612998f,  0.930766961f,
+    0.367040346f,  0.930205023f,
     0.368466830f,  0.929640896f,
+    0.369892447f,  0.929074581f,
     0.371317194f,  0.928506080f,
+    0.372741067f,  0.927935395f,
     0.374164063f,  0.927362526f,
+    0.375586178f,  0.926787474f,
     0.377007410f,  0.926210242f,
+    0.378427755f,  0.925630831f,
     0.379847209f,  0.925049241f,
+    0.381265769f,  0.924465474f,
     0.382683432f,  0.923879533f,
+    0.384100195f,  0.923291417f,
     0.385516054f,  0.922701128f,
+    0.386931006f,  0.922108669f,
     0.388345047f,  0.921514039f,
+    0.389758174f,  0.920917242f,
     0.391170384f,  0.920318277f,
+    0.392581674f,  0.919717146f,
     0.393992040f,  0.919113852f,
+    0.395401479f,  0.918508394f,
     0.396809987f,  0.917900776f,
+    0.398217562f,  0.917290997f,
     0.399624200f,  0.916679060f,
+    0.401029897f,  0.916064966f,
     0.402434651f,  0.915448716f,
+    0.403838458f,  0.914830312f,
     0.405241314f,  0.914209756f,
+    0.406643217f,  0.913587048f,
     0.408044163f,  0.912962190f,
+    0.409444149f,  0.912335185f,
     0.410843171f,  0.911706032f,
+    0.412241227f,  0.911074734f,
     0.413638312f,  0.910441292f,
+    0.415034424f,  0.909805708f,
     0.416429560f,  0.909167983f,
+    0.417823716f,  0.908528119f,
     0.419216888f,  0.907886116f,
+    0.420609074f,  0.907241978f,
     0.422000271f,  0.906595705f,
+    0.423390474f,  0.905947298f,
     0.424779681f,  0.905296759f,
+    0.426167889f,  0.904644091f,
     0.427555093f,  0.903989293f,
+    0.428941292f,  0.903332368f,
     0.430326481f,  0.902673318f,
+    0.431710658f,  0.902012144f,
     0.433093819f,  0.901348847f,
+    0.434475961f,  0.900683429f,
     0.435857080f,  0.900015892f,
+    0.437237174f,  0.899346237f,
     0.438616239f,  0.898674466f,
+    0.439994271f,  0.898000580f,
     0.441371269f,  0.897324581f,
+    0.442747228f,  0.896646470f,
     0.444122145f,  0.895966250f,
+    0.445496017f,  0.895283921f,
     0.446868840f,  0.894599486f,
+    0.448240612f,  0.893912945f,
     0.449611330f,  0.893224301f,
+    0.450980989f,  0.892533555f,
     0.452349587f,  0.891840709f,
+    0.453717121f,  0.891145765f,
     0.455083587f,  0.890448723f,
+    0.456448982f,  0.889749586f,
     0.457813304f,  0.889048356f,
+    0.459176548f,  0.888345033f,
     0.460538711f,  0.887639620f,
+    0.461899791f,  0.886932119f,
     0.463259784f,  0.886222530f,
+    0.464618686f,  0.885510856f,
     0.465976496f,  0.884797098f,
+    0.467333209f,  0.884081259f,
     0.468688822f,  0.883363339f,
+    0.470043332f,  0.882643340f,
     0.471396737f,  0.881921264f,
+    0.472749032f,  0.881197113f,
     0.474100215f,  0.880470889f,
+    0.475450282f,  0.879742593f,
     0.476799230f,  0.879012226f,
+    0.478147056f,  0.878279792f,
     0.479493758f,  0.877545290f,
+    0.480839331f,  0.876808724f,
     0.482183772f,  0.876070094f,
+    0.483527079f,  0.875329403f,
     0.484869248f,  0.874586652f,
+    0.486210276f,  0.873841843f,
     0.487550160f,  0.873094978f,
+    0.488888897f,  0.872346059f,
     0.490226483f,  0.871595087f,
+    0.491562916f,  0.870842063f,
     0.492898192f,  0.870086991f,
+    0.494232309f,  0.869329871f,
     0.495565262f,  0.868570706f,
+    0.496897049f,  0.867809497f,
     0.498227667f,  0.867046246f,
+    0.499557113f,  0.866280954f,
     0.500885383f,  0.865513624f,
+    0.502212474f,  0.864744258f,
     0.503538384f,  0.863972856f,
+    0.504863109f,  0.863199422f,
     0.506186645f,  0.862423956f,
+    0.507508991f,  0.861646461f,
     0.508830143f,  0.860866939f,
+    0.510150097f,  0.860085390f,
     0.511468850f,  0.859301818f,
+    0.512786401f,  0.858516224f,
     0.514102744f,  0.857728610f,
+    0.515417878f,  0.856938977f,
     0.516731799f,  0.856147328f,
+    0.518044504f,  0.855353665f,
     0.519355990f,  0.854557988f,
+    0.520666254f,  0.853760301f,
     0.521975293f,  0.852960605f,
+    0.523283103f,  0.852158902f,
     0.524589683f,  0.851355193f,
+    0.525895027f,  0.850549481f,
     0.527199135f,  0.849741768f,
+    0.528502002f,  0.848932055f,
     0.529803625f,  0.848120345f,
+    0.531104001f,  0.847306639f,
     0.532403128f,  0.846490939f,
+    0.533701002f,  0.845673247f,
     0.534997620f,  0.844853565f,
+    0.536292979f,  0.844031895f,
     0.537587076f,  0.843208240f,
+    0.538879909f,  0.842382600f,
     0.540171473f,  0.841554977f,
+    0.541461766f,  0.840725375f,
     0.542750785f,  0.839893794f,
+    0.544038527f,  0.839060237f,
     0.545324988f,  0.838224706f,
+    0.546610167f,  0.837387202f,
     0.547894059f,  0.836547727f,
+    0.549176662f,  0.835706284f,
     0.550457973f,  0.834862875f,
+    0.551737988f,  0.834017501f,
     0.553016706f,  0.833170165f,
+    0.554294121f,  0.832320868f,
     0.555570233f,  0.831469612f,
+    0.556845037f,  0.830616400f,
     0.558118531f,  0.829761234f,
+    0.559390712f,  0.828904115f,
     0.560661576f,  0.828045045f,
+    0.561931121f,  0.827184027f,
     0.563199344f,  0.826321063f,
+    0.564466242f,  0.825456154f,
     0.565731811f,  0.824589303f,
+    0.566996049f,  0.823720511f,
     0.568258953f,  0.822849781f,
+    0.569520519f,  0.821977115f,
     0.570780746f,  0.821102515f,
+    0.572039629f,  0.820225983f,
     0.573297167f,  0.819347520f,
+    0.574553355f,  0.818467130f,
     0.575808191f,  0.817584813f,
+    0.577061673f,  0.816700573f,
     0.578313796f,  0.815814411f,
+    0.579564559f,  0.814926329f,
     0.580813958f,  0.814036330f,
+    0.582061990f,  0.813144415f,
     0.583308653f,  0.812250587f,
+    0.584553943f,  0.811354847f,
     0.585797857f,  0.810457198f,
+    0.587040394f,  0.809557642f,
     0.588281548f,  0.808656182f,
+    0.589521319f,  0.807752818f,
     0.590759702f,  0.806847554f,
+    0.591996695f,  0.805940391f,
     0.593232295f,  0.805031331f,
+    0.594466499f,  0.804120377f,
     0.595699304f,  0.803207531f,
+    0.596930708f,  0.802292796f,
     0.598160707f,  0.801376172f,
+    0.599389298f,  0.800457662f,
     0.600616479f,  0.799537269f,
+    0.601842247f,  0.798614995f,
     0.603066599f,  0.797690841f,
+    0.604289531f,  0.796764810f,
     0.605511041f,  0.795836905f,
+    0.606731127f,  0.794907126f,
     0.607949785f,  0.793975478f,
+    0.609167012f,  0.793041960f,
     0.610382806f,  0.792106577f,
+    0.611597164f,  0.791169330f,
     0.612810082f,  0.790230221f,
+    0.614021559f,  0.789289253f,
     0.615231591f,  0.788346428f,
+    0.616440175f,  0.787401747f,
     0.617647308f,  0.786455214f,
+    0.618852988f,  0.785506830f,
     0.620057212f,  0.784556597f,
+    0.621259977f,  0.783604519f,
     0.622461279f,  0.782650596f,
+    0.623661118f,  0.781694832f,
     0.624859488f,  0.780737229f,
+    0.626056388f,  0.779777788f,
     0.627251815f,  0.778816512f,
+    0.628445767f,  0.777853404f,
     0.629638239f,  0.776888466f,
+    0.630829230f,  0.775921699f,
     0.632018736f,  0.774953107f,
+    0.633206755f,  0.773982691f,
     0.634393284f,  0.773010453f,
+    0.635578320f,  0.772036397f,
     0.636761861f,  0.771060524f,
+    0.637943904f,  0.770082837f,
     0.639124445f,  0.769103338f,
+    0.640303482f,  0.768122029f,
     0.641481013f,  0.767138912f,
+    0.642657034f,  0.766153990f,
     0.643831543f,  0.765167266f,
+    0.645004537f,  0.764178741f,
     0.646176013f,  0.763188417f,
+    0.647345969f,  0.762196298f,
     0.648514401f,  0.761202385f,
+    0.649681307f,  0.760206682f,
     0.650846685f,  0.759209189f,
+    0.652010531f,  0.758209910f,
     0.653172843f,  0.757208847f,
+    0.654333618f,  0.756206001f,
     0.655492853f,  0.755201377f,
+    0.656650546f,  0.754194975f,
     0.657806693f,  0.753186799f,
+    0.658961293f,  0.752176850f,
     0.660114342f,  0.751165132f,
+    0.661265838f,  0.750151646f,
     0.662415778f,  0.749136395f,
+    0.663564159f,  0.748119380f,
     0.664710978f,  0.747100606f,
+    0.665856234f,  0.746080074f,
     0.666999922f,  0.745057785f,
+    0.668142041f,  0.744033744f,
     0.669282588f,  0.743007952f,
+    0.670421560f,  0.741980412f,
     0.671558955f,  0.740951125f,
+    0.672694769f,  0.739920095f,
     0.673829000f,  0.738887324f,
+    0.674961646f,  0.737852815f,
     0.676092704f,  0.736816569f,
+    0.677222170f,  0.735778589f,
     0.678350043f,  0.734738878f,
+    0.679476320f,  0.733697438f,
     0.680600998f,  0.732654272f,
+    0.681724074f,  0.731609381f,
     0.682845546f,  0.730562769f,
+    0.683965412f,  0.729514438f,
     0.685083668f,  0.728464390f,
+    0.686200312f,  0.727412629f,
     0.687315341f,  0.726359155f,
+    0.688428753f,  0.725303972f,
     0.689540545f,  0.724247083f,
+    0.690650714f,  0.723188489f,
     0.691759258f,  0.722128194f,
+    0.692866175f,  0.721066199f,
     0.693971461f,  0.720002508f,
+    0.695075114f,  0.718937122f,
     0.696177131f,  0.717870045f,
+    0.697277511f,  0.716801279f,
     0.698376249f,  0.715730825f,
+    0.699473345f,  0.714658688f,
     0.700568794f,  0.713584869f,
+    0.701662595f,  0.712509371f,
     0.702754744f,  0.711432196f,
+    0.703845241f,  0.710353347f,
     0.704934080f,  0.709272826f,
+    0.706021261f,  0.708190637f,
     0.707106781f,  0.707106781f,
+    0.708190637f,  0.706021261f,
     0.709272826f,  0.704934080f,
+    0.710353347f,  0.703845241f,
     0.711432196f,  0.702754744f,
+    0.712509371f,  0.701662595f,
     0.713584869f,  0.700568794f,
+    0.714658688f,  0.699473345f,
     0.715730825f,  0.698376249f,
+    0.716801279f,  0.697277511f,
     0.717870045f,  0.696177131f,
+    0.718937122f,  0.695075114f,
     0.720002508f,  0.693971461f,
+    0.721066199f,  0.692866175f,
     0.722128194f,  0.691759258f,
+    0.723188489f,  0.690650714f,
     0.724247083f,  0.689540545f,
+    0.725303972f,  0.688428753f,
     0.726359155f,  0.687315341f,
+    0.727412629f,  0.686200312f,
     0.728464390f,  0.685083668f,
+    0.729514438f,  0.683965412f,
     0.730562769f,  0.682845546f,
+    0.731609381f,  0.681724074f,
     0.732654272f,  0.680600998f,
+    0.733697438f,  0.679476320f,
     0.734738878f,  0.678350043f,
+    0.735778589f,  0.677222170f,
     0.736816569f,  0.676092704f,
+    0.737852815f,  0.674961646f,
     0.738887324f,  0.673829000f,
+    0.739920095f,  0.672694769f,
     0.740951125f,  0.671558955f,
+    0.741980412f,  0.670421560f,
     0.743007952f,  0.669282588f,
+    0.744033744f,  0.668142041f,
     0.745057785f,  0.666999922f,
+    0.746080074f,  0.665856234f,
     0.747100606f,  0.664710978f,
+    0.748119380f,  0.663564159f,
     0.749136395f,  0.662415778f,
+    0.750151646f,  0.661265838f,
     0.751165132f,  0.660114342f,
+    0.752176850f,  0.658961293f,
     0.753186799f,  0.657806693f,
+    0.754194975f,  0.656650546f,
     0.755201377f,  0.655492853f,
+    0.756206001f,  0.654333618f,
     0.757208847f,  0.653172843f,
+    0.758209910f,  0.652010531f,
     0.759209189f,  0.650846685f,
+    0.760206682f,  0.649681307f,
     0.761202385f,  0.648514401f,
+    0.762196298f,  0.647345969f,
     0.763188417f,  0.646176013f,
+    0.764178741f,  0.645004537f,
     0.765167266f,  0.643831543f,
+    0.766153990f,  0.642657034f,
     0.767138912f,  0.641481013f,
+    0.768122029f,  0.640303482f,
     0.769103338f,  0.639124445f,
+    0.770082837f,  0.637943904f,
     0.771060524f,  0.636761861f,
+    0.772036397f,  0.635578320f,
     0.773010453f,  0.634393284f,
+    0.773982691f,  0.633206755f,
     0.774953107f,  0.632018736f,
+    0.775921699f,  0.630829230f,
     0.776888466f,  0.629638239f,
+    0.777853404f,  0.628445767f,
     0.778816512f,  0.627251815f,
+    0.779777788f,  0.626056388f,
     0.780737229f,  0.624859488f,
+    0.781694832f,  0.623661118f,
     0.782650596f,  0.622461279f,
+    0.783604519f,  0.621259977f,
     0.784556597f,  0.620057212f,
+    0.785506830f,  0.618852988f,
     0.786455214f,  0.617647308f,
+    0.787401747f,  0.616440175f,
     0.788346428f,  0.615231591f,
+    0.789289253f,  0.614021559f,
     0.790230221f,  0.612810082f,
+    0.791169330f,  0.611597164f,
     0.792106577f,  0.610382806f,
+    0.793041960f,  0.609167012f,
     0.793975478f,  0.607949785f,
+    0.794907126f,  0.606731127f,
     0.795836905f,  0.605511041f,
+    0.796764810f,  0.604289531f,
     0.797690841f,  0.603066599f,
+    0.798614995f,  0.601842247f,
     0.799537269f,  0.600616479f,
+    0.800457662f,  0.599389298f,
     0.801376172f,  0.598160707f,
+    0.802292796f,  0.596930708f,
     0.803207531f,  0.595699304f,
+    0.804120377f,  0.594466499f,
     0.805031331f,  0.593232295f,
+    0.805940391f,  0.591996695f,
     0.806847554f,  0.590759702f,
+    0.807752818f,  0.589521319f,
     0.808656182f,  0.588281548f,
+    0.809557642f,  0.587040394f,
     0.810457198f,  0.585797857f,
+    0.811354847f,  0.584553943f,
     0.812250587f,  0.583308653f,
+    0.813144415f,  0.582061990f,
     0.814036330f,  0.580813958f,
+    0.814926329f,  0.579564559f,
     0.815814411f,  0.578313796f,
+    0.816700573f,  0.577061673f,
     0.817584813f,  0.575808191f,
+    0.818467130f,  0.574553355f,
     0.819347520f,  0.573297167f,
+    0.820225983f,  0.572039629f,
     0.821102515f,  0.570780746f,
+    0.821977115f,  0.569520519f,
     0.822849781f,  0.568258953f,
+    0.823720511f,  0.566996049f,
     0.824589303f,  0.565731811f,
+    0.825456154f,  0.564466242f,
     0.826321063f,  0.563199344f,
+    0.827184027f,  0.561931121f,
     0.828045045f,  0.560661576f,
+    0.828904115f,  0.559390712f,
     0.829761234f,  0.558118531f,
+    0.830616400f,  0.556845037f,
     0.831469612f,  0.555570233f,
+    0.832320868f,  0.554294121f,
     0.833170165f,  0.553016706f,
+    0.834017501f,  0.551737988f,
     0.834862875f,  0.550457973f,
+    0.835706284f,  0.549176662f,
     0.836547727f,  0.547894059f,
+    0.837387202f,  0.546610167f,
     0.838224706f,  0.545324988f,
+    0.839060237f,  0.544038527f,
     0.839893794f,  0.542750785f,
+    0.840725375f,  0.541461766f,
     0.841554977f,  0.540171473f,
+    0.842382600f,  0.538879909f,
     0.843208240f,  0.537587076f,
+    0.844031895f,  0.536292979f,
     0.844853565f,  0.534997620f,
+    0.845673247f,  0.533701002f,
     0.846490939f,  0.532403128f,
+    0.847306639f,  0.531104001f,
     0.848120345f,  0.529803625f,
+    0.848932055f,  0.528502002f,
     0.849741768f,  0.527199135f,
+    0.850549481f,  0.525895027f,
     0.851355193f,  0.524589683f,
+    0.852158902f,  0.523283103f,
     0.852960605f,  0.521975293f,
+    0.853760301f,  0.520666254f,
     0.854557988f,  0.519355990f,
+    0.855353665f,  0.518044504f,
     0.856147328f,  0.516731799f,
+    0.856938977f,  0.515417878f,
     0.857728610f,  0.514102744f,
+    0.858516224f,  0.512786401f,
     0.859301818f,  0.511468850f,
+    0.860085390f,  0.510150097f,
     0.860866939f,  0.508830143f,
+    0.861646461f,  0.507508991f,
     0.862423956f,  0.506186645f,
+    0.863199422f,  0.504863109f,
     0.863972856f,  0.503538384f,
+    0.864744258f,  0.502212474f,
     0.865513624f,  0.500885383f,
+    0.866280954f,  0.499557113f,
     0.867046246f,  0.498227667f,
+    0.867809497f,  0.496897049f,
     0.868570706f,  0.495565262f,
+    0.869329871f,  0.494232309f,
     0.870086991f,  0.492898192f,
+    0.870842063f,  0.491562916f,
     0.871595087f,  0.490226483f,
+    0.872346059f,  0.488888897f,
     0.873094978f,  0.487550160f,
+    0.873841843f,  0.486210276f,
     0.874586652f,  0.484869248f,
+    0.875329403f,  0.483527079f,
     0.876070094f,  0.482183772f,
+    0.876808724f,  0.480839331f,
     0.877545290f,  0.479493758f,
+    0.878279792f,  0.478147056f,
     0.879012226f,  0.476799230f,
+    0.879742593f,  0.475450282f,
     0.880470889f,  0.474100215f,
+    0.881197113f,  0.472749032f,
     0.881921264f,  0.471396737f,
+    0.882643340f,  0.470043332f,
     0.883363339f,  0.468688822f,
+    0.884081259f,  0.467333209f,
     0.884797098f,  0.465976496f,
+    0.885510856f,  0.464618686f,
     0.886222530f,  0.463259784f,
+    0.886932119f,  0.461899791f,
     0.887639620f,  0.460538711f,
+    0.888345033f,  0.459176548f,
     0.889048356f,  0.457813304f,
+    0.889749586f,  0.456448982f,
     0.890448723f,  0.455083587f,
+    0.891145765f,  0.453717121f,
     0.891840709f,  0.452349587f,
+    0.892533555f,  0.450980989f,
     0.893224301f,  0.449611330f,
+    0.893912945f,  0.448240612f,
     0.894599486f,  0.446868840f,
+    0.895283921f,  0.445496017f,
     0.895966250f,  0.444122145f,
+    0.896646470f,  0.442747228f,
     0.897324581f,  0.441371269f,
+    0.898000580f,  0.439994271f,
     0.898674466f,  0.438616239f,
+    0.899346237f,  0.437237174f,
     0.900015892f,  0.435857080f,
+    0.900683429f,  0.434475961f,
     0.901348847f,  0.433093819f,
+    0.902012144f,  0.431710658f,
     0.902673318f,  0.430326481f,
+    0.903332368f,  0.428941292f,
     0.903989293f,  0.427555093f,
+    0.904644091f,  0.426167889f,
     0.905296759f,  0.424779681f,
+    0.905947298f,  0.423390474f,
     0.906595705f,  0.422000271f,
+    0.907241978f,  0.420609074f,
     0.907886116f,  0.419216888f,
+    0.908528119f,  0.417823716f,
     0.909167983f,  0.416429560f,
+    0.909805708f,  0.415034424f,
     0.910441292f,  0.413638312f,
+    0.911074734f,  0.412241227f,
     0.911706032f,  0.410843171f,
+    0.912335185f,  0.409444149f,
     0.912962190f,  0.408044163f,
+    0.913587048f,  0.406643217f,
     0.914209756f,  0.405241314f,
+    0.914830312f,  0.403838458f,
     0.915448716f,  0.402434651f,
+    0.916064966f,  0.401029897f,
     0.916679060f,  0.399624200f,
+    0.917290997f,  0.398217562f,
     0.917900776f,  0.396809987f,
+    0.918508394f,  0.395401479f,
     0.919113852f,  0.393992040f,
+    0.919717146f,  0.392581674f,
     0.920318277f,  0.391170384f,
+    0.920917242f,  0.389758174f,
     0.921514039f,  0.388345047f,
+    0.922108669f,  0.386931006f,
     0.922701128f,  0.385516054f,
+    0.923291417f,  0.384100195f,
     0.923879533f,  0.382683432f,
+    0.924465474f,  0.381265769f,
     0.925049241f,  0.379847209f,
+    0.925630831f,  0.378427755f,
     0.926210242f,  0.377007410f,
+    0.926787474f,  0.375586178f,
     0.927362526f,  0.374164063f,
+    0.927935395f,  0.372741067f,
     0.928506080f,  0.371317194f,
+    0.929074581f,  0.369892447f,
     0.929640896f,  0.368466830f,
+    0.930205023f,  0.367040346f,
     0.930766961f,  0.365612998f,
+    0.931326709f,  0.364184790f,
     0.931884266f,  0.362755724f,
+    0.932439629f,  0.361325806f,
     0.932992799f,  0.359895037f,
+    0.933543773f,  0.358463421f,
     0.934092550f,  0.357030961f,
+    0.934639130f,  0.355597662f,
     0.935183510f,  0.354163525f,
+    0.935725689f,  0.352728556f,
     0.936265667f,  0.351292756f,
+    0.936803442f,  0.349856130f,
     0.937339012f,  0.348418680f,
+    0.937872376f,  0.346980411f,
     0.938403534f,  0.345541325f,
+    0.938932484f,  0.344101426f,
     0.939459224f,  0.342660717f,
+    0.939983753f,  0.341219202f,
     0.940506071f,  0.339776884f,
+    0.941026175f,  0.338333767f,
     0.941544065f,  0.336889853f,
+    0.942059740f,  0.335445147f,
     0.942573198f,  0.333999651f,
+    0.943084437f,  0.332553370f,
     0.943593458f,  0.331106306f,
+    0.944100258f,  0.329658463f,
     0.944604837f,  0.328209844f,
+    0.945107193f,  0.326760452f,
     0.945607325f,  0.325310292f,
+    0.946105232f,  0.323859367f,
     0.946600913f,  0.322407679f,
+    0.947094366f,  0.320955232f,
     0.947585591f,  0.319502031f,
+    0.948074586f,  0.318048077f,
     0.948561350f,  0.316593376f,
+    0.949045882f,  0.315137929f,
     0.949528181f,  0.313681740f,
+    0.950008245f,  0.312224814f,
     0.950486074f,  0.310767153f,
+    0.950961666f,  0.309308760f,
     0.951435021f,  0.307849640f,
+    0.951906137f,  0.306389795f,
     0.952375013f,  0.304929230f,
+    0.952841648f,  0.303467947f,
     0.953306040f,  0.302005949f,
+    0.953768190f,  0.300543241f,
     0.954228095f,  0.299079826f,
+    0.954685755f,  0.297615707f,
     0.955141168f,  0.296150888f,
+    0.955594334f,  0.294685372f,
     0.956045251f,  0.293219163f,
+    0.956493919f,  0.291752263f,
     0.956940336f,  0.290284677f,
+    0.957384501f,  0.288816408f,
     0.957826413f,  0.287347460f,
+    0.958266071f,  0.285877835f,
     0.958703475f,  0.284407537f,
+    0.959138622f,  0.282936570f,
     0.959571513f,  0.281464938f,
+    0.960002146f,  0.279992643f,
     0.960430519f,  0.278519689f,
+    0.960856633f,  0.277046080f,
     0.961280486f,  0.275571819f,
+    0.961702077f,  0.274096910f,
     0.962121404f,  0.272621355f,
+    0.962538468f,  0.271145160f,
     0.962953267f,  0.269668326f,
+    0.963365800f,  0.268190857f,
     0.963776066f,  0.266712757f,
+    0.964184064f,  0.265234030f,
     0.964589793f,  0.263754679f,
+    0.964993253f,  0.262274707f,
     0.965394442f,  0.260794118f,
+    0.965793359f,  0.259312915f,
     0.966190003f,  0.257831102f,
+    0.966584374f,  0.256348682f,
     0.966976471f,  0.254865660f,
+    0.967366292f,  0.253382037f,
     0.967753837f,  0.251897818f,
+    0.968139105f,  0.250413007f,
     0.968522094f,  0.248927606f,
+    0.968902805f,  0.247441619f,
     0.969281235f,  0.245955050f,
+    0.969657385f,  0.244467903f,
     0.970031253f,  0.242980180f,
+    0.970402839f,  0.241491885f,
     0.970772141f,  0.240003022f,
+    0.971139158f,  0.238513595f,
     0.971503891f,  0.237023606f,
+    0.971866337f,  0.235533059f,
     0.972226497f,  0.234041959f,
+    0.972584369f,  0.232550307f,
     0.972939952f,  0.231058108f,
+    0.973293246f,  0.229565366f,
     0.973644250f,  0.228072083f,
+    0.973992962f,  0.226578264f,
     0.974339383f,  0.225083911f,
+    0.974683511f,  0.223589029f,
     0.975025345f,  0.222093621f,
+    0.975364885f,  0.220597690f,
     0.975702130f,  0.219101240f,
+    0.976037079f,  0.217604275f,
     0.976369731f,  0.216106797f,
+    0.976700086f,  0.214608811f,
     0.977028143f,  0.213110320f,
+    0.977353900f,  0.211611327f,
     0.977677358f,  0.210111837f,
+    0.977998515f,  0.208611852f,
     0.978317371f,  0.207111376f,
+    0.978633924f,  0.205610413f,
     0.978948175f,  0.204108966f,
+    0.979260123f,  0.202607039f,
     0.979569766f,  0.201104635f,
+    0.979877104f,  0.199601758f,
     0.980182136f,  0.198098411f,
+    0.980484862f,  0.196594598f,
     0.980785280f,  0.195090322f,
+    0.981083391f,  0.193585587f,
     0.981379193f,  0.192080397f,
+    0.981672686f,  0.190574755f,
     0.981963869f,  0.189068664f,
+    0.982252741f,  0.187562129f,
     0.982539302f,  0.186055152f,
+    0.982823551f,  0.184547737f,
     0.983105487f,  0.183039888f,
+    0.983385110f,  0.181531608f,
     0.983662419f,  0.180022901f,
+    0.983937413f,  0.178513771f,
     0.984210092f,  0.177004220f,
+    0.984480455f,  0.175494253f,
     0.984748502f,  0.173983873f,
+    0.985014231f,  0.172473084f,
     0.985277642f,  0.170961889f,
+    0.985538735f,  0.169450291f,
     0.985797509f,  0.167938295f,
+    0.986053963f,  0.166425904f,
     0.986308097f,  0.164913120f,
+    0.986559910f,  0.163399949f,
     0.986809402f,  0.161886394f,
+    0.987056571f,  0.160372457f,
     0.987301418f,  0.158858143f,
+    0.987543942f,  0.157343456f,
     0.987784142f,  0.155828398f,
+    0.988022017f,  0.154312973f,
     0.988257568f,  0.152797185f,
+    0.988490793f,  0.151281038f,
     0.988721692f,  0.149764535f,
+    0.988950265f,  0.148247679f,
     0.989176510f,  0.146730474f,
+    0.989400428f,  0.145212925f,
     0.989622017f,  0.143695033f,
+    0.989841278f,  0.142176804f,
     0.990058210f,  0.140658239f,
+    0.990272812f,  0.139139344f,
     0.990485084f,  0.137620122f,
+    0.990695025f,  0.136100575f,
     0.990902635f,  0.134580709f,
+    0.991107914f,  0.133060525f,
     0.991310860f,  0.131540029f,
+    0.991511473f,  0.130019223f,
     0.991709754f,  0.128498111f,
+    0.991905700f,  0.126976696f,
     0.992099313f,  0.125454983f,
+    0.992290591f,  0.123932975f,
     0.992479535f,  0.122410675f,
+    0.992666142f,  0.120888087f,
     0.992850414f,  0.119365215f,
+    0.993032350f,  0.117842062f,
     0.993211949f,  0.116318631f,
+    0.993389211f,  0.114794927f,
     0.993564136f,  0.113270952f,
+    0.993736722f,  0.111746711f,
     0.993906970f,  0.110222207f,
+    0.994074879f,  0.108697444f,
     0.994240449f,  0.107172425f,
+    0.994403680f,  0.105647154f,
     0.994564571f,  0.104121634f,
+    0.994723121f,  0.102595869f,
     0.994879331f,  0.101069863f,
+    0.995033199f,  0.099543619f,
     0.995184727f,  0.098017140f,
+    0.995333912f,  0.096490431f,
     0.995480755f,  0.094963495f,
+    0.995625256f,  0.093436336f,
     0.995767414f,  0.091908956f,
+    0.995907229f,  0.090381361f,
     0.996044701f,  0.088853553f,
+    0.996179829f,  0.087325535f,
     0.996312612f,  0.085797312f,
+    0.996443051f,  0.084268888f,
     0.996571146f,  0.082740265f,
+    0.996696895f,  0.081211447f,
     0.996820299f,  0.079682438f,
+    0.996941358f,  0.078153242f,
     0.997060070f,  0.076623861f,
+    0.997176437f,  0.075094301f,
     0.997290457f,  0.073564564f,
+    0.997402130f,  0.072034653f,
     0.997511456f,  0.070504573f,
+    0.997618435f,  0.068974328f,
     0.997723067f,  0.067443920f,
+    0.997825350f,  0.065913353f,
     0.997925286f,  0.064382631f,
+    0.998022874f,  0.062851758f,
     0.998118113f,  0.061320736f,
+    0.998211003f,  0.059789571f,
     0.998301545f,  0.058258265f,
+    0.998389737f,  0.056726821f,
     0.998475581f,  0.055195244f,
+    0.998559074f,  0.053663538f,
     0.998640218f,  0.052131705f,
+    0.998719012f,  0.050599749f,
     0.998795456f,  0.049067674f,
+    0.998869550f,  0.047535484f,
     0.998941293f,  0.046003182f,
+    0.999010686f,  0.044470772f,
     0.999077728f,  0.042938257f,
+    0.999142419f,  0.041405641f,
     0.999204759f,  0.039872928f,
+    0.999264747f,  0.038340120f,
     0.999322385f,  0.036807223f,
+    0.999377670f,  0.035274239f,
     0.999430605f,  0.033741172f,
+    0.999481187f,  0.032208025f,
     0.999529418f,  0.030674803f,
+    0.999575296f,  0.029141509f,
     0.999618822f,  0.027608146f,
+    0.999659997f,  0.026074718f,
     0.999698819f,  0.024541229f,
+    0.999735288f,  0.023007681f,
     0.999769405f,  0.021474080f,
+    0.999801170f,  0.019940429f,
     0.999830582f,  0.018406730f,
+    0.999857641f,  0.016872988f,
     0.999882347f,  0.015339206f,
+    0.999904701f,  0.013805389f,
     0.999924702f,  0.012271538f,
+    0.999942350f,  0.010737659f,
     0.999957645f,  0.009203755f,
+    0.999970586f,  0.007669829f,
     0.999981175f,  0.006135885f,
+    0.999989411f,  0.004601926f,
     0.999995294f,  0.003067957f,
+    0.999998823f,  0.001533980f,
     1.000000000f,  0.000000000f,
+    0.999998823f, -0.001533980f,
     0.999995294f, -0.003067957f,
+    0.999989411f, -0.004601926f,
     0.999981175f, -0.006135885f,
+    0.999970586f, -0.007669829f,
     0.999957645f, -0.009203755f,
+    0.999942350f, -0.010737659f,
     0.999924702f, -0.012271538f,
+    0.999904701f, -0.013805389f,
     0.999882347f, -0.015339206f,
+    0.999857641f, -0.016872988f,
     0.999830582f, -0.018406730f,
+    0.999801170f, -0.019940429f,
     0.999769405f, -0.021474080f,
+    0.999735288f, -0.023007681f,
     0.999698819f, -0.024541229f,
+    0.999659997f, -0.026074718f,
     0.999618822f, -0.027608146f,
+    0.999575296f, -0.029141509f,
     0.999529418f, -0.030674803f,
+    0.999481187f, -0.032208025f,
     0.999430605f, -0.033741172f,
+    0.999377670f, -0.035274239f,
     0.999322385f, -0.036807223f,
+    0.999264747f, -0.038340120f,
     0.999204759f, -0.039872928f,
+    0.999142419f, -0.041405641f,
     0.999077728f, -0.042938257f,
+    0.999010686f, -0.044470772f,
     0.998941293f, -0.046003182f,
+    0.998869550f, -0.047535484f,
     0.998795456f, -0.049067674f,
+    0.998719012f, -0.050599749f,
     0.998640218f, -0.052131705f,
+    0.998559074f, -0.053663538f,
     0.998475581f, -0.055195244f,
+    0.998389737f, -0.056726821f,
     0.998301545f, -0.058258265f,
+    0.998211003f, -0.059789571f,
     0.998118113f, -0.061320736f,
+    0.998022874f, -0.062851758f,
     0.997925286f, -0.064382631f,
+    0.997825350f, -0.065913353f,
     0.997723067f, -0.067443920f,
+    0.997618435f, -0.068974328f,
     0.997511456f, -0.070504573f,
+    0.997402130f, -0.072034653f,
     0.997290457f, -0.073564564f,
+    0.997176437f, -0.075094301f,
     0.997060070f, -0.076623861f,
+    0.996941358f, -0.078153242f,
     0.996820299f, -0.079682438f,
+    0.996696895f, -0.081211447f,
     0.996571146f, -0.082740265f,
+    0.996443051f, -0.084268888f,
     0.996312612f, -0.085797312f,
+    0.996179829f, -0.087325535f,
     0.996044701f, -0.088853553f,
+    0.995907229f, -0.090381361f,
     0.995767414f, -0.091908956f,
+    0.995625256f, -0.093436336f,
     0.995480755f, -0.094963495f,
+    0.995333912f, -0.096490431f,
     0.995184727f, -0.098017140f,
+    0.995033199f, -0.099543619f,
     0.994879331f, -0.101069863f,
+    0.994723121f, -0.102595869f,
     0.994564571f, -0.104121634f,
+    0.994403680f, -0.105647154f,
     0.994240449f, -0.107172425f,
+    0.994074879f, -0.108697444f,
     0.993906970f, -0.110222207f,
+    0.993736722f, -0.111746711f,
     0.993564136f, -0.113270952f,
+    0.993389211f, -0.114794927f,
     0.993211949f, -0.116318631f,
+    0.993032350f, -0.117842062f,
     0.992850414f, -0.119365215f,
+    0.992666142f, -0.120888087f,
     0.992479535f, -0.122410675f,
+    0.992290591f, -0.123932975f,
     0.992099313f, -0.125454983f,
+    0.991905700f, -0.126976696f,
     0.991709754f, -0.128498111f,
+    0.991511473f, -0.130019223f,
     0.991310860f, -0.131540029f,
+    0.991107914f, -0.133060525f,
     0.990902635f, -0.134580709f,
+    0.990695025f, -0.136100575f,
     0.990485084f, -0.137620122f,
+    0.990272812f, -0.139139344f,
     0.990058210f, -0.140658239f,
+    0.989841278f, -0.142176804f,
     0.989622017f, -0.143695033f,
+    0.989400428f, -0.145212925f,
     0.989176510f, -0.146730474f,
+    0.988950265f, -0.148247679f,
     0.988721692f, -0.149764535f,
+    0.988490793f, -0.151281038f,
     0.988257568f, -0.152797185f,
+    0.988022017f, -0.154312973f,
     0.987784142f, -0.155828398f,
+    0.987543942f, -0.157343456f,
     0.987301418f, -0.158858143f,
+    0.987056571f, -0.160372457f,
     0.986809402f, -0.161886394f,
+    0.986559910f, -0.163399949f,
     0.986308097f, -0.164913120f,
+    0.986053963f, -0.166425904f,
     0.985797509f, -0.167938295f,
+    0.985538735f, -0.169450291f,
     0.985277642f, -0.170961889f,
+    0.985014231f, -0.172473084f,
     0.984748502f, -0.173983873f,
+    0.984480455f, -0.175494253f,
     0.984210092f, -0.177004220f,
+    0.983937413f, -0.178513771f,
     0.983662419f, -0.180022901f,
+    0.983385110f, -0.181531608f,
     0.983105487f, -0.183039888f,
+    0.982823551f, -0.184547737f,
     0.982539302f, -0.186055152f,
+    0.982252741f, -0.187562129f,
     0.981963869f, -0.189068664f,
+    0.981672686f, -0.190574755f,
     0.981379193f, -0.192080397f,
+    0.981083391f, -0.193585587f,
     0.980785280f, -0.195090322f,
+    0.980484862f, -0.196594598f,
     0.980182136f, -0.198098411f,
+    0.979877104f, -0.199601758f,
     0.979569766f, -0.201104635f,
+    0.979260123f, -0.202607039f,
     0.978948175f, -0.204108966f,
+    0.978633924f, -0.205610413f,
     0.978317371f, -0.207111376f,
+    0.977998515f, -0.208611852f,
     0.977677358f, -0.210111837f,
+    0.977353900f, -0.211611327f,
     0.977028143f, -0.213110320f,
+    0.976700086f, -0.214608811f,
     0.976369731f, -0.216106797f,
+    0.976037079f, -0.217604275f,
     0.975702130f, -0.219101240f,
+    0.975364885f, -0.220597690f,
     0.975025345f, -0.222093621f,
+    0.974683511f, -0.223589029f,
     0.974339383f, -0.225083911f,
+    0.973992962f, -0.226578264f,
     0.973644250f, -0.228072083f,
+    0.973293246f, -0.229565366f,
     0.972939952f, -0.231058108f,
+    0.972584369f, -0.232550307f,
     0.972226497f, -0.234041959f,
+    0.971866337f, -0.235533059f,
     0.971503891f, -0.237023606f,
+    0.971139158f, -0.238513595f,
     0.970772141f, -0.240003022f,
+    0.970402839f, -0.241491885f,
     0.970031253f, -0.242980180f,
+    0.969657385f, -0.244467903f,
     0.969281235f, -0.245955050f,
+    0.968902805f, -0.247441619f,
     0.968522094f, -0.248927606f,
+    0.968139105f, -0.250413007f,
     0.967753837f, -0.251897818f,
+    0.967366292f, -0.253382037f,
     0.966976471f, -0.254865660f,
+    0.966584374f, -0.256348682f,
     0.966190003f, -0.257831102f,
+    0.965793359f, -0.259312915f,
     0.965394442f, -0.260794118f,
+    0.964993253f, -0.262274707f,
     0.964589793f, -0.263754679f,
+    0.964184064f, -0.265234030f,
     0.963776066f, -0.266712757f,
+    0.963365800f, -0.268190857f,
     0.962953267f, -0.269668326f,
+    0.962538468f, -0.271145160f,
     0.962121404f, -0.272621355f,
+    0.961702077f, -0.274096910f,
     0.961280486f, -0.275571819f,
+    0.960856633f, -0.277046080f,
     0.960430519f, -0.278519689f,
+    0.960002146f, -0.279992643f,
     0.959571513f, -0.281464938f,
+    0.959138622f, -0.282936570f,
     0.958703475f, -0.284407537f,
+    0.958266071f, -0.285877835f,
     0.957826413f, -0.287347460f,
+    0.957384501f, -0.288816408f,
     0.956940336f, -0.290284677f,
+    0.956493919f, -0.291752263f,
     0.956045251f, -0.293219163f,
+    0.955594334f, -0.294685372f,
     0.955141168f, -0.296150888f,
+    0.954685755f, -0.297615707f,
     0.954228095f, -0.299079826f,
+    0.953768190f, -0.300543241f,
     0.953306040f, -0.302005949f,
+    0.952841648f, -0.303467947f,
     0.952375013f, -0.304929230f,
+    0.951906137f, -0.306389795f,
     0.951435021f, -0.307849640f,
+    0.950961666f, -0.309308760f,
     0.950486074f, -0.310767153f,
+    0.950008245f, -0.312224814f,
     0.949528181f, -0.313681740f,
+    0.949045882f, -0.315137929f,
     0.948561350f, -0.316593376f,
+    0.948074586f, -0.318048077f,
     0.947585591f, -0.319502031f,
+    0.947094366f, -0.320955232f,
     0.946600913f, -0.322407679f,
+    0.946105232f, -0.323859367f,
     0.945607325f, -0.325310292f,
+    0.945107193f, -0.326760452f,
     0.944604837f, -0.328209844f,
+    0.944100258f, -0.329658463f,
     0.943593458f, -0.331106306f,
+    0.943084437f, -0.332553370f,
     0.942573198f, -0.333999651f,
+    0.942059740f, -0.335445147f,
     0.941544065f, -0.336889853f,
+    0.941026175f, -0.338333767f,
     0.940506071f, -0.339776884f,
+    0.939983753f, -0.341219202f,
     0.939459224f, -0.342660717f,
+    0.938932484f, -0.344101426f,
     0.938403534f, -0.345541325f,
+    0.937872376f, -0.346980411f,
     0.937339012f, -0.348418680f,
+    0.936803442f, -0.349856130f,
     0.936265667f, -0.351292756f,
+    0.935725689f, -0.352728556f,
     0.935183510f, -0.354163525f,
+    0.934639130f, -0.355597662f,
     0.934092550f, -0.357030961f,
+    0.933543773f, -0.358463421f,
     0.932992799f, -0.359895037f,
+    0.932439629f, -0.361325806f,
     0.931884266f, -0.362755724f,
+    0.931326709f, -0.364184790f,
     0.930766961f, -0.365612998f,
+    0.930205023f, -0.367040346f,
     0.929640896f, -0.368466830f,
+    0.929074581f, -0.369892447f,
     0.928506080f, -0.371317194f,
+    0.927935395f, -0.372741067f,
     0.927362526f, -0.374164063f,
+    0.926787474f, -0.375586178f,
     0.926210242f, -0.377007410f,
+    0.925630831f, -0.378427755f,
     0.925049241f, -0.379847209f,
+    0.924465474f, -0.381265769f,
     0.923879533f, -0.382683432f,
+    0.923291417f, -0.384100195f,
     0.922701128f, -0.385516054f,
+    0.922108669f, -0.386931006f,
     0.921514039f, -0.388345047f,
+    0.920917242f, -0.389758174f,
     0.920318277f, -0.391170384f,
+    0.919717146f, -0.392581674f,
     0.919113852f, -0.393992040f,
+    0.918508394f, -0.395401479f,
     0.917900776f, -0.396809987f,
+    0.917290997f, -0.398217562f,
     0.916679060f, -0.399624200f,
+    0.916064966f, -0.401029897f,
     0.915448716f, -0.402434651f,
+    0.914830312f, -0.403838458f,
     0.914209756f, -0.405241314f,
+    0.913587048f, -0.406643217f,
     0.912962190f, -0.408044163f,
+    0.912335185f, -0.409444149f,
     0.911706032f, -0.410843171f,
+    0.911074734f, -0.412241227f,
     0.910441292f, -0.413638312f,
+    0.909805708f, -0.415034424f,
     0.909167983f, -0.416429560f,
+    0.908528119f, -0.417823716f,
     0.907886116f, -0.419216888f,
+    0.907241978f, -0.420609074f,
     0.906595705f, -0.422000271f,
+    0.905947298f, -0.423390474f,
     0.905296759f, -0.424779681f,
+    0.904644091f, -0.426167889f,
     0.903989293f, -0.427555093f,
+    0.903332368f, -0.428941292f,
     0.902673318f, -0.430326481f,
+    0.902012144f, -0.431710658f,
     0.901348847f, -0.433093819f,
+    0.900683429f, -0.434475961f,
     0.900015892f, -0.435857080f,
+    0.899346237f, -0.437237174f,
     0.898674466f, -0.438616239f,
+    0.898000580f, -0.439994271f,
     0.897324581f, -0.441371269f,
+    0.896646470f, -0.442747228f,
     0.895966250f, -0.444122145f,
+    0.895283921f, -0.445496017f,
     0.894599486f, -0.446868840f,
+    0.893912945f, -0.448240612f,
     0.893224301f, -0.449611330f,
+    0.892533555f, -0.450980989f,
     0.891840709f, -0.452349587f,
+    0.891145765f, -0.453717121f,
     0.890448723f, -0.455083587f,
+    0.889749586f, -0.456448982f,
     0.889048356f, -0.457813304f,
+    0.888345033f, -0.459176548f,
     0.887639620f, -0.460538711f,
+    0.886932119f, -0.461899791f,
     0.886222530f, -0.463259784f,
+    0.885510856f, -0.464618686f,
     0.884797098f, -0.465976496f,
+    0.884081259f, -0.467333209f,
     0.883363339f, -0.468688822f,
+    0.882643340f, -0.470043332f,
     0.881921264f, -0.471396737f,
+    0.881197113f, -0.472749032f,
     0.880470889f, -0.474100215f,
+    0.879742593f, -0.475450282f,
     0.879012226f, -0.476799230f,
+    0.878279792f, -0.478147056f,
     0.877545290f, -0.479493758f,
+    0.876808724f, -0.480839331f,
     0.876070094f, -0.482183772f,
+    0.875329403f, -0.483527079f,
     0.874586652f, -0.484869248f,
+    0.873841843f, -0.486210276f,
     0.873094978f, -0.487550160f,
+    0.872346059f, -0.488888897f,
     0.871595087f, -0.490226483f,
+    0.870842063f, -0.491562916f,
     0.870086991f, -0.492898192f,
+    0.869329871f, -0.494232309f,
     0.868570706f, -0.495565262f,
+    0.867809497f, -0.496897049f,
     0.867046246f, -0.498227667f,
+    0.866280954f, -0.499557113f,
     0.865513624f, -0.500885383f,
+    0.864744258f, -0.502212474f,
     0.863972856f, -0.503538384f,
+    0.863199422f, -0.504863109f,
     0.862423956f, -0.506186645f,
+    0.861646461f, -0.507508991f,
     0.860866939f, -0.508830143f,
+    0.860085390f, -0.510150097f,
     0.859301818f, -0.511468850f,
+    0.858516224f, -0.512786401f,
     0.857728610f, -0.514102744f,
+    0.856938977f, -0.515417878f,
     0.856147328f, -0.516731799f,
+    0.855353665f, -0.518044504f,
     0.854557988f, -0.519355990f,
+    0.853760301f, -0.520666254f,
     0.852960605f, -0.521975293f,
+    0.852158902f, -0.523283103f,
     0.851355193f, -0.524589683f,
+    0.850549481f, -0.525895027f,
     0.849741768f, -0.527199135f,
+    0.848932055f, -0.528502002f,
     0.848120345f, -0.529803625f,
+    0.847306639f, -0.531104001f,
     0.846490939f, -0.532403128f,
+    0.845673247f, -0.533701002f,
     0.844853565f, -0.534997620f,
+    0.844031895f, -0.536292979f,
     0.843208240f, -0.537587076f,
+    0.842382600f, -0.538879909f,
     0.841554977f, -0.540171473f,
+    0.840725375f, -0.541461766f,
     0.839893794f, -0.542750785f,
+    0.839060237f, -0.544038527f,
     0.838224706f, -0.545324988f,
+    0.837387202f, -0.546610167f,
     0.836547727f, -0.547894059f,
+    0.835706284f, -0.549176662f,
     0.834862875f, -0.550457973f,
+    0.834017501f, -0.551737988f,
     0.833170165f, -0.553016706f,
+    0.832320868f, -0.554294121f,
     0.831469612f, -0.555570233f,
+    0.830616400f, -0.556845037f,
     0.829761234f, -0.558118531f,
+    0.828904115f, -0.559390712f,
     0.828045045f, -0.560661576f,
+    0.827184027f, -0.561931121f,
     0.826321063f, -0.563199344f,
+    0.825456154f, -0.564466242f,
     0.824589303f, -0.565731811f,
+    0.823720511f, -0.566996049f,
     0.822849781f, -0.568258953f,
+    0.821977115f, -0.569520519f,
     0.821102515f, -0.570780746f,
+    0.820225983f, -0.572039629f,
     0.819347520f, -0.573297167f,
+    0.818467130f, -0.574553355f,
     0.817584813f, -0.575808191f,
+    0.816700573f, -0.577061673f,
     0.815814411f, -0.578313796f,
+    0.814926329f, -0.579564559f,
     0.814036330f, -0.580813958f,
+    0.813144415f, -0.582061990f,
     0.812250587f, -0.583308653f,
+    0.811354847f, -0.584553943f,
     0.810457198f, -0.585797857f,
+    0.809557642f, -0.587040394f,
     0.808656182f, -0.588281548f,
+    0.807752818f, -0.589521319f,
     0.806847554f, -0.590759702f,
+    0.805940391f, -0.591996695f,
     0.805031331f, -0.593232295f,
+    0.804120377f, -0.594466499f,
     0.803207531f, -0.595699304f,
+    0.802292796f, -0.596930708f,
     0.801376172f, -0.598160707f,
+    0.800457662f, -0.599389298f,
     0.799537269f, -0.600616479f,
+    0.798614995f, -0.601842247f,
     0.797690841f, -0.603066599f,
+    0.796764810f, -0.604289531f,
     0.795836905f, -0.605511041f,
+    0.794907126f, -0.606731127f,
     0.793975478f, -0.607949785f,
+    0.793041960f, -0.609167012f,
     0.792106577f, -0.610382806f,
+    0.791169330f, -0.611597164f,
     0.790230221f, -0.612810082f,
+    0.789289253f, -0.614021559f,
     0.788346428f, -0.615231591f,
+    0.787401747f, -0.616440175f,
     0.786455214f, -0.617647308f,
+    0.785506830f, -0.618852988f,
     0.784556597f, -0.620057212f,
+    0.783604519f, -0.621259977f,
     0.782650596f, -0.622461279f,
+    0.781694832f, -0.623661118f,
     0.780737229f, -0.624859488f,
+    0.779777788f, -0.626056388f,
     0.778816512f, -0.627251815f,
+    0.777853404f, -0.628445767f,
     0.776888466f, -0.629638239f,
+    0.775921699f, -0.630829230f,
     0.774953107f, -0.632018736f,
+    0.773982691f, -0.633206755f,
     0.773010453f, -0.634393284f,
+    0.772036397f, -0.635578320f,
     0.771060524f, -0.636761861f,
+    0.770082837f, -0.637943904f,
     0.769103338f, -0.639124445f,
+    0.768122029f, -0.640303482f,
     0.767138912f, -0.641481013f,
+    0.766153990f, -0.642657034f,
     0.765167266f, -0.643831543f,
+    0.764178741f, -0.645004537f,
     0.763188417f, -0.646176013f,
+    0.762196298f, -0.647345969f,
     0.761202385f, -0.648514401f,
+    0.760206682f, -0.649681307f,
     0.759209189f, -0.650846685f,
+    0.758209910f, -0.652010531f,
     0.757208847f, -0.653172843f,
+    0.756206001f, -0.654333618f,
     0.755201377f, -0.655492853f,
+    0.754194975f, -0.656650546f,
     0.753186799f, -0.657806693f,
+    0.752176850f, -0.658961293f,
     0.751165132f, -0.660114342f,
+    0.750151646f, -0.661265838f,
     0.749136395f, -0.662415778f,
+    0.748119380f, -0.663564159f,
     0.747100606f, -0.664710978f,
+    0.746080074f, -0.665856234f,
     0.745057785f, -0.666999922f,
+    0.744033744f, -0.668142041f,
     0.743007952f, -0.669282588f,
+    0.741980412f, -0.670421560f,
     0.740951125f, -0.671558955f,
+    0.739920095f, -0.672694769f,
     0.738887324f, -0.673829000f,
+    0.737852815f, -0.674961646f,
     0.736816569f, -0.676092704f,
+    0.735778589f, -0.677222170f,
     0.734738878f, -0.678350043f,
+    0.733697438f, -0.679476320f,
     0.732654272f, -0.680600998f,
+    0.731609381f, -0.681724074f,
     0.730562769f, -0.682845546f,
+    0.729514438f, -0.683965412f,
     0.728464390f, -0.685083668f,
+    0.727412629f, -0.686200312f,
     0.726359155f, -0.687315341f,
+    0.725303972f, -0.688428753f,
     0.724247083f, -0.689540545f,
+    0.723188489f, -0.690650714f,
     0.722128194f, -0.691759258f,
+    0.721066199f, -0.692866175f,
     0.720002508f, -0.693971461f,
+    0.718937122f, -0.695075114f,
     0.717870045f, -0.696177131f,
+    0.716801279f, -0.697277511f,
     0.715730825f, -0.698376249f,
+    0.714658688f, -0.699473345f,
     0.713584869f, -0.700568794f,
+    0.712509371f, -0.701662595f,
     0.711432196f, -0.702754744f,
+    0.710353347f, -0.703845241f,
     0.709272826f, -0.704934080f,
+    0.708190637f, -0.706021261f,
     0.707106781f, -0.707106781f,
+    0.706021261f, -0.708190637f,
     0.704934080f, -0.709272826f,
+    0.703845241f, -0.710353347f,
     0.702754744f, -0.711432196f,
+    0.701662595f, -0.712509371f,
     0.700568794f, -0.713584869f,
+    0.699473345f, -0.714658688f,
     0.698376249f, -0.715730825f,
+    0.697277511f, -0.716801279f,
     0.696177131f, -0.717870045f,
+    0.695075114f, -0.718937122f,
     0.693971461f, -0.720002508f,
+    0.692866175f, -0.721066199f,
     0.691759258f, -0.722128194f,
+    0.690650714f, -0.723188489f,
     0.689540545f, -0.724247083f,
+    0.688428753f, -0.725303972f,
     0.687315341f, -0.726359155f,
+    0.686200312f, -0.727412629f,
     0.685083668f, -0.728464390f,
+    0.683965412f, -0.729514438f,
     0.682845546f, -0.730562769f,
+    0.681724074f, -0.731609381f,
     0.680600998f, -0.732654272f,
+    0.679476320f, -0.733697438f,
     0.678350043f, -0.734738878f,
+    0.677222170f, -0.735778589f,
     0.676092704f, -0.736816569f,
+    0.674961646f, -0.737852815f,
     0.673829000f, -0.738887324f,
+    0.672694769f, -0.739920095f,
     0.671558955f, -0.740951125f,
+    0.670421560f, -0.741980412f,
     0.669282588f, -0.743007952f,
+    0.668142041f, -0.744033744f,
     0.666999922f, -0.745057785f,
+    0.665856234f, -0.746080074f,
     0.664710978f, -0.747100606f,
+    0.663564159f, -0.748119380f,
     0.662415778f, -0.749136395f,
+    0.661265838f, -0.750151646f,
     0.660114342f, -0.751165132f,
+    0.658961293f, -0.752176850f,
     0.657806693f, -0.753186799f,
+    0.656650546f, -0.754194975f,
     0.655492853f, -0.755201377f,
+    0.654333618f, -0.756206001f,
     0.653172843f, -0.757208847f,
+    0.652010531f, -0.758209910f,
     0.650846685f, -0.759209189f,
+    0.649681307f, -0.760206682f,
     0.648514401f, -0.761202385f,
+    0.647345969f, -0.762196298f,
     0.646176013f, -0.763188417f,
+    0.645004537f, -0.764178741f,
     0.643831543f, -0.765167266f,
+    0.642657034f, -0.766153990f,
     0.641481013f, -0.767138912f,
+    0.640303482f, -0.768122029f,
     0.639124445f, -0.769103338f,
+    0.637943904f, -0.770082837f,
     0.636761861f, -0.771060524f,
+    0.635578320f, -0.772036397f,
     0.634393284f, -0.773010453f,
+    0.633206755f, -0.773982691f,
     0.632018736f, -0.774953107f,
+    0.630829230f, -0.775921699f,
     0.629638239f, -0.776888466f,
+    0.628445767f, -0.777853404f,
     0.627251815f, -0.778816512f,
+    0.626056388f, -0.779777788f,
     0.624859488f, -0.780737229f,
+    0.623661118f, -0.781694832f,
     0.622461279f, -0.782650596f,
+    0.621259977f, -0.783604519f,
     0.620057212f, -0.784556597f,
+    0.618852988f, -0.785506830f,
     0.617647308f, -0.786455214f,
+    0.616440175f, -0.787401747f,
     0.615231591f, -0.788346428f,
+    0.614021559f, -0.789289253f,
     0.612810082f, -0.790230221f,
+    0.611597164f, -0.791169330f,
     0.610382806f, -0.792106577f,
+    0.609167012f, -0.793041960f,
     0.607949785f, -0.793975478f,
+    0.606731127f, -0.794907126f,
     0.605511041f, -0.795836905f,
+    0.604289531f, -0.796764810f,
     0.603066599f, -0.797690841f,
+    0.601842247f, -0.798614995f,
     0.600616479f, -0.799537269f,
+    0.599389298f, -0.800457662f,
     0.598160707f, -0.801376172f,
+    0.596930708f, -0.802292796f,
     0.595699304f, -0.803207531f,
+    0.594466499f, -0.804120377f,
     0.593232295f, -0.805031331f,
+    0.591996695f, -0.805940391f,
     0.590759702f, -0.806847554f,
+    0.589521319f, -0.807752818f,
     0.588281548f, -0.808656182f,
+    0.587040394f, -0.809557642f,
     0.585797857f, -0.810457198f,
+    0.584553943f, -0.811354847f,
     0.583308653f, -0.812250587f,
+    0.582061990f, -0.813144415f,
     0.580813958f, -0.814036330f,
+    0.579564559f, -0.814926329f,
     0.578313796f, -0.815814411f,
+    0.577061673f, -0.816700573f,
     0.575808191f, -0.817584813f,
+    0.574553355f, -0.818467130f,
     0.573297167f, -0.819347520f,
+    0.572039629f, -0.820225983f,
     0.570780746f, -0.821102515f,
+    0.569520519f, -0.821977115f,
     0.568258953f, -0.822849781f,
+    0.566996049f, -0.823720511f,
     0.565731811f, -0.824589303f,
+    0.564466242f, -0.825456154f,
     0.563199344f, -0.826321063f,
+    0.561931121f, -0.827184027f,
     0.560661576f, -0.828045045f,
+    0.559390712f, -0.828904115f,
     0.558118531f, -0.829761234f,
+    0.556845037f, -0.830616400f,
     0.555570233f, -0.831469612f,
+    0.554294121f, -0.832320868f,
     0.553016706f, -0.833170165f,
+    0.551737988f, -0.834017501f,
     0.550457973f, -0.834862875f,
+    0.549176662f, -0.835706284f,
     0.547894059f, -0.836547727f,
+    0.546610167f, -0.837387202f,
     0.545324988f, -0.838224706f,
+    0.544038527f, -0.839060237f,
     0.542750785f, -0.839893794f,
+    0.541461766f, -0.840725375f,
     0.540171473f, -0.841554977f,
+    0.538879909f, -0.842382600f,
     0.537587076f, -0.843208240f,
+    0.536292979f, -0.844031895f,
     0.534997620f, -0.844853565f,
+    0.533701002f, -0.845673247f,
     0.532403128f, -0.846490939f,
+    0.531104001f, -0.847306639f,
     0.529803625f, -0.848120345f,
+    0.528502002f, -0.848932055f,
     0.527199135f, -0.849741768f,
+    0.525895027f, -0.850549481f,
     0.524589683f, -0.851355193f,
+    0.523283103f, -0.852158902f,
     0.521975293f, -0.852960605f,
+    0.520666254f, -0.853760301f,
     0.519355990f, -0.854557988f,
+    0.518044504f, -0.855353665f,
     0.516731799f, -0.856147328f,
+    0.515417878f, -0.856938977f,
     0.514102744f, -0.857728610f,
+    0.512786401f, -0.858516224f,
     0.511468850f, -0.859301818f,
+    0.510150097f, -0.860085390f,
     0.508830143f, -0.860866939f,
+    0.507508991f, -0.861646461f,
     0.506186645f, -0.862423956f,
+    0.504863109f, -0.863199422f,
     0.503538384f, -0.863972856f,
+    0.502212474f, -0.864744258f,
     0.500885383f, -0.865513624f,
+    0.499557113f, -0.866280954f,
     0.498227667f, -0.867046246f,
+    0.496897049f, -0.867809497f,
     0.495565262f, -0.868570706f,
+    0.494232309f, -0.869329871f,
     0.492898192f, -0.870086991f,
+    0.491562916f, -0.870842063f,
     0.490226483f, -0.871595087f,
+    0.488888897f, -0.872346059f,
     0.487550160f, -0.873094978f,
+    0.486210276f, -0.873841843f,
     0.484869248f, -0.874586652f,
+    0.483527079f, -0.875329403f,
     0.482183772f, -0.876070094f,
+    0.480839331f, -0.876808724f,
     0.479493758f, -0.877545290f,
+    0.478147056f, -0.878279792f,
     0.476799230f, -0.879012226f,
+    0.475450282f, -0.879742593f,
     0.474100215f, -0.880470889f,
+    0.472749032f, -0.881197113f,
     0.471396737f, -0.881921264f,
+    0.470043332f, -0.882643340f,
     0.468688822f, -0.883363339f,
+    0.467333209f, -0.884081259f,
     0.465976496f, -0.884797098f,
+    0.464618686f, -0.885510856f,
     0.463259784f, -0.886222530f,
+    0.461899791f, -0.886932119f,
     0.460538711f, -0.887639620f,
+    0.459176548f, -0.888345033f,
     0.457813304f, -0.889048356f,
+    0.456448982f, -0.889749586f,
     0.455083587f, -0.890448723f,
+    0.453717121f, -0.891145765f,
     0.452349587f, -0.891840709f,
+    0.450980989f, -0.892533555f,
     0.449611330f, -0.893224301f,
+    0.448240612f, -0.893912945f,
     0.446868840f, -0.894599486f,
+    0.445496017f, -0.895283921f,
     0.444122145f, -0.895966250f,
+    0.442747228f, -0.896646470f,
     0.441371269f, -0.897324581f,
+    0.439994271f, -0.898000580f,
     0.438616239f, -0.898674466f,
+    0.437237174f, -0.899346237f,
     0.435857080f, -0.900015892f,
+    0.434475961f, -0.900683429f,
     0.433093819f, -0.901348847f,
+    0.431710658f, -0.902012144f,
     0.430326481f, -0.902673318f,
+    0.428941292f, -0.903332368f,
     0.427555093f, -0.903989293f,
+    0.426167889f, -0.904644091f,
     0.424779681f, -0.905296759f,
+    0.423390474f, -0.905947298f,
     0.422000271f, -0.906595705f,
+    0.420609074f, -0.907241978f,
     0.419216888f, -0.907886116f,
+    0.417823716f, -0.908528119f,
     0.416429560f, -0.909167983f,
+    0.415034424f, -0.909805708f,
     0.413638312f, -0.910441292f,
+    0.412241227f, -0.911074734f,
     0.410843171f, -0.911706032f,
+    0.409444149f, -0.912335185f,
     0.408044163f, -0.912962190f,
+    0.406643217f, -0.913587048f,
     0.405241314f, -0.914209756f,
+    0.403838458f, -0.914830312f,
     0.402434651f, -0.915448716f,
+    0.401029897f, -0.916064966f,
     0.399624200f, -0.916679060f,
+    0.398217562f, -0.917290997f,
     0.396809987f, -0.917900776f,
+    0.395401479f, -0.918508394f,
     0.393992040f, -0.919113852f,
+    0.392581674f, -0.919717146f,
     0.391170384f, -0.920318277f,
+    0.389758174f, -0.920917242f,
     0.388345047f, -0.921514039f,
+    0.386931006f, -0.922108669f,
     0.385516054f, -0.922701128f,
+    0.384100195f, -0.923291417f,
     0.382683432f, -0.923879533f,
+    0.381265769f, -0.924465474f,
     0.379847209f, -0.925049241f,
+    0.378427755f, -0.925630831f,
     0.377007410f, -0.926210242f,
+    0.375586178f, -0.926787474f,
     0.374164063f, -0.927362526f,
+    0.372741067f, -0.927935395f,
     0.371317194f, -0.928506080f,
+    0.369892447f, -0.929074581f,
     0.368466830f, -0.929640896f,
+    0.367040346f, -0.930205023f,
     0.365612998f, -0.930766961f,
+    0.364184790f, -0.931326709f,
     0.362755724f, -0.931884266f,
+    0.361325806f, -0.932439629f,
     0.359895037f, -0.932992799f,
+    0.358463421f, -0.933543773f,
     0.357030961f, -0.934092550f,
+    0.355597662f, -0.934639130f,
     0.354163525f, -0.935183510f,
+    0.352728556f, -0.935725689f,
     0.351292756f, -0.936265667f,
+    0.349856130f, -0.936803442f,
     0.348418680f, -0.937339012f,
+    0.346980411f, -0.937872376f,
     0.345541325f, -0.938403534f,
+    0.344101426f, -0.938932484f,
     0.342660717f, -0.939459224f,
+    0.341219202f, -0.939983753f,
     0.339776884f, -0.940506071f,
+    0.338333767f, -0.941026175f,
     0.336889853f, -0.941544065f,
+    0.335445147f, -0.942059740f,
     0.333999651f, -0.942573198f,
+    0.332553370f, -0.943084437f,
     0.331106306f, -0.943593458f,
+    0.329658463f, -0.944100258f,
     0.328209844f, -0.944604837f,
+    0.326760452f, -0.945107193f,
     0.325310292f, -0.945607325f,
+    0.323859367f, -0.946105232f,
     0.322407679f, -0.946600913f,
+    0.320955232f, -0.947094366f,
     0.319502031f, -0.947585591f,
+    0.318048077f, -0.948074586f,
     0.316593376f, -0.948561350f,
+    0.315137929f, -0.949045882f,
     0.313681740f, -0.949528181f,
+    0.312224814f, -0.950008245f,
     0.310767153f, -0.950486074f,
+    0.309308760f, -0.950961666f,
     0.307849640f, -0.951435021f,
+    0.306389795f, -0.951906137f,
     0.304929230f, -0.952375013f,
+    0.303467947f, -0.952841648f,
     0.302005949f, -0.953306040f,
+    0.300543241f, -0.953768190f,
     0.299079826f, -0.954228095f,
+    0.297615707f, -0.954685755f,
     0.296150888f, -0.955141168f,
+    0.294685372f, -0.955594334f,
     0.293219163f, -0.956045251f,
+    0.291752263f, -0.956493919f,
     0.290284677f, -0.956940336f,
+    0.288816408f, -0.957384501f,
     0.287347460f, -0.957826413f,
+    0.285877835f, -0.958266071f,
     0.284407537f, -0.958703475f,
+    0.282936570f, -0.959138622f,
     0.281464938f, -0.959571513f,
+    0.279992643f, -0.960002146f,
     0.278519689f, -0.960430519f,
+    0.277046080f, -0.960856633f,
     0.275571819f, -0.961280486f,
+    0.274096910f, -0.961702077f,
     0.272621355f, -0.962121404f,
+    0.271145160f, -0.962538468f,
     0.269668326f, -0.962953267f,
+    0.268190857f, -0.963365800f,
     0.266712757f, -0.963776066f,
+    0.265234030f, -0.964184064f,
     0.263754679f, -0.964589793f,
+    0.262274707f, -0.964993253f,
     0.260794118f, -0.965394442f,
+    0.259312915f, -0.965793359f,
     0.257831102f, -0.966190003f,
+    0.256348682f, -0.966584374f,
     0.254865660f, -0.966976471f,
+    0.253382037f, -0.967366292f,
     0.251897818f, -0.967753837f,
+    0.250413007f, -0.968139105f,
     0.248927606f, -0.968522094f,
+    0.247441619f, -0.968902805f,
     0.245955050f, -0.969281235f,
+    0.244467903f, -0.969657385f,
     0.242980180f, -0.970031253f,
+    0.241491885f, -0.970402839f,
     0.240003022f, -0.970772141f,
+    0.238513595f, -0.971139158f,
     0.237023606f, -0.971503891f,
+    0.235533059f, -0.971866337f,
     0.234041959f, -0.972226497f,
+    0.232550307f, -0.972584369f,
     0.231058108f, -0.972939952f,
+    0.229565366f, -0.973293246f,
     0.228072083f, -0.973644250f,
+    0.226578264f, -0.973992962f,
     0.225083911f, -0.974339383f,
+    0.223589029f, -0.974683511f,
     0.222093621f, -0.975025345f,
+    0.220597690f, -0.975364885f,
     0.219101240f, -0.975702130f,
+    0.217604275f, -0.976037079f,
     0.216106797f, -0.976369731f,
+    0.214608811f, -0.976700086f,
     0.213110320f, -0.977028143f,
+    0.211611327f, -0.977353900f,
     0.210111837f, -0.977677358f,
+    0.208611852f, -0.977998515f,
     0.207111376f, -0.978317371f,
+    0.205610413f, -0.978633924f,
     0.204108966f, -0.978948175f,
+    0.202607039f, -0.979260123f,
     0.201104635f, -0.979569766f,
+    0.199601758f, -0.979877104f,
     0.198098411f, -0.980182136f,
+    0.196594598f, -0.980484862f,
     0.195090322f, -0.980785280f,
+    0.193585587f, -0.981083391f,
     0.192080397f, -0.981379193f,
+    0.190574755f, -0.981672686f,
     0.189068664f, -0.981963869f,
+    0.187562129f, -0.982252741f,
     0.186055152f, -0.982539302f,
+    0.184547737f, -0.982823551f,
     0.183039888f, -0.983105487f,
+    0.181531608f, -0.983385110f,
     0.180022901f, -0.983662419f,
+    0.178513771f, -0.983937413f,
     0.177004220f, -0.984210092f,
+    0.175494253f, -0.984480455f,
     0.173983873f, -0.984748502f,
+    0.172473084f, -0.985014231f,
     0.170961889f, -0.985277642f,
+    0.169450291f, -0.985538735f,
     0.167938295f, -0.985797509f,
+    0.166425904f, -0.986053963f,
     0.164913120f, -0.986308097f,
+    0.163399949f, -0.986559910f,
     0.161886394f, -0.986809402f,
+    0.160372457f, -0.987056571f,
     0.158858143f, -0.987301418f,
+    0.157343456f, -0.987543942f,
     0.155828398f, -0.987784142f,
+    0.154312973f, -0.988022017f,
     0.152797185f, -0.988257568f,
+    0.151281038f, -0.988490793f,
     0.149764535f, -0.988721692f,
+    0.148247679f, -0.988950265f,
     0.146730474f, -0.989176510f,
+    0.145212925f, -0.989400428f,
     0.143695033f, -0.989622017f,
+    0.142176804f, -0.989841278f,
     0.140658239f, -0.990058210f,
+    0.139139344f, -0.990272812f,
     0.137620122f, -0.990485084f,
+    0.136100575f, -0.990695025f,
     0.134580709f, -0.990902635f,
+    0.133060525f, -0.991107914f,
     0.131540029f, -0.991310860f,
+    0.130019223f, -0.991511473f,
     0.128498111f, -0.991709754f,
+    0.126976696f, -0.991905700f,
     0.125454983f, -0.992099313f,
+    0.123932975f, -0.992290591f,
     0.122410675f, -0.992479535f,
+    0.120888087f, -0.992666142f,
     0.119365215f, -0.992850414f,
+    0.117842062f, -0.993032350f,
     0.116318631f, -0.993211949f,
+    0.114794927f, -0.993389211f,
     0.113270952f, -0.993564136f,
+    0.111746711f, -0.993736722f,
     0.110222207f, -0.993906970f,
+    0.108697444f, -0.994074879f,
     0.107172425f, -0.994240449f,
+    0.105647154f, -0.994403680f,
     0.104121634f, -0.994564571f,
+    0.102595869f, -0.994723121f,
     0.101069863f, -0.994879331f,
+    0.099543619f, -0.995033199f,
     0.098017140f, -0.995184727f,
+    0.096490431f, -0.995333912f,
     0.094963495f, -0.995480755f,
+    0.093436336f, -0.995625256f,
     0.091908956f, -0.995767414f,
+    0.090381361f, -0.995907229f,
     0.088853553f, -0.996044701f,
+    0.087325535f, -0.996179829f,
     0.085797312f, -0.996312612f,
+    0.084268888f, -0.996443051f,
     0.082740265f, -0.996571146f,
+    0.081211447f, -0.996696895f,
     0.079682438f, -0.996820299f,
+    0.078153242f, -0.996941358f,
     0.076623861f, -0.997060070f,
+    0.075094301f, -0.997176437f,
     0.073564564f, -0.997290457f,
+    0.072034653f, -0.997402130f,
     0.070504573f, -0.997511456f,
+    0.068974328f, -0.997618435f,
     0.067443920f, -0.997723067f,
+    0.065913353f, -0.997825350f,
     0.064382631f, -0.997925286f,
+    0.062851758f, -0.998022874f,
     0.061320736f, -0.998118113f,
+    0.059789571f, -0.998211003f,
     0.058258265f, -0.998301545f,
+    0.056726821f, -0.998389737f,
     0.055195244f, -0.998475581f,
+    0.053663538f, -0.998559074f,
     0.052131705f, -0.998640218f,
+    0.050599749f, -0.998719012f,
     0.049067674f, -0.998795456f,
+    0.047535484f, -0.998869550f,
     0.046003182f, -0.998941293f,
+    0.044470772f, -0.999010686f,
     0.042938257f, -0.999077728f,
+    0.041405641f, -0.999142419f,
     0.039872928f, -0.999204759f,
+    0.038340120f, -0.999264747f,
     0.036807223f, -0.999322385f,
+    0.035274239f, -0.999377670f,
     0.033741172f, -0.999430605f,
+    0.032208025f, -0.999481187f,
     0.030674803f, -0.999529418f,
+    0.029141509f, -0.999575296f,
     0.027608146f, -0.999618822f,
+    0.026074718f, -0.999659997f,
     0.024541229f, -0.999698819f,
+    0.023007681f, -0.999735288f,
     0.021474080f, -0.999769405f,
+    0.019940429f, -0.999801170f,
     0.018406730f, -0.999830582f,
+    0.016872988f, -0.999857641f,
     0.015339206f, -0.999882347f,
+    0.013805389f, -0.999904701f,
     0.012271538f, -0.999924702f,
+    0.010737659f, -0.999942350f,
     0.009203755f, -0.999957645f,
+    0.007669829f, -0.999970586f,
     0.006135885f, -0.999981175f,
-    0.003067957f, -0.999995294f
+    0.004601926f, -0.999989411f,
+    0.003067957f, -0.999995294f,
+    0.001533980f, -0.999998823f
 };
+#endif
 
-const float32_t twiddleCoef_rfft_4096[4096] = {
+#if defined(ARM_TABLE_RFFT_F32_1000)
+const float32_t twiddleCoef_rfft_1000[1000] ARM_DSP_TABLE_ATTR = {
     0.000000000f,  1.000000000f,
-    0.001533980f,  0.999998823f,
-    0.003067957f,  0.999995294f,
-    0.004601926f,  0.999989411f,
-    0.006135885f,  0.999981175f,
-    0.007669829f,  0.999970586f,
-    0.009203755f,  0.999957645f,
-    0.010737659f,  0.999942350f,
+    0.006283144f,  0.999980261f,
+    0.012566040f,  0.999921044f,
+    0.018848440f,  0.999822352f,
+    0.025130095f,  0.999684189f,
+    0.031410759f,  0.999506560f,
+    0.037690183f,  0.999289473f,
+    0.043968118f,  0.999032935f,
+    0.050244318f,  0.998736957f,
+    0.056518534f,  0.998401550f,
+    0.062790520f,  0.998026728f,
+    0.069060026f,  0.997612506f,
+    0.075326806f,  0.997158900f,
+    0.081590612f,  0.996665928f,
+    0.087851197f,  0.996133609f,
+    0.094108313f,  0.995561965f,
+    0.100361715f,  0.994951017f,
+    0.106611154f,  0.994300790f,
+    0.112856385f,  0.993611311f,
+    0.119097160f,  0.992882605f,
+    0.125333234f,  0.992114701f,
+    0.131564359f,  0.991307631f,
+    0.137790291f,  0.990461426f,
+    0.144010783f,  0.989576119f,
+    0.150225589f,  0.988651745f,
+    0.156434465f,  0.987688341f,
+    0.162637165f,  0.986685944f,
+    0.168833445f,  0.985644595f,
+    0.175023059f,  0.984564335f,
+    0.181205764f,  0.983445205f,
+    0.187381315f,  0.982287251f,
+    0.193549468f,  0.981090517f,
+    0.199709981f,  0.979855052f,
+    0.205862609f,  0.978580904f,
+    0.212007110f,  0.977268124f,
+    0.218143241f,  0.975916762f,
+    0.224270761f,  0.974526873f,
+    0.230389427f,  0.973098511f,
+    0.236498997f,  0.971631733f,
+    0.242599231f,  0.970126596f,
+    0.248689887f,  0.968583161f,
+    0.254770726f,  0.967001488f,
+    0.260841506f,  0.965381639f,
+    0.266901989f,  0.963723678f,
+    0.272951936f,  0.962027672f,
+    0.278991106f,  0.960293686f,
+    0.285019262f,  0.958521789f,
+    0.291036167f,  0.956712052f,
+    0.297041582f,  0.954864545f,
+    0.303035270f,  0.952979342f,
+    0.309016994f,  0.951056516f,
+    0.314986520f,  0.949096145f,
+    0.320943610f,  0.947098305f,
+    0.326888030f,  0.945063075f,
+    0.332819545f,  0.942990536f,
+    0.338737920f,  0.940880769f,
+    0.344642923f,  0.938733858f,
+    0.350534320f,  0.936549887f,
+    0.356411879f,  0.934328942f,
+    0.362275367f,  0.932071112f,
+    0.368124553f,  0.929776486f,
+    0.373959206f,  0.927445153f,
+    0.379779096f,  0.925077207f,
+    0.385583992f,  0.922672740f,
+    0.391373667f,  0.920231847f,
+    0.397147891f,  0.917754626f,
+    0.402906436f,  0.915241173f,
+    0.408649075f,  0.912691587f,
+    0.414375581f,  0.910105971f,
+    0.420085728f,  0.907484425f,
+    0.425779292f,  0.904827052f,
+    0.431456046f,  0.902133959f,
+    0.437115767f,  0.899405252f,
+    0.442758231f,  0.896641037f,
+    0.448383216f,  0.893841424f,
+    0.453990500f,  0.891006524f,
+    0.459579861f,  0.888136449f,
+    0.465151078f,  0.885231311f,
+    0.470703932f,  0.882291226f,
+    0.476238204f,  0.879316310f,
+    0.481753674f,  0.876306680f,
+    0.487250126f,  0.873262455f,
+    0.492727342f,  0.870183755f,
+    0.498185105f,  0.867070701f,
+    0.503623202f,  0.863923417f,
+    0.509041416f,  0.860742027f,
+    0.514439534f,  0.857526656f,
+    0.519817343f,  0.854277432f,
+    0.525174630f,  0.850994482f,
+    0.530511184f,  0.847677936f,
+    0.535826795f,  0.844327926f,
+    0.541121252f,  0.840944582f,
+    0.546394347f,  0.837528040f,
+    0.551645871f,  0.834078434f,
+    0.556875616f,  0.830595899f,
+    0.562083378f,  0.827080574f,
+    0.567268949f,  0.823532598f,
+    0.572432126f,  0.819952109f,
+    0.577572703f,  0.816339251f,
+    0.582690480f,  0.812694164f,
+    0.587785252f,  0.809016994f,
+    0.592856820f,  0.805307886f,
+    0.597904983f,  0.801566985f,
+    0.602929542f,  0.797794440f,
+    0.607930298f,  0.793990399f,
+    0.612907054f,  0.790155012f,
+    0.617859613f,  0.786288432f,
+    0.622787780f,  0.782390811f,
+    0.627691361f,  0.778462302f,
+    0.632570162f,  0.774503060f,
+    0.637423990f,  0.770513243f,
+    0.642252653f,  0.766493007f,
+    0.647055962f,  0.762442511f,
+    0.651833725f,  0.758361915f,
+    0.656585756f,  0.754251381f,
+    0.661311865f,  0.750111070f,
+    0.666011867f,  0.745941145f,
+    0.670685577f,  0.741741773f,
+    0.675332808f,  0.737513117f,
+    0.679953379f,  0.733255346f,
+    0.684547106f,  0.728968627f,
+    0.689113808f,  0.724653130f,
+    0.693653306f,  0.720309025f,
+    0.698165419f,  0.715936483f,
+    0.702649970f,  0.711535677f,
+    0.707106781f,  0.707106781f,
+    0.711535677f,  0.702649970f,
+    0.715936483f,  0.698165419f,
+    0.720309025f,  0.693653306f,
+    0.724653130f,  0.689113808f,
+    0.728968627f,  0.684547106f,
+    0.733255346f,  0.679953379f,
+    0.737513117f,  0.675332808f,
+    0.741741773f,  0.670685577f,
+    0.745941145f,  0.666011867f,
+    0.750111070f,  0.661311865f,
+    0.754251381f,  0.656585756f,
+    0.758361915f,  0.651833725f,
+    0.762442511f,  0.647055962f,
+    0.766493007f,  0.642252653f,
+    0.770513243f,  0.637423990f,
+    0.774503060f,  0.632570162f,
+    0.778462302f,  0.627691361f,
+    0.782390811f,  0.622787780f,
+    0.786288432f,  0.617859613f,
+    0.790155012f,  0.612907054f,
+    0.793990399f,  0.607930298f,
+    0.797794440f,  0.602929542f,
+    0.801566985f,  0.597904983f,
+    0.805307886f,  0.592856820f,
+    0.809016994f,  0.587785252f,
+    0.812694164f,  0.582690480f,
+    0.816339251f,  0.577572703f,
+    0.819952109f,  0.572432126f,
+    0.823532598f,  0.567268949f,
+    0.827080574f,  0.562083378f,
+    0.830595899f,  0.556875616f,
+    0.834078434f,  0.551645871f,
+    0.837528040f,  0.546394347f,
+    0.840944582f,  0.541121252f,
+    0.844327926f,  0.535826795f,
+    0.847677936f,  0.530511184f,
+    0.850994482f,  0.525174630f,
+    0.854277432f,  0.519817343f,
+    0.857526656f,  0.514439534f,
+    0.860742027f,  0.509041416f,
+    0.863923417f,  0.503623202f,
+    0.867070701f,  0.498185105f,
+    0.870183755f,  0.492727342f,
+    0.873262455f,  0.487250126f,
+    0.876306680f,  0.481753674f,
+    0.879316310f,  0.476238204f,
+    0.882291226f,  0.470703932f,
+    0.885231311f,  0.465151078f,
+    0.888136449f,  0.459579861f,
+    0.891006524f,  0.453990500f,
+    0.893841424f,  0.448383216f,
+    0.896641037f,  0.442758231f,
+    0.899405252f,  0.437115767f,
+    0.902133959f,  0.431456046f,
+    0.904827052f,  0.425779292f,
+    0.907484425f,  0.420085728f,
+    0.910105971f,  0.414375581f,
+    0.912691587f,  0.408649075f,
+    0.915241173f,  0.402906436f,
+    0.917754626f,  0.397147891f,
+    0.920231847f,  0.391373667f,
+    0.922672740f,  0.385583992f,
+    0.925077207f,  0.379779096f,
+    0.927445153f,  0.373959206f,
+    0.929776486f,  0.368124553f,
+    0.932071112f,  0.362275367f,
+    0.934328942f,  0.356411879f,
+    0.936549887f,  0.350534320f,
+    0.938733858f,  0.344642923f,
+    0.940880769f,  0.338737920f,
+    0.942990536f,  0.332819545f,
+    0.945063075f,  0.326888030f,
+    0.947098305f,  0.320943610f,
+    0.949096145f,  0.314986520f,
+    0.951056516f,  0.309016994f,
+    0.952979342f,  0.303035270f,
+    0.954864545f,  0.297041582f,
+    0.956712052f,  0.291036167f,
+    0.958521789f,  0.285019262f,
+    0.960293686f,  0.278991106f,
+    0.962027672f,  0.272951936f,
+    0.963723678f,  0.266901989f,
+    0.965381639f,  0.260841506f,
+    0.967001488f,  0.254770726f,
+    0.968583161f,  0.248689887f,
+    0.970126596f,  0.242599231f,
+    0.971631733f,  0.236498997f,
+    0.973098511f,  0.230389427f,
+    0.974526873f,  0.224270761f,
+    0.975916762f,  0.218143241f,
+    0.977268124f,  0.212007110f,
+    0.978580904f,  0.205862609f,
+    0.979855052f,  0.199709981f,
+    0.981090517f,  0.193549468f,
+    0.982287251f,  0.187381315f,
+    0.983445205f,  0.181205764f,
+    0.984564335f,  0.175023059f,
+    0.985644595f,  0.168833445f,
+    0.986685944f,  0.162637165f,
+    0.987688341f,  0.156434465f,
+    0.988651745f,  0.150225589f,
+    0.989576119f,  0.144010783f,
+    0.990461426f,  0.137790291f,
+    0.991307631f,  0.131564359f,
+    0.992114701f,  0.125333234f,
+    0.992882605f,  0.119097160f,
+    0.993611311f,  0.112856385f,
+    0.994300790f,  0.106611154f,
+    0.994951017f,  0.100361715f,
+    0.995561965f,  0.094108313f,
+    0.996133609f,  0.087851197f,
+    0.996665928f,  0.081590612f,
+    0.997158900f,  0.075326806f,
+    0.997612506f,  0.069060026f,
+    0.998026728f,  0.062790520f,
+    0.998401550f,  0.056518534f,
+    0.998736957f,  0.050244318f,
+    0.999032935f,  0.043968118f,
+    0.999289473f,  0.037690183f,
+    0.999506560f,  0.031410759f,
+    0.999684189f,  0.025130095f,
+    0.999822352f,  0.018848440f,
+    0.999921044f,  0.012566040f,
+    0.999980261f,  0.006283144f,
+    1.000000000f,  0.000000000f,
+    0.999980261f, -0.006283144f,
+    0.999921044f, -0.012566040f,
+    0.999822352f, -0.018848440f,
+    0.999684189f, -0.025130095f,
+    0.999506560f, -0.031410759f,
+    0.999289473f, -0.037690183f,
+    0.999032935f, -0.043968118f,
+    0.998736957f, -0.050244318f,
+    0.998401550f, -0.056518534f,
+    0.998026728f, -0.062790520f,
+    0.997612506f, -0.069060026f,
+    0.997158900f, -0.075326806f,
+    0.996665928f, -0.081590612f,
+    0.996133609f, -0.087851197f,
+    0.995561965f, -0.094108313f,
+    0.994951017f, -0.100361715f,
+    0.994300790f, -0.106611154f,
+    0.993611311f, -0.112856385f,
+    0.992882605f, -0.119097160f,
+    0.992114701f, -0.125333234f,
+    0.991307631f, -0.131564359f,
+    0.990461426f, -0.137790291f,
+    0.989576119f, -0.144010783f,
+    0.988651745f, -0.150225589f,
+    0.987688341f, -0.156434465f,
+    0.986685944f, -0.162637165f,
+    0.985644595f, -0.168833445f,
+    0.984564335f, -0.175023059f,
+    0.983445205f, -0.181205764f,
+    0.982287251f, -0.187381315f,
+    0.981090517f, -0.193549468f,
+    0.979855052f, -0.199709981f,
+    0.978580904f, -0.205862609f,
+    0.977268124f, -0.212007110f,
+    0.975916762f, -0.218143241f,
+    0.974526873f, -0.224270761f,
+    0.973098511f, -0.230389427f,
+    0.971631733f, -0.236498997f,
+    0.970126596f, -0.242599231f,
+    0.968583161f, -0.248689887f,
+    0.967001488f, -0.254770726f,
+    0.965381639f, -0.260841506f,
+    0.963723678f, -0.266901989f,
+    0.962027672f, -0.272951936f,
+    0.960293686f, -0.278991106f,
+    0.958521789f, -0.285019262f,
+    0.956712052f, -0.291036167f,
+    0.954864545f, -0.297041582f,
+    0.952979342f, -0.303035270f,
+    0.951056516f, -0.309016994f,
+    0.949096145f, -0.314986520f,
+    0.947098305f, -0.320943610f,
+    0.945063075f, -0.326888030f,
+    0.942990536f, -0.332819545f,
+    0.940880769f, -0.338737920f,
+    0.938733858f, -0.344642923f,
+    0.936549887f, -0.350534320f,
+    0.934328942f, -0.356411879f,
+    0.932071112f, -0.362275367f,
+    0.929776486f, -0.368124553f,
+    0.927445153f, -0.373959206f,
+    0.925077207f, -0.379779096f,
+    0.922672740f, -0.385583992f,
+    0.920231847f, -0.391373667f,
+    0.917754626f, -0.397147891f,
+    0.915241173f, -0.402906436f,
+    0.912691587f, -0.408649075f,
+    0.910105971f, -0.414375581f,
+    0.907484425f, -0.420085728f,
+    0.904827052f, -0.425779292f,
+    0.902133959f, -0.431456046f,
+    0.899405252f, -0.437115767f,
+    0.896641037f, -0.442758231f,
+    0.893841424f, -0.448383216f,
+    0.891006524f, -0.453990500f,
+    0.888136449f, -0.459579861f,
+    0.885231311f, -0.465151078f,
+    0.882291226f, -0.470703932f,
+    0.879316310f, -0.476238204f,
+    0.876306680f, -0.481753674f,
+    0.873262455f, -0.487250126f,
+    0.870183755f, -0.492727342f,
+    0.867070701f, -0.498185105f,
+    0.863923417f, -0.503623202f,
+    0.860742027f, -0.509041416f,
+    0.857526656f, -0.514439534f,
+    0.854277432f, -0.519817343f,
+    0.850994482f, -0.525174630f,
+    0.847677936f, -0.530511184f,
+    0.844327926f, -0.535826795f,
+    0.840944582f, -0.541121252f,
+    0.837528040f, -0.546394347f,
+    0.834078434f, -0.551645871f,
+    0.830595899f, -0.556875616f,
+    0.827080574f, -0.562083378f,
+    0.823532598f, -0.567268949f,
+    0.819952109f, -0.572432126f,
+    0.816339251f, -0.577572703f,
+    0.812694164f, -0.582690480f,
+    0.809016994f, -0.587785252f,
+    0.805307886f, -0.592856820f,
+    0.801566985f, -0.597904983f,
+    0.797794440f, -0.602929542f,
+    0.793990399f, -0.607930298f,
+    0.790155012f, -0.612907054f,
+    0.786288432f, -0.617859613f,
+    0.782390811f, -0.622787780f,
+    0.778462302f, -0.627691361f,
+    0.774503060f, -0.632570162f,
+    0.770513243f, -0.637423990f,
+    0.766493007f, -0.642252653f,
+    0.762442511f, -0.647055962f,
+    0.758361915f, -0.651833725f,
+    0.754251381f, -0.656585756f,
+    0.750111070f, -0.661311865f,
+    0.745941145f, -0.666011867f,
+    0.741741773f, -0.670685577f,
+    0.737513117f, -0.675332808f,
+    0.733255346f, -0.679953379f,
+    0.728968627f, -0.684547106f,
+    0.724653130f, -0.689113808f,
+    0.720309025f, -0.693653306f,
+    0.715936483f, -0.698165419f,
+    0.711535677f, -0.702649970f,
+    0.707106781f, -0.707106781f,
+    0.702649970f, -0.711535677f,
+    0.698165419f, -0.715936483f,
+    0.693653306f, -0.720309025f,
+    0.689113808f, -0.724653130f,
+    0.684547106f, -0.728968627f,
+    0.679953379f, -0.733255346f,
+    0.675332808f, -0.737513117f,
+    0.670685577f, -0.741741773f,
+    0.666011867f, -0.745941145f,
+    0.661311865f, -0.750111070f,
+    0.656585756f, -0.754251381f,
+    0.651833725f, -0.758361915f,
+    0.647055962f, -0.762442511f,
+    0.642252653f, -0.766493007f,
+    0.637423990f, -0.770513243f,
+    0.632570162f, -0.774503060f,
+    0.627691361f, -0.778462302f,
+    0.622787780f, -0.782390811f,
+    0.617859613f, -0.786288432f,
+    0.612907054f, -0.790155012f,
+    0.607930298f, -0.793990399f,
+    0.602929542f, -0.797794440f,
+    0.597904983f, -0.801566985f,
+    0.592856820f, -0.805307886f,
+    0.587785252f, -0.809016994f,
+    0.582690480f, -0.812694164f,
+    0.577572703f, -0.816339251f,
+    0.572432126f, -0.819952109f,
+    0.567268949f, -0.823532598f,
+    0.562083378f, -0.827080574f,
+    0.556875616f, -0.830595899f,
+    0.551645871f, -0.834078434f,
+    0.546394347f, -0.837528040f,
+    0.541121252f, -0.840944582f,
+    0.535826795f, -0.844327926f,
+    0.530511184f, -0.847677936f,
+    0.525174630f, -0.850994482f,
+    0.519817343f, -0.854277432f,
+    0.514439534f, -0.857526656f,
+    0.509041416f, -0.860742027f,
+    0.503623202f, -0.863923417f,
+    0.498185105f, -0.867070701f,
+    0.492727342f, -0.870183755f,
+    0.487250126f, -0.873262455f,
+    0.481753674f, -0.876306680f,
+    0.476238204f, -0.879316310f,
+    0.470703932f, -0.882291226f,
+    0.465151078f, -0.885231311f,
+    0.459579861f, -0.888136449f,
+    0.453990500f, -0.891006524f,
+    0.448383216f, -0.893841424f,
+    0.442758231f, -0.896641037f,
+    0.437115767f, -0.899405252f,
+    0.431456046f, -0.902133959f,
+    0.425779292f, -0.904827052f,
+    0.420085728f, -0.907484425f,
+    0.414375581f, -0.910105971f,
+    0.408649075f, -0.912691587f,
+    0.402906436f, -0.915241173f,
+    0.397147891f, -0.917754626f,
+    0.391373667f, -0.920231847f,
+    0.385583992f, -0.922672740f,
+    0.379779096f, -0.925077207f,
+    0.373959206f, -0.927445153f,
+    0.368124553f, -0.929776486f,
+    0.362275367f, -0.932071112f,
+    0.356411879f, -0.934328942f,
+    0.350534320f, -0.936549887f,
+    0.344642923f, -0.938733858f,
+    0.338737920f, -0.940880769f,
+    0.332819545f, -0.942990536f,
+    0.326888030f, -0.945063075f,
+    0.320943610f, -0.947098305f,
+    0.314986520f, -0.949096145f,
+    0.309016994f, -0.951056516f,
+    0.303035270f, -0.952979342f,
+    0.297041582f, -0.954864545f,
+    0.291036167f, -0.956712052f,
+    0.285019262f, -0.958521789f,
+    0.278991106f, -0.960293686f,
+    0.272951936f, -0.962027672f,
+    0.266901989f, -0.963723678f,
+    0.260841506f, -0.965381639f,
+    0.254770726f, -0.967001488f,
+    0.248689887f, -0.968583161f,
+    0.242599231f, -0.970126596f,
+    0.236498997f, -0.971631733f,
+    0.230389427f, -0.973098511f,
+    0.224270761f, -0.974526873f,
+    0.218143241f, -0.975916762f,
+    0.212007110f, -0.977268124f,
+    0.205862609f, -0.978580904f,
+    0.199709981f, -0.979855052f,
+    0.193549468f, -0.981090517f,
+    0.187381315f, -0.982287251f,
+    0.181205764f, -0.983445205f,
+    0.175023059f, -0.984564335f,
+    0.168833445f, -0.985644595f,
+    0.162637165f, -0.986685944f,
+    0.156434465f, -0.987688341f,
+    0.150225589f, -0.988651745f,
+    0.144010783f, -0.989576119f,
+    0.137790291f, -0.990461426f,
+    0.131564359f, -0.991307631f,
+    0.125333234f, -0.992114701f,
+    0.119097160f, -0.992882605f,
+    0.112856385f, -0.993611311f,
+    0.106611154f, -0.994300790f,
+    0.100361715f, -0.994951017f,
+    0.094108313f, -0.995561965f,
+    0.087851197f, -0.996133609f,
+    0.081590612f, -0.996665928f,
+    0.075326806f, -0.997158900f,
+    0.069060026f, -0.997612506f,
+    0.062790520f, -0.998026728f,
+    0.056518534f, -0.998401550f,
+    0.050244318f, -0.998736957f,
+    0.043968118f, -0.999032935f,
+    0.037690183f, -0.999289473f,
+    0.031410759f, -0.999506560f,
+    0.025130095f, -0.999684189f,
+    0.018848440f, -0.999822352f,
+    0.012566040f, -0.999921044f,
+    0.006283144f, -0.999980261f
+};
+#endif
+
+#if defined(ARM_TABLE_RFFT_F32_1200)
+const float32_t twiddleCoef_rfft_1200[1200] ARM_DSP_TABLE_ATTR = {
+    0.000000000f,  1.000000000f,
+    0.005235964f,  0.999986292f,
+    0.010471784f,  0.999945169f,
+    0.015707317f,  0.999876632f,
+    0.020942420f,  0.999780683f,
+    0.026176948f,  0.999657325f,
+    0.031410759f,  0.999506560f,
+    0.036643709f,  0.999328394f,
+    0.041875654f,  0.999122830f,
+    0.047106451f,  0.998889875f,
+    0.052335956f,  0.998629535f,
+    0.057564027f,  0.998341817f,
+    0.062790520f,  0.998026728f,
+    0.068015291f,  0.997684279f,
+    0.073238197f,  0.997314477f,
+    0.078459096f,  0.996917334f,
+    0.083677843f,  0.996492859f,
+    0.088894297f,  0.996041065f,
+    0.094108313f,  0.995561965f,
+    0.099319750f,  0.995055570f,
+    0.104528463f,  0.994521895f,
+    0.109734311f,  0.993960955f,
+    0.114937150f,  0.993372766f,
+    0.120136839f,  0.992757342f,
+    0.125333234f,  0.992114701f,
+    0.130526192f,  0.991444861f,
+    0.135715572f,  0.990747840f,
+    0.140901232f,  0.990023658f,
+    0.146083029f,  0.989272333f,
+    0.151260820f,  0.988493887f,
+    0.156434465f,  0.987688341f,
+    0.161603821f,  0.986855716f,
+    0.166768747f,  0.985996037f,
+    0.171929100f,  0.985109326f,
+    0.177084740f,  0.984195608f,
+    0.182235525f,  0.983254908f,
+    0.187381315f,  0.982287251f,
+    0.192521967f,  0.981292664f,
+    0.197657340f,  0.980271175f,
+    0.202787295f,  0.979222811f,
+    0.207911691f,  0.978147601f,
+    0.213030386f,  0.977045574f,
+    0.218143241f,  0.975916762f,
+    0.223250116f,  0.974761194f,
+    0.228350870f,  0.973578903f,
+    0.233445364f,  0.972369920f,
+    0.238533458f,  0.971134280f,
+    0.243615012f,  0.969872015f,
+    0.248689887f,  0.968583161f,
+    0.253757945f,  0.967267753f,
+    0.258819045f,  0.965925826f,
+    0.263873050f,  0.964557418f,
+    0.268919821f,  0.963162567f,
+    0.273959219f,  0.961741310f,
+    0.278991106f,  0.960293686f,
+    0.284015345f,  0.958819735f,
+    0.289031797f,  0.957319498f,
+    0.294040325f,  0.955793015f,
+    0.299040792f,  0.954240329f,
+    0.304033061f,  0.952661481f,
+    0.309016994f,  0.951056516f,
+    0.313992456f,  0.949425478f,
+    0.318959309f,  0.947768410f,
+    0.323917418f,  0.946085359f,
+    0.328866647f,  0.944376370f,
+    0.333806859f,  0.942641491f,
+    0.338737920f,  0.940880769f,
+    0.343659695f,  0.939094252f,
+    0.348572047f,  0.937281989f,
+    0.353474844f,  0.935444031f,
+    0.358367950f,  0.933580426f,
+    0.363251230f,  0.931691228f,
+    0.368124553f,  0.929776486f,
+    0.372987783f,  0.927836254f,
+    0.377840787f,  0.925870585f,
+    0.382683432f,  0.923879533f,
+    0.387515586f,  0.921863152f,
+    0.392337117f,  0.919821497f,
+    0.397147891f,  0.917754626f,
+    0.401947777f,  0.915662593f,
+    0.406736643f,  0.913545458f,
+    0.411514359f,  0.911403277f,
+    0.416280792f,  0.909236109f,
+    0.421035813f,  0.907044014f,
+    0.425779292f,  0.904827052f,
+    0.430511097f,  0.902585284f,
+    0.435231099f,  0.900318771f,
+    0.439939170f,  0.898027576f,
+    0.444635179f,  0.895711760f,
+    0.449318999f,  0.893371388f,
+    0.453990500f,  0.891006524f,
+    0.458649554f,  0.888617233f,
+    0.463296035f,  0.886203579f,
+    0.467929814f,  0.883765630f,
+    0.472550765f,  0.881303452f,
+    0.477158760f,  0.878817113f,
+    0.481753674f,  0.876306680f,
+    0.486335380f,  0.873772223f,
+    0.490903754f,  0.871213811f,
+    0.495458668f,  0.868631514f,
+    0.500000000f,  0.866025404f,
+    0.504527624f,  0.863395551f,
+    0.509041416f,  0.860742027f,
+    0.513541252f,  0.858064906f,
+    0.518027009f,  0.855364260f,
+    0.522498565f,  0.852640164f,
+    0.526955795f,  0.849892693f,
+    0.531398580f,  0.847121921f,
+    0.535826795f,  0.844327926f,
+    0.540240320f,  0.841510782f,
+    0.544639035f,  0.838670568f,
+    0.549022818f,  0.835807361f,
+    0.553391549f,  0.832921241f,
+    0.557745109f,  0.830012285f,
+    0.562083378f,  0.827080574f,
+    0.566406237f,  0.824126189f,
+    0.570713568f,  0.821149209f,
+    0.575005252f,  0.818149717f,
+    0.579281172f,  0.815127796f,
+    0.583541211f,  0.812083527f,
+    0.587785252f,  0.809016994f,
+    0.592013179f,  0.805928282f,
+    0.596224875f,  0.802817475f,
+    0.600420225f,  0.799684658f,
+    0.604599115f,  0.796529918f,
+    0.608761429f,  0.793353340f,
+    0.612907054f,  0.790155012f,
+    0.617035875f,  0.786935022f,
+    0.621147780f,  0.783693457f,
+    0.625242656f,  0.780430407f,
+    0.629320391f,  0.777145961f,
+    0.633380873f,  0.773840210f,
+    0.637423990f,  0.770513243f,
+    0.641449632f,  0.767165152f,
+    0.645457688f,  0.763796029f,
+    0.649448048f,  0.760405966f,
+    0.653420604f,  0.756995056f,
+    0.657375246f,  0.753563392f,
+    0.661311865f,  0.750111070f,
+    0.665230355f,  0.746638182f,
+    0.669130606f,  0.743144825f,
+    0.673012514f,  0.739631095f,
+    0.676875970f,  0.736097087f,
+    0.680720869f,  0.732542899f,
+    0.684547106f,  0.728968627f,
+    0.688354576f,  0.725374371f,
+    0.692143174f,  0.721760228f,
+    0.695912797f,  0.718126298f,
+    0.699663341f,  0.714472680f,
+    0.703394703f,  0.710799474f,
+    0.707106781f,  0.707106781f,
+    0.710799474f,  0.703394703f,
+    0.714472680f,  0.699663341f,
+    0.718126298f,  0.695912797f,
+    0.721760228f,  0.692143174f,
+    0.725374371f,  0.688354576f,
+    0.728968627f,  0.684547106f,
+    0.732542899f,  0.680720869f,
+    0.736097087f,  0.676875970f,
+    0.739631095f,  0.673012514f,
+    0.743144825f,  0.669130606f,
+    0.746638182f,  0.665230355f,
+    0.750111070f,  0.661311865f,
+    0.753563392f,  0.657375246f,
+    0.756995056f,  0.653420604f,
+    0.760405966f,  0.649448048f,
+    0.763796029f,  0.645457688f,
+    0.767165152f,  0.641449632f,
+    0.770513243f,  0.637423990f,
+    0.773840210f,  0.633380873f,
+    0.777145961f,  0.629320391f,
+    0.780430407f,  0.625242656f,
+    0.783693457f,  0.621147780f,
+    0.786935022f,  0.617035875f,
+    0.790155012f,  0.612907054f,
+    0.793353340f,  0.608761429f,
+    0.796529918f,  0.604599115f,
+    0.799684658f,  0.600420225f,
+    0.802817475f,  0.596224875f,
+    0.805928282f,  0.592013179f,
+    0.809016994f,  0.587785252f,
+    0.812083527f,  0.583541211f,
+    0.815127796f,  0.579281172f,
+    0.818149717f,  0.575005252f,
+    0.821149209f,  0.570713568f,
+    0.824126189f,  0.566406237f,
+    0.827080574f,  0.562083378f,
+    0.830012285f,  0.557745109f,
+    0.832921241f,  0.553391549f,
+    0.835807361f,  0.549022818f,
+    0.838670568f,  0.544639035f,
+    0.841510782f,  0.540240320f,
+    0.844327926f,  0.535826795f,
+    0.847121921f,  0.531398580f,
+    0.849892693f,  0.526955795f,
+    0.852640164f,  0.522498565f,
+    0.855364260f,  0.518027009f,
+    0.858064906f,  0.513541252f,
+    0.860742027f,  0.509041416f,
+    0.863395551f,  0.504527624f,
+    0.866025404f,  0.500000000f,
+    0.868631514f,  0.495458668f,
+    0.871213811f,  0.490903754f,
+    0.873772223f,  0.486335380f,
+    0.876306680f,  0.481753674f,
+    0.878817113f,  0.477158760f,
+    0.881303452f,  0.472550765f,
+    0.883765630f,  0.467929814f,
+    0.886203579f,  0.463296035f,
+    0.888617233f,  0.458649554f,
+    0.891006524f,  0.453990500f,
+    0.893371388f,  0.449318999f,
+    0.895711760f,  0.444635179f,
+    0.898027576f,  0.439939170f,
+    0.900318771f,  0.435231099f,
+    0.902585284f,  0.430511097f,
+    0.904827052f,  0.425779292f,
+    0.907044014f,  0.421035813f,
+    0.909236109f,  0.416280792f,
+    0.911403277f,  0.411514359f,
+    0.913545458f,  0.406736643f,
+    0.915662593f,  0.401947777f,
+    0.917754626f,  0.397147891f,
+    0.919821497f,  0.392337117f,
+    0.921863152f,  0.387515586f,
+    0.923879533f,  0.382683432f,
+    0.925870585f,  0.377840787f,
+    0.927836254f,  0.372987783f,
+    0.929776486f,  0.368124553f,
+    0.931691228f,  0.363251230f,
+    0.933580426f,  0.358367950f,
+    0.935444031f,  0.353474844f,
+    0.937281989f,  0.348572047f,
+    0.939094252f,  0.343659695f,
+    0.940880769f,  0.338737920f,
+    0.942641491f,  0.333806859f,
+    0.944376370f,  0.328866647f,
+    0.946085359f,  0.323917418f,
+    0.947768410f,  0.318959309f,
+    0.949425478f,  0.313992456f,
+    0.951056516f,  0.309016994f,
+    0.952661481f,  0.304033061f,
+    0.954240329f,  0.299040792f,
+    0.955793015f,  0.294040325f,
+    0.957319498f,  0.289031797f,
+    0.958819735f,  0.284015345f,
+    0.960293686f,  0.278991106f,
+    0.961741310f,  0.273959219f,
+    0.963162567f,  0.268919821f,
+    0.964557418f,  0.263873050f,
+    0.965925826f,  0.258819045f,
+    0.967267753f,  0.253757945f,
+    0.968583161f,  0.248689887f,
+    0.969872015f,  0.243615012f,
+    0.971134280f,  0.238533458f,
+    0.972369920f,  0.233445364f,
+    0.973578903f,  0.228350870f,
+    0.974761194f,  0.223250116f,
+    0.975916762f,  0.218143241f,
+    0.977045574f,  0.213030386f,
+    0.978147601f,  0.207911691f,
+    0.979222811f,  0.202787295f,
+    0.980271175f,  0.197657340f,
+    0.981292664f,  0.192521967f,
+    0.982287251f,  0.187381315f,
+    0.983254908f,  0.182235525f,
+    0.984195608f,  0.177084740f,
+    0.985109326f,  0.171929100f,
+    0.985996037f,  0.166768747f,
+    0.986855716f,  0.161603821f,
+    0.987688341f,  0.156434465f,
+    0.988493887f,  0.151260820f,
+    0.989272333f,  0.146083029f,
+    0.990023658f,  0.140901232f,
+    0.990747840f,  0.135715572f,
+    0.991444861f,  0.130526192f,
+    0.992114701f,  0.125333234f,
+    0.992757342f,  0.120136839f,
+    0.993372766f,  0.114937150f,
+    0.993960955f,  0.109734311f,
+    0.994521895f,  0.104528463f,
+    0.995055570f,  0.099319750f,
+    0.995561965f,  0.094108313f,
+    0.996041065f,  0.088894297f,
+    0.996492859f,  0.083677843f,
+    0.996917334f,  0.078459096f,
+    0.997314477f,  0.073238197f,
+    0.997684279f,  0.068015291f,
+    0.998026728f,  0.062790520f,
+    0.998341817f,  0.057564027f,
+    0.998629535f,  0.052335956f,
+    0.998889875f,  0.047106451f,
+    0.999122830f,  0.041875654f,
+    0.999328394f,  0.036643709f,
+    0.999506560f,  0.031410759f,
+    0.999657325f,  0.026176948f,
+    0.999780683f,  0.020942420f,
+    0.999876632f,  0.015707317f,
+    0.999945169f,  0.010471784f,
+    0.999986292f,  0.005235964f,
+    1.000000000f,  0.000000000f,
+    0.999986292f, -0.005235964f,
+    0.999945169f, -0.010471784f,
+    0.999876632f, -0.015707317f,
+    0.999780683f, -0.020942420f,
+    0.999657325f, -0.026176948f,
+    0.999506560f, -0.031410759f,
+    0.999328394f, -0.036643709f,
+    0.999122830f, -0.041875654f,
+    0.998889875f, -0.047106451f,
+    0.998629535f, -0.052335956f,
+    0.998341817f, -0.057564027f,
+    0.998026728f, -0.062790520f,
+    0.997684279f, -0.068015291f,
+    0.997314477f, -0.073238197f,
+    0.996917334f, -0.078459096f,
+    0.996492859f, -0.083677843f,
+    0.996041065f, -0.088894297f,
+    0.995561965f, -0.094108313f,
+    0.995055570f, -0.099319750f,
+    0.994521895f, -0.104528463f,
+    0.993960955f, -0.109734311f,
+    0.993372766f, -0.114937150f,
+    0.992757342f, -0.120136839f,
+    0.992114701f, -0.125333234f,
+    0.991444861f, -0.130526192f,
+    0.990747840f, -0.135715572f,
+    0.990023658f, -0.140901232f,
+    0.989272333f, -0.146083029f,
+    0.988493887f, -0.151260820f,
+    0.987688341f, -0.156434465f,
+    0.986855716f, -0.161603821f,
+    0.985996037f, -0.166768747f,
+    0.985109326f, -0.171929100f,
+    0.984195608f, -0.177084740f,
+    0.983254908f, -0.182235525f,
+    0.982287251f, -0.187381315f,
+    0.981292664f, -0.192521967f,
+    0.980271175f, -0.197657340f,
+    0.979222811f, -0.202787295f,
+    0.978147601f, -0.207911691f,
+    0.977045574f, -0.213030386f,
+    0.975916762f, -0.218143241f,
+    0.974761194f, -0.223250116f,
+    0.973578903f, -0.228350870f,
+    0.972369920f, -0.233445364f,
+    0.971134280f, -0.238533458f,
+    0.969872015f, -0.243615012f,
+    0.968583161f, -0.248689887f,
+    0.967267753f, -0.253757945f,
+    0.965925826f, -0.258819045f,
+    0.964557418f, -0.263873050f,
+    0.963162567f, -0.268919821f,
+    0.961741310f, -0.273959219f,
+    0.960293686f, -0.278991106f,
+    0.958819735f, -0.284015345f,
+    0.957319498f, -0.289031797f,
+    0.955793015f, -0.294040325f,
+    0.954240329f, -0.299040792f,
+    0.952661481f, -0.304033061f,
+    0.951056516f, -0.309016994f,
+    0.949425478f, -0.313992456f,
+    0.947768410f, -0.318959309f,
+    0.946085359f, -0.323917418f,
+    0.944376370f, -0.328866647f,
+    0.942641491f, -0.333806859f,
+    0.940880769f, -0.338737920f,
+    0.939094252f, -0.343659695f,
+    0.937281989f, -0.348572047f,
+    0.935444031f, -0.353474844f,
+    0.933580426f, -0.358367950f,
+    0.931691228f, -0.363251230f,
+    0.929776486f, -0.368124553f,
+    0.927836254f, -0.372987783f,
+    0.925870585f, -0.377840787f,
+    0.923879533f, -0.382683432f,
+    0.921863152f, -0.387515586f,
+    0.919821497f, -0.392337117f,
+    0.917754626f, -0.397147891f,
+    0.915662593f, -0.401947777f,
+    0.913545458f, -0.406736643f,
+    0.911403277f, -0.411514359f,
+    0.909236109f, -0.416280792f,
+    0.907044014f, -0.421035813f,
+    0.904827052f, -0.425779292f,
+    0.902585284f, -0.430511097f,
+    0.900318771f, -0.435231099f,
+    0.898027576f, -0.439939170f,
+    0.895711760f, -0.444635179f,
+    0.893371388f, -0.449318999f,
+    0.891006524f, -0.453990500f,
+    0.888617233f, -0.458649554f,
+    0.886203579f, -0.463296035f,
+    0.883765630f, -0.467929814f,
+    0.881303452f, -0.472550765f,
+    0.878817113f, -0.477158760f,
+    0.876306680f, -0.481753674f,
+    0.873772223f, -0.486335380f,
+    0.871213811f, -0.490903754f,
+    0.868631514f, -0.495458668f,
+    0.866025404f, -0.500000000f,
+    0.863395551f, -0.504527624f,
+    0.860742027f, -0.509041416f,
+    0.858064906f, -0.513541252f,
+    0.855364260f, -0.518027009f,
+    0.852640164f, -0.522498565f,
+    0.849892693f, -0.526955795f,
+    0.847121921f, -0.531398580f,
+    0.844327926f, -0.535826795f,
+    0.841510782f, -0.540240320f,
+    0.838670568f, -0.544639035f,
+    0.835807361f, -0.549022818f,
+    0.832921241f, -0.553391549f,
+    0.830012285f, -0.557745109f,
+    0.827080574f, -0.562083378f,
+    0.824126189f, -0.566406237f,
+    0.821149209f, -0.570713568f,
+    0.818149717f, -0.575005252f,
+    0.815127796f, -0.579281172f,
+    0.812083527f, -0.583541211f,
+    0.809016994f, -0.587785252f,
+    0.805928282f, -0.592013179f,
+    0.802817475f, -0.596224875f,
+    0.799684658f, -0.600420225f,
+    0.796529918f, -0.604599115f,
+    0.793353340f, -0.608761429f,
+    0.790155012f, -0.612907054f,
+    0.786935022f, -0.617035875f,
+    0.783693457f, -0.621147780f,
+    0.780430407f, -0.625242656f,
+    0.777145961f, -0.629320391f,
+    0.773840210f, -0.633380873f,
+    0.770513243f, -0.637423990f,
+    0.767165152f, -0.641449632f,
+    0.763796029f, -0.645457688f,
+    0.760405966f, -0.649448048f,
+    0.756995056f, -0.653420604f,
+    0.753563392f, -0.657375246f,
+    0.750111070f, -0.661311865f,
+    0.746638182f, -0.665230355f,
+    0.743144825f, -0.669130606f,
+    0.739631095f, -0.673012514f,
+    0.736097087f, -0.676875970f,
+    0.732542899f, -0.680720869f,
+    0.728968627f, -0.684547106f,
+    0.725374371f, -0.688354576f,
+    0.721760228f, -0.692143174f,
+    0.718126298f, -0.695912797f,
+    0.714472680f, -0.699663341f,
+    0.710799474f, -0.703394703f,
+    0.707106781f, -0.707106781f,
+    0.703394703f, -0.710799474f,
+    0.699663341f, -0.714472680f,
+    0.695912797f, -0.718126298f,
+    0.692143174f, -0.721760228f,
+    0.688354576f, -0.725374371f,
+    0.684547106f, -0.728968627f,
+    0.680720869f, -0.732542899f,
+    0.676875970f, -0.736097087f,
+    0.673012514f, -0.739631095f,
+    0.669130606f, -0.743144825f,
+    0.665230355f, -0.746638182f,
+    0.661311865f, -0.750111070f,
+    0.657375246f, -0.753563392f,
+    0.653420604f, -0.756995056f,
+    0.649448048f, -0.760405966f,
+    0.645457688f, -0.763796029f,
+    0.641449632f, -0.767165152f,
+    0.637423990f, -0.770513243f,
+    0.633380873f, -0.773840210f,
+    0.629320391f, -0.777145961f,
+    0.625242656f, -0.780430407f,
+    0.621147780f, -0.783693457f,
+    0.617035875f, -0.786935022f,
+    0.612907054f, -0.790155012f,
+    0.608761429f, -0.793353340f,
+    0.604599115f, -0.796529918f,
+    0.600420225f, -0.799684658f,
+    0.596224875f, -0.802817475f,
+    0.592013179f, -0.805928282f,
+    0.587785252f, -0.809016994f,
+    0.583541211f, -0.812083527f,
+    0.579281172f, -0.815127796f,
+    0.575005252f, -0.818149717f,
+    0.570713568f, -0.821149209f,
+    0.566406237f, -0.824126189f,
+    0.562083378f, -0.827080574f,
+    0.557745109f, -0.830012285f,
+    0.553391549f, -0.832921241f,
+    0.549022818f, -0.835807361f,
+    0.544639035f, -0.838670568f,
+    0.540240320f, -0.841510782f,
+    0.535826795f, -0.844327926f,
+    0.531398580f, -0.847121921f,
+    0.526955795f, -0.849892693f,
+    0.522498565f, -0.852640164f,
+    0.518027009f, -0.855364260f,
+    0.513541252f, -0.858064906f,
+    0.509041416f, -0.860742027f,
+    0.504527624f, -0.863395551f,
+    0.500000000f, -0.866025404f,
+    0.495458668f, -0.868631514f,
+    0.490903754f, -0.871213811f,
+    0.486335380f, -0.873772223f,
+    0.481753674f, -0.876306680f,
+    0.477158760f, -0.878817113f,
+    0.472550765f, -0.881303452f,
+    0.467929814f, -0.883765630f,
+    0.463296035f, -0.886203579f,
+    0.458649554f, -0.888617233f,
+    0.453990500f, -0.891006524f,
+    0.449318999f, -0.893371388f,
+    0.444635179f, -0.895711760f,
+    0.439939170f, -0.898027576f,
+    0.435231099f, -0.900318771f,
+    0.430511097f, -0.902585284f,
+    0.425779292f, -0.904827052f,
+    0.421035813f, -0.907044014f,
+    0.416280792f, -0.909236109f,
+    0.411514359f, -0.911403277f,
+    0.406736643f, -0.913545458f,
+    0.401947777f, -0.915662593f,
+    0.397147891f, -0.917754626f,
+    0.392337117f, -0.919821497f,
+    0.387515586f, -0.921863152f,
+    0.382683432f, -0.923879533f,
+    0.377840787f, -0.925870585f,
+    0.372987783f, -0.927836254f,
+    0.368124553f, -0.929776486f,
+    0.363251230f, -0.931691228f,
+    0.358367950f, -0.933580426f,
+    0.353474844f, -0.935444031f,
+    0.348572047f, -0.937281989f,
+    0.343659695f, -0.939094252f,
+    0.338737920f, -0.940880769f,
+    0.333806859f, -0.942641491f,
+    0.328866647f, -0.944376370f,
+    0.323917418f, -0.946085359f,
+    0.318959309f, -0.947768410f,
+    0.313992456f, -0.949425478f,
+    0.309016994f, -0.951056516f,
+    0.304033061f, -0.952661481f,
+    0.299040792f, -0.954240329f,
+    0.294040325f, -0.955793015f,
+    0.289031797f, -0.957319498f,
+    0.284015345f, -0.958819735f,
+    0.278991106f, -0.960293686f,
+    0.273959219f, -0.961741310f,
+    0.268919821f, -0.963162567f,
+    0.263873050f, -0.964557418f,
+    0.258819045f, -0.965925826f,
+    0.253757945f, -0.967267753f,
+    0.248689887f, -0.968583161f,
+    0.243615012f, -0.969872015f,
+    0.238533458f, -0.971134280f,
+    0.233445364f, -0.972369920f,
+    0.228350870f, -0.973578903f,
+    0.223250116f, -0.974761194f,
+    0.218143241f, -0.975916762f,
+    0.213030386f, -0.977045574f,
+    0.207911691f, -0.978147601f,
+    0.202787295f, -0.979222811f,
+    0.197657340f, -0.980271175f,
+    0.192521967f, -0.981292664f,
+    0.187381315f, -0.982287251f,
+    0.182235525f, -0.983254908f,
+    0.177084740f, -0.984195608f,
+    0.171929100f, -0.985109326f,
+    0.166768747f, -0.985996037f,
+    0.161603821f, -0.986855716f,
+    0.156434465f, -0.987688341f,
+    0.151260820f, -0.988493887f,
+    0.146083029f, -0.989272333f,
+    0.140901232f, -0.990023658f,
+    0.135715572f, -0.990747840f,
+    0.130526192f, -0.991444861f,
+    0.125333234f, -0.992114701f,
+    0.120136839f, -0.992757342f,
+    0.114937150f, -0.993372766f,
+    0.109734311f, -0.993960955f,
+    0.104528463f, -0.994521895f,
+    0.099319750f, -0.995055570f,
+    0.094108313f, -0.995561965f,
+    0.088894297f, -0.996041065f,
+    0.083677843f, -0.996492859f,
+    0.078459096f, -0.996917334f,
+    0.073238197f, -0.997314477f,
+    0.068015291f, -0.997684279f,
+    0.062790520f, -0.998026728f,
+    0.057564027f, -0.998341817f,
+    0.052335956f, -0.998629535f,
+    0.047106451f, -0.998889875f,
+    0.041875654f, -0.999122830f,
+    0.036643709f, -0.999328394f,
+    0.031410759f, -0.999506560f,
+    0.026176948f, -0.999657325f,
+    0.020942420f, -0.999780683f,
+    0.015707317f, -0.999876632f,
+    0.010471784f, -0.999945169f,
+    0.005235964f, -0.999986292f
+};
+#endif
+
+#if defined(ARM_TABLE_RFFT_F32_1536)
+const float32_t twiddleCoef_rfft_1536[1536] ARM_DSP_TABLE_ATTR = {
+    0.000000000f,  1.000000000f,
+    0.004090604f,  0.999991633f,
+    0.008181140f,  0.999966534f,
     0.012271538f,  0.999924702f,
-    0.013805389f,  0.999904701f,
-    0.015339206f,  0.999882347f,
-    0.016872988f,  0.999857641f,
-    0.018406730f,  0.999830582f,
-    0.019940429f,  0.999801170f,
-    0.021474080f,  0.999769405f,
-    0.023007681f,  0.999735288f,
+    0.016361732f,  0.999866138f,
+    0.020451651f,  0.999790843f,
     0.024541229f,  0.999698819f,
-    0.026074718f,  0.999659997f,
-    0.027608146f,  0.999618822f,
-    0.029141509f,  0.999575296f,
-    0.030674803f,  0.999529418f,
-    0.032208025f,  0.999481187f,
-    0.033741172f,  0.999430605f,
-    0.035274239f,  0.999377670f,
+    0.028630395f,  0.999590066f,
+    0.032719083f,  0.999464587f,
     0.036807223f,  0.999322385f,
-    0.038340120f,  0.999264747f,
-    0.039872928f,  0.999204759f,
-    0.041405641f,  0.999142419f,
-    0.042938257f,  0.999077728f,
-    0.044470772f,  0.999010686f,
-    0.046003182f,  0.998941293f,
-    0.047535484f,  0.998869550f,
+    0.040894747f,  0.999163460f,
+    0.044981587f,  0.998987816f,
     0.049067674f,  0.998795456f,
-    0.050599749f,  0.998719012f,
-    0.052131705f,  0.998640218f,
-    0.053663538f,  0.998559074f,
-    0.055195244f,  0.998475581f,
-    0.056726821f,  0.998389737f,
-    0.058258265f,  0.998301545f,
-    0.059789571f,  0.998211003f,
+    0.053152941f,  0.998586383f,
+    0.057237317f,  0.998360601f,
     0.061320736f,  0.998118113f,
-    0.062851758f,  0.998022874f,
-    0.064382631f,  0.997925286f,
-    0.065913353f,  0.997825350f,
-    0.067443920f,  0.997723067f,
-    0.068974328f,  0.997618435f,
-    0.070504573f,  0.997511456f,
-    0.072034653f,  0.997402130f,
-    0.073564564f,  0.997290457f,
-    0.075094301f,  0.997176437f,
-    0.076623861f,  0.997060070f,
-    0.078153242f,  0.996941358f,
-    0.079682438f,  0.996820299f,
-    0.081211447f,  0.996696895f,
-    0.082740265f,  0.996571146f,
-    0.084268888f,  0.996443051f,
-    0.085797312f,  0.996312612f,
-    0.087325535f,  0.996179829f,
-    0.088853553f,  0.996044701f,
-    0.090381361f,  0.995907229f,
-    0.091908956f,  0.995767414f,
-    0.093436336f,  0.995625256f,
-    0.094963495f,  0.995480755f,
-    0.096490431f,  0.995333912f,
+    0.065403129f,  0.997858923f,
+    0.069484428f,  0.997583036f,
+    0.073564564f,  0.997290457f,
+    0.077643468f,  0.996981189f,
+    0.081721074f,  0.996655239f,
+    0.085797312f,  0.996312612f,
+    0.089872115f,  0.995953314f,
+    0.093945414f,  0.995577350f,
     0.098017140f,  0.995184727f,
-    0.099543619f,  0.995033199f,
-    0.101069863f,  0.994879331f,
-    0.102595869f,  0.994723121f,
-    0.104121634f,  0.994564571f,
-    0.105647154f,  0.994403680f,
-    0.107172425f,  0.994240449f,
-    0.108697444f,  0.994074879f,
+    0.102087227f,  0.994775451f,
+    0.106155605f,  0.994349530f,
     0.110222207f,  0.993906970f,
-    0.111746711f,  0.993736722f,
-    0.113270952f,  0.993564136f,
-    0.114794927f,  0.993389211f,
-    0.116318631f,  0.993211949f,
-    0.117842062f,  0.993032350f,
-    0.119365215f,  0.992850414f,
-    0.120888087f,  0.992666142f,
+    0.114286965f,  0.993447779f,
+    0.118349810f,  0.992971965f,
     0.122410675f,  0.992479535f,
-    0.123932975f,  0.992290591f,
-    0.125454983f,  0.992099313f,
-    0.126976696f,  0.991905700f,
-    0.128498111f,  0.991709754f,
-    0.130019223f,  0.991511473f,
-    0.131540029f,  0.991310860f,
-    0.133060525f,  0.991107914f,
+    0.126469492f,  0.991970497f,
+    0.130526192f,  0.991444861f,
     0.134580709f,  0.990902635f,
-    0.136100575f,  0.990695025f,
-    0.137620122f,  0.990485084f,
-    0.139139344f,  0.990272812f,
-    0.140658239f,  0.990058210f,
-    0.142176804f,  0.989841278f,
-    0.143695033f,  0.989622017f,
-    0.145212925f,  0.989400428f,
+    0.138632973f,  0.990343829f,
+    0.142682917f,  0.989768450f,
     0.146730474f,  0.989176510f,
-    0.148247679f,  0.988950265f,
-    0.149764535f,  0.988721692f,
-    0.151281038f,  0.988490793f,
-    0.152797185f,  0.988257568f,
-    0.154312973f,  0.988022017f,
-    0.155828398f,  0.987784142f,
-    0.157343456f,  0.987543942f,
+    0.150775576f,  0.988568018f,
+    0.154818155f,  0.987942984f,
     0.158858143f,  0.987301418f,
-    0.160372457f,  0.987056571f,
-    0.161886394f,  0.986809402f,
-    0.163399949f,  0.986559910f,
-    0.164913120f,  0.986308097f,
-    0.166425904f,  0.986053963f,
-    0.167938295f,  0.985797509f,
-    0.169450291f,  0.985538735f,
+    0.162895473f,  0.986643332f,
+    0.166930078f,  0.985968736f,
     0.170961889f,  0.985277642f,
-    0.172473084f,  0.985014231f,
-    0.173983873f,  0.984748502f,
-    0.175494253f,  0.984480455f,
-    0.177004220f,  0.984210092f,
-    0.178513771f,  0.983937413f,
-    0.180022901f,  0.983662419f,
-    0.181531608f,  0.983385110f,
+    0.174990839f,  0.984570062f,
+    0.179016861f,  0.983846006f,
     0.183039888f,  0.983105487f,
-    0.184547737f,  0.982823551f,
-    0.186055152f,  0.982539302f,
-    0.187562129f,  0.982252741f,
-    0.189068664f,  0.981963869f,
-    0.190574755f,  0.981672686f,
-    0.192080397f,  0.981379193f,
-    0.193585587f,  0.981083391f,
+    0.187059852f,  0.982348519f,
+    0.191076686f,  0.981575112f,
     0.195090322f,  0.980785280f,
-    0.196594598f,  0.980484862f,
-    0.198098411f,  0.980182136f,
-    0.199601758f,  0.979877104f,
-    0.201104635f,  0.979569766f,
-    0.202607039f,  0.979260123f,
-    0.204108966f,  0.978948175f,
-    0.205610413f,  0.978633924f,
+    0.199100694f,  0.979979037f,
+    0.203107734f,  0.979156396f,
     0.207111376f,  0.978317371f,
-    0.208611852f,  0.977998515f,
-    0.210111837f,  0.977677358f,
-    0.211611327f,  0.977353900f,
-    0.213110320f,  0.977028143f,
-    0.214608811f,  0.976700086f,
-    0.216106797f,  0.976369731f,
-    0.217604275f,  0.976037079f,
+    0.211111552f,  0.977461975f,
+    0.215108196f,  0.976590223f,
     0.219101240f,  0.975702130f,
-    0.220597690f,  0.975364885f,
-    0.222093621f,  0.975025345f,
-    0.223589029f,  0.974683511f,
-    0.225083911f,  0.974339383f,
-    0.226578264f,  0.973992962f,
-    0.228072083f,  0.973644250f,
-    0.229565366f,  0.973293246f,
+    0.223090618f,  0.974797710f,
+    0.227076263f,  0.973876979f,
     0.231058108f,  0.972939952f,
-    0.232550307f,  0.972584369f,
-    0.234041959f,  0.972226497f,
-    0.235533059f,  0.971866337f,
-    0.237023606f,  0.971503891f,
-    0.238513595f,  0.971139158f,
-    0.240003022f,  0.970772141f,
-    0.241491885f,  0.970402839f,
+    0.235036087f,  0.971986645f,
+    0.239010133f,  0.971017073f,
     0.242980180f,  0.970031253f,
-    0.244467903f,  0.969657385f,
-    0.245955050f,  0.969281235f,
-    0.247441619f,  0.968902805f,
-    0.248927606f,  0.968522094f,
-    0.250413007f,  0.968139105f,
-    0.251897818f,  0.967753837f,
-    0.253382037f,  0.967366292f,
+    0.246946161f,  0.969029202f,
+    0.250908009f,  0.968010935f,
     0.254865660f,  0.966976471f,
-    0.256348682f,  0.966584374f,
-    0.257831102f,  0.966190003f,
-    0.259312915f,  0.965793359f,
-    0.260794118f,  0.965394442f,
-    0.262274707f,  0.964993253f,
-    0.263754679f,  0.964589793f,
-    0.265234030f,  0.964184064f,
+    0.258819045f,  0.965925826f,
+    0.262768100f,  0.964859019f,
     0.266712757f,  0.963776066f,
-    0.268190857f,  0.963365800f,
-    0.269668326f,  0.962953267f,
-    0.271145160f,  0.962538468f,
-    0.272621355f,  0.962121404f,
-    0.274096910f,  0.961702077f,
-    0.275571819f,  0.961280486f,
-    0.277046080f,  0.960856633f,
+    0.270652952f,  0.962676986f,
+    0.274588618f,  0.961561798f,
     0.278519689f,  0.960430519f,
-    0.279992643f,  0.960002146f,
-    0.281464938f,  0.959571513f,
-    0.282936570f,  0.959138622f,
-    0.284407537f,  0.958703475f,
-    0.285877835f,  0.958266071f,
-    0.287347460f,  0.957826413f,
-    0.288816408f,  0.957384501f,
+    0.282446100f,  0.959283170f,
+    0.286367785f,  0.958119769f,
     0.290284677f,  0.956940336f,
-    0.291752263f,  0.956493919f,
-    0.293219163f,  0.956045251f,
-    0.294685372f,  0.955594334f,
-    0.296150888f,  0.955141168f,
-    0.297615707f,  0.954685755f,
-    0.299079826f,  0.954228095f,
-    0.300543241f,  0.953768190f,
+    0.294196713f,  0.955744890f,
+    0.298103825f,  0.954533451f,
     0.302005949f,  0.953306040f,
-    0.303467947f,  0.952841648f,
-    0.304929230f,  0.952375013f,
-    0.306389795f,  0.951906137f,
-    0.307849640f,  0.951435021f,
-    0.309308760f,  0.950961666f,
-    0.310767153f,  0.950486074f,
-    0.312224814f,  0.950008245f,
+    0.305903020f,  0.952062678f,
+    0.309794972f,  0.950803384f,
     0.313681740f,  0.949528181f,
-    0.315137929f,  0.949045882f,
-    0.316593376f,  0.948561350f,
-    0.318048077f,  0.948074586f,
-    0.319502031f,  0.947585591f,
-    0.320955232f,  0.947094366f,
-    0.322407679f,  0.946600913f,
-    0.323859367f,  0.946105232f,
+    0.317563260f,  0.948237089f,
+    0.321439465f,  0.946930129f,
     0.325310292f,  0.945607325f,
-    0.326760452f,  0.945107193f,
-    0.328209844f,  0.944604837f,
-    0.329658463f,  0.944100258f,
-    0.331106306f,  0.943593458f,
-    0.332553370f,  0.943084437f,
-    0.333999651f,  0.942573198f,
-    0.335445147f,  0.942059740f,
+    0.329175676f,  0.944268698f,
+    0.333035551f,  0.942914271f,
     0.336889853f,  0.941544065f,
-    0.338333767f,  0.941026175f,
-    0.339776884f,  0.940506071f,
-    0.341219202f,  0.939983753f,
-    0.342660717f,  0.939459224f,
-    0.344101426f,  0.938932484f,
-    0.345541325f,  0.938403534f,
-    0.346980411f,  0.937872376f,
+    0.340738519f,  0.940158105f,
+    0.344581482f,  0.938756412f,
     0.348418680f,  0.937339012f,
-    0.349856130f,  0.936803442f,
-    0.351292756f,  0.936265667f,
-    0.352728556f,  0.935725689f,
-    0.354163525f,  0.935183510f,
-    0.355597662f,  0.934639130f,
-    0.357030961f,  0.934092550f,
-    0.358463421f,  0.933543773f,
+    0.352250048f,  0.935905927f,
+    0.356075521f,  0.934457181f,
     0.359895037f,  0.932992799f,
-    0.361325806f,  0.932439629f,
-    0.362755724f,  0.931884266f,
-    0.364184790f,  0.931326709f,
-    0.365612998f,  0.930766961f,
-    0.367040346f,  0.930205023f,
-    0.368466830f,  0.929640896f,
-    0.369892447f,  0.929074581f,
+    0.363708530f,  0.931512805f,
+    0.367515937f,  0.930017224f,
     0.371317194f,  0.928506080f,
-    0.372741067f,  0.927935395f,
-    0.374164063f,  0.927362526f,
-    0.375586178f,  0.926787474f,
-    0.377007410f,  0.926210242f,
-    0.378427755f,  0.925630831f,
-    0.379847209f,  0.925049241f,
-    0.381265769f,  0.924465474f,
+    0.375112238f,  0.926979400f,
+    0.378901005f,  0.925437209f,
     0.382683432f,  0.923879533f,
-    0.384100195f,  0.923291417f,
-    0.385516054f,  0.922701128f,
-    0.386931006f,  0.922108669f,
-    0.388345047f,  0.921514039f,
-    0.389758174f,  0.920917242f,
-    0.391170384f,  0.920318277f,
-    0.392581674f,  0.919717146f,
+    0.386459456f,  0.922306396f,
+    0.390229013f,  0.920717827f,
     0.393992040f,  0.919113852f,
-    0.395401479f,  0.918508394f,
-    0.396809987f,  0.917900776f,
-    0.398217562f,  0.917290997f,
-    0.399624200f,  0.916679060f,
-    0.401029897f,  0.916064966f,
-    0.402434651f,  0.915448716f,
-    0.403838458f,  0.914830312f,
+    0.397748475f,  0.917494496f,
+    0.401498253f,  0.915859789f,
     0.405241314f,  0.914209756f,
-    0.406643217f,  0.913587048f,
-    0.408044163f,  0.912962190f,
-    0.409444149f,  0.912335185f,
-    0.410843171f,  0.911706032f,
-    0.412241227f,  0.911074734f,
-    0.413638312f,  0.910441292f,
-    0.415034424f,  0.909805708f,
+    0.408977594f,  0.912544425f,
+    0.412707030f,  0.910863825f,
     0.416429560f,  0.909167983f,
-    0.417823716f,  0.908528119f,
-    0.419216888f,  0.907886116f,
-    0.420609074f,  0.907241978f,
-    0.422000271f,  0.906595705f,
-    0.423390474f,  0.905947298f,
-    0.424779681f,  0.905296759f,
-    0.426167889f,  0.904644091f,
+    0.420145122f,  0.907456928f,
+    0.423853654f,  0.905730688f,
     0.427555093f,  0.903989293f,
-    0.428941292f,  0.903332368f,
-    0.430326481f,  0.902673318f,
-    0.431710658f,  0.902012144f,
-    0.433093819f,  0.901348847f,
-    0.434475961f,  0.900683429f,
-    0.435857080f,  0.900015892f,
-    0.437237174f,  0.899346237f,
+    0.431249379f,  0.902232771f,
+    0.434936447f,  0.900461152f,
     0.438616239f,  0.898674466f,
-    0.439994271f,  0.898000580f,
-    0.441371269f,  0.897324581f,
-    0.442747228f,  0.896646470f,
-    0.444122145f,  0.895966250f,
-    0.445496017f,  0.895283921f,
-    0.446868840f,  0.894599486f,
-    0.448240612f,  0.893912945f,
+    0.442288690f,  0.896872742f,
+    0.445953741f,  0.895056010f,
     0.449611330f,  0.893224301f,
-    0.450980989f,  0.892533555f,
-    0.452349587f,  0.891840709f,
-    0.453717121f,  0.891145765f,
-    0.455083587f,  0.890448723f,
-    0.456448982f,  0.889749586f,
-    0.457813304f,  0.889048356f,
-    0.459176548f,  0.888345033f,
+    0.453261395f,  0.891377646f,
+    0.456903876f,  0.889516075f,
     0.460538711f,  0.887639620f,
-    0.461899791f,  0.886932119f,
-    0.463259784f,  0.886222530f,
-    0.464618686f,  0.885510856f,
-    0.465976496f,  0.884797098f,
-    0.467333209f,  0.884081259f,
-    0.468688822f,  0.883363339f,
-    0.470043332f,  0.882643340f,
+    0.464165840f,  0.885748312f,
+    0.467785202f,  0.883842183f,
     0.471396737f,  0.881921264f,
-    0.472749032f,  0.881197113f,
-    0.474100215f,  0.880470889f,
-    0.475450282f,  0.879742593f,
-    0.476799230f,  0.879012226f,
-    0.478147056f,  0.878279792f,
-    0.479493758f,  0.877545290f,
-    0.480839331f,  0.876808724f,
+    0.475000384f,  0.879985588f,
+    0.478596082f,  0.878035187f,
     0.482183772f,  0.876070094f,
-    0.483527079f,  0.875329403f,
-    0.484869248f,  0.874586652f,
-    0.486210276f,  0.873841843f,
-    0.487550160f,  0.873094978f,
-    0.488888897f,  0.872346059f,
-    0.490226483f,  0.871595087f,
-    0.491562916f,  0.870842063f,
-    0.492898192f,  0.870086991f,
-    0.494232309f,  0.869329871f,
-    0.495565262f,  0.868570706f,
-    0.496897049f,  0.867809497f,
-    0.498227667f,  0.867046246f,
-    0.499557113f,  0.866280954f,
-    0.500885383f,  0.865513624f,
-    0.502212474f,  0.864744258f,
-    0.503538384f,  0.863972856f,
-    0.504863109f,  0.863199422f,
-    0.506186645f,  0.862423956f,
-    0.507508991f,  0.861646461f,
-    0.508830143f,  0.860866939f,
-    0.510150097f,  0.860085390f,
-    0.511468850f,  0.859301818f,
-    0.512786401f,  0.858516224f,
+    0.485763394f,  0.874090342f,
+    0.489334887f,  0.872095963f,
+    0.492898192f,  0.870086991f,
+    0.496453250f,  0.868063460f,
+    0.500000000f,  0.866025404f,
+    0.503538384f,  0.863972856f,
+    0.507068342f,  0.861905852f,
+    0.510589815f,  0.859824425f,
     0.514102744f,  0.857728610f,
-    0.515417878f,  0.856938977f,
-    0.516731799f,  0.856147328f,
-    0.518044504f,  0.855353665f,
-    0.519355990f,  0.854557988f,
-    0.520666254f,  0.853760301f,
-    0.521975293f,  0.852960605f,
-    0.523283103f,  0.852158902f,
+    0.517607071f,  0.855618443f,
+    0.521102737f,  0.853493959f,
     0.524589683f,  0.851355193f,
-    0.525895027f,  0.850549481f,
-    0.527199135f,  0.849741768f,
-    0.528502002f,  0.848932055f,
-    0.529803625f,  0.848120345f,
-    0.531104001f,  0.847306639f,
-    0.532403128f,  0.846490939f,
-    0.533701002f,  0.845673247f,
+    0.528067851f,  0.849202182f,
+    0.531537182f,  0.847034960f,
     0.534997620f,  0.844853565f,
-    0.536292979f,  0.844031895f,
-    0.537587076f,  0.843208240f,
-    0.538879909f,  0.842382600f,
-    0.540171473f,  0.841554977f,
-    0.541461766f,  0.840725375f,
-    0.542750785f,  0.839893794f,
-    0.544038527f,  0.839060237f,
+    0.538449105f,  0.842658033f,
+    0.541891581f,  0.840448401f,
     0.545324988f,  0.838224706f,
-    0.546610167f,  0.837387202f,
-    0.547894059f,  0.836547727f,
-    0.549176662f,  0.835706284f,
-    0.550457973f,  0.834862875f,
-    0.551737988f,  0.834017501f,
-    0.553016706f,  0.833170165f,
-    0.554294121f,  0.832320868f,
+    0.548749271f,  0.835986984f,
+    0.552164372f,  0.833735274f,
     0.555570233f,  0.831469612f,
-    0.556845037f,  0.830616400f,
-    0.558118531f,  0.829761234f,
-    0.559390712f,  0.828904115f,
-    0.560661576f,  0.828045045f,
-    0.561931121f,  0.827184027f,
-    0.563199344f,  0.826321063f,
-    0.564466242f,  0.825456154f,
+    0.558966798f,  0.829190038f,
+    0.562354009f,  0.826896589f,
     0.565731811f,  0.824589303f,
-    0.566996049f,  0.823720511f,
-    0.568258953f,  0.822849781f,
-    0.569520519f,  0.821977115f,
-    0.570780746f,  0.821102515f,
-    0.572039629f,  0.820225983f,
-    0.573297167f,  0.819347520f,
-    0.574553355f,  0.818467130f,
+    0.569100146f,  0.822268219f,
+    0.572458958f,  0.819933376f,
     0.575808191f,  0.817584813f,
-    0.577061673f,  0.816700573f,
-    0.578313796f,  0.815814411f,
-    0.579564559f,  0.814926329f,
-    0.580813958f,  0.814036330f,
-    0.582061990f,  0.813144415f,
-    0.583308653f,  0.812250587f,
-    0.584553943f,  0.811354847f,
+    0.579147790f,  0.815222569f,
+    0.582477697f,  0.812846685f,
     0.585797857f,  0.810457198f,
-    0.587040394f,  0.809557642f,
-    0.588281548f,  0.808656182f,
-    0.589521319f,  0.807752818f,
-    0.590759702f,  0.806847554f,
-    0.591996695f,  0.805940391f,
-    0.593232295f,  0.805031331f,
-    0.594466499f,  0.804120377f,
+    0.589108216f,  0.808054150f,
+    0.592408717f,  0.805637581f,
     0.595699304f,  0.803207531f,
-    0.596930708f,  0.802292796f,
-    0.598160707f,  0.801376172f,
-    0.599389298f,  0.800457662f,
-    0.600616479f,  0.799537269f,
-    0.601842247f,  0.798614995f,
-    0.603066599f,  0.797690841f,
-    0.604289531f,  0.796764810f,
+    0.598979925f,  0.800764041f,
+    0.602250522f,  0.798307152f,
     0.605511041f,  0.795836905f,
-    0.606731127f,  0.794907126f,
-    0.607949785f,  0.793975478f,
-    0.609167012f,  0.793041960f,
-    0.610382806f,  0.792106577f,
-    0.611597164f,  0.791169330f,
-    0.612810082f,  0.790230221f,
-    0.614021559f,  0.789289253f,
+    0.608761429f,  0.793353340f,
+    0.612001630f,  0.790856501f,
     0.615231591f,  0.788346428f,
-    0.616440175f,  0.787401747f,
-    0.617647308f,  0.786455214f,
-    0.618852988f,  0.785506830f,
-    0.620057212f,  0.784556597f,
-    0.621259977f,  0.783604519f,
-    0.622461279f,  0.782650596f,
-    0.623661118f,  0.781694832f,
+    0.618451256f,  0.785823163f,
+    0.621660573f,  0.783286749f,
     0.624859488f,  0.780737229f,
-    0.626056388f,  0.779777788f,
-    0.627251815f,  0.778816512f,
-    0.628445767f,  0.777853404f,
-    0.629638239f,  0.776888466f,
-    0.630829230f,  0.775921699f,
-    0.632018736f,  0.774953107f,
-    0.633206755f,  0.773982691f,
+    0.628047947f,  0.778174644f,
+    0.631225897f,  0.775599038f,
     0.634393284f,  0.773010453f,
-    0.635578320f,  0.772036397f,
-    0.636761861f,  0.771060524f,
-    0.637943904f,  0.770082837f,
-    0.639124445f,  0.769103338f,
-    0.640303482f,  0.768122029f,
-    0.641481013f,  0.767138912f,
-    0.642657034f,  0.766153990f,
+    0.637550056f,  0.770408934f,
+    0.640696160f,  0.767794524f,
     0.643831543f,  0.765167266f,
-    0.645004537f,  0.764178741f,
-    0.646176013f,  0.763188417f,
-    0.647345969f,  0.762196298f,
-    0.648514401f,  0.761202385f,
-    0.649681307f,  0.760206682f,
-    0.650846685f,  0.759209189f,
-    0.652010531f,  0.758209910f,
+    0.646956153f,  0.762527204f,
+    0.650069937f,  0.759874383f,
     0.653172843f,  0.757208847f,
-    0.654333618f,  0.756206001f,
-    0.655492853f,  0.755201377f,
-    0.656650546f,  0.754194975f,
-    0.657806693f,  0.753186799f,
-    0.658961293f,  0.752176850f,
-    0.660114342f,  0.751165132f,
-    0.661265838f,  0.750151646f,
+    0.656264820f,  0.754530640f,
+    0.659345815f,  0.751839807f,
     0.662415778f,  0.749136395f,
-    0.663564159f,  0.748119380f,
-    0.664710978f,  0.747100606f,
-    0.665856234f,  0.746080074f,
-    0.666999922f,  0.745057785f,
-    0.668142041f,  0.744033744f,
-    0.669282588f,  0.743007952f,
-    0.670421560f,  0.741980412f,
+    0.665474656f,  0.746420446f,
+    0.668522399f,  0.743692008f,
     0.671558955f,  0.740951125f,
-    0.672694769f,  0.739920095f,
-    0.673829000f,  0.738887324f,
-    0.674961646f,  0.737852815f,
-    0.676092704f,  0.736816569f,
-    0.677222170f,  0.735778589f,
-    0.678350043f,  0.734738878f,
-    0.679476320f,  0.733697438f,
+    0.674584274f,  0.738197844f,
+    0.677598305f,  0.735432211f,
     0.680600998f,  0.732654272f,
-    0.681724074f,  0.731609381f,
-    0.682845546f,  0.730562769f,
-    0.683965412f,  0.729514438f,
-    0.685083668f,  0.728464390f,
-    0.686200312f,  0.727412629f,
-    0.687315341f,  0.726359155f,
-    0.688428753f,  0.725303972f,
+    0.683592302f,  0.729864073f,
+    0.686572168f,  0.727061661f,
     0.689540545f,  0.724247083f,
-    0.690650714f,  0.723188489f,
-    0.691759258f,  0.722128194f,
-    0.692866175f,  0.721066199f,
-    0.693971461f,  0.720002508f,
-    0.695075114f,  0.718937122f,
-    0.696177131f,  0.717870045f,
-    0.697277511f,  0.716801279f,
+    0.692497384f,  0.721420386f,
+    0.695442635f,  0.718581618f,
     0.698376249f,  0.715730825f,
-    0.699473345f,  0.714658688f,
-    0.700568794f,  0.713584869f,
-    0.701662595f,  0.712509371f,
-    0.702754744f,  0.711432196f,
-    0.703845241f,  0.710353347f,
-    0.704934080f,  0.709272826f,
-    0.706021261f,  0.708190637f,
+    0.701298178f,  0.712868056f,
+    0.704208371f,  0.709993359f,
     0.707106781f,  0.707106781f,
-    0.708190637f,  0.706021261f,
-    0.709272826f,  0.704934080f,
-    0.710353347f,  0.703845241f,
-    0.711432196f,  0.702754744f,
-    0.712509371f,  0.701662595f,
-    0.713584869f,  0.700568794f,
-    0.714658688f,  0.699473345f,
+    0.709993359f,  0.704208371f,
+    0.712868056f,  0.701298178f,
     0.715730825f,  0.698376249f,
-    0.716801279f,  0.697277511f,
-    0.717870045f,  0.696177131f,
-    0.718937122f,  0.695075114f,
-    0.720002508f,  0.693971461f,
-    0.721066199f,  0.692866175f,
-    0.722128194f,  0.691759258f,
-    0.723188489f,  0.690650714f,
+    0.718581618f,  0.695442635f,
+    0.721420386f,  0.692497384f,
     0.724247083f,  0.689540545f,
-    0.725303972f,  0.688428753f,
-    0.726359155f,  0.687315341f,
-    0.727412629f,  0.686200312f,
-    0.728464390f,  0.685083668f,
-    0.729514438f,  0.683965412f,
-    0.730562769f,  0.682845546f,
-    0.731609381f,  0.681724074f,
+    0.727061661f,  0.686572168f,
+    0.729864073f,  0.683592302f,
     0.732654272f,  0.680600998f,
-    0.733697438f,  0.679476320f,
-    0.734738878f,  0.678350043f,
-    0.735778589f,  0.677222170f,
-    0.736816569f,  0.676092704f,
-    0.737852815f,  0.674961646f,
-    0.738887324f,  0.673829000f,
-    0.739920095f,  0.672694769f,
+    0.735432211f,  0.677598305f,
+    0.738197844f,  0.674584274f,
     0.740951125f,  0.671558955f,
-    0.741980412f,  0.670421560f,
-    0.743007952f,  0.669282588f,
-    0.744033744f,  0.668142041f,
-    0.745057785f,  0.666999922f,
-    0.746080074f,  0.665856234f,
-    0.747100606f,  0.664710978f,
-    0.748119380f,  0.663564159f,
+    0.743692008f,  0.668522399f,
+    0.746420446f,  0.665474656f,
     0.749136395f,  0.662415778f,
-    0.750151646f,  0.661265838f,
-    0.751165132f,  0.660114342f,
-    0.752176850f,  0.658961293f,
-    0.753186799f,  0.657806693f,
-    0.754194975f,  0.656650546f,
-    0.755201377f,  0.655492853f,
-    0.756206001f,  0.654333618f,
+    0.751839807f,  0.659345815f,
+    0.754530640f,  0.656264820f,
     0.757208847f,  0.653172843f,
-    0.758209910f,  0.652010531f,
-    0.759209189f,  0.650846685f,
-    0.760206682f,  0.649681307f,
-    0.761202385f,  0.648514401f,
-    0.762196298f,  0.647345969f,
-    0.763188417f,  0.646176013f,
-    0.764178741f,  0.645004537f,
+    0.759874383f,  0.650069937f,
+    0.762527204f,  0.646956153f,
     0.765167266f,  0.643831543f,
-    0.766153990f,  0.642657034f,
-    0.767138912f,  0.641481013f,
-    0.768122029f,  0.640303482f,
-    0.769103338f,  0.639124445f,
-    0.770082837f,  0.637943904f,
-    0.771060524f,  0.636761861f,
-    0.772036397f,  0.635578320f,
+    0.767794524f,  0.640696160f,
+    0.770408934f,  0.637550056f,
     0.773010453f,  0.634393284f,
-    0.773982691f,  0.633206755f,
-    0.774953107f,  0.632018736f,
-    0.775921699f,  0.630829230f,
-    0.776888466f,  0.629638239f,
-    0.777853404f,  0.628445767f,
-    0.778816512f,  0.627251815f,
-    0.779777788f,  0.626056388f,
+    0.775599038f,  0.631225897f,
+    0.778174644f,  0.628047947f,
     0.780737229f,  0.624859488f,
-    0.781694832f,  0.623661118f,
-    0.782650596f,  0.622461279f,
-    0.783604519f,  0.621259977f,
-    0.784556597f,  0.620057212f,
-    0.785506830f,  0.618852988f,
-    0.786455214f,  0.617647308f,
-    0.787401747f,  0.616440175f,
+    0.783286749f,  0.621660573f,
+    0.785823163f,  0.618451256f,
     0.788346428f,  0.615231591f,
-    0.789289253f,  0.614021559f,
-    0.790230221f,  0.612810082f,
-    0.791169330f,  0.611597164f,
-    0.792106577f,  0.610382806f,
-    0.793041960f,  0.609167012f,
-    0.793975478f,  0.607949785f,
-    0.794907126f,  0.606731127f,
+    0.790856501f,  0.612001630f,
+    0.793353340f,  0.608761429f,
     0.795836905f,  0.605511041f,
-    0.796764810f,  0.604289531f,
-    0.797690841f,  0.603066599f,
-    0.798614995f,  0.601842247f,
-    0.799537269f,  0.600616479f,
-    0.800457662f,  0.599389298f,
-    0.801376172f,  0.598160707f,
-    0.802292796f,  0.596930708f,
+    0.798307152f,  0.602250522f,
+    0.800764041f,  0.598979925f,
     0.803207531f,  0.595699304f,
-    0.804120377f,  0.594466499f,
-    0.805031331f,  0.593232295f,
-    0.805940391f,  0.591996695f,
-    0.806847554f,  0.590759702f,
-    0.807752818f,  0.589521319f,
-    0.808656182f,  0.588281548f,
-    0.809557642f,  0.587040394f,
+    0.805637581f,  0.592408717f,
+    0.808054150f,  0.589108216f,
     0.810457198f,  0.585797857f,
-    0.811354847f,  0.584553943f,
-    0.812250587f,  0.583308653f,
-    0.813144415f,  0.582061990f,
-    0.814036330f,  0.580813958f,
-    0.814926329f,  0.579564559f,
-    0.815814411f,  0.578313796f,
-    0.816700573f,  0.577061673f,
-    0.817584813f,  0.575808191f,
-    0.818467130f,  0.574553355f,
-    0.819347520f,  0.573297167f,
-    0.820225983f,  0.572039629f,
-    0.821102515f,  0.570780746f,
-    0.821977115f,  0.569520519f,
-    0.822849781f,  0.568258953f,
-    0.823720511f,  0.566996049f,
-    0.824589303f,  0.565731811f,
-    0.825456154f,  0.564466242f,
-    0.826321063f,  0.563199344f,
-    0.827184027f,  0.561931121f,
-    0.828045045f,  0.560661576f,
-    0.828904115f,  0.559390712f,
-    0.829761234f,  0.558118531f,
-    0.830616400f,  0.556845037f,
+    0.812846685f,  0.582477697f,
+    0.815222569f,  0.579147790f,
+    0.817584813f,  0.575808191f,
+    0.819933376f,  0.572458958f,
+    0.822268219f,  0.569100146f,
+    0.824589303f,  0.565731811f,
+    0.826896589f,  0.562354009f,
+    0.829190038f,  0.558966798f,
     0.831469612f,  0.555570233f,
-    0.832320868f,  0.554294121f,
-    0.833170165f,  0.553016706f,
-    0.834017501f,  0.551737988f,
-    0.834862875f,  0.550457973f,
-    0.835706284f,  0.549176662f,
-    0.836547727f,  0.547894059f,
-    0.837387202f,  0.546610167f,
+    0.833735274f,  0.552164372f,
+    0.835986984f,  0.548749271f,
     0.838224706f,  0.545324988f,
-    0.839060237f,  0.544038527f,
-    0.839893794f,  0.542750785f,
-    0.840725375f,  0.541461766f,
-    0.841554977f,  0.540171473f,
-    0.842382600f,  0.538879909f,
-    0.843208240f,  0.537587076f,
-    0.844031895f,  0.536292979f,
+    0.840448401f,  0.541891581f,
+    0.842658033f,  0.538449105f,
     0.844853565f,  0.534997620f,
-    0.845673247f,  0.533701002f,
-    0.846490939f,  0.532403128f,
-    0.847306639f,  0.531104001f,
-    0.848120345f,  0.529803625f,
-    0.848932055f,  0.528502002f,
-    0.849741768f,  0.527199135f,
-    0.850549481f,  0.525895027f,
+    0.847034960f,  0.531537182f,
+    0.849202182f,  0.528067851f,
     0.851355193f,  0.524589683f,
-    0.852158902f,  0.523283103f,
-    0.852960605f,  0.521975293f,
-    0.853760301f,  0.520666254f,
-    0.854557988f,  0.519355990f,
-    0.855353665f,  0.518044504f,
-    0.856147328f,  0.516731799f,
-    0.856938977f,  0.515417878f,
+    0.853493959f,  0.521102737f,
+    0.855618443f,  0.517607071f,
     0.857728610f,  0.514102744f,
-    0.858516224f,  0.512786401f,
-    0.859301818f,  0.511468850f,
-    0.860085390f,  0.510150097f,
-    0.860866939f,  0.508830143f,
-    0.861646461f,  0.507508991f,
-    0.862423956f,  0.506186645f,
-    0.863199422f,  0.504863109f,
+    0.859824425f,  0.510589815f,
+    0.861905852f,  0.507068342f,
     0.863972856f,  0.503538384f,
-    0.864744258f,  0.502212474f,
-    0.865513624f,  0.500885383f,
-    0.866280954f,  0.499557113f,
-    0.867046246f,  0.498227667f,
-    0.867809497f,  0.496897049f,
-    0.868570706f,  0.495565262f,
-    0.869329871f,  0.494232309f,
+    0.866025404f,  0.500000000f,
+    0.868063460f,  0.496453250f,
     0.870086991f,  0.492898192f,
-    0.870842063f,  0.491562916f,
-    0.871595087f,  0.490226483f,
-    0.872346059f,  0.488888897f,
-    0.873094978f,  0.487550160f,
-    0.873841843f,  0.486210276f,
-    0.874586652f,  0.484869248f,
-    0.875329403f,  0.483527079f,
+    0.872095963f,  0.489334887f,
+    0.874090342f,  0.485763394f,
     0.876070094f,  0.482183772f,
-    0.876808724f,  0.480839331f,
-    0.877545290f,  0.479493758f,
-    0.878279792f,  0.478147056f,
-    0.879012226f,  0.476799230f,
-    0.879742593f,  0.475450282f,
-    0.880470889f,  0.474100215f,
-    0.881197113f,  0.472749032f,
+    0.878035187f,  0.478596082f,
+    0.879985588f,  0.475000384f,
     0.881921264f,  0.471396737f,
-    0.882643340f,  0.470043332f,
-    0.883363339f,  0.468688822f,
-    0.884081259f,  0.467333209f,
-    0.884797098f,  0.465976496f,
-    0.885510856f,  0.464618686f,
-    0.886222530f,  0.463259784f,
-    0.886932119f,  0.461899791f,
+    0.883842183f,  0.467785202f,
+    0.885748312f,  0.464165840f,
     0.887639620f,  0.460538711f,
-    0.888345033f,  0.459176548f,
-    0.889048356f,  0.457813304f,
-    0.889749586f,  0.456448982f,
-    0.890448723f,  0.455083587f,
-    0.891145765f,  0.453717121f,
-    0.891840709f,  0.452349587f,
-    0.892533555f,  0.450980989f,
+    0.889516075f,  0.456903876f,
+    0.891377646f,  0.453261395f,
     0.893224301f,  0.449611330f,
-    0.893912945f,  0.448240612f,
-    0.894599486f,  0.446868840f,
-    0.895283921f,  0.445496017f,
-    0.895966250f,  0.444122145f,
-    0.896646470f,  0.442747228f,
-    0.897324581f,  0.441371269f,
-    0.898000580f,  0.439994271f,
+    0.895056010f,  0.445953741f,
+    0.896872742f,  0.442288690f,
     0.898674466f,  0.438616239f,
-    0.899346237f,  0.437237174f,
-    0.900015892f,  0.435857080f,
-    0.900683429f,  0.434475961f,
-    0.901348847f,  0.433093819f,
-    0.902012144f,  0.431710658f,
-    0.902673318f,  0.430326481f,
-    0.903332368f,  0.428941292f,
+    0.900461152f,  0.434936447f,
+    0.902232771f,  0.431249379f,
     0.903989293f,  0.427555093f,
-    0.904644091f,  0.426167889f,
-    0.905296759f,  0.424779681f,
-    0.905947298f,  0.423390474f,
-    0.906595705f,  0.422000271f,
-    0.907241978f,  0.420609074f,
-    0.907886116f,  0.419216888f,
-    0.908528119f,  0.417823716f,
+    0.905730688f,  0.423853654f,
+    0.907456928f,  0.420145122f,
     0.909167983f,  0.416429560f,
-    0.909805708f,  0.415034424f,
-    0.910441292f,  0.413638312f,
-    0.911074734f,  0.412241227f,
-    0.911706032f,  0.410843171f,
-    0.912335185f,  0.409444149f,
-    0.912962190f,  0.408044163f,
-    0.913587048f,  0.406643217f,
+    0.910863825f,  0.412707030f,
+    0.912544425f,  0.408977594f,
     0.914209756f,  0.405241314f,
-    0.914830312f,  0.403838458f,
-    0.915448716f,  0.402434651f,
-    0.916064966f,  0.401029897f,
-    0.916679060f,  0.399624200f,
-    0.917290997f,  0.398217562f,
-    0.917900776f,  0.396809987f,
-    0.918508394f,  0.395401479f,
+    0.915859789f,  0.401498253f,
+    0.917494496f,  0.397748475f,
     0.919113852f,  0.393992040f,
-    0.919717146f,  0.392581674f,
-    0.920318277f,  0.391170384f,
-    0.920917242f,  0.389758174f,
-    0.921514039f,  0.388345047f,
-    0.922108669f,  0.386931006f,
-    0.922701128f,  0.385516054f,
-    0.923291417f,  0.384100195f,
+    0.920717827f,  0.390229013f,
+    0.922306396f,  0.386459456f,
     0.923879533f,  0.382683432f,
-    0.924465474f,  0.381265769f,
-    0.925049241f,  0.379847209f,
-    0.925630831f,  0.378427755f,
-    0.926210242f,  0.377007410f,
-    0.926787474f,  0.375586178f,
-    0.927362526f,  0.374164063f,
-    0.927935395f,  0.372741067f,
+    0.925437209f,  0.378901005f,
+    0.926979400f,  0.375112238f,
     0.928506080f,  0.371317194f,
-    0.929074581f,  0.369892447f,
-    0.929640896f,  0.368466830f,
-    0.930205023f,  0.367040346f,
-    0.930766961f,  0.365612998f,
-    0.931326709f,  0.364184790f,
-    0.931884266f,  0.362755724f,
-    0.932439629f,  0.361325806f,
+    0.930017224f,  0.367515937f,
+    0.931512805f,  0.363708530f,
     0.932992799f,  0.359895037f,
-    0.933543773f,  0.358463421f,
-    0.934092550f,  0.357030961f,
-    0.934639130f,  0.355597662f,
-    0.935183510f,  0.354163525f,
-    0.935725689f,  0.352728556f,
-    0.936265667f,  0.351292756f,
-    0.936803442f,  0.349856130f,
+    0.934457181f,  0.356075521f,
+    0.935905927f,  0.352250048f,
     0.937339012f,  0.348418680f,
-    0.937872376f,  0.346980411f,
-    0.938403534f,  0.345541325f,
-    0.938932484f,  0.344101426f,
-    0.939459224f,  0.342660717f,
-    0.939983753f,  0.341219202f,
-    0.940506071f,  0.339776884f,
-    0.941026175f,  0.338333767f,
+    0.938756412f,  0.344581482f,
+    0.940158105f,  0.340738519f,
     0.941544065f,  0.336889853f,
-    0.942059740f,  0.335445147f,
-    0.942573198f,  0.333999651f,
-    0.943084437f,  0.332553370f,
-    0.943593458f,  0.331106306f,
-    0.944100258f,  0.329658463f,
-    0.944604837f,  0.328209844f,
-    0.945107193f,  0.326760452f,
+    0.942914271f,  0.333035551f,
+    0.944268698f,  0.329175676f,
     0.945607325f,  0.325310292f,
-    0.946105232f,  0.323859367f,
-    0.946600913f,  0.322407679f,
-    0.947094366f,  0.320955232f,
-    0.947585591f,  0.319502031f,
-    0.948074586f,  0.318048077f,
-    0.948561350f,  0.316593376f,
-    0.949045882f,  0.315137929f,
+    0.946930129f,  0.321439465f,
+    0.948237089f,  0.317563260f,
     0.949528181f,  0.313681740f,
-    0.950008245f,  0.312224814f,
-    0.950486074f,  0.310767153f,
-    0.950961666f,  0.309308760f,
-    0.951435021f,  0.307849640f,
-    0.951906137f,  0.306389795f,
-    0.952375013f,  0.304929230f,
-    0.952841648f,  0.303467947f,
+    0.950803384f,  0.309794972f,
+    0.952062678f,  0.305903020f,
     0.953306040f,  0.302005949f,
-    0.953768190f,  0.300543241f,
-    0.954228095f,  0.299079826f,
-    0.954685755f,  0.297615707f,
-    0.955141168f,  0.296150888f,
-    0.955594334f,  0.294685372f,
-    0.956045251f,  0.293219163f,
-    0.956493919f,  0.291752263f,
+    0.954533451f,  0.298103825f,
+    0.955744890f,  0.294196713f,
     0.956940336f,  0.290284677f,
-    0.957384501f,  0.288816408f,
-    0.957826413f,  0.287347460f,
-    0.958266071f,  0.285877835f,
-    0.958703475f,  0.284407537f,
-    0.959138622f,  0.282936570f,
-    0.959571513f,  0.281464938f,
-    0.960002146f,  0.279992643f,
+    0.958119769f,  0.286367785f,
+    0.959283170f,  0.282446100f,
     0.960430519f,  0.278519689f,
-    0.960856633f,  0.277046080f,
-    0.961280486f,  0.275571819f,
-    0.961702077f,  0.274096910f,
-    0.962121404f,  0.272621355f,
-    0.962538468f,  0.271145160f,
-    0.962953267f,  0.269668326f,
-    0.963365800f,  0.268190857f,
+    0.961561798f,  0.274588618f,
+    0.962676986f,  0.270652952f,
     0.963776066f,  0.266712757f,
-    0.964184064f,  0.265234030f,
-    0.964589793f,  0.263754679f,
-    0.964993253f,  0.262274707f,
-    0.965394442f,  0.260794118f,
-    0.965793359f,  0.259312915f,
-    0.966190003f,  0.257831102f,
-    0.966584374f,  0.256348682f,
+    0.964859019f,  0.262768100f,
+    0.965925826f,  0.258819045f,
     0.966976471f,  0.254865660f,
-    0.967366292f,  0.253382037f,
-    0.967753837f,  0.251897818f,
-    0.968139105f,  0.250413007f,
-    0.968522094f,  0.248927606f,
-    0.968902805f,  0.247441619f,
-    0.969281235f,  0.245955050f,
-    0.969657385f,  0.244467903f,
+    0.968010935f,  0.250908009f,
+    0.969029202f,  0.246946161f,
     0.970031253f,  0.242980180f,
-    0.970402839f,  0.241491885f,
-    0.970772141f,  0.240003022f,
-    0.971139158f,  0.238513595f,
-    0.971503891f,  0.237023606f,
-    0.971866337f,  0.235533059f,
-    0.972226497f,  0.234041959f,
-    0.972584369f,  0.232550307f,
+    0.971017073f,  0.239010133f,
+    0.971986645f,  0.235036087f,
     0.972939952f,  0.231058108f,
-    0.973293246f,  0.229565366f,
-    0.973644250f,  0.228072083f,
-    0.973992962f,  0.226578264f,
-    0.974339383f,  0.225083911f,
-    0.974683511f,  0.223589029f,
-    0.975025345f,  0.222093621f,
-    0.975364885f,  0.220597690f,
+    0.973876979f,  0.227076263f,
+    0.974797710f,  0.223090618f,
     0.975702130f,  0.219101240f,
-    0.976037079f,  0.217604275f,
-    0.976369731f,  0.216106797f,
-    0.976700086f,  0.214608811f,
-    0.977028143f,  0.213110320f,
-    0.977353900f,  0.211611327f,
-    0.977677358f,  0.210111837f,
-    0.977998515f,  0.208611852f,
+    0.976590223f,  0.215108196f,
+    0.977461975f,  0.211111552f,
     0.978317371f,  0.207111376f,
-    0.978633924f,  0.205610413f,
-    0.978948175f,  0.204108966f,
-    0.979260123f,  0.202607039f,
-    0.979569766f,  0.201104635f,
-    0.979877104f,  0.199601758f,
-    0.980182136f,  0.198098411f,
-    0.980484862f,  0.196594598f,
+    0.979156396f,  0.203107734f,
+    0.979979037f,  0.199100694f,
     0.980785280f,  0.195090322f,
-    0.981083391f,  0.193585587f,
-    0.981379193f,  0.192080397f,
-    0.981672686f,  0.190574755f,
-    0.981963869f,  0.189068664f,
-    0.982252741f,  0.187562129f,
-    0.982539302f,  0.186055152f,
-    0.982823551f,  0.184547737f,
+    0.981575112f,  0.191076686f,
+    0.982348519f,  0.187059852f,
     0.983105487f,  0.183039888f,
-    0.983385110f,  0.181531608f,
-    0.983662419f,  0.180022901f,
-    0.983937413f,  0.178513771f,
-    0.984210092f,  0.177004220f,
-    0.984480455f,  0.175494253f,
-    0.984748502f,  0.173983873f,
-    0.985014231f,  0.172473084f,
-    0.985277642f,  0.170961889f,
-    0.985538735f,  0.169450291f,
-    0.985797509f,  0.167938295f,
-    0.986053963f,  0.166425904f,
-    0.986308097f,  0.164913120f,
-    0.986559910f,  0.163399949f,
-    0.986809402f,  0.161886394f,
-    0.987056571f,  0.160372457f,
-    0.987301418f,  0.158858143f,
-    0.987543942f,  0.157343456f,
-    0.987784142f,  0.155828398f,
-    0.988022017f,  0.154312973f,
-    0.988257568f,  0.152797185f,
-    0.988490793f,  0.151281038f,
-    0.988721692f,  0.149764535f,
-    0.988950265f,  0.148247679f,
+    0.983846006f,  0.179016861f,
+    0.984570062f,  0.174990839f,
+    0.985277642f,  0.170961889f,
+    0.985968736f,  0.166930078f,
+    0.986643332f,  0.162895473f,
+    0.987301418f,  0.158858143f,
+    0.987942984f,  0.154818155f,
+    0.988568018f,  0.150775576f,
     0.989176510f,  0.146730474f,
-    0.989400428f,  0.145212925f,
-    0.989622017f,  0.143695033f,
-    0.989841278f,  0.142176804f,
-    0.990058210f,  0.140658239f,
-    0.990272812f,  0.139139344f,
-    0.990485084f,  0.137620122f,
-    0.990695025f,  0.136100575f,
+    0.989768450f,  0.142682917f,
+    0.990343829f,  0.138632973f,
     0.990902635f,  0.134580709f,
-    0.991107914f,  0.133060525f,
-    0.991310860f,  0.131540029f,
-    0.991511473f,  0.130019223f,
-    0.991709754f,  0.128498111f,
-    0.991905700f,  0.126976696f,
-    0.992099313f,  0.125454983f,
-    0.992290591f,  0.123932975f,
+    0.991444861f,  0.130526192f,
+    0.991970497f,  0.126469492f,
     0.992479535f,  0.122410675f,
-    0.992666142f,  0.120888087f,
-    0.992850414f,  0.119365215f,
-    0.993032350f,  0.117842062f,
-    0.993211949f,  0.116318631f,
-    0.993389211f,  0.114794927f,
-    0.993564136f,  0.113270952f,
-    0.993736722f,  0.111746711f,
+    0.992971965f,  0.118349810f,
+    0.993447779f,  0.114286965f,
     0.993906970f,  0.110222207f,
-    0.994074879f,  0.108697444f,
-    0.994240449f,  0.107172425f,
-    0.994403680f,  0.105647154f,
-    0.994564571f,  0.104121634f,
-    0.994723121f,  0.102595869f,
-    0.994879331f,  0.101069863f,
-    0.995033199f,  0.099543619f,
+    0.994349530f,  0.106155605f,
+    0.994775451f,  0.102087227f,
     0.995184727f,  0.098017140f,
-    0.995333912f,  0.096490431f,
-    0.995480755f,  0.094963495f,
-    0.995625256f,  0.093436336f,
-    0.995767414f,  0.091908956f,
-    0.995907229f,  0.090381361f,
-    0.996044701f,  0.088853553f,
-    0.996179829f,  0.087325535f,
+    0.995577350f,  0.093945414f,
+    0.995953314f,  0.089872115f,
     0.996312612f,  0.085797312f,
-    0.996443051f,  0.084268888f,
-    0.996571146f,  0.082740265f,
-    0.996696895f,  0.081211447f,
-    0.996820299f,  0.079682438f,
-    0.996941358f,  0.078153242f,
-    0.997060070f,  0.076623861f,
-    0.997176437f,  0.075094301f,
+    0.996655239f,  0.081721074f,
+    0.996981189f,  0.077643468f,
     0.997290457f,  0.073564564f,
-    0.997402130f,  0.072034653f,
-    0.997511456f,  0.070504573f,
-    0.997618435f,  0.068974328f,
-    0.997723067f,  0.067443920f,
-    0.997825350f,  0.065913353f,
-    0.997925286f,  0.064382631f,
-    0.998022874f,  0.062851758f,
+    0.997583036f,  0.069484428f,
+    0.997858923f,  0.065403129f,
     0.998118113f,  0.061320736f,
-    0.998211003f,  0.059789571f,
-    0.998301545f,  0.058258265f,
-    0.998389737f,  0.056726821f,
-    0.998475581f,  0.055195244f,
-    0.998559074f,  0.053663538f,
-    0.998640218f,  0.052131705f,
-    0.998719012f,  0.050599749f,
+    0.998360601f,  0.057237317f,
+    0.998586383f,  0.053152941f,
     0.998795456f,  0.049067674f,
-    0.998869550f,  0.047535484f,
-    0.998941293f,  0.046003182f,
-    0.999010686f,  0.044470772f,
-    0.999077728f,  0.042938257f,
-    0.999142419f,  0.041405641f,
-    0.999204759f,  0.039872928f,
-    0.999264747f,  0.038340120f,
+    0.998987816f,  0.044981587f,
+    0.999163460f,  0.040894747f,
     0.999322385f,  0.036807223f,
-    0.999377670f,  0.035274239f,
-    0.999430605f,  0.033741172f,
-    0.999481187f,  0.032208025f,
-    0.999529418f,  0.030674803f,
-    0.999575296f,  0.029141509f,
-    0.999618822f,  0.027608146f,
-    0.999659997f,  0.026074718f,
+    0.999464587f,  0.032719083f,
+    0.999590066f,  0.028630395f,
     0.999698819f,  0.024541229f,
-    0.999735288f,  0.023007681f,
-    0.999769405f,  0.021474080f,
-    0.999801170f,  0.019940429f,
-    0.999830582f,  0.018406730f,
-    0.999857641f,  0.016872988f,
-    0.999882347f,  0.015339206f,
-    0.999904701f,  0.013805389f,
+    0.999790843f,  0.020451651f,
+    0.999866138f,  0.016361732f,
     0.999924702f,  0.012271538f,
-    0.999942350f,  0.010737659f,
-    0.999957645f,  0.009203755f,
-    0.999970586f,  0.007669829f,
-    0.999981175f,  0.006135885f,
-    0.999989411f,  0.004601926f,
-    0.999995294f,  0.003067957f,
-    0.999998823f,  0.001533980f,
+    0.999966534f,  0.008181140f,
+    0.999991633f,  0.004090604f,
     1.000000000f,  0.000000000f,
-    0.999998823f, -0.001533980f,
-    0.999995294f, -0.003067957f,
-    0.999989411f, -0.004601926f,
-    0.999981175f, -0.006135885f,
-    0.999970586f, -0.007669829f,
-    0.999957645f, -0.009203755f,
-    0.999942350f, -0.010737659f,
+    0.999991633f, -0.004090604f,
+    0.999966534f, -0.008181140f,
     0.999924702f, -0.012271538f,
-    0.999904701f, -0.013805389f,
-    0.999882347f, -0.015339206f,
-    0.999857641f, -0.016872988f,
-    0.999830582f, -0.018406730f,
-    0.999801170f, -0.019940429f,
-    0.999769405f, -0.021474080f,
-    0.999735288f, -0.023007681f,
+    0.999866138f, -0.016361732f,
+    0.999790843f, -0.020451651f,
     0.999698819f, -0.024541229f,
-    0.999659997f, -0.026074718f,
-    0.999618822f, -0.027608146f,
-    0.999575296f, -0.029141509f,
-    0.999529418f, -0.030674803f,
-    0.999481187f, -0.032208025f,
-    0.999430605f, -0.033741172f,
-    0.999377670f, -0.035274239f,
+    0.999590066f, -0.028630395f,
+    0.999464587f, -0.032719083f,
     0.999322385f, -0.036807223f,
-    0.999264747f, -0.038340120f,
-    0.999204759f, -0.039872928f,
-    0.999142419f, -0.041405641f,
-    0.999077728f, -0.042938257f,
-    0.999010686f, -0.044470772f,
-    0.998941293f, -0.046003182f,
-    0.998869550f, -0.047535484f,
+    0.999163460f, -0.040894747f,
+    0.998987816f, -0.044981587f,
     0.998795456f, -0.049067674f,
-    0.998719012f, -0.050599749f,
-    0.998640218f, -0.052131705f,
-    0.998559074f, -0.053663538f,
-    0.998475581f, -0.055195244f,
-    0.998389737f, -0.056726821f,
-    0.998301545f, -0.058258265f,
-    0.998211003f, -0.059789571f,
+    0.998586383f, -0.053152941f,
+    0.998360601f, -0.057237317f,
     0.998118113f, -0.061320736f,
-    0.998022874f, -0.062851758f,
-    0.997925286f, -0.064382631f,
-    0.997825350f, -0.065913353f,
-    0.997723067f, -0.067443920f,
-    0.997618435f, -0.068974328f,
-    0.997511456f, -0.070504573f,
-    0.997402130f, -0.072034653f,
+    0.997858923f, -0.065403129f,
+    0.997583036f, -0.069484428f,
     0.997290457f, -0.073564564f,
-    0.997176437f, -0.075094301f,
-    0.997060070f, -0.076623861f,
-    0.996941358f, -0.078153242f,
-    0.996820299f, -0.079682438f,
-    0.996696895f, -0.081211447f,
-    0.996571146f, -0.082740265f,
-    0.996443051f, -0.084268888f,
+    0.996981189f, -0.077643468f,
+    0.996655239f, -0.081721074f,
     0.996312612f, -0.085797312f,
-    0.996179829f, -0.087325535f,
-    0.996044701f, -0.088853553f,
-    0.995907229f, -0.090381361f,
-    0.995767414f, -0.091908956f,
-    0.995625256f, -0.093436336f,
-    0.995480755f, -0.094963495f,
-    0.995333912f, -0.096490431f,
+    0.995953314f, -0.089872115f,
+    0.995577350f, -0.093945414f,
     0.995184727f, -0.098017140f,
-    0.995033199f, -0.099543619f,
-    0.994879331f, -0.101069863f,
-    0.994723121f, -0.102595869f,
-    0.994564571f, -0.104121634f,
-    0.994403680f, -0.105647154f,
-    0.994240449f, -0.107172425f,
-    0.994074879f, -0.108697444f,
+    0.994775451f, -0.102087227f,
+    0.994349530f, -0.106155605f,
     0.993906970f, -0.110222207f,
-    0.993736722f, -0.111746711f,
-    0.993564136f, -0.113270952f,
-    0.993389211f, -0.114794927f,
-    0.993211949f, -0.116318631f,
-    0.993032350f, -0.117842062f,
-    0.992850414f, -0.119365215f,
-    0.992666142f, -0.120888087f,
+    0.993447779f, -0.114286965f,
+    0.992971965f, -0.118349810f,
     0.992479535f, -0.122410675f,
-    0.992290591f, -0.123932975f,
-    0.992099313f, -0.125454983f,
-    0.991905700f, -0.126976696f,
-    0.991709754f, -0.128498111f,
-    0.991511473f, -0.130019223f,
-    0.991310860f, -0.131540029f,
-    0.991107914f, -0.133060525f,
+    0.991970497f, -0.126469492f,
+    0.991444861f, -0.130526192f,
     0.990902635f, -0.134580709f,
-    0.990695025f, -0.136100575f,
-    0.990485084f, -0.137620122f,
-    0.990272812f, -0.139139344f,
-    0.990058210f, -0.140658239f,
-    0.989841278f, -0.142176804f,
-    0.989622017f, -0.143695033f,
-    0.989400428f, -0.145212925f,
+    0.990343829f, -0.138632973f,
+    0.989768450f, -0.142682917f,
     0.989176510f, -0.146730474f,
-    0.988950265f, -0.148247679f,
-    0.988721692f, -0.149764535f,
-    0.988490793f, -0.151281038f,
-    0.988257568f, -0.152797185f,
-    0.988022017f, -0.154312973f,
-    0.987784142f, -0.155828398f,
-    0.987543942f, -0.157343456f,
+    0.988568018f, -0.150775576f,
+    0.987942984f, -0.154818155f,
     0.987301418f, -0.158858143f,
-    0.987056571f, -0.160372457f,
-    0.986809402f, -0.161886394f,
-    0.986559910f, -0.163399949f,
-    0.986308097f, -0.164913120f,
-    0.986053963f, -0.166425904f,
-    0.985797509f, -0.167938295f,
-    0.985538735f, -0.169450291f,
+    0.986643332f, -0.162895473f,
+    0.985968736f, -0.166930078f,
     0.985277642f, -0.170961889f,
-    0.985014231f, -0.172473084f,
-    0.984748502f, -0.173983873f,
-    0.984480455f, -0.175494253f,
-    0.984210092f, -0.177004220f,
-    0.983937413f, -0.178513771f,
-    0.983662419f, -0.180022901f,
-    0.983385110f, -0.181531608f,
+    0.984570062f, -0.174990839f,
+    0.983846006f, -0.179016861f,
     0.983105487f, -0.183039888f,
-    0.982823551f, -0.184547737f,
-    0.982539302f, -0.186055152f,
-    0.982252741f, -0.187562129f,
-    0.981963869f, -0.189068664f,
-    0.981672686f, -0.190574755f,
-    0.981379193f, -0.192080397f,
-    0.981083391f, -0.193585587f,
+    0.982348519f, -0.187059852f,
+    0.981575112f, -0.191076686f,
     0.980785280f, -0.195090322f,
-    0.980484862f, -0.196594598f,
-    0.980182136f, -0.198098411f,
-    0.979877104f, -0.199601758f,
-    0.979569766f, -0.201104635f,
-    0.979260123f, -0.202607039f,
-    0.978948175f, -0.204108966f,
-    0.978633924f, -0.205610413f,
+    0.979979037f, -0.199100694f,
+    0.979156396f, -0.203107734f,
     0.978317371f, -0.207111376f,
-    0.977998515f, -0.208611852f,
-    0.977677358f, -0.210111837f,
-    0.977353900f, -0.211611327f,
-    0.977028143f, -0.213110320f,
-    0.976700086f, -0.214608811f,
-    0.976369731f, -0.216106797f,
-    0.976037079f, -0.217604275f,
+    0.977461975f, -0.211111552f,
+    0.976590223f, -0.215108196f,
     0.975702130f, -0.219101240f,
-    0.975364885f, -0.220597690f,
-    0.975025345f, -0.222093621f,
-    0.974683511f, -0.223589029f,
-    0.974339383f, -0.225083911f,
-    0.973992962f, -0.226578264f,
-    0.973644250f, -0.228072083f,
-    0.973293246f, -0.229565366f,
+    0.974797710f, -0.223090618f,
+    0.973876979f, -0.227076263f,
     0.972939952f, -0.231058108f,
-    0.972584369f, -0.232550307f,
-    0.972226497f, -0.234041959f,
-    0.971866337f, -0.235533059f,
-    0.971503891f, -0.237023606f,
-    0.971139158f, -0.238513595f,
-    0.970772141f, -0.240003022f,
-    0.970402839f, -0.241491885f,
+    0.971986645f, -0.235036087f,
+    0.971017073f, -0.239010133f,
     0.970031253f, -0.242980180f,
-    0.969657385f, -0.244467903f,
-    0.969281235f, -0.245955050f,
-    0.968902805f, -0.247441619f,
-    0.968522094f, -0.248927606f,
-    0.968139105f, -0.250413007f,
-    0.967753837f, -0.251897818f,
-    0.967366292f, -0.253382037f,
+    0.969029202f, -0.246946161f,
+    0.968010935f, -0.250908009f,
     0.966976471f, -0.254865660f,
-    0.966584374f, -0.256348682f,
-    0.966190003f, -0.257831102f,
-    0.965793359f, -0.259312915f,
-    0.965394442f, -0.260794118f,
-    0.964993253f, -0.262274707f,
-    0.964589793f, -0.263754679f,
-    0.964184064f, -0.265234030f,
-    0.963776066f, -0.266712757f,
-    0.963365800f, -0.268190857f,
-    0.962953267f, -0.269668326f,
-    0.962538468f, -0.271145160f,
-    0.962121404f, -0.272621355f,
-    0.961702077f, -0.274096910f,
-    0.961280486f, -0.275571819f,
-    0.960856633f, -0.277046080f,
-    0.960430519f, -0.278519689f,
-    0.960002146f, -0.279992643f,
-    0.959571513f, -0.281464938f,
-    0.959138622f, -0.282936570f,
-    0.958703475f, -0.284407537f,
-    0.958266071f, -0.285877835f,
-    0.957826413f, -0.287347460f,
-    0.957384501f, -0.288816408f,
+    0.965925826f, -0.258819045f,
+    0.964859019f, -0.262768100f,
+    0.963776066f, -0.266712757f,
+    0.962676986f, -0.270652952f,
+    0.961561798f, -0.274588618f,
+    0.960430519f, -0.278519689f,
+    0.959283170f, -0.282446100f,
+    0.958119769f, -0.286367785f,
     0.956940336f, -0.290284677f,
-    0.956493919f, -0.291752263f,
-    0.956045251f, -0.293219163f,
-    0.955594334f, -0.294685372f,
-    0.955141168f, -0.296150888f,
-    0.954685755f, -0.297615707f,
-    0.954228095f, -0.299079826f,
-    0.953768190f, -0.300543241f,
+    0.955744890f, -0.294196713f,
+    0.954533451f, -0.298103825f,
     0.953306040f, -0.302005949f,
-    0.952841648f, -0.303467947f,
-    0.952375013f, -0.304929230f,
-    0.951906137f, -0.306389795f,
-    0.951435021f, -0.307849640f,
-    0.950961666f, -0.309308760f,
-    0.950486074f, -0.310767153f,
-    0.950008245f, -0.312224814f,
+    0.952062678f, -0.305903020f,
+    0.950803384f, -0.309794972f,
     0.949528181f, -0.313681740f,
-    0.949045882f, -0.315137929f,
-    0.948561350f, -0.316593376f,
-    0.948074586f, -0.318048077f,
-    0.947585591f, -0.319502031f,
-    0.947094366f, -0.320955232f,
-    0.946600913f, -0.322407679f,
-    0.946105232f, -0.323859367f,
+    0.948237089f, -0.317563260f,
+    0.946930129f, -0.321439465f,
     0.945607325f, -0.325310292f,
-    0.945107193f, -0.326760452f,
-    0.944604837f, -0.328209844f,
-    0.944100258f, -0.329658463f,
-    0.943593458f, -0.331106306f,
-    0.943084437f, -0.332553370f,
-    0.942573198f, -0.333999651f,
-    0.942059740f, -0.335445147f,
+    0.944268698f, -0.329175676f,
+    0.942914271f, -0.333035551f,
     0.941544065f, -0.336889853f,
-    0.941026175f, -0.338333767f,
-    0.940506071f, -0.339776884f,
-    0.939983753f, -0.341219202f,
-    0.939459224f, -0.342660717f,
-    0.938932484f, -0.344101426f,
-    0.938403534f, -0.345541325f,
-    0.937872376f, -0.346980411f,
+    0.940158105f, -0.340738519f,
+    0.938756412f, -0.344581482f,
     0.937339012f, -0.348418680f,
-    0.936803442f, -0.349856130f,
-    0.936265667f, -0.351292756f,
-    0.935725689f, -0.352728556f,
-    0.935183510f, -0.354163525f,
-    0.934639130f, -0.355597662f,
-    0.934092550f, -0.357030961f,
-    0.933543773f, -0.358463421f,
+    0.935905927f, -0.352250048f,
+    0.934457181f, -0.356075521f,
     0.932992799f, -0.359895037f,
-    0.932439629f, -0.361325806f,
-    0.931884266f, -0.362755724f,
-    0.931326709f, -0.364184790f,
-    0.930766961f, -0.365612998f,
-    0.930205023f, -0.367040346f,
-    0.929640896f, -0.368466830f,
-    0.929074581f, -0.369892447f,
+    0.931512805f, -0.363708530f,
+    0.930017224f, -0.367515937f,
     0.928506080f, -0.371317194f,
-    0.927935395f, -0.372741067f,
-    0.927362526f, -0.374164063f,
-    0.926787474f, -0.375586178f,
-    0.926210242f, -0.377007410f,
-    0.925630831f, -0.378427755f,
-    0.925049241f, -0.379847209f,
-    0.924465474f, -0.381265769f,
+    0.926979400f, -0.375112238f,
+    0.925437209f, -0.378901005f,
     0.923879533f, -0.382683432f,
-    0.923291417f, -0.384100195f,
-    0.922701128f, -0.385516054f,
-    0.922108669f, -0.386931006f,
-    0.921514039f, -0.388345047f,
-    0.920917242f, -0.389758174f,
-    0.920318277f, -0.391170384f,
-    0.919717146f, -0.392581674f,
+    0.922306396f, -0.386459456f,
+    0.920717827f, -0.390229013f,
     0.919113852f, -0.393992040f,
-    0.918508394f, -0.395401479f,
-    0.917900776f, -0.396809987f,
-    0.917290997f, -0.398217562f,
-    0.916679060f, -0.399624200f,
-    0.916064966f, -0.401029897f,
-    0.915448716f, -0.402434651f,
-    0.914830312f, -0.403838458f,
+    0.917494496f, -0.397748475f,
+    0.915859789f, -0.401498253f,
     0.914209756f, -0.405241314f,
-    0.913587048f, -0.406643217f,
-    0.912962190f, -0.408044163f,
-    0.912335185f, -0.409444149f,
-    0.911706032f, -0.410843171f,
-    0.911074734f, -0.412241227f,
-    0.910441292f, -0.413638312f,
-    0.909805708f, -0.415034424f,
+    0.912544425f, -0.408977594f,
+    0.910863825f, -0.412707030f,
     0.909167983f, -0.416429560f,
-    0.908528119f, -0.417823716f,
-    0.907886116f, -0.419216888f,
-    0.907241978f, -0.420609074f,
-    0.906595705f, -0.422000271f,
-    0.905947298f, -0.423390474f,
-    0.905296759f, -0.424779681f,
-    0.904644091f, -0.426167889f,
+    0.907456928f, -0.420145122f,
+    0.905730688f, -0.423853654f,
     0.903989293f, -0.427555093f,
-    0.903332368f, -0.428941292f,
-    0.902673318f, -0.430326481f,
-    0.902012144f, -0.431710658f,
-    0.901348847f, -0.433093819f,
-    0.900683429f, -0.434475961f,
-    0.900015892f, -0.435857080f,
-    0.899346237f, -0.437237174f,
+    0.902232771f, -0.431249379f,
+    0.900461152f, -0.434936447f,
     0.898674466f, -0.438616239f,
-    0.898000580f, -0.439994271f,
-    0.897324581f, -0.441371269f,
-    0.896646470f, -0.442747228f,
-    0.895966250f, -0.444122145f,
-    0.895283921f, -0.445496017f,
-    0.894599486f, -0.446868840f,
-    0.893912945f, -0.448240612f,
+    0.896872742f, -0.442288690f,
+    0.895056010f, -0.445953741f,
     0.893224301f, -0.449611330f,
-    0.892533555f, -0.450980989f,
-    0.891840709f, -0.452349587f,
-    0.891145765f, -0.453717121f,
-    0.890448723f, -0.455083587f,
-    0.889749586f, -0.456448982f,
-    0.889048356f, -0.457813304f,
-    0.888345033f, -0.459176548f,
+    0.891377646f, -0.453261395f,
+    0.889516075f, -0.456903876f,
     0.887639620f, -0.460538711f,
-    0.886932119f, -0.461899791f,
-    0.886222530f, -0.463259784f,
-    0.885510856f, -0.464618686f,
-    0.884797098f, -0.465976496f,
-    0.884081259f, -0.467333209f,
-    0.883363339f, -0.468688822f,
-    0.882643340f, -0.470043332f,
+    0.885748312f, -0.464165840f,
+    0.883842183f, -0.467785202f,
     0.881921264f, -0.471396737f,
-    0.881197113f, -0.472749032f,
-    0.880470889f, -0.474100215f,
-    0.879742593f, -0.475450282f,
-    0.879012226f, -0.476799230f,
-    0.878279792f, -0.478147056f,
-    0.877545290f, -0.479493758f,
-    0.876808724f, -0.480839331f,
+    0.879985588f, -0.475000384f,
+    0.878035187f, -0.478596082f,
     0.876070094f, -0.482183772f,
-    0.875329403f, -0.483527079f,
-    0.874586652f, -0.484869248f,
-    0.873841843f, -0.486210276f,
-    0.873094978f, -0.487550160f,
-    0.872346059f, -0.488888897f,
-    0.871595087f, -0.490226483f,
-    0.870842063f, -0.491562916f,
+    0.874090342f, -0.485763394f,
+    0.872095963f, -0.489334887f,
     0.870086991f, -0.492898192f,
-    0.869329871f, -0.494232309f,
-    0.868570706f, -0.495565262f,
-    0.867809497f, -0.496897049f,
-    0.867046246f, -0.498227667f,
-    0.866280954f, -0.499557113f,
-    0.865513624f, -0.500885383f,
-    0.864744258f, -0.502212474f,
+    0.868063460f, -0.496453250f,
+    0.866025404f, -0.500000000f,
     0.863972856f, -0.503538384f,
-    0.863199422f, -0.504863109f,
-    0.862423956f, -0.506186645f,
-    0.861646461f, -0.507508991f,
-    0.860866939f, -0.508830143f,
-    0.860085390f, -0.510150097f,
-    0.859301818f, -0.511468850f,
-    0.858516224f, -0.512786401f,
+    0.861905852f, -0.507068342f,
+    0.859824425f, -0.510589815f,
     0.857728610f, -0.514102744f,
-    0.856938977f, -0.515417878f,
-    0.856147328f, -0.516731799f,
-    0.855353665f, -0.518044504f,
-    0.854557988f, -0.519355990f,
-    0.853760301f, -0.520666254f,
-    0.852960605f, -0.521975293f,
-    0.852158902f, -0.523283103f,
+    0.855618443f, -0.517607071f,
+    0.853493959f, -0.521102737f,
     0.851355193f, -0.524589683f,
-    0.850549481f, -0.525895027f,
-    0.849741768f, -0.527199135f,
-    0.848932055f, -0.528502002f,
-    0.848120345f, -0.529803625f,
-    0.847306639f, -0.531104001f,
-    0.846490939f, -0.532403128f,
-    0.845673247f, -0.533701002f,
+    0.849202182f, -0.528067851f,
+    0.847034960f, -0.531537182f,
     0.844853565f, -0.534997620f,
-    0.844031895f, -0.536292979f,
-    0.843208240f, -0.537587076f,
-    0.842382600f, -0.538879909f,
-    0.841554977f, -0.540171473f,
-    0.840725375f, -0.541461766f,
-    0.839893794f, -0.542750785f,
-    0.839060237f, -0.544038527f,
+    0.842658033f, -0.538449105f,
+    0.840448401f, -0.541891581f,
     0.838224706f, -0.545324988f,
-    0.837387202f, -0.546610167f,
-    0.836547727f, -0.547894059f,
-    0.835706284f, -0.549176662f,
-    0.834862875f, -0.550457973f,
-    0.834017501f, -0.551737988f,
-    0.833170165f, -0.553016706f,
-    0.832320868f, -0.554294121f,
+    0.835986984f, -0.548749271f,
+    0.833735274f, -0.552164372f,
     0.831469612f, -0.555570233f,
-    0.830616400f, -0.556845037f,
-    0.829761234f, -0.558118531f,
-    0.828904115f, -0.559390712f,
-    0.828045045f, -0.560661576f,
-    0.827184027f, -0.561931121f,
-    0.826321063f, -0.563199344f,
-    0.825456154f, -0.564466242f,
+    0.829190038f, -0.558966798f,
+    0.826896589f, -0.562354009f,
     0.824589303f, -0.565731811f,
-    0.823720511f, -0.566996049f,
-    0.822849781f, -0.568258953f,
-    0.821977115f, -0.569520519f,
-    0.821102515f, -0.570780746f,
-    0.820225983f, -0.572039629f,
-    0.819347520f, -0.573297167f,
-    0.818467130f, -0.574553355f,
+    0.822268219f, -0.569100146f,
+    0.819933376f, -0.572458958f,
     0.817584813f, -0.575808191f,
-    0.816700573f, -0.577061673f,
-    0.815814411f, -0.578313796f,
-    0.814926329f, -0.579564559f,
-    0.814036330f, -0.580813958f,
-    0.813144415f, -0.582061990f,
-    0.812250587f, -0.583308653f,
-    0.811354847f, -0.584553943f,
+    0.815222569f, -0.579147790f,
+    0.812846685f, -0.582477697f,
     0.810457198f, -0.585797857f,
-    0.809557642f, -0.587040394f,
-    0.808656182f, -0.588281548f,
-    0.807752818f, -0.589521319f,
-    0.806847554f, -0.590759702f,
-    0.805940391f, -0.591996695f,
-    0.805031331f, -0.593232295f,
-    0.804120377f, -0.594466499f,
+    0.808054150f, -0.589108216f,
+    0.805637581f, -0.592408717f,
     0.803207531f, -0.595699304f,
-    0.802292796f, -0.596930708f,
-    0.801376172f, -0.598160707f,
-    0.800457662f, -0.599389298f,
-    0.799537269f, -0.600616479f,
-    0.798614995f, -0.601842247f,
-    0.797690841f, -0.603066599f,
-    0.796764810f, -0.604289531f,
+    0.800764041f, -0.598979925f,
+    0.798307152f, -0.602250522f,
     0.795836905f, -0.605511041f,
-    0.794907126f, -0.606731127f,
-    0.793975478f, -0.607949785f,
-    0.793041960f, -0.609167012f,
-    0.792106577f, -0.610382806f,
-    0.791169330f, -0.611597164f,
-    0.790230221f, -0.612810082f,
-    0.789289253f, -0.614021559f,
+    0.793353340f, -0.608761429f,
+    0.790856501f, -0.612001630f,
     0.788346428f, -0.615231591f,
-    0.787401747f, -0.616440175f,
-    0.786455214f, -0.617647308f,
-    0.785506830f, -0.618852988f,
-    0.784556597f, -0.620057212f,
-    0.783604519f, -0.621259977f,
-    0.782650596f, -0.622461279f,
-    0.781694832f, -0.623661118f,
+    0.785823163f, -0.618451256f,
+    0.783286749f, -0.621660573f,
     0.780737229f, -0.624859488f,
-    0.779777788f, -0.626056388f,
-    0.778816512f, -0.627251815f,
-    0.777853404f, -0.628445767f,
-    0.776888466f, -0.629638239f,
-    0.775921699f, -0.630829230f,
-    0.774953107f, -0.632018736f,
-    0.773982691f, -0.633206755f,
+    0.778174644f, -0.628047947f,
+    0.775599038f, -0.631225897f,
     0.773010453f, -0.634393284f,
-    0.772036397f, -0.635578320f,
-    0.771060524f, -0.636761861f,
-    0.770082837f, -0.637943904f,
-    0.769103338f, -0.639124445f,
-    0.768122029f, -0.640303482f,
-    0.767138912f, -0.641481013f,
-    0.766153990f, -0.642657034f,
+    0.770408934f, -0.637550056f,
+    0.767794524f, -0.640696160f,
     0.765167266f, -0.643831543f,
-    0.764178741f, -0.645004537f,
-    0.763188417f, -0.646176013f,
-    0.762196298f, -0.647345969f,
-    0.761202385f, -0.648514401f,
-    0.760206682f, -0.649681307f,
-    0.759209189f, -0.650846685f,
-    0.758209910f, -0.652010531f,
-    0.757208847f, -0.653172843f,
-    0.756206001f, -0.654333618f,
-    0.755201377f, -0.655492853f,
-    0.754194975f, -0.656650546f,
-    0.753186799f, -0.657806693f,
-    0.752176850f, -0.658961293f,
-    0.751165132f, -0.660114342f,
-    0.750151646f, -0.661265838f,
-    0.749136395f, -0.662415778f,
-    0.748119380f, -0.663564159f,
-    0.747100606f, -0.664710978f,
-    0.746080074f, -0.665856234f,
-    0.745057785f, -0.666999922f,
-    0.744033744f, -0.668142041f,
-    0.743007952f, -0.669282588f,
-    0.741980412f, -0.670421560f,
+    0.762527204f, -0.646956153f,
+    0.759874383f, -0.650069937f,
+    0.757208847f, -0.653172843f,
+    0.754530640f, -0.656264820f,
+    0.751839807f, -0.659345815f,
+    0.749136395f, -0.662415778f,
+    0.746420446f, -0.665474656f,
+    0.743692008f, -0.668522399f,
     0.740951125f, -0.671558955f,
-    0.739920095f, -0.672694769f,
-    0.738887324f, -0.673829000f,
-    0.737852815f, -0.674961646f,
-    0.736816569f, -0.676092704f,
-    0.735778589f, -0.677222170f,
-    0.734738878f, -0.678350043f,
-    0.733697438f, -0.679476320f,
+    0.738197844f, -0.674584274f,
+    0.735432211f, -0.677598305f,
     0.732654272f, -0.680600998f,
-    0.731609381f, -0.681724074f,
-    0.730562769f, -0.682845546f,
-    0.729514438f, -0.683965412f,
-    0.728464390f, -0.685083668f,
-    0.727412629f, -0.686200312f,
-    0.726359155f, -0.687315341f,
-    0.725303972f, -0.688428753f,
+    0.729864073f, -0.683592302f,
+    0.727061661f, -0.686572168f,
     0.724247083f, -0.689540545f,
-    0.723188489f, -0.690650714f,
-    0.722128194f, -0.691759258f,
-    0.721066199f, -0.692866175f,
-    0.720002508f, -0.693971461f,
-    0.718937122f, -0.695075114f,
-    0.717870045f, -0.696177131f,
-    0.716801279f, -0.697277511f,
+    0.721420386f, -0.692497384f,
+    0.718581618f, -0.695442635f,
     0.715730825f, -0.698376249f,
-    0.714658688f, -0.699473345f,
-    0.713584869f, -0.700568794f,
-    0.712509371f, -0.701662595f,
-    0.711432196f, -0.702754744f,
-    0.710353347f, -0.703845241f,
-    0.709272826f, -0.704934080f,
-    0.708190637f, -0.706021261f,
+    0.712868056f, -0.701298178f,
+    0.709993359f, -0.704208371f,
     0.707106781f, -0.707106781f,
-    0.706021261f, -0.708190637f,
-    0.704934080f, -0.709272826f,
-    0.703845241f, -0.710353347f,
-    0.702754744f, -0.711432196f,
-    0.701662595f, -0.712509371f,
-    0.700568794f, -0.713584869f,
-    0.699473345f, -0.714658688f,
+    0.704208371f, -0.709993359f,
+    0.701298178f, -0.712868056f,
     0.698376249f, -0.715730825f,
-    0.697277511f, -0.716801279f,
-    0.696177131f, -0.717870045f,
-    0.695075114f, -0.718937122f,
-    0.693971461f, -0.720002508f,
-    0.692866175f, -0.721066199f,
-    0.691759258f, -0.722128194f,
-    0.690650714f, -0.723188489f,
+    0.695442635f, -0.718581618f,
+    0.692497384f, -0.721420386f,
     0.689540545f, -0.724247083f,
-    0.688428753f, -0.725303972f,
-    0.687315341f, -0.726359155f,
-    0.686200312f, -0.727412629f,
-    0.685083668f, -0.728464390f,
-    0.683965412f, -0.729514438f,
-    0.682845546f, -0.730562769f,
-    0.681724074f, -0.731609381f,
+    0.686572168f, -0.727061661f,
+    0.683592302f, -0.729864073f,
     0.680600998f, -0.732654272f,
-    0.679476320f, -0.733697438f,
-    0.678350043f, -0.734738878f,
-    0.677222170f, -0.735778589f,
-    0.676092704f, -0.736816569f,
-    0.674961646f, -0.737852815f,
-    0.673829000f, -0.738887324f,
-    0.672694769f, -0.739920095f,
+    0.677598305f, -0.735432211f,
+    0.674584274f, -0.738197844f,
     0.671558955f, -0.740951125f,
-    0.670421560f, -0.741980412f,
-    0.669282588f, -0.743007952f,
-    0.668142041f, -0.744033744f,
-    0.666999922f, -0.745057785f,
-    0.665856234f, -0.746080074f,
-    0.664710978f, -0.747100606f,
-    0.663564159f, -0.748119380f,
+    0.668522399f, -0.743692008f,
+    0.665474656f, -0.746420446f,
     0.662415778f, -0.749136395f,
-    0.661265838f, -0.750151646f,
-    0.660114342f, -0.751165132f,
-    0.658961293f, -0.752176850f,
-    0.657806693f, -0.753186799f,
-    0.656650546f, -0.754194975f,
-    0.655492853f, -0.755201377f,
-    0.654333618f, -0.756206001f,
+    0.659345815f, -0.751839807f,
+    0.656264820f, -0.754530640f,
     0.653172843f, -0.757208847f,
-    0.652010531f, -0.758209910f,
-    0.650846685f, -0.759209189f,
-    0.649681307f, -0.760206682f,
-    0.648514401f, -0.761202385f,
-    0.647345969f, -0.762196298f,
-    0.646176013f, -0.763188417f,
-    0.645004537f, -0.764178741f,
+    0.650069937f, -0.759874383f,
+    0.646956153f, -0.762527204f,
     0.643831543f, -0.765167266f,
-    0.642657034f, -0.766153990f,
-    0.641481013f, -0.767138912f,
-    0.640303482f, -0.768122029f,
-    0.639124445f, -0.769103338f,
-    0.637943904f, -0.770082837f,
-    0.636761861f, -0.771060524f,
-    0.635578320f, -0.772036397f,
+    0.640696160f, -0.767794524f,
+    0.637550056f, -0.770408934f,
     0.634393284f, -0.773010453f,
-    0.633206755f, -0.773982691f,
-    0.632018736f, -0.774953107f,
-    0.630829230f, -0.775921699f,
-    0.629638239f, -0.776888466f,
-    0.628445767f, -0.777853404f,
-    0.627251815f, -0.778816512f,
-    0.626056388f, -0.779777788f,
+    0.631225897f, -0.775599038f,
+    0.628047947f, -0.778174644f,
     0.624859488f, -0.780737229f,
-    0.623661118f, -0.781694832f,
-    0.622461279f, -0.782650596f,
-    0.621259977f, -0.783604519f,
-    0.620057212f, -0.784556597f,
-    0.618852988f, -0.785506830f,
-    0.617647308f, -0.786455214f,
-    0.616440175f, -0.787401747f,
+    0.621660573f, -0.783286749f,
+    0.618451256f, -0.785823163f,
     0.615231591f, -0.788346428f,
-    0.614021559f, -0.789289253f,
-    0.612810082f, -0.790230221f,
-    0.611597164f, -0.791169330f,
-    0.610382806f, -0.792106577f,
-    0.609167012f, -0.793041960f,
-    0.607949785f, -0.793975478f,
-    0.606731127f, -0.794907126f,
+    0.612001630f, -0.790856501f,
+    0.608761429f, -0.793353340f,
     0.605511041f, -0.795836905f,
-    0.604289531f, -0.796764810f,
-    0.603066599f, -0.797690841f,
-    0.601842247f, -0.798614995f,
-    0.600616479f, -0.799537269f,
-    0.599389298f, -0.800457662f,
-    0.598160707f, -0.801376172f,
-    0.596930708f, -0.802292796f,
+    0.602250522f, -0.798307152f,
+    0.598979925f, -0.800764041f,
     0.595699304f, -0.803207531f,
-    0.594466499f, -0.804120377f,
-    0.593232295f, -0.805031331f,
-    0.591996695f, -0.805940391f,
-    0.590759702f, -0.806847554f,
-    0.589521319f, -0.807752818f,
-    0.588281548f, -0.808656182f,
-    0.587040394f, -0.809557642f,
+    0.592408717f, -0.805637581f,
+    0.589108216f, -0.808054150f,
     0.585797857f, -0.810457198f,
-    0.584553943f, -0.811354847f,
-    0.583308653f, -0.812250587f,
-    0.582061990f, -0.813144415f,
-    0.580813958f, -0.814036330f,
-    0.579564559f, -0.814926329f,
-    0.578313796f, -0.815814411f,
-    0.577061673f, -0.816700573f,
+    0.582477697f, -0.812846685f,
+    0.579147790f, -0.815222569f,
     0.575808191f, -0.817584813f,
-    0.574553355f, -0.818467130f,
-    0.573297167f, -0.819347520f,
-    0.572039629f, -0.820225983f,
-    0.570780746f, -0.821102515f,
-    0.569520519f, -0.821977115f,
-    0.568258953f, -0.822849781f,
-    0.566996049f, -0.823720511f,
+    0.572458958f, -0.819933376f,
+    0.569100146f, -0.822268219f,
     0.565731811f, -0.824589303f,
-    0.564466242f, -0.825456154f,
-    0.563199344f, -0.826321063f,
-    0.561931121f, -0.827184027f,
-    0.560661576f, -0.828045045f,
-    0.559390712f, -0.828904115f,
-    0.558118531f, -0.829761234f,
-    0.556845037f, -0.830616400f,
+    0.562354009f, -0.826896589f,
+    0.558966798f, -0.829190038f,
     0.555570233f, -0.831469612f,
-    0.554294121f, -0.832320868f,
-    0.553016706f, -0.833170165f,
-    0.551737988f, -0.834017501f,
-    0.550457973f, -0.834862875f,
-    0.549176662f, -0.835706284f,
-    0.547894059f, -0.836547727f,
-    0.546610167f, -0.837387202f,
+    0.552164372f, -0.833735274f,
+    0.548749271f, -0.835986984f,
     0.545324988f, -0.838224706f,
-    0.544038527f, -0.839060237f,
-    0.542750785f, -0.839893794f,
-    0.541461766f, -0.840725375f,
-    0.540171473f, -0.841554977f,
-    0.538879909f, -0.842382600f,
-    0.537587076f, -0.843208240f,
-    0.536292979f, -0.844031895f,
+    0.541891581f, -0.840448401f,
+    0.538449105f, -0.842658033f,
     0.534997620f, -0.844853565f,
-    0.533701002f, -0.845673247f,
-    0.532403128f, -0.846490939f,
-    0.531104001f, -0.847306639f,
-    0.529803625f, -0.848120345f,
-    0.528502002f, -0.848932055f,
-    0.527199135f, -0.849741768f,
-    0.525895027f, -0.850549481f,
+    0.531537182f, -0.847034960f,
+    0.528067851f, -0.849202182f,
     0.524589683f, -0.851355193f,
-    0.523283103f, -0.852158902f,
-    0.521975293f, -0.852960605f,
-    0.520666254f, -0.853760301f,
-    0.519355990f, -0.854557988f,
-    0.518044504f, -0.855353665f,
-    0.516731799f, -0.856147328f,
-    0.515417878f, -0.856938977f,
+    0.521102737f, -0.853493959f,
+    0.517607071f, -0.855618443f,
     0.514102744f, -0.857728610f,
-    0.512786401f, -0.858516224f,
-    0.511468850f, -0.859301818f,
-    0.510150097f, -0.860085390f,
-    0.508830143f, -0.860866939f,
-    0.507508991f, -0.861646461f,
-    0.506186645f, -0.862423956f,
-    0.504863109f, -0.863199422f,
+    0.510589815f, -0.859824425f,
+    0.507068342f, -0.861905852f,
     0.503538384f, -0.863972856f,
-    0.502212474f, -0.864744258f,
-    0.500885383f, -0.865513624f,
-    0.499557113f, -0.866280954f,
-    0.498227667f, -0.867046246f,
-    0.496897049f, -0.867809497f,
-    0.495565262f, -0.868570706f,
-    0.494232309f, -0.869329871f,
+    0.500000000f, -0.866025404f,
+    0.496453250f, -0.868063460f,
     0.492898192f, -0.870086991f,
-    0.491562916f, -0.870842063f,
-    0.490226483f, -0.871595087f,
-    0.488888897f, -0.872346059f,
-    0.487550160f, -0.873094978f,
-    0.486210276f, -0.873841843f,
-    0.484869248f, -0.874586652f,
-    0.483527079f, -0.875329403f,
+    0.489334887f, -0.872095963f,
+    0.485763394f, -0.874090342f,
     0.482183772f, -0.876070094f,
-    0.480839331f, -0.876808724f,
-    0.479493758f, -0.877545290f,
-    0.478147056f, -0.878279792f,
-    0.476799230f, -0.879012226f,
-    0.475450282f, -0.879742593f,
-    0.474100215f, -0.880470889f,
-    0.472749032f, -0.881197113f,
+    0.478596082f, -0.878035187f,
+    0.475000384f, -0.879985588f,
     0.471396737f, -0.881921264f,
-    0.470043332f, -0.882643340f,
-    0.468688822f, -0.883363339f,
-    0.467333209f, -0.884081259f,
-    0.465976496f, -0.884797098f,
-    0.464618686f, -0.885510856f,
-    0.463259784f, -0.886222530f,
-    0.461899791f, -0.886932119f,
+    0.467785202f, -0.883842183f,
+    0.464165840f, -0.885748312f,
     0.460538711f, -0.887639620f,
-    0.459176548f, -0.888345033f,
-    0.457813304f, -0.889048356f,
-    0.456448982f, -0.889749586f,
-    0.455083587f, -0.890448723f,
-    0.453717121f, -0.891145765f,
-    0.452349587f, -0.891840709f,
-    0.450980989f, -0.892533555f,
+    0.456903876f, -0.889516075f,
+    0.453261395f, -0.891377646f,
     0.449611330f, -0.893224301f,
-    0.448240612f, -0.893912945f,
-    0.446868840f, -0.894599486f,
-    0.445496017f, -0.895283921f,
-    0.444122145f, -0.895966250f,
-    0.442747228f, -0.896646470f,
-    0.441371269f, -0.897324581f,
-    0.439994271f, -0.898000580f,
+    0.445953741f, -0.895056010f,
+    0.442288690f, -0.896872742f,
     0.438616239f, -0.898674466f,
-    0.437237174f, -0.899346237f,
-    0.435857080f, -0.900015892f,
-    0.434475961f, -0.900683429f,
-    0.433093819f, -0.901348847f,
-    0.431710658f, -0.902012144f,
-    0.430326481f, -0.902673318f,
-    0.428941292f, -0.903332368f,
+    0.434936447f, -0.900461152f,
+    0.431249379f, -0.902232771f,
     0.427555093f, -0.903989293f,
-    0.426167889f, -0.904644091f,
-    0.424779681f, -0.905296759f,
-    0.423390474f, -0.905947298f,
-    0.422000271f, -0.906595705f,
-    0.420609074f, -0.907241978f,
-    0.419216888f, -0.907886116f,
-    0.417823716f, -0.908528119f,
+    0.423853654f, -0.905730688f,
+    0.420145122f, -0.907456928f,
     0.416429560f, -0.909167983f,
-    0.415034424f, -0.909805708f,
-    0.413638312f, -0.910441292f,
-    0.412241227f, -0.911074734f,
-    0.410843171f, -0.911706032f,
-    0.409444149f, -0.912335185f,
-    0.408044163f, -0.912962190f,
-    0.406643217f, -0.913587048f,
-    0.405241314f, -0.914209756f,
-    0.403838458f, -0.914830312f,
-    0.402434651f, -0.915448716f,
-    0.401029897f, -0.916064966f,
-    0.399624200f, -0.916679060f,
-    0.398217562f, -0.917290997f,
-    0.396809987f, -0.917900776f,
-    0.395401479f, -0.918508394f,
-    0.393992040f, -0.919113852f,
-    0.392581674f, -0.919717146f,
-    0.391170384f, -0.920318277f,
-    0.389758174f, -0.920917242f,
-    0.388345047f, -0.921514039f,
-    0.386931006f, -0.922108669f,
-    0.385516054f, -0.922701128f,
-    0.384100195f, -0.923291417f,
+    0.412707030f, -0.910863825f,
+    0.408977594f, -0.912544425f,
+    0.405241314f, -0.914209756f,
+    0.401498253f, -0.915859789f,
+    0.397748475f, -0.917494496f,
+    0.393992040f, -0.919113852f,
+    0.390229013f, -0.920717827f,
+    0.386459456f, -0.922306396f,
     0.382683432f, -0.923879533f,
-    0.381265769f, -0.924465474f,
-    0.379847209f, -0.925049241f,
-    0.378427755f, -0.925630831f,
-    0.377007410f, -0.926210242f,
-    0.375586178f, -0.926787474f,
-    0.374164063f, -0.927362526f,
-    0.372741067f, -0.927935395f,
+    0.378901005f, -0.925437209f,
+    0.375112238f, -0.926979400f,
     0.371317194f, -0.928506080f,
-    0.369892447f, -0.929074581f,
-    0.368466830f, -0.929640896f,
-    0.367040346f, -0.930205023f,
-    0.365612998f, -0.930766961f,
-    0.364184790f, -0.931326709f,
-    0.362755724f, -0.931884266f,
-    0.361325806f, -0.932439629f,
+    0.367515937f, -0.930017224f,
+    0.363708530f, -0.931512805f,
     0.359895037f, -0.932992799f,
-    0.358463421f, -0.933543773f,
-    0.357030961f, -0.934092550f,
-    0.355597662f, -0.934639130f,
-    0.354163525f, -0.935183510f,
-    0.352728556f, -0.935725689f,
-    0.351292756f, -0.936265667f,
-    0.349856130f, -0.936803442f,
+    0.356075521f, -0.934457181f,
+    0.352250048f, -0.935905927f,
     0.348418680f, -0.937339012f,
-    0.346980411f, -0.937872376f,
-    0.345541325f, -0.938403534f,
-    0.344101426f, -0.938932484f,
-    0.342660717f, -0.939459224f,
-    0.341219202f, -0.939983753f,
-    0.339776884f, -0.940506071f,
-    0.338333767f, -0.941026175f,
+    0.344581482f, -0.938756412f,
+    0.340738519f, -0.940158105f,
     0.336889853f, -0.941544065f,
-    0.335445147f, -0.942059740f,
-    0.333999651f, -0.942573198f,
-    0.332553370f, -0.943084437f,
-    0.331106306f, -0.943593458f,
-    0.329658463f, -0.944100258f,
-    0.328209844f, -0.944604837f,
-    0.326760452f, -0.945107193f,
+    0.333035551f, -0.942914271f,
+    0.329175676f, -0.944268698f,
     0.325310292f, -0.945607325f,
-    0.323859367f, -0.946105232f,
-    0.322407679f, -0.946600913f,
-    0.320955232f, -0.947094366f,
-    0.319502031f, -0.947585591f,
-    0.318048077f, -0.948074586f,
-    0.316593376f, -0.948561350f,
-    0.315137929f, -0.949045882f,
+    0.321439465f, -0.946930129f,
+    0.317563260f, -0.948237089f,
     0.313681740f, -0.949528181f,
-    0.312224814f, -0.950008245f,
-    0.310767153f, -0.950486074f,
-    0.309308760f, -0.950961666f,
-    0.307849640f, -0.951435021f,
-    0.306389795f, -0.951906137f,
-    0.304929230f, -0.952375013f,
-    0.303467947f, -0.952841648f,
+    0.309794972f, -0.950803384f,
+    0.305903020f, -0.952062678f,
     0.302005949f, -0.953306040f,
-    0.300543241f, -0.953768190f,
-    0.299079826f, -0.954228095f,
-    0.297615707f, -0.954685755f,
-    0.296150888f, -0.955141168f,
-    0.294685372f, -0.955594334f,
-    0.293219163f, -0.956045251f,
-    0.291752263f, -0.956493919f,
+    0.298103825f, -0.954533451f,
+    0.294196713f, -0.955744890f,
     0.290284677f, -0.956940336f,
-    0.288816408f, -0.957384501f,
-    0.287347460f, -0.957826413f,
-    0.285877835f, -0.958266071f,
-    0.284407537f, -0.958703475f,
-    0.282936570f, -0.959138622f,
-    0.281464938f, -0.959571513f,
-    0.279992643f, -0.960002146f,
+    0.286367785f, -0.958119769f,
+    0.282446100f, -0.959283170f,
     0.278519689f, -0.960430519f,
-    0.277046080f, -0.960856633f,
-    0.275571819f, -0.961280486f,
-    0.274096910f, -0.961702077f,
-    0.272621355f, -0.962121404f,
-    0.271145160f, -0.962538468f,
-    0.269668326f, -0.962953267f,
-    0.268190857f, -0.963365800f,
+    0.274588618f, -0.961561798f,
+    0.270652952f, -0.962676986f,
     0.266712757f, -0.963776066f,
-    0.265234030f, -0.964184064f,
-    0.263754679f, -0.964589793f,
-    0.262274707f, -0.964993253f,
-    0.260794118f, -0.965394442f,
-    0.259312915f, -0.965793359f,
-    0.257831102f, -0.966190003f,
-    0.256348682f, -0.966584374f,
+    0.262768100f, -0.964859019f,
+    0.258819045f, -0.965925826f,
     0.254865660f, -0.966976471f,
-    0.253382037f, -0.967366292f,
-    0.251897818f, -0.967753837f,
-    0.250413007f, -0.968139105f,
-    0.248927606f, -0.968522094f,
-    0.247441619f, -0.968902805f,
-    0.245955050f, -0.969281235f,
-    0.244467903f, -0.969657385f,
+    0.250908009f, -0.968010935f,
+    0.246946161f, -0.969029202f,
     0.242980180f, -0.970031253f,
-    0.241491885f, -0.970402839f,
-    0.240003022f, -0.970772141f,
-    0.238513595f, -0.971139158f,
-    0.237023606f, -0.971503891f,
-    0.235533059f, -0.971866337f,
-    0.234041959f, -0.972226497f,
-    0.232550307f, -0.972584369f,
+    0.239010133f, -0.971017073f,
+    0.235036087f, -0.971986645f,
     0.231058108f, -0.972939952f,
-    0.229565366f, -0.973293246f,
-    0.228072083f, -0.973644250f,
-    0.226578264f, -0.973992962f,
-    0.225083911f, -0.974339383f,
-    0.223589029f, -0.974683511f,
-    0.222093621f, -0.975025345f,
-    0.220597690f, -0.975364885f,
+    0.227076263f, -0.973876979f,
+    0.223090618f, -0.974797710f,
     0.219101240f, -0.975702130f,
-    0.217604275f, -0.976037079f,
-    0.216106797f, -0.976369731f,
-    0.214608811f, -0.976700086f,
-    0.213110320f, -0.977028143f,
-    0.211611327f, -0.977353900f,
-    0.210111837f, -0.977677358f,
-    0.208611852f, -0.977998515f,
+    0.215108196f, -0.976590223f,
+    0.211111552f, -0.977461975f,
     0.207111376f, -0.978317371f,
-    0.205610413f, -0.978633924f,
-    0.204108966f, -0.978948175f,
-    0.202607039f, -0.979260123f,
-    0.201104635f, -0.979569766f,
-    0.199601758f, -0.979877104f,
-    0.198098411f, -0.980182136f,
-    0.196594598f, -0.980484862f,
+    0.203107734f, -0.979156396f,
+    0.199100694f, -0.979979037f,
     0.195090322f, -0.980785280f,
-    0.193585587f, -0.981083391f,
-    0.192080397f, -0.981379193f,
-    0.190574755f, -0.981672686f,
-    0.189068664f, -0.981963869f,
-    0.187562129f, -0.982252741f,
-    0.186055152f, -0.982539302f,
-    0.184547737f, -0.982823551f,
+    0.191076686f, -0.981575112f,
+    0.187059852f, -0.982348519f,
     0.183039888f, -0.983105487f,
-    0.181531608f, -0.983385110f,
-    0.180022901f, -0.983662419f,
-    0.178513771f, -0.983937413f,
-    0.177004220f, -0.984210092f,
-    0.175494253f, -0.984480455f,
-    0.173983873f, -0.984748502f,
-    0.172473084f, -0.985014231f,
+    0.179016861f, -0.983846006f,
+    0.174990839f, -0.984570062f,
     0.170961889f, -0.985277642f,
-    0.169450291f, -0.985538735f,
-    0.167938295f, -0.985797509f,
-    0.166425904f, -0.986053963f,
-    0.164913120f, -0.986308097f,
-    0.163399949f, -0.986559910f,
-    0.161886394f, -0.986809402f,
-    0.160372457f, -0.987056571f,
+    0.166930078f, -0.985968736f,
+    0.162895473f, -0.986643332f,
     0.158858143f, -0.987301418f,
-    0.157343456f, -0.987543942f,
-    0.155828398f, -0.987784142f,
-    0.154312973f, -0.988022017f,
-    0.152797185f, -0.988257568f,
-    0.151281038f, -0.988490793f,
-    0.149764535f, -0.988721692f,
-    0.148247679f, -0.988950265f,
+    0.154818155f, -0.987942984f,
+    0.150775576f, -0.988568018f,
     0.146730474f, -0.989176510f,
-    0.145212925f, -0.989400428f,
-    0.143695033f, -0.989622017f,
-    0.142176804f, -0.989841278f,
-    0.140658239f, -0.990058210f,
-    0.139139344f, -0.990272812f,
-    0.137620122f, -0.990485084f,
-    0.136100575f, -0.990695025f,
+    0.142682917f, -0.989768450f,
+    0.138632973f, -0.990343829f,
     0.134580709f, -0.990902635f,
-    0.133060525f, -0.991107914f,
-    0.131540029f, -0.991310860f,
-    0.130019223f, -0.991511473f,
-    0.128498111f, -0.991709754f,
-    0.126976696f, -0.991905700f,
-    0.125454983f, -0.992099313f,
-    0.123932975f, -0.992290591f,
+    0.130526192f, -0.991444861f,
+    0.126469492f, -0.991970497f,
     0.122410675f, -0.992479535f,
-    0.120888087f, -0.992666142f,
-    0.119365215f, -0.992850414f,
-    0.117842062f, -0.993032350f,
-    0.116318631f, -0.993211949f,
-    0.114794927f, -0.993389211f,
-    0.113270952f, -0.993564136f,
-    0.111746711f, -0.993736722f,
+    0.118349810f, -0.992971965f,
+    0.114286965f, -0.993447779f,
     0.110222207f, -0.993906970f,
-    0.108697444f, -0.994074879f,
-    0.107172425f, -0.994240449f,
-    0.105647154f, -0.994403680f,
-    0.104121634f, -0.994564571f,
-    0.102595869f, -0.994723121f,
-    0.101069863f, -0.994879331f,
-    0.099543619f, -0.995033199f,
+    0.106155605f, -0.994349530f,
+    0.102087227f, -0.994775451f,
     0.098017140f, -0.995184727f,
-    0.096490431f, -0.995333912f,
-    0.094963495f, -0.995480755f,
-    0.093436336f, -0.995625256f,
-    0.091908956f, -0.995767414f,
-    0.090381361f, -0.995907229f,
-    0.088853553f, -0.996044701f,
-    0.087325535f, -0.996179829f,
+    0.093945414f, -0.995577350f,
+    0.089872115f, -0.995953314f,
     0.085797312f, -0.996312612f,
-    0.084268888f, -0.996443051f,
-    0.082740265f, -0.996571146f,
-    0.081211447f, -0.996696895f,
-    0.079682438f, -0.996820299f,
-    0.078153242f, -0.996941358f,
-    0.076623861f, -0.997060070f,
-    0.075094301f, -0.997176437f,
+    0.081721074f, -0.996655239f,
+    0.077643468f, -0.996981189f,
     0.073564564f, -0.997290457f,
-    0.072034653f, -0.997402130f,
-    0.070504573f, -0.997511456f,
-    0.068974328f, -0.997618435f,
-    0.067443920f, -0.997723067f,
-    0.065913353f, -0.997825350f,
-    0.064382631f, -0.997925286f,
-    0.062851758f, -0.998022874f,
+    0.069484428f, -0.997583036f,
+    0.065403129f, -0.997858923f,
     0.061320736f, -0.998118113f,
-    0.059789571f, -0.998211003f,
-    0.058258265f, -0.998301545f,
-    0.056726821f, -0.998389737f,
-    0.055195244f, -0.998475581f,
-    0.053663538f, -0.998559074f,
-    0.052131705f, -0.998640218f,
-    0.050599749f, -0.998719012f,
+    0.057237317f, -0.998360601f,
+    0.053152941f, -0.998586383f,
     0.049067674f, -0.998795456f,
-    0.047535484f, -0.998869550f,
-    0.046003182f, -0.998941293f,
-    0.044470772f, -0.999010686f,
-    0.042938257f, -0.999077728f,
-    0.041405641f, -0.999142419f,
-    0.039872928f, -0.999204759f,
-    0.038340120f, -0.999264747f,
+    0.044981587f, -0.998987816f,
+    0.040894747f, -0.999163460f,
     0.036807223f, -0.999322385f,
-    0.035274239f, -0.999377670f,
-    0.033741172f, -0.999430605f,
-    0.032208025f, -0.999481187f,
-    0.030674803f, -0.999529418f,
-    0.029141509f, -0.999575296f,
-    0.027608146f, -0.999618822f,
-    0.026074718f, -0.999659997f,
+    0.032719083f, -0.999464587f,
+    0.028630395f, -0.999590066f,
     0.024541229f, -0.999698819f,
-    0.023007681f, -0.999735288f,
-    0.021474080f, -0.999769405f,
-    0.019940429f, -0.999801170f,
-    0.018406730f, -0.999830582f,
-    0.016872988f, -0.999857641f,
-    0.015339206f, -0.999882347f,
-    0.013805389f, -0.999904701f,
+    0.020451651f, -0.999790843f,
+    0.016361732f, -0.999866138f,
     0.012271538f, -0.999924702f,
-    0.010737659f, -0.999942350f,
-    0.009203755f, -0.999957645f,
-    0.007669829f, -0.999970586f,
-    0.006135885f, -0.999981175f,
-    0.004601926f, -0.999989411f,
-    0.003067957f, -0.999995294f,
-    0.001533980f, -0.999998823f
+    0.008181140f, -0.999966534f,
+    0.004090604f, -0.999991633f
 };
+#endif
 
 
 /**   
@@ -27249,3 +35701,234 @@ const q15_t sinTable_q15[FAST_MATH_TABLE_SIZE + 1] = {
    0xE3F4, 0xE57D, 0xE707, 0xE892, 0xEA1E, 0xEBAB, 0xED38, 0xEEC6, 0xF055, 0xF1E4, 0xF374, 0xF505, 0xF695,
    0xF827, 0xF9B8, 0xFB4A, 0xFCDC, 0xFE6E, 0x0000
 };
+
+/**
+ * \par
+ * Table of 2^(n / 32) for the exponential, n = 0 to 31:
+ * <pre>
+ * expTable[n] = pow(2, n / 32.0);
+ * </pre>
+ */
+const float32_t expTable_f32[32] = {
+  1.0f, 1.0218972f, 1.04427373f, 1.06714046f,
+  1.09050775f, 1.1143868f, 1.13878858f, 1.1637249f,
+  1.18920708f, 1.21524739f, 1.24185777f, 1.26905096f,
+  1.29683959f, 1.32523668f, 1.35425556f, 1.38390994f,
+  1.41421354f, 1.44518077f, 1.47682619f, 1.50916445f,
+  1.54221082f, 1.5759809f, 1.61049032f, 1.64575553f,
+  1.68179286f, 1.71861935f, 1.75625217f, 1.79470909f,
+  1.8340081f, 1.87416768f, 1.91520655f, 1.95714414f
+};
+
+/**
+ * \par
+ * Tables for the floating-point natural logarithm, with the mantissa in [1 2)
+ * and n = 0 to 31:
+ * <pre>
+ * logTable[n] = log(1 + n / 32.0);
+ * logInvTable[n] = 1 / (1 + n / 32.0);
+ * </pre>
+ */
+const float32_t logTable_f32[32] = {
+  0.0f, 0.0307716578f, 0.0606246218f, 0.0896121562f,
+  0.117783032f, 0.145182014f, 0.171850264f, 0.197825745f,
+  0.223143548f, 0.247836158f, 0.271933705f, 0.295464218f,
+  0.318453729f, 0.340926588f, 0.362905502f, 0.384411693f,
+  0.405465096f, 0.426084399f, 0.446287096f, 0.466089725f,
+  0.485507816f, 0.504556f, 0.523248136f, 0.541597307f,
+  0.559615791f, 0.57731539f, 0.594707131f, 0.611801565f,
+  0.628608644f, 0.645137966f, 0.66139847f, 0.677398801f
+};
+
+const float32_t logInvTable_f32[32] = {
+  1.0f, 0.969696999f, 0.941176474f, 0.914285719f,
+  0.888888896f, 0.864864886f, 0.842105269f, 0.820512831f,
+  0.800000012f, 0.780487776f, 0.761904776f, 0.744186044f,
+  0.727272749f, 0.711111128f, 0.695652187f, 0.680851042f,
+  0.666666687f, 0.653061211f, 0.639999986f, 0.627451003f,
+  0.615384638f, 0.603773594f, 0.592592597f, 0.581818163f,
+  0.571428597f, 0.561403513f, 0.551724136f, 0.542372882f,
+  0.533333361f, 0.524590135f, 0.516129017f, 0.507936537f
+};
+
+/**
+ * \par
+ * Tables for the Q31 and Q15 natural logarithm, with the mantissa in [0.5 1]
+ * and n = 0 to 32. logTable values are in Q31 (1.31 fixed-point format),
+ * logInvTable values in 3.29 fixed-point format:
+ * <pre>
+ * logTable[n] = log(0.5 + n / 64.0) * pow(2, 31);
+ * logInvTable[n] = pow(2, 29) / (0.5 + n / 64.0);
+ * </pre>
+ * rounded to the nearest integer value.
+ */
+const q31_t logTable_q31[33] = {
+  0xA746F404, 0xAB374766, 0xAF098034, 0xB2BF5D4A, 0xB65A77BB, 0xB9DC46FC,
+  0xBD462475, 0xC0994EA1, 0xC3D6EBCC, 0xC7000C71, 0xCA15AD5B, 0xCD18B97A,
+  0xD00A0B88, 0xD2EA6F83, 0xD5BAA3F2, 0xD87B5B12, 0xDB2D3BDE, 0xDDD0E2FC,
+  0xE066E393, 0xE2EFC80E, 0xE56C12C3, 0xE7DC3E9B, 0xEA40BF95, 0xEC9A0350,
+  0xEEE8717E, 0xF12C6C4E, 0xF36650D1, 0xF5967751, 0xF7BD33A5, 0xF9DAD57B,
+  0xFBEFA89E, 0xFDFBF535, 0x00000000
+};
+
+const q31_t logInvTable_q31[33] = {
+  0x40000000, 0x3E0F83E1, 0x3C3C3C3C, 0x3A83A83B, 0x38E38E39, 0x3759F22A,
+  0x35E50D79, 0x34834835, 0x33333333, 0x31F3831F, 0x30C30C31, 0x2FA0BE83,
+  0x2E8BA2E9, 0x2D82D82E, 0x2C8590B2, 0x2B931057, 0x2AAAAAAB, 0x29CBC14E,
+  0x28F5C28F, 0x28282828, 0x27627627, 0x26A439F6, 0x25ED097B, 0x253C8254,
+  0x24924925, 0x23EE08FC, 0x234F72C2, 0x22B63CBF, 0x22222222, 0x2192E29F,
+  0x21084211, 0x20820821, 0x20000000
+};
+
+/**
+ * \par
+ * Coefficients of the fourth order Taylor polynomial of atan(t) around
+ * c = n / 32, n = 0 to 32, five values per point, with q = 1 + c * c:
+ * <pre>
+ * atan(c), 1 / q, -c / q^2, (3 * c^2 - 1) / (3 * q^3), c * (1 - c^2) / q^4
+ * </pre>
+ * The Q31 table holds the same values in 1.31 fixed-point format, rounded
+ * to the nearest integer value.
+ */
+const float32_t atanTable_f32[165] = {
+  0.0f, 1.0f, -0.0f, -0.333333343f, 0.0f,
+  0.0312398337f, 0.999024391f, -0.0311890543f, -0.331384957f, 0.0310978293f,
+  0.062418811f, 0.996108949f, -0.0620145649f, -0.325596571f, 0.0612925366f,
+  0.0934767798f, 0.991287529f, -0.0921235234f, -0.316135198f, 0.0897296369f,
+  0.124354996f, 0.984615386f, -0.121183433f, -0.303269297f, 0.115647718f,
+  0.154996738f, 0.976167798f, -0.148891181f, -0.287354767f, 0.138415083f,
+  0.185347944f, 0.96603775f, -0.174980417f, -0.268816888f, 0.157555878f,
+  0.215357706f, 0.954333663f, -0.199227154f, -0.248129889f, 0.172764167f,
+  0.244978666f, 0.941176474f, -0.221453294f, -0.225795507f, 0.18390584f,
+  0.274167448f, 0.926696837f, -0.241528228f, -0.202321887f, 0.191009507f,
+  0.302884877f, 0.911032021f, -0.259368539f, -0.178204343f, 0.194248021f,
+  0.331096083f, 0.89432317f, -0.27493602f, -0.153908879f, 0.193913653f,
+  0.358770669f, 0.876712322f, -0.288234204f, -0.129858941f, 0.190389261f,
+  0.385882676f, 0.858340323f, -0.299303919f, -0.10642603f, 0.184118569f,
+  0.412410438f, 0.839344263f, -0.308218211f, -0.0839238986f, 0.175577536f,
+  0.438336551f, 0.819855869f, -0.315076709f, -0.0626061186f, 0.165248752f,
+  0.463647604f, 0.800000012f, -0.319999993f, -0.0426666662f, 0.153600007f,
+  0.488333941f, 0.779893398f, -0.323124141f, -0.0242428761f, 0.141067594f,
+  0.512389481f, 0.759643912f, -0.32459563f, -0.00742014404f, 0.128044486f,
+  0.535811245f, 0.7393502f, -0.324566722f, 0.0077621378f, 0.114872992f,
+  0.558599293f, 0.719101131f, -0.323191524f, 0.0213040095f, 0.101841435f,
+  0.580756366f, 0.698976099f, -0.320622474f, 0.0332381614f, 0.0891840607f,
+  0.602287352f, 0.679045081f, -0.31700778f, 0.0436232872f, 0.0770834163f,
+  0.623199344f, 0.659368992f, -0.312489092f, 0.0525378957f, 0.0656745508f,
+  0.643501103f, 0.639999986f, -0.307200015f, 0.0600746684f, 0.055050239f,
+  0.663203001f, 0.620982409f, -0.301264971f, 0.0663355365f, 0.0452668406f,
+  0.682316542f, 0.602352917f, -0.294798613f, 0.0714275241f, 0.0363501981f,
+  0.700854421f, 0.584141493f, -0.287905425f, 0.0754592717f, 0.0283014067f,
+  0.718829989f, 0.566371679f, -0.280679762f, 0.0785382912f, 0.0211020894f,
+  0.736257434f, 0.549061656f, -0.273206025f, 0.0807688311f, 0.0147191808f,
+  0.753151298f, 0.532224536f, -0.265559018f, 0.0822502971f, 0.00910903886f,
+  0.769526482f, 0.515869021f, -0.257804573f, 0.083076179f, 0.00422094902f,
+  0.785398185f, 0.5f, -0.25f, 0.0833333358f, 0.0f
+};
+
+const q31_t atanTable_q31[165] = {
+  0x00000000, 0x7FFFFFFF, 0x00000000, 0xD5555555, 0x00000000,
+  0x03FFAAB7, 0x7FE007FE, 0xFC01FF40, 0xD5952D68, 0x03FB037E,
+  0x07FD56EE, 0x7F807F80, 0xF80FE820, 0xD652D9F9, 0x07D86F12,
+  0x0BF70C13, 0x7EE2825B, 0xF4354BDD, 0xD788E1C0, 0x0B7C42BD,
+  0x0FEADD4D, 0x7E07E07E, 0xF07D0FB1, 0xD92E78AB, 0x0ECD8B5A,
+  0x13D6EEE9, 0x7CF310D7, 0xECF12248, 0xDB37F580, 0x11B795E9,
+  0x17B97B4C, 0x7BA71FE1, 0xE99A3DD9, 0xDD976892, 0x142ACA8C,
+  0x1B90D753, 0x7A279AD7, 0xE67FB981, 0xE03D479B, 0x161D22D6,
+  0x1F5B75F9, 0x78787878, 0xE3A76B2F, 0xE31921FE, 0x178A3A09,
+  0x2317EB46, 0x769E0077, 0xE1159A68, 0xE61A5109, 0x1872FFDF,
+  0x26C4EE6E, 0x749CB290, 0xDECD02EA, 0xE9309999, 0x18DD1E8F,
+  0x2A615B33, 0x72792E48, 0xDCCEE57A, 0xEC4CB6CC, 0x18D22998,
+  0x2DEC3284, 0x70381C0E, 0xDB1B245E, 0xEF60C84C, 0x185EACD8,
+  0x31649A73, 0x6DDE1876, 0xD9B068C5, 0xF260A1BC, 0x1791327A,
+  0x34C9DD88, 0x6B6FA1FE, 0xD88C4E2B, 0xF541FB4E, 0x16795318,
+  0x381B6993, 0x68F109A2, 0xD7AB90E6, 0xF7FC85D3, 0x1526DEF7,
+  0x3B58CE0B, 0x66666666, 0xD70A3D71, 0xFA89E60F, 0x13A92A30,
+  0x3E81BA17, 0x63D38BCC, 0xD6A3DE42, 0xFCE59C05, 0x120E80B7,
+  0x4195FA53, 0x613C030A, 0xD673A695, 0xFF0CDB52, 0x1063C2F8,
+  0x44957670, 0x5EA306D7, 0xD6749900, 0x00FE5988, 0x0EB4287D,
+  0x47802EAF, 0x5C0B8170, 0xD6A1A910, 0x02BA16FD, 0x0D0923E5,
+  0x4A563965, 0x59780C95, 0xD6F5D7A1, 0x044125E5, 0x0B6A6220,
+  0x4D17C073, 0x56EAF319, 0xD76C49ED, 0x059572AB, 0x09DDDE95,
+  0x4FC4FEE2, 0x546633C3, 0xD8005B85, 0x06B98FD3, 0x0868060E,
+  0x525E3E8D, 0x51EB851F, 0xD8ADAB9F, 0x07B086D4, 0x070BE2E2,
+  0x54E3D5EE, 0x4F7C5A0B, 0xD9702649, 0x087DAED2, 0x05CB4DC6,
+  0x5756261C, 0x4D19E6B4, 0xDA4409F9, 0x09248984, 0x04A71F93,
+  0x59B598E5, 0x4AC525D3, 0xDB25EA25, 0x09A8A646, 0x039F6166,
+  0x5C029F16, 0x487EDE05, 0xDC12AF6D, 0x0A0D8AF3, 0x02B37928,
+  0x5E3DAEF5, 0x4647A70D, 0xDD0795D1, 0x0A56A20A, 0x01E25170,
+  0x606742DC, 0x441FEEF8, 0xDE02297F, 0x0A872D7E, 0x012A7C28,
+  0x627FD7FD, 0x4207FEF8, 0xDF00428C, 0x0AA23D81, 0x008A4FE3,
+  0x6487ED51, 0x40000000, 0xE0000000, 0x0AAAAAAB, 0x00000000
+};
+
+/**
+ * \par
+ * Table of tanh(n / 8) for the floating-point hyperbolic tangent, n = 0 to 72:
+ * <pre>
+ * tanhTable[n] = tanh(n / 8.0);
+ * </pre>
+ */
+const float32_t tanhTable_f32[73] = {
+  0.0f, 0.124352999f, 0.244918659f, 0.3583574f,
+  0.462117165f, 0.554599702f, 0.635148942f, 0.703905582f,
+  0.761594176f, 0.809301078f, 0.848283648f, 0.879826725f,
+  0.905148268f, 0.925346196f, 0.941375554f, 0.954045236f,
+  0.964027584f, 0.971872747f, 0.978026092f, 0.982845008f,
+  0.986614287f, 0.98955977f, 0.991859734f, 0.993654609f,
+  0.995054781f, 0.99614656f, 0.996997654f, 0.997660995f,
+  0.998177886f, 0.998580635f, 0.998894453f, 0.999138892f,
+  0.999329329f, 0.999477625f, 0.999593139f, 0.999683142f,
+  0.999753237f, 0.999807775f, 0.999850333f, 0.999883413f,
+  0.999909222f, 0.999929309f, 0.999944925f, 0.999957085f,
+  0.999966621f, 0.999974012f, 0.999979734f, 0.999984205f,
+  0.999987721f, 0.999990404f, 0.999992549f, 0.999994218f,
+  0.99999547f, 0.999996483f, 0.999997258f, 0.999997854f,
+  0.999998331f, 0.999998689f, 0.999998987f, 0.999999225f,
+  0.999999404f, 0.999999523f, 0.999999642f, 0.999999702f,
+  0.999999762f, 0.999999821f, 0.999999881f, 0.999999881f,
+  0.99999994f, 0.99999994f, 0.99999994f, 0.99999994f,
+  0.99999994f
+};
+
+/**
+ * \par
+ * Table of tanh(n / 16) for the Q31 and Q15 hyperbolic tangent, n = 0 to 176,
+ * in Q31 (1.31 fixed-point format):
+ * <pre>
+ * tanhTable[n] = tanh(n / 16.0) * pow(2, 31);
+ * </pre>
+ * rounded to the nearest integer value and saturated to 0x7FFFFFFF.
+ */
+const q31_t tanhTable_q31[177] = {
+  0x00000000, 0x07FD5666, 0x0FEACC96, 0x17B8FF90, 0x1F597EA7, 0x26BF3142,
+  0x2DDEA7BD, 0x34AE53DD, 0x3B26A7AF, 0x41421BCC, 0x46FD1FAB, 0x4C55F7FA,
+  0x514C8F95, 0x55E23FC4, 0x5A19942E, 0x5DF60E39, 0x617BEAD4, 0x64AFECDC,
+  0x67972D6F, 0x6A36F2F1, 0x6C948EEE, 0x6EB54293, 0x709E294B, 0x725428CD,
+  0x73DBE5E2, 0x7539BD19, 0x7671BEC0, 0x7787AD65, 0x787EFE60, 0x795ADBD0,
+  0x7A1E27B4, 0x7ACB7FB7, 0x7B654178, 0x7BED8F08, 0x7C66537E, 0x7CD14782,
+  0x7D2FF5B1, 0x7D83BECB, 0x7DCDDDAD, 0x7E0F6AFD, 0x7E496098, 0x7E7C9CB9,
+  0x7EA9E4D3, 0x7ED1E836, 0x7EF5426C, 0x7F147D5A, 0x7F301337, 0x7F48703E,
+  0x7F5DF444, 0x7F70F418, 0x7F81BAC2, 0x7F908A9D, 0x7F9D9E57, 0x7FA929D0,
+  0x7FB35AE0, 0x7FBC5A09, 0x7FC44B19, 0x7FCB4DAD, 0x7FD17DB5, 0x7FD6F3DB,
+  0x7FDBC5EA, 0x7FE0071E, 0x7FE3C873, 0x7FE718EB, 0x7FEA05C2, 0x7FEC9AAA,
+  0x7FEEE1F4, 0x7FF0E4BD, 0x7FF2AB10, 0x7FF43C05, 0x7FF59DE2, 0x7FF6D62D,
+  0x7FF7E9C8, 0x7FF8DD03, 0x7FF9B3AB, 0x7FFA711B, 0x7FFB184A, 0x7FFBABD4,
+  0x7FFC2E09, 0x7FFCA0F1, 0x7FFD065A, 0x7FFD5FD8, 0x7FFDAED2, 0x7FFDF485,
+  0x7FFE3207, 0x7FFE684F, 0x7FFE9837, 0x7FFEC27D, 0x7FFEE7CC, 0x7FFF08B9,
+  0x7FFF25C7, 0x7FFF3F6B, 0x7FFF560C, 0x7FFF6A04, 0x7FFF7BA4, 0x7FFF8B31,
+  0x7FFF98EB, 0x7FFFA508, 0x7FFFAFB8, 0x7FFFB927, 0x7FFFC17A, 0x7FFFC8D3,
+  0x7FFFCF4F, 0x7FFFD507, 0x7FFFDA14, 0x7FFFDE89, 0x7FFFE277, 0x7FFFE5F0,
+  0x7FFFE900, 0x7FFFEBB4, 0x7FFFEE16, 0x7FFFF031, 0x7FFFF20D, 0x7FFFF3B0,
+  0x7FFFF523, 0x7FFFF669, 0x7FFFF78A, 0x7FFFF888, 0x7FFFF969, 0x7FFFFA2F,
+  0x7FFFFADE, 0x7FFFFB79, 0x7FFFFC01, 0x7FFFFC79, 0x7FFFFCE3, 0x7FFFFD41,
+  0x7FFFFD93, 0x7FFFFDDC, 0x7FFFFE1D, 0x7FFFFE55, 0x7FFFFE88, 0x7FFFFEB4,
+  0x7FFFFEDB, 0x7FFFFEFD, 0x7FFFFF1C, 0x7FFFFF37, 0x7FFFFF4E, 0x7FFFFF63,
+  0x7FFFFF76, 0x7FFFFF86, 0x7FFFFF94, 0x7FFFFFA1, 0x7FFFFFAC, 0x7FFFFFB6,
+  0x7FFFFFBF, 0x7FFFFFC6, 0x7FFFFFCD, 0x7FFFFFD3, 0x7FFFFFD8, 0x7FFFFFDD,
+  0x7FFFFFE1, 0x7FFFFFE5, 0x7FFFFFE8, 0x7FFFFFEB, 0x7FFFFFED, 0x7FFFFFEF,
+  0x7FFFFFF1, 0x7FFFFFF3, 0x7FFFFFF5, 0x7FFFFFF6, 0x7FFFFFF7, 0x7FFFFFF8,
+  0x7FFFFFF9, 0x7FFFFFFA, 0x7FFFFFFB, 0x7FFFFFFB, 0x7FFFFFFC, 0x7FFFFFFC,
+  0x7FFFFFFD, 0x7FFFFFFD, 0x7FFFFFFD, 0x7FFFFFFE, 0x7FFFFFFE, 0x7FFFFFFE,
+  0x7FFFFFFE, 0x7FFFFFFF, 0x7FFFFFFF
+};
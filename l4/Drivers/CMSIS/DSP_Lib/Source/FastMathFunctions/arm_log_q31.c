@@ -0,0 +1,160 @@
+/* ----------------------------------------------------------------------
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.
+*
+* $Date:        21. September 2015
+* $Revision:    V.1.4.5 a
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_log_q31.c
+*
+* Description:  Fast natural logarithm calculation for Q31 values.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**
+ * @ingroup groupFastMath
+ */
+
+/**
+ * @addtogroup log
+ * @{
+ */
+
+/* ln(2) in 1.31 format, multiplied by the shift in 64 bits */
+#define LOG_Q31_LN2          1488522236
+
+/**
+ * @brief  Fast approximation to the natural logarithm for Q31 data.
+ * @param[in] x input value in the range (0 +1).
+ * @return  ln(x) in 5.26 format.
+ */
+
+q31_t arm_log_q31(
+  q31_t x)
+{
+  q31_t m, d, r, p, lnm;                         /* Mantissa, offset, reduced argument, polynomial */
+  uint32_t s, i;                                 /* Shift, table index */
+
+  if(x <= 0)
+  {
+    return ((q31_t) 0x80000000);
+  }
+
+  /* Mantissa in [0.5 1) */
+  s = __CLZ(x) - 1u;
+  m = x << s;
+
+  /* Nearest table point c = 0.5 + i / 64 */
+  i = ((uint32_t) (m - 0x40000000) + 0x01000000u) >> 25;
+  d = (q31_t) ((uint32_t) m - (0x40000000u + (i << 25)));
+
+  /* r = (m - c) / c, 1/c being in 3.29 format */
+  r = (q31_t) (((q63_t) d * logInvTable_q31[i]) >> 29);
+
+  /* ln(1 + r) = r + r * r * (-1/2 + r * (1/3 - r / 4)) */
+  p = -0x20000000;
+  p = 0x2AAAAAAB + (q31_t) (((q63_t) p * r) >> 31);
+  p = -0x40000000 + (q31_t) (((q63_t) p * r) >> 31);
+  p = (q31_t) (((q63_t) p * r) >> 31);
+  p = r + (q31_t) (((q63_t) p * r) >> 31);
+
+  lnm = logTable_q31[i] + p;
+
+  /* ln(x) = ln(m) - s * ln(2), rounded to 5.26 */
+  return ((q31_t) ((((q63_t) lnm - ((q63_t) s * LOG_Q31_LN2)) + 16) >> 5));
+}
+
+/**
+ * @brief  Natural logarithm of the elements of a Q31 vector.
+ * @param[in]  *pSrc points to the input vector
+ * @param[out] *pDst points to the output vector
+ * @param[in]  blockSize number of samples in each vector
+ * @return none.
+ */
+
+void arm_vlog_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* loop counter */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /*loop Unrolling */
+  blkCnt = blockSize >> 2u;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while(blkCnt > 0u)
+  {
+    /* The four evaluations are independent and can be interleaved */
+    pDst[0] = arm_log_q31(pSrc[0]);
+    pDst[1] = arm_log_q31(pSrc[1]);
+    pDst[2] = arm_log_q31(pSrc[2]);
+    pDst[3] = arm_log_q31(pSrc[3]);
+
+    pSrc += 4u;
+    pDst += 4u;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4u;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  /* Initialize blkCnt with number of samples */
+  blkCnt = blockSize;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+  while(blkCnt > 0u)
+  {
+    *pDst++ = arm_log_q31(*pSrc++);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of log group
+ */
@@ -0,0 +1,294 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library
+ * Title:        arm_pool_q7_HWC.c
+ * Description:  Q7 max and average pooling functions
+ *
+ * $Date:        17. January 2018
+ * $Revision:    V.1.0.0
+ *
+ * Target Processor:  Cortex-M cores
+ *
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup Pooling
+ * @{
+ */
+
+  /**
+   * @brief Q7 max pooling function
+   * @param[in]       Im_in       pointer to input tensor
+   * @param[in]       dim_im_in   input tensor dimension
+   * @param[in]       ch_im_in    number of input tensor channels
+   * @param[in]       dim_kernel  filter kernel size
+   * @param[in]       padding     padding sizes
+   * @param[in]       stride      convolution stride
+   * @param[in]       dim_im_out  output tensor dimension
+   * @param[in,out]   Im_out      pointer to output tensor
+   * @return none.
+   *
+   * @details
+   *
+   * The input tensor is not modified. The padding values are not part of
+   * the window. On Cortex-M4 and Cortex-M7, four channels are compared at
+   * a time with SSUB8 and SEL.
+   */
+
+void
+arm_maxpool_q7_HWC(const q7_t * Im_in,
+                   const uint16_t dim_im_in,
+                   const uint16_t ch_im_in,
+                   const uint16_t dim_kernel,
+                   const uint16_t padding,
+                   const uint16_t stride,
+                   const uint16_t dim_im_out,
+                   q7_t * Im_out)
+{
+  int16_t   i_x, i_y;
+  int16_t   k_x, k_y;
+  int16_t   x_start, x_end, y_start, y_end;
+  const q7_t *pIn;
+  q7_t     *pOut = Im_out;
+  q7_t      max;
+  uint16_t  i_ch;
+#if defined (ARM_MATH_DSP)
+  q31_t     max4, in4;
+  uint16_t  chCnt;
+#endif
+
+  for (i_y = 0; i_y < dim_im_out; i_y++)
+  {
+    /* clip the window to the input tensor */
+    y_start = i_y * stride - padding;
+    y_end = y_start + dim_kernel;
+    y_start = (y_start < 0) ? 0 : y_start;
+    y_end = (y_end > dim_im_in) ? dim_im_in : y_end;
+
+    for (i_x = 0; i_x < dim_im_out; i_x++)
+    {
+      x_start = i_x * stride - padding;
+      x_end = x_start + dim_kernel;
+      x_start = (x_start < 0) ? 0 : x_start;
+      x_end = (x_end > dim_im_in) ? dim_im_in : x_end;
+
+      i_ch = 0u;
+
+#if defined (ARM_MATH_DSP)
+
+      /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+      chCnt = ch_im_in >> 2;
+
+      while (chCnt > 0u)
+      {
+        /* -128 in the four lanes */
+        max4 = (q31_t) 0x80808080;
+
+        for (k_y = y_start; k_y < y_end; k_y++)
+        {
+          pIn = Im_in + (k_y * dim_im_in + x_start) * ch_im_in + i_ch;
+          for (k_x = x_start; k_x < x_end; k_x++)
+          {
+            in4 = *__SIMD32_CONST(pIn);
+            pIn += ch_im_in;
+
+            /* GE flags set in the lanes where in4 >= max4 */
+            (void)__SSUB8(in4, max4);
+            max4 = __SEL(in4, max4);
+          }
+        }
+
+        *__SIMD32(pOut)++ = max4;
+        i_ch += 4u;
+
+        chCnt--;
+      }
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+      /* remaining channels, or all of them on Cortex-M0 and Cortex-M3 */
+      for (; i_ch < ch_im_in; i_ch++)
+      {
+        max = -128;
+
+        for (k_y = y_start; k_y < y_end; k_y++)
+        {
+          pIn = Im_in + (k_y * dim_im_in + x_start) * ch_im_in + i_ch;
+          for (k_x = x_start; k_x < x_end; k_x++)
+          {
+            if (*pIn > max)
+            {
+              max = *pIn;
+            }
+            pIn += ch_im_in;
+          }
+        }
+
+        *pOut++ = max;
+      }
+    }
+  }
+}
+
+  /**
+   * @brief Q7 average pooling function
+   * @param[in]       Im_in       pointer to input tensor
+   * @param[in]       dim_im_in   input tensor dimension
+   * @param[in]       ch_im_in    number of input tensor channels
+   * @param[in]       dim_kernel  filter kernel size
+   * @param[in]       padding     padding sizes
+   * @param[in]       stride      convolution stride
+   * @param[in]       dim_im_out  output tensor dimension
+   * @param[in,out]   Im_out      pointer to output tensor
+   * @return none.
+   *
+   * @details
+   *
+   * The input tensor is not modified. Each output is the sum of the window
+   * divided by the number of input values it covers, the padding values
+   * being excluded, truncated toward zero. On Cortex-M4 and Cortex-M7, four
+   * channels are accumulated at a time in two q15x2 words with SADD16 when
+   * the window has no more than 256 values.
+   */
+
+void
+arm_avepool_q7_HWC(const q7_t * Im_in,
+                   const uint16_t dim_im_in,
+                   const uint16_t ch_im_in,
+                   const uint16_t dim_kernel,
+                   const uint16_t padding,
+                   const uint16_t stride,
+                   const uint16_t dim_im_out,
+                   q7_t * Im_out)
+{
+  int16_t   i_x, i_y;
+  int16_t   k_x, k_y;
+  int16_t   x_start, x_end, y_start, y_end;
+  const q7_t *pIn;
+  q7_t     *pOut = Im_out;
+  int32_t   sum, count;
+  uint16_t  i_ch;
+#if defined (ARM_MATH_DSP)
+  q31_t     sum02, sum13, in4;
+  uint16_t  chCnt;
+#endif
+
+  for (i_y = 0; i_y < dim_im_out; i_y++)
+  {
+    /* clip the window to the input tensor */
+    y_start = i_y * stride - padding;
+    y_end = y_start + dim_kernel;
+    y_start = (y_start < 0) ? 0 : y_start;
+    y_end = (y_end > dim_im_in) ? dim_im_in : y_end;
+
+    for (i_x = 0; i_x < dim_im_out; i_x++)
+    {
+      x_start = i_x * stride - padding;
+      x_end = x_start + dim_kernel;
+      x_start = (x_start < 0) ? 0 : x_start;
+      x_end = (x_end > dim_im_in) ? dim_im_in : x_end;
+
+      count = (int32_t)(y_end - y_start) * (x_end - x_start);
+      if (count <= 0)
+      {
+        /* the window only covers padding */
+        memset(pOut, 0, ch_im_in);
+        pOut += ch_im_in;
+        continue;
+      }
+
+      i_ch = 0u;
+
+#if defined (ARM_MATH_DSP)
+
+      /* Run the below code for Cortex-M4 and Cortex-M7 */
+
+      /* 256 * -128 is the most a q15 lane can hold */
+      chCnt = (count <= 256) ? (ch_im_in >> 2) : 0u;
+
+      while (chCnt > 0u)
+      {
+        sum02 = 0;
+        sum13 = 0;
+
+        for (k_y = y_start; k_y < y_end; k_y++)
+        {
+          pIn = Im_in + (k_y * dim_im_in + x_start) * ch_im_in + i_ch;
+          for (k_x = x_start; k_x < x_end; k_x++)
+          {
+            in4 = *__SIMD32_CONST(pIn);
+            pIn += ch_im_in;
+
+            sum02 = __SADD16(sum02, __SXTB16(in4));
+            sum13 = __SADD16(sum13, __SXTB16(__ROR((uint32_t)in4, 8)));
+          }
+        }
+
+#ifndef ARM_MATH_BIG_ENDIAN
+        pOut[0] = (q7_t) ((q15_t) sum02 / count);
+        pOut[1] = (q7_t) ((q15_t) sum13 / count);
+        pOut[2] = (q7_t) ((q15_t) (sum02 >> 16) / count);
+        pOut[3] = (q7_t) ((q15_t) (sum13 >> 16) / count);
+#else
+        pOut[3] = (q7_t) ((q15_t) sum02 / count);
+        pOut[2] = (q7_t) ((q15_t) sum13 / count);
+        pOut[1] = (q7_t) ((q15_t) (sum02 >> 16) / count);
+        pOut[0] = (q7_t) ((q15_t) (sum13 >> 16) / count);
+#endif
+        pOut += 4;
+        i_ch += 4u;
+
+        chCnt--;
+      }
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+      /* remaining channels, or all of them on Cortex-M0 and Cortex-M3 */
+      for (; i_ch < ch_im_in; i_ch++)
+      {
+        sum = 0;
+
+        for (k_y = y_start; k_y < y_end; k_y++)
+        {
+          pIn = Im_in + (k_y * dim_im_in + x_start) * ch_im_in + i_ch;
+          for (k_x = x_start; k_x < x_end; k_x++)
+          {
+            sum += *pIn;
+            pIn += ch_im_in;
+          }
+        }
+
+        *pOut++ = (q7_t) (sum / count);
+      }
+    }
+  }
+}
+
+/**
+ * @} end of Pooling group
+ */
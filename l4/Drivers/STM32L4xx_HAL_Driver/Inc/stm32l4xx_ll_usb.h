@@ -281,6 +281,12 @@ typedef struct
   uint8_t   doublebuffer;    /*!< Double buffer enable
                                  This parameter can be 0 or 1                                             */
 
+  uint8_t   db_armed;       /*!< Double buffered endpoint: transfer in progress                            */
+
+  uint8_t   db_queued;      /*!< Double buffered IN endpoint: packets in the PMA not sent yet              */
+
+  uint32_t  db_packets;     /*!< Double buffered IN endpoint: packets not copied to the PMA yet            */
+
   uint16_t  tx_fifo_num;    /*!< This parameter is not required by USB Device FS peripheral, it is used
                                  only by USB OTG FS peripheral
                                  This parameter is added to ensure compatibility across USB peripherals   */
@@ -38,6 +38,23 @@
      (#)Enable PCD transmission and reception:
          (##) HAL_PCD_Start();
 
+    [..]
+      Bulk and isochronous endpoints of the USB device FS peripheral can be
+      double buffered, the packet memory area (PMA) then holds two buffers of
+      the maximum packet size per endpoint:
+      (+) Call HAL_PCDEx_PMAConfig() with PCD_DBL_BUF before the endpoint is
+          opened, buffer 0 address in the 16 LSB and buffer 1 address in the
+          16 MSB, e.g. for 64 byte bulk endpoints (usbd_conf.c of a CDC or MSC
+          application):
+          HAL_PCDEx_PMAConfig(&hpcd, 0x01U, PCD_DBL_BUF, 0x010000C0U);
+          HAL_PCDEx_PMAConfig(&hpcd, 0x81U, PCD_DBL_BUF, 0x01800140U);
+      (+) The peripheral receives or sends a packet while the previous one is
+          copied, a bulk transfer of several packets is then not NAKed between
+          packets. The classes keep using HAL_PCD_EP_Receive() and
+          HAL_PCD_EP_Transmit() with transfers of several packets: a bulk OUT
+          packet received before the next HAL_PCD_EP_Receive() is kept in the
+          PMA, the host being NAKed meanwhile.
+
   @endverbatim
   ******************************************************************************
   * @attention
@@ -116,6 +133,11 @@ static HAL_StatusTypeDef PCD_WriteEmptyTxFifo(PCD_HandleTypeDef *hpcd, uint32_t
 
 #if defined (USB)
 static HAL_StatusTypeDef PCD_EP_ISR_Handler(PCD_HandleTypeDef *hpcd);
+static void PCD_DbStartXfer(PCD_HandleTypeDef *hpcd, PCD_EPTypeDef *ep);
+static void PCD_DbReceive(PCD_HandleTypeDef *hpcd, PCD_EPTypeDef *ep);
+static void PCD_DbWritePacket(PCD_HandleTypeDef *hpcd, PCD_EPTypeDef *ep, uint8_t buf);
+static void PCD_DbTransmit(PCD_HandleTypeDef *hpcd, PCD_EPTypeDef *ep);
+static void PCD_DbTxComplete(PCD_HandleTypeDef *hpcd, PCD_EPTypeDef *ep);
 #endif /* USB */
 /**
   * @}
@@ -1417,6 +1439,7 @@ void HAL_PCD_IRQHandler(PCD_HandleTypeDef *hpcd)
     /* Handle SOF Interrupt */
     if (__HAL_PCD_GET_FLAG(hpcd, USB_OTG_GINTSTS_SOF))
     {
+      __HAL_TRACE(HAL_TRACE_EVT_USB_SOF, hpcd->Instance);
 #if (USE_HAL_PCD_REGISTER_CALLBACKS == 1U)
       hpcd->SOFCallback(hpcd);
 #else
@@ -1595,6 +1618,7 @@ void HAL_PCD_IRQHandler(PCD_HandleTypeDef *hpcd)
   {
     __HAL_PCD_CLEAR_FLAG(hpcd, USB_ISTR_SOF);
 
+    __HAL_TRACE(HAL_TRACE_EVT_USB_SOF, hpcd->Instance);
 #if (USE_HAL_PCD_REGISTER_CALLBACKS == 1U)
     hpcd->SOFCallback(hpcd);
 #else
@@ -1941,6 +1965,13 @@ HAL_StatusTypeDef HAL_PCD_EP_Receive(PCD_HandleTypeDef *hpcd, uint8_t ep_addr, u
   {
     (void)USB_EP0StartXfer(hpcd->Instance, ep);
   }
+#if defined (USB)
+  else if (ep->doublebuffer != 0U)
+  {
+    /* Double buffered bulk or isochronous endpoint */
+    PCD_DbStartXfer(hpcd, ep);
+  }
+#endif /* USB */
   else
   {
     (void)USB_EPStartXfer(hpcd->Instance, ep);
@@ -1984,6 +2015,13 @@ HAL_StatusTypeDef HAL_PCD_EP_Transmit(PCD_HandleTypeDef *hpcd, uint8_t ep_addr,
   {
     (void)USB_EP0StartXfer(hpcd->Instance, ep);
   }
+#if defined (USB)
+  else if (ep->doublebuffer != 0U)
+  {
+    /* Double buffered bulk or isochronous endpoint */
+    PCD_DbStartXfer(hpcd, ep);
+  }
+#endif /* USB */
   else
   {
     (void)USB_EPStartXfer(hpcd->Instance, ep);
@@ -2215,6 +2253,233 @@ static HAL_StatusTypeDef PCD_WriteEmptyTxFifo(PCD_HandleTypeDef *hpcd, uint32_t
 #endif /* USB_OTG_FS || USB_OTG_HS */
 
 #if defined (USB)
+/**
+  * @brief  Start a transfer on a double buffered endpoint.
+  * @param  hpcd PCD handle
+  * @param  ep endpoint structure
+  * @retval None
+  */
+static void PCD_DbStartXfer(PCD_HandleTypeDef *hpcd, PCD_EPTypeDef *ep)
+{
+  /* No CTR interrupt while the transfer is set up: the endpoint completes a
+     transaction as soon as a buffer is released to the peripheral */
+  hpcd->Instance->CNTR &= (uint16_t)~USB_CNTR_CTRM;
+
+  ep->db_armed = 1U;
+
+  if (ep->is_in != 0U)
+  {
+    /* Packets to copy to the PMA, one zero length packet for an empty transfer */
+    if (ep->xfer_len == 0U)
+    {
+      ep->db_packets = 1U;
+    }
+    else
+    {
+      ep->db_packets = (ep->xfer_len + ep->maxpacket - 1U) / ep->maxpacket;
+    }
+    PCD_DbTransmit(hpcd, ep);
+    PCD_SET_EP_TX_STATUS(hpcd->Instance, ep->num, USB_EP_TX_VALID);
+  }
+  else if (ep->type != EP_TYPE_ISOC)
+  {
+    /* A bulk packet received while no transfer was armed waits in the PMA */
+    PCD_DbReceive(hpcd, ep);
+  }
+  else
+  {
+    /* Isochronous packets are read from the next frame on */
+  }
+
+  hpcd->Instance->CNTR |= (uint16_t)USB_CNTR_CTRM;
+}
+
+/**
+  * @brief  Read the packet received on a double buffered OUT endpoint.
+  * @note   Bulk: DTOG_RX points to the buffer the peripheral fills and SW_BUF
+  *         (DTOG_TX) to the one the application owns. When they are equal the
+  *         other buffer holds a packet and the host is NAKed until SW_BUF is
+  *         toggled: this is done before the copy, so that the next packet is
+  *         received while this one is read.
+  *         Isochronous: the peripheral toggles DTOG_RX after each frame and
+  *         the packet is in the buffer it does not point to.
+  * @param  hpcd PCD handle
+  * @param  ep endpoint structure
+  * @retval None
+  */
+static void PCD_DbReceive(PCD_HandleTypeDef *hpcd, PCD_EPTypeDef *ep)
+{
+  uint16_t wEPVal = PCD_GET_ENDPOINT(hpcd->Instance, ep->num);
+  uint16_t count;
+  uint16_t len;
+  uint16_t pmabuffer;
+  uint8_t ready = ep->db_armed;
+
+  /* No transfer armed: a bulk packet stays in the PMA, an isochronous one is lost */
+  if ((ready != 0U) && (ep->type != EP_TYPE_ISOC))
+  {
+    if (((wEPVal & USB_EP_DTOG_RX) != 0U) != ((wEPVal & USB_EP_DTOG_TX) != 0U))
+    {
+      /* Nothing received yet */
+      ready = 0U;
+    }
+    else
+    {
+      PCD_FreeUserBuffer(hpcd->Instance, ep->num, ep->is_in);
+    }
+  }
+
+  if (ready != 0U)
+  {
+    if ((wEPVal & USB_EP_DTOG_RX) != 0U)
+    {
+      count = (uint16_t)PCD_GET_EP_DBUF0_CNT(hpcd->Instance, ep->num);
+      pmabuffer = ep->pmaaddr0;
+    }
+    else
+    {
+      count = (uint16_t)PCD_GET_EP_DBUF1_CNT(hpcd->Instance, ep->num);
+      pmabuffer = ep->pmaaddr1;
+    }
+
+    /* Bytes beyond the end of the transfer are dropped */
+    len = (count > ep->xfer_len) ? (uint16_t)ep->xfer_len : count;
+    if (len != 0U)
+    {
+      USB_ReadPMA(hpcd->Instance, ep->xfer_buff, pmabuffer, len);
+    }
+    ep->xfer_buff += len;
+    ep->xfer_count += len;
+    ep->xfer_len -= len;
+
+    if ((ep->xfer_len == 0U) || (count < ep->maxpacket))
+    {
+      ep->db_armed = 0U;
+
+      /* RX COMPLETE */
+#if (USE_HAL_PCD_REGISTER_CALLBACKS == 1U)
+      hpcd->DataOutStageCallback(hpcd, ep->num);
+#else
+      HAL_PCD_DataOutStageCallback(hpcd, ep->num);
+#endif /* USE_HAL_PCD_REGISTER_CALLBACKS */
+    }
+  }
+}
+
+/**
+  * @brief  Copy the next packet of a transfer to a buffer of a double
+  *         buffered IN endpoint.
+  * @param  hpcd PCD handle
+  * @param  ep endpoint structure
+  * @param  buf buffer number, 0 or 1
+  * @retval None
+  */
+static void PCD_DbWritePacket(PCD_HandleTypeDef *hpcd, PCD_EPTypeDef *ep, uint8_t buf)
+{
+  uint16_t len;
+  uint16_t pmabuffer;
+
+  len = (ep->xfer_len > ep->maxpacket) ? (uint16_t)ep->maxpacket : (uint16_t)ep->xfer_len;
+
+  if (buf == 0U)
+  {
+    PCD_SET_EP_DBUF0_CNT(hpcd->Instance, ep->num, ep->is_in, len);
+    pmabuffer = ep->pmaaddr0;
+  }
+  else
+  {
+    PCD_SET_EP_DBUF1_CNT(hpcd->Instance, ep->num, ep->is_in, len);
+    pmabuffer = ep->pmaaddr1;
+  }
+
+  if (len != 0U)
+  {
+    USB_WritePMA(hpcd->Instance, ep->xfer_buff, pmabuffer, len);
+  }
+  ep->xfer_buff += len;
+  ep->xfer_count += len;
+  ep->xfer_len -= len;
+
+  if (ep->db_packets != 0U)
+  {
+    ep->db_packets--;
+  }
+}
+
+/**
+  * @brief  Queue the next packets of a transfer on a double buffered IN endpoint.
+  * @note   Bulk: DTOG_TX points to the buffer the peripheral sends and SW_BUF
+  *         (DTOG_RX) to the one the application fills; the host is NAKed when
+  *         they are equal. A packet is released (SW_BUF toggled) when the
+  *         peripheral is idle, the second one is copied in advance and
+  *         released when the first is acknowledged.
+  *         Isochronous: the packet goes to the buffer sent in the next frame,
+  *         which is emptied when there is nothing left to send.
+  * @param  hpcd PCD handle
+  * @param  ep endpoint structure
+  * @retval None
+  */
+static void PCD_DbTransmit(PCD_HandleTypeDef *hpcd, PCD_EPTypeDef *ep)
+{
+  uint16_t wEPVal;
+
+  if (ep->type == EP_TYPE_ISOC)
+  {
+    wEPVal = PCD_GET_ENDPOINT(hpcd->Instance, ep->num);
+    PCD_DbWritePacket(hpcd, ep, ((wEPVal & USB_EP_DTOG_TX) != 0U) ? 1U : 0U);
+  }
+  else
+  {
+    while ((ep->db_packets != 0U) && (ep->db_queued < 2U))
+    {
+      wEPVal = PCD_GET_ENDPOINT(hpcd->Instance, ep->num);
+      PCD_DbWritePacket(hpcd, ep, ((wEPVal & USB_EP_DTOG_RX) != 0U) ? 1U : 0U);
+
+      if (ep->db_queued == 0U)
+      {
+        PCD_FreeUserBuffer(hpcd->Instance, ep->num, ep->is_in);
+      }
+      ep->db_queued++;
+    }
+  }
+}
+
+/**
+  * @brief  Handle a packet sent on a double buffered IN endpoint.
+  * @param  hpcd PCD handle
+  * @param  ep endpoint structure
+  * @retval None
+  */
+static void PCD_DbTxComplete(PCD_HandleTypeDef *hpcd, PCD_EPTypeDef *ep)
+{
+  if (ep->db_armed != 0U)
+  {
+    if (ep->type != EP_TYPE_ISOC)
+    {
+      ep->db_queued--;
+      if (ep->db_queued != 0U)
+      {
+        /* The host is NAKed: release the packet copied in advance */
+        PCD_FreeUserBuffer(hpcd->Instance, ep->num, ep->is_in);
+      }
+    }
+
+    PCD_DbTransmit(hpcd, ep);
+
+    if ((ep->db_packets == 0U) && (ep->db_queued == 0U))
+    {
+      ep->db_armed = 0U;
+
+      /* TX COMPLETE */
+#if (USE_HAL_PCD_REGISTER_CALLBACKS == 1U)
+      hpcd->DataInStageCallback(hpcd, ep->num);
+#else
+      HAL_PCD_DataInStageCallback(hpcd, ep->num);
+#endif /* USE_HAL_PCD_REGISTER_CALLBACKS */
+    }
+  }
+}
+
 /**
   * @brief  This function handles PCD Endpoint interrupt request.
   * @param  hpcd PCD handle
@@ -2326,53 +2591,35 @@ static HAL_StatusTypeDef PCD_EP_ISR_Handler(PCD_HandleTypeDef *hpcd)
         PCD_CLEAR_RX_EP_CTR(hpcd->Instance, epindex);
         ep = &hpcd->OUT_ep[epindex];
 
-        /* OUT double Buffering*/
-        if (ep->doublebuffer == 0U)
+        if (ep->doublebuffer != 0U)
+        {
+          /* OUT double Buffering */
+          PCD_DbReceive(hpcd, ep);
+        }
+        else
         {
           count = (uint16_t)PCD_GET_EP_RX_CNT(hpcd->Instance, ep->num);
           if (count != 0U)
           {
             USB_ReadPMA(hpcd->Instance, ep->xfer_buff, ep->pmaadress, count);
           }
-        }
-        else
-        {
-          if ((PCD_GET_ENDPOINT(hpcd->Instance, ep->num) & USB_EP_DTOG_RX) != 0U)
+          /*multi-packet on the NON control OUT endpoint*/
+          ep->xfer_count += count;
+          ep->xfer_buff += count;
+
+          if ((ep->xfer_len == 0U) || (count < ep->maxpacket))
           {
-            /*read from endpoint BUF0Addr buffer*/
-            count = (uint16_t)PCD_GET_EP_DBUF0_CNT(hpcd->Instance, ep->num);
-            if (count != 0U)
-            {
-              USB_ReadPMA(hpcd->Instance, ep->xfer_buff, ep->pmaaddr0, count);
-            }
+            /* RX COMPLETE */
+#if (USE_HAL_PCD_REGISTER_CALLBACKS == 1U)
+            hpcd->DataOutStageCallback(hpcd, ep->num);
+#else
+            HAL_PCD_DataOutStageCallback(hpcd, ep->num);
+#endif /* USE_HAL_PCD_REGISTER_CALLBACKS */
           }
           else
           {
-            /*read from endpoint BUF1Addr buffer*/
-            count = (uint16_t)PCD_GET_EP_DBUF1_CNT(hpcd->Instance, ep->num);
-            if (count != 0U)
-            {
-              USB_ReadPMA(hpcd->Instance, ep->xfer_buff, ep->pmaaddr1, count);
-            }
+            (void)HAL_PCD_EP_Receive(hpcd, ep->num, ep->xfer_buff, ep->xfer_len);
           }
-          PCD_FreeUserBuffer(hpcd->Instance, ep->num, PCD_EP_DBUF_OUT);
-        }
-        /*multi-packet on the NON control OUT endpoint*/
-        ep->xfer_count += count;
-        ep->xfer_buff += count;
-
-        if ((ep->xfer_len == 0U) || (count < ep->maxpacket))
-        {
-          /* RX COMPLETE */
-#if (USE_HAL_PCD_REGISTER_CALLBACKS == 1U)
-          hpcd->DataOutStageCallback(hpcd, ep->num);
-#else
-          HAL_PCD_DataOutStageCallback(hpcd, ep->num);
-#endif /* USE_HAL_PCD_REGISTER_CALLBACKS */
-        }
-        else
-        {
-          (void)HAL_PCD_EP_Receive(hpcd, ep->num, ep->xfer_buff, ep->xfer_len);
         }
 
       } /* if((wEPVal & EP_CTR_RX) */
@@ -2384,23 +2631,31 @@ static HAL_StatusTypeDef PCD_EP_ISR_Handler(PCD_HandleTypeDef *hpcd)
         /* clear int flag */
         PCD_CLEAR_TX_EP_CTR(hpcd->Instance, epindex);
 
-        /*multi-packet on the NON control IN endpoint*/
-        ep->xfer_count = PCD_GET_EP_TX_CNT(hpcd->Instance, ep->num);
-        ep->xfer_buff += ep->xfer_count;
-
-        /* Zero Length Packet? */
-        if (ep->xfer_len == 0U)
+        if (ep->doublebuffer != 0U)
         {
-          /* TX COMPLETE */
-#if (USE_HAL_PCD_REGISTER_CALLBACKS == 1U)
-          hpcd->DataInStageCallback(hpcd, ep->num);
-#else
-          HAL_PCD_DataInStageCallback(hpcd, ep->num);
-#endif /* USE_HAL_PCD_REGISTER_CALLBACKS */
+          /* IN double Buffering */
+          PCD_DbTxComplete(hpcd, ep);
         }
         else
         {
-          (void)HAL_PCD_EP_Transmit(hpcd, ep->num, ep->xfer_buff, ep->xfer_len);
+          /*multi-packet on the NON control IN endpoint*/
+          ep->xfer_count = PCD_GET_EP_TX_CNT(hpcd->Instance, ep->num);
+          ep->xfer_buff += ep->xfer_count;
+
+          /* Zero Length Packet? */
+          if (ep->xfer_len == 0U)
+          {
+            /* TX COMPLETE */
+#if (USE_HAL_PCD_REGISTER_CALLBACKS == 1U)
+            hpcd->DataInStageCallback(hpcd, ep->num);
+#else
+            HAL_PCD_DataInStageCallback(hpcd, ep->num);
+#endif /* USE_HAL_PCD_REGISTER_CALLBACKS */
+          }
+          else
+          {
+            (void)HAL_PCD_EP_Transmit(hpcd, ep->num, ep->xfer_buff, ep->xfer_len);
+          }
         }
       }
     }
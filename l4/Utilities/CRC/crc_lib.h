@@ -0,0 +1,122 @@
+/**
+  ******************************************************************************
+  * @file    crc_lib.h
+  * @author  MCD Application Team
+  * @brief   Header for crc_lib module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _CRC_LIB_H__
+#define _CRC_LIB_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+/* Exported constants --------------------------------------------------------*/
+/* Tables per polynomial: 8 (slicing-by-8, 8 bytes per step), 4 (slicing-by-4)
+   or 1 (one byte per step, 1 KB). Override in main.h. */
+#if !defined(CRC_LIB_SLICES)
+#define CRC_LIB_SLICES            8U
+#endif
+
+#if (CRC_LIB_SLICES != 1U) && (CRC_LIB_SLICES != 4U) && (CRC_LIB_SLICES != 8U)
+#error "CRC_LIB_SLICES must be 1, 4 or 8"
+#endif
+
+/* Words of the table given to CRC_Lib_Init() */
+#define CRC_LIB_TABLE_WORDS       (CRC_LIB_SLICES * 256U)
+
+/* 1 when the CRC unit takes any polynomial of 7, 8, 16 or 32 bits */
+#if defined(CRC_POL_POL)
+#define CRC_LIB_HW_PROGRAMMABLE   1U
+#else
+#define CRC_LIB_HW_PROGRAMMABLE   0U
+#endif
+
+/* Serialisation of the CRC unit users (tasks, interrupts). Override in
+   main.h, e.g. with an RTOS mutex. */
+#if !defined(CRC_LIB_LOCK)
+#define CRC_LIB_LOCK()
+#define CRC_LIB_UNLOCK()
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+/* CRC algorithm, in the usual catalogue parameters */
+typedef struct
+{
+  uint32_t Poly;       /* Polynomial, normal form, without the x^Width term        */
+  uint32_t Init;       /* Register value before the first byte                     */
+  uint32_t XorOut;     /* Value xored to the register to give the CRC              */
+  uint8_t  Width;      /* CRC bits, 3 to 32; 7, 8, 16 or 32 with the CRC unit      */
+  uint8_t  Reflected;  /* 1: bytes and CRC LSB first (RefIn = RefOut = true)       */
+} CRC_Lib_ParamTypeDef;
+
+typedef struct
+{
+  const CRC_Lib_ParamTypeDef *pParam;
+  uint32_t *pTable;    /* CRC_LIB_TABLE_WORDS words, NULL when the CRC unit is used */
+  uint32_t Poly;       /* Polynomial of the register: reflected, or MSB aligned     */
+  uint32_t Init;       /* Init in the register                                      */
+  uint32_t Shift;      /* 32 - Width                                                */
+} CRC_Lib_HandleTypeDef;
+
+/* Exported variables --------------------------------------------------------*/
+extern const CRC_Lib_ParamTypeDef CRC_Lib_Crc8;          /* CRC-8/SMBUS, ATM HEC           */
+extern const CRC_Lib_ParamTypeDef CRC_Lib_Crc8Maxim;     /* CRC-8/MAXIM-DOW, 1-Wire        */
+extern const CRC_Lib_ParamTypeDef CRC_Lib_Crc8Sae;       /* CRC-8/SAE-J1850                */
+extern const CRC_Lib_ParamTypeDef CRC_Lib_Crc16Ccitt;    /* CRC-16/CCITT-FALSE (IBM-3740)  */
+extern const CRC_Lib_ParamTypeDef CRC_Lib_Crc16Xmodem;   /* CRC-16/XMODEM                  */
+extern const CRC_Lib_ParamTypeDef CRC_Lib_Crc16Kermit;   /* CRC-16/KERMIT                  */
+extern const CRC_Lib_ParamTypeDef CRC_Lib_Crc16Modbus;   /* CRC-16/MODBUS                  */
+extern const CRC_Lib_ParamTypeDef CRC_Lib_Crc32;         /* CRC-32, Ethernet, zlib         */
+extern const CRC_Lib_ParamTypeDef CRC_Lib_Crc32C;        /* CRC-32C, Castagnoli            */
+extern const CRC_Lib_ParamTypeDef CRC_Lib_Crc32Mpeg2;    /* CRC-32/MPEG-2, the fixed units */
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef CRC_Lib_Init(CRC_Lib_HandleTypeDef *hcrc, const CRC_Lib_ParamTypeDef *pParam, uint32_t *pTable);
+uint32_t          CRC_Lib_Compute(const CRC_Lib_HandleTypeDef *hcrc, const uint8_t *pData, uint32_t Length);
+uint32_t          CRC_Lib_Begin(const CRC_Lib_HandleTypeDef *hcrc);
+uint32_t          CRC_Lib_Update(const CRC_Lib_HandleTypeDef *hcrc, uint32_t State, const uint8_t *pData, uint32_t Length);
+uint32_t          CRC_Lib_End(const CRC_Lib_HandleTypeDef *hcrc, uint32_t State);
+uint32_t          CRC_Lib_Combine(const CRC_Lib_HandleTypeDef *hcrc, uint32_t Crc1, uint32_t Crc2, uint32_t Length2);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _CRC_LIB_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
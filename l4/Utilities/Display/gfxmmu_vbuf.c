@@ -0,0 +1,285 @@
+/**
+  ******************************************************************************
+  * @file    gfxmmu_vbuf.c
+  * @author  MCD Application Team
+  * @brief   GFXMMU virtual frame buffers: look-up table computed at run time
+  *          for the visible area of the display, physical buffers anywhere
+  *          (internal SRAM, HyperRAM, PSRAM)
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- describe the display in a GFXMMU_VBuf_ConfigTypeDef. For the round
+   390x390 display of the STM32L4R9I-Discovery in ARGB8888: Width and
+   Height 390, BytesPerPixel 4, GFXMMU_192BLOCKS, GFXMMU_VBUF_SHAPE_CIRCLE.
+   Other shapes give the visible span of each line by GetLineSpan.
+
+2- GFXMMU_VBuf_GetPhysicalSize() returns the size of one physical buffer:
+   only the 16-byte blocks holding visible pixels are stored (482528 bytes
+   instead of 608400 for the example above). Reserve that size, 16-byte
+   aligned, for each frame buffer. The buffers may be in the internal SRAM
+   or in a memory mapped HyperRAM (see hyperbus_mem): the memory must be
+   mapped before the GFXMMU is accessed.
+
+3- call GFXMMU_VBuf_Init() with the physical buffer addresses: it
+   initializes the GFXMMU (the MSP enables its clock) and fills the
+   look-up table. Invisible pixels read DefaultValue and writes to them
+   are dropped.
+
+4- the LTDC layers and the DMA2D use GFXMMU_VBUF_ADDRESS(n) with a line
+   pitch of GFXMMU_VBuf_GetPitch() bytes, as a rectangular frame buffer.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "gfxmmu_vbuf.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define VBUF_BLOCK_SIZE     16U
+#define VBUF_LUT_LINES      1024U
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t VBuf_LineBlocks(const GFXMMU_VBuf_ConfigTypeDef *pConfig, uint32_t Line,
+                                uint32_t *pFirst, uint32_t *pLast);
+static uint32_t VBuf_Sqrt(uint64_t Value);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Size of one physical frame buffer
+  * @param  pConfig: display description
+  * @retval Size in bytes, 0 when the description is not valid
+  */
+uint32_t GFXMMU_VBuf_GetPhysicalSize(const GFXMMU_VBuf_ConfigTypeDef *pConfig)
+{
+  uint32_t line;
+  uint32_t first;
+  uint32_t last;
+  uint32_t blocks = 0U;
+
+  if((pConfig->Width == 0U) || (pConfig->Height == 0U) || (pConfig->Height > VBUF_LUT_LINES) ||
+     (pConfig->BytesPerPixel == 0U) || (pConfig->BytesPerPixel > 4U) ||
+     ((pConfig->Width * pConfig->BytesPerPixel) > GFXMMU_VBuf_GetPitch(pConfig)) ||
+     ((pConfig->Shape == GFXMMU_VBUF_SHAPE_CUSTOM) && (pConfig->GetLineSpan == NULL)))
+  {
+    return 0U;
+  }
+
+  for(line = 0U; line < pConfig->Height; line++)
+  {
+    if(VBuf_LineBlocks(pConfig, line, &first, &last) != 0U)
+    {
+      blocks += (last - first) + 1U;
+    }
+  }
+
+  return blocks * VBUF_BLOCK_SIZE;
+}
+
+/**
+  * @brief  Line pitch of the virtual frame buffers
+  * @param  pConfig: display description
+  * @retval Pitch in bytes
+  */
+uint32_t GFXMMU_VBuf_GetPitch(const GFXMMU_VBuf_ConfigTypeDef *pConfig)
+{
+  return (pConfig->BlocksPerLine == GFXMMU_192BLOCKS) ? (192U * VBUF_BLOCK_SIZE) : (256U * VBUF_BLOCK_SIZE);
+}
+
+/**
+  * @brief  Initialize the GFXMMU and fill its look-up table
+  * @param  hgfxmmu: GFXMMU handle
+  * @param  pConfig: display description
+  * @param  pPhysAddress: physical buffer addresses, 16-byte aligned, each of
+  *         GFXMMU_VBuf_GetPhysicalSize() bytes
+  * @param  BufferNbr: number of frame buffers, 1 to GFXMMU_VBUF_MAX_BUFFERS
+  * @retval HAL status
+  */
+HAL_StatusTypeDef GFXMMU_VBuf_Init(GFXMMU_HandleTypeDef *hgfxmmu, const GFXMMU_VBuf_ConfigTypeDef *pConfig,
+                                   const uint32_t *pPhysAddress, uint32_t BufferNbr)
+{
+  uint32_t buffers[GFXMMU_VBUF_MAX_BUFFERS];
+  uint32_t lut[2];
+  uint32_t line;
+  uint32_t first;
+  uint32_t last;
+  uint32_t used = 0U;
+  uint32_t i;
+
+  if((BufferNbr == 0U) || (BufferNbr > GFXMMU_VBUF_MAX_BUFFERS) || (pPhysAddress == NULL))
+  {
+    return HAL_ERROR;
+  }
+  /* The line offset holds 22 bits */
+  if((GFXMMU_VBuf_GetPhysicalSize(pConfig) == 0U) ||
+     (GFXMMU_VBuf_GetPhysicalSize(pConfig) > (GFXMMU_LUTxH_LO_Msk + VBUF_BLOCK_SIZE)))
+  {
+    return HAL_ERROR;
+  }
+  for(i = 0U; i < GFXMMU_VBUF_MAX_BUFFERS; i++)
+  {
+    /* Unused buffers alias the first one */
+    buffers[i] = pPhysAddress[(i < BufferNbr) ? i : 0U];
+    if((buffers[i] % VBUF_BLOCK_SIZE) != 0U)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  hgfxmmu->Instance                     = GFXMMU;
+  hgfxmmu->Init.BlocksPerLine           = pConfig->BlocksPerLine;
+  hgfxmmu->Init.DefaultValue            = pConfig->DefaultValue;
+  hgfxmmu->Init.Buffers.Buf0Address     = buffers[0];
+  hgfxmmu->Init.Buffers.Buf1Address     = buffers[1];
+  hgfxmmu->Init.Buffers.Buf2Address     = buffers[2];
+  hgfxmmu->Init.Buffers.Buf3Address     = buffers[3];
+  hgfxmmu->Init.Interrupts.Activation   = DISABLE;
+  hgfxmmu->Init.Interrupts.UsedInterrupts = 0U;
+
+  if(HAL_GFXMMU_Init(hgfxmmu) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  for(line = 0U; line < pConfig->Height; line++)
+  {
+    if(VBuf_LineBlocks(pConfig, line, &first, &last) == 0U)
+    {
+      if(HAL_GFXMMU_DisableLutLines(hgfxmmu, line, 1U) != HAL_OK)
+      {
+        return HAL_ERROR;
+      }
+      continue;
+    }
+
+    /* Block 0 of the line is at (blocks already used - first visible block)
+       in the physical buffer: a 22-bit two's complement offset */
+    lut[0] = GFXMMU_LUTxL_EN | (first << GFXMMU_LUTxL_FVB_Pos) | (last << GFXMMU_LUTxL_LVB_Pos);
+    lut[1] = ((used - first) * VBUF_BLOCK_SIZE) & GFXMMU_LUTxH_LO_Msk;
+    used  += (last - first) + 1U;
+
+    if(HAL_GFXMMU_ConfigLut(hgfxmmu, line, 1U, (uint32_t)lut) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  if(pConfig->Height < VBUF_LUT_LINES)
+  {
+    return HAL_GFXMMU_DisableLutLines(hgfxmmu, pConfig->Height, VBUF_LUT_LINES - pConfig->Height);
+  }
+  return HAL_OK;
+}
+
+/**
+  * @brief  Visible blocks of a line
+  * @param  pConfig: display description
+  * @param  Line: line number
+  * @param  pFirst: first visible block
+  * @param  pLast: last visible block
+  * @retval 0 when no pixel of the line is visible
+  */
+static uint32_t VBuf_LineBlocks(const GFXMMU_VBuf_ConfigTypeDef *pConfig, uint32_t Line,
+                                uint32_t *pFirst, uint32_t *pLast)
+{
+  uint32_t first = 0U;
+  uint32_t last  = pConfig->Width - 1U;
+  uint64_t w     = pConfig->Width;
+  uint64_t h     = pConfig->Height;
+  int64_t  dy;
+  uint32_t span;
+
+  if(pConfig->Shape == GFXMMU_VBUF_SHAPE_CIRCLE)
+  {
+    /* Half pixel units: the line center is at 2*Line+1, the ellipse center
+       at Height. Chord of the line: Width * sqrt(1 - (dy/Height)^2) */
+    dy   = (int64_t)((2U * Line) + 1U) - (int64_t)h;
+    span = VBuf_Sqrt((w * w * ((h * h) - (uint64_t)(dy * dy))) / (h * h));
+    if(span == 0U)
+    {
+      return 0U;
+    }
+    first = (pConfig->Width - span) / 2U;
+    last  = ((pConfig->Width + span + 1U) / 2U) - 1U;
+  }
+  else if(pConfig->Shape == GFXMMU_VBUF_SHAPE_CUSTOM)
+  {
+    if(pConfig->GetLineSpan(Line, &first, &last) == 0U)
+    {
+      return 0U;
+    }
+    if((first > last) || (last >= pConfig->Width))
+    {
+      return 0U;
+    }
+  }
+
+  *pFirst = (first * pConfig->BytesPerPixel) / VBUF_BLOCK_SIZE;
+  *pLast  = (((last + 1U) * pConfig->BytesPerPixel) - 1U) / VBUF_BLOCK_SIZE;
+  return 1U;
+}
+
+/**
+  * @brief  Integer square root
+  * @param  Value: operand
+  * @retval floor(sqrt(Value))
+  */
+static uint32_t VBuf_Sqrt(uint64_t Value)
+{
+  uint64_t root = 0U;
+  uint64_t bit  = (uint64_t)1U << 62U;
+
+  while(bit > Value)
+  {
+    bit >>= 2U;
+  }
+  while(bit != 0U)
+  {
+    if(Value >= (root + bit))
+    {
+      Value -= root + bit;
+      root   = (root >> 1U) + bit;
+    }
+    else
+    {
+      root >>= 1U;
+    }
+    bit >>= 2U;
+  }
+  return (uint32_t)root;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
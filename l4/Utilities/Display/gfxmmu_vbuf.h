@@ -0,0 +1,93 @@
+/**
+  ******************************************************************************
+  * @file    gfxmmu_vbuf.h
+  * @author  MCD Application Team
+  * @brief   Header for gfxmmu_vbuf module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _GFXMMU_VBUF_H__
+#define _GFXMMU_VBUF_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#if !defined(HAL_GFXMMU_MODULE_ENABLED)
+#error "gfxmmu_vbuf requires the GFXMMU HAL driver"
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+  GFXMMU_VBUF_SHAPE_RECT   = 0U,  /* All the pixels are visible                         */
+  GFXMMU_VBUF_SHAPE_CIRCLE = 1U,  /* Pixels inside the ellipse inscribed in the display */
+  GFXMMU_VBUF_SHAPE_CUSTOM = 2U   /* Visible span of each line given by GetLineSpan     */
+} GFXMMU_VBuf_ShapeTypeDef;
+
+typedef struct
+{
+  uint32_t Width;                 /* Display width, in pixels                                     */
+  uint32_t Height;                /* Display height, in lines, 1024 at most                       */
+  uint32_t BytesPerPixel;         /* 1 to 4                                                       */
+  uint32_t BlocksPerLine;         /* GFXMMU_256BLOCKS or GFXMMU_192BLOCKS (virtual line pitch)    */
+  GFXMMU_VBuf_ShapeTypeDef Shape;
+  /* GFXMMU_VBUF_SHAPE_CUSTOM: first and last visible pixels of a line,
+     returns 0 when no pixel of the line is visible */
+  uint32_t (*GetLineSpan)(uint32_t Line, uint32_t *pFirst, uint32_t *pLast);
+  uint32_t DefaultValue;          /* Value read from the invisible pixels                         */
+} GFXMMU_VBuf_ConfigTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+#define GFXMMU_VBUF_MAX_BUFFERS   4U
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Virtual address of frame buffer 0 to 3, to be given to the LTDC and the DMA2D */
+#define GFXMMU_VBUF_ADDRESS(__BUFFER__) \
+  (GFXMMU_VIRTUAL_BUFFER0_BASE + ((__BUFFER__) * (GFXMMU_VIRTUAL_BUFFER1_BASE - GFXMMU_VIRTUAL_BUFFER0_BASE)))
+
+/* Exported functions ------------------------------------------------------- */
+uint32_t          GFXMMU_VBuf_GetPhysicalSize(const GFXMMU_VBuf_ConfigTypeDef *pConfig);
+uint32_t          GFXMMU_VBuf_GetPitch(const GFXMMU_VBuf_ConfigTypeDef *pConfig);
+HAL_StatusTypeDef GFXMMU_VBuf_Init(GFXMMU_HandleTypeDef *hgfxmmu, const GFXMMU_VBuf_ConfigTypeDef *pConfig,
+                                   const uint32_t *pPhysAddress, uint32_t BufferNbr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _GFXMMU_VBUF_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
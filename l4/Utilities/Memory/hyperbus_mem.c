@@ -0,0 +1,550 @@
+/**
+  ******************************************************************************
+  * @file    hyperbus_mem.c
+  * @author  MCD Application Team
+  * @brief   HyperRAM and HyperFlash driver on OCTOSPI: linear memory mapped
+  *          region and HyperFlash erase and program commands
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- initialize the OCTOSPI (GPIO, OCTOSPIM ports, clock) with
+   HAL_OSPI_Init(), MemoryType HAL_OSPI_MEMTYPE_HYPERBUS and DeviceSize
+   POSITION_VAL() of the memory size, then call HyperBus_Init() with the
+   memory description. For the ISS66WVH8M8 of the STM32L4R9I-EVAL:
+      - Type HYPERBUS_RAM, Size ISS66WVH8M8_RAM_SIZE
+      - AccessTime ISS66WVH8M8_LATENCY_166M, RWRecoveryTime 3,
+        LatencyMode HAL_OSPI_FIXED_LATENCY
+   A HyperFlash (S26KS family) takes Type HYPERBUS_FLASH and its SectorSize.
+
+2- HyperBus_EnableMemoryMappedMode() maps the memory at
+   HyperBus_GetBaseAddress() (OCTOSPI1_BASE or OCTOSPI2_BASE), so
+   HYPERBUS_ADDRESS() can be used as a plain pointer. A HyperRAM is then
+   read and written by the CPU, the DMA2D, the LTDC or the GFXMMU; see
+   gfxmmu_vbuf to place the display frame buffers there.
+   The chip select is kept low for the prefetch to go on: the timeout
+   counter is disabled.
+
+3- HyperBus_ReadRegister() and HyperBus_WriteRegister() access the register
+   space (CR0 of a HyperRAM, for instance to change the latency or the drive
+   strength). They leave the memory mapped mode for the command and restore
+   it. The OCTOSPI must not be accessed by the bus masters meanwhile.
+
+4- HyperBus_Flash_EraseSector() and HyperBus_Flash_Write() send the
+   HyperFlash command sets (unlock, sector erase, write to buffer) and poll
+   the status register until the device is ready. The memory mapped mode is
+   left for the whole operation, so the code calling them must not execute
+   from the HyperFlash.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "hyperbus_mem.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* HyperFlash command addresses and data, the addresses being word addresses */
+#define HBUS_FLASH_UNLOCK1_ADDR     0x555U
+#define HBUS_FLASH_UNLOCK2_ADDR     0x2AAU
+#define HBUS_FLASH_UNLOCK1_DATA     0x00AAU
+#define HBUS_FLASH_UNLOCK2_DATA     0x0055U
+#define HBUS_FLASH_ERASE_SETUP      0x0080U
+#define HBUS_FLASH_SECTOR_ERASE     0x0030U
+#define HBUS_FLASH_WRITE_BUFFER     0x0025U
+#define HBUS_FLASH_PROGRAM_BUFFER   0x0029U
+#define HBUS_FLASH_STATUS_READ      0x0070U
+#define HBUS_FLASH_STATUS_CLEAR     0x0071U
+#define HBUS_FLASH_RESET            0x00F0U
+
+/* Private macro -------------------------------------------------------------*/
+/* OCTOSPI addresses are byte addresses */
+#define HBUS_WORD_ADDRESS(__W__)    ((__W__) << 1U)
+
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static HAL_StatusTypeDef HBUS_Configure(HyperBus_HandleTypeDef *hhbus, uint32_t WriteZeroLatency);
+static HAL_StatusTypeDef HBUS_Suspend(HyperBus_HandleTypeDef *hhbus, uint32_t *pMapped);
+static HAL_StatusTypeDef HBUS_Restore(HyperBus_HandleTypeDef *hhbus, uint32_t Mapped, HAL_StatusTypeDef Status);
+static HAL_StatusTypeDef HBUS_Transfer(HyperBus_HandleTypeDef *hhbus, uint32_t AddressSpace, uint32_t Address,
+                                       uint8_t *pData, uint32_t Size, uint32_t Write);
+static HAL_StatusTypeDef HBUS_FlashCommand(HyperBus_HandleTypeDef *hhbus, uint32_t Address, uint16_t Data);
+static HAL_StatusTypeDef HBUS_FlashUnlock(HyperBus_HandleTypeDef *hhbus);
+static HAL_StatusTypeDef HBUS_FlashWaitReady(HyperBus_HandleTypeDef *hhbus, uint32_t ErrorMask, uint32_t Timeout);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Initialize the HyperBus memory on an initialized OCTOSPI
+  * @param  hhbus: HyperBus memory handle
+  * @param  hospi: OCTOSPI handle, HAL_OSPI_MEMTYPE_HYPERBUS
+  * @param  pInit: memory description
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HyperBus_Init(HyperBus_HandleTypeDef *hhbus, OSPI_HandleTypeDef *hospi, const HyperBus_InitTypeDef *pInit)
+{
+  if((hhbus == NULL) || (hospi == NULL) || (pInit == NULL) || (pInit->Size == 0U))
+  {
+    return HAL_ERROR;
+  }
+  if((pInit->Type == HYPERBUS_FLASH) && (pInit->SectorSize == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  hhbus->hospi        = hospi;
+  hhbus->Init         = *pInit;
+  hhbus->MemoryMapped = 0U;
+
+  /* A HyperRAM writes with the initial latency, a HyperFlash without:
+     its commands and write buffer loads are zero latency writes */
+  return HBUS_Configure(hhbus, (pInit->Type == HYPERBUS_RAM) ? HAL_OSPI_LATENCY_ON_WRITE : HAL_OSPI_NO_LATENCY_ON_WRITE);
+}
+
+/**
+  * @brief  Map the whole memory space of the memory
+  * @param  hhbus: HyperBus memory handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HyperBus_EnableMemoryMappedMode(HyperBus_HandleTypeDef *hhbus)
+{
+  OSPI_HyperbusCmdTypeDef  sCommand;
+  OSPI_MemoryMappedTypeDef sMemMappedCfg;
+
+  if(hhbus->MemoryMapped != 0U)
+  {
+    return HAL_OK;
+  }
+
+  sCommand.AddressSpace = HAL_OSPI_MEMORY_ADDRESS_SPACE;
+  sCommand.AddressSize  = HAL_OSPI_ADDRESS_32_BITS;
+  sCommand.Address      = 0U;
+  sCommand.DQSMode      = HAL_OSPI_DQS_ENABLE;
+  sCommand.NbData       = 1U;
+
+  if(HAL_OSPI_HyperbusCmd(hhbus->hospi, &sCommand, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  sMemMappedCfg.TimeOutActivation = HAL_OSPI_TIMEOUT_COUNTER_DISABLE;
+  sMemMappedCfg.TimeOutPeriod     = 0U;
+
+  if(HAL_OSPI_MemoryMapped(hhbus->hospi, &sMemMappedCfg) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  hhbus->MemoryMapped = 1U;
+  return HAL_OK;
+}
+
+/**
+  * @brief  Leave the memory mapped mode
+  * @param  hhbus: HyperBus memory handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HyperBus_DisableMemoryMappedMode(HyperBus_HandleTypeDef *hhbus)
+{
+  if(hhbus->MemoryMapped == 0U)
+  {
+    return HAL_OK;
+  }
+
+  if(HAL_OSPI_Abort(hhbus->hospi) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  hhbus->MemoryMapped = 0U;
+  return HAL_OK;
+}
+
+/**
+  * @brief  Base address of the memory mapped region of the OCTOSPI
+  * @param  hhbus: HyperBus memory handle
+  * @retval Address
+  */
+uint32_t HyperBus_GetBaseAddress(const HyperBus_HandleTypeDef *hhbus)
+{
+#if defined(OCTOSPI2)
+  if(hhbus->hospi->Instance == OCTOSPI2)
+  {
+    return OCTOSPI2_BASE;
+  }
+#endif
+  return OCTOSPI1_BASE;
+}
+
+/**
+  * @brief  Read a register of the register space
+  * @param  hhbus: HyperBus memory handle
+  * @param  Address: register address (ISS66WVH8M8_CR0_ADDRESS for instance)
+  * @param  pValue: register value
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HyperBus_ReadRegister(HyperBus_HandleTypeDef *hhbus, uint32_t Address, uint16_t *pValue)
+{
+  HAL_StatusTypeDef status;
+  uint32_t mapped;
+
+  if(HBUS_Suspend(hhbus, &mapped) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  status = HBUS_Transfer(hhbus, HAL_OSPI_REGISTER_ADDRESS_SPACE, Address, (uint8_t *)pValue, 2U, 0U);
+
+  return HBUS_Restore(hhbus, mapped, status);
+}
+
+/**
+  * @brief  Write a register of the register space
+  * @note   Register writes have no latency: the HyperRAM write latency is
+  *         disabled for the command
+  * @param  hhbus: HyperBus memory handle
+  * @param  Address: register address
+  * @param  Value: register value
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HyperBus_WriteRegister(HyperBus_HandleTypeDef *hhbus, uint32_t Address, uint16_t Value)
+{
+  HAL_StatusTypeDef status;
+  uint32_t mapped;
+
+  if(HBUS_Suspend(hhbus, &mapped) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  status = HBUS_Configure(hhbus, HAL_OSPI_NO_LATENCY_ON_WRITE);
+  if(status == HAL_OK)
+  {
+    status = HBUS_Transfer(hhbus, HAL_OSPI_REGISTER_ADDRESS_SPACE, Address, (uint8_t *)&Value, 2U, 1U);
+  }
+  if((hhbus->Init.Type == HYPERBUS_RAM) &&
+     (HBUS_Configure(hhbus, HAL_OSPI_LATENCY_ON_WRITE) != HAL_OK))
+  {
+    status = HAL_ERROR;
+  }
+
+  return HBUS_Restore(hhbus, mapped, status);
+}
+
+/**
+  * @brief  Erase one sector of a HyperFlash
+  * @param  hhbus: HyperBus memory handle
+  * @param  Address: any address in the sector
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HyperBus_Flash_EraseSector(HyperBus_HandleTypeDef *hhbus, uint32_t Address)
+{
+  HAL_StatusTypeDef status;
+  uint32_t mapped;
+  uint32_t sector;
+
+  if((hhbus->Init.Type != HYPERBUS_FLASH) || (Address >= hhbus->Init.Size))
+  {
+    return HAL_ERROR;
+  }
+  sector = Address - (Address % hhbus->Init.SectorSize);
+
+  if(HBUS_Suspend(hhbus, &mapped) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  status = HBUS_FlashUnlock(hhbus);
+  if(status == HAL_OK)
+  {
+    status = HBUS_FlashCommand(hhbus, HBUS_WORD_ADDRESS(HBUS_FLASH_UNLOCK1_ADDR), HBUS_FLASH_ERASE_SETUP);
+  }
+  if(status == HAL_OK)
+  {
+    status = HBUS_FlashUnlock(hhbus);
+  }
+  if(status == HAL_OK)
+  {
+    status = HBUS_FlashCommand(hhbus, sector, HBUS_FLASH_SECTOR_ERASE);
+  }
+  if(status == HAL_OK)
+  {
+    status = HBUS_FlashWaitReady(hhbus, HYPERBUS_FLASH_SR_ESB, HYPERBUS_FLASH_ERASE_TIMEOUT);
+  }
+
+  return HBUS_Restore(hhbus, mapped, status);
+}
+
+/**
+  * @brief  Program a HyperFlash through its write buffer
+  * @note   The area must be erased. Address and Size must be even.
+  * @param  hhbus: HyperBus memory handle
+  * @param  Address: first address to program
+  * @param  pData: data, not located in the HyperFlash
+  * @param  Size: size in bytes
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HyperBus_Flash_Write(HyperBus_HandleTypeDef *hhbus, uint32_t Address, const uint8_t *pData, uint32_t Size)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t mapped;
+  uint32_t sector;
+  uint32_t chunk;
+  uint32_t i;
+
+  if((hhbus->Init.Type != HYPERBUS_FLASH) || (((Address | Size) & 1U) != 0U) ||
+     (Size > hhbus->Init.Size) || (Address > (hhbus->Init.Size - Size)))
+  {
+    return HAL_ERROR;
+  }
+
+  if(HBUS_Suspend(hhbus, &mapped) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  while((Size != 0U) && (status == HAL_OK))
+  {
+    /* A write buffer load does not cross a write buffer boundary */
+    chunk = HYPERBUS_FLASH_BUFFER_SIZE - (Address % HYPERBUS_FLASH_BUFFER_SIZE);
+    if(chunk > Size)
+    {
+      chunk = Size;
+    }
+    sector = Address - (Address % hhbus->Init.SectorSize);
+
+    status = HBUS_FlashUnlock(hhbus);
+    if(status == HAL_OK)
+    {
+      status = HBUS_FlashCommand(hhbus, sector, HBUS_FLASH_WRITE_BUFFER);
+    }
+    if(status == HAL_OK)
+    {
+      status = HBUS_FlashCommand(hhbus, sector, (uint16_t)((chunk / 2U) - 1U));
+    }
+    /* HyperFlash write transactions carry one word each */
+    for(i = 0U; (i < chunk) && (status == HAL_OK); i += 2U)
+    {
+      status = HBUS_FlashCommand(hhbus, Address + i, (uint16_t)(pData[i] | ((uint16_t)pData[i + 1U] << 8U)));
+    }
+    if(status == HAL_OK)
+    {
+      status = HBUS_FlashCommand(hhbus, sector, HBUS_FLASH_PROGRAM_BUFFER);
+    }
+    if(status == HAL_OK)
+    {
+      status = HBUS_FlashWaitReady(hhbus, HYPERBUS_FLASH_SR_PSB, HYPERBUS_FLASH_PROGRAM_TIMEOUT);
+    }
+
+    Address += chunk;
+    pData   += chunk;
+    Size    -= chunk;
+  }
+
+  return HBUS_Restore(hhbus, mapped, status);
+}
+
+/**
+  * @brief  Read the HyperFlash status register
+  * @param  hhbus: HyperBus memory handle
+  * @param  pStatus: HYPERBUS_FLASH_SR_xxx bits
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HyperBus_Flash_ReadStatus(HyperBus_HandleTypeDef *hhbus, uint16_t *pStatus)
+{
+  HAL_StatusTypeDef status;
+  uint32_t mapped;
+
+  if(hhbus->Init.Type != HYPERBUS_FLASH)
+  {
+    return HAL_ERROR;
+  }
+
+  if(HBUS_Suspend(hhbus, &mapped) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  status = HBUS_FlashCommand(hhbus, HBUS_WORD_ADDRESS(HBUS_FLASH_UNLOCK1_ADDR), HBUS_FLASH_STATUS_READ);
+  if(status == HAL_OK)
+  {
+    status = HBUS_Transfer(hhbus, HAL_OSPI_MEMORY_ADDRESS_SPACE, 0U, (uint8_t *)pStatus, 2U, 0U);
+  }
+
+  return HBUS_Restore(hhbus, mapped, status);
+}
+
+/**
+  * @brief  Set the HyperBus timings
+  * @param  hhbus: HyperBus memory handle
+  * @param  WriteZeroLatency: HAL_OSPI_LATENCY_ON_WRITE or HAL_OSPI_NO_LATENCY_ON_WRITE
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef HBUS_Configure(HyperBus_HandleTypeDef *hhbus, uint32_t WriteZeroLatency)
+{
+  OSPI_HyperbusCfgTypeDef sHyperbusCfg;
+
+  sHyperbusCfg.RWRecoveryTime   = hhbus->Init.RWRecoveryTime;
+  sHyperbusCfg.AccessTime       = hhbus->Init.AccessTime;
+  sHyperbusCfg.WriteZeroLatency = WriteZeroLatency;
+  sHyperbusCfg.LatencyMode      = hhbus->Init.LatencyMode;
+
+  return HAL_OSPI_HyperbusCfg(hhbus->hospi, &sHyperbusCfg, HAL_OSPI_TIMEOUT_DEFAULT_VALUE);
+}
+
+/**
+  * @brief  Leave the memory mapped mode for an indirect command
+  * @param  hhbus: HyperBus memory handle
+  * @param  pMapped: set to 1 when the memory was mapped
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef HBUS_Suspend(HyperBus_HandleTypeDef *hhbus, uint32_t *pMapped)
+{
+  *pMapped = hhbus->MemoryMapped;
+  return HyperBus_DisableMemoryMappedMode(hhbus);
+}
+
+/**
+  * @brief  Restore the memory mapped mode after an indirect command
+  * @param  hhbus: HyperBus memory handle
+  * @param  Mapped: 1 when the memory was mapped
+  * @param  Status: status of the command
+  * @retval Status of the command, HAL_ERROR when the memory could not be mapped again
+  */
+static HAL_StatusTypeDef HBUS_Restore(HyperBus_HandleTypeDef *hhbus, uint32_t Mapped, HAL_StatusTypeDef Status)
+{
+  if((Mapped != 0U) && (HyperBus_EnableMemoryMappedMode(hhbus) != HAL_OK))
+  {
+    return HAL_ERROR;
+  }
+  return Status;
+}
+
+/**
+  * @brief  Indirect read or write
+  * @param  hhbus: HyperBus memory handle
+  * @param  AddressSpace: HAL_OSPI_MEMORY_ADDRESS_SPACE or HAL_OSPI_REGISTER_ADDRESS_SPACE
+  * @param  Address: byte address
+  * @param  pData: data
+  * @param  Size: size in bytes
+  * @param  Write: 1 to write, 0 to read
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef HBUS_Transfer(HyperBus_HandleTypeDef *hhbus, uint32_t AddressSpace, uint32_t Address,
+                                       uint8_t *pData, uint32_t Size, uint32_t Write)
+{
+  OSPI_HyperbusCmdTypeDef sCommand;
+
+  sCommand.AddressSpace = AddressSpace;
+  sCommand.AddressSize  = HAL_OSPI_ADDRESS_32_BITS;
+  sCommand.Address      = Address;
+  sCommand.DQSMode      = HAL_OSPI_DQS_ENABLE;
+  sCommand.NbData       = Size;
+
+  if(HAL_OSPI_HyperbusCmd(hhbus->hospi, &sCommand, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  if(Write != 0U)
+  {
+    return HAL_OSPI_Transmit(hhbus->hospi, pData, HAL_OSPI_TIMEOUT_DEFAULT_VALUE);
+  }
+  return HAL_OSPI_Receive(hhbus->hospi, pData, HAL_OSPI_TIMEOUT_DEFAULT_VALUE);
+}
+
+/**
+  * @brief  One word write cycle of a HyperFlash command
+  * @param  hhbus: HyperBus memory handle
+  * @param  Address: byte address
+  * @param  Data: command word
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef HBUS_FlashCommand(HyperBus_HandleTypeDef *hhbus, uint32_t Address, uint16_t Data)
+{
+  return HBUS_Transfer(hhbus, HAL_OSPI_MEMORY_ADDRESS_SPACE, Address, (uint8_t *)&Data, 2U, 1U);
+}
+
+/**
+  * @brief  HyperFlash unlock cycles
+  * @param  hhbus: HyperBus memory handle
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef HBUS_FlashUnlock(HyperBus_HandleTypeDef *hhbus)
+{
+  if(HBUS_FlashCommand(hhbus, HBUS_WORD_ADDRESS(HBUS_FLASH_UNLOCK1_ADDR), HBUS_FLASH_UNLOCK1_DATA) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+  return HBUS_FlashCommand(hhbus, HBUS_WORD_ADDRESS(HBUS_FLASH_UNLOCK2_ADDR), HBUS_FLASH_UNLOCK2_DATA);
+}
+
+/**
+  * @brief  Poll the HyperFlash status register until the device is ready
+  * @param  hhbus: HyperBus memory handle
+  * @param  ErrorMask: error bit of the operation
+  * @param  Timeout: timeout in ms
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef HBUS_FlashWaitReady(HyperBus_HandleTypeDef *hhbus, uint32_t ErrorMask, uint32_t Timeout)
+{
+  uint32_t tickstart = HAL_GetTick();
+  uint16_t sr = 0U;
+
+  do
+  {
+    if(HBUS_FlashCommand(hhbus, HBUS_WORD_ADDRESS(HBUS_FLASH_UNLOCK1_ADDR), HBUS_FLASH_STATUS_READ) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+    if(HBUS_Transfer(hhbus, HAL_OSPI_MEMORY_ADDRESS_SPACE, 0U, (uint8_t *)&sr, 2U, 0U) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+    if(((sr & HYPERBUS_FLASH_SR_DRB) == 0U) && ((HAL_GetTick() - tickstart) > Timeout))
+    {
+      /* Back to read mode */
+      (void)HBUS_FlashCommand(hhbus, 0U, HBUS_FLASH_RESET);
+      return HAL_TIMEOUT;
+    }
+  } while((sr & HYPERBUS_FLASH_SR_DRB) == 0U);
+
+  if((sr & ErrorMask) != 0U)
+  {
+    /* Clear the error, back to read mode */
+    (void)HBUS_FlashCommand(hhbus, HBUS_WORD_ADDRESS(HBUS_FLASH_UNLOCK1_ADDR), HBUS_FLASH_STATUS_CLEAR);
+    return HAL_ERROR;
+  }
+  return HAL_OK;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
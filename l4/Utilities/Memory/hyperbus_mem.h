@@ -0,0 +1,116 @@
+/**
+  ******************************************************************************
+  * @file    hyperbus_mem.h
+  * @author  MCD Application Team
+  * @brief   Header for hyperbus_mem module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _HYPERBUS_MEM_H__
+#define _HYPERBUS_MEM_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#if !defined(HAL_OSPI_MODULE_ENABLED)
+#error "hyperbus_mem requires the OCTOSPI HAL driver"
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+  HYPERBUS_RAM   = 0U,  /* HyperRAM: read and written memory mapped             */
+  HYPERBUS_FLASH = 1U   /* HyperFlash: read memory mapped, programmed by command */
+} HyperBus_MemTypeDef;
+
+typedef struct
+{
+  HyperBus_MemTypeDef Type;
+  uint32_t Size;             /* Memory size, in bytes                                      */
+  uint32_t AccessTime;       /* Initial latency, in clock cycles, as set in the memory     */
+  uint32_t RWRecoveryTime;   /* Read write recovery time, in clock cycles                  */
+  uint32_t LatencyMode;      /* HAL_OSPI_FIXED_LATENCY or HAL_OSPI_VARIABLE_LATENCY        */
+  uint32_t SectorSize;       /* HyperFlash sector size, in bytes. Unused for a HyperRAM    */
+} HyperBus_InitTypeDef;
+
+typedef struct
+{
+  OSPI_HandleTypeDef   *hospi;       /* OCTOSPI initialized (HAL_OSPI_MEMTYPE_HYPERBUS) by the user */
+  HyperBus_InitTypeDef  Init;
+  uint32_t              MemoryMapped; /* 1 while memory mapped                                      */
+} HyperBus_HandleTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/* HyperFlash write buffer size, in bytes. Override in main.h. */
+#if !defined(HYPERBUS_FLASH_BUFFER_SIZE)
+#define HYPERBUS_FLASH_BUFFER_SIZE   512U
+#endif
+
+/* Longest HyperFlash sector erase and buffer program times, in ms. Override in main.h. */
+#if !defined(HYPERBUS_FLASH_ERASE_TIMEOUT)
+#define HYPERBUS_FLASH_ERASE_TIMEOUT    2000U
+#endif
+#if !defined(HYPERBUS_FLASH_PROGRAM_TIMEOUT)
+#define HYPERBUS_FLASH_PROGRAM_TIMEOUT  10U
+#endif
+
+/* HyperFlash status register */
+#define HYPERBUS_FLASH_SR_DRB   0x0080U  /* Device ready      */
+#define HYPERBUS_FLASH_SR_ESB   0x0020U  /* Erase error       */
+#define HYPERBUS_FLASH_SR_PSB   0x0010U  /* Program error     */
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Address in the memory mapped region of an address of the memory */
+#define HYPERBUS_ADDRESS(__HANDLE__, __ADDR__)  ((uint8_t *)(HyperBus_GetBaseAddress(__HANDLE__) + (__ADDR__)))
+
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef HyperBus_Init(HyperBus_HandleTypeDef *hhbus, OSPI_HandleTypeDef *hospi, const HyperBus_InitTypeDef *pInit);
+HAL_StatusTypeDef HyperBus_EnableMemoryMappedMode(HyperBus_HandleTypeDef *hhbus);
+HAL_StatusTypeDef HyperBus_DisableMemoryMappedMode(HyperBus_HandleTypeDef *hhbus);
+uint32_t          HyperBus_GetBaseAddress(const HyperBus_HandleTypeDef *hhbus);
+HAL_StatusTypeDef HyperBus_ReadRegister(HyperBus_HandleTypeDef *hhbus, uint32_t Address, uint16_t *pValue);
+HAL_StatusTypeDef HyperBus_WriteRegister(HyperBus_HandleTypeDef *hhbus, uint32_t Address, uint16_t Value);
+HAL_StatusTypeDef HyperBus_Flash_EraseSector(HyperBus_HandleTypeDef *hhbus, uint32_t Address);
+HAL_StatusTypeDef HyperBus_Flash_Write(HyperBus_HandleTypeDef *hhbus, uint32_t Address, const uint8_t *pData, uint32_t Size);
+HAL_StatusTypeDef HyperBus_Flash_ReadStatus(HyperBus_HandleTypeDef *hhbus, uint16_t *pStatus);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _HYPERBUS_MEM_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
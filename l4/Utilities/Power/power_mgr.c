@@ -0,0 +1,436 @@
+/**
+  ******************************************************************************
+  * @file    power_mgr.c
+  * @author  MCD Application Team
+  * @brief   Low power mode selection from driver locks, with fast clock
+  *          recovery after the Stop modes.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- call PWR_Mgr_Init() once the clocks are configured. The wake up sources
+   are armed once and stay armed: the LPTIM1 of lptim_timebase, and the
+   UARTs given to PWR_Mgr_ArmUart(). A UART wakes the device from Stop only
+   when its kernel clock is the LSE or the HSI16. Only the LPUART1 does so
+   from Stop 2: hold a PWR_MGR_MODE_STOP1 lock while another UART must wake
+   the device up.
+
+2- each driver or activity that cannot run through a low power mode holds a
+   lock while it needs to, ex. from the start of a DMA transfer or of a UART
+   transmission up to its completion callback :
+      - PWR_Mgr_Lock(Id, PWR_MGR_MODE_SLEEP) while the system clock must run
+      - PWR_Mgr_Lock(Id, PWR_MGR_MODE_RUN) while the CPU must run
+      - PWR_Mgr_Unlock(Id) when done
+   Locking again with the same Id changes its mode. PWR_Mgr_GetLocks() tells
+   which locks keep a mode away.
+
+3- PWR_Mgr_Enter(Us), called with the interrupts masked, enters the deepest
+   mode the locks allow, lighter when the idle time Us is below the
+   PWR_MGR_STOPx_MIN_US of the mode, and returns at the first interrupt.
+   In Low-power run, Sleep is Low-power sleep and the flash is powered down
+   when Us is at least PWR_MGR_SLEEP_PD_MIN_US, its wake up adding to the
+   interrupt latency: ram_idle waits with the code in RAM.
+   With lptim_timebase, define PWR_MGR_USE_TIMEBASE in main.h: this module
+   then implements TIMEBASE_EnterLowPowerCallback(), so HAL_Delay() and the
+   RTOS tickless idle (TIMEBASE_Sleep()) go through PWR_Mgr_Enter().
+
+4- clock recovery: before Stop, the wake up clock is set to the HSI16,
+   or to the MSI when the system clock comes from the MSI, so the code runs
+   at once from the oscillator the system clock needs. After Stop, the
+   oscillators and the PLLs that were on are started together and the system
+   clock is switched back directly in the RCC registers: the prescalers, the
+   Flash latency and the voltage range are kept through Stop, SystemCoreClock
+   and the HAL time base are unchanged.
+
+5- PWR_Mgr_SuspendCallback() and PWR_Mgr_ResumeCallback() are called around
+   each low power entry, ex. to switch off a LED or an external regulator.
+   With power_prof, define PWR_MGR_USE_PROFILER in main.h: each entry is
+   then accounted, the locks that kept the deepest mode away included.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "power_mgr.h"
+#if defined(PWR_MGR_USE_TIMEBASE)
+#include "lptim_timebase.h"
+#endif
+#if defined(PWR_MGR_USE_PROFILER)
+#include "power_prof.h"
+#endif
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#if defined(RCC_PLLSAI2_SUPPORT)
+#define PWR_MGR_PLL_ON   (RCC_CR_PLLON | RCC_CR_PLLSAI1ON | RCC_CR_PLLSAI2ON)
+#elif defined(RCC_PLLSAI1_SUPPORT)
+#define PWR_MGR_PLL_ON   (RCC_CR_PLLON | RCC_CR_PLLSAI1ON)
+#else
+#define PWR_MGR_PLL_ON   RCC_CR_PLLON
+#endif
+
+/* Private macro -------------------------------------------------------------*/
+/* Ready flag of each oscillator or PLL enable bit */
+#define PWR_MGR_RDY(__ON__)  ((((__ON__) & RCC_CR_MSION)    != 0U ? RCC_CR_MSIRDY    : 0U) | \
+                              (((__ON__) & RCC_CR_HSION)    != 0U ? RCC_CR_HSIRDY    : 0U) | \
+                              (((__ON__) & RCC_CR_HSEON)    != 0U ? RCC_CR_HSERDY    : 0U) | \
+                              (((__ON__) & PWR_MGR_PLL_ON)  << 1U))
+
+/* Private variables ---------------------------------------------------------*/
+static uint32_t              MgrHeld;                              /* One bit per lock held       */
+static uint8_t               MgrMode[PWR_MGR_MAX_LOCKS];           /* Deepest mode of each lock   */
+static uint32_t              MgrCount[PWR_MGR_MODE_STOP2 + 1U];    /* Locks held per mode         */
+static PWR_Mgr_StatsTypeDef  MgrStats;
+
+static const uint32_t        MgrMinUs[PWR_MGR_MODE_STOP2 + 1U] =
+{
+  0U, 0U, PWR_MGR_STOP0_MIN_US, PWR_MGR_STOP1_MIN_US, PWR_MGR_STOP2_MIN_US
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static void PWR_Mgr_EnterStop(PWR_Mgr_ModeTypeDef Mode);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Release all the locks and clear the statistics
+  * @retval None
+  */
+void PWR_Mgr_Init(void)
+{
+  uint32_t primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  MgrHeld = 0U;
+  memset(MgrCount, 0, sizeof(MgrCount));
+  memset(&MgrStats, 0, sizeof(MgrStats));
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Take or change a lock
+  * @param  Id: lock identifier, 0 to PWR_MGR_MAX_LOCKS-1
+  * @param  Deepest: deepest mode allowed while the lock is held
+  * @retval HAL status
+  */
+HAL_StatusTypeDef PWR_Mgr_Lock(uint32_t Id, PWR_Mgr_ModeTypeDef Deepest)
+{
+  uint32_t primask;
+
+  if ((Id >= PWR_MGR_MAX_LOCKS) || (Deepest > PWR_MGR_MODE_STOP2))
+  {
+    return HAL_ERROR;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if ((MgrHeld & (1UL << Id)) != 0U)
+  {
+    MgrCount[MgrMode[Id]]--;
+  }
+  MgrMode[Id] = (uint8_t)Deepest;
+  MgrCount[Deepest]++;
+  MgrHeld |= (1UL << Id);
+  __set_PRIMASK(primask);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Release a lock, nothing done when it is not held
+  * @param  Id: lock identifier
+  * @retval None
+  */
+void PWR_Mgr_Unlock(uint32_t Id)
+{
+  uint32_t primask;
+
+  if (Id >= PWR_MGR_MAX_LOCKS)
+  {
+    return;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if ((MgrHeld & (1UL << Id)) != 0U)
+  {
+    MgrCount[MgrMode[Id]]--;
+    MgrHeld &= ~(1UL << Id);
+  }
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Deepest mode the locks held allow
+  * @retval Mode
+  */
+PWR_Mgr_ModeTypeDef PWR_Mgr_GetDeepest(void)
+{
+  uint32_t mode = PWR_MGR_MODE_RUN;
+
+  while((mode < PWR_MGR_MODE_STOP2) && (MgrCount[mode] == 0U))
+  {
+    mode++;
+  }
+  return (PWR_Mgr_ModeTypeDef)mode;
+}
+
+/**
+  * @brief  Locks keeping a mode away
+  * @param  Mode: low power mode
+  * @retval One bit per lock identifier
+  */
+uint32_t PWR_Mgr_GetLocks(PWR_Mgr_ModeTypeDef Mode)
+{
+  uint32_t locks = 0U;
+  uint32_t held  = MgrHeld;
+  uint32_t id;
+
+  for(id = 0U; id < PWR_MGR_MAX_LOCKS; id++)
+  {
+    if (((held & (1UL << id)) != 0U) && (MgrMode[id] < (uint8_t)Mode))
+    {
+      locks |= (1UL << id);
+    }
+  }
+  return locks;
+}
+
+/**
+  * @brief  Enter the deepest low power mode allowed until the next interrupt
+  * @note   Called with the interrupts masked: the interrupt waking the
+  *         device is served once the caller unmasks them, after the clocks
+  *         are restored.
+  * @param  Us: time until the next programmed wake up, in microseconds
+  * @retval Mode entered, PWR_MGR_MODE_RUN when a lock keeps the CPU running
+  */
+PWR_Mgr_ModeTypeDef PWR_Mgr_Enter(uint64_t Us)
+{
+  PWR_Mgr_ModeTypeDef deepest = PWR_Mgr_GetDeepest();
+  uint32_t            mode    = deepest;
+
+  /* Lighter mode when the idle time does not pay back the wake up */
+  while((mode > PWR_MGR_MODE_SLEEP) && (Us < MgrMinUs[mode]))
+  {
+    mode--;
+  }
+
+  MgrStats.Entries[mode]++;
+  if (deepest != PWR_MGR_MODE_STOP2)
+  {
+    MgrStats.Locked++;
+  }
+  if (mode != deepest)
+  {
+    MgrStats.Short++;
+  }
+
+  if (mode == PWR_MGR_MODE_RUN)
+  {
+    return PWR_MGR_MODE_RUN;
+  }
+
+  PWR_Mgr_SuspendCallback((PWR_Mgr_ModeTypeDef)mode);
+#if defined(PWR_MGR_USE_PROFILER)
+  /* Blockers are the locks when they, not the idle time, chose the mode */
+  PWR_Prof_EnterMode((PWR_Prof_ModeTypeDef)mode, (mode == deepest) ? PWR_Mgr_GetLocks(PWR_MGR_MODE_STOP2) : 0U);
+#endif
+  if (mode == PWR_MGR_MODE_SLEEP)
+  {
+    /* Flash power down, effective in Low-power sleep only */
+    if (Us >= PWR_MGR_SLEEP_PD_MIN_US)
+    {
+      __HAL_FLASH_SLEEP_POWERDOWN_ENABLE();
+    }
+    HAL_PWR_EnterSLEEPMode(PWR_MAINREGULATOR_ON, PWR_SLEEPENTRY_WFI);
+    __HAL_FLASH_SLEEP_POWERDOWN_DISABLE();
+  }
+  else
+  {
+    PWR_Mgr_EnterStop((PWR_Mgr_ModeTypeDef)mode);
+  }
+#if defined(PWR_MGR_USE_PROFILER)
+  PWR_Prof_ExitMode();
+#endif
+  PWR_Mgr_ResumeCallback((PWR_Mgr_ModeTypeDef)mode);
+
+  return (PWR_Mgr_ModeTypeDef)mode;
+}
+
+/**
+  * @brief  Copy the statistics
+  * @param  pStats: destination
+  * @retval None
+  */
+void PWR_Mgr_GetStats(PWR_Mgr_StatsTypeDef *pStats)
+{
+  uint32_t primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  *pStats = MgrStats;
+  __set_PRIMASK(primask);
+}
+
+#if defined(HAL_UART_MODULE_ENABLED)
+/**
+  * @brief  Keep a UART able to wake the device from Stop on reception
+  * @note   The UART must be initialized, its kernel clock being the LSE or
+  *         the HSI16. The wake up flag interrupt is enabled; the HAL UART
+  *         interrupt handler calls HAL_UARTEx_WakeupCallback().
+  * @param  huart: UART handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef PWR_Mgr_ArmUart(UART_HandleTypeDef *huart)
+{
+  UART_WakeUpTypeDef wakeup;
+
+  wakeup.WakeUpEvent = UART_WAKEUP_ON_READDATA_NONEMPTY;
+  if (HAL_UARTEx_StopModeWakeUpSourceConfig(huart, wakeup) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+  __HAL_UART_ENABLE_IT(huart, UART_IT_WUF);
+
+  return HAL_UARTEx_EnableStopMode(huart);
+}
+#endif /* HAL_UART_MODULE_ENABLED */
+
+#if defined(PWR_MGR_USE_TIMEBASE)
+/**
+  * @brief  Low power entry of the time base waits and of TIMEBASE_Sleep()
+  * @param  Us: time until the programmed wake up, in microseconds
+  * @retval None
+  */
+void TIMEBASE_EnterLowPowerCallback(uint64_t Us)
+{
+  (void)PWR_Mgr_Enter(Us);
+}
+#endif /* PWR_MGR_USE_TIMEBASE */
+
+/**
+  * @brief  About to enter a low power mode
+  * @param  Mode: mode entered
+  * @retval None
+  */
+__weak void PWR_Mgr_SuspendCallback(PWR_Mgr_ModeTypeDef Mode)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Mode);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the PWR_Mgr_SuspendCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Back from a low power mode, clocks restored
+  * @param  Mode: mode left
+  * @retval None
+  */
+__weak void PWR_Mgr_ResumeCallback(PWR_Mgr_ModeTypeDef Mode)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Mode);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the PWR_Mgr_ResumeCallback could be implemented in the user file
+   */
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Enter a Stop mode and restore the clocks at wake up
+  * @param  Mode: PWR_MGR_MODE_STOP0 to PWR_MGR_MODE_STOP2
+  * @retval None
+  */
+static void PWR_Mgr_EnterStop(PWR_Mgr_ModeTypeDef Mode)
+{
+  uint32_t cr   = RCC->CR;
+  uint32_t cfgr = RCC->CFGR;
+  uint32_t sw   = cfgr & RCC_CFGR_SW;
+  uint32_t on;
+
+  /* Wake up on the oscillator the system clock is derived from */
+  if ((sw == RCC_CFGR_SW_MSI) ||
+      ((sw == RCC_CFGR_SW_PLL) && ((RCC->PLLCFGR & RCC_PLLCFGR_PLLSRC) == RCC_PLLCFGR_PLLSRC_MSI)))
+  {
+    __HAL_RCC_WAKEUPSTOP_CLK_CONFIG(RCC_STOP_WAKEUPCLOCK_MSI);
+  }
+  else
+  {
+    __HAL_RCC_WAKEUPSTOP_CLK_CONFIG(RCC_STOP_WAKEUPCLOCK_HSI);
+  }
+
+  if (Mode == PWR_MGR_MODE_STOP0)
+  {
+    HAL_PWREx_EnterSTOP0Mode(PWR_STOPENTRY_WFI);
+  }
+  else if (Mode == PWR_MGR_MODE_STOP1)
+  {
+    HAL_PWREx_EnterSTOP1Mode(PWR_STOPENTRY_WFI);
+  }
+  else
+  {
+    HAL_PWREx_EnterSTOP2Mode(PWR_STOPENTRY_WFI);
+  }
+
+  /* Oscillators first, all together, then the PLLs */
+  on = cr & (RCC_CR_MSION | RCC_CR_HSION | RCC_CR_HSEON);
+  SET_BIT(RCC->CR, on);
+  while((RCC->CR & PWR_MGR_RDY(on)) != PWR_MGR_RDY(on))
+  {
+  }
+  on = cr & PWR_MGR_PLL_ON;
+  SET_BIT(RCC->CR, on);
+  while((RCC->CR & PWR_MGR_RDY(on)) != PWR_MGR_RDY(on))
+  {
+  }
+
+  if (sw != (RCC->CFGR & RCC_CFGR_SW))
+  {
+    MODIFY_REG(RCC->CFGR, RCC_CFGR_SW, sw);
+    while((RCC->CFGR & RCC_CFGR_SWS) != (sw << RCC_CFGR_SWS_Pos))
+    {
+    }
+  }
+
+  /* Wake up oscillator not used before */
+  if ((cr & RCC_CR_HSION) == 0U)
+  {
+    CLEAR_BIT(RCC->CR, RCC_CR_HSION);
+  }
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,867 @@
+/**
+  ******************************************************************************
+  * @file    kv_store.c
+  * @author  MCD Application Team
+  * @brief   Log-structured, wear-levelled key/value store in the internal
+  *          flash, with a RAM index and background compaction
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- reserve AreaNbr erase units of the internal flash (2 at least), outside
+   the application, and call KV_Store_Init() with their location:
+   one or more pages per area, in one bank.
+   The store is recovered from the flash: the area with the highest
+   generation is active and its records are indexed in RAM.
+
+2- KV_Store_Set() appends a record (key, length, CRC, value) to the active
+   area: a few double words are programmed, no erase takes place.
+   KV_Store_Get() reads the last value through the RAM index,
+   KV_Store_Delete() appends an empty record.
+
+3- call KV_Store_Process() from the main loop. Once the active area is
+   filled to KV_STORE_COMPACT_LEVEL, the last value of each key is copied,
+   a few records per call, to the next area, which becomes active when its
+   header is written. The former area is then erased in the background with
+   HAL_FLASHEx_Erase_IT(): enable the FLASH interrupt and call
+   HAL_FLASH_IRQHandler() from FLASH_IRQHandler(). The module implements
+   HAL_FLASH_EndOfOperationCallback() and HAL_FLASH_OperationErrorCallback().
+   The areas are used in turn, so the erases are spread over all of them.
+
+4- a record is valid only if its CRC matches and an area only once its
+   header is written. A power loss while writing leaves the previous value
+   of the key; a power loss while compacting leaves the previous area
+   active. The interrupted area is erased at the next compaction.
+
+5- KV_Store_Set() waits for a background erase to end, and compacts in one
+   go when the active area is full. The CPU stalls on flash accesses to the
+   bank being programmed or erased: on dual bank devices, place the store
+   in the bank not executing the application. The functions must be called
+   from a single context, not from interrupts.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "kv_store.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  uint16_t Key;
+  uint16_t Length;
+  uint32_t Address;      /* Record in the active area          */
+  uint32_t NewAddress;   /* Record copied by the compaction    */
+} KV_EntryTypeDef;
+
+/* Private define ------------------------------------------------------------*/
+/* Programming granularity, in bytes */
+#define KV_PROGRAM_UNIT       8U
+
+/* Area header: generation then magic, the magic being programmed last */
+#define KV_AREA_MAGIC         0x3153564BU
+#define KV_HEADER_SIZE        8U
+
+/* Record: key (16 bits), length (16 bits), CRC-32 of the key, length and
+   value, then the value */
+#define KV_RECORD_HEADER_SIZE 8U
+#define KV_ERASED_WORD        0xFFFFFFFFU
+#define KV_ERASE_DONE         0xFFFFFFFFU
+
+/* Private macro -------------------------------------------------------------*/
+#define KV_ALIGN(__SIZE__)        (((__SIZE__) + KV_PROGRAM_UNIT - 1U) & ~(KV_PROGRAM_UNIT - 1U))
+#define KV_RECORD_SIZE(__LEN__)   KV_ALIGN(KV_RECORD_HEADER_SIZE + (uint32_t)(__LEN__))
+#define KV_AREA_ADDRESS(__AREA__) (KvInit.StartAddress + ((__AREA__) * KvInit.AreaSize))
+#define KV_NEXT_AREA(__AREA__)    ((((__AREA__) + 1U) < KvInit.AreaNbr) ? ((__AREA__) + 1U) : 0U)
+#define KV_WORD(__ADDR__)         (*(__IO uint32_t *)(__ADDR__))
+
+/* Private variables ---------------------------------------------------------*/
+static KV_Store_InitTypeDef KvInit;
+static KV_EntryTypeDef      KvIndex[KV_STORE_MAX_KEYS];
+static uint32_t             KvKeyNbr;
+static uint32_t             KvReady = 0U;
+static uint32_t             KvActive;        /* Active area                          */
+static uint32_t             KvGeneration;    /* Generation of the active area        */
+static uint32_t             KvWrite;         /* First free address of the active area */
+static uint32_t             KvLive;          /* Header and live records size          */
+static uint32_t             KvNextDirty;     /* The next area must be erased          */
+static __IO uint32_t        KvErasing = 0U;  /* Background erase of the next area     */
+static __IO uint32_t        KvEraseError = 0U;
+static __IO uint32_t        KvErases;
+static uint32_t             KvCompacting = 0U;
+static uint32_t             KvCompactCursor;
+static uint32_t             KvCompactWrite;
+static uint32_t             KvBuffer[KV_RECORD_SIZE(KV_STORE_MAX_VALUE_SIZE) / 4U];
+
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t          KV_ReadHeader(uint32_t Area, uint32_t *pGeneration);
+static HAL_StatusTypeDef KV_Scan(void);
+static uint32_t          KV_Find(uint16_t Key);
+static HAL_StatusTypeDef KV_WriteRecord(uint32_t Address, uint16_t Key, const void *pData, uint16_t Length);
+static HAL_StatusTypeDef KV_WriteHeader(uint32_t Area, uint32_t Generation);
+static HAL_StatusTypeDef KV_PrepareNext(void);
+static HAL_StatusTypeDef KV_Compact(uint32_t Records);
+static HAL_StatusTypeDef KV_Program(uint32_t Address, const uint32_t *pData, uint32_t Size);
+static HAL_StatusTypeDef KV_Erase(uint32_t Area, uint32_t Background);
+static uint32_t          KV_IsBlank(uint32_t Address, uint32_t Size);
+static void              KV_InvalidateCache(uint32_t Address, uint32_t Size);
+static uint32_t          KV_Crc(uint32_t Crc, const uint8_t *pData, uint32_t Size);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Recover the store from the flash
+  * @param  pInit: location of the areas
+  * @retval HAL status
+  */
+HAL_StatusTypeDef KV_Store_Init(const KV_Store_InitTypeDef *pInit)
+{
+  uint32_t area;
+  uint32_t generation;
+  uint32_t found = 0U;
+
+  KvReady = 0U;
+
+  if((pInit == NULL) || (pInit->AreaNbr < 2U) || ((pInit->StartAddress % KV_PROGRAM_UNIT) != 0U) ||
+     ((pInit->AreaSize % KV_PROGRAM_UNIT) != 0U) ||
+     (pInit->AreaSize < (KV_ALIGN(KV_HEADER_SIZE) + KV_RECORD_SIZE(KV_STORE_MAX_VALUE_SIZE))))
+  {
+    return HAL_ERROR;
+  }
+  if((pInit->AreaSize % FLASH_PAGE_SIZE) != 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  KvInit       = *pInit;
+  KvErases     = 0U;
+  KvCompacting = 0U;
+  KvEraseError = 0U;
+
+  /* The active area is the valid one of highest generation */
+  for(area = 0U; area < KvInit.AreaNbr; area++)
+  {
+    if((KV_ReadHeader(area, &generation) != 0U) && ((found == 0U) || (generation > KvGeneration)))
+    {
+      KvActive     = area;
+      KvGeneration = generation;
+      found        = 1U;
+    }
+  }
+
+  if(found == 0U)
+  {
+    KvReady = 1U;
+    if(KV_Store_Format() != HAL_OK)
+    {
+      KvReady = 0U;
+      return HAL_ERROR;
+    }
+    return HAL_OK;
+  }
+
+  if(KV_Scan() != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Left over of a compaction or a former area */
+  area = KV_NEXT_AREA(KvActive);
+  KvNextDirty = (KV_IsBlank(KV_AREA_ADDRESS(area), KvInit.AreaSize) != 0U) ? 0U : 1U;
+
+  KvReady = 1U;
+  return HAL_OK;
+}
+
+/**
+  * @brief  Erase all the areas
+  * @retval HAL status
+  */
+HAL_StatusTypeDef KV_Store_Format(void)
+{
+  uint32_t area;
+
+  if(KvReady == 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  while(KvErasing != 0U)
+  {
+  }
+
+  KvCompacting = 0U;
+  KvKeyNbr     = 0U;
+
+  for(area = 0U; area < KvInit.AreaNbr; area++)
+  {
+    if((KV_IsBlank(KV_AREA_ADDRESS(area), KvInit.AreaSize) == 0U) && (KV_Erase(area, 0U) != HAL_OK))
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  KvActive     = 0U;
+  KvGeneration = 1U;
+  KvWrite      = KV_AREA_ADDRESS(0U) + KV_ALIGN(KV_HEADER_SIZE);
+  KvLive       = KV_ALIGN(KV_HEADER_SIZE);
+  KvNextDirty  = 0U;
+
+  return KV_WriteHeader(0U, KvGeneration);
+}
+
+/**
+  * @brief  Store the value of a key
+  * @param  Key: key, 0xFFFF excluded
+  * @param  pData: value
+  * @param  Length: value size in bytes, 1 to KV_STORE_MAX_VALUE_SIZE
+  * @retval HAL status, HAL_ERROR when the store is full
+  */
+HAL_StatusTypeDef KV_Store_Set(uint16_t Key, const void *pData, uint16_t Length)
+{
+  uint32_t size = KV_RECORD_SIZE(Length);
+  uint32_t i;
+
+  if((KvReady == 0U) || (Key == 0xFFFFU) || (pData == NULL) || (Length == 0U) ||
+     (Length > KV_STORE_MAX_VALUE_SIZE))
+  {
+    return HAL_ERROR;
+  }
+
+  i = KV_Find(Key);
+  if((i == KvKeyNbr) && (KvKeyNbr == KV_STORE_MAX_KEYS))
+  {
+    return HAL_ERROR;
+  }
+  /* Room for the live records and the new one after a compaction */
+  if((KvLive + size) > KvInit.AreaSize)
+  {
+    return HAL_ERROR;
+  }
+
+  /* The index is not modified while compacting */
+  if((KvCompacting != 0U) && (KV_Compact(KvKeyNbr) != HAL_OK))
+  {
+    return HAL_ERROR;
+  }
+
+  if((KvWrite + size) > (KV_AREA_ADDRESS(KvActive) + KvInit.AreaSize))
+  {
+    if((KV_PrepareNext() != HAL_OK) || (KV_Compact(KvKeyNbr) != HAL_OK))
+    {
+      return HAL_ERROR;
+    }
+  }
+
+  while(KvErasing != 0U)
+  {
+  }
+
+  if(KV_WriteRecord(KvWrite, Key, pData, Length) != HAL_OK)
+  {
+    /* The space is lost, the record is ignored at the next scan */
+    KvWrite += size;
+    return HAL_ERROR;
+  }
+
+  if(i == KvKeyNbr)
+  {
+    KvIndex[i].Key = Key;
+    KvKeyNbr++;
+  }
+  else
+  {
+    KvLive -= KV_RECORD_SIZE(KvIndex[i].Length);
+  }
+  KvIndex[i].Length  = Length;
+  KvIndex[i].Address = KvWrite;
+  KvLive  += size;
+  KvWrite += size;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Read the value of a key
+  * @param  Key: key
+  * @param  pData: value, truncated to Size bytes
+  * @param  Size: size of the pData buffer
+  * @param  pLength: length of the stored value, may be NULL
+  * @retval HAL status, HAL_ERROR when the key is not found
+  */
+HAL_StatusTypeDef KV_Store_Get(uint16_t Key, void *pData, uint16_t Size, uint16_t *pLength)
+{
+  uint32_t i;
+
+  if(KvReady == 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  i = KV_Find(Key);
+  if(i == KvKeyNbr)
+  {
+    return HAL_ERROR;
+  }
+
+  if(pLength != NULL)
+  {
+    *pLength = KvIndex[i].Length;
+  }
+  if(Size > KvIndex[i].Length)
+  {
+    Size = KvIndex[i].Length;
+  }
+  memcpy(pData, (const void *)(KvIndex[i].Address + KV_RECORD_HEADER_SIZE), Size);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Remove a key
+  * @param  Key: key
+  * @retval HAL status, HAL_ERROR when the key is not found
+  */
+HAL_StatusTypeDef KV_Store_Delete(uint16_t Key)
+{
+  uint32_t size = KV_RECORD_SIZE(0U);
+  uint32_t i;
+
+  if(KvReady == 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  i = KV_Find(Key);
+  if(i == KvKeyNbr)
+  {
+    return HAL_ERROR;
+  }
+
+  if((KvCompacting != 0U) && (KV_Compact(KvKeyNbr) != HAL_OK))
+  {
+    return HAL_ERROR;
+  }
+
+  /* The compaction does not copy the deleted key */
+  KvLive -= KV_RECORD_SIZE(KvIndex[i].Length);
+  KvKeyNbr--;
+  KvIndex[i] = KvIndex[KvKeyNbr];
+
+  if((KvWrite + size) > (KV_AREA_ADDRESS(KvActive) + KvInit.AreaSize))
+  {
+    /* Nothing to mark: the compaction drops the key */
+    if(KV_PrepareNext() != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+    return KV_Compact(KvKeyNbr);
+  }
+
+  while(KvErasing != 0U)
+  {
+  }
+
+  if(KV_WriteRecord(KvWrite, Key, NULL, 0U) != HAL_OK)
+  {
+    KvWrite += size;
+    return HAL_ERROR;
+  }
+  KvWrite += size;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Background work: erase of the next area, compaction
+  * @retval HAL status
+  */
+HAL_StatusTypeDef KV_Store_Process(void)
+{
+  uint32_t used;
+
+  if((KvReady == 0U) || (KvErasing != 0U))
+  {
+    return HAL_OK;
+  }
+
+  if(KvEraseError != 0U)
+  {
+    KvEraseError = 0U;
+    return HAL_ERROR;
+  }
+
+  if(KvNextDirty != 0U)
+  {
+    return KV_Erase(KV_NEXT_AREA(KvActive), 1U);
+  }
+
+  used = KvWrite - KV_AREA_ADDRESS(KvActive);
+  if((KvCompacting != 0U) ||
+     ((used >= ((KvInit.AreaSize / 100U) * KV_STORE_COMPACT_LEVEL)) && (KvLive < used)))
+  {
+    return KV_Compact(KV_STORE_COMPACT_STEP);
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Usage of the store
+  * @param  pStats: statistics
+  * @retval None
+  */
+void KV_Store_GetStats(KV_Store_StatsTypeDef *pStats)
+{
+  pStats->Keys       = KvKeyNbr;
+  pStats->LiveSize   = KvLive;
+  pStats->FreeSize   = KV_AREA_ADDRESS(KvActive) + KvInit.AreaSize - KvWrite;
+  pStats->Generation = KvGeneration - 1U;
+  pStats->Erases     = KvErases;
+}
+
+/**
+  * @brief  End of the background erase
+  * @param  ReturnValue: KV_ERASE_DONE once all the erase units are erased
+  * @retval None
+  */
+void HAL_FLASH_EndOfOperationCallback(uint32_t ReturnValue)
+{
+  if((KvErasing != 0U) && (ReturnValue == KV_ERASE_DONE))
+  {
+    (void)HAL_FLASH_Lock();
+    KV_InvalidateCache(KV_AREA_ADDRESS(KV_NEXT_AREA(KvActive)), KvInit.AreaSize);
+    KvNextDirty = 0U;
+    KvErases++;
+    KvErasing = 0U;
+  }
+}
+
+/**
+  * @brief  Failure of the background erase
+  * @param  ReturnValue: erase unit in error
+  * @retval None
+  */
+void HAL_FLASH_OperationErrorCallback(uint32_t ReturnValue)
+{
+  UNUSED(ReturnValue);
+
+  if(KvErasing != 0U)
+  {
+    (void)HAL_FLASH_Lock();
+    KvEraseError = 1U;
+    KvErasing = 0U;
+  }
+}
+
+/**
+  * @brief  Read the header of an area
+  * @param  Area: area number
+  * @param  pGeneration: generation of the area
+  * @retval 1 when the header is valid
+  */
+static uint32_t KV_ReadHeader(uint32_t Area, uint32_t *pGeneration)
+{
+  uint32_t address = KV_AREA_ADDRESS(Area);
+
+  if((KV_WORD(address + 4U) != KV_AREA_MAGIC) || (KV_WORD(address) == KV_ERASED_WORD))
+  {
+    return 0U;
+  }
+  *pGeneration = KV_WORD(address);
+  return 1U;
+}
+
+/**
+  * @brief  Build the RAM index from the records of the active area
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef KV_Scan(void)
+{
+  uint32_t address = KV_AREA_ADDRESS(KvActive) + KV_ALIGN(KV_HEADER_SIZE);
+  uint32_t end     = KV_AREA_ADDRESS(KvActive) + KvInit.AreaSize;
+  uint32_t header;
+  uint32_t size;
+  uint32_t crc;
+  uint32_t i;
+  uint16_t key;
+  uint16_t length;
+
+  KvKeyNbr = 0U;
+  KvLive   = KV_ALIGN(KV_HEADER_SIZE);
+
+  while(address < end)
+  {
+    header = KV_WORD(address);
+    if(header == KV_ERASED_WORD)
+    {
+      break;
+    }
+
+    key    = (uint16_t)(header & 0xFFFFU);
+    length = (uint16_t)(header >> 16U);
+    size   = KV_RECORD_SIZE(length);
+    if((length > KV_STORE_MAX_VALUE_SIZE) || (size > (end - address)))
+    {
+      /* Header cut by a power loss: the end of the area cannot be used */
+      address = end;
+      break;
+    }
+
+    crc = KV_Crc(0U, (const uint8_t *)address, 4U);
+    crc = KV_Crc(crc, (const uint8_t *)(address + KV_RECORD_HEADER_SIZE), length);
+    if(crc == KV_WORD(address + 4U))
+    {
+      i = KV_Find(key);
+      if(i != KvKeyNbr)
+      {
+        KvLive -= KV_RECORD_SIZE(KvIndex[i].Length);
+        if(length == 0U)
+        {
+          KvKeyNbr--;
+          KvIndex[i] = KvIndex[KvKeyNbr];
+        }
+      }
+      else if(length != 0U)
+      {
+        if(KvKeyNbr == KV_STORE_MAX_KEYS)
+        {
+          return HAL_ERROR;
+        }
+        KvIndex[i].Key = key;
+        KvKeyNbr++;
+      }
+
+      if(length != 0U)
+      {
+        KvIndex[i].Length  = length;
+        KvIndex[i].Address = address;
+        KvLive += size;
+      }
+    }
+
+    address += size;
+  }
+
+  KvWrite = address;
+  return HAL_OK;
+}
+
+/**
+  * @brief  Index entry of a key
+  * @param  Key: key
+  * @retval Entry, KvKeyNbr when the key is not found
+  */
+static uint32_t KV_Find(uint16_t Key)
+{
+  uint32_t i;
+
+  for(i = 0U; i < KvKeyNbr; i++)
+  {
+    if(KvIndex[i].Key == Key)
+    {
+      break;
+    }
+  }
+  return i;
+}
+
+/**
+  * @brief  Program a record
+  * @param  Address: record address
+  * @param  Key: key
+  * @param  pData: value
+  * @param  Length: value size, 0 for a deletion
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef KV_WriteRecord(uint32_t Address, uint16_t Key, const void *pData, uint16_t Length)
+{
+  uint32_t size = KV_RECORD_SIZE(Length);
+  uint8_t *buffer = (uint8_t *)KvBuffer;
+
+  memset(KvBuffer, 0xFF, size);
+  KvBuffer[0] = (uint32_t)Key | ((uint32_t)Length << 16U);
+  if(Length != 0U)
+  {
+    memcpy(&buffer[KV_RECORD_HEADER_SIZE], pData, Length);
+  }
+  KvBuffer[1] = KV_Crc(KV_Crc(0U, buffer, 4U), &buffer[KV_RECORD_HEADER_SIZE], Length);
+
+  return KV_Program(Address, KvBuffer, size);
+}
+
+/**
+  * @brief  Program the header of an area, which validates it
+  * @param  Area: area number
+  * @param  Generation: generation of the area
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef KV_WriteHeader(uint32_t Area, uint32_t Generation)
+{
+  memset(KvBuffer, 0xFF, KV_ALIGN(KV_HEADER_SIZE));
+  KvBuffer[0] = Generation;
+  KvBuffer[1] = KV_AREA_MAGIC;
+
+  return KV_Program(KV_AREA_ADDRESS(Area), KvBuffer, KV_ALIGN(KV_HEADER_SIZE));
+}
+
+/**
+  * @brief  Make sure the next area is erased
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef KV_PrepareNext(void)
+{
+  while(KvErasing != 0U)
+  {
+  }
+
+  if(KvNextDirty != 0U)
+  {
+    if(KV_Erase(KV_NEXT_AREA(KvActive), 0U) != HAL_OK)
+    {
+      return HAL_ERROR;
+    }
+    KvNextDirty = 0U;
+  }
+  return HAL_OK;
+}
+
+/**
+  * @brief  Copy the live records to the next area, then switch to it
+  * @note   The next area is erased
+  * @param  Records: number of records to copy
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef KV_Compact(uint32_t Records)
+{
+  uint32_t next = KV_NEXT_AREA(KvActive);
+  uint32_t size;
+  uint32_t i;
+
+  if(KvCompacting == 0U)
+  {
+    KvCompacting    = 1U;
+    KvCompactCursor = 0U;
+    KvCompactWrite  = KV_AREA_ADDRESS(next) + KV_ALIGN(KV_HEADER_SIZE);
+  }
+
+  while((Records != 0U) && (KvCompactCursor < KvKeyNbr))
+  {
+    i    = KvCompactCursor;
+    size = KV_RECORD_SIZE(KvIndex[i].Length);
+
+    /* Through RAM: the source may not be readable while programming */
+    memcpy(KvBuffer, (const void *)KvIndex[i].Address, size);
+    if(KV_Program(KvCompactWrite, KvBuffer, size) != HAL_OK)
+    {
+      /* Restart on an erased area */
+      KvCompacting = 0U;
+      KvNextDirty  = 1U;
+      return HAL_ERROR;
+    }
+
+    KvIndex[i].NewAddress = KvCompactWrite;
+    KvCompactWrite += size;
+    KvCompactCursor++;
+    Records--;
+  }
+
+  if(KvCompactCursor < KvKeyNbr)
+  {
+    return HAL_OK;
+  }
+
+  /* All the live records are copied: the next area becomes active */
+  if(KV_WriteHeader(next, KvGeneration + 1U) != HAL_OK)
+  {
+    KvCompacting = 0U;
+    KvNextDirty  = 1U;
+    return HAL_ERROR;
+  }
+
+  for(i = 0U; i < KvKeyNbr; i++)
+  {
+    KvIndex[i].Address = KvIndex[i].NewAddress;
+  }
+  KvActive     = next;
+  KvGeneration = KvGeneration + 1U;
+  KvWrite      = KvCompactWrite;
+  KvCompacting = 0U;
+
+  next = KV_NEXT_AREA(KvActive);
+  KvNextDirty = (KV_IsBlank(KV_AREA_ADDRESS(next), KvInit.AreaSize) != 0U) ? 0U : 1U;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Program whole programming units
+  * @param  Address: flash address, aligned on KV_PROGRAM_UNIT
+  * @param  pData: data
+  * @param  Size: size in bytes, multiple of KV_PROGRAM_UNIT
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef KV_Program(uint32_t Address, const uint32_t *pData, uint32_t Size)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t offset;
+
+  if(HAL_FLASH_Unlock() != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Ascending order: the record header goes first */
+  for(offset = 0U; (offset < Size) && (status == HAL_OK); offset += KV_PROGRAM_UNIT)
+  {
+    status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_DOUBLEWORD, Address + offset,
+                               (uint64_t)pData[offset / 4U] | ((uint64_t)pData[(offset / 4U) + 1U] << 32U));
+  }
+
+  (void)HAL_FLASH_Lock();
+  KV_InvalidateCache(Address, Size);
+
+  return status;
+}
+
+/**
+  * @brief  Erase an area
+  * @param  Area: area number
+  * @param  Background: 1 to erase under interrupt
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef KV_Erase(uint32_t Area, uint32_t Background)
+{
+  FLASH_EraseInitTypeDef erase;
+  HAL_StatusTypeDef status;
+  uint32_t error;
+
+  erase.TypeErase    = FLASH_TYPEERASE_PAGES;
+  erase.Banks        = KvInit.Bank;
+  erase.Page         = KvInit.FirstPage + (Area * (KvInit.AreaSize / FLASH_PAGE_SIZE));
+  erase.NbPages      = KvInit.AreaSize / FLASH_PAGE_SIZE;
+
+  if(HAL_FLASH_Unlock() != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+
+  if(Background != 0U)
+  {
+    KvErasing = 1U;
+    if(HAL_FLASHEx_Erase_IT(&erase) != HAL_OK)
+    {
+      KvErasing = 0U;
+      (void)HAL_FLASH_Lock();
+      return HAL_ERROR;
+    }
+    return HAL_OK;
+  }
+
+  status = HAL_FLASHEx_Erase(&erase, &error);
+  (void)HAL_FLASH_Lock();
+  KV_InvalidateCache(KV_AREA_ADDRESS(Area), KvInit.AreaSize);
+  if(status == HAL_OK)
+  {
+    KvErases++;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Check that a flash range is erased
+  * @param  Address: start address
+  * @param  Size: size in bytes
+  * @retval 1 when erased
+  */
+static uint32_t KV_IsBlank(uint32_t Address, uint32_t Size)
+{
+  uint32_t offset;
+
+  for(offset = 0U; offset < Size; offset += 4U)
+  {
+    if(KV_WORD(Address + offset) != KV_ERASED_WORD)
+    {
+      return 0U;
+    }
+  }
+  return 1U;
+}
+
+/**
+  * @brief  Drop the D-cache lines of a programmed or erased range
+  * @param  Address: start address
+  * @param  Size: size in bytes
+  * @retval None
+  */
+static void KV_InvalidateCache(uint32_t Address, uint32_t Size)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if((SCB->CCR & SCB_CCR_DC_Msk) != 0U)
+  {
+    SCB_InvalidateDCache_by_Addr((uint32_t *)(Address & ~0x1FU), (int32_t)(Size + (Address & 0x1FU)));
+  }
+#else
+  UNUSED(Address);
+  UNUSED(Size);
+#endif
+}
+
+/**
+  * @brief  CRC-32 (IEEE 802.3), 4 bits at a time
+  * @param  Crc: CRC of the previous data, 0 to start
+  * @param  pData: data
+  * @param  Size: size in bytes
+  * @retval CRC
+  */
+static uint32_t KV_Crc(uint32_t Crc, const uint8_t *pData, uint32_t Size)
+{
+  static const uint32_t table[16] =
+  {
+    0x00000000U, 0x1DB71064U, 0x3B6E20C8U, 0x26D930ACU, 0x76DC4190U, 0x6B6B51F4U, 0x4DB26158U, 0x5005713CU,
+    0xEDB88320U, 0xF00F9344U, 0xD6D6A3E8U, 0xCB61B38CU, 0x9B64C2B0U, 0x86D3D2D4U, 0xA00AE278U, 0xBDBDF21CU
+  };
+  uint32_t i;
+
+  Crc = ~Crc;
+  for(i = 0U; i < Size; i++)
+  {
+    Crc ^= pData[i];
+    Crc = (Crc >> 4U) ^ table[Crc & 0x0FU];
+    Crc = (Crc >> 4U) ^ table[Crc & 0x0FU];
+  }
+  return ~Crc;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
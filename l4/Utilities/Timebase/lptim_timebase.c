@@ -0,0 +1,648 @@
+/**
+  ******************************************************************************
+  * @file    lptim_timebase.c
+  * @author  MCD Application Team
+  * @brief   Tickless 64-bit microsecond time base over the LPTIM1, replacing
+  *          the 1 ms HAL tick: timeouts and delays use compare matches.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- add this file instead of a stm32l4xx_hal_timebase_xxx.c file: it
+   implements HAL_InitTick(), HAL_GetTick(), HAL_Delay(), HAL_SuspendTick()
+   and HAL_ResumeTick(). Call TIMEBASE_IRQHandler() from LPTIM1_IRQHandler().
+
+2- HAL_Init() runs before the LSE is started: until TIMEBASE_CLOCK_READY(),
+   the SysTick gives the usual 1 ms tick. The next HAL_InitTick() call, done
+   by HAL_RCC_ClockConfig() or by the application once the LSE runs, starts
+   the LPTIM1 and stops the SysTick. The time continues from the SysTick one.
+
+3- the time is the LPTIM1 count extended to 64 bits, TIMEBASE_GetUs() gives
+   it in microseconds. The resolution is one count, 30.5 us on the LSE. The
+   only periodic interrupt left is the counter wrap: every 2 s on the LSE
+   without prescaler, every 256 s with TIMEBASE_PRESCALER set to 7.
+
+4- HAL_GetTick() reads the counter, so the HAL timeout loops need no tick
+   interrupt. HAL_Delay(), TIMEBASE_DelayUs() and TIMEBASE_WaitUntil()
+   program the compare match on the end of the wait and call
+   TIMEBASE_EnterLowPowerCallback() until then, when called from thread mode
+   with the interrupts enabled; otherwise they poll the counter. The default
+   callback enters the Sleep mode. Override it to enter the Stop 2 mode for
+   long waits: the LPTIM1 on the LSE keeps counting and wakes the device.
+
+5- TIMEBASE_SetAlarm() calls TIMEBASE_AlarmCallback() from the LPTIM1
+   interrupt at the given time. There is one alarm, setting it again moves it.
+
+6- RTOS tickless idle, ex. FreeRTOS: set configUSE_TICKLESS_IDLE to 2 in
+   FreeRTOSConfig.h and implement portSUPPRESS_TICKS_AND_SLEEP(xExpectedIdleTime)
+   as follows :
+      - stop the SysTick and mask the interrupts
+      - unless eTaskConfirmSleepModeStatus() returns eAbortSleep :
+          Us = TIMEBASE_Sleep(xExpectedIdleTime * 1000000 / configTICK_RATE_HZ)
+          vTaskStepTick(Us * configTICK_RATE_HZ / 1000000)
+      - unmask the interrupts and restart the SysTick
+   TIMEBASE_Sleep() programs the wake up, calls
+   TIMEBASE_EnterLowPowerCallback() once and returns the time slept: any
+   interrupt ends the sleep early.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "lptim_timebase.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#if (TIMEBASE_PRESCALER > 7U)
+#error "TIMEBASE_PRESCALER must be 0 to 7"
+#endif
+
+#define TIMEBASE_HZ       ((uint64_t)TIMEBASE_CLOCK_HZ >> TIMEBASE_PRESCALER)
+#define TIMEBASE_TOP      0xFFFFU                  /* LPTIM1 autoreload */
+#define TIMEBASE_NEVER    0xFFFFFFFFFFFFFFFFULL
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static uint32_t  TimebaseRunning;
+static uint32_t  TimebaseSysTick;                  /* SysTick started by HAL_InitTick()     */
+static uint64_t  TimebaseEpoch;                    /* Count at the start of the period      */
+static uint32_t  TimebaseTop;                      /* Wrap handled, counter may still be TOP */
+static uint32_t  TimebaseCmp;                      /* Last value written in LPTIM1 CMP      */
+static uint32_t  TimebaseCmpBusy;                  /* CMP write waiting for CMPOK           */
+static uint64_t  TimebaseWake  = TIMEBASE_NEVER;   /* End of the current wait, in counts    */
+static uint64_t  TimebaseAlarm = TIMEBASE_NEVER;   /* Alarm, in counts                      */
+
+/* Private function prototypes -----------------------------------------------*/
+static uint64_t TIMEBASE_Count(uint32_t *pCnt);
+static uint64_t TIMEBASE_After(uint64_t Counts);
+static void     TIMEBASE_Wait(uint64_t End);
+static void     TIMEBASE_Schedule(void);
+static uint64_t TIMEBASE_ToUs(uint64_t Count);
+static uint64_t TIMEBASE_FromUs(uint64_t Us, uint32_t Ceil);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Start the LPTIM1 time base, or the SysTick until its clock runs
+  * @note   Called by HAL_Init() and HAL_RCC_ClockConfig().
+  * @param  TickPriority: LPTIM1 (or SysTick) interrupt priority
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_InitTick(uint32_t TickPriority)
+{
+  uint32_t primask;
+
+  if (TimebaseRunning != 0U)
+  {
+    HAL_NVIC_SetPriority(LPTIM1_IRQn, TickPriority, 0U);
+    return HAL_OK;
+  }
+
+  if (TIMEBASE_CLOCK_READY() == 0U)
+  {
+    /* Default 1 ms SysTick time base meanwhile */
+    if (HAL_SYSTICK_Config(SystemCoreClock / 1000U) != 0U)
+    {
+      return HAL_ERROR;
+    }
+    HAL_NVIC_SetPriority(SysTick_IRQn, TickPriority, 0U);
+    TimebaseSysTick = 1U;
+    return HAL_OK;
+  }
+
+  __HAL_RCC_LPTIM1_CONFIG(TIMEBASE_CLKSOURCE);
+  __HAL_RCC_LPTIM1_CLK_ENABLE();
+  __HAL_RCC_LPTIM1_FORCE_RESET();
+  __HAL_RCC_LPTIM1_RELEASE_RESET();
+
+  /* CFGR and IER are written with the LPTIM1 disabled, ARR and CMP enabled */
+  LPTIM1->CFGR = (uint32_t)TIMEBASE_PRESCALER << LPTIM_CFGR_PRESC_Pos;
+  LPTIM1->IER  = LPTIM_IER_ARRMIE | LPTIM_IER_CMPMIE | LPTIM_IER_CMPOKIE;
+  LPTIM1->CR   = LPTIM_CR_ENABLE;
+  LPTIM1->ARR  = TIMEBASE_TOP;
+  while((LPTIM1->ISR & LPTIM_ISR_ARROK) == 0U)
+  {
+  }
+  LPTIM1->ICR = LPTIM_ICR_ARROKCF;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  /* Continue from the SysTick time */
+  TimebaseEpoch   = ((uint64_t)uwTick * TIMEBASE_HZ) / 1000U;
+  TimebaseTop     = 0U;
+  TimebaseCmp     = 0U;
+  TimebaseCmpBusy = 0U;
+  if (TimebaseSysTick != 0U)
+  {
+    SysTick->CTRL   = 0U;
+    SCB->ICSR       = SCB_ICSR_PENDSTCLR_Msk;
+    TimebaseSysTick = 0U;
+  }
+
+  LPTIM1->CR      = LPTIM_CR_ENABLE | LPTIM_CR_CNTSTRT;
+  TimebaseRunning = 1U;
+  TIMEBASE_Schedule();
+
+  __set_PRIMASK(primask);
+
+  HAL_NVIC_SetPriority(LPTIM1_IRQn, TickPriority, 0U);
+  HAL_NVIC_EnableIRQ(LPTIM1_IRQn);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Provide a tick value in millisecond, read from the counter
+  * @retval tick value
+  */
+uint32_t HAL_GetTick(void)
+{
+  uint64_t count;
+
+  if (TimebaseRunning == 0U)
+  {
+    return uwTick;
+  }
+
+  count = TIMEBASE_Count(NULL);
+  return (uint32_t)(((count / TIMEBASE_HZ) * 1000U) + (((count % TIMEBASE_HZ) * 1000U) / TIMEBASE_HZ));
+}
+
+/**
+  * @brief  Minimum delay in milliseconds, in low power mode when possible
+  * @param  Delay: delay in milliseconds, HAL_MAX_DELAY waits forever
+  * @retval None
+  */
+void HAL_Delay(uint32_t Delay)
+{
+  if (Delay == HAL_MAX_DELAY)
+  {
+    TIMEBASE_Wait(TIMEBASE_NEVER);
+  }
+  else
+  {
+    TIMEBASE_Wait(TIMEBASE_After((((uint64_t)Delay * TIMEBASE_HZ) + 999U) / 1000U));
+  }
+}
+
+/**
+  * @brief  Suspend Tick increment.
+  * @note   The LPTIM1 keeps counting, only the SysTick used before is stopped.
+  * @retval None
+  */
+void HAL_SuspendTick(void)
+{
+  if (TimebaseSysTick != 0U)
+  {
+    SysTick->CTRL &= ~SysTick_CTRL_TICKINT_Msk;
+  }
+}
+
+/**
+  * @brief  Resume Tick increment.
+  * @retval None
+  */
+void HAL_ResumeTick(void)
+{
+  if (TimebaseSysTick != 0U)
+  {
+    SysTick->CTRL |= SysTick_CTRL_TICKINT_Msk;
+  }
+}
+
+/**
+  * @brief  Tell whether the LPTIM1 runs the time base
+  * @retval 1 on the LPTIM1, 0 on the SysTick
+  */
+uint32_t TIMEBASE_IsRunning(void)
+{
+  return TimebaseRunning;
+}
+
+/**
+  * @brief  Time since reset
+  * @retval Time in microseconds, by steps of one LPTIM1 count
+  */
+uint64_t TIMEBASE_GetUs(void)
+{
+  return TIMEBASE_ToUs(TIMEBASE_Count(NULL));
+}
+
+/**
+  * @brief  Minimum delay in microseconds, in low power mode when possible
+  * @param  Delay: delay in microseconds
+  * @retval None
+  */
+void TIMEBASE_DelayUs(uint32_t Delay)
+{
+  TIMEBASE_Wait(TIMEBASE_After(TIMEBASE_FromUs(Delay, 1U)));
+}
+
+/**
+  * @brief  Wait until a time, in low power mode when possible
+  * @param  Us: time as given by TIMEBASE_GetUs()
+  * @retval None
+  */
+void TIMEBASE_WaitUntil(uint64_t Us)
+{
+  TIMEBASE_Wait(TIMEBASE_FromUs(Us, 1U));
+}
+
+/**
+  * @brief  Enter the low power mode once, up to a time limit
+  * @note   Meant for the RTOS tickless idle, called with the interrupts
+  *         masked. Any interrupt ends the sleep.
+  * @param  MaxUs: time limit in microseconds
+  * @retval Time slept in microseconds, 0 without the LPTIM1
+  */
+uint64_t TIMEBASE_Sleep(uint64_t MaxUs)
+{
+  uint64_t start;
+  uint64_t end;
+  uint64_t now;
+  uint64_t wake;
+  uint32_t primask;
+
+  if (TimebaseRunning == 0U)
+  {
+    return 0U;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  start = TIMEBASE_Count(NULL);
+  end   = start + TIMEBASE_FromUs(MaxUs, 0U);
+  wake  = TimebaseWake;
+  if (end < wake)
+  {
+    TimebaseWake = end;
+  }
+  TIMEBASE_Schedule();
+
+  now = TIMEBASE_Count(NULL);
+  if (now < end)
+  {
+    TIMEBASE_EnterLowPowerCallback(TIMEBASE_ToUs(end - now));
+  }
+
+  TimebaseWake = wake;
+  TIMEBASE_Schedule();
+  now = TIMEBASE_Count(NULL);
+
+  __set_PRIMASK(primask);
+
+  return TIMEBASE_ToUs(now - start);
+}
+
+/**
+  * @brief  Call TIMEBASE_AlarmCallback() at a given time
+  * @param  Us: time as given by TIMEBASE_GetUs(), called at once when past
+  * @retval HAL status, HAL_ERROR before the LPTIM1 runs
+  */
+HAL_StatusTypeDef TIMEBASE_SetAlarm(uint64_t Us)
+{
+  uint32_t primask;
+
+  if (TimebaseRunning == 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  TimebaseAlarm = TIMEBASE_FromUs(Us, 1U);
+  TIMEBASE_Schedule();
+  __set_PRIMASK(primask);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Cancel the alarm
+  * @retval None
+  */
+void TIMEBASE_CancelAlarm(void)
+{
+  uint32_t primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  TimebaseAlarm = TIMEBASE_NEVER;
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Handle the LPTIM1 interrupt: counter wrap, compare match and
+  *         compare update
+  * @retval None
+  */
+void TIMEBASE_IRQHandler(void)
+{
+  uint32_t isr;
+  uint32_t due = 0U;
+  uint32_t primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  isr = LPTIM1->ISR;
+  if ((isr & LPTIM_ISR_ARRM) != 0U)
+  {
+    /* The flag must be low before the next counter read */
+    LPTIM1->ICR = LPTIM_ICR_ARRMCF;
+    while((LPTIM1->ISR & LPTIM_ISR_ARRM) != 0U)
+    {
+    }
+    TimebaseEpoch += (uint64_t)TIMEBASE_TOP + 1U;
+    TimebaseTop    = 1U;
+  }
+  if ((isr & LPTIM_ISR_CMPOK) != 0U)
+  {
+    LPTIM1->ICR     = LPTIM_ICR_CMPOKCF;
+    TimebaseCmpBusy = 0U;
+  }
+  if ((isr & LPTIM_ISR_CMPM) != 0U)
+  {
+    LPTIM1->ICR = LPTIM_ICR_CMPMCF;
+  }
+
+  if (TimebaseAlarm <= TIMEBASE_Count(NULL))
+  {
+    TimebaseAlarm = TIMEBASE_NEVER;
+    due = 1U;
+  }
+  TIMEBASE_Schedule();
+
+  __set_PRIMASK(primask);
+
+  if (due != 0U)
+  {
+    TIMEBASE_AlarmCallback();
+  }
+}
+
+/**
+  * @brief  Alarm time reached, called from the LPTIM1 interrupt
+  * @retval None
+  */
+__weak void TIMEBASE_AlarmCallback(void)
+{
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the TIMEBASE_AlarmCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Enter a low power mode until the next interrupt
+  * @note   Called with the interrupts masked: a pending interrupt wakes the
+  *         device, it is served once the caller unmasks the interrupts.
+  * @param  Us: time until the programmed wake up, in microseconds
+  * @retval None
+  */
+__weak void TIMEBASE_EnterLowPowerCallback(uint64_t Us)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Us);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the TIMEBASE_EnterLowPowerCallback could be implemented in the user file
+   */
+  HAL_PWR_EnterSLEEPMode(PWR_MAINREGULATOR_ON, PWR_SLEEPENTRY_WFI);
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Read the 64-bit count
+  * @note   The wrap is counted by the interrupt; a wrap not handled yet is
+  *         detected from the ARRM flag. ARRM rises while the counter is at
+  *         TOP, the counter may still be there when the interrupt is served.
+  * @param  pCnt: receives the LPTIM1 counter, may be NULL
+  * @retval Count since reset
+  */
+static uint64_t TIMEBASE_Count(uint32_t *pCnt)
+{
+  uint64_t count;
+  uint32_t cnt;
+  uint32_t last;
+  uint32_t primask;
+
+  if (TimebaseRunning == 0U)
+  {
+    return ((uint64_t)uwTick * TIMEBASE_HZ) / 1000U;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  /* Asynchronous counter: two consecutive reads must match */
+  cnt = LPTIM1->CNT;
+  do
+  {
+    last = cnt;
+    cnt  = LPTIM1->CNT;
+  } while(cnt != last);
+
+  if ((LPTIM1->ISR & LPTIM_ISR_ARRM) != 0U)
+  {
+    count = TimebaseEpoch + cnt;
+    if (cnt != TIMEBASE_TOP)
+    {
+      count += (uint64_t)TIMEBASE_TOP + 1U;
+    }
+  }
+  else if ((TimebaseTop != 0U) && (cnt == TIMEBASE_TOP))
+  {
+    count = TimebaseEpoch - 1U;
+  }
+  else
+  {
+    TimebaseTop = 0U;
+    count = TimebaseEpoch + cnt;
+  }
+
+  __set_PRIMASK(primask);
+
+  if (pCnt != NULL)
+  {
+    *pCnt = cnt;
+  }
+  return count;
+}
+
+/**
+  * @brief  End of a wait
+  * @param  Counts: wait length in counts
+  * @retval Count at the end of the wait
+  */
+static uint64_t TIMEBASE_After(uint64_t Counts)
+{
+  /* The current count is partly elapsed: one more count, 1 ms on the SysTick */
+  return TIMEBASE_Count(NULL) + Counts + ((TimebaseRunning != 0U) ? 1U : (TIMEBASE_HZ / 1000U));
+}
+
+/**
+  * @brief  Wait for a count, in low power mode from thread mode
+  * @param  End: count to wait for, TIMEBASE_NEVER for ever
+  * @retval None
+  */
+static void TIMEBASE_Wait(uint64_t End)
+{
+  uint64_t now;
+  uint64_t wake;
+  uint32_t primask;
+  uint32_t sleep = 0U;
+
+  /* Only from thread mode, when no mask keeps the wake up pending */
+  if ((TimebaseRunning != 0U) && (__get_IPSR() == 0U) && (__get_PRIMASK() == 0U) && (__get_BASEPRI() == 0U))
+  {
+    sleep = 1U;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  wake = TimebaseWake;
+  if (End < wake)
+  {
+    TimebaseWake = End;
+    TIMEBASE_Schedule();
+  }
+  __set_PRIMASK(primask);
+
+  do
+  {
+    if (sleep != 0U)
+    {
+      /* Masked: a match between the check and the WFI still wakes up */
+      __disable_irq();
+      now = TIMEBASE_Count(NULL);
+      if (now < End)
+      {
+        TIMEBASE_EnterLowPowerCallback(TIMEBASE_ToUs(End - now));
+      }
+      __enable_irq();
+    }
+    now = TIMEBASE_Count(NULL);
+  } while(now < End);
+
+  /* Restore the wait this one interrupted, if any */
+  primask = __get_PRIMASK();
+  __disable_irq();
+  TimebaseWake = wake;
+  TIMEBASE_Schedule();
+  __set_PRIMASK(primask);
+}
+
+/**
+  * @brief  Program the compare match on the next wait end or alarm
+  * @note   Called with the interrupts masked. Matches beyond the current
+  *         period are programmed by the wrap interrupt. A match missed while
+  *         CMP was updated is caught by the CMPOK interrupt.
+  * @retval None
+  */
+static void TIMEBASE_Schedule(void)
+{
+  uint64_t now;
+  uint64_t next;
+  uint64_t cmp;
+  uint32_t cnt;
+
+  if (TimebaseRunning == 0U)
+  {
+    return;
+  }
+
+  now = TIMEBASE_Count(&cnt);
+  if (TimebaseWake <= now)
+  {
+    TimebaseWake = TIMEBASE_NEVER;
+  }
+  if (TimebaseAlarm <= now)
+  {
+    /* Due: the interrupt calls the callback */
+    HAL_NVIC_SetPendingIRQ(LPTIM1_IRQn);
+    return;
+  }
+
+  next = (TimebaseWake < TimebaseAlarm) ? TimebaseWake : TimebaseAlarm;
+  if (next == TIMEBASE_NEVER)
+  {
+    return;
+  }
+
+  /* CMP must stay below ARR, a match at TOP is the wrap interrupt */
+  cmp = next - (now - cnt);
+  if ((cmp < TIMEBASE_TOP) && ((uint32_t)cmp != TimebaseCmp))
+  {
+    if (TimebaseCmpBusy != 0U)
+    {
+      /* One CMP write at a time, the previous one takes a few kernel clocks */
+      while((LPTIM1->ISR & LPTIM_ISR_CMPOK) == 0U)
+      {
+      }
+      LPTIM1->ICR = LPTIM_ICR_CMPOKCF;
+    }
+    LPTIM1->CMP     = (uint32_t)cmp;
+    TimebaseCmp     = (uint32_t)cmp;
+    TimebaseCmpBusy = 1U;
+  }
+}
+
+/**
+  * @brief  Convert counts to microseconds
+  * @param  Count: counts
+  * @retval Microseconds, rounded down
+  */
+static uint64_t TIMEBASE_ToUs(uint64_t Count)
+{
+  return ((Count / TIMEBASE_HZ) * 1000000U) + (((Count % TIMEBASE_HZ) * 1000000U) / TIMEBASE_HZ);
+}
+
+/**
+  * @brief  Convert microseconds to counts
+  * @param  Us: microseconds
+  * @param  Ceil: round up when non zero, down otherwise
+  * @retval Counts
+  */
+static uint64_t TIMEBASE_FromUs(uint64_t Us, uint32_t Ceil)
+{
+  uint64_t frac = (Us % 1000000U) * TIMEBASE_HZ;
+
+  if (Ceil != 0U)
+  {
+    frac += 999999U;
+  }
+  return ((Us / 1000000U) * TIMEBASE_HZ) + (frac / 1000000U);
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,879 @@
+/**
+  ******************************************************************************
+  * @file    tsc_scan.c
+  * @author  MCD Application Team
+  * @brief   Capacitive touch scanning over HAL_TSC: bank sequencing from the
+  *          end of acquisition interrupt, baselines, debounce and sliders
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- initialize the TSC with HAL_TSC_Init(), IODefaultMode TSC_IODEF_OUT_PP_LOW
+   so that the IOs discharge the sampling capacitors between acquisitions,
+   MaxCountInterrupt ENABLE, and the GPIOs of the electrodes and sampling
+   capacitors in HAL_TSC_MspInit(). Enable the TSC interrupt and call
+   HAL_TSC_IRQHandler() from TSC_IRQHandler(): this module implements
+   HAL_TSC_ConvCpltCallback() and HAL_TSC_ErrorCallback(), registered at
+   init when USE_HAL_TSC_REGISTER_CALLBACKS is 1.
+
+2- describe the electrodes:
+   (+) banks: the channel IOs acquired together, at most one per group, and
+       the sampling IO of their groups. The banks are acquired in turn, a
+       cycle acquires all of them. Channels are numbered in bank order,
+       then in group order within a bank: a first bank with TSC_GROUP1_IO2
+       and TSC_GROUP3_IO1 gives channels 0 and 1.
+   (+) sensors: a key uses one channel, a slider or a wheel 2 to 8 channels
+       listed along the sensor (3 at least for a wheel). Threshold is the
+       count decrease from the baseline detected as a touch, the release
+       comes when it falls below Threshold - Hysteresis. Tune both from
+       TSC_Scan_GetDelta() with and without a finger on the electrode.
+
+3- fill a TSC_Scan_ConfigTypeDef and call TSC_Scan_Init(). The first
+   TSC_SCAN_CALIBRATION_CYCLES cycles measure the baselines, keep the
+   electrodes untouched meanwhile. Then at the end of each cycle, from the
+   interrupt, all the channels are processed at once:
+   (+) the baseline follows slow drifts of the count while the sensor is
+       not touched, and is reset at once when the count rises above it by
+       more than the threshold (sensor touched during the calibration).
+   (+) a touch or a release is reported after TSC_SCAN_DEBOUNCE cycles
+       confirming it.
+   (+) a slider or a wheel position is the centroid of the strongest
+       electrode and its neighbours, filtered, reported in MOVE events when
+       it changes by TSC_SCAN_MOVE_THRESHOLD or more.
+
+4- the application calls TSC_Scan_GetEvent() until it returns 0, from its
+   main loop or from a task woken by TSC_Scan_EventCallback(), called from
+   the interrupt after a cycle which queued events. Events are lost when
+   the queue is full, see TSC_Scan_GetStats().
+
+5- scanning modes:
+   (+) TSC_SCAN_MODE_CONTINUOUS: the next cycle starts as soon as the last
+       bank is acquired, before the processing of the cycle.
+   (+) TSC_SCAN_MODE_TRIGGERED: TSC_Scan_Trigger() starts one cycle, from
+       a timer or an RTC wake up interrupt for a low scanning rate.
+   With LowPowerIdle, a touch detected in TRIGGERED mode switches to
+   CONTINUOUS mode at once, and LowPowerIdle ms without touch switch back.
+
+6- low power: the TSC needs its clock, acquisitions do not run in Stop
+   mode. With power_mgr, define TSC_SCAN_USE_POWER_MGR in main.h: the
+   TSC_SCAN_PWR_LOCK lock limits the low power mode to Sleep during a cycle
+   only, the device enters Stop between triggered cycles. With
+   lptim_timebase, define TSC_SCAN_USE_TIMEBASE in main.h: this module
+   implements TIMEBASE_AlarmCallback() and triggers a cycle every
+   LowPowerPeriod ms in TRIGGERED mode, the LPTIM1 waking the device from
+   Stop. The alarm is then not available to the application.
+
+Give the TSC interrupt and the interrupt calling TSC_Scan_Trigger() the
+same preemption priority.
+*******************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include "tsc_scan.h"
+#if defined(TSC_SCAN_USE_POWER_MGR)
+#include "power_mgr.h"
+#endif
+#if defined(TSC_SCAN_USE_TIMEBASE)
+#include "lptim_timebase.h"
+#endif
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  uint8_t   Touched;
+  uint8_t   Debounce;     /* Cycles confirming a change of state     */
+  uint8_t   LastPos;      /* Position of the last event              */
+  uint8_t   Reserved;
+  int32_t   FiltPos;      /* Filtered position, 1/16 of a position   */
+} TSC_Scan_SensorStateTypeDef;
+
+/* Private define ------------------------------------------------------------*/
+#define TSC_SCAN_MAX_SENSORS        32U
+#define TSC_SCAN_NO_SENSOR          0xFFU
+#define TSC_SCAN_GROUP_IOS          4U      /* IOs per group in the IO masks */
+#define TSC_SCAN_GROUP_MASK         0x0FU
+
+/* Private macro -------------------------------------------------------------*/
+#define TSC_SCAN_ABS(__X__)         (((__X__) < 0) ? -(__X__) : (__X__))
+
+/* Private variables ---------------------------------------------------------*/
+static TSC_Scan_ConfigTypeDef       ScanConfig;
+static uint8_t                      ScanBankFirst[TSC_SCAN_MAX_BANKS + 1U];  /* First channel of each bank */
+static uint8_t                      ScanGroup[TSC_SCAN_MAX_CHANNELS];        /* Group of each channel      */
+static uint8_t                      ScanSensorOf[TSC_SCAN_MAX_CHANNELS];     /* Sensor of each channel     */
+static uint16_t                     ScanCount[TSC_SCAN_MAX_CHANNELS];        /* Last acquisition           */
+static int32_t                      ScanBaseline[TSC_SCAN_MAX_CHANNELS];     /* 1/16 of a count            */
+static int16_t                      ScanDelta[TSC_SCAN_MAX_CHANNELS];
+static TSC_Scan_SensorStateTypeDef  ScanSensors[TSC_SCAN_MAX_SENSORS];
+static uint32_t                     ScanChannels;
+
+static TSC_Scan_EventTypeDef        ScanEvents[TSC_SCAN_QUEUE_SIZE];
+static __IO uint32_t                ScanHead;          /* Written by the interrupt   */
+static __IO uint32_t                ScanTail;          /* Written by the reader      */
+static TSC_Scan_StatsTypeDef        ScanStats;
+
+static uint32_t                     ScanEnabled;
+static __IO uint32_t                ScanMode;
+static __IO uint32_t                ScanBusy;          /* Cycle in progress          */
+static uint32_t                     ScanBank;          /* Bank being acquired        */
+static uint32_t                     ScanCalibration;   /* Calibration cycles left    */
+static __IO uint32_t                ScanTouched;       /* Bit n: sensor n touched    */
+static uint32_t                     ScanIdleTick;      /* Last cycle with a touch    */
+static uint32_t                     ScanTick;          /* End of the current cycle   */
+
+/* Private function prototypes -----------------------------------------------*/
+static void     TSC_Scan_Begin(void);
+static void     TSC_Scan_End(void);
+static void     TSC_Scan_StartBank(uint32_t Bank);
+static void     TSC_Scan_Acquired(TSC_HandleTypeDef *htsc);
+static void     TSC_Scan_Process(void);
+static uint32_t TSC_Scan_Sensor(uint32_t Sensor);
+static int32_t  TSC_Scan_Position(const TSC_Scan_SensorTypeDef *pSensor, uint32_t Strongest);
+static void     TSC_Scan_Push(uint32_t Type, uint32_t Sensor, uint32_t Position, int32_t Move, int32_t Delta);
+static void     TSC_Scan_Schedule(void);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Check the configuration and start scanning
+  * @param  pConfig: TSC handle, banks and sensors, copied, the banks and
+  *         sensors arrays are kept
+  * @retval HAL_OK, or HAL_ERROR on a wrong configuration
+  */
+HAL_StatusTypeDef TSC_Scan_Init(const TSC_Scan_ConfigTypeDef *pConfig)
+{
+  const TSC_Scan_BankTypeDef *pbank;
+  const TSC_Scan_SensorTypeDef *psensor;
+  uint32_t b, g, s, k, ios, channels = 0U;
+
+  if((pConfig == NULL) || (pConfig->htsc == NULL) || (pConfig->pBanks == NULL) ||
+     (pConfig->Banks == 0U) || (pConfig->Banks > TSC_SCAN_MAX_BANKS) ||
+     (pConfig->Sensors > TSC_SCAN_MAX_SENSORS) || ((pConfig->Sensors != 0U) && (pConfig->pSensors == NULL)) ||
+     (pConfig->Mode > TSC_SCAN_MODE_TRIGGERED) ||
+     (pConfig->htsc->Init.IODefaultMode != TSC_IODEF_OUT_PP_LOW) ||
+     ((TSC_SCAN_QUEUE_SIZE & (TSC_SCAN_QUEUE_SIZE - 1U)) != 0U) || (TSC_SCAN_CALIBRATION_CYCLES == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  (void)TSC_Scan_DeInit();
+
+  /* Channels of each bank: one IO per group, a sampling IO in its group */
+  for(b = 0U; b < pConfig->Banks; b++)
+  {
+    pbank = &pConfig->pBanks[b];
+    ScanBankFirst[b] = (uint8_t)channels;
+    if((pbank->ChannelIOs == 0U) || ((pbank->ChannelIOs & pbank->SamplingIOs) != 0U) ||
+       ((pbank->ChannelIOs & pConfig->ShieldIOs) != 0U))
+    {
+      return HAL_ERROR;
+    }
+    for(g = 0U; g < (uint32_t)TSC_NB_OF_GROUPS; g++)
+    {
+      ios = (pbank->ChannelIOs >> (g * TSC_SCAN_GROUP_IOS)) & TSC_SCAN_GROUP_MASK;
+      if(ios == 0U)
+      {
+        continue;
+      }
+      if(((ios & (ios - 1U)) != 0U) || (channels >= TSC_SCAN_MAX_CHANNELS) ||
+         (((pbank->SamplingIOs >> (g * TSC_SCAN_GROUP_IOS)) & TSC_SCAN_GROUP_MASK) == 0U))
+      {
+        return HAL_ERROR;
+      }
+      ScanGroup[channels]    = (uint8_t)g;
+      ScanSensorOf[channels] = TSC_SCAN_NO_SENSOR;
+      channels++;
+    }
+  }
+  ScanBankFirst[pConfig->Banks] = (uint8_t)channels;
+
+  /* Sensors: channels in range and not shared */
+  for(s = 0U; s < pConfig->Sensors; s++)
+  {
+    psensor = &pConfig->pSensors[s];
+    if((psensor->Type > TSC_SCAN_WHEEL) || (psensor->Threshold == 0U) ||
+       (psensor->Hysteresis >= psensor->Threshold) || (psensor->Channels > TSC_SCAN_SENSOR_CHANNELS) ||
+       ((psensor->Type == TSC_SCAN_KEY) && (psensor->Channels != 1U)) ||
+       ((psensor->Type == TSC_SCAN_SLIDER) && (psensor->Channels < 2U)) ||
+       ((psensor->Type == TSC_SCAN_WHEEL) && (psensor->Channels < 3U)))
+    {
+      return HAL_ERROR;
+    }
+    for(k = 0U; k < psensor->Channels; k++)
+    {
+      if((psensor->Channel[k] >= channels) || (ScanSensorOf[psensor->Channel[k]] != TSC_SCAN_NO_SENSOR))
+      {
+        return HAL_ERROR;
+      }
+      ScanSensorOf[psensor->Channel[k]] = (uint8_t)s;
+    }
+    ScanSensors[s].Touched  = 0U;
+    ScanSensors[s].Debounce = 0U;
+    ScanSensors[s].LastPos  = 0U;
+    ScanSensors[s].FiltPos  = 0;
+  }
+
+  for(k = 0U; k < channels; k++)
+  {
+    ScanBaseline[k] = 0;
+    ScanDelta[k]    = 0;
+  }
+
+#if (USE_HAL_TSC_REGISTER_CALLBACKS == 1)
+  if((HAL_TSC_RegisterCallback(pConfig->htsc, HAL_TSC_CONV_COMPLETE_CB_ID, HAL_TSC_ConvCpltCallback) != HAL_OK) ||
+     (HAL_TSC_RegisterCallback(pConfig->htsc, HAL_TSC_ERROR_CB_ID, HAL_TSC_ErrorCallback) != HAL_OK))
+  {
+    return HAL_ERROR;
+  }
+#endif /* USE_HAL_TSC_REGISTER_CALLBACKS */
+
+  ScanConfig      = *pConfig;
+  ScanChannels    = channels;
+  ScanHead        = 0U;
+  ScanTail        = 0U;
+  ScanTouched     = 0U;
+  ScanCalibration = TSC_SCAN_CALIBRATION_CYCLES;
+  ScanIdleTick    = HAL_GetTick();
+  ScanStats.Cycles   = 0U;
+  ScanStats.Events   = 0U;
+  ScanStats.Overruns = 0U;
+  ScanStats.Errors   = 0U;
+  ScanStats.Busy     = 0U;
+
+  /* Calibration runs back to back whatever the mode */
+  ScanMode    = pConfig->Mode;
+  ScanEnabled = 1U;
+  TSC_Scan_Begin();
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop scanning, queued events are kept
+  * @retval HAL_OK
+  */
+HAL_StatusTypeDef TSC_Scan_DeInit(void)
+{
+  if(ScanEnabled == 0U)
+  {
+    return HAL_OK;
+  }
+
+  ScanEnabled = 0U;
+#if defined(TSC_SCAN_USE_TIMEBASE)
+  TIMEBASE_CancelAlarm();
+#endif
+  (void)HAL_TSC_Stop_IT(ScanConfig.htsc);
+  TSC_Scan_End();
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Change the scanning mode
+  * @param  Mode: TSC_SCAN_MODE_CONTINUOUS, or TSC_SCAN_MODE_TRIGGERED, which
+  *         stops at the end of the current cycle
+  * @retval HAL_OK, or HAL_ERROR when not initialized or on a wrong mode
+  */
+HAL_StatusTypeDef TSC_Scan_SetMode(uint32_t Mode)
+{
+  uint32_t primask;
+
+  if((ScanEnabled == 0U) || (Mode > TSC_SCAN_MODE_TRIGGERED))
+  {
+    return HAL_ERROR;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  ScanMode     = Mode;
+  ScanIdleTick = HAL_GetTick();
+  if(Mode == TSC_SCAN_MODE_CONTINUOUS)
+  {
+    if(ScanBusy == 0U)
+    {
+      TSC_Scan_Begin();
+    }
+  }
+  else
+  {
+    TSC_Scan_Schedule();
+  }
+  __set_PRIMASK(primask);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Get the scanning mode, changed by the touches with LowPowerIdle
+  * @retval TSC_SCAN_MODE_xxx
+  */
+uint32_t TSC_Scan_GetMode(void)
+{
+  return ScanMode;
+}
+
+/**
+  * @brief  Start a cycle in TRIGGERED mode
+  * @retval HAL_OK, HAL_BUSY while a cycle is in progress or in CONTINUOUS
+  *         mode, or HAL_ERROR when not initialized
+  */
+HAL_StatusTypeDef TSC_Scan_Trigger(void)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t primask;
+
+  if(ScanEnabled == 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if(ScanBusy != 0U)
+  {
+    ScanStats.Busy++;
+    status = HAL_BUSY;
+  }
+  else
+  {
+    TSC_Scan_Begin();
+  }
+  __set_PRIMASK(primask);
+
+  return status;
+}
+
+/**
+  * @brief  Get the oldest event
+  * @param  pEvent: Event
+  * @retval 1 if an event was returned, 0 if the queue is empty
+  */
+uint32_t TSC_Scan_GetEvent(TSC_Scan_EventTypeDef *pEvent)
+{
+  uint32_t tail = ScanTail;
+
+  if(tail == ScanHead)
+  {
+    return 0U;
+  }
+
+  *pEvent = ScanEvents[tail & (TSC_SCAN_QUEUE_SIZE - 1U)];
+  ScanTail = tail + 1U;
+
+  return 1U;
+}
+
+/**
+  * @brief  Get the sensors touched at the last cycle
+  * @retval Bit n set when sensor n is touched
+  */
+uint32_t TSC_Scan_GetTouched(void)
+{
+  return ScanTouched;
+}
+
+/**
+  * @brief  Get the count decrease of a channel from its baseline, to tune
+  *         the thresholds
+  * @param  Channel: channel number
+  * @retval Decrease at the last cycle, 0 during the calibration
+  */
+int32_t TSC_Scan_GetDelta(uint32_t Channel)
+{
+  return (Channel < ScanChannels) ? (int32_t)ScanDelta[Channel] : 0;
+}
+
+/**
+  * @brief  Get the scanning counters
+  * @param  pStats: Counters
+  * @retval None
+  */
+void TSC_Scan_GetStats(TSC_Scan_StatsTypeDef *pStats)
+{
+  *pStats = ScanStats;
+}
+
+/**
+  * @brief  Acquisition of a bank completed
+  * @param  htsc: TSC handle
+  * @retval None
+  */
+void HAL_TSC_ConvCpltCallback(TSC_HandleTypeDef *htsc)
+{
+  TSC_Scan_Acquired(htsc);
+}
+
+/**
+  * @brief  Max count error: the groups not completed keep their last count
+  * @param  htsc: TSC handle
+  * @retval None
+  */
+void HAL_TSC_ErrorCallback(TSC_HandleTypeDef *htsc)
+{
+  TSC_Scan_Acquired(htsc);
+}
+
+#if defined(TSC_SCAN_USE_TIMEBASE)
+/**
+  * @brief  Low power scanning period elapsed
+  * @retval None
+  */
+void TIMEBASE_AlarmCallback(void)
+{
+  if((ScanEnabled != 0U) && (ScanMode == TSC_SCAN_MODE_TRIGGERED))
+  {
+    (void)TSC_Scan_Trigger();
+    TSC_Scan_Schedule();
+  }
+}
+#endif /* TSC_SCAN_USE_TIMEBASE */
+
+/**
+  * @brief  Events were queued, called from the TSC interrupt
+  * @retval None
+  */
+__weak void TSC_Scan_EventCallback(void)
+{
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the TSC_Scan_EventCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Start a cycle from the first bank
+  * @retval None
+  */
+static void TSC_Scan_Begin(void)
+{
+  ScanBusy = 1U;
+#if defined(TSC_SCAN_USE_POWER_MGR)
+  (void)PWR_Mgr_Lock(TSC_SCAN_PWR_LOCK, PWR_MGR_MODE_SLEEP);
+#endif
+  ScanBank = 0U;
+  TSC_Scan_StartBank(0U);
+}
+
+/**
+  * @brief  No more cycle in progress
+  * @retval None
+  */
+static void TSC_Scan_End(void)
+{
+  ScanBusy = 0U;
+#if defined(TSC_SCAN_USE_POWER_MGR)
+  PWR_Mgr_Unlock(TSC_SCAN_PWR_LOCK);
+#endif
+}
+
+/**
+  * @brief  Select the IOs of a bank and start its acquisition
+  * @param  Bank: bank number
+  * @retval None
+  */
+static void TSC_Scan_StartBank(uint32_t Bank)
+{
+  TSC_IOConfigTypeDef config;
+  uint32_t delay;
+
+  config.ChannelIOs  = ScanConfig.pBanks[Bank].ChannelIOs;
+  config.SamplingIOs = ScanConfig.pBanks[Bank].SamplingIOs;
+  config.ShieldIOs   = ScanConfig.ShieldIOs;
+  (void)HAL_TSC_IOConfig(ScanConfig.htsc, &config);
+
+  /* The IOs held low since the last acquisition discharge the sampling
+     capacitors, newly selected ones need a few microseconds */
+  delay = TSC_SCAN_DISCHARGE_US * (SystemCoreClock / 4000000U);
+  while(delay != 0U)
+  {
+    delay--;
+    __NOP();
+  }
+
+  (void)HAL_TSC_Start_IT(ScanConfig.htsc);
+}
+
+/**
+  * @brief  End of acquisition of the current bank: read its groups, start
+  *         the next bank, or process the cycle after the last one
+  * @param  htsc: TSC handle
+  * @retval None
+  */
+static void TSC_Scan_Acquired(TSC_HandleTypeDef *htsc)
+{
+  uint32_t ch;
+
+  if((htsc != ScanConfig.htsc) || (ScanEnabled == 0U) || (ScanBusy == 0U))
+  {
+    return;
+  }
+
+  for(ch = ScanBankFirst[ScanBank]; ch < ScanBankFirst[ScanBank + 1U]; ch++)
+  {
+    if(HAL_TSC_GroupGetStatus(htsc, ScanGroup[ch]) == TSC_GROUP_COMPLETED)
+    {
+      ScanCount[ch] = (uint16_t)HAL_TSC_GroupGetValue(htsc, ScanGroup[ch]);
+    }
+    else
+    {
+      ScanStats.Errors++;
+    }
+  }
+
+  ScanBank++;
+  if(ScanBank < ScanConfig.Banks)
+  {
+    TSC_Scan_StartBank(ScanBank);
+    return;
+  }
+
+  /* The next cycle acquires while this one is processed */
+  ScanStats.Cycles++;
+  ScanTick = HAL_GetTick();
+  if((ScanMode == TSC_SCAN_MODE_CONTINUOUS) || (ScanCalibration > 1U))
+  {
+    ScanBank = 0U;
+    TSC_Scan_StartBank(0U);
+  }
+  else
+  {
+    TSC_Scan_End();
+  }
+
+  TSC_Scan_Process();
+}
+
+/**
+  * @brief  Process all the channels and sensors of a complete cycle
+  * @retval None
+  */
+static void TSC_Scan_Process(void)
+{
+  const TSC_Scan_SensorTypeDef *psensor;
+  uint32_t ch, s, detected = 0U, head = ScanHead;
+  int32_t delta;
+
+  if(ScanCalibration != 0U)
+  {
+    /* Sum of the counts, then their average in 1/16 of a count */
+    for(ch = 0U; ch < ScanChannels; ch++)
+    {
+      ScanBaseline[ch] += (int32_t)ScanCount[ch];
+    }
+    ScanCalibration--;
+    if(ScanCalibration == 0U)
+    {
+      for(ch = 0U; ch < ScanChannels; ch++)
+      {
+        ScanBaseline[ch] = (ScanBaseline[ch] * 16) / (int32_t)TSC_SCAN_CALIBRATION_CYCLES;
+      }
+      ScanIdleTick = ScanTick;
+      TSC_Scan_Schedule();
+    }
+    return;
+  }
+
+  for(ch = 0U; ch < ScanChannels; ch++)
+  {
+    delta = (ScanBaseline[ch] / 16) - (int32_t)ScanCount[ch];
+    ScanDelta[ch] = (int16_t)delta;
+  }
+
+  for(s = 0U; s < ScanConfig.Sensors; s++)
+  {
+    detected |= TSC_Scan_Sensor(s);
+  }
+
+  /* Baselines follow the drifts of the channels of the sensors at rest */
+  for(ch = 0U; ch < ScanChannels; ch++)
+  {
+    s = ScanSensorOf[ch];
+    if(s != TSC_SCAN_NO_SENSOR)
+    {
+      psensor = &ScanConfig.pSensors[s];
+      if((ScanSensors[s].Touched != 0U) || (ScanSensors[s].Debounce != 0U))
+      {
+        continue;
+      }
+      if((int32_t)ScanDelta[ch] < -(int32_t)psensor->Threshold)
+      {
+        ScanBaseline[ch] = (int32_t)ScanCount[ch] * 16;
+        continue;
+      }
+    }
+    ScanBaseline[ch] += (((int32_t)ScanCount[ch] * 16) - ScanBaseline[ch]) / (1L << TSC_SCAN_BASELINE_SHIFT);
+  }
+
+  /* Low power mode switches on the touches */
+  if(detected != 0U)
+  {
+    ScanIdleTick = ScanTick;
+    if((ScanMode == TSC_SCAN_MODE_TRIGGERED) && (ScanConfig.LowPowerIdle != 0U))
+    {
+      ScanMode = TSC_SCAN_MODE_CONTINUOUS;
+      if(ScanBusy == 0U)
+      {
+        TSC_Scan_Begin();
+      }
+    }
+  }
+  else if((ScanMode == TSC_SCAN_MODE_CONTINUOUS) && (ScanConfig.LowPowerIdle != 0U) &&
+          ((ScanTick - ScanIdleTick) >= ScanConfig.LowPowerIdle))
+  {
+    ScanMode = TSC_SCAN_MODE_TRIGGERED;
+    TSC_Scan_Schedule();
+  }
+
+  if(ScanHead != head)
+  {
+    TSC_Scan_EventCallback();
+  }
+}
+
+/**
+  * @brief  Debounce a sensor and track the position of a slider or wheel
+  * @param  Sensor: sensor number
+  * @retval 1 when the sensor is touched or about to be, 0 otherwise
+  */
+static uint32_t TSC_Scan_Sensor(uint32_t Sensor)
+{
+  const TSC_Scan_SensorTypeDef *psensor = &ScanConfig.pSensors[Sensor];
+  TSC_Scan_SensorStateTypeDef *pstate = &ScanSensors[Sensor];
+  uint32_t k, strongest = 0U, detect;
+  int32_t delta, max = (int32_t)ScanDelta[psensor->Channel[0]];
+  int32_t pos, diff;
+
+  for(k = 1U; k < psensor->Channels; k++)
+  {
+    delta = (int32_t)ScanDelta[psensor->Channel[k]];
+    if(delta > max)
+    {
+      max = delta;
+      strongest = k;
+    }
+  }
+
+  if(pstate->Touched != 0U)
+  {
+    detect = (max > ((int32_t)psensor->Threshold - (int32_t)psensor->Hysteresis)) ? 1U : 0U;
+  }
+  else
+  {
+    detect = (max >= (int32_t)psensor->Threshold) ? 1U : 0U;
+  }
+
+  if(detect != pstate->Touched)
+  {
+    pstate->Debounce++;
+    if(pstate->Debounce >= TSC_SCAN_DEBOUNCE)
+    {
+      pstate->Debounce = 0U;
+      pstate->Touched  = (uint8_t)detect;
+      if(detect != 0U)
+      {
+        pos = (psensor->Type != TSC_SCAN_KEY) ? TSC_Scan_Position(psensor, strongest) : 0;
+        pstate->FiltPos = pos * 16;
+        pstate->LastPos = (uint8_t)pos;
+        ScanTouched |= (1UL << Sensor);
+        TSC_Scan_Push(TSC_SCAN_EVENT_TOUCH, Sensor, (uint32_t)pos, 0, max);
+      }
+      else
+      {
+        ScanTouched &= ~(1UL << Sensor);
+        TSC_Scan_Push(TSC_SCAN_EVENT_RELEASE, Sensor, pstate->LastPos, 0, max);
+      }
+    }
+  }
+  else
+  {
+    pstate->Debounce = 0U;
+  }
+
+  if((pstate->Touched != 0U) && (psensor->Type != TSC_SCAN_KEY))
+  {
+    pos  = TSC_Scan_Position(psensor, strongest) * 16;
+    diff = pos - pstate->FiltPos;
+    if(psensor->Type == TSC_SCAN_WHEEL)
+    {
+      /* Shortest way around the wheel */
+      if(diff >= (128 * 16))
+      {
+        diff -= 256 * 16;
+      }
+      else if(diff < -(128 * 16))
+      {
+        diff += 256 * 16;
+      }
+    }
+    pstate->FiltPos += diff / (1L << TSC_SCAN_POSITION_SHIFT);
+    if(psensor->Type == TSC_SCAN_WHEEL)
+    {
+      pstate->FiltPos &= (256 * 16) - 1;
+    }
+
+    pos  = pstate->FiltPos / 16;
+    diff = pos - (int32_t)pstate->LastPos;
+    if(psensor->Type == TSC_SCAN_WHEEL)
+    {
+      diff = (int32_t)(int8_t)(uint8_t)diff;
+    }
+    else if(diff > 127)
+    {
+      diff = 127;
+    }
+    else if(diff < -127)
+    {
+      diff = -127;
+    }
+    if(TSC_SCAN_ABS(diff) >= (int32_t)TSC_SCAN_MOVE_THRESHOLD)
+    {
+      pstate->LastPos = (uint8_t)pos;
+      TSC_Scan_Push(TSC_SCAN_EVENT_MOVE, Sensor, (uint32_t)pos, diff, max);
+    }
+  }
+
+  return ((pstate->Touched != 0U) || (detect != 0U)) ? 1U : 0U;
+}
+
+/**
+  * @brief  Position of a slider or wheel: centroid of the strongest
+  *         electrode and its neighbours
+  * @param  pSensor: slider or wheel
+  * @param  Strongest: electrode with the largest decrease
+  * @retval 0 to 255
+  */
+static int32_t TSC_Scan_Position(const TSC_Scan_SensorTypeDef *pSensor, uint32_t Strongest)
+{
+  uint32_t n = pSensor->Channels;
+  int32_t lo = 0, hi = 0, mid, sum, centroid;
+
+  mid = (int32_t)ScanDelta[pSensor->Channel[Strongest]];
+  if(Strongest > 0U)
+  {
+    lo = (int32_t)ScanDelta[pSensor->Channel[Strongest - 1U]];
+  }
+  else if(pSensor->Type == TSC_SCAN_WHEEL)
+  {
+    lo = (int32_t)ScanDelta[pSensor->Channel[n - 1U]];
+  }
+  if(Strongest < (n - 1U))
+  {
+    hi = (int32_t)ScanDelta[pSensor->Channel[Strongest + 1U]];
+  }
+  else if(pSensor->Type == TSC_SCAN_WHEEL)
+  {
+    hi = (int32_t)ScanDelta[pSensor->Channel[0]];
+  }
+  lo  = (lo < 0) ? 0 : lo;
+  hi  = (hi < 0) ? 0 : hi;
+  mid = (mid < 0) ? 0 : mid;
+
+  /* Position along the electrodes, 1/256 of an electrode pitch */
+  sum = lo + mid + hi;
+  centroid = (int32_t)Strongest * 256;
+  if(sum != 0)
+  {
+    centroid += ((hi - lo) * 256) / sum;
+  }
+
+  if(pSensor->Type == TSC_SCAN_WHEEL)
+  {
+    /* n electrodes around a turn, the last one next to the first */
+    if(centroid < 0)
+    {
+      centroid += (int32_t)n * 256;
+    }
+    return (centroid / (int32_t)n) & 0xFF;
+  }
+
+  centroid = (centroid * 255) / (((int32_t)n - 1) * 256);
+  if(centroid < 0)
+  {
+    centroid = 0;
+  }
+  else if(centroid > 255)
+  {
+    centroid = 255;
+  }
+  return centroid;
+}
+
+/**
+  * @brief  Queue an event
+  * @param  Type: TSC_SCAN_EVENT_xxx
+  * @param  Sensor: sensor number
+  * @param  Position: position, 0 for a key
+  * @param  Move: position change
+  * @param  Delta: decrease of the strongest channel
+  * @retval None
+  */
+static void TSC_Scan_Push(uint32_t Type, uint32_t Sensor, uint32_t Position, int32_t Move, int32_t Delta)
+{
+  TSC_Scan_EventTypeDef *pevent;
+  uint32_t head = ScanHead;
+
+  if((head - ScanTail) >= TSC_SCAN_QUEUE_SIZE)
+  {
+    ScanStats.Overruns++;
+    return;
+  }
+
+  pevent = &ScanEvents[head & (TSC_SCAN_QUEUE_SIZE - 1U)];
+  pevent->Tick     = ScanTick;
+  pevent->Type     = (uint8_t)Type;
+  pevent->Sensor   = (uint8_t)Sensor;
+  pevent->Position = (uint8_t)Position;
+  pevent->Move     = (int8_t)Move;
+  pevent->Delta    = (int16_t)((Delta > 32767) ? 32767 : Delta);
+
+  /* The event is complete before the reader sees it */
+  __DMB();
+  ScanHead = head + 1U;
+  ScanStats.Events++;
+}
+
+/**
+  * @brief  Program the next low power cycle, with TSC_SCAN_USE_TIMEBASE
+  * @retval None
+  */
+static void TSC_Scan_Schedule(void)
+{
+#if defined(TSC_SCAN_USE_TIMEBASE)
+  if((ScanEnabled != 0U) && (ScanMode == TSC_SCAN_MODE_TRIGGERED) && (ScanConfig.LowPowerPeriod != 0U))
+  {
+    (void)TIMEBASE_SetAlarm(TIMEBASE_GetUs() + ((uint64_t)ScanConfig.LowPowerPeriod * 1000U));
+  }
+#endif /* TSC_SCAN_USE_TIMEBASE */
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,956 @@
+/**
+  ******************************************************************************
+  * @file    frame_link.c
+  * @author  MCD Application Team
+  * @brief   Framed link over LPUART or SWPMI, DMA reception and validated frame queue
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- LPUART transport: initialize the LPUART (or a USART) with
+   HAL_UART_Init() and link a DMA channel to each direction: hdmarx in
+   circular mode, hdmatx in normal mode, byte transfers. The frames are
+   delimited by an idle line: the receiver closes a frame at the IDLE event
+   of the reception to idle, the transmitter sends an idle character ahead
+   of each frame. A CRC-16/CCITT (polynomial 0x1021, initial value 0xFFFF)
+   follows the payload, MSB first. It is computed by the CRC unit when hcrc
+   is given, initialized with :
+     DefaultPolynomialUse    = DEFAULT_POLYNOMIAL_DISABLE
+     DefaultInitValueUse     = DEFAULT_INIT_VALUE_ENABLE
+     GeneratingPolynomial    = 0x1021
+     CRCLength               = CRC_POLYLENGTH_16B
+     InputDataInversionMode  = CRC_INPUTDATA_INVERSION_NONE
+     OutputDataInversionMode = CRC_OUTPUTDATA_INVERSION_DISABLE
+     InputDataFormat         = CRC_INPUTDATA_FORMAT_BYTES
+   and by FRAME_Link_Crc16() otherwise.
+
+2- SWPMI transport: initialize the SWPMI with HAL_SWPMI_Init(),
+   RxBufferingMode = SWPMI_RX_MULTI_SOFTWAREBUFFER, and link a DMA channel
+   to each direction: hdmarx in circular mode, hdmatx in normal mode, word
+   transfers. Call FRAME_Link_SWPMI_IRQHandler() from the SWPMI interrupt
+   handler in place of HAL_SWPMI_IRQHandler(). The SWPMI checks the CRC of
+   the frames itself and carries FRAME_LINK_SWPMI_MAX_PAYLOAD bytes per
+   frame at most.
+
+3- FRAME_Link_Init() takes the transport and the reception ring, a few
+   frames long, and FRAME_Link_Start() starts the circular reception: the
+   DMA fills the ring on its own and the CPU only runs at the end of a frame
+   (IDLE event, SWPMI end of frame), or at the half and full ring events of
+   a long LPUART frame, to check the frame and copy it in RxQueue.
+   FRAME_Link_RxCallback() is called from the interrupt for each frame
+   validated: the only callback of the module. The frames with a wrong CRC
+   or length, or not fitting in RxQueue, are counted and dropped.
+
+4- the application reads the frames in place with FRAME_Link_Peek() and
+   gives each one back with FRAME_Link_Release(). FRAME_Link_Send() copies
+   a frame in TxQueue and returns HAL_BUSY when it is full; the DMA sends
+   the queued frames one after the other.
+
+5- low power: with StopWake, the LPUART wakes the device up from Stop on the
+   start bit of a frame. Its kernel clock must then be the LSE or the HSI16,
+   and the wake up time shorter than a character. With power_mgr, define
+   FRAME_LINK_USE_POWER_MGR in main.h: the link holds a PWR_MGR_MODE_SLEEP
+   lock from the start of a frame received to its end and while frames are
+   sent, and a PWR_MGR_MODE_STOP1 lock between frames when the UART is not
+   LPUART1, the only one running in Stop 2. Without StopWake, and with the
+   SWPMI which does not receive in Stop, the PWR_MGR_MODE_SLEEP lock is
+   held while the link runs.
+
+6- this module implements HAL_UARTEx_RxEventCallback(),
+   HAL_UART_TxCpltCallback(), HAL_UART_ErrorCallback(),
+   HAL_UARTEx_WakeupCallback(), HAL_SWPMI_TxCpltCallback() and
+   HAL_SWPMI_ErrorCallback(), filtered on the handles of the links.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "frame_link.h"
+#include <string.h>
+#if defined(FRAME_LINK_USE_POWER_MGR)
+#include "power_mgr.h"
+#endif
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define FRAME_LINK_STATE_RESET    0U
+#define FRAME_LINK_STATE_READY    1U
+#define FRAME_LINK_STATE_RUNNING  2U
+
+/* Frame being received dropped, LPUART */
+#define FRAME_LINK_DISCARD_NONE   0U
+#define FRAME_LINK_DISCARD_FULL   1U  /* RxQueue full            */
+#define FRAME_LINK_DISCARD_LENGTH 2U  /* Longer than FRAME_LINK_MAX_PAYLOAD */
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static FRAME_LinkTypeDef *Links[FRAME_LINK_MAX_INSTANCES];
+
+/* CRC-16/CCITT of the 16 values of a nibble */
+static const uint16_t CrcNibble[16] =
+{
+  0x0000U, 0x1021U, 0x2042U, 0x3063U, 0x4084U, 0x50A5U, 0x60C6U, 0x70E7U,
+  0x8108U, 0x9129U, 0xA14AU, 0xB16BU, 0xC18CU, 0xD1ADU, 0xE1CEU, 0xF1EFU
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static FRAME_LinkTypeDef *FRAME_Link_Find(const void *Handle);
+static uint32_t FRAME_Link_Crc(FRAME_LinkTypeDef *pLink, const uint8_t *pData, uint32_t Length);
+static void FRAME_Link_Publish(FRAME_LinkTypeDef *pLink);
+static void FRAME_Link_StartTx(FRAME_LinkTypeDef *pLink);
+static void FRAME_Link_EndTx(FRAME_LinkTypeDef *pLink, uint32_t Sent);
+static void FRAME_Link_Power(FRAME_LinkTypeDef *pLink);
+#if defined(HAL_UART_MODULE_ENABLED)
+static HAL_StatusTypeDef FRAME_Link_UartReceive(FRAME_LinkTypeDef *pLink);
+static void FRAME_Link_Append(FRAME_LinkTypeDef *pLink, const uint8_t *pData, uint32_t Length);
+static void FRAME_Link_EndFrame(FRAME_LinkTypeDef *pLink);
+#endif
+#if defined(FRAME_LINK_USE_SWPMI)
+static HAL_StatusTypeDef FRAME_Link_SwpmiReceive(FRAME_LinkTypeDef *pLink);
+static void FRAME_Link_Store(FRAME_LinkTypeDef *pLink, uint32_t Length);
+#endif
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Bind a link to its transport
+  * @param  pLink: link context, kept by the module
+  * @param  pConfig: transport and reception ring, copied
+  * @retval HAL status
+  */
+HAL_StatusTypeDef FRAME_Link_Init(FRAME_LinkTypeDef *pLink, const FRAME_Link_ConfigTypeDef *pConfig)
+{
+  uint32_t slot = FRAME_LINK_MAX_INSTANCES;
+  uint32_t valid = 0U;
+  uint32_t i;
+
+  if ((pLink == NULL) || (pConfig == NULL) || (pConfig->pRing == NULL) ||
+      (pConfig->RingSize == 0U) || ((pConfig->RingSize & 3U) != 0U) || (pConfig->RingSize > 0xFFFCU))
+  {
+    return HAL_ERROR;
+  }
+#if defined(HAL_UART_MODULE_ENABLED)
+  if ((pConfig->Transport == FRAME_LINK_LPUART) && (pConfig->huart != NULL) &&
+      (pConfig->huart->hdmarx != NULL) && (pConfig->huart->hdmatx != NULL))
+  {
+    valid = 1U;
+  }
+#endif
+#if defined(FRAME_LINK_USE_SWPMI)
+  if ((pConfig->Transport == FRAME_LINK_SWPMI) && (pConfig->hswpmi != NULL) &&
+      (pConfig->hswpmi->hdmarx != NULL) && (pConfig->hswpmi->hdmatx != NULL))
+  {
+    valid = 1U;
+  }
+#endif
+  if (valid == 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  for (i = 0U; i < FRAME_LINK_MAX_INSTANCES; i++)
+  {
+    if (Links[i] == pLink)
+    {
+      return HAL_ERROR;
+    }
+    if ((Links[i] == NULL) && (slot == FRAME_LINK_MAX_INSTANCES))
+    {
+      slot = i;
+    }
+  }
+  if (slot == FRAME_LINK_MAX_INSTANCES)
+  {
+    return HAL_ERROR;
+  }
+
+  memset(pLink, 0, sizeof(FRAME_LinkTypeDef));
+  pLink->Config = *pConfig;
+  pLink->Slot   = slot;
+  pLink->State  = FRAME_LINK_STATE_READY;
+  Links[slot]   = pLink;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop a link and release its slot
+  * @param  pLink: link context
+  * @retval HAL status
+  */
+HAL_StatusTypeDef FRAME_Link_DeInit(FRAME_LinkTypeDef *pLink)
+{
+  if ((pLink == NULL) || (pLink->State == FRAME_LINK_STATE_RESET) || (Links[pLink->Slot] != pLink))
+  {
+    return HAL_ERROR;
+  }
+  if (pLink->State == FRAME_LINK_STATE_RUNNING)
+  {
+    (void)FRAME_Link_Stop(pLink);
+  }
+  Links[pLink->Slot] = NULL;
+  pLink->State = FRAME_LINK_STATE_RESET;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Start the circular reception of a link, queues emptied
+  * @param  pLink: link context
+  * @retval HAL status
+  */
+HAL_StatusTypeDef FRAME_Link_Start(FRAME_LinkTypeDef *pLink)
+{
+  HAL_StatusTypeDef status = HAL_ERROR;
+#if defined(HAL_UART_MODULE_ENABLED)
+  UART_WakeUpTypeDef wakeup;
+#endif
+
+  if ((pLink == NULL) || (pLink->State != FRAME_LINK_STATE_READY))
+  {
+    return HAL_ERROR;
+  }
+
+  pLink->RxHead    = 0U;
+  pLink->RxTail    = 0U;
+  pLink->RxLength  = 0U;
+  pLink->RxDiscard = FRAME_LINK_DISCARD_NONE;
+  pLink->RxActive  = 0U;
+  pLink->TxHead    = 0U;
+  pLink->TxTail    = 0U;
+  pLink->TxBusy    = 0U;
+  pLink->State     = FRAME_LINK_STATE_RUNNING;
+
+#if defined(HAL_UART_MODULE_ENABLED)
+  if (pLink->Config.Transport == FRAME_LINK_LPUART)
+  {
+    status = HAL_OK;
+    if (pLink->Config.StopWake != 0U)
+    {
+      /* Wake up on the start bit: the first character of the frame is
+         received once the clocks are back */
+      wakeup.WakeUpEvent = UART_WAKEUP_ON_STARTBIT;
+      status = HAL_UARTEx_StopModeWakeUpSourceConfig(pLink->Config.huart, wakeup);
+      if (status == HAL_OK)
+      {
+        __HAL_UART_ENABLE_IT(pLink->Config.huart, UART_IT_WUF);
+        status = HAL_UARTEx_EnableStopMode(pLink->Config.huart);
+      }
+    }
+    if (status == HAL_OK)
+    {
+      status = FRAME_Link_UartReceive(pLink);
+    }
+  }
+#endif
+#if defined(FRAME_LINK_USE_SWPMI)
+  if (pLink->Config.Transport == FRAME_LINK_SWPMI)
+  {
+    status = FRAME_Link_SwpmiReceive(pLink);
+  }
+#endif
+
+  if (status != HAL_OK)
+  {
+    (void)FRAME_Link_Stop(pLink);
+    return HAL_ERROR;
+  }
+  FRAME_Link_Power(pLink);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop a link: reception aborted, frames not sent dropped
+  * @param  pLink: link context
+  * @retval HAL status
+  */
+HAL_StatusTypeDef FRAME_Link_Stop(FRAME_LinkTypeDef *pLink)
+{
+  if ((pLink == NULL) || (pLink->State != FRAME_LINK_STATE_RUNNING))
+  {
+    return HAL_ERROR;
+  }
+  pLink->State = FRAME_LINK_STATE_READY;
+
+#if defined(HAL_UART_MODULE_ENABLED)
+  if (pLink->Config.Transport == FRAME_LINK_LPUART)
+  {
+    (void)HAL_UART_Abort(pLink->Config.huart);
+    if (pLink->Config.StopWake != 0U)
+    {
+      __HAL_UART_DISABLE_IT(pLink->Config.huart, UART_IT_WUF);
+      (void)HAL_UARTEx_DisableStopMode(pLink->Config.huart);
+    }
+  }
+#endif
+#if defined(FRAME_LINK_USE_SWPMI)
+  if (pLink->Config.Transport == FRAME_LINK_SWPMI)
+  {
+    __HAL_SWPMI_DISABLE_IT(pLink->Config.hswpmi, SWPMI_IT_RXBFIE);
+    (void)HAL_SWPMI_DMAStop(pLink->Config.hswpmi);
+  }
+#endif
+
+  pLink->TxTail   = pLink->TxHead;
+  pLink->TxBusy   = 0U;
+  pLink->RxActive = 0U;
+  FRAME_Link_Power(pLink);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Queue a frame for transmission
+  * @param  pLink: link context
+  * @param  pData: payload, copied
+  * @param  Length: payload bytes, from 1 to FRAME_LINK_MAX_PAYLOAD
+  *         (FRAME_LINK_SWPMI_MAX_PAYLOAD on the SWPMI)
+  * @retval HAL_OK, HAL_BUSY when TxQueue is full, HAL_ERROR
+  */
+HAL_StatusTypeDef FRAME_Link_Send(FRAME_LinkTypeDef *pLink, const uint8_t *pData, uint32_t Length)
+{
+  FRAME_Link_FrameTypeDef *frame;
+  uint32_t primask;
+  uint32_t crc;
+
+  if ((pLink == NULL) || (pData == NULL) || (Length == 0U) || (Length > FRAME_LINK_MAX_PAYLOAD) ||
+      ((pLink->Config.Transport == FRAME_LINK_SWPMI) && (Length > FRAME_LINK_SWPMI_MAX_PAYLOAD)))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Masked: senders from several contexts, and the CRC unit shared with the
+     reception */
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (pLink->State != FRAME_LINK_STATE_RUNNING)
+  {
+    __set_PRIMASK(primask);
+    return HAL_ERROR;
+  }
+  if ((pLink->TxHead - pLink->TxTail) >= FRAME_LINK_TX_FRAMES)
+  {
+    __set_PRIMASK(primask);
+    return HAL_BUSY;
+  }
+
+  frame = &pLink->TxQueue[pLink->TxHead % FRAME_LINK_TX_FRAMES];
+  if (pLink->Config.Transport == FRAME_LINK_SWPMI)
+  {
+    /* First byte written to the SWPMI: number of bytes of the frame */
+    frame->Data[0] = (uint8_t)Length;
+    memcpy(&frame->Data[1], pData, Length);
+    frame->Length = Length + 1U;
+  }
+  else
+  {
+    memcpy(frame->Data, pData, Length);
+    crc = FRAME_Link_Crc(pLink, frame->Data, Length);
+    frame->Data[Length]      = (uint8_t)(crc >> 8);
+    frame->Data[Length + 1U] = (uint8_t)crc;
+    frame->Length = Length + FRAME_LINK_CRC_SIZE;
+  }
+  pLink->TxHead++;
+  FRAME_Link_StartTx(pLink);
+  __set_PRIMASK(primask);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Oldest frame received, left in RxQueue up to FRAME_Link_Release()
+  * @param  pLink: link context
+  * @param  pLength: payload bytes of the frame
+  * @retval Payload, NULL when no frame is pending
+  */
+const uint8_t *FRAME_Link_Peek(FRAME_LinkTypeDef *pLink, uint32_t *pLength)
+{
+  FRAME_Link_FrameTypeDef *frame;
+
+  if ((pLink == NULL) || (pLink->RxHead == pLink->RxTail))
+  {
+    return NULL;
+  }
+  frame = &pLink->RxQueue[pLink->RxTail % FRAME_LINK_RX_FRAMES];
+  if (pLength != NULL)
+  {
+    *pLength = frame->Length;
+  }
+
+  return frame->Data;
+}
+
+/**
+  * @brief  Give the frame of FRAME_Link_Peek() back to the reception
+  * @param  pLink: link context
+  * @retval None
+  */
+void FRAME_Link_Release(FRAME_LinkTypeDef *pLink)
+{
+  if ((pLink != NULL) && (pLink->RxHead != pLink->RxTail))
+  {
+    /* Frame read before its slot is given back */
+    __DMB();
+    pLink->RxTail++;
+  }
+}
+
+/**
+  * @brief  Frames received and not released
+  * @param  pLink: link context
+  * @retval Number of frames
+  */
+uint32_t FRAME_Link_GetPending(FRAME_LinkTypeDef *pLink)
+{
+  return (pLink != NULL) ? (pLink->RxHead - pLink->RxTail) : 0U;
+}
+
+/**
+  * @brief  CRC-16/CCITT (polynomial 0x1021, initial value 0xFFFF) by software.
+  *         Over a frame followed by its CRC, MSB first, the result is 0.
+  * @param  pData: bytes
+  * @param  Length: number of bytes
+  * @retval CRC
+  */
+uint16_t FRAME_Link_Crc16(const uint8_t *pData, uint32_t Length)
+{
+  uint32_t crc = 0xFFFFU;
+
+  while (Length-- != 0U)
+  {
+    crc = (crc << 4) ^ CrcNibble[((crc >> 12) ^ ((uint32_t)*pData >> 4)) & 0x0FU];
+    crc = (crc << 4) ^ CrcNibble[((crc >> 12) ^ (uint32_t)*pData) & 0x0FU];
+    crc &= 0xFFFFU;
+    pData++;
+  }
+
+  return (uint16_t)crc;
+}
+
+#if defined(FRAME_LINK_USE_SWPMI)
+/**
+  * @brief  SWPMI interrupt of a link, in place of HAL_SWPMI_IRQHandler()
+  * @param  pLink: link context
+  * @retval None
+  */
+void FRAME_Link_SWPMI_IRQHandler(FRAME_LinkTypeDef *pLink)
+{
+  SWPMI_HandleTypeDef *hswpmi = pLink->Config.hswpmi;
+  uint32_t isr = READ_REG(hswpmi->Instance->ISR);
+  uint32_t head;
+
+  if (((isr & (SWPMI_FLAG_RXBFF | SWPMI_FLAG_RXBERF)) != 0U) && (pLink->State == FRAME_LINK_STATE_RUNNING))
+  {
+    /* End of frame: the frame spans the ring from RxOffset up to the DMA,
+       whatever the padding of the software buffer mode */
+    head = pLink->Config.RingSize - (__HAL_DMA_GET_COUNTER(hswpmi->hdmarx) * 4U);
+    if (head == pLink->Config.RingSize)
+    {
+      head = 0U;
+    }
+    if ((isr & SWPMI_FLAG_RXBERF) != 0U)
+    {
+      pLink->CrcErrors++;
+    }
+    else
+    {
+      FRAME_Link_Store(pLink, READ_REG(hswpmi->Instance->RFL) & SWPMI_RFL_RFL);
+    }
+    pLink->RxOffset = head;
+    /* Handled here: the HAL would abort the reception on a CRC error */
+    __HAL_SWPMI_CLEAR_FLAG(hswpmi, SWPMI_FLAG_RXBFF | SWPMI_FLAG_RXBERF);
+  }
+
+  /* Overrun, underrun and transmission: HAL, errors back through
+     HAL_SWPMI_ErrorCallback() */
+  HAL_SWPMI_IRQHandler(hswpmi);
+}
+#endif /* FRAME_LINK_USE_SWPMI */
+
+/**
+  * @brief  Frame received, validated and queued
+  * @param  pLink: link context
+  * @note   Called from the interrupt. Read the frame with FRAME_Link_Peek().
+  * @retval None
+  */
+__weak void FRAME_Link_RxCallback(FRAME_LinkTypeDef *pLink)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(pLink);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the FRAME_Link_RxCallback could be implemented in the user file
+   */
+}
+
+#if defined(HAL_UART_MODULE_ENABLED)
+/**
+  * @brief  Reception event of a LPUART link: ring half, ring end or idle line
+  * @param  huart: UART handle
+  * @param  Offset: first byte in the ring
+  * @param  Length: number of bytes
+  * @retval None
+  */
+void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Offset, uint16_t Length)
+{
+  FRAME_LinkTypeDef *pLink = FRAME_Link_Find(huart);
+
+  if ((pLink == NULL) || (pLink->State != FRAME_LINK_STATE_RUNNING))
+  {
+    return;
+  }
+
+  FRAME_Link_Append(pLink, (const uint8_t *)pLink->Config.pRing + Offset, Length);
+
+  /* An idle window wrapping around the ring comes in two calls: the frame
+     ends with the second one, which reaches the next offset */
+  if ((HAL_UARTEx_GetRxEventType(huart) == HAL_UART_RXEVENT_IDLE) &&
+      ((((uint32_t)Offset + Length) % pLink->Config.RingSize) == huart->RxEventOffset))
+  {
+    FRAME_Link_EndFrame(pLink);
+  }
+  else if (pLink->RxActive == 0U)
+  {
+    pLink->RxActive = 1U;
+    FRAME_Link_Power(pLink);
+  }
+}
+
+/**
+  * @brief  Frame sent on a LPUART link
+  * @param  huart: UART handle
+  * @retval None
+  */
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+{
+  FRAME_LinkTypeDef *pLink = FRAME_Link_Find(huart);
+
+  if ((pLink != NULL) && (pLink->TxBusy != 0U))
+  {
+    FRAME_Link_EndTx(pLink, 1U);
+  }
+}
+
+/**
+  * @brief  Error of a LPUART link: the frame being received is lost and the
+  *         reception restarted, the frame being sent is dropped
+  * @param  huart: UART handle
+  * @retval None
+  */
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
+{
+  FRAME_LinkTypeDef *pLink = FRAME_Link_Find(huart);
+
+  if ((pLink == NULL) || (pLink->State != FRAME_LINK_STATE_RUNNING))
+  {
+    return;
+  }
+  pLink->Errors++;
+
+  /* A DMA reception is aborted on any error */
+  if (huart->RxState == HAL_UART_STATE_READY)
+  {
+    pLink->RxLength  = 0U;
+    pLink->RxDiscard = FRAME_LINK_DISCARD_NONE;
+    pLink->RxActive  = 0U;
+    (void)FRAME_Link_UartReceive(pLink);
+  }
+  if ((pLink->TxBusy != 0U) && (huart->gState == HAL_UART_STATE_READY))
+  {
+    FRAME_Link_EndTx(pLink, 0U);
+  }
+  FRAME_Link_Power(pLink);
+}
+
+/**
+  * @brief  Start bit of a frame woke the device up
+  * @param  huart: UART handle
+  * @retval None
+  */
+void HAL_UARTEx_WakeupCallback(UART_HandleTypeDef *huart)
+{
+  FRAME_LinkTypeDef *pLink = FRAME_Link_Find(huart);
+
+  if ((pLink != NULL) && (pLink->State == FRAME_LINK_STATE_RUNNING))
+  {
+    pLink->RxActive = 1U;
+    FRAME_Link_Power(pLink);
+  }
+}
+#endif /* HAL_UART_MODULE_ENABLED */
+
+#if defined(FRAME_LINK_USE_SWPMI)
+/**
+  * @brief  Frame sent on a SWPMI link
+  * @param  hswpmi: SWPMI handle
+  * @retval None
+  */
+void HAL_SWPMI_TxCpltCallback(SWPMI_HandleTypeDef *hswpmi)
+{
+  FRAME_LinkTypeDef *pLink = FRAME_Link_Find(hswpmi);
+
+  if ((pLink != NULL) && (pLink->TxBusy != 0U))
+  {
+    FRAME_Link_EndTx(pLink, 1U);
+  }
+}
+
+/**
+  * @brief  Overrun, underrun or DMA error of a SWPMI link: the HAL aborted
+  *         a direction, both are restarted and the frame being sent dropped
+  * @param  hswpmi: SWPMI handle
+  * @retval None
+  */
+void HAL_SWPMI_ErrorCallback(SWPMI_HandleTypeDef *hswpmi)
+{
+  FRAME_LinkTypeDef *pLink = FRAME_Link_Find(hswpmi);
+
+  if ((pLink == NULL) || (pLink->State != FRAME_LINK_STATE_RUNNING))
+  {
+    return;
+  }
+  pLink->Errors++;
+
+  (void)HAL_SWPMI_DMAStop(hswpmi);
+  (void)FRAME_Link_SwpmiReceive(pLink);
+  if (pLink->TxBusy != 0U)
+  {
+    FRAME_Link_EndTx(pLink, 0U);
+  }
+}
+#endif /* FRAME_LINK_USE_SWPMI */
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Link of a UART or SWPMI handle
+  * @param  Handle: HAL handle
+  * @retval Link context, NULL when the handle has no link
+  */
+static FRAME_LinkTypeDef *FRAME_Link_Find(const void *Handle)
+{
+  FRAME_LinkTypeDef *link;
+  uint32_t i;
+
+  for (i = 0U; i < FRAME_LINK_MAX_INSTANCES; i++)
+  {
+    link = Links[i];
+    if (link == NULL)
+    {
+      continue;
+    }
+#if defined(HAL_UART_MODULE_ENABLED)
+    if ((link->Config.Transport == FRAME_LINK_LPUART) && ((const void *)link->Config.huart == Handle))
+    {
+      return link;
+    }
+#endif
+#if defined(FRAME_LINK_USE_SWPMI)
+    if ((link->Config.Transport == FRAME_LINK_SWPMI) && ((const void *)link->Config.hswpmi == Handle))
+    {
+      return link;
+    }
+#endif
+  }
+
+  return NULL;
+}
+
+/**
+  * @brief  CRC-16/CCITT of a LPUART frame, by the CRC unit when given
+  * @param  pLink: link context
+  * @param  pData: bytes
+  * @param  Length: number of bytes
+  * @retval CRC
+  */
+static uint32_t FRAME_Link_Crc(FRAME_LinkTypeDef *pLink, const uint8_t *pData, uint32_t Length)
+{
+#if defined(HAL_CRC_MODULE_ENABLED)
+  if (pLink->Config.hcrc != NULL)
+  {
+    return HAL_CRC_Calculate(pLink->Config.hcrc, (uint32_t *)(uint32_t)pData, Length) & 0xFFFFU;
+  }
+#else
+  UNUSED(pLink);
+#endif
+
+  return FRAME_Link_Crc16(pData, Length);
+}
+
+/**
+  * @brief  Hand the frame RxQueue[RxHead] over to the application
+  * @param  pLink: link context
+  * @retval None
+  */
+static void FRAME_Link_Publish(FRAME_LinkTypeDef *pLink)
+{
+  /* Frame written before it is seen by FRAME_Link_Peek() */
+  __DMB();
+  pLink->RxHead++;
+  pLink->RxFrames++;
+  FRAME_Link_RxCallback(pLink);
+}
+
+/**
+  * @brief  Send the frame TxQueue[TxTail] when the transmitter is free.
+  *         Interrupts masked or from the interrupt of the link.
+  * @param  pLink: link context
+  * @retval None
+  */
+static void FRAME_Link_StartTx(FRAME_LinkTypeDef *pLink)
+{
+  FRAME_Link_FrameTypeDef *frame;
+  HAL_StatusTypeDef status = HAL_ERROR;
+
+  if ((pLink->TxBusy != 0U) || (pLink->TxHead == pLink->TxTail) ||
+      (pLink->State != FRAME_LINK_STATE_RUNNING))
+  {
+    return;
+  }
+  frame = &pLink->TxQueue[pLink->TxTail % FRAME_LINK_TX_FRAMES];
+  pLink->TxBusy = 1U;
+  FRAME_Link_Power(pLink);
+
+#if defined(HAL_UART_MODULE_ENABLED)
+  if (pLink->Config.Transport == FRAME_LINK_LPUART)
+  {
+    /* Enabling the transmitter sends an idle character, which closes the
+       previous frame at the receiver */
+    CLEAR_BIT(pLink->Config.huart->Instance->CR1, USART_CR1_TE);
+    SET_BIT(pLink->Config.huart->Instance->CR1, USART_CR1_TE);
+    status = HAL_UART_Transmit_DMA(pLink->Config.huart, frame->Data, (uint16_t)frame->Length);
+  }
+#endif
+#if defined(FRAME_LINK_USE_SWPMI)
+  if (pLink->Config.Transport == FRAME_LINK_SWPMI)
+  {
+    status = HAL_SWPMI_Transmit_DMA(pLink->Config.hswpmi, (uint32_t *)(uint32_t)frame->Data,
+                                    (uint16_t)((frame->Length + 3U) / 4U));
+  }
+#endif
+
+  if (status != HAL_OK)
+  {
+    pLink->Errors++;
+    FRAME_Link_EndTx(pLink, 0U);
+  }
+}
+
+/**
+  * @brief  End of the frame TxQueue[TxTail], next frame started
+  * @param  pLink: link context
+  * @param  Sent: 1 when the frame was sent, 0 when dropped
+  * @retval None
+  */
+static void FRAME_Link_EndTx(FRAME_LinkTypeDef *pLink, uint32_t Sent)
+{
+  pLink->TxTail++;
+  pLink->TxBusy = 0U;
+  if (Sent != 0U)
+  {
+    pLink->TxFrames++;
+  }
+  FRAME_Link_StartTx(pLink);
+  FRAME_Link_Power(pLink);
+}
+
+/**
+  * @brief  Deepest low power mode allowed to a link, in power_mgr
+  * @param  pLink: link context
+  * @retval None
+  */
+static void FRAME_Link_Power(FRAME_LinkTypeDef *pLink)
+{
+#if defined(FRAME_LINK_USE_POWER_MGR)
+  uint32_t id = FRAME_LINK_PWR_LOCK - pLink->Slot;
+
+  if (pLink->State != FRAME_LINK_STATE_RUNNING)
+  {
+    PWR_Mgr_Unlock(id);
+  }
+  else if ((pLink->RxActive != 0U) || (pLink->TxBusy != 0U) ||
+           (pLink->Config.Transport != FRAME_LINK_LPUART) || (pLink->Config.StopWake == 0U))
+  {
+    (void)PWR_Mgr_Lock(id, PWR_MGR_MODE_SLEEP);
+  }
+  else if (pLink->Config.huart->Instance != LPUART1)
+  {
+    (void)PWR_Mgr_Lock(id, PWR_MGR_MODE_STOP1);
+  }
+  else
+  {
+    PWR_Mgr_Unlock(id);
+  }
+#else
+  UNUSED(pLink);
+#endif
+}
+
+#if defined(HAL_UART_MODULE_ENABLED)
+/**
+  * @brief  Start the circular reception to idle of a LPUART link
+  * @param  pLink: link context
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef FRAME_Link_UartReceive(FRAME_LinkTypeDef *pLink)
+{
+  return HAL_UARTEx_ReceiveToIdle_DMA(pLink->Config.huart, (uint8_t *)pLink->Config.pRing,
+                                      (uint16_t)pLink->Config.RingSize);
+}
+
+/**
+  * @brief  Bytes of the LPUART frame being received, copied in RxQueue
+  * @param  pLink: link context
+  * @param  pData: bytes in the ring
+  * @param  Length: number of bytes
+  * @retval None
+  */
+static void FRAME_Link_Append(FRAME_LinkTypeDef *pLink, const uint8_t *pData, uint32_t Length)
+{
+  if (pLink->RxDiscard == FRAME_LINK_DISCARD_NONE)
+  {
+    if ((pLink->RxHead - pLink->RxTail) >= FRAME_LINK_RX_FRAMES)
+    {
+      pLink->RxDiscard = FRAME_LINK_DISCARD_FULL;
+    }
+    else if ((pLink->RxLength + Length) > (FRAME_LINK_MAX_PAYLOAD + FRAME_LINK_CRC_SIZE))
+    {
+      pLink->RxDiscard = FRAME_LINK_DISCARD_LENGTH;
+    }
+    else
+    {
+      memcpy(&pLink->RxQueue[pLink->RxHead % FRAME_LINK_RX_FRAMES].Data[pLink->RxLength], pData, Length);
+    }
+  }
+  pLink->RxLength += Length;
+}
+
+/**
+  * @brief  Idle line: check the LPUART frame received and queue it
+  * @param  pLink: link context
+  * @retval None
+  */
+static void FRAME_Link_EndFrame(FRAME_LinkTypeDef *pLink)
+{
+  FRAME_Link_FrameTypeDef *frame = &pLink->RxQueue[pLink->RxHead % FRAME_LINK_RX_FRAMES];
+
+  if (pLink->RxLength != 0U)
+  {
+    if (pLink->RxDiscard == FRAME_LINK_DISCARD_FULL)
+    {
+      pLink->Dropped++;
+    }
+    else if ((pLink->RxDiscard == FRAME_LINK_DISCARD_LENGTH) || (pLink->RxLength <= FRAME_LINK_CRC_SIZE))
+    {
+      pLink->LengthErrors++;
+    }
+    else if (FRAME_Link_Crc(pLink, frame->Data, pLink->RxLength) != 0U)
+    {
+      /* The CRC over the payload and its CRC is 0 */
+      pLink->CrcErrors++;
+    }
+    else
+    {
+      frame->Length = pLink->RxLength - FRAME_LINK_CRC_SIZE;
+      FRAME_Link_Publish(pLink);
+    }
+  }
+
+  pLink->RxLength  = 0U;
+  pLink->RxDiscard = FRAME_LINK_DISCARD_NONE;
+  pLink->RxActive  = 0U;
+  FRAME_Link_Power(pLink);
+}
+#endif /* HAL_UART_MODULE_ENABLED */
+
+#if defined(FRAME_LINK_USE_SWPMI)
+/**
+  * @brief  Start the circular reception of a SWPMI link, one interrupt per
+  *         frame
+  * @param  pLink: link context
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef FRAME_Link_SwpmiReceive(FRAME_LinkTypeDef *pLink)
+{
+  pLink->RxOffset = 0U;
+  if (HAL_SWPMI_Receive_DMA(pLink->Config.hswpmi, pLink->Config.pRing,
+                            (uint16_t)(pLink->Config.RingSize / 4U)) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+  __HAL_SWPMI_ENABLE_IT(pLink->Config.hswpmi, SWPMI_IT_RXBFIE);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Copy the SWPMI frame found at RxOffset in RxQueue, CRC checked by
+  *         the SWPMI
+  * @param  pLink: link context
+  * @param  Length: payload bytes
+  * @retval None
+  */
+static void FRAME_Link_Store(FRAME_LinkTypeDef *pLink, uint32_t Length)
+{
+  FRAME_Link_FrameTypeDef *frame;
+  const uint8_t *ring = (const uint8_t *)pLink->Config.pRing;
+  uint32_t offset = pLink->RxOffset;
+  uint32_t i;
+
+  if ((Length == 0U) || (Length > FRAME_LINK_MAX_PAYLOAD))
+  {
+    pLink->LengthErrors++;
+    return;
+  }
+  if ((pLink->RxHead - pLink->RxTail) >= FRAME_LINK_RX_FRAMES)
+  {
+    pLink->Dropped++;
+    return;
+  }
+
+  frame = &pLink->RxQueue[pLink->RxHead % FRAME_LINK_RX_FRAMES];
+  for (i = 0U; i < Length; i++)
+  {
+    frame->Data[i] = ring[offset];
+    offset++;
+    if (offset == pLink->Config.RingSize)
+    {
+      offset = 0U;
+    }
+  }
+  frame->Length = Length;
+  FRAME_Link_Publish(pLink);
+}
+#endif /* FRAME_LINK_USE_SWPMI */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
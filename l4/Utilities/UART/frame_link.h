@@ -0,0 +1,172 @@
+/**
+  ******************************************************************************
+  * @file    frame_link.h
+  * @author  MCD Application Team
+  * @brief   Header for frame_link module
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef _FRAME_LINK_H__
+#define _FRAME_LINK_H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+
+#if !defined(HAL_DMA_MODULE_ENABLED) || (!defined(HAL_UART_MODULE_ENABLED) && !defined(HAL_SWPMI_MODULE_ENABLED))
+#error "frame_link requires the HAL DMA driver and the HAL UART or SWPMI driver"
+#endif
+
+#if defined(HAL_SWPMI_MODULE_ENABLED) && defined(SWPMI1)
+#define FRAME_LINK_USE_SWPMI
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+/* Links served at the same time. Override in main.h. */
+#if !defined(FRAME_LINK_MAX_INSTANCES)
+#define FRAME_LINK_MAX_INSTANCES  2U
+#endif
+
+/* Largest payload of a frame, in bytes. Override in main.h. */
+#if !defined(FRAME_LINK_MAX_PAYLOAD)
+#define FRAME_LINK_MAX_PAYLOAD    64U
+#endif
+
+/* Validated frames waiting for the application. Override in main.h. */
+#if !defined(FRAME_LINK_RX_FRAMES)
+#define FRAME_LINK_RX_FRAMES      8U
+#endif
+
+/* Frames waiting for transmission. Override in main.h. */
+#if !defined(FRAME_LINK_TX_FRAMES)
+#define FRAME_LINK_TX_FRAMES      4U
+#endif
+
+/* Lock of power_mgr of the first link, the next ones use the Ids below,
+   with FRAME_LINK_USE_POWER_MGR. Override in main.h. */
+#if !defined(FRAME_LINK_PWR_LOCK)
+#define FRAME_LINK_PWR_LOCK       28U
+#endif
+
+/* Payload of a SWPMI frame, bounded by the peripheral */
+#define FRAME_LINK_SWPMI_MAX_PAYLOAD  30U
+
+/* CRC-16/CCITT of the LPUART frames, sent MSB first after the payload */
+#define FRAME_LINK_CRC_SIZE       2U
+
+/* Frame buffer, payload with its CRC or its SWPMI length byte, word rounded */
+#define FRAME_LINK_FRAME_SIZE     ((FRAME_LINK_MAX_PAYLOAD + FRAME_LINK_CRC_SIZE + 3U) & ~3U)
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum
+{
+  FRAME_LINK_LPUART = 0U,   /* Frames delimited by an idle line, CRC checked by software or the CRC unit */
+  FRAME_LINK_SWPMI  = 1U    /* Frames of the SWP protocol, CRC checked by the SWPMI                      */
+} FRAME_Link_TransportTypeDef;
+
+typedef struct
+{
+  FRAME_Link_TransportTypeDef Transport;
+#if defined(HAL_UART_MODULE_ENABLED)
+  UART_HandleTypeDef        *huart;             /* FRAME_LINK_LPUART: LPUART or USART             */
+#endif
+#if defined(FRAME_LINK_USE_SWPMI)
+  SWPMI_HandleTypeDef       *hswpmi;            /* FRAME_LINK_SWPMI                               */
+#endif
+#if defined(HAL_CRC_MODULE_ENABLED)
+  CRC_HandleTypeDef         *hcrc;              /* CRC unit set to CRC-16/CCITT, or NULL          */
+#endif
+  uint32_t                  *pRing;             /* Reception ring of the circular DMA             */
+  uint32_t                  RingSize;           /* Bytes, multiple of 4, 65532 at most            */
+  uint32_t                  StopWake;           /* FRAME_LINK_LPUART: 1 to let the device stop
+                                                   between frames, woken up by the start bit      */
+} FRAME_Link_ConfigTypeDef;
+
+typedef struct
+{
+  uint32_t                  Length;             /* Payload bytes (bytes to send in TxQueue)       */
+  uint8_t                   Data[FRAME_LINK_FRAME_SIZE];
+} FRAME_Link_FrameTypeDef;
+
+typedef struct
+{
+  FRAME_Link_ConfigTypeDef  Config;
+  __IO uint32_t             State;
+  uint32_t                  Slot;               /* Index in the links table, power_mgr lock       */
+  FRAME_Link_FrameTypeDef   RxQueue[FRAME_LINK_RX_FRAMES];
+  __IO uint32_t             RxHead;             /* Frames validated                               */
+  __IO uint32_t             RxTail;             /* Frames released by the application            */
+  uint32_t                  RxOffset;           /* SWPMI: ring offset of the next frame           */
+  uint32_t                  RxLength;           /* LPUART: bytes of the frame being received      */
+  uint32_t                  RxDiscard;          /* LPUART: frame being received dropped           */
+  __IO uint32_t             RxActive;           /* LPUART: frame being received                   */
+  FRAME_Link_FrameTypeDef   TxQueue[FRAME_LINK_TX_FRAMES];
+  __IO uint32_t             TxHead;             /* Frames queued                                  */
+  __IO uint32_t             TxTail;             /* Frames sent                                    */
+  __IO uint32_t             TxBusy;             /* Frame TxQueue[TxTail] being sent               */
+  uint32_t                  RxFrames;           /* Frames validated and queued                    */
+  uint32_t                  TxFrames;           /* Frames sent                                    */
+  uint32_t                  CrcErrors;          /* Frames with a wrong CRC                        */
+  uint32_t                  LengthErrors;       /* Frames too short or too long                   */
+  uint32_t                  Dropped;            /* Valid frames lost, RxQueue full                */
+  uint32_t                  Errors;             /* Overruns, framing and DMA errors               */
+} FRAME_LinkTypeDef;
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+HAL_StatusTypeDef FRAME_Link_Init(FRAME_LinkTypeDef *pLink, const FRAME_Link_ConfigTypeDef *pConfig);
+HAL_StatusTypeDef FRAME_Link_DeInit(FRAME_LinkTypeDef *pLink);
+HAL_StatusTypeDef FRAME_Link_Start(FRAME_LinkTypeDef *pLink);
+HAL_StatusTypeDef FRAME_Link_Stop(FRAME_LinkTypeDef *pLink);
+HAL_StatusTypeDef FRAME_Link_Send(FRAME_LinkTypeDef *pLink, const uint8_t *pData, uint32_t Length);
+const uint8_t    *FRAME_Link_Peek(FRAME_LinkTypeDef *pLink, uint32_t *pLength);
+void              FRAME_Link_Release(FRAME_LinkTypeDef *pLink);
+uint32_t          FRAME_Link_GetPending(FRAME_LinkTypeDef *pLink);
+uint16_t          FRAME_Link_Crc16(const uint8_t *pData, uint32_t Length);
+
+#if defined(FRAME_LINK_USE_SWPMI)
+void FRAME_Link_SWPMI_IRQHandler(FRAME_LinkTypeDef *pLink);
+#endif
+
+void FRAME_Link_RxCallback(FRAME_LinkTypeDef *pLink);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _FRAME_LINK_H__ */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,531 @@
+/**
+  ******************************************************************************
+  * @file    rs485_bus.c
+  * @author  MCD Application Team
+  * @brief   RS-485 frames delimited by the USART receiver timeout, DMA in both directions
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; COPYRIGHT(c) 2019 STMicroelectronics</center></h2>
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+
+/********************** NOTES **********************************************
+To use this module, the following steps should be followed :
+
+1- initialize the USART with HAL_RS485Ex_Init(): the USART drives the DE
+   pin of the transceiver, asserted AssertionTime sample times ahead of the
+   first start bit and released DeassertionTime sample times after the last
+   stop bit, with no CPU at the bus turnaround. Link a DMA channel to each
+   direction, byte transfers: hdmarx in circular mode, hdmatx in normal mode.
+   The LPUART has no receiver timeout and is not supported.
+
+2- RS485_Bus_Init() takes the USART and the reception ring, two frames long
+   at least. The frames are closed by the receiver timeout of the USART after
+   FrameGap bit times of silence; FrameGap = 0 gives the Modbus RTU t3.5:
+   3.5 characters up to 19200 bit/s, RS485_BUS_FIXED_GAP_US above. On the
+   cores with a data cache, the ring is 32 bytes aligned and a multiple of 32
+   bytes, and the bus context is in a memory reachable by the DMA.
+
+3- call RS485_Bus_IRQHandler() from the USART interrupt handler in place of
+   HAL_UART_IRQHandler(). RS485_Bus_Start() starts the circular reception: the
+   DMA fills the ring on its own and the CPU only runs at the receiver timeout
+   of each frame, to copy it in RxQueue and call RS485_Bus_RxCallback(). The
+   frames with a line error, too long or not fitting in RxQueue are counted
+   and dropped. No DMA interrupt is used.
+
+4- the application reads the frames in place with RS485_Bus_Peek() and gives
+   each one back with RS485_Bus_Release().
+
+5- RS485_Bus_Send() copies a frame and sends it by DMA: at once on an idle
+   bus, at the receiver timeout of the frame being received otherwise, so a
+   reply never starts within the frame gap. The end of the last stop bit
+   calls RS485_Bus_TxCpltCallback(), the one interrupt of the frame sent.
+   With EchoSuppress, the receiver is off while sending, for transceivers
+   whose receiver stays enabled with DE. The silence between two frames sent
+   in a row (Modbus broadcast turnaround delay) is left to the application.
+
+6- the HAL UART functions return HAL_BUSY on the USART while the bus runs.
+*******************************************************************************/
+
+
+/* Includes ------------------------------------------------------------------*/
+#include "rs485_bus.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define RS485_BUS_STATE_RESET     0U
+#define RS485_BUS_STATE_READY     1U
+#define RS485_BUS_STATE_RUNNING   2U
+
+#define RS485_BUS_TX_IDLE         0U
+#define RS485_BUS_TX_WAIT         1U  /* Waiting for the end of the frame received */
+#define RS485_BUS_TX_SENDING      2U
+
+/* Line errors of the receiver */
+#define RS485_BUS_ISR_ERRORS      (USART_ISR_PE | USART_ISR_FE | USART_ISR_NE | USART_ISR_ORE)
+#define RS485_BUS_CLEAR_ERRORS    (UART_CLEAR_PEF | UART_CLEAR_FEF | UART_CLEAR_NEF | UART_CLEAR_OREF)
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static uint32_t RS485_Bus_Gap(const UART_HandleTypeDef *huart);
+static uint32_t RS485_Bus_WritePos(RS485_BusTypeDef *pBus);
+static void RS485_Bus_EndFrame(RS485_BusTypeDef *pBus);
+static void RS485_Bus_StartTx(RS485_BusTypeDef *pBus);
+static void RS485_Bus_EndTx(RS485_BusTypeDef *pBus);
+
+/* Functions Definition ------------------------------------------------------*/
+
+/**
+  * @brief  Bind a bus to its USART and compute its frame gap
+  * @param  pBus: bus context, kept by the module
+  * @param  pConfig: USART and reception ring, copied
+  * @retval HAL status
+  */
+HAL_StatusTypeDef RS485_Bus_Init(RS485_BusTypeDef *pBus, const RS485_Bus_ConfigTypeDef *pConfig)
+{
+  UART_HandleTypeDef *huart;
+
+  if ((pBus == NULL) || (pConfig == NULL) || (pConfig->huart == NULL) || (pConfig->pRing == NULL) ||
+      (pConfig->RingSize < (2U * RS485_BUS_MAX_FRAME)) || (pConfig->RingSize > 0xFFFFU) ||
+      (pConfig->FrameGap > RS485_BUS_MAX_GAP))
+  {
+    return HAL_ERROR;
+  }
+  huart = pConfig->huart;
+  if ((huart->hdmarx == NULL) || (huart->hdmatx == NULL) || (huart->hdmarx->Init.Mode != DMA_CIRCULAR) ||
+      (READ_BIT(huart->Instance->CR3, USART_CR3_DEM) == 0U))
+  {
+    return HAL_ERROR;
+  }
+#if defined(LPUART1)
+  if (IS_LPUART_INSTANCE(huart->Instance))
+  {
+    return HAL_ERROR;
+  }
+#endif
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  if (((((uint32_t)pConfig->pRing) & 31U) != 0U) || ((pConfig->RingSize & 31U) != 0U))
+  {
+    return HAL_ERROR;
+  }
+#endif
+
+  memset(pBus, 0, sizeof(RS485_BusTypeDef));
+  pBus->Config = *pConfig;
+  pBus->Gap    = (pConfig->FrameGap != 0U) ? pConfig->FrameGap : RS485_Bus_Gap(huart);
+  pBus->State  = RS485_BUS_STATE_READY;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Start the circular reception of a bus, RxQueue emptied
+  * @param  pBus: bus context
+  * @retval HAL status
+  */
+HAL_StatusTypeDef RS485_Bus_Start(RS485_BusTypeDef *pBus)
+{
+  UART_HandleTypeDef *huart;
+
+  if ((pBus == NULL) || (pBus->State != RS485_BUS_STATE_READY))
+  {
+    return HAL_ERROR;
+  }
+  huart = pBus->Config.huart;
+  if ((huart->gState != HAL_UART_STATE_READY) || (huart->RxState != HAL_UART_STATE_READY))
+  {
+    return HAL_BUSY;
+  }
+
+  pBus->RxHead   = 0U;
+  pBus->RxTail   = 0U;
+  pBus->RxOffset = 0U;
+  pBus->RxError  = 0U;
+  pBus->TxState  = RS485_BUS_TX_IDLE;
+
+  if (HAL_DMA_Start(huart->hdmarx, (uint32_t)&huart->Instance->RDR, (uint32_t)pBus->Config.pRing,
+                    pBus->Config.RingSize) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+  huart->gState  = HAL_UART_STATE_BUSY;
+  huart->RxState = HAL_UART_STATE_BUSY_RX;
+  pBus->State    = RS485_BUS_STATE_RUNNING;
+
+  WRITE_REG(huart->Instance->ICR, RS485_BUS_CLEAR_ERRORS | USART_ICR_RTOCF);
+  MODIFY_REG(huart->Instance->RTOR, USART_RTOR_RTO, pBus->Gap);
+  SET_BIT(huart->Instance->CR2, USART_CR2_RTOEN);
+  SET_BIT(huart->Instance->CR3, USART_CR3_EIE | USART_CR3_DMAR);
+  SET_BIT(huart->Instance->CR1, USART_CR1_PEIE | USART_CR1_RTOIE);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop a bus, frame being sent aborted
+  * @param  pBus: bus context
+  * @retval HAL status
+  */
+HAL_StatusTypeDef RS485_Bus_Stop(RS485_BusTypeDef *pBus)
+{
+  UART_HandleTypeDef *huart;
+
+  if ((pBus == NULL) || (pBus->State != RS485_BUS_STATE_RUNNING))
+  {
+    return HAL_ERROR;
+  }
+  huart = pBus->Config.huart;
+
+  CLEAR_BIT(huart->Instance->CR1, USART_CR1_PEIE | USART_CR1_RTOIE | USART_CR1_TCIE);
+  CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE | USART_CR3_DMAR | USART_CR3_DMAT);
+  CLEAR_BIT(huart->Instance->CR2, USART_CR2_RTOEN);
+  (void)HAL_DMA_Abort(huart->hdmarx);
+  if (pBus->TxState == RS485_BUS_TX_SENDING)
+  {
+    (void)HAL_DMA_Abort(huart->hdmatx);
+  }
+  SET_BIT(huart->Instance->CR1, USART_CR1_RE);
+
+  pBus->TxState  = RS485_BUS_TX_IDLE;
+  pBus->State    = RS485_BUS_STATE_READY;
+  huart->gState  = HAL_UART_STATE_READY;
+  huart->RxState = HAL_UART_STATE_READY;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Send a frame, at once on an idle bus or at the end of the frame
+  *         being received
+  * @param  pBus: bus context
+  * @param  pData: frame, copied
+  * @param  Length: bytes, RS485_BUS_MAX_FRAME at most
+  * @retval HAL status, HAL_BUSY while the previous frame is not sent
+  */
+HAL_StatusTypeDef RS485_Bus_Send(RS485_BusTypeDef *pBus, const uint8_t *pData, uint32_t Length)
+{
+  uint32_t primask;
+
+  if ((pBus == NULL) || (pData == NULL) || (Length == 0U) || (Length > RS485_BUS_MAX_FRAME) ||
+      (pBus->State != RS485_BUS_STATE_RUNNING))
+  {
+    return HAL_ERROR;
+  }
+  if (pBus->TxState != RS485_BUS_TX_IDLE)
+  {
+    return HAL_BUSY;
+  }
+
+  memcpy(pBus->TxBuffer, pData, Length);
+  pBus->TxLength = Length;
+
+  /* No byte received since the last receiver timeout: the bus is idle */
+  primask = __get_PRIMASK();
+  __disable_irq();
+  pBus->TxState = RS485_BUS_TX_WAIT;
+  if (RS485_Bus_WritePos(pBus) == pBus->RxOffset)
+  {
+    RS485_Bus_StartTx(pBus);
+  }
+  __set_PRIMASK(primask);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Oldest frame received, left in RxQueue up to RS485_Bus_Release()
+  * @param  pBus: bus context
+  * @param  pLength: bytes of the frame
+  * @retval Frame, NULL when no frame is pending
+  */
+const uint8_t *RS485_Bus_Peek(RS485_BusTypeDef *pBus, uint32_t *pLength)
+{
+  RS485_Bus_FrameTypeDef *frame;
+
+  if ((pBus == NULL) || (pBus->RxHead == pBus->RxTail))
+  {
+    return NULL;
+  }
+  frame = &pBus->RxQueue[pBus->RxTail % RS485_BUS_RX_FRAMES];
+  if (pLength != NULL)
+  {
+    *pLength = frame->Length;
+  }
+
+  return frame->Data;
+}
+
+/**
+  * @brief  Give the frame of RS485_Bus_Peek() back to the reception
+  * @param  pBus: bus context
+  * @retval None
+  */
+void RS485_Bus_Release(RS485_BusTypeDef *pBus)
+{
+  if ((pBus != NULL) && (pBus->RxHead != pBus->RxTail))
+  {
+    /* Frame read before its slot is given back */
+    __DMB();
+    pBus->RxTail++;
+  }
+}
+
+/**
+  * @brief  Frames received and not released
+  * @param  pBus: bus context
+  * @retval Number of frames
+  */
+uint32_t RS485_Bus_GetPending(RS485_BusTypeDef *pBus)
+{
+  return (pBus != NULL) ? (pBus->RxHead - pBus->RxTail) : 0U;
+}
+
+/**
+  * @brief  USART interrupt of a bus: line errors, receiver timeout closing a
+  *         frame received, transmission complete of a frame sent
+  * @param  pBus: bus context
+  * @retval None
+  */
+void RS485_Bus_IRQHandler(RS485_BusTypeDef *pBus)
+{
+  UART_HandleTypeDef *huart = pBus->Config.huart;
+  uint32_t isr = READ_REG(huart->Instance->ISR);
+  uint32_t cr1 = READ_REG(huart->Instance->CR1);
+
+  /* The frame being received is dropped at its end */
+  if ((isr & RS485_BUS_ISR_ERRORS) != 0U)
+  {
+    WRITE_REG(huart->Instance->ICR, RS485_BUS_CLEAR_ERRORS);
+    pBus->RxError = 1U;
+  }
+  if (((isr & USART_ISR_RTOF) != 0U) && ((cr1 & USART_CR1_RTOIE) != 0U))
+  {
+    WRITE_REG(huart->Instance->ICR, USART_ICR_RTOCF);
+    RS485_Bus_EndFrame(pBus);
+  }
+  if (((isr & USART_ISR_TC) != 0U) && ((cr1 & USART_CR1_TCIE) != 0U))
+  {
+    RS485_Bus_EndTx(pBus);
+  }
+}
+
+/**
+  * @brief  Frame received and queued
+  * @param  pBus: bus context
+  * @note   Called from the interrupt. Read the frame with RS485_Bus_Peek().
+  * @retval None
+  */
+__weak void RS485_Bus_RxCallback(RS485_BusTypeDef *pBus)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(pBus);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the RS485_Bus_RxCallback could be implemented in the user file
+   */
+}
+
+/**
+  * @brief  Frame sent, DE released by the USART
+  * @param  pBus: bus context
+  * @note   Called from the interrupt.
+  * @retval None
+  */
+__weak void RS485_Bus_TxCpltCallback(RS485_BusTypeDef *pBus)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(pBus);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the RS485_Bus_TxCpltCallback could be implemented in the user file
+   */
+}
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Modbus RTU frame gap: 3.5 characters up to 19200 bit/s,
+  *         RS485_BUS_FIXED_GAP_US above
+  * @param  huart: UART handle
+  * @retval Bit times
+  */
+static uint32_t RS485_Bus_Gap(const UART_HandleTypeDef *huart)
+{
+  /* Start bit, 8 data and parity bits, stop bit */
+  uint32_t bits = 10U;
+
+  if (huart->Init.WordLength == UART_WORDLENGTH_9B)
+  {
+    bits++;
+  }
+  else if (huart->Init.WordLength == UART_WORDLENGTH_7B)
+  {
+    bits--;
+  }
+  if (huart->Init.StopBits != UART_STOPBITS_1)
+  {
+    bits++;
+  }
+
+  if (huart->Init.BaudRate <= 19200U)
+  {
+    return ((7U * bits) + 1U) / 2U;
+  }
+  return (uint32_t)((((uint64_t)RS485_BUS_FIXED_GAP_US * huart->Init.BaudRate) + 999999U) / 1000000U);
+}
+
+/**
+  * @brief  Ring offset of the next byte written by the DMA
+  * @param  pBus: bus context
+  * @retval Offset
+  */
+static uint32_t RS485_Bus_WritePos(RS485_BusTypeDef *pBus)
+{
+  uint32_t pos = pBus->Config.RingSize - __HAL_DMA_GET_COUNTER(pBus->Config.huart->hdmarx);
+
+  return (pos < pBus->Config.RingSize) ? pos : 0U;
+}
+
+/**
+  * @brief  Receiver timeout: copy the frame from the ring to RxQueue, then
+  *         send the frame waiting for the bus
+  * @param  pBus: bus context
+  * @retval None
+  */
+static void RS485_Bus_EndFrame(RS485_BusTypeDef *pBus)
+{
+  RS485_Bus_FrameTypeDef *frame;
+  uint32_t size  = pBus->Config.RingSize;
+  uint32_t read  = pBus->RxOffset;
+  uint32_t write = RS485_Bus_WritePos(pBus);
+  uint32_t length = (write >= read) ? (write - read) : ((size - read) + write);
+  uint32_t first;
+
+  pBus->RxOffset = write;
+  if (length == 0U)
+  {
+    /* Nothing received since the last timeout */
+  }
+  else if (pBus->RxError != 0U)
+  {
+    pBus->LineErrors++;
+  }
+  else if (length > RS485_BUS_MAX_FRAME)
+  {
+    pBus->LengthErrors++;
+  }
+  else if ((pBus->RxHead - pBus->RxTail) >= RS485_BUS_RX_FRAMES)
+  {
+    pBus->Dropped++;
+  }
+  else
+  {
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    SCB_InvalidateDCache_by_Addr((uint32_t *)(uint32_t)pBus->Config.pRing, (int32_t)size);
+#endif
+    frame = &pBus->RxQueue[pBus->RxHead % RS485_BUS_RX_FRAMES];
+    first = size - read;
+    if (first > length)
+    {
+      first = length;
+    }
+    memcpy(frame->Data, &pBus->Config.pRing[read], first);
+    memcpy(&frame->Data[first], pBus->Config.pRing, length - first);
+    frame->Length = length;
+
+    /* Frame written before it is published */
+    __DMB();
+    pBus->RxHead++;
+    pBus->RxFrames++;
+    RS485_Bus_RxCallback(pBus);
+  }
+  pBus->RxError = 0U;
+
+  if (pBus->TxState == RS485_BUS_TX_WAIT)
+  {
+    RS485_Bus_StartTx(pBus);
+  }
+}
+
+/**
+  * @brief  Start the DMA transmission of TxBuffer, DE driven by the USART
+  * @param  pBus: bus context
+  * @retval None
+  */
+static void RS485_Bus_StartTx(RS485_BusTypeDef *pBus)
+{
+  UART_HandleTypeDef *huart = pBus->Config.huart;
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  uint32_t line = ((uint32_t)pBus->TxBuffer) & ~31U;
+
+  SCB_CleanDCache_by_Addr((uint32_t *)line, (int32_t)((((uint32_t)pBus->TxBuffer) - line) + pBus->TxLength));
+#endif
+
+  if (pBus->Config.EchoSuppress != 0U)
+  {
+    CLEAR_BIT(huart->Instance->CR1, USART_CR1_RE);
+  }
+  if (HAL_DMA_Start(huart->hdmatx, (uint32_t)pBus->TxBuffer, (uint32_t)&huart->Instance->TDR,
+                    pBus->TxLength) != HAL_OK)
+  {
+    SET_BIT(huart->Instance->CR1, USART_CR1_RE);
+    pBus->TxErrors++;
+    pBus->TxState = RS485_BUS_TX_IDLE;
+    return;
+  }
+  pBus->TxState = RS485_BUS_TX_SENDING;
+
+  WRITE_REG(huart->Instance->ICR, UART_CLEAR_TCF);
+  SET_BIT(huart->Instance->CR3, USART_CR3_DMAT);
+  SET_BIT(huart->Instance->CR1, USART_CR1_TCIE);
+}
+
+/**
+  * @brief  Transmission complete: last stop bit sent, receiver back on
+  * @param  pBus: bus context
+  * @retval None
+  */
+static void RS485_Bus_EndTx(RS485_BusTypeDef *pBus)
+{
+  UART_HandleTypeDef *huart = pBus->Config.huart;
+
+  CLEAR_BIT(huart->Instance->CR1, USART_CR1_TCIE);
+  CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAT);
+
+  /* DMA transfer complete long ago, the channel is only given back */
+  (void)HAL_DMA_PollForTransfer(huart->hdmatx, HAL_DMA_FULL_TRANSFER, 0U);
+  SET_BIT(huart->Instance->CR1, USART_CR1_RE);
+
+  pBus->TxFrames++;
+  pBus->TxState = RS485_BUS_TX_IDLE;
+  RS485_Bus_TxCpltCallback(pBus);
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/